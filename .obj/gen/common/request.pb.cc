@@ -0,0 +1,1770 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: common/request.proto
+
+#include "common/request.pb.h"
+
+#include <algorithm>
+
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/extension_set.h>
+#include <google/protobuf/wire_format_lite.h>
+#include <google/protobuf/descriptor.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/reflection_ops.h>
+#include <google/protobuf/wire_format.h>
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+
+PROTOBUF_PRAGMA_INIT_SEG
+
+namespace _pb = ::PROTOBUF_NAMESPACE_ID;
+namespace _pbi = _pb::internal;
+
+namespace dsnet {
+PROTOBUF_CONSTEXPR ShardOp::ShardOp(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.op_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.msgnum_)*/uint64_t{0u}
+  , /*decltype(_impl_.shard_)*/0u} {}
+struct ShardOpDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ShardOpDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ShardOpDefaultTypeInternal() {}
+  union {
+    ShardOp _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ShardOpDefaultTypeInternal _ShardOp_default_instance_;
+PROTOBUF_CONSTEXPR Request::Request(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.ops_)*/{}
+  , /*decltype(_impl_.op_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.clientaddr_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.clientid_)*/uint64_t{0u}
+  , /*decltype(_impl_.clientreqid_)*/uint64_t{0u}
+  , /*decltype(_impl_.sessnum_)*/uint64_t{0u}} {}
+struct RequestDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR RequestDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~RequestDefaultTypeInternal() {}
+  union {
+    Request _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 RequestDefaultTypeInternal _Request_default_instance_;
+PROTOBUF_CONSTEXPR UnloggedRequest::UnloggedRequest(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.op_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.clientid_)*/uint64_t{0u}
+  , /*decltype(_impl_.clientreqid_)*/uint64_t{0u}} {}
+struct UnloggedRequestDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR UnloggedRequestDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~UnloggedRequestDefaultTypeInternal() {}
+  union {
+    UnloggedRequest _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 UnloggedRequestDefaultTypeInternal _UnloggedRequest_default_instance_;
+PROTOBUF_CONSTEXPR MsgLogEntry::MsgLogEntry(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.hash_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.request_)*/nullptr
+  , /*decltype(_impl_.view_)*/uint64_t{0u}
+  , /*decltype(_impl_.opnum_)*/uint64_t{0u}
+  , /*decltype(_impl_.sessnum_)*/uint64_t{0u}
+  , /*decltype(_impl_.msgnum_)*/uint64_t{0u}
+  , /*decltype(_impl_.shardnum_)*/0u
+  , /*decltype(_impl_.state_)*/0u} {}
+struct MsgLogEntryDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR MsgLogEntryDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~MsgLogEntryDefaultTypeInternal() {}
+  union {
+    MsgLogEntry _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 MsgLogEntryDefaultTypeInternal _MsgLogEntry_default_instance_;
+}  // namespace dsnet
+static ::_pb::Metadata file_level_metadata_common_2frequest_2eproto[4];
+static constexpr ::_pb::EnumDescriptor const** file_level_enum_descriptors_common_2frequest_2eproto = nullptr;
+static constexpr ::_pb::ServiceDescriptor const** file_level_service_descriptors_common_2frequest_2eproto = nullptr;
+
+const uint32_t TableStruct_common_2frequest_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  PROTOBUF_FIELD_OFFSET(::dsnet::ShardOp, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::ShardOp, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::dsnet::ShardOp, _impl_.shard_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::ShardOp, _impl_.op_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::ShardOp, _impl_.msgnum_),
+  2,
+  0,
+  1,
+  PROTOBUF_FIELD_OFFSET(::dsnet::Request, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::Request, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::dsnet::Request, _impl_.op_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::Request, _impl_.clientid_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::Request, _impl_.clientreqid_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::Request, _impl_.ops_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::Request, _impl_.sessnum_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::Request, _impl_.clientaddr_),
+  0,
+  2,
+  3,
+  ~0u,
+  4,
+  1,
+  PROTOBUF_FIELD_OFFSET(::dsnet::UnloggedRequest, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::UnloggedRequest, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::dsnet::UnloggedRequest, _impl_.op_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::UnloggedRequest, _impl_.clientid_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::UnloggedRequest, _impl_.clientreqid_),
+  0,
+  1,
+  2,
+  PROTOBUF_FIELD_OFFSET(::dsnet::MsgLogEntry, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::MsgLogEntry, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::dsnet::MsgLogEntry, _impl_.view_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::MsgLogEntry, _impl_.opnum_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::MsgLogEntry, _impl_.sessnum_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::MsgLogEntry, _impl_.msgnum_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::MsgLogEntry, _impl_.shardnum_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::MsgLogEntry, _impl_.request_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::MsgLogEntry, _impl_.state_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::MsgLogEntry, _impl_.hash_),
+  2,
+  3,
+  4,
+  5,
+  6,
+  1,
+  7,
+  0,
+};
+static const ::_pbi::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  { 0, 9, -1, sizeof(::dsnet::ShardOp)},
+  { 12, 24, -1, sizeof(::dsnet::Request)},
+  { 30, 39, -1, sizeof(::dsnet::UnloggedRequest)},
+  { 42, 56, -1, sizeof(::dsnet::MsgLogEntry)},
+};
+
+static const ::_pb::Message* const file_default_instances[] = {
+  &::dsnet::_ShardOp_default_instance_._instance,
+  &::dsnet::_Request_default_instance_._instance,
+  &::dsnet::_UnloggedRequest_default_instance_._instance,
+  &::dsnet::_MsgLogEntry_default_instance_._instance,
+};
+
+const char descriptor_table_protodef_common_2frequest_2eproto[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) =
+  "\n\024common/request.proto\022\005dsnet\"4\n\007ShardOp"
+  "\022\r\n\005shard\030\001 \002(\r\022\n\n\002op\030\002 \002(\014\022\016\n\006msgnum\030\003 "
+  "\001(\004\"~\n\007Request\022\n\n\002op\030\001 \002(\014\022\020\n\010clientid\030\002"
+  " \002(\004\022\023\n\013clientreqid\030\003 \002(\004\022\033\n\003ops\030\004 \003(\0132\016"
+  ".dsnet.ShardOp\022\017\n\007sessnum\030\005 \001(\004\022\022\n\nclien"
+  "taddr\030\006 \001(\014\"D\n\017UnloggedRequest\022\n\n\002op\030\001 \002"
+  "(\014\022\020\n\010clientid\030\002 \002(\004\022\023\n\013clientreqid\030\003 \002("
+  "\004\"\233\001\n\013MsgLogEntry\022\014\n\004view\030\001 \002(\004\022\r\n\005opnum"
+  "\030\002 \002(\004\022\017\n\007sessnum\030\003 \002(\004\022\016\n\006msgnum\030\004 \002(\004\022"
+  "\020\n\010shardnum\030\005 \002(\r\022\037\n\007request\030\006 \002(\0132\016.dsn"
+  "et.Request\022\r\n\005state\030\007 \002(\r\022\014\n\004hash\030\010 \002(\014"
+  ;
+static ::_pbi::once_flag descriptor_table_common_2frequest_2eproto_once;
+const ::_pbi::DescriptorTable descriptor_table_common_2frequest_2eproto = {
+    false, false, 439, descriptor_table_protodef_common_2frequest_2eproto,
+    "common/request.proto",
+    &descriptor_table_common_2frequest_2eproto_once, nullptr, 0, 4,
+    schemas, file_default_instances, TableStruct_common_2frequest_2eproto::offsets,
+    file_level_metadata_common_2frequest_2eproto, file_level_enum_descriptors_common_2frequest_2eproto,
+    file_level_service_descriptors_common_2frequest_2eproto,
+};
+PROTOBUF_ATTRIBUTE_WEAK const ::_pbi::DescriptorTable* descriptor_table_common_2frequest_2eproto_getter() {
+  return &descriptor_table_common_2frequest_2eproto;
+}
+
+// Force running AddDescriptors() at dynamic initialization time.
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 static ::_pbi::AddDescriptorsRunner dynamic_init_dummy_common_2frequest_2eproto(&descriptor_table_common_2frequest_2eproto);
+namespace dsnet {
+
+// ===================================================================
+
+class ShardOp::_Internal {
+ public:
+  using HasBits = decltype(std::declval<ShardOp>()._impl_._has_bits_);
+  static void set_has_shard(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static void set_has_op(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_msgnum(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000005) ^ 0x00000005) != 0;
+  }
+};
+
+ShardOp::ShardOp(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:dsnet.ShardOp)
+}
+ShardOp::ShardOp(const ShardOp& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  ShardOp* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.op_){}
+    , decltype(_impl_.msgnum_){}
+    , decltype(_impl_.shard_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.op_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.op_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_op()) {
+    _this->_impl_.op_.Set(from._internal_op(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.msgnum_, &from._impl_.msgnum_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.shard_) -
+    reinterpret_cast<char*>(&_impl_.msgnum_)) + sizeof(_impl_.shard_));
+  // @@protoc_insertion_point(copy_constructor:dsnet.ShardOp)
+}
+
+inline void ShardOp::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.op_){}
+    , decltype(_impl_.msgnum_){uint64_t{0u}}
+    , decltype(_impl_.shard_){0u}
+  };
+  _impl_.op_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.op_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+ShardOp::~ShardOp() {
+  // @@protoc_insertion_point(destructor:dsnet.ShardOp)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void ShardOp::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.op_.Destroy();
+}
+
+void ShardOp::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void ShardOp::Clear() {
+// @@protoc_insertion_point(message_clear_start:dsnet.ShardOp)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    _impl_.op_.ClearNonDefaultToEmpty();
+  }
+  if (cached_has_bits & 0x00000006u) {
+    ::memset(&_impl_.msgnum_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.shard_) -
+        reinterpret_cast<char*>(&_impl_.msgnum_)) + sizeof(_impl_.shard_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* ShardOp::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required uint32 shard = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_shard(&has_bits);
+          _impl_.shard_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required bytes op = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_op();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint64 msgnum = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _Internal::set_has_msgnum(&has_bits);
+          _impl_.msgnum_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* ShardOp::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:dsnet.ShardOp)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required uint32 shard = 1;
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(1, this->_internal_shard(), target);
+  }
+
+  // required bytes op = 2;
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->WriteBytesMaybeAliased(
+        2, this->_internal_op(), target);
+  }
+
+  // optional uint64 msgnum = 3;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(3, this->_internal_msgnum(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:dsnet.ShardOp)
+  return target;
+}
+
+size_t ShardOp::RequiredFieldsByteSizeFallback() const {
+// @@protoc_insertion_point(required_fields_byte_size_fallback_start:dsnet.ShardOp)
+  size_t total_size = 0;
+
+  if (_internal_has_op()) {
+    // required bytes op = 2;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_op());
+  }
+
+  if (_internal_has_shard()) {
+    // required uint32 shard = 1;
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_shard());
+  }
+
+  return total_size;
+}
+size_t ShardOp::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:dsnet.ShardOp)
+  size_t total_size = 0;
+
+  if (((_impl_._has_bits_[0] & 0x00000005) ^ 0x00000005) == 0) {  // All required fields are present.
+    // required bytes op = 2;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_op());
+
+    // required uint32 shard = 1;
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_shard());
+
+  } else {
+    total_size += RequiredFieldsByteSizeFallback();
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // optional uint64 msgnum = 3;
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000002u) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_msgnum());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ShardOp::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    ShardOp::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ShardOp::GetClassData() const { return &_class_data_; }
+
+
+void ShardOp::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<ShardOp*>(&to_msg);
+  auto& from = static_cast<const ShardOp&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:dsnet.ShardOp)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_op(from._internal_op());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.msgnum_ = from._impl_.msgnum_;
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.shard_ = from._impl_.shard_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void ShardOp::CopyFrom(const ShardOp& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:dsnet.ShardOp)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool ShardOp::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  return true;
+}
+
+void ShardOp::InternalSwap(ShardOp* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.op_, lhs_arena,
+      &other->_impl_.op_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(ShardOp, _impl_.shard_)
+      + sizeof(ShardOp::_impl_.shard_)
+      - PROTOBUF_FIELD_OFFSET(ShardOp, _impl_.msgnum_)>(
+          reinterpret_cast<char*>(&_impl_.msgnum_),
+          reinterpret_cast<char*>(&other->_impl_.msgnum_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata ShardOp::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_common_2frequest_2eproto_getter, &descriptor_table_common_2frequest_2eproto_once,
+      file_level_metadata_common_2frequest_2eproto[0]);
+}
+
+// ===================================================================
+
+class Request::_Internal {
+ public:
+  using HasBits = decltype(std::declval<Request>()._impl_._has_bits_);
+  static void set_has_op(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_clientid(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static void set_has_clientreqid(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+  static void set_has_sessnum(HasBits* has_bits) {
+    (*has_bits)[0] |= 16u;
+  }
+  static void set_has_clientaddr(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x0000000d) ^ 0x0000000d) != 0;
+  }
+};
+
+Request::Request(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:dsnet.Request)
+}
+Request::Request(const Request& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  Request* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.ops_){from._impl_.ops_}
+    , decltype(_impl_.op_){}
+    , decltype(_impl_.clientaddr_){}
+    , decltype(_impl_.clientid_){}
+    , decltype(_impl_.clientreqid_){}
+    , decltype(_impl_.sessnum_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.op_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.op_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_op()) {
+    _this->_impl_.op_.Set(from._internal_op(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.clientaddr_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.clientaddr_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_clientaddr()) {
+    _this->_impl_.clientaddr_.Set(from._internal_clientaddr(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.clientid_, &from._impl_.clientid_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.sessnum_) -
+    reinterpret_cast<char*>(&_impl_.clientid_)) + sizeof(_impl_.sessnum_));
+  // @@protoc_insertion_point(copy_constructor:dsnet.Request)
+}
+
+inline void Request::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.ops_){arena}
+    , decltype(_impl_.op_){}
+    , decltype(_impl_.clientaddr_){}
+    , decltype(_impl_.clientid_){uint64_t{0u}}
+    , decltype(_impl_.clientreqid_){uint64_t{0u}}
+    , decltype(_impl_.sessnum_){uint64_t{0u}}
+  };
+  _impl_.op_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.op_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.clientaddr_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.clientaddr_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+Request::~Request() {
+  // @@protoc_insertion_point(destructor:dsnet.Request)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void Request::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.ops_.~RepeatedPtrField();
+  _impl_.op_.Destroy();
+  _impl_.clientaddr_.Destroy();
+}
+
+void Request::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void Request::Clear() {
+// @@protoc_insertion_point(message_clear_start:dsnet.Request)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.ops_.Clear();
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      _impl_.op_.ClearNonDefaultToEmpty();
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _impl_.clientaddr_.ClearNonDefaultToEmpty();
+    }
+  }
+  if (cached_has_bits & 0x0000001cu) {
+    ::memset(&_impl_.clientid_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.sessnum_) -
+        reinterpret_cast<char*>(&_impl_.clientid_)) + sizeof(_impl_.sessnum_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* Request::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required bytes op = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_op();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required uint64 clientid = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _Internal::set_has_clientid(&has_bits);
+          _impl_.clientid_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required uint64 clientreqid = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _Internal::set_has_clientreqid(&has_bits);
+          _impl_.clientreqid_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .dsnet.ShardOp ops = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_ops(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<34>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint64 sessnum = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          _Internal::set_has_sessnum(&has_bits);
+          _impl_.sessnum_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional bytes clientaddr = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 50)) {
+          auto str = _internal_mutable_clientaddr();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* Request::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:dsnet.Request)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required bytes op = 1;
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->WriteBytesMaybeAliased(
+        1, this->_internal_op(), target);
+  }
+
+  // required uint64 clientid = 2;
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(2, this->_internal_clientid(), target);
+  }
+
+  // required uint64 clientreqid = 3;
+  if (cached_has_bits & 0x00000008u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(3, this->_internal_clientreqid(), target);
+  }
+
+  // repeated .dsnet.ShardOp ops = 4;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_ops_size()); i < n; i++) {
+    const auto& repfield = this->_internal_ops(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(4, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  // optional uint64 sessnum = 5;
+  if (cached_has_bits & 0x00000010u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(5, this->_internal_sessnum(), target);
+  }
+
+  // optional bytes clientaddr = 6;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->WriteBytesMaybeAliased(
+        6, this->_internal_clientaddr(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:dsnet.Request)
+  return target;
+}
+
+size_t Request::RequiredFieldsByteSizeFallback() const {
+// @@protoc_insertion_point(required_fields_byte_size_fallback_start:dsnet.Request)
+  size_t total_size = 0;
+
+  if (_internal_has_op()) {
+    // required bytes op = 1;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_op());
+  }
+
+  if (_internal_has_clientid()) {
+    // required uint64 clientid = 2;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_clientid());
+  }
+
+  if (_internal_has_clientreqid()) {
+    // required uint64 clientreqid = 3;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_clientreqid());
+  }
+
+  return total_size;
+}
+size_t Request::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:dsnet.Request)
+  size_t total_size = 0;
+
+  if (((_impl_._has_bits_[0] & 0x0000000d) ^ 0x0000000d) == 0) {  // All required fields are present.
+    // required bytes op = 1;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_op());
+
+    // required uint64 clientid = 2;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_clientid());
+
+    // required uint64 clientreqid = 3;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_clientreqid());
+
+  } else {
+    total_size += RequiredFieldsByteSizeFallback();
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .dsnet.ShardOp ops = 4;
+  total_size += 1UL * this->_internal_ops_size();
+  for (const auto& msg : this->_impl_.ops_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // optional bytes clientaddr = 6;
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000002u) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_clientaddr());
+  }
+
+  // optional uint64 sessnum = 5;
+  if (cached_has_bits & 0x00000010u) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_sessnum());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData Request::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    Request::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*Request::GetClassData() const { return &_class_data_; }
+
+
+void Request::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<Request*>(&to_msg);
+  auto& from = static_cast<const Request&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:dsnet.Request)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.ops_.MergeFrom(from._impl_.ops_);
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000001fu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_op(from._internal_op());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_internal_set_clientaddr(from._internal_clientaddr());
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.clientid_ = from._impl_.clientid_;
+    }
+    if (cached_has_bits & 0x00000008u) {
+      _this->_impl_.clientreqid_ = from._impl_.clientreqid_;
+    }
+    if (cached_has_bits & 0x00000010u) {
+      _this->_impl_.sessnum_ = from._impl_.sessnum_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void Request::CopyFrom(const Request& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:dsnet.Request)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool Request::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  if (!::PROTOBUF_NAMESPACE_ID::internal::AllAreInitialized(_impl_.ops_))
+    return false;
+  return true;
+}
+
+void Request::InternalSwap(Request* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  _impl_.ops_.InternalSwap(&other->_impl_.ops_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.op_, lhs_arena,
+      &other->_impl_.op_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.clientaddr_, lhs_arena,
+      &other->_impl_.clientaddr_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(Request, _impl_.sessnum_)
+      + sizeof(Request::_impl_.sessnum_)
+      - PROTOBUF_FIELD_OFFSET(Request, _impl_.clientid_)>(
+          reinterpret_cast<char*>(&_impl_.clientid_),
+          reinterpret_cast<char*>(&other->_impl_.clientid_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata Request::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_common_2frequest_2eproto_getter, &descriptor_table_common_2frequest_2eproto_once,
+      file_level_metadata_common_2frequest_2eproto[1]);
+}
+
+// ===================================================================
+
+class UnloggedRequest::_Internal {
+ public:
+  using HasBits = decltype(std::declval<UnloggedRequest>()._impl_._has_bits_);
+  static void set_has_op(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_clientid(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_clientreqid(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000007) ^ 0x00000007) != 0;
+  }
+};
+
+UnloggedRequest::UnloggedRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:dsnet.UnloggedRequest)
+}
+UnloggedRequest::UnloggedRequest(const UnloggedRequest& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  UnloggedRequest* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.op_){}
+    , decltype(_impl_.clientid_){}
+    , decltype(_impl_.clientreqid_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.op_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.op_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_op()) {
+    _this->_impl_.op_.Set(from._internal_op(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.clientid_, &from._impl_.clientid_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.clientreqid_) -
+    reinterpret_cast<char*>(&_impl_.clientid_)) + sizeof(_impl_.clientreqid_));
+  // @@protoc_insertion_point(copy_constructor:dsnet.UnloggedRequest)
+}
+
+inline void UnloggedRequest::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.op_){}
+    , decltype(_impl_.clientid_){uint64_t{0u}}
+    , decltype(_impl_.clientreqid_){uint64_t{0u}}
+  };
+  _impl_.op_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.op_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+UnloggedRequest::~UnloggedRequest() {
+  // @@protoc_insertion_point(destructor:dsnet.UnloggedRequest)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void UnloggedRequest::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.op_.Destroy();
+}
+
+void UnloggedRequest::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void UnloggedRequest::Clear() {
+// @@protoc_insertion_point(message_clear_start:dsnet.UnloggedRequest)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    _impl_.op_.ClearNonDefaultToEmpty();
+  }
+  if (cached_has_bits & 0x00000006u) {
+    ::memset(&_impl_.clientid_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.clientreqid_) -
+        reinterpret_cast<char*>(&_impl_.clientid_)) + sizeof(_impl_.clientreqid_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* UnloggedRequest::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required bytes op = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_op();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required uint64 clientid = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _Internal::set_has_clientid(&has_bits);
+          _impl_.clientid_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required uint64 clientreqid = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _Internal::set_has_clientreqid(&has_bits);
+          _impl_.clientreqid_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* UnloggedRequest::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:dsnet.UnloggedRequest)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required bytes op = 1;
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->WriteBytesMaybeAliased(
+        1, this->_internal_op(), target);
+  }
+
+  // required uint64 clientid = 2;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(2, this->_internal_clientid(), target);
+  }
+
+  // required uint64 clientreqid = 3;
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(3, this->_internal_clientreqid(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:dsnet.UnloggedRequest)
+  return target;
+}
+
+size_t UnloggedRequest::RequiredFieldsByteSizeFallback() const {
+// @@protoc_insertion_point(required_fields_byte_size_fallback_start:dsnet.UnloggedRequest)
+  size_t total_size = 0;
+
+  if (_internal_has_op()) {
+    // required bytes op = 1;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_op());
+  }
+
+  if (_internal_has_clientid()) {
+    // required uint64 clientid = 2;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_clientid());
+  }
+
+  if (_internal_has_clientreqid()) {
+    // required uint64 clientreqid = 3;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_clientreqid());
+  }
+
+  return total_size;
+}
+size_t UnloggedRequest::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:dsnet.UnloggedRequest)
+  size_t total_size = 0;
+
+  if (((_impl_._has_bits_[0] & 0x00000007) ^ 0x00000007) == 0) {  // All required fields are present.
+    // required bytes op = 1;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_op());
+
+    // required uint64 clientid = 2;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_clientid());
+
+    // required uint64 clientreqid = 3;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_clientreqid());
+
+  } else {
+    total_size += RequiredFieldsByteSizeFallback();
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData UnloggedRequest::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    UnloggedRequest::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*UnloggedRequest::GetClassData() const { return &_class_data_; }
+
+
+void UnloggedRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<UnloggedRequest*>(&to_msg);
+  auto& from = static_cast<const UnloggedRequest&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:dsnet.UnloggedRequest)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_op(from._internal_op());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.clientid_ = from._impl_.clientid_;
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.clientreqid_ = from._impl_.clientreqid_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void UnloggedRequest::CopyFrom(const UnloggedRequest& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:dsnet.UnloggedRequest)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool UnloggedRequest::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  return true;
+}
+
+void UnloggedRequest::InternalSwap(UnloggedRequest* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.op_, lhs_arena,
+      &other->_impl_.op_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(UnloggedRequest, _impl_.clientreqid_)
+      + sizeof(UnloggedRequest::_impl_.clientreqid_)
+      - PROTOBUF_FIELD_OFFSET(UnloggedRequest, _impl_.clientid_)>(
+          reinterpret_cast<char*>(&_impl_.clientid_),
+          reinterpret_cast<char*>(&other->_impl_.clientid_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata UnloggedRequest::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_common_2frequest_2eproto_getter, &descriptor_table_common_2frequest_2eproto_once,
+      file_level_metadata_common_2frequest_2eproto[2]);
+}
+
+// ===================================================================
+
+class MsgLogEntry::_Internal {
+ public:
+  using HasBits = decltype(std::declval<MsgLogEntry>()._impl_._has_bits_);
+  static void set_has_view(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static void set_has_opnum(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+  static void set_has_sessnum(HasBits* has_bits) {
+    (*has_bits)[0] |= 16u;
+  }
+  static void set_has_msgnum(HasBits* has_bits) {
+    (*has_bits)[0] |= 32u;
+  }
+  static void set_has_shardnum(HasBits* has_bits) {
+    (*has_bits)[0] |= 64u;
+  }
+  static const ::dsnet::Request& request(const MsgLogEntry* msg);
+  static void set_has_request(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_state(HasBits* has_bits) {
+    (*has_bits)[0] |= 128u;
+  }
+  static void set_has_hash(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x000000ff) ^ 0x000000ff) != 0;
+  }
+};
+
+const ::dsnet::Request&
+MsgLogEntry::_Internal::request(const MsgLogEntry* msg) {
+  return *msg->_impl_.request_;
+}
+MsgLogEntry::MsgLogEntry(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:dsnet.MsgLogEntry)
+}
+MsgLogEntry::MsgLogEntry(const MsgLogEntry& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  MsgLogEntry* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.hash_){}
+    , decltype(_impl_.request_){nullptr}
+    , decltype(_impl_.view_){}
+    , decltype(_impl_.opnum_){}
+    , decltype(_impl_.sessnum_){}
+    , decltype(_impl_.msgnum_){}
+    , decltype(_impl_.shardnum_){}
+    , decltype(_impl_.state_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.hash_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.hash_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_hash()) {
+    _this->_impl_.hash_.Set(from._internal_hash(), 
+      _this->GetArenaForAllocation());
+  }
+  if (from._internal_has_request()) {
+    _this->_impl_.request_ = new ::dsnet::Request(*from._impl_.request_);
+  }
+  ::memcpy(&_impl_.view_, &from._impl_.view_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.state_) -
+    reinterpret_cast<char*>(&_impl_.view_)) + sizeof(_impl_.state_));
+  // @@protoc_insertion_point(copy_constructor:dsnet.MsgLogEntry)
+}
+
+inline void MsgLogEntry::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.hash_){}
+    , decltype(_impl_.request_){nullptr}
+    , decltype(_impl_.view_){uint64_t{0u}}
+    , decltype(_impl_.opnum_){uint64_t{0u}}
+    , decltype(_impl_.sessnum_){uint64_t{0u}}
+    , decltype(_impl_.msgnum_){uint64_t{0u}}
+    , decltype(_impl_.shardnum_){0u}
+    , decltype(_impl_.state_){0u}
+  };
+  _impl_.hash_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.hash_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+MsgLogEntry::~MsgLogEntry() {
+  // @@protoc_insertion_point(destructor:dsnet.MsgLogEntry)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void MsgLogEntry::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.hash_.Destroy();
+  if (this != internal_default_instance()) delete _impl_.request_;
+}
+
+void MsgLogEntry::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void MsgLogEntry::Clear() {
+// @@protoc_insertion_point(message_clear_start:dsnet.MsgLogEntry)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      _impl_.hash_.ClearNonDefaultToEmpty();
+    }
+    if (cached_has_bits & 0x00000002u) {
+      GOOGLE_DCHECK(_impl_.request_ != nullptr);
+      _impl_.request_->Clear();
+    }
+  }
+  if (cached_has_bits & 0x000000fcu) {
+    ::memset(&_impl_.view_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.state_) -
+        reinterpret_cast<char*>(&_impl_.view_)) + sizeof(_impl_.state_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* MsgLogEntry::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required uint64 view = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_view(&has_bits);
+          _impl_.view_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required uint64 opnum = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _Internal::set_has_opnum(&has_bits);
+          _impl_.opnum_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required uint64 sessnum = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _Internal::set_has_sessnum(&has_bits);
+          _impl_.sessnum_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required uint64 msgnum = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _Internal::set_has_msgnum(&has_bits);
+          _impl_.msgnum_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required uint32 shardnum = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          _Internal::set_has_shardnum(&has_bits);
+          _impl_.shardnum_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required .dsnet.Request request = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 50)) {
+          ptr = ctx->ParseMessage(_internal_mutable_request(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required uint32 state = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 56)) {
+          _Internal::set_has_state(&has_bits);
+          _impl_.state_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required bytes hash = 8;
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 66)) {
+          auto str = _internal_mutable_hash();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* MsgLogEntry::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:dsnet.MsgLogEntry)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required uint64 view = 1;
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(1, this->_internal_view(), target);
+  }
+
+  // required uint64 opnum = 2;
+  if (cached_has_bits & 0x00000008u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(2, this->_internal_opnum(), target);
+  }
+
+  // required uint64 sessnum = 3;
+  if (cached_has_bits & 0x00000010u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(3, this->_internal_sessnum(), target);
+  }
+
+  // required uint64 msgnum = 4;
+  if (cached_has_bits & 0x00000020u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(4, this->_internal_msgnum(), target);
+  }
+
+  // required uint32 shardnum = 5;
+  if (cached_has_bits & 0x00000040u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(5, this->_internal_shardnum(), target);
+  }
+
+  // required .dsnet.Request request = 6;
+  if (cached_has_bits & 0x00000002u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(6, _Internal::request(this),
+        _Internal::request(this).GetCachedSize(), target, stream);
+  }
+
+  // required uint32 state = 7;
+  if (cached_has_bits & 0x00000080u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(7, this->_internal_state(), target);
+  }
+
+  // required bytes hash = 8;
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->WriteBytesMaybeAliased(
+        8, this->_internal_hash(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:dsnet.MsgLogEntry)
+  return target;
+}
+
+size_t MsgLogEntry::RequiredFieldsByteSizeFallback() const {
+// @@protoc_insertion_point(required_fields_byte_size_fallback_start:dsnet.MsgLogEntry)
+  size_t total_size = 0;
+
+  if (_internal_has_hash()) {
+    // required bytes hash = 8;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_hash());
+  }
+
+  if (_internal_has_request()) {
+    // required .dsnet.Request request = 6;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.request_);
+  }
+
+  if (_internal_has_view()) {
+    // required uint64 view = 1;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_view());
+  }
+
+  if (_internal_has_opnum()) {
+    // required uint64 opnum = 2;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_opnum());
+  }
+
+  if (_internal_has_sessnum()) {
+    // required uint64 sessnum = 3;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_sessnum());
+  }
+
+  if (_internal_has_msgnum()) {
+    // required uint64 msgnum = 4;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_msgnum());
+  }
+
+  if (_internal_has_shardnum()) {
+    // required uint32 shardnum = 5;
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_shardnum());
+  }
+
+  if (_internal_has_state()) {
+    // required uint32 state = 7;
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_state());
+  }
+
+  return total_size;
+}
+size_t MsgLogEntry::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:dsnet.MsgLogEntry)
+  size_t total_size = 0;
+
+  if (((_impl_._has_bits_[0] & 0x000000ff) ^ 0x000000ff) == 0) {  // All required fields are present.
+    // required bytes hash = 8;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_hash());
+
+    // required .dsnet.Request request = 6;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.request_);
+
+    // required uint64 view = 1;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_view());
+
+    // required uint64 opnum = 2;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_opnum());
+
+    // required uint64 sessnum = 3;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_sessnum());
+
+    // required uint64 msgnum = 4;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_msgnum());
+
+    // required uint32 shardnum = 5;
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_shardnum());
+
+    // required uint32 state = 7;
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_state());
+
+  } else {
+    total_size += RequiredFieldsByteSizeFallback();
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData MsgLogEntry::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    MsgLogEntry::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*MsgLogEntry::GetClassData() const { return &_class_data_; }
+
+
+void MsgLogEntry::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<MsgLogEntry*>(&to_msg);
+  auto& from = static_cast<const MsgLogEntry&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:dsnet.MsgLogEntry)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x000000ffu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_hash(from._internal_hash());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_internal_mutable_request()->::dsnet::Request::MergeFrom(
+          from._internal_request());
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.view_ = from._impl_.view_;
+    }
+    if (cached_has_bits & 0x00000008u) {
+      _this->_impl_.opnum_ = from._impl_.opnum_;
+    }
+    if (cached_has_bits & 0x00000010u) {
+      _this->_impl_.sessnum_ = from._impl_.sessnum_;
+    }
+    if (cached_has_bits & 0x00000020u) {
+      _this->_impl_.msgnum_ = from._impl_.msgnum_;
+    }
+    if (cached_has_bits & 0x00000040u) {
+      _this->_impl_.shardnum_ = from._impl_.shardnum_;
+    }
+    if (cached_has_bits & 0x00000080u) {
+      _this->_impl_.state_ = from._impl_.state_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void MsgLogEntry::CopyFrom(const MsgLogEntry& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:dsnet.MsgLogEntry)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool MsgLogEntry::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  if (_internal_has_request()) {
+    if (!_impl_.request_->IsInitialized()) return false;
+  }
+  return true;
+}
+
+void MsgLogEntry::InternalSwap(MsgLogEntry* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.hash_, lhs_arena,
+      &other->_impl_.hash_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(MsgLogEntry, _impl_.state_)
+      + sizeof(MsgLogEntry::_impl_.state_)
+      - PROTOBUF_FIELD_OFFSET(MsgLogEntry, _impl_.request_)>(
+          reinterpret_cast<char*>(&_impl_.request_),
+          reinterpret_cast<char*>(&other->_impl_.request_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata MsgLogEntry::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_common_2frequest_2eproto_getter, &descriptor_table_common_2frequest_2eproto_once,
+      file_level_metadata_common_2frequest_2eproto[3]);
+}
+
+// @@protoc_insertion_point(namespace_scope)
+}  // namespace dsnet
+PROTOBUF_NAMESPACE_OPEN
+template<> PROTOBUF_NOINLINE ::dsnet::ShardOp*
+Arena::CreateMaybeMessage< ::dsnet::ShardOp >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::dsnet::ShardOp >(arena);
+}
+template<> PROTOBUF_NOINLINE ::dsnet::Request*
+Arena::CreateMaybeMessage< ::dsnet::Request >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::dsnet::Request >(arena);
+}
+template<> PROTOBUF_NOINLINE ::dsnet::UnloggedRequest*
+Arena::CreateMaybeMessage< ::dsnet::UnloggedRequest >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::dsnet::UnloggedRequest >(arena);
+}
+template<> PROTOBUF_NOINLINE ::dsnet::MsgLogEntry*
+Arena::CreateMaybeMessage< ::dsnet::MsgLogEntry >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::dsnet::MsgLogEntry >(arena);
+}
+PROTOBUF_NAMESPACE_CLOSE
+
+// @@protoc_insertion_point(global_scope)
+#include <google/protobuf/port_undef.inc>
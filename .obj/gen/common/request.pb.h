@@ -0,0 +1,1870 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: common/request.proto
+
+#ifndef GOOGLE_PROTOBUF_INCLUDED_common_2frequest_2eproto
+#define GOOGLE_PROTOBUF_INCLUDED_common_2frequest_2eproto
+
+#include <limits>
+#include <string>
+
+#include <google/protobuf/port_def.inc>
+#if PROTOBUF_VERSION < 3021000
+#error This file was generated by a newer version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please update
+#error your headers.
+#endif
+#if 3021012 < PROTOBUF_MIN_PROTOC_VERSION
+#error This file was generated by an older version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please
+#error regenerate this file with a newer version of protoc.
+#endif
+
+#include <google/protobuf/port_undef.inc>
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/arena.h>
+#include <google/protobuf/arenastring.h>
+#include <google/protobuf/generated_message_util.h>
+#include <google/protobuf/metadata_lite.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/message.h>
+#include <google/protobuf/repeated_field.h>  // IWYU pragma: export
+#include <google/protobuf/extension_set.h>  // IWYU pragma: export
+#include <google/protobuf/unknown_field_set.h>
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+#define PROTOBUF_INTERNAL_EXPORT_common_2frequest_2eproto
+PROTOBUF_NAMESPACE_OPEN
+namespace internal {
+class AnyMetadata;
+}  // namespace internal
+PROTOBUF_NAMESPACE_CLOSE
+
+// Internal implementation detail -- do not use these members.
+struct TableStruct_common_2frequest_2eproto {
+  static const uint32_t offsets[];
+};
+extern const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_common_2frequest_2eproto;
+namespace dsnet {
+class MsgLogEntry;
+struct MsgLogEntryDefaultTypeInternal;
+extern MsgLogEntryDefaultTypeInternal _MsgLogEntry_default_instance_;
+class Request;
+struct RequestDefaultTypeInternal;
+extern RequestDefaultTypeInternal _Request_default_instance_;
+class ShardOp;
+struct ShardOpDefaultTypeInternal;
+extern ShardOpDefaultTypeInternal _ShardOp_default_instance_;
+class UnloggedRequest;
+struct UnloggedRequestDefaultTypeInternal;
+extern UnloggedRequestDefaultTypeInternal _UnloggedRequest_default_instance_;
+}  // namespace dsnet
+PROTOBUF_NAMESPACE_OPEN
+template<> ::dsnet::MsgLogEntry* Arena::CreateMaybeMessage<::dsnet::MsgLogEntry>(Arena*);
+template<> ::dsnet::Request* Arena::CreateMaybeMessage<::dsnet::Request>(Arena*);
+template<> ::dsnet::ShardOp* Arena::CreateMaybeMessage<::dsnet::ShardOp>(Arena*);
+template<> ::dsnet::UnloggedRequest* Arena::CreateMaybeMessage<::dsnet::UnloggedRequest>(Arena*);
+PROTOBUF_NAMESPACE_CLOSE
+namespace dsnet {
+
+// ===================================================================
+
+class ShardOp final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:dsnet.ShardOp) */ {
+ public:
+  inline ShardOp() : ShardOp(nullptr) {}
+  ~ShardOp() override;
+  explicit PROTOBUF_CONSTEXPR ShardOp(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  ShardOp(const ShardOp& from);
+  ShardOp(ShardOp&& from) noexcept
+    : ShardOp() {
+    *this = ::std::move(from);
+  }
+
+  inline ShardOp& operator=(const ShardOp& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline ShardOp& operator=(ShardOp&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ShardOp& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const ShardOp* internal_default_instance() {
+    return reinterpret_cast<const ShardOp*>(
+               &_ShardOp_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    0;
+
+  friend void swap(ShardOp& a, ShardOp& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(ShardOp* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ShardOp* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  ShardOp* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ShardOp>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const ShardOp& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ShardOp& from) {
+    ShardOp::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(ShardOp* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "dsnet.ShardOp";
+  }
+  protected:
+  explicit ShardOp(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kOpFieldNumber = 2,
+    kMsgnumFieldNumber = 3,
+    kShardFieldNumber = 1,
+  };
+  // required bytes op = 2;
+  bool has_op() const;
+  private:
+  bool _internal_has_op() const;
+  public:
+  void clear_op();
+  const std::string& op() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_op(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_op();
+  PROTOBUF_NODISCARD std::string* release_op();
+  void set_allocated_op(std::string* op);
+  private:
+  const std::string& _internal_op() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_op(const std::string& value);
+  std::string* _internal_mutable_op();
+  public:
+
+  // optional uint64 msgnum = 3;
+  bool has_msgnum() const;
+  private:
+  bool _internal_has_msgnum() const;
+  public:
+  void clear_msgnum();
+  uint64_t msgnum() const;
+  void set_msgnum(uint64_t value);
+  private:
+  uint64_t _internal_msgnum() const;
+  void _internal_set_msgnum(uint64_t value);
+  public:
+
+  // required uint32 shard = 1;
+  bool has_shard() const;
+  private:
+  bool _internal_has_shard() const;
+  public:
+  void clear_shard();
+  uint32_t shard() const;
+  void set_shard(uint32_t value);
+  private:
+  uint32_t _internal_shard() const;
+  void _internal_set_shard(uint32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:dsnet.ShardOp)
+ private:
+  class _Internal;
+
+  // helper for ByteSizeLong()
+  size_t RequiredFieldsByteSizeFallback() const;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr op_;
+    uint64_t msgnum_;
+    uint32_t shard_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_common_2frequest_2eproto;
+};
+// -------------------------------------------------------------------
+
+class Request final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:dsnet.Request) */ {
+ public:
+  inline Request() : Request(nullptr) {}
+  ~Request() override;
+  explicit PROTOBUF_CONSTEXPR Request(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  Request(const Request& from);
+  Request(Request&& from) noexcept
+    : Request() {
+    *this = ::std::move(from);
+  }
+
+  inline Request& operator=(const Request& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline Request& operator=(Request&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const Request& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const Request* internal_default_instance() {
+    return reinterpret_cast<const Request*>(
+               &_Request_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    1;
+
+  friend void swap(Request& a, Request& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(Request* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Request* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  Request* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<Request>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const Request& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const Request& from) {
+    Request::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(Request* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "dsnet.Request";
+  }
+  protected:
+  explicit Request(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kOpsFieldNumber = 4,
+    kOpFieldNumber = 1,
+    kClientaddrFieldNumber = 6,
+    kClientidFieldNumber = 2,
+    kClientreqidFieldNumber = 3,
+    kSessnumFieldNumber = 5,
+  };
+  // repeated .dsnet.ShardOp ops = 4;
+  int ops_size() const;
+  private:
+  int _internal_ops_size() const;
+  public:
+  void clear_ops();
+  ::dsnet::ShardOp* mutable_ops(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::dsnet::ShardOp >*
+      mutable_ops();
+  private:
+  const ::dsnet::ShardOp& _internal_ops(int index) const;
+  ::dsnet::ShardOp* _internal_add_ops();
+  public:
+  const ::dsnet::ShardOp& ops(int index) const;
+  ::dsnet::ShardOp* add_ops();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::dsnet::ShardOp >&
+      ops() const;
+
+  // required bytes op = 1;
+  bool has_op() const;
+  private:
+  bool _internal_has_op() const;
+  public:
+  void clear_op();
+  const std::string& op() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_op(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_op();
+  PROTOBUF_NODISCARD std::string* release_op();
+  void set_allocated_op(std::string* op);
+  private:
+  const std::string& _internal_op() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_op(const std::string& value);
+  std::string* _internal_mutable_op();
+  public:
+
+  // optional bytes clientaddr = 6;
+  bool has_clientaddr() const;
+  private:
+  bool _internal_has_clientaddr() const;
+  public:
+  void clear_clientaddr();
+  const std::string& clientaddr() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_clientaddr(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_clientaddr();
+  PROTOBUF_NODISCARD std::string* release_clientaddr();
+  void set_allocated_clientaddr(std::string* clientaddr);
+  private:
+  const std::string& _internal_clientaddr() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_clientaddr(const std::string& value);
+  std::string* _internal_mutable_clientaddr();
+  public:
+
+  // required uint64 clientid = 2;
+  bool has_clientid() const;
+  private:
+  bool _internal_has_clientid() const;
+  public:
+  void clear_clientid();
+  uint64_t clientid() const;
+  void set_clientid(uint64_t value);
+  private:
+  uint64_t _internal_clientid() const;
+  void _internal_set_clientid(uint64_t value);
+  public:
+
+  // required uint64 clientreqid = 3;
+  bool has_clientreqid() const;
+  private:
+  bool _internal_has_clientreqid() const;
+  public:
+  void clear_clientreqid();
+  uint64_t clientreqid() const;
+  void set_clientreqid(uint64_t value);
+  private:
+  uint64_t _internal_clientreqid() const;
+  void _internal_set_clientreqid(uint64_t value);
+  public:
+
+  // optional uint64 sessnum = 5;
+  bool has_sessnum() const;
+  private:
+  bool _internal_has_sessnum() const;
+  public:
+  void clear_sessnum();
+  uint64_t sessnum() const;
+  void set_sessnum(uint64_t value);
+  private:
+  uint64_t _internal_sessnum() const;
+  void _internal_set_sessnum(uint64_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:dsnet.Request)
+ private:
+  class _Internal;
+
+  // helper for ByteSizeLong()
+  size_t RequiredFieldsByteSizeFallback() const;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::dsnet::ShardOp > ops_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr op_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr clientaddr_;
+    uint64_t clientid_;
+    uint64_t clientreqid_;
+    uint64_t sessnum_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_common_2frequest_2eproto;
+};
+// -------------------------------------------------------------------
+
+class UnloggedRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:dsnet.UnloggedRequest) */ {
+ public:
+  inline UnloggedRequest() : UnloggedRequest(nullptr) {}
+  ~UnloggedRequest() override;
+  explicit PROTOBUF_CONSTEXPR UnloggedRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  UnloggedRequest(const UnloggedRequest& from);
+  UnloggedRequest(UnloggedRequest&& from) noexcept
+    : UnloggedRequest() {
+    *this = ::std::move(from);
+  }
+
+  inline UnloggedRequest& operator=(const UnloggedRequest& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline UnloggedRequest& operator=(UnloggedRequest&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const UnloggedRequest& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const UnloggedRequest* internal_default_instance() {
+    return reinterpret_cast<const UnloggedRequest*>(
+               &_UnloggedRequest_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    2;
+
+  friend void swap(UnloggedRequest& a, UnloggedRequest& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(UnloggedRequest* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(UnloggedRequest* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  UnloggedRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<UnloggedRequest>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const UnloggedRequest& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const UnloggedRequest& from) {
+    UnloggedRequest::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(UnloggedRequest* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "dsnet.UnloggedRequest";
+  }
+  protected:
+  explicit UnloggedRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kOpFieldNumber = 1,
+    kClientidFieldNumber = 2,
+    kClientreqidFieldNumber = 3,
+  };
+  // required bytes op = 1;
+  bool has_op() const;
+  private:
+  bool _internal_has_op() const;
+  public:
+  void clear_op();
+  const std::string& op() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_op(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_op();
+  PROTOBUF_NODISCARD std::string* release_op();
+  void set_allocated_op(std::string* op);
+  private:
+  const std::string& _internal_op() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_op(const std::string& value);
+  std::string* _internal_mutable_op();
+  public:
+
+  // required uint64 clientid = 2;
+  bool has_clientid() const;
+  private:
+  bool _internal_has_clientid() const;
+  public:
+  void clear_clientid();
+  uint64_t clientid() const;
+  void set_clientid(uint64_t value);
+  private:
+  uint64_t _internal_clientid() const;
+  void _internal_set_clientid(uint64_t value);
+  public:
+
+  // required uint64 clientreqid = 3;
+  bool has_clientreqid() const;
+  private:
+  bool _internal_has_clientreqid() const;
+  public:
+  void clear_clientreqid();
+  uint64_t clientreqid() const;
+  void set_clientreqid(uint64_t value);
+  private:
+  uint64_t _internal_clientreqid() const;
+  void _internal_set_clientreqid(uint64_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:dsnet.UnloggedRequest)
+ private:
+  class _Internal;
+
+  // helper for ByteSizeLong()
+  size_t RequiredFieldsByteSizeFallback() const;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr op_;
+    uint64_t clientid_;
+    uint64_t clientreqid_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_common_2frequest_2eproto;
+};
+// -------------------------------------------------------------------
+
+class MsgLogEntry final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:dsnet.MsgLogEntry) */ {
+ public:
+  inline MsgLogEntry() : MsgLogEntry(nullptr) {}
+  ~MsgLogEntry() override;
+  explicit PROTOBUF_CONSTEXPR MsgLogEntry(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  MsgLogEntry(const MsgLogEntry& from);
+  MsgLogEntry(MsgLogEntry&& from) noexcept
+    : MsgLogEntry() {
+    *this = ::std::move(from);
+  }
+
+  inline MsgLogEntry& operator=(const MsgLogEntry& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline MsgLogEntry& operator=(MsgLogEntry&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const MsgLogEntry& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const MsgLogEntry* internal_default_instance() {
+    return reinterpret_cast<const MsgLogEntry*>(
+               &_MsgLogEntry_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    3;
+
+  friend void swap(MsgLogEntry& a, MsgLogEntry& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(MsgLogEntry* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(MsgLogEntry* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  MsgLogEntry* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<MsgLogEntry>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const MsgLogEntry& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const MsgLogEntry& from) {
+    MsgLogEntry::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(MsgLogEntry* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "dsnet.MsgLogEntry";
+  }
+  protected:
+  explicit MsgLogEntry(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kHashFieldNumber = 8,
+    kRequestFieldNumber = 6,
+    kViewFieldNumber = 1,
+    kOpnumFieldNumber = 2,
+    kSessnumFieldNumber = 3,
+    kMsgnumFieldNumber = 4,
+    kShardnumFieldNumber = 5,
+    kStateFieldNumber = 7,
+  };
+  // required bytes hash = 8;
+  bool has_hash() const;
+  private:
+  bool _internal_has_hash() const;
+  public:
+  void clear_hash();
+  const std::string& hash() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_hash(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_hash();
+  PROTOBUF_NODISCARD std::string* release_hash();
+  void set_allocated_hash(std::string* hash);
+  private:
+  const std::string& _internal_hash() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_hash(const std::string& value);
+  std::string* _internal_mutable_hash();
+  public:
+
+  // required .dsnet.Request request = 6;
+  bool has_request() const;
+  private:
+  bool _internal_has_request() const;
+  public:
+  void clear_request();
+  const ::dsnet::Request& request() const;
+  PROTOBUF_NODISCARD ::dsnet::Request* release_request();
+  ::dsnet::Request* mutable_request();
+  void set_allocated_request(::dsnet::Request* request);
+  private:
+  const ::dsnet::Request& _internal_request() const;
+  ::dsnet::Request* _internal_mutable_request();
+  public:
+  void unsafe_arena_set_allocated_request(
+      ::dsnet::Request* request);
+  ::dsnet::Request* unsafe_arena_release_request();
+
+  // required uint64 view = 1;
+  bool has_view() const;
+  private:
+  bool _internal_has_view() const;
+  public:
+  void clear_view();
+  uint64_t view() const;
+  void set_view(uint64_t value);
+  private:
+  uint64_t _internal_view() const;
+  void _internal_set_view(uint64_t value);
+  public:
+
+  // required uint64 opnum = 2;
+  bool has_opnum() const;
+  private:
+  bool _internal_has_opnum() const;
+  public:
+  void clear_opnum();
+  uint64_t opnum() const;
+  void set_opnum(uint64_t value);
+  private:
+  uint64_t _internal_opnum() const;
+  void _internal_set_opnum(uint64_t value);
+  public:
+
+  // required uint64 sessnum = 3;
+  bool has_sessnum() const;
+  private:
+  bool _internal_has_sessnum() const;
+  public:
+  void clear_sessnum();
+  uint64_t sessnum() const;
+  void set_sessnum(uint64_t value);
+  private:
+  uint64_t _internal_sessnum() const;
+  void _internal_set_sessnum(uint64_t value);
+  public:
+
+  // required uint64 msgnum = 4;
+  bool has_msgnum() const;
+  private:
+  bool _internal_has_msgnum() const;
+  public:
+  void clear_msgnum();
+  uint64_t msgnum() const;
+  void set_msgnum(uint64_t value);
+  private:
+  uint64_t _internal_msgnum() const;
+  void _internal_set_msgnum(uint64_t value);
+  public:
+
+  // required uint32 shardnum = 5;
+  bool has_shardnum() const;
+  private:
+  bool _internal_has_shardnum() const;
+  public:
+  void clear_shardnum();
+  uint32_t shardnum() const;
+  void set_shardnum(uint32_t value);
+  private:
+  uint32_t _internal_shardnum() const;
+  void _internal_set_shardnum(uint32_t value);
+  public:
+
+  // required uint32 state = 7;
+  bool has_state() const;
+  private:
+  bool _internal_has_state() const;
+  public:
+  void clear_state();
+  uint32_t state() const;
+  void set_state(uint32_t value);
+  private:
+  uint32_t _internal_state() const;
+  void _internal_set_state(uint32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:dsnet.MsgLogEntry)
+ private:
+  class _Internal;
+
+  // helper for ByteSizeLong()
+  size_t RequiredFieldsByteSizeFallback() const;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr hash_;
+    ::dsnet::Request* request_;
+    uint64_t view_;
+    uint64_t opnum_;
+    uint64_t sessnum_;
+    uint64_t msgnum_;
+    uint32_t shardnum_;
+    uint32_t state_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_common_2frequest_2eproto;
+};
+// ===================================================================
+
+
+// ===================================================================
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
+#endif  // __GNUC__
+// ShardOp
+
+// required uint32 shard = 1;
+inline bool ShardOp::_internal_has_shard() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool ShardOp::has_shard() const {
+  return _internal_has_shard();
+}
+inline void ShardOp::clear_shard() {
+  _impl_.shard_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline uint32_t ShardOp::_internal_shard() const {
+  return _impl_.shard_;
+}
+inline uint32_t ShardOp::shard() const {
+  // @@protoc_insertion_point(field_get:dsnet.ShardOp.shard)
+  return _internal_shard();
+}
+inline void ShardOp::_internal_set_shard(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.shard_ = value;
+}
+inline void ShardOp::set_shard(uint32_t value) {
+  _internal_set_shard(value);
+  // @@protoc_insertion_point(field_set:dsnet.ShardOp.shard)
+}
+
+// required bytes op = 2;
+inline bool ShardOp::_internal_has_op() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool ShardOp::has_op() const {
+  return _internal_has_op();
+}
+inline void ShardOp::clear_op() {
+  _impl_.op_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& ShardOp::op() const {
+  // @@protoc_insertion_point(field_get:dsnet.ShardOp.op)
+  return _internal_op();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void ShardOp::set_op(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.op_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:dsnet.ShardOp.op)
+}
+inline std::string* ShardOp::mutable_op() {
+  std::string* _s = _internal_mutable_op();
+  // @@protoc_insertion_point(field_mutable:dsnet.ShardOp.op)
+  return _s;
+}
+inline const std::string& ShardOp::_internal_op() const {
+  return _impl_.op_.Get();
+}
+inline void ShardOp::_internal_set_op(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.op_.Set(value, GetArenaForAllocation());
+}
+inline std::string* ShardOp::_internal_mutable_op() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.op_.Mutable(GetArenaForAllocation());
+}
+inline std::string* ShardOp::release_op() {
+  // @@protoc_insertion_point(field_release:dsnet.ShardOp.op)
+  if (!_internal_has_op()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.op_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.op_.IsDefault()) {
+    _impl_.op_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void ShardOp::set_allocated_op(std::string* op) {
+  if (op != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.op_.SetAllocated(op, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.op_.IsDefault()) {
+    _impl_.op_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:dsnet.ShardOp.op)
+}
+
+// optional uint64 msgnum = 3;
+inline bool ShardOp::_internal_has_msgnum() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool ShardOp::has_msgnum() const {
+  return _internal_has_msgnum();
+}
+inline void ShardOp::clear_msgnum() {
+  _impl_.msgnum_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline uint64_t ShardOp::_internal_msgnum() const {
+  return _impl_.msgnum_;
+}
+inline uint64_t ShardOp::msgnum() const {
+  // @@protoc_insertion_point(field_get:dsnet.ShardOp.msgnum)
+  return _internal_msgnum();
+}
+inline void ShardOp::_internal_set_msgnum(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.msgnum_ = value;
+}
+inline void ShardOp::set_msgnum(uint64_t value) {
+  _internal_set_msgnum(value);
+  // @@protoc_insertion_point(field_set:dsnet.ShardOp.msgnum)
+}
+
+// -------------------------------------------------------------------
+
+// Request
+
+// required bytes op = 1;
+inline bool Request::_internal_has_op() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool Request::has_op() const {
+  return _internal_has_op();
+}
+inline void Request::clear_op() {
+  _impl_.op_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& Request::op() const {
+  // @@protoc_insertion_point(field_get:dsnet.Request.op)
+  return _internal_op();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void Request::set_op(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.op_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:dsnet.Request.op)
+}
+inline std::string* Request::mutable_op() {
+  std::string* _s = _internal_mutable_op();
+  // @@protoc_insertion_point(field_mutable:dsnet.Request.op)
+  return _s;
+}
+inline const std::string& Request::_internal_op() const {
+  return _impl_.op_.Get();
+}
+inline void Request::_internal_set_op(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.op_.Set(value, GetArenaForAllocation());
+}
+inline std::string* Request::_internal_mutable_op() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.op_.Mutable(GetArenaForAllocation());
+}
+inline std::string* Request::release_op() {
+  // @@protoc_insertion_point(field_release:dsnet.Request.op)
+  if (!_internal_has_op()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.op_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.op_.IsDefault()) {
+    _impl_.op_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void Request::set_allocated_op(std::string* op) {
+  if (op != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.op_.SetAllocated(op, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.op_.IsDefault()) {
+    _impl_.op_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:dsnet.Request.op)
+}
+
+// required uint64 clientid = 2;
+inline bool Request::_internal_has_clientid() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool Request::has_clientid() const {
+  return _internal_has_clientid();
+}
+inline void Request::clear_clientid() {
+  _impl_.clientid_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline uint64_t Request::_internal_clientid() const {
+  return _impl_.clientid_;
+}
+inline uint64_t Request::clientid() const {
+  // @@protoc_insertion_point(field_get:dsnet.Request.clientid)
+  return _internal_clientid();
+}
+inline void Request::_internal_set_clientid(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.clientid_ = value;
+}
+inline void Request::set_clientid(uint64_t value) {
+  _internal_set_clientid(value);
+  // @@protoc_insertion_point(field_set:dsnet.Request.clientid)
+}
+
+// required uint64 clientreqid = 3;
+inline bool Request::_internal_has_clientreqid() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  return value;
+}
+inline bool Request::has_clientreqid() const {
+  return _internal_has_clientreqid();
+}
+inline void Request::clear_clientreqid() {
+  _impl_.clientreqid_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000008u;
+}
+inline uint64_t Request::_internal_clientreqid() const {
+  return _impl_.clientreqid_;
+}
+inline uint64_t Request::clientreqid() const {
+  // @@protoc_insertion_point(field_get:dsnet.Request.clientreqid)
+  return _internal_clientreqid();
+}
+inline void Request::_internal_set_clientreqid(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  _impl_.clientreqid_ = value;
+}
+inline void Request::set_clientreqid(uint64_t value) {
+  _internal_set_clientreqid(value);
+  // @@protoc_insertion_point(field_set:dsnet.Request.clientreqid)
+}
+
+// repeated .dsnet.ShardOp ops = 4;
+inline int Request::_internal_ops_size() const {
+  return _impl_.ops_.size();
+}
+inline int Request::ops_size() const {
+  return _internal_ops_size();
+}
+inline void Request::clear_ops() {
+  _impl_.ops_.Clear();
+}
+inline ::dsnet::ShardOp* Request::mutable_ops(int index) {
+  // @@protoc_insertion_point(field_mutable:dsnet.Request.ops)
+  return _impl_.ops_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::dsnet::ShardOp >*
+Request::mutable_ops() {
+  // @@protoc_insertion_point(field_mutable_list:dsnet.Request.ops)
+  return &_impl_.ops_;
+}
+inline const ::dsnet::ShardOp& Request::_internal_ops(int index) const {
+  return _impl_.ops_.Get(index);
+}
+inline const ::dsnet::ShardOp& Request::ops(int index) const {
+  // @@protoc_insertion_point(field_get:dsnet.Request.ops)
+  return _internal_ops(index);
+}
+inline ::dsnet::ShardOp* Request::_internal_add_ops() {
+  return _impl_.ops_.Add();
+}
+inline ::dsnet::ShardOp* Request::add_ops() {
+  ::dsnet::ShardOp* _add = _internal_add_ops();
+  // @@protoc_insertion_point(field_add:dsnet.Request.ops)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::dsnet::ShardOp >&
+Request::ops() const {
+  // @@protoc_insertion_point(field_list:dsnet.Request.ops)
+  return _impl_.ops_;
+}
+
+// optional uint64 sessnum = 5;
+inline bool Request::_internal_has_sessnum() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000010u) != 0;
+  return value;
+}
+inline bool Request::has_sessnum() const {
+  return _internal_has_sessnum();
+}
+inline void Request::clear_sessnum() {
+  _impl_.sessnum_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000010u;
+}
+inline uint64_t Request::_internal_sessnum() const {
+  return _impl_.sessnum_;
+}
+inline uint64_t Request::sessnum() const {
+  // @@protoc_insertion_point(field_get:dsnet.Request.sessnum)
+  return _internal_sessnum();
+}
+inline void Request::_internal_set_sessnum(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000010u;
+  _impl_.sessnum_ = value;
+}
+inline void Request::set_sessnum(uint64_t value) {
+  _internal_set_sessnum(value);
+  // @@protoc_insertion_point(field_set:dsnet.Request.sessnum)
+}
+
+// optional bytes clientaddr = 6;
+inline bool Request::_internal_has_clientaddr() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool Request::has_clientaddr() const {
+  return _internal_has_clientaddr();
+}
+inline void Request::clear_clientaddr() {
+  _impl_.clientaddr_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline const std::string& Request::clientaddr() const {
+  // @@protoc_insertion_point(field_get:dsnet.Request.clientaddr)
+  return _internal_clientaddr();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void Request::set_clientaddr(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000002u;
+ _impl_.clientaddr_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:dsnet.Request.clientaddr)
+}
+inline std::string* Request::mutable_clientaddr() {
+  std::string* _s = _internal_mutable_clientaddr();
+  // @@protoc_insertion_point(field_mutable:dsnet.Request.clientaddr)
+  return _s;
+}
+inline const std::string& Request::_internal_clientaddr() const {
+  return _impl_.clientaddr_.Get();
+}
+inline void Request::_internal_set_clientaddr(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.clientaddr_.Set(value, GetArenaForAllocation());
+}
+inline std::string* Request::_internal_mutable_clientaddr() {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  return _impl_.clientaddr_.Mutable(GetArenaForAllocation());
+}
+inline std::string* Request::release_clientaddr() {
+  // @@protoc_insertion_point(field_release:dsnet.Request.clientaddr)
+  if (!_internal_has_clientaddr()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  auto* p = _impl_.clientaddr_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.clientaddr_.IsDefault()) {
+    _impl_.clientaddr_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void Request::set_allocated_clientaddr(std::string* clientaddr) {
+  if (clientaddr != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  _impl_.clientaddr_.SetAllocated(clientaddr, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.clientaddr_.IsDefault()) {
+    _impl_.clientaddr_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:dsnet.Request.clientaddr)
+}
+
+// -------------------------------------------------------------------
+
+// UnloggedRequest
+
+// required bytes op = 1;
+inline bool UnloggedRequest::_internal_has_op() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool UnloggedRequest::has_op() const {
+  return _internal_has_op();
+}
+inline void UnloggedRequest::clear_op() {
+  _impl_.op_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& UnloggedRequest::op() const {
+  // @@protoc_insertion_point(field_get:dsnet.UnloggedRequest.op)
+  return _internal_op();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void UnloggedRequest::set_op(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.op_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:dsnet.UnloggedRequest.op)
+}
+inline std::string* UnloggedRequest::mutable_op() {
+  std::string* _s = _internal_mutable_op();
+  // @@protoc_insertion_point(field_mutable:dsnet.UnloggedRequest.op)
+  return _s;
+}
+inline const std::string& UnloggedRequest::_internal_op() const {
+  return _impl_.op_.Get();
+}
+inline void UnloggedRequest::_internal_set_op(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.op_.Set(value, GetArenaForAllocation());
+}
+inline std::string* UnloggedRequest::_internal_mutable_op() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.op_.Mutable(GetArenaForAllocation());
+}
+inline std::string* UnloggedRequest::release_op() {
+  // @@protoc_insertion_point(field_release:dsnet.UnloggedRequest.op)
+  if (!_internal_has_op()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.op_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.op_.IsDefault()) {
+    _impl_.op_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void UnloggedRequest::set_allocated_op(std::string* op) {
+  if (op != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.op_.SetAllocated(op, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.op_.IsDefault()) {
+    _impl_.op_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:dsnet.UnloggedRequest.op)
+}
+
+// required uint64 clientid = 2;
+inline bool UnloggedRequest::_internal_has_clientid() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool UnloggedRequest::has_clientid() const {
+  return _internal_has_clientid();
+}
+inline void UnloggedRequest::clear_clientid() {
+  _impl_.clientid_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline uint64_t UnloggedRequest::_internal_clientid() const {
+  return _impl_.clientid_;
+}
+inline uint64_t UnloggedRequest::clientid() const {
+  // @@protoc_insertion_point(field_get:dsnet.UnloggedRequest.clientid)
+  return _internal_clientid();
+}
+inline void UnloggedRequest::_internal_set_clientid(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.clientid_ = value;
+}
+inline void UnloggedRequest::set_clientid(uint64_t value) {
+  _internal_set_clientid(value);
+  // @@protoc_insertion_point(field_set:dsnet.UnloggedRequest.clientid)
+}
+
+// required uint64 clientreqid = 3;
+inline bool UnloggedRequest::_internal_has_clientreqid() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool UnloggedRequest::has_clientreqid() const {
+  return _internal_has_clientreqid();
+}
+inline void UnloggedRequest::clear_clientreqid() {
+  _impl_.clientreqid_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline uint64_t UnloggedRequest::_internal_clientreqid() const {
+  return _impl_.clientreqid_;
+}
+inline uint64_t UnloggedRequest::clientreqid() const {
+  // @@protoc_insertion_point(field_get:dsnet.UnloggedRequest.clientreqid)
+  return _internal_clientreqid();
+}
+inline void UnloggedRequest::_internal_set_clientreqid(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.clientreqid_ = value;
+}
+inline void UnloggedRequest::set_clientreqid(uint64_t value) {
+  _internal_set_clientreqid(value);
+  // @@protoc_insertion_point(field_set:dsnet.UnloggedRequest.clientreqid)
+}
+
+// -------------------------------------------------------------------
+
+// MsgLogEntry
+
+// required uint64 view = 1;
+inline bool MsgLogEntry::_internal_has_view() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool MsgLogEntry::has_view() const {
+  return _internal_has_view();
+}
+inline void MsgLogEntry::clear_view() {
+  _impl_.view_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline uint64_t MsgLogEntry::_internal_view() const {
+  return _impl_.view_;
+}
+inline uint64_t MsgLogEntry::view() const {
+  // @@protoc_insertion_point(field_get:dsnet.MsgLogEntry.view)
+  return _internal_view();
+}
+inline void MsgLogEntry::_internal_set_view(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.view_ = value;
+}
+inline void MsgLogEntry::set_view(uint64_t value) {
+  _internal_set_view(value);
+  // @@protoc_insertion_point(field_set:dsnet.MsgLogEntry.view)
+}
+
+// required uint64 opnum = 2;
+inline bool MsgLogEntry::_internal_has_opnum() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  return value;
+}
+inline bool MsgLogEntry::has_opnum() const {
+  return _internal_has_opnum();
+}
+inline void MsgLogEntry::clear_opnum() {
+  _impl_.opnum_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000008u;
+}
+inline uint64_t MsgLogEntry::_internal_opnum() const {
+  return _impl_.opnum_;
+}
+inline uint64_t MsgLogEntry::opnum() const {
+  // @@protoc_insertion_point(field_get:dsnet.MsgLogEntry.opnum)
+  return _internal_opnum();
+}
+inline void MsgLogEntry::_internal_set_opnum(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  _impl_.opnum_ = value;
+}
+inline void MsgLogEntry::set_opnum(uint64_t value) {
+  _internal_set_opnum(value);
+  // @@protoc_insertion_point(field_set:dsnet.MsgLogEntry.opnum)
+}
+
+// required uint64 sessnum = 3;
+inline bool MsgLogEntry::_internal_has_sessnum() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000010u) != 0;
+  return value;
+}
+inline bool MsgLogEntry::has_sessnum() const {
+  return _internal_has_sessnum();
+}
+inline void MsgLogEntry::clear_sessnum() {
+  _impl_.sessnum_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000010u;
+}
+inline uint64_t MsgLogEntry::_internal_sessnum() const {
+  return _impl_.sessnum_;
+}
+inline uint64_t MsgLogEntry::sessnum() const {
+  // @@protoc_insertion_point(field_get:dsnet.MsgLogEntry.sessnum)
+  return _internal_sessnum();
+}
+inline void MsgLogEntry::_internal_set_sessnum(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000010u;
+  _impl_.sessnum_ = value;
+}
+inline void MsgLogEntry::set_sessnum(uint64_t value) {
+  _internal_set_sessnum(value);
+  // @@protoc_insertion_point(field_set:dsnet.MsgLogEntry.sessnum)
+}
+
+// required uint64 msgnum = 4;
+inline bool MsgLogEntry::_internal_has_msgnum() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000020u) != 0;
+  return value;
+}
+inline bool MsgLogEntry::has_msgnum() const {
+  return _internal_has_msgnum();
+}
+inline void MsgLogEntry::clear_msgnum() {
+  _impl_.msgnum_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000020u;
+}
+inline uint64_t MsgLogEntry::_internal_msgnum() const {
+  return _impl_.msgnum_;
+}
+inline uint64_t MsgLogEntry::msgnum() const {
+  // @@protoc_insertion_point(field_get:dsnet.MsgLogEntry.msgnum)
+  return _internal_msgnum();
+}
+inline void MsgLogEntry::_internal_set_msgnum(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000020u;
+  _impl_.msgnum_ = value;
+}
+inline void MsgLogEntry::set_msgnum(uint64_t value) {
+  _internal_set_msgnum(value);
+  // @@protoc_insertion_point(field_set:dsnet.MsgLogEntry.msgnum)
+}
+
+// required uint32 shardnum = 5;
+inline bool MsgLogEntry::_internal_has_shardnum() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000040u) != 0;
+  return value;
+}
+inline bool MsgLogEntry::has_shardnum() const {
+  return _internal_has_shardnum();
+}
+inline void MsgLogEntry::clear_shardnum() {
+  _impl_.shardnum_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000040u;
+}
+inline uint32_t MsgLogEntry::_internal_shardnum() const {
+  return _impl_.shardnum_;
+}
+inline uint32_t MsgLogEntry::shardnum() const {
+  // @@protoc_insertion_point(field_get:dsnet.MsgLogEntry.shardnum)
+  return _internal_shardnum();
+}
+inline void MsgLogEntry::_internal_set_shardnum(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000040u;
+  _impl_.shardnum_ = value;
+}
+inline void MsgLogEntry::set_shardnum(uint32_t value) {
+  _internal_set_shardnum(value);
+  // @@protoc_insertion_point(field_set:dsnet.MsgLogEntry.shardnum)
+}
+
+// required .dsnet.Request request = 6;
+inline bool MsgLogEntry::_internal_has_request() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.request_ != nullptr);
+  return value;
+}
+inline bool MsgLogEntry::has_request() const {
+  return _internal_has_request();
+}
+inline void MsgLogEntry::clear_request() {
+  if (_impl_.request_ != nullptr) _impl_.request_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline const ::dsnet::Request& MsgLogEntry::_internal_request() const {
+  const ::dsnet::Request* p = _impl_.request_;
+  return p != nullptr ? *p : reinterpret_cast<const ::dsnet::Request&>(
+      ::dsnet::_Request_default_instance_);
+}
+inline const ::dsnet::Request& MsgLogEntry::request() const {
+  // @@protoc_insertion_point(field_get:dsnet.MsgLogEntry.request)
+  return _internal_request();
+}
+inline void MsgLogEntry::unsafe_arena_set_allocated_request(
+    ::dsnet::Request* request) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.request_);
+  }
+  _impl_.request_ = request;
+  if (request) {
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:dsnet.MsgLogEntry.request)
+}
+inline ::dsnet::Request* MsgLogEntry::release_request() {
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  ::dsnet::Request* temp = _impl_.request_;
+  _impl_.request_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::dsnet::Request* MsgLogEntry::unsafe_arena_release_request() {
+  // @@protoc_insertion_point(field_release:dsnet.MsgLogEntry.request)
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  ::dsnet::Request* temp = _impl_.request_;
+  _impl_.request_ = nullptr;
+  return temp;
+}
+inline ::dsnet::Request* MsgLogEntry::_internal_mutable_request() {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  if (_impl_.request_ == nullptr) {
+    auto* p = CreateMaybeMessage<::dsnet::Request>(GetArenaForAllocation());
+    _impl_.request_ = p;
+  }
+  return _impl_.request_;
+}
+inline ::dsnet::Request* MsgLogEntry::mutable_request() {
+  ::dsnet::Request* _msg = _internal_mutable_request();
+  // @@protoc_insertion_point(field_mutable:dsnet.MsgLogEntry.request)
+  return _msg;
+}
+inline void MsgLogEntry::set_allocated_request(::dsnet::Request* request) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.request_;
+  }
+  if (request) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(request);
+    if (message_arena != submessage_arena) {
+      request = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, request, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  _impl_.request_ = request;
+  // @@protoc_insertion_point(field_set_allocated:dsnet.MsgLogEntry.request)
+}
+
+// required uint32 state = 7;
+inline bool MsgLogEntry::_internal_has_state() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000080u) != 0;
+  return value;
+}
+inline bool MsgLogEntry::has_state() const {
+  return _internal_has_state();
+}
+inline void MsgLogEntry::clear_state() {
+  _impl_.state_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000080u;
+}
+inline uint32_t MsgLogEntry::_internal_state() const {
+  return _impl_.state_;
+}
+inline uint32_t MsgLogEntry::state() const {
+  // @@protoc_insertion_point(field_get:dsnet.MsgLogEntry.state)
+  return _internal_state();
+}
+inline void MsgLogEntry::_internal_set_state(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000080u;
+  _impl_.state_ = value;
+}
+inline void MsgLogEntry::set_state(uint32_t value) {
+  _internal_set_state(value);
+  // @@protoc_insertion_point(field_set:dsnet.MsgLogEntry.state)
+}
+
+// required bytes hash = 8;
+inline bool MsgLogEntry::_internal_has_hash() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool MsgLogEntry::has_hash() const {
+  return _internal_has_hash();
+}
+inline void MsgLogEntry::clear_hash() {
+  _impl_.hash_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& MsgLogEntry::hash() const {
+  // @@protoc_insertion_point(field_get:dsnet.MsgLogEntry.hash)
+  return _internal_hash();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void MsgLogEntry::set_hash(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.hash_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:dsnet.MsgLogEntry.hash)
+}
+inline std::string* MsgLogEntry::mutable_hash() {
+  std::string* _s = _internal_mutable_hash();
+  // @@protoc_insertion_point(field_mutable:dsnet.MsgLogEntry.hash)
+  return _s;
+}
+inline const std::string& MsgLogEntry::_internal_hash() const {
+  return _impl_.hash_.Get();
+}
+inline void MsgLogEntry::_internal_set_hash(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.hash_.Set(value, GetArenaForAllocation());
+}
+inline std::string* MsgLogEntry::_internal_mutable_hash() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.hash_.Mutable(GetArenaForAllocation());
+}
+inline std::string* MsgLogEntry::release_hash() {
+  // @@protoc_insertion_point(field_release:dsnet.MsgLogEntry.hash)
+  if (!_internal_has_hash()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.hash_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.hash_.IsDefault()) {
+    _impl_.hash_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void MsgLogEntry::set_allocated_hash(std::string* hash) {
+  if (hash != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.hash_.SetAllocated(hash, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.hash_.IsDefault()) {
+    _impl_.hash_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:dsnet.MsgLogEntry.hash)
+}
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic pop
+#endif  // __GNUC__
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+
+// @@protoc_insertion_point(namespace_scope)
+
+}  // namespace dsnet
+
+// @@protoc_insertion_point(global_scope)
+
+#include <google/protobuf/port_undef.inc>
+#endif  // GOOGLE_PROTOBUF_INCLUDED_GOOGLE_PROTOBUF_INCLUDED_common_2frequest_2eproto
@@ -0,0 +1,1007 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: lib/latency-format.proto
+
+#include "lib/latency-format.pb.h"
+
+#include <algorithm>
+
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/extension_set.h>
+#include <google/protobuf/wire_format_lite.h>
+#include <google/protobuf/descriptor.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/reflection_ops.h>
+#include <google/protobuf/wire_format.h>
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+
+PROTOBUF_PRAGMA_INIT_SEG
+
+namespace _pb = ::PROTOBUF_NAMESPACE_ID;
+namespace _pbi = _pb::internal;
+
+namespace dsnet {
+namespace latency {
+namespace format {
+PROTOBUF_CONSTEXPR LatencyDist::LatencyDist(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.buckets_)*/{}
+  , /*decltype(_impl_.min_)*/uint64_t{0u}
+  , /*decltype(_impl_.max_)*/uint64_t{0u}
+  , /*decltype(_impl_.total_)*/uint64_t{0u}
+  , /*decltype(_impl_.count_)*/uint64_t{0u}
+  , /*decltype(_impl_.type_)*/0u} {}
+struct LatencyDistDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR LatencyDistDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~LatencyDistDefaultTypeInternal() {}
+  union {
+    LatencyDist _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 LatencyDistDefaultTypeInternal _LatencyDist_default_instance_;
+PROTOBUF_CONSTEXPR Latency::Latency(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.dists_)*/{}
+  , /*decltype(_impl_.name_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}} {}
+struct LatencyDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR LatencyDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~LatencyDefaultTypeInternal() {}
+  union {
+    Latency _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 LatencyDefaultTypeInternal _Latency_default_instance_;
+PROTOBUF_CONSTEXPR LatencyFile::LatencyFile(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.latencies_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct LatencyFileDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR LatencyFileDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~LatencyFileDefaultTypeInternal() {}
+  union {
+    LatencyFile _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 LatencyFileDefaultTypeInternal _LatencyFile_default_instance_;
+}  // namespace format
+}  // namespace latency
+}  // namespace dsnet
+static ::_pb::Metadata file_level_metadata_lib_2flatency_2dformat_2eproto[3];
+static constexpr ::_pb::EnumDescriptor const** file_level_enum_descriptors_lib_2flatency_2dformat_2eproto = nullptr;
+static constexpr ::_pb::ServiceDescriptor const** file_level_service_descriptors_lib_2flatency_2dformat_2eproto = nullptr;
+
+const uint32_t TableStruct_lib_2flatency_2dformat_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  PROTOBUF_FIELD_OFFSET(::dsnet::latency::format::LatencyDist, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::latency::format::LatencyDist, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::dsnet::latency::format::LatencyDist, _impl_.type_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::latency::format::LatencyDist, _impl_.min_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::latency::format::LatencyDist, _impl_.max_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::latency::format::LatencyDist, _impl_.total_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::latency::format::LatencyDist, _impl_.count_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::latency::format::LatencyDist, _impl_.buckets_),
+  4,
+  0,
+  1,
+  2,
+  3,
+  ~0u,
+  PROTOBUF_FIELD_OFFSET(::dsnet::latency::format::Latency, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::latency::format::Latency, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::dsnet::latency::format::Latency, _impl_.name_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::latency::format::Latency, _impl_.dists_),
+  0,
+  ~0u,
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::dsnet::latency::format::LatencyFile, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::dsnet::latency::format::LatencyFile, _impl_.latencies_),
+};
+static const ::_pbi::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  { 0, 12, -1, sizeof(::dsnet::latency::format::LatencyDist)},
+  { 18, 26, -1, sizeof(::dsnet::latency::format::Latency)},
+  { 28, -1, -1, sizeof(::dsnet::latency::format::LatencyFile)},
+};
+
+static const ::_pb::Message* const file_default_instances[] = {
+  &::dsnet::latency::format::_LatencyDist_default_instance_._instance,
+  &::dsnet::latency::format::_Latency_default_instance_._instance,
+  &::dsnet::latency::format::_LatencyFile_default_instance_._instance,
+};
+
+const char descriptor_table_protodef_lib_2flatency_2dformat_2eproto[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) =
+  "\n\030lib/latency-format.proto\022\024dsnet.latenc"
+  "y.format\"d\n\013LatencyDist\022\014\n\004type\030\001 \002(\r\022\013\n"
+  "\003min\030\002 \002(\004\022\013\n\003max\030\003 \002(\004\022\r\n\005total\030\004 \002(\004\022\r"
+  "\n\005count\030\005 \002(\004\022\017\n\007buckets\030\006 \003(\r\"I\n\007Latenc"
+  "y\022\014\n\004name\030\001 \002(\t\0220\n\005dists\030\002 \003(\0132!.dsnet.l"
+  "atency.format.LatencyDist\"\?\n\013LatencyFile"
+  "\0220\n\tlatencies\030\001 \003(\0132\035.dsnet.latency.form"
+  "at.Latency"
+  ;
+static ::_pbi::once_flag descriptor_table_lib_2flatency_2dformat_2eproto_once;
+const ::_pbi::DescriptorTable descriptor_table_lib_2flatency_2dformat_2eproto = {
+    false, false, 290, descriptor_table_protodef_lib_2flatency_2dformat_2eproto,
+    "lib/latency-format.proto",
+    &descriptor_table_lib_2flatency_2dformat_2eproto_once, nullptr, 0, 3,
+    schemas, file_default_instances, TableStruct_lib_2flatency_2dformat_2eproto::offsets,
+    file_level_metadata_lib_2flatency_2dformat_2eproto, file_level_enum_descriptors_lib_2flatency_2dformat_2eproto,
+    file_level_service_descriptors_lib_2flatency_2dformat_2eproto,
+};
+PROTOBUF_ATTRIBUTE_WEAK const ::_pbi::DescriptorTable* descriptor_table_lib_2flatency_2dformat_2eproto_getter() {
+  return &descriptor_table_lib_2flatency_2dformat_2eproto;
+}
+
+// Force running AddDescriptors() at dynamic initialization time.
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 static ::_pbi::AddDescriptorsRunner dynamic_init_dummy_lib_2flatency_2dformat_2eproto(&descriptor_table_lib_2flatency_2dformat_2eproto);
+namespace dsnet {
+namespace latency {
+namespace format {
+
+// ===================================================================
+
+class LatencyDist::_Internal {
+ public:
+  using HasBits = decltype(std::declval<LatencyDist>()._impl_._has_bits_);
+  static void set_has_type(HasBits* has_bits) {
+    (*has_bits)[0] |= 16u;
+  }
+  static void set_has_min(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_max(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_total(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static void set_has_count(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x0000001f) ^ 0x0000001f) != 0;
+  }
+};
+
+LatencyDist::LatencyDist(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:dsnet.latency.format.LatencyDist)
+}
+LatencyDist::LatencyDist(const LatencyDist& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  LatencyDist* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.buckets_){from._impl_.buckets_}
+    , decltype(_impl_.min_){}
+    , decltype(_impl_.max_){}
+    , decltype(_impl_.total_){}
+    , decltype(_impl_.count_){}
+    , decltype(_impl_.type_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.min_, &from._impl_.min_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.type_) -
+    reinterpret_cast<char*>(&_impl_.min_)) + sizeof(_impl_.type_));
+  // @@protoc_insertion_point(copy_constructor:dsnet.latency.format.LatencyDist)
+}
+
+inline void LatencyDist::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.buckets_){arena}
+    , decltype(_impl_.min_){uint64_t{0u}}
+    , decltype(_impl_.max_){uint64_t{0u}}
+    , decltype(_impl_.total_){uint64_t{0u}}
+    , decltype(_impl_.count_){uint64_t{0u}}
+    , decltype(_impl_.type_){0u}
+  };
+}
+
+LatencyDist::~LatencyDist() {
+  // @@protoc_insertion_point(destructor:dsnet.latency.format.LatencyDist)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void LatencyDist::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.buckets_.~RepeatedField();
+}
+
+void LatencyDist::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void LatencyDist::Clear() {
+// @@protoc_insertion_point(message_clear_start:dsnet.latency.format.LatencyDist)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.buckets_.Clear();
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000001fu) {
+    ::memset(&_impl_.min_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.type_) -
+        reinterpret_cast<char*>(&_impl_.min_)) + sizeof(_impl_.type_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* LatencyDist::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required uint32 type = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_type(&has_bits);
+          _impl_.type_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required uint64 min = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _Internal::set_has_min(&has_bits);
+          _impl_.min_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required uint64 max = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _Internal::set_has_max(&has_bits);
+          _impl_.max_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required uint64 total = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _Internal::set_has_total(&has_bits);
+          _impl_.total_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required uint64 count = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          _Internal::set_has_count(&has_bits);
+          _impl_.count_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated uint32 buckets = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 48)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            _internal_add_buckets(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr));
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<48>(ptr));
+        } else if (static_cast<uint8_t>(tag) == 50) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedUInt32Parser(_internal_mutable_buckets(), ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* LatencyDist::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:dsnet.latency.format.LatencyDist)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required uint32 type = 1;
+  if (cached_has_bits & 0x00000010u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(1, this->_internal_type(), target);
+  }
+
+  // required uint64 min = 2;
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(2, this->_internal_min(), target);
+  }
+
+  // required uint64 max = 3;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(3, this->_internal_max(), target);
+  }
+
+  // required uint64 total = 4;
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(4, this->_internal_total(), target);
+  }
+
+  // required uint64 count = 5;
+  if (cached_has_bits & 0x00000008u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(5, this->_internal_count(), target);
+  }
+
+  // repeated uint32 buckets = 6;
+  for (int i = 0, n = this->_internal_buckets_size(); i < n; i++) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(6, this->_internal_buckets(i), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:dsnet.latency.format.LatencyDist)
+  return target;
+}
+
+size_t LatencyDist::RequiredFieldsByteSizeFallback() const {
+// @@protoc_insertion_point(required_fields_byte_size_fallback_start:dsnet.latency.format.LatencyDist)
+  size_t total_size = 0;
+
+  if (_internal_has_min()) {
+    // required uint64 min = 2;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_min());
+  }
+
+  if (_internal_has_max()) {
+    // required uint64 max = 3;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_max());
+  }
+
+  if (_internal_has_total()) {
+    // required uint64 total = 4;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_total());
+  }
+
+  if (_internal_has_count()) {
+    // required uint64 count = 5;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_count());
+  }
+
+  if (_internal_has_type()) {
+    // required uint32 type = 1;
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_type());
+  }
+
+  return total_size;
+}
+size_t LatencyDist::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:dsnet.latency.format.LatencyDist)
+  size_t total_size = 0;
+
+  if (((_impl_._has_bits_[0] & 0x0000001f) ^ 0x0000001f) == 0) {  // All required fields are present.
+    // required uint64 min = 2;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_min());
+
+    // required uint64 max = 3;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_max());
+
+    // required uint64 total = 4;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_total());
+
+    // required uint64 count = 5;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_count());
+
+    // required uint32 type = 1;
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_type());
+
+  } else {
+    total_size += RequiredFieldsByteSizeFallback();
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated uint32 buckets = 6;
+  {
+    size_t data_size = ::_pbi::WireFormatLite::
+      UInt32Size(this->_impl_.buckets_);
+    total_size += 1 *
+                  ::_pbi::FromIntSize(this->_internal_buckets_size());
+    total_size += data_size;
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData LatencyDist::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    LatencyDist::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*LatencyDist::GetClassData() const { return &_class_data_; }
+
+
+void LatencyDist::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<LatencyDist*>(&to_msg);
+  auto& from = static_cast<const LatencyDist&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:dsnet.latency.format.LatencyDist)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.buckets_.MergeFrom(from._impl_.buckets_);
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000001fu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_impl_.min_ = from._impl_.min_;
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.max_ = from._impl_.max_;
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.total_ = from._impl_.total_;
+    }
+    if (cached_has_bits & 0x00000008u) {
+      _this->_impl_.count_ = from._impl_.count_;
+    }
+    if (cached_has_bits & 0x00000010u) {
+      _this->_impl_.type_ = from._impl_.type_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void LatencyDist::CopyFrom(const LatencyDist& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:dsnet.latency.format.LatencyDist)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool LatencyDist::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  return true;
+}
+
+void LatencyDist::InternalSwap(LatencyDist* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  _impl_.buckets_.InternalSwap(&other->_impl_.buckets_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(LatencyDist, _impl_.type_)
+      + sizeof(LatencyDist::_impl_.type_)
+      - PROTOBUF_FIELD_OFFSET(LatencyDist, _impl_.min_)>(
+          reinterpret_cast<char*>(&_impl_.min_),
+          reinterpret_cast<char*>(&other->_impl_.min_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata LatencyDist::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_lib_2flatency_2dformat_2eproto_getter, &descriptor_table_lib_2flatency_2dformat_2eproto_once,
+      file_level_metadata_lib_2flatency_2dformat_2eproto[0]);
+}
+
+// ===================================================================
+
+class Latency::_Internal {
+ public:
+  using HasBits = decltype(std::declval<Latency>()._impl_._has_bits_);
+  static void set_has_name(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000001) ^ 0x00000001) != 0;
+  }
+};
+
+Latency::Latency(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:dsnet.latency.format.Latency)
+}
+Latency::Latency(const Latency& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  Latency* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.dists_){from._impl_.dists_}
+    , decltype(_impl_.name_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_name()) {
+    _this->_impl_.name_.Set(from._internal_name(), 
+      _this->GetArenaForAllocation());
+  }
+  // @@protoc_insertion_point(copy_constructor:dsnet.latency.format.Latency)
+}
+
+inline void Latency::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.dists_){arena}
+    , decltype(_impl_.name_){}
+  };
+  _impl_.name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+Latency::~Latency() {
+  // @@protoc_insertion_point(destructor:dsnet.latency.format.Latency)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void Latency::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.dists_.~RepeatedPtrField();
+  _impl_.name_.Destroy();
+}
+
+void Latency::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void Latency::Clear() {
+// @@protoc_insertion_point(message_clear_start:dsnet.latency.format.Latency)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.dists_.Clear();
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    _impl_.name_.ClearNonDefaultToEmpty();
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* Latency::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required string name = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_name();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "dsnet.latency.format.Latency.name");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .dsnet.latency.format.LatencyDist dists = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_dists(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<18>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* Latency::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:dsnet.latency.format.Latency)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required string name = 1;
+  if (cached_has_bits & 0x00000001u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_name().data(), static_cast<int>(this->_internal_name().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "dsnet.latency.format.Latency.name");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_name(), target);
+  }
+
+  // repeated .dsnet.latency.format.LatencyDist dists = 2;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_dists_size()); i < n; i++) {
+    const auto& repfield = this->_internal_dists(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(2, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:dsnet.latency.format.Latency)
+  return target;
+}
+
+size_t Latency::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:dsnet.latency.format.Latency)
+  size_t total_size = 0;
+
+  // required string name = 1;
+  if (_internal_has_name()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_name());
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .dsnet.latency.format.LatencyDist dists = 2;
+  total_size += 1UL * this->_internal_dists_size();
+  for (const auto& msg : this->_impl_.dists_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData Latency::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    Latency::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*Latency::GetClassData() const { return &_class_data_; }
+
+
+void Latency::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<Latency*>(&to_msg);
+  auto& from = static_cast<const Latency&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:dsnet.latency.format.Latency)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.dists_.MergeFrom(from._impl_.dists_);
+  if (from._internal_has_name()) {
+    _this->_internal_set_name(from._internal_name());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void Latency::CopyFrom(const Latency& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:dsnet.latency.format.Latency)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool Latency::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  if (!::PROTOBUF_NAMESPACE_ID::internal::AllAreInitialized(_impl_.dists_))
+    return false;
+  return true;
+}
+
+void Latency::InternalSwap(Latency* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  _impl_.dists_.InternalSwap(&other->_impl_.dists_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.name_, lhs_arena,
+      &other->_impl_.name_, rhs_arena
+  );
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata Latency::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_lib_2flatency_2dformat_2eproto_getter, &descriptor_table_lib_2flatency_2dformat_2eproto_once,
+      file_level_metadata_lib_2flatency_2dformat_2eproto[1]);
+}
+
+// ===================================================================
+
+class LatencyFile::_Internal {
+ public:
+};
+
+LatencyFile::LatencyFile(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:dsnet.latency.format.LatencyFile)
+}
+LatencyFile::LatencyFile(const LatencyFile& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  LatencyFile* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.latencies_){from._impl_.latencies_}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  // @@protoc_insertion_point(copy_constructor:dsnet.latency.format.LatencyFile)
+}
+
+inline void LatencyFile::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.latencies_){arena}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+LatencyFile::~LatencyFile() {
+  // @@protoc_insertion_point(destructor:dsnet.latency.format.LatencyFile)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void LatencyFile::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.latencies_.~RepeatedPtrField();
+}
+
+void LatencyFile::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void LatencyFile::Clear() {
+// @@protoc_insertion_point(message_clear_start:dsnet.latency.format.LatencyFile)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.latencies_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* LatencyFile::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // repeated .dsnet.latency.format.Latency latencies = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_latencies(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<10>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* LatencyFile::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:dsnet.latency.format.LatencyFile)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // repeated .dsnet.latency.format.Latency latencies = 1;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_latencies_size()); i < n; i++) {
+    const auto& repfield = this->_internal_latencies(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(1, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:dsnet.latency.format.LatencyFile)
+  return target;
+}
+
+size_t LatencyFile::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:dsnet.latency.format.LatencyFile)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .dsnet.latency.format.Latency latencies = 1;
+  total_size += 1UL * this->_internal_latencies_size();
+  for (const auto& msg : this->_impl_.latencies_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData LatencyFile::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    LatencyFile::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*LatencyFile::GetClassData() const { return &_class_data_; }
+
+
+void LatencyFile::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<LatencyFile*>(&to_msg);
+  auto& from = static_cast<const LatencyFile&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:dsnet.latency.format.LatencyFile)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.latencies_.MergeFrom(from._impl_.latencies_);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void LatencyFile::CopyFrom(const LatencyFile& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:dsnet.latency.format.LatencyFile)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool LatencyFile::IsInitialized() const {
+  if (!::PROTOBUF_NAMESPACE_ID::internal::AllAreInitialized(_impl_.latencies_))
+    return false;
+  return true;
+}
+
+void LatencyFile::InternalSwap(LatencyFile* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.latencies_.InternalSwap(&other->_impl_.latencies_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata LatencyFile::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_lib_2flatency_2dformat_2eproto_getter, &descriptor_table_lib_2flatency_2dformat_2eproto_once,
+      file_level_metadata_lib_2flatency_2dformat_2eproto[2]);
+}
+
+// @@protoc_insertion_point(namespace_scope)
+}  // namespace format
+}  // namespace latency
+}  // namespace dsnet
+PROTOBUF_NAMESPACE_OPEN
+template<> PROTOBUF_NOINLINE ::dsnet::latency::format::LatencyDist*
+Arena::CreateMaybeMessage< ::dsnet::latency::format::LatencyDist >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::dsnet::latency::format::LatencyDist >(arena);
+}
+template<> PROTOBUF_NOINLINE ::dsnet::latency::format::Latency*
+Arena::CreateMaybeMessage< ::dsnet::latency::format::Latency >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::dsnet::latency::format::Latency >(arena);
+}
+template<> PROTOBUF_NOINLINE ::dsnet::latency::format::LatencyFile*
+Arena::CreateMaybeMessage< ::dsnet::latency::format::LatencyFile >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::dsnet::latency::format::LatencyFile >(arena);
+}
+PROTOBUF_NAMESPACE_CLOSE
+
+// @@protoc_insertion_point(global_scope)
+#include <google/protobuf/port_undef.inc>
@@ -0,0 +1,1038 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: lib/latency-format.proto
+
+#ifndef GOOGLE_PROTOBUF_INCLUDED_lib_2flatency_2dformat_2eproto
+#define GOOGLE_PROTOBUF_INCLUDED_lib_2flatency_2dformat_2eproto
+
+#include <limits>
+#include <string>
+
+#include <google/protobuf/port_def.inc>
+#if PROTOBUF_VERSION < 3021000
+#error This file was generated by a newer version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please update
+#error your headers.
+#endif
+#if 3021012 < PROTOBUF_MIN_PROTOC_VERSION
+#error This file was generated by an older version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please
+#error regenerate this file with a newer version of protoc.
+#endif
+
+#include <google/protobuf/port_undef.inc>
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/arena.h>
+#include <google/protobuf/arenastring.h>
+#include <google/protobuf/generated_message_util.h>
+#include <google/protobuf/metadata_lite.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/message.h>
+#include <google/protobuf/repeated_field.h>  // IWYU pragma: export
+#include <google/protobuf/extension_set.h>  // IWYU pragma: export
+#include <google/protobuf/unknown_field_set.h>
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+#define PROTOBUF_INTERNAL_EXPORT_lib_2flatency_2dformat_2eproto
+PROTOBUF_NAMESPACE_OPEN
+namespace internal {
+class AnyMetadata;
+}  // namespace internal
+PROTOBUF_NAMESPACE_CLOSE
+
+// Internal implementation detail -- do not use these members.
+struct TableStruct_lib_2flatency_2dformat_2eproto {
+  static const uint32_t offsets[];
+};
+extern const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_lib_2flatency_2dformat_2eproto;
+namespace dsnet {
+namespace latency {
+namespace format {
+class Latency;
+struct LatencyDefaultTypeInternal;
+extern LatencyDefaultTypeInternal _Latency_default_instance_;
+class LatencyDist;
+struct LatencyDistDefaultTypeInternal;
+extern LatencyDistDefaultTypeInternal _LatencyDist_default_instance_;
+class LatencyFile;
+struct LatencyFileDefaultTypeInternal;
+extern LatencyFileDefaultTypeInternal _LatencyFile_default_instance_;
+}  // namespace format
+}  // namespace latency
+}  // namespace dsnet
+PROTOBUF_NAMESPACE_OPEN
+template<> ::dsnet::latency::format::Latency* Arena::CreateMaybeMessage<::dsnet::latency::format::Latency>(Arena*);
+template<> ::dsnet::latency::format::LatencyDist* Arena::CreateMaybeMessage<::dsnet::latency::format::LatencyDist>(Arena*);
+template<> ::dsnet::latency::format::LatencyFile* Arena::CreateMaybeMessage<::dsnet::latency::format::LatencyFile>(Arena*);
+PROTOBUF_NAMESPACE_CLOSE
+namespace dsnet {
+namespace latency {
+namespace format {
+
+// ===================================================================
+
+class LatencyDist final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:dsnet.latency.format.LatencyDist) */ {
+ public:
+  inline LatencyDist() : LatencyDist(nullptr) {}
+  ~LatencyDist() override;
+  explicit PROTOBUF_CONSTEXPR LatencyDist(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  LatencyDist(const LatencyDist& from);
+  LatencyDist(LatencyDist&& from) noexcept
+    : LatencyDist() {
+    *this = ::std::move(from);
+  }
+
+  inline LatencyDist& operator=(const LatencyDist& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline LatencyDist& operator=(LatencyDist&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const LatencyDist& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const LatencyDist* internal_default_instance() {
+    return reinterpret_cast<const LatencyDist*>(
+               &_LatencyDist_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    0;
+
+  friend void swap(LatencyDist& a, LatencyDist& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(LatencyDist* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(LatencyDist* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  LatencyDist* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<LatencyDist>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const LatencyDist& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const LatencyDist& from) {
+    LatencyDist::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(LatencyDist* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "dsnet.latency.format.LatencyDist";
+  }
+  protected:
+  explicit LatencyDist(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kBucketsFieldNumber = 6,
+    kMinFieldNumber = 2,
+    kMaxFieldNumber = 3,
+    kTotalFieldNumber = 4,
+    kCountFieldNumber = 5,
+    kTypeFieldNumber = 1,
+  };
+  // repeated uint32 buckets = 6;
+  int buckets_size() const;
+  private:
+  int _internal_buckets_size() const;
+  public:
+  void clear_buckets();
+  private:
+  uint32_t _internal_buckets(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+      _internal_buckets() const;
+  void _internal_add_buckets(uint32_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+      _internal_mutable_buckets();
+  public:
+  uint32_t buckets(int index) const;
+  void set_buckets(int index, uint32_t value);
+  void add_buckets(uint32_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+      buckets() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+      mutable_buckets();
+
+  // required uint64 min = 2;
+  bool has_min() const;
+  private:
+  bool _internal_has_min() const;
+  public:
+  void clear_min();
+  uint64_t min() const;
+  void set_min(uint64_t value);
+  private:
+  uint64_t _internal_min() const;
+  void _internal_set_min(uint64_t value);
+  public:
+
+  // required uint64 max = 3;
+  bool has_max() const;
+  private:
+  bool _internal_has_max() const;
+  public:
+  void clear_max();
+  uint64_t max() const;
+  void set_max(uint64_t value);
+  private:
+  uint64_t _internal_max() const;
+  void _internal_set_max(uint64_t value);
+  public:
+
+  // required uint64 total = 4;
+  bool has_total() const;
+  private:
+  bool _internal_has_total() const;
+  public:
+  void clear_total();
+  uint64_t total() const;
+  void set_total(uint64_t value);
+  private:
+  uint64_t _internal_total() const;
+  void _internal_set_total(uint64_t value);
+  public:
+
+  // required uint64 count = 5;
+  bool has_count() const;
+  private:
+  bool _internal_has_count() const;
+  public:
+  void clear_count();
+  uint64_t count() const;
+  void set_count(uint64_t value);
+  private:
+  uint64_t _internal_count() const;
+  void _internal_set_count(uint64_t value);
+  public:
+
+  // required uint32 type = 1;
+  bool has_type() const;
+  private:
+  bool _internal_has_type() const;
+  public:
+  void clear_type();
+  uint32_t type() const;
+  void set_type(uint32_t value);
+  private:
+  uint32_t _internal_type() const;
+  void _internal_set_type(uint32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:dsnet.latency.format.LatencyDist)
+ private:
+  class _Internal;
+
+  // helper for ByteSizeLong()
+  size_t RequiredFieldsByteSizeFallback() const;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t > buckets_;
+    uint64_t min_;
+    uint64_t max_;
+    uint64_t total_;
+    uint64_t count_;
+    uint32_t type_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_lib_2flatency_2dformat_2eproto;
+};
+// -------------------------------------------------------------------
+
+class Latency final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:dsnet.latency.format.Latency) */ {
+ public:
+  inline Latency() : Latency(nullptr) {}
+  ~Latency() override;
+  explicit PROTOBUF_CONSTEXPR Latency(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  Latency(const Latency& from);
+  Latency(Latency&& from) noexcept
+    : Latency() {
+    *this = ::std::move(from);
+  }
+
+  inline Latency& operator=(const Latency& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline Latency& operator=(Latency&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const Latency& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const Latency* internal_default_instance() {
+    return reinterpret_cast<const Latency*>(
+               &_Latency_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    1;
+
+  friend void swap(Latency& a, Latency& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(Latency* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Latency* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  Latency* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<Latency>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const Latency& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const Latency& from) {
+    Latency::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(Latency* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "dsnet.latency.format.Latency";
+  }
+  protected:
+  explicit Latency(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kDistsFieldNumber = 2,
+    kNameFieldNumber = 1,
+  };
+  // repeated .dsnet.latency.format.LatencyDist dists = 2;
+  int dists_size() const;
+  private:
+  int _internal_dists_size() const;
+  public:
+  void clear_dists();
+  ::dsnet::latency::format::LatencyDist* mutable_dists(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::dsnet::latency::format::LatencyDist >*
+      mutable_dists();
+  private:
+  const ::dsnet::latency::format::LatencyDist& _internal_dists(int index) const;
+  ::dsnet::latency::format::LatencyDist* _internal_add_dists();
+  public:
+  const ::dsnet::latency::format::LatencyDist& dists(int index) const;
+  ::dsnet::latency::format::LatencyDist* add_dists();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::dsnet::latency::format::LatencyDist >&
+      dists() const;
+
+  // required string name = 1;
+  bool has_name() const;
+  private:
+  bool _internal_has_name() const;
+  public:
+  void clear_name();
+  const std::string& name() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_name(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_name();
+  PROTOBUF_NODISCARD std::string* release_name();
+  void set_allocated_name(std::string* name);
+  private:
+  const std::string& _internal_name() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_name(const std::string& value);
+  std::string* _internal_mutable_name();
+  public:
+
+  // @@protoc_insertion_point(class_scope:dsnet.latency.format.Latency)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::dsnet::latency::format::LatencyDist > dists_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr name_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_lib_2flatency_2dformat_2eproto;
+};
+// -------------------------------------------------------------------
+
+class LatencyFile final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:dsnet.latency.format.LatencyFile) */ {
+ public:
+  inline LatencyFile() : LatencyFile(nullptr) {}
+  ~LatencyFile() override;
+  explicit PROTOBUF_CONSTEXPR LatencyFile(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  LatencyFile(const LatencyFile& from);
+  LatencyFile(LatencyFile&& from) noexcept
+    : LatencyFile() {
+    *this = ::std::move(from);
+  }
+
+  inline LatencyFile& operator=(const LatencyFile& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline LatencyFile& operator=(LatencyFile&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const LatencyFile& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const LatencyFile* internal_default_instance() {
+    return reinterpret_cast<const LatencyFile*>(
+               &_LatencyFile_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    2;
+
+  friend void swap(LatencyFile& a, LatencyFile& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(LatencyFile* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(LatencyFile* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  LatencyFile* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<LatencyFile>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const LatencyFile& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const LatencyFile& from) {
+    LatencyFile::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(LatencyFile* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "dsnet.latency.format.LatencyFile";
+  }
+  protected:
+  explicit LatencyFile(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kLatenciesFieldNumber = 1,
+  };
+  // repeated .dsnet.latency.format.Latency latencies = 1;
+  int latencies_size() const;
+  private:
+  int _internal_latencies_size() const;
+  public:
+  void clear_latencies();
+  ::dsnet::latency::format::Latency* mutable_latencies(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::dsnet::latency::format::Latency >*
+      mutable_latencies();
+  private:
+  const ::dsnet::latency::format::Latency& _internal_latencies(int index) const;
+  ::dsnet::latency::format::Latency* _internal_add_latencies();
+  public:
+  const ::dsnet::latency::format::Latency& latencies(int index) const;
+  ::dsnet::latency::format::Latency* add_latencies();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::dsnet::latency::format::Latency >&
+      latencies() const;
+
+  // @@protoc_insertion_point(class_scope:dsnet.latency.format.LatencyFile)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::dsnet::latency::format::Latency > latencies_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_lib_2flatency_2dformat_2eproto;
+};
+// ===================================================================
+
+
+// ===================================================================
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
+#endif  // __GNUC__
+// LatencyDist
+
+// required uint32 type = 1;
+inline bool LatencyDist::_internal_has_type() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000010u) != 0;
+  return value;
+}
+inline bool LatencyDist::has_type() const {
+  return _internal_has_type();
+}
+inline void LatencyDist::clear_type() {
+  _impl_.type_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000010u;
+}
+inline uint32_t LatencyDist::_internal_type() const {
+  return _impl_.type_;
+}
+inline uint32_t LatencyDist::type() const {
+  // @@protoc_insertion_point(field_get:dsnet.latency.format.LatencyDist.type)
+  return _internal_type();
+}
+inline void LatencyDist::_internal_set_type(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000010u;
+  _impl_.type_ = value;
+}
+inline void LatencyDist::set_type(uint32_t value) {
+  _internal_set_type(value);
+  // @@protoc_insertion_point(field_set:dsnet.latency.format.LatencyDist.type)
+}
+
+// required uint64 min = 2;
+inline bool LatencyDist::_internal_has_min() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool LatencyDist::has_min() const {
+  return _internal_has_min();
+}
+inline void LatencyDist::clear_min() {
+  _impl_.min_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline uint64_t LatencyDist::_internal_min() const {
+  return _impl_.min_;
+}
+inline uint64_t LatencyDist::min() const {
+  // @@protoc_insertion_point(field_get:dsnet.latency.format.LatencyDist.min)
+  return _internal_min();
+}
+inline void LatencyDist::_internal_set_min(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.min_ = value;
+}
+inline void LatencyDist::set_min(uint64_t value) {
+  _internal_set_min(value);
+  // @@protoc_insertion_point(field_set:dsnet.latency.format.LatencyDist.min)
+}
+
+// required uint64 max = 3;
+inline bool LatencyDist::_internal_has_max() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool LatencyDist::has_max() const {
+  return _internal_has_max();
+}
+inline void LatencyDist::clear_max() {
+  _impl_.max_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline uint64_t LatencyDist::_internal_max() const {
+  return _impl_.max_;
+}
+inline uint64_t LatencyDist::max() const {
+  // @@protoc_insertion_point(field_get:dsnet.latency.format.LatencyDist.max)
+  return _internal_max();
+}
+inline void LatencyDist::_internal_set_max(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.max_ = value;
+}
+inline void LatencyDist::set_max(uint64_t value) {
+  _internal_set_max(value);
+  // @@protoc_insertion_point(field_set:dsnet.latency.format.LatencyDist.max)
+}
+
+// required uint64 total = 4;
+inline bool LatencyDist::_internal_has_total() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool LatencyDist::has_total() const {
+  return _internal_has_total();
+}
+inline void LatencyDist::clear_total() {
+  _impl_.total_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline uint64_t LatencyDist::_internal_total() const {
+  return _impl_.total_;
+}
+inline uint64_t LatencyDist::total() const {
+  // @@protoc_insertion_point(field_get:dsnet.latency.format.LatencyDist.total)
+  return _internal_total();
+}
+inline void LatencyDist::_internal_set_total(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.total_ = value;
+}
+inline void LatencyDist::set_total(uint64_t value) {
+  _internal_set_total(value);
+  // @@protoc_insertion_point(field_set:dsnet.latency.format.LatencyDist.total)
+}
+
+// required uint64 count = 5;
+inline bool LatencyDist::_internal_has_count() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  return value;
+}
+inline bool LatencyDist::has_count() const {
+  return _internal_has_count();
+}
+inline void LatencyDist::clear_count() {
+  _impl_.count_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000008u;
+}
+inline uint64_t LatencyDist::_internal_count() const {
+  return _impl_.count_;
+}
+inline uint64_t LatencyDist::count() const {
+  // @@protoc_insertion_point(field_get:dsnet.latency.format.LatencyDist.count)
+  return _internal_count();
+}
+inline void LatencyDist::_internal_set_count(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  _impl_.count_ = value;
+}
+inline void LatencyDist::set_count(uint64_t value) {
+  _internal_set_count(value);
+  // @@protoc_insertion_point(field_set:dsnet.latency.format.LatencyDist.count)
+}
+
+// repeated uint32 buckets = 6;
+inline int LatencyDist::_internal_buckets_size() const {
+  return _impl_.buckets_.size();
+}
+inline int LatencyDist::buckets_size() const {
+  return _internal_buckets_size();
+}
+inline void LatencyDist::clear_buckets() {
+  _impl_.buckets_.Clear();
+}
+inline uint32_t LatencyDist::_internal_buckets(int index) const {
+  return _impl_.buckets_.Get(index);
+}
+inline uint32_t LatencyDist::buckets(int index) const {
+  // @@protoc_insertion_point(field_get:dsnet.latency.format.LatencyDist.buckets)
+  return _internal_buckets(index);
+}
+inline void LatencyDist::set_buckets(int index, uint32_t value) {
+  _impl_.buckets_.Set(index, value);
+  // @@protoc_insertion_point(field_set:dsnet.latency.format.LatencyDist.buckets)
+}
+inline void LatencyDist::_internal_add_buckets(uint32_t value) {
+  _impl_.buckets_.Add(value);
+}
+inline void LatencyDist::add_buckets(uint32_t value) {
+  _internal_add_buckets(value);
+  // @@protoc_insertion_point(field_add:dsnet.latency.format.LatencyDist.buckets)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+LatencyDist::_internal_buckets() const {
+  return _impl_.buckets_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+LatencyDist::buckets() const {
+  // @@protoc_insertion_point(field_list:dsnet.latency.format.LatencyDist.buckets)
+  return _internal_buckets();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+LatencyDist::_internal_mutable_buckets() {
+  return &_impl_.buckets_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+LatencyDist::mutable_buckets() {
+  // @@protoc_insertion_point(field_mutable_list:dsnet.latency.format.LatencyDist.buckets)
+  return _internal_mutable_buckets();
+}
+
+// -------------------------------------------------------------------
+
+// Latency
+
+// required string name = 1;
+inline bool Latency::_internal_has_name() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool Latency::has_name() const {
+  return _internal_has_name();
+}
+inline void Latency::clear_name() {
+  _impl_.name_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& Latency::name() const {
+  // @@protoc_insertion_point(field_get:dsnet.latency.format.Latency.name)
+  return _internal_name();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void Latency::set_name(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:dsnet.latency.format.Latency.name)
+}
+inline std::string* Latency::mutable_name() {
+  std::string* _s = _internal_mutable_name();
+  // @@protoc_insertion_point(field_mutable:dsnet.latency.format.Latency.name)
+  return _s;
+}
+inline const std::string& Latency::_internal_name() const {
+  return _impl_.name_.Get();
+}
+inline void Latency::_internal_set_name(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.name_.Set(value, GetArenaForAllocation());
+}
+inline std::string* Latency::_internal_mutable_name() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.name_.Mutable(GetArenaForAllocation());
+}
+inline std::string* Latency::release_name() {
+  // @@protoc_insertion_point(field_release:dsnet.latency.format.Latency.name)
+  if (!_internal_has_name()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.name_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.name_.IsDefault()) {
+    _impl_.name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void Latency::set_allocated_name(std::string* name) {
+  if (name != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.name_.SetAllocated(name, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.name_.IsDefault()) {
+    _impl_.name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:dsnet.latency.format.Latency.name)
+}
+
+// repeated .dsnet.latency.format.LatencyDist dists = 2;
+inline int Latency::_internal_dists_size() const {
+  return _impl_.dists_.size();
+}
+inline int Latency::dists_size() const {
+  return _internal_dists_size();
+}
+inline void Latency::clear_dists() {
+  _impl_.dists_.Clear();
+}
+inline ::dsnet::latency::format::LatencyDist* Latency::mutable_dists(int index) {
+  // @@protoc_insertion_point(field_mutable:dsnet.latency.format.Latency.dists)
+  return _impl_.dists_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::dsnet::latency::format::LatencyDist >*
+Latency::mutable_dists() {
+  // @@protoc_insertion_point(field_mutable_list:dsnet.latency.format.Latency.dists)
+  return &_impl_.dists_;
+}
+inline const ::dsnet::latency::format::LatencyDist& Latency::_internal_dists(int index) const {
+  return _impl_.dists_.Get(index);
+}
+inline const ::dsnet::latency::format::LatencyDist& Latency::dists(int index) const {
+  // @@protoc_insertion_point(field_get:dsnet.latency.format.Latency.dists)
+  return _internal_dists(index);
+}
+inline ::dsnet::latency::format::LatencyDist* Latency::_internal_add_dists() {
+  return _impl_.dists_.Add();
+}
+inline ::dsnet::latency::format::LatencyDist* Latency::add_dists() {
+  ::dsnet::latency::format::LatencyDist* _add = _internal_add_dists();
+  // @@protoc_insertion_point(field_add:dsnet.latency.format.Latency.dists)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::dsnet::latency::format::LatencyDist >&
+Latency::dists() const {
+  // @@protoc_insertion_point(field_list:dsnet.latency.format.Latency.dists)
+  return _impl_.dists_;
+}
+
+// -------------------------------------------------------------------
+
+// LatencyFile
+
+// repeated .dsnet.latency.format.Latency latencies = 1;
+inline int LatencyFile::_internal_latencies_size() const {
+  return _impl_.latencies_.size();
+}
+inline int LatencyFile::latencies_size() const {
+  return _internal_latencies_size();
+}
+inline void LatencyFile::clear_latencies() {
+  _impl_.latencies_.Clear();
+}
+inline ::dsnet::latency::format::Latency* LatencyFile::mutable_latencies(int index) {
+  // @@protoc_insertion_point(field_mutable:dsnet.latency.format.LatencyFile.latencies)
+  return _impl_.latencies_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::dsnet::latency::format::Latency >*
+LatencyFile::mutable_latencies() {
+  // @@protoc_insertion_point(field_mutable_list:dsnet.latency.format.LatencyFile.latencies)
+  return &_impl_.latencies_;
+}
+inline const ::dsnet::latency::format::Latency& LatencyFile::_internal_latencies(int index) const {
+  return _impl_.latencies_.Get(index);
+}
+inline const ::dsnet::latency::format::Latency& LatencyFile::latencies(int index) const {
+  // @@protoc_insertion_point(field_get:dsnet.latency.format.LatencyFile.latencies)
+  return _internal_latencies(index);
+}
+inline ::dsnet::latency::format::Latency* LatencyFile::_internal_add_latencies() {
+  return _impl_.latencies_.Add();
+}
+inline ::dsnet::latency::format::Latency* LatencyFile::add_latencies() {
+  ::dsnet::latency::format::Latency* _add = _internal_add_latencies();
+  // @@protoc_insertion_point(field_add:dsnet.latency.format.LatencyFile.latencies)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::dsnet::latency::format::Latency >&
+LatencyFile::latencies() const {
+  // @@protoc_insertion_point(field_list:dsnet.latency.format.LatencyFile.latencies)
+  return _impl_.latencies_;
+}
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic pop
+#endif  // __GNUC__
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+
+// @@protoc_insertion_point(namespace_scope)
+
+}  // namespace format
+}  // namespace latency
+}  // namespace dsnet
+
+// @@protoc_insertion_point(global_scope)
+
+#include <google/protobuf/port_undef.inc>
+#endif  // GOOGLE_PROTOBUF_INCLUDED_GOOGLE_PROTOBUF_INCLUDED_lib_2flatency_2dformat_2eproto
@@ -0,0 +1,852 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: nistore/request.proto
+
+#ifndef GOOGLE_PROTOBUF_INCLUDED_nistore_2frequest_2eproto
+#define GOOGLE_PROTOBUF_INCLUDED_nistore_2frequest_2eproto
+
+#include <limits>
+#include <string>
+
+#include <google/protobuf/port_def.inc>
+#if PROTOBUF_VERSION < 3021000
+#error This file was generated by a newer version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please update
+#error your headers.
+#endif
+#if 3021012 < PROTOBUF_MIN_PROTOC_VERSION
+#error This file was generated by an older version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please
+#error regenerate this file with a newer version of protoc.
+#endif
+
+#include <google/protobuf/port_undef.inc>
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/arena.h>
+#include <google/protobuf/arenastring.h>
+#include <google/protobuf/generated_message_util.h>
+#include <google/protobuf/metadata_lite.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/message.h>
+#include <google/protobuf/repeated_field.h>  // IWYU pragma: export
+#include <google/protobuf/extension_set.h>  // IWYU pragma: export
+#include <google/protobuf/generated_enum_reflection.h>
+#include <google/protobuf/unknown_field_set.h>
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+#define PROTOBUF_INTERNAL_EXPORT_nistore_2frequest_2eproto
+PROTOBUF_NAMESPACE_OPEN
+namespace internal {
+class AnyMetadata;
+}  // namespace internal
+PROTOBUF_NAMESPACE_CLOSE
+
+// Internal implementation detail -- do not use these members.
+struct TableStruct_nistore_2frequest_2eproto {
+  static const uint32_t offsets[];
+};
+extern const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_nistore_2frequest_2eproto;
+namespace nistore {
+class Reply;
+struct ReplyDefaultTypeInternal;
+extern ReplyDefaultTypeInternal _Reply_default_instance_;
+class Request;
+struct RequestDefaultTypeInternal;
+extern RequestDefaultTypeInternal _Request_default_instance_;
+}  // namespace nistore
+PROTOBUF_NAMESPACE_OPEN
+template<> ::nistore::Reply* Arena::CreateMaybeMessage<::nistore::Reply>(Arena*);
+template<> ::nistore::Request* Arena::CreateMaybeMessage<::nistore::Request>(Arena*);
+PROTOBUF_NAMESPACE_CLOSE
+namespace nistore {
+
+enum Request_Operation : int {
+  Request_Operation_BEGIN = 1,
+  Request_Operation_GET = 2,
+  Request_Operation_PUT = 3,
+  Request_Operation_PREPARE = 4,
+  Request_Operation_COMMIT = 5,
+  Request_Operation_ABORT = 6
+};
+bool Request_Operation_IsValid(int value);
+constexpr Request_Operation Request_Operation_Operation_MIN = Request_Operation_BEGIN;
+constexpr Request_Operation Request_Operation_Operation_MAX = Request_Operation_ABORT;
+constexpr int Request_Operation_Operation_ARRAYSIZE = Request_Operation_Operation_MAX + 1;
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* Request_Operation_descriptor();
+template<typename T>
+inline const std::string& Request_Operation_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, Request_Operation>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function Request_Operation_Name.");
+  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
+    Request_Operation_descriptor(), enum_t_value);
+}
+inline bool Request_Operation_Parse(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, Request_Operation* value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<Request_Operation>(
+    Request_Operation_descriptor(), name, value);
+}
+// ===================================================================
+
+class Request final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:nistore.Request) */ {
+ public:
+  inline Request() : Request(nullptr) {}
+  ~Request() override;
+  explicit PROTOBUF_CONSTEXPR Request(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  Request(const Request& from);
+  Request(Request&& from) noexcept
+    : Request() {
+    *this = ::std::move(from);
+  }
+
+  inline Request& operator=(const Request& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline Request& operator=(Request&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const Request& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const Request* internal_default_instance() {
+    return reinterpret_cast<const Request*>(
+               &_Request_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    0;
+
+  friend void swap(Request& a, Request& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(Request* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Request* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  Request* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<Request>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const Request& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const Request& from) {
+    Request::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(Request* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "nistore.Request";
+  }
+  protected:
+  explicit Request(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  typedef Request_Operation Operation;
+  static constexpr Operation BEGIN =
+    Request_Operation_BEGIN;
+  static constexpr Operation GET =
+    Request_Operation_GET;
+  static constexpr Operation PUT =
+    Request_Operation_PUT;
+  static constexpr Operation PREPARE =
+    Request_Operation_PREPARE;
+  static constexpr Operation COMMIT =
+    Request_Operation_COMMIT;
+  static constexpr Operation ABORT =
+    Request_Operation_ABORT;
+  static inline bool Operation_IsValid(int value) {
+    return Request_Operation_IsValid(value);
+  }
+  static constexpr Operation Operation_MIN =
+    Request_Operation_Operation_MIN;
+  static constexpr Operation Operation_MAX =
+    Request_Operation_Operation_MAX;
+  static constexpr int Operation_ARRAYSIZE =
+    Request_Operation_Operation_ARRAYSIZE;
+  static inline const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor*
+  Operation_descriptor() {
+    return Request_Operation_descriptor();
+  }
+  template<typename T>
+  static inline const std::string& Operation_Name(T enum_t_value) {
+    static_assert(::std::is_same<T, Operation>::value ||
+      ::std::is_integral<T>::value,
+      "Incorrect type passed to function Operation_Name.");
+    return Request_Operation_Name(enum_t_value);
+  }
+  static inline bool Operation_Parse(::PROTOBUF_NAMESPACE_ID::ConstStringParam name,
+      Operation* value) {
+    return Request_Operation_Parse(name, value);
+  }
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kArg0FieldNumber = 3,
+    kArg1FieldNumber = 4,
+    kTxnidFieldNumber = 2,
+    kOpFieldNumber = 1,
+  };
+  // optional string arg0 = 3;
+  bool has_arg0() const;
+  private:
+  bool _internal_has_arg0() const;
+  public:
+  void clear_arg0();
+  const std::string& arg0() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_arg0(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_arg0();
+  PROTOBUF_NODISCARD std::string* release_arg0();
+  void set_allocated_arg0(std::string* arg0);
+  private:
+  const std::string& _internal_arg0() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_arg0(const std::string& value);
+  std::string* _internal_mutable_arg0();
+  public:
+
+  // optional string arg1 = 4;
+  bool has_arg1() const;
+  private:
+  bool _internal_has_arg1() const;
+  public:
+  void clear_arg1();
+  const std::string& arg1() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_arg1(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_arg1();
+  PROTOBUF_NODISCARD std::string* release_arg1();
+  void set_allocated_arg1(std::string* arg1);
+  private:
+  const std::string& _internal_arg1() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_arg1(const std::string& value);
+  std::string* _internal_mutable_arg1();
+  public:
+
+  // required uint64 txnid = 2;
+  bool has_txnid() const;
+  private:
+  bool _internal_has_txnid() const;
+  public:
+  void clear_txnid();
+  uint64_t txnid() const;
+  void set_txnid(uint64_t value);
+  private:
+  uint64_t _internal_txnid() const;
+  void _internal_set_txnid(uint64_t value);
+  public:
+
+  // required .nistore.Request.Operation op = 1;
+  bool has_op() const;
+  private:
+  bool _internal_has_op() const;
+  public:
+  void clear_op();
+  ::nistore::Request_Operation op() const;
+  void set_op(::nistore::Request_Operation value);
+  private:
+  ::nistore::Request_Operation _internal_op() const;
+  void _internal_set_op(::nistore::Request_Operation value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:nistore.Request)
+ private:
+  class _Internal;
+
+  // helper for ByteSizeLong()
+  size_t RequiredFieldsByteSizeFallback() const;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr arg0_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr arg1_;
+    uint64_t txnid_;
+    int op_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_nistore_2frequest_2eproto;
+};
+// -------------------------------------------------------------------
+
+class Reply final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:nistore.Reply) */ {
+ public:
+  inline Reply() : Reply(nullptr) {}
+  ~Reply() override;
+  explicit PROTOBUF_CONSTEXPR Reply(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  Reply(const Reply& from);
+  Reply(Reply&& from) noexcept
+    : Reply() {
+    *this = ::std::move(from);
+  }
+
+  inline Reply& operator=(const Reply& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline Reply& operator=(Reply&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const Reply& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const Reply* internal_default_instance() {
+    return reinterpret_cast<const Reply*>(
+               &_Reply_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    1;
+
+  friend void swap(Reply& a, Reply& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(Reply* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Reply* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  Reply* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<Reply>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const Reply& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const Reply& from) {
+    Reply::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(Reply* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "nistore.Reply";
+  }
+  protected:
+  explicit Reply(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kValueFieldNumber = 2,
+    kStatusFieldNumber = 1,
+  };
+  // optional string value = 2;
+  bool has_value() const;
+  private:
+  bool _internal_has_value() const;
+  public:
+  void clear_value();
+  const std::string& value() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_value(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_value();
+  PROTOBUF_NODISCARD std::string* release_value();
+  void set_allocated_value(std::string* value);
+  private:
+  const std::string& _internal_value() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_value(const std::string& value);
+  std::string* _internal_mutable_value();
+  public:
+
+  // required int32 status = 1;
+  bool has_status() const;
+  private:
+  bool _internal_has_status() const;
+  public:
+  void clear_status();
+  int32_t status() const;
+  void set_status(int32_t value);
+  private:
+  int32_t _internal_status() const;
+  void _internal_set_status(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:nistore.Reply)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr value_;
+    int32_t status_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_nistore_2frequest_2eproto;
+};
+// ===================================================================
+
+
+// ===================================================================
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
+#endif  // __GNUC__
+// Request
+
+// required .nistore.Request.Operation op = 1;
+inline bool Request::_internal_has_op() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  return value;
+}
+inline bool Request::has_op() const {
+  return _internal_has_op();
+}
+inline void Request::clear_op() {
+  _impl_.op_ = 1;
+  _impl_._has_bits_[0] &= ~0x00000008u;
+}
+inline ::nistore::Request_Operation Request::_internal_op() const {
+  return static_cast< ::nistore::Request_Operation >(_impl_.op_);
+}
+inline ::nistore::Request_Operation Request::op() const {
+  // @@protoc_insertion_point(field_get:nistore.Request.op)
+  return _internal_op();
+}
+inline void Request::_internal_set_op(::nistore::Request_Operation value) {
+  assert(::nistore::Request_Operation_IsValid(value));
+  _impl_._has_bits_[0] |= 0x00000008u;
+  _impl_.op_ = value;
+}
+inline void Request::set_op(::nistore::Request_Operation value) {
+  _internal_set_op(value);
+  // @@protoc_insertion_point(field_set:nistore.Request.op)
+}
+
+// required uint64 txnid = 2;
+inline bool Request::_internal_has_txnid() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool Request::has_txnid() const {
+  return _internal_has_txnid();
+}
+inline void Request::clear_txnid() {
+  _impl_.txnid_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline uint64_t Request::_internal_txnid() const {
+  return _impl_.txnid_;
+}
+inline uint64_t Request::txnid() const {
+  // @@protoc_insertion_point(field_get:nistore.Request.txnid)
+  return _internal_txnid();
+}
+inline void Request::_internal_set_txnid(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.txnid_ = value;
+}
+inline void Request::set_txnid(uint64_t value) {
+  _internal_set_txnid(value);
+  // @@protoc_insertion_point(field_set:nistore.Request.txnid)
+}
+
+// optional string arg0 = 3;
+inline bool Request::_internal_has_arg0() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool Request::has_arg0() const {
+  return _internal_has_arg0();
+}
+inline void Request::clear_arg0() {
+  _impl_.arg0_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& Request::arg0() const {
+  // @@protoc_insertion_point(field_get:nistore.Request.arg0)
+  return _internal_arg0();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void Request::set_arg0(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.arg0_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:nistore.Request.arg0)
+}
+inline std::string* Request::mutable_arg0() {
+  std::string* _s = _internal_mutable_arg0();
+  // @@protoc_insertion_point(field_mutable:nistore.Request.arg0)
+  return _s;
+}
+inline const std::string& Request::_internal_arg0() const {
+  return _impl_.arg0_.Get();
+}
+inline void Request::_internal_set_arg0(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.arg0_.Set(value, GetArenaForAllocation());
+}
+inline std::string* Request::_internal_mutable_arg0() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.arg0_.Mutable(GetArenaForAllocation());
+}
+inline std::string* Request::release_arg0() {
+  // @@protoc_insertion_point(field_release:nistore.Request.arg0)
+  if (!_internal_has_arg0()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.arg0_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.arg0_.IsDefault()) {
+    _impl_.arg0_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void Request::set_allocated_arg0(std::string* arg0) {
+  if (arg0 != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.arg0_.SetAllocated(arg0, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.arg0_.IsDefault()) {
+    _impl_.arg0_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:nistore.Request.arg0)
+}
+
+// optional string arg1 = 4;
+inline bool Request::_internal_has_arg1() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool Request::has_arg1() const {
+  return _internal_has_arg1();
+}
+inline void Request::clear_arg1() {
+  _impl_.arg1_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline const std::string& Request::arg1() const {
+  // @@protoc_insertion_point(field_get:nistore.Request.arg1)
+  return _internal_arg1();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void Request::set_arg1(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000002u;
+ _impl_.arg1_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:nistore.Request.arg1)
+}
+inline std::string* Request::mutable_arg1() {
+  std::string* _s = _internal_mutable_arg1();
+  // @@protoc_insertion_point(field_mutable:nistore.Request.arg1)
+  return _s;
+}
+inline const std::string& Request::_internal_arg1() const {
+  return _impl_.arg1_.Get();
+}
+inline void Request::_internal_set_arg1(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.arg1_.Set(value, GetArenaForAllocation());
+}
+inline std::string* Request::_internal_mutable_arg1() {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  return _impl_.arg1_.Mutable(GetArenaForAllocation());
+}
+inline std::string* Request::release_arg1() {
+  // @@protoc_insertion_point(field_release:nistore.Request.arg1)
+  if (!_internal_has_arg1()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  auto* p = _impl_.arg1_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.arg1_.IsDefault()) {
+    _impl_.arg1_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void Request::set_allocated_arg1(std::string* arg1) {
+  if (arg1 != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  _impl_.arg1_.SetAllocated(arg1, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.arg1_.IsDefault()) {
+    _impl_.arg1_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:nistore.Request.arg1)
+}
+
+// -------------------------------------------------------------------
+
+// Reply
+
+// required int32 status = 1;
+inline bool Reply::_internal_has_status() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool Reply::has_status() const {
+  return _internal_has_status();
+}
+inline void Reply::clear_status() {
+  _impl_.status_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline int32_t Reply::_internal_status() const {
+  return _impl_.status_;
+}
+inline int32_t Reply::status() const {
+  // @@protoc_insertion_point(field_get:nistore.Reply.status)
+  return _internal_status();
+}
+inline void Reply::_internal_set_status(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.status_ = value;
+}
+inline void Reply::set_status(int32_t value) {
+  _internal_set_status(value);
+  // @@protoc_insertion_point(field_set:nistore.Reply.status)
+}
+
+// optional string value = 2;
+inline bool Reply::_internal_has_value() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool Reply::has_value() const {
+  return _internal_has_value();
+}
+inline void Reply::clear_value() {
+  _impl_.value_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& Reply::value() const {
+  // @@protoc_insertion_point(field_get:nistore.Reply.value)
+  return _internal_value();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void Reply::set_value(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.value_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:nistore.Reply.value)
+}
+inline std::string* Reply::mutable_value() {
+  std::string* _s = _internal_mutable_value();
+  // @@protoc_insertion_point(field_mutable:nistore.Reply.value)
+  return _s;
+}
+inline const std::string& Reply::_internal_value() const {
+  return _impl_.value_.Get();
+}
+inline void Reply::_internal_set_value(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.value_.Set(value, GetArenaForAllocation());
+}
+inline std::string* Reply::_internal_mutable_value() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.value_.Mutable(GetArenaForAllocation());
+}
+inline std::string* Reply::release_value() {
+  // @@protoc_insertion_point(field_release:nistore.Reply.value)
+  if (!_internal_has_value()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.value_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.value_.IsDefault()) {
+    _impl_.value_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void Reply::set_allocated_value(std::string* value) {
+  if (value != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.value_.SetAllocated(value, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.value_.IsDefault()) {
+    _impl_.value_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:nistore.Reply.value)
+}
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic pop
+#endif  // __GNUC__
+// -------------------------------------------------------------------
+
+
+// @@protoc_insertion_point(namespace_scope)
+
+}  // namespace nistore
+
+PROTOBUF_NAMESPACE_OPEN
+
+template <> struct is_proto_enum< ::nistore::Request_Operation> : ::std::true_type {};
+template <>
+inline const EnumDescriptor* GetEnumDescriptor< ::nistore::Request_Operation>() {
+  return ::nistore::Request_Operation_descriptor();
+}
+
+PROTOBUF_NAMESPACE_CLOSE
+
+// @@protoc_insertion_point(global_scope)
+
+#include <google/protobuf/port_undef.inc>
+#endif  // GOOGLE_PROTOBUF_INCLUDED_GOOGLE_PROTOBUF_INCLUDED_nistore_2frequest_2eproto
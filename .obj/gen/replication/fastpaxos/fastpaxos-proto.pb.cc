@@ -0,0 +1,3986 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: replication/fastpaxos/fastpaxos-proto.proto
+
+#include "replication/fastpaxos/fastpaxos-proto.pb.h"
+
+#include <algorithm>
+
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/extension_set.h>
+#include <google/protobuf/wire_format_lite.h>
+#include <google/protobuf/descriptor.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/reflection_ops.h>
+#include <google/protobuf/wire_format.h>
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+
+PROTOBUF_PRAGMA_INIT_SEG
+
+namespace _pb = ::PROTOBUF_NAMESPACE_ID;
+namespace _pbi = _pb::internal;
+
+namespace dsnet {
+namespace fastpaxos {
+namespace proto {
+PROTOBUF_CONSTEXPR ReplyMessage::ReplyMessage(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.reply_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.view_)*/uint64_t{0u}
+  , /*decltype(_impl_.opnum_)*/uint64_t{0u}
+  , /*decltype(_impl_.clientreqid_)*/uint64_t{0u}} {}
+struct ReplyMessageDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ReplyMessageDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ReplyMessageDefaultTypeInternal() {}
+  union {
+    ReplyMessage _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ReplyMessageDefaultTypeInternal _ReplyMessage_default_instance_;
+PROTOBUF_CONSTEXPR UnloggedReplyMessage::UnloggedReplyMessage(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.reply_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}} {}
+struct UnloggedReplyMessageDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR UnloggedReplyMessageDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~UnloggedReplyMessageDefaultTypeInternal() {}
+  union {
+    UnloggedReplyMessage _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 UnloggedReplyMessageDefaultTypeInternal _UnloggedReplyMessage_default_instance_;
+PROTOBUF_CONSTEXPR ToClientMessage::ToClientMessage(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.msg_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_._oneof_case_)*/{}} {}
+struct ToClientMessageDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ToClientMessageDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ToClientMessageDefaultTypeInternal() {}
+  union {
+    ToClientMessage _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ToClientMessageDefaultTypeInternal _ToClientMessage_default_instance_;
+PROTOBUF_CONSTEXPR RequestMessage::RequestMessage(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.req_)*/nullptr} {}
+struct RequestMessageDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR RequestMessageDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~RequestMessageDefaultTypeInternal() {}
+  union {
+    RequestMessage _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 RequestMessageDefaultTypeInternal _RequestMessage_default_instance_;
+PROTOBUF_CONSTEXPR UnloggedRequestMessage::UnloggedRequestMessage(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.req_)*/nullptr} {}
+struct UnloggedRequestMessageDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR UnloggedRequestMessageDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~UnloggedRequestMessageDefaultTypeInternal() {}
+  union {
+    UnloggedRequestMessage _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 UnloggedRequestMessageDefaultTypeInternal _UnloggedRequestMessage_default_instance_;
+PROTOBUF_CONSTEXPR PrepareOKMessage::PrepareOKMessage(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.req_)*/nullptr
+  , /*decltype(_impl_.view_)*/uint64_t{0u}
+  , /*decltype(_impl_.opnum_)*/uint64_t{0u}
+  , /*decltype(_impl_.replicaidx_)*/0u
+  , /*decltype(_impl_.slowpath_)*/0u} {}
+struct PrepareOKMessageDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR PrepareOKMessageDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~PrepareOKMessageDefaultTypeInternal() {}
+  union {
+    PrepareOKMessage _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 PrepareOKMessageDefaultTypeInternal _PrepareOKMessage_default_instance_;
+PROTOBUF_CONSTEXPR PrepareMessage::PrepareMessage(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.req_)*/nullptr
+  , /*decltype(_impl_.view_)*/uint64_t{0u}
+  , /*decltype(_impl_.opnum_)*/uint64_t{0u}} {}
+struct PrepareMessageDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR PrepareMessageDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~PrepareMessageDefaultTypeInternal() {}
+  union {
+    PrepareMessage _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 PrepareMessageDefaultTypeInternal _PrepareMessage_default_instance_;
+PROTOBUF_CONSTEXPR CommitMessage::CommitMessage(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.req_)*/nullptr
+  , /*decltype(_impl_.view_)*/uint64_t{0u}
+  , /*decltype(_impl_.opnum_)*/uint64_t{0u}} {}
+struct CommitMessageDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR CommitMessageDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~CommitMessageDefaultTypeInternal() {}
+  union {
+    CommitMessage _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 CommitMessageDefaultTypeInternal _CommitMessage_default_instance_;
+PROTOBUF_CONSTEXPR RequestStateTransferMessage::RequestStateTransferMessage(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.view_)*/uint64_t{0u}
+  , /*decltype(_impl_.opnum_)*/uint64_t{0u}} {}
+struct RequestStateTransferMessageDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR RequestStateTransferMessageDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~RequestStateTransferMessageDefaultTypeInternal() {}
+  union {
+    RequestStateTransferMessage _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 RequestStateTransferMessageDefaultTypeInternal _RequestStateTransferMessage_default_instance_;
+PROTOBUF_CONSTEXPR StateTransferMessage::StateTransferMessage(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.entries_)*/{}
+  , /*decltype(_impl_.view_)*/uint64_t{0u}
+  , /*decltype(_impl_.opnum_)*/uint64_t{0u}
+  , /*decltype(_impl_.lastop_)*/uint64_t{0u}} {}
+struct StateTransferMessageDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR StateTransferMessageDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~StateTransferMessageDefaultTypeInternal() {}
+  union {
+    StateTransferMessage _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 StateTransferMessageDefaultTypeInternal _StateTransferMessage_default_instance_;
+PROTOBUF_CONSTEXPR ToReplicaMessage::ToReplicaMessage(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.msg_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_._oneof_case_)*/{}} {}
+struct ToReplicaMessageDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ToReplicaMessageDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ToReplicaMessageDefaultTypeInternal() {}
+  union {
+    ToReplicaMessage _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ToReplicaMessageDefaultTypeInternal _ToReplicaMessage_default_instance_;
+}  // namespace proto
+}  // namespace fastpaxos
+}  // namespace dsnet
+static ::_pb::Metadata file_level_metadata_replication_2ffastpaxos_2ffastpaxos_2dproto_2eproto[11];
+static constexpr ::_pb::EnumDescriptor const** file_level_enum_descriptors_replication_2ffastpaxos_2ffastpaxos_2dproto_2eproto = nullptr;
+static constexpr ::_pb::ServiceDescriptor const** file_level_service_descriptors_replication_2ffastpaxos_2ffastpaxos_2dproto_2eproto = nullptr;
+
+const uint32_t TableStruct_replication_2ffastpaxos_2ffastpaxos_2dproto_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  PROTOBUF_FIELD_OFFSET(::dsnet::fastpaxos::proto::ReplyMessage, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::fastpaxos::proto::ReplyMessage, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::dsnet::fastpaxos::proto::ReplyMessage, _impl_.view_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::fastpaxos::proto::ReplyMessage, _impl_.opnum_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::fastpaxos::proto::ReplyMessage, _impl_.reply_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::fastpaxos::proto::ReplyMessage, _impl_.clientreqid_),
+  1,
+  2,
+  0,
+  3,
+  PROTOBUF_FIELD_OFFSET(::dsnet::fastpaxos::proto::UnloggedReplyMessage, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::fastpaxos::proto::UnloggedReplyMessage, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::dsnet::fastpaxos::proto::UnloggedReplyMessage, _impl_.reply_),
+  0,
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::dsnet::fastpaxos::proto::ToClientMessage, _internal_metadata_),
+  ~0u,  // no _extensions_
+  PROTOBUF_FIELD_OFFSET(::dsnet::fastpaxos::proto::ToClientMessage, _impl_._oneof_case_[0]),
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  PROTOBUF_FIELD_OFFSET(::dsnet::fastpaxos::proto::ToClientMessage, _impl_.msg_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::fastpaxos::proto::RequestMessage, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::fastpaxos::proto::RequestMessage, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::dsnet::fastpaxos::proto::RequestMessage, _impl_.req_),
+  0,
+  PROTOBUF_FIELD_OFFSET(::dsnet::fastpaxos::proto::UnloggedRequestMessage, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::fastpaxos::proto::UnloggedRequestMessage, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::dsnet::fastpaxos::proto::UnloggedRequestMessage, _impl_.req_),
+  0,
+  PROTOBUF_FIELD_OFFSET(::dsnet::fastpaxos::proto::PrepareOKMessage, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::fastpaxos::proto::PrepareOKMessage, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::dsnet::fastpaxos::proto::PrepareOKMessage, _impl_.view_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::fastpaxos::proto::PrepareOKMessage, _impl_.opnum_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::fastpaxos::proto::PrepareOKMessage, _impl_.replicaidx_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::fastpaxos::proto::PrepareOKMessage, _impl_.req_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::fastpaxos::proto::PrepareOKMessage, _impl_.slowpath_),
+  1,
+  2,
+  3,
+  0,
+  4,
+  PROTOBUF_FIELD_OFFSET(::dsnet::fastpaxos::proto::PrepareMessage, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::fastpaxos::proto::PrepareMessage, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::dsnet::fastpaxos::proto::PrepareMessage, _impl_.view_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::fastpaxos::proto::PrepareMessage, _impl_.opnum_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::fastpaxos::proto::PrepareMessage, _impl_.req_),
+  1,
+  2,
+  0,
+  PROTOBUF_FIELD_OFFSET(::dsnet::fastpaxos::proto::CommitMessage, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::fastpaxos::proto::CommitMessage, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::dsnet::fastpaxos::proto::CommitMessage, _impl_.view_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::fastpaxos::proto::CommitMessage, _impl_.opnum_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::fastpaxos::proto::CommitMessage, _impl_.req_),
+  1,
+  2,
+  0,
+  PROTOBUF_FIELD_OFFSET(::dsnet::fastpaxos::proto::RequestStateTransferMessage, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::fastpaxos::proto::RequestStateTransferMessage, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::dsnet::fastpaxos::proto::RequestStateTransferMessage, _impl_.view_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::fastpaxos::proto::RequestStateTransferMessage, _impl_.opnum_),
+  0,
+  1,
+  PROTOBUF_FIELD_OFFSET(::dsnet::fastpaxos::proto::StateTransferMessage, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::fastpaxos::proto::StateTransferMessage, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::dsnet::fastpaxos::proto::StateTransferMessage, _impl_.view_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::fastpaxos::proto::StateTransferMessage, _impl_.opnum_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::fastpaxos::proto::StateTransferMessage, _impl_.entries_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::fastpaxos::proto::StateTransferMessage, _impl_.lastop_),
+  0,
+  1,
+  ~0u,
+  2,
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::dsnet::fastpaxos::proto::ToReplicaMessage, _internal_metadata_),
+  ~0u,  // no _extensions_
+  PROTOBUF_FIELD_OFFSET(::dsnet::fastpaxos::proto::ToReplicaMessage, _impl_._oneof_case_[0]),
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  PROTOBUF_FIELD_OFFSET(::dsnet::fastpaxos::proto::ToReplicaMessage, _impl_.msg_),
+};
+static const ::_pbi::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  { 0, 10, -1, sizeof(::dsnet::fastpaxos::proto::ReplyMessage)},
+  { 14, 21, -1, sizeof(::dsnet::fastpaxos::proto::UnloggedReplyMessage)},
+  { 22, -1, -1, sizeof(::dsnet::fastpaxos::proto::ToClientMessage)},
+  { 31, 38, -1, sizeof(::dsnet::fastpaxos::proto::RequestMessage)},
+  { 39, 46, -1, sizeof(::dsnet::fastpaxos::proto::UnloggedRequestMessage)},
+  { 47, 58, -1, sizeof(::dsnet::fastpaxos::proto::PrepareOKMessage)},
+  { 63, 72, -1, sizeof(::dsnet::fastpaxos::proto::PrepareMessage)},
+  { 75, 84, -1, sizeof(::dsnet::fastpaxos::proto::CommitMessage)},
+  { 87, 95, -1, sizeof(::dsnet::fastpaxos::proto::RequestStateTransferMessage)},
+  { 97, 107, -1, sizeof(::dsnet::fastpaxos::proto::StateTransferMessage)},
+  { 111, -1, -1, sizeof(::dsnet::fastpaxos::proto::ToReplicaMessage)},
+};
+
+static const ::_pb::Message* const file_default_instances[] = {
+  &::dsnet::fastpaxos::proto::_ReplyMessage_default_instance_._instance,
+  &::dsnet::fastpaxos::proto::_UnloggedReplyMessage_default_instance_._instance,
+  &::dsnet::fastpaxos::proto::_ToClientMessage_default_instance_._instance,
+  &::dsnet::fastpaxos::proto::_RequestMessage_default_instance_._instance,
+  &::dsnet::fastpaxos::proto::_UnloggedRequestMessage_default_instance_._instance,
+  &::dsnet::fastpaxos::proto::_PrepareOKMessage_default_instance_._instance,
+  &::dsnet::fastpaxos::proto::_PrepareMessage_default_instance_._instance,
+  &::dsnet::fastpaxos::proto::_CommitMessage_default_instance_._instance,
+  &::dsnet::fastpaxos::proto::_RequestStateTransferMessage_default_instance_._instance,
+  &::dsnet::fastpaxos::proto::_StateTransferMessage_default_instance_._instance,
+  &::dsnet::fastpaxos::proto::_ToReplicaMessage_default_instance_._instance,
+};
+
+const char descriptor_table_protodef_replication_2ffastpaxos_2ffastpaxos_2dproto_2eproto[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) =
+  "\n+replication/fastpaxos/fastpaxos-proto."
+  "proto\022\025dsnet.fastpaxos.proto\032\024common/req"
+  "uest.proto\"O\n\014ReplyMessage\022\014\n\004view\030\001 \002(\004"
+  "\022\r\n\005opnum\030\002 \002(\004\022\r\n\005reply\030\003 \002(\014\022\023\n\013client"
+  "reqid\030\004 \002(\004\"%\n\024UnloggedReplyMessage\022\r\n\005r"
+  "eply\030\001 \002(\014\"\225\001\n\017ToClientMessage\0224\n\005reply\030"
+  "\001 \001(\0132#.dsnet.fastpaxos.proto.ReplyMessa"
+  "geH\000\022E\n\016unlogged_reply\030\002 \001(\0132+.dsnet.fas"
+  "tpaxos.proto.UnloggedReplyMessageH\000B\005\n\003m"
+  "sg\"-\n\016RequestMessage\022\033\n\003req\030\001 \002(\0132\016.dsne"
+  "t.Request\"=\n\026UnloggedRequestMessage\022#\n\003r"
+  "eq\030\001 \002(\0132\026.dsnet.UnloggedRequest\"r\n\020Prep"
+  "areOKMessage\022\014\n\004view\030\001 \002(\004\022\r\n\005opnum\030\002 \002("
+  "\004\022\022\n\nreplicaIdx\030\003 \002(\r\022\033\n\003req\030\004 \002(\0132\016.dsn"
+  "et.Request\022\020\n\010slowpath\030\005 \002(\r\"J\n\016PrepareM"
+  "essage\022\014\n\004view\030\001 \002(\004\022\r\n\005opnum\030\002 \002(\004\022\033\n\003r"
+  "eq\030\003 \002(\0132\016.dsnet.Request\"I\n\rCommitMessag"
+  "e\022\014\n\004view\030\001 \002(\004\022\r\n\005opnum\030\002 \002(\004\022\033\n\003req\030\003 "
+  "\002(\0132\016.dsnet.Request\":\n\033RequestStateTrans"
+  "ferMessage\022\014\n\004view\030\001 \002(\004\022\r\n\005opnum\030\002 \002(\004\""
+  "h\n\024StateTransferMessage\022\014\n\004view\030\001 \002(\004\022\r\n"
+  "\005opnum\030\002 \002(\004\022#\n\007entries\030\003 \003(\0132\022.dsnet.Ms"
+  "gLogEntry\022\016\n\006lastop\030\004 \002(\004\"\354\003\n\020ToReplicaM"
+  "essage\0228\n\007request\030\001 \001(\0132%.dsnet.fastpaxo"
+  "s.proto.RequestMessageH\000\022I\n\020unlogged_req"
+  "uest\030\002 \001(\0132-.dsnet.fastpaxos.proto.Unlog"
+  "gedRequestMessageH\000\0228\n\007prepare\030\003 \001(\0132%.d"
+  "snet.fastpaxos.proto.PrepareMessageH\000\022=\n"
+  "\nprepare_ok\030\004 \001(\0132\'.dsnet.fastpaxos.prot"
+  "o.PrepareOKMessageH\000\0226\n\006commit\030\005 \001(\0132$.d"
+  "snet.fastpaxos.proto.CommitMessageH\000\022T\n\026"
+  "request_state_transfer\030\006 \001(\01322.dsnet.fas"
+  "tpaxos.proto.RequestStateTransferMessage"
+  "H\000\022E\n\016state_transfer\030\007 \001(\0132+.dsnet.fastp"
+  "axos.proto.StateTransferMessageH\000B\005\n\003msg"
+  ;
+static const ::_pbi::DescriptorTable* const descriptor_table_replication_2ffastpaxos_2ffastpaxos_2dproto_2eproto_deps[1] = {
+  &::descriptor_table_common_2frequest_2eproto,
+};
+static ::_pbi::once_flag descriptor_table_replication_2ffastpaxos_2ffastpaxos_2dproto_2eproto_once;
+const ::_pbi::DescriptorTable descriptor_table_replication_2ffastpaxos_2ffastpaxos_2dproto_2eproto = {
+    false, false, 1400, descriptor_table_protodef_replication_2ffastpaxos_2ffastpaxos_2dproto_2eproto,
+    "replication/fastpaxos/fastpaxos-proto.proto",
+    &descriptor_table_replication_2ffastpaxos_2ffastpaxos_2dproto_2eproto_once, descriptor_table_replication_2ffastpaxos_2ffastpaxos_2dproto_2eproto_deps, 1, 11,
+    schemas, file_default_instances, TableStruct_replication_2ffastpaxos_2ffastpaxos_2dproto_2eproto::offsets,
+    file_level_metadata_replication_2ffastpaxos_2ffastpaxos_2dproto_2eproto, file_level_enum_descriptors_replication_2ffastpaxos_2ffastpaxos_2dproto_2eproto,
+    file_level_service_descriptors_replication_2ffastpaxos_2ffastpaxos_2dproto_2eproto,
+};
+PROTOBUF_ATTRIBUTE_WEAK const ::_pbi::DescriptorTable* descriptor_table_replication_2ffastpaxos_2ffastpaxos_2dproto_2eproto_getter() {
+  return &descriptor_table_replication_2ffastpaxos_2ffastpaxos_2dproto_2eproto;
+}
+
+// Force running AddDescriptors() at dynamic initialization time.
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 static ::_pbi::AddDescriptorsRunner dynamic_init_dummy_replication_2ffastpaxos_2ffastpaxos_2dproto_2eproto(&descriptor_table_replication_2ffastpaxos_2ffastpaxos_2dproto_2eproto);
+namespace dsnet {
+namespace fastpaxos {
+namespace proto {
+
+// ===================================================================
+
+class ReplyMessage::_Internal {
+ public:
+  using HasBits = decltype(std::declval<ReplyMessage>()._impl_._has_bits_);
+  static void set_has_view(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_opnum(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static void set_has_reply(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_clientreqid(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x0000000f) ^ 0x0000000f) != 0;
+  }
+};
+
+ReplyMessage::ReplyMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:dsnet.fastpaxos.proto.ReplyMessage)
+}
+ReplyMessage::ReplyMessage(const ReplyMessage& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  ReplyMessage* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.reply_){}
+    , decltype(_impl_.view_){}
+    , decltype(_impl_.opnum_){}
+    , decltype(_impl_.clientreqid_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.reply_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.reply_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_reply()) {
+    _this->_impl_.reply_.Set(from._internal_reply(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.view_, &from._impl_.view_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.clientreqid_) -
+    reinterpret_cast<char*>(&_impl_.view_)) + sizeof(_impl_.clientreqid_));
+  // @@protoc_insertion_point(copy_constructor:dsnet.fastpaxos.proto.ReplyMessage)
+}
+
+inline void ReplyMessage::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.reply_){}
+    , decltype(_impl_.view_){uint64_t{0u}}
+    , decltype(_impl_.opnum_){uint64_t{0u}}
+    , decltype(_impl_.clientreqid_){uint64_t{0u}}
+  };
+  _impl_.reply_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.reply_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+ReplyMessage::~ReplyMessage() {
+  // @@protoc_insertion_point(destructor:dsnet.fastpaxos.proto.ReplyMessage)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void ReplyMessage::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.reply_.Destroy();
+}
+
+void ReplyMessage::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void ReplyMessage::Clear() {
+// @@protoc_insertion_point(message_clear_start:dsnet.fastpaxos.proto.ReplyMessage)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    _impl_.reply_.ClearNonDefaultToEmpty();
+  }
+  if (cached_has_bits & 0x0000000eu) {
+    ::memset(&_impl_.view_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.clientreqid_) -
+        reinterpret_cast<char*>(&_impl_.view_)) + sizeof(_impl_.clientreqid_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* ReplyMessage::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required uint64 view = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_view(&has_bits);
+          _impl_.view_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required uint64 opnum = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _Internal::set_has_opnum(&has_bits);
+          _impl_.opnum_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required bytes reply = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          auto str = _internal_mutable_reply();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required uint64 clientreqid = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _Internal::set_has_clientreqid(&has_bits);
+          _impl_.clientreqid_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* ReplyMessage::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:dsnet.fastpaxos.proto.ReplyMessage)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required uint64 view = 1;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(1, this->_internal_view(), target);
+  }
+
+  // required uint64 opnum = 2;
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(2, this->_internal_opnum(), target);
+  }
+
+  // required bytes reply = 3;
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->WriteBytesMaybeAliased(
+        3, this->_internal_reply(), target);
+  }
+
+  // required uint64 clientreqid = 4;
+  if (cached_has_bits & 0x00000008u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(4, this->_internal_clientreqid(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:dsnet.fastpaxos.proto.ReplyMessage)
+  return target;
+}
+
+size_t ReplyMessage::RequiredFieldsByteSizeFallback() const {
+// @@protoc_insertion_point(required_fields_byte_size_fallback_start:dsnet.fastpaxos.proto.ReplyMessage)
+  size_t total_size = 0;
+
+  if (_internal_has_reply()) {
+    // required bytes reply = 3;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_reply());
+  }
+
+  if (_internal_has_view()) {
+    // required uint64 view = 1;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_view());
+  }
+
+  if (_internal_has_opnum()) {
+    // required uint64 opnum = 2;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_opnum());
+  }
+
+  if (_internal_has_clientreqid()) {
+    // required uint64 clientreqid = 4;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_clientreqid());
+  }
+
+  return total_size;
+}
+size_t ReplyMessage::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:dsnet.fastpaxos.proto.ReplyMessage)
+  size_t total_size = 0;
+
+  if (((_impl_._has_bits_[0] & 0x0000000f) ^ 0x0000000f) == 0) {  // All required fields are present.
+    // required bytes reply = 3;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_reply());
+
+    // required uint64 view = 1;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_view());
+
+    // required uint64 opnum = 2;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_opnum());
+
+    // required uint64 clientreqid = 4;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_clientreqid());
+
+  } else {
+    total_size += RequiredFieldsByteSizeFallback();
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ReplyMessage::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    ReplyMessage::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ReplyMessage::GetClassData() const { return &_class_data_; }
+
+
+void ReplyMessage::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<ReplyMessage*>(&to_msg);
+  auto& from = static_cast<const ReplyMessage&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:dsnet.fastpaxos.proto.ReplyMessage)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000000fu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_reply(from._internal_reply());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.view_ = from._impl_.view_;
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.opnum_ = from._impl_.opnum_;
+    }
+    if (cached_has_bits & 0x00000008u) {
+      _this->_impl_.clientreqid_ = from._impl_.clientreqid_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void ReplyMessage::CopyFrom(const ReplyMessage& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:dsnet.fastpaxos.proto.ReplyMessage)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool ReplyMessage::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  return true;
+}
+
+void ReplyMessage::InternalSwap(ReplyMessage* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.reply_, lhs_arena,
+      &other->_impl_.reply_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(ReplyMessage, _impl_.clientreqid_)
+      + sizeof(ReplyMessage::_impl_.clientreqid_)
+      - PROTOBUF_FIELD_OFFSET(ReplyMessage, _impl_.view_)>(
+          reinterpret_cast<char*>(&_impl_.view_),
+          reinterpret_cast<char*>(&other->_impl_.view_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata ReplyMessage::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_replication_2ffastpaxos_2ffastpaxos_2dproto_2eproto_getter, &descriptor_table_replication_2ffastpaxos_2ffastpaxos_2dproto_2eproto_once,
+      file_level_metadata_replication_2ffastpaxos_2ffastpaxos_2dproto_2eproto[0]);
+}
+
+// ===================================================================
+
+class UnloggedReplyMessage::_Internal {
+ public:
+  using HasBits = decltype(std::declval<UnloggedReplyMessage>()._impl_._has_bits_);
+  static void set_has_reply(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000001) ^ 0x00000001) != 0;
+  }
+};
+
+UnloggedReplyMessage::UnloggedReplyMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:dsnet.fastpaxos.proto.UnloggedReplyMessage)
+}
+UnloggedReplyMessage::UnloggedReplyMessage(const UnloggedReplyMessage& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  UnloggedReplyMessage* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.reply_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.reply_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.reply_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_reply()) {
+    _this->_impl_.reply_.Set(from._internal_reply(), 
+      _this->GetArenaForAllocation());
+  }
+  // @@protoc_insertion_point(copy_constructor:dsnet.fastpaxos.proto.UnloggedReplyMessage)
+}
+
+inline void UnloggedReplyMessage::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.reply_){}
+  };
+  _impl_.reply_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.reply_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+UnloggedReplyMessage::~UnloggedReplyMessage() {
+  // @@protoc_insertion_point(destructor:dsnet.fastpaxos.proto.UnloggedReplyMessage)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void UnloggedReplyMessage::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.reply_.Destroy();
+}
+
+void UnloggedReplyMessage::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void UnloggedReplyMessage::Clear() {
+// @@protoc_insertion_point(message_clear_start:dsnet.fastpaxos.proto.UnloggedReplyMessage)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    _impl_.reply_.ClearNonDefaultToEmpty();
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* UnloggedReplyMessage::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required bytes reply = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_reply();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* UnloggedReplyMessage::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:dsnet.fastpaxos.proto.UnloggedReplyMessage)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required bytes reply = 1;
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->WriteBytesMaybeAliased(
+        1, this->_internal_reply(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:dsnet.fastpaxos.proto.UnloggedReplyMessage)
+  return target;
+}
+
+size_t UnloggedReplyMessage::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:dsnet.fastpaxos.proto.UnloggedReplyMessage)
+  size_t total_size = 0;
+
+  // required bytes reply = 1;
+  if (_internal_has_reply()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_reply());
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData UnloggedReplyMessage::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    UnloggedReplyMessage::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*UnloggedReplyMessage::GetClassData() const { return &_class_data_; }
+
+
+void UnloggedReplyMessage::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<UnloggedReplyMessage*>(&to_msg);
+  auto& from = static_cast<const UnloggedReplyMessage&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:dsnet.fastpaxos.proto.UnloggedReplyMessage)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_has_reply()) {
+    _this->_internal_set_reply(from._internal_reply());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void UnloggedReplyMessage::CopyFrom(const UnloggedReplyMessage& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:dsnet.fastpaxos.proto.UnloggedReplyMessage)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool UnloggedReplyMessage::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  return true;
+}
+
+void UnloggedReplyMessage::InternalSwap(UnloggedReplyMessage* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.reply_, lhs_arena,
+      &other->_impl_.reply_, rhs_arena
+  );
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata UnloggedReplyMessage::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_replication_2ffastpaxos_2ffastpaxos_2dproto_2eproto_getter, &descriptor_table_replication_2ffastpaxos_2ffastpaxos_2dproto_2eproto_once,
+      file_level_metadata_replication_2ffastpaxos_2ffastpaxos_2dproto_2eproto[1]);
+}
+
+// ===================================================================
+
+class ToClientMessage::_Internal {
+ public:
+  static const ::dsnet::fastpaxos::proto::ReplyMessage& reply(const ToClientMessage* msg);
+  static const ::dsnet::fastpaxos::proto::UnloggedReplyMessage& unlogged_reply(const ToClientMessage* msg);
+};
+
+const ::dsnet::fastpaxos::proto::ReplyMessage&
+ToClientMessage::_Internal::reply(const ToClientMessage* msg) {
+  return *msg->_impl_.msg_.reply_;
+}
+const ::dsnet::fastpaxos::proto::UnloggedReplyMessage&
+ToClientMessage::_Internal::unlogged_reply(const ToClientMessage* msg) {
+  return *msg->_impl_.msg_.unlogged_reply_;
+}
+void ToClientMessage::set_allocated_reply(::dsnet::fastpaxos::proto::ReplyMessage* reply) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  clear_msg();
+  if (reply) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(reply);
+    if (message_arena != submessage_arena) {
+      reply = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, reply, submessage_arena);
+    }
+    set_has_reply();
+    _impl_.msg_.reply_ = reply;
+  }
+  // @@protoc_insertion_point(field_set_allocated:dsnet.fastpaxos.proto.ToClientMessage.reply)
+}
+void ToClientMessage::set_allocated_unlogged_reply(::dsnet::fastpaxos::proto::UnloggedReplyMessage* unlogged_reply) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  clear_msg();
+  if (unlogged_reply) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(unlogged_reply);
+    if (message_arena != submessage_arena) {
+      unlogged_reply = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, unlogged_reply, submessage_arena);
+    }
+    set_has_unlogged_reply();
+    _impl_.msg_.unlogged_reply_ = unlogged_reply;
+  }
+  // @@protoc_insertion_point(field_set_allocated:dsnet.fastpaxos.proto.ToClientMessage.unlogged_reply)
+}
+ToClientMessage::ToClientMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:dsnet.fastpaxos.proto.ToClientMessage)
+}
+ToClientMessage::ToClientMessage(const ToClientMessage& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  ToClientMessage* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.msg_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , /*decltype(_impl_._oneof_case_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  clear_has_msg();
+  switch (from.msg_case()) {
+    case kReply: {
+      _this->_internal_mutable_reply()->::dsnet::fastpaxos::proto::ReplyMessage::MergeFrom(
+          from._internal_reply());
+      break;
+    }
+    case kUnloggedReply: {
+      _this->_internal_mutable_unlogged_reply()->::dsnet::fastpaxos::proto::UnloggedReplyMessage::MergeFrom(
+          from._internal_unlogged_reply());
+      break;
+    }
+    case MSG_NOT_SET: {
+      break;
+    }
+  }
+  // @@protoc_insertion_point(copy_constructor:dsnet.fastpaxos.proto.ToClientMessage)
+}
+
+inline void ToClientMessage::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.msg_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , /*decltype(_impl_._oneof_case_)*/{}
+  };
+  clear_has_msg();
+}
+
+ToClientMessage::~ToClientMessage() {
+  // @@protoc_insertion_point(destructor:dsnet.fastpaxos.proto.ToClientMessage)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void ToClientMessage::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  if (has_msg()) {
+    clear_msg();
+  }
+}
+
+void ToClientMessage::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void ToClientMessage::clear_msg() {
+// @@protoc_insertion_point(one_of_clear_start:dsnet.fastpaxos.proto.ToClientMessage)
+  switch (msg_case()) {
+    case kReply: {
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.msg_.reply_;
+      }
+      break;
+    }
+    case kUnloggedReply: {
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.msg_.unlogged_reply_;
+      }
+      break;
+    }
+    case MSG_NOT_SET: {
+      break;
+    }
+  }
+  _impl_._oneof_case_[0] = MSG_NOT_SET;
+}
+
+
+void ToClientMessage::Clear() {
+// @@protoc_insertion_point(message_clear_start:dsnet.fastpaxos.proto.ToClientMessage)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  clear_msg();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* ToClientMessage::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // .dsnet.fastpaxos.proto.ReplyMessage reply = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr = ctx->ParseMessage(_internal_mutable_reply(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .dsnet.fastpaxos.proto.UnloggedReplyMessage unlogged_reply = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr = ctx->ParseMessage(_internal_mutable_unlogged_reply(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* ToClientMessage::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:dsnet.fastpaxos.proto.ToClientMessage)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  switch (msg_case()) {
+    case kReply: {
+      target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(1, _Internal::reply(this),
+          _Internal::reply(this).GetCachedSize(), target, stream);
+      break;
+    }
+    case kUnloggedReply: {
+      target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(2, _Internal::unlogged_reply(this),
+          _Internal::unlogged_reply(this).GetCachedSize(), target, stream);
+      break;
+    }
+    default: ;
+  }
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:dsnet.fastpaxos.proto.ToClientMessage)
+  return target;
+}
+
+size_t ToClientMessage::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:dsnet.fastpaxos.proto.ToClientMessage)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  switch (msg_case()) {
+    // .dsnet.fastpaxos.proto.ReplyMessage reply = 1;
+    case kReply: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.msg_.reply_);
+      break;
+    }
+    // .dsnet.fastpaxos.proto.UnloggedReplyMessage unlogged_reply = 2;
+    case kUnloggedReply: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.msg_.unlogged_reply_);
+      break;
+    }
+    case MSG_NOT_SET: {
+      break;
+    }
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ToClientMessage::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    ToClientMessage::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ToClientMessage::GetClassData() const { return &_class_data_; }
+
+
+void ToClientMessage::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<ToClientMessage*>(&to_msg);
+  auto& from = static_cast<const ToClientMessage&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:dsnet.fastpaxos.proto.ToClientMessage)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  switch (from.msg_case()) {
+    case kReply: {
+      _this->_internal_mutable_reply()->::dsnet::fastpaxos::proto::ReplyMessage::MergeFrom(
+          from._internal_reply());
+      break;
+    }
+    case kUnloggedReply: {
+      _this->_internal_mutable_unlogged_reply()->::dsnet::fastpaxos::proto::UnloggedReplyMessage::MergeFrom(
+          from._internal_unlogged_reply());
+      break;
+    }
+    case MSG_NOT_SET: {
+      break;
+    }
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void ToClientMessage::CopyFrom(const ToClientMessage& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:dsnet.fastpaxos.proto.ToClientMessage)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool ToClientMessage::IsInitialized() const {
+  switch (msg_case()) {
+    case kReply: {
+      if (_internal_has_reply()) {
+        if (!_impl_.msg_.reply_->IsInitialized()) return false;
+      }
+      break;
+    }
+    case kUnloggedReply: {
+      if (_internal_has_unlogged_reply()) {
+        if (!_impl_.msg_.unlogged_reply_->IsInitialized()) return false;
+      }
+      break;
+    }
+    case MSG_NOT_SET: {
+      break;
+    }
+  }
+  return true;
+}
+
+void ToClientMessage::InternalSwap(ToClientMessage* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_.msg_, other->_impl_.msg_);
+  swap(_impl_._oneof_case_[0], other->_impl_._oneof_case_[0]);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata ToClientMessage::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_replication_2ffastpaxos_2ffastpaxos_2dproto_2eproto_getter, &descriptor_table_replication_2ffastpaxos_2ffastpaxos_2dproto_2eproto_once,
+      file_level_metadata_replication_2ffastpaxos_2ffastpaxos_2dproto_2eproto[2]);
+}
+
+// ===================================================================
+
+class RequestMessage::_Internal {
+ public:
+  using HasBits = decltype(std::declval<RequestMessage>()._impl_._has_bits_);
+  static const ::dsnet::Request& req(const RequestMessage* msg);
+  static void set_has_req(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000001) ^ 0x00000001) != 0;
+  }
+};
+
+const ::dsnet::Request&
+RequestMessage::_Internal::req(const RequestMessage* msg) {
+  return *msg->_impl_.req_;
+}
+void RequestMessage::clear_req() {
+  if (_impl_.req_ != nullptr) _impl_.req_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+RequestMessage::RequestMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:dsnet.fastpaxos.proto.RequestMessage)
+}
+RequestMessage::RequestMessage(const RequestMessage& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  RequestMessage* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.req_){nullptr}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  if (from._internal_has_req()) {
+    _this->_impl_.req_ = new ::dsnet::Request(*from._impl_.req_);
+  }
+  // @@protoc_insertion_point(copy_constructor:dsnet.fastpaxos.proto.RequestMessage)
+}
+
+inline void RequestMessage::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.req_){nullptr}
+  };
+}
+
+RequestMessage::~RequestMessage() {
+  // @@protoc_insertion_point(destructor:dsnet.fastpaxos.proto.RequestMessage)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void RequestMessage::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  if (this != internal_default_instance()) delete _impl_.req_;
+}
+
+void RequestMessage::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void RequestMessage::Clear() {
+// @@protoc_insertion_point(message_clear_start:dsnet.fastpaxos.proto.RequestMessage)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    GOOGLE_DCHECK(_impl_.req_ != nullptr);
+    _impl_.req_->Clear();
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* RequestMessage::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required .dsnet.Request req = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr = ctx->ParseMessage(_internal_mutable_req(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* RequestMessage::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:dsnet.fastpaxos.proto.RequestMessage)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required .dsnet.Request req = 1;
+  if (cached_has_bits & 0x00000001u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(1, _Internal::req(this),
+        _Internal::req(this).GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:dsnet.fastpaxos.proto.RequestMessage)
+  return target;
+}
+
+size_t RequestMessage::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:dsnet.fastpaxos.proto.RequestMessage)
+  size_t total_size = 0;
+
+  // required .dsnet.Request req = 1;
+  if (_internal_has_req()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.req_);
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData RequestMessage::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    RequestMessage::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*RequestMessage::GetClassData() const { return &_class_data_; }
+
+
+void RequestMessage::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<RequestMessage*>(&to_msg);
+  auto& from = static_cast<const RequestMessage&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:dsnet.fastpaxos.proto.RequestMessage)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_has_req()) {
+    _this->_internal_mutable_req()->::dsnet::Request::MergeFrom(
+        from._internal_req());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void RequestMessage::CopyFrom(const RequestMessage& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:dsnet.fastpaxos.proto.RequestMessage)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool RequestMessage::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  if (_internal_has_req()) {
+    if (!_impl_.req_->IsInitialized()) return false;
+  }
+  return true;
+}
+
+void RequestMessage::InternalSwap(RequestMessage* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  swap(_impl_.req_, other->_impl_.req_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata RequestMessage::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_replication_2ffastpaxos_2ffastpaxos_2dproto_2eproto_getter, &descriptor_table_replication_2ffastpaxos_2ffastpaxos_2dproto_2eproto_once,
+      file_level_metadata_replication_2ffastpaxos_2ffastpaxos_2dproto_2eproto[3]);
+}
+
+// ===================================================================
+
+class UnloggedRequestMessage::_Internal {
+ public:
+  using HasBits = decltype(std::declval<UnloggedRequestMessage>()._impl_._has_bits_);
+  static const ::dsnet::UnloggedRequest& req(const UnloggedRequestMessage* msg);
+  static void set_has_req(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000001) ^ 0x00000001) != 0;
+  }
+};
+
+const ::dsnet::UnloggedRequest&
+UnloggedRequestMessage::_Internal::req(const UnloggedRequestMessage* msg) {
+  return *msg->_impl_.req_;
+}
+void UnloggedRequestMessage::clear_req() {
+  if (_impl_.req_ != nullptr) _impl_.req_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+UnloggedRequestMessage::UnloggedRequestMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:dsnet.fastpaxos.proto.UnloggedRequestMessage)
+}
+UnloggedRequestMessage::UnloggedRequestMessage(const UnloggedRequestMessage& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  UnloggedRequestMessage* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.req_){nullptr}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  if (from._internal_has_req()) {
+    _this->_impl_.req_ = new ::dsnet::UnloggedRequest(*from._impl_.req_);
+  }
+  // @@protoc_insertion_point(copy_constructor:dsnet.fastpaxos.proto.UnloggedRequestMessage)
+}
+
+inline void UnloggedRequestMessage::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.req_){nullptr}
+  };
+}
+
+UnloggedRequestMessage::~UnloggedRequestMessage() {
+  // @@protoc_insertion_point(destructor:dsnet.fastpaxos.proto.UnloggedRequestMessage)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void UnloggedRequestMessage::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  if (this != internal_default_instance()) delete _impl_.req_;
+}
+
+void UnloggedRequestMessage::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void UnloggedRequestMessage::Clear() {
+// @@protoc_insertion_point(message_clear_start:dsnet.fastpaxos.proto.UnloggedRequestMessage)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    GOOGLE_DCHECK(_impl_.req_ != nullptr);
+    _impl_.req_->Clear();
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* UnloggedRequestMessage::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required .dsnet.UnloggedRequest req = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr = ctx->ParseMessage(_internal_mutable_req(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* UnloggedRequestMessage::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:dsnet.fastpaxos.proto.UnloggedRequestMessage)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required .dsnet.UnloggedRequest req = 1;
+  if (cached_has_bits & 0x00000001u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(1, _Internal::req(this),
+        _Internal::req(this).GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:dsnet.fastpaxos.proto.UnloggedRequestMessage)
+  return target;
+}
+
+size_t UnloggedRequestMessage::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:dsnet.fastpaxos.proto.UnloggedRequestMessage)
+  size_t total_size = 0;
+
+  // required .dsnet.UnloggedRequest req = 1;
+  if (_internal_has_req()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.req_);
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData UnloggedRequestMessage::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    UnloggedRequestMessage::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*UnloggedRequestMessage::GetClassData() const { return &_class_data_; }
+
+
+void UnloggedRequestMessage::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<UnloggedRequestMessage*>(&to_msg);
+  auto& from = static_cast<const UnloggedRequestMessage&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:dsnet.fastpaxos.proto.UnloggedRequestMessage)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_has_req()) {
+    _this->_internal_mutable_req()->::dsnet::UnloggedRequest::MergeFrom(
+        from._internal_req());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void UnloggedRequestMessage::CopyFrom(const UnloggedRequestMessage& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:dsnet.fastpaxos.proto.UnloggedRequestMessage)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool UnloggedRequestMessage::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  if (_internal_has_req()) {
+    if (!_impl_.req_->IsInitialized()) return false;
+  }
+  return true;
+}
+
+void UnloggedRequestMessage::InternalSwap(UnloggedRequestMessage* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  swap(_impl_.req_, other->_impl_.req_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata UnloggedRequestMessage::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_replication_2ffastpaxos_2ffastpaxos_2dproto_2eproto_getter, &descriptor_table_replication_2ffastpaxos_2ffastpaxos_2dproto_2eproto_once,
+      file_level_metadata_replication_2ffastpaxos_2ffastpaxos_2dproto_2eproto[4]);
+}
+
+// ===================================================================
+
+class PrepareOKMessage::_Internal {
+ public:
+  using HasBits = decltype(std::declval<PrepareOKMessage>()._impl_._has_bits_);
+  static void set_has_view(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_opnum(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static void set_has_replicaidx(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+  static const ::dsnet::Request& req(const PrepareOKMessage* msg);
+  static void set_has_req(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_slowpath(HasBits* has_bits) {
+    (*has_bits)[0] |= 16u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x0000001f) ^ 0x0000001f) != 0;
+  }
+};
+
+const ::dsnet::Request&
+PrepareOKMessage::_Internal::req(const PrepareOKMessage* msg) {
+  return *msg->_impl_.req_;
+}
+void PrepareOKMessage::clear_req() {
+  if (_impl_.req_ != nullptr) _impl_.req_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+PrepareOKMessage::PrepareOKMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:dsnet.fastpaxos.proto.PrepareOKMessage)
+}
+PrepareOKMessage::PrepareOKMessage(const PrepareOKMessage& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  PrepareOKMessage* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.req_){nullptr}
+    , decltype(_impl_.view_){}
+    , decltype(_impl_.opnum_){}
+    , decltype(_impl_.replicaidx_){}
+    , decltype(_impl_.slowpath_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  if (from._internal_has_req()) {
+    _this->_impl_.req_ = new ::dsnet::Request(*from._impl_.req_);
+  }
+  ::memcpy(&_impl_.view_, &from._impl_.view_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.slowpath_) -
+    reinterpret_cast<char*>(&_impl_.view_)) + sizeof(_impl_.slowpath_));
+  // @@protoc_insertion_point(copy_constructor:dsnet.fastpaxos.proto.PrepareOKMessage)
+}
+
+inline void PrepareOKMessage::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.req_){nullptr}
+    , decltype(_impl_.view_){uint64_t{0u}}
+    , decltype(_impl_.opnum_){uint64_t{0u}}
+    , decltype(_impl_.replicaidx_){0u}
+    , decltype(_impl_.slowpath_){0u}
+  };
+}
+
+PrepareOKMessage::~PrepareOKMessage() {
+  // @@protoc_insertion_point(destructor:dsnet.fastpaxos.proto.PrepareOKMessage)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void PrepareOKMessage::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  if (this != internal_default_instance()) delete _impl_.req_;
+}
+
+void PrepareOKMessage::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void PrepareOKMessage::Clear() {
+// @@protoc_insertion_point(message_clear_start:dsnet.fastpaxos.proto.PrepareOKMessage)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    GOOGLE_DCHECK(_impl_.req_ != nullptr);
+    _impl_.req_->Clear();
+  }
+  if (cached_has_bits & 0x0000001eu) {
+    ::memset(&_impl_.view_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.slowpath_) -
+        reinterpret_cast<char*>(&_impl_.view_)) + sizeof(_impl_.slowpath_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* PrepareOKMessage::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required uint64 view = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_view(&has_bits);
+          _impl_.view_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required uint64 opnum = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _Internal::set_has_opnum(&has_bits);
+          _impl_.opnum_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required uint32 replicaIdx = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _Internal::set_has_replicaidx(&has_bits);
+          _impl_.replicaidx_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required .dsnet.Request req = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          ptr = ctx->ParseMessage(_internal_mutable_req(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required uint32 slowpath = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          _Internal::set_has_slowpath(&has_bits);
+          _impl_.slowpath_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* PrepareOKMessage::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:dsnet.fastpaxos.proto.PrepareOKMessage)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required uint64 view = 1;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(1, this->_internal_view(), target);
+  }
+
+  // required uint64 opnum = 2;
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(2, this->_internal_opnum(), target);
+  }
+
+  // required uint32 replicaIdx = 3;
+  if (cached_has_bits & 0x00000008u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(3, this->_internal_replicaidx(), target);
+  }
+
+  // required .dsnet.Request req = 4;
+  if (cached_has_bits & 0x00000001u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(4, _Internal::req(this),
+        _Internal::req(this).GetCachedSize(), target, stream);
+  }
+
+  // required uint32 slowpath = 5;
+  if (cached_has_bits & 0x00000010u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(5, this->_internal_slowpath(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:dsnet.fastpaxos.proto.PrepareOKMessage)
+  return target;
+}
+
+size_t PrepareOKMessage::RequiredFieldsByteSizeFallback() const {
+// @@protoc_insertion_point(required_fields_byte_size_fallback_start:dsnet.fastpaxos.proto.PrepareOKMessage)
+  size_t total_size = 0;
+
+  if (_internal_has_req()) {
+    // required .dsnet.Request req = 4;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.req_);
+  }
+
+  if (_internal_has_view()) {
+    // required uint64 view = 1;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_view());
+  }
+
+  if (_internal_has_opnum()) {
+    // required uint64 opnum = 2;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_opnum());
+  }
+
+  if (_internal_has_replicaidx()) {
+    // required uint32 replicaIdx = 3;
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_replicaidx());
+  }
+
+  if (_internal_has_slowpath()) {
+    // required uint32 slowpath = 5;
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_slowpath());
+  }
+
+  return total_size;
+}
+size_t PrepareOKMessage::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:dsnet.fastpaxos.proto.PrepareOKMessage)
+  size_t total_size = 0;
+
+  if (((_impl_._has_bits_[0] & 0x0000001f) ^ 0x0000001f) == 0) {  // All required fields are present.
+    // required .dsnet.Request req = 4;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.req_);
+
+    // required uint64 view = 1;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_view());
+
+    // required uint64 opnum = 2;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_opnum());
+
+    // required uint32 replicaIdx = 3;
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_replicaidx());
+
+    // required uint32 slowpath = 5;
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_slowpath());
+
+  } else {
+    total_size += RequiredFieldsByteSizeFallback();
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData PrepareOKMessage::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    PrepareOKMessage::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*PrepareOKMessage::GetClassData() const { return &_class_data_; }
+
+
+void PrepareOKMessage::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<PrepareOKMessage*>(&to_msg);
+  auto& from = static_cast<const PrepareOKMessage&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:dsnet.fastpaxos.proto.PrepareOKMessage)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000001fu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_mutable_req()->::dsnet::Request::MergeFrom(
+          from._internal_req());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.view_ = from._impl_.view_;
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.opnum_ = from._impl_.opnum_;
+    }
+    if (cached_has_bits & 0x00000008u) {
+      _this->_impl_.replicaidx_ = from._impl_.replicaidx_;
+    }
+    if (cached_has_bits & 0x00000010u) {
+      _this->_impl_.slowpath_ = from._impl_.slowpath_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void PrepareOKMessage::CopyFrom(const PrepareOKMessage& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:dsnet.fastpaxos.proto.PrepareOKMessage)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool PrepareOKMessage::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  if (_internal_has_req()) {
+    if (!_impl_.req_->IsInitialized()) return false;
+  }
+  return true;
+}
+
+void PrepareOKMessage::InternalSwap(PrepareOKMessage* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(PrepareOKMessage, _impl_.slowpath_)
+      + sizeof(PrepareOKMessage::_impl_.slowpath_)
+      - PROTOBUF_FIELD_OFFSET(PrepareOKMessage, _impl_.req_)>(
+          reinterpret_cast<char*>(&_impl_.req_),
+          reinterpret_cast<char*>(&other->_impl_.req_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata PrepareOKMessage::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_replication_2ffastpaxos_2ffastpaxos_2dproto_2eproto_getter, &descriptor_table_replication_2ffastpaxos_2ffastpaxos_2dproto_2eproto_once,
+      file_level_metadata_replication_2ffastpaxos_2ffastpaxos_2dproto_2eproto[5]);
+}
+
+// ===================================================================
+
+class PrepareMessage::_Internal {
+ public:
+  using HasBits = decltype(std::declval<PrepareMessage>()._impl_._has_bits_);
+  static void set_has_view(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_opnum(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static const ::dsnet::Request& req(const PrepareMessage* msg);
+  static void set_has_req(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000007) ^ 0x00000007) != 0;
+  }
+};
+
+const ::dsnet::Request&
+PrepareMessage::_Internal::req(const PrepareMessage* msg) {
+  return *msg->_impl_.req_;
+}
+void PrepareMessage::clear_req() {
+  if (_impl_.req_ != nullptr) _impl_.req_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+PrepareMessage::PrepareMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:dsnet.fastpaxos.proto.PrepareMessage)
+}
+PrepareMessage::PrepareMessage(const PrepareMessage& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  PrepareMessage* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.req_){nullptr}
+    , decltype(_impl_.view_){}
+    , decltype(_impl_.opnum_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  if (from._internal_has_req()) {
+    _this->_impl_.req_ = new ::dsnet::Request(*from._impl_.req_);
+  }
+  ::memcpy(&_impl_.view_, &from._impl_.view_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.opnum_) -
+    reinterpret_cast<char*>(&_impl_.view_)) + sizeof(_impl_.opnum_));
+  // @@protoc_insertion_point(copy_constructor:dsnet.fastpaxos.proto.PrepareMessage)
+}
+
+inline void PrepareMessage::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.req_){nullptr}
+    , decltype(_impl_.view_){uint64_t{0u}}
+    , decltype(_impl_.opnum_){uint64_t{0u}}
+  };
+}
+
+PrepareMessage::~PrepareMessage() {
+  // @@protoc_insertion_point(destructor:dsnet.fastpaxos.proto.PrepareMessage)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void PrepareMessage::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  if (this != internal_default_instance()) delete _impl_.req_;
+}
+
+void PrepareMessage::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void PrepareMessage::Clear() {
+// @@protoc_insertion_point(message_clear_start:dsnet.fastpaxos.proto.PrepareMessage)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    GOOGLE_DCHECK(_impl_.req_ != nullptr);
+    _impl_.req_->Clear();
+  }
+  if (cached_has_bits & 0x00000006u) {
+    ::memset(&_impl_.view_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.opnum_) -
+        reinterpret_cast<char*>(&_impl_.view_)) + sizeof(_impl_.opnum_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* PrepareMessage::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required uint64 view = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_view(&has_bits);
+          _impl_.view_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required uint64 opnum = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _Internal::set_has_opnum(&has_bits);
+          _impl_.opnum_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required .dsnet.Request req = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          ptr = ctx->ParseMessage(_internal_mutable_req(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* PrepareMessage::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:dsnet.fastpaxos.proto.PrepareMessage)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required uint64 view = 1;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(1, this->_internal_view(), target);
+  }
+
+  // required uint64 opnum = 2;
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(2, this->_internal_opnum(), target);
+  }
+
+  // required .dsnet.Request req = 3;
+  if (cached_has_bits & 0x00000001u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(3, _Internal::req(this),
+        _Internal::req(this).GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:dsnet.fastpaxos.proto.PrepareMessage)
+  return target;
+}
+
+size_t PrepareMessage::RequiredFieldsByteSizeFallback() const {
+// @@protoc_insertion_point(required_fields_byte_size_fallback_start:dsnet.fastpaxos.proto.PrepareMessage)
+  size_t total_size = 0;
+
+  if (_internal_has_req()) {
+    // required .dsnet.Request req = 3;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.req_);
+  }
+
+  if (_internal_has_view()) {
+    // required uint64 view = 1;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_view());
+  }
+
+  if (_internal_has_opnum()) {
+    // required uint64 opnum = 2;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_opnum());
+  }
+
+  return total_size;
+}
+size_t PrepareMessage::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:dsnet.fastpaxos.proto.PrepareMessage)
+  size_t total_size = 0;
+
+  if (((_impl_._has_bits_[0] & 0x00000007) ^ 0x00000007) == 0) {  // All required fields are present.
+    // required .dsnet.Request req = 3;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.req_);
+
+    // required uint64 view = 1;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_view());
+
+    // required uint64 opnum = 2;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_opnum());
+
+  } else {
+    total_size += RequiredFieldsByteSizeFallback();
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData PrepareMessage::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    PrepareMessage::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*PrepareMessage::GetClassData() const { return &_class_data_; }
+
+
+void PrepareMessage::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<PrepareMessage*>(&to_msg);
+  auto& from = static_cast<const PrepareMessage&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:dsnet.fastpaxos.proto.PrepareMessage)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_mutable_req()->::dsnet::Request::MergeFrom(
+          from._internal_req());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.view_ = from._impl_.view_;
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.opnum_ = from._impl_.opnum_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void PrepareMessage::CopyFrom(const PrepareMessage& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:dsnet.fastpaxos.proto.PrepareMessage)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool PrepareMessage::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  if (_internal_has_req()) {
+    if (!_impl_.req_->IsInitialized()) return false;
+  }
+  return true;
+}
+
+void PrepareMessage::InternalSwap(PrepareMessage* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(PrepareMessage, _impl_.opnum_)
+      + sizeof(PrepareMessage::_impl_.opnum_)
+      - PROTOBUF_FIELD_OFFSET(PrepareMessage, _impl_.req_)>(
+          reinterpret_cast<char*>(&_impl_.req_),
+          reinterpret_cast<char*>(&other->_impl_.req_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata PrepareMessage::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_replication_2ffastpaxos_2ffastpaxos_2dproto_2eproto_getter, &descriptor_table_replication_2ffastpaxos_2ffastpaxos_2dproto_2eproto_once,
+      file_level_metadata_replication_2ffastpaxos_2ffastpaxos_2dproto_2eproto[6]);
+}
+
+// ===================================================================
+
+class CommitMessage::_Internal {
+ public:
+  using HasBits = decltype(std::declval<CommitMessage>()._impl_._has_bits_);
+  static void set_has_view(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_opnum(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static const ::dsnet::Request& req(const CommitMessage* msg);
+  static void set_has_req(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000007) ^ 0x00000007) != 0;
+  }
+};
+
+const ::dsnet::Request&
+CommitMessage::_Internal::req(const CommitMessage* msg) {
+  return *msg->_impl_.req_;
+}
+void CommitMessage::clear_req() {
+  if (_impl_.req_ != nullptr) _impl_.req_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+CommitMessage::CommitMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:dsnet.fastpaxos.proto.CommitMessage)
+}
+CommitMessage::CommitMessage(const CommitMessage& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  CommitMessage* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.req_){nullptr}
+    , decltype(_impl_.view_){}
+    , decltype(_impl_.opnum_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  if (from._internal_has_req()) {
+    _this->_impl_.req_ = new ::dsnet::Request(*from._impl_.req_);
+  }
+  ::memcpy(&_impl_.view_, &from._impl_.view_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.opnum_) -
+    reinterpret_cast<char*>(&_impl_.view_)) + sizeof(_impl_.opnum_));
+  // @@protoc_insertion_point(copy_constructor:dsnet.fastpaxos.proto.CommitMessage)
+}
+
+inline void CommitMessage::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.req_){nullptr}
+    , decltype(_impl_.view_){uint64_t{0u}}
+    , decltype(_impl_.opnum_){uint64_t{0u}}
+  };
+}
+
+CommitMessage::~CommitMessage() {
+  // @@protoc_insertion_point(destructor:dsnet.fastpaxos.proto.CommitMessage)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void CommitMessage::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  if (this != internal_default_instance()) delete _impl_.req_;
+}
+
+void CommitMessage::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void CommitMessage::Clear() {
+// @@protoc_insertion_point(message_clear_start:dsnet.fastpaxos.proto.CommitMessage)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    GOOGLE_DCHECK(_impl_.req_ != nullptr);
+    _impl_.req_->Clear();
+  }
+  if (cached_has_bits & 0x00000006u) {
+    ::memset(&_impl_.view_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.opnum_) -
+        reinterpret_cast<char*>(&_impl_.view_)) + sizeof(_impl_.opnum_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* CommitMessage::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required uint64 view = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_view(&has_bits);
+          _impl_.view_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required uint64 opnum = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _Internal::set_has_opnum(&has_bits);
+          _impl_.opnum_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required .dsnet.Request req = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          ptr = ctx->ParseMessage(_internal_mutable_req(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* CommitMessage::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:dsnet.fastpaxos.proto.CommitMessage)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required uint64 view = 1;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(1, this->_internal_view(), target);
+  }
+
+  // required uint64 opnum = 2;
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(2, this->_internal_opnum(), target);
+  }
+
+  // required .dsnet.Request req = 3;
+  if (cached_has_bits & 0x00000001u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(3, _Internal::req(this),
+        _Internal::req(this).GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:dsnet.fastpaxos.proto.CommitMessage)
+  return target;
+}
+
+size_t CommitMessage::RequiredFieldsByteSizeFallback() const {
+// @@protoc_insertion_point(required_fields_byte_size_fallback_start:dsnet.fastpaxos.proto.CommitMessage)
+  size_t total_size = 0;
+
+  if (_internal_has_req()) {
+    // required .dsnet.Request req = 3;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.req_);
+  }
+
+  if (_internal_has_view()) {
+    // required uint64 view = 1;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_view());
+  }
+
+  if (_internal_has_opnum()) {
+    // required uint64 opnum = 2;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_opnum());
+  }
+
+  return total_size;
+}
+size_t CommitMessage::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:dsnet.fastpaxos.proto.CommitMessage)
+  size_t total_size = 0;
+
+  if (((_impl_._has_bits_[0] & 0x00000007) ^ 0x00000007) == 0) {  // All required fields are present.
+    // required .dsnet.Request req = 3;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.req_);
+
+    // required uint64 view = 1;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_view());
+
+    // required uint64 opnum = 2;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_opnum());
+
+  } else {
+    total_size += RequiredFieldsByteSizeFallback();
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData CommitMessage::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    CommitMessage::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*CommitMessage::GetClassData() const { return &_class_data_; }
+
+
+void CommitMessage::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<CommitMessage*>(&to_msg);
+  auto& from = static_cast<const CommitMessage&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:dsnet.fastpaxos.proto.CommitMessage)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_mutable_req()->::dsnet::Request::MergeFrom(
+          from._internal_req());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.view_ = from._impl_.view_;
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.opnum_ = from._impl_.opnum_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void CommitMessage::CopyFrom(const CommitMessage& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:dsnet.fastpaxos.proto.CommitMessage)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool CommitMessage::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  if (_internal_has_req()) {
+    if (!_impl_.req_->IsInitialized()) return false;
+  }
+  return true;
+}
+
+void CommitMessage::InternalSwap(CommitMessage* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(CommitMessage, _impl_.opnum_)
+      + sizeof(CommitMessage::_impl_.opnum_)
+      - PROTOBUF_FIELD_OFFSET(CommitMessage, _impl_.req_)>(
+          reinterpret_cast<char*>(&_impl_.req_),
+          reinterpret_cast<char*>(&other->_impl_.req_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata CommitMessage::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_replication_2ffastpaxos_2ffastpaxos_2dproto_2eproto_getter, &descriptor_table_replication_2ffastpaxos_2ffastpaxos_2dproto_2eproto_once,
+      file_level_metadata_replication_2ffastpaxos_2ffastpaxos_2dproto_2eproto[7]);
+}
+
+// ===================================================================
+
+class RequestStateTransferMessage::_Internal {
+ public:
+  using HasBits = decltype(std::declval<RequestStateTransferMessage>()._impl_._has_bits_);
+  static void set_has_view(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_opnum(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000003) ^ 0x00000003) != 0;
+  }
+};
+
+RequestStateTransferMessage::RequestStateTransferMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:dsnet.fastpaxos.proto.RequestStateTransferMessage)
+}
+RequestStateTransferMessage::RequestStateTransferMessage(const RequestStateTransferMessage& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  RequestStateTransferMessage* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.view_){}
+    , decltype(_impl_.opnum_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.view_, &from._impl_.view_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.opnum_) -
+    reinterpret_cast<char*>(&_impl_.view_)) + sizeof(_impl_.opnum_));
+  // @@protoc_insertion_point(copy_constructor:dsnet.fastpaxos.proto.RequestStateTransferMessage)
+}
+
+inline void RequestStateTransferMessage::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.view_){uint64_t{0u}}
+    , decltype(_impl_.opnum_){uint64_t{0u}}
+  };
+}
+
+RequestStateTransferMessage::~RequestStateTransferMessage() {
+  // @@protoc_insertion_point(destructor:dsnet.fastpaxos.proto.RequestStateTransferMessage)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void RequestStateTransferMessage::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void RequestStateTransferMessage::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void RequestStateTransferMessage::Clear() {
+// @@protoc_insertion_point(message_clear_start:dsnet.fastpaxos.proto.RequestStateTransferMessage)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    ::memset(&_impl_.view_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.opnum_) -
+        reinterpret_cast<char*>(&_impl_.view_)) + sizeof(_impl_.opnum_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* RequestStateTransferMessage::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required uint64 view = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_view(&has_bits);
+          _impl_.view_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required uint64 opnum = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _Internal::set_has_opnum(&has_bits);
+          _impl_.opnum_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* RequestStateTransferMessage::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:dsnet.fastpaxos.proto.RequestStateTransferMessage)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required uint64 view = 1;
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(1, this->_internal_view(), target);
+  }
+
+  // required uint64 opnum = 2;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(2, this->_internal_opnum(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:dsnet.fastpaxos.proto.RequestStateTransferMessage)
+  return target;
+}
+
+size_t RequestStateTransferMessage::RequiredFieldsByteSizeFallback() const {
+// @@protoc_insertion_point(required_fields_byte_size_fallback_start:dsnet.fastpaxos.proto.RequestStateTransferMessage)
+  size_t total_size = 0;
+
+  if (_internal_has_view()) {
+    // required uint64 view = 1;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_view());
+  }
+
+  if (_internal_has_opnum()) {
+    // required uint64 opnum = 2;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_opnum());
+  }
+
+  return total_size;
+}
+size_t RequestStateTransferMessage::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:dsnet.fastpaxos.proto.RequestStateTransferMessage)
+  size_t total_size = 0;
+
+  if (((_impl_._has_bits_[0] & 0x00000003) ^ 0x00000003) == 0) {  // All required fields are present.
+    // required uint64 view = 1;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_view());
+
+    // required uint64 opnum = 2;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_opnum());
+
+  } else {
+    total_size += RequiredFieldsByteSizeFallback();
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData RequestStateTransferMessage::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    RequestStateTransferMessage::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*RequestStateTransferMessage::GetClassData() const { return &_class_data_; }
+
+
+void RequestStateTransferMessage::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<RequestStateTransferMessage*>(&to_msg);
+  auto& from = static_cast<const RequestStateTransferMessage&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:dsnet.fastpaxos.proto.RequestStateTransferMessage)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_impl_.view_ = from._impl_.view_;
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.opnum_ = from._impl_.opnum_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void RequestStateTransferMessage::CopyFrom(const RequestStateTransferMessage& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:dsnet.fastpaxos.proto.RequestStateTransferMessage)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool RequestStateTransferMessage::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  return true;
+}
+
+void RequestStateTransferMessage::InternalSwap(RequestStateTransferMessage* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(RequestStateTransferMessage, _impl_.opnum_)
+      + sizeof(RequestStateTransferMessage::_impl_.opnum_)
+      - PROTOBUF_FIELD_OFFSET(RequestStateTransferMessage, _impl_.view_)>(
+          reinterpret_cast<char*>(&_impl_.view_),
+          reinterpret_cast<char*>(&other->_impl_.view_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata RequestStateTransferMessage::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_replication_2ffastpaxos_2ffastpaxos_2dproto_2eproto_getter, &descriptor_table_replication_2ffastpaxos_2ffastpaxos_2dproto_2eproto_once,
+      file_level_metadata_replication_2ffastpaxos_2ffastpaxos_2dproto_2eproto[8]);
+}
+
+// ===================================================================
+
+class StateTransferMessage::_Internal {
+ public:
+  using HasBits = decltype(std::declval<StateTransferMessage>()._impl_._has_bits_);
+  static void set_has_view(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_opnum(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_lastop(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000007) ^ 0x00000007) != 0;
+  }
+};
+
+void StateTransferMessage::clear_entries() {
+  _impl_.entries_.Clear();
+}
+StateTransferMessage::StateTransferMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:dsnet.fastpaxos.proto.StateTransferMessage)
+}
+StateTransferMessage::StateTransferMessage(const StateTransferMessage& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  StateTransferMessage* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.entries_){from._impl_.entries_}
+    , decltype(_impl_.view_){}
+    , decltype(_impl_.opnum_){}
+    , decltype(_impl_.lastop_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.view_, &from._impl_.view_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.lastop_) -
+    reinterpret_cast<char*>(&_impl_.view_)) + sizeof(_impl_.lastop_));
+  // @@protoc_insertion_point(copy_constructor:dsnet.fastpaxos.proto.StateTransferMessage)
+}
+
+inline void StateTransferMessage::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.entries_){arena}
+    , decltype(_impl_.view_){uint64_t{0u}}
+    , decltype(_impl_.opnum_){uint64_t{0u}}
+    , decltype(_impl_.lastop_){uint64_t{0u}}
+  };
+}
+
+StateTransferMessage::~StateTransferMessage() {
+  // @@protoc_insertion_point(destructor:dsnet.fastpaxos.proto.StateTransferMessage)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void StateTransferMessage::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.entries_.~RepeatedPtrField();
+}
+
+void StateTransferMessage::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void StateTransferMessage::Clear() {
+// @@protoc_insertion_point(message_clear_start:dsnet.fastpaxos.proto.StateTransferMessage)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.entries_.Clear();
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    ::memset(&_impl_.view_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.lastop_) -
+        reinterpret_cast<char*>(&_impl_.view_)) + sizeof(_impl_.lastop_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* StateTransferMessage::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required uint64 view = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_view(&has_bits);
+          _impl_.view_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required uint64 opnum = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _Internal::set_has_opnum(&has_bits);
+          _impl_.opnum_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .dsnet.MsgLogEntry entries = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_entries(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<26>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // required uint64 lastop = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _Internal::set_has_lastop(&has_bits);
+          _impl_.lastop_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* StateTransferMessage::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:dsnet.fastpaxos.proto.StateTransferMessage)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required uint64 view = 1;
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(1, this->_internal_view(), target);
+  }
+
+  // required uint64 opnum = 2;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(2, this->_internal_opnum(), target);
+  }
+
+  // repeated .dsnet.MsgLogEntry entries = 3;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_entries_size()); i < n; i++) {
+    const auto& repfield = this->_internal_entries(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(3, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  // required uint64 lastop = 4;
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(4, this->_internal_lastop(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:dsnet.fastpaxos.proto.StateTransferMessage)
+  return target;
+}
+
+size_t StateTransferMessage::RequiredFieldsByteSizeFallback() const {
+// @@protoc_insertion_point(required_fields_byte_size_fallback_start:dsnet.fastpaxos.proto.StateTransferMessage)
+  size_t total_size = 0;
+
+  if (_internal_has_view()) {
+    // required uint64 view = 1;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_view());
+  }
+
+  if (_internal_has_opnum()) {
+    // required uint64 opnum = 2;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_opnum());
+  }
+
+  if (_internal_has_lastop()) {
+    // required uint64 lastop = 4;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_lastop());
+  }
+
+  return total_size;
+}
+size_t StateTransferMessage::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:dsnet.fastpaxos.proto.StateTransferMessage)
+  size_t total_size = 0;
+
+  if (((_impl_._has_bits_[0] & 0x00000007) ^ 0x00000007) == 0) {  // All required fields are present.
+    // required uint64 view = 1;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_view());
+
+    // required uint64 opnum = 2;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_opnum());
+
+    // required uint64 lastop = 4;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_lastop());
+
+  } else {
+    total_size += RequiredFieldsByteSizeFallback();
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .dsnet.MsgLogEntry entries = 3;
+  total_size += 1UL * this->_internal_entries_size();
+  for (const auto& msg : this->_impl_.entries_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData StateTransferMessage::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    StateTransferMessage::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*StateTransferMessage::GetClassData() const { return &_class_data_; }
+
+
+void StateTransferMessage::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<StateTransferMessage*>(&to_msg);
+  auto& from = static_cast<const StateTransferMessage&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:dsnet.fastpaxos.proto.StateTransferMessage)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.entries_.MergeFrom(from._impl_.entries_);
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_impl_.view_ = from._impl_.view_;
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.opnum_ = from._impl_.opnum_;
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.lastop_ = from._impl_.lastop_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void StateTransferMessage::CopyFrom(const StateTransferMessage& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:dsnet.fastpaxos.proto.StateTransferMessage)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool StateTransferMessage::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  if (!::PROTOBUF_NAMESPACE_ID::internal::AllAreInitialized(_impl_.entries_))
+    return false;
+  return true;
+}
+
+void StateTransferMessage::InternalSwap(StateTransferMessage* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  _impl_.entries_.InternalSwap(&other->_impl_.entries_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(StateTransferMessage, _impl_.lastop_)
+      + sizeof(StateTransferMessage::_impl_.lastop_)
+      - PROTOBUF_FIELD_OFFSET(StateTransferMessage, _impl_.view_)>(
+          reinterpret_cast<char*>(&_impl_.view_),
+          reinterpret_cast<char*>(&other->_impl_.view_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata StateTransferMessage::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_replication_2ffastpaxos_2ffastpaxos_2dproto_2eproto_getter, &descriptor_table_replication_2ffastpaxos_2ffastpaxos_2dproto_2eproto_once,
+      file_level_metadata_replication_2ffastpaxos_2ffastpaxos_2dproto_2eproto[9]);
+}
+
+// ===================================================================
+
+class ToReplicaMessage::_Internal {
+ public:
+  static const ::dsnet::fastpaxos::proto::RequestMessage& request(const ToReplicaMessage* msg);
+  static const ::dsnet::fastpaxos::proto::UnloggedRequestMessage& unlogged_request(const ToReplicaMessage* msg);
+  static const ::dsnet::fastpaxos::proto::PrepareMessage& prepare(const ToReplicaMessage* msg);
+  static const ::dsnet::fastpaxos::proto::PrepareOKMessage& prepare_ok(const ToReplicaMessage* msg);
+  static const ::dsnet::fastpaxos::proto::CommitMessage& commit(const ToReplicaMessage* msg);
+  static const ::dsnet::fastpaxos::proto::RequestStateTransferMessage& request_state_transfer(const ToReplicaMessage* msg);
+  static const ::dsnet::fastpaxos::proto::StateTransferMessage& state_transfer(const ToReplicaMessage* msg);
+};
+
+const ::dsnet::fastpaxos::proto::RequestMessage&
+ToReplicaMessage::_Internal::request(const ToReplicaMessage* msg) {
+  return *msg->_impl_.msg_.request_;
+}
+const ::dsnet::fastpaxos::proto::UnloggedRequestMessage&
+ToReplicaMessage::_Internal::unlogged_request(const ToReplicaMessage* msg) {
+  return *msg->_impl_.msg_.unlogged_request_;
+}
+const ::dsnet::fastpaxos::proto::PrepareMessage&
+ToReplicaMessage::_Internal::prepare(const ToReplicaMessage* msg) {
+  return *msg->_impl_.msg_.prepare_;
+}
+const ::dsnet::fastpaxos::proto::PrepareOKMessage&
+ToReplicaMessage::_Internal::prepare_ok(const ToReplicaMessage* msg) {
+  return *msg->_impl_.msg_.prepare_ok_;
+}
+const ::dsnet::fastpaxos::proto::CommitMessage&
+ToReplicaMessage::_Internal::commit(const ToReplicaMessage* msg) {
+  return *msg->_impl_.msg_.commit_;
+}
+const ::dsnet::fastpaxos::proto::RequestStateTransferMessage&
+ToReplicaMessage::_Internal::request_state_transfer(const ToReplicaMessage* msg) {
+  return *msg->_impl_.msg_.request_state_transfer_;
+}
+const ::dsnet::fastpaxos::proto::StateTransferMessage&
+ToReplicaMessage::_Internal::state_transfer(const ToReplicaMessage* msg) {
+  return *msg->_impl_.msg_.state_transfer_;
+}
+void ToReplicaMessage::set_allocated_request(::dsnet::fastpaxos::proto::RequestMessage* request) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  clear_msg();
+  if (request) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(request);
+    if (message_arena != submessage_arena) {
+      request = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, request, submessage_arena);
+    }
+    set_has_request();
+    _impl_.msg_.request_ = request;
+  }
+  // @@protoc_insertion_point(field_set_allocated:dsnet.fastpaxos.proto.ToReplicaMessage.request)
+}
+void ToReplicaMessage::set_allocated_unlogged_request(::dsnet::fastpaxos::proto::UnloggedRequestMessage* unlogged_request) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  clear_msg();
+  if (unlogged_request) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(unlogged_request);
+    if (message_arena != submessage_arena) {
+      unlogged_request = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, unlogged_request, submessage_arena);
+    }
+    set_has_unlogged_request();
+    _impl_.msg_.unlogged_request_ = unlogged_request;
+  }
+  // @@protoc_insertion_point(field_set_allocated:dsnet.fastpaxos.proto.ToReplicaMessage.unlogged_request)
+}
+void ToReplicaMessage::set_allocated_prepare(::dsnet::fastpaxos::proto::PrepareMessage* prepare) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  clear_msg();
+  if (prepare) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(prepare);
+    if (message_arena != submessage_arena) {
+      prepare = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, prepare, submessage_arena);
+    }
+    set_has_prepare();
+    _impl_.msg_.prepare_ = prepare;
+  }
+  // @@protoc_insertion_point(field_set_allocated:dsnet.fastpaxos.proto.ToReplicaMessage.prepare)
+}
+void ToReplicaMessage::set_allocated_prepare_ok(::dsnet::fastpaxos::proto::PrepareOKMessage* prepare_ok) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  clear_msg();
+  if (prepare_ok) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(prepare_ok);
+    if (message_arena != submessage_arena) {
+      prepare_ok = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, prepare_ok, submessage_arena);
+    }
+    set_has_prepare_ok();
+    _impl_.msg_.prepare_ok_ = prepare_ok;
+  }
+  // @@protoc_insertion_point(field_set_allocated:dsnet.fastpaxos.proto.ToReplicaMessage.prepare_ok)
+}
+void ToReplicaMessage::set_allocated_commit(::dsnet::fastpaxos::proto::CommitMessage* commit) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  clear_msg();
+  if (commit) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(commit);
+    if (message_arena != submessage_arena) {
+      commit = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, commit, submessage_arena);
+    }
+    set_has_commit();
+    _impl_.msg_.commit_ = commit;
+  }
+  // @@protoc_insertion_point(field_set_allocated:dsnet.fastpaxos.proto.ToReplicaMessage.commit)
+}
+void ToReplicaMessage::set_allocated_request_state_transfer(::dsnet::fastpaxos::proto::RequestStateTransferMessage* request_state_transfer) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  clear_msg();
+  if (request_state_transfer) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(request_state_transfer);
+    if (message_arena != submessage_arena) {
+      request_state_transfer = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, request_state_transfer, submessage_arena);
+    }
+    set_has_request_state_transfer();
+    _impl_.msg_.request_state_transfer_ = request_state_transfer;
+  }
+  // @@protoc_insertion_point(field_set_allocated:dsnet.fastpaxos.proto.ToReplicaMessage.request_state_transfer)
+}
+void ToReplicaMessage::set_allocated_state_transfer(::dsnet::fastpaxos::proto::StateTransferMessage* state_transfer) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  clear_msg();
+  if (state_transfer) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(state_transfer);
+    if (message_arena != submessage_arena) {
+      state_transfer = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, state_transfer, submessage_arena);
+    }
+    set_has_state_transfer();
+    _impl_.msg_.state_transfer_ = state_transfer;
+  }
+  // @@protoc_insertion_point(field_set_allocated:dsnet.fastpaxos.proto.ToReplicaMessage.state_transfer)
+}
+ToReplicaMessage::ToReplicaMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:dsnet.fastpaxos.proto.ToReplicaMessage)
+}
+ToReplicaMessage::ToReplicaMessage(const ToReplicaMessage& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  ToReplicaMessage* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.msg_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , /*decltype(_impl_._oneof_case_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  clear_has_msg();
+  switch (from.msg_case()) {
+    case kRequest: {
+      _this->_internal_mutable_request()->::dsnet::fastpaxos::proto::RequestMessage::MergeFrom(
+          from._internal_request());
+      break;
+    }
+    case kUnloggedRequest: {
+      _this->_internal_mutable_unlogged_request()->::dsnet::fastpaxos::proto::UnloggedRequestMessage::MergeFrom(
+          from._internal_unlogged_request());
+      break;
+    }
+    case kPrepare: {
+      _this->_internal_mutable_prepare()->::dsnet::fastpaxos::proto::PrepareMessage::MergeFrom(
+          from._internal_prepare());
+      break;
+    }
+    case kPrepareOk: {
+      _this->_internal_mutable_prepare_ok()->::dsnet::fastpaxos::proto::PrepareOKMessage::MergeFrom(
+          from._internal_prepare_ok());
+      break;
+    }
+    case kCommit: {
+      _this->_internal_mutable_commit()->::dsnet::fastpaxos::proto::CommitMessage::MergeFrom(
+          from._internal_commit());
+      break;
+    }
+    case kRequestStateTransfer: {
+      _this->_internal_mutable_request_state_transfer()->::dsnet::fastpaxos::proto::RequestStateTransferMessage::MergeFrom(
+          from._internal_request_state_transfer());
+      break;
+    }
+    case kStateTransfer: {
+      _this->_internal_mutable_state_transfer()->::dsnet::fastpaxos::proto::StateTransferMessage::MergeFrom(
+          from._internal_state_transfer());
+      break;
+    }
+    case MSG_NOT_SET: {
+      break;
+    }
+  }
+  // @@protoc_insertion_point(copy_constructor:dsnet.fastpaxos.proto.ToReplicaMessage)
+}
+
+inline void ToReplicaMessage::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.msg_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , /*decltype(_impl_._oneof_case_)*/{}
+  };
+  clear_has_msg();
+}
+
+ToReplicaMessage::~ToReplicaMessage() {
+  // @@protoc_insertion_point(destructor:dsnet.fastpaxos.proto.ToReplicaMessage)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void ToReplicaMessage::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  if (has_msg()) {
+    clear_msg();
+  }
+}
+
+void ToReplicaMessage::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void ToReplicaMessage::clear_msg() {
+// @@protoc_insertion_point(one_of_clear_start:dsnet.fastpaxos.proto.ToReplicaMessage)
+  switch (msg_case()) {
+    case kRequest: {
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.msg_.request_;
+      }
+      break;
+    }
+    case kUnloggedRequest: {
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.msg_.unlogged_request_;
+      }
+      break;
+    }
+    case kPrepare: {
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.msg_.prepare_;
+      }
+      break;
+    }
+    case kPrepareOk: {
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.msg_.prepare_ok_;
+      }
+      break;
+    }
+    case kCommit: {
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.msg_.commit_;
+      }
+      break;
+    }
+    case kRequestStateTransfer: {
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.msg_.request_state_transfer_;
+      }
+      break;
+    }
+    case kStateTransfer: {
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.msg_.state_transfer_;
+      }
+      break;
+    }
+    case MSG_NOT_SET: {
+      break;
+    }
+  }
+  _impl_._oneof_case_[0] = MSG_NOT_SET;
+}
+
+
+void ToReplicaMessage::Clear() {
+// @@protoc_insertion_point(message_clear_start:dsnet.fastpaxos.proto.ToReplicaMessage)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  clear_msg();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* ToReplicaMessage::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // .dsnet.fastpaxos.proto.RequestMessage request = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr = ctx->ParseMessage(_internal_mutable_request(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .dsnet.fastpaxos.proto.UnloggedRequestMessage unlogged_request = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr = ctx->ParseMessage(_internal_mutable_unlogged_request(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .dsnet.fastpaxos.proto.PrepareMessage prepare = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          ptr = ctx->ParseMessage(_internal_mutable_prepare(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .dsnet.fastpaxos.proto.PrepareOKMessage prepare_ok = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          ptr = ctx->ParseMessage(_internal_mutable_prepare_ok(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .dsnet.fastpaxos.proto.CommitMessage commit = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 42)) {
+          ptr = ctx->ParseMessage(_internal_mutable_commit(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .dsnet.fastpaxos.proto.RequestStateTransferMessage request_state_transfer = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 50)) {
+          ptr = ctx->ParseMessage(_internal_mutable_request_state_transfer(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .dsnet.fastpaxos.proto.StateTransferMessage state_transfer = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 58)) {
+          ptr = ctx->ParseMessage(_internal_mutable_state_transfer(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* ToReplicaMessage::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:dsnet.fastpaxos.proto.ToReplicaMessage)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  switch (msg_case()) {
+    case kRequest: {
+      target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(1, _Internal::request(this),
+          _Internal::request(this).GetCachedSize(), target, stream);
+      break;
+    }
+    case kUnloggedRequest: {
+      target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(2, _Internal::unlogged_request(this),
+          _Internal::unlogged_request(this).GetCachedSize(), target, stream);
+      break;
+    }
+    case kPrepare: {
+      target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(3, _Internal::prepare(this),
+          _Internal::prepare(this).GetCachedSize(), target, stream);
+      break;
+    }
+    case kPrepareOk: {
+      target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(4, _Internal::prepare_ok(this),
+          _Internal::prepare_ok(this).GetCachedSize(), target, stream);
+      break;
+    }
+    case kCommit: {
+      target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(5, _Internal::commit(this),
+          _Internal::commit(this).GetCachedSize(), target, stream);
+      break;
+    }
+    case kRequestStateTransfer: {
+      target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(6, _Internal::request_state_transfer(this),
+          _Internal::request_state_transfer(this).GetCachedSize(), target, stream);
+      break;
+    }
+    case kStateTransfer: {
+      target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(7, _Internal::state_transfer(this),
+          _Internal::state_transfer(this).GetCachedSize(), target, stream);
+      break;
+    }
+    default: ;
+  }
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:dsnet.fastpaxos.proto.ToReplicaMessage)
+  return target;
+}
+
+size_t ToReplicaMessage::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:dsnet.fastpaxos.proto.ToReplicaMessage)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  switch (msg_case()) {
+    // .dsnet.fastpaxos.proto.RequestMessage request = 1;
+    case kRequest: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.msg_.request_);
+      break;
+    }
+    // .dsnet.fastpaxos.proto.UnloggedRequestMessage unlogged_request = 2;
+    case kUnloggedRequest: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.msg_.unlogged_request_);
+      break;
+    }
+    // .dsnet.fastpaxos.proto.PrepareMessage prepare = 3;
+    case kPrepare: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.msg_.prepare_);
+      break;
+    }
+    // .dsnet.fastpaxos.proto.PrepareOKMessage prepare_ok = 4;
+    case kPrepareOk: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.msg_.prepare_ok_);
+      break;
+    }
+    // .dsnet.fastpaxos.proto.CommitMessage commit = 5;
+    case kCommit: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.msg_.commit_);
+      break;
+    }
+    // .dsnet.fastpaxos.proto.RequestStateTransferMessage request_state_transfer = 6;
+    case kRequestStateTransfer: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.msg_.request_state_transfer_);
+      break;
+    }
+    // .dsnet.fastpaxos.proto.StateTransferMessage state_transfer = 7;
+    case kStateTransfer: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.msg_.state_transfer_);
+      break;
+    }
+    case MSG_NOT_SET: {
+      break;
+    }
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ToReplicaMessage::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    ToReplicaMessage::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ToReplicaMessage::GetClassData() const { return &_class_data_; }
+
+
+void ToReplicaMessage::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<ToReplicaMessage*>(&to_msg);
+  auto& from = static_cast<const ToReplicaMessage&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:dsnet.fastpaxos.proto.ToReplicaMessage)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  switch (from.msg_case()) {
+    case kRequest: {
+      _this->_internal_mutable_request()->::dsnet::fastpaxos::proto::RequestMessage::MergeFrom(
+          from._internal_request());
+      break;
+    }
+    case kUnloggedRequest: {
+      _this->_internal_mutable_unlogged_request()->::dsnet::fastpaxos::proto::UnloggedRequestMessage::MergeFrom(
+          from._internal_unlogged_request());
+      break;
+    }
+    case kPrepare: {
+      _this->_internal_mutable_prepare()->::dsnet::fastpaxos::proto::PrepareMessage::MergeFrom(
+          from._internal_prepare());
+      break;
+    }
+    case kPrepareOk: {
+      _this->_internal_mutable_prepare_ok()->::dsnet::fastpaxos::proto::PrepareOKMessage::MergeFrom(
+          from._internal_prepare_ok());
+      break;
+    }
+    case kCommit: {
+      _this->_internal_mutable_commit()->::dsnet::fastpaxos::proto::CommitMessage::MergeFrom(
+          from._internal_commit());
+      break;
+    }
+    case kRequestStateTransfer: {
+      _this->_internal_mutable_request_state_transfer()->::dsnet::fastpaxos::proto::RequestStateTransferMessage::MergeFrom(
+          from._internal_request_state_transfer());
+      break;
+    }
+    case kStateTransfer: {
+      _this->_internal_mutable_state_transfer()->::dsnet::fastpaxos::proto::StateTransferMessage::MergeFrom(
+          from._internal_state_transfer());
+      break;
+    }
+    case MSG_NOT_SET: {
+      break;
+    }
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void ToReplicaMessage::CopyFrom(const ToReplicaMessage& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:dsnet.fastpaxos.proto.ToReplicaMessage)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool ToReplicaMessage::IsInitialized() const {
+  switch (msg_case()) {
+    case kRequest: {
+      if (_internal_has_request()) {
+        if (!_impl_.msg_.request_->IsInitialized()) return false;
+      }
+      break;
+    }
+    case kUnloggedRequest: {
+      if (_internal_has_unlogged_request()) {
+        if (!_impl_.msg_.unlogged_request_->IsInitialized()) return false;
+      }
+      break;
+    }
+    case kPrepare: {
+      if (_internal_has_prepare()) {
+        if (!_impl_.msg_.prepare_->IsInitialized()) return false;
+      }
+      break;
+    }
+    case kPrepareOk: {
+      if (_internal_has_prepare_ok()) {
+        if (!_impl_.msg_.prepare_ok_->IsInitialized()) return false;
+      }
+      break;
+    }
+    case kCommit: {
+      if (_internal_has_commit()) {
+        if (!_impl_.msg_.commit_->IsInitialized()) return false;
+      }
+      break;
+    }
+    case kRequestStateTransfer: {
+      if (_internal_has_request_state_transfer()) {
+        if (!_impl_.msg_.request_state_transfer_->IsInitialized()) return false;
+      }
+      break;
+    }
+    case kStateTransfer: {
+      if (_internal_has_state_transfer()) {
+        if (!_impl_.msg_.state_transfer_->IsInitialized()) return false;
+      }
+      break;
+    }
+    case MSG_NOT_SET: {
+      break;
+    }
+  }
+  return true;
+}
+
+void ToReplicaMessage::InternalSwap(ToReplicaMessage* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_.msg_, other->_impl_.msg_);
+  swap(_impl_._oneof_case_[0], other->_impl_._oneof_case_[0]);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata ToReplicaMessage::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_replication_2ffastpaxos_2ffastpaxos_2dproto_2eproto_getter, &descriptor_table_replication_2ffastpaxos_2ffastpaxos_2dproto_2eproto_once,
+      file_level_metadata_replication_2ffastpaxos_2ffastpaxos_2dproto_2eproto[10]);
+}
+
+// @@protoc_insertion_point(namespace_scope)
+}  // namespace proto
+}  // namespace fastpaxos
+}  // namespace dsnet
+PROTOBUF_NAMESPACE_OPEN
+template<> PROTOBUF_NOINLINE ::dsnet::fastpaxos::proto::ReplyMessage*
+Arena::CreateMaybeMessage< ::dsnet::fastpaxos::proto::ReplyMessage >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::dsnet::fastpaxos::proto::ReplyMessage >(arena);
+}
+template<> PROTOBUF_NOINLINE ::dsnet::fastpaxos::proto::UnloggedReplyMessage*
+Arena::CreateMaybeMessage< ::dsnet::fastpaxos::proto::UnloggedReplyMessage >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::dsnet::fastpaxos::proto::UnloggedReplyMessage >(arena);
+}
+template<> PROTOBUF_NOINLINE ::dsnet::fastpaxos::proto::ToClientMessage*
+Arena::CreateMaybeMessage< ::dsnet::fastpaxos::proto::ToClientMessage >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::dsnet::fastpaxos::proto::ToClientMessage >(arena);
+}
+template<> PROTOBUF_NOINLINE ::dsnet::fastpaxos::proto::RequestMessage*
+Arena::CreateMaybeMessage< ::dsnet::fastpaxos::proto::RequestMessage >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::dsnet::fastpaxos::proto::RequestMessage >(arena);
+}
+template<> PROTOBUF_NOINLINE ::dsnet::fastpaxos::proto::UnloggedRequestMessage*
+Arena::CreateMaybeMessage< ::dsnet::fastpaxos::proto::UnloggedRequestMessage >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::dsnet::fastpaxos::proto::UnloggedRequestMessage >(arena);
+}
+template<> PROTOBUF_NOINLINE ::dsnet::fastpaxos::proto::PrepareOKMessage*
+Arena::CreateMaybeMessage< ::dsnet::fastpaxos::proto::PrepareOKMessage >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::dsnet::fastpaxos::proto::PrepareOKMessage >(arena);
+}
+template<> PROTOBUF_NOINLINE ::dsnet::fastpaxos::proto::PrepareMessage*
+Arena::CreateMaybeMessage< ::dsnet::fastpaxos::proto::PrepareMessage >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::dsnet::fastpaxos::proto::PrepareMessage >(arena);
+}
+template<> PROTOBUF_NOINLINE ::dsnet::fastpaxos::proto::CommitMessage*
+Arena::CreateMaybeMessage< ::dsnet::fastpaxos::proto::CommitMessage >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::dsnet::fastpaxos::proto::CommitMessage >(arena);
+}
+template<> PROTOBUF_NOINLINE ::dsnet::fastpaxos::proto::RequestStateTransferMessage*
+Arena::CreateMaybeMessage< ::dsnet::fastpaxos::proto::RequestStateTransferMessage >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::dsnet::fastpaxos::proto::RequestStateTransferMessage >(arena);
+}
+template<> PROTOBUF_NOINLINE ::dsnet::fastpaxos::proto::StateTransferMessage*
+Arena::CreateMaybeMessage< ::dsnet::fastpaxos::proto::StateTransferMessage >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::dsnet::fastpaxos::proto::StateTransferMessage >(arena);
+}
+template<> PROTOBUF_NOINLINE ::dsnet::fastpaxos::proto::ToReplicaMessage*
+Arena::CreateMaybeMessage< ::dsnet::fastpaxos::proto::ToReplicaMessage >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::dsnet::fastpaxos::proto::ToReplicaMessage >(arena);
+}
+PROTOBUF_NAMESPACE_CLOSE
+
+// @@protoc_insertion_point(global_scope)
+#include <google/protobuf/port_undef.inc>
@@ -0,0 +1,4167 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: replication/fastpaxos/fastpaxos-proto.proto
+
+#ifndef GOOGLE_PROTOBUF_INCLUDED_replication_2ffastpaxos_2ffastpaxos_2dproto_2eproto
+#define GOOGLE_PROTOBUF_INCLUDED_replication_2ffastpaxos_2ffastpaxos_2dproto_2eproto
+
+#include <limits>
+#include <string>
+
+#include <google/protobuf/port_def.inc>
+#if PROTOBUF_VERSION < 3021000
+#error This file was generated by a newer version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please update
+#error your headers.
+#endif
+#if 3021012 < PROTOBUF_MIN_PROTOC_VERSION
+#error This file was generated by an older version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please
+#error regenerate this file with a newer version of protoc.
+#endif
+
+#include <google/protobuf/port_undef.inc>
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/arena.h>
+#include <google/protobuf/arenastring.h>
+#include <google/protobuf/generated_message_util.h>
+#include <google/protobuf/metadata_lite.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/message.h>
+#include <google/protobuf/repeated_field.h>  // IWYU pragma: export
+#include <google/protobuf/extension_set.h>  // IWYU pragma: export
+#include <google/protobuf/unknown_field_set.h>
+#include "common/request.pb.h"
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+#define PROTOBUF_INTERNAL_EXPORT_replication_2ffastpaxos_2ffastpaxos_2dproto_2eproto
+PROTOBUF_NAMESPACE_OPEN
+namespace internal {
+class AnyMetadata;
+}  // namespace internal
+PROTOBUF_NAMESPACE_CLOSE
+
+// Internal implementation detail -- do not use these members.
+struct TableStruct_replication_2ffastpaxos_2ffastpaxos_2dproto_2eproto {
+  static const uint32_t offsets[];
+};
+extern const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_replication_2ffastpaxos_2ffastpaxos_2dproto_2eproto;
+namespace dsnet {
+namespace fastpaxos {
+namespace proto {
+class CommitMessage;
+struct CommitMessageDefaultTypeInternal;
+extern CommitMessageDefaultTypeInternal _CommitMessage_default_instance_;
+class PrepareMessage;
+struct PrepareMessageDefaultTypeInternal;
+extern PrepareMessageDefaultTypeInternal _PrepareMessage_default_instance_;
+class PrepareOKMessage;
+struct PrepareOKMessageDefaultTypeInternal;
+extern PrepareOKMessageDefaultTypeInternal _PrepareOKMessage_default_instance_;
+class ReplyMessage;
+struct ReplyMessageDefaultTypeInternal;
+extern ReplyMessageDefaultTypeInternal _ReplyMessage_default_instance_;
+class RequestMessage;
+struct RequestMessageDefaultTypeInternal;
+extern RequestMessageDefaultTypeInternal _RequestMessage_default_instance_;
+class RequestStateTransferMessage;
+struct RequestStateTransferMessageDefaultTypeInternal;
+extern RequestStateTransferMessageDefaultTypeInternal _RequestStateTransferMessage_default_instance_;
+class StateTransferMessage;
+struct StateTransferMessageDefaultTypeInternal;
+extern StateTransferMessageDefaultTypeInternal _StateTransferMessage_default_instance_;
+class ToClientMessage;
+struct ToClientMessageDefaultTypeInternal;
+extern ToClientMessageDefaultTypeInternal _ToClientMessage_default_instance_;
+class ToReplicaMessage;
+struct ToReplicaMessageDefaultTypeInternal;
+extern ToReplicaMessageDefaultTypeInternal _ToReplicaMessage_default_instance_;
+class UnloggedReplyMessage;
+struct UnloggedReplyMessageDefaultTypeInternal;
+extern UnloggedReplyMessageDefaultTypeInternal _UnloggedReplyMessage_default_instance_;
+class UnloggedRequestMessage;
+struct UnloggedRequestMessageDefaultTypeInternal;
+extern UnloggedRequestMessageDefaultTypeInternal _UnloggedRequestMessage_default_instance_;
+}  // namespace proto
+}  // namespace fastpaxos
+}  // namespace dsnet
+PROTOBUF_NAMESPACE_OPEN
+template<> ::dsnet::fastpaxos::proto::CommitMessage* Arena::CreateMaybeMessage<::dsnet::fastpaxos::proto::CommitMessage>(Arena*);
+template<> ::dsnet::fastpaxos::proto::PrepareMessage* Arena::CreateMaybeMessage<::dsnet::fastpaxos::proto::PrepareMessage>(Arena*);
+template<> ::dsnet::fastpaxos::proto::PrepareOKMessage* Arena::CreateMaybeMessage<::dsnet::fastpaxos::proto::PrepareOKMessage>(Arena*);
+template<> ::dsnet::fastpaxos::proto::ReplyMessage* Arena::CreateMaybeMessage<::dsnet::fastpaxos::proto::ReplyMessage>(Arena*);
+template<> ::dsnet::fastpaxos::proto::RequestMessage* Arena::CreateMaybeMessage<::dsnet::fastpaxos::proto::RequestMessage>(Arena*);
+template<> ::dsnet::fastpaxos::proto::RequestStateTransferMessage* Arena::CreateMaybeMessage<::dsnet::fastpaxos::proto::RequestStateTransferMessage>(Arena*);
+template<> ::dsnet::fastpaxos::proto::StateTransferMessage* Arena::CreateMaybeMessage<::dsnet::fastpaxos::proto::StateTransferMessage>(Arena*);
+template<> ::dsnet::fastpaxos::proto::ToClientMessage* Arena::CreateMaybeMessage<::dsnet::fastpaxos::proto::ToClientMessage>(Arena*);
+template<> ::dsnet::fastpaxos::proto::ToReplicaMessage* Arena::CreateMaybeMessage<::dsnet::fastpaxos::proto::ToReplicaMessage>(Arena*);
+template<> ::dsnet::fastpaxos::proto::UnloggedReplyMessage* Arena::CreateMaybeMessage<::dsnet::fastpaxos::proto::UnloggedReplyMessage>(Arena*);
+template<> ::dsnet::fastpaxos::proto::UnloggedRequestMessage* Arena::CreateMaybeMessage<::dsnet::fastpaxos::proto::UnloggedRequestMessage>(Arena*);
+PROTOBUF_NAMESPACE_CLOSE
+namespace dsnet {
+namespace fastpaxos {
+namespace proto {
+
+// ===================================================================
+
+class ReplyMessage final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:dsnet.fastpaxos.proto.ReplyMessage) */ {
+ public:
+  inline ReplyMessage() : ReplyMessage(nullptr) {}
+  ~ReplyMessage() override;
+  explicit PROTOBUF_CONSTEXPR ReplyMessage(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  ReplyMessage(const ReplyMessage& from);
+  ReplyMessage(ReplyMessage&& from) noexcept
+    : ReplyMessage() {
+    *this = ::std::move(from);
+  }
+
+  inline ReplyMessage& operator=(const ReplyMessage& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline ReplyMessage& operator=(ReplyMessage&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ReplyMessage& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const ReplyMessage* internal_default_instance() {
+    return reinterpret_cast<const ReplyMessage*>(
+               &_ReplyMessage_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    0;
+
+  friend void swap(ReplyMessage& a, ReplyMessage& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(ReplyMessage* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ReplyMessage* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  ReplyMessage* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ReplyMessage>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const ReplyMessage& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ReplyMessage& from) {
+    ReplyMessage::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(ReplyMessage* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "dsnet.fastpaxos.proto.ReplyMessage";
+  }
+  protected:
+  explicit ReplyMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kReplyFieldNumber = 3,
+    kViewFieldNumber = 1,
+    kOpnumFieldNumber = 2,
+    kClientreqidFieldNumber = 4,
+  };
+  // required bytes reply = 3;
+  bool has_reply() const;
+  private:
+  bool _internal_has_reply() const;
+  public:
+  void clear_reply();
+  const std::string& reply() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_reply(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_reply();
+  PROTOBUF_NODISCARD std::string* release_reply();
+  void set_allocated_reply(std::string* reply);
+  private:
+  const std::string& _internal_reply() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_reply(const std::string& value);
+  std::string* _internal_mutable_reply();
+  public:
+
+  // required uint64 view = 1;
+  bool has_view() const;
+  private:
+  bool _internal_has_view() const;
+  public:
+  void clear_view();
+  uint64_t view() const;
+  void set_view(uint64_t value);
+  private:
+  uint64_t _internal_view() const;
+  void _internal_set_view(uint64_t value);
+  public:
+
+  // required uint64 opnum = 2;
+  bool has_opnum() const;
+  private:
+  bool _internal_has_opnum() const;
+  public:
+  void clear_opnum();
+  uint64_t opnum() const;
+  void set_opnum(uint64_t value);
+  private:
+  uint64_t _internal_opnum() const;
+  void _internal_set_opnum(uint64_t value);
+  public:
+
+  // required uint64 clientreqid = 4;
+  bool has_clientreqid() const;
+  private:
+  bool _internal_has_clientreqid() const;
+  public:
+  void clear_clientreqid();
+  uint64_t clientreqid() const;
+  void set_clientreqid(uint64_t value);
+  private:
+  uint64_t _internal_clientreqid() const;
+  void _internal_set_clientreqid(uint64_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:dsnet.fastpaxos.proto.ReplyMessage)
+ private:
+  class _Internal;
+
+  // helper for ByteSizeLong()
+  size_t RequiredFieldsByteSizeFallback() const;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr reply_;
+    uint64_t view_;
+    uint64_t opnum_;
+    uint64_t clientreqid_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_replication_2ffastpaxos_2ffastpaxos_2dproto_2eproto;
+};
+// -------------------------------------------------------------------
+
+class UnloggedReplyMessage final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:dsnet.fastpaxos.proto.UnloggedReplyMessage) */ {
+ public:
+  inline UnloggedReplyMessage() : UnloggedReplyMessage(nullptr) {}
+  ~UnloggedReplyMessage() override;
+  explicit PROTOBUF_CONSTEXPR UnloggedReplyMessage(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  UnloggedReplyMessage(const UnloggedReplyMessage& from);
+  UnloggedReplyMessage(UnloggedReplyMessage&& from) noexcept
+    : UnloggedReplyMessage() {
+    *this = ::std::move(from);
+  }
+
+  inline UnloggedReplyMessage& operator=(const UnloggedReplyMessage& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline UnloggedReplyMessage& operator=(UnloggedReplyMessage&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const UnloggedReplyMessage& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const UnloggedReplyMessage* internal_default_instance() {
+    return reinterpret_cast<const UnloggedReplyMessage*>(
+               &_UnloggedReplyMessage_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    1;
+
+  friend void swap(UnloggedReplyMessage& a, UnloggedReplyMessage& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(UnloggedReplyMessage* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(UnloggedReplyMessage* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  UnloggedReplyMessage* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<UnloggedReplyMessage>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const UnloggedReplyMessage& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const UnloggedReplyMessage& from) {
+    UnloggedReplyMessage::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(UnloggedReplyMessage* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "dsnet.fastpaxos.proto.UnloggedReplyMessage";
+  }
+  protected:
+  explicit UnloggedReplyMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kReplyFieldNumber = 1,
+  };
+  // required bytes reply = 1;
+  bool has_reply() const;
+  private:
+  bool _internal_has_reply() const;
+  public:
+  void clear_reply();
+  const std::string& reply() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_reply(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_reply();
+  PROTOBUF_NODISCARD std::string* release_reply();
+  void set_allocated_reply(std::string* reply);
+  private:
+  const std::string& _internal_reply() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_reply(const std::string& value);
+  std::string* _internal_mutable_reply();
+  public:
+
+  // @@protoc_insertion_point(class_scope:dsnet.fastpaxos.proto.UnloggedReplyMessage)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr reply_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_replication_2ffastpaxos_2ffastpaxos_2dproto_2eproto;
+};
+// -------------------------------------------------------------------
+
+class ToClientMessage final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:dsnet.fastpaxos.proto.ToClientMessage) */ {
+ public:
+  inline ToClientMessage() : ToClientMessage(nullptr) {}
+  ~ToClientMessage() override;
+  explicit PROTOBUF_CONSTEXPR ToClientMessage(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  ToClientMessage(const ToClientMessage& from);
+  ToClientMessage(ToClientMessage&& from) noexcept
+    : ToClientMessage() {
+    *this = ::std::move(from);
+  }
+
+  inline ToClientMessage& operator=(const ToClientMessage& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline ToClientMessage& operator=(ToClientMessage&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ToClientMessage& default_instance() {
+    return *internal_default_instance();
+  }
+  enum MsgCase {
+    kReply = 1,
+    kUnloggedReply = 2,
+    MSG_NOT_SET = 0,
+  };
+
+  static inline const ToClientMessage* internal_default_instance() {
+    return reinterpret_cast<const ToClientMessage*>(
+               &_ToClientMessage_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    2;
+
+  friend void swap(ToClientMessage& a, ToClientMessage& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(ToClientMessage* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ToClientMessage* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  ToClientMessage* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ToClientMessage>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const ToClientMessage& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ToClientMessage& from) {
+    ToClientMessage::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(ToClientMessage* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "dsnet.fastpaxos.proto.ToClientMessage";
+  }
+  protected:
+  explicit ToClientMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kReplyFieldNumber = 1,
+    kUnloggedReplyFieldNumber = 2,
+  };
+  // .dsnet.fastpaxos.proto.ReplyMessage reply = 1;
+  bool has_reply() const;
+  private:
+  bool _internal_has_reply() const;
+  public:
+  void clear_reply();
+  const ::dsnet::fastpaxos::proto::ReplyMessage& reply() const;
+  PROTOBUF_NODISCARD ::dsnet::fastpaxos::proto::ReplyMessage* release_reply();
+  ::dsnet::fastpaxos::proto::ReplyMessage* mutable_reply();
+  void set_allocated_reply(::dsnet::fastpaxos::proto::ReplyMessage* reply);
+  private:
+  const ::dsnet::fastpaxos::proto::ReplyMessage& _internal_reply() const;
+  ::dsnet::fastpaxos::proto::ReplyMessage* _internal_mutable_reply();
+  public:
+  void unsafe_arena_set_allocated_reply(
+      ::dsnet::fastpaxos::proto::ReplyMessage* reply);
+  ::dsnet::fastpaxos::proto::ReplyMessage* unsafe_arena_release_reply();
+
+  // .dsnet.fastpaxos.proto.UnloggedReplyMessage unlogged_reply = 2;
+  bool has_unlogged_reply() const;
+  private:
+  bool _internal_has_unlogged_reply() const;
+  public:
+  void clear_unlogged_reply();
+  const ::dsnet::fastpaxos::proto::UnloggedReplyMessage& unlogged_reply() const;
+  PROTOBUF_NODISCARD ::dsnet::fastpaxos::proto::UnloggedReplyMessage* release_unlogged_reply();
+  ::dsnet::fastpaxos::proto::UnloggedReplyMessage* mutable_unlogged_reply();
+  void set_allocated_unlogged_reply(::dsnet::fastpaxos::proto::UnloggedReplyMessage* unlogged_reply);
+  private:
+  const ::dsnet::fastpaxos::proto::UnloggedReplyMessage& _internal_unlogged_reply() const;
+  ::dsnet::fastpaxos::proto::UnloggedReplyMessage* _internal_mutable_unlogged_reply();
+  public:
+  void unsafe_arena_set_allocated_unlogged_reply(
+      ::dsnet::fastpaxos::proto::UnloggedReplyMessage* unlogged_reply);
+  ::dsnet::fastpaxos::proto::UnloggedReplyMessage* unsafe_arena_release_unlogged_reply();
+
+  void clear_msg();
+  MsgCase msg_case() const;
+  // @@protoc_insertion_point(class_scope:dsnet.fastpaxos.proto.ToClientMessage)
+ private:
+  class _Internal;
+  void set_has_reply();
+  void set_has_unlogged_reply();
+
+  inline bool has_msg() const;
+  inline void clear_has_msg();
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    union MsgUnion {
+      constexpr MsgUnion() : _constinit_{} {}
+        ::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized _constinit_;
+      ::dsnet::fastpaxos::proto::ReplyMessage* reply_;
+      ::dsnet::fastpaxos::proto::UnloggedReplyMessage* unlogged_reply_;
+    } msg_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    uint32_t _oneof_case_[1];
+
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_replication_2ffastpaxos_2ffastpaxos_2dproto_2eproto;
+};
+// -------------------------------------------------------------------
+
+class RequestMessage final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:dsnet.fastpaxos.proto.RequestMessage) */ {
+ public:
+  inline RequestMessage() : RequestMessage(nullptr) {}
+  ~RequestMessage() override;
+  explicit PROTOBUF_CONSTEXPR RequestMessage(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  RequestMessage(const RequestMessage& from);
+  RequestMessage(RequestMessage&& from) noexcept
+    : RequestMessage() {
+    *this = ::std::move(from);
+  }
+
+  inline RequestMessage& operator=(const RequestMessage& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline RequestMessage& operator=(RequestMessage&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const RequestMessage& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const RequestMessage* internal_default_instance() {
+    return reinterpret_cast<const RequestMessage*>(
+               &_RequestMessage_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    3;
+
+  friend void swap(RequestMessage& a, RequestMessage& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(RequestMessage* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(RequestMessage* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  RequestMessage* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<RequestMessage>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const RequestMessage& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const RequestMessage& from) {
+    RequestMessage::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(RequestMessage* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "dsnet.fastpaxos.proto.RequestMessage";
+  }
+  protected:
+  explicit RequestMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kReqFieldNumber = 1,
+  };
+  // required .dsnet.Request req = 1;
+  bool has_req() const;
+  private:
+  bool _internal_has_req() const;
+  public:
+  void clear_req();
+  const ::dsnet::Request& req() const;
+  PROTOBUF_NODISCARD ::dsnet::Request* release_req();
+  ::dsnet::Request* mutable_req();
+  void set_allocated_req(::dsnet::Request* req);
+  private:
+  const ::dsnet::Request& _internal_req() const;
+  ::dsnet::Request* _internal_mutable_req();
+  public:
+  void unsafe_arena_set_allocated_req(
+      ::dsnet::Request* req);
+  ::dsnet::Request* unsafe_arena_release_req();
+
+  // @@protoc_insertion_point(class_scope:dsnet.fastpaxos.proto.RequestMessage)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::dsnet::Request* req_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_replication_2ffastpaxos_2ffastpaxos_2dproto_2eproto;
+};
+// -------------------------------------------------------------------
+
+class UnloggedRequestMessage final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:dsnet.fastpaxos.proto.UnloggedRequestMessage) */ {
+ public:
+  inline UnloggedRequestMessage() : UnloggedRequestMessage(nullptr) {}
+  ~UnloggedRequestMessage() override;
+  explicit PROTOBUF_CONSTEXPR UnloggedRequestMessage(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  UnloggedRequestMessage(const UnloggedRequestMessage& from);
+  UnloggedRequestMessage(UnloggedRequestMessage&& from) noexcept
+    : UnloggedRequestMessage() {
+    *this = ::std::move(from);
+  }
+
+  inline UnloggedRequestMessage& operator=(const UnloggedRequestMessage& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline UnloggedRequestMessage& operator=(UnloggedRequestMessage&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const UnloggedRequestMessage& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const UnloggedRequestMessage* internal_default_instance() {
+    return reinterpret_cast<const UnloggedRequestMessage*>(
+               &_UnloggedRequestMessage_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    4;
+
+  friend void swap(UnloggedRequestMessage& a, UnloggedRequestMessage& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(UnloggedRequestMessage* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(UnloggedRequestMessage* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  UnloggedRequestMessage* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<UnloggedRequestMessage>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const UnloggedRequestMessage& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const UnloggedRequestMessage& from) {
+    UnloggedRequestMessage::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(UnloggedRequestMessage* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "dsnet.fastpaxos.proto.UnloggedRequestMessage";
+  }
+  protected:
+  explicit UnloggedRequestMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kReqFieldNumber = 1,
+  };
+  // required .dsnet.UnloggedRequest req = 1;
+  bool has_req() const;
+  private:
+  bool _internal_has_req() const;
+  public:
+  void clear_req();
+  const ::dsnet::UnloggedRequest& req() const;
+  PROTOBUF_NODISCARD ::dsnet::UnloggedRequest* release_req();
+  ::dsnet::UnloggedRequest* mutable_req();
+  void set_allocated_req(::dsnet::UnloggedRequest* req);
+  private:
+  const ::dsnet::UnloggedRequest& _internal_req() const;
+  ::dsnet::UnloggedRequest* _internal_mutable_req();
+  public:
+  void unsafe_arena_set_allocated_req(
+      ::dsnet::UnloggedRequest* req);
+  ::dsnet::UnloggedRequest* unsafe_arena_release_req();
+
+  // @@protoc_insertion_point(class_scope:dsnet.fastpaxos.proto.UnloggedRequestMessage)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::dsnet::UnloggedRequest* req_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_replication_2ffastpaxos_2ffastpaxos_2dproto_2eproto;
+};
+// -------------------------------------------------------------------
+
+class PrepareOKMessage final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:dsnet.fastpaxos.proto.PrepareOKMessage) */ {
+ public:
+  inline PrepareOKMessage() : PrepareOKMessage(nullptr) {}
+  ~PrepareOKMessage() override;
+  explicit PROTOBUF_CONSTEXPR PrepareOKMessage(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  PrepareOKMessage(const PrepareOKMessage& from);
+  PrepareOKMessage(PrepareOKMessage&& from) noexcept
+    : PrepareOKMessage() {
+    *this = ::std::move(from);
+  }
+
+  inline PrepareOKMessage& operator=(const PrepareOKMessage& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline PrepareOKMessage& operator=(PrepareOKMessage&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const PrepareOKMessage& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const PrepareOKMessage* internal_default_instance() {
+    return reinterpret_cast<const PrepareOKMessage*>(
+               &_PrepareOKMessage_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    5;
+
+  friend void swap(PrepareOKMessage& a, PrepareOKMessage& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(PrepareOKMessage* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(PrepareOKMessage* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  PrepareOKMessage* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<PrepareOKMessage>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const PrepareOKMessage& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const PrepareOKMessage& from) {
+    PrepareOKMessage::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(PrepareOKMessage* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "dsnet.fastpaxos.proto.PrepareOKMessage";
+  }
+  protected:
+  explicit PrepareOKMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kReqFieldNumber = 4,
+    kViewFieldNumber = 1,
+    kOpnumFieldNumber = 2,
+    kReplicaIdxFieldNumber = 3,
+    kSlowpathFieldNumber = 5,
+  };
+  // required .dsnet.Request req = 4;
+  bool has_req() const;
+  private:
+  bool _internal_has_req() const;
+  public:
+  void clear_req();
+  const ::dsnet::Request& req() const;
+  PROTOBUF_NODISCARD ::dsnet::Request* release_req();
+  ::dsnet::Request* mutable_req();
+  void set_allocated_req(::dsnet::Request* req);
+  private:
+  const ::dsnet::Request& _internal_req() const;
+  ::dsnet::Request* _internal_mutable_req();
+  public:
+  void unsafe_arena_set_allocated_req(
+      ::dsnet::Request* req);
+  ::dsnet::Request* unsafe_arena_release_req();
+
+  // required uint64 view = 1;
+  bool has_view() const;
+  private:
+  bool _internal_has_view() const;
+  public:
+  void clear_view();
+  uint64_t view() const;
+  void set_view(uint64_t value);
+  private:
+  uint64_t _internal_view() const;
+  void _internal_set_view(uint64_t value);
+  public:
+
+  // required uint64 opnum = 2;
+  bool has_opnum() const;
+  private:
+  bool _internal_has_opnum() const;
+  public:
+  void clear_opnum();
+  uint64_t opnum() const;
+  void set_opnum(uint64_t value);
+  private:
+  uint64_t _internal_opnum() const;
+  void _internal_set_opnum(uint64_t value);
+  public:
+
+  // required uint32 replicaIdx = 3;
+  bool has_replicaidx() const;
+  private:
+  bool _internal_has_replicaidx() const;
+  public:
+  void clear_replicaidx();
+  uint32_t replicaidx() const;
+  void set_replicaidx(uint32_t value);
+  private:
+  uint32_t _internal_replicaidx() const;
+  void _internal_set_replicaidx(uint32_t value);
+  public:
+
+  // required uint32 slowpath = 5;
+  bool has_slowpath() const;
+  private:
+  bool _internal_has_slowpath() const;
+  public:
+  void clear_slowpath();
+  uint32_t slowpath() const;
+  void set_slowpath(uint32_t value);
+  private:
+  uint32_t _internal_slowpath() const;
+  void _internal_set_slowpath(uint32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:dsnet.fastpaxos.proto.PrepareOKMessage)
+ private:
+  class _Internal;
+
+  // helper for ByteSizeLong()
+  size_t RequiredFieldsByteSizeFallback() const;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::dsnet::Request* req_;
+    uint64_t view_;
+    uint64_t opnum_;
+    uint32_t replicaidx_;
+    uint32_t slowpath_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_replication_2ffastpaxos_2ffastpaxos_2dproto_2eproto;
+};
+// -------------------------------------------------------------------
+
+class PrepareMessage final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:dsnet.fastpaxos.proto.PrepareMessage) */ {
+ public:
+  inline PrepareMessage() : PrepareMessage(nullptr) {}
+  ~PrepareMessage() override;
+  explicit PROTOBUF_CONSTEXPR PrepareMessage(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  PrepareMessage(const PrepareMessage& from);
+  PrepareMessage(PrepareMessage&& from) noexcept
+    : PrepareMessage() {
+    *this = ::std::move(from);
+  }
+
+  inline PrepareMessage& operator=(const PrepareMessage& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline PrepareMessage& operator=(PrepareMessage&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const PrepareMessage& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const PrepareMessage* internal_default_instance() {
+    return reinterpret_cast<const PrepareMessage*>(
+               &_PrepareMessage_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    6;
+
+  friend void swap(PrepareMessage& a, PrepareMessage& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(PrepareMessage* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(PrepareMessage* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  PrepareMessage* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<PrepareMessage>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const PrepareMessage& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const PrepareMessage& from) {
+    PrepareMessage::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(PrepareMessage* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "dsnet.fastpaxos.proto.PrepareMessage";
+  }
+  protected:
+  explicit PrepareMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kReqFieldNumber = 3,
+    kViewFieldNumber = 1,
+    kOpnumFieldNumber = 2,
+  };
+  // required .dsnet.Request req = 3;
+  bool has_req() const;
+  private:
+  bool _internal_has_req() const;
+  public:
+  void clear_req();
+  const ::dsnet::Request& req() const;
+  PROTOBUF_NODISCARD ::dsnet::Request* release_req();
+  ::dsnet::Request* mutable_req();
+  void set_allocated_req(::dsnet::Request* req);
+  private:
+  const ::dsnet::Request& _internal_req() const;
+  ::dsnet::Request* _internal_mutable_req();
+  public:
+  void unsafe_arena_set_allocated_req(
+      ::dsnet::Request* req);
+  ::dsnet::Request* unsafe_arena_release_req();
+
+  // required uint64 view = 1;
+  bool has_view() const;
+  private:
+  bool _internal_has_view() const;
+  public:
+  void clear_view();
+  uint64_t view() const;
+  void set_view(uint64_t value);
+  private:
+  uint64_t _internal_view() const;
+  void _internal_set_view(uint64_t value);
+  public:
+
+  // required uint64 opnum = 2;
+  bool has_opnum() const;
+  private:
+  bool _internal_has_opnum() const;
+  public:
+  void clear_opnum();
+  uint64_t opnum() const;
+  void set_opnum(uint64_t value);
+  private:
+  uint64_t _internal_opnum() const;
+  void _internal_set_opnum(uint64_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:dsnet.fastpaxos.proto.PrepareMessage)
+ private:
+  class _Internal;
+
+  // helper for ByteSizeLong()
+  size_t RequiredFieldsByteSizeFallback() const;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::dsnet::Request* req_;
+    uint64_t view_;
+    uint64_t opnum_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_replication_2ffastpaxos_2ffastpaxos_2dproto_2eproto;
+};
+// -------------------------------------------------------------------
+
+class CommitMessage final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:dsnet.fastpaxos.proto.CommitMessage) */ {
+ public:
+  inline CommitMessage() : CommitMessage(nullptr) {}
+  ~CommitMessage() override;
+  explicit PROTOBUF_CONSTEXPR CommitMessage(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  CommitMessage(const CommitMessage& from);
+  CommitMessage(CommitMessage&& from) noexcept
+    : CommitMessage() {
+    *this = ::std::move(from);
+  }
+
+  inline CommitMessage& operator=(const CommitMessage& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline CommitMessage& operator=(CommitMessage&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const CommitMessage& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const CommitMessage* internal_default_instance() {
+    return reinterpret_cast<const CommitMessage*>(
+               &_CommitMessage_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    7;
+
+  friend void swap(CommitMessage& a, CommitMessage& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(CommitMessage* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(CommitMessage* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  CommitMessage* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<CommitMessage>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const CommitMessage& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const CommitMessage& from) {
+    CommitMessage::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(CommitMessage* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "dsnet.fastpaxos.proto.CommitMessage";
+  }
+  protected:
+  explicit CommitMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kReqFieldNumber = 3,
+    kViewFieldNumber = 1,
+    kOpnumFieldNumber = 2,
+  };
+  // required .dsnet.Request req = 3;
+  bool has_req() const;
+  private:
+  bool _internal_has_req() const;
+  public:
+  void clear_req();
+  const ::dsnet::Request& req() const;
+  PROTOBUF_NODISCARD ::dsnet::Request* release_req();
+  ::dsnet::Request* mutable_req();
+  void set_allocated_req(::dsnet::Request* req);
+  private:
+  const ::dsnet::Request& _internal_req() const;
+  ::dsnet::Request* _internal_mutable_req();
+  public:
+  void unsafe_arena_set_allocated_req(
+      ::dsnet::Request* req);
+  ::dsnet::Request* unsafe_arena_release_req();
+
+  // required uint64 view = 1;
+  bool has_view() const;
+  private:
+  bool _internal_has_view() const;
+  public:
+  void clear_view();
+  uint64_t view() const;
+  void set_view(uint64_t value);
+  private:
+  uint64_t _internal_view() const;
+  void _internal_set_view(uint64_t value);
+  public:
+
+  // required uint64 opnum = 2;
+  bool has_opnum() const;
+  private:
+  bool _internal_has_opnum() const;
+  public:
+  void clear_opnum();
+  uint64_t opnum() const;
+  void set_opnum(uint64_t value);
+  private:
+  uint64_t _internal_opnum() const;
+  void _internal_set_opnum(uint64_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:dsnet.fastpaxos.proto.CommitMessage)
+ private:
+  class _Internal;
+
+  // helper for ByteSizeLong()
+  size_t RequiredFieldsByteSizeFallback() const;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::dsnet::Request* req_;
+    uint64_t view_;
+    uint64_t opnum_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_replication_2ffastpaxos_2ffastpaxos_2dproto_2eproto;
+};
+// -------------------------------------------------------------------
+
+class RequestStateTransferMessage final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:dsnet.fastpaxos.proto.RequestStateTransferMessage) */ {
+ public:
+  inline RequestStateTransferMessage() : RequestStateTransferMessage(nullptr) {}
+  ~RequestStateTransferMessage() override;
+  explicit PROTOBUF_CONSTEXPR RequestStateTransferMessage(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  RequestStateTransferMessage(const RequestStateTransferMessage& from);
+  RequestStateTransferMessage(RequestStateTransferMessage&& from) noexcept
+    : RequestStateTransferMessage() {
+    *this = ::std::move(from);
+  }
+
+  inline RequestStateTransferMessage& operator=(const RequestStateTransferMessage& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline RequestStateTransferMessage& operator=(RequestStateTransferMessage&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const RequestStateTransferMessage& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const RequestStateTransferMessage* internal_default_instance() {
+    return reinterpret_cast<const RequestStateTransferMessage*>(
+               &_RequestStateTransferMessage_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    8;
+
+  friend void swap(RequestStateTransferMessage& a, RequestStateTransferMessage& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(RequestStateTransferMessage* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(RequestStateTransferMessage* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  RequestStateTransferMessage* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<RequestStateTransferMessage>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const RequestStateTransferMessage& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const RequestStateTransferMessage& from) {
+    RequestStateTransferMessage::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(RequestStateTransferMessage* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "dsnet.fastpaxos.proto.RequestStateTransferMessage";
+  }
+  protected:
+  explicit RequestStateTransferMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kViewFieldNumber = 1,
+    kOpnumFieldNumber = 2,
+  };
+  // required uint64 view = 1;
+  bool has_view() const;
+  private:
+  bool _internal_has_view() const;
+  public:
+  void clear_view();
+  uint64_t view() const;
+  void set_view(uint64_t value);
+  private:
+  uint64_t _internal_view() const;
+  void _internal_set_view(uint64_t value);
+  public:
+
+  // required uint64 opnum = 2;
+  bool has_opnum() const;
+  private:
+  bool _internal_has_opnum() const;
+  public:
+  void clear_opnum();
+  uint64_t opnum() const;
+  void set_opnum(uint64_t value);
+  private:
+  uint64_t _internal_opnum() const;
+  void _internal_set_opnum(uint64_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:dsnet.fastpaxos.proto.RequestStateTransferMessage)
+ private:
+  class _Internal;
+
+  // helper for ByteSizeLong()
+  size_t RequiredFieldsByteSizeFallback() const;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    uint64_t view_;
+    uint64_t opnum_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_replication_2ffastpaxos_2ffastpaxos_2dproto_2eproto;
+};
+// -------------------------------------------------------------------
+
+class StateTransferMessage final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:dsnet.fastpaxos.proto.StateTransferMessage) */ {
+ public:
+  inline StateTransferMessage() : StateTransferMessage(nullptr) {}
+  ~StateTransferMessage() override;
+  explicit PROTOBUF_CONSTEXPR StateTransferMessage(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  StateTransferMessage(const StateTransferMessage& from);
+  StateTransferMessage(StateTransferMessage&& from) noexcept
+    : StateTransferMessage() {
+    *this = ::std::move(from);
+  }
+
+  inline StateTransferMessage& operator=(const StateTransferMessage& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline StateTransferMessage& operator=(StateTransferMessage&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const StateTransferMessage& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const StateTransferMessage* internal_default_instance() {
+    return reinterpret_cast<const StateTransferMessage*>(
+               &_StateTransferMessage_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    9;
+
+  friend void swap(StateTransferMessage& a, StateTransferMessage& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(StateTransferMessage* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(StateTransferMessage* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  StateTransferMessage* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<StateTransferMessage>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const StateTransferMessage& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const StateTransferMessage& from) {
+    StateTransferMessage::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(StateTransferMessage* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "dsnet.fastpaxos.proto.StateTransferMessage";
+  }
+  protected:
+  explicit StateTransferMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kEntriesFieldNumber = 3,
+    kViewFieldNumber = 1,
+    kOpnumFieldNumber = 2,
+    kLastopFieldNumber = 4,
+  };
+  // repeated .dsnet.MsgLogEntry entries = 3;
+  int entries_size() const;
+  private:
+  int _internal_entries_size() const;
+  public:
+  void clear_entries();
+  ::dsnet::MsgLogEntry* mutable_entries(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::dsnet::MsgLogEntry >*
+      mutable_entries();
+  private:
+  const ::dsnet::MsgLogEntry& _internal_entries(int index) const;
+  ::dsnet::MsgLogEntry* _internal_add_entries();
+  public:
+  const ::dsnet::MsgLogEntry& entries(int index) const;
+  ::dsnet::MsgLogEntry* add_entries();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::dsnet::MsgLogEntry >&
+      entries() const;
+
+  // required uint64 view = 1;
+  bool has_view() const;
+  private:
+  bool _internal_has_view() const;
+  public:
+  void clear_view();
+  uint64_t view() const;
+  void set_view(uint64_t value);
+  private:
+  uint64_t _internal_view() const;
+  void _internal_set_view(uint64_t value);
+  public:
+
+  // required uint64 opnum = 2;
+  bool has_opnum() const;
+  private:
+  bool _internal_has_opnum() const;
+  public:
+  void clear_opnum();
+  uint64_t opnum() const;
+  void set_opnum(uint64_t value);
+  private:
+  uint64_t _internal_opnum() const;
+  void _internal_set_opnum(uint64_t value);
+  public:
+
+  // required uint64 lastop = 4;
+  bool has_lastop() const;
+  private:
+  bool _internal_has_lastop() const;
+  public:
+  void clear_lastop();
+  uint64_t lastop() const;
+  void set_lastop(uint64_t value);
+  private:
+  uint64_t _internal_lastop() const;
+  void _internal_set_lastop(uint64_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:dsnet.fastpaxos.proto.StateTransferMessage)
+ private:
+  class _Internal;
+
+  // helper for ByteSizeLong()
+  size_t RequiredFieldsByteSizeFallback() const;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::dsnet::MsgLogEntry > entries_;
+    uint64_t view_;
+    uint64_t opnum_;
+    uint64_t lastop_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_replication_2ffastpaxos_2ffastpaxos_2dproto_2eproto;
+};
+// -------------------------------------------------------------------
+
+class ToReplicaMessage final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:dsnet.fastpaxos.proto.ToReplicaMessage) */ {
+ public:
+  inline ToReplicaMessage() : ToReplicaMessage(nullptr) {}
+  ~ToReplicaMessage() override;
+  explicit PROTOBUF_CONSTEXPR ToReplicaMessage(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  ToReplicaMessage(const ToReplicaMessage& from);
+  ToReplicaMessage(ToReplicaMessage&& from) noexcept
+    : ToReplicaMessage() {
+    *this = ::std::move(from);
+  }
+
+  inline ToReplicaMessage& operator=(const ToReplicaMessage& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline ToReplicaMessage& operator=(ToReplicaMessage&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ToReplicaMessage& default_instance() {
+    return *internal_default_instance();
+  }
+  enum MsgCase {
+    kRequest = 1,
+    kUnloggedRequest = 2,
+    kPrepare = 3,
+    kPrepareOk = 4,
+    kCommit = 5,
+    kRequestStateTransfer = 6,
+    kStateTransfer = 7,
+    MSG_NOT_SET = 0,
+  };
+
+  static inline const ToReplicaMessage* internal_default_instance() {
+    return reinterpret_cast<const ToReplicaMessage*>(
+               &_ToReplicaMessage_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    10;
+
+  friend void swap(ToReplicaMessage& a, ToReplicaMessage& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(ToReplicaMessage* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ToReplicaMessage* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  ToReplicaMessage* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ToReplicaMessage>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const ToReplicaMessage& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ToReplicaMessage& from) {
+    ToReplicaMessage::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(ToReplicaMessage* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "dsnet.fastpaxos.proto.ToReplicaMessage";
+  }
+  protected:
+  explicit ToReplicaMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kRequestFieldNumber = 1,
+    kUnloggedRequestFieldNumber = 2,
+    kPrepareFieldNumber = 3,
+    kPrepareOkFieldNumber = 4,
+    kCommitFieldNumber = 5,
+    kRequestStateTransferFieldNumber = 6,
+    kStateTransferFieldNumber = 7,
+  };
+  // .dsnet.fastpaxos.proto.RequestMessage request = 1;
+  bool has_request() const;
+  private:
+  bool _internal_has_request() const;
+  public:
+  void clear_request();
+  const ::dsnet::fastpaxos::proto::RequestMessage& request() const;
+  PROTOBUF_NODISCARD ::dsnet::fastpaxos::proto::RequestMessage* release_request();
+  ::dsnet::fastpaxos::proto::RequestMessage* mutable_request();
+  void set_allocated_request(::dsnet::fastpaxos::proto::RequestMessage* request);
+  private:
+  const ::dsnet::fastpaxos::proto::RequestMessage& _internal_request() const;
+  ::dsnet::fastpaxos::proto::RequestMessage* _internal_mutable_request();
+  public:
+  void unsafe_arena_set_allocated_request(
+      ::dsnet::fastpaxos::proto::RequestMessage* request);
+  ::dsnet::fastpaxos::proto::RequestMessage* unsafe_arena_release_request();
+
+  // .dsnet.fastpaxos.proto.UnloggedRequestMessage unlogged_request = 2;
+  bool has_unlogged_request() const;
+  private:
+  bool _internal_has_unlogged_request() const;
+  public:
+  void clear_unlogged_request();
+  const ::dsnet::fastpaxos::proto::UnloggedRequestMessage& unlogged_request() const;
+  PROTOBUF_NODISCARD ::dsnet::fastpaxos::proto::UnloggedRequestMessage* release_unlogged_request();
+  ::dsnet::fastpaxos::proto::UnloggedRequestMessage* mutable_unlogged_request();
+  void set_allocated_unlogged_request(::dsnet::fastpaxos::proto::UnloggedRequestMessage* unlogged_request);
+  private:
+  const ::dsnet::fastpaxos::proto::UnloggedRequestMessage& _internal_unlogged_request() const;
+  ::dsnet::fastpaxos::proto::UnloggedRequestMessage* _internal_mutable_unlogged_request();
+  public:
+  void unsafe_arena_set_allocated_unlogged_request(
+      ::dsnet::fastpaxos::proto::UnloggedRequestMessage* unlogged_request);
+  ::dsnet::fastpaxos::proto::UnloggedRequestMessage* unsafe_arena_release_unlogged_request();
+
+  // .dsnet.fastpaxos.proto.PrepareMessage prepare = 3;
+  bool has_prepare() const;
+  private:
+  bool _internal_has_prepare() const;
+  public:
+  void clear_prepare();
+  const ::dsnet::fastpaxos::proto::PrepareMessage& prepare() const;
+  PROTOBUF_NODISCARD ::dsnet::fastpaxos::proto::PrepareMessage* release_prepare();
+  ::dsnet::fastpaxos::proto::PrepareMessage* mutable_prepare();
+  void set_allocated_prepare(::dsnet::fastpaxos::proto::PrepareMessage* prepare);
+  private:
+  const ::dsnet::fastpaxos::proto::PrepareMessage& _internal_prepare() const;
+  ::dsnet::fastpaxos::proto::PrepareMessage* _internal_mutable_prepare();
+  public:
+  void unsafe_arena_set_allocated_prepare(
+      ::dsnet::fastpaxos::proto::PrepareMessage* prepare);
+  ::dsnet::fastpaxos::proto::PrepareMessage* unsafe_arena_release_prepare();
+
+  // .dsnet.fastpaxos.proto.PrepareOKMessage prepare_ok = 4;
+  bool has_prepare_ok() const;
+  private:
+  bool _internal_has_prepare_ok() const;
+  public:
+  void clear_prepare_ok();
+  const ::dsnet::fastpaxos::proto::PrepareOKMessage& prepare_ok() const;
+  PROTOBUF_NODISCARD ::dsnet::fastpaxos::proto::PrepareOKMessage* release_prepare_ok();
+  ::dsnet::fastpaxos::proto::PrepareOKMessage* mutable_prepare_ok();
+  void set_allocated_prepare_ok(::dsnet::fastpaxos::proto::PrepareOKMessage* prepare_ok);
+  private:
+  const ::dsnet::fastpaxos::proto::PrepareOKMessage& _internal_prepare_ok() const;
+  ::dsnet::fastpaxos::proto::PrepareOKMessage* _internal_mutable_prepare_ok();
+  public:
+  void unsafe_arena_set_allocated_prepare_ok(
+      ::dsnet::fastpaxos::proto::PrepareOKMessage* prepare_ok);
+  ::dsnet::fastpaxos::proto::PrepareOKMessage* unsafe_arena_release_prepare_ok();
+
+  // .dsnet.fastpaxos.proto.CommitMessage commit = 5;
+  bool has_commit() const;
+  private:
+  bool _internal_has_commit() const;
+  public:
+  void clear_commit();
+  const ::dsnet::fastpaxos::proto::CommitMessage& commit() const;
+  PROTOBUF_NODISCARD ::dsnet::fastpaxos::proto::CommitMessage* release_commit();
+  ::dsnet::fastpaxos::proto::CommitMessage* mutable_commit();
+  void set_allocated_commit(::dsnet::fastpaxos::proto::CommitMessage* commit);
+  private:
+  const ::dsnet::fastpaxos::proto::CommitMessage& _internal_commit() const;
+  ::dsnet::fastpaxos::proto::CommitMessage* _internal_mutable_commit();
+  public:
+  void unsafe_arena_set_allocated_commit(
+      ::dsnet::fastpaxos::proto::CommitMessage* commit);
+  ::dsnet::fastpaxos::proto::CommitMessage* unsafe_arena_release_commit();
+
+  // .dsnet.fastpaxos.proto.RequestStateTransferMessage request_state_transfer = 6;
+  bool has_request_state_transfer() const;
+  private:
+  bool _internal_has_request_state_transfer() const;
+  public:
+  void clear_request_state_transfer();
+  const ::dsnet::fastpaxos::proto::RequestStateTransferMessage& request_state_transfer() const;
+  PROTOBUF_NODISCARD ::dsnet::fastpaxos::proto::RequestStateTransferMessage* release_request_state_transfer();
+  ::dsnet::fastpaxos::proto::RequestStateTransferMessage* mutable_request_state_transfer();
+  void set_allocated_request_state_transfer(::dsnet::fastpaxos::proto::RequestStateTransferMessage* request_state_transfer);
+  private:
+  const ::dsnet::fastpaxos::proto::RequestStateTransferMessage& _internal_request_state_transfer() const;
+  ::dsnet::fastpaxos::proto::RequestStateTransferMessage* _internal_mutable_request_state_transfer();
+  public:
+  void unsafe_arena_set_allocated_request_state_transfer(
+      ::dsnet::fastpaxos::proto::RequestStateTransferMessage* request_state_transfer);
+  ::dsnet::fastpaxos::proto::RequestStateTransferMessage* unsafe_arena_release_request_state_transfer();
+
+  // .dsnet.fastpaxos.proto.StateTransferMessage state_transfer = 7;
+  bool has_state_transfer() const;
+  private:
+  bool _internal_has_state_transfer() const;
+  public:
+  void clear_state_transfer();
+  const ::dsnet::fastpaxos::proto::StateTransferMessage& state_transfer() const;
+  PROTOBUF_NODISCARD ::dsnet::fastpaxos::proto::StateTransferMessage* release_state_transfer();
+  ::dsnet::fastpaxos::proto::StateTransferMessage* mutable_state_transfer();
+  void set_allocated_state_transfer(::dsnet::fastpaxos::proto::StateTransferMessage* state_transfer);
+  private:
+  const ::dsnet::fastpaxos::proto::StateTransferMessage& _internal_state_transfer() const;
+  ::dsnet::fastpaxos::proto::StateTransferMessage* _internal_mutable_state_transfer();
+  public:
+  void unsafe_arena_set_allocated_state_transfer(
+      ::dsnet::fastpaxos::proto::StateTransferMessage* state_transfer);
+  ::dsnet::fastpaxos::proto::StateTransferMessage* unsafe_arena_release_state_transfer();
+
+  void clear_msg();
+  MsgCase msg_case() const;
+  // @@protoc_insertion_point(class_scope:dsnet.fastpaxos.proto.ToReplicaMessage)
+ private:
+  class _Internal;
+  void set_has_request();
+  void set_has_unlogged_request();
+  void set_has_prepare();
+  void set_has_prepare_ok();
+  void set_has_commit();
+  void set_has_request_state_transfer();
+  void set_has_state_transfer();
+
+  inline bool has_msg() const;
+  inline void clear_has_msg();
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    union MsgUnion {
+      constexpr MsgUnion() : _constinit_{} {}
+        ::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized _constinit_;
+      ::dsnet::fastpaxos::proto::RequestMessage* request_;
+      ::dsnet::fastpaxos::proto::UnloggedRequestMessage* unlogged_request_;
+      ::dsnet::fastpaxos::proto::PrepareMessage* prepare_;
+      ::dsnet::fastpaxos::proto::PrepareOKMessage* prepare_ok_;
+      ::dsnet::fastpaxos::proto::CommitMessage* commit_;
+      ::dsnet::fastpaxos::proto::RequestStateTransferMessage* request_state_transfer_;
+      ::dsnet::fastpaxos::proto::StateTransferMessage* state_transfer_;
+    } msg_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    uint32_t _oneof_case_[1];
+
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_replication_2ffastpaxos_2ffastpaxos_2dproto_2eproto;
+};
+// ===================================================================
+
+
+// ===================================================================
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
+#endif  // __GNUC__
+// ReplyMessage
+
+// required uint64 view = 1;
+inline bool ReplyMessage::_internal_has_view() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool ReplyMessage::has_view() const {
+  return _internal_has_view();
+}
+inline void ReplyMessage::clear_view() {
+  _impl_.view_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline uint64_t ReplyMessage::_internal_view() const {
+  return _impl_.view_;
+}
+inline uint64_t ReplyMessage::view() const {
+  // @@protoc_insertion_point(field_get:dsnet.fastpaxos.proto.ReplyMessage.view)
+  return _internal_view();
+}
+inline void ReplyMessage::_internal_set_view(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.view_ = value;
+}
+inline void ReplyMessage::set_view(uint64_t value) {
+  _internal_set_view(value);
+  // @@protoc_insertion_point(field_set:dsnet.fastpaxos.proto.ReplyMessage.view)
+}
+
+// required uint64 opnum = 2;
+inline bool ReplyMessage::_internal_has_opnum() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool ReplyMessage::has_opnum() const {
+  return _internal_has_opnum();
+}
+inline void ReplyMessage::clear_opnum() {
+  _impl_.opnum_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline uint64_t ReplyMessage::_internal_opnum() const {
+  return _impl_.opnum_;
+}
+inline uint64_t ReplyMessage::opnum() const {
+  // @@protoc_insertion_point(field_get:dsnet.fastpaxos.proto.ReplyMessage.opnum)
+  return _internal_opnum();
+}
+inline void ReplyMessage::_internal_set_opnum(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.opnum_ = value;
+}
+inline void ReplyMessage::set_opnum(uint64_t value) {
+  _internal_set_opnum(value);
+  // @@protoc_insertion_point(field_set:dsnet.fastpaxos.proto.ReplyMessage.opnum)
+}
+
+// required bytes reply = 3;
+inline bool ReplyMessage::_internal_has_reply() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool ReplyMessage::has_reply() const {
+  return _internal_has_reply();
+}
+inline void ReplyMessage::clear_reply() {
+  _impl_.reply_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& ReplyMessage::reply() const {
+  // @@protoc_insertion_point(field_get:dsnet.fastpaxos.proto.ReplyMessage.reply)
+  return _internal_reply();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void ReplyMessage::set_reply(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.reply_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:dsnet.fastpaxos.proto.ReplyMessage.reply)
+}
+inline std::string* ReplyMessage::mutable_reply() {
+  std::string* _s = _internal_mutable_reply();
+  // @@protoc_insertion_point(field_mutable:dsnet.fastpaxos.proto.ReplyMessage.reply)
+  return _s;
+}
+inline const std::string& ReplyMessage::_internal_reply() const {
+  return _impl_.reply_.Get();
+}
+inline void ReplyMessage::_internal_set_reply(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.reply_.Set(value, GetArenaForAllocation());
+}
+inline std::string* ReplyMessage::_internal_mutable_reply() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.reply_.Mutable(GetArenaForAllocation());
+}
+inline std::string* ReplyMessage::release_reply() {
+  // @@protoc_insertion_point(field_release:dsnet.fastpaxos.proto.ReplyMessage.reply)
+  if (!_internal_has_reply()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.reply_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.reply_.IsDefault()) {
+    _impl_.reply_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void ReplyMessage::set_allocated_reply(std::string* reply) {
+  if (reply != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.reply_.SetAllocated(reply, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.reply_.IsDefault()) {
+    _impl_.reply_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:dsnet.fastpaxos.proto.ReplyMessage.reply)
+}
+
+// required uint64 clientreqid = 4;
+inline bool ReplyMessage::_internal_has_clientreqid() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  return value;
+}
+inline bool ReplyMessage::has_clientreqid() const {
+  return _internal_has_clientreqid();
+}
+inline void ReplyMessage::clear_clientreqid() {
+  _impl_.clientreqid_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000008u;
+}
+inline uint64_t ReplyMessage::_internal_clientreqid() const {
+  return _impl_.clientreqid_;
+}
+inline uint64_t ReplyMessage::clientreqid() const {
+  // @@protoc_insertion_point(field_get:dsnet.fastpaxos.proto.ReplyMessage.clientreqid)
+  return _internal_clientreqid();
+}
+inline void ReplyMessage::_internal_set_clientreqid(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  _impl_.clientreqid_ = value;
+}
+inline void ReplyMessage::set_clientreqid(uint64_t value) {
+  _internal_set_clientreqid(value);
+  // @@protoc_insertion_point(field_set:dsnet.fastpaxos.proto.ReplyMessage.clientreqid)
+}
+
+// -------------------------------------------------------------------
+
+// UnloggedReplyMessage
+
+// required bytes reply = 1;
+inline bool UnloggedReplyMessage::_internal_has_reply() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool UnloggedReplyMessage::has_reply() const {
+  return _internal_has_reply();
+}
+inline void UnloggedReplyMessage::clear_reply() {
+  _impl_.reply_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& UnloggedReplyMessage::reply() const {
+  // @@protoc_insertion_point(field_get:dsnet.fastpaxos.proto.UnloggedReplyMessage.reply)
+  return _internal_reply();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void UnloggedReplyMessage::set_reply(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.reply_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:dsnet.fastpaxos.proto.UnloggedReplyMessage.reply)
+}
+inline std::string* UnloggedReplyMessage::mutable_reply() {
+  std::string* _s = _internal_mutable_reply();
+  // @@protoc_insertion_point(field_mutable:dsnet.fastpaxos.proto.UnloggedReplyMessage.reply)
+  return _s;
+}
+inline const std::string& UnloggedReplyMessage::_internal_reply() const {
+  return _impl_.reply_.Get();
+}
+inline void UnloggedReplyMessage::_internal_set_reply(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.reply_.Set(value, GetArenaForAllocation());
+}
+inline std::string* UnloggedReplyMessage::_internal_mutable_reply() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.reply_.Mutable(GetArenaForAllocation());
+}
+inline std::string* UnloggedReplyMessage::release_reply() {
+  // @@protoc_insertion_point(field_release:dsnet.fastpaxos.proto.UnloggedReplyMessage.reply)
+  if (!_internal_has_reply()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.reply_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.reply_.IsDefault()) {
+    _impl_.reply_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void UnloggedReplyMessage::set_allocated_reply(std::string* reply) {
+  if (reply != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.reply_.SetAllocated(reply, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.reply_.IsDefault()) {
+    _impl_.reply_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:dsnet.fastpaxos.proto.UnloggedReplyMessage.reply)
+}
+
+// -------------------------------------------------------------------
+
+// ToClientMessage
+
+// .dsnet.fastpaxos.proto.ReplyMessage reply = 1;
+inline bool ToClientMessage::_internal_has_reply() const {
+  return msg_case() == kReply;
+}
+inline bool ToClientMessage::has_reply() const {
+  return _internal_has_reply();
+}
+inline void ToClientMessage::set_has_reply() {
+  _impl_._oneof_case_[0] = kReply;
+}
+inline void ToClientMessage::clear_reply() {
+  if (_internal_has_reply()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.msg_.reply_;
+    }
+    clear_has_msg();
+  }
+}
+inline ::dsnet::fastpaxos::proto::ReplyMessage* ToClientMessage::release_reply() {
+  // @@protoc_insertion_point(field_release:dsnet.fastpaxos.proto.ToClientMessage.reply)
+  if (_internal_has_reply()) {
+    clear_has_msg();
+    ::dsnet::fastpaxos::proto::ReplyMessage* temp = _impl_.msg_.reply_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.msg_.reply_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::dsnet::fastpaxos::proto::ReplyMessage& ToClientMessage::_internal_reply() const {
+  return _internal_has_reply()
+      ? *_impl_.msg_.reply_
+      : reinterpret_cast< ::dsnet::fastpaxos::proto::ReplyMessage&>(::dsnet::fastpaxos::proto::_ReplyMessage_default_instance_);
+}
+inline const ::dsnet::fastpaxos::proto::ReplyMessage& ToClientMessage::reply() const {
+  // @@protoc_insertion_point(field_get:dsnet.fastpaxos.proto.ToClientMessage.reply)
+  return _internal_reply();
+}
+inline ::dsnet::fastpaxos::proto::ReplyMessage* ToClientMessage::unsafe_arena_release_reply() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:dsnet.fastpaxos.proto.ToClientMessage.reply)
+  if (_internal_has_reply()) {
+    clear_has_msg();
+    ::dsnet::fastpaxos::proto::ReplyMessage* temp = _impl_.msg_.reply_;
+    _impl_.msg_.reply_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void ToClientMessage::unsafe_arena_set_allocated_reply(::dsnet::fastpaxos::proto::ReplyMessage* reply) {
+  clear_msg();
+  if (reply) {
+    set_has_reply();
+    _impl_.msg_.reply_ = reply;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:dsnet.fastpaxos.proto.ToClientMessage.reply)
+}
+inline ::dsnet::fastpaxos::proto::ReplyMessage* ToClientMessage::_internal_mutable_reply() {
+  if (!_internal_has_reply()) {
+    clear_msg();
+    set_has_reply();
+    _impl_.msg_.reply_ = CreateMaybeMessage< ::dsnet::fastpaxos::proto::ReplyMessage >(GetArenaForAllocation());
+  }
+  return _impl_.msg_.reply_;
+}
+inline ::dsnet::fastpaxos::proto::ReplyMessage* ToClientMessage::mutable_reply() {
+  ::dsnet::fastpaxos::proto::ReplyMessage* _msg = _internal_mutable_reply();
+  // @@protoc_insertion_point(field_mutable:dsnet.fastpaxos.proto.ToClientMessage.reply)
+  return _msg;
+}
+
+// .dsnet.fastpaxos.proto.UnloggedReplyMessage unlogged_reply = 2;
+inline bool ToClientMessage::_internal_has_unlogged_reply() const {
+  return msg_case() == kUnloggedReply;
+}
+inline bool ToClientMessage::has_unlogged_reply() const {
+  return _internal_has_unlogged_reply();
+}
+inline void ToClientMessage::set_has_unlogged_reply() {
+  _impl_._oneof_case_[0] = kUnloggedReply;
+}
+inline void ToClientMessage::clear_unlogged_reply() {
+  if (_internal_has_unlogged_reply()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.msg_.unlogged_reply_;
+    }
+    clear_has_msg();
+  }
+}
+inline ::dsnet::fastpaxos::proto::UnloggedReplyMessage* ToClientMessage::release_unlogged_reply() {
+  // @@protoc_insertion_point(field_release:dsnet.fastpaxos.proto.ToClientMessage.unlogged_reply)
+  if (_internal_has_unlogged_reply()) {
+    clear_has_msg();
+    ::dsnet::fastpaxos::proto::UnloggedReplyMessage* temp = _impl_.msg_.unlogged_reply_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.msg_.unlogged_reply_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::dsnet::fastpaxos::proto::UnloggedReplyMessage& ToClientMessage::_internal_unlogged_reply() const {
+  return _internal_has_unlogged_reply()
+      ? *_impl_.msg_.unlogged_reply_
+      : reinterpret_cast< ::dsnet::fastpaxos::proto::UnloggedReplyMessage&>(::dsnet::fastpaxos::proto::_UnloggedReplyMessage_default_instance_);
+}
+inline const ::dsnet::fastpaxos::proto::UnloggedReplyMessage& ToClientMessage::unlogged_reply() const {
+  // @@protoc_insertion_point(field_get:dsnet.fastpaxos.proto.ToClientMessage.unlogged_reply)
+  return _internal_unlogged_reply();
+}
+inline ::dsnet::fastpaxos::proto::UnloggedReplyMessage* ToClientMessage::unsafe_arena_release_unlogged_reply() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:dsnet.fastpaxos.proto.ToClientMessage.unlogged_reply)
+  if (_internal_has_unlogged_reply()) {
+    clear_has_msg();
+    ::dsnet::fastpaxos::proto::UnloggedReplyMessage* temp = _impl_.msg_.unlogged_reply_;
+    _impl_.msg_.unlogged_reply_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void ToClientMessage::unsafe_arena_set_allocated_unlogged_reply(::dsnet::fastpaxos::proto::UnloggedReplyMessage* unlogged_reply) {
+  clear_msg();
+  if (unlogged_reply) {
+    set_has_unlogged_reply();
+    _impl_.msg_.unlogged_reply_ = unlogged_reply;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:dsnet.fastpaxos.proto.ToClientMessage.unlogged_reply)
+}
+inline ::dsnet::fastpaxos::proto::UnloggedReplyMessage* ToClientMessage::_internal_mutable_unlogged_reply() {
+  if (!_internal_has_unlogged_reply()) {
+    clear_msg();
+    set_has_unlogged_reply();
+    _impl_.msg_.unlogged_reply_ = CreateMaybeMessage< ::dsnet::fastpaxos::proto::UnloggedReplyMessage >(GetArenaForAllocation());
+  }
+  return _impl_.msg_.unlogged_reply_;
+}
+inline ::dsnet::fastpaxos::proto::UnloggedReplyMessage* ToClientMessage::mutable_unlogged_reply() {
+  ::dsnet::fastpaxos::proto::UnloggedReplyMessage* _msg = _internal_mutable_unlogged_reply();
+  // @@protoc_insertion_point(field_mutable:dsnet.fastpaxos.proto.ToClientMessage.unlogged_reply)
+  return _msg;
+}
+
+inline bool ToClientMessage::has_msg() const {
+  return msg_case() != MSG_NOT_SET;
+}
+inline void ToClientMessage::clear_has_msg() {
+  _impl_._oneof_case_[0] = MSG_NOT_SET;
+}
+inline ToClientMessage::MsgCase ToClientMessage::msg_case() const {
+  return ToClientMessage::MsgCase(_impl_._oneof_case_[0]);
+}
+// -------------------------------------------------------------------
+
+// RequestMessage
+
+// required .dsnet.Request req = 1;
+inline bool RequestMessage::_internal_has_req() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.req_ != nullptr);
+  return value;
+}
+inline bool RequestMessage::has_req() const {
+  return _internal_has_req();
+}
+inline const ::dsnet::Request& RequestMessage::_internal_req() const {
+  const ::dsnet::Request* p = _impl_.req_;
+  return p != nullptr ? *p : reinterpret_cast<const ::dsnet::Request&>(
+      ::dsnet::_Request_default_instance_);
+}
+inline const ::dsnet::Request& RequestMessage::req() const {
+  // @@protoc_insertion_point(field_get:dsnet.fastpaxos.proto.RequestMessage.req)
+  return _internal_req();
+}
+inline void RequestMessage::unsafe_arena_set_allocated_req(
+    ::dsnet::Request* req) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.req_);
+  }
+  _impl_.req_ = req;
+  if (req) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:dsnet.fastpaxos.proto.RequestMessage.req)
+}
+inline ::dsnet::Request* RequestMessage::release_req() {
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::dsnet::Request* temp = _impl_.req_;
+  _impl_.req_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::dsnet::Request* RequestMessage::unsafe_arena_release_req() {
+  // @@protoc_insertion_point(field_release:dsnet.fastpaxos.proto.RequestMessage.req)
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::dsnet::Request* temp = _impl_.req_;
+  _impl_.req_ = nullptr;
+  return temp;
+}
+inline ::dsnet::Request* RequestMessage::_internal_mutable_req() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  if (_impl_.req_ == nullptr) {
+    auto* p = CreateMaybeMessage<::dsnet::Request>(GetArenaForAllocation());
+    _impl_.req_ = p;
+  }
+  return _impl_.req_;
+}
+inline ::dsnet::Request* RequestMessage::mutable_req() {
+  ::dsnet::Request* _msg = _internal_mutable_req();
+  // @@protoc_insertion_point(field_mutable:dsnet.fastpaxos.proto.RequestMessage.req)
+  return _msg;
+}
+inline void RequestMessage::set_allocated_req(::dsnet::Request* req) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete reinterpret_cast< ::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.req_);
+  }
+  if (req) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(
+                reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(req));
+    if (message_arena != submessage_arena) {
+      req = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, req, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.req_ = req;
+  // @@protoc_insertion_point(field_set_allocated:dsnet.fastpaxos.proto.RequestMessage.req)
+}
+
+// -------------------------------------------------------------------
+
+// UnloggedRequestMessage
+
+// required .dsnet.UnloggedRequest req = 1;
+inline bool UnloggedRequestMessage::_internal_has_req() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.req_ != nullptr);
+  return value;
+}
+inline bool UnloggedRequestMessage::has_req() const {
+  return _internal_has_req();
+}
+inline const ::dsnet::UnloggedRequest& UnloggedRequestMessage::_internal_req() const {
+  const ::dsnet::UnloggedRequest* p = _impl_.req_;
+  return p != nullptr ? *p : reinterpret_cast<const ::dsnet::UnloggedRequest&>(
+      ::dsnet::_UnloggedRequest_default_instance_);
+}
+inline const ::dsnet::UnloggedRequest& UnloggedRequestMessage::req() const {
+  // @@protoc_insertion_point(field_get:dsnet.fastpaxos.proto.UnloggedRequestMessage.req)
+  return _internal_req();
+}
+inline void UnloggedRequestMessage::unsafe_arena_set_allocated_req(
+    ::dsnet::UnloggedRequest* req) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.req_);
+  }
+  _impl_.req_ = req;
+  if (req) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:dsnet.fastpaxos.proto.UnloggedRequestMessage.req)
+}
+inline ::dsnet::UnloggedRequest* UnloggedRequestMessage::release_req() {
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::dsnet::UnloggedRequest* temp = _impl_.req_;
+  _impl_.req_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::dsnet::UnloggedRequest* UnloggedRequestMessage::unsafe_arena_release_req() {
+  // @@protoc_insertion_point(field_release:dsnet.fastpaxos.proto.UnloggedRequestMessage.req)
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::dsnet::UnloggedRequest* temp = _impl_.req_;
+  _impl_.req_ = nullptr;
+  return temp;
+}
+inline ::dsnet::UnloggedRequest* UnloggedRequestMessage::_internal_mutable_req() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  if (_impl_.req_ == nullptr) {
+    auto* p = CreateMaybeMessage<::dsnet::UnloggedRequest>(GetArenaForAllocation());
+    _impl_.req_ = p;
+  }
+  return _impl_.req_;
+}
+inline ::dsnet::UnloggedRequest* UnloggedRequestMessage::mutable_req() {
+  ::dsnet::UnloggedRequest* _msg = _internal_mutable_req();
+  // @@protoc_insertion_point(field_mutable:dsnet.fastpaxos.proto.UnloggedRequestMessage.req)
+  return _msg;
+}
+inline void UnloggedRequestMessage::set_allocated_req(::dsnet::UnloggedRequest* req) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete reinterpret_cast< ::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.req_);
+  }
+  if (req) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(
+                reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(req));
+    if (message_arena != submessage_arena) {
+      req = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, req, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.req_ = req;
+  // @@protoc_insertion_point(field_set_allocated:dsnet.fastpaxos.proto.UnloggedRequestMessage.req)
+}
+
+// -------------------------------------------------------------------
+
+// PrepareOKMessage
+
+// required uint64 view = 1;
+inline bool PrepareOKMessage::_internal_has_view() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool PrepareOKMessage::has_view() const {
+  return _internal_has_view();
+}
+inline void PrepareOKMessage::clear_view() {
+  _impl_.view_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline uint64_t PrepareOKMessage::_internal_view() const {
+  return _impl_.view_;
+}
+inline uint64_t PrepareOKMessage::view() const {
+  // @@protoc_insertion_point(field_get:dsnet.fastpaxos.proto.PrepareOKMessage.view)
+  return _internal_view();
+}
+inline void PrepareOKMessage::_internal_set_view(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.view_ = value;
+}
+inline void PrepareOKMessage::set_view(uint64_t value) {
+  _internal_set_view(value);
+  // @@protoc_insertion_point(field_set:dsnet.fastpaxos.proto.PrepareOKMessage.view)
+}
+
+// required uint64 opnum = 2;
+inline bool PrepareOKMessage::_internal_has_opnum() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool PrepareOKMessage::has_opnum() const {
+  return _internal_has_opnum();
+}
+inline void PrepareOKMessage::clear_opnum() {
+  _impl_.opnum_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline uint64_t PrepareOKMessage::_internal_opnum() const {
+  return _impl_.opnum_;
+}
+inline uint64_t PrepareOKMessage::opnum() const {
+  // @@protoc_insertion_point(field_get:dsnet.fastpaxos.proto.PrepareOKMessage.opnum)
+  return _internal_opnum();
+}
+inline void PrepareOKMessage::_internal_set_opnum(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.opnum_ = value;
+}
+inline void PrepareOKMessage::set_opnum(uint64_t value) {
+  _internal_set_opnum(value);
+  // @@protoc_insertion_point(field_set:dsnet.fastpaxos.proto.PrepareOKMessage.opnum)
+}
+
+// required uint32 replicaIdx = 3;
+inline bool PrepareOKMessage::_internal_has_replicaidx() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  return value;
+}
+inline bool PrepareOKMessage::has_replicaidx() const {
+  return _internal_has_replicaidx();
+}
+inline void PrepareOKMessage::clear_replicaidx() {
+  _impl_.replicaidx_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000008u;
+}
+inline uint32_t PrepareOKMessage::_internal_replicaidx() const {
+  return _impl_.replicaidx_;
+}
+inline uint32_t PrepareOKMessage::replicaidx() const {
+  // @@protoc_insertion_point(field_get:dsnet.fastpaxos.proto.PrepareOKMessage.replicaIdx)
+  return _internal_replicaidx();
+}
+inline void PrepareOKMessage::_internal_set_replicaidx(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  _impl_.replicaidx_ = value;
+}
+inline void PrepareOKMessage::set_replicaidx(uint32_t value) {
+  _internal_set_replicaidx(value);
+  // @@protoc_insertion_point(field_set:dsnet.fastpaxos.proto.PrepareOKMessage.replicaIdx)
+}
+
+// required .dsnet.Request req = 4;
+inline bool PrepareOKMessage::_internal_has_req() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.req_ != nullptr);
+  return value;
+}
+inline bool PrepareOKMessage::has_req() const {
+  return _internal_has_req();
+}
+inline const ::dsnet::Request& PrepareOKMessage::_internal_req() const {
+  const ::dsnet::Request* p = _impl_.req_;
+  return p != nullptr ? *p : reinterpret_cast<const ::dsnet::Request&>(
+      ::dsnet::_Request_default_instance_);
+}
+inline const ::dsnet::Request& PrepareOKMessage::req() const {
+  // @@protoc_insertion_point(field_get:dsnet.fastpaxos.proto.PrepareOKMessage.req)
+  return _internal_req();
+}
+inline void PrepareOKMessage::unsafe_arena_set_allocated_req(
+    ::dsnet::Request* req) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.req_);
+  }
+  _impl_.req_ = req;
+  if (req) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:dsnet.fastpaxos.proto.PrepareOKMessage.req)
+}
+inline ::dsnet::Request* PrepareOKMessage::release_req() {
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::dsnet::Request* temp = _impl_.req_;
+  _impl_.req_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::dsnet::Request* PrepareOKMessage::unsafe_arena_release_req() {
+  // @@protoc_insertion_point(field_release:dsnet.fastpaxos.proto.PrepareOKMessage.req)
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::dsnet::Request* temp = _impl_.req_;
+  _impl_.req_ = nullptr;
+  return temp;
+}
+inline ::dsnet::Request* PrepareOKMessage::_internal_mutable_req() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  if (_impl_.req_ == nullptr) {
+    auto* p = CreateMaybeMessage<::dsnet::Request>(GetArenaForAllocation());
+    _impl_.req_ = p;
+  }
+  return _impl_.req_;
+}
+inline ::dsnet::Request* PrepareOKMessage::mutable_req() {
+  ::dsnet::Request* _msg = _internal_mutable_req();
+  // @@protoc_insertion_point(field_mutable:dsnet.fastpaxos.proto.PrepareOKMessage.req)
+  return _msg;
+}
+inline void PrepareOKMessage::set_allocated_req(::dsnet::Request* req) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete reinterpret_cast< ::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.req_);
+  }
+  if (req) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(
+                reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(req));
+    if (message_arena != submessage_arena) {
+      req = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, req, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.req_ = req;
+  // @@protoc_insertion_point(field_set_allocated:dsnet.fastpaxos.proto.PrepareOKMessage.req)
+}
+
+// required uint32 slowpath = 5;
+inline bool PrepareOKMessage::_internal_has_slowpath() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000010u) != 0;
+  return value;
+}
+inline bool PrepareOKMessage::has_slowpath() const {
+  return _internal_has_slowpath();
+}
+inline void PrepareOKMessage::clear_slowpath() {
+  _impl_.slowpath_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000010u;
+}
+inline uint32_t PrepareOKMessage::_internal_slowpath() const {
+  return _impl_.slowpath_;
+}
+inline uint32_t PrepareOKMessage::slowpath() const {
+  // @@protoc_insertion_point(field_get:dsnet.fastpaxos.proto.PrepareOKMessage.slowpath)
+  return _internal_slowpath();
+}
+inline void PrepareOKMessage::_internal_set_slowpath(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000010u;
+  _impl_.slowpath_ = value;
+}
+inline void PrepareOKMessage::set_slowpath(uint32_t value) {
+  _internal_set_slowpath(value);
+  // @@protoc_insertion_point(field_set:dsnet.fastpaxos.proto.PrepareOKMessage.slowpath)
+}
+
+// -------------------------------------------------------------------
+
+// PrepareMessage
+
+// required uint64 view = 1;
+inline bool PrepareMessage::_internal_has_view() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool PrepareMessage::has_view() const {
+  return _internal_has_view();
+}
+inline void PrepareMessage::clear_view() {
+  _impl_.view_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline uint64_t PrepareMessage::_internal_view() const {
+  return _impl_.view_;
+}
+inline uint64_t PrepareMessage::view() const {
+  // @@protoc_insertion_point(field_get:dsnet.fastpaxos.proto.PrepareMessage.view)
+  return _internal_view();
+}
+inline void PrepareMessage::_internal_set_view(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.view_ = value;
+}
+inline void PrepareMessage::set_view(uint64_t value) {
+  _internal_set_view(value);
+  // @@protoc_insertion_point(field_set:dsnet.fastpaxos.proto.PrepareMessage.view)
+}
+
+// required uint64 opnum = 2;
+inline bool PrepareMessage::_internal_has_opnum() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool PrepareMessage::has_opnum() const {
+  return _internal_has_opnum();
+}
+inline void PrepareMessage::clear_opnum() {
+  _impl_.opnum_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline uint64_t PrepareMessage::_internal_opnum() const {
+  return _impl_.opnum_;
+}
+inline uint64_t PrepareMessage::opnum() const {
+  // @@protoc_insertion_point(field_get:dsnet.fastpaxos.proto.PrepareMessage.opnum)
+  return _internal_opnum();
+}
+inline void PrepareMessage::_internal_set_opnum(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.opnum_ = value;
+}
+inline void PrepareMessage::set_opnum(uint64_t value) {
+  _internal_set_opnum(value);
+  // @@protoc_insertion_point(field_set:dsnet.fastpaxos.proto.PrepareMessage.opnum)
+}
+
+// required .dsnet.Request req = 3;
+inline bool PrepareMessage::_internal_has_req() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.req_ != nullptr);
+  return value;
+}
+inline bool PrepareMessage::has_req() const {
+  return _internal_has_req();
+}
+inline const ::dsnet::Request& PrepareMessage::_internal_req() const {
+  const ::dsnet::Request* p = _impl_.req_;
+  return p != nullptr ? *p : reinterpret_cast<const ::dsnet::Request&>(
+      ::dsnet::_Request_default_instance_);
+}
+inline const ::dsnet::Request& PrepareMessage::req() const {
+  // @@protoc_insertion_point(field_get:dsnet.fastpaxos.proto.PrepareMessage.req)
+  return _internal_req();
+}
+inline void PrepareMessage::unsafe_arena_set_allocated_req(
+    ::dsnet::Request* req) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.req_);
+  }
+  _impl_.req_ = req;
+  if (req) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:dsnet.fastpaxos.proto.PrepareMessage.req)
+}
+inline ::dsnet::Request* PrepareMessage::release_req() {
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::dsnet::Request* temp = _impl_.req_;
+  _impl_.req_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::dsnet::Request* PrepareMessage::unsafe_arena_release_req() {
+  // @@protoc_insertion_point(field_release:dsnet.fastpaxos.proto.PrepareMessage.req)
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::dsnet::Request* temp = _impl_.req_;
+  _impl_.req_ = nullptr;
+  return temp;
+}
+inline ::dsnet::Request* PrepareMessage::_internal_mutable_req() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  if (_impl_.req_ == nullptr) {
+    auto* p = CreateMaybeMessage<::dsnet::Request>(GetArenaForAllocation());
+    _impl_.req_ = p;
+  }
+  return _impl_.req_;
+}
+inline ::dsnet::Request* PrepareMessage::mutable_req() {
+  ::dsnet::Request* _msg = _internal_mutable_req();
+  // @@protoc_insertion_point(field_mutable:dsnet.fastpaxos.proto.PrepareMessage.req)
+  return _msg;
+}
+inline void PrepareMessage::set_allocated_req(::dsnet::Request* req) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete reinterpret_cast< ::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.req_);
+  }
+  if (req) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(
+                reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(req));
+    if (message_arena != submessage_arena) {
+      req = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, req, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.req_ = req;
+  // @@protoc_insertion_point(field_set_allocated:dsnet.fastpaxos.proto.PrepareMessage.req)
+}
+
+// -------------------------------------------------------------------
+
+// CommitMessage
+
+// required uint64 view = 1;
+inline bool CommitMessage::_internal_has_view() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool CommitMessage::has_view() const {
+  return _internal_has_view();
+}
+inline void CommitMessage::clear_view() {
+  _impl_.view_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline uint64_t CommitMessage::_internal_view() const {
+  return _impl_.view_;
+}
+inline uint64_t CommitMessage::view() const {
+  // @@protoc_insertion_point(field_get:dsnet.fastpaxos.proto.CommitMessage.view)
+  return _internal_view();
+}
+inline void CommitMessage::_internal_set_view(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.view_ = value;
+}
+inline void CommitMessage::set_view(uint64_t value) {
+  _internal_set_view(value);
+  // @@protoc_insertion_point(field_set:dsnet.fastpaxos.proto.CommitMessage.view)
+}
+
+// required uint64 opnum = 2;
+inline bool CommitMessage::_internal_has_opnum() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool CommitMessage::has_opnum() const {
+  return _internal_has_opnum();
+}
+inline void CommitMessage::clear_opnum() {
+  _impl_.opnum_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline uint64_t CommitMessage::_internal_opnum() const {
+  return _impl_.opnum_;
+}
+inline uint64_t CommitMessage::opnum() const {
+  // @@protoc_insertion_point(field_get:dsnet.fastpaxos.proto.CommitMessage.opnum)
+  return _internal_opnum();
+}
+inline void CommitMessage::_internal_set_opnum(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.opnum_ = value;
+}
+inline void CommitMessage::set_opnum(uint64_t value) {
+  _internal_set_opnum(value);
+  // @@protoc_insertion_point(field_set:dsnet.fastpaxos.proto.CommitMessage.opnum)
+}
+
+// required .dsnet.Request req = 3;
+inline bool CommitMessage::_internal_has_req() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.req_ != nullptr);
+  return value;
+}
+inline bool CommitMessage::has_req() const {
+  return _internal_has_req();
+}
+inline const ::dsnet::Request& CommitMessage::_internal_req() const {
+  const ::dsnet::Request* p = _impl_.req_;
+  return p != nullptr ? *p : reinterpret_cast<const ::dsnet::Request&>(
+      ::dsnet::_Request_default_instance_);
+}
+inline const ::dsnet::Request& CommitMessage::req() const {
+  // @@protoc_insertion_point(field_get:dsnet.fastpaxos.proto.CommitMessage.req)
+  return _internal_req();
+}
+inline void CommitMessage::unsafe_arena_set_allocated_req(
+    ::dsnet::Request* req) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.req_);
+  }
+  _impl_.req_ = req;
+  if (req) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:dsnet.fastpaxos.proto.CommitMessage.req)
+}
+inline ::dsnet::Request* CommitMessage::release_req() {
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::dsnet::Request* temp = _impl_.req_;
+  _impl_.req_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::dsnet::Request* CommitMessage::unsafe_arena_release_req() {
+  // @@protoc_insertion_point(field_release:dsnet.fastpaxos.proto.CommitMessage.req)
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::dsnet::Request* temp = _impl_.req_;
+  _impl_.req_ = nullptr;
+  return temp;
+}
+inline ::dsnet::Request* CommitMessage::_internal_mutable_req() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  if (_impl_.req_ == nullptr) {
+    auto* p = CreateMaybeMessage<::dsnet::Request>(GetArenaForAllocation());
+    _impl_.req_ = p;
+  }
+  return _impl_.req_;
+}
+inline ::dsnet::Request* CommitMessage::mutable_req() {
+  ::dsnet::Request* _msg = _internal_mutable_req();
+  // @@protoc_insertion_point(field_mutable:dsnet.fastpaxos.proto.CommitMessage.req)
+  return _msg;
+}
+inline void CommitMessage::set_allocated_req(::dsnet::Request* req) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete reinterpret_cast< ::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.req_);
+  }
+  if (req) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(
+                reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(req));
+    if (message_arena != submessage_arena) {
+      req = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, req, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.req_ = req;
+  // @@protoc_insertion_point(field_set_allocated:dsnet.fastpaxos.proto.CommitMessage.req)
+}
+
+// -------------------------------------------------------------------
+
+// RequestStateTransferMessage
+
+// required uint64 view = 1;
+inline bool RequestStateTransferMessage::_internal_has_view() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool RequestStateTransferMessage::has_view() const {
+  return _internal_has_view();
+}
+inline void RequestStateTransferMessage::clear_view() {
+  _impl_.view_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline uint64_t RequestStateTransferMessage::_internal_view() const {
+  return _impl_.view_;
+}
+inline uint64_t RequestStateTransferMessage::view() const {
+  // @@protoc_insertion_point(field_get:dsnet.fastpaxos.proto.RequestStateTransferMessage.view)
+  return _internal_view();
+}
+inline void RequestStateTransferMessage::_internal_set_view(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.view_ = value;
+}
+inline void RequestStateTransferMessage::set_view(uint64_t value) {
+  _internal_set_view(value);
+  // @@protoc_insertion_point(field_set:dsnet.fastpaxos.proto.RequestStateTransferMessage.view)
+}
+
+// required uint64 opnum = 2;
+inline bool RequestStateTransferMessage::_internal_has_opnum() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool RequestStateTransferMessage::has_opnum() const {
+  return _internal_has_opnum();
+}
+inline void RequestStateTransferMessage::clear_opnum() {
+  _impl_.opnum_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline uint64_t RequestStateTransferMessage::_internal_opnum() const {
+  return _impl_.opnum_;
+}
+inline uint64_t RequestStateTransferMessage::opnum() const {
+  // @@protoc_insertion_point(field_get:dsnet.fastpaxos.proto.RequestStateTransferMessage.opnum)
+  return _internal_opnum();
+}
+inline void RequestStateTransferMessage::_internal_set_opnum(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.opnum_ = value;
+}
+inline void RequestStateTransferMessage::set_opnum(uint64_t value) {
+  _internal_set_opnum(value);
+  // @@protoc_insertion_point(field_set:dsnet.fastpaxos.proto.RequestStateTransferMessage.opnum)
+}
+
+// -------------------------------------------------------------------
+
+// StateTransferMessage
+
+// required uint64 view = 1;
+inline bool StateTransferMessage::_internal_has_view() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool StateTransferMessage::has_view() const {
+  return _internal_has_view();
+}
+inline void StateTransferMessage::clear_view() {
+  _impl_.view_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline uint64_t StateTransferMessage::_internal_view() const {
+  return _impl_.view_;
+}
+inline uint64_t StateTransferMessage::view() const {
+  // @@protoc_insertion_point(field_get:dsnet.fastpaxos.proto.StateTransferMessage.view)
+  return _internal_view();
+}
+inline void StateTransferMessage::_internal_set_view(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.view_ = value;
+}
+inline void StateTransferMessage::set_view(uint64_t value) {
+  _internal_set_view(value);
+  // @@protoc_insertion_point(field_set:dsnet.fastpaxos.proto.StateTransferMessage.view)
+}
+
+// required uint64 opnum = 2;
+inline bool StateTransferMessage::_internal_has_opnum() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool StateTransferMessage::has_opnum() const {
+  return _internal_has_opnum();
+}
+inline void StateTransferMessage::clear_opnum() {
+  _impl_.opnum_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline uint64_t StateTransferMessage::_internal_opnum() const {
+  return _impl_.opnum_;
+}
+inline uint64_t StateTransferMessage::opnum() const {
+  // @@protoc_insertion_point(field_get:dsnet.fastpaxos.proto.StateTransferMessage.opnum)
+  return _internal_opnum();
+}
+inline void StateTransferMessage::_internal_set_opnum(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.opnum_ = value;
+}
+inline void StateTransferMessage::set_opnum(uint64_t value) {
+  _internal_set_opnum(value);
+  // @@protoc_insertion_point(field_set:dsnet.fastpaxos.proto.StateTransferMessage.opnum)
+}
+
+// repeated .dsnet.MsgLogEntry entries = 3;
+inline int StateTransferMessage::_internal_entries_size() const {
+  return _impl_.entries_.size();
+}
+inline int StateTransferMessage::entries_size() const {
+  return _internal_entries_size();
+}
+inline ::dsnet::MsgLogEntry* StateTransferMessage::mutable_entries(int index) {
+  // @@protoc_insertion_point(field_mutable:dsnet.fastpaxos.proto.StateTransferMessage.entries)
+  return _impl_.entries_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::dsnet::MsgLogEntry >*
+StateTransferMessage::mutable_entries() {
+  // @@protoc_insertion_point(field_mutable_list:dsnet.fastpaxos.proto.StateTransferMessage.entries)
+  return &_impl_.entries_;
+}
+inline const ::dsnet::MsgLogEntry& StateTransferMessage::_internal_entries(int index) const {
+  return _impl_.entries_.Get(index);
+}
+inline const ::dsnet::MsgLogEntry& StateTransferMessage::entries(int index) const {
+  // @@protoc_insertion_point(field_get:dsnet.fastpaxos.proto.StateTransferMessage.entries)
+  return _internal_entries(index);
+}
+inline ::dsnet::MsgLogEntry* StateTransferMessage::_internal_add_entries() {
+  return _impl_.entries_.Add();
+}
+inline ::dsnet::MsgLogEntry* StateTransferMessage::add_entries() {
+  ::dsnet::MsgLogEntry* _add = _internal_add_entries();
+  // @@protoc_insertion_point(field_add:dsnet.fastpaxos.proto.StateTransferMessage.entries)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::dsnet::MsgLogEntry >&
+StateTransferMessage::entries() const {
+  // @@protoc_insertion_point(field_list:dsnet.fastpaxos.proto.StateTransferMessage.entries)
+  return _impl_.entries_;
+}
+
+// required uint64 lastop = 4;
+inline bool StateTransferMessage::_internal_has_lastop() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool StateTransferMessage::has_lastop() const {
+  return _internal_has_lastop();
+}
+inline void StateTransferMessage::clear_lastop() {
+  _impl_.lastop_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline uint64_t StateTransferMessage::_internal_lastop() const {
+  return _impl_.lastop_;
+}
+inline uint64_t StateTransferMessage::lastop() const {
+  // @@protoc_insertion_point(field_get:dsnet.fastpaxos.proto.StateTransferMessage.lastop)
+  return _internal_lastop();
+}
+inline void StateTransferMessage::_internal_set_lastop(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.lastop_ = value;
+}
+inline void StateTransferMessage::set_lastop(uint64_t value) {
+  _internal_set_lastop(value);
+  // @@protoc_insertion_point(field_set:dsnet.fastpaxos.proto.StateTransferMessage.lastop)
+}
+
+// -------------------------------------------------------------------
+
+// ToReplicaMessage
+
+// .dsnet.fastpaxos.proto.RequestMessage request = 1;
+inline bool ToReplicaMessage::_internal_has_request() const {
+  return msg_case() == kRequest;
+}
+inline bool ToReplicaMessage::has_request() const {
+  return _internal_has_request();
+}
+inline void ToReplicaMessage::set_has_request() {
+  _impl_._oneof_case_[0] = kRequest;
+}
+inline void ToReplicaMessage::clear_request() {
+  if (_internal_has_request()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.msg_.request_;
+    }
+    clear_has_msg();
+  }
+}
+inline ::dsnet::fastpaxos::proto::RequestMessage* ToReplicaMessage::release_request() {
+  // @@protoc_insertion_point(field_release:dsnet.fastpaxos.proto.ToReplicaMessage.request)
+  if (_internal_has_request()) {
+    clear_has_msg();
+    ::dsnet::fastpaxos::proto::RequestMessage* temp = _impl_.msg_.request_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.msg_.request_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::dsnet::fastpaxos::proto::RequestMessage& ToReplicaMessage::_internal_request() const {
+  return _internal_has_request()
+      ? *_impl_.msg_.request_
+      : reinterpret_cast< ::dsnet::fastpaxos::proto::RequestMessage&>(::dsnet::fastpaxos::proto::_RequestMessage_default_instance_);
+}
+inline const ::dsnet::fastpaxos::proto::RequestMessage& ToReplicaMessage::request() const {
+  // @@protoc_insertion_point(field_get:dsnet.fastpaxos.proto.ToReplicaMessage.request)
+  return _internal_request();
+}
+inline ::dsnet::fastpaxos::proto::RequestMessage* ToReplicaMessage::unsafe_arena_release_request() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:dsnet.fastpaxos.proto.ToReplicaMessage.request)
+  if (_internal_has_request()) {
+    clear_has_msg();
+    ::dsnet::fastpaxos::proto::RequestMessage* temp = _impl_.msg_.request_;
+    _impl_.msg_.request_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void ToReplicaMessage::unsafe_arena_set_allocated_request(::dsnet::fastpaxos::proto::RequestMessage* request) {
+  clear_msg();
+  if (request) {
+    set_has_request();
+    _impl_.msg_.request_ = request;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:dsnet.fastpaxos.proto.ToReplicaMessage.request)
+}
+inline ::dsnet::fastpaxos::proto::RequestMessage* ToReplicaMessage::_internal_mutable_request() {
+  if (!_internal_has_request()) {
+    clear_msg();
+    set_has_request();
+    _impl_.msg_.request_ = CreateMaybeMessage< ::dsnet::fastpaxos::proto::RequestMessage >(GetArenaForAllocation());
+  }
+  return _impl_.msg_.request_;
+}
+inline ::dsnet::fastpaxos::proto::RequestMessage* ToReplicaMessage::mutable_request() {
+  ::dsnet::fastpaxos::proto::RequestMessage* _msg = _internal_mutable_request();
+  // @@protoc_insertion_point(field_mutable:dsnet.fastpaxos.proto.ToReplicaMessage.request)
+  return _msg;
+}
+
+// .dsnet.fastpaxos.proto.UnloggedRequestMessage unlogged_request = 2;
+inline bool ToReplicaMessage::_internal_has_unlogged_request() const {
+  return msg_case() == kUnloggedRequest;
+}
+inline bool ToReplicaMessage::has_unlogged_request() const {
+  return _internal_has_unlogged_request();
+}
+inline void ToReplicaMessage::set_has_unlogged_request() {
+  _impl_._oneof_case_[0] = kUnloggedRequest;
+}
+inline void ToReplicaMessage::clear_unlogged_request() {
+  if (_internal_has_unlogged_request()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.msg_.unlogged_request_;
+    }
+    clear_has_msg();
+  }
+}
+inline ::dsnet::fastpaxos::proto::UnloggedRequestMessage* ToReplicaMessage::release_unlogged_request() {
+  // @@protoc_insertion_point(field_release:dsnet.fastpaxos.proto.ToReplicaMessage.unlogged_request)
+  if (_internal_has_unlogged_request()) {
+    clear_has_msg();
+    ::dsnet::fastpaxos::proto::UnloggedRequestMessage* temp = _impl_.msg_.unlogged_request_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.msg_.unlogged_request_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::dsnet::fastpaxos::proto::UnloggedRequestMessage& ToReplicaMessage::_internal_unlogged_request() const {
+  return _internal_has_unlogged_request()
+      ? *_impl_.msg_.unlogged_request_
+      : reinterpret_cast< ::dsnet::fastpaxos::proto::UnloggedRequestMessage&>(::dsnet::fastpaxos::proto::_UnloggedRequestMessage_default_instance_);
+}
+inline const ::dsnet::fastpaxos::proto::UnloggedRequestMessage& ToReplicaMessage::unlogged_request() const {
+  // @@protoc_insertion_point(field_get:dsnet.fastpaxos.proto.ToReplicaMessage.unlogged_request)
+  return _internal_unlogged_request();
+}
+inline ::dsnet::fastpaxos::proto::UnloggedRequestMessage* ToReplicaMessage::unsafe_arena_release_unlogged_request() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:dsnet.fastpaxos.proto.ToReplicaMessage.unlogged_request)
+  if (_internal_has_unlogged_request()) {
+    clear_has_msg();
+    ::dsnet::fastpaxos::proto::UnloggedRequestMessage* temp = _impl_.msg_.unlogged_request_;
+    _impl_.msg_.unlogged_request_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void ToReplicaMessage::unsafe_arena_set_allocated_unlogged_request(::dsnet::fastpaxos::proto::UnloggedRequestMessage* unlogged_request) {
+  clear_msg();
+  if (unlogged_request) {
+    set_has_unlogged_request();
+    _impl_.msg_.unlogged_request_ = unlogged_request;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:dsnet.fastpaxos.proto.ToReplicaMessage.unlogged_request)
+}
+inline ::dsnet::fastpaxos::proto::UnloggedRequestMessage* ToReplicaMessage::_internal_mutable_unlogged_request() {
+  if (!_internal_has_unlogged_request()) {
+    clear_msg();
+    set_has_unlogged_request();
+    _impl_.msg_.unlogged_request_ = CreateMaybeMessage< ::dsnet::fastpaxos::proto::UnloggedRequestMessage >(GetArenaForAllocation());
+  }
+  return _impl_.msg_.unlogged_request_;
+}
+inline ::dsnet::fastpaxos::proto::UnloggedRequestMessage* ToReplicaMessage::mutable_unlogged_request() {
+  ::dsnet::fastpaxos::proto::UnloggedRequestMessage* _msg = _internal_mutable_unlogged_request();
+  // @@protoc_insertion_point(field_mutable:dsnet.fastpaxos.proto.ToReplicaMessage.unlogged_request)
+  return _msg;
+}
+
+// .dsnet.fastpaxos.proto.PrepareMessage prepare = 3;
+inline bool ToReplicaMessage::_internal_has_prepare() const {
+  return msg_case() == kPrepare;
+}
+inline bool ToReplicaMessage::has_prepare() const {
+  return _internal_has_prepare();
+}
+inline void ToReplicaMessage::set_has_prepare() {
+  _impl_._oneof_case_[0] = kPrepare;
+}
+inline void ToReplicaMessage::clear_prepare() {
+  if (_internal_has_prepare()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.msg_.prepare_;
+    }
+    clear_has_msg();
+  }
+}
+inline ::dsnet::fastpaxos::proto::PrepareMessage* ToReplicaMessage::release_prepare() {
+  // @@protoc_insertion_point(field_release:dsnet.fastpaxos.proto.ToReplicaMessage.prepare)
+  if (_internal_has_prepare()) {
+    clear_has_msg();
+    ::dsnet::fastpaxos::proto::PrepareMessage* temp = _impl_.msg_.prepare_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.msg_.prepare_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::dsnet::fastpaxos::proto::PrepareMessage& ToReplicaMessage::_internal_prepare() const {
+  return _internal_has_prepare()
+      ? *_impl_.msg_.prepare_
+      : reinterpret_cast< ::dsnet::fastpaxos::proto::PrepareMessage&>(::dsnet::fastpaxos::proto::_PrepareMessage_default_instance_);
+}
+inline const ::dsnet::fastpaxos::proto::PrepareMessage& ToReplicaMessage::prepare() const {
+  // @@protoc_insertion_point(field_get:dsnet.fastpaxos.proto.ToReplicaMessage.prepare)
+  return _internal_prepare();
+}
+inline ::dsnet::fastpaxos::proto::PrepareMessage* ToReplicaMessage::unsafe_arena_release_prepare() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:dsnet.fastpaxos.proto.ToReplicaMessage.prepare)
+  if (_internal_has_prepare()) {
+    clear_has_msg();
+    ::dsnet::fastpaxos::proto::PrepareMessage* temp = _impl_.msg_.prepare_;
+    _impl_.msg_.prepare_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void ToReplicaMessage::unsafe_arena_set_allocated_prepare(::dsnet::fastpaxos::proto::PrepareMessage* prepare) {
+  clear_msg();
+  if (prepare) {
+    set_has_prepare();
+    _impl_.msg_.prepare_ = prepare;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:dsnet.fastpaxos.proto.ToReplicaMessage.prepare)
+}
+inline ::dsnet::fastpaxos::proto::PrepareMessage* ToReplicaMessage::_internal_mutable_prepare() {
+  if (!_internal_has_prepare()) {
+    clear_msg();
+    set_has_prepare();
+    _impl_.msg_.prepare_ = CreateMaybeMessage< ::dsnet::fastpaxos::proto::PrepareMessage >(GetArenaForAllocation());
+  }
+  return _impl_.msg_.prepare_;
+}
+inline ::dsnet::fastpaxos::proto::PrepareMessage* ToReplicaMessage::mutable_prepare() {
+  ::dsnet::fastpaxos::proto::PrepareMessage* _msg = _internal_mutable_prepare();
+  // @@protoc_insertion_point(field_mutable:dsnet.fastpaxos.proto.ToReplicaMessage.prepare)
+  return _msg;
+}
+
+// .dsnet.fastpaxos.proto.PrepareOKMessage prepare_ok = 4;
+inline bool ToReplicaMessage::_internal_has_prepare_ok() const {
+  return msg_case() == kPrepareOk;
+}
+inline bool ToReplicaMessage::has_prepare_ok() const {
+  return _internal_has_prepare_ok();
+}
+inline void ToReplicaMessage::set_has_prepare_ok() {
+  _impl_._oneof_case_[0] = kPrepareOk;
+}
+inline void ToReplicaMessage::clear_prepare_ok() {
+  if (_internal_has_prepare_ok()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.msg_.prepare_ok_;
+    }
+    clear_has_msg();
+  }
+}
+inline ::dsnet::fastpaxos::proto::PrepareOKMessage* ToReplicaMessage::release_prepare_ok() {
+  // @@protoc_insertion_point(field_release:dsnet.fastpaxos.proto.ToReplicaMessage.prepare_ok)
+  if (_internal_has_prepare_ok()) {
+    clear_has_msg();
+    ::dsnet::fastpaxos::proto::PrepareOKMessage* temp = _impl_.msg_.prepare_ok_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.msg_.prepare_ok_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::dsnet::fastpaxos::proto::PrepareOKMessage& ToReplicaMessage::_internal_prepare_ok() const {
+  return _internal_has_prepare_ok()
+      ? *_impl_.msg_.prepare_ok_
+      : reinterpret_cast< ::dsnet::fastpaxos::proto::PrepareOKMessage&>(::dsnet::fastpaxos::proto::_PrepareOKMessage_default_instance_);
+}
+inline const ::dsnet::fastpaxos::proto::PrepareOKMessage& ToReplicaMessage::prepare_ok() const {
+  // @@protoc_insertion_point(field_get:dsnet.fastpaxos.proto.ToReplicaMessage.prepare_ok)
+  return _internal_prepare_ok();
+}
+inline ::dsnet::fastpaxos::proto::PrepareOKMessage* ToReplicaMessage::unsafe_arena_release_prepare_ok() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:dsnet.fastpaxos.proto.ToReplicaMessage.prepare_ok)
+  if (_internal_has_prepare_ok()) {
+    clear_has_msg();
+    ::dsnet::fastpaxos::proto::PrepareOKMessage* temp = _impl_.msg_.prepare_ok_;
+    _impl_.msg_.prepare_ok_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void ToReplicaMessage::unsafe_arena_set_allocated_prepare_ok(::dsnet::fastpaxos::proto::PrepareOKMessage* prepare_ok) {
+  clear_msg();
+  if (prepare_ok) {
+    set_has_prepare_ok();
+    _impl_.msg_.prepare_ok_ = prepare_ok;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:dsnet.fastpaxos.proto.ToReplicaMessage.prepare_ok)
+}
+inline ::dsnet::fastpaxos::proto::PrepareOKMessage* ToReplicaMessage::_internal_mutable_prepare_ok() {
+  if (!_internal_has_prepare_ok()) {
+    clear_msg();
+    set_has_prepare_ok();
+    _impl_.msg_.prepare_ok_ = CreateMaybeMessage< ::dsnet::fastpaxos::proto::PrepareOKMessage >(GetArenaForAllocation());
+  }
+  return _impl_.msg_.prepare_ok_;
+}
+inline ::dsnet::fastpaxos::proto::PrepareOKMessage* ToReplicaMessage::mutable_prepare_ok() {
+  ::dsnet::fastpaxos::proto::PrepareOKMessage* _msg = _internal_mutable_prepare_ok();
+  // @@protoc_insertion_point(field_mutable:dsnet.fastpaxos.proto.ToReplicaMessage.prepare_ok)
+  return _msg;
+}
+
+// .dsnet.fastpaxos.proto.CommitMessage commit = 5;
+inline bool ToReplicaMessage::_internal_has_commit() const {
+  return msg_case() == kCommit;
+}
+inline bool ToReplicaMessage::has_commit() const {
+  return _internal_has_commit();
+}
+inline void ToReplicaMessage::set_has_commit() {
+  _impl_._oneof_case_[0] = kCommit;
+}
+inline void ToReplicaMessage::clear_commit() {
+  if (_internal_has_commit()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.msg_.commit_;
+    }
+    clear_has_msg();
+  }
+}
+inline ::dsnet::fastpaxos::proto::CommitMessage* ToReplicaMessage::release_commit() {
+  // @@protoc_insertion_point(field_release:dsnet.fastpaxos.proto.ToReplicaMessage.commit)
+  if (_internal_has_commit()) {
+    clear_has_msg();
+    ::dsnet::fastpaxos::proto::CommitMessage* temp = _impl_.msg_.commit_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.msg_.commit_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::dsnet::fastpaxos::proto::CommitMessage& ToReplicaMessage::_internal_commit() const {
+  return _internal_has_commit()
+      ? *_impl_.msg_.commit_
+      : reinterpret_cast< ::dsnet::fastpaxos::proto::CommitMessage&>(::dsnet::fastpaxos::proto::_CommitMessage_default_instance_);
+}
+inline const ::dsnet::fastpaxos::proto::CommitMessage& ToReplicaMessage::commit() const {
+  // @@protoc_insertion_point(field_get:dsnet.fastpaxos.proto.ToReplicaMessage.commit)
+  return _internal_commit();
+}
+inline ::dsnet::fastpaxos::proto::CommitMessage* ToReplicaMessage::unsafe_arena_release_commit() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:dsnet.fastpaxos.proto.ToReplicaMessage.commit)
+  if (_internal_has_commit()) {
+    clear_has_msg();
+    ::dsnet::fastpaxos::proto::CommitMessage* temp = _impl_.msg_.commit_;
+    _impl_.msg_.commit_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void ToReplicaMessage::unsafe_arena_set_allocated_commit(::dsnet::fastpaxos::proto::CommitMessage* commit) {
+  clear_msg();
+  if (commit) {
+    set_has_commit();
+    _impl_.msg_.commit_ = commit;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:dsnet.fastpaxos.proto.ToReplicaMessage.commit)
+}
+inline ::dsnet::fastpaxos::proto::CommitMessage* ToReplicaMessage::_internal_mutable_commit() {
+  if (!_internal_has_commit()) {
+    clear_msg();
+    set_has_commit();
+    _impl_.msg_.commit_ = CreateMaybeMessage< ::dsnet::fastpaxos::proto::CommitMessage >(GetArenaForAllocation());
+  }
+  return _impl_.msg_.commit_;
+}
+inline ::dsnet::fastpaxos::proto::CommitMessage* ToReplicaMessage::mutable_commit() {
+  ::dsnet::fastpaxos::proto::CommitMessage* _msg = _internal_mutable_commit();
+  // @@protoc_insertion_point(field_mutable:dsnet.fastpaxos.proto.ToReplicaMessage.commit)
+  return _msg;
+}
+
+// .dsnet.fastpaxos.proto.RequestStateTransferMessage request_state_transfer = 6;
+inline bool ToReplicaMessage::_internal_has_request_state_transfer() const {
+  return msg_case() == kRequestStateTransfer;
+}
+inline bool ToReplicaMessage::has_request_state_transfer() const {
+  return _internal_has_request_state_transfer();
+}
+inline void ToReplicaMessage::set_has_request_state_transfer() {
+  _impl_._oneof_case_[0] = kRequestStateTransfer;
+}
+inline void ToReplicaMessage::clear_request_state_transfer() {
+  if (_internal_has_request_state_transfer()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.msg_.request_state_transfer_;
+    }
+    clear_has_msg();
+  }
+}
+inline ::dsnet::fastpaxos::proto::RequestStateTransferMessage* ToReplicaMessage::release_request_state_transfer() {
+  // @@protoc_insertion_point(field_release:dsnet.fastpaxos.proto.ToReplicaMessage.request_state_transfer)
+  if (_internal_has_request_state_transfer()) {
+    clear_has_msg();
+    ::dsnet::fastpaxos::proto::RequestStateTransferMessage* temp = _impl_.msg_.request_state_transfer_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.msg_.request_state_transfer_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::dsnet::fastpaxos::proto::RequestStateTransferMessage& ToReplicaMessage::_internal_request_state_transfer() const {
+  return _internal_has_request_state_transfer()
+      ? *_impl_.msg_.request_state_transfer_
+      : reinterpret_cast< ::dsnet::fastpaxos::proto::RequestStateTransferMessage&>(::dsnet::fastpaxos::proto::_RequestStateTransferMessage_default_instance_);
+}
+inline const ::dsnet::fastpaxos::proto::RequestStateTransferMessage& ToReplicaMessage::request_state_transfer() const {
+  // @@protoc_insertion_point(field_get:dsnet.fastpaxos.proto.ToReplicaMessage.request_state_transfer)
+  return _internal_request_state_transfer();
+}
+inline ::dsnet::fastpaxos::proto::RequestStateTransferMessage* ToReplicaMessage::unsafe_arena_release_request_state_transfer() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:dsnet.fastpaxos.proto.ToReplicaMessage.request_state_transfer)
+  if (_internal_has_request_state_transfer()) {
+    clear_has_msg();
+    ::dsnet::fastpaxos::proto::RequestStateTransferMessage* temp = _impl_.msg_.request_state_transfer_;
+    _impl_.msg_.request_state_transfer_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void ToReplicaMessage::unsafe_arena_set_allocated_request_state_transfer(::dsnet::fastpaxos::proto::RequestStateTransferMessage* request_state_transfer) {
+  clear_msg();
+  if (request_state_transfer) {
+    set_has_request_state_transfer();
+    _impl_.msg_.request_state_transfer_ = request_state_transfer;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:dsnet.fastpaxos.proto.ToReplicaMessage.request_state_transfer)
+}
+inline ::dsnet::fastpaxos::proto::RequestStateTransferMessage* ToReplicaMessage::_internal_mutable_request_state_transfer() {
+  if (!_internal_has_request_state_transfer()) {
+    clear_msg();
+    set_has_request_state_transfer();
+    _impl_.msg_.request_state_transfer_ = CreateMaybeMessage< ::dsnet::fastpaxos::proto::RequestStateTransferMessage >(GetArenaForAllocation());
+  }
+  return _impl_.msg_.request_state_transfer_;
+}
+inline ::dsnet::fastpaxos::proto::RequestStateTransferMessage* ToReplicaMessage::mutable_request_state_transfer() {
+  ::dsnet::fastpaxos::proto::RequestStateTransferMessage* _msg = _internal_mutable_request_state_transfer();
+  // @@protoc_insertion_point(field_mutable:dsnet.fastpaxos.proto.ToReplicaMessage.request_state_transfer)
+  return _msg;
+}
+
+// .dsnet.fastpaxos.proto.StateTransferMessage state_transfer = 7;
+inline bool ToReplicaMessage::_internal_has_state_transfer() const {
+  return msg_case() == kStateTransfer;
+}
+inline bool ToReplicaMessage::has_state_transfer() const {
+  return _internal_has_state_transfer();
+}
+inline void ToReplicaMessage::set_has_state_transfer() {
+  _impl_._oneof_case_[0] = kStateTransfer;
+}
+inline void ToReplicaMessage::clear_state_transfer() {
+  if (_internal_has_state_transfer()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.msg_.state_transfer_;
+    }
+    clear_has_msg();
+  }
+}
+inline ::dsnet::fastpaxos::proto::StateTransferMessage* ToReplicaMessage::release_state_transfer() {
+  // @@protoc_insertion_point(field_release:dsnet.fastpaxos.proto.ToReplicaMessage.state_transfer)
+  if (_internal_has_state_transfer()) {
+    clear_has_msg();
+    ::dsnet::fastpaxos::proto::StateTransferMessage* temp = _impl_.msg_.state_transfer_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.msg_.state_transfer_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::dsnet::fastpaxos::proto::StateTransferMessage& ToReplicaMessage::_internal_state_transfer() const {
+  return _internal_has_state_transfer()
+      ? *_impl_.msg_.state_transfer_
+      : reinterpret_cast< ::dsnet::fastpaxos::proto::StateTransferMessage&>(::dsnet::fastpaxos::proto::_StateTransferMessage_default_instance_);
+}
+inline const ::dsnet::fastpaxos::proto::StateTransferMessage& ToReplicaMessage::state_transfer() const {
+  // @@protoc_insertion_point(field_get:dsnet.fastpaxos.proto.ToReplicaMessage.state_transfer)
+  return _internal_state_transfer();
+}
+inline ::dsnet::fastpaxos::proto::StateTransferMessage* ToReplicaMessage::unsafe_arena_release_state_transfer() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:dsnet.fastpaxos.proto.ToReplicaMessage.state_transfer)
+  if (_internal_has_state_transfer()) {
+    clear_has_msg();
+    ::dsnet::fastpaxos::proto::StateTransferMessage* temp = _impl_.msg_.state_transfer_;
+    _impl_.msg_.state_transfer_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void ToReplicaMessage::unsafe_arena_set_allocated_state_transfer(::dsnet::fastpaxos::proto::StateTransferMessage* state_transfer) {
+  clear_msg();
+  if (state_transfer) {
+    set_has_state_transfer();
+    _impl_.msg_.state_transfer_ = state_transfer;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:dsnet.fastpaxos.proto.ToReplicaMessage.state_transfer)
+}
+inline ::dsnet::fastpaxos::proto::StateTransferMessage* ToReplicaMessage::_internal_mutable_state_transfer() {
+  if (!_internal_has_state_transfer()) {
+    clear_msg();
+    set_has_state_transfer();
+    _impl_.msg_.state_transfer_ = CreateMaybeMessage< ::dsnet::fastpaxos::proto::StateTransferMessage >(GetArenaForAllocation());
+  }
+  return _impl_.msg_.state_transfer_;
+}
+inline ::dsnet::fastpaxos::proto::StateTransferMessage* ToReplicaMessage::mutable_state_transfer() {
+  ::dsnet::fastpaxos::proto::StateTransferMessage* _msg = _internal_mutable_state_transfer();
+  // @@protoc_insertion_point(field_mutable:dsnet.fastpaxos.proto.ToReplicaMessage.state_transfer)
+  return _msg;
+}
+
+inline bool ToReplicaMessage::has_msg() const {
+  return msg_case() != MSG_NOT_SET;
+}
+inline void ToReplicaMessage::clear_has_msg() {
+  _impl_._oneof_case_[0] = MSG_NOT_SET;
+}
+inline ToReplicaMessage::MsgCase ToReplicaMessage::msg_case() const {
+  return ToReplicaMessage::MsgCase(_impl_._oneof_case_[0]);
+}
+#ifdef __GNUC__
+  #pragma GCC diagnostic pop
+#endif  // __GNUC__
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+
+// @@protoc_insertion_point(namespace_scope)
+
+}  // namespace proto
+}  // namespace fastpaxos
+}  // namespace dsnet
+
+// @@protoc_insertion_point(global_scope)
+
+#include <google/protobuf/port_undef.inc>
+#endif  // GOOGLE_PROTOBUF_INCLUDED_GOOGLE_PROTOBUF_INCLUDED_replication_2ffastpaxos_2ffastpaxos_2dproto_2eproto
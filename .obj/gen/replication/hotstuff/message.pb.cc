@@ -0,0 +1,4172 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: replication/hotstuff/message.proto
+
+#include "replication/hotstuff/message.pb.h"
+
+#include <algorithm>
+
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/extension_set.h>
+#include <google/protobuf/wire_format_lite.h>
+#include <google/protobuf/descriptor.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/reflection_ops.h>
+#include <google/protobuf/wire_format.h>
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+
+PROTOBUF_PRAGMA_INIT_SEG
+
+namespace _pb = ::PROTOBUF_NAMESPACE_ID;
+namespace _pbi = _pb::internal;
+
+namespace dsnet {
+namespace hotstuff {
+namespace proto {
+PROTOBUF_CONSTEXPR Message::Message(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.get_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_._oneof_case_)*/{}} {}
+struct MessageDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR MessageDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~MessageDefaultTypeInternal() {}
+  union {
+    Message _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 MessageDefaultTypeInternal _Message_default_instance_;
+PROTOBUF_CONSTEXPR ReplyMessage::ReplyMessage(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.result_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.client_request_)*/0u
+  , /*decltype(_impl_.replica_index_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct ReplyMessageDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ReplyMessageDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ReplyMessageDefaultTypeInternal() {}
+  union {
+    ReplyMessage _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ReplyMessageDefaultTypeInternal _ReplyMessage_default_instance_;
+PROTOBUF_CONSTEXPR GenericMessage::GenericMessage(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.block_)*/nullptr
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct GenericMessageDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR GenericMessageDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~GenericMessageDefaultTypeInternal() {}
+  union {
+    GenericMessage _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 GenericMessageDefaultTypeInternal _GenericMessage_default_instance_;
+PROTOBUF_CONSTEXPR VoteMessage::VoteMessage(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.partial_signature_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.nonce_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.op_number_)*/uint64_t{0u}
+  , /*decltype(_impl_.nonce_seq_)*/uint64_t{0u}
+  , /*decltype(_impl_.replica_index_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct VoteMessageDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR VoteMessageDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~VoteMessageDefaultTypeInternal() {}
+  union {
+    VoteMessage _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 VoteMessageDefaultTypeInternal _VoteMessage_default_instance_;
+PROTOBUF_CONSTEXPR NonceMessage::NonceMessage(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.nonce_)*/{}
+  , /*decltype(_impl_.nonce_seq_)*/uint64_t{0u}
+  , /*decltype(_impl_.replica_index_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct NonceMessageDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR NonceMessageDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~NonceMessageDefaultTypeInternal() {}
+  union {
+    NonceMessage _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 NonceMessageDefaultTypeInternal _NonceMessage_default_instance_;
+PROTOBUF_CONSTEXPR Block::Block(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.request_)*/{}
+  , /*decltype(_impl_.nonce_seq_)*/{}
+  , /*decltype(_impl_._nonce_seq_cached_byte_size_)*/{0}
+  , /*decltype(_impl_.aggregate_nonce_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.justify_)*/nullptr
+  , /*decltype(_impl_.op_number_)*/uint64_t{0u}
+  , /*decltype(_impl_.signers_)*/uint64_t{0u}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct BlockDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR BlockDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~BlockDefaultTypeInternal() {}
+  union {
+    Block _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 BlockDefaultTypeInternal _Block_default_instance_;
+PROTOBUF_CONSTEXPR QC::QC(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.signed_vote_)*/{}
+  , /*decltype(_impl_.aggregate_signature_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.op_number_)*/uint64_t{0u}
+  , /*decltype(_impl_.signers_)*/uint64_t{0u}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct QCDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR QCDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~QCDefaultTypeInternal() {}
+  union {
+    QC _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 QCDefaultTypeInternal _QC_default_instance_;
+PROTOBUF_CONSTEXPR Checkpoint::Checkpoint(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.digest_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.op_number_)*/uint64_t{0u}
+  , /*decltype(_impl_.replica_index_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct CheckpointDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR CheckpointDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~CheckpointDefaultTypeInternal() {}
+  union {
+    Checkpoint _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 CheckpointDefaultTypeInternal _Checkpoint_default_instance_;
+PROTOBUF_CONSTEXPR StateRequest::StateRequest(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.op_number_)*/uint64_t{0u}
+  , /*decltype(_impl_.last_op_number_)*/uint64_t{0u}
+  , /*decltype(_impl_.replica_index_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct StateRequestDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR StateRequestDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~StateRequestDefaultTypeInternal() {}
+  union {
+    StateRequest _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 StateRequestDefaultTypeInternal _StateRequest_default_instance_;
+PROTOBUF_CONSTEXPR StateChunk::StateChunk(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.entry_)*/{}
+  , /*decltype(_impl_.checkpoint_)*/nullptr
+  , /*decltype(_impl_.op_number_)*/uint64_t{0u}
+  , /*decltype(_impl_.replica_index_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct StateChunkDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR StateChunkDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~StateChunkDefaultTypeInternal() {}
+  union {
+    StateChunk _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 StateChunkDefaultTypeInternal _StateChunk_default_instance_;
+PROTOBUF_CONSTEXPR StateEntry::StateEntry(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.request_)*/nullptr
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct StateEntryDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR StateEntryDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~StateEntryDefaultTypeInternal() {}
+  union {
+    StateEntry _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 StateEntryDefaultTypeInternal _StateEntry_default_instance_;
+PROTOBUF_CONSTEXPR StableCheckpoint::StableCheckpoint(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.signed_checkpoint_)*/{}
+  , /*decltype(_impl_.app_state_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.digest_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.op_number_)*/uint64_t{0u}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct StableCheckpointDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR StableCheckpointDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~StableCheckpointDefaultTypeInternal() {}
+  union {
+    StableCheckpoint _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 StableCheckpointDefaultTypeInternal _StableCheckpoint_default_instance_;
+}  // namespace proto
+}  // namespace hotstuff
+}  // namespace dsnet
+static ::_pb::Metadata file_level_metadata_replication_2fhotstuff_2fmessage_2eproto[12];
+static constexpr ::_pb::EnumDescriptor const** file_level_enum_descriptors_replication_2fhotstuff_2fmessage_2eproto = nullptr;
+static constexpr ::_pb::ServiceDescriptor const** file_level_service_descriptors_replication_2fhotstuff_2fmessage_2eproto = nullptr;
+
+const uint32_t TableStruct_replication_2fhotstuff_2fmessage_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::dsnet::hotstuff::proto::Message, _internal_metadata_),
+  ~0u,  // no _extensions_
+  PROTOBUF_FIELD_OFFSET(::dsnet::hotstuff::proto::Message, _impl_._oneof_case_[0]),
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  PROTOBUF_FIELD_OFFSET(::dsnet::hotstuff::proto::Message, _impl_.get_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::dsnet::hotstuff::proto::ReplyMessage, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::dsnet::hotstuff::proto::ReplyMessage, _impl_.client_request_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::hotstuff::proto::ReplyMessage, _impl_.result_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::hotstuff::proto::ReplyMessage, _impl_.replica_index_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::dsnet::hotstuff::proto::GenericMessage, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::dsnet::hotstuff::proto::GenericMessage, _impl_.block_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::dsnet::hotstuff::proto::VoteMessage, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::dsnet::hotstuff::proto::VoteMessage, _impl_.replica_index_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::hotstuff::proto::VoteMessage, _impl_.op_number_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::hotstuff::proto::VoteMessage, _impl_.partial_signature_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::hotstuff::proto::VoteMessage, _impl_.nonce_seq_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::hotstuff::proto::VoteMessage, _impl_.nonce_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::dsnet::hotstuff::proto::NonceMessage, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::dsnet::hotstuff::proto::NonceMessage, _impl_.replica_index_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::hotstuff::proto::NonceMessage, _impl_.nonce_seq_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::hotstuff::proto::NonceMessage, _impl_.nonce_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::dsnet::hotstuff::proto::Block, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::dsnet::hotstuff::proto::Block, _impl_.op_number_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::hotstuff::proto::Block, _impl_.request_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::hotstuff::proto::Block, _impl_.justify_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::hotstuff::proto::Block, _impl_.signers_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::hotstuff::proto::Block, _impl_.nonce_seq_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::hotstuff::proto::Block, _impl_.aggregate_nonce_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::dsnet::hotstuff::proto::QC, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::dsnet::hotstuff::proto::QC, _impl_.op_number_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::hotstuff::proto::QC, _impl_.signed_vote_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::hotstuff::proto::QC, _impl_.signers_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::hotstuff::proto::QC, _impl_.aggregate_signature_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::dsnet::hotstuff::proto::Checkpoint, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::dsnet::hotstuff::proto::Checkpoint, _impl_.op_number_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::hotstuff::proto::Checkpoint, _impl_.replica_index_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::hotstuff::proto::Checkpoint, _impl_.digest_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::dsnet::hotstuff::proto::StateRequest, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::dsnet::hotstuff::proto::StateRequest, _impl_.op_number_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::hotstuff::proto::StateRequest, _impl_.last_op_number_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::hotstuff::proto::StateRequest, _impl_.replica_index_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::dsnet::hotstuff::proto::StateChunk, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::dsnet::hotstuff::proto::StateChunk, _impl_.op_number_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::hotstuff::proto::StateChunk, _impl_.entry_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::hotstuff::proto::StateChunk, _impl_.checkpoint_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::hotstuff::proto::StateChunk, _impl_.replica_index_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::dsnet::hotstuff::proto::StateEntry, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::dsnet::hotstuff::proto::StateEntry, _impl_.request_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::dsnet::hotstuff::proto::StableCheckpoint, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::dsnet::hotstuff::proto::StableCheckpoint, _impl_.op_number_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::hotstuff::proto::StableCheckpoint, _impl_.app_state_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::hotstuff::proto::StableCheckpoint, _impl_.signed_checkpoint_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::hotstuff::proto::StableCheckpoint, _impl_.digest_),
+};
+static const ::_pbi::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  { 0, -1, -1, sizeof(::dsnet::hotstuff::proto::Message)},
+  { 15, -1, -1, sizeof(::dsnet::hotstuff::proto::ReplyMessage)},
+  { 24, -1, -1, sizeof(::dsnet::hotstuff::proto::GenericMessage)},
+  { 31, -1, -1, sizeof(::dsnet::hotstuff::proto::VoteMessage)},
+  { 42, -1, -1, sizeof(::dsnet::hotstuff::proto::NonceMessage)},
+  { 51, -1, -1, sizeof(::dsnet::hotstuff::proto::Block)},
+  { 63, -1, -1, sizeof(::dsnet::hotstuff::proto::QC)},
+  { 73, -1, -1, sizeof(::dsnet::hotstuff::proto::Checkpoint)},
+  { 82, -1, -1, sizeof(::dsnet::hotstuff::proto::StateRequest)},
+  { 91, -1, -1, sizeof(::dsnet::hotstuff::proto::StateChunk)},
+  { 101, -1, -1, sizeof(::dsnet::hotstuff::proto::StateEntry)},
+  { 108, -1, -1, sizeof(::dsnet::hotstuff::proto::StableCheckpoint)},
+};
+
+static const ::_pb::Message* const file_default_instances[] = {
+  &::dsnet::hotstuff::proto::_Message_default_instance_._instance,
+  &::dsnet::hotstuff::proto::_ReplyMessage_default_instance_._instance,
+  &::dsnet::hotstuff::proto::_GenericMessage_default_instance_._instance,
+  &::dsnet::hotstuff::proto::_VoteMessage_default_instance_._instance,
+  &::dsnet::hotstuff::proto::_NonceMessage_default_instance_._instance,
+  &::dsnet::hotstuff::proto::_Block_default_instance_._instance,
+  &::dsnet::hotstuff::proto::_QC_default_instance_._instance,
+  &::dsnet::hotstuff::proto::_Checkpoint_default_instance_._instance,
+  &::dsnet::hotstuff::proto::_StateRequest_default_instance_._instance,
+  &::dsnet::hotstuff::proto::_StateChunk_default_instance_._instance,
+  &::dsnet::hotstuff::proto::_StateEntry_default_instance_._instance,
+  &::dsnet::hotstuff::proto::_StableCheckpoint_default_instance_._instance,
+};
+
+const char descriptor_table_protodef_replication_2fhotstuff_2fmessage_2eproto[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) =
+  "\n\"replication/hotstuff/message.proto\022\024ds"
+  "net.hotstuff.proto\032\024common/request.proto"
+  "\"\267\003\n\007Message\022!\n\007request\030\001 \001(\0132\016.dsnet.Re"
+  "questH\000\0223\n\005reply\030\002 \001(\0132\".dsnet.hotstuff."
+  "proto.ReplyMessageH\000\0227\n\007generic\030\003 \001(\0132$."
+  "dsnet.hotstuff.proto.GenericMessageH\000\0221\n"
+  "\004vote\030\004 \001(\0132!.dsnet.hotstuff.proto.VoteM"
+  "essageH\000\0226\n\ncheckpoint\030\005 \001(\0132 .dsnet.hot"
+  "stuff.proto.CheckpointH\000\022;\n\rstate_reques"
+  "t\030\006 \001(\0132\".dsnet.hotstuff.proto.StateRequ"
+  "estH\000\0227\n\013state_chunk\030\007 \001(\0132 .dsnet.hotst"
+  "uff.proto.StateChunkH\000\0223\n\005nonce\030\010 \001(\0132\"."
+  "dsnet.hotstuff.proto.NonceMessageH\000B\005\n\003g"
+  "et\"M\n\014ReplyMessage\022\026\n\016client_request\030\001 \001"
+  "(\r\022\016\n\006result\030\002 \001(\014\022\025\n\rreplica_index\030\003 \001("
+  "\005\"<\n\016GenericMessage\022*\n\005block\030\001 \001(\0132\033.dsn"
+  "et.hotstuff.proto.Block\"t\n\013VoteMessage\022\025"
+  "\n\rreplica_index\030\001 \001(\005\022\021\n\top_number\030\002 \001(\004"
+  "\022\031\n\021partial_signature\030\003 \001(\014\022\021\n\tnonce_seq"
+  "\030\004 \001(\004\022\r\n\005nonce\030\005 \001(\014\"G\n\014NonceMessage\022\025\n"
+  "\rreplica_index\030\001 \001(\005\022\021\n\tnonce_seq\030\002 \001(\004\022"
+  "\r\n\005nonce\030\003 \003(\014\"\243\001\n\005Block\022\021\n\top_number\030\001 "
+  "\001(\004\022\037\n\007request\030\002 \003(\0132\016.dsnet.Request\022)\n\007"
+  "justify\030\003 \001(\0132\030.dsnet.hotstuff.proto.QC\022"
+  "\017\n\007signers\030\004 \001(\004\022\021\n\tnonce_seq\030\005 \003(\004\022\027\n\017a"
+  "ggregate_nonce\030\006 \001(\014\"Z\n\002QC\022\021\n\top_number\030"
+  "\001 \001(\004\022\023\n\013signed_vote\030\002 \003(\014\022\017\n\007signers\030\003 "
+  "\001(\004\022\033\n\023aggregate_signature\030\004 \001(\014\"F\n\nChec"
+  "kpoint\022\021\n\top_number\030\001 \001(\004\022\025\n\rreplica_ind"
+  "ex\030\002 \001(\005\022\016\n\006digest\030\003 \001(\014\"P\n\014StateRequest"
+  "\022\021\n\top_number\030\001 \001(\004\022\026\n\016last_op_number\030\002 "
+  "\001(\004\022\025\n\rreplica_index\030\003 \001(\005\"\243\001\n\nStateChun"
+  "k\022\021\n\top_number\030\001 \001(\004\022/\n\005entry\030\002 \003(\0132 .ds"
+  "net.hotstuff.proto.StateEntry\022:\n\ncheckpo"
+  "int\030\003 \001(\0132&.dsnet.hotstuff.proto.StableC"
+  "heckpoint\022\025\n\rreplica_index\030\004 \001(\005\"-\n\nStat"
+  "eEntry\022\037\n\007request\030\001 \001(\0132\016.dsnet.Request\""
+  "c\n\020StableCheckpoint\022\021\n\top_number\030\001 \001(\004\022\021"
+  "\n\tapp_state\030\002 \001(\014\022\031\n\021signed_checkpoint\030\003"
+  " \003(\014\022\016\n\006digest\030\004 \001(\014b\006proto3"
+  ;
+static const ::_pbi::DescriptorTable* const descriptor_table_replication_2fhotstuff_2fmessage_2eproto_deps[1] = {
+  &::descriptor_table_common_2frequest_2eproto,
+};
+static ::_pbi::once_flag descriptor_table_replication_2fhotstuff_2fmessage_2eproto_once;
+const ::_pbi::DescriptorTable descriptor_table_replication_2fhotstuff_2fmessage_2eproto = {
+    false, false, 1588, descriptor_table_protodef_replication_2fhotstuff_2fmessage_2eproto,
+    "replication/hotstuff/message.proto",
+    &descriptor_table_replication_2fhotstuff_2fmessage_2eproto_once, descriptor_table_replication_2fhotstuff_2fmessage_2eproto_deps, 1, 12,
+    schemas, file_default_instances, TableStruct_replication_2fhotstuff_2fmessage_2eproto::offsets,
+    file_level_metadata_replication_2fhotstuff_2fmessage_2eproto, file_level_enum_descriptors_replication_2fhotstuff_2fmessage_2eproto,
+    file_level_service_descriptors_replication_2fhotstuff_2fmessage_2eproto,
+};
+PROTOBUF_ATTRIBUTE_WEAK const ::_pbi::DescriptorTable* descriptor_table_replication_2fhotstuff_2fmessage_2eproto_getter() {
+  return &descriptor_table_replication_2fhotstuff_2fmessage_2eproto;
+}
+
+// Force running AddDescriptors() at dynamic initialization time.
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 static ::_pbi::AddDescriptorsRunner dynamic_init_dummy_replication_2fhotstuff_2fmessage_2eproto(&descriptor_table_replication_2fhotstuff_2fmessage_2eproto);
+namespace dsnet {
+namespace hotstuff {
+namespace proto {
+
+// ===================================================================
+
+class Message::_Internal {
+ public:
+  static const ::dsnet::Request& request(const Message* msg);
+  static const ::dsnet::hotstuff::proto::ReplyMessage& reply(const Message* msg);
+  static const ::dsnet::hotstuff::proto::GenericMessage& generic(const Message* msg);
+  static const ::dsnet::hotstuff::proto::VoteMessage& vote(const Message* msg);
+  static const ::dsnet::hotstuff::proto::Checkpoint& checkpoint(const Message* msg);
+  static const ::dsnet::hotstuff::proto::StateRequest& state_request(const Message* msg);
+  static const ::dsnet::hotstuff::proto::StateChunk& state_chunk(const Message* msg);
+  static const ::dsnet::hotstuff::proto::NonceMessage& nonce(const Message* msg);
+};
+
+const ::dsnet::Request&
+Message::_Internal::request(const Message* msg) {
+  return *msg->_impl_.get_.request_;
+}
+const ::dsnet::hotstuff::proto::ReplyMessage&
+Message::_Internal::reply(const Message* msg) {
+  return *msg->_impl_.get_.reply_;
+}
+const ::dsnet::hotstuff::proto::GenericMessage&
+Message::_Internal::generic(const Message* msg) {
+  return *msg->_impl_.get_.generic_;
+}
+const ::dsnet::hotstuff::proto::VoteMessage&
+Message::_Internal::vote(const Message* msg) {
+  return *msg->_impl_.get_.vote_;
+}
+const ::dsnet::hotstuff::proto::Checkpoint&
+Message::_Internal::checkpoint(const Message* msg) {
+  return *msg->_impl_.get_.checkpoint_;
+}
+const ::dsnet::hotstuff::proto::StateRequest&
+Message::_Internal::state_request(const Message* msg) {
+  return *msg->_impl_.get_.state_request_;
+}
+const ::dsnet::hotstuff::proto::StateChunk&
+Message::_Internal::state_chunk(const Message* msg) {
+  return *msg->_impl_.get_.state_chunk_;
+}
+const ::dsnet::hotstuff::proto::NonceMessage&
+Message::_Internal::nonce(const Message* msg) {
+  return *msg->_impl_.get_.nonce_;
+}
+void Message::set_allocated_request(::dsnet::Request* request) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  clear_get();
+  if (request) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(
+                reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(request));
+    if (message_arena != submessage_arena) {
+      request = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, request, submessage_arena);
+    }
+    set_has_request();
+    _impl_.get_.request_ = request;
+  }
+  // @@protoc_insertion_point(field_set_allocated:dsnet.hotstuff.proto.Message.request)
+}
+void Message::clear_request() {
+  if (_internal_has_request()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.get_.request_;
+    }
+    clear_has_get();
+  }
+}
+void Message::set_allocated_reply(::dsnet::hotstuff::proto::ReplyMessage* reply) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  clear_get();
+  if (reply) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(reply);
+    if (message_arena != submessage_arena) {
+      reply = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, reply, submessage_arena);
+    }
+    set_has_reply();
+    _impl_.get_.reply_ = reply;
+  }
+  // @@protoc_insertion_point(field_set_allocated:dsnet.hotstuff.proto.Message.reply)
+}
+void Message::set_allocated_generic(::dsnet::hotstuff::proto::GenericMessage* generic) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  clear_get();
+  if (generic) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(generic);
+    if (message_arena != submessage_arena) {
+      generic = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, generic, submessage_arena);
+    }
+    set_has_generic();
+    _impl_.get_.generic_ = generic;
+  }
+  // @@protoc_insertion_point(field_set_allocated:dsnet.hotstuff.proto.Message.generic)
+}
+void Message::set_allocated_vote(::dsnet::hotstuff::proto::VoteMessage* vote) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  clear_get();
+  if (vote) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(vote);
+    if (message_arena != submessage_arena) {
+      vote = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, vote, submessage_arena);
+    }
+    set_has_vote();
+    _impl_.get_.vote_ = vote;
+  }
+  // @@protoc_insertion_point(field_set_allocated:dsnet.hotstuff.proto.Message.vote)
+}
+void Message::set_allocated_checkpoint(::dsnet::hotstuff::proto::Checkpoint* checkpoint) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  clear_get();
+  if (checkpoint) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(checkpoint);
+    if (message_arena != submessage_arena) {
+      checkpoint = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, checkpoint, submessage_arena);
+    }
+    set_has_checkpoint();
+    _impl_.get_.checkpoint_ = checkpoint;
+  }
+  // @@protoc_insertion_point(field_set_allocated:dsnet.hotstuff.proto.Message.checkpoint)
+}
+void Message::set_allocated_state_request(::dsnet::hotstuff::proto::StateRequest* state_request) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  clear_get();
+  if (state_request) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(state_request);
+    if (message_arena != submessage_arena) {
+      state_request = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, state_request, submessage_arena);
+    }
+    set_has_state_request();
+    _impl_.get_.state_request_ = state_request;
+  }
+  // @@protoc_insertion_point(field_set_allocated:dsnet.hotstuff.proto.Message.state_request)
+}
+void Message::set_allocated_state_chunk(::dsnet::hotstuff::proto::StateChunk* state_chunk) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  clear_get();
+  if (state_chunk) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(state_chunk);
+    if (message_arena != submessage_arena) {
+      state_chunk = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, state_chunk, submessage_arena);
+    }
+    set_has_state_chunk();
+    _impl_.get_.state_chunk_ = state_chunk;
+  }
+  // @@protoc_insertion_point(field_set_allocated:dsnet.hotstuff.proto.Message.state_chunk)
+}
+void Message::set_allocated_nonce(::dsnet::hotstuff::proto::NonceMessage* nonce) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  clear_get();
+  if (nonce) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(nonce);
+    if (message_arena != submessage_arena) {
+      nonce = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, nonce, submessage_arena);
+    }
+    set_has_nonce();
+    _impl_.get_.nonce_ = nonce;
+  }
+  // @@protoc_insertion_point(field_set_allocated:dsnet.hotstuff.proto.Message.nonce)
+}
+Message::Message(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:dsnet.hotstuff.proto.Message)
+}
+Message::Message(const Message& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  Message* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.get_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , /*decltype(_impl_._oneof_case_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  clear_has_get();
+  switch (from.get_case()) {
+    case kRequest: {
+      _this->_internal_mutable_request()->::dsnet::Request::MergeFrom(
+          from._internal_request());
+      break;
+    }
+    case kReply: {
+      _this->_internal_mutable_reply()->::dsnet::hotstuff::proto::ReplyMessage::MergeFrom(
+          from._internal_reply());
+      break;
+    }
+    case kGeneric: {
+      _this->_internal_mutable_generic()->::dsnet::hotstuff::proto::GenericMessage::MergeFrom(
+          from._internal_generic());
+      break;
+    }
+    case kVote: {
+      _this->_internal_mutable_vote()->::dsnet::hotstuff::proto::VoteMessage::MergeFrom(
+          from._internal_vote());
+      break;
+    }
+    case kCheckpoint: {
+      _this->_internal_mutable_checkpoint()->::dsnet::hotstuff::proto::Checkpoint::MergeFrom(
+          from._internal_checkpoint());
+      break;
+    }
+    case kStateRequest: {
+      _this->_internal_mutable_state_request()->::dsnet::hotstuff::proto::StateRequest::MergeFrom(
+          from._internal_state_request());
+      break;
+    }
+    case kStateChunk: {
+      _this->_internal_mutable_state_chunk()->::dsnet::hotstuff::proto::StateChunk::MergeFrom(
+          from._internal_state_chunk());
+      break;
+    }
+    case kNonce: {
+      _this->_internal_mutable_nonce()->::dsnet::hotstuff::proto::NonceMessage::MergeFrom(
+          from._internal_nonce());
+      break;
+    }
+    case GET_NOT_SET: {
+      break;
+    }
+  }
+  // @@protoc_insertion_point(copy_constructor:dsnet.hotstuff.proto.Message)
+}
+
+inline void Message::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.get_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , /*decltype(_impl_._oneof_case_)*/{}
+  };
+  clear_has_get();
+}
+
+Message::~Message() {
+  // @@protoc_insertion_point(destructor:dsnet.hotstuff.proto.Message)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void Message::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  if (has_get()) {
+    clear_get();
+  }
+}
+
+void Message::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void Message::clear_get() {
+// @@protoc_insertion_point(one_of_clear_start:dsnet.hotstuff.proto.Message)
+  switch (get_case()) {
+    case kRequest: {
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.get_.request_;
+      }
+      break;
+    }
+    case kReply: {
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.get_.reply_;
+      }
+      break;
+    }
+    case kGeneric: {
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.get_.generic_;
+      }
+      break;
+    }
+    case kVote: {
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.get_.vote_;
+      }
+      break;
+    }
+    case kCheckpoint: {
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.get_.checkpoint_;
+      }
+      break;
+    }
+    case kStateRequest: {
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.get_.state_request_;
+      }
+      break;
+    }
+    case kStateChunk: {
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.get_.state_chunk_;
+      }
+      break;
+    }
+    case kNonce: {
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.get_.nonce_;
+      }
+      break;
+    }
+    case GET_NOT_SET: {
+      break;
+    }
+  }
+  _impl_._oneof_case_[0] = GET_NOT_SET;
+}
+
+
+void Message::Clear() {
+// @@protoc_insertion_point(message_clear_start:dsnet.hotstuff.proto.Message)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  clear_get();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* Message::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // .dsnet.Request request = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr = ctx->ParseMessage(_internal_mutable_request(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .dsnet.hotstuff.proto.ReplyMessage reply = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr = ctx->ParseMessage(_internal_mutable_reply(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .dsnet.hotstuff.proto.GenericMessage generic = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          ptr = ctx->ParseMessage(_internal_mutable_generic(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .dsnet.hotstuff.proto.VoteMessage vote = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          ptr = ctx->ParseMessage(_internal_mutable_vote(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .dsnet.hotstuff.proto.Checkpoint checkpoint = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 42)) {
+          ptr = ctx->ParseMessage(_internal_mutable_checkpoint(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .dsnet.hotstuff.proto.StateRequest state_request = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 50)) {
+          ptr = ctx->ParseMessage(_internal_mutable_state_request(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .dsnet.hotstuff.proto.StateChunk state_chunk = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 58)) {
+          ptr = ctx->ParseMessage(_internal_mutable_state_chunk(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .dsnet.hotstuff.proto.NonceMessage nonce = 8;
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 66)) {
+          ptr = ctx->ParseMessage(_internal_mutable_nonce(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* Message::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:dsnet.hotstuff.proto.Message)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // .dsnet.Request request = 1;
+  if (_internal_has_request()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(1, _Internal::request(this),
+        _Internal::request(this).GetCachedSize(), target, stream);
+  }
+
+  // .dsnet.hotstuff.proto.ReplyMessage reply = 2;
+  if (_internal_has_reply()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(2, _Internal::reply(this),
+        _Internal::reply(this).GetCachedSize(), target, stream);
+  }
+
+  // .dsnet.hotstuff.proto.GenericMessage generic = 3;
+  if (_internal_has_generic()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(3, _Internal::generic(this),
+        _Internal::generic(this).GetCachedSize(), target, stream);
+  }
+
+  // .dsnet.hotstuff.proto.VoteMessage vote = 4;
+  if (_internal_has_vote()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(4, _Internal::vote(this),
+        _Internal::vote(this).GetCachedSize(), target, stream);
+  }
+
+  // .dsnet.hotstuff.proto.Checkpoint checkpoint = 5;
+  if (_internal_has_checkpoint()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(5, _Internal::checkpoint(this),
+        _Internal::checkpoint(this).GetCachedSize(), target, stream);
+  }
+
+  // .dsnet.hotstuff.proto.StateRequest state_request = 6;
+  if (_internal_has_state_request()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(6, _Internal::state_request(this),
+        _Internal::state_request(this).GetCachedSize(), target, stream);
+  }
+
+  // .dsnet.hotstuff.proto.StateChunk state_chunk = 7;
+  if (_internal_has_state_chunk()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(7, _Internal::state_chunk(this),
+        _Internal::state_chunk(this).GetCachedSize(), target, stream);
+  }
+
+  // .dsnet.hotstuff.proto.NonceMessage nonce = 8;
+  if (_internal_has_nonce()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(8, _Internal::nonce(this),
+        _Internal::nonce(this).GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:dsnet.hotstuff.proto.Message)
+  return target;
+}
+
+size_t Message::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:dsnet.hotstuff.proto.Message)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  switch (get_case()) {
+    // .dsnet.Request request = 1;
+    case kRequest: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.get_.request_);
+      break;
+    }
+    // .dsnet.hotstuff.proto.ReplyMessage reply = 2;
+    case kReply: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.get_.reply_);
+      break;
+    }
+    // .dsnet.hotstuff.proto.GenericMessage generic = 3;
+    case kGeneric: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.get_.generic_);
+      break;
+    }
+    // .dsnet.hotstuff.proto.VoteMessage vote = 4;
+    case kVote: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.get_.vote_);
+      break;
+    }
+    // .dsnet.hotstuff.proto.Checkpoint checkpoint = 5;
+    case kCheckpoint: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.get_.checkpoint_);
+      break;
+    }
+    // .dsnet.hotstuff.proto.StateRequest state_request = 6;
+    case kStateRequest: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.get_.state_request_);
+      break;
+    }
+    // .dsnet.hotstuff.proto.StateChunk state_chunk = 7;
+    case kStateChunk: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.get_.state_chunk_);
+      break;
+    }
+    // .dsnet.hotstuff.proto.NonceMessage nonce = 8;
+    case kNonce: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.get_.nonce_);
+      break;
+    }
+    case GET_NOT_SET: {
+      break;
+    }
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData Message::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    Message::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*Message::GetClassData() const { return &_class_data_; }
+
+
+void Message::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<Message*>(&to_msg);
+  auto& from = static_cast<const Message&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:dsnet.hotstuff.proto.Message)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  switch (from.get_case()) {
+    case kRequest: {
+      _this->_internal_mutable_request()->::dsnet::Request::MergeFrom(
+          from._internal_request());
+      break;
+    }
+    case kReply: {
+      _this->_internal_mutable_reply()->::dsnet::hotstuff::proto::ReplyMessage::MergeFrom(
+          from._internal_reply());
+      break;
+    }
+    case kGeneric: {
+      _this->_internal_mutable_generic()->::dsnet::hotstuff::proto::GenericMessage::MergeFrom(
+          from._internal_generic());
+      break;
+    }
+    case kVote: {
+      _this->_internal_mutable_vote()->::dsnet::hotstuff::proto::VoteMessage::MergeFrom(
+          from._internal_vote());
+      break;
+    }
+    case kCheckpoint: {
+      _this->_internal_mutable_checkpoint()->::dsnet::hotstuff::proto::Checkpoint::MergeFrom(
+          from._internal_checkpoint());
+      break;
+    }
+    case kStateRequest: {
+      _this->_internal_mutable_state_request()->::dsnet::hotstuff::proto::StateRequest::MergeFrom(
+          from._internal_state_request());
+      break;
+    }
+    case kStateChunk: {
+      _this->_internal_mutable_state_chunk()->::dsnet::hotstuff::proto::StateChunk::MergeFrom(
+          from._internal_state_chunk());
+      break;
+    }
+    case kNonce: {
+      _this->_internal_mutable_nonce()->::dsnet::hotstuff::proto::NonceMessage::MergeFrom(
+          from._internal_nonce());
+      break;
+    }
+    case GET_NOT_SET: {
+      break;
+    }
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void Message::CopyFrom(const Message& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:dsnet.hotstuff.proto.Message)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool Message::IsInitialized() const {
+  switch (get_case()) {
+    case kRequest: {
+      if (_internal_has_request()) {
+        if (!_impl_.get_.request_->IsInitialized()) return false;
+      }
+      break;
+    }
+    case kReply: {
+      break;
+    }
+    case kGeneric: {
+      if (_internal_has_generic()) {
+        if (!_impl_.get_.generic_->IsInitialized()) return false;
+      }
+      break;
+    }
+    case kVote: {
+      break;
+    }
+    case kCheckpoint: {
+      break;
+    }
+    case kStateRequest: {
+      break;
+    }
+    case kStateChunk: {
+      if (_internal_has_state_chunk()) {
+        if (!_impl_.get_.state_chunk_->IsInitialized()) return false;
+      }
+      break;
+    }
+    case kNonce: {
+      break;
+    }
+    case GET_NOT_SET: {
+      break;
+    }
+  }
+  return true;
+}
+
+void Message::InternalSwap(Message* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_.get_, other->_impl_.get_);
+  swap(_impl_._oneof_case_[0], other->_impl_._oneof_case_[0]);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata Message::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_replication_2fhotstuff_2fmessage_2eproto_getter, &descriptor_table_replication_2fhotstuff_2fmessage_2eproto_once,
+      file_level_metadata_replication_2fhotstuff_2fmessage_2eproto[0]);
+}
+
+// ===================================================================
+
+class ReplyMessage::_Internal {
+ public:
+};
+
+ReplyMessage::ReplyMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:dsnet.hotstuff.proto.ReplyMessage)
+}
+ReplyMessage::ReplyMessage(const ReplyMessage& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  ReplyMessage* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.result_){}
+    , decltype(_impl_.client_request_){}
+    , decltype(_impl_.replica_index_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.result_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.result_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_result().empty()) {
+    _this->_impl_.result_.Set(from._internal_result(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.client_request_, &from._impl_.client_request_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.replica_index_) -
+    reinterpret_cast<char*>(&_impl_.client_request_)) + sizeof(_impl_.replica_index_));
+  // @@protoc_insertion_point(copy_constructor:dsnet.hotstuff.proto.ReplyMessage)
+}
+
+inline void ReplyMessage::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.result_){}
+    , decltype(_impl_.client_request_){0u}
+    , decltype(_impl_.replica_index_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.result_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.result_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+ReplyMessage::~ReplyMessage() {
+  // @@protoc_insertion_point(destructor:dsnet.hotstuff.proto.ReplyMessage)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void ReplyMessage::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.result_.Destroy();
+}
+
+void ReplyMessage::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void ReplyMessage::Clear() {
+// @@protoc_insertion_point(message_clear_start:dsnet.hotstuff.proto.ReplyMessage)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.result_.ClearToEmpty();
+  ::memset(&_impl_.client_request_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.replica_index_) -
+      reinterpret_cast<char*>(&_impl_.client_request_)) + sizeof(_impl_.replica_index_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* ReplyMessage::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // uint32 client_request = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.client_request_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // bytes result = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_result();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int32 replica_index = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.replica_index_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* ReplyMessage::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:dsnet.hotstuff.proto.ReplyMessage)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // uint32 client_request = 1;
+  if (this->_internal_client_request() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(1, this->_internal_client_request(), target);
+  }
+
+  // bytes result = 2;
+  if (!this->_internal_result().empty()) {
+    target = stream->WriteBytesMaybeAliased(
+        2, this->_internal_result(), target);
+  }
+
+  // int32 replica_index = 3;
+  if (this->_internal_replica_index() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(3, this->_internal_replica_index(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:dsnet.hotstuff.proto.ReplyMessage)
+  return target;
+}
+
+size_t ReplyMessage::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:dsnet.hotstuff.proto.ReplyMessage)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // bytes result = 2;
+  if (!this->_internal_result().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_result());
+  }
+
+  // uint32 client_request = 1;
+  if (this->_internal_client_request() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_client_request());
+  }
+
+  // int32 replica_index = 3;
+  if (this->_internal_replica_index() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_replica_index());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ReplyMessage::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    ReplyMessage::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ReplyMessage::GetClassData() const { return &_class_data_; }
+
+
+void ReplyMessage::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<ReplyMessage*>(&to_msg);
+  auto& from = static_cast<const ReplyMessage&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:dsnet.hotstuff.proto.ReplyMessage)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_result().empty()) {
+    _this->_internal_set_result(from._internal_result());
+  }
+  if (from._internal_client_request() != 0) {
+    _this->_internal_set_client_request(from._internal_client_request());
+  }
+  if (from._internal_replica_index() != 0) {
+    _this->_internal_set_replica_index(from._internal_replica_index());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void ReplyMessage::CopyFrom(const ReplyMessage& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:dsnet.hotstuff.proto.ReplyMessage)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool ReplyMessage::IsInitialized() const {
+  return true;
+}
+
+void ReplyMessage::InternalSwap(ReplyMessage* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.result_, lhs_arena,
+      &other->_impl_.result_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(ReplyMessage, _impl_.replica_index_)
+      + sizeof(ReplyMessage::_impl_.replica_index_)
+      - PROTOBUF_FIELD_OFFSET(ReplyMessage, _impl_.client_request_)>(
+          reinterpret_cast<char*>(&_impl_.client_request_),
+          reinterpret_cast<char*>(&other->_impl_.client_request_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata ReplyMessage::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_replication_2fhotstuff_2fmessage_2eproto_getter, &descriptor_table_replication_2fhotstuff_2fmessage_2eproto_once,
+      file_level_metadata_replication_2fhotstuff_2fmessage_2eproto[1]);
+}
+
+// ===================================================================
+
+class GenericMessage::_Internal {
+ public:
+  static const ::dsnet::hotstuff::proto::Block& block(const GenericMessage* msg);
+};
+
+const ::dsnet::hotstuff::proto::Block&
+GenericMessage::_Internal::block(const GenericMessage* msg) {
+  return *msg->_impl_.block_;
+}
+GenericMessage::GenericMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:dsnet.hotstuff.proto.GenericMessage)
+}
+GenericMessage::GenericMessage(const GenericMessage& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  GenericMessage* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.block_){nullptr}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  if (from._internal_has_block()) {
+    _this->_impl_.block_ = new ::dsnet::hotstuff::proto::Block(*from._impl_.block_);
+  }
+  // @@protoc_insertion_point(copy_constructor:dsnet.hotstuff.proto.GenericMessage)
+}
+
+inline void GenericMessage::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.block_){nullptr}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+GenericMessage::~GenericMessage() {
+  // @@protoc_insertion_point(destructor:dsnet.hotstuff.proto.GenericMessage)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void GenericMessage::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  if (this != internal_default_instance()) delete _impl_.block_;
+}
+
+void GenericMessage::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void GenericMessage::Clear() {
+// @@protoc_insertion_point(message_clear_start:dsnet.hotstuff.proto.GenericMessage)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  if (GetArenaForAllocation() == nullptr && _impl_.block_ != nullptr) {
+    delete _impl_.block_;
+  }
+  _impl_.block_ = nullptr;
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* GenericMessage::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // .dsnet.hotstuff.proto.Block block = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr = ctx->ParseMessage(_internal_mutable_block(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* GenericMessage::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:dsnet.hotstuff.proto.GenericMessage)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // .dsnet.hotstuff.proto.Block block = 1;
+  if (this->_internal_has_block()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(1, _Internal::block(this),
+        _Internal::block(this).GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:dsnet.hotstuff.proto.GenericMessage)
+  return target;
+}
+
+size_t GenericMessage::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:dsnet.hotstuff.proto.GenericMessage)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // .dsnet.hotstuff.proto.Block block = 1;
+  if (this->_internal_has_block()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.block_);
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData GenericMessage::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    GenericMessage::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GenericMessage::GetClassData() const { return &_class_data_; }
+
+
+void GenericMessage::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<GenericMessage*>(&to_msg);
+  auto& from = static_cast<const GenericMessage&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:dsnet.hotstuff.proto.GenericMessage)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_has_block()) {
+    _this->_internal_mutable_block()->::dsnet::hotstuff::proto::Block::MergeFrom(
+        from._internal_block());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void GenericMessage::CopyFrom(const GenericMessage& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:dsnet.hotstuff.proto.GenericMessage)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool GenericMessage::IsInitialized() const {
+  if (_internal_has_block()) {
+    if (!_impl_.block_->IsInitialized()) return false;
+  }
+  return true;
+}
+
+void GenericMessage::InternalSwap(GenericMessage* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_.block_, other->_impl_.block_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata GenericMessage::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_replication_2fhotstuff_2fmessage_2eproto_getter, &descriptor_table_replication_2fhotstuff_2fmessage_2eproto_once,
+      file_level_metadata_replication_2fhotstuff_2fmessage_2eproto[2]);
+}
+
+// ===================================================================
+
+class VoteMessage::_Internal {
+ public:
+};
+
+VoteMessage::VoteMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:dsnet.hotstuff.proto.VoteMessage)
+}
+VoteMessage::VoteMessage(const VoteMessage& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  VoteMessage* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.partial_signature_){}
+    , decltype(_impl_.nonce_){}
+    , decltype(_impl_.op_number_){}
+    , decltype(_impl_.nonce_seq_){}
+    , decltype(_impl_.replica_index_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.partial_signature_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.partial_signature_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_partial_signature().empty()) {
+    _this->_impl_.partial_signature_.Set(from._internal_partial_signature(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.nonce_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.nonce_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_nonce().empty()) {
+    _this->_impl_.nonce_.Set(from._internal_nonce(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.op_number_, &from._impl_.op_number_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.replica_index_) -
+    reinterpret_cast<char*>(&_impl_.op_number_)) + sizeof(_impl_.replica_index_));
+  // @@protoc_insertion_point(copy_constructor:dsnet.hotstuff.proto.VoteMessage)
+}
+
+inline void VoteMessage::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.partial_signature_){}
+    , decltype(_impl_.nonce_){}
+    , decltype(_impl_.op_number_){uint64_t{0u}}
+    , decltype(_impl_.nonce_seq_){uint64_t{0u}}
+    , decltype(_impl_.replica_index_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.partial_signature_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.partial_signature_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.nonce_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.nonce_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+VoteMessage::~VoteMessage() {
+  // @@protoc_insertion_point(destructor:dsnet.hotstuff.proto.VoteMessage)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void VoteMessage::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.partial_signature_.Destroy();
+  _impl_.nonce_.Destroy();
+}
+
+void VoteMessage::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void VoteMessage::Clear() {
+// @@protoc_insertion_point(message_clear_start:dsnet.hotstuff.proto.VoteMessage)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.partial_signature_.ClearToEmpty();
+  _impl_.nonce_.ClearToEmpty();
+  ::memset(&_impl_.op_number_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.replica_index_) -
+      reinterpret_cast<char*>(&_impl_.op_number_)) + sizeof(_impl_.replica_index_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* VoteMessage::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // int32 replica_index = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.replica_index_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 op_number = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.op_number_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // bytes partial_signature = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          auto str = _internal_mutable_partial_signature();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 nonce_seq = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _impl_.nonce_seq_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // bytes nonce = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 42)) {
+          auto str = _internal_mutable_nonce();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* VoteMessage::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:dsnet.hotstuff.proto.VoteMessage)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // int32 replica_index = 1;
+  if (this->_internal_replica_index() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(1, this->_internal_replica_index(), target);
+  }
+
+  // uint64 op_number = 2;
+  if (this->_internal_op_number() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(2, this->_internal_op_number(), target);
+  }
+
+  // bytes partial_signature = 3;
+  if (!this->_internal_partial_signature().empty()) {
+    target = stream->WriteBytesMaybeAliased(
+        3, this->_internal_partial_signature(), target);
+  }
+
+  // uint64 nonce_seq = 4;
+  if (this->_internal_nonce_seq() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(4, this->_internal_nonce_seq(), target);
+  }
+
+  // bytes nonce = 5;
+  if (!this->_internal_nonce().empty()) {
+    target = stream->WriteBytesMaybeAliased(
+        5, this->_internal_nonce(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:dsnet.hotstuff.proto.VoteMessage)
+  return target;
+}
+
+size_t VoteMessage::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:dsnet.hotstuff.proto.VoteMessage)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // bytes partial_signature = 3;
+  if (!this->_internal_partial_signature().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_partial_signature());
+  }
+
+  // bytes nonce = 5;
+  if (!this->_internal_nonce().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_nonce());
+  }
+
+  // uint64 op_number = 2;
+  if (this->_internal_op_number() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_op_number());
+  }
+
+  // uint64 nonce_seq = 4;
+  if (this->_internal_nonce_seq() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_nonce_seq());
+  }
+
+  // int32 replica_index = 1;
+  if (this->_internal_replica_index() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_replica_index());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData VoteMessage::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    VoteMessage::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*VoteMessage::GetClassData() const { return &_class_data_; }
+
+
+void VoteMessage::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<VoteMessage*>(&to_msg);
+  auto& from = static_cast<const VoteMessage&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:dsnet.hotstuff.proto.VoteMessage)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_partial_signature().empty()) {
+    _this->_internal_set_partial_signature(from._internal_partial_signature());
+  }
+  if (!from._internal_nonce().empty()) {
+    _this->_internal_set_nonce(from._internal_nonce());
+  }
+  if (from._internal_op_number() != 0) {
+    _this->_internal_set_op_number(from._internal_op_number());
+  }
+  if (from._internal_nonce_seq() != 0) {
+    _this->_internal_set_nonce_seq(from._internal_nonce_seq());
+  }
+  if (from._internal_replica_index() != 0) {
+    _this->_internal_set_replica_index(from._internal_replica_index());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void VoteMessage::CopyFrom(const VoteMessage& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:dsnet.hotstuff.proto.VoteMessage)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool VoteMessage::IsInitialized() const {
+  return true;
+}
+
+void VoteMessage::InternalSwap(VoteMessage* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.partial_signature_, lhs_arena,
+      &other->_impl_.partial_signature_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.nonce_, lhs_arena,
+      &other->_impl_.nonce_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(VoteMessage, _impl_.replica_index_)
+      + sizeof(VoteMessage::_impl_.replica_index_)
+      - PROTOBUF_FIELD_OFFSET(VoteMessage, _impl_.op_number_)>(
+          reinterpret_cast<char*>(&_impl_.op_number_),
+          reinterpret_cast<char*>(&other->_impl_.op_number_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata VoteMessage::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_replication_2fhotstuff_2fmessage_2eproto_getter, &descriptor_table_replication_2fhotstuff_2fmessage_2eproto_once,
+      file_level_metadata_replication_2fhotstuff_2fmessage_2eproto[3]);
+}
+
+// ===================================================================
+
+class NonceMessage::_Internal {
+ public:
+};
+
+NonceMessage::NonceMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:dsnet.hotstuff.proto.NonceMessage)
+}
+NonceMessage::NonceMessage(const NonceMessage& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  NonceMessage* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.nonce_){from._impl_.nonce_}
+    , decltype(_impl_.nonce_seq_){}
+    , decltype(_impl_.replica_index_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.nonce_seq_, &from._impl_.nonce_seq_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.replica_index_) -
+    reinterpret_cast<char*>(&_impl_.nonce_seq_)) + sizeof(_impl_.replica_index_));
+  // @@protoc_insertion_point(copy_constructor:dsnet.hotstuff.proto.NonceMessage)
+}
+
+inline void NonceMessage::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.nonce_){arena}
+    , decltype(_impl_.nonce_seq_){uint64_t{0u}}
+    , decltype(_impl_.replica_index_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+NonceMessage::~NonceMessage() {
+  // @@protoc_insertion_point(destructor:dsnet.hotstuff.proto.NonceMessage)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void NonceMessage::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.nonce_.~RepeatedPtrField();
+}
+
+void NonceMessage::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void NonceMessage::Clear() {
+// @@protoc_insertion_point(message_clear_start:dsnet.hotstuff.proto.NonceMessage)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.nonce_.Clear();
+  ::memset(&_impl_.nonce_seq_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.replica_index_) -
+      reinterpret_cast<char*>(&_impl_.nonce_seq_)) + sizeof(_impl_.replica_index_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* NonceMessage::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // int32 replica_index = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.replica_index_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 nonce_seq = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.nonce_seq_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated bytes nonce = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            auto str = _internal_add_nonce();
+            ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<26>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* NonceMessage::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:dsnet.hotstuff.proto.NonceMessage)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // int32 replica_index = 1;
+  if (this->_internal_replica_index() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(1, this->_internal_replica_index(), target);
+  }
+
+  // uint64 nonce_seq = 2;
+  if (this->_internal_nonce_seq() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(2, this->_internal_nonce_seq(), target);
+  }
+
+  // repeated bytes nonce = 3;
+  for (int i = 0, n = this->_internal_nonce_size(); i < n; i++) {
+    const auto& s = this->_internal_nonce(i);
+    target = stream->WriteBytes(3, s, target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:dsnet.hotstuff.proto.NonceMessage)
+  return target;
+}
+
+size_t NonceMessage::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:dsnet.hotstuff.proto.NonceMessage)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated bytes nonce = 3;
+  total_size += 1 *
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(_impl_.nonce_.size());
+  for (int i = 0, n = _impl_.nonce_.size(); i < n; i++) {
+    total_size += ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+      _impl_.nonce_.Get(i));
+  }
+
+  // uint64 nonce_seq = 2;
+  if (this->_internal_nonce_seq() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_nonce_seq());
+  }
+
+  // int32 replica_index = 1;
+  if (this->_internal_replica_index() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_replica_index());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData NonceMessage::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    NonceMessage::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*NonceMessage::GetClassData() const { return &_class_data_; }
+
+
+void NonceMessage::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<NonceMessage*>(&to_msg);
+  auto& from = static_cast<const NonceMessage&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:dsnet.hotstuff.proto.NonceMessage)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.nonce_.MergeFrom(from._impl_.nonce_);
+  if (from._internal_nonce_seq() != 0) {
+    _this->_internal_set_nonce_seq(from._internal_nonce_seq());
+  }
+  if (from._internal_replica_index() != 0) {
+    _this->_internal_set_replica_index(from._internal_replica_index());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void NonceMessage::CopyFrom(const NonceMessage& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:dsnet.hotstuff.proto.NonceMessage)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool NonceMessage::IsInitialized() const {
+  return true;
+}
+
+void NonceMessage::InternalSwap(NonceMessage* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.nonce_.InternalSwap(&other->_impl_.nonce_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(NonceMessage, _impl_.replica_index_)
+      + sizeof(NonceMessage::_impl_.replica_index_)
+      - PROTOBUF_FIELD_OFFSET(NonceMessage, _impl_.nonce_seq_)>(
+          reinterpret_cast<char*>(&_impl_.nonce_seq_),
+          reinterpret_cast<char*>(&other->_impl_.nonce_seq_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata NonceMessage::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_replication_2fhotstuff_2fmessage_2eproto_getter, &descriptor_table_replication_2fhotstuff_2fmessage_2eproto_once,
+      file_level_metadata_replication_2fhotstuff_2fmessage_2eproto[4]);
+}
+
+// ===================================================================
+
+class Block::_Internal {
+ public:
+  static const ::dsnet::hotstuff::proto::QC& justify(const Block* msg);
+};
+
+const ::dsnet::hotstuff::proto::QC&
+Block::_Internal::justify(const Block* msg) {
+  return *msg->_impl_.justify_;
+}
+void Block::clear_request() {
+  _impl_.request_.Clear();
+}
+Block::Block(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:dsnet.hotstuff.proto.Block)
+}
+Block::Block(const Block& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  Block* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.request_){from._impl_.request_}
+    , decltype(_impl_.nonce_seq_){from._impl_.nonce_seq_}
+    , /*decltype(_impl_._nonce_seq_cached_byte_size_)*/{0}
+    , decltype(_impl_.aggregate_nonce_){}
+    , decltype(_impl_.justify_){nullptr}
+    , decltype(_impl_.op_number_){}
+    , decltype(_impl_.signers_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.aggregate_nonce_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.aggregate_nonce_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_aggregate_nonce().empty()) {
+    _this->_impl_.aggregate_nonce_.Set(from._internal_aggregate_nonce(), 
+      _this->GetArenaForAllocation());
+  }
+  if (from._internal_has_justify()) {
+    _this->_impl_.justify_ = new ::dsnet::hotstuff::proto::QC(*from._impl_.justify_);
+  }
+  ::memcpy(&_impl_.op_number_, &from._impl_.op_number_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.signers_) -
+    reinterpret_cast<char*>(&_impl_.op_number_)) + sizeof(_impl_.signers_));
+  // @@protoc_insertion_point(copy_constructor:dsnet.hotstuff.proto.Block)
+}
+
+inline void Block::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.request_){arena}
+    , decltype(_impl_.nonce_seq_){arena}
+    , /*decltype(_impl_._nonce_seq_cached_byte_size_)*/{0}
+    , decltype(_impl_.aggregate_nonce_){}
+    , decltype(_impl_.justify_){nullptr}
+    , decltype(_impl_.op_number_){uint64_t{0u}}
+    , decltype(_impl_.signers_){uint64_t{0u}}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.aggregate_nonce_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.aggregate_nonce_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+Block::~Block() {
+  // @@protoc_insertion_point(destructor:dsnet.hotstuff.proto.Block)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void Block::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.request_.~RepeatedPtrField();
+  _impl_.nonce_seq_.~RepeatedField();
+  _impl_.aggregate_nonce_.Destroy();
+  if (this != internal_default_instance()) delete _impl_.justify_;
+}
+
+void Block::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void Block::Clear() {
+// @@protoc_insertion_point(message_clear_start:dsnet.hotstuff.proto.Block)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.request_.Clear();
+  _impl_.nonce_seq_.Clear();
+  _impl_.aggregate_nonce_.ClearToEmpty();
+  if (GetArenaForAllocation() == nullptr && _impl_.justify_ != nullptr) {
+    delete _impl_.justify_;
+  }
+  _impl_.justify_ = nullptr;
+  ::memset(&_impl_.op_number_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.signers_) -
+      reinterpret_cast<char*>(&_impl_.op_number_)) + sizeof(_impl_.signers_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* Block::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // uint64 op_number = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.op_number_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .dsnet.Request request = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_request(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<18>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // .dsnet.hotstuff.proto.QC justify = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          ptr = ctx->ParseMessage(_internal_mutable_justify(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 signers = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _impl_.signers_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated uint64 nonce_seq = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 42)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedUInt64Parser(_internal_mutable_nonce_seq(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<uint8_t>(tag) == 40) {
+          _internal_add_nonce_seq(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr));
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // bytes aggregate_nonce = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 50)) {
+          auto str = _internal_mutable_aggregate_nonce();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* Block::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:dsnet.hotstuff.proto.Block)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // uint64 op_number = 1;
+  if (this->_internal_op_number() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(1, this->_internal_op_number(), target);
+  }
+
+  // repeated .dsnet.Request request = 2;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_request_size()); i < n; i++) {
+    const auto& repfield = this->_internal_request(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(2, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  // .dsnet.hotstuff.proto.QC justify = 3;
+  if (this->_internal_has_justify()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(3, _Internal::justify(this),
+        _Internal::justify(this).GetCachedSize(), target, stream);
+  }
+
+  // uint64 signers = 4;
+  if (this->_internal_signers() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(4, this->_internal_signers(), target);
+  }
+
+  // repeated uint64 nonce_seq = 5;
+  {
+    int byte_size = _impl_._nonce_seq_cached_byte_size_.load(std::memory_order_relaxed);
+    if (byte_size > 0) {
+      target = stream->WriteUInt64Packed(
+          5, _internal_nonce_seq(), byte_size, target);
+    }
+  }
+
+  // bytes aggregate_nonce = 6;
+  if (!this->_internal_aggregate_nonce().empty()) {
+    target = stream->WriteBytesMaybeAliased(
+        6, this->_internal_aggregate_nonce(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:dsnet.hotstuff.proto.Block)
+  return target;
+}
+
+size_t Block::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:dsnet.hotstuff.proto.Block)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .dsnet.Request request = 2;
+  total_size += 1UL * this->_internal_request_size();
+  for (const auto& msg : this->_impl_.request_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // repeated uint64 nonce_seq = 5;
+  {
+    size_t data_size = ::_pbi::WireFormatLite::
+      UInt64Size(this->_impl_.nonce_seq_);
+    if (data_size > 0) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::Int32Size(static_cast<int32_t>(data_size));
+    }
+    int cached_size = ::_pbi::ToCachedSize(data_size);
+    _impl_._nonce_seq_cached_byte_size_.store(cached_size,
+                                    std::memory_order_relaxed);
+    total_size += data_size;
+  }
+
+  // bytes aggregate_nonce = 6;
+  if (!this->_internal_aggregate_nonce().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_aggregate_nonce());
+  }
+
+  // .dsnet.hotstuff.proto.QC justify = 3;
+  if (this->_internal_has_justify()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.justify_);
+  }
+
+  // uint64 op_number = 1;
+  if (this->_internal_op_number() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_op_number());
+  }
+
+  // uint64 signers = 4;
+  if (this->_internal_signers() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_signers());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData Block::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    Block::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*Block::GetClassData() const { return &_class_data_; }
+
+
+void Block::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<Block*>(&to_msg);
+  auto& from = static_cast<const Block&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:dsnet.hotstuff.proto.Block)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.request_.MergeFrom(from._impl_.request_);
+  _this->_impl_.nonce_seq_.MergeFrom(from._impl_.nonce_seq_);
+  if (!from._internal_aggregate_nonce().empty()) {
+    _this->_internal_set_aggregate_nonce(from._internal_aggregate_nonce());
+  }
+  if (from._internal_has_justify()) {
+    _this->_internal_mutable_justify()->::dsnet::hotstuff::proto::QC::MergeFrom(
+        from._internal_justify());
+  }
+  if (from._internal_op_number() != 0) {
+    _this->_internal_set_op_number(from._internal_op_number());
+  }
+  if (from._internal_signers() != 0) {
+    _this->_internal_set_signers(from._internal_signers());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void Block::CopyFrom(const Block& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:dsnet.hotstuff.proto.Block)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool Block::IsInitialized() const {
+  if (!::PROTOBUF_NAMESPACE_ID::internal::AllAreInitialized(_impl_.request_))
+    return false;
+  return true;
+}
+
+void Block::InternalSwap(Block* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.request_.InternalSwap(&other->_impl_.request_);
+  _impl_.nonce_seq_.InternalSwap(&other->_impl_.nonce_seq_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.aggregate_nonce_, lhs_arena,
+      &other->_impl_.aggregate_nonce_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(Block, _impl_.signers_)
+      + sizeof(Block::_impl_.signers_)
+      - PROTOBUF_FIELD_OFFSET(Block, _impl_.justify_)>(
+          reinterpret_cast<char*>(&_impl_.justify_),
+          reinterpret_cast<char*>(&other->_impl_.justify_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata Block::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_replication_2fhotstuff_2fmessage_2eproto_getter, &descriptor_table_replication_2fhotstuff_2fmessage_2eproto_once,
+      file_level_metadata_replication_2fhotstuff_2fmessage_2eproto[5]);
+}
+
+// ===================================================================
+
+class QC::_Internal {
+ public:
+};
+
+QC::QC(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:dsnet.hotstuff.proto.QC)
+}
+QC::QC(const QC& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  QC* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.signed_vote_){from._impl_.signed_vote_}
+    , decltype(_impl_.aggregate_signature_){}
+    , decltype(_impl_.op_number_){}
+    , decltype(_impl_.signers_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.aggregate_signature_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.aggregate_signature_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_aggregate_signature().empty()) {
+    _this->_impl_.aggregate_signature_.Set(from._internal_aggregate_signature(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.op_number_, &from._impl_.op_number_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.signers_) -
+    reinterpret_cast<char*>(&_impl_.op_number_)) + sizeof(_impl_.signers_));
+  // @@protoc_insertion_point(copy_constructor:dsnet.hotstuff.proto.QC)
+}
+
+inline void QC::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.signed_vote_){arena}
+    , decltype(_impl_.aggregate_signature_){}
+    , decltype(_impl_.op_number_){uint64_t{0u}}
+    , decltype(_impl_.signers_){uint64_t{0u}}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.aggregate_signature_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.aggregate_signature_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+QC::~QC() {
+  // @@protoc_insertion_point(destructor:dsnet.hotstuff.proto.QC)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void QC::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.signed_vote_.~RepeatedPtrField();
+  _impl_.aggregate_signature_.Destroy();
+}
+
+void QC::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void QC::Clear() {
+// @@protoc_insertion_point(message_clear_start:dsnet.hotstuff.proto.QC)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.signed_vote_.Clear();
+  _impl_.aggregate_signature_.ClearToEmpty();
+  ::memset(&_impl_.op_number_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.signers_) -
+      reinterpret_cast<char*>(&_impl_.op_number_)) + sizeof(_impl_.signers_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* QC::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // uint64 op_number = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.op_number_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated bytes signed_vote = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            auto str = _internal_add_signed_vote();
+            ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<18>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 signers = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.signers_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // bytes aggregate_signature = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          auto str = _internal_mutable_aggregate_signature();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* QC::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:dsnet.hotstuff.proto.QC)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // uint64 op_number = 1;
+  if (this->_internal_op_number() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(1, this->_internal_op_number(), target);
+  }
+
+  // repeated bytes signed_vote = 2;
+  for (int i = 0, n = this->_internal_signed_vote_size(); i < n; i++) {
+    const auto& s = this->_internal_signed_vote(i);
+    target = stream->WriteBytes(2, s, target);
+  }
+
+  // uint64 signers = 3;
+  if (this->_internal_signers() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(3, this->_internal_signers(), target);
+  }
+
+  // bytes aggregate_signature = 4;
+  if (!this->_internal_aggregate_signature().empty()) {
+    target = stream->WriteBytesMaybeAliased(
+        4, this->_internal_aggregate_signature(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:dsnet.hotstuff.proto.QC)
+  return target;
+}
+
+size_t QC::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:dsnet.hotstuff.proto.QC)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated bytes signed_vote = 2;
+  total_size += 1 *
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(_impl_.signed_vote_.size());
+  for (int i = 0, n = _impl_.signed_vote_.size(); i < n; i++) {
+    total_size += ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+      _impl_.signed_vote_.Get(i));
+  }
+
+  // bytes aggregate_signature = 4;
+  if (!this->_internal_aggregate_signature().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_aggregate_signature());
+  }
+
+  // uint64 op_number = 1;
+  if (this->_internal_op_number() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_op_number());
+  }
+
+  // uint64 signers = 3;
+  if (this->_internal_signers() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_signers());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData QC::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    QC::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*QC::GetClassData() const { return &_class_data_; }
+
+
+void QC::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<QC*>(&to_msg);
+  auto& from = static_cast<const QC&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:dsnet.hotstuff.proto.QC)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.signed_vote_.MergeFrom(from._impl_.signed_vote_);
+  if (!from._internal_aggregate_signature().empty()) {
+    _this->_internal_set_aggregate_signature(from._internal_aggregate_signature());
+  }
+  if (from._internal_op_number() != 0) {
+    _this->_internal_set_op_number(from._internal_op_number());
+  }
+  if (from._internal_signers() != 0) {
+    _this->_internal_set_signers(from._internal_signers());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void QC::CopyFrom(const QC& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:dsnet.hotstuff.proto.QC)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool QC::IsInitialized() const {
+  return true;
+}
+
+void QC::InternalSwap(QC* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.signed_vote_.InternalSwap(&other->_impl_.signed_vote_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.aggregate_signature_, lhs_arena,
+      &other->_impl_.aggregate_signature_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(QC, _impl_.signers_)
+      + sizeof(QC::_impl_.signers_)
+      - PROTOBUF_FIELD_OFFSET(QC, _impl_.op_number_)>(
+          reinterpret_cast<char*>(&_impl_.op_number_),
+          reinterpret_cast<char*>(&other->_impl_.op_number_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata QC::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_replication_2fhotstuff_2fmessage_2eproto_getter, &descriptor_table_replication_2fhotstuff_2fmessage_2eproto_once,
+      file_level_metadata_replication_2fhotstuff_2fmessage_2eproto[6]);
+}
+
+// ===================================================================
+
+class Checkpoint::_Internal {
+ public:
+};
+
+Checkpoint::Checkpoint(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:dsnet.hotstuff.proto.Checkpoint)
+}
+Checkpoint::Checkpoint(const Checkpoint& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  Checkpoint* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.digest_){}
+    , decltype(_impl_.op_number_){}
+    , decltype(_impl_.replica_index_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.digest_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.digest_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_digest().empty()) {
+    _this->_impl_.digest_.Set(from._internal_digest(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.op_number_, &from._impl_.op_number_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.replica_index_) -
+    reinterpret_cast<char*>(&_impl_.op_number_)) + sizeof(_impl_.replica_index_));
+  // @@protoc_insertion_point(copy_constructor:dsnet.hotstuff.proto.Checkpoint)
+}
+
+inline void Checkpoint::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.digest_){}
+    , decltype(_impl_.op_number_){uint64_t{0u}}
+    , decltype(_impl_.replica_index_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.digest_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.digest_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+Checkpoint::~Checkpoint() {
+  // @@protoc_insertion_point(destructor:dsnet.hotstuff.proto.Checkpoint)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void Checkpoint::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.digest_.Destroy();
+}
+
+void Checkpoint::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void Checkpoint::Clear() {
+// @@protoc_insertion_point(message_clear_start:dsnet.hotstuff.proto.Checkpoint)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.digest_.ClearToEmpty();
+  ::memset(&_impl_.op_number_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.replica_index_) -
+      reinterpret_cast<char*>(&_impl_.op_number_)) + sizeof(_impl_.replica_index_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* Checkpoint::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // uint64 op_number = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.op_number_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int32 replica_index = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.replica_index_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // bytes digest = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          auto str = _internal_mutable_digest();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* Checkpoint::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:dsnet.hotstuff.proto.Checkpoint)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // uint64 op_number = 1;
+  if (this->_internal_op_number() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(1, this->_internal_op_number(), target);
+  }
+
+  // int32 replica_index = 2;
+  if (this->_internal_replica_index() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(2, this->_internal_replica_index(), target);
+  }
+
+  // bytes digest = 3;
+  if (!this->_internal_digest().empty()) {
+    target = stream->WriteBytesMaybeAliased(
+        3, this->_internal_digest(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:dsnet.hotstuff.proto.Checkpoint)
+  return target;
+}
+
+size_t Checkpoint::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:dsnet.hotstuff.proto.Checkpoint)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // bytes digest = 3;
+  if (!this->_internal_digest().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_digest());
+  }
+
+  // uint64 op_number = 1;
+  if (this->_internal_op_number() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_op_number());
+  }
+
+  // int32 replica_index = 2;
+  if (this->_internal_replica_index() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_replica_index());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData Checkpoint::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    Checkpoint::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*Checkpoint::GetClassData() const { return &_class_data_; }
+
+
+void Checkpoint::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<Checkpoint*>(&to_msg);
+  auto& from = static_cast<const Checkpoint&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:dsnet.hotstuff.proto.Checkpoint)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_digest().empty()) {
+    _this->_internal_set_digest(from._internal_digest());
+  }
+  if (from._internal_op_number() != 0) {
+    _this->_internal_set_op_number(from._internal_op_number());
+  }
+  if (from._internal_replica_index() != 0) {
+    _this->_internal_set_replica_index(from._internal_replica_index());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void Checkpoint::CopyFrom(const Checkpoint& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:dsnet.hotstuff.proto.Checkpoint)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool Checkpoint::IsInitialized() const {
+  return true;
+}
+
+void Checkpoint::InternalSwap(Checkpoint* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.digest_, lhs_arena,
+      &other->_impl_.digest_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(Checkpoint, _impl_.replica_index_)
+      + sizeof(Checkpoint::_impl_.replica_index_)
+      - PROTOBUF_FIELD_OFFSET(Checkpoint, _impl_.op_number_)>(
+          reinterpret_cast<char*>(&_impl_.op_number_),
+          reinterpret_cast<char*>(&other->_impl_.op_number_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata Checkpoint::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_replication_2fhotstuff_2fmessage_2eproto_getter, &descriptor_table_replication_2fhotstuff_2fmessage_2eproto_once,
+      file_level_metadata_replication_2fhotstuff_2fmessage_2eproto[7]);
+}
+
+// ===================================================================
+
+class StateRequest::_Internal {
+ public:
+};
+
+StateRequest::StateRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:dsnet.hotstuff.proto.StateRequest)
+}
+StateRequest::StateRequest(const StateRequest& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  StateRequest* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.op_number_){}
+    , decltype(_impl_.last_op_number_){}
+    , decltype(_impl_.replica_index_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.op_number_, &from._impl_.op_number_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.replica_index_) -
+    reinterpret_cast<char*>(&_impl_.op_number_)) + sizeof(_impl_.replica_index_));
+  // @@protoc_insertion_point(copy_constructor:dsnet.hotstuff.proto.StateRequest)
+}
+
+inline void StateRequest::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.op_number_){uint64_t{0u}}
+    , decltype(_impl_.last_op_number_){uint64_t{0u}}
+    , decltype(_impl_.replica_index_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+StateRequest::~StateRequest() {
+  // @@protoc_insertion_point(destructor:dsnet.hotstuff.proto.StateRequest)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void StateRequest::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void StateRequest::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void StateRequest::Clear() {
+// @@protoc_insertion_point(message_clear_start:dsnet.hotstuff.proto.StateRequest)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  ::memset(&_impl_.op_number_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.replica_index_) -
+      reinterpret_cast<char*>(&_impl_.op_number_)) + sizeof(_impl_.replica_index_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* StateRequest::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // uint64 op_number = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.op_number_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 last_op_number = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.last_op_number_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int32 replica_index = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.replica_index_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* StateRequest::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:dsnet.hotstuff.proto.StateRequest)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // uint64 op_number = 1;
+  if (this->_internal_op_number() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(1, this->_internal_op_number(), target);
+  }
+
+  // uint64 last_op_number = 2;
+  if (this->_internal_last_op_number() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(2, this->_internal_last_op_number(), target);
+  }
+
+  // int32 replica_index = 3;
+  if (this->_internal_replica_index() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(3, this->_internal_replica_index(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:dsnet.hotstuff.proto.StateRequest)
+  return target;
+}
+
+size_t StateRequest::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:dsnet.hotstuff.proto.StateRequest)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // uint64 op_number = 1;
+  if (this->_internal_op_number() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_op_number());
+  }
+
+  // uint64 last_op_number = 2;
+  if (this->_internal_last_op_number() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_last_op_number());
+  }
+
+  // int32 replica_index = 3;
+  if (this->_internal_replica_index() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_replica_index());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData StateRequest::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    StateRequest::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*StateRequest::GetClassData() const { return &_class_data_; }
+
+
+void StateRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<StateRequest*>(&to_msg);
+  auto& from = static_cast<const StateRequest&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:dsnet.hotstuff.proto.StateRequest)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_op_number() != 0) {
+    _this->_internal_set_op_number(from._internal_op_number());
+  }
+  if (from._internal_last_op_number() != 0) {
+    _this->_internal_set_last_op_number(from._internal_last_op_number());
+  }
+  if (from._internal_replica_index() != 0) {
+    _this->_internal_set_replica_index(from._internal_replica_index());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void StateRequest::CopyFrom(const StateRequest& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:dsnet.hotstuff.proto.StateRequest)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool StateRequest::IsInitialized() const {
+  return true;
+}
+
+void StateRequest::InternalSwap(StateRequest* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(StateRequest, _impl_.replica_index_)
+      + sizeof(StateRequest::_impl_.replica_index_)
+      - PROTOBUF_FIELD_OFFSET(StateRequest, _impl_.op_number_)>(
+          reinterpret_cast<char*>(&_impl_.op_number_),
+          reinterpret_cast<char*>(&other->_impl_.op_number_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata StateRequest::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_replication_2fhotstuff_2fmessage_2eproto_getter, &descriptor_table_replication_2fhotstuff_2fmessage_2eproto_once,
+      file_level_metadata_replication_2fhotstuff_2fmessage_2eproto[8]);
+}
+
+// ===================================================================
+
+class StateChunk::_Internal {
+ public:
+  static const ::dsnet::hotstuff::proto::StableCheckpoint& checkpoint(const StateChunk* msg);
+};
+
+const ::dsnet::hotstuff::proto::StableCheckpoint&
+StateChunk::_Internal::checkpoint(const StateChunk* msg) {
+  return *msg->_impl_.checkpoint_;
+}
+StateChunk::StateChunk(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:dsnet.hotstuff.proto.StateChunk)
+}
+StateChunk::StateChunk(const StateChunk& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  StateChunk* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.entry_){from._impl_.entry_}
+    , decltype(_impl_.checkpoint_){nullptr}
+    , decltype(_impl_.op_number_){}
+    , decltype(_impl_.replica_index_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  if (from._internal_has_checkpoint()) {
+    _this->_impl_.checkpoint_ = new ::dsnet::hotstuff::proto::StableCheckpoint(*from._impl_.checkpoint_);
+  }
+  ::memcpy(&_impl_.op_number_, &from._impl_.op_number_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.replica_index_) -
+    reinterpret_cast<char*>(&_impl_.op_number_)) + sizeof(_impl_.replica_index_));
+  // @@protoc_insertion_point(copy_constructor:dsnet.hotstuff.proto.StateChunk)
+}
+
+inline void StateChunk::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.entry_){arena}
+    , decltype(_impl_.checkpoint_){nullptr}
+    , decltype(_impl_.op_number_){uint64_t{0u}}
+    , decltype(_impl_.replica_index_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+StateChunk::~StateChunk() {
+  // @@protoc_insertion_point(destructor:dsnet.hotstuff.proto.StateChunk)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void StateChunk::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.entry_.~RepeatedPtrField();
+  if (this != internal_default_instance()) delete _impl_.checkpoint_;
+}
+
+void StateChunk::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void StateChunk::Clear() {
+// @@protoc_insertion_point(message_clear_start:dsnet.hotstuff.proto.StateChunk)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.entry_.Clear();
+  if (GetArenaForAllocation() == nullptr && _impl_.checkpoint_ != nullptr) {
+    delete _impl_.checkpoint_;
+  }
+  _impl_.checkpoint_ = nullptr;
+  ::memset(&_impl_.op_number_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.replica_index_) -
+      reinterpret_cast<char*>(&_impl_.op_number_)) + sizeof(_impl_.replica_index_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* StateChunk::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // uint64 op_number = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.op_number_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .dsnet.hotstuff.proto.StateEntry entry = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_entry(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<18>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // .dsnet.hotstuff.proto.StableCheckpoint checkpoint = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          ptr = ctx->ParseMessage(_internal_mutable_checkpoint(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int32 replica_index = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _impl_.replica_index_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* StateChunk::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:dsnet.hotstuff.proto.StateChunk)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // uint64 op_number = 1;
+  if (this->_internal_op_number() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(1, this->_internal_op_number(), target);
+  }
+
+  // repeated .dsnet.hotstuff.proto.StateEntry entry = 2;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_entry_size()); i < n; i++) {
+    const auto& repfield = this->_internal_entry(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(2, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  // .dsnet.hotstuff.proto.StableCheckpoint checkpoint = 3;
+  if (this->_internal_has_checkpoint()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(3, _Internal::checkpoint(this),
+        _Internal::checkpoint(this).GetCachedSize(), target, stream);
+  }
+
+  // int32 replica_index = 4;
+  if (this->_internal_replica_index() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(4, this->_internal_replica_index(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:dsnet.hotstuff.proto.StateChunk)
+  return target;
+}
+
+size_t StateChunk::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:dsnet.hotstuff.proto.StateChunk)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .dsnet.hotstuff.proto.StateEntry entry = 2;
+  total_size += 1UL * this->_internal_entry_size();
+  for (const auto& msg : this->_impl_.entry_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // .dsnet.hotstuff.proto.StableCheckpoint checkpoint = 3;
+  if (this->_internal_has_checkpoint()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.checkpoint_);
+  }
+
+  // uint64 op_number = 1;
+  if (this->_internal_op_number() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_op_number());
+  }
+
+  // int32 replica_index = 4;
+  if (this->_internal_replica_index() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_replica_index());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData StateChunk::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    StateChunk::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*StateChunk::GetClassData() const { return &_class_data_; }
+
+
+void StateChunk::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<StateChunk*>(&to_msg);
+  auto& from = static_cast<const StateChunk&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:dsnet.hotstuff.proto.StateChunk)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.entry_.MergeFrom(from._impl_.entry_);
+  if (from._internal_has_checkpoint()) {
+    _this->_internal_mutable_checkpoint()->::dsnet::hotstuff::proto::StableCheckpoint::MergeFrom(
+        from._internal_checkpoint());
+  }
+  if (from._internal_op_number() != 0) {
+    _this->_internal_set_op_number(from._internal_op_number());
+  }
+  if (from._internal_replica_index() != 0) {
+    _this->_internal_set_replica_index(from._internal_replica_index());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void StateChunk::CopyFrom(const StateChunk& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:dsnet.hotstuff.proto.StateChunk)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool StateChunk::IsInitialized() const {
+  if (!::PROTOBUF_NAMESPACE_ID::internal::AllAreInitialized(_impl_.entry_))
+    return false;
+  return true;
+}
+
+void StateChunk::InternalSwap(StateChunk* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.entry_.InternalSwap(&other->_impl_.entry_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(StateChunk, _impl_.replica_index_)
+      + sizeof(StateChunk::_impl_.replica_index_)
+      - PROTOBUF_FIELD_OFFSET(StateChunk, _impl_.checkpoint_)>(
+          reinterpret_cast<char*>(&_impl_.checkpoint_),
+          reinterpret_cast<char*>(&other->_impl_.checkpoint_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata StateChunk::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_replication_2fhotstuff_2fmessage_2eproto_getter, &descriptor_table_replication_2fhotstuff_2fmessage_2eproto_once,
+      file_level_metadata_replication_2fhotstuff_2fmessage_2eproto[9]);
+}
+
+// ===================================================================
+
+class StateEntry::_Internal {
+ public:
+  static const ::dsnet::Request& request(const StateEntry* msg);
+};
+
+const ::dsnet::Request&
+StateEntry::_Internal::request(const StateEntry* msg) {
+  return *msg->_impl_.request_;
+}
+void StateEntry::clear_request() {
+  if (GetArenaForAllocation() == nullptr && _impl_.request_ != nullptr) {
+    delete _impl_.request_;
+  }
+  _impl_.request_ = nullptr;
+}
+StateEntry::StateEntry(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:dsnet.hotstuff.proto.StateEntry)
+}
+StateEntry::StateEntry(const StateEntry& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  StateEntry* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.request_){nullptr}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  if (from._internal_has_request()) {
+    _this->_impl_.request_ = new ::dsnet::Request(*from._impl_.request_);
+  }
+  // @@protoc_insertion_point(copy_constructor:dsnet.hotstuff.proto.StateEntry)
+}
+
+inline void StateEntry::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.request_){nullptr}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+StateEntry::~StateEntry() {
+  // @@protoc_insertion_point(destructor:dsnet.hotstuff.proto.StateEntry)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void StateEntry::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  if (this != internal_default_instance()) delete _impl_.request_;
+}
+
+void StateEntry::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void StateEntry::Clear() {
+// @@protoc_insertion_point(message_clear_start:dsnet.hotstuff.proto.StateEntry)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  if (GetArenaForAllocation() == nullptr && _impl_.request_ != nullptr) {
+    delete _impl_.request_;
+  }
+  _impl_.request_ = nullptr;
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* StateEntry::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // .dsnet.Request request = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr = ctx->ParseMessage(_internal_mutable_request(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* StateEntry::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:dsnet.hotstuff.proto.StateEntry)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // .dsnet.Request request = 1;
+  if (this->_internal_has_request()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(1, _Internal::request(this),
+        _Internal::request(this).GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:dsnet.hotstuff.proto.StateEntry)
+  return target;
+}
+
+size_t StateEntry::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:dsnet.hotstuff.proto.StateEntry)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // .dsnet.Request request = 1;
+  if (this->_internal_has_request()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.request_);
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData StateEntry::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    StateEntry::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*StateEntry::GetClassData() const { return &_class_data_; }
+
+
+void StateEntry::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<StateEntry*>(&to_msg);
+  auto& from = static_cast<const StateEntry&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:dsnet.hotstuff.proto.StateEntry)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_has_request()) {
+    _this->_internal_mutable_request()->::dsnet::Request::MergeFrom(
+        from._internal_request());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void StateEntry::CopyFrom(const StateEntry& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:dsnet.hotstuff.proto.StateEntry)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool StateEntry::IsInitialized() const {
+  if (_internal_has_request()) {
+    if (!_impl_.request_->IsInitialized()) return false;
+  }
+  return true;
+}
+
+void StateEntry::InternalSwap(StateEntry* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_.request_, other->_impl_.request_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata StateEntry::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_replication_2fhotstuff_2fmessage_2eproto_getter, &descriptor_table_replication_2fhotstuff_2fmessage_2eproto_once,
+      file_level_metadata_replication_2fhotstuff_2fmessage_2eproto[10]);
+}
+
+// ===================================================================
+
+class StableCheckpoint::_Internal {
+ public:
+};
+
+StableCheckpoint::StableCheckpoint(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:dsnet.hotstuff.proto.StableCheckpoint)
+}
+StableCheckpoint::StableCheckpoint(const StableCheckpoint& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  StableCheckpoint* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.signed_checkpoint_){from._impl_.signed_checkpoint_}
+    , decltype(_impl_.app_state_){}
+    , decltype(_impl_.digest_){}
+    , decltype(_impl_.op_number_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.app_state_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.app_state_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_app_state().empty()) {
+    _this->_impl_.app_state_.Set(from._internal_app_state(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.digest_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.digest_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_digest().empty()) {
+    _this->_impl_.digest_.Set(from._internal_digest(), 
+      _this->GetArenaForAllocation());
+  }
+  _this->_impl_.op_number_ = from._impl_.op_number_;
+  // @@protoc_insertion_point(copy_constructor:dsnet.hotstuff.proto.StableCheckpoint)
+}
+
+inline void StableCheckpoint::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.signed_checkpoint_){arena}
+    , decltype(_impl_.app_state_){}
+    , decltype(_impl_.digest_){}
+    , decltype(_impl_.op_number_){uint64_t{0u}}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.app_state_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.app_state_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.digest_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.digest_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+StableCheckpoint::~StableCheckpoint() {
+  // @@protoc_insertion_point(destructor:dsnet.hotstuff.proto.StableCheckpoint)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void StableCheckpoint::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.signed_checkpoint_.~RepeatedPtrField();
+  _impl_.app_state_.Destroy();
+  _impl_.digest_.Destroy();
+}
+
+void StableCheckpoint::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void StableCheckpoint::Clear() {
+// @@protoc_insertion_point(message_clear_start:dsnet.hotstuff.proto.StableCheckpoint)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.signed_checkpoint_.Clear();
+  _impl_.app_state_.ClearToEmpty();
+  _impl_.digest_.ClearToEmpty();
+  _impl_.op_number_ = uint64_t{0u};
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* StableCheckpoint::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // uint64 op_number = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.op_number_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // bytes app_state = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_app_state();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated bytes signed_checkpoint = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            auto str = _internal_add_signed_checkpoint();
+            ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<26>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // bytes digest = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          auto str = _internal_mutable_digest();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* StableCheckpoint::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:dsnet.hotstuff.proto.StableCheckpoint)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // uint64 op_number = 1;
+  if (this->_internal_op_number() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(1, this->_internal_op_number(), target);
+  }
+
+  // bytes app_state = 2;
+  if (!this->_internal_app_state().empty()) {
+    target = stream->WriteBytesMaybeAliased(
+        2, this->_internal_app_state(), target);
+  }
+
+  // repeated bytes signed_checkpoint = 3;
+  for (int i = 0, n = this->_internal_signed_checkpoint_size(); i < n; i++) {
+    const auto& s = this->_internal_signed_checkpoint(i);
+    target = stream->WriteBytes(3, s, target);
+  }
+
+  // bytes digest = 4;
+  if (!this->_internal_digest().empty()) {
+    target = stream->WriteBytesMaybeAliased(
+        4, this->_internal_digest(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:dsnet.hotstuff.proto.StableCheckpoint)
+  return target;
+}
+
+size_t StableCheckpoint::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:dsnet.hotstuff.proto.StableCheckpoint)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated bytes signed_checkpoint = 3;
+  total_size += 1 *
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(_impl_.signed_checkpoint_.size());
+  for (int i = 0, n = _impl_.signed_checkpoint_.size(); i < n; i++) {
+    total_size += ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+      _impl_.signed_checkpoint_.Get(i));
+  }
+
+  // bytes app_state = 2;
+  if (!this->_internal_app_state().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_app_state());
+  }
+
+  // bytes digest = 4;
+  if (!this->_internal_digest().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_digest());
+  }
+
+  // uint64 op_number = 1;
+  if (this->_internal_op_number() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_op_number());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData StableCheckpoint::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    StableCheckpoint::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*StableCheckpoint::GetClassData() const { return &_class_data_; }
+
+
+void StableCheckpoint::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<StableCheckpoint*>(&to_msg);
+  auto& from = static_cast<const StableCheckpoint&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:dsnet.hotstuff.proto.StableCheckpoint)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.signed_checkpoint_.MergeFrom(from._impl_.signed_checkpoint_);
+  if (!from._internal_app_state().empty()) {
+    _this->_internal_set_app_state(from._internal_app_state());
+  }
+  if (!from._internal_digest().empty()) {
+    _this->_internal_set_digest(from._internal_digest());
+  }
+  if (from._internal_op_number() != 0) {
+    _this->_internal_set_op_number(from._internal_op_number());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void StableCheckpoint::CopyFrom(const StableCheckpoint& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:dsnet.hotstuff.proto.StableCheckpoint)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool StableCheckpoint::IsInitialized() const {
+  return true;
+}
+
+void StableCheckpoint::InternalSwap(StableCheckpoint* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.signed_checkpoint_.InternalSwap(&other->_impl_.signed_checkpoint_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.app_state_, lhs_arena,
+      &other->_impl_.app_state_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.digest_, lhs_arena,
+      &other->_impl_.digest_, rhs_arena
+  );
+  swap(_impl_.op_number_, other->_impl_.op_number_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata StableCheckpoint::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_replication_2fhotstuff_2fmessage_2eproto_getter, &descriptor_table_replication_2fhotstuff_2fmessage_2eproto_once,
+      file_level_metadata_replication_2fhotstuff_2fmessage_2eproto[11]);
+}
+
+// @@protoc_insertion_point(namespace_scope)
+}  // namespace proto
+}  // namespace hotstuff
+}  // namespace dsnet
+PROTOBUF_NAMESPACE_OPEN
+template<> PROTOBUF_NOINLINE ::dsnet::hotstuff::proto::Message*
+Arena::CreateMaybeMessage< ::dsnet::hotstuff::proto::Message >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::dsnet::hotstuff::proto::Message >(arena);
+}
+template<> PROTOBUF_NOINLINE ::dsnet::hotstuff::proto::ReplyMessage*
+Arena::CreateMaybeMessage< ::dsnet::hotstuff::proto::ReplyMessage >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::dsnet::hotstuff::proto::ReplyMessage >(arena);
+}
+template<> PROTOBUF_NOINLINE ::dsnet::hotstuff::proto::GenericMessage*
+Arena::CreateMaybeMessage< ::dsnet::hotstuff::proto::GenericMessage >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::dsnet::hotstuff::proto::GenericMessage >(arena);
+}
+template<> PROTOBUF_NOINLINE ::dsnet::hotstuff::proto::VoteMessage*
+Arena::CreateMaybeMessage< ::dsnet::hotstuff::proto::VoteMessage >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::dsnet::hotstuff::proto::VoteMessage >(arena);
+}
+template<> PROTOBUF_NOINLINE ::dsnet::hotstuff::proto::NonceMessage*
+Arena::CreateMaybeMessage< ::dsnet::hotstuff::proto::NonceMessage >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::dsnet::hotstuff::proto::NonceMessage >(arena);
+}
+template<> PROTOBUF_NOINLINE ::dsnet::hotstuff::proto::Block*
+Arena::CreateMaybeMessage< ::dsnet::hotstuff::proto::Block >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::dsnet::hotstuff::proto::Block >(arena);
+}
+template<> PROTOBUF_NOINLINE ::dsnet::hotstuff::proto::QC*
+Arena::CreateMaybeMessage< ::dsnet::hotstuff::proto::QC >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::dsnet::hotstuff::proto::QC >(arena);
+}
+template<> PROTOBUF_NOINLINE ::dsnet::hotstuff::proto::Checkpoint*
+Arena::CreateMaybeMessage< ::dsnet::hotstuff::proto::Checkpoint >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::dsnet::hotstuff::proto::Checkpoint >(arena);
+}
+template<> PROTOBUF_NOINLINE ::dsnet::hotstuff::proto::StateRequest*
+Arena::CreateMaybeMessage< ::dsnet::hotstuff::proto::StateRequest >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::dsnet::hotstuff::proto::StateRequest >(arena);
+}
+template<> PROTOBUF_NOINLINE ::dsnet::hotstuff::proto::StateChunk*
+Arena::CreateMaybeMessage< ::dsnet::hotstuff::proto::StateChunk >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::dsnet::hotstuff::proto::StateChunk >(arena);
+}
+template<> PROTOBUF_NOINLINE ::dsnet::hotstuff::proto::StateEntry*
+Arena::CreateMaybeMessage< ::dsnet::hotstuff::proto::StateEntry >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::dsnet::hotstuff::proto::StateEntry >(arena);
+}
+template<> PROTOBUF_NOINLINE ::dsnet::hotstuff::proto::StableCheckpoint*
+Arena::CreateMaybeMessage< ::dsnet::hotstuff::proto::StableCheckpoint >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::dsnet::hotstuff::proto::StableCheckpoint >(arena);
+}
+PROTOBUF_NAMESPACE_CLOSE
+
+// @@protoc_insertion_point(global_scope)
+#include <google/protobuf/port_undef.inc>
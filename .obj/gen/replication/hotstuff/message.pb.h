@@ -0,0 +1,4670 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: replication/hotstuff/message.proto
+
+#ifndef GOOGLE_PROTOBUF_INCLUDED_replication_2fhotstuff_2fmessage_2eproto
+#define GOOGLE_PROTOBUF_INCLUDED_replication_2fhotstuff_2fmessage_2eproto
+
+#include <limits>
+#include <string>
+
+#include <google/protobuf/port_def.inc>
+#if PROTOBUF_VERSION < 3021000
+#error This file was generated by a newer version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please update
+#error your headers.
+#endif
+#if 3021012 < PROTOBUF_MIN_PROTOC_VERSION
+#error This file was generated by an older version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please
+#error regenerate this file with a newer version of protoc.
+#endif
+
+#include <google/protobuf/port_undef.inc>
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/arena.h>
+#include <google/protobuf/arenastring.h>
+#include <google/protobuf/generated_message_util.h>
+#include <google/protobuf/metadata_lite.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/message.h>
+#include <google/protobuf/repeated_field.h>  // IWYU pragma: export
+#include <google/protobuf/extension_set.h>  // IWYU pragma: export
+#include <google/protobuf/unknown_field_set.h>
+#include "common/request.pb.h"
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+#define PROTOBUF_INTERNAL_EXPORT_replication_2fhotstuff_2fmessage_2eproto
+PROTOBUF_NAMESPACE_OPEN
+namespace internal {
+class AnyMetadata;
+}  // namespace internal
+PROTOBUF_NAMESPACE_CLOSE
+
+// Internal implementation detail -- do not use these members.
+struct TableStruct_replication_2fhotstuff_2fmessage_2eproto {
+  static const uint32_t offsets[];
+};
+extern const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_replication_2fhotstuff_2fmessage_2eproto;
+namespace dsnet {
+namespace hotstuff {
+namespace proto {
+class Block;
+struct BlockDefaultTypeInternal;
+extern BlockDefaultTypeInternal _Block_default_instance_;
+class Checkpoint;
+struct CheckpointDefaultTypeInternal;
+extern CheckpointDefaultTypeInternal _Checkpoint_default_instance_;
+class GenericMessage;
+struct GenericMessageDefaultTypeInternal;
+extern GenericMessageDefaultTypeInternal _GenericMessage_default_instance_;
+class Message;
+struct MessageDefaultTypeInternal;
+extern MessageDefaultTypeInternal _Message_default_instance_;
+class NonceMessage;
+struct NonceMessageDefaultTypeInternal;
+extern NonceMessageDefaultTypeInternal _NonceMessage_default_instance_;
+class QC;
+struct QCDefaultTypeInternal;
+extern QCDefaultTypeInternal _QC_default_instance_;
+class ReplyMessage;
+struct ReplyMessageDefaultTypeInternal;
+extern ReplyMessageDefaultTypeInternal _ReplyMessage_default_instance_;
+class StableCheckpoint;
+struct StableCheckpointDefaultTypeInternal;
+extern StableCheckpointDefaultTypeInternal _StableCheckpoint_default_instance_;
+class StateChunk;
+struct StateChunkDefaultTypeInternal;
+extern StateChunkDefaultTypeInternal _StateChunk_default_instance_;
+class StateEntry;
+struct StateEntryDefaultTypeInternal;
+extern StateEntryDefaultTypeInternal _StateEntry_default_instance_;
+class StateRequest;
+struct StateRequestDefaultTypeInternal;
+extern StateRequestDefaultTypeInternal _StateRequest_default_instance_;
+class VoteMessage;
+struct VoteMessageDefaultTypeInternal;
+extern VoteMessageDefaultTypeInternal _VoteMessage_default_instance_;
+}  // namespace proto
+}  // namespace hotstuff
+}  // namespace dsnet
+PROTOBUF_NAMESPACE_OPEN
+template<> ::dsnet::hotstuff::proto::Block* Arena::CreateMaybeMessage<::dsnet::hotstuff::proto::Block>(Arena*);
+template<> ::dsnet::hotstuff::proto::Checkpoint* Arena::CreateMaybeMessage<::dsnet::hotstuff::proto::Checkpoint>(Arena*);
+template<> ::dsnet::hotstuff::proto::GenericMessage* Arena::CreateMaybeMessage<::dsnet::hotstuff::proto::GenericMessage>(Arena*);
+template<> ::dsnet::hotstuff::proto::Message* Arena::CreateMaybeMessage<::dsnet::hotstuff::proto::Message>(Arena*);
+template<> ::dsnet::hotstuff::proto::NonceMessage* Arena::CreateMaybeMessage<::dsnet::hotstuff::proto::NonceMessage>(Arena*);
+template<> ::dsnet::hotstuff::proto::QC* Arena::CreateMaybeMessage<::dsnet::hotstuff::proto::QC>(Arena*);
+template<> ::dsnet::hotstuff::proto::ReplyMessage* Arena::CreateMaybeMessage<::dsnet::hotstuff::proto::ReplyMessage>(Arena*);
+template<> ::dsnet::hotstuff::proto::StableCheckpoint* Arena::CreateMaybeMessage<::dsnet::hotstuff::proto::StableCheckpoint>(Arena*);
+template<> ::dsnet::hotstuff::proto::StateChunk* Arena::CreateMaybeMessage<::dsnet::hotstuff::proto::StateChunk>(Arena*);
+template<> ::dsnet::hotstuff::proto::StateEntry* Arena::CreateMaybeMessage<::dsnet::hotstuff::proto::StateEntry>(Arena*);
+template<> ::dsnet::hotstuff::proto::StateRequest* Arena::CreateMaybeMessage<::dsnet::hotstuff::proto::StateRequest>(Arena*);
+template<> ::dsnet::hotstuff::proto::VoteMessage* Arena::CreateMaybeMessage<::dsnet::hotstuff::proto::VoteMessage>(Arena*);
+PROTOBUF_NAMESPACE_CLOSE
+namespace dsnet {
+namespace hotstuff {
+namespace proto {
+
+// ===================================================================
+
+class Message final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:dsnet.hotstuff.proto.Message) */ {
+ public:
+  inline Message() : Message(nullptr) {}
+  ~Message() override;
+  explicit PROTOBUF_CONSTEXPR Message(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  Message(const Message& from);
+  Message(Message&& from) noexcept
+    : Message() {
+    *this = ::std::move(from);
+  }
+
+  inline Message& operator=(const Message& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline Message& operator=(Message&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const Message& default_instance() {
+    return *internal_default_instance();
+  }
+  enum GetCase {
+    kRequest = 1,
+    kReply = 2,
+    kGeneric = 3,
+    kVote = 4,
+    kCheckpoint = 5,
+    kStateRequest = 6,
+    kStateChunk = 7,
+    kNonce = 8,
+    GET_NOT_SET = 0,
+  };
+
+  static inline const Message* internal_default_instance() {
+    return reinterpret_cast<const Message*>(
+               &_Message_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    0;
+
+  friend void swap(Message& a, Message& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(Message* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Message* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  Message* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<Message>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const Message& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const Message& from) {
+    Message::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(Message* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "dsnet.hotstuff.proto.Message";
+  }
+  protected:
+  explicit Message(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kRequestFieldNumber = 1,
+    kReplyFieldNumber = 2,
+    kGenericFieldNumber = 3,
+    kVoteFieldNumber = 4,
+    kCheckpointFieldNumber = 5,
+    kStateRequestFieldNumber = 6,
+    kStateChunkFieldNumber = 7,
+    kNonceFieldNumber = 8,
+  };
+  // .dsnet.Request request = 1;
+  bool has_request() const;
+  private:
+  bool _internal_has_request() const;
+  public:
+  void clear_request();
+  const ::dsnet::Request& request() const;
+  PROTOBUF_NODISCARD ::dsnet::Request* release_request();
+  ::dsnet::Request* mutable_request();
+  void set_allocated_request(::dsnet::Request* request);
+  private:
+  const ::dsnet::Request& _internal_request() const;
+  ::dsnet::Request* _internal_mutable_request();
+  public:
+  void unsafe_arena_set_allocated_request(
+      ::dsnet::Request* request);
+  ::dsnet::Request* unsafe_arena_release_request();
+
+  // .dsnet.hotstuff.proto.ReplyMessage reply = 2;
+  bool has_reply() const;
+  private:
+  bool _internal_has_reply() const;
+  public:
+  void clear_reply();
+  const ::dsnet::hotstuff::proto::ReplyMessage& reply() const;
+  PROTOBUF_NODISCARD ::dsnet::hotstuff::proto::ReplyMessage* release_reply();
+  ::dsnet::hotstuff::proto::ReplyMessage* mutable_reply();
+  void set_allocated_reply(::dsnet::hotstuff::proto::ReplyMessage* reply);
+  private:
+  const ::dsnet::hotstuff::proto::ReplyMessage& _internal_reply() const;
+  ::dsnet::hotstuff::proto::ReplyMessage* _internal_mutable_reply();
+  public:
+  void unsafe_arena_set_allocated_reply(
+      ::dsnet::hotstuff::proto::ReplyMessage* reply);
+  ::dsnet::hotstuff::proto::ReplyMessage* unsafe_arena_release_reply();
+
+  // .dsnet.hotstuff.proto.GenericMessage generic = 3;
+  bool has_generic() const;
+  private:
+  bool _internal_has_generic() const;
+  public:
+  void clear_generic();
+  const ::dsnet::hotstuff::proto::GenericMessage& generic() const;
+  PROTOBUF_NODISCARD ::dsnet::hotstuff::proto::GenericMessage* release_generic();
+  ::dsnet::hotstuff::proto::GenericMessage* mutable_generic();
+  void set_allocated_generic(::dsnet::hotstuff::proto::GenericMessage* generic);
+  private:
+  const ::dsnet::hotstuff::proto::GenericMessage& _internal_generic() const;
+  ::dsnet::hotstuff::proto::GenericMessage* _internal_mutable_generic();
+  public:
+  void unsafe_arena_set_allocated_generic(
+      ::dsnet::hotstuff::proto::GenericMessage* generic);
+  ::dsnet::hotstuff::proto::GenericMessage* unsafe_arena_release_generic();
+
+  // .dsnet.hotstuff.proto.VoteMessage vote = 4;
+  bool has_vote() const;
+  private:
+  bool _internal_has_vote() const;
+  public:
+  void clear_vote();
+  const ::dsnet::hotstuff::proto::VoteMessage& vote() const;
+  PROTOBUF_NODISCARD ::dsnet::hotstuff::proto::VoteMessage* release_vote();
+  ::dsnet::hotstuff::proto::VoteMessage* mutable_vote();
+  void set_allocated_vote(::dsnet::hotstuff::proto::VoteMessage* vote);
+  private:
+  const ::dsnet::hotstuff::proto::VoteMessage& _internal_vote() const;
+  ::dsnet::hotstuff::proto::VoteMessage* _internal_mutable_vote();
+  public:
+  void unsafe_arena_set_allocated_vote(
+      ::dsnet::hotstuff::proto::VoteMessage* vote);
+  ::dsnet::hotstuff::proto::VoteMessage* unsafe_arena_release_vote();
+
+  // .dsnet.hotstuff.proto.Checkpoint checkpoint = 5;
+  bool has_checkpoint() const;
+  private:
+  bool _internal_has_checkpoint() const;
+  public:
+  void clear_checkpoint();
+  const ::dsnet::hotstuff::proto::Checkpoint& checkpoint() const;
+  PROTOBUF_NODISCARD ::dsnet::hotstuff::proto::Checkpoint* release_checkpoint();
+  ::dsnet::hotstuff::proto::Checkpoint* mutable_checkpoint();
+  void set_allocated_checkpoint(::dsnet::hotstuff::proto::Checkpoint* checkpoint);
+  private:
+  const ::dsnet::hotstuff::proto::Checkpoint& _internal_checkpoint() const;
+  ::dsnet::hotstuff::proto::Checkpoint* _internal_mutable_checkpoint();
+  public:
+  void unsafe_arena_set_allocated_checkpoint(
+      ::dsnet::hotstuff::proto::Checkpoint* checkpoint);
+  ::dsnet::hotstuff::proto::Checkpoint* unsafe_arena_release_checkpoint();
+
+  // .dsnet.hotstuff.proto.StateRequest state_request = 6;
+  bool has_state_request() const;
+  private:
+  bool _internal_has_state_request() const;
+  public:
+  void clear_state_request();
+  const ::dsnet::hotstuff::proto::StateRequest& state_request() const;
+  PROTOBUF_NODISCARD ::dsnet::hotstuff::proto::StateRequest* release_state_request();
+  ::dsnet::hotstuff::proto::StateRequest* mutable_state_request();
+  void set_allocated_state_request(::dsnet::hotstuff::proto::StateRequest* state_request);
+  private:
+  const ::dsnet::hotstuff::proto::StateRequest& _internal_state_request() const;
+  ::dsnet::hotstuff::proto::StateRequest* _internal_mutable_state_request();
+  public:
+  void unsafe_arena_set_allocated_state_request(
+      ::dsnet::hotstuff::proto::StateRequest* state_request);
+  ::dsnet::hotstuff::proto::StateRequest* unsafe_arena_release_state_request();
+
+  // .dsnet.hotstuff.proto.StateChunk state_chunk = 7;
+  bool has_state_chunk() const;
+  private:
+  bool _internal_has_state_chunk() const;
+  public:
+  void clear_state_chunk();
+  const ::dsnet::hotstuff::proto::StateChunk& state_chunk() const;
+  PROTOBUF_NODISCARD ::dsnet::hotstuff::proto::StateChunk* release_state_chunk();
+  ::dsnet::hotstuff::proto::StateChunk* mutable_state_chunk();
+  void set_allocated_state_chunk(::dsnet::hotstuff::proto::StateChunk* state_chunk);
+  private:
+  const ::dsnet::hotstuff::proto::StateChunk& _internal_state_chunk() const;
+  ::dsnet::hotstuff::proto::StateChunk* _internal_mutable_state_chunk();
+  public:
+  void unsafe_arena_set_allocated_state_chunk(
+      ::dsnet::hotstuff::proto::StateChunk* state_chunk);
+  ::dsnet::hotstuff::proto::StateChunk* unsafe_arena_release_state_chunk();
+
+  // .dsnet.hotstuff.proto.NonceMessage nonce = 8;
+  bool has_nonce() const;
+  private:
+  bool _internal_has_nonce() const;
+  public:
+  void clear_nonce();
+  const ::dsnet::hotstuff::proto::NonceMessage& nonce() const;
+  PROTOBUF_NODISCARD ::dsnet::hotstuff::proto::NonceMessage* release_nonce();
+  ::dsnet::hotstuff::proto::NonceMessage* mutable_nonce();
+  void set_allocated_nonce(::dsnet::hotstuff::proto::NonceMessage* nonce);
+  private:
+  const ::dsnet::hotstuff::proto::NonceMessage& _internal_nonce() const;
+  ::dsnet::hotstuff::proto::NonceMessage* _internal_mutable_nonce();
+  public:
+  void unsafe_arena_set_allocated_nonce(
+      ::dsnet::hotstuff::proto::NonceMessage* nonce);
+  ::dsnet::hotstuff::proto::NonceMessage* unsafe_arena_release_nonce();
+
+  void clear_get();
+  GetCase get_case() const;
+  // @@protoc_insertion_point(class_scope:dsnet.hotstuff.proto.Message)
+ private:
+  class _Internal;
+  void set_has_request();
+  void set_has_reply();
+  void set_has_generic();
+  void set_has_vote();
+  void set_has_checkpoint();
+  void set_has_state_request();
+  void set_has_state_chunk();
+  void set_has_nonce();
+
+  inline bool has_get() const;
+  inline void clear_has_get();
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    union GetUnion {
+      constexpr GetUnion() : _constinit_{} {}
+        ::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized _constinit_;
+      ::dsnet::Request* request_;
+      ::dsnet::hotstuff::proto::ReplyMessage* reply_;
+      ::dsnet::hotstuff::proto::GenericMessage* generic_;
+      ::dsnet::hotstuff::proto::VoteMessage* vote_;
+      ::dsnet::hotstuff::proto::Checkpoint* checkpoint_;
+      ::dsnet::hotstuff::proto::StateRequest* state_request_;
+      ::dsnet::hotstuff::proto::StateChunk* state_chunk_;
+      ::dsnet::hotstuff::proto::NonceMessage* nonce_;
+    } get_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    uint32_t _oneof_case_[1];
+
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_replication_2fhotstuff_2fmessage_2eproto;
+};
+// -------------------------------------------------------------------
+
+class ReplyMessage final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:dsnet.hotstuff.proto.ReplyMessage) */ {
+ public:
+  inline ReplyMessage() : ReplyMessage(nullptr) {}
+  ~ReplyMessage() override;
+  explicit PROTOBUF_CONSTEXPR ReplyMessage(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  ReplyMessage(const ReplyMessage& from);
+  ReplyMessage(ReplyMessage&& from) noexcept
+    : ReplyMessage() {
+    *this = ::std::move(from);
+  }
+
+  inline ReplyMessage& operator=(const ReplyMessage& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline ReplyMessage& operator=(ReplyMessage&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ReplyMessage& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const ReplyMessage* internal_default_instance() {
+    return reinterpret_cast<const ReplyMessage*>(
+               &_ReplyMessage_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    1;
+
+  friend void swap(ReplyMessage& a, ReplyMessage& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(ReplyMessage* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ReplyMessage* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  ReplyMessage* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ReplyMessage>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const ReplyMessage& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ReplyMessage& from) {
+    ReplyMessage::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(ReplyMessage* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "dsnet.hotstuff.proto.ReplyMessage";
+  }
+  protected:
+  explicit ReplyMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kResultFieldNumber = 2,
+    kClientRequestFieldNumber = 1,
+    kReplicaIndexFieldNumber = 3,
+  };
+  // bytes result = 2;
+  void clear_result();
+  const std::string& result() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_result(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_result();
+  PROTOBUF_NODISCARD std::string* release_result();
+  void set_allocated_result(std::string* result);
+  private:
+  const std::string& _internal_result() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_result(const std::string& value);
+  std::string* _internal_mutable_result();
+  public:
+
+  // uint32 client_request = 1;
+  void clear_client_request();
+  uint32_t client_request() const;
+  void set_client_request(uint32_t value);
+  private:
+  uint32_t _internal_client_request() const;
+  void _internal_set_client_request(uint32_t value);
+  public:
+
+  // int32 replica_index = 3;
+  void clear_replica_index();
+  int32_t replica_index() const;
+  void set_replica_index(int32_t value);
+  private:
+  int32_t _internal_replica_index() const;
+  void _internal_set_replica_index(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:dsnet.hotstuff.proto.ReplyMessage)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr result_;
+    uint32_t client_request_;
+    int32_t replica_index_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_replication_2fhotstuff_2fmessage_2eproto;
+};
+// -------------------------------------------------------------------
+
+class GenericMessage final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:dsnet.hotstuff.proto.GenericMessage) */ {
+ public:
+  inline GenericMessage() : GenericMessage(nullptr) {}
+  ~GenericMessage() override;
+  explicit PROTOBUF_CONSTEXPR GenericMessage(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  GenericMessage(const GenericMessage& from);
+  GenericMessage(GenericMessage&& from) noexcept
+    : GenericMessage() {
+    *this = ::std::move(from);
+  }
+
+  inline GenericMessage& operator=(const GenericMessage& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline GenericMessage& operator=(GenericMessage&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const GenericMessage& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const GenericMessage* internal_default_instance() {
+    return reinterpret_cast<const GenericMessage*>(
+               &_GenericMessage_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    2;
+
+  friend void swap(GenericMessage& a, GenericMessage& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(GenericMessage* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(GenericMessage* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  GenericMessage* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<GenericMessage>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const GenericMessage& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const GenericMessage& from) {
+    GenericMessage::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(GenericMessage* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "dsnet.hotstuff.proto.GenericMessage";
+  }
+  protected:
+  explicit GenericMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kBlockFieldNumber = 1,
+  };
+  // .dsnet.hotstuff.proto.Block block = 1;
+  bool has_block() const;
+  private:
+  bool _internal_has_block() const;
+  public:
+  void clear_block();
+  const ::dsnet::hotstuff::proto::Block& block() const;
+  PROTOBUF_NODISCARD ::dsnet::hotstuff::proto::Block* release_block();
+  ::dsnet::hotstuff::proto::Block* mutable_block();
+  void set_allocated_block(::dsnet::hotstuff::proto::Block* block);
+  private:
+  const ::dsnet::hotstuff::proto::Block& _internal_block() const;
+  ::dsnet::hotstuff::proto::Block* _internal_mutable_block();
+  public:
+  void unsafe_arena_set_allocated_block(
+      ::dsnet::hotstuff::proto::Block* block);
+  ::dsnet::hotstuff::proto::Block* unsafe_arena_release_block();
+
+  // @@protoc_insertion_point(class_scope:dsnet.hotstuff.proto.GenericMessage)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::dsnet::hotstuff::proto::Block* block_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_replication_2fhotstuff_2fmessage_2eproto;
+};
+// -------------------------------------------------------------------
+
+class VoteMessage final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:dsnet.hotstuff.proto.VoteMessage) */ {
+ public:
+  inline VoteMessage() : VoteMessage(nullptr) {}
+  ~VoteMessage() override;
+  explicit PROTOBUF_CONSTEXPR VoteMessage(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  VoteMessage(const VoteMessage& from);
+  VoteMessage(VoteMessage&& from) noexcept
+    : VoteMessage() {
+    *this = ::std::move(from);
+  }
+
+  inline VoteMessage& operator=(const VoteMessage& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline VoteMessage& operator=(VoteMessage&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const VoteMessage& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const VoteMessage* internal_default_instance() {
+    return reinterpret_cast<const VoteMessage*>(
+               &_VoteMessage_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    3;
+
+  friend void swap(VoteMessage& a, VoteMessage& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(VoteMessage* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(VoteMessage* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  VoteMessage* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<VoteMessage>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const VoteMessage& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const VoteMessage& from) {
+    VoteMessage::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(VoteMessage* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "dsnet.hotstuff.proto.VoteMessage";
+  }
+  protected:
+  explicit VoteMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kPartialSignatureFieldNumber = 3,
+    kNonceFieldNumber = 5,
+    kOpNumberFieldNumber = 2,
+    kNonceSeqFieldNumber = 4,
+    kReplicaIndexFieldNumber = 1,
+  };
+  // bytes partial_signature = 3;
+  void clear_partial_signature();
+  const std::string& partial_signature() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_partial_signature(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_partial_signature();
+  PROTOBUF_NODISCARD std::string* release_partial_signature();
+  void set_allocated_partial_signature(std::string* partial_signature);
+  private:
+  const std::string& _internal_partial_signature() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_partial_signature(const std::string& value);
+  std::string* _internal_mutable_partial_signature();
+  public:
+
+  // bytes nonce = 5;
+  void clear_nonce();
+  const std::string& nonce() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_nonce(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_nonce();
+  PROTOBUF_NODISCARD std::string* release_nonce();
+  void set_allocated_nonce(std::string* nonce);
+  private:
+  const std::string& _internal_nonce() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_nonce(const std::string& value);
+  std::string* _internal_mutable_nonce();
+  public:
+
+  // uint64 op_number = 2;
+  void clear_op_number();
+  uint64_t op_number() const;
+  void set_op_number(uint64_t value);
+  private:
+  uint64_t _internal_op_number() const;
+  void _internal_set_op_number(uint64_t value);
+  public:
+
+  // uint64 nonce_seq = 4;
+  void clear_nonce_seq();
+  uint64_t nonce_seq() const;
+  void set_nonce_seq(uint64_t value);
+  private:
+  uint64_t _internal_nonce_seq() const;
+  void _internal_set_nonce_seq(uint64_t value);
+  public:
+
+  // int32 replica_index = 1;
+  void clear_replica_index();
+  int32_t replica_index() const;
+  void set_replica_index(int32_t value);
+  private:
+  int32_t _internal_replica_index() const;
+  void _internal_set_replica_index(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:dsnet.hotstuff.proto.VoteMessage)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr partial_signature_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr nonce_;
+    uint64_t op_number_;
+    uint64_t nonce_seq_;
+    int32_t replica_index_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_replication_2fhotstuff_2fmessage_2eproto;
+};
+// -------------------------------------------------------------------
+
+class NonceMessage final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:dsnet.hotstuff.proto.NonceMessage) */ {
+ public:
+  inline NonceMessage() : NonceMessage(nullptr) {}
+  ~NonceMessage() override;
+  explicit PROTOBUF_CONSTEXPR NonceMessage(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  NonceMessage(const NonceMessage& from);
+  NonceMessage(NonceMessage&& from) noexcept
+    : NonceMessage() {
+    *this = ::std::move(from);
+  }
+
+  inline NonceMessage& operator=(const NonceMessage& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline NonceMessage& operator=(NonceMessage&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const NonceMessage& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const NonceMessage* internal_default_instance() {
+    return reinterpret_cast<const NonceMessage*>(
+               &_NonceMessage_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    4;
+
+  friend void swap(NonceMessage& a, NonceMessage& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(NonceMessage* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(NonceMessage* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  NonceMessage* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<NonceMessage>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const NonceMessage& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const NonceMessage& from) {
+    NonceMessage::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(NonceMessage* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "dsnet.hotstuff.proto.NonceMessage";
+  }
+  protected:
+  explicit NonceMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kNonceFieldNumber = 3,
+    kNonceSeqFieldNumber = 2,
+    kReplicaIndexFieldNumber = 1,
+  };
+  // repeated bytes nonce = 3;
+  int nonce_size() const;
+  private:
+  int _internal_nonce_size() const;
+  public:
+  void clear_nonce();
+  const std::string& nonce(int index) const;
+  std::string* mutable_nonce(int index);
+  void set_nonce(int index, const std::string& value);
+  void set_nonce(int index, std::string&& value);
+  void set_nonce(int index, const char* value);
+  void set_nonce(int index, const void* value, size_t size);
+  std::string* add_nonce();
+  void add_nonce(const std::string& value);
+  void add_nonce(std::string&& value);
+  void add_nonce(const char* value);
+  void add_nonce(const void* value, size_t size);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>& nonce() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>* mutable_nonce();
+  private:
+  const std::string& _internal_nonce(int index) const;
+  std::string* _internal_add_nonce();
+  public:
+
+  // uint64 nonce_seq = 2;
+  void clear_nonce_seq();
+  uint64_t nonce_seq() const;
+  void set_nonce_seq(uint64_t value);
+  private:
+  uint64_t _internal_nonce_seq() const;
+  void _internal_set_nonce_seq(uint64_t value);
+  public:
+
+  // int32 replica_index = 1;
+  void clear_replica_index();
+  int32_t replica_index() const;
+  void set_replica_index(int32_t value);
+  private:
+  int32_t _internal_replica_index() const;
+  void _internal_set_replica_index(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:dsnet.hotstuff.proto.NonceMessage)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string> nonce_;
+    uint64_t nonce_seq_;
+    int32_t replica_index_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_replication_2fhotstuff_2fmessage_2eproto;
+};
+// -------------------------------------------------------------------
+
+class Block final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:dsnet.hotstuff.proto.Block) */ {
+ public:
+  inline Block() : Block(nullptr) {}
+  ~Block() override;
+  explicit PROTOBUF_CONSTEXPR Block(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  Block(const Block& from);
+  Block(Block&& from) noexcept
+    : Block() {
+    *this = ::std::move(from);
+  }
+
+  inline Block& operator=(const Block& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline Block& operator=(Block&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const Block& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const Block* internal_default_instance() {
+    return reinterpret_cast<const Block*>(
+               &_Block_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    5;
+
+  friend void swap(Block& a, Block& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(Block* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Block* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  Block* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<Block>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const Block& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const Block& from) {
+    Block::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(Block* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "dsnet.hotstuff.proto.Block";
+  }
+  protected:
+  explicit Block(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kRequestFieldNumber = 2,
+    kNonceSeqFieldNumber = 5,
+    kAggregateNonceFieldNumber = 6,
+    kJustifyFieldNumber = 3,
+    kOpNumberFieldNumber = 1,
+    kSignersFieldNumber = 4,
+  };
+  // repeated .dsnet.Request request = 2;
+  int request_size() const;
+  private:
+  int _internal_request_size() const;
+  public:
+  void clear_request();
+  ::dsnet::Request* mutable_request(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::dsnet::Request >*
+      mutable_request();
+  private:
+  const ::dsnet::Request& _internal_request(int index) const;
+  ::dsnet::Request* _internal_add_request();
+  public:
+  const ::dsnet::Request& request(int index) const;
+  ::dsnet::Request* add_request();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::dsnet::Request >&
+      request() const;
+
+  // repeated uint64 nonce_seq = 5;
+  int nonce_seq_size() const;
+  private:
+  int _internal_nonce_seq_size() const;
+  public:
+  void clear_nonce_seq();
+  private:
+  uint64_t _internal_nonce_seq(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >&
+      _internal_nonce_seq() const;
+  void _internal_add_nonce_seq(uint64_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >*
+      _internal_mutable_nonce_seq();
+  public:
+  uint64_t nonce_seq(int index) const;
+  void set_nonce_seq(int index, uint64_t value);
+  void add_nonce_seq(uint64_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >&
+      nonce_seq() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >*
+      mutable_nonce_seq();
+
+  // bytes aggregate_nonce = 6;
+  void clear_aggregate_nonce();
+  const std::string& aggregate_nonce() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_aggregate_nonce(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_aggregate_nonce();
+  PROTOBUF_NODISCARD std::string* release_aggregate_nonce();
+  void set_allocated_aggregate_nonce(std::string* aggregate_nonce);
+  private:
+  const std::string& _internal_aggregate_nonce() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_aggregate_nonce(const std::string& value);
+  std::string* _internal_mutable_aggregate_nonce();
+  public:
+
+  // .dsnet.hotstuff.proto.QC justify = 3;
+  bool has_justify() const;
+  private:
+  bool _internal_has_justify() const;
+  public:
+  void clear_justify();
+  const ::dsnet::hotstuff::proto::QC& justify() const;
+  PROTOBUF_NODISCARD ::dsnet::hotstuff::proto::QC* release_justify();
+  ::dsnet::hotstuff::proto::QC* mutable_justify();
+  void set_allocated_justify(::dsnet::hotstuff::proto::QC* justify);
+  private:
+  const ::dsnet::hotstuff::proto::QC& _internal_justify() const;
+  ::dsnet::hotstuff::proto::QC* _internal_mutable_justify();
+  public:
+  void unsafe_arena_set_allocated_justify(
+      ::dsnet::hotstuff::proto::QC* justify);
+  ::dsnet::hotstuff::proto::QC* unsafe_arena_release_justify();
+
+  // uint64 op_number = 1;
+  void clear_op_number();
+  uint64_t op_number() const;
+  void set_op_number(uint64_t value);
+  private:
+  uint64_t _internal_op_number() const;
+  void _internal_set_op_number(uint64_t value);
+  public:
+
+  // uint64 signers = 4;
+  void clear_signers();
+  uint64_t signers() const;
+  void set_signers(uint64_t value);
+  private:
+  uint64_t _internal_signers() const;
+  void _internal_set_signers(uint64_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:dsnet.hotstuff.proto.Block)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::dsnet::Request > request_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t > nonce_seq_;
+    mutable std::atomic<int> _nonce_seq_cached_byte_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr aggregate_nonce_;
+    ::dsnet::hotstuff::proto::QC* justify_;
+    uint64_t op_number_;
+    uint64_t signers_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_replication_2fhotstuff_2fmessage_2eproto;
+};
+// -------------------------------------------------------------------
+
+class QC final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:dsnet.hotstuff.proto.QC) */ {
+ public:
+  inline QC() : QC(nullptr) {}
+  ~QC() override;
+  explicit PROTOBUF_CONSTEXPR QC(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  QC(const QC& from);
+  QC(QC&& from) noexcept
+    : QC() {
+    *this = ::std::move(from);
+  }
+
+  inline QC& operator=(const QC& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline QC& operator=(QC&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const QC& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const QC* internal_default_instance() {
+    return reinterpret_cast<const QC*>(
+               &_QC_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    6;
+
+  friend void swap(QC& a, QC& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(QC* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(QC* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  QC* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<QC>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const QC& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const QC& from) {
+    QC::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(QC* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "dsnet.hotstuff.proto.QC";
+  }
+  protected:
+  explicit QC(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kSignedVoteFieldNumber = 2,
+    kAggregateSignatureFieldNumber = 4,
+    kOpNumberFieldNumber = 1,
+    kSignersFieldNumber = 3,
+  };
+  // repeated bytes signed_vote = 2;
+  int signed_vote_size() const;
+  private:
+  int _internal_signed_vote_size() const;
+  public:
+  void clear_signed_vote();
+  const std::string& signed_vote(int index) const;
+  std::string* mutable_signed_vote(int index);
+  void set_signed_vote(int index, const std::string& value);
+  void set_signed_vote(int index, std::string&& value);
+  void set_signed_vote(int index, const char* value);
+  void set_signed_vote(int index, const void* value, size_t size);
+  std::string* add_signed_vote();
+  void add_signed_vote(const std::string& value);
+  void add_signed_vote(std::string&& value);
+  void add_signed_vote(const char* value);
+  void add_signed_vote(const void* value, size_t size);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>& signed_vote() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>* mutable_signed_vote();
+  private:
+  const std::string& _internal_signed_vote(int index) const;
+  std::string* _internal_add_signed_vote();
+  public:
+
+  // bytes aggregate_signature = 4;
+  void clear_aggregate_signature();
+  const std::string& aggregate_signature() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_aggregate_signature(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_aggregate_signature();
+  PROTOBUF_NODISCARD std::string* release_aggregate_signature();
+  void set_allocated_aggregate_signature(std::string* aggregate_signature);
+  private:
+  const std::string& _internal_aggregate_signature() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_aggregate_signature(const std::string& value);
+  std::string* _internal_mutable_aggregate_signature();
+  public:
+
+  // uint64 op_number = 1;
+  void clear_op_number();
+  uint64_t op_number() const;
+  void set_op_number(uint64_t value);
+  private:
+  uint64_t _internal_op_number() const;
+  void _internal_set_op_number(uint64_t value);
+  public:
+
+  // uint64 signers = 3;
+  void clear_signers();
+  uint64_t signers() const;
+  void set_signers(uint64_t value);
+  private:
+  uint64_t _internal_signers() const;
+  void _internal_set_signers(uint64_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:dsnet.hotstuff.proto.QC)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string> signed_vote_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr aggregate_signature_;
+    uint64_t op_number_;
+    uint64_t signers_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_replication_2fhotstuff_2fmessage_2eproto;
+};
+// -------------------------------------------------------------------
+
+class Checkpoint final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:dsnet.hotstuff.proto.Checkpoint) */ {
+ public:
+  inline Checkpoint() : Checkpoint(nullptr) {}
+  ~Checkpoint() override;
+  explicit PROTOBUF_CONSTEXPR Checkpoint(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  Checkpoint(const Checkpoint& from);
+  Checkpoint(Checkpoint&& from) noexcept
+    : Checkpoint() {
+    *this = ::std::move(from);
+  }
+
+  inline Checkpoint& operator=(const Checkpoint& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline Checkpoint& operator=(Checkpoint&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const Checkpoint& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const Checkpoint* internal_default_instance() {
+    return reinterpret_cast<const Checkpoint*>(
+               &_Checkpoint_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    7;
+
+  friend void swap(Checkpoint& a, Checkpoint& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(Checkpoint* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Checkpoint* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  Checkpoint* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<Checkpoint>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const Checkpoint& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const Checkpoint& from) {
+    Checkpoint::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(Checkpoint* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "dsnet.hotstuff.proto.Checkpoint";
+  }
+  protected:
+  explicit Checkpoint(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kDigestFieldNumber = 3,
+    kOpNumberFieldNumber = 1,
+    kReplicaIndexFieldNumber = 2,
+  };
+  // bytes digest = 3;
+  void clear_digest();
+  const std::string& digest() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_digest(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_digest();
+  PROTOBUF_NODISCARD std::string* release_digest();
+  void set_allocated_digest(std::string* digest);
+  private:
+  const std::string& _internal_digest() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_digest(const std::string& value);
+  std::string* _internal_mutable_digest();
+  public:
+
+  // uint64 op_number = 1;
+  void clear_op_number();
+  uint64_t op_number() const;
+  void set_op_number(uint64_t value);
+  private:
+  uint64_t _internal_op_number() const;
+  void _internal_set_op_number(uint64_t value);
+  public:
+
+  // int32 replica_index = 2;
+  void clear_replica_index();
+  int32_t replica_index() const;
+  void set_replica_index(int32_t value);
+  private:
+  int32_t _internal_replica_index() const;
+  void _internal_set_replica_index(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:dsnet.hotstuff.proto.Checkpoint)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr digest_;
+    uint64_t op_number_;
+    int32_t replica_index_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_replication_2fhotstuff_2fmessage_2eproto;
+};
+// -------------------------------------------------------------------
+
+class StateRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:dsnet.hotstuff.proto.StateRequest) */ {
+ public:
+  inline StateRequest() : StateRequest(nullptr) {}
+  ~StateRequest() override;
+  explicit PROTOBUF_CONSTEXPR StateRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  StateRequest(const StateRequest& from);
+  StateRequest(StateRequest&& from) noexcept
+    : StateRequest() {
+    *this = ::std::move(from);
+  }
+
+  inline StateRequest& operator=(const StateRequest& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline StateRequest& operator=(StateRequest&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const StateRequest& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const StateRequest* internal_default_instance() {
+    return reinterpret_cast<const StateRequest*>(
+               &_StateRequest_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    8;
+
+  friend void swap(StateRequest& a, StateRequest& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(StateRequest* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(StateRequest* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  StateRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<StateRequest>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const StateRequest& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const StateRequest& from) {
+    StateRequest::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(StateRequest* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "dsnet.hotstuff.proto.StateRequest";
+  }
+  protected:
+  explicit StateRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kOpNumberFieldNumber = 1,
+    kLastOpNumberFieldNumber = 2,
+    kReplicaIndexFieldNumber = 3,
+  };
+  // uint64 op_number = 1;
+  void clear_op_number();
+  uint64_t op_number() const;
+  void set_op_number(uint64_t value);
+  private:
+  uint64_t _internal_op_number() const;
+  void _internal_set_op_number(uint64_t value);
+  public:
+
+  // uint64 last_op_number = 2;
+  void clear_last_op_number();
+  uint64_t last_op_number() const;
+  void set_last_op_number(uint64_t value);
+  private:
+  uint64_t _internal_last_op_number() const;
+  void _internal_set_last_op_number(uint64_t value);
+  public:
+
+  // int32 replica_index = 3;
+  void clear_replica_index();
+  int32_t replica_index() const;
+  void set_replica_index(int32_t value);
+  private:
+  int32_t _internal_replica_index() const;
+  void _internal_set_replica_index(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:dsnet.hotstuff.proto.StateRequest)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    uint64_t op_number_;
+    uint64_t last_op_number_;
+    int32_t replica_index_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_replication_2fhotstuff_2fmessage_2eproto;
+};
+// -------------------------------------------------------------------
+
+class StateChunk final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:dsnet.hotstuff.proto.StateChunk) */ {
+ public:
+  inline StateChunk() : StateChunk(nullptr) {}
+  ~StateChunk() override;
+  explicit PROTOBUF_CONSTEXPR StateChunk(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  StateChunk(const StateChunk& from);
+  StateChunk(StateChunk&& from) noexcept
+    : StateChunk() {
+    *this = ::std::move(from);
+  }
+
+  inline StateChunk& operator=(const StateChunk& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline StateChunk& operator=(StateChunk&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const StateChunk& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const StateChunk* internal_default_instance() {
+    return reinterpret_cast<const StateChunk*>(
+               &_StateChunk_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    9;
+
+  friend void swap(StateChunk& a, StateChunk& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(StateChunk* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(StateChunk* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  StateChunk* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<StateChunk>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const StateChunk& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const StateChunk& from) {
+    StateChunk::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(StateChunk* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "dsnet.hotstuff.proto.StateChunk";
+  }
+  protected:
+  explicit StateChunk(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kEntryFieldNumber = 2,
+    kCheckpointFieldNumber = 3,
+    kOpNumberFieldNumber = 1,
+    kReplicaIndexFieldNumber = 4,
+  };
+  // repeated .dsnet.hotstuff.proto.StateEntry entry = 2;
+  int entry_size() const;
+  private:
+  int _internal_entry_size() const;
+  public:
+  void clear_entry();
+  ::dsnet::hotstuff::proto::StateEntry* mutable_entry(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::dsnet::hotstuff::proto::StateEntry >*
+      mutable_entry();
+  private:
+  const ::dsnet::hotstuff::proto::StateEntry& _internal_entry(int index) const;
+  ::dsnet::hotstuff::proto::StateEntry* _internal_add_entry();
+  public:
+  const ::dsnet::hotstuff::proto::StateEntry& entry(int index) const;
+  ::dsnet::hotstuff::proto::StateEntry* add_entry();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::dsnet::hotstuff::proto::StateEntry >&
+      entry() const;
+
+  // .dsnet.hotstuff.proto.StableCheckpoint checkpoint = 3;
+  bool has_checkpoint() const;
+  private:
+  bool _internal_has_checkpoint() const;
+  public:
+  void clear_checkpoint();
+  const ::dsnet::hotstuff::proto::StableCheckpoint& checkpoint() const;
+  PROTOBUF_NODISCARD ::dsnet::hotstuff::proto::StableCheckpoint* release_checkpoint();
+  ::dsnet::hotstuff::proto::StableCheckpoint* mutable_checkpoint();
+  void set_allocated_checkpoint(::dsnet::hotstuff::proto::StableCheckpoint* checkpoint);
+  private:
+  const ::dsnet::hotstuff::proto::StableCheckpoint& _internal_checkpoint() const;
+  ::dsnet::hotstuff::proto::StableCheckpoint* _internal_mutable_checkpoint();
+  public:
+  void unsafe_arena_set_allocated_checkpoint(
+      ::dsnet::hotstuff::proto::StableCheckpoint* checkpoint);
+  ::dsnet::hotstuff::proto::StableCheckpoint* unsafe_arena_release_checkpoint();
+
+  // uint64 op_number = 1;
+  void clear_op_number();
+  uint64_t op_number() const;
+  void set_op_number(uint64_t value);
+  private:
+  uint64_t _internal_op_number() const;
+  void _internal_set_op_number(uint64_t value);
+  public:
+
+  // int32 replica_index = 4;
+  void clear_replica_index();
+  int32_t replica_index() const;
+  void set_replica_index(int32_t value);
+  private:
+  int32_t _internal_replica_index() const;
+  void _internal_set_replica_index(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:dsnet.hotstuff.proto.StateChunk)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::dsnet::hotstuff::proto::StateEntry > entry_;
+    ::dsnet::hotstuff::proto::StableCheckpoint* checkpoint_;
+    uint64_t op_number_;
+    int32_t replica_index_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_replication_2fhotstuff_2fmessage_2eproto;
+};
+// -------------------------------------------------------------------
+
+class StateEntry final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:dsnet.hotstuff.proto.StateEntry) */ {
+ public:
+  inline StateEntry() : StateEntry(nullptr) {}
+  ~StateEntry() override;
+  explicit PROTOBUF_CONSTEXPR StateEntry(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  StateEntry(const StateEntry& from);
+  StateEntry(StateEntry&& from) noexcept
+    : StateEntry() {
+    *this = ::std::move(from);
+  }
+
+  inline StateEntry& operator=(const StateEntry& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline StateEntry& operator=(StateEntry&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const StateEntry& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const StateEntry* internal_default_instance() {
+    return reinterpret_cast<const StateEntry*>(
+               &_StateEntry_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    10;
+
+  friend void swap(StateEntry& a, StateEntry& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(StateEntry* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(StateEntry* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  StateEntry* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<StateEntry>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const StateEntry& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const StateEntry& from) {
+    StateEntry::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(StateEntry* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "dsnet.hotstuff.proto.StateEntry";
+  }
+  protected:
+  explicit StateEntry(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kRequestFieldNumber = 1,
+  };
+  // .dsnet.Request request = 1;
+  bool has_request() const;
+  private:
+  bool _internal_has_request() const;
+  public:
+  void clear_request();
+  const ::dsnet::Request& request() const;
+  PROTOBUF_NODISCARD ::dsnet::Request* release_request();
+  ::dsnet::Request* mutable_request();
+  void set_allocated_request(::dsnet::Request* request);
+  private:
+  const ::dsnet::Request& _internal_request() const;
+  ::dsnet::Request* _internal_mutable_request();
+  public:
+  void unsafe_arena_set_allocated_request(
+      ::dsnet::Request* request);
+  ::dsnet::Request* unsafe_arena_release_request();
+
+  // @@protoc_insertion_point(class_scope:dsnet.hotstuff.proto.StateEntry)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::dsnet::Request* request_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_replication_2fhotstuff_2fmessage_2eproto;
+};
+// -------------------------------------------------------------------
+
+class StableCheckpoint final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:dsnet.hotstuff.proto.StableCheckpoint) */ {
+ public:
+  inline StableCheckpoint() : StableCheckpoint(nullptr) {}
+  ~StableCheckpoint() override;
+  explicit PROTOBUF_CONSTEXPR StableCheckpoint(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  StableCheckpoint(const StableCheckpoint& from);
+  StableCheckpoint(StableCheckpoint&& from) noexcept
+    : StableCheckpoint() {
+    *this = ::std::move(from);
+  }
+
+  inline StableCheckpoint& operator=(const StableCheckpoint& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline StableCheckpoint& operator=(StableCheckpoint&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const StableCheckpoint& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const StableCheckpoint* internal_default_instance() {
+    return reinterpret_cast<const StableCheckpoint*>(
+               &_StableCheckpoint_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    11;
+
+  friend void swap(StableCheckpoint& a, StableCheckpoint& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(StableCheckpoint* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(StableCheckpoint* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  StableCheckpoint* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<StableCheckpoint>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const StableCheckpoint& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const StableCheckpoint& from) {
+    StableCheckpoint::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(StableCheckpoint* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "dsnet.hotstuff.proto.StableCheckpoint";
+  }
+  protected:
+  explicit StableCheckpoint(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kSignedCheckpointFieldNumber = 3,
+    kAppStateFieldNumber = 2,
+    kDigestFieldNumber = 4,
+    kOpNumberFieldNumber = 1,
+  };
+  // repeated bytes signed_checkpoint = 3;
+  int signed_checkpoint_size() const;
+  private:
+  int _internal_signed_checkpoint_size() const;
+  public:
+  void clear_signed_checkpoint();
+  const std::string& signed_checkpoint(int index) const;
+  std::string* mutable_signed_checkpoint(int index);
+  void set_signed_checkpoint(int index, const std::string& value);
+  void set_signed_checkpoint(int index, std::string&& value);
+  void set_signed_checkpoint(int index, const char* value);
+  void set_signed_checkpoint(int index, const void* value, size_t size);
+  std::string* add_signed_checkpoint();
+  void add_signed_checkpoint(const std::string& value);
+  void add_signed_checkpoint(std::string&& value);
+  void add_signed_checkpoint(const char* value);
+  void add_signed_checkpoint(const void* value, size_t size);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>& signed_checkpoint() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>* mutable_signed_checkpoint();
+  private:
+  const std::string& _internal_signed_checkpoint(int index) const;
+  std::string* _internal_add_signed_checkpoint();
+  public:
+
+  // bytes app_state = 2;
+  void clear_app_state();
+  const std::string& app_state() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_app_state(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_app_state();
+  PROTOBUF_NODISCARD std::string* release_app_state();
+  void set_allocated_app_state(std::string* app_state);
+  private:
+  const std::string& _internal_app_state() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_app_state(const std::string& value);
+  std::string* _internal_mutable_app_state();
+  public:
+
+  // bytes digest = 4;
+  void clear_digest();
+  const std::string& digest() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_digest(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_digest();
+  PROTOBUF_NODISCARD std::string* release_digest();
+  void set_allocated_digest(std::string* digest);
+  private:
+  const std::string& _internal_digest() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_digest(const std::string& value);
+  std::string* _internal_mutable_digest();
+  public:
+
+  // uint64 op_number = 1;
+  void clear_op_number();
+  uint64_t op_number() const;
+  void set_op_number(uint64_t value);
+  private:
+  uint64_t _internal_op_number() const;
+  void _internal_set_op_number(uint64_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:dsnet.hotstuff.proto.StableCheckpoint)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string> signed_checkpoint_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr app_state_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr digest_;
+    uint64_t op_number_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_replication_2fhotstuff_2fmessage_2eproto;
+};
+// ===================================================================
+
+
+// ===================================================================
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
+#endif  // __GNUC__
+// Message
+
+// .dsnet.Request request = 1;
+inline bool Message::_internal_has_request() const {
+  return get_case() == kRequest;
+}
+inline bool Message::has_request() const {
+  return _internal_has_request();
+}
+inline void Message::set_has_request() {
+  _impl_._oneof_case_[0] = kRequest;
+}
+inline ::dsnet::Request* Message::release_request() {
+  // @@protoc_insertion_point(field_release:dsnet.hotstuff.proto.Message.request)
+  if (_internal_has_request()) {
+    clear_has_get();
+    ::dsnet::Request* temp = _impl_.get_.request_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.get_.request_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::dsnet::Request& Message::_internal_request() const {
+  return _internal_has_request()
+      ? *_impl_.get_.request_
+      : reinterpret_cast< ::dsnet::Request&>(::dsnet::_Request_default_instance_);
+}
+inline const ::dsnet::Request& Message::request() const {
+  // @@protoc_insertion_point(field_get:dsnet.hotstuff.proto.Message.request)
+  return _internal_request();
+}
+inline ::dsnet::Request* Message::unsafe_arena_release_request() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:dsnet.hotstuff.proto.Message.request)
+  if (_internal_has_request()) {
+    clear_has_get();
+    ::dsnet::Request* temp = _impl_.get_.request_;
+    _impl_.get_.request_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void Message::unsafe_arena_set_allocated_request(::dsnet::Request* request) {
+  clear_get();
+  if (request) {
+    set_has_request();
+    _impl_.get_.request_ = request;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:dsnet.hotstuff.proto.Message.request)
+}
+inline ::dsnet::Request* Message::_internal_mutable_request() {
+  if (!_internal_has_request()) {
+    clear_get();
+    set_has_request();
+    _impl_.get_.request_ = CreateMaybeMessage< ::dsnet::Request >(GetArenaForAllocation());
+  }
+  return _impl_.get_.request_;
+}
+inline ::dsnet::Request* Message::mutable_request() {
+  ::dsnet::Request* _msg = _internal_mutable_request();
+  // @@protoc_insertion_point(field_mutable:dsnet.hotstuff.proto.Message.request)
+  return _msg;
+}
+
+// .dsnet.hotstuff.proto.ReplyMessage reply = 2;
+inline bool Message::_internal_has_reply() const {
+  return get_case() == kReply;
+}
+inline bool Message::has_reply() const {
+  return _internal_has_reply();
+}
+inline void Message::set_has_reply() {
+  _impl_._oneof_case_[0] = kReply;
+}
+inline void Message::clear_reply() {
+  if (_internal_has_reply()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.get_.reply_;
+    }
+    clear_has_get();
+  }
+}
+inline ::dsnet::hotstuff::proto::ReplyMessage* Message::release_reply() {
+  // @@protoc_insertion_point(field_release:dsnet.hotstuff.proto.Message.reply)
+  if (_internal_has_reply()) {
+    clear_has_get();
+    ::dsnet::hotstuff::proto::ReplyMessage* temp = _impl_.get_.reply_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.get_.reply_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::dsnet::hotstuff::proto::ReplyMessage& Message::_internal_reply() const {
+  return _internal_has_reply()
+      ? *_impl_.get_.reply_
+      : reinterpret_cast< ::dsnet::hotstuff::proto::ReplyMessage&>(::dsnet::hotstuff::proto::_ReplyMessage_default_instance_);
+}
+inline const ::dsnet::hotstuff::proto::ReplyMessage& Message::reply() const {
+  // @@protoc_insertion_point(field_get:dsnet.hotstuff.proto.Message.reply)
+  return _internal_reply();
+}
+inline ::dsnet::hotstuff::proto::ReplyMessage* Message::unsafe_arena_release_reply() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:dsnet.hotstuff.proto.Message.reply)
+  if (_internal_has_reply()) {
+    clear_has_get();
+    ::dsnet::hotstuff::proto::ReplyMessage* temp = _impl_.get_.reply_;
+    _impl_.get_.reply_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void Message::unsafe_arena_set_allocated_reply(::dsnet::hotstuff::proto::ReplyMessage* reply) {
+  clear_get();
+  if (reply) {
+    set_has_reply();
+    _impl_.get_.reply_ = reply;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:dsnet.hotstuff.proto.Message.reply)
+}
+inline ::dsnet::hotstuff::proto::ReplyMessage* Message::_internal_mutable_reply() {
+  if (!_internal_has_reply()) {
+    clear_get();
+    set_has_reply();
+    _impl_.get_.reply_ = CreateMaybeMessage< ::dsnet::hotstuff::proto::ReplyMessage >(GetArenaForAllocation());
+  }
+  return _impl_.get_.reply_;
+}
+inline ::dsnet::hotstuff::proto::ReplyMessage* Message::mutable_reply() {
+  ::dsnet::hotstuff::proto::ReplyMessage* _msg = _internal_mutable_reply();
+  // @@protoc_insertion_point(field_mutable:dsnet.hotstuff.proto.Message.reply)
+  return _msg;
+}
+
+// .dsnet.hotstuff.proto.GenericMessage generic = 3;
+inline bool Message::_internal_has_generic() const {
+  return get_case() == kGeneric;
+}
+inline bool Message::has_generic() const {
+  return _internal_has_generic();
+}
+inline void Message::set_has_generic() {
+  _impl_._oneof_case_[0] = kGeneric;
+}
+inline void Message::clear_generic() {
+  if (_internal_has_generic()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.get_.generic_;
+    }
+    clear_has_get();
+  }
+}
+inline ::dsnet::hotstuff::proto::GenericMessage* Message::release_generic() {
+  // @@protoc_insertion_point(field_release:dsnet.hotstuff.proto.Message.generic)
+  if (_internal_has_generic()) {
+    clear_has_get();
+    ::dsnet::hotstuff::proto::GenericMessage* temp = _impl_.get_.generic_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.get_.generic_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::dsnet::hotstuff::proto::GenericMessage& Message::_internal_generic() const {
+  return _internal_has_generic()
+      ? *_impl_.get_.generic_
+      : reinterpret_cast< ::dsnet::hotstuff::proto::GenericMessage&>(::dsnet::hotstuff::proto::_GenericMessage_default_instance_);
+}
+inline const ::dsnet::hotstuff::proto::GenericMessage& Message::generic() const {
+  // @@protoc_insertion_point(field_get:dsnet.hotstuff.proto.Message.generic)
+  return _internal_generic();
+}
+inline ::dsnet::hotstuff::proto::GenericMessage* Message::unsafe_arena_release_generic() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:dsnet.hotstuff.proto.Message.generic)
+  if (_internal_has_generic()) {
+    clear_has_get();
+    ::dsnet::hotstuff::proto::GenericMessage* temp = _impl_.get_.generic_;
+    _impl_.get_.generic_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void Message::unsafe_arena_set_allocated_generic(::dsnet::hotstuff::proto::GenericMessage* generic) {
+  clear_get();
+  if (generic) {
+    set_has_generic();
+    _impl_.get_.generic_ = generic;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:dsnet.hotstuff.proto.Message.generic)
+}
+inline ::dsnet::hotstuff::proto::GenericMessage* Message::_internal_mutable_generic() {
+  if (!_internal_has_generic()) {
+    clear_get();
+    set_has_generic();
+    _impl_.get_.generic_ = CreateMaybeMessage< ::dsnet::hotstuff::proto::GenericMessage >(GetArenaForAllocation());
+  }
+  return _impl_.get_.generic_;
+}
+inline ::dsnet::hotstuff::proto::GenericMessage* Message::mutable_generic() {
+  ::dsnet::hotstuff::proto::GenericMessage* _msg = _internal_mutable_generic();
+  // @@protoc_insertion_point(field_mutable:dsnet.hotstuff.proto.Message.generic)
+  return _msg;
+}
+
+// .dsnet.hotstuff.proto.VoteMessage vote = 4;
+inline bool Message::_internal_has_vote() const {
+  return get_case() == kVote;
+}
+inline bool Message::has_vote() const {
+  return _internal_has_vote();
+}
+inline void Message::set_has_vote() {
+  _impl_._oneof_case_[0] = kVote;
+}
+inline void Message::clear_vote() {
+  if (_internal_has_vote()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.get_.vote_;
+    }
+    clear_has_get();
+  }
+}
+inline ::dsnet::hotstuff::proto::VoteMessage* Message::release_vote() {
+  // @@protoc_insertion_point(field_release:dsnet.hotstuff.proto.Message.vote)
+  if (_internal_has_vote()) {
+    clear_has_get();
+    ::dsnet::hotstuff::proto::VoteMessage* temp = _impl_.get_.vote_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.get_.vote_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::dsnet::hotstuff::proto::VoteMessage& Message::_internal_vote() const {
+  return _internal_has_vote()
+      ? *_impl_.get_.vote_
+      : reinterpret_cast< ::dsnet::hotstuff::proto::VoteMessage&>(::dsnet::hotstuff::proto::_VoteMessage_default_instance_);
+}
+inline const ::dsnet::hotstuff::proto::VoteMessage& Message::vote() const {
+  // @@protoc_insertion_point(field_get:dsnet.hotstuff.proto.Message.vote)
+  return _internal_vote();
+}
+inline ::dsnet::hotstuff::proto::VoteMessage* Message::unsafe_arena_release_vote() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:dsnet.hotstuff.proto.Message.vote)
+  if (_internal_has_vote()) {
+    clear_has_get();
+    ::dsnet::hotstuff::proto::VoteMessage* temp = _impl_.get_.vote_;
+    _impl_.get_.vote_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void Message::unsafe_arena_set_allocated_vote(::dsnet::hotstuff::proto::VoteMessage* vote) {
+  clear_get();
+  if (vote) {
+    set_has_vote();
+    _impl_.get_.vote_ = vote;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:dsnet.hotstuff.proto.Message.vote)
+}
+inline ::dsnet::hotstuff::proto::VoteMessage* Message::_internal_mutable_vote() {
+  if (!_internal_has_vote()) {
+    clear_get();
+    set_has_vote();
+    _impl_.get_.vote_ = CreateMaybeMessage< ::dsnet::hotstuff::proto::VoteMessage >(GetArenaForAllocation());
+  }
+  return _impl_.get_.vote_;
+}
+inline ::dsnet::hotstuff::proto::VoteMessage* Message::mutable_vote() {
+  ::dsnet::hotstuff::proto::VoteMessage* _msg = _internal_mutable_vote();
+  // @@protoc_insertion_point(field_mutable:dsnet.hotstuff.proto.Message.vote)
+  return _msg;
+}
+
+// .dsnet.hotstuff.proto.Checkpoint checkpoint = 5;
+inline bool Message::_internal_has_checkpoint() const {
+  return get_case() == kCheckpoint;
+}
+inline bool Message::has_checkpoint() const {
+  return _internal_has_checkpoint();
+}
+inline void Message::set_has_checkpoint() {
+  _impl_._oneof_case_[0] = kCheckpoint;
+}
+inline void Message::clear_checkpoint() {
+  if (_internal_has_checkpoint()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.get_.checkpoint_;
+    }
+    clear_has_get();
+  }
+}
+inline ::dsnet::hotstuff::proto::Checkpoint* Message::release_checkpoint() {
+  // @@protoc_insertion_point(field_release:dsnet.hotstuff.proto.Message.checkpoint)
+  if (_internal_has_checkpoint()) {
+    clear_has_get();
+    ::dsnet::hotstuff::proto::Checkpoint* temp = _impl_.get_.checkpoint_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.get_.checkpoint_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::dsnet::hotstuff::proto::Checkpoint& Message::_internal_checkpoint() const {
+  return _internal_has_checkpoint()
+      ? *_impl_.get_.checkpoint_
+      : reinterpret_cast< ::dsnet::hotstuff::proto::Checkpoint&>(::dsnet::hotstuff::proto::_Checkpoint_default_instance_);
+}
+inline const ::dsnet::hotstuff::proto::Checkpoint& Message::checkpoint() const {
+  // @@protoc_insertion_point(field_get:dsnet.hotstuff.proto.Message.checkpoint)
+  return _internal_checkpoint();
+}
+inline ::dsnet::hotstuff::proto::Checkpoint* Message::unsafe_arena_release_checkpoint() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:dsnet.hotstuff.proto.Message.checkpoint)
+  if (_internal_has_checkpoint()) {
+    clear_has_get();
+    ::dsnet::hotstuff::proto::Checkpoint* temp = _impl_.get_.checkpoint_;
+    _impl_.get_.checkpoint_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void Message::unsafe_arena_set_allocated_checkpoint(::dsnet::hotstuff::proto::Checkpoint* checkpoint) {
+  clear_get();
+  if (checkpoint) {
+    set_has_checkpoint();
+    _impl_.get_.checkpoint_ = checkpoint;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:dsnet.hotstuff.proto.Message.checkpoint)
+}
+inline ::dsnet::hotstuff::proto::Checkpoint* Message::_internal_mutable_checkpoint() {
+  if (!_internal_has_checkpoint()) {
+    clear_get();
+    set_has_checkpoint();
+    _impl_.get_.checkpoint_ = CreateMaybeMessage< ::dsnet::hotstuff::proto::Checkpoint >(GetArenaForAllocation());
+  }
+  return _impl_.get_.checkpoint_;
+}
+inline ::dsnet::hotstuff::proto::Checkpoint* Message::mutable_checkpoint() {
+  ::dsnet::hotstuff::proto::Checkpoint* _msg = _internal_mutable_checkpoint();
+  // @@protoc_insertion_point(field_mutable:dsnet.hotstuff.proto.Message.checkpoint)
+  return _msg;
+}
+
+// .dsnet.hotstuff.proto.StateRequest state_request = 6;
+inline bool Message::_internal_has_state_request() const {
+  return get_case() == kStateRequest;
+}
+inline bool Message::has_state_request() const {
+  return _internal_has_state_request();
+}
+inline void Message::set_has_state_request() {
+  _impl_._oneof_case_[0] = kStateRequest;
+}
+inline void Message::clear_state_request() {
+  if (_internal_has_state_request()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.get_.state_request_;
+    }
+    clear_has_get();
+  }
+}
+inline ::dsnet::hotstuff::proto::StateRequest* Message::release_state_request() {
+  // @@protoc_insertion_point(field_release:dsnet.hotstuff.proto.Message.state_request)
+  if (_internal_has_state_request()) {
+    clear_has_get();
+    ::dsnet::hotstuff::proto::StateRequest* temp = _impl_.get_.state_request_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.get_.state_request_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::dsnet::hotstuff::proto::StateRequest& Message::_internal_state_request() const {
+  return _internal_has_state_request()
+      ? *_impl_.get_.state_request_
+      : reinterpret_cast< ::dsnet::hotstuff::proto::StateRequest&>(::dsnet::hotstuff::proto::_StateRequest_default_instance_);
+}
+inline const ::dsnet::hotstuff::proto::StateRequest& Message::state_request() const {
+  // @@protoc_insertion_point(field_get:dsnet.hotstuff.proto.Message.state_request)
+  return _internal_state_request();
+}
+inline ::dsnet::hotstuff::proto::StateRequest* Message::unsafe_arena_release_state_request() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:dsnet.hotstuff.proto.Message.state_request)
+  if (_internal_has_state_request()) {
+    clear_has_get();
+    ::dsnet::hotstuff::proto::StateRequest* temp = _impl_.get_.state_request_;
+    _impl_.get_.state_request_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void Message::unsafe_arena_set_allocated_state_request(::dsnet::hotstuff::proto::StateRequest* state_request) {
+  clear_get();
+  if (state_request) {
+    set_has_state_request();
+    _impl_.get_.state_request_ = state_request;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:dsnet.hotstuff.proto.Message.state_request)
+}
+inline ::dsnet::hotstuff::proto::StateRequest* Message::_internal_mutable_state_request() {
+  if (!_internal_has_state_request()) {
+    clear_get();
+    set_has_state_request();
+    _impl_.get_.state_request_ = CreateMaybeMessage< ::dsnet::hotstuff::proto::StateRequest >(GetArenaForAllocation());
+  }
+  return _impl_.get_.state_request_;
+}
+inline ::dsnet::hotstuff::proto::StateRequest* Message::mutable_state_request() {
+  ::dsnet::hotstuff::proto::StateRequest* _msg = _internal_mutable_state_request();
+  // @@protoc_insertion_point(field_mutable:dsnet.hotstuff.proto.Message.state_request)
+  return _msg;
+}
+
+// .dsnet.hotstuff.proto.StateChunk state_chunk = 7;
+inline bool Message::_internal_has_state_chunk() const {
+  return get_case() == kStateChunk;
+}
+inline bool Message::has_state_chunk() const {
+  return _internal_has_state_chunk();
+}
+inline void Message::set_has_state_chunk() {
+  _impl_._oneof_case_[0] = kStateChunk;
+}
+inline void Message::clear_state_chunk() {
+  if (_internal_has_state_chunk()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.get_.state_chunk_;
+    }
+    clear_has_get();
+  }
+}
+inline ::dsnet::hotstuff::proto::StateChunk* Message::release_state_chunk() {
+  // @@protoc_insertion_point(field_release:dsnet.hotstuff.proto.Message.state_chunk)
+  if (_internal_has_state_chunk()) {
+    clear_has_get();
+    ::dsnet::hotstuff::proto::StateChunk* temp = _impl_.get_.state_chunk_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.get_.state_chunk_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::dsnet::hotstuff::proto::StateChunk& Message::_internal_state_chunk() const {
+  return _internal_has_state_chunk()
+      ? *_impl_.get_.state_chunk_
+      : reinterpret_cast< ::dsnet::hotstuff::proto::StateChunk&>(::dsnet::hotstuff::proto::_StateChunk_default_instance_);
+}
+inline const ::dsnet::hotstuff::proto::StateChunk& Message::state_chunk() const {
+  // @@protoc_insertion_point(field_get:dsnet.hotstuff.proto.Message.state_chunk)
+  return _internal_state_chunk();
+}
+inline ::dsnet::hotstuff::proto::StateChunk* Message::unsafe_arena_release_state_chunk() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:dsnet.hotstuff.proto.Message.state_chunk)
+  if (_internal_has_state_chunk()) {
+    clear_has_get();
+    ::dsnet::hotstuff::proto::StateChunk* temp = _impl_.get_.state_chunk_;
+    _impl_.get_.state_chunk_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void Message::unsafe_arena_set_allocated_state_chunk(::dsnet::hotstuff::proto::StateChunk* state_chunk) {
+  clear_get();
+  if (state_chunk) {
+    set_has_state_chunk();
+    _impl_.get_.state_chunk_ = state_chunk;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:dsnet.hotstuff.proto.Message.state_chunk)
+}
+inline ::dsnet::hotstuff::proto::StateChunk* Message::_internal_mutable_state_chunk() {
+  if (!_internal_has_state_chunk()) {
+    clear_get();
+    set_has_state_chunk();
+    _impl_.get_.state_chunk_ = CreateMaybeMessage< ::dsnet::hotstuff::proto::StateChunk >(GetArenaForAllocation());
+  }
+  return _impl_.get_.state_chunk_;
+}
+inline ::dsnet::hotstuff::proto::StateChunk* Message::mutable_state_chunk() {
+  ::dsnet::hotstuff::proto::StateChunk* _msg = _internal_mutable_state_chunk();
+  // @@protoc_insertion_point(field_mutable:dsnet.hotstuff.proto.Message.state_chunk)
+  return _msg;
+}
+
+// .dsnet.hotstuff.proto.NonceMessage nonce = 8;
+inline bool Message::_internal_has_nonce() const {
+  return get_case() == kNonce;
+}
+inline bool Message::has_nonce() const {
+  return _internal_has_nonce();
+}
+inline void Message::set_has_nonce() {
+  _impl_._oneof_case_[0] = kNonce;
+}
+inline void Message::clear_nonce() {
+  if (_internal_has_nonce()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.get_.nonce_;
+    }
+    clear_has_get();
+  }
+}
+inline ::dsnet::hotstuff::proto::NonceMessage* Message::release_nonce() {
+  // @@protoc_insertion_point(field_release:dsnet.hotstuff.proto.Message.nonce)
+  if (_internal_has_nonce()) {
+    clear_has_get();
+    ::dsnet::hotstuff::proto::NonceMessage* temp = _impl_.get_.nonce_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.get_.nonce_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::dsnet::hotstuff::proto::NonceMessage& Message::_internal_nonce() const {
+  return _internal_has_nonce()
+      ? *_impl_.get_.nonce_
+      : reinterpret_cast< ::dsnet::hotstuff::proto::NonceMessage&>(::dsnet::hotstuff::proto::_NonceMessage_default_instance_);
+}
+inline const ::dsnet::hotstuff::proto::NonceMessage& Message::nonce() const {
+  // @@protoc_insertion_point(field_get:dsnet.hotstuff.proto.Message.nonce)
+  return _internal_nonce();
+}
+inline ::dsnet::hotstuff::proto::NonceMessage* Message::unsafe_arena_release_nonce() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:dsnet.hotstuff.proto.Message.nonce)
+  if (_internal_has_nonce()) {
+    clear_has_get();
+    ::dsnet::hotstuff::proto::NonceMessage* temp = _impl_.get_.nonce_;
+    _impl_.get_.nonce_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void Message::unsafe_arena_set_allocated_nonce(::dsnet::hotstuff::proto::NonceMessage* nonce) {
+  clear_get();
+  if (nonce) {
+    set_has_nonce();
+    _impl_.get_.nonce_ = nonce;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:dsnet.hotstuff.proto.Message.nonce)
+}
+inline ::dsnet::hotstuff::proto::NonceMessage* Message::_internal_mutable_nonce() {
+  if (!_internal_has_nonce()) {
+    clear_get();
+    set_has_nonce();
+    _impl_.get_.nonce_ = CreateMaybeMessage< ::dsnet::hotstuff::proto::NonceMessage >(GetArenaForAllocation());
+  }
+  return _impl_.get_.nonce_;
+}
+inline ::dsnet::hotstuff::proto::NonceMessage* Message::mutable_nonce() {
+  ::dsnet::hotstuff::proto::NonceMessage* _msg = _internal_mutable_nonce();
+  // @@protoc_insertion_point(field_mutable:dsnet.hotstuff.proto.Message.nonce)
+  return _msg;
+}
+
+inline bool Message::has_get() const {
+  return get_case() != GET_NOT_SET;
+}
+inline void Message::clear_has_get() {
+  _impl_._oneof_case_[0] = GET_NOT_SET;
+}
+inline Message::GetCase Message::get_case() const {
+  return Message::GetCase(_impl_._oneof_case_[0]);
+}
+// -------------------------------------------------------------------
+
+// ReplyMessage
+
+// uint32 client_request = 1;
+inline void ReplyMessage::clear_client_request() {
+  _impl_.client_request_ = 0u;
+}
+inline uint32_t ReplyMessage::_internal_client_request() const {
+  return _impl_.client_request_;
+}
+inline uint32_t ReplyMessage::client_request() const {
+  // @@protoc_insertion_point(field_get:dsnet.hotstuff.proto.ReplyMessage.client_request)
+  return _internal_client_request();
+}
+inline void ReplyMessage::_internal_set_client_request(uint32_t value) {
+  
+  _impl_.client_request_ = value;
+}
+inline void ReplyMessage::set_client_request(uint32_t value) {
+  _internal_set_client_request(value);
+  // @@protoc_insertion_point(field_set:dsnet.hotstuff.proto.ReplyMessage.client_request)
+}
+
+// bytes result = 2;
+inline void ReplyMessage::clear_result() {
+  _impl_.result_.ClearToEmpty();
+}
+inline const std::string& ReplyMessage::result() const {
+  // @@protoc_insertion_point(field_get:dsnet.hotstuff.proto.ReplyMessage.result)
+  return _internal_result();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void ReplyMessage::set_result(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.result_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:dsnet.hotstuff.proto.ReplyMessage.result)
+}
+inline std::string* ReplyMessage::mutable_result() {
+  std::string* _s = _internal_mutable_result();
+  // @@protoc_insertion_point(field_mutable:dsnet.hotstuff.proto.ReplyMessage.result)
+  return _s;
+}
+inline const std::string& ReplyMessage::_internal_result() const {
+  return _impl_.result_.Get();
+}
+inline void ReplyMessage::_internal_set_result(const std::string& value) {
+  
+  _impl_.result_.Set(value, GetArenaForAllocation());
+}
+inline std::string* ReplyMessage::_internal_mutable_result() {
+  
+  return _impl_.result_.Mutable(GetArenaForAllocation());
+}
+inline std::string* ReplyMessage::release_result() {
+  // @@protoc_insertion_point(field_release:dsnet.hotstuff.proto.ReplyMessage.result)
+  return _impl_.result_.Release();
+}
+inline void ReplyMessage::set_allocated_result(std::string* result) {
+  if (result != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.result_.SetAllocated(result, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.result_.IsDefault()) {
+    _impl_.result_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:dsnet.hotstuff.proto.ReplyMessage.result)
+}
+
+// int32 replica_index = 3;
+inline void ReplyMessage::clear_replica_index() {
+  _impl_.replica_index_ = 0;
+}
+inline int32_t ReplyMessage::_internal_replica_index() const {
+  return _impl_.replica_index_;
+}
+inline int32_t ReplyMessage::replica_index() const {
+  // @@protoc_insertion_point(field_get:dsnet.hotstuff.proto.ReplyMessage.replica_index)
+  return _internal_replica_index();
+}
+inline void ReplyMessage::_internal_set_replica_index(int32_t value) {
+  
+  _impl_.replica_index_ = value;
+}
+inline void ReplyMessage::set_replica_index(int32_t value) {
+  _internal_set_replica_index(value);
+  // @@protoc_insertion_point(field_set:dsnet.hotstuff.proto.ReplyMessage.replica_index)
+}
+
+// -------------------------------------------------------------------
+
+// GenericMessage
+
+// .dsnet.hotstuff.proto.Block block = 1;
+inline bool GenericMessage::_internal_has_block() const {
+  return this != internal_default_instance() && _impl_.block_ != nullptr;
+}
+inline bool GenericMessage::has_block() const {
+  return _internal_has_block();
+}
+inline void GenericMessage::clear_block() {
+  if (GetArenaForAllocation() == nullptr && _impl_.block_ != nullptr) {
+    delete _impl_.block_;
+  }
+  _impl_.block_ = nullptr;
+}
+inline const ::dsnet::hotstuff::proto::Block& GenericMessage::_internal_block() const {
+  const ::dsnet::hotstuff::proto::Block* p = _impl_.block_;
+  return p != nullptr ? *p : reinterpret_cast<const ::dsnet::hotstuff::proto::Block&>(
+      ::dsnet::hotstuff::proto::_Block_default_instance_);
+}
+inline const ::dsnet::hotstuff::proto::Block& GenericMessage::block() const {
+  // @@protoc_insertion_point(field_get:dsnet.hotstuff.proto.GenericMessage.block)
+  return _internal_block();
+}
+inline void GenericMessage::unsafe_arena_set_allocated_block(
+    ::dsnet::hotstuff::proto::Block* block) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.block_);
+  }
+  _impl_.block_ = block;
+  if (block) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:dsnet.hotstuff.proto.GenericMessage.block)
+}
+inline ::dsnet::hotstuff::proto::Block* GenericMessage::release_block() {
+  
+  ::dsnet::hotstuff::proto::Block* temp = _impl_.block_;
+  _impl_.block_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::dsnet::hotstuff::proto::Block* GenericMessage::unsafe_arena_release_block() {
+  // @@protoc_insertion_point(field_release:dsnet.hotstuff.proto.GenericMessage.block)
+  
+  ::dsnet::hotstuff::proto::Block* temp = _impl_.block_;
+  _impl_.block_ = nullptr;
+  return temp;
+}
+inline ::dsnet::hotstuff::proto::Block* GenericMessage::_internal_mutable_block() {
+  
+  if (_impl_.block_ == nullptr) {
+    auto* p = CreateMaybeMessage<::dsnet::hotstuff::proto::Block>(GetArenaForAllocation());
+    _impl_.block_ = p;
+  }
+  return _impl_.block_;
+}
+inline ::dsnet::hotstuff::proto::Block* GenericMessage::mutable_block() {
+  ::dsnet::hotstuff::proto::Block* _msg = _internal_mutable_block();
+  // @@protoc_insertion_point(field_mutable:dsnet.hotstuff.proto.GenericMessage.block)
+  return _msg;
+}
+inline void GenericMessage::set_allocated_block(::dsnet::hotstuff::proto::Block* block) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.block_;
+  }
+  if (block) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(block);
+    if (message_arena != submessage_arena) {
+      block = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, block, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.block_ = block;
+  // @@protoc_insertion_point(field_set_allocated:dsnet.hotstuff.proto.GenericMessage.block)
+}
+
+// -------------------------------------------------------------------
+
+// VoteMessage
+
+// int32 replica_index = 1;
+inline void VoteMessage::clear_replica_index() {
+  _impl_.replica_index_ = 0;
+}
+inline int32_t VoteMessage::_internal_replica_index() const {
+  return _impl_.replica_index_;
+}
+inline int32_t VoteMessage::replica_index() const {
+  // @@protoc_insertion_point(field_get:dsnet.hotstuff.proto.VoteMessage.replica_index)
+  return _internal_replica_index();
+}
+inline void VoteMessage::_internal_set_replica_index(int32_t value) {
+  
+  _impl_.replica_index_ = value;
+}
+inline void VoteMessage::set_replica_index(int32_t value) {
+  _internal_set_replica_index(value);
+  // @@protoc_insertion_point(field_set:dsnet.hotstuff.proto.VoteMessage.replica_index)
+}
+
+// uint64 op_number = 2;
+inline void VoteMessage::clear_op_number() {
+  _impl_.op_number_ = uint64_t{0u};
+}
+inline uint64_t VoteMessage::_internal_op_number() const {
+  return _impl_.op_number_;
+}
+inline uint64_t VoteMessage::op_number() const {
+  // @@protoc_insertion_point(field_get:dsnet.hotstuff.proto.VoteMessage.op_number)
+  return _internal_op_number();
+}
+inline void VoteMessage::_internal_set_op_number(uint64_t value) {
+  
+  _impl_.op_number_ = value;
+}
+inline void VoteMessage::set_op_number(uint64_t value) {
+  _internal_set_op_number(value);
+  // @@protoc_insertion_point(field_set:dsnet.hotstuff.proto.VoteMessage.op_number)
+}
+
+// bytes partial_signature = 3;
+inline void VoteMessage::clear_partial_signature() {
+  _impl_.partial_signature_.ClearToEmpty();
+}
+inline const std::string& VoteMessage::partial_signature() const {
+  // @@protoc_insertion_point(field_get:dsnet.hotstuff.proto.VoteMessage.partial_signature)
+  return _internal_partial_signature();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void VoteMessage::set_partial_signature(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.partial_signature_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:dsnet.hotstuff.proto.VoteMessage.partial_signature)
+}
+inline std::string* VoteMessage::mutable_partial_signature() {
+  std::string* _s = _internal_mutable_partial_signature();
+  // @@protoc_insertion_point(field_mutable:dsnet.hotstuff.proto.VoteMessage.partial_signature)
+  return _s;
+}
+inline const std::string& VoteMessage::_internal_partial_signature() const {
+  return _impl_.partial_signature_.Get();
+}
+inline void VoteMessage::_internal_set_partial_signature(const std::string& value) {
+  
+  _impl_.partial_signature_.Set(value, GetArenaForAllocation());
+}
+inline std::string* VoteMessage::_internal_mutable_partial_signature() {
+  
+  return _impl_.partial_signature_.Mutable(GetArenaForAllocation());
+}
+inline std::string* VoteMessage::release_partial_signature() {
+  // @@protoc_insertion_point(field_release:dsnet.hotstuff.proto.VoteMessage.partial_signature)
+  return _impl_.partial_signature_.Release();
+}
+inline void VoteMessage::set_allocated_partial_signature(std::string* partial_signature) {
+  if (partial_signature != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.partial_signature_.SetAllocated(partial_signature, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.partial_signature_.IsDefault()) {
+    _impl_.partial_signature_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:dsnet.hotstuff.proto.VoteMessage.partial_signature)
+}
+
+// uint64 nonce_seq = 4;
+inline void VoteMessage::clear_nonce_seq() {
+  _impl_.nonce_seq_ = uint64_t{0u};
+}
+inline uint64_t VoteMessage::_internal_nonce_seq() const {
+  return _impl_.nonce_seq_;
+}
+inline uint64_t VoteMessage::nonce_seq() const {
+  // @@protoc_insertion_point(field_get:dsnet.hotstuff.proto.VoteMessage.nonce_seq)
+  return _internal_nonce_seq();
+}
+inline void VoteMessage::_internal_set_nonce_seq(uint64_t value) {
+  
+  _impl_.nonce_seq_ = value;
+}
+inline void VoteMessage::set_nonce_seq(uint64_t value) {
+  _internal_set_nonce_seq(value);
+  // @@protoc_insertion_point(field_set:dsnet.hotstuff.proto.VoteMessage.nonce_seq)
+}
+
+// bytes nonce = 5;
+inline void VoteMessage::clear_nonce() {
+  _impl_.nonce_.ClearToEmpty();
+}
+inline const std::string& VoteMessage::nonce() const {
+  // @@protoc_insertion_point(field_get:dsnet.hotstuff.proto.VoteMessage.nonce)
+  return _internal_nonce();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void VoteMessage::set_nonce(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.nonce_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:dsnet.hotstuff.proto.VoteMessage.nonce)
+}
+inline std::string* VoteMessage::mutable_nonce() {
+  std::string* _s = _internal_mutable_nonce();
+  // @@protoc_insertion_point(field_mutable:dsnet.hotstuff.proto.VoteMessage.nonce)
+  return _s;
+}
+inline const std::string& VoteMessage::_internal_nonce() const {
+  return _impl_.nonce_.Get();
+}
+inline void VoteMessage::_internal_set_nonce(const std::string& value) {
+  
+  _impl_.nonce_.Set(value, GetArenaForAllocation());
+}
+inline std::string* VoteMessage::_internal_mutable_nonce() {
+  
+  return _impl_.nonce_.Mutable(GetArenaForAllocation());
+}
+inline std::string* VoteMessage::release_nonce() {
+  // @@protoc_insertion_point(field_release:dsnet.hotstuff.proto.VoteMessage.nonce)
+  return _impl_.nonce_.Release();
+}
+inline void VoteMessage::set_allocated_nonce(std::string* nonce) {
+  if (nonce != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.nonce_.SetAllocated(nonce, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.nonce_.IsDefault()) {
+    _impl_.nonce_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:dsnet.hotstuff.proto.VoteMessage.nonce)
+}
+
+// -------------------------------------------------------------------
+
+// NonceMessage
+
+// int32 replica_index = 1;
+inline void NonceMessage::clear_replica_index() {
+  _impl_.replica_index_ = 0;
+}
+inline int32_t NonceMessage::_internal_replica_index() const {
+  return _impl_.replica_index_;
+}
+inline int32_t NonceMessage::replica_index() const {
+  // @@protoc_insertion_point(field_get:dsnet.hotstuff.proto.NonceMessage.replica_index)
+  return _internal_replica_index();
+}
+inline void NonceMessage::_internal_set_replica_index(int32_t value) {
+  
+  _impl_.replica_index_ = value;
+}
+inline void NonceMessage::set_replica_index(int32_t value) {
+  _internal_set_replica_index(value);
+  // @@protoc_insertion_point(field_set:dsnet.hotstuff.proto.NonceMessage.replica_index)
+}
+
+// uint64 nonce_seq = 2;
+inline void NonceMessage::clear_nonce_seq() {
+  _impl_.nonce_seq_ = uint64_t{0u};
+}
+inline uint64_t NonceMessage::_internal_nonce_seq() const {
+  return _impl_.nonce_seq_;
+}
+inline uint64_t NonceMessage::nonce_seq() const {
+  // @@protoc_insertion_point(field_get:dsnet.hotstuff.proto.NonceMessage.nonce_seq)
+  return _internal_nonce_seq();
+}
+inline void NonceMessage::_internal_set_nonce_seq(uint64_t value) {
+  
+  _impl_.nonce_seq_ = value;
+}
+inline void NonceMessage::set_nonce_seq(uint64_t value) {
+  _internal_set_nonce_seq(value);
+  // @@protoc_insertion_point(field_set:dsnet.hotstuff.proto.NonceMessage.nonce_seq)
+}
+
+// repeated bytes nonce = 3;
+inline int NonceMessage::_internal_nonce_size() const {
+  return _impl_.nonce_.size();
+}
+inline int NonceMessage::nonce_size() const {
+  return _internal_nonce_size();
+}
+inline void NonceMessage::clear_nonce() {
+  _impl_.nonce_.Clear();
+}
+inline std::string* NonceMessage::add_nonce() {
+  std::string* _s = _internal_add_nonce();
+  // @@protoc_insertion_point(field_add_mutable:dsnet.hotstuff.proto.NonceMessage.nonce)
+  return _s;
+}
+inline const std::string& NonceMessage::_internal_nonce(int index) const {
+  return _impl_.nonce_.Get(index);
+}
+inline const std::string& NonceMessage::nonce(int index) const {
+  // @@protoc_insertion_point(field_get:dsnet.hotstuff.proto.NonceMessage.nonce)
+  return _internal_nonce(index);
+}
+inline std::string* NonceMessage::mutable_nonce(int index) {
+  // @@protoc_insertion_point(field_mutable:dsnet.hotstuff.proto.NonceMessage.nonce)
+  return _impl_.nonce_.Mutable(index);
+}
+inline void NonceMessage::set_nonce(int index, const std::string& value) {
+  _impl_.nonce_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set:dsnet.hotstuff.proto.NonceMessage.nonce)
+}
+inline void NonceMessage::set_nonce(int index, std::string&& value) {
+  _impl_.nonce_.Mutable(index)->assign(std::move(value));
+  // @@protoc_insertion_point(field_set:dsnet.hotstuff.proto.NonceMessage.nonce)
+}
+inline void NonceMessage::set_nonce(int index, const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.nonce_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set_char:dsnet.hotstuff.proto.NonceMessage.nonce)
+}
+inline void NonceMessage::set_nonce(int index, const void* value, size_t size) {
+  _impl_.nonce_.Mutable(index)->assign(
+    reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_set_pointer:dsnet.hotstuff.proto.NonceMessage.nonce)
+}
+inline std::string* NonceMessage::_internal_add_nonce() {
+  return _impl_.nonce_.Add();
+}
+inline void NonceMessage::add_nonce(const std::string& value) {
+  _impl_.nonce_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add:dsnet.hotstuff.proto.NonceMessage.nonce)
+}
+inline void NonceMessage::add_nonce(std::string&& value) {
+  _impl_.nonce_.Add(std::move(value));
+  // @@protoc_insertion_point(field_add:dsnet.hotstuff.proto.NonceMessage.nonce)
+}
+inline void NonceMessage::add_nonce(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.nonce_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add_char:dsnet.hotstuff.proto.NonceMessage.nonce)
+}
+inline void NonceMessage::add_nonce(const void* value, size_t size) {
+  _impl_.nonce_.Add()->assign(reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_add_pointer:dsnet.hotstuff.proto.NonceMessage.nonce)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>&
+NonceMessage::nonce() const {
+  // @@protoc_insertion_point(field_list:dsnet.hotstuff.proto.NonceMessage.nonce)
+  return _impl_.nonce_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>*
+NonceMessage::mutable_nonce() {
+  // @@protoc_insertion_point(field_mutable_list:dsnet.hotstuff.proto.NonceMessage.nonce)
+  return &_impl_.nonce_;
+}
+
+// -------------------------------------------------------------------
+
+// Block
+
+// uint64 op_number = 1;
+inline void Block::clear_op_number() {
+  _impl_.op_number_ = uint64_t{0u};
+}
+inline uint64_t Block::_internal_op_number() const {
+  return _impl_.op_number_;
+}
+inline uint64_t Block::op_number() const {
+  // @@protoc_insertion_point(field_get:dsnet.hotstuff.proto.Block.op_number)
+  return _internal_op_number();
+}
+inline void Block::_internal_set_op_number(uint64_t value) {
+  
+  _impl_.op_number_ = value;
+}
+inline void Block::set_op_number(uint64_t value) {
+  _internal_set_op_number(value);
+  // @@protoc_insertion_point(field_set:dsnet.hotstuff.proto.Block.op_number)
+}
+
+// repeated .dsnet.Request request = 2;
+inline int Block::_internal_request_size() const {
+  return _impl_.request_.size();
+}
+inline int Block::request_size() const {
+  return _internal_request_size();
+}
+inline ::dsnet::Request* Block::mutable_request(int index) {
+  // @@protoc_insertion_point(field_mutable:dsnet.hotstuff.proto.Block.request)
+  return _impl_.request_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::dsnet::Request >*
+Block::mutable_request() {
+  // @@protoc_insertion_point(field_mutable_list:dsnet.hotstuff.proto.Block.request)
+  return &_impl_.request_;
+}
+inline const ::dsnet::Request& Block::_internal_request(int index) const {
+  return _impl_.request_.Get(index);
+}
+inline const ::dsnet::Request& Block::request(int index) const {
+  // @@protoc_insertion_point(field_get:dsnet.hotstuff.proto.Block.request)
+  return _internal_request(index);
+}
+inline ::dsnet::Request* Block::_internal_add_request() {
+  return _impl_.request_.Add();
+}
+inline ::dsnet::Request* Block::add_request() {
+  ::dsnet::Request* _add = _internal_add_request();
+  // @@protoc_insertion_point(field_add:dsnet.hotstuff.proto.Block.request)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::dsnet::Request >&
+Block::request() const {
+  // @@protoc_insertion_point(field_list:dsnet.hotstuff.proto.Block.request)
+  return _impl_.request_;
+}
+
+// .dsnet.hotstuff.proto.QC justify = 3;
+inline bool Block::_internal_has_justify() const {
+  return this != internal_default_instance() && _impl_.justify_ != nullptr;
+}
+inline bool Block::has_justify() const {
+  return _internal_has_justify();
+}
+inline void Block::clear_justify() {
+  if (GetArenaForAllocation() == nullptr && _impl_.justify_ != nullptr) {
+    delete _impl_.justify_;
+  }
+  _impl_.justify_ = nullptr;
+}
+inline const ::dsnet::hotstuff::proto::QC& Block::_internal_justify() const {
+  const ::dsnet::hotstuff::proto::QC* p = _impl_.justify_;
+  return p != nullptr ? *p : reinterpret_cast<const ::dsnet::hotstuff::proto::QC&>(
+      ::dsnet::hotstuff::proto::_QC_default_instance_);
+}
+inline const ::dsnet::hotstuff::proto::QC& Block::justify() const {
+  // @@protoc_insertion_point(field_get:dsnet.hotstuff.proto.Block.justify)
+  return _internal_justify();
+}
+inline void Block::unsafe_arena_set_allocated_justify(
+    ::dsnet::hotstuff::proto::QC* justify) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.justify_);
+  }
+  _impl_.justify_ = justify;
+  if (justify) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:dsnet.hotstuff.proto.Block.justify)
+}
+inline ::dsnet::hotstuff::proto::QC* Block::release_justify() {
+  
+  ::dsnet::hotstuff::proto::QC* temp = _impl_.justify_;
+  _impl_.justify_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::dsnet::hotstuff::proto::QC* Block::unsafe_arena_release_justify() {
+  // @@protoc_insertion_point(field_release:dsnet.hotstuff.proto.Block.justify)
+  
+  ::dsnet::hotstuff::proto::QC* temp = _impl_.justify_;
+  _impl_.justify_ = nullptr;
+  return temp;
+}
+inline ::dsnet::hotstuff::proto::QC* Block::_internal_mutable_justify() {
+  
+  if (_impl_.justify_ == nullptr) {
+    auto* p = CreateMaybeMessage<::dsnet::hotstuff::proto::QC>(GetArenaForAllocation());
+    _impl_.justify_ = p;
+  }
+  return _impl_.justify_;
+}
+inline ::dsnet::hotstuff::proto::QC* Block::mutable_justify() {
+  ::dsnet::hotstuff::proto::QC* _msg = _internal_mutable_justify();
+  // @@protoc_insertion_point(field_mutable:dsnet.hotstuff.proto.Block.justify)
+  return _msg;
+}
+inline void Block::set_allocated_justify(::dsnet::hotstuff::proto::QC* justify) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.justify_;
+  }
+  if (justify) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(justify);
+    if (message_arena != submessage_arena) {
+      justify = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, justify, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.justify_ = justify;
+  // @@protoc_insertion_point(field_set_allocated:dsnet.hotstuff.proto.Block.justify)
+}
+
+// uint64 signers = 4;
+inline void Block::clear_signers() {
+  _impl_.signers_ = uint64_t{0u};
+}
+inline uint64_t Block::_internal_signers() const {
+  return _impl_.signers_;
+}
+inline uint64_t Block::signers() const {
+  // @@protoc_insertion_point(field_get:dsnet.hotstuff.proto.Block.signers)
+  return _internal_signers();
+}
+inline void Block::_internal_set_signers(uint64_t value) {
+  
+  _impl_.signers_ = value;
+}
+inline void Block::set_signers(uint64_t value) {
+  _internal_set_signers(value);
+  // @@protoc_insertion_point(field_set:dsnet.hotstuff.proto.Block.signers)
+}
+
+// repeated uint64 nonce_seq = 5;
+inline int Block::_internal_nonce_seq_size() const {
+  return _impl_.nonce_seq_.size();
+}
+inline int Block::nonce_seq_size() const {
+  return _internal_nonce_seq_size();
+}
+inline void Block::clear_nonce_seq() {
+  _impl_.nonce_seq_.Clear();
+}
+inline uint64_t Block::_internal_nonce_seq(int index) const {
+  return _impl_.nonce_seq_.Get(index);
+}
+inline uint64_t Block::nonce_seq(int index) const {
+  // @@protoc_insertion_point(field_get:dsnet.hotstuff.proto.Block.nonce_seq)
+  return _internal_nonce_seq(index);
+}
+inline void Block::set_nonce_seq(int index, uint64_t value) {
+  _impl_.nonce_seq_.Set(index, value);
+  // @@protoc_insertion_point(field_set:dsnet.hotstuff.proto.Block.nonce_seq)
+}
+inline void Block::_internal_add_nonce_seq(uint64_t value) {
+  _impl_.nonce_seq_.Add(value);
+}
+inline void Block::add_nonce_seq(uint64_t value) {
+  _internal_add_nonce_seq(value);
+  // @@protoc_insertion_point(field_add:dsnet.hotstuff.proto.Block.nonce_seq)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >&
+Block::_internal_nonce_seq() const {
+  return _impl_.nonce_seq_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >&
+Block::nonce_seq() const {
+  // @@protoc_insertion_point(field_list:dsnet.hotstuff.proto.Block.nonce_seq)
+  return _internal_nonce_seq();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >*
+Block::_internal_mutable_nonce_seq() {
+  return &_impl_.nonce_seq_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >*
+Block::mutable_nonce_seq() {
+  // @@protoc_insertion_point(field_mutable_list:dsnet.hotstuff.proto.Block.nonce_seq)
+  return _internal_mutable_nonce_seq();
+}
+
+// bytes aggregate_nonce = 6;
+inline void Block::clear_aggregate_nonce() {
+  _impl_.aggregate_nonce_.ClearToEmpty();
+}
+inline const std::string& Block::aggregate_nonce() const {
+  // @@protoc_insertion_point(field_get:dsnet.hotstuff.proto.Block.aggregate_nonce)
+  return _internal_aggregate_nonce();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void Block::set_aggregate_nonce(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.aggregate_nonce_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:dsnet.hotstuff.proto.Block.aggregate_nonce)
+}
+inline std::string* Block::mutable_aggregate_nonce() {
+  std::string* _s = _internal_mutable_aggregate_nonce();
+  // @@protoc_insertion_point(field_mutable:dsnet.hotstuff.proto.Block.aggregate_nonce)
+  return _s;
+}
+inline const std::string& Block::_internal_aggregate_nonce() const {
+  return _impl_.aggregate_nonce_.Get();
+}
+inline void Block::_internal_set_aggregate_nonce(const std::string& value) {
+  
+  _impl_.aggregate_nonce_.Set(value, GetArenaForAllocation());
+}
+inline std::string* Block::_internal_mutable_aggregate_nonce() {
+  
+  return _impl_.aggregate_nonce_.Mutable(GetArenaForAllocation());
+}
+inline std::string* Block::release_aggregate_nonce() {
+  // @@protoc_insertion_point(field_release:dsnet.hotstuff.proto.Block.aggregate_nonce)
+  return _impl_.aggregate_nonce_.Release();
+}
+inline void Block::set_allocated_aggregate_nonce(std::string* aggregate_nonce) {
+  if (aggregate_nonce != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.aggregate_nonce_.SetAllocated(aggregate_nonce, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.aggregate_nonce_.IsDefault()) {
+    _impl_.aggregate_nonce_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:dsnet.hotstuff.proto.Block.aggregate_nonce)
+}
+
+// -------------------------------------------------------------------
+
+// QC
+
+// uint64 op_number = 1;
+inline void QC::clear_op_number() {
+  _impl_.op_number_ = uint64_t{0u};
+}
+inline uint64_t QC::_internal_op_number() const {
+  return _impl_.op_number_;
+}
+inline uint64_t QC::op_number() const {
+  // @@protoc_insertion_point(field_get:dsnet.hotstuff.proto.QC.op_number)
+  return _internal_op_number();
+}
+inline void QC::_internal_set_op_number(uint64_t value) {
+  
+  _impl_.op_number_ = value;
+}
+inline void QC::set_op_number(uint64_t value) {
+  _internal_set_op_number(value);
+  // @@protoc_insertion_point(field_set:dsnet.hotstuff.proto.QC.op_number)
+}
+
+// repeated bytes signed_vote = 2;
+inline int QC::_internal_signed_vote_size() const {
+  return _impl_.signed_vote_.size();
+}
+inline int QC::signed_vote_size() const {
+  return _internal_signed_vote_size();
+}
+inline void QC::clear_signed_vote() {
+  _impl_.signed_vote_.Clear();
+}
+inline std::string* QC::add_signed_vote() {
+  std::string* _s = _internal_add_signed_vote();
+  // @@protoc_insertion_point(field_add_mutable:dsnet.hotstuff.proto.QC.signed_vote)
+  return _s;
+}
+inline const std::string& QC::_internal_signed_vote(int index) const {
+  return _impl_.signed_vote_.Get(index);
+}
+inline const std::string& QC::signed_vote(int index) const {
+  // @@protoc_insertion_point(field_get:dsnet.hotstuff.proto.QC.signed_vote)
+  return _internal_signed_vote(index);
+}
+inline std::string* QC::mutable_signed_vote(int index) {
+  // @@protoc_insertion_point(field_mutable:dsnet.hotstuff.proto.QC.signed_vote)
+  return _impl_.signed_vote_.Mutable(index);
+}
+inline void QC::set_signed_vote(int index, const std::string& value) {
+  _impl_.signed_vote_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set:dsnet.hotstuff.proto.QC.signed_vote)
+}
+inline void QC::set_signed_vote(int index, std::string&& value) {
+  _impl_.signed_vote_.Mutable(index)->assign(std::move(value));
+  // @@protoc_insertion_point(field_set:dsnet.hotstuff.proto.QC.signed_vote)
+}
+inline void QC::set_signed_vote(int index, const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.signed_vote_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set_char:dsnet.hotstuff.proto.QC.signed_vote)
+}
+inline void QC::set_signed_vote(int index, const void* value, size_t size) {
+  _impl_.signed_vote_.Mutable(index)->assign(
+    reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_set_pointer:dsnet.hotstuff.proto.QC.signed_vote)
+}
+inline std::string* QC::_internal_add_signed_vote() {
+  return _impl_.signed_vote_.Add();
+}
+inline void QC::add_signed_vote(const std::string& value) {
+  _impl_.signed_vote_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add:dsnet.hotstuff.proto.QC.signed_vote)
+}
+inline void QC::add_signed_vote(std::string&& value) {
+  _impl_.signed_vote_.Add(std::move(value));
+  // @@protoc_insertion_point(field_add:dsnet.hotstuff.proto.QC.signed_vote)
+}
+inline void QC::add_signed_vote(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.signed_vote_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add_char:dsnet.hotstuff.proto.QC.signed_vote)
+}
+inline void QC::add_signed_vote(const void* value, size_t size) {
+  _impl_.signed_vote_.Add()->assign(reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_add_pointer:dsnet.hotstuff.proto.QC.signed_vote)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>&
+QC::signed_vote() const {
+  // @@protoc_insertion_point(field_list:dsnet.hotstuff.proto.QC.signed_vote)
+  return _impl_.signed_vote_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>*
+QC::mutable_signed_vote() {
+  // @@protoc_insertion_point(field_mutable_list:dsnet.hotstuff.proto.QC.signed_vote)
+  return &_impl_.signed_vote_;
+}
+
+// uint64 signers = 3;
+inline void QC::clear_signers() {
+  _impl_.signers_ = uint64_t{0u};
+}
+inline uint64_t QC::_internal_signers() const {
+  return _impl_.signers_;
+}
+inline uint64_t QC::signers() const {
+  // @@protoc_insertion_point(field_get:dsnet.hotstuff.proto.QC.signers)
+  return _internal_signers();
+}
+inline void QC::_internal_set_signers(uint64_t value) {
+  
+  _impl_.signers_ = value;
+}
+inline void QC::set_signers(uint64_t value) {
+  _internal_set_signers(value);
+  // @@protoc_insertion_point(field_set:dsnet.hotstuff.proto.QC.signers)
+}
+
+// bytes aggregate_signature = 4;
+inline void QC::clear_aggregate_signature() {
+  _impl_.aggregate_signature_.ClearToEmpty();
+}
+inline const std::string& QC::aggregate_signature() const {
+  // @@protoc_insertion_point(field_get:dsnet.hotstuff.proto.QC.aggregate_signature)
+  return _internal_aggregate_signature();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void QC::set_aggregate_signature(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.aggregate_signature_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:dsnet.hotstuff.proto.QC.aggregate_signature)
+}
+inline std::string* QC::mutable_aggregate_signature() {
+  std::string* _s = _internal_mutable_aggregate_signature();
+  // @@protoc_insertion_point(field_mutable:dsnet.hotstuff.proto.QC.aggregate_signature)
+  return _s;
+}
+inline const std::string& QC::_internal_aggregate_signature() const {
+  return _impl_.aggregate_signature_.Get();
+}
+inline void QC::_internal_set_aggregate_signature(const std::string& value) {
+  
+  _impl_.aggregate_signature_.Set(value, GetArenaForAllocation());
+}
+inline std::string* QC::_internal_mutable_aggregate_signature() {
+  
+  return _impl_.aggregate_signature_.Mutable(GetArenaForAllocation());
+}
+inline std::string* QC::release_aggregate_signature() {
+  // @@protoc_insertion_point(field_release:dsnet.hotstuff.proto.QC.aggregate_signature)
+  return _impl_.aggregate_signature_.Release();
+}
+inline void QC::set_allocated_aggregate_signature(std::string* aggregate_signature) {
+  if (aggregate_signature != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.aggregate_signature_.SetAllocated(aggregate_signature, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.aggregate_signature_.IsDefault()) {
+    _impl_.aggregate_signature_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:dsnet.hotstuff.proto.QC.aggregate_signature)
+}
+
+// -------------------------------------------------------------------
+
+// Checkpoint
+
+// uint64 op_number = 1;
+inline void Checkpoint::clear_op_number() {
+  _impl_.op_number_ = uint64_t{0u};
+}
+inline uint64_t Checkpoint::_internal_op_number() const {
+  return _impl_.op_number_;
+}
+inline uint64_t Checkpoint::op_number() const {
+  // @@protoc_insertion_point(field_get:dsnet.hotstuff.proto.Checkpoint.op_number)
+  return _internal_op_number();
+}
+inline void Checkpoint::_internal_set_op_number(uint64_t value) {
+  
+  _impl_.op_number_ = value;
+}
+inline void Checkpoint::set_op_number(uint64_t value) {
+  _internal_set_op_number(value);
+  // @@protoc_insertion_point(field_set:dsnet.hotstuff.proto.Checkpoint.op_number)
+}
+
+// int32 replica_index = 2;
+inline void Checkpoint::clear_replica_index() {
+  _impl_.replica_index_ = 0;
+}
+inline int32_t Checkpoint::_internal_replica_index() const {
+  return _impl_.replica_index_;
+}
+inline int32_t Checkpoint::replica_index() const {
+  // @@protoc_insertion_point(field_get:dsnet.hotstuff.proto.Checkpoint.replica_index)
+  return _internal_replica_index();
+}
+inline void Checkpoint::_internal_set_replica_index(int32_t value) {
+  
+  _impl_.replica_index_ = value;
+}
+inline void Checkpoint::set_replica_index(int32_t value) {
+  _internal_set_replica_index(value);
+  // @@protoc_insertion_point(field_set:dsnet.hotstuff.proto.Checkpoint.replica_index)
+}
+
+// bytes digest = 3;
+inline void Checkpoint::clear_digest() {
+  _impl_.digest_.ClearToEmpty();
+}
+inline const std::string& Checkpoint::digest() const {
+  // @@protoc_insertion_point(field_get:dsnet.hotstuff.proto.Checkpoint.digest)
+  return _internal_digest();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void Checkpoint::set_digest(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.digest_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:dsnet.hotstuff.proto.Checkpoint.digest)
+}
+inline std::string* Checkpoint::mutable_digest() {
+  std::string* _s = _internal_mutable_digest();
+  // @@protoc_insertion_point(field_mutable:dsnet.hotstuff.proto.Checkpoint.digest)
+  return _s;
+}
+inline const std::string& Checkpoint::_internal_digest() const {
+  return _impl_.digest_.Get();
+}
+inline void Checkpoint::_internal_set_digest(const std::string& value) {
+  
+  _impl_.digest_.Set(value, GetArenaForAllocation());
+}
+inline std::string* Checkpoint::_internal_mutable_digest() {
+  
+  return _impl_.digest_.Mutable(GetArenaForAllocation());
+}
+inline std::string* Checkpoint::release_digest() {
+  // @@protoc_insertion_point(field_release:dsnet.hotstuff.proto.Checkpoint.digest)
+  return _impl_.digest_.Release();
+}
+inline void Checkpoint::set_allocated_digest(std::string* digest) {
+  if (digest != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.digest_.SetAllocated(digest, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.digest_.IsDefault()) {
+    _impl_.digest_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:dsnet.hotstuff.proto.Checkpoint.digest)
+}
+
+// -------------------------------------------------------------------
+
+// StateRequest
+
+// uint64 op_number = 1;
+inline void StateRequest::clear_op_number() {
+  _impl_.op_number_ = uint64_t{0u};
+}
+inline uint64_t StateRequest::_internal_op_number() const {
+  return _impl_.op_number_;
+}
+inline uint64_t StateRequest::op_number() const {
+  // @@protoc_insertion_point(field_get:dsnet.hotstuff.proto.StateRequest.op_number)
+  return _internal_op_number();
+}
+inline void StateRequest::_internal_set_op_number(uint64_t value) {
+  
+  _impl_.op_number_ = value;
+}
+inline void StateRequest::set_op_number(uint64_t value) {
+  _internal_set_op_number(value);
+  // @@protoc_insertion_point(field_set:dsnet.hotstuff.proto.StateRequest.op_number)
+}
+
+// uint64 last_op_number = 2;
+inline void StateRequest::clear_last_op_number() {
+  _impl_.last_op_number_ = uint64_t{0u};
+}
+inline uint64_t StateRequest::_internal_last_op_number() const {
+  return _impl_.last_op_number_;
+}
+inline uint64_t StateRequest::last_op_number() const {
+  // @@protoc_insertion_point(field_get:dsnet.hotstuff.proto.StateRequest.last_op_number)
+  return _internal_last_op_number();
+}
+inline void StateRequest::_internal_set_last_op_number(uint64_t value) {
+  
+  _impl_.last_op_number_ = value;
+}
+inline void StateRequest::set_last_op_number(uint64_t value) {
+  _internal_set_last_op_number(value);
+  // @@protoc_insertion_point(field_set:dsnet.hotstuff.proto.StateRequest.last_op_number)
+}
+
+// int32 replica_index = 3;
+inline void StateRequest::clear_replica_index() {
+  _impl_.replica_index_ = 0;
+}
+inline int32_t StateRequest::_internal_replica_index() const {
+  return _impl_.replica_index_;
+}
+inline int32_t StateRequest::replica_index() const {
+  // @@protoc_insertion_point(field_get:dsnet.hotstuff.proto.StateRequest.replica_index)
+  return _internal_replica_index();
+}
+inline void StateRequest::_internal_set_replica_index(int32_t value) {
+  
+  _impl_.replica_index_ = value;
+}
+inline void StateRequest::set_replica_index(int32_t value) {
+  _internal_set_replica_index(value);
+  // @@protoc_insertion_point(field_set:dsnet.hotstuff.proto.StateRequest.replica_index)
+}
+
+// -------------------------------------------------------------------
+
+// StateChunk
+
+// uint64 op_number = 1;
+inline void StateChunk::clear_op_number() {
+  _impl_.op_number_ = uint64_t{0u};
+}
+inline uint64_t StateChunk::_internal_op_number() const {
+  return _impl_.op_number_;
+}
+inline uint64_t StateChunk::op_number() const {
+  // @@protoc_insertion_point(field_get:dsnet.hotstuff.proto.StateChunk.op_number)
+  return _internal_op_number();
+}
+inline void StateChunk::_internal_set_op_number(uint64_t value) {
+  
+  _impl_.op_number_ = value;
+}
+inline void StateChunk::set_op_number(uint64_t value) {
+  _internal_set_op_number(value);
+  // @@protoc_insertion_point(field_set:dsnet.hotstuff.proto.StateChunk.op_number)
+}
+
+// repeated .dsnet.hotstuff.proto.StateEntry entry = 2;
+inline int StateChunk::_internal_entry_size() const {
+  return _impl_.entry_.size();
+}
+inline int StateChunk::entry_size() const {
+  return _internal_entry_size();
+}
+inline void StateChunk::clear_entry() {
+  _impl_.entry_.Clear();
+}
+inline ::dsnet::hotstuff::proto::StateEntry* StateChunk::mutable_entry(int index) {
+  // @@protoc_insertion_point(field_mutable:dsnet.hotstuff.proto.StateChunk.entry)
+  return _impl_.entry_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::dsnet::hotstuff::proto::StateEntry >*
+StateChunk::mutable_entry() {
+  // @@protoc_insertion_point(field_mutable_list:dsnet.hotstuff.proto.StateChunk.entry)
+  return &_impl_.entry_;
+}
+inline const ::dsnet::hotstuff::proto::StateEntry& StateChunk::_internal_entry(int index) const {
+  return _impl_.entry_.Get(index);
+}
+inline const ::dsnet::hotstuff::proto::StateEntry& StateChunk::entry(int index) const {
+  // @@protoc_insertion_point(field_get:dsnet.hotstuff.proto.StateChunk.entry)
+  return _internal_entry(index);
+}
+inline ::dsnet::hotstuff::proto::StateEntry* StateChunk::_internal_add_entry() {
+  return _impl_.entry_.Add();
+}
+inline ::dsnet::hotstuff::proto::StateEntry* StateChunk::add_entry() {
+  ::dsnet::hotstuff::proto::StateEntry* _add = _internal_add_entry();
+  // @@protoc_insertion_point(field_add:dsnet.hotstuff.proto.StateChunk.entry)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::dsnet::hotstuff::proto::StateEntry >&
+StateChunk::entry() const {
+  // @@protoc_insertion_point(field_list:dsnet.hotstuff.proto.StateChunk.entry)
+  return _impl_.entry_;
+}
+
+// .dsnet.hotstuff.proto.StableCheckpoint checkpoint = 3;
+inline bool StateChunk::_internal_has_checkpoint() const {
+  return this != internal_default_instance() && _impl_.checkpoint_ != nullptr;
+}
+inline bool StateChunk::has_checkpoint() const {
+  return _internal_has_checkpoint();
+}
+inline void StateChunk::clear_checkpoint() {
+  if (GetArenaForAllocation() == nullptr && _impl_.checkpoint_ != nullptr) {
+    delete _impl_.checkpoint_;
+  }
+  _impl_.checkpoint_ = nullptr;
+}
+inline const ::dsnet::hotstuff::proto::StableCheckpoint& StateChunk::_internal_checkpoint() const {
+  const ::dsnet::hotstuff::proto::StableCheckpoint* p = _impl_.checkpoint_;
+  return p != nullptr ? *p : reinterpret_cast<const ::dsnet::hotstuff::proto::StableCheckpoint&>(
+      ::dsnet::hotstuff::proto::_StableCheckpoint_default_instance_);
+}
+inline const ::dsnet::hotstuff::proto::StableCheckpoint& StateChunk::checkpoint() const {
+  // @@protoc_insertion_point(field_get:dsnet.hotstuff.proto.StateChunk.checkpoint)
+  return _internal_checkpoint();
+}
+inline void StateChunk::unsafe_arena_set_allocated_checkpoint(
+    ::dsnet::hotstuff::proto::StableCheckpoint* checkpoint) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.checkpoint_);
+  }
+  _impl_.checkpoint_ = checkpoint;
+  if (checkpoint) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:dsnet.hotstuff.proto.StateChunk.checkpoint)
+}
+inline ::dsnet::hotstuff::proto::StableCheckpoint* StateChunk::release_checkpoint() {
+  
+  ::dsnet::hotstuff::proto::StableCheckpoint* temp = _impl_.checkpoint_;
+  _impl_.checkpoint_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::dsnet::hotstuff::proto::StableCheckpoint* StateChunk::unsafe_arena_release_checkpoint() {
+  // @@protoc_insertion_point(field_release:dsnet.hotstuff.proto.StateChunk.checkpoint)
+  
+  ::dsnet::hotstuff::proto::StableCheckpoint* temp = _impl_.checkpoint_;
+  _impl_.checkpoint_ = nullptr;
+  return temp;
+}
+inline ::dsnet::hotstuff::proto::StableCheckpoint* StateChunk::_internal_mutable_checkpoint() {
+  
+  if (_impl_.checkpoint_ == nullptr) {
+    auto* p = CreateMaybeMessage<::dsnet::hotstuff::proto::StableCheckpoint>(GetArenaForAllocation());
+    _impl_.checkpoint_ = p;
+  }
+  return _impl_.checkpoint_;
+}
+inline ::dsnet::hotstuff::proto::StableCheckpoint* StateChunk::mutable_checkpoint() {
+  ::dsnet::hotstuff::proto::StableCheckpoint* _msg = _internal_mutable_checkpoint();
+  // @@protoc_insertion_point(field_mutable:dsnet.hotstuff.proto.StateChunk.checkpoint)
+  return _msg;
+}
+inline void StateChunk::set_allocated_checkpoint(::dsnet::hotstuff::proto::StableCheckpoint* checkpoint) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.checkpoint_;
+  }
+  if (checkpoint) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(checkpoint);
+    if (message_arena != submessage_arena) {
+      checkpoint = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, checkpoint, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.checkpoint_ = checkpoint;
+  // @@protoc_insertion_point(field_set_allocated:dsnet.hotstuff.proto.StateChunk.checkpoint)
+}
+
+// int32 replica_index = 4;
+inline void StateChunk::clear_replica_index() {
+  _impl_.replica_index_ = 0;
+}
+inline int32_t StateChunk::_internal_replica_index() const {
+  return _impl_.replica_index_;
+}
+inline int32_t StateChunk::replica_index() const {
+  // @@protoc_insertion_point(field_get:dsnet.hotstuff.proto.StateChunk.replica_index)
+  return _internal_replica_index();
+}
+inline void StateChunk::_internal_set_replica_index(int32_t value) {
+  
+  _impl_.replica_index_ = value;
+}
+inline void StateChunk::set_replica_index(int32_t value) {
+  _internal_set_replica_index(value);
+  // @@protoc_insertion_point(field_set:dsnet.hotstuff.proto.StateChunk.replica_index)
+}
+
+// -------------------------------------------------------------------
+
+// StateEntry
+
+// .dsnet.Request request = 1;
+inline bool StateEntry::_internal_has_request() const {
+  return this != internal_default_instance() && _impl_.request_ != nullptr;
+}
+inline bool StateEntry::has_request() const {
+  return _internal_has_request();
+}
+inline const ::dsnet::Request& StateEntry::_internal_request() const {
+  const ::dsnet::Request* p = _impl_.request_;
+  return p != nullptr ? *p : reinterpret_cast<const ::dsnet::Request&>(
+      ::dsnet::_Request_default_instance_);
+}
+inline const ::dsnet::Request& StateEntry::request() const {
+  // @@protoc_insertion_point(field_get:dsnet.hotstuff.proto.StateEntry.request)
+  return _internal_request();
+}
+inline void StateEntry::unsafe_arena_set_allocated_request(
+    ::dsnet::Request* request) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.request_);
+  }
+  _impl_.request_ = request;
+  if (request) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:dsnet.hotstuff.proto.StateEntry.request)
+}
+inline ::dsnet::Request* StateEntry::release_request() {
+  
+  ::dsnet::Request* temp = _impl_.request_;
+  _impl_.request_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::dsnet::Request* StateEntry::unsafe_arena_release_request() {
+  // @@protoc_insertion_point(field_release:dsnet.hotstuff.proto.StateEntry.request)
+  
+  ::dsnet::Request* temp = _impl_.request_;
+  _impl_.request_ = nullptr;
+  return temp;
+}
+inline ::dsnet::Request* StateEntry::_internal_mutable_request() {
+  
+  if (_impl_.request_ == nullptr) {
+    auto* p = CreateMaybeMessage<::dsnet::Request>(GetArenaForAllocation());
+    _impl_.request_ = p;
+  }
+  return _impl_.request_;
+}
+inline ::dsnet::Request* StateEntry::mutable_request() {
+  ::dsnet::Request* _msg = _internal_mutable_request();
+  // @@protoc_insertion_point(field_mutable:dsnet.hotstuff.proto.StateEntry.request)
+  return _msg;
+}
+inline void StateEntry::set_allocated_request(::dsnet::Request* request) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete reinterpret_cast< ::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.request_);
+  }
+  if (request) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(
+                reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(request));
+    if (message_arena != submessage_arena) {
+      request = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, request, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.request_ = request;
+  // @@protoc_insertion_point(field_set_allocated:dsnet.hotstuff.proto.StateEntry.request)
+}
+
+// -------------------------------------------------------------------
+
+// StableCheckpoint
+
+// uint64 op_number = 1;
+inline void StableCheckpoint::clear_op_number() {
+  _impl_.op_number_ = uint64_t{0u};
+}
+inline uint64_t StableCheckpoint::_internal_op_number() const {
+  return _impl_.op_number_;
+}
+inline uint64_t StableCheckpoint::op_number() const {
+  // @@protoc_insertion_point(field_get:dsnet.hotstuff.proto.StableCheckpoint.op_number)
+  return _internal_op_number();
+}
+inline void StableCheckpoint::_internal_set_op_number(uint64_t value) {
+  
+  _impl_.op_number_ = value;
+}
+inline void StableCheckpoint::set_op_number(uint64_t value) {
+  _internal_set_op_number(value);
+  // @@protoc_insertion_point(field_set:dsnet.hotstuff.proto.StableCheckpoint.op_number)
+}
+
+// bytes app_state = 2;
+inline void StableCheckpoint::clear_app_state() {
+  _impl_.app_state_.ClearToEmpty();
+}
+inline const std::string& StableCheckpoint::app_state() const {
+  // @@protoc_insertion_point(field_get:dsnet.hotstuff.proto.StableCheckpoint.app_state)
+  return _internal_app_state();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void StableCheckpoint::set_app_state(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.app_state_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:dsnet.hotstuff.proto.StableCheckpoint.app_state)
+}
+inline std::string* StableCheckpoint::mutable_app_state() {
+  std::string* _s = _internal_mutable_app_state();
+  // @@protoc_insertion_point(field_mutable:dsnet.hotstuff.proto.StableCheckpoint.app_state)
+  return _s;
+}
+inline const std::string& StableCheckpoint::_internal_app_state() const {
+  return _impl_.app_state_.Get();
+}
+inline void StableCheckpoint::_internal_set_app_state(const std::string& value) {
+  
+  _impl_.app_state_.Set(value, GetArenaForAllocation());
+}
+inline std::string* StableCheckpoint::_internal_mutable_app_state() {
+  
+  return _impl_.app_state_.Mutable(GetArenaForAllocation());
+}
+inline std::string* StableCheckpoint::release_app_state() {
+  // @@protoc_insertion_point(field_release:dsnet.hotstuff.proto.StableCheckpoint.app_state)
+  return _impl_.app_state_.Release();
+}
+inline void StableCheckpoint::set_allocated_app_state(std::string* app_state) {
+  if (app_state != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.app_state_.SetAllocated(app_state, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.app_state_.IsDefault()) {
+    _impl_.app_state_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:dsnet.hotstuff.proto.StableCheckpoint.app_state)
+}
+
+// repeated bytes signed_checkpoint = 3;
+inline int StableCheckpoint::_internal_signed_checkpoint_size() const {
+  return _impl_.signed_checkpoint_.size();
+}
+inline int StableCheckpoint::signed_checkpoint_size() const {
+  return _internal_signed_checkpoint_size();
+}
+inline void StableCheckpoint::clear_signed_checkpoint() {
+  _impl_.signed_checkpoint_.Clear();
+}
+inline std::string* StableCheckpoint::add_signed_checkpoint() {
+  std::string* _s = _internal_add_signed_checkpoint();
+  // @@protoc_insertion_point(field_add_mutable:dsnet.hotstuff.proto.StableCheckpoint.signed_checkpoint)
+  return _s;
+}
+inline const std::string& StableCheckpoint::_internal_signed_checkpoint(int index) const {
+  return _impl_.signed_checkpoint_.Get(index);
+}
+inline const std::string& StableCheckpoint::signed_checkpoint(int index) const {
+  // @@protoc_insertion_point(field_get:dsnet.hotstuff.proto.StableCheckpoint.signed_checkpoint)
+  return _internal_signed_checkpoint(index);
+}
+inline std::string* StableCheckpoint::mutable_signed_checkpoint(int index) {
+  // @@protoc_insertion_point(field_mutable:dsnet.hotstuff.proto.StableCheckpoint.signed_checkpoint)
+  return _impl_.signed_checkpoint_.Mutable(index);
+}
+inline void StableCheckpoint::set_signed_checkpoint(int index, const std::string& value) {
+  _impl_.signed_checkpoint_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set:dsnet.hotstuff.proto.StableCheckpoint.signed_checkpoint)
+}
+inline void StableCheckpoint::set_signed_checkpoint(int index, std::string&& value) {
+  _impl_.signed_checkpoint_.Mutable(index)->assign(std::move(value));
+  // @@protoc_insertion_point(field_set:dsnet.hotstuff.proto.StableCheckpoint.signed_checkpoint)
+}
+inline void StableCheckpoint::set_signed_checkpoint(int index, const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.signed_checkpoint_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set_char:dsnet.hotstuff.proto.StableCheckpoint.signed_checkpoint)
+}
+inline void StableCheckpoint::set_signed_checkpoint(int index, const void* value, size_t size) {
+  _impl_.signed_checkpoint_.Mutable(index)->assign(
+    reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_set_pointer:dsnet.hotstuff.proto.StableCheckpoint.signed_checkpoint)
+}
+inline std::string* StableCheckpoint::_internal_add_signed_checkpoint() {
+  return _impl_.signed_checkpoint_.Add();
+}
+inline void StableCheckpoint::add_signed_checkpoint(const std::string& value) {
+  _impl_.signed_checkpoint_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add:dsnet.hotstuff.proto.StableCheckpoint.signed_checkpoint)
+}
+inline void StableCheckpoint::add_signed_checkpoint(std::string&& value) {
+  _impl_.signed_checkpoint_.Add(std::move(value));
+  // @@protoc_insertion_point(field_add:dsnet.hotstuff.proto.StableCheckpoint.signed_checkpoint)
+}
+inline void StableCheckpoint::add_signed_checkpoint(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.signed_checkpoint_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add_char:dsnet.hotstuff.proto.StableCheckpoint.signed_checkpoint)
+}
+inline void StableCheckpoint::add_signed_checkpoint(const void* value, size_t size) {
+  _impl_.signed_checkpoint_.Add()->assign(reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_add_pointer:dsnet.hotstuff.proto.StableCheckpoint.signed_checkpoint)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>&
+StableCheckpoint::signed_checkpoint() const {
+  // @@protoc_insertion_point(field_list:dsnet.hotstuff.proto.StableCheckpoint.signed_checkpoint)
+  return _impl_.signed_checkpoint_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>*
+StableCheckpoint::mutable_signed_checkpoint() {
+  // @@protoc_insertion_point(field_mutable_list:dsnet.hotstuff.proto.StableCheckpoint.signed_checkpoint)
+  return &_impl_.signed_checkpoint_;
+}
+
+// bytes digest = 4;
+inline void StableCheckpoint::clear_digest() {
+  _impl_.digest_.ClearToEmpty();
+}
+inline const std::string& StableCheckpoint::digest() const {
+  // @@protoc_insertion_point(field_get:dsnet.hotstuff.proto.StableCheckpoint.digest)
+  return _internal_digest();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void StableCheckpoint::set_digest(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.digest_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:dsnet.hotstuff.proto.StableCheckpoint.digest)
+}
+inline std::string* StableCheckpoint::mutable_digest() {
+  std::string* _s = _internal_mutable_digest();
+  // @@protoc_insertion_point(field_mutable:dsnet.hotstuff.proto.StableCheckpoint.digest)
+  return _s;
+}
+inline const std::string& StableCheckpoint::_internal_digest() const {
+  return _impl_.digest_.Get();
+}
+inline void StableCheckpoint::_internal_set_digest(const std::string& value) {
+  
+  _impl_.digest_.Set(value, GetArenaForAllocation());
+}
+inline std::string* StableCheckpoint::_internal_mutable_digest() {
+  
+  return _impl_.digest_.Mutable(GetArenaForAllocation());
+}
+inline std::string* StableCheckpoint::release_digest() {
+  // @@protoc_insertion_point(field_release:dsnet.hotstuff.proto.StableCheckpoint.digest)
+  return _impl_.digest_.Release();
+}
+inline void StableCheckpoint::set_allocated_digest(std::string* digest) {
+  if (digest != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.digest_.SetAllocated(digest, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.digest_.IsDefault()) {
+    _impl_.digest_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:dsnet.hotstuff.proto.StableCheckpoint.digest)
+}
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic pop
+#endif  // __GNUC__
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+
+// @@protoc_insertion_point(namespace_scope)
+
+}  // namespace proto
+}  // namespace hotstuff
+}  // namespace dsnet
+
+// @@protoc_insertion_point(global_scope)
+
+#include <google/protobuf/port_undef.inc>
+#endif  // GOOGLE_PROTOBUF_INCLUDED_GOOGLE_PROTOBUF_INCLUDED_replication_2fhotstuff_2fmessage_2eproto
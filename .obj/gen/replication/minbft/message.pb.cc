@@ -0,0 +1,2953 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: replication/minbft/message.proto
+
+#include "replication/minbft/message.pb.h"
+
+#include <algorithm>
+
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/extension_set.h>
+#include <google/protobuf/wire_format_lite.h>
+#include <google/protobuf/descriptor.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/reflection_ops.h>
+#include <google/protobuf/wire_format.h>
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+
+PROTOBUF_PRAGMA_INIT_SEG
+
+namespace _pb = ::PROTOBUF_NAMESPACE_ID;
+namespace _pbi = _pb::internal;
+
+namespace dsnet {
+namespace minbft {
+namespace proto {
+PROTOBUF_CONSTEXPR MinBFTMessage::MinBFTMessage(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.sub_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_._oneof_case_)*/{}} {}
+struct MinBFTMessageDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR MinBFTMessageDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~MinBFTMessageDefaultTypeInternal() {}
+  union {
+    MinBFTMessage _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 MinBFTMessageDefaultTypeInternal _MinBFTMessage_default_instance_;
+PROTOBUF_CONSTEXPR UIMessage::UIMessage(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.replica_id_)*/0
+  , /*decltype(_impl_.sub_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_._oneof_case_)*/{}} {}
+struct UIMessageDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR UIMessageDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~UIMessageDefaultTypeInternal() {}
+  union {
+    UIMessage _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 UIMessageDefaultTypeInternal _UIMessage_default_instance_;
+PROTOBUF_CONSTEXPR Reply::Reply(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.result_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.request_number_)*/uint64_t{0u}
+  , /*decltype(_impl_.replica_id_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct ReplyDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ReplyDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ReplyDefaultTypeInternal() {}
+  union {
+    Reply _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ReplyDefaultTypeInternal _Reply_default_instance_;
+PROTOBUF_CONSTEXPR Prepare::Prepare(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.signed_request_)*/{}
+  , /*decltype(_impl_.view_number_)*/uint64_t{0u}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct PrepareDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR PrepareDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~PrepareDefaultTypeInternal() {}
+  union {
+    Prepare _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 PrepareDefaultTypeInternal _Prepare_default_instance_;
+PROTOBUF_CONSTEXPR Commit::Commit(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.view_number_)*/uint64_t{0u}
+  , /*decltype(_impl_.primary_ui_)*/uint64_t{0u}
+  , /*decltype(_impl_.replica_id_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct CommitDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR CommitDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~CommitDefaultTypeInternal() {}
+  union {
+    Commit _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 CommitDefaultTypeInternal _Commit_default_instance_;
+PROTOBUF_CONSTEXPR Checkpoint::Checkpoint(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.digest_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.op_number_)*/uint64_t{0u}
+  , /*decltype(_impl_.replica_id_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct CheckpointDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR CheckpointDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~CheckpointDefaultTypeInternal() {}
+  union {
+    Checkpoint _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 CheckpointDefaultTypeInternal _Checkpoint_default_instance_;
+PROTOBUF_CONSTEXPR StateRequest::StateRequest(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.ui_)*/uint64_t{0u}
+  , /*decltype(_impl_.last_ui_)*/uint64_t{0u}
+  , /*decltype(_impl_.replica_id_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct StateRequestDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR StateRequestDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~StateRequestDefaultTypeInternal() {}
+  union {
+    StateRequest _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 StateRequestDefaultTypeInternal _StateRequest_default_instance_;
+PROTOBUF_CONSTEXPR StateChunk::StateChunk(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.ui_message_)*/{}
+  , /*decltype(_impl_.checkpoint_)*/nullptr
+  , /*decltype(_impl_.ui_)*/uint64_t{0u}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct StateChunkDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR StateChunkDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~StateChunkDefaultTypeInternal() {}
+  union {
+    StateChunk _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 StateChunkDefaultTypeInternal _StateChunk_default_instance_;
+PROTOBUF_CONSTEXPR StableCheckpoint::StableCheckpoint(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.ui_checkpoint_)*/{}
+  , /*decltype(_impl_.app_state_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.digest_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.op_number_)*/uint64_t{0u}
+  , /*decltype(_impl_.collected_ui_)*/uint64_t{0u}
+  , /*decltype(_impl_.collected_op_)*/uint64_t{0u}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct StableCheckpointDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR StableCheckpointDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~StableCheckpointDefaultTypeInternal() {}
+  union {
+    StableCheckpoint _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 StableCheckpointDefaultTypeInternal _StableCheckpoint_default_instance_;
+}  // namespace proto
+}  // namespace minbft
+}  // namespace dsnet
+static ::_pb::Metadata file_level_metadata_replication_2fminbft_2fmessage_2eproto[9];
+static constexpr ::_pb::EnumDescriptor const** file_level_enum_descriptors_replication_2fminbft_2fmessage_2eproto = nullptr;
+static constexpr ::_pb::ServiceDescriptor const** file_level_service_descriptors_replication_2fminbft_2fmessage_2eproto = nullptr;
+
+const uint32_t TableStruct_replication_2fminbft_2fmessage_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::dsnet::minbft::proto::MinBFTMessage, _internal_metadata_),
+  ~0u,  // no _extensions_
+  PROTOBUF_FIELD_OFFSET(::dsnet::minbft::proto::MinBFTMessage, _impl_._oneof_case_[0]),
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  PROTOBUF_FIELD_OFFSET(::dsnet::minbft::proto::MinBFTMessage, _impl_.sub_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::dsnet::minbft::proto::UIMessage, _internal_metadata_),
+  ~0u,  // no _extensions_
+  PROTOBUF_FIELD_OFFSET(::dsnet::minbft::proto::UIMessage, _impl_._oneof_case_[0]),
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  PROTOBUF_FIELD_OFFSET(::dsnet::minbft::proto::UIMessage, _impl_.replica_id_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::minbft::proto::UIMessage, _impl_.sub_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::dsnet::minbft::proto::Reply, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::dsnet::minbft::proto::Reply, _impl_.result_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::minbft::proto::Reply, _impl_.replica_id_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::minbft::proto::Reply, _impl_.request_number_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::dsnet::minbft::proto::Prepare, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::dsnet::minbft::proto::Prepare, _impl_.view_number_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::minbft::proto::Prepare, _impl_.signed_request_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::dsnet::minbft::proto::Commit, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::dsnet::minbft::proto::Commit, _impl_.view_number_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::minbft::proto::Commit, _impl_.primary_ui_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::minbft::proto::Commit, _impl_.replica_id_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::dsnet::minbft::proto::Checkpoint, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::dsnet::minbft::proto::Checkpoint, _impl_.op_number_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::minbft::proto::Checkpoint, _impl_.replica_id_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::minbft::proto::Checkpoint, _impl_.digest_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::dsnet::minbft::proto::StateRequest, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::dsnet::minbft::proto::StateRequest, _impl_.ui_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::minbft::proto::StateRequest, _impl_.last_ui_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::minbft::proto::StateRequest, _impl_.replica_id_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::dsnet::minbft::proto::StateChunk, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::dsnet::minbft::proto::StateChunk, _impl_.ui_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::minbft::proto::StateChunk, _impl_.ui_message_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::minbft::proto::StateChunk, _impl_.checkpoint_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::dsnet::minbft::proto::StableCheckpoint, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::dsnet::minbft::proto::StableCheckpoint, _impl_.op_number_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::minbft::proto::StableCheckpoint, _impl_.app_state_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::minbft::proto::StableCheckpoint, _impl_.ui_checkpoint_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::minbft::proto::StableCheckpoint, _impl_.collected_ui_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::minbft::proto::StableCheckpoint, _impl_.collected_op_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::minbft::proto::StableCheckpoint, _impl_.digest_),
+};
+static const ::_pbi::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  { 0, -1, -1, sizeof(::dsnet::minbft::proto::MinBFTMessage)},
+  { 11, -1, -1, sizeof(::dsnet::minbft::proto::UIMessage)},
+  { 22, -1, -1, sizeof(::dsnet::minbft::proto::Reply)},
+  { 31, -1, -1, sizeof(::dsnet::minbft::proto::Prepare)},
+  { 39, -1, -1, sizeof(::dsnet::minbft::proto::Commit)},
+  { 48, -1, -1, sizeof(::dsnet::minbft::proto::Checkpoint)},
+  { 57, -1, -1, sizeof(::dsnet::minbft::proto::StateRequest)},
+  { 66, -1, -1, sizeof(::dsnet::minbft::proto::StateChunk)},
+  { 75, -1, -1, sizeof(::dsnet::minbft::proto::StableCheckpoint)},
+};
+
+static const ::_pb::Message* const file_default_instances[] = {
+  &::dsnet::minbft::proto::_MinBFTMessage_default_instance_._instance,
+  &::dsnet::minbft::proto::_UIMessage_default_instance_._instance,
+  &::dsnet::minbft::proto::_Reply_default_instance_._instance,
+  &::dsnet::minbft::proto::_Prepare_default_instance_._instance,
+  &::dsnet::minbft::proto::_Commit_default_instance_._instance,
+  &::dsnet::minbft::proto::_Checkpoint_default_instance_._instance,
+  &::dsnet::minbft::proto::_StateRequest_default_instance_._instance,
+  &::dsnet::minbft::proto::_StateChunk_default_instance_._instance,
+  &::dsnet::minbft::proto::_StableCheckpoint_default_instance_._instance,
+};
+
+const char descriptor_table_protodef_replication_2fminbft_2fmessage_2eproto[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) =
+  "\n replication/minbft/message.proto\022\022dsne"
+  "t.minbft.proto\"\270\001\n\rMinBFTMessage\022\030\n\016sign"
+  "ed_request\030\001 \001(\014H\000\022\024\n\nui_message\030\002 \001(\014H\000"
+  "\0229\n\rstate_request\030\003 \001(\0132 .dsnet.minbft.p"
+  "roto.StateRequestH\000\0225\n\013state_chunk\030\004 \001(\013"
+  "2\036.dsnet.minbft.proto.StateChunkH\000B\005\n\003su"
+  "b\"\272\001\n\tUIMessage\022.\n\007prepare\030\001 \001(\0132\033.dsnet"
+  ".minbft.proto.PrepareH\000\022,\n\006commit\030\002 \001(\0132"
+  "\032.dsnet.minbft.proto.CommitH\000\0224\n\ncheckpo"
+  "int\030\004 \001(\0132\036.dsnet.minbft.proto.Checkpoin"
+  "tH\000\022\022\n\nreplica_id\030\003 \001(\005B\005\n\003sub\"C\n\005Reply\022"
+  "\016\n\006result\030\001 \001(\014\022\022\n\nreplica_id\030\002 \001(\005\022\026\n\016r"
+  "equest_number\030\003 \001(\004\"6\n\007Prepare\022\023\n\013view_n"
+  "umber\030\001 \001(\004\022\026\n\016signed_request\030\002 \003(\014\"E\n\006C"
+  "ommit\022\023\n\013view_number\030\001 \001(\004\022\022\n\nprimary_ui"
+  "\030\002 \001(\004\022\022\n\nreplica_id\030\003 \001(\005\"C\n\nCheckpoint"
+  "\022\021\n\top_number\030\001 \001(\004\022\022\n\nreplica_id\030\002 \001(\005\022"
+  "\016\n\006digest\030\003 \001(\014\"\?\n\014StateRequest\022\n\n\002ui\030\001 "
+  "\001(\004\022\017\n\007last_ui\030\002 \001(\004\022\022\n\nreplica_id\030\003 \001(\005"
+  "\"f\n\nStateChunk\022\n\n\002ui\030\001 \001(\004\022\022\n\nui_message"
+  "\030\002 \003(\014\0228\n\ncheckpoint\030\003 \001(\0132$.dsnet.minbf"
+  "t.proto.StableCheckpoint\"\213\001\n\020StableCheck"
+  "point\022\021\n\top_number\030\001 \001(\004\022\021\n\tapp_state\030\002 "
+  "\001(\014\022\025\n\rui_checkpoint\030\003 \003(\014\022\024\n\014collected_"
+  "ui\030\004 \001(\004\022\024\n\014collected_op\030\005 \001(\004\022\016\n\006digest"
+  "\030\006 \001(\014b\006proto3"
+  ;
+static ::_pbi::once_flag descriptor_table_replication_2fminbft_2fmessage_2eproto_once;
+const ::_pbi::DescriptorTable descriptor_table_replication_2fminbft_2fmessage_2eproto = {
+    false, false, 1014, descriptor_table_protodef_replication_2fminbft_2fmessage_2eproto,
+    "replication/minbft/message.proto",
+    &descriptor_table_replication_2fminbft_2fmessage_2eproto_once, nullptr, 0, 9,
+    schemas, file_default_instances, TableStruct_replication_2fminbft_2fmessage_2eproto::offsets,
+    file_level_metadata_replication_2fminbft_2fmessage_2eproto, file_level_enum_descriptors_replication_2fminbft_2fmessage_2eproto,
+    file_level_service_descriptors_replication_2fminbft_2fmessage_2eproto,
+};
+PROTOBUF_ATTRIBUTE_WEAK const ::_pbi::DescriptorTable* descriptor_table_replication_2fminbft_2fmessage_2eproto_getter() {
+  return &descriptor_table_replication_2fminbft_2fmessage_2eproto;
+}
+
+// Force running AddDescriptors() at dynamic initialization time.
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 static ::_pbi::AddDescriptorsRunner dynamic_init_dummy_replication_2fminbft_2fmessage_2eproto(&descriptor_table_replication_2fminbft_2fmessage_2eproto);
+namespace dsnet {
+namespace minbft {
+namespace proto {
+
+// ===================================================================
+
+class MinBFTMessage::_Internal {
+ public:
+  static const ::dsnet::minbft::proto::StateRequest& state_request(const MinBFTMessage* msg);
+  static const ::dsnet::minbft::proto::StateChunk& state_chunk(const MinBFTMessage* msg);
+};
+
+const ::dsnet::minbft::proto::StateRequest&
+MinBFTMessage::_Internal::state_request(const MinBFTMessage* msg) {
+  return *msg->_impl_.sub_.state_request_;
+}
+const ::dsnet::minbft::proto::StateChunk&
+MinBFTMessage::_Internal::state_chunk(const MinBFTMessage* msg) {
+  return *msg->_impl_.sub_.state_chunk_;
+}
+void MinBFTMessage::set_allocated_state_request(::dsnet::minbft::proto::StateRequest* state_request) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  clear_sub();
+  if (state_request) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(state_request);
+    if (message_arena != submessage_arena) {
+      state_request = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, state_request, submessage_arena);
+    }
+    set_has_state_request();
+    _impl_.sub_.state_request_ = state_request;
+  }
+  // @@protoc_insertion_point(field_set_allocated:dsnet.minbft.proto.MinBFTMessage.state_request)
+}
+void MinBFTMessage::set_allocated_state_chunk(::dsnet::minbft::proto::StateChunk* state_chunk) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  clear_sub();
+  if (state_chunk) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(state_chunk);
+    if (message_arena != submessage_arena) {
+      state_chunk = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, state_chunk, submessage_arena);
+    }
+    set_has_state_chunk();
+    _impl_.sub_.state_chunk_ = state_chunk;
+  }
+  // @@protoc_insertion_point(field_set_allocated:dsnet.minbft.proto.MinBFTMessage.state_chunk)
+}
+MinBFTMessage::MinBFTMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:dsnet.minbft.proto.MinBFTMessage)
+}
+MinBFTMessage::MinBFTMessage(const MinBFTMessage& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  MinBFTMessage* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.sub_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , /*decltype(_impl_._oneof_case_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  clear_has_sub();
+  switch (from.sub_case()) {
+    case kSignedRequest: {
+      _this->_internal_set_signed_request(from._internal_signed_request());
+      break;
+    }
+    case kUiMessage: {
+      _this->_internal_set_ui_message(from._internal_ui_message());
+      break;
+    }
+    case kStateRequest: {
+      _this->_internal_mutable_state_request()->::dsnet::minbft::proto::StateRequest::MergeFrom(
+          from._internal_state_request());
+      break;
+    }
+    case kStateChunk: {
+      _this->_internal_mutable_state_chunk()->::dsnet::minbft::proto::StateChunk::MergeFrom(
+          from._internal_state_chunk());
+      break;
+    }
+    case SUB_NOT_SET: {
+      break;
+    }
+  }
+  // @@protoc_insertion_point(copy_constructor:dsnet.minbft.proto.MinBFTMessage)
+}
+
+inline void MinBFTMessage::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.sub_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , /*decltype(_impl_._oneof_case_)*/{}
+  };
+  clear_has_sub();
+}
+
+MinBFTMessage::~MinBFTMessage() {
+  // @@protoc_insertion_point(destructor:dsnet.minbft.proto.MinBFTMessage)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void MinBFTMessage::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  if (has_sub()) {
+    clear_sub();
+  }
+}
+
+void MinBFTMessage::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void MinBFTMessage::clear_sub() {
+// @@protoc_insertion_point(one_of_clear_start:dsnet.minbft.proto.MinBFTMessage)
+  switch (sub_case()) {
+    case kSignedRequest: {
+      _impl_.sub_.signed_request_.Destroy();
+      break;
+    }
+    case kUiMessage: {
+      _impl_.sub_.ui_message_.Destroy();
+      break;
+    }
+    case kStateRequest: {
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.sub_.state_request_;
+      }
+      break;
+    }
+    case kStateChunk: {
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.sub_.state_chunk_;
+      }
+      break;
+    }
+    case SUB_NOT_SET: {
+      break;
+    }
+  }
+  _impl_._oneof_case_[0] = SUB_NOT_SET;
+}
+
+
+void MinBFTMessage::Clear() {
+// @@protoc_insertion_point(message_clear_start:dsnet.minbft.proto.MinBFTMessage)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  clear_sub();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* MinBFTMessage::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // bytes signed_request = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_signed_request();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // bytes ui_message = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_ui_message();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .dsnet.minbft.proto.StateRequest state_request = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          ptr = ctx->ParseMessage(_internal_mutable_state_request(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .dsnet.minbft.proto.StateChunk state_chunk = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          ptr = ctx->ParseMessage(_internal_mutable_state_chunk(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* MinBFTMessage::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:dsnet.minbft.proto.MinBFTMessage)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // bytes signed_request = 1;
+  if (_internal_has_signed_request()) {
+    target = stream->WriteBytesMaybeAliased(
+        1, this->_internal_signed_request(), target);
+  }
+
+  // bytes ui_message = 2;
+  if (_internal_has_ui_message()) {
+    target = stream->WriteBytesMaybeAliased(
+        2, this->_internal_ui_message(), target);
+  }
+
+  // .dsnet.minbft.proto.StateRequest state_request = 3;
+  if (_internal_has_state_request()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(3, _Internal::state_request(this),
+        _Internal::state_request(this).GetCachedSize(), target, stream);
+  }
+
+  // .dsnet.minbft.proto.StateChunk state_chunk = 4;
+  if (_internal_has_state_chunk()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(4, _Internal::state_chunk(this),
+        _Internal::state_chunk(this).GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:dsnet.minbft.proto.MinBFTMessage)
+  return target;
+}
+
+size_t MinBFTMessage::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:dsnet.minbft.proto.MinBFTMessage)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  switch (sub_case()) {
+    // bytes signed_request = 1;
+    case kSignedRequest: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+          this->_internal_signed_request());
+      break;
+    }
+    // bytes ui_message = 2;
+    case kUiMessage: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+          this->_internal_ui_message());
+      break;
+    }
+    // .dsnet.minbft.proto.StateRequest state_request = 3;
+    case kStateRequest: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.sub_.state_request_);
+      break;
+    }
+    // .dsnet.minbft.proto.StateChunk state_chunk = 4;
+    case kStateChunk: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.sub_.state_chunk_);
+      break;
+    }
+    case SUB_NOT_SET: {
+      break;
+    }
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData MinBFTMessage::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    MinBFTMessage::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*MinBFTMessage::GetClassData() const { return &_class_data_; }
+
+
+void MinBFTMessage::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<MinBFTMessage*>(&to_msg);
+  auto& from = static_cast<const MinBFTMessage&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:dsnet.minbft.proto.MinBFTMessage)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  switch (from.sub_case()) {
+    case kSignedRequest: {
+      _this->_internal_set_signed_request(from._internal_signed_request());
+      break;
+    }
+    case kUiMessage: {
+      _this->_internal_set_ui_message(from._internal_ui_message());
+      break;
+    }
+    case kStateRequest: {
+      _this->_internal_mutable_state_request()->::dsnet::minbft::proto::StateRequest::MergeFrom(
+          from._internal_state_request());
+      break;
+    }
+    case kStateChunk: {
+      _this->_internal_mutable_state_chunk()->::dsnet::minbft::proto::StateChunk::MergeFrom(
+          from._internal_state_chunk());
+      break;
+    }
+    case SUB_NOT_SET: {
+      break;
+    }
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void MinBFTMessage::CopyFrom(const MinBFTMessage& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:dsnet.minbft.proto.MinBFTMessage)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool MinBFTMessage::IsInitialized() const {
+  return true;
+}
+
+void MinBFTMessage::InternalSwap(MinBFTMessage* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_.sub_, other->_impl_.sub_);
+  swap(_impl_._oneof_case_[0], other->_impl_._oneof_case_[0]);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata MinBFTMessage::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_replication_2fminbft_2fmessage_2eproto_getter, &descriptor_table_replication_2fminbft_2fmessage_2eproto_once,
+      file_level_metadata_replication_2fminbft_2fmessage_2eproto[0]);
+}
+
+// ===================================================================
+
+class UIMessage::_Internal {
+ public:
+  static const ::dsnet::minbft::proto::Prepare& prepare(const UIMessage* msg);
+  static const ::dsnet::minbft::proto::Commit& commit(const UIMessage* msg);
+  static const ::dsnet::minbft::proto::Checkpoint& checkpoint(const UIMessage* msg);
+};
+
+const ::dsnet::minbft::proto::Prepare&
+UIMessage::_Internal::prepare(const UIMessage* msg) {
+  return *msg->_impl_.sub_.prepare_;
+}
+const ::dsnet::minbft::proto::Commit&
+UIMessage::_Internal::commit(const UIMessage* msg) {
+  return *msg->_impl_.sub_.commit_;
+}
+const ::dsnet::minbft::proto::Checkpoint&
+UIMessage::_Internal::checkpoint(const UIMessage* msg) {
+  return *msg->_impl_.sub_.checkpoint_;
+}
+void UIMessage::set_allocated_prepare(::dsnet::minbft::proto::Prepare* prepare) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  clear_sub();
+  if (prepare) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(prepare);
+    if (message_arena != submessage_arena) {
+      prepare = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, prepare, submessage_arena);
+    }
+    set_has_prepare();
+    _impl_.sub_.prepare_ = prepare;
+  }
+  // @@protoc_insertion_point(field_set_allocated:dsnet.minbft.proto.UIMessage.prepare)
+}
+void UIMessage::set_allocated_commit(::dsnet::minbft::proto::Commit* commit) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  clear_sub();
+  if (commit) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(commit);
+    if (message_arena != submessage_arena) {
+      commit = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, commit, submessage_arena);
+    }
+    set_has_commit();
+    _impl_.sub_.commit_ = commit;
+  }
+  // @@protoc_insertion_point(field_set_allocated:dsnet.minbft.proto.UIMessage.commit)
+}
+void UIMessage::set_allocated_checkpoint(::dsnet::minbft::proto::Checkpoint* checkpoint) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  clear_sub();
+  if (checkpoint) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(checkpoint);
+    if (message_arena != submessage_arena) {
+      checkpoint = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, checkpoint, submessage_arena);
+    }
+    set_has_checkpoint();
+    _impl_.sub_.checkpoint_ = checkpoint;
+  }
+  // @@protoc_insertion_point(field_set_allocated:dsnet.minbft.proto.UIMessage.checkpoint)
+}
+UIMessage::UIMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:dsnet.minbft.proto.UIMessage)
+}
+UIMessage::UIMessage(const UIMessage& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  UIMessage* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.replica_id_){}
+    , decltype(_impl_.sub_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , /*decltype(_impl_._oneof_case_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _this->_impl_.replica_id_ = from._impl_.replica_id_;
+  clear_has_sub();
+  switch (from.sub_case()) {
+    case kPrepare: {
+      _this->_internal_mutable_prepare()->::dsnet::minbft::proto::Prepare::MergeFrom(
+          from._internal_prepare());
+      break;
+    }
+    case kCommit: {
+      _this->_internal_mutable_commit()->::dsnet::minbft::proto::Commit::MergeFrom(
+          from._internal_commit());
+      break;
+    }
+    case kCheckpoint: {
+      _this->_internal_mutable_checkpoint()->::dsnet::minbft::proto::Checkpoint::MergeFrom(
+          from._internal_checkpoint());
+      break;
+    }
+    case SUB_NOT_SET: {
+      break;
+    }
+  }
+  // @@protoc_insertion_point(copy_constructor:dsnet.minbft.proto.UIMessage)
+}
+
+inline void UIMessage::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.replica_id_){0}
+    , decltype(_impl_.sub_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , /*decltype(_impl_._oneof_case_)*/{}
+  };
+  clear_has_sub();
+}
+
+UIMessage::~UIMessage() {
+  // @@protoc_insertion_point(destructor:dsnet.minbft.proto.UIMessage)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void UIMessage::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  if (has_sub()) {
+    clear_sub();
+  }
+}
+
+void UIMessage::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void UIMessage::clear_sub() {
+// @@protoc_insertion_point(one_of_clear_start:dsnet.minbft.proto.UIMessage)
+  switch (sub_case()) {
+    case kPrepare: {
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.sub_.prepare_;
+      }
+      break;
+    }
+    case kCommit: {
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.sub_.commit_;
+      }
+      break;
+    }
+    case kCheckpoint: {
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.sub_.checkpoint_;
+      }
+      break;
+    }
+    case SUB_NOT_SET: {
+      break;
+    }
+  }
+  _impl_._oneof_case_[0] = SUB_NOT_SET;
+}
+
+
+void UIMessage::Clear() {
+// @@protoc_insertion_point(message_clear_start:dsnet.minbft.proto.UIMessage)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.replica_id_ = 0;
+  clear_sub();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* UIMessage::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // .dsnet.minbft.proto.Prepare prepare = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr = ctx->ParseMessage(_internal_mutable_prepare(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .dsnet.minbft.proto.Commit commit = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr = ctx->ParseMessage(_internal_mutable_commit(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int32 replica_id = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.replica_id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .dsnet.minbft.proto.Checkpoint checkpoint = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          ptr = ctx->ParseMessage(_internal_mutable_checkpoint(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* UIMessage::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:dsnet.minbft.proto.UIMessage)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // .dsnet.minbft.proto.Prepare prepare = 1;
+  if (_internal_has_prepare()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(1, _Internal::prepare(this),
+        _Internal::prepare(this).GetCachedSize(), target, stream);
+  }
+
+  // .dsnet.minbft.proto.Commit commit = 2;
+  if (_internal_has_commit()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(2, _Internal::commit(this),
+        _Internal::commit(this).GetCachedSize(), target, stream);
+  }
+
+  // int32 replica_id = 3;
+  if (this->_internal_replica_id() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(3, this->_internal_replica_id(), target);
+  }
+
+  // .dsnet.minbft.proto.Checkpoint checkpoint = 4;
+  if (_internal_has_checkpoint()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(4, _Internal::checkpoint(this),
+        _Internal::checkpoint(this).GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:dsnet.minbft.proto.UIMessage)
+  return target;
+}
+
+size_t UIMessage::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:dsnet.minbft.proto.UIMessage)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // int32 replica_id = 3;
+  if (this->_internal_replica_id() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_replica_id());
+  }
+
+  switch (sub_case()) {
+    // .dsnet.minbft.proto.Prepare prepare = 1;
+    case kPrepare: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.sub_.prepare_);
+      break;
+    }
+    // .dsnet.minbft.proto.Commit commit = 2;
+    case kCommit: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.sub_.commit_);
+      break;
+    }
+    // .dsnet.minbft.proto.Checkpoint checkpoint = 4;
+    case kCheckpoint: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.sub_.checkpoint_);
+      break;
+    }
+    case SUB_NOT_SET: {
+      break;
+    }
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData UIMessage::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    UIMessage::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*UIMessage::GetClassData() const { return &_class_data_; }
+
+
+void UIMessage::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<UIMessage*>(&to_msg);
+  auto& from = static_cast<const UIMessage&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:dsnet.minbft.proto.UIMessage)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_replica_id() != 0) {
+    _this->_internal_set_replica_id(from._internal_replica_id());
+  }
+  switch (from.sub_case()) {
+    case kPrepare: {
+      _this->_internal_mutable_prepare()->::dsnet::minbft::proto::Prepare::MergeFrom(
+          from._internal_prepare());
+      break;
+    }
+    case kCommit: {
+      _this->_internal_mutable_commit()->::dsnet::minbft::proto::Commit::MergeFrom(
+          from._internal_commit());
+      break;
+    }
+    case kCheckpoint: {
+      _this->_internal_mutable_checkpoint()->::dsnet::minbft::proto::Checkpoint::MergeFrom(
+          from._internal_checkpoint());
+      break;
+    }
+    case SUB_NOT_SET: {
+      break;
+    }
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void UIMessage::CopyFrom(const UIMessage& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:dsnet.minbft.proto.UIMessage)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool UIMessage::IsInitialized() const {
+  return true;
+}
+
+void UIMessage::InternalSwap(UIMessage* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_.replica_id_, other->_impl_.replica_id_);
+  swap(_impl_.sub_, other->_impl_.sub_);
+  swap(_impl_._oneof_case_[0], other->_impl_._oneof_case_[0]);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata UIMessage::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_replication_2fminbft_2fmessage_2eproto_getter, &descriptor_table_replication_2fminbft_2fmessage_2eproto_once,
+      file_level_metadata_replication_2fminbft_2fmessage_2eproto[1]);
+}
+
+// ===================================================================
+
+class Reply::_Internal {
+ public:
+};
+
+Reply::Reply(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:dsnet.minbft.proto.Reply)
+}
+Reply::Reply(const Reply& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  Reply* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.result_){}
+    , decltype(_impl_.request_number_){}
+    , decltype(_impl_.replica_id_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.result_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.result_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_result().empty()) {
+    _this->_impl_.result_.Set(from._internal_result(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.request_number_, &from._impl_.request_number_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.replica_id_) -
+    reinterpret_cast<char*>(&_impl_.request_number_)) + sizeof(_impl_.replica_id_));
+  // @@protoc_insertion_point(copy_constructor:dsnet.minbft.proto.Reply)
+}
+
+inline void Reply::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.result_){}
+    , decltype(_impl_.request_number_){uint64_t{0u}}
+    , decltype(_impl_.replica_id_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.result_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.result_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+Reply::~Reply() {
+  // @@protoc_insertion_point(destructor:dsnet.minbft.proto.Reply)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void Reply::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.result_.Destroy();
+}
+
+void Reply::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void Reply::Clear() {
+// @@protoc_insertion_point(message_clear_start:dsnet.minbft.proto.Reply)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.result_.ClearToEmpty();
+  ::memset(&_impl_.request_number_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.replica_id_) -
+      reinterpret_cast<char*>(&_impl_.request_number_)) + sizeof(_impl_.replica_id_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* Reply::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // bytes result = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_result();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int32 replica_id = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.replica_id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 request_number = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.request_number_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* Reply::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:dsnet.minbft.proto.Reply)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // bytes result = 1;
+  if (!this->_internal_result().empty()) {
+    target = stream->WriteBytesMaybeAliased(
+        1, this->_internal_result(), target);
+  }
+
+  // int32 replica_id = 2;
+  if (this->_internal_replica_id() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(2, this->_internal_replica_id(), target);
+  }
+
+  // uint64 request_number = 3;
+  if (this->_internal_request_number() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(3, this->_internal_request_number(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:dsnet.minbft.proto.Reply)
+  return target;
+}
+
+size_t Reply::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:dsnet.minbft.proto.Reply)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // bytes result = 1;
+  if (!this->_internal_result().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_result());
+  }
+
+  // uint64 request_number = 3;
+  if (this->_internal_request_number() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_request_number());
+  }
+
+  // int32 replica_id = 2;
+  if (this->_internal_replica_id() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_replica_id());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData Reply::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    Reply::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*Reply::GetClassData() const { return &_class_data_; }
+
+
+void Reply::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<Reply*>(&to_msg);
+  auto& from = static_cast<const Reply&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:dsnet.minbft.proto.Reply)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_result().empty()) {
+    _this->_internal_set_result(from._internal_result());
+  }
+  if (from._internal_request_number() != 0) {
+    _this->_internal_set_request_number(from._internal_request_number());
+  }
+  if (from._internal_replica_id() != 0) {
+    _this->_internal_set_replica_id(from._internal_replica_id());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void Reply::CopyFrom(const Reply& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:dsnet.minbft.proto.Reply)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool Reply::IsInitialized() const {
+  return true;
+}
+
+void Reply::InternalSwap(Reply* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.result_, lhs_arena,
+      &other->_impl_.result_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(Reply, _impl_.replica_id_)
+      + sizeof(Reply::_impl_.replica_id_)
+      - PROTOBUF_FIELD_OFFSET(Reply, _impl_.request_number_)>(
+          reinterpret_cast<char*>(&_impl_.request_number_),
+          reinterpret_cast<char*>(&other->_impl_.request_number_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata Reply::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_replication_2fminbft_2fmessage_2eproto_getter, &descriptor_table_replication_2fminbft_2fmessage_2eproto_once,
+      file_level_metadata_replication_2fminbft_2fmessage_2eproto[2]);
+}
+
+// ===================================================================
+
+class Prepare::_Internal {
+ public:
+};
+
+Prepare::Prepare(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:dsnet.minbft.proto.Prepare)
+}
+Prepare::Prepare(const Prepare& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  Prepare* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.signed_request_){from._impl_.signed_request_}
+    , decltype(_impl_.view_number_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _this->_impl_.view_number_ = from._impl_.view_number_;
+  // @@protoc_insertion_point(copy_constructor:dsnet.minbft.proto.Prepare)
+}
+
+inline void Prepare::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.signed_request_){arena}
+    , decltype(_impl_.view_number_){uint64_t{0u}}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+Prepare::~Prepare() {
+  // @@protoc_insertion_point(destructor:dsnet.minbft.proto.Prepare)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void Prepare::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.signed_request_.~RepeatedPtrField();
+}
+
+void Prepare::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void Prepare::Clear() {
+// @@protoc_insertion_point(message_clear_start:dsnet.minbft.proto.Prepare)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.signed_request_.Clear();
+  _impl_.view_number_ = uint64_t{0u};
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* Prepare::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // uint64 view_number = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.view_number_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated bytes signed_request = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            auto str = _internal_add_signed_request();
+            ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<18>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* Prepare::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:dsnet.minbft.proto.Prepare)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // uint64 view_number = 1;
+  if (this->_internal_view_number() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(1, this->_internal_view_number(), target);
+  }
+
+  // repeated bytes signed_request = 2;
+  for (int i = 0, n = this->_internal_signed_request_size(); i < n; i++) {
+    const auto& s = this->_internal_signed_request(i);
+    target = stream->WriteBytes(2, s, target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:dsnet.minbft.proto.Prepare)
+  return target;
+}
+
+size_t Prepare::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:dsnet.minbft.proto.Prepare)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated bytes signed_request = 2;
+  total_size += 1 *
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(_impl_.signed_request_.size());
+  for (int i = 0, n = _impl_.signed_request_.size(); i < n; i++) {
+    total_size += ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+      _impl_.signed_request_.Get(i));
+  }
+
+  // uint64 view_number = 1;
+  if (this->_internal_view_number() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_view_number());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData Prepare::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    Prepare::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*Prepare::GetClassData() const { return &_class_data_; }
+
+
+void Prepare::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<Prepare*>(&to_msg);
+  auto& from = static_cast<const Prepare&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:dsnet.minbft.proto.Prepare)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.signed_request_.MergeFrom(from._impl_.signed_request_);
+  if (from._internal_view_number() != 0) {
+    _this->_internal_set_view_number(from._internal_view_number());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void Prepare::CopyFrom(const Prepare& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:dsnet.minbft.proto.Prepare)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool Prepare::IsInitialized() const {
+  return true;
+}
+
+void Prepare::InternalSwap(Prepare* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.signed_request_.InternalSwap(&other->_impl_.signed_request_);
+  swap(_impl_.view_number_, other->_impl_.view_number_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata Prepare::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_replication_2fminbft_2fmessage_2eproto_getter, &descriptor_table_replication_2fminbft_2fmessage_2eproto_once,
+      file_level_metadata_replication_2fminbft_2fmessage_2eproto[3]);
+}
+
+// ===================================================================
+
+class Commit::_Internal {
+ public:
+};
+
+Commit::Commit(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:dsnet.minbft.proto.Commit)
+}
+Commit::Commit(const Commit& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  Commit* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.view_number_){}
+    , decltype(_impl_.primary_ui_){}
+    , decltype(_impl_.replica_id_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.view_number_, &from._impl_.view_number_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.replica_id_) -
+    reinterpret_cast<char*>(&_impl_.view_number_)) + sizeof(_impl_.replica_id_));
+  // @@protoc_insertion_point(copy_constructor:dsnet.minbft.proto.Commit)
+}
+
+inline void Commit::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.view_number_){uint64_t{0u}}
+    , decltype(_impl_.primary_ui_){uint64_t{0u}}
+    , decltype(_impl_.replica_id_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+Commit::~Commit() {
+  // @@protoc_insertion_point(destructor:dsnet.minbft.proto.Commit)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void Commit::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void Commit::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void Commit::Clear() {
+// @@protoc_insertion_point(message_clear_start:dsnet.minbft.proto.Commit)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  ::memset(&_impl_.view_number_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.replica_id_) -
+      reinterpret_cast<char*>(&_impl_.view_number_)) + sizeof(_impl_.replica_id_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* Commit::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // uint64 view_number = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.view_number_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 primary_ui = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.primary_ui_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int32 replica_id = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.replica_id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* Commit::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:dsnet.minbft.proto.Commit)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // uint64 view_number = 1;
+  if (this->_internal_view_number() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(1, this->_internal_view_number(), target);
+  }
+
+  // uint64 primary_ui = 2;
+  if (this->_internal_primary_ui() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(2, this->_internal_primary_ui(), target);
+  }
+
+  // int32 replica_id = 3;
+  if (this->_internal_replica_id() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(3, this->_internal_replica_id(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:dsnet.minbft.proto.Commit)
+  return target;
+}
+
+size_t Commit::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:dsnet.minbft.proto.Commit)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // uint64 view_number = 1;
+  if (this->_internal_view_number() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_view_number());
+  }
+
+  // uint64 primary_ui = 2;
+  if (this->_internal_primary_ui() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_primary_ui());
+  }
+
+  // int32 replica_id = 3;
+  if (this->_internal_replica_id() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_replica_id());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData Commit::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    Commit::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*Commit::GetClassData() const { return &_class_data_; }
+
+
+void Commit::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<Commit*>(&to_msg);
+  auto& from = static_cast<const Commit&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:dsnet.minbft.proto.Commit)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_view_number() != 0) {
+    _this->_internal_set_view_number(from._internal_view_number());
+  }
+  if (from._internal_primary_ui() != 0) {
+    _this->_internal_set_primary_ui(from._internal_primary_ui());
+  }
+  if (from._internal_replica_id() != 0) {
+    _this->_internal_set_replica_id(from._internal_replica_id());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void Commit::CopyFrom(const Commit& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:dsnet.minbft.proto.Commit)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool Commit::IsInitialized() const {
+  return true;
+}
+
+void Commit::InternalSwap(Commit* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(Commit, _impl_.replica_id_)
+      + sizeof(Commit::_impl_.replica_id_)
+      - PROTOBUF_FIELD_OFFSET(Commit, _impl_.view_number_)>(
+          reinterpret_cast<char*>(&_impl_.view_number_),
+          reinterpret_cast<char*>(&other->_impl_.view_number_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata Commit::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_replication_2fminbft_2fmessage_2eproto_getter, &descriptor_table_replication_2fminbft_2fmessage_2eproto_once,
+      file_level_metadata_replication_2fminbft_2fmessage_2eproto[4]);
+}
+
+// ===================================================================
+
+class Checkpoint::_Internal {
+ public:
+};
+
+Checkpoint::Checkpoint(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:dsnet.minbft.proto.Checkpoint)
+}
+Checkpoint::Checkpoint(const Checkpoint& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  Checkpoint* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.digest_){}
+    , decltype(_impl_.op_number_){}
+    , decltype(_impl_.replica_id_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.digest_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.digest_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_digest().empty()) {
+    _this->_impl_.digest_.Set(from._internal_digest(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.op_number_, &from._impl_.op_number_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.replica_id_) -
+    reinterpret_cast<char*>(&_impl_.op_number_)) + sizeof(_impl_.replica_id_));
+  // @@protoc_insertion_point(copy_constructor:dsnet.minbft.proto.Checkpoint)
+}
+
+inline void Checkpoint::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.digest_){}
+    , decltype(_impl_.op_number_){uint64_t{0u}}
+    , decltype(_impl_.replica_id_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.digest_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.digest_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+Checkpoint::~Checkpoint() {
+  // @@protoc_insertion_point(destructor:dsnet.minbft.proto.Checkpoint)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void Checkpoint::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.digest_.Destroy();
+}
+
+void Checkpoint::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void Checkpoint::Clear() {
+// @@protoc_insertion_point(message_clear_start:dsnet.minbft.proto.Checkpoint)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.digest_.ClearToEmpty();
+  ::memset(&_impl_.op_number_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.replica_id_) -
+      reinterpret_cast<char*>(&_impl_.op_number_)) + sizeof(_impl_.replica_id_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* Checkpoint::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // uint64 op_number = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.op_number_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int32 replica_id = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.replica_id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // bytes digest = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          auto str = _internal_mutable_digest();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* Checkpoint::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:dsnet.minbft.proto.Checkpoint)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // uint64 op_number = 1;
+  if (this->_internal_op_number() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(1, this->_internal_op_number(), target);
+  }
+
+  // int32 replica_id = 2;
+  if (this->_internal_replica_id() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(2, this->_internal_replica_id(), target);
+  }
+
+  // bytes digest = 3;
+  if (!this->_internal_digest().empty()) {
+    target = stream->WriteBytesMaybeAliased(
+        3, this->_internal_digest(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:dsnet.minbft.proto.Checkpoint)
+  return target;
+}
+
+size_t Checkpoint::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:dsnet.minbft.proto.Checkpoint)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // bytes digest = 3;
+  if (!this->_internal_digest().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_digest());
+  }
+
+  // uint64 op_number = 1;
+  if (this->_internal_op_number() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_op_number());
+  }
+
+  // int32 replica_id = 2;
+  if (this->_internal_replica_id() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_replica_id());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData Checkpoint::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    Checkpoint::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*Checkpoint::GetClassData() const { return &_class_data_; }
+
+
+void Checkpoint::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<Checkpoint*>(&to_msg);
+  auto& from = static_cast<const Checkpoint&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:dsnet.minbft.proto.Checkpoint)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_digest().empty()) {
+    _this->_internal_set_digest(from._internal_digest());
+  }
+  if (from._internal_op_number() != 0) {
+    _this->_internal_set_op_number(from._internal_op_number());
+  }
+  if (from._internal_replica_id() != 0) {
+    _this->_internal_set_replica_id(from._internal_replica_id());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void Checkpoint::CopyFrom(const Checkpoint& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:dsnet.minbft.proto.Checkpoint)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool Checkpoint::IsInitialized() const {
+  return true;
+}
+
+void Checkpoint::InternalSwap(Checkpoint* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.digest_, lhs_arena,
+      &other->_impl_.digest_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(Checkpoint, _impl_.replica_id_)
+      + sizeof(Checkpoint::_impl_.replica_id_)
+      - PROTOBUF_FIELD_OFFSET(Checkpoint, _impl_.op_number_)>(
+          reinterpret_cast<char*>(&_impl_.op_number_),
+          reinterpret_cast<char*>(&other->_impl_.op_number_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata Checkpoint::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_replication_2fminbft_2fmessage_2eproto_getter, &descriptor_table_replication_2fminbft_2fmessage_2eproto_once,
+      file_level_metadata_replication_2fminbft_2fmessage_2eproto[5]);
+}
+
+// ===================================================================
+
+class StateRequest::_Internal {
+ public:
+};
+
+StateRequest::StateRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:dsnet.minbft.proto.StateRequest)
+}
+StateRequest::StateRequest(const StateRequest& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  StateRequest* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.ui_){}
+    , decltype(_impl_.last_ui_){}
+    , decltype(_impl_.replica_id_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.ui_, &from._impl_.ui_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.replica_id_) -
+    reinterpret_cast<char*>(&_impl_.ui_)) + sizeof(_impl_.replica_id_));
+  // @@protoc_insertion_point(copy_constructor:dsnet.minbft.proto.StateRequest)
+}
+
+inline void StateRequest::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.ui_){uint64_t{0u}}
+    , decltype(_impl_.last_ui_){uint64_t{0u}}
+    , decltype(_impl_.replica_id_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+StateRequest::~StateRequest() {
+  // @@protoc_insertion_point(destructor:dsnet.minbft.proto.StateRequest)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void StateRequest::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void StateRequest::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void StateRequest::Clear() {
+// @@protoc_insertion_point(message_clear_start:dsnet.minbft.proto.StateRequest)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  ::memset(&_impl_.ui_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.replica_id_) -
+      reinterpret_cast<char*>(&_impl_.ui_)) + sizeof(_impl_.replica_id_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* StateRequest::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // uint64 ui = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.ui_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 last_ui = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.last_ui_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int32 replica_id = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.replica_id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* StateRequest::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:dsnet.minbft.proto.StateRequest)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // uint64 ui = 1;
+  if (this->_internal_ui() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(1, this->_internal_ui(), target);
+  }
+
+  // uint64 last_ui = 2;
+  if (this->_internal_last_ui() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(2, this->_internal_last_ui(), target);
+  }
+
+  // int32 replica_id = 3;
+  if (this->_internal_replica_id() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(3, this->_internal_replica_id(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:dsnet.minbft.proto.StateRequest)
+  return target;
+}
+
+size_t StateRequest::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:dsnet.minbft.proto.StateRequest)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // uint64 ui = 1;
+  if (this->_internal_ui() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_ui());
+  }
+
+  // uint64 last_ui = 2;
+  if (this->_internal_last_ui() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_last_ui());
+  }
+
+  // int32 replica_id = 3;
+  if (this->_internal_replica_id() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_replica_id());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData StateRequest::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    StateRequest::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*StateRequest::GetClassData() const { return &_class_data_; }
+
+
+void StateRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<StateRequest*>(&to_msg);
+  auto& from = static_cast<const StateRequest&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:dsnet.minbft.proto.StateRequest)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_ui() != 0) {
+    _this->_internal_set_ui(from._internal_ui());
+  }
+  if (from._internal_last_ui() != 0) {
+    _this->_internal_set_last_ui(from._internal_last_ui());
+  }
+  if (from._internal_replica_id() != 0) {
+    _this->_internal_set_replica_id(from._internal_replica_id());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void StateRequest::CopyFrom(const StateRequest& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:dsnet.minbft.proto.StateRequest)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool StateRequest::IsInitialized() const {
+  return true;
+}
+
+void StateRequest::InternalSwap(StateRequest* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(StateRequest, _impl_.replica_id_)
+      + sizeof(StateRequest::_impl_.replica_id_)
+      - PROTOBUF_FIELD_OFFSET(StateRequest, _impl_.ui_)>(
+          reinterpret_cast<char*>(&_impl_.ui_),
+          reinterpret_cast<char*>(&other->_impl_.ui_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata StateRequest::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_replication_2fminbft_2fmessage_2eproto_getter, &descriptor_table_replication_2fminbft_2fmessage_2eproto_once,
+      file_level_metadata_replication_2fminbft_2fmessage_2eproto[6]);
+}
+
+// ===================================================================
+
+class StateChunk::_Internal {
+ public:
+  static const ::dsnet::minbft::proto::StableCheckpoint& checkpoint(const StateChunk* msg);
+};
+
+const ::dsnet::minbft::proto::StableCheckpoint&
+StateChunk::_Internal::checkpoint(const StateChunk* msg) {
+  return *msg->_impl_.checkpoint_;
+}
+StateChunk::StateChunk(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:dsnet.minbft.proto.StateChunk)
+}
+StateChunk::StateChunk(const StateChunk& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  StateChunk* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.ui_message_){from._impl_.ui_message_}
+    , decltype(_impl_.checkpoint_){nullptr}
+    , decltype(_impl_.ui_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  if (from._internal_has_checkpoint()) {
+    _this->_impl_.checkpoint_ = new ::dsnet::minbft::proto::StableCheckpoint(*from._impl_.checkpoint_);
+  }
+  _this->_impl_.ui_ = from._impl_.ui_;
+  // @@protoc_insertion_point(copy_constructor:dsnet.minbft.proto.StateChunk)
+}
+
+inline void StateChunk::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.ui_message_){arena}
+    , decltype(_impl_.checkpoint_){nullptr}
+    , decltype(_impl_.ui_){uint64_t{0u}}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+StateChunk::~StateChunk() {
+  // @@protoc_insertion_point(destructor:dsnet.minbft.proto.StateChunk)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void StateChunk::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.ui_message_.~RepeatedPtrField();
+  if (this != internal_default_instance()) delete _impl_.checkpoint_;
+}
+
+void StateChunk::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void StateChunk::Clear() {
+// @@protoc_insertion_point(message_clear_start:dsnet.minbft.proto.StateChunk)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.ui_message_.Clear();
+  if (GetArenaForAllocation() == nullptr && _impl_.checkpoint_ != nullptr) {
+    delete _impl_.checkpoint_;
+  }
+  _impl_.checkpoint_ = nullptr;
+  _impl_.ui_ = uint64_t{0u};
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* StateChunk::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // uint64 ui = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.ui_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated bytes ui_message = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            auto str = _internal_add_ui_message();
+            ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<18>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // .dsnet.minbft.proto.StableCheckpoint checkpoint = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          ptr = ctx->ParseMessage(_internal_mutable_checkpoint(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* StateChunk::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:dsnet.minbft.proto.StateChunk)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // uint64 ui = 1;
+  if (this->_internal_ui() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(1, this->_internal_ui(), target);
+  }
+
+  // repeated bytes ui_message = 2;
+  for (int i = 0, n = this->_internal_ui_message_size(); i < n; i++) {
+    const auto& s = this->_internal_ui_message(i);
+    target = stream->WriteBytes(2, s, target);
+  }
+
+  // .dsnet.minbft.proto.StableCheckpoint checkpoint = 3;
+  if (this->_internal_has_checkpoint()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(3, _Internal::checkpoint(this),
+        _Internal::checkpoint(this).GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:dsnet.minbft.proto.StateChunk)
+  return target;
+}
+
+size_t StateChunk::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:dsnet.minbft.proto.StateChunk)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated bytes ui_message = 2;
+  total_size += 1 *
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(_impl_.ui_message_.size());
+  for (int i = 0, n = _impl_.ui_message_.size(); i < n; i++) {
+    total_size += ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+      _impl_.ui_message_.Get(i));
+  }
+
+  // .dsnet.minbft.proto.StableCheckpoint checkpoint = 3;
+  if (this->_internal_has_checkpoint()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.checkpoint_);
+  }
+
+  // uint64 ui = 1;
+  if (this->_internal_ui() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_ui());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData StateChunk::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    StateChunk::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*StateChunk::GetClassData() const { return &_class_data_; }
+
+
+void StateChunk::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<StateChunk*>(&to_msg);
+  auto& from = static_cast<const StateChunk&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:dsnet.minbft.proto.StateChunk)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.ui_message_.MergeFrom(from._impl_.ui_message_);
+  if (from._internal_has_checkpoint()) {
+    _this->_internal_mutable_checkpoint()->::dsnet::minbft::proto::StableCheckpoint::MergeFrom(
+        from._internal_checkpoint());
+  }
+  if (from._internal_ui() != 0) {
+    _this->_internal_set_ui(from._internal_ui());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void StateChunk::CopyFrom(const StateChunk& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:dsnet.minbft.proto.StateChunk)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool StateChunk::IsInitialized() const {
+  return true;
+}
+
+void StateChunk::InternalSwap(StateChunk* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.ui_message_.InternalSwap(&other->_impl_.ui_message_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(StateChunk, _impl_.ui_)
+      + sizeof(StateChunk::_impl_.ui_)
+      - PROTOBUF_FIELD_OFFSET(StateChunk, _impl_.checkpoint_)>(
+          reinterpret_cast<char*>(&_impl_.checkpoint_),
+          reinterpret_cast<char*>(&other->_impl_.checkpoint_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata StateChunk::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_replication_2fminbft_2fmessage_2eproto_getter, &descriptor_table_replication_2fminbft_2fmessage_2eproto_once,
+      file_level_metadata_replication_2fminbft_2fmessage_2eproto[7]);
+}
+
+// ===================================================================
+
+class StableCheckpoint::_Internal {
+ public:
+};
+
+StableCheckpoint::StableCheckpoint(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:dsnet.minbft.proto.StableCheckpoint)
+}
+StableCheckpoint::StableCheckpoint(const StableCheckpoint& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  StableCheckpoint* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.ui_checkpoint_){from._impl_.ui_checkpoint_}
+    , decltype(_impl_.app_state_){}
+    , decltype(_impl_.digest_){}
+    , decltype(_impl_.op_number_){}
+    , decltype(_impl_.collected_ui_){}
+    , decltype(_impl_.collected_op_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.app_state_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.app_state_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_app_state().empty()) {
+    _this->_impl_.app_state_.Set(from._internal_app_state(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.digest_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.digest_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_digest().empty()) {
+    _this->_impl_.digest_.Set(from._internal_digest(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.op_number_, &from._impl_.op_number_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.collected_op_) -
+    reinterpret_cast<char*>(&_impl_.op_number_)) + sizeof(_impl_.collected_op_));
+  // @@protoc_insertion_point(copy_constructor:dsnet.minbft.proto.StableCheckpoint)
+}
+
+inline void StableCheckpoint::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.ui_checkpoint_){arena}
+    , decltype(_impl_.app_state_){}
+    , decltype(_impl_.digest_){}
+    , decltype(_impl_.op_number_){uint64_t{0u}}
+    , decltype(_impl_.collected_ui_){uint64_t{0u}}
+    , decltype(_impl_.collected_op_){uint64_t{0u}}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.app_state_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.app_state_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.digest_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.digest_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+StableCheckpoint::~StableCheckpoint() {
+  // @@protoc_insertion_point(destructor:dsnet.minbft.proto.StableCheckpoint)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void StableCheckpoint::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.ui_checkpoint_.~RepeatedPtrField();
+  _impl_.app_state_.Destroy();
+  _impl_.digest_.Destroy();
+}
+
+void StableCheckpoint::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void StableCheckpoint::Clear() {
+// @@protoc_insertion_point(message_clear_start:dsnet.minbft.proto.StableCheckpoint)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.ui_checkpoint_.Clear();
+  _impl_.app_state_.ClearToEmpty();
+  _impl_.digest_.ClearToEmpty();
+  ::memset(&_impl_.op_number_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.collected_op_) -
+      reinterpret_cast<char*>(&_impl_.op_number_)) + sizeof(_impl_.collected_op_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* StableCheckpoint::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // uint64 op_number = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.op_number_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // bytes app_state = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_app_state();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated bytes ui_checkpoint = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            auto str = _internal_add_ui_checkpoint();
+            ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<26>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 collected_ui = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _impl_.collected_ui_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 collected_op = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          _impl_.collected_op_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // bytes digest = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 50)) {
+          auto str = _internal_mutable_digest();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* StableCheckpoint::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:dsnet.minbft.proto.StableCheckpoint)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // uint64 op_number = 1;
+  if (this->_internal_op_number() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(1, this->_internal_op_number(), target);
+  }
+
+  // bytes app_state = 2;
+  if (!this->_internal_app_state().empty()) {
+    target = stream->WriteBytesMaybeAliased(
+        2, this->_internal_app_state(), target);
+  }
+
+  // repeated bytes ui_checkpoint = 3;
+  for (int i = 0, n = this->_internal_ui_checkpoint_size(); i < n; i++) {
+    const auto& s = this->_internal_ui_checkpoint(i);
+    target = stream->WriteBytes(3, s, target);
+  }
+
+  // uint64 collected_ui = 4;
+  if (this->_internal_collected_ui() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(4, this->_internal_collected_ui(), target);
+  }
+
+  // uint64 collected_op = 5;
+  if (this->_internal_collected_op() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(5, this->_internal_collected_op(), target);
+  }
+
+  // bytes digest = 6;
+  if (!this->_internal_digest().empty()) {
+    target = stream->WriteBytesMaybeAliased(
+        6, this->_internal_digest(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:dsnet.minbft.proto.StableCheckpoint)
+  return target;
+}
+
+size_t StableCheckpoint::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:dsnet.minbft.proto.StableCheckpoint)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated bytes ui_checkpoint = 3;
+  total_size += 1 *
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(_impl_.ui_checkpoint_.size());
+  for (int i = 0, n = _impl_.ui_checkpoint_.size(); i < n; i++) {
+    total_size += ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+      _impl_.ui_checkpoint_.Get(i));
+  }
+
+  // bytes app_state = 2;
+  if (!this->_internal_app_state().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_app_state());
+  }
+
+  // bytes digest = 6;
+  if (!this->_internal_digest().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_digest());
+  }
+
+  // uint64 op_number = 1;
+  if (this->_internal_op_number() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_op_number());
+  }
+
+  // uint64 collected_ui = 4;
+  if (this->_internal_collected_ui() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_collected_ui());
+  }
+
+  // uint64 collected_op = 5;
+  if (this->_internal_collected_op() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_collected_op());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData StableCheckpoint::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    StableCheckpoint::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*StableCheckpoint::GetClassData() const { return &_class_data_; }
+
+
+void StableCheckpoint::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<StableCheckpoint*>(&to_msg);
+  auto& from = static_cast<const StableCheckpoint&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:dsnet.minbft.proto.StableCheckpoint)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.ui_checkpoint_.MergeFrom(from._impl_.ui_checkpoint_);
+  if (!from._internal_app_state().empty()) {
+    _this->_internal_set_app_state(from._internal_app_state());
+  }
+  if (!from._internal_digest().empty()) {
+    _this->_internal_set_digest(from._internal_digest());
+  }
+  if (from._internal_op_number() != 0) {
+    _this->_internal_set_op_number(from._internal_op_number());
+  }
+  if (from._internal_collected_ui() != 0) {
+    _this->_internal_set_collected_ui(from._internal_collected_ui());
+  }
+  if (from._internal_collected_op() != 0) {
+    _this->_internal_set_collected_op(from._internal_collected_op());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void StableCheckpoint::CopyFrom(const StableCheckpoint& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:dsnet.minbft.proto.StableCheckpoint)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool StableCheckpoint::IsInitialized() const {
+  return true;
+}
+
+void StableCheckpoint::InternalSwap(StableCheckpoint* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.ui_checkpoint_.InternalSwap(&other->_impl_.ui_checkpoint_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.app_state_, lhs_arena,
+      &other->_impl_.app_state_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.digest_, lhs_arena,
+      &other->_impl_.digest_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(StableCheckpoint, _impl_.collected_op_)
+      + sizeof(StableCheckpoint::_impl_.collected_op_)
+      - PROTOBUF_FIELD_OFFSET(StableCheckpoint, _impl_.op_number_)>(
+          reinterpret_cast<char*>(&_impl_.op_number_),
+          reinterpret_cast<char*>(&other->_impl_.op_number_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata StableCheckpoint::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_replication_2fminbft_2fmessage_2eproto_getter, &descriptor_table_replication_2fminbft_2fmessage_2eproto_once,
+      file_level_metadata_replication_2fminbft_2fmessage_2eproto[8]);
+}
+
+// @@protoc_insertion_point(namespace_scope)
+}  // namespace proto
+}  // namespace minbft
+}  // namespace dsnet
+PROTOBUF_NAMESPACE_OPEN
+template<> PROTOBUF_NOINLINE ::dsnet::minbft::proto::MinBFTMessage*
+Arena::CreateMaybeMessage< ::dsnet::minbft::proto::MinBFTMessage >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::dsnet::minbft::proto::MinBFTMessage >(arena);
+}
+template<> PROTOBUF_NOINLINE ::dsnet::minbft::proto::UIMessage*
+Arena::CreateMaybeMessage< ::dsnet::minbft::proto::UIMessage >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::dsnet::minbft::proto::UIMessage >(arena);
+}
+template<> PROTOBUF_NOINLINE ::dsnet::minbft::proto::Reply*
+Arena::CreateMaybeMessage< ::dsnet::minbft::proto::Reply >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::dsnet::minbft::proto::Reply >(arena);
+}
+template<> PROTOBUF_NOINLINE ::dsnet::minbft::proto::Prepare*
+Arena::CreateMaybeMessage< ::dsnet::minbft::proto::Prepare >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::dsnet::minbft::proto::Prepare >(arena);
+}
+template<> PROTOBUF_NOINLINE ::dsnet::minbft::proto::Commit*
+Arena::CreateMaybeMessage< ::dsnet::minbft::proto::Commit >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::dsnet::minbft::proto::Commit >(arena);
+}
+template<> PROTOBUF_NOINLINE ::dsnet::minbft::proto::Checkpoint*
+Arena::CreateMaybeMessage< ::dsnet::minbft::proto::Checkpoint >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::dsnet::minbft::proto::Checkpoint >(arena);
+}
+template<> PROTOBUF_NOINLINE ::dsnet::minbft::proto::StateRequest*
+Arena::CreateMaybeMessage< ::dsnet::minbft::proto::StateRequest >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::dsnet::minbft::proto::StateRequest >(arena);
+}
+template<> PROTOBUF_NOINLINE ::dsnet::minbft::proto::StateChunk*
+Arena::CreateMaybeMessage< ::dsnet::minbft::proto::StateChunk >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::dsnet::minbft::proto::StateChunk >(arena);
+}
+template<> PROTOBUF_NOINLINE ::dsnet::minbft::proto::StableCheckpoint*
+Arena::CreateMaybeMessage< ::dsnet::minbft::proto::StableCheckpoint >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::dsnet::minbft::proto::StableCheckpoint >(arena);
+}
+PROTOBUF_NAMESPACE_CLOSE
+
+// @@protoc_insertion_point(global_scope)
+#include <google/protobuf/port_undef.inc>
@@ -0,0 +1,3299 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: replication/minbft/message.proto
+
+#ifndef GOOGLE_PROTOBUF_INCLUDED_replication_2fminbft_2fmessage_2eproto
+#define GOOGLE_PROTOBUF_INCLUDED_replication_2fminbft_2fmessage_2eproto
+
+#include <limits>
+#include <string>
+
+#include <google/protobuf/port_def.inc>
+#if PROTOBUF_VERSION < 3021000
+#error This file was generated by a newer version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please update
+#error your headers.
+#endif
+#if 3021012 < PROTOBUF_MIN_PROTOC_VERSION
+#error This file was generated by an older version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please
+#error regenerate this file with a newer version of protoc.
+#endif
+
+#include <google/protobuf/port_undef.inc>
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/arena.h>
+#include <google/protobuf/arenastring.h>
+#include <google/protobuf/generated_message_util.h>
+#include <google/protobuf/metadata_lite.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/message.h>
+#include <google/protobuf/repeated_field.h>  // IWYU pragma: export
+#include <google/protobuf/extension_set.h>  // IWYU pragma: export
+#include <google/protobuf/unknown_field_set.h>
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+#define PROTOBUF_INTERNAL_EXPORT_replication_2fminbft_2fmessage_2eproto
+PROTOBUF_NAMESPACE_OPEN
+namespace internal {
+class AnyMetadata;
+}  // namespace internal
+PROTOBUF_NAMESPACE_CLOSE
+
+// Internal implementation detail -- do not use these members.
+struct TableStruct_replication_2fminbft_2fmessage_2eproto {
+  static const uint32_t offsets[];
+};
+extern const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_replication_2fminbft_2fmessage_2eproto;
+namespace dsnet {
+namespace minbft {
+namespace proto {
+class Checkpoint;
+struct CheckpointDefaultTypeInternal;
+extern CheckpointDefaultTypeInternal _Checkpoint_default_instance_;
+class Commit;
+struct CommitDefaultTypeInternal;
+extern CommitDefaultTypeInternal _Commit_default_instance_;
+class MinBFTMessage;
+struct MinBFTMessageDefaultTypeInternal;
+extern MinBFTMessageDefaultTypeInternal _MinBFTMessage_default_instance_;
+class Prepare;
+struct PrepareDefaultTypeInternal;
+extern PrepareDefaultTypeInternal _Prepare_default_instance_;
+class Reply;
+struct ReplyDefaultTypeInternal;
+extern ReplyDefaultTypeInternal _Reply_default_instance_;
+class StableCheckpoint;
+struct StableCheckpointDefaultTypeInternal;
+extern StableCheckpointDefaultTypeInternal _StableCheckpoint_default_instance_;
+class StateChunk;
+struct StateChunkDefaultTypeInternal;
+extern StateChunkDefaultTypeInternal _StateChunk_default_instance_;
+class StateRequest;
+struct StateRequestDefaultTypeInternal;
+extern StateRequestDefaultTypeInternal _StateRequest_default_instance_;
+class UIMessage;
+struct UIMessageDefaultTypeInternal;
+extern UIMessageDefaultTypeInternal _UIMessage_default_instance_;
+}  // namespace proto
+}  // namespace minbft
+}  // namespace dsnet
+PROTOBUF_NAMESPACE_OPEN
+template<> ::dsnet::minbft::proto::Checkpoint* Arena::CreateMaybeMessage<::dsnet::minbft::proto::Checkpoint>(Arena*);
+template<> ::dsnet::minbft::proto::Commit* Arena::CreateMaybeMessage<::dsnet::minbft::proto::Commit>(Arena*);
+template<> ::dsnet::minbft::proto::MinBFTMessage* Arena::CreateMaybeMessage<::dsnet::minbft::proto::MinBFTMessage>(Arena*);
+template<> ::dsnet::minbft::proto::Prepare* Arena::CreateMaybeMessage<::dsnet::minbft::proto::Prepare>(Arena*);
+template<> ::dsnet::minbft::proto::Reply* Arena::CreateMaybeMessage<::dsnet::minbft::proto::Reply>(Arena*);
+template<> ::dsnet::minbft::proto::StableCheckpoint* Arena::CreateMaybeMessage<::dsnet::minbft::proto::StableCheckpoint>(Arena*);
+template<> ::dsnet::minbft::proto::StateChunk* Arena::CreateMaybeMessage<::dsnet::minbft::proto::StateChunk>(Arena*);
+template<> ::dsnet::minbft::proto::StateRequest* Arena::CreateMaybeMessage<::dsnet::minbft::proto::StateRequest>(Arena*);
+template<> ::dsnet::minbft::proto::UIMessage* Arena::CreateMaybeMessage<::dsnet::minbft::proto::UIMessage>(Arena*);
+PROTOBUF_NAMESPACE_CLOSE
+namespace dsnet {
+namespace minbft {
+namespace proto {
+
+// ===================================================================
+
+class MinBFTMessage final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:dsnet.minbft.proto.MinBFTMessage) */ {
+ public:
+  inline MinBFTMessage() : MinBFTMessage(nullptr) {}
+  ~MinBFTMessage() override;
+  explicit PROTOBUF_CONSTEXPR MinBFTMessage(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  MinBFTMessage(const MinBFTMessage& from);
+  MinBFTMessage(MinBFTMessage&& from) noexcept
+    : MinBFTMessage() {
+    *this = ::std::move(from);
+  }
+
+  inline MinBFTMessage& operator=(const MinBFTMessage& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline MinBFTMessage& operator=(MinBFTMessage&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const MinBFTMessage& default_instance() {
+    return *internal_default_instance();
+  }
+  enum SubCase {
+    kSignedRequest = 1,
+    kUiMessage = 2,
+    kStateRequest = 3,
+    kStateChunk = 4,
+    SUB_NOT_SET = 0,
+  };
+
+  static inline const MinBFTMessage* internal_default_instance() {
+    return reinterpret_cast<const MinBFTMessage*>(
+               &_MinBFTMessage_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    0;
+
+  friend void swap(MinBFTMessage& a, MinBFTMessage& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(MinBFTMessage* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(MinBFTMessage* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  MinBFTMessage* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<MinBFTMessage>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const MinBFTMessage& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const MinBFTMessage& from) {
+    MinBFTMessage::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(MinBFTMessage* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "dsnet.minbft.proto.MinBFTMessage";
+  }
+  protected:
+  explicit MinBFTMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kSignedRequestFieldNumber = 1,
+    kUiMessageFieldNumber = 2,
+    kStateRequestFieldNumber = 3,
+    kStateChunkFieldNumber = 4,
+  };
+  // bytes signed_request = 1;
+  bool has_signed_request() const;
+  private:
+  bool _internal_has_signed_request() const;
+  public:
+  void clear_signed_request();
+  const std::string& signed_request() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_signed_request(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_signed_request();
+  PROTOBUF_NODISCARD std::string* release_signed_request();
+  void set_allocated_signed_request(std::string* signed_request);
+  private:
+  const std::string& _internal_signed_request() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_signed_request(const std::string& value);
+  std::string* _internal_mutable_signed_request();
+  public:
+
+  // bytes ui_message = 2;
+  bool has_ui_message() const;
+  private:
+  bool _internal_has_ui_message() const;
+  public:
+  void clear_ui_message();
+  const std::string& ui_message() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_ui_message(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_ui_message();
+  PROTOBUF_NODISCARD std::string* release_ui_message();
+  void set_allocated_ui_message(std::string* ui_message);
+  private:
+  const std::string& _internal_ui_message() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_ui_message(const std::string& value);
+  std::string* _internal_mutable_ui_message();
+  public:
+
+  // .dsnet.minbft.proto.StateRequest state_request = 3;
+  bool has_state_request() const;
+  private:
+  bool _internal_has_state_request() const;
+  public:
+  void clear_state_request();
+  const ::dsnet::minbft::proto::StateRequest& state_request() const;
+  PROTOBUF_NODISCARD ::dsnet::minbft::proto::StateRequest* release_state_request();
+  ::dsnet::minbft::proto::StateRequest* mutable_state_request();
+  void set_allocated_state_request(::dsnet::minbft::proto::StateRequest* state_request);
+  private:
+  const ::dsnet::minbft::proto::StateRequest& _internal_state_request() const;
+  ::dsnet::minbft::proto::StateRequest* _internal_mutable_state_request();
+  public:
+  void unsafe_arena_set_allocated_state_request(
+      ::dsnet::minbft::proto::StateRequest* state_request);
+  ::dsnet::minbft::proto::StateRequest* unsafe_arena_release_state_request();
+
+  // .dsnet.minbft.proto.StateChunk state_chunk = 4;
+  bool has_state_chunk() const;
+  private:
+  bool _internal_has_state_chunk() const;
+  public:
+  void clear_state_chunk();
+  const ::dsnet::minbft::proto::StateChunk& state_chunk() const;
+  PROTOBUF_NODISCARD ::dsnet::minbft::proto::StateChunk* release_state_chunk();
+  ::dsnet::minbft::proto::StateChunk* mutable_state_chunk();
+  void set_allocated_state_chunk(::dsnet::minbft::proto::StateChunk* state_chunk);
+  private:
+  const ::dsnet::minbft::proto::StateChunk& _internal_state_chunk() const;
+  ::dsnet::minbft::proto::StateChunk* _internal_mutable_state_chunk();
+  public:
+  void unsafe_arena_set_allocated_state_chunk(
+      ::dsnet::minbft::proto::StateChunk* state_chunk);
+  ::dsnet::minbft::proto::StateChunk* unsafe_arena_release_state_chunk();
+
+  void clear_sub();
+  SubCase sub_case() const;
+  // @@protoc_insertion_point(class_scope:dsnet.minbft.proto.MinBFTMessage)
+ private:
+  class _Internal;
+  void set_has_signed_request();
+  void set_has_ui_message();
+  void set_has_state_request();
+  void set_has_state_chunk();
+
+  inline bool has_sub() const;
+  inline void clear_has_sub();
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    union SubUnion {
+      constexpr SubUnion() : _constinit_{} {}
+        ::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized _constinit_;
+      ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr signed_request_;
+      ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr ui_message_;
+      ::dsnet::minbft::proto::StateRequest* state_request_;
+      ::dsnet::minbft::proto::StateChunk* state_chunk_;
+    } sub_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    uint32_t _oneof_case_[1];
+
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_replication_2fminbft_2fmessage_2eproto;
+};
+// -------------------------------------------------------------------
+
+class UIMessage final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:dsnet.minbft.proto.UIMessage) */ {
+ public:
+  inline UIMessage() : UIMessage(nullptr) {}
+  ~UIMessage() override;
+  explicit PROTOBUF_CONSTEXPR UIMessage(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  UIMessage(const UIMessage& from);
+  UIMessage(UIMessage&& from) noexcept
+    : UIMessage() {
+    *this = ::std::move(from);
+  }
+
+  inline UIMessage& operator=(const UIMessage& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline UIMessage& operator=(UIMessage&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const UIMessage& default_instance() {
+    return *internal_default_instance();
+  }
+  enum SubCase {
+    kPrepare = 1,
+    kCommit = 2,
+    kCheckpoint = 4,
+    SUB_NOT_SET = 0,
+  };
+
+  static inline const UIMessage* internal_default_instance() {
+    return reinterpret_cast<const UIMessage*>(
+               &_UIMessage_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    1;
+
+  friend void swap(UIMessage& a, UIMessage& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(UIMessage* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(UIMessage* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  UIMessage* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<UIMessage>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const UIMessage& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const UIMessage& from) {
+    UIMessage::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(UIMessage* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "dsnet.minbft.proto.UIMessage";
+  }
+  protected:
+  explicit UIMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kReplicaIdFieldNumber = 3,
+    kPrepareFieldNumber = 1,
+    kCommitFieldNumber = 2,
+    kCheckpointFieldNumber = 4,
+  };
+  // int32 replica_id = 3;
+  void clear_replica_id();
+  int32_t replica_id() const;
+  void set_replica_id(int32_t value);
+  private:
+  int32_t _internal_replica_id() const;
+  void _internal_set_replica_id(int32_t value);
+  public:
+
+  // .dsnet.minbft.proto.Prepare prepare = 1;
+  bool has_prepare() const;
+  private:
+  bool _internal_has_prepare() const;
+  public:
+  void clear_prepare();
+  const ::dsnet::minbft::proto::Prepare& prepare() const;
+  PROTOBUF_NODISCARD ::dsnet::minbft::proto::Prepare* release_prepare();
+  ::dsnet::minbft::proto::Prepare* mutable_prepare();
+  void set_allocated_prepare(::dsnet::minbft::proto::Prepare* prepare);
+  private:
+  const ::dsnet::minbft::proto::Prepare& _internal_prepare() const;
+  ::dsnet::minbft::proto::Prepare* _internal_mutable_prepare();
+  public:
+  void unsafe_arena_set_allocated_prepare(
+      ::dsnet::minbft::proto::Prepare* prepare);
+  ::dsnet::minbft::proto::Prepare* unsafe_arena_release_prepare();
+
+  // .dsnet.minbft.proto.Commit commit = 2;
+  bool has_commit() const;
+  private:
+  bool _internal_has_commit() const;
+  public:
+  void clear_commit();
+  const ::dsnet::minbft::proto::Commit& commit() const;
+  PROTOBUF_NODISCARD ::dsnet::minbft::proto::Commit* release_commit();
+  ::dsnet::minbft::proto::Commit* mutable_commit();
+  void set_allocated_commit(::dsnet::minbft::proto::Commit* commit);
+  private:
+  const ::dsnet::minbft::proto::Commit& _internal_commit() const;
+  ::dsnet::minbft::proto::Commit* _internal_mutable_commit();
+  public:
+  void unsafe_arena_set_allocated_commit(
+      ::dsnet::minbft::proto::Commit* commit);
+  ::dsnet::minbft::proto::Commit* unsafe_arena_release_commit();
+
+  // .dsnet.minbft.proto.Checkpoint checkpoint = 4;
+  bool has_checkpoint() const;
+  private:
+  bool _internal_has_checkpoint() const;
+  public:
+  void clear_checkpoint();
+  const ::dsnet::minbft::proto::Checkpoint& checkpoint() const;
+  PROTOBUF_NODISCARD ::dsnet::minbft::proto::Checkpoint* release_checkpoint();
+  ::dsnet::minbft::proto::Checkpoint* mutable_checkpoint();
+  void set_allocated_checkpoint(::dsnet::minbft::proto::Checkpoint* checkpoint);
+  private:
+  const ::dsnet::minbft::proto::Checkpoint& _internal_checkpoint() const;
+  ::dsnet::minbft::proto::Checkpoint* _internal_mutable_checkpoint();
+  public:
+  void unsafe_arena_set_allocated_checkpoint(
+      ::dsnet::minbft::proto::Checkpoint* checkpoint);
+  ::dsnet::minbft::proto::Checkpoint* unsafe_arena_release_checkpoint();
+
+  void clear_sub();
+  SubCase sub_case() const;
+  // @@protoc_insertion_point(class_scope:dsnet.minbft.proto.UIMessage)
+ private:
+  class _Internal;
+  void set_has_prepare();
+  void set_has_commit();
+  void set_has_checkpoint();
+
+  inline bool has_sub() const;
+  inline void clear_has_sub();
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    int32_t replica_id_;
+    union SubUnion {
+      constexpr SubUnion() : _constinit_{} {}
+        ::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized _constinit_;
+      ::dsnet::minbft::proto::Prepare* prepare_;
+      ::dsnet::minbft::proto::Commit* commit_;
+      ::dsnet::minbft::proto::Checkpoint* checkpoint_;
+    } sub_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    uint32_t _oneof_case_[1];
+
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_replication_2fminbft_2fmessage_2eproto;
+};
+// -------------------------------------------------------------------
+
+class Reply final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:dsnet.minbft.proto.Reply) */ {
+ public:
+  inline Reply() : Reply(nullptr) {}
+  ~Reply() override;
+  explicit PROTOBUF_CONSTEXPR Reply(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  Reply(const Reply& from);
+  Reply(Reply&& from) noexcept
+    : Reply() {
+    *this = ::std::move(from);
+  }
+
+  inline Reply& operator=(const Reply& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline Reply& operator=(Reply&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const Reply& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const Reply* internal_default_instance() {
+    return reinterpret_cast<const Reply*>(
+               &_Reply_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    2;
+
+  friend void swap(Reply& a, Reply& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(Reply* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Reply* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  Reply* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<Reply>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const Reply& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const Reply& from) {
+    Reply::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(Reply* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "dsnet.minbft.proto.Reply";
+  }
+  protected:
+  explicit Reply(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kResultFieldNumber = 1,
+    kRequestNumberFieldNumber = 3,
+    kReplicaIdFieldNumber = 2,
+  };
+  // bytes result = 1;
+  void clear_result();
+  const std::string& result() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_result(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_result();
+  PROTOBUF_NODISCARD std::string* release_result();
+  void set_allocated_result(std::string* result);
+  private:
+  const std::string& _internal_result() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_result(const std::string& value);
+  std::string* _internal_mutable_result();
+  public:
+
+  // uint64 request_number = 3;
+  void clear_request_number();
+  uint64_t request_number() const;
+  void set_request_number(uint64_t value);
+  private:
+  uint64_t _internal_request_number() const;
+  void _internal_set_request_number(uint64_t value);
+  public:
+
+  // int32 replica_id = 2;
+  void clear_replica_id();
+  int32_t replica_id() const;
+  void set_replica_id(int32_t value);
+  private:
+  int32_t _internal_replica_id() const;
+  void _internal_set_replica_id(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:dsnet.minbft.proto.Reply)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr result_;
+    uint64_t request_number_;
+    int32_t replica_id_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_replication_2fminbft_2fmessage_2eproto;
+};
+// -------------------------------------------------------------------
+
+class Prepare final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:dsnet.minbft.proto.Prepare) */ {
+ public:
+  inline Prepare() : Prepare(nullptr) {}
+  ~Prepare() override;
+  explicit PROTOBUF_CONSTEXPR Prepare(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  Prepare(const Prepare& from);
+  Prepare(Prepare&& from) noexcept
+    : Prepare() {
+    *this = ::std::move(from);
+  }
+
+  inline Prepare& operator=(const Prepare& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline Prepare& operator=(Prepare&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const Prepare& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const Prepare* internal_default_instance() {
+    return reinterpret_cast<const Prepare*>(
+               &_Prepare_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    3;
+
+  friend void swap(Prepare& a, Prepare& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(Prepare* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Prepare* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  Prepare* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<Prepare>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const Prepare& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const Prepare& from) {
+    Prepare::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(Prepare* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "dsnet.minbft.proto.Prepare";
+  }
+  protected:
+  explicit Prepare(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kSignedRequestFieldNumber = 2,
+    kViewNumberFieldNumber = 1,
+  };
+  // repeated bytes signed_request = 2;
+  int signed_request_size() const;
+  private:
+  int _internal_signed_request_size() const;
+  public:
+  void clear_signed_request();
+  const std::string& signed_request(int index) const;
+  std::string* mutable_signed_request(int index);
+  void set_signed_request(int index, const std::string& value);
+  void set_signed_request(int index, std::string&& value);
+  void set_signed_request(int index, const char* value);
+  void set_signed_request(int index, const void* value, size_t size);
+  std::string* add_signed_request();
+  void add_signed_request(const std::string& value);
+  void add_signed_request(std::string&& value);
+  void add_signed_request(const char* value);
+  void add_signed_request(const void* value, size_t size);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>& signed_request() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>* mutable_signed_request();
+  private:
+  const std::string& _internal_signed_request(int index) const;
+  std::string* _internal_add_signed_request();
+  public:
+
+  // uint64 view_number = 1;
+  void clear_view_number();
+  uint64_t view_number() const;
+  void set_view_number(uint64_t value);
+  private:
+  uint64_t _internal_view_number() const;
+  void _internal_set_view_number(uint64_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:dsnet.minbft.proto.Prepare)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string> signed_request_;
+    uint64_t view_number_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_replication_2fminbft_2fmessage_2eproto;
+};
+// -------------------------------------------------------------------
+
+class Commit final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:dsnet.minbft.proto.Commit) */ {
+ public:
+  inline Commit() : Commit(nullptr) {}
+  ~Commit() override;
+  explicit PROTOBUF_CONSTEXPR Commit(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  Commit(const Commit& from);
+  Commit(Commit&& from) noexcept
+    : Commit() {
+    *this = ::std::move(from);
+  }
+
+  inline Commit& operator=(const Commit& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline Commit& operator=(Commit&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const Commit& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const Commit* internal_default_instance() {
+    return reinterpret_cast<const Commit*>(
+               &_Commit_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    4;
+
+  friend void swap(Commit& a, Commit& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(Commit* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Commit* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  Commit* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<Commit>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const Commit& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const Commit& from) {
+    Commit::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(Commit* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "dsnet.minbft.proto.Commit";
+  }
+  protected:
+  explicit Commit(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kViewNumberFieldNumber = 1,
+    kPrimaryUiFieldNumber = 2,
+    kReplicaIdFieldNumber = 3,
+  };
+  // uint64 view_number = 1;
+  void clear_view_number();
+  uint64_t view_number() const;
+  void set_view_number(uint64_t value);
+  private:
+  uint64_t _internal_view_number() const;
+  void _internal_set_view_number(uint64_t value);
+  public:
+
+  // uint64 primary_ui = 2;
+  void clear_primary_ui();
+  uint64_t primary_ui() const;
+  void set_primary_ui(uint64_t value);
+  private:
+  uint64_t _internal_primary_ui() const;
+  void _internal_set_primary_ui(uint64_t value);
+  public:
+
+  // int32 replica_id = 3;
+  void clear_replica_id();
+  int32_t replica_id() const;
+  void set_replica_id(int32_t value);
+  private:
+  int32_t _internal_replica_id() const;
+  void _internal_set_replica_id(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:dsnet.minbft.proto.Commit)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    uint64_t view_number_;
+    uint64_t primary_ui_;
+    int32_t replica_id_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_replication_2fminbft_2fmessage_2eproto;
+};
+// -------------------------------------------------------------------
+
+class Checkpoint final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:dsnet.minbft.proto.Checkpoint) */ {
+ public:
+  inline Checkpoint() : Checkpoint(nullptr) {}
+  ~Checkpoint() override;
+  explicit PROTOBUF_CONSTEXPR Checkpoint(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  Checkpoint(const Checkpoint& from);
+  Checkpoint(Checkpoint&& from) noexcept
+    : Checkpoint() {
+    *this = ::std::move(from);
+  }
+
+  inline Checkpoint& operator=(const Checkpoint& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline Checkpoint& operator=(Checkpoint&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const Checkpoint& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const Checkpoint* internal_default_instance() {
+    return reinterpret_cast<const Checkpoint*>(
+               &_Checkpoint_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    5;
+
+  friend void swap(Checkpoint& a, Checkpoint& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(Checkpoint* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Checkpoint* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  Checkpoint* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<Checkpoint>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const Checkpoint& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const Checkpoint& from) {
+    Checkpoint::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(Checkpoint* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "dsnet.minbft.proto.Checkpoint";
+  }
+  protected:
+  explicit Checkpoint(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kDigestFieldNumber = 3,
+    kOpNumberFieldNumber = 1,
+    kReplicaIdFieldNumber = 2,
+  };
+  // bytes digest = 3;
+  void clear_digest();
+  const std::string& digest() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_digest(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_digest();
+  PROTOBUF_NODISCARD std::string* release_digest();
+  void set_allocated_digest(std::string* digest);
+  private:
+  const std::string& _internal_digest() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_digest(const std::string& value);
+  std::string* _internal_mutable_digest();
+  public:
+
+  // uint64 op_number = 1;
+  void clear_op_number();
+  uint64_t op_number() const;
+  void set_op_number(uint64_t value);
+  private:
+  uint64_t _internal_op_number() const;
+  void _internal_set_op_number(uint64_t value);
+  public:
+
+  // int32 replica_id = 2;
+  void clear_replica_id();
+  int32_t replica_id() const;
+  void set_replica_id(int32_t value);
+  private:
+  int32_t _internal_replica_id() const;
+  void _internal_set_replica_id(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:dsnet.minbft.proto.Checkpoint)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr digest_;
+    uint64_t op_number_;
+    int32_t replica_id_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_replication_2fminbft_2fmessage_2eproto;
+};
+// -------------------------------------------------------------------
+
+class StateRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:dsnet.minbft.proto.StateRequest) */ {
+ public:
+  inline StateRequest() : StateRequest(nullptr) {}
+  ~StateRequest() override;
+  explicit PROTOBUF_CONSTEXPR StateRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  StateRequest(const StateRequest& from);
+  StateRequest(StateRequest&& from) noexcept
+    : StateRequest() {
+    *this = ::std::move(from);
+  }
+
+  inline StateRequest& operator=(const StateRequest& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline StateRequest& operator=(StateRequest&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const StateRequest& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const StateRequest* internal_default_instance() {
+    return reinterpret_cast<const StateRequest*>(
+               &_StateRequest_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    6;
+
+  friend void swap(StateRequest& a, StateRequest& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(StateRequest* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(StateRequest* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  StateRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<StateRequest>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const StateRequest& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const StateRequest& from) {
+    StateRequest::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(StateRequest* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "dsnet.minbft.proto.StateRequest";
+  }
+  protected:
+  explicit StateRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kUiFieldNumber = 1,
+    kLastUiFieldNumber = 2,
+    kReplicaIdFieldNumber = 3,
+  };
+  // uint64 ui = 1;
+  void clear_ui();
+  uint64_t ui() const;
+  void set_ui(uint64_t value);
+  private:
+  uint64_t _internal_ui() const;
+  void _internal_set_ui(uint64_t value);
+  public:
+
+  // uint64 last_ui = 2;
+  void clear_last_ui();
+  uint64_t last_ui() const;
+  void set_last_ui(uint64_t value);
+  private:
+  uint64_t _internal_last_ui() const;
+  void _internal_set_last_ui(uint64_t value);
+  public:
+
+  // int32 replica_id = 3;
+  void clear_replica_id();
+  int32_t replica_id() const;
+  void set_replica_id(int32_t value);
+  private:
+  int32_t _internal_replica_id() const;
+  void _internal_set_replica_id(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:dsnet.minbft.proto.StateRequest)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    uint64_t ui_;
+    uint64_t last_ui_;
+    int32_t replica_id_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_replication_2fminbft_2fmessage_2eproto;
+};
+// -------------------------------------------------------------------
+
+class StateChunk final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:dsnet.minbft.proto.StateChunk) */ {
+ public:
+  inline StateChunk() : StateChunk(nullptr) {}
+  ~StateChunk() override;
+  explicit PROTOBUF_CONSTEXPR StateChunk(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  StateChunk(const StateChunk& from);
+  StateChunk(StateChunk&& from) noexcept
+    : StateChunk() {
+    *this = ::std::move(from);
+  }
+
+  inline StateChunk& operator=(const StateChunk& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline StateChunk& operator=(StateChunk&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const StateChunk& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const StateChunk* internal_default_instance() {
+    return reinterpret_cast<const StateChunk*>(
+               &_StateChunk_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    7;
+
+  friend void swap(StateChunk& a, StateChunk& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(StateChunk* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(StateChunk* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  StateChunk* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<StateChunk>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const StateChunk& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const StateChunk& from) {
+    StateChunk::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(StateChunk* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "dsnet.minbft.proto.StateChunk";
+  }
+  protected:
+  explicit StateChunk(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kUiMessageFieldNumber = 2,
+    kCheckpointFieldNumber = 3,
+    kUiFieldNumber = 1,
+  };
+  // repeated bytes ui_message = 2;
+  int ui_message_size() const;
+  private:
+  int _internal_ui_message_size() const;
+  public:
+  void clear_ui_message();
+  const std::string& ui_message(int index) const;
+  std::string* mutable_ui_message(int index);
+  void set_ui_message(int index, const std::string& value);
+  void set_ui_message(int index, std::string&& value);
+  void set_ui_message(int index, const char* value);
+  void set_ui_message(int index, const void* value, size_t size);
+  std::string* add_ui_message();
+  void add_ui_message(const std::string& value);
+  void add_ui_message(std::string&& value);
+  void add_ui_message(const char* value);
+  void add_ui_message(const void* value, size_t size);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>& ui_message() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>* mutable_ui_message();
+  private:
+  const std::string& _internal_ui_message(int index) const;
+  std::string* _internal_add_ui_message();
+  public:
+
+  // .dsnet.minbft.proto.StableCheckpoint checkpoint = 3;
+  bool has_checkpoint() const;
+  private:
+  bool _internal_has_checkpoint() const;
+  public:
+  void clear_checkpoint();
+  const ::dsnet::minbft::proto::StableCheckpoint& checkpoint() const;
+  PROTOBUF_NODISCARD ::dsnet::minbft::proto::StableCheckpoint* release_checkpoint();
+  ::dsnet::minbft::proto::StableCheckpoint* mutable_checkpoint();
+  void set_allocated_checkpoint(::dsnet::minbft::proto::StableCheckpoint* checkpoint);
+  private:
+  const ::dsnet::minbft::proto::StableCheckpoint& _internal_checkpoint() const;
+  ::dsnet::minbft::proto::StableCheckpoint* _internal_mutable_checkpoint();
+  public:
+  void unsafe_arena_set_allocated_checkpoint(
+      ::dsnet::minbft::proto::StableCheckpoint* checkpoint);
+  ::dsnet::minbft::proto::StableCheckpoint* unsafe_arena_release_checkpoint();
+
+  // uint64 ui = 1;
+  void clear_ui();
+  uint64_t ui() const;
+  void set_ui(uint64_t value);
+  private:
+  uint64_t _internal_ui() const;
+  void _internal_set_ui(uint64_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:dsnet.minbft.proto.StateChunk)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string> ui_message_;
+    ::dsnet::minbft::proto::StableCheckpoint* checkpoint_;
+    uint64_t ui_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_replication_2fminbft_2fmessage_2eproto;
+};
+// -------------------------------------------------------------------
+
+class StableCheckpoint final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:dsnet.minbft.proto.StableCheckpoint) */ {
+ public:
+  inline StableCheckpoint() : StableCheckpoint(nullptr) {}
+  ~StableCheckpoint() override;
+  explicit PROTOBUF_CONSTEXPR StableCheckpoint(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  StableCheckpoint(const StableCheckpoint& from);
+  StableCheckpoint(StableCheckpoint&& from) noexcept
+    : StableCheckpoint() {
+    *this = ::std::move(from);
+  }
+
+  inline StableCheckpoint& operator=(const StableCheckpoint& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline StableCheckpoint& operator=(StableCheckpoint&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const StableCheckpoint& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const StableCheckpoint* internal_default_instance() {
+    return reinterpret_cast<const StableCheckpoint*>(
+               &_StableCheckpoint_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    8;
+
+  friend void swap(StableCheckpoint& a, StableCheckpoint& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(StableCheckpoint* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(StableCheckpoint* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  StableCheckpoint* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<StableCheckpoint>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const StableCheckpoint& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const StableCheckpoint& from) {
+    StableCheckpoint::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(StableCheckpoint* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "dsnet.minbft.proto.StableCheckpoint";
+  }
+  protected:
+  explicit StableCheckpoint(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kUiCheckpointFieldNumber = 3,
+    kAppStateFieldNumber = 2,
+    kDigestFieldNumber = 6,
+    kOpNumberFieldNumber = 1,
+    kCollectedUiFieldNumber = 4,
+    kCollectedOpFieldNumber = 5,
+  };
+  // repeated bytes ui_checkpoint = 3;
+  int ui_checkpoint_size() const;
+  private:
+  int _internal_ui_checkpoint_size() const;
+  public:
+  void clear_ui_checkpoint();
+  const std::string& ui_checkpoint(int index) const;
+  std::string* mutable_ui_checkpoint(int index);
+  void set_ui_checkpoint(int index, const std::string& value);
+  void set_ui_checkpoint(int index, std::string&& value);
+  void set_ui_checkpoint(int index, const char* value);
+  void set_ui_checkpoint(int index, const void* value, size_t size);
+  std::string* add_ui_checkpoint();
+  void add_ui_checkpoint(const std::string& value);
+  void add_ui_checkpoint(std::string&& value);
+  void add_ui_checkpoint(const char* value);
+  void add_ui_checkpoint(const void* value, size_t size);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>& ui_checkpoint() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>* mutable_ui_checkpoint();
+  private:
+  const std::string& _internal_ui_checkpoint(int index) const;
+  std::string* _internal_add_ui_checkpoint();
+  public:
+
+  // bytes app_state = 2;
+  void clear_app_state();
+  const std::string& app_state() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_app_state(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_app_state();
+  PROTOBUF_NODISCARD std::string* release_app_state();
+  void set_allocated_app_state(std::string* app_state);
+  private:
+  const std::string& _internal_app_state() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_app_state(const std::string& value);
+  std::string* _internal_mutable_app_state();
+  public:
+
+  // bytes digest = 6;
+  void clear_digest();
+  const std::string& digest() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_digest(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_digest();
+  PROTOBUF_NODISCARD std::string* release_digest();
+  void set_allocated_digest(std::string* digest);
+  private:
+  const std::string& _internal_digest() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_digest(const std::string& value);
+  std::string* _internal_mutable_digest();
+  public:
+
+  // uint64 op_number = 1;
+  void clear_op_number();
+  uint64_t op_number() const;
+  void set_op_number(uint64_t value);
+  private:
+  uint64_t _internal_op_number() const;
+  void _internal_set_op_number(uint64_t value);
+  public:
+
+  // uint64 collected_ui = 4;
+  void clear_collected_ui();
+  uint64_t collected_ui() const;
+  void set_collected_ui(uint64_t value);
+  private:
+  uint64_t _internal_collected_ui() const;
+  void _internal_set_collected_ui(uint64_t value);
+  public:
+
+  // uint64 collected_op = 5;
+  void clear_collected_op();
+  uint64_t collected_op() const;
+  void set_collected_op(uint64_t value);
+  private:
+  uint64_t _internal_collected_op() const;
+  void _internal_set_collected_op(uint64_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:dsnet.minbft.proto.StableCheckpoint)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string> ui_checkpoint_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr app_state_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr digest_;
+    uint64_t op_number_;
+    uint64_t collected_ui_;
+    uint64_t collected_op_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_replication_2fminbft_2fmessage_2eproto;
+};
+// ===================================================================
+
+
+// ===================================================================
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
+#endif  // __GNUC__
+// MinBFTMessage
+
+// bytes signed_request = 1;
+inline bool MinBFTMessage::_internal_has_signed_request() const {
+  return sub_case() == kSignedRequest;
+}
+inline bool MinBFTMessage::has_signed_request() const {
+  return _internal_has_signed_request();
+}
+inline void MinBFTMessage::set_has_signed_request() {
+  _impl_._oneof_case_[0] = kSignedRequest;
+}
+inline void MinBFTMessage::clear_signed_request() {
+  if (_internal_has_signed_request()) {
+    _impl_.sub_.signed_request_.Destroy();
+    clear_has_sub();
+  }
+}
+inline const std::string& MinBFTMessage::signed_request() const {
+  // @@protoc_insertion_point(field_get:dsnet.minbft.proto.MinBFTMessage.signed_request)
+  return _internal_signed_request();
+}
+template <typename ArgT0, typename... ArgT>
+inline void MinBFTMessage::set_signed_request(ArgT0&& arg0, ArgT... args) {
+  if (!_internal_has_signed_request()) {
+    clear_sub();
+    set_has_signed_request();
+    _impl_.sub_.signed_request_.InitDefault();
+  }
+  _impl_.sub_.signed_request_.SetBytes( static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:dsnet.minbft.proto.MinBFTMessage.signed_request)
+}
+inline std::string* MinBFTMessage::mutable_signed_request() {
+  std::string* _s = _internal_mutable_signed_request();
+  // @@protoc_insertion_point(field_mutable:dsnet.minbft.proto.MinBFTMessage.signed_request)
+  return _s;
+}
+inline const std::string& MinBFTMessage::_internal_signed_request() const {
+  if (_internal_has_signed_request()) {
+    return _impl_.sub_.signed_request_.Get();
+  }
+  return ::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited();
+}
+inline void MinBFTMessage::_internal_set_signed_request(const std::string& value) {
+  if (!_internal_has_signed_request()) {
+    clear_sub();
+    set_has_signed_request();
+    _impl_.sub_.signed_request_.InitDefault();
+  }
+  _impl_.sub_.signed_request_.Set(value, GetArenaForAllocation());
+}
+inline std::string* MinBFTMessage::_internal_mutable_signed_request() {
+  if (!_internal_has_signed_request()) {
+    clear_sub();
+    set_has_signed_request();
+    _impl_.sub_.signed_request_.InitDefault();
+  }
+  return _impl_.sub_.signed_request_.Mutable(      GetArenaForAllocation());
+}
+inline std::string* MinBFTMessage::release_signed_request() {
+  // @@protoc_insertion_point(field_release:dsnet.minbft.proto.MinBFTMessage.signed_request)
+  if (_internal_has_signed_request()) {
+    clear_has_sub();
+    return _impl_.sub_.signed_request_.Release();
+  } else {
+    return nullptr;
+  }
+}
+inline void MinBFTMessage::set_allocated_signed_request(std::string* signed_request) {
+  if (has_sub()) {
+    clear_sub();
+  }
+  if (signed_request != nullptr) {
+    set_has_signed_request();
+    _impl_.sub_.signed_request_.InitAllocated(signed_request, GetArenaForAllocation());
+  }
+  // @@protoc_insertion_point(field_set_allocated:dsnet.minbft.proto.MinBFTMessage.signed_request)
+}
+
+// bytes ui_message = 2;
+inline bool MinBFTMessage::_internal_has_ui_message() const {
+  return sub_case() == kUiMessage;
+}
+inline bool MinBFTMessage::has_ui_message() const {
+  return _internal_has_ui_message();
+}
+inline void MinBFTMessage::set_has_ui_message() {
+  _impl_._oneof_case_[0] = kUiMessage;
+}
+inline void MinBFTMessage::clear_ui_message() {
+  if (_internal_has_ui_message()) {
+    _impl_.sub_.ui_message_.Destroy();
+    clear_has_sub();
+  }
+}
+inline const std::string& MinBFTMessage::ui_message() const {
+  // @@protoc_insertion_point(field_get:dsnet.minbft.proto.MinBFTMessage.ui_message)
+  return _internal_ui_message();
+}
+template <typename ArgT0, typename... ArgT>
+inline void MinBFTMessage::set_ui_message(ArgT0&& arg0, ArgT... args) {
+  if (!_internal_has_ui_message()) {
+    clear_sub();
+    set_has_ui_message();
+    _impl_.sub_.ui_message_.InitDefault();
+  }
+  _impl_.sub_.ui_message_.SetBytes( static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:dsnet.minbft.proto.MinBFTMessage.ui_message)
+}
+inline std::string* MinBFTMessage::mutable_ui_message() {
+  std::string* _s = _internal_mutable_ui_message();
+  // @@protoc_insertion_point(field_mutable:dsnet.minbft.proto.MinBFTMessage.ui_message)
+  return _s;
+}
+inline const std::string& MinBFTMessage::_internal_ui_message() const {
+  if (_internal_has_ui_message()) {
+    return _impl_.sub_.ui_message_.Get();
+  }
+  return ::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited();
+}
+inline void MinBFTMessage::_internal_set_ui_message(const std::string& value) {
+  if (!_internal_has_ui_message()) {
+    clear_sub();
+    set_has_ui_message();
+    _impl_.sub_.ui_message_.InitDefault();
+  }
+  _impl_.sub_.ui_message_.Set(value, GetArenaForAllocation());
+}
+inline std::string* MinBFTMessage::_internal_mutable_ui_message() {
+  if (!_internal_has_ui_message()) {
+    clear_sub();
+    set_has_ui_message();
+    _impl_.sub_.ui_message_.InitDefault();
+  }
+  return _impl_.sub_.ui_message_.Mutable(      GetArenaForAllocation());
+}
+inline std::string* MinBFTMessage::release_ui_message() {
+  // @@protoc_insertion_point(field_release:dsnet.minbft.proto.MinBFTMessage.ui_message)
+  if (_internal_has_ui_message()) {
+    clear_has_sub();
+    return _impl_.sub_.ui_message_.Release();
+  } else {
+    return nullptr;
+  }
+}
+inline void MinBFTMessage::set_allocated_ui_message(std::string* ui_message) {
+  if (has_sub()) {
+    clear_sub();
+  }
+  if (ui_message != nullptr) {
+    set_has_ui_message();
+    _impl_.sub_.ui_message_.InitAllocated(ui_message, GetArenaForAllocation());
+  }
+  // @@protoc_insertion_point(field_set_allocated:dsnet.minbft.proto.MinBFTMessage.ui_message)
+}
+
+// .dsnet.minbft.proto.StateRequest state_request = 3;
+inline bool MinBFTMessage::_internal_has_state_request() const {
+  return sub_case() == kStateRequest;
+}
+inline bool MinBFTMessage::has_state_request() const {
+  return _internal_has_state_request();
+}
+inline void MinBFTMessage::set_has_state_request() {
+  _impl_._oneof_case_[0] = kStateRequest;
+}
+inline void MinBFTMessage::clear_state_request() {
+  if (_internal_has_state_request()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.sub_.state_request_;
+    }
+    clear_has_sub();
+  }
+}
+inline ::dsnet::minbft::proto::StateRequest* MinBFTMessage::release_state_request() {
+  // @@protoc_insertion_point(field_release:dsnet.minbft.proto.MinBFTMessage.state_request)
+  if (_internal_has_state_request()) {
+    clear_has_sub();
+    ::dsnet::minbft::proto::StateRequest* temp = _impl_.sub_.state_request_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.sub_.state_request_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::dsnet::minbft::proto::StateRequest& MinBFTMessage::_internal_state_request() const {
+  return _internal_has_state_request()
+      ? *_impl_.sub_.state_request_
+      : reinterpret_cast< ::dsnet::minbft::proto::StateRequest&>(::dsnet::minbft::proto::_StateRequest_default_instance_);
+}
+inline const ::dsnet::minbft::proto::StateRequest& MinBFTMessage::state_request() const {
+  // @@protoc_insertion_point(field_get:dsnet.minbft.proto.MinBFTMessage.state_request)
+  return _internal_state_request();
+}
+inline ::dsnet::minbft::proto::StateRequest* MinBFTMessage::unsafe_arena_release_state_request() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:dsnet.minbft.proto.MinBFTMessage.state_request)
+  if (_internal_has_state_request()) {
+    clear_has_sub();
+    ::dsnet::minbft::proto::StateRequest* temp = _impl_.sub_.state_request_;
+    _impl_.sub_.state_request_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void MinBFTMessage::unsafe_arena_set_allocated_state_request(::dsnet::minbft::proto::StateRequest* state_request) {
+  clear_sub();
+  if (state_request) {
+    set_has_state_request();
+    _impl_.sub_.state_request_ = state_request;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:dsnet.minbft.proto.MinBFTMessage.state_request)
+}
+inline ::dsnet::minbft::proto::StateRequest* MinBFTMessage::_internal_mutable_state_request() {
+  if (!_internal_has_state_request()) {
+    clear_sub();
+    set_has_state_request();
+    _impl_.sub_.state_request_ = CreateMaybeMessage< ::dsnet::minbft::proto::StateRequest >(GetArenaForAllocation());
+  }
+  return _impl_.sub_.state_request_;
+}
+inline ::dsnet::minbft::proto::StateRequest* MinBFTMessage::mutable_state_request() {
+  ::dsnet::minbft::proto::StateRequest* _msg = _internal_mutable_state_request();
+  // @@protoc_insertion_point(field_mutable:dsnet.minbft.proto.MinBFTMessage.state_request)
+  return _msg;
+}
+
+// .dsnet.minbft.proto.StateChunk state_chunk = 4;
+inline bool MinBFTMessage::_internal_has_state_chunk() const {
+  return sub_case() == kStateChunk;
+}
+inline bool MinBFTMessage::has_state_chunk() const {
+  return _internal_has_state_chunk();
+}
+inline void MinBFTMessage::set_has_state_chunk() {
+  _impl_._oneof_case_[0] = kStateChunk;
+}
+inline void MinBFTMessage::clear_state_chunk() {
+  if (_internal_has_state_chunk()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.sub_.state_chunk_;
+    }
+    clear_has_sub();
+  }
+}
+inline ::dsnet::minbft::proto::StateChunk* MinBFTMessage::release_state_chunk() {
+  // @@protoc_insertion_point(field_release:dsnet.minbft.proto.MinBFTMessage.state_chunk)
+  if (_internal_has_state_chunk()) {
+    clear_has_sub();
+    ::dsnet::minbft::proto::StateChunk* temp = _impl_.sub_.state_chunk_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.sub_.state_chunk_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::dsnet::minbft::proto::StateChunk& MinBFTMessage::_internal_state_chunk() const {
+  return _internal_has_state_chunk()
+      ? *_impl_.sub_.state_chunk_
+      : reinterpret_cast< ::dsnet::minbft::proto::StateChunk&>(::dsnet::minbft::proto::_StateChunk_default_instance_);
+}
+inline const ::dsnet::minbft::proto::StateChunk& MinBFTMessage::state_chunk() const {
+  // @@protoc_insertion_point(field_get:dsnet.minbft.proto.MinBFTMessage.state_chunk)
+  return _internal_state_chunk();
+}
+inline ::dsnet::minbft::proto::StateChunk* MinBFTMessage::unsafe_arena_release_state_chunk() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:dsnet.minbft.proto.MinBFTMessage.state_chunk)
+  if (_internal_has_state_chunk()) {
+    clear_has_sub();
+    ::dsnet::minbft::proto::StateChunk* temp = _impl_.sub_.state_chunk_;
+    _impl_.sub_.state_chunk_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void MinBFTMessage::unsafe_arena_set_allocated_state_chunk(::dsnet::minbft::proto::StateChunk* state_chunk) {
+  clear_sub();
+  if (state_chunk) {
+    set_has_state_chunk();
+    _impl_.sub_.state_chunk_ = state_chunk;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:dsnet.minbft.proto.MinBFTMessage.state_chunk)
+}
+inline ::dsnet::minbft::proto::StateChunk* MinBFTMessage::_internal_mutable_state_chunk() {
+  if (!_internal_has_state_chunk()) {
+    clear_sub();
+    set_has_state_chunk();
+    _impl_.sub_.state_chunk_ = CreateMaybeMessage< ::dsnet::minbft::proto::StateChunk >(GetArenaForAllocation());
+  }
+  return _impl_.sub_.state_chunk_;
+}
+inline ::dsnet::minbft::proto::StateChunk* MinBFTMessage::mutable_state_chunk() {
+  ::dsnet::minbft::proto::StateChunk* _msg = _internal_mutable_state_chunk();
+  // @@protoc_insertion_point(field_mutable:dsnet.minbft.proto.MinBFTMessage.state_chunk)
+  return _msg;
+}
+
+inline bool MinBFTMessage::has_sub() const {
+  return sub_case() != SUB_NOT_SET;
+}
+inline void MinBFTMessage::clear_has_sub() {
+  _impl_._oneof_case_[0] = SUB_NOT_SET;
+}
+inline MinBFTMessage::SubCase MinBFTMessage::sub_case() const {
+  return MinBFTMessage::SubCase(_impl_._oneof_case_[0]);
+}
+// -------------------------------------------------------------------
+
+// UIMessage
+
+// .dsnet.minbft.proto.Prepare prepare = 1;
+inline bool UIMessage::_internal_has_prepare() const {
+  return sub_case() == kPrepare;
+}
+inline bool UIMessage::has_prepare() const {
+  return _internal_has_prepare();
+}
+inline void UIMessage::set_has_prepare() {
+  _impl_._oneof_case_[0] = kPrepare;
+}
+inline void UIMessage::clear_prepare() {
+  if (_internal_has_prepare()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.sub_.prepare_;
+    }
+    clear_has_sub();
+  }
+}
+inline ::dsnet::minbft::proto::Prepare* UIMessage::release_prepare() {
+  // @@protoc_insertion_point(field_release:dsnet.minbft.proto.UIMessage.prepare)
+  if (_internal_has_prepare()) {
+    clear_has_sub();
+    ::dsnet::minbft::proto::Prepare* temp = _impl_.sub_.prepare_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.sub_.prepare_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::dsnet::minbft::proto::Prepare& UIMessage::_internal_prepare() const {
+  return _internal_has_prepare()
+      ? *_impl_.sub_.prepare_
+      : reinterpret_cast< ::dsnet::minbft::proto::Prepare&>(::dsnet::minbft::proto::_Prepare_default_instance_);
+}
+inline const ::dsnet::minbft::proto::Prepare& UIMessage::prepare() const {
+  // @@protoc_insertion_point(field_get:dsnet.minbft.proto.UIMessage.prepare)
+  return _internal_prepare();
+}
+inline ::dsnet::minbft::proto::Prepare* UIMessage::unsafe_arena_release_prepare() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:dsnet.minbft.proto.UIMessage.prepare)
+  if (_internal_has_prepare()) {
+    clear_has_sub();
+    ::dsnet::minbft::proto::Prepare* temp = _impl_.sub_.prepare_;
+    _impl_.sub_.prepare_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void UIMessage::unsafe_arena_set_allocated_prepare(::dsnet::minbft::proto::Prepare* prepare) {
+  clear_sub();
+  if (prepare) {
+    set_has_prepare();
+    _impl_.sub_.prepare_ = prepare;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:dsnet.minbft.proto.UIMessage.prepare)
+}
+inline ::dsnet::minbft::proto::Prepare* UIMessage::_internal_mutable_prepare() {
+  if (!_internal_has_prepare()) {
+    clear_sub();
+    set_has_prepare();
+    _impl_.sub_.prepare_ = CreateMaybeMessage< ::dsnet::minbft::proto::Prepare >(GetArenaForAllocation());
+  }
+  return _impl_.sub_.prepare_;
+}
+inline ::dsnet::minbft::proto::Prepare* UIMessage::mutable_prepare() {
+  ::dsnet::minbft::proto::Prepare* _msg = _internal_mutable_prepare();
+  // @@protoc_insertion_point(field_mutable:dsnet.minbft.proto.UIMessage.prepare)
+  return _msg;
+}
+
+// .dsnet.minbft.proto.Commit commit = 2;
+inline bool UIMessage::_internal_has_commit() const {
+  return sub_case() == kCommit;
+}
+inline bool UIMessage::has_commit() const {
+  return _internal_has_commit();
+}
+inline void UIMessage::set_has_commit() {
+  _impl_._oneof_case_[0] = kCommit;
+}
+inline void UIMessage::clear_commit() {
+  if (_internal_has_commit()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.sub_.commit_;
+    }
+    clear_has_sub();
+  }
+}
+inline ::dsnet::minbft::proto::Commit* UIMessage::release_commit() {
+  // @@protoc_insertion_point(field_release:dsnet.minbft.proto.UIMessage.commit)
+  if (_internal_has_commit()) {
+    clear_has_sub();
+    ::dsnet::minbft::proto::Commit* temp = _impl_.sub_.commit_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.sub_.commit_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::dsnet::minbft::proto::Commit& UIMessage::_internal_commit() const {
+  return _internal_has_commit()
+      ? *_impl_.sub_.commit_
+      : reinterpret_cast< ::dsnet::minbft::proto::Commit&>(::dsnet::minbft::proto::_Commit_default_instance_);
+}
+inline const ::dsnet::minbft::proto::Commit& UIMessage::commit() const {
+  // @@protoc_insertion_point(field_get:dsnet.minbft.proto.UIMessage.commit)
+  return _internal_commit();
+}
+inline ::dsnet::minbft::proto::Commit* UIMessage::unsafe_arena_release_commit() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:dsnet.minbft.proto.UIMessage.commit)
+  if (_internal_has_commit()) {
+    clear_has_sub();
+    ::dsnet::minbft::proto::Commit* temp = _impl_.sub_.commit_;
+    _impl_.sub_.commit_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void UIMessage::unsafe_arena_set_allocated_commit(::dsnet::minbft::proto::Commit* commit) {
+  clear_sub();
+  if (commit) {
+    set_has_commit();
+    _impl_.sub_.commit_ = commit;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:dsnet.minbft.proto.UIMessage.commit)
+}
+inline ::dsnet::minbft::proto::Commit* UIMessage::_internal_mutable_commit() {
+  if (!_internal_has_commit()) {
+    clear_sub();
+    set_has_commit();
+    _impl_.sub_.commit_ = CreateMaybeMessage< ::dsnet::minbft::proto::Commit >(GetArenaForAllocation());
+  }
+  return _impl_.sub_.commit_;
+}
+inline ::dsnet::minbft::proto::Commit* UIMessage::mutable_commit() {
+  ::dsnet::minbft::proto::Commit* _msg = _internal_mutable_commit();
+  // @@protoc_insertion_point(field_mutable:dsnet.minbft.proto.UIMessage.commit)
+  return _msg;
+}
+
+// .dsnet.minbft.proto.Checkpoint checkpoint = 4;
+inline bool UIMessage::_internal_has_checkpoint() const {
+  return sub_case() == kCheckpoint;
+}
+inline bool UIMessage::has_checkpoint() const {
+  return _internal_has_checkpoint();
+}
+inline void UIMessage::set_has_checkpoint() {
+  _impl_._oneof_case_[0] = kCheckpoint;
+}
+inline void UIMessage::clear_checkpoint() {
+  if (_internal_has_checkpoint()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.sub_.checkpoint_;
+    }
+    clear_has_sub();
+  }
+}
+inline ::dsnet::minbft::proto::Checkpoint* UIMessage::release_checkpoint() {
+  // @@protoc_insertion_point(field_release:dsnet.minbft.proto.UIMessage.checkpoint)
+  if (_internal_has_checkpoint()) {
+    clear_has_sub();
+    ::dsnet::minbft::proto::Checkpoint* temp = _impl_.sub_.checkpoint_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.sub_.checkpoint_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::dsnet::minbft::proto::Checkpoint& UIMessage::_internal_checkpoint() const {
+  return _internal_has_checkpoint()
+      ? *_impl_.sub_.checkpoint_
+      : reinterpret_cast< ::dsnet::minbft::proto::Checkpoint&>(::dsnet::minbft::proto::_Checkpoint_default_instance_);
+}
+inline const ::dsnet::minbft::proto::Checkpoint& UIMessage::checkpoint() const {
+  // @@protoc_insertion_point(field_get:dsnet.minbft.proto.UIMessage.checkpoint)
+  return _internal_checkpoint();
+}
+inline ::dsnet::minbft::proto::Checkpoint* UIMessage::unsafe_arena_release_checkpoint() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:dsnet.minbft.proto.UIMessage.checkpoint)
+  if (_internal_has_checkpoint()) {
+    clear_has_sub();
+    ::dsnet::minbft::proto::Checkpoint* temp = _impl_.sub_.checkpoint_;
+    _impl_.sub_.checkpoint_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void UIMessage::unsafe_arena_set_allocated_checkpoint(::dsnet::minbft::proto::Checkpoint* checkpoint) {
+  clear_sub();
+  if (checkpoint) {
+    set_has_checkpoint();
+    _impl_.sub_.checkpoint_ = checkpoint;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:dsnet.minbft.proto.UIMessage.checkpoint)
+}
+inline ::dsnet::minbft::proto::Checkpoint* UIMessage::_internal_mutable_checkpoint() {
+  if (!_internal_has_checkpoint()) {
+    clear_sub();
+    set_has_checkpoint();
+    _impl_.sub_.checkpoint_ = CreateMaybeMessage< ::dsnet::minbft::proto::Checkpoint >(GetArenaForAllocation());
+  }
+  return _impl_.sub_.checkpoint_;
+}
+inline ::dsnet::minbft::proto::Checkpoint* UIMessage::mutable_checkpoint() {
+  ::dsnet::minbft::proto::Checkpoint* _msg = _internal_mutable_checkpoint();
+  // @@protoc_insertion_point(field_mutable:dsnet.minbft.proto.UIMessage.checkpoint)
+  return _msg;
+}
+
+// int32 replica_id = 3;
+inline void UIMessage::clear_replica_id() {
+  _impl_.replica_id_ = 0;
+}
+inline int32_t UIMessage::_internal_replica_id() const {
+  return _impl_.replica_id_;
+}
+inline int32_t UIMessage::replica_id() const {
+  // @@protoc_insertion_point(field_get:dsnet.minbft.proto.UIMessage.replica_id)
+  return _internal_replica_id();
+}
+inline void UIMessage::_internal_set_replica_id(int32_t value) {
+  
+  _impl_.replica_id_ = value;
+}
+inline void UIMessage::set_replica_id(int32_t value) {
+  _internal_set_replica_id(value);
+  // @@protoc_insertion_point(field_set:dsnet.minbft.proto.UIMessage.replica_id)
+}
+
+inline bool UIMessage::has_sub() const {
+  return sub_case() != SUB_NOT_SET;
+}
+inline void UIMessage::clear_has_sub() {
+  _impl_._oneof_case_[0] = SUB_NOT_SET;
+}
+inline UIMessage::SubCase UIMessage::sub_case() const {
+  return UIMessage::SubCase(_impl_._oneof_case_[0]);
+}
+// -------------------------------------------------------------------
+
+// Reply
+
+// bytes result = 1;
+inline void Reply::clear_result() {
+  _impl_.result_.ClearToEmpty();
+}
+inline const std::string& Reply::result() const {
+  // @@protoc_insertion_point(field_get:dsnet.minbft.proto.Reply.result)
+  return _internal_result();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void Reply::set_result(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.result_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:dsnet.minbft.proto.Reply.result)
+}
+inline std::string* Reply::mutable_result() {
+  std::string* _s = _internal_mutable_result();
+  // @@protoc_insertion_point(field_mutable:dsnet.minbft.proto.Reply.result)
+  return _s;
+}
+inline const std::string& Reply::_internal_result() const {
+  return _impl_.result_.Get();
+}
+inline void Reply::_internal_set_result(const std::string& value) {
+  
+  _impl_.result_.Set(value, GetArenaForAllocation());
+}
+inline std::string* Reply::_internal_mutable_result() {
+  
+  return _impl_.result_.Mutable(GetArenaForAllocation());
+}
+inline std::string* Reply::release_result() {
+  // @@protoc_insertion_point(field_release:dsnet.minbft.proto.Reply.result)
+  return _impl_.result_.Release();
+}
+inline void Reply::set_allocated_result(std::string* result) {
+  if (result != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.result_.SetAllocated(result, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.result_.IsDefault()) {
+    _impl_.result_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:dsnet.minbft.proto.Reply.result)
+}
+
+// int32 replica_id = 2;
+inline void Reply::clear_replica_id() {
+  _impl_.replica_id_ = 0;
+}
+inline int32_t Reply::_internal_replica_id() const {
+  return _impl_.replica_id_;
+}
+inline int32_t Reply::replica_id() const {
+  // @@protoc_insertion_point(field_get:dsnet.minbft.proto.Reply.replica_id)
+  return _internal_replica_id();
+}
+inline void Reply::_internal_set_replica_id(int32_t value) {
+  
+  _impl_.replica_id_ = value;
+}
+inline void Reply::set_replica_id(int32_t value) {
+  _internal_set_replica_id(value);
+  // @@protoc_insertion_point(field_set:dsnet.minbft.proto.Reply.replica_id)
+}
+
+// uint64 request_number = 3;
+inline void Reply::clear_request_number() {
+  _impl_.request_number_ = uint64_t{0u};
+}
+inline uint64_t Reply::_internal_request_number() const {
+  return _impl_.request_number_;
+}
+inline uint64_t Reply::request_number() const {
+  // @@protoc_insertion_point(field_get:dsnet.minbft.proto.Reply.request_number)
+  return _internal_request_number();
+}
+inline void Reply::_internal_set_request_number(uint64_t value) {
+  
+  _impl_.request_number_ = value;
+}
+inline void Reply::set_request_number(uint64_t value) {
+  _internal_set_request_number(value);
+  // @@protoc_insertion_point(field_set:dsnet.minbft.proto.Reply.request_number)
+}
+
+// -------------------------------------------------------------------
+
+// Prepare
+
+// uint64 view_number = 1;
+inline void Prepare::clear_view_number() {
+  _impl_.view_number_ = uint64_t{0u};
+}
+inline uint64_t Prepare::_internal_view_number() const {
+  return _impl_.view_number_;
+}
+inline uint64_t Prepare::view_number() const {
+  // @@protoc_insertion_point(field_get:dsnet.minbft.proto.Prepare.view_number)
+  return _internal_view_number();
+}
+inline void Prepare::_internal_set_view_number(uint64_t value) {
+  
+  _impl_.view_number_ = value;
+}
+inline void Prepare::set_view_number(uint64_t value) {
+  _internal_set_view_number(value);
+  // @@protoc_insertion_point(field_set:dsnet.minbft.proto.Prepare.view_number)
+}
+
+// repeated bytes signed_request = 2;
+inline int Prepare::_internal_signed_request_size() const {
+  return _impl_.signed_request_.size();
+}
+inline int Prepare::signed_request_size() const {
+  return _internal_signed_request_size();
+}
+inline void Prepare::clear_signed_request() {
+  _impl_.signed_request_.Clear();
+}
+inline std::string* Prepare::add_signed_request() {
+  std::string* _s = _internal_add_signed_request();
+  // @@protoc_insertion_point(field_add_mutable:dsnet.minbft.proto.Prepare.signed_request)
+  return _s;
+}
+inline const std::string& Prepare::_internal_signed_request(int index) const {
+  return _impl_.signed_request_.Get(index);
+}
+inline const std::string& Prepare::signed_request(int index) const {
+  // @@protoc_insertion_point(field_get:dsnet.minbft.proto.Prepare.signed_request)
+  return _internal_signed_request(index);
+}
+inline std::string* Prepare::mutable_signed_request(int index) {
+  // @@protoc_insertion_point(field_mutable:dsnet.minbft.proto.Prepare.signed_request)
+  return _impl_.signed_request_.Mutable(index);
+}
+inline void Prepare::set_signed_request(int index, const std::string& value) {
+  _impl_.signed_request_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set:dsnet.minbft.proto.Prepare.signed_request)
+}
+inline void Prepare::set_signed_request(int index, std::string&& value) {
+  _impl_.signed_request_.Mutable(index)->assign(std::move(value));
+  // @@protoc_insertion_point(field_set:dsnet.minbft.proto.Prepare.signed_request)
+}
+inline void Prepare::set_signed_request(int index, const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.signed_request_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set_char:dsnet.minbft.proto.Prepare.signed_request)
+}
+inline void Prepare::set_signed_request(int index, const void* value, size_t size) {
+  _impl_.signed_request_.Mutable(index)->assign(
+    reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_set_pointer:dsnet.minbft.proto.Prepare.signed_request)
+}
+inline std::string* Prepare::_internal_add_signed_request() {
+  return _impl_.signed_request_.Add();
+}
+inline void Prepare::add_signed_request(const std::string& value) {
+  _impl_.signed_request_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add:dsnet.minbft.proto.Prepare.signed_request)
+}
+inline void Prepare::add_signed_request(std::string&& value) {
+  _impl_.signed_request_.Add(std::move(value));
+  // @@protoc_insertion_point(field_add:dsnet.minbft.proto.Prepare.signed_request)
+}
+inline void Prepare::add_signed_request(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.signed_request_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add_char:dsnet.minbft.proto.Prepare.signed_request)
+}
+inline void Prepare::add_signed_request(const void* value, size_t size) {
+  _impl_.signed_request_.Add()->assign(reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_add_pointer:dsnet.minbft.proto.Prepare.signed_request)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>&
+Prepare::signed_request() const {
+  // @@protoc_insertion_point(field_list:dsnet.minbft.proto.Prepare.signed_request)
+  return _impl_.signed_request_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>*
+Prepare::mutable_signed_request() {
+  // @@protoc_insertion_point(field_mutable_list:dsnet.minbft.proto.Prepare.signed_request)
+  return &_impl_.signed_request_;
+}
+
+// -------------------------------------------------------------------
+
+// Commit
+
+// uint64 view_number = 1;
+inline void Commit::clear_view_number() {
+  _impl_.view_number_ = uint64_t{0u};
+}
+inline uint64_t Commit::_internal_view_number() const {
+  return _impl_.view_number_;
+}
+inline uint64_t Commit::view_number() const {
+  // @@protoc_insertion_point(field_get:dsnet.minbft.proto.Commit.view_number)
+  return _internal_view_number();
+}
+inline void Commit::_internal_set_view_number(uint64_t value) {
+  
+  _impl_.view_number_ = value;
+}
+inline void Commit::set_view_number(uint64_t value) {
+  _internal_set_view_number(value);
+  // @@protoc_insertion_point(field_set:dsnet.minbft.proto.Commit.view_number)
+}
+
+// uint64 primary_ui = 2;
+inline void Commit::clear_primary_ui() {
+  _impl_.primary_ui_ = uint64_t{0u};
+}
+inline uint64_t Commit::_internal_primary_ui() const {
+  return _impl_.primary_ui_;
+}
+inline uint64_t Commit::primary_ui() const {
+  // @@protoc_insertion_point(field_get:dsnet.minbft.proto.Commit.primary_ui)
+  return _internal_primary_ui();
+}
+inline void Commit::_internal_set_primary_ui(uint64_t value) {
+  
+  _impl_.primary_ui_ = value;
+}
+inline void Commit::set_primary_ui(uint64_t value) {
+  _internal_set_primary_ui(value);
+  // @@protoc_insertion_point(field_set:dsnet.minbft.proto.Commit.primary_ui)
+}
+
+// int32 replica_id = 3;
+inline void Commit::clear_replica_id() {
+  _impl_.replica_id_ = 0;
+}
+inline int32_t Commit::_internal_replica_id() const {
+  return _impl_.replica_id_;
+}
+inline int32_t Commit::replica_id() const {
+  // @@protoc_insertion_point(field_get:dsnet.minbft.proto.Commit.replica_id)
+  return _internal_replica_id();
+}
+inline void Commit::_internal_set_replica_id(int32_t value) {
+  
+  _impl_.replica_id_ = value;
+}
+inline void Commit::set_replica_id(int32_t value) {
+  _internal_set_replica_id(value);
+  // @@protoc_insertion_point(field_set:dsnet.minbft.proto.Commit.replica_id)
+}
+
+// -------------------------------------------------------------------
+
+// Checkpoint
+
+// uint64 op_number = 1;
+inline void Checkpoint::clear_op_number() {
+  _impl_.op_number_ = uint64_t{0u};
+}
+inline uint64_t Checkpoint::_internal_op_number() const {
+  return _impl_.op_number_;
+}
+inline uint64_t Checkpoint::op_number() const {
+  // @@protoc_insertion_point(field_get:dsnet.minbft.proto.Checkpoint.op_number)
+  return _internal_op_number();
+}
+inline void Checkpoint::_internal_set_op_number(uint64_t value) {
+  
+  _impl_.op_number_ = value;
+}
+inline void Checkpoint::set_op_number(uint64_t value) {
+  _internal_set_op_number(value);
+  // @@protoc_insertion_point(field_set:dsnet.minbft.proto.Checkpoint.op_number)
+}
+
+// int32 replica_id = 2;
+inline void Checkpoint::clear_replica_id() {
+  _impl_.replica_id_ = 0;
+}
+inline int32_t Checkpoint::_internal_replica_id() const {
+  return _impl_.replica_id_;
+}
+inline int32_t Checkpoint::replica_id() const {
+  // @@protoc_insertion_point(field_get:dsnet.minbft.proto.Checkpoint.replica_id)
+  return _internal_replica_id();
+}
+inline void Checkpoint::_internal_set_replica_id(int32_t value) {
+  
+  _impl_.replica_id_ = value;
+}
+inline void Checkpoint::set_replica_id(int32_t value) {
+  _internal_set_replica_id(value);
+  // @@protoc_insertion_point(field_set:dsnet.minbft.proto.Checkpoint.replica_id)
+}
+
+// bytes digest = 3;
+inline void Checkpoint::clear_digest() {
+  _impl_.digest_.ClearToEmpty();
+}
+inline const std::string& Checkpoint::digest() const {
+  // @@protoc_insertion_point(field_get:dsnet.minbft.proto.Checkpoint.digest)
+  return _internal_digest();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void Checkpoint::set_digest(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.digest_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:dsnet.minbft.proto.Checkpoint.digest)
+}
+inline std::string* Checkpoint::mutable_digest() {
+  std::string* _s = _internal_mutable_digest();
+  // @@protoc_insertion_point(field_mutable:dsnet.minbft.proto.Checkpoint.digest)
+  return _s;
+}
+inline const std::string& Checkpoint::_internal_digest() const {
+  return _impl_.digest_.Get();
+}
+inline void Checkpoint::_internal_set_digest(const std::string& value) {
+  
+  _impl_.digest_.Set(value, GetArenaForAllocation());
+}
+inline std::string* Checkpoint::_internal_mutable_digest() {
+  
+  return _impl_.digest_.Mutable(GetArenaForAllocation());
+}
+inline std::string* Checkpoint::release_digest() {
+  // @@protoc_insertion_point(field_release:dsnet.minbft.proto.Checkpoint.digest)
+  return _impl_.digest_.Release();
+}
+inline void Checkpoint::set_allocated_digest(std::string* digest) {
+  if (digest != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.digest_.SetAllocated(digest, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.digest_.IsDefault()) {
+    _impl_.digest_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:dsnet.minbft.proto.Checkpoint.digest)
+}
+
+// -------------------------------------------------------------------
+
+// StateRequest
+
+// uint64 ui = 1;
+inline void StateRequest::clear_ui() {
+  _impl_.ui_ = uint64_t{0u};
+}
+inline uint64_t StateRequest::_internal_ui() const {
+  return _impl_.ui_;
+}
+inline uint64_t StateRequest::ui() const {
+  // @@protoc_insertion_point(field_get:dsnet.minbft.proto.StateRequest.ui)
+  return _internal_ui();
+}
+inline void StateRequest::_internal_set_ui(uint64_t value) {
+  
+  _impl_.ui_ = value;
+}
+inline void StateRequest::set_ui(uint64_t value) {
+  _internal_set_ui(value);
+  // @@protoc_insertion_point(field_set:dsnet.minbft.proto.StateRequest.ui)
+}
+
+// uint64 last_ui = 2;
+inline void StateRequest::clear_last_ui() {
+  _impl_.last_ui_ = uint64_t{0u};
+}
+inline uint64_t StateRequest::_internal_last_ui() const {
+  return _impl_.last_ui_;
+}
+inline uint64_t StateRequest::last_ui() const {
+  // @@protoc_insertion_point(field_get:dsnet.minbft.proto.StateRequest.last_ui)
+  return _internal_last_ui();
+}
+inline void StateRequest::_internal_set_last_ui(uint64_t value) {
+  
+  _impl_.last_ui_ = value;
+}
+inline void StateRequest::set_last_ui(uint64_t value) {
+  _internal_set_last_ui(value);
+  // @@protoc_insertion_point(field_set:dsnet.minbft.proto.StateRequest.last_ui)
+}
+
+// int32 replica_id = 3;
+inline void StateRequest::clear_replica_id() {
+  _impl_.replica_id_ = 0;
+}
+inline int32_t StateRequest::_internal_replica_id() const {
+  return _impl_.replica_id_;
+}
+inline int32_t StateRequest::replica_id() const {
+  // @@protoc_insertion_point(field_get:dsnet.minbft.proto.StateRequest.replica_id)
+  return _internal_replica_id();
+}
+inline void StateRequest::_internal_set_replica_id(int32_t value) {
+  
+  _impl_.replica_id_ = value;
+}
+inline void StateRequest::set_replica_id(int32_t value) {
+  _internal_set_replica_id(value);
+  // @@protoc_insertion_point(field_set:dsnet.minbft.proto.StateRequest.replica_id)
+}
+
+// -------------------------------------------------------------------
+
+// StateChunk
+
+// uint64 ui = 1;
+inline void StateChunk::clear_ui() {
+  _impl_.ui_ = uint64_t{0u};
+}
+inline uint64_t StateChunk::_internal_ui() const {
+  return _impl_.ui_;
+}
+inline uint64_t StateChunk::ui() const {
+  // @@protoc_insertion_point(field_get:dsnet.minbft.proto.StateChunk.ui)
+  return _internal_ui();
+}
+inline void StateChunk::_internal_set_ui(uint64_t value) {
+  
+  _impl_.ui_ = value;
+}
+inline void StateChunk::set_ui(uint64_t value) {
+  _internal_set_ui(value);
+  // @@protoc_insertion_point(field_set:dsnet.minbft.proto.StateChunk.ui)
+}
+
+// repeated bytes ui_message = 2;
+inline int StateChunk::_internal_ui_message_size() const {
+  return _impl_.ui_message_.size();
+}
+inline int StateChunk::ui_message_size() const {
+  return _internal_ui_message_size();
+}
+inline void StateChunk::clear_ui_message() {
+  _impl_.ui_message_.Clear();
+}
+inline std::string* StateChunk::add_ui_message() {
+  std::string* _s = _internal_add_ui_message();
+  // @@protoc_insertion_point(field_add_mutable:dsnet.minbft.proto.StateChunk.ui_message)
+  return _s;
+}
+inline const std::string& StateChunk::_internal_ui_message(int index) const {
+  return _impl_.ui_message_.Get(index);
+}
+inline const std::string& StateChunk::ui_message(int index) const {
+  // @@protoc_insertion_point(field_get:dsnet.minbft.proto.StateChunk.ui_message)
+  return _internal_ui_message(index);
+}
+inline std::string* StateChunk::mutable_ui_message(int index) {
+  // @@protoc_insertion_point(field_mutable:dsnet.minbft.proto.StateChunk.ui_message)
+  return _impl_.ui_message_.Mutable(index);
+}
+inline void StateChunk::set_ui_message(int index, const std::string& value) {
+  _impl_.ui_message_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set:dsnet.minbft.proto.StateChunk.ui_message)
+}
+inline void StateChunk::set_ui_message(int index, std::string&& value) {
+  _impl_.ui_message_.Mutable(index)->assign(std::move(value));
+  // @@protoc_insertion_point(field_set:dsnet.minbft.proto.StateChunk.ui_message)
+}
+inline void StateChunk::set_ui_message(int index, const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.ui_message_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set_char:dsnet.minbft.proto.StateChunk.ui_message)
+}
+inline void StateChunk::set_ui_message(int index, const void* value, size_t size) {
+  _impl_.ui_message_.Mutable(index)->assign(
+    reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_set_pointer:dsnet.minbft.proto.StateChunk.ui_message)
+}
+inline std::string* StateChunk::_internal_add_ui_message() {
+  return _impl_.ui_message_.Add();
+}
+inline void StateChunk::add_ui_message(const std::string& value) {
+  _impl_.ui_message_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add:dsnet.minbft.proto.StateChunk.ui_message)
+}
+inline void StateChunk::add_ui_message(std::string&& value) {
+  _impl_.ui_message_.Add(std::move(value));
+  // @@protoc_insertion_point(field_add:dsnet.minbft.proto.StateChunk.ui_message)
+}
+inline void StateChunk::add_ui_message(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.ui_message_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add_char:dsnet.minbft.proto.StateChunk.ui_message)
+}
+inline void StateChunk::add_ui_message(const void* value, size_t size) {
+  _impl_.ui_message_.Add()->assign(reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_add_pointer:dsnet.minbft.proto.StateChunk.ui_message)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>&
+StateChunk::ui_message() const {
+  // @@protoc_insertion_point(field_list:dsnet.minbft.proto.StateChunk.ui_message)
+  return _impl_.ui_message_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>*
+StateChunk::mutable_ui_message() {
+  // @@protoc_insertion_point(field_mutable_list:dsnet.minbft.proto.StateChunk.ui_message)
+  return &_impl_.ui_message_;
+}
+
+// .dsnet.minbft.proto.StableCheckpoint checkpoint = 3;
+inline bool StateChunk::_internal_has_checkpoint() const {
+  return this != internal_default_instance() && _impl_.checkpoint_ != nullptr;
+}
+inline bool StateChunk::has_checkpoint() const {
+  return _internal_has_checkpoint();
+}
+inline void StateChunk::clear_checkpoint() {
+  if (GetArenaForAllocation() == nullptr && _impl_.checkpoint_ != nullptr) {
+    delete _impl_.checkpoint_;
+  }
+  _impl_.checkpoint_ = nullptr;
+}
+inline const ::dsnet::minbft::proto::StableCheckpoint& StateChunk::_internal_checkpoint() const {
+  const ::dsnet::minbft::proto::StableCheckpoint* p = _impl_.checkpoint_;
+  return p != nullptr ? *p : reinterpret_cast<const ::dsnet::minbft::proto::StableCheckpoint&>(
+      ::dsnet::minbft::proto::_StableCheckpoint_default_instance_);
+}
+inline const ::dsnet::minbft::proto::StableCheckpoint& StateChunk::checkpoint() const {
+  // @@protoc_insertion_point(field_get:dsnet.minbft.proto.StateChunk.checkpoint)
+  return _internal_checkpoint();
+}
+inline void StateChunk::unsafe_arena_set_allocated_checkpoint(
+    ::dsnet::minbft::proto::StableCheckpoint* checkpoint) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.checkpoint_);
+  }
+  _impl_.checkpoint_ = checkpoint;
+  if (checkpoint) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:dsnet.minbft.proto.StateChunk.checkpoint)
+}
+inline ::dsnet::minbft::proto::StableCheckpoint* StateChunk::release_checkpoint() {
+  
+  ::dsnet::minbft::proto::StableCheckpoint* temp = _impl_.checkpoint_;
+  _impl_.checkpoint_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::dsnet::minbft::proto::StableCheckpoint* StateChunk::unsafe_arena_release_checkpoint() {
+  // @@protoc_insertion_point(field_release:dsnet.minbft.proto.StateChunk.checkpoint)
+  
+  ::dsnet::minbft::proto::StableCheckpoint* temp = _impl_.checkpoint_;
+  _impl_.checkpoint_ = nullptr;
+  return temp;
+}
+inline ::dsnet::minbft::proto::StableCheckpoint* StateChunk::_internal_mutable_checkpoint() {
+  
+  if (_impl_.checkpoint_ == nullptr) {
+    auto* p = CreateMaybeMessage<::dsnet::minbft::proto::StableCheckpoint>(GetArenaForAllocation());
+    _impl_.checkpoint_ = p;
+  }
+  return _impl_.checkpoint_;
+}
+inline ::dsnet::minbft::proto::StableCheckpoint* StateChunk::mutable_checkpoint() {
+  ::dsnet::minbft::proto::StableCheckpoint* _msg = _internal_mutable_checkpoint();
+  // @@protoc_insertion_point(field_mutable:dsnet.minbft.proto.StateChunk.checkpoint)
+  return _msg;
+}
+inline void StateChunk::set_allocated_checkpoint(::dsnet::minbft::proto::StableCheckpoint* checkpoint) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.checkpoint_;
+  }
+  if (checkpoint) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(checkpoint);
+    if (message_arena != submessage_arena) {
+      checkpoint = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, checkpoint, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.checkpoint_ = checkpoint;
+  // @@protoc_insertion_point(field_set_allocated:dsnet.minbft.proto.StateChunk.checkpoint)
+}
+
+// -------------------------------------------------------------------
+
+// StableCheckpoint
+
+// uint64 op_number = 1;
+inline void StableCheckpoint::clear_op_number() {
+  _impl_.op_number_ = uint64_t{0u};
+}
+inline uint64_t StableCheckpoint::_internal_op_number() const {
+  return _impl_.op_number_;
+}
+inline uint64_t StableCheckpoint::op_number() const {
+  // @@protoc_insertion_point(field_get:dsnet.minbft.proto.StableCheckpoint.op_number)
+  return _internal_op_number();
+}
+inline void StableCheckpoint::_internal_set_op_number(uint64_t value) {
+  
+  _impl_.op_number_ = value;
+}
+inline void StableCheckpoint::set_op_number(uint64_t value) {
+  _internal_set_op_number(value);
+  // @@protoc_insertion_point(field_set:dsnet.minbft.proto.StableCheckpoint.op_number)
+}
+
+// bytes app_state = 2;
+inline void StableCheckpoint::clear_app_state() {
+  _impl_.app_state_.ClearToEmpty();
+}
+inline const std::string& StableCheckpoint::app_state() const {
+  // @@protoc_insertion_point(field_get:dsnet.minbft.proto.StableCheckpoint.app_state)
+  return _internal_app_state();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void StableCheckpoint::set_app_state(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.app_state_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:dsnet.minbft.proto.StableCheckpoint.app_state)
+}
+inline std::string* StableCheckpoint::mutable_app_state() {
+  std::string* _s = _internal_mutable_app_state();
+  // @@protoc_insertion_point(field_mutable:dsnet.minbft.proto.StableCheckpoint.app_state)
+  return _s;
+}
+inline const std::string& StableCheckpoint::_internal_app_state() const {
+  return _impl_.app_state_.Get();
+}
+inline void StableCheckpoint::_internal_set_app_state(const std::string& value) {
+  
+  _impl_.app_state_.Set(value, GetArenaForAllocation());
+}
+inline std::string* StableCheckpoint::_internal_mutable_app_state() {
+  
+  return _impl_.app_state_.Mutable(GetArenaForAllocation());
+}
+inline std::string* StableCheckpoint::release_app_state() {
+  // @@protoc_insertion_point(field_release:dsnet.minbft.proto.StableCheckpoint.app_state)
+  return _impl_.app_state_.Release();
+}
+inline void StableCheckpoint::set_allocated_app_state(std::string* app_state) {
+  if (app_state != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.app_state_.SetAllocated(app_state, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.app_state_.IsDefault()) {
+    _impl_.app_state_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:dsnet.minbft.proto.StableCheckpoint.app_state)
+}
+
+// repeated bytes ui_checkpoint = 3;
+inline int StableCheckpoint::_internal_ui_checkpoint_size() const {
+  return _impl_.ui_checkpoint_.size();
+}
+inline int StableCheckpoint::ui_checkpoint_size() const {
+  return _internal_ui_checkpoint_size();
+}
+inline void StableCheckpoint::clear_ui_checkpoint() {
+  _impl_.ui_checkpoint_.Clear();
+}
+inline std::string* StableCheckpoint::add_ui_checkpoint() {
+  std::string* _s = _internal_add_ui_checkpoint();
+  // @@protoc_insertion_point(field_add_mutable:dsnet.minbft.proto.StableCheckpoint.ui_checkpoint)
+  return _s;
+}
+inline const std::string& StableCheckpoint::_internal_ui_checkpoint(int index) const {
+  return _impl_.ui_checkpoint_.Get(index);
+}
+inline const std::string& StableCheckpoint::ui_checkpoint(int index) const {
+  // @@protoc_insertion_point(field_get:dsnet.minbft.proto.StableCheckpoint.ui_checkpoint)
+  return _internal_ui_checkpoint(index);
+}
+inline std::string* StableCheckpoint::mutable_ui_checkpoint(int index) {
+  // @@protoc_insertion_point(field_mutable:dsnet.minbft.proto.StableCheckpoint.ui_checkpoint)
+  return _impl_.ui_checkpoint_.Mutable(index);
+}
+inline void StableCheckpoint::set_ui_checkpoint(int index, const std::string& value) {
+  _impl_.ui_checkpoint_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set:dsnet.minbft.proto.StableCheckpoint.ui_checkpoint)
+}
+inline void StableCheckpoint::set_ui_checkpoint(int index, std::string&& value) {
+  _impl_.ui_checkpoint_.Mutable(index)->assign(std::move(value));
+  // @@protoc_insertion_point(field_set:dsnet.minbft.proto.StableCheckpoint.ui_checkpoint)
+}
+inline void StableCheckpoint::set_ui_checkpoint(int index, const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.ui_checkpoint_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set_char:dsnet.minbft.proto.StableCheckpoint.ui_checkpoint)
+}
+inline void StableCheckpoint::set_ui_checkpoint(int index, const void* value, size_t size) {
+  _impl_.ui_checkpoint_.Mutable(index)->assign(
+    reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_set_pointer:dsnet.minbft.proto.StableCheckpoint.ui_checkpoint)
+}
+inline std::string* StableCheckpoint::_internal_add_ui_checkpoint() {
+  return _impl_.ui_checkpoint_.Add();
+}
+inline void StableCheckpoint::add_ui_checkpoint(const std::string& value) {
+  _impl_.ui_checkpoint_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add:dsnet.minbft.proto.StableCheckpoint.ui_checkpoint)
+}
+inline void StableCheckpoint::add_ui_checkpoint(std::string&& value) {
+  _impl_.ui_checkpoint_.Add(std::move(value));
+  // @@protoc_insertion_point(field_add:dsnet.minbft.proto.StableCheckpoint.ui_checkpoint)
+}
+inline void StableCheckpoint::add_ui_checkpoint(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.ui_checkpoint_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add_char:dsnet.minbft.proto.StableCheckpoint.ui_checkpoint)
+}
+inline void StableCheckpoint::add_ui_checkpoint(const void* value, size_t size) {
+  _impl_.ui_checkpoint_.Add()->assign(reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_add_pointer:dsnet.minbft.proto.StableCheckpoint.ui_checkpoint)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>&
+StableCheckpoint::ui_checkpoint() const {
+  // @@protoc_insertion_point(field_list:dsnet.minbft.proto.StableCheckpoint.ui_checkpoint)
+  return _impl_.ui_checkpoint_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>*
+StableCheckpoint::mutable_ui_checkpoint() {
+  // @@protoc_insertion_point(field_mutable_list:dsnet.minbft.proto.StableCheckpoint.ui_checkpoint)
+  return &_impl_.ui_checkpoint_;
+}
+
+// uint64 collected_ui = 4;
+inline void StableCheckpoint::clear_collected_ui() {
+  _impl_.collected_ui_ = uint64_t{0u};
+}
+inline uint64_t StableCheckpoint::_internal_collected_ui() const {
+  return _impl_.collected_ui_;
+}
+inline uint64_t StableCheckpoint::collected_ui() const {
+  // @@protoc_insertion_point(field_get:dsnet.minbft.proto.StableCheckpoint.collected_ui)
+  return _internal_collected_ui();
+}
+inline void StableCheckpoint::_internal_set_collected_ui(uint64_t value) {
+  
+  _impl_.collected_ui_ = value;
+}
+inline void StableCheckpoint::set_collected_ui(uint64_t value) {
+  _internal_set_collected_ui(value);
+  // @@protoc_insertion_point(field_set:dsnet.minbft.proto.StableCheckpoint.collected_ui)
+}
+
+// uint64 collected_op = 5;
+inline void StableCheckpoint::clear_collected_op() {
+  _impl_.collected_op_ = uint64_t{0u};
+}
+inline uint64_t StableCheckpoint::_internal_collected_op() const {
+  return _impl_.collected_op_;
+}
+inline uint64_t StableCheckpoint::collected_op() const {
+  // @@protoc_insertion_point(field_get:dsnet.minbft.proto.StableCheckpoint.collected_op)
+  return _internal_collected_op();
+}
+inline void StableCheckpoint::_internal_set_collected_op(uint64_t value) {
+  
+  _impl_.collected_op_ = value;
+}
+inline void StableCheckpoint::set_collected_op(uint64_t value) {
+  _internal_set_collected_op(value);
+  // @@protoc_insertion_point(field_set:dsnet.minbft.proto.StableCheckpoint.collected_op)
+}
+
+// bytes digest = 6;
+inline void StableCheckpoint::clear_digest() {
+  _impl_.digest_.ClearToEmpty();
+}
+inline const std::string& StableCheckpoint::digest() const {
+  // @@protoc_insertion_point(field_get:dsnet.minbft.proto.StableCheckpoint.digest)
+  return _internal_digest();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void StableCheckpoint::set_digest(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.digest_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:dsnet.minbft.proto.StableCheckpoint.digest)
+}
+inline std::string* StableCheckpoint::mutable_digest() {
+  std::string* _s = _internal_mutable_digest();
+  // @@protoc_insertion_point(field_mutable:dsnet.minbft.proto.StableCheckpoint.digest)
+  return _s;
+}
+inline const std::string& StableCheckpoint::_internal_digest() const {
+  return _impl_.digest_.Get();
+}
+inline void StableCheckpoint::_internal_set_digest(const std::string& value) {
+  
+  _impl_.digest_.Set(value, GetArenaForAllocation());
+}
+inline std::string* StableCheckpoint::_internal_mutable_digest() {
+  
+  return _impl_.digest_.Mutable(GetArenaForAllocation());
+}
+inline std::string* StableCheckpoint::release_digest() {
+  // @@protoc_insertion_point(field_release:dsnet.minbft.proto.StableCheckpoint.digest)
+  return _impl_.digest_.Release();
+}
+inline void StableCheckpoint::set_allocated_digest(std::string* digest) {
+  if (digest != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.digest_.SetAllocated(digest, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.digest_.IsDefault()) {
+    _impl_.digest_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:dsnet.minbft.proto.StableCheckpoint.digest)
+}
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic pop
+#endif  // __GNUC__
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+
+// @@protoc_insertion_point(namespace_scope)
+
+}  // namespace proto
+}  // namespace minbft
+}  // namespace dsnet
+
+// @@protoc_insertion_point(global_scope)
+
+#include <google/protobuf/port_undef.inc>
+#endif  // GOOGLE_PROTOBUF_INCLUDED_GOOGLE_PROTOBUF_INCLUDED_replication_2fminbft_2fmessage_2eproto
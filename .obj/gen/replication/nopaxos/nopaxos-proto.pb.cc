@@ -0,0 +1,8045 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: replication/nopaxos/nopaxos-proto.proto
+
+#include "replication/nopaxos/nopaxos-proto.pb.h"
+
+#include <algorithm>
+
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/extension_set.h>
+#include <google/protobuf/wire_format_lite.h>
+#include <google/protobuf/descriptor.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/reflection_ops.h>
+#include <google/protobuf/wire_format.h>
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+
+PROTOBUF_PRAGMA_INIT_SEG
+
+namespace _pb = ::PROTOBUF_NAMESPACE_ID;
+namespace _pbi = _pb::internal;
+
+namespace dsnet {
+namespace nopaxos {
+namespace proto {
+PROTOBUF_CONSTEXPR ReplyMessage::ReplyMessage(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.reply_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.view_)*/uint64_t{0u}
+  , /*decltype(_impl_.sessnum_)*/uint64_t{0u}
+  , /*decltype(_impl_.opnum_)*/uint64_t{0u}
+  , /*decltype(_impl_.clientreqid_)*/uint64_t{0u}
+  , /*decltype(_impl_.replicaidx_)*/0u} {}
+struct ReplyMessageDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ReplyMessageDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ReplyMessageDefaultTypeInternal() {}
+  union {
+    ReplyMessage _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ReplyMessageDefaultTypeInternal _ReplyMessage_default_instance_;
+PROTOBUF_CONSTEXPR UnloggedReplyMessage::UnloggedReplyMessage(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.reply_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}} {}
+struct UnloggedReplyMessageDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR UnloggedReplyMessageDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~UnloggedReplyMessageDefaultTypeInternal() {}
+  union {
+    UnloggedReplyMessage _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 UnloggedReplyMessageDefaultTypeInternal _UnloggedReplyMessage_default_instance_;
+PROTOBUF_CONSTEXPR ToClientMessage::ToClientMessage(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.msg_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_._oneof_case_)*/{}} {}
+struct ToClientMessageDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ToClientMessageDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ToClientMessageDefaultTypeInternal() {}
+  union {
+    ToClientMessage _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ToClientMessageDefaultTypeInternal _ToClientMessage_default_instance_;
+PROTOBUF_CONSTEXPR RequestMessage::RequestMessage(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.req_)*/nullptr
+  , /*decltype(_impl_.sessnum_)*/uint64_t{0u}
+  , /*decltype(_impl_.msgnum_)*/uint64_t{0u}} {}
+struct RequestMessageDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR RequestMessageDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~RequestMessageDefaultTypeInternal() {}
+  union {
+    RequestMessage _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 RequestMessageDefaultTypeInternal _RequestMessage_default_instance_;
+PROTOBUF_CONSTEXPR UnloggedRequestMessage::UnloggedRequestMessage(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.req_)*/nullptr} {}
+struct UnloggedRequestMessageDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR UnloggedRequestMessageDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~UnloggedRequestMessageDefaultTypeInternal() {}
+  union {
+    UnloggedRequestMessage _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 UnloggedRequestMessageDefaultTypeInternal _UnloggedRequestMessage_default_instance_;
+PROTOBUF_CONSTEXPR GapRequestMessage::GapRequestMessage(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.view_)*/uint64_t{0u}
+  , /*decltype(_impl_.sessnum_)*/uint64_t{0u}
+  , /*decltype(_impl_.opnum_)*/uint64_t{0u}} {}
+struct GapRequestMessageDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR GapRequestMessageDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~GapRequestMessageDefaultTypeInternal() {}
+  union {
+    GapRequestMessage _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 GapRequestMessageDefaultTypeInternal _GapRequestMessage_default_instance_;
+PROTOBUF_CONSTEXPR GapReplyMessage::GapReplyMessage(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.req_)*/nullptr
+  , /*decltype(_impl_.view_)*/uint64_t{0u}
+  , /*decltype(_impl_.sessnum_)*/uint64_t{0u}
+  , /*decltype(_impl_.opnum_)*/uint64_t{0u}
+  , /*decltype(_impl_.isfound_)*/false
+  , /*decltype(_impl_.isgap_)*/false
+  , /*decltype(_impl_.replicaidx_)*/0u} {}
+struct GapReplyMessageDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR GapReplyMessageDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~GapReplyMessageDefaultTypeInternal() {}
+  union {
+    GapReplyMessage _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 GapReplyMessageDefaultTypeInternal _GapReplyMessage_default_instance_;
+PROTOBUF_CONSTEXPR StateTransferRequestMessage::StateTransferRequestMessage(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.sessnum_)*/uint64_t{0u}
+  , /*decltype(_impl_.view_)*/uint64_t{0u}
+  , /*decltype(_impl_.begin_)*/uint64_t{0u}
+  , /*decltype(_impl_.end_)*/uint64_t{0u}} {}
+struct StateTransferRequestMessageDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR StateTransferRequestMessageDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~StateTransferRequestMessageDefaultTypeInternal() {}
+  union {
+    StateTransferRequestMessage _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 StateTransferRequestMessageDefaultTypeInternal _StateTransferRequestMessage_default_instance_;
+PROTOBUF_CONSTEXPR StateTransferReplyMessage::StateTransferReplyMessage(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.entries_)*/{}
+  , /*decltype(_impl_.sessnum_)*/uint64_t{0u}
+  , /*decltype(_impl_.view_)*/uint64_t{0u}
+  , /*decltype(_impl_.begin_)*/uint64_t{0u}
+  , /*decltype(_impl_.end_)*/uint64_t{0u}} {}
+struct StateTransferReplyMessageDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR StateTransferReplyMessageDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~StateTransferReplyMessageDefaultTypeInternal() {}
+  union {
+    StateTransferReplyMessage _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 StateTransferReplyMessageDefaultTypeInternal _StateTransferReplyMessage_default_instance_;
+PROTOBUF_CONSTEXPR GapCommitMessage::GapCommitMessage(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.sessnum_)*/uint64_t{0u}
+  , /*decltype(_impl_.view_)*/uint64_t{0u}
+  , /*decltype(_impl_.opnum_)*/uint64_t{0u}} {}
+struct GapCommitMessageDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR GapCommitMessageDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~GapCommitMessageDefaultTypeInternal() {}
+  union {
+    GapCommitMessage _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 GapCommitMessageDefaultTypeInternal _GapCommitMessage_default_instance_;
+PROTOBUF_CONSTEXPR GapCommitReplyMessage::GapCommitReplyMessage(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.sessnum_)*/uint64_t{0u}
+  , /*decltype(_impl_.view_)*/uint64_t{0u}
+  , /*decltype(_impl_.opnum_)*/uint64_t{0u}
+  , /*decltype(_impl_.replicaidx_)*/0u} {}
+struct GapCommitReplyMessageDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR GapCommitReplyMessageDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~GapCommitReplyMessageDefaultTypeInternal() {}
+  union {
+    GapCommitReplyMessage _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 GapCommitReplyMessageDefaultTypeInternal _GapCommitReplyMessage_default_instance_;
+PROTOBUF_CONSTEXPR ViewChangeRequestMessage::ViewChangeRequestMessage(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.sessnum_)*/uint64_t{0u}
+  , /*decltype(_impl_.view_)*/uint64_t{0u}} {}
+struct ViewChangeRequestMessageDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ViewChangeRequestMessageDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ViewChangeRequestMessageDefaultTypeInternal() {}
+  union {
+    ViewChangeRequestMessage _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ViewChangeRequestMessageDefaultTypeInternal _ViewChangeRequestMessage_default_instance_;
+PROTOBUF_CONSTEXPR ViewChangeMessage::ViewChangeMessage(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.committedgaps_)*/{}
+  , /*decltype(_impl_.sessnum_)*/uint64_t{0u}
+  , /*decltype(_impl_.view_)*/uint64_t{0u}
+  , /*decltype(_impl_.lastnormalsessnum_)*/uint64_t{0u}
+  , /*decltype(_impl_.lastnormalview_)*/uint64_t{0u}
+  , /*decltype(_impl_.lastop_)*/uint64_t{0u}
+  , /*decltype(_impl_.replicaidx_)*/0u} {}
+struct ViewChangeMessageDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ViewChangeMessageDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ViewChangeMessageDefaultTypeInternal() {}
+  union {
+    ViewChangeMessage _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ViewChangeMessageDefaultTypeInternal _ViewChangeMessage_default_instance_;
+PROTOBUF_CONSTEXPR StartViewMessage::StartViewMessage(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.committedgaps_)*/{}
+  , /*decltype(_impl_.sessnum_)*/uint64_t{0u}
+  , /*decltype(_impl_.view_)*/uint64_t{0u}
+  , /*decltype(_impl_.lastnormalsessnum_)*/uint64_t{0u}
+  , /*decltype(_impl_.lastnormalview_)*/uint64_t{0u}
+  , /*decltype(_impl_.lastop_)*/uint64_t{0u}} {}
+struct StartViewMessageDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR StartViewMessageDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~StartViewMessageDefaultTypeInternal() {}
+  union {
+    StartViewMessage _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 StartViewMessageDefaultTypeInternal _StartViewMessage_default_instance_;
+PROTOBUF_CONSTEXPR StartViewReplyMessage::StartViewReplyMessage(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.sessnum_)*/uint64_t{0u}
+  , /*decltype(_impl_.view_)*/uint64_t{0u}
+  , /*decltype(_impl_.replicaidx_)*/0u} {}
+struct StartViewReplyMessageDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR StartViewReplyMessageDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~StartViewReplyMessageDefaultTypeInternal() {}
+  union {
+    StartViewReplyMessage _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 StartViewReplyMessageDefaultTypeInternal _StartViewReplyMessage_default_instance_;
+PROTOBUF_CONSTEXPR SyncPrepareRequestMessage::SyncPrepareRequestMessage(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.sessnum_)*/uint64_t{0u}
+  , /*decltype(_impl_.view_)*/uint64_t{0u}} {}
+struct SyncPrepareRequestMessageDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR SyncPrepareRequestMessageDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~SyncPrepareRequestMessageDefaultTypeInternal() {}
+  union {
+    SyncPrepareRequestMessage _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 SyncPrepareRequestMessageDefaultTypeInternal _SyncPrepareRequestMessage_default_instance_;
+PROTOBUF_CONSTEXPR SyncPrepareMessage::SyncPrepareMessage(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.committedgaps_)*/{}
+  , /*decltype(_impl_.sessnum_)*/uint64_t{0u}
+  , /*decltype(_impl_.view_)*/uint64_t{0u}
+  , /*decltype(_impl_.lastop_)*/uint64_t{0u}} {}
+struct SyncPrepareMessageDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR SyncPrepareMessageDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~SyncPrepareMessageDefaultTypeInternal() {}
+  union {
+    SyncPrepareMessage _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 SyncPrepareMessageDefaultTypeInternal _SyncPrepareMessage_default_instance_;
+PROTOBUF_CONSTEXPR SyncPrepareReplyMessage::SyncPrepareReplyMessage(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.sessnum_)*/uint64_t{0u}
+  , /*decltype(_impl_.view_)*/uint64_t{0u}
+  , /*decltype(_impl_.syncpoint_)*/uint64_t{0u}
+  , /*decltype(_impl_.replicaidx_)*/0u} {}
+struct SyncPrepareReplyMessageDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR SyncPrepareReplyMessageDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~SyncPrepareReplyMessageDefaultTypeInternal() {}
+  union {
+    SyncPrepareReplyMessage _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 SyncPrepareReplyMessageDefaultTypeInternal _SyncPrepareReplyMessage_default_instance_;
+PROTOBUF_CONSTEXPR SyncCommitMessage::SyncCommitMessage(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.sessnum_)*/uint64_t{0u}
+  , /*decltype(_impl_.view_)*/uint64_t{0u}
+  , /*decltype(_impl_.syncpoint_)*/uint64_t{0u}} {}
+struct SyncCommitMessageDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR SyncCommitMessageDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~SyncCommitMessageDefaultTypeInternal() {}
+  union {
+    SyncCommitMessage _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 SyncCommitMessageDefaultTypeInternal _SyncCommitMessage_default_instance_;
+PROTOBUF_CONSTEXPR ToReplicaMessage::ToReplicaMessage(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.msg_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_._oneof_case_)*/{}} {}
+struct ToReplicaMessageDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ToReplicaMessageDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ToReplicaMessageDefaultTypeInternal() {}
+  union {
+    ToReplicaMessage _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ToReplicaMessageDefaultTypeInternal _ToReplicaMessage_default_instance_;
+}  // namespace proto
+}  // namespace nopaxos
+}  // namespace dsnet
+static ::_pb::Metadata file_level_metadata_replication_2fnopaxos_2fnopaxos_2dproto_2eproto[20];
+static constexpr ::_pb::EnumDescriptor const** file_level_enum_descriptors_replication_2fnopaxos_2fnopaxos_2dproto_2eproto = nullptr;
+static constexpr ::_pb::ServiceDescriptor const** file_level_service_descriptors_replication_2fnopaxos_2fnopaxos_2dproto_2eproto = nullptr;
+
+const uint32_t TableStruct_replication_2fnopaxos_2fnopaxos_2dproto_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  PROTOBUF_FIELD_OFFSET(::dsnet::nopaxos::proto::ReplyMessage, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::nopaxos::proto::ReplyMessage, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::dsnet::nopaxos::proto::ReplyMessage, _impl_.view_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::nopaxos::proto::ReplyMessage, _impl_.sessnum_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::nopaxos::proto::ReplyMessage, _impl_.opnum_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::nopaxos::proto::ReplyMessage, _impl_.clientreqid_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::nopaxos::proto::ReplyMessage, _impl_.replicaidx_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::nopaxos::proto::ReplyMessage, _impl_.reply_),
+  1,
+  2,
+  3,
+  4,
+  5,
+  0,
+  PROTOBUF_FIELD_OFFSET(::dsnet::nopaxos::proto::UnloggedReplyMessage, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::nopaxos::proto::UnloggedReplyMessage, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::dsnet::nopaxos::proto::UnloggedReplyMessage, _impl_.reply_),
+  0,
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::dsnet::nopaxos::proto::ToClientMessage, _internal_metadata_),
+  ~0u,  // no _extensions_
+  PROTOBUF_FIELD_OFFSET(::dsnet::nopaxos::proto::ToClientMessage, _impl_._oneof_case_[0]),
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  PROTOBUF_FIELD_OFFSET(::dsnet::nopaxos::proto::ToClientMessage, _impl_.msg_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::nopaxos::proto::RequestMessage, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::nopaxos::proto::RequestMessage, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::dsnet::nopaxos::proto::RequestMessage, _impl_.sessnum_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::nopaxos::proto::RequestMessage, _impl_.msgnum_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::nopaxos::proto::RequestMessage, _impl_.req_),
+  1,
+  2,
+  0,
+  PROTOBUF_FIELD_OFFSET(::dsnet::nopaxos::proto::UnloggedRequestMessage, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::nopaxos::proto::UnloggedRequestMessage, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::dsnet::nopaxos::proto::UnloggedRequestMessage, _impl_.req_),
+  0,
+  PROTOBUF_FIELD_OFFSET(::dsnet::nopaxos::proto::GapRequestMessage, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::nopaxos::proto::GapRequestMessage, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::dsnet::nopaxos::proto::GapRequestMessage, _impl_.view_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::nopaxos::proto::GapRequestMessage, _impl_.sessnum_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::nopaxos::proto::GapRequestMessage, _impl_.opnum_),
+  0,
+  1,
+  2,
+  PROTOBUF_FIELD_OFFSET(::dsnet::nopaxos::proto::GapReplyMessage, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::nopaxos::proto::GapReplyMessage, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::dsnet::nopaxos::proto::GapReplyMessage, _impl_.view_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::nopaxos::proto::GapReplyMessage, _impl_.sessnum_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::nopaxos::proto::GapReplyMessage, _impl_.opnum_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::nopaxos::proto::GapReplyMessage, _impl_.isfound_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::nopaxos::proto::GapReplyMessage, _impl_.isgap_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::nopaxos::proto::GapReplyMessage, _impl_.replicaidx_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::nopaxos::proto::GapReplyMessage, _impl_.req_),
+  1,
+  2,
+  3,
+  4,
+  5,
+  6,
+  0,
+  PROTOBUF_FIELD_OFFSET(::dsnet::nopaxos::proto::StateTransferRequestMessage, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::nopaxos::proto::StateTransferRequestMessage, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::dsnet::nopaxos::proto::StateTransferRequestMessage, _impl_.sessnum_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::nopaxos::proto::StateTransferRequestMessage, _impl_.view_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::nopaxos::proto::StateTransferRequestMessage, _impl_.begin_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::nopaxos::proto::StateTransferRequestMessage, _impl_.end_),
+  0,
+  1,
+  2,
+  3,
+  PROTOBUF_FIELD_OFFSET(::dsnet::nopaxos::proto::StateTransferReplyMessage, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::nopaxos::proto::StateTransferReplyMessage, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::dsnet::nopaxos::proto::StateTransferReplyMessage, _impl_.sessnum_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::nopaxos::proto::StateTransferReplyMessage, _impl_.view_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::nopaxos::proto::StateTransferReplyMessage, _impl_.begin_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::nopaxos::proto::StateTransferReplyMessage, _impl_.end_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::nopaxos::proto::StateTransferReplyMessage, _impl_.entries_),
+  0,
+  1,
+  2,
+  3,
+  ~0u,
+  PROTOBUF_FIELD_OFFSET(::dsnet::nopaxos::proto::GapCommitMessage, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::nopaxos::proto::GapCommitMessage, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::dsnet::nopaxos::proto::GapCommitMessage, _impl_.sessnum_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::nopaxos::proto::GapCommitMessage, _impl_.view_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::nopaxos::proto::GapCommitMessage, _impl_.opnum_),
+  0,
+  1,
+  2,
+  PROTOBUF_FIELD_OFFSET(::dsnet::nopaxos::proto::GapCommitReplyMessage, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::nopaxos::proto::GapCommitReplyMessage, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::dsnet::nopaxos::proto::GapCommitReplyMessage, _impl_.sessnum_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::nopaxos::proto::GapCommitReplyMessage, _impl_.view_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::nopaxos::proto::GapCommitReplyMessage, _impl_.opnum_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::nopaxos::proto::GapCommitReplyMessage, _impl_.replicaidx_),
+  0,
+  1,
+  2,
+  3,
+  PROTOBUF_FIELD_OFFSET(::dsnet::nopaxos::proto::ViewChangeRequestMessage, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::nopaxos::proto::ViewChangeRequestMessage, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::dsnet::nopaxos::proto::ViewChangeRequestMessage, _impl_.sessnum_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::nopaxos::proto::ViewChangeRequestMessage, _impl_.view_),
+  0,
+  1,
+  PROTOBUF_FIELD_OFFSET(::dsnet::nopaxos::proto::ViewChangeMessage, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::nopaxos::proto::ViewChangeMessage, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::dsnet::nopaxos::proto::ViewChangeMessage, _impl_.sessnum_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::nopaxos::proto::ViewChangeMessage, _impl_.view_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::nopaxos::proto::ViewChangeMessage, _impl_.lastnormalsessnum_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::nopaxos::proto::ViewChangeMessage, _impl_.lastnormalview_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::nopaxos::proto::ViewChangeMessage, _impl_.lastop_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::nopaxos::proto::ViewChangeMessage, _impl_.committedgaps_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::nopaxos::proto::ViewChangeMessage, _impl_.replicaidx_),
+  0,
+  1,
+  2,
+  3,
+  4,
+  ~0u,
+  5,
+  PROTOBUF_FIELD_OFFSET(::dsnet::nopaxos::proto::StartViewMessage, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::nopaxos::proto::StartViewMessage, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::dsnet::nopaxos::proto::StartViewMessage, _impl_.sessnum_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::nopaxos::proto::StartViewMessage, _impl_.view_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::nopaxos::proto::StartViewMessage, _impl_.lastnormalsessnum_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::nopaxos::proto::StartViewMessage, _impl_.lastnormalview_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::nopaxos::proto::StartViewMessage, _impl_.lastop_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::nopaxos::proto::StartViewMessage, _impl_.committedgaps_),
+  0,
+  1,
+  2,
+  3,
+  4,
+  ~0u,
+  PROTOBUF_FIELD_OFFSET(::dsnet::nopaxos::proto::StartViewReplyMessage, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::nopaxos::proto::StartViewReplyMessage, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::dsnet::nopaxos::proto::StartViewReplyMessage, _impl_.sessnum_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::nopaxos::proto::StartViewReplyMessage, _impl_.view_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::nopaxos::proto::StartViewReplyMessage, _impl_.replicaidx_),
+  0,
+  1,
+  2,
+  PROTOBUF_FIELD_OFFSET(::dsnet::nopaxos::proto::SyncPrepareRequestMessage, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::nopaxos::proto::SyncPrepareRequestMessage, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::dsnet::nopaxos::proto::SyncPrepareRequestMessage, _impl_.sessnum_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::nopaxos::proto::SyncPrepareRequestMessage, _impl_.view_),
+  0,
+  1,
+  PROTOBUF_FIELD_OFFSET(::dsnet::nopaxos::proto::SyncPrepareMessage, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::nopaxos::proto::SyncPrepareMessage, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::dsnet::nopaxos::proto::SyncPrepareMessage, _impl_.sessnum_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::nopaxos::proto::SyncPrepareMessage, _impl_.view_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::nopaxos::proto::SyncPrepareMessage, _impl_.lastop_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::nopaxos::proto::SyncPrepareMessage, _impl_.committedgaps_),
+  0,
+  1,
+  2,
+  ~0u,
+  PROTOBUF_FIELD_OFFSET(::dsnet::nopaxos::proto::SyncPrepareReplyMessage, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::nopaxos::proto::SyncPrepareReplyMessage, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::dsnet::nopaxos::proto::SyncPrepareReplyMessage, _impl_.sessnum_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::nopaxos::proto::SyncPrepareReplyMessage, _impl_.view_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::nopaxos::proto::SyncPrepareReplyMessage, _impl_.syncpoint_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::nopaxos::proto::SyncPrepareReplyMessage, _impl_.replicaidx_),
+  0,
+  1,
+  2,
+  3,
+  PROTOBUF_FIELD_OFFSET(::dsnet::nopaxos::proto::SyncCommitMessage, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::nopaxos::proto::SyncCommitMessage, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::dsnet::nopaxos::proto::SyncCommitMessage, _impl_.sessnum_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::nopaxos::proto::SyncCommitMessage, _impl_.view_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::nopaxos::proto::SyncCommitMessage, _impl_.syncpoint_),
+  0,
+  1,
+  2,
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::dsnet::nopaxos::proto::ToReplicaMessage, _internal_metadata_),
+  ~0u,  // no _extensions_
+  PROTOBUF_FIELD_OFFSET(::dsnet::nopaxos::proto::ToReplicaMessage, _impl_._oneof_case_[0]),
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  PROTOBUF_FIELD_OFFSET(::dsnet::nopaxos::proto::ToReplicaMessage, _impl_.msg_),
+};
+static const ::_pbi::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  { 0, 12, -1, sizeof(::dsnet::nopaxos::proto::ReplyMessage)},
+  { 18, 25, -1, sizeof(::dsnet::nopaxos::proto::UnloggedReplyMessage)},
+  { 26, -1, -1, sizeof(::dsnet::nopaxos::proto::ToClientMessage)},
+  { 35, 44, -1, sizeof(::dsnet::nopaxos::proto::RequestMessage)},
+  { 47, 54, -1, sizeof(::dsnet::nopaxos::proto::UnloggedRequestMessage)},
+  { 55, 64, -1, sizeof(::dsnet::nopaxos::proto::GapRequestMessage)},
+  { 67, 80, -1, sizeof(::dsnet::nopaxos::proto::GapReplyMessage)},
+  { 87, 97, -1, sizeof(::dsnet::nopaxos::proto::StateTransferRequestMessage)},
+  { 101, 112, -1, sizeof(::dsnet::nopaxos::proto::StateTransferReplyMessage)},
+  { 117, 126, -1, sizeof(::dsnet::nopaxos::proto::GapCommitMessage)},
+  { 129, 139, -1, sizeof(::dsnet::nopaxos::proto::GapCommitReplyMessage)},
+  { 143, 151, -1, sizeof(::dsnet::nopaxos::proto::ViewChangeRequestMessage)},
+  { 153, 166, -1, sizeof(::dsnet::nopaxos::proto::ViewChangeMessage)},
+  { 173, 185, -1, sizeof(::dsnet::nopaxos::proto::StartViewMessage)},
+  { 191, 200, -1, sizeof(::dsnet::nopaxos::proto::StartViewReplyMessage)},
+  { 203, 211, -1, sizeof(::dsnet::nopaxos::proto::SyncPrepareRequestMessage)},
+  { 213, 223, -1, sizeof(::dsnet::nopaxos::proto::SyncPrepareMessage)},
+  { 227, 237, -1, sizeof(::dsnet::nopaxos::proto::SyncPrepareReplyMessage)},
+  { 241, 250, -1, sizeof(::dsnet::nopaxos::proto::SyncCommitMessage)},
+  { 253, -1, -1, sizeof(::dsnet::nopaxos::proto::ToReplicaMessage)},
+};
+
+static const ::_pb::Message* const file_default_instances[] = {
+  &::dsnet::nopaxos::proto::_ReplyMessage_default_instance_._instance,
+  &::dsnet::nopaxos::proto::_UnloggedReplyMessage_default_instance_._instance,
+  &::dsnet::nopaxos::proto::_ToClientMessage_default_instance_._instance,
+  &::dsnet::nopaxos::proto::_RequestMessage_default_instance_._instance,
+  &::dsnet::nopaxos::proto::_UnloggedRequestMessage_default_instance_._instance,
+  &::dsnet::nopaxos::proto::_GapRequestMessage_default_instance_._instance,
+  &::dsnet::nopaxos::proto::_GapReplyMessage_default_instance_._instance,
+  &::dsnet::nopaxos::proto::_StateTransferRequestMessage_default_instance_._instance,
+  &::dsnet::nopaxos::proto::_StateTransferReplyMessage_default_instance_._instance,
+  &::dsnet::nopaxos::proto::_GapCommitMessage_default_instance_._instance,
+  &::dsnet::nopaxos::proto::_GapCommitReplyMessage_default_instance_._instance,
+  &::dsnet::nopaxos::proto::_ViewChangeRequestMessage_default_instance_._instance,
+  &::dsnet::nopaxos::proto::_ViewChangeMessage_default_instance_._instance,
+  &::dsnet::nopaxos::proto::_StartViewMessage_default_instance_._instance,
+  &::dsnet::nopaxos::proto::_StartViewReplyMessage_default_instance_._instance,
+  &::dsnet::nopaxos::proto::_SyncPrepareRequestMessage_default_instance_._instance,
+  &::dsnet::nopaxos::proto::_SyncPrepareMessage_default_instance_._instance,
+  &::dsnet::nopaxos::proto::_SyncPrepareReplyMessage_default_instance_._instance,
+  &::dsnet::nopaxos::proto::_SyncCommitMessage_default_instance_._instance,
+  &::dsnet::nopaxos::proto::_ToReplicaMessage_default_instance_._instance,
+};
+
+const char descriptor_table_protodef_replication_2fnopaxos_2fnopaxos_2dproto_2eproto[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) =
+  "\n\'replication/nopaxos/nopaxos-proto.prot"
+  "o\022\023dsnet.nopaxos.proto\032\024common/request.p"
+  "roto\"t\n\014ReplyMessage\022\014\n\004view\030\001 \002(\004\022\017\n\007se"
+  "ssnum\030\002 \002(\004\022\r\n\005opnum\030\003 \002(\004\022\023\n\013clientreqi"
+  "d\030\004 \002(\004\022\022\n\nreplicaidx\030\005 \002(\r\022\r\n\005reply\030\006 \001"
+  "(\014\"%\n\024UnloggedReplyMessage\022\r\n\005reply\030\001 \002("
+  "\014\"\221\001\n\017ToClientMessage\0222\n\005reply\030\001 \001(\0132!.d"
+  "snet.nopaxos.proto.ReplyMessageH\000\022C\n\016unl"
+  "ogged_reply\030\002 \001(\0132).dsnet.nopaxos.proto."
+  "UnloggedReplyMessageH\000B\005\n\003msg\"N\n\016Request"
+  "Message\022\017\n\007sessnum\030\001 \002(\004\022\016\n\006msgnum\030\002 \002(\004"
+  "\022\033\n\003req\030\003 \002(\0132\016.dsnet.Request\"=\n\026Unlogge"
+  "dRequestMessage\022#\n\003req\030\001 \002(\0132\026.dsnet.Unl"
+  "oggedRequest\"A\n\021GapRequestMessage\022\014\n\004vie"
+  "w\030\001 \002(\004\022\017\n\007sessnum\030\002 \002(\004\022\r\n\005opnum\030\003 \002(\004\""
+  "\220\001\n\017GapReplyMessage\022\014\n\004view\030\001 \002(\004\022\017\n\007ses"
+  "snum\030\002 \002(\004\022\r\n\005opnum\030\003 \002(\004\022\017\n\007isfound\030\004 \002"
+  "(\010\022\r\n\005isgap\030\005 \002(\010\022\022\n\nreplicaidx\030\006 \002(\r\022\033\n"
+  "\003req\030\007 \001(\0132\016.dsnet.Request\"X\n\033StateTrans"
+  "ferRequestMessage\022\017\n\007sessnum\030\001 \002(\004\022\014\n\004vi"
+  "ew\030\002 \002(\004\022\r\n\005begin\030\003 \002(\004\022\013\n\003end\030\004 \002(\004\"{\n\031"
+  "StateTransferReplyMessage\022\017\n\007sessnum\030\001 \002"
+  "(\004\022\014\n\004view\030\002 \002(\004\022\r\n\005begin\030\003 \002(\004\022\013\n\003end\030\004"
+  " \002(\004\022#\n\007entries\030\005 \003(\0132\022.dsnet.MsgLogEntr"
+  "y\"@\n\020GapCommitMessage\022\017\n\007sessnum\030\001 \002(\004\022\014"
+  "\n\004view\030\002 \002(\004\022\r\n\005opnum\030\003 \002(\004\"Y\n\025GapCommit"
+  "ReplyMessage\022\017\n\007sessnum\030\001 \002(\004\022\014\n\004view\030\002 "
+  "\002(\004\022\r\n\005opnum\030\003 \002(\004\022\022\n\nreplicaidx\030\004 \002(\r\"9"
+  "\n\030ViewChangeRequestMessage\022\017\n\007sessnum\030\001 "
+  "\002(\004\022\014\n\004view\030\002 \002(\004\"\240\001\n\021ViewChangeMessage\022"
+  "\017\n\007sessnum\030\001 \002(\004\022\014\n\004view\030\002 \002(\004\022\031\n\021lastno"
+  "rmalsessnum\030\003 \002(\004\022\026\n\016lastnormalview\030\004 \002("
+  "\004\022\016\n\006lastop\030\005 \002(\004\022\025\n\rcommittedgaps\030\006 \003(\004"
+  "\022\022\n\nreplicaidx\030\007 \002(\r\"\213\001\n\020StartViewMessag"
+  "e\022\017\n\007sessnum\030\001 \002(\004\022\014\n\004view\030\002 \002(\004\022\031\n\021last"
+  "normalsessnum\030\003 \002(\004\022\026\n\016lastnormalview\030\004 "
+  "\002(\004\022\016\n\006lastop\030\005 \002(\004\022\025\n\rcommittedgaps\030\006 \003"
+  "(\004\"J\n\025StartViewReplyMessage\022\017\n\007sessnum\030\001"
+  " \002(\004\022\014\n\004view\030\002 \002(\004\022\022\n\nreplicaidx\030\003 \002(\r\":"
+  "\n\031SyncPrepareRequestMessage\022\017\n\007sessnum\030\001"
+  " \002(\004\022\014\n\004view\030\002 \002(\004\"Z\n\022SyncPrepareMessage"
+  "\022\017\n\007sessnum\030\001 \002(\004\022\014\n\004view\030\002 \002(\004\022\016\n\006lasto"
+  "p\030\003 \002(\004\022\025\n\rcommittedgaps\030\004 \003(\004\"_\n\027SyncPr"
+  "epareReplyMessage\022\017\n\007sessnum\030\001 \002(\004\022\014\n\004vi"
+  "ew\030\002 \002(\004\022\021\n\tsyncpoint\030\003 \002(\004\022\022\n\nreplicaid"
+  "x\030\004 \002(\r\"E\n\021SyncCommitMessage\022\017\n\007sessnum\030"
+  "\001 \002(\004\022\014\n\004view\030\002 \002(\004\022\021\n\tsyncpoint\030\003 \002(\004\"\353"
+  "\010\n\020ToReplicaMessage\0226\n\007request\030\001 \001(\0132#.d"
+  "snet.nopaxos.proto.RequestMessageH\000\022G\n\020u"
+  "nlogged_request\030\002 \001(\0132+.dsnet.nopaxos.pr"
+  "oto.UnloggedRequestMessageH\000\022=\n\013gap_requ"
+  "est\030\003 \001(\0132&.dsnet.nopaxos.proto.GapReque"
+  "stMessageH\000\0229\n\tgap_reply\030\004 \001(\0132$.dsnet.n"
+  "opaxos.proto.GapReplyMessageH\000\022R\n\026state_"
+  "transfer_request\030\005 \001(\01320.dsnet.nopaxos.p"
+  "roto.StateTransferRequestMessageH\000\022N\n\024st"
+  "ate_transfer_reply\030\006 \001(\0132..dsnet.nopaxos"
+  ".proto.StateTransferReplyMessageH\000\022;\n\nga"
+  "p_commit\030\007 \001(\0132%.dsnet.nopaxos.proto.Gap"
+  "CommitMessageH\000\022F\n\020gap_commit_reply\030\010 \001("
+  "\0132*.dsnet.nopaxos.proto.GapCommitReplyMe"
+  "ssageH\000\022L\n\023view_change_request\030\t \001(\0132-.d"
+  "snet.nopaxos.proto.ViewChangeRequestMess"
+  "ageH\000\022=\n\013view_change\030\n \001(\0132&.dsnet.nopax"
+  "os.proto.ViewChangeMessageH\000\022;\n\nstart_vi"
+  "ew\030\013 \001(\0132%.dsnet.nopaxos.proto.StartView"
+  "MessageH\000\022F\n\020start_view_reply\030\014 \001(\0132*.ds"
+  "net.nopaxos.proto.StartViewReplyMessageH"
+  "\000\022N\n\024sync_prepare_request\030\r \001(\0132..dsnet."
+  "nopaxos.proto.SyncPrepareRequestMessageH"
+  "\000\022\?\n\014sync_prepare\030\016 \001(\0132\'.dsnet.nopaxos."
+  "proto.SyncPrepareMessageH\000\022J\n\022sync_prepa"
+  "re_reply\030\017 \001(\0132,.dsnet.nopaxos.proto.Syn"
+  "cPrepareReplyMessageH\000\022=\n\013sync_commit\030\020 "
+  "\001(\0132&.dsnet.nopaxos.proto.SyncCommitMess"
+  "ageH\000B\005\n\003msg"
+  ;
+static const ::_pbi::DescriptorTable* const descriptor_table_replication_2fnopaxos_2fnopaxos_2dproto_2eproto_deps[1] = {
+  &::descriptor_table_common_2frequest_2eproto,
+};
+static ::_pbi::once_flag descriptor_table_replication_2fnopaxos_2fnopaxos_2dproto_2eproto_once;
+const ::_pbi::DescriptorTable descriptor_table_replication_2fnopaxos_2fnopaxos_2dproto_2eproto = {
+    false, false, 3012, descriptor_table_protodef_replication_2fnopaxos_2fnopaxos_2dproto_2eproto,
+    "replication/nopaxos/nopaxos-proto.proto",
+    &descriptor_table_replication_2fnopaxos_2fnopaxos_2dproto_2eproto_once, descriptor_table_replication_2fnopaxos_2fnopaxos_2dproto_2eproto_deps, 1, 20,
+    schemas, file_default_instances, TableStruct_replication_2fnopaxos_2fnopaxos_2dproto_2eproto::offsets,
+    file_level_metadata_replication_2fnopaxos_2fnopaxos_2dproto_2eproto, file_level_enum_descriptors_replication_2fnopaxos_2fnopaxos_2dproto_2eproto,
+    file_level_service_descriptors_replication_2fnopaxos_2fnopaxos_2dproto_2eproto,
+};
+PROTOBUF_ATTRIBUTE_WEAK const ::_pbi::DescriptorTable* descriptor_table_replication_2fnopaxos_2fnopaxos_2dproto_2eproto_getter() {
+  return &descriptor_table_replication_2fnopaxos_2fnopaxos_2dproto_2eproto;
+}
+
+// Force running AddDescriptors() at dynamic initialization time.
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 static ::_pbi::AddDescriptorsRunner dynamic_init_dummy_replication_2fnopaxos_2fnopaxos_2dproto_2eproto(&descriptor_table_replication_2fnopaxos_2fnopaxos_2dproto_2eproto);
+namespace dsnet {
+namespace nopaxos {
+namespace proto {
+
+// ===================================================================
+
+class ReplyMessage::_Internal {
+ public:
+  using HasBits = decltype(std::declval<ReplyMessage>()._impl_._has_bits_);
+  static void set_has_view(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_sessnum(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static void set_has_opnum(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+  static void set_has_clientreqid(HasBits* has_bits) {
+    (*has_bits)[0] |= 16u;
+  }
+  static void set_has_replicaidx(HasBits* has_bits) {
+    (*has_bits)[0] |= 32u;
+  }
+  static void set_has_reply(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x0000003e) ^ 0x0000003e) != 0;
+  }
+};
+
+ReplyMessage::ReplyMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:dsnet.nopaxos.proto.ReplyMessage)
+}
+ReplyMessage::ReplyMessage(const ReplyMessage& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  ReplyMessage* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.reply_){}
+    , decltype(_impl_.view_){}
+    , decltype(_impl_.sessnum_){}
+    , decltype(_impl_.opnum_){}
+    , decltype(_impl_.clientreqid_){}
+    , decltype(_impl_.replicaidx_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.reply_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.reply_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_reply()) {
+    _this->_impl_.reply_.Set(from._internal_reply(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.view_, &from._impl_.view_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.replicaidx_) -
+    reinterpret_cast<char*>(&_impl_.view_)) + sizeof(_impl_.replicaidx_));
+  // @@protoc_insertion_point(copy_constructor:dsnet.nopaxos.proto.ReplyMessage)
+}
+
+inline void ReplyMessage::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.reply_){}
+    , decltype(_impl_.view_){uint64_t{0u}}
+    , decltype(_impl_.sessnum_){uint64_t{0u}}
+    , decltype(_impl_.opnum_){uint64_t{0u}}
+    , decltype(_impl_.clientreqid_){uint64_t{0u}}
+    , decltype(_impl_.replicaidx_){0u}
+  };
+  _impl_.reply_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.reply_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+ReplyMessage::~ReplyMessage() {
+  // @@protoc_insertion_point(destructor:dsnet.nopaxos.proto.ReplyMessage)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void ReplyMessage::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.reply_.Destroy();
+}
+
+void ReplyMessage::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void ReplyMessage::Clear() {
+// @@protoc_insertion_point(message_clear_start:dsnet.nopaxos.proto.ReplyMessage)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    _impl_.reply_.ClearNonDefaultToEmpty();
+  }
+  if (cached_has_bits & 0x0000003eu) {
+    ::memset(&_impl_.view_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.replicaidx_) -
+        reinterpret_cast<char*>(&_impl_.view_)) + sizeof(_impl_.replicaidx_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* ReplyMessage::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required uint64 view = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_view(&has_bits);
+          _impl_.view_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required uint64 sessnum = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _Internal::set_has_sessnum(&has_bits);
+          _impl_.sessnum_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required uint64 opnum = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _Internal::set_has_opnum(&has_bits);
+          _impl_.opnum_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required uint64 clientreqid = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _Internal::set_has_clientreqid(&has_bits);
+          _impl_.clientreqid_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required uint32 replicaidx = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          _Internal::set_has_replicaidx(&has_bits);
+          _impl_.replicaidx_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional bytes reply = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 50)) {
+          auto str = _internal_mutable_reply();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* ReplyMessage::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:dsnet.nopaxos.proto.ReplyMessage)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required uint64 view = 1;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(1, this->_internal_view(), target);
+  }
+
+  // required uint64 sessnum = 2;
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(2, this->_internal_sessnum(), target);
+  }
+
+  // required uint64 opnum = 3;
+  if (cached_has_bits & 0x00000008u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(3, this->_internal_opnum(), target);
+  }
+
+  // required uint64 clientreqid = 4;
+  if (cached_has_bits & 0x00000010u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(4, this->_internal_clientreqid(), target);
+  }
+
+  // required uint32 replicaidx = 5;
+  if (cached_has_bits & 0x00000020u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(5, this->_internal_replicaidx(), target);
+  }
+
+  // optional bytes reply = 6;
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->WriteBytesMaybeAliased(
+        6, this->_internal_reply(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:dsnet.nopaxos.proto.ReplyMessage)
+  return target;
+}
+
+size_t ReplyMessage::RequiredFieldsByteSizeFallback() const {
+// @@protoc_insertion_point(required_fields_byte_size_fallback_start:dsnet.nopaxos.proto.ReplyMessage)
+  size_t total_size = 0;
+
+  if (_internal_has_view()) {
+    // required uint64 view = 1;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_view());
+  }
+
+  if (_internal_has_sessnum()) {
+    // required uint64 sessnum = 2;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_sessnum());
+  }
+
+  if (_internal_has_opnum()) {
+    // required uint64 opnum = 3;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_opnum());
+  }
+
+  if (_internal_has_clientreqid()) {
+    // required uint64 clientreqid = 4;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_clientreqid());
+  }
+
+  if (_internal_has_replicaidx()) {
+    // required uint32 replicaidx = 5;
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_replicaidx());
+  }
+
+  return total_size;
+}
+size_t ReplyMessage::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:dsnet.nopaxos.proto.ReplyMessage)
+  size_t total_size = 0;
+
+  if (((_impl_._has_bits_[0] & 0x0000003e) ^ 0x0000003e) == 0) {  // All required fields are present.
+    // required uint64 view = 1;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_view());
+
+    // required uint64 sessnum = 2;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_sessnum());
+
+    // required uint64 opnum = 3;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_opnum());
+
+    // required uint64 clientreqid = 4;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_clientreqid());
+
+    // required uint32 replicaidx = 5;
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_replicaidx());
+
+  } else {
+    total_size += RequiredFieldsByteSizeFallback();
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // optional bytes reply = 6;
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_reply());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ReplyMessage::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    ReplyMessage::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ReplyMessage::GetClassData() const { return &_class_data_; }
+
+
+void ReplyMessage::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<ReplyMessage*>(&to_msg);
+  auto& from = static_cast<const ReplyMessage&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:dsnet.nopaxos.proto.ReplyMessage)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000003fu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_reply(from._internal_reply());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.view_ = from._impl_.view_;
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.sessnum_ = from._impl_.sessnum_;
+    }
+    if (cached_has_bits & 0x00000008u) {
+      _this->_impl_.opnum_ = from._impl_.opnum_;
+    }
+    if (cached_has_bits & 0x00000010u) {
+      _this->_impl_.clientreqid_ = from._impl_.clientreqid_;
+    }
+    if (cached_has_bits & 0x00000020u) {
+      _this->_impl_.replicaidx_ = from._impl_.replicaidx_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void ReplyMessage::CopyFrom(const ReplyMessage& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:dsnet.nopaxos.proto.ReplyMessage)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool ReplyMessage::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  return true;
+}
+
+void ReplyMessage::InternalSwap(ReplyMessage* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.reply_, lhs_arena,
+      &other->_impl_.reply_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(ReplyMessage, _impl_.replicaidx_)
+      + sizeof(ReplyMessage::_impl_.replicaidx_)
+      - PROTOBUF_FIELD_OFFSET(ReplyMessage, _impl_.view_)>(
+          reinterpret_cast<char*>(&_impl_.view_),
+          reinterpret_cast<char*>(&other->_impl_.view_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata ReplyMessage::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_replication_2fnopaxos_2fnopaxos_2dproto_2eproto_getter, &descriptor_table_replication_2fnopaxos_2fnopaxos_2dproto_2eproto_once,
+      file_level_metadata_replication_2fnopaxos_2fnopaxos_2dproto_2eproto[0]);
+}
+
+// ===================================================================
+
+class UnloggedReplyMessage::_Internal {
+ public:
+  using HasBits = decltype(std::declval<UnloggedReplyMessage>()._impl_._has_bits_);
+  static void set_has_reply(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000001) ^ 0x00000001) != 0;
+  }
+};
+
+UnloggedReplyMessage::UnloggedReplyMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:dsnet.nopaxos.proto.UnloggedReplyMessage)
+}
+UnloggedReplyMessage::UnloggedReplyMessage(const UnloggedReplyMessage& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  UnloggedReplyMessage* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.reply_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.reply_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.reply_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_reply()) {
+    _this->_impl_.reply_.Set(from._internal_reply(), 
+      _this->GetArenaForAllocation());
+  }
+  // @@protoc_insertion_point(copy_constructor:dsnet.nopaxos.proto.UnloggedReplyMessage)
+}
+
+inline void UnloggedReplyMessage::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.reply_){}
+  };
+  _impl_.reply_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.reply_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+UnloggedReplyMessage::~UnloggedReplyMessage() {
+  // @@protoc_insertion_point(destructor:dsnet.nopaxos.proto.UnloggedReplyMessage)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void UnloggedReplyMessage::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.reply_.Destroy();
+}
+
+void UnloggedReplyMessage::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void UnloggedReplyMessage::Clear() {
+// @@protoc_insertion_point(message_clear_start:dsnet.nopaxos.proto.UnloggedReplyMessage)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    _impl_.reply_.ClearNonDefaultToEmpty();
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* UnloggedReplyMessage::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required bytes reply = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_reply();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* UnloggedReplyMessage::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:dsnet.nopaxos.proto.UnloggedReplyMessage)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required bytes reply = 1;
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->WriteBytesMaybeAliased(
+        1, this->_internal_reply(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:dsnet.nopaxos.proto.UnloggedReplyMessage)
+  return target;
+}
+
+size_t UnloggedReplyMessage::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:dsnet.nopaxos.proto.UnloggedReplyMessage)
+  size_t total_size = 0;
+
+  // required bytes reply = 1;
+  if (_internal_has_reply()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_reply());
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData UnloggedReplyMessage::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    UnloggedReplyMessage::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*UnloggedReplyMessage::GetClassData() const { return &_class_data_; }
+
+
+void UnloggedReplyMessage::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<UnloggedReplyMessage*>(&to_msg);
+  auto& from = static_cast<const UnloggedReplyMessage&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:dsnet.nopaxos.proto.UnloggedReplyMessage)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_has_reply()) {
+    _this->_internal_set_reply(from._internal_reply());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void UnloggedReplyMessage::CopyFrom(const UnloggedReplyMessage& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:dsnet.nopaxos.proto.UnloggedReplyMessage)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool UnloggedReplyMessage::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  return true;
+}
+
+void UnloggedReplyMessage::InternalSwap(UnloggedReplyMessage* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.reply_, lhs_arena,
+      &other->_impl_.reply_, rhs_arena
+  );
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata UnloggedReplyMessage::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_replication_2fnopaxos_2fnopaxos_2dproto_2eproto_getter, &descriptor_table_replication_2fnopaxos_2fnopaxos_2dproto_2eproto_once,
+      file_level_metadata_replication_2fnopaxos_2fnopaxos_2dproto_2eproto[1]);
+}
+
+// ===================================================================
+
+class ToClientMessage::_Internal {
+ public:
+  static const ::dsnet::nopaxos::proto::ReplyMessage& reply(const ToClientMessage* msg);
+  static const ::dsnet::nopaxos::proto::UnloggedReplyMessage& unlogged_reply(const ToClientMessage* msg);
+};
+
+const ::dsnet::nopaxos::proto::ReplyMessage&
+ToClientMessage::_Internal::reply(const ToClientMessage* msg) {
+  return *msg->_impl_.msg_.reply_;
+}
+const ::dsnet::nopaxos::proto::UnloggedReplyMessage&
+ToClientMessage::_Internal::unlogged_reply(const ToClientMessage* msg) {
+  return *msg->_impl_.msg_.unlogged_reply_;
+}
+void ToClientMessage::set_allocated_reply(::dsnet::nopaxos::proto::ReplyMessage* reply) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  clear_msg();
+  if (reply) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(reply);
+    if (message_arena != submessage_arena) {
+      reply = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, reply, submessage_arena);
+    }
+    set_has_reply();
+    _impl_.msg_.reply_ = reply;
+  }
+  // @@protoc_insertion_point(field_set_allocated:dsnet.nopaxos.proto.ToClientMessage.reply)
+}
+void ToClientMessage::set_allocated_unlogged_reply(::dsnet::nopaxos::proto::UnloggedReplyMessage* unlogged_reply) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  clear_msg();
+  if (unlogged_reply) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(unlogged_reply);
+    if (message_arena != submessage_arena) {
+      unlogged_reply = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, unlogged_reply, submessage_arena);
+    }
+    set_has_unlogged_reply();
+    _impl_.msg_.unlogged_reply_ = unlogged_reply;
+  }
+  // @@protoc_insertion_point(field_set_allocated:dsnet.nopaxos.proto.ToClientMessage.unlogged_reply)
+}
+ToClientMessage::ToClientMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:dsnet.nopaxos.proto.ToClientMessage)
+}
+ToClientMessage::ToClientMessage(const ToClientMessage& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  ToClientMessage* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.msg_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , /*decltype(_impl_._oneof_case_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  clear_has_msg();
+  switch (from.msg_case()) {
+    case kReply: {
+      _this->_internal_mutable_reply()->::dsnet::nopaxos::proto::ReplyMessage::MergeFrom(
+          from._internal_reply());
+      break;
+    }
+    case kUnloggedReply: {
+      _this->_internal_mutable_unlogged_reply()->::dsnet::nopaxos::proto::UnloggedReplyMessage::MergeFrom(
+          from._internal_unlogged_reply());
+      break;
+    }
+    case MSG_NOT_SET: {
+      break;
+    }
+  }
+  // @@protoc_insertion_point(copy_constructor:dsnet.nopaxos.proto.ToClientMessage)
+}
+
+inline void ToClientMessage::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.msg_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , /*decltype(_impl_._oneof_case_)*/{}
+  };
+  clear_has_msg();
+}
+
+ToClientMessage::~ToClientMessage() {
+  // @@protoc_insertion_point(destructor:dsnet.nopaxos.proto.ToClientMessage)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void ToClientMessage::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  if (has_msg()) {
+    clear_msg();
+  }
+}
+
+void ToClientMessage::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void ToClientMessage::clear_msg() {
+// @@protoc_insertion_point(one_of_clear_start:dsnet.nopaxos.proto.ToClientMessage)
+  switch (msg_case()) {
+    case kReply: {
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.msg_.reply_;
+      }
+      break;
+    }
+    case kUnloggedReply: {
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.msg_.unlogged_reply_;
+      }
+      break;
+    }
+    case MSG_NOT_SET: {
+      break;
+    }
+  }
+  _impl_._oneof_case_[0] = MSG_NOT_SET;
+}
+
+
+void ToClientMessage::Clear() {
+// @@protoc_insertion_point(message_clear_start:dsnet.nopaxos.proto.ToClientMessage)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  clear_msg();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* ToClientMessage::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // .dsnet.nopaxos.proto.ReplyMessage reply = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr = ctx->ParseMessage(_internal_mutable_reply(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .dsnet.nopaxos.proto.UnloggedReplyMessage unlogged_reply = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr = ctx->ParseMessage(_internal_mutable_unlogged_reply(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* ToClientMessage::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:dsnet.nopaxos.proto.ToClientMessage)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  switch (msg_case()) {
+    case kReply: {
+      target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(1, _Internal::reply(this),
+          _Internal::reply(this).GetCachedSize(), target, stream);
+      break;
+    }
+    case kUnloggedReply: {
+      target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(2, _Internal::unlogged_reply(this),
+          _Internal::unlogged_reply(this).GetCachedSize(), target, stream);
+      break;
+    }
+    default: ;
+  }
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:dsnet.nopaxos.proto.ToClientMessage)
+  return target;
+}
+
+size_t ToClientMessage::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:dsnet.nopaxos.proto.ToClientMessage)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  switch (msg_case()) {
+    // .dsnet.nopaxos.proto.ReplyMessage reply = 1;
+    case kReply: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.msg_.reply_);
+      break;
+    }
+    // .dsnet.nopaxos.proto.UnloggedReplyMessage unlogged_reply = 2;
+    case kUnloggedReply: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.msg_.unlogged_reply_);
+      break;
+    }
+    case MSG_NOT_SET: {
+      break;
+    }
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ToClientMessage::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    ToClientMessage::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ToClientMessage::GetClassData() const { return &_class_data_; }
+
+
+void ToClientMessage::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<ToClientMessage*>(&to_msg);
+  auto& from = static_cast<const ToClientMessage&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:dsnet.nopaxos.proto.ToClientMessage)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  switch (from.msg_case()) {
+    case kReply: {
+      _this->_internal_mutable_reply()->::dsnet::nopaxos::proto::ReplyMessage::MergeFrom(
+          from._internal_reply());
+      break;
+    }
+    case kUnloggedReply: {
+      _this->_internal_mutable_unlogged_reply()->::dsnet::nopaxos::proto::UnloggedReplyMessage::MergeFrom(
+          from._internal_unlogged_reply());
+      break;
+    }
+    case MSG_NOT_SET: {
+      break;
+    }
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void ToClientMessage::CopyFrom(const ToClientMessage& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:dsnet.nopaxos.proto.ToClientMessage)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool ToClientMessage::IsInitialized() const {
+  switch (msg_case()) {
+    case kReply: {
+      if (_internal_has_reply()) {
+        if (!_impl_.msg_.reply_->IsInitialized()) return false;
+      }
+      break;
+    }
+    case kUnloggedReply: {
+      if (_internal_has_unlogged_reply()) {
+        if (!_impl_.msg_.unlogged_reply_->IsInitialized()) return false;
+      }
+      break;
+    }
+    case MSG_NOT_SET: {
+      break;
+    }
+  }
+  return true;
+}
+
+void ToClientMessage::InternalSwap(ToClientMessage* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_.msg_, other->_impl_.msg_);
+  swap(_impl_._oneof_case_[0], other->_impl_._oneof_case_[0]);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata ToClientMessage::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_replication_2fnopaxos_2fnopaxos_2dproto_2eproto_getter, &descriptor_table_replication_2fnopaxos_2fnopaxos_2dproto_2eproto_once,
+      file_level_metadata_replication_2fnopaxos_2fnopaxos_2dproto_2eproto[2]);
+}
+
+// ===================================================================
+
+class RequestMessage::_Internal {
+ public:
+  using HasBits = decltype(std::declval<RequestMessage>()._impl_._has_bits_);
+  static void set_has_sessnum(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_msgnum(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static const ::dsnet::Request& req(const RequestMessage* msg);
+  static void set_has_req(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000007) ^ 0x00000007) != 0;
+  }
+};
+
+const ::dsnet::Request&
+RequestMessage::_Internal::req(const RequestMessage* msg) {
+  return *msg->_impl_.req_;
+}
+void RequestMessage::clear_req() {
+  if (_impl_.req_ != nullptr) _impl_.req_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+RequestMessage::RequestMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:dsnet.nopaxos.proto.RequestMessage)
+}
+RequestMessage::RequestMessage(const RequestMessage& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  RequestMessage* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.req_){nullptr}
+    , decltype(_impl_.sessnum_){}
+    , decltype(_impl_.msgnum_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  if (from._internal_has_req()) {
+    _this->_impl_.req_ = new ::dsnet::Request(*from._impl_.req_);
+  }
+  ::memcpy(&_impl_.sessnum_, &from._impl_.sessnum_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.msgnum_) -
+    reinterpret_cast<char*>(&_impl_.sessnum_)) + sizeof(_impl_.msgnum_));
+  // @@protoc_insertion_point(copy_constructor:dsnet.nopaxos.proto.RequestMessage)
+}
+
+inline void RequestMessage::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.req_){nullptr}
+    , decltype(_impl_.sessnum_){uint64_t{0u}}
+    , decltype(_impl_.msgnum_){uint64_t{0u}}
+  };
+}
+
+RequestMessage::~RequestMessage() {
+  // @@protoc_insertion_point(destructor:dsnet.nopaxos.proto.RequestMessage)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void RequestMessage::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  if (this != internal_default_instance()) delete _impl_.req_;
+}
+
+void RequestMessage::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void RequestMessage::Clear() {
+// @@protoc_insertion_point(message_clear_start:dsnet.nopaxos.proto.RequestMessage)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    GOOGLE_DCHECK(_impl_.req_ != nullptr);
+    _impl_.req_->Clear();
+  }
+  if (cached_has_bits & 0x00000006u) {
+    ::memset(&_impl_.sessnum_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.msgnum_) -
+        reinterpret_cast<char*>(&_impl_.sessnum_)) + sizeof(_impl_.msgnum_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* RequestMessage::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required uint64 sessnum = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_sessnum(&has_bits);
+          _impl_.sessnum_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required uint64 msgnum = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _Internal::set_has_msgnum(&has_bits);
+          _impl_.msgnum_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required .dsnet.Request req = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          ptr = ctx->ParseMessage(_internal_mutable_req(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* RequestMessage::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:dsnet.nopaxos.proto.RequestMessage)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required uint64 sessnum = 1;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(1, this->_internal_sessnum(), target);
+  }
+
+  // required uint64 msgnum = 2;
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(2, this->_internal_msgnum(), target);
+  }
+
+  // required .dsnet.Request req = 3;
+  if (cached_has_bits & 0x00000001u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(3, _Internal::req(this),
+        _Internal::req(this).GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:dsnet.nopaxos.proto.RequestMessage)
+  return target;
+}
+
+size_t RequestMessage::RequiredFieldsByteSizeFallback() const {
+// @@protoc_insertion_point(required_fields_byte_size_fallback_start:dsnet.nopaxos.proto.RequestMessage)
+  size_t total_size = 0;
+
+  if (_internal_has_req()) {
+    // required .dsnet.Request req = 3;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.req_);
+  }
+
+  if (_internal_has_sessnum()) {
+    // required uint64 sessnum = 1;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_sessnum());
+  }
+
+  if (_internal_has_msgnum()) {
+    // required uint64 msgnum = 2;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_msgnum());
+  }
+
+  return total_size;
+}
+size_t RequestMessage::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:dsnet.nopaxos.proto.RequestMessage)
+  size_t total_size = 0;
+
+  if (((_impl_._has_bits_[0] & 0x00000007) ^ 0x00000007) == 0) {  // All required fields are present.
+    // required .dsnet.Request req = 3;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.req_);
+
+    // required uint64 sessnum = 1;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_sessnum());
+
+    // required uint64 msgnum = 2;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_msgnum());
+
+  } else {
+    total_size += RequiredFieldsByteSizeFallback();
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData RequestMessage::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    RequestMessage::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*RequestMessage::GetClassData() const { return &_class_data_; }
+
+
+void RequestMessage::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<RequestMessage*>(&to_msg);
+  auto& from = static_cast<const RequestMessage&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:dsnet.nopaxos.proto.RequestMessage)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_mutable_req()->::dsnet::Request::MergeFrom(
+          from._internal_req());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.sessnum_ = from._impl_.sessnum_;
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.msgnum_ = from._impl_.msgnum_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void RequestMessage::CopyFrom(const RequestMessage& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:dsnet.nopaxos.proto.RequestMessage)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool RequestMessage::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  if (_internal_has_req()) {
+    if (!_impl_.req_->IsInitialized()) return false;
+  }
+  return true;
+}
+
+void RequestMessage::InternalSwap(RequestMessage* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(RequestMessage, _impl_.msgnum_)
+      + sizeof(RequestMessage::_impl_.msgnum_)
+      - PROTOBUF_FIELD_OFFSET(RequestMessage, _impl_.req_)>(
+          reinterpret_cast<char*>(&_impl_.req_),
+          reinterpret_cast<char*>(&other->_impl_.req_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata RequestMessage::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_replication_2fnopaxos_2fnopaxos_2dproto_2eproto_getter, &descriptor_table_replication_2fnopaxos_2fnopaxos_2dproto_2eproto_once,
+      file_level_metadata_replication_2fnopaxos_2fnopaxos_2dproto_2eproto[3]);
+}
+
+// ===================================================================
+
+class UnloggedRequestMessage::_Internal {
+ public:
+  using HasBits = decltype(std::declval<UnloggedRequestMessage>()._impl_._has_bits_);
+  static const ::dsnet::UnloggedRequest& req(const UnloggedRequestMessage* msg);
+  static void set_has_req(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000001) ^ 0x00000001) != 0;
+  }
+};
+
+const ::dsnet::UnloggedRequest&
+UnloggedRequestMessage::_Internal::req(const UnloggedRequestMessage* msg) {
+  return *msg->_impl_.req_;
+}
+void UnloggedRequestMessage::clear_req() {
+  if (_impl_.req_ != nullptr) _impl_.req_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+UnloggedRequestMessage::UnloggedRequestMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:dsnet.nopaxos.proto.UnloggedRequestMessage)
+}
+UnloggedRequestMessage::UnloggedRequestMessage(const UnloggedRequestMessage& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  UnloggedRequestMessage* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.req_){nullptr}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  if (from._internal_has_req()) {
+    _this->_impl_.req_ = new ::dsnet::UnloggedRequest(*from._impl_.req_);
+  }
+  // @@protoc_insertion_point(copy_constructor:dsnet.nopaxos.proto.UnloggedRequestMessage)
+}
+
+inline void UnloggedRequestMessage::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.req_){nullptr}
+  };
+}
+
+UnloggedRequestMessage::~UnloggedRequestMessage() {
+  // @@protoc_insertion_point(destructor:dsnet.nopaxos.proto.UnloggedRequestMessage)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void UnloggedRequestMessage::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  if (this != internal_default_instance()) delete _impl_.req_;
+}
+
+void UnloggedRequestMessage::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void UnloggedRequestMessage::Clear() {
+// @@protoc_insertion_point(message_clear_start:dsnet.nopaxos.proto.UnloggedRequestMessage)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    GOOGLE_DCHECK(_impl_.req_ != nullptr);
+    _impl_.req_->Clear();
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* UnloggedRequestMessage::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required .dsnet.UnloggedRequest req = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr = ctx->ParseMessage(_internal_mutable_req(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* UnloggedRequestMessage::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:dsnet.nopaxos.proto.UnloggedRequestMessage)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required .dsnet.UnloggedRequest req = 1;
+  if (cached_has_bits & 0x00000001u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(1, _Internal::req(this),
+        _Internal::req(this).GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:dsnet.nopaxos.proto.UnloggedRequestMessage)
+  return target;
+}
+
+size_t UnloggedRequestMessage::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:dsnet.nopaxos.proto.UnloggedRequestMessage)
+  size_t total_size = 0;
+
+  // required .dsnet.UnloggedRequest req = 1;
+  if (_internal_has_req()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.req_);
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData UnloggedRequestMessage::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    UnloggedRequestMessage::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*UnloggedRequestMessage::GetClassData() const { return &_class_data_; }
+
+
+void UnloggedRequestMessage::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<UnloggedRequestMessage*>(&to_msg);
+  auto& from = static_cast<const UnloggedRequestMessage&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:dsnet.nopaxos.proto.UnloggedRequestMessage)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_has_req()) {
+    _this->_internal_mutable_req()->::dsnet::UnloggedRequest::MergeFrom(
+        from._internal_req());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void UnloggedRequestMessage::CopyFrom(const UnloggedRequestMessage& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:dsnet.nopaxos.proto.UnloggedRequestMessage)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool UnloggedRequestMessage::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  if (_internal_has_req()) {
+    if (!_impl_.req_->IsInitialized()) return false;
+  }
+  return true;
+}
+
+void UnloggedRequestMessage::InternalSwap(UnloggedRequestMessage* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  swap(_impl_.req_, other->_impl_.req_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata UnloggedRequestMessage::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_replication_2fnopaxos_2fnopaxos_2dproto_2eproto_getter, &descriptor_table_replication_2fnopaxos_2fnopaxos_2dproto_2eproto_once,
+      file_level_metadata_replication_2fnopaxos_2fnopaxos_2dproto_2eproto[4]);
+}
+
+// ===================================================================
+
+class GapRequestMessage::_Internal {
+ public:
+  using HasBits = decltype(std::declval<GapRequestMessage>()._impl_._has_bits_);
+  static void set_has_view(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_sessnum(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_opnum(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000007) ^ 0x00000007) != 0;
+  }
+};
+
+GapRequestMessage::GapRequestMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:dsnet.nopaxos.proto.GapRequestMessage)
+}
+GapRequestMessage::GapRequestMessage(const GapRequestMessage& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  GapRequestMessage* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.view_){}
+    , decltype(_impl_.sessnum_){}
+    , decltype(_impl_.opnum_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.view_, &from._impl_.view_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.opnum_) -
+    reinterpret_cast<char*>(&_impl_.view_)) + sizeof(_impl_.opnum_));
+  // @@protoc_insertion_point(copy_constructor:dsnet.nopaxos.proto.GapRequestMessage)
+}
+
+inline void GapRequestMessage::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.view_){uint64_t{0u}}
+    , decltype(_impl_.sessnum_){uint64_t{0u}}
+    , decltype(_impl_.opnum_){uint64_t{0u}}
+  };
+}
+
+GapRequestMessage::~GapRequestMessage() {
+  // @@protoc_insertion_point(destructor:dsnet.nopaxos.proto.GapRequestMessage)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void GapRequestMessage::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void GapRequestMessage::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void GapRequestMessage::Clear() {
+// @@protoc_insertion_point(message_clear_start:dsnet.nopaxos.proto.GapRequestMessage)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    ::memset(&_impl_.view_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.opnum_) -
+        reinterpret_cast<char*>(&_impl_.view_)) + sizeof(_impl_.opnum_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* GapRequestMessage::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required uint64 view = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_view(&has_bits);
+          _impl_.view_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required uint64 sessnum = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _Internal::set_has_sessnum(&has_bits);
+          _impl_.sessnum_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required uint64 opnum = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _Internal::set_has_opnum(&has_bits);
+          _impl_.opnum_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* GapRequestMessage::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:dsnet.nopaxos.proto.GapRequestMessage)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required uint64 view = 1;
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(1, this->_internal_view(), target);
+  }
+
+  // required uint64 sessnum = 2;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(2, this->_internal_sessnum(), target);
+  }
+
+  // required uint64 opnum = 3;
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(3, this->_internal_opnum(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:dsnet.nopaxos.proto.GapRequestMessage)
+  return target;
+}
+
+size_t GapRequestMessage::RequiredFieldsByteSizeFallback() const {
+// @@protoc_insertion_point(required_fields_byte_size_fallback_start:dsnet.nopaxos.proto.GapRequestMessage)
+  size_t total_size = 0;
+
+  if (_internal_has_view()) {
+    // required uint64 view = 1;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_view());
+  }
+
+  if (_internal_has_sessnum()) {
+    // required uint64 sessnum = 2;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_sessnum());
+  }
+
+  if (_internal_has_opnum()) {
+    // required uint64 opnum = 3;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_opnum());
+  }
+
+  return total_size;
+}
+size_t GapRequestMessage::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:dsnet.nopaxos.proto.GapRequestMessage)
+  size_t total_size = 0;
+
+  if (((_impl_._has_bits_[0] & 0x00000007) ^ 0x00000007) == 0) {  // All required fields are present.
+    // required uint64 view = 1;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_view());
+
+    // required uint64 sessnum = 2;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_sessnum());
+
+    // required uint64 opnum = 3;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_opnum());
+
+  } else {
+    total_size += RequiredFieldsByteSizeFallback();
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData GapRequestMessage::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    GapRequestMessage::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GapRequestMessage::GetClassData() const { return &_class_data_; }
+
+
+void GapRequestMessage::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<GapRequestMessage*>(&to_msg);
+  auto& from = static_cast<const GapRequestMessage&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:dsnet.nopaxos.proto.GapRequestMessage)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_impl_.view_ = from._impl_.view_;
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.sessnum_ = from._impl_.sessnum_;
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.opnum_ = from._impl_.opnum_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void GapRequestMessage::CopyFrom(const GapRequestMessage& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:dsnet.nopaxos.proto.GapRequestMessage)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool GapRequestMessage::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  return true;
+}
+
+void GapRequestMessage::InternalSwap(GapRequestMessage* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(GapRequestMessage, _impl_.opnum_)
+      + sizeof(GapRequestMessage::_impl_.opnum_)
+      - PROTOBUF_FIELD_OFFSET(GapRequestMessage, _impl_.view_)>(
+          reinterpret_cast<char*>(&_impl_.view_),
+          reinterpret_cast<char*>(&other->_impl_.view_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata GapRequestMessage::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_replication_2fnopaxos_2fnopaxos_2dproto_2eproto_getter, &descriptor_table_replication_2fnopaxos_2fnopaxos_2dproto_2eproto_once,
+      file_level_metadata_replication_2fnopaxos_2fnopaxos_2dproto_2eproto[5]);
+}
+
+// ===================================================================
+
+class GapReplyMessage::_Internal {
+ public:
+  using HasBits = decltype(std::declval<GapReplyMessage>()._impl_._has_bits_);
+  static void set_has_view(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_sessnum(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static void set_has_opnum(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+  static void set_has_isfound(HasBits* has_bits) {
+    (*has_bits)[0] |= 16u;
+  }
+  static void set_has_isgap(HasBits* has_bits) {
+    (*has_bits)[0] |= 32u;
+  }
+  static void set_has_replicaidx(HasBits* has_bits) {
+    (*has_bits)[0] |= 64u;
+  }
+  static const ::dsnet::Request& req(const GapReplyMessage* msg);
+  static void set_has_req(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x0000007e) ^ 0x0000007e) != 0;
+  }
+};
+
+const ::dsnet::Request&
+GapReplyMessage::_Internal::req(const GapReplyMessage* msg) {
+  return *msg->_impl_.req_;
+}
+void GapReplyMessage::clear_req() {
+  if (_impl_.req_ != nullptr) _impl_.req_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+GapReplyMessage::GapReplyMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:dsnet.nopaxos.proto.GapReplyMessage)
+}
+GapReplyMessage::GapReplyMessage(const GapReplyMessage& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  GapReplyMessage* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.req_){nullptr}
+    , decltype(_impl_.view_){}
+    , decltype(_impl_.sessnum_){}
+    , decltype(_impl_.opnum_){}
+    , decltype(_impl_.isfound_){}
+    , decltype(_impl_.isgap_){}
+    , decltype(_impl_.replicaidx_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  if (from._internal_has_req()) {
+    _this->_impl_.req_ = new ::dsnet::Request(*from._impl_.req_);
+  }
+  ::memcpy(&_impl_.view_, &from._impl_.view_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.replicaidx_) -
+    reinterpret_cast<char*>(&_impl_.view_)) + sizeof(_impl_.replicaidx_));
+  // @@protoc_insertion_point(copy_constructor:dsnet.nopaxos.proto.GapReplyMessage)
+}
+
+inline void GapReplyMessage::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.req_){nullptr}
+    , decltype(_impl_.view_){uint64_t{0u}}
+    , decltype(_impl_.sessnum_){uint64_t{0u}}
+    , decltype(_impl_.opnum_){uint64_t{0u}}
+    , decltype(_impl_.isfound_){false}
+    , decltype(_impl_.isgap_){false}
+    , decltype(_impl_.replicaidx_){0u}
+  };
+}
+
+GapReplyMessage::~GapReplyMessage() {
+  // @@protoc_insertion_point(destructor:dsnet.nopaxos.proto.GapReplyMessage)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void GapReplyMessage::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  if (this != internal_default_instance()) delete _impl_.req_;
+}
+
+void GapReplyMessage::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void GapReplyMessage::Clear() {
+// @@protoc_insertion_point(message_clear_start:dsnet.nopaxos.proto.GapReplyMessage)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    GOOGLE_DCHECK(_impl_.req_ != nullptr);
+    _impl_.req_->Clear();
+  }
+  if (cached_has_bits & 0x0000007eu) {
+    ::memset(&_impl_.view_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.replicaidx_) -
+        reinterpret_cast<char*>(&_impl_.view_)) + sizeof(_impl_.replicaidx_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* GapReplyMessage::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required uint64 view = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_view(&has_bits);
+          _impl_.view_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required uint64 sessnum = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _Internal::set_has_sessnum(&has_bits);
+          _impl_.sessnum_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required uint64 opnum = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _Internal::set_has_opnum(&has_bits);
+          _impl_.opnum_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required bool isfound = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _Internal::set_has_isfound(&has_bits);
+          _impl_.isfound_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required bool isgap = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          _Internal::set_has_isgap(&has_bits);
+          _impl_.isgap_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required uint32 replicaidx = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 48)) {
+          _Internal::set_has_replicaidx(&has_bits);
+          _impl_.replicaidx_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .dsnet.Request req = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 58)) {
+          ptr = ctx->ParseMessage(_internal_mutable_req(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* GapReplyMessage::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:dsnet.nopaxos.proto.GapReplyMessage)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required uint64 view = 1;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(1, this->_internal_view(), target);
+  }
+
+  // required uint64 sessnum = 2;
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(2, this->_internal_sessnum(), target);
+  }
+
+  // required uint64 opnum = 3;
+  if (cached_has_bits & 0x00000008u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(3, this->_internal_opnum(), target);
+  }
+
+  // required bool isfound = 4;
+  if (cached_has_bits & 0x00000010u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(4, this->_internal_isfound(), target);
+  }
+
+  // required bool isgap = 5;
+  if (cached_has_bits & 0x00000020u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(5, this->_internal_isgap(), target);
+  }
+
+  // required uint32 replicaidx = 6;
+  if (cached_has_bits & 0x00000040u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(6, this->_internal_replicaidx(), target);
+  }
+
+  // optional .dsnet.Request req = 7;
+  if (cached_has_bits & 0x00000001u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(7, _Internal::req(this),
+        _Internal::req(this).GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:dsnet.nopaxos.proto.GapReplyMessage)
+  return target;
+}
+
+size_t GapReplyMessage::RequiredFieldsByteSizeFallback() const {
+// @@protoc_insertion_point(required_fields_byte_size_fallback_start:dsnet.nopaxos.proto.GapReplyMessage)
+  size_t total_size = 0;
+
+  if (_internal_has_view()) {
+    // required uint64 view = 1;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_view());
+  }
+
+  if (_internal_has_sessnum()) {
+    // required uint64 sessnum = 2;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_sessnum());
+  }
+
+  if (_internal_has_opnum()) {
+    // required uint64 opnum = 3;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_opnum());
+  }
+
+  if (_internal_has_isfound()) {
+    // required bool isfound = 4;
+    total_size += 1 + 1;
+  }
+
+  if (_internal_has_isgap()) {
+    // required bool isgap = 5;
+    total_size += 1 + 1;
+  }
+
+  if (_internal_has_replicaidx()) {
+    // required uint32 replicaidx = 6;
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_replicaidx());
+  }
+
+  return total_size;
+}
+size_t GapReplyMessage::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:dsnet.nopaxos.proto.GapReplyMessage)
+  size_t total_size = 0;
+
+  if (((_impl_._has_bits_[0] & 0x0000007e) ^ 0x0000007e) == 0) {  // All required fields are present.
+    // required uint64 view = 1;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_view());
+
+    // required uint64 sessnum = 2;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_sessnum());
+
+    // required uint64 opnum = 3;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_opnum());
+
+    // required bool isfound = 4;
+    total_size += 1 + 1;
+
+    // required bool isgap = 5;
+    total_size += 1 + 1;
+
+    // required uint32 replicaidx = 6;
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_replicaidx());
+
+  } else {
+    total_size += RequiredFieldsByteSizeFallback();
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // optional .dsnet.Request req = 7;
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.req_);
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData GapReplyMessage::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    GapReplyMessage::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GapReplyMessage::GetClassData() const { return &_class_data_; }
+
+
+void GapReplyMessage::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<GapReplyMessage*>(&to_msg);
+  auto& from = static_cast<const GapReplyMessage&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:dsnet.nopaxos.proto.GapReplyMessage)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000007fu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_mutable_req()->::dsnet::Request::MergeFrom(
+          from._internal_req());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.view_ = from._impl_.view_;
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.sessnum_ = from._impl_.sessnum_;
+    }
+    if (cached_has_bits & 0x00000008u) {
+      _this->_impl_.opnum_ = from._impl_.opnum_;
+    }
+    if (cached_has_bits & 0x00000010u) {
+      _this->_impl_.isfound_ = from._impl_.isfound_;
+    }
+    if (cached_has_bits & 0x00000020u) {
+      _this->_impl_.isgap_ = from._impl_.isgap_;
+    }
+    if (cached_has_bits & 0x00000040u) {
+      _this->_impl_.replicaidx_ = from._impl_.replicaidx_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void GapReplyMessage::CopyFrom(const GapReplyMessage& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:dsnet.nopaxos.proto.GapReplyMessage)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool GapReplyMessage::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  if (_internal_has_req()) {
+    if (!_impl_.req_->IsInitialized()) return false;
+  }
+  return true;
+}
+
+void GapReplyMessage::InternalSwap(GapReplyMessage* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(GapReplyMessage, _impl_.replicaidx_)
+      + sizeof(GapReplyMessage::_impl_.replicaidx_)
+      - PROTOBUF_FIELD_OFFSET(GapReplyMessage, _impl_.req_)>(
+          reinterpret_cast<char*>(&_impl_.req_),
+          reinterpret_cast<char*>(&other->_impl_.req_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata GapReplyMessage::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_replication_2fnopaxos_2fnopaxos_2dproto_2eproto_getter, &descriptor_table_replication_2fnopaxos_2fnopaxos_2dproto_2eproto_once,
+      file_level_metadata_replication_2fnopaxos_2fnopaxos_2dproto_2eproto[6]);
+}
+
+// ===================================================================
+
+class StateTransferRequestMessage::_Internal {
+ public:
+  using HasBits = decltype(std::declval<StateTransferRequestMessage>()._impl_._has_bits_);
+  static void set_has_sessnum(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_view(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_begin(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static void set_has_end(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x0000000f) ^ 0x0000000f) != 0;
+  }
+};
+
+StateTransferRequestMessage::StateTransferRequestMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:dsnet.nopaxos.proto.StateTransferRequestMessage)
+}
+StateTransferRequestMessage::StateTransferRequestMessage(const StateTransferRequestMessage& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  StateTransferRequestMessage* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.sessnum_){}
+    , decltype(_impl_.view_){}
+    , decltype(_impl_.begin_){}
+    , decltype(_impl_.end_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.sessnum_, &from._impl_.sessnum_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.end_) -
+    reinterpret_cast<char*>(&_impl_.sessnum_)) + sizeof(_impl_.end_));
+  // @@protoc_insertion_point(copy_constructor:dsnet.nopaxos.proto.StateTransferRequestMessage)
+}
+
+inline void StateTransferRequestMessage::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.sessnum_){uint64_t{0u}}
+    , decltype(_impl_.view_){uint64_t{0u}}
+    , decltype(_impl_.begin_){uint64_t{0u}}
+    , decltype(_impl_.end_){uint64_t{0u}}
+  };
+}
+
+StateTransferRequestMessage::~StateTransferRequestMessage() {
+  // @@protoc_insertion_point(destructor:dsnet.nopaxos.proto.StateTransferRequestMessage)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void StateTransferRequestMessage::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void StateTransferRequestMessage::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void StateTransferRequestMessage::Clear() {
+// @@protoc_insertion_point(message_clear_start:dsnet.nopaxos.proto.StateTransferRequestMessage)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000000fu) {
+    ::memset(&_impl_.sessnum_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.end_) -
+        reinterpret_cast<char*>(&_impl_.sessnum_)) + sizeof(_impl_.end_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* StateTransferRequestMessage::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required uint64 sessnum = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_sessnum(&has_bits);
+          _impl_.sessnum_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required uint64 view = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _Internal::set_has_view(&has_bits);
+          _impl_.view_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required uint64 begin = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _Internal::set_has_begin(&has_bits);
+          _impl_.begin_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required uint64 end = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _Internal::set_has_end(&has_bits);
+          _impl_.end_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* StateTransferRequestMessage::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:dsnet.nopaxos.proto.StateTransferRequestMessage)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required uint64 sessnum = 1;
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(1, this->_internal_sessnum(), target);
+  }
+
+  // required uint64 view = 2;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(2, this->_internal_view(), target);
+  }
+
+  // required uint64 begin = 3;
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(3, this->_internal_begin(), target);
+  }
+
+  // required uint64 end = 4;
+  if (cached_has_bits & 0x00000008u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(4, this->_internal_end(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:dsnet.nopaxos.proto.StateTransferRequestMessage)
+  return target;
+}
+
+size_t StateTransferRequestMessage::RequiredFieldsByteSizeFallback() const {
+// @@protoc_insertion_point(required_fields_byte_size_fallback_start:dsnet.nopaxos.proto.StateTransferRequestMessage)
+  size_t total_size = 0;
+
+  if (_internal_has_sessnum()) {
+    // required uint64 sessnum = 1;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_sessnum());
+  }
+
+  if (_internal_has_view()) {
+    // required uint64 view = 2;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_view());
+  }
+
+  if (_internal_has_begin()) {
+    // required uint64 begin = 3;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_begin());
+  }
+
+  if (_internal_has_end()) {
+    // required uint64 end = 4;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_end());
+  }
+
+  return total_size;
+}
+size_t StateTransferRequestMessage::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:dsnet.nopaxos.proto.StateTransferRequestMessage)
+  size_t total_size = 0;
+
+  if (((_impl_._has_bits_[0] & 0x0000000f) ^ 0x0000000f) == 0) {  // All required fields are present.
+    // required uint64 sessnum = 1;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_sessnum());
+
+    // required uint64 view = 2;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_view());
+
+    // required uint64 begin = 3;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_begin());
+
+    // required uint64 end = 4;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_end());
+
+  } else {
+    total_size += RequiredFieldsByteSizeFallback();
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData StateTransferRequestMessage::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    StateTransferRequestMessage::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*StateTransferRequestMessage::GetClassData() const { return &_class_data_; }
+
+
+void StateTransferRequestMessage::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<StateTransferRequestMessage*>(&to_msg);
+  auto& from = static_cast<const StateTransferRequestMessage&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:dsnet.nopaxos.proto.StateTransferRequestMessage)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000000fu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_impl_.sessnum_ = from._impl_.sessnum_;
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.view_ = from._impl_.view_;
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.begin_ = from._impl_.begin_;
+    }
+    if (cached_has_bits & 0x00000008u) {
+      _this->_impl_.end_ = from._impl_.end_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void StateTransferRequestMessage::CopyFrom(const StateTransferRequestMessage& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:dsnet.nopaxos.proto.StateTransferRequestMessage)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool StateTransferRequestMessage::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  return true;
+}
+
+void StateTransferRequestMessage::InternalSwap(StateTransferRequestMessage* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(StateTransferRequestMessage, _impl_.end_)
+      + sizeof(StateTransferRequestMessage::_impl_.end_)
+      - PROTOBUF_FIELD_OFFSET(StateTransferRequestMessage, _impl_.sessnum_)>(
+          reinterpret_cast<char*>(&_impl_.sessnum_),
+          reinterpret_cast<char*>(&other->_impl_.sessnum_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata StateTransferRequestMessage::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_replication_2fnopaxos_2fnopaxos_2dproto_2eproto_getter, &descriptor_table_replication_2fnopaxos_2fnopaxos_2dproto_2eproto_once,
+      file_level_metadata_replication_2fnopaxos_2fnopaxos_2dproto_2eproto[7]);
+}
+
+// ===================================================================
+
+class StateTransferReplyMessage::_Internal {
+ public:
+  using HasBits = decltype(std::declval<StateTransferReplyMessage>()._impl_._has_bits_);
+  static void set_has_sessnum(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_view(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_begin(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static void set_has_end(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x0000000f) ^ 0x0000000f) != 0;
+  }
+};
+
+void StateTransferReplyMessage::clear_entries() {
+  _impl_.entries_.Clear();
+}
+StateTransferReplyMessage::StateTransferReplyMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:dsnet.nopaxos.proto.StateTransferReplyMessage)
+}
+StateTransferReplyMessage::StateTransferReplyMessage(const StateTransferReplyMessage& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  StateTransferReplyMessage* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.entries_){from._impl_.entries_}
+    , decltype(_impl_.sessnum_){}
+    , decltype(_impl_.view_){}
+    , decltype(_impl_.begin_){}
+    , decltype(_impl_.end_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.sessnum_, &from._impl_.sessnum_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.end_) -
+    reinterpret_cast<char*>(&_impl_.sessnum_)) + sizeof(_impl_.end_));
+  // @@protoc_insertion_point(copy_constructor:dsnet.nopaxos.proto.StateTransferReplyMessage)
+}
+
+inline void StateTransferReplyMessage::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.entries_){arena}
+    , decltype(_impl_.sessnum_){uint64_t{0u}}
+    , decltype(_impl_.view_){uint64_t{0u}}
+    , decltype(_impl_.begin_){uint64_t{0u}}
+    , decltype(_impl_.end_){uint64_t{0u}}
+  };
+}
+
+StateTransferReplyMessage::~StateTransferReplyMessage() {
+  // @@protoc_insertion_point(destructor:dsnet.nopaxos.proto.StateTransferReplyMessage)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void StateTransferReplyMessage::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.entries_.~RepeatedPtrField();
+}
+
+void StateTransferReplyMessage::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void StateTransferReplyMessage::Clear() {
+// @@protoc_insertion_point(message_clear_start:dsnet.nopaxos.proto.StateTransferReplyMessage)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.entries_.Clear();
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000000fu) {
+    ::memset(&_impl_.sessnum_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.end_) -
+        reinterpret_cast<char*>(&_impl_.sessnum_)) + sizeof(_impl_.end_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* StateTransferReplyMessage::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required uint64 sessnum = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_sessnum(&has_bits);
+          _impl_.sessnum_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required uint64 view = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _Internal::set_has_view(&has_bits);
+          _impl_.view_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required uint64 begin = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _Internal::set_has_begin(&has_bits);
+          _impl_.begin_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required uint64 end = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _Internal::set_has_end(&has_bits);
+          _impl_.end_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .dsnet.MsgLogEntry entries = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 42)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_entries(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<42>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* StateTransferReplyMessage::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:dsnet.nopaxos.proto.StateTransferReplyMessage)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required uint64 sessnum = 1;
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(1, this->_internal_sessnum(), target);
+  }
+
+  // required uint64 view = 2;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(2, this->_internal_view(), target);
+  }
+
+  // required uint64 begin = 3;
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(3, this->_internal_begin(), target);
+  }
+
+  // required uint64 end = 4;
+  if (cached_has_bits & 0x00000008u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(4, this->_internal_end(), target);
+  }
+
+  // repeated .dsnet.MsgLogEntry entries = 5;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_entries_size()); i < n; i++) {
+    const auto& repfield = this->_internal_entries(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(5, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:dsnet.nopaxos.proto.StateTransferReplyMessage)
+  return target;
+}
+
+size_t StateTransferReplyMessage::RequiredFieldsByteSizeFallback() const {
+// @@protoc_insertion_point(required_fields_byte_size_fallback_start:dsnet.nopaxos.proto.StateTransferReplyMessage)
+  size_t total_size = 0;
+
+  if (_internal_has_sessnum()) {
+    // required uint64 sessnum = 1;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_sessnum());
+  }
+
+  if (_internal_has_view()) {
+    // required uint64 view = 2;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_view());
+  }
+
+  if (_internal_has_begin()) {
+    // required uint64 begin = 3;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_begin());
+  }
+
+  if (_internal_has_end()) {
+    // required uint64 end = 4;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_end());
+  }
+
+  return total_size;
+}
+size_t StateTransferReplyMessage::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:dsnet.nopaxos.proto.StateTransferReplyMessage)
+  size_t total_size = 0;
+
+  if (((_impl_._has_bits_[0] & 0x0000000f) ^ 0x0000000f) == 0) {  // All required fields are present.
+    // required uint64 sessnum = 1;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_sessnum());
+
+    // required uint64 view = 2;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_view());
+
+    // required uint64 begin = 3;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_begin());
+
+    // required uint64 end = 4;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_end());
+
+  } else {
+    total_size += RequiredFieldsByteSizeFallback();
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .dsnet.MsgLogEntry entries = 5;
+  total_size += 1UL * this->_internal_entries_size();
+  for (const auto& msg : this->_impl_.entries_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData StateTransferReplyMessage::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    StateTransferReplyMessage::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*StateTransferReplyMessage::GetClassData() const { return &_class_data_; }
+
+
+void StateTransferReplyMessage::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<StateTransferReplyMessage*>(&to_msg);
+  auto& from = static_cast<const StateTransferReplyMessage&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:dsnet.nopaxos.proto.StateTransferReplyMessage)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.entries_.MergeFrom(from._impl_.entries_);
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000000fu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_impl_.sessnum_ = from._impl_.sessnum_;
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.view_ = from._impl_.view_;
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.begin_ = from._impl_.begin_;
+    }
+    if (cached_has_bits & 0x00000008u) {
+      _this->_impl_.end_ = from._impl_.end_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void StateTransferReplyMessage::CopyFrom(const StateTransferReplyMessage& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:dsnet.nopaxos.proto.StateTransferReplyMessage)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool StateTransferReplyMessage::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  if (!::PROTOBUF_NAMESPACE_ID::internal::AllAreInitialized(_impl_.entries_))
+    return false;
+  return true;
+}
+
+void StateTransferReplyMessage::InternalSwap(StateTransferReplyMessage* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  _impl_.entries_.InternalSwap(&other->_impl_.entries_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(StateTransferReplyMessage, _impl_.end_)
+      + sizeof(StateTransferReplyMessage::_impl_.end_)
+      - PROTOBUF_FIELD_OFFSET(StateTransferReplyMessage, _impl_.sessnum_)>(
+          reinterpret_cast<char*>(&_impl_.sessnum_),
+          reinterpret_cast<char*>(&other->_impl_.sessnum_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata StateTransferReplyMessage::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_replication_2fnopaxos_2fnopaxos_2dproto_2eproto_getter, &descriptor_table_replication_2fnopaxos_2fnopaxos_2dproto_2eproto_once,
+      file_level_metadata_replication_2fnopaxos_2fnopaxos_2dproto_2eproto[8]);
+}
+
+// ===================================================================
+
+class GapCommitMessage::_Internal {
+ public:
+  using HasBits = decltype(std::declval<GapCommitMessage>()._impl_._has_bits_);
+  static void set_has_sessnum(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_view(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_opnum(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000007) ^ 0x00000007) != 0;
+  }
+};
+
+GapCommitMessage::GapCommitMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:dsnet.nopaxos.proto.GapCommitMessage)
+}
+GapCommitMessage::GapCommitMessage(const GapCommitMessage& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  GapCommitMessage* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.sessnum_){}
+    , decltype(_impl_.view_){}
+    , decltype(_impl_.opnum_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.sessnum_, &from._impl_.sessnum_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.opnum_) -
+    reinterpret_cast<char*>(&_impl_.sessnum_)) + sizeof(_impl_.opnum_));
+  // @@protoc_insertion_point(copy_constructor:dsnet.nopaxos.proto.GapCommitMessage)
+}
+
+inline void GapCommitMessage::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.sessnum_){uint64_t{0u}}
+    , decltype(_impl_.view_){uint64_t{0u}}
+    , decltype(_impl_.opnum_){uint64_t{0u}}
+  };
+}
+
+GapCommitMessage::~GapCommitMessage() {
+  // @@protoc_insertion_point(destructor:dsnet.nopaxos.proto.GapCommitMessage)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void GapCommitMessage::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void GapCommitMessage::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void GapCommitMessage::Clear() {
+// @@protoc_insertion_point(message_clear_start:dsnet.nopaxos.proto.GapCommitMessage)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    ::memset(&_impl_.sessnum_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.opnum_) -
+        reinterpret_cast<char*>(&_impl_.sessnum_)) + sizeof(_impl_.opnum_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* GapCommitMessage::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required uint64 sessnum = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_sessnum(&has_bits);
+          _impl_.sessnum_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required uint64 view = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _Internal::set_has_view(&has_bits);
+          _impl_.view_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required uint64 opnum = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _Internal::set_has_opnum(&has_bits);
+          _impl_.opnum_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* GapCommitMessage::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:dsnet.nopaxos.proto.GapCommitMessage)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required uint64 sessnum = 1;
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(1, this->_internal_sessnum(), target);
+  }
+
+  // required uint64 view = 2;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(2, this->_internal_view(), target);
+  }
+
+  // required uint64 opnum = 3;
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(3, this->_internal_opnum(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:dsnet.nopaxos.proto.GapCommitMessage)
+  return target;
+}
+
+size_t GapCommitMessage::RequiredFieldsByteSizeFallback() const {
+// @@protoc_insertion_point(required_fields_byte_size_fallback_start:dsnet.nopaxos.proto.GapCommitMessage)
+  size_t total_size = 0;
+
+  if (_internal_has_sessnum()) {
+    // required uint64 sessnum = 1;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_sessnum());
+  }
+
+  if (_internal_has_view()) {
+    // required uint64 view = 2;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_view());
+  }
+
+  if (_internal_has_opnum()) {
+    // required uint64 opnum = 3;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_opnum());
+  }
+
+  return total_size;
+}
+size_t GapCommitMessage::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:dsnet.nopaxos.proto.GapCommitMessage)
+  size_t total_size = 0;
+
+  if (((_impl_._has_bits_[0] & 0x00000007) ^ 0x00000007) == 0) {  // All required fields are present.
+    // required uint64 sessnum = 1;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_sessnum());
+
+    // required uint64 view = 2;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_view());
+
+    // required uint64 opnum = 3;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_opnum());
+
+  } else {
+    total_size += RequiredFieldsByteSizeFallback();
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData GapCommitMessage::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    GapCommitMessage::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GapCommitMessage::GetClassData() const { return &_class_data_; }
+
+
+void GapCommitMessage::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<GapCommitMessage*>(&to_msg);
+  auto& from = static_cast<const GapCommitMessage&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:dsnet.nopaxos.proto.GapCommitMessage)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_impl_.sessnum_ = from._impl_.sessnum_;
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.view_ = from._impl_.view_;
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.opnum_ = from._impl_.opnum_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void GapCommitMessage::CopyFrom(const GapCommitMessage& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:dsnet.nopaxos.proto.GapCommitMessage)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool GapCommitMessage::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  return true;
+}
+
+void GapCommitMessage::InternalSwap(GapCommitMessage* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(GapCommitMessage, _impl_.opnum_)
+      + sizeof(GapCommitMessage::_impl_.opnum_)
+      - PROTOBUF_FIELD_OFFSET(GapCommitMessage, _impl_.sessnum_)>(
+          reinterpret_cast<char*>(&_impl_.sessnum_),
+          reinterpret_cast<char*>(&other->_impl_.sessnum_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata GapCommitMessage::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_replication_2fnopaxos_2fnopaxos_2dproto_2eproto_getter, &descriptor_table_replication_2fnopaxos_2fnopaxos_2dproto_2eproto_once,
+      file_level_metadata_replication_2fnopaxos_2fnopaxos_2dproto_2eproto[9]);
+}
+
+// ===================================================================
+
+class GapCommitReplyMessage::_Internal {
+ public:
+  using HasBits = decltype(std::declval<GapCommitReplyMessage>()._impl_._has_bits_);
+  static void set_has_sessnum(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_view(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_opnum(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static void set_has_replicaidx(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x0000000f) ^ 0x0000000f) != 0;
+  }
+};
+
+GapCommitReplyMessage::GapCommitReplyMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:dsnet.nopaxos.proto.GapCommitReplyMessage)
+}
+GapCommitReplyMessage::GapCommitReplyMessage(const GapCommitReplyMessage& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  GapCommitReplyMessage* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.sessnum_){}
+    , decltype(_impl_.view_){}
+    , decltype(_impl_.opnum_){}
+    , decltype(_impl_.replicaidx_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.sessnum_, &from._impl_.sessnum_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.replicaidx_) -
+    reinterpret_cast<char*>(&_impl_.sessnum_)) + sizeof(_impl_.replicaidx_));
+  // @@protoc_insertion_point(copy_constructor:dsnet.nopaxos.proto.GapCommitReplyMessage)
+}
+
+inline void GapCommitReplyMessage::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.sessnum_){uint64_t{0u}}
+    , decltype(_impl_.view_){uint64_t{0u}}
+    , decltype(_impl_.opnum_){uint64_t{0u}}
+    , decltype(_impl_.replicaidx_){0u}
+  };
+}
+
+GapCommitReplyMessage::~GapCommitReplyMessage() {
+  // @@protoc_insertion_point(destructor:dsnet.nopaxos.proto.GapCommitReplyMessage)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void GapCommitReplyMessage::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void GapCommitReplyMessage::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void GapCommitReplyMessage::Clear() {
+// @@protoc_insertion_point(message_clear_start:dsnet.nopaxos.proto.GapCommitReplyMessage)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000000fu) {
+    ::memset(&_impl_.sessnum_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.replicaidx_) -
+        reinterpret_cast<char*>(&_impl_.sessnum_)) + sizeof(_impl_.replicaidx_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* GapCommitReplyMessage::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required uint64 sessnum = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_sessnum(&has_bits);
+          _impl_.sessnum_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required uint64 view = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _Internal::set_has_view(&has_bits);
+          _impl_.view_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required uint64 opnum = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _Internal::set_has_opnum(&has_bits);
+          _impl_.opnum_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required uint32 replicaidx = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _Internal::set_has_replicaidx(&has_bits);
+          _impl_.replicaidx_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* GapCommitReplyMessage::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:dsnet.nopaxos.proto.GapCommitReplyMessage)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required uint64 sessnum = 1;
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(1, this->_internal_sessnum(), target);
+  }
+
+  // required uint64 view = 2;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(2, this->_internal_view(), target);
+  }
+
+  // required uint64 opnum = 3;
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(3, this->_internal_opnum(), target);
+  }
+
+  // required uint32 replicaidx = 4;
+  if (cached_has_bits & 0x00000008u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(4, this->_internal_replicaidx(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:dsnet.nopaxos.proto.GapCommitReplyMessage)
+  return target;
+}
+
+size_t GapCommitReplyMessage::RequiredFieldsByteSizeFallback() const {
+// @@protoc_insertion_point(required_fields_byte_size_fallback_start:dsnet.nopaxos.proto.GapCommitReplyMessage)
+  size_t total_size = 0;
+
+  if (_internal_has_sessnum()) {
+    // required uint64 sessnum = 1;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_sessnum());
+  }
+
+  if (_internal_has_view()) {
+    // required uint64 view = 2;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_view());
+  }
+
+  if (_internal_has_opnum()) {
+    // required uint64 opnum = 3;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_opnum());
+  }
+
+  if (_internal_has_replicaidx()) {
+    // required uint32 replicaidx = 4;
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_replicaidx());
+  }
+
+  return total_size;
+}
+size_t GapCommitReplyMessage::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:dsnet.nopaxos.proto.GapCommitReplyMessage)
+  size_t total_size = 0;
+
+  if (((_impl_._has_bits_[0] & 0x0000000f) ^ 0x0000000f) == 0) {  // All required fields are present.
+    // required uint64 sessnum = 1;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_sessnum());
+
+    // required uint64 view = 2;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_view());
+
+    // required uint64 opnum = 3;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_opnum());
+
+    // required uint32 replicaidx = 4;
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_replicaidx());
+
+  } else {
+    total_size += RequiredFieldsByteSizeFallback();
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData GapCommitReplyMessage::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    GapCommitReplyMessage::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GapCommitReplyMessage::GetClassData() const { return &_class_data_; }
+
+
+void GapCommitReplyMessage::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<GapCommitReplyMessage*>(&to_msg);
+  auto& from = static_cast<const GapCommitReplyMessage&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:dsnet.nopaxos.proto.GapCommitReplyMessage)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000000fu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_impl_.sessnum_ = from._impl_.sessnum_;
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.view_ = from._impl_.view_;
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.opnum_ = from._impl_.opnum_;
+    }
+    if (cached_has_bits & 0x00000008u) {
+      _this->_impl_.replicaidx_ = from._impl_.replicaidx_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void GapCommitReplyMessage::CopyFrom(const GapCommitReplyMessage& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:dsnet.nopaxos.proto.GapCommitReplyMessage)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool GapCommitReplyMessage::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  return true;
+}
+
+void GapCommitReplyMessage::InternalSwap(GapCommitReplyMessage* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(GapCommitReplyMessage, _impl_.replicaidx_)
+      + sizeof(GapCommitReplyMessage::_impl_.replicaidx_)
+      - PROTOBUF_FIELD_OFFSET(GapCommitReplyMessage, _impl_.sessnum_)>(
+          reinterpret_cast<char*>(&_impl_.sessnum_),
+          reinterpret_cast<char*>(&other->_impl_.sessnum_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata GapCommitReplyMessage::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_replication_2fnopaxos_2fnopaxos_2dproto_2eproto_getter, &descriptor_table_replication_2fnopaxos_2fnopaxos_2dproto_2eproto_once,
+      file_level_metadata_replication_2fnopaxos_2fnopaxos_2dproto_2eproto[10]);
+}
+
+// ===================================================================
+
+class ViewChangeRequestMessage::_Internal {
+ public:
+  using HasBits = decltype(std::declval<ViewChangeRequestMessage>()._impl_._has_bits_);
+  static void set_has_sessnum(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_view(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000003) ^ 0x00000003) != 0;
+  }
+};
+
+ViewChangeRequestMessage::ViewChangeRequestMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:dsnet.nopaxos.proto.ViewChangeRequestMessage)
+}
+ViewChangeRequestMessage::ViewChangeRequestMessage(const ViewChangeRequestMessage& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  ViewChangeRequestMessage* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.sessnum_){}
+    , decltype(_impl_.view_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.sessnum_, &from._impl_.sessnum_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.view_) -
+    reinterpret_cast<char*>(&_impl_.sessnum_)) + sizeof(_impl_.view_));
+  // @@protoc_insertion_point(copy_constructor:dsnet.nopaxos.proto.ViewChangeRequestMessage)
+}
+
+inline void ViewChangeRequestMessage::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.sessnum_){uint64_t{0u}}
+    , decltype(_impl_.view_){uint64_t{0u}}
+  };
+}
+
+ViewChangeRequestMessage::~ViewChangeRequestMessage() {
+  // @@protoc_insertion_point(destructor:dsnet.nopaxos.proto.ViewChangeRequestMessage)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void ViewChangeRequestMessage::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void ViewChangeRequestMessage::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void ViewChangeRequestMessage::Clear() {
+// @@protoc_insertion_point(message_clear_start:dsnet.nopaxos.proto.ViewChangeRequestMessage)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    ::memset(&_impl_.sessnum_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.view_) -
+        reinterpret_cast<char*>(&_impl_.sessnum_)) + sizeof(_impl_.view_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* ViewChangeRequestMessage::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required uint64 sessnum = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_sessnum(&has_bits);
+          _impl_.sessnum_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required uint64 view = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _Internal::set_has_view(&has_bits);
+          _impl_.view_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* ViewChangeRequestMessage::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:dsnet.nopaxos.proto.ViewChangeRequestMessage)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required uint64 sessnum = 1;
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(1, this->_internal_sessnum(), target);
+  }
+
+  // required uint64 view = 2;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(2, this->_internal_view(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:dsnet.nopaxos.proto.ViewChangeRequestMessage)
+  return target;
+}
+
+size_t ViewChangeRequestMessage::RequiredFieldsByteSizeFallback() const {
+// @@protoc_insertion_point(required_fields_byte_size_fallback_start:dsnet.nopaxos.proto.ViewChangeRequestMessage)
+  size_t total_size = 0;
+
+  if (_internal_has_sessnum()) {
+    // required uint64 sessnum = 1;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_sessnum());
+  }
+
+  if (_internal_has_view()) {
+    // required uint64 view = 2;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_view());
+  }
+
+  return total_size;
+}
+size_t ViewChangeRequestMessage::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:dsnet.nopaxos.proto.ViewChangeRequestMessage)
+  size_t total_size = 0;
+
+  if (((_impl_._has_bits_[0] & 0x00000003) ^ 0x00000003) == 0) {  // All required fields are present.
+    // required uint64 sessnum = 1;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_sessnum());
+
+    // required uint64 view = 2;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_view());
+
+  } else {
+    total_size += RequiredFieldsByteSizeFallback();
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ViewChangeRequestMessage::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    ViewChangeRequestMessage::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ViewChangeRequestMessage::GetClassData() const { return &_class_data_; }
+
+
+void ViewChangeRequestMessage::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<ViewChangeRequestMessage*>(&to_msg);
+  auto& from = static_cast<const ViewChangeRequestMessage&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:dsnet.nopaxos.proto.ViewChangeRequestMessage)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_impl_.sessnum_ = from._impl_.sessnum_;
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.view_ = from._impl_.view_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void ViewChangeRequestMessage::CopyFrom(const ViewChangeRequestMessage& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:dsnet.nopaxos.proto.ViewChangeRequestMessage)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool ViewChangeRequestMessage::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  return true;
+}
+
+void ViewChangeRequestMessage::InternalSwap(ViewChangeRequestMessage* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(ViewChangeRequestMessage, _impl_.view_)
+      + sizeof(ViewChangeRequestMessage::_impl_.view_)
+      - PROTOBUF_FIELD_OFFSET(ViewChangeRequestMessage, _impl_.sessnum_)>(
+          reinterpret_cast<char*>(&_impl_.sessnum_),
+          reinterpret_cast<char*>(&other->_impl_.sessnum_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata ViewChangeRequestMessage::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_replication_2fnopaxos_2fnopaxos_2dproto_2eproto_getter, &descriptor_table_replication_2fnopaxos_2fnopaxos_2dproto_2eproto_once,
+      file_level_metadata_replication_2fnopaxos_2fnopaxos_2dproto_2eproto[11]);
+}
+
+// ===================================================================
+
+class ViewChangeMessage::_Internal {
+ public:
+  using HasBits = decltype(std::declval<ViewChangeMessage>()._impl_._has_bits_);
+  static void set_has_sessnum(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_view(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_lastnormalsessnum(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static void set_has_lastnormalview(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+  static void set_has_lastop(HasBits* has_bits) {
+    (*has_bits)[0] |= 16u;
+  }
+  static void set_has_replicaidx(HasBits* has_bits) {
+    (*has_bits)[0] |= 32u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x0000003f) ^ 0x0000003f) != 0;
+  }
+};
+
+ViewChangeMessage::ViewChangeMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:dsnet.nopaxos.proto.ViewChangeMessage)
+}
+ViewChangeMessage::ViewChangeMessage(const ViewChangeMessage& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  ViewChangeMessage* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.committedgaps_){from._impl_.committedgaps_}
+    , decltype(_impl_.sessnum_){}
+    , decltype(_impl_.view_){}
+    , decltype(_impl_.lastnormalsessnum_){}
+    , decltype(_impl_.lastnormalview_){}
+    , decltype(_impl_.lastop_){}
+    , decltype(_impl_.replicaidx_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.sessnum_, &from._impl_.sessnum_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.replicaidx_) -
+    reinterpret_cast<char*>(&_impl_.sessnum_)) + sizeof(_impl_.replicaidx_));
+  // @@protoc_insertion_point(copy_constructor:dsnet.nopaxos.proto.ViewChangeMessage)
+}
+
+inline void ViewChangeMessage::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.committedgaps_){arena}
+    , decltype(_impl_.sessnum_){uint64_t{0u}}
+    , decltype(_impl_.view_){uint64_t{0u}}
+    , decltype(_impl_.lastnormalsessnum_){uint64_t{0u}}
+    , decltype(_impl_.lastnormalview_){uint64_t{0u}}
+    , decltype(_impl_.lastop_){uint64_t{0u}}
+    , decltype(_impl_.replicaidx_){0u}
+  };
+}
+
+ViewChangeMessage::~ViewChangeMessage() {
+  // @@protoc_insertion_point(destructor:dsnet.nopaxos.proto.ViewChangeMessage)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void ViewChangeMessage::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.committedgaps_.~RepeatedField();
+}
+
+void ViewChangeMessage::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void ViewChangeMessage::Clear() {
+// @@protoc_insertion_point(message_clear_start:dsnet.nopaxos.proto.ViewChangeMessage)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.committedgaps_.Clear();
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000003fu) {
+    ::memset(&_impl_.sessnum_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.replicaidx_) -
+        reinterpret_cast<char*>(&_impl_.sessnum_)) + sizeof(_impl_.replicaidx_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* ViewChangeMessage::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required uint64 sessnum = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_sessnum(&has_bits);
+          _impl_.sessnum_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required uint64 view = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _Internal::set_has_view(&has_bits);
+          _impl_.view_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required uint64 lastnormalsessnum = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _Internal::set_has_lastnormalsessnum(&has_bits);
+          _impl_.lastnormalsessnum_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required uint64 lastnormalview = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _Internal::set_has_lastnormalview(&has_bits);
+          _impl_.lastnormalview_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required uint64 lastop = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          _Internal::set_has_lastop(&has_bits);
+          _impl_.lastop_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated uint64 committedgaps = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 48)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            _internal_add_committedgaps(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr));
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<48>(ptr));
+        } else if (static_cast<uint8_t>(tag) == 50) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedUInt64Parser(_internal_mutable_committedgaps(), ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required uint32 replicaidx = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 56)) {
+          _Internal::set_has_replicaidx(&has_bits);
+          _impl_.replicaidx_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* ViewChangeMessage::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:dsnet.nopaxos.proto.ViewChangeMessage)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required uint64 sessnum = 1;
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(1, this->_internal_sessnum(), target);
+  }
+
+  // required uint64 view = 2;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(2, this->_internal_view(), target);
+  }
+
+  // required uint64 lastnormalsessnum = 3;
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(3, this->_internal_lastnormalsessnum(), target);
+  }
+
+  // required uint64 lastnormalview = 4;
+  if (cached_has_bits & 0x00000008u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(4, this->_internal_lastnormalview(), target);
+  }
+
+  // required uint64 lastop = 5;
+  if (cached_has_bits & 0x00000010u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(5, this->_internal_lastop(), target);
+  }
+
+  // repeated uint64 committedgaps = 6;
+  for (int i = 0, n = this->_internal_committedgaps_size(); i < n; i++) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(6, this->_internal_committedgaps(i), target);
+  }
+
+  // required uint32 replicaidx = 7;
+  if (cached_has_bits & 0x00000020u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(7, this->_internal_replicaidx(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:dsnet.nopaxos.proto.ViewChangeMessage)
+  return target;
+}
+
+size_t ViewChangeMessage::RequiredFieldsByteSizeFallback() const {
+// @@protoc_insertion_point(required_fields_byte_size_fallback_start:dsnet.nopaxos.proto.ViewChangeMessage)
+  size_t total_size = 0;
+
+  if (_internal_has_sessnum()) {
+    // required uint64 sessnum = 1;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_sessnum());
+  }
+
+  if (_internal_has_view()) {
+    // required uint64 view = 2;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_view());
+  }
+
+  if (_internal_has_lastnormalsessnum()) {
+    // required uint64 lastnormalsessnum = 3;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_lastnormalsessnum());
+  }
+
+  if (_internal_has_lastnormalview()) {
+    // required uint64 lastnormalview = 4;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_lastnormalview());
+  }
+
+  if (_internal_has_lastop()) {
+    // required uint64 lastop = 5;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_lastop());
+  }
+
+  if (_internal_has_replicaidx()) {
+    // required uint32 replicaidx = 7;
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_replicaidx());
+  }
+
+  return total_size;
+}
+size_t ViewChangeMessage::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:dsnet.nopaxos.proto.ViewChangeMessage)
+  size_t total_size = 0;
+
+  if (((_impl_._has_bits_[0] & 0x0000003f) ^ 0x0000003f) == 0) {  // All required fields are present.
+    // required uint64 sessnum = 1;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_sessnum());
+
+    // required uint64 view = 2;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_view());
+
+    // required uint64 lastnormalsessnum = 3;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_lastnormalsessnum());
+
+    // required uint64 lastnormalview = 4;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_lastnormalview());
+
+    // required uint64 lastop = 5;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_lastop());
+
+    // required uint32 replicaidx = 7;
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_replicaidx());
+
+  } else {
+    total_size += RequiredFieldsByteSizeFallback();
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated uint64 committedgaps = 6;
+  {
+    size_t data_size = ::_pbi::WireFormatLite::
+      UInt64Size(this->_impl_.committedgaps_);
+    total_size += 1 *
+                  ::_pbi::FromIntSize(this->_internal_committedgaps_size());
+    total_size += data_size;
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ViewChangeMessage::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    ViewChangeMessage::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ViewChangeMessage::GetClassData() const { return &_class_data_; }
+
+
+void ViewChangeMessage::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<ViewChangeMessage*>(&to_msg);
+  auto& from = static_cast<const ViewChangeMessage&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:dsnet.nopaxos.proto.ViewChangeMessage)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.committedgaps_.MergeFrom(from._impl_.committedgaps_);
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000003fu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_impl_.sessnum_ = from._impl_.sessnum_;
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.view_ = from._impl_.view_;
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.lastnormalsessnum_ = from._impl_.lastnormalsessnum_;
+    }
+    if (cached_has_bits & 0x00000008u) {
+      _this->_impl_.lastnormalview_ = from._impl_.lastnormalview_;
+    }
+    if (cached_has_bits & 0x00000010u) {
+      _this->_impl_.lastop_ = from._impl_.lastop_;
+    }
+    if (cached_has_bits & 0x00000020u) {
+      _this->_impl_.replicaidx_ = from._impl_.replicaidx_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void ViewChangeMessage::CopyFrom(const ViewChangeMessage& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:dsnet.nopaxos.proto.ViewChangeMessage)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool ViewChangeMessage::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  return true;
+}
+
+void ViewChangeMessage::InternalSwap(ViewChangeMessage* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  _impl_.committedgaps_.InternalSwap(&other->_impl_.committedgaps_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(ViewChangeMessage, _impl_.replicaidx_)
+      + sizeof(ViewChangeMessage::_impl_.replicaidx_)
+      - PROTOBUF_FIELD_OFFSET(ViewChangeMessage, _impl_.sessnum_)>(
+          reinterpret_cast<char*>(&_impl_.sessnum_),
+          reinterpret_cast<char*>(&other->_impl_.sessnum_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata ViewChangeMessage::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_replication_2fnopaxos_2fnopaxos_2dproto_2eproto_getter, &descriptor_table_replication_2fnopaxos_2fnopaxos_2dproto_2eproto_once,
+      file_level_metadata_replication_2fnopaxos_2fnopaxos_2dproto_2eproto[12]);
+}
+
+// ===================================================================
+
+class StartViewMessage::_Internal {
+ public:
+  using HasBits = decltype(std::declval<StartViewMessage>()._impl_._has_bits_);
+  static void set_has_sessnum(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_view(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_lastnormalsessnum(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static void set_has_lastnormalview(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+  static void set_has_lastop(HasBits* has_bits) {
+    (*has_bits)[0] |= 16u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x0000001f) ^ 0x0000001f) != 0;
+  }
+};
+
+StartViewMessage::StartViewMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:dsnet.nopaxos.proto.StartViewMessage)
+}
+StartViewMessage::StartViewMessage(const StartViewMessage& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  StartViewMessage* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.committedgaps_){from._impl_.committedgaps_}
+    , decltype(_impl_.sessnum_){}
+    , decltype(_impl_.view_){}
+    , decltype(_impl_.lastnormalsessnum_){}
+    , decltype(_impl_.lastnormalview_){}
+    , decltype(_impl_.lastop_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.sessnum_, &from._impl_.sessnum_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.lastop_) -
+    reinterpret_cast<char*>(&_impl_.sessnum_)) + sizeof(_impl_.lastop_));
+  // @@protoc_insertion_point(copy_constructor:dsnet.nopaxos.proto.StartViewMessage)
+}
+
+inline void StartViewMessage::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.committedgaps_){arena}
+    , decltype(_impl_.sessnum_){uint64_t{0u}}
+    , decltype(_impl_.view_){uint64_t{0u}}
+    , decltype(_impl_.lastnormalsessnum_){uint64_t{0u}}
+    , decltype(_impl_.lastnormalview_){uint64_t{0u}}
+    , decltype(_impl_.lastop_){uint64_t{0u}}
+  };
+}
+
+StartViewMessage::~StartViewMessage() {
+  // @@protoc_insertion_point(destructor:dsnet.nopaxos.proto.StartViewMessage)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void StartViewMessage::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.committedgaps_.~RepeatedField();
+}
+
+void StartViewMessage::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void StartViewMessage::Clear() {
+// @@protoc_insertion_point(message_clear_start:dsnet.nopaxos.proto.StartViewMessage)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.committedgaps_.Clear();
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000001fu) {
+    ::memset(&_impl_.sessnum_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.lastop_) -
+        reinterpret_cast<char*>(&_impl_.sessnum_)) + sizeof(_impl_.lastop_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* StartViewMessage::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required uint64 sessnum = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_sessnum(&has_bits);
+          _impl_.sessnum_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required uint64 view = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _Internal::set_has_view(&has_bits);
+          _impl_.view_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required uint64 lastnormalsessnum = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _Internal::set_has_lastnormalsessnum(&has_bits);
+          _impl_.lastnormalsessnum_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required uint64 lastnormalview = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _Internal::set_has_lastnormalview(&has_bits);
+          _impl_.lastnormalview_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required uint64 lastop = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          _Internal::set_has_lastop(&has_bits);
+          _impl_.lastop_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated uint64 committedgaps = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 48)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            _internal_add_committedgaps(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr));
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<48>(ptr));
+        } else if (static_cast<uint8_t>(tag) == 50) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedUInt64Parser(_internal_mutable_committedgaps(), ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* StartViewMessage::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:dsnet.nopaxos.proto.StartViewMessage)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required uint64 sessnum = 1;
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(1, this->_internal_sessnum(), target);
+  }
+
+  // required uint64 view = 2;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(2, this->_internal_view(), target);
+  }
+
+  // required uint64 lastnormalsessnum = 3;
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(3, this->_internal_lastnormalsessnum(), target);
+  }
+
+  // required uint64 lastnormalview = 4;
+  if (cached_has_bits & 0x00000008u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(4, this->_internal_lastnormalview(), target);
+  }
+
+  // required uint64 lastop = 5;
+  if (cached_has_bits & 0x00000010u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(5, this->_internal_lastop(), target);
+  }
+
+  // repeated uint64 committedgaps = 6;
+  for (int i = 0, n = this->_internal_committedgaps_size(); i < n; i++) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(6, this->_internal_committedgaps(i), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:dsnet.nopaxos.proto.StartViewMessage)
+  return target;
+}
+
+size_t StartViewMessage::RequiredFieldsByteSizeFallback() const {
+// @@protoc_insertion_point(required_fields_byte_size_fallback_start:dsnet.nopaxos.proto.StartViewMessage)
+  size_t total_size = 0;
+
+  if (_internal_has_sessnum()) {
+    // required uint64 sessnum = 1;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_sessnum());
+  }
+
+  if (_internal_has_view()) {
+    // required uint64 view = 2;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_view());
+  }
+
+  if (_internal_has_lastnormalsessnum()) {
+    // required uint64 lastnormalsessnum = 3;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_lastnormalsessnum());
+  }
+
+  if (_internal_has_lastnormalview()) {
+    // required uint64 lastnormalview = 4;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_lastnormalview());
+  }
+
+  if (_internal_has_lastop()) {
+    // required uint64 lastop = 5;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_lastop());
+  }
+
+  return total_size;
+}
+size_t StartViewMessage::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:dsnet.nopaxos.proto.StartViewMessage)
+  size_t total_size = 0;
+
+  if (((_impl_._has_bits_[0] & 0x0000001f) ^ 0x0000001f) == 0) {  // All required fields are present.
+    // required uint64 sessnum = 1;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_sessnum());
+
+    // required uint64 view = 2;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_view());
+
+    // required uint64 lastnormalsessnum = 3;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_lastnormalsessnum());
+
+    // required uint64 lastnormalview = 4;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_lastnormalview());
+
+    // required uint64 lastop = 5;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_lastop());
+
+  } else {
+    total_size += RequiredFieldsByteSizeFallback();
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated uint64 committedgaps = 6;
+  {
+    size_t data_size = ::_pbi::WireFormatLite::
+      UInt64Size(this->_impl_.committedgaps_);
+    total_size += 1 *
+                  ::_pbi::FromIntSize(this->_internal_committedgaps_size());
+    total_size += data_size;
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData StartViewMessage::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    StartViewMessage::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*StartViewMessage::GetClassData() const { return &_class_data_; }
+
+
+void StartViewMessage::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<StartViewMessage*>(&to_msg);
+  auto& from = static_cast<const StartViewMessage&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:dsnet.nopaxos.proto.StartViewMessage)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.committedgaps_.MergeFrom(from._impl_.committedgaps_);
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000001fu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_impl_.sessnum_ = from._impl_.sessnum_;
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.view_ = from._impl_.view_;
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.lastnormalsessnum_ = from._impl_.lastnormalsessnum_;
+    }
+    if (cached_has_bits & 0x00000008u) {
+      _this->_impl_.lastnormalview_ = from._impl_.lastnormalview_;
+    }
+    if (cached_has_bits & 0x00000010u) {
+      _this->_impl_.lastop_ = from._impl_.lastop_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void StartViewMessage::CopyFrom(const StartViewMessage& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:dsnet.nopaxos.proto.StartViewMessage)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool StartViewMessage::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  return true;
+}
+
+void StartViewMessage::InternalSwap(StartViewMessage* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  _impl_.committedgaps_.InternalSwap(&other->_impl_.committedgaps_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(StartViewMessage, _impl_.lastop_)
+      + sizeof(StartViewMessage::_impl_.lastop_)
+      - PROTOBUF_FIELD_OFFSET(StartViewMessage, _impl_.sessnum_)>(
+          reinterpret_cast<char*>(&_impl_.sessnum_),
+          reinterpret_cast<char*>(&other->_impl_.sessnum_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata StartViewMessage::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_replication_2fnopaxos_2fnopaxos_2dproto_2eproto_getter, &descriptor_table_replication_2fnopaxos_2fnopaxos_2dproto_2eproto_once,
+      file_level_metadata_replication_2fnopaxos_2fnopaxos_2dproto_2eproto[13]);
+}
+
+// ===================================================================
+
+class StartViewReplyMessage::_Internal {
+ public:
+  using HasBits = decltype(std::declval<StartViewReplyMessage>()._impl_._has_bits_);
+  static void set_has_sessnum(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_view(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_replicaidx(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000007) ^ 0x00000007) != 0;
+  }
+};
+
+StartViewReplyMessage::StartViewReplyMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:dsnet.nopaxos.proto.StartViewReplyMessage)
+}
+StartViewReplyMessage::StartViewReplyMessage(const StartViewReplyMessage& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  StartViewReplyMessage* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.sessnum_){}
+    , decltype(_impl_.view_){}
+    , decltype(_impl_.replicaidx_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.sessnum_, &from._impl_.sessnum_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.replicaidx_) -
+    reinterpret_cast<char*>(&_impl_.sessnum_)) + sizeof(_impl_.replicaidx_));
+  // @@protoc_insertion_point(copy_constructor:dsnet.nopaxos.proto.StartViewReplyMessage)
+}
+
+inline void StartViewReplyMessage::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.sessnum_){uint64_t{0u}}
+    , decltype(_impl_.view_){uint64_t{0u}}
+    , decltype(_impl_.replicaidx_){0u}
+  };
+}
+
+StartViewReplyMessage::~StartViewReplyMessage() {
+  // @@protoc_insertion_point(destructor:dsnet.nopaxos.proto.StartViewReplyMessage)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void StartViewReplyMessage::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void StartViewReplyMessage::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void StartViewReplyMessage::Clear() {
+// @@protoc_insertion_point(message_clear_start:dsnet.nopaxos.proto.StartViewReplyMessage)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    ::memset(&_impl_.sessnum_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.replicaidx_) -
+        reinterpret_cast<char*>(&_impl_.sessnum_)) + sizeof(_impl_.replicaidx_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* StartViewReplyMessage::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required uint64 sessnum = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_sessnum(&has_bits);
+          _impl_.sessnum_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required uint64 view = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _Internal::set_has_view(&has_bits);
+          _impl_.view_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required uint32 replicaidx = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _Internal::set_has_replicaidx(&has_bits);
+          _impl_.replicaidx_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* StartViewReplyMessage::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:dsnet.nopaxos.proto.StartViewReplyMessage)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required uint64 sessnum = 1;
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(1, this->_internal_sessnum(), target);
+  }
+
+  // required uint64 view = 2;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(2, this->_internal_view(), target);
+  }
+
+  // required uint32 replicaidx = 3;
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(3, this->_internal_replicaidx(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:dsnet.nopaxos.proto.StartViewReplyMessage)
+  return target;
+}
+
+size_t StartViewReplyMessage::RequiredFieldsByteSizeFallback() const {
+// @@protoc_insertion_point(required_fields_byte_size_fallback_start:dsnet.nopaxos.proto.StartViewReplyMessage)
+  size_t total_size = 0;
+
+  if (_internal_has_sessnum()) {
+    // required uint64 sessnum = 1;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_sessnum());
+  }
+
+  if (_internal_has_view()) {
+    // required uint64 view = 2;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_view());
+  }
+
+  if (_internal_has_replicaidx()) {
+    // required uint32 replicaidx = 3;
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_replicaidx());
+  }
+
+  return total_size;
+}
+size_t StartViewReplyMessage::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:dsnet.nopaxos.proto.StartViewReplyMessage)
+  size_t total_size = 0;
+
+  if (((_impl_._has_bits_[0] & 0x00000007) ^ 0x00000007) == 0) {  // All required fields are present.
+    // required uint64 sessnum = 1;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_sessnum());
+
+    // required uint64 view = 2;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_view());
+
+    // required uint32 replicaidx = 3;
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_replicaidx());
+
+  } else {
+    total_size += RequiredFieldsByteSizeFallback();
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData StartViewReplyMessage::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    StartViewReplyMessage::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*StartViewReplyMessage::GetClassData() const { return &_class_data_; }
+
+
+void StartViewReplyMessage::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<StartViewReplyMessage*>(&to_msg);
+  auto& from = static_cast<const StartViewReplyMessage&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:dsnet.nopaxos.proto.StartViewReplyMessage)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_impl_.sessnum_ = from._impl_.sessnum_;
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.view_ = from._impl_.view_;
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.replicaidx_ = from._impl_.replicaidx_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void StartViewReplyMessage::CopyFrom(const StartViewReplyMessage& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:dsnet.nopaxos.proto.StartViewReplyMessage)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool StartViewReplyMessage::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  return true;
+}
+
+void StartViewReplyMessage::InternalSwap(StartViewReplyMessage* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(StartViewReplyMessage, _impl_.replicaidx_)
+      + sizeof(StartViewReplyMessage::_impl_.replicaidx_)
+      - PROTOBUF_FIELD_OFFSET(StartViewReplyMessage, _impl_.sessnum_)>(
+          reinterpret_cast<char*>(&_impl_.sessnum_),
+          reinterpret_cast<char*>(&other->_impl_.sessnum_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata StartViewReplyMessage::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_replication_2fnopaxos_2fnopaxos_2dproto_2eproto_getter, &descriptor_table_replication_2fnopaxos_2fnopaxos_2dproto_2eproto_once,
+      file_level_metadata_replication_2fnopaxos_2fnopaxos_2dproto_2eproto[14]);
+}
+
+// ===================================================================
+
+class SyncPrepareRequestMessage::_Internal {
+ public:
+  using HasBits = decltype(std::declval<SyncPrepareRequestMessage>()._impl_._has_bits_);
+  static void set_has_sessnum(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_view(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000003) ^ 0x00000003) != 0;
+  }
+};
+
+SyncPrepareRequestMessage::SyncPrepareRequestMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:dsnet.nopaxos.proto.SyncPrepareRequestMessage)
+}
+SyncPrepareRequestMessage::SyncPrepareRequestMessage(const SyncPrepareRequestMessage& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  SyncPrepareRequestMessage* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.sessnum_){}
+    , decltype(_impl_.view_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.sessnum_, &from._impl_.sessnum_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.view_) -
+    reinterpret_cast<char*>(&_impl_.sessnum_)) + sizeof(_impl_.view_));
+  // @@protoc_insertion_point(copy_constructor:dsnet.nopaxos.proto.SyncPrepareRequestMessage)
+}
+
+inline void SyncPrepareRequestMessage::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.sessnum_){uint64_t{0u}}
+    , decltype(_impl_.view_){uint64_t{0u}}
+  };
+}
+
+SyncPrepareRequestMessage::~SyncPrepareRequestMessage() {
+  // @@protoc_insertion_point(destructor:dsnet.nopaxos.proto.SyncPrepareRequestMessage)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void SyncPrepareRequestMessage::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void SyncPrepareRequestMessage::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void SyncPrepareRequestMessage::Clear() {
+// @@protoc_insertion_point(message_clear_start:dsnet.nopaxos.proto.SyncPrepareRequestMessage)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    ::memset(&_impl_.sessnum_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.view_) -
+        reinterpret_cast<char*>(&_impl_.sessnum_)) + sizeof(_impl_.view_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* SyncPrepareRequestMessage::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required uint64 sessnum = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_sessnum(&has_bits);
+          _impl_.sessnum_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required uint64 view = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _Internal::set_has_view(&has_bits);
+          _impl_.view_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* SyncPrepareRequestMessage::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:dsnet.nopaxos.proto.SyncPrepareRequestMessage)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required uint64 sessnum = 1;
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(1, this->_internal_sessnum(), target);
+  }
+
+  // required uint64 view = 2;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(2, this->_internal_view(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:dsnet.nopaxos.proto.SyncPrepareRequestMessage)
+  return target;
+}
+
+size_t SyncPrepareRequestMessage::RequiredFieldsByteSizeFallback() const {
+// @@protoc_insertion_point(required_fields_byte_size_fallback_start:dsnet.nopaxos.proto.SyncPrepareRequestMessage)
+  size_t total_size = 0;
+
+  if (_internal_has_sessnum()) {
+    // required uint64 sessnum = 1;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_sessnum());
+  }
+
+  if (_internal_has_view()) {
+    // required uint64 view = 2;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_view());
+  }
+
+  return total_size;
+}
+size_t SyncPrepareRequestMessage::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:dsnet.nopaxos.proto.SyncPrepareRequestMessage)
+  size_t total_size = 0;
+
+  if (((_impl_._has_bits_[0] & 0x00000003) ^ 0x00000003) == 0) {  // All required fields are present.
+    // required uint64 sessnum = 1;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_sessnum());
+
+    // required uint64 view = 2;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_view());
+
+  } else {
+    total_size += RequiredFieldsByteSizeFallback();
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData SyncPrepareRequestMessage::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    SyncPrepareRequestMessage::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*SyncPrepareRequestMessage::GetClassData() const { return &_class_data_; }
+
+
+void SyncPrepareRequestMessage::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<SyncPrepareRequestMessage*>(&to_msg);
+  auto& from = static_cast<const SyncPrepareRequestMessage&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:dsnet.nopaxos.proto.SyncPrepareRequestMessage)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_impl_.sessnum_ = from._impl_.sessnum_;
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.view_ = from._impl_.view_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void SyncPrepareRequestMessage::CopyFrom(const SyncPrepareRequestMessage& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:dsnet.nopaxos.proto.SyncPrepareRequestMessage)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool SyncPrepareRequestMessage::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  return true;
+}
+
+void SyncPrepareRequestMessage::InternalSwap(SyncPrepareRequestMessage* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(SyncPrepareRequestMessage, _impl_.view_)
+      + sizeof(SyncPrepareRequestMessage::_impl_.view_)
+      - PROTOBUF_FIELD_OFFSET(SyncPrepareRequestMessage, _impl_.sessnum_)>(
+          reinterpret_cast<char*>(&_impl_.sessnum_),
+          reinterpret_cast<char*>(&other->_impl_.sessnum_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata SyncPrepareRequestMessage::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_replication_2fnopaxos_2fnopaxos_2dproto_2eproto_getter, &descriptor_table_replication_2fnopaxos_2fnopaxos_2dproto_2eproto_once,
+      file_level_metadata_replication_2fnopaxos_2fnopaxos_2dproto_2eproto[15]);
+}
+
+// ===================================================================
+
+class SyncPrepareMessage::_Internal {
+ public:
+  using HasBits = decltype(std::declval<SyncPrepareMessage>()._impl_._has_bits_);
+  static void set_has_sessnum(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_view(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_lastop(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000007) ^ 0x00000007) != 0;
+  }
+};
+
+SyncPrepareMessage::SyncPrepareMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:dsnet.nopaxos.proto.SyncPrepareMessage)
+}
+SyncPrepareMessage::SyncPrepareMessage(const SyncPrepareMessage& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  SyncPrepareMessage* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.committedgaps_){from._impl_.committedgaps_}
+    , decltype(_impl_.sessnum_){}
+    , decltype(_impl_.view_){}
+    , decltype(_impl_.lastop_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.sessnum_, &from._impl_.sessnum_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.lastop_) -
+    reinterpret_cast<char*>(&_impl_.sessnum_)) + sizeof(_impl_.lastop_));
+  // @@protoc_insertion_point(copy_constructor:dsnet.nopaxos.proto.SyncPrepareMessage)
+}
+
+inline void SyncPrepareMessage::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.committedgaps_){arena}
+    , decltype(_impl_.sessnum_){uint64_t{0u}}
+    , decltype(_impl_.view_){uint64_t{0u}}
+    , decltype(_impl_.lastop_){uint64_t{0u}}
+  };
+}
+
+SyncPrepareMessage::~SyncPrepareMessage() {
+  // @@protoc_insertion_point(destructor:dsnet.nopaxos.proto.SyncPrepareMessage)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void SyncPrepareMessage::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.committedgaps_.~RepeatedField();
+}
+
+void SyncPrepareMessage::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void SyncPrepareMessage::Clear() {
+// @@protoc_insertion_point(message_clear_start:dsnet.nopaxos.proto.SyncPrepareMessage)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.committedgaps_.Clear();
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    ::memset(&_impl_.sessnum_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.lastop_) -
+        reinterpret_cast<char*>(&_impl_.sessnum_)) + sizeof(_impl_.lastop_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* SyncPrepareMessage::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required uint64 sessnum = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_sessnum(&has_bits);
+          _impl_.sessnum_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required uint64 view = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _Internal::set_has_view(&has_bits);
+          _impl_.view_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required uint64 lastop = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _Internal::set_has_lastop(&has_bits);
+          _impl_.lastop_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated uint64 committedgaps = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            _internal_add_committedgaps(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr));
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<32>(ptr));
+        } else if (static_cast<uint8_t>(tag) == 34) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedUInt64Parser(_internal_mutable_committedgaps(), ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* SyncPrepareMessage::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:dsnet.nopaxos.proto.SyncPrepareMessage)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required uint64 sessnum = 1;
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(1, this->_internal_sessnum(), target);
+  }
+
+  // required uint64 view = 2;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(2, this->_internal_view(), target);
+  }
+
+  // required uint64 lastop = 3;
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(3, this->_internal_lastop(), target);
+  }
+
+  // repeated uint64 committedgaps = 4;
+  for (int i = 0, n = this->_internal_committedgaps_size(); i < n; i++) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(4, this->_internal_committedgaps(i), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:dsnet.nopaxos.proto.SyncPrepareMessage)
+  return target;
+}
+
+size_t SyncPrepareMessage::RequiredFieldsByteSizeFallback() const {
+// @@protoc_insertion_point(required_fields_byte_size_fallback_start:dsnet.nopaxos.proto.SyncPrepareMessage)
+  size_t total_size = 0;
+
+  if (_internal_has_sessnum()) {
+    // required uint64 sessnum = 1;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_sessnum());
+  }
+
+  if (_internal_has_view()) {
+    // required uint64 view = 2;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_view());
+  }
+
+  if (_internal_has_lastop()) {
+    // required uint64 lastop = 3;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_lastop());
+  }
+
+  return total_size;
+}
+size_t SyncPrepareMessage::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:dsnet.nopaxos.proto.SyncPrepareMessage)
+  size_t total_size = 0;
+
+  if (((_impl_._has_bits_[0] & 0x00000007) ^ 0x00000007) == 0) {  // All required fields are present.
+    // required uint64 sessnum = 1;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_sessnum());
+
+    // required uint64 view = 2;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_view());
+
+    // required uint64 lastop = 3;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_lastop());
+
+  } else {
+    total_size += RequiredFieldsByteSizeFallback();
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated uint64 committedgaps = 4;
+  {
+    size_t data_size = ::_pbi::WireFormatLite::
+      UInt64Size(this->_impl_.committedgaps_);
+    total_size += 1 *
+                  ::_pbi::FromIntSize(this->_internal_committedgaps_size());
+    total_size += data_size;
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData SyncPrepareMessage::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    SyncPrepareMessage::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*SyncPrepareMessage::GetClassData() const { return &_class_data_; }
+
+
+void SyncPrepareMessage::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<SyncPrepareMessage*>(&to_msg);
+  auto& from = static_cast<const SyncPrepareMessage&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:dsnet.nopaxos.proto.SyncPrepareMessage)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.committedgaps_.MergeFrom(from._impl_.committedgaps_);
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_impl_.sessnum_ = from._impl_.sessnum_;
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.view_ = from._impl_.view_;
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.lastop_ = from._impl_.lastop_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void SyncPrepareMessage::CopyFrom(const SyncPrepareMessage& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:dsnet.nopaxos.proto.SyncPrepareMessage)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool SyncPrepareMessage::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  return true;
+}
+
+void SyncPrepareMessage::InternalSwap(SyncPrepareMessage* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  _impl_.committedgaps_.InternalSwap(&other->_impl_.committedgaps_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(SyncPrepareMessage, _impl_.lastop_)
+      + sizeof(SyncPrepareMessage::_impl_.lastop_)
+      - PROTOBUF_FIELD_OFFSET(SyncPrepareMessage, _impl_.sessnum_)>(
+          reinterpret_cast<char*>(&_impl_.sessnum_),
+          reinterpret_cast<char*>(&other->_impl_.sessnum_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata SyncPrepareMessage::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_replication_2fnopaxos_2fnopaxos_2dproto_2eproto_getter, &descriptor_table_replication_2fnopaxos_2fnopaxos_2dproto_2eproto_once,
+      file_level_metadata_replication_2fnopaxos_2fnopaxos_2dproto_2eproto[16]);
+}
+
+// ===================================================================
+
+class SyncPrepareReplyMessage::_Internal {
+ public:
+  using HasBits = decltype(std::declval<SyncPrepareReplyMessage>()._impl_._has_bits_);
+  static void set_has_sessnum(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_view(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_syncpoint(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static void set_has_replicaidx(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x0000000f) ^ 0x0000000f) != 0;
+  }
+};
+
+SyncPrepareReplyMessage::SyncPrepareReplyMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:dsnet.nopaxos.proto.SyncPrepareReplyMessage)
+}
+SyncPrepareReplyMessage::SyncPrepareReplyMessage(const SyncPrepareReplyMessage& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  SyncPrepareReplyMessage* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.sessnum_){}
+    , decltype(_impl_.view_){}
+    , decltype(_impl_.syncpoint_){}
+    , decltype(_impl_.replicaidx_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.sessnum_, &from._impl_.sessnum_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.replicaidx_) -
+    reinterpret_cast<char*>(&_impl_.sessnum_)) + sizeof(_impl_.replicaidx_));
+  // @@protoc_insertion_point(copy_constructor:dsnet.nopaxos.proto.SyncPrepareReplyMessage)
+}
+
+inline void SyncPrepareReplyMessage::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.sessnum_){uint64_t{0u}}
+    , decltype(_impl_.view_){uint64_t{0u}}
+    , decltype(_impl_.syncpoint_){uint64_t{0u}}
+    , decltype(_impl_.replicaidx_){0u}
+  };
+}
+
+SyncPrepareReplyMessage::~SyncPrepareReplyMessage() {
+  // @@protoc_insertion_point(destructor:dsnet.nopaxos.proto.SyncPrepareReplyMessage)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void SyncPrepareReplyMessage::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void SyncPrepareReplyMessage::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void SyncPrepareReplyMessage::Clear() {
+// @@protoc_insertion_point(message_clear_start:dsnet.nopaxos.proto.SyncPrepareReplyMessage)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000000fu) {
+    ::memset(&_impl_.sessnum_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.replicaidx_) -
+        reinterpret_cast<char*>(&_impl_.sessnum_)) + sizeof(_impl_.replicaidx_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* SyncPrepareReplyMessage::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required uint64 sessnum = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_sessnum(&has_bits);
+          _impl_.sessnum_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required uint64 view = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _Internal::set_has_view(&has_bits);
+          _impl_.view_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required uint64 syncpoint = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _Internal::set_has_syncpoint(&has_bits);
+          _impl_.syncpoint_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required uint32 replicaidx = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _Internal::set_has_replicaidx(&has_bits);
+          _impl_.replicaidx_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* SyncPrepareReplyMessage::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:dsnet.nopaxos.proto.SyncPrepareReplyMessage)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required uint64 sessnum = 1;
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(1, this->_internal_sessnum(), target);
+  }
+
+  // required uint64 view = 2;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(2, this->_internal_view(), target);
+  }
+
+  // required uint64 syncpoint = 3;
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(3, this->_internal_syncpoint(), target);
+  }
+
+  // required uint32 replicaidx = 4;
+  if (cached_has_bits & 0x00000008u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(4, this->_internal_replicaidx(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:dsnet.nopaxos.proto.SyncPrepareReplyMessage)
+  return target;
+}
+
+size_t SyncPrepareReplyMessage::RequiredFieldsByteSizeFallback() const {
+// @@protoc_insertion_point(required_fields_byte_size_fallback_start:dsnet.nopaxos.proto.SyncPrepareReplyMessage)
+  size_t total_size = 0;
+
+  if (_internal_has_sessnum()) {
+    // required uint64 sessnum = 1;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_sessnum());
+  }
+
+  if (_internal_has_view()) {
+    // required uint64 view = 2;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_view());
+  }
+
+  if (_internal_has_syncpoint()) {
+    // required uint64 syncpoint = 3;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_syncpoint());
+  }
+
+  if (_internal_has_replicaidx()) {
+    // required uint32 replicaidx = 4;
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_replicaidx());
+  }
+
+  return total_size;
+}
+size_t SyncPrepareReplyMessage::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:dsnet.nopaxos.proto.SyncPrepareReplyMessage)
+  size_t total_size = 0;
+
+  if (((_impl_._has_bits_[0] & 0x0000000f) ^ 0x0000000f) == 0) {  // All required fields are present.
+    // required uint64 sessnum = 1;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_sessnum());
+
+    // required uint64 view = 2;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_view());
+
+    // required uint64 syncpoint = 3;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_syncpoint());
+
+    // required uint32 replicaidx = 4;
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_replicaidx());
+
+  } else {
+    total_size += RequiredFieldsByteSizeFallback();
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData SyncPrepareReplyMessage::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    SyncPrepareReplyMessage::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*SyncPrepareReplyMessage::GetClassData() const { return &_class_data_; }
+
+
+void SyncPrepareReplyMessage::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<SyncPrepareReplyMessage*>(&to_msg);
+  auto& from = static_cast<const SyncPrepareReplyMessage&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:dsnet.nopaxos.proto.SyncPrepareReplyMessage)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000000fu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_impl_.sessnum_ = from._impl_.sessnum_;
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.view_ = from._impl_.view_;
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.syncpoint_ = from._impl_.syncpoint_;
+    }
+    if (cached_has_bits & 0x00000008u) {
+      _this->_impl_.replicaidx_ = from._impl_.replicaidx_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void SyncPrepareReplyMessage::CopyFrom(const SyncPrepareReplyMessage& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:dsnet.nopaxos.proto.SyncPrepareReplyMessage)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool SyncPrepareReplyMessage::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  return true;
+}
+
+void SyncPrepareReplyMessage::InternalSwap(SyncPrepareReplyMessage* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(SyncPrepareReplyMessage, _impl_.replicaidx_)
+      + sizeof(SyncPrepareReplyMessage::_impl_.replicaidx_)
+      - PROTOBUF_FIELD_OFFSET(SyncPrepareReplyMessage, _impl_.sessnum_)>(
+          reinterpret_cast<char*>(&_impl_.sessnum_),
+          reinterpret_cast<char*>(&other->_impl_.sessnum_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata SyncPrepareReplyMessage::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_replication_2fnopaxos_2fnopaxos_2dproto_2eproto_getter, &descriptor_table_replication_2fnopaxos_2fnopaxos_2dproto_2eproto_once,
+      file_level_metadata_replication_2fnopaxos_2fnopaxos_2dproto_2eproto[17]);
+}
+
+// ===================================================================
+
+class SyncCommitMessage::_Internal {
+ public:
+  using HasBits = decltype(std::declval<SyncCommitMessage>()._impl_._has_bits_);
+  static void set_has_sessnum(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_view(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_syncpoint(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000007) ^ 0x00000007) != 0;
+  }
+};
+
+SyncCommitMessage::SyncCommitMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:dsnet.nopaxos.proto.SyncCommitMessage)
+}
+SyncCommitMessage::SyncCommitMessage(const SyncCommitMessage& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  SyncCommitMessage* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.sessnum_){}
+    , decltype(_impl_.view_){}
+    , decltype(_impl_.syncpoint_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.sessnum_, &from._impl_.sessnum_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.syncpoint_) -
+    reinterpret_cast<char*>(&_impl_.sessnum_)) + sizeof(_impl_.syncpoint_));
+  // @@protoc_insertion_point(copy_constructor:dsnet.nopaxos.proto.SyncCommitMessage)
+}
+
+inline void SyncCommitMessage::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.sessnum_){uint64_t{0u}}
+    , decltype(_impl_.view_){uint64_t{0u}}
+    , decltype(_impl_.syncpoint_){uint64_t{0u}}
+  };
+}
+
+SyncCommitMessage::~SyncCommitMessage() {
+  // @@protoc_insertion_point(destructor:dsnet.nopaxos.proto.SyncCommitMessage)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void SyncCommitMessage::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void SyncCommitMessage::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void SyncCommitMessage::Clear() {
+// @@protoc_insertion_point(message_clear_start:dsnet.nopaxos.proto.SyncCommitMessage)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    ::memset(&_impl_.sessnum_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.syncpoint_) -
+        reinterpret_cast<char*>(&_impl_.sessnum_)) + sizeof(_impl_.syncpoint_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* SyncCommitMessage::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required uint64 sessnum = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_sessnum(&has_bits);
+          _impl_.sessnum_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required uint64 view = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _Internal::set_has_view(&has_bits);
+          _impl_.view_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required uint64 syncpoint = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _Internal::set_has_syncpoint(&has_bits);
+          _impl_.syncpoint_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* SyncCommitMessage::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:dsnet.nopaxos.proto.SyncCommitMessage)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required uint64 sessnum = 1;
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(1, this->_internal_sessnum(), target);
+  }
+
+  // required uint64 view = 2;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(2, this->_internal_view(), target);
+  }
+
+  // required uint64 syncpoint = 3;
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(3, this->_internal_syncpoint(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:dsnet.nopaxos.proto.SyncCommitMessage)
+  return target;
+}
+
+size_t SyncCommitMessage::RequiredFieldsByteSizeFallback() const {
+// @@protoc_insertion_point(required_fields_byte_size_fallback_start:dsnet.nopaxos.proto.SyncCommitMessage)
+  size_t total_size = 0;
+
+  if (_internal_has_sessnum()) {
+    // required uint64 sessnum = 1;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_sessnum());
+  }
+
+  if (_internal_has_view()) {
+    // required uint64 view = 2;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_view());
+  }
+
+  if (_internal_has_syncpoint()) {
+    // required uint64 syncpoint = 3;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_syncpoint());
+  }
+
+  return total_size;
+}
+size_t SyncCommitMessage::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:dsnet.nopaxos.proto.SyncCommitMessage)
+  size_t total_size = 0;
+
+  if (((_impl_._has_bits_[0] & 0x00000007) ^ 0x00000007) == 0) {  // All required fields are present.
+    // required uint64 sessnum = 1;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_sessnum());
+
+    // required uint64 view = 2;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_view());
+
+    // required uint64 syncpoint = 3;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_syncpoint());
+
+  } else {
+    total_size += RequiredFieldsByteSizeFallback();
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData SyncCommitMessage::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    SyncCommitMessage::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*SyncCommitMessage::GetClassData() const { return &_class_data_; }
+
+
+void SyncCommitMessage::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<SyncCommitMessage*>(&to_msg);
+  auto& from = static_cast<const SyncCommitMessage&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:dsnet.nopaxos.proto.SyncCommitMessage)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_impl_.sessnum_ = from._impl_.sessnum_;
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.view_ = from._impl_.view_;
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.syncpoint_ = from._impl_.syncpoint_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void SyncCommitMessage::CopyFrom(const SyncCommitMessage& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:dsnet.nopaxos.proto.SyncCommitMessage)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool SyncCommitMessage::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  return true;
+}
+
+void SyncCommitMessage::InternalSwap(SyncCommitMessage* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(SyncCommitMessage, _impl_.syncpoint_)
+      + sizeof(SyncCommitMessage::_impl_.syncpoint_)
+      - PROTOBUF_FIELD_OFFSET(SyncCommitMessage, _impl_.sessnum_)>(
+          reinterpret_cast<char*>(&_impl_.sessnum_),
+          reinterpret_cast<char*>(&other->_impl_.sessnum_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata SyncCommitMessage::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_replication_2fnopaxos_2fnopaxos_2dproto_2eproto_getter, &descriptor_table_replication_2fnopaxos_2fnopaxos_2dproto_2eproto_once,
+      file_level_metadata_replication_2fnopaxos_2fnopaxos_2dproto_2eproto[18]);
+}
+
+// ===================================================================
+
+class ToReplicaMessage::_Internal {
+ public:
+  static const ::dsnet::nopaxos::proto::RequestMessage& request(const ToReplicaMessage* msg);
+  static const ::dsnet::nopaxos::proto::UnloggedRequestMessage& unlogged_request(const ToReplicaMessage* msg);
+  static const ::dsnet::nopaxos::proto::GapRequestMessage& gap_request(const ToReplicaMessage* msg);
+  static const ::dsnet::nopaxos::proto::GapReplyMessage& gap_reply(const ToReplicaMessage* msg);
+  static const ::dsnet::nopaxos::proto::StateTransferRequestMessage& state_transfer_request(const ToReplicaMessage* msg);
+  static const ::dsnet::nopaxos::proto::StateTransferReplyMessage& state_transfer_reply(const ToReplicaMessage* msg);
+  static const ::dsnet::nopaxos::proto::GapCommitMessage& gap_commit(const ToReplicaMessage* msg);
+  static const ::dsnet::nopaxos::proto::GapCommitReplyMessage& gap_commit_reply(const ToReplicaMessage* msg);
+  static const ::dsnet::nopaxos::proto::ViewChangeRequestMessage& view_change_request(const ToReplicaMessage* msg);
+  static const ::dsnet::nopaxos::proto::ViewChangeMessage& view_change(const ToReplicaMessage* msg);
+  static const ::dsnet::nopaxos::proto::StartViewMessage& start_view(const ToReplicaMessage* msg);
+  static const ::dsnet::nopaxos::proto::StartViewReplyMessage& start_view_reply(const ToReplicaMessage* msg);
+  static const ::dsnet::nopaxos::proto::SyncPrepareRequestMessage& sync_prepare_request(const ToReplicaMessage* msg);
+  static const ::dsnet::nopaxos::proto::SyncPrepareMessage& sync_prepare(const ToReplicaMessage* msg);
+  static const ::dsnet::nopaxos::proto::SyncPrepareReplyMessage& sync_prepare_reply(const ToReplicaMessage* msg);
+  static const ::dsnet::nopaxos::proto::SyncCommitMessage& sync_commit(const ToReplicaMessage* msg);
+};
+
+const ::dsnet::nopaxos::proto::RequestMessage&
+ToReplicaMessage::_Internal::request(const ToReplicaMessage* msg) {
+  return *msg->_impl_.msg_.request_;
+}
+const ::dsnet::nopaxos::proto::UnloggedRequestMessage&
+ToReplicaMessage::_Internal::unlogged_request(const ToReplicaMessage* msg) {
+  return *msg->_impl_.msg_.unlogged_request_;
+}
+const ::dsnet::nopaxos::proto::GapRequestMessage&
+ToReplicaMessage::_Internal::gap_request(const ToReplicaMessage* msg) {
+  return *msg->_impl_.msg_.gap_request_;
+}
+const ::dsnet::nopaxos::proto::GapReplyMessage&
+ToReplicaMessage::_Internal::gap_reply(const ToReplicaMessage* msg) {
+  return *msg->_impl_.msg_.gap_reply_;
+}
+const ::dsnet::nopaxos::proto::StateTransferRequestMessage&
+ToReplicaMessage::_Internal::state_transfer_request(const ToReplicaMessage* msg) {
+  return *msg->_impl_.msg_.state_transfer_request_;
+}
+const ::dsnet::nopaxos::proto::StateTransferReplyMessage&
+ToReplicaMessage::_Internal::state_transfer_reply(const ToReplicaMessage* msg) {
+  return *msg->_impl_.msg_.state_transfer_reply_;
+}
+const ::dsnet::nopaxos::proto::GapCommitMessage&
+ToReplicaMessage::_Internal::gap_commit(const ToReplicaMessage* msg) {
+  return *msg->_impl_.msg_.gap_commit_;
+}
+const ::dsnet::nopaxos::proto::GapCommitReplyMessage&
+ToReplicaMessage::_Internal::gap_commit_reply(const ToReplicaMessage* msg) {
+  return *msg->_impl_.msg_.gap_commit_reply_;
+}
+const ::dsnet::nopaxos::proto::ViewChangeRequestMessage&
+ToReplicaMessage::_Internal::view_change_request(const ToReplicaMessage* msg) {
+  return *msg->_impl_.msg_.view_change_request_;
+}
+const ::dsnet::nopaxos::proto::ViewChangeMessage&
+ToReplicaMessage::_Internal::view_change(const ToReplicaMessage* msg) {
+  return *msg->_impl_.msg_.view_change_;
+}
+const ::dsnet::nopaxos::proto::StartViewMessage&
+ToReplicaMessage::_Internal::start_view(const ToReplicaMessage* msg) {
+  return *msg->_impl_.msg_.start_view_;
+}
+const ::dsnet::nopaxos::proto::StartViewReplyMessage&
+ToReplicaMessage::_Internal::start_view_reply(const ToReplicaMessage* msg) {
+  return *msg->_impl_.msg_.start_view_reply_;
+}
+const ::dsnet::nopaxos::proto::SyncPrepareRequestMessage&
+ToReplicaMessage::_Internal::sync_prepare_request(const ToReplicaMessage* msg) {
+  return *msg->_impl_.msg_.sync_prepare_request_;
+}
+const ::dsnet::nopaxos::proto::SyncPrepareMessage&
+ToReplicaMessage::_Internal::sync_prepare(const ToReplicaMessage* msg) {
+  return *msg->_impl_.msg_.sync_prepare_;
+}
+const ::dsnet::nopaxos::proto::SyncPrepareReplyMessage&
+ToReplicaMessage::_Internal::sync_prepare_reply(const ToReplicaMessage* msg) {
+  return *msg->_impl_.msg_.sync_prepare_reply_;
+}
+const ::dsnet::nopaxos::proto::SyncCommitMessage&
+ToReplicaMessage::_Internal::sync_commit(const ToReplicaMessage* msg) {
+  return *msg->_impl_.msg_.sync_commit_;
+}
+void ToReplicaMessage::set_allocated_request(::dsnet::nopaxos::proto::RequestMessage* request) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  clear_msg();
+  if (request) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(request);
+    if (message_arena != submessage_arena) {
+      request = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, request, submessage_arena);
+    }
+    set_has_request();
+    _impl_.msg_.request_ = request;
+  }
+  // @@protoc_insertion_point(field_set_allocated:dsnet.nopaxos.proto.ToReplicaMessage.request)
+}
+void ToReplicaMessage::set_allocated_unlogged_request(::dsnet::nopaxos::proto::UnloggedRequestMessage* unlogged_request) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  clear_msg();
+  if (unlogged_request) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(unlogged_request);
+    if (message_arena != submessage_arena) {
+      unlogged_request = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, unlogged_request, submessage_arena);
+    }
+    set_has_unlogged_request();
+    _impl_.msg_.unlogged_request_ = unlogged_request;
+  }
+  // @@protoc_insertion_point(field_set_allocated:dsnet.nopaxos.proto.ToReplicaMessage.unlogged_request)
+}
+void ToReplicaMessage::set_allocated_gap_request(::dsnet::nopaxos::proto::GapRequestMessage* gap_request) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  clear_msg();
+  if (gap_request) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(gap_request);
+    if (message_arena != submessage_arena) {
+      gap_request = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, gap_request, submessage_arena);
+    }
+    set_has_gap_request();
+    _impl_.msg_.gap_request_ = gap_request;
+  }
+  // @@protoc_insertion_point(field_set_allocated:dsnet.nopaxos.proto.ToReplicaMessage.gap_request)
+}
+void ToReplicaMessage::set_allocated_gap_reply(::dsnet::nopaxos::proto::GapReplyMessage* gap_reply) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  clear_msg();
+  if (gap_reply) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(gap_reply);
+    if (message_arena != submessage_arena) {
+      gap_reply = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, gap_reply, submessage_arena);
+    }
+    set_has_gap_reply();
+    _impl_.msg_.gap_reply_ = gap_reply;
+  }
+  // @@protoc_insertion_point(field_set_allocated:dsnet.nopaxos.proto.ToReplicaMessage.gap_reply)
+}
+void ToReplicaMessage::set_allocated_state_transfer_request(::dsnet::nopaxos::proto::StateTransferRequestMessage* state_transfer_request) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  clear_msg();
+  if (state_transfer_request) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(state_transfer_request);
+    if (message_arena != submessage_arena) {
+      state_transfer_request = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, state_transfer_request, submessage_arena);
+    }
+    set_has_state_transfer_request();
+    _impl_.msg_.state_transfer_request_ = state_transfer_request;
+  }
+  // @@protoc_insertion_point(field_set_allocated:dsnet.nopaxos.proto.ToReplicaMessage.state_transfer_request)
+}
+void ToReplicaMessage::set_allocated_state_transfer_reply(::dsnet::nopaxos::proto::StateTransferReplyMessage* state_transfer_reply) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  clear_msg();
+  if (state_transfer_reply) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(state_transfer_reply);
+    if (message_arena != submessage_arena) {
+      state_transfer_reply = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, state_transfer_reply, submessage_arena);
+    }
+    set_has_state_transfer_reply();
+    _impl_.msg_.state_transfer_reply_ = state_transfer_reply;
+  }
+  // @@protoc_insertion_point(field_set_allocated:dsnet.nopaxos.proto.ToReplicaMessage.state_transfer_reply)
+}
+void ToReplicaMessage::set_allocated_gap_commit(::dsnet::nopaxos::proto::GapCommitMessage* gap_commit) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  clear_msg();
+  if (gap_commit) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(gap_commit);
+    if (message_arena != submessage_arena) {
+      gap_commit = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, gap_commit, submessage_arena);
+    }
+    set_has_gap_commit();
+    _impl_.msg_.gap_commit_ = gap_commit;
+  }
+  // @@protoc_insertion_point(field_set_allocated:dsnet.nopaxos.proto.ToReplicaMessage.gap_commit)
+}
+void ToReplicaMessage::set_allocated_gap_commit_reply(::dsnet::nopaxos::proto::GapCommitReplyMessage* gap_commit_reply) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  clear_msg();
+  if (gap_commit_reply) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(gap_commit_reply);
+    if (message_arena != submessage_arena) {
+      gap_commit_reply = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, gap_commit_reply, submessage_arena);
+    }
+    set_has_gap_commit_reply();
+    _impl_.msg_.gap_commit_reply_ = gap_commit_reply;
+  }
+  // @@protoc_insertion_point(field_set_allocated:dsnet.nopaxos.proto.ToReplicaMessage.gap_commit_reply)
+}
+void ToReplicaMessage::set_allocated_view_change_request(::dsnet::nopaxos::proto::ViewChangeRequestMessage* view_change_request) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  clear_msg();
+  if (view_change_request) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(view_change_request);
+    if (message_arena != submessage_arena) {
+      view_change_request = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, view_change_request, submessage_arena);
+    }
+    set_has_view_change_request();
+    _impl_.msg_.view_change_request_ = view_change_request;
+  }
+  // @@protoc_insertion_point(field_set_allocated:dsnet.nopaxos.proto.ToReplicaMessage.view_change_request)
+}
+void ToReplicaMessage::set_allocated_view_change(::dsnet::nopaxos::proto::ViewChangeMessage* view_change) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  clear_msg();
+  if (view_change) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(view_change);
+    if (message_arena != submessage_arena) {
+      view_change = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, view_change, submessage_arena);
+    }
+    set_has_view_change();
+    _impl_.msg_.view_change_ = view_change;
+  }
+  // @@protoc_insertion_point(field_set_allocated:dsnet.nopaxos.proto.ToReplicaMessage.view_change)
+}
+void ToReplicaMessage::set_allocated_start_view(::dsnet::nopaxos::proto::StartViewMessage* start_view) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  clear_msg();
+  if (start_view) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(start_view);
+    if (message_arena != submessage_arena) {
+      start_view = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, start_view, submessage_arena);
+    }
+    set_has_start_view();
+    _impl_.msg_.start_view_ = start_view;
+  }
+  // @@protoc_insertion_point(field_set_allocated:dsnet.nopaxos.proto.ToReplicaMessage.start_view)
+}
+void ToReplicaMessage::set_allocated_start_view_reply(::dsnet::nopaxos::proto::StartViewReplyMessage* start_view_reply) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  clear_msg();
+  if (start_view_reply) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(start_view_reply);
+    if (message_arena != submessage_arena) {
+      start_view_reply = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, start_view_reply, submessage_arena);
+    }
+    set_has_start_view_reply();
+    _impl_.msg_.start_view_reply_ = start_view_reply;
+  }
+  // @@protoc_insertion_point(field_set_allocated:dsnet.nopaxos.proto.ToReplicaMessage.start_view_reply)
+}
+void ToReplicaMessage::set_allocated_sync_prepare_request(::dsnet::nopaxos::proto::SyncPrepareRequestMessage* sync_prepare_request) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  clear_msg();
+  if (sync_prepare_request) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(sync_prepare_request);
+    if (message_arena != submessage_arena) {
+      sync_prepare_request = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, sync_prepare_request, submessage_arena);
+    }
+    set_has_sync_prepare_request();
+    _impl_.msg_.sync_prepare_request_ = sync_prepare_request;
+  }
+  // @@protoc_insertion_point(field_set_allocated:dsnet.nopaxos.proto.ToReplicaMessage.sync_prepare_request)
+}
+void ToReplicaMessage::set_allocated_sync_prepare(::dsnet::nopaxos::proto::SyncPrepareMessage* sync_prepare) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  clear_msg();
+  if (sync_prepare) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(sync_prepare);
+    if (message_arena != submessage_arena) {
+      sync_prepare = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, sync_prepare, submessage_arena);
+    }
+    set_has_sync_prepare();
+    _impl_.msg_.sync_prepare_ = sync_prepare;
+  }
+  // @@protoc_insertion_point(field_set_allocated:dsnet.nopaxos.proto.ToReplicaMessage.sync_prepare)
+}
+void ToReplicaMessage::set_allocated_sync_prepare_reply(::dsnet::nopaxos::proto::SyncPrepareReplyMessage* sync_prepare_reply) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  clear_msg();
+  if (sync_prepare_reply) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(sync_prepare_reply);
+    if (message_arena != submessage_arena) {
+      sync_prepare_reply = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, sync_prepare_reply, submessage_arena);
+    }
+    set_has_sync_prepare_reply();
+    _impl_.msg_.sync_prepare_reply_ = sync_prepare_reply;
+  }
+  // @@protoc_insertion_point(field_set_allocated:dsnet.nopaxos.proto.ToReplicaMessage.sync_prepare_reply)
+}
+void ToReplicaMessage::set_allocated_sync_commit(::dsnet::nopaxos::proto::SyncCommitMessage* sync_commit) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  clear_msg();
+  if (sync_commit) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(sync_commit);
+    if (message_arena != submessage_arena) {
+      sync_commit = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, sync_commit, submessage_arena);
+    }
+    set_has_sync_commit();
+    _impl_.msg_.sync_commit_ = sync_commit;
+  }
+  // @@protoc_insertion_point(field_set_allocated:dsnet.nopaxos.proto.ToReplicaMessage.sync_commit)
+}
+ToReplicaMessage::ToReplicaMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:dsnet.nopaxos.proto.ToReplicaMessage)
+}
+ToReplicaMessage::ToReplicaMessage(const ToReplicaMessage& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  ToReplicaMessage* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.msg_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , /*decltype(_impl_._oneof_case_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  clear_has_msg();
+  switch (from.msg_case()) {
+    case kRequest: {
+      _this->_internal_mutable_request()->::dsnet::nopaxos::proto::RequestMessage::MergeFrom(
+          from._internal_request());
+      break;
+    }
+    case kUnloggedRequest: {
+      _this->_internal_mutable_unlogged_request()->::dsnet::nopaxos::proto::UnloggedRequestMessage::MergeFrom(
+          from._internal_unlogged_request());
+      break;
+    }
+    case kGapRequest: {
+      _this->_internal_mutable_gap_request()->::dsnet::nopaxos::proto::GapRequestMessage::MergeFrom(
+          from._internal_gap_request());
+      break;
+    }
+    case kGapReply: {
+      _this->_internal_mutable_gap_reply()->::dsnet::nopaxos::proto::GapReplyMessage::MergeFrom(
+          from._internal_gap_reply());
+      break;
+    }
+    case kStateTransferRequest: {
+      _this->_internal_mutable_state_transfer_request()->::dsnet::nopaxos::proto::StateTransferRequestMessage::MergeFrom(
+          from._internal_state_transfer_request());
+      break;
+    }
+    case kStateTransferReply: {
+      _this->_internal_mutable_state_transfer_reply()->::dsnet::nopaxos::proto::StateTransferReplyMessage::MergeFrom(
+          from._internal_state_transfer_reply());
+      break;
+    }
+    case kGapCommit: {
+      _this->_internal_mutable_gap_commit()->::dsnet::nopaxos::proto::GapCommitMessage::MergeFrom(
+          from._internal_gap_commit());
+      break;
+    }
+    case kGapCommitReply: {
+      _this->_internal_mutable_gap_commit_reply()->::dsnet::nopaxos::proto::GapCommitReplyMessage::MergeFrom(
+          from._internal_gap_commit_reply());
+      break;
+    }
+    case kViewChangeRequest: {
+      _this->_internal_mutable_view_change_request()->::dsnet::nopaxos::proto::ViewChangeRequestMessage::MergeFrom(
+          from._internal_view_change_request());
+      break;
+    }
+    case kViewChange: {
+      _this->_internal_mutable_view_change()->::dsnet::nopaxos::proto::ViewChangeMessage::MergeFrom(
+          from._internal_view_change());
+      break;
+    }
+    case kStartView: {
+      _this->_internal_mutable_start_view()->::dsnet::nopaxos::proto::StartViewMessage::MergeFrom(
+          from._internal_start_view());
+      break;
+    }
+    case kStartViewReply: {
+      _this->_internal_mutable_start_view_reply()->::dsnet::nopaxos::proto::StartViewReplyMessage::MergeFrom(
+          from._internal_start_view_reply());
+      break;
+    }
+    case kSyncPrepareRequest: {
+      _this->_internal_mutable_sync_prepare_request()->::dsnet::nopaxos::proto::SyncPrepareRequestMessage::MergeFrom(
+          from._internal_sync_prepare_request());
+      break;
+    }
+    case kSyncPrepare: {
+      _this->_internal_mutable_sync_prepare()->::dsnet::nopaxos::proto::SyncPrepareMessage::MergeFrom(
+          from._internal_sync_prepare());
+      break;
+    }
+    case kSyncPrepareReply: {
+      _this->_internal_mutable_sync_prepare_reply()->::dsnet::nopaxos::proto::SyncPrepareReplyMessage::MergeFrom(
+          from._internal_sync_prepare_reply());
+      break;
+    }
+    case kSyncCommit: {
+      _this->_internal_mutable_sync_commit()->::dsnet::nopaxos::proto::SyncCommitMessage::MergeFrom(
+          from._internal_sync_commit());
+      break;
+    }
+    case MSG_NOT_SET: {
+      break;
+    }
+  }
+  // @@protoc_insertion_point(copy_constructor:dsnet.nopaxos.proto.ToReplicaMessage)
+}
+
+inline void ToReplicaMessage::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.msg_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , /*decltype(_impl_._oneof_case_)*/{}
+  };
+  clear_has_msg();
+}
+
+ToReplicaMessage::~ToReplicaMessage() {
+  // @@protoc_insertion_point(destructor:dsnet.nopaxos.proto.ToReplicaMessage)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void ToReplicaMessage::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  if (has_msg()) {
+    clear_msg();
+  }
+}
+
+void ToReplicaMessage::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void ToReplicaMessage::clear_msg() {
+// @@protoc_insertion_point(one_of_clear_start:dsnet.nopaxos.proto.ToReplicaMessage)
+  switch (msg_case()) {
+    case kRequest: {
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.msg_.request_;
+      }
+      break;
+    }
+    case kUnloggedRequest: {
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.msg_.unlogged_request_;
+      }
+      break;
+    }
+    case kGapRequest: {
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.msg_.gap_request_;
+      }
+      break;
+    }
+    case kGapReply: {
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.msg_.gap_reply_;
+      }
+      break;
+    }
+    case kStateTransferRequest: {
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.msg_.state_transfer_request_;
+      }
+      break;
+    }
+    case kStateTransferReply: {
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.msg_.state_transfer_reply_;
+      }
+      break;
+    }
+    case kGapCommit: {
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.msg_.gap_commit_;
+      }
+      break;
+    }
+    case kGapCommitReply: {
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.msg_.gap_commit_reply_;
+      }
+      break;
+    }
+    case kViewChangeRequest: {
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.msg_.view_change_request_;
+      }
+      break;
+    }
+    case kViewChange: {
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.msg_.view_change_;
+      }
+      break;
+    }
+    case kStartView: {
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.msg_.start_view_;
+      }
+      break;
+    }
+    case kStartViewReply: {
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.msg_.start_view_reply_;
+      }
+      break;
+    }
+    case kSyncPrepareRequest: {
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.msg_.sync_prepare_request_;
+      }
+      break;
+    }
+    case kSyncPrepare: {
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.msg_.sync_prepare_;
+      }
+      break;
+    }
+    case kSyncPrepareReply: {
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.msg_.sync_prepare_reply_;
+      }
+      break;
+    }
+    case kSyncCommit: {
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.msg_.sync_commit_;
+      }
+      break;
+    }
+    case MSG_NOT_SET: {
+      break;
+    }
+  }
+  _impl_._oneof_case_[0] = MSG_NOT_SET;
+}
+
+
+void ToReplicaMessage::Clear() {
+// @@protoc_insertion_point(message_clear_start:dsnet.nopaxos.proto.ToReplicaMessage)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  clear_msg();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* ToReplicaMessage::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // .dsnet.nopaxos.proto.RequestMessage request = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr = ctx->ParseMessage(_internal_mutable_request(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .dsnet.nopaxos.proto.UnloggedRequestMessage unlogged_request = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr = ctx->ParseMessage(_internal_mutable_unlogged_request(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .dsnet.nopaxos.proto.GapRequestMessage gap_request = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          ptr = ctx->ParseMessage(_internal_mutable_gap_request(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .dsnet.nopaxos.proto.GapReplyMessage gap_reply = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          ptr = ctx->ParseMessage(_internal_mutable_gap_reply(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .dsnet.nopaxos.proto.StateTransferRequestMessage state_transfer_request = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 42)) {
+          ptr = ctx->ParseMessage(_internal_mutable_state_transfer_request(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .dsnet.nopaxos.proto.StateTransferReplyMessage state_transfer_reply = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 50)) {
+          ptr = ctx->ParseMessage(_internal_mutable_state_transfer_reply(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .dsnet.nopaxos.proto.GapCommitMessage gap_commit = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 58)) {
+          ptr = ctx->ParseMessage(_internal_mutable_gap_commit(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .dsnet.nopaxos.proto.GapCommitReplyMessage gap_commit_reply = 8;
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 66)) {
+          ptr = ctx->ParseMessage(_internal_mutable_gap_commit_reply(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .dsnet.nopaxos.proto.ViewChangeRequestMessage view_change_request = 9;
+      case 9:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 74)) {
+          ptr = ctx->ParseMessage(_internal_mutable_view_change_request(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .dsnet.nopaxos.proto.ViewChangeMessage view_change = 10;
+      case 10:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 82)) {
+          ptr = ctx->ParseMessage(_internal_mutable_view_change(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .dsnet.nopaxos.proto.StartViewMessage start_view = 11;
+      case 11:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 90)) {
+          ptr = ctx->ParseMessage(_internal_mutable_start_view(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .dsnet.nopaxos.proto.StartViewReplyMessage start_view_reply = 12;
+      case 12:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 98)) {
+          ptr = ctx->ParseMessage(_internal_mutable_start_view_reply(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .dsnet.nopaxos.proto.SyncPrepareRequestMessage sync_prepare_request = 13;
+      case 13:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 106)) {
+          ptr = ctx->ParseMessage(_internal_mutable_sync_prepare_request(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .dsnet.nopaxos.proto.SyncPrepareMessage sync_prepare = 14;
+      case 14:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 114)) {
+          ptr = ctx->ParseMessage(_internal_mutable_sync_prepare(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .dsnet.nopaxos.proto.SyncPrepareReplyMessage sync_prepare_reply = 15;
+      case 15:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 122)) {
+          ptr = ctx->ParseMessage(_internal_mutable_sync_prepare_reply(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .dsnet.nopaxos.proto.SyncCommitMessage sync_commit = 16;
+      case 16:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 130)) {
+          ptr = ctx->ParseMessage(_internal_mutable_sync_commit(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* ToReplicaMessage::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:dsnet.nopaxos.proto.ToReplicaMessage)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  switch (msg_case()) {
+    case kRequest: {
+      target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(1, _Internal::request(this),
+          _Internal::request(this).GetCachedSize(), target, stream);
+      break;
+    }
+    case kUnloggedRequest: {
+      target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(2, _Internal::unlogged_request(this),
+          _Internal::unlogged_request(this).GetCachedSize(), target, stream);
+      break;
+    }
+    case kGapRequest: {
+      target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(3, _Internal::gap_request(this),
+          _Internal::gap_request(this).GetCachedSize(), target, stream);
+      break;
+    }
+    case kGapReply: {
+      target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(4, _Internal::gap_reply(this),
+          _Internal::gap_reply(this).GetCachedSize(), target, stream);
+      break;
+    }
+    case kStateTransferRequest: {
+      target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(5, _Internal::state_transfer_request(this),
+          _Internal::state_transfer_request(this).GetCachedSize(), target, stream);
+      break;
+    }
+    case kStateTransferReply: {
+      target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(6, _Internal::state_transfer_reply(this),
+          _Internal::state_transfer_reply(this).GetCachedSize(), target, stream);
+      break;
+    }
+    case kGapCommit: {
+      target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(7, _Internal::gap_commit(this),
+          _Internal::gap_commit(this).GetCachedSize(), target, stream);
+      break;
+    }
+    case kGapCommitReply: {
+      target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(8, _Internal::gap_commit_reply(this),
+          _Internal::gap_commit_reply(this).GetCachedSize(), target, stream);
+      break;
+    }
+    case kViewChangeRequest: {
+      target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(9, _Internal::view_change_request(this),
+          _Internal::view_change_request(this).GetCachedSize(), target, stream);
+      break;
+    }
+    case kViewChange: {
+      target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(10, _Internal::view_change(this),
+          _Internal::view_change(this).GetCachedSize(), target, stream);
+      break;
+    }
+    case kStartView: {
+      target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(11, _Internal::start_view(this),
+          _Internal::start_view(this).GetCachedSize(), target, stream);
+      break;
+    }
+    case kStartViewReply: {
+      target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(12, _Internal::start_view_reply(this),
+          _Internal::start_view_reply(this).GetCachedSize(), target, stream);
+      break;
+    }
+    case kSyncPrepareRequest: {
+      target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(13, _Internal::sync_prepare_request(this),
+          _Internal::sync_prepare_request(this).GetCachedSize(), target, stream);
+      break;
+    }
+    case kSyncPrepare: {
+      target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(14, _Internal::sync_prepare(this),
+          _Internal::sync_prepare(this).GetCachedSize(), target, stream);
+      break;
+    }
+    case kSyncPrepareReply: {
+      target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(15, _Internal::sync_prepare_reply(this),
+          _Internal::sync_prepare_reply(this).GetCachedSize(), target, stream);
+      break;
+    }
+    case kSyncCommit: {
+      target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(16, _Internal::sync_commit(this),
+          _Internal::sync_commit(this).GetCachedSize(), target, stream);
+      break;
+    }
+    default: ;
+  }
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:dsnet.nopaxos.proto.ToReplicaMessage)
+  return target;
+}
+
+size_t ToReplicaMessage::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:dsnet.nopaxos.proto.ToReplicaMessage)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  switch (msg_case()) {
+    // .dsnet.nopaxos.proto.RequestMessage request = 1;
+    case kRequest: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.msg_.request_);
+      break;
+    }
+    // .dsnet.nopaxos.proto.UnloggedRequestMessage unlogged_request = 2;
+    case kUnloggedRequest: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.msg_.unlogged_request_);
+      break;
+    }
+    // .dsnet.nopaxos.proto.GapRequestMessage gap_request = 3;
+    case kGapRequest: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.msg_.gap_request_);
+      break;
+    }
+    // .dsnet.nopaxos.proto.GapReplyMessage gap_reply = 4;
+    case kGapReply: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.msg_.gap_reply_);
+      break;
+    }
+    // .dsnet.nopaxos.proto.StateTransferRequestMessage state_transfer_request = 5;
+    case kStateTransferRequest: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.msg_.state_transfer_request_);
+      break;
+    }
+    // .dsnet.nopaxos.proto.StateTransferReplyMessage state_transfer_reply = 6;
+    case kStateTransferReply: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.msg_.state_transfer_reply_);
+      break;
+    }
+    // .dsnet.nopaxos.proto.GapCommitMessage gap_commit = 7;
+    case kGapCommit: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.msg_.gap_commit_);
+      break;
+    }
+    // .dsnet.nopaxos.proto.GapCommitReplyMessage gap_commit_reply = 8;
+    case kGapCommitReply: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.msg_.gap_commit_reply_);
+      break;
+    }
+    // .dsnet.nopaxos.proto.ViewChangeRequestMessage view_change_request = 9;
+    case kViewChangeRequest: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.msg_.view_change_request_);
+      break;
+    }
+    // .dsnet.nopaxos.proto.ViewChangeMessage view_change = 10;
+    case kViewChange: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.msg_.view_change_);
+      break;
+    }
+    // .dsnet.nopaxos.proto.StartViewMessage start_view = 11;
+    case kStartView: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.msg_.start_view_);
+      break;
+    }
+    // .dsnet.nopaxos.proto.StartViewReplyMessage start_view_reply = 12;
+    case kStartViewReply: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.msg_.start_view_reply_);
+      break;
+    }
+    // .dsnet.nopaxos.proto.SyncPrepareRequestMessage sync_prepare_request = 13;
+    case kSyncPrepareRequest: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.msg_.sync_prepare_request_);
+      break;
+    }
+    // .dsnet.nopaxos.proto.SyncPrepareMessage sync_prepare = 14;
+    case kSyncPrepare: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.msg_.sync_prepare_);
+      break;
+    }
+    // .dsnet.nopaxos.proto.SyncPrepareReplyMessage sync_prepare_reply = 15;
+    case kSyncPrepareReply: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.msg_.sync_prepare_reply_);
+      break;
+    }
+    // .dsnet.nopaxos.proto.SyncCommitMessage sync_commit = 16;
+    case kSyncCommit: {
+      total_size += 2 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.msg_.sync_commit_);
+      break;
+    }
+    case MSG_NOT_SET: {
+      break;
+    }
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ToReplicaMessage::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    ToReplicaMessage::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ToReplicaMessage::GetClassData() const { return &_class_data_; }
+
+
+void ToReplicaMessage::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<ToReplicaMessage*>(&to_msg);
+  auto& from = static_cast<const ToReplicaMessage&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:dsnet.nopaxos.proto.ToReplicaMessage)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  switch (from.msg_case()) {
+    case kRequest: {
+      _this->_internal_mutable_request()->::dsnet::nopaxos::proto::RequestMessage::MergeFrom(
+          from._internal_request());
+      break;
+    }
+    case kUnloggedRequest: {
+      _this->_internal_mutable_unlogged_request()->::dsnet::nopaxos::proto::UnloggedRequestMessage::MergeFrom(
+          from._internal_unlogged_request());
+      break;
+    }
+    case kGapRequest: {
+      _this->_internal_mutable_gap_request()->::dsnet::nopaxos::proto::GapRequestMessage::MergeFrom(
+          from._internal_gap_request());
+      break;
+    }
+    case kGapReply: {
+      _this->_internal_mutable_gap_reply()->::dsnet::nopaxos::proto::GapReplyMessage::MergeFrom(
+          from._internal_gap_reply());
+      break;
+    }
+    case kStateTransferRequest: {
+      _this->_internal_mutable_state_transfer_request()->::dsnet::nopaxos::proto::StateTransferRequestMessage::MergeFrom(
+          from._internal_state_transfer_request());
+      break;
+    }
+    case kStateTransferReply: {
+      _this->_internal_mutable_state_transfer_reply()->::dsnet::nopaxos::proto::StateTransferReplyMessage::MergeFrom(
+          from._internal_state_transfer_reply());
+      break;
+    }
+    case kGapCommit: {
+      _this->_internal_mutable_gap_commit()->::dsnet::nopaxos::proto::GapCommitMessage::MergeFrom(
+          from._internal_gap_commit());
+      break;
+    }
+    case kGapCommitReply: {
+      _this->_internal_mutable_gap_commit_reply()->::dsnet::nopaxos::proto::GapCommitReplyMessage::MergeFrom(
+          from._internal_gap_commit_reply());
+      break;
+    }
+    case kViewChangeRequest: {
+      _this->_internal_mutable_view_change_request()->::dsnet::nopaxos::proto::ViewChangeRequestMessage::MergeFrom(
+          from._internal_view_change_request());
+      break;
+    }
+    case kViewChange: {
+      _this->_internal_mutable_view_change()->::dsnet::nopaxos::proto::ViewChangeMessage::MergeFrom(
+          from._internal_view_change());
+      break;
+    }
+    case kStartView: {
+      _this->_internal_mutable_start_view()->::dsnet::nopaxos::proto::StartViewMessage::MergeFrom(
+          from._internal_start_view());
+      break;
+    }
+    case kStartViewReply: {
+      _this->_internal_mutable_start_view_reply()->::dsnet::nopaxos::proto::StartViewReplyMessage::MergeFrom(
+          from._internal_start_view_reply());
+      break;
+    }
+    case kSyncPrepareRequest: {
+      _this->_internal_mutable_sync_prepare_request()->::dsnet::nopaxos::proto::SyncPrepareRequestMessage::MergeFrom(
+          from._internal_sync_prepare_request());
+      break;
+    }
+    case kSyncPrepare: {
+      _this->_internal_mutable_sync_prepare()->::dsnet::nopaxos::proto::SyncPrepareMessage::MergeFrom(
+          from._internal_sync_prepare());
+      break;
+    }
+    case kSyncPrepareReply: {
+      _this->_internal_mutable_sync_prepare_reply()->::dsnet::nopaxos::proto::SyncPrepareReplyMessage::MergeFrom(
+          from._internal_sync_prepare_reply());
+      break;
+    }
+    case kSyncCommit: {
+      _this->_internal_mutable_sync_commit()->::dsnet::nopaxos::proto::SyncCommitMessage::MergeFrom(
+          from._internal_sync_commit());
+      break;
+    }
+    case MSG_NOT_SET: {
+      break;
+    }
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void ToReplicaMessage::CopyFrom(const ToReplicaMessage& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:dsnet.nopaxos.proto.ToReplicaMessage)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool ToReplicaMessage::IsInitialized() const {
+  switch (msg_case()) {
+    case kRequest: {
+      if (_internal_has_request()) {
+        if (!_impl_.msg_.request_->IsInitialized()) return false;
+      }
+      break;
+    }
+    case kUnloggedRequest: {
+      if (_internal_has_unlogged_request()) {
+        if (!_impl_.msg_.unlogged_request_->IsInitialized()) return false;
+      }
+      break;
+    }
+    case kGapRequest: {
+      if (_internal_has_gap_request()) {
+        if (!_impl_.msg_.gap_request_->IsInitialized()) return false;
+      }
+      break;
+    }
+    case kGapReply: {
+      if (_internal_has_gap_reply()) {
+        if (!_impl_.msg_.gap_reply_->IsInitialized()) return false;
+      }
+      break;
+    }
+    case kStateTransferRequest: {
+      if (_internal_has_state_transfer_request()) {
+        if (!_impl_.msg_.state_transfer_request_->IsInitialized()) return false;
+      }
+      break;
+    }
+    case kStateTransferReply: {
+      if (_internal_has_state_transfer_reply()) {
+        if (!_impl_.msg_.state_transfer_reply_->IsInitialized()) return false;
+      }
+      break;
+    }
+    case kGapCommit: {
+      if (_internal_has_gap_commit()) {
+        if (!_impl_.msg_.gap_commit_->IsInitialized()) return false;
+      }
+      break;
+    }
+    case kGapCommitReply: {
+      if (_internal_has_gap_commit_reply()) {
+        if (!_impl_.msg_.gap_commit_reply_->IsInitialized()) return false;
+      }
+      break;
+    }
+    case kViewChangeRequest: {
+      if (_internal_has_view_change_request()) {
+        if (!_impl_.msg_.view_change_request_->IsInitialized()) return false;
+      }
+      break;
+    }
+    case kViewChange: {
+      if (_internal_has_view_change()) {
+        if (!_impl_.msg_.view_change_->IsInitialized()) return false;
+      }
+      break;
+    }
+    case kStartView: {
+      if (_internal_has_start_view()) {
+        if (!_impl_.msg_.start_view_->IsInitialized()) return false;
+      }
+      break;
+    }
+    case kStartViewReply: {
+      if (_internal_has_start_view_reply()) {
+        if (!_impl_.msg_.start_view_reply_->IsInitialized()) return false;
+      }
+      break;
+    }
+    case kSyncPrepareRequest: {
+      if (_internal_has_sync_prepare_request()) {
+        if (!_impl_.msg_.sync_prepare_request_->IsInitialized()) return false;
+      }
+      break;
+    }
+    case kSyncPrepare: {
+      if (_internal_has_sync_prepare()) {
+        if (!_impl_.msg_.sync_prepare_->IsInitialized()) return false;
+      }
+      break;
+    }
+    case kSyncPrepareReply: {
+      if (_internal_has_sync_prepare_reply()) {
+        if (!_impl_.msg_.sync_prepare_reply_->IsInitialized()) return false;
+      }
+      break;
+    }
+    case kSyncCommit: {
+      if (_internal_has_sync_commit()) {
+        if (!_impl_.msg_.sync_commit_->IsInitialized()) return false;
+      }
+      break;
+    }
+    case MSG_NOT_SET: {
+      break;
+    }
+  }
+  return true;
+}
+
+void ToReplicaMessage::InternalSwap(ToReplicaMessage* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_.msg_, other->_impl_.msg_);
+  swap(_impl_._oneof_case_[0], other->_impl_._oneof_case_[0]);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata ToReplicaMessage::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_replication_2fnopaxos_2fnopaxos_2dproto_2eproto_getter, &descriptor_table_replication_2fnopaxos_2fnopaxos_2dproto_2eproto_once,
+      file_level_metadata_replication_2fnopaxos_2fnopaxos_2dproto_2eproto[19]);
+}
+
+// @@protoc_insertion_point(namespace_scope)
+}  // namespace proto
+}  // namespace nopaxos
+}  // namespace dsnet
+PROTOBUF_NAMESPACE_OPEN
+template<> PROTOBUF_NOINLINE ::dsnet::nopaxos::proto::ReplyMessage*
+Arena::CreateMaybeMessage< ::dsnet::nopaxos::proto::ReplyMessage >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::dsnet::nopaxos::proto::ReplyMessage >(arena);
+}
+template<> PROTOBUF_NOINLINE ::dsnet::nopaxos::proto::UnloggedReplyMessage*
+Arena::CreateMaybeMessage< ::dsnet::nopaxos::proto::UnloggedReplyMessage >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::dsnet::nopaxos::proto::UnloggedReplyMessage >(arena);
+}
+template<> PROTOBUF_NOINLINE ::dsnet::nopaxos::proto::ToClientMessage*
+Arena::CreateMaybeMessage< ::dsnet::nopaxos::proto::ToClientMessage >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::dsnet::nopaxos::proto::ToClientMessage >(arena);
+}
+template<> PROTOBUF_NOINLINE ::dsnet::nopaxos::proto::RequestMessage*
+Arena::CreateMaybeMessage< ::dsnet::nopaxos::proto::RequestMessage >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::dsnet::nopaxos::proto::RequestMessage >(arena);
+}
+template<> PROTOBUF_NOINLINE ::dsnet::nopaxos::proto::UnloggedRequestMessage*
+Arena::CreateMaybeMessage< ::dsnet::nopaxos::proto::UnloggedRequestMessage >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::dsnet::nopaxos::proto::UnloggedRequestMessage >(arena);
+}
+template<> PROTOBUF_NOINLINE ::dsnet::nopaxos::proto::GapRequestMessage*
+Arena::CreateMaybeMessage< ::dsnet::nopaxos::proto::GapRequestMessage >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::dsnet::nopaxos::proto::GapRequestMessage >(arena);
+}
+template<> PROTOBUF_NOINLINE ::dsnet::nopaxos::proto::GapReplyMessage*
+Arena::CreateMaybeMessage< ::dsnet::nopaxos::proto::GapReplyMessage >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::dsnet::nopaxos::proto::GapReplyMessage >(arena);
+}
+template<> PROTOBUF_NOINLINE ::dsnet::nopaxos::proto::StateTransferRequestMessage*
+Arena::CreateMaybeMessage< ::dsnet::nopaxos::proto::StateTransferRequestMessage >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::dsnet::nopaxos::proto::StateTransferRequestMessage >(arena);
+}
+template<> PROTOBUF_NOINLINE ::dsnet::nopaxos::proto::StateTransferReplyMessage*
+Arena::CreateMaybeMessage< ::dsnet::nopaxos::proto::StateTransferReplyMessage >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::dsnet::nopaxos::proto::StateTransferReplyMessage >(arena);
+}
+template<> PROTOBUF_NOINLINE ::dsnet::nopaxos::proto::GapCommitMessage*
+Arena::CreateMaybeMessage< ::dsnet::nopaxos::proto::GapCommitMessage >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::dsnet::nopaxos::proto::GapCommitMessage >(arena);
+}
+template<> PROTOBUF_NOINLINE ::dsnet::nopaxos::proto::GapCommitReplyMessage*
+Arena::CreateMaybeMessage< ::dsnet::nopaxos::proto::GapCommitReplyMessage >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::dsnet::nopaxos::proto::GapCommitReplyMessage >(arena);
+}
+template<> PROTOBUF_NOINLINE ::dsnet::nopaxos::proto::ViewChangeRequestMessage*
+Arena::CreateMaybeMessage< ::dsnet::nopaxos::proto::ViewChangeRequestMessage >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::dsnet::nopaxos::proto::ViewChangeRequestMessage >(arena);
+}
+template<> PROTOBUF_NOINLINE ::dsnet::nopaxos::proto::ViewChangeMessage*
+Arena::CreateMaybeMessage< ::dsnet::nopaxos::proto::ViewChangeMessage >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::dsnet::nopaxos::proto::ViewChangeMessage >(arena);
+}
+template<> PROTOBUF_NOINLINE ::dsnet::nopaxos::proto::StartViewMessage*
+Arena::CreateMaybeMessage< ::dsnet::nopaxos::proto::StartViewMessage >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::dsnet::nopaxos::proto::StartViewMessage >(arena);
+}
+template<> PROTOBUF_NOINLINE ::dsnet::nopaxos::proto::StartViewReplyMessage*
+Arena::CreateMaybeMessage< ::dsnet::nopaxos::proto::StartViewReplyMessage >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::dsnet::nopaxos::proto::StartViewReplyMessage >(arena);
+}
+template<> PROTOBUF_NOINLINE ::dsnet::nopaxos::proto::SyncPrepareRequestMessage*
+Arena::CreateMaybeMessage< ::dsnet::nopaxos::proto::SyncPrepareRequestMessage >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::dsnet::nopaxos::proto::SyncPrepareRequestMessage >(arena);
+}
+template<> PROTOBUF_NOINLINE ::dsnet::nopaxos::proto::SyncPrepareMessage*
+Arena::CreateMaybeMessage< ::dsnet::nopaxos::proto::SyncPrepareMessage >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::dsnet::nopaxos::proto::SyncPrepareMessage >(arena);
+}
+template<> PROTOBUF_NOINLINE ::dsnet::nopaxos::proto::SyncPrepareReplyMessage*
+Arena::CreateMaybeMessage< ::dsnet::nopaxos::proto::SyncPrepareReplyMessage >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::dsnet::nopaxos::proto::SyncPrepareReplyMessage >(arena);
+}
+template<> PROTOBUF_NOINLINE ::dsnet::nopaxos::proto::SyncCommitMessage*
+Arena::CreateMaybeMessage< ::dsnet::nopaxos::proto::SyncCommitMessage >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::dsnet::nopaxos::proto::SyncCommitMessage >(arena);
+}
+template<> PROTOBUF_NOINLINE ::dsnet::nopaxos::proto::ToReplicaMessage*
+Arena::CreateMaybeMessage< ::dsnet::nopaxos::proto::ToReplicaMessage >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::dsnet::nopaxos::proto::ToReplicaMessage >(arena);
+}
+PROTOBUF_NAMESPACE_CLOSE
+
+// @@protoc_insertion_point(global_scope)
+#include <google/protobuf/port_undef.inc>
@@ -0,0 +1,8304 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: replication/nopaxos/nopaxos-proto.proto
+
+#ifndef GOOGLE_PROTOBUF_INCLUDED_replication_2fnopaxos_2fnopaxos_2dproto_2eproto
+#define GOOGLE_PROTOBUF_INCLUDED_replication_2fnopaxos_2fnopaxos_2dproto_2eproto
+
+#include <limits>
+#include <string>
+
+#include <google/protobuf/port_def.inc>
+#if PROTOBUF_VERSION < 3021000
+#error This file was generated by a newer version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please update
+#error your headers.
+#endif
+#if 3021012 < PROTOBUF_MIN_PROTOC_VERSION
+#error This file was generated by an older version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please
+#error regenerate this file with a newer version of protoc.
+#endif
+
+#include <google/protobuf/port_undef.inc>
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/arena.h>
+#include <google/protobuf/arenastring.h>
+#include <google/protobuf/generated_message_util.h>
+#include <google/protobuf/metadata_lite.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/message.h>
+#include <google/protobuf/repeated_field.h>  // IWYU pragma: export
+#include <google/protobuf/extension_set.h>  // IWYU pragma: export
+#include <google/protobuf/unknown_field_set.h>
+#include "common/request.pb.h"
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+#define PROTOBUF_INTERNAL_EXPORT_replication_2fnopaxos_2fnopaxos_2dproto_2eproto
+PROTOBUF_NAMESPACE_OPEN
+namespace internal {
+class AnyMetadata;
+}  // namespace internal
+PROTOBUF_NAMESPACE_CLOSE
+
+// Internal implementation detail -- do not use these members.
+struct TableStruct_replication_2fnopaxos_2fnopaxos_2dproto_2eproto {
+  static const uint32_t offsets[];
+};
+extern const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_replication_2fnopaxos_2fnopaxos_2dproto_2eproto;
+namespace dsnet {
+namespace nopaxos {
+namespace proto {
+class GapCommitMessage;
+struct GapCommitMessageDefaultTypeInternal;
+extern GapCommitMessageDefaultTypeInternal _GapCommitMessage_default_instance_;
+class GapCommitReplyMessage;
+struct GapCommitReplyMessageDefaultTypeInternal;
+extern GapCommitReplyMessageDefaultTypeInternal _GapCommitReplyMessage_default_instance_;
+class GapReplyMessage;
+struct GapReplyMessageDefaultTypeInternal;
+extern GapReplyMessageDefaultTypeInternal _GapReplyMessage_default_instance_;
+class GapRequestMessage;
+struct GapRequestMessageDefaultTypeInternal;
+extern GapRequestMessageDefaultTypeInternal _GapRequestMessage_default_instance_;
+class ReplyMessage;
+struct ReplyMessageDefaultTypeInternal;
+extern ReplyMessageDefaultTypeInternal _ReplyMessage_default_instance_;
+class RequestMessage;
+struct RequestMessageDefaultTypeInternal;
+extern RequestMessageDefaultTypeInternal _RequestMessage_default_instance_;
+class StartViewMessage;
+struct StartViewMessageDefaultTypeInternal;
+extern StartViewMessageDefaultTypeInternal _StartViewMessage_default_instance_;
+class StartViewReplyMessage;
+struct StartViewReplyMessageDefaultTypeInternal;
+extern StartViewReplyMessageDefaultTypeInternal _StartViewReplyMessage_default_instance_;
+class StateTransferReplyMessage;
+struct StateTransferReplyMessageDefaultTypeInternal;
+extern StateTransferReplyMessageDefaultTypeInternal _StateTransferReplyMessage_default_instance_;
+class StateTransferRequestMessage;
+struct StateTransferRequestMessageDefaultTypeInternal;
+extern StateTransferRequestMessageDefaultTypeInternal _StateTransferRequestMessage_default_instance_;
+class SyncCommitMessage;
+struct SyncCommitMessageDefaultTypeInternal;
+extern SyncCommitMessageDefaultTypeInternal _SyncCommitMessage_default_instance_;
+class SyncPrepareMessage;
+struct SyncPrepareMessageDefaultTypeInternal;
+extern SyncPrepareMessageDefaultTypeInternal _SyncPrepareMessage_default_instance_;
+class SyncPrepareReplyMessage;
+struct SyncPrepareReplyMessageDefaultTypeInternal;
+extern SyncPrepareReplyMessageDefaultTypeInternal _SyncPrepareReplyMessage_default_instance_;
+class SyncPrepareRequestMessage;
+struct SyncPrepareRequestMessageDefaultTypeInternal;
+extern SyncPrepareRequestMessageDefaultTypeInternal _SyncPrepareRequestMessage_default_instance_;
+class ToClientMessage;
+struct ToClientMessageDefaultTypeInternal;
+extern ToClientMessageDefaultTypeInternal _ToClientMessage_default_instance_;
+class ToReplicaMessage;
+struct ToReplicaMessageDefaultTypeInternal;
+extern ToReplicaMessageDefaultTypeInternal _ToReplicaMessage_default_instance_;
+class UnloggedReplyMessage;
+struct UnloggedReplyMessageDefaultTypeInternal;
+extern UnloggedReplyMessageDefaultTypeInternal _UnloggedReplyMessage_default_instance_;
+class UnloggedRequestMessage;
+struct UnloggedRequestMessageDefaultTypeInternal;
+extern UnloggedRequestMessageDefaultTypeInternal _UnloggedRequestMessage_default_instance_;
+class ViewChangeMessage;
+struct ViewChangeMessageDefaultTypeInternal;
+extern ViewChangeMessageDefaultTypeInternal _ViewChangeMessage_default_instance_;
+class ViewChangeRequestMessage;
+struct ViewChangeRequestMessageDefaultTypeInternal;
+extern ViewChangeRequestMessageDefaultTypeInternal _ViewChangeRequestMessage_default_instance_;
+}  // namespace proto
+}  // namespace nopaxos
+}  // namespace dsnet
+PROTOBUF_NAMESPACE_OPEN
+template<> ::dsnet::nopaxos::proto::GapCommitMessage* Arena::CreateMaybeMessage<::dsnet::nopaxos::proto::GapCommitMessage>(Arena*);
+template<> ::dsnet::nopaxos::proto::GapCommitReplyMessage* Arena::CreateMaybeMessage<::dsnet::nopaxos::proto::GapCommitReplyMessage>(Arena*);
+template<> ::dsnet::nopaxos::proto::GapReplyMessage* Arena::CreateMaybeMessage<::dsnet::nopaxos::proto::GapReplyMessage>(Arena*);
+template<> ::dsnet::nopaxos::proto::GapRequestMessage* Arena::CreateMaybeMessage<::dsnet::nopaxos::proto::GapRequestMessage>(Arena*);
+template<> ::dsnet::nopaxos::proto::ReplyMessage* Arena::CreateMaybeMessage<::dsnet::nopaxos::proto::ReplyMessage>(Arena*);
+template<> ::dsnet::nopaxos::proto::RequestMessage* Arena::CreateMaybeMessage<::dsnet::nopaxos::proto::RequestMessage>(Arena*);
+template<> ::dsnet::nopaxos::proto::StartViewMessage* Arena::CreateMaybeMessage<::dsnet::nopaxos::proto::StartViewMessage>(Arena*);
+template<> ::dsnet::nopaxos::proto::StartViewReplyMessage* Arena::CreateMaybeMessage<::dsnet::nopaxos::proto::StartViewReplyMessage>(Arena*);
+template<> ::dsnet::nopaxos::proto::StateTransferReplyMessage* Arena::CreateMaybeMessage<::dsnet::nopaxos::proto::StateTransferReplyMessage>(Arena*);
+template<> ::dsnet::nopaxos::proto::StateTransferRequestMessage* Arena::CreateMaybeMessage<::dsnet::nopaxos::proto::StateTransferRequestMessage>(Arena*);
+template<> ::dsnet::nopaxos::proto::SyncCommitMessage* Arena::CreateMaybeMessage<::dsnet::nopaxos::proto::SyncCommitMessage>(Arena*);
+template<> ::dsnet::nopaxos::proto::SyncPrepareMessage* Arena::CreateMaybeMessage<::dsnet::nopaxos::proto::SyncPrepareMessage>(Arena*);
+template<> ::dsnet::nopaxos::proto::SyncPrepareReplyMessage* Arena::CreateMaybeMessage<::dsnet::nopaxos::proto::SyncPrepareReplyMessage>(Arena*);
+template<> ::dsnet::nopaxos::proto::SyncPrepareRequestMessage* Arena::CreateMaybeMessage<::dsnet::nopaxos::proto::SyncPrepareRequestMessage>(Arena*);
+template<> ::dsnet::nopaxos::proto::ToClientMessage* Arena::CreateMaybeMessage<::dsnet::nopaxos::proto::ToClientMessage>(Arena*);
+template<> ::dsnet::nopaxos::proto::ToReplicaMessage* Arena::CreateMaybeMessage<::dsnet::nopaxos::proto::ToReplicaMessage>(Arena*);
+template<> ::dsnet::nopaxos::proto::UnloggedReplyMessage* Arena::CreateMaybeMessage<::dsnet::nopaxos::proto::UnloggedReplyMessage>(Arena*);
+template<> ::dsnet::nopaxos::proto::UnloggedRequestMessage* Arena::CreateMaybeMessage<::dsnet::nopaxos::proto::UnloggedRequestMessage>(Arena*);
+template<> ::dsnet::nopaxos::proto::ViewChangeMessage* Arena::CreateMaybeMessage<::dsnet::nopaxos::proto::ViewChangeMessage>(Arena*);
+template<> ::dsnet::nopaxos::proto::ViewChangeRequestMessage* Arena::CreateMaybeMessage<::dsnet::nopaxos::proto::ViewChangeRequestMessage>(Arena*);
+PROTOBUF_NAMESPACE_CLOSE
+namespace dsnet {
+namespace nopaxos {
+namespace proto {
+
+// ===================================================================
+
+class ReplyMessage final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:dsnet.nopaxos.proto.ReplyMessage) */ {
+ public:
+  inline ReplyMessage() : ReplyMessage(nullptr) {}
+  ~ReplyMessage() override;
+  explicit PROTOBUF_CONSTEXPR ReplyMessage(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  ReplyMessage(const ReplyMessage& from);
+  ReplyMessage(ReplyMessage&& from) noexcept
+    : ReplyMessage() {
+    *this = ::std::move(from);
+  }
+
+  inline ReplyMessage& operator=(const ReplyMessage& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline ReplyMessage& operator=(ReplyMessage&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ReplyMessage& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const ReplyMessage* internal_default_instance() {
+    return reinterpret_cast<const ReplyMessage*>(
+               &_ReplyMessage_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    0;
+
+  friend void swap(ReplyMessage& a, ReplyMessage& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(ReplyMessage* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ReplyMessage* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  ReplyMessage* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ReplyMessage>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const ReplyMessage& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ReplyMessage& from) {
+    ReplyMessage::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(ReplyMessage* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "dsnet.nopaxos.proto.ReplyMessage";
+  }
+  protected:
+  explicit ReplyMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kReplyFieldNumber = 6,
+    kViewFieldNumber = 1,
+    kSessnumFieldNumber = 2,
+    kOpnumFieldNumber = 3,
+    kClientreqidFieldNumber = 4,
+    kReplicaidxFieldNumber = 5,
+  };
+  // optional bytes reply = 6;
+  bool has_reply() const;
+  private:
+  bool _internal_has_reply() const;
+  public:
+  void clear_reply();
+  const std::string& reply() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_reply(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_reply();
+  PROTOBUF_NODISCARD std::string* release_reply();
+  void set_allocated_reply(std::string* reply);
+  private:
+  const std::string& _internal_reply() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_reply(const std::string& value);
+  std::string* _internal_mutable_reply();
+  public:
+
+  // required uint64 view = 1;
+  bool has_view() const;
+  private:
+  bool _internal_has_view() const;
+  public:
+  void clear_view();
+  uint64_t view() const;
+  void set_view(uint64_t value);
+  private:
+  uint64_t _internal_view() const;
+  void _internal_set_view(uint64_t value);
+  public:
+
+  // required uint64 sessnum = 2;
+  bool has_sessnum() const;
+  private:
+  bool _internal_has_sessnum() const;
+  public:
+  void clear_sessnum();
+  uint64_t sessnum() const;
+  void set_sessnum(uint64_t value);
+  private:
+  uint64_t _internal_sessnum() const;
+  void _internal_set_sessnum(uint64_t value);
+  public:
+
+  // required uint64 opnum = 3;
+  bool has_opnum() const;
+  private:
+  bool _internal_has_opnum() const;
+  public:
+  void clear_opnum();
+  uint64_t opnum() const;
+  void set_opnum(uint64_t value);
+  private:
+  uint64_t _internal_opnum() const;
+  void _internal_set_opnum(uint64_t value);
+  public:
+
+  // required uint64 clientreqid = 4;
+  bool has_clientreqid() const;
+  private:
+  bool _internal_has_clientreqid() const;
+  public:
+  void clear_clientreqid();
+  uint64_t clientreqid() const;
+  void set_clientreqid(uint64_t value);
+  private:
+  uint64_t _internal_clientreqid() const;
+  void _internal_set_clientreqid(uint64_t value);
+  public:
+
+  // required uint32 replicaidx = 5;
+  bool has_replicaidx() const;
+  private:
+  bool _internal_has_replicaidx() const;
+  public:
+  void clear_replicaidx();
+  uint32_t replicaidx() const;
+  void set_replicaidx(uint32_t value);
+  private:
+  uint32_t _internal_replicaidx() const;
+  void _internal_set_replicaidx(uint32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:dsnet.nopaxos.proto.ReplyMessage)
+ private:
+  class _Internal;
+
+  // helper for ByteSizeLong()
+  size_t RequiredFieldsByteSizeFallback() const;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr reply_;
+    uint64_t view_;
+    uint64_t sessnum_;
+    uint64_t opnum_;
+    uint64_t clientreqid_;
+    uint32_t replicaidx_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_replication_2fnopaxos_2fnopaxos_2dproto_2eproto;
+};
+// -------------------------------------------------------------------
+
+class UnloggedReplyMessage final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:dsnet.nopaxos.proto.UnloggedReplyMessage) */ {
+ public:
+  inline UnloggedReplyMessage() : UnloggedReplyMessage(nullptr) {}
+  ~UnloggedReplyMessage() override;
+  explicit PROTOBUF_CONSTEXPR UnloggedReplyMessage(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  UnloggedReplyMessage(const UnloggedReplyMessage& from);
+  UnloggedReplyMessage(UnloggedReplyMessage&& from) noexcept
+    : UnloggedReplyMessage() {
+    *this = ::std::move(from);
+  }
+
+  inline UnloggedReplyMessage& operator=(const UnloggedReplyMessage& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline UnloggedReplyMessage& operator=(UnloggedReplyMessage&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const UnloggedReplyMessage& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const UnloggedReplyMessage* internal_default_instance() {
+    return reinterpret_cast<const UnloggedReplyMessage*>(
+               &_UnloggedReplyMessage_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    1;
+
+  friend void swap(UnloggedReplyMessage& a, UnloggedReplyMessage& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(UnloggedReplyMessage* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(UnloggedReplyMessage* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  UnloggedReplyMessage* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<UnloggedReplyMessage>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const UnloggedReplyMessage& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const UnloggedReplyMessage& from) {
+    UnloggedReplyMessage::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(UnloggedReplyMessage* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "dsnet.nopaxos.proto.UnloggedReplyMessage";
+  }
+  protected:
+  explicit UnloggedReplyMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kReplyFieldNumber = 1,
+  };
+  // required bytes reply = 1;
+  bool has_reply() const;
+  private:
+  bool _internal_has_reply() const;
+  public:
+  void clear_reply();
+  const std::string& reply() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_reply(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_reply();
+  PROTOBUF_NODISCARD std::string* release_reply();
+  void set_allocated_reply(std::string* reply);
+  private:
+  const std::string& _internal_reply() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_reply(const std::string& value);
+  std::string* _internal_mutable_reply();
+  public:
+
+  // @@protoc_insertion_point(class_scope:dsnet.nopaxos.proto.UnloggedReplyMessage)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr reply_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_replication_2fnopaxos_2fnopaxos_2dproto_2eproto;
+};
+// -------------------------------------------------------------------
+
+class ToClientMessage final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:dsnet.nopaxos.proto.ToClientMessage) */ {
+ public:
+  inline ToClientMessage() : ToClientMessage(nullptr) {}
+  ~ToClientMessage() override;
+  explicit PROTOBUF_CONSTEXPR ToClientMessage(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  ToClientMessage(const ToClientMessage& from);
+  ToClientMessage(ToClientMessage&& from) noexcept
+    : ToClientMessage() {
+    *this = ::std::move(from);
+  }
+
+  inline ToClientMessage& operator=(const ToClientMessage& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline ToClientMessage& operator=(ToClientMessage&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ToClientMessage& default_instance() {
+    return *internal_default_instance();
+  }
+  enum MsgCase {
+    kReply = 1,
+    kUnloggedReply = 2,
+    MSG_NOT_SET = 0,
+  };
+
+  static inline const ToClientMessage* internal_default_instance() {
+    return reinterpret_cast<const ToClientMessage*>(
+               &_ToClientMessage_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    2;
+
+  friend void swap(ToClientMessage& a, ToClientMessage& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(ToClientMessage* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ToClientMessage* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  ToClientMessage* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ToClientMessage>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const ToClientMessage& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ToClientMessage& from) {
+    ToClientMessage::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(ToClientMessage* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "dsnet.nopaxos.proto.ToClientMessage";
+  }
+  protected:
+  explicit ToClientMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kReplyFieldNumber = 1,
+    kUnloggedReplyFieldNumber = 2,
+  };
+  // .dsnet.nopaxos.proto.ReplyMessage reply = 1;
+  bool has_reply() const;
+  private:
+  bool _internal_has_reply() const;
+  public:
+  void clear_reply();
+  const ::dsnet::nopaxos::proto::ReplyMessage& reply() const;
+  PROTOBUF_NODISCARD ::dsnet::nopaxos::proto::ReplyMessage* release_reply();
+  ::dsnet::nopaxos::proto::ReplyMessage* mutable_reply();
+  void set_allocated_reply(::dsnet::nopaxos::proto::ReplyMessage* reply);
+  private:
+  const ::dsnet::nopaxos::proto::ReplyMessage& _internal_reply() const;
+  ::dsnet::nopaxos::proto::ReplyMessage* _internal_mutable_reply();
+  public:
+  void unsafe_arena_set_allocated_reply(
+      ::dsnet::nopaxos::proto::ReplyMessage* reply);
+  ::dsnet::nopaxos::proto::ReplyMessage* unsafe_arena_release_reply();
+
+  // .dsnet.nopaxos.proto.UnloggedReplyMessage unlogged_reply = 2;
+  bool has_unlogged_reply() const;
+  private:
+  bool _internal_has_unlogged_reply() const;
+  public:
+  void clear_unlogged_reply();
+  const ::dsnet::nopaxos::proto::UnloggedReplyMessage& unlogged_reply() const;
+  PROTOBUF_NODISCARD ::dsnet::nopaxos::proto::UnloggedReplyMessage* release_unlogged_reply();
+  ::dsnet::nopaxos::proto::UnloggedReplyMessage* mutable_unlogged_reply();
+  void set_allocated_unlogged_reply(::dsnet::nopaxos::proto::UnloggedReplyMessage* unlogged_reply);
+  private:
+  const ::dsnet::nopaxos::proto::UnloggedReplyMessage& _internal_unlogged_reply() const;
+  ::dsnet::nopaxos::proto::UnloggedReplyMessage* _internal_mutable_unlogged_reply();
+  public:
+  void unsafe_arena_set_allocated_unlogged_reply(
+      ::dsnet::nopaxos::proto::UnloggedReplyMessage* unlogged_reply);
+  ::dsnet::nopaxos::proto::UnloggedReplyMessage* unsafe_arena_release_unlogged_reply();
+
+  void clear_msg();
+  MsgCase msg_case() const;
+  // @@protoc_insertion_point(class_scope:dsnet.nopaxos.proto.ToClientMessage)
+ private:
+  class _Internal;
+  void set_has_reply();
+  void set_has_unlogged_reply();
+
+  inline bool has_msg() const;
+  inline void clear_has_msg();
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    union MsgUnion {
+      constexpr MsgUnion() : _constinit_{} {}
+        ::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized _constinit_;
+      ::dsnet::nopaxos::proto::ReplyMessage* reply_;
+      ::dsnet::nopaxos::proto::UnloggedReplyMessage* unlogged_reply_;
+    } msg_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    uint32_t _oneof_case_[1];
+
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_replication_2fnopaxos_2fnopaxos_2dproto_2eproto;
+};
+// -------------------------------------------------------------------
+
+class RequestMessage final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:dsnet.nopaxos.proto.RequestMessage) */ {
+ public:
+  inline RequestMessage() : RequestMessage(nullptr) {}
+  ~RequestMessage() override;
+  explicit PROTOBUF_CONSTEXPR RequestMessage(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  RequestMessage(const RequestMessage& from);
+  RequestMessage(RequestMessage&& from) noexcept
+    : RequestMessage() {
+    *this = ::std::move(from);
+  }
+
+  inline RequestMessage& operator=(const RequestMessage& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline RequestMessage& operator=(RequestMessage&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const RequestMessage& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const RequestMessage* internal_default_instance() {
+    return reinterpret_cast<const RequestMessage*>(
+               &_RequestMessage_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    3;
+
+  friend void swap(RequestMessage& a, RequestMessage& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(RequestMessage* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(RequestMessage* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  RequestMessage* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<RequestMessage>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const RequestMessage& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const RequestMessage& from) {
+    RequestMessage::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(RequestMessage* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "dsnet.nopaxos.proto.RequestMessage";
+  }
+  protected:
+  explicit RequestMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kReqFieldNumber = 3,
+    kSessnumFieldNumber = 1,
+    kMsgnumFieldNumber = 2,
+  };
+  // required .dsnet.Request req = 3;
+  bool has_req() const;
+  private:
+  bool _internal_has_req() const;
+  public:
+  void clear_req();
+  const ::dsnet::Request& req() const;
+  PROTOBUF_NODISCARD ::dsnet::Request* release_req();
+  ::dsnet::Request* mutable_req();
+  void set_allocated_req(::dsnet::Request* req);
+  private:
+  const ::dsnet::Request& _internal_req() const;
+  ::dsnet::Request* _internal_mutable_req();
+  public:
+  void unsafe_arena_set_allocated_req(
+      ::dsnet::Request* req);
+  ::dsnet::Request* unsafe_arena_release_req();
+
+  // required uint64 sessnum = 1;
+  bool has_sessnum() const;
+  private:
+  bool _internal_has_sessnum() const;
+  public:
+  void clear_sessnum();
+  uint64_t sessnum() const;
+  void set_sessnum(uint64_t value);
+  private:
+  uint64_t _internal_sessnum() const;
+  void _internal_set_sessnum(uint64_t value);
+  public:
+
+  // required uint64 msgnum = 2;
+  bool has_msgnum() const;
+  private:
+  bool _internal_has_msgnum() const;
+  public:
+  void clear_msgnum();
+  uint64_t msgnum() const;
+  void set_msgnum(uint64_t value);
+  private:
+  uint64_t _internal_msgnum() const;
+  void _internal_set_msgnum(uint64_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:dsnet.nopaxos.proto.RequestMessage)
+ private:
+  class _Internal;
+
+  // helper for ByteSizeLong()
+  size_t RequiredFieldsByteSizeFallback() const;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::dsnet::Request* req_;
+    uint64_t sessnum_;
+    uint64_t msgnum_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_replication_2fnopaxos_2fnopaxos_2dproto_2eproto;
+};
+// -------------------------------------------------------------------
+
+class UnloggedRequestMessage final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:dsnet.nopaxos.proto.UnloggedRequestMessage) */ {
+ public:
+  inline UnloggedRequestMessage() : UnloggedRequestMessage(nullptr) {}
+  ~UnloggedRequestMessage() override;
+  explicit PROTOBUF_CONSTEXPR UnloggedRequestMessage(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  UnloggedRequestMessage(const UnloggedRequestMessage& from);
+  UnloggedRequestMessage(UnloggedRequestMessage&& from) noexcept
+    : UnloggedRequestMessage() {
+    *this = ::std::move(from);
+  }
+
+  inline UnloggedRequestMessage& operator=(const UnloggedRequestMessage& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline UnloggedRequestMessage& operator=(UnloggedRequestMessage&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const UnloggedRequestMessage& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const UnloggedRequestMessage* internal_default_instance() {
+    return reinterpret_cast<const UnloggedRequestMessage*>(
+               &_UnloggedRequestMessage_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    4;
+
+  friend void swap(UnloggedRequestMessage& a, UnloggedRequestMessage& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(UnloggedRequestMessage* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(UnloggedRequestMessage* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  UnloggedRequestMessage* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<UnloggedRequestMessage>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const UnloggedRequestMessage& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const UnloggedRequestMessage& from) {
+    UnloggedRequestMessage::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(UnloggedRequestMessage* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "dsnet.nopaxos.proto.UnloggedRequestMessage";
+  }
+  protected:
+  explicit UnloggedRequestMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kReqFieldNumber = 1,
+  };
+  // required .dsnet.UnloggedRequest req = 1;
+  bool has_req() const;
+  private:
+  bool _internal_has_req() const;
+  public:
+  void clear_req();
+  const ::dsnet::UnloggedRequest& req() const;
+  PROTOBUF_NODISCARD ::dsnet::UnloggedRequest* release_req();
+  ::dsnet::UnloggedRequest* mutable_req();
+  void set_allocated_req(::dsnet::UnloggedRequest* req);
+  private:
+  const ::dsnet::UnloggedRequest& _internal_req() const;
+  ::dsnet::UnloggedRequest* _internal_mutable_req();
+  public:
+  void unsafe_arena_set_allocated_req(
+      ::dsnet::UnloggedRequest* req);
+  ::dsnet::UnloggedRequest* unsafe_arena_release_req();
+
+  // @@protoc_insertion_point(class_scope:dsnet.nopaxos.proto.UnloggedRequestMessage)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::dsnet::UnloggedRequest* req_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_replication_2fnopaxos_2fnopaxos_2dproto_2eproto;
+};
+// -------------------------------------------------------------------
+
+class GapRequestMessage final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:dsnet.nopaxos.proto.GapRequestMessage) */ {
+ public:
+  inline GapRequestMessage() : GapRequestMessage(nullptr) {}
+  ~GapRequestMessage() override;
+  explicit PROTOBUF_CONSTEXPR GapRequestMessage(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  GapRequestMessage(const GapRequestMessage& from);
+  GapRequestMessage(GapRequestMessage&& from) noexcept
+    : GapRequestMessage() {
+    *this = ::std::move(from);
+  }
+
+  inline GapRequestMessage& operator=(const GapRequestMessage& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline GapRequestMessage& operator=(GapRequestMessage&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const GapRequestMessage& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const GapRequestMessage* internal_default_instance() {
+    return reinterpret_cast<const GapRequestMessage*>(
+               &_GapRequestMessage_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    5;
+
+  friend void swap(GapRequestMessage& a, GapRequestMessage& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(GapRequestMessage* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(GapRequestMessage* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  GapRequestMessage* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<GapRequestMessage>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const GapRequestMessage& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const GapRequestMessage& from) {
+    GapRequestMessage::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(GapRequestMessage* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "dsnet.nopaxos.proto.GapRequestMessage";
+  }
+  protected:
+  explicit GapRequestMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kViewFieldNumber = 1,
+    kSessnumFieldNumber = 2,
+    kOpnumFieldNumber = 3,
+  };
+  // required uint64 view = 1;
+  bool has_view() const;
+  private:
+  bool _internal_has_view() const;
+  public:
+  void clear_view();
+  uint64_t view() const;
+  void set_view(uint64_t value);
+  private:
+  uint64_t _internal_view() const;
+  void _internal_set_view(uint64_t value);
+  public:
+
+  // required uint64 sessnum = 2;
+  bool has_sessnum() const;
+  private:
+  bool _internal_has_sessnum() const;
+  public:
+  void clear_sessnum();
+  uint64_t sessnum() const;
+  void set_sessnum(uint64_t value);
+  private:
+  uint64_t _internal_sessnum() const;
+  void _internal_set_sessnum(uint64_t value);
+  public:
+
+  // required uint64 opnum = 3;
+  bool has_opnum() const;
+  private:
+  bool _internal_has_opnum() const;
+  public:
+  void clear_opnum();
+  uint64_t opnum() const;
+  void set_opnum(uint64_t value);
+  private:
+  uint64_t _internal_opnum() const;
+  void _internal_set_opnum(uint64_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:dsnet.nopaxos.proto.GapRequestMessage)
+ private:
+  class _Internal;
+
+  // helper for ByteSizeLong()
+  size_t RequiredFieldsByteSizeFallback() const;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    uint64_t view_;
+    uint64_t sessnum_;
+    uint64_t opnum_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_replication_2fnopaxos_2fnopaxos_2dproto_2eproto;
+};
+// -------------------------------------------------------------------
+
+class GapReplyMessage final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:dsnet.nopaxos.proto.GapReplyMessage) */ {
+ public:
+  inline GapReplyMessage() : GapReplyMessage(nullptr) {}
+  ~GapReplyMessage() override;
+  explicit PROTOBUF_CONSTEXPR GapReplyMessage(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  GapReplyMessage(const GapReplyMessage& from);
+  GapReplyMessage(GapReplyMessage&& from) noexcept
+    : GapReplyMessage() {
+    *this = ::std::move(from);
+  }
+
+  inline GapReplyMessage& operator=(const GapReplyMessage& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline GapReplyMessage& operator=(GapReplyMessage&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const GapReplyMessage& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const GapReplyMessage* internal_default_instance() {
+    return reinterpret_cast<const GapReplyMessage*>(
+               &_GapReplyMessage_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    6;
+
+  friend void swap(GapReplyMessage& a, GapReplyMessage& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(GapReplyMessage* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(GapReplyMessage* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  GapReplyMessage* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<GapReplyMessage>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const GapReplyMessage& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const GapReplyMessage& from) {
+    GapReplyMessage::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(GapReplyMessage* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "dsnet.nopaxos.proto.GapReplyMessage";
+  }
+  protected:
+  explicit GapReplyMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kReqFieldNumber = 7,
+    kViewFieldNumber = 1,
+    kSessnumFieldNumber = 2,
+    kOpnumFieldNumber = 3,
+    kIsfoundFieldNumber = 4,
+    kIsgapFieldNumber = 5,
+    kReplicaidxFieldNumber = 6,
+  };
+  // optional .dsnet.Request req = 7;
+  bool has_req() const;
+  private:
+  bool _internal_has_req() const;
+  public:
+  void clear_req();
+  const ::dsnet::Request& req() const;
+  PROTOBUF_NODISCARD ::dsnet::Request* release_req();
+  ::dsnet::Request* mutable_req();
+  void set_allocated_req(::dsnet::Request* req);
+  private:
+  const ::dsnet::Request& _internal_req() const;
+  ::dsnet::Request* _internal_mutable_req();
+  public:
+  void unsafe_arena_set_allocated_req(
+      ::dsnet::Request* req);
+  ::dsnet::Request* unsafe_arena_release_req();
+
+  // required uint64 view = 1;
+  bool has_view() const;
+  private:
+  bool _internal_has_view() const;
+  public:
+  void clear_view();
+  uint64_t view() const;
+  void set_view(uint64_t value);
+  private:
+  uint64_t _internal_view() const;
+  void _internal_set_view(uint64_t value);
+  public:
+
+  // required uint64 sessnum = 2;
+  bool has_sessnum() const;
+  private:
+  bool _internal_has_sessnum() const;
+  public:
+  void clear_sessnum();
+  uint64_t sessnum() const;
+  void set_sessnum(uint64_t value);
+  private:
+  uint64_t _internal_sessnum() const;
+  void _internal_set_sessnum(uint64_t value);
+  public:
+
+  // required uint64 opnum = 3;
+  bool has_opnum() const;
+  private:
+  bool _internal_has_opnum() const;
+  public:
+  void clear_opnum();
+  uint64_t opnum() const;
+  void set_opnum(uint64_t value);
+  private:
+  uint64_t _internal_opnum() const;
+  void _internal_set_opnum(uint64_t value);
+  public:
+
+  // required bool isfound = 4;
+  bool has_isfound() const;
+  private:
+  bool _internal_has_isfound() const;
+  public:
+  void clear_isfound();
+  bool isfound() const;
+  void set_isfound(bool value);
+  private:
+  bool _internal_isfound() const;
+  void _internal_set_isfound(bool value);
+  public:
+
+  // required bool isgap = 5;
+  bool has_isgap() const;
+  private:
+  bool _internal_has_isgap() const;
+  public:
+  void clear_isgap();
+  bool isgap() const;
+  void set_isgap(bool value);
+  private:
+  bool _internal_isgap() const;
+  void _internal_set_isgap(bool value);
+  public:
+
+  // required uint32 replicaidx = 6;
+  bool has_replicaidx() const;
+  private:
+  bool _internal_has_replicaidx() const;
+  public:
+  void clear_replicaidx();
+  uint32_t replicaidx() const;
+  void set_replicaidx(uint32_t value);
+  private:
+  uint32_t _internal_replicaidx() const;
+  void _internal_set_replicaidx(uint32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:dsnet.nopaxos.proto.GapReplyMessage)
+ private:
+  class _Internal;
+
+  // helper for ByteSizeLong()
+  size_t RequiredFieldsByteSizeFallback() const;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::dsnet::Request* req_;
+    uint64_t view_;
+    uint64_t sessnum_;
+    uint64_t opnum_;
+    bool isfound_;
+    bool isgap_;
+    uint32_t replicaidx_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_replication_2fnopaxos_2fnopaxos_2dproto_2eproto;
+};
+// -------------------------------------------------------------------
+
+class StateTransferRequestMessage final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:dsnet.nopaxos.proto.StateTransferRequestMessage) */ {
+ public:
+  inline StateTransferRequestMessage() : StateTransferRequestMessage(nullptr) {}
+  ~StateTransferRequestMessage() override;
+  explicit PROTOBUF_CONSTEXPR StateTransferRequestMessage(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  StateTransferRequestMessage(const StateTransferRequestMessage& from);
+  StateTransferRequestMessage(StateTransferRequestMessage&& from) noexcept
+    : StateTransferRequestMessage() {
+    *this = ::std::move(from);
+  }
+
+  inline StateTransferRequestMessage& operator=(const StateTransferRequestMessage& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline StateTransferRequestMessage& operator=(StateTransferRequestMessage&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const StateTransferRequestMessage& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const StateTransferRequestMessage* internal_default_instance() {
+    return reinterpret_cast<const StateTransferRequestMessage*>(
+               &_StateTransferRequestMessage_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    7;
+
+  friend void swap(StateTransferRequestMessage& a, StateTransferRequestMessage& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(StateTransferRequestMessage* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(StateTransferRequestMessage* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  StateTransferRequestMessage* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<StateTransferRequestMessage>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const StateTransferRequestMessage& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const StateTransferRequestMessage& from) {
+    StateTransferRequestMessage::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(StateTransferRequestMessage* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "dsnet.nopaxos.proto.StateTransferRequestMessage";
+  }
+  protected:
+  explicit StateTransferRequestMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kSessnumFieldNumber = 1,
+    kViewFieldNumber = 2,
+    kBeginFieldNumber = 3,
+    kEndFieldNumber = 4,
+  };
+  // required uint64 sessnum = 1;
+  bool has_sessnum() const;
+  private:
+  bool _internal_has_sessnum() const;
+  public:
+  void clear_sessnum();
+  uint64_t sessnum() const;
+  void set_sessnum(uint64_t value);
+  private:
+  uint64_t _internal_sessnum() const;
+  void _internal_set_sessnum(uint64_t value);
+  public:
+
+  // required uint64 view = 2;
+  bool has_view() const;
+  private:
+  bool _internal_has_view() const;
+  public:
+  void clear_view();
+  uint64_t view() const;
+  void set_view(uint64_t value);
+  private:
+  uint64_t _internal_view() const;
+  void _internal_set_view(uint64_t value);
+  public:
+
+  // required uint64 begin = 3;
+  bool has_begin() const;
+  private:
+  bool _internal_has_begin() const;
+  public:
+  void clear_begin();
+  uint64_t begin() const;
+  void set_begin(uint64_t value);
+  private:
+  uint64_t _internal_begin() const;
+  void _internal_set_begin(uint64_t value);
+  public:
+
+  // required uint64 end = 4;
+  bool has_end() const;
+  private:
+  bool _internal_has_end() const;
+  public:
+  void clear_end();
+  uint64_t end() const;
+  void set_end(uint64_t value);
+  private:
+  uint64_t _internal_end() const;
+  void _internal_set_end(uint64_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:dsnet.nopaxos.proto.StateTransferRequestMessage)
+ private:
+  class _Internal;
+
+  // helper for ByteSizeLong()
+  size_t RequiredFieldsByteSizeFallback() const;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    uint64_t sessnum_;
+    uint64_t view_;
+    uint64_t begin_;
+    uint64_t end_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_replication_2fnopaxos_2fnopaxos_2dproto_2eproto;
+};
+// -------------------------------------------------------------------
+
+class StateTransferReplyMessage final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:dsnet.nopaxos.proto.StateTransferReplyMessage) */ {
+ public:
+  inline StateTransferReplyMessage() : StateTransferReplyMessage(nullptr) {}
+  ~StateTransferReplyMessage() override;
+  explicit PROTOBUF_CONSTEXPR StateTransferReplyMessage(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  StateTransferReplyMessage(const StateTransferReplyMessage& from);
+  StateTransferReplyMessage(StateTransferReplyMessage&& from) noexcept
+    : StateTransferReplyMessage() {
+    *this = ::std::move(from);
+  }
+
+  inline StateTransferReplyMessage& operator=(const StateTransferReplyMessage& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline StateTransferReplyMessage& operator=(StateTransferReplyMessage&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const StateTransferReplyMessage& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const StateTransferReplyMessage* internal_default_instance() {
+    return reinterpret_cast<const StateTransferReplyMessage*>(
+               &_StateTransferReplyMessage_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    8;
+
+  friend void swap(StateTransferReplyMessage& a, StateTransferReplyMessage& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(StateTransferReplyMessage* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(StateTransferReplyMessage* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  StateTransferReplyMessage* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<StateTransferReplyMessage>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const StateTransferReplyMessage& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const StateTransferReplyMessage& from) {
+    StateTransferReplyMessage::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(StateTransferReplyMessage* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "dsnet.nopaxos.proto.StateTransferReplyMessage";
+  }
+  protected:
+  explicit StateTransferReplyMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kEntriesFieldNumber = 5,
+    kSessnumFieldNumber = 1,
+    kViewFieldNumber = 2,
+    kBeginFieldNumber = 3,
+    kEndFieldNumber = 4,
+  };
+  // repeated .dsnet.MsgLogEntry entries = 5;
+  int entries_size() const;
+  private:
+  int _internal_entries_size() const;
+  public:
+  void clear_entries();
+  ::dsnet::MsgLogEntry* mutable_entries(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::dsnet::MsgLogEntry >*
+      mutable_entries();
+  private:
+  const ::dsnet::MsgLogEntry& _internal_entries(int index) const;
+  ::dsnet::MsgLogEntry* _internal_add_entries();
+  public:
+  const ::dsnet::MsgLogEntry& entries(int index) const;
+  ::dsnet::MsgLogEntry* add_entries();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::dsnet::MsgLogEntry >&
+      entries() const;
+
+  // required uint64 sessnum = 1;
+  bool has_sessnum() const;
+  private:
+  bool _internal_has_sessnum() const;
+  public:
+  void clear_sessnum();
+  uint64_t sessnum() const;
+  void set_sessnum(uint64_t value);
+  private:
+  uint64_t _internal_sessnum() const;
+  void _internal_set_sessnum(uint64_t value);
+  public:
+
+  // required uint64 view = 2;
+  bool has_view() const;
+  private:
+  bool _internal_has_view() const;
+  public:
+  void clear_view();
+  uint64_t view() const;
+  void set_view(uint64_t value);
+  private:
+  uint64_t _internal_view() const;
+  void _internal_set_view(uint64_t value);
+  public:
+
+  // required uint64 begin = 3;
+  bool has_begin() const;
+  private:
+  bool _internal_has_begin() const;
+  public:
+  void clear_begin();
+  uint64_t begin() const;
+  void set_begin(uint64_t value);
+  private:
+  uint64_t _internal_begin() const;
+  void _internal_set_begin(uint64_t value);
+  public:
+
+  // required uint64 end = 4;
+  bool has_end() const;
+  private:
+  bool _internal_has_end() const;
+  public:
+  void clear_end();
+  uint64_t end() const;
+  void set_end(uint64_t value);
+  private:
+  uint64_t _internal_end() const;
+  void _internal_set_end(uint64_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:dsnet.nopaxos.proto.StateTransferReplyMessage)
+ private:
+  class _Internal;
+
+  // helper for ByteSizeLong()
+  size_t RequiredFieldsByteSizeFallback() const;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::dsnet::MsgLogEntry > entries_;
+    uint64_t sessnum_;
+    uint64_t view_;
+    uint64_t begin_;
+    uint64_t end_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_replication_2fnopaxos_2fnopaxos_2dproto_2eproto;
+};
+// -------------------------------------------------------------------
+
+class GapCommitMessage final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:dsnet.nopaxos.proto.GapCommitMessage) */ {
+ public:
+  inline GapCommitMessage() : GapCommitMessage(nullptr) {}
+  ~GapCommitMessage() override;
+  explicit PROTOBUF_CONSTEXPR GapCommitMessage(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  GapCommitMessage(const GapCommitMessage& from);
+  GapCommitMessage(GapCommitMessage&& from) noexcept
+    : GapCommitMessage() {
+    *this = ::std::move(from);
+  }
+
+  inline GapCommitMessage& operator=(const GapCommitMessage& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline GapCommitMessage& operator=(GapCommitMessage&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const GapCommitMessage& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const GapCommitMessage* internal_default_instance() {
+    return reinterpret_cast<const GapCommitMessage*>(
+               &_GapCommitMessage_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    9;
+
+  friend void swap(GapCommitMessage& a, GapCommitMessage& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(GapCommitMessage* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(GapCommitMessage* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  GapCommitMessage* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<GapCommitMessage>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const GapCommitMessage& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const GapCommitMessage& from) {
+    GapCommitMessage::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(GapCommitMessage* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "dsnet.nopaxos.proto.GapCommitMessage";
+  }
+  protected:
+  explicit GapCommitMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kSessnumFieldNumber = 1,
+    kViewFieldNumber = 2,
+    kOpnumFieldNumber = 3,
+  };
+  // required uint64 sessnum = 1;
+  bool has_sessnum() const;
+  private:
+  bool _internal_has_sessnum() const;
+  public:
+  void clear_sessnum();
+  uint64_t sessnum() const;
+  void set_sessnum(uint64_t value);
+  private:
+  uint64_t _internal_sessnum() const;
+  void _internal_set_sessnum(uint64_t value);
+  public:
+
+  // required uint64 view = 2;
+  bool has_view() const;
+  private:
+  bool _internal_has_view() const;
+  public:
+  void clear_view();
+  uint64_t view() const;
+  void set_view(uint64_t value);
+  private:
+  uint64_t _internal_view() const;
+  void _internal_set_view(uint64_t value);
+  public:
+
+  // required uint64 opnum = 3;
+  bool has_opnum() const;
+  private:
+  bool _internal_has_opnum() const;
+  public:
+  void clear_opnum();
+  uint64_t opnum() const;
+  void set_opnum(uint64_t value);
+  private:
+  uint64_t _internal_opnum() const;
+  void _internal_set_opnum(uint64_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:dsnet.nopaxos.proto.GapCommitMessage)
+ private:
+  class _Internal;
+
+  // helper for ByteSizeLong()
+  size_t RequiredFieldsByteSizeFallback() const;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    uint64_t sessnum_;
+    uint64_t view_;
+    uint64_t opnum_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_replication_2fnopaxos_2fnopaxos_2dproto_2eproto;
+};
+// -------------------------------------------------------------------
+
+class GapCommitReplyMessage final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:dsnet.nopaxos.proto.GapCommitReplyMessage) */ {
+ public:
+  inline GapCommitReplyMessage() : GapCommitReplyMessage(nullptr) {}
+  ~GapCommitReplyMessage() override;
+  explicit PROTOBUF_CONSTEXPR GapCommitReplyMessage(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  GapCommitReplyMessage(const GapCommitReplyMessage& from);
+  GapCommitReplyMessage(GapCommitReplyMessage&& from) noexcept
+    : GapCommitReplyMessage() {
+    *this = ::std::move(from);
+  }
+
+  inline GapCommitReplyMessage& operator=(const GapCommitReplyMessage& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline GapCommitReplyMessage& operator=(GapCommitReplyMessage&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const GapCommitReplyMessage& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const GapCommitReplyMessage* internal_default_instance() {
+    return reinterpret_cast<const GapCommitReplyMessage*>(
+               &_GapCommitReplyMessage_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    10;
+
+  friend void swap(GapCommitReplyMessage& a, GapCommitReplyMessage& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(GapCommitReplyMessage* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(GapCommitReplyMessage* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  GapCommitReplyMessage* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<GapCommitReplyMessage>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const GapCommitReplyMessage& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const GapCommitReplyMessage& from) {
+    GapCommitReplyMessage::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(GapCommitReplyMessage* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "dsnet.nopaxos.proto.GapCommitReplyMessage";
+  }
+  protected:
+  explicit GapCommitReplyMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kSessnumFieldNumber = 1,
+    kViewFieldNumber = 2,
+    kOpnumFieldNumber = 3,
+    kReplicaidxFieldNumber = 4,
+  };
+  // required uint64 sessnum = 1;
+  bool has_sessnum() const;
+  private:
+  bool _internal_has_sessnum() const;
+  public:
+  void clear_sessnum();
+  uint64_t sessnum() const;
+  void set_sessnum(uint64_t value);
+  private:
+  uint64_t _internal_sessnum() const;
+  void _internal_set_sessnum(uint64_t value);
+  public:
+
+  // required uint64 view = 2;
+  bool has_view() const;
+  private:
+  bool _internal_has_view() const;
+  public:
+  void clear_view();
+  uint64_t view() const;
+  void set_view(uint64_t value);
+  private:
+  uint64_t _internal_view() const;
+  void _internal_set_view(uint64_t value);
+  public:
+
+  // required uint64 opnum = 3;
+  bool has_opnum() const;
+  private:
+  bool _internal_has_opnum() const;
+  public:
+  void clear_opnum();
+  uint64_t opnum() const;
+  void set_opnum(uint64_t value);
+  private:
+  uint64_t _internal_opnum() const;
+  void _internal_set_opnum(uint64_t value);
+  public:
+
+  // required uint32 replicaidx = 4;
+  bool has_replicaidx() const;
+  private:
+  bool _internal_has_replicaidx() const;
+  public:
+  void clear_replicaidx();
+  uint32_t replicaidx() const;
+  void set_replicaidx(uint32_t value);
+  private:
+  uint32_t _internal_replicaidx() const;
+  void _internal_set_replicaidx(uint32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:dsnet.nopaxos.proto.GapCommitReplyMessage)
+ private:
+  class _Internal;
+
+  // helper for ByteSizeLong()
+  size_t RequiredFieldsByteSizeFallback() const;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    uint64_t sessnum_;
+    uint64_t view_;
+    uint64_t opnum_;
+    uint32_t replicaidx_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_replication_2fnopaxos_2fnopaxos_2dproto_2eproto;
+};
+// -------------------------------------------------------------------
+
+class ViewChangeRequestMessage final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:dsnet.nopaxos.proto.ViewChangeRequestMessage) */ {
+ public:
+  inline ViewChangeRequestMessage() : ViewChangeRequestMessage(nullptr) {}
+  ~ViewChangeRequestMessage() override;
+  explicit PROTOBUF_CONSTEXPR ViewChangeRequestMessage(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  ViewChangeRequestMessage(const ViewChangeRequestMessage& from);
+  ViewChangeRequestMessage(ViewChangeRequestMessage&& from) noexcept
+    : ViewChangeRequestMessage() {
+    *this = ::std::move(from);
+  }
+
+  inline ViewChangeRequestMessage& operator=(const ViewChangeRequestMessage& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline ViewChangeRequestMessage& operator=(ViewChangeRequestMessage&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ViewChangeRequestMessage& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const ViewChangeRequestMessage* internal_default_instance() {
+    return reinterpret_cast<const ViewChangeRequestMessage*>(
+               &_ViewChangeRequestMessage_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    11;
+
+  friend void swap(ViewChangeRequestMessage& a, ViewChangeRequestMessage& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(ViewChangeRequestMessage* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ViewChangeRequestMessage* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  ViewChangeRequestMessage* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ViewChangeRequestMessage>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const ViewChangeRequestMessage& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ViewChangeRequestMessage& from) {
+    ViewChangeRequestMessage::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(ViewChangeRequestMessage* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "dsnet.nopaxos.proto.ViewChangeRequestMessage";
+  }
+  protected:
+  explicit ViewChangeRequestMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kSessnumFieldNumber = 1,
+    kViewFieldNumber = 2,
+  };
+  // required uint64 sessnum = 1;
+  bool has_sessnum() const;
+  private:
+  bool _internal_has_sessnum() const;
+  public:
+  void clear_sessnum();
+  uint64_t sessnum() const;
+  void set_sessnum(uint64_t value);
+  private:
+  uint64_t _internal_sessnum() const;
+  void _internal_set_sessnum(uint64_t value);
+  public:
+
+  // required uint64 view = 2;
+  bool has_view() const;
+  private:
+  bool _internal_has_view() const;
+  public:
+  void clear_view();
+  uint64_t view() const;
+  void set_view(uint64_t value);
+  private:
+  uint64_t _internal_view() const;
+  void _internal_set_view(uint64_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:dsnet.nopaxos.proto.ViewChangeRequestMessage)
+ private:
+  class _Internal;
+
+  // helper for ByteSizeLong()
+  size_t RequiredFieldsByteSizeFallback() const;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    uint64_t sessnum_;
+    uint64_t view_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_replication_2fnopaxos_2fnopaxos_2dproto_2eproto;
+};
+// -------------------------------------------------------------------
+
+class ViewChangeMessage final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:dsnet.nopaxos.proto.ViewChangeMessage) */ {
+ public:
+  inline ViewChangeMessage() : ViewChangeMessage(nullptr) {}
+  ~ViewChangeMessage() override;
+  explicit PROTOBUF_CONSTEXPR ViewChangeMessage(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  ViewChangeMessage(const ViewChangeMessage& from);
+  ViewChangeMessage(ViewChangeMessage&& from) noexcept
+    : ViewChangeMessage() {
+    *this = ::std::move(from);
+  }
+
+  inline ViewChangeMessage& operator=(const ViewChangeMessage& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline ViewChangeMessage& operator=(ViewChangeMessage&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ViewChangeMessage& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const ViewChangeMessage* internal_default_instance() {
+    return reinterpret_cast<const ViewChangeMessage*>(
+               &_ViewChangeMessage_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    12;
+
+  friend void swap(ViewChangeMessage& a, ViewChangeMessage& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(ViewChangeMessage* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ViewChangeMessage* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  ViewChangeMessage* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ViewChangeMessage>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const ViewChangeMessage& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ViewChangeMessage& from) {
+    ViewChangeMessage::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(ViewChangeMessage* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "dsnet.nopaxos.proto.ViewChangeMessage";
+  }
+  protected:
+  explicit ViewChangeMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kCommittedgapsFieldNumber = 6,
+    kSessnumFieldNumber = 1,
+    kViewFieldNumber = 2,
+    kLastnormalsessnumFieldNumber = 3,
+    kLastnormalviewFieldNumber = 4,
+    kLastopFieldNumber = 5,
+    kReplicaidxFieldNumber = 7,
+  };
+  // repeated uint64 committedgaps = 6;
+  int committedgaps_size() const;
+  private:
+  int _internal_committedgaps_size() const;
+  public:
+  void clear_committedgaps();
+  private:
+  uint64_t _internal_committedgaps(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >&
+      _internal_committedgaps() const;
+  void _internal_add_committedgaps(uint64_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >*
+      _internal_mutable_committedgaps();
+  public:
+  uint64_t committedgaps(int index) const;
+  void set_committedgaps(int index, uint64_t value);
+  void add_committedgaps(uint64_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >&
+      committedgaps() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >*
+      mutable_committedgaps();
+
+  // required uint64 sessnum = 1;
+  bool has_sessnum() const;
+  private:
+  bool _internal_has_sessnum() const;
+  public:
+  void clear_sessnum();
+  uint64_t sessnum() const;
+  void set_sessnum(uint64_t value);
+  private:
+  uint64_t _internal_sessnum() const;
+  void _internal_set_sessnum(uint64_t value);
+  public:
+
+  // required uint64 view = 2;
+  bool has_view() const;
+  private:
+  bool _internal_has_view() const;
+  public:
+  void clear_view();
+  uint64_t view() const;
+  void set_view(uint64_t value);
+  private:
+  uint64_t _internal_view() const;
+  void _internal_set_view(uint64_t value);
+  public:
+
+  // required uint64 lastnormalsessnum = 3;
+  bool has_lastnormalsessnum() const;
+  private:
+  bool _internal_has_lastnormalsessnum() const;
+  public:
+  void clear_lastnormalsessnum();
+  uint64_t lastnormalsessnum() const;
+  void set_lastnormalsessnum(uint64_t value);
+  private:
+  uint64_t _internal_lastnormalsessnum() const;
+  void _internal_set_lastnormalsessnum(uint64_t value);
+  public:
+
+  // required uint64 lastnormalview = 4;
+  bool has_lastnormalview() const;
+  private:
+  bool _internal_has_lastnormalview() const;
+  public:
+  void clear_lastnormalview();
+  uint64_t lastnormalview() const;
+  void set_lastnormalview(uint64_t value);
+  private:
+  uint64_t _internal_lastnormalview() const;
+  void _internal_set_lastnormalview(uint64_t value);
+  public:
+
+  // required uint64 lastop = 5;
+  bool has_lastop() const;
+  private:
+  bool _internal_has_lastop() const;
+  public:
+  void clear_lastop();
+  uint64_t lastop() const;
+  void set_lastop(uint64_t value);
+  private:
+  uint64_t _internal_lastop() const;
+  void _internal_set_lastop(uint64_t value);
+  public:
+
+  // required uint32 replicaidx = 7;
+  bool has_replicaidx() const;
+  private:
+  bool _internal_has_replicaidx() const;
+  public:
+  void clear_replicaidx();
+  uint32_t replicaidx() const;
+  void set_replicaidx(uint32_t value);
+  private:
+  uint32_t _internal_replicaidx() const;
+  void _internal_set_replicaidx(uint32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:dsnet.nopaxos.proto.ViewChangeMessage)
+ private:
+  class _Internal;
+
+  // helper for ByteSizeLong()
+  size_t RequiredFieldsByteSizeFallback() const;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t > committedgaps_;
+    uint64_t sessnum_;
+    uint64_t view_;
+    uint64_t lastnormalsessnum_;
+    uint64_t lastnormalview_;
+    uint64_t lastop_;
+    uint32_t replicaidx_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_replication_2fnopaxos_2fnopaxos_2dproto_2eproto;
+};
+// -------------------------------------------------------------------
+
+class StartViewMessage final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:dsnet.nopaxos.proto.StartViewMessage) */ {
+ public:
+  inline StartViewMessage() : StartViewMessage(nullptr) {}
+  ~StartViewMessage() override;
+  explicit PROTOBUF_CONSTEXPR StartViewMessage(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  StartViewMessage(const StartViewMessage& from);
+  StartViewMessage(StartViewMessage&& from) noexcept
+    : StartViewMessage() {
+    *this = ::std::move(from);
+  }
+
+  inline StartViewMessage& operator=(const StartViewMessage& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline StartViewMessage& operator=(StartViewMessage&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const StartViewMessage& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const StartViewMessage* internal_default_instance() {
+    return reinterpret_cast<const StartViewMessage*>(
+               &_StartViewMessage_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    13;
+
+  friend void swap(StartViewMessage& a, StartViewMessage& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(StartViewMessage* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(StartViewMessage* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  StartViewMessage* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<StartViewMessage>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const StartViewMessage& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const StartViewMessage& from) {
+    StartViewMessage::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(StartViewMessage* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "dsnet.nopaxos.proto.StartViewMessage";
+  }
+  protected:
+  explicit StartViewMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kCommittedgapsFieldNumber = 6,
+    kSessnumFieldNumber = 1,
+    kViewFieldNumber = 2,
+    kLastnormalsessnumFieldNumber = 3,
+    kLastnormalviewFieldNumber = 4,
+    kLastopFieldNumber = 5,
+  };
+  // repeated uint64 committedgaps = 6;
+  int committedgaps_size() const;
+  private:
+  int _internal_committedgaps_size() const;
+  public:
+  void clear_committedgaps();
+  private:
+  uint64_t _internal_committedgaps(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >&
+      _internal_committedgaps() const;
+  void _internal_add_committedgaps(uint64_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >*
+      _internal_mutable_committedgaps();
+  public:
+  uint64_t committedgaps(int index) const;
+  void set_committedgaps(int index, uint64_t value);
+  void add_committedgaps(uint64_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >&
+      committedgaps() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >*
+      mutable_committedgaps();
+
+  // required uint64 sessnum = 1;
+  bool has_sessnum() const;
+  private:
+  bool _internal_has_sessnum() const;
+  public:
+  void clear_sessnum();
+  uint64_t sessnum() const;
+  void set_sessnum(uint64_t value);
+  private:
+  uint64_t _internal_sessnum() const;
+  void _internal_set_sessnum(uint64_t value);
+  public:
+
+  // required uint64 view = 2;
+  bool has_view() const;
+  private:
+  bool _internal_has_view() const;
+  public:
+  void clear_view();
+  uint64_t view() const;
+  void set_view(uint64_t value);
+  private:
+  uint64_t _internal_view() const;
+  void _internal_set_view(uint64_t value);
+  public:
+
+  // required uint64 lastnormalsessnum = 3;
+  bool has_lastnormalsessnum() const;
+  private:
+  bool _internal_has_lastnormalsessnum() const;
+  public:
+  void clear_lastnormalsessnum();
+  uint64_t lastnormalsessnum() const;
+  void set_lastnormalsessnum(uint64_t value);
+  private:
+  uint64_t _internal_lastnormalsessnum() const;
+  void _internal_set_lastnormalsessnum(uint64_t value);
+  public:
+
+  // required uint64 lastnormalview = 4;
+  bool has_lastnormalview() const;
+  private:
+  bool _internal_has_lastnormalview() const;
+  public:
+  void clear_lastnormalview();
+  uint64_t lastnormalview() const;
+  void set_lastnormalview(uint64_t value);
+  private:
+  uint64_t _internal_lastnormalview() const;
+  void _internal_set_lastnormalview(uint64_t value);
+  public:
+
+  // required uint64 lastop = 5;
+  bool has_lastop() const;
+  private:
+  bool _internal_has_lastop() const;
+  public:
+  void clear_lastop();
+  uint64_t lastop() const;
+  void set_lastop(uint64_t value);
+  private:
+  uint64_t _internal_lastop() const;
+  void _internal_set_lastop(uint64_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:dsnet.nopaxos.proto.StartViewMessage)
+ private:
+  class _Internal;
+
+  // helper for ByteSizeLong()
+  size_t RequiredFieldsByteSizeFallback() const;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t > committedgaps_;
+    uint64_t sessnum_;
+    uint64_t view_;
+    uint64_t lastnormalsessnum_;
+    uint64_t lastnormalview_;
+    uint64_t lastop_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_replication_2fnopaxos_2fnopaxos_2dproto_2eproto;
+};
+// -------------------------------------------------------------------
+
+class StartViewReplyMessage final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:dsnet.nopaxos.proto.StartViewReplyMessage) */ {
+ public:
+  inline StartViewReplyMessage() : StartViewReplyMessage(nullptr) {}
+  ~StartViewReplyMessage() override;
+  explicit PROTOBUF_CONSTEXPR StartViewReplyMessage(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  StartViewReplyMessage(const StartViewReplyMessage& from);
+  StartViewReplyMessage(StartViewReplyMessage&& from) noexcept
+    : StartViewReplyMessage() {
+    *this = ::std::move(from);
+  }
+
+  inline StartViewReplyMessage& operator=(const StartViewReplyMessage& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline StartViewReplyMessage& operator=(StartViewReplyMessage&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const StartViewReplyMessage& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const StartViewReplyMessage* internal_default_instance() {
+    return reinterpret_cast<const StartViewReplyMessage*>(
+               &_StartViewReplyMessage_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    14;
+
+  friend void swap(StartViewReplyMessage& a, StartViewReplyMessage& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(StartViewReplyMessage* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(StartViewReplyMessage* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  StartViewReplyMessage* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<StartViewReplyMessage>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const StartViewReplyMessage& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const StartViewReplyMessage& from) {
+    StartViewReplyMessage::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(StartViewReplyMessage* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "dsnet.nopaxos.proto.StartViewReplyMessage";
+  }
+  protected:
+  explicit StartViewReplyMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kSessnumFieldNumber = 1,
+    kViewFieldNumber = 2,
+    kReplicaidxFieldNumber = 3,
+  };
+  // required uint64 sessnum = 1;
+  bool has_sessnum() const;
+  private:
+  bool _internal_has_sessnum() const;
+  public:
+  void clear_sessnum();
+  uint64_t sessnum() const;
+  void set_sessnum(uint64_t value);
+  private:
+  uint64_t _internal_sessnum() const;
+  void _internal_set_sessnum(uint64_t value);
+  public:
+
+  // required uint64 view = 2;
+  bool has_view() const;
+  private:
+  bool _internal_has_view() const;
+  public:
+  void clear_view();
+  uint64_t view() const;
+  void set_view(uint64_t value);
+  private:
+  uint64_t _internal_view() const;
+  void _internal_set_view(uint64_t value);
+  public:
+
+  // required uint32 replicaidx = 3;
+  bool has_replicaidx() const;
+  private:
+  bool _internal_has_replicaidx() const;
+  public:
+  void clear_replicaidx();
+  uint32_t replicaidx() const;
+  void set_replicaidx(uint32_t value);
+  private:
+  uint32_t _internal_replicaidx() const;
+  void _internal_set_replicaidx(uint32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:dsnet.nopaxos.proto.StartViewReplyMessage)
+ private:
+  class _Internal;
+
+  // helper for ByteSizeLong()
+  size_t RequiredFieldsByteSizeFallback() const;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    uint64_t sessnum_;
+    uint64_t view_;
+    uint32_t replicaidx_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_replication_2fnopaxos_2fnopaxos_2dproto_2eproto;
+};
+// -------------------------------------------------------------------
+
+class SyncPrepareRequestMessage final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:dsnet.nopaxos.proto.SyncPrepareRequestMessage) */ {
+ public:
+  inline SyncPrepareRequestMessage() : SyncPrepareRequestMessage(nullptr) {}
+  ~SyncPrepareRequestMessage() override;
+  explicit PROTOBUF_CONSTEXPR SyncPrepareRequestMessage(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  SyncPrepareRequestMessage(const SyncPrepareRequestMessage& from);
+  SyncPrepareRequestMessage(SyncPrepareRequestMessage&& from) noexcept
+    : SyncPrepareRequestMessage() {
+    *this = ::std::move(from);
+  }
+
+  inline SyncPrepareRequestMessage& operator=(const SyncPrepareRequestMessage& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline SyncPrepareRequestMessage& operator=(SyncPrepareRequestMessage&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const SyncPrepareRequestMessage& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const SyncPrepareRequestMessage* internal_default_instance() {
+    return reinterpret_cast<const SyncPrepareRequestMessage*>(
+               &_SyncPrepareRequestMessage_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    15;
+
+  friend void swap(SyncPrepareRequestMessage& a, SyncPrepareRequestMessage& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(SyncPrepareRequestMessage* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(SyncPrepareRequestMessage* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  SyncPrepareRequestMessage* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<SyncPrepareRequestMessage>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const SyncPrepareRequestMessage& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const SyncPrepareRequestMessage& from) {
+    SyncPrepareRequestMessage::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(SyncPrepareRequestMessage* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "dsnet.nopaxos.proto.SyncPrepareRequestMessage";
+  }
+  protected:
+  explicit SyncPrepareRequestMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kSessnumFieldNumber = 1,
+    kViewFieldNumber = 2,
+  };
+  // required uint64 sessnum = 1;
+  bool has_sessnum() const;
+  private:
+  bool _internal_has_sessnum() const;
+  public:
+  void clear_sessnum();
+  uint64_t sessnum() const;
+  void set_sessnum(uint64_t value);
+  private:
+  uint64_t _internal_sessnum() const;
+  void _internal_set_sessnum(uint64_t value);
+  public:
+
+  // required uint64 view = 2;
+  bool has_view() const;
+  private:
+  bool _internal_has_view() const;
+  public:
+  void clear_view();
+  uint64_t view() const;
+  void set_view(uint64_t value);
+  private:
+  uint64_t _internal_view() const;
+  void _internal_set_view(uint64_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:dsnet.nopaxos.proto.SyncPrepareRequestMessage)
+ private:
+  class _Internal;
+
+  // helper for ByteSizeLong()
+  size_t RequiredFieldsByteSizeFallback() const;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    uint64_t sessnum_;
+    uint64_t view_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_replication_2fnopaxos_2fnopaxos_2dproto_2eproto;
+};
+// -------------------------------------------------------------------
+
+class SyncPrepareMessage final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:dsnet.nopaxos.proto.SyncPrepareMessage) */ {
+ public:
+  inline SyncPrepareMessage() : SyncPrepareMessage(nullptr) {}
+  ~SyncPrepareMessage() override;
+  explicit PROTOBUF_CONSTEXPR SyncPrepareMessage(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  SyncPrepareMessage(const SyncPrepareMessage& from);
+  SyncPrepareMessage(SyncPrepareMessage&& from) noexcept
+    : SyncPrepareMessage() {
+    *this = ::std::move(from);
+  }
+
+  inline SyncPrepareMessage& operator=(const SyncPrepareMessage& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline SyncPrepareMessage& operator=(SyncPrepareMessage&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const SyncPrepareMessage& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const SyncPrepareMessage* internal_default_instance() {
+    return reinterpret_cast<const SyncPrepareMessage*>(
+               &_SyncPrepareMessage_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    16;
+
+  friend void swap(SyncPrepareMessage& a, SyncPrepareMessage& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(SyncPrepareMessage* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(SyncPrepareMessage* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  SyncPrepareMessage* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<SyncPrepareMessage>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const SyncPrepareMessage& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const SyncPrepareMessage& from) {
+    SyncPrepareMessage::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(SyncPrepareMessage* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "dsnet.nopaxos.proto.SyncPrepareMessage";
+  }
+  protected:
+  explicit SyncPrepareMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kCommittedgapsFieldNumber = 4,
+    kSessnumFieldNumber = 1,
+    kViewFieldNumber = 2,
+    kLastopFieldNumber = 3,
+  };
+  // repeated uint64 committedgaps = 4;
+  int committedgaps_size() const;
+  private:
+  int _internal_committedgaps_size() const;
+  public:
+  void clear_committedgaps();
+  private:
+  uint64_t _internal_committedgaps(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >&
+      _internal_committedgaps() const;
+  void _internal_add_committedgaps(uint64_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >*
+      _internal_mutable_committedgaps();
+  public:
+  uint64_t committedgaps(int index) const;
+  void set_committedgaps(int index, uint64_t value);
+  void add_committedgaps(uint64_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >&
+      committedgaps() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >*
+      mutable_committedgaps();
+
+  // required uint64 sessnum = 1;
+  bool has_sessnum() const;
+  private:
+  bool _internal_has_sessnum() const;
+  public:
+  void clear_sessnum();
+  uint64_t sessnum() const;
+  void set_sessnum(uint64_t value);
+  private:
+  uint64_t _internal_sessnum() const;
+  void _internal_set_sessnum(uint64_t value);
+  public:
+
+  // required uint64 view = 2;
+  bool has_view() const;
+  private:
+  bool _internal_has_view() const;
+  public:
+  void clear_view();
+  uint64_t view() const;
+  void set_view(uint64_t value);
+  private:
+  uint64_t _internal_view() const;
+  void _internal_set_view(uint64_t value);
+  public:
+
+  // required uint64 lastop = 3;
+  bool has_lastop() const;
+  private:
+  bool _internal_has_lastop() const;
+  public:
+  void clear_lastop();
+  uint64_t lastop() const;
+  void set_lastop(uint64_t value);
+  private:
+  uint64_t _internal_lastop() const;
+  void _internal_set_lastop(uint64_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:dsnet.nopaxos.proto.SyncPrepareMessage)
+ private:
+  class _Internal;
+
+  // helper for ByteSizeLong()
+  size_t RequiredFieldsByteSizeFallback() const;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t > committedgaps_;
+    uint64_t sessnum_;
+    uint64_t view_;
+    uint64_t lastop_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_replication_2fnopaxos_2fnopaxos_2dproto_2eproto;
+};
+// -------------------------------------------------------------------
+
+class SyncPrepareReplyMessage final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:dsnet.nopaxos.proto.SyncPrepareReplyMessage) */ {
+ public:
+  inline SyncPrepareReplyMessage() : SyncPrepareReplyMessage(nullptr) {}
+  ~SyncPrepareReplyMessage() override;
+  explicit PROTOBUF_CONSTEXPR SyncPrepareReplyMessage(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  SyncPrepareReplyMessage(const SyncPrepareReplyMessage& from);
+  SyncPrepareReplyMessage(SyncPrepareReplyMessage&& from) noexcept
+    : SyncPrepareReplyMessage() {
+    *this = ::std::move(from);
+  }
+
+  inline SyncPrepareReplyMessage& operator=(const SyncPrepareReplyMessage& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline SyncPrepareReplyMessage& operator=(SyncPrepareReplyMessage&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const SyncPrepareReplyMessage& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const SyncPrepareReplyMessage* internal_default_instance() {
+    return reinterpret_cast<const SyncPrepareReplyMessage*>(
+               &_SyncPrepareReplyMessage_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    17;
+
+  friend void swap(SyncPrepareReplyMessage& a, SyncPrepareReplyMessage& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(SyncPrepareReplyMessage* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(SyncPrepareReplyMessage* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  SyncPrepareReplyMessage* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<SyncPrepareReplyMessage>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const SyncPrepareReplyMessage& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const SyncPrepareReplyMessage& from) {
+    SyncPrepareReplyMessage::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(SyncPrepareReplyMessage* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "dsnet.nopaxos.proto.SyncPrepareReplyMessage";
+  }
+  protected:
+  explicit SyncPrepareReplyMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kSessnumFieldNumber = 1,
+    kViewFieldNumber = 2,
+    kSyncpointFieldNumber = 3,
+    kReplicaidxFieldNumber = 4,
+  };
+  // required uint64 sessnum = 1;
+  bool has_sessnum() const;
+  private:
+  bool _internal_has_sessnum() const;
+  public:
+  void clear_sessnum();
+  uint64_t sessnum() const;
+  void set_sessnum(uint64_t value);
+  private:
+  uint64_t _internal_sessnum() const;
+  void _internal_set_sessnum(uint64_t value);
+  public:
+
+  // required uint64 view = 2;
+  bool has_view() const;
+  private:
+  bool _internal_has_view() const;
+  public:
+  void clear_view();
+  uint64_t view() const;
+  void set_view(uint64_t value);
+  private:
+  uint64_t _internal_view() const;
+  void _internal_set_view(uint64_t value);
+  public:
+
+  // required uint64 syncpoint = 3;
+  bool has_syncpoint() const;
+  private:
+  bool _internal_has_syncpoint() const;
+  public:
+  void clear_syncpoint();
+  uint64_t syncpoint() const;
+  void set_syncpoint(uint64_t value);
+  private:
+  uint64_t _internal_syncpoint() const;
+  void _internal_set_syncpoint(uint64_t value);
+  public:
+
+  // required uint32 replicaidx = 4;
+  bool has_replicaidx() const;
+  private:
+  bool _internal_has_replicaidx() const;
+  public:
+  void clear_replicaidx();
+  uint32_t replicaidx() const;
+  void set_replicaidx(uint32_t value);
+  private:
+  uint32_t _internal_replicaidx() const;
+  void _internal_set_replicaidx(uint32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:dsnet.nopaxos.proto.SyncPrepareReplyMessage)
+ private:
+  class _Internal;
+
+  // helper for ByteSizeLong()
+  size_t RequiredFieldsByteSizeFallback() const;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    uint64_t sessnum_;
+    uint64_t view_;
+    uint64_t syncpoint_;
+    uint32_t replicaidx_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_replication_2fnopaxos_2fnopaxos_2dproto_2eproto;
+};
+// -------------------------------------------------------------------
+
+class SyncCommitMessage final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:dsnet.nopaxos.proto.SyncCommitMessage) */ {
+ public:
+  inline SyncCommitMessage() : SyncCommitMessage(nullptr) {}
+  ~SyncCommitMessage() override;
+  explicit PROTOBUF_CONSTEXPR SyncCommitMessage(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  SyncCommitMessage(const SyncCommitMessage& from);
+  SyncCommitMessage(SyncCommitMessage&& from) noexcept
+    : SyncCommitMessage() {
+    *this = ::std::move(from);
+  }
+
+  inline SyncCommitMessage& operator=(const SyncCommitMessage& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline SyncCommitMessage& operator=(SyncCommitMessage&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const SyncCommitMessage& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const SyncCommitMessage* internal_default_instance() {
+    return reinterpret_cast<const SyncCommitMessage*>(
+               &_SyncCommitMessage_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    18;
+
+  friend void swap(SyncCommitMessage& a, SyncCommitMessage& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(SyncCommitMessage* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(SyncCommitMessage* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  SyncCommitMessage* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<SyncCommitMessage>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const SyncCommitMessage& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const SyncCommitMessage& from) {
+    SyncCommitMessage::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(SyncCommitMessage* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "dsnet.nopaxos.proto.SyncCommitMessage";
+  }
+  protected:
+  explicit SyncCommitMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kSessnumFieldNumber = 1,
+    kViewFieldNumber = 2,
+    kSyncpointFieldNumber = 3,
+  };
+  // required uint64 sessnum = 1;
+  bool has_sessnum() const;
+  private:
+  bool _internal_has_sessnum() const;
+  public:
+  void clear_sessnum();
+  uint64_t sessnum() const;
+  void set_sessnum(uint64_t value);
+  private:
+  uint64_t _internal_sessnum() const;
+  void _internal_set_sessnum(uint64_t value);
+  public:
+
+  // required uint64 view = 2;
+  bool has_view() const;
+  private:
+  bool _internal_has_view() const;
+  public:
+  void clear_view();
+  uint64_t view() const;
+  void set_view(uint64_t value);
+  private:
+  uint64_t _internal_view() const;
+  void _internal_set_view(uint64_t value);
+  public:
+
+  // required uint64 syncpoint = 3;
+  bool has_syncpoint() const;
+  private:
+  bool _internal_has_syncpoint() const;
+  public:
+  void clear_syncpoint();
+  uint64_t syncpoint() const;
+  void set_syncpoint(uint64_t value);
+  private:
+  uint64_t _internal_syncpoint() const;
+  void _internal_set_syncpoint(uint64_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:dsnet.nopaxos.proto.SyncCommitMessage)
+ private:
+  class _Internal;
+
+  // helper for ByteSizeLong()
+  size_t RequiredFieldsByteSizeFallback() const;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    uint64_t sessnum_;
+    uint64_t view_;
+    uint64_t syncpoint_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_replication_2fnopaxos_2fnopaxos_2dproto_2eproto;
+};
+// -------------------------------------------------------------------
+
+class ToReplicaMessage final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:dsnet.nopaxos.proto.ToReplicaMessage) */ {
+ public:
+  inline ToReplicaMessage() : ToReplicaMessage(nullptr) {}
+  ~ToReplicaMessage() override;
+  explicit PROTOBUF_CONSTEXPR ToReplicaMessage(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  ToReplicaMessage(const ToReplicaMessage& from);
+  ToReplicaMessage(ToReplicaMessage&& from) noexcept
+    : ToReplicaMessage() {
+    *this = ::std::move(from);
+  }
+
+  inline ToReplicaMessage& operator=(const ToReplicaMessage& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline ToReplicaMessage& operator=(ToReplicaMessage&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ToReplicaMessage& default_instance() {
+    return *internal_default_instance();
+  }
+  enum MsgCase {
+    kRequest = 1,
+    kUnloggedRequest = 2,
+    kGapRequest = 3,
+    kGapReply = 4,
+    kStateTransferRequest = 5,
+    kStateTransferReply = 6,
+    kGapCommit = 7,
+    kGapCommitReply = 8,
+    kViewChangeRequest = 9,
+    kViewChange = 10,
+    kStartView = 11,
+    kStartViewReply = 12,
+    kSyncPrepareRequest = 13,
+    kSyncPrepare = 14,
+    kSyncPrepareReply = 15,
+    kSyncCommit = 16,
+    MSG_NOT_SET = 0,
+  };
+
+  static inline const ToReplicaMessage* internal_default_instance() {
+    return reinterpret_cast<const ToReplicaMessage*>(
+               &_ToReplicaMessage_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    19;
+
+  friend void swap(ToReplicaMessage& a, ToReplicaMessage& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(ToReplicaMessage* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ToReplicaMessage* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  ToReplicaMessage* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ToReplicaMessage>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const ToReplicaMessage& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ToReplicaMessage& from) {
+    ToReplicaMessage::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(ToReplicaMessage* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "dsnet.nopaxos.proto.ToReplicaMessage";
+  }
+  protected:
+  explicit ToReplicaMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kRequestFieldNumber = 1,
+    kUnloggedRequestFieldNumber = 2,
+    kGapRequestFieldNumber = 3,
+    kGapReplyFieldNumber = 4,
+    kStateTransferRequestFieldNumber = 5,
+    kStateTransferReplyFieldNumber = 6,
+    kGapCommitFieldNumber = 7,
+    kGapCommitReplyFieldNumber = 8,
+    kViewChangeRequestFieldNumber = 9,
+    kViewChangeFieldNumber = 10,
+    kStartViewFieldNumber = 11,
+    kStartViewReplyFieldNumber = 12,
+    kSyncPrepareRequestFieldNumber = 13,
+    kSyncPrepareFieldNumber = 14,
+    kSyncPrepareReplyFieldNumber = 15,
+    kSyncCommitFieldNumber = 16,
+  };
+  // .dsnet.nopaxos.proto.RequestMessage request = 1;
+  bool has_request() const;
+  private:
+  bool _internal_has_request() const;
+  public:
+  void clear_request();
+  const ::dsnet::nopaxos::proto::RequestMessage& request() const;
+  PROTOBUF_NODISCARD ::dsnet::nopaxos::proto::RequestMessage* release_request();
+  ::dsnet::nopaxos::proto::RequestMessage* mutable_request();
+  void set_allocated_request(::dsnet::nopaxos::proto::RequestMessage* request);
+  private:
+  const ::dsnet::nopaxos::proto::RequestMessage& _internal_request() const;
+  ::dsnet::nopaxos::proto::RequestMessage* _internal_mutable_request();
+  public:
+  void unsafe_arena_set_allocated_request(
+      ::dsnet::nopaxos::proto::RequestMessage* request);
+  ::dsnet::nopaxos::proto::RequestMessage* unsafe_arena_release_request();
+
+  // .dsnet.nopaxos.proto.UnloggedRequestMessage unlogged_request = 2;
+  bool has_unlogged_request() const;
+  private:
+  bool _internal_has_unlogged_request() const;
+  public:
+  void clear_unlogged_request();
+  const ::dsnet::nopaxos::proto::UnloggedRequestMessage& unlogged_request() const;
+  PROTOBUF_NODISCARD ::dsnet::nopaxos::proto::UnloggedRequestMessage* release_unlogged_request();
+  ::dsnet::nopaxos::proto::UnloggedRequestMessage* mutable_unlogged_request();
+  void set_allocated_unlogged_request(::dsnet::nopaxos::proto::UnloggedRequestMessage* unlogged_request);
+  private:
+  const ::dsnet::nopaxos::proto::UnloggedRequestMessage& _internal_unlogged_request() const;
+  ::dsnet::nopaxos::proto::UnloggedRequestMessage* _internal_mutable_unlogged_request();
+  public:
+  void unsafe_arena_set_allocated_unlogged_request(
+      ::dsnet::nopaxos::proto::UnloggedRequestMessage* unlogged_request);
+  ::dsnet::nopaxos::proto::UnloggedRequestMessage* unsafe_arena_release_unlogged_request();
+
+  // .dsnet.nopaxos.proto.GapRequestMessage gap_request = 3;
+  bool has_gap_request() const;
+  private:
+  bool _internal_has_gap_request() const;
+  public:
+  void clear_gap_request();
+  const ::dsnet::nopaxos::proto::GapRequestMessage& gap_request() const;
+  PROTOBUF_NODISCARD ::dsnet::nopaxos::proto::GapRequestMessage* release_gap_request();
+  ::dsnet::nopaxos::proto::GapRequestMessage* mutable_gap_request();
+  void set_allocated_gap_request(::dsnet::nopaxos::proto::GapRequestMessage* gap_request);
+  private:
+  const ::dsnet::nopaxos::proto::GapRequestMessage& _internal_gap_request() const;
+  ::dsnet::nopaxos::proto::GapRequestMessage* _internal_mutable_gap_request();
+  public:
+  void unsafe_arena_set_allocated_gap_request(
+      ::dsnet::nopaxos::proto::GapRequestMessage* gap_request);
+  ::dsnet::nopaxos::proto::GapRequestMessage* unsafe_arena_release_gap_request();
+
+  // .dsnet.nopaxos.proto.GapReplyMessage gap_reply = 4;
+  bool has_gap_reply() const;
+  private:
+  bool _internal_has_gap_reply() const;
+  public:
+  void clear_gap_reply();
+  const ::dsnet::nopaxos::proto::GapReplyMessage& gap_reply() const;
+  PROTOBUF_NODISCARD ::dsnet::nopaxos::proto::GapReplyMessage* release_gap_reply();
+  ::dsnet::nopaxos::proto::GapReplyMessage* mutable_gap_reply();
+  void set_allocated_gap_reply(::dsnet::nopaxos::proto::GapReplyMessage* gap_reply);
+  private:
+  const ::dsnet::nopaxos::proto::GapReplyMessage& _internal_gap_reply() const;
+  ::dsnet::nopaxos::proto::GapReplyMessage* _internal_mutable_gap_reply();
+  public:
+  void unsafe_arena_set_allocated_gap_reply(
+      ::dsnet::nopaxos::proto::GapReplyMessage* gap_reply);
+  ::dsnet::nopaxos::proto::GapReplyMessage* unsafe_arena_release_gap_reply();
+
+  // .dsnet.nopaxos.proto.StateTransferRequestMessage state_transfer_request = 5;
+  bool has_state_transfer_request() const;
+  private:
+  bool _internal_has_state_transfer_request() const;
+  public:
+  void clear_state_transfer_request();
+  const ::dsnet::nopaxos::proto::StateTransferRequestMessage& state_transfer_request() const;
+  PROTOBUF_NODISCARD ::dsnet::nopaxos::proto::StateTransferRequestMessage* release_state_transfer_request();
+  ::dsnet::nopaxos::proto::StateTransferRequestMessage* mutable_state_transfer_request();
+  void set_allocated_state_transfer_request(::dsnet::nopaxos::proto::StateTransferRequestMessage* state_transfer_request);
+  private:
+  const ::dsnet::nopaxos::proto::StateTransferRequestMessage& _internal_state_transfer_request() const;
+  ::dsnet::nopaxos::proto::StateTransferRequestMessage* _internal_mutable_state_transfer_request();
+  public:
+  void unsafe_arena_set_allocated_state_transfer_request(
+      ::dsnet::nopaxos::proto::StateTransferRequestMessage* state_transfer_request);
+  ::dsnet::nopaxos::proto::StateTransferRequestMessage* unsafe_arena_release_state_transfer_request();
+
+  // .dsnet.nopaxos.proto.StateTransferReplyMessage state_transfer_reply = 6;
+  bool has_state_transfer_reply() const;
+  private:
+  bool _internal_has_state_transfer_reply() const;
+  public:
+  void clear_state_transfer_reply();
+  const ::dsnet::nopaxos::proto::StateTransferReplyMessage& state_transfer_reply() const;
+  PROTOBUF_NODISCARD ::dsnet::nopaxos::proto::StateTransferReplyMessage* release_state_transfer_reply();
+  ::dsnet::nopaxos::proto::StateTransferReplyMessage* mutable_state_transfer_reply();
+  void set_allocated_state_transfer_reply(::dsnet::nopaxos::proto::StateTransferReplyMessage* state_transfer_reply);
+  private:
+  const ::dsnet::nopaxos::proto::StateTransferReplyMessage& _internal_state_transfer_reply() const;
+  ::dsnet::nopaxos::proto::StateTransferReplyMessage* _internal_mutable_state_transfer_reply();
+  public:
+  void unsafe_arena_set_allocated_state_transfer_reply(
+      ::dsnet::nopaxos::proto::StateTransferReplyMessage* state_transfer_reply);
+  ::dsnet::nopaxos::proto::StateTransferReplyMessage* unsafe_arena_release_state_transfer_reply();
+
+  // .dsnet.nopaxos.proto.GapCommitMessage gap_commit = 7;
+  bool has_gap_commit() const;
+  private:
+  bool _internal_has_gap_commit() const;
+  public:
+  void clear_gap_commit();
+  const ::dsnet::nopaxos::proto::GapCommitMessage& gap_commit() const;
+  PROTOBUF_NODISCARD ::dsnet::nopaxos::proto::GapCommitMessage* release_gap_commit();
+  ::dsnet::nopaxos::proto::GapCommitMessage* mutable_gap_commit();
+  void set_allocated_gap_commit(::dsnet::nopaxos::proto::GapCommitMessage* gap_commit);
+  private:
+  const ::dsnet::nopaxos::proto::GapCommitMessage& _internal_gap_commit() const;
+  ::dsnet::nopaxos::proto::GapCommitMessage* _internal_mutable_gap_commit();
+  public:
+  void unsafe_arena_set_allocated_gap_commit(
+      ::dsnet::nopaxos::proto::GapCommitMessage* gap_commit);
+  ::dsnet::nopaxos::proto::GapCommitMessage* unsafe_arena_release_gap_commit();
+
+  // .dsnet.nopaxos.proto.GapCommitReplyMessage gap_commit_reply = 8;
+  bool has_gap_commit_reply() const;
+  private:
+  bool _internal_has_gap_commit_reply() const;
+  public:
+  void clear_gap_commit_reply();
+  const ::dsnet::nopaxos::proto::GapCommitReplyMessage& gap_commit_reply() const;
+  PROTOBUF_NODISCARD ::dsnet::nopaxos::proto::GapCommitReplyMessage* release_gap_commit_reply();
+  ::dsnet::nopaxos::proto::GapCommitReplyMessage* mutable_gap_commit_reply();
+  void set_allocated_gap_commit_reply(::dsnet::nopaxos::proto::GapCommitReplyMessage* gap_commit_reply);
+  private:
+  const ::dsnet::nopaxos::proto::GapCommitReplyMessage& _internal_gap_commit_reply() const;
+  ::dsnet::nopaxos::proto::GapCommitReplyMessage* _internal_mutable_gap_commit_reply();
+  public:
+  void unsafe_arena_set_allocated_gap_commit_reply(
+      ::dsnet::nopaxos::proto::GapCommitReplyMessage* gap_commit_reply);
+  ::dsnet::nopaxos::proto::GapCommitReplyMessage* unsafe_arena_release_gap_commit_reply();
+
+  // .dsnet.nopaxos.proto.ViewChangeRequestMessage view_change_request = 9;
+  bool has_view_change_request() const;
+  private:
+  bool _internal_has_view_change_request() const;
+  public:
+  void clear_view_change_request();
+  const ::dsnet::nopaxos::proto::ViewChangeRequestMessage& view_change_request() const;
+  PROTOBUF_NODISCARD ::dsnet::nopaxos::proto::ViewChangeRequestMessage* release_view_change_request();
+  ::dsnet::nopaxos::proto::ViewChangeRequestMessage* mutable_view_change_request();
+  void set_allocated_view_change_request(::dsnet::nopaxos::proto::ViewChangeRequestMessage* view_change_request);
+  private:
+  const ::dsnet::nopaxos::proto::ViewChangeRequestMessage& _internal_view_change_request() const;
+  ::dsnet::nopaxos::proto::ViewChangeRequestMessage* _internal_mutable_view_change_request();
+  public:
+  void unsafe_arena_set_allocated_view_change_request(
+      ::dsnet::nopaxos::proto::ViewChangeRequestMessage* view_change_request);
+  ::dsnet::nopaxos::proto::ViewChangeRequestMessage* unsafe_arena_release_view_change_request();
+
+  // .dsnet.nopaxos.proto.ViewChangeMessage view_change = 10;
+  bool has_view_change() const;
+  private:
+  bool _internal_has_view_change() const;
+  public:
+  void clear_view_change();
+  const ::dsnet::nopaxos::proto::ViewChangeMessage& view_change() const;
+  PROTOBUF_NODISCARD ::dsnet::nopaxos::proto::ViewChangeMessage* release_view_change();
+  ::dsnet::nopaxos::proto::ViewChangeMessage* mutable_view_change();
+  void set_allocated_view_change(::dsnet::nopaxos::proto::ViewChangeMessage* view_change);
+  private:
+  const ::dsnet::nopaxos::proto::ViewChangeMessage& _internal_view_change() const;
+  ::dsnet::nopaxos::proto::ViewChangeMessage* _internal_mutable_view_change();
+  public:
+  void unsafe_arena_set_allocated_view_change(
+      ::dsnet::nopaxos::proto::ViewChangeMessage* view_change);
+  ::dsnet::nopaxos::proto::ViewChangeMessage* unsafe_arena_release_view_change();
+
+  // .dsnet.nopaxos.proto.StartViewMessage start_view = 11;
+  bool has_start_view() const;
+  private:
+  bool _internal_has_start_view() const;
+  public:
+  void clear_start_view();
+  const ::dsnet::nopaxos::proto::StartViewMessage& start_view() const;
+  PROTOBUF_NODISCARD ::dsnet::nopaxos::proto::StartViewMessage* release_start_view();
+  ::dsnet::nopaxos::proto::StartViewMessage* mutable_start_view();
+  void set_allocated_start_view(::dsnet::nopaxos::proto::StartViewMessage* start_view);
+  private:
+  const ::dsnet::nopaxos::proto::StartViewMessage& _internal_start_view() const;
+  ::dsnet::nopaxos::proto::StartViewMessage* _internal_mutable_start_view();
+  public:
+  void unsafe_arena_set_allocated_start_view(
+      ::dsnet::nopaxos::proto::StartViewMessage* start_view);
+  ::dsnet::nopaxos::proto::StartViewMessage* unsafe_arena_release_start_view();
+
+  // .dsnet.nopaxos.proto.StartViewReplyMessage start_view_reply = 12;
+  bool has_start_view_reply() const;
+  private:
+  bool _internal_has_start_view_reply() const;
+  public:
+  void clear_start_view_reply();
+  const ::dsnet::nopaxos::proto::StartViewReplyMessage& start_view_reply() const;
+  PROTOBUF_NODISCARD ::dsnet::nopaxos::proto::StartViewReplyMessage* release_start_view_reply();
+  ::dsnet::nopaxos::proto::StartViewReplyMessage* mutable_start_view_reply();
+  void set_allocated_start_view_reply(::dsnet::nopaxos::proto::StartViewReplyMessage* start_view_reply);
+  private:
+  const ::dsnet::nopaxos::proto::StartViewReplyMessage& _internal_start_view_reply() const;
+  ::dsnet::nopaxos::proto::StartViewReplyMessage* _internal_mutable_start_view_reply();
+  public:
+  void unsafe_arena_set_allocated_start_view_reply(
+      ::dsnet::nopaxos::proto::StartViewReplyMessage* start_view_reply);
+  ::dsnet::nopaxos::proto::StartViewReplyMessage* unsafe_arena_release_start_view_reply();
+
+  // .dsnet.nopaxos.proto.SyncPrepareRequestMessage sync_prepare_request = 13;
+  bool has_sync_prepare_request() const;
+  private:
+  bool _internal_has_sync_prepare_request() const;
+  public:
+  void clear_sync_prepare_request();
+  const ::dsnet::nopaxos::proto::SyncPrepareRequestMessage& sync_prepare_request() const;
+  PROTOBUF_NODISCARD ::dsnet::nopaxos::proto::SyncPrepareRequestMessage* release_sync_prepare_request();
+  ::dsnet::nopaxos::proto::SyncPrepareRequestMessage* mutable_sync_prepare_request();
+  void set_allocated_sync_prepare_request(::dsnet::nopaxos::proto::SyncPrepareRequestMessage* sync_prepare_request);
+  private:
+  const ::dsnet::nopaxos::proto::SyncPrepareRequestMessage& _internal_sync_prepare_request() const;
+  ::dsnet::nopaxos::proto::SyncPrepareRequestMessage* _internal_mutable_sync_prepare_request();
+  public:
+  void unsafe_arena_set_allocated_sync_prepare_request(
+      ::dsnet::nopaxos::proto::SyncPrepareRequestMessage* sync_prepare_request);
+  ::dsnet::nopaxos::proto::SyncPrepareRequestMessage* unsafe_arena_release_sync_prepare_request();
+
+  // .dsnet.nopaxos.proto.SyncPrepareMessage sync_prepare = 14;
+  bool has_sync_prepare() const;
+  private:
+  bool _internal_has_sync_prepare() const;
+  public:
+  void clear_sync_prepare();
+  const ::dsnet::nopaxos::proto::SyncPrepareMessage& sync_prepare() const;
+  PROTOBUF_NODISCARD ::dsnet::nopaxos::proto::SyncPrepareMessage* release_sync_prepare();
+  ::dsnet::nopaxos::proto::SyncPrepareMessage* mutable_sync_prepare();
+  void set_allocated_sync_prepare(::dsnet::nopaxos::proto::SyncPrepareMessage* sync_prepare);
+  private:
+  const ::dsnet::nopaxos::proto::SyncPrepareMessage& _internal_sync_prepare() const;
+  ::dsnet::nopaxos::proto::SyncPrepareMessage* _internal_mutable_sync_prepare();
+  public:
+  void unsafe_arena_set_allocated_sync_prepare(
+      ::dsnet::nopaxos::proto::SyncPrepareMessage* sync_prepare);
+  ::dsnet::nopaxos::proto::SyncPrepareMessage* unsafe_arena_release_sync_prepare();
+
+  // .dsnet.nopaxos.proto.SyncPrepareReplyMessage sync_prepare_reply = 15;
+  bool has_sync_prepare_reply() const;
+  private:
+  bool _internal_has_sync_prepare_reply() const;
+  public:
+  void clear_sync_prepare_reply();
+  const ::dsnet::nopaxos::proto::SyncPrepareReplyMessage& sync_prepare_reply() const;
+  PROTOBUF_NODISCARD ::dsnet::nopaxos::proto::SyncPrepareReplyMessage* release_sync_prepare_reply();
+  ::dsnet::nopaxos::proto::SyncPrepareReplyMessage* mutable_sync_prepare_reply();
+  void set_allocated_sync_prepare_reply(::dsnet::nopaxos::proto::SyncPrepareReplyMessage* sync_prepare_reply);
+  private:
+  const ::dsnet::nopaxos::proto::SyncPrepareReplyMessage& _internal_sync_prepare_reply() const;
+  ::dsnet::nopaxos::proto::SyncPrepareReplyMessage* _internal_mutable_sync_prepare_reply();
+  public:
+  void unsafe_arena_set_allocated_sync_prepare_reply(
+      ::dsnet::nopaxos::proto::SyncPrepareReplyMessage* sync_prepare_reply);
+  ::dsnet::nopaxos::proto::SyncPrepareReplyMessage* unsafe_arena_release_sync_prepare_reply();
+
+  // .dsnet.nopaxos.proto.SyncCommitMessage sync_commit = 16;
+  bool has_sync_commit() const;
+  private:
+  bool _internal_has_sync_commit() const;
+  public:
+  void clear_sync_commit();
+  const ::dsnet::nopaxos::proto::SyncCommitMessage& sync_commit() const;
+  PROTOBUF_NODISCARD ::dsnet::nopaxos::proto::SyncCommitMessage* release_sync_commit();
+  ::dsnet::nopaxos::proto::SyncCommitMessage* mutable_sync_commit();
+  void set_allocated_sync_commit(::dsnet::nopaxos::proto::SyncCommitMessage* sync_commit);
+  private:
+  const ::dsnet::nopaxos::proto::SyncCommitMessage& _internal_sync_commit() const;
+  ::dsnet::nopaxos::proto::SyncCommitMessage* _internal_mutable_sync_commit();
+  public:
+  void unsafe_arena_set_allocated_sync_commit(
+      ::dsnet::nopaxos::proto::SyncCommitMessage* sync_commit);
+  ::dsnet::nopaxos::proto::SyncCommitMessage* unsafe_arena_release_sync_commit();
+
+  void clear_msg();
+  MsgCase msg_case() const;
+  // @@protoc_insertion_point(class_scope:dsnet.nopaxos.proto.ToReplicaMessage)
+ private:
+  class _Internal;
+  void set_has_request();
+  void set_has_unlogged_request();
+  void set_has_gap_request();
+  void set_has_gap_reply();
+  void set_has_state_transfer_request();
+  void set_has_state_transfer_reply();
+  void set_has_gap_commit();
+  void set_has_gap_commit_reply();
+  void set_has_view_change_request();
+  void set_has_view_change();
+  void set_has_start_view();
+  void set_has_start_view_reply();
+  void set_has_sync_prepare_request();
+  void set_has_sync_prepare();
+  void set_has_sync_prepare_reply();
+  void set_has_sync_commit();
+
+  inline bool has_msg() const;
+  inline void clear_has_msg();
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    union MsgUnion {
+      constexpr MsgUnion() : _constinit_{} {}
+        ::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized _constinit_;
+      ::dsnet::nopaxos::proto::RequestMessage* request_;
+      ::dsnet::nopaxos::proto::UnloggedRequestMessage* unlogged_request_;
+      ::dsnet::nopaxos::proto::GapRequestMessage* gap_request_;
+      ::dsnet::nopaxos::proto::GapReplyMessage* gap_reply_;
+      ::dsnet::nopaxos::proto::StateTransferRequestMessage* state_transfer_request_;
+      ::dsnet::nopaxos::proto::StateTransferReplyMessage* state_transfer_reply_;
+      ::dsnet::nopaxos::proto::GapCommitMessage* gap_commit_;
+      ::dsnet::nopaxos::proto::GapCommitReplyMessage* gap_commit_reply_;
+      ::dsnet::nopaxos::proto::ViewChangeRequestMessage* view_change_request_;
+      ::dsnet::nopaxos::proto::ViewChangeMessage* view_change_;
+      ::dsnet::nopaxos::proto::StartViewMessage* start_view_;
+      ::dsnet::nopaxos::proto::StartViewReplyMessage* start_view_reply_;
+      ::dsnet::nopaxos::proto::SyncPrepareRequestMessage* sync_prepare_request_;
+      ::dsnet::nopaxos::proto::SyncPrepareMessage* sync_prepare_;
+      ::dsnet::nopaxos::proto::SyncPrepareReplyMessage* sync_prepare_reply_;
+      ::dsnet::nopaxos::proto::SyncCommitMessage* sync_commit_;
+    } msg_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    uint32_t _oneof_case_[1];
+
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_replication_2fnopaxos_2fnopaxos_2dproto_2eproto;
+};
+// ===================================================================
+
+
+// ===================================================================
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
+#endif  // __GNUC__
+// ReplyMessage
+
+// required uint64 view = 1;
+inline bool ReplyMessage::_internal_has_view() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool ReplyMessage::has_view() const {
+  return _internal_has_view();
+}
+inline void ReplyMessage::clear_view() {
+  _impl_.view_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline uint64_t ReplyMessage::_internal_view() const {
+  return _impl_.view_;
+}
+inline uint64_t ReplyMessage::view() const {
+  // @@protoc_insertion_point(field_get:dsnet.nopaxos.proto.ReplyMessage.view)
+  return _internal_view();
+}
+inline void ReplyMessage::_internal_set_view(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.view_ = value;
+}
+inline void ReplyMessage::set_view(uint64_t value) {
+  _internal_set_view(value);
+  // @@protoc_insertion_point(field_set:dsnet.nopaxos.proto.ReplyMessage.view)
+}
+
+// required uint64 sessnum = 2;
+inline bool ReplyMessage::_internal_has_sessnum() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool ReplyMessage::has_sessnum() const {
+  return _internal_has_sessnum();
+}
+inline void ReplyMessage::clear_sessnum() {
+  _impl_.sessnum_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline uint64_t ReplyMessage::_internal_sessnum() const {
+  return _impl_.sessnum_;
+}
+inline uint64_t ReplyMessage::sessnum() const {
+  // @@protoc_insertion_point(field_get:dsnet.nopaxos.proto.ReplyMessage.sessnum)
+  return _internal_sessnum();
+}
+inline void ReplyMessage::_internal_set_sessnum(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.sessnum_ = value;
+}
+inline void ReplyMessage::set_sessnum(uint64_t value) {
+  _internal_set_sessnum(value);
+  // @@protoc_insertion_point(field_set:dsnet.nopaxos.proto.ReplyMessage.sessnum)
+}
+
+// required uint64 opnum = 3;
+inline bool ReplyMessage::_internal_has_opnum() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  return value;
+}
+inline bool ReplyMessage::has_opnum() const {
+  return _internal_has_opnum();
+}
+inline void ReplyMessage::clear_opnum() {
+  _impl_.opnum_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000008u;
+}
+inline uint64_t ReplyMessage::_internal_opnum() const {
+  return _impl_.opnum_;
+}
+inline uint64_t ReplyMessage::opnum() const {
+  // @@protoc_insertion_point(field_get:dsnet.nopaxos.proto.ReplyMessage.opnum)
+  return _internal_opnum();
+}
+inline void ReplyMessage::_internal_set_opnum(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  _impl_.opnum_ = value;
+}
+inline void ReplyMessage::set_opnum(uint64_t value) {
+  _internal_set_opnum(value);
+  // @@protoc_insertion_point(field_set:dsnet.nopaxos.proto.ReplyMessage.opnum)
+}
+
+// required uint64 clientreqid = 4;
+inline bool ReplyMessage::_internal_has_clientreqid() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000010u) != 0;
+  return value;
+}
+inline bool ReplyMessage::has_clientreqid() const {
+  return _internal_has_clientreqid();
+}
+inline void ReplyMessage::clear_clientreqid() {
+  _impl_.clientreqid_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000010u;
+}
+inline uint64_t ReplyMessage::_internal_clientreqid() const {
+  return _impl_.clientreqid_;
+}
+inline uint64_t ReplyMessage::clientreqid() const {
+  // @@protoc_insertion_point(field_get:dsnet.nopaxos.proto.ReplyMessage.clientreqid)
+  return _internal_clientreqid();
+}
+inline void ReplyMessage::_internal_set_clientreqid(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000010u;
+  _impl_.clientreqid_ = value;
+}
+inline void ReplyMessage::set_clientreqid(uint64_t value) {
+  _internal_set_clientreqid(value);
+  // @@protoc_insertion_point(field_set:dsnet.nopaxos.proto.ReplyMessage.clientreqid)
+}
+
+// required uint32 replicaidx = 5;
+inline bool ReplyMessage::_internal_has_replicaidx() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000020u) != 0;
+  return value;
+}
+inline bool ReplyMessage::has_replicaidx() const {
+  return _internal_has_replicaidx();
+}
+inline void ReplyMessage::clear_replicaidx() {
+  _impl_.replicaidx_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000020u;
+}
+inline uint32_t ReplyMessage::_internal_replicaidx() const {
+  return _impl_.replicaidx_;
+}
+inline uint32_t ReplyMessage::replicaidx() const {
+  // @@protoc_insertion_point(field_get:dsnet.nopaxos.proto.ReplyMessage.replicaidx)
+  return _internal_replicaidx();
+}
+inline void ReplyMessage::_internal_set_replicaidx(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000020u;
+  _impl_.replicaidx_ = value;
+}
+inline void ReplyMessage::set_replicaidx(uint32_t value) {
+  _internal_set_replicaidx(value);
+  // @@protoc_insertion_point(field_set:dsnet.nopaxos.proto.ReplyMessage.replicaidx)
+}
+
+// optional bytes reply = 6;
+inline bool ReplyMessage::_internal_has_reply() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool ReplyMessage::has_reply() const {
+  return _internal_has_reply();
+}
+inline void ReplyMessage::clear_reply() {
+  _impl_.reply_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& ReplyMessage::reply() const {
+  // @@protoc_insertion_point(field_get:dsnet.nopaxos.proto.ReplyMessage.reply)
+  return _internal_reply();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void ReplyMessage::set_reply(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.reply_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:dsnet.nopaxos.proto.ReplyMessage.reply)
+}
+inline std::string* ReplyMessage::mutable_reply() {
+  std::string* _s = _internal_mutable_reply();
+  // @@protoc_insertion_point(field_mutable:dsnet.nopaxos.proto.ReplyMessage.reply)
+  return _s;
+}
+inline const std::string& ReplyMessage::_internal_reply() const {
+  return _impl_.reply_.Get();
+}
+inline void ReplyMessage::_internal_set_reply(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.reply_.Set(value, GetArenaForAllocation());
+}
+inline std::string* ReplyMessage::_internal_mutable_reply() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.reply_.Mutable(GetArenaForAllocation());
+}
+inline std::string* ReplyMessage::release_reply() {
+  // @@protoc_insertion_point(field_release:dsnet.nopaxos.proto.ReplyMessage.reply)
+  if (!_internal_has_reply()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.reply_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.reply_.IsDefault()) {
+    _impl_.reply_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void ReplyMessage::set_allocated_reply(std::string* reply) {
+  if (reply != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.reply_.SetAllocated(reply, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.reply_.IsDefault()) {
+    _impl_.reply_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:dsnet.nopaxos.proto.ReplyMessage.reply)
+}
+
+// -------------------------------------------------------------------
+
+// UnloggedReplyMessage
+
+// required bytes reply = 1;
+inline bool UnloggedReplyMessage::_internal_has_reply() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool UnloggedReplyMessage::has_reply() const {
+  return _internal_has_reply();
+}
+inline void UnloggedReplyMessage::clear_reply() {
+  _impl_.reply_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& UnloggedReplyMessage::reply() const {
+  // @@protoc_insertion_point(field_get:dsnet.nopaxos.proto.UnloggedReplyMessage.reply)
+  return _internal_reply();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void UnloggedReplyMessage::set_reply(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.reply_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:dsnet.nopaxos.proto.UnloggedReplyMessage.reply)
+}
+inline std::string* UnloggedReplyMessage::mutable_reply() {
+  std::string* _s = _internal_mutable_reply();
+  // @@protoc_insertion_point(field_mutable:dsnet.nopaxos.proto.UnloggedReplyMessage.reply)
+  return _s;
+}
+inline const std::string& UnloggedReplyMessage::_internal_reply() const {
+  return _impl_.reply_.Get();
+}
+inline void UnloggedReplyMessage::_internal_set_reply(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.reply_.Set(value, GetArenaForAllocation());
+}
+inline std::string* UnloggedReplyMessage::_internal_mutable_reply() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.reply_.Mutable(GetArenaForAllocation());
+}
+inline std::string* UnloggedReplyMessage::release_reply() {
+  // @@protoc_insertion_point(field_release:dsnet.nopaxos.proto.UnloggedReplyMessage.reply)
+  if (!_internal_has_reply()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.reply_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.reply_.IsDefault()) {
+    _impl_.reply_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void UnloggedReplyMessage::set_allocated_reply(std::string* reply) {
+  if (reply != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.reply_.SetAllocated(reply, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.reply_.IsDefault()) {
+    _impl_.reply_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:dsnet.nopaxos.proto.UnloggedReplyMessage.reply)
+}
+
+// -------------------------------------------------------------------
+
+// ToClientMessage
+
+// .dsnet.nopaxos.proto.ReplyMessage reply = 1;
+inline bool ToClientMessage::_internal_has_reply() const {
+  return msg_case() == kReply;
+}
+inline bool ToClientMessage::has_reply() const {
+  return _internal_has_reply();
+}
+inline void ToClientMessage::set_has_reply() {
+  _impl_._oneof_case_[0] = kReply;
+}
+inline void ToClientMessage::clear_reply() {
+  if (_internal_has_reply()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.msg_.reply_;
+    }
+    clear_has_msg();
+  }
+}
+inline ::dsnet::nopaxos::proto::ReplyMessage* ToClientMessage::release_reply() {
+  // @@protoc_insertion_point(field_release:dsnet.nopaxos.proto.ToClientMessage.reply)
+  if (_internal_has_reply()) {
+    clear_has_msg();
+    ::dsnet::nopaxos::proto::ReplyMessage* temp = _impl_.msg_.reply_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.msg_.reply_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::dsnet::nopaxos::proto::ReplyMessage& ToClientMessage::_internal_reply() const {
+  return _internal_has_reply()
+      ? *_impl_.msg_.reply_
+      : reinterpret_cast< ::dsnet::nopaxos::proto::ReplyMessage&>(::dsnet::nopaxos::proto::_ReplyMessage_default_instance_);
+}
+inline const ::dsnet::nopaxos::proto::ReplyMessage& ToClientMessage::reply() const {
+  // @@protoc_insertion_point(field_get:dsnet.nopaxos.proto.ToClientMessage.reply)
+  return _internal_reply();
+}
+inline ::dsnet::nopaxos::proto::ReplyMessage* ToClientMessage::unsafe_arena_release_reply() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:dsnet.nopaxos.proto.ToClientMessage.reply)
+  if (_internal_has_reply()) {
+    clear_has_msg();
+    ::dsnet::nopaxos::proto::ReplyMessage* temp = _impl_.msg_.reply_;
+    _impl_.msg_.reply_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void ToClientMessage::unsafe_arena_set_allocated_reply(::dsnet::nopaxos::proto::ReplyMessage* reply) {
+  clear_msg();
+  if (reply) {
+    set_has_reply();
+    _impl_.msg_.reply_ = reply;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:dsnet.nopaxos.proto.ToClientMessage.reply)
+}
+inline ::dsnet::nopaxos::proto::ReplyMessage* ToClientMessage::_internal_mutable_reply() {
+  if (!_internal_has_reply()) {
+    clear_msg();
+    set_has_reply();
+    _impl_.msg_.reply_ = CreateMaybeMessage< ::dsnet::nopaxos::proto::ReplyMessage >(GetArenaForAllocation());
+  }
+  return _impl_.msg_.reply_;
+}
+inline ::dsnet::nopaxos::proto::ReplyMessage* ToClientMessage::mutable_reply() {
+  ::dsnet::nopaxos::proto::ReplyMessage* _msg = _internal_mutable_reply();
+  // @@protoc_insertion_point(field_mutable:dsnet.nopaxos.proto.ToClientMessage.reply)
+  return _msg;
+}
+
+// .dsnet.nopaxos.proto.UnloggedReplyMessage unlogged_reply = 2;
+inline bool ToClientMessage::_internal_has_unlogged_reply() const {
+  return msg_case() == kUnloggedReply;
+}
+inline bool ToClientMessage::has_unlogged_reply() const {
+  return _internal_has_unlogged_reply();
+}
+inline void ToClientMessage::set_has_unlogged_reply() {
+  _impl_._oneof_case_[0] = kUnloggedReply;
+}
+inline void ToClientMessage::clear_unlogged_reply() {
+  if (_internal_has_unlogged_reply()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.msg_.unlogged_reply_;
+    }
+    clear_has_msg();
+  }
+}
+inline ::dsnet::nopaxos::proto::UnloggedReplyMessage* ToClientMessage::release_unlogged_reply() {
+  // @@protoc_insertion_point(field_release:dsnet.nopaxos.proto.ToClientMessage.unlogged_reply)
+  if (_internal_has_unlogged_reply()) {
+    clear_has_msg();
+    ::dsnet::nopaxos::proto::UnloggedReplyMessage* temp = _impl_.msg_.unlogged_reply_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.msg_.unlogged_reply_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::dsnet::nopaxos::proto::UnloggedReplyMessage& ToClientMessage::_internal_unlogged_reply() const {
+  return _internal_has_unlogged_reply()
+      ? *_impl_.msg_.unlogged_reply_
+      : reinterpret_cast< ::dsnet::nopaxos::proto::UnloggedReplyMessage&>(::dsnet::nopaxos::proto::_UnloggedReplyMessage_default_instance_);
+}
+inline const ::dsnet::nopaxos::proto::UnloggedReplyMessage& ToClientMessage::unlogged_reply() const {
+  // @@protoc_insertion_point(field_get:dsnet.nopaxos.proto.ToClientMessage.unlogged_reply)
+  return _internal_unlogged_reply();
+}
+inline ::dsnet::nopaxos::proto::UnloggedReplyMessage* ToClientMessage::unsafe_arena_release_unlogged_reply() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:dsnet.nopaxos.proto.ToClientMessage.unlogged_reply)
+  if (_internal_has_unlogged_reply()) {
+    clear_has_msg();
+    ::dsnet::nopaxos::proto::UnloggedReplyMessage* temp = _impl_.msg_.unlogged_reply_;
+    _impl_.msg_.unlogged_reply_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void ToClientMessage::unsafe_arena_set_allocated_unlogged_reply(::dsnet::nopaxos::proto::UnloggedReplyMessage* unlogged_reply) {
+  clear_msg();
+  if (unlogged_reply) {
+    set_has_unlogged_reply();
+    _impl_.msg_.unlogged_reply_ = unlogged_reply;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:dsnet.nopaxos.proto.ToClientMessage.unlogged_reply)
+}
+inline ::dsnet::nopaxos::proto::UnloggedReplyMessage* ToClientMessage::_internal_mutable_unlogged_reply() {
+  if (!_internal_has_unlogged_reply()) {
+    clear_msg();
+    set_has_unlogged_reply();
+    _impl_.msg_.unlogged_reply_ = CreateMaybeMessage< ::dsnet::nopaxos::proto::UnloggedReplyMessage >(GetArenaForAllocation());
+  }
+  return _impl_.msg_.unlogged_reply_;
+}
+inline ::dsnet::nopaxos::proto::UnloggedReplyMessage* ToClientMessage::mutable_unlogged_reply() {
+  ::dsnet::nopaxos::proto::UnloggedReplyMessage* _msg = _internal_mutable_unlogged_reply();
+  // @@protoc_insertion_point(field_mutable:dsnet.nopaxos.proto.ToClientMessage.unlogged_reply)
+  return _msg;
+}
+
+inline bool ToClientMessage::has_msg() const {
+  return msg_case() != MSG_NOT_SET;
+}
+inline void ToClientMessage::clear_has_msg() {
+  _impl_._oneof_case_[0] = MSG_NOT_SET;
+}
+inline ToClientMessage::MsgCase ToClientMessage::msg_case() const {
+  return ToClientMessage::MsgCase(_impl_._oneof_case_[0]);
+}
+// -------------------------------------------------------------------
+
+// RequestMessage
+
+// required uint64 sessnum = 1;
+inline bool RequestMessage::_internal_has_sessnum() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool RequestMessage::has_sessnum() const {
+  return _internal_has_sessnum();
+}
+inline void RequestMessage::clear_sessnum() {
+  _impl_.sessnum_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline uint64_t RequestMessage::_internal_sessnum() const {
+  return _impl_.sessnum_;
+}
+inline uint64_t RequestMessage::sessnum() const {
+  // @@protoc_insertion_point(field_get:dsnet.nopaxos.proto.RequestMessage.sessnum)
+  return _internal_sessnum();
+}
+inline void RequestMessage::_internal_set_sessnum(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.sessnum_ = value;
+}
+inline void RequestMessage::set_sessnum(uint64_t value) {
+  _internal_set_sessnum(value);
+  // @@protoc_insertion_point(field_set:dsnet.nopaxos.proto.RequestMessage.sessnum)
+}
+
+// required uint64 msgnum = 2;
+inline bool RequestMessage::_internal_has_msgnum() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool RequestMessage::has_msgnum() const {
+  return _internal_has_msgnum();
+}
+inline void RequestMessage::clear_msgnum() {
+  _impl_.msgnum_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline uint64_t RequestMessage::_internal_msgnum() const {
+  return _impl_.msgnum_;
+}
+inline uint64_t RequestMessage::msgnum() const {
+  // @@protoc_insertion_point(field_get:dsnet.nopaxos.proto.RequestMessage.msgnum)
+  return _internal_msgnum();
+}
+inline void RequestMessage::_internal_set_msgnum(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.msgnum_ = value;
+}
+inline void RequestMessage::set_msgnum(uint64_t value) {
+  _internal_set_msgnum(value);
+  // @@protoc_insertion_point(field_set:dsnet.nopaxos.proto.RequestMessage.msgnum)
+}
+
+// required .dsnet.Request req = 3;
+inline bool RequestMessage::_internal_has_req() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.req_ != nullptr);
+  return value;
+}
+inline bool RequestMessage::has_req() const {
+  return _internal_has_req();
+}
+inline const ::dsnet::Request& RequestMessage::_internal_req() const {
+  const ::dsnet::Request* p = _impl_.req_;
+  return p != nullptr ? *p : reinterpret_cast<const ::dsnet::Request&>(
+      ::dsnet::_Request_default_instance_);
+}
+inline const ::dsnet::Request& RequestMessage::req() const {
+  // @@protoc_insertion_point(field_get:dsnet.nopaxos.proto.RequestMessage.req)
+  return _internal_req();
+}
+inline void RequestMessage::unsafe_arena_set_allocated_req(
+    ::dsnet::Request* req) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.req_);
+  }
+  _impl_.req_ = req;
+  if (req) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:dsnet.nopaxos.proto.RequestMessage.req)
+}
+inline ::dsnet::Request* RequestMessage::release_req() {
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::dsnet::Request* temp = _impl_.req_;
+  _impl_.req_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::dsnet::Request* RequestMessage::unsafe_arena_release_req() {
+  // @@protoc_insertion_point(field_release:dsnet.nopaxos.proto.RequestMessage.req)
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::dsnet::Request* temp = _impl_.req_;
+  _impl_.req_ = nullptr;
+  return temp;
+}
+inline ::dsnet::Request* RequestMessage::_internal_mutable_req() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  if (_impl_.req_ == nullptr) {
+    auto* p = CreateMaybeMessage<::dsnet::Request>(GetArenaForAllocation());
+    _impl_.req_ = p;
+  }
+  return _impl_.req_;
+}
+inline ::dsnet::Request* RequestMessage::mutable_req() {
+  ::dsnet::Request* _msg = _internal_mutable_req();
+  // @@protoc_insertion_point(field_mutable:dsnet.nopaxos.proto.RequestMessage.req)
+  return _msg;
+}
+inline void RequestMessage::set_allocated_req(::dsnet::Request* req) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete reinterpret_cast< ::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.req_);
+  }
+  if (req) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(
+                reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(req));
+    if (message_arena != submessage_arena) {
+      req = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, req, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.req_ = req;
+  // @@protoc_insertion_point(field_set_allocated:dsnet.nopaxos.proto.RequestMessage.req)
+}
+
+// -------------------------------------------------------------------
+
+// UnloggedRequestMessage
+
+// required .dsnet.UnloggedRequest req = 1;
+inline bool UnloggedRequestMessage::_internal_has_req() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.req_ != nullptr);
+  return value;
+}
+inline bool UnloggedRequestMessage::has_req() const {
+  return _internal_has_req();
+}
+inline const ::dsnet::UnloggedRequest& UnloggedRequestMessage::_internal_req() const {
+  const ::dsnet::UnloggedRequest* p = _impl_.req_;
+  return p != nullptr ? *p : reinterpret_cast<const ::dsnet::UnloggedRequest&>(
+      ::dsnet::_UnloggedRequest_default_instance_);
+}
+inline const ::dsnet::UnloggedRequest& UnloggedRequestMessage::req() const {
+  // @@protoc_insertion_point(field_get:dsnet.nopaxos.proto.UnloggedRequestMessage.req)
+  return _internal_req();
+}
+inline void UnloggedRequestMessage::unsafe_arena_set_allocated_req(
+    ::dsnet::UnloggedRequest* req) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.req_);
+  }
+  _impl_.req_ = req;
+  if (req) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:dsnet.nopaxos.proto.UnloggedRequestMessage.req)
+}
+inline ::dsnet::UnloggedRequest* UnloggedRequestMessage::release_req() {
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::dsnet::UnloggedRequest* temp = _impl_.req_;
+  _impl_.req_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::dsnet::UnloggedRequest* UnloggedRequestMessage::unsafe_arena_release_req() {
+  // @@protoc_insertion_point(field_release:dsnet.nopaxos.proto.UnloggedRequestMessage.req)
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::dsnet::UnloggedRequest* temp = _impl_.req_;
+  _impl_.req_ = nullptr;
+  return temp;
+}
+inline ::dsnet::UnloggedRequest* UnloggedRequestMessage::_internal_mutable_req() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  if (_impl_.req_ == nullptr) {
+    auto* p = CreateMaybeMessage<::dsnet::UnloggedRequest>(GetArenaForAllocation());
+    _impl_.req_ = p;
+  }
+  return _impl_.req_;
+}
+inline ::dsnet::UnloggedRequest* UnloggedRequestMessage::mutable_req() {
+  ::dsnet::UnloggedRequest* _msg = _internal_mutable_req();
+  // @@protoc_insertion_point(field_mutable:dsnet.nopaxos.proto.UnloggedRequestMessage.req)
+  return _msg;
+}
+inline void UnloggedRequestMessage::set_allocated_req(::dsnet::UnloggedRequest* req) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete reinterpret_cast< ::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.req_);
+  }
+  if (req) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(
+                reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(req));
+    if (message_arena != submessage_arena) {
+      req = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, req, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.req_ = req;
+  // @@protoc_insertion_point(field_set_allocated:dsnet.nopaxos.proto.UnloggedRequestMessage.req)
+}
+
+// -------------------------------------------------------------------
+
+// GapRequestMessage
+
+// required uint64 view = 1;
+inline bool GapRequestMessage::_internal_has_view() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool GapRequestMessage::has_view() const {
+  return _internal_has_view();
+}
+inline void GapRequestMessage::clear_view() {
+  _impl_.view_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline uint64_t GapRequestMessage::_internal_view() const {
+  return _impl_.view_;
+}
+inline uint64_t GapRequestMessage::view() const {
+  // @@protoc_insertion_point(field_get:dsnet.nopaxos.proto.GapRequestMessage.view)
+  return _internal_view();
+}
+inline void GapRequestMessage::_internal_set_view(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.view_ = value;
+}
+inline void GapRequestMessage::set_view(uint64_t value) {
+  _internal_set_view(value);
+  // @@protoc_insertion_point(field_set:dsnet.nopaxos.proto.GapRequestMessage.view)
+}
+
+// required uint64 sessnum = 2;
+inline bool GapRequestMessage::_internal_has_sessnum() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool GapRequestMessage::has_sessnum() const {
+  return _internal_has_sessnum();
+}
+inline void GapRequestMessage::clear_sessnum() {
+  _impl_.sessnum_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline uint64_t GapRequestMessage::_internal_sessnum() const {
+  return _impl_.sessnum_;
+}
+inline uint64_t GapRequestMessage::sessnum() const {
+  // @@protoc_insertion_point(field_get:dsnet.nopaxos.proto.GapRequestMessage.sessnum)
+  return _internal_sessnum();
+}
+inline void GapRequestMessage::_internal_set_sessnum(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.sessnum_ = value;
+}
+inline void GapRequestMessage::set_sessnum(uint64_t value) {
+  _internal_set_sessnum(value);
+  // @@protoc_insertion_point(field_set:dsnet.nopaxos.proto.GapRequestMessage.sessnum)
+}
+
+// required uint64 opnum = 3;
+inline bool GapRequestMessage::_internal_has_opnum() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool GapRequestMessage::has_opnum() const {
+  return _internal_has_opnum();
+}
+inline void GapRequestMessage::clear_opnum() {
+  _impl_.opnum_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline uint64_t GapRequestMessage::_internal_opnum() const {
+  return _impl_.opnum_;
+}
+inline uint64_t GapRequestMessage::opnum() const {
+  // @@protoc_insertion_point(field_get:dsnet.nopaxos.proto.GapRequestMessage.opnum)
+  return _internal_opnum();
+}
+inline void GapRequestMessage::_internal_set_opnum(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.opnum_ = value;
+}
+inline void GapRequestMessage::set_opnum(uint64_t value) {
+  _internal_set_opnum(value);
+  // @@protoc_insertion_point(field_set:dsnet.nopaxos.proto.GapRequestMessage.opnum)
+}
+
+// -------------------------------------------------------------------
+
+// GapReplyMessage
+
+// required uint64 view = 1;
+inline bool GapReplyMessage::_internal_has_view() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool GapReplyMessage::has_view() const {
+  return _internal_has_view();
+}
+inline void GapReplyMessage::clear_view() {
+  _impl_.view_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline uint64_t GapReplyMessage::_internal_view() const {
+  return _impl_.view_;
+}
+inline uint64_t GapReplyMessage::view() const {
+  // @@protoc_insertion_point(field_get:dsnet.nopaxos.proto.GapReplyMessage.view)
+  return _internal_view();
+}
+inline void GapReplyMessage::_internal_set_view(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.view_ = value;
+}
+inline void GapReplyMessage::set_view(uint64_t value) {
+  _internal_set_view(value);
+  // @@protoc_insertion_point(field_set:dsnet.nopaxos.proto.GapReplyMessage.view)
+}
+
+// required uint64 sessnum = 2;
+inline bool GapReplyMessage::_internal_has_sessnum() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool GapReplyMessage::has_sessnum() const {
+  return _internal_has_sessnum();
+}
+inline void GapReplyMessage::clear_sessnum() {
+  _impl_.sessnum_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline uint64_t GapReplyMessage::_internal_sessnum() const {
+  return _impl_.sessnum_;
+}
+inline uint64_t GapReplyMessage::sessnum() const {
+  // @@protoc_insertion_point(field_get:dsnet.nopaxos.proto.GapReplyMessage.sessnum)
+  return _internal_sessnum();
+}
+inline void GapReplyMessage::_internal_set_sessnum(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.sessnum_ = value;
+}
+inline void GapReplyMessage::set_sessnum(uint64_t value) {
+  _internal_set_sessnum(value);
+  // @@protoc_insertion_point(field_set:dsnet.nopaxos.proto.GapReplyMessage.sessnum)
+}
+
+// required uint64 opnum = 3;
+inline bool GapReplyMessage::_internal_has_opnum() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  return value;
+}
+inline bool GapReplyMessage::has_opnum() const {
+  return _internal_has_opnum();
+}
+inline void GapReplyMessage::clear_opnum() {
+  _impl_.opnum_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000008u;
+}
+inline uint64_t GapReplyMessage::_internal_opnum() const {
+  return _impl_.opnum_;
+}
+inline uint64_t GapReplyMessage::opnum() const {
+  // @@protoc_insertion_point(field_get:dsnet.nopaxos.proto.GapReplyMessage.opnum)
+  return _internal_opnum();
+}
+inline void GapReplyMessage::_internal_set_opnum(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  _impl_.opnum_ = value;
+}
+inline void GapReplyMessage::set_opnum(uint64_t value) {
+  _internal_set_opnum(value);
+  // @@protoc_insertion_point(field_set:dsnet.nopaxos.proto.GapReplyMessage.opnum)
+}
+
+// required bool isfound = 4;
+inline bool GapReplyMessage::_internal_has_isfound() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000010u) != 0;
+  return value;
+}
+inline bool GapReplyMessage::has_isfound() const {
+  return _internal_has_isfound();
+}
+inline void GapReplyMessage::clear_isfound() {
+  _impl_.isfound_ = false;
+  _impl_._has_bits_[0] &= ~0x00000010u;
+}
+inline bool GapReplyMessage::_internal_isfound() const {
+  return _impl_.isfound_;
+}
+inline bool GapReplyMessage::isfound() const {
+  // @@protoc_insertion_point(field_get:dsnet.nopaxos.proto.GapReplyMessage.isfound)
+  return _internal_isfound();
+}
+inline void GapReplyMessage::_internal_set_isfound(bool value) {
+  _impl_._has_bits_[0] |= 0x00000010u;
+  _impl_.isfound_ = value;
+}
+inline void GapReplyMessage::set_isfound(bool value) {
+  _internal_set_isfound(value);
+  // @@protoc_insertion_point(field_set:dsnet.nopaxos.proto.GapReplyMessage.isfound)
+}
+
+// required bool isgap = 5;
+inline bool GapReplyMessage::_internal_has_isgap() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000020u) != 0;
+  return value;
+}
+inline bool GapReplyMessage::has_isgap() const {
+  return _internal_has_isgap();
+}
+inline void GapReplyMessage::clear_isgap() {
+  _impl_.isgap_ = false;
+  _impl_._has_bits_[0] &= ~0x00000020u;
+}
+inline bool GapReplyMessage::_internal_isgap() const {
+  return _impl_.isgap_;
+}
+inline bool GapReplyMessage::isgap() const {
+  // @@protoc_insertion_point(field_get:dsnet.nopaxos.proto.GapReplyMessage.isgap)
+  return _internal_isgap();
+}
+inline void GapReplyMessage::_internal_set_isgap(bool value) {
+  _impl_._has_bits_[0] |= 0x00000020u;
+  _impl_.isgap_ = value;
+}
+inline void GapReplyMessage::set_isgap(bool value) {
+  _internal_set_isgap(value);
+  // @@protoc_insertion_point(field_set:dsnet.nopaxos.proto.GapReplyMessage.isgap)
+}
+
+// required uint32 replicaidx = 6;
+inline bool GapReplyMessage::_internal_has_replicaidx() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000040u) != 0;
+  return value;
+}
+inline bool GapReplyMessage::has_replicaidx() const {
+  return _internal_has_replicaidx();
+}
+inline void GapReplyMessage::clear_replicaidx() {
+  _impl_.replicaidx_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000040u;
+}
+inline uint32_t GapReplyMessage::_internal_replicaidx() const {
+  return _impl_.replicaidx_;
+}
+inline uint32_t GapReplyMessage::replicaidx() const {
+  // @@protoc_insertion_point(field_get:dsnet.nopaxos.proto.GapReplyMessage.replicaidx)
+  return _internal_replicaidx();
+}
+inline void GapReplyMessage::_internal_set_replicaidx(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000040u;
+  _impl_.replicaidx_ = value;
+}
+inline void GapReplyMessage::set_replicaidx(uint32_t value) {
+  _internal_set_replicaidx(value);
+  // @@protoc_insertion_point(field_set:dsnet.nopaxos.proto.GapReplyMessage.replicaidx)
+}
+
+// optional .dsnet.Request req = 7;
+inline bool GapReplyMessage::_internal_has_req() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.req_ != nullptr);
+  return value;
+}
+inline bool GapReplyMessage::has_req() const {
+  return _internal_has_req();
+}
+inline const ::dsnet::Request& GapReplyMessage::_internal_req() const {
+  const ::dsnet::Request* p = _impl_.req_;
+  return p != nullptr ? *p : reinterpret_cast<const ::dsnet::Request&>(
+      ::dsnet::_Request_default_instance_);
+}
+inline const ::dsnet::Request& GapReplyMessage::req() const {
+  // @@protoc_insertion_point(field_get:dsnet.nopaxos.proto.GapReplyMessage.req)
+  return _internal_req();
+}
+inline void GapReplyMessage::unsafe_arena_set_allocated_req(
+    ::dsnet::Request* req) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.req_);
+  }
+  _impl_.req_ = req;
+  if (req) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:dsnet.nopaxos.proto.GapReplyMessage.req)
+}
+inline ::dsnet::Request* GapReplyMessage::release_req() {
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::dsnet::Request* temp = _impl_.req_;
+  _impl_.req_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::dsnet::Request* GapReplyMessage::unsafe_arena_release_req() {
+  // @@protoc_insertion_point(field_release:dsnet.nopaxos.proto.GapReplyMessage.req)
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::dsnet::Request* temp = _impl_.req_;
+  _impl_.req_ = nullptr;
+  return temp;
+}
+inline ::dsnet::Request* GapReplyMessage::_internal_mutable_req() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  if (_impl_.req_ == nullptr) {
+    auto* p = CreateMaybeMessage<::dsnet::Request>(GetArenaForAllocation());
+    _impl_.req_ = p;
+  }
+  return _impl_.req_;
+}
+inline ::dsnet::Request* GapReplyMessage::mutable_req() {
+  ::dsnet::Request* _msg = _internal_mutable_req();
+  // @@protoc_insertion_point(field_mutable:dsnet.nopaxos.proto.GapReplyMessage.req)
+  return _msg;
+}
+inline void GapReplyMessage::set_allocated_req(::dsnet::Request* req) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete reinterpret_cast< ::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.req_);
+  }
+  if (req) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(
+                reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(req));
+    if (message_arena != submessage_arena) {
+      req = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, req, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.req_ = req;
+  // @@protoc_insertion_point(field_set_allocated:dsnet.nopaxos.proto.GapReplyMessage.req)
+}
+
+// -------------------------------------------------------------------
+
+// StateTransferRequestMessage
+
+// required uint64 sessnum = 1;
+inline bool StateTransferRequestMessage::_internal_has_sessnum() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool StateTransferRequestMessage::has_sessnum() const {
+  return _internal_has_sessnum();
+}
+inline void StateTransferRequestMessage::clear_sessnum() {
+  _impl_.sessnum_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline uint64_t StateTransferRequestMessage::_internal_sessnum() const {
+  return _impl_.sessnum_;
+}
+inline uint64_t StateTransferRequestMessage::sessnum() const {
+  // @@protoc_insertion_point(field_get:dsnet.nopaxos.proto.StateTransferRequestMessage.sessnum)
+  return _internal_sessnum();
+}
+inline void StateTransferRequestMessage::_internal_set_sessnum(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.sessnum_ = value;
+}
+inline void StateTransferRequestMessage::set_sessnum(uint64_t value) {
+  _internal_set_sessnum(value);
+  // @@protoc_insertion_point(field_set:dsnet.nopaxos.proto.StateTransferRequestMessage.sessnum)
+}
+
+// required uint64 view = 2;
+inline bool StateTransferRequestMessage::_internal_has_view() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool StateTransferRequestMessage::has_view() const {
+  return _internal_has_view();
+}
+inline void StateTransferRequestMessage::clear_view() {
+  _impl_.view_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline uint64_t StateTransferRequestMessage::_internal_view() const {
+  return _impl_.view_;
+}
+inline uint64_t StateTransferRequestMessage::view() const {
+  // @@protoc_insertion_point(field_get:dsnet.nopaxos.proto.StateTransferRequestMessage.view)
+  return _internal_view();
+}
+inline void StateTransferRequestMessage::_internal_set_view(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.view_ = value;
+}
+inline void StateTransferRequestMessage::set_view(uint64_t value) {
+  _internal_set_view(value);
+  // @@protoc_insertion_point(field_set:dsnet.nopaxos.proto.StateTransferRequestMessage.view)
+}
+
+// required uint64 begin = 3;
+inline bool StateTransferRequestMessage::_internal_has_begin() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool StateTransferRequestMessage::has_begin() const {
+  return _internal_has_begin();
+}
+inline void StateTransferRequestMessage::clear_begin() {
+  _impl_.begin_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline uint64_t StateTransferRequestMessage::_internal_begin() const {
+  return _impl_.begin_;
+}
+inline uint64_t StateTransferRequestMessage::begin() const {
+  // @@protoc_insertion_point(field_get:dsnet.nopaxos.proto.StateTransferRequestMessage.begin)
+  return _internal_begin();
+}
+inline void StateTransferRequestMessage::_internal_set_begin(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.begin_ = value;
+}
+inline void StateTransferRequestMessage::set_begin(uint64_t value) {
+  _internal_set_begin(value);
+  // @@protoc_insertion_point(field_set:dsnet.nopaxos.proto.StateTransferRequestMessage.begin)
+}
+
+// required uint64 end = 4;
+inline bool StateTransferRequestMessage::_internal_has_end() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  return value;
+}
+inline bool StateTransferRequestMessage::has_end() const {
+  return _internal_has_end();
+}
+inline void StateTransferRequestMessage::clear_end() {
+  _impl_.end_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000008u;
+}
+inline uint64_t StateTransferRequestMessage::_internal_end() const {
+  return _impl_.end_;
+}
+inline uint64_t StateTransferRequestMessage::end() const {
+  // @@protoc_insertion_point(field_get:dsnet.nopaxos.proto.StateTransferRequestMessage.end)
+  return _internal_end();
+}
+inline void StateTransferRequestMessage::_internal_set_end(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  _impl_.end_ = value;
+}
+inline void StateTransferRequestMessage::set_end(uint64_t value) {
+  _internal_set_end(value);
+  // @@protoc_insertion_point(field_set:dsnet.nopaxos.proto.StateTransferRequestMessage.end)
+}
+
+// -------------------------------------------------------------------
+
+// StateTransferReplyMessage
+
+// required uint64 sessnum = 1;
+inline bool StateTransferReplyMessage::_internal_has_sessnum() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool StateTransferReplyMessage::has_sessnum() const {
+  return _internal_has_sessnum();
+}
+inline void StateTransferReplyMessage::clear_sessnum() {
+  _impl_.sessnum_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline uint64_t StateTransferReplyMessage::_internal_sessnum() const {
+  return _impl_.sessnum_;
+}
+inline uint64_t StateTransferReplyMessage::sessnum() const {
+  // @@protoc_insertion_point(field_get:dsnet.nopaxos.proto.StateTransferReplyMessage.sessnum)
+  return _internal_sessnum();
+}
+inline void StateTransferReplyMessage::_internal_set_sessnum(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.sessnum_ = value;
+}
+inline void StateTransferReplyMessage::set_sessnum(uint64_t value) {
+  _internal_set_sessnum(value);
+  // @@protoc_insertion_point(field_set:dsnet.nopaxos.proto.StateTransferReplyMessage.sessnum)
+}
+
+// required uint64 view = 2;
+inline bool StateTransferReplyMessage::_internal_has_view() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool StateTransferReplyMessage::has_view() const {
+  return _internal_has_view();
+}
+inline void StateTransferReplyMessage::clear_view() {
+  _impl_.view_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline uint64_t StateTransferReplyMessage::_internal_view() const {
+  return _impl_.view_;
+}
+inline uint64_t StateTransferReplyMessage::view() const {
+  // @@protoc_insertion_point(field_get:dsnet.nopaxos.proto.StateTransferReplyMessage.view)
+  return _internal_view();
+}
+inline void StateTransferReplyMessage::_internal_set_view(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.view_ = value;
+}
+inline void StateTransferReplyMessage::set_view(uint64_t value) {
+  _internal_set_view(value);
+  // @@protoc_insertion_point(field_set:dsnet.nopaxos.proto.StateTransferReplyMessage.view)
+}
+
+// required uint64 begin = 3;
+inline bool StateTransferReplyMessage::_internal_has_begin() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool StateTransferReplyMessage::has_begin() const {
+  return _internal_has_begin();
+}
+inline void StateTransferReplyMessage::clear_begin() {
+  _impl_.begin_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline uint64_t StateTransferReplyMessage::_internal_begin() const {
+  return _impl_.begin_;
+}
+inline uint64_t StateTransferReplyMessage::begin() const {
+  // @@protoc_insertion_point(field_get:dsnet.nopaxos.proto.StateTransferReplyMessage.begin)
+  return _internal_begin();
+}
+inline void StateTransferReplyMessage::_internal_set_begin(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.begin_ = value;
+}
+inline void StateTransferReplyMessage::set_begin(uint64_t value) {
+  _internal_set_begin(value);
+  // @@protoc_insertion_point(field_set:dsnet.nopaxos.proto.StateTransferReplyMessage.begin)
+}
+
+// required uint64 end = 4;
+inline bool StateTransferReplyMessage::_internal_has_end() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  return value;
+}
+inline bool StateTransferReplyMessage::has_end() const {
+  return _internal_has_end();
+}
+inline void StateTransferReplyMessage::clear_end() {
+  _impl_.end_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000008u;
+}
+inline uint64_t StateTransferReplyMessage::_internal_end() const {
+  return _impl_.end_;
+}
+inline uint64_t StateTransferReplyMessage::end() const {
+  // @@protoc_insertion_point(field_get:dsnet.nopaxos.proto.StateTransferReplyMessage.end)
+  return _internal_end();
+}
+inline void StateTransferReplyMessage::_internal_set_end(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  _impl_.end_ = value;
+}
+inline void StateTransferReplyMessage::set_end(uint64_t value) {
+  _internal_set_end(value);
+  // @@protoc_insertion_point(field_set:dsnet.nopaxos.proto.StateTransferReplyMessage.end)
+}
+
+// repeated .dsnet.MsgLogEntry entries = 5;
+inline int StateTransferReplyMessage::_internal_entries_size() const {
+  return _impl_.entries_.size();
+}
+inline int StateTransferReplyMessage::entries_size() const {
+  return _internal_entries_size();
+}
+inline ::dsnet::MsgLogEntry* StateTransferReplyMessage::mutable_entries(int index) {
+  // @@protoc_insertion_point(field_mutable:dsnet.nopaxos.proto.StateTransferReplyMessage.entries)
+  return _impl_.entries_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::dsnet::MsgLogEntry >*
+StateTransferReplyMessage::mutable_entries() {
+  // @@protoc_insertion_point(field_mutable_list:dsnet.nopaxos.proto.StateTransferReplyMessage.entries)
+  return &_impl_.entries_;
+}
+inline const ::dsnet::MsgLogEntry& StateTransferReplyMessage::_internal_entries(int index) const {
+  return _impl_.entries_.Get(index);
+}
+inline const ::dsnet::MsgLogEntry& StateTransferReplyMessage::entries(int index) const {
+  // @@protoc_insertion_point(field_get:dsnet.nopaxos.proto.StateTransferReplyMessage.entries)
+  return _internal_entries(index);
+}
+inline ::dsnet::MsgLogEntry* StateTransferReplyMessage::_internal_add_entries() {
+  return _impl_.entries_.Add();
+}
+inline ::dsnet::MsgLogEntry* StateTransferReplyMessage::add_entries() {
+  ::dsnet::MsgLogEntry* _add = _internal_add_entries();
+  // @@protoc_insertion_point(field_add:dsnet.nopaxos.proto.StateTransferReplyMessage.entries)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::dsnet::MsgLogEntry >&
+StateTransferReplyMessage::entries() const {
+  // @@protoc_insertion_point(field_list:dsnet.nopaxos.proto.StateTransferReplyMessage.entries)
+  return _impl_.entries_;
+}
+
+// -------------------------------------------------------------------
+
+// GapCommitMessage
+
+// required uint64 sessnum = 1;
+inline bool GapCommitMessage::_internal_has_sessnum() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool GapCommitMessage::has_sessnum() const {
+  return _internal_has_sessnum();
+}
+inline void GapCommitMessage::clear_sessnum() {
+  _impl_.sessnum_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline uint64_t GapCommitMessage::_internal_sessnum() const {
+  return _impl_.sessnum_;
+}
+inline uint64_t GapCommitMessage::sessnum() const {
+  // @@protoc_insertion_point(field_get:dsnet.nopaxos.proto.GapCommitMessage.sessnum)
+  return _internal_sessnum();
+}
+inline void GapCommitMessage::_internal_set_sessnum(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.sessnum_ = value;
+}
+inline void GapCommitMessage::set_sessnum(uint64_t value) {
+  _internal_set_sessnum(value);
+  // @@protoc_insertion_point(field_set:dsnet.nopaxos.proto.GapCommitMessage.sessnum)
+}
+
+// required uint64 view = 2;
+inline bool GapCommitMessage::_internal_has_view() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool GapCommitMessage::has_view() const {
+  return _internal_has_view();
+}
+inline void GapCommitMessage::clear_view() {
+  _impl_.view_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline uint64_t GapCommitMessage::_internal_view() const {
+  return _impl_.view_;
+}
+inline uint64_t GapCommitMessage::view() const {
+  // @@protoc_insertion_point(field_get:dsnet.nopaxos.proto.GapCommitMessage.view)
+  return _internal_view();
+}
+inline void GapCommitMessage::_internal_set_view(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.view_ = value;
+}
+inline void GapCommitMessage::set_view(uint64_t value) {
+  _internal_set_view(value);
+  // @@protoc_insertion_point(field_set:dsnet.nopaxos.proto.GapCommitMessage.view)
+}
+
+// required uint64 opnum = 3;
+inline bool GapCommitMessage::_internal_has_opnum() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool GapCommitMessage::has_opnum() const {
+  return _internal_has_opnum();
+}
+inline void GapCommitMessage::clear_opnum() {
+  _impl_.opnum_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline uint64_t GapCommitMessage::_internal_opnum() const {
+  return _impl_.opnum_;
+}
+inline uint64_t GapCommitMessage::opnum() const {
+  // @@protoc_insertion_point(field_get:dsnet.nopaxos.proto.GapCommitMessage.opnum)
+  return _internal_opnum();
+}
+inline void GapCommitMessage::_internal_set_opnum(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.opnum_ = value;
+}
+inline void GapCommitMessage::set_opnum(uint64_t value) {
+  _internal_set_opnum(value);
+  // @@protoc_insertion_point(field_set:dsnet.nopaxos.proto.GapCommitMessage.opnum)
+}
+
+// -------------------------------------------------------------------
+
+// GapCommitReplyMessage
+
+// required uint64 sessnum = 1;
+inline bool GapCommitReplyMessage::_internal_has_sessnum() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool GapCommitReplyMessage::has_sessnum() const {
+  return _internal_has_sessnum();
+}
+inline void GapCommitReplyMessage::clear_sessnum() {
+  _impl_.sessnum_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline uint64_t GapCommitReplyMessage::_internal_sessnum() const {
+  return _impl_.sessnum_;
+}
+inline uint64_t GapCommitReplyMessage::sessnum() const {
+  // @@protoc_insertion_point(field_get:dsnet.nopaxos.proto.GapCommitReplyMessage.sessnum)
+  return _internal_sessnum();
+}
+inline void GapCommitReplyMessage::_internal_set_sessnum(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.sessnum_ = value;
+}
+inline void GapCommitReplyMessage::set_sessnum(uint64_t value) {
+  _internal_set_sessnum(value);
+  // @@protoc_insertion_point(field_set:dsnet.nopaxos.proto.GapCommitReplyMessage.sessnum)
+}
+
+// required uint64 view = 2;
+inline bool GapCommitReplyMessage::_internal_has_view() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool GapCommitReplyMessage::has_view() const {
+  return _internal_has_view();
+}
+inline void GapCommitReplyMessage::clear_view() {
+  _impl_.view_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline uint64_t GapCommitReplyMessage::_internal_view() const {
+  return _impl_.view_;
+}
+inline uint64_t GapCommitReplyMessage::view() const {
+  // @@protoc_insertion_point(field_get:dsnet.nopaxos.proto.GapCommitReplyMessage.view)
+  return _internal_view();
+}
+inline void GapCommitReplyMessage::_internal_set_view(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.view_ = value;
+}
+inline void GapCommitReplyMessage::set_view(uint64_t value) {
+  _internal_set_view(value);
+  // @@protoc_insertion_point(field_set:dsnet.nopaxos.proto.GapCommitReplyMessage.view)
+}
+
+// required uint64 opnum = 3;
+inline bool GapCommitReplyMessage::_internal_has_opnum() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool GapCommitReplyMessage::has_opnum() const {
+  return _internal_has_opnum();
+}
+inline void GapCommitReplyMessage::clear_opnum() {
+  _impl_.opnum_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline uint64_t GapCommitReplyMessage::_internal_opnum() const {
+  return _impl_.opnum_;
+}
+inline uint64_t GapCommitReplyMessage::opnum() const {
+  // @@protoc_insertion_point(field_get:dsnet.nopaxos.proto.GapCommitReplyMessage.opnum)
+  return _internal_opnum();
+}
+inline void GapCommitReplyMessage::_internal_set_opnum(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.opnum_ = value;
+}
+inline void GapCommitReplyMessage::set_opnum(uint64_t value) {
+  _internal_set_opnum(value);
+  // @@protoc_insertion_point(field_set:dsnet.nopaxos.proto.GapCommitReplyMessage.opnum)
+}
+
+// required uint32 replicaidx = 4;
+inline bool GapCommitReplyMessage::_internal_has_replicaidx() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  return value;
+}
+inline bool GapCommitReplyMessage::has_replicaidx() const {
+  return _internal_has_replicaidx();
+}
+inline void GapCommitReplyMessage::clear_replicaidx() {
+  _impl_.replicaidx_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000008u;
+}
+inline uint32_t GapCommitReplyMessage::_internal_replicaidx() const {
+  return _impl_.replicaidx_;
+}
+inline uint32_t GapCommitReplyMessage::replicaidx() const {
+  // @@protoc_insertion_point(field_get:dsnet.nopaxos.proto.GapCommitReplyMessage.replicaidx)
+  return _internal_replicaidx();
+}
+inline void GapCommitReplyMessage::_internal_set_replicaidx(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  _impl_.replicaidx_ = value;
+}
+inline void GapCommitReplyMessage::set_replicaidx(uint32_t value) {
+  _internal_set_replicaidx(value);
+  // @@protoc_insertion_point(field_set:dsnet.nopaxos.proto.GapCommitReplyMessage.replicaidx)
+}
+
+// -------------------------------------------------------------------
+
+// ViewChangeRequestMessage
+
+// required uint64 sessnum = 1;
+inline bool ViewChangeRequestMessage::_internal_has_sessnum() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool ViewChangeRequestMessage::has_sessnum() const {
+  return _internal_has_sessnum();
+}
+inline void ViewChangeRequestMessage::clear_sessnum() {
+  _impl_.sessnum_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline uint64_t ViewChangeRequestMessage::_internal_sessnum() const {
+  return _impl_.sessnum_;
+}
+inline uint64_t ViewChangeRequestMessage::sessnum() const {
+  // @@protoc_insertion_point(field_get:dsnet.nopaxos.proto.ViewChangeRequestMessage.sessnum)
+  return _internal_sessnum();
+}
+inline void ViewChangeRequestMessage::_internal_set_sessnum(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.sessnum_ = value;
+}
+inline void ViewChangeRequestMessage::set_sessnum(uint64_t value) {
+  _internal_set_sessnum(value);
+  // @@protoc_insertion_point(field_set:dsnet.nopaxos.proto.ViewChangeRequestMessage.sessnum)
+}
+
+// required uint64 view = 2;
+inline bool ViewChangeRequestMessage::_internal_has_view() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool ViewChangeRequestMessage::has_view() const {
+  return _internal_has_view();
+}
+inline void ViewChangeRequestMessage::clear_view() {
+  _impl_.view_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline uint64_t ViewChangeRequestMessage::_internal_view() const {
+  return _impl_.view_;
+}
+inline uint64_t ViewChangeRequestMessage::view() const {
+  // @@protoc_insertion_point(field_get:dsnet.nopaxos.proto.ViewChangeRequestMessage.view)
+  return _internal_view();
+}
+inline void ViewChangeRequestMessage::_internal_set_view(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.view_ = value;
+}
+inline void ViewChangeRequestMessage::set_view(uint64_t value) {
+  _internal_set_view(value);
+  // @@protoc_insertion_point(field_set:dsnet.nopaxos.proto.ViewChangeRequestMessage.view)
+}
+
+// -------------------------------------------------------------------
+
+// ViewChangeMessage
+
+// required uint64 sessnum = 1;
+inline bool ViewChangeMessage::_internal_has_sessnum() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool ViewChangeMessage::has_sessnum() const {
+  return _internal_has_sessnum();
+}
+inline void ViewChangeMessage::clear_sessnum() {
+  _impl_.sessnum_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline uint64_t ViewChangeMessage::_internal_sessnum() const {
+  return _impl_.sessnum_;
+}
+inline uint64_t ViewChangeMessage::sessnum() const {
+  // @@protoc_insertion_point(field_get:dsnet.nopaxos.proto.ViewChangeMessage.sessnum)
+  return _internal_sessnum();
+}
+inline void ViewChangeMessage::_internal_set_sessnum(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.sessnum_ = value;
+}
+inline void ViewChangeMessage::set_sessnum(uint64_t value) {
+  _internal_set_sessnum(value);
+  // @@protoc_insertion_point(field_set:dsnet.nopaxos.proto.ViewChangeMessage.sessnum)
+}
+
+// required uint64 view = 2;
+inline bool ViewChangeMessage::_internal_has_view() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool ViewChangeMessage::has_view() const {
+  return _internal_has_view();
+}
+inline void ViewChangeMessage::clear_view() {
+  _impl_.view_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline uint64_t ViewChangeMessage::_internal_view() const {
+  return _impl_.view_;
+}
+inline uint64_t ViewChangeMessage::view() const {
+  // @@protoc_insertion_point(field_get:dsnet.nopaxos.proto.ViewChangeMessage.view)
+  return _internal_view();
+}
+inline void ViewChangeMessage::_internal_set_view(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.view_ = value;
+}
+inline void ViewChangeMessage::set_view(uint64_t value) {
+  _internal_set_view(value);
+  // @@protoc_insertion_point(field_set:dsnet.nopaxos.proto.ViewChangeMessage.view)
+}
+
+// required uint64 lastnormalsessnum = 3;
+inline bool ViewChangeMessage::_internal_has_lastnormalsessnum() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool ViewChangeMessage::has_lastnormalsessnum() const {
+  return _internal_has_lastnormalsessnum();
+}
+inline void ViewChangeMessage::clear_lastnormalsessnum() {
+  _impl_.lastnormalsessnum_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline uint64_t ViewChangeMessage::_internal_lastnormalsessnum() const {
+  return _impl_.lastnormalsessnum_;
+}
+inline uint64_t ViewChangeMessage::lastnormalsessnum() const {
+  // @@protoc_insertion_point(field_get:dsnet.nopaxos.proto.ViewChangeMessage.lastnormalsessnum)
+  return _internal_lastnormalsessnum();
+}
+inline void ViewChangeMessage::_internal_set_lastnormalsessnum(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.lastnormalsessnum_ = value;
+}
+inline void ViewChangeMessage::set_lastnormalsessnum(uint64_t value) {
+  _internal_set_lastnormalsessnum(value);
+  // @@protoc_insertion_point(field_set:dsnet.nopaxos.proto.ViewChangeMessage.lastnormalsessnum)
+}
+
+// required uint64 lastnormalview = 4;
+inline bool ViewChangeMessage::_internal_has_lastnormalview() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  return value;
+}
+inline bool ViewChangeMessage::has_lastnormalview() const {
+  return _internal_has_lastnormalview();
+}
+inline void ViewChangeMessage::clear_lastnormalview() {
+  _impl_.lastnormalview_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000008u;
+}
+inline uint64_t ViewChangeMessage::_internal_lastnormalview() const {
+  return _impl_.lastnormalview_;
+}
+inline uint64_t ViewChangeMessage::lastnormalview() const {
+  // @@protoc_insertion_point(field_get:dsnet.nopaxos.proto.ViewChangeMessage.lastnormalview)
+  return _internal_lastnormalview();
+}
+inline void ViewChangeMessage::_internal_set_lastnormalview(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  _impl_.lastnormalview_ = value;
+}
+inline void ViewChangeMessage::set_lastnormalview(uint64_t value) {
+  _internal_set_lastnormalview(value);
+  // @@protoc_insertion_point(field_set:dsnet.nopaxos.proto.ViewChangeMessage.lastnormalview)
+}
+
+// required uint64 lastop = 5;
+inline bool ViewChangeMessage::_internal_has_lastop() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000010u) != 0;
+  return value;
+}
+inline bool ViewChangeMessage::has_lastop() const {
+  return _internal_has_lastop();
+}
+inline void ViewChangeMessage::clear_lastop() {
+  _impl_.lastop_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000010u;
+}
+inline uint64_t ViewChangeMessage::_internal_lastop() const {
+  return _impl_.lastop_;
+}
+inline uint64_t ViewChangeMessage::lastop() const {
+  // @@protoc_insertion_point(field_get:dsnet.nopaxos.proto.ViewChangeMessage.lastop)
+  return _internal_lastop();
+}
+inline void ViewChangeMessage::_internal_set_lastop(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000010u;
+  _impl_.lastop_ = value;
+}
+inline void ViewChangeMessage::set_lastop(uint64_t value) {
+  _internal_set_lastop(value);
+  // @@protoc_insertion_point(field_set:dsnet.nopaxos.proto.ViewChangeMessage.lastop)
+}
+
+// repeated uint64 committedgaps = 6;
+inline int ViewChangeMessage::_internal_committedgaps_size() const {
+  return _impl_.committedgaps_.size();
+}
+inline int ViewChangeMessage::committedgaps_size() const {
+  return _internal_committedgaps_size();
+}
+inline void ViewChangeMessage::clear_committedgaps() {
+  _impl_.committedgaps_.Clear();
+}
+inline uint64_t ViewChangeMessage::_internal_committedgaps(int index) const {
+  return _impl_.committedgaps_.Get(index);
+}
+inline uint64_t ViewChangeMessage::committedgaps(int index) const {
+  // @@protoc_insertion_point(field_get:dsnet.nopaxos.proto.ViewChangeMessage.committedgaps)
+  return _internal_committedgaps(index);
+}
+inline void ViewChangeMessage::set_committedgaps(int index, uint64_t value) {
+  _impl_.committedgaps_.Set(index, value);
+  // @@protoc_insertion_point(field_set:dsnet.nopaxos.proto.ViewChangeMessage.committedgaps)
+}
+inline void ViewChangeMessage::_internal_add_committedgaps(uint64_t value) {
+  _impl_.committedgaps_.Add(value);
+}
+inline void ViewChangeMessage::add_committedgaps(uint64_t value) {
+  _internal_add_committedgaps(value);
+  // @@protoc_insertion_point(field_add:dsnet.nopaxos.proto.ViewChangeMessage.committedgaps)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >&
+ViewChangeMessage::_internal_committedgaps() const {
+  return _impl_.committedgaps_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >&
+ViewChangeMessage::committedgaps() const {
+  // @@protoc_insertion_point(field_list:dsnet.nopaxos.proto.ViewChangeMessage.committedgaps)
+  return _internal_committedgaps();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >*
+ViewChangeMessage::_internal_mutable_committedgaps() {
+  return &_impl_.committedgaps_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >*
+ViewChangeMessage::mutable_committedgaps() {
+  // @@protoc_insertion_point(field_mutable_list:dsnet.nopaxos.proto.ViewChangeMessage.committedgaps)
+  return _internal_mutable_committedgaps();
+}
+
+// required uint32 replicaidx = 7;
+inline bool ViewChangeMessage::_internal_has_replicaidx() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000020u) != 0;
+  return value;
+}
+inline bool ViewChangeMessage::has_replicaidx() const {
+  return _internal_has_replicaidx();
+}
+inline void ViewChangeMessage::clear_replicaidx() {
+  _impl_.replicaidx_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000020u;
+}
+inline uint32_t ViewChangeMessage::_internal_replicaidx() const {
+  return _impl_.replicaidx_;
+}
+inline uint32_t ViewChangeMessage::replicaidx() const {
+  // @@protoc_insertion_point(field_get:dsnet.nopaxos.proto.ViewChangeMessage.replicaidx)
+  return _internal_replicaidx();
+}
+inline void ViewChangeMessage::_internal_set_replicaidx(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000020u;
+  _impl_.replicaidx_ = value;
+}
+inline void ViewChangeMessage::set_replicaidx(uint32_t value) {
+  _internal_set_replicaidx(value);
+  // @@protoc_insertion_point(field_set:dsnet.nopaxos.proto.ViewChangeMessage.replicaidx)
+}
+
+// -------------------------------------------------------------------
+
+// StartViewMessage
+
+// required uint64 sessnum = 1;
+inline bool StartViewMessage::_internal_has_sessnum() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool StartViewMessage::has_sessnum() const {
+  return _internal_has_sessnum();
+}
+inline void StartViewMessage::clear_sessnum() {
+  _impl_.sessnum_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline uint64_t StartViewMessage::_internal_sessnum() const {
+  return _impl_.sessnum_;
+}
+inline uint64_t StartViewMessage::sessnum() const {
+  // @@protoc_insertion_point(field_get:dsnet.nopaxos.proto.StartViewMessage.sessnum)
+  return _internal_sessnum();
+}
+inline void StartViewMessage::_internal_set_sessnum(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.sessnum_ = value;
+}
+inline void StartViewMessage::set_sessnum(uint64_t value) {
+  _internal_set_sessnum(value);
+  // @@protoc_insertion_point(field_set:dsnet.nopaxos.proto.StartViewMessage.sessnum)
+}
+
+// required uint64 view = 2;
+inline bool StartViewMessage::_internal_has_view() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool StartViewMessage::has_view() const {
+  return _internal_has_view();
+}
+inline void StartViewMessage::clear_view() {
+  _impl_.view_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline uint64_t StartViewMessage::_internal_view() const {
+  return _impl_.view_;
+}
+inline uint64_t StartViewMessage::view() const {
+  // @@protoc_insertion_point(field_get:dsnet.nopaxos.proto.StartViewMessage.view)
+  return _internal_view();
+}
+inline void StartViewMessage::_internal_set_view(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.view_ = value;
+}
+inline void StartViewMessage::set_view(uint64_t value) {
+  _internal_set_view(value);
+  // @@protoc_insertion_point(field_set:dsnet.nopaxos.proto.StartViewMessage.view)
+}
+
+// required uint64 lastnormalsessnum = 3;
+inline bool StartViewMessage::_internal_has_lastnormalsessnum() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool StartViewMessage::has_lastnormalsessnum() const {
+  return _internal_has_lastnormalsessnum();
+}
+inline void StartViewMessage::clear_lastnormalsessnum() {
+  _impl_.lastnormalsessnum_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline uint64_t StartViewMessage::_internal_lastnormalsessnum() const {
+  return _impl_.lastnormalsessnum_;
+}
+inline uint64_t StartViewMessage::lastnormalsessnum() const {
+  // @@protoc_insertion_point(field_get:dsnet.nopaxos.proto.StartViewMessage.lastnormalsessnum)
+  return _internal_lastnormalsessnum();
+}
+inline void StartViewMessage::_internal_set_lastnormalsessnum(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.lastnormalsessnum_ = value;
+}
+inline void StartViewMessage::set_lastnormalsessnum(uint64_t value) {
+  _internal_set_lastnormalsessnum(value);
+  // @@protoc_insertion_point(field_set:dsnet.nopaxos.proto.StartViewMessage.lastnormalsessnum)
+}
+
+// required uint64 lastnormalview = 4;
+inline bool StartViewMessage::_internal_has_lastnormalview() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  return value;
+}
+inline bool StartViewMessage::has_lastnormalview() const {
+  return _internal_has_lastnormalview();
+}
+inline void StartViewMessage::clear_lastnormalview() {
+  _impl_.lastnormalview_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000008u;
+}
+inline uint64_t StartViewMessage::_internal_lastnormalview() const {
+  return _impl_.lastnormalview_;
+}
+inline uint64_t StartViewMessage::lastnormalview() const {
+  // @@protoc_insertion_point(field_get:dsnet.nopaxos.proto.StartViewMessage.lastnormalview)
+  return _internal_lastnormalview();
+}
+inline void StartViewMessage::_internal_set_lastnormalview(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  _impl_.lastnormalview_ = value;
+}
+inline void StartViewMessage::set_lastnormalview(uint64_t value) {
+  _internal_set_lastnormalview(value);
+  // @@protoc_insertion_point(field_set:dsnet.nopaxos.proto.StartViewMessage.lastnormalview)
+}
+
+// required uint64 lastop = 5;
+inline bool StartViewMessage::_internal_has_lastop() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000010u) != 0;
+  return value;
+}
+inline bool StartViewMessage::has_lastop() const {
+  return _internal_has_lastop();
+}
+inline void StartViewMessage::clear_lastop() {
+  _impl_.lastop_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000010u;
+}
+inline uint64_t StartViewMessage::_internal_lastop() const {
+  return _impl_.lastop_;
+}
+inline uint64_t StartViewMessage::lastop() const {
+  // @@protoc_insertion_point(field_get:dsnet.nopaxos.proto.StartViewMessage.lastop)
+  return _internal_lastop();
+}
+inline void StartViewMessage::_internal_set_lastop(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000010u;
+  _impl_.lastop_ = value;
+}
+inline void StartViewMessage::set_lastop(uint64_t value) {
+  _internal_set_lastop(value);
+  // @@protoc_insertion_point(field_set:dsnet.nopaxos.proto.StartViewMessage.lastop)
+}
+
+// repeated uint64 committedgaps = 6;
+inline int StartViewMessage::_internal_committedgaps_size() const {
+  return _impl_.committedgaps_.size();
+}
+inline int StartViewMessage::committedgaps_size() const {
+  return _internal_committedgaps_size();
+}
+inline void StartViewMessage::clear_committedgaps() {
+  _impl_.committedgaps_.Clear();
+}
+inline uint64_t StartViewMessage::_internal_committedgaps(int index) const {
+  return _impl_.committedgaps_.Get(index);
+}
+inline uint64_t StartViewMessage::committedgaps(int index) const {
+  // @@protoc_insertion_point(field_get:dsnet.nopaxos.proto.StartViewMessage.committedgaps)
+  return _internal_committedgaps(index);
+}
+inline void StartViewMessage::set_committedgaps(int index, uint64_t value) {
+  _impl_.committedgaps_.Set(index, value);
+  // @@protoc_insertion_point(field_set:dsnet.nopaxos.proto.StartViewMessage.committedgaps)
+}
+inline void StartViewMessage::_internal_add_committedgaps(uint64_t value) {
+  _impl_.committedgaps_.Add(value);
+}
+inline void StartViewMessage::add_committedgaps(uint64_t value) {
+  _internal_add_committedgaps(value);
+  // @@protoc_insertion_point(field_add:dsnet.nopaxos.proto.StartViewMessage.committedgaps)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >&
+StartViewMessage::_internal_committedgaps() const {
+  return _impl_.committedgaps_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >&
+StartViewMessage::committedgaps() const {
+  // @@protoc_insertion_point(field_list:dsnet.nopaxos.proto.StartViewMessage.committedgaps)
+  return _internal_committedgaps();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >*
+StartViewMessage::_internal_mutable_committedgaps() {
+  return &_impl_.committedgaps_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >*
+StartViewMessage::mutable_committedgaps() {
+  // @@protoc_insertion_point(field_mutable_list:dsnet.nopaxos.proto.StartViewMessage.committedgaps)
+  return _internal_mutable_committedgaps();
+}
+
+// -------------------------------------------------------------------
+
+// StartViewReplyMessage
+
+// required uint64 sessnum = 1;
+inline bool StartViewReplyMessage::_internal_has_sessnum() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool StartViewReplyMessage::has_sessnum() const {
+  return _internal_has_sessnum();
+}
+inline void StartViewReplyMessage::clear_sessnum() {
+  _impl_.sessnum_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline uint64_t StartViewReplyMessage::_internal_sessnum() const {
+  return _impl_.sessnum_;
+}
+inline uint64_t StartViewReplyMessage::sessnum() const {
+  // @@protoc_insertion_point(field_get:dsnet.nopaxos.proto.StartViewReplyMessage.sessnum)
+  return _internal_sessnum();
+}
+inline void StartViewReplyMessage::_internal_set_sessnum(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.sessnum_ = value;
+}
+inline void StartViewReplyMessage::set_sessnum(uint64_t value) {
+  _internal_set_sessnum(value);
+  // @@protoc_insertion_point(field_set:dsnet.nopaxos.proto.StartViewReplyMessage.sessnum)
+}
+
+// required uint64 view = 2;
+inline bool StartViewReplyMessage::_internal_has_view() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool StartViewReplyMessage::has_view() const {
+  return _internal_has_view();
+}
+inline void StartViewReplyMessage::clear_view() {
+  _impl_.view_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline uint64_t StartViewReplyMessage::_internal_view() const {
+  return _impl_.view_;
+}
+inline uint64_t StartViewReplyMessage::view() const {
+  // @@protoc_insertion_point(field_get:dsnet.nopaxos.proto.StartViewReplyMessage.view)
+  return _internal_view();
+}
+inline void StartViewReplyMessage::_internal_set_view(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.view_ = value;
+}
+inline void StartViewReplyMessage::set_view(uint64_t value) {
+  _internal_set_view(value);
+  // @@protoc_insertion_point(field_set:dsnet.nopaxos.proto.StartViewReplyMessage.view)
+}
+
+// required uint32 replicaidx = 3;
+inline bool StartViewReplyMessage::_internal_has_replicaidx() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool StartViewReplyMessage::has_replicaidx() const {
+  return _internal_has_replicaidx();
+}
+inline void StartViewReplyMessage::clear_replicaidx() {
+  _impl_.replicaidx_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline uint32_t StartViewReplyMessage::_internal_replicaidx() const {
+  return _impl_.replicaidx_;
+}
+inline uint32_t StartViewReplyMessage::replicaidx() const {
+  // @@protoc_insertion_point(field_get:dsnet.nopaxos.proto.StartViewReplyMessage.replicaidx)
+  return _internal_replicaidx();
+}
+inline void StartViewReplyMessage::_internal_set_replicaidx(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.replicaidx_ = value;
+}
+inline void StartViewReplyMessage::set_replicaidx(uint32_t value) {
+  _internal_set_replicaidx(value);
+  // @@protoc_insertion_point(field_set:dsnet.nopaxos.proto.StartViewReplyMessage.replicaidx)
+}
+
+// -------------------------------------------------------------------
+
+// SyncPrepareRequestMessage
+
+// required uint64 sessnum = 1;
+inline bool SyncPrepareRequestMessage::_internal_has_sessnum() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool SyncPrepareRequestMessage::has_sessnum() const {
+  return _internal_has_sessnum();
+}
+inline void SyncPrepareRequestMessage::clear_sessnum() {
+  _impl_.sessnum_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline uint64_t SyncPrepareRequestMessage::_internal_sessnum() const {
+  return _impl_.sessnum_;
+}
+inline uint64_t SyncPrepareRequestMessage::sessnum() const {
+  // @@protoc_insertion_point(field_get:dsnet.nopaxos.proto.SyncPrepareRequestMessage.sessnum)
+  return _internal_sessnum();
+}
+inline void SyncPrepareRequestMessage::_internal_set_sessnum(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.sessnum_ = value;
+}
+inline void SyncPrepareRequestMessage::set_sessnum(uint64_t value) {
+  _internal_set_sessnum(value);
+  // @@protoc_insertion_point(field_set:dsnet.nopaxos.proto.SyncPrepareRequestMessage.sessnum)
+}
+
+// required uint64 view = 2;
+inline bool SyncPrepareRequestMessage::_internal_has_view() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool SyncPrepareRequestMessage::has_view() const {
+  return _internal_has_view();
+}
+inline void SyncPrepareRequestMessage::clear_view() {
+  _impl_.view_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline uint64_t SyncPrepareRequestMessage::_internal_view() const {
+  return _impl_.view_;
+}
+inline uint64_t SyncPrepareRequestMessage::view() const {
+  // @@protoc_insertion_point(field_get:dsnet.nopaxos.proto.SyncPrepareRequestMessage.view)
+  return _internal_view();
+}
+inline void SyncPrepareRequestMessage::_internal_set_view(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.view_ = value;
+}
+inline void SyncPrepareRequestMessage::set_view(uint64_t value) {
+  _internal_set_view(value);
+  // @@protoc_insertion_point(field_set:dsnet.nopaxos.proto.SyncPrepareRequestMessage.view)
+}
+
+// -------------------------------------------------------------------
+
+// SyncPrepareMessage
+
+// required uint64 sessnum = 1;
+inline bool SyncPrepareMessage::_internal_has_sessnum() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool SyncPrepareMessage::has_sessnum() const {
+  return _internal_has_sessnum();
+}
+inline void SyncPrepareMessage::clear_sessnum() {
+  _impl_.sessnum_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline uint64_t SyncPrepareMessage::_internal_sessnum() const {
+  return _impl_.sessnum_;
+}
+inline uint64_t SyncPrepareMessage::sessnum() const {
+  // @@protoc_insertion_point(field_get:dsnet.nopaxos.proto.SyncPrepareMessage.sessnum)
+  return _internal_sessnum();
+}
+inline void SyncPrepareMessage::_internal_set_sessnum(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.sessnum_ = value;
+}
+inline void SyncPrepareMessage::set_sessnum(uint64_t value) {
+  _internal_set_sessnum(value);
+  // @@protoc_insertion_point(field_set:dsnet.nopaxos.proto.SyncPrepareMessage.sessnum)
+}
+
+// required uint64 view = 2;
+inline bool SyncPrepareMessage::_internal_has_view() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool SyncPrepareMessage::has_view() const {
+  return _internal_has_view();
+}
+inline void SyncPrepareMessage::clear_view() {
+  _impl_.view_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline uint64_t SyncPrepareMessage::_internal_view() const {
+  return _impl_.view_;
+}
+inline uint64_t SyncPrepareMessage::view() const {
+  // @@protoc_insertion_point(field_get:dsnet.nopaxos.proto.SyncPrepareMessage.view)
+  return _internal_view();
+}
+inline void SyncPrepareMessage::_internal_set_view(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.view_ = value;
+}
+inline void SyncPrepareMessage::set_view(uint64_t value) {
+  _internal_set_view(value);
+  // @@protoc_insertion_point(field_set:dsnet.nopaxos.proto.SyncPrepareMessage.view)
+}
+
+// required uint64 lastop = 3;
+inline bool SyncPrepareMessage::_internal_has_lastop() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool SyncPrepareMessage::has_lastop() const {
+  return _internal_has_lastop();
+}
+inline void SyncPrepareMessage::clear_lastop() {
+  _impl_.lastop_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline uint64_t SyncPrepareMessage::_internal_lastop() const {
+  return _impl_.lastop_;
+}
+inline uint64_t SyncPrepareMessage::lastop() const {
+  // @@protoc_insertion_point(field_get:dsnet.nopaxos.proto.SyncPrepareMessage.lastop)
+  return _internal_lastop();
+}
+inline void SyncPrepareMessage::_internal_set_lastop(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.lastop_ = value;
+}
+inline void SyncPrepareMessage::set_lastop(uint64_t value) {
+  _internal_set_lastop(value);
+  // @@protoc_insertion_point(field_set:dsnet.nopaxos.proto.SyncPrepareMessage.lastop)
+}
+
+// repeated uint64 committedgaps = 4;
+inline int SyncPrepareMessage::_internal_committedgaps_size() const {
+  return _impl_.committedgaps_.size();
+}
+inline int SyncPrepareMessage::committedgaps_size() const {
+  return _internal_committedgaps_size();
+}
+inline void SyncPrepareMessage::clear_committedgaps() {
+  _impl_.committedgaps_.Clear();
+}
+inline uint64_t SyncPrepareMessage::_internal_committedgaps(int index) const {
+  return _impl_.committedgaps_.Get(index);
+}
+inline uint64_t SyncPrepareMessage::committedgaps(int index) const {
+  // @@protoc_insertion_point(field_get:dsnet.nopaxos.proto.SyncPrepareMessage.committedgaps)
+  return _internal_committedgaps(index);
+}
+inline void SyncPrepareMessage::set_committedgaps(int index, uint64_t value) {
+  _impl_.committedgaps_.Set(index, value);
+  // @@protoc_insertion_point(field_set:dsnet.nopaxos.proto.SyncPrepareMessage.committedgaps)
+}
+inline void SyncPrepareMessage::_internal_add_committedgaps(uint64_t value) {
+  _impl_.committedgaps_.Add(value);
+}
+inline void SyncPrepareMessage::add_committedgaps(uint64_t value) {
+  _internal_add_committedgaps(value);
+  // @@protoc_insertion_point(field_add:dsnet.nopaxos.proto.SyncPrepareMessage.committedgaps)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >&
+SyncPrepareMessage::_internal_committedgaps() const {
+  return _impl_.committedgaps_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >&
+SyncPrepareMessage::committedgaps() const {
+  // @@protoc_insertion_point(field_list:dsnet.nopaxos.proto.SyncPrepareMessage.committedgaps)
+  return _internal_committedgaps();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >*
+SyncPrepareMessage::_internal_mutable_committedgaps() {
+  return &_impl_.committedgaps_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >*
+SyncPrepareMessage::mutable_committedgaps() {
+  // @@protoc_insertion_point(field_mutable_list:dsnet.nopaxos.proto.SyncPrepareMessage.committedgaps)
+  return _internal_mutable_committedgaps();
+}
+
+// -------------------------------------------------------------------
+
+// SyncPrepareReplyMessage
+
+// required uint64 sessnum = 1;
+inline bool SyncPrepareReplyMessage::_internal_has_sessnum() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool SyncPrepareReplyMessage::has_sessnum() const {
+  return _internal_has_sessnum();
+}
+inline void SyncPrepareReplyMessage::clear_sessnum() {
+  _impl_.sessnum_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline uint64_t SyncPrepareReplyMessage::_internal_sessnum() const {
+  return _impl_.sessnum_;
+}
+inline uint64_t SyncPrepareReplyMessage::sessnum() const {
+  // @@protoc_insertion_point(field_get:dsnet.nopaxos.proto.SyncPrepareReplyMessage.sessnum)
+  return _internal_sessnum();
+}
+inline void SyncPrepareReplyMessage::_internal_set_sessnum(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.sessnum_ = value;
+}
+inline void SyncPrepareReplyMessage::set_sessnum(uint64_t value) {
+  _internal_set_sessnum(value);
+  // @@protoc_insertion_point(field_set:dsnet.nopaxos.proto.SyncPrepareReplyMessage.sessnum)
+}
+
+// required uint64 view = 2;
+inline bool SyncPrepareReplyMessage::_internal_has_view() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool SyncPrepareReplyMessage::has_view() const {
+  return _internal_has_view();
+}
+inline void SyncPrepareReplyMessage::clear_view() {
+  _impl_.view_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline uint64_t SyncPrepareReplyMessage::_internal_view() const {
+  return _impl_.view_;
+}
+inline uint64_t SyncPrepareReplyMessage::view() const {
+  // @@protoc_insertion_point(field_get:dsnet.nopaxos.proto.SyncPrepareReplyMessage.view)
+  return _internal_view();
+}
+inline void SyncPrepareReplyMessage::_internal_set_view(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.view_ = value;
+}
+inline void SyncPrepareReplyMessage::set_view(uint64_t value) {
+  _internal_set_view(value);
+  // @@protoc_insertion_point(field_set:dsnet.nopaxos.proto.SyncPrepareReplyMessage.view)
+}
+
+// required uint64 syncpoint = 3;
+inline bool SyncPrepareReplyMessage::_internal_has_syncpoint() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool SyncPrepareReplyMessage::has_syncpoint() const {
+  return _internal_has_syncpoint();
+}
+inline void SyncPrepareReplyMessage::clear_syncpoint() {
+  _impl_.syncpoint_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline uint64_t SyncPrepareReplyMessage::_internal_syncpoint() const {
+  return _impl_.syncpoint_;
+}
+inline uint64_t SyncPrepareReplyMessage::syncpoint() const {
+  // @@protoc_insertion_point(field_get:dsnet.nopaxos.proto.SyncPrepareReplyMessage.syncpoint)
+  return _internal_syncpoint();
+}
+inline void SyncPrepareReplyMessage::_internal_set_syncpoint(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.syncpoint_ = value;
+}
+inline void SyncPrepareReplyMessage::set_syncpoint(uint64_t value) {
+  _internal_set_syncpoint(value);
+  // @@protoc_insertion_point(field_set:dsnet.nopaxos.proto.SyncPrepareReplyMessage.syncpoint)
+}
+
+// required uint32 replicaidx = 4;
+inline bool SyncPrepareReplyMessage::_internal_has_replicaidx() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  return value;
+}
+inline bool SyncPrepareReplyMessage::has_replicaidx() const {
+  return _internal_has_replicaidx();
+}
+inline void SyncPrepareReplyMessage::clear_replicaidx() {
+  _impl_.replicaidx_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000008u;
+}
+inline uint32_t SyncPrepareReplyMessage::_internal_replicaidx() const {
+  return _impl_.replicaidx_;
+}
+inline uint32_t SyncPrepareReplyMessage::replicaidx() const {
+  // @@protoc_insertion_point(field_get:dsnet.nopaxos.proto.SyncPrepareReplyMessage.replicaidx)
+  return _internal_replicaidx();
+}
+inline void SyncPrepareReplyMessage::_internal_set_replicaidx(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  _impl_.replicaidx_ = value;
+}
+inline void SyncPrepareReplyMessage::set_replicaidx(uint32_t value) {
+  _internal_set_replicaidx(value);
+  // @@protoc_insertion_point(field_set:dsnet.nopaxos.proto.SyncPrepareReplyMessage.replicaidx)
+}
+
+// -------------------------------------------------------------------
+
+// SyncCommitMessage
+
+// required uint64 sessnum = 1;
+inline bool SyncCommitMessage::_internal_has_sessnum() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool SyncCommitMessage::has_sessnum() const {
+  return _internal_has_sessnum();
+}
+inline void SyncCommitMessage::clear_sessnum() {
+  _impl_.sessnum_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline uint64_t SyncCommitMessage::_internal_sessnum() const {
+  return _impl_.sessnum_;
+}
+inline uint64_t SyncCommitMessage::sessnum() const {
+  // @@protoc_insertion_point(field_get:dsnet.nopaxos.proto.SyncCommitMessage.sessnum)
+  return _internal_sessnum();
+}
+inline void SyncCommitMessage::_internal_set_sessnum(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.sessnum_ = value;
+}
+inline void SyncCommitMessage::set_sessnum(uint64_t value) {
+  _internal_set_sessnum(value);
+  // @@protoc_insertion_point(field_set:dsnet.nopaxos.proto.SyncCommitMessage.sessnum)
+}
+
+// required uint64 view = 2;
+inline bool SyncCommitMessage::_internal_has_view() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool SyncCommitMessage::has_view() const {
+  return _internal_has_view();
+}
+inline void SyncCommitMessage::clear_view() {
+  _impl_.view_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline uint64_t SyncCommitMessage::_internal_view() const {
+  return _impl_.view_;
+}
+inline uint64_t SyncCommitMessage::view() const {
+  // @@protoc_insertion_point(field_get:dsnet.nopaxos.proto.SyncCommitMessage.view)
+  return _internal_view();
+}
+inline void SyncCommitMessage::_internal_set_view(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.view_ = value;
+}
+inline void SyncCommitMessage::set_view(uint64_t value) {
+  _internal_set_view(value);
+  // @@protoc_insertion_point(field_set:dsnet.nopaxos.proto.SyncCommitMessage.view)
+}
+
+// required uint64 syncpoint = 3;
+inline bool SyncCommitMessage::_internal_has_syncpoint() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool SyncCommitMessage::has_syncpoint() const {
+  return _internal_has_syncpoint();
+}
+inline void SyncCommitMessage::clear_syncpoint() {
+  _impl_.syncpoint_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline uint64_t SyncCommitMessage::_internal_syncpoint() const {
+  return _impl_.syncpoint_;
+}
+inline uint64_t SyncCommitMessage::syncpoint() const {
+  // @@protoc_insertion_point(field_get:dsnet.nopaxos.proto.SyncCommitMessage.syncpoint)
+  return _internal_syncpoint();
+}
+inline void SyncCommitMessage::_internal_set_syncpoint(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.syncpoint_ = value;
+}
+inline void SyncCommitMessage::set_syncpoint(uint64_t value) {
+  _internal_set_syncpoint(value);
+  // @@protoc_insertion_point(field_set:dsnet.nopaxos.proto.SyncCommitMessage.syncpoint)
+}
+
+// -------------------------------------------------------------------
+
+// ToReplicaMessage
+
+// .dsnet.nopaxos.proto.RequestMessage request = 1;
+inline bool ToReplicaMessage::_internal_has_request() const {
+  return msg_case() == kRequest;
+}
+inline bool ToReplicaMessage::has_request() const {
+  return _internal_has_request();
+}
+inline void ToReplicaMessage::set_has_request() {
+  _impl_._oneof_case_[0] = kRequest;
+}
+inline void ToReplicaMessage::clear_request() {
+  if (_internal_has_request()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.msg_.request_;
+    }
+    clear_has_msg();
+  }
+}
+inline ::dsnet::nopaxos::proto::RequestMessage* ToReplicaMessage::release_request() {
+  // @@protoc_insertion_point(field_release:dsnet.nopaxos.proto.ToReplicaMessage.request)
+  if (_internal_has_request()) {
+    clear_has_msg();
+    ::dsnet::nopaxos::proto::RequestMessage* temp = _impl_.msg_.request_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.msg_.request_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::dsnet::nopaxos::proto::RequestMessage& ToReplicaMessage::_internal_request() const {
+  return _internal_has_request()
+      ? *_impl_.msg_.request_
+      : reinterpret_cast< ::dsnet::nopaxos::proto::RequestMessage&>(::dsnet::nopaxos::proto::_RequestMessage_default_instance_);
+}
+inline const ::dsnet::nopaxos::proto::RequestMessage& ToReplicaMessage::request() const {
+  // @@protoc_insertion_point(field_get:dsnet.nopaxos.proto.ToReplicaMessage.request)
+  return _internal_request();
+}
+inline ::dsnet::nopaxos::proto::RequestMessage* ToReplicaMessage::unsafe_arena_release_request() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:dsnet.nopaxos.proto.ToReplicaMessage.request)
+  if (_internal_has_request()) {
+    clear_has_msg();
+    ::dsnet::nopaxos::proto::RequestMessage* temp = _impl_.msg_.request_;
+    _impl_.msg_.request_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void ToReplicaMessage::unsafe_arena_set_allocated_request(::dsnet::nopaxos::proto::RequestMessage* request) {
+  clear_msg();
+  if (request) {
+    set_has_request();
+    _impl_.msg_.request_ = request;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:dsnet.nopaxos.proto.ToReplicaMessage.request)
+}
+inline ::dsnet::nopaxos::proto::RequestMessage* ToReplicaMessage::_internal_mutable_request() {
+  if (!_internal_has_request()) {
+    clear_msg();
+    set_has_request();
+    _impl_.msg_.request_ = CreateMaybeMessage< ::dsnet::nopaxos::proto::RequestMessage >(GetArenaForAllocation());
+  }
+  return _impl_.msg_.request_;
+}
+inline ::dsnet::nopaxos::proto::RequestMessage* ToReplicaMessage::mutable_request() {
+  ::dsnet::nopaxos::proto::RequestMessage* _msg = _internal_mutable_request();
+  // @@protoc_insertion_point(field_mutable:dsnet.nopaxos.proto.ToReplicaMessage.request)
+  return _msg;
+}
+
+// .dsnet.nopaxos.proto.UnloggedRequestMessage unlogged_request = 2;
+inline bool ToReplicaMessage::_internal_has_unlogged_request() const {
+  return msg_case() == kUnloggedRequest;
+}
+inline bool ToReplicaMessage::has_unlogged_request() const {
+  return _internal_has_unlogged_request();
+}
+inline void ToReplicaMessage::set_has_unlogged_request() {
+  _impl_._oneof_case_[0] = kUnloggedRequest;
+}
+inline void ToReplicaMessage::clear_unlogged_request() {
+  if (_internal_has_unlogged_request()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.msg_.unlogged_request_;
+    }
+    clear_has_msg();
+  }
+}
+inline ::dsnet::nopaxos::proto::UnloggedRequestMessage* ToReplicaMessage::release_unlogged_request() {
+  // @@protoc_insertion_point(field_release:dsnet.nopaxos.proto.ToReplicaMessage.unlogged_request)
+  if (_internal_has_unlogged_request()) {
+    clear_has_msg();
+    ::dsnet::nopaxos::proto::UnloggedRequestMessage* temp = _impl_.msg_.unlogged_request_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.msg_.unlogged_request_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::dsnet::nopaxos::proto::UnloggedRequestMessage& ToReplicaMessage::_internal_unlogged_request() const {
+  return _internal_has_unlogged_request()
+      ? *_impl_.msg_.unlogged_request_
+      : reinterpret_cast< ::dsnet::nopaxos::proto::UnloggedRequestMessage&>(::dsnet::nopaxos::proto::_UnloggedRequestMessage_default_instance_);
+}
+inline const ::dsnet::nopaxos::proto::UnloggedRequestMessage& ToReplicaMessage::unlogged_request() const {
+  // @@protoc_insertion_point(field_get:dsnet.nopaxos.proto.ToReplicaMessage.unlogged_request)
+  return _internal_unlogged_request();
+}
+inline ::dsnet::nopaxos::proto::UnloggedRequestMessage* ToReplicaMessage::unsafe_arena_release_unlogged_request() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:dsnet.nopaxos.proto.ToReplicaMessage.unlogged_request)
+  if (_internal_has_unlogged_request()) {
+    clear_has_msg();
+    ::dsnet::nopaxos::proto::UnloggedRequestMessage* temp = _impl_.msg_.unlogged_request_;
+    _impl_.msg_.unlogged_request_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void ToReplicaMessage::unsafe_arena_set_allocated_unlogged_request(::dsnet::nopaxos::proto::UnloggedRequestMessage* unlogged_request) {
+  clear_msg();
+  if (unlogged_request) {
+    set_has_unlogged_request();
+    _impl_.msg_.unlogged_request_ = unlogged_request;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:dsnet.nopaxos.proto.ToReplicaMessage.unlogged_request)
+}
+inline ::dsnet::nopaxos::proto::UnloggedRequestMessage* ToReplicaMessage::_internal_mutable_unlogged_request() {
+  if (!_internal_has_unlogged_request()) {
+    clear_msg();
+    set_has_unlogged_request();
+    _impl_.msg_.unlogged_request_ = CreateMaybeMessage< ::dsnet::nopaxos::proto::UnloggedRequestMessage >(GetArenaForAllocation());
+  }
+  return _impl_.msg_.unlogged_request_;
+}
+inline ::dsnet::nopaxos::proto::UnloggedRequestMessage* ToReplicaMessage::mutable_unlogged_request() {
+  ::dsnet::nopaxos::proto::UnloggedRequestMessage* _msg = _internal_mutable_unlogged_request();
+  // @@protoc_insertion_point(field_mutable:dsnet.nopaxos.proto.ToReplicaMessage.unlogged_request)
+  return _msg;
+}
+
+// .dsnet.nopaxos.proto.GapRequestMessage gap_request = 3;
+inline bool ToReplicaMessage::_internal_has_gap_request() const {
+  return msg_case() == kGapRequest;
+}
+inline bool ToReplicaMessage::has_gap_request() const {
+  return _internal_has_gap_request();
+}
+inline void ToReplicaMessage::set_has_gap_request() {
+  _impl_._oneof_case_[0] = kGapRequest;
+}
+inline void ToReplicaMessage::clear_gap_request() {
+  if (_internal_has_gap_request()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.msg_.gap_request_;
+    }
+    clear_has_msg();
+  }
+}
+inline ::dsnet::nopaxos::proto::GapRequestMessage* ToReplicaMessage::release_gap_request() {
+  // @@protoc_insertion_point(field_release:dsnet.nopaxos.proto.ToReplicaMessage.gap_request)
+  if (_internal_has_gap_request()) {
+    clear_has_msg();
+    ::dsnet::nopaxos::proto::GapRequestMessage* temp = _impl_.msg_.gap_request_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.msg_.gap_request_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::dsnet::nopaxos::proto::GapRequestMessage& ToReplicaMessage::_internal_gap_request() const {
+  return _internal_has_gap_request()
+      ? *_impl_.msg_.gap_request_
+      : reinterpret_cast< ::dsnet::nopaxos::proto::GapRequestMessage&>(::dsnet::nopaxos::proto::_GapRequestMessage_default_instance_);
+}
+inline const ::dsnet::nopaxos::proto::GapRequestMessage& ToReplicaMessage::gap_request() const {
+  // @@protoc_insertion_point(field_get:dsnet.nopaxos.proto.ToReplicaMessage.gap_request)
+  return _internal_gap_request();
+}
+inline ::dsnet::nopaxos::proto::GapRequestMessage* ToReplicaMessage::unsafe_arena_release_gap_request() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:dsnet.nopaxos.proto.ToReplicaMessage.gap_request)
+  if (_internal_has_gap_request()) {
+    clear_has_msg();
+    ::dsnet::nopaxos::proto::GapRequestMessage* temp = _impl_.msg_.gap_request_;
+    _impl_.msg_.gap_request_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void ToReplicaMessage::unsafe_arena_set_allocated_gap_request(::dsnet::nopaxos::proto::GapRequestMessage* gap_request) {
+  clear_msg();
+  if (gap_request) {
+    set_has_gap_request();
+    _impl_.msg_.gap_request_ = gap_request;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:dsnet.nopaxos.proto.ToReplicaMessage.gap_request)
+}
+inline ::dsnet::nopaxos::proto::GapRequestMessage* ToReplicaMessage::_internal_mutable_gap_request() {
+  if (!_internal_has_gap_request()) {
+    clear_msg();
+    set_has_gap_request();
+    _impl_.msg_.gap_request_ = CreateMaybeMessage< ::dsnet::nopaxos::proto::GapRequestMessage >(GetArenaForAllocation());
+  }
+  return _impl_.msg_.gap_request_;
+}
+inline ::dsnet::nopaxos::proto::GapRequestMessage* ToReplicaMessage::mutable_gap_request() {
+  ::dsnet::nopaxos::proto::GapRequestMessage* _msg = _internal_mutable_gap_request();
+  // @@protoc_insertion_point(field_mutable:dsnet.nopaxos.proto.ToReplicaMessage.gap_request)
+  return _msg;
+}
+
+// .dsnet.nopaxos.proto.GapReplyMessage gap_reply = 4;
+inline bool ToReplicaMessage::_internal_has_gap_reply() const {
+  return msg_case() == kGapReply;
+}
+inline bool ToReplicaMessage::has_gap_reply() const {
+  return _internal_has_gap_reply();
+}
+inline void ToReplicaMessage::set_has_gap_reply() {
+  _impl_._oneof_case_[0] = kGapReply;
+}
+inline void ToReplicaMessage::clear_gap_reply() {
+  if (_internal_has_gap_reply()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.msg_.gap_reply_;
+    }
+    clear_has_msg();
+  }
+}
+inline ::dsnet::nopaxos::proto::GapReplyMessage* ToReplicaMessage::release_gap_reply() {
+  // @@protoc_insertion_point(field_release:dsnet.nopaxos.proto.ToReplicaMessage.gap_reply)
+  if (_internal_has_gap_reply()) {
+    clear_has_msg();
+    ::dsnet::nopaxos::proto::GapReplyMessage* temp = _impl_.msg_.gap_reply_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.msg_.gap_reply_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::dsnet::nopaxos::proto::GapReplyMessage& ToReplicaMessage::_internal_gap_reply() const {
+  return _internal_has_gap_reply()
+      ? *_impl_.msg_.gap_reply_
+      : reinterpret_cast< ::dsnet::nopaxos::proto::GapReplyMessage&>(::dsnet::nopaxos::proto::_GapReplyMessage_default_instance_);
+}
+inline const ::dsnet::nopaxos::proto::GapReplyMessage& ToReplicaMessage::gap_reply() const {
+  // @@protoc_insertion_point(field_get:dsnet.nopaxos.proto.ToReplicaMessage.gap_reply)
+  return _internal_gap_reply();
+}
+inline ::dsnet::nopaxos::proto::GapReplyMessage* ToReplicaMessage::unsafe_arena_release_gap_reply() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:dsnet.nopaxos.proto.ToReplicaMessage.gap_reply)
+  if (_internal_has_gap_reply()) {
+    clear_has_msg();
+    ::dsnet::nopaxos::proto::GapReplyMessage* temp = _impl_.msg_.gap_reply_;
+    _impl_.msg_.gap_reply_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void ToReplicaMessage::unsafe_arena_set_allocated_gap_reply(::dsnet::nopaxos::proto::GapReplyMessage* gap_reply) {
+  clear_msg();
+  if (gap_reply) {
+    set_has_gap_reply();
+    _impl_.msg_.gap_reply_ = gap_reply;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:dsnet.nopaxos.proto.ToReplicaMessage.gap_reply)
+}
+inline ::dsnet::nopaxos::proto::GapReplyMessage* ToReplicaMessage::_internal_mutable_gap_reply() {
+  if (!_internal_has_gap_reply()) {
+    clear_msg();
+    set_has_gap_reply();
+    _impl_.msg_.gap_reply_ = CreateMaybeMessage< ::dsnet::nopaxos::proto::GapReplyMessage >(GetArenaForAllocation());
+  }
+  return _impl_.msg_.gap_reply_;
+}
+inline ::dsnet::nopaxos::proto::GapReplyMessage* ToReplicaMessage::mutable_gap_reply() {
+  ::dsnet::nopaxos::proto::GapReplyMessage* _msg = _internal_mutable_gap_reply();
+  // @@protoc_insertion_point(field_mutable:dsnet.nopaxos.proto.ToReplicaMessage.gap_reply)
+  return _msg;
+}
+
+// .dsnet.nopaxos.proto.StateTransferRequestMessage state_transfer_request = 5;
+inline bool ToReplicaMessage::_internal_has_state_transfer_request() const {
+  return msg_case() == kStateTransferRequest;
+}
+inline bool ToReplicaMessage::has_state_transfer_request() const {
+  return _internal_has_state_transfer_request();
+}
+inline void ToReplicaMessage::set_has_state_transfer_request() {
+  _impl_._oneof_case_[0] = kStateTransferRequest;
+}
+inline void ToReplicaMessage::clear_state_transfer_request() {
+  if (_internal_has_state_transfer_request()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.msg_.state_transfer_request_;
+    }
+    clear_has_msg();
+  }
+}
+inline ::dsnet::nopaxos::proto::StateTransferRequestMessage* ToReplicaMessage::release_state_transfer_request() {
+  // @@protoc_insertion_point(field_release:dsnet.nopaxos.proto.ToReplicaMessage.state_transfer_request)
+  if (_internal_has_state_transfer_request()) {
+    clear_has_msg();
+    ::dsnet::nopaxos::proto::StateTransferRequestMessage* temp = _impl_.msg_.state_transfer_request_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.msg_.state_transfer_request_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::dsnet::nopaxos::proto::StateTransferRequestMessage& ToReplicaMessage::_internal_state_transfer_request() const {
+  return _internal_has_state_transfer_request()
+      ? *_impl_.msg_.state_transfer_request_
+      : reinterpret_cast< ::dsnet::nopaxos::proto::StateTransferRequestMessage&>(::dsnet::nopaxos::proto::_StateTransferRequestMessage_default_instance_);
+}
+inline const ::dsnet::nopaxos::proto::StateTransferRequestMessage& ToReplicaMessage::state_transfer_request() const {
+  // @@protoc_insertion_point(field_get:dsnet.nopaxos.proto.ToReplicaMessage.state_transfer_request)
+  return _internal_state_transfer_request();
+}
+inline ::dsnet::nopaxos::proto::StateTransferRequestMessage* ToReplicaMessage::unsafe_arena_release_state_transfer_request() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:dsnet.nopaxos.proto.ToReplicaMessage.state_transfer_request)
+  if (_internal_has_state_transfer_request()) {
+    clear_has_msg();
+    ::dsnet::nopaxos::proto::StateTransferRequestMessage* temp = _impl_.msg_.state_transfer_request_;
+    _impl_.msg_.state_transfer_request_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void ToReplicaMessage::unsafe_arena_set_allocated_state_transfer_request(::dsnet::nopaxos::proto::StateTransferRequestMessage* state_transfer_request) {
+  clear_msg();
+  if (state_transfer_request) {
+    set_has_state_transfer_request();
+    _impl_.msg_.state_transfer_request_ = state_transfer_request;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:dsnet.nopaxos.proto.ToReplicaMessage.state_transfer_request)
+}
+inline ::dsnet::nopaxos::proto::StateTransferRequestMessage* ToReplicaMessage::_internal_mutable_state_transfer_request() {
+  if (!_internal_has_state_transfer_request()) {
+    clear_msg();
+    set_has_state_transfer_request();
+    _impl_.msg_.state_transfer_request_ = CreateMaybeMessage< ::dsnet::nopaxos::proto::StateTransferRequestMessage >(GetArenaForAllocation());
+  }
+  return _impl_.msg_.state_transfer_request_;
+}
+inline ::dsnet::nopaxos::proto::StateTransferRequestMessage* ToReplicaMessage::mutable_state_transfer_request() {
+  ::dsnet::nopaxos::proto::StateTransferRequestMessage* _msg = _internal_mutable_state_transfer_request();
+  // @@protoc_insertion_point(field_mutable:dsnet.nopaxos.proto.ToReplicaMessage.state_transfer_request)
+  return _msg;
+}
+
+// .dsnet.nopaxos.proto.StateTransferReplyMessage state_transfer_reply = 6;
+inline bool ToReplicaMessage::_internal_has_state_transfer_reply() const {
+  return msg_case() == kStateTransferReply;
+}
+inline bool ToReplicaMessage::has_state_transfer_reply() const {
+  return _internal_has_state_transfer_reply();
+}
+inline void ToReplicaMessage::set_has_state_transfer_reply() {
+  _impl_._oneof_case_[0] = kStateTransferReply;
+}
+inline void ToReplicaMessage::clear_state_transfer_reply() {
+  if (_internal_has_state_transfer_reply()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.msg_.state_transfer_reply_;
+    }
+    clear_has_msg();
+  }
+}
+inline ::dsnet::nopaxos::proto::StateTransferReplyMessage* ToReplicaMessage::release_state_transfer_reply() {
+  // @@protoc_insertion_point(field_release:dsnet.nopaxos.proto.ToReplicaMessage.state_transfer_reply)
+  if (_internal_has_state_transfer_reply()) {
+    clear_has_msg();
+    ::dsnet::nopaxos::proto::StateTransferReplyMessage* temp = _impl_.msg_.state_transfer_reply_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.msg_.state_transfer_reply_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::dsnet::nopaxos::proto::StateTransferReplyMessage& ToReplicaMessage::_internal_state_transfer_reply() const {
+  return _internal_has_state_transfer_reply()
+      ? *_impl_.msg_.state_transfer_reply_
+      : reinterpret_cast< ::dsnet::nopaxos::proto::StateTransferReplyMessage&>(::dsnet::nopaxos::proto::_StateTransferReplyMessage_default_instance_);
+}
+inline const ::dsnet::nopaxos::proto::StateTransferReplyMessage& ToReplicaMessage::state_transfer_reply() const {
+  // @@protoc_insertion_point(field_get:dsnet.nopaxos.proto.ToReplicaMessage.state_transfer_reply)
+  return _internal_state_transfer_reply();
+}
+inline ::dsnet::nopaxos::proto::StateTransferReplyMessage* ToReplicaMessage::unsafe_arena_release_state_transfer_reply() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:dsnet.nopaxos.proto.ToReplicaMessage.state_transfer_reply)
+  if (_internal_has_state_transfer_reply()) {
+    clear_has_msg();
+    ::dsnet::nopaxos::proto::StateTransferReplyMessage* temp = _impl_.msg_.state_transfer_reply_;
+    _impl_.msg_.state_transfer_reply_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void ToReplicaMessage::unsafe_arena_set_allocated_state_transfer_reply(::dsnet::nopaxos::proto::StateTransferReplyMessage* state_transfer_reply) {
+  clear_msg();
+  if (state_transfer_reply) {
+    set_has_state_transfer_reply();
+    _impl_.msg_.state_transfer_reply_ = state_transfer_reply;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:dsnet.nopaxos.proto.ToReplicaMessage.state_transfer_reply)
+}
+inline ::dsnet::nopaxos::proto::StateTransferReplyMessage* ToReplicaMessage::_internal_mutable_state_transfer_reply() {
+  if (!_internal_has_state_transfer_reply()) {
+    clear_msg();
+    set_has_state_transfer_reply();
+    _impl_.msg_.state_transfer_reply_ = CreateMaybeMessage< ::dsnet::nopaxos::proto::StateTransferReplyMessage >(GetArenaForAllocation());
+  }
+  return _impl_.msg_.state_transfer_reply_;
+}
+inline ::dsnet::nopaxos::proto::StateTransferReplyMessage* ToReplicaMessage::mutable_state_transfer_reply() {
+  ::dsnet::nopaxos::proto::StateTransferReplyMessage* _msg = _internal_mutable_state_transfer_reply();
+  // @@protoc_insertion_point(field_mutable:dsnet.nopaxos.proto.ToReplicaMessage.state_transfer_reply)
+  return _msg;
+}
+
+// .dsnet.nopaxos.proto.GapCommitMessage gap_commit = 7;
+inline bool ToReplicaMessage::_internal_has_gap_commit() const {
+  return msg_case() == kGapCommit;
+}
+inline bool ToReplicaMessage::has_gap_commit() const {
+  return _internal_has_gap_commit();
+}
+inline void ToReplicaMessage::set_has_gap_commit() {
+  _impl_._oneof_case_[0] = kGapCommit;
+}
+inline void ToReplicaMessage::clear_gap_commit() {
+  if (_internal_has_gap_commit()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.msg_.gap_commit_;
+    }
+    clear_has_msg();
+  }
+}
+inline ::dsnet::nopaxos::proto::GapCommitMessage* ToReplicaMessage::release_gap_commit() {
+  // @@protoc_insertion_point(field_release:dsnet.nopaxos.proto.ToReplicaMessage.gap_commit)
+  if (_internal_has_gap_commit()) {
+    clear_has_msg();
+    ::dsnet::nopaxos::proto::GapCommitMessage* temp = _impl_.msg_.gap_commit_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.msg_.gap_commit_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::dsnet::nopaxos::proto::GapCommitMessage& ToReplicaMessage::_internal_gap_commit() const {
+  return _internal_has_gap_commit()
+      ? *_impl_.msg_.gap_commit_
+      : reinterpret_cast< ::dsnet::nopaxos::proto::GapCommitMessage&>(::dsnet::nopaxos::proto::_GapCommitMessage_default_instance_);
+}
+inline const ::dsnet::nopaxos::proto::GapCommitMessage& ToReplicaMessage::gap_commit() const {
+  // @@protoc_insertion_point(field_get:dsnet.nopaxos.proto.ToReplicaMessage.gap_commit)
+  return _internal_gap_commit();
+}
+inline ::dsnet::nopaxos::proto::GapCommitMessage* ToReplicaMessage::unsafe_arena_release_gap_commit() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:dsnet.nopaxos.proto.ToReplicaMessage.gap_commit)
+  if (_internal_has_gap_commit()) {
+    clear_has_msg();
+    ::dsnet::nopaxos::proto::GapCommitMessage* temp = _impl_.msg_.gap_commit_;
+    _impl_.msg_.gap_commit_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void ToReplicaMessage::unsafe_arena_set_allocated_gap_commit(::dsnet::nopaxos::proto::GapCommitMessage* gap_commit) {
+  clear_msg();
+  if (gap_commit) {
+    set_has_gap_commit();
+    _impl_.msg_.gap_commit_ = gap_commit;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:dsnet.nopaxos.proto.ToReplicaMessage.gap_commit)
+}
+inline ::dsnet::nopaxos::proto::GapCommitMessage* ToReplicaMessage::_internal_mutable_gap_commit() {
+  if (!_internal_has_gap_commit()) {
+    clear_msg();
+    set_has_gap_commit();
+    _impl_.msg_.gap_commit_ = CreateMaybeMessage< ::dsnet::nopaxos::proto::GapCommitMessage >(GetArenaForAllocation());
+  }
+  return _impl_.msg_.gap_commit_;
+}
+inline ::dsnet::nopaxos::proto::GapCommitMessage* ToReplicaMessage::mutable_gap_commit() {
+  ::dsnet::nopaxos::proto::GapCommitMessage* _msg = _internal_mutable_gap_commit();
+  // @@protoc_insertion_point(field_mutable:dsnet.nopaxos.proto.ToReplicaMessage.gap_commit)
+  return _msg;
+}
+
+// .dsnet.nopaxos.proto.GapCommitReplyMessage gap_commit_reply = 8;
+inline bool ToReplicaMessage::_internal_has_gap_commit_reply() const {
+  return msg_case() == kGapCommitReply;
+}
+inline bool ToReplicaMessage::has_gap_commit_reply() const {
+  return _internal_has_gap_commit_reply();
+}
+inline void ToReplicaMessage::set_has_gap_commit_reply() {
+  _impl_._oneof_case_[0] = kGapCommitReply;
+}
+inline void ToReplicaMessage::clear_gap_commit_reply() {
+  if (_internal_has_gap_commit_reply()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.msg_.gap_commit_reply_;
+    }
+    clear_has_msg();
+  }
+}
+inline ::dsnet::nopaxos::proto::GapCommitReplyMessage* ToReplicaMessage::release_gap_commit_reply() {
+  // @@protoc_insertion_point(field_release:dsnet.nopaxos.proto.ToReplicaMessage.gap_commit_reply)
+  if (_internal_has_gap_commit_reply()) {
+    clear_has_msg();
+    ::dsnet::nopaxos::proto::GapCommitReplyMessage* temp = _impl_.msg_.gap_commit_reply_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.msg_.gap_commit_reply_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::dsnet::nopaxos::proto::GapCommitReplyMessage& ToReplicaMessage::_internal_gap_commit_reply() const {
+  return _internal_has_gap_commit_reply()
+      ? *_impl_.msg_.gap_commit_reply_
+      : reinterpret_cast< ::dsnet::nopaxos::proto::GapCommitReplyMessage&>(::dsnet::nopaxos::proto::_GapCommitReplyMessage_default_instance_);
+}
+inline const ::dsnet::nopaxos::proto::GapCommitReplyMessage& ToReplicaMessage::gap_commit_reply() const {
+  // @@protoc_insertion_point(field_get:dsnet.nopaxos.proto.ToReplicaMessage.gap_commit_reply)
+  return _internal_gap_commit_reply();
+}
+inline ::dsnet::nopaxos::proto::GapCommitReplyMessage* ToReplicaMessage::unsafe_arena_release_gap_commit_reply() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:dsnet.nopaxos.proto.ToReplicaMessage.gap_commit_reply)
+  if (_internal_has_gap_commit_reply()) {
+    clear_has_msg();
+    ::dsnet::nopaxos::proto::GapCommitReplyMessage* temp = _impl_.msg_.gap_commit_reply_;
+    _impl_.msg_.gap_commit_reply_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void ToReplicaMessage::unsafe_arena_set_allocated_gap_commit_reply(::dsnet::nopaxos::proto::GapCommitReplyMessage* gap_commit_reply) {
+  clear_msg();
+  if (gap_commit_reply) {
+    set_has_gap_commit_reply();
+    _impl_.msg_.gap_commit_reply_ = gap_commit_reply;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:dsnet.nopaxos.proto.ToReplicaMessage.gap_commit_reply)
+}
+inline ::dsnet::nopaxos::proto::GapCommitReplyMessage* ToReplicaMessage::_internal_mutable_gap_commit_reply() {
+  if (!_internal_has_gap_commit_reply()) {
+    clear_msg();
+    set_has_gap_commit_reply();
+    _impl_.msg_.gap_commit_reply_ = CreateMaybeMessage< ::dsnet::nopaxos::proto::GapCommitReplyMessage >(GetArenaForAllocation());
+  }
+  return _impl_.msg_.gap_commit_reply_;
+}
+inline ::dsnet::nopaxos::proto::GapCommitReplyMessage* ToReplicaMessage::mutable_gap_commit_reply() {
+  ::dsnet::nopaxos::proto::GapCommitReplyMessage* _msg = _internal_mutable_gap_commit_reply();
+  // @@protoc_insertion_point(field_mutable:dsnet.nopaxos.proto.ToReplicaMessage.gap_commit_reply)
+  return _msg;
+}
+
+// .dsnet.nopaxos.proto.ViewChangeRequestMessage view_change_request = 9;
+inline bool ToReplicaMessage::_internal_has_view_change_request() const {
+  return msg_case() == kViewChangeRequest;
+}
+inline bool ToReplicaMessage::has_view_change_request() const {
+  return _internal_has_view_change_request();
+}
+inline void ToReplicaMessage::set_has_view_change_request() {
+  _impl_._oneof_case_[0] = kViewChangeRequest;
+}
+inline void ToReplicaMessage::clear_view_change_request() {
+  if (_internal_has_view_change_request()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.msg_.view_change_request_;
+    }
+    clear_has_msg();
+  }
+}
+inline ::dsnet::nopaxos::proto::ViewChangeRequestMessage* ToReplicaMessage::release_view_change_request() {
+  // @@protoc_insertion_point(field_release:dsnet.nopaxos.proto.ToReplicaMessage.view_change_request)
+  if (_internal_has_view_change_request()) {
+    clear_has_msg();
+    ::dsnet::nopaxos::proto::ViewChangeRequestMessage* temp = _impl_.msg_.view_change_request_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.msg_.view_change_request_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::dsnet::nopaxos::proto::ViewChangeRequestMessage& ToReplicaMessage::_internal_view_change_request() const {
+  return _internal_has_view_change_request()
+      ? *_impl_.msg_.view_change_request_
+      : reinterpret_cast< ::dsnet::nopaxos::proto::ViewChangeRequestMessage&>(::dsnet::nopaxos::proto::_ViewChangeRequestMessage_default_instance_);
+}
+inline const ::dsnet::nopaxos::proto::ViewChangeRequestMessage& ToReplicaMessage::view_change_request() const {
+  // @@protoc_insertion_point(field_get:dsnet.nopaxos.proto.ToReplicaMessage.view_change_request)
+  return _internal_view_change_request();
+}
+inline ::dsnet::nopaxos::proto::ViewChangeRequestMessage* ToReplicaMessage::unsafe_arena_release_view_change_request() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:dsnet.nopaxos.proto.ToReplicaMessage.view_change_request)
+  if (_internal_has_view_change_request()) {
+    clear_has_msg();
+    ::dsnet::nopaxos::proto::ViewChangeRequestMessage* temp = _impl_.msg_.view_change_request_;
+    _impl_.msg_.view_change_request_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void ToReplicaMessage::unsafe_arena_set_allocated_view_change_request(::dsnet::nopaxos::proto::ViewChangeRequestMessage* view_change_request) {
+  clear_msg();
+  if (view_change_request) {
+    set_has_view_change_request();
+    _impl_.msg_.view_change_request_ = view_change_request;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:dsnet.nopaxos.proto.ToReplicaMessage.view_change_request)
+}
+inline ::dsnet::nopaxos::proto::ViewChangeRequestMessage* ToReplicaMessage::_internal_mutable_view_change_request() {
+  if (!_internal_has_view_change_request()) {
+    clear_msg();
+    set_has_view_change_request();
+    _impl_.msg_.view_change_request_ = CreateMaybeMessage< ::dsnet::nopaxos::proto::ViewChangeRequestMessage >(GetArenaForAllocation());
+  }
+  return _impl_.msg_.view_change_request_;
+}
+inline ::dsnet::nopaxos::proto::ViewChangeRequestMessage* ToReplicaMessage::mutable_view_change_request() {
+  ::dsnet::nopaxos::proto::ViewChangeRequestMessage* _msg = _internal_mutable_view_change_request();
+  // @@protoc_insertion_point(field_mutable:dsnet.nopaxos.proto.ToReplicaMessage.view_change_request)
+  return _msg;
+}
+
+// .dsnet.nopaxos.proto.ViewChangeMessage view_change = 10;
+inline bool ToReplicaMessage::_internal_has_view_change() const {
+  return msg_case() == kViewChange;
+}
+inline bool ToReplicaMessage::has_view_change() const {
+  return _internal_has_view_change();
+}
+inline void ToReplicaMessage::set_has_view_change() {
+  _impl_._oneof_case_[0] = kViewChange;
+}
+inline void ToReplicaMessage::clear_view_change() {
+  if (_internal_has_view_change()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.msg_.view_change_;
+    }
+    clear_has_msg();
+  }
+}
+inline ::dsnet::nopaxos::proto::ViewChangeMessage* ToReplicaMessage::release_view_change() {
+  // @@protoc_insertion_point(field_release:dsnet.nopaxos.proto.ToReplicaMessage.view_change)
+  if (_internal_has_view_change()) {
+    clear_has_msg();
+    ::dsnet::nopaxos::proto::ViewChangeMessage* temp = _impl_.msg_.view_change_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.msg_.view_change_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::dsnet::nopaxos::proto::ViewChangeMessage& ToReplicaMessage::_internal_view_change() const {
+  return _internal_has_view_change()
+      ? *_impl_.msg_.view_change_
+      : reinterpret_cast< ::dsnet::nopaxos::proto::ViewChangeMessage&>(::dsnet::nopaxos::proto::_ViewChangeMessage_default_instance_);
+}
+inline const ::dsnet::nopaxos::proto::ViewChangeMessage& ToReplicaMessage::view_change() const {
+  // @@protoc_insertion_point(field_get:dsnet.nopaxos.proto.ToReplicaMessage.view_change)
+  return _internal_view_change();
+}
+inline ::dsnet::nopaxos::proto::ViewChangeMessage* ToReplicaMessage::unsafe_arena_release_view_change() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:dsnet.nopaxos.proto.ToReplicaMessage.view_change)
+  if (_internal_has_view_change()) {
+    clear_has_msg();
+    ::dsnet::nopaxos::proto::ViewChangeMessage* temp = _impl_.msg_.view_change_;
+    _impl_.msg_.view_change_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void ToReplicaMessage::unsafe_arena_set_allocated_view_change(::dsnet::nopaxos::proto::ViewChangeMessage* view_change) {
+  clear_msg();
+  if (view_change) {
+    set_has_view_change();
+    _impl_.msg_.view_change_ = view_change;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:dsnet.nopaxos.proto.ToReplicaMessage.view_change)
+}
+inline ::dsnet::nopaxos::proto::ViewChangeMessage* ToReplicaMessage::_internal_mutable_view_change() {
+  if (!_internal_has_view_change()) {
+    clear_msg();
+    set_has_view_change();
+    _impl_.msg_.view_change_ = CreateMaybeMessage< ::dsnet::nopaxos::proto::ViewChangeMessage >(GetArenaForAllocation());
+  }
+  return _impl_.msg_.view_change_;
+}
+inline ::dsnet::nopaxos::proto::ViewChangeMessage* ToReplicaMessage::mutable_view_change() {
+  ::dsnet::nopaxos::proto::ViewChangeMessage* _msg = _internal_mutable_view_change();
+  // @@protoc_insertion_point(field_mutable:dsnet.nopaxos.proto.ToReplicaMessage.view_change)
+  return _msg;
+}
+
+// .dsnet.nopaxos.proto.StartViewMessage start_view = 11;
+inline bool ToReplicaMessage::_internal_has_start_view() const {
+  return msg_case() == kStartView;
+}
+inline bool ToReplicaMessage::has_start_view() const {
+  return _internal_has_start_view();
+}
+inline void ToReplicaMessage::set_has_start_view() {
+  _impl_._oneof_case_[0] = kStartView;
+}
+inline void ToReplicaMessage::clear_start_view() {
+  if (_internal_has_start_view()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.msg_.start_view_;
+    }
+    clear_has_msg();
+  }
+}
+inline ::dsnet::nopaxos::proto::StartViewMessage* ToReplicaMessage::release_start_view() {
+  // @@protoc_insertion_point(field_release:dsnet.nopaxos.proto.ToReplicaMessage.start_view)
+  if (_internal_has_start_view()) {
+    clear_has_msg();
+    ::dsnet::nopaxos::proto::StartViewMessage* temp = _impl_.msg_.start_view_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.msg_.start_view_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::dsnet::nopaxos::proto::StartViewMessage& ToReplicaMessage::_internal_start_view() const {
+  return _internal_has_start_view()
+      ? *_impl_.msg_.start_view_
+      : reinterpret_cast< ::dsnet::nopaxos::proto::StartViewMessage&>(::dsnet::nopaxos::proto::_StartViewMessage_default_instance_);
+}
+inline const ::dsnet::nopaxos::proto::StartViewMessage& ToReplicaMessage::start_view() const {
+  // @@protoc_insertion_point(field_get:dsnet.nopaxos.proto.ToReplicaMessage.start_view)
+  return _internal_start_view();
+}
+inline ::dsnet::nopaxos::proto::StartViewMessage* ToReplicaMessage::unsafe_arena_release_start_view() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:dsnet.nopaxos.proto.ToReplicaMessage.start_view)
+  if (_internal_has_start_view()) {
+    clear_has_msg();
+    ::dsnet::nopaxos::proto::StartViewMessage* temp = _impl_.msg_.start_view_;
+    _impl_.msg_.start_view_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void ToReplicaMessage::unsafe_arena_set_allocated_start_view(::dsnet::nopaxos::proto::StartViewMessage* start_view) {
+  clear_msg();
+  if (start_view) {
+    set_has_start_view();
+    _impl_.msg_.start_view_ = start_view;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:dsnet.nopaxos.proto.ToReplicaMessage.start_view)
+}
+inline ::dsnet::nopaxos::proto::StartViewMessage* ToReplicaMessage::_internal_mutable_start_view() {
+  if (!_internal_has_start_view()) {
+    clear_msg();
+    set_has_start_view();
+    _impl_.msg_.start_view_ = CreateMaybeMessage< ::dsnet::nopaxos::proto::StartViewMessage >(GetArenaForAllocation());
+  }
+  return _impl_.msg_.start_view_;
+}
+inline ::dsnet::nopaxos::proto::StartViewMessage* ToReplicaMessage::mutable_start_view() {
+  ::dsnet::nopaxos::proto::StartViewMessage* _msg = _internal_mutable_start_view();
+  // @@protoc_insertion_point(field_mutable:dsnet.nopaxos.proto.ToReplicaMessage.start_view)
+  return _msg;
+}
+
+// .dsnet.nopaxos.proto.StartViewReplyMessage start_view_reply = 12;
+inline bool ToReplicaMessage::_internal_has_start_view_reply() const {
+  return msg_case() == kStartViewReply;
+}
+inline bool ToReplicaMessage::has_start_view_reply() const {
+  return _internal_has_start_view_reply();
+}
+inline void ToReplicaMessage::set_has_start_view_reply() {
+  _impl_._oneof_case_[0] = kStartViewReply;
+}
+inline void ToReplicaMessage::clear_start_view_reply() {
+  if (_internal_has_start_view_reply()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.msg_.start_view_reply_;
+    }
+    clear_has_msg();
+  }
+}
+inline ::dsnet::nopaxos::proto::StartViewReplyMessage* ToReplicaMessage::release_start_view_reply() {
+  // @@protoc_insertion_point(field_release:dsnet.nopaxos.proto.ToReplicaMessage.start_view_reply)
+  if (_internal_has_start_view_reply()) {
+    clear_has_msg();
+    ::dsnet::nopaxos::proto::StartViewReplyMessage* temp = _impl_.msg_.start_view_reply_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.msg_.start_view_reply_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::dsnet::nopaxos::proto::StartViewReplyMessage& ToReplicaMessage::_internal_start_view_reply() const {
+  return _internal_has_start_view_reply()
+      ? *_impl_.msg_.start_view_reply_
+      : reinterpret_cast< ::dsnet::nopaxos::proto::StartViewReplyMessage&>(::dsnet::nopaxos::proto::_StartViewReplyMessage_default_instance_);
+}
+inline const ::dsnet::nopaxos::proto::StartViewReplyMessage& ToReplicaMessage::start_view_reply() const {
+  // @@protoc_insertion_point(field_get:dsnet.nopaxos.proto.ToReplicaMessage.start_view_reply)
+  return _internal_start_view_reply();
+}
+inline ::dsnet::nopaxos::proto::StartViewReplyMessage* ToReplicaMessage::unsafe_arena_release_start_view_reply() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:dsnet.nopaxos.proto.ToReplicaMessage.start_view_reply)
+  if (_internal_has_start_view_reply()) {
+    clear_has_msg();
+    ::dsnet::nopaxos::proto::StartViewReplyMessage* temp = _impl_.msg_.start_view_reply_;
+    _impl_.msg_.start_view_reply_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void ToReplicaMessage::unsafe_arena_set_allocated_start_view_reply(::dsnet::nopaxos::proto::StartViewReplyMessage* start_view_reply) {
+  clear_msg();
+  if (start_view_reply) {
+    set_has_start_view_reply();
+    _impl_.msg_.start_view_reply_ = start_view_reply;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:dsnet.nopaxos.proto.ToReplicaMessage.start_view_reply)
+}
+inline ::dsnet::nopaxos::proto::StartViewReplyMessage* ToReplicaMessage::_internal_mutable_start_view_reply() {
+  if (!_internal_has_start_view_reply()) {
+    clear_msg();
+    set_has_start_view_reply();
+    _impl_.msg_.start_view_reply_ = CreateMaybeMessage< ::dsnet::nopaxos::proto::StartViewReplyMessage >(GetArenaForAllocation());
+  }
+  return _impl_.msg_.start_view_reply_;
+}
+inline ::dsnet::nopaxos::proto::StartViewReplyMessage* ToReplicaMessage::mutable_start_view_reply() {
+  ::dsnet::nopaxos::proto::StartViewReplyMessage* _msg = _internal_mutable_start_view_reply();
+  // @@protoc_insertion_point(field_mutable:dsnet.nopaxos.proto.ToReplicaMessage.start_view_reply)
+  return _msg;
+}
+
+// .dsnet.nopaxos.proto.SyncPrepareRequestMessage sync_prepare_request = 13;
+inline bool ToReplicaMessage::_internal_has_sync_prepare_request() const {
+  return msg_case() == kSyncPrepareRequest;
+}
+inline bool ToReplicaMessage::has_sync_prepare_request() const {
+  return _internal_has_sync_prepare_request();
+}
+inline void ToReplicaMessage::set_has_sync_prepare_request() {
+  _impl_._oneof_case_[0] = kSyncPrepareRequest;
+}
+inline void ToReplicaMessage::clear_sync_prepare_request() {
+  if (_internal_has_sync_prepare_request()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.msg_.sync_prepare_request_;
+    }
+    clear_has_msg();
+  }
+}
+inline ::dsnet::nopaxos::proto::SyncPrepareRequestMessage* ToReplicaMessage::release_sync_prepare_request() {
+  // @@protoc_insertion_point(field_release:dsnet.nopaxos.proto.ToReplicaMessage.sync_prepare_request)
+  if (_internal_has_sync_prepare_request()) {
+    clear_has_msg();
+    ::dsnet::nopaxos::proto::SyncPrepareRequestMessage* temp = _impl_.msg_.sync_prepare_request_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.msg_.sync_prepare_request_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::dsnet::nopaxos::proto::SyncPrepareRequestMessage& ToReplicaMessage::_internal_sync_prepare_request() const {
+  return _internal_has_sync_prepare_request()
+      ? *_impl_.msg_.sync_prepare_request_
+      : reinterpret_cast< ::dsnet::nopaxos::proto::SyncPrepareRequestMessage&>(::dsnet::nopaxos::proto::_SyncPrepareRequestMessage_default_instance_);
+}
+inline const ::dsnet::nopaxos::proto::SyncPrepareRequestMessage& ToReplicaMessage::sync_prepare_request() const {
+  // @@protoc_insertion_point(field_get:dsnet.nopaxos.proto.ToReplicaMessage.sync_prepare_request)
+  return _internal_sync_prepare_request();
+}
+inline ::dsnet::nopaxos::proto::SyncPrepareRequestMessage* ToReplicaMessage::unsafe_arena_release_sync_prepare_request() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:dsnet.nopaxos.proto.ToReplicaMessage.sync_prepare_request)
+  if (_internal_has_sync_prepare_request()) {
+    clear_has_msg();
+    ::dsnet::nopaxos::proto::SyncPrepareRequestMessage* temp = _impl_.msg_.sync_prepare_request_;
+    _impl_.msg_.sync_prepare_request_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void ToReplicaMessage::unsafe_arena_set_allocated_sync_prepare_request(::dsnet::nopaxos::proto::SyncPrepareRequestMessage* sync_prepare_request) {
+  clear_msg();
+  if (sync_prepare_request) {
+    set_has_sync_prepare_request();
+    _impl_.msg_.sync_prepare_request_ = sync_prepare_request;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:dsnet.nopaxos.proto.ToReplicaMessage.sync_prepare_request)
+}
+inline ::dsnet::nopaxos::proto::SyncPrepareRequestMessage* ToReplicaMessage::_internal_mutable_sync_prepare_request() {
+  if (!_internal_has_sync_prepare_request()) {
+    clear_msg();
+    set_has_sync_prepare_request();
+    _impl_.msg_.sync_prepare_request_ = CreateMaybeMessage< ::dsnet::nopaxos::proto::SyncPrepareRequestMessage >(GetArenaForAllocation());
+  }
+  return _impl_.msg_.sync_prepare_request_;
+}
+inline ::dsnet::nopaxos::proto::SyncPrepareRequestMessage* ToReplicaMessage::mutable_sync_prepare_request() {
+  ::dsnet::nopaxos::proto::SyncPrepareRequestMessage* _msg = _internal_mutable_sync_prepare_request();
+  // @@protoc_insertion_point(field_mutable:dsnet.nopaxos.proto.ToReplicaMessage.sync_prepare_request)
+  return _msg;
+}
+
+// .dsnet.nopaxos.proto.SyncPrepareMessage sync_prepare = 14;
+inline bool ToReplicaMessage::_internal_has_sync_prepare() const {
+  return msg_case() == kSyncPrepare;
+}
+inline bool ToReplicaMessage::has_sync_prepare() const {
+  return _internal_has_sync_prepare();
+}
+inline void ToReplicaMessage::set_has_sync_prepare() {
+  _impl_._oneof_case_[0] = kSyncPrepare;
+}
+inline void ToReplicaMessage::clear_sync_prepare() {
+  if (_internal_has_sync_prepare()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.msg_.sync_prepare_;
+    }
+    clear_has_msg();
+  }
+}
+inline ::dsnet::nopaxos::proto::SyncPrepareMessage* ToReplicaMessage::release_sync_prepare() {
+  // @@protoc_insertion_point(field_release:dsnet.nopaxos.proto.ToReplicaMessage.sync_prepare)
+  if (_internal_has_sync_prepare()) {
+    clear_has_msg();
+    ::dsnet::nopaxos::proto::SyncPrepareMessage* temp = _impl_.msg_.sync_prepare_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.msg_.sync_prepare_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::dsnet::nopaxos::proto::SyncPrepareMessage& ToReplicaMessage::_internal_sync_prepare() const {
+  return _internal_has_sync_prepare()
+      ? *_impl_.msg_.sync_prepare_
+      : reinterpret_cast< ::dsnet::nopaxos::proto::SyncPrepareMessage&>(::dsnet::nopaxos::proto::_SyncPrepareMessage_default_instance_);
+}
+inline const ::dsnet::nopaxos::proto::SyncPrepareMessage& ToReplicaMessage::sync_prepare() const {
+  // @@protoc_insertion_point(field_get:dsnet.nopaxos.proto.ToReplicaMessage.sync_prepare)
+  return _internal_sync_prepare();
+}
+inline ::dsnet::nopaxos::proto::SyncPrepareMessage* ToReplicaMessage::unsafe_arena_release_sync_prepare() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:dsnet.nopaxos.proto.ToReplicaMessage.sync_prepare)
+  if (_internal_has_sync_prepare()) {
+    clear_has_msg();
+    ::dsnet::nopaxos::proto::SyncPrepareMessage* temp = _impl_.msg_.sync_prepare_;
+    _impl_.msg_.sync_prepare_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void ToReplicaMessage::unsafe_arena_set_allocated_sync_prepare(::dsnet::nopaxos::proto::SyncPrepareMessage* sync_prepare) {
+  clear_msg();
+  if (sync_prepare) {
+    set_has_sync_prepare();
+    _impl_.msg_.sync_prepare_ = sync_prepare;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:dsnet.nopaxos.proto.ToReplicaMessage.sync_prepare)
+}
+inline ::dsnet::nopaxos::proto::SyncPrepareMessage* ToReplicaMessage::_internal_mutable_sync_prepare() {
+  if (!_internal_has_sync_prepare()) {
+    clear_msg();
+    set_has_sync_prepare();
+    _impl_.msg_.sync_prepare_ = CreateMaybeMessage< ::dsnet::nopaxos::proto::SyncPrepareMessage >(GetArenaForAllocation());
+  }
+  return _impl_.msg_.sync_prepare_;
+}
+inline ::dsnet::nopaxos::proto::SyncPrepareMessage* ToReplicaMessage::mutable_sync_prepare() {
+  ::dsnet::nopaxos::proto::SyncPrepareMessage* _msg = _internal_mutable_sync_prepare();
+  // @@protoc_insertion_point(field_mutable:dsnet.nopaxos.proto.ToReplicaMessage.sync_prepare)
+  return _msg;
+}
+
+// .dsnet.nopaxos.proto.SyncPrepareReplyMessage sync_prepare_reply = 15;
+inline bool ToReplicaMessage::_internal_has_sync_prepare_reply() const {
+  return msg_case() == kSyncPrepareReply;
+}
+inline bool ToReplicaMessage::has_sync_prepare_reply() const {
+  return _internal_has_sync_prepare_reply();
+}
+inline void ToReplicaMessage::set_has_sync_prepare_reply() {
+  _impl_._oneof_case_[0] = kSyncPrepareReply;
+}
+inline void ToReplicaMessage::clear_sync_prepare_reply() {
+  if (_internal_has_sync_prepare_reply()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.msg_.sync_prepare_reply_;
+    }
+    clear_has_msg();
+  }
+}
+inline ::dsnet::nopaxos::proto::SyncPrepareReplyMessage* ToReplicaMessage::release_sync_prepare_reply() {
+  // @@protoc_insertion_point(field_release:dsnet.nopaxos.proto.ToReplicaMessage.sync_prepare_reply)
+  if (_internal_has_sync_prepare_reply()) {
+    clear_has_msg();
+    ::dsnet::nopaxos::proto::SyncPrepareReplyMessage* temp = _impl_.msg_.sync_prepare_reply_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.msg_.sync_prepare_reply_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::dsnet::nopaxos::proto::SyncPrepareReplyMessage& ToReplicaMessage::_internal_sync_prepare_reply() const {
+  return _internal_has_sync_prepare_reply()
+      ? *_impl_.msg_.sync_prepare_reply_
+      : reinterpret_cast< ::dsnet::nopaxos::proto::SyncPrepareReplyMessage&>(::dsnet::nopaxos::proto::_SyncPrepareReplyMessage_default_instance_);
+}
+inline const ::dsnet::nopaxos::proto::SyncPrepareReplyMessage& ToReplicaMessage::sync_prepare_reply() const {
+  // @@protoc_insertion_point(field_get:dsnet.nopaxos.proto.ToReplicaMessage.sync_prepare_reply)
+  return _internal_sync_prepare_reply();
+}
+inline ::dsnet::nopaxos::proto::SyncPrepareReplyMessage* ToReplicaMessage::unsafe_arena_release_sync_prepare_reply() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:dsnet.nopaxos.proto.ToReplicaMessage.sync_prepare_reply)
+  if (_internal_has_sync_prepare_reply()) {
+    clear_has_msg();
+    ::dsnet::nopaxos::proto::SyncPrepareReplyMessage* temp = _impl_.msg_.sync_prepare_reply_;
+    _impl_.msg_.sync_prepare_reply_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void ToReplicaMessage::unsafe_arena_set_allocated_sync_prepare_reply(::dsnet::nopaxos::proto::SyncPrepareReplyMessage* sync_prepare_reply) {
+  clear_msg();
+  if (sync_prepare_reply) {
+    set_has_sync_prepare_reply();
+    _impl_.msg_.sync_prepare_reply_ = sync_prepare_reply;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:dsnet.nopaxos.proto.ToReplicaMessage.sync_prepare_reply)
+}
+inline ::dsnet::nopaxos::proto::SyncPrepareReplyMessage* ToReplicaMessage::_internal_mutable_sync_prepare_reply() {
+  if (!_internal_has_sync_prepare_reply()) {
+    clear_msg();
+    set_has_sync_prepare_reply();
+    _impl_.msg_.sync_prepare_reply_ = CreateMaybeMessage< ::dsnet::nopaxos::proto::SyncPrepareReplyMessage >(GetArenaForAllocation());
+  }
+  return _impl_.msg_.sync_prepare_reply_;
+}
+inline ::dsnet::nopaxos::proto::SyncPrepareReplyMessage* ToReplicaMessage::mutable_sync_prepare_reply() {
+  ::dsnet::nopaxos::proto::SyncPrepareReplyMessage* _msg = _internal_mutable_sync_prepare_reply();
+  // @@protoc_insertion_point(field_mutable:dsnet.nopaxos.proto.ToReplicaMessage.sync_prepare_reply)
+  return _msg;
+}
+
+// .dsnet.nopaxos.proto.SyncCommitMessage sync_commit = 16;
+inline bool ToReplicaMessage::_internal_has_sync_commit() const {
+  return msg_case() == kSyncCommit;
+}
+inline bool ToReplicaMessage::has_sync_commit() const {
+  return _internal_has_sync_commit();
+}
+inline void ToReplicaMessage::set_has_sync_commit() {
+  _impl_._oneof_case_[0] = kSyncCommit;
+}
+inline void ToReplicaMessage::clear_sync_commit() {
+  if (_internal_has_sync_commit()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.msg_.sync_commit_;
+    }
+    clear_has_msg();
+  }
+}
+inline ::dsnet::nopaxos::proto::SyncCommitMessage* ToReplicaMessage::release_sync_commit() {
+  // @@protoc_insertion_point(field_release:dsnet.nopaxos.proto.ToReplicaMessage.sync_commit)
+  if (_internal_has_sync_commit()) {
+    clear_has_msg();
+    ::dsnet::nopaxos::proto::SyncCommitMessage* temp = _impl_.msg_.sync_commit_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.msg_.sync_commit_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::dsnet::nopaxos::proto::SyncCommitMessage& ToReplicaMessage::_internal_sync_commit() const {
+  return _internal_has_sync_commit()
+      ? *_impl_.msg_.sync_commit_
+      : reinterpret_cast< ::dsnet::nopaxos::proto::SyncCommitMessage&>(::dsnet::nopaxos::proto::_SyncCommitMessage_default_instance_);
+}
+inline const ::dsnet::nopaxos::proto::SyncCommitMessage& ToReplicaMessage::sync_commit() const {
+  // @@protoc_insertion_point(field_get:dsnet.nopaxos.proto.ToReplicaMessage.sync_commit)
+  return _internal_sync_commit();
+}
+inline ::dsnet::nopaxos::proto::SyncCommitMessage* ToReplicaMessage::unsafe_arena_release_sync_commit() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:dsnet.nopaxos.proto.ToReplicaMessage.sync_commit)
+  if (_internal_has_sync_commit()) {
+    clear_has_msg();
+    ::dsnet::nopaxos::proto::SyncCommitMessage* temp = _impl_.msg_.sync_commit_;
+    _impl_.msg_.sync_commit_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void ToReplicaMessage::unsafe_arena_set_allocated_sync_commit(::dsnet::nopaxos::proto::SyncCommitMessage* sync_commit) {
+  clear_msg();
+  if (sync_commit) {
+    set_has_sync_commit();
+    _impl_.msg_.sync_commit_ = sync_commit;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:dsnet.nopaxos.proto.ToReplicaMessage.sync_commit)
+}
+inline ::dsnet::nopaxos::proto::SyncCommitMessage* ToReplicaMessage::_internal_mutable_sync_commit() {
+  if (!_internal_has_sync_commit()) {
+    clear_msg();
+    set_has_sync_commit();
+    _impl_.msg_.sync_commit_ = CreateMaybeMessage< ::dsnet::nopaxos::proto::SyncCommitMessage >(GetArenaForAllocation());
+  }
+  return _impl_.msg_.sync_commit_;
+}
+inline ::dsnet::nopaxos::proto::SyncCommitMessage* ToReplicaMessage::mutable_sync_commit() {
+  ::dsnet::nopaxos::proto::SyncCommitMessage* _msg = _internal_mutable_sync_commit();
+  // @@protoc_insertion_point(field_mutable:dsnet.nopaxos.proto.ToReplicaMessage.sync_commit)
+  return _msg;
+}
+
+inline bool ToReplicaMessage::has_msg() const {
+  return msg_case() != MSG_NOT_SET;
+}
+inline void ToReplicaMessage::clear_has_msg() {
+  _impl_._oneof_case_[0] = MSG_NOT_SET;
+}
+inline ToReplicaMessage::MsgCase ToReplicaMessage::msg_case() const {
+  return ToReplicaMessage::MsgCase(_impl_._oneof_case_[0]);
+}
+#ifdef __GNUC__
+  #pragma GCC diagnostic pop
+#endif  // __GNUC__
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+
+// @@protoc_insertion_point(namespace_scope)
+
+}  // namespace proto
+}  // namespace nopaxos
+}  // namespace dsnet
+
+// @@protoc_insertion_point(global_scope)
+
+#include <google/protobuf/port_undef.inc>
+#endif  // GOOGLE_PROTOBUF_INCLUDED_GOOGLE_PROTOBUF_INCLUDED_replication_2fnopaxos_2fnopaxos_2dproto_2eproto
@@ -0,0 +1,3313 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: replication/pbft/message.proto
+
+#include "replication/pbft/message.pb.h"
+
+#include <algorithm>
+
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/extension_set.h>
+#include <google/protobuf/wire_format_lite.h>
+#include <google/protobuf/descriptor.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/reflection_ops.h>
+#include <google/protobuf/wire_format.h>
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+
+PROTOBUF_PRAGMA_INIT_SEG
+
+namespace _pb = ::PROTOBUF_NAMESPACE_ID;
+namespace _pbi = _pb::internal;
+
+namespace dsnet {
+namespace pbft {
+namespace proto {
+PROTOBUF_CONSTEXPR PBFTMessage::PBFTMessage(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.sub_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_._oneof_case_)*/{}} {}
+struct PBFTMessageDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR PBFTMessageDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~PBFTMessageDefaultTypeInternal() {}
+  union {
+    PBFTMessage _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 PBFTMessageDefaultTypeInternal _PBFTMessage_default_instance_;
+PROTOBUF_CONSTEXPR Reply::Reply(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.result_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.request_number_)*/uint64_t{0u}
+  , /*decltype(_impl_.replica_id_)*/0
+  , /*decltype(_impl_.view_number_)*/0u
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct ReplyDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ReplyDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ReplyDefaultTypeInternal() {}
+  union {
+    Reply _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ReplyDefaultTypeInternal _Reply_default_instance_;
+PROTOBUF_CONSTEXPR Preprepare::Preprepare(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.signed_message_)*/{}
+  , /*decltype(_impl_.signed_prepare_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct PreprepareDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR PreprepareDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~PreprepareDefaultTypeInternal() {}
+  union {
+    Preprepare _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 PreprepareDefaultTypeInternal _Preprepare_default_instance_;
+PROTOBUF_CONSTEXPR Prepare::Prepare(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.digest_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.op_number_)*/uint64_t{0u}
+  , /*decltype(_impl_.batch_size_)*/uint64_t{0u}
+  , /*decltype(_impl_.view_number_)*/0u
+  , /*decltype(_impl_.replica_id_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct PrepareDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR PrepareDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~PrepareDefaultTypeInternal() {}
+  union {
+    Prepare _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 PrepareDefaultTypeInternal _Prepare_default_instance_;
+PROTOBUF_CONSTEXPR Commit::Commit(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.digest_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.op_number_)*/uint64_t{0u}
+  , /*decltype(_impl_.batch_size_)*/uint64_t{0u}
+  , /*decltype(_impl_.view_number_)*/0u
+  , /*decltype(_impl_.replica_id_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct CommitDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR CommitDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~CommitDefaultTypeInternal() {}
+  union {
+    Commit _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 CommitDefaultTypeInternal _Commit_default_instance_;
+PROTOBUF_CONSTEXPR Checkpoint::Checkpoint(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.digest_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.op_number_)*/uint64_t{0u}
+  , /*decltype(_impl_.replica_id_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct CheckpointDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR CheckpointDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~CheckpointDefaultTypeInternal() {}
+  union {
+    Checkpoint _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 CheckpointDefaultTypeInternal _Checkpoint_default_instance_;
+PROTOBUF_CONSTEXPR StateRequest::StateRequest(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.op_number_)*/uint64_t{0u}
+  , /*decltype(_impl_.last_op_number_)*/uint64_t{0u}
+  , /*decltype(_impl_.replica_id_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct StateRequestDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR StateRequestDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~StateRequestDefaultTypeInternal() {}
+  union {
+    StateRequest _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 StateRequestDefaultTypeInternal _StateRequest_default_instance_;
+PROTOBUF_CONSTEXPR StateChunk::StateChunk(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.request_)*/{}
+  , /*decltype(_impl_.checkpoint_)*/nullptr
+  , /*decltype(_impl_.op_number_)*/uint64_t{0u}
+  , /*decltype(_impl_.view_number_)*/0u
+  , /*decltype(_impl_.replica_id_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct StateChunkDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR StateChunkDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~StateChunkDefaultTypeInternal() {}
+  union {
+    StateChunk _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 StateChunkDefaultTypeInternal _StateChunk_default_instance_;
+PROTOBUF_CONSTEXPR StableCheckpoint::StableCheckpoint(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.signed_checkpoint_)*/{}
+  , /*decltype(_impl_.digest_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.app_state_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.log_hash_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.op_number_)*/uint64_t{0u}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct StableCheckpointDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR StableCheckpointDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~StableCheckpointDefaultTypeInternal() {}
+  union {
+    StableCheckpoint _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 StableCheckpointDefaultTypeInternal _StableCheckpoint_default_instance_;
+}  // namespace proto
+}  // namespace pbft
+}  // namespace dsnet
+static ::_pb::Metadata file_level_metadata_replication_2fpbft_2fmessage_2eproto[9];
+static constexpr ::_pb::EnumDescriptor const** file_level_enum_descriptors_replication_2fpbft_2fmessage_2eproto = nullptr;
+static constexpr ::_pb::ServiceDescriptor const** file_level_service_descriptors_replication_2fpbft_2fmessage_2eproto = nullptr;
+
+const uint32_t TableStruct_replication_2fpbft_2fmessage_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::dsnet::pbft::proto::PBFTMessage, _internal_metadata_),
+  ~0u,  // no _extensions_
+  PROTOBUF_FIELD_OFFSET(::dsnet::pbft::proto::PBFTMessage, _impl_._oneof_case_[0]),
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  PROTOBUF_FIELD_OFFSET(::dsnet::pbft::proto::PBFTMessage, _impl_.sub_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::dsnet::pbft::proto::Reply, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::dsnet::pbft::proto::Reply, _impl_.result_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::pbft::proto::Reply, _impl_.request_number_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::pbft::proto::Reply, _impl_.replica_id_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::pbft::proto::Reply, _impl_.view_number_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::dsnet::pbft::proto::Preprepare, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::dsnet::pbft::proto::Preprepare, _impl_.signed_prepare_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::pbft::proto::Preprepare, _impl_.signed_message_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::dsnet::pbft::proto::Prepare, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::dsnet::pbft::proto::Prepare, _impl_.view_number_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::pbft::proto::Prepare, _impl_.op_number_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::pbft::proto::Prepare, _impl_.batch_size_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::pbft::proto::Prepare, _impl_.digest_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::pbft::proto::Prepare, _impl_.replica_id_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::dsnet::pbft::proto::Commit, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::dsnet::pbft::proto::Commit, _impl_.view_number_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::pbft::proto::Commit, _impl_.op_number_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::pbft::proto::Commit, _impl_.batch_size_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::pbft::proto::Commit, _impl_.digest_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::pbft::proto::Commit, _impl_.replica_id_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::dsnet::pbft::proto::Checkpoint, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::dsnet::pbft::proto::Checkpoint, _impl_.op_number_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::pbft::proto::Checkpoint, _impl_.digest_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::pbft::proto::Checkpoint, _impl_.replica_id_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::dsnet::pbft::proto::StateRequest, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::dsnet::pbft::proto::StateRequest, _impl_.op_number_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::pbft::proto::StateRequest, _impl_.last_op_number_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::pbft::proto::StateRequest, _impl_.replica_id_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::dsnet::pbft::proto::StateChunk, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::dsnet::pbft::proto::StateChunk, _impl_.op_number_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::pbft::proto::StateChunk, _impl_.view_number_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::pbft::proto::StateChunk, _impl_.request_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::pbft::proto::StateChunk, _impl_.checkpoint_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::pbft::proto::StateChunk, _impl_.replica_id_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::dsnet::pbft::proto::StableCheckpoint, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::dsnet::pbft::proto::StableCheckpoint, _impl_.op_number_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::pbft::proto::StableCheckpoint, _impl_.digest_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::pbft::proto::StableCheckpoint, _impl_.app_state_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::pbft::proto::StableCheckpoint, _impl_.signed_checkpoint_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::pbft::proto::StableCheckpoint, _impl_.log_hash_),
+};
+static const ::_pbi::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  { 0, -1, -1, sizeof(::dsnet::pbft::proto::PBFTMessage)},
+  { 14, -1, -1, sizeof(::dsnet::pbft::proto::Reply)},
+  { 24, -1, -1, sizeof(::dsnet::pbft::proto::Preprepare)},
+  { 32, -1, -1, sizeof(::dsnet::pbft::proto::Prepare)},
+  { 43, -1, -1, sizeof(::dsnet::pbft::proto::Commit)},
+  { 54, -1, -1, sizeof(::dsnet::pbft::proto::Checkpoint)},
+  { 63, -1, -1, sizeof(::dsnet::pbft::proto::StateRequest)},
+  { 72, -1, -1, sizeof(::dsnet::pbft::proto::StateChunk)},
+  { 83, -1, -1, sizeof(::dsnet::pbft::proto::StableCheckpoint)},
+};
+
+static const ::_pb::Message* const file_default_instances[] = {
+  &::dsnet::pbft::proto::_PBFTMessage_default_instance_._instance,
+  &::dsnet::pbft::proto::_Reply_default_instance_._instance,
+  &::dsnet::pbft::proto::_Preprepare_default_instance_._instance,
+  &::dsnet::pbft::proto::_Prepare_default_instance_._instance,
+  &::dsnet::pbft::proto::_Commit_default_instance_._instance,
+  &::dsnet::pbft::proto::_Checkpoint_default_instance_._instance,
+  &::dsnet::pbft::proto::_StateRequest_default_instance_._instance,
+  &::dsnet::pbft::proto::_StateChunk_default_instance_._instance,
+  &::dsnet::pbft::proto::_StableCheckpoint_default_instance_._instance,
+};
+
+const char descriptor_table_protodef_replication_2fpbft_2fmessage_2eproto[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) =
+  "\n\036replication/pbft/message.proto\022\020dsnet."
+  "pbft.proto\032\024common/request.proto\"\347\002\n\013PBF"
+  "TMessage\022!\n\007request\030\001 \001(\0132\016.dsnet.Reques"
+  "tH\000\0222\n\npreprepare\030\002 \001(\0132\034.dsnet.pbft.pro"
+  "to.PreprepareH\000\022,\n\007prepare\030\003 \001(\0132\031.dsnet"
+  ".pbft.proto.PrepareH\000\022*\n\006commit\030\004 \001(\0132\030."
+  "dsnet.pbft.proto.CommitH\000\0222\n\ncheckpoint\030"
+  "\005 \001(\0132\034.dsnet.pbft.proto.CheckpointH\000\0227\n"
+  "\rstate_request\030\006 \001(\0132\036.dsnet.pbft.proto."
+  "StateRequestH\000\0223\n\013state_chunk\030\007 \001(\0132\034.ds"
+  "net.pbft.proto.StateChunkH\000B\005\n\003sub\"X\n\005Re"
+  "ply\022\016\n\006result\030\001 \001(\014\022\026\n\016request_number\030\002 "
+  "\001(\004\022\022\n\nreplica_id\030\003 \001(\005\022\023\n\013view_number\030\004"
+  " \001(\r\"<\n\nPreprepare\022\026\n\016signed_prepare\030\001 \001"
+  "(\014\022\026\n\016signed_message\030\002 \003(\014\"i\n\007Prepare\022\023\n"
+  "\013view_number\030\001 \001(\r\022\021\n\top_number\030\002 \001(\004\022\022\n"
+  "\nbatch_size\030\003 \001(\004\022\016\n\006digest\030\004 \001(\014\022\022\n\nrep"
+  "lica_id\030\005 \001(\005\"h\n\006Commit\022\023\n\013view_number\030\001"
+  " \001(\r\022\021\n\top_number\030\002 \001(\004\022\022\n\nbatch_size\030\003 "
+  "\001(\004\022\016\n\006digest\030\004 \001(\014\022\022\n\nreplica_id\030\005 \001(\005\""
+  "C\n\nCheckpoint\022\021\n\top_number\030\001 \001(\004\022\016\n\006dige"
+  "st\030\002 \001(\014\022\022\n\nreplica_id\030\003 \001(\005\"M\n\014StateReq"
+  "uest\022\021\n\top_number\030\001 \001(\004\022\026\n\016last_op_numbe"
+  "r\030\002 \001(\004\022\022\n\nreplica_id\030\003 \001(\005\"\241\001\n\nStateChu"
+  "nk\022\021\n\top_number\030\001 \001(\004\022\023\n\013view_number\030\002 \001"
+  "(\r\022\037\n\007request\030\003 \003(\0132\016.dsnet.Request\0226\n\nc"
+  "heckpoint\030\004 \001(\0132\".dsnet.pbft.proto.Stabl"
+  "eCheckpoint\022\022\n\nreplica_id\030\005 \001(\005\"u\n\020Stabl"
+  "eCheckpoint\022\021\n\top_number\030\001 \001(\004\022\016\n\006digest"
+  "\030\002 \001(\014\022\021\n\tapp_state\030\003 \001(\014\022\031\n\021signed_chec"
+  "kpoint\030\004 \003(\014\022\020\n\010log_hash\030\005 \001(\014b\006proto3"
+  ;
+static const ::_pbi::DescriptorTable* const descriptor_table_replication_2fpbft_2fmessage_2eproto_deps[1] = {
+  &::descriptor_table_common_2frequest_2eproto,
+};
+static ::_pbi::once_flag descriptor_table_replication_2fpbft_2fmessage_2eproto_once;
+const ::_pbi::DescriptorTable descriptor_table_replication_2fpbft_2fmessage_2eproto = {
+    false, false, 1238, descriptor_table_protodef_replication_2fpbft_2fmessage_2eproto,
+    "replication/pbft/message.proto",
+    &descriptor_table_replication_2fpbft_2fmessage_2eproto_once, descriptor_table_replication_2fpbft_2fmessage_2eproto_deps, 1, 9,
+    schemas, file_default_instances, TableStruct_replication_2fpbft_2fmessage_2eproto::offsets,
+    file_level_metadata_replication_2fpbft_2fmessage_2eproto, file_level_enum_descriptors_replication_2fpbft_2fmessage_2eproto,
+    file_level_service_descriptors_replication_2fpbft_2fmessage_2eproto,
+};
+PROTOBUF_ATTRIBUTE_WEAK const ::_pbi::DescriptorTable* descriptor_table_replication_2fpbft_2fmessage_2eproto_getter() {
+  return &descriptor_table_replication_2fpbft_2fmessage_2eproto;
+}
+
+// Force running AddDescriptors() at dynamic initialization time.
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 static ::_pbi::AddDescriptorsRunner dynamic_init_dummy_replication_2fpbft_2fmessage_2eproto(&descriptor_table_replication_2fpbft_2fmessage_2eproto);
+namespace dsnet {
+namespace pbft {
+namespace proto {
+
+// ===================================================================
+
+class PBFTMessage::_Internal {
+ public:
+  static const ::dsnet::Request& request(const PBFTMessage* msg);
+  static const ::dsnet::pbft::proto::Preprepare& preprepare(const PBFTMessage* msg);
+  static const ::dsnet::pbft::proto::Prepare& prepare(const PBFTMessage* msg);
+  static const ::dsnet::pbft::proto::Commit& commit(const PBFTMessage* msg);
+  static const ::dsnet::pbft::proto::Checkpoint& checkpoint(const PBFTMessage* msg);
+  static const ::dsnet::pbft::proto::StateRequest& state_request(const PBFTMessage* msg);
+  static const ::dsnet::pbft::proto::StateChunk& state_chunk(const PBFTMessage* msg);
+};
+
+const ::dsnet::Request&
+PBFTMessage::_Internal::request(const PBFTMessage* msg) {
+  return *msg->_impl_.sub_.request_;
+}
+const ::dsnet::pbft::proto::Preprepare&
+PBFTMessage::_Internal::preprepare(const PBFTMessage* msg) {
+  return *msg->_impl_.sub_.preprepare_;
+}
+const ::dsnet::pbft::proto::Prepare&
+PBFTMessage::_Internal::prepare(const PBFTMessage* msg) {
+  return *msg->_impl_.sub_.prepare_;
+}
+const ::dsnet::pbft::proto::Commit&
+PBFTMessage::_Internal::commit(const PBFTMessage* msg) {
+  return *msg->_impl_.sub_.commit_;
+}
+const ::dsnet::pbft::proto::Checkpoint&
+PBFTMessage::_Internal::checkpoint(const PBFTMessage* msg) {
+  return *msg->_impl_.sub_.checkpoint_;
+}
+const ::dsnet::pbft::proto::StateRequest&
+PBFTMessage::_Internal::state_request(const PBFTMessage* msg) {
+  return *msg->_impl_.sub_.state_request_;
+}
+const ::dsnet::pbft::proto::StateChunk&
+PBFTMessage::_Internal::state_chunk(const PBFTMessage* msg) {
+  return *msg->_impl_.sub_.state_chunk_;
+}
+void PBFTMessage::set_allocated_request(::dsnet::Request* request) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  clear_sub();
+  if (request) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(
+                reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(request));
+    if (message_arena != submessage_arena) {
+      request = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, request, submessage_arena);
+    }
+    set_has_request();
+    _impl_.sub_.request_ = request;
+  }
+  // @@protoc_insertion_point(field_set_allocated:dsnet.pbft.proto.PBFTMessage.request)
+}
+void PBFTMessage::clear_request() {
+  if (_internal_has_request()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.sub_.request_;
+    }
+    clear_has_sub();
+  }
+}
+void PBFTMessage::set_allocated_preprepare(::dsnet::pbft::proto::Preprepare* preprepare) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  clear_sub();
+  if (preprepare) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(preprepare);
+    if (message_arena != submessage_arena) {
+      preprepare = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, preprepare, submessage_arena);
+    }
+    set_has_preprepare();
+    _impl_.sub_.preprepare_ = preprepare;
+  }
+  // @@protoc_insertion_point(field_set_allocated:dsnet.pbft.proto.PBFTMessage.preprepare)
+}
+void PBFTMessage::set_allocated_prepare(::dsnet::pbft::proto::Prepare* prepare) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  clear_sub();
+  if (prepare) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(prepare);
+    if (message_arena != submessage_arena) {
+      prepare = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, prepare, submessage_arena);
+    }
+    set_has_prepare();
+    _impl_.sub_.prepare_ = prepare;
+  }
+  // @@protoc_insertion_point(field_set_allocated:dsnet.pbft.proto.PBFTMessage.prepare)
+}
+void PBFTMessage::set_allocated_commit(::dsnet::pbft::proto::Commit* commit) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  clear_sub();
+  if (commit) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(commit);
+    if (message_arena != submessage_arena) {
+      commit = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, commit, submessage_arena);
+    }
+    set_has_commit();
+    _impl_.sub_.commit_ = commit;
+  }
+  // @@protoc_insertion_point(field_set_allocated:dsnet.pbft.proto.PBFTMessage.commit)
+}
+void PBFTMessage::set_allocated_checkpoint(::dsnet::pbft::proto::Checkpoint* checkpoint) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  clear_sub();
+  if (checkpoint) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(checkpoint);
+    if (message_arena != submessage_arena) {
+      checkpoint = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, checkpoint, submessage_arena);
+    }
+    set_has_checkpoint();
+    _impl_.sub_.checkpoint_ = checkpoint;
+  }
+  // @@protoc_insertion_point(field_set_allocated:dsnet.pbft.proto.PBFTMessage.checkpoint)
+}
+void PBFTMessage::set_allocated_state_request(::dsnet::pbft::proto::StateRequest* state_request) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  clear_sub();
+  if (state_request) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(state_request);
+    if (message_arena != submessage_arena) {
+      state_request = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, state_request, submessage_arena);
+    }
+    set_has_state_request();
+    _impl_.sub_.state_request_ = state_request;
+  }
+  // @@protoc_insertion_point(field_set_allocated:dsnet.pbft.proto.PBFTMessage.state_request)
+}
+void PBFTMessage::set_allocated_state_chunk(::dsnet::pbft::proto::StateChunk* state_chunk) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  clear_sub();
+  if (state_chunk) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(state_chunk);
+    if (message_arena != submessage_arena) {
+      state_chunk = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, state_chunk, submessage_arena);
+    }
+    set_has_state_chunk();
+    _impl_.sub_.state_chunk_ = state_chunk;
+  }
+  // @@protoc_insertion_point(field_set_allocated:dsnet.pbft.proto.PBFTMessage.state_chunk)
+}
+PBFTMessage::PBFTMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:dsnet.pbft.proto.PBFTMessage)
+}
+PBFTMessage::PBFTMessage(const PBFTMessage& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  PBFTMessage* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.sub_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , /*decltype(_impl_._oneof_case_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  clear_has_sub();
+  switch (from.sub_case()) {
+    case kRequest: {
+      _this->_internal_mutable_request()->::dsnet::Request::MergeFrom(
+          from._internal_request());
+      break;
+    }
+    case kPreprepare: {
+      _this->_internal_mutable_preprepare()->::dsnet::pbft::proto::Preprepare::MergeFrom(
+          from._internal_preprepare());
+      break;
+    }
+    case kPrepare: {
+      _this->_internal_mutable_prepare()->::dsnet::pbft::proto::Prepare::MergeFrom(
+          from._internal_prepare());
+      break;
+    }
+    case kCommit: {
+      _this->_internal_mutable_commit()->::dsnet::pbft::proto::Commit::MergeFrom(
+          from._internal_commit());
+      break;
+    }
+    case kCheckpoint: {
+      _this->_internal_mutable_checkpoint()->::dsnet::pbft::proto::Checkpoint::MergeFrom(
+          from._internal_checkpoint());
+      break;
+    }
+    case kStateRequest: {
+      _this->_internal_mutable_state_request()->::dsnet::pbft::proto::StateRequest::MergeFrom(
+          from._internal_state_request());
+      break;
+    }
+    case kStateChunk: {
+      _this->_internal_mutable_state_chunk()->::dsnet::pbft::proto::StateChunk::MergeFrom(
+          from._internal_state_chunk());
+      break;
+    }
+    case SUB_NOT_SET: {
+      break;
+    }
+  }
+  // @@protoc_insertion_point(copy_constructor:dsnet.pbft.proto.PBFTMessage)
+}
+
+inline void PBFTMessage::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.sub_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , /*decltype(_impl_._oneof_case_)*/{}
+  };
+  clear_has_sub();
+}
+
+PBFTMessage::~PBFTMessage() {
+  // @@protoc_insertion_point(destructor:dsnet.pbft.proto.PBFTMessage)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void PBFTMessage::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  if (has_sub()) {
+    clear_sub();
+  }
+}
+
+void PBFTMessage::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void PBFTMessage::clear_sub() {
+// @@protoc_insertion_point(one_of_clear_start:dsnet.pbft.proto.PBFTMessage)
+  switch (sub_case()) {
+    case kRequest: {
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.sub_.request_;
+      }
+      break;
+    }
+    case kPreprepare: {
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.sub_.preprepare_;
+      }
+      break;
+    }
+    case kPrepare: {
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.sub_.prepare_;
+      }
+      break;
+    }
+    case kCommit: {
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.sub_.commit_;
+      }
+      break;
+    }
+    case kCheckpoint: {
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.sub_.checkpoint_;
+      }
+      break;
+    }
+    case kStateRequest: {
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.sub_.state_request_;
+      }
+      break;
+    }
+    case kStateChunk: {
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.sub_.state_chunk_;
+      }
+      break;
+    }
+    case SUB_NOT_SET: {
+      break;
+    }
+  }
+  _impl_._oneof_case_[0] = SUB_NOT_SET;
+}
+
+
+void PBFTMessage::Clear() {
+// @@protoc_insertion_point(message_clear_start:dsnet.pbft.proto.PBFTMessage)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  clear_sub();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* PBFTMessage::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // .dsnet.Request request = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr = ctx->ParseMessage(_internal_mutable_request(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .dsnet.pbft.proto.Preprepare preprepare = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr = ctx->ParseMessage(_internal_mutable_preprepare(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .dsnet.pbft.proto.Prepare prepare = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          ptr = ctx->ParseMessage(_internal_mutable_prepare(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .dsnet.pbft.proto.Commit commit = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          ptr = ctx->ParseMessage(_internal_mutable_commit(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .dsnet.pbft.proto.Checkpoint checkpoint = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 42)) {
+          ptr = ctx->ParseMessage(_internal_mutable_checkpoint(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .dsnet.pbft.proto.StateRequest state_request = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 50)) {
+          ptr = ctx->ParseMessage(_internal_mutable_state_request(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .dsnet.pbft.proto.StateChunk state_chunk = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 58)) {
+          ptr = ctx->ParseMessage(_internal_mutable_state_chunk(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* PBFTMessage::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:dsnet.pbft.proto.PBFTMessage)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // .dsnet.Request request = 1;
+  if (_internal_has_request()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(1, _Internal::request(this),
+        _Internal::request(this).GetCachedSize(), target, stream);
+  }
+
+  // .dsnet.pbft.proto.Preprepare preprepare = 2;
+  if (_internal_has_preprepare()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(2, _Internal::preprepare(this),
+        _Internal::preprepare(this).GetCachedSize(), target, stream);
+  }
+
+  // .dsnet.pbft.proto.Prepare prepare = 3;
+  if (_internal_has_prepare()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(3, _Internal::prepare(this),
+        _Internal::prepare(this).GetCachedSize(), target, stream);
+  }
+
+  // .dsnet.pbft.proto.Commit commit = 4;
+  if (_internal_has_commit()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(4, _Internal::commit(this),
+        _Internal::commit(this).GetCachedSize(), target, stream);
+  }
+
+  // .dsnet.pbft.proto.Checkpoint checkpoint = 5;
+  if (_internal_has_checkpoint()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(5, _Internal::checkpoint(this),
+        _Internal::checkpoint(this).GetCachedSize(), target, stream);
+  }
+
+  // .dsnet.pbft.proto.StateRequest state_request = 6;
+  if (_internal_has_state_request()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(6, _Internal::state_request(this),
+        _Internal::state_request(this).GetCachedSize(), target, stream);
+  }
+
+  // .dsnet.pbft.proto.StateChunk state_chunk = 7;
+  if (_internal_has_state_chunk()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(7, _Internal::state_chunk(this),
+        _Internal::state_chunk(this).GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:dsnet.pbft.proto.PBFTMessage)
+  return target;
+}
+
+size_t PBFTMessage::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:dsnet.pbft.proto.PBFTMessage)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  switch (sub_case()) {
+    // .dsnet.Request request = 1;
+    case kRequest: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.sub_.request_);
+      break;
+    }
+    // .dsnet.pbft.proto.Preprepare preprepare = 2;
+    case kPreprepare: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.sub_.preprepare_);
+      break;
+    }
+    // .dsnet.pbft.proto.Prepare prepare = 3;
+    case kPrepare: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.sub_.prepare_);
+      break;
+    }
+    // .dsnet.pbft.proto.Commit commit = 4;
+    case kCommit: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.sub_.commit_);
+      break;
+    }
+    // .dsnet.pbft.proto.Checkpoint checkpoint = 5;
+    case kCheckpoint: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.sub_.checkpoint_);
+      break;
+    }
+    // .dsnet.pbft.proto.StateRequest state_request = 6;
+    case kStateRequest: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.sub_.state_request_);
+      break;
+    }
+    // .dsnet.pbft.proto.StateChunk state_chunk = 7;
+    case kStateChunk: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.sub_.state_chunk_);
+      break;
+    }
+    case SUB_NOT_SET: {
+      break;
+    }
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData PBFTMessage::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    PBFTMessage::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*PBFTMessage::GetClassData() const { return &_class_data_; }
+
+
+void PBFTMessage::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<PBFTMessage*>(&to_msg);
+  auto& from = static_cast<const PBFTMessage&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:dsnet.pbft.proto.PBFTMessage)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  switch (from.sub_case()) {
+    case kRequest: {
+      _this->_internal_mutable_request()->::dsnet::Request::MergeFrom(
+          from._internal_request());
+      break;
+    }
+    case kPreprepare: {
+      _this->_internal_mutable_preprepare()->::dsnet::pbft::proto::Preprepare::MergeFrom(
+          from._internal_preprepare());
+      break;
+    }
+    case kPrepare: {
+      _this->_internal_mutable_prepare()->::dsnet::pbft::proto::Prepare::MergeFrom(
+          from._internal_prepare());
+      break;
+    }
+    case kCommit: {
+      _this->_internal_mutable_commit()->::dsnet::pbft::proto::Commit::MergeFrom(
+          from._internal_commit());
+      break;
+    }
+    case kCheckpoint: {
+      _this->_internal_mutable_checkpoint()->::dsnet::pbft::proto::Checkpoint::MergeFrom(
+          from._internal_checkpoint());
+      break;
+    }
+    case kStateRequest: {
+      _this->_internal_mutable_state_request()->::dsnet::pbft::proto::StateRequest::MergeFrom(
+          from._internal_state_request());
+      break;
+    }
+    case kStateChunk: {
+      _this->_internal_mutable_state_chunk()->::dsnet::pbft::proto::StateChunk::MergeFrom(
+          from._internal_state_chunk());
+      break;
+    }
+    case SUB_NOT_SET: {
+      break;
+    }
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void PBFTMessage::CopyFrom(const PBFTMessage& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:dsnet.pbft.proto.PBFTMessage)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool PBFTMessage::IsInitialized() const {
+  switch (sub_case()) {
+    case kRequest: {
+      if (_internal_has_request()) {
+        if (!_impl_.sub_.request_->IsInitialized()) return false;
+      }
+      break;
+    }
+    case kPreprepare: {
+      break;
+    }
+    case kPrepare: {
+      break;
+    }
+    case kCommit: {
+      break;
+    }
+    case kCheckpoint: {
+      break;
+    }
+    case kStateRequest: {
+      break;
+    }
+    case kStateChunk: {
+      if (_internal_has_state_chunk()) {
+        if (!_impl_.sub_.state_chunk_->IsInitialized()) return false;
+      }
+      break;
+    }
+    case SUB_NOT_SET: {
+      break;
+    }
+  }
+  return true;
+}
+
+void PBFTMessage::InternalSwap(PBFTMessage* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_.sub_, other->_impl_.sub_);
+  swap(_impl_._oneof_case_[0], other->_impl_._oneof_case_[0]);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata PBFTMessage::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_replication_2fpbft_2fmessage_2eproto_getter, &descriptor_table_replication_2fpbft_2fmessage_2eproto_once,
+      file_level_metadata_replication_2fpbft_2fmessage_2eproto[0]);
+}
+
+// ===================================================================
+
+class Reply::_Internal {
+ public:
+};
+
+Reply::Reply(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:dsnet.pbft.proto.Reply)
+}
+Reply::Reply(const Reply& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  Reply* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.result_){}
+    , decltype(_impl_.request_number_){}
+    , decltype(_impl_.replica_id_){}
+    , decltype(_impl_.view_number_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.result_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.result_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_result().empty()) {
+    _this->_impl_.result_.Set(from._internal_result(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.request_number_, &from._impl_.request_number_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.view_number_) -
+    reinterpret_cast<char*>(&_impl_.request_number_)) + sizeof(_impl_.view_number_));
+  // @@protoc_insertion_point(copy_constructor:dsnet.pbft.proto.Reply)
+}
+
+inline void Reply::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.result_){}
+    , decltype(_impl_.request_number_){uint64_t{0u}}
+    , decltype(_impl_.replica_id_){0}
+    , decltype(_impl_.view_number_){0u}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.result_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.result_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+Reply::~Reply() {
+  // @@protoc_insertion_point(destructor:dsnet.pbft.proto.Reply)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void Reply::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.result_.Destroy();
+}
+
+void Reply::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void Reply::Clear() {
+// @@protoc_insertion_point(message_clear_start:dsnet.pbft.proto.Reply)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.result_.ClearToEmpty();
+  ::memset(&_impl_.request_number_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.view_number_) -
+      reinterpret_cast<char*>(&_impl_.request_number_)) + sizeof(_impl_.view_number_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* Reply::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // bytes result = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_result();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 request_number = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.request_number_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int32 replica_id = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.replica_id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint32 view_number = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _impl_.view_number_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* Reply::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:dsnet.pbft.proto.Reply)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // bytes result = 1;
+  if (!this->_internal_result().empty()) {
+    target = stream->WriteBytesMaybeAliased(
+        1, this->_internal_result(), target);
+  }
+
+  // uint64 request_number = 2;
+  if (this->_internal_request_number() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(2, this->_internal_request_number(), target);
+  }
+
+  // int32 replica_id = 3;
+  if (this->_internal_replica_id() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(3, this->_internal_replica_id(), target);
+  }
+
+  // uint32 view_number = 4;
+  if (this->_internal_view_number() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(4, this->_internal_view_number(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:dsnet.pbft.proto.Reply)
+  return target;
+}
+
+size_t Reply::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:dsnet.pbft.proto.Reply)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // bytes result = 1;
+  if (!this->_internal_result().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_result());
+  }
+
+  // uint64 request_number = 2;
+  if (this->_internal_request_number() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_request_number());
+  }
+
+  // int32 replica_id = 3;
+  if (this->_internal_replica_id() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_replica_id());
+  }
+
+  // uint32 view_number = 4;
+  if (this->_internal_view_number() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_view_number());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData Reply::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    Reply::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*Reply::GetClassData() const { return &_class_data_; }
+
+
+void Reply::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<Reply*>(&to_msg);
+  auto& from = static_cast<const Reply&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:dsnet.pbft.proto.Reply)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_result().empty()) {
+    _this->_internal_set_result(from._internal_result());
+  }
+  if (from._internal_request_number() != 0) {
+    _this->_internal_set_request_number(from._internal_request_number());
+  }
+  if (from._internal_replica_id() != 0) {
+    _this->_internal_set_replica_id(from._internal_replica_id());
+  }
+  if (from._internal_view_number() != 0) {
+    _this->_internal_set_view_number(from._internal_view_number());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void Reply::CopyFrom(const Reply& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:dsnet.pbft.proto.Reply)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool Reply::IsInitialized() const {
+  return true;
+}
+
+void Reply::InternalSwap(Reply* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.result_, lhs_arena,
+      &other->_impl_.result_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(Reply, _impl_.view_number_)
+      + sizeof(Reply::_impl_.view_number_)
+      - PROTOBUF_FIELD_OFFSET(Reply, _impl_.request_number_)>(
+          reinterpret_cast<char*>(&_impl_.request_number_),
+          reinterpret_cast<char*>(&other->_impl_.request_number_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata Reply::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_replication_2fpbft_2fmessage_2eproto_getter, &descriptor_table_replication_2fpbft_2fmessage_2eproto_once,
+      file_level_metadata_replication_2fpbft_2fmessage_2eproto[1]);
+}
+
+// ===================================================================
+
+class Preprepare::_Internal {
+ public:
+};
+
+Preprepare::Preprepare(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:dsnet.pbft.proto.Preprepare)
+}
+Preprepare::Preprepare(const Preprepare& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  Preprepare* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.signed_message_){from._impl_.signed_message_}
+    , decltype(_impl_.signed_prepare_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.signed_prepare_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.signed_prepare_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_signed_prepare().empty()) {
+    _this->_impl_.signed_prepare_.Set(from._internal_signed_prepare(), 
+      _this->GetArenaForAllocation());
+  }
+  // @@protoc_insertion_point(copy_constructor:dsnet.pbft.proto.Preprepare)
+}
+
+inline void Preprepare::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.signed_message_){arena}
+    , decltype(_impl_.signed_prepare_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.signed_prepare_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.signed_prepare_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+Preprepare::~Preprepare() {
+  // @@protoc_insertion_point(destructor:dsnet.pbft.proto.Preprepare)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void Preprepare::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.signed_message_.~RepeatedPtrField();
+  _impl_.signed_prepare_.Destroy();
+}
+
+void Preprepare::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void Preprepare::Clear() {
+// @@protoc_insertion_point(message_clear_start:dsnet.pbft.proto.Preprepare)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.signed_message_.Clear();
+  _impl_.signed_prepare_.ClearToEmpty();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* Preprepare::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // bytes signed_prepare = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_signed_prepare();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated bytes signed_message = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            auto str = _internal_add_signed_message();
+            ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<18>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* Preprepare::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:dsnet.pbft.proto.Preprepare)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // bytes signed_prepare = 1;
+  if (!this->_internal_signed_prepare().empty()) {
+    target = stream->WriteBytesMaybeAliased(
+        1, this->_internal_signed_prepare(), target);
+  }
+
+  // repeated bytes signed_message = 2;
+  for (int i = 0, n = this->_internal_signed_message_size(); i < n; i++) {
+    const auto& s = this->_internal_signed_message(i);
+    target = stream->WriteBytes(2, s, target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:dsnet.pbft.proto.Preprepare)
+  return target;
+}
+
+size_t Preprepare::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:dsnet.pbft.proto.Preprepare)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated bytes signed_message = 2;
+  total_size += 1 *
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(_impl_.signed_message_.size());
+  for (int i = 0, n = _impl_.signed_message_.size(); i < n; i++) {
+    total_size += ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+      _impl_.signed_message_.Get(i));
+  }
+
+  // bytes signed_prepare = 1;
+  if (!this->_internal_signed_prepare().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_signed_prepare());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData Preprepare::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    Preprepare::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*Preprepare::GetClassData() const { return &_class_data_; }
+
+
+void Preprepare::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<Preprepare*>(&to_msg);
+  auto& from = static_cast<const Preprepare&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:dsnet.pbft.proto.Preprepare)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.signed_message_.MergeFrom(from._impl_.signed_message_);
+  if (!from._internal_signed_prepare().empty()) {
+    _this->_internal_set_signed_prepare(from._internal_signed_prepare());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void Preprepare::CopyFrom(const Preprepare& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:dsnet.pbft.proto.Preprepare)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool Preprepare::IsInitialized() const {
+  return true;
+}
+
+void Preprepare::InternalSwap(Preprepare* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.signed_message_.InternalSwap(&other->_impl_.signed_message_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.signed_prepare_, lhs_arena,
+      &other->_impl_.signed_prepare_, rhs_arena
+  );
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata Preprepare::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_replication_2fpbft_2fmessage_2eproto_getter, &descriptor_table_replication_2fpbft_2fmessage_2eproto_once,
+      file_level_metadata_replication_2fpbft_2fmessage_2eproto[2]);
+}
+
+// ===================================================================
+
+class Prepare::_Internal {
+ public:
+};
+
+Prepare::Prepare(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:dsnet.pbft.proto.Prepare)
+}
+Prepare::Prepare(const Prepare& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  Prepare* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.digest_){}
+    , decltype(_impl_.op_number_){}
+    , decltype(_impl_.batch_size_){}
+    , decltype(_impl_.view_number_){}
+    , decltype(_impl_.replica_id_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.digest_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.digest_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_digest().empty()) {
+    _this->_impl_.digest_.Set(from._internal_digest(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.op_number_, &from._impl_.op_number_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.replica_id_) -
+    reinterpret_cast<char*>(&_impl_.op_number_)) + sizeof(_impl_.replica_id_));
+  // @@protoc_insertion_point(copy_constructor:dsnet.pbft.proto.Prepare)
+}
+
+inline void Prepare::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.digest_){}
+    , decltype(_impl_.op_number_){uint64_t{0u}}
+    , decltype(_impl_.batch_size_){uint64_t{0u}}
+    , decltype(_impl_.view_number_){0u}
+    , decltype(_impl_.replica_id_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.digest_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.digest_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+Prepare::~Prepare() {
+  // @@protoc_insertion_point(destructor:dsnet.pbft.proto.Prepare)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void Prepare::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.digest_.Destroy();
+}
+
+void Prepare::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void Prepare::Clear() {
+// @@protoc_insertion_point(message_clear_start:dsnet.pbft.proto.Prepare)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.digest_.ClearToEmpty();
+  ::memset(&_impl_.op_number_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.replica_id_) -
+      reinterpret_cast<char*>(&_impl_.op_number_)) + sizeof(_impl_.replica_id_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* Prepare::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // uint32 view_number = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.view_number_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 op_number = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.op_number_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 batch_size = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.batch_size_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // bytes digest = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          auto str = _internal_mutable_digest();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int32 replica_id = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          _impl_.replica_id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* Prepare::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:dsnet.pbft.proto.Prepare)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // uint32 view_number = 1;
+  if (this->_internal_view_number() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(1, this->_internal_view_number(), target);
+  }
+
+  // uint64 op_number = 2;
+  if (this->_internal_op_number() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(2, this->_internal_op_number(), target);
+  }
+
+  // uint64 batch_size = 3;
+  if (this->_internal_batch_size() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(3, this->_internal_batch_size(), target);
+  }
+
+  // bytes digest = 4;
+  if (!this->_internal_digest().empty()) {
+    target = stream->WriteBytesMaybeAliased(
+        4, this->_internal_digest(), target);
+  }
+
+  // int32 replica_id = 5;
+  if (this->_internal_replica_id() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(5, this->_internal_replica_id(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:dsnet.pbft.proto.Prepare)
+  return target;
+}
+
+size_t Prepare::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:dsnet.pbft.proto.Prepare)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // bytes digest = 4;
+  if (!this->_internal_digest().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_digest());
+  }
+
+  // uint64 op_number = 2;
+  if (this->_internal_op_number() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_op_number());
+  }
+
+  // uint64 batch_size = 3;
+  if (this->_internal_batch_size() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_batch_size());
+  }
+
+  // uint32 view_number = 1;
+  if (this->_internal_view_number() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_view_number());
+  }
+
+  // int32 replica_id = 5;
+  if (this->_internal_replica_id() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_replica_id());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData Prepare::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    Prepare::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*Prepare::GetClassData() const { return &_class_data_; }
+
+
+void Prepare::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<Prepare*>(&to_msg);
+  auto& from = static_cast<const Prepare&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:dsnet.pbft.proto.Prepare)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_digest().empty()) {
+    _this->_internal_set_digest(from._internal_digest());
+  }
+  if (from._internal_op_number() != 0) {
+    _this->_internal_set_op_number(from._internal_op_number());
+  }
+  if (from._internal_batch_size() != 0) {
+    _this->_internal_set_batch_size(from._internal_batch_size());
+  }
+  if (from._internal_view_number() != 0) {
+    _this->_internal_set_view_number(from._internal_view_number());
+  }
+  if (from._internal_replica_id() != 0) {
+    _this->_internal_set_replica_id(from._internal_replica_id());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void Prepare::CopyFrom(const Prepare& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:dsnet.pbft.proto.Prepare)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool Prepare::IsInitialized() const {
+  return true;
+}
+
+void Prepare::InternalSwap(Prepare* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.digest_, lhs_arena,
+      &other->_impl_.digest_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(Prepare, _impl_.replica_id_)
+      + sizeof(Prepare::_impl_.replica_id_)
+      - PROTOBUF_FIELD_OFFSET(Prepare, _impl_.op_number_)>(
+          reinterpret_cast<char*>(&_impl_.op_number_),
+          reinterpret_cast<char*>(&other->_impl_.op_number_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata Prepare::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_replication_2fpbft_2fmessage_2eproto_getter, &descriptor_table_replication_2fpbft_2fmessage_2eproto_once,
+      file_level_metadata_replication_2fpbft_2fmessage_2eproto[3]);
+}
+
+// ===================================================================
+
+class Commit::_Internal {
+ public:
+};
+
+Commit::Commit(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:dsnet.pbft.proto.Commit)
+}
+Commit::Commit(const Commit& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  Commit* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.digest_){}
+    , decltype(_impl_.op_number_){}
+    , decltype(_impl_.batch_size_){}
+    , decltype(_impl_.view_number_){}
+    , decltype(_impl_.replica_id_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.digest_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.digest_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_digest().empty()) {
+    _this->_impl_.digest_.Set(from._internal_digest(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.op_number_, &from._impl_.op_number_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.replica_id_) -
+    reinterpret_cast<char*>(&_impl_.op_number_)) + sizeof(_impl_.replica_id_));
+  // @@protoc_insertion_point(copy_constructor:dsnet.pbft.proto.Commit)
+}
+
+inline void Commit::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.digest_){}
+    , decltype(_impl_.op_number_){uint64_t{0u}}
+    , decltype(_impl_.batch_size_){uint64_t{0u}}
+    , decltype(_impl_.view_number_){0u}
+    , decltype(_impl_.replica_id_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.digest_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.digest_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+Commit::~Commit() {
+  // @@protoc_insertion_point(destructor:dsnet.pbft.proto.Commit)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void Commit::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.digest_.Destroy();
+}
+
+void Commit::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void Commit::Clear() {
+// @@protoc_insertion_point(message_clear_start:dsnet.pbft.proto.Commit)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.digest_.ClearToEmpty();
+  ::memset(&_impl_.op_number_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.replica_id_) -
+      reinterpret_cast<char*>(&_impl_.op_number_)) + sizeof(_impl_.replica_id_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* Commit::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // uint32 view_number = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.view_number_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 op_number = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.op_number_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 batch_size = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.batch_size_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // bytes digest = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          auto str = _internal_mutable_digest();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int32 replica_id = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          _impl_.replica_id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* Commit::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:dsnet.pbft.proto.Commit)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // uint32 view_number = 1;
+  if (this->_internal_view_number() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(1, this->_internal_view_number(), target);
+  }
+
+  // uint64 op_number = 2;
+  if (this->_internal_op_number() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(2, this->_internal_op_number(), target);
+  }
+
+  // uint64 batch_size = 3;
+  if (this->_internal_batch_size() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(3, this->_internal_batch_size(), target);
+  }
+
+  // bytes digest = 4;
+  if (!this->_internal_digest().empty()) {
+    target = stream->WriteBytesMaybeAliased(
+        4, this->_internal_digest(), target);
+  }
+
+  // int32 replica_id = 5;
+  if (this->_internal_replica_id() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(5, this->_internal_replica_id(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:dsnet.pbft.proto.Commit)
+  return target;
+}
+
+size_t Commit::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:dsnet.pbft.proto.Commit)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // bytes digest = 4;
+  if (!this->_internal_digest().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_digest());
+  }
+
+  // uint64 op_number = 2;
+  if (this->_internal_op_number() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_op_number());
+  }
+
+  // uint64 batch_size = 3;
+  if (this->_internal_batch_size() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_batch_size());
+  }
+
+  // uint32 view_number = 1;
+  if (this->_internal_view_number() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_view_number());
+  }
+
+  // int32 replica_id = 5;
+  if (this->_internal_replica_id() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_replica_id());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData Commit::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    Commit::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*Commit::GetClassData() const { return &_class_data_; }
+
+
+void Commit::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<Commit*>(&to_msg);
+  auto& from = static_cast<const Commit&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:dsnet.pbft.proto.Commit)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_digest().empty()) {
+    _this->_internal_set_digest(from._internal_digest());
+  }
+  if (from._internal_op_number() != 0) {
+    _this->_internal_set_op_number(from._internal_op_number());
+  }
+  if (from._internal_batch_size() != 0) {
+    _this->_internal_set_batch_size(from._internal_batch_size());
+  }
+  if (from._internal_view_number() != 0) {
+    _this->_internal_set_view_number(from._internal_view_number());
+  }
+  if (from._internal_replica_id() != 0) {
+    _this->_internal_set_replica_id(from._internal_replica_id());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void Commit::CopyFrom(const Commit& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:dsnet.pbft.proto.Commit)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool Commit::IsInitialized() const {
+  return true;
+}
+
+void Commit::InternalSwap(Commit* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.digest_, lhs_arena,
+      &other->_impl_.digest_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(Commit, _impl_.replica_id_)
+      + sizeof(Commit::_impl_.replica_id_)
+      - PROTOBUF_FIELD_OFFSET(Commit, _impl_.op_number_)>(
+          reinterpret_cast<char*>(&_impl_.op_number_),
+          reinterpret_cast<char*>(&other->_impl_.op_number_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata Commit::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_replication_2fpbft_2fmessage_2eproto_getter, &descriptor_table_replication_2fpbft_2fmessage_2eproto_once,
+      file_level_metadata_replication_2fpbft_2fmessage_2eproto[4]);
+}
+
+// ===================================================================
+
+class Checkpoint::_Internal {
+ public:
+};
+
+Checkpoint::Checkpoint(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:dsnet.pbft.proto.Checkpoint)
+}
+Checkpoint::Checkpoint(const Checkpoint& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  Checkpoint* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.digest_){}
+    , decltype(_impl_.op_number_){}
+    , decltype(_impl_.replica_id_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.digest_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.digest_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_digest().empty()) {
+    _this->_impl_.digest_.Set(from._internal_digest(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.op_number_, &from._impl_.op_number_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.replica_id_) -
+    reinterpret_cast<char*>(&_impl_.op_number_)) + sizeof(_impl_.replica_id_));
+  // @@protoc_insertion_point(copy_constructor:dsnet.pbft.proto.Checkpoint)
+}
+
+inline void Checkpoint::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.digest_){}
+    , decltype(_impl_.op_number_){uint64_t{0u}}
+    , decltype(_impl_.replica_id_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.digest_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.digest_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+Checkpoint::~Checkpoint() {
+  // @@protoc_insertion_point(destructor:dsnet.pbft.proto.Checkpoint)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void Checkpoint::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.digest_.Destroy();
+}
+
+void Checkpoint::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void Checkpoint::Clear() {
+// @@protoc_insertion_point(message_clear_start:dsnet.pbft.proto.Checkpoint)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.digest_.ClearToEmpty();
+  ::memset(&_impl_.op_number_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.replica_id_) -
+      reinterpret_cast<char*>(&_impl_.op_number_)) + sizeof(_impl_.replica_id_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* Checkpoint::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // uint64 op_number = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.op_number_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // bytes digest = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_digest();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int32 replica_id = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.replica_id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* Checkpoint::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:dsnet.pbft.proto.Checkpoint)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // uint64 op_number = 1;
+  if (this->_internal_op_number() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(1, this->_internal_op_number(), target);
+  }
+
+  // bytes digest = 2;
+  if (!this->_internal_digest().empty()) {
+    target = stream->WriteBytesMaybeAliased(
+        2, this->_internal_digest(), target);
+  }
+
+  // int32 replica_id = 3;
+  if (this->_internal_replica_id() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(3, this->_internal_replica_id(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:dsnet.pbft.proto.Checkpoint)
+  return target;
+}
+
+size_t Checkpoint::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:dsnet.pbft.proto.Checkpoint)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // bytes digest = 2;
+  if (!this->_internal_digest().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_digest());
+  }
+
+  // uint64 op_number = 1;
+  if (this->_internal_op_number() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_op_number());
+  }
+
+  // int32 replica_id = 3;
+  if (this->_internal_replica_id() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_replica_id());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData Checkpoint::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    Checkpoint::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*Checkpoint::GetClassData() const { return &_class_data_; }
+
+
+void Checkpoint::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<Checkpoint*>(&to_msg);
+  auto& from = static_cast<const Checkpoint&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:dsnet.pbft.proto.Checkpoint)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_digest().empty()) {
+    _this->_internal_set_digest(from._internal_digest());
+  }
+  if (from._internal_op_number() != 0) {
+    _this->_internal_set_op_number(from._internal_op_number());
+  }
+  if (from._internal_replica_id() != 0) {
+    _this->_internal_set_replica_id(from._internal_replica_id());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void Checkpoint::CopyFrom(const Checkpoint& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:dsnet.pbft.proto.Checkpoint)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool Checkpoint::IsInitialized() const {
+  return true;
+}
+
+void Checkpoint::InternalSwap(Checkpoint* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.digest_, lhs_arena,
+      &other->_impl_.digest_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(Checkpoint, _impl_.replica_id_)
+      + sizeof(Checkpoint::_impl_.replica_id_)
+      - PROTOBUF_FIELD_OFFSET(Checkpoint, _impl_.op_number_)>(
+          reinterpret_cast<char*>(&_impl_.op_number_),
+          reinterpret_cast<char*>(&other->_impl_.op_number_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata Checkpoint::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_replication_2fpbft_2fmessage_2eproto_getter, &descriptor_table_replication_2fpbft_2fmessage_2eproto_once,
+      file_level_metadata_replication_2fpbft_2fmessage_2eproto[5]);
+}
+
+// ===================================================================
+
+class StateRequest::_Internal {
+ public:
+};
+
+StateRequest::StateRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:dsnet.pbft.proto.StateRequest)
+}
+StateRequest::StateRequest(const StateRequest& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  StateRequest* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.op_number_){}
+    , decltype(_impl_.last_op_number_){}
+    , decltype(_impl_.replica_id_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.op_number_, &from._impl_.op_number_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.replica_id_) -
+    reinterpret_cast<char*>(&_impl_.op_number_)) + sizeof(_impl_.replica_id_));
+  // @@protoc_insertion_point(copy_constructor:dsnet.pbft.proto.StateRequest)
+}
+
+inline void StateRequest::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.op_number_){uint64_t{0u}}
+    , decltype(_impl_.last_op_number_){uint64_t{0u}}
+    , decltype(_impl_.replica_id_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+StateRequest::~StateRequest() {
+  // @@protoc_insertion_point(destructor:dsnet.pbft.proto.StateRequest)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void StateRequest::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void StateRequest::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void StateRequest::Clear() {
+// @@protoc_insertion_point(message_clear_start:dsnet.pbft.proto.StateRequest)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  ::memset(&_impl_.op_number_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.replica_id_) -
+      reinterpret_cast<char*>(&_impl_.op_number_)) + sizeof(_impl_.replica_id_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* StateRequest::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // uint64 op_number = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.op_number_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 last_op_number = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.last_op_number_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int32 replica_id = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.replica_id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* StateRequest::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:dsnet.pbft.proto.StateRequest)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // uint64 op_number = 1;
+  if (this->_internal_op_number() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(1, this->_internal_op_number(), target);
+  }
+
+  // uint64 last_op_number = 2;
+  if (this->_internal_last_op_number() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(2, this->_internal_last_op_number(), target);
+  }
+
+  // int32 replica_id = 3;
+  if (this->_internal_replica_id() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(3, this->_internal_replica_id(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:dsnet.pbft.proto.StateRequest)
+  return target;
+}
+
+size_t StateRequest::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:dsnet.pbft.proto.StateRequest)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // uint64 op_number = 1;
+  if (this->_internal_op_number() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_op_number());
+  }
+
+  // uint64 last_op_number = 2;
+  if (this->_internal_last_op_number() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_last_op_number());
+  }
+
+  // int32 replica_id = 3;
+  if (this->_internal_replica_id() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_replica_id());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData StateRequest::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    StateRequest::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*StateRequest::GetClassData() const { return &_class_data_; }
+
+
+void StateRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<StateRequest*>(&to_msg);
+  auto& from = static_cast<const StateRequest&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:dsnet.pbft.proto.StateRequest)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_op_number() != 0) {
+    _this->_internal_set_op_number(from._internal_op_number());
+  }
+  if (from._internal_last_op_number() != 0) {
+    _this->_internal_set_last_op_number(from._internal_last_op_number());
+  }
+  if (from._internal_replica_id() != 0) {
+    _this->_internal_set_replica_id(from._internal_replica_id());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void StateRequest::CopyFrom(const StateRequest& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:dsnet.pbft.proto.StateRequest)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool StateRequest::IsInitialized() const {
+  return true;
+}
+
+void StateRequest::InternalSwap(StateRequest* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(StateRequest, _impl_.replica_id_)
+      + sizeof(StateRequest::_impl_.replica_id_)
+      - PROTOBUF_FIELD_OFFSET(StateRequest, _impl_.op_number_)>(
+          reinterpret_cast<char*>(&_impl_.op_number_),
+          reinterpret_cast<char*>(&other->_impl_.op_number_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata StateRequest::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_replication_2fpbft_2fmessage_2eproto_getter, &descriptor_table_replication_2fpbft_2fmessage_2eproto_once,
+      file_level_metadata_replication_2fpbft_2fmessage_2eproto[6]);
+}
+
+// ===================================================================
+
+class StateChunk::_Internal {
+ public:
+  static const ::dsnet::pbft::proto::StableCheckpoint& checkpoint(const StateChunk* msg);
+};
+
+const ::dsnet::pbft::proto::StableCheckpoint&
+StateChunk::_Internal::checkpoint(const StateChunk* msg) {
+  return *msg->_impl_.checkpoint_;
+}
+void StateChunk::clear_request() {
+  _impl_.request_.Clear();
+}
+StateChunk::StateChunk(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:dsnet.pbft.proto.StateChunk)
+}
+StateChunk::StateChunk(const StateChunk& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  StateChunk* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.request_){from._impl_.request_}
+    , decltype(_impl_.checkpoint_){nullptr}
+    , decltype(_impl_.op_number_){}
+    , decltype(_impl_.view_number_){}
+    , decltype(_impl_.replica_id_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  if (from._internal_has_checkpoint()) {
+    _this->_impl_.checkpoint_ = new ::dsnet::pbft::proto::StableCheckpoint(*from._impl_.checkpoint_);
+  }
+  ::memcpy(&_impl_.op_number_, &from._impl_.op_number_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.replica_id_) -
+    reinterpret_cast<char*>(&_impl_.op_number_)) + sizeof(_impl_.replica_id_));
+  // @@protoc_insertion_point(copy_constructor:dsnet.pbft.proto.StateChunk)
+}
+
+inline void StateChunk::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.request_){arena}
+    , decltype(_impl_.checkpoint_){nullptr}
+    , decltype(_impl_.op_number_){uint64_t{0u}}
+    , decltype(_impl_.view_number_){0u}
+    , decltype(_impl_.replica_id_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+StateChunk::~StateChunk() {
+  // @@protoc_insertion_point(destructor:dsnet.pbft.proto.StateChunk)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void StateChunk::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.request_.~RepeatedPtrField();
+  if (this != internal_default_instance()) delete _impl_.checkpoint_;
+}
+
+void StateChunk::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void StateChunk::Clear() {
+// @@protoc_insertion_point(message_clear_start:dsnet.pbft.proto.StateChunk)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.request_.Clear();
+  if (GetArenaForAllocation() == nullptr && _impl_.checkpoint_ != nullptr) {
+    delete _impl_.checkpoint_;
+  }
+  _impl_.checkpoint_ = nullptr;
+  ::memset(&_impl_.op_number_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.replica_id_) -
+      reinterpret_cast<char*>(&_impl_.op_number_)) + sizeof(_impl_.replica_id_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* StateChunk::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // uint64 op_number = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.op_number_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint32 view_number = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.view_number_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .dsnet.Request request = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_request(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<26>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // .dsnet.pbft.proto.StableCheckpoint checkpoint = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          ptr = ctx->ParseMessage(_internal_mutable_checkpoint(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int32 replica_id = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          _impl_.replica_id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* StateChunk::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:dsnet.pbft.proto.StateChunk)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // uint64 op_number = 1;
+  if (this->_internal_op_number() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(1, this->_internal_op_number(), target);
+  }
+
+  // uint32 view_number = 2;
+  if (this->_internal_view_number() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(2, this->_internal_view_number(), target);
+  }
+
+  // repeated .dsnet.Request request = 3;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_request_size()); i < n; i++) {
+    const auto& repfield = this->_internal_request(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(3, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  // .dsnet.pbft.proto.StableCheckpoint checkpoint = 4;
+  if (this->_internal_has_checkpoint()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(4, _Internal::checkpoint(this),
+        _Internal::checkpoint(this).GetCachedSize(), target, stream);
+  }
+
+  // int32 replica_id = 5;
+  if (this->_internal_replica_id() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(5, this->_internal_replica_id(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:dsnet.pbft.proto.StateChunk)
+  return target;
+}
+
+size_t StateChunk::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:dsnet.pbft.proto.StateChunk)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .dsnet.Request request = 3;
+  total_size += 1UL * this->_internal_request_size();
+  for (const auto& msg : this->_impl_.request_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // .dsnet.pbft.proto.StableCheckpoint checkpoint = 4;
+  if (this->_internal_has_checkpoint()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.checkpoint_);
+  }
+
+  // uint64 op_number = 1;
+  if (this->_internal_op_number() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_op_number());
+  }
+
+  // uint32 view_number = 2;
+  if (this->_internal_view_number() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_view_number());
+  }
+
+  // int32 replica_id = 5;
+  if (this->_internal_replica_id() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_replica_id());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData StateChunk::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    StateChunk::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*StateChunk::GetClassData() const { return &_class_data_; }
+
+
+void StateChunk::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<StateChunk*>(&to_msg);
+  auto& from = static_cast<const StateChunk&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:dsnet.pbft.proto.StateChunk)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.request_.MergeFrom(from._impl_.request_);
+  if (from._internal_has_checkpoint()) {
+    _this->_internal_mutable_checkpoint()->::dsnet::pbft::proto::StableCheckpoint::MergeFrom(
+        from._internal_checkpoint());
+  }
+  if (from._internal_op_number() != 0) {
+    _this->_internal_set_op_number(from._internal_op_number());
+  }
+  if (from._internal_view_number() != 0) {
+    _this->_internal_set_view_number(from._internal_view_number());
+  }
+  if (from._internal_replica_id() != 0) {
+    _this->_internal_set_replica_id(from._internal_replica_id());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void StateChunk::CopyFrom(const StateChunk& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:dsnet.pbft.proto.StateChunk)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool StateChunk::IsInitialized() const {
+  if (!::PROTOBUF_NAMESPACE_ID::internal::AllAreInitialized(_impl_.request_))
+    return false;
+  return true;
+}
+
+void StateChunk::InternalSwap(StateChunk* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.request_.InternalSwap(&other->_impl_.request_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(StateChunk, _impl_.replica_id_)
+      + sizeof(StateChunk::_impl_.replica_id_)
+      - PROTOBUF_FIELD_OFFSET(StateChunk, _impl_.checkpoint_)>(
+          reinterpret_cast<char*>(&_impl_.checkpoint_),
+          reinterpret_cast<char*>(&other->_impl_.checkpoint_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata StateChunk::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_replication_2fpbft_2fmessage_2eproto_getter, &descriptor_table_replication_2fpbft_2fmessage_2eproto_once,
+      file_level_metadata_replication_2fpbft_2fmessage_2eproto[7]);
+}
+
+// ===================================================================
+
+class StableCheckpoint::_Internal {
+ public:
+};
+
+StableCheckpoint::StableCheckpoint(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:dsnet.pbft.proto.StableCheckpoint)
+}
+StableCheckpoint::StableCheckpoint(const StableCheckpoint& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  StableCheckpoint* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.signed_checkpoint_){from._impl_.signed_checkpoint_}
+    , decltype(_impl_.digest_){}
+    , decltype(_impl_.app_state_){}
+    , decltype(_impl_.log_hash_){}
+    , decltype(_impl_.op_number_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.digest_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.digest_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_digest().empty()) {
+    _this->_impl_.digest_.Set(from._internal_digest(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.app_state_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.app_state_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_app_state().empty()) {
+    _this->_impl_.app_state_.Set(from._internal_app_state(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.log_hash_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.log_hash_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_log_hash().empty()) {
+    _this->_impl_.log_hash_.Set(from._internal_log_hash(), 
+      _this->GetArenaForAllocation());
+  }
+  _this->_impl_.op_number_ = from._impl_.op_number_;
+  // @@protoc_insertion_point(copy_constructor:dsnet.pbft.proto.StableCheckpoint)
+}
+
+inline void StableCheckpoint::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.signed_checkpoint_){arena}
+    , decltype(_impl_.digest_){}
+    , decltype(_impl_.app_state_){}
+    , decltype(_impl_.log_hash_){}
+    , decltype(_impl_.op_number_){uint64_t{0u}}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.digest_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.digest_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.app_state_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.app_state_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.log_hash_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.log_hash_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+StableCheckpoint::~StableCheckpoint() {
+  // @@protoc_insertion_point(destructor:dsnet.pbft.proto.StableCheckpoint)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void StableCheckpoint::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.signed_checkpoint_.~RepeatedPtrField();
+  _impl_.digest_.Destroy();
+  _impl_.app_state_.Destroy();
+  _impl_.log_hash_.Destroy();
+}
+
+void StableCheckpoint::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void StableCheckpoint::Clear() {
+// @@protoc_insertion_point(message_clear_start:dsnet.pbft.proto.StableCheckpoint)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.signed_checkpoint_.Clear();
+  _impl_.digest_.ClearToEmpty();
+  _impl_.app_state_.ClearToEmpty();
+  _impl_.log_hash_.ClearToEmpty();
+  _impl_.op_number_ = uint64_t{0u};
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* StableCheckpoint::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // uint64 op_number = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.op_number_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // bytes digest = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_digest();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // bytes app_state = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          auto str = _internal_mutable_app_state();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated bytes signed_checkpoint = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            auto str = _internal_add_signed_checkpoint();
+            ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<34>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // bytes log_hash = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 42)) {
+          auto str = _internal_mutable_log_hash();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* StableCheckpoint::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:dsnet.pbft.proto.StableCheckpoint)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // uint64 op_number = 1;
+  if (this->_internal_op_number() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(1, this->_internal_op_number(), target);
+  }
+
+  // bytes digest = 2;
+  if (!this->_internal_digest().empty()) {
+    target = stream->WriteBytesMaybeAliased(
+        2, this->_internal_digest(), target);
+  }
+
+  // bytes app_state = 3;
+  if (!this->_internal_app_state().empty()) {
+    target = stream->WriteBytesMaybeAliased(
+        3, this->_internal_app_state(), target);
+  }
+
+  // repeated bytes signed_checkpoint = 4;
+  for (int i = 0, n = this->_internal_signed_checkpoint_size(); i < n; i++) {
+    const auto& s = this->_internal_signed_checkpoint(i);
+    target = stream->WriteBytes(4, s, target);
+  }
+
+  // bytes log_hash = 5;
+  if (!this->_internal_log_hash().empty()) {
+    target = stream->WriteBytesMaybeAliased(
+        5, this->_internal_log_hash(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:dsnet.pbft.proto.StableCheckpoint)
+  return target;
+}
+
+size_t StableCheckpoint::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:dsnet.pbft.proto.StableCheckpoint)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated bytes signed_checkpoint = 4;
+  total_size += 1 *
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(_impl_.signed_checkpoint_.size());
+  for (int i = 0, n = _impl_.signed_checkpoint_.size(); i < n; i++) {
+    total_size += ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+      _impl_.signed_checkpoint_.Get(i));
+  }
+
+  // bytes digest = 2;
+  if (!this->_internal_digest().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_digest());
+  }
+
+  // bytes app_state = 3;
+  if (!this->_internal_app_state().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_app_state());
+  }
+
+  // bytes log_hash = 5;
+  if (!this->_internal_log_hash().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_log_hash());
+  }
+
+  // uint64 op_number = 1;
+  if (this->_internal_op_number() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_op_number());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData StableCheckpoint::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    StableCheckpoint::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*StableCheckpoint::GetClassData() const { return &_class_data_; }
+
+
+void StableCheckpoint::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<StableCheckpoint*>(&to_msg);
+  auto& from = static_cast<const StableCheckpoint&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:dsnet.pbft.proto.StableCheckpoint)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.signed_checkpoint_.MergeFrom(from._impl_.signed_checkpoint_);
+  if (!from._internal_digest().empty()) {
+    _this->_internal_set_digest(from._internal_digest());
+  }
+  if (!from._internal_app_state().empty()) {
+    _this->_internal_set_app_state(from._internal_app_state());
+  }
+  if (!from._internal_log_hash().empty()) {
+    _this->_internal_set_log_hash(from._internal_log_hash());
+  }
+  if (from._internal_op_number() != 0) {
+    _this->_internal_set_op_number(from._internal_op_number());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void StableCheckpoint::CopyFrom(const StableCheckpoint& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:dsnet.pbft.proto.StableCheckpoint)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool StableCheckpoint::IsInitialized() const {
+  return true;
+}
+
+void StableCheckpoint::InternalSwap(StableCheckpoint* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.signed_checkpoint_.InternalSwap(&other->_impl_.signed_checkpoint_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.digest_, lhs_arena,
+      &other->_impl_.digest_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.app_state_, lhs_arena,
+      &other->_impl_.app_state_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.log_hash_, lhs_arena,
+      &other->_impl_.log_hash_, rhs_arena
+  );
+  swap(_impl_.op_number_, other->_impl_.op_number_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata StableCheckpoint::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_replication_2fpbft_2fmessage_2eproto_getter, &descriptor_table_replication_2fpbft_2fmessage_2eproto_once,
+      file_level_metadata_replication_2fpbft_2fmessage_2eproto[8]);
+}
+
+// @@protoc_insertion_point(namespace_scope)
+}  // namespace proto
+}  // namespace pbft
+}  // namespace dsnet
+PROTOBUF_NAMESPACE_OPEN
+template<> PROTOBUF_NOINLINE ::dsnet::pbft::proto::PBFTMessage*
+Arena::CreateMaybeMessage< ::dsnet::pbft::proto::PBFTMessage >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::dsnet::pbft::proto::PBFTMessage >(arena);
+}
+template<> PROTOBUF_NOINLINE ::dsnet::pbft::proto::Reply*
+Arena::CreateMaybeMessage< ::dsnet::pbft::proto::Reply >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::dsnet::pbft::proto::Reply >(arena);
+}
+template<> PROTOBUF_NOINLINE ::dsnet::pbft::proto::Preprepare*
+Arena::CreateMaybeMessage< ::dsnet::pbft::proto::Preprepare >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::dsnet::pbft::proto::Preprepare >(arena);
+}
+template<> PROTOBUF_NOINLINE ::dsnet::pbft::proto::Prepare*
+Arena::CreateMaybeMessage< ::dsnet::pbft::proto::Prepare >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::dsnet::pbft::proto::Prepare >(arena);
+}
+template<> PROTOBUF_NOINLINE ::dsnet::pbft::proto::Commit*
+Arena::CreateMaybeMessage< ::dsnet::pbft::proto::Commit >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::dsnet::pbft::proto::Commit >(arena);
+}
+template<> PROTOBUF_NOINLINE ::dsnet::pbft::proto::Checkpoint*
+Arena::CreateMaybeMessage< ::dsnet::pbft::proto::Checkpoint >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::dsnet::pbft::proto::Checkpoint >(arena);
+}
+template<> PROTOBUF_NOINLINE ::dsnet::pbft::proto::StateRequest*
+Arena::CreateMaybeMessage< ::dsnet::pbft::proto::StateRequest >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::dsnet::pbft::proto::StateRequest >(arena);
+}
+template<> PROTOBUF_NOINLINE ::dsnet::pbft::proto::StateChunk*
+Arena::CreateMaybeMessage< ::dsnet::pbft::proto::StateChunk >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::dsnet::pbft::proto::StateChunk >(arena);
+}
+template<> PROTOBUF_NOINLINE ::dsnet::pbft::proto::StableCheckpoint*
+Arena::CreateMaybeMessage< ::dsnet::pbft::proto::StableCheckpoint >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::dsnet::pbft::proto::StableCheckpoint >(arena);
+}
+PROTOBUF_NAMESPACE_CLOSE
+
+// @@protoc_insertion_point(global_scope)
+#include <google/protobuf/port_undef.inc>
@@ -0,0 +1,3606 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: replication/pbft/message.proto
+
+#ifndef GOOGLE_PROTOBUF_INCLUDED_replication_2fpbft_2fmessage_2eproto
+#define GOOGLE_PROTOBUF_INCLUDED_replication_2fpbft_2fmessage_2eproto
+
+#include <limits>
+#include <string>
+
+#include <google/protobuf/port_def.inc>
+#if PROTOBUF_VERSION < 3021000
+#error This file was generated by a newer version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please update
+#error your headers.
+#endif
+#if 3021012 < PROTOBUF_MIN_PROTOC_VERSION
+#error This file was generated by an older version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please
+#error regenerate this file with a newer version of protoc.
+#endif
+
+#include <google/protobuf/port_undef.inc>
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/arena.h>
+#include <google/protobuf/arenastring.h>
+#include <google/protobuf/generated_message_util.h>
+#include <google/protobuf/metadata_lite.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/message.h>
+#include <google/protobuf/repeated_field.h>  // IWYU pragma: export
+#include <google/protobuf/extension_set.h>  // IWYU pragma: export
+#include <google/protobuf/unknown_field_set.h>
+#include "common/request.pb.h"
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+#define PROTOBUF_INTERNAL_EXPORT_replication_2fpbft_2fmessage_2eproto
+PROTOBUF_NAMESPACE_OPEN
+namespace internal {
+class AnyMetadata;
+}  // namespace internal
+PROTOBUF_NAMESPACE_CLOSE
+
+// Internal implementation detail -- do not use these members.
+struct TableStruct_replication_2fpbft_2fmessage_2eproto {
+  static const uint32_t offsets[];
+};
+extern const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_replication_2fpbft_2fmessage_2eproto;
+namespace dsnet {
+namespace pbft {
+namespace proto {
+class Checkpoint;
+struct CheckpointDefaultTypeInternal;
+extern CheckpointDefaultTypeInternal _Checkpoint_default_instance_;
+class Commit;
+struct CommitDefaultTypeInternal;
+extern CommitDefaultTypeInternal _Commit_default_instance_;
+class PBFTMessage;
+struct PBFTMessageDefaultTypeInternal;
+extern PBFTMessageDefaultTypeInternal _PBFTMessage_default_instance_;
+class Prepare;
+struct PrepareDefaultTypeInternal;
+extern PrepareDefaultTypeInternal _Prepare_default_instance_;
+class Preprepare;
+struct PreprepareDefaultTypeInternal;
+extern PreprepareDefaultTypeInternal _Preprepare_default_instance_;
+class Reply;
+struct ReplyDefaultTypeInternal;
+extern ReplyDefaultTypeInternal _Reply_default_instance_;
+class StableCheckpoint;
+struct StableCheckpointDefaultTypeInternal;
+extern StableCheckpointDefaultTypeInternal _StableCheckpoint_default_instance_;
+class StateChunk;
+struct StateChunkDefaultTypeInternal;
+extern StateChunkDefaultTypeInternal _StateChunk_default_instance_;
+class StateRequest;
+struct StateRequestDefaultTypeInternal;
+extern StateRequestDefaultTypeInternal _StateRequest_default_instance_;
+}  // namespace proto
+}  // namespace pbft
+}  // namespace dsnet
+PROTOBUF_NAMESPACE_OPEN
+template<> ::dsnet::pbft::proto::Checkpoint* Arena::CreateMaybeMessage<::dsnet::pbft::proto::Checkpoint>(Arena*);
+template<> ::dsnet::pbft::proto::Commit* Arena::CreateMaybeMessage<::dsnet::pbft::proto::Commit>(Arena*);
+template<> ::dsnet::pbft::proto::PBFTMessage* Arena::CreateMaybeMessage<::dsnet::pbft::proto::PBFTMessage>(Arena*);
+template<> ::dsnet::pbft::proto::Prepare* Arena::CreateMaybeMessage<::dsnet::pbft::proto::Prepare>(Arena*);
+template<> ::dsnet::pbft::proto::Preprepare* Arena::CreateMaybeMessage<::dsnet::pbft::proto::Preprepare>(Arena*);
+template<> ::dsnet::pbft::proto::Reply* Arena::CreateMaybeMessage<::dsnet::pbft::proto::Reply>(Arena*);
+template<> ::dsnet::pbft::proto::StableCheckpoint* Arena::CreateMaybeMessage<::dsnet::pbft::proto::StableCheckpoint>(Arena*);
+template<> ::dsnet::pbft::proto::StateChunk* Arena::CreateMaybeMessage<::dsnet::pbft::proto::StateChunk>(Arena*);
+template<> ::dsnet::pbft::proto::StateRequest* Arena::CreateMaybeMessage<::dsnet::pbft::proto::StateRequest>(Arena*);
+PROTOBUF_NAMESPACE_CLOSE
+namespace dsnet {
+namespace pbft {
+namespace proto {
+
+// ===================================================================
+
+class PBFTMessage final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:dsnet.pbft.proto.PBFTMessage) */ {
+ public:
+  inline PBFTMessage() : PBFTMessage(nullptr) {}
+  ~PBFTMessage() override;
+  explicit PROTOBUF_CONSTEXPR PBFTMessage(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  PBFTMessage(const PBFTMessage& from);
+  PBFTMessage(PBFTMessage&& from) noexcept
+    : PBFTMessage() {
+    *this = ::std::move(from);
+  }
+
+  inline PBFTMessage& operator=(const PBFTMessage& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline PBFTMessage& operator=(PBFTMessage&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const PBFTMessage& default_instance() {
+    return *internal_default_instance();
+  }
+  enum SubCase {
+    kRequest = 1,
+    kPreprepare = 2,
+    kPrepare = 3,
+    kCommit = 4,
+    kCheckpoint = 5,
+    kStateRequest = 6,
+    kStateChunk = 7,
+    SUB_NOT_SET = 0,
+  };
+
+  static inline const PBFTMessage* internal_default_instance() {
+    return reinterpret_cast<const PBFTMessage*>(
+               &_PBFTMessage_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    0;
+
+  friend void swap(PBFTMessage& a, PBFTMessage& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(PBFTMessage* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(PBFTMessage* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  PBFTMessage* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<PBFTMessage>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const PBFTMessage& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const PBFTMessage& from) {
+    PBFTMessage::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(PBFTMessage* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "dsnet.pbft.proto.PBFTMessage";
+  }
+  protected:
+  explicit PBFTMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kRequestFieldNumber = 1,
+    kPreprepareFieldNumber = 2,
+    kPrepareFieldNumber = 3,
+    kCommitFieldNumber = 4,
+    kCheckpointFieldNumber = 5,
+    kStateRequestFieldNumber = 6,
+    kStateChunkFieldNumber = 7,
+  };
+  // .dsnet.Request request = 1;
+  bool has_request() const;
+  private:
+  bool _internal_has_request() const;
+  public:
+  void clear_request();
+  const ::dsnet::Request& request() const;
+  PROTOBUF_NODISCARD ::dsnet::Request* release_request();
+  ::dsnet::Request* mutable_request();
+  void set_allocated_request(::dsnet::Request* request);
+  private:
+  const ::dsnet::Request& _internal_request() const;
+  ::dsnet::Request* _internal_mutable_request();
+  public:
+  void unsafe_arena_set_allocated_request(
+      ::dsnet::Request* request);
+  ::dsnet::Request* unsafe_arena_release_request();
+
+  // .dsnet.pbft.proto.Preprepare preprepare = 2;
+  bool has_preprepare() const;
+  private:
+  bool _internal_has_preprepare() const;
+  public:
+  void clear_preprepare();
+  const ::dsnet::pbft::proto::Preprepare& preprepare() const;
+  PROTOBUF_NODISCARD ::dsnet::pbft::proto::Preprepare* release_preprepare();
+  ::dsnet::pbft::proto::Preprepare* mutable_preprepare();
+  void set_allocated_preprepare(::dsnet::pbft::proto::Preprepare* preprepare);
+  private:
+  const ::dsnet::pbft::proto::Preprepare& _internal_preprepare() const;
+  ::dsnet::pbft::proto::Preprepare* _internal_mutable_preprepare();
+  public:
+  void unsafe_arena_set_allocated_preprepare(
+      ::dsnet::pbft::proto::Preprepare* preprepare);
+  ::dsnet::pbft::proto::Preprepare* unsafe_arena_release_preprepare();
+
+  // .dsnet.pbft.proto.Prepare prepare = 3;
+  bool has_prepare() const;
+  private:
+  bool _internal_has_prepare() const;
+  public:
+  void clear_prepare();
+  const ::dsnet::pbft::proto::Prepare& prepare() const;
+  PROTOBUF_NODISCARD ::dsnet::pbft::proto::Prepare* release_prepare();
+  ::dsnet::pbft::proto::Prepare* mutable_prepare();
+  void set_allocated_prepare(::dsnet::pbft::proto::Prepare* prepare);
+  private:
+  const ::dsnet::pbft::proto::Prepare& _internal_prepare() const;
+  ::dsnet::pbft::proto::Prepare* _internal_mutable_prepare();
+  public:
+  void unsafe_arena_set_allocated_prepare(
+      ::dsnet::pbft::proto::Prepare* prepare);
+  ::dsnet::pbft::proto::Prepare* unsafe_arena_release_prepare();
+
+  // .dsnet.pbft.proto.Commit commit = 4;
+  bool has_commit() const;
+  private:
+  bool _internal_has_commit() const;
+  public:
+  void clear_commit();
+  const ::dsnet::pbft::proto::Commit& commit() const;
+  PROTOBUF_NODISCARD ::dsnet::pbft::proto::Commit* release_commit();
+  ::dsnet::pbft::proto::Commit* mutable_commit();
+  void set_allocated_commit(::dsnet::pbft::proto::Commit* commit);
+  private:
+  const ::dsnet::pbft::proto::Commit& _internal_commit() const;
+  ::dsnet::pbft::proto::Commit* _internal_mutable_commit();
+  public:
+  void unsafe_arena_set_allocated_commit(
+      ::dsnet::pbft::proto::Commit* commit);
+  ::dsnet::pbft::proto::Commit* unsafe_arena_release_commit();
+
+  // .dsnet.pbft.proto.Checkpoint checkpoint = 5;
+  bool has_checkpoint() const;
+  private:
+  bool _internal_has_checkpoint() const;
+  public:
+  void clear_checkpoint();
+  const ::dsnet::pbft::proto::Checkpoint& checkpoint() const;
+  PROTOBUF_NODISCARD ::dsnet::pbft::proto::Checkpoint* release_checkpoint();
+  ::dsnet::pbft::proto::Checkpoint* mutable_checkpoint();
+  void set_allocated_checkpoint(::dsnet::pbft::proto::Checkpoint* checkpoint);
+  private:
+  const ::dsnet::pbft::proto::Checkpoint& _internal_checkpoint() const;
+  ::dsnet::pbft::proto::Checkpoint* _internal_mutable_checkpoint();
+  public:
+  void unsafe_arena_set_allocated_checkpoint(
+      ::dsnet::pbft::proto::Checkpoint* checkpoint);
+  ::dsnet::pbft::proto::Checkpoint* unsafe_arena_release_checkpoint();
+
+  // .dsnet.pbft.proto.StateRequest state_request = 6;
+  bool has_state_request() const;
+  private:
+  bool _internal_has_state_request() const;
+  public:
+  void clear_state_request();
+  const ::dsnet::pbft::proto::StateRequest& state_request() const;
+  PROTOBUF_NODISCARD ::dsnet::pbft::proto::StateRequest* release_state_request();
+  ::dsnet::pbft::proto::StateRequest* mutable_state_request();
+  void set_allocated_state_request(::dsnet::pbft::proto::StateRequest* state_request);
+  private:
+  const ::dsnet::pbft::proto::StateRequest& _internal_state_request() const;
+  ::dsnet::pbft::proto::StateRequest* _internal_mutable_state_request();
+  public:
+  void unsafe_arena_set_allocated_state_request(
+      ::dsnet::pbft::proto::StateRequest* state_request);
+  ::dsnet::pbft::proto::StateRequest* unsafe_arena_release_state_request();
+
+  // .dsnet.pbft.proto.StateChunk state_chunk = 7;
+  bool has_state_chunk() const;
+  private:
+  bool _internal_has_state_chunk() const;
+  public:
+  void clear_state_chunk();
+  const ::dsnet::pbft::proto::StateChunk& state_chunk() const;
+  PROTOBUF_NODISCARD ::dsnet::pbft::proto::StateChunk* release_state_chunk();
+  ::dsnet::pbft::proto::StateChunk* mutable_state_chunk();
+  void set_allocated_state_chunk(::dsnet::pbft::proto::StateChunk* state_chunk);
+  private:
+  const ::dsnet::pbft::proto::StateChunk& _internal_state_chunk() const;
+  ::dsnet::pbft::proto::StateChunk* _internal_mutable_state_chunk();
+  public:
+  void unsafe_arena_set_allocated_state_chunk(
+      ::dsnet::pbft::proto::StateChunk* state_chunk);
+  ::dsnet::pbft::proto::StateChunk* unsafe_arena_release_state_chunk();
+
+  void clear_sub();
+  SubCase sub_case() const;
+  // @@protoc_insertion_point(class_scope:dsnet.pbft.proto.PBFTMessage)
+ private:
+  class _Internal;
+  void set_has_request();
+  void set_has_preprepare();
+  void set_has_prepare();
+  void set_has_commit();
+  void set_has_checkpoint();
+  void set_has_state_request();
+  void set_has_state_chunk();
+
+  inline bool has_sub() const;
+  inline void clear_has_sub();
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    union SubUnion {
+      constexpr SubUnion() : _constinit_{} {}
+        ::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized _constinit_;
+      ::dsnet::Request* request_;
+      ::dsnet::pbft::proto::Preprepare* preprepare_;
+      ::dsnet::pbft::proto::Prepare* prepare_;
+      ::dsnet::pbft::proto::Commit* commit_;
+      ::dsnet::pbft::proto::Checkpoint* checkpoint_;
+      ::dsnet::pbft::proto::StateRequest* state_request_;
+      ::dsnet::pbft::proto::StateChunk* state_chunk_;
+    } sub_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    uint32_t _oneof_case_[1];
+
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_replication_2fpbft_2fmessage_2eproto;
+};
+// -------------------------------------------------------------------
+
+class Reply final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:dsnet.pbft.proto.Reply) */ {
+ public:
+  inline Reply() : Reply(nullptr) {}
+  ~Reply() override;
+  explicit PROTOBUF_CONSTEXPR Reply(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  Reply(const Reply& from);
+  Reply(Reply&& from) noexcept
+    : Reply() {
+    *this = ::std::move(from);
+  }
+
+  inline Reply& operator=(const Reply& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline Reply& operator=(Reply&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const Reply& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const Reply* internal_default_instance() {
+    return reinterpret_cast<const Reply*>(
+               &_Reply_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    1;
+
+  friend void swap(Reply& a, Reply& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(Reply* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Reply* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  Reply* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<Reply>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const Reply& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const Reply& from) {
+    Reply::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(Reply* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "dsnet.pbft.proto.Reply";
+  }
+  protected:
+  explicit Reply(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kResultFieldNumber = 1,
+    kRequestNumberFieldNumber = 2,
+    kReplicaIdFieldNumber = 3,
+    kViewNumberFieldNumber = 4,
+  };
+  // bytes result = 1;
+  void clear_result();
+  const std::string& result() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_result(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_result();
+  PROTOBUF_NODISCARD std::string* release_result();
+  void set_allocated_result(std::string* result);
+  private:
+  const std::string& _internal_result() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_result(const std::string& value);
+  std::string* _internal_mutable_result();
+  public:
+
+  // uint64 request_number = 2;
+  void clear_request_number();
+  uint64_t request_number() const;
+  void set_request_number(uint64_t value);
+  private:
+  uint64_t _internal_request_number() const;
+  void _internal_set_request_number(uint64_t value);
+  public:
+
+  // int32 replica_id = 3;
+  void clear_replica_id();
+  int32_t replica_id() const;
+  void set_replica_id(int32_t value);
+  private:
+  int32_t _internal_replica_id() const;
+  void _internal_set_replica_id(int32_t value);
+  public:
+
+  // uint32 view_number = 4;
+  void clear_view_number();
+  uint32_t view_number() const;
+  void set_view_number(uint32_t value);
+  private:
+  uint32_t _internal_view_number() const;
+  void _internal_set_view_number(uint32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:dsnet.pbft.proto.Reply)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr result_;
+    uint64_t request_number_;
+    int32_t replica_id_;
+    uint32_t view_number_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_replication_2fpbft_2fmessage_2eproto;
+};
+// -------------------------------------------------------------------
+
+class Preprepare final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:dsnet.pbft.proto.Preprepare) */ {
+ public:
+  inline Preprepare() : Preprepare(nullptr) {}
+  ~Preprepare() override;
+  explicit PROTOBUF_CONSTEXPR Preprepare(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  Preprepare(const Preprepare& from);
+  Preprepare(Preprepare&& from) noexcept
+    : Preprepare() {
+    *this = ::std::move(from);
+  }
+
+  inline Preprepare& operator=(const Preprepare& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline Preprepare& operator=(Preprepare&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const Preprepare& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const Preprepare* internal_default_instance() {
+    return reinterpret_cast<const Preprepare*>(
+               &_Preprepare_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    2;
+
+  friend void swap(Preprepare& a, Preprepare& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(Preprepare* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Preprepare* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  Preprepare* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<Preprepare>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const Preprepare& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const Preprepare& from) {
+    Preprepare::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(Preprepare* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "dsnet.pbft.proto.Preprepare";
+  }
+  protected:
+  explicit Preprepare(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kSignedMessageFieldNumber = 2,
+    kSignedPrepareFieldNumber = 1,
+  };
+  // repeated bytes signed_message = 2;
+  int signed_message_size() const;
+  private:
+  int _internal_signed_message_size() const;
+  public:
+  void clear_signed_message();
+  const std::string& signed_message(int index) const;
+  std::string* mutable_signed_message(int index);
+  void set_signed_message(int index, const std::string& value);
+  void set_signed_message(int index, std::string&& value);
+  void set_signed_message(int index, const char* value);
+  void set_signed_message(int index, const void* value, size_t size);
+  std::string* add_signed_message();
+  void add_signed_message(const std::string& value);
+  void add_signed_message(std::string&& value);
+  void add_signed_message(const char* value);
+  void add_signed_message(const void* value, size_t size);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>& signed_message() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>* mutable_signed_message();
+  private:
+  const std::string& _internal_signed_message(int index) const;
+  std::string* _internal_add_signed_message();
+  public:
+
+  // bytes signed_prepare = 1;
+  void clear_signed_prepare();
+  const std::string& signed_prepare() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_signed_prepare(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_signed_prepare();
+  PROTOBUF_NODISCARD std::string* release_signed_prepare();
+  void set_allocated_signed_prepare(std::string* signed_prepare);
+  private:
+  const std::string& _internal_signed_prepare() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_signed_prepare(const std::string& value);
+  std::string* _internal_mutable_signed_prepare();
+  public:
+
+  // @@protoc_insertion_point(class_scope:dsnet.pbft.proto.Preprepare)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string> signed_message_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr signed_prepare_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_replication_2fpbft_2fmessage_2eproto;
+};
+// -------------------------------------------------------------------
+
+class Prepare final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:dsnet.pbft.proto.Prepare) */ {
+ public:
+  inline Prepare() : Prepare(nullptr) {}
+  ~Prepare() override;
+  explicit PROTOBUF_CONSTEXPR Prepare(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  Prepare(const Prepare& from);
+  Prepare(Prepare&& from) noexcept
+    : Prepare() {
+    *this = ::std::move(from);
+  }
+
+  inline Prepare& operator=(const Prepare& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline Prepare& operator=(Prepare&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const Prepare& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const Prepare* internal_default_instance() {
+    return reinterpret_cast<const Prepare*>(
+               &_Prepare_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    3;
+
+  friend void swap(Prepare& a, Prepare& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(Prepare* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Prepare* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  Prepare* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<Prepare>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const Prepare& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const Prepare& from) {
+    Prepare::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(Prepare* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "dsnet.pbft.proto.Prepare";
+  }
+  protected:
+  explicit Prepare(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kDigestFieldNumber = 4,
+    kOpNumberFieldNumber = 2,
+    kBatchSizeFieldNumber = 3,
+    kViewNumberFieldNumber = 1,
+    kReplicaIdFieldNumber = 5,
+  };
+  // bytes digest = 4;
+  void clear_digest();
+  const std::string& digest() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_digest(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_digest();
+  PROTOBUF_NODISCARD std::string* release_digest();
+  void set_allocated_digest(std::string* digest);
+  private:
+  const std::string& _internal_digest() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_digest(const std::string& value);
+  std::string* _internal_mutable_digest();
+  public:
+
+  // uint64 op_number = 2;
+  void clear_op_number();
+  uint64_t op_number() const;
+  void set_op_number(uint64_t value);
+  private:
+  uint64_t _internal_op_number() const;
+  void _internal_set_op_number(uint64_t value);
+  public:
+
+  // uint64 batch_size = 3;
+  void clear_batch_size();
+  uint64_t batch_size() const;
+  void set_batch_size(uint64_t value);
+  private:
+  uint64_t _internal_batch_size() const;
+  void _internal_set_batch_size(uint64_t value);
+  public:
+
+  // uint32 view_number = 1;
+  void clear_view_number();
+  uint32_t view_number() const;
+  void set_view_number(uint32_t value);
+  private:
+  uint32_t _internal_view_number() const;
+  void _internal_set_view_number(uint32_t value);
+  public:
+
+  // int32 replica_id = 5;
+  void clear_replica_id();
+  int32_t replica_id() const;
+  void set_replica_id(int32_t value);
+  private:
+  int32_t _internal_replica_id() const;
+  void _internal_set_replica_id(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:dsnet.pbft.proto.Prepare)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr digest_;
+    uint64_t op_number_;
+    uint64_t batch_size_;
+    uint32_t view_number_;
+    int32_t replica_id_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_replication_2fpbft_2fmessage_2eproto;
+};
+// -------------------------------------------------------------------
+
+class Commit final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:dsnet.pbft.proto.Commit) */ {
+ public:
+  inline Commit() : Commit(nullptr) {}
+  ~Commit() override;
+  explicit PROTOBUF_CONSTEXPR Commit(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  Commit(const Commit& from);
+  Commit(Commit&& from) noexcept
+    : Commit() {
+    *this = ::std::move(from);
+  }
+
+  inline Commit& operator=(const Commit& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline Commit& operator=(Commit&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const Commit& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const Commit* internal_default_instance() {
+    return reinterpret_cast<const Commit*>(
+               &_Commit_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    4;
+
+  friend void swap(Commit& a, Commit& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(Commit* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Commit* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  Commit* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<Commit>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const Commit& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const Commit& from) {
+    Commit::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(Commit* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "dsnet.pbft.proto.Commit";
+  }
+  protected:
+  explicit Commit(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kDigestFieldNumber = 4,
+    kOpNumberFieldNumber = 2,
+    kBatchSizeFieldNumber = 3,
+    kViewNumberFieldNumber = 1,
+    kReplicaIdFieldNumber = 5,
+  };
+  // bytes digest = 4;
+  void clear_digest();
+  const std::string& digest() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_digest(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_digest();
+  PROTOBUF_NODISCARD std::string* release_digest();
+  void set_allocated_digest(std::string* digest);
+  private:
+  const std::string& _internal_digest() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_digest(const std::string& value);
+  std::string* _internal_mutable_digest();
+  public:
+
+  // uint64 op_number = 2;
+  void clear_op_number();
+  uint64_t op_number() const;
+  void set_op_number(uint64_t value);
+  private:
+  uint64_t _internal_op_number() const;
+  void _internal_set_op_number(uint64_t value);
+  public:
+
+  // uint64 batch_size = 3;
+  void clear_batch_size();
+  uint64_t batch_size() const;
+  void set_batch_size(uint64_t value);
+  private:
+  uint64_t _internal_batch_size() const;
+  void _internal_set_batch_size(uint64_t value);
+  public:
+
+  // uint32 view_number = 1;
+  void clear_view_number();
+  uint32_t view_number() const;
+  void set_view_number(uint32_t value);
+  private:
+  uint32_t _internal_view_number() const;
+  void _internal_set_view_number(uint32_t value);
+  public:
+
+  // int32 replica_id = 5;
+  void clear_replica_id();
+  int32_t replica_id() const;
+  void set_replica_id(int32_t value);
+  private:
+  int32_t _internal_replica_id() const;
+  void _internal_set_replica_id(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:dsnet.pbft.proto.Commit)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr digest_;
+    uint64_t op_number_;
+    uint64_t batch_size_;
+    uint32_t view_number_;
+    int32_t replica_id_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_replication_2fpbft_2fmessage_2eproto;
+};
+// -------------------------------------------------------------------
+
+class Checkpoint final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:dsnet.pbft.proto.Checkpoint) */ {
+ public:
+  inline Checkpoint() : Checkpoint(nullptr) {}
+  ~Checkpoint() override;
+  explicit PROTOBUF_CONSTEXPR Checkpoint(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  Checkpoint(const Checkpoint& from);
+  Checkpoint(Checkpoint&& from) noexcept
+    : Checkpoint() {
+    *this = ::std::move(from);
+  }
+
+  inline Checkpoint& operator=(const Checkpoint& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline Checkpoint& operator=(Checkpoint&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const Checkpoint& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const Checkpoint* internal_default_instance() {
+    return reinterpret_cast<const Checkpoint*>(
+               &_Checkpoint_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    5;
+
+  friend void swap(Checkpoint& a, Checkpoint& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(Checkpoint* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Checkpoint* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  Checkpoint* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<Checkpoint>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const Checkpoint& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const Checkpoint& from) {
+    Checkpoint::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(Checkpoint* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "dsnet.pbft.proto.Checkpoint";
+  }
+  protected:
+  explicit Checkpoint(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kDigestFieldNumber = 2,
+    kOpNumberFieldNumber = 1,
+    kReplicaIdFieldNumber = 3,
+  };
+  // bytes digest = 2;
+  void clear_digest();
+  const std::string& digest() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_digest(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_digest();
+  PROTOBUF_NODISCARD std::string* release_digest();
+  void set_allocated_digest(std::string* digest);
+  private:
+  const std::string& _internal_digest() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_digest(const std::string& value);
+  std::string* _internal_mutable_digest();
+  public:
+
+  // uint64 op_number = 1;
+  void clear_op_number();
+  uint64_t op_number() const;
+  void set_op_number(uint64_t value);
+  private:
+  uint64_t _internal_op_number() const;
+  void _internal_set_op_number(uint64_t value);
+  public:
+
+  // int32 replica_id = 3;
+  void clear_replica_id();
+  int32_t replica_id() const;
+  void set_replica_id(int32_t value);
+  private:
+  int32_t _internal_replica_id() const;
+  void _internal_set_replica_id(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:dsnet.pbft.proto.Checkpoint)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr digest_;
+    uint64_t op_number_;
+    int32_t replica_id_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_replication_2fpbft_2fmessage_2eproto;
+};
+// -------------------------------------------------------------------
+
+class StateRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:dsnet.pbft.proto.StateRequest) */ {
+ public:
+  inline StateRequest() : StateRequest(nullptr) {}
+  ~StateRequest() override;
+  explicit PROTOBUF_CONSTEXPR StateRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  StateRequest(const StateRequest& from);
+  StateRequest(StateRequest&& from) noexcept
+    : StateRequest() {
+    *this = ::std::move(from);
+  }
+
+  inline StateRequest& operator=(const StateRequest& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline StateRequest& operator=(StateRequest&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const StateRequest& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const StateRequest* internal_default_instance() {
+    return reinterpret_cast<const StateRequest*>(
+               &_StateRequest_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    6;
+
+  friend void swap(StateRequest& a, StateRequest& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(StateRequest* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(StateRequest* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  StateRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<StateRequest>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const StateRequest& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const StateRequest& from) {
+    StateRequest::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(StateRequest* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "dsnet.pbft.proto.StateRequest";
+  }
+  protected:
+  explicit StateRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kOpNumberFieldNumber = 1,
+    kLastOpNumberFieldNumber = 2,
+    kReplicaIdFieldNumber = 3,
+  };
+  // uint64 op_number = 1;
+  void clear_op_number();
+  uint64_t op_number() const;
+  void set_op_number(uint64_t value);
+  private:
+  uint64_t _internal_op_number() const;
+  void _internal_set_op_number(uint64_t value);
+  public:
+
+  // uint64 last_op_number = 2;
+  void clear_last_op_number();
+  uint64_t last_op_number() const;
+  void set_last_op_number(uint64_t value);
+  private:
+  uint64_t _internal_last_op_number() const;
+  void _internal_set_last_op_number(uint64_t value);
+  public:
+
+  // int32 replica_id = 3;
+  void clear_replica_id();
+  int32_t replica_id() const;
+  void set_replica_id(int32_t value);
+  private:
+  int32_t _internal_replica_id() const;
+  void _internal_set_replica_id(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:dsnet.pbft.proto.StateRequest)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    uint64_t op_number_;
+    uint64_t last_op_number_;
+    int32_t replica_id_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_replication_2fpbft_2fmessage_2eproto;
+};
+// -------------------------------------------------------------------
+
+class StateChunk final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:dsnet.pbft.proto.StateChunk) */ {
+ public:
+  inline StateChunk() : StateChunk(nullptr) {}
+  ~StateChunk() override;
+  explicit PROTOBUF_CONSTEXPR StateChunk(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  StateChunk(const StateChunk& from);
+  StateChunk(StateChunk&& from) noexcept
+    : StateChunk() {
+    *this = ::std::move(from);
+  }
+
+  inline StateChunk& operator=(const StateChunk& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline StateChunk& operator=(StateChunk&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const StateChunk& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const StateChunk* internal_default_instance() {
+    return reinterpret_cast<const StateChunk*>(
+               &_StateChunk_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    7;
+
+  friend void swap(StateChunk& a, StateChunk& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(StateChunk* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(StateChunk* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  StateChunk* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<StateChunk>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const StateChunk& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const StateChunk& from) {
+    StateChunk::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(StateChunk* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "dsnet.pbft.proto.StateChunk";
+  }
+  protected:
+  explicit StateChunk(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kRequestFieldNumber = 3,
+    kCheckpointFieldNumber = 4,
+    kOpNumberFieldNumber = 1,
+    kViewNumberFieldNumber = 2,
+    kReplicaIdFieldNumber = 5,
+  };
+  // repeated .dsnet.Request request = 3;
+  int request_size() const;
+  private:
+  int _internal_request_size() const;
+  public:
+  void clear_request();
+  ::dsnet::Request* mutable_request(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::dsnet::Request >*
+      mutable_request();
+  private:
+  const ::dsnet::Request& _internal_request(int index) const;
+  ::dsnet::Request* _internal_add_request();
+  public:
+  const ::dsnet::Request& request(int index) const;
+  ::dsnet::Request* add_request();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::dsnet::Request >&
+      request() const;
+
+  // .dsnet.pbft.proto.StableCheckpoint checkpoint = 4;
+  bool has_checkpoint() const;
+  private:
+  bool _internal_has_checkpoint() const;
+  public:
+  void clear_checkpoint();
+  const ::dsnet::pbft::proto::StableCheckpoint& checkpoint() const;
+  PROTOBUF_NODISCARD ::dsnet::pbft::proto::StableCheckpoint* release_checkpoint();
+  ::dsnet::pbft::proto::StableCheckpoint* mutable_checkpoint();
+  void set_allocated_checkpoint(::dsnet::pbft::proto::StableCheckpoint* checkpoint);
+  private:
+  const ::dsnet::pbft::proto::StableCheckpoint& _internal_checkpoint() const;
+  ::dsnet::pbft::proto::StableCheckpoint* _internal_mutable_checkpoint();
+  public:
+  void unsafe_arena_set_allocated_checkpoint(
+      ::dsnet::pbft::proto::StableCheckpoint* checkpoint);
+  ::dsnet::pbft::proto::StableCheckpoint* unsafe_arena_release_checkpoint();
+
+  // uint64 op_number = 1;
+  void clear_op_number();
+  uint64_t op_number() const;
+  void set_op_number(uint64_t value);
+  private:
+  uint64_t _internal_op_number() const;
+  void _internal_set_op_number(uint64_t value);
+  public:
+
+  // uint32 view_number = 2;
+  void clear_view_number();
+  uint32_t view_number() const;
+  void set_view_number(uint32_t value);
+  private:
+  uint32_t _internal_view_number() const;
+  void _internal_set_view_number(uint32_t value);
+  public:
+
+  // int32 replica_id = 5;
+  void clear_replica_id();
+  int32_t replica_id() const;
+  void set_replica_id(int32_t value);
+  private:
+  int32_t _internal_replica_id() const;
+  void _internal_set_replica_id(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:dsnet.pbft.proto.StateChunk)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::dsnet::Request > request_;
+    ::dsnet::pbft::proto::StableCheckpoint* checkpoint_;
+    uint64_t op_number_;
+    uint32_t view_number_;
+    int32_t replica_id_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_replication_2fpbft_2fmessage_2eproto;
+};
+// -------------------------------------------------------------------
+
+class StableCheckpoint final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:dsnet.pbft.proto.StableCheckpoint) */ {
+ public:
+  inline StableCheckpoint() : StableCheckpoint(nullptr) {}
+  ~StableCheckpoint() override;
+  explicit PROTOBUF_CONSTEXPR StableCheckpoint(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  StableCheckpoint(const StableCheckpoint& from);
+  StableCheckpoint(StableCheckpoint&& from) noexcept
+    : StableCheckpoint() {
+    *this = ::std::move(from);
+  }
+
+  inline StableCheckpoint& operator=(const StableCheckpoint& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline StableCheckpoint& operator=(StableCheckpoint&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const StableCheckpoint& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const StableCheckpoint* internal_default_instance() {
+    return reinterpret_cast<const StableCheckpoint*>(
+               &_StableCheckpoint_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    8;
+
+  friend void swap(StableCheckpoint& a, StableCheckpoint& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(StableCheckpoint* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(StableCheckpoint* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  StableCheckpoint* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<StableCheckpoint>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const StableCheckpoint& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const StableCheckpoint& from) {
+    StableCheckpoint::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(StableCheckpoint* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "dsnet.pbft.proto.StableCheckpoint";
+  }
+  protected:
+  explicit StableCheckpoint(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kSignedCheckpointFieldNumber = 4,
+    kDigestFieldNumber = 2,
+    kAppStateFieldNumber = 3,
+    kLogHashFieldNumber = 5,
+    kOpNumberFieldNumber = 1,
+  };
+  // repeated bytes signed_checkpoint = 4;
+  int signed_checkpoint_size() const;
+  private:
+  int _internal_signed_checkpoint_size() const;
+  public:
+  void clear_signed_checkpoint();
+  const std::string& signed_checkpoint(int index) const;
+  std::string* mutable_signed_checkpoint(int index);
+  void set_signed_checkpoint(int index, const std::string& value);
+  void set_signed_checkpoint(int index, std::string&& value);
+  void set_signed_checkpoint(int index, const char* value);
+  void set_signed_checkpoint(int index, const void* value, size_t size);
+  std::string* add_signed_checkpoint();
+  void add_signed_checkpoint(const std::string& value);
+  void add_signed_checkpoint(std::string&& value);
+  void add_signed_checkpoint(const char* value);
+  void add_signed_checkpoint(const void* value, size_t size);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>& signed_checkpoint() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>* mutable_signed_checkpoint();
+  private:
+  const std::string& _internal_signed_checkpoint(int index) const;
+  std::string* _internal_add_signed_checkpoint();
+  public:
+
+  // bytes digest = 2;
+  void clear_digest();
+  const std::string& digest() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_digest(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_digest();
+  PROTOBUF_NODISCARD std::string* release_digest();
+  void set_allocated_digest(std::string* digest);
+  private:
+  const std::string& _internal_digest() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_digest(const std::string& value);
+  std::string* _internal_mutable_digest();
+  public:
+
+  // bytes app_state = 3;
+  void clear_app_state();
+  const std::string& app_state() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_app_state(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_app_state();
+  PROTOBUF_NODISCARD std::string* release_app_state();
+  void set_allocated_app_state(std::string* app_state);
+  private:
+  const std::string& _internal_app_state() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_app_state(const std::string& value);
+  std::string* _internal_mutable_app_state();
+  public:
+
+  // bytes log_hash = 5;
+  void clear_log_hash();
+  const std::string& log_hash() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_log_hash(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_log_hash();
+  PROTOBUF_NODISCARD std::string* release_log_hash();
+  void set_allocated_log_hash(std::string* log_hash);
+  private:
+  const std::string& _internal_log_hash() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_log_hash(const std::string& value);
+  std::string* _internal_mutable_log_hash();
+  public:
+
+  // uint64 op_number = 1;
+  void clear_op_number();
+  uint64_t op_number() const;
+  void set_op_number(uint64_t value);
+  private:
+  uint64_t _internal_op_number() const;
+  void _internal_set_op_number(uint64_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:dsnet.pbft.proto.StableCheckpoint)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string> signed_checkpoint_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr digest_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr app_state_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr log_hash_;
+    uint64_t op_number_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_replication_2fpbft_2fmessage_2eproto;
+};
+// ===================================================================
+
+
+// ===================================================================
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
+#endif  // __GNUC__
+// PBFTMessage
+
+// .dsnet.Request request = 1;
+inline bool PBFTMessage::_internal_has_request() const {
+  return sub_case() == kRequest;
+}
+inline bool PBFTMessage::has_request() const {
+  return _internal_has_request();
+}
+inline void PBFTMessage::set_has_request() {
+  _impl_._oneof_case_[0] = kRequest;
+}
+inline ::dsnet::Request* PBFTMessage::release_request() {
+  // @@protoc_insertion_point(field_release:dsnet.pbft.proto.PBFTMessage.request)
+  if (_internal_has_request()) {
+    clear_has_sub();
+    ::dsnet::Request* temp = _impl_.sub_.request_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.sub_.request_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::dsnet::Request& PBFTMessage::_internal_request() const {
+  return _internal_has_request()
+      ? *_impl_.sub_.request_
+      : reinterpret_cast< ::dsnet::Request&>(::dsnet::_Request_default_instance_);
+}
+inline const ::dsnet::Request& PBFTMessage::request() const {
+  // @@protoc_insertion_point(field_get:dsnet.pbft.proto.PBFTMessage.request)
+  return _internal_request();
+}
+inline ::dsnet::Request* PBFTMessage::unsafe_arena_release_request() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:dsnet.pbft.proto.PBFTMessage.request)
+  if (_internal_has_request()) {
+    clear_has_sub();
+    ::dsnet::Request* temp = _impl_.sub_.request_;
+    _impl_.sub_.request_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void PBFTMessage::unsafe_arena_set_allocated_request(::dsnet::Request* request) {
+  clear_sub();
+  if (request) {
+    set_has_request();
+    _impl_.sub_.request_ = request;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:dsnet.pbft.proto.PBFTMessage.request)
+}
+inline ::dsnet::Request* PBFTMessage::_internal_mutable_request() {
+  if (!_internal_has_request()) {
+    clear_sub();
+    set_has_request();
+    _impl_.sub_.request_ = CreateMaybeMessage< ::dsnet::Request >(GetArenaForAllocation());
+  }
+  return _impl_.sub_.request_;
+}
+inline ::dsnet::Request* PBFTMessage::mutable_request() {
+  ::dsnet::Request* _msg = _internal_mutable_request();
+  // @@protoc_insertion_point(field_mutable:dsnet.pbft.proto.PBFTMessage.request)
+  return _msg;
+}
+
+// .dsnet.pbft.proto.Preprepare preprepare = 2;
+inline bool PBFTMessage::_internal_has_preprepare() const {
+  return sub_case() == kPreprepare;
+}
+inline bool PBFTMessage::has_preprepare() const {
+  return _internal_has_preprepare();
+}
+inline void PBFTMessage::set_has_preprepare() {
+  _impl_._oneof_case_[0] = kPreprepare;
+}
+inline void PBFTMessage::clear_preprepare() {
+  if (_internal_has_preprepare()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.sub_.preprepare_;
+    }
+    clear_has_sub();
+  }
+}
+inline ::dsnet::pbft::proto::Preprepare* PBFTMessage::release_preprepare() {
+  // @@protoc_insertion_point(field_release:dsnet.pbft.proto.PBFTMessage.preprepare)
+  if (_internal_has_preprepare()) {
+    clear_has_sub();
+    ::dsnet::pbft::proto::Preprepare* temp = _impl_.sub_.preprepare_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.sub_.preprepare_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::dsnet::pbft::proto::Preprepare& PBFTMessage::_internal_preprepare() const {
+  return _internal_has_preprepare()
+      ? *_impl_.sub_.preprepare_
+      : reinterpret_cast< ::dsnet::pbft::proto::Preprepare&>(::dsnet::pbft::proto::_Preprepare_default_instance_);
+}
+inline const ::dsnet::pbft::proto::Preprepare& PBFTMessage::preprepare() const {
+  // @@protoc_insertion_point(field_get:dsnet.pbft.proto.PBFTMessage.preprepare)
+  return _internal_preprepare();
+}
+inline ::dsnet::pbft::proto::Preprepare* PBFTMessage::unsafe_arena_release_preprepare() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:dsnet.pbft.proto.PBFTMessage.preprepare)
+  if (_internal_has_preprepare()) {
+    clear_has_sub();
+    ::dsnet::pbft::proto::Preprepare* temp = _impl_.sub_.preprepare_;
+    _impl_.sub_.preprepare_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void PBFTMessage::unsafe_arena_set_allocated_preprepare(::dsnet::pbft::proto::Preprepare* preprepare) {
+  clear_sub();
+  if (preprepare) {
+    set_has_preprepare();
+    _impl_.sub_.preprepare_ = preprepare;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:dsnet.pbft.proto.PBFTMessage.preprepare)
+}
+inline ::dsnet::pbft::proto::Preprepare* PBFTMessage::_internal_mutable_preprepare() {
+  if (!_internal_has_preprepare()) {
+    clear_sub();
+    set_has_preprepare();
+    _impl_.sub_.preprepare_ = CreateMaybeMessage< ::dsnet::pbft::proto::Preprepare >(GetArenaForAllocation());
+  }
+  return _impl_.sub_.preprepare_;
+}
+inline ::dsnet::pbft::proto::Preprepare* PBFTMessage::mutable_preprepare() {
+  ::dsnet::pbft::proto::Preprepare* _msg = _internal_mutable_preprepare();
+  // @@protoc_insertion_point(field_mutable:dsnet.pbft.proto.PBFTMessage.preprepare)
+  return _msg;
+}
+
+// .dsnet.pbft.proto.Prepare prepare = 3;
+inline bool PBFTMessage::_internal_has_prepare() const {
+  return sub_case() == kPrepare;
+}
+inline bool PBFTMessage::has_prepare() const {
+  return _internal_has_prepare();
+}
+inline void PBFTMessage::set_has_prepare() {
+  _impl_._oneof_case_[0] = kPrepare;
+}
+inline void PBFTMessage::clear_prepare() {
+  if (_internal_has_prepare()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.sub_.prepare_;
+    }
+    clear_has_sub();
+  }
+}
+inline ::dsnet::pbft::proto::Prepare* PBFTMessage::release_prepare() {
+  // @@protoc_insertion_point(field_release:dsnet.pbft.proto.PBFTMessage.prepare)
+  if (_internal_has_prepare()) {
+    clear_has_sub();
+    ::dsnet::pbft::proto::Prepare* temp = _impl_.sub_.prepare_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.sub_.prepare_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::dsnet::pbft::proto::Prepare& PBFTMessage::_internal_prepare() const {
+  return _internal_has_prepare()
+      ? *_impl_.sub_.prepare_
+      : reinterpret_cast< ::dsnet::pbft::proto::Prepare&>(::dsnet::pbft::proto::_Prepare_default_instance_);
+}
+inline const ::dsnet::pbft::proto::Prepare& PBFTMessage::prepare() const {
+  // @@protoc_insertion_point(field_get:dsnet.pbft.proto.PBFTMessage.prepare)
+  return _internal_prepare();
+}
+inline ::dsnet::pbft::proto::Prepare* PBFTMessage::unsafe_arena_release_prepare() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:dsnet.pbft.proto.PBFTMessage.prepare)
+  if (_internal_has_prepare()) {
+    clear_has_sub();
+    ::dsnet::pbft::proto::Prepare* temp = _impl_.sub_.prepare_;
+    _impl_.sub_.prepare_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void PBFTMessage::unsafe_arena_set_allocated_prepare(::dsnet::pbft::proto::Prepare* prepare) {
+  clear_sub();
+  if (prepare) {
+    set_has_prepare();
+    _impl_.sub_.prepare_ = prepare;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:dsnet.pbft.proto.PBFTMessage.prepare)
+}
+inline ::dsnet::pbft::proto::Prepare* PBFTMessage::_internal_mutable_prepare() {
+  if (!_internal_has_prepare()) {
+    clear_sub();
+    set_has_prepare();
+    _impl_.sub_.prepare_ = CreateMaybeMessage< ::dsnet::pbft::proto::Prepare >(GetArenaForAllocation());
+  }
+  return _impl_.sub_.prepare_;
+}
+inline ::dsnet::pbft::proto::Prepare* PBFTMessage::mutable_prepare() {
+  ::dsnet::pbft::proto::Prepare* _msg = _internal_mutable_prepare();
+  // @@protoc_insertion_point(field_mutable:dsnet.pbft.proto.PBFTMessage.prepare)
+  return _msg;
+}
+
+// .dsnet.pbft.proto.Commit commit = 4;
+inline bool PBFTMessage::_internal_has_commit() const {
+  return sub_case() == kCommit;
+}
+inline bool PBFTMessage::has_commit() const {
+  return _internal_has_commit();
+}
+inline void PBFTMessage::set_has_commit() {
+  _impl_._oneof_case_[0] = kCommit;
+}
+inline void PBFTMessage::clear_commit() {
+  if (_internal_has_commit()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.sub_.commit_;
+    }
+    clear_has_sub();
+  }
+}
+inline ::dsnet::pbft::proto::Commit* PBFTMessage::release_commit() {
+  // @@protoc_insertion_point(field_release:dsnet.pbft.proto.PBFTMessage.commit)
+  if (_internal_has_commit()) {
+    clear_has_sub();
+    ::dsnet::pbft::proto::Commit* temp = _impl_.sub_.commit_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.sub_.commit_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::dsnet::pbft::proto::Commit& PBFTMessage::_internal_commit() const {
+  return _internal_has_commit()
+      ? *_impl_.sub_.commit_
+      : reinterpret_cast< ::dsnet::pbft::proto::Commit&>(::dsnet::pbft::proto::_Commit_default_instance_);
+}
+inline const ::dsnet::pbft::proto::Commit& PBFTMessage::commit() const {
+  // @@protoc_insertion_point(field_get:dsnet.pbft.proto.PBFTMessage.commit)
+  return _internal_commit();
+}
+inline ::dsnet::pbft::proto::Commit* PBFTMessage::unsafe_arena_release_commit() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:dsnet.pbft.proto.PBFTMessage.commit)
+  if (_internal_has_commit()) {
+    clear_has_sub();
+    ::dsnet::pbft::proto::Commit* temp = _impl_.sub_.commit_;
+    _impl_.sub_.commit_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void PBFTMessage::unsafe_arena_set_allocated_commit(::dsnet::pbft::proto::Commit* commit) {
+  clear_sub();
+  if (commit) {
+    set_has_commit();
+    _impl_.sub_.commit_ = commit;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:dsnet.pbft.proto.PBFTMessage.commit)
+}
+inline ::dsnet::pbft::proto::Commit* PBFTMessage::_internal_mutable_commit() {
+  if (!_internal_has_commit()) {
+    clear_sub();
+    set_has_commit();
+    _impl_.sub_.commit_ = CreateMaybeMessage< ::dsnet::pbft::proto::Commit >(GetArenaForAllocation());
+  }
+  return _impl_.sub_.commit_;
+}
+inline ::dsnet::pbft::proto::Commit* PBFTMessage::mutable_commit() {
+  ::dsnet::pbft::proto::Commit* _msg = _internal_mutable_commit();
+  // @@protoc_insertion_point(field_mutable:dsnet.pbft.proto.PBFTMessage.commit)
+  return _msg;
+}
+
+// .dsnet.pbft.proto.Checkpoint checkpoint = 5;
+inline bool PBFTMessage::_internal_has_checkpoint() const {
+  return sub_case() == kCheckpoint;
+}
+inline bool PBFTMessage::has_checkpoint() const {
+  return _internal_has_checkpoint();
+}
+inline void PBFTMessage::set_has_checkpoint() {
+  _impl_._oneof_case_[0] = kCheckpoint;
+}
+inline void PBFTMessage::clear_checkpoint() {
+  if (_internal_has_checkpoint()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.sub_.checkpoint_;
+    }
+    clear_has_sub();
+  }
+}
+inline ::dsnet::pbft::proto::Checkpoint* PBFTMessage::release_checkpoint() {
+  // @@protoc_insertion_point(field_release:dsnet.pbft.proto.PBFTMessage.checkpoint)
+  if (_internal_has_checkpoint()) {
+    clear_has_sub();
+    ::dsnet::pbft::proto::Checkpoint* temp = _impl_.sub_.checkpoint_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.sub_.checkpoint_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::dsnet::pbft::proto::Checkpoint& PBFTMessage::_internal_checkpoint() const {
+  return _internal_has_checkpoint()
+      ? *_impl_.sub_.checkpoint_
+      : reinterpret_cast< ::dsnet::pbft::proto::Checkpoint&>(::dsnet::pbft::proto::_Checkpoint_default_instance_);
+}
+inline const ::dsnet::pbft::proto::Checkpoint& PBFTMessage::checkpoint() const {
+  // @@protoc_insertion_point(field_get:dsnet.pbft.proto.PBFTMessage.checkpoint)
+  return _internal_checkpoint();
+}
+inline ::dsnet::pbft::proto::Checkpoint* PBFTMessage::unsafe_arena_release_checkpoint() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:dsnet.pbft.proto.PBFTMessage.checkpoint)
+  if (_internal_has_checkpoint()) {
+    clear_has_sub();
+    ::dsnet::pbft::proto::Checkpoint* temp = _impl_.sub_.checkpoint_;
+    _impl_.sub_.checkpoint_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void PBFTMessage::unsafe_arena_set_allocated_checkpoint(::dsnet::pbft::proto::Checkpoint* checkpoint) {
+  clear_sub();
+  if (checkpoint) {
+    set_has_checkpoint();
+    _impl_.sub_.checkpoint_ = checkpoint;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:dsnet.pbft.proto.PBFTMessage.checkpoint)
+}
+inline ::dsnet::pbft::proto::Checkpoint* PBFTMessage::_internal_mutable_checkpoint() {
+  if (!_internal_has_checkpoint()) {
+    clear_sub();
+    set_has_checkpoint();
+    _impl_.sub_.checkpoint_ = CreateMaybeMessage< ::dsnet::pbft::proto::Checkpoint >(GetArenaForAllocation());
+  }
+  return _impl_.sub_.checkpoint_;
+}
+inline ::dsnet::pbft::proto::Checkpoint* PBFTMessage::mutable_checkpoint() {
+  ::dsnet::pbft::proto::Checkpoint* _msg = _internal_mutable_checkpoint();
+  // @@protoc_insertion_point(field_mutable:dsnet.pbft.proto.PBFTMessage.checkpoint)
+  return _msg;
+}
+
+// .dsnet.pbft.proto.StateRequest state_request = 6;
+inline bool PBFTMessage::_internal_has_state_request() const {
+  return sub_case() == kStateRequest;
+}
+inline bool PBFTMessage::has_state_request() const {
+  return _internal_has_state_request();
+}
+inline void PBFTMessage::set_has_state_request() {
+  _impl_._oneof_case_[0] = kStateRequest;
+}
+inline void PBFTMessage::clear_state_request() {
+  if (_internal_has_state_request()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.sub_.state_request_;
+    }
+    clear_has_sub();
+  }
+}
+inline ::dsnet::pbft::proto::StateRequest* PBFTMessage::release_state_request() {
+  // @@protoc_insertion_point(field_release:dsnet.pbft.proto.PBFTMessage.state_request)
+  if (_internal_has_state_request()) {
+    clear_has_sub();
+    ::dsnet::pbft::proto::StateRequest* temp = _impl_.sub_.state_request_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.sub_.state_request_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::dsnet::pbft::proto::StateRequest& PBFTMessage::_internal_state_request() const {
+  return _internal_has_state_request()
+      ? *_impl_.sub_.state_request_
+      : reinterpret_cast< ::dsnet::pbft::proto::StateRequest&>(::dsnet::pbft::proto::_StateRequest_default_instance_);
+}
+inline const ::dsnet::pbft::proto::StateRequest& PBFTMessage::state_request() const {
+  // @@protoc_insertion_point(field_get:dsnet.pbft.proto.PBFTMessage.state_request)
+  return _internal_state_request();
+}
+inline ::dsnet::pbft::proto::StateRequest* PBFTMessage::unsafe_arena_release_state_request() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:dsnet.pbft.proto.PBFTMessage.state_request)
+  if (_internal_has_state_request()) {
+    clear_has_sub();
+    ::dsnet::pbft::proto::StateRequest* temp = _impl_.sub_.state_request_;
+    _impl_.sub_.state_request_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void PBFTMessage::unsafe_arena_set_allocated_state_request(::dsnet::pbft::proto::StateRequest* state_request) {
+  clear_sub();
+  if (state_request) {
+    set_has_state_request();
+    _impl_.sub_.state_request_ = state_request;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:dsnet.pbft.proto.PBFTMessage.state_request)
+}
+inline ::dsnet::pbft::proto::StateRequest* PBFTMessage::_internal_mutable_state_request() {
+  if (!_internal_has_state_request()) {
+    clear_sub();
+    set_has_state_request();
+    _impl_.sub_.state_request_ = CreateMaybeMessage< ::dsnet::pbft::proto::StateRequest >(GetArenaForAllocation());
+  }
+  return _impl_.sub_.state_request_;
+}
+inline ::dsnet::pbft::proto::StateRequest* PBFTMessage::mutable_state_request() {
+  ::dsnet::pbft::proto::StateRequest* _msg = _internal_mutable_state_request();
+  // @@protoc_insertion_point(field_mutable:dsnet.pbft.proto.PBFTMessage.state_request)
+  return _msg;
+}
+
+// .dsnet.pbft.proto.StateChunk state_chunk = 7;
+inline bool PBFTMessage::_internal_has_state_chunk() const {
+  return sub_case() == kStateChunk;
+}
+inline bool PBFTMessage::has_state_chunk() const {
+  return _internal_has_state_chunk();
+}
+inline void PBFTMessage::set_has_state_chunk() {
+  _impl_._oneof_case_[0] = kStateChunk;
+}
+inline void PBFTMessage::clear_state_chunk() {
+  if (_internal_has_state_chunk()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.sub_.state_chunk_;
+    }
+    clear_has_sub();
+  }
+}
+inline ::dsnet::pbft::proto::StateChunk* PBFTMessage::release_state_chunk() {
+  // @@protoc_insertion_point(field_release:dsnet.pbft.proto.PBFTMessage.state_chunk)
+  if (_internal_has_state_chunk()) {
+    clear_has_sub();
+    ::dsnet::pbft::proto::StateChunk* temp = _impl_.sub_.state_chunk_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.sub_.state_chunk_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::dsnet::pbft::proto::StateChunk& PBFTMessage::_internal_state_chunk() const {
+  return _internal_has_state_chunk()
+      ? *_impl_.sub_.state_chunk_
+      : reinterpret_cast< ::dsnet::pbft::proto::StateChunk&>(::dsnet::pbft::proto::_StateChunk_default_instance_);
+}
+inline const ::dsnet::pbft::proto::StateChunk& PBFTMessage::state_chunk() const {
+  // @@protoc_insertion_point(field_get:dsnet.pbft.proto.PBFTMessage.state_chunk)
+  return _internal_state_chunk();
+}
+inline ::dsnet::pbft::proto::StateChunk* PBFTMessage::unsafe_arena_release_state_chunk() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:dsnet.pbft.proto.PBFTMessage.state_chunk)
+  if (_internal_has_state_chunk()) {
+    clear_has_sub();
+    ::dsnet::pbft::proto::StateChunk* temp = _impl_.sub_.state_chunk_;
+    _impl_.sub_.state_chunk_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void PBFTMessage::unsafe_arena_set_allocated_state_chunk(::dsnet::pbft::proto::StateChunk* state_chunk) {
+  clear_sub();
+  if (state_chunk) {
+    set_has_state_chunk();
+    _impl_.sub_.state_chunk_ = state_chunk;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:dsnet.pbft.proto.PBFTMessage.state_chunk)
+}
+inline ::dsnet::pbft::proto::StateChunk* PBFTMessage::_internal_mutable_state_chunk() {
+  if (!_internal_has_state_chunk()) {
+    clear_sub();
+    set_has_state_chunk();
+    _impl_.sub_.state_chunk_ = CreateMaybeMessage< ::dsnet::pbft::proto::StateChunk >(GetArenaForAllocation());
+  }
+  return _impl_.sub_.state_chunk_;
+}
+inline ::dsnet::pbft::proto::StateChunk* PBFTMessage::mutable_state_chunk() {
+  ::dsnet::pbft::proto::StateChunk* _msg = _internal_mutable_state_chunk();
+  // @@protoc_insertion_point(field_mutable:dsnet.pbft.proto.PBFTMessage.state_chunk)
+  return _msg;
+}
+
+inline bool PBFTMessage::has_sub() const {
+  return sub_case() != SUB_NOT_SET;
+}
+inline void PBFTMessage::clear_has_sub() {
+  _impl_._oneof_case_[0] = SUB_NOT_SET;
+}
+inline PBFTMessage::SubCase PBFTMessage::sub_case() const {
+  return PBFTMessage::SubCase(_impl_._oneof_case_[0]);
+}
+// -------------------------------------------------------------------
+
+// Reply
+
+// bytes result = 1;
+inline void Reply::clear_result() {
+  _impl_.result_.ClearToEmpty();
+}
+inline const std::string& Reply::result() const {
+  // @@protoc_insertion_point(field_get:dsnet.pbft.proto.Reply.result)
+  return _internal_result();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void Reply::set_result(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.result_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:dsnet.pbft.proto.Reply.result)
+}
+inline std::string* Reply::mutable_result() {
+  std::string* _s = _internal_mutable_result();
+  // @@protoc_insertion_point(field_mutable:dsnet.pbft.proto.Reply.result)
+  return _s;
+}
+inline const std::string& Reply::_internal_result() const {
+  return _impl_.result_.Get();
+}
+inline void Reply::_internal_set_result(const std::string& value) {
+  
+  _impl_.result_.Set(value, GetArenaForAllocation());
+}
+inline std::string* Reply::_internal_mutable_result() {
+  
+  return _impl_.result_.Mutable(GetArenaForAllocation());
+}
+inline std::string* Reply::release_result() {
+  // @@protoc_insertion_point(field_release:dsnet.pbft.proto.Reply.result)
+  return _impl_.result_.Release();
+}
+inline void Reply::set_allocated_result(std::string* result) {
+  if (result != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.result_.SetAllocated(result, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.result_.IsDefault()) {
+    _impl_.result_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:dsnet.pbft.proto.Reply.result)
+}
+
+// uint64 request_number = 2;
+inline void Reply::clear_request_number() {
+  _impl_.request_number_ = uint64_t{0u};
+}
+inline uint64_t Reply::_internal_request_number() const {
+  return _impl_.request_number_;
+}
+inline uint64_t Reply::request_number() const {
+  // @@protoc_insertion_point(field_get:dsnet.pbft.proto.Reply.request_number)
+  return _internal_request_number();
+}
+inline void Reply::_internal_set_request_number(uint64_t value) {
+  
+  _impl_.request_number_ = value;
+}
+inline void Reply::set_request_number(uint64_t value) {
+  _internal_set_request_number(value);
+  // @@protoc_insertion_point(field_set:dsnet.pbft.proto.Reply.request_number)
+}
+
+// int32 replica_id = 3;
+inline void Reply::clear_replica_id() {
+  _impl_.replica_id_ = 0;
+}
+inline int32_t Reply::_internal_replica_id() const {
+  return _impl_.replica_id_;
+}
+inline int32_t Reply::replica_id() const {
+  // @@protoc_insertion_point(field_get:dsnet.pbft.proto.Reply.replica_id)
+  return _internal_replica_id();
+}
+inline void Reply::_internal_set_replica_id(int32_t value) {
+  
+  _impl_.replica_id_ = value;
+}
+inline void Reply::set_replica_id(int32_t value) {
+  _internal_set_replica_id(value);
+  // @@protoc_insertion_point(field_set:dsnet.pbft.proto.Reply.replica_id)
+}
+
+// uint32 view_number = 4;
+inline void Reply::clear_view_number() {
+  _impl_.view_number_ = 0u;
+}
+inline uint32_t Reply::_internal_view_number() const {
+  return _impl_.view_number_;
+}
+inline uint32_t Reply::view_number() const {
+  // @@protoc_insertion_point(field_get:dsnet.pbft.proto.Reply.view_number)
+  return _internal_view_number();
+}
+inline void Reply::_internal_set_view_number(uint32_t value) {
+  
+  _impl_.view_number_ = value;
+}
+inline void Reply::set_view_number(uint32_t value) {
+  _internal_set_view_number(value);
+  // @@protoc_insertion_point(field_set:dsnet.pbft.proto.Reply.view_number)
+}
+
+// -------------------------------------------------------------------
+
+// Preprepare
+
+// bytes signed_prepare = 1;
+inline void Preprepare::clear_signed_prepare() {
+  _impl_.signed_prepare_.ClearToEmpty();
+}
+inline const std::string& Preprepare::signed_prepare() const {
+  // @@protoc_insertion_point(field_get:dsnet.pbft.proto.Preprepare.signed_prepare)
+  return _internal_signed_prepare();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void Preprepare::set_signed_prepare(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.signed_prepare_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:dsnet.pbft.proto.Preprepare.signed_prepare)
+}
+inline std::string* Preprepare::mutable_signed_prepare() {
+  std::string* _s = _internal_mutable_signed_prepare();
+  // @@protoc_insertion_point(field_mutable:dsnet.pbft.proto.Preprepare.signed_prepare)
+  return _s;
+}
+inline const std::string& Preprepare::_internal_signed_prepare() const {
+  return _impl_.signed_prepare_.Get();
+}
+inline void Preprepare::_internal_set_signed_prepare(const std::string& value) {
+  
+  _impl_.signed_prepare_.Set(value, GetArenaForAllocation());
+}
+inline std::string* Preprepare::_internal_mutable_signed_prepare() {
+  
+  return _impl_.signed_prepare_.Mutable(GetArenaForAllocation());
+}
+inline std::string* Preprepare::release_signed_prepare() {
+  // @@protoc_insertion_point(field_release:dsnet.pbft.proto.Preprepare.signed_prepare)
+  return _impl_.signed_prepare_.Release();
+}
+inline void Preprepare::set_allocated_signed_prepare(std::string* signed_prepare) {
+  if (signed_prepare != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.signed_prepare_.SetAllocated(signed_prepare, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.signed_prepare_.IsDefault()) {
+    _impl_.signed_prepare_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:dsnet.pbft.proto.Preprepare.signed_prepare)
+}
+
+// repeated bytes signed_message = 2;
+inline int Preprepare::_internal_signed_message_size() const {
+  return _impl_.signed_message_.size();
+}
+inline int Preprepare::signed_message_size() const {
+  return _internal_signed_message_size();
+}
+inline void Preprepare::clear_signed_message() {
+  _impl_.signed_message_.Clear();
+}
+inline std::string* Preprepare::add_signed_message() {
+  std::string* _s = _internal_add_signed_message();
+  // @@protoc_insertion_point(field_add_mutable:dsnet.pbft.proto.Preprepare.signed_message)
+  return _s;
+}
+inline const std::string& Preprepare::_internal_signed_message(int index) const {
+  return _impl_.signed_message_.Get(index);
+}
+inline const std::string& Preprepare::signed_message(int index) const {
+  // @@protoc_insertion_point(field_get:dsnet.pbft.proto.Preprepare.signed_message)
+  return _internal_signed_message(index);
+}
+inline std::string* Preprepare::mutable_signed_message(int index) {
+  // @@protoc_insertion_point(field_mutable:dsnet.pbft.proto.Preprepare.signed_message)
+  return _impl_.signed_message_.Mutable(index);
+}
+inline void Preprepare::set_signed_message(int index, const std::string& value) {
+  _impl_.signed_message_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set:dsnet.pbft.proto.Preprepare.signed_message)
+}
+inline void Preprepare::set_signed_message(int index, std::string&& value) {
+  _impl_.signed_message_.Mutable(index)->assign(std::move(value));
+  // @@protoc_insertion_point(field_set:dsnet.pbft.proto.Preprepare.signed_message)
+}
+inline void Preprepare::set_signed_message(int index, const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.signed_message_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set_char:dsnet.pbft.proto.Preprepare.signed_message)
+}
+inline void Preprepare::set_signed_message(int index, const void* value, size_t size) {
+  _impl_.signed_message_.Mutable(index)->assign(
+    reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_set_pointer:dsnet.pbft.proto.Preprepare.signed_message)
+}
+inline std::string* Preprepare::_internal_add_signed_message() {
+  return _impl_.signed_message_.Add();
+}
+inline void Preprepare::add_signed_message(const std::string& value) {
+  _impl_.signed_message_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add:dsnet.pbft.proto.Preprepare.signed_message)
+}
+inline void Preprepare::add_signed_message(std::string&& value) {
+  _impl_.signed_message_.Add(std::move(value));
+  // @@protoc_insertion_point(field_add:dsnet.pbft.proto.Preprepare.signed_message)
+}
+inline void Preprepare::add_signed_message(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.signed_message_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add_char:dsnet.pbft.proto.Preprepare.signed_message)
+}
+inline void Preprepare::add_signed_message(const void* value, size_t size) {
+  _impl_.signed_message_.Add()->assign(reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_add_pointer:dsnet.pbft.proto.Preprepare.signed_message)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>&
+Preprepare::signed_message() const {
+  // @@protoc_insertion_point(field_list:dsnet.pbft.proto.Preprepare.signed_message)
+  return _impl_.signed_message_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>*
+Preprepare::mutable_signed_message() {
+  // @@protoc_insertion_point(field_mutable_list:dsnet.pbft.proto.Preprepare.signed_message)
+  return &_impl_.signed_message_;
+}
+
+// -------------------------------------------------------------------
+
+// Prepare
+
+// uint32 view_number = 1;
+inline void Prepare::clear_view_number() {
+  _impl_.view_number_ = 0u;
+}
+inline uint32_t Prepare::_internal_view_number() const {
+  return _impl_.view_number_;
+}
+inline uint32_t Prepare::view_number() const {
+  // @@protoc_insertion_point(field_get:dsnet.pbft.proto.Prepare.view_number)
+  return _internal_view_number();
+}
+inline void Prepare::_internal_set_view_number(uint32_t value) {
+  
+  _impl_.view_number_ = value;
+}
+inline void Prepare::set_view_number(uint32_t value) {
+  _internal_set_view_number(value);
+  // @@protoc_insertion_point(field_set:dsnet.pbft.proto.Prepare.view_number)
+}
+
+// uint64 op_number = 2;
+inline void Prepare::clear_op_number() {
+  _impl_.op_number_ = uint64_t{0u};
+}
+inline uint64_t Prepare::_internal_op_number() const {
+  return _impl_.op_number_;
+}
+inline uint64_t Prepare::op_number() const {
+  // @@protoc_insertion_point(field_get:dsnet.pbft.proto.Prepare.op_number)
+  return _internal_op_number();
+}
+inline void Prepare::_internal_set_op_number(uint64_t value) {
+  
+  _impl_.op_number_ = value;
+}
+inline void Prepare::set_op_number(uint64_t value) {
+  _internal_set_op_number(value);
+  // @@protoc_insertion_point(field_set:dsnet.pbft.proto.Prepare.op_number)
+}
+
+// uint64 batch_size = 3;
+inline void Prepare::clear_batch_size() {
+  _impl_.batch_size_ = uint64_t{0u};
+}
+inline uint64_t Prepare::_internal_batch_size() const {
+  return _impl_.batch_size_;
+}
+inline uint64_t Prepare::batch_size() const {
+  // @@protoc_insertion_point(field_get:dsnet.pbft.proto.Prepare.batch_size)
+  return _internal_batch_size();
+}
+inline void Prepare::_internal_set_batch_size(uint64_t value) {
+  
+  _impl_.batch_size_ = value;
+}
+inline void Prepare::set_batch_size(uint64_t value) {
+  _internal_set_batch_size(value);
+  // @@protoc_insertion_point(field_set:dsnet.pbft.proto.Prepare.batch_size)
+}
+
+// bytes digest = 4;
+inline void Prepare::clear_digest() {
+  _impl_.digest_.ClearToEmpty();
+}
+inline const std::string& Prepare::digest() const {
+  // @@protoc_insertion_point(field_get:dsnet.pbft.proto.Prepare.digest)
+  return _internal_digest();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void Prepare::set_digest(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.digest_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:dsnet.pbft.proto.Prepare.digest)
+}
+inline std::string* Prepare::mutable_digest() {
+  std::string* _s = _internal_mutable_digest();
+  // @@protoc_insertion_point(field_mutable:dsnet.pbft.proto.Prepare.digest)
+  return _s;
+}
+inline const std::string& Prepare::_internal_digest() const {
+  return _impl_.digest_.Get();
+}
+inline void Prepare::_internal_set_digest(const std::string& value) {
+  
+  _impl_.digest_.Set(value, GetArenaForAllocation());
+}
+inline std::string* Prepare::_internal_mutable_digest() {
+  
+  return _impl_.digest_.Mutable(GetArenaForAllocation());
+}
+inline std::string* Prepare::release_digest() {
+  // @@protoc_insertion_point(field_release:dsnet.pbft.proto.Prepare.digest)
+  return _impl_.digest_.Release();
+}
+inline void Prepare::set_allocated_digest(std::string* digest) {
+  if (digest != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.digest_.SetAllocated(digest, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.digest_.IsDefault()) {
+    _impl_.digest_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:dsnet.pbft.proto.Prepare.digest)
+}
+
+// int32 replica_id = 5;
+inline void Prepare::clear_replica_id() {
+  _impl_.replica_id_ = 0;
+}
+inline int32_t Prepare::_internal_replica_id() const {
+  return _impl_.replica_id_;
+}
+inline int32_t Prepare::replica_id() const {
+  // @@protoc_insertion_point(field_get:dsnet.pbft.proto.Prepare.replica_id)
+  return _internal_replica_id();
+}
+inline void Prepare::_internal_set_replica_id(int32_t value) {
+  
+  _impl_.replica_id_ = value;
+}
+inline void Prepare::set_replica_id(int32_t value) {
+  _internal_set_replica_id(value);
+  // @@protoc_insertion_point(field_set:dsnet.pbft.proto.Prepare.replica_id)
+}
+
+// -------------------------------------------------------------------
+
+// Commit
+
+// uint32 view_number = 1;
+inline void Commit::clear_view_number() {
+  _impl_.view_number_ = 0u;
+}
+inline uint32_t Commit::_internal_view_number() const {
+  return _impl_.view_number_;
+}
+inline uint32_t Commit::view_number() const {
+  // @@protoc_insertion_point(field_get:dsnet.pbft.proto.Commit.view_number)
+  return _internal_view_number();
+}
+inline void Commit::_internal_set_view_number(uint32_t value) {
+  
+  _impl_.view_number_ = value;
+}
+inline void Commit::set_view_number(uint32_t value) {
+  _internal_set_view_number(value);
+  // @@protoc_insertion_point(field_set:dsnet.pbft.proto.Commit.view_number)
+}
+
+// uint64 op_number = 2;
+inline void Commit::clear_op_number() {
+  _impl_.op_number_ = uint64_t{0u};
+}
+inline uint64_t Commit::_internal_op_number() const {
+  return _impl_.op_number_;
+}
+inline uint64_t Commit::op_number() const {
+  // @@protoc_insertion_point(field_get:dsnet.pbft.proto.Commit.op_number)
+  return _internal_op_number();
+}
+inline void Commit::_internal_set_op_number(uint64_t value) {
+  
+  _impl_.op_number_ = value;
+}
+inline void Commit::set_op_number(uint64_t value) {
+  _internal_set_op_number(value);
+  // @@protoc_insertion_point(field_set:dsnet.pbft.proto.Commit.op_number)
+}
+
+// uint64 batch_size = 3;
+inline void Commit::clear_batch_size() {
+  _impl_.batch_size_ = uint64_t{0u};
+}
+inline uint64_t Commit::_internal_batch_size() const {
+  return _impl_.batch_size_;
+}
+inline uint64_t Commit::batch_size() const {
+  // @@protoc_insertion_point(field_get:dsnet.pbft.proto.Commit.batch_size)
+  return _internal_batch_size();
+}
+inline void Commit::_internal_set_batch_size(uint64_t value) {
+  
+  _impl_.batch_size_ = value;
+}
+inline void Commit::set_batch_size(uint64_t value) {
+  _internal_set_batch_size(value);
+  // @@protoc_insertion_point(field_set:dsnet.pbft.proto.Commit.batch_size)
+}
+
+// bytes digest = 4;
+inline void Commit::clear_digest() {
+  _impl_.digest_.ClearToEmpty();
+}
+inline const std::string& Commit::digest() const {
+  // @@protoc_insertion_point(field_get:dsnet.pbft.proto.Commit.digest)
+  return _internal_digest();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void Commit::set_digest(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.digest_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:dsnet.pbft.proto.Commit.digest)
+}
+inline std::string* Commit::mutable_digest() {
+  std::string* _s = _internal_mutable_digest();
+  // @@protoc_insertion_point(field_mutable:dsnet.pbft.proto.Commit.digest)
+  return _s;
+}
+inline const std::string& Commit::_internal_digest() const {
+  return _impl_.digest_.Get();
+}
+inline void Commit::_internal_set_digest(const std::string& value) {
+  
+  _impl_.digest_.Set(value, GetArenaForAllocation());
+}
+inline std::string* Commit::_internal_mutable_digest() {
+  
+  return _impl_.digest_.Mutable(GetArenaForAllocation());
+}
+inline std::string* Commit::release_digest() {
+  // @@protoc_insertion_point(field_release:dsnet.pbft.proto.Commit.digest)
+  return _impl_.digest_.Release();
+}
+inline void Commit::set_allocated_digest(std::string* digest) {
+  if (digest != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.digest_.SetAllocated(digest, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.digest_.IsDefault()) {
+    _impl_.digest_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:dsnet.pbft.proto.Commit.digest)
+}
+
+// int32 replica_id = 5;
+inline void Commit::clear_replica_id() {
+  _impl_.replica_id_ = 0;
+}
+inline int32_t Commit::_internal_replica_id() const {
+  return _impl_.replica_id_;
+}
+inline int32_t Commit::replica_id() const {
+  // @@protoc_insertion_point(field_get:dsnet.pbft.proto.Commit.replica_id)
+  return _internal_replica_id();
+}
+inline void Commit::_internal_set_replica_id(int32_t value) {
+  
+  _impl_.replica_id_ = value;
+}
+inline void Commit::set_replica_id(int32_t value) {
+  _internal_set_replica_id(value);
+  // @@protoc_insertion_point(field_set:dsnet.pbft.proto.Commit.replica_id)
+}
+
+// -------------------------------------------------------------------
+
+// Checkpoint
+
+// uint64 op_number = 1;
+inline void Checkpoint::clear_op_number() {
+  _impl_.op_number_ = uint64_t{0u};
+}
+inline uint64_t Checkpoint::_internal_op_number() const {
+  return _impl_.op_number_;
+}
+inline uint64_t Checkpoint::op_number() const {
+  // @@protoc_insertion_point(field_get:dsnet.pbft.proto.Checkpoint.op_number)
+  return _internal_op_number();
+}
+inline void Checkpoint::_internal_set_op_number(uint64_t value) {
+  
+  _impl_.op_number_ = value;
+}
+inline void Checkpoint::set_op_number(uint64_t value) {
+  _internal_set_op_number(value);
+  // @@protoc_insertion_point(field_set:dsnet.pbft.proto.Checkpoint.op_number)
+}
+
+// bytes digest = 2;
+inline void Checkpoint::clear_digest() {
+  _impl_.digest_.ClearToEmpty();
+}
+inline const std::string& Checkpoint::digest() const {
+  // @@protoc_insertion_point(field_get:dsnet.pbft.proto.Checkpoint.digest)
+  return _internal_digest();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void Checkpoint::set_digest(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.digest_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:dsnet.pbft.proto.Checkpoint.digest)
+}
+inline std::string* Checkpoint::mutable_digest() {
+  std::string* _s = _internal_mutable_digest();
+  // @@protoc_insertion_point(field_mutable:dsnet.pbft.proto.Checkpoint.digest)
+  return _s;
+}
+inline const std::string& Checkpoint::_internal_digest() const {
+  return _impl_.digest_.Get();
+}
+inline void Checkpoint::_internal_set_digest(const std::string& value) {
+  
+  _impl_.digest_.Set(value, GetArenaForAllocation());
+}
+inline std::string* Checkpoint::_internal_mutable_digest() {
+  
+  return _impl_.digest_.Mutable(GetArenaForAllocation());
+}
+inline std::string* Checkpoint::release_digest() {
+  // @@protoc_insertion_point(field_release:dsnet.pbft.proto.Checkpoint.digest)
+  return _impl_.digest_.Release();
+}
+inline void Checkpoint::set_allocated_digest(std::string* digest) {
+  if (digest != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.digest_.SetAllocated(digest, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.digest_.IsDefault()) {
+    _impl_.digest_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:dsnet.pbft.proto.Checkpoint.digest)
+}
+
+// int32 replica_id = 3;
+inline void Checkpoint::clear_replica_id() {
+  _impl_.replica_id_ = 0;
+}
+inline int32_t Checkpoint::_internal_replica_id() const {
+  return _impl_.replica_id_;
+}
+inline int32_t Checkpoint::replica_id() const {
+  // @@protoc_insertion_point(field_get:dsnet.pbft.proto.Checkpoint.replica_id)
+  return _internal_replica_id();
+}
+inline void Checkpoint::_internal_set_replica_id(int32_t value) {
+  
+  _impl_.replica_id_ = value;
+}
+inline void Checkpoint::set_replica_id(int32_t value) {
+  _internal_set_replica_id(value);
+  // @@protoc_insertion_point(field_set:dsnet.pbft.proto.Checkpoint.replica_id)
+}
+
+// -------------------------------------------------------------------
+
+// StateRequest
+
+// uint64 op_number = 1;
+inline void StateRequest::clear_op_number() {
+  _impl_.op_number_ = uint64_t{0u};
+}
+inline uint64_t StateRequest::_internal_op_number() const {
+  return _impl_.op_number_;
+}
+inline uint64_t StateRequest::op_number() const {
+  // @@protoc_insertion_point(field_get:dsnet.pbft.proto.StateRequest.op_number)
+  return _internal_op_number();
+}
+inline void StateRequest::_internal_set_op_number(uint64_t value) {
+  
+  _impl_.op_number_ = value;
+}
+inline void StateRequest::set_op_number(uint64_t value) {
+  _internal_set_op_number(value);
+  // @@protoc_insertion_point(field_set:dsnet.pbft.proto.StateRequest.op_number)
+}
+
+// uint64 last_op_number = 2;
+inline void StateRequest::clear_last_op_number() {
+  _impl_.last_op_number_ = uint64_t{0u};
+}
+inline uint64_t StateRequest::_internal_last_op_number() const {
+  return _impl_.last_op_number_;
+}
+inline uint64_t StateRequest::last_op_number() const {
+  // @@protoc_insertion_point(field_get:dsnet.pbft.proto.StateRequest.last_op_number)
+  return _internal_last_op_number();
+}
+inline void StateRequest::_internal_set_last_op_number(uint64_t value) {
+  
+  _impl_.last_op_number_ = value;
+}
+inline void StateRequest::set_last_op_number(uint64_t value) {
+  _internal_set_last_op_number(value);
+  // @@protoc_insertion_point(field_set:dsnet.pbft.proto.StateRequest.last_op_number)
+}
+
+// int32 replica_id = 3;
+inline void StateRequest::clear_replica_id() {
+  _impl_.replica_id_ = 0;
+}
+inline int32_t StateRequest::_internal_replica_id() const {
+  return _impl_.replica_id_;
+}
+inline int32_t StateRequest::replica_id() const {
+  // @@protoc_insertion_point(field_get:dsnet.pbft.proto.StateRequest.replica_id)
+  return _internal_replica_id();
+}
+inline void StateRequest::_internal_set_replica_id(int32_t value) {
+  
+  _impl_.replica_id_ = value;
+}
+inline void StateRequest::set_replica_id(int32_t value) {
+  _internal_set_replica_id(value);
+  // @@protoc_insertion_point(field_set:dsnet.pbft.proto.StateRequest.replica_id)
+}
+
+// -------------------------------------------------------------------
+
+// StateChunk
+
+// uint64 op_number = 1;
+inline void StateChunk::clear_op_number() {
+  _impl_.op_number_ = uint64_t{0u};
+}
+inline uint64_t StateChunk::_internal_op_number() const {
+  return _impl_.op_number_;
+}
+inline uint64_t StateChunk::op_number() const {
+  // @@protoc_insertion_point(field_get:dsnet.pbft.proto.StateChunk.op_number)
+  return _internal_op_number();
+}
+inline void StateChunk::_internal_set_op_number(uint64_t value) {
+  
+  _impl_.op_number_ = value;
+}
+inline void StateChunk::set_op_number(uint64_t value) {
+  _internal_set_op_number(value);
+  // @@protoc_insertion_point(field_set:dsnet.pbft.proto.StateChunk.op_number)
+}
+
+// uint32 view_number = 2;
+inline void StateChunk::clear_view_number() {
+  _impl_.view_number_ = 0u;
+}
+inline uint32_t StateChunk::_internal_view_number() const {
+  return _impl_.view_number_;
+}
+inline uint32_t StateChunk::view_number() const {
+  // @@protoc_insertion_point(field_get:dsnet.pbft.proto.StateChunk.view_number)
+  return _internal_view_number();
+}
+inline void StateChunk::_internal_set_view_number(uint32_t value) {
+  
+  _impl_.view_number_ = value;
+}
+inline void StateChunk::set_view_number(uint32_t value) {
+  _internal_set_view_number(value);
+  // @@protoc_insertion_point(field_set:dsnet.pbft.proto.StateChunk.view_number)
+}
+
+// repeated .dsnet.Request request = 3;
+inline int StateChunk::_internal_request_size() const {
+  return _impl_.request_.size();
+}
+inline int StateChunk::request_size() const {
+  return _internal_request_size();
+}
+inline ::dsnet::Request* StateChunk::mutable_request(int index) {
+  // @@protoc_insertion_point(field_mutable:dsnet.pbft.proto.StateChunk.request)
+  return _impl_.request_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::dsnet::Request >*
+StateChunk::mutable_request() {
+  // @@protoc_insertion_point(field_mutable_list:dsnet.pbft.proto.StateChunk.request)
+  return &_impl_.request_;
+}
+inline const ::dsnet::Request& StateChunk::_internal_request(int index) const {
+  return _impl_.request_.Get(index);
+}
+inline const ::dsnet::Request& StateChunk::request(int index) const {
+  // @@protoc_insertion_point(field_get:dsnet.pbft.proto.StateChunk.request)
+  return _internal_request(index);
+}
+inline ::dsnet::Request* StateChunk::_internal_add_request() {
+  return _impl_.request_.Add();
+}
+inline ::dsnet::Request* StateChunk::add_request() {
+  ::dsnet::Request* _add = _internal_add_request();
+  // @@protoc_insertion_point(field_add:dsnet.pbft.proto.StateChunk.request)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::dsnet::Request >&
+StateChunk::request() const {
+  // @@protoc_insertion_point(field_list:dsnet.pbft.proto.StateChunk.request)
+  return _impl_.request_;
+}
+
+// .dsnet.pbft.proto.StableCheckpoint checkpoint = 4;
+inline bool StateChunk::_internal_has_checkpoint() const {
+  return this != internal_default_instance() && _impl_.checkpoint_ != nullptr;
+}
+inline bool StateChunk::has_checkpoint() const {
+  return _internal_has_checkpoint();
+}
+inline void StateChunk::clear_checkpoint() {
+  if (GetArenaForAllocation() == nullptr && _impl_.checkpoint_ != nullptr) {
+    delete _impl_.checkpoint_;
+  }
+  _impl_.checkpoint_ = nullptr;
+}
+inline const ::dsnet::pbft::proto::StableCheckpoint& StateChunk::_internal_checkpoint() const {
+  const ::dsnet::pbft::proto::StableCheckpoint* p = _impl_.checkpoint_;
+  return p != nullptr ? *p : reinterpret_cast<const ::dsnet::pbft::proto::StableCheckpoint&>(
+      ::dsnet::pbft::proto::_StableCheckpoint_default_instance_);
+}
+inline const ::dsnet::pbft::proto::StableCheckpoint& StateChunk::checkpoint() const {
+  // @@protoc_insertion_point(field_get:dsnet.pbft.proto.StateChunk.checkpoint)
+  return _internal_checkpoint();
+}
+inline void StateChunk::unsafe_arena_set_allocated_checkpoint(
+    ::dsnet::pbft::proto::StableCheckpoint* checkpoint) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.checkpoint_);
+  }
+  _impl_.checkpoint_ = checkpoint;
+  if (checkpoint) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:dsnet.pbft.proto.StateChunk.checkpoint)
+}
+inline ::dsnet::pbft::proto::StableCheckpoint* StateChunk::release_checkpoint() {
+  
+  ::dsnet::pbft::proto::StableCheckpoint* temp = _impl_.checkpoint_;
+  _impl_.checkpoint_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::dsnet::pbft::proto::StableCheckpoint* StateChunk::unsafe_arena_release_checkpoint() {
+  // @@protoc_insertion_point(field_release:dsnet.pbft.proto.StateChunk.checkpoint)
+  
+  ::dsnet::pbft::proto::StableCheckpoint* temp = _impl_.checkpoint_;
+  _impl_.checkpoint_ = nullptr;
+  return temp;
+}
+inline ::dsnet::pbft::proto::StableCheckpoint* StateChunk::_internal_mutable_checkpoint() {
+  
+  if (_impl_.checkpoint_ == nullptr) {
+    auto* p = CreateMaybeMessage<::dsnet::pbft::proto::StableCheckpoint>(GetArenaForAllocation());
+    _impl_.checkpoint_ = p;
+  }
+  return _impl_.checkpoint_;
+}
+inline ::dsnet::pbft::proto::StableCheckpoint* StateChunk::mutable_checkpoint() {
+  ::dsnet::pbft::proto::StableCheckpoint* _msg = _internal_mutable_checkpoint();
+  // @@protoc_insertion_point(field_mutable:dsnet.pbft.proto.StateChunk.checkpoint)
+  return _msg;
+}
+inline void StateChunk::set_allocated_checkpoint(::dsnet::pbft::proto::StableCheckpoint* checkpoint) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.checkpoint_;
+  }
+  if (checkpoint) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(checkpoint);
+    if (message_arena != submessage_arena) {
+      checkpoint = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, checkpoint, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.checkpoint_ = checkpoint;
+  // @@protoc_insertion_point(field_set_allocated:dsnet.pbft.proto.StateChunk.checkpoint)
+}
+
+// int32 replica_id = 5;
+inline void StateChunk::clear_replica_id() {
+  _impl_.replica_id_ = 0;
+}
+inline int32_t StateChunk::_internal_replica_id() const {
+  return _impl_.replica_id_;
+}
+inline int32_t StateChunk::replica_id() const {
+  // @@protoc_insertion_point(field_get:dsnet.pbft.proto.StateChunk.replica_id)
+  return _internal_replica_id();
+}
+inline void StateChunk::_internal_set_replica_id(int32_t value) {
+  
+  _impl_.replica_id_ = value;
+}
+inline void StateChunk::set_replica_id(int32_t value) {
+  _internal_set_replica_id(value);
+  // @@protoc_insertion_point(field_set:dsnet.pbft.proto.StateChunk.replica_id)
+}
+
+// -------------------------------------------------------------------
+
+// StableCheckpoint
+
+// uint64 op_number = 1;
+inline void StableCheckpoint::clear_op_number() {
+  _impl_.op_number_ = uint64_t{0u};
+}
+inline uint64_t StableCheckpoint::_internal_op_number() const {
+  return _impl_.op_number_;
+}
+inline uint64_t StableCheckpoint::op_number() const {
+  // @@protoc_insertion_point(field_get:dsnet.pbft.proto.StableCheckpoint.op_number)
+  return _internal_op_number();
+}
+inline void StableCheckpoint::_internal_set_op_number(uint64_t value) {
+  
+  _impl_.op_number_ = value;
+}
+inline void StableCheckpoint::set_op_number(uint64_t value) {
+  _internal_set_op_number(value);
+  // @@protoc_insertion_point(field_set:dsnet.pbft.proto.StableCheckpoint.op_number)
+}
+
+// bytes digest = 2;
+inline void StableCheckpoint::clear_digest() {
+  _impl_.digest_.ClearToEmpty();
+}
+inline const std::string& StableCheckpoint::digest() const {
+  // @@protoc_insertion_point(field_get:dsnet.pbft.proto.StableCheckpoint.digest)
+  return _internal_digest();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void StableCheckpoint::set_digest(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.digest_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:dsnet.pbft.proto.StableCheckpoint.digest)
+}
+inline std::string* StableCheckpoint::mutable_digest() {
+  std::string* _s = _internal_mutable_digest();
+  // @@protoc_insertion_point(field_mutable:dsnet.pbft.proto.StableCheckpoint.digest)
+  return _s;
+}
+inline const std::string& StableCheckpoint::_internal_digest() const {
+  return _impl_.digest_.Get();
+}
+inline void StableCheckpoint::_internal_set_digest(const std::string& value) {
+  
+  _impl_.digest_.Set(value, GetArenaForAllocation());
+}
+inline std::string* StableCheckpoint::_internal_mutable_digest() {
+  
+  return _impl_.digest_.Mutable(GetArenaForAllocation());
+}
+inline std::string* StableCheckpoint::release_digest() {
+  // @@protoc_insertion_point(field_release:dsnet.pbft.proto.StableCheckpoint.digest)
+  return _impl_.digest_.Release();
+}
+inline void StableCheckpoint::set_allocated_digest(std::string* digest) {
+  if (digest != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.digest_.SetAllocated(digest, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.digest_.IsDefault()) {
+    _impl_.digest_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:dsnet.pbft.proto.StableCheckpoint.digest)
+}
+
+// bytes app_state = 3;
+inline void StableCheckpoint::clear_app_state() {
+  _impl_.app_state_.ClearToEmpty();
+}
+inline const std::string& StableCheckpoint::app_state() const {
+  // @@protoc_insertion_point(field_get:dsnet.pbft.proto.StableCheckpoint.app_state)
+  return _internal_app_state();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void StableCheckpoint::set_app_state(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.app_state_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:dsnet.pbft.proto.StableCheckpoint.app_state)
+}
+inline std::string* StableCheckpoint::mutable_app_state() {
+  std::string* _s = _internal_mutable_app_state();
+  // @@protoc_insertion_point(field_mutable:dsnet.pbft.proto.StableCheckpoint.app_state)
+  return _s;
+}
+inline const std::string& StableCheckpoint::_internal_app_state() const {
+  return _impl_.app_state_.Get();
+}
+inline void StableCheckpoint::_internal_set_app_state(const std::string& value) {
+  
+  _impl_.app_state_.Set(value, GetArenaForAllocation());
+}
+inline std::string* StableCheckpoint::_internal_mutable_app_state() {
+  
+  return _impl_.app_state_.Mutable(GetArenaForAllocation());
+}
+inline std::string* StableCheckpoint::release_app_state() {
+  // @@protoc_insertion_point(field_release:dsnet.pbft.proto.StableCheckpoint.app_state)
+  return _impl_.app_state_.Release();
+}
+inline void StableCheckpoint::set_allocated_app_state(std::string* app_state) {
+  if (app_state != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.app_state_.SetAllocated(app_state, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.app_state_.IsDefault()) {
+    _impl_.app_state_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:dsnet.pbft.proto.StableCheckpoint.app_state)
+}
+
+// repeated bytes signed_checkpoint = 4;
+inline int StableCheckpoint::_internal_signed_checkpoint_size() const {
+  return _impl_.signed_checkpoint_.size();
+}
+inline int StableCheckpoint::signed_checkpoint_size() const {
+  return _internal_signed_checkpoint_size();
+}
+inline void StableCheckpoint::clear_signed_checkpoint() {
+  _impl_.signed_checkpoint_.Clear();
+}
+inline std::string* StableCheckpoint::add_signed_checkpoint() {
+  std::string* _s = _internal_add_signed_checkpoint();
+  // @@protoc_insertion_point(field_add_mutable:dsnet.pbft.proto.StableCheckpoint.signed_checkpoint)
+  return _s;
+}
+inline const std::string& StableCheckpoint::_internal_signed_checkpoint(int index) const {
+  return _impl_.signed_checkpoint_.Get(index);
+}
+inline const std::string& StableCheckpoint::signed_checkpoint(int index) const {
+  // @@protoc_insertion_point(field_get:dsnet.pbft.proto.StableCheckpoint.signed_checkpoint)
+  return _internal_signed_checkpoint(index);
+}
+inline std::string* StableCheckpoint::mutable_signed_checkpoint(int index) {
+  // @@protoc_insertion_point(field_mutable:dsnet.pbft.proto.StableCheckpoint.signed_checkpoint)
+  return _impl_.signed_checkpoint_.Mutable(index);
+}
+inline void StableCheckpoint::set_signed_checkpoint(int index, const std::string& value) {
+  _impl_.signed_checkpoint_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set:dsnet.pbft.proto.StableCheckpoint.signed_checkpoint)
+}
+inline void StableCheckpoint::set_signed_checkpoint(int index, std::string&& value) {
+  _impl_.signed_checkpoint_.Mutable(index)->assign(std::move(value));
+  // @@protoc_insertion_point(field_set:dsnet.pbft.proto.StableCheckpoint.signed_checkpoint)
+}
+inline void StableCheckpoint::set_signed_checkpoint(int index, const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.signed_checkpoint_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set_char:dsnet.pbft.proto.StableCheckpoint.signed_checkpoint)
+}
+inline void StableCheckpoint::set_signed_checkpoint(int index, const void* value, size_t size) {
+  _impl_.signed_checkpoint_.Mutable(index)->assign(
+    reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_set_pointer:dsnet.pbft.proto.StableCheckpoint.signed_checkpoint)
+}
+inline std::string* StableCheckpoint::_internal_add_signed_checkpoint() {
+  return _impl_.signed_checkpoint_.Add();
+}
+inline void StableCheckpoint::add_signed_checkpoint(const std::string& value) {
+  _impl_.signed_checkpoint_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add:dsnet.pbft.proto.StableCheckpoint.signed_checkpoint)
+}
+inline void StableCheckpoint::add_signed_checkpoint(std::string&& value) {
+  _impl_.signed_checkpoint_.Add(std::move(value));
+  // @@protoc_insertion_point(field_add:dsnet.pbft.proto.StableCheckpoint.signed_checkpoint)
+}
+inline void StableCheckpoint::add_signed_checkpoint(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.signed_checkpoint_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add_char:dsnet.pbft.proto.StableCheckpoint.signed_checkpoint)
+}
+inline void StableCheckpoint::add_signed_checkpoint(const void* value, size_t size) {
+  _impl_.signed_checkpoint_.Add()->assign(reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_add_pointer:dsnet.pbft.proto.StableCheckpoint.signed_checkpoint)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>&
+StableCheckpoint::signed_checkpoint() const {
+  // @@protoc_insertion_point(field_list:dsnet.pbft.proto.StableCheckpoint.signed_checkpoint)
+  return _impl_.signed_checkpoint_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>*
+StableCheckpoint::mutable_signed_checkpoint() {
+  // @@protoc_insertion_point(field_mutable_list:dsnet.pbft.proto.StableCheckpoint.signed_checkpoint)
+  return &_impl_.signed_checkpoint_;
+}
+
+// bytes log_hash = 5;
+inline void StableCheckpoint::clear_log_hash() {
+  _impl_.log_hash_.ClearToEmpty();
+}
+inline const std::string& StableCheckpoint::log_hash() const {
+  // @@protoc_insertion_point(field_get:dsnet.pbft.proto.StableCheckpoint.log_hash)
+  return _internal_log_hash();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void StableCheckpoint::set_log_hash(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.log_hash_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:dsnet.pbft.proto.StableCheckpoint.log_hash)
+}
+inline std::string* StableCheckpoint::mutable_log_hash() {
+  std::string* _s = _internal_mutable_log_hash();
+  // @@protoc_insertion_point(field_mutable:dsnet.pbft.proto.StableCheckpoint.log_hash)
+  return _s;
+}
+inline const std::string& StableCheckpoint::_internal_log_hash() const {
+  return _impl_.log_hash_.Get();
+}
+inline void StableCheckpoint::_internal_set_log_hash(const std::string& value) {
+  
+  _impl_.log_hash_.Set(value, GetArenaForAllocation());
+}
+inline std::string* StableCheckpoint::_internal_mutable_log_hash() {
+  
+  return _impl_.log_hash_.Mutable(GetArenaForAllocation());
+}
+inline std::string* StableCheckpoint::release_log_hash() {
+  // @@protoc_insertion_point(field_release:dsnet.pbft.proto.StableCheckpoint.log_hash)
+  return _impl_.log_hash_.Release();
+}
+inline void StableCheckpoint::set_allocated_log_hash(std::string* log_hash) {
+  if (log_hash != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.log_hash_.SetAllocated(log_hash, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.log_hash_.IsDefault()) {
+    _impl_.log_hash_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:dsnet.pbft.proto.StableCheckpoint.log_hash)
+}
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic pop
+#endif  // __GNUC__
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+
+// @@protoc_insertion_point(namespace_scope)
+
+}  // namespace proto
+}  // namespace pbft
+}  // namespace dsnet
+
+// @@protoc_insertion_point(global_scope)
+
+#include <google/protobuf/port_undef.inc>
+#endif  // GOOGLE_PROTOBUF_INCLUDED_GOOGLE_PROTOBUF_INCLUDED_replication_2fpbft_2fmessage_2eproto
@@ -0,0 +1,1926 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: replication/signedunrep/signedunrep-proto.proto
+
+#include "replication/signedunrep/signedunrep-proto.pb.h"
+
+#include <algorithm>
+
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/extension_set.h>
+#include <google/protobuf/wire_format_lite.h>
+#include <google/protobuf/descriptor.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/reflection_ops.h>
+#include <google/protobuf/wire_format.h>
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+
+PROTOBUF_PRAGMA_INIT_SEG
+
+namespace _pb = ::PROTOBUF_NAMESPACE_ID;
+namespace _pbi = _pb::internal;
+
+namespace dsnet {
+namespace signedunrep {
+namespace proto {
+PROTOBUF_CONSTEXPR RequestMessage::RequestMessage(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.req_)*/nullptr} {}
+struct RequestMessageDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR RequestMessageDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~RequestMessageDefaultTypeInternal() {}
+  union {
+    RequestMessage _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 RequestMessageDefaultTypeInternal _RequestMessage_default_instance_;
+PROTOBUF_CONSTEXPR UnloggedRequestMessage::UnloggedRequestMessage(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.req_)*/nullptr} {}
+struct UnloggedRequestMessageDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR UnloggedRequestMessageDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~UnloggedRequestMessageDefaultTypeInternal() {}
+  union {
+    UnloggedRequestMessage _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 UnloggedRequestMessageDefaultTypeInternal _UnloggedRequestMessage_default_instance_;
+PROTOBUF_CONSTEXPR ToReplicaMessage::ToReplicaMessage(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.msg_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_._oneof_case_)*/{}} {}
+struct ToReplicaMessageDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ToReplicaMessageDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ToReplicaMessageDefaultTypeInternal() {}
+  union {
+    ToReplicaMessage _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ToReplicaMessageDefaultTypeInternal _ToReplicaMessage_default_instance_;
+PROTOBUF_CONSTEXPR ReplyMessage::ReplyMessage(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.reply_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.req_)*/nullptr
+  , /*decltype(_impl_.view_)*/uint64_t{0u}
+  , /*decltype(_impl_.opnum_)*/uint64_t{0u}} {}
+struct ReplyMessageDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ReplyMessageDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ReplyMessageDefaultTypeInternal() {}
+  union {
+    ReplyMessage _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ReplyMessageDefaultTypeInternal _ReplyMessage_default_instance_;
+PROTOBUF_CONSTEXPR UnloggedReplyMessage::UnloggedReplyMessage(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.reply_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}} {}
+struct UnloggedReplyMessageDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR UnloggedReplyMessageDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~UnloggedReplyMessageDefaultTypeInternal() {}
+  union {
+    UnloggedReplyMessage _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 UnloggedReplyMessageDefaultTypeInternal _UnloggedReplyMessage_default_instance_;
+PROTOBUF_CONSTEXPR ToClientMessage::ToClientMessage(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.msg_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_._oneof_case_)*/{}} {}
+struct ToClientMessageDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ToClientMessageDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ToClientMessageDefaultTypeInternal() {}
+  union {
+    ToClientMessage _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ToClientMessageDefaultTypeInternal _ToClientMessage_default_instance_;
+}  // namespace proto
+}  // namespace signedunrep
+}  // namespace dsnet
+static ::_pb::Metadata file_level_metadata_replication_2fsignedunrep_2fsignedunrep_2dproto_2eproto[6];
+static constexpr ::_pb::EnumDescriptor const** file_level_enum_descriptors_replication_2fsignedunrep_2fsignedunrep_2dproto_2eproto = nullptr;
+static constexpr ::_pb::ServiceDescriptor const** file_level_service_descriptors_replication_2fsignedunrep_2fsignedunrep_2dproto_2eproto = nullptr;
+
+const uint32_t TableStruct_replication_2fsignedunrep_2fsignedunrep_2dproto_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  PROTOBUF_FIELD_OFFSET(::dsnet::signedunrep::proto::RequestMessage, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::signedunrep::proto::RequestMessage, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::dsnet::signedunrep::proto::RequestMessage, _impl_.req_),
+  0,
+  PROTOBUF_FIELD_OFFSET(::dsnet::signedunrep::proto::UnloggedRequestMessage, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::signedunrep::proto::UnloggedRequestMessage, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::dsnet::signedunrep::proto::UnloggedRequestMessage, _impl_.req_),
+  0,
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::dsnet::signedunrep::proto::ToReplicaMessage, _internal_metadata_),
+  ~0u,  // no _extensions_
+  PROTOBUF_FIELD_OFFSET(::dsnet::signedunrep::proto::ToReplicaMessage, _impl_._oneof_case_[0]),
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  PROTOBUF_FIELD_OFFSET(::dsnet::signedunrep::proto::ToReplicaMessage, _impl_.msg_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::signedunrep::proto::ReplyMessage, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::signedunrep::proto::ReplyMessage, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::dsnet::signedunrep::proto::ReplyMessage, _impl_.view_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::signedunrep::proto::ReplyMessage, _impl_.opnum_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::signedunrep::proto::ReplyMessage, _impl_.req_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::signedunrep::proto::ReplyMessage, _impl_.reply_),
+  2,
+  3,
+  1,
+  0,
+  PROTOBUF_FIELD_OFFSET(::dsnet::signedunrep::proto::UnloggedReplyMessage, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::signedunrep::proto::UnloggedReplyMessage, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::dsnet::signedunrep::proto::UnloggedReplyMessage, _impl_.reply_),
+  0,
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::dsnet::signedunrep::proto::ToClientMessage, _internal_metadata_),
+  ~0u,  // no _extensions_
+  PROTOBUF_FIELD_OFFSET(::dsnet::signedunrep::proto::ToClientMessage, _impl_._oneof_case_[0]),
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  PROTOBUF_FIELD_OFFSET(::dsnet::signedunrep::proto::ToClientMessage, _impl_.msg_),
+};
+static const ::_pbi::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  { 0, 7, -1, sizeof(::dsnet::signedunrep::proto::RequestMessage)},
+  { 8, 15, -1, sizeof(::dsnet::signedunrep::proto::UnloggedRequestMessage)},
+  { 16, -1, -1, sizeof(::dsnet::signedunrep::proto::ToReplicaMessage)},
+  { 25, 35, -1, sizeof(::dsnet::signedunrep::proto::ReplyMessage)},
+  { 39, 46, -1, sizeof(::dsnet::signedunrep::proto::UnloggedReplyMessage)},
+  { 47, -1, -1, sizeof(::dsnet::signedunrep::proto::ToClientMessage)},
+};
+
+static const ::_pb::Message* const file_default_instances[] = {
+  &::dsnet::signedunrep::proto::_RequestMessage_default_instance_._instance,
+  &::dsnet::signedunrep::proto::_UnloggedRequestMessage_default_instance_._instance,
+  &::dsnet::signedunrep::proto::_ToReplicaMessage_default_instance_._instance,
+  &::dsnet::signedunrep::proto::_ReplyMessage_default_instance_._instance,
+  &::dsnet::signedunrep::proto::_UnloggedReplyMessage_default_instance_._instance,
+  &::dsnet::signedunrep::proto::_ToClientMessage_default_instance_._instance,
+};
+
+const char descriptor_table_protodef_replication_2fsignedunrep_2fsignedunrep_2dproto_2eproto[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) =
+  "\n/replication/signedunrep/signedunrep-pr"
+  "oto.proto\022\027dsnet.signedunrep.proto\032\024comm"
+  "on/request.proto\"-\n\016RequestMessage\022\033\n\003re"
+  "q\030\001 \002(\0132\016.dsnet.Request\"=\n\026UnloggedReque"
+  "stMessage\022#\n\003req\030\001 \002(\0132\026.dsnet.UnloggedR"
+  "equest\"\242\001\n\020ToReplicaMessage\022:\n\007request\030\001"
+  " \001(\0132\'.dsnet.signedunrep.proto.RequestMe"
+  "ssageH\000\022K\n\020unlogged_request\030\002 \001(\0132/.dsne"
+  "t.signedunrep.proto.UnloggedRequestMessa"
+  "geH\000B\005\n\003msg\"W\n\014ReplyMessage\022\014\n\004view\030\001 \001("
+  "\004\022\r\n\005opnum\030\002 \001(\004\022\033\n\003req\030\003 \002(\0132\016.dsnet.Re"
+  "quest\022\r\n\005reply\030\004 \002(\014\"%\n\024UnloggedReplyMes"
+  "sage\022\r\n\005reply\030\001 \002(\014\"\231\001\n\017ToClientMessage\022"
+  "6\n\005reply\030\001 \001(\0132%.dsnet.signedunrep.proto"
+  ".ReplyMessageH\000\022G\n\016unlogged_reply\030\002 \001(\0132"
+  "-.dsnet.signedunrep.proto.UnloggedReplyM"
+  "essageH\000B\005\n\003msg"
+  ;
+static const ::_pbi::DescriptorTable* const descriptor_table_replication_2fsignedunrep_2fsignedunrep_2dproto_2eproto_deps[1] = {
+  &::descriptor_table_common_2frequest_2eproto,
+};
+static ::_pbi::once_flag descriptor_table_replication_2fsignedunrep_2fsignedunrep_2dproto_2eproto_once;
+const ::_pbi::DescriptorTable descriptor_table_replication_2fsignedunrep_2fsignedunrep_2dproto_2eproto = {
+    false, false, 655, descriptor_table_protodef_replication_2fsignedunrep_2fsignedunrep_2dproto_2eproto,
+    "replication/signedunrep/signedunrep-proto.proto",
+    &descriptor_table_replication_2fsignedunrep_2fsignedunrep_2dproto_2eproto_once, descriptor_table_replication_2fsignedunrep_2fsignedunrep_2dproto_2eproto_deps, 1, 6,
+    schemas, file_default_instances, TableStruct_replication_2fsignedunrep_2fsignedunrep_2dproto_2eproto::offsets,
+    file_level_metadata_replication_2fsignedunrep_2fsignedunrep_2dproto_2eproto, file_level_enum_descriptors_replication_2fsignedunrep_2fsignedunrep_2dproto_2eproto,
+    file_level_service_descriptors_replication_2fsignedunrep_2fsignedunrep_2dproto_2eproto,
+};
+PROTOBUF_ATTRIBUTE_WEAK const ::_pbi::DescriptorTable* descriptor_table_replication_2fsignedunrep_2fsignedunrep_2dproto_2eproto_getter() {
+  return &descriptor_table_replication_2fsignedunrep_2fsignedunrep_2dproto_2eproto;
+}
+
+// Force running AddDescriptors() at dynamic initialization time.
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 static ::_pbi::AddDescriptorsRunner dynamic_init_dummy_replication_2fsignedunrep_2fsignedunrep_2dproto_2eproto(&descriptor_table_replication_2fsignedunrep_2fsignedunrep_2dproto_2eproto);
+namespace dsnet {
+namespace signedunrep {
+namespace proto {
+
+// ===================================================================
+
+class RequestMessage::_Internal {
+ public:
+  using HasBits = decltype(std::declval<RequestMessage>()._impl_._has_bits_);
+  static const ::dsnet::Request& req(const RequestMessage* msg);
+  static void set_has_req(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000001) ^ 0x00000001) != 0;
+  }
+};
+
+const ::dsnet::Request&
+RequestMessage::_Internal::req(const RequestMessage* msg) {
+  return *msg->_impl_.req_;
+}
+void RequestMessage::clear_req() {
+  if (_impl_.req_ != nullptr) _impl_.req_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+RequestMessage::RequestMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:dsnet.signedunrep.proto.RequestMessage)
+}
+RequestMessage::RequestMessage(const RequestMessage& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  RequestMessage* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.req_){nullptr}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  if (from._internal_has_req()) {
+    _this->_impl_.req_ = new ::dsnet::Request(*from._impl_.req_);
+  }
+  // @@protoc_insertion_point(copy_constructor:dsnet.signedunrep.proto.RequestMessage)
+}
+
+inline void RequestMessage::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.req_){nullptr}
+  };
+}
+
+RequestMessage::~RequestMessage() {
+  // @@protoc_insertion_point(destructor:dsnet.signedunrep.proto.RequestMessage)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void RequestMessage::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  if (this != internal_default_instance()) delete _impl_.req_;
+}
+
+void RequestMessage::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void RequestMessage::Clear() {
+// @@protoc_insertion_point(message_clear_start:dsnet.signedunrep.proto.RequestMessage)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    GOOGLE_DCHECK(_impl_.req_ != nullptr);
+    _impl_.req_->Clear();
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* RequestMessage::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required .dsnet.Request req = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr = ctx->ParseMessage(_internal_mutable_req(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* RequestMessage::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:dsnet.signedunrep.proto.RequestMessage)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required .dsnet.Request req = 1;
+  if (cached_has_bits & 0x00000001u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(1, _Internal::req(this),
+        _Internal::req(this).GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:dsnet.signedunrep.proto.RequestMessage)
+  return target;
+}
+
+size_t RequestMessage::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:dsnet.signedunrep.proto.RequestMessage)
+  size_t total_size = 0;
+
+  // required .dsnet.Request req = 1;
+  if (_internal_has_req()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.req_);
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData RequestMessage::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    RequestMessage::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*RequestMessage::GetClassData() const { return &_class_data_; }
+
+
+void RequestMessage::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<RequestMessage*>(&to_msg);
+  auto& from = static_cast<const RequestMessage&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:dsnet.signedunrep.proto.RequestMessage)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_has_req()) {
+    _this->_internal_mutable_req()->::dsnet::Request::MergeFrom(
+        from._internal_req());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void RequestMessage::CopyFrom(const RequestMessage& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:dsnet.signedunrep.proto.RequestMessage)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool RequestMessage::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  if (_internal_has_req()) {
+    if (!_impl_.req_->IsInitialized()) return false;
+  }
+  return true;
+}
+
+void RequestMessage::InternalSwap(RequestMessage* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  swap(_impl_.req_, other->_impl_.req_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata RequestMessage::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_replication_2fsignedunrep_2fsignedunrep_2dproto_2eproto_getter, &descriptor_table_replication_2fsignedunrep_2fsignedunrep_2dproto_2eproto_once,
+      file_level_metadata_replication_2fsignedunrep_2fsignedunrep_2dproto_2eproto[0]);
+}
+
+// ===================================================================
+
+class UnloggedRequestMessage::_Internal {
+ public:
+  using HasBits = decltype(std::declval<UnloggedRequestMessage>()._impl_._has_bits_);
+  static const ::dsnet::UnloggedRequest& req(const UnloggedRequestMessage* msg);
+  static void set_has_req(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000001) ^ 0x00000001) != 0;
+  }
+};
+
+const ::dsnet::UnloggedRequest&
+UnloggedRequestMessage::_Internal::req(const UnloggedRequestMessage* msg) {
+  return *msg->_impl_.req_;
+}
+void UnloggedRequestMessage::clear_req() {
+  if (_impl_.req_ != nullptr) _impl_.req_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+UnloggedRequestMessage::UnloggedRequestMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:dsnet.signedunrep.proto.UnloggedRequestMessage)
+}
+UnloggedRequestMessage::UnloggedRequestMessage(const UnloggedRequestMessage& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  UnloggedRequestMessage* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.req_){nullptr}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  if (from._internal_has_req()) {
+    _this->_impl_.req_ = new ::dsnet::UnloggedRequest(*from._impl_.req_);
+  }
+  // @@protoc_insertion_point(copy_constructor:dsnet.signedunrep.proto.UnloggedRequestMessage)
+}
+
+inline void UnloggedRequestMessage::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.req_){nullptr}
+  };
+}
+
+UnloggedRequestMessage::~UnloggedRequestMessage() {
+  // @@protoc_insertion_point(destructor:dsnet.signedunrep.proto.UnloggedRequestMessage)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void UnloggedRequestMessage::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  if (this != internal_default_instance()) delete _impl_.req_;
+}
+
+void UnloggedRequestMessage::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void UnloggedRequestMessage::Clear() {
+// @@protoc_insertion_point(message_clear_start:dsnet.signedunrep.proto.UnloggedRequestMessage)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    GOOGLE_DCHECK(_impl_.req_ != nullptr);
+    _impl_.req_->Clear();
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* UnloggedRequestMessage::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required .dsnet.UnloggedRequest req = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr = ctx->ParseMessage(_internal_mutable_req(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* UnloggedRequestMessage::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:dsnet.signedunrep.proto.UnloggedRequestMessage)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required .dsnet.UnloggedRequest req = 1;
+  if (cached_has_bits & 0x00000001u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(1, _Internal::req(this),
+        _Internal::req(this).GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:dsnet.signedunrep.proto.UnloggedRequestMessage)
+  return target;
+}
+
+size_t UnloggedRequestMessage::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:dsnet.signedunrep.proto.UnloggedRequestMessage)
+  size_t total_size = 0;
+
+  // required .dsnet.UnloggedRequest req = 1;
+  if (_internal_has_req()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.req_);
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData UnloggedRequestMessage::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    UnloggedRequestMessage::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*UnloggedRequestMessage::GetClassData() const { return &_class_data_; }
+
+
+void UnloggedRequestMessage::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<UnloggedRequestMessage*>(&to_msg);
+  auto& from = static_cast<const UnloggedRequestMessage&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:dsnet.signedunrep.proto.UnloggedRequestMessage)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_has_req()) {
+    _this->_internal_mutable_req()->::dsnet::UnloggedRequest::MergeFrom(
+        from._internal_req());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void UnloggedRequestMessage::CopyFrom(const UnloggedRequestMessage& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:dsnet.signedunrep.proto.UnloggedRequestMessage)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool UnloggedRequestMessage::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  if (_internal_has_req()) {
+    if (!_impl_.req_->IsInitialized()) return false;
+  }
+  return true;
+}
+
+void UnloggedRequestMessage::InternalSwap(UnloggedRequestMessage* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  swap(_impl_.req_, other->_impl_.req_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata UnloggedRequestMessage::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_replication_2fsignedunrep_2fsignedunrep_2dproto_2eproto_getter, &descriptor_table_replication_2fsignedunrep_2fsignedunrep_2dproto_2eproto_once,
+      file_level_metadata_replication_2fsignedunrep_2fsignedunrep_2dproto_2eproto[1]);
+}
+
+// ===================================================================
+
+class ToReplicaMessage::_Internal {
+ public:
+  static const ::dsnet::signedunrep::proto::RequestMessage& request(const ToReplicaMessage* msg);
+  static const ::dsnet::signedunrep::proto::UnloggedRequestMessage& unlogged_request(const ToReplicaMessage* msg);
+};
+
+const ::dsnet::signedunrep::proto::RequestMessage&
+ToReplicaMessage::_Internal::request(const ToReplicaMessage* msg) {
+  return *msg->_impl_.msg_.request_;
+}
+const ::dsnet::signedunrep::proto::UnloggedRequestMessage&
+ToReplicaMessage::_Internal::unlogged_request(const ToReplicaMessage* msg) {
+  return *msg->_impl_.msg_.unlogged_request_;
+}
+void ToReplicaMessage::set_allocated_request(::dsnet::signedunrep::proto::RequestMessage* request) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  clear_msg();
+  if (request) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(request);
+    if (message_arena != submessage_arena) {
+      request = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, request, submessage_arena);
+    }
+    set_has_request();
+    _impl_.msg_.request_ = request;
+  }
+  // @@protoc_insertion_point(field_set_allocated:dsnet.signedunrep.proto.ToReplicaMessage.request)
+}
+void ToReplicaMessage::set_allocated_unlogged_request(::dsnet::signedunrep::proto::UnloggedRequestMessage* unlogged_request) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  clear_msg();
+  if (unlogged_request) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(unlogged_request);
+    if (message_arena != submessage_arena) {
+      unlogged_request = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, unlogged_request, submessage_arena);
+    }
+    set_has_unlogged_request();
+    _impl_.msg_.unlogged_request_ = unlogged_request;
+  }
+  // @@protoc_insertion_point(field_set_allocated:dsnet.signedunrep.proto.ToReplicaMessage.unlogged_request)
+}
+ToReplicaMessage::ToReplicaMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:dsnet.signedunrep.proto.ToReplicaMessage)
+}
+ToReplicaMessage::ToReplicaMessage(const ToReplicaMessage& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  ToReplicaMessage* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.msg_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , /*decltype(_impl_._oneof_case_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  clear_has_msg();
+  switch (from.msg_case()) {
+    case kRequest: {
+      _this->_internal_mutable_request()->::dsnet::signedunrep::proto::RequestMessage::MergeFrom(
+          from._internal_request());
+      break;
+    }
+    case kUnloggedRequest: {
+      _this->_internal_mutable_unlogged_request()->::dsnet::signedunrep::proto::UnloggedRequestMessage::MergeFrom(
+          from._internal_unlogged_request());
+      break;
+    }
+    case MSG_NOT_SET: {
+      break;
+    }
+  }
+  // @@protoc_insertion_point(copy_constructor:dsnet.signedunrep.proto.ToReplicaMessage)
+}
+
+inline void ToReplicaMessage::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.msg_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , /*decltype(_impl_._oneof_case_)*/{}
+  };
+  clear_has_msg();
+}
+
+ToReplicaMessage::~ToReplicaMessage() {
+  // @@protoc_insertion_point(destructor:dsnet.signedunrep.proto.ToReplicaMessage)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void ToReplicaMessage::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  if (has_msg()) {
+    clear_msg();
+  }
+}
+
+void ToReplicaMessage::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void ToReplicaMessage::clear_msg() {
+// @@protoc_insertion_point(one_of_clear_start:dsnet.signedunrep.proto.ToReplicaMessage)
+  switch (msg_case()) {
+    case kRequest: {
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.msg_.request_;
+      }
+      break;
+    }
+    case kUnloggedRequest: {
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.msg_.unlogged_request_;
+      }
+      break;
+    }
+    case MSG_NOT_SET: {
+      break;
+    }
+  }
+  _impl_._oneof_case_[0] = MSG_NOT_SET;
+}
+
+
+void ToReplicaMessage::Clear() {
+// @@protoc_insertion_point(message_clear_start:dsnet.signedunrep.proto.ToReplicaMessage)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  clear_msg();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* ToReplicaMessage::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // .dsnet.signedunrep.proto.RequestMessage request = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr = ctx->ParseMessage(_internal_mutable_request(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .dsnet.signedunrep.proto.UnloggedRequestMessage unlogged_request = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr = ctx->ParseMessage(_internal_mutable_unlogged_request(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* ToReplicaMessage::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:dsnet.signedunrep.proto.ToReplicaMessage)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  switch (msg_case()) {
+    case kRequest: {
+      target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(1, _Internal::request(this),
+          _Internal::request(this).GetCachedSize(), target, stream);
+      break;
+    }
+    case kUnloggedRequest: {
+      target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(2, _Internal::unlogged_request(this),
+          _Internal::unlogged_request(this).GetCachedSize(), target, stream);
+      break;
+    }
+    default: ;
+  }
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:dsnet.signedunrep.proto.ToReplicaMessage)
+  return target;
+}
+
+size_t ToReplicaMessage::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:dsnet.signedunrep.proto.ToReplicaMessage)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  switch (msg_case()) {
+    // .dsnet.signedunrep.proto.RequestMessage request = 1;
+    case kRequest: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.msg_.request_);
+      break;
+    }
+    // .dsnet.signedunrep.proto.UnloggedRequestMessage unlogged_request = 2;
+    case kUnloggedRequest: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.msg_.unlogged_request_);
+      break;
+    }
+    case MSG_NOT_SET: {
+      break;
+    }
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ToReplicaMessage::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    ToReplicaMessage::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ToReplicaMessage::GetClassData() const { return &_class_data_; }
+
+
+void ToReplicaMessage::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<ToReplicaMessage*>(&to_msg);
+  auto& from = static_cast<const ToReplicaMessage&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:dsnet.signedunrep.proto.ToReplicaMessage)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  switch (from.msg_case()) {
+    case kRequest: {
+      _this->_internal_mutable_request()->::dsnet::signedunrep::proto::RequestMessage::MergeFrom(
+          from._internal_request());
+      break;
+    }
+    case kUnloggedRequest: {
+      _this->_internal_mutable_unlogged_request()->::dsnet::signedunrep::proto::UnloggedRequestMessage::MergeFrom(
+          from._internal_unlogged_request());
+      break;
+    }
+    case MSG_NOT_SET: {
+      break;
+    }
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void ToReplicaMessage::CopyFrom(const ToReplicaMessage& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:dsnet.signedunrep.proto.ToReplicaMessage)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool ToReplicaMessage::IsInitialized() const {
+  switch (msg_case()) {
+    case kRequest: {
+      if (_internal_has_request()) {
+        if (!_impl_.msg_.request_->IsInitialized()) return false;
+      }
+      break;
+    }
+    case kUnloggedRequest: {
+      if (_internal_has_unlogged_request()) {
+        if (!_impl_.msg_.unlogged_request_->IsInitialized()) return false;
+      }
+      break;
+    }
+    case MSG_NOT_SET: {
+      break;
+    }
+  }
+  return true;
+}
+
+void ToReplicaMessage::InternalSwap(ToReplicaMessage* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_.msg_, other->_impl_.msg_);
+  swap(_impl_._oneof_case_[0], other->_impl_._oneof_case_[0]);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata ToReplicaMessage::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_replication_2fsignedunrep_2fsignedunrep_2dproto_2eproto_getter, &descriptor_table_replication_2fsignedunrep_2fsignedunrep_2dproto_2eproto_once,
+      file_level_metadata_replication_2fsignedunrep_2fsignedunrep_2dproto_2eproto[2]);
+}
+
+// ===================================================================
+
+class ReplyMessage::_Internal {
+ public:
+  using HasBits = decltype(std::declval<ReplyMessage>()._impl_._has_bits_);
+  static void set_has_view(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static void set_has_opnum(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+  static const ::dsnet::Request& req(const ReplyMessage* msg);
+  static void set_has_req(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_reply(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000003) ^ 0x00000003) != 0;
+  }
+};
+
+const ::dsnet::Request&
+ReplyMessage::_Internal::req(const ReplyMessage* msg) {
+  return *msg->_impl_.req_;
+}
+void ReplyMessage::clear_req() {
+  if (_impl_.req_ != nullptr) _impl_.req_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+ReplyMessage::ReplyMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:dsnet.signedunrep.proto.ReplyMessage)
+}
+ReplyMessage::ReplyMessage(const ReplyMessage& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  ReplyMessage* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.reply_){}
+    , decltype(_impl_.req_){nullptr}
+    , decltype(_impl_.view_){}
+    , decltype(_impl_.opnum_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.reply_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.reply_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_reply()) {
+    _this->_impl_.reply_.Set(from._internal_reply(), 
+      _this->GetArenaForAllocation());
+  }
+  if (from._internal_has_req()) {
+    _this->_impl_.req_ = new ::dsnet::Request(*from._impl_.req_);
+  }
+  ::memcpy(&_impl_.view_, &from._impl_.view_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.opnum_) -
+    reinterpret_cast<char*>(&_impl_.view_)) + sizeof(_impl_.opnum_));
+  // @@protoc_insertion_point(copy_constructor:dsnet.signedunrep.proto.ReplyMessage)
+}
+
+inline void ReplyMessage::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.reply_){}
+    , decltype(_impl_.req_){nullptr}
+    , decltype(_impl_.view_){uint64_t{0u}}
+    , decltype(_impl_.opnum_){uint64_t{0u}}
+  };
+  _impl_.reply_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.reply_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+ReplyMessage::~ReplyMessage() {
+  // @@protoc_insertion_point(destructor:dsnet.signedunrep.proto.ReplyMessage)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void ReplyMessage::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.reply_.Destroy();
+  if (this != internal_default_instance()) delete _impl_.req_;
+}
+
+void ReplyMessage::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void ReplyMessage::Clear() {
+// @@protoc_insertion_point(message_clear_start:dsnet.signedunrep.proto.ReplyMessage)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      _impl_.reply_.ClearNonDefaultToEmpty();
+    }
+    if (cached_has_bits & 0x00000002u) {
+      GOOGLE_DCHECK(_impl_.req_ != nullptr);
+      _impl_.req_->Clear();
+    }
+  }
+  if (cached_has_bits & 0x0000000cu) {
+    ::memset(&_impl_.view_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.opnum_) -
+        reinterpret_cast<char*>(&_impl_.view_)) + sizeof(_impl_.opnum_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* ReplyMessage::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // optional uint64 view = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_view(&has_bits);
+          _impl_.view_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint64 opnum = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _Internal::set_has_opnum(&has_bits);
+          _impl_.opnum_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required .dsnet.Request req = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          ptr = ctx->ParseMessage(_internal_mutable_req(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required bytes reply = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          auto str = _internal_mutable_reply();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* ReplyMessage::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:dsnet.signedunrep.proto.ReplyMessage)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional uint64 view = 1;
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(1, this->_internal_view(), target);
+  }
+
+  // optional uint64 opnum = 2;
+  if (cached_has_bits & 0x00000008u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(2, this->_internal_opnum(), target);
+  }
+
+  // required .dsnet.Request req = 3;
+  if (cached_has_bits & 0x00000002u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(3, _Internal::req(this),
+        _Internal::req(this).GetCachedSize(), target, stream);
+  }
+
+  // required bytes reply = 4;
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->WriteBytesMaybeAliased(
+        4, this->_internal_reply(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:dsnet.signedunrep.proto.ReplyMessage)
+  return target;
+}
+
+size_t ReplyMessage::RequiredFieldsByteSizeFallback() const {
+// @@protoc_insertion_point(required_fields_byte_size_fallback_start:dsnet.signedunrep.proto.ReplyMessage)
+  size_t total_size = 0;
+
+  if (_internal_has_reply()) {
+    // required bytes reply = 4;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_reply());
+  }
+
+  if (_internal_has_req()) {
+    // required .dsnet.Request req = 3;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.req_);
+  }
+
+  return total_size;
+}
+size_t ReplyMessage::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:dsnet.signedunrep.proto.ReplyMessage)
+  size_t total_size = 0;
+
+  if (((_impl_._has_bits_[0] & 0x00000003) ^ 0x00000003) == 0) {  // All required fields are present.
+    // required bytes reply = 4;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_reply());
+
+    // required .dsnet.Request req = 3;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.req_);
+
+  } else {
+    total_size += RequiredFieldsByteSizeFallback();
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000000cu) {
+    // optional uint64 view = 1;
+    if (cached_has_bits & 0x00000004u) {
+      total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_view());
+    }
+
+    // optional uint64 opnum = 2;
+    if (cached_has_bits & 0x00000008u) {
+      total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_opnum());
+    }
+
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ReplyMessage::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    ReplyMessage::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ReplyMessage::GetClassData() const { return &_class_data_; }
+
+
+void ReplyMessage::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<ReplyMessage*>(&to_msg);
+  auto& from = static_cast<const ReplyMessage&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:dsnet.signedunrep.proto.ReplyMessage)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000000fu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_reply(from._internal_reply());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_internal_mutable_req()->::dsnet::Request::MergeFrom(
+          from._internal_req());
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.view_ = from._impl_.view_;
+    }
+    if (cached_has_bits & 0x00000008u) {
+      _this->_impl_.opnum_ = from._impl_.opnum_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void ReplyMessage::CopyFrom(const ReplyMessage& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:dsnet.signedunrep.proto.ReplyMessage)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool ReplyMessage::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  if (_internal_has_req()) {
+    if (!_impl_.req_->IsInitialized()) return false;
+  }
+  return true;
+}
+
+void ReplyMessage::InternalSwap(ReplyMessage* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.reply_, lhs_arena,
+      &other->_impl_.reply_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(ReplyMessage, _impl_.opnum_)
+      + sizeof(ReplyMessage::_impl_.opnum_)
+      - PROTOBUF_FIELD_OFFSET(ReplyMessage, _impl_.req_)>(
+          reinterpret_cast<char*>(&_impl_.req_),
+          reinterpret_cast<char*>(&other->_impl_.req_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata ReplyMessage::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_replication_2fsignedunrep_2fsignedunrep_2dproto_2eproto_getter, &descriptor_table_replication_2fsignedunrep_2fsignedunrep_2dproto_2eproto_once,
+      file_level_metadata_replication_2fsignedunrep_2fsignedunrep_2dproto_2eproto[3]);
+}
+
+// ===================================================================
+
+class UnloggedReplyMessage::_Internal {
+ public:
+  using HasBits = decltype(std::declval<UnloggedReplyMessage>()._impl_._has_bits_);
+  static void set_has_reply(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000001) ^ 0x00000001) != 0;
+  }
+};
+
+UnloggedReplyMessage::UnloggedReplyMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:dsnet.signedunrep.proto.UnloggedReplyMessage)
+}
+UnloggedReplyMessage::UnloggedReplyMessage(const UnloggedReplyMessage& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  UnloggedReplyMessage* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.reply_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.reply_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.reply_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_reply()) {
+    _this->_impl_.reply_.Set(from._internal_reply(), 
+      _this->GetArenaForAllocation());
+  }
+  // @@protoc_insertion_point(copy_constructor:dsnet.signedunrep.proto.UnloggedReplyMessage)
+}
+
+inline void UnloggedReplyMessage::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.reply_){}
+  };
+  _impl_.reply_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.reply_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+UnloggedReplyMessage::~UnloggedReplyMessage() {
+  // @@protoc_insertion_point(destructor:dsnet.signedunrep.proto.UnloggedReplyMessage)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void UnloggedReplyMessage::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.reply_.Destroy();
+}
+
+void UnloggedReplyMessage::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void UnloggedReplyMessage::Clear() {
+// @@protoc_insertion_point(message_clear_start:dsnet.signedunrep.proto.UnloggedReplyMessage)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    _impl_.reply_.ClearNonDefaultToEmpty();
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* UnloggedReplyMessage::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required bytes reply = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_reply();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* UnloggedReplyMessage::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:dsnet.signedunrep.proto.UnloggedReplyMessage)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required bytes reply = 1;
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->WriteBytesMaybeAliased(
+        1, this->_internal_reply(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:dsnet.signedunrep.proto.UnloggedReplyMessage)
+  return target;
+}
+
+size_t UnloggedReplyMessage::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:dsnet.signedunrep.proto.UnloggedReplyMessage)
+  size_t total_size = 0;
+
+  // required bytes reply = 1;
+  if (_internal_has_reply()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_reply());
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData UnloggedReplyMessage::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    UnloggedReplyMessage::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*UnloggedReplyMessage::GetClassData() const { return &_class_data_; }
+
+
+void UnloggedReplyMessage::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<UnloggedReplyMessage*>(&to_msg);
+  auto& from = static_cast<const UnloggedReplyMessage&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:dsnet.signedunrep.proto.UnloggedReplyMessage)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_has_reply()) {
+    _this->_internal_set_reply(from._internal_reply());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void UnloggedReplyMessage::CopyFrom(const UnloggedReplyMessage& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:dsnet.signedunrep.proto.UnloggedReplyMessage)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool UnloggedReplyMessage::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  return true;
+}
+
+void UnloggedReplyMessage::InternalSwap(UnloggedReplyMessage* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.reply_, lhs_arena,
+      &other->_impl_.reply_, rhs_arena
+  );
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata UnloggedReplyMessage::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_replication_2fsignedunrep_2fsignedunrep_2dproto_2eproto_getter, &descriptor_table_replication_2fsignedunrep_2fsignedunrep_2dproto_2eproto_once,
+      file_level_metadata_replication_2fsignedunrep_2fsignedunrep_2dproto_2eproto[4]);
+}
+
+// ===================================================================
+
+class ToClientMessage::_Internal {
+ public:
+  static const ::dsnet::signedunrep::proto::ReplyMessage& reply(const ToClientMessage* msg);
+  static const ::dsnet::signedunrep::proto::UnloggedReplyMessage& unlogged_reply(const ToClientMessage* msg);
+};
+
+const ::dsnet::signedunrep::proto::ReplyMessage&
+ToClientMessage::_Internal::reply(const ToClientMessage* msg) {
+  return *msg->_impl_.msg_.reply_;
+}
+const ::dsnet::signedunrep::proto::UnloggedReplyMessage&
+ToClientMessage::_Internal::unlogged_reply(const ToClientMessage* msg) {
+  return *msg->_impl_.msg_.unlogged_reply_;
+}
+void ToClientMessage::set_allocated_reply(::dsnet::signedunrep::proto::ReplyMessage* reply) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  clear_msg();
+  if (reply) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(reply);
+    if (message_arena != submessage_arena) {
+      reply = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, reply, submessage_arena);
+    }
+    set_has_reply();
+    _impl_.msg_.reply_ = reply;
+  }
+  // @@protoc_insertion_point(field_set_allocated:dsnet.signedunrep.proto.ToClientMessage.reply)
+}
+void ToClientMessage::set_allocated_unlogged_reply(::dsnet::signedunrep::proto::UnloggedReplyMessage* unlogged_reply) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  clear_msg();
+  if (unlogged_reply) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(unlogged_reply);
+    if (message_arena != submessage_arena) {
+      unlogged_reply = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, unlogged_reply, submessage_arena);
+    }
+    set_has_unlogged_reply();
+    _impl_.msg_.unlogged_reply_ = unlogged_reply;
+  }
+  // @@protoc_insertion_point(field_set_allocated:dsnet.signedunrep.proto.ToClientMessage.unlogged_reply)
+}
+ToClientMessage::ToClientMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:dsnet.signedunrep.proto.ToClientMessage)
+}
+ToClientMessage::ToClientMessage(const ToClientMessage& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  ToClientMessage* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.msg_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , /*decltype(_impl_._oneof_case_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  clear_has_msg();
+  switch (from.msg_case()) {
+    case kReply: {
+      _this->_internal_mutable_reply()->::dsnet::signedunrep::proto::ReplyMessage::MergeFrom(
+          from._internal_reply());
+      break;
+    }
+    case kUnloggedReply: {
+      _this->_internal_mutable_unlogged_reply()->::dsnet::signedunrep::proto::UnloggedReplyMessage::MergeFrom(
+          from._internal_unlogged_reply());
+      break;
+    }
+    case MSG_NOT_SET: {
+      break;
+    }
+  }
+  // @@protoc_insertion_point(copy_constructor:dsnet.signedunrep.proto.ToClientMessage)
+}
+
+inline void ToClientMessage::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.msg_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , /*decltype(_impl_._oneof_case_)*/{}
+  };
+  clear_has_msg();
+}
+
+ToClientMessage::~ToClientMessage() {
+  // @@protoc_insertion_point(destructor:dsnet.signedunrep.proto.ToClientMessage)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void ToClientMessage::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  if (has_msg()) {
+    clear_msg();
+  }
+}
+
+void ToClientMessage::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void ToClientMessage::clear_msg() {
+// @@protoc_insertion_point(one_of_clear_start:dsnet.signedunrep.proto.ToClientMessage)
+  switch (msg_case()) {
+    case kReply: {
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.msg_.reply_;
+      }
+      break;
+    }
+    case kUnloggedReply: {
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.msg_.unlogged_reply_;
+      }
+      break;
+    }
+    case MSG_NOT_SET: {
+      break;
+    }
+  }
+  _impl_._oneof_case_[0] = MSG_NOT_SET;
+}
+
+
+void ToClientMessage::Clear() {
+// @@protoc_insertion_point(message_clear_start:dsnet.signedunrep.proto.ToClientMessage)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  clear_msg();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* ToClientMessage::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // .dsnet.signedunrep.proto.ReplyMessage reply = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr = ctx->ParseMessage(_internal_mutable_reply(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .dsnet.signedunrep.proto.UnloggedReplyMessage unlogged_reply = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr = ctx->ParseMessage(_internal_mutable_unlogged_reply(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* ToClientMessage::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:dsnet.signedunrep.proto.ToClientMessage)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  switch (msg_case()) {
+    case kReply: {
+      target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(1, _Internal::reply(this),
+          _Internal::reply(this).GetCachedSize(), target, stream);
+      break;
+    }
+    case kUnloggedReply: {
+      target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(2, _Internal::unlogged_reply(this),
+          _Internal::unlogged_reply(this).GetCachedSize(), target, stream);
+      break;
+    }
+    default: ;
+  }
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:dsnet.signedunrep.proto.ToClientMessage)
+  return target;
+}
+
+size_t ToClientMessage::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:dsnet.signedunrep.proto.ToClientMessage)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  switch (msg_case()) {
+    // .dsnet.signedunrep.proto.ReplyMessage reply = 1;
+    case kReply: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.msg_.reply_);
+      break;
+    }
+    // .dsnet.signedunrep.proto.UnloggedReplyMessage unlogged_reply = 2;
+    case kUnloggedReply: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.msg_.unlogged_reply_);
+      break;
+    }
+    case MSG_NOT_SET: {
+      break;
+    }
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ToClientMessage::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    ToClientMessage::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ToClientMessage::GetClassData() const { return &_class_data_; }
+
+
+void ToClientMessage::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<ToClientMessage*>(&to_msg);
+  auto& from = static_cast<const ToClientMessage&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:dsnet.signedunrep.proto.ToClientMessage)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  switch (from.msg_case()) {
+    case kReply: {
+      _this->_internal_mutable_reply()->::dsnet::signedunrep::proto::ReplyMessage::MergeFrom(
+          from._internal_reply());
+      break;
+    }
+    case kUnloggedReply: {
+      _this->_internal_mutable_unlogged_reply()->::dsnet::signedunrep::proto::UnloggedReplyMessage::MergeFrom(
+          from._internal_unlogged_reply());
+      break;
+    }
+    case MSG_NOT_SET: {
+      break;
+    }
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void ToClientMessage::CopyFrom(const ToClientMessage& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:dsnet.signedunrep.proto.ToClientMessage)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool ToClientMessage::IsInitialized() const {
+  switch (msg_case()) {
+    case kReply: {
+      if (_internal_has_reply()) {
+        if (!_impl_.msg_.reply_->IsInitialized()) return false;
+      }
+      break;
+    }
+    case kUnloggedReply: {
+      if (_internal_has_unlogged_reply()) {
+        if (!_impl_.msg_.unlogged_reply_->IsInitialized()) return false;
+      }
+      break;
+    }
+    case MSG_NOT_SET: {
+      break;
+    }
+  }
+  return true;
+}
+
+void ToClientMessage::InternalSwap(ToClientMessage* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_.msg_, other->_impl_.msg_);
+  swap(_impl_._oneof_case_[0], other->_impl_._oneof_case_[0]);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata ToClientMessage::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_replication_2fsignedunrep_2fsignedunrep_2dproto_2eproto_getter, &descriptor_table_replication_2fsignedunrep_2fsignedunrep_2dproto_2eproto_once,
+      file_level_metadata_replication_2fsignedunrep_2fsignedunrep_2dproto_2eproto[5]);
+}
+
+// @@protoc_insertion_point(namespace_scope)
+}  // namespace proto
+}  // namespace signedunrep
+}  // namespace dsnet
+PROTOBUF_NAMESPACE_OPEN
+template<> PROTOBUF_NOINLINE ::dsnet::signedunrep::proto::RequestMessage*
+Arena::CreateMaybeMessage< ::dsnet::signedunrep::proto::RequestMessage >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::dsnet::signedunrep::proto::RequestMessage >(arena);
+}
+template<> PROTOBUF_NOINLINE ::dsnet::signedunrep::proto::UnloggedRequestMessage*
+Arena::CreateMaybeMessage< ::dsnet::signedunrep::proto::UnloggedRequestMessage >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::dsnet::signedunrep::proto::UnloggedRequestMessage >(arena);
+}
+template<> PROTOBUF_NOINLINE ::dsnet::signedunrep::proto::ToReplicaMessage*
+Arena::CreateMaybeMessage< ::dsnet::signedunrep::proto::ToReplicaMessage >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::dsnet::signedunrep::proto::ToReplicaMessage >(arena);
+}
+template<> PROTOBUF_NOINLINE ::dsnet::signedunrep::proto::ReplyMessage*
+Arena::CreateMaybeMessage< ::dsnet::signedunrep::proto::ReplyMessage >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::dsnet::signedunrep::proto::ReplyMessage >(arena);
+}
+template<> PROTOBUF_NOINLINE ::dsnet::signedunrep::proto::UnloggedReplyMessage*
+Arena::CreateMaybeMessage< ::dsnet::signedunrep::proto::UnloggedReplyMessage >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::dsnet::signedunrep::proto::UnloggedReplyMessage >(arena);
+}
+template<> PROTOBUF_NOINLINE ::dsnet::signedunrep::proto::ToClientMessage*
+Arena::CreateMaybeMessage< ::dsnet::signedunrep::proto::ToClientMessage >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::dsnet::signedunrep::proto::ToClientMessage >(arena);
+}
+PROTOBUF_NAMESPACE_CLOSE
+
+// @@protoc_insertion_point(global_scope)
+#include <google/protobuf/port_undef.inc>
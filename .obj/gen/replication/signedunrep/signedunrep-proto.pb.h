@@ -0,0 +1,2024 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: replication/signedunrep/signedunrep-proto.proto
+
+#ifndef GOOGLE_PROTOBUF_INCLUDED_replication_2fsignedunrep_2fsignedunrep_2dproto_2eproto
+#define GOOGLE_PROTOBUF_INCLUDED_replication_2fsignedunrep_2fsignedunrep_2dproto_2eproto
+
+#include <limits>
+#include <string>
+
+#include <google/protobuf/port_def.inc>
+#if PROTOBUF_VERSION < 3021000
+#error This file was generated by a newer version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please update
+#error your headers.
+#endif
+#if 3021012 < PROTOBUF_MIN_PROTOC_VERSION
+#error This file was generated by an older version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please
+#error regenerate this file with a newer version of protoc.
+#endif
+
+#include <google/protobuf/port_undef.inc>
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/arena.h>
+#include <google/protobuf/arenastring.h>
+#include <google/protobuf/generated_message_util.h>
+#include <google/protobuf/metadata_lite.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/message.h>
+#include <google/protobuf/repeated_field.h>  // IWYU pragma: export
+#include <google/protobuf/extension_set.h>  // IWYU pragma: export
+#include <google/protobuf/unknown_field_set.h>
+#include "common/request.pb.h"
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+#define PROTOBUF_INTERNAL_EXPORT_replication_2fsignedunrep_2fsignedunrep_2dproto_2eproto
+PROTOBUF_NAMESPACE_OPEN
+namespace internal {
+class AnyMetadata;
+}  // namespace internal
+PROTOBUF_NAMESPACE_CLOSE
+
+// Internal implementation detail -- do not use these members.
+struct TableStruct_replication_2fsignedunrep_2fsignedunrep_2dproto_2eproto {
+  static const uint32_t offsets[];
+};
+extern const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_replication_2fsignedunrep_2fsignedunrep_2dproto_2eproto;
+namespace dsnet {
+namespace signedunrep {
+namespace proto {
+class ReplyMessage;
+struct ReplyMessageDefaultTypeInternal;
+extern ReplyMessageDefaultTypeInternal _ReplyMessage_default_instance_;
+class RequestMessage;
+struct RequestMessageDefaultTypeInternal;
+extern RequestMessageDefaultTypeInternal _RequestMessage_default_instance_;
+class ToClientMessage;
+struct ToClientMessageDefaultTypeInternal;
+extern ToClientMessageDefaultTypeInternal _ToClientMessage_default_instance_;
+class ToReplicaMessage;
+struct ToReplicaMessageDefaultTypeInternal;
+extern ToReplicaMessageDefaultTypeInternal _ToReplicaMessage_default_instance_;
+class UnloggedReplyMessage;
+struct UnloggedReplyMessageDefaultTypeInternal;
+extern UnloggedReplyMessageDefaultTypeInternal _UnloggedReplyMessage_default_instance_;
+class UnloggedRequestMessage;
+struct UnloggedRequestMessageDefaultTypeInternal;
+extern UnloggedRequestMessageDefaultTypeInternal _UnloggedRequestMessage_default_instance_;
+}  // namespace proto
+}  // namespace signedunrep
+}  // namespace dsnet
+PROTOBUF_NAMESPACE_OPEN
+template<> ::dsnet::signedunrep::proto::ReplyMessage* Arena::CreateMaybeMessage<::dsnet::signedunrep::proto::ReplyMessage>(Arena*);
+template<> ::dsnet::signedunrep::proto::RequestMessage* Arena::CreateMaybeMessage<::dsnet::signedunrep::proto::RequestMessage>(Arena*);
+template<> ::dsnet::signedunrep::proto::ToClientMessage* Arena::CreateMaybeMessage<::dsnet::signedunrep::proto::ToClientMessage>(Arena*);
+template<> ::dsnet::signedunrep::proto::ToReplicaMessage* Arena::CreateMaybeMessage<::dsnet::signedunrep::proto::ToReplicaMessage>(Arena*);
+template<> ::dsnet::signedunrep::proto::UnloggedReplyMessage* Arena::CreateMaybeMessage<::dsnet::signedunrep::proto::UnloggedReplyMessage>(Arena*);
+template<> ::dsnet::signedunrep::proto::UnloggedRequestMessage* Arena::CreateMaybeMessage<::dsnet::signedunrep::proto::UnloggedRequestMessage>(Arena*);
+PROTOBUF_NAMESPACE_CLOSE
+namespace dsnet {
+namespace signedunrep {
+namespace proto {
+
+// ===================================================================
+
+class RequestMessage final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:dsnet.signedunrep.proto.RequestMessage) */ {
+ public:
+  inline RequestMessage() : RequestMessage(nullptr) {}
+  ~RequestMessage() override;
+  explicit PROTOBUF_CONSTEXPR RequestMessage(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  RequestMessage(const RequestMessage& from);
+  RequestMessage(RequestMessage&& from) noexcept
+    : RequestMessage() {
+    *this = ::std::move(from);
+  }
+
+  inline RequestMessage& operator=(const RequestMessage& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline RequestMessage& operator=(RequestMessage&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const RequestMessage& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const RequestMessage* internal_default_instance() {
+    return reinterpret_cast<const RequestMessage*>(
+               &_RequestMessage_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    0;
+
+  friend void swap(RequestMessage& a, RequestMessage& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(RequestMessage* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(RequestMessage* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  RequestMessage* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<RequestMessage>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const RequestMessage& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const RequestMessage& from) {
+    RequestMessage::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(RequestMessage* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "dsnet.signedunrep.proto.RequestMessage";
+  }
+  protected:
+  explicit RequestMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kReqFieldNumber = 1,
+  };
+  // required .dsnet.Request req = 1;
+  bool has_req() const;
+  private:
+  bool _internal_has_req() const;
+  public:
+  void clear_req();
+  const ::dsnet::Request& req() const;
+  PROTOBUF_NODISCARD ::dsnet::Request* release_req();
+  ::dsnet::Request* mutable_req();
+  void set_allocated_req(::dsnet::Request* req);
+  private:
+  const ::dsnet::Request& _internal_req() const;
+  ::dsnet::Request* _internal_mutable_req();
+  public:
+  void unsafe_arena_set_allocated_req(
+      ::dsnet::Request* req);
+  ::dsnet::Request* unsafe_arena_release_req();
+
+  // @@protoc_insertion_point(class_scope:dsnet.signedunrep.proto.RequestMessage)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::dsnet::Request* req_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_replication_2fsignedunrep_2fsignedunrep_2dproto_2eproto;
+};
+// -------------------------------------------------------------------
+
+class UnloggedRequestMessage final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:dsnet.signedunrep.proto.UnloggedRequestMessage) */ {
+ public:
+  inline UnloggedRequestMessage() : UnloggedRequestMessage(nullptr) {}
+  ~UnloggedRequestMessage() override;
+  explicit PROTOBUF_CONSTEXPR UnloggedRequestMessage(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  UnloggedRequestMessage(const UnloggedRequestMessage& from);
+  UnloggedRequestMessage(UnloggedRequestMessage&& from) noexcept
+    : UnloggedRequestMessage() {
+    *this = ::std::move(from);
+  }
+
+  inline UnloggedRequestMessage& operator=(const UnloggedRequestMessage& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline UnloggedRequestMessage& operator=(UnloggedRequestMessage&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const UnloggedRequestMessage& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const UnloggedRequestMessage* internal_default_instance() {
+    return reinterpret_cast<const UnloggedRequestMessage*>(
+               &_UnloggedRequestMessage_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    1;
+
+  friend void swap(UnloggedRequestMessage& a, UnloggedRequestMessage& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(UnloggedRequestMessage* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(UnloggedRequestMessage* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  UnloggedRequestMessage* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<UnloggedRequestMessage>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const UnloggedRequestMessage& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const UnloggedRequestMessage& from) {
+    UnloggedRequestMessage::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(UnloggedRequestMessage* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "dsnet.signedunrep.proto.UnloggedRequestMessage";
+  }
+  protected:
+  explicit UnloggedRequestMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kReqFieldNumber = 1,
+  };
+  // required .dsnet.UnloggedRequest req = 1;
+  bool has_req() const;
+  private:
+  bool _internal_has_req() const;
+  public:
+  void clear_req();
+  const ::dsnet::UnloggedRequest& req() const;
+  PROTOBUF_NODISCARD ::dsnet::UnloggedRequest* release_req();
+  ::dsnet::UnloggedRequest* mutable_req();
+  void set_allocated_req(::dsnet::UnloggedRequest* req);
+  private:
+  const ::dsnet::UnloggedRequest& _internal_req() const;
+  ::dsnet::UnloggedRequest* _internal_mutable_req();
+  public:
+  void unsafe_arena_set_allocated_req(
+      ::dsnet::UnloggedRequest* req);
+  ::dsnet::UnloggedRequest* unsafe_arena_release_req();
+
+  // @@protoc_insertion_point(class_scope:dsnet.signedunrep.proto.UnloggedRequestMessage)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::dsnet::UnloggedRequest* req_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_replication_2fsignedunrep_2fsignedunrep_2dproto_2eproto;
+};
+// -------------------------------------------------------------------
+
+class ToReplicaMessage final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:dsnet.signedunrep.proto.ToReplicaMessage) */ {
+ public:
+  inline ToReplicaMessage() : ToReplicaMessage(nullptr) {}
+  ~ToReplicaMessage() override;
+  explicit PROTOBUF_CONSTEXPR ToReplicaMessage(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  ToReplicaMessage(const ToReplicaMessage& from);
+  ToReplicaMessage(ToReplicaMessage&& from) noexcept
+    : ToReplicaMessage() {
+    *this = ::std::move(from);
+  }
+
+  inline ToReplicaMessage& operator=(const ToReplicaMessage& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline ToReplicaMessage& operator=(ToReplicaMessage&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ToReplicaMessage& default_instance() {
+    return *internal_default_instance();
+  }
+  enum MsgCase {
+    kRequest = 1,
+    kUnloggedRequest = 2,
+    MSG_NOT_SET = 0,
+  };
+
+  static inline const ToReplicaMessage* internal_default_instance() {
+    return reinterpret_cast<const ToReplicaMessage*>(
+               &_ToReplicaMessage_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    2;
+
+  friend void swap(ToReplicaMessage& a, ToReplicaMessage& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(ToReplicaMessage* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ToReplicaMessage* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  ToReplicaMessage* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ToReplicaMessage>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const ToReplicaMessage& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ToReplicaMessage& from) {
+    ToReplicaMessage::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(ToReplicaMessage* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "dsnet.signedunrep.proto.ToReplicaMessage";
+  }
+  protected:
+  explicit ToReplicaMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kRequestFieldNumber = 1,
+    kUnloggedRequestFieldNumber = 2,
+  };
+  // .dsnet.signedunrep.proto.RequestMessage request = 1;
+  bool has_request() const;
+  private:
+  bool _internal_has_request() const;
+  public:
+  void clear_request();
+  const ::dsnet::signedunrep::proto::RequestMessage& request() const;
+  PROTOBUF_NODISCARD ::dsnet::signedunrep::proto::RequestMessage* release_request();
+  ::dsnet::signedunrep::proto::RequestMessage* mutable_request();
+  void set_allocated_request(::dsnet::signedunrep::proto::RequestMessage* request);
+  private:
+  const ::dsnet::signedunrep::proto::RequestMessage& _internal_request() const;
+  ::dsnet::signedunrep::proto::RequestMessage* _internal_mutable_request();
+  public:
+  void unsafe_arena_set_allocated_request(
+      ::dsnet::signedunrep::proto::RequestMessage* request);
+  ::dsnet::signedunrep::proto::RequestMessage* unsafe_arena_release_request();
+
+  // .dsnet.signedunrep.proto.UnloggedRequestMessage unlogged_request = 2;
+  bool has_unlogged_request() const;
+  private:
+  bool _internal_has_unlogged_request() const;
+  public:
+  void clear_unlogged_request();
+  const ::dsnet::signedunrep::proto::UnloggedRequestMessage& unlogged_request() const;
+  PROTOBUF_NODISCARD ::dsnet::signedunrep::proto::UnloggedRequestMessage* release_unlogged_request();
+  ::dsnet::signedunrep::proto::UnloggedRequestMessage* mutable_unlogged_request();
+  void set_allocated_unlogged_request(::dsnet::signedunrep::proto::UnloggedRequestMessage* unlogged_request);
+  private:
+  const ::dsnet::signedunrep::proto::UnloggedRequestMessage& _internal_unlogged_request() const;
+  ::dsnet::signedunrep::proto::UnloggedRequestMessage* _internal_mutable_unlogged_request();
+  public:
+  void unsafe_arena_set_allocated_unlogged_request(
+      ::dsnet::signedunrep::proto::UnloggedRequestMessage* unlogged_request);
+  ::dsnet::signedunrep::proto::UnloggedRequestMessage* unsafe_arena_release_unlogged_request();
+
+  void clear_msg();
+  MsgCase msg_case() const;
+  // @@protoc_insertion_point(class_scope:dsnet.signedunrep.proto.ToReplicaMessage)
+ private:
+  class _Internal;
+  void set_has_request();
+  void set_has_unlogged_request();
+
+  inline bool has_msg() const;
+  inline void clear_has_msg();
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    union MsgUnion {
+      constexpr MsgUnion() : _constinit_{} {}
+        ::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized _constinit_;
+      ::dsnet::signedunrep::proto::RequestMessage* request_;
+      ::dsnet::signedunrep::proto::UnloggedRequestMessage* unlogged_request_;
+    } msg_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    uint32_t _oneof_case_[1];
+
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_replication_2fsignedunrep_2fsignedunrep_2dproto_2eproto;
+};
+// -------------------------------------------------------------------
+
+class ReplyMessage final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:dsnet.signedunrep.proto.ReplyMessage) */ {
+ public:
+  inline ReplyMessage() : ReplyMessage(nullptr) {}
+  ~ReplyMessage() override;
+  explicit PROTOBUF_CONSTEXPR ReplyMessage(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  ReplyMessage(const ReplyMessage& from);
+  ReplyMessage(ReplyMessage&& from) noexcept
+    : ReplyMessage() {
+    *this = ::std::move(from);
+  }
+
+  inline ReplyMessage& operator=(const ReplyMessage& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline ReplyMessage& operator=(ReplyMessage&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ReplyMessage& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const ReplyMessage* internal_default_instance() {
+    return reinterpret_cast<const ReplyMessage*>(
+               &_ReplyMessage_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    3;
+
+  friend void swap(ReplyMessage& a, ReplyMessage& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(ReplyMessage* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ReplyMessage* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  ReplyMessage* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ReplyMessage>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const ReplyMessage& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ReplyMessage& from) {
+    ReplyMessage::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(ReplyMessage* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "dsnet.signedunrep.proto.ReplyMessage";
+  }
+  protected:
+  explicit ReplyMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kReplyFieldNumber = 4,
+    kReqFieldNumber = 3,
+    kViewFieldNumber = 1,
+    kOpnumFieldNumber = 2,
+  };
+  // required bytes reply = 4;
+  bool has_reply() const;
+  private:
+  bool _internal_has_reply() const;
+  public:
+  void clear_reply();
+  const std::string& reply() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_reply(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_reply();
+  PROTOBUF_NODISCARD std::string* release_reply();
+  void set_allocated_reply(std::string* reply);
+  private:
+  const std::string& _internal_reply() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_reply(const std::string& value);
+  std::string* _internal_mutable_reply();
+  public:
+
+  // required .dsnet.Request req = 3;
+  bool has_req() const;
+  private:
+  bool _internal_has_req() const;
+  public:
+  void clear_req();
+  const ::dsnet::Request& req() const;
+  PROTOBUF_NODISCARD ::dsnet::Request* release_req();
+  ::dsnet::Request* mutable_req();
+  void set_allocated_req(::dsnet::Request* req);
+  private:
+  const ::dsnet::Request& _internal_req() const;
+  ::dsnet::Request* _internal_mutable_req();
+  public:
+  void unsafe_arena_set_allocated_req(
+      ::dsnet::Request* req);
+  ::dsnet::Request* unsafe_arena_release_req();
+
+  // optional uint64 view = 1;
+  bool has_view() const;
+  private:
+  bool _internal_has_view() const;
+  public:
+  void clear_view();
+  uint64_t view() const;
+  void set_view(uint64_t value);
+  private:
+  uint64_t _internal_view() const;
+  void _internal_set_view(uint64_t value);
+  public:
+
+  // optional uint64 opnum = 2;
+  bool has_opnum() const;
+  private:
+  bool _internal_has_opnum() const;
+  public:
+  void clear_opnum();
+  uint64_t opnum() const;
+  void set_opnum(uint64_t value);
+  private:
+  uint64_t _internal_opnum() const;
+  void _internal_set_opnum(uint64_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:dsnet.signedunrep.proto.ReplyMessage)
+ private:
+  class _Internal;
+
+  // helper for ByteSizeLong()
+  size_t RequiredFieldsByteSizeFallback() const;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr reply_;
+    ::dsnet::Request* req_;
+    uint64_t view_;
+    uint64_t opnum_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_replication_2fsignedunrep_2fsignedunrep_2dproto_2eproto;
+};
+// -------------------------------------------------------------------
+
+class UnloggedReplyMessage final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:dsnet.signedunrep.proto.UnloggedReplyMessage) */ {
+ public:
+  inline UnloggedReplyMessage() : UnloggedReplyMessage(nullptr) {}
+  ~UnloggedReplyMessage() override;
+  explicit PROTOBUF_CONSTEXPR UnloggedReplyMessage(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  UnloggedReplyMessage(const UnloggedReplyMessage& from);
+  UnloggedReplyMessage(UnloggedReplyMessage&& from) noexcept
+    : UnloggedReplyMessage() {
+    *this = ::std::move(from);
+  }
+
+  inline UnloggedReplyMessage& operator=(const UnloggedReplyMessage& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline UnloggedReplyMessage& operator=(UnloggedReplyMessage&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const UnloggedReplyMessage& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const UnloggedReplyMessage* internal_default_instance() {
+    return reinterpret_cast<const UnloggedReplyMessage*>(
+               &_UnloggedReplyMessage_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    4;
+
+  friend void swap(UnloggedReplyMessage& a, UnloggedReplyMessage& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(UnloggedReplyMessage* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(UnloggedReplyMessage* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  UnloggedReplyMessage* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<UnloggedReplyMessage>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const UnloggedReplyMessage& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const UnloggedReplyMessage& from) {
+    UnloggedReplyMessage::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(UnloggedReplyMessage* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "dsnet.signedunrep.proto.UnloggedReplyMessage";
+  }
+  protected:
+  explicit UnloggedReplyMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kReplyFieldNumber = 1,
+  };
+  // required bytes reply = 1;
+  bool has_reply() const;
+  private:
+  bool _internal_has_reply() const;
+  public:
+  void clear_reply();
+  const std::string& reply() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_reply(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_reply();
+  PROTOBUF_NODISCARD std::string* release_reply();
+  void set_allocated_reply(std::string* reply);
+  private:
+  const std::string& _internal_reply() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_reply(const std::string& value);
+  std::string* _internal_mutable_reply();
+  public:
+
+  // @@protoc_insertion_point(class_scope:dsnet.signedunrep.proto.UnloggedReplyMessage)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr reply_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_replication_2fsignedunrep_2fsignedunrep_2dproto_2eproto;
+};
+// -------------------------------------------------------------------
+
+class ToClientMessage final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:dsnet.signedunrep.proto.ToClientMessage) */ {
+ public:
+  inline ToClientMessage() : ToClientMessage(nullptr) {}
+  ~ToClientMessage() override;
+  explicit PROTOBUF_CONSTEXPR ToClientMessage(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  ToClientMessage(const ToClientMessage& from);
+  ToClientMessage(ToClientMessage&& from) noexcept
+    : ToClientMessage() {
+    *this = ::std::move(from);
+  }
+
+  inline ToClientMessage& operator=(const ToClientMessage& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline ToClientMessage& operator=(ToClientMessage&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ToClientMessage& default_instance() {
+    return *internal_default_instance();
+  }
+  enum MsgCase {
+    kReply = 1,
+    kUnloggedReply = 2,
+    MSG_NOT_SET = 0,
+  };
+
+  static inline const ToClientMessage* internal_default_instance() {
+    return reinterpret_cast<const ToClientMessage*>(
+               &_ToClientMessage_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    5;
+
+  friend void swap(ToClientMessage& a, ToClientMessage& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(ToClientMessage* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ToClientMessage* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  ToClientMessage* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ToClientMessage>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const ToClientMessage& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ToClientMessage& from) {
+    ToClientMessage::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(ToClientMessage* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "dsnet.signedunrep.proto.ToClientMessage";
+  }
+  protected:
+  explicit ToClientMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kReplyFieldNumber = 1,
+    kUnloggedReplyFieldNumber = 2,
+  };
+  // .dsnet.signedunrep.proto.ReplyMessage reply = 1;
+  bool has_reply() const;
+  private:
+  bool _internal_has_reply() const;
+  public:
+  void clear_reply();
+  const ::dsnet::signedunrep::proto::ReplyMessage& reply() const;
+  PROTOBUF_NODISCARD ::dsnet::signedunrep::proto::ReplyMessage* release_reply();
+  ::dsnet::signedunrep::proto::ReplyMessage* mutable_reply();
+  void set_allocated_reply(::dsnet::signedunrep::proto::ReplyMessage* reply);
+  private:
+  const ::dsnet::signedunrep::proto::ReplyMessage& _internal_reply() const;
+  ::dsnet::signedunrep::proto::ReplyMessage* _internal_mutable_reply();
+  public:
+  void unsafe_arena_set_allocated_reply(
+      ::dsnet::signedunrep::proto::ReplyMessage* reply);
+  ::dsnet::signedunrep::proto::ReplyMessage* unsafe_arena_release_reply();
+
+  // .dsnet.signedunrep.proto.UnloggedReplyMessage unlogged_reply = 2;
+  bool has_unlogged_reply() const;
+  private:
+  bool _internal_has_unlogged_reply() const;
+  public:
+  void clear_unlogged_reply();
+  const ::dsnet::signedunrep::proto::UnloggedReplyMessage& unlogged_reply() const;
+  PROTOBUF_NODISCARD ::dsnet::signedunrep::proto::UnloggedReplyMessage* release_unlogged_reply();
+  ::dsnet::signedunrep::proto::UnloggedReplyMessage* mutable_unlogged_reply();
+  void set_allocated_unlogged_reply(::dsnet::signedunrep::proto::UnloggedReplyMessage* unlogged_reply);
+  private:
+  const ::dsnet::signedunrep::proto::UnloggedReplyMessage& _internal_unlogged_reply() const;
+  ::dsnet::signedunrep::proto::UnloggedReplyMessage* _internal_mutable_unlogged_reply();
+  public:
+  void unsafe_arena_set_allocated_unlogged_reply(
+      ::dsnet::signedunrep::proto::UnloggedReplyMessage* unlogged_reply);
+  ::dsnet::signedunrep::proto::UnloggedReplyMessage* unsafe_arena_release_unlogged_reply();
+
+  void clear_msg();
+  MsgCase msg_case() const;
+  // @@protoc_insertion_point(class_scope:dsnet.signedunrep.proto.ToClientMessage)
+ private:
+  class _Internal;
+  void set_has_reply();
+  void set_has_unlogged_reply();
+
+  inline bool has_msg() const;
+  inline void clear_has_msg();
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    union MsgUnion {
+      constexpr MsgUnion() : _constinit_{} {}
+        ::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized _constinit_;
+      ::dsnet::signedunrep::proto::ReplyMessage* reply_;
+      ::dsnet::signedunrep::proto::UnloggedReplyMessage* unlogged_reply_;
+    } msg_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    uint32_t _oneof_case_[1];
+
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_replication_2fsignedunrep_2fsignedunrep_2dproto_2eproto;
+};
+// ===================================================================
+
+
+// ===================================================================
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
+#endif  // __GNUC__
+// RequestMessage
+
+// required .dsnet.Request req = 1;
+inline bool RequestMessage::_internal_has_req() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.req_ != nullptr);
+  return value;
+}
+inline bool RequestMessage::has_req() const {
+  return _internal_has_req();
+}
+inline const ::dsnet::Request& RequestMessage::_internal_req() const {
+  const ::dsnet::Request* p = _impl_.req_;
+  return p != nullptr ? *p : reinterpret_cast<const ::dsnet::Request&>(
+      ::dsnet::_Request_default_instance_);
+}
+inline const ::dsnet::Request& RequestMessage::req() const {
+  // @@protoc_insertion_point(field_get:dsnet.signedunrep.proto.RequestMessage.req)
+  return _internal_req();
+}
+inline void RequestMessage::unsafe_arena_set_allocated_req(
+    ::dsnet::Request* req) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.req_);
+  }
+  _impl_.req_ = req;
+  if (req) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:dsnet.signedunrep.proto.RequestMessage.req)
+}
+inline ::dsnet::Request* RequestMessage::release_req() {
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::dsnet::Request* temp = _impl_.req_;
+  _impl_.req_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::dsnet::Request* RequestMessage::unsafe_arena_release_req() {
+  // @@protoc_insertion_point(field_release:dsnet.signedunrep.proto.RequestMessage.req)
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::dsnet::Request* temp = _impl_.req_;
+  _impl_.req_ = nullptr;
+  return temp;
+}
+inline ::dsnet::Request* RequestMessage::_internal_mutable_req() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  if (_impl_.req_ == nullptr) {
+    auto* p = CreateMaybeMessage<::dsnet::Request>(GetArenaForAllocation());
+    _impl_.req_ = p;
+  }
+  return _impl_.req_;
+}
+inline ::dsnet::Request* RequestMessage::mutable_req() {
+  ::dsnet::Request* _msg = _internal_mutable_req();
+  // @@protoc_insertion_point(field_mutable:dsnet.signedunrep.proto.RequestMessage.req)
+  return _msg;
+}
+inline void RequestMessage::set_allocated_req(::dsnet::Request* req) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete reinterpret_cast< ::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.req_);
+  }
+  if (req) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(
+                reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(req));
+    if (message_arena != submessage_arena) {
+      req = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, req, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.req_ = req;
+  // @@protoc_insertion_point(field_set_allocated:dsnet.signedunrep.proto.RequestMessage.req)
+}
+
+// -------------------------------------------------------------------
+
+// UnloggedRequestMessage
+
+// required .dsnet.UnloggedRequest req = 1;
+inline bool UnloggedRequestMessage::_internal_has_req() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.req_ != nullptr);
+  return value;
+}
+inline bool UnloggedRequestMessage::has_req() const {
+  return _internal_has_req();
+}
+inline const ::dsnet::UnloggedRequest& UnloggedRequestMessage::_internal_req() const {
+  const ::dsnet::UnloggedRequest* p = _impl_.req_;
+  return p != nullptr ? *p : reinterpret_cast<const ::dsnet::UnloggedRequest&>(
+      ::dsnet::_UnloggedRequest_default_instance_);
+}
+inline const ::dsnet::UnloggedRequest& UnloggedRequestMessage::req() const {
+  // @@protoc_insertion_point(field_get:dsnet.signedunrep.proto.UnloggedRequestMessage.req)
+  return _internal_req();
+}
+inline void UnloggedRequestMessage::unsafe_arena_set_allocated_req(
+    ::dsnet::UnloggedRequest* req) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.req_);
+  }
+  _impl_.req_ = req;
+  if (req) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:dsnet.signedunrep.proto.UnloggedRequestMessage.req)
+}
+inline ::dsnet::UnloggedRequest* UnloggedRequestMessage::release_req() {
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::dsnet::UnloggedRequest* temp = _impl_.req_;
+  _impl_.req_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::dsnet::UnloggedRequest* UnloggedRequestMessage::unsafe_arena_release_req() {
+  // @@protoc_insertion_point(field_release:dsnet.signedunrep.proto.UnloggedRequestMessage.req)
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::dsnet::UnloggedRequest* temp = _impl_.req_;
+  _impl_.req_ = nullptr;
+  return temp;
+}
+inline ::dsnet::UnloggedRequest* UnloggedRequestMessage::_internal_mutable_req() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  if (_impl_.req_ == nullptr) {
+    auto* p = CreateMaybeMessage<::dsnet::UnloggedRequest>(GetArenaForAllocation());
+    _impl_.req_ = p;
+  }
+  return _impl_.req_;
+}
+inline ::dsnet::UnloggedRequest* UnloggedRequestMessage::mutable_req() {
+  ::dsnet::UnloggedRequest* _msg = _internal_mutable_req();
+  // @@protoc_insertion_point(field_mutable:dsnet.signedunrep.proto.UnloggedRequestMessage.req)
+  return _msg;
+}
+inline void UnloggedRequestMessage::set_allocated_req(::dsnet::UnloggedRequest* req) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete reinterpret_cast< ::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.req_);
+  }
+  if (req) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(
+                reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(req));
+    if (message_arena != submessage_arena) {
+      req = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, req, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.req_ = req;
+  // @@protoc_insertion_point(field_set_allocated:dsnet.signedunrep.proto.UnloggedRequestMessage.req)
+}
+
+// -------------------------------------------------------------------
+
+// ToReplicaMessage
+
+// .dsnet.signedunrep.proto.RequestMessage request = 1;
+inline bool ToReplicaMessage::_internal_has_request() const {
+  return msg_case() == kRequest;
+}
+inline bool ToReplicaMessage::has_request() const {
+  return _internal_has_request();
+}
+inline void ToReplicaMessage::set_has_request() {
+  _impl_._oneof_case_[0] = kRequest;
+}
+inline void ToReplicaMessage::clear_request() {
+  if (_internal_has_request()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.msg_.request_;
+    }
+    clear_has_msg();
+  }
+}
+inline ::dsnet::signedunrep::proto::RequestMessage* ToReplicaMessage::release_request() {
+  // @@protoc_insertion_point(field_release:dsnet.signedunrep.proto.ToReplicaMessage.request)
+  if (_internal_has_request()) {
+    clear_has_msg();
+    ::dsnet::signedunrep::proto::RequestMessage* temp = _impl_.msg_.request_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.msg_.request_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::dsnet::signedunrep::proto::RequestMessage& ToReplicaMessage::_internal_request() const {
+  return _internal_has_request()
+      ? *_impl_.msg_.request_
+      : reinterpret_cast< ::dsnet::signedunrep::proto::RequestMessage&>(::dsnet::signedunrep::proto::_RequestMessage_default_instance_);
+}
+inline const ::dsnet::signedunrep::proto::RequestMessage& ToReplicaMessage::request() const {
+  // @@protoc_insertion_point(field_get:dsnet.signedunrep.proto.ToReplicaMessage.request)
+  return _internal_request();
+}
+inline ::dsnet::signedunrep::proto::RequestMessage* ToReplicaMessage::unsafe_arena_release_request() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:dsnet.signedunrep.proto.ToReplicaMessage.request)
+  if (_internal_has_request()) {
+    clear_has_msg();
+    ::dsnet::signedunrep::proto::RequestMessage* temp = _impl_.msg_.request_;
+    _impl_.msg_.request_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void ToReplicaMessage::unsafe_arena_set_allocated_request(::dsnet::signedunrep::proto::RequestMessage* request) {
+  clear_msg();
+  if (request) {
+    set_has_request();
+    _impl_.msg_.request_ = request;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:dsnet.signedunrep.proto.ToReplicaMessage.request)
+}
+inline ::dsnet::signedunrep::proto::RequestMessage* ToReplicaMessage::_internal_mutable_request() {
+  if (!_internal_has_request()) {
+    clear_msg();
+    set_has_request();
+    _impl_.msg_.request_ = CreateMaybeMessage< ::dsnet::signedunrep::proto::RequestMessage >(GetArenaForAllocation());
+  }
+  return _impl_.msg_.request_;
+}
+inline ::dsnet::signedunrep::proto::RequestMessage* ToReplicaMessage::mutable_request() {
+  ::dsnet::signedunrep::proto::RequestMessage* _msg = _internal_mutable_request();
+  // @@protoc_insertion_point(field_mutable:dsnet.signedunrep.proto.ToReplicaMessage.request)
+  return _msg;
+}
+
+// .dsnet.signedunrep.proto.UnloggedRequestMessage unlogged_request = 2;
+inline bool ToReplicaMessage::_internal_has_unlogged_request() const {
+  return msg_case() == kUnloggedRequest;
+}
+inline bool ToReplicaMessage::has_unlogged_request() const {
+  return _internal_has_unlogged_request();
+}
+inline void ToReplicaMessage::set_has_unlogged_request() {
+  _impl_._oneof_case_[0] = kUnloggedRequest;
+}
+inline void ToReplicaMessage::clear_unlogged_request() {
+  if (_internal_has_unlogged_request()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.msg_.unlogged_request_;
+    }
+    clear_has_msg();
+  }
+}
+inline ::dsnet::signedunrep::proto::UnloggedRequestMessage* ToReplicaMessage::release_unlogged_request() {
+  // @@protoc_insertion_point(field_release:dsnet.signedunrep.proto.ToReplicaMessage.unlogged_request)
+  if (_internal_has_unlogged_request()) {
+    clear_has_msg();
+    ::dsnet::signedunrep::proto::UnloggedRequestMessage* temp = _impl_.msg_.unlogged_request_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.msg_.unlogged_request_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::dsnet::signedunrep::proto::UnloggedRequestMessage& ToReplicaMessage::_internal_unlogged_request() const {
+  return _internal_has_unlogged_request()
+      ? *_impl_.msg_.unlogged_request_
+      : reinterpret_cast< ::dsnet::signedunrep::proto::UnloggedRequestMessage&>(::dsnet::signedunrep::proto::_UnloggedRequestMessage_default_instance_);
+}
+inline const ::dsnet::signedunrep::proto::UnloggedRequestMessage& ToReplicaMessage::unlogged_request() const {
+  // @@protoc_insertion_point(field_get:dsnet.signedunrep.proto.ToReplicaMessage.unlogged_request)
+  return _internal_unlogged_request();
+}
+inline ::dsnet::signedunrep::proto::UnloggedRequestMessage* ToReplicaMessage::unsafe_arena_release_unlogged_request() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:dsnet.signedunrep.proto.ToReplicaMessage.unlogged_request)
+  if (_internal_has_unlogged_request()) {
+    clear_has_msg();
+    ::dsnet::signedunrep::proto::UnloggedRequestMessage* temp = _impl_.msg_.unlogged_request_;
+    _impl_.msg_.unlogged_request_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void ToReplicaMessage::unsafe_arena_set_allocated_unlogged_request(::dsnet::signedunrep::proto::UnloggedRequestMessage* unlogged_request) {
+  clear_msg();
+  if (unlogged_request) {
+    set_has_unlogged_request();
+    _impl_.msg_.unlogged_request_ = unlogged_request;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:dsnet.signedunrep.proto.ToReplicaMessage.unlogged_request)
+}
+inline ::dsnet::signedunrep::proto::UnloggedRequestMessage* ToReplicaMessage::_internal_mutable_unlogged_request() {
+  if (!_internal_has_unlogged_request()) {
+    clear_msg();
+    set_has_unlogged_request();
+    _impl_.msg_.unlogged_request_ = CreateMaybeMessage< ::dsnet::signedunrep::proto::UnloggedRequestMessage >(GetArenaForAllocation());
+  }
+  return _impl_.msg_.unlogged_request_;
+}
+inline ::dsnet::signedunrep::proto::UnloggedRequestMessage* ToReplicaMessage::mutable_unlogged_request() {
+  ::dsnet::signedunrep::proto::UnloggedRequestMessage* _msg = _internal_mutable_unlogged_request();
+  // @@protoc_insertion_point(field_mutable:dsnet.signedunrep.proto.ToReplicaMessage.unlogged_request)
+  return _msg;
+}
+
+inline bool ToReplicaMessage::has_msg() const {
+  return msg_case() != MSG_NOT_SET;
+}
+inline void ToReplicaMessage::clear_has_msg() {
+  _impl_._oneof_case_[0] = MSG_NOT_SET;
+}
+inline ToReplicaMessage::MsgCase ToReplicaMessage::msg_case() const {
+  return ToReplicaMessage::MsgCase(_impl_._oneof_case_[0]);
+}
+// -------------------------------------------------------------------
+
+// ReplyMessage
+
+// optional uint64 view = 1;
+inline bool ReplyMessage::_internal_has_view() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool ReplyMessage::has_view() const {
+  return _internal_has_view();
+}
+inline void ReplyMessage::clear_view() {
+  _impl_.view_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline uint64_t ReplyMessage::_internal_view() const {
+  return _impl_.view_;
+}
+inline uint64_t ReplyMessage::view() const {
+  // @@protoc_insertion_point(field_get:dsnet.signedunrep.proto.ReplyMessage.view)
+  return _internal_view();
+}
+inline void ReplyMessage::_internal_set_view(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.view_ = value;
+}
+inline void ReplyMessage::set_view(uint64_t value) {
+  _internal_set_view(value);
+  // @@protoc_insertion_point(field_set:dsnet.signedunrep.proto.ReplyMessage.view)
+}
+
+// optional uint64 opnum = 2;
+inline bool ReplyMessage::_internal_has_opnum() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  return value;
+}
+inline bool ReplyMessage::has_opnum() const {
+  return _internal_has_opnum();
+}
+inline void ReplyMessage::clear_opnum() {
+  _impl_.opnum_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000008u;
+}
+inline uint64_t ReplyMessage::_internal_opnum() const {
+  return _impl_.opnum_;
+}
+inline uint64_t ReplyMessage::opnum() const {
+  // @@protoc_insertion_point(field_get:dsnet.signedunrep.proto.ReplyMessage.opnum)
+  return _internal_opnum();
+}
+inline void ReplyMessage::_internal_set_opnum(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  _impl_.opnum_ = value;
+}
+inline void ReplyMessage::set_opnum(uint64_t value) {
+  _internal_set_opnum(value);
+  // @@protoc_insertion_point(field_set:dsnet.signedunrep.proto.ReplyMessage.opnum)
+}
+
+// required .dsnet.Request req = 3;
+inline bool ReplyMessage::_internal_has_req() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.req_ != nullptr);
+  return value;
+}
+inline bool ReplyMessage::has_req() const {
+  return _internal_has_req();
+}
+inline const ::dsnet::Request& ReplyMessage::_internal_req() const {
+  const ::dsnet::Request* p = _impl_.req_;
+  return p != nullptr ? *p : reinterpret_cast<const ::dsnet::Request&>(
+      ::dsnet::_Request_default_instance_);
+}
+inline const ::dsnet::Request& ReplyMessage::req() const {
+  // @@protoc_insertion_point(field_get:dsnet.signedunrep.proto.ReplyMessage.req)
+  return _internal_req();
+}
+inline void ReplyMessage::unsafe_arena_set_allocated_req(
+    ::dsnet::Request* req) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.req_);
+  }
+  _impl_.req_ = req;
+  if (req) {
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:dsnet.signedunrep.proto.ReplyMessage.req)
+}
+inline ::dsnet::Request* ReplyMessage::release_req() {
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  ::dsnet::Request* temp = _impl_.req_;
+  _impl_.req_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::dsnet::Request* ReplyMessage::unsafe_arena_release_req() {
+  // @@protoc_insertion_point(field_release:dsnet.signedunrep.proto.ReplyMessage.req)
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  ::dsnet::Request* temp = _impl_.req_;
+  _impl_.req_ = nullptr;
+  return temp;
+}
+inline ::dsnet::Request* ReplyMessage::_internal_mutable_req() {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  if (_impl_.req_ == nullptr) {
+    auto* p = CreateMaybeMessage<::dsnet::Request>(GetArenaForAllocation());
+    _impl_.req_ = p;
+  }
+  return _impl_.req_;
+}
+inline ::dsnet::Request* ReplyMessage::mutable_req() {
+  ::dsnet::Request* _msg = _internal_mutable_req();
+  // @@protoc_insertion_point(field_mutable:dsnet.signedunrep.proto.ReplyMessage.req)
+  return _msg;
+}
+inline void ReplyMessage::set_allocated_req(::dsnet::Request* req) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete reinterpret_cast< ::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.req_);
+  }
+  if (req) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(
+                reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(req));
+    if (message_arena != submessage_arena) {
+      req = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, req, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  _impl_.req_ = req;
+  // @@protoc_insertion_point(field_set_allocated:dsnet.signedunrep.proto.ReplyMessage.req)
+}
+
+// required bytes reply = 4;
+inline bool ReplyMessage::_internal_has_reply() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool ReplyMessage::has_reply() const {
+  return _internal_has_reply();
+}
+inline void ReplyMessage::clear_reply() {
+  _impl_.reply_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& ReplyMessage::reply() const {
+  // @@protoc_insertion_point(field_get:dsnet.signedunrep.proto.ReplyMessage.reply)
+  return _internal_reply();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void ReplyMessage::set_reply(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.reply_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:dsnet.signedunrep.proto.ReplyMessage.reply)
+}
+inline std::string* ReplyMessage::mutable_reply() {
+  std::string* _s = _internal_mutable_reply();
+  // @@protoc_insertion_point(field_mutable:dsnet.signedunrep.proto.ReplyMessage.reply)
+  return _s;
+}
+inline const std::string& ReplyMessage::_internal_reply() const {
+  return _impl_.reply_.Get();
+}
+inline void ReplyMessage::_internal_set_reply(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.reply_.Set(value, GetArenaForAllocation());
+}
+inline std::string* ReplyMessage::_internal_mutable_reply() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.reply_.Mutable(GetArenaForAllocation());
+}
+inline std::string* ReplyMessage::release_reply() {
+  // @@protoc_insertion_point(field_release:dsnet.signedunrep.proto.ReplyMessage.reply)
+  if (!_internal_has_reply()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.reply_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.reply_.IsDefault()) {
+    _impl_.reply_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void ReplyMessage::set_allocated_reply(std::string* reply) {
+  if (reply != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.reply_.SetAllocated(reply, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.reply_.IsDefault()) {
+    _impl_.reply_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:dsnet.signedunrep.proto.ReplyMessage.reply)
+}
+
+// -------------------------------------------------------------------
+
+// UnloggedReplyMessage
+
+// required bytes reply = 1;
+inline bool UnloggedReplyMessage::_internal_has_reply() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool UnloggedReplyMessage::has_reply() const {
+  return _internal_has_reply();
+}
+inline void UnloggedReplyMessage::clear_reply() {
+  _impl_.reply_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& UnloggedReplyMessage::reply() const {
+  // @@protoc_insertion_point(field_get:dsnet.signedunrep.proto.UnloggedReplyMessage.reply)
+  return _internal_reply();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void UnloggedReplyMessage::set_reply(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.reply_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:dsnet.signedunrep.proto.UnloggedReplyMessage.reply)
+}
+inline std::string* UnloggedReplyMessage::mutable_reply() {
+  std::string* _s = _internal_mutable_reply();
+  // @@protoc_insertion_point(field_mutable:dsnet.signedunrep.proto.UnloggedReplyMessage.reply)
+  return _s;
+}
+inline const std::string& UnloggedReplyMessage::_internal_reply() const {
+  return _impl_.reply_.Get();
+}
+inline void UnloggedReplyMessage::_internal_set_reply(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.reply_.Set(value, GetArenaForAllocation());
+}
+inline std::string* UnloggedReplyMessage::_internal_mutable_reply() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.reply_.Mutable(GetArenaForAllocation());
+}
+inline std::string* UnloggedReplyMessage::release_reply() {
+  // @@protoc_insertion_point(field_release:dsnet.signedunrep.proto.UnloggedReplyMessage.reply)
+  if (!_internal_has_reply()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.reply_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.reply_.IsDefault()) {
+    _impl_.reply_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void UnloggedReplyMessage::set_allocated_reply(std::string* reply) {
+  if (reply != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.reply_.SetAllocated(reply, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.reply_.IsDefault()) {
+    _impl_.reply_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:dsnet.signedunrep.proto.UnloggedReplyMessage.reply)
+}
+
+// -------------------------------------------------------------------
+
+// ToClientMessage
+
+// .dsnet.signedunrep.proto.ReplyMessage reply = 1;
+inline bool ToClientMessage::_internal_has_reply() const {
+  return msg_case() == kReply;
+}
+inline bool ToClientMessage::has_reply() const {
+  return _internal_has_reply();
+}
+inline void ToClientMessage::set_has_reply() {
+  _impl_._oneof_case_[0] = kReply;
+}
+inline void ToClientMessage::clear_reply() {
+  if (_internal_has_reply()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.msg_.reply_;
+    }
+    clear_has_msg();
+  }
+}
+inline ::dsnet::signedunrep::proto::ReplyMessage* ToClientMessage::release_reply() {
+  // @@protoc_insertion_point(field_release:dsnet.signedunrep.proto.ToClientMessage.reply)
+  if (_internal_has_reply()) {
+    clear_has_msg();
+    ::dsnet::signedunrep::proto::ReplyMessage* temp = _impl_.msg_.reply_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.msg_.reply_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::dsnet::signedunrep::proto::ReplyMessage& ToClientMessage::_internal_reply() const {
+  return _internal_has_reply()
+      ? *_impl_.msg_.reply_
+      : reinterpret_cast< ::dsnet::signedunrep::proto::ReplyMessage&>(::dsnet::signedunrep::proto::_ReplyMessage_default_instance_);
+}
+inline const ::dsnet::signedunrep::proto::ReplyMessage& ToClientMessage::reply() const {
+  // @@protoc_insertion_point(field_get:dsnet.signedunrep.proto.ToClientMessage.reply)
+  return _internal_reply();
+}
+inline ::dsnet::signedunrep::proto::ReplyMessage* ToClientMessage::unsafe_arena_release_reply() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:dsnet.signedunrep.proto.ToClientMessage.reply)
+  if (_internal_has_reply()) {
+    clear_has_msg();
+    ::dsnet::signedunrep::proto::ReplyMessage* temp = _impl_.msg_.reply_;
+    _impl_.msg_.reply_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void ToClientMessage::unsafe_arena_set_allocated_reply(::dsnet::signedunrep::proto::ReplyMessage* reply) {
+  clear_msg();
+  if (reply) {
+    set_has_reply();
+    _impl_.msg_.reply_ = reply;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:dsnet.signedunrep.proto.ToClientMessage.reply)
+}
+inline ::dsnet::signedunrep::proto::ReplyMessage* ToClientMessage::_internal_mutable_reply() {
+  if (!_internal_has_reply()) {
+    clear_msg();
+    set_has_reply();
+    _impl_.msg_.reply_ = CreateMaybeMessage< ::dsnet::signedunrep::proto::ReplyMessage >(GetArenaForAllocation());
+  }
+  return _impl_.msg_.reply_;
+}
+inline ::dsnet::signedunrep::proto::ReplyMessage* ToClientMessage::mutable_reply() {
+  ::dsnet::signedunrep::proto::ReplyMessage* _msg = _internal_mutable_reply();
+  // @@protoc_insertion_point(field_mutable:dsnet.signedunrep.proto.ToClientMessage.reply)
+  return _msg;
+}
+
+// .dsnet.signedunrep.proto.UnloggedReplyMessage unlogged_reply = 2;
+inline bool ToClientMessage::_internal_has_unlogged_reply() const {
+  return msg_case() == kUnloggedReply;
+}
+inline bool ToClientMessage::has_unlogged_reply() const {
+  return _internal_has_unlogged_reply();
+}
+inline void ToClientMessage::set_has_unlogged_reply() {
+  _impl_._oneof_case_[0] = kUnloggedReply;
+}
+inline void ToClientMessage::clear_unlogged_reply() {
+  if (_internal_has_unlogged_reply()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.msg_.unlogged_reply_;
+    }
+    clear_has_msg();
+  }
+}
+inline ::dsnet::signedunrep::proto::UnloggedReplyMessage* ToClientMessage::release_unlogged_reply() {
+  // @@protoc_insertion_point(field_release:dsnet.signedunrep.proto.ToClientMessage.unlogged_reply)
+  if (_internal_has_unlogged_reply()) {
+    clear_has_msg();
+    ::dsnet::signedunrep::proto::UnloggedReplyMessage* temp = _impl_.msg_.unlogged_reply_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.msg_.unlogged_reply_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::dsnet::signedunrep::proto::UnloggedReplyMessage& ToClientMessage::_internal_unlogged_reply() const {
+  return _internal_has_unlogged_reply()
+      ? *_impl_.msg_.unlogged_reply_
+      : reinterpret_cast< ::dsnet::signedunrep::proto::UnloggedReplyMessage&>(::dsnet::signedunrep::proto::_UnloggedReplyMessage_default_instance_);
+}
+inline const ::dsnet::signedunrep::proto::UnloggedReplyMessage& ToClientMessage::unlogged_reply() const {
+  // @@protoc_insertion_point(field_get:dsnet.signedunrep.proto.ToClientMessage.unlogged_reply)
+  return _internal_unlogged_reply();
+}
+inline ::dsnet::signedunrep::proto::UnloggedReplyMessage* ToClientMessage::unsafe_arena_release_unlogged_reply() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:dsnet.signedunrep.proto.ToClientMessage.unlogged_reply)
+  if (_internal_has_unlogged_reply()) {
+    clear_has_msg();
+    ::dsnet::signedunrep::proto::UnloggedReplyMessage* temp = _impl_.msg_.unlogged_reply_;
+    _impl_.msg_.unlogged_reply_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void ToClientMessage::unsafe_arena_set_allocated_unlogged_reply(::dsnet::signedunrep::proto::UnloggedReplyMessage* unlogged_reply) {
+  clear_msg();
+  if (unlogged_reply) {
+    set_has_unlogged_reply();
+    _impl_.msg_.unlogged_reply_ = unlogged_reply;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:dsnet.signedunrep.proto.ToClientMessage.unlogged_reply)
+}
+inline ::dsnet::signedunrep::proto::UnloggedReplyMessage* ToClientMessage::_internal_mutable_unlogged_reply() {
+  if (!_internal_has_unlogged_reply()) {
+    clear_msg();
+    set_has_unlogged_reply();
+    _impl_.msg_.unlogged_reply_ = CreateMaybeMessage< ::dsnet::signedunrep::proto::UnloggedReplyMessage >(GetArenaForAllocation());
+  }
+  return _impl_.msg_.unlogged_reply_;
+}
+inline ::dsnet::signedunrep::proto::UnloggedReplyMessage* ToClientMessage::mutable_unlogged_reply() {
+  ::dsnet::signedunrep::proto::UnloggedReplyMessage* _msg = _internal_mutable_unlogged_reply();
+  // @@protoc_insertion_point(field_mutable:dsnet.signedunrep.proto.ToClientMessage.unlogged_reply)
+  return _msg;
+}
+
+inline bool ToClientMessage::has_msg() const {
+  return msg_case() != MSG_NOT_SET;
+}
+inline void ToClientMessage::clear_has_msg() {
+  _impl_._oneof_case_[0] = MSG_NOT_SET;
+}
+inline ToClientMessage::MsgCase ToClientMessage::msg_case() const {
+  return ToClientMessage::MsgCase(_impl_._oneof_case_[0]);
+}
+#ifdef __GNUC__
+  #pragma GCC diagnostic pop
+#endif  // __GNUC__
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+
+// @@protoc_insertion_point(namespace_scope)
+
+}  // namespace proto
+}  // namespace signedunrep
+}  // namespace dsnet
+
+// @@protoc_insertion_point(global_scope)
+
+#include <google/protobuf/port_undef.inc>
+#endif  // GOOGLE_PROTOBUF_INCLUDED_GOOGLE_PROTOBUF_INCLUDED_replication_2fsignedunrep_2fsignedunrep_2dproto_2eproto
@@ -0,0 +1,5595 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: replication/spec/spec-proto.proto
+
+#include "replication/spec/spec-proto.pb.h"
+
+#include <algorithm>
+
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/extension_set.h>
+#include <google/protobuf/wire_format_lite.h>
+#include <google/protobuf/descriptor.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/reflection_ops.h>
+#include <google/protobuf/wire_format.h>
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+
+PROTOBUF_PRAGMA_INIT_SEG
+
+namespace _pb = ::PROTOBUF_NAMESPACE_ID;
+namespace _pbi = _pb::internal;
+
+namespace dsnet {
+namespace spec {
+namespace proto {
+PROTOBUF_CONSTEXPR SpeculativeReplyMessage::SpeculativeReplyMessage(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.loghash_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.reply_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.clientreqid_)*/uint64_t{0u}
+  , /*decltype(_impl_.view_)*/uint64_t{0u}
+  , /*decltype(_impl_.opnum_)*/uint64_t{0u}
+  , /*decltype(_impl_.replicaidx_)*/0u
+  , /*decltype(_impl_.committed_)*/false} {}
+struct SpeculativeReplyMessageDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR SpeculativeReplyMessageDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~SpeculativeReplyMessageDefaultTypeInternal() {}
+  union {
+    SpeculativeReplyMessage _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 SpeculativeReplyMessageDefaultTypeInternal _SpeculativeReplyMessage_default_instance_;
+PROTOBUF_CONSTEXPR UnloggedReplyMessage::UnloggedReplyMessage(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.reply_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}} {}
+struct UnloggedReplyMessageDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR UnloggedReplyMessageDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~UnloggedReplyMessageDefaultTypeInternal() {}
+  union {
+    UnloggedReplyMessage _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 UnloggedReplyMessageDefaultTypeInternal _UnloggedReplyMessage_default_instance_;
+PROTOBUF_CONSTEXPR ToClientMessage::ToClientMessage(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.msg_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_._oneof_case_)*/{}} {}
+struct ToClientMessageDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ToClientMessageDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ToClientMessageDefaultTypeInternal() {}
+  union {
+    ToClientMessage _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ToClientMessageDefaultTypeInternal _ToClientMessage_default_instance_;
+PROTOBUF_CONSTEXPR RequestMessage::RequestMessage(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.req_)*/nullptr} {}
+struct RequestMessageDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR RequestMessageDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~RequestMessageDefaultTypeInternal() {}
+  union {
+    RequestMessage _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 RequestMessageDefaultTypeInternal _RequestMessage_default_instance_;
+PROTOBUF_CONSTEXPR UnloggedRequestMessage::UnloggedRequestMessage(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.req_)*/nullptr} {}
+struct UnloggedRequestMessageDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR UnloggedRequestMessageDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~UnloggedRequestMessageDefaultTypeInternal() {}
+  union {
+    UnloggedRequestMessage _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 UnloggedRequestMessageDefaultTypeInternal _UnloggedRequestMessage_default_instance_;
+PROTOBUF_CONSTEXPR SyncMessage::SyncMessage(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.lastcommittedhash_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.view_)*/uint64_t{0u}
+  , /*decltype(_impl_.lastcommitted_)*/uint64_t{0u}
+  , /*decltype(_impl_.lastspeculative_)*/uint64_t{0u}} {}
+struct SyncMessageDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR SyncMessageDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~SyncMessageDefaultTypeInternal() {}
+  union {
+    SyncMessage _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 SyncMessageDefaultTypeInternal _SyncMessage_default_instance_;
+PROTOBUF_CONSTEXPR SyncReplyMessage::SyncReplyMessage(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.lastspeculativehash_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.view_)*/uint64_t{0u}
+  , /*decltype(_impl_.lastspeculative_)*/uint64_t{0u}
+  , /*decltype(_impl_.replicaidx_)*/0u} {}
+struct SyncReplyMessageDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR SyncReplyMessageDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~SyncReplyMessageDefaultTypeInternal() {}
+  union {
+    SyncReplyMessage _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 SyncReplyMessageDefaultTypeInternal _SyncReplyMessage_default_instance_;
+PROTOBUF_CONSTEXPR RequestViewChangeMessage::RequestViewChangeMessage(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.view_)*/uint64_t{0u}} {}
+struct RequestViewChangeMessageDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR RequestViewChangeMessageDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~RequestViewChangeMessageDefaultTypeInternal() {}
+  union {
+    RequestViewChangeMessage _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 RequestViewChangeMessageDefaultTypeInternal _RequestViewChangeMessage_default_instance_;
+PROTOBUF_CONSTEXPR StartViewChangeMessage::StartViewChangeMessage(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.view_)*/uint64_t{0u}
+  , /*decltype(_impl_.lastcommitted_)*/uint64_t{0u}
+  , /*decltype(_impl_.replicaidx_)*/0u} {}
+struct StartViewChangeMessageDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR StartViewChangeMessageDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~StartViewChangeMessageDefaultTypeInternal() {}
+  union {
+    StartViewChangeMessage _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 StartViewChangeMessageDefaultTypeInternal _StartViewChangeMessage_default_instance_;
+PROTOBUF_CONSTEXPR DoViewChangeMessage::DoViewChangeMessage(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.entries_)*/{}
+  , /*decltype(_impl_.view_)*/uint64_t{0u}
+  , /*decltype(_impl_.lastnormalview_)*/uint64_t{0u}
+  , /*decltype(_impl_.lastspeculative_)*/uint64_t{0u}
+  , /*decltype(_impl_.lastcommitted_)*/uint64_t{0u}
+  , /*decltype(_impl_.replicaidx_)*/0u} {}
+struct DoViewChangeMessageDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR DoViewChangeMessageDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~DoViewChangeMessageDefaultTypeInternal() {}
+  union {
+    DoViewChangeMessage _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 DoViewChangeMessageDefaultTypeInternal _DoViewChangeMessage_default_instance_;
+PROTOBUF_CONSTEXPR StartViewMessage::StartViewMessage(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.entries_)*/{}
+  , /*decltype(_impl_.view_)*/uint64_t{0u}
+  , /*decltype(_impl_.lastspeculative_)*/uint64_t{0u}
+  , /*decltype(_impl_.lastcommitted_)*/uint64_t{0u}} {}
+struct StartViewMessageDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR StartViewMessageDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~StartViewMessageDefaultTypeInternal() {}
+  union {
+    StartViewMessage _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 StartViewMessageDefaultTypeInternal _StartViewMessage_default_instance_;
+PROTOBUF_CONSTEXPR InViewMessage::InViewMessage(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.view_)*/uint64_t{0u}
+  , /*decltype(_impl_.lastspeculative_)*/uint64_t{0u}
+  , /*decltype(_impl_.replicaidx_)*/0u} {}
+struct InViewMessageDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR InViewMessageDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~InViewMessageDefaultTypeInternal() {}
+  union {
+    InViewMessage _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 InViewMessageDefaultTypeInternal _InViewMessage_default_instance_;
+PROTOBUF_CONSTEXPR FillLogGapMessage::FillLogGapMessage(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.view_)*/uint64_t{0u}
+  , /*decltype(_impl_.lastcommitted_)*/uint64_t{0u}} {}
+struct FillLogGapMessageDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR FillLogGapMessageDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~FillLogGapMessageDefaultTypeInternal() {}
+  union {
+    FillLogGapMessage _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 FillLogGapMessageDefaultTypeInternal _FillLogGapMessage_default_instance_;
+PROTOBUF_CONSTEXPR FillDVCGapMessage::FillDVCGapMessage(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.view_)*/uint64_t{0u}
+  , /*decltype(_impl_.lastcommitted_)*/uint64_t{0u}} {}
+struct FillDVCGapMessageDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR FillDVCGapMessageDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~FillDVCGapMessageDefaultTypeInternal() {}
+  union {
+    FillDVCGapMessage _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 FillDVCGapMessageDefaultTypeInternal _FillDVCGapMessage_default_instance_;
+PROTOBUF_CONSTEXPR ToReplicaMessage::ToReplicaMessage(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.msg_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_._oneof_case_)*/{}} {}
+struct ToReplicaMessageDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ToReplicaMessageDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ToReplicaMessageDefaultTypeInternal() {}
+  union {
+    ToReplicaMessage _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ToReplicaMessageDefaultTypeInternal _ToReplicaMessage_default_instance_;
+}  // namespace proto
+}  // namespace spec
+}  // namespace dsnet
+static ::_pb::Metadata file_level_metadata_replication_2fspec_2fspec_2dproto_2eproto[15];
+static constexpr ::_pb::EnumDescriptor const** file_level_enum_descriptors_replication_2fspec_2fspec_2dproto_2eproto = nullptr;
+static constexpr ::_pb::ServiceDescriptor const** file_level_service_descriptors_replication_2fspec_2fspec_2dproto_2eproto = nullptr;
+
+const uint32_t TableStruct_replication_2fspec_2fspec_2dproto_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  PROTOBUF_FIELD_OFFSET(::dsnet::spec::proto::SpeculativeReplyMessage, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::spec::proto::SpeculativeReplyMessage, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::dsnet::spec::proto::SpeculativeReplyMessage, _impl_.clientreqid_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::spec::proto::SpeculativeReplyMessage, _impl_.replicaidx_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::spec::proto::SpeculativeReplyMessage, _impl_.view_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::spec::proto::SpeculativeReplyMessage, _impl_.opnum_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::spec::proto::SpeculativeReplyMessage, _impl_.loghash_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::spec::proto::SpeculativeReplyMessage, _impl_.reply_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::spec::proto::SpeculativeReplyMessage, _impl_.committed_),
+  2,
+  5,
+  3,
+  4,
+  0,
+  1,
+  6,
+  PROTOBUF_FIELD_OFFSET(::dsnet::spec::proto::UnloggedReplyMessage, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::spec::proto::UnloggedReplyMessage, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::dsnet::spec::proto::UnloggedReplyMessage, _impl_.reply_),
+  0,
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::dsnet::spec::proto::ToClientMessage, _internal_metadata_),
+  ~0u,  // no _extensions_
+  PROTOBUF_FIELD_OFFSET(::dsnet::spec::proto::ToClientMessage, _impl_._oneof_case_[0]),
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  PROTOBUF_FIELD_OFFSET(::dsnet::spec::proto::ToClientMessage, _impl_.msg_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::spec::proto::RequestMessage, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::spec::proto::RequestMessage, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::dsnet::spec::proto::RequestMessage, _impl_.req_),
+  0,
+  PROTOBUF_FIELD_OFFSET(::dsnet::spec::proto::UnloggedRequestMessage, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::spec::proto::UnloggedRequestMessage, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::dsnet::spec::proto::UnloggedRequestMessage, _impl_.req_),
+  0,
+  PROTOBUF_FIELD_OFFSET(::dsnet::spec::proto::SyncMessage, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::spec::proto::SyncMessage, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::dsnet::spec::proto::SyncMessage, _impl_.view_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::spec::proto::SyncMessage, _impl_.lastcommitted_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::spec::proto::SyncMessage, _impl_.lastcommittedhash_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::spec::proto::SyncMessage, _impl_.lastspeculative_),
+  1,
+  2,
+  0,
+  3,
+  PROTOBUF_FIELD_OFFSET(::dsnet::spec::proto::SyncReplyMessage, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::spec::proto::SyncReplyMessage, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::dsnet::spec::proto::SyncReplyMessage, _impl_.view_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::spec::proto::SyncReplyMessage, _impl_.lastspeculative_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::spec::proto::SyncReplyMessage, _impl_.lastspeculativehash_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::spec::proto::SyncReplyMessage, _impl_.replicaidx_),
+  1,
+  2,
+  0,
+  3,
+  PROTOBUF_FIELD_OFFSET(::dsnet::spec::proto::RequestViewChangeMessage, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::spec::proto::RequestViewChangeMessage, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::dsnet::spec::proto::RequestViewChangeMessage, _impl_.view_),
+  0,
+  PROTOBUF_FIELD_OFFSET(::dsnet::spec::proto::StartViewChangeMessage, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::spec::proto::StartViewChangeMessage, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::dsnet::spec::proto::StartViewChangeMessage, _impl_.view_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::spec::proto::StartViewChangeMessage, _impl_.replicaidx_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::spec::proto::StartViewChangeMessage, _impl_.lastcommitted_),
+  0,
+  2,
+  1,
+  PROTOBUF_FIELD_OFFSET(::dsnet::spec::proto::DoViewChangeMessage, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::spec::proto::DoViewChangeMessage, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::dsnet::spec::proto::DoViewChangeMessage, _impl_.view_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::spec::proto::DoViewChangeMessage, _impl_.lastnormalview_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::spec::proto::DoViewChangeMessage, _impl_.lastspeculative_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::spec::proto::DoViewChangeMessage, _impl_.lastcommitted_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::spec::proto::DoViewChangeMessage, _impl_.entries_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::spec::proto::DoViewChangeMessage, _impl_.replicaidx_),
+  0,
+  1,
+  2,
+  3,
+  ~0u,
+  4,
+  PROTOBUF_FIELD_OFFSET(::dsnet::spec::proto::StartViewMessage, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::spec::proto::StartViewMessage, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::dsnet::spec::proto::StartViewMessage, _impl_.view_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::spec::proto::StartViewMessage, _impl_.lastspeculative_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::spec::proto::StartViewMessage, _impl_.lastcommitted_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::spec::proto::StartViewMessage, _impl_.entries_),
+  0,
+  1,
+  2,
+  ~0u,
+  PROTOBUF_FIELD_OFFSET(::dsnet::spec::proto::InViewMessage, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::spec::proto::InViewMessage, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::dsnet::spec::proto::InViewMessage, _impl_.view_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::spec::proto::InViewMessage, _impl_.lastspeculative_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::spec::proto::InViewMessage, _impl_.replicaidx_),
+  0,
+  1,
+  2,
+  PROTOBUF_FIELD_OFFSET(::dsnet::spec::proto::FillLogGapMessage, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::spec::proto::FillLogGapMessage, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::dsnet::spec::proto::FillLogGapMessage, _impl_.view_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::spec::proto::FillLogGapMessage, _impl_.lastcommitted_),
+  0,
+  1,
+  PROTOBUF_FIELD_OFFSET(::dsnet::spec::proto::FillDVCGapMessage, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::spec::proto::FillDVCGapMessage, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::dsnet::spec::proto::FillDVCGapMessage, _impl_.view_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::spec::proto::FillDVCGapMessage, _impl_.lastcommitted_),
+  0,
+  1,
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::dsnet::spec::proto::ToReplicaMessage, _internal_metadata_),
+  ~0u,  // no _extensions_
+  PROTOBUF_FIELD_OFFSET(::dsnet::spec::proto::ToReplicaMessage, _impl_._oneof_case_[0]),
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  PROTOBUF_FIELD_OFFSET(::dsnet::spec::proto::ToReplicaMessage, _impl_.msg_),
+};
+static const ::_pbi::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  { 0, 13, -1, sizeof(::dsnet::spec::proto::SpeculativeReplyMessage)},
+  { 20, 27, -1, sizeof(::dsnet::spec::proto::UnloggedReplyMessage)},
+  { 28, -1, -1, sizeof(::dsnet::spec::proto::ToClientMessage)},
+  { 37, 44, -1, sizeof(::dsnet::spec::proto::RequestMessage)},
+  { 45, 52, -1, sizeof(::dsnet::spec::proto::UnloggedRequestMessage)},
+  { 53, 63, -1, sizeof(::dsnet::spec::proto::SyncMessage)},
+  { 67, 77, -1, sizeof(::dsnet::spec::proto::SyncReplyMessage)},
+  { 81, 88, -1, sizeof(::dsnet::spec::proto::RequestViewChangeMessage)},
+  { 89, 98, -1, sizeof(::dsnet::spec::proto::StartViewChangeMessage)},
+  { 101, 113, -1, sizeof(::dsnet::spec::proto::DoViewChangeMessage)},
+  { 119, 129, -1, sizeof(::dsnet::spec::proto::StartViewMessage)},
+  { 133, 142, -1, sizeof(::dsnet::spec::proto::InViewMessage)},
+  { 145, 153, -1, sizeof(::dsnet::spec::proto::FillLogGapMessage)},
+  { 155, 163, -1, sizeof(::dsnet::spec::proto::FillDVCGapMessage)},
+  { 165, -1, -1, sizeof(::dsnet::spec::proto::ToReplicaMessage)},
+};
+
+static const ::_pb::Message* const file_default_instances[] = {
+  &::dsnet::spec::proto::_SpeculativeReplyMessage_default_instance_._instance,
+  &::dsnet::spec::proto::_UnloggedReplyMessage_default_instance_._instance,
+  &::dsnet::spec::proto::_ToClientMessage_default_instance_._instance,
+  &::dsnet::spec::proto::_RequestMessage_default_instance_._instance,
+  &::dsnet::spec::proto::_UnloggedRequestMessage_default_instance_._instance,
+  &::dsnet::spec::proto::_SyncMessage_default_instance_._instance,
+  &::dsnet::spec::proto::_SyncReplyMessage_default_instance_._instance,
+  &::dsnet::spec::proto::_RequestViewChangeMessage_default_instance_._instance,
+  &::dsnet::spec::proto::_StartViewChangeMessage_default_instance_._instance,
+  &::dsnet::spec::proto::_DoViewChangeMessage_default_instance_._instance,
+  &::dsnet::spec::proto::_StartViewMessage_default_instance_._instance,
+  &::dsnet::spec::proto::_InViewMessage_default_instance_._instance,
+  &::dsnet::spec::proto::_FillLogGapMessage_default_instance_._instance,
+  &::dsnet::spec::proto::_FillDVCGapMessage_default_instance_._instance,
+  &::dsnet::spec::proto::_ToReplicaMessage_default_instance_._instance,
+};
+
+const char descriptor_table_protodef_replication_2fspec_2fspec_2dproto_2eproto[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) =
+  "\n!replication/spec/spec-proto.proto\022\020dsn"
+  "et.spec.proto\032\024common/request.proto\"\222\001\n\027"
+  "SpeculativeReplyMessage\022\023\n\013clientreqid\030\001"
+  " \002(\004\022\022\n\nreplicaidx\030\002 \002(\r\022\014\n\004view\030\003 \002(\004\022\r"
+  "\n\005opnum\030\004 \002(\004\022\017\n\007loghash\030\005 \002(\014\022\r\n\005reply\030"
+  "\006 \002(\014\022\021\n\tcommitted\030\007 \002(\010\"%\n\024UnloggedRepl"
+  "yMessage\022\r\n\005reply\030\001 \002(\014\"\226\001\n\017ToClientMess"
+  "age\022:\n\005reply\030\001 \001(\0132).dsnet.spec.proto.Sp"
+  "eculativeReplyMessageH\000\022@\n\016unlogged_repl"
+  "y\030\002 \001(\0132&.dsnet.spec.proto.UnloggedReply"
+  "MessageH\000B\005\n\003msg\"-\n\016RequestMessage\022\033\n\003re"
+  "q\030\001 \002(\0132\016.dsnet.Request\"=\n\026UnloggedReque"
+  "stMessage\022#\n\003req\030\001 \002(\0132\026.dsnet.UnloggedR"
+  "equest\"f\n\013SyncMessage\022\014\n\004view\030\001 \002(\004\022\025\n\rl"
+  "astCommitted\030\002 \001(\004\022\031\n\021lastCommittedHash\030"
+  "\003 \001(\014\022\027\n\017lastSpeculative\030\004 \001(\004\"j\n\020SyncRe"
+  "plyMessage\022\014\n\004view\030\001 \002(\004\022\027\n\017lastSpeculat"
+  "ive\030\002 \002(\004\022\033\n\023lastSpeculativeHash\030\003 \002(\014\022\022"
+  "\n\nreplicaidx\030\004 \002(\r\"(\n\030RequestViewChangeM"
+  "essage\022\014\n\004view\030\001 \002(\004\"Q\n\026StartViewChangeM"
+  "essage\022\014\n\004view\030\001 \002(\004\022\022\n\nreplicaIdx\030\002 \002(\r"
+  "\022\025\n\rlastCommitted\030\003 \002(\004\"\244\001\n\023DoViewChange"
+  "Message\022\014\n\004view\030\001 \002(\004\022\026\n\016lastNormalView\030"
+  "\002 \002(\004\022\027\n\017lastSpeculative\030\003 \002(\004\022\025\n\rlastCo"
+  "mmitted\030\004 \002(\004\022#\n\007entries\030\005 \003(\0132\022.dsnet.M"
+  "sgLogEntry\022\022\n\nreplicaIdx\030\006 \002(\r\"u\n\020StartV"
+  "iewMessage\022\014\n\004view\030\001 \002(\004\022\027\n\017lastSpeculat"
+  "ive\030\002 \002(\004\022\025\n\rlastCommitted\030\003 \002(\004\022#\n\007entr"
+  "ies\030\004 \003(\0132\022.dsnet.MsgLogEntry\"J\n\rInViewM"
+  "essage\022\014\n\004view\030\001 \002(\004\022\027\n\017lastSpeculative\030"
+  "\002 \002(\004\022\022\n\nreplicaIdx\030\003 \002(\r\"8\n\021FillLogGapM"
+  "essage\022\014\n\004view\030\001 \002(\004\022\025\n\rlastCommitted\030\002 "
+  "\002(\004\"8\n\021FillDVCGapMessage\022\014\n\004view\030\001 \002(\004\022\025"
+  "\n\rlastCommitted\030\002 \002(\004\"\270\005\n\020ToReplicaMessa"
+  "ge\0223\n\007request\030\001 \001(\0132 .dsnet.spec.proto.R"
+  "equestMessageH\000\022D\n\020unlogged_request\030\002 \001("
+  "\0132(.dsnet.spec.proto.UnloggedRequestMess"
+  "ageH\000\022-\n\004sync\030\003 \001(\0132\035.dsnet.spec.proto.S"
+  "yncMessageH\000\0228\n\nsync_reply\030\004 \001(\0132\".dsnet"
+  ".spec.proto.SyncReplyMessageH\000\022I\n\023reques"
+  "t_view_change\030\005 \001(\0132*.dsnet.spec.proto.R"
+  "equestViewChangeMessageH\000\022E\n\021start_view_"
+  "change\030\006 \001(\0132(.dsnet.spec.proto.StartVie"
+  "wChangeMessageH\000\022\?\n\016do_view_change\030\007 \001(\013"
+  "2%.dsnet.spec.proto.DoViewChangeMessageH"
+  "\000\0228\n\nstart_view\030\010 \001(\0132\".dsnet.spec.proto"
+  ".StartViewMessageH\000\0222\n\007in_view\030\t \001(\0132\037.d"
+  "snet.spec.proto.InViewMessageH\000\022;\n\014fill_"
+  "log_gap\030\n \001(\0132#.dsnet.spec.proto.FillLog"
+  "GapMessageH\000\022;\n\014fill_dvc_gap\030\013 \001(\0132#.dsn"
+  "et.spec.proto.FillDVCGapMessageH\000B\005\n\003msg"
+  ;
+static const ::_pbi::DescriptorTable* const descriptor_table_replication_2fspec_2fspec_2dproto_2eproto_deps[1] = {
+  &::descriptor_table_common_2frequest_2eproto,
+};
+static ::_pbi::once_flag descriptor_table_replication_2fspec_2fspec_2dproto_2eproto_once;
+const ::_pbi::DescriptorTable descriptor_table_replication_2fspec_2fspec_2dproto_2eproto = {
+    false, false, 2040, descriptor_table_protodef_replication_2fspec_2fspec_2dproto_2eproto,
+    "replication/spec/spec-proto.proto",
+    &descriptor_table_replication_2fspec_2fspec_2dproto_2eproto_once, descriptor_table_replication_2fspec_2fspec_2dproto_2eproto_deps, 1, 15,
+    schemas, file_default_instances, TableStruct_replication_2fspec_2fspec_2dproto_2eproto::offsets,
+    file_level_metadata_replication_2fspec_2fspec_2dproto_2eproto, file_level_enum_descriptors_replication_2fspec_2fspec_2dproto_2eproto,
+    file_level_service_descriptors_replication_2fspec_2fspec_2dproto_2eproto,
+};
+PROTOBUF_ATTRIBUTE_WEAK const ::_pbi::DescriptorTable* descriptor_table_replication_2fspec_2fspec_2dproto_2eproto_getter() {
+  return &descriptor_table_replication_2fspec_2fspec_2dproto_2eproto;
+}
+
+// Force running AddDescriptors() at dynamic initialization time.
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 static ::_pbi::AddDescriptorsRunner dynamic_init_dummy_replication_2fspec_2fspec_2dproto_2eproto(&descriptor_table_replication_2fspec_2fspec_2dproto_2eproto);
+namespace dsnet {
+namespace spec {
+namespace proto {
+
+// ===================================================================
+
+class SpeculativeReplyMessage::_Internal {
+ public:
+  using HasBits = decltype(std::declval<SpeculativeReplyMessage>()._impl_._has_bits_);
+  static void set_has_clientreqid(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static void set_has_replicaidx(HasBits* has_bits) {
+    (*has_bits)[0] |= 32u;
+  }
+  static void set_has_view(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+  static void set_has_opnum(HasBits* has_bits) {
+    (*has_bits)[0] |= 16u;
+  }
+  static void set_has_loghash(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_reply(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_committed(HasBits* has_bits) {
+    (*has_bits)[0] |= 64u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x0000007f) ^ 0x0000007f) != 0;
+  }
+};
+
+SpeculativeReplyMessage::SpeculativeReplyMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:dsnet.spec.proto.SpeculativeReplyMessage)
+}
+SpeculativeReplyMessage::SpeculativeReplyMessage(const SpeculativeReplyMessage& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  SpeculativeReplyMessage* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.loghash_){}
+    , decltype(_impl_.reply_){}
+    , decltype(_impl_.clientreqid_){}
+    , decltype(_impl_.view_){}
+    , decltype(_impl_.opnum_){}
+    , decltype(_impl_.replicaidx_){}
+    , decltype(_impl_.committed_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.loghash_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.loghash_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_loghash()) {
+    _this->_impl_.loghash_.Set(from._internal_loghash(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.reply_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.reply_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_reply()) {
+    _this->_impl_.reply_.Set(from._internal_reply(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.clientreqid_, &from._impl_.clientreqid_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.committed_) -
+    reinterpret_cast<char*>(&_impl_.clientreqid_)) + sizeof(_impl_.committed_));
+  // @@protoc_insertion_point(copy_constructor:dsnet.spec.proto.SpeculativeReplyMessage)
+}
+
+inline void SpeculativeReplyMessage::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.loghash_){}
+    , decltype(_impl_.reply_){}
+    , decltype(_impl_.clientreqid_){uint64_t{0u}}
+    , decltype(_impl_.view_){uint64_t{0u}}
+    , decltype(_impl_.opnum_){uint64_t{0u}}
+    , decltype(_impl_.replicaidx_){0u}
+    , decltype(_impl_.committed_){false}
+  };
+  _impl_.loghash_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.loghash_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.reply_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.reply_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+SpeculativeReplyMessage::~SpeculativeReplyMessage() {
+  // @@protoc_insertion_point(destructor:dsnet.spec.proto.SpeculativeReplyMessage)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void SpeculativeReplyMessage::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.loghash_.Destroy();
+  _impl_.reply_.Destroy();
+}
+
+void SpeculativeReplyMessage::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void SpeculativeReplyMessage::Clear() {
+// @@protoc_insertion_point(message_clear_start:dsnet.spec.proto.SpeculativeReplyMessage)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      _impl_.loghash_.ClearNonDefaultToEmpty();
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _impl_.reply_.ClearNonDefaultToEmpty();
+    }
+  }
+  if (cached_has_bits & 0x0000007cu) {
+    ::memset(&_impl_.clientreqid_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.committed_) -
+        reinterpret_cast<char*>(&_impl_.clientreqid_)) + sizeof(_impl_.committed_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* SpeculativeReplyMessage::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required uint64 clientreqid = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_clientreqid(&has_bits);
+          _impl_.clientreqid_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required uint32 replicaidx = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _Internal::set_has_replicaidx(&has_bits);
+          _impl_.replicaidx_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required uint64 view = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _Internal::set_has_view(&has_bits);
+          _impl_.view_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required uint64 opnum = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _Internal::set_has_opnum(&has_bits);
+          _impl_.opnum_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required bytes loghash = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 42)) {
+          auto str = _internal_mutable_loghash();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required bytes reply = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 50)) {
+          auto str = _internal_mutable_reply();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required bool committed = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 56)) {
+          _Internal::set_has_committed(&has_bits);
+          _impl_.committed_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* SpeculativeReplyMessage::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:dsnet.spec.proto.SpeculativeReplyMessage)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required uint64 clientreqid = 1;
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(1, this->_internal_clientreqid(), target);
+  }
+
+  // required uint32 replicaidx = 2;
+  if (cached_has_bits & 0x00000020u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(2, this->_internal_replicaidx(), target);
+  }
+
+  // required uint64 view = 3;
+  if (cached_has_bits & 0x00000008u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(3, this->_internal_view(), target);
+  }
+
+  // required uint64 opnum = 4;
+  if (cached_has_bits & 0x00000010u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(4, this->_internal_opnum(), target);
+  }
+
+  // required bytes loghash = 5;
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->WriteBytesMaybeAliased(
+        5, this->_internal_loghash(), target);
+  }
+
+  // required bytes reply = 6;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->WriteBytesMaybeAliased(
+        6, this->_internal_reply(), target);
+  }
+
+  // required bool committed = 7;
+  if (cached_has_bits & 0x00000040u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(7, this->_internal_committed(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:dsnet.spec.proto.SpeculativeReplyMessage)
+  return target;
+}
+
+size_t SpeculativeReplyMessage::RequiredFieldsByteSizeFallback() const {
+// @@protoc_insertion_point(required_fields_byte_size_fallback_start:dsnet.spec.proto.SpeculativeReplyMessage)
+  size_t total_size = 0;
+
+  if (_internal_has_loghash()) {
+    // required bytes loghash = 5;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_loghash());
+  }
+
+  if (_internal_has_reply()) {
+    // required bytes reply = 6;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_reply());
+  }
+
+  if (_internal_has_clientreqid()) {
+    // required uint64 clientreqid = 1;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_clientreqid());
+  }
+
+  if (_internal_has_view()) {
+    // required uint64 view = 3;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_view());
+  }
+
+  if (_internal_has_opnum()) {
+    // required uint64 opnum = 4;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_opnum());
+  }
+
+  if (_internal_has_replicaidx()) {
+    // required uint32 replicaidx = 2;
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_replicaidx());
+  }
+
+  if (_internal_has_committed()) {
+    // required bool committed = 7;
+    total_size += 1 + 1;
+  }
+
+  return total_size;
+}
+size_t SpeculativeReplyMessage::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:dsnet.spec.proto.SpeculativeReplyMessage)
+  size_t total_size = 0;
+
+  if (((_impl_._has_bits_[0] & 0x0000007f) ^ 0x0000007f) == 0) {  // All required fields are present.
+    // required bytes loghash = 5;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_loghash());
+
+    // required bytes reply = 6;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_reply());
+
+    // required uint64 clientreqid = 1;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_clientreqid());
+
+    // required uint64 view = 3;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_view());
+
+    // required uint64 opnum = 4;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_opnum());
+
+    // required uint32 replicaidx = 2;
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_replicaidx());
+
+    // required bool committed = 7;
+    total_size += 1 + 1;
+
+  } else {
+    total_size += RequiredFieldsByteSizeFallback();
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData SpeculativeReplyMessage::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    SpeculativeReplyMessage::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*SpeculativeReplyMessage::GetClassData() const { return &_class_data_; }
+
+
+void SpeculativeReplyMessage::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<SpeculativeReplyMessage*>(&to_msg);
+  auto& from = static_cast<const SpeculativeReplyMessage&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:dsnet.spec.proto.SpeculativeReplyMessage)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000007fu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_loghash(from._internal_loghash());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_internal_set_reply(from._internal_reply());
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.clientreqid_ = from._impl_.clientreqid_;
+    }
+    if (cached_has_bits & 0x00000008u) {
+      _this->_impl_.view_ = from._impl_.view_;
+    }
+    if (cached_has_bits & 0x00000010u) {
+      _this->_impl_.opnum_ = from._impl_.opnum_;
+    }
+    if (cached_has_bits & 0x00000020u) {
+      _this->_impl_.replicaidx_ = from._impl_.replicaidx_;
+    }
+    if (cached_has_bits & 0x00000040u) {
+      _this->_impl_.committed_ = from._impl_.committed_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void SpeculativeReplyMessage::CopyFrom(const SpeculativeReplyMessage& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:dsnet.spec.proto.SpeculativeReplyMessage)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool SpeculativeReplyMessage::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  return true;
+}
+
+void SpeculativeReplyMessage::InternalSwap(SpeculativeReplyMessage* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.loghash_, lhs_arena,
+      &other->_impl_.loghash_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.reply_, lhs_arena,
+      &other->_impl_.reply_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(SpeculativeReplyMessage, _impl_.committed_)
+      + sizeof(SpeculativeReplyMessage::_impl_.committed_)
+      - PROTOBUF_FIELD_OFFSET(SpeculativeReplyMessage, _impl_.clientreqid_)>(
+          reinterpret_cast<char*>(&_impl_.clientreqid_),
+          reinterpret_cast<char*>(&other->_impl_.clientreqid_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata SpeculativeReplyMessage::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_replication_2fspec_2fspec_2dproto_2eproto_getter, &descriptor_table_replication_2fspec_2fspec_2dproto_2eproto_once,
+      file_level_metadata_replication_2fspec_2fspec_2dproto_2eproto[0]);
+}
+
+// ===================================================================
+
+class UnloggedReplyMessage::_Internal {
+ public:
+  using HasBits = decltype(std::declval<UnloggedReplyMessage>()._impl_._has_bits_);
+  static void set_has_reply(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000001) ^ 0x00000001) != 0;
+  }
+};
+
+UnloggedReplyMessage::UnloggedReplyMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:dsnet.spec.proto.UnloggedReplyMessage)
+}
+UnloggedReplyMessage::UnloggedReplyMessage(const UnloggedReplyMessage& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  UnloggedReplyMessage* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.reply_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.reply_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.reply_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_reply()) {
+    _this->_impl_.reply_.Set(from._internal_reply(), 
+      _this->GetArenaForAllocation());
+  }
+  // @@protoc_insertion_point(copy_constructor:dsnet.spec.proto.UnloggedReplyMessage)
+}
+
+inline void UnloggedReplyMessage::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.reply_){}
+  };
+  _impl_.reply_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.reply_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+UnloggedReplyMessage::~UnloggedReplyMessage() {
+  // @@protoc_insertion_point(destructor:dsnet.spec.proto.UnloggedReplyMessage)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void UnloggedReplyMessage::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.reply_.Destroy();
+}
+
+void UnloggedReplyMessage::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void UnloggedReplyMessage::Clear() {
+// @@protoc_insertion_point(message_clear_start:dsnet.spec.proto.UnloggedReplyMessage)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    _impl_.reply_.ClearNonDefaultToEmpty();
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* UnloggedReplyMessage::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required bytes reply = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_reply();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* UnloggedReplyMessage::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:dsnet.spec.proto.UnloggedReplyMessage)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required bytes reply = 1;
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->WriteBytesMaybeAliased(
+        1, this->_internal_reply(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:dsnet.spec.proto.UnloggedReplyMessage)
+  return target;
+}
+
+size_t UnloggedReplyMessage::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:dsnet.spec.proto.UnloggedReplyMessage)
+  size_t total_size = 0;
+
+  // required bytes reply = 1;
+  if (_internal_has_reply()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_reply());
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData UnloggedReplyMessage::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    UnloggedReplyMessage::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*UnloggedReplyMessage::GetClassData() const { return &_class_data_; }
+
+
+void UnloggedReplyMessage::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<UnloggedReplyMessage*>(&to_msg);
+  auto& from = static_cast<const UnloggedReplyMessage&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:dsnet.spec.proto.UnloggedReplyMessage)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_has_reply()) {
+    _this->_internal_set_reply(from._internal_reply());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void UnloggedReplyMessage::CopyFrom(const UnloggedReplyMessage& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:dsnet.spec.proto.UnloggedReplyMessage)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool UnloggedReplyMessage::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  return true;
+}
+
+void UnloggedReplyMessage::InternalSwap(UnloggedReplyMessage* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.reply_, lhs_arena,
+      &other->_impl_.reply_, rhs_arena
+  );
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata UnloggedReplyMessage::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_replication_2fspec_2fspec_2dproto_2eproto_getter, &descriptor_table_replication_2fspec_2fspec_2dproto_2eproto_once,
+      file_level_metadata_replication_2fspec_2fspec_2dproto_2eproto[1]);
+}
+
+// ===================================================================
+
+class ToClientMessage::_Internal {
+ public:
+  static const ::dsnet::spec::proto::SpeculativeReplyMessage& reply(const ToClientMessage* msg);
+  static const ::dsnet::spec::proto::UnloggedReplyMessage& unlogged_reply(const ToClientMessage* msg);
+};
+
+const ::dsnet::spec::proto::SpeculativeReplyMessage&
+ToClientMessage::_Internal::reply(const ToClientMessage* msg) {
+  return *msg->_impl_.msg_.reply_;
+}
+const ::dsnet::spec::proto::UnloggedReplyMessage&
+ToClientMessage::_Internal::unlogged_reply(const ToClientMessage* msg) {
+  return *msg->_impl_.msg_.unlogged_reply_;
+}
+void ToClientMessage::set_allocated_reply(::dsnet::spec::proto::SpeculativeReplyMessage* reply) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  clear_msg();
+  if (reply) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(reply);
+    if (message_arena != submessage_arena) {
+      reply = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, reply, submessage_arena);
+    }
+    set_has_reply();
+    _impl_.msg_.reply_ = reply;
+  }
+  // @@protoc_insertion_point(field_set_allocated:dsnet.spec.proto.ToClientMessage.reply)
+}
+void ToClientMessage::set_allocated_unlogged_reply(::dsnet::spec::proto::UnloggedReplyMessage* unlogged_reply) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  clear_msg();
+  if (unlogged_reply) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(unlogged_reply);
+    if (message_arena != submessage_arena) {
+      unlogged_reply = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, unlogged_reply, submessage_arena);
+    }
+    set_has_unlogged_reply();
+    _impl_.msg_.unlogged_reply_ = unlogged_reply;
+  }
+  // @@protoc_insertion_point(field_set_allocated:dsnet.spec.proto.ToClientMessage.unlogged_reply)
+}
+ToClientMessage::ToClientMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:dsnet.spec.proto.ToClientMessage)
+}
+ToClientMessage::ToClientMessage(const ToClientMessage& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  ToClientMessage* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.msg_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , /*decltype(_impl_._oneof_case_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  clear_has_msg();
+  switch (from.msg_case()) {
+    case kReply: {
+      _this->_internal_mutable_reply()->::dsnet::spec::proto::SpeculativeReplyMessage::MergeFrom(
+          from._internal_reply());
+      break;
+    }
+    case kUnloggedReply: {
+      _this->_internal_mutable_unlogged_reply()->::dsnet::spec::proto::UnloggedReplyMessage::MergeFrom(
+          from._internal_unlogged_reply());
+      break;
+    }
+    case MSG_NOT_SET: {
+      break;
+    }
+  }
+  // @@protoc_insertion_point(copy_constructor:dsnet.spec.proto.ToClientMessage)
+}
+
+inline void ToClientMessage::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.msg_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , /*decltype(_impl_._oneof_case_)*/{}
+  };
+  clear_has_msg();
+}
+
+ToClientMessage::~ToClientMessage() {
+  // @@protoc_insertion_point(destructor:dsnet.spec.proto.ToClientMessage)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void ToClientMessage::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  if (has_msg()) {
+    clear_msg();
+  }
+}
+
+void ToClientMessage::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void ToClientMessage::clear_msg() {
+// @@protoc_insertion_point(one_of_clear_start:dsnet.spec.proto.ToClientMessage)
+  switch (msg_case()) {
+    case kReply: {
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.msg_.reply_;
+      }
+      break;
+    }
+    case kUnloggedReply: {
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.msg_.unlogged_reply_;
+      }
+      break;
+    }
+    case MSG_NOT_SET: {
+      break;
+    }
+  }
+  _impl_._oneof_case_[0] = MSG_NOT_SET;
+}
+
+
+void ToClientMessage::Clear() {
+// @@protoc_insertion_point(message_clear_start:dsnet.spec.proto.ToClientMessage)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  clear_msg();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* ToClientMessage::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // .dsnet.spec.proto.SpeculativeReplyMessage reply = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr = ctx->ParseMessage(_internal_mutable_reply(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .dsnet.spec.proto.UnloggedReplyMessage unlogged_reply = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr = ctx->ParseMessage(_internal_mutable_unlogged_reply(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* ToClientMessage::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:dsnet.spec.proto.ToClientMessage)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  switch (msg_case()) {
+    case kReply: {
+      target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(1, _Internal::reply(this),
+          _Internal::reply(this).GetCachedSize(), target, stream);
+      break;
+    }
+    case kUnloggedReply: {
+      target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(2, _Internal::unlogged_reply(this),
+          _Internal::unlogged_reply(this).GetCachedSize(), target, stream);
+      break;
+    }
+    default: ;
+  }
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:dsnet.spec.proto.ToClientMessage)
+  return target;
+}
+
+size_t ToClientMessage::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:dsnet.spec.proto.ToClientMessage)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  switch (msg_case()) {
+    // .dsnet.spec.proto.SpeculativeReplyMessage reply = 1;
+    case kReply: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.msg_.reply_);
+      break;
+    }
+    // .dsnet.spec.proto.UnloggedReplyMessage unlogged_reply = 2;
+    case kUnloggedReply: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.msg_.unlogged_reply_);
+      break;
+    }
+    case MSG_NOT_SET: {
+      break;
+    }
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ToClientMessage::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    ToClientMessage::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ToClientMessage::GetClassData() const { return &_class_data_; }
+
+
+void ToClientMessage::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<ToClientMessage*>(&to_msg);
+  auto& from = static_cast<const ToClientMessage&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:dsnet.spec.proto.ToClientMessage)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  switch (from.msg_case()) {
+    case kReply: {
+      _this->_internal_mutable_reply()->::dsnet::spec::proto::SpeculativeReplyMessage::MergeFrom(
+          from._internal_reply());
+      break;
+    }
+    case kUnloggedReply: {
+      _this->_internal_mutable_unlogged_reply()->::dsnet::spec::proto::UnloggedReplyMessage::MergeFrom(
+          from._internal_unlogged_reply());
+      break;
+    }
+    case MSG_NOT_SET: {
+      break;
+    }
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void ToClientMessage::CopyFrom(const ToClientMessage& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:dsnet.spec.proto.ToClientMessage)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool ToClientMessage::IsInitialized() const {
+  switch (msg_case()) {
+    case kReply: {
+      if (_internal_has_reply()) {
+        if (!_impl_.msg_.reply_->IsInitialized()) return false;
+      }
+      break;
+    }
+    case kUnloggedReply: {
+      if (_internal_has_unlogged_reply()) {
+        if (!_impl_.msg_.unlogged_reply_->IsInitialized()) return false;
+      }
+      break;
+    }
+    case MSG_NOT_SET: {
+      break;
+    }
+  }
+  return true;
+}
+
+void ToClientMessage::InternalSwap(ToClientMessage* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_.msg_, other->_impl_.msg_);
+  swap(_impl_._oneof_case_[0], other->_impl_._oneof_case_[0]);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata ToClientMessage::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_replication_2fspec_2fspec_2dproto_2eproto_getter, &descriptor_table_replication_2fspec_2fspec_2dproto_2eproto_once,
+      file_level_metadata_replication_2fspec_2fspec_2dproto_2eproto[2]);
+}
+
+// ===================================================================
+
+class RequestMessage::_Internal {
+ public:
+  using HasBits = decltype(std::declval<RequestMessage>()._impl_._has_bits_);
+  static const ::dsnet::Request& req(const RequestMessage* msg);
+  static void set_has_req(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000001) ^ 0x00000001) != 0;
+  }
+};
+
+const ::dsnet::Request&
+RequestMessage::_Internal::req(const RequestMessage* msg) {
+  return *msg->_impl_.req_;
+}
+void RequestMessage::clear_req() {
+  if (_impl_.req_ != nullptr) _impl_.req_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+RequestMessage::RequestMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:dsnet.spec.proto.RequestMessage)
+}
+RequestMessage::RequestMessage(const RequestMessage& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  RequestMessage* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.req_){nullptr}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  if (from._internal_has_req()) {
+    _this->_impl_.req_ = new ::dsnet::Request(*from._impl_.req_);
+  }
+  // @@protoc_insertion_point(copy_constructor:dsnet.spec.proto.RequestMessage)
+}
+
+inline void RequestMessage::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.req_){nullptr}
+  };
+}
+
+RequestMessage::~RequestMessage() {
+  // @@protoc_insertion_point(destructor:dsnet.spec.proto.RequestMessage)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void RequestMessage::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  if (this != internal_default_instance()) delete _impl_.req_;
+}
+
+void RequestMessage::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void RequestMessage::Clear() {
+// @@protoc_insertion_point(message_clear_start:dsnet.spec.proto.RequestMessage)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    GOOGLE_DCHECK(_impl_.req_ != nullptr);
+    _impl_.req_->Clear();
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* RequestMessage::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required .dsnet.Request req = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr = ctx->ParseMessage(_internal_mutable_req(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* RequestMessage::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:dsnet.spec.proto.RequestMessage)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required .dsnet.Request req = 1;
+  if (cached_has_bits & 0x00000001u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(1, _Internal::req(this),
+        _Internal::req(this).GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:dsnet.spec.proto.RequestMessage)
+  return target;
+}
+
+size_t RequestMessage::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:dsnet.spec.proto.RequestMessage)
+  size_t total_size = 0;
+
+  // required .dsnet.Request req = 1;
+  if (_internal_has_req()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.req_);
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData RequestMessage::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    RequestMessage::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*RequestMessage::GetClassData() const { return &_class_data_; }
+
+
+void RequestMessage::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<RequestMessage*>(&to_msg);
+  auto& from = static_cast<const RequestMessage&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:dsnet.spec.proto.RequestMessage)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_has_req()) {
+    _this->_internal_mutable_req()->::dsnet::Request::MergeFrom(
+        from._internal_req());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void RequestMessage::CopyFrom(const RequestMessage& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:dsnet.spec.proto.RequestMessage)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool RequestMessage::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  if (_internal_has_req()) {
+    if (!_impl_.req_->IsInitialized()) return false;
+  }
+  return true;
+}
+
+void RequestMessage::InternalSwap(RequestMessage* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  swap(_impl_.req_, other->_impl_.req_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata RequestMessage::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_replication_2fspec_2fspec_2dproto_2eproto_getter, &descriptor_table_replication_2fspec_2fspec_2dproto_2eproto_once,
+      file_level_metadata_replication_2fspec_2fspec_2dproto_2eproto[3]);
+}
+
+// ===================================================================
+
+class UnloggedRequestMessage::_Internal {
+ public:
+  using HasBits = decltype(std::declval<UnloggedRequestMessage>()._impl_._has_bits_);
+  static const ::dsnet::UnloggedRequest& req(const UnloggedRequestMessage* msg);
+  static void set_has_req(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000001) ^ 0x00000001) != 0;
+  }
+};
+
+const ::dsnet::UnloggedRequest&
+UnloggedRequestMessage::_Internal::req(const UnloggedRequestMessage* msg) {
+  return *msg->_impl_.req_;
+}
+void UnloggedRequestMessage::clear_req() {
+  if (_impl_.req_ != nullptr) _impl_.req_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+UnloggedRequestMessage::UnloggedRequestMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:dsnet.spec.proto.UnloggedRequestMessage)
+}
+UnloggedRequestMessage::UnloggedRequestMessage(const UnloggedRequestMessage& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  UnloggedRequestMessage* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.req_){nullptr}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  if (from._internal_has_req()) {
+    _this->_impl_.req_ = new ::dsnet::UnloggedRequest(*from._impl_.req_);
+  }
+  // @@protoc_insertion_point(copy_constructor:dsnet.spec.proto.UnloggedRequestMessage)
+}
+
+inline void UnloggedRequestMessage::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.req_){nullptr}
+  };
+}
+
+UnloggedRequestMessage::~UnloggedRequestMessage() {
+  // @@protoc_insertion_point(destructor:dsnet.spec.proto.UnloggedRequestMessage)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void UnloggedRequestMessage::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  if (this != internal_default_instance()) delete _impl_.req_;
+}
+
+void UnloggedRequestMessage::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void UnloggedRequestMessage::Clear() {
+// @@protoc_insertion_point(message_clear_start:dsnet.spec.proto.UnloggedRequestMessage)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    GOOGLE_DCHECK(_impl_.req_ != nullptr);
+    _impl_.req_->Clear();
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* UnloggedRequestMessage::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required .dsnet.UnloggedRequest req = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr = ctx->ParseMessage(_internal_mutable_req(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* UnloggedRequestMessage::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:dsnet.spec.proto.UnloggedRequestMessage)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required .dsnet.UnloggedRequest req = 1;
+  if (cached_has_bits & 0x00000001u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(1, _Internal::req(this),
+        _Internal::req(this).GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:dsnet.spec.proto.UnloggedRequestMessage)
+  return target;
+}
+
+size_t UnloggedRequestMessage::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:dsnet.spec.proto.UnloggedRequestMessage)
+  size_t total_size = 0;
+
+  // required .dsnet.UnloggedRequest req = 1;
+  if (_internal_has_req()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.req_);
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData UnloggedRequestMessage::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    UnloggedRequestMessage::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*UnloggedRequestMessage::GetClassData() const { return &_class_data_; }
+
+
+void UnloggedRequestMessage::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<UnloggedRequestMessage*>(&to_msg);
+  auto& from = static_cast<const UnloggedRequestMessage&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:dsnet.spec.proto.UnloggedRequestMessage)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_has_req()) {
+    _this->_internal_mutable_req()->::dsnet::UnloggedRequest::MergeFrom(
+        from._internal_req());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void UnloggedRequestMessage::CopyFrom(const UnloggedRequestMessage& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:dsnet.spec.proto.UnloggedRequestMessage)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool UnloggedRequestMessage::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  if (_internal_has_req()) {
+    if (!_impl_.req_->IsInitialized()) return false;
+  }
+  return true;
+}
+
+void UnloggedRequestMessage::InternalSwap(UnloggedRequestMessage* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  swap(_impl_.req_, other->_impl_.req_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata UnloggedRequestMessage::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_replication_2fspec_2fspec_2dproto_2eproto_getter, &descriptor_table_replication_2fspec_2fspec_2dproto_2eproto_once,
+      file_level_metadata_replication_2fspec_2fspec_2dproto_2eproto[4]);
+}
+
+// ===================================================================
+
+class SyncMessage::_Internal {
+ public:
+  using HasBits = decltype(std::declval<SyncMessage>()._impl_._has_bits_);
+  static void set_has_view(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_lastcommitted(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static void set_has_lastcommittedhash(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_lastspeculative(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000002) ^ 0x00000002) != 0;
+  }
+};
+
+SyncMessage::SyncMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:dsnet.spec.proto.SyncMessage)
+}
+SyncMessage::SyncMessage(const SyncMessage& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  SyncMessage* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.lastcommittedhash_){}
+    , decltype(_impl_.view_){}
+    , decltype(_impl_.lastcommitted_){}
+    , decltype(_impl_.lastspeculative_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.lastcommittedhash_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.lastcommittedhash_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_lastcommittedhash()) {
+    _this->_impl_.lastcommittedhash_.Set(from._internal_lastcommittedhash(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.view_, &from._impl_.view_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.lastspeculative_) -
+    reinterpret_cast<char*>(&_impl_.view_)) + sizeof(_impl_.lastspeculative_));
+  // @@protoc_insertion_point(copy_constructor:dsnet.spec.proto.SyncMessage)
+}
+
+inline void SyncMessage::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.lastcommittedhash_){}
+    , decltype(_impl_.view_){uint64_t{0u}}
+    , decltype(_impl_.lastcommitted_){uint64_t{0u}}
+    , decltype(_impl_.lastspeculative_){uint64_t{0u}}
+  };
+  _impl_.lastcommittedhash_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.lastcommittedhash_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+SyncMessage::~SyncMessage() {
+  // @@protoc_insertion_point(destructor:dsnet.spec.proto.SyncMessage)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void SyncMessage::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.lastcommittedhash_.Destroy();
+}
+
+void SyncMessage::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void SyncMessage::Clear() {
+// @@protoc_insertion_point(message_clear_start:dsnet.spec.proto.SyncMessage)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    _impl_.lastcommittedhash_.ClearNonDefaultToEmpty();
+  }
+  if (cached_has_bits & 0x0000000eu) {
+    ::memset(&_impl_.view_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.lastspeculative_) -
+        reinterpret_cast<char*>(&_impl_.view_)) + sizeof(_impl_.lastspeculative_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* SyncMessage::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required uint64 view = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_view(&has_bits);
+          _impl_.view_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint64 lastCommitted = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _Internal::set_has_lastcommitted(&has_bits);
+          _impl_.lastcommitted_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional bytes lastCommittedHash = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          auto str = _internal_mutable_lastcommittedhash();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint64 lastSpeculative = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _Internal::set_has_lastspeculative(&has_bits);
+          _impl_.lastspeculative_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* SyncMessage::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:dsnet.spec.proto.SyncMessage)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required uint64 view = 1;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(1, this->_internal_view(), target);
+  }
+
+  // optional uint64 lastCommitted = 2;
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(2, this->_internal_lastcommitted(), target);
+  }
+
+  // optional bytes lastCommittedHash = 3;
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->WriteBytesMaybeAliased(
+        3, this->_internal_lastcommittedhash(), target);
+  }
+
+  // optional uint64 lastSpeculative = 4;
+  if (cached_has_bits & 0x00000008u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(4, this->_internal_lastspeculative(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:dsnet.spec.proto.SyncMessage)
+  return target;
+}
+
+size_t SyncMessage::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:dsnet.spec.proto.SyncMessage)
+  size_t total_size = 0;
+
+  // required uint64 view = 1;
+  if (_internal_has_view()) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_view());
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // optional bytes lastCommittedHash = 3;
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_lastcommittedhash());
+  }
+
+  if (cached_has_bits & 0x0000000cu) {
+    // optional uint64 lastCommitted = 2;
+    if (cached_has_bits & 0x00000004u) {
+      total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_lastcommitted());
+    }
+
+    // optional uint64 lastSpeculative = 4;
+    if (cached_has_bits & 0x00000008u) {
+      total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_lastspeculative());
+    }
+
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData SyncMessage::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    SyncMessage::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*SyncMessage::GetClassData() const { return &_class_data_; }
+
+
+void SyncMessage::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<SyncMessage*>(&to_msg);
+  auto& from = static_cast<const SyncMessage&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:dsnet.spec.proto.SyncMessage)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000000fu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_lastcommittedhash(from._internal_lastcommittedhash());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.view_ = from._impl_.view_;
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.lastcommitted_ = from._impl_.lastcommitted_;
+    }
+    if (cached_has_bits & 0x00000008u) {
+      _this->_impl_.lastspeculative_ = from._impl_.lastspeculative_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void SyncMessage::CopyFrom(const SyncMessage& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:dsnet.spec.proto.SyncMessage)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool SyncMessage::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  return true;
+}
+
+void SyncMessage::InternalSwap(SyncMessage* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.lastcommittedhash_, lhs_arena,
+      &other->_impl_.lastcommittedhash_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(SyncMessage, _impl_.lastspeculative_)
+      + sizeof(SyncMessage::_impl_.lastspeculative_)
+      - PROTOBUF_FIELD_OFFSET(SyncMessage, _impl_.view_)>(
+          reinterpret_cast<char*>(&_impl_.view_),
+          reinterpret_cast<char*>(&other->_impl_.view_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata SyncMessage::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_replication_2fspec_2fspec_2dproto_2eproto_getter, &descriptor_table_replication_2fspec_2fspec_2dproto_2eproto_once,
+      file_level_metadata_replication_2fspec_2fspec_2dproto_2eproto[5]);
+}
+
+// ===================================================================
+
+class SyncReplyMessage::_Internal {
+ public:
+  using HasBits = decltype(std::declval<SyncReplyMessage>()._impl_._has_bits_);
+  static void set_has_view(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_lastspeculative(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static void set_has_lastspeculativehash(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_replicaidx(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x0000000f) ^ 0x0000000f) != 0;
+  }
+};
+
+SyncReplyMessage::SyncReplyMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:dsnet.spec.proto.SyncReplyMessage)
+}
+SyncReplyMessage::SyncReplyMessage(const SyncReplyMessage& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  SyncReplyMessage* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.lastspeculativehash_){}
+    , decltype(_impl_.view_){}
+    , decltype(_impl_.lastspeculative_){}
+    , decltype(_impl_.replicaidx_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.lastspeculativehash_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.lastspeculativehash_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_lastspeculativehash()) {
+    _this->_impl_.lastspeculativehash_.Set(from._internal_lastspeculativehash(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.view_, &from._impl_.view_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.replicaidx_) -
+    reinterpret_cast<char*>(&_impl_.view_)) + sizeof(_impl_.replicaidx_));
+  // @@protoc_insertion_point(copy_constructor:dsnet.spec.proto.SyncReplyMessage)
+}
+
+inline void SyncReplyMessage::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.lastspeculativehash_){}
+    , decltype(_impl_.view_){uint64_t{0u}}
+    , decltype(_impl_.lastspeculative_){uint64_t{0u}}
+    , decltype(_impl_.replicaidx_){0u}
+  };
+  _impl_.lastspeculativehash_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.lastspeculativehash_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+SyncReplyMessage::~SyncReplyMessage() {
+  // @@protoc_insertion_point(destructor:dsnet.spec.proto.SyncReplyMessage)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void SyncReplyMessage::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.lastspeculativehash_.Destroy();
+}
+
+void SyncReplyMessage::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void SyncReplyMessage::Clear() {
+// @@protoc_insertion_point(message_clear_start:dsnet.spec.proto.SyncReplyMessage)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    _impl_.lastspeculativehash_.ClearNonDefaultToEmpty();
+  }
+  if (cached_has_bits & 0x0000000eu) {
+    ::memset(&_impl_.view_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.replicaidx_) -
+        reinterpret_cast<char*>(&_impl_.view_)) + sizeof(_impl_.replicaidx_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* SyncReplyMessage::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required uint64 view = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_view(&has_bits);
+          _impl_.view_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required uint64 lastSpeculative = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _Internal::set_has_lastspeculative(&has_bits);
+          _impl_.lastspeculative_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required bytes lastSpeculativeHash = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          auto str = _internal_mutable_lastspeculativehash();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required uint32 replicaidx = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _Internal::set_has_replicaidx(&has_bits);
+          _impl_.replicaidx_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* SyncReplyMessage::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:dsnet.spec.proto.SyncReplyMessage)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required uint64 view = 1;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(1, this->_internal_view(), target);
+  }
+
+  // required uint64 lastSpeculative = 2;
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(2, this->_internal_lastspeculative(), target);
+  }
+
+  // required bytes lastSpeculativeHash = 3;
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->WriteBytesMaybeAliased(
+        3, this->_internal_lastspeculativehash(), target);
+  }
+
+  // required uint32 replicaidx = 4;
+  if (cached_has_bits & 0x00000008u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(4, this->_internal_replicaidx(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:dsnet.spec.proto.SyncReplyMessage)
+  return target;
+}
+
+size_t SyncReplyMessage::RequiredFieldsByteSizeFallback() const {
+// @@protoc_insertion_point(required_fields_byte_size_fallback_start:dsnet.spec.proto.SyncReplyMessage)
+  size_t total_size = 0;
+
+  if (_internal_has_lastspeculativehash()) {
+    // required bytes lastSpeculativeHash = 3;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_lastspeculativehash());
+  }
+
+  if (_internal_has_view()) {
+    // required uint64 view = 1;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_view());
+  }
+
+  if (_internal_has_lastspeculative()) {
+    // required uint64 lastSpeculative = 2;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_lastspeculative());
+  }
+
+  if (_internal_has_replicaidx()) {
+    // required uint32 replicaidx = 4;
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_replicaidx());
+  }
+
+  return total_size;
+}
+size_t SyncReplyMessage::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:dsnet.spec.proto.SyncReplyMessage)
+  size_t total_size = 0;
+
+  if (((_impl_._has_bits_[0] & 0x0000000f) ^ 0x0000000f) == 0) {  // All required fields are present.
+    // required bytes lastSpeculativeHash = 3;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_lastspeculativehash());
+
+    // required uint64 view = 1;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_view());
+
+    // required uint64 lastSpeculative = 2;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_lastspeculative());
+
+    // required uint32 replicaidx = 4;
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_replicaidx());
+
+  } else {
+    total_size += RequiredFieldsByteSizeFallback();
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData SyncReplyMessage::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    SyncReplyMessage::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*SyncReplyMessage::GetClassData() const { return &_class_data_; }
+
+
+void SyncReplyMessage::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<SyncReplyMessage*>(&to_msg);
+  auto& from = static_cast<const SyncReplyMessage&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:dsnet.spec.proto.SyncReplyMessage)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000000fu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_lastspeculativehash(from._internal_lastspeculativehash());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.view_ = from._impl_.view_;
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.lastspeculative_ = from._impl_.lastspeculative_;
+    }
+    if (cached_has_bits & 0x00000008u) {
+      _this->_impl_.replicaidx_ = from._impl_.replicaidx_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void SyncReplyMessage::CopyFrom(const SyncReplyMessage& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:dsnet.spec.proto.SyncReplyMessage)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool SyncReplyMessage::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  return true;
+}
+
+void SyncReplyMessage::InternalSwap(SyncReplyMessage* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.lastspeculativehash_, lhs_arena,
+      &other->_impl_.lastspeculativehash_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(SyncReplyMessage, _impl_.replicaidx_)
+      + sizeof(SyncReplyMessage::_impl_.replicaidx_)
+      - PROTOBUF_FIELD_OFFSET(SyncReplyMessage, _impl_.view_)>(
+          reinterpret_cast<char*>(&_impl_.view_),
+          reinterpret_cast<char*>(&other->_impl_.view_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata SyncReplyMessage::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_replication_2fspec_2fspec_2dproto_2eproto_getter, &descriptor_table_replication_2fspec_2fspec_2dproto_2eproto_once,
+      file_level_metadata_replication_2fspec_2fspec_2dproto_2eproto[6]);
+}
+
+// ===================================================================
+
+class RequestViewChangeMessage::_Internal {
+ public:
+  using HasBits = decltype(std::declval<RequestViewChangeMessage>()._impl_._has_bits_);
+  static void set_has_view(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000001) ^ 0x00000001) != 0;
+  }
+};
+
+RequestViewChangeMessage::RequestViewChangeMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:dsnet.spec.proto.RequestViewChangeMessage)
+}
+RequestViewChangeMessage::RequestViewChangeMessage(const RequestViewChangeMessage& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  RequestViewChangeMessage* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.view_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _this->_impl_.view_ = from._impl_.view_;
+  // @@protoc_insertion_point(copy_constructor:dsnet.spec.proto.RequestViewChangeMessage)
+}
+
+inline void RequestViewChangeMessage::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.view_){uint64_t{0u}}
+  };
+}
+
+RequestViewChangeMessage::~RequestViewChangeMessage() {
+  // @@protoc_insertion_point(destructor:dsnet.spec.proto.RequestViewChangeMessage)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void RequestViewChangeMessage::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void RequestViewChangeMessage::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void RequestViewChangeMessage::Clear() {
+// @@protoc_insertion_point(message_clear_start:dsnet.spec.proto.RequestViewChangeMessage)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.view_ = uint64_t{0u};
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* RequestViewChangeMessage::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required uint64 view = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_view(&has_bits);
+          _impl_.view_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* RequestViewChangeMessage::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:dsnet.spec.proto.RequestViewChangeMessage)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required uint64 view = 1;
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(1, this->_internal_view(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:dsnet.spec.proto.RequestViewChangeMessage)
+  return target;
+}
+
+size_t RequestViewChangeMessage::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:dsnet.spec.proto.RequestViewChangeMessage)
+  size_t total_size = 0;
+
+  // required uint64 view = 1;
+  if (_internal_has_view()) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_view());
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData RequestViewChangeMessage::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    RequestViewChangeMessage::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*RequestViewChangeMessage::GetClassData() const { return &_class_data_; }
+
+
+void RequestViewChangeMessage::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<RequestViewChangeMessage*>(&to_msg);
+  auto& from = static_cast<const RequestViewChangeMessage&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:dsnet.spec.proto.RequestViewChangeMessage)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_has_view()) {
+    _this->_internal_set_view(from._internal_view());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void RequestViewChangeMessage::CopyFrom(const RequestViewChangeMessage& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:dsnet.spec.proto.RequestViewChangeMessage)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool RequestViewChangeMessage::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  return true;
+}
+
+void RequestViewChangeMessage::InternalSwap(RequestViewChangeMessage* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  swap(_impl_.view_, other->_impl_.view_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata RequestViewChangeMessage::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_replication_2fspec_2fspec_2dproto_2eproto_getter, &descriptor_table_replication_2fspec_2fspec_2dproto_2eproto_once,
+      file_level_metadata_replication_2fspec_2fspec_2dproto_2eproto[7]);
+}
+
+// ===================================================================
+
+class StartViewChangeMessage::_Internal {
+ public:
+  using HasBits = decltype(std::declval<StartViewChangeMessage>()._impl_._has_bits_);
+  static void set_has_view(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_replicaidx(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static void set_has_lastcommitted(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000007) ^ 0x00000007) != 0;
+  }
+};
+
+StartViewChangeMessage::StartViewChangeMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:dsnet.spec.proto.StartViewChangeMessage)
+}
+StartViewChangeMessage::StartViewChangeMessage(const StartViewChangeMessage& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  StartViewChangeMessage* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.view_){}
+    , decltype(_impl_.lastcommitted_){}
+    , decltype(_impl_.replicaidx_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.view_, &from._impl_.view_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.replicaidx_) -
+    reinterpret_cast<char*>(&_impl_.view_)) + sizeof(_impl_.replicaidx_));
+  // @@protoc_insertion_point(copy_constructor:dsnet.spec.proto.StartViewChangeMessage)
+}
+
+inline void StartViewChangeMessage::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.view_){uint64_t{0u}}
+    , decltype(_impl_.lastcommitted_){uint64_t{0u}}
+    , decltype(_impl_.replicaidx_){0u}
+  };
+}
+
+StartViewChangeMessage::~StartViewChangeMessage() {
+  // @@protoc_insertion_point(destructor:dsnet.spec.proto.StartViewChangeMessage)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void StartViewChangeMessage::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void StartViewChangeMessage::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void StartViewChangeMessage::Clear() {
+// @@protoc_insertion_point(message_clear_start:dsnet.spec.proto.StartViewChangeMessage)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    ::memset(&_impl_.view_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.replicaidx_) -
+        reinterpret_cast<char*>(&_impl_.view_)) + sizeof(_impl_.replicaidx_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* StartViewChangeMessage::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required uint64 view = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_view(&has_bits);
+          _impl_.view_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required uint32 replicaIdx = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _Internal::set_has_replicaidx(&has_bits);
+          _impl_.replicaidx_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required uint64 lastCommitted = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _Internal::set_has_lastcommitted(&has_bits);
+          _impl_.lastcommitted_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* StartViewChangeMessage::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:dsnet.spec.proto.StartViewChangeMessage)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required uint64 view = 1;
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(1, this->_internal_view(), target);
+  }
+
+  // required uint32 replicaIdx = 2;
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(2, this->_internal_replicaidx(), target);
+  }
+
+  // required uint64 lastCommitted = 3;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(3, this->_internal_lastcommitted(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:dsnet.spec.proto.StartViewChangeMessage)
+  return target;
+}
+
+size_t StartViewChangeMessage::RequiredFieldsByteSizeFallback() const {
+// @@protoc_insertion_point(required_fields_byte_size_fallback_start:dsnet.spec.proto.StartViewChangeMessage)
+  size_t total_size = 0;
+
+  if (_internal_has_view()) {
+    // required uint64 view = 1;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_view());
+  }
+
+  if (_internal_has_lastcommitted()) {
+    // required uint64 lastCommitted = 3;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_lastcommitted());
+  }
+
+  if (_internal_has_replicaidx()) {
+    // required uint32 replicaIdx = 2;
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_replicaidx());
+  }
+
+  return total_size;
+}
+size_t StartViewChangeMessage::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:dsnet.spec.proto.StartViewChangeMessage)
+  size_t total_size = 0;
+
+  if (((_impl_._has_bits_[0] & 0x00000007) ^ 0x00000007) == 0) {  // All required fields are present.
+    // required uint64 view = 1;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_view());
+
+    // required uint64 lastCommitted = 3;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_lastcommitted());
+
+    // required uint32 replicaIdx = 2;
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_replicaidx());
+
+  } else {
+    total_size += RequiredFieldsByteSizeFallback();
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData StartViewChangeMessage::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    StartViewChangeMessage::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*StartViewChangeMessage::GetClassData() const { return &_class_data_; }
+
+
+void StartViewChangeMessage::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<StartViewChangeMessage*>(&to_msg);
+  auto& from = static_cast<const StartViewChangeMessage&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:dsnet.spec.proto.StartViewChangeMessage)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_impl_.view_ = from._impl_.view_;
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.lastcommitted_ = from._impl_.lastcommitted_;
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.replicaidx_ = from._impl_.replicaidx_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void StartViewChangeMessage::CopyFrom(const StartViewChangeMessage& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:dsnet.spec.proto.StartViewChangeMessage)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool StartViewChangeMessage::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  return true;
+}
+
+void StartViewChangeMessage::InternalSwap(StartViewChangeMessage* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(StartViewChangeMessage, _impl_.replicaidx_)
+      + sizeof(StartViewChangeMessage::_impl_.replicaidx_)
+      - PROTOBUF_FIELD_OFFSET(StartViewChangeMessage, _impl_.view_)>(
+          reinterpret_cast<char*>(&_impl_.view_),
+          reinterpret_cast<char*>(&other->_impl_.view_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata StartViewChangeMessage::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_replication_2fspec_2fspec_2dproto_2eproto_getter, &descriptor_table_replication_2fspec_2fspec_2dproto_2eproto_once,
+      file_level_metadata_replication_2fspec_2fspec_2dproto_2eproto[8]);
+}
+
+// ===================================================================
+
+class DoViewChangeMessage::_Internal {
+ public:
+  using HasBits = decltype(std::declval<DoViewChangeMessage>()._impl_._has_bits_);
+  static void set_has_view(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_lastnormalview(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_lastspeculative(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static void set_has_lastcommitted(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+  static void set_has_replicaidx(HasBits* has_bits) {
+    (*has_bits)[0] |= 16u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x0000001f) ^ 0x0000001f) != 0;
+  }
+};
+
+void DoViewChangeMessage::clear_entries() {
+  _impl_.entries_.Clear();
+}
+DoViewChangeMessage::DoViewChangeMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:dsnet.spec.proto.DoViewChangeMessage)
+}
+DoViewChangeMessage::DoViewChangeMessage(const DoViewChangeMessage& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  DoViewChangeMessage* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.entries_){from._impl_.entries_}
+    , decltype(_impl_.view_){}
+    , decltype(_impl_.lastnormalview_){}
+    , decltype(_impl_.lastspeculative_){}
+    , decltype(_impl_.lastcommitted_){}
+    , decltype(_impl_.replicaidx_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.view_, &from._impl_.view_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.replicaidx_) -
+    reinterpret_cast<char*>(&_impl_.view_)) + sizeof(_impl_.replicaidx_));
+  // @@protoc_insertion_point(copy_constructor:dsnet.spec.proto.DoViewChangeMessage)
+}
+
+inline void DoViewChangeMessage::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.entries_){arena}
+    , decltype(_impl_.view_){uint64_t{0u}}
+    , decltype(_impl_.lastnormalview_){uint64_t{0u}}
+    , decltype(_impl_.lastspeculative_){uint64_t{0u}}
+    , decltype(_impl_.lastcommitted_){uint64_t{0u}}
+    , decltype(_impl_.replicaidx_){0u}
+  };
+}
+
+DoViewChangeMessage::~DoViewChangeMessage() {
+  // @@protoc_insertion_point(destructor:dsnet.spec.proto.DoViewChangeMessage)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void DoViewChangeMessage::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.entries_.~RepeatedPtrField();
+}
+
+void DoViewChangeMessage::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void DoViewChangeMessage::Clear() {
+// @@protoc_insertion_point(message_clear_start:dsnet.spec.proto.DoViewChangeMessage)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.entries_.Clear();
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000001fu) {
+    ::memset(&_impl_.view_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.replicaidx_) -
+        reinterpret_cast<char*>(&_impl_.view_)) + sizeof(_impl_.replicaidx_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* DoViewChangeMessage::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required uint64 view = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_view(&has_bits);
+          _impl_.view_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required uint64 lastNormalView = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _Internal::set_has_lastnormalview(&has_bits);
+          _impl_.lastnormalview_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required uint64 lastSpeculative = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _Internal::set_has_lastspeculative(&has_bits);
+          _impl_.lastspeculative_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required uint64 lastCommitted = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _Internal::set_has_lastcommitted(&has_bits);
+          _impl_.lastcommitted_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .dsnet.MsgLogEntry entries = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 42)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_entries(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<42>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // required uint32 replicaIdx = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 48)) {
+          _Internal::set_has_replicaidx(&has_bits);
+          _impl_.replicaidx_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* DoViewChangeMessage::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:dsnet.spec.proto.DoViewChangeMessage)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required uint64 view = 1;
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(1, this->_internal_view(), target);
+  }
+
+  // required uint64 lastNormalView = 2;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(2, this->_internal_lastnormalview(), target);
+  }
+
+  // required uint64 lastSpeculative = 3;
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(3, this->_internal_lastspeculative(), target);
+  }
+
+  // required uint64 lastCommitted = 4;
+  if (cached_has_bits & 0x00000008u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(4, this->_internal_lastcommitted(), target);
+  }
+
+  // repeated .dsnet.MsgLogEntry entries = 5;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_entries_size()); i < n; i++) {
+    const auto& repfield = this->_internal_entries(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(5, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  // required uint32 replicaIdx = 6;
+  if (cached_has_bits & 0x00000010u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(6, this->_internal_replicaidx(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:dsnet.spec.proto.DoViewChangeMessage)
+  return target;
+}
+
+size_t DoViewChangeMessage::RequiredFieldsByteSizeFallback() const {
+// @@protoc_insertion_point(required_fields_byte_size_fallback_start:dsnet.spec.proto.DoViewChangeMessage)
+  size_t total_size = 0;
+
+  if (_internal_has_view()) {
+    // required uint64 view = 1;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_view());
+  }
+
+  if (_internal_has_lastnormalview()) {
+    // required uint64 lastNormalView = 2;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_lastnormalview());
+  }
+
+  if (_internal_has_lastspeculative()) {
+    // required uint64 lastSpeculative = 3;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_lastspeculative());
+  }
+
+  if (_internal_has_lastcommitted()) {
+    // required uint64 lastCommitted = 4;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_lastcommitted());
+  }
+
+  if (_internal_has_replicaidx()) {
+    // required uint32 replicaIdx = 6;
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_replicaidx());
+  }
+
+  return total_size;
+}
+size_t DoViewChangeMessage::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:dsnet.spec.proto.DoViewChangeMessage)
+  size_t total_size = 0;
+
+  if (((_impl_._has_bits_[0] & 0x0000001f) ^ 0x0000001f) == 0) {  // All required fields are present.
+    // required uint64 view = 1;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_view());
+
+    // required uint64 lastNormalView = 2;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_lastnormalview());
+
+    // required uint64 lastSpeculative = 3;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_lastspeculative());
+
+    // required uint64 lastCommitted = 4;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_lastcommitted());
+
+    // required uint32 replicaIdx = 6;
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_replicaidx());
+
+  } else {
+    total_size += RequiredFieldsByteSizeFallback();
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .dsnet.MsgLogEntry entries = 5;
+  total_size += 1UL * this->_internal_entries_size();
+  for (const auto& msg : this->_impl_.entries_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData DoViewChangeMessage::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    DoViewChangeMessage::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*DoViewChangeMessage::GetClassData() const { return &_class_data_; }
+
+
+void DoViewChangeMessage::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<DoViewChangeMessage*>(&to_msg);
+  auto& from = static_cast<const DoViewChangeMessage&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:dsnet.spec.proto.DoViewChangeMessage)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.entries_.MergeFrom(from._impl_.entries_);
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000001fu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_impl_.view_ = from._impl_.view_;
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.lastnormalview_ = from._impl_.lastnormalview_;
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.lastspeculative_ = from._impl_.lastspeculative_;
+    }
+    if (cached_has_bits & 0x00000008u) {
+      _this->_impl_.lastcommitted_ = from._impl_.lastcommitted_;
+    }
+    if (cached_has_bits & 0x00000010u) {
+      _this->_impl_.replicaidx_ = from._impl_.replicaidx_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void DoViewChangeMessage::CopyFrom(const DoViewChangeMessage& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:dsnet.spec.proto.DoViewChangeMessage)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool DoViewChangeMessage::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  if (!::PROTOBUF_NAMESPACE_ID::internal::AllAreInitialized(_impl_.entries_))
+    return false;
+  return true;
+}
+
+void DoViewChangeMessage::InternalSwap(DoViewChangeMessage* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  _impl_.entries_.InternalSwap(&other->_impl_.entries_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(DoViewChangeMessage, _impl_.replicaidx_)
+      + sizeof(DoViewChangeMessage::_impl_.replicaidx_)
+      - PROTOBUF_FIELD_OFFSET(DoViewChangeMessage, _impl_.view_)>(
+          reinterpret_cast<char*>(&_impl_.view_),
+          reinterpret_cast<char*>(&other->_impl_.view_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata DoViewChangeMessage::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_replication_2fspec_2fspec_2dproto_2eproto_getter, &descriptor_table_replication_2fspec_2fspec_2dproto_2eproto_once,
+      file_level_metadata_replication_2fspec_2fspec_2dproto_2eproto[9]);
+}
+
+// ===================================================================
+
+class StartViewMessage::_Internal {
+ public:
+  using HasBits = decltype(std::declval<StartViewMessage>()._impl_._has_bits_);
+  static void set_has_view(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_lastspeculative(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_lastcommitted(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000007) ^ 0x00000007) != 0;
+  }
+};
+
+void StartViewMessage::clear_entries() {
+  _impl_.entries_.Clear();
+}
+StartViewMessage::StartViewMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:dsnet.spec.proto.StartViewMessage)
+}
+StartViewMessage::StartViewMessage(const StartViewMessage& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  StartViewMessage* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.entries_){from._impl_.entries_}
+    , decltype(_impl_.view_){}
+    , decltype(_impl_.lastspeculative_){}
+    , decltype(_impl_.lastcommitted_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.view_, &from._impl_.view_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.lastcommitted_) -
+    reinterpret_cast<char*>(&_impl_.view_)) + sizeof(_impl_.lastcommitted_));
+  // @@protoc_insertion_point(copy_constructor:dsnet.spec.proto.StartViewMessage)
+}
+
+inline void StartViewMessage::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.entries_){arena}
+    , decltype(_impl_.view_){uint64_t{0u}}
+    , decltype(_impl_.lastspeculative_){uint64_t{0u}}
+    , decltype(_impl_.lastcommitted_){uint64_t{0u}}
+  };
+}
+
+StartViewMessage::~StartViewMessage() {
+  // @@protoc_insertion_point(destructor:dsnet.spec.proto.StartViewMessage)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void StartViewMessage::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.entries_.~RepeatedPtrField();
+}
+
+void StartViewMessage::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void StartViewMessage::Clear() {
+// @@protoc_insertion_point(message_clear_start:dsnet.spec.proto.StartViewMessage)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.entries_.Clear();
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    ::memset(&_impl_.view_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.lastcommitted_) -
+        reinterpret_cast<char*>(&_impl_.view_)) + sizeof(_impl_.lastcommitted_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* StartViewMessage::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required uint64 view = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_view(&has_bits);
+          _impl_.view_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required uint64 lastSpeculative = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _Internal::set_has_lastspeculative(&has_bits);
+          _impl_.lastspeculative_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required uint64 lastCommitted = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _Internal::set_has_lastcommitted(&has_bits);
+          _impl_.lastcommitted_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .dsnet.MsgLogEntry entries = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_entries(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<34>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* StartViewMessage::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:dsnet.spec.proto.StartViewMessage)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required uint64 view = 1;
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(1, this->_internal_view(), target);
+  }
+
+  // required uint64 lastSpeculative = 2;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(2, this->_internal_lastspeculative(), target);
+  }
+
+  // required uint64 lastCommitted = 3;
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(3, this->_internal_lastcommitted(), target);
+  }
+
+  // repeated .dsnet.MsgLogEntry entries = 4;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_entries_size()); i < n; i++) {
+    const auto& repfield = this->_internal_entries(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(4, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:dsnet.spec.proto.StartViewMessage)
+  return target;
+}
+
+size_t StartViewMessage::RequiredFieldsByteSizeFallback() const {
+// @@protoc_insertion_point(required_fields_byte_size_fallback_start:dsnet.spec.proto.StartViewMessage)
+  size_t total_size = 0;
+
+  if (_internal_has_view()) {
+    // required uint64 view = 1;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_view());
+  }
+
+  if (_internal_has_lastspeculative()) {
+    // required uint64 lastSpeculative = 2;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_lastspeculative());
+  }
+
+  if (_internal_has_lastcommitted()) {
+    // required uint64 lastCommitted = 3;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_lastcommitted());
+  }
+
+  return total_size;
+}
+size_t StartViewMessage::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:dsnet.spec.proto.StartViewMessage)
+  size_t total_size = 0;
+
+  if (((_impl_._has_bits_[0] & 0x00000007) ^ 0x00000007) == 0) {  // All required fields are present.
+    // required uint64 view = 1;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_view());
+
+    // required uint64 lastSpeculative = 2;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_lastspeculative());
+
+    // required uint64 lastCommitted = 3;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_lastcommitted());
+
+  } else {
+    total_size += RequiredFieldsByteSizeFallback();
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .dsnet.MsgLogEntry entries = 4;
+  total_size += 1UL * this->_internal_entries_size();
+  for (const auto& msg : this->_impl_.entries_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData StartViewMessage::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    StartViewMessage::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*StartViewMessage::GetClassData() const { return &_class_data_; }
+
+
+void StartViewMessage::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<StartViewMessage*>(&to_msg);
+  auto& from = static_cast<const StartViewMessage&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:dsnet.spec.proto.StartViewMessage)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.entries_.MergeFrom(from._impl_.entries_);
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_impl_.view_ = from._impl_.view_;
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.lastspeculative_ = from._impl_.lastspeculative_;
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.lastcommitted_ = from._impl_.lastcommitted_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void StartViewMessage::CopyFrom(const StartViewMessage& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:dsnet.spec.proto.StartViewMessage)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool StartViewMessage::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  if (!::PROTOBUF_NAMESPACE_ID::internal::AllAreInitialized(_impl_.entries_))
+    return false;
+  return true;
+}
+
+void StartViewMessage::InternalSwap(StartViewMessage* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  _impl_.entries_.InternalSwap(&other->_impl_.entries_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(StartViewMessage, _impl_.lastcommitted_)
+      + sizeof(StartViewMessage::_impl_.lastcommitted_)
+      - PROTOBUF_FIELD_OFFSET(StartViewMessage, _impl_.view_)>(
+          reinterpret_cast<char*>(&_impl_.view_),
+          reinterpret_cast<char*>(&other->_impl_.view_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata StartViewMessage::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_replication_2fspec_2fspec_2dproto_2eproto_getter, &descriptor_table_replication_2fspec_2fspec_2dproto_2eproto_once,
+      file_level_metadata_replication_2fspec_2fspec_2dproto_2eproto[10]);
+}
+
+// ===================================================================
+
+class InViewMessage::_Internal {
+ public:
+  using HasBits = decltype(std::declval<InViewMessage>()._impl_._has_bits_);
+  static void set_has_view(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_lastspeculative(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_replicaidx(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000007) ^ 0x00000007) != 0;
+  }
+};
+
+InViewMessage::InViewMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:dsnet.spec.proto.InViewMessage)
+}
+InViewMessage::InViewMessage(const InViewMessage& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  InViewMessage* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.view_){}
+    , decltype(_impl_.lastspeculative_){}
+    , decltype(_impl_.replicaidx_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.view_, &from._impl_.view_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.replicaidx_) -
+    reinterpret_cast<char*>(&_impl_.view_)) + sizeof(_impl_.replicaidx_));
+  // @@protoc_insertion_point(copy_constructor:dsnet.spec.proto.InViewMessage)
+}
+
+inline void InViewMessage::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.view_){uint64_t{0u}}
+    , decltype(_impl_.lastspeculative_){uint64_t{0u}}
+    , decltype(_impl_.replicaidx_){0u}
+  };
+}
+
+InViewMessage::~InViewMessage() {
+  // @@protoc_insertion_point(destructor:dsnet.spec.proto.InViewMessage)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void InViewMessage::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void InViewMessage::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void InViewMessage::Clear() {
+// @@protoc_insertion_point(message_clear_start:dsnet.spec.proto.InViewMessage)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    ::memset(&_impl_.view_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.replicaidx_) -
+        reinterpret_cast<char*>(&_impl_.view_)) + sizeof(_impl_.replicaidx_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* InViewMessage::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required uint64 view = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_view(&has_bits);
+          _impl_.view_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required uint64 lastSpeculative = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _Internal::set_has_lastspeculative(&has_bits);
+          _impl_.lastspeculative_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required uint32 replicaIdx = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _Internal::set_has_replicaidx(&has_bits);
+          _impl_.replicaidx_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* InViewMessage::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:dsnet.spec.proto.InViewMessage)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required uint64 view = 1;
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(1, this->_internal_view(), target);
+  }
+
+  // required uint64 lastSpeculative = 2;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(2, this->_internal_lastspeculative(), target);
+  }
+
+  // required uint32 replicaIdx = 3;
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(3, this->_internal_replicaidx(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:dsnet.spec.proto.InViewMessage)
+  return target;
+}
+
+size_t InViewMessage::RequiredFieldsByteSizeFallback() const {
+// @@protoc_insertion_point(required_fields_byte_size_fallback_start:dsnet.spec.proto.InViewMessage)
+  size_t total_size = 0;
+
+  if (_internal_has_view()) {
+    // required uint64 view = 1;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_view());
+  }
+
+  if (_internal_has_lastspeculative()) {
+    // required uint64 lastSpeculative = 2;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_lastspeculative());
+  }
+
+  if (_internal_has_replicaidx()) {
+    // required uint32 replicaIdx = 3;
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_replicaidx());
+  }
+
+  return total_size;
+}
+size_t InViewMessage::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:dsnet.spec.proto.InViewMessage)
+  size_t total_size = 0;
+
+  if (((_impl_._has_bits_[0] & 0x00000007) ^ 0x00000007) == 0) {  // All required fields are present.
+    // required uint64 view = 1;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_view());
+
+    // required uint64 lastSpeculative = 2;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_lastspeculative());
+
+    // required uint32 replicaIdx = 3;
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_replicaidx());
+
+  } else {
+    total_size += RequiredFieldsByteSizeFallback();
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData InViewMessage::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    InViewMessage::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*InViewMessage::GetClassData() const { return &_class_data_; }
+
+
+void InViewMessage::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<InViewMessage*>(&to_msg);
+  auto& from = static_cast<const InViewMessage&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:dsnet.spec.proto.InViewMessage)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_impl_.view_ = from._impl_.view_;
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.lastspeculative_ = from._impl_.lastspeculative_;
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.replicaidx_ = from._impl_.replicaidx_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void InViewMessage::CopyFrom(const InViewMessage& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:dsnet.spec.proto.InViewMessage)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool InViewMessage::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  return true;
+}
+
+void InViewMessage::InternalSwap(InViewMessage* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(InViewMessage, _impl_.replicaidx_)
+      + sizeof(InViewMessage::_impl_.replicaidx_)
+      - PROTOBUF_FIELD_OFFSET(InViewMessage, _impl_.view_)>(
+          reinterpret_cast<char*>(&_impl_.view_),
+          reinterpret_cast<char*>(&other->_impl_.view_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata InViewMessage::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_replication_2fspec_2fspec_2dproto_2eproto_getter, &descriptor_table_replication_2fspec_2fspec_2dproto_2eproto_once,
+      file_level_metadata_replication_2fspec_2fspec_2dproto_2eproto[11]);
+}
+
+// ===================================================================
+
+class FillLogGapMessage::_Internal {
+ public:
+  using HasBits = decltype(std::declval<FillLogGapMessage>()._impl_._has_bits_);
+  static void set_has_view(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_lastcommitted(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000003) ^ 0x00000003) != 0;
+  }
+};
+
+FillLogGapMessage::FillLogGapMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:dsnet.spec.proto.FillLogGapMessage)
+}
+FillLogGapMessage::FillLogGapMessage(const FillLogGapMessage& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  FillLogGapMessage* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.view_){}
+    , decltype(_impl_.lastcommitted_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.view_, &from._impl_.view_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.lastcommitted_) -
+    reinterpret_cast<char*>(&_impl_.view_)) + sizeof(_impl_.lastcommitted_));
+  // @@protoc_insertion_point(copy_constructor:dsnet.spec.proto.FillLogGapMessage)
+}
+
+inline void FillLogGapMessage::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.view_){uint64_t{0u}}
+    , decltype(_impl_.lastcommitted_){uint64_t{0u}}
+  };
+}
+
+FillLogGapMessage::~FillLogGapMessage() {
+  // @@protoc_insertion_point(destructor:dsnet.spec.proto.FillLogGapMessage)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void FillLogGapMessage::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void FillLogGapMessage::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void FillLogGapMessage::Clear() {
+// @@protoc_insertion_point(message_clear_start:dsnet.spec.proto.FillLogGapMessage)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    ::memset(&_impl_.view_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.lastcommitted_) -
+        reinterpret_cast<char*>(&_impl_.view_)) + sizeof(_impl_.lastcommitted_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* FillLogGapMessage::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required uint64 view = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_view(&has_bits);
+          _impl_.view_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required uint64 lastCommitted = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _Internal::set_has_lastcommitted(&has_bits);
+          _impl_.lastcommitted_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* FillLogGapMessage::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:dsnet.spec.proto.FillLogGapMessage)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required uint64 view = 1;
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(1, this->_internal_view(), target);
+  }
+
+  // required uint64 lastCommitted = 2;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(2, this->_internal_lastcommitted(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:dsnet.spec.proto.FillLogGapMessage)
+  return target;
+}
+
+size_t FillLogGapMessage::RequiredFieldsByteSizeFallback() const {
+// @@protoc_insertion_point(required_fields_byte_size_fallback_start:dsnet.spec.proto.FillLogGapMessage)
+  size_t total_size = 0;
+
+  if (_internal_has_view()) {
+    // required uint64 view = 1;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_view());
+  }
+
+  if (_internal_has_lastcommitted()) {
+    // required uint64 lastCommitted = 2;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_lastcommitted());
+  }
+
+  return total_size;
+}
+size_t FillLogGapMessage::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:dsnet.spec.proto.FillLogGapMessage)
+  size_t total_size = 0;
+
+  if (((_impl_._has_bits_[0] & 0x00000003) ^ 0x00000003) == 0) {  // All required fields are present.
+    // required uint64 view = 1;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_view());
+
+    // required uint64 lastCommitted = 2;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_lastcommitted());
+
+  } else {
+    total_size += RequiredFieldsByteSizeFallback();
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData FillLogGapMessage::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    FillLogGapMessage::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*FillLogGapMessage::GetClassData() const { return &_class_data_; }
+
+
+void FillLogGapMessage::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<FillLogGapMessage*>(&to_msg);
+  auto& from = static_cast<const FillLogGapMessage&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:dsnet.spec.proto.FillLogGapMessage)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_impl_.view_ = from._impl_.view_;
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.lastcommitted_ = from._impl_.lastcommitted_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void FillLogGapMessage::CopyFrom(const FillLogGapMessage& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:dsnet.spec.proto.FillLogGapMessage)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool FillLogGapMessage::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  return true;
+}
+
+void FillLogGapMessage::InternalSwap(FillLogGapMessage* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(FillLogGapMessage, _impl_.lastcommitted_)
+      + sizeof(FillLogGapMessage::_impl_.lastcommitted_)
+      - PROTOBUF_FIELD_OFFSET(FillLogGapMessage, _impl_.view_)>(
+          reinterpret_cast<char*>(&_impl_.view_),
+          reinterpret_cast<char*>(&other->_impl_.view_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata FillLogGapMessage::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_replication_2fspec_2fspec_2dproto_2eproto_getter, &descriptor_table_replication_2fspec_2fspec_2dproto_2eproto_once,
+      file_level_metadata_replication_2fspec_2fspec_2dproto_2eproto[12]);
+}
+
+// ===================================================================
+
+class FillDVCGapMessage::_Internal {
+ public:
+  using HasBits = decltype(std::declval<FillDVCGapMessage>()._impl_._has_bits_);
+  static void set_has_view(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_lastcommitted(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000003) ^ 0x00000003) != 0;
+  }
+};
+
+FillDVCGapMessage::FillDVCGapMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:dsnet.spec.proto.FillDVCGapMessage)
+}
+FillDVCGapMessage::FillDVCGapMessage(const FillDVCGapMessage& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  FillDVCGapMessage* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.view_){}
+    , decltype(_impl_.lastcommitted_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.view_, &from._impl_.view_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.lastcommitted_) -
+    reinterpret_cast<char*>(&_impl_.view_)) + sizeof(_impl_.lastcommitted_));
+  // @@protoc_insertion_point(copy_constructor:dsnet.spec.proto.FillDVCGapMessage)
+}
+
+inline void FillDVCGapMessage::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.view_){uint64_t{0u}}
+    , decltype(_impl_.lastcommitted_){uint64_t{0u}}
+  };
+}
+
+FillDVCGapMessage::~FillDVCGapMessage() {
+  // @@protoc_insertion_point(destructor:dsnet.spec.proto.FillDVCGapMessage)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void FillDVCGapMessage::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void FillDVCGapMessage::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void FillDVCGapMessage::Clear() {
+// @@protoc_insertion_point(message_clear_start:dsnet.spec.proto.FillDVCGapMessage)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    ::memset(&_impl_.view_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.lastcommitted_) -
+        reinterpret_cast<char*>(&_impl_.view_)) + sizeof(_impl_.lastcommitted_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* FillDVCGapMessage::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required uint64 view = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_view(&has_bits);
+          _impl_.view_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required uint64 lastCommitted = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _Internal::set_has_lastcommitted(&has_bits);
+          _impl_.lastcommitted_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* FillDVCGapMessage::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:dsnet.spec.proto.FillDVCGapMessage)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required uint64 view = 1;
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(1, this->_internal_view(), target);
+  }
+
+  // required uint64 lastCommitted = 2;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(2, this->_internal_lastcommitted(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:dsnet.spec.proto.FillDVCGapMessage)
+  return target;
+}
+
+size_t FillDVCGapMessage::RequiredFieldsByteSizeFallback() const {
+// @@protoc_insertion_point(required_fields_byte_size_fallback_start:dsnet.spec.proto.FillDVCGapMessage)
+  size_t total_size = 0;
+
+  if (_internal_has_view()) {
+    // required uint64 view = 1;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_view());
+  }
+
+  if (_internal_has_lastcommitted()) {
+    // required uint64 lastCommitted = 2;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_lastcommitted());
+  }
+
+  return total_size;
+}
+size_t FillDVCGapMessage::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:dsnet.spec.proto.FillDVCGapMessage)
+  size_t total_size = 0;
+
+  if (((_impl_._has_bits_[0] & 0x00000003) ^ 0x00000003) == 0) {  // All required fields are present.
+    // required uint64 view = 1;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_view());
+
+    // required uint64 lastCommitted = 2;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_lastcommitted());
+
+  } else {
+    total_size += RequiredFieldsByteSizeFallback();
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData FillDVCGapMessage::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    FillDVCGapMessage::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*FillDVCGapMessage::GetClassData() const { return &_class_data_; }
+
+
+void FillDVCGapMessage::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<FillDVCGapMessage*>(&to_msg);
+  auto& from = static_cast<const FillDVCGapMessage&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:dsnet.spec.proto.FillDVCGapMessage)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_impl_.view_ = from._impl_.view_;
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.lastcommitted_ = from._impl_.lastcommitted_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void FillDVCGapMessage::CopyFrom(const FillDVCGapMessage& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:dsnet.spec.proto.FillDVCGapMessage)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool FillDVCGapMessage::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  return true;
+}
+
+void FillDVCGapMessage::InternalSwap(FillDVCGapMessage* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(FillDVCGapMessage, _impl_.lastcommitted_)
+      + sizeof(FillDVCGapMessage::_impl_.lastcommitted_)
+      - PROTOBUF_FIELD_OFFSET(FillDVCGapMessage, _impl_.view_)>(
+          reinterpret_cast<char*>(&_impl_.view_),
+          reinterpret_cast<char*>(&other->_impl_.view_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata FillDVCGapMessage::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_replication_2fspec_2fspec_2dproto_2eproto_getter, &descriptor_table_replication_2fspec_2fspec_2dproto_2eproto_once,
+      file_level_metadata_replication_2fspec_2fspec_2dproto_2eproto[13]);
+}
+
+// ===================================================================
+
+class ToReplicaMessage::_Internal {
+ public:
+  static const ::dsnet::spec::proto::RequestMessage& request(const ToReplicaMessage* msg);
+  static const ::dsnet::spec::proto::UnloggedRequestMessage& unlogged_request(const ToReplicaMessage* msg);
+  static const ::dsnet::spec::proto::SyncMessage& sync(const ToReplicaMessage* msg);
+  static const ::dsnet::spec::proto::SyncReplyMessage& sync_reply(const ToReplicaMessage* msg);
+  static const ::dsnet::spec::proto::RequestViewChangeMessage& request_view_change(const ToReplicaMessage* msg);
+  static const ::dsnet::spec::proto::StartViewChangeMessage& start_view_change(const ToReplicaMessage* msg);
+  static const ::dsnet::spec::proto::DoViewChangeMessage& do_view_change(const ToReplicaMessage* msg);
+  static const ::dsnet::spec::proto::StartViewMessage& start_view(const ToReplicaMessage* msg);
+  static const ::dsnet::spec::proto::InViewMessage& in_view(const ToReplicaMessage* msg);
+  static const ::dsnet::spec::proto::FillLogGapMessage& fill_log_gap(const ToReplicaMessage* msg);
+  static const ::dsnet::spec::proto::FillDVCGapMessage& fill_dvc_gap(const ToReplicaMessage* msg);
+};
+
+const ::dsnet::spec::proto::RequestMessage&
+ToReplicaMessage::_Internal::request(const ToReplicaMessage* msg) {
+  return *msg->_impl_.msg_.request_;
+}
+const ::dsnet::spec::proto::UnloggedRequestMessage&
+ToReplicaMessage::_Internal::unlogged_request(const ToReplicaMessage* msg) {
+  return *msg->_impl_.msg_.unlogged_request_;
+}
+const ::dsnet::spec::proto::SyncMessage&
+ToReplicaMessage::_Internal::sync(const ToReplicaMessage* msg) {
+  return *msg->_impl_.msg_.sync_;
+}
+const ::dsnet::spec::proto::SyncReplyMessage&
+ToReplicaMessage::_Internal::sync_reply(const ToReplicaMessage* msg) {
+  return *msg->_impl_.msg_.sync_reply_;
+}
+const ::dsnet::spec::proto::RequestViewChangeMessage&
+ToReplicaMessage::_Internal::request_view_change(const ToReplicaMessage* msg) {
+  return *msg->_impl_.msg_.request_view_change_;
+}
+const ::dsnet::spec::proto::StartViewChangeMessage&
+ToReplicaMessage::_Internal::start_view_change(const ToReplicaMessage* msg) {
+  return *msg->_impl_.msg_.start_view_change_;
+}
+const ::dsnet::spec::proto::DoViewChangeMessage&
+ToReplicaMessage::_Internal::do_view_change(const ToReplicaMessage* msg) {
+  return *msg->_impl_.msg_.do_view_change_;
+}
+const ::dsnet::spec::proto::StartViewMessage&
+ToReplicaMessage::_Internal::start_view(const ToReplicaMessage* msg) {
+  return *msg->_impl_.msg_.start_view_;
+}
+const ::dsnet::spec::proto::InViewMessage&
+ToReplicaMessage::_Internal::in_view(const ToReplicaMessage* msg) {
+  return *msg->_impl_.msg_.in_view_;
+}
+const ::dsnet::spec::proto::FillLogGapMessage&
+ToReplicaMessage::_Internal::fill_log_gap(const ToReplicaMessage* msg) {
+  return *msg->_impl_.msg_.fill_log_gap_;
+}
+const ::dsnet::spec::proto::FillDVCGapMessage&
+ToReplicaMessage::_Internal::fill_dvc_gap(const ToReplicaMessage* msg) {
+  return *msg->_impl_.msg_.fill_dvc_gap_;
+}
+void ToReplicaMessage::set_allocated_request(::dsnet::spec::proto::RequestMessage* request) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  clear_msg();
+  if (request) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(request);
+    if (message_arena != submessage_arena) {
+      request = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, request, submessage_arena);
+    }
+    set_has_request();
+    _impl_.msg_.request_ = request;
+  }
+  // @@protoc_insertion_point(field_set_allocated:dsnet.spec.proto.ToReplicaMessage.request)
+}
+void ToReplicaMessage::set_allocated_unlogged_request(::dsnet::spec::proto::UnloggedRequestMessage* unlogged_request) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  clear_msg();
+  if (unlogged_request) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(unlogged_request);
+    if (message_arena != submessage_arena) {
+      unlogged_request = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, unlogged_request, submessage_arena);
+    }
+    set_has_unlogged_request();
+    _impl_.msg_.unlogged_request_ = unlogged_request;
+  }
+  // @@protoc_insertion_point(field_set_allocated:dsnet.spec.proto.ToReplicaMessage.unlogged_request)
+}
+void ToReplicaMessage::set_allocated_sync(::dsnet::spec::proto::SyncMessage* sync) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  clear_msg();
+  if (sync) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(sync);
+    if (message_arena != submessage_arena) {
+      sync = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, sync, submessage_arena);
+    }
+    set_has_sync();
+    _impl_.msg_.sync_ = sync;
+  }
+  // @@protoc_insertion_point(field_set_allocated:dsnet.spec.proto.ToReplicaMessage.sync)
+}
+void ToReplicaMessage::set_allocated_sync_reply(::dsnet::spec::proto::SyncReplyMessage* sync_reply) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  clear_msg();
+  if (sync_reply) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(sync_reply);
+    if (message_arena != submessage_arena) {
+      sync_reply = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, sync_reply, submessage_arena);
+    }
+    set_has_sync_reply();
+    _impl_.msg_.sync_reply_ = sync_reply;
+  }
+  // @@protoc_insertion_point(field_set_allocated:dsnet.spec.proto.ToReplicaMessage.sync_reply)
+}
+void ToReplicaMessage::set_allocated_request_view_change(::dsnet::spec::proto::RequestViewChangeMessage* request_view_change) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  clear_msg();
+  if (request_view_change) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(request_view_change);
+    if (message_arena != submessage_arena) {
+      request_view_change = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, request_view_change, submessage_arena);
+    }
+    set_has_request_view_change();
+    _impl_.msg_.request_view_change_ = request_view_change;
+  }
+  // @@protoc_insertion_point(field_set_allocated:dsnet.spec.proto.ToReplicaMessage.request_view_change)
+}
+void ToReplicaMessage::set_allocated_start_view_change(::dsnet::spec::proto::StartViewChangeMessage* start_view_change) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  clear_msg();
+  if (start_view_change) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(start_view_change);
+    if (message_arena != submessage_arena) {
+      start_view_change = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, start_view_change, submessage_arena);
+    }
+    set_has_start_view_change();
+    _impl_.msg_.start_view_change_ = start_view_change;
+  }
+  // @@protoc_insertion_point(field_set_allocated:dsnet.spec.proto.ToReplicaMessage.start_view_change)
+}
+void ToReplicaMessage::set_allocated_do_view_change(::dsnet::spec::proto::DoViewChangeMessage* do_view_change) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  clear_msg();
+  if (do_view_change) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(do_view_change);
+    if (message_arena != submessage_arena) {
+      do_view_change = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, do_view_change, submessage_arena);
+    }
+    set_has_do_view_change();
+    _impl_.msg_.do_view_change_ = do_view_change;
+  }
+  // @@protoc_insertion_point(field_set_allocated:dsnet.spec.proto.ToReplicaMessage.do_view_change)
+}
+void ToReplicaMessage::set_allocated_start_view(::dsnet::spec::proto::StartViewMessage* start_view) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  clear_msg();
+  if (start_view) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(start_view);
+    if (message_arena != submessage_arena) {
+      start_view = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, start_view, submessage_arena);
+    }
+    set_has_start_view();
+    _impl_.msg_.start_view_ = start_view;
+  }
+  // @@protoc_insertion_point(field_set_allocated:dsnet.spec.proto.ToReplicaMessage.start_view)
+}
+void ToReplicaMessage::set_allocated_in_view(::dsnet::spec::proto::InViewMessage* in_view) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  clear_msg();
+  if (in_view) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(in_view);
+    if (message_arena != submessage_arena) {
+      in_view = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, in_view, submessage_arena);
+    }
+    set_has_in_view();
+    _impl_.msg_.in_view_ = in_view;
+  }
+  // @@protoc_insertion_point(field_set_allocated:dsnet.spec.proto.ToReplicaMessage.in_view)
+}
+void ToReplicaMessage::set_allocated_fill_log_gap(::dsnet::spec::proto::FillLogGapMessage* fill_log_gap) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  clear_msg();
+  if (fill_log_gap) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(fill_log_gap);
+    if (message_arena != submessage_arena) {
+      fill_log_gap = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, fill_log_gap, submessage_arena);
+    }
+    set_has_fill_log_gap();
+    _impl_.msg_.fill_log_gap_ = fill_log_gap;
+  }
+  // @@protoc_insertion_point(field_set_allocated:dsnet.spec.proto.ToReplicaMessage.fill_log_gap)
+}
+void ToReplicaMessage::set_allocated_fill_dvc_gap(::dsnet::spec::proto::FillDVCGapMessage* fill_dvc_gap) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  clear_msg();
+  if (fill_dvc_gap) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(fill_dvc_gap);
+    if (message_arena != submessage_arena) {
+      fill_dvc_gap = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, fill_dvc_gap, submessage_arena);
+    }
+    set_has_fill_dvc_gap();
+    _impl_.msg_.fill_dvc_gap_ = fill_dvc_gap;
+  }
+  // @@protoc_insertion_point(field_set_allocated:dsnet.spec.proto.ToReplicaMessage.fill_dvc_gap)
+}
+ToReplicaMessage::ToReplicaMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:dsnet.spec.proto.ToReplicaMessage)
+}
+ToReplicaMessage::ToReplicaMessage(const ToReplicaMessage& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  ToReplicaMessage* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.msg_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , /*decltype(_impl_._oneof_case_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  clear_has_msg();
+  switch (from.msg_case()) {
+    case kRequest: {
+      _this->_internal_mutable_request()->::dsnet::spec::proto::RequestMessage::MergeFrom(
+          from._internal_request());
+      break;
+    }
+    case kUnloggedRequest: {
+      _this->_internal_mutable_unlogged_request()->::dsnet::spec::proto::UnloggedRequestMessage::MergeFrom(
+          from._internal_unlogged_request());
+      break;
+    }
+    case kSync: {
+      _this->_internal_mutable_sync()->::dsnet::spec::proto::SyncMessage::MergeFrom(
+          from._internal_sync());
+      break;
+    }
+    case kSyncReply: {
+      _this->_internal_mutable_sync_reply()->::dsnet::spec::proto::SyncReplyMessage::MergeFrom(
+          from._internal_sync_reply());
+      break;
+    }
+    case kRequestViewChange: {
+      _this->_internal_mutable_request_view_change()->::dsnet::spec::proto::RequestViewChangeMessage::MergeFrom(
+          from._internal_request_view_change());
+      break;
+    }
+    case kStartViewChange: {
+      _this->_internal_mutable_start_view_change()->::dsnet::spec::proto::StartViewChangeMessage::MergeFrom(
+          from._internal_start_view_change());
+      break;
+    }
+    case kDoViewChange: {
+      _this->_internal_mutable_do_view_change()->::dsnet::spec::proto::DoViewChangeMessage::MergeFrom(
+          from._internal_do_view_change());
+      break;
+    }
+    case kStartView: {
+      _this->_internal_mutable_start_view()->::dsnet::spec::proto::StartViewMessage::MergeFrom(
+          from._internal_start_view());
+      break;
+    }
+    case kInView: {
+      _this->_internal_mutable_in_view()->::dsnet::spec::proto::InViewMessage::MergeFrom(
+          from._internal_in_view());
+      break;
+    }
+    case kFillLogGap: {
+      _this->_internal_mutable_fill_log_gap()->::dsnet::spec::proto::FillLogGapMessage::MergeFrom(
+          from._internal_fill_log_gap());
+      break;
+    }
+    case kFillDvcGap: {
+      _this->_internal_mutable_fill_dvc_gap()->::dsnet::spec::proto::FillDVCGapMessage::MergeFrom(
+          from._internal_fill_dvc_gap());
+      break;
+    }
+    case MSG_NOT_SET: {
+      break;
+    }
+  }
+  // @@protoc_insertion_point(copy_constructor:dsnet.spec.proto.ToReplicaMessage)
+}
+
+inline void ToReplicaMessage::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.msg_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , /*decltype(_impl_._oneof_case_)*/{}
+  };
+  clear_has_msg();
+}
+
+ToReplicaMessage::~ToReplicaMessage() {
+  // @@protoc_insertion_point(destructor:dsnet.spec.proto.ToReplicaMessage)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void ToReplicaMessage::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  if (has_msg()) {
+    clear_msg();
+  }
+}
+
+void ToReplicaMessage::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void ToReplicaMessage::clear_msg() {
+// @@protoc_insertion_point(one_of_clear_start:dsnet.spec.proto.ToReplicaMessage)
+  switch (msg_case()) {
+    case kRequest: {
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.msg_.request_;
+      }
+      break;
+    }
+    case kUnloggedRequest: {
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.msg_.unlogged_request_;
+      }
+      break;
+    }
+    case kSync: {
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.msg_.sync_;
+      }
+      break;
+    }
+    case kSyncReply: {
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.msg_.sync_reply_;
+      }
+      break;
+    }
+    case kRequestViewChange: {
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.msg_.request_view_change_;
+      }
+      break;
+    }
+    case kStartViewChange: {
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.msg_.start_view_change_;
+      }
+      break;
+    }
+    case kDoViewChange: {
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.msg_.do_view_change_;
+      }
+      break;
+    }
+    case kStartView: {
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.msg_.start_view_;
+      }
+      break;
+    }
+    case kInView: {
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.msg_.in_view_;
+      }
+      break;
+    }
+    case kFillLogGap: {
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.msg_.fill_log_gap_;
+      }
+      break;
+    }
+    case kFillDvcGap: {
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.msg_.fill_dvc_gap_;
+      }
+      break;
+    }
+    case MSG_NOT_SET: {
+      break;
+    }
+  }
+  _impl_._oneof_case_[0] = MSG_NOT_SET;
+}
+
+
+void ToReplicaMessage::Clear() {
+// @@protoc_insertion_point(message_clear_start:dsnet.spec.proto.ToReplicaMessage)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  clear_msg();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* ToReplicaMessage::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // .dsnet.spec.proto.RequestMessage request = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr = ctx->ParseMessage(_internal_mutable_request(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .dsnet.spec.proto.UnloggedRequestMessage unlogged_request = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr = ctx->ParseMessage(_internal_mutable_unlogged_request(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .dsnet.spec.proto.SyncMessage sync = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          ptr = ctx->ParseMessage(_internal_mutable_sync(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .dsnet.spec.proto.SyncReplyMessage sync_reply = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          ptr = ctx->ParseMessage(_internal_mutable_sync_reply(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .dsnet.spec.proto.RequestViewChangeMessage request_view_change = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 42)) {
+          ptr = ctx->ParseMessage(_internal_mutable_request_view_change(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .dsnet.spec.proto.StartViewChangeMessage start_view_change = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 50)) {
+          ptr = ctx->ParseMessage(_internal_mutable_start_view_change(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .dsnet.spec.proto.DoViewChangeMessage do_view_change = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 58)) {
+          ptr = ctx->ParseMessage(_internal_mutable_do_view_change(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .dsnet.spec.proto.StartViewMessage start_view = 8;
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 66)) {
+          ptr = ctx->ParseMessage(_internal_mutable_start_view(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .dsnet.spec.proto.InViewMessage in_view = 9;
+      case 9:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 74)) {
+          ptr = ctx->ParseMessage(_internal_mutable_in_view(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .dsnet.spec.proto.FillLogGapMessage fill_log_gap = 10;
+      case 10:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 82)) {
+          ptr = ctx->ParseMessage(_internal_mutable_fill_log_gap(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .dsnet.spec.proto.FillDVCGapMessage fill_dvc_gap = 11;
+      case 11:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 90)) {
+          ptr = ctx->ParseMessage(_internal_mutable_fill_dvc_gap(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* ToReplicaMessage::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:dsnet.spec.proto.ToReplicaMessage)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  switch (msg_case()) {
+    case kRequest: {
+      target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(1, _Internal::request(this),
+          _Internal::request(this).GetCachedSize(), target, stream);
+      break;
+    }
+    case kUnloggedRequest: {
+      target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(2, _Internal::unlogged_request(this),
+          _Internal::unlogged_request(this).GetCachedSize(), target, stream);
+      break;
+    }
+    case kSync: {
+      target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(3, _Internal::sync(this),
+          _Internal::sync(this).GetCachedSize(), target, stream);
+      break;
+    }
+    case kSyncReply: {
+      target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(4, _Internal::sync_reply(this),
+          _Internal::sync_reply(this).GetCachedSize(), target, stream);
+      break;
+    }
+    case kRequestViewChange: {
+      target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(5, _Internal::request_view_change(this),
+          _Internal::request_view_change(this).GetCachedSize(), target, stream);
+      break;
+    }
+    case kStartViewChange: {
+      target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(6, _Internal::start_view_change(this),
+          _Internal::start_view_change(this).GetCachedSize(), target, stream);
+      break;
+    }
+    case kDoViewChange: {
+      target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(7, _Internal::do_view_change(this),
+          _Internal::do_view_change(this).GetCachedSize(), target, stream);
+      break;
+    }
+    case kStartView: {
+      target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(8, _Internal::start_view(this),
+          _Internal::start_view(this).GetCachedSize(), target, stream);
+      break;
+    }
+    case kInView: {
+      target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(9, _Internal::in_view(this),
+          _Internal::in_view(this).GetCachedSize(), target, stream);
+      break;
+    }
+    case kFillLogGap: {
+      target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(10, _Internal::fill_log_gap(this),
+          _Internal::fill_log_gap(this).GetCachedSize(), target, stream);
+      break;
+    }
+    case kFillDvcGap: {
+      target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(11, _Internal::fill_dvc_gap(this),
+          _Internal::fill_dvc_gap(this).GetCachedSize(), target, stream);
+      break;
+    }
+    default: ;
+  }
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:dsnet.spec.proto.ToReplicaMessage)
+  return target;
+}
+
+size_t ToReplicaMessage::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:dsnet.spec.proto.ToReplicaMessage)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  switch (msg_case()) {
+    // .dsnet.spec.proto.RequestMessage request = 1;
+    case kRequest: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.msg_.request_);
+      break;
+    }
+    // .dsnet.spec.proto.UnloggedRequestMessage unlogged_request = 2;
+    case kUnloggedRequest: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.msg_.unlogged_request_);
+      break;
+    }
+    // .dsnet.spec.proto.SyncMessage sync = 3;
+    case kSync: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.msg_.sync_);
+      break;
+    }
+    // .dsnet.spec.proto.SyncReplyMessage sync_reply = 4;
+    case kSyncReply: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.msg_.sync_reply_);
+      break;
+    }
+    // .dsnet.spec.proto.RequestViewChangeMessage request_view_change = 5;
+    case kRequestViewChange: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.msg_.request_view_change_);
+      break;
+    }
+    // .dsnet.spec.proto.StartViewChangeMessage start_view_change = 6;
+    case kStartViewChange: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.msg_.start_view_change_);
+      break;
+    }
+    // .dsnet.spec.proto.DoViewChangeMessage do_view_change = 7;
+    case kDoViewChange: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.msg_.do_view_change_);
+      break;
+    }
+    // .dsnet.spec.proto.StartViewMessage start_view = 8;
+    case kStartView: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.msg_.start_view_);
+      break;
+    }
+    // .dsnet.spec.proto.InViewMessage in_view = 9;
+    case kInView: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.msg_.in_view_);
+      break;
+    }
+    // .dsnet.spec.proto.FillLogGapMessage fill_log_gap = 10;
+    case kFillLogGap: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.msg_.fill_log_gap_);
+      break;
+    }
+    // .dsnet.spec.proto.FillDVCGapMessage fill_dvc_gap = 11;
+    case kFillDvcGap: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.msg_.fill_dvc_gap_);
+      break;
+    }
+    case MSG_NOT_SET: {
+      break;
+    }
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ToReplicaMessage::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    ToReplicaMessage::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ToReplicaMessage::GetClassData() const { return &_class_data_; }
+
+
+void ToReplicaMessage::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<ToReplicaMessage*>(&to_msg);
+  auto& from = static_cast<const ToReplicaMessage&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:dsnet.spec.proto.ToReplicaMessage)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  switch (from.msg_case()) {
+    case kRequest: {
+      _this->_internal_mutable_request()->::dsnet::spec::proto::RequestMessage::MergeFrom(
+          from._internal_request());
+      break;
+    }
+    case kUnloggedRequest: {
+      _this->_internal_mutable_unlogged_request()->::dsnet::spec::proto::UnloggedRequestMessage::MergeFrom(
+          from._internal_unlogged_request());
+      break;
+    }
+    case kSync: {
+      _this->_internal_mutable_sync()->::dsnet::spec::proto::SyncMessage::MergeFrom(
+          from._internal_sync());
+      break;
+    }
+    case kSyncReply: {
+      _this->_internal_mutable_sync_reply()->::dsnet::spec::proto::SyncReplyMessage::MergeFrom(
+          from._internal_sync_reply());
+      break;
+    }
+    case kRequestViewChange: {
+      _this->_internal_mutable_request_view_change()->::dsnet::spec::proto::RequestViewChangeMessage::MergeFrom(
+          from._internal_request_view_change());
+      break;
+    }
+    case kStartViewChange: {
+      _this->_internal_mutable_start_view_change()->::dsnet::spec::proto::StartViewChangeMessage::MergeFrom(
+          from._internal_start_view_change());
+      break;
+    }
+    case kDoViewChange: {
+      _this->_internal_mutable_do_view_change()->::dsnet::spec::proto::DoViewChangeMessage::MergeFrom(
+          from._internal_do_view_change());
+      break;
+    }
+    case kStartView: {
+      _this->_internal_mutable_start_view()->::dsnet::spec::proto::StartViewMessage::MergeFrom(
+          from._internal_start_view());
+      break;
+    }
+    case kInView: {
+      _this->_internal_mutable_in_view()->::dsnet::spec::proto::InViewMessage::MergeFrom(
+          from._internal_in_view());
+      break;
+    }
+    case kFillLogGap: {
+      _this->_internal_mutable_fill_log_gap()->::dsnet::spec::proto::FillLogGapMessage::MergeFrom(
+          from._internal_fill_log_gap());
+      break;
+    }
+    case kFillDvcGap: {
+      _this->_internal_mutable_fill_dvc_gap()->::dsnet::spec::proto::FillDVCGapMessage::MergeFrom(
+          from._internal_fill_dvc_gap());
+      break;
+    }
+    case MSG_NOT_SET: {
+      break;
+    }
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void ToReplicaMessage::CopyFrom(const ToReplicaMessage& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:dsnet.spec.proto.ToReplicaMessage)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool ToReplicaMessage::IsInitialized() const {
+  switch (msg_case()) {
+    case kRequest: {
+      if (_internal_has_request()) {
+        if (!_impl_.msg_.request_->IsInitialized()) return false;
+      }
+      break;
+    }
+    case kUnloggedRequest: {
+      if (_internal_has_unlogged_request()) {
+        if (!_impl_.msg_.unlogged_request_->IsInitialized()) return false;
+      }
+      break;
+    }
+    case kSync: {
+      if (_internal_has_sync()) {
+        if (!_impl_.msg_.sync_->IsInitialized()) return false;
+      }
+      break;
+    }
+    case kSyncReply: {
+      if (_internal_has_sync_reply()) {
+        if (!_impl_.msg_.sync_reply_->IsInitialized()) return false;
+      }
+      break;
+    }
+    case kRequestViewChange: {
+      if (_internal_has_request_view_change()) {
+        if (!_impl_.msg_.request_view_change_->IsInitialized()) return false;
+      }
+      break;
+    }
+    case kStartViewChange: {
+      if (_internal_has_start_view_change()) {
+        if (!_impl_.msg_.start_view_change_->IsInitialized()) return false;
+      }
+      break;
+    }
+    case kDoViewChange: {
+      if (_internal_has_do_view_change()) {
+        if (!_impl_.msg_.do_view_change_->IsInitialized()) return false;
+      }
+      break;
+    }
+    case kStartView: {
+      if (_internal_has_start_view()) {
+        if (!_impl_.msg_.start_view_->IsInitialized()) return false;
+      }
+      break;
+    }
+    case kInView: {
+      if (_internal_has_in_view()) {
+        if (!_impl_.msg_.in_view_->IsInitialized()) return false;
+      }
+      break;
+    }
+    case kFillLogGap: {
+      if (_internal_has_fill_log_gap()) {
+        if (!_impl_.msg_.fill_log_gap_->IsInitialized()) return false;
+      }
+      break;
+    }
+    case kFillDvcGap: {
+      if (_internal_has_fill_dvc_gap()) {
+        if (!_impl_.msg_.fill_dvc_gap_->IsInitialized()) return false;
+      }
+      break;
+    }
+    case MSG_NOT_SET: {
+      break;
+    }
+  }
+  return true;
+}
+
+void ToReplicaMessage::InternalSwap(ToReplicaMessage* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_.msg_, other->_impl_.msg_);
+  swap(_impl_._oneof_case_[0], other->_impl_._oneof_case_[0]);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata ToReplicaMessage::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_replication_2fspec_2fspec_2dproto_2eproto_getter, &descriptor_table_replication_2fspec_2fspec_2dproto_2eproto_once,
+      file_level_metadata_replication_2fspec_2fspec_2dproto_2eproto[14]);
+}
+
+// @@protoc_insertion_point(namespace_scope)
+}  // namespace proto
+}  // namespace spec
+}  // namespace dsnet
+PROTOBUF_NAMESPACE_OPEN
+template<> PROTOBUF_NOINLINE ::dsnet::spec::proto::SpeculativeReplyMessage*
+Arena::CreateMaybeMessage< ::dsnet::spec::proto::SpeculativeReplyMessage >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::dsnet::spec::proto::SpeculativeReplyMessage >(arena);
+}
+template<> PROTOBUF_NOINLINE ::dsnet::spec::proto::UnloggedReplyMessage*
+Arena::CreateMaybeMessage< ::dsnet::spec::proto::UnloggedReplyMessage >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::dsnet::spec::proto::UnloggedReplyMessage >(arena);
+}
+template<> PROTOBUF_NOINLINE ::dsnet::spec::proto::ToClientMessage*
+Arena::CreateMaybeMessage< ::dsnet::spec::proto::ToClientMessage >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::dsnet::spec::proto::ToClientMessage >(arena);
+}
+template<> PROTOBUF_NOINLINE ::dsnet::spec::proto::RequestMessage*
+Arena::CreateMaybeMessage< ::dsnet::spec::proto::RequestMessage >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::dsnet::spec::proto::RequestMessage >(arena);
+}
+template<> PROTOBUF_NOINLINE ::dsnet::spec::proto::UnloggedRequestMessage*
+Arena::CreateMaybeMessage< ::dsnet::spec::proto::UnloggedRequestMessage >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::dsnet::spec::proto::UnloggedRequestMessage >(arena);
+}
+template<> PROTOBUF_NOINLINE ::dsnet::spec::proto::SyncMessage*
+Arena::CreateMaybeMessage< ::dsnet::spec::proto::SyncMessage >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::dsnet::spec::proto::SyncMessage >(arena);
+}
+template<> PROTOBUF_NOINLINE ::dsnet::spec::proto::SyncReplyMessage*
+Arena::CreateMaybeMessage< ::dsnet::spec::proto::SyncReplyMessage >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::dsnet::spec::proto::SyncReplyMessage >(arena);
+}
+template<> PROTOBUF_NOINLINE ::dsnet::spec::proto::RequestViewChangeMessage*
+Arena::CreateMaybeMessage< ::dsnet::spec::proto::RequestViewChangeMessage >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::dsnet::spec::proto::RequestViewChangeMessage >(arena);
+}
+template<> PROTOBUF_NOINLINE ::dsnet::spec::proto::StartViewChangeMessage*
+Arena::CreateMaybeMessage< ::dsnet::spec::proto::StartViewChangeMessage >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::dsnet::spec::proto::StartViewChangeMessage >(arena);
+}
+template<> PROTOBUF_NOINLINE ::dsnet::spec::proto::DoViewChangeMessage*
+Arena::CreateMaybeMessage< ::dsnet::spec::proto::DoViewChangeMessage >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::dsnet::spec::proto::DoViewChangeMessage >(arena);
+}
+template<> PROTOBUF_NOINLINE ::dsnet::spec::proto::StartViewMessage*
+Arena::CreateMaybeMessage< ::dsnet::spec::proto::StartViewMessage >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::dsnet::spec::proto::StartViewMessage >(arena);
+}
+template<> PROTOBUF_NOINLINE ::dsnet::spec::proto::InViewMessage*
+Arena::CreateMaybeMessage< ::dsnet::spec::proto::InViewMessage >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::dsnet::spec::proto::InViewMessage >(arena);
+}
+template<> PROTOBUF_NOINLINE ::dsnet::spec::proto::FillLogGapMessage*
+Arena::CreateMaybeMessage< ::dsnet::spec::proto::FillLogGapMessage >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::dsnet::spec::proto::FillLogGapMessage >(arena);
+}
+template<> PROTOBUF_NOINLINE ::dsnet::spec::proto::FillDVCGapMessage*
+Arena::CreateMaybeMessage< ::dsnet::spec::proto::FillDVCGapMessage >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::dsnet::spec::proto::FillDVCGapMessage >(arena);
+}
+template<> PROTOBUF_NOINLINE ::dsnet::spec::proto::ToReplicaMessage*
+Arena::CreateMaybeMessage< ::dsnet::spec::proto::ToReplicaMessage >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::dsnet::spec::proto::ToReplicaMessage >(arena);
+}
+PROTOBUF_NAMESPACE_CLOSE
+
+// @@protoc_insertion_point(global_scope)
+#include <google/protobuf/port_undef.inc>
@@ -0,0 +1,5779 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: replication/spec/spec-proto.proto
+
+#ifndef GOOGLE_PROTOBUF_INCLUDED_replication_2fspec_2fspec_2dproto_2eproto
+#define GOOGLE_PROTOBUF_INCLUDED_replication_2fspec_2fspec_2dproto_2eproto
+
+#include <limits>
+#include <string>
+
+#include <google/protobuf/port_def.inc>
+#if PROTOBUF_VERSION < 3021000
+#error This file was generated by a newer version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please update
+#error your headers.
+#endif
+#if 3021012 < PROTOBUF_MIN_PROTOC_VERSION
+#error This file was generated by an older version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please
+#error regenerate this file with a newer version of protoc.
+#endif
+
+#include <google/protobuf/port_undef.inc>
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/arena.h>
+#include <google/protobuf/arenastring.h>
+#include <google/protobuf/generated_message_util.h>
+#include <google/protobuf/metadata_lite.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/message.h>
+#include <google/protobuf/repeated_field.h>  // IWYU pragma: export
+#include <google/protobuf/extension_set.h>  // IWYU pragma: export
+#include <google/protobuf/unknown_field_set.h>
+#include "common/request.pb.h"
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+#define PROTOBUF_INTERNAL_EXPORT_replication_2fspec_2fspec_2dproto_2eproto
+PROTOBUF_NAMESPACE_OPEN
+namespace internal {
+class AnyMetadata;
+}  // namespace internal
+PROTOBUF_NAMESPACE_CLOSE
+
+// Internal implementation detail -- do not use these members.
+struct TableStruct_replication_2fspec_2fspec_2dproto_2eproto {
+  static const uint32_t offsets[];
+};
+extern const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_replication_2fspec_2fspec_2dproto_2eproto;
+namespace dsnet {
+namespace spec {
+namespace proto {
+class DoViewChangeMessage;
+struct DoViewChangeMessageDefaultTypeInternal;
+extern DoViewChangeMessageDefaultTypeInternal _DoViewChangeMessage_default_instance_;
+class FillDVCGapMessage;
+struct FillDVCGapMessageDefaultTypeInternal;
+extern FillDVCGapMessageDefaultTypeInternal _FillDVCGapMessage_default_instance_;
+class FillLogGapMessage;
+struct FillLogGapMessageDefaultTypeInternal;
+extern FillLogGapMessageDefaultTypeInternal _FillLogGapMessage_default_instance_;
+class InViewMessage;
+struct InViewMessageDefaultTypeInternal;
+extern InViewMessageDefaultTypeInternal _InViewMessage_default_instance_;
+class RequestMessage;
+struct RequestMessageDefaultTypeInternal;
+extern RequestMessageDefaultTypeInternal _RequestMessage_default_instance_;
+class RequestViewChangeMessage;
+struct RequestViewChangeMessageDefaultTypeInternal;
+extern RequestViewChangeMessageDefaultTypeInternal _RequestViewChangeMessage_default_instance_;
+class SpeculativeReplyMessage;
+struct SpeculativeReplyMessageDefaultTypeInternal;
+extern SpeculativeReplyMessageDefaultTypeInternal _SpeculativeReplyMessage_default_instance_;
+class StartViewChangeMessage;
+struct StartViewChangeMessageDefaultTypeInternal;
+extern StartViewChangeMessageDefaultTypeInternal _StartViewChangeMessage_default_instance_;
+class StartViewMessage;
+struct StartViewMessageDefaultTypeInternal;
+extern StartViewMessageDefaultTypeInternal _StartViewMessage_default_instance_;
+class SyncMessage;
+struct SyncMessageDefaultTypeInternal;
+extern SyncMessageDefaultTypeInternal _SyncMessage_default_instance_;
+class SyncReplyMessage;
+struct SyncReplyMessageDefaultTypeInternal;
+extern SyncReplyMessageDefaultTypeInternal _SyncReplyMessage_default_instance_;
+class ToClientMessage;
+struct ToClientMessageDefaultTypeInternal;
+extern ToClientMessageDefaultTypeInternal _ToClientMessage_default_instance_;
+class ToReplicaMessage;
+struct ToReplicaMessageDefaultTypeInternal;
+extern ToReplicaMessageDefaultTypeInternal _ToReplicaMessage_default_instance_;
+class UnloggedReplyMessage;
+struct UnloggedReplyMessageDefaultTypeInternal;
+extern UnloggedReplyMessageDefaultTypeInternal _UnloggedReplyMessage_default_instance_;
+class UnloggedRequestMessage;
+struct UnloggedRequestMessageDefaultTypeInternal;
+extern UnloggedRequestMessageDefaultTypeInternal _UnloggedRequestMessage_default_instance_;
+}  // namespace proto
+}  // namespace spec
+}  // namespace dsnet
+PROTOBUF_NAMESPACE_OPEN
+template<> ::dsnet::spec::proto::DoViewChangeMessage* Arena::CreateMaybeMessage<::dsnet::spec::proto::DoViewChangeMessage>(Arena*);
+template<> ::dsnet::spec::proto::FillDVCGapMessage* Arena::CreateMaybeMessage<::dsnet::spec::proto::FillDVCGapMessage>(Arena*);
+template<> ::dsnet::spec::proto::FillLogGapMessage* Arena::CreateMaybeMessage<::dsnet::spec::proto::FillLogGapMessage>(Arena*);
+template<> ::dsnet::spec::proto::InViewMessage* Arena::CreateMaybeMessage<::dsnet::spec::proto::InViewMessage>(Arena*);
+template<> ::dsnet::spec::proto::RequestMessage* Arena::CreateMaybeMessage<::dsnet::spec::proto::RequestMessage>(Arena*);
+template<> ::dsnet::spec::proto::RequestViewChangeMessage* Arena::CreateMaybeMessage<::dsnet::spec::proto::RequestViewChangeMessage>(Arena*);
+template<> ::dsnet::spec::proto::SpeculativeReplyMessage* Arena::CreateMaybeMessage<::dsnet::spec::proto::SpeculativeReplyMessage>(Arena*);
+template<> ::dsnet::spec::proto::StartViewChangeMessage* Arena::CreateMaybeMessage<::dsnet::spec::proto::StartViewChangeMessage>(Arena*);
+template<> ::dsnet::spec::proto::StartViewMessage* Arena::CreateMaybeMessage<::dsnet::spec::proto::StartViewMessage>(Arena*);
+template<> ::dsnet::spec::proto::SyncMessage* Arena::CreateMaybeMessage<::dsnet::spec::proto::SyncMessage>(Arena*);
+template<> ::dsnet::spec::proto::SyncReplyMessage* Arena::CreateMaybeMessage<::dsnet::spec::proto::SyncReplyMessage>(Arena*);
+template<> ::dsnet::spec::proto::ToClientMessage* Arena::CreateMaybeMessage<::dsnet::spec::proto::ToClientMessage>(Arena*);
+template<> ::dsnet::spec::proto::ToReplicaMessage* Arena::CreateMaybeMessage<::dsnet::spec::proto::ToReplicaMessage>(Arena*);
+template<> ::dsnet::spec::proto::UnloggedReplyMessage* Arena::CreateMaybeMessage<::dsnet::spec::proto::UnloggedReplyMessage>(Arena*);
+template<> ::dsnet::spec::proto::UnloggedRequestMessage* Arena::CreateMaybeMessage<::dsnet::spec::proto::UnloggedRequestMessage>(Arena*);
+PROTOBUF_NAMESPACE_CLOSE
+namespace dsnet {
+namespace spec {
+namespace proto {
+
+// ===================================================================
+
+class SpeculativeReplyMessage final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:dsnet.spec.proto.SpeculativeReplyMessage) */ {
+ public:
+  inline SpeculativeReplyMessage() : SpeculativeReplyMessage(nullptr) {}
+  ~SpeculativeReplyMessage() override;
+  explicit PROTOBUF_CONSTEXPR SpeculativeReplyMessage(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  SpeculativeReplyMessage(const SpeculativeReplyMessage& from);
+  SpeculativeReplyMessage(SpeculativeReplyMessage&& from) noexcept
+    : SpeculativeReplyMessage() {
+    *this = ::std::move(from);
+  }
+
+  inline SpeculativeReplyMessage& operator=(const SpeculativeReplyMessage& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline SpeculativeReplyMessage& operator=(SpeculativeReplyMessage&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const SpeculativeReplyMessage& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const SpeculativeReplyMessage* internal_default_instance() {
+    return reinterpret_cast<const SpeculativeReplyMessage*>(
+               &_SpeculativeReplyMessage_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    0;
+
+  friend void swap(SpeculativeReplyMessage& a, SpeculativeReplyMessage& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(SpeculativeReplyMessage* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(SpeculativeReplyMessage* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  SpeculativeReplyMessage* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<SpeculativeReplyMessage>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const SpeculativeReplyMessage& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const SpeculativeReplyMessage& from) {
+    SpeculativeReplyMessage::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(SpeculativeReplyMessage* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "dsnet.spec.proto.SpeculativeReplyMessage";
+  }
+  protected:
+  explicit SpeculativeReplyMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kLoghashFieldNumber = 5,
+    kReplyFieldNumber = 6,
+    kClientreqidFieldNumber = 1,
+    kViewFieldNumber = 3,
+    kOpnumFieldNumber = 4,
+    kReplicaidxFieldNumber = 2,
+    kCommittedFieldNumber = 7,
+  };
+  // required bytes loghash = 5;
+  bool has_loghash() const;
+  private:
+  bool _internal_has_loghash() const;
+  public:
+  void clear_loghash();
+  const std::string& loghash() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_loghash(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_loghash();
+  PROTOBUF_NODISCARD std::string* release_loghash();
+  void set_allocated_loghash(std::string* loghash);
+  private:
+  const std::string& _internal_loghash() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_loghash(const std::string& value);
+  std::string* _internal_mutable_loghash();
+  public:
+
+  // required bytes reply = 6;
+  bool has_reply() const;
+  private:
+  bool _internal_has_reply() const;
+  public:
+  void clear_reply();
+  const std::string& reply() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_reply(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_reply();
+  PROTOBUF_NODISCARD std::string* release_reply();
+  void set_allocated_reply(std::string* reply);
+  private:
+  const std::string& _internal_reply() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_reply(const std::string& value);
+  std::string* _internal_mutable_reply();
+  public:
+
+  // required uint64 clientreqid = 1;
+  bool has_clientreqid() const;
+  private:
+  bool _internal_has_clientreqid() const;
+  public:
+  void clear_clientreqid();
+  uint64_t clientreqid() const;
+  void set_clientreqid(uint64_t value);
+  private:
+  uint64_t _internal_clientreqid() const;
+  void _internal_set_clientreqid(uint64_t value);
+  public:
+
+  // required uint64 view = 3;
+  bool has_view() const;
+  private:
+  bool _internal_has_view() const;
+  public:
+  void clear_view();
+  uint64_t view() const;
+  void set_view(uint64_t value);
+  private:
+  uint64_t _internal_view() const;
+  void _internal_set_view(uint64_t value);
+  public:
+
+  // required uint64 opnum = 4;
+  bool has_opnum() const;
+  private:
+  bool _internal_has_opnum() const;
+  public:
+  void clear_opnum();
+  uint64_t opnum() const;
+  void set_opnum(uint64_t value);
+  private:
+  uint64_t _internal_opnum() const;
+  void _internal_set_opnum(uint64_t value);
+  public:
+
+  // required uint32 replicaidx = 2;
+  bool has_replicaidx() const;
+  private:
+  bool _internal_has_replicaidx() const;
+  public:
+  void clear_replicaidx();
+  uint32_t replicaidx() const;
+  void set_replicaidx(uint32_t value);
+  private:
+  uint32_t _internal_replicaidx() const;
+  void _internal_set_replicaidx(uint32_t value);
+  public:
+
+  // required bool committed = 7;
+  bool has_committed() const;
+  private:
+  bool _internal_has_committed() const;
+  public:
+  void clear_committed();
+  bool committed() const;
+  void set_committed(bool value);
+  private:
+  bool _internal_committed() const;
+  void _internal_set_committed(bool value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:dsnet.spec.proto.SpeculativeReplyMessage)
+ private:
+  class _Internal;
+
+  // helper for ByteSizeLong()
+  size_t RequiredFieldsByteSizeFallback() const;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr loghash_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr reply_;
+    uint64_t clientreqid_;
+    uint64_t view_;
+    uint64_t opnum_;
+    uint32_t replicaidx_;
+    bool committed_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_replication_2fspec_2fspec_2dproto_2eproto;
+};
+// -------------------------------------------------------------------
+
+class UnloggedReplyMessage final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:dsnet.spec.proto.UnloggedReplyMessage) */ {
+ public:
+  inline UnloggedReplyMessage() : UnloggedReplyMessage(nullptr) {}
+  ~UnloggedReplyMessage() override;
+  explicit PROTOBUF_CONSTEXPR UnloggedReplyMessage(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  UnloggedReplyMessage(const UnloggedReplyMessage& from);
+  UnloggedReplyMessage(UnloggedReplyMessage&& from) noexcept
+    : UnloggedReplyMessage() {
+    *this = ::std::move(from);
+  }
+
+  inline UnloggedReplyMessage& operator=(const UnloggedReplyMessage& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline UnloggedReplyMessage& operator=(UnloggedReplyMessage&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const UnloggedReplyMessage& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const UnloggedReplyMessage* internal_default_instance() {
+    return reinterpret_cast<const UnloggedReplyMessage*>(
+               &_UnloggedReplyMessage_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    1;
+
+  friend void swap(UnloggedReplyMessage& a, UnloggedReplyMessage& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(UnloggedReplyMessage* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(UnloggedReplyMessage* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  UnloggedReplyMessage* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<UnloggedReplyMessage>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const UnloggedReplyMessage& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const UnloggedReplyMessage& from) {
+    UnloggedReplyMessage::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(UnloggedReplyMessage* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "dsnet.spec.proto.UnloggedReplyMessage";
+  }
+  protected:
+  explicit UnloggedReplyMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kReplyFieldNumber = 1,
+  };
+  // required bytes reply = 1;
+  bool has_reply() const;
+  private:
+  bool _internal_has_reply() const;
+  public:
+  void clear_reply();
+  const std::string& reply() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_reply(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_reply();
+  PROTOBUF_NODISCARD std::string* release_reply();
+  void set_allocated_reply(std::string* reply);
+  private:
+  const std::string& _internal_reply() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_reply(const std::string& value);
+  std::string* _internal_mutable_reply();
+  public:
+
+  // @@protoc_insertion_point(class_scope:dsnet.spec.proto.UnloggedReplyMessage)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr reply_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_replication_2fspec_2fspec_2dproto_2eproto;
+};
+// -------------------------------------------------------------------
+
+class ToClientMessage final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:dsnet.spec.proto.ToClientMessage) */ {
+ public:
+  inline ToClientMessage() : ToClientMessage(nullptr) {}
+  ~ToClientMessage() override;
+  explicit PROTOBUF_CONSTEXPR ToClientMessage(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  ToClientMessage(const ToClientMessage& from);
+  ToClientMessage(ToClientMessage&& from) noexcept
+    : ToClientMessage() {
+    *this = ::std::move(from);
+  }
+
+  inline ToClientMessage& operator=(const ToClientMessage& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline ToClientMessage& operator=(ToClientMessage&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ToClientMessage& default_instance() {
+    return *internal_default_instance();
+  }
+  enum MsgCase {
+    kReply = 1,
+    kUnloggedReply = 2,
+    MSG_NOT_SET = 0,
+  };
+
+  static inline const ToClientMessage* internal_default_instance() {
+    return reinterpret_cast<const ToClientMessage*>(
+               &_ToClientMessage_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    2;
+
+  friend void swap(ToClientMessage& a, ToClientMessage& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(ToClientMessage* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ToClientMessage* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  ToClientMessage* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ToClientMessage>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const ToClientMessage& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ToClientMessage& from) {
+    ToClientMessage::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(ToClientMessage* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "dsnet.spec.proto.ToClientMessage";
+  }
+  protected:
+  explicit ToClientMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kReplyFieldNumber = 1,
+    kUnloggedReplyFieldNumber = 2,
+  };
+  // .dsnet.spec.proto.SpeculativeReplyMessage reply = 1;
+  bool has_reply() const;
+  private:
+  bool _internal_has_reply() const;
+  public:
+  void clear_reply();
+  const ::dsnet::spec::proto::SpeculativeReplyMessage& reply() const;
+  PROTOBUF_NODISCARD ::dsnet::spec::proto::SpeculativeReplyMessage* release_reply();
+  ::dsnet::spec::proto::SpeculativeReplyMessage* mutable_reply();
+  void set_allocated_reply(::dsnet::spec::proto::SpeculativeReplyMessage* reply);
+  private:
+  const ::dsnet::spec::proto::SpeculativeReplyMessage& _internal_reply() const;
+  ::dsnet::spec::proto::SpeculativeReplyMessage* _internal_mutable_reply();
+  public:
+  void unsafe_arena_set_allocated_reply(
+      ::dsnet::spec::proto::SpeculativeReplyMessage* reply);
+  ::dsnet::spec::proto::SpeculativeReplyMessage* unsafe_arena_release_reply();
+
+  // .dsnet.spec.proto.UnloggedReplyMessage unlogged_reply = 2;
+  bool has_unlogged_reply() const;
+  private:
+  bool _internal_has_unlogged_reply() const;
+  public:
+  void clear_unlogged_reply();
+  const ::dsnet::spec::proto::UnloggedReplyMessage& unlogged_reply() const;
+  PROTOBUF_NODISCARD ::dsnet::spec::proto::UnloggedReplyMessage* release_unlogged_reply();
+  ::dsnet::spec::proto::UnloggedReplyMessage* mutable_unlogged_reply();
+  void set_allocated_unlogged_reply(::dsnet::spec::proto::UnloggedReplyMessage* unlogged_reply);
+  private:
+  const ::dsnet::spec::proto::UnloggedReplyMessage& _internal_unlogged_reply() const;
+  ::dsnet::spec::proto::UnloggedReplyMessage* _internal_mutable_unlogged_reply();
+  public:
+  void unsafe_arena_set_allocated_unlogged_reply(
+      ::dsnet::spec::proto::UnloggedReplyMessage* unlogged_reply);
+  ::dsnet::spec::proto::UnloggedReplyMessage* unsafe_arena_release_unlogged_reply();
+
+  void clear_msg();
+  MsgCase msg_case() const;
+  // @@protoc_insertion_point(class_scope:dsnet.spec.proto.ToClientMessage)
+ private:
+  class _Internal;
+  void set_has_reply();
+  void set_has_unlogged_reply();
+
+  inline bool has_msg() const;
+  inline void clear_has_msg();
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    union MsgUnion {
+      constexpr MsgUnion() : _constinit_{} {}
+        ::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized _constinit_;
+      ::dsnet::spec::proto::SpeculativeReplyMessage* reply_;
+      ::dsnet::spec::proto::UnloggedReplyMessage* unlogged_reply_;
+    } msg_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    uint32_t _oneof_case_[1];
+
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_replication_2fspec_2fspec_2dproto_2eproto;
+};
+// -------------------------------------------------------------------
+
+class RequestMessage final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:dsnet.spec.proto.RequestMessage) */ {
+ public:
+  inline RequestMessage() : RequestMessage(nullptr) {}
+  ~RequestMessage() override;
+  explicit PROTOBUF_CONSTEXPR RequestMessage(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  RequestMessage(const RequestMessage& from);
+  RequestMessage(RequestMessage&& from) noexcept
+    : RequestMessage() {
+    *this = ::std::move(from);
+  }
+
+  inline RequestMessage& operator=(const RequestMessage& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline RequestMessage& operator=(RequestMessage&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const RequestMessage& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const RequestMessage* internal_default_instance() {
+    return reinterpret_cast<const RequestMessage*>(
+               &_RequestMessage_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    3;
+
+  friend void swap(RequestMessage& a, RequestMessage& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(RequestMessage* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(RequestMessage* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  RequestMessage* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<RequestMessage>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const RequestMessage& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const RequestMessage& from) {
+    RequestMessage::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(RequestMessage* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "dsnet.spec.proto.RequestMessage";
+  }
+  protected:
+  explicit RequestMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kReqFieldNumber = 1,
+  };
+  // required .dsnet.Request req = 1;
+  bool has_req() const;
+  private:
+  bool _internal_has_req() const;
+  public:
+  void clear_req();
+  const ::dsnet::Request& req() const;
+  PROTOBUF_NODISCARD ::dsnet::Request* release_req();
+  ::dsnet::Request* mutable_req();
+  void set_allocated_req(::dsnet::Request* req);
+  private:
+  const ::dsnet::Request& _internal_req() const;
+  ::dsnet::Request* _internal_mutable_req();
+  public:
+  void unsafe_arena_set_allocated_req(
+      ::dsnet::Request* req);
+  ::dsnet::Request* unsafe_arena_release_req();
+
+  // @@protoc_insertion_point(class_scope:dsnet.spec.proto.RequestMessage)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::dsnet::Request* req_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_replication_2fspec_2fspec_2dproto_2eproto;
+};
+// -------------------------------------------------------------------
+
+class UnloggedRequestMessage final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:dsnet.spec.proto.UnloggedRequestMessage) */ {
+ public:
+  inline UnloggedRequestMessage() : UnloggedRequestMessage(nullptr) {}
+  ~UnloggedRequestMessage() override;
+  explicit PROTOBUF_CONSTEXPR UnloggedRequestMessage(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  UnloggedRequestMessage(const UnloggedRequestMessage& from);
+  UnloggedRequestMessage(UnloggedRequestMessage&& from) noexcept
+    : UnloggedRequestMessage() {
+    *this = ::std::move(from);
+  }
+
+  inline UnloggedRequestMessage& operator=(const UnloggedRequestMessage& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline UnloggedRequestMessage& operator=(UnloggedRequestMessage&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const UnloggedRequestMessage& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const UnloggedRequestMessage* internal_default_instance() {
+    return reinterpret_cast<const UnloggedRequestMessage*>(
+               &_UnloggedRequestMessage_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    4;
+
+  friend void swap(UnloggedRequestMessage& a, UnloggedRequestMessage& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(UnloggedRequestMessage* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(UnloggedRequestMessage* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  UnloggedRequestMessage* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<UnloggedRequestMessage>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const UnloggedRequestMessage& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const UnloggedRequestMessage& from) {
+    UnloggedRequestMessage::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(UnloggedRequestMessage* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "dsnet.spec.proto.UnloggedRequestMessage";
+  }
+  protected:
+  explicit UnloggedRequestMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kReqFieldNumber = 1,
+  };
+  // required .dsnet.UnloggedRequest req = 1;
+  bool has_req() const;
+  private:
+  bool _internal_has_req() const;
+  public:
+  void clear_req();
+  const ::dsnet::UnloggedRequest& req() const;
+  PROTOBUF_NODISCARD ::dsnet::UnloggedRequest* release_req();
+  ::dsnet::UnloggedRequest* mutable_req();
+  void set_allocated_req(::dsnet::UnloggedRequest* req);
+  private:
+  const ::dsnet::UnloggedRequest& _internal_req() const;
+  ::dsnet::UnloggedRequest* _internal_mutable_req();
+  public:
+  void unsafe_arena_set_allocated_req(
+      ::dsnet::UnloggedRequest* req);
+  ::dsnet::UnloggedRequest* unsafe_arena_release_req();
+
+  // @@protoc_insertion_point(class_scope:dsnet.spec.proto.UnloggedRequestMessage)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::dsnet::UnloggedRequest* req_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_replication_2fspec_2fspec_2dproto_2eproto;
+};
+// -------------------------------------------------------------------
+
+class SyncMessage final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:dsnet.spec.proto.SyncMessage) */ {
+ public:
+  inline SyncMessage() : SyncMessage(nullptr) {}
+  ~SyncMessage() override;
+  explicit PROTOBUF_CONSTEXPR SyncMessage(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  SyncMessage(const SyncMessage& from);
+  SyncMessage(SyncMessage&& from) noexcept
+    : SyncMessage() {
+    *this = ::std::move(from);
+  }
+
+  inline SyncMessage& operator=(const SyncMessage& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline SyncMessage& operator=(SyncMessage&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const SyncMessage& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const SyncMessage* internal_default_instance() {
+    return reinterpret_cast<const SyncMessage*>(
+               &_SyncMessage_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    5;
+
+  friend void swap(SyncMessage& a, SyncMessage& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(SyncMessage* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(SyncMessage* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  SyncMessage* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<SyncMessage>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const SyncMessage& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const SyncMessage& from) {
+    SyncMessage::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(SyncMessage* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "dsnet.spec.proto.SyncMessage";
+  }
+  protected:
+  explicit SyncMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kLastCommittedHashFieldNumber = 3,
+    kViewFieldNumber = 1,
+    kLastCommittedFieldNumber = 2,
+    kLastSpeculativeFieldNumber = 4,
+  };
+  // optional bytes lastCommittedHash = 3;
+  bool has_lastcommittedhash() const;
+  private:
+  bool _internal_has_lastcommittedhash() const;
+  public:
+  void clear_lastcommittedhash();
+  const std::string& lastcommittedhash() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_lastcommittedhash(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_lastcommittedhash();
+  PROTOBUF_NODISCARD std::string* release_lastcommittedhash();
+  void set_allocated_lastcommittedhash(std::string* lastcommittedhash);
+  private:
+  const std::string& _internal_lastcommittedhash() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_lastcommittedhash(const std::string& value);
+  std::string* _internal_mutable_lastcommittedhash();
+  public:
+
+  // required uint64 view = 1;
+  bool has_view() const;
+  private:
+  bool _internal_has_view() const;
+  public:
+  void clear_view();
+  uint64_t view() const;
+  void set_view(uint64_t value);
+  private:
+  uint64_t _internal_view() const;
+  void _internal_set_view(uint64_t value);
+  public:
+
+  // optional uint64 lastCommitted = 2;
+  bool has_lastcommitted() const;
+  private:
+  bool _internal_has_lastcommitted() const;
+  public:
+  void clear_lastcommitted();
+  uint64_t lastcommitted() const;
+  void set_lastcommitted(uint64_t value);
+  private:
+  uint64_t _internal_lastcommitted() const;
+  void _internal_set_lastcommitted(uint64_t value);
+  public:
+
+  // optional uint64 lastSpeculative = 4;
+  bool has_lastspeculative() const;
+  private:
+  bool _internal_has_lastspeculative() const;
+  public:
+  void clear_lastspeculative();
+  uint64_t lastspeculative() const;
+  void set_lastspeculative(uint64_t value);
+  private:
+  uint64_t _internal_lastspeculative() const;
+  void _internal_set_lastspeculative(uint64_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:dsnet.spec.proto.SyncMessage)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr lastcommittedhash_;
+    uint64_t view_;
+    uint64_t lastcommitted_;
+    uint64_t lastspeculative_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_replication_2fspec_2fspec_2dproto_2eproto;
+};
+// -------------------------------------------------------------------
+
+class SyncReplyMessage final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:dsnet.spec.proto.SyncReplyMessage) */ {
+ public:
+  inline SyncReplyMessage() : SyncReplyMessage(nullptr) {}
+  ~SyncReplyMessage() override;
+  explicit PROTOBUF_CONSTEXPR SyncReplyMessage(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  SyncReplyMessage(const SyncReplyMessage& from);
+  SyncReplyMessage(SyncReplyMessage&& from) noexcept
+    : SyncReplyMessage() {
+    *this = ::std::move(from);
+  }
+
+  inline SyncReplyMessage& operator=(const SyncReplyMessage& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline SyncReplyMessage& operator=(SyncReplyMessage&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const SyncReplyMessage& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const SyncReplyMessage* internal_default_instance() {
+    return reinterpret_cast<const SyncReplyMessage*>(
+               &_SyncReplyMessage_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    6;
+
+  friend void swap(SyncReplyMessage& a, SyncReplyMessage& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(SyncReplyMessage* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(SyncReplyMessage* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  SyncReplyMessage* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<SyncReplyMessage>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const SyncReplyMessage& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const SyncReplyMessage& from) {
+    SyncReplyMessage::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(SyncReplyMessage* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "dsnet.spec.proto.SyncReplyMessage";
+  }
+  protected:
+  explicit SyncReplyMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kLastSpeculativeHashFieldNumber = 3,
+    kViewFieldNumber = 1,
+    kLastSpeculativeFieldNumber = 2,
+    kReplicaidxFieldNumber = 4,
+  };
+  // required bytes lastSpeculativeHash = 3;
+  bool has_lastspeculativehash() const;
+  private:
+  bool _internal_has_lastspeculativehash() const;
+  public:
+  void clear_lastspeculativehash();
+  const std::string& lastspeculativehash() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_lastspeculativehash(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_lastspeculativehash();
+  PROTOBUF_NODISCARD std::string* release_lastspeculativehash();
+  void set_allocated_lastspeculativehash(std::string* lastspeculativehash);
+  private:
+  const std::string& _internal_lastspeculativehash() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_lastspeculativehash(const std::string& value);
+  std::string* _internal_mutable_lastspeculativehash();
+  public:
+
+  // required uint64 view = 1;
+  bool has_view() const;
+  private:
+  bool _internal_has_view() const;
+  public:
+  void clear_view();
+  uint64_t view() const;
+  void set_view(uint64_t value);
+  private:
+  uint64_t _internal_view() const;
+  void _internal_set_view(uint64_t value);
+  public:
+
+  // required uint64 lastSpeculative = 2;
+  bool has_lastspeculative() const;
+  private:
+  bool _internal_has_lastspeculative() const;
+  public:
+  void clear_lastspeculative();
+  uint64_t lastspeculative() const;
+  void set_lastspeculative(uint64_t value);
+  private:
+  uint64_t _internal_lastspeculative() const;
+  void _internal_set_lastspeculative(uint64_t value);
+  public:
+
+  // required uint32 replicaidx = 4;
+  bool has_replicaidx() const;
+  private:
+  bool _internal_has_replicaidx() const;
+  public:
+  void clear_replicaidx();
+  uint32_t replicaidx() const;
+  void set_replicaidx(uint32_t value);
+  private:
+  uint32_t _internal_replicaidx() const;
+  void _internal_set_replicaidx(uint32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:dsnet.spec.proto.SyncReplyMessage)
+ private:
+  class _Internal;
+
+  // helper for ByteSizeLong()
+  size_t RequiredFieldsByteSizeFallback() const;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr lastspeculativehash_;
+    uint64_t view_;
+    uint64_t lastspeculative_;
+    uint32_t replicaidx_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_replication_2fspec_2fspec_2dproto_2eproto;
+};
+// -------------------------------------------------------------------
+
+class RequestViewChangeMessage final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:dsnet.spec.proto.RequestViewChangeMessage) */ {
+ public:
+  inline RequestViewChangeMessage() : RequestViewChangeMessage(nullptr) {}
+  ~RequestViewChangeMessage() override;
+  explicit PROTOBUF_CONSTEXPR RequestViewChangeMessage(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  RequestViewChangeMessage(const RequestViewChangeMessage& from);
+  RequestViewChangeMessage(RequestViewChangeMessage&& from) noexcept
+    : RequestViewChangeMessage() {
+    *this = ::std::move(from);
+  }
+
+  inline RequestViewChangeMessage& operator=(const RequestViewChangeMessage& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline RequestViewChangeMessage& operator=(RequestViewChangeMessage&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const RequestViewChangeMessage& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const RequestViewChangeMessage* internal_default_instance() {
+    return reinterpret_cast<const RequestViewChangeMessage*>(
+               &_RequestViewChangeMessage_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    7;
+
+  friend void swap(RequestViewChangeMessage& a, RequestViewChangeMessage& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(RequestViewChangeMessage* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(RequestViewChangeMessage* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  RequestViewChangeMessage* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<RequestViewChangeMessage>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const RequestViewChangeMessage& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const RequestViewChangeMessage& from) {
+    RequestViewChangeMessage::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(RequestViewChangeMessage* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "dsnet.spec.proto.RequestViewChangeMessage";
+  }
+  protected:
+  explicit RequestViewChangeMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kViewFieldNumber = 1,
+  };
+  // required uint64 view = 1;
+  bool has_view() const;
+  private:
+  bool _internal_has_view() const;
+  public:
+  void clear_view();
+  uint64_t view() const;
+  void set_view(uint64_t value);
+  private:
+  uint64_t _internal_view() const;
+  void _internal_set_view(uint64_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:dsnet.spec.proto.RequestViewChangeMessage)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    uint64_t view_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_replication_2fspec_2fspec_2dproto_2eproto;
+};
+// -------------------------------------------------------------------
+
+class StartViewChangeMessage final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:dsnet.spec.proto.StartViewChangeMessage) */ {
+ public:
+  inline StartViewChangeMessage() : StartViewChangeMessage(nullptr) {}
+  ~StartViewChangeMessage() override;
+  explicit PROTOBUF_CONSTEXPR StartViewChangeMessage(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  StartViewChangeMessage(const StartViewChangeMessage& from);
+  StartViewChangeMessage(StartViewChangeMessage&& from) noexcept
+    : StartViewChangeMessage() {
+    *this = ::std::move(from);
+  }
+
+  inline StartViewChangeMessage& operator=(const StartViewChangeMessage& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline StartViewChangeMessage& operator=(StartViewChangeMessage&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const StartViewChangeMessage& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const StartViewChangeMessage* internal_default_instance() {
+    return reinterpret_cast<const StartViewChangeMessage*>(
+               &_StartViewChangeMessage_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    8;
+
+  friend void swap(StartViewChangeMessage& a, StartViewChangeMessage& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(StartViewChangeMessage* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(StartViewChangeMessage* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  StartViewChangeMessage* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<StartViewChangeMessage>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const StartViewChangeMessage& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const StartViewChangeMessage& from) {
+    StartViewChangeMessage::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(StartViewChangeMessage* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "dsnet.spec.proto.StartViewChangeMessage";
+  }
+  protected:
+  explicit StartViewChangeMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kViewFieldNumber = 1,
+    kLastCommittedFieldNumber = 3,
+    kReplicaIdxFieldNumber = 2,
+  };
+  // required uint64 view = 1;
+  bool has_view() const;
+  private:
+  bool _internal_has_view() const;
+  public:
+  void clear_view();
+  uint64_t view() const;
+  void set_view(uint64_t value);
+  private:
+  uint64_t _internal_view() const;
+  void _internal_set_view(uint64_t value);
+  public:
+
+  // required uint64 lastCommitted = 3;
+  bool has_lastcommitted() const;
+  private:
+  bool _internal_has_lastcommitted() const;
+  public:
+  void clear_lastcommitted();
+  uint64_t lastcommitted() const;
+  void set_lastcommitted(uint64_t value);
+  private:
+  uint64_t _internal_lastcommitted() const;
+  void _internal_set_lastcommitted(uint64_t value);
+  public:
+
+  // required uint32 replicaIdx = 2;
+  bool has_replicaidx() const;
+  private:
+  bool _internal_has_replicaidx() const;
+  public:
+  void clear_replicaidx();
+  uint32_t replicaidx() const;
+  void set_replicaidx(uint32_t value);
+  private:
+  uint32_t _internal_replicaidx() const;
+  void _internal_set_replicaidx(uint32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:dsnet.spec.proto.StartViewChangeMessage)
+ private:
+  class _Internal;
+
+  // helper for ByteSizeLong()
+  size_t RequiredFieldsByteSizeFallback() const;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    uint64_t view_;
+    uint64_t lastcommitted_;
+    uint32_t replicaidx_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_replication_2fspec_2fspec_2dproto_2eproto;
+};
+// -------------------------------------------------------------------
+
+class DoViewChangeMessage final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:dsnet.spec.proto.DoViewChangeMessage) */ {
+ public:
+  inline DoViewChangeMessage() : DoViewChangeMessage(nullptr) {}
+  ~DoViewChangeMessage() override;
+  explicit PROTOBUF_CONSTEXPR DoViewChangeMessage(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  DoViewChangeMessage(const DoViewChangeMessage& from);
+  DoViewChangeMessage(DoViewChangeMessage&& from) noexcept
+    : DoViewChangeMessage() {
+    *this = ::std::move(from);
+  }
+
+  inline DoViewChangeMessage& operator=(const DoViewChangeMessage& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline DoViewChangeMessage& operator=(DoViewChangeMessage&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const DoViewChangeMessage& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const DoViewChangeMessage* internal_default_instance() {
+    return reinterpret_cast<const DoViewChangeMessage*>(
+               &_DoViewChangeMessage_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    9;
+
+  friend void swap(DoViewChangeMessage& a, DoViewChangeMessage& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(DoViewChangeMessage* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(DoViewChangeMessage* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  DoViewChangeMessage* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<DoViewChangeMessage>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const DoViewChangeMessage& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const DoViewChangeMessage& from) {
+    DoViewChangeMessage::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(DoViewChangeMessage* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "dsnet.spec.proto.DoViewChangeMessage";
+  }
+  protected:
+  explicit DoViewChangeMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kEntriesFieldNumber = 5,
+    kViewFieldNumber = 1,
+    kLastNormalViewFieldNumber = 2,
+    kLastSpeculativeFieldNumber = 3,
+    kLastCommittedFieldNumber = 4,
+    kReplicaIdxFieldNumber = 6,
+  };
+  // repeated .dsnet.MsgLogEntry entries = 5;
+  int entries_size() const;
+  private:
+  int _internal_entries_size() const;
+  public:
+  void clear_entries();
+  ::dsnet::MsgLogEntry* mutable_entries(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::dsnet::MsgLogEntry >*
+      mutable_entries();
+  private:
+  const ::dsnet::MsgLogEntry& _internal_entries(int index) const;
+  ::dsnet::MsgLogEntry* _internal_add_entries();
+  public:
+  const ::dsnet::MsgLogEntry& entries(int index) const;
+  ::dsnet::MsgLogEntry* add_entries();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::dsnet::MsgLogEntry >&
+      entries() const;
+
+  // required uint64 view = 1;
+  bool has_view() const;
+  private:
+  bool _internal_has_view() const;
+  public:
+  void clear_view();
+  uint64_t view() const;
+  void set_view(uint64_t value);
+  private:
+  uint64_t _internal_view() const;
+  void _internal_set_view(uint64_t value);
+  public:
+
+  // required uint64 lastNormalView = 2;
+  bool has_lastnormalview() const;
+  private:
+  bool _internal_has_lastnormalview() const;
+  public:
+  void clear_lastnormalview();
+  uint64_t lastnormalview() const;
+  void set_lastnormalview(uint64_t value);
+  private:
+  uint64_t _internal_lastnormalview() const;
+  void _internal_set_lastnormalview(uint64_t value);
+  public:
+
+  // required uint64 lastSpeculative = 3;
+  bool has_lastspeculative() const;
+  private:
+  bool _internal_has_lastspeculative() const;
+  public:
+  void clear_lastspeculative();
+  uint64_t lastspeculative() const;
+  void set_lastspeculative(uint64_t value);
+  private:
+  uint64_t _internal_lastspeculative() const;
+  void _internal_set_lastspeculative(uint64_t value);
+  public:
+
+  // required uint64 lastCommitted = 4;
+  bool has_lastcommitted() const;
+  private:
+  bool _internal_has_lastcommitted() const;
+  public:
+  void clear_lastcommitted();
+  uint64_t lastcommitted() const;
+  void set_lastcommitted(uint64_t value);
+  private:
+  uint64_t _internal_lastcommitted() const;
+  void _internal_set_lastcommitted(uint64_t value);
+  public:
+
+  // required uint32 replicaIdx = 6;
+  bool has_replicaidx() const;
+  private:
+  bool _internal_has_replicaidx() const;
+  public:
+  void clear_replicaidx();
+  uint32_t replicaidx() const;
+  void set_replicaidx(uint32_t value);
+  private:
+  uint32_t _internal_replicaidx() const;
+  void _internal_set_replicaidx(uint32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:dsnet.spec.proto.DoViewChangeMessage)
+ private:
+  class _Internal;
+
+  // helper for ByteSizeLong()
+  size_t RequiredFieldsByteSizeFallback() const;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::dsnet::MsgLogEntry > entries_;
+    uint64_t view_;
+    uint64_t lastnormalview_;
+    uint64_t lastspeculative_;
+    uint64_t lastcommitted_;
+    uint32_t replicaidx_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_replication_2fspec_2fspec_2dproto_2eproto;
+};
+// -------------------------------------------------------------------
+
+class StartViewMessage final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:dsnet.spec.proto.StartViewMessage) */ {
+ public:
+  inline StartViewMessage() : StartViewMessage(nullptr) {}
+  ~StartViewMessage() override;
+  explicit PROTOBUF_CONSTEXPR StartViewMessage(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  StartViewMessage(const StartViewMessage& from);
+  StartViewMessage(StartViewMessage&& from) noexcept
+    : StartViewMessage() {
+    *this = ::std::move(from);
+  }
+
+  inline StartViewMessage& operator=(const StartViewMessage& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline StartViewMessage& operator=(StartViewMessage&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const StartViewMessage& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const StartViewMessage* internal_default_instance() {
+    return reinterpret_cast<const StartViewMessage*>(
+               &_StartViewMessage_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    10;
+
+  friend void swap(StartViewMessage& a, StartViewMessage& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(StartViewMessage* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(StartViewMessage* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  StartViewMessage* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<StartViewMessage>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const StartViewMessage& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const StartViewMessage& from) {
+    StartViewMessage::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(StartViewMessage* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "dsnet.spec.proto.StartViewMessage";
+  }
+  protected:
+  explicit StartViewMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kEntriesFieldNumber = 4,
+    kViewFieldNumber = 1,
+    kLastSpeculativeFieldNumber = 2,
+    kLastCommittedFieldNumber = 3,
+  };
+  // repeated .dsnet.MsgLogEntry entries = 4;
+  int entries_size() const;
+  private:
+  int _internal_entries_size() const;
+  public:
+  void clear_entries();
+  ::dsnet::MsgLogEntry* mutable_entries(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::dsnet::MsgLogEntry >*
+      mutable_entries();
+  private:
+  const ::dsnet::MsgLogEntry& _internal_entries(int index) const;
+  ::dsnet::MsgLogEntry* _internal_add_entries();
+  public:
+  const ::dsnet::MsgLogEntry& entries(int index) const;
+  ::dsnet::MsgLogEntry* add_entries();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::dsnet::MsgLogEntry >&
+      entries() const;
+
+  // required uint64 view = 1;
+  bool has_view() const;
+  private:
+  bool _internal_has_view() const;
+  public:
+  void clear_view();
+  uint64_t view() const;
+  void set_view(uint64_t value);
+  private:
+  uint64_t _internal_view() const;
+  void _internal_set_view(uint64_t value);
+  public:
+
+  // required uint64 lastSpeculative = 2;
+  bool has_lastspeculative() const;
+  private:
+  bool _internal_has_lastspeculative() const;
+  public:
+  void clear_lastspeculative();
+  uint64_t lastspeculative() const;
+  void set_lastspeculative(uint64_t value);
+  private:
+  uint64_t _internal_lastspeculative() const;
+  void _internal_set_lastspeculative(uint64_t value);
+  public:
+
+  // required uint64 lastCommitted = 3;
+  bool has_lastcommitted() const;
+  private:
+  bool _internal_has_lastcommitted() const;
+  public:
+  void clear_lastcommitted();
+  uint64_t lastcommitted() const;
+  void set_lastcommitted(uint64_t value);
+  private:
+  uint64_t _internal_lastcommitted() const;
+  void _internal_set_lastcommitted(uint64_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:dsnet.spec.proto.StartViewMessage)
+ private:
+  class _Internal;
+
+  // helper for ByteSizeLong()
+  size_t RequiredFieldsByteSizeFallback() const;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::dsnet::MsgLogEntry > entries_;
+    uint64_t view_;
+    uint64_t lastspeculative_;
+    uint64_t lastcommitted_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_replication_2fspec_2fspec_2dproto_2eproto;
+};
+// -------------------------------------------------------------------
+
+class InViewMessage final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:dsnet.spec.proto.InViewMessage) */ {
+ public:
+  inline InViewMessage() : InViewMessage(nullptr) {}
+  ~InViewMessage() override;
+  explicit PROTOBUF_CONSTEXPR InViewMessage(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  InViewMessage(const InViewMessage& from);
+  InViewMessage(InViewMessage&& from) noexcept
+    : InViewMessage() {
+    *this = ::std::move(from);
+  }
+
+  inline InViewMessage& operator=(const InViewMessage& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline InViewMessage& operator=(InViewMessage&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const InViewMessage& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const InViewMessage* internal_default_instance() {
+    return reinterpret_cast<const InViewMessage*>(
+               &_InViewMessage_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    11;
+
+  friend void swap(InViewMessage& a, InViewMessage& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(InViewMessage* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(InViewMessage* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  InViewMessage* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<InViewMessage>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const InViewMessage& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const InViewMessage& from) {
+    InViewMessage::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(InViewMessage* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "dsnet.spec.proto.InViewMessage";
+  }
+  protected:
+  explicit InViewMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kViewFieldNumber = 1,
+    kLastSpeculativeFieldNumber = 2,
+    kReplicaIdxFieldNumber = 3,
+  };
+  // required uint64 view = 1;
+  bool has_view() const;
+  private:
+  bool _internal_has_view() const;
+  public:
+  void clear_view();
+  uint64_t view() const;
+  void set_view(uint64_t value);
+  private:
+  uint64_t _internal_view() const;
+  void _internal_set_view(uint64_t value);
+  public:
+
+  // required uint64 lastSpeculative = 2;
+  bool has_lastspeculative() const;
+  private:
+  bool _internal_has_lastspeculative() const;
+  public:
+  void clear_lastspeculative();
+  uint64_t lastspeculative() const;
+  void set_lastspeculative(uint64_t value);
+  private:
+  uint64_t _internal_lastspeculative() const;
+  void _internal_set_lastspeculative(uint64_t value);
+  public:
+
+  // required uint32 replicaIdx = 3;
+  bool has_replicaidx() const;
+  private:
+  bool _internal_has_replicaidx() const;
+  public:
+  void clear_replicaidx();
+  uint32_t replicaidx() const;
+  void set_replicaidx(uint32_t value);
+  private:
+  uint32_t _internal_replicaidx() const;
+  void _internal_set_replicaidx(uint32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:dsnet.spec.proto.InViewMessage)
+ private:
+  class _Internal;
+
+  // helper for ByteSizeLong()
+  size_t RequiredFieldsByteSizeFallback() const;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    uint64_t view_;
+    uint64_t lastspeculative_;
+    uint32_t replicaidx_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_replication_2fspec_2fspec_2dproto_2eproto;
+};
+// -------------------------------------------------------------------
+
+class FillLogGapMessage final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:dsnet.spec.proto.FillLogGapMessage) */ {
+ public:
+  inline FillLogGapMessage() : FillLogGapMessage(nullptr) {}
+  ~FillLogGapMessage() override;
+  explicit PROTOBUF_CONSTEXPR FillLogGapMessage(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  FillLogGapMessage(const FillLogGapMessage& from);
+  FillLogGapMessage(FillLogGapMessage&& from) noexcept
+    : FillLogGapMessage() {
+    *this = ::std::move(from);
+  }
+
+  inline FillLogGapMessage& operator=(const FillLogGapMessage& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline FillLogGapMessage& operator=(FillLogGapMessage&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const FillLogGapMessage& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const FillLogGapMessage* internal_default_instance() {
+    return reinterpret_cast<const FillLogGapMessage*>(
+               &_FillLogGapMessage_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    12;
+
+  friend void swap(FillLogGapMessage& a, FillLogGapMessage& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(FillLogGapMessage* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(FillLogGapMessage* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  FillLogGapMessage* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<FillLogGapMessage>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const FillLogGapMessage& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const FillLogGapMessage& from) {
+    FillLogGapMessage::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(FillLogGapMessage* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "dsnet.spec.proto.FillLogGapMessage";
+  }
+  protected:
+  explicit FillLogGapMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kViewFieldNumber = 1,
+    kLastCommittedFieldNumber = 2,
+  };
+  // required uint64 view = 1;
+  bool has_view() const;
+  private:
+  bool _internal_has_view() const;
+  public:
+  void clear_view();
+  uint64_t view() const;
+  void set_view(uint64_t value);
+  private:
+  uint64_t _internal_view() const;
+  void _internal_set_view(uint64_t value);
+  public:
+
+  // required uint64 lastCommitted = 2;
+  bool has_lastcommitted() const;
+  private:
+  bool _internal_has_lastcommitted() const;
+  public:
+  void clear_lastcommitted();
+  uint64_t lastcommitted() const;
+  void set_lastcommitted(uint64_t value);
+  private:
+  uint64_t _internal_lastcommitted() const;
+  void _internal_set_lastcommitted(uint64_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:dsnet.spec.proto.FillLogGapMessage)
+ private:
+  class _Internal;
+
+  // helper for ByteSizeLong()
+  size_t RequiredFieldsByteSizeFallback() const;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    uint64_t view_;
+    uint64_t lastcommitted_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_replication_2fspec_2fspec_2dproto_2eproto;
+};
+// -------------------------------------------------------------------
+
+class FillDVCGapMessage final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:dsnet.spec.proto.FillDVCGapMessage) */ {
+ public:
+  inline FillDVCGapMessage() : FillDVCGapMessage(nullptr) {}
+  ~FillDVCGapMessage() override;
+  explicit PROTOBUF_CONSTEXPR FillDVCGapMessage(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  FillDVCGapMessage(const FillDVCGapMessage& from);
+  FillDVCGapMessage(FillDVCGapMessage&& from) noexcept
+    : FillDVCGapMessage() {
+    *this = ::std::move(from);
+  }
+
+  inline FillDVCGapMessage& operator=(const FillDVCGapMessage& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline FillDVCGapMessage& operator=(FillDVCGapMessage&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const FillDVCGapMessage& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const FillDVCGapMessage* internal_default_instance() {
+    return reinterpret_cast<const FillDVCGapMessage*>(
+               &_FillDVCGapMessage_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    13;
+
+  friend void swap(FillDVCGapMessage& a, FillDVCGapMessage& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(FillDVCGapMessage* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(FillDVCGapMessage* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  FillDVCGapMessage* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<FillDVCGapMessage>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const FillDVCGapMessage& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const FillDVCGapMessage& from) {
+    FillDVCGapMessage::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(FillDVCGapMessage* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "dsnet.spec.proto.FillDVCGapMessage";
+  }
+  protected:
+  explicit FillDVCGapMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kViewFieldNumber = 1,
+    kLastCommittedFieldNumber = 2,
+  };
+  // required uint64 view = 1;
+  bool has_view() const;
+  private:
+  bool _internal_has_view() const;
+  public:
+  void clear_view();
+  uint64_t view() const;
+  void set_view(uint64_t value);
+  private:
+  uint64_t _internal_view() const;
+  void _internal_set_view(uint64_t value);
+  public:
+
+  // required uint64 lastCommitted = 2;
+  bool has_lastcommitted() const;
+  private:
+  bool _internal_has_lastcommitted() const;
+  public:
+  void clear_lastcommitted();
+  uint64_t lastcommitted() const;
+  void set_lastcommitted(uint64_t value);
+  private:
+  uint64_t _internal_lastcommitted() const;
+  void _internal_set_lastcommitted(uint64_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:dsnet.spec.proto.FillDVCGapMessage)
+ private:
+  class _Internal;
+
+  // helper for ByteSizeLong()
+  size_t RequiredFieldsByteSizeFallback() const;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    uint64_t view_;
+    uint64_t lastcommitted_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_replication_2fspec_2fspec_2dproto_2eproto;
+};
+// -------------------------------------------------------------------
+
+class ToReplicaMessage final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:dsnet.spec.proto.ToReplicaMessage) */ {
+ public:
+  inline ToReplicaMessage() : ToReplicaMessage(nullptr) {}
+  ~ToReplicaMessage() override;
+  explicit PROTOBUF_CONSTEXPR ToReplicaMessage(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  ToReplicaMessage(const ToReplicaMessage& from);
+  ToReplicaMessage(ToReplicaMessage&& from) noexcept
+    : ToReplicaMessage() {
+    *this = ::std::move(from);
+  }
+
+  inline ToReplicaMessage& operator=(const ToReplicaMessage& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline ToReplicaMessage& operator=(ToReplicaMessage&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ToReplicaMessage& default_instance() {
+    return *internal_default_instance();
+  }
+  enum MsgCase {
+    kRequest = 1,
+    kUnloggedRequest = 2,
+    kSync = 3,
+    kSyncReply = 4,
+    kRequestViewChange = 5,
+    kStartViewChange = 6,
+    kDoViewChange = 7,
+    kStartView = 8,
+    kInView = 9,
+    kFillLogGap = 10,
+    kFillDvcGap = 11,
+    MSG_NOT_SET = 0,
+  };
+
+  static inline const ToReplicaMessage* internal_default_instance() {
+    return reinterpret_cast<const ToReplicaMessage*>(
+               &_ToReplicaMessage_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    14;
+
+  friend void swap(ToReplicaMessage& a, ToReplicaMessage& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(ToReplicaMessage* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ToReplicaMessage* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  ToReplicaMessage* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ToReplicaMessage>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const ToReplicaMessage& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ToReplicaMessage& from) {
+    ToReplicaMessage::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(ToReplicaMessage* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "dsnet.spec.proto.ToReplicaMessage";
+  }
+  protected:
+  explicit ToReplicaMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kRequestFieldNumber = 1,
+    kUnloggedRequestFieldNumber = 2,
+    kSyncFieldNumber = 3,
+    kSyncReplyFieldNumber = 4,
+    kRequestViewChangeFieldNumber = 5,
+    kStartViewChangeFieldNumber = 6,
+    kDoViewChangeFieldNumber = 7,
+    kStartViewFieldNumber = 8,
+    kInViewFieldNumber = 9,
+    kFillLogGapFieldNumber = 10,
+    kFillDvcGapFieldNumber = 11,
+  };
+  // .dsnet.spec.proto.RequestMessage request = 1;
+  bool has_request() const;
+  private:
+  bool _internal_has_request() const;
+  public:
+  void clear_request();
+  const ::dsnet::spec::proto::RequestMessage& request() const;
+  PROTOBUF_NODISCARD ::dsnet::spec::proto::RequestMessage* release_request();
+  ::dsnet::spec::proto::RequestMessage* mutable_request();
+  void set_allocated_request(::dsnet::spec::proto::RequestMessage* request);
+  private:
+  const ::dsnet::spec::proto::RequestMessage& _internal_request() const;
+  ::dsnet::spec::proto::RequestMessage* _internal_mutable_request();
+  public:
+  void unsafe_arena_set_allocated_request(
+      ::dsnet::spec::proto::RequestMessage* request);
+  ::dsnet::spec::proto::RequestMessage* unsafe_arena_release_request();
+
+  // .dsnet.spec.proto.UnloggedRequestMessage unlogged_request = 2;
+  bool has_unlogged_request() const;
+  private:
+  bool _internal_has_unlogged_request() const;
+  public:
+  void clear_unlogged_request();
+  const ::dsnet::spec::proto::UnloggedRequestMessage& unlogged_request() const;
+  PROTOBUF_NODISCARD ::dsnet::spec::proto::UnloggedRequestMessage* release_unlogged_request();
+  ::dsnet::spec::proto::UnloggedRequestMessage* mutable_unlogged_request();
+  void set_allocated_unlogged_request(::dsnet::spec::proto::UnloggedRequestMessage* unlogged_request);
+  private:
+  const ::dsnet::spec::proto::UnloggedRequestMessage& _internal_unlogged_request() const;
+  ::dsnet::spec::proto::UnloggedRequestMessage* _internal_mutable_unlogged_request();
+  public:
+  void unsafe_arena_set_allocated_unlogged_request(
+      ::dsnet::spec::proto::UnloggedRequestMessage* unlogged_request);
+  ::dsnet::spec::proto::UnloggedRequestMessage* unsafe_arena_release_unlogged_request();
+
+  // .dsnet.spec.proto.SyncMessage sync = 3;
+  bool has_sync() const;
+  private:
+  bool _internal_has_sync() const;
+  public:
+  void clear_sync();
+  const ::dsnet::spec::proto::SyncMessage& sync() const;
+  PROTOBUF_NODISCARD ::dsnet::spec::proto::SyncMessage* release_sync();
+  ::dsnet::spec::proto::SyncMessage* mutable_sync();
+  void set_allocated_sync(::dsnet::spec::proto::SyncMessage* sync);
+  private:
+  const ::dsnet::spec::proto::SyncMessage& _internal_sync() const;
+  ::dsnet::spec::proto::SyncMessage* _internal_mutable_sync();
+  public:
+  void unsafe_arena_set_allocated_sync(
+      ::dsnet::spec::proto::SyncMessage* sync);
+  ::dsnet::spec::proto::SyncMessage* unsafe_arena_release_sync();
+
+  // .dsnet.spec.proto.SyncReplyMessage sync_reply = 4;
+  bool has_sync_reply() const;
+  private:
+  bool _internal_has_sync_reply() const;
+  public:
+  void clear_sync_reply();
+  const ::dsnet::spec::proto::SyncReplyMessage& sync_reply() const;
+  PROTOBUF_NODISCARD ::dsnet::spec::proto::SyncReplyMessage* release_sync_reply();
+  ::dsnet::spec::proto::SyncReplyMessage* mutable_sync_reply();
+  void set_allocated_sync_reply(::dsnet::spec::proto::SyncReplyMessage* sync_reply);
+  private:
+  const ::dsnet::spec::proto::SyncReplyMessage& _internal_sync_reply() const;
+  ::dsnet::spec::proto::SyncReplyMessage* _internal_mutable_sync_reply();
+  public:
+  void unsafe_arena_set_allocated_sync_reply(
+      ::dsnet::spec::proto::SyncReplyMessage* sync_reply);
+  ::dsnet::spec::proto::SyncReplyMessage* unsafe_arena_release_sync_reply();
+
+  // .dsnet.spec.proto.RequestViewChangeMessage request_view_change = 5;
+  bool has_request_view_change() const;
+  private:
+  bool _internal_has_request_view_change() const;
+  public:
+  void clear_request_view_change();
+  const ::dsnet::spec::proto::RequestViewChangeMessage& request_view_change() const;
+  PROTOBUF_NODISCARD ::dsnet::spec::proto::RequestViewChangeMessage* release_request_view_change();
+  ::dsnet::spec::proto::RequestViewChangeMessage* mutable_request_view_change();
+  void set_allocated_request_view_change(::dsnet::spec::proto::RequestViewChangeMessage* request_view_change);
+  private:
+  const ::dsnet::spec::proto::RequestViewChangeMessage& _internal_request_view_change() const;
+  ::dsnet::spec::proto::RequestViewChangeMessage* _internal_mutable_request_view_change();
+  public:
+  void unsafe_arena_set_allocated_request_view_change(
+      ::dsnet::spec::proto::RequestViewChangeMessage* request_view_change);
+  ::dsnet::spec::proto::RequestViewChangeMessage* unsafe_arena_release_request_view_change();
+
+  // .dsnet.spec.proto.StartViewChangeMessage start_view_change = 6;
+  bool has_start_view_change() const;
+  private:
+  bool _internal_has_start_view_change() const;
+  public:
+  void clear_start_view_change();
+  const ::dsnet::spec::proto::StartViewChangeMessage& start_view_change() const;
+  PROTOBUF_NODISCARD ::dsnet::spec::proto::StartViewChangeMessage* release_start_view_change();
+  ::dsnet::spec::proto::StartViewChangeMessage* mutable_start_view_change();
+  void set_allocated_start_view_change(::dsnet::spec::proto::StartViewChangeMessage* start_view_change);
+  private:
+  const ::dsnet::spec::proto::StartViewChangeMessage& _internal_start_view_change() const;
+  ::dsnet::spec::proto::StartViewChangeMessage* _internal_mutable_start_view_change();
+  public:
+  void unsafe_arena_set_allocated_start_view_change(
+      ::dsnet::spec::proto::StartViewChangeMessage* start_view_change);
+  ::dsnet::spec::proto::StartViewChangeMessage* unsafe_arena_release_start_view_change();
+
+  // .dsnet.spec.proto.DoViewChangeMessage do_view_change = 7;
+  bool has_do_view_change() const;
+  private:
+  bool _internal_has_do_view_change() const;
+  public:
+  void clear_do_view_change();
+  const ::dsnet::spec::proto::DoViewChangeMessage& do_view_change() const;
+  PROTOBUF_NODISCARD ::dsnet::spec::proto::DoViewChangeMessage* release_do_view_change();
+  ::dsnet::spec::proto::DoViewChangeMessage* mutable_do_view_change();
+  void set_allocated_do_view_change(::dsnet::spec::proto::DoViewChangeMessage* do_view_change);
+  private:
+  const ::dsnet::spec::proto::DoViewChangeMessage& _internal_do_view_change() const;
+  ::dsnet::spec::proto::DoViewChangeMessage* _internal_mutable_do_view_change();
+  public:
+  void unsafe_arena_set_allocated_do_view_change(
+      ::dsnet::spec::proto::DoViewChangeMessage* do_view_change);
+  ::dsnet::spec::proto::DoViewChangeMessage* unsafe_arena_release_do_view_change();
+
+  // .dsnet.spec.proto.StartViewMessage start_view = 8;
+  bool has_start_view() const;
+  private:
+  bool _internal_has_start_view() const;
+  public:
+  void clear_start_view();
+  const ::dsnet::spec::proto::StartViewMessage& start_view() const;
+  PROTOBUF_NODISCARD ::dsnet::spec::proto::StartViewMessage* release_start_view();
+  ::dsnet::spec::proto::StartViewMessage* mutable_start_view();
+  void set_allocated_start_view(::dsnet::spec::proto::StartViewMessage* start_view);
+  private:
+  const ::dsnet::spec::proto::StartViewMessage& _internal_start_view() const;
+  ::dsnet::spec::proto::StartViewMessage* _internal_mutable_start_view();
+  public:
+  void unsafe_arena_set_allocated_start_view(
+      ::dsnet::spec::proto::StartViewMessage* start_view);
+  ::dsnet::spec::proto::StartViewMessage* unsafe_arena_release_start_view();
+
+  // .dsnet.spec.proto.InViewMessage in_view = 9;
+  bool has_in_view() const;
+  private:
+  bool _internal_has_in_view() const;
+  public:
+  void clear_in_view();
+  const ::dsnet::spec::proto::InViewMessage& in_view() const;
+  PROTOBUF_NODISCARD ::dsnet::spec::proto::InViewMessage* release_in_view();
+  ::dsnet::spec::proto::InViewMessage* mutable_in_view();
+  void set_allocated_in_view(::dsnet::spec::proto::InViewMessage* in_view);
+  private:
+  const ::dsnet::spec::proto::InViewMessage& _internal_in_view() const;
+  ::dsnet::spec::proto::InViewMessage* _internal_mutable_in_view();
+  public:
+  void unsafe_arena_set_allocated_in_view(
+      ::dsnet::spec::proto::InViewMessage* in_view);
+  ::dsnet::spec::proto::InViewMessage* unsafe_arena_release_in_view();
+
+  // .dsnet.spec.proto.FillLogGapMessage fill_log_gap = 10;
+  bool has_fill_log_gap() const;
+  private:
+  bool _internal_has_fill_log_gap() const;
+  public:
+  void clear_fill_log_gap();
+  const ::dsnet::spec::proto::FillLogGapMessage& fill_log_gap() const;
+  PROTOBUF_NODISCARD ::dsnet::spec::proto::FillLogGapMessage* release_fill_log_gap();
+  ::dsnet::spec::proto::FillLogGapMessage* mutable_fill_log_gap();
+  void set_allocated_fill_log_gap(::dsnet::spec::proto::FillLogGapMessage* fill_log_gap);
+  private:
+  const ::dsnet::spec::proto::FillLogGapMessage& _internal_fill_log_gap() const;
+  ::dsnet::spec::proto::FillLogGapMessage* _internal_mutable_fill_log_gap();
+  public:
+  void unsafe_arena_set_allocated_fill_log_gap(
+      ::dsnet::spec::proto::FillLogGapMessage* fill_log_gap);
+  ::dsnet::spec::proto::FillLogGapMessage* unsafe_arena_release_fill_log_gap();
+
+  // .dsnet.spec.proto.FillDVCGapMessage fill_dvc_gap = 11;
+  bool has_fill_dvc_gap() const;
+  private:
+  bool _internal_has_fill_dvc_gap() const;
+  public:
+  void clear_fill_dvc_gap();
+  const ::dsnet::spec::proto::FillDVCGapMessage& fill_dvc_gap() const;
+  PROTOBUF_NODISCARD ::dsnet::spec::proto::FillDVCGapMessage* release_fill_dvc_gap();
+  ::dsnet::spec::proto::FillDVCGapMessage* mutable_fill_dvc_gap();
+  void set_allocated_fill_dvc_gap(::dsnet::spec::proto::FillDVCGapMessage* fill_dvc_gap);
+  private:
+  const ::dsnet::spec::proto::FillDVCGapMessage& _internal_fill_dvc_gap() const;
+  ::dsnet::spec::proto::FillDVCGapMessage* _internal_mutable_fill_dvc_gap();
+  public:
+  void unsafe_arena_set_allocated_fill_dvc_gap(
+      ::dsnet::spec::proto::FillDVCGapMessage* fill_dvc_gap);
+  ::dsnet::spec::proto::FillDVCGapMessage* unsafe_arena_release_fill_dvc_gap();
+
+  void clear_msg();
+  MsgCase msg_case() const;
+  // @@protoc_insertion_point(class_scope:dsnet.spec.proto.ToReplicaMessage)
+ private:
+  class _Internal;
+  void set_has_request();
+  void set_has_unlogged_request();
+  void set_has_sync();
+  void set_has_sync_reply();
+  void set_has_request_view_change();
+  void set_has_start_view_change();
+  void set_has_do_view_change();
+  void set_has_start_view();
+  void set_has_in_view();
+  void set_has_fill_log_gap();
+  void set_has_fill_dvc_gap();
+
+  inline bool has_msg() const;
+  inline void clear_has_msg();
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    union MsgUnion {
+      constexpr MsgUnion() : _constinit_{} {}
+        ::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized _constinit_;
+      ::dsnet::spec::proto::RequestMessage* request_;
+      ::dsnet::spec::proto::UnloggedRequestMessage* unlogged_request_;
+      ::dsnet::spec::proto::SyncMessage* sync_;
+      ::dsnet::spec::proto::SyncReplyMessage* sync_reply_;
+      ::dsnet::spec::proto::RequestViewChangeMessage* request_view_change_;
+      ::dsnet::spec::proto::StartViewChangeMessage* start_view_change_;
+      ::dsnet::spec::proto::DoViewChangeMessage* do_view_change_;
+      ::dsnet::spec::proto::StartViewMessage* start_view_;
+      ::dsnet::spec::proto::InViewMessage* in_view_;
+      ::dsnet::spec::proto::FillLogGapMessage* fill_log_gap_;
+      ::dsnet::spec::proto::FillDVCGapMessage* fill_dvc_gap_;
+    } msg_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    uint32_t _oneof_case_[1];
+
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_replication_2fspec_2fspec_2dproto_2eproto;
+};
+// ===================================================================
+
+
+// ===================================================================
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
+#endif  // __GNUC__
+// SpeculativeReplyMessage
+
+// required uint64 clientreqid = 1;
+inline bool SpeculativeReplyMessage::_internal_has_clientreqid() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool SpeculativeReplyMessage::has_clientreqid() const {
+  return _internal_has_clientreqid();
+}
+inline void SpeculativeReplyMessage::clear_clientreqid() {
+  _impl_.clientreqid_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline uint64_t SpeculativeReplyMessage::_internal_clientreqid() const {
+  return _impl_.clientreqid_;
+}
+inline uint64_t SpeculativeReplyMessage::clientreqid() const {
+  // @@protoc_insertion_point(field_get:dsnet.spec.proto.SpeculativeReplyMessage.clientreqid)
+  return _internal_clientreqid();
+}
+inline void SpeculativeReplyMessage::_internal_set_clientreqid(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.clientreqid_ = value;
+}
+inline void SpeculativeReplyMessage::set_clientreqid(uint64_t value) {
+  _internal_set_clientreqid(value);
+  // @@protoc_insertion_point(field_set:dsnet.spec.proto.SpeculativeReplyMessage.clientreqid)
+}
+
+// required uint32 replicaidx = 2;
+inline bool SpeculativeReplyMessage::_internal_has_replicaidx() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000020u) != 0;
+  return value;
+}
+inline bool SpeculativeReplyMessage::has_replicaidx() const {
+  return _internal_has_replicaidx();
+}
+inline void SpeculativeReplyMessage::clear_replicaidx() {
+  _impl_.replicaidx_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000020u;
+}
+inline uint32_t SpeculativeReplyMessage::_internal_replicaidx() const {
+  return _impl_.replicaidx_;
+}
+inline uint32_t SpeculativeReplyMessage::replicaidx() const {
+  // @@protoc_insertion_point(field_get:dsnet.spec.proto.SpeculativeReplyMessage.replicaidx)
+  return _internal_replicaidx();
+}
+inline void SpeculativeReplyMessage::_internal_set_replicaidx(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000020u;
+  _impl_.replicaidx_ = value;
+}
+inline void SpeculativeReplyMessage::set_replicaidx(uint32_t value) {
+  _internal_set_replicaidx(value);
+  // @@protoc_insertion_point(field_set:dsnet.spec.proto.SpeculativeReplyMessage.replicaidx)
+}
+
+// required uint64 view = 3;
+inline bool SpeculativeReplyMessage::_internal_has_view() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  return value;
+}
+inline bool SpeculativeReplyMessage::has_view() const {
+  return _internal_has_view();
+}
+inline void SpeculativeReplyMessage::clear_view() {
+  _impl_.view_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000008u;
+}
+inline uint64_t SpeculativeReplyMessage::_internal_view() const {
+  return _impl_.view_;
+}
+inline uint64_t SpeculativeReplyMessage::view() const {
+  // @@protoc_insertion_point(field_get:dsnet.spec.proto.SpeculativeReplyMessage.view)
+  return _internal_view();
+}
+inline void SpeculativeReplyMessage::_internal_set_view(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  _impl_.view_ = value;
+}
+inline void SpeculativeReplyMessage::set_view(uint64_t value) {
+  _internal_set_view(value);
+  // @@protoc_insertion_point(field_set:dsnet.spec.proto.SpeculativeReplyMessage.view)
+}
+
+// required uint64 opnum = 4;
+inline bool SpeculativeReplyMessage::_internal_has_opnum() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000010u) != 0;
+  return value;
+}
+inline bool SpeculativeReplyMessage::has_opnum() const {
+  return _internal_has_opnum();
+}
+inline void SpeculativeReplyMessage::clear_opnum() {
+  _impl_.opnum_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000010u;
+}
+inline uint64_t SpeculativeReplyMessage::_internal_opnum() const {
+  return _impl_.opnum_;
+}
+inline uint64_t SpeculativeReplyMessage::opnum() const {
+  // @@protoc_insertion_point(field_get:dsnet.spec.proto.SpeculativeReplyMessage.opnum)
+  return _internal_opnum();
+}
+inline void SpeculativeReplyMessage::_internal_set_opnum(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000010u;
+  _impl_.opnum_ = value;
+}
+inline void SpeculativeReplyMessage::set_opnum(uint64_t value) {
+  _internal_set_opnum(value);
+  // @@protoc_insertion_point(field_set:dsnet.spec.proto.SpeculativeReplyMessage.opnum)
+}
+
+// required bytes loghash = 5;
+inline bool SpeculativeReplyMessage::_internal_has_loghash() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool SpeculativeReplyMessage::has_loghash() const {
+  return _internal_has_loghash();
+}
+inline void SpeculativeReplyMessage::clear_loghash() {
+  _impl_.loghash_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& SpeculativeReplyMessage::loghash() const {
+  // @@protoc_insertion_point(field_get:dsnet.spec.proto.SpeculativeReplyMessage.loghash)
+  return _internal_loghash();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void SpeculativeReplyMessage::set_loghash(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.loghash_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:dsnet.spec.proto.SpeculativeReplyMessage.loghash)
+}
+inline std::string* SpeculativeReplyMessage::mutable_loghash() {
+  std::string* _s = _internal_mutable_loghash();
+  // @@protoc_insertion_point(field_mutable:dsnet.spec.proto.SpeculativeReplyMessage.loghash)
+  return _s;
+}
+inline const std::string& SpeculativeReplyMessage::_internal_loghash() const {
+  return _impl_.loghash_.Get();
+}
+inline void SpeculativeReplyMessage::_internal_set_loghash(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.loghash_.Set(value, GetArenaForAllocation());
+}
+inline std::string* SpeculativeReplyMessage::_internal_mutable_loghash() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.loghash_.Mutable(GetArenaForAllocation());
+}
+inline std::string* SpeculativeReplyMessage::release_loghash() {
+  // @@protoc_insertion_point(field_release:dsnet.spec.proto.SpeculativeReplyMessage.loghash)
+  if (!_internal_has_loghash()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.loghash_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.loghash_.IsDefault()) {
+    _impl_.loghash_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void SpeculativeReplyMessage::set_allocated_loghash(std::string* loghash) {
+  if (loghash != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.loghash_.SetAllocated(loghash, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.loghash_.IsDefault()) {
+    _impl_.loghash_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:dsnet.spec.proto.SpeculativeReplyMessage.loghash)
+}
+
+// required bytes reply = 6;
+inline bool SpeculativeReplyMessage::_internal_has_reply() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool SpeculativeReplyMessage::has_reply() const {
+  return _internal_has_reply();
+}
+inline void SpeculativeReplyMessage::clear_reply() {
+  _impl_.reply_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline const std::string& SpeculativeReplyMessage::reply() const {
+  // @@protoc_insertion_point(field_get:dsnet.spec.proto.SpeculativeReplyMessage.reply)
+  return _internal_reply();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void SpeculativeReplyMessage::set_reply(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000002u;
+ _impl_.reply_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:dsnet.spec.proto.SpeculativeReplyMessage.reply)
+}
+inline std::string* SpeculativeReplyMessage::mutable_reply() {
+  std::string* _s = _internal_mutable_reply();
+  // @@protoc_insertion_point(field_mutable:dsnet.spec.proto.SpeculativeReplyMessage.reply)
+  return _s;
+}
+inline const std::string& SpeculativeReplyMessage::_internal_reply() const {
+  return _impl_.reply_.Get();
+}
+inline void SpeculativeReplyMessage::_internal_set_reply(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.reply_.Set(value, GetArenaForAllocation());
+}
+inline std::string* SpeculativeReplyMessage::_internal_mutable_reply() {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  return _impl_.reply_.Mutable(GetArenaForAllocation());
+}
+inline std::string* SpeculativeReplyMessage::release_reply() {
+  // @@protoc_insertion_point(field_release:dsnet.spec.proto.SpeculativeReplyMessage.reply)
+  if (!_internal_has_reply()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  auto* p = _impl_.reply_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.reply_.IsDefault()) {
+    _impl_.reply_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void SpeculativeReplyMessage::set_allocated_reply(std::string* reply) {
+  if (reply != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  _impl_.reply_.SetAllocated(reply, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.reply_.IsDefault()) {
+    _impl_.reply_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:dsnet.spec.proto.SpeculativeReplyMessage.reply)
+}
+
+// required bool committed = 7;
+inline bool SpeculativeReplyMessage::_internal_has_committed() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000040u) != 0;
+  return value;
+}
+inline bool SpeculativeReplyMessage::has_committed() const {
+  return _internal_has_committed();
+}
+inline void SpeculativeReplyMessage::clear_committed() {
+  _impl_.committed_ = false;
+  _impl_._has_bits_[0] &= ~0x00000040u;
+}
+inline bool SpeculativeReplyMessage::_internal_committed() const {
+  return _impl_.committed_;
+}
+inline bool SpeculativeReplyMessage::committed() const {
+  // @@protoc_insertion_point(field_get:dsnet.spec.proto.SpeculativeReplyMessage.committed)
+  return _internal_committed();
+}
+inline void SpeculativeReplyMessage::_internal_set_committed(bool value) {
+  _impl_._has_bits_[0] |= 0x00000040u;
+  _impl_.committed_ = value;
+}
+inline void SpeculativeReplyMessage::set_committed(bool value) {
+  _internal_set_committed(value);
+  // @@protoc_insertion_point(field_set:dsnet.spec.proto.SpeculativeReplyMessage.committed)
+}
+
+// -------------------------------------------------------------------
+
+// UnloggedReplyMessage
+
+// required bytes reply = 1;
+inline bool UnloggedReplyMessage::_internal_has_reply() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool UnloggedReplyMessage::has_reply() const {
+  return _internal_has_reply();
+}
+inline void UnloggedReplyMessage::clear_reply() {
+  _impl_.reply_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& UnloggedReplyMessage::reply() const {
+  // @@protoc_insertion_point(field_get:dsnet.spec.proto.UnloggedReplyMessage.reply)
+  return _internal_reply();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void UnloggedReplyMessage::set_reply(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.reply_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:dsnet.spec.proto.UnloggedReplyMessage.reply)
+}
+inline std::string* UnloggedReplyMessage::mutable_reply() {
+  std::string* _s = _internal_mutable_reply();
+  // @@protoc_insertion_point(field_mutable:dsnet.spec.proto.UnloggedReplyMessage.reply)
+  return _s;
+}
+inline const std::string& UnloggedReplyMessage::_internal_reply() const {
+  return _impl_.reply_.Get();
+}
+inline void UnloggedReplyMessage::_internal_set_reply(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.reply_.Set(value, GetArenaForAllocation());
+}
+inline std::string* UnloggedReplyMessage::_internal_mutable_reply() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.reply_.Mutable(GetArenaForAllocation());
+}
+inline std::string* UnloggedReplyMessage::release_reply() {
+  // @@protoc_insertion_point(field_release:dsnet.spec.proto.UnloggedReplyMessage.reply)
+  if (!_internal_has_reply()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.reply_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.reply_.IsDefault()) {
+    _impl_.reply_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void UnloggedReplyMessage::set_allocated_reply(std::string* reply) {
+  if (reply != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.reply_.SetAllocated(reply, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.reply_.IsDefault()) {
+    _impl_.reply_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:dsnet.spec.proto.UnloggedReplyMessage.reply)
+}
+
+// -------------------------------------------------------------------
+
+// ToClientMessage
+
+// .dsnet.spec.proto.SpeculativeReplyMessage reply = 1;
+inline bool ToClientMessage::_internal_has_reply() const {
+  return msg_case() == kReply;
+}
+inline bool ToClientMessage::has_reply() const {
+  return _internal_has_reply();
+}
+inline void ToClientMessage::set_has_reply() {
+  _impl_._oneof_case_[0] = kReply;
+}
+inline void ToClientMessage::clear_reply() {
+  if (_internal_has_reply()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.msg_.reply_;
+    }
+    clear_has_msg();
+  }
+}
+inline ::dsnet::spec::proto::SpeculativeReplyMessage* ToClientMessage::release_reply() {
+  // @@protoc_insertion_point(field_release:dsnet.spec.proto.ToClientMessage.reply)
+  if (_internal_has_reply()) {
+    clear_has_msg();
+    ::dsnet::spec::proto::SpeculativeReplyMessage* temp = _impl_.msg_.reply_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.msg_.reply_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::dsnet::spec::proto::SpeculativeReplyMessage& ToClientMessage::_internal_reply() const {
+  return _internal_has_reply()
+      ? *_impl_.msg_.reply_
+      : reinterpret_cast< ::dsnet::spec::proto::SpeculativeReplyMessage&>(::dsnet::spec::proto::_SpeculativeReplyMessage_default_instance_);
+}
+inline const ::dsnet::spec::proto::SpeculativeReplyMessage& ToClientMessage::reply() const {
+  // @@protoc_insertion_point(field_get:dsnet.spec.proto.ToClientMessage.reply)
+  return _internal_reply();
+}
+inline ::dsnet::spec::proto::SpeculativeReplyMessage* ToClientMessage::unsafe_arena_release_reply() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:dsnet.spec.proto.ToClientMessage.reply)
+  if (_internal_has_reply()) {
+    clear_has_msg();
+    ::dsnet::spec::proto::SpeculativeReplyMessage* temp = _impl_.msg_.reply_;
+    _impl_.msg_.reply_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void ToClientMessage::unsafe_arena_set_allocated_reply(::dsnet::spec::proto::SpeculativeReplyMessage* reply) {
+  clear_msg();
+  if (reply) {
+    set_has_reply();
+    _impl_.msg_.reply_ = reply;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:dsnet.spec.proto.ToClientMessage.reply)
+}
+inline ::dsnet::spec::proto::SpeculativeReplyMessage* ToClientMessage::_internal_mutable_reply() {
+  if (!_internal_has_reply()) {
+    clear_msg();
+    set_has_reply();
+    _impl_.msg_.reply_ = CreateMaybeMessage< ::dsnet::spec::proto::SpeculativeReplyMessage >(GetArenaForAllocation());
+  }
+  return _impl_.msg_.reply_;
+}
+inline ::dsnet::spec::proto::SpeculativeReplyMessage* ToClientMessage::mutable_reply() {
+  ::dsnet::spec::proto::SpeculativeReplyMessage* _msg = _internal_mutable_reply();
+  // @@protoc_insertion_point(field_mutable:dsnet.spec.proto.ToClientMessage.reply)
+  return _msg;
+}
+
+// .dsnet.spec.proto.UnloggedReplyMessage unlogged_reply = 2;
+inline bool ToClientMessage::_internal_has_unlogged_reply() const {
+  return msg_case() == kUnloggedReply;
+}
+inline bool ToClientMessage::has_unlogged_reply() const {
+  return _internal_has_unlogged_reply();
+}
+inline void ToClientMessage::set_has_unlogged_reply() {
+  _impl_._oneof_case_[0] = kUnloggedReply;
+}
+inline void ToClientMessage::clear_unlogged_reply() {
+  if (_internal_has_unlogged_reply()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.msg_.unlogged_reply_;
+    }
+    clear_has_msg();
+  }
+}
+inline ::dsnet::spec::proto::UnloggedReplyMessage* ToClientMessage::release_unlogged_reply() {
+  // @@protoc_insertion_point(field_release:dsnet.spec.proto.ToClientMessage.unlogged_reply)
+  if (_internal_has_unlogged_reply()) {
+    clear_has_msg();
+    ::dsnet::spec::proto::UnloggedReplyMessage* temp = _impl_.msg_.unlogged_reply_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.msg_.unlogged_reply_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::dsnet::spec::proto::UnloggedReplyMessage& ToClientMessage::_internal_unlogged_reply() const {
+  return _internal_has_unlogged_reply()
+      ? *_impl_.msg_.unlogged_reply_
+      : reinterpret_cast< ::dsnet::spec::proto::UnloggedReplyMessage&>(::dsnet::spec::proto::_UnloggedReplyMessage_default_instance_);
+}
+inline const ::dsnet::spec::proto::UnloggedReplyMessage& ToClientMessage::unlogged_reply() const {
+  // @@protoc_insertion_point(field_get:dsnet.spec.proto.ToClientMessage.unlogged_reply)
+  return _internal_unlogged_reply();
+}
+inline ::dsnet::spec::proto::UnloggedReplyMessage* ToClientMessage::unsafe_arena_release_unlogged_reply() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:dsnet.spec.proto.ToClientMessage.unlogged_reply)
+  if (_internal_has_unlogged_reply()) {
+    clear_has_msg();
+    ::dsnet::spec::proto::UnloggedReplyMessage* temp = _impl_.msg_.unlogged_reply_;
+    _impl_.msg_.unlogged_reply_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void ToClientMessage::unsafe_arena_set_allocated_unlogged_reply(::dsnet::spec::proto::UnloggedReplyMessage* unlogged_reply) {
+  clear_msg();
+  if (unlogged_reply) {
+    set_has_unlogged_reply();
+    _impl_.msg_.unlogged_reply_ = unlogged_reply;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:dsnet.spec.proto.ToClientMessage.unlogged_reply)
+}
+inline ::dsnet::spec::proto::UnloggedReplyMessage* ToClientMessage::_internal_mutable_unlogged_reply() {
+  if (!_internal_has_unlogged_reply()) {
+    clear_msg();
+    set_has_unlogged_reply();
+    _impl_.msg_.unlogged_reply_ = CreateMaybeMessage< ::dsnet::spec::proto::UnloggedReplyMessage >(GetArenaForAllocation());
+  }
+  return _impl_.msg_.unlogged_reply_;
+}
+inline ::dsnet::spec::proto::UnloggedReplyMessage* ToClientMessage::mutable_unlogged_reply() {
+  ::dsnet::spec::proto::UnloggedReplyMessage* _msg = _internal_mutable_unlogged_reply();
+  // @@protoc_insertion_point(field_mutable:dsnet.spec.proto.ToClientMessage.unlogged_reply)
+  return _msg;
+}
+
+inline bool ToClientMessage::has_msg() const {
+  return msg_case() != MSG_NOT_SET;
+}
+inline void ToClientMessage::clear_has_msg() {
+  _impl_._oneof_case_[0] = MSG_NOT_SET;
+}
+inline ToClientMessage::MsgCase ToClientMessage::msg_case() const {
+  return ToClientMessage::MsgCase(_impl_._oneof_case_[0]);
+}
+// -------------------------------------------------------------------
+
+// RequestMessage
+
+// required .dsnet.Request req = 1;
+inline bool RequestMessage::_internal_has_req() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.req_ != nullptr);
+  return value;
+}
+inline bool RequestMessage::has_req() const {
+  return _internal_has_req();
+}
+inline const ::dsnet::Request& RequestMessage::_internal_req() const {
+  const ::dsnet::Request* p = _impl_.req_;
+  return p != nullptr ? *p : reinterpret_cast<const ::dsnet::Request&>(
+      ::dsnet::_Request_default_instance_);
+}
+inline const ::dsnet::Request& RequestMessage::req() const {
+  // @@protoc_insertion_point(field_get:dsnet.spec.proto.RequestMessage.req)
+  return _internal_req();
+}
+inline void RequestMessage::unsafe_arena_set_allocated_req(
+    ::dsnet::Request* req) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.req_);
+  }
+  _impl_.req_ = req;
+  if (req) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:dsnet.spec.proto.RequestMessage.req)
+}
+inline ::dsnet::Request* RequestMessage::release_req() {
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::dsnet::Request* temp = _impl_.req_;
+  _impl_.req_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::dsnet::Request* RequestMessage::unsafe_arena_release_req() {
+  // @@protoc_insertion_point(field_release:dsnet.spec.proto.RequestMessage.req)
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::dsnet::Request* temp = _impl_.req_;
+  _impl_.req_ = nullptr;
+  return temp;
+}
+inline ::dsnet::Request* RequestMessage::_internal_mutable_req() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  if (_impl_.req_ == nullptr) {
+    auto* p = CreateMaybeMessage<::dsnet::Request>(GetArenaForAllocation());
+    _impl_.req_ = p;
+  }
+  return _impl_.req_;
+}
+inline ::dsnet::Request* RequestMessage::mutable_req() {
+  ::dsnet::Request* _msg = _internal_mutable_req();
+  // @@protoc_insertion_point(field_mutable:dsnet.spec.proto.RequestMessage.req)
+  return _msg;
+}
+inline void RequestMessage::set_allocated_req(::dsnet::Request* req) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete reinterpret_cast< ::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.req_);
+  }
+  if (req) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(
+                reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(req));
+    if (message_arena != submessage_arena) {
+      req = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, req, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.req_ = req;
+  // @@protoc_insertion_point(field_set_allocated:dsnet.spec.proto.RequestMessage.req)
+}
+
+// -------------------------------------------------------------------
+
+// UnloggedRequestMessage
+
+// required .dsnet.UnloggedRequest req = 1;
+inline bool UnloggedRequestMessage::_internal_has_req() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.req_ != nullptr);
+  return value;
+}
+inline bool UnloggedRequestMessage::has_req() const {
+  return _internal_has_req();
+}
+inline const ::dsnet::UnloggedRequest& UnloggedRequestMessage::_internal_req() const {
+  const ::dsnet::UnloggedRequest* p = _impl_.req_;
+  return p != nullptr ? *p : reinterpret_cast<const ::dsnet::UnloggedRequest&>(
+      ::dsnet::_UnloggedRequest_default_instance_);
+}
+inline const ::dsnet::UnloggedRequest& UnloggedRequestMessage::req() const {
+  // @@protoc_insertion_point(field_get:dsnet.spec.proto.UnloggedRequestMessage.req)
+  return _internal_req();
+}
+inline void UnloggedRequestMessage::unsafe_arena_set_allocated_req(
+    ::dsnet::UnloggedRequest* req) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.req_);
+  }
+  _impl_.req_ = req;
+  if (req) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:dsnet.spec.proto.UnloggedRequestMessage.req)
+}
+inline ::dsnet::UnloggedRequest* UnloggedRequestMessage::release_req() {
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::dsnet::UnloggedRequest* temp = _impl_.req_;
+  _impl_.req_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::dsnet::UnloggedRequest* UnloggedRequestMessage::unsafe_arena_release_req() {
+  // @@protoc_insertion_point(field_release:dsnet.spec.proto.UnloggedRequestMessage.req)
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::dsnet::UnloggedRequest* temp = _impl_.req_;
+  _impl_.req_ = nullptr;
+  return temp;
+}
+inline ::dsnet::UnloggedRequest* UnloggedRequestMessage::_internal_mutable_req() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  if (_impl_.req_ == nullptr) {
+    auto* p = CreateMaybeMessage<::dsnet::UnloggedRequest>(GetArenaForAllocation());
+    _impl_.req_ = p;
+  }
+  return _impl_.req_;
+}
+inline ::dsnet::UnloggedRequest* UnloggedRequestMessage::mutable_req() {
+  ::dsnet::UnloggedRequest* _msg = _internal_mutable_req();
+  // @@protoc_insertion_point(field_mutable:dsnet.spec.proto.UnloggedRequestMessage.req)
+  return _msg;
+}
+inline void UnloggedRequestMessage::set_allocated_req(::dsnet::UnloggedRequest* req) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete reinterpret_cast< ::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.req_);
+  }
+  if (req) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(
+                reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(req));
+    if (message_arena != submessage_arena) {
+      req = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, req, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.req_ = req;
+  // @@protoc_insertion_point(field_set_allocated:dsnet.spec.proto.UnloggedRequestMessage.req)
+}
+
+// -------------------------------------------------------------------
+
+// SyncMessage
+
+// required uint64 view = 1;
+inline bool SyncMessage::_internal_has_view() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool SyncMessage::has_view() const {
+  return _internal_has_view();
+}
+inline void SyncMessage::clear_view() {
+  _impl_.view_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline uint64_t SyncMessage::_internal_view() const {
+  return _impl_.view_;
+}
+inline uint64_t SyncMessage::view() const {
+  // @@protoc_insertion_point(field_get:dsnet.spec.proto.SyncMessage.view)
+  return _internal_view();
+}
+inline void SyncMessage::_internal_set_view(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.view_ = value;
+}
+inline void SyncMessage::set_view(uint64_t value) {
+  _internal_set_view(value);
+  // @@protoc_insertion_point(field_set:dsnet.spec.proto.SyncMessage.view)
+}
+
+// optional uint64 lastCommitted = 2;
+inline bool SyncMessage::_internal_has_lastcommitted() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool SyncMessage::has_lastcommitted() const {
+  return _internal_has_lastcommitted();
+}
+inline void SyncMessage::clear_lastcommitted() {
+  _impl_.lastcommitted_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline uint64_t SyncMessage::_internal_lastcommitted() const {
+  return _impl_.lastcommitted_;
+}
+inline uint64_t SyncMessage::lastcommitted() const {
+  // @@protoc_insertion_point(field_get:dsnet.spec.proto.SyncMessage.lastCommitted)
+  return _internal_lastcommitted();
+}
+inline void SyncMessage::_internal_set_lastcommitted(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.lastcommitted_ = value;
+}
+inline void SyncMessage::set_lastcommitted(uint64_t value) {
+  _internal_set_lastcommitted(value);
+  // @@protoc_insertion_point(field_set:dsnet.spec.proto.SyncMessage.lastCommitted)
+}
+
+// optional bytes lastCommittedHash = 3;
+inline bool SyncMessage::_internal_has_lastcommittedhash() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool SyncMessage::has_lastcommittedhash() const {
+  return _internal_has_lastcommittedhash();
+}
+inline void SyncMessage::clear_lastcommittedhash() {
+  _impl_.lastcommittedhash_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& SyncMessage::lastcommittedhash() const {
+  // @@protoc_insertion_point(field_get:dsnet.spec.proto.SyncMessage.lastCommittedHash)
+  return _internal_lastcommittedhash();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void SyncMessage::set_lastcommittedhash(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.lastcommittedhash_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:dsnet.spec.proto.SyncMessage.lastCommittedHash)
+}
+inline std::string* SyncMessage::mutable_lastcommittedhash() {
+  std::string* _s = _internal_mutable_lastcommittedhash();
+  // @@protoc_insertion_point(field_mutable:dsnet.spec.proto.SyncMessage.lastCommittedHash)
+  return _s;
+}
+inline const std::string& SyncMessage::_internal_lastcommittedhash() const {
+  return _impl_.lastcommittedhash_.Get();
+}
+inline void SyncMessage::_internal_set_lastcommittedhash(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.lastcommittedhash_.Set(value, GetArenaForAllocation());
+}
+inline std::string* SyncMessage::_internal_mutable_lastcommittedhash() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.lastcommittedhash_.Mutable(GetArenaForAllocation());
+}
+inline std::string* SyncMessage::release_lastcommittedhash() {
+  // @@protoc_insertion_point(field_release:dsnet.spec.proto.SyncMessage.lastCommittedHash)
+  if (!_internal_has_lastcommittedhash()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.lastcommittedhash_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.lastcommittedhash_.IsDefault()) {
+    _impl_.lastcommittedhash_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void SyncMessage::set_allocated_lastcommittedhash(std::string* lastcommittedhash) {
+  if (lastcommittedhash != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.lastcommittedhash_.SetAllocated(lastcommittedhash, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.lastcommittedhash_.IsDefault()) {
+    _impl_.lastcommittedhash_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:dsnet.spec.proto.SyncMessage.lastCommittedHash)
+}
+
+// optional uint64 lastSpeculative = 4;
+inline bool SyncMessage::_internal_has_lastspeculative() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  return value;
+}
+inline bool SyncMessage::has_lastspeculative() const {
+  return _internal_has_lastspeculative();
+}
+inline void SyncMessage::clear_lastspeculative() {
+  _impl_.lastspeculative_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000008u;
+}
+inline uint64_t SyncMessage::_internal_lastspeculative() const {
+  return _impl_.lastspeculative_;
+}
+inline uint64_t SyncMessage::lastspeculative() const {
+  // @@protoc_insertion_point(field_get:dsnet.spec.proto.SyncMessage.lastSpeculative)
+  return _internal_lastspeculative();
+}
+inline void SyncMessage::_internal_set_lastspeculative(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  _impl_.lastspeculative_ = value;
+}
+inline void SyncMessage::set_lastspeculative(uint64_t value) {
+  _internal_set_lastspeculative(value);
+  // @@protoc_insertion_point(field_set:dsnet.spec.proto.SyncMessage.lastSpeculative)
+}
+
+// -------------------------------------------------------------------
+
+// SyncReplyMessage
+
+// required uint64 view = 1;
+inline bool SyncReplyMessage::_internal_has_view() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool SyncReplyMessage::has_view() const {
+  return _internal_has_view();
+}
+inline void SyncReplyMessage::clear_view() {
+  _impl_.view_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline uint64_t SyncReplyMessage::_internal_view() const {
+  return _impl_.view_;
+}
+inline uint64_t SyncReplyMessage::view() const {
+  // @@protoc_insertion_point(field_get:dsnet.spec.proto.SyncReplyMessage.view)
+  return _internal_view();
+}
+inline void SyncReplyMessage::_internal_set_view(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.view_ = value;
+}
+inline void SyncReplyMessage::set_view(uint64_t value) {
+  _internal_set_view(value);
+  // @@protoc_insertion_point(field_set:dsnet.spec.proto.SyncReplyMessage.view)
+}
+
+// required uint64 lastSpeculative = 2;
+inline bool SyncReplyMessage::_internal_has_lastspeculative() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool SyncReplyMessage::has_lastspeculative() const {
+  return _internal_has_lastspeculative();
+}
+inline void SyncReplyMessage::clear_lastspeculative() {
+  _impl_.lastspeculative_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline uint64_t SyncReplyMessage::_internal_lastspeculative() const {
+  return _impl_.lastspeculative_;
+}
+inline uint64_t SyncReplyMessage::lastspeculative() const {
+  // @@protoc_insertion_point(field_get:dsnet.spec.proto.SyncReplyMessage.lastSpeculative)
+  return _internal_lastspeculative();
+}
+inline void SyncReplyMessage::_internal_set_lastspeculative(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.lastspeculative_ = value;
+}
+inline void SyncReplyMessage::set_lastspeculative(uint64_t value) {
+  _internal_set_lastspeculative(value);
+  // @@protoc_insertion_point(field_set:dsnet.spec.proto.SyncReplyMessage.lastSpeculative)
+}
+
+// required bytes lastSpeculativeHash = 3;
+inline bool SyncReplyMessage::_internal_has_lastspeculativehash() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool SyncReplyMessage::has_lastspeculativehash() const {
+  return _internal_has_lastspeculativehash();
+}
+inline void SyncReplyMessage::clear_lastspeculativehash() {
+  _impl_.lastspeculativehash_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& SyncReplyMessage::lastspeculativehash() const {
+  // @@protoc_insertion_point(field_get:dsnet.spec.proto.SyncReplyMessage.lastSpeculativeHash)
+  return _internal_lastspeculativehash();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void SyncReplyMessage::set_lastspeculativehash(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.lastspeculativehash_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:dsnet.spec.proto.SyncReplyMessage.lastSpeculativeHash)
+}
+inline std::string* SyncReplyMessage::mutable_lastspeculativehash() {
+  std::string* _s = _internal_mutable_lastspeculativehash();
+  // @@protoc_insertion_point(field_mutable:dsnet.spec.proto.SyncReplyMessage.lastSpeculativeHash)
+  return _s;
+}
+inline const std::string& SyncReplyMessage::_internal_lastspeculativehash() const {
+  return _impl_.lastspeculativehash_.Get();
+}
+inline void SyncReplyMessage::_internal_set_lastspeculativehash(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.lastspeculativehash_.Set(value, GetArenaForAllocation());
+}
+inline std::string* SyncReplyMessage::_internal_mutable_lastspeculativehash() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.lastspeculativehash_.Mutable(GetArenaForAllocation());
+}
+inline std::string* SyncReplyMessage::release_lastspeculativehash() {
+  // @@protoc_insertion_point(field_release:dsnet.spec.proto.SyncReplyMessage.lastSpeculativeHash)
+  if (!_internal_has_lastspeculativehash()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.lastspeculativehash_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.lastspeculativehash_.IsDefault()) {
+    _impl_.lastspeculativehash_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void SyncReplyMessage::set_allocated_lastspeculativehash(std::string* lastspeculativehash) {
+  if (lastspeculativehash != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.lastspeculativehash_.SetAllocated(lastspeculativehash, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.lastspeculativehash_.IsDefault()) {
+    _impl_.lastspeculativehash_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:dsnet.spec.proto.SyncReplyMessage.lastSpeculativeHash)
+}
+
+// required uint32 replicaidx = 4;
+inline bool SyncReplyMessage::_internal_has_replicaidx() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  return value;
+}
+inline bool SyncReplyMessage::has_replicaidx() const {
+  return _internal_has_replicaidx();
+}
+inline void SyncReplyMessage::clear_replicaidx() {
+  _impl_.replicaidx_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000008u;
+}
+inline uint32_t SyncReplyMessage::_internal_replicaidx() const {
+  return _impl_.replicaidx_;
+}
+inline uint32_t SyncReplyMessage::replicaidx() const {
+  // @@protoc_insertion_point(field_get:dsnet.spec.proto.SyncReplyMessage.replicaidx)
+  return _internal_replicaidx();
+}
+inline void SyncReplyMessage::_internal_set_replicaidx(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  _impl_.replicaidx_ = value;
+}
+inline void SyncReplyMessage::set_replicaidx(uint32_t value) {
+  _internal_set_replicaidx(value);
+  // @@protoc_insertion_point(field_set:dsnet.spec.proto.SyncReplyMessage.replicaidx)
+}
+
+// -------------------------------------------------------------------
+
+// RequestViewChangeMessage
+
+// required uint64 view = 1;
+inline bool RequestViewChangeMessage::_internal_has_view() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool RequestViewChangeMessage::has_view() const {
+  return _internal_has_view();
+}
+inline void RequestViewChangeMessage::clear_view() {
+  _impl_.view_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline uint64_t RequestViewChangeMessage::_internal_view() const {
+  return _impl_.view_;
+}
+inline uint64_t RequestViewChangeMessage::view() const {
+  // @@protoc_insertion_point(field_get:dsnet.spec.proto.RequestViewChangeMessage.view)
+  return _internal_view();
+}
+inline void RequestViewChangeMessage::_internal_set_view(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.view_ = value;
+}
+inline void RequestViewChangeMessage::set_view(uint64_t value) {
+  _internal_set_view(value);
+  // @@protoc_insertion_point(field_set:dsnet.spec.proto.RequestViewChangeMessage.view)
+}
+
+// -------------------------------------------------------------------
+
+// StartViewChangeMessage
+
+// required uint64 view = 1;
+inline bool StartViewChangeMessage::_internal_has_view() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool StartViewChangeMessage::has_view() const {
+  return _internal_has_view();
+}
+inline void StartViewChangeMessage::clear_view() {
+  _impl_.view_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline uint64_t StartViewChangeMessage::_internal_view() const {
+  return _impl_.view_;
+}
+inline uint64_t StartViewChangeMessage::view() const {
+  // @@protoc_insertion_point(field_get:dsnet.spec.proto.StartViewChangeMessage.view)
+  return _internal_view();
+}
+inline void StartViewChangeMessage::_internal_set_view(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.view_ = value;
+}
+inline void StartViewChangeMessage::set_view(uint64_t value) {
+  _internal_set_view(value);
+  // @@protoc_insertion_point(field_set:dsnet.spec.proto.StartViewChangeMessage.view)
+}
+
+// required uint32 replicaIdx = 2;
+inline bool StartViewChangeMessage::_internal_has_replicaidx() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool StartViewChangeMessage::has_replicaidx() const {
+  return _internal_has_replicaidx();
+}
+inline void StartViewChangeMessage::clear_replicaidx() {
+  _impl_.replicaidx_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline uint32_t StartViewChangeMessage::_internal_replicaidx() const {
+  return _impl_.replicaidx_;
+}
+inline uint32_t StartViewChangeMessage::replicaidx() const {
+  // @@protoc_insertion_point(field_get:dsnet.spec.proto.StartViewChangeMessage.replicaIdx)
+  return _internal_replicaidx();
+}
+inline void StartViewChangeMessage::_internal_set_replicaidx(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.replicaidx_ = value;
+}
+inline void StartViewChangeMessage::set_replicaidx(uint32_t value) {
+  _internal_set_replicaidx(value);
+  // @@protoc_insertion_point(field_set:dsnet.spec.proto.StartViewChangeMessage.replicaIdx)
+}
+
+// required uint64 lastCommitted = 3;
+inline bool StartViewChangeMessage::_internal_has_lastcommitted() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool StartViewChangeMessage::has_lastcommitted() const {
+  return _internal_has_lastcommitted();
+}
+inline void StartViewChangeMessage::clear_lastcommitted() {
+  _impl_.lastcommitted_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline uint64_t StartViewChangeMessage::_internal_lastcommitted() const {
+  return _impl_.lastcommitted_;
+}
+inline uint64_t StartViewChangeMessage::lastcommitted() const {
+  // @@protoc_insertion_point(field_get:dsnet.spec.proto.StartViewChangeMessage.lastCommitted)
+  return _internal_lastcommitted();
+}
+inline void StartViewChangeMessage::_internal_set_lastcommitted(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.lastcommitted_ = value;
+}
+inline void StartViewChangeMessage::set_lastcommitted(uint64_t value) {
+  _internal_set_lastcommitted(value);
+  // @@protoc_insertion_point(field_set:dsnet.spec.proto.StartViewChangeMessage.lastCommitted)
+}
+
+// -------------------------------------------------------------------
+
+// DoViewChangeMessage
+
+// required uint64 view = 1;
+inline bool DoViewChangeMessage::_internal_has_view() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool DoViewChangeMessage::has_view() const {
+  return _internal_has_view();
+}
+inline void DoViewChangeMessage::clear_view() {
+  _impl_.view_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline uint64_t DoViewChangeMessage::_internal_view() const {
+  return _impl_.view_;
+}
+inline uint64_t DoViewChangeMessage::view() const {
+  // @@protoc_insertion_point(field_get:dsnet.spec.proto.DoViewChangeMessage.view)
+  return _internal_view();
+}
+inline void DoViewChangeMessage::_internal_set_view(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.view_ = value;
+}
+inline void DoViewChangeMessage::set_view(uint64_t value) {
+  _internal_set_view(value);
+  // @@protoc_insertion_point(field_set:dsnet.spec.proto.DoViewChangeMessage.view)
+}
+
+// required uint64 lastNormalView = 2;
+inline bool DoViewChangeMessage::_internal_has_lastnormalview() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool DoViewChangeMessage::has_lastnormalview() const {
+  return _internal_has_lastnormalview();
+}
+inline void DoViewChangeMessage::clear_lastnormalview() {
+  _impl_.lastnormalview_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline uint64_t DoViewChangeMessage::_internal_lastnormalview() const {
+  return _impl_.lastnormalview_;
+}
+inline uint64_t DoViewChangeMessage::lastnormalview() const {
+  // @@protoc_insertion_point(field_get:dsnet.spec.proto.DoViewChangeMessage.lastNormalView)
+  return _internal_lastnormalview();
+}
+inline void DoViewChangeMessage::_internal_set_lastnormalview(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.lastnormalview_ = value;
+}
+inline void DoViewChangeMessage::set_lastnormalview(uint64_t value) {
+  _internal_set_lastnormalview(value);
+  // @@protoc_insertion_point(field_set:dsnet.spec.proto.DoViewChangeMessage.lastNormalView)
+}
+
+// required uint64 lastSpeculative = 3;
+inline bool DoViewChangeMessage::_internal_has_lastspeculative() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool DoViewChangeMessage::has_lastspeculative() const {
+  return _internal_has_lastspeculative();
+}
+inline void DoViewChangeMessage::clear_lastspeculative() {
+  _impl_.lastspeculative_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline uint64_t DoViewChangeMessage::_internal_lastspeculative() const {
+  return _impl_.lastspeculative_;
+}
+inline uint64_t DoViewChangeMessage::lastspeculative() const {
+  // @@protoc_insertion_point(field_get:dsnet.spec.proto.DoViewChangeMessage.lastSpeculative)
+  return _internal_lastspeculative();
+}
+inline void DoViewChangeMessage::_internal_set_lastspeculative(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.lastspeculative_ = value;
+}
+inline void DoViewChangeMessage::set_lastspeculative(uint64_t value) {
+  _internal_set_lastspeculative(value);
+  // @@protoc_insertion_point(field_set:dsnet.spec.proto.DoViewChangeMessage.lastSpeculative)
+}
+
+// required uint64 lastCommitted = 4;
+inline bool DoViewChangeMessage::_internal_has_lastcommitted() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  return value;
+}
+inline bool DoViewChangeMessage::has_lastcommitted() const {
+  return _internal_has_lastcommitted();
+}
+inline void DoViewChangeMessage::clear_lastcommitted() {
+  _impl_.lastcommitted_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000008u;
+}
+inline uint64_t DoViewChangeMessage::_internal_lastcommitted() const {
+  return _impl_.lastcommitted_;
+}
+inline uint64_t DoViewChangeMessage::lastcommitted() const {
+  // @@protoc_insertion_point(field_get:dsnet.spec.proto.DoViewChangeMessage.lastCommitted)
+  return _internal_lastcommitted();
+}
+inline void DoViewChangeMessage::_internal_set_lastcommitted(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  _impl_.lastcommitted_ = value;
+}
+inline void DoViewChangeMessage::set_lastcommitted(uint64_t value) {
+  _internal_set_lastcommitted(value);
+  // @@protoc_insertion_point(field_set:dsnet.spec.proto.DoViewChangeMessage.lastCommitted)
+}
+
+// repeated .dsnet.MsgLogEntry entries = 5;
+inline int DoViewChangeMessage::_internal_entries_size() const {
+  return _impl_.entries_.size();
+}
+inline int DoViewChangeMessage::entries_size() const {
+  return _internal_entries_size();
+}
+inline ::dsnet::MsgLogEntry* DoViewChangeMessage::mutable_entries(int index) {
+  // @@protoc_insertion_point(field_mutable:dsnet.spec.proto.DoViewChangeMessage.entries)
+  return _impl_.entries_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::dsnet::MsgLogEntry >*
+DoViewChangeMessage::mutable_entries() {
+  // @@protoc_insertion_point(field_mutable_list:dsnet.spec.proto.DoViewChangeMessage.entries)
+  return &_impl_.entries_;
+}
+inline const ::dsnet::MsgLogEntry& DoViewChangeMessage::_internal_entries(int index) const {
+  return _impl_.entries_.Get(index);
+}
+inline const ::dsnet::MsgLogEntry& DoViewChangeMessage::entries(int index) const {
+  // @@protoc_insertion_point(field_get:dsnet.spec.proto.DoViewChangeMessage.entries)
+  return _internal_entries(index);
+}
+inline ::dsnet::MsgLogEntry* DoViewChangeMessage::_internal_add_entries() {
+  return _impl_.entries_.Add();
+}
+inline ::dsnet::MsgLogEntry* DoViewChangeMessage::add_entries() {
+  ::dsnet::MsgLogEntry* _add = _internal_add_entries();
+  // @@protoc_insertion_point(field_add:dsnet.spec.proto.DoViewChangeMessage.entries)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::dsnet::MsgLogEntry >&
+DoViewChangeMessage::entries() const {
+  // @@protoc_insertion_point(field_list:dsnet.spec.proto.DoViewChangeMessage.entries)
+  return _impl_.entries_;
+}
+
+// required uint32 replicaIdx = 6;
+inline bool DoViewChangeMessage::_internal_has_replicaidx() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000010u) != 0;
+  return value;
+}
+inline bool DoViewChangeMessage::has_replicaidx() const {
+  return _internal_has_replicaidx();
+}
+inline void DoViewChangeMessage::clear_replicaidx() {
+  _impl_.replicaidx_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000010u;
+}
+inline uint32_t DoViewChangeMessage::_internal_replicaidx() const {
+  return _impl_.replicaidx_;
+}
+inline uint32_t DoViewChangeMessage::replicaidx() const {
+  // @@protoc_insertion_point(field_get:dsnet.spec.proto.DoViewChangeMessage.replicaIdx)
+  return _internal_replicaidx();
+}
+inline void DoViewChangeMessage::_internal_set_replicaidx(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000010u;
+  _impl_.replicaidx_ = value;
+}
+inline void DoViewChangeMessage::set_replicaidx(uint32_t value) {
+  _internal_set_replicaidx(value);
+  // @@protoc_insertion_point(field_set:dsnet.spec.proto.DoViewChangeMessage.replicaIdx)
+}
+
+// -------------------------------------------------------------------
+
+// StartViewMessage
+
+// required uint64 view = 1;
+inline bool StartViewMessage::_internal_has_view() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool StartViewMessage::has_view() const {
+  return _internal_has_view();
+}
+inline void StartViewMessage::clear_view() {
+  _impl_.view_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline uint64_t StartViewMessage::_internal_view() const {
+  return _impl_.view_;
+}
+inline uint64_t StartViewMessage::view() const {
+  // @@protoc_insertion_point(field_get:dsnet.spec.proto.StartViewMessage.view)
+  return _internal_view();
+}
+inline void StartViewMessage::_internal_set_view(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.view_ = value;
+}
+inline void StartViewMessage::set_view(uint64_t value) {
+  _internal_set_view(value);
+  // @@protoc_insertion_point(field_set:dsnet.spec.proto.StartViewMessage.view)
+}
+
+// required uint64 lastSpeculative = 2;
+inline bool StartViewMessage::_internal_has_lastspeculative() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool StartViewMessage::has_lastspeculative() const {
+  return _internal_has_lastspeculative();
+}
+inline void StartViewMessage::clear_lastspeculative() {
+  _impl_.lastspeculative_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline uint64_t StartViewMessage::_internal_lastspeculative() const {
+  return _impl_.lastspeculative_;
+}
+inline uint64_t StartViewMessage::lastspeculative() const {
+  // @@protoc_insertion_point(field_get:dsnet.spec.proto.StartViewMessage.lastSpeculative)
+  return _internal_lastspeculative();
+}
+inline void StartViewMessage::_internal_set_lastspeculative(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.lastspeculative_ = value;
+}
+inline void StartViewMessage::set_lastspeculative(uint64_t value) {
+  _internal_set_lastspeculative(value);
+  // @@protoc_insertion_point(field_set:dsnet.spec.proto.StartViewMessage.lastSpeculative)
+}
+
+// required uint64 lastCommitted = 3;
+inline bool StartViewMessage::_internal_has_lastcommitted() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool StartViewMessage::has_lastcommitted() const {
+  return _internal_has_lastcommitted();
+}
+inline void StartViewMessage::clear_lastcommitted() {
+  _impl_.lastcommitted_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline uint64_t StartViewMessage::_internal_lastcommitted() const {
+  return _impl_.lastcommitted_;
+}
+inline uint64_t StartViewMessage::lastcommitted() const {
+  // @@protoc_insertion_point(field_get:dsnet.spec.proto.StartViewMessage.lastCommitted)
+  return _internal_lastcommitted();
+}
+inline void StartViewMessage::_internal_set_lastcommitted(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.lastcommitted_ = value;
+}
+inline void StartViewMessage::set_lastcommitted(uint64_t value) {
+  _internal_set_lastcommitted(value);
+  // @@protoc_insertion_point(field_set:dsnet.spec.proto.StartViewMessage.lastCommitted)
+}
+
+// repeated .dsnet.MsgLogEntry entries = 4;
+inline int StartViewMessage::_internal_entries_size() const {
+  return _impl_.entries_.size();
+}
+inline int StartViewMessage::entries_size() const {
+  return _internal_entries_size();
+}
+inline ::dsnet::MsgLogEntry* StartViewMessage::mutable_entries(int index) {
+  // @@protoc_insertion_point(field_mutable:dsnet.spec.proto.StartViewMessage.entries)
+  return _impl_.entries_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::dsnet::MsgLogEntry >*
+StartViewMessage::mutable_entries() {
+  // @@protoc_insertion_point(field_mutable_list:dsnet.spec.proto.StartViewMessage.entries)
+  return &_impl_.entries_;
+}
+inline const ::dsnet::MsgLogEntry& StartViewMessage::_internal_entries(int index) const {
+  return _impl_.entries_.Get(index);
+}
+inline const ::dsnet::MsgLogEntry& StartViewMessage::entries(int index) const {
+  // @@protoc_insertion_point(field_get:dsnet.spec.proto.StartViewMessage.entries)
+  return _internal_entries(index);
+}
+inline ::dsnet::MsgLogEntry* StartViewMessage::_internal_add_entries() {
+  return _impl_.entries_.Add();
+}
+inline ::dsnet::MsgLogEntry* StartViewMessage::add_entries() {
+  ::dsnet::MsgLogEntry* _add = _internal_add_entries();
+  // @@protoc_insertion_point(field_add:dsnet.spec.proto.StartViewMessage.entries)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::dsnet::MsgLogEntry >&
+StartViewMessage::entries() const {
+  // @@protoc_insertion_point(field_list:dsnet.spec.proto.StartViewMessage.entries)
+  return _impl_.entries_;
+}
+
+// -------------------------------------------------------------------
+
+// InViewMessage
+
+// required uint64 view = 1;
+inline bool InViewMessage::_internal_has_view() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool InViewMessage::has_view() const {
+  return _internal_has_view();
+}
+inline void InViewMessage::clear_view() {
+  _impl_.view_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline uint64_t InViewMessage::_internal_view() const {
+  return _impl_.view_;
+}
+inline uint64_t InViewMessage::view() const {
+  // @@protoc_insertion_point(field_get:dsnet.spec.proto.InViewMessage.view)
+  return _internal_view();
+}
+inline void InViewMessage::_internal_set_view(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.view_ = value;
+}
+inline void InViewMessage::set_view(uint64_t value) {
+  _internal_set_view(value);
+  // @@protoc_insertion_point(field_set:dsnet.spec.proto.InViewMessage.view)
+}
+
+// required uint64 lastSpeculative = 2;
+inline bool InViewMessage::_internal_has_lastspeculative() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool InViewMessage::has_lastspeculative() const {
+  return _internal_has_lastspeculative();
+}
+inline void InViewMessage::clear_lastspeculative() {
+  _impl_.lastspeculative_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline uint64_t InViewMessage::_internal_lastspeculative() const {
+  return _impl_.lastspeculative_;
+}
+inline uint64_t InViewMessage::lastspeculative() const {
+  // @@protoc_insertion_point(field_get:dsnet.spec.proto.InViewMessage.lastSpeculative)
+  return _internal_lastspeculative();
+}
+inline void InViewMessage::_internal_set_lastspeculative(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.lastspeculative_ = value;
+}
+inline void InViewMessage::set_lastspeculative(uint64_t value) {
+  _internal_set_lastspeculative(value);
+  // @@protoc_insertion_point(field_set:dsnet.spec.proto.InViewMessage.lastSpeculative)
+}
+
+// required uint32 replicaIdx = 3;
+inline bool InViewMessage::_internal_has_replicaidx() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool InViewMessage::has_replicaidx() const {
+  return _internal_has_replicaidx();
+}
+inline void InViewMessage::clear_replicaidx() {
+  _impl_.replicaidx_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline uint32_t InViewMessage::_internal_replicaidx() const {
+  return _impl_.replicaidx_;
+}
+inline uint32_t InViewMessage::replicaidx() const {
+  // @@protoc_insertion_point(field_get:dsnet.spec.proto.InViewMessage.replicaIdx)
+  return _internal_replicaidx();
+}
+inline void InViewMessage::_internal_set_replicaidx(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.replicaidx_ = value;
+}
+inline void InViewMessage::set_replicaidx(uint32_t value) {
+  _internal_set_replicaidx(value);
+  // @@protoc_insertion_point(field_set:dsnet.spec.proto.InViewMessage.replicaIdx)
+}
+
+// -------------------------------------------------------------------
+
+// FillLogGapMessage
+
+// required uint64 view = 1;
+inline bool FillLogGapMessage::_internal_has_view() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool FillLogGapMessage::has_view() const {
+  return _internal_has_view();
+}
+inline void FillLogGapMessage::clear_view() {
+  _impl_.view_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline uint64_t FillLogGapMessage::_internal_view() const {
+  return _impl_.view_;
+}
+inline uint64_t FillLogGapMessage::view() const {
+  // @@protoc_insertion_point(field_get:dsnet.spec.proto.FillLogGapMessage.view)
+  return _internal_view();
+}
+inline void FillLogGapMessage::_internal_set_view(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.view_ = value;
+}
+inline void FillLogGapMessage::set_view(uint64_t value) {
+  _internal_set_view(value);
+  // @@protoc_insertion_point(field_set:dsnet.spec.proto.FillLogGapMessage.view)
+}
+
+// required uint64 lastCommitted = 2;
+inline bool FillLogGapMessage::_internal_has_lastcommitted() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool FillLogGapMessage::has_lastcommitted() const {
+  return _internal_has_lastcommitted();
+}
+inline void FillLogGapMessage::clear_lastcommitted() {
+  _impl_.lastcommitted_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline uint64_t FillLogGapMessage::_internal_lastcommitted() const {
+  return _impl_.lastcommitted_;
+}
+inline uint64_t FillLogGapMessage::lastcommitted() const {
+  // @@protoc_insertion_point(field_get:dsnet.spec.proto.FillLogGapMessage.lastCommitted)
+  return _internal_lastcommitted();
+}
+inline void FillLogGapMessage::_internal_set_lastcommitted(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.lastcommitted_ = value;
+}
+inline void FillLogGapMessage::set_lastcommitted(uint64_t value) {
+  _internal_set_lastcommitted(value);
+  // @@protoc_insertion_point(field_set:dsnet.spec.proto.FillLogGapMessage.lastCommitted)
+}
+
+// -------------------------------------------------------------------
+
+// FillDVCGapMessage
+
+// required uint64 view = 1;
+inline bool FillDVCGapMessage::_internal_has_view() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool FillDVCGapMessage::has_view() const {
+  return _internal_has_view();
+}
+inline void FillDVCGapMessage::clear_view() {
+  _impl_.view_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline uint64_t FillDVCGapMessage::_internal_view() const {
+  return _impl_.view_;
+}
+inline uint64_t FillDVCGapMessage::view() const {
+  // @@protoc_insertion_point(field_get:dsnet.spec.proto.FillDVCGapMessage.view)
+  return _internal_view();
+}
+inline void FillDVCGapMessage::_internal_set_view(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.view_ = value;
+}
+inline void FillDVCGapMessage::set_view(uint64_t value) {
+  _internal_set_view(value);
+  // @@protoc_insertion_point(field_set:dsnet.spec.proto.FillDVCGapMessage.view)
+}
+
+// required uint64 lastCommitted = 2;
+inline bool FillDVCGapMessage::_internal_has_lastcommitted() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool FillDVCGapMessage::has_lastcommitted() const {
+  return _internal_has_lastcommitted();
+}
+inline void FillDVCGapMessage::clear_lastcommitted() {
+  _impl_.lastcommitted_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline uint64_t FillDVCGapMessage::_internal_lastcommitted() const {
+  return _impl_.lastcommitted_;
+}
+inline uint64_t FillDVCGapMessage::lastcommitted() const {
+  // @@protoc_insertion_point(field_get:dsnet.spec.proto.FillDVCGapMessage.lastCommitted)
+  return _internal_lastcommitted();
+}
+inline void FillDVCGapMessage::_internal_set_lastcommitted(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.lastcommitted_ = value;
+}
+inline void FillDVCGapMessage::set_lastcommitted(uint64_t value) {
+  _internal_set_lastcommitted(value);
+  // @@protoc_insertion_point(field_set:dsnet.spec.proto.FillDVCGapMessage.lastCommitted)
+}
+
+// -------------------------------------------------------------------
+
+// ToReplicaMessage
+
+// .dsnet.spec.proto.RequestMessage request = 1;
+inline bool ToReplicaMessage::_internal_has_request() const {
+  return msg_case() == kRequest;
+}
+inline bool ToReplicaMessage::has_request() const {
+  return _internal_has_request();
+}
+inline void ToReplicaMessage::set_has_request() {
+  _impl_._oneof_case_[0] = kRequest;
+}
+inline void ToReplicaMessage::clear_request() {
+  if (_internal_has_request()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.msg_.request_;
+    }
+    clear_has_msg();
+  }
+}
+inline ::dsnet::spec::proto::RequestMessage* ToReplicaMessage::release_request() {
+  // @@protoc_insertion_point(field_release:dsnet.spec.proto.ToReplicaMessage.request)
+  if (_internal_has_request()) {
+    clear_has_msg();
+    ::dsnet::spec::proto::RequestMessage* temp = _impl_.msg_.request_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.msg_.request_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::dsnet::spec::proto::RequestMessage& ToReplicaMessage::_internal_request() const {
+  return _internal_has_request()
+      ? *_impl_.msg_.request_
+      : reinterpret_cast< ::dsnet::spec::proto::RequestMessage&>(::dsnet::spec::proto::_RequestMessage_default_instance_);
+}
+inline const ::dsnet::spec::proto::RequestMessage& ToReplicaMessage::request() const {
+  // @@protoc_insertion_point(field_get:dsnet.spec.proto.ToReplicaMessage.request)
+  return _internal_request();
+}
+inline ::dsnet::spec::proto::RequestMessage* ToReplicaMessage::unsafe_arena_release_request() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:dsnet.spec.proto.ToReplicaMessage.request)
+  if (_internal_has_request()) {
+    clear_has_msg();
+    ::dsnet::spec::proto::RequestMessage* temp = _impl_.msg_.request_;
+    _impl_.msg_.request_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void ToReplicaMessage::unsafe_arena_set_allocated_request(::dsnet::spec::proto::RequestMessage* request) {
+  clear_msg();
+  if (request) {
+    set_has_request();
+    _impl_.msg_.request_ = request;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:dsnet.spec.proto.ToReplicaMessage.request)
+}
+inline ::dsnet::spec::proto::RequestMessage* ToReplicaMessage::_internal_mutable_request() {
+  if (!_internal_has_request()) {
+    clear_msg();
+    set_has_request();
+    _impl_.msg_.request_ = CreateMaybeMessage< ::dsnet::spec::proto::RequestMessage >(GetArenaForAllocation());
+  }
+  return _impl_.msg_.request_;
+}
+inline ::dsnet::spec::proto::RequestMessage* ToReplicaMessage::mutable_request() {
+  ::dsnet::spec::proto::RequestMessage* _msg = _internal_mutable_request();
+  // @@protoc_insertion_point(field_mutable:dsnet.spec.proto.ToReplicaMessage.request)
+  return _msg;
+}
+
+// .dsnet.spec.proto.UnloggedRequestMessage unlogged_request = 2;
+inline bool ToReplicaMessage::_internal_has_unlogged_request() const {
+  return msg_case() == kUnloggedRequest;
+}
+inline bool ToReplicaMessage::has_unlogged_request() const {
+  return _internal_has_unlogged_request();
+}
+inline void ToReplicaMessage::set_has_unlogged_request() {
+  _impl_._oneof_case_[0] = kUnloggedRequest;
+}
+inline void ToReplicaMessage::clear_unlogged_request() {
+  if (_internal_has_unlogged_request()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.msg_.unlogged_request_;
+    }
+    clear_has_msg();
+  }
+}
+inline ::dsnet::spec::proto::UnloggedRequestMessage* ToReplicaMessage::release_unlogged_request() {
+  // @@protoc_insertion_point(field_release:dsnet.spec.proto.ToReplicaMessage.unlogged_request)
+  if (_internal_has_unlogged_request()) {
+    clear_has_msg();
+    ::dsnet::spec::proto::UnloggedRequestMessage* temp = _impl_.msg_.unlogged_request_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.msg_.unlogged_request_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::dsnet::spec::proto::UnloggedRequestMessage& ToReplicaMessage::_internal_unlogged_request() const {
+  return _internal_has_unlogged_request()
+      ? *_impl_.msg_.unlogged_request_
+      : reinterpret_cast< ::dsnet::spec::proto::UnloggedRequestMessage&>(::dsnet::spec::proto::_UnloggedRequestMessage_default_instance_);
+}
+inline const ::dsnet::spec::proto::UnloggedRequestMessage& ToReplicaMessage::unlogged_request() const {
+  // @@protoc_insertion_point(field_get:dsnet.spec.proto.ToReplicaMessage.unlogged_request)
+  return _internal_unlogged_request();
+}
+inline ::dsnet::spec::proto::UnloggedRequestMessage* ToReplicaMessage::unsafe_arena_release_unlogged_request() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:dsnet.spec.proto.ToReplicaMessage.unlogged_request)
+  if (_internal_has_unlogged_request()) {
+    clear_has_msg();
+    ::dsnet::spec::proto::UnloggedRequestMessage* temp = _impl_.msg_.unlogged_request_;
+    _impl_.msg_.unlogged_request_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void ToReplicaMessage::unsafe_arena_set_allocated_unlogged_request(::dsnet::spec::proto::UnloggedRequestMessage* unlogged_request) {
+  clear_msg();
+  if (unlogged_request) {
+    set_has_unlogged_request();
+    _impl_.msg_.unlogged_request_ = unlogged_request;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:dsnet.spec.proto.ToReplicaMessage.unlogged_request)
+}
+inline ::dsnet::spec::proto::UnloggedRequestMessage* ToReplicaMessage::_internal_mutable_unlogged_request() {
+  if (!_internal_has_unlogged_request()) {
+    clear_msg();
+    set_has_unlogged_request();
+    _impl_.msg_.unlogged_request_ = CreateMaybeMessage< ::dsnet::spec::proto::UnloggedRequestMessage >(GetArenaForAllocation());
+  }
+  return _impl_.msg_.unlogged_request_;
+}
+inline ::dsnet::spec::proto::UnloggedRequestMessage* ToReplicaMessage::mutable_unlogged_request() {
+  ::dsnet::spec::proto::UnloggedRequestMessage* _msg = _internal_mutable_unlogged_request();
+  // @@protoc_insertion_point(field_mutable:dsnet.spec.proto.ToReplicaMessage.unlogged_request)
+  return _msg;
+}
+
+// .dsnet.spec.proto.SyncMessage sync = 3;
+inline bool ToReplicaMessage::_internal_has_sync() const {
+  return msg_case() == kSync;
+}
+inline bool ToReplicaMessage::has_sync() const {
+  return _internal_has_sync();
+}
+inline void ToReplicaMessage::set_has_sync() {
+  _impl_._oneof_case_[0] = kSync;
+}
+inline void ToReplicaMessage::clear_sync() {
+  if (_internal_has_sync()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.msg_.sync_;
+    }
+    clear_has_msg();
+  }
+}
+inline ::dsnet::spec::proto::SyncMessage* ToReplicaMessage::release_sync() {
+  // @@protoc_insertion_point(field_release:dsnet.spec.proto.ToReplicaMessage.sync)
+  if (_internal_has_sync()) {
+    clear_has_msg();
+    ::dsnet::spec::proto::SyncMessage* temp = _impl_.msg_.sync_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.msg_.sync_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::dsnet::spec::proto::SyncMessage& ToReplicaMessage::_internal_sync() const {
+  return _internal_has_sync()
+      ? *_impl_.msg_.sync_
+      : reinterpret_cast< ::dsnet::spec::proto::SyncMessage&>(::dsnet::spec::proto::_SyncMessage_default_instance_);
+}
+inline const ::dsnet::spec::proto::SyncMessage& ToReplicaMessage::sync() const {
+  // @@protoc_insertion_point(field_get:dsnet.spec.proto.ToReplicaMessage.sync)
+  return _internal_sync();
+}
+inline ::dsnet::spec::proto::SyncMessage* ToReplicaMessage::unsafe_arena_release_sync() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:dsnet.spec.proto.ToReplicaMessage.sync)
+  if (_internal_has_sync()) {
+    clear_has_msg();
+    ::dsnet::spec::proto::SyncMessage* temp = _impl_.msg_.sync_;
+    _impl_.msg_.sync_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void ToReplicaMessage::unsafe_arena_set_allocated_sync(::dsnet::spec::proto::SyncMessage* sync) {
+  clear_msg();
+  if (sync) {
+    set_has_sync();
+    _impl_.msg_.sync_ = sync;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:dsnet.spec.proto.ToReplicaMessage.sync)
+}
+inline ::dsnet::spec::proto::SyncMessage* ToReplicaMessage::_internal_mutable_sync() {
+  if (!_internal_has_sync()) {
+    clear_msg();
+    set_has_sync();
+    _impl_.msg_.sync_ = CreateMaybeMessage< ::dsnet::spec::proto::SyncMessage >(GetArenaForAllocation());
+  }
+  return _impl_.msg_.sync_;
+}
+inline ::dsnet::spec::proto::SyncMessage* ToReplicaMessage::mutable_sync() {
+  ::dsnet::spec::proto::SyncMessage* _msg = _internal_mutable_sync();
+  // @@protoc_insertion_point(field_mutable:dsnet.spec.proto.ToReplicaMessage.sync)
+  return _msg;
+}
+
+// .dsnet.spec.proto.SyncReplyMessage sync_reply = 4;
+inline bool ToReplicaMessage::_internal_has_sync_reply() const {
+  return msg_case() == kSyncReply;
+}
+inline bool ToReplicaMessage::has_sync_reply() const {
+  return _internal_has_sync_reply();
+}
+inline void ToReplicaMessage::set_has_sync_reply() {
+  _impl_._oneof_case_[0] = kSyncReply;
+}
+inline void ToReplicaMessage::clear_sync_reply() {
+  if (_internal_has_sync_reply()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.msg_.sync_reply_;
+    }
+    clear_has_msg();
+  }
+}
+inline ::dsnet::spec::proto::SyncReplyMessage* ToReplicaMessage::release_sync_reply() {
+  // @@protoc_insertion_point(field_release:dsnet.spec.proto.ToReplicaMessage.sync_reply)
+  if (_internal_has_sync_reply()) {
+    clear_has_msg();
+    ::dsnet::spec::proto::SyncReplyMessage* temp = _impl_.msg_.sync_reply_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.msg_.sync_reply_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::dsnet::spec::proto::SyncReplyMessage& ToReplicaMessage::_internal_sync_reply() const {
+  return _internal_has_sync_reply()
+      ? *_impl_.msg_.sync_reply_
+      : reinterpret_cast< ::dsnet::spec::proto::SyncReplyMessage&>(::dsnet::spec::proto::_SyncReplyMessage_default_instance_);
+}
+inline const ::dsnet::spec::proto::SyncReplyMessage& ToReplicaMessage::sync_reply() const {
+  // @@protoc_insertion_point(field_get:dsnet.spec.proto.ToReplicaMessage.sync_reply)
+  return _internal_sync_reply();
+}
+inline ::dsnet::spec::proto::SyncReplyMessage* ToReplicaMessage::unsafe_arena_release_sync_reply() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:dsnet.spec.proto.ToReplicaMessage.sync_reply)
+  if (_internal_has_sync_reply()) {
+    clear_has_msg();
+    ::dsnet::spec::proto::SyncReplyMessage* temp = _impl_.msg_.sync_reply_;
+    _impl_.msg_.sync_reply_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void ToReplicaMessage::unsafe_arena_set_allocated_sync_reply(::dsnet::spec::proto::SyncReplyMessage* sync_reply) {
+  clear_msg();
+  if (sync_reply) {
+    set_has_sync_reply();
+    _impl_.msg_.sync_reply_ = sync_reply;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:dsnet.spec.proto.ToReplicaMessage.sync_reply)
+}
+inline ::dsnet::spec::proto::SyncReplyMessage* ToReplicaMessage::_internal_mutable_sync_reply() {
+  if (!_internal_has_sync_reply()) {
+    clear_msg();
+    set_has_sync_reply();
+    _impl_.msg_.sync_reply_ = CreateMaybeMessage< ::dsnet::spec::proto::SyncReplyMessage >(GetArenaForAllocation());
+  }
+  return _impl_.msg_.sync_reply_;
+}
+inline ::dsnet::spec::proto::SyncReplyMessage* ToReplicaMessage::mutable_sync_reply() {
+  ::dsnet::spec::proto::SyncReplyMessage* _msg = _internal_mutable_sync_reply();
+  // @@protoc_insertion_point(field_mutable:dsnet.spec.proto.ToReplicaMessage.sync_reply)
+  return _msg;
+}
+
+// .dsnet.spec.proto.RequestViewChangeMessage request_view_change = 5;
+inline bool ToReplicaMessage::_internal_has_request_view_change() const {
+  return msg_case() == kRequestViewChange;
+}
+inline bool ToReplicaMessage::has_request_view_change() const {
+  return _internal_has_request_view_change();
+}
+inline void ToReplicaMessage::set_has_request_view_change() {
+  _impl_._oneof_case_[0] = kRequestViewChange;
+}
+inline void ToReplicaMessage::clear_request_view_change() {
+  if (_internal_has_request_view_change()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.msg_.request_view_change_;
+    }
+    clear_has_msg();
+  }
+}
+inline ::dsnet::spec::proto::RequestViewChangeMessage* ToReplicaMessage::release_request_view_change() {
+  // @@protoc_insertion_point(field_release:dsnet.spec.proto.ToReplicaMessage.request_view_change)
+  if (_internal_has_request_view_change()) {
+    clear_has_msg();
+    ::dsnet::spec::proto::RequestViewChangeMessage* temp = _impl_.msg_.request_view_change_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.msg_.request_view_change_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::dsnet::spec::proto::RequestViewChangeMessage& ToReplicaMessage::_internal_request_view_change() const {
+  return _internal_has_request_view_change()
+      ? *_impl_.msg_.request_view_change_
+      : reinterpret_cast< ::dsnet::spec::proto::RequestViewChangeMessage&>(::dsnet::spec::proto::_RequestViewChangeMessage_default_instance_);
+}
+inline const ::dsnet::spec::proto::RequestViewChangeMessage& ToReplicaMessage::request_view_change() const {
+  // @@protoc_insertion_point(field_get:dsnet.spec.proto.ToReplicaMessage.request_view_change)
+  return _internal_request_view_change();
+}
+inline ::dsnet::spec::proto::RequestViewChangeMessage* ToReplicaMessage::unsafe_arena_release_request_view_change() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:dsnet.spec.proto.ToReplicaMessage.request_view_change)
+  if (_internal_has_request_view_change()) {
+    clear_has_msg();
+    ::dsnet::spec::proto::RequestViewChangeMessage* temp = _impl_.msg_.request_view_change_;
+    _impl_.msg_.request_view_change_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void ToReplicaMessage::unsafe_arena_set_allocated_request_view_change(::dsnet::spec::proto::RequestViewChangeMessage* request_view_change) {
+  clear_msg();
+  if (request_view_change) {
+    set_has_request_view_change();
+    _impl_.msg_.request_view_change_ = request_view_change;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:dsnet.spec.proto.ToReplicaMessage.request_view_change)
+}
+inline ::dsnet::spec::proto::RequestViewChangeMessage* ToReplicaMessage::_internal_mutable_request_view_change() {
+  if (!_internal_has_request_view_change()) {
+    clear_msg();
+    set_has_request_view_change();
+    _impl_.msg_.request_view_change_ = CreateMaybeMessage< ::dsnet::spec::proto::RequestViewChangeMessage >(GetArenaForAllocation());
+  }
+  return _impl_.msg_.request_view_change_;
+}
+inline ::dsnet::spec::proto::RequestViewChangeMessage* ToReplicaMessage::mutable_request_view_change() {
+  ::dsnet::spec::proto::RequestViewChangeMessage* _msg = _internal_mutable_request_view_change();
+  // @@protoc_insertion_point(field_mutable:dsnet.spec.proto.ToReplicaMessage.request_view_change)
+  return _msg;
+}
+
+// .dsnet.spec.proto.StartViewChangeMessage start_view_change = 6;
+inline bool ToReplicaMessage::_internal_has_start_view_change() const {
+  return msg_case() == kStartViewChange;
+}
+inline bool ToReplicaMessage::has_start_view_change() const {
+  return _internal_has_start_view_change();
+}
+inline void ToReplicaMessage::set_has_start_view_change() {
+  _impl_._oneof_case_[0] = kStartViewChange;
+}
+inline void ToReplicaMessage::clear_start_view_change() {
+  if (_internal_has_start_view_change()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.msg_.start_view_change_;
+    }
+    clear_has_msg();
+  }
+}
+inline ::dsnet::spec::proto::StartViewChangeMessage* ToReplicaMessage::release_start_view_change() {
+  // @@protoc_insertion_point(field_release:dsnet.spec.proto.ToReplicaMessage.start_view_change)
+  if (_internal_has_start_view_change()) {
+    clear_has_msg();
+    ::dsnet::spec::proto::StartViewChangeMessage* temp = _impl_.msg_.start_view_change_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.msg_.start_view_change_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::dsnet::spec::proto::StartViewChangeMessage& ToReplicaMessage::_internal_start_view_change() const {
+  return _internal_has_start_view_change()
+      ? *_impl_.msg_.start_view_change_
+      : reinterpret_cast< ::dsnet::spec::proto::StartViewChangeMessage&>(::dsnet::spec::proto::_StartViewChangeMessage_default_instance_);
+}
+inline const ::dsnet::spec::proto::StartViewChangeMessage& ToReplicaMessage::start_view_change() const {
+  // @@protoc_insertion_point(field_get:dsnet.spec.proto.ToReplicaMessage.start_view_change)
+  return _internal_start_view_change();
+}
+inline ::dsnet::spec::proto::StartViewChangeMessage* ToReplicaMessage::unsafe_arena_release_start_view_change() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:dsnet.spec.proto.ToReplicaMessage.start_view_change)
+  if (_internal_has_start_view_change()) {
+    clear_has_msg();
+    ::dsnet::spec::proto::StartViewChangeMessage* temp = _impl_.msg_.start_view_change_;
+    _impl_.msg_.start_view_change_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void ToReplicaMessage::unsafe_arena_set_allocated_start_view_change(::dsnet::spec::proto::StartViewChangeMessage* start_view_change) {
+  clear_msg();
+  if (start_view_change) {
+    set_has_start_view_change();
+    _impl_.msg_.start_view_change_ = start_view_change;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:dsnet.spec.proto.ToReplicaMessage.start_view_change)
+}
+inline ::dsnet::spec::proto::StartViewChangeMessage* ToReplicaMessage::_internal_mutable_start_view_change() {
+  if (!_internal_has_start_view_change()) {
+    clear_msg();
+    set_has_start_view_change();
+    _impl_.msg_.start_view_change_ = CreateMaybeMessage< ::dsnet::spec::proto::StartViewChangeMessage >(GetArenaForAllocation());
+  }
+  return _impl_.msg_.start_view_change_;
+}
+inline ::dsnet::spec::proto::StartViewChangeMessage* ToReplicaMessage::mutable_start_view_change() {
+  ::dsnet::spec::proto::StartViewChangeMessage* _msg = _internal_mutable_start_view_change();
+  // @@protoc_insertion_point(field_mutable:dsnet.spec.proto.ToReplicaMessage.start_view_change)
+  return _msg;
+}
+
+// .dsnet.spec.proto.DoViewChangeMessage do_view_change = 7;
+inline bool ToReplicaMessage::_internal_has_do_view_change() const {
+  return msg_case() == kDoViewChange;
+}
+inline bool ToReplicaMessage::has_do_view_change() const {
+  return _internal_has_do_view_change();
+}
+inline void ToReplicaMessage::set_has_do_view_change() {
+  _impl_._oneof_case_[0] = kDoViewChange;
+}
+inline void ToReplicaMessage::clear_do_view_change() {
+  if (_internal_has_do_view_change()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.msg_.do_view_change_;
+    }
+    clear_has_msg();
+  }
+}
+inline ::dsnet::spec::proto::DoViewChangeMessage* ToReplicaMessage::release_do_view_change() {
+  // @@protoc_insertion_point(field_release:dsnet.spec.proto.ToReplicaMessage.do_view_change)
+  if (_internal_has_do_view_change()) {
+    clear_has_msg();
+    ::dsnet::spec::proto::DoViewChangeMessage* temp = _impl_.msg_.do_view_change_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.msg_.do_view_change_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::dsnet::spec::proto::DoViewChangeMessage& ToReplicaMessage::_internal_do_view_change() const {
+  return _internal_has_do_view_change()
+      ? *_impl_.msg_.do_view_change_
+      : reinterpret_cast< ::dsnet::spec::proto::DoViewChangeMessage&>(::dsnet::spec::proto::_DoViewChangeMessage_default_instance_);
+}
+inline const ::dsnet::spec::proto::DoViewChangeMessage& ToReplicaMessage::do_view_change() const {
+  // @@protoc_insertion_point(field_get:dsnet.spec.proto.ToReplicaMessage.do_view_change)
+  return _internal_do_view_change();
+}
+inline ::dsnet::spec::proto::DoViewChangeMessage* ToReplicaMessage::unsafe_arena_release_do_view_change() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:dsnet.spec.proto.ToReplicaMessage.do_view_change)
+  if (_internal_has_do_view_change()) {
+    clear_has_msg();
+    ::dsnet::spec::proto::DoViewChangeMessage* temp = _impl_.msg_.do_view_change_;
+    _impl_.msg_.do_view_change_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void ToReplicaMessage::unsafe_arena_set_allocated_do_view_change(::dsnet::spec::proto::DoViewChangeMessage* do_view_change) {
+  clear_msg();
+  if (do_view_change) {
+    set_has_do_view_change();
+    _impl_.msg_.do_view_change_ = do_view_change;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:dsnet.spec.proto.ToReplicaMessage.do_view_change)
+}
+inline ::dsnet::spec::proto::DoViewChangeMessage* ToReplicaMessage::_internal_mutable_do_view_change() {
+  if (!_internal_has_do_view_change()) {
+    clear_msg();
+    set_has_do_view_change();
+    _impl_.msg_.do_view_change_ = CreateMaybeMessage< ::dsnet::spec::proto::DoViewChangeMessage >(GetArenaForAllocation());
+  }
+  return _impl_.msg_.do_view_change_;
+}
+inline ::dsnet::spec::proto::DoViewChangeMessage* ToReplicaMessage::mutable_do_view_change() {
+  ::dsnet::spec::proto::DoViewChangeMessage* _msg = _internal_mutable_do_view_change();
+  // @@protoc_insertion_point(field_mutable:dsnet.spec.proto.ToReplicaMessage.do_view_change)
+  return _msg;
+}
+
+// .dsnet.spec.proto.StartViewMessage start_view = 8;
+inline bool ToReplicaMessage::_internal_has_start_view() const {
+  return msg_case() == kStartView;
+}
+inline bool ToReplicaMessage::has_start_view() const {
+  return _internal_has_start_view();
+}
+inline void ToReplicaMessage::set_has_start_view() {
+  _impl_._oneof_case_[0] = kStartView;
+}
+inline void ToReplicaMessage::clear_start_view() {
+  if (_internal_has_start_view()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.msg_.start_view_;
+    }
+    clear_has_msg();
+  }
+}
+inline ::dsnet::spec::proto::StartViewMessage* ToReplicaMessage::release_start_view() {
+  // @@protoc_insertion_point(field_release:dsnet.spec.proto.ToReplicaMessage.start_view)
+  if (_internal_has_start_view()) {
+    clear_has_msg();
+    ::dsnet::spec::proto::StartViewMessage* temp = _impl_.msg_.start_view_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.msg_.start_view_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::dsnet::spec::proto::StartViewMessage& ToReplicaMessage::_internal_start_view() const {
+  return _internal_has_start_view()
+      ? *_impl_.msg_.start_view_
+      : reinterpret_cast< ::dsnet::spec::proto::StartViewMessage&>(::dsnet::spec::proto::_StartViewMessage_default_instance_);
+}
+inline const ::dsnet::spec::proto::StartViewMessage& ToReplicaMessage::start_view() const {
+  // @@protoc_insertion_point(field_get:dsnet.spec.proto.ToReplicaMessage.start_view)
+  return _internal_start_view();
+}
+inline ::dsnet::spec::proto::StartViewMessage* ToReplicaMessage::unsafe_arena_release_start_view() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:dsnet.spec.proto.ToReplicaMessage.start_view)
+  if (_internal_has_start_view()) {
+    clear_has_msg();
+    ::dsnet::spec::proto::StartViewMessage* temp = _impl_.msg_.start_view_;
+    _impl_.msg_.start_view_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void ToReplicaMessage::unsafe_arena_set_allocated_start_view(::dsnet::spec::proto::StartViewMessage* start_view) {
+  clear_msg();
+  if (start_view) {
+    set_has_start_view();
+    _impl_.msg_.start_view_ = start_view;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:dsnet.spec.proto.ToReplicaMessage.start_view)
+}
+inline ::dsnet::spec::proto::StartViewMessage* ToReplicaMessage::_internal_mutable_start_view() {
+  if (!_internal_has_start_view()) {
+    clear_msg();
+    set_has_start_view();
+    _impl_.msg_.start_view_ = CreateMaybeMessage< ::dsnet::spec::proto::StartViewMessage >(GetArenaForAllocation());
+  }
+  return _impl_.msg_.start_view_;
+}
+inline ::dsnet::spec::proto::StartViewMessage* ToReplicaMessage::mutable_start_view() {
+  ::dsnet::spec::proto::StartViewMessage* _msg = _internal_mutable_start_view();
+  // @@protoc_insertion_point(field_mutable:dsnet.spec.proto.ToReplicaMessage.start_view)
+  return _msg;
+}
+
+// .dsnet.spec.proto.InViewMessage in_view = 9;
+inline bool ToReplicaMessage::_internal_has_in_view() const {
+  return msg_case() == kInView;
+}
+inline bool ToReplicaMessage::has_in_view() const {
+  return _internal_has_in_view();
+}
+inline void ToReplicaMessage::set_has_in_view() {
+  _impl_._oneof_case_[0] = kInView;
+}
+inline void ToReplicaMessage::clear_in_view() {
+  if (_internal_has_in_view()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.msg_.in_view_;
+    }
+    clear_has_msg();
+  }
+}
+inline ::dsnet::spec::proto::InViewMessage* ToReplicaMessage::release_in_view() {
+  // @@protoc_insertion_point(field_release:dsnet.spec.proto.ToReplicaMessage.in_view)
+  if (_internal_has_in_view()) {
+    clear_has_msg();
+    ::dsnet::spec::proto::InViewMessage* temp = _impl_.msg_.in_view_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.msg_.in_view_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::dsnet::spec::proto::InViewMessage& ToReplicaMessage::_internal_in_view() const {
+  return _internal_has_in_view()
+      ? *_impl_.msg_.in_view_
+      : reinterpret_cast< ::dsnet::spec::proto::InViewMessage&>(::dsnet::spec::proto::_InViewMessage_default_instance_);
+}
+inline const ::dsnet::spec::proto::InViewMessage& ToReplicaMessage::in_view() const {
+  // @@protoc_insertion_point(field_get:dsnet.spec.proto.ToReplicaMessage.in_view)
+  return _internal_in_view();
+}
+inline ::dsnet::spec::proto::InViewMessage* ToReplicaMessage::unsafe_arena_release_in_view() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:dsnet.spec.proto.ToReplicaMessage.in_view)
+  if (_internal_has_in_view()) {
+    clear_has_msg();
+    ::dsnet::spec::proto::InViewMessage* temp = _impl_.msg_.in_view_;
+    _impl_.msg_.in_view_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void ToReplicaMessage::unsafe_arena_set_allocated_in_view(::dsnet::spec::proto::InViewMessage* in_view) {
+  clear_msg();
+  if (in_view) {
+    set_has_in_view();
+    _impl_.msg_.in_view_ = in_view;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:dsnet.spec.proto.ToReplicaMessage.in_view)
+}
+inline ::dsnet::spec::proto::InViewMessage* ToReplicaMessage::_internal_mutable_in_view() {
+  if (!_internal_has_in_view()) {
+    clear_msg();
+    set_has_in_view();
+    _impl_.msg_.in_view_ = CreateMaybeMessage< ::dsnet::spec::proto::InViewMessage >(GetArenaForAllocation());
+  }
+  return _impl_.msg_.in_view_;
+}
+inline ::dsnet::spec::proto::InViewMessage* ToReplicaMessage::mutable_in_view() {
+  ::dsnet::spec::proto::InViewMessage* _msg = _internal_mutable_in_view();
+  // @@protoc_insertion_point(field_mutable:dsnet.spec.proto.ToReplicaMessage.in_view)
+  return _msg;
+}
+
+// .dsnet.spec.proto.FillLogGapMessage fill_log_gap = 10;
+inline bool ToReplicaMessage::_internal_has_fill_log_gap() const {
+  return msg_case() == kFillLogGap;
+}
+inline bool ToReplicaMessage::has_fill_log_gap() const {
+  return _internal_has_fill_log_gap();
+}
+inline void ToReplicaMessage::set_has_fill_log_gap() {
+  _impl_._oneof_case_[0] = kFillLogGap;
+}
+inline void ToReplicaMessage::clear_fill_log_gap() {
+  if (_internal_has_fill_log_gap()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.msg_.fill_log_gap_;
+    }
+    clear_has_msg();
+  }
+}
+inline ::dsnet::spec::proto::FillLogGapMessage* ToReplicaMessage::release_fill_log_gap() {
+  // @@protoc_insertion_point(field_release:dsnet.spec.proto.ToReplicaMessage.fill_log_gap)
+  if (_internal_has_fill_log_gap()) {
+    clear_has_msg();
+    ::dsnet::spec::proto::FillLogGapMessage* temp = _impl_.msg_.fill_log_gap_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.msg_.fill_log_gap_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::dsnet::spec::proto::FillLogGapMessage& ToReplicaMessage::_internal_fill_log_gap() const {
+  return _internal_has_fill_log_gap()
+      ? *_impl_.msg_.fill_log_gap_
+      : reinterpret_cast< ::dsnet::spec::proto::FillLogGapMessage&>(::dsnet::spec::proto::_FillLogGapMessage_default_instance_);
+}
+inline const ::dsnet::spec::proto::FillLogGapMessage& ToReplicaMessage::fill_log_gap() const {
+  // @@protoc_insertion_point(field_get:dsnet.spec.proto.ToReplicaMessage.fill_log_gap)
+  return _internal_fill_log_gap();
+}
+inline ::dsnet::spec::proto::FillLogGapMessage* ToReplicaMessage::unsafe_arena_release_fill_log_gap() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:dsnet.spec.proto.ToReplicaMessage.fill_log_gap)
+  if (_internal_has_fill_log_gap()) {
+    clear_has_msg();
+    ::dsnet::spec::proto::FillLogGapMessage* temp = _impl_.msg_.fill_log_gap_;
+    _impl_.msg_.fill_log_gap_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void ToReplicaMessage::unsafe_arena_set_allocated_fill_log_gap(::dsnet::spec::proto::FillLogGapMessage* fill_log_gap) {
+  clear_msg();
+  if (fill_log_gap) {
+    set_has_fill_log_gap();
+    _impl_.msg_.fill_log_gap_ = fill_log_gap;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:dsnet.spec.proto.ToReplicaMessage.fill_log_gap)
+}
+inline ::dsnet::spec::proto::FillLogGapMessage* ToReplicaMessage::_internal_mutable_fill_log_gap() {
+  if (!_internal_has_fill_log_gap()) {
+    clear_msg();
+    set_has_fill_log_gap();
+    _impl_.msg_.fill_log_gap_ = CreateMaybeMessage< ::dsnet::spec::proto::FillLogGapMessage >(GetArenaForAllocation());
+  }
+  return _impl_.msg_.fill_log_gap_;
+}
+inline ::dsnet::spec::proto::FillLogGapMessage* ToReplicaMessage::mutable_fill_log_gap() {
+  ::dsnet::spec::proto::FillLogGapMessage* _msg = _internal_mutable_fill_log_gap();
+  // @@protoc_insertion_point(field_mutable:dsnet.spec.proto.ToReplicaMessage.fill_log_gap)
+  return _msg;
+}
+
+// .dsnet.spec.proto.FillDVCGapMessage fill_dvc_gap = 11;
+inline bool ToReplicaMessage::_internal_has_fill_dvc_gap() const {
+  return msg_case() == kFillDvcGap;
+}
+inline bool ToReplicaMessage::has_fill_dvc_gap() const {
+  return _internal_has_fill_dvc_gap();
+}
+inline void ToReplicaMessage::set_has_fill_dvc_gap() {
+  _impl_._oneof_case_[0] = kFillDvcGap;
+}
+inline void ToReplicaMessage::clear_fill_dvc_gap() {
+  if (_internal_has_fill_dvc_gap()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.msg_.fill_dvc_gap_;
+    }
+    clear_has_msg();
+  }
+}
+inline ::dsnet::spec::proto::FillDVCGapMessage* ToReplicaMessage::release_fill_dvc_gap() {
+  // @@protoc_insertion_point(field_release:dsnet.spec.proto.ToReplicaMessage.fill_dvc_gap)
+  if (_internal_has_fill_dvc_gap()) {
+    clear_has_msg();
+    ::dsnet::spec::proto::FillDVCGapMessage* temp = _impl_.msg_.fill_dvc_gap_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.msg_.fill_dvc_gap_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::dsnet::spec::proto::FillDVCGapMessage& ToReplicaMessage::_internal_fill_dvc_gap() const {
+  return _internal_has_fill_dvc_gap()
+      ? *_impl_.msg_.fill_dvc_gap_
+      : reinterpret_cast< ::dsnet::spec::proto::FillDVCGapMessage&>(::dsnet::spec::proto::_FillDVCGapMessage_default_instance_);
+}
+inline const ::dsnet::spec::proto::FillDVCGapMessage& ToReplicaMessage::fill_dvc_gap() const {
+  // @@protoc_insertion_point(field_get:dsnet.spec.proto.ToReplicaMessage.fill_dvc_gap)
+  return _internal_fill_dvc_gap();
+}
+inline ::dsnet::spec::proto::FillDVCGapMessage* ToReplicaMessage::unsafe_arena_release_fill_dvc_gap() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:dsnet.spec.proto.ToReplicaMessage.fill_dvc_gap)
+  if (_internal_has_fill_dvc_gap()) {
+    clear_has_msg();
+    ::dsnet::spec::proto::FillDVCGapMessage* temp = _impl_.msg_.fill_dvc_gap_;
+    _impl_.msg_.fill_dvc_gap_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void ToReplicaMessage::unsafe_arena_set_allocated_fill_dvc_gap(::dsnet::spec::proto::FillDVCGapMessage* fill_dvc_gap) {
+  clear_msg();
+  if (fill_dvc_gap) {
+    set_has_fill_dvc_gap();
+    _impl_.msg_.fill_dvc_gap_ = fill_dvc_gap;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:dsnet.spec.proto.ToReplicaMessage.fill_dvc_gap)
+}
+inline ::dsnet::spec::proto::FillDVCGapMessage* ToReplicaMessage::_internal_mutable_fill_dvc_gap() {
+  if (!_internal_has_fill_dvc_gap()) {
+    clear_msg();
+    set_has_fill_dvc_gap();
+    _impl_.msg_.fill_dvc_gap_ = CreateMaybeMessage< ::dsnet::spec::proto::FillDVCGapMessage >(GetArenaForAllocation());
+  }
+  return _impl_.msg_.fill_dvc_gap_;
+}
+inline ::dsnet::spec::proto::FillDVCGapMessage* ToReplicaMessage::mutable_fill_dvc_gap() {
+  ::dsnet::spec::proto::FillDVCGapMessage* _msg = _internal_mutable_fill_dvc_gap();
+  // @@protoc_insertion_point(field_mutable:dsnet.spec.proto.ToReplicaMessage.fill_dvc_gap)
+  return _msg;
+}
+
+inline bool ToReplicaMessage::has_msg() const {
+  return msg_case() != MSG_NOT_SET;
+}
+inline void ToReplicaMessage::clear_has_msg() {
+  _impl_._oneof_case_[0] = MSG_NOT_SET;
+}
+inline ToReplicaMessage::MsgCase ToReplicaMessage::msg_case() const {
+  return ToReplicaMessage::MsgCase(_impl_._oneof_case_[0]);
+}
+#ifdef __GNUC__
+  #pragma GCC diagnostic pop
+#endif  // __GNUC__
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+
+// @@protoc_insertion_point(namespace_scope)
+
+}  // namespace proto
+}  // namespace spec
+}  // namespace dsnet
+
+// @@protoc_insertion_point(global_scope)
+
+#include <google/protobuf/port_undef.inc>
+#endif  // GOOGLE_PROTOBUF_INCLUDED_GOOGLE_PROTOBUF_INCLUDED_replication_2fspec_2fspec_2dproto_2eproto
@@ -0,0 +1,2021 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: replication/tombft/message.proto
+
+#include "replication/tombft/message.pb.h"
+
+#include <algorithm>
+
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/extension_set.h>
+#include <google/protobuf/wire_format_lite.h>
+#include <google/protobuf/descriptor.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/reflection_ops.h>
+#include <google/protobuf/wire_format.h>
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+
+PROTOBUF_PRAGMA_INIT_SEG
+
+namespace _pb = ::PROTOBUF_NAMESPACE_ID;
+namespace _pbi = _pb::internal;
+
+namespace dsnet {
+namespace tombft {
+namespace proto {
+PROTOBUF_CONSTEXPR Message::Message(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.get_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_._oneof_case_)*/{}} {}
+struct MessageDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR MessageDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~MessageDefaultTypeInternal() {}
+  union {
+    Message _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 MessageDefaultTypeInternal _Message_default_instance_;
+PROTOBUF_CONSTEXPR ReplyMessage::ReplyMessage(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.result_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.client_request_)*/0u
+  , /*decltype(_impl_.replica_index_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct ReplyMessageDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ReplyMessageDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ReplyMessageDefaultTypeInternal() {}
+  union {
+    ReplyMessage _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ReplyMessageDefaultTypeInternal _ReplyMessage_default_instance_;
+PROTOBUF_CONSTEXPR QueryMessage::QueryMessage(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.replica_index_)*/0
+  , /*decltype(_impl_.message_number_)*/0u
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct QueryMessageDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR QueryMessageDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~QueryMessageDefaultTypeInternal() {}
+  union {
+    QueryMessage _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 QueryMessageDefaultTypeInternal _QueryMessage_default_instance_;
+PROTOBUF_CONSTEXPR ViewChange::ViewChange(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.view_number_)*/0u
+  , /*decltype(_impl_.next_view_number_)*/0u
+  , /*decltype(_impl_.high_message_number_)*/0u
+  , /*decltype(_impl_.replica_index_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct ViewChangeDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ViewChangeDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ViewChangeDefaultTypeInternal() {}
+  union {
+    ViewChange _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ViewChangeDefaultTypeInternal _ViewChange_default_instance_;
+PROTOBUF_CONSTEXPR ViewStart::ViewStart(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.view_number_)*/0u
+  , /*decltype(_impl_.high_message_number_)*/0u
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct ViewStartDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ViewStartDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ViewStartDefaultTypeInternal() {}
+  union {
+    ViewStart _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ViewStartDefaultTypeInternal _ViewStart_default_instance_;
+PROTOBUF_CONSTEXPR EpochStart::EpochStart(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.session_number_)*/0u
+  , /*decltype(_impl_.high_message_number_)*/0u
+  , /*decltype(_impl_.replica_index_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct EpochStartDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR EpochStartDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~EpochStartDefaultTypeInternal() {}
+  union {
+    EpochStart _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 EpochStartDefaultTypeInternal _EpochStart_default_instance_;
+}  // namespace proto
+}  // namespace tombft
+}  // namespace dsnet
+static ::_pb::Metadata file_level_metadata_replication_2ftombft_2fmessage_2eproto[6];
+static constexpr ::_pb::EnumDescriptor const** file_level_enum_descriptors_replication_2ftombft_2fmessage_2eproto = nullptr;
+static constexpr ::_pb::ServiceDescriptor const** file_level_service_descriptors_replication_2ftombft_2fmessage_2eproto = nullptr;
+
+const uint32_t TableStruct_replication_2ftombft_2fmessage_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::dsnet::tombft::proto::Message, _internal_metadata_),
+  ~0u,  // no _extensions_
+  PROTOBUF_FIELD_OFFSET(::dsnet::tombft::proto::Message, _impl_._oneof_case_[0]),
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  PROTOBUF_FIELD_OFFSET(::dsnet::tombft::proto::Message, _impl_.get_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::dsnet::tombft::proto::ReplyMessage, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::dsnet::tombft::proto::ReplyMessage, _impl_.client_request_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::tombft::proto::ReplyMessage, _impl_.result_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::tombft::proto::ReplyMessage, _impl_.replica_index_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::dsnet::tombft::proto::QueryMessage, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::dsnet::tombft::proto::QueryMessage, _impl_.replica_index_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::tombft::proto::QueryMessage, _impl_.message_number_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::dsnet::tombft::proto::ViewChange, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::dsnet::tombft::proto::ViewChange, _impl_.view_number_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::tombft::proto::ViewChange, _impl_.next_view_number_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::tombft::proto::ViewChange, _impl_.high_message_number_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::tombft::proto::ViewChange, _impl_.replica_index_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::dsnet::tombft::proto::ViewStart, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::dsnet::tombft::proto::ViewStart, _impl_.view_number_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::tombft::proto::ViewStart, _impl_.high_message_number_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::dsnet::tombft::proto::EpochStart, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::dsnet::tombft::proto::EpochStart, _impl_.session_number_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::tombft::proto::EpochStart, _impl_.high_message_number_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::tombft::proto::EpochStart, _impl_.replica_index_),
+};
+static const ::_pbi::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  { 0, -1, -1, sizeof(::dsnet::tombft::proto::Message)},
+  { 13, -1, -1, sizeof(::dsnet::tombft::proto::ReplyMessage)},
+  { 22, -1, -1, sizeof(::dsnet::tombft::proto::QueryMessage)},
+  { 30, -1, -1, sizeof(::dsnet::tombft::proto::ViewChange)},
+  { 40, -1, -1, sizeof(::dsnet::tombft::proto::ViewStart)},
+  { 48, -1, -1, sizeof(::dsnet::tombft::proto::EpochStart)},
+};
+
+static const ::_pb::Message* const file_default_instances[] = {
+  &::dsnet::tombft::proto::_Message_default_instance_._instance,
+  &::dsnet::tombft::proto::_ReplyMessage_default_instance_._instance,
+  &::dsnet::tombft::proto::_QueryMessage_default_instance_._instance,
+  &::dsnet::tombft::proto::_ViewChange_default_instance_._instance,
+  &::dsnet::tombft::proto::_ViewStart_default_instance_._instance,
+  &::dsnet::tombft::proto::_EpochStart_default_instance_._instance,
+};
+
+const char descriptor_table_protodef_replication_2ftombft_2fmessage_2eproto[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) =
+  "\n replication/tombft/message.proto\022\022dsne"
+  "t.tombft.proto\032\024common/request.proto\"\274\002\n"
+  "\007Message\022!\n\007request\030\001 \001(\0132\016.dsnet.Reques"
+  "tH\000\0221\n\005reply\030\002 \001(\0132 .dsnet.tombft.proto."
+  "ReplyMessageH\000\0225\n\013view_change\030\003 \001(\0132\036.ds"
+  "net.tombft.proto.ViewChangeH\000\0223\n\nview_st"
+  "art\030\004 \001(\0132\035.dsnet.tombft.proto.ViewStart"
+  "H\000\0225\n\013epoch_start\030\005 \001(\0132\036.dsnet.tombft.p"
+  "roto.EpochStartH\000\0221\n\005query\030\006 \001(\0132 .dsnet"
+  ".tombft.proto.QueryMessageH\000B\005\n\003get\"M\n\014R"
+  "eplyMessage\022\026\n\016client_request\030\001 \001(\r\022\016\n\006r"
+  "esult\030\002 \001(\014\022\025\n\rreplica_index\030\003 \001(\005\"=\n\014Qu"
+  "eryMessage\022\025\n\rreplica_index\030\001 \001(\005\022\026\n\016mes"
+  "sage_number\030\002 \001(\r\"o\n\nViewChange\022\023\n\013view_"
+  "number\030\001 \001(\r\022\030\n\020next_view_number\030\002 \001(\r\022\033"
+  "\n\023high_message_number\030\003 \001(\r\022\025\n\rreplica_i"
+  "ndex\030\004 \001(\005\"=\n\tViewStart\022\023\n\013view_number\030\001"
+  " \001(\r\022\033\n\023high_message_number\030\002 \001(\r\"X\n\nEpo"
+  "chStart\022\026\n\016session_number\030\001 \001(\r\022\033\n\023high_"
+  "message_number\030\002 \001(\r\022\025\n\rreplica_index\030\003 "
+  "\001(\005b\006proto3"
+  ;
+static const ::_pbi::DescriptorTable* const descriptor_table_replication_2ftombft_2fmessage_2eproto_deps[1] = {
+  &::descriptor_table_common_2frequest_2eproto,
+};
+static ::_pbi::once_flag descriptor_table_replication_2ftombft_2fmessage_2eproto_once;
+const ::_pbi::DescriptorTable descriptor_table_replication_2ftombft_2fmessage_2eproto = {
+    false, false, 811, descriptor_table_protodef_replication_2ftombft_2fmessage_2eproto,
+    "replication/tombft/message.proto",
+    &descriptor_table_replication_2ftombft_2fmessage_2eproto_once, descriptor_table_replication_2ftombft_2fmessage_2eproto_deps, 1, 6,
+    schemas, file_default_instances, TableStruct_replication_2ftombft_2fmessage_2eproto::offsets,
+    file_level_metadata_replication_2ftombft_2fmessage_2eproto, file_level_enum_descriptors_replication_2ftombft_2fmessage_2eproto,
+    file_level_service_descriptors_replication_2ftombft_2fmessage_2eproto,
+};
+PROTOBUF_ATTRIBUTE_WEAK const ::_pbi::DescriptorTable* descriptor_table_replication_2ftombft_2fmessage_2eproto_getter() {
+  return &descriptor_table_replication_2ftombft_2fmessage_2eproto;
+}
+
+// Force running AddDescriptors() at dynamic initialization time.
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 static ::_pbi::AddDescriptorsRunner dynamic_init_dummy_replication_2ftombft_2fmessage_2eproto(&descriptor_table_replication_2ftombft_2fmessage_2eproto);
+namespace dsnet {
+namespace tombft {
+namespace proto {
+
+// ===================================================================
+
+class Message::_Internal {
+ public:
+  static const ::dsnet::Request& request(const Message* msg);
+  static const ::dsnet::tombft::proto::ReplyMessage& reply(const Message* msg);
+  static const ::dsnet::tombft::proto::ViewChange& view_change(const Message* msg);
+  static const ::dsnet::tombft::proto::ViewStart& view_start(const Message* msg);
+  static const ::dsnet::tombft::proto::EpochStart& epoch_start(const Message* msg);
+  static const ::dsnet::tombft::proto::QueryMessage& query(const Message* msg);
+};
+
+const ::dsnet::Request&
+Message::_Internal::request(const Message* msg) {
+  return *msg->_impl_.get_.request_;
+}
+const ::dsnet::tombft::proto::ReplyMessage&
+Message::_Internal::reply(const Message* msg) {
+  return *msg->_impl_.get_.reply_;
+}
+const ::dsnet::tombft::proto::ViewChange&
+Message::_Internal::view_change(const Message* msg) {
+  return *msg->_impl_.get_.view_change_;
+}
+const ::dsnet::tombft::proto::ViewStart&
+Message::_Internal::view_start(const Message* msg) {
+  return *msg->_impl_.get_.view_start_;
+}
+const ::dsnet::tombft::proto::EpochStart&
+Message::_Internal::epoch_start(const Message* msg) {
+  return *msg->_impl_.get_.epoch_start_;
+}
+const ::dsnet::tombft::proto::QueryMessage&
+Message::_Internal::query(const Message* msg) {
+  return *msg->_impl_.get_.query_;
+}
+void Message::set_allocated_request(::dsnet::Request* request) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  clear_get();
+  if (request) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(
+                reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(request));
+    if (message_arena != submessage_arena) {
+      request = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, request, submessage_arena);
+    }
+    set_has_request();
+    _impl_.get_.request_ = request;
+  }
+  // @@protoc_insertion_point(field_set_allocated:dsnet.tombft.proto.Message.request)
+}
+void Message::clear_request() {
+  if (_internal_has_request()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.get_.request_;
+    }
+    clear_has_get();
+  }
+}
+void Message::set_allocated_reply(::dsnet::tombft::proto::ReplyMessage* reply) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  clear_get();
+  if (reply) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(reply);
+    if (message_arena != submessage_arena) {
+      reply = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, reply, submessage_arena);
+    }
+    set_has_reply();
+    _impl_.get_.reply_ = reply;
+  }
+  // @@protoc_insertion_point(field_set_allocated:dsnet.tombft.proto.Message.reply)
+}
+void Message::set_allocated_view_change(::dsnet::tombft::proto::ViewChange* view_change) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  clear_get();
+  if (view_change) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(view_change);
+    if (message_arena != submessage_arena) {
+      view_change = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, view_change, submessage_arena);
+    }
+    set_has_view_change();
+    _impl_.get_.view_change_ = view_change;
+  }
+  // @@protoc_insertion_point(field_set_allocated:dsnet.tombft.proto.Message.view_change)
+}
+void Message::set_allocated_view_start(::dsnet::tombft::proto::ViewStart* view_start) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  clear_get();
+  if (view_start) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(view_start);
+    if (message_arena != submessage_arena) {
+      view_start = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, view_start, submessage_arena);
+    }
+    set_has_view_start();
+    _impl_.get_.view_start_ = view_start;
+  }
+  // @@protoc_insertion_point(field_set_allocated:dsnet.tombft.proto.Message.view_start)
+}
+void Message::set_allocated_epoch_start(::dsnet::tombft::proto::EpochStart* epoch_start) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  clear_get();
+  if (epoch_start) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(epoch_start);
+    if (message_arena != submessage_arena) {
+      epoch_start = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, epoch_start, submessage_arena);
+    }
+    set_has_epoch_start();
+    _impl_.get_.epoch_start_ = epoch_start;
+  }
+  // @@protoc_insertion_point(field_set_allocated:dsnet.tombft.proto.Message.epoch_start)
+}
+void Message::set_allocated_query(::dsnet::tombft::proto::QueryMessage* query) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  clear_get();
+  if (query) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(query);
+    if (message_arena != submessage_arena) {
+      query = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, query, submessage_arena);
+    }
+    set_has_query();
+    _impl_.get_.query_ = query;
+  }
+  // @@protoc_insertion_point(field_set_allocated:dsnet.tombft.proto.Message.query)
+}
+Message::Message(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:dsnet.tombft.proto.Message)
+}
+Message::Message(const Message& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  Message* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.get_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , /*decltype(_impl_._oneof_case_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  clear_has_get();
+  switch (from.get_case()) {
+    case kRequest: {
+      _this->_internal_mutable_request()->::dsnet::Request::MergeFrom(
+          from._internal_request());
+      break;
+    }
+    case kReply: {
+      _this->_internal_mutable_reply()->::dsnet::tombft::proto::ReplyMessage::MergeFrom(
+          from._internal_reply());
+      break;
+    }
+    case kViewChange: {
+      _this->_internal_mutable_view_change()->::dsnet::tombft::proto::ViewChange::MergeFrom(
+          from._internal_view_change());
+      break;
+    }
+    case kViewStart: {
+      _this->_internal_mutable_view_start()->::dsnet::tombft::proto::ViewStart::MergeFrom(
+          from._internal_view_start());
+      break;
+    }
+    case kEpochStart: {
+      _this->_internal_mutable_epoch_start()->::dsnet::tombft::proto::EpochStart::MergeFrom(
+          from._internal_epoch_start());
+      break;
+    }
+    case kQuery: {
+      _this->_internal_mutable_query()->::dsnet::tombft::proto::QueryMessage::MergeFrom(
+          from._internal_query());
+      break;
+    }
+    case GET_NOT_SET: {
+      break;
+    }
+  }
+  // @@protoc_insertion_point(copy_constructor:dsnet.tombft.proto.Message)
+}
+
+inline void Message::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.get_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , /*decltype(_impl_._oneof_case_)*/{}
+  };
+  clear_has_get();
+}
+
+Message::~Message() {
+  // @@protoc_insertion_point(destructor:dsnet.tombft.proto.Message)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void Message::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  if (has_get()) {
+    clear_get();
+  }
+}
+
+void Message::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void Message::clear_get() {
+// @@protoc_insertion_point(one_of_clear_start:dsnet.tombft.proto.Message)
+  switch (get_case()) {
+    case kRequest: {
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.get_.request_;
+      }
+      break;
+    }
+    case kReply: {
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.get_.reply_;
+      }
+      break;
+    }
+    case kViewChange: {
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.get_.view_change_;
+      }
+      break;
+    }
+    case kViewStart: {
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.get_.view_start_;
+      }
+      break;
+    }
+    case kEpochStart: {
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.get_.epoch_start_;
+      }
+      break;
+    }
+    case kQuery: {
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.get_.query_;
+      }
+      break;
+    }
+    case GET_NOT_SET: {
+      break;
+    }
+  }
+  _impl_._oneof_case_[0] = GET_NOT_SET;
+}
+
+
+void Message::Clear() {
+// @@protoc_insertion_point(message_clear_start:dsnet.tombft.proto.Message)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  clear_get();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* Message::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // .dsnet.Request request = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr = ctx->ParseMessage(_internal_mutable_request(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .dsnet.tombft.proto.ReplyMessage reply = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr = ctx->ParseMessage(_internal_mutable_reply(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .dsnet.tombft.proto.ViewChange view_change = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          ptr = ctx->ParseMessage(_internal_mutable_view_change(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .dsnet.tombft.proto.ViewStart view_start = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          ptr = ctx->ParseMessage(_internal_mutable_view_start(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .dsnet.tombft.proto.EpochStart epoch_start = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 42)) {
+          ptr = ctx->ParseMessage(_internal_mutable_epoch_start(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .dsnet.tombft.proto.QueryMessage query = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 50)) {
+          ptr = ctx->ParseMessage(_internal_mutable_query(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* Message::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:dsnet.tombft.proto.Message)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // .dsnet.Request request = 1;
+  if (_internal_has_request()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(1, _Internal::request(this),
+        _Internal::request(this).GetCachedSize(), target, stream);
+  }
+
+  // .dsnet.tombft.proto.ReplyMessage reply = 2;
+  if (_internal_has_reply()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(2, _Internal::reply(this),
+        _Internal::reply(this).GetCachedSize(), target, stream);
+  }
+
+  // .dsnet.tombft.proto.ViewChange view_change = 3;
+  if (_internal_has_view_change()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(3, _Internal::view_change(this),
+        _Internal::view_change(this).GetCachedSize(), target, stream);
+  }
+
+  // .dsnet.tombft.proto.ViewStart view_start = 4;
+  if (_internal_has_view_start()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(4, _Internal::view_start(this),
+        _Internal::view_start(this).GetCachedSize(), target, stream);
+  }
+
+  // .dsnet.tombft.proto.EpochStart epoch_start = 5;
+  if (_internal_has_epoch_start()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(5, _Internal::epoch_start(this),
+        _Internal::epoch_start(this).GetCachedSize(), target, stream);
+  }
+
+  // .dsnet.tombft.proto.QueryMessage query = 6;
+  if (_internal_has_query()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(6, _Internal::query(this),
+        _Internal::query(this).GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:dsnet.tombft.proto.Message)
+  return target;
+}
+
+size_t Message::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:dsnet.tombft.proto.Message)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  switch (get_case()) {
+    // .dsnet.Request request = 1;
+    case kRequest: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.get_.request_);
+      break;
+    }
+    // .dsnet.tombft.proto.ReplyMessage reply = 2;
+    case kReply: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.get_.reply_);
+      break;
+    }
+    // .dsnet.tombft.proto.ViewChange view_change = 3;
+    case kViewChange: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.get_.view_change_);
+      break;
+    }
+    // .dsnet.tombft.proto.ViewStart view_start = 4;
+    case kViewStart: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.get_.view_start_);
+      break;
+    }
+    // .dsnet.tombft.proto.EpochStart epoch_start = 5;
+    case kEpochStart: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.get_.epoch_start_);
+      break;
+    }
+    // .dsnet.tombft.proto.QueryMessage query = 6;
+    case kQuery: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.get_.query_);
+      break;
+    }
+    case GET_NOT_SET: {
+      break;
+    }
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData Message::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    Message::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*Message::GetClassData() const { return &_class_data_; }
+
+
+void Message::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<Message*>(&to_msg);
+  auto& from = static_cast<const Message&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:dsnet.tombft.proto.Message)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  switch (from.get_case()) {
+    case kRequest: {
+      _this->_internal_mutable_request()->::dsnet::Request::MergeFrom(
+          from._internal_request());
+      break;
+    }
+    case kReply: {
+      _this->_internal_mutable_reply()->::dsnet::tombft::proto::ReplyMessage::MergeFrom(
+          from._internal_reply());
+      break;
+    }
+    case kViewChange: {
+      _this->_internal_mutable_view_change()->::dsnet::tombft::proto::ViewChange::MergeFrom(
+          from._internal_view_change());
+      break;
+    }
+    case kViewStart: {
+      _this->_internal_mutable_view_start()->::dsnet::tombft::proto::ViewStart::MergeFrom(
+          from._internal_view_start());
+      break;
+    }
+    case kEpochStart: {
+      _this->_internal_mutable_epoch_start()->::dsnet::tombft::proto::EpochStart::MergeFrom(
+          from._internal_epoch_start());
+      break;
+    }
+    case kQuery: {
+      _this->_internal_mutable_query()->::dsnet::tombft::proto::QueryMessage::MergeFrom(
+          from._internal_query());
+      break;
+    }
+    case GET_NOT_SET: {
+      break;
+    }
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void Message::CopyFrom(const Message& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:dsnet.tombft.proto.Message)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool Message::IsInitialized() const {
+  switch (get_case()) {
+    case kRequest: {
+      if (_internal_has_request()) {
+        if (!_impl_.get_.request_->IsInitialized()) return false;
+      }
+      break;
+    }
+    case kReply: {
+      break;
+    }
+    case kViewChange: {
+      break;
+    }
+    case kViewStart: {
+      break;
+    }
+    case kEpochStart: {
+      break;
+    }
+    case kQuery: {
+      break;
+    }
+    case GET_NOT_SET: {
+      break;
+    }
+  }
+  return true;
+}
+
+void Message::InternalSwap(Message* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_.get_, other->_impl_.get_);
+  swap(_impl_._oneof_case_[0], other->_impl_._oneof_case_[0]);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata Message::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_replication_2ftombft_2fmessage_2eproto_getter, &descriptor_table_replication_2ftombft_2fmessage_2eproto_once,
+      file_level_metadata_replication_2ftombft_2fmessage_2eproto[0]);
+}
+
+// ===================================================================
+
+class ReplyMessage::_Internal {
+ public:
+};
+
+ReplyMessage::ReplyMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:dsnet.tombft.proto.ReplyMessage)
+}
+ReplyMessage::ReplyMessage(const ReplyMessage& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  ReplyMessage* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.result_){}
+    , decltype(_impl_.client_request_){}
+    , decltype(_impl_.replica_index_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.result_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.result_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_result().empty()) {
+    _this->_impl_.result_.Set(from._internal_result(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.client_request_, &from._impl_.client_request_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.replica_index_) -
+    reinterpret_cast<char*>(&_impl_.client_request_)) + sizeof(_impl_.replica_index_));
+  // @@protoc_insertion_point(copy_constructor:dsnet.tombft.proto.ReplyMessage)
+}
+
+inline void ReplyMessage::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.result_){}
+    , decltype(_impl_.client_request_){0u}
+    , decltype(_impl_.replica_index_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.result_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.result_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+ReplyMessage::~ReplyMessage() {
+  // @@protoc_insertion_point(destructor:dsnet.tombft.proto.ReplyMessage)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void ReplyMessage::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.result_.Destroy();
+}
+
+void ReplyMessage::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void ReplyMessage::Clear() {
+// @@protoc_insertion_point(message_clear_start:dsnet.tombft.proto.ReplyMessage)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.result_.ClearToEmpty();
+  ::memset(&_impl_.client_request_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.replica_index_) -
+      reinterpret_cast<char*>(&_impl_.client_request_)) + sizeof(_impl_.replica_index_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* ReplyMessage::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // uint32 client_request = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.client_request_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // bytes result = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_result();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int32 replica_index = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.replica_index_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* ReplyMessage::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:dsnet.tombft.proto.ReplyMessage)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // uint32 client_request = 1;
+  if (this->_internal_client_request() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(1, this->_internal_client_request(), target);
+  }
+
+  // bytes result = 2;
+  if (!this->_internal_result().empty()) {
+    target = stream->WriteBytesMaybeAliased(
+        2, this->_internal_result(), target);
+  }
+
+  // int32 replica_index = 3;
+  if (this->_internal_replica_index() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(3, this->_internal_replica_index(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:dsnet.tombft.proto.ReplyMessage)
+  return target;
+}
+
+size_t ReplyMessage::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:dsnet.tombft.proto.ReplyMessage)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // bytes result = 2;
+  if (!this->_internal_result().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_result());
+  }
+
+  // uint32 client_request = 1;
+  if (this->_internal_client_request() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_client_request());
+  }
+
+  // int32 replica_index = 3;
+  if (this->_internal_replica_index() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_replica_index());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ReplyMessage::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    ReplyMessage::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ReplyMessage::GetClassData() const { return &_class_data_; }
+
+
+void ReplyMessage::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<ReplyMessage*>(&to_msg);
+  auto& from = static_cast<const ReplyMessage&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:dsnet.tombft.proto.ReplyMessage)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_result().empty()) {
+    _this->_internal_set_result(from._internal_result());
+  }
+  if (from._internal_client_request() != 0) {
+    _this->_internal_set_client_request(from._internal_client_request());
+  }
+  if (from._internal_replica_index() != 0) {
+    _this->_internal_set_replica_index(from._internal_replica_index());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void ReplyMessage::CopyFrom(const ReplyMessage& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:dsnet.tombft.proto.ReplyMessage)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool ReplyMessage::IsInitialized() const {
+  return true;
+}
+
+void ReplyMessage::InternalSwap(ReplyMessage* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.result_, lhs_arena,
+      &other->_impl_.result_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(ReplyMessage, _impl_.replica_index_)
+      + sizeof(ReplyMessage::_impl_.replica_index_)
+      - PROTOBUF_FIELD_OFFSET(ReplyMessage, _impl_.client_request_)>(
+          reinterpret_cast<char*>(&_impl_.client_request_),
+          reinterpret_cast<char*>(&other->_impl_.client_request_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata ReplyMessage::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_replication_2ftombft_2fmessage_2eproto_getter, &descriptor_table_replication_2ftombft_2fmessage_2eproto_once,
+      file_level_metadata_replication_2ftombft_2fmessage_2eproto[1]);
+}
+
+// ===================================================================
+
+class QueryMessage::_Internal {
+ public:
+};
+
+QueryMessage::QueryMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:dsnet.tombft.proto.QueryMessage)
+}
+QueryMessage::QueryMessage(const QueryMessage& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  QueryMessage* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.replica_index_){}
+    , decltype(_impl_.message_number_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.replica_index_, &from._impl_.replica_index_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.message_number_) -
+    reinterpret_cast<char*>(&_impl_.replica_index_)) + sizeof(_impl_.message_number_));
+  // @@protoc_insertion_point(copy_constructor:dsnet.tombft.proto.QueryMessage)
+}
+
+inline void QueryMessage::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.replica_index_){0}
+    , decltype(_impl_.message_number_){0u}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+QueryMessage::~QueryMessage() {
+  // @@protoc_insertion_point(destructor:dsnet.tombft.proto.QueryMessage)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void QueryMessage::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void QueryMessage::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void QueryMessage::Clear() {
+// @@protoc_insertion_point(message_clear_start:dsnet.tombft.proto.QueryMessage)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  ::memset(&_impl_.replica_index_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.message_number_) -
+      reinterpret_cast<char*>(&_impl_.replica_index_)) + sizeof(_impl_.message_number_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* QueryMessage::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // int32 replica_index = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.replica_index_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint32 message_number = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.message_number_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* QueryMessage::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:dsnet.tombft.proto.QueryMessage)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // int32 replica_index = 1;
+  if (this->_internal_replica_index() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(1, this->_internal_replica_index(), target);
+  }
+
+  // uint32 message_number = 2;
+  if (this->_internal_message_number() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(2, this->_internal_message_number(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:dsnet.tombft.proto.QueryMessage)
+  return target;
+}
+
+size_t QueryMessage::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:dsnet.tombft.proto.QueryMessage)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // int32 replica_index = 1;
+  if (this->_internal_replica_index() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_replica_index());
+  }
+
+  // uint32 message_number = 2;
+  if (this->_internal_message_number() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_message_number());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData QueryMessage::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    QueryMessage::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*QueryMessage::GetClassData() const { return &_class_data_; }
+
+
+void QueryMessage::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<QueryMessage*>(&to_msg);
+  auto& from = static_cast<const QueryMessage&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:dsnet.tombft.proto.QueryMessage)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_replica_index() != 0) {
+    _this->_internal_set_replica_index(from._internal_replica_index());
+  }
+  if (from._internal_message_number() != 0) {
+    _this->_internal_set_message_number(from._internal_message_number());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void QueryMessage::CopyFrom(const QueryMessage& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:dsnet.tombft.proto.QueryMessage)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool QueryMessage::IsInitialized() const {
+  return true;
+}
+
+void QueryMessage::InternalSwap(QueryMessage* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(QueryMessage, _impl_.message_number_)
+      + sizeof(QueryMessage::_impl_.message_number_)
+      - PROTOBUF_FIELD_OFFSET(QueryMessage, _impl_.replica_index_)>(
+          reinterpret_cast<char*>(&_impl_.replica_index_),
+          reinterpret_cast<char*>(&other->_impl_.replica_index_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata QueryMessage::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_replication_2ftombft_2fmessage_2eproto_getter, &descriptor_table_replication_2ftombft_2fmessage_2eproto_once,
+      file_level_metadata_replication_2ftombft_2fmessage_2eproto[2]);
+}
+
+// ===================================================================
+
+class ViewChange::_Internal {
+ public:
+};
+
+ViewChange::ViewChange(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:dsnet.tombft.proto.ViewChange)
+}
+ViewChange::ViewChange(const ViewChange& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  ViewChange* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.view_number_){}
+    , decltype(_impl_.next_view_number_){}
+    , decltype(_impl_.high_message_number_){}
+    , decltype(_impl_.replica_index_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.view_number_, &from._impl_.view_number_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.replica_index_) -
+    reinterpret_cast<char*>(&_impl_.view_number_)) + sizeof(_impl_.replica_index_));
+  // @@protoc_insertion_point(copy_constructor:dsnet.tombft.proto.ViewChange)
+}
+
+inline void ViewChange::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.view_number_){0u}
+    , decltype(_impl_.next_view_number_){0u}
+    , decltype(_impl_.high_message_number_){0u}
+    , decltype(_impl_.replica_index_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+ViewChange::~ViewChange() {
+  // @@protoc_insertion_point(destructor:dsnet.tombft.proto.ViewChange)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void ViewChange::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void ViewChange::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void ViewChange::Clear() {
+// @@protoc_insertion_point(message_clear_start:dsnet.tombft.proto.ViewChange)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  ::memset(&_impl_.view_number_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.replica_index_) -
+      reinterpret_cast<char*>(&_impl_.view_number_)) + sizeof(_impl_.replica_index_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* ViewChange::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // uint32 view_number = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.view_number_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint32 next_view_number = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.next_view_number_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint32 high_message_number = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.high_message_number_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int32 replica_index = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _impl_.replica_index_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* ViewChange::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:dsnet.tombft.proto.ViewChange)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // uint32 view_number = 1;
+  if (this->_internal_view_number() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(1, this->_internal_view_number(), target);
+  }
+
+  // uint32 next_view_number = 2;
+  if (this->_internal_next_view_number() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(2, this->_internal_next_view_number(), target);
+  }
+
+  // uint32 high_message_number = 3;
+  if (this->_internal_high_message_number() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(3, this->_internal_high_message_number(), target);
+  }
+
+  // int32 replica_index = 4;
+  if (this->_internal_replica_index() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(4, this->_internal_replica_index(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:dsnet.tombft.proto.ViewChange)
+  return target;
+}
+
+size_t ViewChange::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:dsnet.tombft.proto.ViewChange)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // uint32 view_number = 1;
+  if (this->_internal_view_number() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_view_number());
+  }
+
+  // uint32 next_view_number = 2;
+  if (this->_internal_next_view_number() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_next_view_number());
+  }
+
+  // uint32 high_message_number = 3;
+  if (this->_internal_high_message_number() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_high_message_number());
+  }
+
+  // int32 replica_index = 4;
+  if (this->_internal_replica_index() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_replica_index());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ViewChange::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    ViewChange::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ViewChange::GetClassData() const { return &_class_data_; }
+
+
+void ViewChange::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<ViewChange*>(&to_msg);
+  auto& from = static_cast<const ViewChange&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:dsnet.tombft.proto.ViewChange)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_view_number() != 0) {
+    _this->_internal_set_view_number(from._internal_view_number());
+  }
+  if (from._internal_next_view_number() != 0) {
+    _this->_internal_set_next_view_number(from._internal_next_view_number());
+  }
+  if (from._internal_high_message_number() != 0) {
+    _this->_internal_set_high_message_number(from._internal_high_message_number());
+  }
+  if (from._internal_replica_index() != 0) {
+    _this->_internal_set_replica_index(from._internal_replica_index());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void ViewChange::CopyFrom(const ViewChange& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:dsnet.tombft.proto.ViewChange)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool ViewChange::IsInitialized() const {
+  return true;
+}
+
+void ViewChange::InternalSwap(ViewChange* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(ViewChange, _impl_.replica_index_)
+      + sizeof(ViewChange::_impl_.replica_index_)
+      - PROTOBUF_FIELD_OFFSET(ViewChange, _impl_.view_number_)>(
+          reinterpret_cast<char*>(&_impl_.view_number_),
+          reinterpret_cast<char*>(&other->_impl_.view_number_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata ViewChange::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_replication_2ftombft_2fmessage_2eproto_getter, &descriptor_table_replication_2ftombft_2fmessage_2eproto_once,
+      file_level_metadata_replication_2ftombft_2fmessage_2eproto[3]);
+}
+
+// ===================================================================
+
+class ViewStart::_Internal {
+ public:
+};
+
+ViewStart::ViewStart(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:dsnet.tombft.proto.ViewStart)
+}
+ViewStart::ViewStart(const ViewStart& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  ViewStart* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.view_number_){}
+    , decltype(_impl_.high_message_number_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.view_number_, &from._impl_.view_number_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.high_message_number_) -
+    reinterpret_cast<char*>(&_impl_.view_number_)) + sizeof(_impl_.high_message_number_));
+  // @@protoc_insertion_point(copy_constructor:dsnet.tombft.proto.ViewStart)
+}
+
+inline void ViewStart::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.view_number_){0u}
+    , decltype(_impl_.high_message_number_){0u}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+ViewStart::~ViewStart() {
+  // @@protoc_insertion_point(destructor:dsnet.tombft.proto.ViewStart)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void ViewStart::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void ViewStart::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void ViewStart::Clear() {
+// @@protoc_insertion_point(message_clear_start:dsnet.tombft.proto.ViewStart)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  ::memset(&_impl_.view_number_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.high_message_number_) -
+      reinterpret_cast<char*>(&_impl_.view_number_)) + sizeof(_impl_.high_message_number_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* ViewStart::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // uint32 view_number = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.view_number_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint32 high_message_number = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.high_message_number_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* ViewStart::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:dsnet.tombft.proto.ViewStart)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // uint32 view_number = 1;
+  if (this->_internal_view_number() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(1, this->_internal_view_number(), target);
+  }
+
+  // uint32 high_message_number = 2;
+  if (this->_internal_high_message_number() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(2, this->_internal_high_message_number(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:dsnet.tombft.proto.ViewStart)
+  return target;
+}
+
+size_t ViewStart::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:dsnet.tombft.proto.ViewStart)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // uint32 view_number = 1;
+  if (this->_internal_view_number() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_view_number());
+  }
+
+  // uint32 high_message_number = 2;
+  if (this->_internal_high_message_number() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_high_message_number());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ViewStart::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    ViewStart::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ViewStart::GetClassData() const { return &_class_data_; }
+
+
+void ViewStart::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<ViewStart*>(&to_msg);
+  auto& from = static_cast<const ViewStart&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:dsnet.tombft.proto.ViewStart)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_view_number() != 0) {
+    _this->_internal_set_view_number(from._internal_view_number());
+  }
+  if (from._internal_high_message_number() != 0) {
+    _this->_internal_set_high_message_number(from._internal_high_message_number());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void ViewStart::CopyFrom(const ViewStart& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:dsnet.tombft.proto.ViewStart)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool ViewStart::IsInitialized() const {
+  return true;
+}
+
+void ViewStart::InternalSwap(ViewStart* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(ViewStart, _impl_.high_message_number_)
+      + sizeof(ViewStart::_impl_.high_message_number_)
+      - PROTOBUF_FIELD_OFFSET(ViewStart, _impl_.view_number_)>(
+          reinterpret_cast<char*>(&_impl_.view_number_),
+          reinterpret_cast<char*>(&other->_impl_.view_number_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata ViewStart::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_replication_2ftombft_2fmessage_2eproto_getter, &descriptor_table_replication_2ftombft_2fmessage_2eproto_once,
+      file_level_metadata_replication_2ftombft_2fmessage_2eproto[4]);
+}
+
+// ===================================================================
+
+class EpochStart::_Internal {
+ public:
+};
+
+EpochStart::EpochStart(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:dsnet.tombft.proto.EpochStart)
+}
+EpochStart::EpochStart(const EpochStart& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  EpochStart* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.session_number_){}
+    , decltype(_impl_.high_message_number_){}
+    , decltype(_impl_.replica_index_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.session_number_, &from._impl_.session_number_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.replica_index_) -
+    reinterpret_cast<char*>(&_impl_.session_number_)) + sizeof(_impl_.replica_index_));
+  // @@protoc_insertion_point(copy_constructor:dsnet.tombft.proto.EpochStart)
+}
+
+inline void EpochStart::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.session_number_){0u}
+    , decltype(_impl_.high_message_number_){0u}
+    , decltype(_impl_.replica_index_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+EpochStart::~EpochStart() {
+  // @@protoc_insertion_point(destructor:dsnet.tombft.proto.EpochStart)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void EpochStart::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void EpochStart::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void EpochStart::Clear() {
+// @@protoc_insertion_point(message_clear_start:dsnet.tombft.proto.EpochStart)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  ::memset(&_impl_.session_number_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.replica_index_) -
+      reinterpret_cast<char*>(&_impl_.session_number_)) + sizeof(_impl_.replica_index_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* EpochStart::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // uint32 session_number = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.session_number_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint32 high_message_number = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.high_message_number_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int32 replica_index = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.replica_index_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* EpochStart::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:dsnet.tombft.proto.EpochStart)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // uint32 session_number = 1;
+  if (this->_internal_session_number() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(1, this->_internal_session_number(), target);
+  }
+
+  // uint32 high_message_number = 2;
+  if (this->_internal_high_message_number() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(2, this->_internal_high_message_number(), target);
+  }
+
+  // int32 replica_index = 3;
+  if (this->_internal_replica_index() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(3, this->_internal_replica_index(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:dsnet.tombft.proto.EpochStart)
+  return target;
+}
+
+size_t EpochStart::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:dsnet.tombft.proto.EpochStart)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // uint32 session_number = 1;
+  if (this->_internal_session_number() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_session_number());
+  }
+
+  // uint32 high_message_number = 2;
+  if (this->_internal_high_message_number() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_high_message_number());
+  }
+
+  // int32 replica_index = 3;
+  if (this->_internal_replica_index() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_replica_index());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData EpochStart::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    EpochStart::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*EpochStart::GetClassData() const { return &_class_data_; }
+
+
+void EpochStart::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<EpochStart*>(&to_msg);
+  auto& from = static_cast<const EpochStart&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:dsnet.tombft.proto.EpochStart)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_session_number() != 0) {
+    _this->_internal_set_session_number(from._internal_session_number());
+  }
+  if (from._internal_high_message_number() != 0) {
+    _this->_internal_set_high_message_number(from._internal_high_message_number());
+  }
+  if (from._internal_replica_index() != 0) {
+    _this->_internal_set_replica_index(from._internal_replica_index());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void EpochStart::CopyFrom(const EpochStart& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:dsnet.tombft.proto.EpochStart)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool EpochStart::IsInitialized() const {
+  return true;
+}
+
+void EpochStart::InternalSwap(EpochStart* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(EpochStart, _impl_.replica_index_)
+      + sizeof(EpochStart::_impl_.replica_index_)
+      - PROTOBUF_FIELD_OFFSET(EpochStart, _impl_.session_number_)>(
+          reinterpret_cast<char*>(&_impl_.session_number_),
+          reinterpret_cast<char*>(&other->_impl_.session_number_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata EpochStart::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_replication_2ftombft_2fmessage_2eproto_getter, &descriptor_table_replication_2ftombft_2fmessage_2eproto_once,
+      file_level_metadata_replication_2ftombft_2fmessage_2eproto[5]);
+}
+
+// @@protoc_insertion_point(namespace_scope)
+}  // namespace proto
+}  // namespace tombft
+}  // namespace dsnet
+PROTOBUF_NAMESPACE_OPEN
+template<> PROTOBUF_NOINLINE ::dsnet::tombft::proto::Message*
+Arena::CreateMaybeMessage< ::dsnet::tombft::proto::Message >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::dsnet::tombft::proto::Message >(arena);
+}
+template<> PROTOBUF_NOINLINE ::dsnet::tombft::proto::ReplyMessage*
+Arena::CreateMaybeMessage< ::dsnet::tombft::proto::ReplyMessage >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::dsnet::tombft::proto::ReplyMessage >(arena);
+}
+template<> PROTOBUF_NOINLINE ::dsnet::tombft::proto::QueryMessage*
+Arena::CreateMaybeMessage< ::dsnet::tombft::proto::QueryMessage >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::dsnet::tombft::proto::QueryMessage >(arena);
+}
+template<> PROTOBUF_NOINLINE ::dsnet::tombft::proto::ViewChange*
+Arena::CreateMaybeMessage< ::dsnet::tombft::proto::ViewChange >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::dsnet::tombft::proto::ViewChange >(arena);
+}
+template<> PROTOBUF_NOINLINE ::dsnet::tombft::proto::ViewStart*
+Arena::CreateMaybeMessage< ::dsnet::tombft::proto::ViewStart >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::dsnet::tombft::proto::ViewStart >(arena);
+}
+template<> PROTOBUF_NOINLINE ::dsnet::tombft::proto::EpochStart*
+Arena::CreateMaybeMessage< ::dsnet::tombft::proto::EpochStart >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::dsnet::tombft::proto::EpochStart >(arena);
+}
+PROTOBUF_NAMESPACE_CLOSE
+
+// @@protoc_insertion_point(global_scope)
+#include <google/protobuf/port_undef.inc>
@@ -0,0 +1,2021 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: replication/tombft/message.proto
+
+#ifndef GOOGLE_PROTOBUF_INCLUDED_replication_2ftombft_2fmessage_2eproto
+#define GOOGLE_PROTOBUF_INCLUDED_replication_2ftombft_2fmessage_2eproto
+
+#include <limits>
+#include <string>
+
+#include <google/protobuf/port_def.inc>
+#if PROTOBUF_VERSION < 3021000
+#error This file was generated by a newer version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please update
+#error your headers.
+#endif
+#if 3021012 < PROTOBUF_MIN_PROTOC_VERSION
+#error This file was generated by an older version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please
+#error regenerate this file with a newer version of protoc.
+#endif
+
+#include <google/protobuf/port_undef.inc>
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/arena.h>
+#include <google/protobuf/arenastring.h>
+#include <google/protobuf/generated_message_util.h>
+#include <google/protobuf/metadata_lite.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/message.h>
+#include <google/protobuf/repeated_field.h>  // IWYU pragma: export
+#include <google/protobuf/extension_set.h>  // IWYU pragma: export
+#include <google/protobuf/unknown_field_set.h>
+#include "common/request.pb.h"
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+#define PROTOBUF_INTERNAL_EXPORT_replication_2ftombft_2fmessage_2eproto
+PROTOBUF_NAMESPACE_OPEN
+namespace internal {
+class AnyMetadata;
+}  // namespace internal
+PROTOBUF_NAMESPACE_CLOSE
+
+// Internal implementation detail -- do not use these members.
+struct TableStruct_replication_2ftombft_2fmessage_2eproto {
+  static const uint32_t offsets[];
+};
+extern const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_replication_2ftombft_2fmessage_2eproto;
+namespace dsnet {
+namespace tombft {
+namespace proto {
+class EpochStart;
+struct EpochStartDefaultTypeInternal;
+extern EpochStartDefaultTypeInternal _EpochStart_default_instance_;
+class Message;
+struct MessageDefaultTypeInternal;
+extern MessageDefaultTypeInternal _Message_default_instance_;
+class QueryMessage;
+struct QueryMessageDefaultTypeInternal;
+extern QueryMessageDefaultTypeInternal _QueryMessage_default_instance_;
+class ReplyMessage;
+struct ReplyMessageDefaultTypeInternal;
+extern ReplyMessageDefaultTypeInternal _ReplyMessage_default_instance_;
+class ViewChange;
+struct ViewChangeDefaultTypeInternal;
+extern ViewChangeDefaultTypeInternal _ViewChange_default_instance_;
+class ViewStart;
+struct ViewStartDefaultTypeInternal;
+extern ViewStartDefaultTypeInternal _ViewStart_default_instance_;
+}  // namespace proto
+}  // namespace tombft
+}  // namespace dsnet
+PROTOBUF_NAMESPACE_OPEN
+template<> ::dsnet::tombft::proto::EpochStart* Arena::CreateMaybeMessage<::dsnet::tombft::proto::EpochStart>(Arena*);
+template<> ::dsnet::tombft::proto::Message* Arena::CreateMaybeMessage<::dsnet::tombft::proto::Message>(Arena*);
+template<> ::dsnet::tombft::proto::QueryMessage* Arena::CreateMaybeMessage<::dsnet::tombft::proto::QueryMessage>(Arena*);
+template<> ::dsnet::tombft::proto::ReplyMessage* Arena::CreateMaybeMessage<::dsnet::tombft::proto::ReplyMessage>(Arena*);
+template<> ::dsnet::tombft::proto::ViewChange* Arena::CreateMaybeMessage<::dsnet::tombft::proto::ViewChange>(Arena*);
+template<> ::dsnet::tombft::proto::ViewStart* Arena::CreateMaybeMessage<::dsnet::tombft::proto::ViewStart>(Arena*);
+PROTOBUF_NAMESPACE_CLOSE
+namespace dsnet {
+namespace tombft {
+namespace proto {
+
+// ===================================================================
+
+class Message final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:dsnet.tombft.proto.Message) */ {
+ public:
+  inline Message() : Message(nullptr) {}
+  ~Message() override;
+  explicit PROTOBUF_CONSTEXPR Message(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  Message(const Message& from);
+  Message(Message&& from) noexcept
+    : Message() {
+    *this = ::std::move(from);
+  }
+
+  inline Message& operator=(const Message& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline Message& operator=(Message&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const Message& default_instance() {
+    return *internal_default_instance();
+  }
+  enum GetCase {
+    kRequest = 1,
+    kReply = 2,
+    kViewChange = 3,
+    kViewStart = 4,
+    kEpochStart = 5,
+    kQuery = 6,
+    GET_NOT_SET = 0,
+  };
+
+  static inline const Message* internal_default_instance() {
+    return reinterpret_cast<const Message*>(
+               &_Message_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    0;
+
+  friend void swap(Message& a, Message& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(Message* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Message* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  Message* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<Message>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const Message& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const Message& from) {
+    Message::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(Message* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "dsnet.tombft.proto.Message";
+  }
+  protected:
+  explicit Message(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kRequestFieldNumber = 1,
+    kReplyFieldNumber = 2,
+    kViewChangeFieldNumber = 3,
+    kViewStartFieldNumber = 4,
+    kEpochStartFieldNumber = 5,
+    kQueryFieldNumber = 6,
+  };
+  // .dsnet.Request request = 1;
+  bool has_request() const;
+  private:
+  bool _internal_has_request() const;
+  public:
+  void clear_request();
+  const ::dsnet::Request& request() const;
+  PROTOBUF_NODISCARD ::dsnet::Request* release_request();
+  ::dsnet::Request* mutable_request();
+  void set_allocated_request(::dsnet::Request* request);
+  private:
+  const ::dsnet::Request& _internal_request() const;
+  ::dsnet::Request* _internal_mutable_request();
+  public:
+  void unsafe_arena_set_allocated_request(
+      ::dsnet::Request* request);
+  ::dsnet::Request* unsafe_arena_release_request();
+
+  // .dsnet.tombft.proto.ReplyMessage reply = 2;
+  bool has_reply() const;
+  private:
+  bool _internal_has_reply() const;
+  public:
+  void clear_reply();
+  const ::dsnet::tombft::proto::ReplyMessage& reply() const;
+  PROTOBUF_NODISCARD ::dsnet::tombft::proto::ReplyMessage* release_reply();
+  ::dsnet::tombft::proto::ReplyMessage* mutable_reply();
+  void set_allocated_reply(::dsnet::tombft::proto::ReplyMessage* reply);
+  private:
+  const ::dsnet::tombft::proto::ReplyMessage& _internal_reply() const;
+  ::dsnet::tombft::proto::ReplyMessage* _internal_mutable_reply();
+  public:
+  void unsafe_arena_set_allocated_reply(
+      ::dsnet::tombft::proto::ReplyMessage* reply);
+  ::dsnet::tombft::proto::ReplyMessage* unsafe_arena_release_reply();
+
+  // .dsnet.tombft.proto.ViewChange view_change = 3;
+  bool has_view_change() const;
+  private:
+  bool _internal_has_view_change() const;
+  public:
+  void clear_view_change();
+  const ::dsnet::tombft::proto::ViewChange& view_change() const;
+  PROTOBUF_NODISCARD ::dsnet::tombft::proto::ViewChange* release_view_change();
+  ::dsnet::tombft::proto::ViewChange* mutable_view_change();
+  void set_allocated_view_change(::dsnet::tombft::proto::ViewChange* view_change);
+  private:
+  const ::dsnet::tombft::proto::ViewChange& _internal_view_change() const;
+  ::dsnet::tombft::proto::ViewChange* _internal_mutable_view_change();
+  public:
+  void unsafe_arena_set_allocated_view_change(
+      ::dsnet::tombft::proto::ViewChange* view_change);
+  ::dsnet::tombft::proto::ViewChange* unsafe_arena_release_view_change();
+
+  // .dsnet.tombft.proto.ViewStart view_start = 4;
+  bool has_view_start() const;
+  private:
+  bool _internal_has_view_start() const;
+  public:
+  void clear_view_start();
+  const ::dsnet::tombft::proto::ViewStart& view_start() const;
+  PROTOBUF_NODISCARD ::dsnet::tombft::proto::ViewStart* release_view_start();
+  ::dsnet::tombft::proto::ViewStart* mutable_view_start();
+  void set_allocated_view_start(::dsnet::tombft::proto::ViewStart* view_start);
+  private:
+  const ::dsnet::tombft::proto::ViewStart& _internal_view_start() const;
+  ::dsnet::tombft::proto::ViewStart* _internal_mutable_view_start();
+  public:
+  void unsafe_arena_set_allocated_view_start(
+      ::dsnet::tombft::proto::ViewStart* view_start);
+  ::dsnet::tombft::proto::ViewStart* unsafe_arena_release_view_start();
+
+  // .dsnet.tombft.proto.EpochStart epoch_start = 5;
+  bool has_epoch_start() const;
+  private:
+  bool _internal_has_epoch_start() const;
+  public:
+  void clear_epoch_start();
+  const ::dsnet::tombft::proto::EpochStart& epoch_start() const;
+  PROTOBUF_NODISCARD ::dsnet::tombft::proto::EpochStart* release_epoch_start();
+  ::dsnet::tombft::proto::EpochStart* mutable_epoch_start();
+  void set_allocated_epoch_start(::dsnet::tombft::proto::EpochStart* epoch_start);
+  private:
+  const ::dsnet::tombft::proto::EpochStart& _internal_epoch_start() const;
+  ::dsnet::tombft::proto::EpochStart* _internal_mutable_epoch_start();
+  public:
+  void unsafe_arena_set_allocated_epoch_start(
+      ::dsnet::tombft::proto::EpochStart* epoch_start);
+  ::dsnet::tombft::proto::EpochStart* unsafe_arena_release_epoch_start();
+
+  // .dsnet.tombft.proto.QueryMessage query = 6;
+  bool has_query() const;
+  private:
+  bool _internal_has_query() const;
+  public:
+  void clear_query();
+  const ::dsnet::tombft::proto::QueryMessage& query() const;
+  PROTOBUF_NODISCARD ::dsnet::tombft::proto::QueryMessage* release_query();
+  ::dsnet::tombft::proto::QueryMessage* mutable_query();
+  void set_allocated_query(::dsnet::tombft::proto::QueryMessage* query);
+  private:
+  const ::dsnet::tombft::proto::QueryMessage& _internal_query() const;
+  ::dsnet::tombft::proto::QueryMessage* _internal_mutable_query();
+  public:
+  void unsafe_arena_set_allocated_query(
+      ::dsnet::tombft::proto::QueryMessage* query);
+  ::dsnet::tombft::proto::QueryMessage* unsafe_arena_release_query();
+
+  void clear_get();
+  GetCase get_case() const;
+  // @@protoc_insertion_point(class_scope:dsnet.tombft.proto.Message)
+ private:
+  class _Internal;
+  void set_has_request();
+  void set_has_reply();
+  void set_has_view_change();
+  void set_has_view_start();
+  void set_has_epoch_start();
+  void set_has_query();
+
+  inline bool has_get() const;
+  inline void clear_has_get();
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    union GetUnion {
+      constexpr GetUnion() : _constinit_{} {}
+        ::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized _constinit_;
+      ::dsnet::Request* request_;
+      ::dsnet::tombft::proto::ReplyMessage* reply_;
+      ::dsnet::tombft::proto::ViewChange* view_change_;
+      ::dsnet::tombft::proto::ViewStart* view_start_;
+      ::dsnet::tombft::proto::EpochStart* epoch_start_;
+      ::dsnet::tombft::proto::QueryMessage* query_;
+    } get_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    uint32_t _oneof_case_[1];
+
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_replication_2ftombft_2fmessage_2eproto;
+};
+// -------------------------------------------------------------------
+
+class ReplyMessage final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:dsnet.tombft.proto.ReplyMessage) */ {
+ public:
+  inline ReplyMessage() : ReplyMessage(nullptr) {}
+  ~ReplyMessage() override;
+  explicit PROTOBUF_CONSTEXPR ReplyMessage(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  ReplyMessage(const ReplyMessage& from);
+  ReplyMessage(ReplyMessage&& from) noexcept
+    : ReplyMessage() {
+    *this = ::std::move(from);
+  }
+
+  inline ReplyMessage& operator=(const ReplyMessage& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline ReplyMessage& operator=(ReplyMessage&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ReplyMessage& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const ReplyMessage* internal_default_instance() {
+    return reinterpret_cast<const ReplyMessage*>(
+               &_ReplyMessage_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    1;
+
+  friend void swap(ReplyMessage& a, ReplyMessage& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(ReplyMessage* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ReplyMessage* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  ReplyMessage* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ReplyMessage>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const ReplyMessage& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ReplyMessage& from) {
+    ReplyMessage::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(ReplyMessage* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "dsnet.tombft.proto.ReplyMessage";
+  }
+  protected:
+  explicit ReplyMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kResultFieldNumber = 2,
+    kClientRequestFieldNumber = 1,
+    kReplicaIndexFieldNumber = 3,
+  };
+  // bytes result = 2;
+  void clear_result();
+  const std::string& result() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_result(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_result();
+  PROTOBUF_NODISCARD std::string* release_result();
+  void set_allocated_result(std::string* result);
+  private:
+  const std::string& _internal_result() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_result(const std::string& value);
+  std::string* _internal_mutable_result();
+  public:
+
+  // uint32 client_request = 1;
+  void clear_client_request();
+  uint32_t client_request() const;
+  void set_client_request(uint32_t value);
+  private:
+  uint32_t _internal_client_request() const;
+  void _internal_set_client_request(uint32_t value);
+  public:
+
+  // int32 replica_index = 3;
+  void clear_replica_index();
+  int32_t replica_index() const;
+  void set_replica_index(int32_t value);
+  private:
+  int32_t _internal_replica_index() const;
+  void _internal_set_replica_index(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:dsnet.tombft.proto.ReplyMessage)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr result_;
+    uint32_t client_request_;
+    int32_t replica_index_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_replication_2ftombft_2fmessage_2eproto;
+};
+// -------------------------------------------------------------------
+
+class QueryMessage final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:dsnet.tombft.proto.QueryMessage) */ {
+ public:
+  inline QueryMessage() : QueryMessage(nullptr) {}
+  ~QueryMessage() override;
+  explicit PROTOBUF_CONSTEXPR QueryMessage(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  QueryMessage(const QueryMessage& from);
+  QueryMessage(QueryMessage&& from) noexcept
+    : QueryMessage() {
+    *this = ::std::move(from);
+  }
+
+  inline QueryMessage& operator=(const QueryMessage& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline QueryMessage& operator=(QueryMessage&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const QueryMessage& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const QueryMessage* internal_default_instance() {
+    return reinterpret_cast<const QueryMessage*>(
+               &_QueryMessage_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    2;
+
+  friend void swap(QueryMessage& a, QueryMessage& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(QueryMessage* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(QueryMessage* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  QueryMessage* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<QueryMessage>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const QueryMessage& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const QueryMessage& from) {
+    QueryMessage::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(QueryMessage* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "dsnet.tombft.proto.QueryMessage";
+  }
+  protected:
+  explicit QueryMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kReplicaIndexFieldNumber = 1,
+    kMessageNumberFieldNumber = 2,
+  };
+  // int32 replica_index = 1;
+  void clear_replica_index();
+  int32_t replica_index() const;
+  void set_replica_index(int32_t value);
+  private:
+  int32_t _internal_replica_index() const;
+  void _internal_set_replica_index(int32_t value);
+  public:
+
+  // uint32 message_number = 2;
+  void clear_message_number();
+  uint32_t message_number() const;
+  void set_message_number(uint32_t value);
+  private:
+  uint32_t _internal_message_number() const;
+  void _internal_set_message_number(uint32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:dsnet.tombft.proto.QueryMessage)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    int32_t replica_index_;
+    uint32_t message_number_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_replication_2ftombft_2fmessage_2eproto;
+};
+// -------------------------------------------------------------------
+
+class ViewChange final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:dsnet.tombft.proto.ViewChange) */ {
+ public:
+  inline ViewChange() : ViewChange(nullptr) {}
+  ~ViewChange() override;
+  explicit PROTOBUF_CONSTEXPR ViewChange(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  ViewChange(const ViewChange& from);
+  ViewChange(ViewChange&& from) noexcept
+    : ViewChange() {
+    *this = ::std::move(from);
+  }
+
+  inline ViewChange& operator=(const ViewChange& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline ViewChange& operator=(ViewChange&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ViewChange& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const ViewChange* internal_default_instance() {
+    return reinterpret_cast<const ViewChange*>(
+               &_ViewChange_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    3;
+
+  friend void swap(ViewChange& a, ViewChange& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(ViewChange* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ViewChange* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  ViewChange* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ViewChange>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const ViewChange& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ViewChange& from) {
+    ViewChange::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(ViewChange* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "dsnet.tombft.proto.ViewChange";
+  }
+  protected:
+  explicit ViewChange(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kViewNumberFieldNumber = 1,
+    kNextViewNumberFieldNumber = 2,
+    kHighMessageNumberFieldNumber = 3,
+    kReplicaIndexFieldNumber = 4,
+  };
+  // uint32 view_number = 1;
+  void clear_view_number();
+  uint32_t view_number() const;
+  void set_view_number(uint32_t value);
+  private:
+  uint32_t _internal_view_number() const;
+  void _internal_set_view_number(uint32_t value);
+  public:
+
+  // uint32 next_view_number = 2;
+  void clear_next_view_number();
+  uint32_t next_view_number() const;
+  void set_next_view_number(uint32_t value);
+  private:
+  uint32_t _internal_next_view_number() const;
+  void _internal_set_next_view_number(uint32_t value);
+  public:
+
+  // uint32 high_message_number = 3;
+  void clear_high_message_number();
+  uint32_t high_message_number() const;
+  void set_high_message_number(uint32_t value);
+  private:
+  uint32_t _internal_high_message_number() const;
+  void _internal_set_high_message_number(uint32_t value);
+  public:
+
+  // int32 replica_index = 4;
+  void clear_replica_index();
+  int32_t replica_index() const;
+  void set_replica_index(int32_t value);
+  private:
+  int32_t _internal_replica_index() const;
+  void _internal_set_replica_index(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:dsnet.tombft.proto.ViewChange)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    uint32_t view_number_;
+    uint32_t next_view_number_;
+    uint32_t high_message_number_;
+    int32_t replica_index_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_replication_2ftombft_2fmessage_2eproto;
+};
+// -------------------------------------------------------------------
+
+class ViewStart final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:dsnet.tombft.proto.ViewStart) */ {
+ public:
+  inline ViewStart() : ViewStart(nullptr) {}
+  ~ViewStart() override;
+  explicit PROTOBUF_CONSTEXPR ViewStart(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  ViewStart(const ViewStart& from);
+  ViewStart(ViewStart&& from) noexcept
+    : ViewStart() {
+    *this = ::std::move(from);
+  }
+
+  inline ViewStart& operator=(const ViewStart& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline ViewStart& operator=(ViewStart&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ViewStart& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const ViewStart* internal_default_instance() {
+    return reinterpret_cast<const ViewStart*>(
+               &_ViewStart_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    4;
+
+  friend void swap(ViewStart& a, ViewStart& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(ViewStart* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ViewStart* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  ViewStart* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ViewStart>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const ViewStart& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ViewStart& from) {
+    ViewStart::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(ViewStart* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "dsnet.tombft.proto.ViewStart";
+  }
+  protected:
+  explicit ViewStart(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kViewNumberFieldNumber = 1,
+    kHighMessageNumberFieldNumber = 2,
+  };
+  // uint32 view_number = 1;
+  void clear_view_number();
+  uint32_t view_number() const;
+  void set_view_number(uint32_t value);
+  private:
+  uint32_t _internal_view_number() const;
+  void _internal_set_view_number(uint32_t value);
+  public:
+
+  // uint32 high_message_number = 2;
+  void clear_high_message_number();
+  uint32_t high_message_number() const;
+  void set_high_message_number(uint32_t value);
+  private:
+  uint32_t _internal_high_message_number() const;
+  void _internal_set_high_message_number(uint32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:dsnet.tombft.proto.ViewStart)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    uint32_t view_number_;
+    uint32_t high_message_number_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_replication_2ftombft_2fmessage_2eproto;
+};
+// -------------------------------------------------------------------
+
+class EpochStart final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:dsnet.tombft.proto.EpochStart) */ {
+ public:
+  inline EpochStart() : EpochStart(nullptr) {}
+  ~EpochStart() override;
+  explicit PROTOBUF_CONSTEXPR EpochStart(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  EpochStart(const EpochStart& from);
+  EpochStart(EpochStart&& from) noexcept
+    : EpochStart() {
+    *this = ::std::move(from);
+  }
+
+  inline EpochStart& operator=(const EpochStart& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline EpochStart& operator=(EpochStart&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const EpochStart& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const EpochStart* internal_default_instance() {
+    return reinterpret_cast<const EpochStart*>(
+               &_EpochStart_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    5;
+
+  friend void swap(EpochStart& a, EpochStart& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(EpochStart* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(EpochStart* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  EpochStart* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<EpochStart>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const EpochStart& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const EpochStart& from) {
+    EpochStart::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(EpochStart* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "dsnet.tombft.proto.EpochStart";
+  }
+  protected:
+  explicit EpochStart(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kSessionNumberFieldNumber = 1,
+    kHighMessageNumberFieldNumber = 2,
+    kReplicaIndexFieldNumber = 3,
+  };
+  // uint32 session_number = 1;
+  void clear_session_number();
+  uint32_t session_number() const;
+  void set_session_number(uint32_t value);
+  private:
+  uint32_t _internal_session_number() const;
+  void _internal_set_session_number(uint32_t value);
+  public:
+
+  // uint32 high_message_number = 2;
+  void clear_high_message_number();
+  uint32_t high_message_number() const;
+  void set_high_message_number(uint32_t value);
+  private:
+  uint32_t _internal_high_message_number() const;
+  void _internal_set_high_message_number(uint32_t value);
+  public:
+
+  // int32 replica_index = 3;
+  void clear_replica_index();
+  int32_t replica_index() const;
+  void set_replica_index(int32_t value);
+  private:
+  int32_t _internal_replica_index() const;
+  void _internal_set_replica_index(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:dsnet.tombft.proto.EpochStart)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    uint32_t session_number_;
+    uint32_t high_message_number_;
+    int32_t replica_index_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_replication_2ftombft_2fmessage_2eproto;
+};
+// ===================================================================
+
+
+// ===================================================================
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
+#endif  // __GNUC__
+// Message
+
+// .dsnet.Request request = 1;
+inline bool Message::_internal_has_request() const {
+  return get_case() == kRequest;
+}
+inline bool Message::has_request() const {
+  return _internal_has_request();
+}
+inline void Message::set_has_request() {
+  _impl_._oneof_case_[0] = kRequest;
+}
+inline ::dsnet::Request* Message::release_request() {
+  // @@protoc_insertion_point(field_release:dsnet.tombft.proto.Message.request)
+  if (_internal_has_request()) {
+    clear_has_get();
+    ::dsnet::Request* temp = _impl_.get_.request_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.get_.request_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::dsnet::Request& Message::_internal_request() const {
+  return _internal_has_request()
+      ? *_impl_.get_.request_
+      : reinterpret_cast< ::dsnet::Request&>(::dsnet::_Request_default_instance_);
+}
+inline const ::dsnet::Request& Message::request() const {
+  // @@protoc_insertion_point(field_get:dsnet.tombft.proto.Message.request)
+  return _internal_request();
+}
+inline ::dsnet::Request* Message::unsafe_arena_release_request() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:dsnet.tombft.proto.Message.request)
+  if (_internal_has_request()) {
+    clear_has_get();
+    ::dsnet::Request* temp = _impl_.get_.request_;
+    _impl_.get_.request_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void Message::unsafe_arena_set_allocated_request(::dsnet::Request* request) {
+  clear_get();
+  if (request) {
+    set_has_request();
+    _impl_.get_.request_ = request;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:dsnet.tombft.proto.Message.request)
+}
+inline ::dsnet::Request* Message::_internal_mutable_request() {
+  if (!_internal_has_request()) {
+    clear_get();
+    set_has_request();
+    _impl_.get_.request_ = CreateMaybeMessage< ::dsnet::Request >(GetArenaForAllocation());
+  }
+  return _impl_.get_.request_;
+}
+inline ::dsnet::Request* Message::mutable_request() {
+  ::dsnet::Request* _msg = _internal_mutable_request();
+  // @@protoc_insertion_point(field_mutable:dsnet.tombft.proto.Message.request)
+  return _msg;
+}
+
+// .dsnet.tombft.proto.ReplyMessage reply = 2;
+inline bool Message::_internal_has_reply() const {
+  return get_case() == kReply;
+}
+inline bool Message::has_reply() const {
+  return _internal_has_reply();
+}
+inline void Message::set_has_reply() {
+  _impl_._oneof_case_[0] = kReply;
+}
+inline void Message::clear_reply() {
+  if (_internal_has_reply()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.get_.reply_;
+    }
+    clear_has_get();
+  }
+}
+inline ::dsnet::tombft::proto::ReplyMessage* Message::release_reply() {
+  // @@protoc_insertion_point(field_release:dsnet.tombft.proto.Message.reply)
+  if (_internal_has_reply()) {
+    clear_has_get();
+    ::dsnet::tombft::proto::ReplyMessage* temp = _impl_.get_.reply_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.get_.reply_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::dsnet::tombft::proto::ReplyMessage& Message::_internal_reply() const {
+  return _internal_has_reply()
+      ? *_impl_.get_.reply_
+      : reinterpret_cast< ::dsnet::tombft::proto::ReplyMessage&>(::dsnet::tombft::proto::_ReplyMessage_default_instance_);
+}
+inline const ::dsnet::tombft::proto::ReplyMessage& Message::reply() const {
+  // @@protoc_insertion_point(field_get:dsnet.tombft.proto.Message.reply)
+  return _internal_reply();
+}
+inline ::dsnet::tombft::proto::ReplyMessage* Message::unsafe_arena_release_reply() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:dsnet.tombft.proto.Message.reply)
+  if (_internal_has_reply()) {
+    clear_has_get();
+    ::dsnet::tombft::proto::ReplyMessage* temp = _impl_.get_.reply_;
+    _impl_.get_.reply_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void Message::unsafe_arena_set_allocated_reply(::dsnet::tombft::proto::ReplyMessage* reply) {
+  clear_get();
+  if (reply) {
+    set_has_reply();
+    _impl_.get_.reply_ = reply;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:dsnet.tombft.proto.Message.reply)
+}
+inline ::dsnet::tombft::proto::ReplyMessage* Message::_internal_mutable_reply() {
+  if (!_internal_has_reply()) {
+    clear_get();
+    set_has_reply();
+    _impl_.get_.reply_ = CreateMaybeMessage< ::dsnet::tombft::proto::ReplyMessage >(GetArenaForAllocation());
+  }
+  return _impl_.get_.reply_;
+}
+inline ::dsnet::tombft::proto::ReplyMessage* Message::mutable_reply() {
+  ::dsnet::tombft::proto::ReplyMessage* _msg = _internal_mutable_reply();
+  // @@protoc_insertion_point(field_mutable:dsnet.tombft.proto.Message.reply)
+  return _msg;
+}
+
+// .dsnet.tombft.proto.ViewChange view_change = 3;
+inline bool Message::_internal_has_view_change() const {
+  return get_case() == kViewChange;
+}
+inline bool Message::has_view_change() const {
+  return _internal_has_view_change();
+}
+inline void Message::set_has_view_change() {
+  _impl_._oneof_case_[0] = kViewChange;
+}
+inline void Message::clear_view_change() {
+  if (_internal_has_view_change()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.get_.view_change_;
+    }
+    clear_has_get();
+  }
+}
+inline ::dsnet::tombft::proto::ViewChange* Message::release_view_change() {
+  // @@protoc_insertion_point(field_release:dsnet.tombft.proto.Message.view_change)
+  if (_internal_has_view_change()) {
+    clear_has_get();
+    ::dsnet::tombft::proto::ViewChange* temp = _impl_.get_.view_change_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.get_.view_change_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::dsnet::tombft::proto::ViewChange& Message::_internal_view_change() const {
+  return _internal_has_view_change()
+      ? *_impl_.get_.view_change_
+      : reinterpret_cast< ::dsnet::tombft::proto::ViewChange&>(::dsnet::tombft::proto::_ViewChange_default_instance_);
+}
+inline const ::dsnet::tombft::proto::ViewChange& Message::view_change() const {
+  // @@protoc_insertion_point(field_get:dsnet.tombft.proto.Message.view_change)
+  return _internal_view_change();
+}
+inline ::dsnet::tombft::proto::ViewChange* Message::unsafe_arena_release_view_change() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:dsnet.tombft.proto.Message.view_change)
+  if (_internal_has_view_change()) {
+    clear_has_get();
+    ::dsnet::tombft::proto::ViewChange* temp = _impl_.get_.view_change_;
+    _impl_.get_.view_change_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void Message::unsafe_arena_set_allocated_view_change(::dsnet::tombft::proto::ViewChange* view_change) {
+  clear_get();
+  if (view_change) {
+    set_has_view_change();
+    _impl_.get_.view_change_ = view_change;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:dsnet.tombft.proto.Message.view_change)
+}
+inline ::dsnet::tombft::proto::ViewChange* Message::_internal_mutable_view_change() {
+  if (!_internal_has_view_change()) {
+    clear_get();
+    set_has_view_change();
+    _impl_.get_.view_change_ = CreateMaybeMessage< ::dsnet::tombft::proto::ViewChange >(GetArenaForAllocation());
+  }
+  return _impl_.get_.view_change_;
+}
+inline ::dsnet::tombft::proto::ViewChange* Message::mutable_view_change() {
+  ::dsnet::tombft::proto::ViewChange* _msg = _internal_mutable_view_change();
+  // @@protoc_insertion_point(field_mutable:dsnet.tombft.proto.Message.view_change)
+  return _msg;
+}
+
+// .dsnet.tombft.proto.ViewStart view_start = 4;
+inline bool Message::_internal_has_view_start() const {
+  return get_case() == kViewStart;
+}
+inline bool Message::has_view_start() const {
+  return _internal_has_view_start();
+}
+inline void Message::set_has_view_start() {
+  _impl_._oneof_case_[0] = kViewStart;
+}
+inline void Message::clear_view_start() {
+  if (_internal_has_view_start()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.get_.view_start_;
+    }
+    clear_has_get();
+  }
+}
+inline ::dsnet::tombft::proto::ViewStart* Message::release_view_start() {
+  // @@protoc_insertion_point(field_release:dsnet.tombft.proto.Message.view_start)
+  if (_internal_has_view_start()) {
+    clear_has_get();
+    ::dsnet::tombft::proto::ViewStart* temp = _impl_.get_.view_start_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.get_.view_start_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::dsnet::tombft::proto::ViewStart& Message::_internal_view_start() const {
+  return _internal_has_view_start()
+      ? *_impl_.get_.view_start_
+      : reinterpret_cast< ::dsnet::tombft::proto::ViewStart&>(::dsnet::tombft::proto::_ViewStart_default_instance_);
+}
+inline const ::dsnet::tombft::proto::ViewStart& Message::view_start() const {
+  // @@protoc_insertion_point(field_get:dsnet.tombft.proto.Message.view_start)
+  return _internal_view_start();
+}
+inline ::dsnet::tombft::proto::ViewStart* Message::unsafe_arena_release_view_start() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:dsnet.tombft.proto.Message.view_start)
+  if (_internal_has_view_start()) {
+    clear_has_get();
+    ::dsnet::tombft::proto::ViewStart* temp = _impl_.get_.view_start_;
+    _impl_.get_.view_start_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void Message::unsafe_arena_set_allocated_view_start(::dsnet::tombft::proto::ViewStart* view_start) {
+  clear_get();
+  if (view_start) {
+    set_has_view_start();
+    _impl_.get_.view_start_ = view_start;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:dsnet.tombft.proto.Message.view_start)
+}
+inline ::dsnet::tombft::proto::ViewStart* Message::_internal_mutable_view_start() {
+  if (!_internal_has_view_start()) {
+    clear_get();
+    set_has_view_start();
+    _impl_.get_.view_start_ = CreateMaybeMessage< ::dsnet::tombft::proto::ViewStart >(GetArenaForAllocation());
+  }
+  return _impl_.get_.view_start_;
+}
+inline ::dsnet::tombft::proto::ViewStart* Message::mutable_view_start() {
+  ::dsnet::tombft::proto::ViewStart* _msg = _internal_mutable_view_start();
+  // @@protoc_insertion_point(field_mutable:dsnet.tombft.proto.Message.view_start)
+  return _msg;
+}
+
+// .dsnet.tombft.proto.EpochStart epoch_start = 5;
+inline bool Message::_internal_has_epoch_start() const {
+  return get_case() == kEpochStart;
+}
+inline bool Message::has_epoch_start() const {
+  return _internal_has_epoch_start();
+}
+inline void Message::set_has_epoch_start() {
+  _impl_._oneof_case_[0] = kEpochStart;
+}
+inline void Message::clear_epoch_start() {
+  if (_internal_has_epoch_start()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.get_.epoch_start_;
+    }
+    clear_has_get();
+  }
+}
+inline ::dsnet::tombft::proto::EpochStart* Message::release_epoch_start() {
+  // @@protoc_insertion_point(field_release:dsnet.tombft.proto.Message.epoch_start)
+  if (_internal_has_epoch_start()) {
+    clear_has_get();
+    ::dsnet::tombft::proto::EpochStart* temp = _impl_.get_.epoch_start_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.get_.epoch_start_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::dsnet::tombft::proto::EpochStart& Message::_internal_epoch_start() const {
+  return _internal_has_epoch_start()
+      ? *_impl_.get_.epoch_start_
+      : reinterpret_cast< ::dsnet::tombft::proto::EpochStart&>(::dsnet::tombft::proto::_EpochStart_default_instance_);
+}
+inline const ::dsnet::tombft::proto::EpochStart& Message::epoch_start() const {
+  // @@protoc_insertion_point(field_get:dsnet.tombft.proto.Message.epoch_start)
+  return _internal_epoch_start();
+}
+inline ::dsnet::tombft::proto::EpochStart* Message::unsafe_arena_release_epoch_start() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:dsnet.tombft.proto.Message.epoch_start)
+  if (_internal_has_epoch_start()) {
+    clear_has_get();
+    ::dsnet::tombft::proto::EpochStart* temp = _impl_.get_.epoch_start_;
+    _impl_.get_.epoch_start_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void Message::unsafe_arena_set_allocated_epoch_start(::dsnet::tombft::proto::EpochStart* epoch_start) {
+  clear_get();
+  if (epoch_start) {
+    set_has_epoch_start();
+    _impl_.get_.epoch_start_ = epoch_start;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:dsnet.tombft.proto.Message.epoch_start)
+}
+inline ::dsnet::tombft::proto::EpochStart* Message::_internal_mutable_epoch_start() {
+  if (!_internal_has_epoch_start()) {
+    clear_get();
+    set_has_epoch_start();
+    _impl_.get_.epoch_start_ = CreateMaybeMessage< ::dsnet::tombft::proto::EpochStart >(GetArenaForAllocation());
+  }
+  return _impl_.get_.epoch_start_;
+}
+inline ::dsnet::tombft::proto::EpochStart* Message::mutable_epoch_start() {
+  ::dsnet::tombft::proto::EpochStart* _msg = _internal_mutable_epoch_start();
+  // @@protoc_insertion_point(field_mutable:dsnet.tombft.proto.Message.epoch_start)
+  return _msg;
+}
+
+// .dsnet.tombft.proto.QueryMessage query = 6;
+inline bool Message::_internal_has_query() const {
+  return get_case() == kQuery;
+}
+inline bool Message::has_query() const {
+  return _internal_has_query();
+}
+inline void Message::set_has_query() {
+  _impl_._oneof_case_[0] = kQuery;
+}
+inline void Message::clear_query() {
+  if (_internal_has_query()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.get_.query_;
+    }
+    clear_has_get();
+  }
+}
+inline ::dsnet::tombft::proto::QueryMessage* Message::release_query() {
+  // @@protoc_insertion_point(field_release:dsnet.tombft.proto.Message.query)
+  if (_internal_has_query()) {
+    clear_has_get();
+    ::dsnet::tombft::proto::QueryMessage* temp = _impl_.get_.query_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.get_.query_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::dsnet::tombft::proto::QueryMessage& Message::_internal_query() const {
+  return _internal_has_query()
+      ? *_impl_.get_.query_
+      : reinterpret_cast< ::dsnet::tombft::proto::QueryMessage&>(::dsnet::tombft::proto::_QueryMessage_default_instance_);
+}
+inline const ::dsnet::tombft::proto::QueryMessage& Message::query() const {
+  // @@protoc_insertion_point(field_get:dsnet.tombft.proto.Message.query)
+  return _internal_query();
+}
+inline ::dsnet::tombft::proto::QueryMessage* Message::unsafe_arena_release_query() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:dsnet.tombft.proto.Message.query)
+  if (_internal_has_query()) {
+    clear_has_get();
+    ::dsnet::tombft::proto::QueryMessage* temp = _impl_.get_.query_;
+    _impl_.get_.query_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void Message::unsafe_arena_set_allocated_query(::dsnet::tombft::proto::QueryMessage* query) {
+  clear_get();
+  if (query) {
+    set_has_query();
+    _impl_.get_.query_ = query;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:dsnet.tombft.proto.Message.query)
+}
+inline ::dsnet::tombft::proto::QueryMessage* Message::_internal_mutable_query() {
+  if (!_internal_has_query()) {
+    clear_get();
+    set_has_query();
+    _impl_.get_.query_ = CreateMaybeMessage< ::dsnet::tombft::proto::QueryMessage >(GetArenaForAllocation());
+  }
+  return _impl_.get_.query_;
+}
+inline ::dsnet::tombft::proto::QueryMessage* Message::mutable_query() {
+  ::dsnet::tombft::proto::QueryMessage* _msg = _internal_mutable_query();
+  // @@protoc_insertion_point(field_mutable:dsnet.tombft.proto.Message.query)
+  return _msg;
+}
+
+inline bool Message::has_get() const {
+  return get_case() != GET_NOT_SET;
+}
+inline void Message::clear_has_get() {
+  _impl_._oneof_case_[0] = GET_NOT_SET;
+}
+inline Message::GetCase Message::get_case() const {
+  return Message::GetCase(_impl_._oneof_case_[0]);
+}
+// -------------------------------------------------------------------
+
+// ReplyMessage
+
+// uint32 client_request = 1;
+inline void ReplyMessage::clear_client_request() {
+  _impl_.client_request_ = 0u;
+}
+inline uint32_t ReplyMessage::_internal_client_request() const {
+  return _impl_.client_request_;
+}
+inline uint32_t ReplyMessage::client_request() const {
+  // @@protoc_insertion_point(field_get:dsnet.tombft.proto.ReplyMessage.client_request)
+  return _internal_client_request();
+}
+inline void ReplyMessage::_internal_set_client_request(uint32_t value) {
+  
+  _impl_.client_request_ = value;
+}
+inline void ReplyMessage::set_client_request(uint32_t value) {
+  _internal_set_client_request(value);
+  // @@protoc_insertion_point(field_set:dsnet.tombft.proto.ReplyMessage.client_request)
+}
+
+// bytes result = 2;
+inline void ReplyMessage::clear_result() {
+  _impl_.result_.ClearToEmpty();
+}
+inline const std::string& ReplyMessage::result() const {
+  // @@protoc_insertion_point(field_get:dsnet.tombft.proto.ReplyMessage.result)
+  return _internal_result();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void ReplyMessage::set_result(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.result_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:dsnet.tombft.proto.ReplyMessage.result)
+}
+inline std::string* ReplyMessage::mutable_result() {
+  std::string* _s = _internal_mutable_result();
+  // @@protoc_insertion_point(field_mutable:dsnet.tombft.proto.ReplyMessage.result)
+  return _s;
+}
+inline const std::string& ReplyMessage::_internal_result() const {
+  return _impl_.result_.Get();
+}
+inline void ReplyMessage::_internal_set_result(const std::string& value) {
+  
+  _impl_.result_.Set(value, GetArenaForAllocation());
+}
+inline std::string* ReplyMessage::_internal_mutable_result() {
+  
+  return _impl_.result_.Mutable(GetArenaForAllocation());
+}
+inline std::string* ReplyMessage::release_result() {
+  // @@protoc_insertion_point(field_release:dsnet.tombft.proto.ReplyMessage.result)
+  return _impl_.result_.Release();
+}
+inline void ReplyMessage::set_allocated_result(std::string* result) {
+  if (result != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.result_.SetAllocated(result, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.result_.IsDefault()) {
+    _impl_.result_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:dsnet.tombft.proto.ReplyMessage.result)
+}
+
+// int32 replica_index = 3;
+inline void ReplyMessage::clear_replica_index() {
+  _impl_.replica_index_ = 0;
+}
+inline int32_t ReplyMessage::_internal_replica_index() const {
+  return _impl_.replica_index_;
+}
+inline int32_t ReplyMessage::replica_index() const {
+  // @@protoc_insertion_point(field_get:dsnet.tombft.proto.ReplyMessage.replica_index)
+  return _internal_replica_index();
+}
+inline void ReplyMessage::_internal_set_replica_index(int32_t value) {
+  
+  _impl_.replica_index_ = value;
+}
+inline void ReplyMessage::set_replica_index(int32_t value) {
+  _internal_set_replica_index(value);
+  // @@protoc_insertion_point(field_set:dsnet.tombft.proto.ReplyMessage.replica_index)
+}
+
+// -------------------------------------------------------------------
+
+// QueryMessage
+
+// int32 replica_index = 1;
+inline void QueryMessage::clear_replica_index() {
+  _impl_.replica_index_ = 0;
+}
+inline int32_t QueryMessage::_internal_replica_index() const {
+  return _impl_.replica_index_;
+}
+inline int32_t QueryMessage::replica_index() const {
+  // @@protoc_insertion_point(field_get:dsnet.tombft.proto.QueryMessage.replica_index)
+  return _internal_replica_index();
+}
+inline void QueryMessage::_internal_set_replica_index(int32_t value) {
+  
+  _impl_.replica_index_ = value;
+}
+inline void QueryMessage::set_replica_index(int32_t value) {
+  _internal_set_replica_index(value);
+  // @@protoc_insertion_point(field_set:dsnet.tombft.proto.QueryMessage.replica_index)
+}
+
+// uint32 message_number = 2;
+inline void QueryMessage::clear_message_number() {
+  _impl_.message_number_ = 0u;
+}
+inline uint32_t QueryMessage::_internal_message_number() const {
+  return _impl_.message_number_;
+}
+inline uint32_t QueryMessage::message_number() const {
+  // @@protoc_insertion_point(field_get:dsnet.tombft.proto.QueryMessage.message_number)
+  return _internal_message_number();
+}
+inline void QueryMessage::_internal_set_message_number(uint32_t value) {
+  
+  _impl_.message_number_ = value;
+}
+inline void QueryMessage::set_message_number(uint32_t value) {
+  _internal_set_message_number(value);
+  // @@protoc_insertion_point(field_set:dsnet.tombft.proto.QueryMessage.message_number)
+}
+
+// -------------------------------------------------------------------
+
+// ViewChange
+
+// uint32 view_number = 1;
+inline void ViewChange::clear_view_number() {
+  _impl_.view_number_ = 0u;
+}
+inline uint32_t ViewChange::_internal_view_number() const {
+  return _impl_.view_number_;
+}
+inline uint32_t ViewChange::view_number() const {
+  // @@protoc_insertion_point(field_get:dsnet.tombft.proto.ViewChange.view_number)
+  return _internal_view_number();
+}
+inline void ViewChange::_internal_set_view_number(uint32_t value) {
+  
+  _impl_.view_number_ = value;
+}
+inline void ViewChange::set_view_number(uint32_t value) {
+  _internal_set_view_number(value);
+  // @@protoc_insertion_point(field_set:dsnet.tombft.proto.ViewChange.view_number)
+}
+
+// uint32 next_view_number = 2;
+inline void ViewChange::clear_next_view_number() {
+  _impl_.next_view_number_ = 0u;
+}
+inline uint32_t ViewChange::_internal_next_view_number() const {
+  return _impl_.next_view_number_;
+}
+inline uint32_t ViewChange::next_view_number() const {
+  // @@protoc_insertion_point(field_get:dsnet.tombft.proto.ViewChange.next_view_number)
+  return _internal_next_view_number();
+}
+inline void ViewChange::_internal_set_next_view_number(uint32_t value) {
+  
+  _impl_.next_view_number_ = value;
+}
+inline void ViewChange::set_next_view_number(uint32_t value) {
+  _internal_set_next_view_number(value);
+  // @@protoc_insertion_point(field_set:dsnet.tombft.proto.ViewChange.next_view_number)
+}
+
+// uint32 high_message_number = 3;
+inline void ViewChange::clear_high_message_number() {
+  _impl_.high_message_number_ = 0u;
+}
+inline uint32_t ViewChange::_internal_high_message_number() const {
+  return _impl_.high_message_number_;
+}
+inline uint32_t ViewChange::high_message_number() const {
+  // @@protoc_insertion_point(field_get:dsnet.tombft.proto.ViewChange.high_message_number)
+  return _internal_high_message_number();
+}
+inline void ViewChange::_internal_set_high_message_number(uint32_t value) {
+  
+  _impl_.high_message_number_ = value;
+}
+inline void ViewChange::set_high_message_number(uint32_t value) {
+  _internal_set_high_message_number(value);
+  // @@protoc_insertion_point(field_set:dsnet.tombft.proto.ViewChange.high_message_number)
+}
+
+// int32 replica_index = 4;
+inline void ViewChange::clear_replica_index() {
+  _impl_.replica_index_ = 0;
+}
+inline int32_t ViewChange::_internal_replica_index() const {
+  return _impl_.replica_index_;
+}
+inline int32_t ViewChange::replica_index() const {
+  // @@protoc_insertion_point(field_get:dsnet.tombft.proto.ViewChange.replica_index)
+  return _internal_replica_index();
+}
+inline void ViewChange::_internal_set_replica_index(int32_t value) {
+  
+  _impl_.replica_index_ = value;
+}
+inline void ViewChange::set_replica_index(int32_t value) {
+  _internal_set_replica_index(value);
+  // @@protoc_insertion_point(field_set:dsnet.tombft.proto.ViewChange.replica_index)
+}
+
+// -------------------------------------------------------------------
+
+// ViewStart
+
+// uint32 view_number = 1;
+inline void ViewStart::clear_view_number() {
+  _impl_.view_number_ = 0u;
+}
+inline uint32_t ViewStart::_internal_view_number() const {
+  return _impl_.view_number_;
+}
+inline uint32_t ViewStart::view_number() const {
+  // @@protoc_insertion_point(field_get:dsnet.tombft.proto.ViewStart.view_number)
+  return _internal_view_number();
+}
+inline void ViewStart::_internal_set_view_number(uint32_t value) {
+  
+  _impl_.view_number_ = value;
+}
+inline void ViewStart::set_view_number(uint32_t value) {
+  _internal_set_view_number(value);
+  // @@protoc_insertion_point(field_set:dsnet.tombft.proto.ViewStart.view_number)
+}
+
+// uint32 high_message_number = 2;
+inline void ViewStart::clear_high_message_number() {
+  _impl_.high_message_number_ = 0u;
+}
+inline uint32_t ViewStart::_internal_high_message_number() const {
+  return _impl_.high_message_number_;
+}
+inline uint32_t ViewStart::high_message_number() const {
+  // @@protoc_insertion_point(field_get:dsnet.tombft.proto.ViewStart.high_message_number)
+  return _internal_high_message_number();
+}
+inline void ViewStart::_internal_set_high_message_number(uint32_t value) {
+  
+  _impl_.high_message_number_ = value;
+}
+inline void ViewStart::set_high_message_number(uint32_t value) {
+  _internal_set_high_message_number(value);
+  // @@protoc_insertion_point(field_set:dsnet.tombft.proto.ViewStart.high_message_number)
+}
+
+// -------------------------------------------------------------------
+
+// EpochStart
+
+// uint32 session_number = 1;
+inline void EpochStart::clear_session_number() {
+  _impl_.session_number_ = 0u;
+}
+inline uint32_t EpochStart::_internal_session_number() const {
+  return _impl_.session_number_;
+}
+inline uint32_t EpochStart::session_number() const {
+  // @@protoc_insertion_point(field_get:dsnet.tombft.proto.EpochStart.session_number)
+  return _internal_session_number();
+}
+inline void EpochStart::_internal_set_session_number(uint32_t value) {
+  
+  _impl_.session_number_ = value;
+}
+inline void EpochStart::set_session_number(uint32_t value) {
+  _internal_set_session_number(value);
+  // @@protoc_insertion_point(field_set:dsnet.tombft.proto.EpochStart.session_number)
+}
+
+// uint32 high_message_number = 2;
+inline void EpochStart::clear_high_message_number() {
+  _impl_.high_message_number_ = 0u;
+}
+inline uint32_t EpochStart::_internal_high_message_number() const {
+  return _impl_.high_message_number_;
+}
+inline uint32_t EpochStart::high_message_number() const {
+  // @@protoc_insertion_point(field_get:dsnet.tombft.proto.EpochStart.high_message_number)
+  return _internal_high_message_number();
+}
+inline void EpochStart::_internal_set_high_message_number(uint32_t value) {
+  
+  _impl_.high_message_number_ = value;
+}
+inline void EpochStart::set_high_message_number(uint32_t value) {
+  _internal_set_high_message_number(value);
+  // @@protoc_insertion_point(field_set:dsnet.tombft.proto.EpochStart.high_message_number)
+}
+
+// int32 replica_index = 3;
+inline void EpochStart::clear_replica_index() {
+  _impl_.replica_index_ = 0;
+}
+inline int32_t EpochStart::_internal_replica_index() const {
+  return _impl_.replica_index_;
+}
+inline int32_t EpochStart::replica_index() const {
+  // @@protoc_insertion_point(field_get:dsnet.tombft.proto.EpochStart.replica_index)
+  return _internal_replica_index();
+}
+inline void EpochStart::_internal_set_replica_index(int32_t value) {
+  
+  _impl_.replica_index_ = value;
+}
+inline void EpochStart::set_replica_index(int32_t value) {
+  _internal_set_replica_index(value);
+  // @@protoc_insertion_point(field_set:dsnet.tombft.proto.EpochStart.replica_index)
+}
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic pop
+#endif  // __GNUC__
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+
+// @@protoc_insertion_point(namespace_scope)
+
+}  // namespace proto
+}  // namespace tombft
+}  // namespace dsnet
+
+// @@protoc_insertion_point(global_scope)
+
+#include <google/protobuf/port_undef.inc>
+#endif  // GOOGLE_PROTOBUF_INCLUDED_GOOGLE_PROTOBUF_INCLUDED_replication_2ftombft_2fmessage_2eproto
@@ -0,0 +1,5975 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: replication/vr/vr-proto.proto
+
+#include "replication/vr/vr-proto.pb.h"
+
+#include <algorithm>
+
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/extension_set.h>
+#include <google/protobuf/wire_format_lite.h>
+#include <google/protobuf/descriptor.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/reflection_ops.h>
+#include <google/protobuf/wire_format.h>
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+
+PROTOBUF_PRAGMA_INIT_SEG
+
+namespace _pb = ::PROTOBUF_NAMESPACE_ID;
+namespace _pbi = _pb::internal;
+
+namespace dsnet {
+namespace vr {
+namespace proto {
+PROTOBUF_CONSTEXPR ReplyMessage::ReplyMessage(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.reply_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.view_)*/uint64_t{0u}
+  , /*decltype(_impl_.opnum_)*/uint64_t{0u}
+  , /*decltype(_impl_.clientreqid_)*/uint64_t{0u}} {}
+struct ReplyMessageDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ReplyMessageDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ReplyMessageDefaultTypeInternal() {}
+  union {
+    ReplyMessage _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ReplyMessageDefaultTypeInternal _ReplyMessage_default_instance_;
+PROTOBUF_CONSTEXPR UnloggedReplyMessage::UnloggedReplyMessage(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.reply_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}} {}
+struct UnloggedReplyMessageDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR UnloggedReplyMessageDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~UnloggedReplyMessageDefaultTypeInternal() {}
+  union {
+    UnloggedReplyMessage _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 UnloggedReplyMessageDefaultTypeInternal _UnloggedReplyMessage_default_instance_;
+PROTOBUF_CONSTEXPR ToClientMessage::ToClientMessage(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.msg_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_._oneof_case_)*/{}} {}
+struct ToClientMessageDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ToClientMessageDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ToClientMessageDefaultTypeInternal() {}
+  union {
+    ToClientMessage _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ToClientMessageDefaultTypeInternal _ToClientMessage_default_instance_;
+PROTOBUF_CONSTEXPR RequestMessage::RequestMessage(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.req_)*/nullptr} {}
+struct RequestMessageDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR RequestMessageDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~RequestMessageDefaultTypeInternal() {}
+  union {
+    RequestMessage _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 RequestMessageDefaultTypeInternal _RequestMessage_default_instance_;
+PROTOBUF_CONSTEXPR UnloggedRequestMessage::UnloggedRequestMessage(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.req_)*/nullptr} {}
+struct UnloggedRequestMessageDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR UnloggedRequestMessageDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~UnloggedRequestMessageDefaultTypeInternal() {}
+  union {
+    UnloggedRequestMessage _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 UnloggedRequestMessageDefaultTypeInternal _UnloggedRequestMessage_default_instance_;
+PROTOBUF_CONSTEXPR PrepareMessage::PrepareMessage(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.request_)*/{}
+  , /*decltype(_impl_.view_)*/uint64_t{0u}
+  , /*decltype(_impl_.opnum_)*/uint64_t{0u}
+  , /*decltype(_impl_.batchstart_)*/uint64_t{0u}} {}
+struct PrepareMessageDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR PrepareMessageDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~PrepareMessageDefaultTypeInternal() {}
+  union {
+    PrepareMessage _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 PrepareMessageDefaultTypeInternal _PrepareMessage_default_instance_;
+PROTOBUF_CONSTEXPR PrepareOKMessage::PrepareOKMessage(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.view_)*/uint64_t{0u}
+  , /*decltype(_impl_.opnum_)*/uint64_t{0u}
+  , /*decltype(_impl_.replicaidx_)*/0u} {}
+struct PrepareOKMessageDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR PrepareOKMessageDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~PrepareOKMessageDefaultTypeInternal() {}
+  union {
+    PrepareOKMessage _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 PrepareOKMessageDefaultTypeInternal _PrepareOKMessage_default_instance_;
+PROTOBUF_CONSTEXPR CommitMessage::CommitMessage(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.view_)*/uint64_t{0u}
+  , /*decltype(_impl_.opnum_)*/uint64_t{0u}} {}
+struct CommitMessageDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR CommitMessageDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~CommitMessageDefaultTypeInternal() {}
+  union {
+    CommitMessage _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 CommitMessageDefaultTypeInternal _CommitMessage_default_instance_;
+PROTOBUF_CONSTEXPR RequestStateTransferMessage::RequestStateTransferMessage(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.view_)*/uint64_t{0u}
+  , /*decltype(_impl_.opnum_)*/uint64_t{0u}} {}
+struct RequestStateTransferMessageDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR RequestStateTransferMessageDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~RequestStateTransferMessageDefaultTypeInternal() {}
+  union {
+    RequestStateTransferMessage _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 RequestStateTransferMessageDefaultTypeInternal _RequestStateTransferMessage_default_instance_;
+PROTOBUF_CONSTEXPR StateTransferMessage::StateTransferMessage(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.entries_)*/{}
+  , /*decltype(_impl_.view_)*/uint64_t{0u}
+  , /*decltype(_impl_.opnum_)*/uint64_t{0u}} {}
+struct StateTransferMessageDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR StateTransferMessageDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~StateTransferMessageDefaultTypeInternal() {}
+  union {
+    StateTransferMessage _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 StateTransferMessageDefaultTypeInternal _StateTransferMessage_default_instance_;
+PROTOBUF_CONSTEXPR StartViewChangeMessage::StartViewChangeMessage(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.view_)*/uint64_t{0u}
+  , /*decltype(_impl_.lastcommitted_)*/uint64_t{0u}
+  , /*decltype(_impl_.replicaidx_)*/0u} {}
+struct StartViewChangeMessageDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR StartViewChangeMessageDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~StartViewChangeMessageDefaultTypeInternal() {}
+  union {
+    StartViewChangeMessage _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 StartViewChangeMessageDefaultTypeInternal _StartViewChangeMessage_default_instance_;
+PROTOBUF_CONSTEXPR DoViewChangeMessage::DoViewChangeMessage(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.entries_)*/{}
+  , /*decltype(_impl_.view_)*/uint64_t{0u}
+  , /*decltype(_impl_.lastnormalview_)*/uint64_t{0u}
+  , /*decltype(_impl_.lastop_)*/uint64_t{0u}
+  , /*decltype(_impl_.lastcommitted_)*/uint64_t{0u}
+  , /*decltype(_impl_.replicaidx_)*/0u} {}
+struct DoViewChangeMessageDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR DoViewChangeMessageDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~DoViewChangeMessageDefaultTypeInternal() {}
+  union {
+    DoViewChangeMessage _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 DoViewChangeMessageDefaultTypeInternal _DoViewChangeMessage_default_instance_;
+PROTOBUF_CONSTEXPR StartViewMessage::StartViewMessage(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.entries_)*/{}
+  , /*decltype(_impl_.view_)*/uint64_t{0u}
+  , /*decltype(_impl_.lastop_)*/uint64_t{0u}
+  , /*decltype(_impl_.lastcommitted_)*/uint64_t{0u}} {}
+struct StartViewMessageDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR StartViewMessageDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~StartViewMessageDefaultTypeInternal() {}
+  union {
+    StartViewMessage _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 StartViewMessageDefaultTypeInternal _StartViewMessage_default_instance_;
+PROTOBUF_CONSTEXPR RecoveryMessage::RecoveryMessage(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.nonce_)*/uint64_t{0u}
+  , /*decltype(_impl_.replicaidx_)*/0u} {}
+struct RecoveryMessageDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR RecoveryMessageDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~RecoveryMessageDefaultTypeInternal() {}
+  union {
+    RecoveryMessage _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 RecoveryMessageDefaultTypeInternal _RecoveryMessage_default_instance_;
+PROTOBUF_CONSTEXPR RecoveryResponseMessage::RecoveryResponseMessage(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.entries_)*/{}
+  , /*decltype(_impl_.view_)*/uint64_t{0u}
+  , /*decltype(_impl_.nonce_)*/uint64_t{0u}
+  , /*decltype(_impl_.lastop_)*/uint64_t{0u}
+  , /*decltype(_impl_.lastcommitted_)*/uint64_t{0u}
+  , /*decltype(_impl_.replicaidx_)*/0u} {}
+struct RecoveryResponseMessageDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR RecoveryResponseMessageDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~RecoveryResponseMessageDefaultTypeInternal() {}
+  union {
+    RecoveryResponseMessage _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 RecoveryResponseMessageDefaultTypeInternal _RecoveryResponseMessage_default_instance_;
+PROTOBUF_CONSTEXPR ToReplicaMessage::ToReplicaMessage(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.msg_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_._oneof_case_)*/{}} {}
+struct ToReplicaMessageDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ToReplicaMessageDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ToReplicaMessageDefaultTypeInternal() {}
+  union {
+    ToReplicaMessage _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ToReplicaMessageDefaultTypeInternal _ToReplicaMessage_default_instance_;
+}  // namespace proto
+}  // namespace vr
+}  // namespace dsnet
+static ::_pb::Metadata file_level_metadata_replication_2fvr_2fvr_2dproto_2eproto[16];
+static constexpr ::_pb::EnumDescriptor const** file_level_enum_descriptors_replication_2fvr_2fvr_2dproto_2eproto = nullptr;
+static constexpr ::_pb::ServiceDescriptor const** file_level_service_descriptors_replication_2fvr_2fvr_2dproto_2eproto = nullptr;
+
+const uint32_t TableStruct_replication_2fvr_2fvr_2dproto_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  PROTOBUF_FIELD_OFFSET(::dsnet::vr::proto::ReplyMessage, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::vr::proto::ReplyMessage, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::dsnet::vr::proto::ReplyMessage, _impl_.view_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::vr::proto::ReplyMessage, _impl_.opnum_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::vr::proto::ReplyMessage, _impl_.reply_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::vr::proto::ReplyMessage, _impl_.clientreqid_),
+  1,
+  2,
+  0,
+  3,
+  PROTOBUF_FIELD_OFFSET(::dsnet::vr::proto::UnloggedReplyMessage, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::vr::proto::UnloggedReplyMessage, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::dsnet::vr::proto::UnloggedReplyMessage, _impl_.reply_),
+  0,
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::dsnet::vr::proto::ToClientMessage, _internal_metadata_),
+  ~0u,  // no _extensions_
+  PROTOBUF_FIELD_OFFSET(::dsnet::vr::proto::ToClientMessage, _impl_._oneof_case_[0]),
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  PROTOBUF_FIELD_OFFSET(::dsnet::vr::proto::ToClientMessage, _impl_.msg_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::vr::proto::RequestMessage, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::vr::proto::RequestMessage, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::dsnet::vr::proto::RequestMessage, _impl_.req_),
+  0,
+  PROTOBUF_FIELD_OFFSET(::dsnet::vr::proto::UnloggedRequestMessage, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::vr::proto::UnloggedRequestMessage, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::dsnet::vr::proto::UnloggedRequestMessage, _impl_.req_),
+  0,
+  PROTOBUF_FIELD_OFFSET(::dsnet::vr::proto::PrepareMessage, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::vr::proto::PrepareMessage, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::dsnet::vr::proto::PrepareMessage, _impl_.view_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::vr::proto::PrepareMessage, _impl_.opnum_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::vr::proto::PrepareMessage, _impl_.batchstart_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::vr::proto::PrepareMessage, _impl_.request_),
+  0,
+  1,
+  2,
+  ~0u,
+  PROTOBUF_FIELD_OFFSET(::dsnet::vr::proto::PrepareOKMessage, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::vr::proto::PrepareOKMessage, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::dsnet::vr::proto::PrepareOKMessage, _impl_.view_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::vr::proto::PrepareOKMessage, _impl_.opnum_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::vr::proto::PrepareOKMessage, _impl_.replicaidx_),
+  0,
+  1,
+  2,
+  PROTOBUF_FIELD_OFFSET(::dsnet::vr::proto::CommitMessage, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::vr::proto::CommitMessage, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::dsnet::vr::proto::CommitMessage, _impl_.view_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::vr::proto::CommitMessage, _impl_.opnum_),
+  0,
+  1,
+  PROTOBUF_FIELD_OFFSET(::dsnet::vr::proto::RequestStateTransferMessage, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::vr::proto::RequestStateTransferMessage, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::dsnet::vr::proto::RequestStateTransferMessage, _impl_.view_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::vr::proto::RequestStateTransferMessage, _impl_.opnum_),
+  0,
+  1,
+  PROTOBUF_FIELD_OFFSET(::dsnet::vr::proto::StateTransferMessage, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::vr::proto::StateTransferMessage, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::dsnet::vr::proto::StateTransferMessage, _impl_.view_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::vr::proto::StateTransferMessage, _impl_.opnum_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::vr::proto::StateTransferMessage, _impl_.entries_),
+  0,
+  1,
+  ~0u,
+  PROTOBUF_FIELD_OFFSET(::dsnet::vr::proto::StartViewChangeMessage, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::vr::proto::StartViewChangeMessage, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::dsnet::vr::proto::StartViewChangeMessage, _impl_.view_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::vr::proto::StartViewChangeMessage, _impl_.replicaidx_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::vr::proto::StartViewChangeMessage, _impl_.lastcommitted_),
+  0,
+  2,
+  1,
+  PROTOBUF_FIELD_OFFSET(::dsnet::vr::proto::DoViewChangeMessage, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::vr::proto::DoViewChangeMessage, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::dsnet::vr::proto::DoViewChangeMessage, _impl_.view_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::vr::proto::DoViewChangeMessage, _impl_.lastnormalview_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::vr::proto::DoViewChangeMessage, _impl_.lastop_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::vr::proto::DoViewChangeMessage, _impl_.lastcommitted_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::vr::proto::DoViewChangeMessage, _impl_.entries_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::vr::proto::DoViewChangeMessage, _impl_.replicaidx_),
+  0,
+  1,
+  2,
+  3,
+  ~0u,
+  4,
+  PROTOBUF_FIELD_OFFSET(::dsnet::vr::proto::StartViewMessage, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::vr::proto::StartViewMessage, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::dsnet::vr::proto::StartViewMessage, _impl_.view_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::vr::proto::StartViewMessage, _impl_.lastop_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::vr::proto::StartViewMessage, _impl_.lastcommitted_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::vr::proto::StartViewMessage, _impl_.entries_),
+  0,
+  1,
+  2,
+  ~0u,
+  PROTOBUF_FIELD_OFFSET(::dsnet::vr::proto::RecoveryMessage, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::vr::proto::RecoveryMessage, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::dsnet::vr::proto::RecoveryMessage, _impl_.replicaidx_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::vr::proto::RecoveryMessage, _impl_.nonce_),
+  1,
+  0,
+  PROTOBUF_FIELD_OFFSET(::dsnet::vr::proto::RecoveryResponseMessage, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::vr::proto::RecoveryResponseMessage, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::dsnet::vr::proto::RecoveryResponseMessage, _impl_.view_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::vr::proto::RecoveryResponseMessage, _impl_.nonce_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::vr::proto::RecoveryResponseMessage, _impl_.entries_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::vr::proto::RecoveryResponseMessage, _impl_.lastop_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::vr::proto::RecoveryResponseMessage, _impl_.lastcommitted_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::vr::proto::RecoveryResponseMessage, _impl_.replicaidx_),
+  0,
+  1,
+  ~0u,
+  2,
+  3,
+  4,
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::dsnet::vr::proto::ToReplicaMessage, _internal_metadata_),
+  ~0u,  // no _extensions_
+  PROTOBUF_FIELD_OFFSET(::dsnet::vr::proto::ToReplicaMessage, _impl_._oneof_case_[0]),
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  PROTOBUF_FIELD_OFFSET(::dsnet::vr::proto::ToReplicaMessage, _impl_.msg_),
+};
+static const ::_pbi::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  { 0, 10, -1, sizeof(::dsnet::vr::proto::ReplyMessage)},
+  { 14, 21, -1, sizeof(::dsnet::vr::proto::UnloggedReplyMessage)},
+  { 22, -1, -1, sizeof(::dsnet::vr::proto::ToClientMessage)},
+  { 31, 38, -1, sizeof(::dsnet::vr::proto::RequestMessage)},
+  { 39, 46, -1, sizeof(::dsnet::vr::proto::UnloggedRequestMessage)},
+  { 47, 57, -1, sizeof(::dsnet::vr::proto::PrepareMessage)},
+  { 61, 70, -1, sizeof(::dsnet::vr::proto::PrepareOKMessage)},
+  { 73, 81, -1, sizeof(::dsnet::vr::proto::CommitMessage)},
+  { 83, 91, -1, sizeof(::dsnet::vr::proto::RequestStateTransferMessage)},
+  { 93, 102, -1, sizeof(::dsnet::vr::proto::StateTransferMessage)},
+  { 105, 114, -1, sizeof(::dsnet::vr::proto::StartViewChangeMessage)},
+  { 117, 129, -1, sizeof(::dsnet::vr::proto::DoViewChangeMessage)},
+  { 135, 145, -1, sizeof(::dsnet::vr::proto::StartViewMessage)},
+  { 149, 157, -1, sizeof(::dsnet::vr::proto::RecoveryMessage)},
+  { 159, 171, -1, sizeof(::dsnet::vr::proto::RecoveryResponseMessage)},
+  { 177, -1, -1, sizeof(::dsnet::vr::proto::ToReplicaMessage)},
+};
+
+static const ::_pb::Message* const file_default_instances[] = {
+  &::dsnet::vr::proto::_ReplyMessage_default_instance_._instance,
+  &::dsnet::vr::proto::_UnloggedReplyMessage_default_instance_._instance,
+  &::dsnet::vr::proto::_ToClientMessage_default_instance_._instance,
+  &::dsnet::vr::proto::_RequestMessage_default_instance_._instance,
+  &::dsnet::vr::proto::_UnloggedRequestMessage_default_instance_._instance,
+  &::dsnet::vr::proto::_PrepareMessage_default_instance_._instance,
+  &::dsnet::vr::proto::_PrepareOKMessage_default_instance_._instance,
+  &::dsnet::vr::proto::_CommitMessage_default_instance_._instance,
+  &::dsnet::vr::proto::_RequestStateTransferMessage_default_instance_._instance,
+  &::dsnet::vr::proto::_StateTransferMessage_default_instance_._instance,
+  &::dsnet::vr::proto::_StartViewChangeMessage_default_instance_._instance,
+  &::dsnet::vr::proto::_DoViewChangeMessage_default_instance_._instance,
+  &::dsnet::vr::proto::_StartViewMessage_default_instance_._instance,
+  &::dsnet::vr::proto::_RecoveryMessage_default_instance_._instance,
+  &::dsnet::vr::proto::_RecoveryResponseMessage_default_instance_._instance,
+  &::dsnet::vr::proto::_ToReplicaMessage_default_instance_._instance,
+};
+
+const char descriptor_table_protodef_replication_2fvr_2fvr_2dproto_2eproto[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) =
+  "\n\035replication/vr/vr-proto.proto\022\016dsnet.v"
+  "r.proto\032\024common/request.proto\"O\n\014ReplyMe"
+  "ssage\022\014\n\004view\030\001 \002(\004\022\r\n\005opnum\030\002 \002(\004\022\r\n\005re"
+  "ply\030\003 \002(\014\022\023\n\013clientreqid\030\004 \002(\004\"%\n\024Unlogg"
+  "edReplyMessage\022\r\n\005reply\030\001 \002(\014\"\207\001\n\017ToClie"
+  "ntMessage\022-\n\005reply\030\001 \001(\0132\034.dsnet.vr.prot"
+  "o.ReplyMessageH\000\022>\n\016unlogged_reply\030\002 \001(\013"
+  "2$.dsnet.vr.proto.UnloggedReplyMessageH\000"
+  "B\005\n\003msg\"-\n\016RequestMessage\022\033\n\003req\030\001 \002(\0132\016"
+  ".dsnet.Request\"=\n\026UnloggedRequestMessage"
+  "\022#\n\003req\030\001 \002(\0132\026.dsnet.UnloggedRequest\"b\n"
+  "\016PrepareMessage\022\014\n\004view\030\001 \002(\004\022\r\n\005opnum\030\002"
+  " \002(\004\022\022\n\nbatchstart\030\003 \002(\004\022\037\n\007request\030\004 \003("
+  "\0132\016.dsnet.Request\"C\n\020PrepareOKMessage\022\014\n"
+  "\004view\030\001 \002(\004\022\r\n\005opnum\030\002 \002(\004\022\022\n\nreplicaIdx"
+  "\030\003 \002(\r\",\n\rCommitMessage\022\014\n\004view\030\001 \002(\004\022\r\n"
+  "\005opnum\030\002 \002(\004\":\n\033RequestStateTransferMess"
+  "age\022\014\n\004view\030\001 \002(\004\022\r\n\005opnum\030\002 \002(\004\"X\n\024Stat"
+  "eTransferMessage\022\014\n\004view\030\001 \002(\004\022\r\n\005opnum\030"
+  "\002 \002(\004\022#\n\007entries\030\003 \003(\0132\022.dsnet.MsgLogEnt"
+  "ry\"Q\n\026StartViewChangeMessage\022\014\n\004view\030\001 \002"
+  "(\004\022\022\n\nreplicaIdx\030\002 \002(\r\022\025\n\rlastCommitted\030"
+  "\003 \002(\004\"\233\001\n\023DoViewChangeMessage\022\014\n\004view\030\001 "
+  "\002(\004\022\026\n\016lastNormalView\030\002 \002(\004\022\016\n\006lastOp\030\003 "
+  "\002(\004\022\025\n\rlastCommitted\030\004 \002(\004\022#\n\007entries\030\005 "
+  "\003(\0132\022.dsnet.MsgLogEntry\022\022\n\nreplicaIdx\030\006 "
+  "\002(\r\"l\n\020StartViewMessage\022\014\n\004view\030\001 \002(\004\022\016\n"
+  "\006lastOp\030\002 \002(\004\022\025\n\rlastCommitted\030\003 \002(\004\022#\n\007"
+  "entries\030\004 \003(\0132\022.dsnet.MsgLogEntry\"4\n\017Rec"
+  "overyMessage\022\022\n\nreplicaIdx\030\001 \002(\r\022\r\n\005nonc"
+  "e\030\002 \002(\004\"\226\001\n\027RecoveryResponseMessage\022\014\n\004v"
+  "iew\030\001 \002(\004\022\r\n\005nonce\030\002 \002(\004\022#\n\007entries\030\003 \003("
+  "\0132\022.dsnet.MsgLogEntry\022\016\n\006lastOp\030\004 \001(\004\022\025\n"
+  "\rlastCommitted\030\005 \001(\004\022\022\n\nreplicaIdx\030\006 \002(\r"
+  "\"\362\005\n\020ToReplicaMessage\0221\n\007request\030\001 \001(\0132\036"
+  ".dsnet.vr.proto.RequestMessageH\000\022B\n\020unlo"
+  "gged_request\030\002 \001(\0132&.dsnet.vr.proto.Unlo"
+  "ggedRequestMessageH\000\0221\n\007prepare\030\003 \001(\0132\036."
+  "dsnet.vr.proto.PrepareMessageH\000\0226\n\nprepa"
+  "re_ok\030\004 \001(\0132 .dsnet.vr.proto.PrepareOKMe"
+  "ssageH\000\022/\n\006commit\030\005 \001(\0132\035.dsnet.vr.proto"
+  ".CommitMessageH\000\022M\n\026request_state_transf"
+  "er\030\006 \001(\0132+.dsnet.vr.proto.RequestStateTr"
+  "ansferMessageH\000\022>\n\016state_transfer\030\007 \001(\0132"
+  "$.dsnet.vr.proto.StateTransferMessageH\000\022"
+  "C\n\021start_view_change\030\010 \001(\0132&.dsnet.vr.pr"
+  "oto.StartViewChangeMessageH\000\022=\n\016do_view_"
+  "change\030\t \001(\0132#.dsnet.vr.proto.DoViewChan"
+  "geMessageH\000\0226\n\nstart_view\030\n \001(\0132 .dsnet."
+  "vr.proto.StartViewMessageH\000\0223\n\010recovery\030"
+  "\013 \001(\0132\037.dsnet.vr.proto.RecoveryMessageH\000"
+  "\022D\n\021recovery_response\030\014 \001(\0132\'.dsnet.vr.p"
+  "roto.RecoveryResponseMessageH\000B\005\n\003msg"
+  ;
+static const ::_pbi::DescriptorTable* const descriptor_table_replication_2fvr_2fvr_2dproto_2eproto_deps[1] = {
+  &::descriptor_table_common_2frequest_2eproto,
+};
+static ::_pbi::once_flag descriptor_table_replication_2fvr_2fvr_2dproto_2eproto_once;
+const ::_pbi::DescriptorTable descriptor_table_replication_2fvr_2fvr_2dproto_2eproto = {
+    false, false, 2117, descriptor_table_protodef_replication_2fvr_2fvr_2dproto_2eproto,
+    "replication/vr/vr-proto.proto",
+    &descriptor_table_replication_2fvr_2fvr_2dproto_2eproto_once, descriptor_table_replication_2fvr_2fvr_2dproto_2eproto_deps, 1, 16,
+    schemas, file_default_instances, TableStruct_replication_2fvr_2fvr_2dproto_2eproto::offsets,
+    file_level_metadata_replication_2fvr_2fvr_2dproto_2eproto, file_level_enum_descriptors_replication_2fvr_2fvr_2dproto_2eproto,
+    file_level_service_descriptors_replication_2fvr_2fvr_2dproto_2eproto,
+};
+PROTOBUF_ATTRIBUTE_WEAK const ::_pbi::DescriptorTable* descriptor_table_replication_2fvr_2fvr_2dproto_2eproto_getter() {
+  return &descriptor_table_replication_2fvr_2fvr_2dproto_2eproto;
+}
+
+// Force running AddDescriptors() at dynamic initialization time.
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 static ::_pbi::AddDescriptorsRunner dynamic_init_dummy_replication_2fvr_2fvr_2dproto_2eproto(&descriptor_table_replication_2fvr_2fvr_2dproto_2eproto);
+namespace dsnet {
+namespace vr {
+namespace proto {
+
+// ===================================================================
+
+class ReplyMessage::_Internal {
+ public:
+  using HasBits = decltype(std::declval<ReplyMessage>()._impl_._has_bits_);
+  static void set_has_view(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_opnum(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static void set_has_reply(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_clientreqid(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x0000000f) ^ 0x0000000f) != 0;
+  }
+};
+
+ReplyMessage::ReplyMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:dsnet.vr.proto.ReplyMessage)
+}
+ReplyMessage::ReplyMessage(const ReplyMessage& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  ReplyMessage* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.reply_){}
+    , decltype(_impl_.view_){}
+    , decltype(_impl_.opnum_){}
+    , decltype(_impl_.clientreqid_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.reply_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.reply_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_reply()) {
+    _this->_impl_.reply_.Set(from._internal_reply(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.view_, &from._impl_.view_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.clientreqid_) -
+    reinterpret_cast<char*>(&_impl_.view_)) + sizeof(_impl_.clientreqid_));
+  // @@protoc_insertion_point(copy_constructor:dsnet.vr.proto.ReplyMessage)
+}
+
+inline void ReplyMessage::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.reply_){}
+    , decltype(_impl_.view_){uint64_t{0u}}
+    , decltype(_impl_.opnum_){uint64_t{0u}}
+    , decltype(_impl_.clientreqid_){uint64_t{0u}}
+  };
+  _impl_.reply_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.reply_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+ReplyMessage::~ReplyMessage() {
+  // @@protoc_insertion_point(destructor:dsnet.vr.proto.ReplyMessage)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void ReplyMessage::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.reply_.Destroy();
+}
+
+void ReplyMessage::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void ReplyMessage::Clear() {
+// @@protoc_insertion_point(message_clear_start:dsnet.vr.proto.ReplyMessage)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    _impl_.reply_.ClearNonDefaultToEmpty();
+  }
+  if (cached_has_bits & 0x0000000eu) {
+    ::memset(&_impl_.view_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.clientreqid_) -
+        reinterpret_cast<char*>(&_impl_.view_)) + sizeof(_impl_.clientreqid_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* ReplyMessage::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required uint64 view = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_view(&has_bits);
+          _impl_.view_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required uint64 opnum = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _Internal::set_has_opnum(&has_bits);
+          _impl_.opnum_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required bytes reply = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          auto str = _internal_mutable_reply();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required uint64 clientreqid = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _Internal::set_has_clientreqid(&has_bits);
+          _impl_.clientreqid_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* ReplyMessage::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:dsnet.vr.proto.ReplyMessage)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required uint64 view = 1;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(1, this->_internal_view(), target);
+  }
+
+  // required uint64 opnum = 2;
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(2, this->_internal_opnum(), target);
+  }
+
+  // required bytes reply = 3;
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->WriteBytesMaybeAliased(
+        3, this->_internal_reply(), target);
+  }
+
+  // required uint64 clientreqid = 4;
+  if (cached_has_bits & 0x00000008u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(4, this->_internal_clientreqid(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:dsnet.vr.proto.ReplyMessage)
+  return target;
+}
+
+size_t ReplyMessage::RequiredFieldsByteSizeFallback() const {
+// @@protoc_insertion_point(required_fields_byte_size_fallback_start:dsnet.vr.proto.ReplyMessage)
+  size_t total_size = 0;
+
+  if (_internal_has_reply()) {
+    // required bytes reply = 3;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_reply());
+  }
+
+  if (_internal_has_view()) {
+    // required uint64 view = 1;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_view());
+  }
+
+  if (_internal_has_opnum()) {
+    // required uint64 opnum = 2;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_opnum());
+  }
+
+  if (_internal_has_clientreqid()) {
+    // required uint64 clientreqid = 4;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_clientreqid());
+  }
+
+  return total_size;
+}
+size_t ReplyMessage::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:dsnet.vr.proto.ReplyMessage)
+  size_t total_size = 0;
+
+  if (((_impl_._has_bits_[0] & 0x0000000f) ^ 0x0000000f) == 0) {  // All required fields are present.
+    // required bytes reply = 3;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_reply());
+
+    // required uint64 view = 1;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_view());
+
+    // required uint64 opnum = 2;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_opnum());
+
+    // required uint64 clientreqid = 4;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_clientreqid());
+
+  } else {
+    total_size += RequiredFieldsByteSizeFallback();
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ReplyMessage::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    ReplyMessage::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ReplyMessage::GetClassData() const { return &_class_data_; }
+
+
+void ReplyMessage::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<ReplyMessage*>(&to_msg);
+  auto& from = static_cast<const ReplyMessage&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:dsnet.vr.proto.ReplyMessage)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000000fu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_reply(from._internal_reply());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.view_ = from._impl_.view_;
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.opnum_ = from._impl_.opnum_;
+    }
+    if (cached_has_bits & 0x00000008u) {
+      _this->_impl_.clientreqid_ = from._impl_.clientreqid_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void ReplyMessage::CopyFrom(const ReplyMessage& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:dsnet.vr.proto.ReplyMessage)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool ReplyMessage::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  return true;
+}
+
+void ReplyMessage::InternalSwap(ReplyMessage* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.reply_, lhs_arena,
+      &other->_impl_.reply_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(ReplyMessage, _impl_.clientreqid_)
+      + sizeof(ReplyMessage::_impl_.clientreqid_)
+      - PROTOBUF_FIELD_OFFSET(ReplyMessage, _impl_.view_)>(
+          reinterpret_cast<char*>(&_impl_.view_),
+          reinterpret_cast<char*>(&other->_impl_.view_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata ReplyMessage::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_replication_2fvr_2fvr_2dproto_2eproto_getter, &descriptor_table_replication_2fvr_2fvr_2dproto_2eproto_once,
+      file_level_metadata_replication_2fvr_2fvr_2dproto_2eproto[0]);
+}
+
+// ===================================================================
+
+class UnloggedReplyMessage::_Internal {
+ public:
+  using HasBits = decltype(std::declval<UnloggedReplyMessage>()._impl_._has_bits_);
+  static void set_has_reply(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000001) ^ 0x00000001) != 0;
+  }
+};
+
+UnloggedReplyMessage::UnloggedReplyMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:dsnet.vr.proto.UnloggedReplyMessage)
+}
+UnloggedReplyMessage::UnloggedReplyMessage(const UnloggedReplyMessage& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  UnloggedReplyMessage* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.reply_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.reply_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.reply_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_reply()) {
+    _this->_impl_.reply_.Set(from._internal_reply(), 
+      _this->GetArenaForAllocation());
+  }
+  // @@protoc_insertion_point(copy_constructor:dsnet.vr.proto.UnloggedReplyMessage)
+}
+
+inline void UnloggedReplyMessage::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.reply_){}
+  };
+  _impl_.reply_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.reply_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+UnloggedReplyMessage::~UnloggedReplyMessage() {
+  // @@protoc_insertion_point(destructor:dsnet.vr.proto.UnloggedReplyMessage)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void UnloggedReplyMessage::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.reply_.Destroy();
+}
+
+void UnloggedReplyMessage::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void UnloggedReplyMessage::Clear() {
+// @@protoc_insertion_point(message_clear_start:dsnet.vr.proto.UnloggedReplyMessage)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    _impl_.reply_.ClearNonDefaultToEmpty();
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* UnloggedReplyMessage::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required bytes reply = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_reply();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* UnloggedReplyMessage::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:dsnet.vr.proto.UnloggedReplyMessage)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required bytes reply = 1;
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->WriteBytesMaybeAliased(
+        1, this->_internal_reply(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:dsnet.vr.proto.UnloggedReplyMessage)
+  return target;
+}
+
+size_t UnloggedReplyMessage::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:dsnet.vr.proto.UnloggedReplyMessage)
+  size_t total_size = 0;
+
+  // required bytes reply = 1;
+  if (_internal_has_reply()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_reply());
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData UnloggedReplyMessage::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    UnloggedReplyMessage::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*UnloggedReplyMessage::GetClassData() const { return &_class_data_; }
+
+
+void UnloggedReplyMessage::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<UnloggedReplyMessage*>(&to_msg);
+  auto& from = static_cast<const UnloggedReplyMessage&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:dsnet.vr.proto.UnloggedReplyMessage)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_has_reply()) {
+    _this->_internal_set_reply(from._internal_reply());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void UnloggedReplyMessage::CopyFrom(const UnloggedReplyMessage& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:dsnet.vr.proto.UnloggedReplyMessage)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool UnloggedReplyMessage::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  return true;
+}
+
+void UnloggedReplyMessage::InternalSwap(UnloggedReplyMessage* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.reply_, lhs_arena,
+      &other->_impl_.reply_, rhs_arena
+  );
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata UnloggedReplyMessage::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_replication_2fvr_2fvr_2dproto_2eproto_getter, &descriptor_table_replication_2fvr_2fvr_2dproto_2eproto_once,
+      file_level_metadata_replication_2fvr_2fvr_2dproto_2eproto[1]);
+}
+
+// ===================================================================
+
+class ToClientMessage::_Internal {
+ public:
+  static const ::dsnet::vr::proto::ReplyMessage& reply(const ToClientMessage* msg);
+  static const ::dsnet::vr::proto::UnloggedReplyMessage& unlogged_reply(const ToClientMessage* msg);
+};
+
+const ::dsnet::vr::proto::ReplyMessage&
+ToClientMessage::_Internal::reply(const ToClientMessage* msg) {
+  return *msg->_impl_.msg_.reply_;
+}
+const ::dsnet::vr::proto::UnloggedReplyMessage&
+ToClientMessage::_Internal::unlogged_reply(const ToClientMessage* msg) {
+  return *msg->_impl_.msg_.unlogged_reply_;
+}
+void ToClientMessage::set_allocated_reply(::dsnet::vr::proto::ReplyMessage* reply) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  clear_msg();
+  if (reply) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(reply);
+    if (message_arena != submessage_arena) {
+      reply = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, reply, submessage_arena);
+    }
+    set_has_reply();
+    _impl_.msg_.reply_ = reply;
+  }
+  // @@protoc_insertion_point(field_set_allocated:dsnet.vr.proto.ToClientMessage.reply)
+}
+void ToClientMessage::set_allocated_unlogged_reply(::dsnet::vr::proto::UnloggedReplyMessage* unlogged_reply) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  clear_msg();
+  if (unlogged_reply) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(unlogged_reply);
+    if (message_arena != submessage_arena) {
+      unlogged_reply = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, unlogged_reply, submessage_arena);
+    }
+    set_has_unlogged_reply();
+    _impl_.msg_.unlogged_reply_ = unlogged_reply;
+  }
+  // @@protoc_insertion_point(field_set_allocated:dsnet.vr.proto.ToClientMessage.unlogged_reply)
+}
+ToClientMessage::ToClientMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:dsnet.vr.proto.ToClientMessage)
+}
+ToClientMessage::ToClientMessage(const ToClientMessage& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  ToClientMessage* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.msg_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , /*decltype(_impl_._oneof_case_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  clear_has_msg();
+  switch (from.msg_case()) {
+    case kReply: {
+      _this->_internal_mutable_reply()->::dsnet::vr::proto::ReplyMessage::MergeFrom(
+          from._internal_reply());
+      break;
+    }
+    case kUnloggedReply: {
+      _this->_internal_mutable_unlogged_reply()->::dsnet::vr::proto::UnloggedReplyMessage::MergeFrom(
+          from._internal_unlogged_reply());
+      break;
+    }
+    case MSG_NOT_SET: {
+      break;
+    }
+  }
+  // @@protoc_insertion_point(copy_constructor:dsnet.vr.proto.ToClientMessage)
+}
+
+inline void ToClientMessage::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.msg_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , /*decltype(_impl_._oneof_case_)*/{}
+  };
+  clear_has_msg();
+}
+
+ToClientMessage::~ToClientMessage() {
+  // @@protoc_insertion_point(destructor:dsnet.vr.proto.ToClientMessage)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void ToClientMessage::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  if (has_msg()) {
+    clear_msg();
+  }
+}
+
+void ToClientMessage::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void ToClientMessage::clear_msg() {
+// @@protoc_insertion_point(one_of_clear_start:dsnet.vr.proto.ToClientMessage)
+  switch (msg_case()) {
+    case kReply: {
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.msg_.reply_;
+      }
+      break;
+    }
+    case kUnloggedReply: {
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.msg_.unlogged_reply_;
+      }
+      break;
+    }
+    case MSG_NOT_SET: {
+      break;
+    }
+  }
+  _impl_._oneof_case_[0] = MSG_NOT_SET;
+}
+
+
+void ToClientMessage::Clear() {
+// @@protoc_insertion_point(message_clear_start:dsnet.vr.proto.ToClientMessage)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  clear_msg();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* ToClientMessage::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // .dsnet.vr.proto.ReplyMessage reply = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr = ctx->ParseMessage(_internal_mutable_reply(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .dsnet.vr.proto.UnloggedReplyMessage unlogged_reply = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr = ctx->ParseMessage(_internal_mutable_unlogged_reply(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* ToClientMessage::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:dsnet.vr.proto.ToClientMessage)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  switch (msg_case()) {
+    case kReply: {
+      target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(1, _Internal::reply(this),
+          _Internal::reply(this).GetCachedSize(), target, stream);
+      break;
+    }
+    case kUnloggedReply: {
+      target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(2, _Internal::unlogged_reply(this),
+          _Internal::unlogged_reply(this).GetCachedSize(), target, stream);
+      break;
+    }
+    default: ;
+  }
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:dsnet.vr.proto.ToClientMessage)
+  return target;
+}
+
+size_t ToClientMessage::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:dsnet.vr.proto.ToClientMessage)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  switch (msg_case()) {
+    // .dsnet.vr.proto.ReplyMessage reply = 1;
+    case kReply: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.msg_.reply_);
+      break;
+    }
+    // .dsnet.vr.proto.UnloggedReplyMessage unlogged_reply = 2;
+    case kUnloggedReply: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.msg_.unlogged_reply_);
+      break;
+    }
+    case MSG_NOT_SET: {
+      break;
+    }
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ToClientMessage::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    ToClientMessage::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ToClientMessage::GetClassData() const { return &_class_data_; }
+
+
+void ToClientMessage::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<ToClientMessage*>(&to_msg);
+  auto& from = static_cast<const ToClientMessage&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:dsnet.vr.proto.ToClientMessage)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  switch (from.msg_case()) {
+    case kReply: {
+      _this->_internal_mutable_reply()->::dsnet::vr::proto::ReplyMessage::MergeFrom(
+          from._internal_reply());
+      break;
+    }
+    case kUnloggedReply: {
+      _this->_internal_mutable_unlogged_reply()->::dsnet::vr::proto::UnloggedReplyMessage::MergeFrom(
+          from._internal_unlogged_reply());
+      break;
+    }
+    case MSG_NOT_SET: {
+      break;
+    }
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void ToClientMessage::CopyFrom(const ToClientMessage& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:dsnet.vr.proto.ToClientMessage)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool ToClientMessage::IsInitialized() const {
+  switch (msg_case()) {
+    case kReply: {
+      if (_internal_has_reply()) {
+        if (!_impl_.msg_.reply_->IsInitialized()) return false;
+      }
+      break;
+    }
+    case kUnloggedReply: {
+      if (_internal_has_unlogged_reply()) {
+        if (!_impl_.msg_.unlogged_reply_->IsInitialized()) return false;
+      }
+      break;
+    }
+    case MSG_NOT_SET: {
+      break;
+    }
+  }
+  return true;
+}
+
+void ToClientMessage::InternalSwap(ToClientMessage* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_.msg_, other->_impl_.msg_);
+  swap(_impl_._oneof_case_[0], other->_impl_._oneof_case_[0]);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata ToClientMessage::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_replication_2fvr_2fvr_2dproto_2eproto_getter, &descriptor_table_replication_2fvr_2fvr_2dproto_2eproto_once,
+      file_level_metadata_replication_2fvr_2fvr_2dproto_2eproto[2]);
+}
+
+// ===================================================================
+
+class RequestMessage::_Internal {
+ public:
+  using HasBits = decltype(std::declval<RequestMessage>()._impl_._has_bits_);
+  static const ::dsnet::Request& req(const RequestMessage* msg);
+  static void set_has_req(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000001) ^ 0x00000001) != 0;
+  }
+};
+
+const ::dsnet::Request&
+RequestMessage::_Internal::req(const RequestMessage* msg) {
+  return *msg->_impl_.req_;
+}
+void RequestMessage::clear_req() {
+  if (_impl_.req_ != nullptr) _impl_.req_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+RequestMessage::RequestMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:dsnet.vr.proto.RequestMessage)
+}
+RequestMessage::RequestMessage(const RequestMessage& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  RequestMessage* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.req_){nullptr}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  if (from._internal_has_req()) {
+    _this->_impl_.req_ = new ::dsnet::Request(*from._impl_.req_);
+  }
+  // @@protoc_insertion_point(copy_constructor:dsnet.vr.proto.RequestMessage)
+}
+
+inline void RequestMessage::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.req_){nullptr}
+  };
+}
+
+RequestMessage::~RequestMessage() {
+  // @@protoc_insertion_point(destructor:dsnet.vr.proto.RequestMessage)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void RequestMessage::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  if (this != internal_default_instance()) delete _impl_.req_;
+}
+
+void RequestMessage::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void RequestMessage::Clear() {
+// @@protoc_insertion_point(message_clear_start:dsnet.vr.proto.RequestMessage)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    GOOGLE_DCHECK(_impl_.req_ != nullptr);
+    _impl_.req_->Clear();
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* RequestMessage::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required .dsnet.Request req = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr = ctx->ParseMessage(_internal_mutable_req(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* RequestMessage::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:dsnet.vr.proto.RequestMessage)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required .dsnet.Request req = 1;
+  if (cached_has_bits & 0x00000001u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(1, _Internal::req(this),
+        _Internal::req(this).GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:dsnet.vr.proto.RequestMessage)
+  return target;
+}
+
+size_t RequestMessage::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:dsnet.vr.proto.RequestMessage)
+  size_t total_size = 0;
+
+  // required .dsnet.Request req = 1;
+  if (_internal_has_req()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.req_);
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData RequestMessage::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    RequestMessage::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*RequestMessage::GetClassData() const { return &_class_data_; }
+
+
+void RequestMessage::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<RequestMessage*>(&to_msg);
+  auto& from = static_cast<const RequestMessage&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:dsnet.vr.proto.RequestMessage)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_has_req()) {
+    _this->_internal_mutable_req()->::dsnet::Request::MergeFrom(
+        from._internal_req());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void RequestMessage::CopyFrom(const RequestMessage& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:dsnet.vr.proto.RequestMessage)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool RequestMessage::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  if (_internal_has_req()) {
+    if (!_impl_.req_->IsInitialized()) return false;
+  }
+  return true;
+}
+
+void RequestMessage::InternalSwap(RequestMessage* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  swap(_impl_.req_, other->_impl_.req_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata RequestMessage::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_replication_2fvr_2fvr_2dproto_2eproto_getter, &descriptor_table_replication_2fvr_2fvr_2dproto_2eproto_once,
+      file_level_metadata_replication_2fvr_2fvr_2dproto_2eproto[3]);
+}
+
+// ===================================================================
+
+class UnloggedRequestMessage::_Internal {
+ public:
+  using HasBits = decltype(std::declval<UnloggedRequestMessage>()._impl_._has_bits_);
+  static const ::dsnet::UnloggedRequest& req(const UnloggedRequestMessage* msg);
+  static void set_has_req(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000001) ^ 0x00000001) != 0;
+  }
+};
+
+const ::dsnet::UnloggedRequest&
+UnloggedRequestMessage::_Internal::req(const UnloggedRequestMessage* msg) {
+  return *msg->_impl_.req_;
+}
+void UnloggedRequestMessage::clear_req() {
+  if (_impl_.req_ != nullptr) _impl_.req_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+UnloggedRequestMessage::UnloggedRequestMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:dsnet.vr.proto.UnloggedRequestMessage)
+}
+UnloggedRequestMessage::UnloggedRequestMessage(const UnloggedRequestMessage& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  UnloggedRequestMessage* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.req_){nullptr}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  if (from._internal_has_req()) {
+    _this->_impl_.req_ = new ::dsnet::UnloggedRequest(*from._impl_.req_);
+  }
+  // @@protoc_insertion_point(copy_constructor:dsnet.vr.proto.UnloggedRequestMessage)
+}
+
+inline void UnloggedRequestMessage::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.req_){nullptr}
+  };
+}
+
+UnloggedRequestMessage::~UnloggedRequestMessage() {
+  // @@protoc_insertion_point(destructor:dsnet.vr.proto.UnloggedRequestMessage)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void UnloggedRequestMessage::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  if (this != internal_default_instance()) delete _impl_.req_;
+}
+
+void UnloggedRequestMessage::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void UnloggedRequestMessage::Clear() {
+// @@protoc_insertion_point(message_clear_start:dsnet.vr.proto.UnloggedRequestMessage)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    GOOGLE_DCHECK(_impl_.req_ != nullptr);
+    _impl_.req_->Clear();
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* UnloggedRequestMessage::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required .dsnet.UnloggedRequest req = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr = ctx->ParseMessage(_internal_mutable_req(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* UnloggedRequestMessage::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:dsnet.vr.proto.UnloggedRequestMessage)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required .dsnet.UnloggedRequest req = 1;
+  if (cached_has_bits & 0x00000001u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(1, _Internal::req(this),
+        _Internal::req(this).GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:dsnet.vr.proto.UnloggedRequestMessage)
+  return target;
+}
+
+size_t UnloggedRequestMessage::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:dsnet.vr.proto.UnloggedRequestMessage)
+  size_t total_size = 0;
+
+  // required .dsnet.UnloggedRequest req = 1;
+  if (_internal_has_req()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.req_);
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData UnloggedRequestMessage::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    UnloggedRequestMessage::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*UnloggedRequestMessage::GetClassData() const { return &_class_data_; }
+
+
+void UnloggedRequestMessage::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<UnloggedRequestMessage*>(&to_msg);
+  auto& from = static_cast<const UnloggedRequestMessage&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:dsnet.vr.proto.UnloggedRequestMessage)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_has_req()) {
+    _this->_internal_mutable_req()->::dsnet::UnloggedRequest::MergeFrom(
+        from._internal_req());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void UnloggedRequestMessage::CopyFrom(const UnloggedRequestMessage& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:dsnet.vr.proto.UnloggedRequestMessage)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool UnloggedRequestMessage::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  if (_internal_has_req()) {
+    if (!_impl_.req_->IsInitialized()) return false;
+  }
+  return true;
+}
+
+void UnloggedRequestMessage::InternalSwap(UnloggedRequestMessage* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  swap(_impl_.req_, other->_impl_.req_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata UnloggedRequestMessage::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_replication_2fvr_2fvr_2dproto_2eproto_getter, &descriptor_table_replication_2fvr_2fvr_2dproto_2eproto_once,
+      file_level_metadata_replication_2fvr_2fvr_2dproto_2eproto[4]);
+}
+
+// ===================================================================
+
+class PrepareMessage::_Internal {
+ public:
+  using HasBits = decltype(std::declval<PrepareMessage>()._impl_._has_bits_);
+  static void set_has_view(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_opnum(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_batchstart(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000007) ^ 0x00000007) != 0;
+  }
+};
+
+void PrepareMessage::clear_request() {
+  _impl_.request_.Clear();
+}
+PrepareMessage::PrepareMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:dsnet.vr.proto.PrepareMessage)
+}
+PrepareMessage::PrepareMessage(const PrepareMessage& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  PrepareMessage* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.request_){from._impl_.request_}
+    , decltype(_impl_.view_){}
+    , decltype(_impl_.opnum_){}
+    , decltype(_impl_.batchstart_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.view_, &from._impl_.view_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.batchstart_) -
+    reinterpret_cast<char*>(&_impl_.view_)) + sizeof(_impl_.batchstart_));
+  // @@protoc_insertion_point(copy_constructor:dsnet.vr.proto.PrepareMessage)
+}
+
+inline void PrepareMessage::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.request_){arena}
+    , decltype(_impl_.view_){uint64_t{0u}}
+    , decltype(_impl_.opnum_){uint64_t{0u}}
+    , decltype(_impl_.batchstart_){uint64_t{0u}}
+  };
+}
+
+PrepareMessage::~PrepareMessage() {
+  // @@protoc_insertion_point(destructor:dsnet.vr.proto.PrepareMessage)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void PrepareMessage::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.request_.~RepeatedPtrField();
+}
+
+void PrepareMessage::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void PrepareMessage::Clear() {
+// @@protoc_insertion_point(message_clear_start:dsnet.vr.proto.PrepareMessage)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.request_.Clear();
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    ::memset(&_impl_.view_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.batchstart_) -
+        reinterpret_cast<char*>(&_impl_.view_)) + sizeof(_impl_.batchstart_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* PrepareMessage::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required uint64 view = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_view(&has_bits);
+          _impl_.view_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required uint64 opnum = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _Internal::set_has_opnum(&has_bits);
+          _impl_.opnum_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required uint64 batchstart = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _Internal::set_has_batchstart(&has_bits);
+          _impl_.batchstart_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .dsnet.Request request = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_request(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<34>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* PrepareMessage::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:dsnet.vr.proto.PrepareMessage)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required uint64 view = 1;
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(1, this->_internal_view(), target);
+  }
+
+  // required uint64 opnum = 2;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(2, this->_internal_opnum(), target);
+  }
+
+  // required uint64 batchstart = 3;
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(3, this->_internal_batchstart(), target);
+  }
+
+  // repeated .dsnet.Request request = 4;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_request_size()); i < n; i++) {
+    const auto& repfield = this->_internal_request(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(4, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:dsnet.vr.proto.PrepareMessage)
+  return target;
+}
+
+size_t PrepareMessage::RequiredFieldsByteSizeFallback() const {
+// @@protoc_insertion_point(required_fields_byte_size_fallback_start:dsnet.vr.proto.PrepareMessage)
+  size_t total_size = 0;
+
+  if (_internal_has_view()) {
+    // required uint64 view = 1;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_view());
+  }
+
+  if (_internal_has_opnum()) {
+    // required uint64 opnum = 2;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_opnum());
+  }
+
+  if (_internal_has_batchstart()) {
+    // required uint64 batchstart = 3;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_batchstart());
+  }
+
+  return total_size;
+}
+size_t PrepareMessage::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:dsnet.vr.proto.PrepareMessage)
+  size_t total_size = 0;
+
+  if (((_impl_._has_bits_[0] & 0x00000007) ^ 0x00000007) == 0) {  // All required fields are present.
+    // required uint64 view = 1;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_view());
+
+    // required uint64 opnum = 2;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_opnum());
+
+    // required uint64 batchstart = 3;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_batchstart());
+
+  } else {
+    total_size += RequiredFieldsByteSizeFallback();
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .dsnet.Request request = 4;
+  total_size += 1UL * this->_internal_request_size();
+  for (const auto& msg : this->_impl_.request_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData PrepareMessage::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    PrepareMessage::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*PrepareMessage::GetClassData() const { return &_class_data_; }
+
+
+void PrepareMessage::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<PrepareMessage*>(&to_msg);
+  auto& from = static_cast<const PrepareMessage&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:dsnet.vr.proto.PrepareMessage)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.request_.MergeFrom(from._impl_.request_);
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_impl_.view_ = from._impl_.view_;
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.opnum_ = from._impl_.opnum_;
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.batchstart_ = from._impl_.batchstart_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void PrepareMessage::CopyFrom(const PrepareMessage& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:dsnet.vr.proto.PrepareMessage)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool PrepareMessage::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  if (!::PROTOBUF_NAMESPACE_ID::internal::AllAreInitialized(_impl_.request_))
+    return false;
+  return true;
+}
+
+void PrepareMessage::InternalSwap(PrepareMessage* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  _impl_.request_.InternalSwap(&other->_impl_.request_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(PrepareMessage, _impl_.batchstart_)
+      + sizeof(PrepareMessage::_impl_.batchstart_)
+      - PROTOBUF_FIELD_OFFSET(PrepareMessage, _impl_.view_)>(
+          reinterpret_cast<char*>(&_impl_.view_),
+          reinterpret_cast<char*>(&other->_impl_.view_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata PrepareMessage::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_replication_2fvr_2fvr_2dproto_2eproto_getter, &descriptor_table_replication_2fvr_2fvr_2dproto_2eproto_once,
+      file_level_metadata_replication_2fvr_2fvr_2dproto_2eproto[5]);
+}
+
+// ===================================================================
+
+class PrepareOKMessage::_Internal {
+ public:
+  using HasBits = decltype(std::declval<PrepareOKMessage>()._impl_._has_bits_);
+  static void set_has_view(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_opnum(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_replicaidx(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000007) ^ 0x00000007) != 0;
+  }
+};
+
+PrepareOKMessage::PrepareOKMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:dsnet.vr.proto.PrepareOKMessage)
+}
+PrepareOKMessage::PrepareOKMessage(const PrepareOKMessage& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  PrepareOKMessage* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.view_){}
+    , decltype(_impl_.opnum_){}
+    , decltype(_impl_.replicaidx_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.view_, &from._impl_.view_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.replicaidx_) -
+    reinterpret_cast<char*>(&_impl_.view_)) + sizeof(_impl_.replicaidx_));
+  // @@protoc_insertion_point(copy_constructor:dsnet.vr.proto.PrepareOKMessage)
+}
+
+inline void PrepareOKMessage::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.view_){uint64_t{0u}}
+    , decltype(_impl_.opnum_){uint64_t{0u}}
+    , decltype(_impl_.replicaidx_){0u}
+  };
+}
+
+PrepareOKMessage::~PrepareOKMessage() {
+  // @@protoc_insertion_point(destructor:dsnet.vr.proto.PrepareOKMessage)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void PrepareOKMessage::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void PrepareOKMessage::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void PrepareOKMessage::Clear() {
+// @@protoc_insertion_point(message_clear_start:dsnet.vr.proto.PrepareOKMessage)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    ::memset(&_impl_.view_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.replicaidx_) -
+        reinterpret_cast<char*>(&_impl_.view_)) + sizeof(_impl_.replicaidx_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* PrepareOKMessage::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required uint64 view = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_view(&has_bits);
+          _impl_.view_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required uint64 opnum = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _Internal::set_has_opnum(&has_bits);
+          _impl_.opnum_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required uint32 replicaIdx = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _Internal::set_has_replicaidx(&has_bits);
+          _impl_.replicaidx_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* PrepareOKMessage::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:dsnet.vr.proto.PrepareOKMessage)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required uint64 view = 1;
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(1, this->_internal_view(), target);
+  }
+
+  // required uint64 opnum = 2;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(2, this->_internal_opnum(), target);
+  }
+
+  // required uint32 replicaIdx = 3;
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(3, this->_internal_replicaidx(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:dsnet.vr.proto.PrepareOKMessage)
+  return target;
+}
+
+size_t PrepareOKMessage::RequiredFieldsByteSizeFallback() const {
+// @@protoc_insertion_point(required_fields_byte_size_fallback_start:dsnet.vr.proto.PrepareOKMessage)
+  size_t total_size = 0;
+
+  if (_internal_has_view()) {
+    // required uint64 view = 1;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_view());
+  }
+
+  if (_internal_has_opnum()) {
+    // required uint64 opnum = 2;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_opnum());
+  }
+
+  if (_internal_has_replicaidx()) {
+    // required uint32 replicaIdx = 3;
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_replicaidx());
+  }
+
+  return total_size;
+}
+size_t PrepareOKMessage::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:dsnet.vr.proto.PrepareOKMessage)
+  size_t total_size = 0;
+
+  if (((_impl_._has_bits_[0] & 0x00000007) ^ 0x00000007) == 0) {  // All required fields are present.
+    // required uint64 view = 1;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_view());
+
+    // required uint64 opnum = 2;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_opnum());
+
+    // required uint32 replicaIdx = 3;
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_replicaidx());
+
+  } else {
+    total_size += RequiredFieldsByteSizeFallback();
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData PrepareOKMessage::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    PrepareOKMessage::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*PrepareOKMessage::GetClassData() const { return &_class_data_; }
+
+
+void PrepareOKMessage::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<PrepareOKMessage*>(&to_msg);
+  auto& from = static_cast<const PrepareOKMessage&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:dsnet.vr.proto.PrepareOKMessage)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_impl_.view_ = from._impl_.view_;
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.opnum_ = from._impl_.opnum_;
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.replicaidx_ = from._impl_.replicaidx_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void PrepareOKMessage::CopyFrom(const PrepareOKMessage& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:dsnet.vr.proto.PrepareOKMessage)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool PrepareOKMessage::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  return true;
+}
+
+void PrepareOKMessage::InternalSwap(PrepareOKMessage* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(PrepareOKMessage, _impl_.replicaidx_)
+      + sizeof(PrepareOKMessage::_impl_.replicaidx_)
+      - PROTOBUF_FIELD_OFFSET(PrepareOKMessage, _impl_.view_)>(
+          reinterpret_cast<char*>(&_impl_.view_),
+          reinterpret_cast<char*>(&other->_impl_.view_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata PrepareOKMessage::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_replication_2fvr_2fvr_2dproto_2eproto_getter, &descriptor_table_replication_2fvr_2fvr_2dproto_2eproto_once,
+      file_level_metadata_replication_2fvr_2fvr_2dproto_2eproto[6]);
+}
+
+// ===================================================================
+
+class CommitMessage::_Internal {
+ public:
+  using HasBits = decltype(std::declval<CommitMessage>()._impl_._has_bits_);
+  static void set_has_view(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_opnum(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000003) ^ 0x00000003) != 0;
+  }
+};
+
+CommitMessage::CommitMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:dsnet.vr.proto.CommitMessage)
+}
+CommitMessage::CommitMessage(const CommitMessage& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  CommitMessage* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.view_){}
+    , decltype(_impl_.opnum_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.view_, &from._impl_.view_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.opnum_) -
+    reinterpret_cast<char*>(&_impl_.view_)) + sizeof(_impl_.opnum_));
+  // @@protoc_insertion_point(copy_constructor:dsnet.vr.proto.CommitMessage)
+}
+
+inline void CommitMessage::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.view_){uint64_t{0u}}
+    , decltype(_impl_.opnum_){uint64_t{0u}}
+  };
+}
+
+CommitMessage::~CommitMessage() {
+  // @@protoc_insertion_point(destructor:dsnet.vr.proto.CommitMessage)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void CommitMessage::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void CommitMessage::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void CommitMessage::Clear() {
+// @@protoc_insertion_point(message_clear_start:dsnet.vr.proto.CommitMessage)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    ::memset(&_impl_.view_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.opnum_) -
+        reinterpret_cast<char*>(&_impl_.view_)) + sizeof(_impl_.opnum_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* CommitMessage::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required uint64 view = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_view(&has_bits);
+          _impl_.view_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required uint64 opnum = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _Internal::set_has_opnum(&has_bits);
+          _impl_.opnum_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* CommitMessage::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:dsnet.vr.proto.CommitMessage)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required uint64 view = 1;
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(1, this->_internal_view(), target);
+  }
+
+  // required uint64 opnum = 2;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(2, this->_internal_opnum(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:dsnet.vr.proto.CommitMessage)
+  return target;
+}
+
+size_t CommitMessage::RequiredFieldsByteSizeFallback() const {
+// @@protoc_insertion_point(required_fields_byte_size_fallback_start:dsnet.vr.proto.CommitMessage)
+  size_t total_size = 0;
+
+  if (_internal_has_view()) {
+    // required uint64 view = 1;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_view());
+  }
+
+  if (_internal_has_opnum()) {
+    // required uint64 opnum = 2;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_opnum());
+  }
+
+  return total_size;
+}
+size_t CommitMessage::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:dsnet.vr.proto.CommitMessage)
+  size_t total_size = 0;
+
+  if (((_impl_._has_bits_[0] & 0x00000003) ^ 0x00000003) == 0) {  // All required fields are present.
+    // required uint64 view = 1;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_view());
+
+    // required uint64 opnum = 2;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_opnum());
+
+  } else {
+    total_size += RequiredFieldsByteSizeFallback();
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData CommitMessage::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    CommitMessage::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*CommitMessage::GetClassData() const { return &_class_data_; }
+
+
+void CommitMessage::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<CommitMessage*>(&to_msg);
+  auto& from = static_cast<const CommitMessage&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:dsnet.vr.proto.CommitMessage)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_impl_.view_ = from._impl_.view_;
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.opnum_ = from._impl_.opnum_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void CommitMessage::CopyFrom(const CommitMessage& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:dsnet.vr.proto.CommitMessage)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool CommitMessage::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  return true;
+}
+
+void CommitMessage::InternalSwap(CommitMessage* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(CommitMessage, _impl_.opnum_)
+      + sizeof(CommitMessage::_impl_.opnum_)
+      - PROTOBUF_FIELD_OFFSET(CommitMessage, _impl_.view_)>(
+          reinterpret_cast<char*>(&_impl_.view_),
+          reinterpret_cast<char*>(&other->_impl_.view_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata CommitMessage::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_replication_2fvr_2fvr_2dproto_2eproto_getter, &descriptor_table_replication_2fvr_2fvr_2dproto_2eproto_once,
+      file_level_metadata_replication_2fvr_2fvr_2dproto_2eproto[7]);
+}
+
+// ===================================================================
+
+class RequestStateTransferMessage::_Internal {
+ public:
+  using HasBits = decltype(std::declval<RequestStateTransferMessage>()._impl_._has_bits_);
+  static void set_has_view(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_opnum(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000003) ^ 0x00000003) != 0;
+  }
+};
+
+RequestStateTransferMessage::RequestStateTransferMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:dsnet.vr.proto.RequestStateTransferMessage)
+}
+RequestStateTransferMessage::RequestStateTransferMessage(const RequestStateTransferMessage& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  RequestStateTransferMessage* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.view_){}
+    , decltype(_impl_.opnum_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.view_, &from._impl_.view_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.opnum_) -
+    reinterpret_cast<char*>(&_impl_.view_)) + sizeof(_impl_.opnum_));
+  // @@protoc_insertion_point(copy_constructor:dsnet.vr.proto.RequestStateTransferMessage)
+}
+
+inline void RequestStateTransferMessage::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.view_){uint64_t{0u}}
+    , decltype(_impl_.opnum_){uint64_t{0u}}
+  };
+}
+
+RequestStateTransferMessage::~RequestStateTransferMessage() {
+  // @@protoc_insertion_point(destructor:dsnet.vr.proto.RequestStateTransferMessage)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void RequestStateTransferMessage::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void RequestStateTransferMessage::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void RequestStateTransferMessage::Clear() {
+// @@protoc_insertion_point(message_clear_start:dsnet.vr.proto.RequestStateTransferMessage)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    ::memset(&_impl_.view_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.opnum_) -
+        reinterpret_cast<char*>(&_impl_.view_)) + sizeof(_impl_.opnum_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* RequestStateTransferMessage::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required uint64 view = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_view(&has_bits);
+          _impl_.view_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required uint64 opnum = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _Internal::set_has_opnum(&has_bits);
+          _impl_.opnum_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* RequestStateTransferMessage::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:dsnet.vr.proto.RequestStateTransferMessage)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required uint64 view = 1;
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(1, this->_internal_view(), target);
+  }
+
+  // required uint64 opnum = 2;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(2, this->_internal_opnum(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:dsnet.vr.proto.RequestStateTransferMessage)
+  return target;
+}
+
+size_t RequestStateTransferMessage::RequiredFieldsByteSizeFallback() const {
+// @@protoc_insertion_point(required_fields_byte_size_fallback_start:dsnet.vr.proto.RequestStateTransferMessage)
+  size_t total_size = 0;
+
+  if (_internal_has_view()) {
+    // required uint64 view = 1;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_view());
+  }
+
+  if (_internal_has_opnum()) {
+    // required uint64 opnum = 2;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_opnum());
+  }
+
+  return total_size;
+}
+size_t RequestStateTransferMessage::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:dsnet.vr.proto.RequestStateTransferMessage)
+  size_t total_size = 0;
+
+  if (((_impl_._has_bits_[0] & 0x00000003) ^ 0x00000003) == 0) {  // All required fields are present.
+    // required uint64 view = 1;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_view());
+
+    // required uint64 opnum = 2;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_opnum());
+
+  } else {
+    total_size += RequiredFieldsByteSizeFallback();
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData RequestStateTransferMessage::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    RequestStateTransferMessage::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*RequestStateTransferMessage::GetClassData() const { return &_class_data_; }
+
+
+void RequestStateTransferMessage::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<RequestStateTransferMessage*>(&to_msg);
+  auto& from = static_cast<const RequestStateTransferMessage&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:dsnet.vr.proto.RequestStateTransferMessage)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_impl_.view_ = from._impl_.view_;
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.opnum_ = from._impl_.opnum_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void RequestStateTransferMessage::CopyFrom(const RequestStateTransferMessage& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:dsnet.vr.proto.RequestStateTransferMessage)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool RequestStateTransferMessage::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  return true;
+}
+
+void RequestStateTransferMessage::InternalSwap(RequestStateTransferMessage* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(RequestStateTransferMessage, _impl_.opnum_)
+      + sizeof(RequestStateTransferMessage::_impl_.opnum_)
+      - PROTOBUF_FIELD_OFFSET(RequestStateTransferMessage, _impl_.view_)>(
+          reinterpret_cast<char*>(&_impl_.view_),
+          reinterpret_cast<char*>(&other->_impl_.view_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata RequestStateTransferMessage::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_replication_2fvr_2fvr_2dproto_2eproto_getter, &descriptor_table_replication_2fvr_2fvr_2dproto_2eproto_once,
+      file_level_metadata_replication_2fvr_2fvr_2dproto_2eproto[8]);
+}
+
+// ===================================================================
+
+class StateTransferMessage::_Internal {
+ public:
+  using HasBits = decltype(std::declval<StateTransferMessage>()._impl_._has_bits_);
+  static void set_has_view(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_opnum(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000003) ^ 0x00000003) != 0;
+  }
+};
+
+void StateTransferMessage::clear_entries() {
+  _impl_.entries_.Clear();
+}
+StateTransferMessage::StateTransferMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:dsnet.vr.proto.StateTransferMessage)
+}
+StateTransferMessage::StateTransferMessage(const StateTransferMessage& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  StateTransferMessage* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.entries_){from._impl_.entries_}
+    , decltype(_impl_.view_){}
+    , decltype(_impl_.opnum_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.view_, &from._impl_.view_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.opnum_) -
+    reinterpret_cast<char*>(&_impl_.view_)) + sizeof(_impl_.opnum_));
+  // @@protoc_insertion_point(copy_constructor:dsnet.vr.proto.StateTransferMessage)
+}
+
+inline void StateTransferMessage::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.entries_){arena}
+    , decltype(_impl_.view_){uint64_t{0u}}
+    , decltype(_impl_.opnum_){uint64_t{0u}}
+  };
+}
+
+StateTransferMessage::~StateTransferMessage() {
+  // @@protoc_insertion_point(destructor:dsnet.vr.proto.StateTransferMessage)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void StateTransferMessage::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.entries_.~RepeatedPtrField();
+}
+
+void StateTransferMessage::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void StateTransferMessage::Clear() {
+// @@protoc_insertion_point(message_clear_start:dsnet.vr.proto.StateTransferMessage)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.entries_.Clear();
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    ::memset(&_impl_.view_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.opnum_) -
+        reinterpret_cast<char*>(&_impl_.view_)) + sizeof(_impl_.opnum_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* StateTransferMessage::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required uint64 view = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_view(&has_bits);
+          _impl_.view_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required uint64 opnum = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _Internal::set_has_opnum(&has_bits);
+          _impl_.opnum_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .dsnet.MsgLogEntry entries = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_entries(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<26>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* StateTransferMessage::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:dsnet.vr.proto.StateTransferMessage)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required uint64 view = 1;
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(1, this->_internal_view(), target);
+  }
+
+  // required uint64 opnum = 2;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(2, this->_internal_opnum(), target);
+  }
+
+  // repeated .dsnet.MsgLogEntry entries = 3;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_entries_size()); i < n; i++) {
+    const auto& repfield = this->_internal_entries(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(3, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:dsnet.vr.proto.StateTransferMessage)
+  return target;
+}
+
+size_t StateTransferMessage::RequiredFieldsByteSizeFallback() const {
+// @@protoc_insertion_point(required_fields_byte_size_fallback_start:dsnet.vr.proto.StateTransferMessage)
+  size_t total_size = 0;
+
+  if (_internal_has_view()) {
+    // required uint64 view = 1;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_view());
+  }
+
+  if (_internal_has_opnum()) {
+    // required uint64 opnum = 2;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_opnum());
+  }
+
+  return total_size;
+}
+size_t StateTransferMessage::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:dsnet.vr.proto.StateTransferMessage)
+  size_t total_size = 0;
+
+  if (((_impl_._has_bits_[0] & 0x00000003) ^ 0x00000003) == 0) {  // All required fields are present.
+    // required uint64 view = 1;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_view());
+
+    // required uint64 opnum = 2;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_opnum());
+
+  } else {
+    total_size += RequiredFieldsByteSizeFallback();
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .dsnet.MsgLogEntry entries = 3;
+  total_size += 1UL * this->_internal_entries_size();
+  for (const auto& msg : this->_impl_.entries_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData StateTransferMessage::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    StateTransferMessage::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*StateTransferMessage::GetClassData() const { return &_class_data_; }
+
+
+void StateTransferMessage::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<StateTransferMessage*>(&to_msg);
+  auto& from = static_cast<const StateTransferMessage&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:dsnet.vr.proto.StateTransferMessage)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.entries_.MergeFrom(from._impl_.entries_);
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_impl_.view_ = from._impl_.view_;
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.opnum_ = from._impl_.opnum_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void StateTransferMessage::CopyFrom(const StateTransferMessage& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:dsnet.vr.proto.StateTransferMessage)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool StateTransferMessage::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  if (!::PROTOBUF_NAMESPACE_ID::internal::AllAreInitialized(_impl_.entries_))
+    return false;
+  return true;
+}
+
+void StateTransferMessage::InternalSwap(StateTransferMessage* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  _impl_.entries_.InternalSwap(&other->_impl_.entries_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(StateTransferMessage, _impl_.opnum_)
+      + sizeof(StateTransferMessage::_impl_.opnum_)
+      - PROTOBUF_FIELD_OFFSET(StateTransferMessage, _impl_.view_)>(
+          reinterpret_cast<char*>(&_impl_.view_),
+          reinterpret_cast<char*>(&other->_impl_.view_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata StateTransferMessage::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_replication_2fvr_2fvr_2dproto_2eproto_getter, &descriptor_table_replication_2fvr_2fvr_2dproto_2eproto_once,
+      file_level_metadata_replication_2fvr_2fvr_2dproto_2eproto[9]);
+}
+
+// ===================================================================
+
+class StartViewChangeMessage::_Internal {
+ public:
+  using HasBits = decltype(std::declval<StartViewChangeMessage>()._impl_._has_bits_);
+  static void set_has_view(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_replicaidx(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static void set_has_lastcommitted(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000007) ^ 0x00000007) != 0;
+  }
+};
+
+StartViewChangeMessage::StartViewChangeMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:dsnet.vr.proto.StartViewChangeMessage)
+}
+StartViewChangeMessage::StartViewChangeMessage(const StartViewChangeMessage& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  StartViewChangeMessage* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.view_){}
+    , decltype(_impl_.lastcommitted_){}
+    , decltype(_impl_.replicaidx_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.view_, &from._impl_.view_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.replicaidx_) -
+    reinterpret_cast<char*>(&_impl_.view_)) + sizeof(_impl_.replicaidx_));
+  // @@protoc_insertion_point(copy_constructor:dsnet.vr.proto.StartViewChangeMessage)
+}
+
+inline void StartViewChangeMessage::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.view_){uint64_t{0u}}
+    , decltype(_impl_.lastcommitted_){uint64_t{0u}}
+    , decltype(_impl_.replicaidx_){0u}
+  };
+}
+
+StartViewChangeMessage::~StartViewChangeMessage() {
+  // @@protoc_insertion_point(destructor:dsnet.vr.proto.StartViewChangeMessage)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void StartViewChangeMessage::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void StartViewChangeMessage::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void StartViewChangeMessage::Clear() {
+// @@protoc_insertion_point(message_clear_start:dsnet.vr.proto.StartViewChangeMessage)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    ::memset(&_impl_.view_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.replicaidx_) -
+        reinterpret_cast<char*>(&_impl_.view_)) + sizeof(_impl_.replicaidx_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* StartViewChangeMessage::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required uint64 view = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_view(&has_bits);
+          _impl_.view_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required uint32 replicaIdx = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _Internal::set_has_replicaidx(&has_bits);
+          _impl_.replicaidx_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required uint64 lastCommitted = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _Internal::set_has_lastcommitted(&has_bits);
+          _impl_.lastcommitted_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* StartViewChangeMessage::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:dsnet.vr.proto.StartViewChangeMessage)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required uint64 view = 1;
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(1, this->_internal_view(), target);
+  }
+
+  // required uint32 replicaIdx = 2;
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(2, this->_internal_replicaidx(), target);
+  }
+
+  // required uint64 lastCommitted = 3;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(3, this->_internal_lastcommitted(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:dsnet.vr.proto.StartViewChangeMessage)
+  return target;
+}
+
+size_t StartViewChangeMessage::RequiredFieldsByteSizeFallback() const {
+// @@protoc_insertion_point(required_fields_byte_size_fallback_start:dsnet.vr.proto.StartViewChangeMessage)
+  size_t total_size = 0;
+
+  if (_internal_has_view()) {
+    // required uint64 view = 1;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_view());
+  }
+
+  if (_internal_has_lastcommitted()) {
+    // required uint64 lastCommitted = 3;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_lastcommitted());
+  }
+
+  if (_internal_has_replicaidx()) {
+    // required uint32 replicaIdx = 2;
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_replicaidx());
+  }
+
+  return total_size;
+}
+size_t StartViewChangeMessage::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:dsnet.vr.proto.StartViewChangeMessage)
+  size_t total_size = 0;
+
+  if (((_impl_._has_bits_[0] & 0x00000007) ^ 0x00000007) == 0) {  // All required fields are present.
+    // required uint64 view = 1;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_view());
+
+    // required uint64 lastCommitted = 3;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_lastcommitted());
+
+    // required uint32 replicaIdx = 2;
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_replicaidx());
+
+  } else {
+    total_size += RequiredFieldsByteSizeFallback();
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData StartViewChangeMessage::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    StartViewChangeMessage::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*StartViewChangeMessage::GetClassData() const { return &_class_data_; }
+
+
+void StartViewChangeMessage::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<StartViewChangeMessage*>(&to_msg);
+  auto& from = static_cast<const StartViewChangeMessage&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:dsnet.vr.proto.StartViewChangeMessage)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_impl_.view_ = from._impl_.view_;
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.lastcommitted_ = from._impl_.lastcommitted_;
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.replicaidx_ = from._impl_.replicaidx_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void StartViewChangeMessage::CopyFrom(const StartViewChangeMessage& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:dsnet.vr.proto.StartViewChangeMessage)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool StartViewChangeMessage::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  return true;
+}
+
+void StartViewChangeMessage::InternalSwap(StartViewChangeMessage* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(StartViewChangeMessage, _impl_.replicaidx_)
+      + sizeof(StartViewChangeMessage::_impl_.replicaidx_)
+      - PROTOBUF_FIELD_OFFSET(StartViewChangeMessage, _impl_.view_)>(
+          reinterpret_cast<char*>(&_impl_.view_),
+          reinterpret_cast<char*>(&other->_impl_.view_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata StartViewChangeMessage::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_replication_2fvr_2fvr_2dproto_2eproto_getter, &descriptor_table_replication_2fvr_2fvr_2dproto_2eproto_once,
+      file_level_metadata_replication_2fvr_2fvr_2dproto_2eproto[10]);
+}
+
+// ===================================================================
+
+class DoViewChangeMessage::_Internal {
+ public:
+  using HasBits = decltype(std::declval<DoViewChangeMessage>()._impl_._has_bits_);
+  static void set_has_view(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_lastnormalview(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_lastop(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static void set_has_lastcommitted(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+  static void set_has_replicaidx(HasBits* has_bits) {
+    (*has_bits)[0] |= 16u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x0000001f) ^ 0x0000001f) != 0;
+  }
+};
+
+void DoViewChangeMessage::clear_entries() {
+  _impl_.entries_.Clear();
+}
+DoViewChangeMessage::DoViewChangeMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:dsnet.vr.proto.DoViewChangeMessage)
+}
+DoViewChangeMessage::DoViewChangeMessage(const DoViewChangeMessage& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  DoViewChangeMessage* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.entries_){from._impl_.entries_}
+    , decltype(_impl_.view_){}
+    , decltype(_impl_.lastnormalview_){}
+    , decltype(_impl_.lastop_){}
+    , decltype(_impl_.lastcommitted_){}
+    , decltype(_impl_.replicaidx_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.view_, &from._impl_.view_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.replicaidx_) -
+    reinterpret_cast<char*>(&_impl_.view_)) + sizeof(_impl_.replicaidx_));
+  // @@protoc_insertion_point(copy_constructor:dsnet.vr.proto.DoViewChangeMessage)
+}
+
+inline void DoViewChangeMessage::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.entries_){arena}
+    , decltype(_impl_.view_){uint64_t{0u}}
+    , decltype(_impl_.lastnormalview_){uint64_t{0u}}
+    , decltype(_impl_.lastop_){uint64_t{0u}}
+    , decltype(_impl_.lastcommitted_){uint64_t{0u}}
+    , decltype(_impl_.replicaidx_){0u}
+  };
+}
+
+DoViewChangeMessage::~DoViewChangeMessage() {
+  // @@protoc_insertion_point(destructor:dsnet.vr.proto.DoViewChangeMessage)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void DoViewChangeMessage::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.entries_.~RepeatedPtrField();
+}
+
+void DoViewChangeMessage::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void DoViewChangeMessage::Clear() {
+// @@protoc_insertion_point(message_clear_start:dsnet.vr.proto.DoViewChangeMessage)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.entries_.Clear();
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000001fu) {
+    ::memset(&_impl_.view_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.replicaidx_) -
+        reinterpret_cast<char*>(&_impl_.view_)) + sizeof(_impl_.replicaidx_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* DoViewChangeMessage::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required uint64 view = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_view(&has_bits);
+          _impl_.view_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required uint64 lastNormalView = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _Internal::set_has_lastnormalview(&has_bits);
+          _impl_.lastnormalview_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required uint64 lastOp = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _Internal::set_has_lastop(&has_bits);
+          _impl_.lastop_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required uint64 lastCommitted = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _Internal::set_has_lastcommitted(&has_bits);
+          _impl_.lastcommitted_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .dsnet.MsgLogEntry entries = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 42)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_entries(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<42>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // required uint32 replicaIdx = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 48)) {
+          _Internal::set_has_replicaidx(&has_bits);
+          _impl_.replicaidx_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* DoViewChangeMessage::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:dsnet.vr.proto.DoViewChangeMessage)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required uint64 view = 1;
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(1, this->_internal_view(), target);
+  }
+
+  // required uint64 lastNormalView = 2;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(2, this->_internal_lastnormalview(), target);
+  }
+
+  // required uint64 lastOp = 3;
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(3, this->_internal_lastop(), target);
+  }
+
+  // required uint64 lastCommitted = 4;
+  if (cached_has_bits & 0x00000008u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(4, this->_internal_lastcommitted(), target);
+  }
+
+  // repeated .dsnet.MsgLogEntry entries = 5;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_entries_size()); i < n; i++) {
+    const auto& repfield = this->_internal_entries(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(5, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  // required uint32 replicaIdx = 6;
+  if (cached_has_bits & 0x00000010u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(6, this->_internal_replicaidx(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:dsnet.vr.proto.DoViewChangeMessage)
+  return target;
+}
+
+size_t DoViewChangeMessage::RequiredFieldsByteSizeFallback() const {
+// @@protoc_insertion_point(required_fields_byte_size_fallback_start:dsnet.vr.proto.DoViewChangeMessage)
+  size_t total_size = 0;
+
+  if (_internal_has_view()) {
+    // required uint64 view = 1;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_view());
+  }
+
+  if (_internal_has_lastnormalview()) {
+    // required uint64 lastNormalView = 2;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_lastnormalview());
+  }
+
+  if (_internal_has_lastop()) {
+    // required uint64 lastOp = 3;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_lastop());
+  }
+
+  if (_internal_has_lastcommitted()) {
+    // required uint64 lastCommitted = 4;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_lastcommitted());
+  }
+
+  if (_internal_has_replicaidx()) {
+    // required uint32 replicaIdx = 6;
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_replicaidx());
+  }
+
+  return total_size;
+}
+size_t DoViewChangeMessage::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:dsnet.vr.proto.DoViewChangeMessage)
+  size_t total_size = 0;
+
+  if (((_impl_._has_bits_[0] & 0x0000001f) ^ 0x0000001f) == 0) {  // All required fields are present.
+    // required uint64 view = 1;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_view());
+
+    // required uint64 lastNormalView = 2;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_lastnormalview());
+
+    // required uint64 lastOp = 3;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_lastop());
+
+    // required uint64 lastCommitted = 4;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_lastcommitted());
+
+    // required uint32 replicaIdx = 6;
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_replicaidx());
+
+  } else {
+    total_size += RequiredFieldsByteSizeFallback();
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .dsnet.MsgLogEntry entries = 5;
+  total_size += 1UL * this->_internal_entries_size();
+  for (const auto& msg : this->_impl_.entries_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData DoViewChangeMessage::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    DoViewChangeMessage::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*DoViewChangeMessage::GetClassData() const { return &_class_data_; }
+
+
+void DoViewChangeMessage::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<DoViewChangeMessage*>(&to_msg);
+  auto& from = static_cast<const DoViewChangeMessage&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:dsnet.vr.proto.DoViewChangeMessage)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.entries_.MergeFrom(from._impl_.entries_);
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000001fu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_impl_.view_ = from._impl_.view_;
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.lastnormalview_ = from._impl_.lastnormalview_;
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.lastop_ = from._impl_.lastop_;
+    }
+    if (cached_has_bits & 0x00000008u) {
+      _this->_impl_.lastcommitted_ = from._impl_.lastcommitted_;
+    }
+    if (cached_has_bits & 0x00000010u) {
+      _this->_impl_.replicaidx_ = from._impl_.replicaidx_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void DoViewChangeMessage::CopyFrom(const DoViewChangeMessage& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:dsnet.vr.proto.DoViewChangeMessage)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool DoViewChangeMessage::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  if (!::PROTOBUF_NAMESPACE_ID::internal::AllAreInitialized(_impl_.entries_))
+    return false;
+  return true;
+}
+
+void DoViewChangeMessage::InternalSwap(DoViewChangeMessage* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  _impl_.entries_.InternalSwap(&other->_impl_.entries_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(DoViewChangeMessage, _impl_.replicaidx_)
+      + sizeof(DoViewChangeMessage::_impl_.replicaidx_)
+      - PROTOBUF_FIELD_OFFSET(DoViewChangeMessage, _impl_.view_)>(
+          reinterpret_cast<char*>(&_impl_.view_),
+          reinterpret_cast<char*>(&other->_impl_.view_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata DoViewChangeMessage::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_replication_2fvr_2fvr_2dproto_2eproto_getter, &descriptor_table_replication_2fvr_2fvr_2dproto_2eproto_once,
+      file_level_metadata_replication_2fvr_2fvr_2dproto_2eproto[11]);
+}
+
+// ===================================================================
+
+class StartViewMessage::_Internal {
+ public:
+  using HasBits = decltype(std::declval<StartViewMessage>()._impl_._has_bits_);
+  static void set_has_view(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_lastop(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_lastcommitted(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000007) ^ 0x00000007) != 0;
+  }
+};
+
+void StartViewMessage::clear_entries() {
+  _impl_.entries_.Clear();
+}
+StartViewMessage::StartViewMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:dsnet.vr.proto.StartViewMessage)
+}
+StartViewMessage::StartViewMessage(const StartViewMessage& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  StartViewMessage* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.entries_){from._impl_.entries_}
+    , decltype(_impl_.view_){}
+    , decltype(_impl_.lastop_){}
+    , decltype(_impl_.lastcommitted_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.view_, &from._impl_.view_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.lastcommitted_) -
+    reinterpret_cast<char*>(&_impl_.view_)) + sizeof(_impl_.lastcommitted_));
+  // @@protoc_insertion_point(copy_constructor:dsnet.vr.proto.StartViewMessage)
+}
+
+inline void StartViewMessage::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.entries_){arena}
+    , decltype(_impl_.view_){uint64_t{0u}}
+    , decltype(_impl_.lastop_){uint64_t{0u}}
+    , decltype(_impl_.lastcommitted_){uint64_t{0u}}
+  };
+}
+
+StartViewMessage::~StartViewMessage() {
+  // @@protoc_insertion_point(destructor:dsnet.vr.proto.StartViewMessage)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void StartViewMessage::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.entries_.~RepeatedPtrField();
+}
+
+void StartViewMessage::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void StartViewMessage::Clear() {
+// @@protoc_insertion_point(message_clear_start:dsnet.vr.proto.StartViewMessage)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.entries_.Clear();
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    ::memset(&_impl_.view_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.lastcommitted_) -
+        reinterpret_cast<char*>(&_impl_.view_)) + sizeof(_impl_.lastcommitted_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* StartViewMessage::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required uint64 view = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_view(&has_bits);
+          _impl_.view_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required uint64 lastOp = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _Internal::set_has_lastop(&has_bits);
+          _impl_.lastop_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required uint64 lastCommitted = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _Internal::set_has_lastcommitted(&has_bits);
+          _impl_.lastcommitted_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .dsnet.MsgLogEntry entries = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_entries(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<34>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* StartViewMessage::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:dsnet.vr.proto.StartViewMessage)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required uint64 view = 1;
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(1, this->_internal_view(), target);
+  }
+
+  // required uint64 lastOp = 2;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(2, this->_internal_lastop(), target);
+  }
+
+  // required uint64 lastCommitted = 3;
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(3, this->_internal_lastcommitted(), target);
+  }
+
+  // repeated .dsnet.MsgLogEntry entries = 4;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_entries_size()); i < n; i++) {
+    const auto& repfield = this->_internal_entries(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(4, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:dsnet.vr.proto.StartViewMessage)
+  return target;
+}
+
+size_t StartViewMessage::RequiredFieldsByteSizeFallback() const {
+// @@protoc_insertion_point(required_fields_byte_size_fallback_start:dsnet.vr.proto.StartViewMessage)
+  size_t total_size = 0;
+
+  if (_internal_has_view()) {
+    // required uint64 view = 1;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_view());
+  }
+
+  if (_internal_has_lastop()) {
+    // required uint64 lastOp = 2;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_lastop());
+  }
+
+  if (_internal_has_lastcommitted()) {
+    // required uint64 lastCommitted = 3;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_lastcommitted());
+  }
+
+  return total_size;
+}
+size_t StartViewMessage::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:dsnet.vr.proto.StartViewMessage)
+  size_t total_size = 0;
+
+  if (((_impl_._has_bits_[0] & 0x00000007) ^ 0x00000007) == 0) {  // All required fields are present.
+    // required uint64 view = 1;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_view());
+
+    // required uint64 lastOp = 2;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_lastop());
+
+    // required uint64 lastCommitted = 3;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_lastcommitted());
+
+  } else {
+    total_size += RequiredFieldsByteSizeFallback();
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .dsnet.MsgLogEntry entries = 4;
+  total_size += 1UL * this->_internal_entries_size();
+  for (const auto& msg : this->_impl_.entries_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData StartViewMessage::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    StartViewMessage::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*StartViewMessage::GetClassData() const { return &_class_data_; }
+
+
+void StartViewMessage::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<StartViewMessage*>(&to_msg);
+  auto& from = static_cast<const StartViewMessage&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:dsnet.vr.proto.StartViewMessage)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.entries_.MergeFrom(from._impl_.entries_);
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_impl_.view_ = from._impl_.view_;
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.lastop_ = from._impl_.lastop_;
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.lastcommitted_ = from._impl_.lastcommitted_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void StartViewMessage::CopyFrom(const StartViewMessage& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:dsnet.vr.proto.StartViewMessage)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool StartViewMessage::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  if (!::PROTOBUF_NAMESPACE_ID::internal::AllAreInitialized(_impl_.entries_))
+    return false;
+  return true;
+}
+
+void StartViewMessage::InternalSwap(StartViewMessage* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  _impl_.entries_.InternalSwap(&other->_impl_.entries_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(StartViewMessage, _impl_.lastcommitted_)
+      + sizeof(StartViewMessage::_impl_.lastcommitted_)
+      - PROTOBUF_FIELD_OFFSET(StartViewMessage, _impl_.view_)>(
+          reinterpret_cast<char*>(&_impl_.view_),
+          reinterpret_cast<char*>(&other->_impl_.view_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata StartViewMessage::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_replication_2fvr_2fvr_2dproto_2eproto_getter, &descriptor_table_replication_2fvr_2fvr_2dproto_2eproto_once,
+      file_level_metadata_replication_2fvr_2fvr_2dproto_2eproto[12]);
+}
+
+// ===================================================================
+
+class RecoveryMessage::_Internal {
+ public:
+  using HasBits = decltype(std::declval<RecoveryMessage>()._impl_._has_bits_);
+  static void set_has_replicaidx(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_nonce(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000003) ^ 0x00000003) != 0;
+  }
+};
+
+RecoveryMessage::RecoveryMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:dsnet.vr.proto.RecoveryMessage)
+}
+RecoveryMessage::RecoveryMessage(const RecoveryMessage& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  RecoveryMessage* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.nonce_){}
+    , decltype(_impl_.replicaidx_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.nonce_, &from._impl_.nonce_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.replicaidx_) -
+    reinterpret_cast<char*>(&_impl_.nonce_)) + sizeof(_impl_.replicaidx_));
+  // @@protoc_insertion_point(copy_constructor:dsnet.vr.proto.RecoveryMessage)
+}
+
+inline void RecoveryMessage::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.nonce_){uint64_t{0u}}
+    , decltype(_impl_.replicaidx_){0u}
+  };
+}
+
+RecoveryMessage::~RecoveryMessage() {
+  // @@protoc_insertion_point(destructor:dsnet.vr.proto.RecoveryMessage)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void RecoveryMessage::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void RecoveryMessage::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void RecoveryMessage::Clear() {
+// @@protoc_insertion_point(message_clear_start:dsnet.vr.proto.RecoveryMessage)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    ::memset(&_impl_.nonce_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.replicaidx_) -
+        reinterpret_cast<char*>(&_impl_.nonce_)) + sizeof(_impl_.replicaidx_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* RecoveryMessage::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required uint32 replicaIdx = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_replicaidx(&has_bits);
+          _impl_.replicaidx_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required uint64 nonce = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _Internal::set_has_nonce(&has_bits);
+          _impl_.nonce_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* RecoveryMessage::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:dsnet.vr.proto.RecoveryMessage)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required uint32 replicaIdx = 1;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(1, this->_internal_replicaidx(), target);
+  }
+
+  // required uint64 nonce = 2;
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(2, this->_internal_nonce(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:dsnet.vr.proto.RecoveryMessage)
+  return target;
+}
+
+size_t RecoveryMessage::RequiredFieldsByteSizeFallback() const {
+// @@protoc_insertion_point(required_fields_byte_size_fallback_start:dsnet.vr.proto.RecoveryMessage)
+  size_t total_size = 0;
+
+  if (_internal_has_nonce()) {
+    // required uint64 nonce = 2;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_nonce());
+  }
+
+  if (_internal_has_replicaidx()) {
+    // required uint32 replicaIdx = 1;
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_replicaidx());
+  }
+
+  return total_size;
+}
+size_t RecoveryMessage::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:dsnet.vr.proto.RecoveryMessage)
+  size_t total_size = 0;
+
+  if (((_impl_._has_bits_[0] & 0x00000003) ^ 0x00000003) == 0) {  // All required fields are present.
+    // required uint64 nonce = 2;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_nonce());
+
+    // required uint32 replicaIdx = 1;
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_replicaidx());
+
+  } else {
+    total_size += RequiredFieldsByteSizeFallback();
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData RecoveryMessage::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    RecoveryMessage::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*RecoveryMessage::GetClassData() const { return &_class_data_; }
+
+
+void RecoveryMessage::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<RecoveryMessage*>(&to_msg);
+  auto& from = static_cast<const RecoveryMessage&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:dsnet.vr.proto.RecoveryMessage)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_impl_.nonce_ = from._impl_.nonce_;
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.replicaidx_ = from._impl_.replicaidx_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void RecoveryMessage::CopyFrom(const RecoveryMessage& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:dsnet.vr.proto.RecoveryMessage)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool RecoveryMessage::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  return true;
+}
+
+void RecoveryMessage::InternalSwap(RecoveryMessage* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(RecoveryMessage, _impl_.replicaidx_)
+      + sizeof(RecoveryMessage::_impl_.replicaidx_)
+      - PROTOBUF_FIELD_OFFSET(RecoveryMessage, _impl_.nonce_)>(
+          reinterpret_cast<char*>(&_impl_.nonce_),
+          reinterpret_cast<char*>(&other->_impl_.nonce_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata RecoveryMessage::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_replication_2fvr_2fvr_2dproto_2eproto_getter, &descriptor_table_replication_2fvr_2fvr_2dproto_2eproto_once,
+      file_level_metadata_replication_2fvr_2fvr_2dproto_2eproto[13]);
+}
+
+// ===================================================================
+
+class RecoveryResponseMessage::_Internal {
+ public:
+  using HasBits = decltype(std::declval<RecoveryResponseMessage>()._impl_._has_bits_);
+  static void set_has_view(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_nonce(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_lastop(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static void set_has_lastcommitted(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+  static void set_has_replicaidx(HasBits* has_bits) {
+    (*has_bits)[0] |= 16u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000013) ^ 0x00000013) != 0;
+  }
+};
+
+void RecoveryResponseMessage::clear_entries() {
+  _impl_.entries_.Clear();
+}
+RecoveryResponseMessage::RecoveryResponseMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:dsnet.vr.proto.RecoveryResponseMessage)
+}
+RecoveryResponseMessage::RecoveryResponseMessage(const RecoveryResponseMessage& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  RecoveryResponseMessage* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.entries_){from._impl_.entries_}
+    , decltype(_impl_.view_){}
+    , decltype(_impl_.nonce_){}
+    , decltype(_impl_.lastop_){}
+    , decltype(_impl_.lastcommitted_){}
+    , decltype(_impl_.replicaidx_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.view_, &from._impl_.view_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.replicaidx_) -
+    reinterpret_cast<char*>(&_impl_.view_)) + sizeof(_impl_.replicaidx_));
+  // @@protoc_insertion_point(copy_constructor:dsnet.vr.proto.RecoveryResponseMessage)
+}
+
+inline void RecoveryResponseMessage::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.entries_){arena}
+    , decltype(_impl_.view_){uint64_t{0u}}
+    , decltype(_impl_.nonce_){uint64_t{0u}}
+    , decltype(_impl_.lastop_){uint64_t{0u}}
+    , decltype(_impl_.lastcommitted_){uint64_t{0u}}
+    , decltype(_impl_.replicaidx_){0u}
+  };
+}
+
+RecoveryResponseMessage::~RecoveryResponseMessage() {
+  // @@protoc_insertion_point(destructor:dsnet.vr.proto.RecoveryResponseMessage)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void RecoveryResponseMessage::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.entries_.~RepeatedPtrField();
+}
+
+void RecoveryResponseMessage::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void RecoveryResponseMessage::Clear() {
+// @@protoc_insertion_point(message_clear_start:dsnet.vr.proto.RecoveryResponseMessage)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.entries_.Clear();
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000001fu) {
+    ::memset(&_impl_.view_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.replicaidx_) -
+        reinterpret_cast<char*>(&_impl_.view_)) + sizeof(_impl_.replicaidx_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* RecoveryResponseMessage::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required uint64 view = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_view(&has_bits);
+          _impl_.view_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required uint64 nonce = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _Internal::set_has_nonce(&has_bits);
+          _impl_.nonce_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .dsnet.MsgLogEntry entries = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_entries(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<26>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint64 lastOp = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _Internal::set_has_lastop(&has_bits);
+          _impl_.lastop_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint64 lastCommitted = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          _Internal::set_has_lastcommitted(&has_bits);
+          _impl_.lastcommitted_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required uint32 replicaIdx = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 48)) {
+          _Internal::set_has_replicaidx(&has_bits);
+          _impl_.replicaidx_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* RecoveryResponseMessage::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:dsnet.vr.proto.RecoveryResponseMessage)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required uint64 view = 1;
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(1, this->_internal_view(), target);
+  }
+
+  // required uint64 nonce = 2;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(2, this->_internal_nonce(), target);
+  }
+
+  // repeated .dsnet.MsgLogEntry entries = 3;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_entries_size()); i < n; i++) {
+    const auto& repfield = this->_internal_entries(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(3, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  // optional uint64 lastOp = 4;
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(4, this->_internal_lastop(), target);
+  }
+
+  // optional uint64 lastCommitted = 5;
+  if (cached_has_bits & 0x00000008u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(5, this->_internal_lastcommitted(), target);
+  }
+
+  // required uint32 replicaIdx = 6;
+  if (cached_has_bits & 0x00000010u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(6, this->_internal_replicaidx(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:dsnet.vr.proto.RecoveryResponseMessage)
+  return target;
+}
+
+size_t RecoveryResponseMessage::RequiredFieldsByteSizeFallback() const {
+// @@protoc_insertion_point(required_fields_byte_size_fallback_start:dsnet.vr.proto.RecoveryResponseMessage)
+  size_t total_size = 0;
+
+  if (_internal_has_view()) {
+    // required uint64 view = 1;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_view());
+  }
+
+  if (_internal_has_nonce()) {
+    // required uint64 nonce = 2;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_nonce());
+  }
+
+  if (_internal_has_replicaidx()) {
+    // required uint32 replicaIdx = 6;
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_replicaidx());
+  }
+
+  return total_size;
+}
+size_t RecoveryResponseMessage::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:dsnet.vr.proto.RecoveryResponseMessage)
+  size_t total_size = 0;
+
+  if (((_impl_._has_bits_[0] & 0x00000013) ^ 0x00000013) == 0) {  // All required fields are present.
+    // required uint64 view = 1;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_view());
+
+    // required uint64 nonce = 2;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_nonce());
+
+    // required uint32 replicaIdx = 6;
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_replicaidx());
+
+  } else {
+    total_size += RequiredFieldsByteSizeFallback();
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .dsnet.MsgLogEntry entries = 3;
+  total_size += 1UL * this->_internal_entries_size();
+  for (const auto& msg : this->_impl_.entries_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000000cu) {
+    // optional uint64 lastOp = 4;
+    if (cached_has_bits & 0x00000004u) {
+      total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_lastop());
+    }
+
+    // optional uint64 lastCommitted = 5;
+    if (cached_has_bits & 0x00000008u) {
+      total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_lastcommitted());
+    }
+
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData RecoveryResponseMessage::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    RecoveryResponseMessage::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*RecoveryResponseMessage::GetClassData() const { return &_class_data_; }
+
+
+void RecoveryResponseMessage::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<RecoveryResponseMessage*>(&to_msg);
+  auto& from = static_cast<const RecoveryResponseMessage&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:dsnet.vr.proto.RecoveryResponseMessage)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.entries_.MergeFrom(from._impl_.entries_);
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000001fu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_impl_.view_ = from._impl_.view_;
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.nonce_ = from._impl_.nonce_;
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.lastop_ = from._impl_.lastop_;
+    }
+    if (cached_has_bits & 0x00000008u) {
+      _this->_impl_.lastcommitted_ = from._impl_.lastcommitted_;
+    }
+    if (cached_has_bits & 0x00000010u) {
+      _this->_impl_.replicaidx_ = from._impl_.replicaidx_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void RecoveryResponseMessage::CopyFrom(const RecoveryResponseMessage& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:dsnet.vr.proto.RecoveryResponseMessage)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool RecoveryResponseMessage::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  if (!::PROTOBUF_NAMESPACE_ID::internal::AllAreInitialized(_impl_.entries_))
+    return false;
+  return true;
+}
+
+void RecoveryResponseMessage::InternalSwap(RecoveryResponseMessage* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  _impl_.entries_.InternalSwap(&other->_impl_.entries_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(RecoveryResponseMessage, _impl_.replicaidx_)
+      + sizeof(RecoveryResponseMessage::_impl_.replicaidx_)
+      - PROTOBUF_FIELD_OFFSET(RecoveryResponseMessage, _impl_.view_)>(
+          reinterpret_cast<char*>(&_impl_.view_),
+          reinterpret_cast<char*>(&other->_impl_.view_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata RecoveryResponseMessage::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_replication_2fvr_2fvr_2dproto_2eproto_getter, &descriptor_table_replication_2fvr_2fvr_2dproto_2eproto_once,
+      file_level_metadata_replication_2fvr_2fvr_2dproto_2eproto[14]);
+}
+
+// ===================================================================
+
+class ToReplicaMessage::_Internal {
+ public:
+  static const ::dsnet::vr::proto::RequestMessage& request(const ToReplicaMessage* msg);
+  static const ::dsnet::vr::proto::UnloggedRequestMessage& unlogged_request(const ToReplicaMessage* msg);
+  static const ::dsnet::vr::proto::PrepareMessage& prepare(const ToReplicaMessage* msg);
+  static const ::dsnet::vr::proto::PrepareOKMessage& prepare_ok(const ToReplicaMessage* msg);
+  static const ::dsnet::vr::proto::CommitMessage& commit(const ToReplicaMessage* msg);
+  static const ::dsnet::vr::proto::RequestStateTransferMessage& request_state_transfer(const ToReplicaMessage* msg);
+  static const ::dsnet::vr::proto::StateTransferMessage& state_transfer(const ToReplicaMessage* msg);
+  static const ::dsnet::vr::proto::StartViewChangeMessage& start_view_change(const ToReplicaMessage* msg);
+  static const ::dsnet::vr::proto::DoViewChangeMessage& do_view_change(const ToReplicaMessage* msg);
+  static const ::dsnet::vr::proto::StartViewMessage& start_view(const ToReplicaMessage* msg);
+  static const ::dsnet::vr::proto::RecoveryMessage& recovery(const ToReplicaMessage* msg);
+  static const ::dsnet::vr::proto::RecoveryResponseMessage& recovery_response(const ToReplicaMessage* msg);
+};
+
+const ::dsnet::vr::proto::RequestMessage&
+ToReplicaMessage::_Internal::request(const ToReplicaMessage* msg) {
+  return *msg->_impl_.msg_.request_;
+}
+const ::dsnet::vr::proto::UnloggedRequestMessage&
+ToReplicaMessage::_Internal::unlogged_request(const ToReplicaMessage* msg) {
+  return *msg->_impl_.msg_.unlogged_request_;
+}
+const ::dsnet::vr::proto::PrepareMessage&
+ToReplicaMessage::_Internal::prepare(const ToReplicaMessage* msg) {
+  return *msg->_impl_.msg_.prepare_;
+}
+const ::dsnet::vr::proto::PrepareOKMessage&
+ToReplicaMessage::_Internal::prepare_ok(const ToReplicaMessage* msg) {
+  return *msg->_impl_.msg_.prepare_ok_;
+}
+const ::dsnet::vr::proto::CommitMessage&
+ToReplicaMessage::_Internal::commit(const ToReplicaMessage* msg) {
+  return *msg->_impl_.msg_.commit_;
+}
+const ::dsnet::vr::proto::RequestStateTransferMessage&
+ToReplicaMessage::_Internal::request_state_transfer(const ToReplicaMessage* msg) {
+  return *msg->_impl_.msg_.request_state_transfer_;
+}
+const ::dsnet::vr::proto::StateTransferMessage&
+ToReplicaMessage::_Internal::state_transfer(const ToReplicaMessage* msg) {
+  return *msg->_impl_.msg_.state_transfer_;
+}
+const ::dsnet::vr::proto::StartViewChangeMessage&
+ToReplicaMessage::_Internal::start_view_change(const ToReplicaMessage* msg) {
+  return *msg->_impl_.msg_.start_view_change_;
+}
+const ::dsnet::vr::proto::DoViewChangeMessage&
+ToReplicaMessage::_Internal::do_view_change(const ToReplicaMessage* msg) {
+  return *msg->_impl_.msg_.do_view_change_;
+}
+const ::dsnet::vr::proto::StartViewMessage&
+ToReplicaMessage::_Internal::start_view(const ToReplicaMessage* msg) {
+  return *msg->_impl_.msg_.start_view_;
+}
+const ::dsnet::vr::proto::RecoveryMessage&
+ToReplicaMessage::_Internal::recovery(const ToReplicaMessage* msg) {
+  return *msg->_impl_.msg_.recovery_;
+}
+const ::dsnet::vr::proto::RecoveryResponseMessage&
+ToReplicaMessage::_Internal::recovery_response(const ToReplicaMessage* msg) {
+  return *msg->_impl_.msg_.recovery_response_;
+}
+void ToReplicaMessage::set_allocated_request(::dsnet::vr::proto::RequestMessage* request) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  clear_msg();
+  if (request) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(request);
+    if (message_arena != submessage_arena) {
+      request = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, request, submessage_arena);
+    }
+    set_has_request();
+    _impl_.msg_.request_ = request;
+  }
+  // @@protoc_insertion_point(field_set_allocated:dsnet.vr.proto.ToReplicaMessage.request)
+}
+void ToReplicaMessage::set_allocated_unlogged_request(::dsnet::vr::proto::UnloggedRequestMessage* unlogged_request) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  clear_msg();
+  if (unlogged_request) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(unlogged_request);
+    if (message_arena != submessage_arena) {
+      unlogged_request = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, unlogged_request, submessage_arena);
+    }
+    set_has_unlogged_request();
+    _impl_.msg_.unlogged_request_ = unlogged_request;
+  }
+  // @@protoc_insertion_point(field_set_allocated:dsnet.vr.proto.ToReplicaMessage.unlogged_request)
+}
+void ToReplicaMessage::set_allocated_prepare(::dsnet::vr::proto::PrepareMessage* prepare) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  clear_msg();
+  if (prepare) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(prepare);
+    if (message_arena != submessage_arena) {
+      prepare = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, prepare, submessage_arena);
+    }
+    set_has_prepare();
+    _impl_.msg_.prepare_ = prepare;
+  }
+  // @@protoc_insertion_point(field_set_allocated:dsnet.vr.proto.ToReplicaMessage.prepare)
+}
+void ToReplicaMessage::set_allocated_prepare_ok(::dsnet::vr::proto::PrepareOKMessage* prepare_ok) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  clear_msg();
+  if (prepare_ok) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(prepare_ok);
+    if (message_arena != submessage_arena) {
+      prepare_ok = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, prepare_ok, submessage_arena);
+    }
+    set_has_prepare_ok();
+    _impl_.msg_.prepare_ok_ = prepare_ok;
+  }
+  // @@protoc_insertion_point(field_set_allocated:dsnet.vr.proto.ToReplicaMessage.prepare_ok)
+}
+void ToReplicaMessage::set_allocated_commit(::dsnet::vr::proto::CommitMessage* commit) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  clear_msg();
+  if (commit) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(commit);
+    if (message_arena != submessage_arena) {
+      commit = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, commit, submessage_arena);
+    }
+    set_has_commit();
+    _impl_.msg_.commit_ = commit;
+  }
+  // @@protoc_insertion_point(field_set_allocated:dsnet.vr.proto.ToReplicaMessage.commit)
+}
+void ToReplicaMessage::set_allocated_request_state_transfer(::dsnet::vr::proto::RequestStateTransferMessage* request_state_transfer) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  clear_msg();
+  if (request_state_transfer) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(request_state_transfer);
+    if (message_arena != submessage_arena) {
+      request_state_transfer = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, request_state_transfer, submessage_arena);
+    }
+    set_has_request_state_transfer();
+    _impl_.msg_.request_state_transfer_ = request_state_transfer;
+  }
+  // @@protoc_insertion_point(field_set_allocated:dsnet.vr.proto.ToReplicaMessage.request_state_transfer)
+}
+void ToReplicaMessage::set_allocated_state_transfer(::dsnet::vr::proto::StateTransferMessage* state_transfer) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  clear_msg();
+  if (state_transfer) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(state_transfer);
+    if (message_arena != submessage_arena) {
+      state_transfer = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, state_transfer, submessage_arena);
+    }
+    set_has_state_transfer();
+    _impl_.msg_.state_transfer_ = state_transfer;
+  }
+  // @@protoc_insertion_point(field_set_allocated:dsnet.vr.proto.ToReplicaMessage.state_transfer)
+}
+void ToReplicaMessage::set_allocated_start_view_change(::dsnet::vr::proto::StartViewChangeMessage* start_view_change) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  clear_msg();
+  if (start_view_change) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(start_view_change);
+    if (message_arena != submessage_arena) {
+      start_view_change = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, start_view_change, submessage_arena);
+    }
+    set_has_start_view_change();
+    _impl_.msg_.start_view_change_ = start_view_change;
+  }
+  // @@protoc_insertion_point(field_set_allocated:dsnet.vr.proto.ToReplicaMessage.start_view_change)
+}
+void ToReplicaMessage::set_allocated_do_view_change(::dsnet::vr::proto::DoViewChangeMessage* do_view_change) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  clear_msg();
+  if (do_view_change) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(do_view_change);
+    if (message_arena != submessage_arena) {
+      do_view_change = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, do_view_change, submessage_arena);
+    }
+    set_has_do_view_change();
+    _impl_.msg_.do_view_change_ = do_view_change;
+  }
+  // @@protoc_insertion_point(field_set_allocated:dsnet.vr.proto.ToReplicaMessage.do_view_change)
+}
+void ToReplicaMessage::set_allocated_start_view(::dsnet::vr::proto::StartViewMessage* start_view) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  clear_msg();
+  if (start_view) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(start_view);
+    if (message_arena != submessage_arena) {
+      start_view = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, start_view, submessage_arena);
+    }
+    set_has_start_view();
+    _impl_.msg_.start_view_ = start_view;
+  }
+  // @@protoc_insertion_point(field_set_allocated:dsnet.vr.proto.ToReplicaMessage.start_view)
+}
+void ToReplicaMessage::set_allocated_recovery(::dsnet::vr::proto::RecoveryMessage* recovery) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  clear_msg();
+  if (recovery) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(recovery);
+    if (message_arena != submessage_arena) {
+      recovery = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, recovery, submessage_arena);
+    }
+    set_has_recovery();
+    _impl_.msg_.recovery_ = recovery;
+  }
+  // @@protoc_insertion_point(field_set_allocated:dsnet.vr.proto.ToReplicaMessage.recovery)
+}
+void ToReplicaMessage::set_allocated_recovery_response(::dsnet::vr::proto::RecoveryResponseMessage* recovery_response) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  clear_msg();
+  if (recovery_response) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(recovery_response);
+    if (message_arena != submessage_arena) {
+      recovery_response = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, recovery_response, submessage_arena);
+    }
+    set_has_recovery_response();
+    _impl_.msg_.recovery_response_ = recovery_response;
+  }
+  // @@protoc_insertion_point(field_set_allocated:dsnet.vr.proto.ToReplicaMessage.recovery_response)
+}
+ToReplicaMessage::ToReplicaMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:dsnet.vr.proto.ToReplicaMessage)
+}
+ToReplicaMessage::ToReplicaMessage(const ToReplicaMessage& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  ToReplicaMessage* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.msg_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , /*decltype(_impl_._oneof_case_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  clear_has_msg();
+  switch (from.msg_case()) {
+    case kRequest: {
+      _this->_internal_mutable_request()->::dsnet::vr::proto::RequestMessage::MergeFrom(
+          from._internal_request());
+      break;
+    }
+    case kUnloggedRequest: {
+      _this->_internal_mutable_unlogged_request()->::dsnet::vr::proto::UnloggedRequestMessage::MergeFrom(
+          from._internal_unlogged_request());
+      break;
+    }
+    case kPrepare: {
+      _this->_internal_mutable_prepare()->::dsnet::vr::proto::PrepareMessage::MergeFrom(
+          from._internal_prepare());
+      break;
+    }
+    case kPrepareOk: {
+      _this->_internal_mutable_prepare_ok()->::dsnet::vr::proto::PrepareOKMessage::MergeFrom(
+          from._internal_prepare_ok());
+      break;
+    }
+    case kCommit: {
+      _this->_internal_mutable_commit()->::dsnet::vr::proto::CommitMessage::MergeFrom(
+          from._internal_commit());
+      break;
+    }
+    case kRequestStateTransfer: {
+      _this->_internal_mutable_request_state_transfer()->::dsnet::vr::proto::RequestStateTransferMessage::MergeFrom(
+          from._internal_request_state_transfer());
+      break;
+    }
+    case kStateTransfer: {
+      _this->_internal_mutable_state_transfer()->::dsnet::vr::proto::StateTransferMessage::MergeFrom(
+          from._internal_state_transfer());
+      break;
+    }
+    case kStartViewChange: {
+      _this->_internal_mutable_start_view_change()->::dsnet::vr::proto::StartViewChangeMessage::MergeFrom(
+          from._internal_start_view_change());
+      break;
+    }
+    case kDoViewChange: {
+      _this->_internal_mutable_do_view_change()->::dsnet::vr::proto::DoViewChangeMessage::MergeFrom(
+          from._internal_do_view_change());
+      break;
+    }
+    case kStartView: {
+      _this->_internal_mutable_start_view()->::dsnet::vr::proto::StartViewMessage::MergeFrom(
+          from._internal_start_view());
+      break;
+    }
+    case kRecovery: {
+      _this->_internal_mutable_recovery()->::dsnet::vr::proto::RecoveryMessage::MergeFrom(
+          from._internal_recovery());
+      break;
+    }
+    case kRecoveryResponse: {
+      _this->_internal_mutable_recovery_response()->::dsnet::vr::proto::RecoveryResponseMessage::MergeFrom(
+          from._internal_recovery_response());
+      break;
+    }
+    case MSG_NOT_SET: {
+      break;
+    }
+  }
+  // @@protoc_insertion_point(copy_constructor:dsnet.vr.proto.ToReplicaMessage)
+}
+
+inline void ToReplicaMessage::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.msg_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , /*decltype(_impl_._oneof_case_)*/{}
+  };
+  clear_has_msg();
+}
+
+ToReplicaMessage::~ToReplicaMessage() {
+  // @@protoc_insertion_point(destructor:dsnet.vr.proto.ToReplicaMessage)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void ToReplicaMessage::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  if (has_msg()) {
+    clear_msg();
+  }
+}
+
+void ToReplicaMessage::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void ToReplicaMessage::clear_msg() {
+// @@protoc_insertion_point(one_of_clear_start:dsnet.vr.proto.ToReplicaMessage)
+  switch (msg_case()) {
+    case kRequest: {
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.msg_.request_;
+      }
+      break;
+    }
+    case kUnloggedRequest: {
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.msg_.unlogged_request_;
+      }
+      break;
+    }
+    case kPrepare: {
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.msg_.prepare_;
+      }
+      break;
+    }
+    case kPrepareOk: {
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.msg_.prepare_ok_;
+      }
+      break;
+    }
+    case kCommit: {
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.msg_.commit_;
+      }
+      break;
+    }
+    case kRequestStateTransfer: {
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.msg_.request_state_transfer_;
+      }
+      break;
+    }
+    case kStateTransfer: {
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.msg_.state_transfer_;
+      }
+      break;
+    }
+    case kStartViewChange: {
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.msg_.start_view_change_;
+      }
+      break;
+    }
+    case kDoViewChange: {
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.msg_.do_view_change_;
+      }
+      break;
+    }
+    case kStartView: {
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.msg_.start_view_;
+      }
+      break;
+    }
+    case kRecovery: {
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.msg_.recovery_;
+      }
+      break;
+    }
+    case kRecoveryResponse: {
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.msg_.recovery_response_;
+      }
+      break;
+    }
+    case MSG_NOT_SET: {
+      break;
+    }
+  }
+  _impl_._oneof_case_[0] = MSG_NOT_SET;
+}
+
+
+void ToReplicaMessage::Clear() {
+// @@protoc_insertion_point(message_clear_start:dsnet.vr.proto.ToReplicaMessage)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  clear_msg();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* ToReplicaMessage::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // .dsnet.vr.proto.RequestMessage request = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr = ctx->ParseMessage(_internal_mutable_request(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .dsnet.vr.proto.UnloggedRequestMessage unlogged_request = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr = ctx->ParseMessage(_internal_mutable_unlogged_request(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .dsnet.vr.proto.PrepareMessage prepare = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          ptr = ctx->ParseMessage(_internal_mutable_prepare(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .dsnet.vr.proto.PrepareOKMessage prepare_ok = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          ptr = ctx->ParseMessage(_internal_mutable_prepare_ok(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .dsnet.vr.proto.CommitMessage commit = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 42)) {
+          ptr = ctx->ParseMessage(_internal_mutable_commit(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .dsnet.vr.proto.RequestStateTransferMessage request_state_transfer = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 50)) {
+          ptr = ctx->ParseMessage(_internal_mutable_request_state_transfer(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .dsnet.vr.proto.StateTransferMessage state_transfer = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 58)) {
+          ptr = ctx->ParseMessage(_internal_mutable_state_transfer(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .dsnet.vr.proto.StartViewChangeMessage start_view_change = 8;
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 66)) {
+          ptr = ctx->ParseMessage(_internal_mutable_start_view_change(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .dsnet.vr.proto.DoViewChangeMessage do_view_change = 9;
+      case 9:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 74)) {
+          ptr = ctx->ParseMessage(_internal_mutable_do_view_change(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .dsnet.vr.proto.StartViewMessage start_view = 10;
+      case 10:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 82)) {
+          ptr = ctx->ParseMessage(_internal_mutable_start_view(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .dsnet.vr.proto.RecoveryMessage recovery = 11;
+      case 11:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 90)) {
+          ptr = ctx->ParseMessage(_internal_mutable_recovery(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .dsnet.vr.proto.RecoveryResponseMessage recovery_response = 12;
+      case 12:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 98)) {
+          ptr = ctx->ParseMessage(_internal_mutable_recovery_response(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* ToReplicaMessage::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:dsnet.vr.proto.ToReplicaMessage)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  switch (msg_case()) {
+    case kRequest: {
+      target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(1, _Internal::request(this),
+          _Internal::request(this).GetCachedSize(), target, stream);
+      break;
+    }
+    case kUnloggedRequest: {
+      target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(2, _Internal::unlogged_request(this),
+          _Internal::unlogged_request(this).GetCachedSize(), target, stream);
+      break;
+    }
+    case kPrepare: {
+      target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(3, _Internal::prepare(this),
+          _Internal::prepare(this).GetCachedSize(), target, stream);
+      break;
+    }
+    case kPrepareOk: {
+      target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(4, _Internal::prepare_ok(this),
+          _Internal::prepare_ok(this).GetCachedSize(), target, stream);
+      break;
+    }
+    case kCommit: {
+      target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(5, _Internal::commit(this),
+          _Internal::commit(this).GetCachedSize(), target, stream);
+      break;
+    }
+    case kRequestStateTransfer: {
+      target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(6, _Internal::request_state_transfer(this),
+          _Internal::request_state_transfer(this).GetCachedSize(), target, stream);
+      break;
+    }
+    case kStateTransfer: {
+      target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(7, _Internal::state_transfer(this),
+          _Internal::state_transfer(this).GetCachedSize(), target, stream);
+      break;
+    }
+    case kStartViewChange: {
+      target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(8, _Internal::start_view_change(this),
+          _Internal::start_view_change(this).GetCachedSize(), target, stream);
+      break;
+    }
+    case kDoViewChange: {
+      target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(9, _Internal::do_view_change(this),
+          _Internal::do_view_change(this).GetCachedSize(), target, stream);
+      break;
+    }
+    case kStartView: {
+      target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(10, _Internal::start_view(this),
+          _Internal::start_view(this).GetCachedSize(), target, stream);
+      break;
+    }
+    case kRecovery: {
+      target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(11, _Internal::recovery(this),
+          _Internal::recovery(this).GetCachedSize(), target, stream);
+      break;
+    }
+    case kRecoveryResponse: {
+      target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(12, _Internal::recovery_response(this),
+          _Internal::recovery_response(this).GetCachedSize(), target, stream);
+      break;
+    }
+    default: ;
+  }
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:dsnet.vr.proto.ToReplicaMessage)
+  return target;
+}
+
+size_t ToReplicaMessage::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:dsnet.vr.proto.ToReplicaMessage)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  switch (msg_case()) {
+    // .dsnet.vr.proto.RequestMessage request = 1;
+    case kRequest: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.msg_.request_);
+      break;
+    }
+    // .dsnet.vr.proto.UnloggedRequestMessage unlogged_request = 2;
+    case kUnloggedRequest: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.msg_.unlogged_request_);
+      break;
+    }
+    // .dsnet.vr.proto.PrepareMessage prepare = 3;
+    case kPrepare: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.msg_.prepare_);
+      break;
+    }
+    // .dsnet.vr.proto.PrepareOKMessage prepare_ok = 4;
+    case kPrepareOk: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.msg_.prepare_ok_);
+      break;
+    }
+    // .dsnet.vr.proto.CommitMessage commit = 5;
+    case kCommit: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.msg_.commit_);
+      break;
+    }
+    // .dsnet.vr.proto.RequestStateTransferMessage request_state_transfer = 6;
+    case kRequestStateTransfer: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.msg_.request_state_transfer_);
+      break;
+    }
+    // .dsnet.vr.proto.StateTransferMessage state_transfer = 7;
+    case kStateTransfer: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.msg_.state_transfer_);
+      break;
+    }
+    // .dsnet.vr.proto.StartViewChangeMessage start_view_change = 8;
+    case kStartViewChange: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.msg_.start_view_change_);
+      break;
+    }
+    // .dsnet.vr.proto.DoViewChangeMessage do_view_change = 9;
+    case kDoViewChange: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.msg_.do_view_change_);
+      break;
+    }
+    // .dsnet.vr.proto.StartViewMessage start_view = 10;
+    case kStartView: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.msg_.start_view_);
+      break;
+    }
+    // .dsnet.vr.proto.RecoveryMessage recovery = 11;
+    case kRecovery: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.msg_.recovery_);
+      break;
+    }
+    // .dsnet.vr.proto.RecoveryResponseMessage recovery_response = 12;
+    case kRecoveryResponse: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.msg_.recovery_response_);
+      break;
+    }
+    case MSG_NOT_SET: {
+      break;
+    }
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ToReplicaMessage::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    ToReplicaMessage::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ToReplicaMessage::GetClassData() const { return &_class_data_; }
+
+
+void ToReplicaMessage::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<ToReplicaMessage*>(&to_msg);
+  auto& from = static_cast<const ToReplicaMessage&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:dsnet.vr.proto.ToReplicaMessage)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  switch (from.msg_case()) {
+    case kRequest: {
+      _this->_internal_mutable_request()->::dsnet::vr::proto::RequestMessage::MergeFrom(
+          from._internal_request());
+      break;
+    }
+    case kUnloggedRequest: {
+      _this->_internal_mutable_unlogged_request()->::dsnet::vr::proto::UnloggedRequestMessage::MergeFrom(
+          from._internal_unlogged_request());
+      break;
+    }
+    case kPrepare: {
+      _this->_internal_mutable_prepare()->::dsnet::vr::proto::PrepareMessage::MergeFrom(
+          from._internal_prepare());
+      break;
+    }
+    case kPrepareOk: {
+      _this->_internal_mutable_prepare_ok()->::dsnet::vr::proto::PrepareOKMessage::MergeFrom(
+          from._internal_prepare_ok());
+      break;
+    }
+    case kCommit: {
+      _this->_internal_mutable_commit()->::dsnet::vr::proto::CommitMessage::MergeFrom(
+          from._internal_commit());
+      break;
+    }
+    case kRequestStateTransfer: {
+      _this->_internal_mutable_request_state_transfer()->::dsnet::vr::proto::RequestStateTransferMessage::MergeFrom(
+          from._internal_request_state_transfer());
+      break;
+    }
+    case kStateTransfer: {
+      _this->_internal_mutable_state_transfer()->::dsnet::vr::proto::StateTransferMessage::MergeFrom(
+          from._internal_state_transfer());
+      break;
+    }
+    case kStartViewChange: {
+      _this->_internal_mutable_start_view_change()->::dsnet::vr::proto::StartViewChangeMessage::MergeFrom(
+          from._internal_start_view_change());
+      break;
+    }
+    case kDoViewChange: {
+      _this->_internal_mutable_do_view_change()->::dsnet::vr::proto::DoViewChangeMessage::MergeFrom(
+          from._internal_do_view_change());
+      break;
+    }
+    case kStartView: {
+      _this->_internal_mutable_start_view()->::dsnet::vr::proto::StartViewMessage::MergeFrom(
+          from._internal_start_view());
+      break;
+    }
+    case kRecovery: {
+      _this->_internal_mutable_recovery()->::dsnet::vr::proto::RecoveryMessage::MergeFrom(
+          from._internal_recovery());
+      break;
+    }
+    case kRecoveryResponse: {
+      _this->_internal_mutable_recovery_response()->::dsnet::vr::proto::RecoveryResponseMessage::MergeFrom(
+          from._internal_recovery_response());
+      break;
+    }
+    case MSG_NOT_SET: {
+      break;
+    }
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void ToReplicaMessage::CopyFrom(const ToReplicaMessage& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:dsnet.vr.proto.ToReplicaMessage)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool ToReplicaMessage::IsInitialized() const {
+  switch (msg_case()) {
+    case kRequest: {
+      if (_internal_has_request()) {
+        if (!_impl_.msg_.request_->IsInitialized()) return false;
+      }
+      break;
+    }
+    case kUnloggedRequest: {
+      if (_internal_has_unlogged_request()) {
+        if (!_impl_.msg_.unlogged_request_->IsInitialized()) return false;
+      }
+      break;
+    }
+    case kPrepare: {
+      if (_internal_has_prepare()) {
+        if (!_impl_.msg_.prepare_->IsInitialized()) return false;
+      }
+      break;
+    }
+    case kPrepareOk: {
+      if (_internal_has_prepare_ok()) {
+        if (!_impl_.msg_.prepare_ok_->IsInitialized()) return false;
+      }
+      break;
+    }
+    case kCommit: {
+      if (_internal_has_commit()) {
+        if (!_impl_.msg_.commit_->IsInitialized()) return false;
+      }
+      break;
+    }
+    case kRequestStateTransfer: {
+      if (_internal_has_request_state_transfer()) {
+        if (!_impl_.msg_.request_state_transfer_->IsInitialized()) return false;
+      }
+      break;
+    }
+    case kStateTransfer: {
+      if (_internal_has_state_transfer()) {
+        if (!_impl_.msg_.state_transfer_->IsInitialized()) return false;
+      }
+      break;
+    }
+    case kStartViewChange: {
+      if (_internal_has_start_view_change()) {
+        if (!_impl_.msg_.start_view_change_->IsInitialized()) return false;
+      }
+      break;
+    }
+    case kDoViewChange: {
+      if (_internal_has_do_view_change()) {
+        if (!_impl_.msg_.do_view_change_->IsInitialized()) return false;
+      }
+      break;
+    }
+    case kStartView: {
+      if (_internal_has_start_view()) {
+        if (!_impl_.msg_.start_view_->IsInitialized()) return false;
+      }
+      break;
+    }
+    case kRecovery: {
+      if (_internal_has_recovery()) {
+        if (!_impl_.msg_.recovery_->IsInitialized()) return false;
+      }
+      break;
+    }
+    case kRecoveryResponse: {
+      if (_internal_has_recovery_response()) {
+        if (!_impl_.msg_.recovery_response_->IsInitialized()) return false;
+      }
+      break;
+    }
+    case MSG_NOT_SET: {
+      break;
+    }
+  }
+  return true;
+}
+
+void ToReplicaMessage::InternalSwap(ToReplicaMessage* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_.msg_, other->_impl_.msg_);
+  swap(_impl_._oneof_case_[0], other->_impl_._oneof_case_[0]);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata ToReplicaMessage::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_replication_2fvr_2fvr_2dproto_2eproto_getter, &descriptor_table_replication_2fvr_2fvr_2dproto_2eproto_once,
+      file_level_metadata_replication_2fvr_2fvr_2dproto_2eproto[15]);
+}
+
+// @@protoc_insertion_point(namespace_scope)
+}  // namespace proto
+}  // namespace vr
+}  // namespace dsnet
+PROTOBUF_NAMESPACE_OPEN
+template<> PROTOBUF_NOINLINE ::dsnet::vr::proto::ReplyMessage*
+Arena::CreateMaybeMessage< ::dsnet::vr::proto::ReplyMessage >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::dsnet::vr::proto::ReplyMessage >(arena);
+}
+template<> PROTOBUF_NOINLINE ::dsnet::vr::proto::UnloggedReplyMessage*
+Arena::CreateMaybeMessage< ::dsnet::vr::proto::UnloggedReplyMessage >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::dsnet::vr::proto::UnloggedReplyMessage >(arena);
+}
+template<> PROTOBUF_NOINLINE ::dsnet::vr::proto::ToClientMessage*
+Arena::CreateMaybeMessage< ::dsnet::vr::proto::ToClientMessage >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::dsnet::vr::proto::ToClientMessage >(arena);
+}
+template<> PROTOBUF_NOINLINE ::dsnet::vr::proto::RequestMessage*
+Arena::CreateMaybeMessage< ::dsnet::vr::proto::RequestMessage >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::dsnet::vr::proto::RequestMessage >(arena);
+}
+template<> PROTOBUF_NOINLINE ::dsnet::vr::proto::UnloggedRequestMessage*
+Arena::CreateMaybeMessage< ::dsnet::vr::proto::UnloggedRequestMessage >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::dsnet::vr::proto::UnloggedRequestMessage >(arena);
+}
+template<> PROTOBUF_NOINLINE ::dsnet::vr::proto::PrepareMessage*
+Arena::CreateMaybeMessage< ::dsnet::vr::proto::PrepareMessage >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::dsnet::vr::proto::PrepareMessage >(arena);
+}
+template<> PROTOBUF_NOINLINE ::dsnet::vr::proto::PrepareOKMessage*
+Arena::CreateMaybeMessage< ::dsnet::vr::proto::PrepareOKMessage >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::dsnet::vr::proto::PrepareOKMessage >(arena);
+}
+template<> PROTOBUF_NOINLINE ::dsnet::vr::proto::CommitMessage*
+Arena::CreateMaybeMessage< ::dsnet::vr::proto::CommitMessage >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::dsnet::vr::proto::CommitMessage >(arena);
+}
+template<> PROTOBUF_NOINLINE ::dsnet::vr::proto::RequestStateTransferMessage*
+Arena::CreateMaybeMessage< ::dsnet::vr::proto::RequestStateTransferMessage >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::dsnet::vr::proto::RequestStateTransferMessage >(arena);
+}
+template<> PROTOBUF_NOINLINE ::dsnet::vr::proto::StateTransferMessage*
+Arena::CreateMaybeMessage< ::dsnet::vr::proto::StateTransferMessage >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::dsnet::vr::proto::StateTransferMessage >(arena);
+}
+template<> PROTOBUF_NOINLINE ::dsnet::vr::proto::StartViewChangeMessage*
+Arena::CreateMaybeMessage< ::dsnet::vr::proto::StartViewChangeMessage >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::dsnet::vr::proto::StartViewChangeMessage >(arena);
+}
+template<> PROTOBUF_NOINLINE ::dsnet::vr::proto::DoViewChangeMessage*
+Arena::CreateMaybeMessage< ::dsnet::vr::proto::DoViewChangeMessage >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::dsnet::vr::proto::DoViewChangeMessage >(arena);
+}
+template<> PROTOBUF_NOINLINE ::dsnet::vr::proto::StartViewMessage*
+Arena::CreateMaybeMessage< ::dsnet::vr::proto::StartViewMessage >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::dsnet::vr::proto::StartViewMessage >(arena);
+}
+template<> PROTOBUF_NOINLINE ::dsnet::vr::proto::RecoveryMessage*
+Arena::CreateMaybeMessage< ::dsnet::vr::proto::RecoveryMessage >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::dsnet::vr::proto::RecoveryMessage >(arena);
+}
+template<> PROTOBUF_NOINLINE ::dsnet::vr::proto::RecoveryResponseMessage*
+Arena::CreateMaybeMessage< ::dsnet::vr::proto::RecoveryResponseMessage >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::dsnet::vr::proto::RecoveryResponseMessage >(arena);
+}
+template<> PROTOBUF_NOINLINE ::dsnet::vr::proto::ToReplicaMessage*
+Arena::CreateMaybeMessage< ::dsnet::vr::proto::ToReplicaMessage >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::dsnet::vr::proto::ToReplicaMessage >(arena);
+}
+PROTOBUF_NAMESPACE_CLOSE
+
+// @@protoc_insertion_point(global_scope)
+#include <google/protobuf/port_undef.inc>
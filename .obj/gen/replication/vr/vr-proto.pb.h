@@ -0,0 +1,6075 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: replication/vr/vr-proto.proto
+
+#ifndef GOOGLE_PROTOBUF_INCLUDED_replication_2fvr_2fvr_2dproto_2eproto
+#define GOOGLE_PROTOBUF_INCLUDED_replication_2fvr_2fvr_2dproto_2eproto
+
+#include <limits>
+#include <string>
+
+#include <google/protobuf/port_def.inc>
+#if PROTOBUF_VERSION < 3021000
+#error This file was generated by a newer version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please update
+#error your headers.
+#endif
+#if 3021012 < PROTOBUF_MIN_PROTOC_VERSION
+#error This file was generated by an older version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please
+#error regenerate this file with a newer version of protoc.
+#endif
+
+#include <google/protobuf/port_undef.inc>
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/arena.h>
+#include <google/protobuf/arenastring.h>
+#include <google/protobuf/generated_message_util.h>
+#include <google/protobuf/metadata_lite.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/message.h>
+#include <google/protobuf/repeated_field.h>  // IWYU pragma: export
+#include <google/protobuf/extension_set.h>  // IWYU pragma: export
+#include <google/protobuf/unknown_field_set.h>
+#include "common/request.pb.h"
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+#define PROTOBUF_INTERNAL_EXPORT_replication_2fvr_2fvr_2dproto_2eproto
+PROTOBUF_NAMESPACE_OPEN
+namespace internal {
+class AnyMetadata;
+}  // namespace internal
+PROTOBUF_NAMESPACE_CLOSE
+
+// Internal implementation detail -- do not use these members.
+struct TableStruct_replication_2fvr_2fvr_2dproto_2eproto {
+  static const uint32_t offsets[];
+};
+extern const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_replication_2fvr_2fvr_2dproto_2eproto;
+namespace dsnet {
+namespace vr {
+namespace proto {
+class CommitMessage;
+struct CommitMessageDefaultTypeInternal;
+extern CommitMessageDefaultTypeInternal _CommitMessage_default_instance_;
+class DoViewChangeMessage;
+struct DoViewChangeMessageDefaultTypeInternal;
+extern DoViewChangeMessageDefaultTypeInternal _DoViewChangeMessage_default_instance_;
+class PrepareMessage;
+struct PrepareMessageDefaultTypeInternal;
+extern PrepareMessageDefaultTypeInternal _PrepareMessage_default_instance_;
+class PrepareOKMessage;
+struct PrepareOKMessageDefaultTypeInternal;
+extern PrepareOKMessageDefaultTypeInternal _PrepareOKMessage_default_instance_;
+class RecoveryMessage;
+struct RecoveryMessageDefaultTypeInternal;
+extern RecoveryMessageDefaultTypeInternal _RecoveryMessage_default_instance_;
+class RecoveryResponseMessage;
+struct RecoveryResponseMessageDefaultTypeInternal;
+extern RecoveryResponseMessageDefaultTypeInternal _RecoveryResponseMessage_default_instance_;
+class ReplyMessage;
+struct ReplyMessageDefaultTypeInternal;
+extern ReplyMessageDefaultTypeInternal _ReplyMessage_default_instance_;
+class RequestMessage;
+struct RequestMessageDefaultTypeInternal;
+extern RequestMessageDefaultTypeInternal _RequestMessage_default_instance_;
+class RequestStateTransferMessage;
+struct RequestStateTransferMessageDefaultTypeInternal;
+extern RequestStateTransferMessageDefaultTypeInternal _RequestStateTransferMessage_default_instance_;
+class StartViewChangeMessage;
+struct StartViewChangeMessageDefaultTypeInternal;
+extern StartViewChangeMessageDefaultTypeInternal _StartViewChangeMessage_default_instance_;
+class StartViewMessage;
+struct StartViewMessageDefaultTypeInternal;
+extern StartViewMessageDefaultTypeInternal _StartViewMessage_default_instance_;
+class StateTransferMessage;
+struct StateTransferMessageDefaultTypeInternal;
+extern StateTransferMessageDefaultTypeInternal _StateTransferMessage_default_instance_;
+class ToClientMessage;
+struct ToClientMessageDefaultTypeInternal;
+extern ToClientMessageDefaultTypeInternal _ToClientMessage_default_instance_;
+class ToReplicaMessage;
+struct ToReplicaMessageDefaultTypeInternal;
+extern ToReplicaMessageDefaultTypeInternal _ToReplicaMessage_default_instance_;
+class UnloggedReplyMessage;
+struct UnloggedReplyMessageDefaultTypeInternal;
+extern UnloggedReplyMessageDefaultTypeInternal _UnloggedReplyMessage_default_instance_;
+class UnloggedRequestMessage;
+struct UnloggedRequestMessageDefaultTypeInternal;
+extern UnloggedRequestMessageDefaultTypeInternal _UnloggedRequestMessage_default_instance_;
+}  // namespace proto
+}  // namespace vr
+}  // namespace dsnet
+PROTOBUF_NAMESPACE_OPEN
+template<> ::dsnet::vr::proto::CommitMessage* Arena::CreateMaybeMessage<::dsnet::vr::proto::CommitMessage>(Arena*);
+template<> ::dsnet::vr::proto::DoViewChangeMessage* Arena::CreateMaybeMessage<::dsnet::vr::proto::DoViewChangeMessage>(Arena*);
+template<> ::dsnet::vr::proto::PrepareMessage* Arena::CreateMaybeMessage<::dsnet::vr::proto::PrepareMessage>(Arena*);
+template<> ::dsnet::vr::proto::PrepareOKMessage* Arena::CreateMaybeMessage<::dsnet::vr::proto::PrepareOKMessage>(Arena*);
+template<> ::dsnet::vr::proto::RecoveryMessage* Arena::CreateMaybeMessage<::dsnet::vr::proto::RecoveryMessage>(Arena*);
+template<> ::dsnet::vr::proto::RecoveryResponseMessage* Arena::CreateMaybeMessage<::dsnet::vr::proto::RecoveryResponseMessage>(Arena*);
+template<> ::dsnet::vr::proto::ReplyMessage* Arena::CreateMaybeMessage<::dsnet::vr::proto::ReplyMessage>(Arena*);
+template<> ::dsnet::vr::proto::RequestMessage* Arena::CreateMaybeMessage<::dsnet::vr::proto::RequestMessage>(Arena*);
+template<> ::dsnet::vr::proto::RequestStateTransferMessage* Arena::CreateMaybeMessage<::dsnet::vr::proto::RequestStateTransferMessage>(Arena*);
+template<> ::dsnet::vr::proto::StartViewChangeMessage* Arena::CreateMaybeMessage<::dsnet::vr::proto::StartViewChangeMessage>(Arena*);
+template<> ::dsnet::vr::proto::StartViewMessage* Arena::CreateMaybeMessage<::dsnet::vr::proto::StartViewMessage>(Arena*);
+template<> ::dsnet::vr::proto::StateTransferMessage* Arena::CreateMaybeMessage<::dsnet::vr::proto::StateTransferMessage>(Arena*);
+template<> ::dsnet::vr::proto::ToClientMessage* Arena::CreateMaybeMessage<::dsnet::vr::proto::ToClientMessage>(Arena*);
+template<> ::dsnet::vr::proto::ToReplicaMessage* Arena::CreateMaybeMessage<::dsnet::vr::proto::ToReplicaMessage>(Arena*);
+template<> ::dsnet::vr::proto::UnloggedReplyMessage* Arena::CreateMaybeMessage<::dsnet::vr::proto::UnloggedReplyMessage>(Arena*);
+template<> ::dsnet::vr::proto::UnloggedRequestMessage* Arena::CreateMaybeMessage<::dsnet::vr::proto::UnloggedRequestMessage>(Arena*);
+PROTOBUF_NAMESPACE_CLOSE
+namespace dsnet {
+namespace vr {
+namespace proto {
+
+// ===================================================================
+
+class ReplyMessage final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:dsnet.vr.proto.ReplyMessage) */ {
+ public:
+  inline ReplyMessage() : ReplyMessage(nullptr) {}
+  ~ReplyMessage() override;
+  explicit PROTOBUF_CONSTEXPR ReplyMessage(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  ReplyMessage(const ReplyMessage& from);
+  ReplyMessage(ReplyMessage&& from) noexcept
+    : ReplyMessage() {
+    *this = ::std::move(from);
+  }
+
+  inline ReplyMessage& operator=(const ReplyMessage& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline ReplyMessage& operator=(ReplyMessage&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ReplyMessage& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const ReplyMessage* internal_default_instance() {
+    return reinterpret_cast<const ReplyMessage*>(
+               &_ReplyMessage_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    0;
+
+  friend void swap(ReplyMessage& a, ReplyMessage& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(ReplyMessage* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ReplyMessage* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  ReplyMessage* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ReplyMessage>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const ReplyMessage& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ReplyMessage& from) {
+    ReplyMessage::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(ReplyMessage* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "dsnet.vr.proto.ReplyMessage";
+  }
+  protected:
+  explicit ReplyMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kReplyFieldNumber = 3,
+    kViewFieldNumber = 1,
+    kOpnumFieldNumber = 2,
+    kClientreqidFieldNumber = 4,
+  };
+  // required bytes reply = 3;
+  bool has_reply() const;
+  private:
+  bool _internal_has_reply() const;
+  public:
+  void clear_reply();
+  const std::string& reply() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_reply(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_reply();
+  PROTOBUF_NODISCARD std::string* release_reply();
+  void set_allocated_reply(std::string* reply);
+  private:
+  const std::string& _internal_reply() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_reply(const std::string& value);
+  std::string* _internal_mutable_reply();
+  public:
+
+  // required uint64 view = 1;
+  bool has_view() const;
+  private:
+  bool _internal_has_view() const;
+  public:
+  void clear_view();
+  uint64_t view() const;
+  void set_view(uint64_t value);
+  private:
+  uint64_t _internal_view() const;
+  void _internal_set_view(uint64_t value);
+  public:
+
+  // required uint64 opnum = 2;
+  bool has_opnum() const;
+  private:
+  bool _internal_has_opnum() const;
+  public:
+  void clear_opnum();
+  uint64_t opnum() const;
+  void set_opnum(uint64_t value);
+  private:
+  uint64_t _internal_opnum() const;
+  void _internal_set_opnum(uint64_t value);
+  public:
+
+  // required uint64 clientreqid = 4;
+  bool has_clientreqid() const;
+  private:
+  bool _internal_has_clientreqid() const;
+  public:
+  void clear_clientreqid();
+  uint64_t clientreqid() const;
+  void set_clientreqid(uint64_t value);
+  private:
+  uint64_t _internal_clientreqid() const;
+  void _internal_set_clientreqid(uint64_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:dsnet.vr.proto.ReplyMessage)
+ private:
+  class _Internal;
+
+  // helper for ByteSizeLong()
+  size_t RequiredFieldsByteSizeFallback() const;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr reply_;
+    uint64_t view_;
+    uint64_t opnum_;
+    uint64_t clientreqid_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_replication_2fvr_2fvr_2dproto_2eproto;
+};
+// -------------------------------------------------------------------
+
+class UnloggedReplyMessage final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:dsnet.vr.proto.UnloggedReplyMessage) */ {
+ public:
+  inline UnloggedReplyMessage() : UnloggedReplyMessage(nullptr) {}
+  ~UnloggedReplyMessage() override;
+  explicit PROTOBUF_CONSTEXPR UnloggedReplyMessage(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  UnloggedReplyMessage(const UnloggedReplyMessage& from);
+  UnloggedReplyMessage(UnloggedReplyMessage&& from) noexcept
+    : UnloggedReplyMessage() {
+    *this = ::std::move(from);
+  }
+
+  inline UnloggedReplyMessage& operator=(const UnloggedReplyMessage& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline UnloggedReplyMessage& operator=(UnloggedReplyMessage&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const UnloggedReplyMessage& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const UnloggedReplyMessage* internal_default_instance() {
+    return reinterpret_cast<const UnloggedReplyMessage*>(
+               &_UnloggedReplyMessage_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    1;
+
+  friend void swap(UnloggedReplyMessage& a, UnloggedReplyMessage& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(UnloggedReplyMessage* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(UnloggedReplyMessage* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  UnloggedReplyMessage* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<UnloggedReplyMessage>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const UnloggedReplyMessage& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const UnloggedReplyMessage& from) {
+    UnloggedReplyMessage::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(UnloggedReplyMessage* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "dsnet.vr.proto.UnloggedReplyMessage";
+  }
+  protected:
+  explicit UnloggedReplyMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kReplyFieldNumber = 1,
+  };
+  // required bytes reply = 1;
+  bool has_reply() const;
+  private:
+  bool _internal_has_reply() const;
+  public:
+  void clear_reply();
+  const std::string& reply() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_reply(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_reply();
+  PROTOBUF_NODISCARD std::string* release_reply();
+  void set_allocated_reply(std::string* reply);
+  private:
+  const std::string& _internal_reply() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_reply(const std::string& value);
+  std::string* _internal_mutable_reply();
+  public:
+
+  // @@protoc_insertion_point(class_scope:dsnet.vr.proto.UnloggedReplyMessage)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr reply_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_replication_2fvr_2fvr_2dproto_2eproto;
+};
+// -------------------------------------------------------------------
+
+class ToClientMessage final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:dsnet.vr.proto.ToClientMessage) */ {
+ public:
+  inline ToClientMessage() : ToClientMessage(nullptr) {}
+  ~ToClientMessage() override;
+  explicit PROTOBUF_CONSTEXPR ToClientMessage(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  ToClientMessage(const ToClientMessage& from);
+  ToClientMessage(ToClientMessage&& from) noexcept
+    : ToClientMessage() {
+    *this = ::std::move(from);
+  }
+
+  inline ToClientMessage& operator=(const ToClientMessage& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline ToClientMessage& operator=(ToClientMessage&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ToClientMessage& default_instance() {
+    return *internal_default_instance();
+  }
+  enum MsgCase {
+    kReply = 1,
+    kUnloggedReply = 2,
+    MSG_NOT_SET = 0,
+  };
+
+  static inline const ToClientMessage* internal_default_instance() {
+    return reinterpret_cast<const ToClientMessage*>(
+               &_ToClientMessage_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    2;
+
+  friend void swap(ToClientMessage& a, ToClientMessage& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(ToClientMessage* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ToClientMessage* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  ToClientMessage* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ToClientMessage>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const ToClientMessage& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ToClientMessage& from) {
+    ToClientMessage::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(ToClientMessage* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "dsnet.vr.proto.ToClientMessage";
+  }
+  protected:
+  explicit ToClientMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kReplyFieldNumber = 1,
+    kUnloggedReplyFieldNumber = 2,
+  };
+  // .dsnet.vr.proto.ReplyMessage reply = 1;
+  bool has_reply() const;
+  private:
+  bool _internal_has_reply() const;
+  public:
+  void clear_reply();
+  const ::dsnet::vr::proto::ReplyMessage& reply() const;
+  PROTOBUF_NODISCARD ::dsnet::vr::proto::ReplyMessage* release_reply();
+  ::dsnet::vr::proto::ReplyMessage* mutable_reply();
+  void set_allocated_reply(::dsnet::vr::proto::ReplyMessage* reply);
+  private:
+  const ::dsnet::vr::proto::ReplyMessage& _internal_reply() const;
+  ::dsnet::vr::proto::ReplyMessage* _internal_mutable_reply();
+  public:
+  void unsafe_arena_set_allocated_reply(
+      ::dsnet::vr::proto::ReplyMessage* reply);
+  ::dsnet::vr::proto::ReplyMessage* unsafe_arena_release_reply();
+
+  // .dsnet.vr.proto.UnloggedReplyMessage unlogged_reply = 2;
+  bool has_unlogged_reply() const;
+  private:
+  bool _internal_has_unlogged_reply() const;
+  public:
+  void clear_unlogged_reply();
+  const ::dsnet::vr::proto::UnloggedReplyMessage& unlogged_reply() const;
+  PROTOBUF_NODISCARD ::dsnet::vr::proto::UnloggedReplyMessage* release_unlogged_reply();
+  ::dsnet::vr::proto::UnloggedReplyMessage* mutable_unlogged_reply();
+  void set_allocated_unlogged_reply(::dsnet::vr::proto::UnloggedReplyMessage* unlogged_reply);
+  private:
+  const ::dsnet::vr::proto::UnloggedReplyMessage& _internal_unlogged_reply() const;
+  ::dsnet::vr::proto::UnloggedReplyMessage* _internal_mutable_unlogged_reply();
+  public:
+  void unsafe_arena_set_allocated_unlogged_reply(
+      ::dsnet::vr::proto::UnloggedReplyMessage* unlogged_reply);
+  ::dsnet::vr::proto::UnloggedReplyMessage* unsafe_arena_release_unlogged_reply();
+
+  void clear_msg();
+  MsgCase msg_case() const;
+  // @@protoc_insertion_point(class_scope:dsnet.vr.proto.ToClientMessage)
+ private:
+  class _Internal;
+  void set_has_reply();
+  void set_has_unlogged_reply();
+
+  inline bool has_msg() const;
+  inline void clear_has_msg();
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    union MsgUnion {
+      constexpr MsgUnion() : _constinit_{} {}
+        ::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized _constinit_;
+      ::dsnet::vr::proto::ReplyMessage* reply_;
+      ::dsnet::vr::proto::UnloggedReplyMessage* unlogged_reply_;
+    } msg_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    uint32_t _oneof_case_[1];
+
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_replication_2fvr_2fvr_2dproto_2eproto;
+};
+// -------------------------------------------------------------------
+
+class RequestMessage final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:dsnet.vr.proto.RequestMessage) */ {
+ public:
+  inline RequestMessage() : RequestMessage(nullptr) {}
+  ~RequestMessage() override;
+  explicit PROTOBUF_CONSTEXPR RequestMessage(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  RequestMessage(const RequestMessage& from);
+  RequestMessage(RequestMessage&& from) noexcept
+    : RequestMessage() {
+    *this = ::std::move(from);
+  }
+
+  inline RequestMessage& operator=(const RequestMessage& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline RequestMessage& operator=(RequestMessage&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const RequestMessage& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const RequestMessage* internal_default_instance() {
+    return reinterpret_cast<const RequestMessage*>(
+               &_RequestMessage_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    3;
+
+  friend void swap(RequestMessage& a, RequestMessage& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(RequestMessage* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(RequestMessage* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  RequestMessage* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<RequestMessage>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const RequestMessage& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const RequestMessage& from) {
+    RequestMessage::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(RequestMessage* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "dsnet.vr.proto.RequestMessage";
+  }
+  protected:
+  explicit RequestMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kReqFieldNumber = 1,
+  };
+  // required .dsnet.Request req = 1;
+  bool has_req() const;
+  private:
+  bool _internal_has_req() const;
+  public:
+  void clear_req();
+  const ::dsnet::Request& req() const;
+  PROTOBUF_NODISCARD ::dsnet::Request* release_req();
+  ::dsnet::Request* mutable_req();
+  void set_allocated_req(::dsnet::Request* req);
+  private:
+  const ::dsnet::Request& _internal_req() const;
+  ::dsnet::Request* _internal_mutable_req();
+  public:
+  void unsafe_arena_set_allocated_req(
+      ::dsnet::Request* req);
+  ::dsnet::Request* unsafe_arena_release_req();
+
+  // @@protoc_insertion_point(class_scope:dsnet.vr.proto.RequestMessage)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::dsnet::Request* req_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_replication_2fvr_2fvr_2dproto_2eproto;
+};
+// -------------------------------------------------------------------
+
+class UnloggedRequestMessage final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:dsnet.vr.proto.UnloggedRequestMessage) */ {
+ public:
+  inline UnloggedRequestMessage() : UnloggedRequestMessage(nullptr) {}
+  ~UnloggedRequestMessage() override;
+  explicit PROTOBUF_CONSTEXPR UnloggedRequestMessage(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  UnloggedRequestMessage(const UnloggedRequestMessage& from);
+  UnloggedRequestMessage(UnloggedRequestMessage&& from) noexcept
+    : UnloggedRequestMessage() {
+    *this = ::std::move(from);
+  }
+
+  inline UnloggedRequestMessage& operator=(const UnloggedRequestMessage& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline UnloggedRequestMessage& operator=(UnloggedRequestMessage&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const UnloggedRequestMessage& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const UnloggedRequestMessage* internal_default_instance() {
+    return reinterpret_cast<const UnloggedRequestMessage*>(
+               &_UnloggedRequestMessage_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    4;
+
+  friend void swap(UnloggedRequestMessage& a, UnloggedRequestMessage& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(UnloggedRequestMessage* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(UnloggedRequestMessage* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  UnloggedRequestMessage* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<UnloggedRequestMessage>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const UnloggedRequestMessage& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const UnloggedRequestMessage& from) {
+    UnloggedRequestMessage::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(UnloggedRequestMessage* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "dsnet.vr.proto.UnloggedRequestMessage";
+  }
+  protected:
+  explicit UnloggedRequestMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kReqFieldNumber = 1,
+  };
+  // required .dsnet.UnloggedRequest req = 1;
+  bool has_req() const;
+  private:
+  bool _internal_has_req() const;
+  public:
+  void clear_req();
+  const ::dsnet::UnloggedRequest& req() const;
+  PROTOBUF_NODISCARD ::dsnet::UnloggedRequest* release_req();
+  ::dsnet::UnloggedRequest* mutable_req();
+  void set_allocated_req(::dsnet::UnloggedRequest* req);
+  private:
+  const ::dsnet::UnloggedRequest& _internal_req() const;
+  ::dsnet::UnloggedRequest* _internal_mutable_req();
+  public:
+  void unsafe_arena_set_allocated_req(
+      ::dsnet::UnloggedRequest* req);
+  ::dsnet::UnloggedRequest* unsafe_arena_release_req();
+
+  // @@protoc_insertion_point(class_scope:dsnet.vr.proto.UnloggedRequestMessage)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::dsnet::UnloggedRequest* req_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_replication_2fvr_2fvr_2dproto_2eproto;
+};
+// -------------------------------------------------------------------
+
+class PrepareMessage final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:dsnet.vr.proto.PrepareMessage) */ {
+ public:
+  inline PrepareMessage() : PrepareMessage(nullptr) {}
+  ~PrepareMessage() override;
+  explicit PROTOBUF_CONSTEXPR PrepareMessage(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  PrepareMessage(const PrepareMessage& from);
+  PrepareMessage(PrepareMessage&& from) noexcept
+    : PrepareMessage() {
+    *this = ::std::move(from);
+  }
+
+  inline PrepareMessage& operator=(const PrepareMessage& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline PrepareMessage& operator=(PrepareMessage&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const PrepareMessage& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const PrepareMessage* internal_default_instance() {
+    return reinterpret_cast<const PrepareMessage*>(
+               &_PrepareMessage_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    5;
+
+  friend void swap(PrepareMessage& a, PrepareMessage& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(PrepareMessage* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(PrepareMessage* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  PrepareMessage* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<PrepareMessage>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const PrepareMessage& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const PrepareMessage& from) {
+    PrepareMessage::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(PrepareMessage* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "dsnet.vr.proto.PrepareMessage";
+  }
+  protected:
+  explicit PrepareMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kRequestFieldNumber = 4,
+    kViewFieldNumber = 1,
+    kOpnumFieldNumber = 2,
+    kBatchstartFieldNumber = 3,
+  };
+  // repeated .dsnet.Request request = 4;
+  int request_size() const;
+  private:
+  int _internal_request_size() const;
+  public:
+  void clear_request();
+  ::dsnet::Request* mutable_request(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::dsnet::Request >*
+      mutable_request();
+  private:
+  const ::dsnet::Request& _internal_request(int index) const;
+  ::dsnet::Request* _internal_add_request();
+  public:
+  const ::dsnet::Request& request(int index) const;
+  ::dsnet::Request* add_request();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::dsnet::Request >&
+      request() const;
+
+  // required uint64 view = 1;
+  bool has_view() const;
+  private:
+  bool _internal_has_view() const;
+  public:
+  void clear_view();
+  uint64_t view() const;
+  void set_view(uint64_t value);
+  private:
+  uint64_t _internal_view() const;
+  void _internal_set_view(uint64_t value);
+  public:
+
+  // required uint64 opnum = 2;
+  bool has_opnum() const;
+  private:
+  bool _internal_has_opnum() const;
+  public:
+  void clear_opnum();
+  uint64_t opnum() const;
+  void set_opnum(uint64_t value);
+  private:
+  uint64_t _internal_opnum() const;
+  void _internal_set_opnum(uint64_t value);
+  public:
+
+  // required uint64 batchstart = 3;
+  bool has_batchstart() const;
+  private:
+  bool _internal_has_batchstart() const;
+  public:
+  void clear_batchstart();
+  uint64_t batchstart() const;
+  void set_batchstart(uint64_t value);
+  private:
+  uint64_t _internal_batchstart() const;
+  void _internal_set_batchstart(uint64_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:dsnet.vr.proto.PrepareMessage)
+ private:
+  class _Internal;
+
+  // helper for ByteSizeLong()
+  size_t RequiredFieldsByteSizeFallback() const;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::dsnet::Request > request_;
+    uint64_t view_;
+    uint64_t opnum_;
+    uint64_t batchstart_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_replication_2fvr_2fvr_2dproto_2eproto;
+};
+// -------------------------------------------------------------------
+
+class PrepareOKMessage final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:dsnet.vr.proto.PrepareOKMessage) */ {
+ public:
+  inline PrepareOKMessage() : PrepareOKMessage(nullptr) {}
+  ~PrepareOKMessage() override;
+  explicit PROTOBUF_CONSTEXPR PrepareOKMessage(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  PrepareOKMessage(const PrepareOKMessage& from);
+  PrepareOKMessage(PrepareOKMessage&& from) noexcept
+    : PrepareOKMessage() {
+    *this = ::std::move(from);
+  }
+
+  inline PrepareOKMessage& operator=(const PrepareOKMessage& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline PrepareOKMessage& operator=(PrepareOKMessage&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const PrepareOKMessage& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const PrepareOKMessage* internal_default_instance() {
+    return reinterpret_cast<const PrepareOKMessage*>(
+               &_PrepareOKMessage_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    6;
+
+  friend void swap(PrepareOKMessage& a, PrepareOKMessage& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(PrepareOKMessage* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(PrepareOKMessage* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  PrepareOKMessage* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<PrepareOKMessage>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const PrepareOKMessage& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const PrepareOKMessage& from) {
+    PrepareOKMessage::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(PrepareOKMessage* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "dsnet.vr.proto.PrepareOKMessage";
+  }
+  protected:
+  explicit PrepareOKMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kViewFieldNumber = 1,
+    kOpnumFieldNumber = 2,
+    kReplicaIdxFieldNumber = 3,
+  };
+  // required uint64 view = 1;
+  bool has_view() const;
+  private:
+  bool _internal_has_view() const;
+  public:
+  void clear_view();
+  uint64_t view() const;
+  void set_view(uint64_t value);
+  private:
+  uint64_t _internal_view() const;
+  void _internal_set_view(uint64_t value);
+  public:
+
+  // required uint64 opnum = 2;
+  bool has_opnum() const;
+  private:
+  bool _internal_has_opnum() const;
+  public:
+  void clear_opnum();
+  uint64_t opnum() const;
+  void set_opnum(uint64_t value);
+  private:
+  uint64_t _internal_opnum() const;
+  void _internal_set_opnum(uint64_t value);
+  public:
+
+  // required uint32 replicaIdx = 3;
+  bool has_replicaidx() const;
+  private:
+  bool _internal_has_replicaidx() const;
+  public:
+  void clear_replicaidx();
+  uint32_t replicaidx() const;
+  void set_replicaidx(uint32_t value);
+  private:
+  uint32_t _internal_replicaidx() const;
+  void _internal_set_replicaidx(uint32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:dsnet.vr.proto.PrepareOKMessage)
+ private:
+  class _Internal;
+
+  // helper for ByteSizeLong()
+  size_t RequiredFieldsByteSizeFallback() const;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    uint64_t view_;
+    uint64_t opnum_;
+    uint32_t replicaidx_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_replication_2fvr_2fvr_2dproto_2eproto;
+};
+// -------------------------------------------------------------------
+
+class CommitMessage final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:dsnet.vr.proto.CommitMessage) */ {
+ public:
+  inline CommitMessage() : CommitMessage(nullptr) {}
+  ~CommitMessage() override;
+  explicit PROTOBUF_CONSTEXPR CommitMessage(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  CommitMessage(const CommitMessage& from);
+  CommitMessage(CommitMessage&& from) noexcept
+    : CommitMessage() {
+    *this = ::std::move(from);
+  }
+
+  inline CommitMessage& operator=(const CommitMessage& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline CommitMessage& operator=(CommitMessage&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const CommitMessage& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const CommitMessage* internal_default_instance() {
+    return reinterpret_cast<const CommitMessage*>(
+               &_CommitMessage_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    7;
+
+  friend void swap(CommitMessage& a, CommitMessage& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(CommitMessage* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(CommitMessage* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  CommitMessage* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<CommitMessage>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const CommitMessage& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const CommitMessage& from) {
+    CommitMessage::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(CommitMessage* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "dsnet.vr.proto.CommitMessage";
+  }
+  protected:
+  explicit CommitMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kViewFieldNumber = 1,
+    kOpnumFieldNumber = 2,
+  };
+  // required uint64 view = 1;
+  bool has_view() const;
+  private:
+  bool _internal_has_view() const;
+  public:
+  void clear_view();
+  uint64_t view() const;
+  void set_view(uint64_t value);
+  private:
+  uint64_t _internal_view() const;
+  void _internal_set_view(uint64_t value);
+  public:
+
+  // required uint64 opnum = 2;
+  bool has_opnum() const;
+  private:
+  bool _internal_has_opnum() const;
+  public:
+  void clear_opnum();
+  uint64_t opnum() const;
+  void set_opnum(uint64_t value);
+  private:
+  uint64_t _internal_opnum() const;
+  void _internal_set_opnum(uint64_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:dsnet.vr.proto.CommitMessage)
+ private:
+  class _Internal;
+
+  // helper for ByteSizeLong()
+  size_t RequiredFieldsByteSizeFallback() const;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    uint64_t view_;
+    uint64_t opnum_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_replication_2fvr_2fvr_2dproto_2eproto;
+};
+// -------------------------------------------------------------------
+
+class RequestStateTransferMessage final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:dsnet.vr.proto.RequestStateTransferMessage) */ {
+ public:
+  inline RequestStateTransferMessage() : RequestStateTransferMessage(nullptr) {}
+  ~RequestStateTransferMessage() override;
+  explicit PROTOBUF_CONSTEXPR RequestStateTransferMessage(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  RequestStateTransferMessage(const RequestStateTransferMessage& from);
+  RequestStateTransferMessage(RequestStateTransferMessage&& from) noexcept
+    : RequestStateTransferMessage() {
+    *this = ::std::move(from);
+  }
+
+  inline RequestStateTransferMessage& operator=(const RequestStateTransferMessage& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline RequestStateTransferMessage& operator=(RequestStateTransferMessage&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const RequestStateTransferMessage& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const RequestStateTransferMessage* internal_default_instance() {
+    return reinterpret_cast<const RequestStateTransferMessage*>(
+               &_RequestStateTransferMessage_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    8;
+
+  friend void swap(RequestStateTransferMessage& a, RequestStateTransferMessage& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(RequestStateTransferMessage* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(RequestStateTransferMessage* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  RequestStateTransferMessage* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<RequestStateTransferMessage>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const RequestStateTransferMessage& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const RequestStateTransferMessage& from) {
+    RequestStateTransferMessage::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(RequestStateTransferMessage* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "dsnet.vr.proto.RequestStateTransferMessage";
+  }
+  protected:
+  explicit RequestStateTransferMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kViewFieldNumber = 1,
+    kOpnumFieldNumber = 2,
+  };
+  // required uint64 view = 1;
+  bool has_view() const;
+  private:
+  bool _internal_has_view() const;
+  public:
+  void clear_view();
+  uint64_t view() const;
+  void set_view(uint64_t value);
+  private:
+  uint64_t _internal_view() const;
+  void _internal_set_view(uint64_t value);
+  public:
+
+  // required uint64 opnum = 2;
+  bool has_opnum() const;
+  private:
+  bool _internal_has_opnum() const;
+  public:
+  void clear_opnum();
+  uint64_t opnum() const;
+  void set_opnum(uint64_t value);
+  private:
+  uint64_t _internal_opnum() const;
+  void _internal_set_opnum(uint64_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:dsnet.vr.proto.RequestStateTransferMessage)
+ private:
+  class _Internal;
+
+  // helper for ByteSizeLong()
+  size_t RequiredFieldsByteSizeFallback() const;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    uint64_t view_;
+    uint64_t opnum_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_replication_2fvr_2fvr_2dproto_2eproto;
+};
+// -------------------------------------------------------------------
+
+class StateTransferMessage final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:dsnet.vr.proto.StateTransferMessage) */ {
+ public:
+  inline StateTransferMessage() : StateTransferMessage(nullptr) {}
+  ~StateTransferMessage() override;
+  explicit PROTOBUF_CONSTEXPR StateTransferMessage(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  StateTransferMessage(const StateTransferMessage& from);
+  StateTransferMessage(StateTransferMessage&& from) noexcept
+    : StateTransferMessage() {
+    *this = ::std::move(from);
+  }
+
+  inline StateTransferMessage& operator=(const StateTransferMessage& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline StateTransferMessage& operator=(StateTransferMessage&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const StateTransferMessage& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const StateTransferMessage* internal_default_instance() {
+    return reinterpret_cast<const StateTransferMessage*>(
+               &_StateTransferMessage_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    9;
+
+  friend void swap(StateTransferMessage& a, StateTransferMessage& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(StateTransferMessage* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(StateTransferMessage* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  StateTransferMessage* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<StateTransferMessage>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const StateTransferMessage& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const StateTransferMessage& from) {
+    StateTransferMessage::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(StateTransferMessage* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "dsnet.vr.proto.StateTransferMessage";
+  }
+  protected:
+  explicit StateTransferMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kEntriesFieldNumber = 3,
+    kViewFieldNumber = 1,
+    kOpnumFieldNumber = 2,
+  };
+  // repeated .dsnet.MsgLogEntry entries = 3;
+  int entries_size() const;
+  private:
+  int _internal_entries_size() const;
+  public:
+  void clear_entries();
+  ::dsnet::MsgLogEntry* mutable_entries(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::dsnet::MsgLogEntry >*
+      mutable_entries();
+  private:
+  const ::dsnet::MsgLogEntry& _internal_entries(int index) const;
+  ::dsnet::MsgLogEntry* _internal_add_entries();
+  public:
+  const ::dsnet::MsgLogEntry& entries(int index) const;
+  ::dsnet::MsgLogEntry* add_entries();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::dsnet::MsgLogEntry >&
+      entries() const;
+
+  // required uint64 view = 1;
+  bool has_view() const;
+  private:
+  bool _internal_has_view() const;
+  public:
+  void clear_view();
+  uint64_t view() const;
+  void set_view(uint64_t value);
+  private:
+  uint64_t _internal_view() const;
+  void _internal_set_view(uint64_t value);
+  public:
+
+  // required uint64 opnum = 2;
+  bool has_opnum() const;
+  private:
+  bool _internal_has_opnum() const;
+  public:
+  void clear_opnum();
+  uint64_t opnum() const;
+  void set_opnum(uint64_t value);
+  private:
+  uint64_t _internal_opnum() const;
+  void _internal_set_opnum(uint64_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:dsnet.vr.proto.StateTransferMessage)
+ private:
+  class _Internal;
+
+  // helper for ByteSizeLong()
+  size_t RequiredFieldsByteSizeFallback() const;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::dsnet::MsgLogEntry > entries_;
+    uint64_t view_;
+    uint64_t opnum_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_replication_2fvr_2fvr_2dproto_2eproto;
+};
+// -------------------------------------------------------------------
+
+class StartViewChangeMessage final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:dsnet.vr.proto.StartViewChangeMessage) */ {
+ public:
+  inline StartViewChangeMessage() : StartViewChangeMessage(nullptr) {}
+  ~StartViewChangeMessage() override;
+  explicit PROTOBUF_CONSTEXPR StartViewChangeMessage(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  StartViewChangeMessage(const StartViewChangeMessage& from);
+  StartViewChangeMessage(StartViewChangeMessage&& from) noexcept
+    : StartViewChangeMessage() {
+    *this = ::std::move(from);
+  }
+
+  inline StartViewChangeMessage& operator=(const StartViewChangeMessage& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline StartViewChangeMessage& operator=(StartViewChangeMessage&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const StartViewChangeMessage& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const StartViewChangeMessage* internal_default_instance() {
+    return reinterpret_cast<const StartViewChangeMessage*>(
+               &_StartViewChangeMessage_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    10;
+
+  friend void swap(StartViewChangeMessage& a, StartViewChangeMessage& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(StartViewChangeMessage* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(StartViewChangeMessage* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  StartViewChangeMessage* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<StartViewChangeMessage>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const StartViewChangeMessage& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const StartViewChangeMessage& from) {
+    StartViewChangeMessage::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(StartViewChangeMessage* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "dsnet.vr.proto.StartViewChangeMessage";
+  }
+  protected:
+  explicit StartViewChangeMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kViewFieldNumber = 1,
+    kLastCommittedFieldNumber = 3,
+    kReplicaIdxFieldNumber = 2,
+  };
+  // required uint64 view = 1;
+  bool has_view() const;
+  private:
+  bool _internal_has_view() const;
+  public:
+  void clear_view();
+  uint64_t view() const;
+  void set_view(uint64_t value);
+  private:
+  uint64_t _internal_view() const;
+  void _internal_set_view(uint64_t value);
+  public:
+
+  // required uint64 lastCommitted = 3;
+  bool has_lastcommitted() const;
+  private:
+  bool _internal_has_lastcommitted() const;
+  public:
+  void clear_lastcommitted();
+  uint64_t lastcommitted() const;
+  void set_lastcommitted(uint64_t value);
+  private:
+  uint64_t _internal_lastcommitted() const;
+  void _internal_set_lastcommitted(uint64_t value);
+  public:
+
+  // required uint32 replicaIdx = 2;
+  bool has_replicaidx() const;
+  private:
+  bool _internal_has_replicaidx() const;
+  public:
+  void clear_replicaidx();
+  uint32_t replicaidx() const;
+  void set_replicaidx(uint32_t value);
+  private:
+  uint32_t _internal_replicaidx() const;
+  void _internal_set_replicaidx(uint32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:dsnet.vr.proto.StartViewChangeMessage)
+ private:
+  class _Internal;
+
+  // helper for ByteSizeLong()
+  size_t RequiredFieldsByteSizeFallback() const;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    uint64_t view_;
+    uint64_t lastcommitted_;
+    uint32_t replicaidx_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_replication_2fvr_2fvr_2dproto_2eproto;
+};
+// -------------------------------------------------------------------
+
+class DoViewChangeMessage final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:dsnet.vr.proto.DoViewChangeMessage) */ {
+ public:
+  inline DoViewChangeMessage() : DoViewChangeMessage(nullptr) {}
+  ~DoViewChangeMessage() override;
+  explicit PROTOBUF_CONSTEXPR DoViewChangeMessage(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  DoViewChangeMessage(const DoViewChangeMessage& from);
+  DoViewChangeMessage(DoViewChangeMessage&& from) noexcept
+    : DoViewChangeMessage() {
+    *this = ::std::move(from);
+  }
+
+  inline DoViewChangeMessage& operator=(const DoViewChangeMessage& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline DoViewChangeMessage& operator=(DoViewChangeMessage&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const DoViewChangeMessage& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const DoViewChangeMessage* internal_default_instance() {
+    return reinterpret_cast<const DoViewChangeMessage*>(
+               &_DoViewChangeMessage_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    11;
+
+  friend void swap(DoViewChangeMessage& a, DoViewChangeMessage& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(DoViewChangeMessage* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(DoViewChangeMessage* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  DoViewChangeMessage* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<DoViewChangeMessage>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const DoViewChangeMessage& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const DoViewChangeMessage& from) {
+    DoViewChangeMessage::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(DoViewChangeMessage* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "dsnet.vr.proto.DoViewChangeMessage";
+  }
+  protected:
+  explicit DoViewChangeMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kEntriesFieldNumber = 5,
+    kViewFieldNumber = 1,
+    kLastNormalViewFieldNumber = 2,
+    kLastOpFieldNumber = 3,
+    kLastCommittedFieldNumber = 4,
+    kReplicaIdxFieldNumber = 6,
+  };
+  // repeated .dsnet.MsgLogEntry entries = 5;
+  int entries_size() const;
+  private:
+  int _internal_entries_size() const;
+  public:
+  void clear_entries();
+  ::dsnet::MsgLogEntry* mutable_entries(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::dsnet::MsgLogEntry >*
+      mutable_entries();
+  private:
+  const ::dsnet::MsgLogEntry& _internal_entries(int index) const;
+  ::dsnet::MsgLogEntry* _internal_add_entries();
+  public:
+  const ::dsnet::MsgLogEntry& entries(int index) const;
+  ::dsnet::MsgLogEntry* add_entries();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::dsnet::MsgLogEntry >&
+      entries() const;
+
+  // required uint64 view = 1;
+  bool has_view() const;
+  private:
+  bool _internal_has_view() const;
+  public:
+  void clear_view();
+  uint64_t view() const;
+  void set_view(uint64_t value);
+  private:
+  uint64_t _internal_view() const;
+  void _internal_set_view(uint64_t value);
+  public:
+
+  // required uint64 lastNormalView = 2;
+  bool has_lastnormalview() const;
+  private:
+  bool _internal_has_lastnormalview() const;
+  public:
+  void clear_lastnormalview();
+  uint64_t lastnormalview() const;
+  void set_lastnormalview(uint64_t value);
+  private:
+  uint64_t _internal_lastnormalview() const;
+  void _internal_set_lastnormalview(uint64_t value);
+  public:
+
+  // required uint64 lastOp = 3;
+  bool has_lastop() const;
+  private:
+  bool _internal_has_lastop() const;
+  public:
+  void clear_lastop();
+  uint64_t lastop() const;
+  void set_lastop(uint64_t value);
+  private:
+  uint64_t _internal_lastop() const;
+  void _internal_set_lastop(uint64_t value);
+  public:
+
+  // required uint64 lastCommitted = 4;
+  bool has_lastcommitted() const;
+  private:
+  bool _internal_has_lastcommitted() const;
+  public:
+  void clear_lastcommitted();
+  uint64_t lastcommitted() const;
+  void set_lastcommitted(uint64_t value);
+  private:
+  uint64_t _internal_lastcommitted() const;
+  void _internal_set_lastcommitted(uint64_t value);
+  public:
+
+  // required uint32 replicaIdx = 6;
+  bool has_replicaidx() const;
+  private:
+  bool _internal_has_replicaidx() const;
+  public:
+  void clear_replicaidx();
+  uint32_t replicaidx() const;
+  void set_replicaidx(uint32_t value);
+  private:
+  uint32_t _internal_replicaidx() const;
+  void _internal_set_replicaidx(uint32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:dsnet.vr.proto.DoViewChangeMessage)
+ private:
+  class _Internal;
+
+  // helper for ByteSizeLong()
+  size_t RequiredFieldsByteSizeFallback() const;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::dsnet::MsgLogEntry > entries_;
+    uint64_t view_;
+    uint64_t lastnormalview_;
+    uint64_t lastop_;
+    uint64_t lastcommitted_;
+    uint32_t replicaidx_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_replication_2fvr_2fvr_2dproto_2eproto;
+};
+// -------------------------------------------------------------------
+
+class StartViewMessage final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:dsnet.vr.proto.StartViewMessage) */ {
+ public:
+  inline StartViewMessage() : StartViewMessage(nullptr) {}
+  ~StartViewMessage() override;
+  explicit PROTOBUF_CONSTEXPR StartViewMessage(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  StartViewMessage(const StartViewMessage& from);
+  StartViewMessage(StartViewMessage&& from) noexcept
+    : StartViewMessage() {
+    *this = ::std::move(from);
+  }
+
+  inline StartViewMessage& operator=(const StartViewMessage& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline StartViewMessage& operator=(StartViewMessage&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const StartViewMessage& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const StartViewMessage* internal_default_instance() {
+    return reinterpret_cast<const StartViewMessage*>(
+               &_StartViewMessage_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    12;
+
+  friend void swap(StartViewMessage& a, StartViewMessage& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(StartViewMessage* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(StartViewMessage* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  StartViewMessage* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<StartViewMessage>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const StartViewMessage& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const StartViewMessage& from) {
+    StartViewMessage::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(StartViewMessage* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "dsnet.vr.proto.StartViewMessage";
+  }
+  protected:
+  explicit StartViewMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kEntriesFieldNumber = 4,
+    kViewFieldNumber = 1,
+    kLastOpFieldNumber = 2,
+    kLastCommittedFieldNumber = 3,
+  };
+  // repeated .dsnet.MsgLogEntry entries = 4;
+  int entries_size() const;
+  private:
+  int _internal_entries_size() const;
+  public:
+  void clear_entries();
+  ::dsnet::MsgLogEntry* mutable_entries(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::dsnet::MsgLogEntry >*
+      mutable_entries();
+  private:
+  const ::dsnet::MsgLogEntry& _internal_entries(int index) const;
+  ::dsnet::MsgLogEntry* _internal_add_entries();
+  public:
+  const ::dsnet::MsgLogEntry& entries(int index) const;
+  ::dsnet::MsgLogEntry* add_entries();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::dsnet::MsgLogEntry >&
+      entries() const;
+
+  // required uint64 view = 1;
+  bool has_view() const;
+  private:
+  bool _internal_has_view() const;
+  public:
+  void clear_view();
+  uint64_t view() const;
+  void set_view(uint64_t value);
+  private:
+  uint64_t _internal_view() const;
+  void _internal_set_view(uint64_t value);
+  public:
+
+  // required uint64 lastOp = 2;
+  bool has_lastop() const;
+  private:
+  bool _internal_has_lastop() const;
+  public:
+  void clear_lastop();
+  uint64_t lastop() const;
+  void set_lastop(uint64_t value);
+  private:
+  uint64_t _internal_lastop() const;
+  void _internal_set_lastop(uint64_t value);
+  public:
+
+  // required uint64 lastCommitted = 3;
+  bool has_lastcommitted() const;
+  private:
+  bool _internal_has_lastcommitted() const;
+  public:
+  void clear_lastcommitted();
+  uint64_t lastcommitted() const;
+  void set_lastcommitted(uint64_t value);
+  private:
+  uint64_t _internal_lastcommitted() const;
+  void _internal_set_lastcommitted(uint64_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:dsnet.vr.proto.StartViewMessage)
+ private:
+  class _Internal;
+
+  // helper for ByteSizeLong()
+  size_t RequiredFieldsByteSizeFallback() const;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::dsnet::MsgLogEntry > entries_;
+    uint64_t view_;
+    uint64_t lastop_;
+    uint64_t lastcommitted_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_replication_2fvr_2fvr_2dproto_2eproto;
+};
+// -------------------------------------------------------------------
+
+class RecoveryMessage final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:dsnet.vr.proto.RecoveryMessage) */ {
+ public:
+  inline RecoveryMessage() : RecoveryMessage(nullptr) {}
+  ~RecoveryMessage() override;
+  explicit PROTOBUF_CONSTEXPR RecoveryMessage(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  RecoveryMessage(const RecoveryMessage& from);
+  RecoveryMessage(RecoveryMessage&& from) noexcept
+    : RecoveryMessage() {
+    *this = ::std::move(from);
+  }
+
+  inline RecoveryMessage& operator=(const RecoveryMessage& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline RecoveryMessage& operator=(RecoveryMessage&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const RecoveryMessage& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const RecoveryMessage* internal_default_instance() {
+    return reinterpret_cast<const RecoveryMessage*>(
+               &_RecoveryMessage_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    13;
+
+  friend void swap(RecoveryMessage& a, RecoveryMessage& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(RecoveryMessage* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(RecoveryMessage* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  RecoveryMessage* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<RecoveryMessage>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const RecoveryMessage& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const RecoveryMessage& from) {
+    RecoveryMessage::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(RecoveryMessage* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "dsnet.vr.proto.RecoveryMessage";
+  }
+  protected:
+  explicit RecoveryMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kNonceFieldNumber = 2,
+    kReplicaIdxFieldNumber = 1,
+  };
+  // required uint64 nonce = 2;
+  bool has_nonce() const;
+  private:
+  bool _internal_has_nonce() const;
+  public:
+  void clear_nonce();
+  uint64_t nonce() const;
+  void set_nonce(uint64_t value);
+  private:
+  uint64_t _internal_nonce() const;
+  void _internal_set_nonce(uint64_t value);
+  public:
+
+  // required uint32 replicaIdx = 1;
+  bool has_replicaidx() const;
+  private:
+  bool _internal_has_replicaidx() const;
+  public:
+  void clear_replicaidx();
+  uint32_t replicaidx() const;
+  void set_replicaidx(uint32_t value);
+  private:
+  uint32_t _internal_replicaidx() const;
+  void _internal_set_replicaidx(uint32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:dsnet.vr.proto.RecoveryMessage)
+ private:
+  class _Internal;
+
+  // helper for ByteSizeLong()
+  size_t RequiredFieldsByteSizeFallback() const;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    uint64_t nonce_;
+    uint32_t replicaidx_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_replication_2fvr_2fvr_2dproto_2eproto;
+};
+// -------------------------------------------------------------------
+
+class RecoveryResponseMessage final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:dsnet.vr.proto.RecoveryResponseMessage) */ {
+ public:
+  inline RecoveryResponseMessage() : RecoveryResponseMessage(nullptr) {}
+  ~RecoveryResponseMessage() override;
+  explicit PROTOBUF_CONSTEXPR RecoveryResponseMessage(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  RecoveryResponseMessage(const RecoveryResponseMessage& from);
+  RecoveryResponseMessage(RecoveryResponseMessage&& from) noexcept
+    : RecoveryResponseMessage() {
+    *this = ::std::move(from);
+  }
+
+  inline RecoveryResponseMessage& operator=(const RecoveryResponseMessage& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline RecoveryResponseMessage& operator=(RecoveryResponseMessage&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const RecoveryResponseMessage& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const RecoveryResponseMessage* internal_default_instance() {
+    return reinterpret_cast<const RecoveryResponseMessage*>(
+               &_RecoveryResponseMessage_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    14;
+
+  friend void swap(RecoveryResponseMessage& a, RecoveryResponseMessage& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(RecoveryResponseMessage* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(RecoveryResponseMessage* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  RecoveryResponseMessage* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<RecoveryResponseMessage>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const RecoveryResponseMessage& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const RecoveryResponseMessage& from) {
+    RecoveryResponseMessage::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(RecoveryResponseMessage* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "dsnet.vr.proto.RecoveryResponseMessage";
+  }
+  protected:
+  explicit RecoveryResponseMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kEntriesFieldNumber = 3,
+    kViewFieldNumber = 1,
+    kNonceFieldNumber = 2,
+    kLastOpFieldNumber = 4,
+    kLastCommittedFieldNumber = 5,
+    kReplicaIdxFieldNumber = 6,
+  };
+  // repeated .dsnet.MsgLogEntry entries = 3;
+  int entries_size() const;
+  private:
+  int _internal_entries_size() const;
+  public:
+  void clear_entries();
+  ::dsnet::MsgLogEntry* mutable_entries(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::dsnet::MsgLogEntry >*
+      mutable_entries();
+  private:
+  const ::dsnet::MsgLogEntry& _internal_entries(int index) const;
+  ::dsnet::MsgLogEntry* _internal_add_entries();
+  public:
+  const ::dsnet::MsgLogEntry& entries(int index) const;
+  ::dsnet::MsgLogEntry* add_entries();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::dsnet::MsgLogEntry >&
+      entries() const;
+
+  // required uint64 view = 1;
+  bool has_view() const;
+  private:
+  bool _internal_has_view() const;
+  public:
+  void clear_view();
+  uint64_t view() const;
+  void set_view(uint64_t value);
+  private:
+  uint64_t _internal_view() const;
+  void _internal_set_view(uint64_t value);
+  public:
+
+  // required uint64 nonce = 2;
+  bool has_nonce() const;
+  private:
+  bool _internal_has_nonce() const;
+  public:
+  void clear_nonce();
+  uint64_t nonce() const;
+  void set_nonce(uint64_t value);
+  private:
+  uint64_t _internal_nonce() const;
+  void _internal_set_nonce(uint64_t value);
+  public:
+
+  // optional uint64 lastOp = 4;
+  bool has_lastop() const;
+  private:
+  bool _internal_has_lastop() const;
+  public:
+  void clear_lastop();
+  uint64_t lastop() const;
+  void set_lastop(uint64_t value);
+  private:
+  uint64_t _internal_lastop() const;
+  void _internal_set_lastop(uint64_t value);
+  public:
+
+  // optional uint64 lastCommitted = 5;
+  bool has_lastcommitted() const;
+  private:
+  bool _internal_has_lastcommitted() const;
+  public:
+  void clear_lastcommitted();
+  uint64_t lastcommitted() const;
+  void set_lastcommitted(uint64_t value);
+  private:
+  uint64_t _internal_lastcommitted() const;
+  void _internal_set_lastcommitted(uint64_t value);
+  public:
+
+  // required uint32 replicaIdx = 6;
+  bool has_replicaidx() const;
+  private:
+  bool _internal_has_replicaidx() const;
+  public:
+  void clear_replicaidx();
+  uint32_t replicaidx() const;
+  void set_replicaidx(uint32_t value);
+  private:
+  uint32_t _internal_replicaidx() const;
+  void _internal_set_replicaidx(uint32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:dsnet.vr.proto.RecoveryResponseMessage)
+ private:
+  class _Internal;
+
+  // helper for ByteSizeLong()
+  size_t RequiredFieldsByteSizeFallback() const;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::dsnet::MsgLogEntry > entries_;
+    uint64_t view_;
+    uint64_t nonce_;
+    uint64_t lastop_;
+    uint64_t lastcommitted_;
+    uint32_t replicaidx_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_replication_2fvr_2fvr_2dproto_2eproto;
+};
+// -------------------------------------------------------------------
+
+class ToReplicaMessage final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:dsnet.vr.proto.ToReplicaMessage) */ {
+ public:
+  inline ToReplicaMessage() : ToReplicaMessage(nullptr) {}
+  ~ToReplicaMessage() override;
+  explicit PROTOBUF_CONSTEXPR ToReplicaMessage(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  ToReplicaMessage(const ToReplicaMessage& from);
+  ToReplicaMessage(ToReplicaMessage&& from) noexcept
+    : ToReplicaMessage() {
+    *this = ::std::move(from);
+  }
+
+  inline ToReplicaMessage& operator=(const ToReplicaMessage& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline ToReplicaMessage& operator=(ToReplicaMessage&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ToReplicaMessage& default_instance() {
+    return *internal_default_instance();
+  }
+  enum MsgCase {
+    kRequest = 1,
+    kUnloggedRequest = 2,
+    kPrepare = 3,
+    kPrepareOk = 4,
+    kCommit = 5,
+    kRequestStateTransfer = 6,
+    kStateTransfer = 7,
+    kStartViewChange = 8,
+    kDoViewChange = 9,
+    kStartView = 10,
+    kRecovery = 11,
+    kRecoveryResponse = 12,
+    MSG_NOT_SET = 0,
+  };
+
+  static inline const ToReplicaMessage* internal_default_instance() {
+    return reinterpret_cast<const ToReplicaMessage*>(
+               &_ToReplicaMessage_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    15;
+
+  friend void swap(ToReplicaMessage& a, ToReplicaMessage& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(ToReplicaMessage* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ToReplicaMessage* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  ToReplicaMessage* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ToReplicaMessage>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const ToReplicaMessage& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ToReplicaMessage& from) {
+    ToReplicaMessage::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(ToReplicaMessage* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "dsnet.vr.proto.ToReplicaMessage";
+  }
+  protected:
+  explicit ToReplicaMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kRequestFieldNumber = 1,
+    kUnloggedRequestFieldNumber = 2,
+    kPrepareFieldNumber = 3,
+    kPrepareOkFieldNumber = 4,
+    kCommitFieldNumber = 5,
+    kRequestStateTransferFieldNumber = 6,
+    kStateTransferFieldNumber = 7,
+    kStartViewChangeFieldNumber = 8,
+    kDoViewChangeFieldNumber = 9,
+    kStartViewFieldNumber = 10,
+    kRecoveryFieldNumber = 11,
+    kRecoveryResponseFieldNumber = 12,
+  };
+  // .dsnet.vr.proto.RequestMessage request = 1;
+  bool has_request() const;
+  private:
+  bool _internal_has_request() const;
+  public:
+  void clear_request();
+  const ::dsnet::vr::proto::RequestMessage& request() const;
+  PROTOBUF_NODISCARD ::dsnet::vr::proto::RequestMessage* release_request();
+  ::dsnet::vr::proto::RequestMessage* mutable_request();
+  void set_allocated_request(::dsnet::vr::proto::RequestMessage* request);
+  private:
+  const ::dsnet::vr::proto::RequestMessage& _internal_request() const;
+  ::dsnet::vr::proto::RequestMessage* _internal_mutable_request();
+  public:
+  void unsafe_arena_set_allocated_request(
+      ::dsnet::vr::proto::RequestMessage* request);
+  ::dsnet::vr::proto::RequestMessage* unsafe_arena_release_request();
+
+  // .dsnet.vr.proto.UnloggedRequestMessage unlogged_request = 2;
+  bool has_unlogged_request() const;
+  private:
+  bool _internal_has_unlogged_request() const;
+  public:
+  void clear_unlogged_request();
+  const ::dsnet::vr::proto::UnloggedRequestMessage& unlogged_request() const;
+  PROTOBUF_NODISCARD ::dsnet::vr::proto::UnloggedRequestMessage* release_unlogged_request();
+  ::dsnet::vr::proto::UnloggedRequestMessage* mutable_unlogged_request();
+  void set_allocated_unlogged_request(::dsnet::vr::proto::UnloggedRequestMessage* unlogged_request);
+  private:
+  const ::dsnet::vr::proto::UnloggedRequestMessage& _internal_unlogged_request() const;
+  ::dsnet::vr::proto::UnloggedRequestMessage* _internal_mutable_unlogged_request();
+  public:
+  void unsafe_arena_set_allocated_unlogged_request(
+      ::dsnet::vr::proto::UnloggedRequestMessage* unlogged_request);
+  ::dsnet::vr::proto::UnloggedRequestMessage* unsafe_arena_release_unlogged_request();
+
+  // .dsnet.vr.proto.PrepareMessage prepare = 3;
+  bool has_prepare() const;
+  private:
+  bool _internal_has_prepare() const;
+  public:
+  void clear_prepare();
+  const ::dsnet::vr::proto::PrepareMessage& prepare() const;
+  PROTOBUF_NODISCARD ::dsnet::vr::proto::PrepareMessage* release_prepare();
+  ::dsnet::vr::proto::PrepareMessage* mutable_prepare();
+  void set_allocated_prepare(::dsnet::vr::proto::PrepareMessage* prepare);
+  private:
+  const ::dsnet::vr::proto::PrepareMessage& _internal_prepare() const;
+  ::dsnet::vr::proto::PrepareMessage* _internal_mutable_prepare();
+  public:
+  void unsafe_arena_set_allocated_prepare(
+      ::dsnet::vr::proto::PrepareMessage* prepare);
+  ::dsnet::vr::proto::PrepareMessage* unsafe_arena_release_prepare();
+
+  // .dsnet.vr.proto.PrepareOKMessage prepare_ok = 4;
+  bool has_prepare_ok() const;
+  private:
+  bool _internal_has_prepare_ok() const;
+  public:
+  void clear_prepare_ok();
+  const ::dsnet::vr::proto::PrepareOKMessage& prepare_ok() const;
+  PROTOBUF_NODISCARD ::dsnet::vr::proto::PrepareOKMessage* release_prepare_ok();
+  ::dsnet::vr::proto::PrepareOKMessage* mutable_prepare_ok();
+  void set_allocated_prepare_ok(::dsnet::vr::proto::PrepareOKMessage* prepare_ok);
+  private:
+  const ::dsnet::vr::proto::PrepareOKMessage& _internal_prepare_ok() const;
+  ::dsnet::vr::proto::PrepareOKMessage* _internal_mutable_prepare_ok();
+  public:
+  void unsafe_arena_set_allocated_prepare_ok(
+      ::dsnet::vr::proto::PrepareOKMessage* prepare_ok);
+  ::dsnet::vr::proto::PrepareOKMessage* unsafe_arena_release_prepare_ok();
+
+  // .dsnet.vr.proto.CommitMessage commit = 5;
+  bool has_commit() const;
+  private:
+  bool _internal_has_commit() const;
+  public:
+  void clear_commit();
+  const ::dsnet::vr::proto::CommitMessage& commit() const;
+  PROTOBUF_NODISCARD ::dsnet::vr::proto::CommitMessage* release_commit();
+  ::dsnet::vr::proto::CommitMessage* mutable_commit();
+  void set_allocated_commit(::dsnet::vr::proto::CommitMessage* commit);
+  private:
+  const ::dsnet::vr::proto::CommitMessage& _internal_commit() const;
+  ::dsnet::vr::proto::CommitMessage* _internal_mutable_commit();
+  public:
+  void unsafe_arena_set_allocated_commit(
+      ::dsnet::vr::proto::CommitMessage* commit);
+  ::dsnet::vr::proto::CommitMessage* unsafe_arena_release_commit();
+
+  // .dsnet.vr.proto.RequestStateTransferMessage request_state_transfer = 6;
+  bool has_request_state_transfer() const;
+  private:
+  bool _internal_has_request_state_transfer() const;
+  public:
+  void clear_request_state_transfer();
+  const ::dsnet::vr::proto::RequestStateTransferMessage& request_state_transfer() const;
+  PROTOBUF_NODISCARD ::dsnet::vr::proto::RequestStateTransferMessage* release_request_state_transfer();
+  ::dsnet::vr::proto::RequestStateTransferMessage* mutable_request_state_transfer();
+  void set_allocated_request_state_transfer(::dsnet::vr::proto::RequestStateTransferMessage* request_state_transfer);
+  private:
+  const ::dsnet::vr::proto::RequestStateTransferMessage& _internal_request_state_transfer() const;
+  ::dsnet::vr::proto::RequestStateTransferMessage* _internal_mutable_request_state_transfer();
+  public:
+  void unsafe_arena_set_allocated_request_state_transfer(
+      ::dsnet::vr::proto::RequestStateTransferMessage* request_state_transfer);
+  ::dsnet::vr::proto::RequestStateTransferMessage* unsafe_arena_release_request_state_transfer();
+
+  // .dsnet.vr.proto.StateTransferMessage state_transfer = 7;
+  bool has_state_transfer() const;
+  private:
+  bool _internal_has_state_transfer() const;
+  public:
+  void clear_state_transfer();
+  const ::dsnet::vr::proto::StateTransferMessage& state_transfer() const;
+  PROTOBUF_NODISCARD ::dsnet::vr::proto::StateTransferMessage* release_state_transfer();
+  ::dsnet::vr::proto::StateTransferMessage* mutable_state_transfer();
+  void set_allocated_state_transfer(::dsnet::vr::proto::StateTransferMessage* state_transfer);
+  private:
+  const ::dsnet::vr::proto::StateTransferMessage& _internal_state_transfer() const;
+  ::dsnet::vr::proto::StateTransferMessage* _internal_mutable_state_transfer();
+  public:
+  void unsafe_arena_set_allocated_state_transfer(
+      ::dsnet::vr::proto::StateTransferMessage* state_transfer);
+  ::dsnet::vr::proto::StateTransferMessage* unsafe_arena_release_state_transfer();
+
+  // .dsnet.vr.proto.StartViewChangeMessage start_view_change = 8;
+  bool has_start_view_change() const;
+  private:
+  bool _internal_has_start_view_change() const;
+  public:
+  void clear_start_view_change();
+  const ::dsnet::vr::proto::StartViewChangeMessage& start_view_change() const;
+  PROTOBUF_NODISCARD ::dsnet::vr::proto::StartViewChangeMessage* release_start_view_change();
+  ::dsnet::vr::proto::StartViewChangeMessage* mutable_start_view_change();
+  void set_allocated_start_view_change(::dsnet::vr::proto::StartViewChangeMessage* start_view_change);
+  private:
+  const ::dsnet::vr::proto::StartViewChangeMessage& _internal_start_view_change() const;
+  ::dsnet::vr::proto::StartViewChangeMessage* _internal_mutable_start_view_change();
+  public:
+  void unsafe_arena_set_allocated_start_view_change(
+      ::dsnet::vr::proto::StartViewChangeMessage* start_view_change);
+  ::dsnet::vr::proto::StartViewChangeMessage* unsafe_arena_release_start_view_change();
+
+  // .dsnet.vr.proto.DoViewChangeMessage do_view_change = 9;
+  bool has_do_view_change() const;
+  private:
+  bool _internal_has_do_view_change() const;
+  public:
+  void clear_do_view_change();
+  const ::dsnet::vr::proto::DoViewChangeMessage& do_view_change() const;
+  PROTOBUF_NODISCARD ::dsnet::vr::proto::DoViewChangeMessage* release_do_view_change();
+  ::dsnet::vr::proto::DoViewChangeMessage* mutable_do_view_change();
+  void set_allocated_do_view_change(::dsnet::vr::proto::DoViewChangeMessage* do_view_change);
+  private:
+  const ::dsnet::vr::proto::DoViewChangeMessage& _internal_do_view_change() const;
+  ::dsnet::vr::proto::DoViewChangeMessage* _internal_mutable_do_view_change();
+  public:
+  void unsafe_arena_set_allocated_do_view_change(
+      ::dsnet::vr::proto::DoViewChangeMessage* do_view_change);
+  ::dsnet::vr::proto::DoViewChangeMessage* unsafe_arena_release_do_view_change();
+
+  // .dsnet.vr.proto.StartViewMessage start_view = 10;
+  bool has_start_view() const;
+  private:
+  bool _internal_has_start_view() const;
+  public:
+  void clear_start_view();
+  const ::dsnet::vr::proto::StartViewMessage& start_view() const;
+  PROTOBUF_NODISCARD ::dsnet::vr::proto::StartViewMessage* release_start_view();
+  ::dsnet::vr::proto::StartViewMessage* mutable_start_view();
+  void set_allocated_start_view(::dsnet::vr::proto::StartViewMessage* start_view);
+  private:
+  const ::dsnet::vr::proto::StartViewMessage& _internal_start_view() const;
+  ::dsnet::vr::proto::StartViewMessage* _internal_mutable_start_view();
+  public:
+  void unsafe_arena_set_allocated_start_view(
+      ::dsnet::vr::proto::StartViewMessage* start_view);
+  ::dsnet::vr::proto::StartViewMessage* unsafe_arena_release_start_view();
+
+  // .dsnet.vr.proto.RecoveryMessage recovery = 11;
+  bool has_recovery() const;
+  private:
+  bool _internal_has_recovery() const;
+  public:
+  void clear_recovery();
+  const ::dsnet::vr::proto::RecoveryMessage& recovery() const;
+  PROTOBUF_NODISCARD ::dsnet::vr::proto::RecoveryMessage* release_recovery();
+  ::dsnet::vr::proto::RecoveryMessage* mutable_recovery();
+  void set_allocated_recovery(::dsnet::vr::proto::RecoveryMessage* recovery);
+  private:
+  const ::dsnet::vr::proto::RecoveryMessage& _internal_recovery() const;
+  ::dsnet::vr::proto::RecoveryMessage* _internal_mutable_recovery();
+  public:
+  void unsafe_arena_set_allocated_recovery(
+      ::dsnet::vr::proto::RecoveryMessage* recovery);
+  ::dsnet::vr::proto::RecoveryMessage* unsafe_arena_release_recovery();
+
+  // .dsnet.vr.proto.RecoveryResponseMessage recovery_response = 12;
+  bool has_recovery_response() const;
+  private:
+  bool _internal_has_recovery_response() const;
+  public:
+  void clear_recovery_response();
+  const ::dsnet::vr::proto::RecoveryResponseMessage& recovery_response() const;
+  PROTOBUF_NODISCARD ::dsnet::vr::proto::RecoveryResponseMessage* release_recovery_response();
+  ::dsnet::vr::proto::RecoveryResponseMessage* mutable_recovery_response();
+  void set_allocated_recovery_response(::dsnet::vr::proto::RecoveryResponseMessage* recovery_response);
+  private:
+  const ::dsnet::vr::proto::RecoveryResponseMessage& _internal_recovery_response() const;
+  ::dsnet::vr::proto::RecoveryResponseMessage* _internal_mutable_recovery_response();
+  public:
+  void unsafe_arena_set_allocated_recovery_response(
+      ::dsnet::vr::proto::RecoveryResponseMessage* recovery_response);
+  ::dsnet::vr::proto::RecoveryResponseMessage* unsafe_arena_release_recovery_response();
+
+  void clear_msg();
+  MsgCase msg_case() const;
+  // @@protoc_insertion_point(class_scope:dsnet.vr.proto.ToReplicaMessage)
+ private:
+  class _Internal;
+  void set_has_request();
+  void set_has_unlogged_request();
+  void set_has_prepare();
+  void set_has_prepare_ok();
+  void set_has_commit();
+  void set_has_request_state_transfer();
+  void set_has_state_transfer();
+  void set_has_start_view_change();
+  void set_has_do_view_change();
+  void set_has_start_view();
+  void set_has_recovery();
+  void set_has_recovery_response();
+
+  inline bool has_msg() const;
+  inline void clear_has_msg();
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    union MsgUnion {
+      constexpr MsgUnion() : _constinit_{} {}
+        ::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized _constinit_;
+      ::dsnet::vr::proto::RequestMessage* request_;
+      ::dsnet::vr::proto::UnloggedRequestMessage* unlogged_request_;
+      ::dsnet::vr::proto::PrepareMessage* prepare_;
+      ::dsnet::vr::proto::PrepareOKMessage* prepare_ok_;
+      ::dsnet::vr::proto::CommitMessage* commit_;
+      ::dsnet::vr::proto::RequestStateTransferMessage* request_state_transfer_;
+      ::dsnet::vr::proto::StateTransferMessage* state_transfer_;
+      ::dsnet::vr::proto::StartViewChangeMessage* start_view_change_;
+      ::dsnet::vr::proto::DoViewChangeMessage* do_view_change_;
+      ::dsnet::vr::proto::StartViewMessage* start_view_;
+      ::dsnet::vr::proto::RecoveryMessage* recovery_;
+      ::dsnet::vr::proto::RecoveryResponseMessage* recovery_response_;
+    } msg_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    uint32_t _oneof_case_[1];
+
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_replication_2fvr_2fvr_2dproto_2eproto;
+};
+// ===================================================================
+
+
+// ===================================================================
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
+#endif  // __GNUC__
+// ReplyMessage
+
+// required uint64 view = 1;
+inline bool ReplyMessage::_internal_has_view() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool ReplyMessage::has_view() const {
+  return _internal_has_view();
+}
+inline void ReplyMessage::clear_view() {
+  _impl_.view_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline uint64_t ReplyMessage::_internal_view() const {
+  return _impl_.view_;
+}
+inline uint64_t ReplyMessage::view() const {
+  // @@protoc_insertion_point(field_get:dsnet.vr.proto.ReplyMessage.view)
+  return _internal_view();
+}
+inline void ReplyMessage::_internal_set_view(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.view_ = value;
+}
+inline void ReplyMessage::set_view(uint64_t value) {
+  _internal_set_view(value);
+  // @@protoc_insertion_point(field_set:dsnet.vr.proto.ReplyMessage.view)
+}
+
+// required uint64 opnum = 2;
+inline bool ReplyMessage::_internal_has_opnum() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool ReplyMessage::has_opnum() const {
+  return _internal_has_opnum();
+}
+inline void ReplyMessage::clear_opnum() {
+  _impl_.opnum_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline uint64_t ReplyMessage::_internal_opnum() const {
+  return _impl_.opnum_;
+}
+inline uint64_t ReplyMessage::opnum() const {
+  // @@protoc_insertion_point(field_get:dsnet.vr.proto.ReplyMessage.opnum)
+  return _internal_opnum();
+}
+inline void ReplyMessage::_internal_set_opnum(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.opnum_ = value;
+}
+inline void ReplyMessage::set_opnum(uint64_t value) {
+  _internal_set_opnum(value);
+  // @@protoc_insertion_point(field_set:dsnet.vr.proto.ReplyMessage.opnum)
+}
+
+// required bytes reply = 3;
+inline bool ReplyMessage::_internal_has_reply() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool ReplyMessage::has_reply() const {
+  return _internal_has_reply();
+}
+inline void ReplyMessage::clear_reply() {
+  _impl_.reply_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& ReplyMessage::reply() const {
+  // @@protoc_insertion_point(field_get:dsnet.vr.proto.ReplyMessage.reply)
+  return _internal_reply();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void ReplyMessage::set_reply(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.reply_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:dsnet.vr.proto.ReplyMessage.reply)
+}
+inline std::string* ReplyMessage::mutable_reply() {
+  std::string* _s = _internal_mutable_reply();
+  // @@protoc_insertion_point(field_mutable:dsnet.vr.proto.ReplyMessage.reply)
+  return _s;
+}
+inline const std::string& ReplyMessage::_internal_reply() const {
+  return _impl_.reply_.Get();
+}
+inline void ReplyMessage::_internal_set_reply(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.reply_.Set(value, GetArenaForAllocation());
+}
+inline std::string* ReplyMessage::_internal_mutable_reply() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.reply_.Mutable(GetArenaForAllocation());
+}
+inline std::string* ReplyMessage::release_reply() {
+  // @@protoc_insertion_point(field_release:dsnet.vr.proto.ReplyMessage.reply)
+  if (!_internal_has_reply()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.reply_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.reply_.IsDefault()) {
+    _impl_.reply_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void ReplyMessage::set_allocated_reply(std::string* reply) {
+  if (reply != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.reply_.SetAllocated(reply, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.reply_.IsDefault()) {
+    _impl_.reply_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:dsnet.vr.proto.ReplyMessage.reply)
+}
+
+// required uint64 clientreqid = 4;
+inline bool ReplyMessage::_internal_has_clientreqid() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  return value;
+}
+inline bool ReplyMessage::has_clientreqid() const {
+  return _internal_has_clientreqid();
+}
+inline void ReplyMessage::clear_clientreqid() {
+  _impl_.clientreqid_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000008u;
+}
+inline uint64_t ReplyMessage::_internal_clientreqid() const {
+  return _impl_.clientreqid_;
+}
+inline uint64_t ReplyMessage::clientreqid() const {
+  // @@protoc_insertion_point(field_get:dsnet.vr.proto.ReplyMessage.clientreqid)
+  return _internal_clientreqid();
+}
+inline void ReplyMessage::_internal_set_clientreqid(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  _impl_.clientreqid_ = value;
+}
+inline void ReplyMessage::set_clientreqid(uint64_t value) {
+  _internal_set_clientreqid(value);
+  // @@protoc_insertion_point(field_set:dsnet.vr.proto.ReplyMessage.clientreqid)
+}
+
+// -------------------------------------------------------------------
+
+// UnloggedReplyMessage
+
+// required bytes reply = 1;
+inline bool UnloggedReplyMessage::_internal_has_reply() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool UnloggedReplyMessage::has_reply() const {
+  return _internal_has_reply();
+}
+inline void UnloggedReplyMessage::clear_reply() {
+  _impl_.reply_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& UnloggedReplyMessage::reply() const {
+  // @@protoc_insertion_point(field_get:dsnet.vr.proto.UnloggedReplyMessage.reply)
+  return _internal_reply();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void UnloggedReplyMessage::set_reply(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.reply_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:dsnet.vr.proto.UnloggedReplyMessage.reply)
+}
+inline std::string* UnloggedReplyMessage::mutable_reply() {
+  std::string* _s = _internal_mutable_reply();
+  // @@protoc_insertion_point(field_mutable:dsnet.vr.proto.UnloggedReplyMessage.reply)
+  return _s;
+}
+inline const std::string& UnloggedReplyMessage::_internal_reply() const {
+  return _impl_.reply_.Get();
+}
+inline void UnloggedReplyMessage::_internal_set_reply(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.reply_.Set(value, GetArenaForAllocation());
+}
+inline std::string* UnloggedReplyMessage::_internal_mutable_reply() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.reply_.Mutable(GetArenaForAllocation());
+}
+inline std::string* UnloggedReplyMessage::release_reply() {
+  // @@protoc_insertion_point(field_release:dsnet.vr.proto.UnloggedReplyMessage.reply)
+  if (!_internal_has_reply()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.reply_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.reply_.IsDefault()) {
+    _impl_.reply_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void UnloggedReplyMessage::set_allocated_reply(std::string* reply) {
+  if (reply != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.reply_.SetAllocated(reply, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.reply_.IsDefault()) {
+    _impl_.reply_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:dsnet.vr.proto.UnloggedReplyMessage.reply)
+}
+
+// -------------------------------------------------------------------
+
+// ToClientMessage
+
+// .dsnet.vr.proto.ReplyMessage reply = 1;
+inline bool ToClientMessage::_internal_has_reply() const {
+  return msg_case() == kReply;
+}
+inline bool ToClientMessage::has_reply() const {
+  return _internal_has_reply();
+}
+inline void ToClientMessage::set_has_reply() {
+  _impl_._oneof_case_[0] = kReply;
+}
+inline void ToClientMessage::clear_reply() {
+  if (_internal_has_reply()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.msg_.reply_;
+    }
+    clear_has_msg();
+  }
+}
+inline ::dsnet::vr::proto::ReplyMessage* ToClientMessage::release_reply() {
+  // @@protoc_insertion_point(field_release:dsnet.vr.proto.ToClientMessage.reply)
+  if (_internal_has_reply()) {
+    clear_has_msg();
+    ::dsnet::vr::proto::ReplyMessage* temp = _impl_.msg_.reply_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.msg_.reply_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::dsnet::vr::proto::ReplyMessage& ToClientMessage::_internal_reply() const {
+  return _internal_has_reply()
+      ? *_impl_.msg_.reply_
+      : reinterpret_cast< ::dsnet::vr::proto::ReplyMessage&>(::dsnet::vr::proto::_ReplyMessage_default_instance_);
+}
+inline const ::dsnet::vr::proto::ReplyMessage& ToClientMessage::reply() const {
+  // @@protoc_insertion_point(field_get:dsnet.vr.proto.ToClientMessage.reply)
+  return _internal_reply();
+}
+inline ::dsnet::vr::proto::ReplyMessage* ToClientMessage::unsafe_arena_release_reply() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:dsnet.vr.proto.ToClientMessage.reply)
+  if (_internal_has_reply()) {
+    clear_has_msg();
+    ::dsnet::vr::proto::ReplyMessage* temp = _impl_.msg_.reply_;
+    _impl_.msg_.reply_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void ToClientMessage::unsafe_arena_set_allocated_reply(::dsnet::vr::proto::ReplyMessage* reply) {
+  clear_msg();
+  if (reply) {
+    set_has_reply();
+    _impl_.msg_.reply_ = reply;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:dsnet.vr.proto.ToClientMessage.reply)
+}
+inline ::dsnet::vr::proto::ReplyMessage* ToClientMessage::_internal_mutable_reply() {
+  if (!_internal_has_reply()) {
+    clear_msg();
+    set_has_reply();
+    _impl_.msg_.reply_ = CreateMaybeMessage< ::dsnet::vr::proto::ReplyMessage >(GetArenaForAllocation());
+  }
+  return _impl_.msg_.reply_;
+}
+inline ::dsnet::vr::proto::ReplyMessage* ToClientMessage::mutable_reply() {
+  ::dsnet::vr::proto::ReplyMessage* _msg = _internal_mutable_reply();
+  // @@protoc_insertion_point(field_mutable:dsnet.vr.proto.ToClientMessage.reply)
+  return _msg;
+}
+
+// .dsnet.vr.proto.UnloggedReplyMessage unlogged_reply = 2;
+inline bool ToClientMessage::_internal_has_unlogged_reply() const {
+  return msg_case() == kUnloggedReply;
+}
+inline bool ToClientMessage::has_unlogged_reply() const {
+  return _internal_has_unlogged_reply();
+}
+inline void ToClientMessage::set_has_unlogged_reply() {
+  _impl_._oneof_case_[0] = kUnloggedReply;
+}
+inline void ToClientMessage::clear_unlogged_reply() {
+  if (_internal_has_unlogged_reply()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.msg_.unlogged_reply_;
+    }
+    clear_has_msg();
+  }
+}
+inline ::dsnet::vr::proto::UnloggedReplyMessage* ToClientMessage::release_unlogged_reply() {
+  // @@protoc_insertion_point(field_release:dsnet.vr.proto.ToClientMessage.unlogged_reply)
+  if (_internal_has_unlogged_reply()) {
+    clear_has_msg();
+    ::dsnet::vr::proto::UnloggedReplyMessage* temp = _impl_.msg_.unlogged_reply_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.msg_.unlogged_reply_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::dsnet::vr::proto::UnloggedReplyMessage& ToClientMessage::_internal_unlogged_reply() const {
+  return _internal_has_unlogged_reply()
+      ? *_impl_.msg_.unlogged_reply_
+      : reinterpret_cast< ::dsnet::vr::proto::UnloggedReplyMessage&>(::dsnet::vr::proto::_UnloggedReplyMessage_default_instance_);
+}
+inline const ::dsnet::vr::proto::UnloggedReplyMessage& ToClientMessage::unlogged_reply() const {
+  // @@protoc_insertion_point(field_get:dsnet.vr.proto.ToClientMessage.unlogged_reply)
+  return _internal_unlogged_reply();
+}
+inline ::dsnet::vr::proto::UnloggedReplyMessage* ToClientMessage::unsafe_arena_release_unlogged_reply() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:dsnet.vr.proto.ToClientMessage.unlogged_reply)
+  if (_internal_has_unlogged_reply()) {
+    clear_has_msg();
+    ::dsnet::vr::proto::UnloggedReplyMessage* temp = _impl_.msg_.unlogged_reply_;
+    _impl_.msg_.unlogged_reply_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void ToClientMessage::unsafe_arena_set_allocated_unlogged_reply(::dsnet::vr::proto::UnloggedReplyMessage* unlogged_reply) {
+  clear_msg();
+  if (unlogged_reply) {
+    set_has_unlogged_reply();
+    _impl_.msg_.unlogged_reply_ = unlogged_reply;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:dsnet.vr.proto.ToClientMessage.unlogged_reply)
+}
+inline ::dsnet::vr::proto::UnloggedReplyMessage* ToClientMessage::_internal_mutable_unlogged_reply() {
+  if (!_internal_has_unlogged_reply()) {
+    clear_msg();
+    set_has_unlogged_reply();
+    _impl_.msg_.unlogged_reply_ = CreateMaybeMessage< ::dsnet::vr::proto::UnloggedReplyMessage >(GetArenaForAllocation());
+  }
+  return _impl_.msg_.unlogged_reply_;
+}
+inline ::dsnet::vr::proto::UnloggedReplyMessage* ToClientMessage::mutable_unlogged_reply() {
+  ::dsnet::vr::proto::UnloggedReplyMessage* _msg = _internal_mutable_unlogged_reply();
+  // @@protoc_insertion_point(field_mutable:dsnet.vr.proto.ToClientMessage.unlogged_reply)
+  return _msg;
+}
+
+inline bool ToClientMessage::has_msg() const {
+  return msg_case() != MSG_NOT_SET;
+}
+inline void ToClientMessage::clear_has_msg() {
+  _impl_._oneof_case_[0] = MSG_NOT_SET;
+}
+inline ToClientMessage::MsgCase ToClientMessage::msg_case() const {
+  return ToClientMessage::MsgCase(_impl_._oneof_case_[0]);
+}
+// -------------------------------------------------------------------
+
+// RequestMessage
+
+// required .dsnet.Request req = 1;
+inline bool RequestMessage::_internal_has_req() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.req_ != nullptr);
+  return value;
+}
+inline bool RequestMessage::has_req() const {
+  return _internal_has_req();
+}
+inline const ::dsnet::Request& RequestMessage::_internal_req() const {
+  const ::dsnet::Request* p = _impl_.req_;
+  return p != nullptr ? *p : reinterpret_cast<const ::dsnet::Request&>(
+      ::dsnet::_Request_default_instance_);
+}
+inline const ::dsnet::Request& RequestMessage::req() const {
+  // @@protoc_insertion_point(field_get:dsnet.vr.proto.RequestMessage.req)
+  return _internal_req();
+}
+inline void RequestMessage::unsafe_arena_set_allocated_req(
+    ::dsnet::Request* req) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.req_);
+  }
+  _impl_.req_ = req;
+  if (req) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:dsnet.vr.proto.RequestMessage.req)
+}
+inline ::dsnet::Request* RequestMessage::release_req() {
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::dsnet::Request* temp = _impl_.req_;
+  _impl_.req_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::dsnet::Request* RequestMessage::unsafe_arena_release_req() {
+  // @@protoc_insertion_point(field_release:dsnet.vr.proto.RequestMessage.req)
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::dsnet::Request* temp = _impl_.req_;
+  _impl_.req_ = nullptr;
+  return temp;
+}
+inline ::dsnet::Request* RequestMessage::_internal_mutable_req() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  if (_impl_.req_ == nullptr) {
+    auto* p = CreateMaybeMessage<::dsnet::Request>(GetArenaForAllocation());
+    _impl_.req_ = p;
+  }
+  return _impl_.req_;
+}
+inline ::dsnet::Request* RequestMessage::mutable_req() {
+  ::dsnet::Request* _msg = _internal_mutable_req();
+  // @@protoc_insertion_point(field_mutable:dsnet.vr.proto.RequestMessage.req)
+  return _msg;
+}
+inline void RequestMessage::set_allocated_req(::dsnet::Request* req) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete reinterpret_cast< ::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.req_);
+  }
+  if (req) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(
+                reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(req));
+    if (message_arena != submessage_arena) {
+      req = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, req, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.req_ = req;
+  // @@protoc_insertion_point(field_set_allocated:dsnet.vr.proto.RequestMessage.req)
+}
+
+// -------------------------------------------------------------------
+
+// UnloggedRequestMessage
+
+// required .dsnet.UnloggedRequest req = 1;
+inline bool UnloggedRequestMessage::_internal_has_req() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.req_ != nullptr);
+  return value;
+}
+inline bool UnloggedRequestMessage::has_req() const {
+  return _internal_has_req();
+}
+inline const ::dsnet::UnloggedRequest& UnloggedRequestMessage::_internal_req() const {
+  const ::dsnet::UnloggedRequest* p = _impl_.req_;
+  return p != nullptr ? *p : reinterpret_cast<const ::dsnet::UnloggedRequest&>(
+      ::dsnet::_UnloggedRequest_default_instance_);
+}
+inline const ::dsnet::UnloggedRequest& UnloggedRequestMessage::req() const {
+  // @@protoc_insertion_point(field_get:dsnet.vr.proto.UnloggedRequestMessage.req)
+  return _internal_req();
+}
+inline void UnloggedRequestMessage::unsafe_arena_set_allocated_req(
+    ::dsnet::UnloggedRequest* req) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.req_);
+  }
+  _impl_.req_ = req;
+  if (req) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:dsnet.vr.proto.UnloggedRequestMessage.req)
+}
+inline ::dsnet::UnloggedRequest* UnloggedRequestMessage::release_req() {
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::dsnet::UnloggedRequest* temp = _impl_.req_;
+  _impl_.req_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::dsnet::UnloggedRequest* UnloggedRequestMessage::unsafe_arena_release_req() {
+  // @@protoc_insertion_point(field_release:dsnet.vr.proto.UnloggedRequestMessage.req)
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::dsnet::UnloggedRequest* temp = _impl_.req_;
+  _impl_.req_ = nullptr;
+  return temp;
+}
+inline ::dsnet::UnloggedRequest* UnloggedRequestMessage::_internal_mutable_req() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  if (_impl_.req_ == nullptr) {
+    auto* p = CreateMaybeMessage<::dsnet::UnloggedRequest>(GetArenaForAllocation());
+    _impl_.req_ = p;
+  }
+  return _impl_.req_;
+}
+inline ::dsnet::UnloggedRequest* UnloggedRequestMessage::mutable_req() {
+  ::dsnet::UnloggedRequest* _msg = _internal_mutable_req();
+  // @@protoc_insertion_point(field_mutable:dsnet.vr.proto.UnloggedRequestMessage.req)
+  return _msg;
+}
+inline void UnloggedRequestMessage::set_allocated_req(::dsnet::UnloggedRequest* req) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete reinterpret_cast< ::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.req_);
+  }
+  if (req) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(
+                reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(req));
+    if (message_arena != submessage_arena) {
+      req = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, req, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.req_ = req;
+  // @@protoc_insertion_point(field_set_allocated:dsnet.vr.proto.UnloggedRequestMessage.req)
+}
+
+// -------------------------------------------------------------------
+
+// PrepareMessage
+
+// required uint64 view = 1;
+inline bool PrepareMessage::_internal_has_view() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool PrepareMessage::has_view() const {
+  return _internal_has_view();
+}
+inline void PrepareMessage::clear_view() {
+  _impl_.view_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline uint64_t PrepareMessage::_internal_view() const {
+  return _impl_.view_;
+}
+inline uint64_t PrepareMessage::view() const {
+  // @@protoc_insertion_point(field_get:dsnet.vr.proto.PrepareMessage.view)
+  return _internal_view();
+}
+inline void PrepareMessage::_internal_set_view(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.view_ = value;
+}
+inline void PrepareMessage::set_view(uint64_t value) {
+  _internal_set_view(value);
+  // @@protoc_insertion_point(field_set:dsnet.vr.proto.PrepareMessage.view)
+}
+
+// required uint64 opnum = 2;
+inline bool PrepareMessage::_internal_has_opnum() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool PrepareMessage::has_opnum() const {
+  return _internal_has_opnum();
+}
+inline void PrepareMessage::clear_opnum() {
+  _impl_.opnum_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline uint64_t PrepareMessage::_internal_opnum() const {
+  return _impl_.opnum_;
+}
+inline uint64_t PrepareMessage::opnum() const {
+  // @@protoc_insertion_point(field_get:dsnet.vr.proto.PrepareMessage.opnum)
+  return _internal_opnum();
+}
+inline void PrepareMessage::_internal_set_opnum(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.opnum_ = value;
+}
+inline void PrepareMessage::set_opnum(uint64_t value) {
+  _internal_set_opnum(value);
+  // @@protoc_insertion_point(field_set:dsnet.vr.proto.PrepareMessage.opnum)
+}
+
+// required uint64 batchstart = 3;
+inline bool PrepareMessage::_internal_has_batchstart() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool PrepareMessage::has_batchstart() const {
+  return _internal_has_batchstart();
+}
+inline void PrepareMessage::clear_batchstart() {
+  _impl_.batchstart_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline uint64_t PrepareMessage::_internal_batchstart() const {
+  return _impl_.batchstart_;
+}
+inline uint64_t PrepareMessage::batchstart() const {
+  // @@protoc_insertion_point(field_get:dsnet.vr.proto.PrepareMessage.batchstart)
+  return _internal_batchstart();
+}
+inline void PrepareMessage::_internal_set_batchstart(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.batchstart_ = value;
+}
+inline void PrepareMessage::set_batchstart(uint64_t value) {
+  _internal_set_batchstart(value);
+  // @@protoc_insertion_point(field_set:dsnet.vr.proto.PrepareMessage.batchstart)
+}
+
+// repeated .dsnet.Request request = 4;
+inline int PrepareMessage::_internal_request_size() const {
+  return _impl_.request_.size();
+}
+inline int PrepareMessage::request_size() const {
+  return _internal_request_size();
+}
+inline ::dsnet::Request* PrepareMessage::mutable_request(int index) {
+  // @@protoc_insertion_point(field_mutable:dsnet.vr.proto.PrepareMessage.request)
+  return _impl_.request_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::dsnet::Request >*
+PrepareMessage::mutable_request() {
+  // @@protoc_insertion_point(field_mutable_list:dsnet.vr.proto.PrepareMessage.request)
+  return &_impl_.request_;
+}
+inline const ::dsnet::Request& PrepareMessage::_internal_request(int index) const {
+  return _impl_.request_.Get(index);
+}
+inline const ::dsnet::Request& PrepareMessage::request(int index) const {
+  // @@protoc_insertion_point(field_get:dsnet.vr.proto.PrepareMessage.request)
+  return _internal_request(index);
+}
+inline ::dsnet::Request* PrepareMessage::_internal_add_request() {
+  return _impl_.request_.Add();
+}
+inline ::dsnet::Request* PrepareMessage::add_request() {
+  ::dsnet::Request* _add = _internal_add_request();
+  // @@protoc_insertion_point(field_add:dsnet.vr.proto.PrepareMessage.request)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::dsnet::Request >&
+PrepareMessage::request() const {
+  // @@protoc_insertion_point(field_list:dsnet.vr.proto.PrepareMessage.request)
+  return _impl_.request_;
+}
+
+// -------------------------------------------------------------------
+
+// PrepareOKMessage
+
+// required uint64 view = 1;
+inline bool PrepareOKMessage::_internal_has_view() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool PrepareOKMessage::has_view() const {
+  return _internal_has_view();
+}
+inline void PrepareOKMessage::clear_view() {
+  _impl_.view_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline uint64_t PrepareOKMessage::_internal_view() const {
+  return _impl_.view_;
+}
+inline uint64_t PrepareOKMessage::view() const {
+  // @@protoc_insertion_point(field_get:dsnet.vr.proto.PrepareOKMessage.view)
+  return _internal_view();
+}
+inline void PrepareOKMessage::_internal_set_view(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.view_ = value;
+}
+inline void PrepareOKMessage::set_view(uint64_t value) {
+  _internal_set_view(value);
+  // @@protoc_insertion_point(field_set:dsnet.vr.proto.PrepareOKMessage.view)
+}
+
+// required uint64 opnum = 2;
+inline bool PrepareOKMessage::_internal_has_opnum() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool PrepareOKMessage::has_opnum() const {
+  return _internal_has_opnum();
+}
+inline void PrepareOKMessage::clear_opnum() {
+  _impl_.opnum_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline uint64_t PrepareOKMessage::_internal_opnum() const {
+  return _impl_.opnum_;
+}
+inline uint64_t PrepareOKMessage::opnum() const {
+  // @@protoc_insertion_point(field_get:dsnet.vr.proto.PrepareOKMessage.opnum)
+  return _internal_opnum();
+}
+inline void PrepareOKMessage::_internal_set_opnum(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.opnum_ = value;
+}
+inline void PrepareOKMessage::set_opnum(uint64_t value) {
+  _internal_set_opnum(value);
+  // @@protoc_insertion_point(field_set:dsnet.vr.proto.PrepareOKMessage.opnum)
+}
+
+// required uint32 replicaIdx = 3;
+inline bool PrepareOKMessage::_internal_has_replicaidx() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool PrepareOKMessage::has_replicaidx() const {
+  return _internal_has_replicaidx();
+}
+inline void PrepareOKMessage::clear_replicaidx() {
+  _impl_.replicaidx_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline uint32_t PrepareOKMessage::_internal_replicaidx() const {
+  return _impl_.replicaidx_;
+}
+inline uint32_t PrepareOKMessage::replicaidx() const {
+  // @@protoc_insertion_point(field_get:dsnet.vr.proto.PrepareOKMessage.replicaIdx)
+  return _internal_replicaidx();
+}
+inline void PrepareOKMessage::_internal_set_replicaidx(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.replicaidx_ = value;
+}
+inline void PrepareOKMessage::set_replicaidx(uint32_t value) {
+  _internal_set_replicaidx(value);
+  // @@protoc_insertion_point(field_set:dsnet.vr.proto.PrepareOKMessage.replicaIdx)
+}
+
+// -------------------------------------------------------------------
+
+// CommitMessage
+
+// required uint64 view = 1;
+inline bool CommitMessage::_internal_has_view() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool CommitMessage::has_view() const {
+  return _internal_has_view();
+}
+inline void CommitMessage::clear_view() {
+  _impl_.view_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline uint64_t CommitMessage::_internal_view() const {
+  return _impl_.view_;
+}
+inline uint64_t CommitMessage::view() const {
+  // @@protoc_insertion_point(field_get:dsnet.vr.proto.CommitMessage.view)
+  return _internal_view();
+}
+inline void CommitMessage::_internal_set_view(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.view_ = value;
+}
+inline void CommitMessage::set_view(uint64_t value) {
+  _internal_set_view(value);
+  // @@protoc_insertion_point(field_set:dsnet.vr.proto.CommitMessage.view)
+}
+
+// required uint64 opnum = 2;
+inline bool CommitMessage::_internal_has_opnum() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool CommitMessage::has_opnum() const {
+  return _internal_has_opnum();
+}
+inline void CommitMessage::clear_opnum() {
+  _impl_.opnum_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline uint64_t CommitMessage::_internal_opnum() const {
+  return _impl_.opnum_;
+}
+inline uint64_t CommitMessage::opnum() const {
+  // @@protoc_insertion_point(field_get:dsnet.vr.proto.CommitMessage.opnum)
+  return _internal_opnum();
+}
+inline void CommitMessage::_internal_set_opnum(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.opnum_ = value;
+}
+inline void CommitMessage::set_opnum(uint64_t value) {
+  _internal_set_opnum(value);
+  // @@protoc_insertion_point(field_set:dsnet.vr.proto.CommitMessage.opnum)
+}
+
+// -------------------------------------------------------------------
+
+// RequestStateTransferMessage
+
+// required uint64 view = 1;
+inline bool RequestStateTransferMessage::_internal_has_view() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool RequestStateTransferMessage::has_view() const {
+  return _internal_has_view();
+}
+inline void RequestStateTransferMessage::clear_view() {
+  _impl_.view_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline uint64_t RequestStateTransferMessage::_internal_view() const {
+  return _impl_.view_;
+}
+inline uint64_t RequestStateTransferMessage::view() const {
+  // @@protoc_insertion_point(field_get:dsnet.vr.proto.RequestStateTransferMessage.view)
+  return _internal_view();
+}
+inline void RequestStateTransferMessage::_internal_set_view(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.view_ = value;
+}
+inline void RequestStateTransferMessage::set_view(uint64_t value) {
+  _internal_set_view(value);
+  // @@protoc_insertion_point(field_set:dsnet.vr.proto.RequestStateTransferMessage.view)
+}
+
+// required uint64 opnum = 2;
+inline bool RequestStateTransferMessage::_internal_has_opnum() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool RequestStateTransferMessage::has_opnum() const {
+  return _internal_has_opnum();
+}
+inline void RequestStateTransferMessage::clear_opnum() {
+  _impl_.opnum_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline uint64_t RequestStateTransferMessage::_internal_opnum() const {
+  return _impl_.opnum_;
+}
+inline uint64_t RequestStateTransferMessage::opnum() const {
+  // @@protoc_insertion_point(field_get:dsnet.vr.proto.RequestStateTransferMessage.opnum)
+  return _internal_opnum();
+}
+inline void RequestStateTransferMessage::_internal_set_opnum(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.opnum_ = value;
+}
+inline void RequestStateTransferMessage::set_opnum(uint64_t value) {
+  _internal_set_opnum(value);
+  // @@protoc_insertion_point(field_set:dsnet.vr.proto.RequestStateTransferMessage.opnum)
+}
+
+// -------------------------------------------------------------------
+
+// StateTransferMessage
+
+// required uint64 view = 1;
+inline bool StateTransferMessage::_internal_has_view() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool StateTransferMessage::has_view() const {
+  return _internal_has_view();
+}
+inline void StateTransferMessage::clear_view() {
+  _impl_.view_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline uint64_t StateTransferMessage::_internal_view() const {
+  return _impl_.view_;
+}
+inline uint64_t StateTransferMessage::view() const {
+  // @@protoc_insertion_point(field_get:dsnet.vr.proto.StateTransferMessage.view)
+  return _internal_view();
+}
+inline void StateTransferMessage::_internal_set_view(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.view_ = value;
+}
+inline void StateTransferMessage::set_view(uint64_t value) {
+  _internal_set_view(value);
+  // @@protoc_insertion_point(field_set:dsnet.vr.proto.StateTransferMessage.view)
+}
+
+// required uint64 opnum = 2;
+inline bool StateTransferMessage::_internal_has_opnum() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool StateTransferMessage::has_opnum() const {
+  return _internal_has_opnum();
+}
+inline void StateTransferMessage::clear_opnum() {
+  _impl_.opnum_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline uint64_t StateTransferMessage::_internal_opnum() const {
+  return _impl_.opnum_;
+}
+inline uint64_t StateTransferMessage::opnum() const {
+  // @@protoc_insertion_point(field_get:dsnet.vr.proto.StateTransferMessage.opnum)
+  return _internal_opnum();
+}
+inline void StateTransferMessage::_internal_set_opnum(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.opnum_ = value;
+}
+inline void StateTransferMessage::set_opnum(uint64_t value) {
+  _internal_set_opnum(value);
+  // @@protoc_insertion_point(field_set:dsnet.vr.proto.StateTransferMessage.opnum)
+}
+
+// repeated .dsnet.MsgLogEntry entries = 3;
+inline int StateTransferMessage::_internal_entries_size() const {
+  return _impl_.entries_.size();
+}
+inline int StateTransferMessage::entries_size() const {
+  return _internal_entries_size();
+}
+inline ::dsnet::MsgLogEntry* StateTransferMessage::mutable_entries(int index) {
+  // @@protoc_insertion_point(field_mutable:dsnet.vr.proto.StateTransferMessage.entries)
+  return _impl_.entries_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::dsnet::MsgLogEntry >*
+StateTransferMessage::mutable_entries() {
+  // @@protoc_insertion_point(field_mutable_list:dsnet.vr.proto.StateTransferMessage.entries)
+  return &_impl_.entries_;
+}
+inline const ::dsnet::MsgLogEntry& StateTransferMessage::_internal_entries(int index) const {
+  return _impl_.entries_.Get(index);
+}
+inline const ::dsnet::MsgLogEntry& StateTransferMessage::entries(int index) const {
+  // @@protoc_insertion_point(field_get:dsnet.vr.proto.StateTransferMessage.entries)
+  return _internal_entries(index);
+}
+inline ::dsnet::MsgLogEntry* StateTransferMessage::_internal_add_entries() {
+  return _impl_.entries_.Add();
+}
+inline ::dsnet::MsgLogEntry* StateTransferMessage::add_entries() {
+  ::dsnet::MsgLogEntry* _add = _internal_add_entries();
+  // @@protoc_insertion_point(field_add:dsnet.vr.proto.StateTransferMessage.entries)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::dsnet::MsgLogEntry >&
+StateTransferMessage::entries() const {
+  // @@protoc_insertion_point(field_list:dsnet.vr.proto.StateTransferMessage.entries)
+  return _impl_.entries_;
+}
+
+// -------------------------------------------------------------------
+
+// StartViewChangeMessage
+
+// required uint64 view = 1;
+inline bool StartViewChangeMessage::_internal_has_view() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool StartViewChangeMessage::has_view() const {
+  return _internal_has_view();
+}
+inline void StartViewChangeMessage::clear_view() {
+  _impl_.view_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline uint64_t StartViewChangeMessage::_internal_view() const {
+  return _impl_.view_;
+}
+inline uint64_t StartViewChangeMessage::view() const {
+  // @@protoc_insertion_point(field_get:dsnet.vr.proto.StartViewChangeMessage.view)
+  return _internal_view();
+}
+inline void StartViewChangeMessage::_internal_set_view(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.view_ = value;
+}
+inline void StartViewChangeMessage::set_view(uint64_t value) {
+  _internal_set_view(value);
+  // @@protoc_insertion_point(field_set:dsnet.vr.proto.StartViewChangeMessage.view)
+}
+
+// required uint32 replicaIdx = 2;
+inline bool StartViewChangeMessage::_internal_has_replicaidx() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool StartViewChangeMessage::has_replicaidx() const {
+  return _internal_has_replicaidx();
+}
+inline void StartViewChangeMessage::clear_replicaidx() {
+  _impl_.replicaidx_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline uint32_t StartViewChangeMessage::_internal_replicaidx() const {
+  return _impl_.replicaidx_;
+}
+inline uint32_t StartViewChangeMessage::replicaidx() const {
+  // @@protoc_insertion_point(field_get:dsnet.vr.proto.StartViewChangeMessage.replicaIdx)
+  return _internal_replicaidx();
+}
+inline void StartViewChangeMessage::_internal_set_replicaidx(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.replicaidx_ = value;
+}
+inline void StartViewChangeMessage::set_replicaidx(uint32_t value) {
+  _internal_set_replicaidx(value);
+  // @@protoc_insertion_point(field_set:dsnet.vr.proto.StartViewChangeMessage.replicaIdx)
+}
+
+// required uint64 lastCommitted = 3;
+inline bool StartViewChangeMessage::_internal_has_lastcommitted() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool StartViewChangeMessage::has_lastcommitted() const {
+  return _internal_has_lastcommitted();
+}
+inline void StartViewChangeMessage::clear_lastcommitted() {
+  _impl_.lastcommitted_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline uint64_t StartViewChangeMessage::_internal_lastcommitted() const {
+  return _impl_.lastcommitted_;
+}
+inline uint64_t StartViewChangeMessage::lastcommitted() const {
+  // @@protoc_insertion_point(field_get:dsnet.vr.proto.StartViewChangeMessage.lastCommitted)
+  return _internal_lastcommitted();
+}
+inline void StartViewChangeMessage::_internal_set_lastcommitted(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.lastcommitted_ = value;
+}
+inline void StartViewChangeMessage::set_lastcommitted(uint64_t value) {
+  _internal_set_lastcommitted(value);
+  // @@protoc_insertion_point(field_set:dsnet.vr.proto.StartViewChangeMessage.lastCommitted)
+}
+
+// -------------------------------------------------------------------
+
+// DoViewChangeMessage
+
+// required uint64 view = 1;
+inline bool DoViewChangeMessage::_internal_has_view() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool DoViewChangeMessage::has_view() const {
+  return _internal_has_view();
+}
+inline void DoViewChangeMessage::clear_view() {
+  _impl_.view_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline uint64_t DoViewChangeMessage::_internal_view() const {
+  return _impl_.view_;
+}
+inline uint64_t DoViewChangeMessage::view() const {
+  // @@protoc_insertion_point(field_get:dsnet.vr.proto.DoViewChangeMessage.view)
+  return _internal_view();
+}
+inline void DoViewChangeMessage::_internal_set_view(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.view_ = value;
+}
+inline void DoViewChangeMessage::set_view(uint64_t value) {
+  _internal_set_view(value);
+  // @@protoc_insertion_point(field_set:dsnet.vr.proto.DoViewChangeMessage.view)
+}
+
+// required uint64 lastNormalView = 2;
+inline bool DoViewChangeMessage::_internal_has_lastnormalview() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool DoViewChangeMessage::has_lastnormalview() const {
+  return _internal_has_lastnormalview();
+}
+inline void DoViewChangeMessage::clear_lastnormalview() {
+  _impl_.lastnormalview_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline uint64_t DoViewChangeMessage::_internal_lastnormalview() const {
+  return _impl_.lastnormalview_;
+}
+inline uint64_t DoViewChangeMessage::lastnormalview() const {
+  // @@protoc_insertion_point(field_get:dsnet.vr.proto.DoViewChangeMessage.lastNormalView)
+  return _internal_lastnormalview();
+}
+inline void DoViewChangeMessage::_internal_set_lastnormalview(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.lastnormalview_ = value;
+}
+inline void DoViewChangeMessage::set_lastnormalview(uint64_t value) {
+  _internal_set_lastnormalview(value);
+  // @@protoc_insertion_point(field_set:dsnet.vr.proto.DoViewChangeMessage.lastNormalView)
+}
+
+// required uint64 lastOp = 3;
+inline bool DoViewChangeMessage::_internal_has_lastop() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool DoViewChangeMessage::has_lastop() const {
+  return _internal_has_lastop();
+}
+inline void DoViewChangeMessage::clear_lastop() {
+  _impl_.lastop_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline uint64_t DoViewChangeMessage::_internal_lastop() const {
+  return _impl_.lastop_;
+}
+inline uint64_t DoViewChangeMessage::lastop() const {
+  // @@protoc_insertion_point(field_get:dsnet.vr.proto.DoViewChangeMessage.lastOp)
+  return _internal_lastop();
+}
+inline void DoViewChangeMessage::_internal_set_lastop(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.lastop_ = value;
+}
+inline void DoViewChangeMessage::set_lastop(uint64_t value) {
+  _internal_set_lastop(value);
+  // @@protoc_insertion_point(field_set:dsnet.vr.proto.DoViewChangeMessage.lastOp)
+}
+
+// required uint64 lastCommitted = 4;
+inline bool DoViewChangeMessage::_internal_has_lastcommitted() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  return value;
+}
+inline bool DoViewChangeMessage::has_lastcommitted() const {
+  return _internal_has_lastcommitted();
+}
+inline void DoViewChangeMessage::clear_lastcommitted() {
+  _impl_.lastcommitted_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000008u;
+}
+inline uint64_t DoViewChangeMessage::_internal_lastcommitted() const {
+  return _impl_.lastcommitted_;
+}
+inline uint64_t DoViewChangeMessage::lastcommitted() const {
+  // @@protoc_insertion_point(field_get:dsnet.vr.proto.DoViewChangeMessage.lastCommitted)
+  return _internal_lastcommitted();
+}
+inline void DoViewChangeMessage::_internal_set_lastcommitted(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  _impl_.lastcommitted_ = value;
+}
+inline void DoViewChangeMessage::set_lastcommitted(uint64_t value) {
+  _internal_set_lastcommitted(value);
+  // @@protoc_insertion_point(field_set:dsnet.vr.proto.DoViewChangeMessage.lastCommitted)
+}
+
+// repeated .dsnet.MsgLogEntry entries = 5;
+inline int DoViewChangeMessage::_internal_entries_size() const {
+  return _impl_.entries_.size();
+}
+inline int DoViewChangeMessage::entries_size() const {
+  return _internal_entries_size();
+}
+inline ::dsnet::MsgLogEntry* DoViewChangeMessage::mutable_entries(int index) {
+  // @@protoc_insertion_point(field_mutable:dsnet.vr.proto.DoViewChangeMessage.entries)
+  return _impl_.entries_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::dsnet::MsgLogEntry >*
+DoViewChangeMessage::mutable_entries() {
+  // @@protoc_insertion_point(field_mutable_list:dsnet.vr.proto.DoViewChangeMessage.entries)
+  return &_impl_.entries_;
+}
+inline const ::dsnet::MsgLogEntry& DoViewChangeMessage::_internal_entries(int index) const {
+  return _impl_.entries_.Get(index);
+}
+inline const ::dsnet::MsgLogEntry& DoViewChangeMessage::entries(int index) const {
+  // @@protoc_insertion_point(field_get:dsnet.vr.proto.DoViewChangeMessage.entries)
+  return _internal_entries(index);
+}
+inline ::dsnet::MsgLogEntry* DoViewChangeMessage::_internal_add_entries() {
+  return _impl_.entries_.Add();
+}
+inline ::dsnet::MsgLogEntry* DoViewChangeMessage::add_entries() {
+  ::dsnet::MsgLogEntry* _add = _internal_add_entries();
+  // @@protoc_insertion_point(field_add:dsnet.vr.proto.DoViewChangeMessage.entries)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::dsnet::MsgLogEntry >&
+DoViewChangeMessage::entries() const {
+  // @@protoc_insertion_point(field_list:dsnet.vr.proto.DoViewChangeMessage.entries)
+  return _impl_.entries_;
+}
+
+// required uint32 replicaIdx = 6;
+inline bool DoViewChangeMessage::_internal_has_replicaidx() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000010u) != 0;
+  return value;
+}
+inline bool DoViewChangeMessage::has_replicaidx() const {
+  return _internal_has_replicaidx();
+}
+inline void DoViewChangeMessage::clear_replicaidx() {
+  _impl_.replicaidx_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000010u;
+}
+inline uint32_t DoViewChangeMessage::_internal_replicaidx() const {
+  return _impl_.replicaidx_;
+}
+inline uint32_t DoViewChangeMessage::replicaidx() const {
+  // @@protoc_insertion_point(field_get:dsnet.vr.proto.DoViewChangeMessage.replicaIdx)
+  return _internal_replicaidx();
+}
+inline void DoViewChangeMessage::_internal_set_replicaidx(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000010u;
+  _impl_.replicaidx_ = value;
+}
+inline void DoViewChangeMessage::set_replicaidx(uint32_t value) {
+  _internal_set_replicaidx(value);
+  // @@protoc_insertion_point(field_set:dsnet.vr.proto.DoViewChangeMessage.replicaIdx)
+}
+
+// -------------------------------------------------------------------
+
+// StartViewMessage
+
+// required uint64 view = 1;
+inline bool StartViewMessage::_internal_has_view() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool StartViewMessage::has_view() const {
+  return _internal_has_view();
+}
+inline void StartViewMessage::clear_view() {
+  _impl_.view_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline uint64_t StartViewMessage::_internal_view() const {
+  return _impl_.view_;
+}
+inline uint64_t StartViewMessage::view() const {
+  // @@protoc_insertion_point(field_get:dsnet.vr.proto.StartViewMessage.view)
+  return _internal_view();
+}
+inline void StartViewMessage::_internal_set_view(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.view_ = value;
+}
+inline void StartViewMessage::set_view(uint64_t value) {
+  _internal_set_view(value);
+  // @@protoc_insertion_point(field_set:dsnet.vr.proto.StartViewMessage.view)
+}
+
+// required uint64 lastOp = 2;
+inline bool StartViewMessage::_internal_has_lastop() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool StartViewMessage::has_lastop() const {
+  return _internal_has_lastop();
+}
+inline void StartViewMessage::clear_lastop() {
+  _impl_.lastop_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline uint64_t StartViewMessage::_internal_lastop() const {
+  return _impl_.lastop_;
+}
+inline uint64_t StartViewMessage::lastop() const {
+  // @@protoc_insertion_point(field_get:dsnet.vr.proto.StartViewMessage.lastOp)
+  return _internal_lastop();
+}
+inline void StartViewMessage::_internal_set_lastop(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.lastop_ = value;
+}
+inline void StartViewMessage::set_lastop(uint64_t value) {
+  _internal_set_lastop(value);
+  // @@protoc_insertion_point(field_set:dsnet.vr.proto.StartViewMessage.lastOp)
+}
+
+// required uint64 lastCommitted = 3;
+inline bool StartViewMessage::_internal_has_lastcommitted() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool StartViewMessage::has_lastcommitted() const {
+  return _internal_has_lastcommitted();
+}
+inline void StartViewMessage::clear_lastcommitted() {
+  _impl_.lastcommitted_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline uint64_t StartViewMessage::_internal_lastcommitted() const {
+  return _impl_.lastcommitted_;
+}
+inline uint64_t StartViewMessage::lastcommitted() const {
+  // @@protoc_insertion_point(field_get:dsnet.vr.proto.StartViewMessage.lastCommitted)
+  return _internal_lastcommitted();
+}
+inline void StartViewMessage::_internal_set_lastcommitted(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.lastcommitted_ = value;
+}
+inline void StartViewMessage::set_lastcommitted(uint64_t value) {
+  _internal_set_lastcommitted(value);
+  // @@protoc_insertion_point(field_set:dsnet.vr.proto.StartViewMessage.lastCommitted)
+}
+
+// repeated .dsnet.MsgLogEntry entries = 4;
+inline int StartViewMessage::_internal_entries_size() const {
+  return _impl_.entries_.size();
+}
+inline int StartViewMessage::entries_size() const {
+  return _internal_entries_size();
+}
+inline ::dsnet::MsgLogEntry* StartViewMessage::mutable_entries(int index) {
+  // @@protoc_insertion_point(field_mutable:dsnet.vr.proto.StartViewMessage.entries)
+  return _impl_.entries_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::dsnet::MsgLogEntry >*
+StartViewMessage::mutable_entries() {
+  // @@protoc_insertion_point(field_mutable_list:dsnet.vr.proto.StartViewMessage.entries)
+  return &_impl_.entries_;
+}
+inline const ::dsnet::MsgLogEntry& StartViewMessage::_internal_entries(int index) const {
+  return _impl_.entries_.Get(index);
+}
+inline const ::dsnet::MsgLogEntry& StartViewMessage::entries(int index) const {
+  // @@protoc_insertion_point(field_get:dsnet.vr.proto.StartViewMessage.entries)
+  return _internal_entries(index);
+}
+inline ::dsnet::MsgLogEntry* StartViewMessage::_internal_add_entries() {
+  return _impl_.entries_.Add();
+}
+inline ::dsnet::MsgLogEntry* StartViewMessage::add_entries() {
+  ::dsnet::MsgLogEntry* _add = _internal_add_entries();
+  // @@protoc_insertion_point(field_add:dsnet.vr.proto.StartViewMessage.entries)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::dsnet::MsgLogEntry >&
+StartViewMessage::entries() const {
+  // @@protoc_insertion_point(field_list:dsnet.vr.proto.StartViewMessage.entries)
+  return _impl_.entries_;
+}
+
+// -------------------------------------------------------------------
+
+// RecoveryMessage
+
+// required uint32 replicaIdx = 1;
+inline bool RecoveryMessage::_internal_has_replicaidx() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool RecoveryMessage::has_replicaidx() const {
+  return _internal_has_replicaidx();
+}
+inline void RecoveryMessage::clear_replicaidx() {
+  _impl_.replicaidx_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline uint32_t RecoveryMessage::_internal_replicaidx() const {
+  return _impl_.replicaidx_;
+}
+inline uint32_t RecoveryMessage::replicaidx() const {
+  // @@protoc_insertion_point(field_get:dsnet.vr.proto.RecoveryMessage.replicaIdx)
+  return _internal_replicaidx();
+}
+inline void RecoveryMessage::_internal_set_replicaidx(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.replicaidx_ = value;
+}
+inline void RecoveryMessage::set_replicaidx(uint32_t value) {
+  _internal_set_replicaidx(value);
+  // @@protoc_insertion_point(field_set:dsnet.vr.proto.RecoveryMessage.replicaIdx)
+}
+
+// required uint64 nonce = 2;
+inline bool RecoveryMessage::_internal_has_nonce() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool RecoveryMessage::has_nonce() const {
+  return _internal_has_nonce();
+}
+inline void RecoveryMessage::clear_nonce() {
+  _impl_.nonce_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline uint64_t RecoveryMessage::_internal_nonce() const {
+  return _impl_.nonce_;
+}
+inline uint64_t RecoveryMessage::nonce() const {
+  // @@protoc_insertion_point(field_get:dsnet.vr.proto.RecoveryMessage.nonce)
+  return _internal_nonce();
+}
+inline void RecoveryMessage::_internal_set_nonce(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.nonce_ = value;
+}
+inline void RecoveryMessage::set_nonce(uint64_t value) {
+  _internal_set_nonce(value);
+  // @@protoc_insertion_point(field_set:dsnet.vr.proto.RecoveryMessage.nonce)
+}
+
+// -------------------------------------------------------------------
+
+// RecoveryResponseMessage
+
+// required uint64 view = 1;
+inline bool RecoveryResponseMessage::_internal_has_view() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool RecoveryResponseMessage::has_view() const {
+  return _internal_has_view();
+}
+inline void RecoveryResponseMessage::clear_view() {
+  _impl_.view_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline uint64_t RecoveryResponseMessage::_internal_view() const {
+  return _impl_.view_;
+}
+inline uint64_t RecoveryResponseMessage::view() const {
+  // @@protoc_insertion_point(field_get:dsnet.vr.proto.RecoveryResponseMessage.view)
+  return _internal_view();
+}
+inline void RecoveryResponseMessage::_internal_set_view(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.view_ = value;
+}
+inline void RecoveryResponseMessage::set_view(uint64_t value) {
+  _internal_set_view(value);
+  // @@protoc_insertion_point(field_set:dsnet.vr.proto.RecoveryResponseMessage.view)
+}
+
+// required uint64 nonce = 2;
+inline bool RecoveryResponseMessage::_internal_has_nonce() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool RecoveryResponseMessage::has_nonce() const {
+  return _internal_has_nonce();
+}
+inline void RecoveryResponseMessage::clear_nonce() {
+  _impl_.nonce_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline uint64_t RecoveryResponseMessage::_internal_nonce() const {
+  return _impl_.nonce_;
+}
+inline uint64_t RecoveryResponseMessage::nonce() const {
+  // @@protoc_insertion_point(field_get:dsnet.vr.proto.RecoveryResponseMessage.nonce)
+  return _internal_nonce();
+}
+inline void RecoveryResponseMessage::_internal_set_nonce(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.nonce_ = value;
+}
+inline void RecoveryResponseMessage::set_nonce(uint64_t value) {
+  _internal_set_nonce(value);
+  // @@protoc_insertion_point(field_set:dsnet.vr.proto.RecoveryResponseMessage.nonce)
+}
+
+// repeated .dsnet.MsgLogEntry entries = 3;
+inline int RecoveryResponseMessage::_internal_entries_size() const {
+  return _impl_.entries_.size();
+}
+inline int RecoveryResponseMessage::entries_size() const {
+  return _internal_entries_size();
+}
+inline ::dsnet::MsgLogEntry* RecoveryResponseMessage::mutable_entries(int index) {
+  // @@protoc_insertion_point(field_mutable:dsnet.vr.proto.RecoveryResponseMessage.entries)
+  return _impl_.entries_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::dsnet::MsgLogEntry >*
+RecoveryResponseMessage::mutable_entries() {
+  // @@protoc_insertion_point(field_mutable_list:dsnet.vr.proto.RecoveryResponseMessage.entries)
+  return &_impl_.entries_;
+}
+inline const ::dsnet::MsgLogEntry& RecoveryResponseMessage::_internal_entries(int index) const {
+  return _impl_.entries_.Get(index);
+}
+inline const ::dsnet::MsgLogEntry& RecoveryResponseMessage::entries(int index) const {
+  // @@protoc_insertion_point(field_get:dsnet.vr.proto.RecoveryResponseMessage.entries)
+  return _internal_entries(index);
+}
+inline ::dsnet::MsgLogEntry* RecoveryResponseMessage::_internal_add_entries() {
+  return _impl_.entries_.Add();
+}
+inline ::dsnet::MsgLogEntry* RecoveryResponseMessage::add_entries() {
+  ::dsnet::MsgLogEntry* _add = _internal_add_entries();
+  // @@protoc_insertion_point(field_add:dsnet.vr.proto.RecoveryResponseMessage.entries)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::dsnet::MsgLogEntry >&
+RecoveryResponseMessage::entries() const {
+  // @@protoc_insertion_point(field_list:dsnet.vr.proto.RecoveryResponseMessage.entries)
+  return _impl_.entries_;
+}
+
+// optional uint64 lastOp = 4;
+inline bool RecoveryResponseMessage::_internal_has_lastop() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool RecoveryResponseMessage::has_lastop() const {
+  return _internal_has_lastop();
+}
+inline void RecoveryResponseMessage::clear_lastop() {
+  _impl_.lastop_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline uint64_t RecoveryResponseMessage::_internal_lastop() const {
+  return _impl_.lastop_;
+}
+inline uint64_t RecoveryResponseMessage::lastop() const {
+  // @@protoc_insertion_point(field_get:dsnet.vr.proto.RecoveryResponseMessage.lastOp)
+  return _internal_lastop();
+}
+inline void RecoveryResponseMessage::_internal_set_lastop(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.lastop_ = value;
+}
+inline void RecoveryResponseMessage::set_lastop(uint64_t value) {
+  _internal_set_lastop(value);
+  // @@protoc_insertion_point(field_set:dsnet.vr.proto.RecoveryResponseMessage.lastOp)
+}
+
+// optional uint64 lastCommitted = 5;
+inline bool RecoveryResponseMessage::_internal_has_lastcommitted() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  return value;
+}
+inline bool RecoveryResponseMessage::has_lastcommitted() const {
+  return _internal_has_lastcommitted();
+}
+inline void RecoveryResponseMessage::clear_lastcommitted() {
+  _impl_.lastcommitted_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000008u;
+}
+inline uint64_t RecoveryResponseMessage::_internal_lastcommitted() const {
+  return _impl_.lastcommitted_;
+}
+inline uint64_t RecoveryResponseMessage::lastcommitted() const {
+  // @@protoc_insertion_point(field_get:dsnet.vr.proto.RecoveryResponseMessage.lastCommitted)
+  return _internal_lastcommitted();
+}
+inline void RecoveryResponseMessage::_internal_set_lastcommitted(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  _impl_.lastcommitted_ = value;
+}
+inline void RecoveryResponseMessage::set_lastcommitted(uint64_t value) {
+  _internal_set_lastcommitted(value);
+  // @@protoc_insertion_point(field_set:dsnet.vr.proto.RecoveryResponseMessage.lastCommitted)
+}
+
+// required uint32 replicaIdx = 6;
+inline bool RecoveryResponseMessage::_internal_has_replicaidx() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000010u) != 0;
+  return value;
+}
+inline bool RecoveryResponseMessage::has_replicaidx() const {
+  return _internal_has_replicaidx();
+}
+inline void RecoveryResponseMessage::clear_replicaidx() {
+  _impl_.replicaidx_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000010u;
+}
+inline uint32_t RecoveryResponseMessage::_internal_replicaidx() const {
+  return _impl_.replicaidx_;
+}
+inline uint32_t RecoveryResponseMessage::replicaidx() const {
+  // @@protoc_insertion_point(field_get:dsnet.vr.proto.RecoveryResponseMessage.replicaIdx)
+  return _internal_replicaidx();
+}
+inline void RecoveryResponseMessage::_internal_set_replicaidx(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000010u;
+  _impl_.replicaidx_ = value;
+}
+inline void RecoveryResponseMessage::set_replicaidx(uint32_t value) {
+  _internal_set_replicaidx(value);
+  // @@protoc_insertion_point(field_set:dsnet.vr.proto.RecoveryResponseMessage.replicaIdx)
+}
+
+// -------------------------------------------------------------------
+
+// ToReplicaMessage
+
+// .dsnet.vr.proto.RequestMessage request = 1;
+inline bool ToReplicaMessage::_internal_has_request() const {
+  return msg_case() == kRequest;
+}
+inline bool ToReplicaMessage::has_request() const {
+  return _internal_has_request();
+}
+inline void ToReplicaMessage::set_has_request() {
+  _impl_._oneof_case_[0] = kRequest;
+}
+inline void ToReplicaMessage::clear_request() {
+  if (_internal_has_request()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.msg_.request_;
+    }
+    clear_has_msg();
+  }
+}
+inline ::dsnet::vr::proto::RequestMessage* ToReplicaMessage::release_request() {
+  // @@protoc_insertion_point(field_release:dsnet.vr.proto.ToReplicaMessage.request)
+  if (_internal_has_request()) {
+    clear_has_msg();
+    ::dsnet::vr::proto::RequestMessage* temp = _impl_.msg_.request_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.msg_.request_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::dsnet::vr::proto::RequestMessage& ToReplicaMessage::_internal_request() const {
+  return _internal_has_request()
+      ? *_impl_.msg_.request_
+      : reinterpret_cast< ::dsnet::vr::proto::RequestMessage&>(::dsnet::vr::proto::_RequestMessage_default_instance_);
+}
+inline const ::dsnet::vr::proto::RequestMessage& ToReplicaMessage::request() const {
+  // @@protoc_insertion_point(field_get:dsnet.vr.proto.ToReplicaMessage.request)
+  return _internal_request();
+}
+inline ::dsnet::vr::proto::RequestMessage* ToReplicaMessage::unsafe_arena_release_request() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:dsnet.vr.proto.ToReplicaMessage.request)
+  if (_internal_has_request()) {
+    clear_has_msg();
+    ::dsnet::vr::proto::RequestMessage* temp = _impl_.msg_.request_;
+    _impl_.msg_.request_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void ToReplicaMessage::unsafe_arena_set_allocated_request(::dsnet::vr::proto::RequestMessage* request) {
+  clear_msg();
+  if (request) {
+    set_has_request();
+    _impl_.msg_.request_ = request;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:dsnet.vr.proto.ToReplicaMessage.request)
+}
+inline ::dsnet::vr::proto::RequestMessage* ToReplicaMessage::_internal_mutable_request() {
+  if (!_internal_has_request()) {
+    clear_msg();
+    set_has_request();
+    _impl_.msg_.request_ = CreateMaybeMessage< ::dsnet::vr::proto::RequestMessage >(GetArenaForAllocation());
+  }
+  return _impl_.msg_.request_;
+}
+inline ::dsnet::vr::proto::RequestMessage* ToReplicaMessage::mutable_request() {
+  ::dsnet::vr::proto::RequestMessage* _msg = _internal_mutable_request();
+  // @@protoc_insertion_point(field_mutable:dsnet.vr.proto.ToReplicaMessage.request)
+  return _msg;
+}
+
+// .dsnet.vr.proto.UnloggedRequestMessage unlogged_request = 2;
+inline bool ToReplicaMessage::_internal_has_unlogged_request() const {
+  return msg_case() == kUnloggedRequest;
+}
+inline bool ToReplicaMessage::has_unlogged_request() const {
+  return _internal_has_unlogged_request();
+}
+inline void ToReplicaMessage::set_has_unlogged_request() {
+  _impl_._oneof_case_[0] = kUnloggedRequest;
+}
+inline void ToReplicaMessage::clear_unlogged_request() {
+  if (_internal_has_unlogged_request()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.msg_.unlogged_request_;
+    }
+    clear_has_msg();
+  }
+}
+inline ::dsnet::vr::proto::UnloggedRequestMessage* ToReplicaMessage::release_unlogged_request() {
+  // @@protoc_insertion_point(field_release:dsnet.vr.proto.ToReplicaMessage.unlogged_request)
+  if (_internal_has_unlogged_request()) {
+    clear_has_msg();
+    ::dsnet::vr::proto::UnloggedRequestMessage* temp = _impl_.msg_.unlogged_request_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.msg_.unlogged_request_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::dsnet::vr::proto::UnloggedRequestMessage& ToReplicaMessage::_internal_unlogged_request() const {
+  return _internal_has_unlogged_request()
+      ? *_impl_.msg_.unlogged_request_
+      : reinterpret_cast< ::dsnet::vr::proto::UnloggedRequestMessage&>(::dsnet::vr::proto::_UnloggedRequestMessage_default_instance_);
+}
+inline const ::dsnet::vr::proto::UnloggedRequestMessage& ToReplicaMessage::unlogged_request() const {
+  // @@protoc_insertion_point(field_get:dsnet.vr.proto.ToReplicaMessage.unlogged_request)
+  return _internal_unlogged_request();
+}
+inline ::dsnet::vr::proto::UnloggedRequestMessage* ToReplicaMessage::unsafe_arena_release_unlogged_request() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:dsnet.vr.proto.ToReplicaMessage.unlogged_request)
+  if (_internal_has_unlogged_request()) {
+    clear_has_msg();
+    ::dsnet::vr::proto::UnloggedRequestMessage* temp = _impl_.msg_.unlogged_request_;
+    _impl_.msg_.unlogged_request_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void ToReplicaMessage::unsafe_arena_set_allocated_unlogged_request(::dsnet::vr::proto::UnloggedRequestMessage* unlogged_request) {
+  clear_msg();
+  if (unlogged_request) {
+    set_has_unlogged_request();
+    _impl_.msg_.unlogged_request_ = unlogged_request;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:dsnet.vr.proto.ToReplicaMessage.unlogged_request)
+}
+inline ::dsnet::vr::proto::UnloggedRequestMessage* ToReplicaMessage::_internal_mutable_unlogged_request() {
+  if (!_internal_has_unlogged_request()) {
+    clear_msg();
+    set_has_unlogged_request();
+    _impl_.msg_.unlogged_request_ = CreateMaybeMessage< ::dsnet::vr::proto::UnloggedRequestMessage >(GetArenaForAllocation());
+  }
+  return _impl_.msg_.unlogged_request_;
+}
+inline ::dsnet::vr::proto::UnloggedRequestMessage* ToReplicaMessage::mutable_unlogged_request() {
+  ::dsnet::vr::proto::UnloggedRequestMessage* _msg = _internal_mutable_unlogged_request();
+  // @@protoc_insertion_point(field_mutable:dsnet.vr.proto.ToReplicaMessage.unlogged_request)
+  return _msg;
+}
+
+// .dsnet.vr.proto.PrepareMessage prepare = 3;
+inline bool ToReplicaMessage::_internal_has_prepare() const {
+  return msg_case() == kPrepare;
+}
+inline bool ToReplicaMessage::has_prepare() const {
+  return _internal_has_prepare();
+}
+inline void ToReplicaMessage::set_has_prepare() {
+  _impl_._oneof_case_[0] = kPrepare;
+}
+inline void ToReplicaMessage::clear_prepare() {
+  if (_internal_has_prepare()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.msg_.prepare_;
+    }
+    clear_has_msg();
+  }
+}
+inline ::dsnet::vr::proto::PrepareMessage* ToReplicaMessage::release_prepare() {
+  // @@protoc_insertion_point(field_release:dsnet.vr.proto.ToReplicaMessage.prepare)
+  if (_internal_has_prepare()) {
+    clear_has_msg();
+    ::dsnet::vr::proto::PrepareMessage* temp = _impl_.msg_.prepare_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.msg_.prepare_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::dsnet::vr::proto::PrepareMessage& ToReplicaMessage::_internal_prepare() const {
+  return _internal_has_prepare()
+      ? *_impl_.msg_.prepare_
+      : reinterpret_cast< ::dsnet::vr::proto::PrepareMessage&>(::dsnet::vr::proto::_PrepareMessage_default_instance_);
+}
+inline const ::dsnet::vr::proto::PrepareMessage& ToReplicaMessage::prepare() const {
+  // @@protoc_insertion_point(field_get:dsnet.vr.proto.ToReplicaMessage.prepare)
+  return _internal_prepare();
+}
+inline ::dsnet::vr::proto::PrepareMessage* ToReplicaMessage::unsafe_arena_release_prepare() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:dsnet.vr.proto.ToReplicaMessage.prepare)
+  if (_internal_has_prepare()) {
+    clear_has_msg();
+    ::dsnet::vr::proto::PrepareMessage* temp = _impl_.msg_.prepare_;
+    _impl_.msg_.prepare_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void ToReplicaMessage::unsafe_arena_set_allocated_prepare(::dsnet::vr::proto::PrepareMessage* prepare) {
+  clear_msg();
+  if (prepare) {
+    set_has_prepare();
+    _impl_.msg_.prepare_ = prepare;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:dsnet.vr.proto.ToReplicaMessage.prepare)
+}
+inline ::dsnet::vr::proto::PrepareMessage* ToReplicaMessage::_internal_mutable_prepare() {
+  if (!_internal_has_prepare()) {
+    clear_msg();
+    set_has_prepare();
+    _impl_.msg_.prepare_ = CreateMaybeMessage< ::dsnet::vr::proto::PrepareMessage >(GetArenaForAllocation());
+  }
+  return _impl_.msg_.prepare_;
+}
+inline ::dsnet::vr::proto::PrepareMessage* ToReplicaMessage::mutable_prepare() {
+  ::dsnet::vr::proto::PrepareMessage* _msg = _internal_mutable_prepare();
+  // @@protoc_insertion_point(field_mutable:dsnet.vr.proto.ToReplicaMessage.prepare)
+  return _msg;
+}
+
+// .dsnet.vr.proto.PrepareOKMessage prepare_ok = 4;
+inline bool ToReplicaMessage::_internal_has_prepare_ok() const {
+  return msg_case() == kPrepareOk;
+}
+inline bool ToReplicaMessage::has_prepare_ok() const {
+  return _internal_has_prepare_ok();
+}
+inline void ToReplicaMessage::set_has_prepare_ok() {
+  _impl_._oneof_case_[0] = kPrepareOk;
+}
+inline void ToReplicaMessage::clear_prepare_ok() {
+  if (_internal_has_prepare_ok()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.msg_.prepare_ok_;
+    }
+    clear_has_msg();
+  }
+}
+inline ::dsnet::vr::proto::PrepareOKMessage* ToReplicaMessage::release_prepare_ok() {
+  // @@protoc_insertion_point(field_release:dsnet.vr.proto.ToReplicaMessage.prepare_ok)
+  if (_internal_has_prepare_ok()) {
+    clear_has_msg();
+    ::dsnet::vr::proto::PrepareOKMessage* temp = _impl_.msg_.prepare_ok_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.msg_.prepare_ok_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::dsnet::vr::proto::PrepareOKMessage& ToReplicaMessage::_internal_prepare_ok() const {
+  return _internal_has_prepare_ok()
+      ? *_impl_.msg_.prepare_ok_
+      : reinterpret_cast< ::dsnet::vr::proto::PrepareOKMessage&>(::dsnet::vr::proto::_PrepareOKMessage_default_instance_);
+}
+inline const ::dsnet::vr::proto::PrepareOKMessage& ToReplicaMessage::prepare_ok() const {
+  // @@protoc_insertion_point(field_get:dsnet.vr.proto.ToReplicaMessage.prepare_ok)
+  return _internal_prepare_ok();
+}
+inline ::dsnet::vr::proto::PrepareOKMessage* ToReplicaMessage::unsafe_arena_release_prepare_ok() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:dsnet.vr.proto.ToReplicaMessage.prepare_ok)
+  if (_internal_has_prepare_ok()) {
+    clear_has_msg();
+    ::dsnet::vr::proto::PrepareOKMessage* temp = _impl_.msg_.prepare_ok_;
+    _impl_.msg_.prepare_ok_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void ToReplicaMessage::unsafe_arena_set_allocated_prepare_ok(::dsnet::vr::proto::PrepareOKMessage* prepare_ok) {
+  clear_msg();
+  if (prepare_ok) {
+    set_has_prepare_ok();
+    _impl_.msg_.prepare_ok_ = prepare_ok;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:dsnet.vr.proto.ToReplicaMessage.prepare_ok)
+}
+inline ::dsnet::vr::proto::PrepareOKMessage* ToReplicaMessage::_internal_mutable_prepare_ok() {
+  if (!_internal_has_prepare_ok()) {
+    clear_msg();
+    set_has_prepare_ok();
+    _impl_.msg_.prepare_ok_ = CreateMaybeMessage< ::dsnet::vr::proto::PrepareOKMessage >(GetArenaForAllocation());
+  }
+  return _impl_.msg_.prepare_ok_;
+}
+inline ::dsnet::vr::proto::PrepareOKMessage* ToReplicaMessage::mutable_prepare_ok() {
+  ::dsnet::vr::proto::PrepareOKMessage* _msg = _internal_mutable_prepare_ok();
+  // @@protoc_insertion_point(field_mutable:dsnet.vr.proto.ToReplicaMessage.prepare_ok)
+  return _msg;
+}
+
+// .dsnet.vr.proto.CommitMessage commit = 5;
+inline bool ToReplicaMessage::_internal_has_commit() const {
+  return msg_case() == kCommit;
+}
+inline bool ToReplicaMessage::has_commit() const {
+  return _internal_has_commit();
+}
+inline void ToReplicaMessage::set_has_commit() {
+  _impl_._oneof_case_[0] = kCommit;
+}
+inline void ToReplicaMessage::clear_commit() {
+  if (_internal_has_commit()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.msg_.commit_;
+    }
+    clear_has_msg();
+  }
+}
+inline ::dsnet::vr::proto::CommitMessage* ToReplicaMessage::release_commit() {
+  // @@protoc_insertion_point(field_release:dsnet.vr.proto.ToReplicaMessage.commit)
+  if (_internal_has_commit()) {
+    clear_has_msg();
+    ::dsnet::vr::proto::CommitMessage* temp = _impl_.msg_.commit_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.msg_.commit_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::dsnet::vr::proto::CommitMessage& ToReplicaMessage::_internal_commit() const {
+  return _internal_has_commit()
+      ? *_impl_.msg_.commit_
+      : reinterpret_cast< ::dsnet::vr::proto::CommitMessage&>(::dsnet::vr::proto::_CommitMessage_default_instance_);
+}
+inline const ::dsnet::vr::proto::CommitMessage& ToReplicaMessage::commit() const {
+  // @@protoc_insertion_point(field_get:dsnet.vr.proto.ToReplicaMessage.commit)
+  return _internal_commit();
+}
+inline ::dsnet::vr::proto::CommitMessage* ToReplicaMessage::unsafe_arena_release_commit() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:dsnet.vr.proto.ToReplicaMessage.commit)
+  if (_internal_has_commit()) {
+    clear_has_msg();
+    ::dsnet::vr::proto::CommitMessage* temp = _impl_.msg_.commit_;
+    _impl_.msg_.commit_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void ToReplicaMessage::unsafe_arena_set_allocated_commit(::dsnet::vr::proto::CommitMessage* commit) {
+  clear_msg();
+  if (commit) {
+    set_has_commit();
+    _impl_.msg_.commit_ = commit;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:dsnet.vr.proto.ToReplicaMessage.commit)
+}
+inline ::dsnet::vr::proto::CommitMessage* ToReplicaMessage::_internal_mutable_commit() {
+  if (!_internal_has_commit()) {
+    clear_msg();
+    set_has_commit();
+    _impl_.msg_.commit_ = CreateMaybeMessage< ::dsnet::vr::proto::CommitMessage >(GetArenaForAllocation());
+  }
+  return _impl_.msg_.commit_;
+}
+inline ::dsnet::vr::proto::CommitMessage* ToReplicaMessage::mutable_commit() {
+  ::dsnet::vr::proto::CommitMessage* _msg = _internal_mutable_commit();
+  // @@protoc_insertion_point(field_mutable:dsnet.vr.proto.ToReplicaMessage.commit)
+  return _msg;
+}
+
+// .dsnet.vr.proto.RequestStateTransferMessage request_state_transfer = 6;
+inline bool ToReplicaMessage::_internal_has_request_state_transfer() const {
+  return msg_case() == kRequestStateTransfer;
+}
+inline bool ToReplicaMessage::has_request_state_transfer() const {
+  return _internal_has_request_state_transfer();
+}
+inline void ToReplicaMessage::set_has_request_state_transfer() {
+  _impl_._oneof_case_[0] = kRequestStateTransfer;
+}
+inline void ToReplicaMessage::clear_request_state_transfer() {
+  if (_internal_has_request_state_transfer()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.msg_.request_state_transfer_;
+    }
+    clear_has_msg();
+  }
+}
+inline ::dsnet::vr::proto::RequestStateTransferMessage* ToReplicaMessage::release_request_state_transfer() {
+  // @@protoc_insertion_point(field_release:dsnet.vr.proto.ToReplicaMessage.request_state_transfer)
+  if (_internal_has_request_state_transfer()) {
+    clear_has_msg();
+    ::dsnet::vr::proto::RequestStateTransferMessage* temp = _impl_.msg_.request_state_transfer_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.msg_.request_state_transfer_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::dsnet::vr::proto::RequestStateTransferMessage& ToReplicaMessage::_internal_request_state_transfer() const {
+  return _internal_has_request_state_transfer()
+      ? *_impl_.msg_.request_state_transfer_
+      : reinterpret_cast< ::dsnet::vr::proto::RequestStateTransferMessage&>(::dsnet::vr::proto::_RequestStateTransferMessage_default_instance_);
+}
+inline const ::dsnet::vr::proto::RequestStateTransferMessage& ToReplicaMessage::request_state_transfer() const {
+  // @@protoc_insertion_point(field_get:dsnet.vr.proto.ToReplicaMessage.request_state_transfer)
+  return _internal_request_state_transfer();
+}
+inline ::dsnet::vr::proto::RequestStateTransferMessage* ToReplicaMessage::unsafe_arena_release_request_state_transfer() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:dsnet.vr.proto.ToReplicaMessage.request_state_transfer)
+  if (_internal_has_request_state_transfer()) {
+    clear_has_msg();
+    ::dsnet::vr::proto::RequestStateTransferMessage* temp = _impl_.msg_.request_state_transfer_;
+    _impl_.msg_.request_state_transfer_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void ToReplicaMessage::unsafe_arena_set_allocated_request_state_transfer(::dsnet::vr::proto::RequestStateTransferMessage* request_state_transfer) {
+  clear_msg();
+  if (request_state_transfer) {
+    set_has_request_state_transfer();
+    _impl_.msg_.request_state_transfer_ = request_state_transfer;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:dsnet.vr.proto.ToReplicaMessage.request_state_transfer)
+}
+inline ::dsnet::vr::proto::RequestStateTransferMessage* ToReplicaMessage::_internal_mutable_request_state_transfer() {
+  if (!_internal_has_request_state_transfer()) {
+    clear_msg();
+    set_has_request_state_transfer();
+    _impl_.msg_.request_state_transfer_ = CreateMaybeMessage< ::dsnet::vr::proto::RequestStateTransferMessage >(GetArenaForAllocation());
+  }
+  return _impl_.msg_.request_state_transfer_;
+}
+inline ::dsnet::vr::proto::RequestStateTransferMessage* ToReplicaMessage::mutable_request_state_transfer() {
+  ::dsnet::vr::proto::RequestStateTransferMessage* _msg = _internal_mutable_request_state_transfer();
+  // @@protoc_insertion_point(field_mutable:dsnet.vr.proto.ToReplicaMessage.request_state_transfer)
+  return _msg;
+}
+
+// .dsnet.vr.proto.StateTransferMessage state_transfer = 7;
+inline bool ToReplicaMessage::_internal_has_state_transfer() const {
+  return msg_case() == kStateTransfer;
+}
+inline bool ToReplicaMessage::has_state_transfer() const {
+  return _internal_has_state_transfer();
+}
+inline void ToReplicaMessage::set_has_state_transfer() {
+  _impl_._oneof_case_[0] = kStateTransfer;
+}
+inline void ToReplicaMessage::clear_state_transfer() {
+  if (_internal_has_state_transfer()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.msg_.state_transfer_;
+    }
+    clear_has_msg();
+  }
+}
+inline ::dsnet::vr::proto::StateTransferMessage* ToReplicaMessage::release_state_transfer() {
+  // @@protoc_insertion_point(field_release:dsnet.vr.proto.ToReplicaMessage.state_transfer)
+  if (_internal_has_state_transfer()) {
+    clear_has_msg();
+    ::dsnet::vr::proto::StateTransferMessage* temp = _impl_.msg_.state_transfer_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.msg_.state_transfer_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::dsnet::vr::proto::StateTransferMessage& ToReplicaMessage::_internal_state_transfer() const {
+  return _internal_has_state_transfer()
+      ? *_impl_.msg_.state_transfer_
+      : reinterpret_cast< ::dsnet::vr::proto::StateTransferMessage&>(::dsnet::vr::proto::_StateTransferMessage_default_instance_);
+}
+inline const ::dsnet::vr::proto::StateTransferMessage& ToReplicaMessage::state_transfer() const {
+  // @@protoc_insertion_point(field_get:dsnet.vr.proto.ToReplicaMessage.state_transfer)
+  return _internal_state_transfer();
+}
+inline ::dsnet::vr::proto::StateTransferMessage* ToReplicaMessage::unsafe_arena_release_state_transfer() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:dsnet.vr.proto.ToReplicaMessage.state_transfer)
+  if (_internal_has_state_transfer()) {
+    clear_has_msg();
+    ::dsnet::vr::proto::StateTransferMessage* temp = _impl_.msg_.state_transfer_;
+    _impl_.msg_.state_transfer_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void ToReplicaMessage::unsafe_arena_set_allocated_state_transfer(::dsnet::vr::proto::StateTransferMessage* state_transfer) {
+  clear_msg();
+  if (state_transfer) {
+    set_has_state_transfer();
+    _impl_.msg_.state_transfer_ = state_transfer;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:dsnet.vr.proto.ToReplicaMessage.state_transfer)
+}
+inline ::dsnet::vr::proto::StateTransferMessage* ToReplicaMessage::_internal_mutable_state_transfer() {
+  if (!_internal_has_state_transfer()) {
+    clear_msg();
+    set_has_state_transfer();
+    _impl_.msg_.state_transfer_ = CreateMaybeMessage< ::dsnet::vr::proto::StateTransferMessage >(GetArenaForAllocation());
+  }
+  return _impl_.msg_.state_transfer_;
+}
+inline ::dsnet::vr::proto::StateTransferMessage* ToReplicaMessage::mutable_state_transfer() {
+  ::dsnet::vr::proto::StateTransferMessage* _msg = _internal_mutable_state_transfer();
+  // @@protoc_insertion_point(field_mutable:dsnet.vr.proto.ToReplicaMessage.state_transfer)
+  return _msg;
+}
+
+// .dsnet.vr.proto.StartViewChangeMessage start_view_change = 8;
+inline bool ToReplicaMessage::_internal_has_start_view_change() const {
+  return msg_case() == kStartViewChange;
+}
+inline bool ToReplicaMessage::has_start_view_change() const {
+  return _internal_has_start_view_change();
+}
+inline void ToReplicaMessage::set_has_start_view_change() {
+  _impl_._oneof_case_[0] = kStartViewChange;
+}
+inline void ToReplicaMessage::clear_start_view_change() {
+  if (_internal_has_start_view_change()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.msg_.start_view_change_;
+    }
+    clear_has_msg();
+  }
+}
+inline ::dsnet::vr::proto::StartViewChangeMessage* ToReplicaMessage::release_start_view_change() {
+  // @@protoc_insertion_point(field_release:dsnet.vr.proto.ToReplicaMessage.start_view_change)
+  if (_internal_has_start_view_change()) {
+    clear_has_msg();
+    ::dsnet::vr::proto::StartViewChangeMessage* temp = _impl_.msg_.start_view_change_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.msg_.start_view_change_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::dsnet::vr::proto::StartViewChangeMessage& ToReplicaMessage::_internal_start_view_change() const {
+  return _internal_has_start_view_change()
+      ? *_impl_.msg_.start_view_change_
+      : reinterpret_cast< ::dsnet::vr::proto::StartViewChangeMessage&>(::dsnet::vr::proto::_StartViewChangeMessage_default_instance_);
+}
+inline const ::dsnet::vr::proto::StartViewChangeMessage& ToReplicaMessage::start_view_change() const {
+  // @@protoc_insertion_point(field_get:dsnet.vr.proto.ToReplicaMessage.start_view_change)
+  return _internal_start_view_change();
+}
+inline ::dsnet::vr::proto::StartViewChangeMessage* ToReplicaMessage::unsafe_arena_release_start_view_change() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:dsnet.vr.proto.ToReplicaMessage.start_view_change)
+  if (_internal_has_start_view_change()) {
+    clear_has_msg();
+    ::dsnet::vr::proto::StartViewChangeMessage* temp = _impl_.msg_.start_view_change_;
+    _impl_.msg_.start_view_change_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void ToReplicaMessage::unsafe_arena_set_allocated_start_view_change(::dsnet::vr::proto::StartViewChangeMessage* start_view_change) {
+  clear_msg();
+  if (start_view_change) {
+    set_has_start_view_change();
+    _impl_.msg_.start_view_change_ = start_view_change;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:dsnet.vr.proto.ToReplicaMessage.start_view_change)
+}
+inline ::dsnet::vr::proto::StartViewChangeMessage* ToReplicaMessage::_internal_mutable_start_view_change() {
+  if (!_internal_has_start_view_change()) {
+    clear_msg();
+    set_has_start_view_change();
+    _impl_.msg_.start_view_change_ = CreateMaybeMessage< ::dsnet::vr::proto::StartViewChangeMessage >(GetArenaForAllocation());
+  }
+  return _impl_.msg_.start_view_change_;
+}
+inline ::dsnet::vr::proto::StartViewChangeMessage* ToReplicaMessage::mutable_start_view_change() {
+  ::dsnet::vr::proto::StartViewChangeMessage* _msg = _internal_mutable_start_view_change();
+  // @@protoc_insertion_point(field_mutable:dsnet.vr.proto.ToReplicaMessage.start_view_change)
+  return _msg;
+}
+
+// .dsnet.vr.proto.DoViewChangeMessage do_view_change = 9;
+inline bool ToReplicaMessage::_internal_has_do_view_change() const {
+  return msg_case() == kDoViewChange;
+}
+inline bool ToReplicaMessage::has_do_view_change() const {
+  return _internal_has_do_view_change();
+}
+inline void ToReplicaMessage::set_has_do_view_change() {
+  _impl_._oneof_case_[0] = kDoViewChange;
+}
+inline void ToReplicaMessage::clear_do_view_change() {
+  if (_internal_has_do_view_change()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.msg_.do_view_change_;
+    }
+    clear_has_msg();
+  }
+}
+inline ::dsnet::vr::proto::DoViewChangeMessage* ToReplicaMessage::release_do_view_change() {
+  // @@protoc_insertion_point(field_release:dsnet.vr.proto.ToReplicaMessage.do_view_change)
+  if (_internal_has_do_view_change()) {
+    clear_has_msg();
+    ::dsnet::vr::proto::DoViewChangeMessage* temp = _impl_.msg_.do_view_change_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.msg_.do_view_change_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::dsnet::vr::proto::DoViewChangeMessage& ToReplicaMessage::_internal_do_view_change() const {
+  return _internal_has_do_view_change()
+      ? *_impl_.msg_.do_view_change_
+      : reinterpret_cast< ::dsnet::vr::proto::DoViewChangeMessage&>(::dsnet::vr::proto::_DoViewChangeMessage_default_instance_);
+}
+inline const ::dsnet::vr::proto::DoViewChangeMessage& ToReplicaMessage::do_view_change() const {
+  // @@protoc_insertion_point(field_get:dsnet.vr.proto.ToReplicaMessage.do_view_change)
+  return _internal_do_view_change();
+}
+inline ::dsnet::vr::proto::DoViewChangeMessage* ToReplicaMessage::unsafe_arena_release_do_view_change() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:dsnet.vr.proto.ToReplicaMessage.do_view_change)
+  if (_internal_has_do_view_change()) {
+    clear_has_msg();
+    ::dsnet::vr::proto::DoViewChangeMessage* temp = _impl_.msg_.do_view_change_;
+    _impl_.msg_.do_view_change_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void ToReplicaMessage::unsafe_arena_set_allocated_do_view_change(::dsnet::vr::proto::DoViewChangeMessage* do_view_change) {
+  clear_msg();
+  if (do_view_change) {
+    set_has_do_view_change();
+    _impl_.msg_.do_view_change_ = do_view_change;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:dsnet.vr.proto.ToReplicaMessage.do_view_change)
+}
+inline ::dsnet::vr::proto::DoViewChangeMessage* ToReplicaMessage::_internal_mutable_do_view_change() {
+  if (!_internal_has_do_view_change()) {
+    clear_msg();
+    set_has_do_view_change();
+    _impl_.msg_.do_view_change_ = CreateMaybeMessage< ::dsnet::vr::proto::DoViewChangeMessage >(GetArenaForAllocation());
+  }
+  return _impl_.msg_.do_view_change_;
+}
+inline ::dsnet::vr::proto::DoViewChangeMessage* ToReplicaMessage::mutable_do_view_change() {
+  ::dsnet::vr::proto::DoViewChangeMessage* _msg = _internal_mutable_do_view_change();
+  // @@protoc_insertion_point(field_mutable:dsnet.vr.proto.ToReplicaMessage.do_view_change)
+  return _msg;
+}
+
+// .dsnet.vr.proto.StartViewMessage start_view = 10;
+inline bool ToReplicaMessage::_internal_has_start_view() const {
+  return msg_case() == kStartView;
+}
+inline bool ToReplicaMessage::has_start_view() const {
+  return _internal_has_start_view();
+}
+inline void ToReplicaMessage::set_has_start_view() {
+  _impl_._oneof_case_[0] = kStartView;
+}
+inline void ToReplicaMessage::clear_start_view() {
+  if (_internal_has_start_view()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.msg_.start_view_;
+    }
+    clear_has_msg();
+  }
+}
+inline ::dsnet::vr::proto::StartViewMessage* ToReplicaMessage::release_start_view() {
+  // @@protoc_insertion_point(field_release:dsnet.vr.proto.ToReplicaMessage.start_view)
+  if (_internal_has_start_view()) {
+    clear_has_msg();
+    ::dsnet::vr::proto::StartViewMessage* temp = _impl_.msg_.start_view_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.msg_.start_view_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::dsnet::vr::proto::StartViewMessage& ToReplicaMessage::_internal_start_view() const {
+  return _internal_has_start_view()
+      ? *_impl_.msg_.start_view_
+      : reinterpret_cast< ::dsnet::vr::proto::StartViewMessage&>(::dsnet::vr::proto::_StartViewMessage_default_instance_);
+}
+inline const ::dsnet::vr::proto::StartViewMessage& ToReplicaMessage::start_view() const {
+  // @@protoc_insertion_point(field_get:dsnet.vr.proto.ToReplicaMessage.start_view)
+  return _internal_start_view();
+}
+inline ::dsnet::vr::proto::StartViewMessage* ToReplicaMessage::unsafe_arena_release_start_view() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:dsnet.vr.proto.ToReplicaMessage.start_view)
+  if (_internal_has_start_view()) {
+    clear_has_msg();
+    ::dsnet::vr::proto::StartViewMessage* temp = _impl_.msg_.start_view_;
+    _impl_.msg_.start_view_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void ToReplicaMessage::unsafe_arena_set_allocated_start_view(::dsnet::vr::proto::StartViewMessage* start_view) {
+  clear_msg();
+  if (start_view) {
+    set_has_start_view();
+    _impl_.msg_.start_view_ = start_view;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:dsnet.vr.proto.ToReplicaMessage.start_view)
+}
+inline ::dsnet::vr::proto::StartViewMessage* ToReplicaMessage::_internal_mutable_start_view() {
+  if (!_internal_has_start_view()) {
+    clear_msg();
+    set_has_start_view();
+    _impl_.msg_.start_view_ = CreateMaybeMessage< ::dsnet::vr::proto::StartViewMessage >(GetArenaForAllocation());
+  }
+  return _impl_.msg_.start_view_;
+}
+inline ::dsnet::vr::proto::StartViewMessage* ToReplicaMessage::mutable_start_view() {
+  ::dsnet::vr::proto::StartViewMessage* _msg = _internal_mutable_start_view();
+  // @@protoc_insertion_point(field_mutable:dsnet.vr.proto.ToReplicaMessage.start_view)
+  return _msg;
+}
+
+// .dsnet.vr.proto.RecoveryMessage recovery = 11;
+inline bool ToReplicaMessage::_internal_has_recovery() const {
+  return msg_case() == kRecovery;
+}
+inline bool ToReplicaMessage::has_recovery() const {
+  return _internal_has_recovery();
+}
+inline void ToReplicaMessage::set_has_recovery() {
+  _impl_._oneof_case_[0] = kRecovery;
+}
+inline void ToReplicaMessage::clear_recovery() {
+  if (_internal_has_recovery()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.msg_.recovery_;
+    }
+    clear_has_msg();
+  }
+}
+inline ::dsnet::vr::proto::RecoveryMessage* ToReplicaMessage::release_recovery() {
+  // @@protoc_insertion_point(field_release:dsnet.vr.proto.ToReplicaMessage.recovery)
+  if (_internal_has_recovery()) {
+    clear_has_msg();
+    ::dsnet::vr::proto::RecoveryMessage* temp = _impl_.msg_.recovery_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.msg_.recovery_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::dsnet::vr::proto::RecoveryMessage& ToReplicaMessage::_internal_recovery() const {
+  return _internal_has_recovery()
+      ? *_impl_.msg_.recovery_
+      : reinterpret_cast< ::dsnet::vr::proto::RecoveryMessage&>(::dsnet::vr::proto::_RecoveryMessage_default_instance_);
+}
+inline const ::dsnet::vr::proto::RecoveryMessage& ToReplicaMessage::recovery() const {
+  // @@protoc_insertion_point(field_get:dsnet.vr.proto.ToReplicaMessage.recovery)
+  return _internal_recovery();
+}
+inline ::dsnet::vr::proto::RecoveryMessage* ToReplicaMessage::unsafe_arena_release_recovery() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:dsnet.vr.proto.ToReplicaMessage.recovery)
+  if (_internal_has_recovery()) {
+    clear_has_msg();
+    ::dsnet::vr::proto::RecoveryMessage* temp = _impl_.msg_.recovery_;
+    _impl_.msg_.recovery_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void ToReplicaMessage::unsafe_arena_set_allocated_recovery(::dsnet::vr::proto::RecoveryMessage* recovery) {
+  clear_msg();
+  if (recovery) {
+    set_has_recovery();
+    _impl_.msg_.recovery_ = recovery;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:dsnet.vr.proto.ToReplicaMessage.recovery)
+}
+inline ::dsnet::vr::proto::RecoveryMessage* ToReplicaMessage::_internal_mutable_recovery() {
+  if (!_internal_has_recovery()) {
+    clear_msg();
+    set_has_recovery();
+    _impl_.msg_.recovery_ = CreateMaybeMessage< ::dsnet::vr::proto::RecoveryMessage >(GetArenaForAllocation());
+  }
+  return _impl_.msg_.recovery_;
+}
+inline ::dsnet::vr::proto::RecoveryMessage* ToReplicaMessage::mutable_recovery() {
+  ::dsnet::vr::proto::RecoveryMessage* _msg = _internal_mutable_recovery();
+  // @@protoc_insertion_point(field_mutable:dsnet.vr.proto.ToReplicaMessage.recovery)
+  return _msg;
+}
+
+// .dsnet.vr.proto.RecoveryResponseMessage recovery_response = 12;
+inline bool ToReplicaMessage::_internal_has_recovery_response() const {
+  return msg_case() == kRecoveryResponse;
+}
+inline bool ToReplicaMessage::has_recovery_response() const {
+  return _internal_has_recovery_response();
+}
+inline void ToReplicaMessage::set_has_recovery_response() {
+  _impl_._oneof_case_[0] = kRecoveryResponse;
+}
+inline void ToReplicaMessage::clear_recovery_response() {
+  if (_internal_has_recovery_response()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.msg_.recovery_response_;
+    }
+    clear_has_msg();
+  }
+}
+inline ::dsnet::vr::proto::RecoveryResponseMessage* ToReplicaMessage::release_recovery_response() {
+  // @@protoc_insertion_point(field_release:dsnet.vr.proto.ToReplicaMessage.recovery_response)
+  if (_internal_has_recovery_response()) {
+    clear_has_msg();
+    ::dsnet::vr::proto::RecoveryResponseMessage* temp = _impl_.msg_.recovery_response_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.msg_.recovery_response_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::dsnet::vr::proto::RecoveryResponseMessage& ToReplicaMessage::_internal_recovery_response() const {
+  return _internal_has_recovery_response()
+      ? *_impl_.msg_.recovery_response_
+      : reinterpret_cast< ::dsnet::vr::proto::RecoveryResponseMessage&>(::dsnet::vr::proto::_RecoveryResponseMessage_default_instance_);
+}
+inline const ::dsnet::vr::proto::RecoveryResponseMessage& ToReplicaMessage::recovery_response() const {
+  // @@protoc_insertion_point(field_get:dsnet.vr.proto.ToReplicaMessage.recovery_response)
+  return _internal_recovery_response();
+}
+inline ::dsnet::vr::proto::RecoveryResponseMessage* ToReplicaMessage::unsafe_arena_release_recovery_response() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:dsnet.vr.proto.ToReplicaMessage.recovery_response)
+  if (_internal_has_recovery_response()) {
+    clear_has_msg();
+    ::dsnet::vr::proto::RecoveryResponseMessage* temp = _impl_.msg_.recovery_response_;
+    _impl_.msg_.recovery_response_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void ToReplicaMessage::unsafe_arena_set_allocated_recovery_response(::dsnet::vr::proto::RecoveryResponseMessage* recovery_response) {
+  clear_msg();
+  if (recovery_response) {
+    set_has_recovery_response();
+    _impl_.msg_.recovery_response_ = recovery_response;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:dsnet.vr.proto.ToReplicaMessage.recovery_response)
+}
+inline ::dsnet::vr::proto::RecoveryResponseMessage* ToReplicaMessage::_internal_mutable_recovery_response() {
+  if (!_internal_has_recovery_response()) {
+    clear_msg();
+    set_has_recovery_response();
+    _impl_.msg_.recovery_response_ = CreateMaybeMessage< ::dsnet::vr::proto::RecoveryResponseMessage >(GetArenaForAllocation());
+  }
+  return _impl_.msg_.recovery_response_;
+}
+inline ::dsnet::vr::proto::RecoveryResponseMessage* ToReplicaMessage::mutable_recovery_response() {
+  ::dsnet::vr::proto::RecoveryResponseMessage* _msg = _internal_mutable_recovery_response();
+  // @@protoc_insertion_point(field_mutable:dsnet.vr.proto.ToReplicaMessage.recovery_response)
+  return _msg;
+}
+
+inline bool ToReplicaMessage::has_msg() const {
+  return msg_case() != MSG_NOT_SET;
+}
+inline void ToReplicaMessage::clear_has_msg() {
+  _impl_._oneof_case_[0] = MSG_NOT_SET;
+}
+inline ToReplicaMessage::MsgCase ToReplicaMessage::msg_case() const {
+  return ToReplicaMessage::MsgCase(_impl_._oneof_case_[0]);
+}
+#ifdef __GNUC__
+  #pragma GCC diagnostic pop
+#endif  // __GNUC__
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+
+// @@protoc_insertion_point(namespace_scope)
+
+}  // namespace proto
+}  // namespace vr
+}  // namespace dsnet
+
+// @@protoc_insertion_point(global_scope)
+
+#include <google/protobuf/port_undef.inc>
+#endif  // GOOGLE_PROTOBUF_INCLUDED_GOOGLE_PROTOBUF_INCLUDED_replication_2fvr_2fvr_2dproto_2eproto
@@ -0,0 +1,1589 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: transaction/apps/kvstore/kvstore-proto.proto
+
+#ifndef GOOGLE_PROTOBUF_INCLUDED_transaction_2fapps_2fkvstore_2fkvstore_2dproto_2eproto
+#define GOOGLE_PROTOBUF_INCLUDED_transaction_2fapps_2fkvstore_2fkvstore_2dproto_2eproto
+
+#include <limits>
+#include <string>
+
+#include <google/protobuf/port_def.inc>
+#if PROTOBUF_VERSION < 3021000
+#error This file was generated by a newer version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please update
+#error your headers.
+#endif
+#if 3021012 < PROTOBUF_MIN_PROTOC_VERSION
+#error This file was generated by an older version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please
+#error regenerate this file with a newer version of protoc.
+#endif
+
+#include <google/protobuf/port_undef.inc>
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/arena.h>
+#include <google/protobuf/arenastring.h>
+#include <google/protobuf/generated_message_util.h>
+#include <google/protobuf/metadata_lite.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/message.h>
+#include <google/protobuf/repeated_field.h>  // IWYU pragma: export
+#include <google/protobuf/extension_set.h>  // IWYU pragma: export
+#include <google/protobuf/generated_enum_reflection.h>
+#include <google/protobuf/unknown_field_set.h>
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+#define PROTOBUF_INTERNAL_EXPORT_transaction_2fapps_2fkvstore_2fkvstore_2dproto_2eproto
+PROTOBUF_NAMESPACE_OPEN
+namespace internal {
+class AnyMetadata;
+}  // namespace internal
+PROTOBUF_NAMESPACE_CLOSE
+
+// Internal implementation detail -- do not use these members.
+struct TableStruct_transaction_2fapps_2fkvstore_2fkvstore_2dproto_2eproto {
+  static const uint32_t offsets[];
+};
+extern const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_transaction_2fapps_2fkvstore_2fkvstore_2dproto_2eproto;
+namespace dsnet {
+namespace transaction {
+namespace kvstore {
+namespace proto {
+class GetMessage;
+struct GetMessageDefaultTypeInternal;
+extern GetMessageDefaultTypeInternal _GetMessage_default_instance_;
+class GetReply;
+struct GetReplyDefaultTypeInternal;
+extern GetReplyDefaultTypeInternal _GetReply_default_instance_;
+class KVTxnMessage;
+struct KVTxnMessageDefaultTypeInternal;
+extern KVTxnMessageDefaultTypeInternal _KVTxnMessage_default_instance_;
+class KVTxnReplyMessage;
+struct KVTxnReplyMessageDefaultTypeInternal;
+extern KVTxnReplyMessageDefaultTypeInternal _KVTxnReplyMessage_default_instance_;
+class PutMessage;
+struct PutMessageDefaultTypeInternal;
+extern PutMessageDefaultTypeInternal _PutMessage_default_instance_;
+}  // namespace proto
+}  // namespace kvstore
+}  // namespace transaction
+}  // namespace dsnet
+PROTOBUF_NAMESPACE_OPEN
+template<> ::dsnet::transaction::kvstore::proto::GetMessage* Arena::CreateMaybeMessage<::dsnet::transaction::kvstore::proto::GetMessage>(Arena*);
+template<> ::dsnet::transaction::kvstore::proto::GetReply* Arena::CreateMaybeMessage<::dsnet::transaction::kvstore::proto::GetReply>(Arena*);
+template<> ::dsnet::transaction::kvstore::proto::KVTxnMessage* Arena::CreateMaybeMessage<::dsnet::transaction::kvstore::proto::KVTxnMessage>(Arena*);
+template<> ::dsnet::transaction::kvstore::proto::KVTxnReplyMessage* Arena::CreateMaybeMessage<::dsnet::transaction::kvstore::proto::KVTxnReplyMessage>(Arena*);
+template<> ::dsnet::transaction::kvstore::proto::PutMessage* Arena::CreateMaybeMessage<::dsnet::transaction::kvstore::proto::PutMessage>(Arena*);
+PROTOBUF_NAMESPACE_CLOSE
+namespace dsnet {
+namespace transaction {
+namespace kvstore {
+namespace proto {
+
+enum KVTxnReplyMessage_Status : int {
+  KVTxnReplyMessage_Status_SUCCESS = 0,
+  KVTxnReplyMessage_Status_FAILED = 1
+};
+bool KVTxnReplyMessage_Status_IsValid(int value);
+constexpr KVTxnReplyMessage_Status KVTxnReplyMessage_Status_Status_MIN = KVTxnReplyMessage_Status_SUCCESS;
+constexpr KVTxnReplyMessage_Status KVTxnReplyMessage_Status_Status_MAX = KVTxnReplyMessage_Status_FAILED;
+constexpr int KVTxnReplyMessage_Status_Status_ARRAYSIZE = KVTxnReplyMessage_Status_Status_MAX + 1;
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* KVTxnReplyMessage_Status_descriptor();
+template<typename T>
+inline const std::string& KVTxnReplyMessage_Status_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, KVTxnReplyMessage_Status>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function KVTxnReplyMessage_Status_Name.");
+  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
+    KVTxnReplyMessage_Status_descriptor(), enum_t_value);
+}
+inline bool KVTxnReplyMessage_Status_Parse(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, KVTxnReplyMessage_Status* value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<KVTxnReplyMessage_Status>(
+    KVTxnReplyMessage_Status_descriptor(), name, value);
+}
+// ===================================================================
+
+class GetMessage final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:dsnet.transaction.kvstore.proto.GetMessage) */ {
+ public:
+  inline GetMessage() : GetMessage(nullptr) {}
+  ~GetMessage() override;
+  explicit PROTOBUF_CONSTEXPR GetMessage(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  GetMessage(const GetMessage& from);
+  GetMessage(GetMessage&& from) noexcept
+    : GetMessage() {
+    *this = ::std::move(from);
+  }
+
+  inline GetMessage& operator=(const GetMessage& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline GetMessage& operator=(GetMessage&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const GetMessage& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const GetMessage* internal_default_instance() {
+    return reinterpret_cast<const GetMessage*>(
+               &_GetMessage_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    0;
+
+  friend void swap(GetMessage& a, GetMessage& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(GetMessage* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(GetMessage* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  GetMessage* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<GetMessage>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const GetMessage& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const GetMessage& from) {
+    GetMessage::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(GetMessage* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "dsnet.transaction.kvstore.proto.GetMessage";
+  }
+  protected:
+  explicit GetMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kKeyFieldNumber = 1,
+  };
+  // required string key = 1;
+  bool has_key() const;
+  private:
+  bool _internal_has_key() const;
+  public:
+  void clear_key();
+  const std::string& key() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_key(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_key();
+  PROTOBUF_NODISCARD std::string* release_key();
+  void set_allocated_key(std::string* key);
+  private:
+  const std::string& _internal_key() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_key(const std::string& value);
+  std::string* _internal_mutable_key();
+  public:
+
+  // @@protoc_insertion_point(class_scope:dsnet.transaction.kvstore.proto.GetMessage)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr key_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_transaction_2fapps_2fkvstore_2fkvstore_2dproto_2eproto;
+};
+// -------------------------------------------------------------------
+
+class GetReply final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:dsnet.transaction.kvstore.proto.GetReply) */ {
+ public:
+  inline GetReply() : GetReply(nullptr) {}
+  ~GetReply() override;
+  explicit PROTOBUF_CONSTEXPR GetReply(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  GetReply(const GetReply& from);
+  GetReply(GetReply&& from) noexcept
+    : GetReply() {
+    *this = ::std::move(from);
+  }
+
+  inline GetReply& operator=(const GetReply& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline GetReply& operator=(GetReply&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const GetReply& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const GetReply* internal_default_instance() {
+    return reinterpret_cast<const GetReply*>(
+               &_GetReply_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    1;
+
+  friend void swap(GetReply& a, GetReply& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(GetReply* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(GetReply* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  GetReply* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<GetReply>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const GetReply& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const GetReply& from) {
+    GetReply::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(GetReply* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "dsnet.transaction.kvstore.proto.GetReply";
+  }
+  protected:
+  explicit GetReply(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kKeyFieldNumber = 1,
+    kValueFieldNumber = 2,
+  };
+  // required string key = 1;
+  bool has_key() const;
+  private:
+  bool _internal_has_key() const;
+  public:
+  void clear_key();
+  const std::string& key() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_key(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_key();
+  PROTOBUF_NODISCARD std::string* release_key();
+  void set_allocated_key(std::string* key);
+  private:
+  const std::string& _internal_key() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_key(const std::string& value);
+  std::string* _internal_mutable_key();
+  public:
+
+  // required string value = 2;
+  bool has_value() const;
+  private:
+  bool _internal_has_value() const;
+  public:
+  void clear_value();
+  const std::string& value() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_value(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_value();
+  PROTOBUF_NODISCARD std::string* release_value();
+  void set_allocated_value(std::string* value);
+  private:
+  const std::string& _internal_value() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_value(const std::string& value);
+  std::string* _internal_mutable_value();
+  public:
+
+  // @@protoc_insertion_point(class_scope:dsnet.transaction.kvstore.proto.GetReply)
+ private:
+  class _Internal;
+
+  // helper for ByteSizeLong()
+  size_t RequiredFieldsByteSizeFallback() const;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr key_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr value_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_transaction_2fapps_2fkvstore_2fkvstore_2dproto_2eproto;
+};
+// -------------------------------------------------------------------
+
+class PutMessage final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:dsnet.transaction.kvstore.proto.PutMessage) */ {
+ public:
+  inline PutMessage() : PutMessage(nullptr) {}
+  ~PutMessage() override;
+  explicit PROTOBUF_CONSTEXPR PutMessage(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  PutMessage(const PutMessage& from);
+  PutMessage(PutMessage&& from) noexcept
+    : PutMessage() {
+    *this = ::std::move(from);
+  }
+
+  inline PutMessage& operator=(const PutMessage& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline PutMessage& operator=(PutMessage&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const PutMessage& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const PutMessage* internal_default_instance() {
+    return reinterpret_cast<const PutMessage*>(
+               &_PutMessage_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    2;
+
+  friend void swap(PutMessage& a, PutMessage& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(PutMessage* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(PutMessage* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  PutMessage* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<PutMessage>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const PutMessage& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const PutMessage& from) {
+    PutMessage::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(PutMessage* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "dsnet.transaction.kvstore.proto.PutMessage";
+  }
+  protected:
+  explicit PutMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kKeyFieldNumber = 1,
+    kValueFieldNumber = 2,
+  };
+  // required string key = 1;
+  bool has_key() const;
+  private:
+  bool _internal_has_key() const;
+  public:
+  void clear_key();
+  const std::string& key() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_key(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_key();
+  PROTOBUF_NODISCARD std::string* release_key();
+  void set_allocated_key(std::string* key);
+  private:
+  const std::string& _internal_key() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_key(const std::string& value);
+  std::string* _internal_mutable_key();
+  public:
+
+  // required string value = 2;
+  bool has_value() const;
+  private:
+  bool _internal_has_value() const;
+  public:
+  void clear_value();
+  const std::string& value() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_value(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_value();
+  PROTOBUF_NODISCARD std::string* release_value();
+  void set_allocated_value(std::string* value);
+  private:
+  const std::string& _internal_value() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_value(const std::string& value);
+  std::string* _internal_mutable_value();
+  public:
+
+  // @@protoc_insertion_point(class_scope:dsnet.transaction.kvstore.proto.PutMessage)
+ private:
+  class _Internal;
+
+  // helper for ByteSizeLong()
+  size_t RequiredFieldsByteSizeFallback() const;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr key_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr value_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_transaction_2fapps_2fkvstore_2fkvstore_2dproto_2eproto;
+};
+// -------------------------------------------------------------------
+
+class KVTxnMessage final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:dsnet.transaction.kvstore.proto.KVTxnMessage) */ {
+ public:
+  inline KVTxnMessage() : KVTxnMessage(nullptr) {}
+  ~KVTxnMessage() override;
+  explicit PROTOBUF_CONSTEXPR KVTxnMessage(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  KVTxnMessage(const KVTxnMessage& from);
+  KVTxnMessage(KVTxnMessage&& from) noexcept
+    : KVTxnMessage() {
+    *this = ::std::move(from);
+  }
+
+  inline KVTxnMessage& operator=(const KVTxnMessage& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline KVTxnMessage& operator=(KVTxnMessage&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const KVTxnMessage& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const KVTxnMessage* internal_default_instance() {
+    return reinterpret_cast<const KVTxnMessage*>(
+               &_KVTxnMessage_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    3;
+
+  friend void swap(KVTxnMessage& a, KVTxnMessage& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(KVTxnMessage* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(KVTxnMessage* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  KVTxnMessage* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<KVTxnMessage>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const KVTxnMessage& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const KVTxnMessage& from) {
+    KVTxnMessage::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(KVTxnMessage* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "dsnet.transaction.kvstore.proto.KVTxnMessage";
+  }
+  protected:
+  explicit KVTxnMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kGetsFieldNumber = 1,
+    kPutsFieldNumber = 2,
+  };
+  // repeated .dsnet.transaction.kvstore.proto.GetMessage gets = 1;
+  int gets_size() const;
+  private:
+  int _internal_gets_size() const;
+  public:
+  void clear_gets();
+  ::dsnet::transaction::kvstore::proto::GetMessage* mutable_gets(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::dsnet::transaction::kvstore::proto::GetMessage >*
+      mutable_gets();
+  private:
+  const ::dsnet::transaction::kvstore::proto::GetMessage& _internal_gets(int index) const;
+  ::dsnet::transaction::kvstore::proto::GetMessage* _internal_add_gets();
+  public:
+  const ::dsnet::transaction::kvstore::proto::GetMessage& gets(int index) const;
+  ::dsnet::transaction::kvstore::proto::GetMessage* add_gets();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::dsnet::transaction::kvstore::proto::GetMessage >&
+      gets() const;
+
+  // repeated .dsnet.transaction.kvstore.proto.PutMessage puts = 2;
+  int puts_size() const;
+  private:
+  int _internal_puts_size() const;
+  public:
+  void clear_puts();
+  ::dsnet::transaction::kvstore::proto::PutMessage* mutable_puts(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::dsnet::transaction::kvstore::proto::PutMessage >*
+      mutable_puts();
+  private:
+  const ::dsnet::transaction::kvstore::proto::PutMessage& _internal_puts(int index) const;
+  ::dsnet::transaction::kvstore::proto::PutMessage* _internal_add_puts();
+  public:
+  const ::dsnet::transaction::kvstore::proto::PutMessage& puts(int index) const;
+  ::dsnet::transaction::kvstore::proto::PutMessage* add_puts();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::dsnet::transaction::kvstore::proto::PutMessage >&
+      puts() const;
+
+  // @@protoc_insertion_point(class_scope:dsnet.transaction.kvstore.proto.KVTxnMessage)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::dsnet::transaction::kvstore::proto::GetMessage > gets_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::dsnet::transaction::kvstore::proto::PutMessage > puts_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_transaction_2fapps_2fkvstore_2fkvstore_2dproto_2eproto;
+};
+// -------------------------------------------------------------------
+
+class KVTxnReplyMessage final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:dsnet.transaction.kvstore.proto.KVTxnReplyMessage) */ {
+ public:
+  inline KVTxnReplyMessage() : KVTxnReplyMessage(nullptr) {}
+  ~KVTxnReplyMessage() override;
+  explicit PROTOBUF_CONSTEXPR KVTxnReplyMessage(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  KVTxnReplyMessage(const KVTxnReplyMessage& from);
+  KVTxnReplyMessage(KVTxnReplyMessage&& from) noexcept
+    : KVTxnReplyMessage() {
+    *this = ::std::move(from);
+  }
+
+  inline KVTxnReplyMessage& operator=(const KVTxnReplyMessage& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline KVTxnReplyMessage& operator=(KVTxnReplyMessage&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const KVTxnReplyMessage& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const KVTxnReplyMessage* internal_default_instance() {
+    return reinterpret_cast<const KVTxnReplyMessage*>(
+               &_KVTxnReplyMessage_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    4;
+
+  friend void swap(KVTxnReplyMessage& a, KVTxnReplyMessage& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(KVTxnReplyMessage* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(KVTxnReplyMessage* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  KVTxnReplyMessage* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<KVTxnReplyMessage>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const KVTxnReplyMessage& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const KVTxnReplyMessage& from) {
+    KVTxnReplyMessage::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(KVTxnReplyMessage* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "dsnet.transaction.kvstore.proto.KVTxnReplyMessage";
+  }
+  protected:
+  explicit KVTxnReplyMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  typedef KVTxnReplyMessage_Status Status;
+  static constexpr Status SUCCESS =
+    KVTxnReplyMessage_Status_SUCCESS;
+  static constexpr Status FAILED =
+    KVTxnReplyMessage_Status_FAILED;
+  static inline bool Status_IsValid(int value) {
+    return KVTxnReplyMessage_Status_IsValid(value);
+  }
+  static constexpr Status Status_MIN =
+    KVTxnReplyMessage_Status_Status_MIN;
+  static constexpr Status Status_MAX =
+    KVTxnReplyMessage_Status_Status_MAX;
+  static constexpr int Status_ARRAYSIZE =
+    KVTxnReplyMessage_Status_Status_ARRAYSIZE;
+  static inline const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor*
+  Status_descriptor() {
+    return KVTxnReplyMessage_Status_descriptor();
+  }
+  template<typename T>
+  static inline const std::string& Status_Name(T enum_t_value) {
+    static_assert(::std::is_same<T, Status>::value ||
+      ::std::is_integral<T>::value,
+      "Incorrect type passed to function Status_Name.");
+    return KVTxnReplyMessage_Status_Name(enum_t_value);
+  }
+  static inline bool Status_Parse(::PROTOBUF_NAMESPACE_ID::ConstStringParam name,
+      Status* value) {
+    return KVTxnReplyMessage_Status_Parse(name, value);
+  }
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kRgetsFieldNumber = 2,
+    kStatusFieldNumber = 1,
+  };
+  // repeated .dsnet.transaction.kvstore.proto.GetReply rgets = 2;
+  int rgets_size() const;
+  private:
+  int _internal_rgets_size() const;
+  public:
+  void clear_rgets();
+  ::dsnet::transaction::kvstore::proto::GetReply* mutable_rgets(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::dsnet::transaction::kvstore::proto::GetReply >*
+      mutable_rgets();
+  private:
+  const ::dsnet::transaction::kvstore::proto::GetReply& _internal_rgets(int index) const;
+  ::dsnet::transaction::kvstore::proto::GetReply* _internal_add_rgets();
+  public:
+  const ::dsnet::transaction::kvstore::proto::GetReply& rgets(int index) const;
+  ::dsnet::transaction::kvstore::proto::GetReply* add_rgets();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::dsnet::transaction::kvstore::proto::GetReply >&
+      rgets() const;
+
+  // required .dsnet.transaction.kvstore.proto.KVTxnReplyMessage.Status status = 1;
+  bool has_status() const;
+  private:
+  bool _internal_has_status() const;
+  public:
+  void clear_status();
+  ::dsnet::transaction::kvstore::proto::KVTxnReplyMessage_Status status() const;
+  void set_status(::dsnet::transaction::kvstore::proto::KVTxnReplyMessage_Status value);
+  private:
+  ::dsnet::transaction::kvstore::proto::KVTxnReplyMessage_Status _internal_status() const;
+  void _internal_set_status(::dsnet::transaction::kvstore::proto::KVTxnReplyMessage_Status value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:dsnet.transaction.kvstore.proto.KVTxnReplyMessage)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::dsnet::transaction::kvstore::proto::GetReply > rgets_;
+    int status_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_transaction_2fapps_2fkvstore_2fkvstore_2dproto_2eproto;
+};
+// ===================================================================
+
+
+// ===================================================================
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
+#endif  // __GNUC__
+// GetMessage
+
+// required string key = 1;
+inline bool GetMessage::_internal_has_key() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool GetMessage::has_key() const {
+  return _internal_has_key();
+}
+inline void GetMessage::clear_key() {
+  _impl_.key_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& GetMessage::key() const {
+  // @@protoc_insertion_point(field_get:dsnet.transaction.kvstore.proto.GetMessage.key)
+  return _internal_key();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void GetMessage::set_key(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.key_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:dsnet.transaction.kvstore.proto.GetMessage.key)
+}
+inline std::string* GetMessage::mutable_key() {
+  std::string* _s = _internal_mutable_key();
+  // @@protoc_insertion_point(field_mutable:dsnet.transaction.kvstore.proto.GetMessage.key)
+  return _s;
+}
+inline const std::string& GetMessage::_internal_key() const {
+  return _impl_.key_.Get();
+}
+inline void GetMessage::_internal_set_key(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.key_.Set(value, GetArenaForAllocation());
+}
+inline std::string* GetMessage::_internal_mutable_key() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.key_.Mutable(GetArenaForAllocation());
+}
+inline std::string* GetMessage::release_key() {
+  // @@protoc_insertion_point(field_release:dsnet.transaction.kvstore.proto.GetMessage.key)
+  if (!_internal_has_key()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.key_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.key_.IsDefault()) {
+    _impl_.key_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void GetMessage::set_allocated_key(std::string* key) {
+  if (key != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.key_.SetAllocated(key, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.key_.IsDefault()) {
+    _impl_.key_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:dsnet.transaction.kvstore.proto.GetMessage.key)
+}
+
+// -------------------------------------------------------------------
+
+// GetReply
+
+// required string key = 1;
+inline bool GetReply::_internal_has_key() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool GetReply::has_key() const {
+  return _internal_has_key();
+}
+inline void GetReply::clear_key() {
+  _impl_.key_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& GetReply::key() const {
+  // @@protoc_insertion_point(field_get:dsnet.transaction.kvstore.proto.GetReply.key)
+  return _internal_key();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void GetReply::set_key(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.key_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:dsnet.transaction.kvstore.proto.GetReply.key)
+}
+inline std::string* GetReply::mutable_key() {
+  std::string* _s = _internal_mutable_key();
+  // @@protoc_insertion_point(field_mutable:dsnet.transaction.kvstore.proto.GetReply.key)
+  return _s;
+}
+inline const std::string& GetReply::_internal_key() const {
+  return _impl_.key_.Get();
+}
+inline void GetReply::_internal_set_key(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.key_.Set(value, GetArenaForAllocation());
+}
+inline std::string* GetReply::_internal_mutable_key() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.key_.Mutable(GetArenaForAllocation());
+}
+inline std::string* GetReply::release_key() {
+  // @@protoc_insertion_point(field_release:dsnet.transaction.kvstore.proto.GetReply.key)
+  if (!_internal_has_key()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.key_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.key_.IsDefault()) {
+    _impl_.key_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void GetReply::set_allocated_key(std::string* key) {
+  if (key != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.key_.SetAllocated(key, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.key_.IsDefault()) {
+    _impl_.key_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:dsnet.transaction.kvstore.proto.GetReply.key)
+}
+
+// required string value = 2;
+inline bool GetReply::_internal_has_value() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool GetReply::has_value() const {
+  return _internal_has_value();
+}
+inline void GetReply::clear_value() {
+  _impl_.value_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline const std::string& GetReply::value() const {
+  // @@protoc_insertion_point(field_get:dsnet.transaction.kvstore.proto.GetReply.value)
+  return _internal_value();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void GetReply::set_value(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000002u;
+ _impl_.value_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:dsnet.transaction.kvstore.proto.GetReply.value)
+}
+inline std::string* GetReply::mutable_value() {
+  std::string* _s = _internal_mutable_value();
+  // @@protoc_insertion_point(field_mutable:dsnet.transaction.kvstore.proto.GetReply.value)
+  return _s;
+}
+inline const std::string& GetReply::_internal_value() const {
+  return _impl_.value_.Get();
+}
+inline void GetReply::_internal_set_value(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.value_.Set(value, GetArenaForAllocation());
+}
+inline std::string* GetReply::_internal_mutable_value() {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  return _impl_.value_.Mutable(GetArenaForAllocation());
+}
+inline std::string* GetReply::release_value() {
+  // @@protoc_insertion_point(field_release:dsnet.transaction.kvstore.proto.GetReply.value)
+  if (!_internal_has_value()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  auto* p = _impl_.value_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.value_.IsDefault()) {
+    _impl_.value_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void GetReply::set_allocated_value(std::string* value) {
+  if (value != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  _impl_.value_.SetAllocated(value, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.value_.IsDefault()) {
+    _impl_.value_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:dsnet.transaction.kvstore.proto.GetReply.value)
+}
+
+// -------------------------------------------------------------------
+
+// PutMessage
+
+// required string key = 1;
+inline bool PutMessage::_internal_has_key() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool PutMessage::has_key() const {
+  return _internal_has_key();
+}
+inline void PutMessage::clear_key() {
+  _impl_.key_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& PutMessage::key() const {
+  // @@protoc_insertion_point(field_get:dsnet.transaction.kvstore.proto.PutMessage.key)
+  return _internal_key();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void PutMessage::set_key(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.key_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:dsnet.transaction.kvstore.proto.PutMessage.key)
+}
+inline std::string* PutMessage::mutable_key() {
+  std::string* _s = _internal_mutable_key();
+  // @@protoc_insertion_point(field_mutable:dsnet.transaction.kvstore.proto.PutMessage.key)
+  return _s;
+}
+inline const std::string& PutMessage::_internal_key() const {
+  return _impl_.key_.Get();
+}
+inline void PutMessage::_internal_set_key(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.key_.Set(value, GetArenaForAllocation());
+}
+inline std::string* PutMessage::_internal_mutable_key() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.key_.Mutable(GetArenaForAllocation());
+}
+inline std::string* PutMessage::release_key() {
+  // @@protoc_insertion_point(field_release:dsnet.transaction.kvstore.proto.PutMessage.key)
+  if (!_internal_has_key()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.key_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.key_.IsDefault()) {
+    _impl_.key_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void PutMessage::set_allocated_key(std::string* key) {
+  if (key != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.key_.SetAllocated(key, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.key_.IsDefault()) {
+    _impl_.key_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:dsnet.transaction.kvstore.proto.PutMessage.key)
+}
+
+// required string value = 2;
+inline bool PutMessage::_internal_has_value() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool PutMessage::has_value() const {
+  return _internal_has_value();
+}
+inline void PutMessage::clear_value() {
+  _impl_.value_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline const std::string& PutMessage::value() const {
+  // @@protoc_insertion_point(field_get:dsnet.transaction.kvstore.proto.PutMessage.value)
+  return _internal_value();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void PutMessage::set_value(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000002u;
+ _impl_.value_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:dsnet.transaction.kvstore.proto.PutMessage.value)
+}
+inline std::string* PutMessage::mutable_value() {
+  std::string* _s = _internal_mutable_value();
+  // @@protoc_insertion_point(field_mutable:dsnet.transaction.kvstore.proto.PutMessage.value)
+  return _s;
+}
+inline const std::string& PutMessage::_internal_value() const {
+  return _impl_.value_.Get();
+}
+inline void PutMessage::_internal_set_value(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.value_.Set(value, GetArenaForAllocation());
+}
+inline std::string* PutMessage::_internal_mutable_value() {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  return _impl_.value_.Mutable(GetArenaForAllocation());
+}
+inline std::string* PutMessage::release_value() {
+  // @@protoc_insertion_point(field_release:dsnet.transaction.kvstore.proto.PutMessage.value)
+  if (!_internal_has_value()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  auto* p = _impl_.value_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.value_.IsDefault()) {
+    _impl_.value_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void PutMessage::set_allocated_value(std::string* value) {
+  if (value != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  _impl_.value_.SetAllocated(value, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.value_.IsDefault()) {
+    _impl_.value_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:dsnet.transaction.kvstore.proto.PutMessage.value)
+}
+
+// -------------------------------------------------------------------
+
+// KVTxnMessage
+
+// repeated .dsnet.transaction.kvstore.proto.GetMessage gets = 1;
+inline int KVTxnMessage::_internal_gets_size() const {
+  return _impl_.gets_.size();
+}
+inline int KVTxnMessage::gets_size() const {
+  return _internal_gets_size();
+}
+inline void KVTxnMessage::clear_gets() {
+  _impl_.gets_.Clear();
+}
+inline ::dsnet::transaction::kvstore::proto::GetMessage* KVTxnMessage::mutable_gets(int index) {
+  // @@protoc_insertion_point(field_mutable:dsnet.transaction.kvstore.proto.KVTxnMessage.gets)
+  return _impl_.gets_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::dsnet::transaction::kvstore::proto::GetMessage >*
+KVTxnMessage::mutable_gets() {
+  // @@protoc_insertion_point(field_mutable_list:dsnet.transaction.kvstore.proto.KVTxnMessage.gets)
+  return &_impl_.gets_;
+}
+inline const ::dsnet::transaction::kvstore::proto::GetMessage& KVTxnMessage::_internal_gets(int index) const {
+  return _impl_.gets_.Get(index);
+}
+inline const ::dsnet::transaction::kvstore::proto::GetMessage& KVTxnMessage::gets(int index) const {
+  // @@protoc_insertion_point(field_get:dsnet.transaction.kvstore.proto.KVTxnMessage.gets)
+  return _internal_gets(index);
+}
+inline ::dsnet::transaction::kvstore::proto::GetMessage* KVTxnMessage::_internal_add_gets() {
+  return _impl_.gets_.Add();
+}
+inline ::dsnet::transaction::kvstore::proto::GetMessage* KVTxnMessage::add_gets() {
+  ::dsnet::transaction::kvstore::proto::GetMessage* _add = _internal_add_gets();
+  // @@protoc_insertion_point(field_add:dsnet.transaction.kvstore.proto.KVTxnMessage.gets)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::dsnet::transaction::kvstore::proto::GetMessage >&
+KVTxnMessage::gets() const {
+  // @@protoc_insertion_point(field_list:dsnet.transaction.kvstore.proto.KVTxnMessage.gets)
+  return _impl_.gets_;
+}
+
+// repeated .dsnet.transaction.kvstore.proto.PutMessage puts = 2;
+inline int KVTxnMessage::_internal_puts_size() const {
+  return _impl_.puts_.size();
+}
+inline int KVTxnMessage::puts_size() const {
+  return _internal_puts_size();
+}
+inline void KVTxnMessage::clear_puts() {
+  _impl_.puts_.Clear();
+}
+inline ::dsnet::transaction::kvstore::proto::PutMessage* KVTxnMessage::mutable_puts(int index) {
+  // @@protoc_insertion_point(field_mutable:dsnet.transaction.kvstore.proto.KVTxnMessage.puts)
+  return _impl_.puts_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::dsnet::transaction::kvstore::proto::PutMessage >*
+KVTxnMessage::mutable_puts() {
+  // @@protoc_insertion_point(field_mutable_list:dsnet.transaction.kvstore.proto.KVTxnMessage.puts)
+  return &_impl_.puts_;
+}
+inline const ::dsnet::transaction::kvstore::proto::PutMessage& KVTxnMessage::_internal_puts(int index) const {
+  return _impl_.puts_.Get(index);
+}
+inline const ::dsnet::transaction::kvstore::proto::PutMessage& KVTxnMessage::puts(int index) const {
+  // @@protoc_insertion_point(field_get:dsnet.transaction.kvstore.proto.KVTxnMessage.puts)
+  return _internal_puts(index);
+}
+inline ::dsnet::transaction::kvstore::proto::PutMessage* KVTxnMessage::_internal_add_puts() {
+  return _impl_.puts_.Add();
+}
+inline ::dsnet::transaction::kvstore::proto::PutMessage* KVTxnMessage::add_puts() {
+  ::dsnet::transaction::kvstore::proto::PutMessage* _add = _internal_add_puts();
+  // @@protoc_insertion_point(field_add:dsnet.transaction.kvstore.proto.KVTxnMessage.puts)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::dsnet::transaction::kvstore::proto::PutMessage >&
+KVTxnMessage::puts() const {
+  // @@protoc_insertion_point(field_list:dsnet.transaction.kvstore.proto.KVTxnMessage.puts)
+  return _impl_.puts_;
+}
+
+// -------------------------------------------------------------------
+
+// KVTxnReplyMessage
+
+// required .dsnet.transaction.kvstore.proto.KVTxnReplyMessage.Status status = 1;
+inline bool KVTxnReplyMessage::_internal_has_status() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool KVTxnReplyMessage::has_status() const {
+  return _internal_has_status();
+}
+inline void KVTxnReplyMessage::clear_status() {
+  _impl_.status_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline ::dsnet::transaction::kvstore::proto::KVTxnReplyMessage_Status KVTxnReplyMessage::_internal_status() const {
+  return static_cast< ::dsnet::transaction::kvstore::proto::KVTxnReplyMessage_Status >(_impl_.status_);
+}
+inline ::dsnet::transaction::kvstore::proto::KVTxnReplyMessage_Status KVTxnReplyMessage::status() const {
+  // @@protoc_insertion_point(field_get:dsnet.transaction.kvstore.proto.KVTxnReplyMessage.status)
+  return _internal_status();
+}
+inline void KVTxnReplyMessage::_internal_set_status(::dsnet::transaction::kvstore::proto::KVTxnReplyMessage_Status value) {
+  assert(::dsnet::transaction::kvstore::proto::KVTxnReplyMessage_Status_IsValid(value));
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.status_ = value;
+}
+inline void KVTxnReplyMessage::set_status(::dsnet::transaction::kvstore::proto::KVTxnReplyMessage_Status value) {
+  _internal_set_status(value);
+  // @@protoc_insertion_point(field_set:dsnet.transaction.kvstore.proto.KVTxnReplyMessage.status)
+}
+
+// repeated .dsnet.transaction.kvstore.proto.GetReply rgets = 2;
+inline int KVTxnReplyMessage::_internal_rgets_size() const {
+  return _impl_.rgets_.size();
+}
+inline int KVTxnReplyMessage::rgets_size() const {
+  return _internal_rgets_size();
+}
+inline void KVTxnReplyMessage::clear_rgets() {
+  _impl_.rgets_.Clear();
+}
+inline ::dsnet::transaction::kvstore::proto::GetReply* KVTxnReplyMessage::mutable_rgets(int index) {
+  // @@protoc_insertion_point(field_mutable:dsnet.transaction.kvstore.proto.KVTxnReplyMessage.rgets)
+  return _impl_.rgets_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::dsnet::transaction::kvstore::proto::GetReply >*
+KVTxnReplyMessage::mutable_rgets() {
+  // @@protoc_insertion_point(field_mutable_list:dsnet.transaction.kvstore.proto.KVTxnReplyMessage.rgets)
+  return &_impl_.rgets_;
+}
+inline const ::dsnet::transaction::kvstore::proto::GetReply& KVTxnReplyMessage::_internal_rgets(int index) const {
+  return _impl_.rgets_.Get(index);
+}
+inline const ::dsnet::transaction::kvstore::proto::GetReply& KVTxnReplyMessage::rgets(int index) const {
+  // @@protoc_insertion_point(field_get:dsnet.transaction.kvstore.proto.KVTxnReplyMessage.rgets)
+  return _internal_rgets(index);
+}
+inline ::dsnet::transaction::kvstore::proto::GetReply* KVTxnReplyMessage::_internal_add_rgets() {
+  return _impl_.rgets_.Add();
+}
+inline ::dsnet::transaction::kvstore::proto::GetReply* KVTxnReplyMessage::add_rgets() {
+  ::dsnet::transaction::kvstore::proto::GetReply* _add = _internal_add_rgets();
+  // @@protoc_insertion_point(field_add:dsnet.transaction.kvstore.proto.KVTxnReplyMessage.rgets)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::dsnet::transaction::kvstore::proto::GetReply >&
+KVTxnReplyMessage::rgets() const {
+  // @@protoc_insertion_point(field_list:dsnet.transaction.kvstore.proto.KVTxnReplyMessage.rgets)
+  return _impl_.rgets_;
+}
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic pop
+#endif  // __GNUC__
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+
+// @@protoc_insertion_point(namespace_scope)
+
+}  // namespace proto
+}  // namespace kvstore
+}  // namespace transaction
+}  // namespace dsnet
+
+PROTOBUF_NAMESPACE_OPEN
+
+template <> struct is_proto_enum< ::dsnet::transaction::kvstore::proto::KVTxnReplyMessage_Status> : ::std::true_type {};
+template <>
+inline const EnumDescriptor* GetEnumDescriptor< ::dsnet::transaction::kvstore::proto::KVTxnReplyMessage_Status>() {
+  return ::dsnet::transaction::kvstore::proto::KVTxnReplyMessage_Status_descriptor();
+}
+
+PROTOBUF_NAMESPACE_CLOSE
+
+// @@protoc_insertion_point(global_scope)
+
+#include <google/protobuf/port_undef.inc>
+#endif  // GOOGLE_PROTOBUF_INCLUDED_GOOGLE_PROTOBUF_INCLUDED_transaction_2fapps_2fkvstore_2fkvstore_2dproto_2eproto
@@ -0,0 +1,12464 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: transaction/eris/eris-proto.proto
+
+#include "transaction/eris/eris-proto.pb.h"
+
+#include <algorithm>
+
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/extension_set.h>
+#include <google/protobuf/wire_format_lite.h>
+#include <google/protobuf/descriptor.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/reflection_ops.h>
+#include <google/protobuf/wire_format.h>
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+
+PROTOBUF_PRAGMA_INIT_SEG
+
+namespace _pb = ::PROTOBUF_NAMESPACE_ID;
+namespace _pbi = _pb::internal;
+
+namespace dsnet {
+namespace transaction {
+namespace eris {
+namespace proto {
+PROTOBUF_CONSTEXPR ViewNum::ViewNum(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.view_num_)*/0u
+  , /*decltype(_impl_.sess_num_)*/0u} {}
+struct ViewNumDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ViewNumDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ViewNumDefaultTypeInternal() {}
+  union {
+    ViewNum _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ViewNumDefaultTypeInternal _ViewNum_default_instance_;
+PROTOBUF_CONSTEXPR Stamp::Stamp(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.msg_num_)*/uint64_t{0u}
+  , /*decltype(_impl_.shard_num_)*/0u
+  , /*decltype(_impl_.sess_num_)*/0u} {}
+struct StampDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR StampDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~StampDefaultTypeInternal() {}
+  union {
+    Stamp _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 StampDefaultTypeInternal _Stamp_default_instance_;
+PROTOBUF_CONSTEXPR ReplyMessage::ReplyMessage(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.reply_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.view_)*/nullptr
+  , /*decltype(_impl_.clientid_)*/uint64_t{0u}
+  , /*decltype(_impl_.clientreqid_)*/uint64_t{0u}
+  , /*decltype(_impl_.shard_num_)*/0u
+  , /*decltype(_impl_.replica_num_)*/0u
+  , /*decltype(_impl_.op_num_)*/uint64_t{0u}
+  , /*decltype(_impl_.commit_)*/0u} {}
+struct ReplyMessageDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ReplyMessageDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ReplyMessageDefaultTypeInternal() {}
+  union {
+    ReplyMessage _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ReplyMessageDefaultTypeInternal _ReplyMessage_default_instance_;
+PROTOBUF_CONSTEXPR RequestMessage::RequestMessage(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.request_)*/nullptr
+  , /*decltype(_impl_.txnid_)*/uint64_t{0u}
+  , /*decltype(_impl_.type_)*/0} {}
+struct RequestMessageDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR RequestMessageDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~RequestMessageDefaultTypeInternal() {}
+  union {
+    RequestMessage _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 RequestMessageDefaultTypeInternal _RequestMessage_default_instance_;
+PROTOBUF_CONSTEXPR GapRequestMessage::GapRequestMessage(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.view_)*/nullptr
+  , /*decltype(_impl_.op_num_)*/uint64_t{0u}} {}
+struct GapRequestMessageDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR GapRequestMessageDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~GapRequestMessageDefaultTypeInternal() {}
+  union {
+    GapRequestMessage _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 GapRequestMessageDefaultTypeInternal _GapRequestMessage_default_instance_;
+PROTOBUF_CONSTEXPR GapReplyMessage::GapReplyMessage(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.view_)*/nullptr
+  , /*decltype(_impl_.req_)*/nullptr
+  , /*decltype(_impl_.op_num_)*/uint64_t{0u}
+  , /*decltype(_impl_.isfound_)*/false
+  , /*decltype(_impl_.isgap_)*/false
+  , /*decltype(_impl_.replica_num_)*/0u} {}
+struct GapReplyMessageDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR GapReplyMessageDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~GapReplyMessageDefaultTypeInternal() {}
+  union {
+    GapReplyMessage _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 GapReplyMessageDefaultTypeInternal _GapReplyMessage_default_instance_;
+PROTOBUF_CONSTEXPR SyncPrepareMessage::SyncPrepareMessage(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.view_)*/nullptr} {}
+struct SyncPrepareMessageDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR SyncPrepareMessageDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~SyncPrepareMessageDefaultTypeInternal() {}
+  union {
+    SyncPrepareMessage _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 SyncPrepareMessageDefaultTypeInternal _SyncPrepareMessage_default_instance_;
+PROTOBUF_CONSTEXPR ViewChangeRequestMessage::ViewChangeRequestMessage(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.view_)*/nullptr} {}
+struct ViewChangeRequestMessageDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ViewChangeRequestMessageDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ViewChangeRequestMessageDefaultTypeInternal() {}
+  union {
+    ViewChangeRequestMessage _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ViewChangeRequestMessageDefaultTypeInternal _ViewChangeRequestMessage_default_instance_;
+PROTOBUF_CONSTEXPR DropTxns::DropTxns(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.temp_drops_)*/{}
+  , /*decltype(_impl_.perm_drops_)*/{}
+  , /*decltype(_impl_.un_drops_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct DropTxnsDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR DropTxnsDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~DropTxnsDefaultTypeInternal() {}
+  union {
+    DropTxns _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 DropTxnsDefaultTypeInternal _DropTxns_default_instance_;
+PROTOBUF_CONSTEXPR ViewChangeMessage::ViewChangeMessage(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.view_)*/nullptr
+  , /*decltype(_impl_.drops_)*/nullptr
+  , /*decltype(_impl_.op_num_)*/uint64_t{0u}
+  , /*decltype(_impl_.replica_num_)*/0u} {}
+struct ViewChangeMessageDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ViewChangeMessageDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ViewChangeMessageDefaultTypeInternal() {}
+  union {
+    ViewChangeMessage _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ViewChangeMessageDefaultTypeInternal _ViewChangeMessage_default_instance_;
+PROTOBUF_CONSTEXPR StartViewMessage::StartViewMessage(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.view_)*/nullptr
+  , /*decltype(_impl_.drops_)*/nullptr
+  , /*decltype(_impl_.op_num_)*/uint64_t{0u}} {}
+struct StartViewMessageDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR StartViewMessageDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~StartViewMessageDefaultTypeInternal() {}
+  union {
+    StartViewMessage _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 StartViewMessageDefaultTypeInternal _StartViewMessage_default_instance_;
+PROTOBUF_CONSTEXPR StateTransferRequestMessage::StateTransferRequestMessage(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.view_)*/nullptr
+  , /*decltype(_impl_.begin_)*/uint64_t{0u}
+  , /*decltype(_impl_.end_)*/uint64_t{0u}} {}
+struct StateTransferRequestMessageDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR StateTransferRequestMessageDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~StateTransferRequestMessageDefaultTypeInternal() {}
+  union {
+    StateTransferRequestMessage _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 StateTransferRequestMessageDefaultTypeInternal _StateTransferRequestMessage_default_instance_;
+PROTOBUF_CONSTEXPR StateTransferReplyMessage_MsgLogEntry::StateTransferReplyMessage_MsgLogEntry(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.request_)*/nullptr
+  , /*decltype(_impl_.view_)*/uint64_t{0u}
+  , /*decltype(_impl_.op_num_)*/uint64_t{0u}
+  , /*decltype(_impl_.sess_num_)*/uint64_t{0u}
+  , /*decltype(_impl_.msg_num_)*/uint64_t{0u}
+  , /*decltype(_impl_.shard_num_)*/uint64_t{0u}
+  , /*decltype(_impl_.state_)*/0u} {}
+struct StateTransferReplyMessage_MsgLogEntryDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR StateTransferReplyMessage_MsgLogEntryDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~StateTransferReplyMessage_MsgLogEntryDefaultTypeInternal() {}
+  union {
+    StateTransferReplyMessage_MsgLogEntry _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 StateTransferReplyMessage_MsgLogEntryDefaultTypeInternal _StateTransferReplyMessage_MsgLogEntry_default_instance_;
+PROTOBUF_CONSTEXPR StateTransferReplyMessage::StateTransferReplyMessage(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.entries_)*/{}
+  , /*decltype(_impl_.view_)*/nullptr
+  , /*decltype(_impl_.begin_)*/uint64_t{0u}
+  , /*decltype(_impl_.end_)*/uint64_t{0u}} {}
+struct StateTransferReplyMessageDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR StateTransferReplyMessageDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~StateTransferReplyMessageDefaultTypeInternal() {}
+  union {
+    StateTransferReplyMessage _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 StateTransferReplyMessageDefaultTypeInternal _StateTransferReplyMessage_default_instance_;
+PROTOBUF_CONSTEXPR EpochChangeStateTransferRequest::EpochChangeStateTransferRequest(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.sess_num_)*/uint64_t{0u}
+  , /*decltype(_impl_.state_transfer_sess_num_)*/uint64_t{0u}
+  , /*decltype(_impl_.begin_)*/uint64_t{0u}
+  , /*decltype(_impl_.end_)*/uint64_t{0u}
+  , /*decltype(_impl_.shard_num_)*/0u} {}
+struct EpochChangeStateTransferRequestDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR EpochChangeStateTransferRequestDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~EpochChangeStateTransferRequestDefaultTypeInternal() {}
+  union {
+    EpochChangeStateTransferRequest _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 EpochChangeStateTransferRequestDefaultTypeInternal _EpochChangeStateTransferRequest_default_instance_;
+PROTOBUF_CONSTEXPR EpochChangeStateTransferReply_MsgEntry::EpochChangeStateTransferReply_MsgEntry(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.request_)*/nullptr
+  , /*decltype(_impl_.msg_num_)*/uint64_t{0u}} {}
+struct EpochChangeStateTransferReply_MsgEntryDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR EpochChangeStateTransferReply_MsgEntryDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~EpochChangeStateTransferReply_MsgEntryDefaultTypeInternal() {}
+  union {
+    EpochChangeStateTransferReply_MsgEntry _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 EpochChangeStateTransferReply_MsgEntryDefaultTypeInternal _EpochChangeStateTransferReply_MsgEntry_default_instance_;
+PROTOBUF_CONSTEXPR EpochChangeStateTransferReply::EpochChangeStateTransferReply(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.entries_)*/{}
+  , /*decltype(_impl_.sess_num_)*/uint64_t{0u}
+  , /*decltype(_impl_.state_transfer_sess_num_)*/uint64_t{0u}
+  , /*decltype(_impl_.shard_num_)*/0u} {}
+struct EpochChangeStateTransferReplyDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR EpochChangeStateTransferReplyDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~EpochChangeStateTransferReplyDefaultTypeInternal() {}
+  union {
+    EpochChangeStateTransferReply _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 EpochChangeStateTransferReplyDefaultTypeInternal _EpochChangeStateTransferReply_default_instance_;
+PROTOBUF_CONSTEXPR ToServerMessage::ToServerMessage(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.msg_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_._oneof_case_)*/{}} {}
+struct ToServerMessageDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ToServerMessageDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ToServerMessageDefaultTypeInternal() {}
+  union {
+    ToServerMessage _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ToServerMessageDefaultTypeInternal _ToServerMessage_default_instance_;
+PROTOBUF_CONSTEXPR TxnInfoRequest::TxnInfoRequest(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.txn_num_)*/nullptr} {}
+struct TxnInfoRequestDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR TxnInfoRequestDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~TxnInfoRequestDefaultTypeInternal() {}
+  union {
+    TxnInfoRequest _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 TxnInfoRequestDefaultTypeInternal _TxnInfoRequest_default_instance_;
+PROTOBUF_CONSTEXPR TxnReceived::TxnReceived(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.txn_)*/nullptr} {}
+struct TxnReceivedDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR TxnReceivedDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~TxnReceivedDefaultTypeInternal() {}
+  union {
+    TxnReceived _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 TxnReceivedDefaultTypeInternal _TxnReceived_default_instance_;
+PROTOBUF_CONSTEXPR TxnTempDropped::TxnTempDropped(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.txn_num_)*/nullptr} {}
+struct TxnTempDroppedDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR TxnTempDroppedDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~TxnTempDroppedDefaultTypeInternal() {}
+  union {
+    TxnTempDropped _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 TxnTempDroppedDefaultTypeInternal _TxnTempDropped_default_instance_;
+PROTOBUF_CONSTEXPR EpochChangeReq::EpochChangeReq(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.new_epoch_num_)*/0u} {}
+struct EpochChangeReqDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR EpochChangeReqDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~EpochChangeReqDefaultTypeInternal() {}
+  union {
+    EpochChangeReq _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 EpochChangeReqDefaultTypeInternal _EpochChangeReq_default_instance_;
+PROTOBUF_CONSTEXPR EpochChangeAck_LogInfoPiece::EpochChangeAck_LogInfoPiece(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.latest_msg_num_)*/uint64_t{0u}
+  , /*decltype(_impl_.shard_num_)*/0u} {}
+struct EpochChangeAck_LogInfoPieceDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR EpochChangeAck_LogInfoPieceDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~EpochChangeAck_LogInfoPieceDefaultTypeInternal() {}
+  union {
+    EpochChangeAck_LogInfoPiece _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 EpochChangeAck_LogInfoPieceDefaultTypeInternal _EpochChangeAck_LogInfoPiece_default_instance_;
+PROTOBUF_CONSTEXPR EpochChangeAck::EpochChangeAck(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.log_info_)*/{}
+  , /*decltype(_impl_.op_num_)*/uint64_t{0u}
+  , /*decltype(_impl_.last_normal_epoch_)*/0u} {}
+struct EpochChangeAckDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR EpochChangeAckDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~EpochChangeAckDefaultTypeInternal() {}
+  union {
+    EpochChangeAck _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 EpochChangeAckDefaultTypeInternal _EpochChangeAck_default_instance_;
+PROTOBUF_CONSTEXPR EpochChangeStateTransferAck::EpochChangeStateTransferAck(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.drops_)*/{}
+  , /*decltype(_impl_.op_num_)*/uint64_t{0u}} {}
+struct EpochChangeStateTransferAckDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR EpochChangeStateTransferAckDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~EpochChangeStateTransferAckDefaultTypeInternal() {}
+  union {
+    EpochChangeStateTransferAck _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 EpochChangeStateTransferAckDefaultTypeInternal _EpochChangeStateTransferAck_default_instance_;
+PROTOBUF_CONSTEXPR ErisToFCMessage::ErisToFCMessage(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.local_view_num_)*/nullptr
+  , /*decltype(_impl_.shard_num_)*/0u
+  , /*decltype(_impl_.replica_num_)*/0u
+  , /*decltype(_impl_.msg_)*/{}
+  , /*decltype(_impl_._oneof_case_)*/{}} {}
+struct ErisToFCMessageDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ErisToFCMessageDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ErisToFCMessageDefaultTypeInternal() {}
+  union {
+    ErisToFCMessage _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ErisToFCMessageDefaultTypeInternal _ErisToFCMessage_default_instance_;
+PROTOBUF_CONSTEXPR TxnCheck::TxnCheck(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.txn_num_)*/nullptr} {}
+struct TxnCheckDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR TxnCheckDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~TxnCheckDefaultTypeInternal() {}
+  union {
+    TxnCheck _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 TxnCheckDefaultTypeInternal _TxnCheck_default_instance_;
+PROTOBUF_CONSTEXPR TxnFound::TxnFound(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.txn_)*/nullptr} {}
+struct TxnFoundDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR TxnFoundDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~TxnFoundDefaultTypeInternal() {}
+  union {
+    TxnFound _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 TxnFoundDefaultTypeInternal _TxnFound_default_instance_;
+PROTOBUF_CONSTEXPR DropTxn::DropTxn(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.txn_num_)*/nullptr} {}
+struct DropTxnDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR DropTxnDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~DropTxnDefaultTypeInternal() {}
+  union {
+    DropTxn _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 DropTxnDefaultTypeInternal _DropTxn_default_instance_;
+PROTOBUF_CONSTEXPR EpochChange::EpochChange(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.new_epoch_num_)*/0u} {}
+struct EpochChangeDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR EpochChangeDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~EpochChangeDefaultTypeInternal() {}
+  union {
+    EpochChange _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 EpochChangeDefaultTypeInternal _EpochChange_default_instance_;
+PROTOBUF_CONSTEXPR EpochChangeStateTransfer_MsgEntry::EpochChangeStateTransfer_MsgEntry(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.shard_num_)*/0u
+  , /*decltype(_impl_.replica_num_)*/0u
+  , /*decltype(_impl_.msg_num_)*/uint64_t{0u}} {}
+struct EpochChangeStateTransfer_MsgEntryDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR EpochChangeStateTransfer_MsgEntryDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~EpochChangeStateTransfer_MsgEntryDefaultTypeInternal() {}
+  union {
+    EpochChangeStateTransfer_MsgEntry _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 EpochChangeStateTransfer_MsgEntryDefaultTypeInternal _EpochChangeStateTransfer_MsgEntry_default_instance_;
+PROTOBUF_CONSTEXPR EpochChangeStateTransfer::EpochChangeStateTransfer(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.perm_drops_)*/{}
+  , /*decltype(_impl_.latest_msgs_)*/{}
+  , /*decltype(_impl_.epoch_num_)*/0u
+  , /*decltype(_impl_.state_transfer_epoch_num_)*/0u} {}
+struct EpochChangeStateTransferDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR EpochChangeStateTransferDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~EpochChangeStateTransferDefaultTypeInternal() {}
+  union {
+    EpochChangeStateTransfer _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 EpochChangeStateTransferDefaultTypeInternal _EpochChangeStateTransfer_default_instance_;
+PROTOBUF_CONSTEXPR StartEpoch::StartEpoch(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.perm_drops_)*/{}
+  , /*decltype(_impl_.new_view_)*/nullptr
+  , /*decltype(_impl_.last_normal_epoch_num_)*/uint64_t{0u}
+  , /*decltype(_impl_.latest_op_num_)*/uint64_t{0u}
+  , /*decltype(_impl_.latest_replica_num_)*/0u} {}
+struct StartEpochDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR StartEpochDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~StartEpochDefaultTypeInternal() {}
+  union {
+    StartEpoch _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 StartEpochDefaultTypeInternal _StartEpoch_default_instance_;
+PROTOBUF_CONSTEXPR FCToErisMessage::FCToErisMessage(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.msg_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_._oneof_case_)*/{}} {}
+struct FCToErisMessageDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR FCToErisMessageDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~FCToErisMessageDefaultTypeInternal() {}
+  union {
+    FCToErisMessage _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 FCToErisMessageDefaultTypeInternal _FCToErisMessage_default_instance_;
+}  // namespace proto
+}  // namespace eris
+}  // namespace transaction
+}  // namespace dsnet
+static ::_pb::Metadata file_level_metadata_transaction_2feris_2feris_2dproto_2eproto[34];
+static const ::_pb::EnumDescriptor* file_level_enum_descriptors_transaction_2feris_2feris_2dproto_2eproto[1];
+static constexpr ::_pb::ServiceDescriptor const** file_level_service_descriptors_transaction_2feris_2feris_2dproto_2eproto = nullptr;
+
+const uint32_t TableStruct_transaction_2feris_2feris_2dproto_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  PROTOBUF_FIELD_OFFSET(::dsnet::transaction::eris::proto::ViewNum, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::transaction::eris::proto::ViewNum, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::dsnet::transaction::eris::proto::ViewNum, _impl_.view_num_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::transaction::eris::proto::ViewNum, _impl_.sess_num_),
+  0,
+  1,
+  PROTOBUF_FIELD_OFFSET(::dsnet::transaction::eris::proto::Stamp, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::transaction::eris::proto::Stamp, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::dsnet::transaction::eris::proto::Stamp, _impl_.shard_num_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::transaction::eris::proto::Stamp, _impl_.msg_num_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::transaction::eris::proto::Stamp, _impl_.sess_num_),
+  1,
+  0,
+  2,
+  PROTOBUF_FIELD_OFFSET(::dsnet::transaction::eris::proto::ReplyMessage, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::transaction::eris::proto::ReplyMessage, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::dsnet::transaction::eris::proto::ReplyMessage, _impl_.clientid_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::transaction::eris::proto::ReplyMessage, _impl_.clientreqid_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::transaction::eris::proto::ReplyMessage, _impl_.shard_num_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::transaction::eris::proto::ReplyMessage, _impl_.replica_num_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::transaction::eris::proto::ReplyMessage, _impl_.view_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::transaction::eris::proto::ReplyMessage, _impl_.op_num_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::transaction::eris::proto::ReplyMessage, _impl_.commit_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::transaction::eris::proto::ReplyMessage, _impl_.reply_),
+  2,
+  3,
+  4,
+  5,
+  1,
+  6,
+  7,
+  0,
+  PROTOBUF_FIELD_OFFSET(::dsnet::transaction::eris::proto::RequestMessage, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::transaction::eris::proto::RequestMessage, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::dsnet::transaction::eris::proto::RequestMessage, _impl_.txnid_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::transaction::eris::proto::RequestMessage, _impl_.type_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::transaction::eris::proto::RequestMessage, _impl_.request_),
+  1,
+  2,
+  0,
+  PROTOBUF_FIELD_OFFSET(::dsnet::transaction::eris::proto::GapRequestMessage, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::transaction::eris::proto::GapRequestMessage, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::dsnet::transaction::eris::proto::GapRequestMessage, _impl_.view_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::transaction::eris::proto::GapRequestMessage, _impl_.op_num_),
+  0,
+  1,
+  PROTOBUF_FIELD_OFFSET(::dsnet::transaction::eris::proto::GapReplyMessage, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::transaction::eris::proto::GapReplyMessage, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::dsnet::transaction::eris::proto::GapReplyMessage, _impl_.view_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::transaction::eris::proto::GapReplyMessage, _impl_.op_num_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::transaction::eris::proto::GapReplyMessage, _impl_.isfound_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::transaction::eris::proto::GapReplyMessage, _impl_.isgap_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::transaction::eris::proto::GapReplyMessage, _impl_.replica_num_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::transaction::eris::proto::GapReplyMessage, _impl_.req_),
+  0,
+  2,
+  3,
+  4,
+  5,
+  1,
+  PROTOBUF_FIELD_OFFSET(::dsnet::transaction::eris::proto::SyncPrepareMessage, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::transaction::eris::proto::SyncPrepareMessage, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::dsnet::transaction::eris::proto::SyncPrepareMessage, _impl_.view_),
+  0,
+  PROTOBUF_FIELD_OFFSET(::dsnet::transaction::eris::proto::ViewChangeRequestMessage, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::transaction::eris::proto::ViewChangeRequestMessage, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::dsnet::transaction::eris::proto::ViewChangeRequestMessage, _impl_.view_),
+  0,
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::dsnet::transaction::eris::proto::DropTxns, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::dsnet::transaction::eris::proto::DropTxns, _impl_.temp_drops_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::transaction::eris::proto::DropTxns, _impl_.perm_drops_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::transaction::eris::proto::DropTxns, _impl_.un_drops_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::transaction::eris::proto::ViewChangeMessage, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::transaction::eris::proto::ViewChangeMessage, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::dsnet::transaction::eris::proto::ViewChangeMessage, _impl_.view_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::transaction::eris::proto::ViewChangeMessage, _impl_.replica_num_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::transaction::eris::proto::ViewChangeMessage, _impl_.op_num_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::transaction::eris::proto::ViewChangeMessage, _impl_.drops_),
+  0,
+  3,
+  2,
+  1,
+  PROTOBUF_FIELD_OFFSET(::dsnet::transaction::eris::proto::StartViewMessage, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::transaction::eris::proto::StartViewMessage, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::dsnet::transaction::eris::proto::StartViewMessage, _impl_.view_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::transaction::eris::proto::StartViewMessage, _impl_.op_num_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::transaction::eris::proto::StartViewMessage, _impl_.drops_),
+  0,
+  2,
+  1,
+  PROTOBUF_FIELD_OFFSET(::dsnet::transaction::eris::proto::StateTransferRequestMessage, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::transaction::eris::proto::StateTransferRequestMessage, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::dsnet::transaction::eris::proto::StateTransferRequestMessage, _impl_.view_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::transaction::eris::proto::StateTransferRequestMessage, _impl_.begin_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::transaction::eris::proto::StateTransferRequestMessage, _impl_.end_),
+  0,
+  1,
+  2,
+  PROTOBUF_FIELD_OFFSET(::dsnet::transaction::eris::proto::StateTransferReplyMessage_MsgLogEntry, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::transaction::eris::proto::StateTransferReplyMessage_MsgLogEntry, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::dsnet::transaction::eris::proto::StateTransferReplyMessage_MsgLogEntry, _impl_.view_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::transaction::eris::proto::StateTransferReplyMessage_MsgLogEntry, _impl_.op_num_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::transaction::eris::proto::StateTransferReplyMessage_MsgLogEntry, _impl_.sess_num_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::transaction::eris::proto::StateTransferReplyMessage_MsgLogEntry, _impl_.msg_num_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::transaction::eris::proto::StateTransferReplyMessage_MsgLogEntry, _impl_.shard_num_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::transaction::eris::proto::StateTransferReplyMessage_MsgLogEntry, _impl_.state_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::transaction::eris::proto::StateTransferReplyMessage_MsgLogEntry, _impl_.request_),
+  1,
+  2,
+  3,
+  4,
+  5,
+  6,
+  0,
+  PROTOBUF_FIELD_OFFSET(::dsnet::transaction::eris::proto::StateTransferReplyMessage, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::transaction::eris::proto::StateTransferReplyMessage, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::dsnet::transaction::eris::proto::StateTransferReplyMessage, _impl_.view_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::transaction::eris::proto::StateTransferReplyMessage, _impl_.begin_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::transaction::eris::proto::StateTransferReplyMessage, _impl_.end_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::transaction::eris::proto::StateTransferReplyMessage, _impl_.entries_),
+  0,
+  1,
+  2,
+  ~0u,
+  PROTOBUF_FIELD_OFFSET(::dsnet::transaction::eris::proto::EpochChangeStateTransferRequest, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::transaction::eris::proto::EpochChangeStateTransferRequest, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::dsnet::transaction::eris::proto::EpochChangeStateTransferRequest, _impl_.sess_num_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::transaction::eris::proto::EpochChangeStateTransferRequest, _impl_.state_transfer_sess_num_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::transaction::eris::proto::EpochChangeStateTransferRequest, _impl_.shard_num_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::transaction::eris::proto::EpochChangeStateTransferRequest, _impl_.begin_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::transaction::eris::proto::EpochChangeStateTransferRequest, _impl_.end_),
+  0,
+  1,
+  4,
+  2,
+  3,
+  PROTOBUF_FIELD_OFFSET(::dsnet::transaction::eris::proto::EpochChangeStateTransferReply_MsgEntry, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::transaction::eris::proto::EpochChangeStateTransferReply_MsgEntry, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::dsnet::transaction::eris::proto::EpochChangeStateTransferReply_MsgEntry, _impl_.msg_num_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::transaction::eris::proto::EpochChangeStateTransferReply_MsgEntry, _impl_.request_),
+  1,
+  0,
+  PROTOBUF_FIELD_OFFSET(::dsnet::transaction::eris::proto::EpochChangeStateTransferReply, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::transaction::eris::proto::EpochChangeStateTransferReply, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::dsnet::transaction::eris::proto::EpochChangeStateTransferReply, _impl_.sess_num_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::transaction::eris::proto::EpochChangeStateTransferReply, _impl_.state_transfer_sess_num_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::transaction::eris::proto::EpochChangeStateTransferReply, _impl_.shard_num_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::transaction::eris::proto::EpochChangeStateTransferReply, _impl_.entries_),
+  0,
+  1,
+  2,
+  ~0u,
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::dsnet::transaction::eris::proto::ToServerMessage, _internal_metadata_),
+  ~0u,  // no _extensions_
+  PROTOBUF_FIELD_OFFSET(::dsnet::transaction::eris::proto::ToServerMessage, _impl_._oneof_case_[0]),
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  PROTOBUF_FIELD_OFFSET(::dsnet::transaction::eris::proto::ToServerMessage, _impl_.msg_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::transaction::eris::proto::TxnInfoRequest, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::transaction::eris::proto::TxnInfoRequest, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::dsnet::transaction::eris::proto::TxnInfoRequest, _impl_.txn_num_),
+  0,
+  PROTOBUF_FIELD_OFFSET(::dsnet::transaction::eris::proto::TxnReceived, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::transaction::eris::proto::TxnReceived, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::dsnet::transaction::eris::proto::TxnReceived, _impl_.txn_),
+  0,
+  PROTOBUF_FIELD_OFFSET(::dsnet::transaction::eris::proto::TxnTempDropped, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::transaction::eris::proto::TxnTempDropped, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::dsnet::transaction::eris::proto::TxnTempDropped, _impl_.txn_num_),
+  0,
+  PROTOBUF_FIELD_OFFSET(::dsnet::transaction::eris::proto::EpochChangeReq, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::transaction::eris::proto::EpochChangeReq, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::dsnet::transaction::eris::proto::EpochChangeReq, _impl_.new_epoch_num_),
+  0,
+  PROTOBUF_FIELD_OFFSET(::dsnet::transaction::eris::proto::EpochChangeAck_LogInfoPiece, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::transaction::eris::proto::EpochChangeAck_LogInfoPiece, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::dsnet::transaction::eris::proto::EpochChangeAck_LogInfoPiece, _impl_.shard_num_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::transaction::eris::proto::EpochChangeAck_LogInfoPiece, _impl_.latest_msg_num_),
+  1,
+  0,
+  PROTOBUF_FIELD_OFFSET(::dsnet::transaction::eris::proto::EpochChangeAck, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::transaction::eris::proto::EpochChangeAck, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::dsnet::transaction::eris::proto::EpochChangeAck, _impl_.last_normal_epoch_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::transaction::eris::proto::EpochChangeAck, _impl_.op_num_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::transaction::eris::proto::EpochChangeAck, _impl_.log_info_),
+  1,
+  0,
+  ~0u,
+  PROTOBUF_FIELD_OFFSET(::dsnet::transaction::eris::proto::EpochChangeStateTransferAck, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::transaction::eris::proto::EpochChangeStateTransferAck, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::dsnet::transaction::eris::proto::EpochChangeStateTransferAck, _impl_.op_num_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::transaction::eris::proto::EpochChangeStateTransferAck, _impl_.drops_),
+  0,
+  ~0u,
+  PROTOBUF_FIELD_OFFSET(::dsnet::transaction::eris::proto::ErisToFCMessage, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::transaction::eris::proto::ErisToFCMessage, _internal_metadata_),
+  ~0u,  // no _extensions_
+  PROTOBUF_FIELD_OFFSET(::dsnet::transaction::eris::proto::ErisToFCMessage, _impl_._oneof_case_[0]),
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::dsnet::transaction::eris::proto::ErisToFCMessage, _impl_.shard_num_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::transaction::eris::proto::ErisToFCMessage, _impl_.replica_num_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::transaction::eris::proto::ErisToFCMessage, _impl_.local_view_num_),
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  PROTOBUF_FIELD_OFFSET(::dsnet::transaction::eris::proto::ErisToFCMessage, _impl_.msg_),
+  1,
+  2,
+  0,
+  ~0u,
+  ~0u,
+  ~0u,
+  ~0u,
+  ~0u,
+  ~0u,
+  PROTOBUF_FIELD_OFFSET(::dsnet::transaction::eris::proto::TxnCheck, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::transaction::eris::proto::TxnCheck, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::dsnet::transaction::eris::proto::TxnCheck, _impl_.txn_num_),
+  0,
+  PROTOBUF_FIELD_OFFSET(::dsnet::transaction::eris::proto::TxnFound, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::transaction::eris::proto::TxnFound, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::dsnet::transaction::eris::proto::TxnFound, _impl_.txn_),
+  0,
+  PROTOBUF_FIELD_OFFSET(::dsnet::transaction::eris::proto::DropTxn, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::transaction::eris::proto::DropTxn, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::dsnet::transaction::eris::proto::DropTxn, _impl_.txn_num_),
+  0,
+  PROTOBUF_FIELD_OFFSET(::dsnet::transaction::eris::proto::EpochChange, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::transaction::eris::proto::EpochChange, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::dsnet::transaction::eris::proto::EpochChange, _impl_.new_epoch_num_),
+  0,
+  PROTOBUF_FIELD_OFFSET(::dsnet::transaction::eris::proto::EpochChangeStateTransfer_MsgEntry, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::transaction::eris::proto::EpochChangeStateTransfer_MsgEntry, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::dsnet::transaction::eris::proto::EpochChangeStateTransfer_MsgEntry, _impl_.shard_num_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::transaction::eris::proto::EpochChangeStateTransfer_MsgEntry, _impl_.replica_num_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::transaction::eris::proto::EpochChangeStateTransfer_MsgEntry, _impl_.msg_num_),
+  0,
+  1,
+  2,
+  PROTOBUF_FIELD_OFFSET(::dsnet::transaction::eris::proto::EpochChangeStateTransfer, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::transaction::eris::proto::EpochChangeStateTransfer, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::dsnet::transaction::eris::proto::EpochChangeStateTransfer, _impl_.epoch_num_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::transaction::eris::proto::EpochChangeStateTransfer, _impl_.state_transfer_epoch_num_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::transaction::eris::proto::EpochChangeStateTransfer, _impl_.perm_drops_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::transaction::eris::proto::EpochChangeStateTransfer, _impl_.latest_msgs_),
+  0,
+  1,
+  ~0u,
+  ~0u,
+  PROTOBUF_FIELD_OFFSET(::dsnet::transaction::eris::proto::StartEpoch, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::transaction::eris::proto::StartEpoch, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::dsnet::transaction::eris::proto::StartEpoch, _impl_.new_view_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::transaction::eris::proto::StartEpoch, _impl_.last_normal_epoch_num_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::transaction::eris::proto::StartEpoch, _impl_.perm_drops_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::transaction::eris::proto::StartEpoch, _impl_.latest_replica_num_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::transaction::eris::proto::StartEpoch, _impl_.latest_op_num_),
+  0,
+  1,
+  ~0u,
+  3,
+  2,
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::dsnet::transaction::eris::proto::FCToErisMessage, _internal_metadata_),
+  ~0u,  // no _extensions_
+  PROTOBUF_FIELD_OFFSET(::dsnet::transaction::eris::proto::FCToErisMessage, _impl_._oneof_case_[0]),
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  PROTOBUF_FIELD_OFFSET(::dsnet::transaction::eris::proto::FCToErisMessage, _impl_.msg_),
+};
+static const ::_pbi::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  { 0, 8, -1, sizeof(::dsnet::transaction::eris::proto::ViewNum)},
+  { 10, 19, -1, sizeof(::dsnet::transaction::eris::proto::Stamp)},
+  { 22, 36, -1, sizeof(::dsnet::transaction::eris::proto::ReplyMessage)},
+  { 44, 53, -1, sizeof(::dsnet::transaction::eris::proto::RequestMessage)},
+  { 56, 64, -1, sizeof(::dsnet::transaction::eris::proto::GapRequestMessage)},
+  { 66, 78, -1, sizeof(::dsnet::transaction::eris::proto::GapReplyMessage)},
+  { 84, 91, -1, sizeof(::dsnet::transaction::eris::proto::SyncPrepareMessage)},
+  { 92, 99, -1, sizeof(::dsnet::transaction::eris::proto::ViewChangeRequestMessage)},
+  { 100, -1, -1, sizeof(::dsnet::transaction::eris::proto::DropTxns)},
+  { 109, 119, -1, sizeof(::dsnet::transaction::eris::proto::ViewChangeMessage)},
+  { 123, 132, -1, sizeof(::dsnet::transaction::eris::proto::StartViewMessage)},
+  { 135, 144, -1, sizeof(::dsnet::transaction::eris::proto::StateTransferRequestMessage)},
+  { 147, 160, -1, sizeof(::dsnet::transaction::eris::proto::StateTransferReplyMessage_MsgLogEntry)},
+  { 167, 177, -1, sizeof(::dsnet::transaction::eris::proto::StateTransferReplyMessage)},
+  { 181, 192, -1, sizeof(::dsnet::transaction::eris::proto::EpochChangeStateTransferRequest)},
+  { 197, 205, -1, sizeof(::dsnet::transaction::eris::proto::EpochChangeStateTransferReply_MsgEntry)},
+  { 207, 217, -1, sizeof(::dsnet::transaction::eris::proto::EpochChangeStateTransferReply)},
+  { 221, -1, -1, sizeof(::dsnet::transaction::eris::proto::ToServerMessage)},
+  { 240, 247, -1, sizeof(::dsnet::transaction::eris::proto::TxnInfoRequest)},
+  { 248, 255, -1, sizeof(::dsnet::transaction::eris::proto::TxnReceived)},
+  { 256, 263, -1, sizeof(::dsnet::transaction::eris::proto::TxnTempDropped)},
+  { 264, 271, -1, sizeof(::dsnet::transaction::eris::proto::EpochChangeReq)},
+  { 272, 280, -1, sizeof(::dsnet::transaction::eris::proto::EpochChangeAck_LogInfoPiece)},
+  { 282, 291, -1, sizeof(::dsnet::transaction::eris::proto::EpochChangeAck)},
+  { 294, 302, -1, sizeof(::dsnet::transaction::eris::proto::EpochChangeStateTransferAck)},
+  { 304, 320, -1, sizeof(::dsnet::transaction::eris::proto::ErisToFCMessage)},
+  { 329, 336, -1, sizeof(::dsnet::transaction::eris::proto::TxnCheck)},
+  { 337, 344, -1, sizeof(::dsnet::transaction::eris::proto::TxnFound)},
+  { 345, 352, -1, sizeof(::dsnet::transaction::eris::proto::DropTxn)},
+  { 353, 360, -1, sizeof(::dsnet::transaction::eris::proto::EpochChange)},
+  { 361, 370, -1, sizeof(::dsnet::transaction::eris::proto::EpochChangeStateTransfer_MsgEntry)},
+  { 373, 383, -1, sizeof(::dsnet::transaction::eris::proto::EpochChangeStateTransfer)},
+  { 387, 398, -1, sizeof(::dsnet::transaction::eris::proto::StartEpoch)},
+  { 403, -1, -1, sizeof(::dsnet::transaction::eris::proto::FCToErisMessage)},
+};
+
+static const ::_pb::Message* const file_default_instances[] = {
+  &::dsnet::transaction::eris::proto::_ViewNum_default_instance_._instance,
+  &::dsnet::transaction::eris::proto::_Stamp_default_instance_._instance,
+  &::dsnet::transaction::eris::proto::_ReplyMessage_default_instance_._instance,
+  &::dsnet::transaction::eris::proto::_RequestMessage_default_instance_._instance,
+  &::dsnet::transaction::eris::proto::_GapRequestMessage_default_instance_._instance,
+  &::dsnet::transaction::eris::proto::_GapReplyMessage_default_instance_._instance,
+  &::dsnet::transaction::eris::proto::_SyncPrepareMessage_default_instance_._instance,
+  &::dsnet::transaction::eris::proto::_ViewChangeRequestMessage_default_instance_._instance,
+  &::dsnet::transaction::eris::proto::_DropTxns_default_instance_._instance,
+  &::dsnet::transaction::eris::proto::_ViewChangeMessage_default_instance_._instance,
+  &::dsnet::transaction::eris::proto::_StartViewMessage_default_instance_._instance,
+  &::dsnet::transaction::eris::proto::_StateTransferRequestMessage_default_instance_._instance,
+  &::dsnet::transaction::eris::proto::_StateTransferReplyMessage_MsgLogEntry_default_instance_._instance,
+  &::dsnet::transaction::eris::proto::_StateTransferReplyMessage_default_instance_._instance,
+  &::dsnet::transaction::eris::proto::_EpochChangeStateTransferRequest_default_instance_._instance,
+  &::dsnet::transaction::eris::proto::_EpochChangeStateTransferReply_MsgEntry_default_instance_._instance,
+  &::dsnet::transaction::eris::proto::_EpochChangeStateTransferReply_default_instance_._instance,
+  &::dsnet::transaction::eris::proto::_ToServerMessage_default_instance_._instance,
+  &::dsnet::transaction::eris::proto::_TxnInfoRequest_default_instance_._instance,
+  &::dsnet::transaction::eris::proto::_TxnReceived_default_instance_._instance,
+  &::dsnet::transaction::eris::proto::_TxnTempDropped_default_instance_._instance,
+  &::dsnet::transaction::eris::proto::_EpochChangeReq_default_instance_._instance,
+  &::dsnet::transaction::eris::proto::_EpochChangeAck_LogInfoPiece_default_instance_._instance,
+  &::dsnet::transaction::eris::proto::_EpochChangeAck_default_instance_._instance,
+  &::dsnet::transaction::eris::proto::_EpochChangeStateTransferAck_default_instance_._instance,
+  &::dsnet::transaction::eris::proto::_ErisToFCMessage_default_instance_._instance,
+  &::dsnet::transaction::eris::proto::_TxnCheck_default_instance_._instance,
+  &::dsnet::transaction::eris::proto::_TxnFound_default_instance_._instance,
+  &::dsnet::transaction::eris::proto::_DropTxn_default_instance_._instance,
+  &::dsnet::transaction::eris::proto::_EpochChange_default_instance_._instance,
+  &::dsnet::transaction::eris::proto::_EpochChangeStateTransfer_MsgEntry_default_instance_._instance,
+  &::dsnet::transaction::eris::proto::_EpochChangeStateTransfer_default_instance_._instance,
+  &::dsnet::transaction::eris::proto::_StartEpoch_default_instance_._instance,
+  &::dsnet::transaction::eris::proto::_FCToErisMessage_default_instance_._instance,
+};
+
+const char descriptor_table_protodef_transaction_2feris_2feris_2dproto_2eproto[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) =
+  "\n!transaction/eris/eris-proto.proto\022\034dsn"
+  "et.transaction.eris.proto\032\024common/reques"
+  "t.proto\"-\n\007ViewNum\022\020\n\010view_num\030\001 \002(\r\022\020\n\010"
+  "sess_num\030\002 \002(\r\"=\n\005Stamp\022\021\n\tshard_num\030\001 \002"
+  "(\r\022\017\n\007msg_num\030\002 \002(\004\022\020\n\010sess_num\030\003 \001(\r\"\301\001"
+  "\n\014ReplyMessage\022\020\n\010clientid\030\001 \002(\004\022\023\n\013clie"
+  "ntreqid\030\002 \002(\004\022\021\n\tshard_num\030\003 \002(\r\022\023\n\013repl"
+  "ica_num\030\004 \002(\r\0223\n\004view\030\005 \002(\0132%.dsnet.tran"
+  "saction.eris.proto.ViewNum\022\016\n\006op_num\030\006 \002"
+  "(\004\022\016\n\006commit\030\007 \001(\r\022\r\n\005reply\030\010 \001(\014\"y\n\016Req"
+  "uestMessage\022\r\n\005txnid\030\001 \002(\004\0227\n\004type\030\002 \002(\016"
+  "2).dsnet.transaction.eris.proto.RequestT"
+  "ype\022\037\n\007request\030\003 \002(\0132\016.dsnet.Request\"X\n\021"
+  "GapRequestMessage\0223\n\004view\030\001 \002(\0132%.dsnet."
+  "transaction.eris.proto.ViewNum\022\016\n\006op_num"
+  "\030\002 \002(\004\"\306\001\n\017GapReplyMessage\0223\n\004view\030\001 \002(\013"
+  "2%.dsnet.transaction.eris.proto.ViewNum\022"
+  "\016\n\006op_num\030\002 \002(\004\022\017\n\007isfound\030\004 \002(\010\022\r\n\005isga"
+  "p\030\005 \002(\010\022\023\n\013replica_num\030\006 \002(\r\0229\n\003req\030\007 \001("
+  "\0132,.dsnet.transaction.eris.proto.Request"
+  "Message\"I\n\022SyncPrepareMessage\0223\n\004view\030\001 "
+  "\002(\0132%.dsnet.transaction.eris.proto.ViewN"
+  "um\"O\n\030ViewChangeRequestMessage\0223\n\004view\030\001"
+  " \002(\0132%.dsnet.transaction.eris.proto.View"
+  "Num\"\274\001\n\010DropTxns\0227\n\ntemp_drops\030\001 \003(\0132#.d"
+  "snet.transaction.eris.proto.Stamp\0227\n\nper"
+  "m_drops\030\002 \003(\0132#.dsnet.transaction.eris.p"
+  "roto.Stamp\022>\n\010un_drops\030\003 \003(\0132,.dsnet.tra"
+  "nsaction.eris.proto.RequestMessage\"\244\001\n\021V"
+  "iewChangeMessage\0223\n\004view\030\001 \002(\0132%.dsnet.t"
+  "ransaction.eris.proto.ViewNum\022\023\n\013replica"
+  "_num\030\002 \002(\r\022\016\n\006op_num\030\003 \002(\004\0225\n\005drops\030\004 \002("
+  "\0132&.dsnet.transaction.eris.proto.DropTxn"
+  "s\"\216\001\n\020StartViewMessage\0223\n\004view\030\001 \002(\0132%.d"
+  "snet.transaction.eris.proto.ViewNum\022\016\n\006o"
+  "p_num\030\002 \002(\004\0225\n\005drops\030\003 \002(\0132&.dsnet.trans"
+  "action.eris.proto.DropTxns\"n\n\033StateTrans"
+  "ferRequestMessage\0223\n\004view\030\001 \002(\0132%.dsnet."
+  "transaction.eris.proto.ViewNum\022\r\n\005begin\030"
+  "\002 \002(\004\022\013\n\003end\030\003 \002(\004\"\364\002\n\031StateTransferRepl"
+  "yMessage\0223\n\004view\030\001 \002(\0132%.dsnet.transacti"
+  "on.eris.proto.ViewNum\022\r\n\005begin\030\002 \002(\004\022\013\n\003"
+  "end\030\003 \002(\004\022T\n\007entries\030\004 \003(\0132C.dsnet.trans"
+  "action.eris.proto.StateTransferReplyMess"
+  "age.MsgLogEntry\032\257\001\n\013MsgLogEntry\022\014\n\004view\030"
+  "\001 \002(\004\022\016\n\006op_num\030\002 \002(\004\022\020\n\010sess_num\030\003 \002(\004\022"
+  "\017\n\007msg_num\030\004 \002(\004\022\021\n\tshard_num\030\005 \002(\004\022\r\n\005s"
+  "tate\030\006 \002(\r\022=\n\007request\030\007 \002(\0132,.dsnet.tran"
+  "saction.eris.proto.RequestMessage\"\203\001\n\037Ep"
+  "ochChangeStateTransferRequest\022\020\n\010sess_nu"
+  "m\030\001 \002(\004\022\037\n\027state_transfer_sess_num\030\002 \002(\004"
+  "\022\021\n\tshard_num\030\003 \002(\r\022\r\n\005begin\030\004 \002(\004\022\013\n\003en"
+  "d\030\005 \002(\004\"\230\002\n\035EpochChangeStateTransferRepl"
+  "y\022\020\n\010sess_num\030\001 \002(\004\022\037\n\027state_transfer_se"
+  "ss_num\030\002 \002(\004\022\021\n\tshard_num\030\003 \002(\r\022U\n\007entri"
+  "es\030\004 \003(\0132D.dsnet.transaction.eris.proto."
+  "EpochChangeStateTransferReply.MsgEntry\032Z"
+  "\n\010MsgEntry\022\017\n\007msg_num\030\001 \002(\004\022=\n\007request\030\002"
+  " \002(\0132,.dsnet.transaction.eris.proto.Requ"
+  "estMessage\"\337\007\n\017ToServerMessage\022\?\n\007reques"
+  "t\030\001 \001(\0132,.dsnet.transaction.eris.proto.R"
+  "equestMessageH\000\022F\n\013gap_request\030\002 \001(\0132/.d"
+  "snet.transaction.eris.proto.GapRequestMe"
+  "ssageH\000\022B\n\tgap_reply\030\003 \001(\0132-.dsnet.trans"
+  "action.eris.proto.GapReplyMessageH\000\022;\n\002f"
+  "c\030\004 \001(\0132-.dsnet.transaction.eris.proto.F"
+  "CToErisMessageH\000\022H\n\014sync_prepare\030\005 \001(\01320"
+  ".dsnet.transaction.eris.proto.SyncPrepar"
+  "eMessageH\000\022U\n\023view_change_request\030\006 \001(\0132"
+  "6.dsnet.transaction.eris.proto.ViewChang"
+  "eRequestMessageH\000\022F\n\013view_change\030\007 \001(\0132/"
+  ".dsnet.transaction.eris.proto.ViewChange"
+  "MessageH\000\022D\n\nstart_view\030\010 \001(\0132..dsnet.tr"
+  "ansaction.eris.proto.StartViewMessageH\000\022"
+  "[\n\026state_transfer_request\030\t \001(\01329.dsnet."
+  "transaction.eris.proto.StateTransferRequ"
+  "estMessageH\000\022W\n\024state_transfer_reply\030\n \001"
+  "(\01327.dsnet.transaction.eris.proto.StateT"
+  "ransferReplyMessageH\000\022l\n#epoch_change_st"
+  "ate_transfer_request\030\013 \001(\0132=.dsnet.trans"
+  "action.eris.proto.EpochChangeStateTransf"
+  "erRequestH\000\022h\n!epoch_change_state_transf"
+  "er_reply\030\014 \001(\0132;.dsnet.transaction.eris."
+  "proto.EpochChangeStateTransferReplyH\000B\005\n"
+  "\003msg\"F\n\016TxnInfoRequest\0224\n\007txn_num\030\001 \002(\0132"
+  "#.dsnet.transaction.eris.proto.Stamp\"H\n\013"
+  "TxnReceived\0229\n\003txn\030\001 \002(\0132,.dsnet.transac"
+  "tion.eris.proto.RequestMessage\"F\n\016TxnTem"
+  "pDropped\0224\n\007txn_num\030\001 \002(\0132#.dsnet.transa"
+  "ction.eris.proto.Stamp\"\'\n\016EpochChangeReq"
+  "\022\025\n\rnew_epoch_num\030\001 \002(\r\"\303\001\n\016EpochChangeA"
+  "ck\022\031\n\021last_normal_epoch\030\001 \002(\r\022\016\n\006op_num\030"
+  "\002 \002(\004\022K\n\010log_info\030\003 \003(\01329.dsnet.transact"
+  "ion.eris.proto.EpochChangeAck.LogInfoPie"
+  "ce\0329\n\014LogInfoPiece\022\021\n\tshard_num\030\001 \002(\r\022\026\n"
+  "\016latest_msg_num\030\002 \002(\004\"a\n\033EpochChangeStat"
+  "eTransferAck\022\016\n\006op_num\030\001 \002(\004\0222\n\005drops\030\002 "
+  "\003(\0132#.dsnet.transaction.eris.proto.Stamp"
+  "\"\311\004\n\017ErisToFCMessage\022\021\n\tshard_num\030\001 \002(\r\022"
+  "\023\n\013replica_num\030\002 \002(\r\022=\n\016local_view_num\030\003"
+  " \002(\0132%.dsnet.transaction.eris.proto.View"
+  "Num\022D\n\014txn_info_req\030\004 \001(\0132,.dsnet.transa"
+  "ction.eris.proto.TxnInfoRequestH\000\022A\n\014txn"
+  "_received\030\005 \001(\0132).dsnet.transaction.eris"
+  ".proto.TxnReceivedH\000\022E\n\rtxn_temp_drop\030\006 "
+  "\001(\0132,.dsnet.transaction.eris.proto.TxnTe"
+  "mpDroppedH\000\022H\n\020epoch_change_req\030\007 \001(\0132,."
+  "dsnet.transaction.eris.proto.EpochChange"
+  "ReqH\000\022H\n\020epoch_change_ack\030\010 \001(\0132,.dsnet."
+  "transaction.eris.proto.EpochChangeAckH\000\022"
+  "d\n\037epoch_change_state_transfer_ack\030\t \001(\013"
+  "29.dsnet.transaction.eris.proto.EpochCha"
+  "ngeStateTransferAckH\000B\005\n\003msg\"@\n\010TxnCheck"
+  "\0224\n\007txn_num\030\001 \002(\0132#.dsnet.transaction.er"
+  "is.proto.Stamp\"E\n\010TxnFound\0229\n\003txn\030\001 \002(\0132"
+  ",.dsnet.transaction.eris.proto.RequestMe"
+  "ssage\"\?\n\007DropTxn\0224\n\007txn_num\030\001 \002(\0132#.dsne"
+  "t.transaction.eris.proto.Stamp\"$\n\013EpochC"
+  "hange\022\025\n\rnew_epoch_num\030\001 \002(\r\"\243\002\n\030EpochCh"
+  "angeStateTransfer\022\021\n\tepoch_num\030\001 \002(\r\022 \n\030"
+  "state_transfer_epoch_num\030\002 \002(\r\0227\n\nperm_d"
+  "rops\030\003 \003(\0132#.dsnet.transaction.eris.prot"
+  "o.Stamp\022T\n\013latest_msgs\030\004 \003(\0132\?.dsnet.tra"
+  "nsaction.eris.proto.EpochChangeStateTran"
+  "sfer.MsgEntry\032C\n\010MsgEntry\022\021\n\tshard_num\030\001"
+  " \002(\r\022\023\n\013replica_num\030\002 \002(\r\022\017\n\007msg_num\030\003 \002"
+  "(\004\"\320\001\n\nStartEpoch\0227\n\010new_view\030\001 \002(\0132%.ds"
+  "net.transaction.eris.proto.ViewNum\022\035\n\025la"
+  "st_normal_epoch_num\030\002 \002(\004\0227\n\nperm_drops\030"
+  "\003 \003(\0132#.dsnet.transaction.eris.proto.Sta"
+  "mp\022\032\n\022latest_replica_num\030\004 \002(\r\022\025\n\rlatest"
+  "_op_num\030\005 \002(\004\"\260\003\n\017FCToErisMessage\022;\n\ttxn"
+  "_check\030\001 \001(\0132&.dsnet.transaction.eris.pr"
+  "oto.TxnCheckH\000\022;\n\ttxn_found\030\002 \001(\0132&.dsne"
+  "t.transaction.eris.proto.TxnFoundH\000\0229\n\010d"
+  "rop_txn\030\003 \001(\0132%.dsnet.transaction.eris.p"
+  "roto.DropTxnH\000\022A\n\014epoch_change\030\004 \001(\0132).d"
+  "snet.transaction.eris.proto.EpochChangeH"
+  "\000\022]\n\033epoch_change_state_transfer\030\005 \001(\01326"
+  ".dsnet.transaction.eris.proto.EpochChang"
+  "eStateTransferH\000\022\?\n\013start_epoch\030\006 \001(\0132(."
+  "dsnet.transaction.eris.proto.StartEpochH"
+  "\000B\005\n\003msg*O\n\013RequestType\022\013\n\007UNKNOWN\020\000\022\017\n\013"
+  "INDEPENDENT\020\001\022\013\n\007PREPARE\020\002\022\n\n\006COMMIT\020\003\022\t"
+  "\n\005ABORT\020\004"
+  ;
+static const ::_pbi::DescriptorTable* const descriptor_table_transaction_2feris_2feris_2dproto_2eproto_deps[1] = {
+  &::descriptor_table_common_2frequest_2eproto,
+};
+static ::_pbi::once_flag descriptor_table_transaction_2feris_2feris_2dproto_2eproto_once;
+const ::_pbi::DescriptorTable descriptor_table_transaction_2feris_2feris_2dproto_2eproto = {
+    false, false, 5769, descriptor_table_protodef_transaction_2feris_2feris_2dproto_2eproto,
+    "transaction/eris/eris-proto.proto",
+    &descriptor_table_transaction_2feris_2feris_2dproto_2eproto_once, descriptor_table_transaction_2feris_2feris_2dproto_2eproto_deps, 1, 34,
+    schemas, file_default_instances, TableStruct_transaction_2feris_2feris_2dproto_2eproto::offsets,
+    file_level_metadata_transaction_2feris_2feris_2dproto_2eproto, file_level_enum_descriptors_transaction_2feris_2feris_2dproto_2eproto,
+    file_level_service_descriptors_transaction_2feris_2feris_2dproto_2eproto,
+};
+PROTOBUF_ATTRIBUTE_WEAK const ::_pbi::DescriptorTable* descriptor_table_transaction_2feris_2feris_2dproto_2eproto_getter() {
+  return &descriptor_table_transaction_2feris_2feris_2dproto_2eproto;
+}
+
+// Force running AddDescriptors() at dynamic initialization time.
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 static ::_pbi::AddDescriptorsRunner dynamic_init_dummy_transaction_2feris_2feris_2dproto_2eproto(&descriptor_table_transaction_2feris_2feris_2dproto_2eproto);
+namespace dsnet {
+namespace transaction {
+namespace eris {
+namespace proto {
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* RequestType_descriptor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_transaction_2feris_2feris_2dproto_2eproto);
+  return file_level_enum_descriptors_transaction_2feris_2feris_2dproto_2eproto[0];
+}
+bool RequestType_IsValid(int value) {
+  switch (value) {
+    case 0:
+    case 1:
+    case 2:
+    case 3:
+    case 4:
+      return true;
+    default:
+      return false;
+  }
+}
+
+
+// ===================================================================
+
+class ViewNum::_Internal {
+ public:
+  using HasBits = decltype(std::declval<ViewNum>()._impl_._has_bits_);
+  static void set_has_view_num(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_sess_num(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000003) ^ 0x00000003) != 0;
+  }
+};
+
+ViewNum::ViewNum(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:dsnet.transaction.eris.proto.ViewNum)
+}
+ViewNum::ViewNum(const ViewNum& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  ViewNum* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.view_num_){}
+    , decltype(_impl_.sess_num_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.view_num_, &from._impl_.view_num_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.sess_num_) -
+    reinterpret_cast<char*>(&_impl_.view_num_)) + sizeof(_impl_.sess_num_));
+  // @@protoc_insertion_point(copy_constructor:dsnet.transaction.eris.proto.ViewNum)
+}
+
+inline void ViewNum::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.view_num_){0u}
+    , decltype(_impl_.sess_num_){0u}
+  };
+}
+
+ViewNum::~ViewNum() {
+  // @@protoc_insertion_point(destructor:dsnet.transaction.eris.proto.ViewNum)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void ViewNum::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void ViewNum::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void ViewNum::Clear() {
+// @@protoc_insertion_point(message_clear_start:dsnet.transaction.eris.proto.ViewNum)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    ::memset(&_impl_.view_num_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.sess_num_) -
+        reinterpret_cast<char*>(&_impl_.view_num_)) + sizeof(_impl_.sess_num_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* ViewNum::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required uint32 view_num = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_view_num(&has_bits);
+          _impl_.view_num_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required uint32 sess_num = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _Internal::set_has_sess_num(&has_bits);
+          _impl_.sess_num_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* ViewNum::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:dsnet.transaction.eris.proto.ViewNum)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required uint32 view_num = 1;
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(1, this->_internal_view_num(), target);
+  }
+
+  // required uint32 sess_num = 2;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(2, this->_internal_sess_num(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:dsnet.transaction.eris.proto.ViewNum)
+  return target;
+}
+
+size_t ViewNum::RequiredFieldsByteSizeFallback() const {
+// @@protoc_insertion_point(required_fields_byte_size_fallback_start:dsnet.transaction.eris.proto.ViewNum)
+  size_t total_size = 0;
+
+  if (_internal_has_view_num()) {
+    // required uint32 view_num = 1;
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_view_num());
+  }
+
+  if (_internal_has_sess_num()) {
+    // required uint32 sess_num = 2;
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_sess_num());
+  }
+
+  return total_size;
+}
+size_t ViewNum::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:dsnet.transaction.eris.proto.ViewNum)
+  size_t total_size = 0;
+
+  if (((_impl_._has_bits_[0] & 0x00000003) ^ 0x00000003) == 0) {  // All required fields are present.
+    // required uint32 view_num = 1;
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_view_num());
+
+    // required uint32 sess_num = 2;
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_sess_num());
+
+  } else {
+    total_size += RequiredFieldsByteSizeFallback();
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ViewNum::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    ViewNum::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ViewNum::GetClassData() const { return &_class_data_; }
+
+
+void ViewNum::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<ViewNum*>(&to_msg);
+  auto& from = static_cast<const ViewNum&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:dsnet.transaction.eris.proto.ViewNum)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_impl_.view_num_ = from._impl_.view_num_;
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.sess_num_ = from._impl_.sess_num_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void ViewNum::CopyFrom(const ViewNum& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:dsnet.transaction.eris.proto.ViewNum)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool ViewNum::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  return true;
+}
+
+void ViewNum::InternalSwap(ViewNum* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(ViewNum, _impl_.sess_num_)
+      + sizeof(ViewNum::_impl_.sess_num_)
+      - PROTOBUF_FIELD_OFFSET(ViewNum, _impl_.view_num_)>(
+          reinterpret_cast<char*>(&_impl_.view_num_),
+          reinterpret_cast<char*>(&other->_impl_.view_num_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata ViewNum::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_transaction_2feris_2feris_2dproto_2eproto_getter, &descriptor_table_transaction_2feris_2feris_2dproto_2eproto_once,
+      file_level_metadata_transaction_2feris_2feris_2dproto_2eproto[0]);
+}
+
+// ===================================================================
+
+class Stamp::_Internal {
+ public:
+  using HasBits = decltype(std::declval<Stamp>()._impl_._has_bits_);
+  static void set_has_shard_num(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_msg_num(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_sess_num(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000003) ^ 0x00000003) != 0;
+  }
+};
+
+Stamp::Stamp(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:dsnet.transaction.eris.proto.Stamp)
+}
+Stamp::Stamp(const Stamp& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  Stamp* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.msg_num_){}
+    , decltype(_impl_.shard_num_){}
+    , decltype(_impl_.sess_num_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.msg_num_, &from._impl_.msg_num_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.sess_num_) -
+    reinterpret_cast<char*>(&_impl_.msg_num_)) + sizeof(_impl_.sess_num_));
+  // @@protoc_insertion_point(copy_constructor:dsnet.transaction.eris.proto.Stamp)
+}
+
+inline void Stamp::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.msg_num_){uint64_t{0u}}
+    , decltype(_impl_.shard_num_){0u}
+    , decltype(_impl_.sess_num_){0u}
+  };
+}
+
+Stamp::~Stamp() {
+  // @@protoc_insertion_point(destructor:dsnet.transaction.eris.proto.Stamp)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void Stamp::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void Stamp::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void Stamp::Clear() {
+// @@protoc_insertion_point(message_clear_start:dsnet.transaction.eris.proto.Stamp)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    ::memset(&_impl_.msg_num_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.sess_num_) -
+        reinterpret_cast<char*>(&_impl_.msg_num_)) + sizeof(_impl_.sess_num_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* Stamp::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required uint32 shard_num = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_shard_num(&has_bits);
+          _impl_.shard_num_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required uint64 msg_num = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _Internal::set_has_msg_num(&has_bits);
+          _impl_.msg_num_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint32 sess_num = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _Internal::set_has_sess_num(&has_bits);
+          _impl_.sess_num_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* Stamp::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:dsnet.transaction.eris.proto.Stamp)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required uint32 shard_num = 1;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(1, this->_internal_shard_num(), target);
+  }
+
+  // required uint64 msg_num = 2;
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(2, this->_internal_msg_num(), target);
+  }
+
+  // optional uint32 sess_num = 3;
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(3, this->_internal_sess_num(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:dsnet.transaction.eris.proto.Stamp)
+  return target;
+}
+
+size_t Stamp::RequiredFieldsByteSizeFallback() const {
+// @@protoc_insertion_point(required_fields_byte_size_fallback_start:dsnet.transaction.eris.proto.Stamp)
+  size_t total_size = 0;
+
+  if (_internal_has_msg_num()) {
+    // required uint64 msg_num = 2;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_msg_num());
+  }
+
+  if (_internal_has_shard_num()) {
+    // required uint32 shard_num = 1;
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_shard_num());
+  }
+
+  return total_size;
+}
+size_t Stamp::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:dsnet.transaction.eris.proto.Stamp)
+  size_t total_size = 0;
+
+  if (((_impl_._has_bits_[0] & 0x00000003) ^ 0x00000003) == 0) {  // All required fields are present.
+    // required uint64 msg_num = 2;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_msg_num());
+
+    // required uint32 shard_num = 1;
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_shard_num());
+
+  } else {
+    total_size += RequiredFieldsByteSizeFallback();
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // optional uint32 sess_num = 3;
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000004u) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_sess_num());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData Stamp::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    Stamp::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*Stamp::GetClassData() const { return &_class_data_; }
+
+
+void Stamp::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<Stamp*>(&to_msg);
+  auto& from = static_cast<const Stamp&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:dsnet.transaction.eris.proto.Stamp)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_impl_.msg_num_ = from._impl_.msg_num_;
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.shard_num_ = from._impl_.shard_num_;
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.sess_num_ = from._impl_.sess_num_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void Stamp::CopyFrom(const Stamp& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:dsnet.transaction.eris.proto.Stamp)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool Stamp::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  return true;
+}
+
+void Stamp::InternalSwap(Stamp* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(Stamp, _impl_.sess_num_)
+      + sizeof(Stamp::_impl_.sess_num_)
+      - PROTOBUF_FIELD_OFFSET(Stamp, _impl_.msg_num_)>(
+          reinterpret_cast<char*>(&_impl_.msg_num_),
+          reinterpret_cast<char*>(&other->_impl_.msg_num_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata Stamp::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_transaction_2feris_2feris_2dproto_2eproto_getter, &descriptor_table_transaction_2feris_2feris_2dproto_2eproto_once,
+      file_level_metadata_transaction_2feris_2feris_2dproto_2eproto[1]);
+}
+
+// ===================================================================
+
+class ReplyMessage::_Internal {
+ public:
+  using HasBits = decltype(std::declval<ReplyMessage>()._impl_._has_bits_);
+  static void set_has_clientid(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static void set_has_clientreqid(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+  static void set_has_shard_num(HasBits* has_bits) {
+    (*has_bits)[0] |= 16u;
+  }
+  static void set_has_replica_num(HasBits* has_bits) {
+    (*has_bits)[0] |= 32u;
+  }
+  static const ::dsnet::transaction::eris::proto::ViewNum& view(const ReplyMessage* msg);
+  static void set_has_view(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_op_num(HasBits* has_bits) {
+    (*has_bits)[0] |= 64u;
+  }
+  static void set_has_commit(HasBits* has_bits) {
+    (*has_bits)[0] |= 128u;
+  }
+  static void set_has_reply(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x0000007e) ^ 0x0000007e) != 0;
+  }
+};
+
+const ::dsnet::transaction::eris::proto::ViewNum&
+ReplyMessage::_Internal::view(const ReplyMessage* msg) {
+  return *msg->_impl_.view_;
+}
+ReplyMessage::ReplyMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:dsnet.transaction.eris.proto.ReplyMessage)
+}
+ReplyMessage::ReplyMessage(const ReplyMessage& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  ReplyMessage* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.reply_){}
+    , decltype(_impl_.view_){nullptr}
+    , decltype(_impl_.clientid_){}
+    , decltype(_impl_.clientreqid_){}
+    , decltype(_impl_.shard_num_){}
+    , decltype(_impl_.replica_num_){}
+    , decltype(_impl_.op_num_){}
+    , decltype(_impl_.commit_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.reply_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.reply_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_reply()) {
+    _this->_impl_.reply_.Set(from._internal_reply(), 
+      _this->GetArenaForAllocation());
+  }
+  if (from._internal_has_view()) {
+    _this->_impl_.view_ = new ::dsnet::transaction::eris::proto::ViewNum(*from._impl_.view_);
+  }
+  ::memcpy(&_impl_.clientid_, &from._impl_.clientid_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.commit_) -
+    reinterpret_cast<char*>(&_impl_.clientid_)) + sizeof(_impl_.commit_));
+  // @@protoc_insertion_point(copy_constructor:dsnet.transaction.eris.proto.ReplyMessage)
+}
+
+inline void ReplyMessage::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.reply_){}
+    , decltype(_impl_.view_){nullptr}
+    , decltype(_impl_.clientid_){uint64_t{0u}}
+    , decltype(_impl_.clientreqid_){uint64_t{0u}}
+    , decltype(_impl_.shard_num_){0u}
+    , decltype(_impl_.replica_num_){0u}
+    , decltype(_impl_.op_num_){uint64_t{0u}}
+    , decltype(_impl_.commit_){0u}
+  };
+  _impl_.reply_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.reply_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+ReplyMessage::~ReplyMessage() {
+  // @@protoc_insertion_point(destructor:dsnet.transaction.eris.proto.ReplyMessage)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void ReplyMessage::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.reply_.Destroy();
+  if (this != internal_default_instance()) delete _impl_.view_;
+}
+
+void ReplyMessage::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void ReplyMessage::Clear() {
+// @@protoc_insertion_point(message_clear_start:dsnet.transaction.eris.proto.ReplyMessage)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      _impl_.reply_.ClearNonDefaultToEmpty();
+    }
+    if (cached_has_bits & 0x00000002u) {
+      GOOGLE_DCHECK(_impl_.view_ != nullptr);
+      _impl_.view_->Clear();
+    }
+  }
+  if (cached_has_bits & 0x000000fcu) {
+    ::memset(&_impl_.clientid_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.commit_) -
+        reinterpret_cast<char*>(&_impl_.clientid_)) + sizeof(_impl_.commit_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* ReplyMessage::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required uint64 clientid = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_clientid(&has_bits);
+          _impl_.clientid_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required uint64 clientreqid = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _Internal::set_has_clientreqid(&has_bits);
+          _impl_.clientreqid_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required uint32 shard_num = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _Internal::set_has_shard_num(&has_bits);
+          _impl_.shard_num_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required uint32 replica_num = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _Internal::set_has_replica_num(&has_bits);
+          _impl_.replica_num_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required .dsnet.transaction.eris.proto.ViewNum view = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 42)) {
+          ptr = ctx->ParseMessage(_internal_mutable_view(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required uint64 op_num = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 48)) {
+          _Internal::set_has_op_num(&has_bits);
+          _impl_.op_num_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint32 commit = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 56)) {
+          _Internal::set_has_commit(&has_bits);
+          _impl_.commit_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional bytes reply = 8;
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 66)) {
+          auto str = _internal_mutable_reply();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* ReplyMessage::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:dsnet.transaction.eris.proto.ReplyMessage)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required uint64 clientid = 1;
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(1, this->_internal_clientid(), target);
+  }
+
+  // required uint64 clientreqid = 2;
+  if (cached_has_bits & 0x00000008u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(2, this->_internal_clientreqid(), target);
+  }
+
+  // required uint32 shard_num = 3;
+  if (cached_has_bits & 0x00000010u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(3, this->_internal_shard_num(), target);
+  }
+
+  // required uint32 replica_num = 4;
+  if (cached_has_bits & 0x00000020u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(4, this->_internal_replica_num(), target);
+  }
+
+  // required .dsnet.transaction.eris.proto.ViewNum view = 5;
+  if (cached_has_bits & 0x00000002u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(5, _Internal::view(this),
+        _Internal::view(this).GetCachedSize(), target, stream);
+  }
+
+  // required uint64 op_num = 6;
+  if (cached_has_bits & 0x00000040u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(6, this->_internal_op_num(), target);
+  }
+
+  // optional uint32 commit = 7;
+  if (cached_has_bits & 0x00000080u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(7, this->_internal_commit(), target);
+  }
+
+  // optional bytes reply = 8;
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->WriteBytesMaybeAliased(
+        8, this->_internal_reply(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:dsnet.transaction.eris.proto.ReplyMessage)
+  return target;
+}
+
+size_t ReplyMessage::RequiredFieldsByteSizeFallback() const {
+// @@protoc_insertion_point(required_fields_byte_size_fallback_start:dsnet.transaction.eris.proto.ReplyMessage)
+  size_t total_size = 0;
+
+  if (_internal_has_view()) {
+    // required .dsnet.transaction.eris.proto.ViewNum view = 5;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.view_);
+  }
+
+  if (_internal_has_clientid()) {
+    // required uint64 clientid = 1;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_clientid());
+  }
+
+  if (_internal_has_clientreqid()) {
+    // required uint64 clientreqid = 2;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_clientreqid());
+  }
+
+  if (_internal_has_shard_num()) {
+    // required uint32 shard_num = 3;
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_shard_num());
+  }
+
+  if (_internal_has_replica_num()) {
+    // required uint32 replica_num = 4;
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_replica_num());
+  }
+
+  if (_internal_has_op_num()) {
+    // required uint64 op_num = 6;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_op_num());
+  }
+
+  return total_size;
+}
+size_t ReplyMessage::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:dsnet.transaction.eris.proto.ReplyMessage)
+  size_t total_size = 0;
+
+  if (((_impl_._has_bits_[0] & 0x0000007e) ^ 0x0000007e) == 0) {  // All required fields are present.
+    // required .dsnet.transaction.eris.proto.ViewNum view = 5;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.view_);
+
+    // required uint64 clientid = 1;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_clientid());
+
+    // required uint64 clientreqid = 2;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_clientreqid());
+
+    // required uint32 shard_num = 3;
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_shard_num());
+
+    // required uint32 replica_num = 4;
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_replica_num());
+
+    // required uint64 op_num = 6;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_op_num());
+
+  } else {
+    total_size += RequiredFieldsByteSizeFallback();
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // optional bytes reply = 8;
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_reply());
+  }
+
+  // optional uint32 commit = 7;
+  if (cached_has_bits & 0x00000080u) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_commit());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ReplyMessage::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    ReplyMessage::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ReplyMessage::GetClassData() const { return &_class_data_; }
+
+
+void ReplyMessage::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<ReplyMessage*>(&to_msg);
+  auto& from = static_cast<const ReplyMessage&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:dsnet.transaction.eris.proto.ReplyMessage)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x000000ffu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_reply(from._internal_reply());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_internal_mutable_view()->::dsnet::transaction::eris::proto::ViewNum::MergeFrom(
+          from._internal_view());
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.clientid_ = from._impl_.clientid_;
+    }
+    if (cached_has_bits & 0x00000008u) {
+      _this->_impl_.clientreqid_ = from._impl_.clientreqid_;
+    }
+    if (cached_has_bits & 0x00000010u) {
+      _this->_impl_.shard_num_ = from._impl_.shard_num_;
+    }
+    if (cached_has_bits & 0x00000020u) {
+      _this->_impl_.replica_num_ = from._impl_.replica_num_;
+    }
+    if (cached_has_bits & 0x00000040u) {
+      _this->_impl_.op_num_ = from._impl_.op_num_;
+    }
+    if (cached_has_bits & 0x00000080u) {
+      _this->_impl_.commit_ = from._impl_.commit_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void ReplyMessage::CopyFrom(const ReplyMessage& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:dsnet.transaction.eris.proto.ReplyMessage)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool ReplyMessage::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  if (_internal_has_view()) {
+    if (!_impl_.view_->IsInitialized()) return false;
+  }
+  return true;
+}
+
+void ReplyMessage::InternalSwap(ReplyMessage* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.reply_, lhs_arena,
+      &other->_impl_.reply_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(ReplyMessage, _impl_.commit_)
+      + sizeof(ReplyMessage::_impl_.commit_)
+      - PROTOBUF_FIELD_OFFSET(ReplyMessage, _impl_.view_)>(
+          reinterpret_cast<char*>(&_impl_.view_),
+          reinterpret_cast<char*>(&other->_impl_.view_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata ReplyMessage::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_transaction_2feris_2feris_2dproto_2eproto_getter, &descriptor_table_transaction_2feris_2feris_2dproto_2eproto_once,
+      file_level_metadata_transaction_2feris_2feris_2dproto_2eproto[2]);
+}
+
+// ===================================================================
+
+class RequestMessage::_Internal {
+ public:
+  using HasBits = decltype(std::declval<RequestMessage>()._impl_._has_bits_);
+  static void set_has_txnid(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_type(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static const ::dsnet::Request& request(const RequestMessage* msg);
+  static void set_has_request(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000007) ^ 0x00000007) != 0;
+  }
+};
+
+const ::dsnet::Request&
+RequestMessage::_Internal::request(const RequestMessage* msg) {
+  return *msg->_impl_.request_;
+}
+void RequestMessage::clear_request() {
+  if (_impl_.request_ != nullptr) _impl_.request_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+RequestMessage::RequestMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:dsnet.transaction.eris.proto.RequestMessage)
+}
+RequestMessage::RequestMessage(const RequestMessage& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  RequestMessage* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.request_){nullptr}
+    , decltype(_impl_.txnid_){}
+    , decltype(_impl_.type_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  if (from._internal_has_request()) {
+    _this->_impl_.request_ = new ::dsnet::Request(*from._impl_.request_);
+  }
+  ::memcpy(&_impl_.txnid_, &from._impl_.txnid_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.type_) -
+    reinterpret_cast<char*>(&_impl_.txnid_)) + sizeof(_impl_.type_));
+  // @@protoc_insertion_point(copy_constructor:dsnet.transaction.eris.proto.RequestMessage)
+}
+
+inline void RequestMessage::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.request_){nullptr}
+    , decltype(_impl_.txnid_){uint64_t{0u}}
+    , decltype(_impl_.type_){0}
+  };
+}
+
+RequestMessage::~RequestMessage() {
+  // @@protoc_insertion_point(destructor:dsnet.transaction.eris.proto.RequestMessage)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void RequestMessage::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  if (this != internal_default_instance()) delete _impl_.request_;
+}
+
+void RequestMessage::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void RequestMessage::Clear() {
+// @@protoc_insertion_point(message_clear_start:dsnet.transaction.eris.proto.RequestMessage)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    GOOGLE_DCHECK(_impl_.request_ != nullptr);
+    _impl_.request_->Clear();
+  }
+  if (cached_has_bits & 0x00000006u) {
+    ::memset(&_impl_.txnid_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.type_) -
+        reinterpret_cast<char*>(&_impl_.txnid_)) + sizeof(_impl_.type_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* RequestMessage::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required uint64 txnid = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_txnid(&has_bits);
+          _impl_.txnid_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required .dsnet.transaction.eris.proto.RequestType type = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          if (PROTOBUF_PREDICT_TRUE(::dsnet::transaction::eris::proto::RequestType_IsValid(val))) {
+            _internal_set_type(static_cast<::dsnet::transaction::eris::proto::RequestType>(val));
+          } else {
+            ::PROTOBUF_NAMESPACE_ID::internal::WriteVarint(2, val, mutable_unknown_fields());
+          }
+        } else
+          goto handle_unusual;
+        continue;
+      // required .dsnet.Request request = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          ptr = ctx->ParseMessage(_internal_mutable_request(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* RequestMessage::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:dsnet.transaction.eris.proto.RequestMessage)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required uint64 txnid = 1;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(1, this->_internal_txnid(), target);
+  }
+
+  // required .dsnet.transaction.eris.proto.RequestType type = 2;
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      2, this->_internal_type(), target);
+  }
+
+  // required .dsnet.Request request = 3;
+  if (cached_has_bits & 0x00000001u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(3, _Internal::request(this),
+        _Internal::request(this).GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:dsnet.transaction.eris.proto.RequestMessage)
+  return target;
+}
+
+size_t RequestMessage::RequiredFieldsByteSizeFallback() const {
+// @@protoc_insertion_point(required_fields_byte_size_fallback_start:dsnet.transaction.eris.proto.RequestMessage)
+  size_t total_size = 0;
+
+  if (_internal_has_request()) {
+    // required .dsnet.Request request = 3;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.request_);
+  }
+
+  if (_internal_has_txnid()) {
+    // required uint64 txnid = 1;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_txnid());
+  }
+
+  if (_internal_has_type()) {
+    // required .dsnet.transaction.eris.proto.RequestType type = 2;
+    total_size += 1 +
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_type());
+  }
+
+  return total_size;
+}
+size_t RequestMessage::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:dsnet.transaction.eris.proto.RequestMessage)
+  size_t total_size = 0;
+
+  if (((_impl_._has_bits_[0] & 0x00000007) ^ 0x00000007) == 0) {  // All required fields are present.
+    // required .dsnet.Request request = 3;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.request_);
+
+    // required uint64 txnid = 1;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_txnid());
+
+    // required .dsnet.transaction.eris.proto.RequestType type = 2;
+    total_size += 1 +
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_type());
+
+  } else {
+    total_size += RequiredFieldsByteSizeFallback();
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData RequestMessage::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    RequestMessage::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*RequestMessage::GetClassData() const { return &_class_data_; }
+
+
+void RequestMessage::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<RequestMessage*>(&to_msg);
+  auto& from = static_cast<const RequestMessage&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:dsnet.transaction.eris.proto.RequestMessage)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_mutable_request()->::dsnet::Request::MergeFrom(
+          from._internal_request());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.txnid_ = from._impl_.txnid_;
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.type_ = from._impl_.type_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void RequestMessage::CopyFrom(const RequestMessage& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:dsnet.transaction.eris.proto.RequestMessage)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool RequestMessage::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  if (_internal_has_request()) {
+    if (!_impl_.request_->IsInitialized()) return false;
+  }
+  return true;
+}
+
+void RequestMessage::InternalSwap(RequestMessage* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(RequestMessage, _impl_.type_)
+      + sizeof(RequestMessage::_impl_.type_)
+      - PROTOBUF_FIELD_OFFSET(RequestMessage, _impl_.request_)>(
+          reinterpret_cast<char*>(&_impl_.request_),
+          reinterpret_cast<char*>(&other->_impl_.request_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata RequestMessage::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_transaction_2feris_2feris_2dproto_2eproto_getter, &descriptor_table_transaction_2feris_2feris_2dproto_2eproto_once,
+      file_level_metadata_transaction_2feris_2feris_2dproto_2eproto[3]);
+}
+
+// ===================================================================
+
+class GapRequestMessage::_Internal {
+ public:
+  using HasBits = decltype(std::declval<GapRequestMessage>()._impl_._has_bits_);
+  static const ::dsnet::transaction::eris::proto::ViewNum& view(const GapRequestMessage* msg);
+  static void set_has_view(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_op_num(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000003) ^ 0x00000003) != 0;
+  }
+};
+
+const ::dsnet::transaction::eris::proto::ViewNum&
+GapRequestMessage::_Internal::view(const GapRequestMessage* msg) {
+  return *msg->_impl_.view_;
+}
+GapRequestMessage::GapRequestMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:dsnet.transaction.eris.proto.GapRequestMessage)
+}
+GapRequestMessage::GapRequestMessage(const GapRequestMessage& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  GapRequestMessage* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.view_){nullptr}
+    , decltype(_impl_.op_num_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  if (from._internal_has_view()) {
+    _this->_impl_.view_ = new ::dsnet::transaction::eris::proto::ViewNum(*from._impl_.view_);
+  }
+  _this->_impl_.op_num_ = from._impl_.op_num_;
+  // @@protoc_insertion_point(copy_constructor:dsnet.transaction.eris.proto.GapRequestMessage)
+}
+
+inline void GapRequestMessage::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.view_){nullptr}
+    , decltype(_impl_.op_num_){uint64_t{0u}}
+  };
+}
+
+GapRequestMessage::~GapRequestMessage() {
+  // @@protoc_insertion_point(destructor:dsnet.transaction.eris.proto.GapRequestMessage)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void GapRequestMessage::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  if (this != internal_default_instance()) delete _impl_.view_;
+}
+
+void GapRequestMessage::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void GapRequestMessage::Clear() {
+// @@protoc_insertion_point(message_clear_start:dsnet.transaction.eris.proto.GapRequestMessage)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    GOOGLE_DCHECK(_impl_.view_ != nullptr);
+    _impl_.view_->Clear();
+  }
+  _impl_.op_num_ = uint64_t{0u};
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* GapRequestMessage::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required .dsnet.transaction.eris.proto.ViewNum view = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr = ctx->ParseMessage(_internal_mutable_view(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required uint64 op_num = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _Internal::set_has_op_num(&has_bits);
+          _impl_.op_num_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* GapRequestMessage::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:dsnet.transaction.eris.proto.GapRequestMessage)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required .dsnet.transaction.eris.proto.ViewNum view = 1;
+  if (cached_has_bits & 0x00000001u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(1, _Internal::view(this),
+        _Internal::view(this).GetCachedSize(), target, stream);
+  }
+
+  // required uint64 op_num = 2;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(2, this->_internal_op_num(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:dsnet.transaction.eris.proto.GapRequestMessage)
+  return target;
+}
+
+size_t GapRequestMessage::RequiredFieldsByteSizeFallback() const {
+// @@protoc_insertion_point(required_fields_byte_size_fallback_start:dsnet.transaction.eris.proto.GapRequestMessage)
+  size_t total_size = 0;
+
+  if (_internal_has_view()) {
+    // required .dsnet.transaction.eris.proto.ViewNum view = 1;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.view_);
+  }
+
+  if (_internal_has_op_num()) {
+    // required uint64 op_num = 2;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_op_num());
+  }
+
+  return total_size;
+}
+size_t GapRequestMessage::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:dsnet.transaction.eris.proto.GapRequestMessage)
+  size_t total_size = 0;
+
+  if (((_impl_._has_bits_[0] & 0x00000003) ^ 0x00000003) == 0) {  // All required fields are present.
+    // required .dsnet.transaction.eris.proto.ViewNum view = 1;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.view_);
+
+    // required uint64 op_num = 2;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_op_num());
+
+  } else {
+    total_size += RequiredFieldsByteSizeFallback();
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData GapRequestMessage::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    GapRequestMessage::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GapRequestMessage::GetClassData() const { return &_class_data_; }
+
+
+void GapRequestMessage::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<GapRequestMessage*>(&to_msg);
+  auto& from = static_cast<const GapRequestMessage&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:dsnet.transaction.eris.proto.GapRequestMessage)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_mutable_view()->::dsnet::transaction::eris::proto::ViewNum::MergeFrom(
+          from._internal_view());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.op_num_ = from._impl_.op_num_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void GapRequestMessage::CopyFrom(const GapRequestMessage& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:dsnet.transaction.eris.proto.GapRequestMessage)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool GapRequestMessage::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  if (_internal_has_view()) {
+    if (!_impl_.view_->IsInitialized()) return false;
+  }
+  return true;
+}
+
+void GapRequestMessage::InternalSwap(GapRequestMessage* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(GapRequestMessage, _impl_.op_num_)
+      + sizeof(GapRequestMessage::_impl_.op_num_)
+      - PROTOBUF_FIELD_OFFSET(GapRequestMessage, _impl_.view_)>(
+          reinterpret_cast<char*>(&_impl_.view_),
+          reinterpret_cast<char*>(&other->_impl_.view_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata GapRequestMessage::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_transaction_2feris_2feris_2dproto_2eproto_getter, &descriptor_table_transaction_2feris_2feris_2dproto_2eproto_once,
+      file_level_metadata_transaction_2feris_2feris_2dproto_2eproto[4]);
+}
+
+// ===================================================================
+
+class GapReplyMessage::_Internal {
+ public:
+  using HasBits = decltype(std::declval<GapReplyMessage>()._impl_._has_bits_);
+  static const ::dsnet::transaction::eris::proto::ViewNum& view(const GapReplyMessage* msg);
+  static void set_has_view(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_op_num(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static void set_has_isfound(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+  static void set_has_isgap(HasBits* has_bits) {
+    (*has_bits)[0] |= 16u;
+  }
+  static void set_has_replica_num(HasBits* has_bits) {
+    (*has_bits)[0] |= 32u;
+  }
+  static const ::dsnet::transaction::eris::proto::RequestMessage& req(const GapReplyMessage* msg);
+  static void set_has_req(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x0000003d) ^ 0x0000003d) != 0;
+  }
+};
+
+const ::dsnet::transaction::eris::proto::ViewNum&
+GapReplyMessage::_Internal::view(const GapReplyMessage* msg) {
+  return *msg->_impl_.view_;
+}
+const ::dsnet::transaction::eris::proto::RequestMessage&
+GapReplyMessage::_Internal::req(const GapReplyMessage* msg) {
+  return *msg->_impl_.req_;
+}
+GapReplyMessage::GapReplyMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:dsnet.transaction.eris.proto.GapReplyMessage)
+}
+GapReplyMessage::GapReplyMessage(const GapReplyMessage& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  GapReplyMessage* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.view_){nullptr}
+    , decltype(_impl_.req_){nullptr}
+    , decltype(_impl_.op_num_){}
+    , decltype(_impl_.isfound_){}
+    , decltype(_impl_.isgap_){}
+    , decltype(_impl_.replica_num_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  if (from._internal_has_view()) {
+    _this->_impl_.view_ = new ::dsnet::transaction::eris::proto::ViewNum(*from._impl_.view_);
+  }
+  if (from._internal_has_req()) {
+    _this->_impl_.req_ = new ::dsnet::transaction::eris::proto::RequestMessage(*from._impl_.req_);
+  }
+  ::memcpy(&_impl_.op_num_, &from._impl_.op_num_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.replica_num_) -
+    reinterpret_cast<char*>(&_impl_.op_num_)) + sizeof(_impl_.replica_num_));
+  // @@protoc_insertion_point(copy_constructor:dsnet.transaction.eris.proto.GapReplyMessage)
+}
+
+inline void GapReplyMessage::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.view_){nullptr}
+    , decltype(_impl_.req_){nullptr}
+    , decltype(_impl_.op_num_){uint64_t{0u}}
+    , decltype(_impl_.isfound_){false}
+    , decltype(_impl_.isgap_){false}
+    , decltype(_impl_.replica_num_){0u}
+  };
+}
+
+GapReplyMessage::~GapReplyMessage() {
+  // @@protoc_insertion_point(destructor:dsnet.transaction.eris.proto.GapReplyMessage)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void GapReplyMessage::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  if (this != internal_default_instance()) delete _impl_.view_;
+  if (this != internal_default_instance()) delete _impl_.req_;
+}
+
+void GapReplyMessage::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void GapReplyMessage::Clear() {
+// @@protoc_insertion_point(message_clear_start:dsnet.transaction.eris.proto.GapReplyMessage)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      GOOGLE_DCHECK(_impl_.view_ != nullptr);
+      _impl_.view_->Clear();
+    }
+    if (cached_has_bits & 0x00000002u) {
+      GOOGLE_DCHECK(_impl_.req_ != nullptr);
+      _impl_.req_->Clear();
+    }
+  }
+  if (cached_has_bits & 0x0000003cu) {
+    ::memset(&_impl_.op_num_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.replica_num_) -
+        reinterpret_cast<char*>(&_impl_.op_num_)) + sizeof(_impl_.replica_num_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* GapReplyMessage::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required .dsnet.transaction.eris.proto.ViewNum view = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr = ctx->ParseMessage(_internal_mutable_view(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required uint64 op_num = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _Internal::set_has_op_num(&has_bits);
+          _impl_.op_num_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required bool isfound = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _Internal::set_has_isfound(&has_bits);
+          _impl_.isfound_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required bool isgap = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          _Internal::set_has_isgap(&has_bits);
+          _impl_.isgap_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required uint32 replica_num = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 48)) {
+          _Internal::set_has_replica_num(&has_bits);
+          _impl_.replica_num_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .dsnet.transaction.eris.proto.RequestMessage req = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 58)) {
+          ptr = ctx->ParseMessage(_internal_mutable_req(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* GapReplyMessage::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:dsnet.transaction.eris.proto.GapReplyMessage)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required .dsnet.transaction.eris.proto.ViewNum view = 1;
+  if (cached_has_bits & 0x00000001u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(1, _Internal::view(this),
+        _Internal::view(this).GetCachedSize(), target, stream);
+  }
+
+  // required uint64 op_num = 2;
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(2, this->_internal_op_num(), target);
+  }
+
+  // required bool isfound = 4;
+  if (cached_has_bits & 0x00000008u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(4, this->_internal_isfound(), target);
+  }
+
+  // required bool isgap = 5;
+  if (cached_has_bits & 0x00000010u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(5, this->_internal_isgap(), target);
+  }
+
+  // required uint32 replica_num = 6;
+  if (cached_has_bits & 0x00000020u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(6, this->_internal_replica_num(), target);
+  }
+
+  // optional .dsnet.transaction.eris.proto.RequestMessage req = 7;
+  if (cached_has_bits & 0x00000002u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(7, _Internal::req(this),
+        _Internal::req(this).GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:dsnet.transaction.eris.proto.GapReplyMessage)
+  return target;
+}
+
+size_t GapReplyMessage::RequiredFieldsByteSizeFallback() const {
+// @@protoc_insertion_point(required_fields_byte_size_fallback_start:dsnet.transaction.eris.proto.GapReplyMessage)
+  size_t total_size = 0;
+
+  if (_internal_has_view()) {
+    // required .dsnet.transaction.eris.proto.ViewNum view = 1;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.view_);
+  }
+
+  if (_internal_has_op_num()) {
+    // required uint64 op_num = 2;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_op_num());
+  }
+
+  if (_internal_has_isfound()) {
+    // required bool isfound = 4;
+    total_size += 1 + 1;
+  }
+
+  if (_internal_has_isgap()) {
+    // required bool isgap = 5;
+    total_size += 1 + 1;
+  }
+
+  if (_internal_has_replica_num()) {
+    // required uint32 replica_num = 6;
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_replica_num());
+  }
+
+  return total_size;
+}
+size_t GapReplyMessage::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:dsnet.transaction.eris.proto.GapReplyMessage)
+  size_t total_size = 0;
+
+  if (((_impl_._has_bits_[0] & 0x0000003d) ^ 0x0000003d) == 0) {  // All required fields are present.
+    // required .dsnet.transaction.eris.proto.ViewNum view = 1;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.view_);
+
+    // required uint64 op_num = 2;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_op_num());
+
+    // required bool isfound = 4;
+    total_size += 1 + 1;
+
+    // required bool isgap = 5;
+    total_size += 1 + 1;
+
+    // required uint32 replica_num = 6;
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_replica_num());
+
+  } else {
+    total_size += RequiredFieldsByteSizeFallback();
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // optional .dsnet.transaction.eris.proto.RequestMessage req = 7;
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000002u) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.req_);
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData GapReplyMessage::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    GapReplyMessage::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GapReplyMessage::GetClassData() const { return &_class_data_; }
+
+
+void GapReplyMessage::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<GapReplyMessage*>(&to_msg);
+  auto& from = static_cast<const GapReplyMessage&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:dsnet.transaction.eris.proto.GapReplyMessage)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000003fu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_mutable_view()->::dsnet::transaction::eris::proto::ViewNum::MergeFrom(
+          from._internal_view());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_internal_mutable_req()->::dsnet::transaction::eris::proto::RequestMessage::MergeFrom(
+          from._internal_req());
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.op_num_ = from._impl_.op_num_;
+    }
+    if (cached_has_bits & 0x00000008u) {
+      _this->_impl_.isfound_ = from._impl_.isfound_;
+    }
+    if (cached_has_bits & 0x00000010u) {
+      _this->_impl_.isgap_ = from._impl_.isgap_;
+    }
+    if (cached_has_bits & 0x00000020u) {
+      _this->_impl_.replica_num_ = from._impl_.replica_num_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void GapReplyMessage::CopyFrom(const GapReplyMessage& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:dsnet.transaction.eris.proto.GapReplyMessage)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool GapReplyMessage::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  if (_internal_has_view()) {
+    if (!_impl_.view_->IsInitialized()) return false;
+  }
+  if (_internal_has_req()) {
+    if (!_impl_.req_->IsInitialized()) return false;
+  }
+  return true;
+}
+
+void GapReplyMessage::InternalSwap(GapReplyMessage* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(GapReplyMessage, _impl_.replica_num_)
+      + sizeof(GapReplyMessage::_impl_.replica_num_)
+      - PROTOBUF_FIELD_OFFSET(GapReplyMessage, _impl_.view_)>(
+          reinterpret_cast<char*>(&_impl_.view_),
+          reinterpret_cast<char*>(&other->_impl_.view_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata GapReplyMessage::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_transaction_2feris_2feris_2dproto_2eproto_getter, &descriptor_table_transaction_2feris_2feris_2dproto_2eproto_once,
+      file_level_metadata_transaction_2feris_2feris_2dproto_2eproto[5]);
+}
+
+// ===================================================================
+
+class SyncPrepareMessage::_Internal {
+ public:
+  using HasBits = decltype(std::declval<SyncPrepareMessage>()._impl_._has_bits_);
+  static const ::dsnet::transaction::eris::proto::ViewNum& view(const SyncPrepareMessage* msg);
+  static void set_has_view(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000001) ^ 0x00000001) != 0;
+  }
+};
+
+const ::dsnet::transaction::eris::proto::ViewNum&
+SyncPrepareMessage::_Internal::view(const SyncPrepareMessage* msg) {
+  return *msg->_impl_.view_;
+}
+SyncPrepareMessage::SyncPrepareMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:dsnet.transaction.eris.proto.SyncPrepareMessage)
+}
+SyncPrepareMessage::SyncPrepareMessage(const SyncPrepareMessage& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  SyncPrepareMessage* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.view_){nullptr}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  if (from._internal_has_view()) {
+    _this->_impl_.view_ = new ::dsnet::transaction::eris::proto::ViewNum(*from._impl_.view_);
+  }
+  // @@protoc_insertion_point(copy_constructor:dsnet.transaction.eris.proto.SyncPrepareMessage)
+}
+
+inline void SyncPrepareMessage::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.view_){nullptr}
+  };
+}
+
+SyncPrepareMessage::~SyncPrepareMessage() {
+  // @@protoc_insertion_point(destructor:dsnet.transaction.eris.proto.SyncPrepareMessage)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void SyncPrepareMessage::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  if (this != internal_default_instance()) delete _impl_.view_;
+}
+
+void SyncPrepareMessage::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void SyncPrepareMessage::Clear() {
+// @@protoc_insertion_point(message_clear_start:dsnet.transaction.eris.proto.SyncPrepareMessage)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    GOOGLE_DCHECK(_impl_.view_ != nullptr);
+    _impl_.view_->Clear();
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* SyncPrepareMessage::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required .dsnet.transaction.eris.proto.ViewNum view = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr = ctx->ParseMessage(_internal_mutable_view(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* SyncPrepareMessage::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:dsnet.transaction.eris.proto.SyncPrepareMessage)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required .dsnet.transaction.eris.proto.ViewNum view = 1;
+  if (cached_has_bits & 0x00000001u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(1, _Internal::view(this),
+        _Internal::view(this).GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:dsnet.transaction.eris.proto.SyncPrepareMessage)
+  return target;
+}
+
+size_t SyncPrepareMessage::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:dsnet.transaction.eris.proto.SyncPrepareMessage)
+  size_t total_size = 0;
+
+  // required .dsnet.transaction.eris.proto.ViewNum view = 1;
+  if (_internal_has_view()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.view_);
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData SyncPrepareMessage::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    SyncPrepareMessage::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*SyncPrepareMessage::GetClassData() const { return &_class_data_; }
+
+
+void SyncPrepareMessage::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<SyncPrepareMessage*>(&to_msg);
+  auto& from = static_cast<const SyncPrepareMessage&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:dsnet.transaction.eris.proto.SyncPrepareMessage)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_has_view()) {
+    _this->_internal_mutable_view()->::dsnet::transaction::eris::proto::ViewNum::MergeFrom(
+        from._internal_view());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void SyncPrepareMessage::CopyFrom(const SyncPrepareMessage& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:dsnet.transaction.eris.proto.SyncPrepareMessage)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool SyncPrepareMessage::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  if (_internal_has_view()) {
+    if (!_impl_.view_->IsInitialized()) return false;
+  }
+  return true;
+}
+
+void SyncPrepareMessage::InternalSwap(SyncPrepareMessage* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  swap(_impl_.view_, other->_impl_.view_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata SyncPrepareMessage::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_transaction_2feris_2feris_2dproto_2eproto_getter, &descriptor_table_transaction_2feris_2feris_2dproto_2eproto_once,
+      file_level_metadata_transaction_2feris_2feris_2dproto_2eproto[6]);
+}
+
+// ===================================================================
+
+class ViewChangeRequestMessage::_Internal {
+ public:
+  using HasBits = decltype(std::declval<ViewChangeRequestMessage>()._impl_._has_bits_);
+  static const ::dsnet::transaction::eris::proto::ViewNum& view(const ViewChangeRequestMessage* msg);
+  static void set_has_view(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000001) ^ 0x00000001) != 0;
+  }
+};
+
+const ::dsnet::transaction::eris::proto::ViewNum&
+ViewChangeRequestMessage::_Internal::view(const ViewChangeRequestMessage* msg) {
+  return *msg->_impl_.view_;
+}
+ViewChangeRequestMessage::ViewChangeRequestMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:dsnet.transaction.eris.proto.ViewChangeRequestMessage)
+}
+ViewChangeRequestMessage::ViewChangeRequestMessage(const ViewChangeRequestMessage& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  ViewChangeRequestMessage* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.view_){nullptr}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  if (from._internal_has_view()) {
+    _this->_impl_.view_ = new ::dsnet::transaction::eris::proto::ViewNum(*from._impl_.view_);
+  }
+  // @@protoc_insertion_point(copy_constructor:dsnet.transaction.eris.proto.ViewChangeRequestMessage)
+}
+
+inline void ViewChangeRequestMessage::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.view_){nullptr}
+  };
+}
+
+ViewChangeRequestMessage::~ViewChangeRequestMessage() {
+  // @@protoc_insertion_point(destructor:dsnet.transaction.eris.proto.ViewChangeRequestMessage)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void ViewChangeRequestMessage::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  if (this != internal_default_instance()) delete _impl_.view_;
+}
+
+void ViewChangeRequestMessage::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void ViewChangeRequestMessage::Clear() {
+// @@protoc_insertion_point(message_clear_start:dsnet.transaction.eris.proto.ViewChangeRequestMessage)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    GOOGLE_DCHECK(_impl_.view_ != nullptr);
+    _impl_.view_->Clear();
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* ViewChangeRequestMessage::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required .dsnet.transaction.eris.proto.ViewNum view = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr = ctx->ParseMessage(_internal_mutable_view(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* ViewChangeRequestMessage::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:dsnet.transaction.eris.proto.ViewChangeRequestMessage)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required .dsnet.transaction.eris.proto.ViewNum view = 1;
+  if (cached_has_bits & 0x00000001u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(1, _Internal::view(this),
+        _Internal::view(this).GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:dsnet.transaction.eris.proto.ViewChangeRequestMessage)
+  return target;
+}
+
+size_t ViewChangeRequestMessage::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:dsnet.transaction.eris.proto.ViewChangeRequestMessage)
+  size_t total_size = 0;
+
+  // required .dsnet.transaction.eris.proto.ViewNum view = 1;
+  if (_internal_has_view()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.view_);
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ViewChangeRequestMessage::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    ViewChangeRequestMessage::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ViewChangeRequestMessage::GetClassData() const { return &_class_data_; }
+
+
+void ViewChangeRequestMessage::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<ViewChangeRequestMessage*>(&to_msg);
+  auto& from = static_cast<const ViewChangeRequestMessage&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:dsnet.transaction.eris.proto.ViewChangeRequestMessage)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_has_view()) {
+    _this->_internal_mutable_view()->::dsnet::transaction::eris::proto::ViewNum::MergeFrom(
+        from._internal_view());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void ViewChangeRequestMessage::CopyFrom(const ViewChangeRequestMessage& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:dsnet.transaction.eris.proto.ViewChangeRequestMessage)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool ViewChangeRequestMessage::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  if (_internal_has_view()) {
+    if (!_impl_.view_->IsInitialized()) return false;
+  }
+  return true;
+}
+
+void ViewChangeRequestMessage::InternalSwap(ViewChangeRequestMessage* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  swap(_impl_.view_, other->_impl_.view_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata ViewChangeRequestMessage::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_transaction_2feris_2feris_2dproto_2eproto_getter, &descriptor_table_transaction_2feris_2feris_2dproto_2eproto_once,
+      file_level_metadata_transaction_2feris_2feris_2dproto_2eproto[7]);
+}
+
+// ===================================================================
+
+class DropTxns::_Internal {
+ public:
+};
+
+DropTxns::DropTxns(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:dsnet.transaction.eris.proto.DropTxns)
+}
+DropTxns::DropTxns(const DropTxns& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  DropTxns* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.temp_drops_){from._impl_.temp_drops_}
+    , decltype(_impl_.perm_drops_){from._impl_.perm_drops_}
+    , decltype(_impl_.un_drops_){from._impl_.un_drops_}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  // @@protoc_insertion_point(copy_constructor:dsnet.transaction.eris.proto.DropTxns)
+}
+
+inline void DropTxns::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.temp_drops_){arena}
+    , decltype(_impl_.perm_drops_){arena}
+    , decltype(_impl_.un_drops_){arena}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+DropTxns::~DropTxns() {
+  // @@protoc_insertion_point(destructor:dsnet.transaction.eris.proto.DropTxns)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void DropTxns::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.temp_drops_.~RepeatedPtrField();
+  _impl_.perm_drops_.~RepeatedPtrField();
+  _impl_.un_drops_.~RepeatedPtrField();
+}
+
+void DropTxns::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void DropTxns::Clear() {
+// @@protoc_insertion_point(message_clear_start:dsnet.transaction.eris.proto.DropTxns)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.temp_drops_.Clear();
+  _impl_.perm_drops_.Clear();
+  _impl_.un_drops_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* DropTxns::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // repeated .dsnet.transaction.eris.proto.Stamp temp_drops = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_temp_drops(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<10>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .dsnet.transaction.eris.proto.Stamp perm_drops = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_perm_drops(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<18>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .dsnet.transaction.eris.proto.RequestMessage un_drops = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_un_drops(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<26>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* DropTxns::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:dsnet.transaction.eris.proto.DropTxns)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // repeated .dsnet.transaction.eris.proto.Stamp temp_drops = 1;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_temp_drops_size()); i < n; i++) {
+    const auto& repfield = this->_internal_temp_drops(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(1, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  // repeated .dsnet.transaction.eris.proto.Stamp perm_drops = 2;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_perm_drops_size()); i < n; i++) {
+    const auto& repfield = this->_internal_perm_drops(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(2, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  // repeated .dsnet.transaction.eris.proto.RequestMessage un_drops = 3;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_un_drops_size()); i < n; i++) {
+    const auto& repfield = this->_internal_un_drops(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(3, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:dsnet.transaction.eris.proto.DropTxns)
+  return target;
+}
+
+size_t DropTxns::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:dsnet.transaction.eris.proto.DropTxns)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .dsnet.transaction.eris.proto.Stamp temp_drops = 1;
+  total_size += 1UL * this->_internal_temp_drops_size();
+  for (const auto& msg : this->_impl_.temp_drops_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // repeated .dsnet.transaction.eris.proto.Stamp perm_drops = 2;
+  total_size += 1UL * this->_internal_perm_drops_size();
+  for (const auto& msg : this->_impl_.perm_drops_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // repeated .dsnet.transaction.eris.proto.RequestMessage un_drops = 3;
+  total_size += 1UL * this->_internal_un_drops_size();
+  for (const auto& msg : this->_impl_.un_drops_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData DropTxns::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    DropTxns::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*DropTxns::GetClassData() const { return &_class_data_; }
+
+
+void DropTxns::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<DropTxns*>(&to_msg);
+  auto& from = static_cast<const DropTxns&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:dsnet.transaction.eris.proto.DropTxns)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.temp_drops_.MergeFrom(from._impl_.temp_drops_);
+  _this->_impl_.perm_drops_.MergeFrom(from._impl_.perm_drops_);
+  _this->_impl_.un_drops_.MergeFrom(from._impl_.un_drops_);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void DropTxns::CopyFrom(const DropTxns& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:dsnet.transaction.eris.proto.DropTxns)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool DropTxns::IsInitialized() const {
+  if (!::PROTOBUF_NAMESPACE_ID::internal::AllAreInitialized(_impl_.temp_drops_))
+    return false;
+  if (!::PROTOBUF_NAMESPACE_ID::internal::AllAreInitialized(_impl_.perm_drops_))
+    return false;
+  if (!::PROTOBUF_NAMESPACE_ID::internal::AllAreInitialized(_impl_.un_drops_))
+    return false;
+  return true;
+}
+
+void DropTxns::InternalSwap(DropTxns* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.temp_drops_.InternalSwap(&other->_impl_.temp_drops_);
+  _impl_.perm_drops_.InternalSwap(&other->_impl_.perm_drops_);
+  _impl_.un_drops_.InternalSwap(&other->_impl_.un_drops_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata DropTxns::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_transaction_2feris_2feris_2dproto_2eproto_getter, &descriptor_table_transaction_2feris_2feris_2dproto_2eproto_once,
+      file_level_metadata_transaction_2feris_2feris_2dproto_2eproto[8]);
+}
+
+// ===================================================================
+
+class ViewChangeMessage::_Internal {
+ public:
+  using HasBits = decltype(std::declval<ViewChangeMessage>()._impl_._has_bits_);
+  static const ::dsnet::transaction::eris::proto::ViewNum& view(const ViewChangeMessage* msg);
+  static void set_has_view(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_replica_num(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+  static void set_has_op_num(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static const ::dsnet::transaction::eris::proto::DropTxns& drops(const ViewChangeMessage* msg);
+  static void set_has_drops(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x0000000f) ^ 0x0000000f) != 0;
+  }
+};
+
+const ::dsnet::transaction::eris::proto::ViewNum&
+ViewChangeMessage::_Internal::view(const ViewChangeMessage* msg) {
+  return *msg->_impl_.view_;
+}
+const ::dsnet::transaction::eris::proto::DropTxns&
+ViewChangeMessage::_Internal::drops(const ViewChangeMessage* msg) {
+  return *msg->_impl_.drops_;
+}
+ViewChangeMessage::ViewChangeMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:dsnet.transaction.eris.proto.ViewChangeMessage)
+}
+ViewChangeMessage::ViewChangeMessage(const ViewChangeMessage& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  ViewChangeMessage* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.view_){nullptr}
+    , decltype(_impl_.drops_){nullptr}
+    , decltype(_impl_.op_num_){}
+    , decltype(_impl_.replica_num_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  if (from._internal_has_view()) {
+    _this->_impl_.view_ = new ::dsnet::transaction::eris::proto::ViewNum(*from._impl_.view_);
+  }
+  if (from._internal_has_drops()) {
+    _this->_impl_.drops_ = new ::dsnet::transaction::eris::proto::DropTxns(*from._impl_.drops_);
+  }
+  ::memcpy(&_impl_.op_num_, &from._impl_.op_num_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.replica_num_) -
+    reinterpret_cast<char*>(&_impl_.op_num_)) + sizeof(_impl_.replica_num_));
+  // @@protoc_insertion_point(copy_constructor:dsnet.transaction.eris.proto.ViewChangeMessage)
+}
+
+inline void ViewChangeMessage::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.view_){nullptr}
+    , decltype(_impl_.drops_){nullptr}
+    , decltype(_impl_.op_num_){uint64_t{0u}}
+    , decltype(_impl_.replica_num_){0u}
+  };
+}
+
+ViewChangeMessage::~ViewChangeMessage() {
+  // @@protoc_insertion_point(destructor:dsnet.transaction.eris.proto.ViewChangeMessage)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void ViewChangeMessage::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  if (this != internal_default_instance()) delete _impl_.view_;
+  if (this != internal_default_instance()) delete _impl_.drops_;
+}
+
+void ViewChangeMessage::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void ViewChangeMessage::Clear() {
+// @@protoc_insertion_point(message_clear_start:dsnet.transaction.eris.proto.ViewChangeMessage)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      GOOGLE_DCHECK(_impl_.view_ != nullptr);
+      _impl_.view_->Clear();
+    }
+    if (cached_has_bits & 0x00000002u) {
+      GOOGLE_DCHECK(_impl_.drops_ != nullptr);
+      _impl_.drops_->Clear();
+    }
+  }
+  if (cached_has_bits & 0x0000000cu) {
+    ::memset(&_impl_.op_num_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.replica_num_) -
+        reinterpret_cast<char*>(&_impl_.op_num_)) + sizeof(_impl_.replica_num_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* ViewChangeMessage::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required .dsnet.transaction.eris.proto.ViewNum view = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr = ctx->ParseMessage(_internal_mutable_view(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required uint32 replica_num = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _Internal::set_has_replica_num(&has_bits);
+          _impl_.replica_num_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required uint64 op_num = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _Internal::set_has_op_num(&has_bits);
+          _impl_.op_num_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required .dsnet.transaction.eris.proto.DropTxns drops = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          ptr = ctx->ParseMessage(_internal_mutable_drops(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* ViewChangeMessage::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:dsnet.transaction.eris.proto.ViewChangeMessage)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required .dsnet.transaction.eris.proto.ViewNum view = 1;
+  if (cached_has_bits & 0x00000001u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(1, _Internal::view(this),
+        _Internal::view(this).GetCachedSize(), target, stream);
+  }
+
+  // required uint32 replica_num = 2;
+  if (cached_has_bits & 0x00000008u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(2, this->_internal_replica_num(), target);
+  }
+
+  // required uint64 op_num = 3;
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(3, this->_internal_op_num(), target);
+  }
+
+  // required .dsnet.transaction.eris.proto.DropTxns drops = 4;
+  if (cached_has_bits & 0x00000002u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(4, _Internal::drops(this),
+        _Internal::drops(this).GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:dsnet.transaction.eris.proto.ViewChangeMessage)
+  return target;
+}
+
+size_t ViewChangeMessage::RequiredFieldsByteSizeFallback() const {
+// @@protoc_insertion_point(required_fields_byte_size_fallback_start:dsnet.transaction.eris.proto.ViewChangeMessage)
+  size_t total_size = 0;
+
+  if (_internal_has_view()) {
+    // required .dsnet.transaction.eris.proto.ViewNum view = 1;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.view_);
+  }
+
+  if (_internal_has_drops()) {
+    // required .dsnet.transaction.eris.proto.DropTxns drops = 4;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.drops_);
+  }
+
+  if (_internal_has_op_num()) {
+    // required uint64 op_num = 3;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_op_num());
+  }
+
+  if (_internal_has_replica_num()) {
+    // required uint32 replica_num = 2;
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_replica_num());
+  }
+
+  return total_size;
+}
+size_t ViewChangeMessage::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:dsnet.transaction.eris.proto.ViewChangeMessage)
+  size_t total_size = 0;
+
+  if (((_impl_._has_bits_[0] & 0x0000000f) ^ 0x0000000f) == 0) {  // All required fields are present.
+    // required .dsnet.transaction.eris.proto.ViewNum view = 1;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.view_);
+
+    // required .dsnet.transaction.eris.proto.DropTxns drops = 4;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.drops_);
+
+    // required uint64 op_num = 3;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_op_num());
+
+    // required uint32 replica_num = 2;
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_replica_num());
+
+  } else {
+    total_size += RequiredFieldsByteSizeFallback();
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ViewChangeMessage::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    ViewChangeMessage::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ViewChangeMessage::GetClassData() const { return &_class_data_; }
+
+
+void ViewChangeMessage::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<ViewChangeMessage*>(&to_msg);
+  auto& from = static_cast<const ViewChangeMessage&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:dsnet.transaction.eris.proto.ViewChangeMessage)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000000fu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_mutable_view()->::dsnet::transaction::eris::proto::ViewNum::MergeFrom(
+          from._internal_view());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_internal_mutable_drops()->::dsnet::transaction::eris::proto::DropTxns::MergeFrom(
+          from._internal_drops());
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.op_num_ = from._impl_.op_num_;
+    }
+    if (cached_has_bits & 0x00000008u) {
+      _this->_impl_.replica_num_ = from._impl_.replica_num_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void ViewChangeMessage::CopyFrom(const ViewChangeMessage& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:dsnet.transaction.eris.proto.ViewChangeMessage)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool ViewChangeMessage::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  if (_internal_has_view()) {
+    if (!_impl_.view_->IsInitialized()) return false;
+  }
+  if (_internal_has_drops()) {
+    if (!_impl_.drops_->IsInitialized()) return false;
+  }
+  return true;
+}
+
+void ViewChangeMessage::InternalSwap(ViewChangeMessage* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(ViewChangeMessage, _impl_.replica_num_)
+      + sizeof(ViewChangeMessage::_impl_.replica_num_)
+      - PROTOBUF_FIELD_OFFSET(ViewChangeMessage, _impl_.view_)>(
+          reinterpret_cast<char*>(&_impl_.view_),
+          reinterpret_cast<char*>(&other->_impl_.view_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata ViewChangeMessage::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_transaction_2feris_2feris_2dproto_2eproto_getter, &descriptor_table_transaction_2feris_2feris_2dproto_2eproto_once,
+      file_level_metadata_transaction_2feris_2feris_2dproto_2eproto[9]);
+}
+
+// ===================================================================
+
+class StartViewMessage::_Internal {
+ public:
+  using HasBits = decltype(std::declval<StartViewMessage>()._impl_._has_bits_);
+  static const ::dsnet::transaction::eris::proto::ViewNum& view(const StartViewMessage* msg);
+  static void set_has_view(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_op_num(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static const ::dsnet::transaction::eris::proto::DropTxns& drops(const StartViewMessage* msg);
+  static void set_has_drops(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000007) ^ 0x00000007) != 0;
+  }
+};
+
+const ::dsnet::transaction::eris::proto::ViewNum&
+StartViewMessage::_Internal::view(const StartViewMessage* msg) {
+  return *msg->_impl_.view_;
+}
+const ::dsnet::transaction::eris::proto::DropTxns&
+StartViewMessage::_Internal::drops(const StartViewMessage* msg) {
+  return *msg->_impl_.drops_;
+}
+StartViewMessage::StartViewMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:dsnet.transaction.eris.proto.StartViewMessage)
+}
+StartViewMessage::StartViewMessage(const StartViewMessage& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  StartViewMessage* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.view_){nullptr}
+    , decltype(_impl_.drops_){nullptr}
+    , decltype(_impl_.op_num_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  if (from._internal_has_view()) {
+    _this->_impl_.view_ = new ::dsnet::transaction::eris::proto::ViewNum(*from._impl_.view_);
+  }
+  if (from._internal_has_drops()) {
+    _this->_impl_.drops_ = new ::dsnet::transaction::eris::proto::DropTxns(*from._impl_.drops_);
+  }
+  _this->_impl_.op_num_ = from._impl_.op_num_;
+  // @@protoc_insertion_point(copy_constructor:dsnet.transaction.eris.proto.StartViewMessage)
+}
+
+inline void StartViewMessage::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.view_){nullptr}
+    , decltype(_impl_.drops_){nullptr}
+    , decltype(_impl_.op_num_){uint64_t{0u}}
+  };
+}
+
+StartViewMessage::~StartViewMessage() {
+  // @@protoc_insertion_point(destructor:dsnet.transaction.eris.proto.StartViewMessage)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void StartViewMessage::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  if (this != internal_default_instance()) delete _impl_.view_;
+  if (this != internal_default_instance()) delete _impl_.drops_;
+}
+
+void StartViewMessage::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void StartViewMessage::Clear() {
+// @@protoc_insertion_point(message_clear_start:dsnet.transaction.eris.proto.StartViewMessage)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      GOOGLE_DCHECK(_impl_.view_ != nullptr);
+      _impl_.view_->Clear();
+    }
+    if (cached_has_bits & 0x00000002u) {
+      GOOGLE_DCHECK(_impl_.drops_ != nullptr);
+      _impl_.drops_->Clear();
+    }
+  }
+  _impl_.op_num_ = uint64_t{0u};
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* StartViewMessage::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required .dsnet.transaction.eris.proto.ViewNum view = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr = ctx->ParseMessage(_internal_mutable_view(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required uint64 op_num = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _Internal::set_has_op_num(&has_bits);
+          _impl_.op_num_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required .dsnet.transaction.eris.proto.DropTxns drops = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          ptr = ctx->ParseMessage(_internal_mutable_drops(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* StartViewMessage::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:dsnet.transaction.eris.proto.StartViewMessage)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required .dsnet.transaction.eris.proto.ViewNum view = 1;
+  if (cached_has_bits & 0x00000001u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(1, _Internal::view(this),
+        _Internal::view(this).GetCachedSize(), target, stream);
+  }
+
+  // required uint64 op_num = 2;
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(2, this->_internal_op_num(), target);
+  }
+
+  // required .dsnet.transaction.eris.proto.DropTxns drops = 3;
+  if (cached_has_bits & 0x00000002u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(3, _Internal::drops(this),
+        _Internal::drops(this).GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:dsnet.transaction.eris.proto.StartViewMessage)
+  return target;
+}
+
+size_t StartViewMessage::RequiredFieldsByteSizeFallback() const {
+// @@protoc_insertion_point(required_fields_byte_size_fallback_start:dsnet.transaction.eris.proto.StartViewMessage)
+  size_t total_size = 0;
+
+  if (_internal_has_view()) {
+    // required .dsnet.transaction.eris.proto.ViewNum view = 1;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.view_);
+  }
+
+  if (_internal_has_drops()) {
+    // required .dsnet.transaction.eris.proto.DropTxns drops = 3;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.drops_);
+  }
+
+  if (_internal_has_op_num()) {
+    // required uint64 op_num = 2;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_op_num());
+  }
+
+  return total_size;
+}
+size_t StartViewMessage::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:dsnet.transaction.eris.proto.StartViewMessage)
+  size_t total_size = 0;
+
+  if (((_impl_._has_bits_[0] & 0x00000007) ^ 0x00000007) == 0) {  // All required fields are present.
+    // required .dsnet.transaction.eris.proto.ViewNum view = 1;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.view_);
+
+    // required .dsnet.transaction.eris.proto.DropTxns drops = 3;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.drops_);
+
+    // required uint64 op_num = 2;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_op_num());
+
+  } else {
+    total_size += RequiredFieldsByteSizeFallback();
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData StartViewMessage::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    StartViewMessage::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*StartViewMessage::GetClassData() const { return &_class_data_; }
+
+
+void StartViewMessage::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<StartViewMessage*>(&to_msg);
+  auto& from = static_cast<const StartViewMessage&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:dsnet.transaction.eris.proto.StartViewMessage)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_mutable_view()->::dsnet::transaction::eris::proto::ViewNum::MergeFrom(
+          from._internal_view());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_internal_mutable_drops()->::dsnet::transaction::eris::proto::DropTxns::MergeFrom(
+          from._internal_drops());
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.op_num_ = from._impl_.op_num_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void StartViewMessage::CopyFrom(const StartViewMessage& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:dsnet.transaction.eris.proto.StartViewMessage)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool StartViewMessage::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  if (_internal_has_view()) {
+    if (!_impl_.view_->IsInitialized()) return false;
+  }
+  if (_internal_has_drops()) {
+    if (!_impl_.drops_->IsInitialized()) return false;
+  }
+  return true;
+}
+
+void StartViewMessage::InternalSwap(StartViewMessage* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(StartViewMessage, _impl_.op_num_)
+      + sizeof(StartViewMessage::_impl_.op_num_)
+      - PROTOBUF_FIELD_OFFSET(StartViewMessage, _impl_.view_)>(
+          reinterpret_cast<char*>(&_impl_.view_),
+          reinterpret_cast<char*>(&other->_impl_.view_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata StartViewMessage::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_transaction_2feris_2feris_2dproto_2eproto_getter, &descriptor_table_transaction_2feris_2feris_2dproto_2eproto_once,
+      file_level_metadata_transaction_2feris_2feris_2dproto_2eproto[10]);
+}
+
+// ===================================================================
+
+class StateTransferRequestMessage::_Internal {
+ public:
+  using HasBits = decltype(std::declval<StateTransferRequestMessage>()._impl_._has_bits_);
+  static const ::dsnet::transaction::eris::proto::ViewNum& view(const StateTransferRequestMessage* msg);
+  static void set_has_view(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_begin(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_end(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000007) ^ 0x00000007) != 0;
+  }
+};
+
+const ::dsnet::transaction::eris::proto::ViewNum&
+StateTransferRequestMessage::_Internal::view(const StateTransferRequestMessage* msg) {
+  return *msg->_impl_.view_;
+}
+StateTransferRequestMessage::StateTransferRequestMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:dsnet.transaction.eris.proto.StateTransferRequestMessage)
+}
+StateTransferRequestMessage::StateTransferRequestMessage(const StateTransferRequestMessage& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  StateTransferRequestMessage* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.view_){nullptr}
+    , decltype(_impl_.begin_){}
+    , decltype(_impl_.end_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  if (from._internal_has_view()) {
+    _this->_impl_.view_ = new ::dsnet::transaction::eris::proto::ViewNum(*from._impl_.view_);
+  }
+  ::memcpy(&_impl_.begin_, &from._impl_.begin_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.end_) -
+    reinterpret_cast<char*>(&_impl_.begin_)) + sizeof(_impl_.end_));
+  // @@protoc_insertion_point(copy_constructor:dsnet.transaction.eris.proto.StateTransferRequestMessage)
+}
+
+inline void StateTransferRequestMessage::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.view_){nullptr}
+    , decltype(_impl_.begin_){uint64_t{0u}}
+    , decltype(_impl_.end_){uint64_t{0u}}
+  };
+}
+
+StateTransferRequestMessage::~StateTransferRequestMessage() {
+  // @@protoc_insertion_point(destructor:dsnet.transaction.eris.proto.StateTransferRequestMessage)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void StateTransferRequestMessage::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  if (this != internal_default_instance()) delete _impl_.view_;
+}
+
+void StateTransferRequestMessage::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void StateTransferRequestMessage::Clear() {
+// @@protoc_insertion_point(message_clear_start:dsnet.transaction.eris.proto.StateTransferRequestMessage)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    GOOGLE_DCHECK(_impl_.view_ != nullptr);
+    _impl_.view_->Clear();
+  }
+  if (cached_has_bits & 0x00000006u) {
+    ::memset(&_impl_.begin_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.end_) -
+        reinterpret_cast<char*>(&_impl_.begin_)) + sizeof(_impl_.end_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* StateTransferRequestMessage::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required .dsnet.transaction.eris.proto.ViewNum view = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr = ctx->ParseMessage(_internal_mutable_view(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required uint64 begin = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _Internal::set_has_begin(&has_bits);
+          _impl_.begin_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required uint64 end = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _Internal::set_has_end(&has_bits);
+          _impl_.end_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* StateTransferRequestMessage::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:dsnet.transaction.eris.proto.StateTransferRequestMessage)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required .dsnet.transaction.eris.proto.ViewNum view = 1;
+  if (cached_has_bits & 0x00000001u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(1, _Internal::view(this),
+        _Internal::view(this).GetCachedSize(), target, stream);
+  }
+
+  // required uint64 begin = 2;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(2, this->_internal_begin(), target);
+  }
+
+  // required uint64 end = 3;
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(3, this->_internal_end(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:dsnet.transaction.eris.proto.StateTransferRequestMessage)
+  return target;
+}
+
+size_t StateTransferRequestMessage::RequiredFieldsByteSizeFallback() const {
+// @@protoc_insertion_point(required_fields_byte_size_fallback_start:dsnet.transaction.eris.proto.StateTransferRequestMessage)
+  size_t total_size = 0;
+
+  if (_internal_has_view()) {
+    // required .dsnet.transaction.eris.proto.ViewNum view = 1;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.view_);
+  }
+
+  if (_internal_has_begin()) {
+    // required uint64 begin = 2;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_begin());
+  }
+
+  if (_internal_has_end()) {
+    // required uint64 end = 3;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_end());
+  }
+
+  return total_size;
+}
+size_t StateTransferRequestMessage::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:dsnet.transaction.eris.proto.StateTransferRequestMessage)
+  size_t total_size = 0;
+
+  if (((_impl_._has_bits_[0] & 0x00000007) ^ 0x00000007) == 0) {  // All required fields are present.
+    // required .dsnet.transaction.eris.proto.ViewNum view = 1;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.view_);
+
+    // required uint64 begin = 2;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_begin());
+
+    // required uint64 end = 3;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_end());
+
+  } else {
+    total_size += RequiredFieldsByteSizeFallback();
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData StateTransferRequestMessage::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    StateTransferRequestMessage::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*StateTransferRequestMessage::GetClassData() const { return &_class_data_; }
+
+
+void StateTransferRequestMessage::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<StateTransferRequestMessage*>(&to_msg);
+  auto& from = static_cast<const StateTransferRequestMessage&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:dsnet.transaction.eris.proto.StateTransferRequestMessage)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_mutable_view()->::dsnet::transaction::eris::proto::ViewNum::MergeFrom(
+          from._internal_view());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.begin_ = from._impl_.begin_;
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.end_ = from._impl_.end_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void StateTransferRequestMessage::CopyFrom(const StateTransferRequestMessage& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:dsnet.transaction.eris.proto.StateTransferRequestMessage)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool StateTransferRequestMessage::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  if (_internal_has_view()) {
+    if (!_impl_.view_->IsInitialized()) return false;
+  }
+  return true;
+}
+
+void StateTransferRequestMessage::InternalSwap(StateTransferRequestMessage* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(StateTransferRequestMessage, _impl_.end_)
+      + sizeof(StateTransferRequestMessage::_impl_.end_)
+      - PROTOBUF_FIELD_OFFSET(StateTransferRequestMessage, _impl_.view_)>(
+          reinterpret_cast<char*>(&_impl_.view_),
+          reinterpret_cast<char*>(&other->_impl_.view_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata StateTransferRequestMessage::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_transaction_2feris_2feris_2dproto_2eproto_getter, &descriptor_table_transaction_2feris_2feris_2dproto_2eproto_once,
+      file_level_metadata_transaction_2feris_2feris_2dproto_2eproto[11]);
+}
+
+// ===================================================================
+
+class StateTransferReplyMessage_MsgLogEntry::_Internal {
+ public:
+  using HasBits = decltype(std::declval<StateTransferReplyMessage_MsgLogEntry>()._impl_._has_bits_);
+  static void set_has_view(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_op_num(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static void set_has_sess_num(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+  static void set_has_msg_num(HasBits* has_bits) {
+    (*has_bits)[0] |= 16u;
+  }
+  static void set_has_shard_num(HasBits* has_bits) {
+    (*has_bits)[0] |= 32u;
+  }
+  static void set_has_state(HasBits* has_bits) {
+    (*has_bits)[0] |= 64u;
+  }
+  static const ::dsnet::transaction::eris::proto::RequestMessage& request(const StateTransferReplyMessage_MsgLogEntry* msg);
+  static void set_has_request(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x0000007f) ^ 0x0000007f) != 0;
+  }
+};
+
+const ::dsnet::transaction::eris::proto::RequestMessage&
+StateTransferReplyMessage_MsgLogEntry::_Internal::request(const StateTransferReplyMessage_MsgLogEntry* msg) {
+  return *msg->_impl_.request_;
+}
+StateTransferReplyMessage_MsgLogEntry::StateTransferReplyMessage_MsgLogEntry(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:dsnet.transaction.eris.proto.StateTransferReplyMessage.MsgLogEntry)
+}
+StateTransferReplyMessage_MsgLogEntry::StateTransferReplyMessage_MsgLogEntry(const StateTransferReplyMessage_MsgLogEntry& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  StateTransferReplyMessage_MsgLogEntry* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.request_){nullptr}
+    , decltype(_impl_.view_){}
+    , decltype(_impl_.op_num_){}
+    , decltype(_impl_.sess_num_){}
+    , decltype(_impl_.msg_num_){}
+    , decltype(_impl_.shard_num_){}
+    , decltype(_impl_.state_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  if (from._internal_has_request()) {
+    _this->_impl_.request_ = new ::dsnet::transaction::eris::proto::RequestMessage(*from._impl_.request_);
+  }
+  ::memcpy(&_impl_.view_, &from._impl_.view_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.state_) -
+    reinterpret_cast<char*>(&_impl_.view_)) + sizeof(_impl_.state_));
+  // @@protoc_insertion_point(copy_constructor:dsnet.transaction.eris.proto.StateTransferReplyMessage.MsgLogEntry)
+}
+
+inline void StateTransferReplyMessage_MsgLogEntry::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.request_){nullptr}
+    , decltype(_impl_.view_){uint64_t{0u}}
+    , decltype(_impl_.op_num_){uint64_t{0u}}
+    , decltype(_impl_.sess_num_){uint64_t{0u}}
+    , decltype(_impl_.msg_num_){uint64_t{0u}}
+    , decltype(_impl_.shard_num_){uint64_t{0u}}
+    , decltype(_impl_.state_){0u}
+  };
+}
+
+StateTransferReplyMessage_MsgLogEntry::~StateTransferReplyMessage_MsgLogEntry() {
+  // @@protoc_insertion_point(destructor:dsnet.transaction.eris.proto.StateTransferReplyMessage.MsgLogEntry)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void StateTransferReplyMessage_MsgLogEntry::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  if (this != internal_default_instance()) delete _impl_.request_;
+}
+
+void StateTransferReplyMessage_MsgLogEntry::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void StateTransferReplyMessage_MsgLogEntry::Clear() {
+// @@protoc_insertion_point(message_clear_start:dsnet.transaction.eris.proto.StateTransferReplyMessage.MsgLogEntry)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    GOOGLE_DCHECK(_impl_.request_ != nullptr);
+    _impl_.request_->Clear();
+  }
+  if (cached_has_bits & 0x0000007eu) {
+    ::memset(&_impl_.view_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.state_) -
+        reinterpret_cast<char*>(&_impl_.view_)) + sizeof(_impl_.state_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* StateTransferReplyMessage_MsgLogEntry::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required uint64 view = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_view(&has_bits);
+          _impl_.view_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required uint64 op_num = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _Internal::set_has_op_num(&has_bits);
+          _impl_.op_num_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required uint64 sess_num = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _Internal::set_has_sess_num(&has_bits);
+          _impl_.sess_num_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required uint64 msg_num = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _Internal::set_has_msg_num(&has_bits);
+          _impl_.msg_num_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required uint64 shard_num = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          _Internal::set_has_shard_num(&has_bits);
+          _impl_.shard_num_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required uint32 state = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 48)) {
+          _Internal::set_has_state(&has_bits);
+          _impl_.state_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required .dsnet.transaction.eris.proto.RequestMessage request = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 58)) {
+          ptr = ctx->ParseMessage(_internal_mutable_request(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* StateTransferReplyMessage_MsgLogEntry::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:dsnet.transaction.eris.proto.StateTransferReplyMessage.MsgLogEntry)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required uint64 view = 1;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(1, this->_internal_view(), target);
+  }
+
+  // required uint64 op_num = 2;
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(2, this->_internal_op_num(), target);
+  }
+
+  // required uint64 sess_num = 3;
+  if (cached_has_bits & 0x00000008u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(3, this->_internal_sess_num(), target);
+  }
+
+  // required uint64 msg_num = 4;
+  if (cached_has_bits & 0x00000010u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(4, this->_internal_msg_num(), target);
+  }
+
+  // required uint64 shard_num = 5;
+  if (cached_has_bits & 0x00000020u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(5, this->_internal_shard_num(), target);
+  }
+
+  // required uint32 state = 6;
+  if (cached_has_bits & 0x00000040u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(6, this->_internal_state(), target);
+  }
+
+  // required .dsnet.transaction.eris.proto.RequestMessage request = 7;
+  if (cached_has_bits & 0x00000001u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(7, _Internal::request(this),
+        _Internal::request(this).GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:dsnet.transaction.eris.proto.StateTransferReplyMessage.MsgLogEntry)
+  return target;
+}
+
+size_t StateTransferReplyMessage_MsgLogEntry::RequiredFieldsByteSizeFallback() const {
+// @@protoc_insertion_point(required_fields_byte_size_fallback_start:dsnet.transaction.eris.proto.StateTransferReplyMessage.MsgLogEntry)
+  size_t total_size = 0;
+
+  if (_internal_has_request()) {
+    // required .dsnet.transaction.eris.proto.RequestMessage request = 7;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.request_);
+  }
+
+  if (_internal_has_view()) {
+    // required uint64 view = 1;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_view());
+  }
+
+  if (_internal_has_op_num()) {
+    // required uint64 op_num = 2;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_op_num());
+  }
+
+  if (_internal_has_sess_num()) {
+    // required uint64 sess_num = 3;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_sess_num());
+  }
+
+  if (_internal_has_msg_num()) {
+    // required uint64 msg_num = 4;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_msg_num());
+  }
+
+  if (_internal_has_shard_num()) {
+    // required uint64 shard_num = 5;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_shard_num());
+  }
+
+  if (_internal_has_state()) {
+    // required uint32 state = 6;
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_state());
+  }
+
+  return total_size;
+}
+size_t StateTransferReplyMessage_MsgLogEntry::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:dsnet.transaction.eris.proto.StateTransferReplyMessage.MsgLogEntry)
+  size_t total_size = 0;
+
+  if (((_impl_._has_bits_[0] & 0x0000007f) ^ 0x0000007f) == 0) {  // All required fields are present.
+    // required .dsnet.transaction.eris.proto.RequestMessage request = 7;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.request_);
+
+    // required uint64 view = 1;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_view());
+
+    // required uint64 op_num = 2;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_op_num());
+
+    // required uint64 sess_num = 3;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_sess_num());
+
+    // required uint64 msg_num = 4;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_msg_num());
+
+    // required uint64 shard_num = 5;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_shard_num());
+
+    // required uint32 state = 6;
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_state());
+
+  } else {
+    total_size += RequiredFieldsByteSizeFallback();
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData StateTransferReplyMessage_MsgLogEntry::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    StateTransferReplyMessage_MsgLogEntry::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*StateTransferReplyMessage_MsgLogEntry::GetClassData() const { return &_class_data_; }
+
+
+void StateTransferReplyMessage_MsgLogEntry::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<StateTransferReplyMessage_MsgLogEntry*>(&to_msg);
+  auto& from = static_cast<const StateTransferReplyMessage_MsgLogEntry&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:dsnet.transaction.eris.proto.StateTransferReplyMessage.MsgLogEntry)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000007fu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_mutable_request()->::dsnet::transaction::eris::proto::RequestMessage::MergeFrom(
+          from._internal_request());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.view_ = from._impl_.view_;
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.op_num_ = from._impl_.op_num_;
+    }
+    if (cached_has_bits & 0x00000008u) {
+      _this->_impl_.sess_num_ = from._impl_.sess_num_;
+    }
+    if (cached_has_bits & 0x00000010u) {
+      _this->_impl_.msg_num_ = from._impl_.msg_num_;
+    }
+    if (cached_has_bits & 0x00000020u) {
+      _this->_impl_.shard_num_ = from._impl_.shard_num_;
+    }
+    if (cached_has_bits & 0x00000040u) {
+      _this->_impl_.state_ = from._impl_.state_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void StateTransferReplyMessage_MsgLogEntry::CopyFrom(const StateTransferReplyMessage_MsgLogEntry& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:dsnet.transaction.eris.proto.StateTransferReplyMessage.MsgLogEntry)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool StateTransferReplyMessage_MsgLogEntry::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  if (_internal_has_request()) {
+    if (!_impl_.request_->IsInitialized()) return false;
+  }
+  return true;
+}
+
+void StateTransferReplyMessage_MsgLogEntry::InternalSwap(StateTransferReplyMessage_MsgLogEntry* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(StateTransferReplyMessage_MsgLogEntry, _impl_.state_)
+      + sizeof(StateTransferReplyMessage_MsgLogEntry::_impl_.state_)
+      - PROTOBUF_FIELD_OFFSET(StateTransferReplyMessage_MsgLogEntry, _impl_.request_)>(
+          reinterpret_cast<char*>(&_impl_.request_),
+          reinterpret_cast<char*>(&other->_impl_.request_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata StateTransferReplyMessage_MsgLogEntry::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_transaction_2feris_2feris_2dproto_2eproto_getter, &descriptor_table_transaction_2feris_2feris_2dproto_2eproto_once,
+      file_level_metadata_transaction_2feris_2feris_2dproto_2eproto[12]);
+}
+
+// ===================================================================
+
+class StateTransferReplyMessage::_Internal {
+ public:
+  using HasBits = decltype(std::declval<StateTransferReplyMessage>()._impl_._has_bits_);
+  static const ::dsnet::transaction::eris::proto::ViewNum& view(const StateTransferReplyMessage* msg);
+  static void set_has_view(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_begin(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_end(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000007) ^ 0x00000007) != 0;
+  }
+};
+
+const ::dsnet::transaction::eris::proto::ViewNum&
+StateTransferReplyMessage::_Internal::view(const StateTransferReplyMessage* msg) {
+  return *msg->_impl_.view_;
+}
+StateTransferReplyMessage::StateTransferReplyMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:dsnet.transaction.eris.proto.StateTransferReplyMessage)
+}
+StateTransferReplyMessage::StateTransferReplyMessage(const StateTransferReplyMessage& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  StateTransferReplyMessage* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.entries_){from._impl_.entries_}
+    , decltype(_impl_.view_){nullptr}
+    , decltype(_impl_.begin_){}
+    , decltype(_impl_.end_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  if (from._internal_has_view()) {
+    _this->_impl_.view_ = new ::dsnet::transaction::eris::proto::ViewNum(*from._impl_.view_);
+  }
+  ::memcpy(&_impl_.begin_, &from._impl_.begin_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.end_) -
+    reinterpret_cast<char*>(&_impl_.begin_)) + sizeof(_impl_.end_));
+  // @@protoc_insertion_point(copy_constructor:dsnet.transaction.eris.proto.StateTransferReplyMessage)
+}
+
+inline void StateTransferReplyMessage::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.entries_){arena}
+    , decltype(_impl_.view_){nullptr}
+    , decltype(_impl_.begin_){uint64_t{0u}}
+    , decltype(_impl_.end_){uint64_t{0u}}
+  };
+}
+
+StateTransferReplyMessage::~StateTransferReplyMessage() {
+  // @@protoc_insertion_point(destructor:dsnet.transaction.eris.proto.StateTransferReplyMessage)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void StateTransferReplyMessage::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.entries_.~RepeatedPtrField();
+  if (this != internal_default_instance()) delete _impl_.view_;
+}
+
+void StateTransferReplyMessage::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void StateTransferReplyMessage::Clear() {
+// @@protoc_insertion_point(message_clear_start:dsnet.transaction.eris.proto.StateTransferReplyMessage)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.entries_.Clear();
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    GOOGLE_DCHECK(_impl_.view_ != nullptr);
+    _impl_.view_->Clear();
+  }
+  if (cached_has_bits & 0x00000006u) {
+    ::memset(&_impl_.begin_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.end_) -
+        reinterpret_cast<char*>(&_impl_.begin_)) + sizeof(_impl_.end_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* StateTransferReplyMessage::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required .dsnet.transaction.eris.proto.ViewNum view = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr = ctx->ParseMessage(_internal_mutable_view(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required uint64 begin = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _Internal::set_has_begin(&has_bits);
+          _impl_.begin_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required uint64 end = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _Internal::set_has_end(&has_bits);
+          _impl_.end_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .dsnet.transaction.eris.proto.StateTransferReplyMessage.MsgLogEntry entries = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_entries(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<34>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* StateTransferReplyMessage::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:dsnet.transaction.eris.proto.StateTransferReplyMessage)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required .dsnet.transaction.eris.proto.ViewNum view = 1;
+  if (cached_has_bits & 0x00000001u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(1, _Internal::view(this),
+        _Internal::view(this).GetCachedSize(), target, stream);
+  }
+
+  // required uint64 begin = 2;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(2, this->_internal_begin(), target);
+  }
+
+  // required uint64 end = 3;
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(3, this->_internal_end(), target);
+  }
+
+  // repeated .dsnet.transaction.eris.proto.StateTransferReplyMessage.MsgLogEntry entries = 4;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_entries_size()); i < n; i++) {
+    const auto& repfield = this->_internal_entries(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(4, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:dsnet.transaction.eris.proto.StateTransferReplyMessage)
+  return target;
+}
+
+size_t StateTransferReplyMessage::RequiredFieldsByteSizeFallback() const {
+// @@protoc_insertion_point(required_fields_byte_size_fallback_start:dsnet.transaction.eris.proto.StateTransferReplyMessage)
+  size_t total_size = 0;
+
+  if (_internal_has_view()) {
+    // required .dsnet.transaction.eris.proto.ViewNum view = 1;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.view_);
+  }
+
+  if (_internal_has_begin()) {
+    // required uint64 begin = 2;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_begin());
+  }
+
+  if (_internal_has_end()) {
+    // required uint64 end = 3;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_end());
+  }
+
+  return total_size;
+}
+size_t StateTransferReplyMessage::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:dsnet.transaction.eris.proto.StateTransferReplyMessage)
+  size_t total_size = 0;
+
+  if (((_impl_._has_bits_[0] & 0x00000007) ^ 0x00000007) == 0) {  // All required fields are present.
+    // required .dsnet.transaction.eris.proto.ViewNum view = 1;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.view_);
+
+    // required uint64 begin = 2;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_begin());
+
+    // required uint64 end = 3;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_end());
+
+  } else {
+    total_size += RequiredFieldsByteSizeFallback();
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .dsnet.transaction.eris.proto.StateTransferReplyMessage.MsgLogEntry entries = 4;
+  total_size += 1UL * this->_internal_entries_size();
+  for (const auto& msg : this->_impl_.entries_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData StateTransferReplyMessage::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    StateTransferReplyMessage::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*StateTransferReplyMessage::GetClassData() const { return &_class_data_; }
+
+
+void StateTransferReplyMessage::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<StateTransferReplyMessage*>(&to_msg);
+  auto& from = static_cast<const StateTransferReplyMessage&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:dsnet.transaction.eris.proto.StateTransferReplyMessage)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.entries_.MergeFrom(from._impl_.entries_);
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_mutable_view()->::dsnet::transaction::eris::proto::ViewNum::MergeFrom(
+          from._internal_view());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.begin_ = from._impl_.begin_;
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.end_ = from._impl_.end_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void StateTransferReplyMessage::CopyFrom(const StateTransferReplyMessage& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:dsnet.transaction.eris.proto.StateTransferReplyMessage)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool StateTransferReplyMessage::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  if (!::PROTOBUF_NAMESPACE_ID::internal::AllAreInitialized(_impl_.entries_))
+    return false;
+  if (_internal_has_view()) {
+    if (!_impl_.view_->IsInitialized()) return false;
+  }
+  return true;
+}
+
+void StateTransferReplyMessage::InternalSwap(StateTransferReplyMessage* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  _impl_.entries_.InternalSwap(&other->_impl_.entries_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(StateTransferReplyMessage, _impl_.end_)
+      + sizeof(StateTransferReplyMessage::_impl_.end_)
+      - PROTOBUF_FIELD_OFFSET(StateTransferReplyMessage, _impl_.view_)>(
+          reinterpret_cast<char*>(&_impl_.view_),
+          reinterpret_cast<char*>(&other->_impl_.view_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata StateTransferReplyMessage::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_transaction_2feris_2feris_2dproto_2eproto_getter, &descriptor_table_transaction_2feris_2feris_2dproto_2eproto_once,
+      file_level_metadata_transaction_2feris_2feris_2dproto_2eproto[13]);
+}
+
+// ===================================================================
+
+class EpochChangeStateTransferRequest::_Internal {
+ public:
+  using HasBits = decltype(std::declval<EpochChangeStateTransferRequest>()._impl_._has_bits_);
+  static void set_has_sess_num(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_state_transfer_sess_num(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_shard_num(HasBits* has_bits) {
+    (*has_bits)[0] |= 16u;
+  }
+  static void set_has_begin(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static void set_has_end(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x0000001f) ^ 0x0000001f) != 0;
+  }
+};
+
+EpochChangeStateTransferRequest::EpochChangeStateTransferRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:dsnet.transaction.eris.proto.EpochChangeStateTransferRequest)
+}
+EpochChangeStateTransferRequest::EpochChangeStateTransferRequest(const EpochChangeStateTransferRequest& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  EpochChangeStateTransferRequest* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.sess_num_){}
+    , decltype(_impl_.state_transfer_sess_num_){}
+    , decltype(_impl_.begin_){}
+    , decltype(_impl_.end_){}
+    , decltype(_impl_.shard_num_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.sess_num_, &from._impl_.sess_num_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.shard_num_) -
+    reinterpret_cast<char*>(&_impl_.sess_num_)) + sizeof(_impl_.shard_num_));
+  // @@protoc_insertion_point(copy_constructor:dsnet.transaction.eris.proto.EpochChangeStateTransferRequest)
+}
+
+inline void EpochChangeStateTransferRequest::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.sess_num_){uint64_t{0u}}
+    , decltype(_impl_.state_transfer_sess_num_){uint64_t{0u}}
+    , decltype(_impl_.begin_){uint64_t{0u}}
+    , decltype(_impl_.end_){uint64_t{0u}}
+    , decltype(_impl_.shard_num_){0u}
+  };
+}
+
+EpochChangeStateTransferRequest::~EpochChangeStateTransferRequest() {
+  // @@protoc_insertion_point(destructor:dsnet.transaction.eris.proto.EpochChangeStateTransferRequest)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void EpochChangeStateTransferRequest::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void EpochChangeStateTransferRequest::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void EpochChangeStateTransferRequest::Clear() {
+// @@protoc_insertion_point(message_clear_start:dsnet.transaction.eris.proto.EpochChangeStateTransferRequest)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000001fu) {
+    ::memset(&_impl_.sess_num_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.shard_num_) -
+        reinterpret_cast<char*>(&_impl_.sess_num_)) + sizeof(_impl_.shard_num_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* EpochChangeStateTransferRequest::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required uint64 sess_num = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_sess_num(&has_bits);
+          _impl_.sess_num_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required uint64 state_transfer_sess_num = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _Internal::set_has_state_transfer_sess_num(&has_bits);
+          _impl_.state_transfer_sess_num_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required uint32 shard_num = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _Internal::set_has_shard_num(&has_bits);
+          _impl_.shard_num_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required uint64 begin = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _Internal::set_has_begin(&has_bits);
+          _impl_.begin_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required uint64 end = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          _Internal::set_has_end(&has_bits);
+          _impl_.end_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* EpochChangeStateTransferRequest::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:dsnet.transaction.eris.proto.EpochChangeStateTransferRequest)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required uint64 sess_num = 1;
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(1, this->_internal_sess_num(), target);
+  }
+
+  // required uint64 state_transfer_sess_num = 2;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(2, this->_internal_state_transfer_sess_num(), target);
+  }
+
+  // required uint32 shard_num = 3;
+  if (cached_has_bits & 0x00000010u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(3, this->_internal_shard_num(), target);
+  }
+
+  // required uint64 begin = 4;
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(4, this->_internal_begin(), target);
+  }
+
+  // required uint64 end = 5;
+  if (cached_has_bits & 0x00000008u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(5, this->_internal_end(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:dsnet.transaction.eris.proto.EpochChangeStateTransferRequest)
+  return target;
+}
+
+size_t EpochChangeStateTransferRequest::RequiredFieldsByteSizeFallback() const {
+// @@protoc_insertion_point(required_fields_byte_size_fallback_start:dsnet.transaction.eris.proto.EpochChangeStateTransferRequest)
+  size_t total_size = 0;
+
+  if (_internal_has_sess_num()) {
+    // required uint64 sess_num = 1;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_sess_num());
+  }
+
+  if (_internal_has_state_transfer_sess_num()) {
+    // required uint64 state_transfer_sess_num = 2;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_state_transfer_sess_num());
+  }
+
+  if (_internal_has_begin()) {
+    // required uint64 begin = 4;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_begin());
+  }
+
+  if (_internal_has_end()) {
+    // required uint64 end = 5;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_end());
+  }
+
+  if (_internal_has_shard_num()) {
+    // required uint32 shard_num = 3;
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_shard_num());
+  }
+
+  return total_size;
+}
+size_t EpochChangeStateTransferRequest::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:dsnet.transaction.eris.proto.EpochChangeStateTransferRequest)
+  size_t total_size = 0;
+
+  if (((_impl_._has_bits_[0] & 0x0000001f) ^ 0x0000001f) == 0) {  // All required fields are present.
+    // required uint64 sess_num = 1;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_sess_num());
+
+    // required uint64 state_transfer_sess_num = 2;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_state_transfer_sess_num());
+
+    // required uint64 begin = 4;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_begin());
+
+    // required uint64 end = 5;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_end());
+
+    // required uint32 shard_num = 3;
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_shard_num());
+
+  } else {
+    total_size += RequiredFieldsByteSizeFallback();
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData EpochChangeStateTransferRequest::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    EpochChangeStateTransferRequest::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*EpochChangeStateTransferRequest::GetClassData() const { return &_class_data_; }
+
+
+void EpochChangeStateTransferRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<EpochChangeStateTransferRequest*>(&to_msg);
+  auto& from = static_cast<const EpochChangeStateTransferRequest&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:dsnet.transaction.eris.proto.EpochChangeStateTransferRequest)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000001fu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_impl_.sess_num_ = from._impl_.sess_num_;
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.state_transfer_sess_num_ = from._impl_.state_transfer_sess_num_;
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.begin_ = from._impl_.begin_;
+    }
+    if (cached_has_bits & 0x00000008u) {
+      _this->_impl_.end_ = from._impl_.end_;
+    }
+    if (cached_has_bits & 0x00000010u) {
+      _this->_impl_.shard_num_ = from._impl_.shard_num_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void EpochChangeStateTransferRequest::CopyFrom(const EpochChangeStateTransferRequest& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:dsnet.transaction.eris.proto.EpochChangeStateTransferRequest)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool EpochChangeStateTransferRequest::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  return true;
+}
+
+void EpochChangeStateTransferRequest::InternalSwap(EpochChangeStateTransferRequest* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(EpochChangeStateTransferRequest, _impl_.shard_num_)
+      + sizeof(EpochChangeStateTransferRequest::_impl_.shard_num_)
+      - PROTOBUF_FIELD_OFFSET(EpochChangeStateTransferRequest, _impl_.sess_num_)>(
+          reinterpret_cast<char*>(&_impl_.sess_num_),
+          reinterpret_cast<char*>(&other->_impl_.sess_num_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata EpochChangeStateTransferRequest::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_transaction_2feris_2feris_2dproto_2eproto_getter, &descriptor_table_transaction_2feris_2feris_2dproto_2eproto_once,
+      file_level_metadata_transaction_2feris_2feris_2dproto_2eproto[14]);
+}
+
+// ===================================================================
+
+class EpochChangeStateTransferReply_MsgEntry::_Internal {
+ public:
+  using HasBits = decltype(std::declval<EpochChangeStateTransferReply_MsgEntry>()._impl_._has_bits_);
+  static void set_has_msg_num(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static const ::dsnet::transaction::eris::proto::RequestMessage& request(const EpochChangeStateTransferReply_MsgEntry* msg);
+  static void set_has_request(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000003) ^ 0x00000003) != 0;
+  }
+};
+
+const ::dsnet::transaction::eris::proto::RequestMessage&
+EpochChangeStateTransferReply_MsgEntry::_Internal::request(const EpochChangeStateTransferReply_MsgEntry* msg) {
+  return *msg->_impl_.request_;
+}
+EpochChangeStateTransferReply_MsgEntry::EpochChangeStateTransferReply_MsgEntry(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:dsnet.transaction.eris.proto.EpochChangeStateTransferReply.MsgEntry)
+}
+EpochChangeStateTransferReply_MsgEntry::EpochChangeStateTransferReply_MsgEntry(const EpochChangeStateTransferReply_MsgEntry& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  EpochChangeStateTransferReply_MsgEntry* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.request_){nullptr}
+    , decltype(_impl_.msg_num_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  if (from._internal_has_request()) {
+    _this->_impl_.request_ = new ::dsnet::transaction::eris::proto::RequestMessage(*from._impl_.request_);
+  }
+  _this->_impl_.msg_num_ = from._impl_.msg_num_;
+  // @@protoc_insertion_point(copy_constructor:dsnet.transaction.eris.proto.EpochChangeStateTransferReply.MsgEntry)
+}
+
+inline void EpochChangeStateTransferReply_MsgEntry::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.request_){nullptr}
+    , decltype(_impl_.msg_num_){uint64_t{0u}}
+  };
+}
+
+EpochChangeStateTransferReply_MsgEntry::~EpochChangeStateTransferReply_MsgEntry() {
+  // @@protoc_insertion_point(destructor:dsnet.transaction.eris.proto.EpochChangeStateTransferReply.MsgEntry)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void EpochChangeStateTransferReply_MsgEntry::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  if (this != internal_default_instance()) delete _impl_.request_;
+}
+
+void EpochChangeStateTransferReply_MsgEntry::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void EpochChangeStateTransferReply_MsgEntry::Clear() {
+// @@protoc_insertion_point(message_clear_start:dsnet.transaction.eris.proto.EpochChangeStateTransferReply.MsgEntry)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    GOOGLE_DCHECK(_impl_.request_ != nullptr);
+    _impl_.request_->Clear();
+  }
+  _impl_.msg_num_ = uint64_t{0u};
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* EpochChangeStateTransferReply_MsgEntry::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required uint64 msg_num = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_msg_num(&has_bits);
+          _impl_.msg_num_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required .dsnet.transaction.eris.proto.RequestMessage request = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr = ctx->ParseMessage(_internal_mutable_request(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* EpochChangeStateTransferReply_MsgEntry::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:dsnet.transaction.eris.proto.EpochChangeStateTransferReply.MsgEntry)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required uint64 msg_num = 1;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(1, this->_internal_msg_num(), target);
+  }
+
+  // required .dsnet.transaction.eris.proto.RequestMessage request = 2;
+  if (cached_has_bits & 0x00000001u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(2, _Internal::request(this),
+        _Internal::request(this).GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:dsnet.transaction.eris.proto.EpochChangeStateTransferReply.MsgEntry)
+  return target;
+}
+
+size_t EpochChangeStateTransferReply_MsgEntry::RequiredFieldsByteSizeFallback() const {
+// @@protoc_insertion_point(required_fields_byte_size_fallback_start:dsnet.transaction.eris.proto.EpochChangeStateTransferReply.MsgEntry)
+  size_t total_size = 0;
+
+  if (_internal_has_request()) {
+    // required .dsnet.transaction.eris.proto.RequestMessage request = 2;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.request_);
+  }
+
+  if (_internal_has_msg_num()) {
+    // required uint64 msg_num = 1;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_msg_num());
+  }
+
+  return total_size;
+}
+size_t EpochChangeStateTransferReply_MsgEntry::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:dsnet.transaction.eris.proto.EpochChangeStateTransferReply.MsgEntry)
+  size_t total_size = 0;
+
+  if (((_impl_._has_bits_[0] & 0x00000003) ^ 0x00000003) == 0) {  // All required fields are present.
+    // required .dsnet.transaction.eris.proto.RequestMessage request = 2;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.request_);
+
+    // required uint64 msg_num = 1;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_msg_num());
+
+  } else {
+    total_size += RequiredFieldsByteSizeFallback();
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData EpochChangeStateTransferReply_MsgEntry::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    EpochChangeStateTransferReply_MsgEntry::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*EpochChangeStateTransferReply_MsgEntry::GetClassData() const { return &_class_data_; }
+
+
+void EpochChangeStateTransferReply_MsgEntry::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<EpochChangeStateTransferReply_MsgEntry*>(&to_msg);
+  auto& from = static_cast<const EpochChangeStateTransferReply_MsgEntry&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:dsnet.transaction.eris.proto.EpochChangeStateTransferReply.MsgEntry)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_mutable_request()->::dsnet::transaction::eris::proto::RequestMessage::MergeFrom(
+          from._internal_request());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.msg_num_ = from._impl_.msg_num_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void EpochChangeStateTransferReply_MsgEntry::CopyFrom(const EpochChangeStateTransferReply_MsgEntry& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:dsnet.transaction.eris.proto.EpochChangeStateTransferReply.MsgEntry)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool EpochChangeStateTransferReply_MsgEntry::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  if (_internal_has_request()) {
+    if (!_impl_.request_->IsInitialized()) return false;
+  }
+  return true;
+}
+
+void EpochChangeStateTransferReply_MsgEntry::InternalSwap(EpochChangeStateTransferReply_MsgEntry* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(EpochChangeStateTransferReply_MsgEntry, _impl_.msg_num_)
+      + sizeof(EpochChangeStateTransferReply_MsgEntry::_impl_.msg_num_)
+      - PROTOBUF_FIELD_OFFSET(EpochChangeStateTransferReply_MsgEntry, _impl_.request_)>(
+          reinterpret_cast<char*>(&_impl_.request_),
+          reinterpret_cast<char*>(&other->_impl_.request_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata EpochChangeStateTransferReply_MsgEntry::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_transaction_2feris_2feris_2dproto_2eproto_getter, &descriptor_table_transaction_2feris_2feris_2dproto_2eproto_once,
+      file_level_metadata_transaction_2feris_2feris_2dproto_2eproto[15]);
+}
+
+// ===================================================================
+
+class EpochChangeStateTransferReply::_Internal {
+ public:
+  using HasBits = decltype(std::declval<EpochChangeStateTransferReply>()._impl_._has_bits_);
+  static void set_has_sess_num(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_state_transfer_sess_num(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_shard_num(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000007) ^ 0x00000007) != 0;
+  }
+};
+
+EpochChangeStateTransferReply::EpochChangeStateTransferReply(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:dsnet.transaction.eris.proto.EpochChangeStateTransferReply)
+}
+EpochChangeStateTransferReply::EpochChangeStateTransferReply(const EpochChangeStateTransferReply& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  EpochChangeStateTransferReply* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.entries_){from._impl_.entries_}
+    , decltype(_impl_.sess_num_){}
+    , decltype(_impl_.state_transfer_sess_num_){}
+    , decltype(_impl_.shard_num_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.sess_num_, &from._impl_.sess_num_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.shard_num_) -
+    reinterpret_cast<char*>(&_impl_.sess_num_)) + sizeof(_impl_.shard_num_));
+  // @@protoc_insertion_point(copy_constructor:dsnet.transaction.eris.proto.EpochChangeStateTransferReply)
+}
+
+inline void EpochChangeStateTransferReply::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.entries_){arena}
+    , decltype(_impl_.sess_num_){uint64_t{0u}}
+    , decltype(_impl_.state_transfer_sess_num_){uint64_t{0u}}
+    , decltype(_impl_.shard_num_){0u}
+  };
+}
+
+EpochChangeStateTransferReply::~EpochChangeStateTransferReply() {
+  // @@protoc_insertion_point(destructor:dsnet.transaction.eris.proto.EpochChangeStateTransferReply)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void EpochChangeStateTransferReply::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.entries_.~RepeatedPtrField();
+}
+
+void EpochChangeStateTransferReply::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void EpochChangeStateTransferReply::Clear() {
+// @@protoc_insertion_point(message_clear_start:dsnet.transaction.eris.proto.EpochChangeStateTransferReply)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.entries_.Clear();
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    ::memset(&_impl_.sess_num_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.shard_num_) -
+        reinterpret_cast<char*>(&_impl_.sess_num_)) + sizeof(_impl_.shard_num_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* EpochChangeStateTransferReply::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required uint64 sess_num = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_sess_num(&has_bits);
+          _impl_.sess_num_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required uint64 state_transfer_sess_num = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _Internal::set_has_state_transfer_sess_num(&has_bits);
+          _impl_.state_transfer_sess_num_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required uint32 shard_num = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _Internal::set_has_shard_num(&has_bits);
+          _impl_.shard_num_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .dsnet.transaction.eris.proto.EpochChangeStateTransferReply.MsgEntry entries = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_entries(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<34>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* EpochChangeStateTransferReply::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:dsnet.transaction.eris.proto.EpochChangeStateTransferReply)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required uint64 sess_num = 1;
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(1, this->_internal_sess_num(), target);
+  }
+
+  // required uint64 state_transfer_sess_num = 2;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(2, this->_internal_state_transfer_sess_num(), target);
+  }
+
+  // required uint32 shard_num = 3;
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(3, this->_internal_shard_num(), target);
+  }
+
+  // repeated .dsnet.transaction.eris.proto.EpochChangeStateTransferReply.MsgEntry entries = 4;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_entries_size()); i < n; i++) {
+    const auto& repfield = this->_internal_entries(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(4, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:dsnet.transaction.eris.proto.EpochChangeStateTransferReply)
+  return target;
+}
+
+size_t EpochChangeStateTransferReply::RequiredFieldsByteSizeFallback() const {
+// @@protoc_insertion_point(required_fields_byte_size_fallback_start:dsnet.transaction.eris.proto.EpochChangeStateTransferReply)
+  size_t total_size = 0;
+
+  if (_internal_has_sess_num()) {
+    // required uint64 sess_num = 1;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_sess_num());
+  }
+
+  if (_internal_has_state_transfer_sess_num()) {
+    // required uint64 state_transfer_sess_num = 2;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_state_transfer_sess_num());
+  }
+
+  if (_internal_has_shard_num()) {
+    // required uint32 shard_num = 3;
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_shard_num());
+  }
+
+  return total_size;
+}
+size_t EpochChangeStateTransferReply::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:dsnet.transaction.eris.proto.EpochChangeStateTransferReply)
+  size_t total_size = 0;
+
+  if (((_impl_._has_bits_[0] & 0x00000007) ^ 0x00000007) == 0) {  // All required fields are present.
+    // required uint64 sess_num = 1;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_sess_num());
+
+    // required uint64 state_transfer_sess_num = 2;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_state_transfer_sess_num());
+
+    // required uint32 shard_num = 3;
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_shard_num());
+
+  } else {
+    total_size += RequiredFieldsByteSizeFallback();
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .dsnet.transaction.eris.proto.EpochChangeStateTransferReply.MsgEntry entries = 4;
+  total_size += 1UL * this->_internal_entries_size();
+  for (const auto& msg : this->_impl_.entries_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData EpochChangeStateTransferReply::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    EpochChangeStateTransferReply::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*EpochChangeStateTransferReply::GetClassData() const { return &_class_data_; }
+
+
+void EpochChangeStateTransferReply::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<EpochChangeStateTransferReply*>(&to_msg);
+  auto& from = static_cast<const EpochChangeStateTransferReply&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:dsnet.transaction.eris.proto.EpochChangeStateTransferReply)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.entries_.MergeFrom(from._impl_.entries_);
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_impl_.sess_num_ = from._impl_.sess_num_;
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.state_transfer_sess_num_ = from._impl_.state_transfer_sess_num_;
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.shard_num_ = from._impl_.shard_num_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void EpochChangeStateTransferReply::CopyFrom(const EpochChangeStateTransferReply& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:dsnet.transaction.eris.proto.EpochChangeStateTransferReply)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool EpochChangeStateTransferReply::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  if (!::PROTOBUF_NAMESPACE_ID::internal::AllAreInitialized(_impl_.entries_))
+    return false;
+  return true;
+}
+
+void EpochChangeStateTransferReply::InternalSwap(EpochChangeStateTransferReply* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  _impl_.entries_.InternalSwap(&other->_impl_.entries_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(EpochChangeStateTransferReply, _impl_.shard_num_)
+      + sizeof(EpochChangeStateTransferReply::_impl_.shard_num_)
+      - PROTOBUF_FIELD_OFFSET(EpochChangeStateTransferReply, _impl_.sess_num_)>(
+          reinterpret_cast<char*>(&_impl_.sess_num_),
+          reinterpret_cast<char*>(&other->_impl_.sess_num_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata EpochChangeStateTransferReply::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_transaction_2feris_2feris_2dproto_2eproto_getter, &descriptor_table_transaction_2feris_2feris_2dproto_2eproto_once,
+      file_level_metadata_transaction_2feris_2feris_2dproto_2eproto[16]);
+}
+
+// ===================================================================
+
+class ToServerMessage::_Internal {
+ public:
+  static const ::dsnet::transaction::eris::proto::RequestMessage& request(const ToServerMessage* msg);
+  static const ::dsnet::transaction::eris::proto::GapRequestMessage& gap_request(const ToServerMessage* msg);
+  static const ::dsnet::transaction::eris::proto::GapReplyMessage& gap_reply(const ToServerMessage* msg);
+  static const ::dsnet::transaction::eris::proto::FCToErisMessage& fc(const ToServerMessage* msg);
+  static const ::dsnet::transaction::eris::proto::SyncPrepareMessage& sync_prepare(const ToServerMessage* msg);
+  static const ::dsnet::transaction::eris::proto::ViewChangeRequestMessage& view_change_request(const ToServerMessage* msg);
+  static const ::dsnet::transaction::eris::proto::ViewChangeMessage& view_change(const ToServerMessage* msg);
+  static const ::dsnet::transaction::eris::proto::StartViewMessage& start_view(const ToServerMessage* msg);
+  static const ::dsnet::transaction::eris::proto::StateTransferRequestMessage& state_transfer_request(const ToServerMessage* msg);
+  static const ::dsnet::transaction::eris::proto::StateTransferReplyMessage& state_transfer_reply(const ToServerMessage* msg);
+  static const ::dsnet::transaction::eris::proto::EpochChangeStateTransferRequest& epoch_change_state_transfer_request(const ToServerMessage* msg);
+  static const ::dsnet::transaction::eris::proto::EpochChangeStateTransferReply& epoch_change_state_transfer_reply(const ToServerMessage* msg);
+};
+
+const ::dsnet::transaction::eris::proto::RequestMessage&
+ToServerMessage::_Internal::request(const ToServerMessage* msg) {
+  return *msg->_impl_.msg_.request_;
+}
+const ::dsnet::transaction::eris::proto::GapRequestMessage&
+ToServerMessage::_Internal::gap_request(const ToServerMessage* msg) {
+  return *msg->_impl_.msg_.gap_request_;
+}
+const ::dsnet::transaction::eris::proto::GapReplyMessage&
+ToServerMessage::_Internal::gap_reply(const ToServerMessage* msg) {
+  return *msg->_impl_.msg_.gap_reply_;
+}
+const ::dsnet::transaction::eris::proto::FCToErisMessage&
+ToServerMessage::_Internal::fc(const ToServerMessage* msg) {
+  return *msg->_impl_.msg_.fc_;
+}
+const ::dsnet::transaction::eris::proto::SyncPrepareMessage&
+ToServerMessage::_Internal::sync_prepare(const ToServerMessage* msg) {
+  return *msg->_impl_.msg_.sync_prepare_;
+}
+const ::dsnet::transaction::eris::proto::ViewChangeRequestMessage&
+ToServerMessage::_Internal::view_change_request(const ToServerMessage* msg) {
+  return *msg->_impl_.msg_.view_change_request_;
+}
+const ::dsnet::transaction::eris::proto::ViewChangeMessage&
+ToServerMessage::_Internal::view_change(const ToServerMessage* msg) {
+  return *msg->_impl_.msg_.view_change_;
+}
+const ::dsnet::transaction::eris::proto::StartViewMessage&
+ToServerMessage::_Internal::start_view(const ToServerMessage* msg) {
+  return *msg->_impl_.msg_.start_view_;
+}
+const ::dsnet::transaction::eris::proto::StateTransferRequestMessage&
+ToServerMessage::_Internal::state_transfer_request(const ToServerMessage* msg) {
+  return *msg->_impl_.msg_.state_transfer_request_;
+}
+const ::dsnet::transaction::eris::proto::StateTransferReplyMessage&
+ToServerMessage::_Internal::state_transfer_reply(const ToServerMessage* msg) {
+  return *msg->_impl_.msg_.state_transfer_reply_;
+}
+const ::dsnet::transaction::eris::proto::EpochChangeStateTransferRequest&
+ToServerMessage::_Internal::epoch_change_state_transfer_request(const ToServerMessage* msg) {
+  return *msg->_impl_.msg_.epoch_change_state_transfer_request_;
+}
+const ::dsnet::transaction::eris::proto::EpochChangeStateTransferReply&
+ToServerMessage::_Internal::epoch_change_state_transfer_reply(const ToServerMessage* msg) {
+  return *msg->_impl_.msg_.epoch_change_state_transfer_reply_;
+}
+void ToServerMessage::set_allocated_request(::dsnet::transaction::eris::proto::RequestMessage* request) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  clear_msg();
+  if (request) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(request);
+    if (message_arena != submessage_arena) {
+      request = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, request, submessage_arena);
+    }
+    set_has_request();
+    _impl_.msg_.request_ = request;
+  }
+  // @@protoc_insertion_point(field_set_allocated:dsnet.transaction.eris.proto.ToServerMessage.request)
+}
+void ToServerMessage::set_allocated_gap_request(::dsnet::transaction::eris::proto::GapRequestMessage* gap_request) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  clear_msg();
+  if (gap_request) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(gap_request);
+    if (message_arena != submessage_arena) {
+      gap_request = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, gap_request, submessage_arena);
+    }
+    set_has_gap_request();
+    _impl_.msg_.gap_request_ = gap_request;
+  }
+  // @@protoc_insertion_point(field_set_allocated:dsnet.transaction.eris.proto.ToServerMessage.gap_request)
+}
+void ToServerMessage::set_allocated_gap_reply(::dsnet::transaction::eris::proto::GapReplyMessage* gap_reply) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  clear_msg();
+  if (gap_reply) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(gap_reply);
+    if (message_arena != submessage_arena) {
+      gap_reply = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, gap_reply, submessage_arena);
+    }
+    set_has_gap_reply();
+    _impl_.msg_.gap_reply_ = gap_reply;
+  }
+  // @@protoc_insertion_point(field_set_allocated:dsnet.transaction.eris.proto.ToServerMessage.gap_reply)
+}
+void ToServerMessage::set_allocated_fc(::dsnet::transaction::eris::proto::FCToErisMessage* fc) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  clear_msg();
+  if (fc) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(fc);
+    if (message_arena != submessage_arena) {
+      fc = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, fc, submessage_arena);
+    }
+    set_has_fc();
+    _impl_.msg_.fc_ = fc;
+  }
+  // @@protoc_insertion_point(field_set_allocated:dsnet.transaction.eris.proto.ToServerMessage.fc)
+}
+void ToServerMessage::set_allocated_sync_prepare(::dsnet::transaction::eris::proto::SyncPrepareMessage* sync_prepare) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  clear_msg();
+  if (sync_prepare) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(sync_prepare);
+    if (message_arena != submessage_arena) {
+      sync_prepare = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, sync_prepare, submessage_arena);
+    }
+    set_has_sync_prepare();
+    _impl_.msg_.sync_prepare_ = sync_prepare;
+  }
+  // @@protoc_insertion_point(field_set_allocated:dsnet.transaction.eris.proto.ToServerMessage.sync_prepare)
+}
+void ToServerMessage::set_allocated_view_change_request(::dsnet::transaction::eris::proto::ViewChangeRequestMessage* view_change_request) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  clear_msg();
+  if (view_change_request) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(view_change_request);
+    if (message_arena != submessage_arena) {
+      view_change_request = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, view_change_request, submessage_arena);
+    }
+    set_has_view_change_request();
+    _impl_.msg_.view_change_request_ = view_change_request;
+  }
+  // @@protoc_insertion_point(field_set_allocated:dsnet.transaction.eris.proto.ToServerMessage.view_change_request)
+}
+void ToServerMessage::set_allocated_view_change(::dsnet::transaction::eris::proto::ViewChangeMessage* view_change) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  clear_msg();
+  if (view_change) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(view_change);
+    if (message_arena != submessage_arena) {
+      view_change = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, view_change, submessage_arena);
+    }
+    set_has_view_change();
+    _impl_.msg_.view_change_ = view_change;
+  }
+  // @@protoc_insertion_point(field_set_allocated:dsnet.transaction.eris.proto.ToServerMessage.view_change)
+}
+void ToServerMessage::set_allocated_start_view(::dsnet::transaction::eris::proto::StartViewMessage* start_view) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  clear_msg();
+  if (start_view) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(start_view);
+    if (message_arena != submessage_arena) {
+      start_view = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, start_view, submessage_arena);
+    }
+    set_has_start_view();
+    _impl_.msg_.start_view_ = start_view;
+  }
+  // @@protoc_insertion_point(field_set_allocated:dsnet.transaction.eris.proto.ToServerMessage.start_view)
+}
+void ToServerMessage::set_allocated_state_transfer_request(::dsnet::transaction::eris::proto::StateTransferRequestMessage* state_transfer_request) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  clear_msg();
+  if (state_transfer_request) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(state_transfer_request);
+    if (message_arena != submessage_arena) {
+      state_transfer_request = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, state_transfer_request, submessage_arena);
+    }
+    set_has_state_transfer_request();
+    _impl_.msg_.state_transfer_request_ = state_transfer_request;
+  }
+  // @@protoc_insertion_point(field_set_allocated:dsnet.transaction.eris.proto.ToServerMessage.state_transfer_request)
+}
+void ToServerMessage::set_allocated_state_transfer_reply(::dsnet::transaction::eris::proto::StateTransferReplyMessage* state_transfer_reply) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  clear_msg();
+  if (state_transfer_reply) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(state_transfer_reply);
+    if (message_arena != submessage_arena) {
+      state_transfer_reply = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, state_transfer_reply, submessage_arena);
+    }
+    set_has_state_transfer_reply();
+    _impl_.msg_.state_transfer_reply_ = state_transfer_reply;
+  }
+  // @@protoc_insertion_point(field_set_allocated:dsnet.transaction.eris.proto.ToServerMessage.state_transfer_reply)
+}
+void ToServerMessage::set_allocated_epoch_change_state_transfer_request(::dsnet::transaction::eris::proto::EpochChangeStateTransferRequest* epoch_change_state_transfer_request) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  clear_msg();
+  if (epoch_change_state_transfer_request) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(epoch_change_state_transfer_request);
+    if (message_arena != submessage_arena) {
+      epoch_change_state_transfer_request = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, epoch_change_state_transfer_request, submessage_arena);
+    }
+    set_has_epoch_change_state_transfer_request();
+    _impl_.msg_.epoch_change_state_transfer_request_ = epoch_change_state_transfer_request;
+  }
+  // @@protoc_insertion_point(field_set_allocated:dsnet.transaction.eris.proto.ToServerMessage.epoch_change_state_transfer_request)
+}
+void ToServerMessage::set_allocated_epoch_change_state_transfer_reply(::dsnet::transaction::eris::proto::EpochChangeStateTransferReply* epoch_change_state_transfer_reply) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  clear_msg();
+  if (epoch_change_state_transfer_reply) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(epoch_change_state_transfer_reply);
+    if (message_arena != submessage_arena) {
+      epoch_change_state_transfer_reply = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, epoch_change_state_transfer_reply, submessage_arena);
+    }
+    set_has_epoch_change_state_transfer_reply();
+    _impl_.msg_.epoch_change_state_transfer_reply_ = epoch_change_state_transfer_reply;
+  }
+  // @@protoc_insertion_point(field_set_allocated:dsnet.transaction.eris.proto.ToServerMessage.epoch_change_state_transfer_reply)
+}
+ToServerMessage::ToServerMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:dsnet.transaction.eris.proto.ToServerMessage)
+}
+ToServerMessage::ToServerMessage(const ToServerMessage& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  ToServerMessage* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.msg_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , /*decltype(_impl_._oneof_case_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  clear_has_msg();
+  switch (from.msg_case()) {
+    case kRequest: {
+      _this->_internal_mutable_request()->::dsnet::transaction::eris::proto::RequestMessage::MergeFrom(
+          from._internal_request());
+      break;
+    }
+    case kGapRequest: {
+      _this->_internal_mutable_gap_request()->::dsnet::transaction::eris::proto::GapRequestMessage::MergeFrom(
+          from._internal_gap_request());
+      break;
+    }
+    case kGapReply: {
+      _this->_internal_mutable_gap_reply()->::dsnet::transaction::eris::proto::GapReplyMessage::MergeFrom(
+          from._internal_gap_reply());
+      break;
+    }
+    case kFc: {
+      _this->_internal_mutable_fc()->::dsnet::transaction::eris::proto::FCToErisMessage::MergeFrom(
+          from._internal_fc());
+      break;
+    }
+    case kSyncPrepare: {
+      _this->_internal_mutable_sync_prepare()->::dsnet::transaction::eris::proto::SyncPrepareMessage::MergeFrom(
+          from._internal_sync_prepare());
+      break;
+    }
+    case kViewChangeRequest: {
+      _this->_internal_mutable_view_change_request()->::dsnet::transaction::eris::proto::ViewChangeRequestMessage::MergeFrom(
+          from._internal_view_change_request());
+      break;
+    }
+    case kViewChange: {
+      _this->_internal_mutable_view_change()->::dsnet::transaction::eris::proto::ViewChangeMessage::MergeFrom(
+          from._internal_view_change());
+      break;
+    }
+    case kStartView: {
+      _this->_internal_mutable_start_view()->::dsnet::transaction::eris::proto::StartViewMessage::MergeFrom(
+          from._internal_start_view());
+      break;
+    }
+    case kStateTransferRequest: {
+      _this->_internal_mutable_state_transfer_request()->::dsnet::transaction::eris::proto::StateTransferRequestMessage::MergeFrom(
+          from._internal_state_transfer_request());
+      break;
+    }
+    case kStateTransferReply: {
+      _this->_internal_mutable_state_transfer_reply()->::dsnet::transaction::eris::proto::StateTransferReplyMessage::MergeFrom(
+          from._internal_state_transfer_reply());
+      break;
+    }
+    case kEpochChangeStateTransferRequest: {
+      _this->_internal_mutable_epoch_change_state_transfer_request()->::dsnet::transaction::eris::proto::EpochChangeStateTransferRequest::MergeFrom(
+          from._internal_epoch_change_state_transfer_request());
+      break;
+    }
+    case kEpochChangeStateTransferReply: {
+      _this->_internal_mutable_epoch_change_state_transfer_reply()->::dsnet::transaction::eris::proto::EpochChangeStateTransferReply::MergeFrom(
+          from._internal_epoch_change_state_transfer_reply());
+      break;
+    }
+    case MSG_NOT_SET: {
+      break;
+    }
+  }
+  // @@protoc_insertion_point(copy_constructor:dsnet.transaction.eris.proto.ToServerMessage)
+}
+
+inline void ToServerMessage::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.msg_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , /*decltype(_impl_._oneof_case_)*/{}
+  };
+  clear_has_msg();
+}
+
+ToServerMessage::~ToServerMessage() {
+  // @@protoc_insertion_point(destructor:dsnet.transaction.eris.proto.ToServerMessage)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void ToServerMessage::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  if (has_msg()) {
+    clear_msg();
+  }
+}
+
+void ToServerMessage::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void ToServerMessage::clear_msg() {
+// @@protoc_insertion_point(one_of_clear_start:dsnet.transaction.eris.proto.ToServerMessage)
+  switch (msg_case()) {
+    case kRequest: {
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.msg_.request_;
+      }
+      break;
+    }
+    case kGapRequest: {
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.msg_.gap_request_;
+      }
+      break;
+    }
+    case kGapReply: {
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.msg_.gap_reply_;
+      }
+      break;
+    }
+    case kFc: {
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.msg_.fc_;
+      }
+      break;
+    }
+    case kSyncPrepare: {
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.msg_.sync_prepare_;
+      }
+      break;
+    }
+    case kViewChangeRequest: {
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.msg_.view_change_request_;
+      }
+      break;
+    }
+    case kViewChange: {
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.msg_.view_change_;
+      }
+      break;
+    }
+    case kStartView: {
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.msg_.start_view_;
+      }
+      break;
+    }
+    case kStateTransferRequest: {
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.msg_.state_transfer_request_;
+      }
+      break;
+    }
+    case kStateTransferReply: {
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.msg_.state_transfer_reply_;
+      }
+      break;
+    }
+    case kEpochChangeStateTransferRequest: {
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.msg_.epoch_change_state_transfer_request_;
+      }
+      break;
+    }
+    case kEpochChangeStateTransferReply: {
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.msg_.epoch_change_state_transfer_reply_;
+      }
+      break;
+    }
+    case MSG_NOT_SET: {
+      break;
+    }
+  }
+  _impl_._oneof_case_[0] = MSG_NOT_SET;
+}
+
+
+void ToServerMessage::Clear() {
+// @@protoc_insertion_point(message_clear_start:dsnet.transaction.eris.proto.ToServerMessage)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  clear_msg();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* ToServerMessage::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // .dsnet.transaction.eris.proto.RequestMessage request = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr = ctx->ParseMessage(_internal_mutable_request(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .dsnet.transaction.eris.proto.GapRequestMessage gap_request = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr = ctx->ParseMessage(_internal_mutable_gap_request(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .dsnet.transaction.eris.proto.GapReplyMessage gap_reply = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          ptr = ctx->ParseMessage(_internal_mutable_gap_reply(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .dsnet.transaction.eris.proto.FCToErisMessage fc = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          ptr = ctx->ParseMessage(_internal_mutable_fc(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .dsnet.transaction.eris.proto.SyncPrepareMessage sync_prepare = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 42)) {
+          ptr = ctx->ParseMessage(_internal_mutable_sync_prepare(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .dsnet.transaction.eris.proto.ViewChangeRequestMessage view_change_request = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 50)) {
+          ptr = ctx->ParseMessage(_internal_mutable_view_change_request(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .dsnet.transaction.eris.proto.ViewChangeMessage view_change = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 58)) {
+          ptr = ctx->ParseMessage(_internal_mutable_view_change(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .dsnet.transaction.eris.proto.StartViewMessage start_view = 8;
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 66)) {
+          ptr = ctx->ParseMessage(_internal_mutable_start_view(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .dsnet.transaction.eris.proto.StateTransferRequestMessage state_transfer_request = 9;
+      case 9:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 74)) {
+          ptr = ctx->ParseMessage(_internal_mutable_state_transfer_request(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .dsnet.transaction.eris.proto.StateTransferReplyMessage state_transfer_reply = 10;
+      case 10:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 82)) {
+          ptr = ctx->ParseMessage(_internal_mutable_state_transfer_reply(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .dsnet.transaction.eris.proto.EpochChangeStateTransferRequest epoch_change_state_transfer_request = 11;
+      case 11:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 90)) {
+          ptr = ctx->ParseMessage(_internal_mutable_epoch_change_state_transfer_request(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .dsnet.transaction.eris.proto.EpochChangeStateTransferReply epoch_change_state_transfer_reply = 12;
+      case 12:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 98)) {
+          ptr = ctx->ParseMessage(_internal_mutable_epoch_change_state_transfer_reply(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* ToServerMessage::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:dsnet.transaction.eris.proto.ToServerMessage)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  switch (msg_case()) {
+    case kRequest: {
+      target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(1, _Internal::request(this),
+          _Internal::request(this).GetCachedSize(), target, stream);
+      break;
+    }
+    case kGapRequest: {
+      target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(2, _Internal::gap_request(this),
+          _Internal::gap_request(this).GetCachedSize(), target, stream);
+      break;
+    }
+    case kGapReply: {
+      target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(3, _Internal::gap_reply(this),
+          _Internal::gap_reply(this).GetCachedSize(), target, stream);
+      break;
+    }
+    case kFc: {
+      target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(4, _Internal::fc(this),
+          _Internal::fc(this).GetCachedSize(), target, stream);
+      break;
+    }
+    case kSyncPrepare: {
+      target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(5, _Internal::sync_prepare(this),
+          _Internal::sync_prepare(this).GetCachedSize(), target, stream);
+      break;
+    }
+    case kViewChangeRequest: {
+      target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(6, _Internal::view_change_request(this),
+          _Internal::view_change_request(this).GetCachedSize(), target, stream);
+      break;
+    }
+    case kViewChange: {
+      target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(7, _Internal::view_change(this),
+          _Internal::view_change(this).GetCachedSize(), target, stream);
+      break;
+    }
+    case kStartView: {
+      target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(8, _Internal::start_view(this),
+          _Internal::start_view(this).GetCachedSize(), target, stream);
+      break;
+    }
+    case kStateTransferRequest: {
+      target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(9, _Internal::state_transfer_request(this),
+          _Internal::state_transfer_request(this).GetCachedSize(), target, stream);
+      break;
+    }
+    case kStateTransferReply: {
+      target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(10, _Internal::state_transfer_reply(this),
+          _Internal::state_transfer_reply(this).GetCachedSize(), target, stream);
+      break;
+    }
+    case kEpochChangeStateTransferRequest: {
+      target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(11, _Internal::epoch_change_state_transfer_request(this),
+          _Internal::epoch_change_state_transfer_request(this).GetCachedSize(), target, stream);
+      break;
+    }
+    case kEpochChangeStateTransferReply: {
+      target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(12, _Internal::epoch_change_state_transfer_reply(this),
+          _Internal::epoch_change_state_transfer_reply(this).GetCachedSize(), target, stream);
+      break;
+    }
+    default: ;
+  }
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:dsnet.transaction.eris.proto.ToServerMessage)
+  return target;
+}
+
+size_t ToServerMessage::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:dsnet.transaction.eris.proto.ToServerMessage)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  switch (msg_case()) {
+    // .dsnet.transaction.eris.proto.RequestMessage request = 1;
+    case kRequest: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.msg_.request_);
+      break;
+    }
+    // .dsnet.transaction.eris.proto.GapRequestMessage gap_request = 2;
+    case kGapRequest: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.msg_.gap_request_);
+      break;
+    }
+    // .dsnet.transaction.eris.proto.GapReplyMessage gap_reply = 3;
+    case kGapReply: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.msg_.gap_reply_);
+      break;
+    }
+    // .dsnet.transaction.eris.proto.FCToErisMessage fc = 4;
+    case kFc: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.msg_.fc_);
+      break;
+    }
+    // .dsnet.transaction.eris.proto.SyncPrepareMessage sync_prepare = 5;
+    case kSyncPrepare: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.msg_.sync_prepare_);
+      break;
+    }
+    // .dsnet.transaction.eris.proto.ViewChangeRequestMessage view_change_request = 6;
+    case kViewChangeRequest: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.msg_.view_change_request_);
+      break;
+    }
+    // .dsnet.transaction.eris.proto.ViewChangeMessage view_change = 7;
+    case kViewChange: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.msg_.view_change_);
+      break;
+    }
+    // .dsnet.transaction.eris.proto.StartViewMessage start_view = 8;
+    case kStartView: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.msg_.start_view_);
+      break;
+    }
+    // .dsnet.transaction.eris.proto.StateTransferRequestMessage state_transfer_request = 9;
+    case kStateTransferRequest: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.msg_.state_transfer_request_);
+      break;
+    }
+    // .dsnet.transaction.eris.proto.StateTransferReplyMessage state_transfer_reply = 10;
+    case kStateTransferReply: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.msg_.state_transfer_reply_);
+      break;
+    }
+    // .dsnet.transaction.eris.proto.EpochChangeStateTransferRequest epoch_change_state_transfer_request = 11;
+    case kEpochChangeStateTransferRequest: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.msg_.epoch_change_state_transfer_request_);
+      break;
+    }
+    // .dsnet.transaction.eris.proto.EpochChangeStateTransferReply epoch_change_state_transfer_reply = 12;
+    case kEpochChangeStateTransferReply: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.msg_.epoch_change_state_transfer_reply_);
+      break;
+    }
+    case MSG_NOT_SET: {
+      break;
+    }
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ToServerMessage::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    ToServerMessage::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ToServerMessage::GetClassData() const { return &_class_data_; }
+
+
+void ToServerMessage::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<ToServerMessage*>(&to_msg);
+  auto& from = static_cast<const ToServerMessage&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:dsnet.transaction.eris.proto.ToServerMessage)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  switch (from.msg_case()) {
+    case kRequest: {
+      _this->_internal_mutable_request()->::dsnet::transaction::eris::proto::RequestMessage::MergeFrom(
+          from._internal_request());
+      break;
+    }
+    case kGapRequest: {
+      _this->_internal_mutable_gap_request()->::dsnet::transaction::eris::proto::GapRequestMessage::MergeFrom(
+          from._internal_gap_request());
+      break;
+    }
+    case kGapReply: {
+      _this->_internal_mutable_gap_reply()->::dsnet::transaction::eris::proto::GapReplyMessage::MergeFrom(
+          from._internal_gap_reply());
+      break;
+    }
+    case kFc: {
+      _this->_internal_mutable_fc()->::dsnet::transaction::eris::proto::FCToErisMessage::MergeFrom(
+          from._internal_fc());
+      break;
+    }
+    case kSyncPrepare: {
+      _this->_internal_mutable_sync_prepare()->::dsnet::transaction::eris::proto::SyncPrepareMessage::MergeFrom(
+          from._internal_sync_prepare());
+      break;
+    }
+    case kViewChangeRequest: {
+      _this->_internal_mutable_view_change_request()->::dsnet::transaction::eris::proto::ViewChangeRequestMessage::MergeFrom(
+          from._internal_view_change_request());
+      break;
+    }
+    case kViewChange: {
+      _this->_internal_mutable_view_change()->::dsnet::transaction::eris::proto::ViewChangeMessage::MergeFrom(
+          from._internal_view_change());
+      break;
+    }
+    case kStartView: {
+      _this->_internal_mutable_start_view()->::dsnet::transaction::eris::proto::StartViewMessage::MergeFrom(
+          from._internal_start_view());
+      break;
+    }
+    case kStateTransferRequest: {
+      _this->_internal_mutable_state_transfer_request()->::dsnet::transaction::eris::proto::StateTransferRequestMessage::MergeFrom(
+          from._internal_state_transfer_request());
+      break;
+    }
+    case kStateTransferReply: {
+      _this->_internal_mutable_state_transfer_reply()->::dsnet::transaction::eris::proto::StateTransferReplyMessage::MergeFrom(
+          from._internal_state_transfer_reply());
+      break;
+    }
+    case kEpochChangeStateTransferRequest: {
+      _this->_internal_mutable_epoch_change_state_transfer_request()->::dsnet::transaction::eris::proto::EpochChangeStateTransferRequest::MergeFrom(
+          from._internal_epoch_change_state_transfer_request());
+      break;
+    }
+    case kEpochChangeStateTransferReply: {
+      _this->_internal_mutable_epoch_change_state_transfer_reply()->::dsnet::transaction::eris::proto::EpochChangeStateTransferReply::MergeFrom(
+          from._internal_epoch_change_state_transfer_reply());
+      break;
+    }
+    case MSG_NOT_SET: {
+      break;
+    }
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void ToServerMessage::CopyFrom(const ToServerMessage& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:dsnet.transaction.eris.proto.ToServerMessage)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool ToServerMessage::IsInitialized() const {
+  switch (msg_case()) {
+    case kRequest: {
+      if (_internal_has_request()) {
+        if (!_impl_.msg_.request_->IsInitialized()) return false;
+      }
+      break;
+    }
+    case kGapRequest: {
+      if (_internal_has_gap_request()) {
+        if (!_impl_.msg_.gap_request_->IsInitialized()) return false;
+      }
+      break;
+    }
+    case kGapReply: {
+      if (_internal_has_gap_reply()) {
+        if (!_impl_.msg_.gap_reply_->IsInitialized()) return false;
+      }
+      break;
+    }
+    case kFc: {
+      if (_internal_has_fc()) {
+        if (!_impl_.msg_.fc_->IsInitialized()) return false;
+      }
+      break;
+    }
+    case kSyncPrepare: {
+      if (_internal_has_sync_prepare()) {
+        if (!_impl_.msg_.sync_prepare_->IsInitialized()) return false;
+      }
+      break;
+    }
+    case kViewChangeRequest: {
+      if (_internal_has_view_change_request()) {
+        if (!_impl_.msg_.view_change_request_->IsInitialized()) return false;
+      }
+      break;
+    }
+    case kViewChange: {
+      if (_internal_has_view_change()) {
+        if (!_impl_.msg_.view_change_->IsInitialized()) return false;
+      }
+      break;
+    }
+    case kStartView: {
+      if (_internal_has_start_view()) {
+        if (!_impl_.msg_.start_view_->IsInitialized()) return false;
+      }
+      break;
+    }
+    case kStateTransferRequest: {
+      if (_internal_has_state_transfer_request()) {
+        if (!_impl_.msg_.state_transfer_request_->IsInitialized()) return false;
+      }
+      break;
+    }
+    case kStateTransferReply: {
+      if (_internal_has_state_transfer_reply()) {
+        if (!_impl_.msg_.state_transfer_reply_->IsInitialized()) return false;
+      }
+      break;
+    }
+    case kEpochChangeStateTransferRequest: {
+      if (_internal_has_epoch_change_state_transfer_request()) {
+        if (!_impl_.msg_.epoch_change_state_transfer_request_->IsInitialized()) return false;
+      }
+      break;
+    }
+    case kEpochChangeStateTransferReply: {
+      if (_internal_has_epoch_change_state_transfer_reply()) {
+        if (!_impl_.msg_.epoch_change_state_transfer_reply_->IsInitialized()) return false;
+      }
+      break;
+    }
+    case MSG_NOT_SET: {
+      break;
+    }
+  }
+  return true;
+}
+
+void ToServerMessage::InternalSwap(ToServerMessage* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_.msg_, other->_impl_.msg_);
+  swap(_impl_._oneof_case_[0], other->_impl_._oneof_case_[0]);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata ToServerMessage::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_transaction_2feris_2feris_2dproto_2eproto_getter, &descriptor_table_transaction_2feris_2feris_2dproto_2eproto_once,
+      file_level_metadata_transaction_2feris_2feris_2dproto_2eproto[17]);
+}
+
+// ===================================================================
+
+class TxnInfoRequest::_Internal {
+ public:
+  using HasBits = decltype(std::declval<TxnInfoRequest>()._impl_._has_bits_);
+  static const ::dsnet::transaction::eris::proto::Stamp& txn_num(const TxnInfoRequest* msg);
+  static void set_has_txn_num(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000001) ^ 0x00000001) != 0;
+  }
+};
+
+const ::dsnet::transaction::eris::proto::Stamp&
+TxnInfoRequest::_Internal::txn_num(const TxnInfoRequest* msg) {
+  return *msg->_impl_.txn_num_;
+}
+TxnInfoRequest::TxnInfoRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:dsnet.transaction.eris.proto.TxnInfoRequest)
+}
+TxnInfoRequest::TxnInfoRequest(const TxnInfoRequest& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  TxnInfoRequest* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.txn_num_){nullptr}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  if (from._internal_has_txn_num()) {
+    _this->_impl_.txn_num_ = new ::dsnet::transaction::eris::proto::Stamp(*from._impl_.txn_num_);
+  }
+  // @@protoc_insertion_point(copy_constructor:dsnet.transaction.eris.proto.TxnInfoRequest)
+}
+
+inline void TxnInfoRequest::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.txn_num_){nullptr}
+  };
+}
+
+TxnInfoRequest::~TxnInfoRequest() {
+  // @@protoc_insertion_point(destructor:dsnet.transaction.eris.proto.TxnInfoRequest)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void TxnInfoRequest::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  if (this != internal_default_instance()) delete _impl_.txn_num_;
+}
+
+void TxnInfoRequest::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void TxnInfoRequest::Clear() {
+// @@protoc_insertion_point(message_clear_start:dsnet.transaction.eris.proto.TxnInfoRequest)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    GOOGLE_DCHECK(_impl_.txn_num_ != nullptr);
+    _impl_.txn_num_->Clear();
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* TxnInfoRequest::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required .dsnet.transaction.eris.proto.Stamp txn_num = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr = ctx->ParseMessage(_internal_mutable_txn_num(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* TxnInfoRequest::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:dsnet.transaction.eris.proto.TxnInfoRequest)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required .dsnet.transaction.eris.proto.Stamp txn_num = 1;
+  if (cached_has_bits & 0x00000001u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(1, _Internal::txn_num(this),
+        _Internal::txn_num(this).GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:dsnet.transaction.eris.proto.TxnInfoRequest)
+  return target;
+}
+
+size_t TxnInfoRequest::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:dsnet.transaction.eris.proto.TxnInfoRequest)
+  size_t total_size = 0;
+
+  // required .dsnet.transaction.eris.proto.Stamp txn_num = 1;
+  if (_internal_has_txn_num()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.txn_num_);
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData TxnInfoRequest::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    TxnInfoRequest::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*TxnInfoRequest::GetClassData() const { return &_class_data_; }
+
+
+void TxnInfoRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<TxnInfoRequest*>(&to_msg);
+  auto& from = static_cast<const TxnInfoRequest&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:dsnet.transaction.eris.proto.TxnInfoRequest)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_has_txn_num()) {
+    _this->_internal_mutable_txn_num()->::dsnet::transaction::eris::proto::Stamp::MergeFrom(
+        from._internal_txn_num());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void TxnInfoRequest::CopyFrom(const TxnInfoRequest& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:dsnet.transaction.eris.proto.TxnInfoRequest)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool TxnInfoRequest::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  if (_internal_has_txn_num()) {
+    if (!_impl_.txn_num_->IsInitialized()) return false;
+  }
+  return true;
+}
+
+void TxnInfoRequest::InternalSwap(TxnInfoRequest* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  swap(_impl_.txn_num_, other->_impl_.txn_num_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata TxnInfoRequest::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_transaction_2feris_2feris_2dproto_2eproto_getter, &descriptor_table_transaction_2feris_2feris_2dproto_2eproto_once,
+      file_level_metadata_transaction_2feris_2feris_2dproto_2eproto[18]);
+}
+
+// ===================================================================
+
+class TxnReceived::_Internal {
+ public:
+  using HasBits = decltype(std::declval<TxnReceived>()._impl_._has_bits_);
+  static const ::dsnet::transaction::eris::proto::RequestMessage& txn(const TxnReceived* msg);
+  static void set_has_txn(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000001) ^ 0x00000001) != 0;
+  }
+};
+
+const ::dsnet::transaction::eris::proto::RequestMessage&
+TxnReceived::_Internal::txn(const TxnReceived* msg) {
+  return *msg->_impl_.txn_;
+}
+TxnReceived::TxnReceived(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:dsnet.transaction.eris.proto.TxnReceived)
+}
+TxnReceived::TxnReceived(const TxnReceived& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  TxnReceived* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.txn_){nullptr}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  if (from._internal_has_txn()) {
+    _this->_impl_.txn_ = new ::dsnet::transaction::eris::proto::RequestMessage(*from._impl_.txn_);
+  }
+  // @@protoc_insertion_point(copy_constructor:dsnet.transaction.eris.proto.TxnReceived)
+}
+
+inline void TxnReceived::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.txn_){nullptr}
+  };
+}
+
+TxnReceived::~TxnReceived() {
+  // @@protoc_insertion_point(destructor:dsnet.transaction.eris.proto.TxnReceived)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void TxnReceived::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  if (this != internal_default_instance()) delete _impl_.txn_;
+}
+
+void TxnReceived::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void TxnReceived::Clear() {
+// @@protoc_insertion_point(message_clear_start:dsnet.transaction.eris.proto.TxnReceived)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    GOOGLE_DCHECK(_impl_.txn_ != nullptr);
+    _impl_.txn_->Clear();
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* TxnReceived::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required .dsnet.transaction.eris.proto.RequestMessage txn = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr = ctx->ParseMessage(_internal_mutable_txn(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* TxnReceived::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:dsnet.transaction.eris.proto.TxnReceived)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required .dsnet.transaction.eris.proto.RequestMessage txn = 1;
+  if (cached_has_bits & 0x00000001u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(1, _Internal::txn(this),
+        _Internal::txn(this).GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:dsnet.transaction.eris.proto.TxnReceived)
+  return target;
+}
+
+size_t TxnReceived::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:dsnet.transaction.eris.proto.TxnReceived)
+  size_t total_size = 0;
+
+  // required .dsnet.transaction.eris.proto.RequestMessage txn = 1;
+  if (_internal_has_txn()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.txn_);
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData TxnReceived::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    TxnReceived::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*TxnReceived::GetClassData() const { return &_class_data_; }
+
+
+void TxnReceived::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<TxnReceived*>(&to_msg);
+  auto& from = static_cast<const TxnReceived&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:dsnet.transaction.eris.proto.TxnReceived)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_has_txn()) {
+    _this->_internal_mutable_txn()->::dsnet::transaction::eris::proto::RequestMessage::MergeFrom(
+        from._internal_txn());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void TxnReceived::CopyFrom(const TxnReceived& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:dsnet.transaction.eris.proto.TxnReceived)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool TxnReceived::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  if (_internal_has_txn()) {
+    if (!_impl_.txn_->IsInitialized()) return false;
+  }
+  return true;
+}
+
+void TxnReceived::InternalSwap(TxnReceived* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  swap(_impl_.txn_, other->_impl_.txn_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata TxnReceived::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_transaction_2feris_2feris_2dproto_2eproto_getter, &descriptor_table_transaction_2feris_2feris_2dproto_2eproto_once,
+      file_level_metadata_transaction_2feris_2feris_2dproto_2eproto[19]);
+}
+
+// ===================================================================
+
+class TxnTempDropped::_Internal {
+ public:
+  using HasBits = decltype(std::declval<TxnTempDropped>()._impl_._has_bits_);
+  static const ::dsnet::transaction::eris::proto::Stamp& txn_num(const TxnTempDropped* msg);
+  static void set_has_txn_num(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000001) ^ 0x00000001) != 0;
+  }
+};
+
+const ::dsnet::transaction::eris::proto::Stamp&
+TxnTempDropped::_Internal::txn_num(const TxnTempDropped* msg) {
+  return *msg->_impl_.txn_num_;
+}
+TxnTempDropped::TxnTempDropped(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:dsnet.transaction.eris.proto.TxnTempDropped)
+}
+TxnTempDropped::TxnTempDropped(const TxnTempDropped& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  TxnTempDropped* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.txn_num_){nullptr}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  if (from._internal_has_txn_num()) {
+    _this->_impl_.txn_num_ = new ::dsnet::transaction::eris::proto::Stamp(*from._impl_.txn_num_);
+  }
+  // @@protoc_insertion_point(copy_constructor:dsnet.transaction.eris.proto.TxnTempDropped)
+}
+
+inline void TxnTempDropped::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.txn_num_){nullptr}
+  };
+}
+
+TxnTempDropped::~TxnTempDropped() {
+  // @@protoc_insertion_point(destructor:dsnet.transaction.eris.proto.TxnTempDropped)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void TxnTempDropped::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  if (this != internal_default_instance()) delete _impl_.txn_num_;
+}
+
+void TxnTempDropped::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void TxnTempDropped::Clear() {
+// @@protoc_insertion_point(message_clear_start:dsnet.transaction.eris.proto.TxnTempDropped)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    GOOGLE_DCHECK(_impl_.txn_num_ != nullptr);
+    _impl_.txn_num_->Clear();
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* TxnTempDropped::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required .dsnet.transaction.eris.proto.Stamp txn_num = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr = ctx->ParseMessage(_internal_mutable_txn_num(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* TxnTempDropped::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:dsnet.transaction.eris.proto.TxnTempDropped)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required .dsnet.transaction.eris.proto.Stamp txn_num = 1;
+  if (cached_has_bits & 0x00000001u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(1, _Internal::txn_num(this),
+        _Internal::txn_num(this).GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:dsnet.transaction.eris.proto.TxnTempDropped)
+  return target;
+}
+
+size_t TxnTempDropped::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:dsnet.transaction.eris.proto.TxnTempDropped)
+  size_t total_size = 0;
+
+  // required .dsnet.transaction.eris.proto.Stamp txn_num = 1;
+  if (_internal_has_txn_num()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.txn_num_);
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData TxnTempDropped::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    TxnTempDropped::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*TxnTempDropped::GetClassData() const { return &_class_data_; }
+
+
+void TxnTempDropped::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<TxnTempDropped*>(&to_msg);
+  auto& from = static_cast<const TxnTempDropped&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:dsnet.transaction.eris.proto.TxnTempDropped)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_has_txn_num()) {
+    _this->_internal_mutable_txn_num()->::dsnet::transaction::eris::proto::Stamp::MergeFrom(
+        from._internal_txn_num());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void TxnTempDropped::CopyFrom(const TxnTempDropped& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:dsnet.transaction.eris.proto.TxnTempDropped)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool TxnTempDropped::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  if (_internal_has_txn_num()) {
+    if (!_impl_.txn_num_->IsInitialized()) return false;
+  }
+  return true;
+}
+
+void TxnTempDropped::InternalSwap(TxnTempDropped* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  swap(_impl_.txn_num_, other->_impl_.txn_num_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata TxnTempDropped::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_transaction_2feris_2feris_2dproto_2eproto_getter, &descriptor_table_transaction_2feris_2feris_2dproto_2eproto_once,
+      file_level_metadata_transaction_2feris_2feris_2dproto_2eproto[20]);
+}
+
+// ===================================================================
+
+class EpochChangeReq::_Internal {
+ public:
+  using HasBits = decltype(std::declval<EpochChangeReq>()._impl_._has_bits_);
+  static void set_has_new_epoch_num(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000001) ^ 0x00000001) != 0;
+  }
+};
+
+EpochChangeReq::EpochChangeReq(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:dsnet.transaction.eris.proto.EpochChangeReq)
+}
+EpochChangeReq::EpochChangeReq(const EpochChangeReq& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  EpochChangeReq* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.new_epoch_num_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _this->_impl_.new_epoch_num_ = from._impl_.new_epoch_num_;
+  // @@protoc_insertion_point(copy_constructor:dsnet.transaction.eris.proto.EpochChangeReq)
+}
+
+inline void EpochChangeReq::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.new_epoch_num_){0u}
+  };
+}
+
+EpochChangeReq::~EpochChangeReq() {
+  // @@protoc_insertion_point(destructor:dsnet.transaction.eris.proto.EpochChangeReq)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void EpochChangeReq::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void EpochChangeReq::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void EpochChangeReq::Clear() {
+// @@protoc_insertion_point(message_clear_start:dsnet.transaction.eris.proto.EpochChangeReq)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.new_epoch_num_ = 0u;
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* EpochChangeReq::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required uint32 new_epoch_num = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_new_epoch_num(&has_bits);
+          _impl_.new_epoch_num_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* EpochChangeReq::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:dsnet.transaction.eris.proto.EpochChangeReq)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required uint32 new_epoch_num = 1;
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(1, this->_internal_new_epoch_num(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:dsnet.transaction.eris.proto.EpochChangeReq)
+  return target;
+}
+
+size_t EpochChangeReq::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:dsnet.transaction.eris.proto.EpochChangeReq)
+  size_t total_size = 0;
+
+  // required uint32 new_epoch_num = 1;
+  if (_internal_has_new_epoch_num()) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_new_epoch_num());
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData EpochChangeReq::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    EpochChangeReq::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*EpochChangeReq::GetClassData() const { return &_class_data_; }
+
+
+void EpochChangeReq::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<EpochChangeReq*>(&to_msg);
+  auto& from = static_cast<const EpochChangeReq&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:dsnet.transaction.eris.proto.EpochChangeReq)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_has_new_epoch_num()) {
+    _this->_internal_set_new_epoch_num(from._internal_new_epoch_num());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void EpochChangeReq::CopyFrom(const EpochChangeReq& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:dsnet.transaction.eris.proto.EpochChangeReq)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool EpochChangeReq::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  return true;
+}
+
+void EpochChangeReq::InternalSwap(EpochChangeReq* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  swap(_impl_.new_epoch_num_, other->_impl_.new_epoch_num_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata EpochChangeReq::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_transaction_2feris_2feris_2dproto_2eproto_getter, &descriptor_table_transaction_2feris_2feris_2dproto_2eproto_once,
+      file_level_metadata_transaction_2feris_2feris_2dproto_2eproto[21]);
+}
+
+// ===================================================================
+
+class EpochChangeAck_LogInfoPiece::_Internal {
+ public:
+  using HasBits = decltype(std::declval<EpochChangeAck_LogInfoPiece>()._impl_._has_bits_);
+  static void set_has_shard_num(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_latest_msg_num(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000003) ^ 0x00000003) != 0;
+  }
+};
+
+EpochChangeAck_LogInfoPiece::EpochChangeAck_LogInfoPiece(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:dsnet.transaction.eris.proto.EpochChangeAck.LogInfoPiece)
+}
+EpochChangeAck_LogInfoPiece::EpochChangeAck_LogInfoPiece(const EpochChangeAck_LogInfoPiece& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  EpochChangeAck_LogInfoPiece* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.latest_msg_num_){}
+    , decltype(_impl_.shard_num_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.latest_msg_num_, &from._impl_.latest_msg_num_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.shard_num_) -
+    reinterpret_cast<char*>(&_impl_.latest_msg_num_)) + sizeof(_impl_.shard_num_));
+  // @@protoc_insertion_point(copy_constructor:dsnet.transaction.eris.proto.EpochChangeAck.LogInfoPiece)
+}
+
+inline void EpochChangeAck_LogInfoPiece::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.latest_msg_num_){uint64_t{0u}}
+    , decltype(_impl_.shard_num_){0u}
+  };
+}
+
+EpochChangeAck_LogInfoPiece::~EpochChangeAck_LogInfoPiece() {
+  // @@protoc_insertion_point(destructor:dsnet.transaction.eris.proto.EpochChangeAck.LogInfoPiece)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void EpochChangeAck_LogInfoPiece::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void EpochChangeAck_LogInfoPiece::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void EpochChangeAck_LogInfoPiece::Clear() {
+// @@protoc_insertion_point(message_clear_start:dsnet.transaction.eris.proto.EpochChangeAck.LogInfoPiece)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    ::memset(&_impl_.latest_msg_num_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.shard_num_) -
+        reinterpret_cast<char*>(&_impl_.latest_msg_num_)) + sizeof(_impl_.shard_num_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* EpochChangeAck_LogInfoPiece::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required uint32 shard_num = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_shard_num(&has_bits);
+          _impl_.shard_num_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required uint64 latest_msg_num = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _Internal::set_has_latest_msg_num(&has_bits);
+          _impl_.latest_msg_num_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* EpochChangeAck_LogInfoPiece::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:dsnet.transaction.eris.proto.EpochChangeAck.LogInfoPiece)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required uint32 shard_num = 1;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(1, this->_internal_shard_num(), target);
+  }
+
+  // required uint64 latest_msg_num = 2;
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(2, this->_internal_latest_msg_num(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:dsnet.transaction.eris.proto.EpochChangeAck.LogInfoPiece)
+  return target;
+}
+
+size_t EpochChangeAck_LogInfoPiece::RequiredFieldsByteSizeFallback() const {
+// @@protoc_insertion_point(required_fields_byte_size_fallback_start:dsnet.transaction.eris.proto.EpochChangeAck.LogInfoPiece)
+  size_t total_size = 0;
+
+  if (_internal_has_latest_msg_num()) {
+    // required uint64 latest_msg_num = 2;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_latest_msg_num());
+  }
+
+  if (_internal_has_shard_num()) {
+    // required uint32 shard_num = 1;
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_shard_num());
+  }
+
+  return total_size;
+}
+size_t EpochChangeAck_LogInfoPiece::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:dsnet.transaction.eris.proto.EpochChangeAck.LogInfoPiece)
+  size_t total_size = 0;
+
+  if (((_impl_._has_bits_[0] & 0x00000003) ^ 0x00000003) == 0) {  // All required fields are present.
+    // required uint64 latest_msg_num = 2;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_latest_msg_num());
+
+    // required uint32 shard_num = 1;
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_shard_num());
+
+  } else {
+    total_size += RequiredFieldsByteSizeFallback();
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData EpochChangeAck_LogInfoPiece::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    EpochChangeAck_LogInfoPiece::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*EpochChangeAck_LogInfoPiece::GetClassData() const { return &_class_data_; }
+
+
+void EpochChangeAck_LogInfoPiece::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<EpochChangeAck_LogInfoPiece*>(&to_msg);
+  auto& from = static_cast<const EpochChangeAck_LogInfoPiece&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:dsnet.transaction.eris.proto.EpochChangeAck.LogInfoPiece)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_impl_.latest_msg_num_ = from._impl_.latest_msg_num_;
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.shard_num_ = from._impl_.shard_num_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void EpochChangeAck_LogInfoPiece::CopyFrom(const EpochChangeAck_LogInfoPiece& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:dsnet.transaction.eris.proto.EpochChangeAck.LogInfoPiece)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool EpochChangeAck_LogInfoPiece::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  return true;
+}
+
+void EpochChangeAck_LogInfoPiece::InternalSwap(EpochChangeAck_LogInfoPiece* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(EpochChangeAck_LogInfoPiece, _impl_.shard_num_)
+      + sizeof(EpochChangeAck_LogInfoPiece::_impl_.shard_num_)
+      - PROTOBUF_FIELD_OFFSET(EpochChangeAck_LogInfoPiece, _impl_.latest_msg_num_)>(
+          reinterpret_cast<char*>(&_impl_.latest_msg_num_),
+          reinterpret_cast<char*>(&other->_impl_.latest_msg_num_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata EpochChangeAck_LogInfoPiece::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_transaction_2feris_2feris_2dproto_2eproto_getter, &descriptor_table_transaction_2feris_2feris_2dproto_2eproto_once,
+      file_level_metadata_transaction_2feris_2feris_2dproto_2eproto[22]);
+}
+
+// ===================================================================
+
+class EpochChangeAck::_Internal {
+ public:
+  using HasBits = decltype(std::declval<EpochChangeAck>()._impl_._has_bits_);
+  static void set_has_last_normal_epoch(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_op_num(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000003) ^ 0x00000003) != 0;
+  }
+};
+
+EpochChangeAck::EpochChangeAck(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:dsnet.transaction.eris.proto.EpochChangeAck)
+}
+EpochChangeAck::EpochChangeAck(const EpochChangeAck& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  EpochChangeAck* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.log_info_){from._impl_.log_info_}
+    , decltype(_impl_.op_num_){}
+    , decltype(_impl_.last_normal_epoch_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.op_num_, &from._impl_.op_num_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.last_normal_epoch_) -
+    reinterpret_cast<char*>(&_impl_.op_num_)) + sizeof(_impl_.last_normal_epoch_));
+  // @@protoc_insertion_point(copy_constructor:dsnet.transaction.eris.proto.EpochChangeAck)
+}
+
+inline void EpochChangeAck::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.log_info_){arena}
+    , decltype(_impl_.op_num_){uint64_t{0u}}
+    , decltype(_impl_.last_normal_epoch_){0u}
+  };
+}
+
+EpochChangeAck::~EpochChangeAck() {
+  // @@protoc_insertion_point(destructor:dsnet.transaction.eris.proto.EpochChangeAck)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void EpochChangeAck::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.log_info_.~RepeatedPtrField();
+}
+
+void EpochChangeAck::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void EpochChangeAck::Clear() {
+// @@protoc_insertion_point(message_clear_start:dsnet.transaction.eris.proto.EpochChangeAck)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.log_info_.Clear();
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    ::memset(&_impl_.op_num_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.last_normal_epoch_) -
+        reinterpret_cast<char*>(&_impl_.op_num_)) + sizeof(_impl_.last_normal_epoch_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* EpochChangeAck::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required uint32 last_normal_epoch = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_last_normal_epoch(&has_bits);
+          _impl_.last_normal_epoch_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required uint64 op_num = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _Internal::set_has_op_num(&has_bits);
+          _impl_.op_num_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .dsnet.transaction.eris.proto.EpochChangeAck.LogInfoPiece log_info = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_log_info(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<26>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* EpochChangeAck::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:dsnet.transaction.eris.proto.EpochChangeAck)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required uint32 last_normal_epoch = 1;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(1, this->_internal_last_normal_epoch(), target);
+  }
+
+  // required uint64 op_num = 2;
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(2, this->_internal_op_num(), target);
+  }
+
+  // repeated .dsnet.transaction.eris.proto.EpochChangeAck.LogInfoPiece log_info = 3;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_log_info_size()); i < n; i++) {
+    const auto& repfield = this->_internal_log_info(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(3, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:dsnet.transaction.eris.proto.EpochChangeAck)
+  return target;
+}
+
+size_t EpochChangeAck::RequiredFieldsByteSizeFallback() const {
+// @@protoc_insertion_point(required_fields_byte_size_fallback_start:dsnet.transaction.eris.proto.EpochChangeAck)
+  size_t total_size = 0;
+
+  if (_internal_has_op_num()) {
+    // required uint64 op_num = 2;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_op_num());
+  }
+
+  if (_internal_has_last_normal_epoch()) {
+    // required uint32 last_normal_epoch = 1;
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_last_normal_epoch());
+  }
+
+  return total_size;
+}
+size_t EpochChangeAck::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:dsnet.transaction.eris.proto.EpochChangeAck)
+  size_t total_size = 0;
+
+  if (((_impl_._has_bits_[0] & 0x00000003) ^ 0x00000003) == 0) {  // All required fields are present.
+    // required uint64 op_num = 2;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_op_num());
+
+    // required uint32 last_normal_epoch = 1;
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_last_normal_epoch());
+
+  } else {
+    total_size += RequiredFieldsByteSizeFallback();
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .dsnet.transaction.eris.proto.EpochChangeAck.LogInfoPiece log_info = 3;
+  total_size += 1UL * this->_internal_log_info_size();
+  for (const auto& msg : this->_impl_.log_info_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData EpochChangeAck::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    EpochChangeAck::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*EpochChangeAck::GetClassData() const { return &_class_data_; }
+
+
+void EpochChangeAck::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<EpochChangeAck*>(&to_msg);
+  auto& from = static_cast<const EpochChangeAck&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:dsnet.transaction.eris.proto.EpochChangeAck)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.log_info_.MergeFrom(from._impl_.log_info_);
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_impl_.op_num_ = from._impl_.op_num_;
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.last_normal_epoch_ = from._impl_.last_normal_epoch_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void EpochChangeAck::CopyFrom(const EpochChangeAck& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:dsnet.transaction.eris.proto.EpochChangeAck)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool EpochChangeAck::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  if (!::PROTOBUF_NAMESPACE_ID::internal::AllAreInitialized(_impl_.log_info_))
+    return false;
+  return true;
+}
+
+void EpochChangeAck::InternalSwap(EpochChangeAck* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  _impl_.log_info_.InternalSwap(&other->_impl_.log_info_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(EpochChangeAck, _impl_.last_normal_epoch_)
+      + sizeof(EpochChangeAck::_impl_.last_normal_epoch_)
+      - PROTOBUF_FIELD_OFFSET(EpochChangeAck, _impl_.op_num_)>(
+          reinterpret_cast<char*>(&_impl_.op_num_),
+          reinterpret_cast<char*>(&other->_impl_.op_num_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata EpochChangeAck::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_transaction_2feris_2feris_2dproto_2eproto_getter, &descriptor_table_transaction_2feris_2feris_2dproto_2eproto_once,
+      file_level_metadata_transaction_2feris_2feris_2dproto_2eproto[23]);
+}
+
+// ===================================================================
+
+class EpochChangeStateTransferAck::_Internal {
+ public:
+  using HasBits = decltype(std::declval<EpochChangeStateTransferAck>()._impl_._has_bits_);
+  static void set_has_op_num(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000001) ^ 0x00000001) != 0;
+  }
+};
+
+EpochChangeStateTransferAck::EpochChangeStateTransferAck(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:dsnet.transaction.eris.proto.EpochChangeStateTransferAck)
+}
+EpochChangeStateTransferAck::EpochChangeStateTransferAck(const EpochChangeStateTransferAck& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  EpochChangeStateTransferAck* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.drops_){from._impl_.drops_}
+    , decltype(_impl_.op_num_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _this->_impl_.op_num_ = from._impl_.op_num_;
+  // @@protoc_insertion_point(copy_constructor:dsnet.transaction.eris.proto.EpochChangeStateTransferAck)
+}
+
+inline void EpochChangeStateTransferAck::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.drops_){arena}
+    , decltype(_impl_.op_num_){uint64_t{0u}}
+  };
+}
+
+EpochChangeStateTransferAck::~EpochChangeStateTransferAck() {
+  // @@protoc_insertion_point(destructor:dsnet.transaction.eris.proto.EpochChangeStateTransferAck)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void EpochChangeStateTransferAck::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.drops_.~RepeatedPtrField();
+}
+
+void EpochChangeStateTransferAck::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void EpochChangeStateTransferAck::Clear() {
+// @@protoc_insertion_point(message_clear_start:dsnet.transaction.eris.proto.EpochChangeStateTransferAck)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.drops_.Clear();
+  _impl_.op_num_ = uint64_t{0u};
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* EpochChangeStateTransferAck::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required uint64 op_num = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_op_num(&has_bits);
+          _impl_.op_num_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .dsnet.transaction.eris.proto.Stamp drops = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_drops(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<18>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* EpochChangeStateTransferAck::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:dsnet.transaction.eris.proto.EpochChangeStateTransferAck)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required uint64 op_num = 1;
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(1, this->_internal_op_num(), target);
+  }
+
+  // repeated .dsnet.transaction.eris.proto.Stamp drops = 2;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_drops_size()); i < n; i++) {
+    const auto& repfield = this->_internal_drops(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(2, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:dsnet.transaction.eris.proto.EpochChangeStateTransferAck)
+  return target;
+}
+
+size_t EpochChangeStateTransferAck::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:dsnet.transaction.eris.proto.EpochChangeStateTransferAck)
+  size_t total_size = 0;
+
+  // required uint64 op_num = 1;
+  if (_internal_has_op_num()) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_op_num());
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .dsnet.transaction.eris.proto.Stamp drops = 2;
+  total_size += 1UL * this->_internal_drops_size();
+  for (const auto& msg : this->_impl_.drops_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData EpochChangeStateTransferAck::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    EpochChangeStateTransferAck::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*EpochChangeStateTransferAck::GetClassData() const { return &_class_data_; }
+
+
+void EpochChangeStateTransferAck::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<EpochChangeStateTransferAck*>(&to_msg);
+  auto& from = static_cast<const EpochChangeStateTransferAck&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:dsnet.transaction.eris.proto.EpochChangeStateTransferAck)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.drops_.MergeFrom(from._impl_.drops_);
+  if (from._internal_has_op_num()) {
+    _this->_internal_set_op_num(from._internal_op_num());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void EpochChangeStateTransferAck::CopyFrom(const EpochChangeStateTransferAck& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:dsnet.transaction.eris.proto.EpochChangeStateTransferAck)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool EpochChangeStateTransferAck::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  if (!::PROTOBUF_NAMESPACE_ID::internal::AllAreInitialized(_impl_.drops_))
+    return false;
+  return true;
+}
+
+void EpochChangeStateTransferAck::InternalSwap(EpochChangeStateTransferAck* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  _impl_.drops_.InternalSwap(&other->_impl_.drops_);
+  swap(_impl_.op_num_, other->_impl_.op_num_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata EpochChangeStateTransferAck::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_transaction_2feris_2feris_2dproto_2eproto_getter, &descriptor_table_transaction_2feris_2feris_2dproto_2eproto_once,
+      file_level_metadata_transaction_2feris_2feris_2dproto_2eproto[24]);
+}
+
+// ===================================================================
+
+class ErisToFCMessage::_Internal {
+ public:
+  using HasBits = decltype(std::declval<ErisToFCMessage>()._impl_._has_bits_);
+  static void set_has_shard_num(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_replica_num(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static const ::dsnet::transaction::eris::proto::ViewNum& local_view_num(const ErisToFCMessage* msg);
+  static void set_has_local_view_num(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static const ::dsnet::transaction::eris::proto::TxnInfoRequest& txn_info_req(const ErisToFCMessage* msg);
+  static const ::dsnet::transaction::eris::proto::TxnReceived& txn_received(const ErisToFCMessage* msg);
+  static const ::dsnet::transaction::eris::proto::TxnTempDropped& txn_temp_drop(const ErisToFCMessage* msg);
+  static const ::dsnet::transaction::eris::proto::EpochChangeReq& epoch_change_req(const ErisToFCMessage* msg);
+  static const ::dsnet::transaction::eris::proto::EpochChangeAck& epoch_change_ack(const ErisToFCMessage* msg);
+  static const ::dsnet::transaction::eris::proto::EpochChangeStateTransferAck& epoch_change_state_transfer_ack(const ErisToFCMessage* msg);
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000007) ^ 0x00000007) != 0;
+  }
+};
+
+const ::dsnet::transaction::eris::proto::ViewNum&
+ErisToFCMessage::_Internal::local_view_num(const ErisToFCMessage* msg) {
+  return *msg->_impl_.local_view_num_;
+}
+const ::dsnet::transaction::eris::proto::TxnInfoRequest&
+ErisToFCMessage::_Internal::txn_info_req(const ErisToFCMessage* msg) {
+  return *msg->_impl_.msg_.txn_info_req_;
+}
+const ::dsnet::transaction::eris::proto::TxnReceived&
+ErisToFCMessage::_Internal::txn_received(const ErisToFCMessage* msg) {
+  return *msg->_impl_.msg_.txn_received_;
+}
+const ::dsnet::transaction::eris::proto::TxnTempDropped&
+ErisToFCMessage::_Internal::txn_temp_drop(const ErisToFCMessage* msg) {
+  return *msg->_impl_.msg_.txn_temp_drop_;
+}
+const ::dsnet::transaction::eris::proto::EpochChangeReq&
+ErisToFCMessage::_Internal::epoch_change_req(const ErisToFCMessage* msg) {
+  return *msg->_impl_.msg_.epoch_change_req_;
+}
+const ::dsnet::transaction::eris::proto::EpochChangeAck&
+ErisToFCMessage::_Internal::epoch_change_ack(const ErisToFCMessage* msg) {
+  return *msg->_impl_.msg_.epoch_change_ack_;
+}
+const ::dsnet::transaction::eris::proto::EpochChangeStateTransferAck&
+ErisToFCMessage::_Internal::epoch_change_state_transfer_ack(const ErisToFCMessage* msg) {
+  return *msg->_impl_.msg_.epoch_change_state_transfer_ack_;
+}
+void ErisToFCMessage::set_allocated_txn_info_req(::dsnet::transaction::eris::proto::TxnInfoRequest* txn_info_req) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  clear_msg();
+  if (txn_info_req) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(txn_info_req);
+    if (message_arena != submessage_arena) {
+      txn_info_req = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, txn_info_req, submessage_arena);
+    }
+    set_has_txn_info_req();
+    _impl_.msg_.txn_info_req_ = txn_info_req;
+  }
+  // @@protoc_insertion_point(field_set_allocated:dsnet.transaction.eris.proto.ErisToFCMessage.txn_info_req)
+}
+void ErisToFCMessage::set_allocated_txn_received(::dsnet::transaction::eris::proto::TxnReceived* txn_received) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  clear_msg();
+  if (txn_received) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(txn_received);
+    if (message_arena != submessage_arena) {
+      txn_received = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, txn_received, submessage_arena);
+    }
+    set_has_txn_received();
+    _impl_.msg_.txn_received_ = txn_received;
+  }
+  // @@protoc_insertion_point(field_set_allocated:dsnet.transaction.eris.proto.ErisToFCMessage.txn_received)
+}
+void ErisToFCMessage::set_allocated_txn_temp_drop(::dsnet::transaction::eris::proto::TxnTempDropped* txn_temp_drop) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  clear_msg();
+  if (txn_temp_drop) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(txn_temp_drop);
+    if (message_arena != submessage_arena) {
+      txn_temp_drop = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, txn_temp_drop, submessage_arena);
+    }
+    set_has_txn_temp_drop();
+    _impl_.msg_.txn_temp_drop_ = txn_temp_drop;
+  }
+  // @@protoc_insertion_point(field_set_allocated:dsnet.transaction.eris.proto.ErisToFCMessage.txn_temp_drop)
+}
+void ErisToFCMessage::set_allocated_epoch_change_req(::dsnet::transaction::eris::proto::EpochChangeReq* epoch_change_req) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  clear_msg();
+  if (epoch_change_req) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(epoch_change_req);
+    if (message_arena != submessage_arena) {
+      epoch_change_req = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, epoch_change_req, submessage_arena);
+    }
+    set_has_epoch_change_req();
+    _impl_.msg_.epoch_change_req_ = epoch_change_req;
+  }
+  // @@protoc_insertion_point(field_set_allocated:dsnet.transaction.eris.proto.ErisToFCMessage.epoch_change_req)
+}
+void ErisToFCMessage::set_allocated_epoch_change_ack(::dsnet::transaction::eris::proto::EpochChangeAck* epoch_change_ack) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  clear_msg();
+  if (epoch_change_ack) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(epoch_change_ack);
+    if (message_arena != submessage_arena) {
+      epoch_change_ack = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, epoch_change_ack, submessage_arena);
+    }
+    set_has_epoch_change_ack();
+    _impl_.msg_.epoch_change_ack_ = epoch_change_ack;
+  }
+  // @@protoc_insertion_point(field_set_allocated:dsnet.transaction.eris.proto.ErisToFCMessage.epoch_change_ack)
+}
+void ErisToFCMessage::set_allocated_epoch_change_state_transfer_ack(::dsnet::transaction::eris::proto::EpochChangeStateTransferAck* epoch_change_state_transfer_ack) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  clear_msg();
+  if (epoch_change_state_transfer_ack) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(epoch_change_state_transfer_ack);
+    if (message_arena != submessage_arena) {
+      epoch_change_state_transfer_ack = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, epoch_change_state_transfer_ack, submessage_arena);
+    }
+    set_has_epoch_change_state_transfer_ack();
+    _impl_.msg_.epoch_change_state_transfer_ack_ = epoch_change_state_transfer_ack;
+  }
+  // @@protoc_insertion_point(field_set_allocated:dsnet.transaction.eris.proto.ErisToFCMessage.epoch_change_state_transfer_ack)
+}
+ErisToFCMessage::ErisToFCMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:dsnet.transaction.eris.proto.ErisToFCMessage)
+}
+ErisToFCMessage::ErisToFCMessage(const ErisToFCMessage& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  ErisToFCMessage* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.local_view_num_){nullptr}
+    , decltype(_impl_.shard_num_){}
+    , decltype(_impl_.replica_num_){}
+    , decltype(_impl_.msg_){}
+    , /*decltype(_impl_._oneof_case_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  if (from._internal_has_local_view_num()) {
+    _this->_impl_.local_view_num_ = new ::dsnet::transaction::eris::proto::ViewNum(*from._impl_.local_view_num_);
+  }
+  ::memcpy(&_impl_.shard_num_, &from._impl_.shard_num_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.replica_num_) -
+    reinterpret_cast<char*>(&_impl_.shard_num_)) + sizeof(_impl_.replica_num_));
+  clear_has_msg();
+  switch (from.msg_case()) {
+    case kTxnInfoReq: {
+      _this->_internal_mutable_txn_info_req()->::dsnet::transaction::eris::proto::TxnInfoRequest::MergeFrom(
+          from._internal_txn_info_req());
+      break;
+    }
+    case kTxnReceived: {
+      _this->_internal_mutable_txn_received()->::dsnet::transaction::eris::proto::TxnReceived::MergeFrom(
+          from._internal_txn_received());
+      break;
+    }
+    case kTxnTempDrop: {
+      _this->_internal_mutable_txn_temp_drop()->::dsnet::transaction::eris::proto::TxnTempDropped::MergeFrom(
+          from._internal_txn_temp_drop());
+      break;
+    }
+    case kEpochChangeReq: {
+      _this->_internal_mutable_epoch_change_req()->::dsnet::transaction::eris::proto::EpochChangeReq::MergeFrom(
+          from._internal_epoch_change_req());
+      break;
+    }
+    case kEpochChangeAck: {
+      _this->_internal_mutable_epoch_change_ack()->::dsnet::transaction::eris::proto::EpochChangeAck::MergeFrom(
+          from._internal_epoch_change_ack());
+      break;
+    }
+    case kEpochChangeStateTransferAck: {
+      _this->_internal_mutable_epoch_change_state_transfer_ack()->::dsnet::transaction::eris::proto::EpochChangeStateTransferAck::MergeFrom(
+          from._internal_epoch_change_state_transfer_ack());
+      break;
+    }
+    case MSG_NOT_SET: {
+      break;
+    }
+  }
+  // @@protoc_insertion_point(copy_constructor:dsnet.transaction.eris.proto.ErisToFCMessage)
+}
+
+inline void ErisToFCMessage::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.local_view_num_){nullptr}
+    , decltype(_impl_.shard_num_){0u}
+    , decltype(_impl_.replica_num_){0u}
+    , decltype(_impl_.msg_){}
+    , /*decltype(_impl_._oneof_case_)*/{}
+  };
+  clear_has_msg();
+}
+
+ErisToFCMessage::~ErisToFCMessage() {
+  // @@protoc_insertion_point(destructor:dsnet.transaction.eris.proto.ErisToFCMessage)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void ErisToFCMessage::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  if (this != internal_default_instance()) delete _impl_.local_view_num_;
+  if (has_msg()) {
+    clear_msg();
+  }
+}
+
+void ErisToFCMessage::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void ErisToFCMessage::clear_msg() {
+// @@protoc_insertion_point(one_of_clear_start:dsnet.transaction.eris.proto.ErisToFCMessage)
+  switch (msg_case()) {
+    case kTxnInfoReq: {
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.msg_.txn_info_req_;
+      }
+      break;
+    }
+    case kTxnReceived: {
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.msg_.txn_received_;
+      }
+      break;
+    }
+    case kTxnTempDrop: {
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.msg_.txn_temp_drop_;
+      }
+      break;
+    }
+    case kEpochChangeReq: {
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.msg_.epoch_change_req_;
+      }
+      break;
+    }
+    case kEpochChangeAck: {
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.msg_.epoch_change_ack_;
+      }
+      break;
+    }
+    case kEpochChangeStateTransferAck: {
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.msg_.epoch_change_state_transfer_ack_;
+      }
+      break;
+    }
+    case MSG_NOT_SET: {
+      break;
+    }
+  }
+  _impl_._oneof_case_[0] = MSG_NOT_SET;
+}
+
+
+void ErisToFCMessage::Clear() {
+// @@protoc_insertion_point(message_clear_start:dsnet.transaction.eris.proto.ErisToFCMessage)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    GOOGLE_DCHECK(_impl_.local_view_num_ != nullptr);
+    _impl_.local_view_num_->Clear();
+  }
+  if (cached_has_bits & 0x00000006u) {
+    ::memset(&_impl_.shard_num_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.replica_num_) -
+        reinterpret_cast<char*>(&_impl_.shard_num_)) + sizeof(_impl_.replica_num_));
+  }
+  clear_msg();
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* ErisToFCMessage::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required uint32 shard_num = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_shard_num(&has_bits);
+          _impl_.shard_num_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required uint32 replica_num = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _Internal::set_has_replica_num(&has_bits);
+          _impl_.replica_num_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required .dsnet.transaction.eris.proto.ViewNum local_view_num = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          ptr = ctx->ParseMessage(_internal_mutable_local_view_num(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .dsnet.transaction.eris.proto.TxnInfoRequest txn_info_req = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          ptr = ctx->ParseMessage(_internal_mutable_txn_info_req(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .dsnet.transaction.eris.proto.TxnReceived txn_received = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 42)) {
+          ptr = ctx->ParseMessage(_internal_mutable_txn_received(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .dsnet.transaction.eris.proto.TxnTempDropped txn_temp_drop = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 50)) {
+          ptr = ctx->ParseMessage(_internal_mutable_txn_temp_drop(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .dsnet.transaction.eris.proto.EpochChangeReq epoch_change_req = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 58)) {
+          ptr = ctx->ParseMessage(_internal_mutable_epoch_change_req(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .dsnet.transaction.eris.proto.EpochChangeAck epoch_change_ack = 8;
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 66)) {
+          ptr = ctx->ParseMessage(_internal_mutable_epoch_change_ack(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .dsnet.transaction.eris.proto.EpochChangeStateTransferAck epoch_change_state_transfer_ack = 9;
+      case 9:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 74)) {
+          ptr = ctx->ParseMessage(_internal_mutable_epoch_change_state_transfer_ack(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* ErisToFCMessage::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:dsnet.transaction.eris.proto.ErisToFCMessage)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required uint32 shard_num = 1;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(1, this->_internal_shard_num(), target);
+  }
+
+  // required uint32 replica_num = 2;
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(2, this->_internal_replica_num(), target);
+  }
+
+  // required .dsnet.transaction.eris.proto.ViewNum local_view_num = 3;
+  if (cached_has_bits & 0x00000001u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(3, _Internal::local_view_num(this),
+        _Internal::local_view_num(this).GetCachedSize(), target, stream);
+  }
+
+  switch (msg_case()) {
+    case kTxnInfoReq: {
+      target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(4, _Internal::txn_info_req(this),
+          _Internal::txn_info_req(this).GetCachedSize(), target, stream);
+      break;
+    }
+    case kTxnReceived: {
+      target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(5, _Internal::txn_received(this),
+          _Internal::txn_received(this).GetCachedSize(), target, stream);
+      break;
+    }
+    case kTxnTempDrop: {
+      target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(6, _Internal::txn_temp_drop(this),
+          _Internal::txn_temp_drop(this).GetCachedSize(), target, stream);
+      break;
+    }
+    case kEpochChangeReq: {
+      target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(7, _Internal::epoch_change_req(this),
+          _Internal::epoch_change_req(this).GetCachedSize(), target, stream);
+      break;
+    }
+    case kEpochChangeAck: {
+      target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(8, _Internal::epoch_change_ack(this),
+          _Internal::epoch_change_ack(this).GetCachedSize(), target, stream);
+      break;
+    }
+    case kEpochChangeStateTransferAck: {
+      target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(9, _Internal::epoch_change_state_transfer_ack(this),
+          _Internal::epoch_change_state_transfer_ack(this).GetCachedSize(), target, stream);
+      break;
+    }
+    default: ;
+  }
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:dsnet.transaction.eris.proto.ErisToFCMessage)
+  return target;
+}
+
+size_t ErisToFCMessage::RequiredFieldsByteSizeFallback() const {
+// @@protoc_insertion_point(required_fields_byte_size_fallback_start:dsnet.transaction.eris.proto.ErisToFCMessage)
+  size_t total_size = 0;
+
+  if (_internal_has_local_view_num()) {
+    // required .dsnet.transaction.eris.proto.ViewNum local_view_num = 3;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.local_view_num_);
+  }
+
+  if (_internal_has_shard_num()) {
+    // required uint32 shard_num = 1;
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_shard_num());
+  }
+
+  if (_internal_has_replica_num()) {
+    // required uint32 replica_num = 2;
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_replica_num());
+  }
+
+  return total_size;
+}
+size_t ErisToFCMessage::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:dsnet.transaction.eris.proto.ErisToFCMessage)
+  size_t total_size = 0;
+
+  if (((_impl_._has_bits_[0] & 0x00000007) ^ 0x00000007) == 0) {  // All required fields are present.
+    // required .dsnet.transaction.eris.proto.ViewNum local_view_num = 3;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.local_view_num_);
+
+    // required uint32 shard_num = 1;
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_shard_num());
+
+    // required uint32 replica_num = 2;
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_replica_num());
+
+  } else {
+    total_size += RequiredFieldsByteSizeFallback();
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  switch (msg_case()) {
+    // .dsnet.transaction.eris.proto.TxnInfoRequest txn_info_req = 4;
+    case kTxnInfoReq: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.msg_.txn_info_req_);
+      break;
+    }
+    // .dsnet.transaction.eris.proto.TxnReceived txn_received = 5;
+    case kTxnReceived: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.msg_.txn_received_);
+      break;
+    }
+    // .dsnet.transaction.eris.proto.TxnTempDropped txn_temp_drop = 6;
+    case kTxnTempDrop: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.msg_.txn_temp_drop_);
+      break;
+    }
+    // .dsnet.transaction.eris.proto.EpochChangeReq epoch_change_req = 7;
+    case kEpochChangeReq: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.msg_.epoch_change_req_);
+      break;
+    }
+    // .dsnet.transaction.eris.proto.EpochChangeAck epoch_change_ack = 8;
+    case kEpochChangeAck: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.msg_.epoch_change_ack_);
+      break;
+    }
+    // .dsnet.transaction.eris.proto.EpochChangeStateTransferAck epoch_change_state_transfer_ack = 9;
+    case kEpochChangeStateTransferAck: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.msg_.epoch_change_state_transfer_ack_);
+      break;
+    }
+    case MSG_NOT_SET: {
+      break;
+    }
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ErisToFCMessage::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    ErisToFCMessage::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ErisToFCMessage::GetClassData() const { return &_class_data_; }
+
+
+void ErisToFCMessage::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<ErisToFCMessage*>(&to_msg);
+  auto& from = static_cast<const ErisToFCMessage&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:dsnet.transaction.eris.proto.ErisToFCMessage)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_mutable_local_view_num()->::dsnet::transaction::eris::proto::ViewNum::MergeFrom(
+          from._internal_local_view_num());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.shard_num_ = from._impl_.shard_num_;
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.replica_num_ = from._impl_.replica_num_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  switch (from.msg_case()) {
+    case kTxnInfoReq: {
+      _this->_internal_mutable_txn_info_req()->::dsnet::transaction::eris::proto::TxnInfoRequest::MergeFrom(
+          from._internal_txn_info_req());
+      break;
+    }
+    case kTxnReceived: {
+      _this->_internal_mutable_txn_received()->::dsnet::transaction::eris::proto::TxnReceived::MergeFrom(
+          from._internal_txn_received());
+      break;
+    }
+    case kTxnTempDrop: {
+      _this->_internal_mutable_txn_temp_drop()->::dsnet::transaction::eris::proto::TxnTempDropped::MergeFrom(
+          from._internal_txn_temp_drop());
+      break;
+    }
+    case kEpochChangeReq: {
+      _this->_internal_mutable_epoch_change_req()->::dsnet::transaction::eris::proto::EpochChangeReq::MergeFrom(
+          from._internal_epoch_change_req());
+      break;
+    }
+    case kEpochChangeAck: {
+      _this->_internal_mutable_epoch_change_ack()->::dsnet::transaction::eris::proto::EpochChangeAck::MergeFrom(
+          from._internal_epoch_change_ack());
+      break;
+    }
+    case kEpochChangeStateTransferAck: {
+      _this->_internal_mutable_epoch_change_state_transfer_ack()->::dsnet::transaction::eris::proto::EpochChangeStateTransferAck::MergeFrom(
+          from._internal_epoch_change_state_transfer_ack());
+      break;
+    }
+    case MSG_NOT_SET: {
+      break;
+    }
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void ErisToFCMessage::CopyFrom(const ErisToFCMessage& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:dsnet.transaction.eris.proto.ErisToFCMessage)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool ErisToFCMessage::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  if (_internal_has_local_view_num()) {
+    if (!_impl_.local_view_num_->IsInitialized()) return false;
+  }
+  switch (msg_case()) {
+    case kTxnInfoReq: {
+      if (_internal_has_txn_info_req()) {
+        if (!_impl_.msg_.txn_info_req_->IsInitialized()) return false;
+      }
+      break;
+    }
+    case kTxnReceived: {
+      if (_internal_has_txn_received()) {
+        if (!_impl_.msg_.txn_received_->IsInitialized()) return false;
+      }
+      break;
+    }
+    case kTxnTempDrop: {
+      if (_internal_has_txn_temp_drop()) {
+        if (!_impl_.msg_.txn_temp_drop_->IsInitialized()) return false;
+      }
+      break;
+    }
+    case kEpochChangeReq: {
+      if (_internal_has_epoch_change_req()) {
+        if (!_impl_.msg_.epoch_change_req_->IsInitialized()) return false;
+      }
+      break;
+    }
+    case kEpochChangeAck: {
+      if (_internal_has_epoch_change_ack()) {
+        if (!_impl_.msg_.epoch_change_ack_->IsInitialized()) return false;
+      }
+      break;
+    }
+    case kEpochChangeStateTransferAck: {
+      if (_internal_has_epoch_change_state_transfer_ack()) {
+        if (!_impl_.msg_.epoch_change_state_transfer_ack_->IsInitialized()) return false;
+      }
+      break;
+    }
+    case MSG_NOT_SET: {
+      break;
+    }
+  }
+  return true;
+}
+
+void ErisToFCMessage::InternalSwap(ErisToFCMessage* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(ErisToFCMessage, _impl_.replica_num_)
+      + sizeof(ErisToFCMessage::_impl_.replica_num_)
+      - PROTOBUF_FIELD_OFFSET(ErisToFCMessage, _impl_.local_view_num_)>(
+          reinterpret_cast<char*>(&_impl_.local_view_num_),
+          reinterpret_cast<char*>(&other->_impl_.local_view_num_));
+  swap(_impl_.msg_, other->_impl_.msg_);
+  swap(_impl_._oneof_case_[0], other->_impl_._oneof_case_[0]);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata ErisToFCMessage::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_transaction_2feris_2feris_2dproto_2eproto_getter, &descriptor_table_transaction_2feris_2feris_2dproto_2eproto_once,
+      file_level_metadata_transaction_2feris_2feris_2dproto_2eproto[25]);
+}
+
+// ===================================================================
+
+class TxnCheck::_Internal {
+ public:
+  using HasBits = decltype(std::declval<TxnCheck>()._impl_._has_bits_);
+  static const ::dsnet::transaction::eris::proto::Stamp& txn_num(const TxnCheck* msg);
+  static void set_has_txn_num(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000001) ^ 0x00000001) != 0;
+  }
+};
+
+const ::dsnet::transaction::eris::proto::Stamp&
+TxnCheck::_Internal::txn_num(const TxnCheck* msg) {
+  return *msg->_impl_.txn_num_;
+}
+TxnCheck::TxnCheck(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:dsnet.transaction.eris.proto.TxnCheck)
+}
+TxnCheck::TxnCheck(const TxnCheck& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  TxnCheck* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.txn_num_){nullptr}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  if (from._internal_has_txn_num()) {
+    _this->_impl_.txn_num_ = new ::dsnet::transaction::eris::proto::Stamp(*from._impl_.txn_num_);
+  }
+  // @@protoc_insertion_point(copy_constructor:dsnet.transaction.eris.proto.TxnCheck)
+}
+
+inline void TxnCheck::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.txn_num_){nullptr}
+  };
+}
+
+TxnCheck::~TxnCheck() {
+  // @@protoc_insertion_point(destructor:dsnet.transaction.eris.proto.TxnCheck)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void TxnCheck::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  if (this != internal_default_instance()) delete _impl_.txn_num_;
+}
+
+void TxnCheck::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void TxnCheck::Clear() {
+// @@protoc_insertion_point(message_clear_start:dsnet.transaction.eris.proto.TxnCheck)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    GOOGLE_DCHECK(_impl_.txn_num_ != nullptr);
+    _impl_.txn_num_->Clear();
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* TxnCheck::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required .dsnet.transaction.eris.proto.Stamp txn_num = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr = ctx->ParseMessage(_internal_mutable_txn_num(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* TxnCheck::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:dsnet.transaction.eris.proto.TxnCheck)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required .dsnet.transaction.eris.proto.Stamp txn_num = 1;
+  if (cached_has_bits & 0x00000001u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(1, _Internal::txn_num(this),
+        _Internal::txn_num(this).GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:dsnet.transaction.eris.proto.TxnCheck)
+  return target;
+}
+
+size_t TxnCheck::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:dsnet.transaction.eris.proto.TxnCheck)
+  size_t total_size = 0;
+
+  // required .dsnet.transaction.eris.proto.Stamp txn_num = 1;
+  if (_internal_has_txn_num()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.txn_num_);
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData TxnCheck::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    TxnCheck::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*TxnCheck::GetClassData() const { return &_class_data_; }
+
+
+void TxnCheck::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<TxnCheck*>(&to_msg);
+  auto& from = static_cast<const TxnCheck&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:dsnet.transaction.eris.proto.TxnCheck)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_has_txn_num()) {
+    _this->_internal_mutable_txn_num()->::dsnet::transaction::eris::proto::Stamp::MergeFrom(
+        from._internal_txn_num());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void TxnCheck::CopyFrom(const TxnCheck& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:dsnet.transaction.eris.proto.TxnCheck)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool TxnCheck::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  if (_internal_has_txn_num()) {
+    if (!_impl_.txn_num_->IsInitialized()) return false;
+  }
+  return true;
+}
+
+void TxnCheck::InternalSwap(TxnCheck* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  swap(_impl_.txn_num_, other->_impl_.txn_num_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata TxnCheck::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_transaction_2feris_2feris_2dproto_2eproto_getter, &descriptor_table_transaction_2feris_2feris_2dproto_2eproto_once,
+      file_level_metadata_transaction_2feris_2feris_2dproto_2eproto[26]);
+}
+
+// ===================================================================
+
+class TxnFound::_Internal {
+ public:
+  using HasBits = decltype(std::declval<TxnFound>()._impl_._has_bits_);
+  static const ::dsnet::transaction::eris::proto::RequestMessage& txn(const TxnFound* msg);
+  static void set_has_txn(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000001) ^ 0x00000001) != 0;
+  }
+};
+
+const ::dsnet::transaction::eris::proto::RequestMessage&
+TxnFound::_Internal::txn(const TxnFound* msg) {
+  return *msg->_impl_.txn_;
+}
+TxnFound::TxnFound(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:dsnet.transaction.eris.proto.TxnFound)
+}
+TxnFound::TxnFound(const TxnFound& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  TxnFound* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.txn_){nullptr}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  if (from._internal_has_txn()) {
+    _this->_impl_.txn_ = new ::dsnet::transaction::eris::proto::RequestMessage(*from._impl_.txn_);
+  }
+  // @@protoc_insertion_point(copy_constructor:dsnet.transaction.eris.proto.TxnFound)
+}
+
+inline void TxnFound::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.txn_){nullptr}
+  };
+}
+
+TxnFound::~TxnFound() {
+  // @@protoc_insertion_point(destructor:dsnet.transaction.eris.proto.TxnFound)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void TxnFound::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  if (this != internal_default_instance()) delete _impl_.txn_;
+}
+
+void TxnFound::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void TxnFound::Clear() {
+// @@protoc_insertion_point(message_clear_start:dsnet.transaction.eris.proto.TxnFound)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    GOOGLE_DCHECK(_impl_.txn_ != nullptr);
+    _impl_.txn_->Clear();
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* TxnFound::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required .dsnet.transaction.eris.proto.RequestMessage txn = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr = ctx->ParseMessage(_internal_mutable_txn(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* TxnFound::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:dsnet.transaction.eris.proto.TxnFound)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required .dsnet.transaction.eris.proto.RequestMessage txn = 1;
+  if (cached_has_bits & 0x00000001u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(1, _Internal::txn(this),
+        _Internal::txn(this).GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:dsnet.transaction.eris.proto.TxnFound)
+  return target;
+}
+
+size_t TxnFound::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:dsnet.transaction.eris.proto.TxnFound)
+  size_t total_size = 0;
+
+  // required .dsnet.transaction.eris.proto.RequestMessage txn = 1;
+  if (_internal_has_txn()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.txn_);
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData TxnFound::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    TxnFound::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*TxnFound::GetClassData() const { return &_class_data_; }
+
+
+void TxnFound::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<TxnFound*>(&to_msg);
+  auto& from = static_cast<const TxnFound&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:dsnet.transaction.eris.proto.TxnFound)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_has_txn()) {
+    _this->_internal_mutable_txn()->::dsnet::transaction::eris::proto::RequestMessage::MergeFrom(
+        from._internal_txn());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void TxnFound::CopyFrom(const TxnFound& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:dsnet.transaction.eris.proto.TxnFound)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool TxnFound::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  if (_internal_has_txn()) {
+    if (!_impl_.txn_->IsInitialized()) return false;
+  }
+  return true;
+}
+
+void TxnFound::InternalSwap(TxnFound* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  swap(_impl_.txn_, other->_impl_.txn_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata TxnFound::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_transaction_2feris_2feris_2dproto_2eproto_getter, &descriptor_table_transaction_2feris_2feris_2dproto_2eproto_once,
+      file_level_metadata_transaction_2feris_2feris_2dproto_2eproto[27]);
+}
+
+// ===================================================================
+
+class DropTxn::_Internal {
+ public:
+  using HasBits = decltype(std::declval<DropTxn>()._impl_._has_bits_);
+  static const ::dsnet::transaction::eris::proto::Stamp& txn_num(const DropTxn* msg);
+  static void set_has_txn_num(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000001) ^ 0x00000001) != 0;
+  }
+};
+
+const ::dsnet::transaction::eris::proto::Stamp&
+DropTxn::_Internal::txn_num(const DropTxn* msg) {
+  return *msg->_impl_.txn_num_;
+}
+DropTxn::DropTxn(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:dsnet.transaction.eris.proto.DropTxn)
+}
+DropTxn::DropTxn(const DropTxn& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  DropTxn* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.txn_num_){nullptr}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  if (from._internal_has_txn_num()) {
+    _this->_impl_.txn_num_ = new ::dsnet::transaction::eris::proto::Stamp(*from._impl_.txn_num_);
+  }
+  // @@protoc_insertion_point(copy_constructor:dsnet.transaction.eris.proto.DropTxn)
+}
+
+inline void DropTxn::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.txn_num_){nullptr}
+  };
+}
+
+DropTxn::~DropTxn() {
+  // @@protoc_insertion_point(destructor:dsnet.transaction.eris.proto.DropTxn)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void DropTxn::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  if (this != internal_default_instance()) delete _impl_.txn_num_;
+}
+
+void DropTxn::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void DropTxn::Clear() {
+// @@protoc_insertion_point(message_clear_start:dsnet.transaction.eris.proto.DropTxn)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    GOOGLE_DCHECK(_impl_.txn_num_ != nullptr);
+    _impl_.txn_num_->Clear();
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* DropTxn::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required .dsnet.transaction.eris.proto.Stamp txn_num = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr = ctx->ParseMessage(_internal_mutable_txn_num(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* DropTxn::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:dsnet.transaction.eris.proto.DropTxn)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required .dsnet.transaction.eris.proto.Stamp txn_num = 1;
+  if (cached_has_bits & 0x00000001u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(1, _Internal::txn_num(this),
+        _Internal::txn_num(this).GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:dsnet.transaction.eris.proto.DropTxn)
+  return target;
+}
+
+size_t DropTxn::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:dsnet.transaction.eris.proto.DropTxn)
+  size_t total_size = 0;
+
+  // required .dsnet.transaction.eris.proto.Stamp txn_num = 1;
+  if (_internal_has_txn_num()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.txn_num_);
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData DropTxn::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    DropTxn::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*DropTxn::GetClassData() const { return &_class_data_; }
+
+
+void DropTxn::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<DropTxn*>(&to_msg);
+  auto& from = static_cast<const DropTxn&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:dsnet.transaction.eris.proto.DropTxn)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_has_txn_num()) {
+    _this->_internal_mutable_txn_num()->::dsnet::transaction::eris::proto::Stamp::MergeFrom(
+        from._internal_txn_num());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void DropTxn::CopyFrom(const DropTxn& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:dsnet.transaction.eris.proto.DropTxn)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool DropTxn::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  if (_internal_has_txn_num()) {
+    if (!_impl_.txn_num_->IsInitialized()) return false;
+  }
+  return true;
+}
+
+void DropTxn::InternalSwap(DropTxn* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  swap(_impl_.txn_num_, other->_impl_.txn_num_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata DropTxn::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_transaction_2feris_2feris_2dproto_2eproto_getter, &descriptor_table_transaction_2feris_2feris_2dproto_2eproto_once,
+      file_level_metadata_transaction_2feris_2feris_2dproto_2eproto[28]);
+}
+
+// ===================================================================
+
+class EpochChange::_Internal {
+ public:
+  using HasBits = decltype(std::declval<EpochChange>()._impl_._has_bits_);
+  static void set_has_new_epoch_num(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000001) ^ 0x00000001) != 0;
+  }
+};
+
+EpochChange::EpochChange(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:dsnet.transaction.eris.proto.EpochChange)
+}
+EpochChange::EpochChange(const EpochChange& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  EpochChange* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.new_epoch_num_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _this->_impl_.new_epoch_num_ = from._impl_.new_epoch_num_;
+  // @@protoc_insertion_point(copy_constructor:dsnet.transaction.eris.proto.EpochChange)
+}
+
+inline void EpochChange::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.new_epoch_num_){0u}
+  };
+}
+
+EpochChange::~EpochChange() {
+  // @@protoc_insertion_point(destructor:dsnet.transaction.eris.proto.EpochChange)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void EpochChange::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void EpochChange::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void EpochChange::Clear() {
+// @@protoc_insertion_point(message_clear_start:dsnet.transaction.eris.proto.EpochChange)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.new_epoch_num_ = 0u;
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* EpochChange::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required uint32 new_epoch_num = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_new_epoch_num(&has_bits);
+          _impl_.new_epoch_num_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* EpochChange::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:dsnet.transaction.eris.proto.EpochChange)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required uint32 new_epoch_num = 1;
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(1, this->_internal_new_epoch_num(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:dsnet.transaction.eris.proto.EpochChange)
+  return target;
+}
+
+size_t EpochChange::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:dsnet.transaction.eris.proto.EpochChange)
+  size_t total_size = 0;
+
+  // required uint32 new_epoch_num = 1;
+  if (_internal_has_new_epoch_num()) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_new_epoch_num());
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData EpochChange::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    EpochChange::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*EpochChange::GetClassData() const { return &_class_data_; }
+
+
+void EpochChange::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<EpochChange*>(&to_msg);
+  auto& from = static_cast<const EpochChange&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:dsnet.transaction.eris.proto.EpochChange)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_has_new_epoch_num()) {
+    _this->_internal_set_new_epoch_num(from._internal_new_epoch_num());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void EpochChange::CopyFrom(const EpochChange& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:dsnet.transaction.eris.proto.EpochChange)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool EpochChange::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  return true;
+}
+
+void EpochChange::InternalSwap(EpochChange* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  swap(_impl_.new_epoch_num_, other->_impl_.new_epoch_num_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata EpochChange::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_transaction_2feris_2feris_2dproto_2eproto_getter, &descriptor_table_transaction_2feris_2feris_2dproto_2eproto_once,
+      file_level_metadata_transaction_2feris_2feris_2dproto_2eproto[29]);
+}
+
+// ===================================================================
+
+class EpochChangeStateTransfer_MsgEntry::_Internal {
+ public:
+  using HasBits = decltype(std::declval<EpochChangeStateTransfer_MsgEntry>()._impl_._has_bits_);
+  static void set_has_shard_num(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_replica_num(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_msg_num(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000007) ^ 0x00000007) != 0;
+  }
+};
+
+EpochChangeStateTransfer_MsgEntry::EpochChangeStateTransfer_MsgEntry(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:dsnet.transaction.eris.proto.EpochChangeStateTransfer.MsgEntry)
+}
+EpochChangeStateTransfer_MsgEntry::EpochChangeStateTransfer_MsgEntry(const EpochChangeStateTransfer_MsgEntry& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  EpochChangeStateTransfer_MsgEntry* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.shard_num_){}
+    , decltype(_impl_.replica_num_){}
+    , decltype(_impl_.msg_num_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.shard_num_, &from._impl_.shard_num_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.msg_num_) -
+    reinterpret_cast<char*>(&_impl_.shard_num_)) + sizeof(_impl_.msg_num_));
+  // @@protoc_insertion_point(copy_constructor:dsnet.transaction.eris.proto.EpochChangeStateTransfer.MsgEntry)
+}
+
+inline void EpochChangeStateTransfer_MsgEntry::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.shard_num_){0u}
+    , decltype(_impl_.replica_num_){0u}
+    , decltype(_impl_.msg_num_){uint64_t{0u}}
+  };
+}
+
+EpochChangeStateTransfer_MsgEntry::~EpochChangeStateTransfer_MsgEntry() {
+  // @@protoc_insertion_point(destructor:dsnet.transaction.eris.proto.EpochChangeStateTransfer.MsgEntry)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void EpochChangeStateTransfer_MsgEntry::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void EpochChangeStateTransfer_MsgEntry::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void EpochChangeStateTransfer_MsgEntry::Clear() {
+// @@protoc_insertion_point(message_clear_start:dsnet.transaction.eris.proto.EpochChangeStateTransfer.MsgEntry)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    ::memset(&_impl_.shard_num_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.msg_num_) -
+        reinterpret_cast<char*>(&_impl_.shard_num_)) + sizeof(_impl_.msg_num_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* EpochChangeStateTransfer_MsgEntry::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required uint32 shard_num = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_shard_num(&has_bits);
+          _impl_.shard_num_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required uint32 replica_num = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _Internal::set_has_replica_num(&has_bits);
+          _impl_.replica_num_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required uint64 msg_num = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _Internal::set_has_msg_num(&has_bits);
+          _impl_.msg_num_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* EpochChangeStateTransfer_MsgEntry::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:dsnet.transaction.eris.proto.EpochChangeStateTransfer.MsgEntry)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required uint32 shard_num = 1;
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(1, this->_internal_shard_num(), target);
+  }
+
+  // required uint32 replica_num = 2;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(2, this->_internal_replica_num(), target);
+  }
+
+  // required uint64 msg_num = 3;
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(3, this->_internal_msg_num(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:dsnet.transaction.eris.proto.EpochChangeStateTransfer.MsgEntry)
+  return target;
+}
+
+size_t EpochChangeStateTransfer_MsgEntry::RequiredFieldsByteSizeFallback() const {
+// @@protoc_insertion_point(required_fields_byte_size_fallback_start:dsnet.transaction.eris.proto.EpochChangeStateTransfer.MsgEntry)
+  size_t total_size = 0;
+
+  if (_internal_has_shard_num()) {
+    // required uint32 shard_num = 1;
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_shard_num());
+  }
+
+  if (_internal_has_replica_num()) {
+    // required uint32 replica_num = 2;
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_replica_num());
+  }
+
+  if (_internal_has_msg_num()) {
+    // required uint64 msg_num = 3;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_msg_num());
+  }
+
+  return total_size;
+}
+size_t EpochChangeStateTransfer_MsgEntry::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:dsnet.transaction.eris.proto.EpochChangeStateTransfer.MsgEntry)
+  size_t total_size = 0;
+
+  if (((_impl_._has_bits_[0] & 0x00000007) ^ 0x00000007) == 0) {  // All required fields are present.
+    // required uint32 shard_num = 1;
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_shard_num());
+
+    // required uint32 replica_num = 2;
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_replica_num());
+
+    // required uint64 msg_num = 3;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_msg_num());
+
+  } else {
+    total_size += RequiredFieldsByteSizeFallback();
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData EpochChangeStateTransfer_MsgEntry::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    EpochChangeStateTransfer_MsgEntry::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*EpochChangeStateTransfer_MsgEntry::GetClassData() const { return &_class_data_; }
+
+
+void EpochChangeStateTransfer_MsgEntry::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<EpochChangeStateTransfer_MsgEntry*>(&to_msg);
+  auto& from = static_cast<const EpochChangeStateTransfer_MsgEntry&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:dsnet.transaction.eris.proto.EpochChangeStateTransfer.MsgEntry)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_impl_.shard_num_ = from._impl_.shard_num_;
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.replica_num_ = from._impl_.replica_num_;
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.msg_num_ = from._impl_.msg_num_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void EpochChangeStateTransfer_MsgEntry::CopyFrom(const EpochChangeStateTransfer_MsgEntry& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:dsnet.transaction.eris.proto.EpochChangeStateTransfer.MsgEntry)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool EpochChangeStateTransfer_MsgEntry::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  return true;
+}
+
+void EpochChangeStateTransfer_MsgEntry::InternalSwap(EpochChangeStateTransfer_MsgEntry* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(EpochChangeStateTransfer_MsgEntry, _impl_.msg_num_)
+      + sizeof(EpochChangeStateTransfer_MsgEntry::_impl_.msg_num_)
+      - PROTOBUF_FIELD_OFFSET(EpochChangeStateTransfer_MsgEntry, _impl_.shard_num_)>(
+          reinterpret_cast<char*>(&_impl_.shard_num_),
+          reinterpret_cast<char*>(&other->_impl_.shard_num_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata EpochChangeStateTransfer_MsgEntry::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_transaction_2feris_2feris_2dproto_2eproto_getter, &descriptor_table_transaction_2feris_2feris_2dproto_2eproto_once,
+      file_level_metadata_transaction_2feris_2feris_2dproto_2eproto[30]);
+}
+
+// ===================================================================
+
+class EpochChangeStateTransfer::_Internal {
+ public:
+  using HasBits = decltype(std::declval<EpochChangeStateTransfer>()._impl_._has_bits_);
+  static void set_has_epoch_num(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_state_transfer_epoch_num(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000003) ^ 0x00000003) != 0;
+  }
+};
+
+EpochChangeStateTransfer::EpochChangeStateTransfer(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:dsnet.transaction.eris.proto.EpochChangeStateTransfer)
+}
+EpochChangeStateTransfer::EpochChangeStateTransfer(const EpochChangeStateTransfer& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  EpochChangeStateTransfer* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.perm_drops_){from._impl_.perm_drops_}
+    , decltype(_impl_.latest_msgs_){from._impl_.latest_msgs_}
+    , decltype(_impl_.epoch_num_){}
+    , decltype(_impl_.state_transfer_epoch_num_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.epoch_num_, &from._impl_.epoch_num_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.state_transfer_epoch_num_) -
+    reinterpret_cast<char*>(&_impl_.epoch_num_)) + sizeof(_impl_.state_transfer_epoch_num_));
+  // @@protoc_insertion_point(copy_constructor:dsnet.transaction.eris.proto.EpochChangeStateTransfer)
+}
+
+inline void EpochChangeStateTransfer::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.perm_drops_){arena}
+    , decltype(_impl_.latest_msgs_){arena}
+    , decltype(_impl_.epoch_num_){0u}
+    , decltype(_impl_.state_transfer_epoch_num_){0u}
+  };
+}
+
+EpochChangeStateTransfer::~EpochChangeStateTransfer() {
+  // @@protoc_insertion_point(destructor:dsnet.transaction.eris.proto.EpochChangeStateTransfer)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void EpochChangeStateTransfer::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.perm_drops_.~RepeatedPtrField();
+  _impl_.latest_msgs_.~RepeatedPtrField();
+}
+
+void EpochChangeStateTransfer::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void EpochChangeStateTransfer::Clear() {
+// @@protoc_insertion_point(message_clear_start:dsnet.transaction.eris.proto.EpochChangeStateTransfer)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.perm_drops_.Clear();
+  _impl_.latest_msgs_.Clear();
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    ::memset(&_impl_.epoch_num_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.state_transfer_epoch_num_) -
+        reinterpret_cast<char*>(&_impl_.epoch_num_)) + sizeof(_impl_.state_transfer_epoch_num_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* EpochChangeStateTransfer::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required uint32 epoch_num = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_epoch_num(&has_bits);
+          _impl_.epoch_num_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required uint32 state_transfer_epoch_num = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _Internal::set_has_state_transfer_epoch_num(&has_bits);
+          _impl_.state_transfer_epoch_num_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .dsnet.transaction.eris.proto.Stamp perm_drops = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_perm_drops(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<26>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .dsnet.transaction.eris.proto.EpochChangeStateTransfer.MsgEntry latest_msgs = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_latest_msgs(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<34>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* EpochChangeStateTransfer::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:dsnet.transaction.eris.proto.EpochChangeStateTransfer)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required uint32 epoch_num = 1;
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(1, this->_internal_epoch_num(), target);
+  }
+
+  // required uint32 state_transfer_epoch_num = 2;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(2, this->_internal_state_transfer_epoch_num(), target);
+  }
+
+  // repeated .dsnet.transaction.eris.proto.Stamp perm_drops = 3;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_perm_drops_size()); i < n; i++) {
+    const auto& repfield = this->_internal_perm_drops(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(3, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  // repeated .dsnet.transaction.eris.proto.EpochChangeStateTransfer.MsgEntry latest_msgs = 4;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_latest_msgs_size()); i < n; i++) {
+    const auto& repfield = this->_internal_latest_msgs(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(4, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:dsnet.transaction.eris.proto.EpochChangeStateTransfer)
+  return target;
+}
+
+size_t EpochChangeStateTransfer::RequiredFieldsByteSizeFallback() const {
+// @@protoc_insertion_point(required_fields_byte_size_fallback_start:dsnet.transaction.eris.proto.EpochChangeStateTransfer)
+  size_t total_size = 0;
+
+  if (_internal_has_epoch_num()) {
+    // required uint32 epoch_num = 1;
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_epoch_num());
+  }
+
+  if (_internal_has_state_transfer_epoch_num()) {
+    // required uint32 state_transfer_epoch_num = 2;
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_state_transfer_epoch_num());
+  }
+
+  return total_size;
+}
+size_t EpochChangeStateTransfer::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:dsnet.transaction.eris.proto.EpochChangeStateTransfer)
+  size_t total_size = 0;
+
+  if (((_impl_._has_bits_[0] & 0x00000003) ^ 0x00000003) == 0) {  // All required fields are present.
+    // required uint32 epoch_num = 1;
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_epoch_num());
+
+    // required uint32 state_transfer_epoch_num = 2;
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_state_transfer_epoch_num());
+
+  } else {
+    total_size += RequiredFieldsByteSizeFallback();
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .dsnet.transaction.eris.proto.Stamp perm_drops = 3;
+  total_size += 1UL * this->_internal_perm_drops_size();
+  for (const auto& msg : this->_impl_.perm_drops_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // repeated .dsnet.transaction.eris.proto.EpochChangeStateTransfer.MsgEntry latest_msgs = 4;
+  total_size += 1UL * this->_internal_latest_msgs_size();
+  for (const auto& msg : this->_impl_.latest_msgs_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData EpochChangeStateTransfer::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    EpochChangeStateTransfer::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*EpochChangeStateTransfer::GetClassData() const { return &_class_data_; }
+
+
+void EpochChangeStateTransfer::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<EpochChangeStateTransfer*>(&to_msg);
+  auto& from = static_cast<const EpochChangeStateTransfer&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:dsnet.transaction.eris.proto.EpochChangeStateTransfer)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.perm_drops_.MergeFrom(from._impl_.perm_drops_);
+  _this->_impl_.latest_msgs_.MergeFrom(from._impl_.latest_msgs_);
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_impl_.epoch_num_ = from._impl_.epoch_num_;
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.state_transfer_epoch_num_ = from._impl_.state_transfer_epoch_num_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void EpochChangeStateTransfer::CopyFrom(const EpochChangeStateTransfer& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:dsnet.transaction.eris.proto.EpochChangeStateTransfer)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool EpochChangeStateTransfer::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  if (!::PROTOBUF_NAMESPACE_ID::internal::AllAreInitialized(_impl_.perm_drops_))
+    return false;
+  if (!::PROTOBUF_NAMESPACE_ID::internal::AllAreInitialized(_impl_.latest_msgs_))
+    return false;
+  return true;
+}
+
+void EpochChangeStateTransfer::InternalSwap(EpochChangeStateTransfer* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  _impl_.perm_drops_.InternalSwap(&other->_impl_.perm_drops_);
+  _impl_.latest_msgs_.InternalSwap(&other->_impl_.latest_msgs_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(EpochChangeStateTransfer, _impl_.state_transfer_epoch_num_)
+      + sizeof(EpochChangeStateTransfer::_impl_.state_transfer_epoch_num_)
+      - PROTOBUF_FIELD_OFFSET(EpochChangeStateTransfer, _impl_.epoch_num_)>(
+          reinterpret_cast<char*>(&_impl_.epoch_num_),
+          reinterpret_cast<char*>(&other->_impl_.epoch_num_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata EpochChangeStateTransfer::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_transaction_2feris_2feris_2dproto_2eproto_getter, &descriptor_table_transaction_2feris_2feris_2dproto_2eproto_once,
+      file_level_metadata_transaction_2feris_2feris_2dproto_2eproto[31]);
+}
+
+// ===================================================================
+
+class StartEpoch::_Internal {
+ public:
+  using HasBits = decltype(std::declval<StartEpoch>()._impl_._has_bits_);
+  static const ::dsnet::transaction::eris::proto::ViewNum& new_view(const StartEpoch* msg);
+  static void set_has_new_view(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_last_normal_epoch_num(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_latest_replica_num(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+  static void set_has_latest_op_num(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x0000000f) ^ 0x0000000f) != 0;
+  }
+};
+
+const ::dsnet::transaction::eris::proto::ViewNum&
+StartEpoch::_Internal::new_view(const StartEpoch* msg) {
+  return *msg->_impl_.new_view_;
+}
+StartEpoch::StartEpoch(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:dsnet.transaction.eris.proto.StartEpoch)
+}
+StartEpoch::StartEpoch(const StartEpoch& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  StartEpoch* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.perm_drops_){from._impl_.perm_drops_}
+    , decltype(_impl_.new_view_){nullptr}
+    , decltype(_impl_.last_normal_epoch_num_){}
+    , decltype(_impl_.latest_op_num_){}
+    , decltype(_impl_.latest_replica_num_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  if (from._internal_has_new_view()) {
+    _this->_impl_.new_view_ = new ::dsnet::transaction::eris::proto::ViewNum(*from._impl_.new_view_);
+  }
+  ::memcpy(&_impl_.last_normal_epoch_num_, &from._impl_.last_normal_epoch_num_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.latest_replica_num_) -
+    reinterpret_cast<char*>(&_impl_.last_normal_epoch_num_)) + sizeof(_impl_.latest_replica_num_));
+  // @@protoc_insertion_point(copy_constructor:dsnet.transaction.eris.proto.StartEpoch)
+}
+
+inline void StartEpoch::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.perm_drops_){arena}
+    , decltype(_impl_.new_view_){nullptr}
+    , decltype(_impl_.last_normal_epoch_num_){uint64_t{0u}}
+    , decltype(_impl_.latest_op_num_){uint64_t{0u}}
+    , decltype(_impl_.latest_replica_num_){0u}
+  };
+}
+
+StartEpoch::~StartEpoch() {
+  // @@protoc_insertion_point(destructor:dsnet.transaction.eris.proto.StartEpoch)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void StartEpoch::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.perm_drops_.~RepeatedPtrField();
+  if (this != internal_default_instance()) delete _impl_.new_view_;
+}
+
+void StartEpoch::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void StartEpoch::Clear() {
+// @@protoc_insertion_point(message_clear_start:dsnet.transaction.eris.proto.StartEpoch)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.perm_drops_.Clear();
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    GOOGLE_DCHECK(_impl_.new_view_ != nullptr);
+    _impl_.new_view_->Clear();
+  }
+  if (cached_has_bits & 0x0000000eu) {
+    ::memset(&_impl_.last_normal_epoch_num_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.latest_replica_num_) -
+        reinterpret_cast<char*>(&_impl_.last_normal_epoch_num_)) + sizeof(_impl_.latest_replica_num_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* StartEpoch::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required .dsnet.transaction.eris.proto.ViewNum new_view = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr = ctx->ParseMessage(_internal_mutable_new_view(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required uint64 last_normal_epoch_num = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _Internal::set_has_last_normal_epoch_num(&has_bits);
+          _impl_.last_normal_epoch_num_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .dsnet.transaction.eris.proto.Stamp perm_drops = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_perm_drops(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<26>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // required uint32 latest_replica_num = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _Internal::set_has_latest_replica_num(&has_bits);
+          _impl_.latest_replica_num_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required uint64 latest_op_num = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          _Internal::set_has_latest_op_num(&has_bits);
+          _impl_.latest_op_num_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* StartEpoch::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:dsnet.transaction.eris.proto.StartEpoch)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required .dsnet.transaction.eris.proto.ViewNum new_view = 1;
+  if (cached_has_bits & 0x00000001u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(1, _Internal::new_view(this),
+        _Internal::new_view(this).GetCachedSize(), target, stream);
+  }
+
+  // required uint64 last_normal_epoch_num = 2;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(2, this->_internal_last_normal_epoch_num(), target);
+  }
+
+  // repeated .dsnet.transaction.eris.proto.Stamp perm_drops = 3;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_perm_drops_size()); i < n; i++) {
+    const auto& repfield = this->_internal_perm_drops(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(3, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  // required uint32 latest_replica_num = 4;
+  if (cached_has_bits & 0x00000008u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(4, this->_internal_latest_replica_num(), target);
+  }
+
+  // required uint64 latest_op_num = 5;
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(5, this->_internal_latest_op_num(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:dsnet.transaction.eris.proto.StartEpoch)
+  return target;
+}
+
+size_t StartEpoch::RequiredFieldsByteSizeFallback() const {
+// @@protoc_insertion_point(required_fields_byte_size_fallback_start:dsnet.transaction.eris.proto.StartEpoch)
+  size_t total_size = 0;
+
+  if (_internal_has_new_view()) {
+    // required .dsnet.transaction.eris.proto.ViewNum new_view = 1;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.new_view_);
+  }
+
+  if (_internal_has_last_normal_epoch_num()) {
+    // required uint64 last_normal_epoch_num = 2;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_last_normal_epoch_num());
+  }
+
+  if (_internal_has_latest_op_num()) {
+    // required uint64 latest_op_num = 5;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_latest_op_num());
+  }
+
+  if (_internal_has_latest_replica_num()) {
+    // required uint32 latest_replica_num = 4;
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_latest_replica_num());
+  }
+
+  return total_size;
+}
+size_t StartEpoch::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:dsnet.transaction.eris.proto.StartEpoch)
+  size_t total_size = 0;
+
+  if (((_impl_._has_bits_[0] & 0x0000000f) ^ 0x0000000f) == 0) {  // All required fields are present.
+    // required .dsnet.transaction.eris.proto.ViewNum new_view = 1;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.new_view_);
+
+    // required uint64 last_normal_epoch_num = 2;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_last_normal_epoch_num());
+
+    // required uint64 latest_op_num = 5;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_latest_op_num());
+
+    // required uint32 latest_replica_num = 4;
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_latest_replica_num());
+
+  } else {
+    total_size += RequiredFieldsByteSizeFallback();
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .dsnet.transaction.eris.proto.Stamp perm_drops = 3;
+  total_size += 1UL * this->_internal_perm_drops_size();
+  for (const auto& msg : this->_impl_.perm_drops_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData StartEpoch::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    StartEpoch::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*StartEpoch::GetClassData() const { return &_class_data_; }
+
+
+void StartEpoch::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<StartEpoch*>(&to_msg);
+  auto& from = static_cast<const StartEpoch&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:dsnet.transaction.eris.proto.StartEpoch)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.perm_drops_.MergeFrom(from._impl_.perm_drops_);
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000000fu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_mutable_new_view()->::dsnet::transaction::eris::proto::ViewNum::MergeFrom(
+          from._internal_new_view());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.last_normal_epoch_num_ = from._impl_.last_normal_epoch_num_;
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.latest_op_num_ = from._impl_.latest_op_num_;
+    }
+    if (cached_has_bits & 0x00000008u) {
+      _this->_impl_.latest_replica_num_ = from._impl_.latest_replica_num_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void StartEpoch::CopyFrom(const StartEpoch& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:dsnet.transaction.eris.proto.StartEpoch)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool StartEpoch::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  if (!::PROTOBUF_NAMESPACE_ID::internal::AllAreInitialized(_impl_.perm_drops_))
+    return false;
+  if (_internal_has_new_view()) {
+    if (!_impl_.new_view_->IsInitialized()) return false;
+  }
+  return true;
+}
+
+void StartEpoch::InternalSwap(StartEpoch* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  _impl_.perm_drops_.InternalSwap(&other->_impl_.perm_drops_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(StartEpoch, _impl_.latest_replica_num_)
+      + sizeof(StartEpoch::_impl_.latest_replica_num_)
+      - PROTOBUF_FIELD_OFFSET(StartEpoch, _impl_.new_view_)>(
+          reinterpret_cast<char*>(&_impl_.new_view_),
+          reinterpret_cast<char*>(&other->_impl_.new_view_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata StartEpoch::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_transaction_2feris_2feris_2dproto_2eproto_getter, &descriptor_table_transaction_2feris_2feris_2dproto_2eproto_once,
+      file_level_metadata_transaction_2feris_2feris_2dproto_2eproto[32]);
+}
+
+// ===================================================================
+
+class FCToErisMessage::_Internal {
+ public:
+  static const ::dsnet::transaction::eris::proto::TxnCheck& txn_check(const FCToErisMessage* msg);
+  static const ::dsnet::transaction::eris::proto::TxnFound& txn_found(const FCToErisMessage* msg);
+  static const ::dsnet::transaction::eris::proto::DropTxn& drop_txn(const FCToErisMessage* msg);
+  static const ::dsnet::transaction::eris::proto::EpochChange& epoch_change(const FCToErisMessage* msg);
+  static const ::dsnet::transaction::eris::proto::EpochChangeStateTransfer& epoch_change_state_transfer(const FCToErisMessage* msg);
+  static const ::dsnet::transaction::eris::proto::StartEpoch& start_epoch(const FCToErisMessage* msg);
+};
+
+const ::dsnet::transaction::eris::proto::TxnCheck&
+FCToErisMessage::_Internal::txn_check(const FCToErisMessage* msg) {
+  return *msg->_impl_.msg_.txn_check_;
+}
+const ::dsnet::transaction::eris::proto::TxnFound&
+FCToErisMessage::_Internal::txn_found(const FCToErisMessage* msg) {
+  return *msg->_impl_.msg_.txn_found_;
+}
+const ::dsnet::transaction::eris::proto::DropTxn&
+FCToErisMessage::_Internal::drop_txn(const FCToErisMessage* msg) {
+  return *msg->_impl_.msg_.drop_txn_;
+}
+const ::dsnet::transaction::eris::proto::EpochChange&
+FCToErisMessage::_Internal::epoch_change(const FCToErisMessage* msg) {
+  return *msg->_impl_.msg_.epoch_change_;
+}
+const ::dsnet::transaction::eris::proto::EpochChangeStateTransfer&
+FCToErisMessage::_Internal::epoch_change_state_transfer(const FCToErisMessage* msg) {
+  return *msg->_impl_.msg_.epoch_change_state_transfer_;
+}
+const ::dsnet::transaction::eris::proto::StartEpoch&
+FCToErisMessage::_Internal::start_epoch(const FCToErisMessage* msg) {
+  return *msg->_impl_.msg_.start_epoch_;
+}
+void FCToErisMessage::set_allocated_txn_check(::dsnet::transaction::eris::proto::TxnCheck* txn_check) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  clear_msg();
+  if (txn_check) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(txn_check);
+    if (message_arena != submessage_arena) {
+      txn_check = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, txn_check, submessage_arena);
+    }
+    set_has_txn_check();
+    _impl_.msg_.txn_check_ = txn_check;
+  }
+  // @@protoc_insertion_point(field_set_allocated:dsnet.transaction.eris.proto.FCToErisMessage.txn_check)
+}
+void FCToErisMessage::set_allocated_txn_found(::dsnet::transaction::eris::proto::TxnFound* txn_found) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  clear_msg();
+  if (txn_found) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(txn_found);
+    if (message_arena != submessage_arena) {
+      txn_found = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, txn_found, submessage_arena);
+    }
+    set_has_txn_found();
+    _impl_.msg_.txn_found_ = txn_found;
+  }
+  // @@protoc_insertion_point(field_set_allocated:dsnet.transaction.eris.proto.FCToErisMessage.txn_found)
+}
+void FCToErisMessage::set_allocated_drop_txn(::dsnet::transaction::eris::proto::DropTxn* drop_txn) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  clear_msg();
+  if (drop_txn) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(drop_txn);
+    if (message_arena != submessage_arena) {
+      drop_txn = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, drop_txn, submessage_arena);
+    }
+    set_has_drop_txn();
+    _impl_.msg_.drop_txn_ = drop_txn;
+  }
+  // @@protoc_insertion_point(field_set_allocated:dsnet.transaction.eris.proto.FCToErisMessage.drop_txn)
+}
+void FCToErisMessage::set_allocated_epoch_change(::dsnet::transaction::eris::proto::EpochChange* epoch_change) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  clear_msg();
+  if (epoch_change) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(epoch_change);
+    if (message_arena != submessage_arena) {
+      epoch_change = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, epoch_change, submessage_arena);
+    }
+    set_has_epoch_change();
+    _impl_.msg_.epoch_change_ = epoch_change;
+  }
+  // @@protoc_insertion_point(field_set_allocated:dsnet.transaction.eris.proto.FCToErisMessage.epoch_change)
+}
+void FCToErisMessage::set_allocated_epoch_change_state_transfer(::dsnet::transaction::eris::proto::EpochChangeStateTransfer* epoch_change_state_transfer) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  clear_msg();
+  if (epoch_change_state_transfer) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(epoch_change_state_transfer);
+    if (message_arena != submessage_arena) {
+      epoch_change_state_transfer = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, epoch_change_state_transfer, submessage_arena);
+    }
+    set_has_epoch_change_state_transfer();
+    _impl_.msg_.epoch_change_state_transfer_ = epoch_change_state_transfer;
+  }
+  // @@protoc_insertion_point(field_set_allocated:dsnet.transaction.eris.proto.FCToErisMessage.epoch_change_state_transfer)
+}
+void FCToErisMessage::set_allocated_start_epoch(::dsnet::transaction::eris::proto::StartEpoch* start_epoch) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  clear_msg();
+  if (start_epoch) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(start_epoch);
+    if (message_arena != submessage_arena) {
+      start_epoch = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, start_epoch, submessage_arena);
+    }
+    set_has_start_epoch();
+    _impl_.msg_.start_epoch_ = start_epoch;
+  }
+  // @@protoc_insertion_point(field_set_allocated:dsnet.transaction.eris.proto.FCToErisMessage.start_epoch)
+}
+FCToErisMessage::FCToErisMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:dsnet.transaction.eris.proto.FCToErisMessage)
+}
+FCToErisMessage::FCToErisMessage(const FCToErisMessage& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  FCToErisMessage* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.msg_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , /*decltype(_impl_._oneof_case_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  clear_has_msg();
+  switch (from.msg_case()) {
+    case kTxnCheck: {
+      _this->_internal_mutable_txn_check()->::dsnet::transaction::eris::proto::TxnCheck::MergeFrom(
+          from._internal_txn_check());
+      break;
+    }
+    case kTxnFound: {
+      _this->_internal_mutable_txn_found()->::dsnet::transaction::eris::proto::TxnFound::MergeFrom(
+          from._internal_txn_found());
+      break;
+    }
+    case kDropTxn: {
+      _this->_internal_mutable_drop_txn()->::dsnet::transaction::eris::proto::DropTxn::MergeFrom(
+          from._internal_drop_txn());
+      break;
+    }
+    case kEpochChange: {
+      _this->_internal_mutable_epoch_change()->::dsnet::transaction::eris::proto::EpochChange::MergeFrom(
+          from._internal_epoch_change());
+      break;
+    }
+    case kEpochChangeStateTransfer: {
+      _this->_internal_mutable_epoch_change_state_transfer()->::dsnet::transaction::eris::proto::EpochChangeStateTransfer::MergeFrom(
+          from._internal_epoch_change_state_transfer());
+      break;
+    }
+    case kStartEpoch: {
+      _this->_internal_mutable_start_epoch()->::dsnet::transaction::eris::proto::StartEpoch::MergeFrom(
+          from._internal_start_epoch());
+      break;
+    }
+    case MSG_NOT_SET: {
+      break;
+    }
+  }
+  // @@protoc_insertion_point(copy_constructor:dsnet.transaction.eris.proto.FCToErisMessage)
+}
+
+inline void FCToErisMessage::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.msg_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , /*decltype(_impl_._oneof_case_)*/{}
+  };
+  clear_has_msg();
+}
+
+FCToErisMessage::~FCToErisMessage() {
+  // @@protoc_insertion_point(destructor:dsnet.transaction.eris.proto.FCToErisMessage)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void FCToErisMessage::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  if (has_msg()) {
+    clear_msg();
+  }
+}
+
+void FCToErisMessage::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void FCToErisMessage::clear_msg() {
+// @@protoc_insertion_point(one_of_clear_start:dsnet.transaction.eris.proto.FCToErisMessage)
+  switch (msg_case()) {
+    case kTxnCheck: {
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.msg_.txn_check_;
+      }
+      break;
+    }
+    case kTxnFound: {
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.msg_.txn_found_;
+      }
+      break;
+    }
+    case kDropTxn: {
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.msg_.drop_txn_;
+      }
+      break;
+    }
+    case kEpochChange: {
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.msg_.epoch_change_;
+      }
+      break;
+    }
+    case kEpochChangeStateTransfer: {
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.msg_.epoch_change_state_transfer_;
+      }
+      break;
+    }
+    case kStartEpoch: {
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.msg_.start_epoch_;
+      }
+      break;
+    }
+    case MSG_NOT_SET: {
+      break;
+    }
+  }
+  _impl_._oneof_case_[0] = MSG_NOT_SET;
+}
+
+
+void FCToErisMessage::Clear() {
+// @@protoc_insertion_point(message_clear_start:dsnet.transaction.eris.proto.FCToErisMessage)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  clear_msg();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* FCToErisMessage::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // .dsnet.transaction.eris.proto.TxnCheck txn_check = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr = ctx->ParseMessage(_internal_mutable_txn_check(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .dsnet.transaction.eris.proto.TxnFound txn_found = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr = ctx->ParseMessage(_internal_mutable_txn_found(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .dsnet.transaction.eris.proto.DropTxn drop_txn = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          ptr = ctx->ParseMessage(_internal_mutable_drop_txn(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .dsnet.transaction.eris.proto.EpochChange epoch_change = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          ptr = ctx->ParseMessage(_internal_mutable_epoch_change(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .dsnet.transaction.eris.proto.EpochChangeStateTransfer epoch_change_state_transfer = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 42)) {
+          ptr = ctx->ParseMessage(_internal_mutable_epoch_change_state_transfer(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .dsnet.transaction.eris.proto.StartEpoch start_epoch = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 50)) {
+          ptr = ctx->ParseMessage(_internal_mutable_start_epoch(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* FCToErisMessage::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:dsnet.transaction.eris.proto.FCToErisMessage)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  switch (msg_case()) {
+    case kTxnCheck: {
+      target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(1, _Internal::txn_check(this),
+          _Internal::txn_check(this).GetCachedSize(), target, stream);
+      break;
+    }
+    case kTxnFound: {
+      target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(2, _Internal::txn_found(this),
+          _Internal::txn_found(this).GetCachedSize(), target, stream);
+      break;
+    }
+    case kDropTxn: {
+      target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(3, _Internal::drop_txn(this),
+          _Internal::drop_txn(this).GetCachedSize(), target, stream);
+      break;
+    }
+    case kEpochChange: {
+      target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(4, _Internal::epoch_change(this),
+          _Internal::epoch_change(this).GetCachedSize(), target, stream);
+      break;
+    }
+    case kEpochChangeStateTransfer: {
+      target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(5, _Internal::epoch_change_state_transfer(this),
+          _Internal::epoch_change_state_transfer(this).GetCachedSize(), target, stream);
+      break;
+    }
+    case kStartEpoch: {
+      target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(6, _Internal::start_epoch(this),
+          _Internal::start_epoch(this).GetCachedSize(), target, stream);
+      break;
+    }
+    default: ;
+  }
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:dsnet.transaction.eris.proto.FCToErisMessage)
+  return target;
+}
+
+size_t FCToErisMessage::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:dsnet.transaction.eris.proto.FCToErisMessage)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  switch (msg_case()) {
+    // .dsnet.transaction.eris.proto.TxnCheck txn_check = 1;
+    case kTxnCheck: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.msg_.txn_check_);
+      break;
+    }
+    // .dsnet.transaction.eris.proto.TxnFound txn_found = 2;
+    case kTxnFound: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.msg_.txn_found_);
+      break;
+    }
+    // .dsnet.transaction.eris.proto.DropTxn drop_txn = 3;
+    case kDropTxn: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.msg_.drop_txn_);
+      break;
+    }
+    // .dsnet.transaction.eris.proto.EpochChange epoch_change = 4;
+    case kEpochChange: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.msg_.epoch_change_);
+      break;
+    }
+    // .dsnet.transaction.eris.proto.EpochChangeStateTransfer epoch_change_state_transfer = 5;
+    case kEpochChangeStateTransfer: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.msg_.epoch_change_state_transfer_);
+      break;
+    }
+    // .dsnet.transaction.eris.proto.StartEpoch start_epoch = 6;
+    case kStartEpoch: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.msg_.start_epoch_);
+      break;
+    }
+    case MSG_NOT_SET: {
+      break;
+    }
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData FCToErisMessage::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    FCToErisMessage::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*FCToErisMessage::GetClassData() const { return &_class_data_; }
+
+
+void FCToErisMessage::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<FCToErisMessage*>(&to_msg);
+  auto& from = static_cast<const FCToErisMessage&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:dsnet.transaction.eris.proto.FCToErisMessage)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  switch (from.msg_case()) {
+    case kTxnCheck: {
+      _this->_internal_mutable_txn_check()->::dsnet::transaction::eris::proto::TxnCheck::MergeFrom(
+          from._internal_txn_check());
+      break;
+    }
+    case kTxnFound: {
+      _this->_internal_mutable_txn_found()->::dsnet::transaction::eris::proto::TxnFound::MergeFrom(
+          from._internal_txn_found());
+      break;
+    }
+    case kDropTxn: {
+      _this->_internal_mutable_drop_txn()->::dsnet::transaction::eris::proto::DropTxn::MergeFrom(
+          from._internal_drop_txn());
+      break;
+    }
+    case kEpochChange: {
+      _this->_internal_mutable_epoch_change()->::dsnet::transaction::eris::proto::EpochChange::MergeFrom(
+          from._internal_epoch_change());
+      break;
+    }
+    case kEpochChangeStateTransfer: {
+      _this->_internal_mutable_epoch_change_state_transfer()->::dsnet::transaction::eris::proto::EpochChangeStateTransfer::MergeFrom(
+          from._internal_epoch_change_state_transfer());
+      break;
+    }
+    case kStartEpoch: {
+      _this->_internal_mutable_start_epoch()->::dsnet::transaction::eris::proto::StartEpoch::MergeFrom(
+          from._internal_start_epoch());
+      break;
+    }
+    case MSG_NOT_SET: {
+      break;
+    }
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void FCToErisMessage::CopyFrom(const FCToErisMessage& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:dsnet.transaction.eris.proto.FCToErisMessage)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool FCToErisMessage::IsInitialized() const {
+  switch (msg_case()) {
+    case kTxnCheck: {
+      if (_internal_has_txn_check()) {
+        if (!_impl_.msg_.txn_check_->IsInitialized()) return false;
+      }
+      break;
+    }
+    case kTxnFound: {
+      if (_internal_has_txn_found()) {
+        if (!_impl_.msg_.txn_found_->IsInitialized()) return false;
+      }
+      break;
+    }
+    case kDropTxn: {
+      if (_internal_has_drop_txn()) {
+        if (!_impl_.msg_.drop_txn_->IsInitialized()) return false;
+      }
+      break;
+    }
+    case kEpochChange: {
+      if (_internal_has_epoch_change()) {
+        if (!_impl_.msg_.epoch_change_->IsInitialized()) return false;
+      }
+      break;
+    }
+    case kEpochChangeStateTransfer: {
+      if (_internal_has_epoch_change_state_transfer()) {
+        if (!_impl_.msg_.epoch_change_state_transfer_->IsInitialized()) return false;
+      }
+      break;
+    }
+    case kStartEpoch: {
+      if (_internal_has_start_epoch()) {
+        if (!_impl_.msg_.start_epoch_->IsInitialized()) return false;
+      }
+      break;
+    }
+    case MSG_NOT_SET: {
+      break;
+    }
+  }
+  return true;
+}
+
+void FCToErisMessage::InternalSwap(FCToErisMessage* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_.msg_, other->_impl_.msg_);
+  swap(_impl_._oneof_case_[0], other->_impl_._oneof_case_[0]);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata FCToErisMessage::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_transaction_2feris_2feris_2dproto_2eproto_getter, &descriptor_table_transaction_2feris_2feris_2dproto_2eproto_once,
+      file_level_metadata_transaction_2feris_2feris_2dproto_2eproto[33]);
+}
+
+// @@protoc_insertion_point(namespace_scope)
+}  // namespace proto
+}  // namespace eris
+}  // namespace transaction
+}  // namespace dsnet
+PROTOBUF_NAMESPACE_OPEN
+template<> PROTOBUF_NOINLINE ::dsnet::transaction::eris::proto::ViewNum*
+Arena::CreateMaybeMessage< ::dsnet::transaction::eris::proto::ViewNum >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::dsnet::transaction::eris::proto::ViewNum >(arena);
+}
+template<> PROTOBUF_NOINLINE ::dsnet::transaction::eris::proto::Stamp*
+Arena::CreateMaybeMessage< ::dsnet::transaction::eris::proto::Stamp >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::dsnet::transaction::eris::proto::Stamp >(arena);
+}
+template<> PROTOBUF_NOINLINE ::dsnet::transaction::eris::proto::ReplyMessage*
+Arena::CreateMaybeMessage< ::dsnet::transaction::eris::proto::ReplyMessage >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::dsnet::transaction::eris::proto::ReplyMessage >(arena);
+}
+template<> PROTOBUF_NOINLINE ::dsnet::transaction::eris::proto::RequestMessage*
+Arena::CreateMaybeMessage< ::dsnet::transaction::eris::proto::RequestMessage >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::dsnet::transaction::eris::proto::RequestMessage >(arena);
+}
+template<> PROTOBUF_NOINLINE ::dsnet::transaction::eris::proto::GapRequestMessage*
+Arena::CreateMaybeMessage< ::dsnet::transaction::eris::proto::GapRequestMessage >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::dsnet::transaction::eris::proto::GapRequestMessage >(arena);
+}
+template<> PROTOBUF_NOINLINE ::dsnet::transaction::eris::proto::GapReplyMessage*
+Arena::CreateMaybeMessage< ::dsnet::transaction::eris::proto::GapReplyMessage >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::dsnet::transaction::eris::proto::GapReplyMessage >(arena);
+}
+template<> PROTOBUF_NOINLINE ::dsnet::transaction::eris::proto::SyncPrepareMessage*
+Arena::CreateMaybeMessage< ::dsnet::transaction::eris::proto::SyncPrepareMessage >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::dsnet::transaction::eris::proto::SyncPrepareMessage >(arena);
+}
+template<> PROTOBUF_NOINLINE ::dsnet::transaction::eris::proto::ViewChangeRequestMessage*
+Arena::CreateMaybeMessage< ::dsnet::transaction::eris::proto::ViewChangeRequestMessage >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::dsnet::transaction::eris::proto::ViewChangeRequestMessage >(arena);
+}
+template<> PROTOBUF_NOINLINE ::dsnet::transaction::eris::proto::DropTxns*
+Arena::CreateMaybeMessage< ::dsnet::transaction::eris::proto::DropTxns >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::dsnet::transaction::eris::proto::DropTxns >(arena);
+}
+template<> PROTOBUF_NOINLINE ::dsnet::transaction::eris::proto::ViewChangeMessage*
+Arena::CreateMaybeMessage< ::dsnet::transaction::eris::proto::ViewChangeMessage >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::dsnet::transaction::eris::proto::ViewChangeMessage >(arena);
+}
+template<> PROTOBUF_NOINLINE ::dsnet::transaction::eris::proto::StartViewMessage*
+Arena::CreateMaybeMessage< ::dsnet::transaction::eris::proto::StartViewMessage >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::dsnet::transaction::eris::proto::StartViewMessage >(arena);
+}
+template<> PROTOBUF_NOINLINE ::dsnet::transaction::eris::proto::StateTransferRequestMessage*
+Arena::CreateMaybeMessage< ::dsnet::transaction::eris::proto::StateTransferRequestMessage >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::dsnet::transaction::eris::proto::StateTransferRequestMessage >(arena);
+}
+template<> PROTOBUF_NOINLINE ::dsnet::transaction::eris::proto::StateTransferReplyMessage_MsgLogEntry*
+Arena::CreateMaybeMessage< ::dsnet::transaction::eris::proto::StateTransferReplyMessage_MsgLogEntry >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::dsnet::transaction::eris::proto::StateTransferReplyMessage_MsgLogEntry >(arena);
+}
+template<> PROTOBUF_NOINLINE ::dsnet::transaction::eris::proto::StateTransferReplyMessage*
+Arena::CreateMaybeMessage< ::dsnet::transaction::eris::proto::StateTransferReplyMessage >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::dsnet::transaction::eris::proto::StateTransferReplyMessage >(arena);
+}
+template<> PROTOBUF_NOINLINE ::dsnet::transaction::eris::proto::EpochChangeStateTransferRequest*
+Arena::CreateMaybeMessage< ::dsnet::transaction::eris::proto::EpochChangeStateTransferRequest >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::dsnet::transaction::eris::proto::EpochChangeStateTransferRequest >(arena);
+}
+template<> PROTOBUF_NOINLINE ::dsnet::transaction::eris::proto::EpochChangeStateTransferReply_MsgEntry*
+Arena::CreateMaybeMessage< ::dsnet::transaction::eris::proto::EpochChangeStateTransferReply_MsgEntry >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::dsnet::transaction::eris::proto::EpochChangeStateTransferReply_MsgEntry >(arena);
+}
+template<> PROTOBUF_NOINLINE ::dsnet::transaction::eris::proto::EpochChangeStateTransferReply*
+Arena::CreateMaybeMessage< ::dsnet::transaction::eris::proto::EpochChangeStateTransferReply >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::dsnet::transaction::eris::proto::EpochChangeStateTransferReply >(arena);
+}
+template<> PROTOBUF_NOINLINE ::dsnet::transaction::eris::proto::ToServerMessage*
+Arena::CreateMaybeMessage< ::dsnet::transaction::eris::proto::ToServerMessage >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::dsnet::transaction::eris::proto::ToServerMessage >(arena);
+}
+template<> PROTOBUF_NOINLINE ::dsnet::transaction::eris::proto::TxnInfoRequest*
+Arena::CreateMaybeMessage< ::dsnet::transaction::eris::proto::TxnInfoRequest >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::dsnet::transaction::eris::proto::TxnInfoRequest >(arena);
+}
+template<> PROTOBUF_NOINLINE ::dsnet::transaction::eris::proto::TxnReceived*
+Arena::CreateMaybeMessage< ::dsnet::transaction::eris::proto::TxnReceived >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::dsnet::transaction::eris::proto::TxnReceived >(arena);
+}
+template<> PROTOBUF_NOINLINE ::dsnet::transaction::eris::proto::TxnTempDropped*
+Arena::CreateMaybeMessage< ::dsnet::transaction::eris::proto::TxnTempDropped >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::dsnet::transaction::eris::proto::TxnTempDropped >(arena);
+}
+template<> PROTOBUF_NOINLINE ::dsnet::transaction::eris::proto::EpochChangeReq*
+Arena::CreateMaybeMessage< ::dsnet::transaction::eris::proto::EpochChangeReq >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::dsnet::transaction::eris::proto::EpochChangeReq >(arena);
+}
+template<> PROTOBUF_NOINLINE ::dsnet::transaction::eris::proto::EpochChangeAck_LogInfoPiece*
+Arena::CreateMaybeMessage< ::dsnet::transaction::eris::proto::EpochChangeAck_LogInfoPiece >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::dsnet::transaction::eris::proto::EpochChangeAck_LogInfoPiece >(arena);
+}
+template<> PROTOBUF_NOINLINE ::dsnet::transaction::eris::proto::EpochChangeAck*
+Arena::CreateMaybeMessage< ::dsnet::transaction::eris::proto::EpochChangeAck >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::dsnet::transaction::eris::proto::EpochChangeAck >(arena);
+}
+template<> PROTOBUF_NOINLINE ::dsnet::transaction::eris::proto::EpochChangeStateTransferAck*
+Arena::CreateMaybeMessage< ::dsnet::transaction::eris::proto::EpochChangeStateTransferAck >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::dsnet::transaction::eris::proto::EpochChangeStateTransferAck >(arena);
+}
+template<> PROTOBUF_NOINLINE ::dsnet::transaction::eris::proto::ErisToFCMessage*
+Arena::CreateMaybeMessage< ::dsnet::transaction::eris::proto::ErisToFCMessage >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::dsnet::transaction::eris::proto::ErisToFCMessage >(arena);
+}
+template<> PROTOBUF_NOINLINE ::dsnet::transaction::eris::proto::TxnCheck*
+Arena::CreateMaybeMessage< ::dsnet::transaction::eris::proto::TxnCheck >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::dsnet::transaction::eris::proto::TxnCheck >(arena);
+}
+template<> PROTOBUF_NOINLINE ::dsnet::transaction::eris::proto::TxnFound*
+Arena::CreateMaybeMessage< ::dsnet::transaction::eris::proto::TxnFound >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::dsnet::transaction::eris::proto::TxnFound >(arena);
+}
+template<> PROTOBUF_NOINLINE ::dsnet::transaction::eris::proto::DropTxn*
+Arena::CreateMaybeMessage< ::dsnet::transaction::eris::proto::DropTxn >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::dsnet::transaction::eris::proto::DropTxn >(arena);
+}
+template<> PROTOBUF_NOINLINE ::dsnet::transaction::eris::proto::EpochChange*
+Arena::CreateMaybeMessage< ::dsnet::transaction::eris::proto::EpochChange >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::dsnet::transaction::eris::proto::EpochChange >(arena);
+}
+template<> PROTOBUF_NOINLINE ::dsnet::transaction::eris::proto::EpochChangeStateTransfer_MsgEntry*
+Arena::CreateMaybeMessage< ::dsnet::transaction::eris::proto::EpochChangeStateTransfer_MsgEntry >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::dsnet::transaction::eris::proto::EpochChangeStateTransfer_MsgEntry >(arena);
+}
+template<> PROTOBUF_NOINLINE ::dsnet::transaction::eris::proto::EpochChangeStateTransfer*
+Arena::CreateMaybeMessage< ::dsnet::transaction::eris::proto::EpochChangeStateTransfer >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::dsnet::transaction::eris::proto::EpochChangeStateTransfer >(arena);
+}
+template<> PROTOBUF_NOINLINE ::dsnet::transaction::eris::proto::StartEpoch*
+Arena::CreateMaybeMessage< ::dsnet::transaction::eris::proto::StartEpoch >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::dsnet::transaction::eris::proto::StartEpoch >(arena);
+}
+template<> PROTOBUF_NOINLINE ::dsnet::transaction::eris::proto::FCToErisMessage*
+Arena::CreateMaybeMessage< ::dsnet::transaction::eris::proto::FCToErisMessage >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::dsnet::transaction::eris::proto::FCToErisMessage >(arena);
+}
+PROTOBUF_NAMESPACE_CLOSE
+
+// @@protoc_insertion_point(global_scope)
+#include <google/protobuf/port_undef.inc>
@@ -0,0 +1,13497 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: transaction/eris/eris-proto.proto
+
+#ifndef GOOGLE_PROTOBUF_INCLUDED_transaction_2feris_2feris_2dproto_2eproto
+#define GOOGLE_PROTOBUF_INCLUDED_transaction_2feris_2feris_2dproto_2eproto
+
+#include <limits>
+#include <string>
+
+#include <google/protobuf/port_def.inc>
+#if PROTOBUF_VERSION < 3021000
+#error This file was generated by a newer version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please update
+#error your headers.
+#endif
+#if 3021012 < PROTOBUF_MIN_PROTOC_VERSION
+#error This file was generated by an older version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please
+#error regenerate this file with a newer version of protoc.
+#endif
+
+#include <google/protobuf/port_undef.inc>
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/arena.h>
+#include <google/protobuf/arenastring.h>
+#include <google/protobuf/generated_message_util.h>
+#include <google/protobuf/metadata_lite.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/message.h>
+#include <google/protobuf/repeated_field.h>  // IWYU pragma: export
+#include <google/protobuf/extension_set.h>  // IWYU pragma: export
+#include <google/protobuf/generated_enum_reflection.h>
+#include <google/protobuf/unknown_field_set.h>
+#include "common/request.pb.h"
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+#define PROTOBUF_INTERNAL_EXPORT_transaction_2feris_2feris_2dproto_2eproto
+PROTOBUF_NAMESPACE_OPEN
+namespace internal {
+class AnyMetadata;
+}  // namespace internal
+PROTOBUF_NAMESPACE_CLOSE
+
+// Internal implementation detail -- do not use these members.
+struct TableStruct_transaction_2feris_2feris_2dproto_2eproto {
+  static const uint32_t offsets[];
+};
+extern const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_transaction_2feris_2feris_2dproto_2eproto;
+namespace dsnet {
+namespace transaction {
+namespace eris {
+namespace proto {
+class DropTxn;
+struct DropTxnDefaultTypeInternal;
+extern DropTxnDefaultTypeInternal _DropTxn_default_instance_;
+class DropTxns;
+struct DropTxnsDefaultTypeInternal;
+extern DropTxnsDefaultTypeInternal _DropTxns_default_instance_;
+class EpochChange;
+struct EpochChangeDefaultTypeInternal;
+extern EpochChangeDefaultTypeInternal _EpochChange_default_instance_;
+class EpochChangeAck;
+struct EpochChangeAckDefaultTypeInternal;
+extern EpochChangeAckDefaultTypeInternal _EpochChangeAck_default_instance_;
+class EpochChangeAck_LogInfoPiece;
+struct EpochChangeAck_LogInfoPieceDefaultTypeInternal;
+extern EpochChangeAck_LogInfoPieceDefaultTypeInternal _EpochChangeAck_LogInfoPiece_default_instance_;
+class EpochChangeReq;
+struct EpochChangeReqDefaultTypeInternal;
+extern EpochChangeReqDefaultTypeInternal _EpochChangeReq_default_instance_;
+class EpochChangeStateTransfer;
+struct EpochChangeStateTransferDefaultTypeInternal;
+extern EpochChangeStateTransferDefaultTypeInternal _EpochChangeStateTransfer_default_instance_;
+class EpochChangeStateTransferAck;
+struct EpochChangeStateTransferAckDefaultTypeInternal;
+extern EpochChangeStateTransferAckDefaultTypeInternal _EpochChangeStateTransferAck_default_instance_;
+class EpochChangeStateTransferReply;
+struct EpochChangeStateTransferReplyDefaultTypeInternal;
+extern EpochChangeStateTransferReplyDefaultTypeInternal _EpochChangeStateTransferReply_default_instance_;
+class EpochChangeStateTransferReply_MsgEntry;
+struct EpochChangeStateTransferReply_MsgEntryDefaultTypeInternal;
+extern EpochChangeStateTransferReply_MsgEntryDefaultTypeInternal _EpochChangeStateTransferReply_MsgEntry_default_instance_;
+class EpochChangeStateTransferRequest;
+struct EpochChangeStateTransferRequestDefaultTypeInternal;
+extern EpochChangeStateTransferRequestDefaultTypeInternal _EpochChangeStateTransferRequest_default_instance_;
+class EpochChangeStateTransfer_MsgEntry;
+struct EpochChangeStateTransfer_MsgEntryDefaultTypeInternal;
+extern EpochChangeStateTransfer_MsgEntryDefaultTypeInternal _EpochChangeStateTransfer_MsgEntry_default_instance_;
+class ErisToFCMessage;
+struct ErisToFCMessageDefaultTypeInternal;
+extern ErisToFCMessageDefaultTypeInternal _ErisToFCMessage_default_instance_;
+class FCToErisMessage;
+struct FCToErisMessageDefaultTypeInternal;
+extern FCToErisMessageDefaultTypeInternal _FCToErisMessage_default_instance_;
+class GapReplyMessage;
+struct GapReplyMessageDefaultTypeInternal;
+extern GapReplyMessageDefaultTypeInternal _GapReplyMessage_default_instance_;
+class GapRequestMessage;
+struct GapRequestMessageDefaultTypeInternal;
+extern GapRequestMessageDefaultTypeInternal _GapRequestMessage_default_instance_;
+class ReplyMessage;
+struct ReplyMessageDefaultTypeInternal;
+extern ReplyMessageDefaultTypeInternal _ReplyMessage_default_instance_;
+class RequestMessage;
+struct RequestMessageDefaultTypeInternal;
+extern RequestMessageDefaultTypeInternal _RequestMessage_default_instance_;
+class Stamp;
+struct StampDefaultTypeInternal;
+extern StampDefaultTypeInternal _Stamp_default_instance_;
+class StartEpoch;
+struct StartEpochDefaultTypeInternal;
+extern StartEpochDefaultTypeInternal _StartEpoch_default_instance_;
+class StartViewMessage;
+struct StartViewMessageDefaultTypeInternal;
+extern StartViewMessageDefaultTypeInternal _StartViewMessage_default_instance_;
+class StateTransferReplyMessage;
+struct StateTransferReplyMessageDefaultTypeInternal;
+extern StateTransferReplyMessageDefaultTypeInternal _StateTransferReplyMessage_default_instance_;
+class StateTransferReplyMessage_MsgLogEntry;
+struct StateTransferReplyMessage_MsgLogEntryDefaultTypeInternal;
+extern StateTransferReplyMessage_MsgLogEntryDefaultTypeInternal _StateTransferReplyMessage_MsgLogEntry_default_instance_;
+class StateTransferRequestMessage;
+struct StateTransferRequestMessageDefaultTypeInternal;
+extern StateTransferRequestMessageDefaultTypeInternal _StateTransferRequestMessage_default_instance_;
+class SyncPrepareMessage;
+struct SyncPrepareMessageDefaultTypeInternal;
+extern SyncPrepareMessageDefaultTypeInternal _SyncPrepareMessage_default_instance_;
+class ToServerMessage;
+struct ToServerMessageDefaultTypeInternal;
+extern ToServerMessageDefaultTypeInternal _ToServerMessage_default_instance_;
+class TxnCheck;
+struct TxnCheckDefaultTypeInternal;
+extern TxnCheckDefaultTypeInternal _TxnCheck_default_instance_;
+class TxnFound;
+struct TxnFoundDefaultTypeInternal;
+extern TxnFoundDefaultTypeInternal _TxnFound_default_instance_;
+class TxnInfoRequest;
+struct TxnInfoRequestDefaultTypeInternal;
+extern TxnInfoRequestDefaultTypeInternal _TxnInfoRequest_default_instance_;
+class TxnReceived;
+struct TxnReceivedDefaultTypeInternal;
+extern TxnReceivedDefaultTypeInternal _TxnReceived_default_instance_;
+class TxnTempDropped;
+struct TxnTempDroppedDefaultTypeInternal;
+extern TxnTempDroppedDefaultTypeInternal _TxnTempDropped_default_instance_;
+class ViewChangeMessage;
+struct ViewChangeMessageDefaultTypeInternal;
+extern ViewChangeMessageDefaultTypeInternal _ViewChangeMessage_default_instance_;
+class ViewChangeRequestMessage;
+struct ViewChangeRequestMessageDefaultTypeInternal;
+extern ViewChangeRequestMessageDefaultTypeInternal _ViewChangeRequestMessage_default_instance_;
+class ViewNum;
+struct ViewNumDefaultTypeInternal;
+extern ViewNumDefaultTypeInternal _ViewNum_default_instance_;
+}  // namespace proto
+}  // namespace eris
+}  // namespace transaction
+}  // namespace dsnet
+PROTOBUF_NAMESPACE_OPEN
+template<> ::dsnet::transaction::eris::proto::DropTxn* Arena::CreateMaybeMessage<::dsnet::transaction::eris::proto::DropTxn>(Arena*);
+template<> ::dsnet::transaction::eris::proto::DropTxns* Arena::CreateMaybeMessage<::dsnet::transaction::eris::proto::DropTxns>(Arena*);
+template<> ::dsnet::transaction::eris::proto::EpochChange* Arena::CreateMaybeMessage<::dsnet::transaction::eris::proto::EpochChange>(Arena*);
+template<> ::dsnet::transaction::eris::proto::EpochChangeAck* Arena::CreateMaybeMessage<::dsnet::transaction::eris::proto::EpochChangeAck>(Arena*);
+template<> ::dsnet::transaction::eris::proto::EpochChangeAck_LogInfoPiece* Arena::CreateMaybeMessage<::dsnet::transaction::eris::proto::EpochChangeAck_LogInfoPiece>(Arena*);
+template<> ::dsnet::transaction::eris::proto::EpochChangeReq* Arena::CreateMaybeMessage<::dsnet::transaction::eris::proto::EpochChangeReq>(Arena*);
+template<> ::dsnet::transaction::eris::proto::EpochChangeStateTransfer* Arena::CreateMaybeMessage<::dsnet::transaction::eris::proto::EpochChangeStateTransfer>(Arena*);
+template<> ::dsnet::transaction::eris::proto::EpochChangeStateTransferAck* Arena::CreateMaybeMessage<::dsnet::transaction::eris::proto::EpochChangeStateTransferAck>(Arena*);
+template<> ::dsnet::transaction::eris::proto::EpochChangeStateTransferReply* Arena::CreateMaybeMessage<::dsnet::transaction::eris::proto::EpochChangeStateTransferReply>(Arena*);
+template<> ::dsnet::transaction::eris::proto::EpochChangeStateTransferReply_MsgEntry* Arena::CreateMaybeMessage<::dsnet::transaction::eris::proto::EpochChangeStateTransferReply_MsgEntry>(Arena*);
+template<> ::dsnet::transaction::eris::proto::EpochChangeStateTransferRequest* Arena::CreateMaybeMessage<::dsnet::transaction::eris::proto::EpochChangeStateTransferRequest>(Arena*);
+template<> ::dsnet::transaction::eris::proto::EpochChangeStateTransfer_MsgEntry* Arena::CreateMaybeMessage<::dsnet::transaction::eris::proto::EpochChangeStateTransfer_MsgEntry>(Arena*);
+template<> ::dsnet::transaction::eris::proto::ErisToFCMessage* Arena::CreateMaybeMessage<::dsnet::transaction::eris::proto::ErisToFCMessage>(Arena*);
+template<> ::dsnet::transaction::eris::proto::FCToErisMessage* Arena::CreateMaybeMessage<::dsnet::transaction::eris::proto::FCToErisMessage>(Arena*);
+template<> ::dsnet::transaction::eris::proto::GapReplyMessage* Arena::CreateMaybeMessage<::dsnet::transaction::eris::proto::GapReplyMessage>(Arena*);
+template<> ::dsnet::transaction::eris::proto::GapRequestMessage* Arena::CreateMaybeMessage<::dsnet::transaction::eris::proto::GapRequestMessage>(Arena*);
+template<> ::dsnet::transaction::eris::proto::ReplyMessage* Arena::CreateMaybeMessage<::dsnet::transaction::eris::proto::ReplyMessage>(Arena*);
+template<> ::dsnet::transaction::eris::proto::RequestMessage* Arena::CreateMaybeMessage<::dsnet::transaction::eris::proto::RequestMessage>(Arena*);
+template<> ::dsnet::transaction::eris::proto::Stamp* Arena::CreateMaybeMessage<::dsnet::transaction::eris::proto::Stamp>(Arena*);
+template<> ::dsnet::transaction::eris::proto::StartEpoch* Arena::CreateMaybeMessage<::dsnet::transaction::eris::proto::StartEpoch>(Arena*);
+template<> ::dsnet::transaction::eris::proto::StartViewMessage* Arena::CreateMaybeMessage<::dsnet::transaction::eris::proto::StartViewMessage>(Arena*);
+template<> ::dsnet::transaction::eris::proto::StateTransferReplyMessage* Arena::CreateMaybeMessage<::dsnet::transaction::eris::proto::StateTransferReplyMessage>(Arena*);
+template<> ::dsnet::transaction::eris::proto::StateTransferReplyMessage_MsgLogEntry* Arena::CreateMaybeMessage<::dsnet::transaction::eris::proto::StateTransferReplyMessage_MsgLogEntry>(Arena*);
+template<> ::dsnet::transaction::eris::proto::StateTransferRequestMessage* Arena::CreateMaybeMessage<::dsnet::transaction::eris::proto::StateTransferRequestMessage>(Arena*);
+template<> ::dsnet::transaction::eris::proto::SyncPrepareMessage* Arena::CreateMaybeMessage<::dsnet::transaction::eris::proto::SyncPrepareMessage>(Arena*);
+template<> ::dsnet::transaction::eris::proto::ToServerMessage* Arena::CreateMaybeMessage<::dsnet::transaction::eris::proto::ToServerMessage>(Arena*);
+template<> ::dsnet::transaction::eris::proto::TxnCheck* Arena::CreateMaybeMessage<::dsnet::transaction::eris::proto::TxnCheck>(Arena*);
+template<> ::dsnet::transaction::eris::proto::TxnFound* Arena::CreateMaybeMessage<::dsnet::transaction::eris::proto::TxnFound>(Arena*);
+template<> ::dsnet::transaction::eris::proto::TxnInfoRequest* Arena::CreateMaybeMessage<::dsnet::transaction::eris::proto::TxnInfoRequest>(Arena*);
+template<> ::dsnet::transaction::eris::proto::TxnReceived* Arena::CreateMaybeMessage<::dsnet::transaction::eris::proto::TxnReceived>(Arena*);
+template<> ::dsnet::transaction::eris::proto::TxnTempDropped* Arena::CreateMaybeMessage<::dsnet::transaction::eris::proto::TxnTempDropped>(Arena*);
+template<> ::dsnet::transaction::eris::proto::ViewChangeMessage* Arena::CreateMaybeMessage<::dsnet::transaction::eris::proto::ViewChangeMessage>(Arena*);
+template<> ::dsnet::transaction::eris::proto::ViewChangeRequestMessage* Arena::CreateMaybeMessage<::dsnet::transaction::eris::proto::ViewChangeRequestMessage>(Arena*);
+template<> ::dsnet::transaction::eris::proto::ViewNum* Arena::CreateMaybeMessage<::dsnet::transaction::eris::proto::ViewNum>(Arena*);
+PROTOBUF_NAMESPACE_CLOSE
+namespace dsnet {
+namespace transaction {
+namespace eris {
+namespace proto {
+
+enum RequestType : int {
+  UNKNOWN = 0,
+  INDEPENDENT = 1,
+  PREPARE = 2,
+  COMMIT = 3,
+  ABORT = 4
+};
+bool RequestType_IsValid(int value);
+constexpr RequestType RequestType_MIN = UNKNOWN;
+constexpr RequestType RequestType_MAX = ABORT;
+constexpr int RequestType_ARRAYSIZE = RequestType_MAX + 1;
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* RequestType_descriptor();
+template<typename T>
+inline const std::string& RequestType_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, RequestType>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function RequestType_Name.");
+  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
+    RequestType_descriptor(), enum_t_value);
+}
+inline bool RequestType_Parse(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, RequestType* value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<RequestType>(
+    RequestType_descriptor(), name, value);
+}
+// ===================================================================
+
+class ViewNum final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:dsnet.transaction.eris.proto.ViewNum) */ {
+ public:
+  inline ViewNum() : ViewNum(nullptr) {}
+  ~ViewNum() override;
+  explicit PROTOBUF_CONSTEXPR ViewNum(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  ViewNum(const ViewNum& from);
+  ViewNum(ViewNum&& from) noexcept
+    : ViewNum() {
+    *this = ::std::move(from);
+  }
+
+  inline ViewNum& operator=(const ViewNum& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline ViewNum& operator=(ViewNum&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ViewNum& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const ViewNum* internal_default_instance() {
+    return reinterpret_cast<const ViewNum*>(
+               &_ViewNum_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    0;
+
+  friend void swap(ViewNum& a, ViewNum& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(ViewNum* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ViewNum* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  ViewNum* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ViewNum>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const ViewNum& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ViewNum& from) {
+    ViewNum::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(ViewNum* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "dsnet.transaction.eris.proto.ViewNum";
+  }
+  protected:
+  explicit ViewNum(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kViewNumFieldNumber = 1,
+    kSessNumFieldNumber = 2,
+  };
+  // required uint32 view_num = 1;
+  bool has_view_num() const;
+  private:
+  bool _internal_has_view_num() const;
+  public:
+  void clear_view_num();
+  uint32_t view_num() const;
+  void set_view_num(uint32_t value);
+  private:
+  uint32_t _internal_view_num() const;
+  void _internal_set_view_num(uint32_t value);
+  public:
+
+  // required uint32 sess_num = 2;
+  bool has_sess_num() const;
+  private:
+  bool _internal_has_sess_num() const;
+  public:
+  void clear_sess_num();
+  uint32_t sess_num() const;
+  void set_sess_num(uint32_t value);
+  private:
+  uint32_t _internal_sess_num() const;
+  void _internal_set_sess_num(uint32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:dsnet.transaction.eris.proto.ViewNum)
+ private:
+  class _Internal;
+
+  // helper for ByteSizeLong()
+  size_t RequiredFieldsByteSizeFallback() const;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    uint32_t view_num_;
+    uint32_t sess_num_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_transaction_2feris_2feris_2dproto_2eproto;
+};
+// -------------------------------------------------------------------
+
+class Stamp final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:dsnet.transaction.eris.proto.Stamp) */ {
+ public:
+  inline Stamp() : Stamp(nullptr) {}
+  ~Stamp() override;
+  explicit PROTOBUF_CONSTEXPR Stamp(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  Stamp(const Stamp& from);
+  Stamp(Stamp&& from) noexcept
+    : Stamp() {
+    *this = ::std::move(from);
+  }
+
+  inline Stamp& operator=(const Stamp& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline Stamp& operator=(Stamp&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const Stamp& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const Stamp* internal_default_instance() {
+    return reinterpret_cast<const Stamp*>(
+               &_Stamp_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    1;
+
+  friend void swap(Stamp& a, Stamp& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(Stamp* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Stamp* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  Stamp* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<Stamp>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const Stamp& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const Stamp& from) {
+    Stamp::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(Stamp* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "dsnet.transaction.eris.proto.Stamp";
+  }
+  protected:
+  explicit Stamp(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kMsgNumFieldNumber = 2,
+    kShardNumFieldNumber = 1,
+    kSessNumFieldNumber = 3,
+  };
+  // required uint64 msg_num = 2;
+  bool has_msg_num() const;
+  private:
+  bool _internal_has_msg_num() const;
+  public:
+  void clear_msg_num();
+  uint64_t msg_num() const;
+  void set_msg_num(uint64_t value);
+  private:
+  uint64_t _internal_msg_num() const;
+  void _internal_set_msg_num(uint64_t value);
+  public:
+
+  // required uint32 shard_num = 1;
+  bool has_shard_num() const;
+  private:
+  bool _internal_has_shard_num() const;
+  public:
+  void clear_shard_num();
+  uint32_t shard_num() const;
+  void set_shard_num(uint32_t value);
+  private:
+  uint32_t _internal_shard_num() const;
+  void _internal_set_shard_num(uint32_t value);
+  public:
+
+  // optional uint32 sess_num = 3;
+  bool has_sess_num() const;
+  private:
+  bool _internal_has_sess_num() const;
+  public:
+  void clear_sess_num();
+  uint32_t sess_num() const;
+  void set_sess_num(uint32_t value);
+  private:
+  uint32_t _internal_sess_num() const;
+  void _internal_set_sess_num(uint32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:dsnet.transaction.eris.proto.Stamp)
+ private:
+  class _Internal;
+
+  // helper for ByteSizeLong()
+  size_t RequiredFieldsByteSizeFallback() const;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    uint64_t msg_num_;
+    uint32_t shard_num_;
+    uint32_t sess_num_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_transaction_2feris_2feris_2dproto_2eproto;
+};
+// -------------------------------------------------------------------
+
+class ReplyMessage final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:dsnet.transaction.eris.proto.ReplyMessage) */ {
+ public:
+  inline ReplyMessage() : ReplyMessage(nullptr) {}
+  ~ReplyMessage() override;
+  explicit PROTOBUF_CONSTEXPR ReplyMessage(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  ReplyMessage(const ReplyMessage& from);
+  ReplyMessage(ReplyMessage&& from) noexcept
+    : ReplyMessage() {
+    *this = ::std::move(from);
+  }
+
+  inline ReplyMessage& operator=(const ReplyMessage& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline ReplyMessage& operator=(ReplyMessage&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ReplyMessage& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const ReplyMessage* internal_default_instance() {
+    return reinterpret_cast<const ReplyMessage*>(
+               &_ReplyMessage_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    2;
+
+  friend void swap(ReplyMessage& a, ReplyMessage& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(ReplyMessage* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ReplyMessage* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  ReplyMessage* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ReplyMessage>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const ReplyMessage& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ReplyMessage& from) {
+    ReplyMessage::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(ReplyMessage* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "dsnet.transaction.eris.proto.ReplyMessage";
+  }
+  protected:
+  explicit ReplyMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kReplyFieldNumber = 8,
+    kViewFieldNumber = 5,
+    kClientidFieldNumber = 1,
+    kClientreqidFieldNumber = 2,
+    kShardNumFieldNumber = 3,
+    kReplicaNumFieldNumber = 4,
+    kOpNumFieldNumber = 6,
+    kCommitFieldNumber = 7,
+  };
+  // optional bytes reply = 8;
+  bool has_reply() const;
+  private:
+  bool _internal_has_reply() const;
+  public:
+  void clear_reply();
+  const std::string& reply() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_reply(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_reply();
+  PROTOBUF_NODISCARD std::string* release_reply();
+  void set_allocated_reply(std::string* reply);
+  private:
+  const std::string& _internal_reply() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_reply(const std::string& value);
+  std::string* _internal_mutable_reply();
+  public:
+
+  // required .dsnet.transaction.eris.proto.ViewNum view = 5;
+  bool has_view() const;
+  private:
+  bool _internal_has_view() const;
+  public:
+  void clear_view();
+  const ::dsnet::transaction::eris::proto::ViewNum& view() const;
+  PROTOBUF_NODISCARD ::dsnet::transaction::eris::proto::ViewNum* release_view();
+  ::dsnet::transaction::eris::proto::ViewNum* mutable_view();
+  void set_allocated_view(::dsnet::transaction::eris::proto::ViewNum* view);
+  private:
+  const ::dsnet::transaction::eris::proto::ViewNum& _internal_view() const;
+  ::dsnet::transaction::eris::proto::ViewNum* _internal_mutable_view();
+  public:
+  void unsafe_arena_set_allocated_view(
+      ::dsnet::transaction::eris::proto::ViewNum* view);
+  ::dsnet::transaction::eris::proto::ViewNum* unsafe_arena_release_view();
+
+  // required uint64 clientid = 1;
+  bool has_clientid() const;
+  private:
+  bool _internal_has_clientid() const;
+  public:
+  void clear_clientid();
+  uint64_t clientid() const;
+  void set_clientid(uint64_t value);
+  private:
+  uint64_t _internal_clientid() const;
+  void _internal_set_clientid(uint64_t value);
+  public:
+
+  // required uint64 clientreqid = 2;
+  bool has_clientreqid() const;
+  private:
+  bool _internal_has_clientreqid() const;
+  public:
+  void clear_clientreqid();
+  uint64_t clientreqid() const;
+  void set_clientreqid(uint64_t value);
+  private:
+  uint64_t _internal_clientreqid() const;
+  void _internal_set_clientreqid(uint64_t value);
+  public:
+
+  // required uint32 shard_num = 3;
+  bool has_shard_num() const;
+  private:
+  bool _internal_has_shard_num() const;
+  public:
+  void clear_shard_num();
+  uint32_t shard_num() const;
+  void set_shard_num(uint32_t value);
+  private:
+  uint32_t _internal_shard_num() const;
+  void _internal_set_shard_num(uint32_t value);
+  public:
+
+  // required uint32 replica_num = 4;
+  bool has_replica_num() const;
+  private:
+  bool _internal_has_replica_num() const;
+  public:
+  void clear_replica_num();
+  uint32_t replica_num() const;
+  void set_replica_num(uint32_t value);
+  private:
+  uint32_t _internal_replica_num() const;
+  void _internal_set_replica_num(uint32_t value);
+  public:
+
+  // required uint64 op_num = 6;
+  bool has_op_num() const;
+  private:
+  bool _internal_has_op_num() const;
+  public:
+  void clear_op_num();
+  uint64_t op_num() const;
+  void set_op_num(uint64_t value);
+  private:
+  uint64_t _internal_op_num() const;
+  void _internal_set_op_num(uint64_t value);
+  public:
+
+  // optional uint32 commit = 7;
+  bool has_commit() const;
+  private:
+  bool _internal_has_commit() const;
+  public:
+  void clear_commit();
+  uint32_t commit() const;
+  void set_commit(uint32_t value);
+  private:
+  uint32_t _internal_commit() const;
+  void _internal_set_commit(uint32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:dsnet.transaction.eris.proto.ReplyMessage)
+ private:
+  class _Internal;
+
+  // helper for ByteSizeLong()
+  size_t RequiredFieldsByteSizeFallback() const;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr reply_;
+    ::dsnet::transaction::eris::proto::ViewNum* view_;
+    uint64_t clientid_;
+    uint64_t clientreqid_;
+    uint32_t shard_num_;
+    uint32_t replica_num_;
+    uint64_t op_num_;
+    uint32_t commit_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_transaction_2feris_2feris_2dproto_2eproto;
+};
+// -------------------------------------------------------------------
+
+class RequestMessage final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:dsnet.transaction.eris.proto.RequestMessage) */ {
+ public:
+  inline RequestMessage() : RequestMessage(nullptr) {}
+  ~RequestMessage() override;
+  explicit PROTOBUF_CONSTEXPR RequestMessage(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  RequestMessage(const RequestMessage& from);
+  RequestMessage(RequestMessage&& from) noexcept
+    : RequestMessage() {
+    *this = ::std::move(from);
+  }
+
+  inline RequestMessage& operator=(const RequestMessage& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline RequestMessage& operator=(RequestMessage&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const RequestMessage& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const RequestMessage* internal_default_instance() {
+    return reinterpret_cast<const RequestMessage*>(
+               &_RequestMessage_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    3;
+
+  friend void swap(RequestMessage& a, RequestMessage& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(RequestMessage* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(RequestMessage* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  RequestMessage* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<RequestMessage>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const RequestMessage& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const RequestMessage& from) {
+    RequestMessage::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(RequestMessage* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "dsnet.transaction.eris.proto.RequestMessage";
+  }
+  protected:
+  explicit RequestMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kRequestFieldNumber = 3,
+    kTxnidFieldNumber = 1,
+    kTypeFieldNumber = 2,
+  };
+  // required .dsnet.Request request = 3;
+  bool has_request() const;
+  private:
+  bool _internal_has_request() const;
+  public:
+  void clear_request();
+  const ::dsnet::Request& request() const;
+  PROTOBUF_NODISCARD ::dsnet::Request* release_request();
+  ::dsnet::Request* mutable_request();
+  void set_allocated_request(::dsnet::Request* request);
+  private:
+  const ::dsnet::Request& _internal_request() const;
+  ::dsnet::Request* _internal_mutable_request();
+  public:
+  void unsafe_arena_set_allocated_request(
+      ::dsnet::Request* request);
+  ::dsnet::Request* unsafe_arena_release_request();
+
+  // required uint64 txnid = 1;
+  bool has_txnid() const;
+  private:
+  bool _internal_has_txnid() const;
+  public:
+  void clear_txnid();
+  uint64_t txnid() const;
+  void set_txnid(uint64_t value);
+  private:
+  uint64_t _internal_txnid() const;
+  void _internal_set_txnid(uint64_t value);
+  public:
+
+  // required .dsnet.transaction.eris.proto.RequestType type = 2;
+  bool has_type() const;
+  private:
+  bool _internal_has_type() const;
+  public:
+  void clear_type();
+  ::dsnet::transaction::eris::proto::RequestType type() const;
+  void set_type(::dsnet::transaction::eris::proto::RequestType value);
+  private:
+  ::dsnet::transaction::eris::proto::RequestType _internal_type() const;
+  void _internal_set_type(::dsnet::transaction::eris::proto::RequestType value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:dsnet.transaction.eris.proto.RequestMessage)
+ private:
+  class _Internal;
+
+  // helper for ByteSizeLong()
+  size_t RequiredFieldsByteSizeFallback() const;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::dsnet::Request* request_;
+    uint64_t txnid_;
+    int type_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_transaction_2feris_2feris_2dproto_2eproto;
+};
+// -------------------------------------------------------------------
+
+class GapRequestMessage final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:dsnet.transaction.eris.proto.GapRequestMessage) */ {
+ public:
+  inline GapRequestMessage() : GapRequestMessage(nullptr) {}
+  ~GapRequestMessage() override;
+  explicit PROTOBUF_CONSTEXPR GapRequestMessage(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  GapRequestMessage(const GapRequestMessage& from);
+  GapRequestMessage(GapRequestMessage&& from) noexcept
+    : GapRequestMessage() {
+    *this = ::std::move(from);
+  }
+
+  inline GapRequestMessage& operator=(const GapRequestMessage& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline GapRequestMessage& operator=(GapRequestMessage&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const GapRequestMessage& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const GapRequestMessage* internal_default_instance() {
+    return reinterpret_cast<const GapRequestMessage*>(
+               &_GapRequestMessage_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    4;
+
+  friend void swap(GapRequestMessage& a, GapRequestMessage& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(GapRequestMessage* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(GapRequestMessage* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  GapRequestMessage* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<GapRequestMessage>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const GapRequestMessage& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const GapRequestMessage& from) {
+    GapRequestMessage::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(GapRequestMessage* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "dsnet.transaction.eris.proto.GapRequestMessage";
+  }
+  protected:
+  explicit GapRequestMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kViewFieldNumber = 1,
+    kOpNumFieldNumber = 2,
+  };
+  // required .dsnet.transaction.eris.proto.ViewNum view = 1;
+  bool has_view() const;
+  private:
+  bool _internal_has_view() const;
+  public:
+  void clear_view();
+  const ::dsnet::transaction::eris::proto::ViewNum& view() const;
+  PROTOBUF_NODISCARD ::dsnet::transaction::eris::proto::ViewNum* release_view();
+  ::dsnet::transaction::eris::proto::ViewNum* mutable_view();
+  void set_allocated_view(::dsnet::transaction::eris::proto::ViewNum* view);
+  private:
+  const ::dsnet::transaction::eris::proto::ViewNum& _internal_view() const;
+  ::dsnet::transaction::eris::proto::ViewNum* _internal_mutable_view();
+  public:
+  void unsafe_arena_set_allocated_view(
+      ::dsnet::transaction::eris::proto::ViewNum* view);
+  ::dsnet::transaction::eris::proto::ViewNum* unsafe_arena_release_view();
+
+  // required uint64 op_num = 2;
+  bool has_op_num() const;
+  private:
+  bool _internal_has_op_num() const;
+  public:
+  void clear_op_num();
+  uint64_t op_num() const;
+  void set_op_num(uint64_t value);
+  private:
+  uint64_t _internal_op_num() const;
+  void _internal_set_op_num(uint64_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:dsnet.transaction.eris.proto.GapRequestMessage)
+ private:
+  class _Internal;
+
+  // helper for ByteSizeLong()
+  size_t RequiredFieldsByteSizeFallback() const;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::dsnet::transaction::eris::proto::ViewNum* view_;
+    uint64_t op_num_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_transaction_2feris_2feris_2dproto_2eproto;
+};
+// -------------------------------------------------------------------
+
+class GapReplyMessage final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:dsnet.transaction.eris.proto.GapReplyMessage) */ {
+ public:
+  inline GapReplyMessage() : GapReplyMessage(nullptr) {}
+  ~GapReplyMessage() override;
+  explicit PROTOBUF_CONSTEXPR GapReplyMessage(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  GapReplyMessage(const GapReplyMessage& from);
+  GapReplyMessage(GapReplyMessage&& from) noexcept
+    : GapReplyMessage() {
+    *this = ::std::move(from);
+  }
+
+  inline GapReplyMessage& operator=(const GapReplyMessage& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline GapReplyMessage& operator=(GapReplyMessage&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const GapReplyMessage& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const GapReplyMessage* internal_default_instance() {
+    return reinterpret_cast<const GapReplyMessage*>(
+               &_GapReplyMessage_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    5;
+
+  friend void swap(GapReplyMessage& a, GapReplyMessage& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(GapReplyMessage* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(GapReplyMessage* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  GapReplyMessage* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<GapReplyMessage>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const GapReplyMessage& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const GapReplyMessage& from) {
+    GapReplyMessage::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(GapReplyMessage* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "dsnet.transaction.eris.proto.GapReplyMessage";
+  }
+  protected:
+  explicit GapReplyMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kViewFieldNumber = 1,
+    kReqFieldNumber = 7,
+    kOpNumFieldNumber = 2,
+    kIsfoundFieldNumber = 4,
+    kIsgapFieldNumber = 5,
+    kReplicaNumFieldNumber = 6,
+  };
+  // required .dsnet.transaction.eris.proto.ViewNum view = 1;
+  bool has_view() const;
+  private:
+  bool _internal_has_view() const;
+  public:
+  void clear_view();
+  const ::dsnet::transaction::eris::proto::ViewNum& view() const;
+  PROTOBUF_NODISCARD ::dsnet::transaction::eris::proto::ViewNum* release_view();
+  ::dsnet::transaction::eris::proto::ViewNum* mutable_view();
+  void set_allocated_view(::dsnet::transaction::eris::proto::ViewNum* view);
+  private:
+  const ::dsnet::transaction::eris::proto::ViewNum& _internal_view() const;
+  ::dsnet::transaction::eris::proto::ViewNum* _internal_mutable_view();
+  public:
+  void unsafe_arena_set_allocated_view(
+      ::dsnet::transaction::eris::proto::ViewNum* view);
+  ::dsnet::transaction::eris::proto::ViewNum* unsafe_arena_release_view();
+
+  // optional .dsnet.transaction.eris.proto.RequestMessage req = 7;
+  bool has_req() const;
+  private:
+  bool _internal_has_req() const;
+  public:
+  void clear_req();
+  const ::dsnet::transaction::eris::proto::RequestMessage& req() const;
+  PROTOBUF_NODISCARD ::dsnet::transaction::eris::proto::RequestMessage* release_req();
+  ::dsnet::transaction::eris::proto::RequestMessage* mutable_req();
+  void set_allocated_req(::dsnet::transaction::eris::proto::RequestMessage* req);
+  private:
+  const ::dsnet::transaction::eris::proto::RequestMessage& _internal_req() const;
+  ::dsnet::transaction::eris::proto::RequestMessage* _internal_mutable_req();
+  public:
+  void unsafe_arena_set_allocated_req(
+      ::dsnet::transaction::eris::proto::RequestMessage* req);
+  ::dsnet::transaction::eris::proto::RequestMessage* unsafe_arena_release_req();
+
+  // required uint64 op_num = 2;
+  bool has_op_num() const;
+  private:
+  bool _internal_has_op_num() const;
+  public:
+  void clear_op_num();
+  uint64_t op_num() const;
+  void set_op_num(uint64_t value);
+  private:
+  uint64_t _internal_op_num() const;
+  void _internal_set_op_num(uint64_t value);
+  public:
+
+  // required bool isfound = 4;
+  bool has_isfound() const;
+  private:
+  bool _internal_has_isfound() const;
+  public:
+  void clear_isfound();
+  bool isfound() const;
+  void set_isfound(bool value);
+  private:
+  bool _internal_isfound() const;
+  void _internal_set_isfound(bool value);
+  public:
+
+  // required bool isgap = 5;
+  bool has_isgap() const;
+  private:
+  bool _internal_has_isgap() const;
+  public:
+  void clear_isgap();
+  bool isgap() const;
+  void set_isgap(bool value);
+  private:
+  bool _internal_isgap() const;
+  void _internal_set_isgap(bool value);
+  public:
+
+  // required uint32 replica_num = 6;
+  bool has_replica_num() const;
+  private:
+  bool _internal_has_replica_num() const;
+  public:
+  void clear_replica_num();
+  uint32_t replica_num() const;
+  void set_replica_num(uint32_t value);
+  private:
+  uint32_t _internal_replica_num() const;
+  void _internal_set_replica_num(uint32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:dsnet.transaction.eris.proto.GapReplyMessage)
+ private:
+  class _Internal;
+
+  // helper for ByteSizeLong()
+  size_t RequiredFieldsByteSizeFallback() const;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::dsnet::transaction::eris::proto::ViewNum* view_;
+    ::dsnet::transaction::eris::proto::RequestMessage* req_;
+    uint64_t op_num_;
+    bool isfound_;
+    bool isgap_;
+    uint32_t replica_num_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_transaction_2feris_2feris_2dproto_2eproto;
+};
+// -------------------------------------------------------------------
+
+class SyncPrepareMessage final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:dsnet.transaction.eris.proto.SyncPrepareMessage) */ {
+ public:
+  inline SyncPrepareMessage() : SyncPrepareMessage(nullptr) {}
+  ~SyncPrepareMessage() override;
+  explicit PROTOBUF_CONSTEXPR SyncPrepareMessage(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  SyncPrepareMessage(const SyncPrepareMessage& from);
+  SyncPrepareMessage(SyncPrepareMessage&& from) noexcept
+    : SyncPrepareMessage() {
+    *this = ::std::move(from);
+  }
+
+  inline SyncPrepareMessage& operator=(const SyncPrepareMessage& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline SyncPrepareMessage& operator=(SyncPrepareMessage&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const SyncPrepareMessage& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const SyncPrepareMessage* internal_default_instance() {
+    return reinterpret_cast<const SyncPrepareMessage*>(
+               &_SyncPrepareMessage_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    6;
+
+  friend void swap(SyncPrepareMessage& a, SyncPrepareMessage& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(SyncPrepareMessage* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(SyncPrepareMessage* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  SyncPrepareMessage* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<SyncPrepareMessage>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const SyncPrepareMessage& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const SyncPrepareMessage& from) {
+    SyncPrepareMessage::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(SyncPrepareMessage* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "dsnet.transaction.eris.proto.SyncPrepareMessage";
+  }
+  protected:
+  explicit SyncPrepareMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kViewFieldNumber = 1,
+  };
+  // required .dsnet.transaction.eris.proto.ViewNum view = 1;
+  bool has_view() const;
+  private:
+  bool _internal_has_view() const;
+  public:
+  void clear_view();
+  const ::dsnet::transaction::eris::proto::ViewNum& view() const;
+  PROTOBUF_NODISCARD ::dsnet::transaction::eris::proto::ViewNum* release_view();
+  ::dsnet::transaction::eris::proto::ViewNum* mutable_view();
+  void set_allocated_view(::dsnet::transaction::eris::proto::ViewNum* view);
+  private:
+  const ::dsnet::transaction::eris::proto::ViewNum& _internal_view() const;
+  ::dsnet::transaction::eris::proto::ViewNum* _internal_mutable_view();
+  public:
+  void unsafe_arena_set_allocated_view(
+      ::dsnet::transaction::eris::proto::ViewNum* view);
+  ::dsnet::transaction::eris::proto::ViewNum* unsafe_arena_release_view();
+
+  // @@protoc_insertion_point(class_scope:dsnet.transaction.eris.proto.SyncPrepareMessage)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::dsnet::transaction::eris::proto::ViewNum* view_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_transaction_2feris_2feris_2dproto_2eproto;
+};
+// -------------------------------------------------------------------
+
+class ViewChangeRequestMessage final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:dsnet.transaction.eris.proto.ViewChangeRequestMessage) */ {
+ public:
+  inline ViewChangeRequestMessage() : ViewChangeRequestMessage(nullptr) {}
+  ~ViewChangeRequestMessage() override;
+  explicit PROTOBUF_CONSTEXPR ViewChangeRequestMessage(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  ViewChangeRequestMessage(const ViewChangeRequestMessage& from);
+  ViewChangeRequestMessage(ViewChangeRequestMessage&& from) noexcept
+    : ViewChangeRequestMessage() {
+    *this = ::std::move(from);
+  }
+
+  inline ViewChangeRequestMessage& operator=(const ViewChangeRequestMessage& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline ViewChangeRequestMessage& operator=(ViewChangeRequestMessage&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ViewChangeRequestMessage& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const ViewChangeRequestMessage* internal_default_instance() {
+    return reinterpret_cast<const ViewChangeRequestMessage*>(
+               &_ViewChangeRequestMessage_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    7;
+
+  friend void swap(ViewChangeRequestMessage& a, ViewChangeRequestMessage& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(ViewChangeRequestMessage* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ViewChangeRequestMessage* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  ViewChangeRequestMessage* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ViewChangeRequestMessage>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const ViewChangeRequestMessage& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ViewChangeRequestMessage& from) {
+    ViewChangeRequestMessage::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(ViewChangeRequestMessage* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "dsnet.transaction.eris.proto.ViewChangeRequestMessage";
+  }
+  protected:
+  explicit ViewChangeRequestMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kViewFieldNumber = 1,
+  };
+  // required .dsnet.transaction.eris.proto.ViewNum view = 1;
+  bool has_view() const;
+  private:
+  bool _internal_has_view() const;
+  public:
+  void clear_view();
+  const ::dsnet::transaction::eris::proto::ViewNum& view() const;
+  PROTOBUF_NODISCARD ::dsnet::transaction::eris::proto::ViewNum* release_view();
+  ::dsnet::transaction::eris::proto::ViewNum* mutable_view();
+  void set_allocated_view(::dsnet::transaction::eris::proto::ViewNum* view);
+  private:
+  const ::dsnet::transaction::eris::proto::ViewNum& _internal_view() const;
+  ::dsnet::transaction::eris::proto::ViewNum* _internal_mutable_view();
+  public:
+  void unsafe_arena_set_allocated_view(
+      ::dsnet::transaction::eris::proto::ViewNum* view);
+  ::dsnet::transaction::eris::proto::ViewNum* unsafe_arena_release_view();
+
+  // @@protoc_insertion_point(class_scope:dsnet.transaction.eris.proto.ViewChangeRequestMessage)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::dsnet::transaction::eris::proto::ViewNum* view_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_transaction_2feris_2feris_2dproto_2eproto;
+};
+// -------------------------------------------------------------------
+
+class DropTxns final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:dsnet.transaction.eris.proto.DropTxns) */ {
+ public:
+  inline DropTxns() : DropTxns(nullptr) {}
+  ~DropTxns() override;
+  explicit PROTOBUF_CONSTEXPR DropTxns(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  DropTxns(const DropTxns& from);
+  DropTxns(DropTxns&& from) noexcept
+    : DropTxns() {
+    *this = ::std::move(from);
+  }
+
+  inline DropTxns& operator=(const DropTxns& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline DropTxns& operator=(DropTxns&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const DropTxns& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const DropTxns* internal_default_instance() {
+    return reinterpret_cast<const DropTxns*>(
+               &_DropTxns_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    8;
+
+  friend void swap(DropTxns& a, DropTxns& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(DropTxns* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(DropTxns* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  DropTxns* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<DropTxns>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const DropTxns& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const DropTxns& from) {
+    DropTxns::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(DropTxns* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "dsnet.transaction.eris.proto.DropTxns";
+  }
+  protected:
+  explicit DropTxns(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kTempDropsFieldNumber = 1,
+    kPermDropsFieldNumber = 2,
+    kUnDropsFieldNumber = 3,
+  };
+  // repeated .dsnet.transaction.eris.proto.Stamp temp_drops = 1;
+  int temp_drops_size() const;
+  private:
+  int _internal_temp_drops_size() const;
+  public:
+  void clear_temp_drops();
+  ::dsnet::transaction::eris::proto::Stamp* mutable_temp_drops(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::dsnet::transaction::eris::proto::Stamp >*
+      mutable_temp_drops();
+  private:
+  const ::dsnet::transaction::eris::proto::Stamp& _internal_temp_drops(int index) const;
+  ::dsnet::transaction::eris::proto::Stamp* _internal_add_temp_drops();
+  public:
+  const ::dsnet::transaction::eris::proto::Stamp& temp_drops(int index) const;
+  ::dsnet::transaction::eris::proto::Stamp* add_temp_drops();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::dsnet::transaction::eris::proto::Stamp >&
+      temp_drops() const;
+
+  // repeated .dsnet.transaction.eris.proto.Stamp perm_drops = 2;
+  int perm_drops_size() const;
+  private:
+  int _internal_perm_drops_size() const;
+  public:
+  void clear_perm_drops();
+  ::dsnet::transaction::eris::proto::Stamp* mutable_perm_drops(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::dsnet::transaction::eris::proto::Stamp >*
+      mutable_perm_drops();
+  private:
+  const ::dsnet::transaction::eris::proto::Stamp& _internal_perm_drops(int index) const;
+  ::dsnet::transaction::eris::proto::Stamp* _internal_add_perm_drops();
+  public:
+  const ::dsnet::transaction::eris::proto::Stamp& perm_drops(int index) const;
+  ::dsnet::transaction::eris::proto::Stamp* add_perm_drops();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::dsnet::transaction::eris::proto::Stamp >&
+      perm_drops() const;
+
+  // repeated .dsnet.transaction.eris.proto.RequestMessage un_drops = 3;
+  int un_drops_size() const;
+  private:
+  int _internal_un_drops_size() const;
+  public:
+  void clear_un_drops();
+  ::dsnet::transaction::eris::proto::RequestMessage* mutable_un_drops(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::dsnet::transaction::eris::proto::RequestMessage >*
+      mutable_un_drops();
+  private:
+  const ::dsnet::transaction::eris::proto::RequestMessage& _internal_un_drops(int index) const;
+  ::dsnet::transaction::eris::proto::RequestMessage* _internal_add_un_drops();
+  public:
+  const ::dsnet::transaction::eris::proto::RequestMessage& un_drops(int index) const;
+  ::dsnet::transaction::eris::proto::RequestMessage* add_un_drops();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::dsnet::transaction::eris::proto::RequestMessage >&
+      un_drops() const;
+
+  // @@protoc_insertion_point(class_scope:dsnet.transaction.eris.proto.DropTxns)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::dsnet::transaction::eris::proto::Stamp > temp_drops_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::dsnet::transaction::eris::proto::Stamp > perm_drops_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::dsnet::transaction::eris::proto::RequestMessage > un_drops_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_transaction_2feris_2feris_2dproto_2eproto;
+};
+// -------------------------------------------------------------------
+
+class ViewChangeMessage final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:dsnet.transaction.eris.proto.ViewChangeMessage) */ {
+ public:
+  inline ViewChangeMessage() : ViewChangeMessage(nullptr) {}
+  ~ViewChangeMessage() override;
+  explicit PROTOBUF_CONSTEXPR ViewChangeMessage(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  ViewChangeMessage(const ViewChangeMessage& from);
+  ViewChangeMessage(ViewChangeMessage&& from) noexcept
+    : ViewChangeMessage() {
+    *this = ::std::move(from);
+  }
+
+  inline ViewChangeMessage& operator=(const ViewChangeMessage& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline ViewChangeMessage& operator=(ViewChangeMessage&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ViewChangeMessage& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const ViewChangeMessage* internal_default_instance() {
+    return reinterpret_cast<const ViewChangeMessage*>(
+               &_ViewChangeMessage_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    9;
+
+  friend void swap(ViewChangeMessage& a, ViewChangeMessage& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(ViewChangeMessage* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ViewChangeMessage* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  ViewChangeMessage* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ViewChangeMessage>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const ViewChangeMessage& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ViewChangeMessage& from) {
+    ViewChangeMessage::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(ViewChangeMessage* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "dsnet.transaction.eris.proto.ViewChangeMessage";
+  }
+  protected:
+  explicit ViewChangeMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kViewFieldNumber = 1,
+    kDropsFieldNumber = 4,
+    kOpNumFieldNumber = 3,
+    kReplicaNumFieldNumber = 2,
+  };
+  // required .dsnet.transaction.eris.proto.ViewNum view = 1;
+  bool has_view() const;
+  private:
+  bool _internal_has_view() const;
+  public:
+  void clear_view();
+  const ::dsnet::transaction::eris::proto::ViewNum& view() const;
+  PROTOBUF_NODISCARD ::dsnet::transaction::eris::proto::ViewNum* release_view();
+  ::dsnet::transaction::eris::proto::ViewNum* mutable_view();
+  void set_allocated_view(::dsnet::transaction::eris::proto::ViewNum* view);
+  private:
+  const ::dsnet::transaction::eris::proto::ViewNum& _internal_view() const;
+  ::dsnet::transaction::eris::proto::ViewNum* _internal_mutable_view();
+  public:
+  void unsafe_arena_set_allocated_view(
+      ::dsnet::transaction::eris::proto::ViewNum* view);
+  ::dsnet::transaction::eris::proto::ViewNum* unsafe_arena_release_view();
+
+  // required .dsnet.transaction.eris.proto.DropTxns drops = 4;
+  bool has_drops() const;
+  private:
+  bool _internal_has_drops() const;
+  public:
+  void clear_drops();
+  const ::dsnet::transaction::eris::proto::DropTxns& drops() const;
+  PROTOBUF_NODISCARD ::dsnet::transaction::eris::proto::DropTxns* release_drops();
+  ::dsnet::transaction::eris::proto::DropTxns* mutable_drops();
+  void set_allocated_drops(::dsnet::transaction::eris::proto::DropTxns* drops);
+  private:
+  const ::dsnet::transaction::eris::proto::DropTxns& _internal_drops() const;
+  ::dsnet::transaction::eris::proto::DropTxns* _internal_mutable_drops();
+  public:
+  void unsafe_arena_set_allocated_drops(
+      ::dsnet::transaction::eris::proto::DropTxns* drops);
+  ::dsnet::transaction::eris::proto::DropTxns* unsafe_arena_release_drops();
+
+  // required uint64 op_num = 3;
+  bool has_op_num() const;
+  private:
+  bool _internal_has_op_num() const;
+  public:
+  void clear_op_num();
+  uint64_t op_num() const;
+  void set_op_num(uint64_t value);
+  private:
+  uint64_t _internal_op_num() const;
+  void _internal_set_op_num(uint64_t value);
+  public:
+
+  // required uint32 replica_num = 2;
+  bool has_replica_num() const;
+  private:
+  bool _internal_has_replica_num() const;
+  public:
+  void clear_replica_num();
+  uint32_t replica_num() const;
+  void set_replica_num(uint32_t value);
+  private:
+  uint32_t _internal_replica_num() const;
+  void _internal_set_replica_num(uint32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:dsnet.transaction.eris.proto.ViewChangeMessage)
+ private:
+  class _Internal;
+
+  // helper for ByteSizeLong()
+  size_t RequiredFieldsByteSizeFallback() const;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::dsnet::transaction::eris::proto::ViewNum* view_;
+    ::dsnet::transaction::eris::proto::DropTxns* drops_;
+    uint64_t op_num_;
+    uint32_t replica_num_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_transaction_2feris_2feris_2dproto_2eproto;
+};
+// -------------------------------------------------------------------
+
+class StartViewMessage final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:dsnet.transaction.eris.proto.StartViewMessage) */ {
+ public:
+  inline StartViewMessage() : StartViewMessage(nullptr) {}
+  ~StartViewMessage() override;
+  explicit PROTOBUF_CONSTEXPR StartViewMessage(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  StartViewMessage(const StartViewMessage& from);
+  StartViewMessage(StartViewMessage&& from) noexcept
+    : StartViewMessage() {
+    *this = ::std::move(from);
+  }
+
+  inline StartViewMessage& operator=(const StartViewMessage& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline StartViewMessage& operator=(StartViewMessage&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const StartViewMessage& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const StartViewMessage* internal_default_instance() {
+    return reinterpret_cast<const StartViewMessage*>(
+               &_StartViewMessage_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    10;
+
+  friend void swap(StartViewMessage& a, StartViewMessage& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(StartViewMessage* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(StartViewMessage* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  StartViewMessage* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<StartViewMessage>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const StartViewMessage& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const StartViewMessage& from) {
+    StartViewMessage::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(StartViewMessage* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "dsnet.transaction.eris.proto.StartViewMessage";
+  }
+  protected:
+  explicit StartViewMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kViewFieldNumber = 1,
+    kDropsFieldNumber = 3,
+    kOpNumFieldNumber = 2,
+  };
+  // required .dsnet.transaction.eris.proto.ViewNum view = 1;
+  bool has_view() const;
+  private:
+  bool _internal_has_view() const;
+  public:
+  void clear_view();
+  const ::dsnet::transaction::eris::proto::ViewNum& view() const;
+  PROTOBUF_NODISCARD ::dsnet::transaction::eris::proto::ViewNum* release_view();
+  ::dsnet::transaction::eris::proto::ViewNum* mutable_view();
+  void set_allocated_view(::dsnet::transaction::eris::proto::ViewNum* view);
+  private:
+  const ::dsnet::transaction::eris::proto::ViewNum& _internal_view() const;
+  ::dsnet::transaction::eris::proto::ViewNum* _internal_mutable_view();
+  public:
+  void unsafe_arena_set_allocated_view(
+      ::dsnet::transaction::eris::proto::ViewNum* view);
+  ::dsnet::transaction::eris::proto::ViewNum* unsafe_arena_release_view();
+
+  // required .dsnet.transaction.eris.proto.DropTxns drops = 3;
+  bool has_drops() const;
+  private:
+  bool _internal_has_drops() const;
+  public:
+  void clear_drops();
+  const ::dsnet::transaction::eris::proto::DropTxns& drops() const;
+  PROTOBUF_NODISCARD ::dsnet::transaction::eris::proto::DropTxns* release_drops();
+  ::dsnet::transaction::eris::proto::DropTxns* mutable_drops();
+  void set_allocated_drops(::dsnet::transaction::eris::proto::DropTxns* drops);
+  private:
+  const ::dsnet::transaction::eris::proto::DropTxns& _internal_drops() const;
+  ::dsnet::transaction::eris::proto::DropTxns* _internal_mutable_drops();
+  public:
+  void unsafe_arena_set_allocated_drops(
+      ::dsnet::transaction::eris::proto::DropTxns* drops);
+  ::dsnet::transaction::eris::proto::DropTxns* unsafe_arena_release_drops();
+
+  // required uint64 op_num = 2;
+  bool has_op_num() const;
+  private:
+  bool _internal_has_op_num() const;
+  public:
+  void clear_op_num();
+  uint64_t op_num() const;
+  void set_op_num(uint64_t value);
+  private:
+  uint64_t _internal_op_num() const;
+  void _internal_set_op_num(uint64_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:dsnet.transaction.eris.proto.StartViewMessage)
+ private:
+  class _Internal;
+
+  // helper for ByteSizeLong()
+  size_t RequiredFieldsByteSizeFallback() const;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::dsnet::transaction::eris::proto::ViewNum* view_;
+    ::dsnet::transaction::eris::proto::DropTxns* drops_;
+    uint64_t op_num_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_transaction_2feris_2feris_2dproto_2eproto;
+};
+// -------------------------------------------------------------------
+
+class StateTransferRequestMessage final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:dsnet.transaction.eris.proto.StateTransferRequestMessage) */ {
+ public:
+  inline StateTransferRequestMessage() : StateTransferRequestMessage(nullptr) {}
+  ~StateTransferRequestMessage() override;
+  explicit PROTOBUF_CONSTEXPR StateTransferRequestMessage(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  StateTransferRequestMessage(const StateTransferRequestMessage& from);
+  StateTransferRequestMessage(StateTransferRequestMessage&& from) noexcept
+    : StateTransferRequestMessage() {
+    *this = ::std::move(from);
+  }
+
+  inline StateTransferRequestMessage& operator=(const StateTransferRequestMessage& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline StateTransferRequestMessage& operator=(StateTransferRequestMessage&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const StateTransferRequestMessage& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const StateTransferRequestMessage* internal_default_instance() {
+    return reinterpret_cast<const StateTransferRequestMessage*>(
+               &_StateTransferRequestMessage_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    11;
+
+  friend void swap(StateTransferRequestMessage& a, StateTransferRequestMessage& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(StateTransferRequestMessage* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(StateTransferRequestMessage* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  StateTransferRequestMessage* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<StateTransferRequestMessage>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const StateTransferRequestMessage& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const StateTransferRequestMessage& from) {
+    StateTransferRequestMessage::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(StateTransferRequestMessage* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "dsnet.transaction.eris.proto.StateTransferRequestMessage";
+  }
+  protected:
+  explicit StateTransferRequestMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kViewFieldNumber = 1,
+    kBeginFieldNumber = 2,
+    kEndFieldNumber = 3,
+  };
+  // required .dsnet.transaction.eris.proto.ViewNum view = 1;
+  bool has_view() const;
+  private:
+  bool _internal_has_view() const;
+  public:
+  void clear_view();
+  const ::dsnet::transaction::eris::proto::ViewNum& view() const;
+  PROTOBUF_NODISCARD ::dsnet::transaction::eris::proto::ViewNum* release_view();
+  ::dsnet::transaction::eris::proto::ViewNum* mutable_view();
+  void set_allocated_view(::dsnet::transaction::eris::proto::ViewNum* view);
+  private:
+  const ::dsnet::transaction::eris::proto::ViewNum& _internal_view() const;
+  ::dsnet::transaction::eris::proto::ViewNum* _internal_mutable_view();
+  public:
+  void unsafe_arena_set_allocated_view(
+      ::dsnet::transaction::eris::proto::ViewNum* view);
+  ::dsnet::transaction::eris::proto::ViewNum* unsafe_arena_release_view();
+
+  // required uint64 begin = 2;
+  bool has_begin() const;
+  private:
+  bool _internal_has_begin() const;
+  public:
+  void clear_begin();
+  uint64_t begin() const;
+  void set_begin(uint64_t value);
+  private:
+  uint64_t _internal_begin() const;
+  void _internal_set_begin(uint64_t value);
+  public:
+
+  // required uint64 end = 3;
+  bool has_end() const;
+  private:
+  bool _internal_has_end() const;
+  public:
+  void clear_end();
+  uint64_t end() const;
+  void set_end(uint64_t value);
+  private:
+  uint64_t _internal_end() const;
+  void _internal_set_end(uint64_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:dsnet.transaction.eris.proto.StateTransferRequestMessage)
+ private:
+  class _Internal;
+
+  // helper for ByteSizeLong()
+  size_t RequiredFieldsByteSizeFallback() const;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::dsnet::transaction::eris::proto::ViewNum* view_;
+    uint64_t begin_;
+    uint64_t end_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_transaction_2feris_2feris_2dproto_2eproto;
+};
+// -------------------------------------------------------------------
+
+class StateTransferReplyMessage_MsgLogEntry final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:dsnet.transaction.eris.proto.StateTransferReplyMessage.MsgLogEntry) */ {
+ public:
+  inline StateTransferReplyMessage_MsgLogEntry() : StateTransferReplyMessage_MsgLogEntry(nullptr) {}
+  ~StateTransferReplyMessage_MsgLogEntry() override;
+  explicit PROTOBUF_CONSTEXPR StateTransferReplyMessage_MsgLogEntry(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  StateTransferReplyMessage_MsgLogEntry(const StateTransferReplyMessage_MsgLogEntry& from);
+  StateTransferReplyMessage_MsgLogEntry(StateTransferReplyMessage_MsgLogEntry&& from) noexcept
+    : StateTransferReplyMessage_MsgLogEntry() {
+    *this = ::std::move(from);
+  }
+
+  inline StateTransferReplyMessage_MsgLogEntry& operator=(const StateTransferReplyMessage_MsgLogEntry& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline StateTransferReplyMessage_MsgLogEntry& operator=(StateTransferReplyMessage_MsgLogEntry&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const StateTransferReplyMessage_MsgLogEntry& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const StateTransferReplyMessage_MsgLogEntry* internal_default_instance() {
+    return reinterpret_cast<const StateTransferReplyMessage_MsgLogEntry*>(
+               &_StateTransferReplyMessage_MsgLogEntry_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    12;
+
+  friend void swap(StateTransferReplyMessage_MsgLogEntry& a, StateTransferReplyMessage_MsgLogEntry& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(StateTransferReplyMessage_MsgLogEntry* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(StateTransferReplyMessage_MsgLogEntry* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  StateTransferReplyMessage_MsgLogEntry* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<StateTransferReplyMessage_MsgLogEntry>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const StateTransferReplyMessage_MsgLogEntry& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const StateTransferReplyMessage_MsgLogEntry& from) {
+    StateTransferReplyMessage_MsgLogEntry::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(StateTransferReplyMessage_MsgLogEntry* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "dsnet.transaction.eris.proto.StateTransferReplyMessage.MsgLogEntry";
+  }
+  protected:
+  explicit StateTransferReplyMessage_MsgLogEntry(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kRequestFieldNumber = 7,
+    kViewFieldNumber = 1,
+    kOpNumFieldNumber = 2,
+    kSessNumFieldNumber = 3,
+    kMsgNumFieldNumber = 4,
+    kShardNumFieldNumber = 5,
+    kStateFieldNumber = 6,
+  };
+  // required .dsnet.transaction.eris.proto.RequestMessage request = 7;
+  bool has_request() const;
+  private:
+  bool _internal_has_request() const;
+  public:
+  void clear_request();
+  const ::dsnet::transaction::eris::proto::RequestMessage& request() const;
+  PROTOBUF_NODISCARD ::dsnet::transaction::eris::proto::RequestMessage* release_request();
+  ::dsnet::transaction::eris::proto::RequestMessage* mutable_request();
+  void set_allocated_request(::dsnet::transaction::eris::proto::RequestMessage* request);
+  private:
+  const ::dsnet::transaction::eris::proto::RequestMessage& _internal_request() const;
+  ::dsnet::transaction::eris::proto::RequestMessage* _internal_mutable_request();
+  public:
+  void unsafe_arena_set_allocated_request(
+      ::dsnet::transaction::eris::proto::RequestMessage* request);
+  ::dsnet::transaction::eris::proto::RequestMessage* unsafe_arena_release_request();
+
+  // required uint64 view = 1;
+  bool has_view() const;
+  private:
+  bool _internal_has_view() const;
+  public:
+  void clear_view();
+  uint64_t view() const;
+  void set_view(uint64_t value);
+  private:
+  uint64_t _internal_view() const;
+  void _internal_set_view(uint64_t value);
+  public:
+
+  // required uint64 op_num = 2;
+  bool has_op_num() const;
+  private:
+  bool _internal_has_op_num() const;
+  public:
+  void clear_op_num();
+  uint64_t op_num() const;
+  void set_op_num(uint64_t value);
+  private:
+  uint64_t _internal_op_num() const;
+  void _internal_set_op_num(uint64_t value);
+  public:
+
+  // required uint64 sess_num = 3;
+  bool has_sess_num() const;
+  private:
+  bool _internal_has_sess_num() const;
+  public:
+  void clear_sess_num();
+  uint64_t sess_num() const;
+  void set_sess_num(uint64_t value);
+  private:
+  uint64_t _internal_sess_num() const;
+  void _internal_set_sess_num(uint64_t value);
+  public:
+
+  // required uint64 msg_num = 4;
+  bool has_msg_num() const;
+  private:
+  bool _internal_has_msg_num() const;
+  public:
+  void clear_msg_num();
+  uint64_t msg_num() const;
+  void set_msg_num(uint64_t value);
+  private:
+  uint64_t _internal_msg_num() const;
+  void _internal_set_msg_num(uint64_t value);
+  public:
+
+  // required uint64 shard_num = 5;
+  bool has_shard_num() const;
+  private:
+  bool _internal_has_shard_num() const;
+  public:
+  void clear_shard_num();
+  uint64_t shard_num() const;
+  void set_shard_num(uint64_t value);
+  private:
+  uint64_t _internal_shard_num() const;
+  void _internal_set_shard_num(uint64_t value);
+  public:
+
+  // required uint32 state = 6;
+  bool has_state() const;
+  private:
+  bool _internal_has_state() const;
+  public:
+  void clear_state();
+  uint32_t state() const;
+  void set_state(uint32_t value);
+  private:
+  uint32_t _internal_state() const;
+  void _internal_set_state(uint32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:dsnet.transaction.eris.proto.StateTransferReplyMessage.MsgLogEntry)
+ private:
+  class _Internal;
+
+  // helper for ByteSizeLong()
+  size_t RequiredFieldsByteSizeFallback() const;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::dsnet::transaction::eris::proto::RequestMessage* request_;
+    uint64_t view_;
+    uint64_t op_num_;
+    uint64_t sess_num_;
+    uint64_t msg_num_;
+    uint64_t shard_num_;
+    uint32_t state_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_transaction_2feris_2feris_2dproto_2eproto;
+};
+// -------------------------------------------------------------------
+
+class StateTransferReplyMessage final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:dsnet.transaction.eris.proto.StateTransferReplyMessage) */ {
+ public:
+  inline StateTransferReplyMessage() : StateTransferReplyMessage(nullptr) {}
+  ~StateTransferReplyMessage() override;
+  explicit PROTOBUF_CONSTEXPR StateTransferReplyMessage(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  StateTransferReplyMessage(const StateTransferReplyMessage& from);
+  StateTransferReplyMessage(StateTransferReplyMessage&& from) noexcept
+    : StateTransferReplyMessage() {
+    *this = ::std::move(from);
+  }
+
+  inline StateTransferReplyMessage& operator=(const StateTransferReplyMessage& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline StateTransferReplyMessage& operator=(StateTransferReplyMessage&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const StateTransferReplyMessage& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const StateTransferReplyMessage* internal_default_instance() {
+    return reinterpret_cast<const StateTransferReplyMessage*>(
+               &_StateTransferReplyMessage_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    13;
+
+  friend void swap(StateTransferReplyMessage& a, StateTransferReplyMessage& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(StateTransferReplyMessage* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(StateTransferReplyMessage* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  StateTransferReplyMessage* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<StateTransferReplyMessage>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const StateTransferReplyMessage& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const StateTransferReplyMessage& from) {
+    StateTransferReplyMessage::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(StateTransferReplyMessage* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "dsnet.transaction.eris.proto.StateTransferReplyMessage";
+  }
+  protected:
+  explicit StateTransferReplyMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  typedef StateTransferReplyMessage_MsgLogEntry MsgLogEntry;
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kEntriesFieldNumber = 4,
+    kViewFieldNumber = 1,
+    kBeginFieldNumber = 2,
+    kEndFieldNumber = 3,
+  };
+  // repeated .dsnet.transaction.eris.proto.StateTransferReplyMessage.MsgLogEntry entries = 4;
+  int entries_size() const;
+  private:
+  int _internal_entries_size() const;
+  public:
+  void clear_entries();
+  ::dsnet::transaction::eris::proto::StateTransferReplyMessage_MsgLogEntry* mutable_entries(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::dsnet::transaction::eris::proto::StateTransferReplyMessage_MsgLogEntry >*
+      mutable_entries();
+  private:
+  const ::dsnet::transaction::eris::proto::StateTransferReplyMessage_MsgLogEntry& _internal_entries(int index) const;
+  ::dsnet::transaction::eris::proto::StateTransferReplyMessage_MsgLogEntry* _internal_add_entries();
+  public:
+  const ::dsnet::transaction::eris::proto::StateTransferReplyMessage_MsgLogEntry& entries(int index) const;
+  ::dsnet::transaction::eris::proto::StateTransferReplyMessage_MsgLogEntry* add_entries();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::dsnet::transaction::eris::proto::StateTransferReplyMessage_MsgLogEntry >&
+      entries() const;
+
+  // required .dsnet.transaction.eris.proto.ViewNum view = 1;
+  bool has_view() const;
+  private:
+  bool _internal_has_view() const;
+  public:
+  void clear_view();
+  const ::dsnet::transaction::eris::proto::ViewNum& view() const;
+  PROTOBUF_NODISCARD ::dsnet::transaction::eris::proto::ViewNum* release_view();
+  ::dsnet::transaction::eris::proto::ViewNum* mutable_view();
+  void set_allocated_view(::dsnet::transaction::eris::proto::ViewNum* view);
+  private:
+  const ::dsnet::transaction::eris::proto::ViewNum& _internal_view() const;
+  ::dsnet::transaction::eris::proto::ViewNum* _internal_mutable_view();
+  public:
+  void unsafe_arena_set_allocated_view(
+      ::dsnet::transaction::eris::proto::ViewNum* view);
+  ::dsnet::transaction::eris::proto::ViewNum* unsafe_arena_release_view();
+
+  // required uint64 begin = 2;
+  bool has_begin() const;
+  private:
+  bool _internal_has_begin() const;
+  public:
+  void clear_begin();
+  uint64_t begin() const;
+  void set_begin(uint64_t value);
+  private:
+  uint64_t _internal_begin() const;
+  void _internal_set_begin(uint64_t value);
+  public:
+
+  // required uint64 end = 3;
+  bool has_end() const;
+  private:
+  bool _internal_has_end() const;
+  public:
+  void clear_end();
+  uint64_t end() const;
+  void set_end(uint64_t value);
+  private:
+  uint64_t _internal_end() const;
+  void _internal_set_end(uint64_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:dsnet.transaction.eris.proto.StateTransferReplyMessage)
+ private:
+  class _Internal;
+
+  // helper for ByteSizeLong()
+  size_t RequiredFieldsByteSizeFallback() const;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::dsnet::transaction::eris::proto::StateTransferReplyMessage_MsgLogEntry > entries_;
+    ::dsnet::transaction::eris::proto::ViewNum* view_;
+    uint64_t begin_;
+    uint64_t end_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_transaction_2feris_2feris_2dproto_2eproto;
+};
+// -------------------------------------------------------------------
+
+class EpochChangeStateTransferRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:dsnet.transaction.eris.proto.EpochChangeStateTransferRequest) */ {
+ public:
+  inline EpochChangeStateTransferRequest() : EpochChangeStateTransferRequest(nullptr) {}
+  ~EpochChangeStateTransferRequest() override;
+  explicit PROTOBUF_CONSTEXPR EpochChangeStateTransferRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  EpochChangeStateTransferRequest(const EpochChangeStateTransferRequest& from);
+  EpochChangeStateTransferRequest(EpochChangeStateTransferRequest&& from) noexcept
+    : EpochChangeStateTransferRequest() {
+    *this = ::std::move(from);
+  }
+
+  inline EpochChangeStateTransferRequest& operator=(const EpochChangeStateTransferRequest& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline EpochChangeStateTransferRequest& operator=(EpochChangeStateTransferRequest&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const EpochChangeStateTransferRequest& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const EpochChangeStateTransferRequest* internal_default_instance() {
+    return reinterpret_cast<const EpochChangeStateTransferRequest*>(
+               &_EpochChangeStateTransferRequest_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    14;
+
+  friend void swap(EpochChangeStateTransferRequest& a, EpochChangeStateTransferRequest& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(EpochChangeStateTransferRequest* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(EpochChangeStateTransferRequest* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  EpochChangeStateTransferRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<EpochChangeStateTransferRequest>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const EpochChangeStateTransferRequest& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const EpochChangeStateTransferRequest& from) {
+    EpochChangeStateTransferRequest::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(EpochChangeStateTransferRequest* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "dsnet.transaction.eris.proto.EpochChangeStateTransferRequest";
+  }
+  protected:
+  explicit EpochChangeStateTransferRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kSessNumFieldNumber = 1,
+    kStateTransferSessNumFieldNumber = 2,
+    kBeginFieldNumber = 4,
+    kEndFieldNumber = 5,
+    kShardNumFieldNumber = 3,
+  };
+  // required uint64 sess_num = 1;
+  bool has_sess_num() const;
+  private:
+  bool _internal_has_sess_num() const;
+  public:
+  void clear_sess_num();
+  uint64_t sess_num() const;
+  void set_sess_num(uint64_t value);
+  private:
+  uint64_t _internal_sess_num() const;
+  void _internal_set_sess_num(uint64_t value);
+  public:
+
+  // required uint64 state_transfer_sess_num = 2;
+  bool has_state_transfer_sess_num() const;
+  private:
+  bool _internal_has_state_transfer_sess_num() const;
+  public:
+  void clear_state_transfer_sess_num();
+  uint64_t state_transfer_sess_num() const;
+  void set_state_transfer_sess_num(uint64_t value);
+  private:
+  uint64_t _internal_state_transfer_sess_num() const;
+  void _internal_set_state_transfer_sess_num(uint64_t value);
+  public:
+
+  // required uint64 begin = 4;
+  bool has_begin() const;
+  private:
+  bool _internal_has_begin() const;
+  public:
+  void clear_begin();
+  uint64_t begin() const;
+  void set_begin(uint64_t value);
+  private:
+  uint64_t _internal_begin() const;
+  void _internal_set_begin(uint64_t value);
+  public:
+
+  // required uint64 end = 5;
+  bool has_end() const;
+  private:
+  bool _internal_has_end() const;
+  public:
+  void clear_end();
+  uint64_t end() const;
+  void set_end(uint64_t value);
+  private:
+  uint64_t _internal_end() const;
+  void _internal_set_end(uint64_t value);
+  public:
+
+  // required uint32 shard_num = 3;
+  bool has_shard_num() const;
+  private:
+  bool _internal_has_shard_num() const;
+  public:
+  void clear_shard_num();
+  uint32_t shard_num() const;
+  void set_shard_num(uint32_t value);
+  private:
+  uint32_t _internal_shard_num() const;
+  void _internal_set_shard_num(uint32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:dsnet.transaction.eris.proto.EpochChangeStateTransferRequest)
+ private:
+  class _Internal;
+
+  // helper for ByteSizeLong()
+  size_t RequiredFieldsByteSizeFallback() const;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    uint64_t sess_num_;
+    uint64_t state_transfer_sess_num_;
+    uint64_t begin_;
+    uint64_t end_;
+    uint32_t shard_num_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_transaction_2feris_2feris_2dproto_2eproto;
+};
+// -------------------------------------------------------------------
+
+class EpochChangeStateTransferReply_MsgEntry final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:dsnet.transaction.eris.proto.EpochChangeStateTransferReply.MsgEntry) */ {
+ public:
+  inline EpochChangeStateTransferReply_MsgEntry() : EpochChangeStateTransferReply_MsgEntry(nullptr) {}
+  ~EpochChangeStateTransferReply_MsgEntry() override;
+  explicit PROTOBUF_CONSTEXPR EpochChangeStateTransferReply_MsgEntry(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  EpochChangeStateTransferReply_MsgEntry(const EpochChangeStateTransferReply_MsgEntry& from);
+  EpochChangeStateTransferReply_MsgEntry(EpochChangeStateTransferReply_MsgEntry&& from) noexcept
+    : EpochChangeStateTransferReply_MsgEntry() {
+    *this = ::std::move(from);
+  }
+
+  inline EpochChangeStateTransferReply_MsgEntry& operator=(const EpochChangeStateTransferReply_MsgEntry& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline EpochChangeStateTransferReply_MsgEntry& operator=(EpochChangeStateTransferReply_MsgEntry&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const EpochChangeStateTransferReply_MsgEntry& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const EpochChangeStateTransferReply_MsgEntry* internal_default_instance() {
+    return reinterpret_cast<const EpochChangeStateTransferReply_MsgEntry*>(
+               &_EpochChangeStateTransferReply_MsgEntry_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    15;
+
+  friend void swap(EpochChangeStateTransferReply_MsgEntry& a, EpochChangeStateTransferReply_MsgEntry& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(EpochChangeStateTransferReply_MsgEntry* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(EpochChangeStateTransferReply_MsgEntry* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  EpochChangeStateTransferReply_MsgEntry* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<EpochChangeStateTransferReply_MsgEntry>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const EpochChangeStateTransferReply_MsgEntry& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const EpochChangeStateTransferReply_MsgEntry& from) {
+    EpochChangeStateTransferReply_MsgEntry::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(EpochChangeStateTransferReply_MsgEntry* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "dsnet.transaction.eris.proto.EpochChangeStateTransferReply.MsgEntry";
+  }
+  protected:
+  explicit EpochChangeStateTransferReply_MsgEntry(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kRequestFieldNumber = 2,
+    kMsgNumFieldNumber = 1,
+  };
+  // required .dsnet.transaction.eris.proto.RequestMessage request = 2;
+  bool has_request() const;
+  private:
+  bool _internal_has_request() const;
+  public:
+  void clear_request();
+  const ::dsnet::transaction::eris::proto::RequestMessage& request() const;
+  PROTOBUF_NODISCARD ::dsnet::transaction::eris::proto::RequestMessage* release_request();
+  ::dsnet::transaction::eris::proto::RequestMessage* mutable_request();
+  void set_allocated_request(::dsnet::transaction::eris::proto::RequestMessage* request);
+  private:
+  const ::dsnet::transaction::eris::proto::RequestMessage& _internal_request() const;
+  ::dsnet::transaction::eris::proto::RequestMessage* _internal_mutable_request();
+  public:
+  void unsafe_arena_set_allocated_request(
+      ::dsnet::transaction::eris::proto::RequestMessage* request);
+  ::dsnet::transaction::eris::proto::RequestMessage* unsafe_arena_release_request();
+
+  // required uint64 msg_num = 1;
+  bool has_msg_num() const;
+  private:
+  bool _internal_has_msg_num() const;
+  public:
+  void clear_msg_num();
+  uint64_t msg_num() const;
+  void set_msg_num(uint64_t value);
+  private:
+  uint64_t _internal_msg_num() const;
+  void _internal_set_msg_num(uint64_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:dsnet.transaction.eris.proto.EpochChangeStateTransferReply.MsgEntry)
+ private:
+  class _Internal;
+
+  // helper for ByteSizeLong()
+  size_t RequiredFieldsByteSizeFallback() const;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::dsnet::transaction::eris::proto::RequestMessage* request_;
+    uint64_t msg_num_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_transaction_2feris_2feris_2dproto_2eproto;
+};
+// -------------------------------------------------------------------
+
+class EpochChangeStateTransferReply final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:dsnet.transaction.eris.proto.EpochChangeStateTransferReply) */ {
+ public:
+  inline EpochChangeStateTransferReply() : EpochChangeStateTransferReply(nullptr) {}
+  ~EpochChangeStateTransferReply() override;
+  explicit PROTOBUF_CONSTEXPR EpochChangeStateTransferReply(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  EpochChangeStateTransferReply(const EpochChangeStateTransferReply& from);
+  EpochChangeStateTransferReply(EpochChangeStateTransferReply&& from) noexcept
+    : EpochChangeStateTransferReply() {
+    *this = ::std::move(from);
+  }
+
+  inline EpochChangeStateTransferReply& operator=(const EpochChangeStateTransferReply& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline EpochChangeStateTransferReply& operator=(EpochChangeStateTransferReply&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const EpochChangeStateTransferReply& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const EpochChangeStateTransferReply* internal_default_instance() {
+    return reinterpret_cast<const EpochChangeStateTransferReply*>(
+               &_EpochChangeStateTransferReply_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    16;
+
+  friend void swap(EpochChangeStateTransferReply& a, EpochChangeStateTransferReply& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(EpochChangeStateTransferReply* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(EpochChangeStateTransferReply* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  EpochChangeStateTransferReply* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<EpochChangeStateTransferReply>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const EpochChangeStateTransferReply& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const EpochChangeStateTransferReply& from) {
+    EpochChangeStateTransferReply::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(EpochChangeStateTransferReply* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "dsnet.transaction.eris.proto.EpochChangeStateTransferReply";
+  }
+  protected:
+  explicit EpochChangeStateTransferReply(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  typedef EpochChangeStateTransferReply_MsgEntry MsgEntry;
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kEntriesFieldNumber = 4,
+    kSessNumFieldNumber = 1,
+    kStateTransferSessNumFieldNumber = 2,
+    kShardNumFieldNumber = 3,
+  };
+  // repeated .dsnet.transaction.eris.proto.EpochChangeStateTransferReply.MsgEntry entries = 4;
+  int entries_size() const;
+  private:
+  int _internal_entries_size() const;
+  public:
+  void clear_entries();
+  ::dsnet::transaction::eris::proto::EpochChangeStateTransferReply_MsgEntry* mutable_entries(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::dsnet::transaction::eris::proto::EpochChangeStateTransferReply_MsgEntry >*
+      mutable_entries();
+  private:
+  const ::dsnet::transaction::eris::proto::EpochChangeStateTransferReply_MsgEntry& _internal_entries(int index) const;
+  ::dsnet::transaction::eris::proto::EpochChangeStateTransferReply_MsgEntry* _internal_add_entries();
+  public:
+  const ::dsnet::transaction::eris::proto::EpochChangeStateTransferReply_MsgEntry& entries(int index) const;
+  ::dsnet::transaction::eris::proto::EpochChangeStateTransferReply_MsgEntry* add_entries();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::dsnet::transaction::eris::proto::EpochChangeStateTransferReply_MsgEntry >&
+      entries() const;
+
+  // required uint64 sess_num = 1;
+  bool has_sess_num() const;
+  private:
+  bool _internal_has_sess_num() const;
+  public:
+  void clear_sess_num();
+  uint64_t sess_num() const;
+  void set_sess_num(uint64_t value);
+  private:
+  uint64_t _internal_sess_num() const;
+  void _internal_set_sess_num(uint64_t value);
+  public:
+
+  // required uint64 state_transfer_sess_num = 2;
+  bool has_state_transfer_sess_num() const;
+  private:
+  bool _internal_has_state_transfer_sess_num() const;
+  public:
+  void clear_state_transfer_sess_num();
+  uint64_t state_transfer_sess_num() const;
+  void set_state_transfer_sess_num(uint64_t value);
+  private:
+  uint64_t _internal_state_transfer_sess_num() const;
+  void _internal_set_state_transfer_sess_num(uint64_t value);
+  public:
+
+  // required uint32 shard_num = 3;
+  bool has_shard_num() const;
+  private:
+  bool _internal_has_shard_num() const;
+  public:
+  void clear_shard_num();
+  uint32_t shard_num() const;
+  void set_shard_num(uint32_t value);
+  private:
+  uint32_t _internal_shard_num() const;
+  void _internal_set_shard_num(uint32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:dsnet.transaction.eris.proto.EpochChangeStateTransferReply)
+ private:
+  class _Internal;
+
+  // helper for ByteSizeLong()
+  size_t RequiredFieldsByteSizeFallback() const;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::dsnet::transaction::eris::proto::EpochChangeStateTransferReply_MsgEntry > entries_;
+    uint64_t sess_num_;
+    uint64_t state_transfer_sess_num_;
+    uint32_t shard_num_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_transaction_2feris_2feris_2dproto_2eproto;
+};
+// -------------------------------------------------------------------
+
+class ToServerMessage final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:dsnet.transaction.eris.proto.ToServerMessage) */ {
+ public:
+  inline ToServerMessage() : ToServerMessage(nullptr) {}
+  ~ToServerMessage() override;
+  explicit PROTOBUF_CONSTEXPR ToServerMessage(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  ToServerMessage(const ToServerMessage& from);
+  ToServerMessage(ToServerMessage&& from) noexcept
+    : ToServerMessage() {
+    *this = ::std::move(from);
+  }
+
+  inline ToServerMessage& operator=(const ToServerMessage& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline ToServerMessage& operator=(ToServerMessage&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ToServerMessage& default_instance() {
+    return *internal_default_instance();
+  }
+  enum MsgCase {
+    kRequest = 1,
+    kGapRequest = 2,
+    kGapReply = 3,
+    kFc = 4,
+    kSyncPrepare = 5,
+    kViewChangeRequest = 6,
+    kViewChange = 7,
+    kStartView = 8,
+    kStateTransferRequest = 9,
+    kStateTransferReply = 10,
+    kEpochChangeStateTransferRequest = 11,
+    kEpochChangeStateTransferReply = 12,
+    MSG_NOT_SET = 0,
+  };
+
+  static inline const ToServerMessage* internal_default_instance() {
+    return reinterpret_cast<const ToServerMessage*>(
+               &_ToServerMessage_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    17;
+
+  friend void swap(ToServerMessage& a, ToServerMessage& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(ToServerMessage* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ToServerMessage* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  ToServerMessage* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ToServerMessage>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const ToServerMessage& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ToServerMessage& from) {
+    ToServerMessage::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(ToServerMessage* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "dsnet.transaction.eris.proto.ToServerMessage";
+  }
+  protected:
+  explicit ToServerMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kRequestFieldNumber = 1,
+    kGapRequestFieldNumber = 2,
+    kGapReplyFieldNumber = 3,
+    kFcFieldNumber = 4,
+    kSyncPrepareFieldNumber = 5,
+    kViewChangeRequestFieldNumber = 6,
+    kViewChangeFieldNumber = 7,
+    kStartViewFieldNumber = 8,
+    kStateTransferRequestFieldNumber = 9,
+    kStateTransferReplyFieldNumber = 10,
+    kEpochChangeStateTransferRequestFieldNumber = 11,
+    kEpochChangeStateTransferReplyFieldNumber = 12,
+  };
+  // .dsnet.transaction.eris.proto.RequestMessage request = 1;
+  bool has_request() const;
+  private:
+  bool _internal_has_request() const;
+  public:
+  void clear_request();
+  const ::dsnet::transaction::eris::proto::RequestMessage& request() const;
+  PROTOBUF_NODISCARD ::dsnet::transaction::eris::proto::RequestMessage* release_request();
+  ::dsnet::transaction::eris::proto::RequestMessage* mutable_request();
+  void set_allocated_request(::dsnet::transaction::eris::proto::RequestMessage* request);
+  private:
+  const ::dsnet::transaction::eris::proto::RequestMessage& _internal_request() const;
+  ::dsnet::transaction::eris::proto::RequestMessage* _internal_mutable_request();
+  public:
+  void unsafe_arena_set_allocated_request(
+      ::dsnet::transaction::eris::proto::RequestMessage* request);
+  ::dsnet::transaction::eris::proto::RequestMessage* unsafe_arena_release_request();
+
+  // .dsnet.transaction.eris.proto.GapRequestMessage gap_request = 2;
+  bool has_gap_request() const;
+  private:
+  bool _internal_has_gap_request() const;
+  public:
+  void clear_gap_request();
+  const ::dsnet::transaction::eris::proto::GapRequestMessage& gap_request() const;
+  PROTOBUF_NODISCARD ::dsnet::transaction::eris::proto::GapRequestMessage* release_gap_request();
+  ::dsnet::transaction::eris::proto::GapRequestMessage* mutable_gap_request();
+  void set_allocated_gap_request(::dsnet::transaction::eris::proto::GapRequestMessage* gap_request);
+  private:
+  const ::dsnet::transaction::eris::proto::GapRequestMessage& _internal_gap_request() const;
+  ::dsnet::transaction::eris::proto::GapRequestMessage* _internal_mutable_gap_request();
+  public:
+  void unsafe_arena_set_allocated_gap_request(
+      ::dsnet::transaction::eris::proto::GapRequestMessage* gap_request);
+  ::dsnet::transaction::eris::proto::GapRequestMessage* unsafe_arena_release_gap_request();
+
+  // .dsnet.transaction.eris.proto.GapReplyMessage gap_reply = 3;
+  bool has_gap_reply() const;
+  private:
+  bool _internal_has_gap_reply() const;
+  public:
+  void clear_gap_reply();
+  const ::dsnet::transaction::eris::proto::GapReplyMessage& gap_reply() const;
+  PROTOBUF_NODISCARD ::dsnet::transaction::eris::proto::GapReplyMessage* release_gap_reply();
+  ::dsnet::transaction::eris::proto::GapReplyMessage* mutable_gap_reply();
+  void set_allocated_gap_reply(::dsnet::transaction::eris::proto::GapReplyMessage* gap_reply);
+  private:
+  const ::dsnet::transaction::eris::proto::GapReplyMessage& _internal_gap_reply() const;
+  ::dsnet::transaction::eris::proto::GapReplyMessage* _internal_mutable_gap_reply();
+  public:
+  void unsafe_arena_set_allocated_gap_reply(
+      ::dsnet::transaction::eris::proto::GapReplyMessage* gap_reply);
+  ::dsnet::transaction::eris::proto::GapReplyMessage* unsafe_arena_release_gap_reply();
+
+  // .dsnet.transaction.eris.proto.FCToErisMessage fc = 4;
+  bool has_fc() const;
+  private:
+  bool _internal_has_fc() const;
+  public:
+  void clear_fc();
+  const ::dsnet::transaction::eris::proto::FCToErisMessage& fc() const;
+  PROTOBUF_NODISCARD ::dsnet::transaction::eris::proto::FCToErisMessage* release_fc();
+  ::dsnet::transaction::eris::proto::FCToErisMessage* mutable_fc();
+  void set_allocated_fc(::dsnet::transaction::eris::proto::FCToErisMessage* fc);
+  private:
+  const ::dsnet::transaction::eris::proto::FCToErisMessage& _internal_fc() const;
+  ::dsnet::transaction::eris::proto::FCToErisMessage* _internal_mutable_fc();
+  public:
+  void unsafe_arena_set_allocated_fc(
+      ::dsnet::transaction::eris::proto::FCToErisMessage* fc);
+  ::dsnet::transaction::eris::proto::FCToErisMessage* unsafe_arena_release_fc();
+
+  // .dsnet.transaction.eris.proto.SyncPrepareMessage sync_prepare = 5;
+  bool has_sync_prepare() const;
+  private:
+  bool _internal_has_sync_prepare() const;
+  public:
+  void clear_sync_prepare();
+  const ::dsnet::transaction::eris::proto::SyncPrepareMessage& sync_prepare() const;
+  PROTOBUF_NODISCARD ::dsnet::transaction::eris::proto::SyncPrepareMessage* release_sync_prepare();
+  ::dsnet::transaction::eris::proto::SyncPrepareMessage* mutable_sync_prepare();
+  void set_allocated_sync_prepare(::dsnet::transaction::eris::proto::SyncPrepareMessage* sync_prepare);
+  private:
+  const ::dsnet::transaction::eris::proto::SyncPrepareMessage& _internal_sync_prepare() const;
+  ::dsnet::transaction::eris::proto::SyncPrepareMessage* _internal_mutable_sync_prepare();
+  public:
+  void unsafe_arena_set_allocated_sync_prepare(
+      ::dsnet::transaction::eris::proto::SyncPrepareMessage* sync_prepare);
+  ::dsnet::transaction::eris::proto::SyncPrepareMessage* unsafe_arena_release_sync_prepare();
+
+  // .dsnet.transaction.eris.proto.ViewChangeRequestMessage view_change_request = 6;
+  bool has_view_change_request() const;
+  private:
+  bool _internal_has_view_change_request() const;
+  public:
+  void clear_view_change_request();
+  const ::dsnet::transaction::eris::proto::ViewChangeRequestMessage& view_change_request() const;
+  PROTOBUF_NODISCARD ::dsnet::transaction::eris::proto::ViewChangeRequestMessage* release_view_change_request();
+  ::dsnet::transaction::eris::proto::ViewChangeRequestMessage* mutable_view_change_request();
+  void set_allocated_view_change_request(::dsnet::transaction::eris::proto::ViewChangeRequestMessage* view_change_request);
+  private:
+  const ::dsnet::transaction::eris::proto::ViewChangeRequestMessage& _internal_view_change_request() const;
+  ::dsnet::transaction::eris::proto::ViewChangeRequestMessage* _internal_mutable_view_change_request();
+  public:
+  void unsafe_arena_set_allocated_view_change_request(
+      ::dsnet::transaction::eris::proto::ViewChangeRequestMessage* view_change_request);
+  ::dsnet::transaction::eris::proto::ViewChangeRequestMessage* unsafe_arena_release_view_change_request();
+
+  // .dsnet.transaction.eris.proto.ViewChangeMessage view_change = 7;
+  bool has_view_change() const;
+  private:
+  bool _internal_has_view_change() const;
+  public:
+  void clear_view_change();
+  const ::dsnet::transaction::eris::proto::ViewChangeMessage& view_change() const;
+  PROTOBUF_NODISCARD ::dsnet::transaction::eris::proto::ViewChangeMessage* release_view_change();
+  ::dsnet::transaction::eris::proto::ViewChangeMessage* mutable_view_change();
+  void set_allocated_view_change(::dsnet::transaction::eris::proto::ViewChangeMessage* view_change);
+  private:
+  const ::dsnet::transaction::eris::proto::ViewChangeMessage& _internal_view_change() const;
+  ::dsnet::transaction::eris::proto::ViewChangeMessage* _internal_mutable_view_change();
+  public:
+  void unsafe_arena_set_allocated_view_change(
+      ::dsnet::transaction::eris::proto::ViewChangeMessage* view_change);
+  ::dsnet::transaction::eris::proto::ViewChangeMessage* unsafe_arena_release_view_change();
+
+  // .dsnet.transaction.eris.proto.StartViewMessage start_view = 8;
+  bool has_start_view() const;
+  private:
+  bool _internal_has_start_view() const;
+  public:
+  void clear_start_view();
+  const ::dsnet::transaction::eris::proto::StartViewMessage& start_view() const;
+  PROTOBUF_NODISCARD ::dsnet::transaction::eris::proto::StartViewMessage* release_start_view();
+  ::dsnet::transaction::eris::proto::StartViewMessage* mutable_start_view();
+  void set_allocated_start_view(::dsnet::transaction::eris::proto::StartViewMessage* start_view);
+  private:
+  const ::dsnet::transaction::eris::proto::StartViewMessage& _internal_start_view() const;
+  ::dsnet::transaction::eris::proto::StartViewMessage* _internal_mutable_start_view();
+  public:
+  void unsafe_arena_set_allocated_start_view(
+      ::dsnet::transaction::eris::proto::StartViewMessage* start_view);
+  ::dsnet::transaction::eris::proto::StartViewMessage* unsafe_arena_release_start_view();
+
+  // .dsnet.transaction.eris.proto.StateTransferRequestMessage state_transfer_request = 9;
+  bool has_state_transfer_request() const;
+  private:
+  bool _internal_has_state_transfer_request() const;
+  public:
+  void clear_state_transfer_request();
+  const ::dsnet::transaction::eris::proto::StateTransferRequestMessage& state_transfer_request() const;
+  PROTOBUF_NODISCARD ::dsnet::transaction::eris::proto::StateTransferRequestMessage* release_state_transfer_request();
+  ::dsnet::transaction::eris::proto::StateTransferRequestMessage* mutable_state_transfer_request();
+  void set_allocated_state_transfer_request(::dsnet::transaction::eris::proto::StateTransferRequestMessage* state_transfer_request);
+  private:
+  const ::dsnet::transaction::eris::proto::StateTransferRequestMessage& _internal_state_transfer_request() const;
+  ::dsnet::transaction::eris::proto::StateTransferRequestMessage* _internal_mutable_state_transfer_request();
+  public:
+  void unsafe_arena_set_allocated_state_transfer_request(
+      ::dsnet::transaction::eris::proto::StateTransferRequestMessage* state_transfer_request);
+  ::dsnet::transaction::eris::proto::StateTransferRequestMessage* unsafe_arena_release_state_transfer_request();
+
+  // .dsnet.transaction.eris.proto.StateTransferReplyMessage state_transfer_reply = 10;
+  bool has_state_transfer_reply() const;
+  private:
+  bool _internal_has_state_transfer_reply() const;
+  public:
+  void clear_state_transfer_reply();
+  const ::dsnet::transaction::eris::proto::StateTransferReplyMessage& state_transfer_reply() const;
+  PROTOBUF_NODISCARD ::dsnet::transaction::eris::proto::StateTransferReplyMessage* release_state_transfer_reply();
+  ::dsnet::transaction::eris::proto::StateTransferReplyMessage* mutable_state_transfer_reply();
+  void set_allocated_state_transfer_reply(::dsnet::transaction::eris::proto::StateTransferReplyMessage* state_transfer_reply);
+  private:
+  const ::dsnet::transaction::eris::proto::StateTransferReplyMessage& _internal_state_transfer_reply() const;
+  ::dsnet::transaction::eris::proto::StateTransferReplyMessage* _internal_mutable_state_transfer_reply();
+  public:
+  void unsafe_arena_set_allocated_state_transfer_reply(
+      ::dsnet::transaction::eris::proto::StateTransferReplyMessage* state_transfer_reply);
+  ::dsnet::transaction::eris::proto::StateTransferReplyMessage* unsafe_arena_release_state_transfer_reply();
+
+  // .dsnet.transaction.eris.proto.EpochChangeStateTransferRequest epoch_change_state_transfer_request = 11;
+  bool has_epoch_change_state_transfer_request() const;
+  private:
+  bool _internal_has_epoch_change_state_transfer_request() const;
+  public:
+  void clear_epoch_change_state_transfer_request();
+  const ::dsnet::transaction::eris::proto::EpochChangeStateTransferRequest& epoch_change_state_transfer_request() const;
+  PROTOBUF_NODISCARD ::dsnet::transaction::eris::proto::EpochChangeStateTransferRequest* release_epoch_change_state_transfer_request();
+  ::dsnet::transaction::eris::proto::EpochChangeStateTransferRequest* mutable_epoch_change_state_transfer_request();
+  void set_allocated_epoch_change_state_transfer_request(::dsnet::transaction::eris::proto::EpochChangeStateTransferRequest* epoch_change_state_transfer_request);
+  private:
+  const ::dsnet::transaction::eris::proto::EpochChangeStateTransferRequest& _internal_epoch_change_state_transfer_request() const;
+  ::dsnet::transaction::eris::proto::EpochChangeStateTransferRequest* _internal_mutable_epoch_change_state_transfer_request();
+  public:
+  void unsafe_arena_set_allocated_epoch_change_state_transfer_request(
+      ::dsnet::transaction::eris::proto::EpochChangeStateTransferRequest* epoch_change_state_transfer_request);
+  ::dsnet::transaction::eris::proto::EpochChangeStateTransferRequest* unsafe_arena_release_epoch_change_state_transfer_request();
+
+  // .dsnet.transaction.eris.proto.EpochChangeStateTransferReply epoch_change_state_transfer_reply = 12;
+  bool has_epoch_change_state_transfer_reply() const;
+  private:
+  bool _internal_has_epoch_change_state_transfer_reply() const;
+  public:
+  void clear_epoch_change_state_transfer_reply();
+  const ::dsnet::transaction::eris::proto::EpochChangeStateTransferReply& epoch_change_state_transfer_reply() const;
+  PROTOBUF_NODISCARD ::dsnet::transaction::eris::proto::EpochChangeStateTransferReply* release_epoch_change_state_transfer_reply();
+  ::dsnet::transaction::eris::proto::EpochChangeStateTransferReply* mutable_epoch_change_state_transfer_reply();
+  void set_allocated_epoch_change_state_transfer_reply(::dsnet::transaction::eris::proto::EpochChangeStateTransferReply* epoch_change_state_transfer_reply);
+  private:
+  const ::dsnet::transaction::eris::proto::EpochChangeStateTransferReply& _internal_epoch_change_state_transfer_reply() const;
+  ::dsnet::transaction::eris::proto::EpochChangeStateTransferReply* _internal_mutable_epoch_change_state_transfer_reply();
+  public:
+  void unsafe_arena_set_allocated_epoch_change_state_transfer_reply(
+      ::dsnet::transaction::eris::proto::EpochChangeStateTransferReply* epoch_change_state_transfer_reply);
+  ::dsnet::transaction::eris::proto::EpochChangeStateTransferReply* unsafe_arena_release_epoch_change_state_transfer_reply();
+
+  void clear_msg();
+  MsgCase msg_case() const;
+  // @@protoc_insertion_point(class_scope:dsnet.transaction.eris.proto.ToServerMessage)
+ private:
+  class _Internal;
+  void set_has_request();
+  void set_has_gap_request();
+  void set_has_gap_reply();
+  void set_has_fc();
+  void set_has_sync_prepare();
+  void set_has_view_change_request();
+  void set_has_view_change();
+  void set_has_start_view();
+  void set_has_state_transfer_request();
+  void set_has_state_transfer_reply();
+  void set_has_epoch_change_state_transfer_request();
+  void set_has_epoch_change_state_transfer_reply();
+
+  inline bool has_msg() const;
+  inline void clear_has_msg();
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    union MsgUnion {
+      constexpr MsgUnion() : _constinit_{} {}
+        ::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized _constinit_;
+      ::dsnet::transaction::eris::proto::RequestMessage* request_;
+      ::dsnet::transaction::eris::proto::GapRequestMessage* gap_request_;
+      ::dsnet::transaction::eris::proto::GapReplyMessage* gap_reply_;
+      ::dsnet::transaction::eris::proto::FCToErisMessage* fc_;
+      ::dsnet::transaction::eris::proto::SyncPrepareMessage* sync_prepare_;
+      ::dsnet::transaction::eris::proto::ViewChangeRequestMessage* view_change_request_;
+      ::dsnet::transaction::eris::proto::ViewChangeMessage* view_change_;
+      ::dsnet::transaction::eris::proto::StartViewMessage* start_view_;
+      ::dsnet::transaction::eris::proto::StateTransferRequestMessage* state_transfer_request_;
+      ::dsnet::transaction::eris::proto::StateTransferReplyMessage* state_transfer_reply_;
+      ::dsnet::transaction::eris::proto::EpochChangeStateTransferRequest* epoch_change_state_transfer_request_;
+      ::dsnet::transaction::eris::proto::EpochChangeStateTransferReply* epoch_change_state_transfer_reply_;
+    } msg_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    uint32_t _oneof_case_[1];
+
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_transaction_2feris_2feris_2dproto_2eproto;
+};
+// -------------------------------------------------------------------
+
+class TxnInfoRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:dsnet.transaction.eris.proto.TxnInfoRequest) */ {
+ public:
+  inline TxnInfoRequest() : TxnInfoRequest(nullptr) {}
+  ~TxnInfoRequest() override;
+  explicit PROTOBUF_CONSTEXPR TxnInfoRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  TxnInfoRequest(const TxnInfoRequest& from);
+  TxnInfoRequest(TxnInfoRequest&& from) noexcept
+    : TxnInfoRequest() {
+    *this = ::std::move(from);
+  }
+
+  inline TxnInfoRequest& operator=(const TxnInfoRequest& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline TxnInfoRequest& operator=(TxnInfoRequest&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const TxnInfoRequest& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const TxnInfoRequest* internal_default_instance() {
+    return reinterpret_cast<const TxnInfoRequest*>(
+               &_TxnInfoRequest_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    18;
+
+  friend void swap(TxnInfoRequest& a, TxnInfoRequest& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(TxnInfoRequest* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(TxnInfoRequest* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  TxnInfoRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<TxnInfoRequest>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const TxnInfoRequest& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const TxnInfoRequest& from) {
+    TxnInfoRequest::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(TxnInfoRequest* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "dsnet.transaction.eris.proto.TxnInfoRequest";
+  }
+  protected:
+  explicit TxnInfoRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kTxnNumFieldNumber = 1,
+  };
+  // required .dsnet.transaction.eris.proto.Stamp txn_num = 1;
+  bool has_txn_num() const;
+  private:
+  bool _internal_has_txn_num() const;
+  public:
+  void clear_txn_num();
+  const ::dsnet::transaction::eris::proto::Stamp& txn_num() const;
+  PROTOBUF_NODISCARD ::dsnet::transaction::eris::proto::Stamp* release_txn_num();
+  ::dsnet::transaction::eris::proto::Stamp* mutable_txn_num();
+  void set_allocated_txn_num(::dsnet::transaction::eris::proto::Stamp* txn_num);
+  private:
+  const ::dsnet::transaction::eris::proto::Stamp& _internal_txn_num() const;
+  ::dsnet::transaction::eris::proto::Stamp* _internal_mutable_txn_num();
+  public:
+  void unsafe_arena_set_allocated_txn_num(
+      ::dsnet::transaction::eris::proto::Stamp* txn_num);
+  ::dsnet::transaction::eris::proto::Stamp* unsafe_arena_release_txn_num();
+
+  // @@protoc_insertion_point(class_scope:dsnet.transaction.eris.proto.TxnInfoRequest)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::dsnet::transaction::eris::proto::Stamp* txn_num_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_transaction_2feris_2feris_2dproto_2eproto;
+};
+// -------------------------------------------------------------------
+
+class TxnReceived final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:dsnet.transaction.eris.proto.TxnReceived) */ {
+ public:
+  inline TxnReceived() : TxnReceived(nullptr) {}
+  ~TxnReceived() override;
+  explicit PROTOBUF_CONSTEXPR TxnReceived(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  TxnReceived(const TxnReceived& from);
+  TxnReceived(TxnReceived&& from) noexcept
+    : TxnReceived() {
+    *this = ::std::move(from);
+  }
+
+  inline TxnReceived& operator=(const TxnReceived& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline TxnReceived& operator=(TxnReceived&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const TxnReceived& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const TxnReceived* internal_default_instance() {
+    return reinterpret_cast<const TxnReceived*>(
+               &_TxnReceived_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    19;
+
+  friend void swap(TxnReceived& a, TxnReceived& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(TxnReceived* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(TxnReceived* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  TxnReceived* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<TxnReceived>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const TxnReceived& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const TxnReceived& from) {
+    TxnReceived::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(TxnReceived* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "dsnet.transaction.eris.proto.TxnReceived";
+  }
+  protected:
+  explicit TxnReceived(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kTxnFieldNumber = 1,
+  };
+  // required .dsnet.transaction.eris.proto.RequestMessage txn = 1;
+  bool has_txn() const;
+  private:
+  bool _internal_has_txn() const;
+  public:
+  void clear_txn();
+  const ::dsnet::transaction::eris::proto::RequestMessage& txn() const;
+  PROTOBUF_NODISCARD ::dsnet::transaction::eris::proto::RequestMessage* release_txn();
+  ::dsnet::transaction::eris::proto::RequestMessage* mutable_txn();
+  void set_allocated_txn(::dsnet::transaction::eris::proto::RequestMessage* txn);
+  private:
+  const ::dsnet::transaction::eris::proto::RequestMessage& _internal_txn() const;
+  ::dsnet::transaction::eris::proto::RequestMessage* _internal_mutable_txn();
+  public:
+  void unsafe_arena_set_allocated_txn(
+      ::dsnet::transaction::eris::proto::RequestMessage* txn);
+  ::dsnet::transaction::eris::proto::RequestMessage* unsafe_arena_release_txn();
+
+  // @@protoc_insertion_point(class_scope:dsnet.transaction.eris.proto.TxnReceived)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::dsnet::transaction::eris::proto::RequestMessage* txn_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_transaction_2feris_2feris_2dproto_2eproto;
+};
+// -------------------------------------------------------------------
+
+class TxnTempDropped final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:dsnet.transaction.eris.proto.TxnTempDropped) */ {
+ public:
+  inline TxnTempDropped() : TxnTempDropped(nullptr) {}
+  ~TxnTempDropped() override;
+  explicit PROTOBUF_CONSTEXPR TxnTempDropped(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  TxnTempDropped(const TxnTempDropped& from);
+  TxnTempDropped(TxnTempDropped&& from) noexcept
+    : TxnTempDropped() {
+    *this = ::std::move(from);
+  }
+
+  inline TxnTempDropped& operator=(const TxnTempDropped& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline TxnTempDropped& operator=(TxnTempDropped&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const TxnTempDropped& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const TxnTempDropped* internal_default_instance() {
+    return reinterpret_cast<const TxnTempDropped*>(
+               &_TxnTempDropped_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    20;
+
+  friend void swap(TxnTempDropped& a, TxnTempDropped& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(TxnTempDropped* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(TxnTempDropped* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  TxnTempDropped* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<TxnTempDropped>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const TxnTempDropped& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const TxnTempDropped& from) {
+    TxnTempDropped::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(TxnTempDropped* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "dsnet.transaction.eris.proto.TxnTempDropped";
+  }
+  protected:
+  explicit TxnTempDropped(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kTxnNumFieldNumber = 1,
+  };
+  // required .dsnet.transaction.eris.proto.Stamp txn_num = 1;
+  bool has_txn_num() const;
+  private:
+  bool _internal_has_txn_num() const;
+  public:
+  void clear_txn_num();
+  const ::dsnet::transaction::eris::proto::Stamp& txn_num() const;
+  PROTOBUF_NODISCARD ::dsnet::transaction::eris::proto::Stamp* release_txn_num();
+  ::dsnet::transaction::eris::proto::Stamp* mutable_txn_num();
+  void set_allocated_txn_num(::dsnet::transaction::eris::proto::Stamp* txn_num);
+  private:
+  const ::dsnet::transaction::eris::proto::Stamp& _internal_txn_num() const;
+  ::dsnet::transaction::eris::proto::Stamp* _internal_mutable_txn_num();
+  public:
+  void unsafe_arena_set_allocated_txn_num(
+      ::dsnet::transaction::eris::proto::Stamp* txn_num);
+  ::dsnet::transaction::eris::proto::Stamp* unsafe_arena_release_txn_num();
+
+  // @@protoc_insertion_point(class_scope:dsnet.transaction.eris.proto.TxnTempDropped)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::dsnet::transaction::eris::proto::Stamp* txn_num_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_transaction_2feris_2feris_2dproto_2eproto;
+};
+// -------------------------------------------------------------------
+
+class EpochChangeReq final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:dsnet.transaction.eris.proto.EpochChangeReq) */ {
+ public:
+  inline EpochChangeReq() : EpochChangeReq(nullptr) {}
+  ~EpochChangeReq() override;
+  explicit PROTOBUF_CONSTEXPR EpochChangeReq(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  EpochChangeReq(const EpochChangeReq& from);
+  EpochChangeReq(EpochChangeReq&& from) noexcept
+    : EpochChangeReq() {
+    *this = ::std::move(from);
+  }
+
+  inline EpochChangeReq& operator=(const EpochChangeReq& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline EpochChangeReq& operator=(EpochChangeReq&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const EpochChangeReq& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const EpochChangeReq* internal_default_instance() {
+    return reinterpret_cast<const EpochChangeReq*>(
+               &_EpochChangeReq_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    21;
+
+  friend void swap(EpochChangeReq& a, EpochChangeReq& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(EpochChangeReq* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(EpochChangeReq* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  EpochChangeReq* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<EpochChangeReq>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const EpochChangeReq& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const EpochChangeReq& from) {
+    EpochChangeReq::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(EpochChangeReq* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "dsnet.transaction.eris.proto.EpochChangeReq";
+  }
+  protected:
+  explicit EpochChangeReq(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kNewEpochNumFieldNumber = 1,
+  };
+  // required uint32 new_epoch_num = 1;
+  bool has_new_epoch_num() const;
+  private:
+  bool _internal_has_new_epoch_num() const;
+  public:
+  void clear_new_epoch_num();
+  uint32_t new_epoch_num() const;
+  void set_new_epoch_num(uint32_t value);
+  private:
+  uint32_t _internal_new_epoch_num() const;
+  void _internal_set_new_epoch_num(uint32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:dsnet.transaction.eris.proto.EpochChangeReq)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    uint32_t new_epoch_num_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_transaction_2feris_2feris_2dproto_2eproto;
+};
+// -------------------------------------------------------------------
+
+class EpochChangeAck_LogInfoPiece final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:dsnet.transaction.eris.proto.EpochChangeAck.LogInfoPiece) */ {
+ public:
+  inline EpochChangeAck_LogInfoPiece() : EpochChangeAck_LogInfoPiece(nullptr) {}
+  ~EpochChangeAck_LogInfoPiece() override;
+  explicit PROTOBUF_CONSTEXPR EpochChangeAck_LogInfoPiece(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  EpochChangeAck_LogInfoPiece(const EpochChangeAck_LogInfoPiece& from);
+  EpochChangeAck_LogInfoPiece(EpochChangeAck_LogInfoPiece&& from) noexcept
+    : EpochChangeAck_LogInfoPiece() {
+    *this = ::std::move(from);
+  }
+
+  inline EpochChangeAck_LogInfoPiece& operator=(const EpochChangeAck_LogInfoPiece& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline EpochChangeAck_LogInfoPiece& operator=(EpochChangeAck_LogInfoPiece&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const EpochChangeAck_LogInfoPiece& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const EpochChangeAck_LogInfoPiece* internal_default_instance() {
+    return reinterpret_cast<const EpochChangeAck_LogInfoPiece*>(
+               &_EpochChangeAck_LogInfoPiece_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    22;
+
+  friend void swap(EpochChangeAck_LogInfoPiece& a, EpochChangeAck_LogInfoPiece& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(EpochChangeAck_LogInfoPiece* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(EpochChangeAck_LogInfoPiece* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  EpochChangeAck_LogInfoPiece* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<EpochChangeAck_LogInfoPiece>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const EpochChangeAck_LogInfoPiece& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const EpochChangeAck_LogInfoPiece& from) {
+    EpochChangeAck_LogInfoPiece::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(EpochChangeAck_LogInfoPiece* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "dsnet.transaction.eris.proto.EpochChangeAck.LogInfoPiece";
+  }
+  protected:
+  explicit EpochChangeAck_LogInfoPiece(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kLatestMsgNumFieldNumber = 2,
+    kShardNumFieldNumber = 1,
+  };
+  // required uint64 latest_msg_num = 2;
+  bool has_latest_msg_num() const;
+  private:
+  bool _internal_has_latest_msg_num() const;
+  public:
+  void clear_latest_msg_num();
+  uint64_t latest_msg_num() const;
+  void set_latest_msg_num(uint64_t value);
+  private:
+  uint64_t _internal_latest_msg_num() const;
+  void _internal_set_latest_msg_num(uint64_t value);
+  public:
+
+  // required uint32 shard_num = 1;
+  bool has_shard_num() const;
+  private:
+  bool _internal_has_shard_num() const;
+  public:
+  void clear_shard_num();
+  uint32_t shard_num() const;
+  void set_shard_num(uint32_t value);
+  private:
+  uint32_t _internal_shard_num() const;
+  void _internal_set_shard_num(uint32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:dsnet.transaction.eris.proto.EpochChangeAck.LogInfoPiece)
+ private:
+  class _Internal;
+
+  // helper for ByteSizeLong()
+  size_t RequiredFieldsByteSizeFallback() const;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    uint64_t latest_msg_num_;
+    uint32_t shard_num_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_transaction_2feris_2feris_2dproto_2eproto;
+};
+// -------------------------------------------------------------------
+
+class EpochChangeAck final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:dsnet.transaction.eris.proto.EpochChangeAck) */ {
+ public:
+  inline EpochChangeAck() : EpochChangeAck(nullptr) {}
+  ~EpochChangeAck() override;
+  explicit PROTOBUF_CONSTEXPR EpochChangeAck(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  EpochChangeAck(const EpochChangeAck& from);
+  EpochChangeAck(EpochChangeAck&& from) noexcept
+    : EpochChangeAck() {
+    *this = ::std::move(from);
+  }
+
+  inline EpochChangeAck& operator=(const EpochChangeAck& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline EpochChangeAck& operator=(EpochChangeAck&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const EpochChangeAck& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const EpochChangeAck* internal_default_instance() {
+    return reinterpret_cast<const EpochChangeAck*>(
+               &_EpochChangeAck_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    23;
+
+  friend void swap(EpochChangeAck& a, EpochChangeAck& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(EpochChangeAck* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(EpochChangeAck* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  EpochChangeAck* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<EpochChangeAck>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const EpochChangeAck& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const EpochChangeAck& from) {
+    EpochChangeAck::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(EpochChangeAck* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "dsnet.transaction.eris.proto.EpochChangeAck";
+  }
+  protected:
+  explicit EpochChangeAck(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  typedef EpochChangeAck_LogInfoPiece LogInfoPiece;
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kLogInfoFieldNumber = 3,
+    kOpNumFieldNumber = 2,
+    kLastNormalEpochFieldNumber = 1,
+  };
+  // repeated .dsnet.transaction.eris.proto.EpochChangeAck.LogInfoPiece log_info = 3;
+  int log_info_size() const;
+  private:
+  int _internal_log_info_size() const;
+  public:
+  void clear_log_info();
+  ::dsnet::transaction::eris::proto::EpochChangeAck_LogInfoPiece* mutable_log_info(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::dsnet::transaction::eris::proto::EpochChangeAck_LogInfoPiece >*
+      mutable_log_info();
+  private:
+  const ::dsnet::transaction::eris::proto::EpochChangeAck_LogInfoPiece& _internal_log_info(int index) const;
+  ::dsnet::transaction::eris::proto::EpochChangeAck_LogInfoPiece* _internal_add_log_info();
+  public:
+  const ::dsnet::transaction::eris::proto::EpochChangeAck_LogInfoPiece& log_info(int index) const;
+  ::dsnet::transaction::eris::proto::EpochChangeAck_LogInfoPiece* add_log_info();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::dsnet::transaction::eris::proto::EpochChangeAck_LogInfoPiece >&
+      log_info() const;
+
+  // required uint64 op_num = 2;
+  bool has_op_num() const;
+  private:
+  bool _internal_has_op_num() const;
+  public:
+  void clear_op_num();
+  uint64_t op_num() const;
+  void set_op_num(uint64_t value);
+  private:
+  uint64_t _internal_op_num() const;
+  void _internal_set_op_num(uint64_t value);
+  public:
+
+  // required uint32 last_normal_epoch = 1;
+  bool has_last_normal_epoch() const;
+  private:
+  bool _internal_has_last_normal_epoch() const;
+  public:
+  void clear_last_normal_epoch();
+  uint32_t last_normal_epoch() const;
+  void set_last_normal_epoch(uint32_t value);
+  private:
+  uint32_t _internal_last_normal_epoch() const;
+  void _internal_set_last_normal_epoch(uint32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:dsnet.transaction.eris.proto.EpochChangeAck)
+ private:
+  class _Internal;
+
+  // helper for ByteSizeLong()
+  size_t RequiredFieldsByteSizeFallback() const;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::dsnet::transaction::eris::proto::EpochChangeAck_LogInfoPiece > log_info_;
+    uint64_t op_num_;
+    uint32_t last_normal_epoch_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_transaction_2feris_2feris_2dproto_2eproto;
+};
+// -------------------------------------------------------------------
+
+class EpochChangeStateTransferAck final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:dsnet.transaction.eris.proto.EpochChangeStateTransferAck) */ {
+ public:
+  inline EpochChangeStateTransferAck() : EpochChangeStateTransferAck(nullptr) {}
+  ~EpochChangeStateTransferAck() override;
+  explicit PROTOBUF_CONSTEXPR EpochChangeStateTransferAck(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  EpochChangeStateTransferAck(const EpochChangeStateTransferAck& from);
+  EpochChangeStateTransferAck(EpochChangeStateTransferAck&& from) noexcept
+    : EpochChangeStateTransferAck() {
+    *this = ::std::move(from);
+  }
+
+  inline EpochChangeStateTransferAck& operator=(const EpochChangeStateTransferAck& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline EpochChangeStateTransferAck& operator=(EpochChangeStateTransferAck&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const EpochChangeStateTransferAck& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const EpochChangeStateTransferAck* internal_default_instance() {
+    return reinterpret_cast<const EpochChangeStateTransferAck*>(
+               &_EpochChangeStateTransferAck_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    24;
+
+  friend void swap(EpochChangeStateTransferAck& a, EpochChangeStateTransferAck& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(EpochChangeStateTransferAck* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(EpochChangeStateTransferAck* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  EpochChangeStateTransferAck* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<EpochChangeStateTransferAck>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const EpochChangeStateTransferAck& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const EpochChangeStateTransferAck& from) {
+    EpochChangeStateTransferAck::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(EpochChangeStateTransferAck* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "dsnet.transaction.eris.proto.EpochChangeStateTransferAck";
+  }
+  protected:
+  explicit EpochChangeStateTransferAck(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kDropsFieldNumber = 2,
+    kOpNumFieldNumber = 1,
+  };
+  // repeated .dsnet.transaction.eris.proto.Stamp drops = 2;
+  int drops_size() const;
+  private:
+  int _internal_drops_size() const;
+  public:
+  void clear_drops();
+  ::dsnet::transaction::eris::proto::Stamp* mutable_drops(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::dsnet::transaction::eris::proto::Stamp >*
+      mutable_drops();
+  private:
+  const ::dsnet::transaction::eris::proto::Stamp& _internal_drops(int index) const;
+  ::dsnet::transaction::eris::proto::Stamp* _internal_add_drops();
+  public:
+  const ::dsnet::transaction::eris::proto::Stamp& drops(int index) const;
+  ::dsnet::transaction::eris::proto::Stamp* add_drops();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::dsnet::transaction::eris::proto::Stamp >&
+      drops() const;
+
+  // required uint64 op_num = 1;
+  bool has_op_num() const;
+  private:
+  bool _internal_has_op_num() const;
+  public:
+  void clear_op_num();
+  uint64_t op_num() const;
+  void set_op_num(uint64_t value);
+  private:
+  uint64_t _internal_op_num() const;
+  void _internal_set_op_num(uint64_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:dsnet.transaction.eris.proto.EpochChangeStateTransferAck)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::dsnet::transaction::eris::proto::Stamp > drops_;
+    uint64_t op_num_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_transaction_2feris_2feris_2dproto_2eproto;
+};
+// -------------------------------------------------------------------
+
+class ErisToFCMessage final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:dsnet.transaction.eris.proto.ErisToFCMessage) */ {
+ public:
+  inline ErisToFCMessage() : ErisToFCMessage(nullptr) {}
+  ~ErisToFCMessage() override;
+  explicit PROTOBUF_CONSTEXPR ErisToFCMessage(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  ErisToFCMessage(const ErisToFCMessage& from);
+  ErisToFCMessage(ErisToFCMessage&& from) noexcept
+    : ErisToFCMessage() {
+    *this = ::std::move(from);
+  }
+
+  inline ErisToFCMessage& operator=(const ErisToFCMessage& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline ErisToFCMessage& operator=(ErisToFCMessage&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ErisToFCMessage& default_instance() {
+    return *internal_default_instance();
+  }
+  enum MsgCase {
+    kTxnInfoReq = 4,
+    kTxnReceived = 5,
+    kTxnTempDrop = 6,
+    kEpochChangeReq = 7,
+    kEpochChangeAck = 8,
+    kEpochChangeStateTransferAck = 9,
+    MSG_NOT_SET = 0,
+  };
+
+  static inline const ErisToFCMessage* internal_default_instance() {
+    return reinterpret_cast<const ErisToFCMessage*>(
+               &_ErisToFCMessage_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    25;
+
+  friend void swap(ErisToFCMessage& a, ErisToFCMessage& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(ErisToFCMessage* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ErisToFCMessage* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  ErisToFCMessage* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ErisToFCMessage>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const ErisToFCMessage& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ErisToFCMessage& from) {
+    ErisToFCMessage::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(ErisToFCMessage* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "dsnet.transaction.eris.proto.ErisToFCMessage";
+  }
+  protected:
+  explicit ErisToFCMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kLocalViewNumFieldNumber = 3,
+    kShardNumFieldNumber = 1,
+    kReplicaNumFieldNumber = 2,
+    kTxnInfoReqFieldNumber = 4,
+    kTxnReceivedFieldNumber = 5,
+    kTxnTempDropFieldNumber = 6,
+    kEpochChangeReqFieldNumber = 7,
+    kEpochChangeAckFieldNumber = 8,
+    kEpochChangeStateTransferAckFieldNumber = 9,
+  };
+  // required .dsnet.transaction.eris.proto.ViewNum local_view_num = 3;
+  bool has_local_view_num() const;
+  private:
+  bool _internal_has_local_view_num() const;
+  public:
+  void clear_local_view_num();
+  const ::dsnet::transaction::eris::proto::ViewNum& local_view_num() const;
+  PROTOBUF_NODISCARD ::dsnet::transaction::eris::proto::ViewNum* release_local_view_num();
+  ::dsnet::transaction::eris::proto::ViewNum* mutable_local_view_num();
+  void set_allocated_local_view_num(::dsnet::transaction::eris::proto::ViewNum* local_view_num);
+  private:
+  const ::dsnet::transaction::eris::proto::ViewNum& _internal_local_view_num() const;
+  ::dsnet::transaction::eris::proto::ViewNum* _internal_mutable_local_view_num();
+  public:
+  void unsafe_arena_set_allocated_local_view_num(
+      ::dsnet::transaction::eris::proto::ViewNum* local_view_num);
+  ::dsnet::transaction::eris::proto::ViewNum* unsafe_arena_release_local_view_num();
+
+  // required uint32 shard_num = 1;
+  bool has_shard_num() const;
+  private:
+  bool _internal_has_shard_num() const;
+  public:
+  void clear_shard_num();
+  uint32_t shard_num() const;
+  void set_shard_num(uint32_t value);
+  private:
+  uint32_t _internal_shard_num() const;
+  void _internal_set_shard_num(uint32_t value);
+  public:
+
+  // required uint32 replica_num = 2;
+  bool has_replica_num() const;
+  private:
+  bool _internal_has_replica_num() const;
+  public:
+  void clear_replica_num();
+  uint32_t replica_num() const;
+  void set_replica_num(uint32_t value);
+  private:
+  uint32_t _internal_replica_num() const;
+  void _internal_set_replica_num(uint32_t value);
+  public:
+
+  // .dsnet.transaction.eris.proto.TxnInfoRequest txn_info_req = 4;
+  bool has_txn_info_req() const;
+  private:
+  bool _internal_has_txn_info_req() const;
+  public:
+  void clear_txn_info_req();
+  const ::dsnet::transaction::eris::proto::TxnInfoRequest& txn_info_req() const;
+  PROTOBUF_NODISCARD ::dsnet::transaction::eris::proto::TxnInfoRequest* release_txn_info_req();
+  ::dsnet::transaction::eris::proto::TxnInfoRequest* mutable_txn_info_req();
+  void set_allocated_txn_info_req(::dsnet::transaction::eris::proto::TxnInfoRequest* txn_info_req);
+  private:
+  const ::dsnet::transaction::eris::proto::TxnInfoRequest& _internal_txn_info_req() const;
+  ::dsnet::transaction::eris::proto::TxnInfoRequest* _internal_mutable_txn_info_req();
+  public:
+  void unsafe_arena_set_allocated_txn_info_req(
+      ::dsnet::transaction::eris::proto::TxnInfoRequest* txn_info_req);
+  ::dsnet::transaction::eris::proto::TxnInfoRequest* unsafe_arena_release_txn_info_req();
+
+  // .dsnet.transaction.eris.proto.TxnReceived txn_received = 5;
+  bool has_txn_received() const;
+  private:
+  bool _internal_has_txn_received() const;
+  public:
+  void clear_txn_received();
+  const ::dsnet::transaction::eris::proto::TxnReceived& txn_received() const;
+  PROTOBUF_NODISCARD ::dsnet::transaction::eris::proto::TxnReceived* release_txn_received();
+  ::dsnet::transaction::eris::proto::TxnReceived* mutable_txn_received();
+  void set_allocated_txn_received(::dsnet::transaction::eris::proto::TxnReceived* txn_received);
+  private:
+  const ::dsnet::transaction::eris::proto::TxnReceived& _internal_txn_received() const;
+  ::dsnet::transaction::eris::proto::TxnReceived* _internal_mutable_txn_received();
+  public:
+  void unsafe_arena_set_allocated_txn_received(
+      ::dsnet::transaction::eris::proto::TxnReceived* txn_received);
+  ::dsnet::transaction::eris::proto::TxnReceived* unsafe_arena_release_txn_received();
+
+  // .dsnet.transaction.eris.proto.TxnTempDropped txn_temp_drop = 6;
+  bool has_txn_temp_drop() const;
+  private:
+  bool _internal_has_txn_temp_drop() const;
+  public:
+  void clear_txn_temp_drop();
+  const ::dsnet::transaction::eris::proto::TxnTempDropped& txn_temp_drop() const;
+  PROTOBUF_NODISCARD ::dsnet::transaction::eris::proto::TxnTempDropped* release_txn_temp_drop();
+  ::dsnet::transaction::eris::proto::TxnTempDropped* mutable_txn_temp_drop();
+  void set_allocated_txn_temp_drop(::dsnet::transaction::eris::proto::TxnTempDropped* txn_temp_drop);
+  private:
+  const ::dsnet::transaction::eris::proto::TxnTempDropped& _internal_txn_temp_drop() const;
+  ::dsnet::transaction::eris::proto::TxnTempDropped* _internal_mutable_txn_temp_drop();
+  public:
+  void unsafe_arena_set_allocated_txn_temp_drop(
+      ::dsnet::transaction::eris::proto::TxnTempDropped* txn_temp_drop);
+  ::dsnet::transaction::eris::proto::TxnTempDropped* unsafe_arena_release_txn_temp_drop();
+
+  // .dsnet.transaction.eris.proto.EpochChangeReq epoch_change_req = 7;
+  bool has_epoch_change_req() const;
+  private:
+  bool _internal_has_epoch_change_req() const;
+  public:
+  void clear_epoch_change_req();
+  const ::dsnet::transaction::eris::proto::EpochChangeReq& epoch_change_req() const;
+  PROTOBUF_NODISCARD ::dsnet::transaction::eris::proto::EpochChangeReq* release_epoch_change_req();
+  ::dsnet::transaction::eris::proto::EpochChangeReq* mutable_epoch_change_req();
+  void set_allocated_epoch_change_req(::dsnet::transaction::eris::proto::EpochChangeReq* epoch_change_req);
+  private:
+  const ::dsnet::transaction::eris::proto::EpochChangeReq& _internal_epoch_change_req() const;
+  ::dsnet::transaction::eris::proto::EpochChangeReq* _internal_mutable_epoch_change_req();
+  public:
+  void unsafe_arena_set_allocated_epoch_change_req(
+      ::dsnet::transaction::eris::proto::EpochChangeReq* epoch_change_req);
+  ::dsnet::transaction::eris::proto::EpochChangeReq* unsafe_arena_release_epoch_change_req();
+
+  // .dsnet.transaction.eris.proto.EpochChangeAck epoch_change_ack = 8;
+  bool has_epoch_change_ack() const;
+  private:
+  bool _internal_has_epoch_change_ack() const;
+  public:
+  void clear_epoch_change_ack();
+  const ::dsnet::transaction::eris::proto::EpochChangeAck& epoch_change_ack() const;
+  PROTOBUF_NODISCARD ::dsnet::transaction::eris::proto::EpochChangeAck* release_epoch_change_ack();
+  ::dsnet::transaction::eris::proto::EpochChangeAck* mutable_epoch_change_ack();
+  void set_allocated_epoch_change_ack(::dsnet::transaction::eris::proto::EpochChangeAck* epoch_change_ack);
+  private:
+  const ::dsnet::transaction::eris::proto::EpochChangeAck& _internal_epoch_change_ack() const;
+  ::dsnet::transaction::eris::proto::EpochChangeAck* _internal_mutable_epoch_change_ack();
+  public:
+  void unsafe_arena_set_allocated_epoch_change_ack(
+      ::dsnet::transaction::eris::proto::EpochChangeAck* epoch_change_ack);
+  ::dsnet::transaction::eris::proto::EpochChangeAck* unsafe_arena_release_epoch_change_ack();
+
+  // .dsnet.transaction.eris.proto.EpochChangeStateTransferAck epoch_change_state_transfer_ack = 9;
+  bool has_epoch_change_state_transfer_ack() const;
+  private:
+  bool _internal_has_epoch_change_state_transfer_ack() const;
+  public:
+  void clear_epoch_change_state_transfer_ack();
+  const ::dsnet::transaction::eris::proto::EpochChangeStateTransferAck& epoch_change_state_transfer_ack() const;
+  PROTOBUF_NODISCARD ::dsnet::transaction::eris::proto::EpochChangeStateTransferAck* release_epoch_change_state_transfer_ack();
+  ::dsnet::transaction::eris::proto::EpochChangeStateTransferAck* mutable_epoch_change_state_transfer_ack();
+  void set_allocated_epoch_change_state_transfer_ack(::dsnet::transaction::eris::proto::EpochChangeStateTransferAck* epoch_change_state_transfer_ack);
+  private:
+  const ::dsnet::transaction::eris::proto::EpochChangeStateTransferAck& _internal_epoch_change_state_transfer_ack() const;
+  ::dsnet::transaction::eris::proto::EpochChangeStateTransferAck* _internal_mutable_epoch_change_state_transfer_ack();
+  public:
+  void unsafe_arena_set_allocated_epoch_change_state_transfer_ack(
+      ::dsnet::transaction::eris::proto::EpochChangeStateTransferAck* epoch_change_state_transfer_ack);
+  ::dsnet::transaction::eris::proto::EpochChangeStateTransferAck* unsafe_arena_release_epoch_change_state_transfer_ack();
+
+  void clear_msg();
+  MsgCase msg_case() const;
+  // @@protoc_insertion_point(class_scope:dsnet.transaction.eris.proto.ErisToFCMessage)
+ private:
+  class _Internal;
+  void set_has_txn_info_req();
+  void set_has_txn_received();
+  void set_has_txn_temp_drop();
+  void set_has_epoch_change_req();
+  void set_has_epoch_change_ack();
+  void set_has_epoch_change_state_transfer_ack();
+
+  inline bool has_msg() const;
+  inline void clear_has_msg();
+
+  // helper for ByteSizeLong()
+  size_t RequiredFieldsByteSizeFallback() const;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::dsnet::transaction::eris::proto::ViewNum* local_view_num_;
+    uint32_t shard_num_;
+    uint32_t replica_num_;
+    union MsgUnion {
+      constexpr MsgUnion() : _constinit_{} {}
+        ::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized _constinit_;
+      ::dsnet::transaction::eris::proto::TxnInfoRequest* txn_info_req_;
+      ::dsnet::transaction::eris::proto::TxnReceived* txn_received_;
+      ::dsnet::transaction::eris::proto::TxnTempDropped* txn_temp_drop_;
+      ::dsnet::transaction::eris::proto::EpochChangeReq* epoch_change_req_;
+      ::dsnet::transaction::eris::proto::EpochChangeAck* epoch_change_ack_;
+      ::dsnet::transaction::eris::proto::EpochChangeStateTransferAck* epoch_change_state_transfer_ack_;
+    } msg_;
+    uint32_t _oneof_case_[1];
+
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_transaction_2feris_2feris_2dproto_2eproto;
+};
+// -------------------------------------------------------------------
+
+class TxnCheck final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:dsnet.transaction.eris.proto.TxnCheck) */ {
+ public:
+  inline TxnCheck() : TxnCheck(nullptr) {}
+  ~TxnCheck() override;
+  explicit PROTOBUF_CONSTEXPR TxnCheck(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  TxnCheck(const TxnCheck& from);
+  TxnCheck(TxnCheck&& from) noexcept
+    : TxnCheck() {
+    *this = ::std::move(from);
+  }
+
+  inline TxnCheck& operator=(const TxnCheck& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline TxnCheck& operator=(TxnCheck&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const TxnCheck& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const TxnCheck* internal_default_instance() {
+    return reinterpret_cast<const TxnCheck*>(
+               &_TxnCheck_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    26;
+
+  friend void swap(TxnCheck& a, TxnCheck& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(TxnCheck* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(TxnCheck* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  TxnCheck* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<TxnCheck>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const TxnCheck& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const TxnCheck& from) {
+    TxnCheck::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(TxnCheck* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "dsnet.transaction.eris.proto.TxnCheck";
+  }
+  protected:
+  explicit TxnCheck(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kTxnNumFieldNumber = 1,
+  };
+  // required .dsnet.transaction.eris.proto.Stamp txn_num = 1;
+  bool has_txn_num() const;
+  private:
+  bool _internal_has_txn_num() const;
+  public:
+  void clear_txn_num();
+  const ::dsnet::transaction::eris::proto::Stamp& txn_num() const;
+  PROTOBUF_NODISCARD ::dsnet::transaction::eris::proto::Stamp* release_txn_num();
+  ::dsnet::transaction::eris::proto::Stamp* mutable_txn_num();
+  void set_allocated_txn_num(::dsnet::transaction::eris::proto::Stamp* txn_num);
+  private:
+  const ::dsnet::transaction::eris::proto::Stamp& _internal_txn_num() const;
+  ::dsnet::transaction::eris::proto::Stamp* _internal_mutable_txn_num();
+  public:
+  void unsafe_arena_set_allocated_txn_num(
+      ::dsnet::transaction::eris::proto::Stamp* txn_num);
+  ::dsnet::transaction::eris::proto::Stamp* unsafe_arena_release_txn_num();
+
+  // @@protoc_insertion_point(class_scope:dsnet.transaction.eris.proto.TxnCheck)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::dsnet::transaction::eris::proto::Stamp* txn_num_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_transaction_2feris_2feris_2dproto_2eproto;
+};
+// -------------------------------------------------------------------
+
+class TxnFound final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:dsnet.transaction.eris.proto.TxnFound) */ {
+ public:
+  inline TxnFound() : TxnFound(nullptr) {}
+  ~TxnFound() override;
+  explicit PROTOBUF_CONSTEXPR TxnFound(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  TxnFound(const TxnFound& from);
+  TxnFound(TxnFound&& from) noexcept
+    : TxnFound() {
+    *this = ::std::move(from);
+  }
+
+  inline TxnFound& operator=(const TxnFound& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline TxnFound& operator=(TxnFound&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const TxnFound& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const TxnFound* internal_default_instance() {
+    return reinterpret_cast<const TxnFound*>(
+               &_TxnFound_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    27;
+
+  friend void swap(TxnFound& a, TxnFound& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(TxnFound* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(TxnFound* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  TxnFound* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<TxnFound>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const TxnFound& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const TxnFound& from) {
+    TxnFound::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(TxnFound* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "dsnet.transaction.eris.proto.TxnFound";
+  }
+  protected:
+  explicit TxnFound(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kTxnFieldNumber = 1,
+  };
+  // required .dsnet.transaction.eris.proto.RequestMessage txn = 1;
+  bool has_txn() const;
+  private:
+  bool _internal_has_txn() const;
+  public:
+  void clear_txn();
+  const ::dsnet::transaction::eris::proto::RequestMessage& txn() const;
+  PROTOBUF_NODISCARD ::dsnet::transaction::eris::proto::RequestMessage* release_txn();
+  ::dsnet::transaction::eris::proto::RequestMessage* mutable_txn();
+  void set_allocated_txn(::dsnet::transaction::eris::proto::RequestMessage* txn);
+  private:
+  const ::dsnet::transaction::eris::proto::RequestMessage& _internal_txn() const;
+  ::dsnet::transaction::eris::proto::RequestMessage* _internal_mutable_txn();
+  public:
+  void unsafe_arena_set_allocated_txn(
+      ::dsnet::transaction::eris::proto::RequestMessage* txn);
+  ::dsnet::transaction::eris::proto::RequestMessage* unsafe_arena_release_txn();
+
+  // @@protoc_insertion_point(class_scope:dsnet.transaction.eris.proto.TxnFound)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::dsnet::transaction::eris::proto::RequestMessage* txn_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_transaction_2feris_2feris_2dproto_2eproto;
+};
+// -------------------------------------------------------------------
+
+class DropTxn final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:dsnet.transaction.eris.proto.DropTxn) */ {
+ public:
+  inline DropTxn() : DropTxn(nullptr) {}
+  ~DropTxn() override;
+  explicit PROTOBUF_CONSTEXPR DropTxn(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  DropTxn(const DropTxn& from);
+  DropTxn(DropTxn&& from) noexcept
+    : DropTxn() {
+    *this = ::std::move(from);
+  }
+
+  inline DropTxn& operator=(const DropTxn& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline DropTxn& operator=(DropTxn&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const DropTxn& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const DropTxn* internal_default_instance() {
+    return reinterpret_cast<const DropTxn*>(
+               &_DropTxn_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    28;
+
+  friend void swap(DropTxn& a, DropTxn& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(DropTxn* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(DropTxn* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  DropTxn* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<DropTxn>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const DropTxn& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const DropTxn& from) {
+    DropTxn::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(DropTxn* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "dsnet.transaction.eris.proto.DropTxn";
+  }
+  protected:
+  explicit DropTxn(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kTxnNumFieldNumber = 1,
+  };
+  // required .dsnet.transaction.eris.proto.Stamp txn_num = 1;
+  bool has_txn_num() const;
+  private:
+  bool _internal_has_txn_num() const;
+  public:
+  void clear_txn_num();
+  const ::dsnet::transaction::eris::proto::Stamp& txn_num() const;
+  PROTOBUF_NODISCARD ::dsnet::transaction::eris::proto::Stamp* release_txn_num();
+  ::dsnet::transaction::eris::proto::Stamp* mutable_txn_num();
+  void set_allocated_txn_num(::dsnet::transaction::eris::proto::Stamp* txn_num);
+  private:
+  const ::dsnet::transaction::eris::proto::Stamp& _internal_txn_num() const;
+  ::dsnet::transaction::eris::proto::Stamp* _internal_mutable_txn_num();
+  public:
+  void unsafe_arena_set_allocated_txn_num(
+      ::dsnet::transaction::eris::proto::Stamp* txn_num);
+  ::dsnet::transaction::eris::proto::Stamp* unsafe_arena_release_txn_num();
+
+  // @@protoc_insertion_point(class_scope:dsnet.transaction.eris.proto.DropTxn)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::dsnet::transaction::eris::proto::Stamp* txn_num_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_transaction_2feris_2feris_2dproto_2eproto;
+};
+// -------------------------------------------------------------------
+
+class EpochChange final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:dsnet.transaction.eris.proto.EpochChange) */ {
+ public:
+  inline EpochChange() : EpochChange(nullptr) {}
+  ~EpochChange() override;
+  explicit PROTOBUF_CONSTEXPR EpochChange(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  EpochChange(const EpochChange& from);
+  EpochChange(EpochChange&& from) noexcept
+    : EpochChange() {
+    *this = ::std::move(from);
+  }
+
+  inline EpochChange& operator=(const EpochChange& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline EpochChange& operator=(EpochChange&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const EpochChange& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const EpochChange* internal_default_instance() {
+    return reinterpret_cast<const EpochChange*>(
+               &_EpochChange_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    29;
+
+  friend void swap(EpochChange& a, EpochChange& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(EpochChange* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(EpochChange* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  EpochChange* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<EpochChange>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const EpochChange& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const EpochChange& from) {
+    EpochChange::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(EpochChange* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "dsnet.transaction.eris.proto.EpochChange";
+  }
+  protected:
+  explicit EpochChange(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kNewEpochNumFieldNumber = 1,
+  };
+  // required uint32 new_epoch_num = 1;
+  bool has_new_epoch_num() const;
+  private:
+  bool _internal_has_new_epoch_num() const;
+  public:
+  void clear_new_epoch_num();
+  uint32_t new_epoch_num() const;
+  void set_new_epoch_num(uint32_t value);
+  private:
+  uint32_t _internal_new_epoch_num() const;
+  void _internal_set_new_epoch_num(uint32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:dsnet.transaction.eris.proto.EpochChange)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    uint32_t new_epoch_num_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_transaction_2feris_2feris_2dproto_2eproto;
+};
+// -------------------------------------------------------------------
+
+class EpochChangeStateTransfer_MsgEntry final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:dsnet.transaction.eris.proto.EpochChangeStateTransfer.MsgEntry) */ {
+ public:
+  inline EpochChangeStateTransfer_MsgEntry() : EpochChangeStateTransfer_MsgEntry(nullptr) {}
+  ~EpochChangeStateTransfer_MsgEntry() override;
+  explicit PROTOBUF_CONSTEXPR EpochChangeStateTransfer_MsgEntry(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  EpochChangeStateTransfer_MsgEntry(const EpochChangeStateTransfer_MsgEntry& from);
+  EpochChangeStateTransfer_MsgEntry(EpochChangeStateTransfer_MsgEntry&& from) noexcept
+    : EpochChangeStateTransfer_MsgEntry() {
+    *this = ::std::move(from);
+  }
+
+  inline EpochChangeStateTransfer_MsgEntry& operator=(const EpochChangeStateTransfer_MsgEntry& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline EpochChangeStateTransfer_MsgEntry& operator=(EpochChangeStateTransfer_MsgEntry&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const EpochChangeStateTransfer_MsgEntry& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const EpochChangeStateTransfer_MsgEntry* internal_default_instance() {
+    return reinterpret_cast<const EpochChangeStateTransfer_MsgEntry*>(
+               &_EpochChangeStateTransfer_MsgEntry_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    30;
+
+  friend void swap(EpochChangeStateTransfer_MsgEntry& a, EpochChangeStateTransfer_MsgEntry& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(EpochChangeStateTransfer_MsgEntry* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(EpochChangeStateTransfer_MsgEntry* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  EpochChangeStateTransfer_MsgEntry* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<EpochChangeStateTransfer_MsgEntry>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const EpochChangeStateTransfer_MsgEntry& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const EpochChangeStateTransfer_MsgEntry& from) {
+    EpochChangeStateTransfer_MsgEntry::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(EpochChangeStateTransfer_MsgEntry* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "dsnet.transaction.eris.proto.EpochChangeStateTransfer.MsgEntry";
+  }
+  protected:
+  explicit EpochChangeStateTransfer_MsgEntry(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kShardNumFieldNumber = 1,
+    kReplicaNumFieldNumber = 2,
+    kMsgNumFieldNumber = 3,
+  };
+  // required uint32 shard_num = 1;
+  bool has_shard_num() const;
+  private:
+  bool _internal_has_shard_num() const;
+  public:
+  void clear_shard_num();
+  uint32_t shard_num() const;
+  void set_shard_num(uint32_t value);
+  private:
+  uint32_t _internal_shard_num() const;
+  void _internal_set_shard_num(uint32_t value);
+  public:
+
+  // required uint32 replica_num = 2;
+  bool has_replica_num() const;
+  private:
+  bool _internal_has_replica_num() const;
+  public:
+  void clear_replica_num();
+  uint32_t replica_num() const;
+  void set_replica_num(uint32_t value);
+  private:
+  uint32_t _internal_replica_num() const;
+  void _internal_set_replica_num(uint32_t value);
+  public:
+
+  // required uint64 msg_num = 3;
+  bool has_msg_num() const;
+  private:
+  bool _internal_has_msg_num() const;
+  public:
+  void clear_msg_num();
+  uint64_t msg_num() const;
+  void set_msg_num(uint64_t value);
+  private:
+  uint64_t _internal_msg_num() const;
+  void _internal_set_msg_num(uint64_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:dsnet.transaction.eris.proto.EpochChangeStateTransfer.MsgEntry)
+ private:
+  class _Internal;
+
+  // helper for ByteSizeLong()
+  size_t RequiredFieldsByteSizeFallback() const;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    uint32_t shard_num_;
+    uint32_t replica_num_;
+    uint64_t msg_num_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_transaction_2feris_2feris_2dproto_2eproto;
+};
+// -------------------------------------------------------------------
+
+class EpochChangeStateTransfer final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:dsnet.transaction.eris.proto.EpochChangeStateTransfer) */ {
+ public:
+  inline EpochChangeStateTransfer() : EpochChangeStateTransfer(nullptr) {}
+  ~EpochChangeStateTransfer() override;
+  explicit PROTOBUF_CONSTEXPR EpochChangeStateTransfer(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  EpochChangeStateTransfer(const EpochChangeStateTransfer& from);
+  EpochChangeStateTransfer(EpochChangeStateTransfer&& from) noexcept
+    : EpochChangeStateTransfer() {
+    *this = ::std::move(from);
+  }
+
+  inline EpochChangeStateTransfer& operator=(const EpochChangeStateTransfer& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline EpochChangeStateTransfer& operator=(EpochChangeStateTransfer&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const EpochChangeStateTransfer& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const EpochChangeStateTransfer* internal_default_instance() {
+    return reinterpret_cast<const EpochChangeStateTransfer*>(
+               &_EpochChangeStateTransfer_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    31;
+
+  friend void swap(EpochChangeStateTransfer& a, EpochChangeStateTransfer& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(EpochChangeStateTransfer* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(EpochChangeStateTransfer* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  EpochChangeStateTransfer* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<EpochChangeStateTransfer>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const EpochChangeStateTransfer& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const EpochChangeStateTransfer& from) {
+    EpochChangeStateTransfer::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(EpochChangeStateTransfer* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "dsnet.transaction.eris.proto.EpochChangeStateTransfer";
+  }
+  protected:
+  explicit EpochChangeStateTransfer(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  typedef EpochChangeStateTransfer_MsgEntry MsgEntry;
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kPermDropsFieldNumber = 3,
+    kLatestMsgsFieldNumber = 4,
+    kEpochNumFieldNumber = 1,
+    kStateTransferEpochNumFieldNumber = 2,
+  };
+  // repeated .dsnet.transaction.eris.proto.Stamp perm_drops = 3;
+  int perm_drops_size() const;
+  private:
+  int _internal_perm_drops_size() const;
+  public:
+  void clear_perm_drops();
+  ::dsnet::transaction::eris::proto::Stamp* mutable_perm_drops(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::dsnet::transaction::eris::proto::Stamp >*
+      mutable_perm_drops();
+  private:
+  const ::dsnet::transaction::eris::proto::Stamp& _internal_perm_drops(int index) const;
+  ::dsnet::transaction::eris::proto::Stamp* _internal_add_perm_drops();
+  public:
+  const ::dsnet::transaction::eris::proto::Stamp& perm_drops(int index) const;
+  ::dsnet::transaction::eris::proto::Stamp* add_perm_drops();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::dsnet::transaction::eris::proto::Stamp >&
+      perm_drops() const;
+
+  // repeated .dsnet.transaction.eris.proto.EpochChangeStateTransfer.MsgEntry latest_msgs = 4;
+  int latest_msgs_size() const;
+  private:
+  int _internal_latest_msgs_size() const;
+  public:
+  void clear_latest_msgs();
+  ::dsnet::transaction::eris::proto::EpochChangeStateTransfer_MsgEntry* mutable_latest_msgs(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::dsnet::transaction::eris::proto::EpochChangeStateTransfer_MsgEntry >*
+      mutable_latest_msgs();
+  private:
+  const ::dsnet::transaction::eris::proto::EpochChangeStateTransfer_MsgEntry& _internal_latest_msgs(int index) const;
+  ::dsnet::transaction::eris::proto::EpochChangeStateTransfer_MsgEntry* _internal_add_latest_msgs();
+  public:
+  const ::dsnet::transaction::eris::proto::EpochChangeStateTransfer_MsgEntry& latest_msgs(int index) const;
+  ::dsnet::transaction::eris::proto::EpochChangeStateTransfer_MsgEntry* add_latest_msgs();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::dsnet::transaction::eris::proto::EpochChangeStateTransfer_MsgEntry >&
+      latest_msgs() const;
+
+  // required uint32 epoch_num = 1;
+  bool has_epoch_num() const;
+  private:
+  bool _internal_has_epoch_num() const;
+  public:
+  void clear_epoch_num();
+  uint32_t epoch_num() const;
+  void set_epoch_num(uint32_t value);
+  private:
+  uint32_t _internal_epoch_num() const;
+  void _internal_set_epoch_num(uint32_t value);
+  public:
+
+  // required uint32 state_transfer_epoch_num = 2;
+  bool has_state_transfer_epoch_num() const;
+  private:
+  bool _internal_has_state_transfer_epoch_num() const;
+  public:
+  void clear_state_transfer_epoch_num();
+  uint32_t state_transfer_epoch_num() const;
+  void set_state_transfer_epoch_num(uint32_t value);
+  private:
+  uint32_t _internal_state_transfer_epoch_num() const;
+  void _internal_set_state_transfer_epoch_num(uint32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:dsnet.transaction.eris.proto.EpochChangeStateTransfer)
+ private:
+  class _Internal;
+
+  // helper for ByteSizeLong()
+  size_t RequiredFieldsByteSizeFallback() const;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::dsnet::transaction::eris::proto::Stamp > perm_drops_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::dsnet::transaction::eris::proto::EpochChangeStateTransfer_MsgEntry > latest_msgs_;
+    uint32_t epoch_num_;
+    uint32_t state_transfer_epoch_num_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_transaction_2feris_2feris_2dproto_2eproto;
+};
+// -------------------------------------------------------------------
+
+class StartEpoch final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:dsnet.transaction.eris.proto.StartEpoch) */ {
+ public:
+  inline StartEpoch() : StartEpoch(nullptr) {}
+  ~StartEpoch() override;
+  explicit PROTOBUF_CONSTEXPR StartEpoch(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  StartEpoch(const StartEpoch& from);
+  StartEpoch(StartEpoch&& from) noexcept
+    : StartEpoch() {
+    *this = ::std::move(from);
+  }
+
+  inline StartEpoch& operator=(const StartEpoch& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline StartEpoch& operator=(StartEpoch&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const StartEpoch& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const StartEpoch* internal_default_instance() {
+    return reinterpret_cast<const StartEpoch*>(
+               &_StartEpoch_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    32;
+
+  friend void swap(StartEpoch& a, StartEpoch& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(StartEpoch* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(StartEpoch* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  StartEpoch* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<StartEpoch>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const StartEpoch& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const StartEpoch& from) {
+    StartEpoch::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(StartEpoch* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "dsnet.transaction.eris.proto.StartEpoch";
+  }
+  protected:
+  explicit StartEpoch(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kPermDropsFieldNumber = 3,
+    kNewViewFieldNumber = 1,
+    kLastNormalEpochNumFieldNumber = 2,
+    kLatestOpNumFieldNumber = 5,
+    kLatestReplicaNumFieldNumber = 4,
+  };
+  // repeated .dsnet.transaction.eris.proto.Stamp perm_drops = 3;
+  int perm_drops_size() const;
+  private:
+  int _internal_perm_drops_size() const;
+  public:
+  void clear_perm_drops();
+  ::dsnet::transaction::eris::proto::Stamp* mutable_perm_drops(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::dsnet::transaction::eris::proto::Stamp >*
+      mutable_perm_drops();
+  private:
+  const ::dsnet::transaction::eris::proto::Stamp& _internal_perm_drops(int index) const;
+  ::dsnet::transaction::eris::proto::Stamp* _internal_add_perm_drops();
+  public:
+  const ::dsnet::transaction::eris::proto::Stamp& perm_drops(int index) const;
+  ::dsnet::transaction::eris::proto::Stamp* add_perm_drops();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::dsnet::transaction::eris::proto::Stamp >&
+      perm_drops() const;
+
+  // required .dsnet.transaction.eris.proto.ViewNum new_view = 1;
+  bool has_new_view() const;
+  private:
+  bool _internal_has_new_view() const;
+  public:
+  void clear_new_view();
+  const ::dsnet::transaction::eris::proto::ViewNum& new_view() const;
+  PROTOBUF_NODISCARD ::dsnet::transaction::eris::proto::ViewNum* release_new_view();
+  ::dsnet::transaction::eris::proto::ViewNum* mutable_new_view();
+  void set_allocated_new_view(::dsnet::transaction::eris::proto::ViewNum* new_view);
+  private:
+  const ::dsnet::transaction::eris::proto::ViewNum& _internal_new_view() const;
+  ::dsnet::transaction::eris::proto::ViewNum* _internal_mutable_new_view();
+  public:
+  void unsafe_arena_set_allocated_new_view(
+      ::dsnet::transaction::eris::proto::ViewNum* new_view);
+  ::dsnet::transaction::eris::proto::ViewNum* unsafe_arena_release_new_view();
+
+  // required uint64 last_normal_epoch_num = 2;
+  bool has_last_normal_epoch_num() const;
+  private:
+  bool _internal_has_last_normal_epoch_num() const;
+  public:
+  void clear_last_normal_epoch_num();
+  uint64_t last_normal_epoch_num() const;
+  void set_last_normal_epoch_num(uint64_t value);
+  private:
+  uint64_t _internal_last_normal_epoch_num() const;
+  void _internal_set_last_normal_epoch_num(uint64_t value);
+  public:
+
+  // required uint64 latest_op_num = 5;
+  bool has_latest_op_num() const;
+  private:
+  bool _internal_has_latest_op_num() const;
+  public:
+  void clear_latest_op_num();
+  uint64_t latest_op_num() const;
+  void set_latest_op_num(uint64_t value);
+  private:
+  uint64_t _internal_latest_op_num() const;
+  void _internal_set_latest_op_num(uint64_t value);
+  public:
+
+  // required uint32 latest_replica_num = 4;
+  bool has_latest_replica_num() const;
+  private:
+  bool _internal_has_latest_replica_num() const;
+  public:
+  void clear_latest_replica_num();
+  uint32_t latest_replica_num() const;
+  void set_latest_replica_num(uint32_t value);
+  private:
+  uint32_t _internal_latest_replica_num() const;
+  void _internal_set_latest_replica_num(uint32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:dsnet.transaction.eris.proto.StartEpoch)
+ private:
+  class _Internal;
+
+  // helper for ByteSizeLong()
+  size_t RequiredFieldsByteSizeFallback() const;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::dsnet::transaction::eris::proto::Stamp > perm_drops_;
+    ::dsnet::transaction::eris::proto::ViewNum* new_view_;
+    uint64_t last_normal_epoch_num_;
+    uint64_t latest_op_num_;
+    uint32_t latest_replica_num_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_transaction_2feris_2feris_2dproto_2eproto;
+};
+// -------------------------------------------------------------------
+
+class FCToErisMessage final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:dsnet.transaction.eris.proto.FCToErisMessage) */ {
+ public:
+  inline FCToErisMessage() : FCToErisMessage(nullptr) {}
+  ~FCToErisMessage() override;
+  explicit PROTOBUF_CONSTEXPR FCToErisMessage(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  FCToErisMessage(const FCToErisMessage& from);
+  FCToErisMessage(FCToErisMessage&& from) noexcept
+    : FCToErisMessage() {
+    *this = ::std::move(from);
+  }
+
+  inline FCToErisMessage& operator=(const FCToErisMessage& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline FCToErisMessage& operator=(FCToErisMessage&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const FCToErisMessage& default_instance() {
+    return *internal_default_instance();
+  }
+  enum MsgCase {
+    kTxnCheck = 1,
+    kTxnFound = 2,
+    kDropTxn = 3,
+    kEpochChange = 4,
+    kEpochChangeStateTransfer = 5,
+    kStartEpoch = 6,
+    MSG_NOT_SET = 0,
+  };
+
+  static inline const FCToErisMessage* internal_default_instance() {
+    return reinterpret_cast<const FCToErisMessage*>(
+               &_FCToErisMessage_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    33;
+
+  friend void swap(FCToErisMessage& a, FCToErisMessage& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(FCToErisMessage* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(FCToErisMessage* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  FCToErisMessage* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<FCToErisMessage>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const FCToErisMessage& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const FCToErisMessage& from) {
+    FCToErisMessage::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(FCToErisMessage* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "dsnet.transaction.eris.proto.FCToErisMessage";
+  }
+  protected:
+  explicit FCToErisMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kTxnCheckFieldNumber = 1,
+    kTxnFoundFieldNumber = 2,
+    kDropTxnFieldNumber = 3,
+    kEpochChangeFieldNumber = 4,
+    kEpochChangeStateTransferFieldNumber = 5,
+    kStartEpochFieldNumber = 6,
+  };
+  // .dsnet.transaction.eris.proto.TxnCheck txn_check = 1;
+  bool has_txn_check() const;
+  private:
+  bool _internal_has_txn_check() const;
+  public:
+  void clear_txn_check();
+  const ::dsnet::transaction::eris::proto::TxnCheck& txn_check() const;
+  PROTOBUF_NODISCARD ::dsnet::transaction::eris::proto::TxnCheck* release_txn_check();
+  ::dsnet::transaction::eris::proto::TxnCheck* mutable_txn_check();
+  void set_allocated_txn_check(::dsnet::transaction::eris::proto::TxnCheck* txn_check);
+  private:
+  const ::dsnet::transaction::eris::proto::TxnCheck& _internal_txn_check() const;
+  ::dsnet::transaction::eris::proto::TxnCheck* _internal_mutable_txn_check();
+  public:
+  void unsafe_arena_set_allocated_txn_check(
+      ::dsnet::transaction::eris::proto::TxnCheck* txn_check);
+  ::dsnet::transaction::eris::proto::TxnCheck* unsafe_arena_release_txn_check();
+
+  // .dsnet.transaction.eris.proto.TxnFound txn_found = 2;
+  bool has_txn_found() const;
+  private:
+  bool _internal_has_txn_found() const;
+  public:
+  void clear_txn_found();
+  const ::dsnet::transaction::eris::proto::TxnFound& txn_found() const;
+  PROTOBUF_NODISCARD ::dsnet::transaction::eris::proto::TxnFound* release_txn_found();
+  ::dsnet::transaction::eris::proto::TxnFound* mutable_txn_found();
+  void set_allocated_txn_found(::dsnet::transaction::eris::proto::TxnFound* txn_found);
+  private:
+  const ::dsnet::transaction::eris::proto::TxnFound& _internal_txn_found() const;
+  ::dsnet::transaction::eris::proto::TxnFound* _internal_mutable_txn_found();
+  public:
+  void unsafe_arena_set_allocated_txn_found(
+      ::dsnet::transaction::eris::proto::TxnFound* txn_found);
+  ::dsnet::transaction::eris::proto::TxnFound* unsafe_arena_release_txn_found();
+
+  // .dsnet.transaction.eris.proto.DropTxn drop_txn = 3;
+  bool has_drop_txn() const;
+  private:
+  bool _internal_has_drop_txn() const;
+  public:
+  void clear_drop_txn();
+  const ::dsnet::transaction::eris::proto::DropTxn& drop_txn() const;
+  PROTOBUF_NODISCARD ::dsnet::transaction::eris::proto::DropTxn* release_drop_txn();
+  ::dsnet::transaction::eris::proto::DropTxn* mutable_drop_txn();
+  void set_allocated_drop_txn(::dsnet::transaction::eris::proto::DropTxn* drop_txn);
+  private:
+  const ::dsnet::transaction::eris::proto::DropTxn& _internal_drop_txn() const;
+  ::dsnet::transaction::eris::proto::DropTxn* _internal_mutable_drop_txn();
+  public:
+  void unsafe_arena_set_allocated_drop_txn(
+      ::dsnet::transaction::eris::proto::DropTxn* drop_txn);
+  ::dsnet::transaction::eris::proto::DropTxn* unsafe_arena_release_drop_txn();
+
+  // .dsnet.transaction.eris.proto.EpochChange epoch_change = 4;
+  bool has_epoch_change() const;
+  private:
+  bool _internal_has_epoch_change() const;
+  public:
+  void clear_epoch_change();
+  const ::dsnet::transaction::eris::proto::EpochChange& epoch_change() const;
+  PROTOBUF_NODISCARD ::dsnet::transaction::eris::proto::EpochChange* release_epoch_change();
+  ::dsnet::transaction::eris::proto::EpochChange* mutable_epoch_change();
+  void set_allocated_epoch_change(::dsnet::transaction::eris::proto::EpochChange* epoch_change);
+  private:
+  const ::dsnet::transaction::eris::proto::EpochChange& _internal_epoch_change() const;
+  ::dsnet::transaction::eris::proto::EpochChange* _internal_mutable_epoch_change();
+  public:
+  void unsafe_arena_set_allocated_epoch_change(
+      ::dsnet::transaction::eris::proto::EpochChange* epoch_change);
+  ::dsnet::transaction::eris::proto::EpochChange* unsafe_arena_release_epoch_change();
+
+  // .dsnet.transaction.eris.proto.EpochChangeStateTransfer epoch_change_state_transfer = 5;
+  bool has_epoch_change_state_transfer() const;
+  private:
+  bool _internal_has_epoch_change_state_transfer() const;
+  public:
+  void clear_epoch_change_state_transfer();
+  const ::dsnet::transaction::eris::proto::EpochChangeStateTransfer& epoch_change_state_transfer() const;
+  PROTOBUF_NODISCARD ::dsnet::transaction::eris::proto::EpochChangeStateTransfer* release_epoch_change_state_transfer();
+  ::dsnet::transaction::eris::proto::EpochChangeStateTransfer* mutable_epoch_change_state_transfer();
+  void set_allocated_epoch_change_state_transfer(::dsnet::transaction::eris::proto::EpochChangeStateTransfer* epoch_change_state_transfer);
+  private:
+  const ::dsnet::transaction::eris::proto::EpochChangeStateTransfer& _internal_epoch_change_state_transfer() const;
+  ::dsnet::transaction::eris::proto::EpochChangeStateTransfer* _internal_mutable_epoch_change_state_transfer();
+  public:
+  void unsafe_arena_set_allocated_epoch_change_state_transfer(
+      ::dsnet::transaction::eris::proto::EpochChangeStateTransfer* epoch_change_state_transfer);
+  ::dsnet::transaction::eris::proto::EpochChangeStateTransfer* unsafe_arena_release_epoch_change_state_transfer();
+
+  // .dsnet.transaction.eris.proto.StartEpoch start_epoch = 6;
+  bool has_start_epoch() const;
+  private:
+  bool _internal_has_start_epoch() const;
+  public:
+  void clear_start_epoch();
+  const ::dsnet::transaction::eris::proto::StartEpoch& start_epoch() const;
+  PROTOBUF_NODISCARD ::dsnet::transaction::eris::proto::StartEpoch* release_start_epoch();
+  ::dsnet::transaction::eris::proto::StartEpoch* mutable_start_epoch();
+  void set_allocated_start_epoch(::dsnet::transaction::eris::proto::StartEpoch* start_epoch);
+  private:
+  const ::dsnet::transaction::eris::proto::StartEpoch& _internal_start_epoch() const;
+  ::dsnet::transaction::eris::proto::StartEpoch* _internal_mutable_start_epoch();
+  public:
+  void unsafe_arena_set_allocated_start_epoch(
+      ::dsnet::transaction::eris::proto::StartEpoch* start_epoch);
+  ::dsnet::transaction::eris::proto::StartEpoch* unsafe_arena_release_start_epoch();
+
+  void clear_msg();
+  MsgCase msg_case() const;
+  // @@protoc_insertion_point(class_scope:dsnet.transaction.eris.proto.FCToErisMessage)
+ private:
+  class _Internal;
+  void set_has_txn_check();
+  void set_has_txn_found();
+  void set_has_drop_txn();
+  void set_has_epoch_change();
+  void set_has_epoch_change_state_transfer();
+  void set_has_start_epoch();
+
+  inline bool has_msg() const;
+  inline void clear_has_msg();
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    union MsgUnion {
+      constexpr MsgUnion() : _constinit_{} {}
+        ::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized _constinit_;
+      ::dsnet::transaction::eris::proto::TxnCheck* txn_check_;
+      ::dsnet::transaction::eris::proto::TxnFound* txn_found_;
+      ::dsnet::transaction::eris::proto::DropTxn* drop_txn_;
+      ::dsnet::transaction::eris::proto::EpochChange* epoch_change_;
+      ::dsnet::transaction::eris::proto::EpochChangeStateTransfer* epoch_change_state_transfer_;
+      ::dsnet::transaction::eris::proto::StartEpoch* start_epoch_;
+    } msg_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    uint32_t _oneof_case_[1];
+
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_transaction_2feris_2feris_2dproto_2eproto;
+};
+// ===================================================================
+
+
+// ===================================================================
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
+#endif  // __GNUC__
+// ViewNum
+
+// required uint32 view_num = 1;
+inline bool ViewNum::_internal_has_view_num() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool ViewNum::has_view_num() const {
+  return _internal_has_view_num();
+}
+inline void ViewNum::clear_view_num() {
+  _impl_.view_num_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline uint32_t ViewNum::_internal_view_num() const {
+  return _impl_.view_num_;
+}
+inline uint32_t ViewNum::view_num() const {
+  // @@protoc_insertion_point(field_get:dsnet.transaction.eris.proto.ViewNum.view_num)
+  return _internal_view_num();
+}
+inline void ViewNum::_internal_set_view_num(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.view_num_ = value;
+}
+inline void ViewNum::set_view_num(uint32_t value) {
+  _internal_set_view_num(value);
+  // @@protoc_insertion_point(field_set:dsnet.transaction.eris.proto.ViewNum.view_num)
+}
+
+// required uint32 sess_num = 2;
+inline bool ViewNum::_internal_has_sess_num() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool ViewNum::has_sess_num() const {
+  return _internal_has_sess_num();
+}
+inline void ViewNum::clear_sess_num() {
+  _impl_.sess_num_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline uint32_t ViewNum::_internal_sess_num() const {
+  return _impl_.sess_num_;
+}
+inline uint32_t ViewNum::sess_num() const {
+  // @@protoc_insertion_point(field_get:dsnet.transaction.eris.proto.ViewNum.sess_num)
+  return _internal_sess_num();
+}
+inline void ViewNum::_internal_set_sess_num(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.sess_num_ = value;
+}
+inline void ViewNum::set_sess_num(uint32_t value) {
+  _internal_set_sess_num(value);
+  // @@protoc_insertion_point(field_set:dsnet.transaction.eris.proto.ViewNum.sess_num)
+}
+
+// -------------------------------------------------------------------
+
+// Stamp
+
+// required uint32 shard_num = 1;
+inline bool Stamp::_internal_has_shard_num() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool Stamp::has_shard_num() const {
+  return _internal_has_shard_num();
+}
+inline void Stamp::clear_shard_num() {
+  _impl_.shard_num_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline uint32_t Stamp::_internal_shard_num() const {
+  return _impl_.shard_num_;
+}
+inline uint32_t Stamp::shard_num() const {
+  // @@protoc_insertion_point(field_get:dsnet.transaction.eris.proto.Stamp.shard_num)
+  return _internal_shard_num();
+}
+inline void Stamp::_internal_set_shard_num(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.shard_num_ = value;
+}
+inline void Stamp::set_shard_num(uint32_t value) {
+  _internal_set_shard_num(value);
+  // @@protoc_insertion_point(field_set:dsnet.transaction.eris.proto.Stamp.shard_num)
+}
+
+// required uint64 msg_num = 2;
+inline bool Stamp::_internal_has_msg_num() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool Stamp::has_msg_num() const {
+  return _internal_has_msg_num();
+}
+inline void Stamp::clear_msg_num() {
+  _impl_.msg_num_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline uint64_t Stamp::_internal_msg_num() const {
+  return _impl_.msg_num_;
+}
+inline uint64_t Stamp::msg_num() const {
+  // @@protoc_insertion_point(field_get:dsnet.transaction.eris.proto.Stamp.msg_num)
+  return _internal_msg_num();
+}
+inline void Stamp::_internal_set_msg_num(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.msg_num_ = value;
+}
+inline void Stamp::set_msg_num(uint64_t value) {
+  _internal_set_msg_num(value);
+  // @@protoc_insertion_point(field_set:dsnet.transaction.eris.proto.Stamp.msg_num)
+}
+
+// optional uint32 sess_num = 3;
+inline bool Stamp::_internal_has_sess_num() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool Stamp::has_sess_num() const {
+  return _internal_has_sess_num();
+}
+inline void Stamp::clear_sess_num() {
+  _impl_.sess_num_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline uint32_t Stamp::_internal_sess_num() const {
+  return _impl_.sess_num_;
+}
+inline uint32_t Stamp::sess_num() const {
+  // @@protoc_insertion_point(field_get:dsnet.transaction.eris.proto.Stamp.sess_num)
+  return _internal_sess_num();
+}
+inline void Stamp::_internal_set_sess_num(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.sess_num_ = value;
+}
+inline void Stamp::set_sess_num(uint32_t value) {
+  _internal_set_sess_num(value);
+  // @@protoc_insertion_point(field_set:dsnet.transaction.eris.proto.Stamp.sess_num)
+}
+
+// -------------------------------------------------------------------
+
+// ReplyMessage
+
+// required uint64 clientid = 1;
+inline bool ReplyMessage::_internal_has_clientid() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool ReplyMessage::has_clientid() const {
+  return _internal_has_clientid();
+}
+inline void ReplyMessage::clear_clientid() {
+  _impl_.clientid_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline uint64_t ReplyMessage::_internal_clientid() const {
+  return _impl_.clientid_;
+}
+inline uint64_t ReplyMessage::clientid() const {
+  // @@protoc_insertion_point(field_get:dsnet.transaction.eris.proto.ReplyMessage.clientid)
+  return _internal_clientid();
+}
+inline void ReplyMessage::_internal_set_clientid(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.clientid_ = value;
+}
+inline void ReplyMessage::set_clientid(uint64_t value) {
+  _internal_set_clientid(value);
+  // @@protoc_insertion_point(field_set:dsnet.transaction.eris.proto.ReplyMessage.clientid)
+}
+
+// required uint64 clientreqid = 2;
+inline bool ReplyMessage::_internal_has_clientreqid() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  return value;
+}
+inline bool ReplyMessage::has_clientreqid() const {
+  return _internal_has_clientreqid();
+}
+inline void ReplyMessage::clear_clientreqid() {
+  _impl_.clientreqid_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000008u;
+}
+inline uint64_t ReplyMessage::_internal_clientreqid() const {
+  return _impl_.clientreqid_;
+}
+inline uint64_t ReplyMessage::clientreqid() const {
+  // @@protoc_insertion_point(field_get:dsnet.transaction.eris.proto.ReplyMessage.clientreqid)
+  return _internal_clientreqid();
+}
+inline void ReplyMessage::_internal_set_clientreqid(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  _impl_.clientreqid_ = value;
+}
+inline void ReplyMessage::set_clientreqid(uint64_t value) {
+  _internal_set_clientreqid(value);
+  // @@protoc_insertion_point(field_set:dsnet.transaction.eris.proto.ReplyMessage.clientreqid)
+}
+
+// required uint32 shard_num = 3;
+inline bool ReplyMessage::_internal_has_shard_num() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000010u) != 0;
+  return value;
+}
+inline bool ReplyMessage::has_shard_num() const {
+  return _internal_has_shard_num();
+}
+inline void ReplyMessage::clear_shard_num() {
+  _impl_.shard_num_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000010u;
+}
+inline uint32_t ReplyMessage::_internal_shard_num() const {
+  return _impl_.shard_num_;
+}
+inline uint32_t ReplyMessage::shard_num() const {
+  // @@protoc_insertion_point(field_get:dsnet.transaction.eris.proto.ReplyMessage.shard_num)
+  return _internal_shard_num();
+}
+inline void ReplyMessage::_internal_set_shard_num(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000010u;
+  _impl_.shard_num_ = value;
+}
+inline void ReplyMessage::set_shard_num(uint32_t value) {
+  _internal_set_shard_num(value);
+  // @@protoc_insertion_point(field_set:dsnet.transaction.eris.proto.ReplyMessage.shard_num)
+}
+
+// required uint32 replica_num = 4;
+inline bool ReplyMessage::_internal_has_replica_num() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000020u) != 0;
+  return value;
+}
+inline bool ReplyMessage::has_replica_num() const {
+  return _internal_has_replica_num();
+}
+inline void ReplyMessage::clear_replica_num() {
+  _impl_.replica_num_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000020u;
+}
+inline uint32_t ReplyMessage::_internal_replica_num() const {
+  return _impl_.replica_num_;
+}
+inline uint32_t ReplyMessage::replica_num() const {
+  // @@protoc_insertion_point(field_get:dsnet.transaction.eris.proto.ReplyMessage.replica_num)
+  return _internal_replica_num();
+}
+inline void ReplyMessage::_internal_set_replica_num(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000020u;
+  _impl_.replica_num_ = value;
+}
+inline void ReplyMessage::set_replica_num(uint32_t value) {
+  _internal_set_replica_num(value);
+  // @@protoc_insertion_point(field_set:dsnet.transaction.eris.proto.ReplyMessage.replica_num)
+}
+
+// required .dsnet.transaction.eris.proto.ViewNum view = 5;
+inline bool ReplyMessage::_internal_has_view() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.view_ != nullptr);
+  return value;
+}
+inline bool ReplyMessage::has_view() const {
+  return _internal_has_view();
+}
+inline void ReplyMessage::clear_view() {
+  if (_impl_.view_ != nullptr) _impl_.view_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline const ::dsnet::transaction::eris::proto::ViewNum& ReplyMessage::_internal_view() const {
+  const ::dsnet::transaction::eris::proto::ViewNum* p = _impl_.view_;
+  return p != nullptr ? *p : reinterpret_cast<const ::dsnet::transaction::eris::proto::ViewNum&>(
+      ::dsnet::transaction::eris::proto::_ViewNum_default_instance_);
+}
+inline const ::dsnet::transaction::eris::proto::ViewNum& ReplyMessage::view() const {
+  // @@protoc_insertion_point(field_get:dsnet.transaction.eris.proto.ReplyMessage.view)
+  return _internal_view();
+}
+inline void ReplyMessage::unsafe_arena_set_allocated_view(
+    ::dsnet::transaction::eris::proto::ViewNum* view) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.view_);
+  }
+  _impl_.view_ = view;
+  if (view) {
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:dsnet.transaction.eris.proto.ReplyMessage.view)
+}
+inline ::dsnet::transaction::eris::proto::ViewNum* ReplyMessage::release_view() {
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  ::dsnet::transaction::eris::proto::ViewNum* temp = _impl_.view_;
+  _impl_.view_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::dsnet::transaction::eris::proto::ViewNum* ReplyMessage::unsafe_arena_release_view() {
+  // @@protoc_insertion_point(field_release:dsnet.transaction.eris.proto.ReplyMessage.view)
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  ::dsnet::transaction::eris::proto::ViewNum* temp = _impl_.view_;
+  _impl_.view_ = nullptr;
+  return temp;
+}
+inline ::dsnet::transaction::eris::proto::ViewNum* ReplyMessage::_internal_mutable_view() {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  if (_impl_.view_ == nullptr) {
+    auto* p = CreateMaybeMessage<::dsnet::transaction::eris::proto::ViewNum>(GetArenaForAllocation());
+    _impl_.view_ = p;
+  }
+  return _impl_.view_;
+}
+inline ::dsnet::transaction::eris::proto::ViewNum* ReplyMessage::mutable_view() {
+  ::dsnet::transaction::eris::proto::ViewNum* _msg = _internal_mutable_view();
+  // @@protoc_insertion_point(field_mutable:dsnet.transaction.eris.proto.ReplyMessage.view)
+  return _msg;
+}
+inline void ReplyMessage::set_allocated_view(::dsnet::transaction::eris::proto::ViewNum* view) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.view_;
+  }
+  if (view) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(view);
+    if (message_arena != submessage_arena) {
+      view = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, view, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  _impl_.view_ = view;
+  // @@protoc_insertion_point(field_set_allocated:dsnet.transaction.eris.proto.ReplyMessage.view)
+}
+
+// required uint64 op_num = 6;
+inline bool ReplyMessage::_internal_has_op_num() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000040u) != 0;
+  return value;
+}
+inline bool ReplyMessage::has_op_num() const {
+  return _internal_has_op_num();
+}
+inline void ReplyMessage::clear_op_num() {
+  _impl_.op_num_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000040u;
+}
+inline uint64_t ReplyMessage::_internal_op_num() const {
+  return _impl_.op_num_;
+}
+inline uint64_t ReplyMessage::op_num() const {
+  // @@protoc_insertion_point(field_get:dsnet.transaction.eris.proto.ReplyMessage.op_num)
+  return _internal_op_num();
+}
+inline void ReplyMessage::_internal_set_op_num(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000040u;
+  _impl_.op_num_ = value;
+}
+inline void ReplyMessage::set_op_num(uint64_t value) {
+  _internal_set_op_num(value);
+  // @@protoc_insertion_point(field_set:dsnet.transaction.eris.proto.ReplyMessage.op_num)
+}
+
+// optional uint32 commit = 7;
+inline bool ReplyMessage::_internal_has_commit() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000080u) != 0;
+  return value;
+}
+inline bool ReplyMessage::has_commit() const {
+  return _internal_has_commit();
+}
+inline void ReplyMessage::clear_commit() {
+  _impl_.commit_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000080u;
+}
+inline uint32_t ReplyMessage::_internal_commit() const {
+  return _impl_.commit_;
+}
+inline uint32_t ReplyMessage::commit() const {
+  // @@protoc_insertion_point(field_get:dsnet.transaction.eris.proto.ReplyMessage.commit)
+  return _internal_commit();
+}
+inline void ReplyMessage::_internal_set_commit(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000080u;
+  _impl_.commit_ = value;
+}
+inline void ReplyMessage::set_commit(uint32_t value) {
+  _internal_set_commit(value);
+  // @@protoc_insertion_point(field_set:dsnet.transaction.eris.proto.ReplyMessage.commit)
+}
+
+// optional bytes reply = 8;
+inline bool ReplyMessage::_internal_has_reply() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool ReplyMessage::has_reply() const {
+  return _internal_has_reply();
+}
+inline void ReplyMessage::clear_reply() {
+  _impl_.reply_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& ReplyMessage::reply() const {
+  // @@protoc_insertion_point(field_get:dsnet.transaction.eris.proto.ReplyMessage.reply)
+  return _internal_reply();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void ReplyMessage::set_reply(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.reply_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:dsnet.transaction.eris.proto.ReplyMessage.reply)
+}
+inline std::string* ReplyMessage::mutable_reply() {
+  std::string* _s = _internal_mutable_reply();
+  // @@protoc_insertion_point(field_mutable:dsnet.transaction.eris.proto.ReplyMessage.reply)
+  return _s;
+}
+inline const std::string& ReplyMessage::_internal_reply() const {
+  return _impl_.reply_.Get();
+}
+inline void ReplyMessage::_internal_set_reply(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.reply_.Set(value, GetArenaForAllocation());
+}
+inline std::string* ReplyMessage::_internal_mutable_reply() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.reply_.Mutable(GetArenaForAllocation());
+}
+inline std::string* ReplyMessage::release_reply() {
+  // @@protoc_insertion_point(field_release:dsnet.transaction.eris.proto.ReplyMessage.reply)
+  if (!_internal_has_reply()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.reply_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.reply_.IsDefault()) {
+    _impl_.reply_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void ReplyMessage::set_allocated_reply(std::string* reply) {
+  if (reply != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.reply_.SetAllocated(reply, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.reply_.IsDefault()) {
+    _impl_.reply_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:dsnet.transaction.eris.proto.ReplyMessage.reply)
+}
+
+// -------------------------------------------------------------------
+
+// RequestMessage
+
+// required uint64 txnid = 1;
+inline bool RequestMessage::_internal_has_txnid() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool RequestMessage::has_txnid() const {
+  return _internal_has_txnid();
+}
+inline void RequestMessage::clear_txnid() {
+  _impl_.txnid_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline uint64_t RequestMessage::_internal_txnid() const {
+  return _impl_.txnid_;
+}
+inline uint64_t RequestMessage::txnid() const {
+  // @@protoc_insertion_point(field_get:dsnet.transaction.eris.proto.RequestMessage.txnid)
+  return _internal_txnid();
+}
+inline void RequestMessage::_internal_set_txnid(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.txnid_ = value;
+}
+inline void RequestMessage::set_txnid(uint64_t value) {
+  _internal_set_txnid(value);
+  // @@protoc_insertion_point(field_set:dsnet.transaction.eris.proto.RequestMessage.txnid)
+}
+
+// required .dsnet.transaction.eris.proto.RequestType type = 2;
+inline bool RequestMessage::_internal_has_type() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool RequestMessage::has_type() const {
+  return _internal_has_type();
+}
+inline void RequestMessage::clear_type() {
+  _impl_.type_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline ::dsnet::transaction::eris::proto::RequestType RequestMessage::_internal_type() const {
+  return static_cast< ::dsnet::transaction::eris::proto::RequestType >(_impl_.type_);
+}
+inline ::dsnet::transaction::eris::proto::RequestType RequestMessage::type() const {
+  // @@protoc_insertion_point(field_get:dsnet.transaction.eris.proto.RequestMessage.type)
+  return _internal_type();
+}
+inline void RequestMessage::_internal_set_type(::dsnet::transaction::eris::proto::RequestType value) {
+  assert(::dsnet::transaction::eris::proto::RequestType_IsValid(value));
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.type_ = value;
+}
+inline void RequestMessage::set_type(::dsnet::transaction::eris::proto::RequestType value) {
+  _internal_set_type(value);
+  // @@protoc_insertion_point(field_set:dsnet.transaction.eris.proto.RequestMessage.type)
+}
+
+// required .dsnet.Request request = 3;
+inline bool RequestMessage::_internal_has_request() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.request_ != nullptr);
+  return value;
+}
+inline bool RequestMessage::has_request() const {
+  return _internal_has_request();
+}
+inline const ::dsnet::Request& RequestMessage::_internal_request() const {
+  const ::dsnet::Request* p = _impl_.request_;
+  return p != nullptr ? *p : reinterpret_cast<const ::dsnet::Request&>(
+      ::dsnet::_Request_default_instance_);
+}
+inline const ::dsnet::Request& RequestMessage::request() const {
+  // @@protoc_insertion_point(field_get:dsnet.transaction.eris.proto.RequestMessage.request)
+  return _internal_request();
+}
+inline void RequestMessage::unsafe_arena_set_allocated_request(
+    ::dsnet::Request* request) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.request_);
+  }
+  _impl_.request_ = request;
+  if (request) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:dsnet.transaction.eris.proto.RequestMessage.request)
+}
+inline ::dsnet::Request* RequestMessage::release_request() {
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::dsnet::Request* temp = _impl_.request_;
+  _impl_.request_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::dsnet::Request* RequestMessage::unsafe_arena_release_request() {
+  // @@protoc_insertion_point(field_release:dsnet.transaction.eris.proto.RequestMessage.request)
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::dsnet::Request* temp = _impl_.request_;
+  _impl_.request_ = nullptr;
+  return temp;
+}
+inline ::dsnet::Request* RequestMessage::_internal_mutable_request() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  if (_impl_.request_ == nullptr) {
+    auto* p = CreateMaybeMessage<::dsnet::Request>(GetArenaForAllocation());
+    _impl_.request_ = p;
+  }
+  return _impl_.request_;
+}
+inline ::dsnet::Request* RequestMessage::mutable_request() {
+  ::dsnet::Request* _msg = _internal_mutable_request();
+  // @@protoc_insertion_point(field_mutable:dsnet.transaction.eris.proto.RequestMessage.request)
+  return _msg;
+}
+inline void RequestMessage::set_allocated_request(::dsnet::Request* request) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete reinterpret_cast< ::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.request_);
+  }
+  if (request) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(
+                reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(request));
+    if (message_arena != submessage_arena) {
+      request = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, request, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.request_ = request;
+  // @@protoc_insertion_point(field_set_allocated:dsnet.transaction.eris.proto.RequestMessage.request)
+}
+
+// -------------------------------------------------------------------
+
+// GapRequestMessage
+
+// required .dsnet.transaction.eris.proto.ViewNum view = 1;
+inline bool GapRequestMessage::_internal_has_view() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.view_ != nullptr);
+  return value;
+}
+inline bool GapRequestMessage::has_view() const {
+  return _internal_has_view();
+}
+inline void GapRequestMessage::clear_view() {
+  if (_impl_.view_ != nullptr) _impl_.view_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const ::dsnet::transaction::eris::proto::ViewNum& GapRequestMessage::_internal_view() const {
+  const ::dsnet::transaction::eris::proto::ViewNum* p = _impl_.view_;
+  return p != nullptr ? *p : reinterpret_cast<const ::dsnet::transaction::eris::proto::ViewNum&>(
+      ::dsnet::transaction::eris::proto::_ViewNum_default_instance_);
+}
+inline const ::dsnet::transaction::eris::proto::ViewNum& GapRequestMessage::view() const {
+  // @@protoc_insertion_point(field_get:dsnet.transaction.eris.proto.GapRequestMessage.view)
+  return _internal_view();
+}
+inline void GapRequestMessage::unsafe_arena_set_allocated_view(
+    ::dsnet::transaction::eris::proto::ViewNum* view) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.view_);
+  }
+  _impl_.view_ = view;
+  if (view) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:dsnet.transaction.eris.proto.GapRequestMessage.view)
+}
+inline ::dsnet::transaction::eris::proto::ViewNum* GapRequestMessage::release_view() {
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::dsnet::transaction::eris::proto::ViewNum* temp = _impl_.view_;
+  _impl_.view_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::dsnet::transaction::eris::proto::ViewNum* GapRequestMessage::unsafe_arena_release_view() {
+  // @@protoc_insertion_point(field_release:dsnet.transaction.eris.proto.GapRequestMessage.view)
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::dsnet::transaction::eris::proto::ViewNum* temp = _impl_.view_;
+  _impl_.view_ = nullptr;
+  return temp;
+}
+inline ::dsnet::transaction::eris::proto::ViewNum* GapRequestMessage::_internal_mutable_view() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  if (_impl_.view_ == nullptr) {
+    auto* p = CreateMaybeMessage<::dsnet::transaction::eris::proto::ViewNum>(GetArenaForAllocation());
+    _impl_.view_ = p;
+  }
+  return _impl_.view_;
+}
+inline ::dsnet::transaction::eris::proto::ViewNum* GapRequestMessage::mutable_view() {
+  ::dsnet::transaction::eris::proto::ViewNum* _msg = _internal_mutable_view();
+  // @@protoc_insertion_point(field_mutable:dsnet.transaction.eris.proto.GapRequestMessage.view)
+  return _msg;
+}
+inline void GapRequestMessage::set_allocated_view(::dsnet::transaction::eris::proto::ViewNum* view) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.view_;
+  }
+  if (view) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(view);
+    if (message_arena != submessage_arena) {
+      view = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, view, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.view_ = view;
+  // @@protoc_insertion_point(field_set_allocated:dsnet.transaction.eris.proto.GapRequestMessage.view)
+}
+
+// required uint64 op_num = 2;
+inline bool GapRequestMessage::_internal_has_op_num() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool GapRequestMessage::has_op_num() const {
+  return _internal_has_op_num();
+}
+inline void GapRequestMessage::clear_op_num() {
+  _impl_.op_num_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline uint64_t GapRequestMessage::_internal_op_num() const {
+  return _impl_.op_num_;
+}
+inline uint64_t GapRequestMessage::op_num() const {
+  // @@protoc_insertion_point(field_get:dsnet.transaction.eris.proto.GapRequestMessage.op_num)
+  return _internal_op_num();
+}
+inline void GapRequestMessage::_internal_set_op_num(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.op_num_ = value;
+}
+inline void GapRequestMessage::set_op_num(uint64_t value) {
+  _internal_set_op_num(value);
+  // @@protoc_insertion_point(field_set:dsnet.transaction.eris.proto.GapRequestMessage.op_num)
+}
+
+// -------------------------------------------------------------------
+
+// GapReplyMessage
+
+// required .dsnet.transaction.eris.proto.ViewNum view = 1;
+inline bool GapReplyMessage::_internal_has_view() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.view_ != nullptr);
+  return value;
+}
+inline bool GapReplyMessage::has_view() const {
+  return _internal_has_view();
+}
+inline void GapReplyMessage::clear_view() {
+  if (_impl_.view_ != nullptr) _impl_.view_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const ::dsnet::transaction::eris::proto::ViewNum& GapReplyMessage::_internal_view() const {
+  const ::dsnet::transaction::eris::proto::ViewNum* p = _impl_.view_;
+  return p != nullptr ? *p : reinterpret_cast<const ::dsnet::transaction::eris::proto::ViewNum&>(
+      ::dsnet::transaction::eris::proto::_ViewNum_default_instance_);
+}
+inline const ::dsnet::transaction::eris::proto::ViewNum& GapReplyMessage::view() const {
+  // @@protoc_insertion_point(field_get:dsnet.transaction.eris.proto.GapReplyMessage.view)
+  return _internal_view();
+}
+inline void GapReplyMessage::unsafe_arena_set_allocated_view(
+    ::dsnet::transaction::eris::proto::ViewNum* view) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.view_);
+  }
+  _impl_.view_ = view;
+  if (view) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:dsnet.transaction.eris.proto.GapReplyMessage.view)
+}
+inline ::dsnet::transaction::eris::proto::ViewNum* GapReplyMessage::release_view() {
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::dsnet::transaction::eris::proto::ViewNum* temp = _impl_.view_;
+  _impl_.view_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::dsnet::transaction::eris::proto::ViewNum* GapReplyMessage::unsafe_arena_release_view() {
+  // @@protoc_insertion_point(field_release:dsnet.transaction.eris.proto.GapReplyMessage.view)
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::dsnet::transaction::eris::proto::ViewNum* temp = _impl_.view_;
+  _impl_.view_ = nullptr;
+  return temp;
+}
+inline ::dsnet::transaction::eris::proto::ViewNum* GapReplyMessage::_internal_mutable_view() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  if (_impl_.view_ == nullptr) {
+    auto* p = CreateMaybeMessage<::dsnet::transaction::eris::proto::ViewNum>(GetArenaForAllocation());
+    _impl_.view_ = p;
+  }
+  return _impl_.view_;
+}
+inline ::dsnet::transaction::eris::proto::ViewNum* GapReplyMessage::mutable_view() {
+  ::dsnet::transaction::eris::proto::ViewNum* _msg = _internal_mutable_view();
+  // @@protoc_insertion_point(field_mutable:dsnet.transaction.eris.proto.GapReplyMessage.view)
+  return _msg;
+}
+inline void GapReplyMessage::set_allocated_view(::dsnet::transaction::eris::proto::ViewNum* view) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.view_;
+  }
+  if (view) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(view);
+    if (message_arena != submessage_arena) {
+      view = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, view, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.view_ = view;
+  // @@protoc_insertion_point(field_set_allocated:dsnet.transaction.eris.proto.GapReplyMessage.view)
+}
+
+// required uint64 op_num = 2;
+inline bool GapReplyMessage::_internal_has_op_num() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool GapReplyMessage::has_op_num() const {
+  return _internal_has_op_num();
+}
+inline void GapReplyMessage::clear_op_num() {
+  _impl_.op_num_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline uint64_t GapReplyMessage::_internal_op_num() const {
+  return _impl_.op_num_;
+}
+inline uint64_t GapReplyMessage::op_num() const {
+  // @@protoc_insertion_point(field_get:dsnet.transaction.eris.proto.GapReplyMessage.op_num)
+  return _internal_op_num();
+}
+inline void GapReplyMessage::_internal_set_op_num(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.op_num_ = value;
+}
+inline void GapReplyMessage::set_op_num(uint64_t value) {
+  _internal_set_op_num(value);
+  // @@protoc_insertion_point(field_set:dsnet.transaction.eris.proto.GapReplyMessage.op_num)
+}
+
+// required bool isfound = 4;
+inline bool GapReplyMessage::_internal_has_isfound() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  return value;
+}
+inline bool GapReplyMessage::has_isfound() const {
+  return _internal_has_isfound();
+}
+inline void GapReplyMessage::clear_isfound() {
+  _impl_.isfound_ = false;
+  _impl_._has_bits_[0] &= ~0x00000008u;
+}
+inline bool GapReplyMessage::_internal_isfound() const {
+  return _impl_.isfound_;
+}
+inline bool GapReplyMessage::isfound() const {
+  // @@protoc_insertion_point(field_get:dsnet.transaction.eris.proto.GapReplyMessage.isfound)
+  return _internal_isfound();
+}
+inline void GapReplyMessage::_internal_set_isfound(bool value) {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  _impl_.isfound_ = value;
+}
+inline void GapReplyMessage::set_isfound(bool value) {
+  _internal_set_isfound(value);
+  // @@protoc_insertion_point(field_set:dsnet.transaction.eris.proto.GapReplyMessage.isfound)
+}
+
+// required bool isgap = 5;
+inline bool GapReplyMessage::_internal_has_isgap() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000010u) != 0;
+  return value;
+}
+inline bool GapReplyMessage::has_isgap() const {
+  return _internal_has_isgap();
+}
+inline void GapReplyMessage::clear_isgap() {
+  _impl_.isgap_ = false;
+  _impl_._has_bits_[0] &= ~0x00000010u;
+}
+inline bool GapReplyMessage::_internal_isgap() const {
+  return _impl_.isgap_;
+}
+inline bool GapReplyMessage::isgap() const {
+  // @@protoc_insertion_point(field_get:dsnet.transaction.eris.proto.GapReplyMessage.isgap)
+  return _internal_isgap();
+}
+inline void GapReplyMessage::_internal_set_isgap(bool value) {
+  _impl_._has_bits_[0] |= 0x00000010u;
+  _impl_.isgap_ = value;
+}
+inline void GapReplyMessage::set_isgap(bool value) {
+  _internal_set_isgap(value);
+  // @@protoc_insertion_point(field_set:dsnet.transaction.eris.proto.GapReplyMessage.isgap)
+}
+
+// required uint32 replica_num = 6;
+inline bool GapReplyMessage::_internal_has_replica_num() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000020u) != 0;
+  return value;
+}
+inline bool GapReplyMessage::has_replica_num() const {
+  return _internal_has_replica_num();
+}
+inline void GapReplyMessage::clear_replica_num() {
+  _impl_.replica_num_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000020u;
+}
+inline uint32_t GapReplyMessage::_internal_replica_num() const {
+  return _impl_.replica_num_;
+}
+inline uint32_t GapReplyMessage::replica_num() const {
+  // @@protoc_insertion_point(field_get:dsnet.transaction.eris.proto.GapReplyMessage.replica_num)
+  return _internal_replica_num();
+}
+inline void GapReplyMessage::_internal_set_replica_num(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000020u;
+  _impl_.replica_num_ = value;
+}
+inline void GapReplyMessage::set_replica_num(uint32_t value) {
+  _internal_set_replica_num(value);
+  // @@protoc_insertion_point(field_set:dsnet.transaction.eris.proto.GapReplyMessage.replica_num)
+}
+
+// optional .dsnet.transaction.eris.proto.RequestMessage req = 7;
+inline bool GapReplyMessage::_internal_has_req() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.req_ != nullptr);
+  return value;
+}
+inline bool GapReplyMessage::has_req() const {
+  return _internal_has_req();
+}
+inline void GapReplyMessage::clear_req() {
+  if (_impl_.req_ != nullptr) _impl_.req_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline const ::dsnet::transaction::eris::proto::RequestMessage& GapReplyMessage::_internal_req() const {
+  const ::dsnet::transaction::eris::proto::RequestMessage* p = _impl_.req_;
+  return p != nullptr ? *p : reinterpret_cast<const ::dsnet::transaction::eris::proto::RequestMessage&>(
+      ::dsnet::transaction::eris::proto::_RequestMessage_default_instance_);
+}
+inline const ::dsnet::transaction::eris::proto::RequestMessage& GapReplyMessage::req() const {
+  // @@protoc_insertion_point(field_get:dsnet.transaction.eris.proto.GapReplyMessage.req)
+  return _internal_req();
+}
+inline void GapReplyMessage::unsafe_arena_set_allocated_req(
+    ::dsnet::transaction::eris::proto::RequestMessage* req) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.req_);
+  }
+  _impl_.req_ = req;
+  if (req) {
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:dsnet.transaction.eris.proto.GapReplyMessage.req)
+}
+inline ::dsnet::transaction::eris::proto::RequestMessage* GapReplyMessage::release_req() {
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  ::dsnet::transaction::eris::proto::RequestMessage* temp = _impl_.req_;
+  _impl_.req_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::dsnet::transaction::eris::proto::RequestMessage* GapReplyMessage::unsafe_arena_release_req() {
+  // @@protoc_insertion_point(field_release:dsnet.transaction.eris.proto.GapReplyMessage.req)
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  ::dsnet::transaction::eris::proto::RequestMessage* temp = _impl_.req_;
+  _impl_.req_ = nullptr;
+  return temp;
+}
+inline ::dsnet::transaction::eris::proto::RequestMessage* GapReplyMessage::_internal_mutable_req() {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  if (_impl_.req_ == nullptr) {
+    auto* p = CreateMaybeMessage<::dsnet::transaction::eris::proto::RequestMessage>(GetArenaForAllocation());
+    _impl_.req_ = p;
+  }
+  return _impl_.req_;
+}
+inline ::dsnet::transaction::eris::proto::RequestMessage* GapReplyMessage::mutable_req() {
+  ::dsnet::transaction::eris::proto::RequestMessage* _msg = _internal_mutable_req();
+  // @@protoc_insertion_point(field_mutable:dsnet.transaction.eris.proto.GapReplyMessage.req)
+  return _msg;
+}
+inline void GapReplyMessage::set_allocated_req(::dsnet::transaction::eris::proto::RequestMessage* req) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.req_;
+  }
+  if (req) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(req);
+    if (message_arena != submessage_arena) {
+      req = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, req, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  _impl_.req_ = req;
+  // @@protoc_insertion_point(field_set_allocated:dsnet.transaction.eris.proto.GapReplyMessage.req)
+}
+
+// -------------------------------------------------------------------
+
+// SyncPrepareMessage
+
+// required .dsnet.transaction.eris.proto.ViewNum view = 1;
+inline bool SyncPrepareMessage::_internal_has_view() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.view_ != nullptr);
+  return value;
+}
+inline bool SyncPrepareMessage::has_view() const {
+  return _internal_has_view();
+}
+inline void SyncPrepareMessage::clear_view() {
+  if (_impl_.view_ != nullptr) _impl_.view_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const ::dsnet::transaction::eris::proto::ViewNum& SyncPrepareMessage::_internal_view() const {
+  const ::dsnet::transaction::eris::proto::ViewNum* p = _impl_.view_;
+  return p != nullptr ? *p : reinterpret_cast<const ::dsnet::transaction::eris::proto::ViewNum&>(
+      ::dsnet::transaction::eris::proto::_ViewNum_default_instance_);
+}
+inline const ::dsnet::transaction::eris::proto::ViewNum& SyncPrepareMessage::view() const {
+  // @@protoc_insertion_point(field_get:dsnet.transaction.eris.proto.SyncPrepareMessage.view)
+  return _internal_view();
+}
+inline void SyncPrepareMessage::unsafe_arena_set_allocated_view(
+    ::dsnet::transaction::eris::proto::ViewNum* view) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.view_);
+  }
+  _impl_.view_ = view;
+  if (view) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:dsnet.transaction.eris.proto.SyncPrepareMessage.view)
+}
+inline ::dsnet::transaction::eris::proto::ViewNum* SyncPrepareMessage::release_view() {
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::dsnet::transaction::eris::proto::ViewNum* temp = _impl_.view_;
+  _impl_.view_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::dsnet::transaction::eris::proto::ViewNum* SyncPrepareMessage::unsafe_arena_release_view() {
+  // @@protoc_insertion_point(field_release:dsnet.transaction.eris.proto.SyncPrepareMessage.view)
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::dsnet::transaction::eris::proto::ViewNum* temp = _impl_.view_;
+  _impl_.view_ = nullptr;
+  return temp;
+}
+inline ::dsnet::transaction::eris::proto::ViewNum* SyncPrepareMessage::_internal_mutable_view() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  if (_impl_.view_ == nullptr) {
+    auto* p = CreateMaybeMessage<::dsnet::transaction::eris::proto::ViewNum>(GetArenaForAllocation());
+    _impl_.view_ = p;
+  }
+  return _impl_.view_;
+}
+inline ::dsnet::transaction::eris::proto::ViewNum* SyncPrepareMessage::mutable_view() {
+  ::dsnet::transaction::eris::proto::ViewNum* _msg = _internal_mutable_view();
+  // @@protoc_insertion_point(field_mutable:dsnet.transaction.eris.proto.SyncPrepareMessage.view)
+  return _msg;
+}
+inline void SyncPrepareMessage::set_allocated_view(::dsnet::transaction::eris::proto::ViewNum* view) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.view_;
+  }
+  if (view) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(view);
+    if (message_arena != submessage_arena) {
+      view = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, view, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.view_ = view;
+  // @@protoc_insertion_point(field_set_allocated:dsnet.transaction.eris.proto.SyncPrepareMessage.view)
+}
+
+// -------------------------------------------------------------------
+
+// ViewChangeRequestMessage
+
+// required .dsnet.transaction.eris.proto.ViewNum view = 1;
+inline bool ViewChangeRequestMessage::_internal_has_view() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.view_ != nullptr);
+  return value;
+}
+inline bool ViewChangeRequestMessage::has_view() const {
+  return _internal_has_view();
+}
+inline void ViewChangeRequestMessage::clear_view() {
+  if (_impl_.view_ != nullptr) _impl_.view_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const ::dsnet::transaction::eris::proto::ViewNum& ViewChangeRequestMessage::_internal_view() const {
+  const ::dsnet::transaction::eris::proto::ViewNum* p = _impl_.view_;
+  return p != nullptr ? *p : reinterpret_cast<const ::dsnet::transaction::eris::proto::ViewNum&>(
+      ::dsnet::transaction::eris::proto::_ViewNum_default_instance_);
+}
+inline const ::dsnet::transaction::eris::proto::ViewNum& ViewChangeRequestMessage::view() const {
+  // @@protoc_insertion_point(field_get:dsnet.transaction.eris.proto.ViewChangeRequestMessage.view)
+  return _internal_view();
+}
+inline void ViewChangeRequestMessage::unsafe_arena_set_allocated_view(
+    ::dsnet::transaction::eris::proto::ViewNum* view) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.view_);
+  }
+  _impl_.view_ = view;
+  if (view) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:dsnet.transaction.eris.proto.ViewChangeRequestMessage.view)
+}
+inline ::dsnet::transaction::eris::proto::ViewNum* ViewChangeRequestMessage::release_view() {
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::dsnet::transaction::eris::proto::ViewNum* temp = _impl_.view_;
+  _impl_.view_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::dsnet::transaction::eris::proto::ViewNum* ViewChangeRequestMessage::unsafe_arena_release_view() {
+  // @@protoc_insertion_point(field_release:dsnet.transaction.eris.proto.ViewChangeRequestMessage.view)
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::dsnet::transaction::eris::proto::ViewNum* temp = _impl_.view_;
+  _impl_.view_ = nullptr;
+  return temp;
+}
+inline ::dsnet::transaction::eris::proto::ViewNum* ViewChangeRequestMessage::_internal_mutable_view() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  if (_impl_.view_ == nullptr) {
+    auto* p = CreateMaybeMessage<::dsnet::transaction::eris::proto::ViewNum>(GetArenaForAllocation());
+    _impl_.view_ = p;
+  }
+  return _impl_.view_;
+}
+inline ::dsnet::transaction::eris::proto::ViewNum* ViewChangeRequestMessage::mutable_view() {
+  ::dsnet::transaction::eris::proto::ViewNum* _msg = _internal_mutable_view();
+  // @@protoc_insertion_point(field_mutable:dsnet.transaction.eris.proto.ViewChangeRequestMessage.view)
+  return _msg;
+}
+inline void ViewChangeRequestMessage::set_allocated_view(::dsnet::transaction::eris::proto::ViewNum* view) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.view_;
+  }
+  if (view) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(view);
+    if (message_arena != submessage_arena) {
+      view = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, view, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.view_ = view;
+  // @@protoc_insertion_point(field_set_allocated:dsnet.transaction.eris.proto.ViewChangeRequestMessage.view)
+}
+
+// -------------------------------------------------------------------
+
+// DropTxns
+
+// repeated .dsnet.transaction.eris.proto.Stamp temp_drops = 1;
+inline int DropTxns::_internal_temp_drops_size() const {
+  return _impl_.temp_drops_.size();
+}
+inline int DropTxns::temp_drops_size() const {
+  return _internal_temp_drops_size();
+}
+inline void DropTxns::clear_temp_drops() {
+  _impl_.temp_drops_.Clear();
+}
+inline ::dsnet::transaction::eris::proto::Stamp* DropTxns::mutable_temp_drops(int index) {
+  // @@protoc_insertion_point(field_mutable:dsnet.transaction.eris.proto.DropTxns.temp_drops)
+  return _impl_.temp_drops_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::dsnet::transaction::eris::proto::Stamp >*
+DropTxns::mutable_temp_drops() {
+  // @@protoc_insertion_point(field_mutable_list:dsnet.transaction.eris.proto.DropTxns.temp_drops)
+  return &_impl_.temp_drops_;
+}
+inline const ::dsnet::transaction::eris::proto::Stamp& DropTxns::_internal_temp_drops(int index) const {
+  return _impl_.temp_drops_.Get(index);
+}
+inline const ::dsnet::transaction::eris::proto::Stamp& DropTxns::temp_drops(int index) const {
+  // @@protoc_insertion_point(field_get:dsnet.transaction.eris.proto.DropTxns.temp_drops)
+  return _internal_temp_drops(index);
+}
+inline ::dsnet::transaction::eris::proto::Stamp* DropTxns::_internal_add_temp_drops() {
+  return _impl_.temp_drops_.Add();
+}
+inline ::dsnet::transaction::eris::proto::Stamp* DropTxns::add_temp_drops() {
+  ::dsnet::transaction::eris::proto::Stamp* _add = _internal_add_temp_drops();
+  // @@protoc_insertion_point(field_add:dsnet.transaction.eris.proto.DropTxns.temp_drops)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::dsnet::transaction::eris::proto::Stamp >&
+DropTxns::temp_drops() const {
+  // @@protoc_insertion_point(field_list:dsnet.transaction.eris.proto.DropTxns.temp_drops)
+  return _impl_.temp_drops_;
+}
+
+// repeated .dsnet.transaction.eris.proto.Stamp perm_drops = 2;
+inline int DropTxns::_internal_perm_drops_size() const {
+  return _impl_.perm_drops_.size();
+}
+inline int DropTxns::perm_drops_size() const {
+  return _internal_perm_drops_size();
+}
+inline void DropTxns::clear_perm_drops() {
+  _impl_.perm_drops_.Clear();
+}
+inline ::dsnet::transaction::eris::proto::Stamp* DropTxns::mutable_perm_drops(int index) {
+  // @@protoc_insertion_point(field_mutable:dsnet.transaction.eris.proto.DropTxns.perm_drops)
+  return _impl_.perm_drops_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::dsnet::transaction::eris::proto::Stamp >*
+DropTxns::mutable_perm_drops() {
+  // @@protoc_insertion_point(field_mutable_list:dsnet.transaction.eris.proto.DropTxns.perm_drops)
+  return &_impl_.perm_drops_;
+}
+inline const ::dsnet::transaction::eris::proto::Stamp& DropTxns::_internal_perm_drops(int index) const {
+  return _impl_.perm_drops_.Get(index);
+}
+inline const ::dsnet::transaction::eris::proto::Stamp& DropTxns::perm_drops(int index) const {
+  // @@protoc_insertion_point(field_get:dsnet.transaction.eris.proto.DropTxns.perm_drops)
+  return _internal_perm_drops(index);
+}
+inline ::dsnet::transaction::eris::proto::Stamp* DropTxns::_internal_add_perm_drops() {
+  return _impl_.perm_drops_.Add();
+}
+inline ::dsnet::transaction::eris::proto::Stamp* DropTxns::add_perm_drops() {
+  ::dsnet::transaction::eris::proto::Stamp* _add = _internal_add_perm_drops();
+  // @@protoc_insertion_point(field_add:dsnet.transaction.eris.proto.DropTxns.perm_drops)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::dsnet::transaction::eris::proto::Stamp >&
+DropTxns::perm_drops() const {
+  // @@protoc_insertion_point(field_list:dsnet.transaction.eris.proto.DropTxns.perm_drops)
+  return _impl_.perm_drops_;
+}
+
+// repeated .dsnet.transaction.eris.proto.RequestMessage un_drops = 3;
+inline int DropTxns::_internal_un_drops_size() const {
+  return _impl_.un_drops_.size();
+}
+inline int DropTxns::un_drops_size() const {
+  return _internal_un_drops_size();
+}
+inline void DropTxns::clear_un_drops() {
+  _impl_.un_drops_.Clear();
+}
+inline ::dsnet::transaction::eris::proto::RequestMessage* DropTxns::mutable_un_drops(int index) {
+  // @@protoc_insertion_point(field_mutable:dsnet.transaction.eris.proto.DropTxns.un_drops)
+  return _impl_.un_drops_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::dsnet::transaction::eris::proto::RequestMessage >*
+DropTxns::mutable_un_drops() {
+  // @@protoc_insertion_point(field_mutable_list:dsnet.transaction.eris.proto.DropTxns.un_drops)
+  return &_impl_.un_drops_;
+}
+inline const ::dsnet::transaction::eris::proto::RequestMessage& DropTxns::_internal_un_drops(int index) const {
+  return _impl_.un_drops_.Get(index);
+}
+inline const ::dsnet::transaction::eris::proto::RequestMessage& DropTxns::un_drops(int index) const {
+  // @@protoc_insertion_point(field_get:dsnet.transaction.eris.proto.DropTxns.un_drops)
+  return _internal_un_drops(index);
+}
+inline ::dsnet::transaction::eris::proto::RequestMessage* DropTxns::_internal_add_un_drops() {
+  return _impl_.un_drops_.Add();
+}
+inline ::dsnet::transaction::eris::proto::RequestMessage* DropTxns::add_un_drops() {
+  ::dsnet::transaction::eris::proto::RequestMessage* _add = _internal_add_un_drops();
+  // @@protoc_insertion_point(field_add:dsnet.transaction.eris.proto.DropTxns.un_drops)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::dsnet::transaction::eris::proto::RequestMessage >&
+DropTxns::un_drops() const {
+  // @@protoc_insertion_point(field_list:dsnet.transaction.eris.proto.DropTxns.un_drops)
+  return _impl_.un_drops_;
+}
+
+// -------------------------------------------------------------------
+
+// ViewChangeMessage
+
+// required .dsnet.transaction.eris.proto.ViewNum view = 1;
+inline bool ViewChangeMessage::_internal_has_view() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.view_ != nullptr);
+  return value;
+}
+inline bool ViewChangeMessage::has_view() const {
+  return _internal_has_view();
+}
+inline void ViewChangeMessage::clear_view() {
+  if (_impl_.view_ != nullptr) _impl_.view_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const ::dsnet::transaction::eris::proto::ViewNum& ViewChangeMessage::_internal_view() const {
+  const ::dsnet::transaction::eris::proto::ViewNum* p = _impl_.view_;
+  return p != nullptr ? *p : reinterpret_cast<const ::dsnet::transaction::eris::proto::ViewNum&>(
+      ::dsnet::transaction::eris::proto::_ViewNum_default_instance_);
+}
+inline const ::dsnet::transaction::eris::proto::ViewNum& ViewChangeMessage::view() const {
+  // @@protoc_insertion_point(field_get:dsnet.transaction.eris.proto.ViewChangeMessage.view)
+  return _internal_view();
+}
+inline void ViewChangeMessage::unsafe_arena_set_allocated_view(
+    ::dsnet::transaction::eris::proto::ViewNum* view) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.view_);
+  }
+  _impl_.view_ = view;
+  if (view) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:dsnet.transaction.eris.proto.ViewChangeMessage.view)
+}
+inline ::dsnet::transaction::eris::proto::ViewNum* ViewChangeMessage::release_view() {
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::dsnet::transaction::eris::proto::ViewNum* temp = _impl_.view_;
+  _impl_.view_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::dsnet::transaction::eris::proto::ViewNum* ViewChangeMessage::unsafe_arena_release_view() {
+  // @@protoc_insertion_point(field_release:dsnet.transaction.eris.proto.ViewChangeMessage.view)
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::dsnet::transaction::eris::proto::ViewNum* temp = _impl_.view_;
+  _impl_.view_ = nullptr;
+  return temp;
+}
+inline ::dsnet::transaction::eris::proto::ViewNum* ViewChangeMessage::_internal_mutable_view() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  if (_impl_.view_ == nullptr) {
+    auto* p = CreateMaybeMessage<::dsnet::transaction::eris::proto::ViewNum>(GetArenaForAllocation());
+    _impl_.view_ = p;
+  }
+  return _impl_.view_;
+}
+inline ::dsnet::transaction::eris::proto::ViewNum* ViewChangeMessage::mutable_view() {
+  ::dsnet::transaction::eris::proto::ViewNum* _msg = _internal_mutable_view();
+  // @@protoc_insertion_point(field_mutable:dsnet.transaction.eris.proto.ViewChangeMessage.view)
+  return _msg;
+}
+inline void ViewChangeMessage::set_allocated_view(::dsnet::transaction::eris::proto::ViewNum* view) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.view_;
+  }
+  if (view) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(view);
+    if (message_arena != submessage_arena) {
+      view = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, view, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.view_ = view;
+  // @@protoc_insertion_point(field_set_allocated:dsnet.transaction.eris.proto.ViewChangeMessage.view)
+}
+
+// required uint32 replica_num = 2;
+inline bool ViewChangeMessage::_internal_has_replica_num() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  return value;
+}
+inline bool ViewChangeMessage::has_replica_num() const {
+  return _internal_has_replica_num();
+}
+inline void ViewChangeMessage::clear_replica_num() {
+  _impl_.replica_num_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000008u;
+}
+inline uint32_t ViewChangeMessage::_internal_replica_num() const {
+  return _impl_.replica_num_;
+}
+inline uint32_t ViewChangeMessage::replica_num() const {
+  // @@protoc_insertion_point(field_get:dsnet.transaction.eris.proto.ViewChangeMessage.replica_num)
+  return _internal_replica_num();
+}
+inline void ViewChangeMessage::_internal_set_replica_num(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  _impl_.replica_num_ = value;
+}
+inline void ViewChangeMessage::set_replica_num(uint32_t value) {
+  _internal_set_replica_num(value);
+  // @@protoc_insertion_point(field_set:dsnet.transaction.eris.proto.ViewChangeMessage.replica_num)
+}
+
+// required uint64 op_num = 3;
+inline bool ViewChangeMessage::_internal_has_op_num() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool ViewChangeMessage::has_op_num() const {
+  return _internal_has_op_num();
+}
+inline void ViewChangeMessage::clear_op_num() {
+  _impl_.op_num_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline uint64_t ViewChangeMessage::_internal_op_num() const {
+  return _impl_.op_num_;
+}
+inline uint64_t ViewChangeMessage::op_num() const {
+  // @@protoc_insertion_point(field_get:dsnet.transaction.eris.proto.ViewChangeMessage.op_num)
+  return _internal_op_num();
+}
+inline void ViewChangeMessage::_internal_set_op_num(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.op_num_ = value;
+}
+inline void ViewChangeMessage::set_op_num(uint64_t value) {
+  _internal_set_op_num(value);
+  // @@protoc_insertion_point(field_set:dsnet.transaction.eris.proto.ViewChangeMessage.op_num)
+}
+
+// required .dsnet.transaction.eris.proto.DropTxns drops = 4;
+inline bool ViewChangeMessage::_internal_has_drops() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.drops_ != nullptr);
+  return value;
+}
+inline bool ViewChangeMessage::has_drops() const {
+  return _internal_has_drops();
+}
+inline void ViewChangeMessage::clear_drops() {
+  if (_impl_.drops_ != nullptr) _impl_.drops_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline const ::dsnet::transaction::eris::proto::DropTxns& ViewChangeMessage::_internal_drops() const {
+  const ::dsnet::transaction::eris::proto::DropTxns* p = _impl_.drops_;
+  return p != nullptr ? *p : reinterpret_cast<const ::dsnet::transaction::eris::proto::DropTxns&>(
+      ::dsnet::transaction::eris::proto::_DropTxns_default_instance_);
+}
+inline const ::dsnet::transaction::eris::proto::DropTxns& ViewChangeMessage::drops() const {
+  // @@protoc_insertion_point(field_get:dsnet.transaction.eris.proto.ViewChangeMessage.drops)
+  return _internal_drops();
+}
+inline void ViewChangeMessage::unsafe_arena_set_allocated_drops(
+    ::dsnet::transaction::eris::proto::DropTxns* drops) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.drops_);
+  }
+  _impl_.drops_ = drops;
+  if (drops) {
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:dsnet.transaction.eris.proto.ViewChangeMessage.drops)
+}
+inline ::dsnet::transaction::eris::proto::DropTxns* ViewChangeMessage::release_drops() {
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  ::dsnet::transaction::eris::proto::DropTxns* temp = _impl_.drops_;
+  _impl_.drops_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::dsnet::transaction::eris::proto::DropTxns* ViewChangeMessage::unsafe_arena_release_drops() {
+  // @@protoc_insertion_point(field_release:dsnet.transaction.eris.proto.ViewChangeMessage.drops)
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  ::dsnet::transaction::eris::proto::DropTxns* temp = _impl_.drops_;
+  _impl_.drops_ = nullptr;
+  return temp;
+}
+inline ::dsnet::transaction::eris::proto::DropTxns* ViewChangeMessage::_internal_mutable_drops() {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  if (_impl_.drops_ == nullptr) {
+    auto* p = CreateMaybeMessage<::dsnet::transaction::eris::proto::DropTxns>(GetArenaForAllocation());
+    _impl_.drops_ = p;
+  }
+  return _impl_.drops_;
+}
+inline ::dsnet::transaction::eris::proto::DropTxns* ViewChangeMessage::mutable_drops() {
+  ::dsnet::transaction::eris::proto::DropTxns* _msg = _internal_mutable_drops();
+  // @@protoc_insertion_point(field_mutable:dsnet.transaction.eris.proto.ViewChangeMessage.drops)
+  return _msg;
+}
+inline void ViewChangeMessage::set_allocated_drops(::dsnet::transaction::eris::proto::DropTxns* drops) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.drops_;
+  }
+  if (drops) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(drops);
+    if (message_arena != submessage_arena) {
+      drops = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, drops, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  _impl_.drops_ = drops;
+  // @@protoc_insertion_point(field_set_allocated:dsnet.transaction.eris.proto.ViewChangeMessage.drops)
+}
+
+// -------------------------------------------------------------------
+
+// StartViewMessage
+
+// required .dsnet.transaction.eris.proto.ViewNum view = 1;
+inline bool StartViewMessage::_internal_has_view() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.view_ != nullptr);
+  return value;
+}
+inline bool StartViewMessage::has_view() const {
+  return _internal_has_view();
+}
+inline void StartViewMessage::clear_view() {
+  if (_impl_.view_ != nullptr) _impl_.view_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const ::dsnet::transaction::eris::proto::ViewNum& StartViewMessage::_internal_view() const {
+  const ::dsnet::transaction::eris::proto::ViewNum* p = _impl_.view_;
+  return p != nullptr ? *p : reinterpret_cast<const ::dsnet::transaction::eris::proto::ViewNum&>(
+      ::dsnet::transaction::eris::proto::_ViewNum_default_instance_);
+}
+inline const ::dsnet::transaction::eris::proto::ViewNum& StartViewMessage::view() const {
+  // @@protoc_insertion_point(field_get:dsnet.transaction.eris.proto.StartViewMessage.view)
+  return _internal_view();
+}
+inline void StartViewMessage::unsafe_arena_set_allocated_view(
+    ::dsnet::transaction::eris::proto::ViewNum* view) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.view_);
+  }
+  _impl_.view_ = view;
+  if (view) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:dsnet.transaction.eris.proto.StartViewMessage.view)
+}
+inline ::dsnet::transaction::eris::proto::ViewNum* StartViewMessage::release_view() {
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::dsnet::transaction::eris::proto::ViewNum* temp = _impl_.view_;
+  _impl_.view_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::dsnet::transaction::eris::proto::ViewNum* StartViewMessage::unsafe_arena_release_view() {
+  // @@protoc_insertion_point(field_release:dsnet.transaction.eris.proto.StartViewMessage.view)
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::dsnet::transaction::eris::proto::ViewNum* temp = _impl_.view_;
+  _impl_.view_ = nullptr;
+  return temp;
+}
+inline ::dsnet::transaction::eris::proto::ViewNum* StartViewMessage::_internal_mutable_view() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  if (_impl_.view_ == nullptr) {
+    auto* p = CreateMaybeMessage<::dsnet::transaction::eris::proto::ViewNum>(GetArenaForAllocation());
+    _impl_.view_ = p;
+  }
+  return _impl_.view_;
+}
+inline ::dsnet::transaction::eris::proto::ViewNum* StartViewMessage::mutable_view() {
+  ::dsnet::transaction::eris::proto::ViewNum* _msg = _internal_mutable_view();
+  // @@protoc_insertion_point(field_mutable:dsnet.transaction.eris.proto.StartViewMessage.view)
+  return _msg;
+}
+inline void StartViewMessage::set_allocated_view(::dsnet::transaction::eris::proto::ViewNum* view) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.view_;
+  }
+  if (view) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(view);
+    if (message_arena != submessage_arena) {
+      view = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, view, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.view_ = view;
+  // @@protoc_insertion_point(field_set_allocated:dsnet.transaction.eris.proto.StartViewMessage.view)
+}
+
+// required uint64 op_num = 2;
+inline bool StartViewMessage::_internal_has_op_num() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool StartViewMessage::has_op_num() const {
+  return _internal_has_op_num();
+}
+inline void StartViewMessage::clear_op_num() {
+  _impl_.op_num_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline uint64_t StartViewMessage::_internal_op_num() const {
+  return _impl_.op_num_;
+}
+inline uint64_t StartViewMessage::op_num() const {
+  // @@protoc_insertion_point(field_get:dsnet.transaction.eris.proto.StartViewMessage.op_num)
+  return _internal_op_num();
+}
+inline void StartViewMessage::_internal_set_op_num(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.op_num_ = value;
+}
+inline void StartViewMessage::set_op_num(uint64_t value) {
+  _internal_set_op_num(value);
+  // @@protoc_insertion_point(field_set:dsnet.transaction.eris.proto.StartViewMessage.op_num)
+}
+
+// required .dsnet.transaction.eris.proto.DropTxns drops = 3;
+inline bool StartViewMessage::_internal_has_drops() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.drops_ != nullptr);
+  return value;
+}
+inline bool StartViewMessage::has_drops() const {
+  return _internal_has_drops();
+}
+inline void StartViewMessage::clear_drops() {
+  if (_impl_.drops_ != nullptr) _impl_.drops_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline const ::dsnet::transaction::eris::proto::DropTxns& StartViewMessage::_internal_drops() const {
+  const ::dsnet::transaction::eris::proto::DropTxns* p = _impl_.drops_;
+  return p != nullptr ? *p : reinterpret_cast<const ::dsnet::transaction::eris::proto::DropTxns&>(
+      ::dsnet::transaction::eris::proto::_DropTxns_default_instance_);
+}
+inline const ::dsnet::transaction::eris::proto::DropTxns& StartViewMessage::drops() const {
+  // @@protoc_insertion_point(field_get:dsnet.transaction.eris.proto.StartViewMessage.drops)
+  return _internal_drops();
+}
+inline void StartViewMessage::unsafe_arena_set_allocated_drops(
+    ::dsnet::transaction::eris::proto::DropTxns* drops) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.drops_);
+  }
+  _impl_.drops_ = drops;
+  if (drops) {
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:dsnet.transaction.eris.proto.StartViewMessage.drops)
+}
+inline ::dsnet::transaction::eris::proto::DropTxns* StartViewMessage::release_drops() {
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  ::dsnet::transaction::eris::proto::DropTxns* temp = _impl_.drops_;
+  _impl_.drops_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::dsnet::transaction::eris::proto::DropTxns* StartViewMessage::unsafe_arena_release_drops() {
+  // @@protoc_insertion_point(field_release:dsnet.transaction.eris.proto.StartViewMessage.drops)
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  ::dsnet::transaction::eris::proto::DropTxns* temp = _impl_.drops_;
+  _impl_.drops_ = nullptr;
+  return temp;
+}
+inline ::dsnet::transaction::eris::proto::DropTxns* StartViewMessage::_internal_mutable_drops() {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  if (_impl_.drops_ == nullptr) {
+    auto* p = CreateMaybeMessage<::dsnet::transaction::eris::proto::DropTxns>(GetArenaForAllocation());
+    _impl_.drops_ = p;
+  }
+  return _impl_.drops_;
+}
+inline ::dsnet::transaction::eris::proto::DropTxns* StartViewMessage::mutable_drops() {
+  ::dsnet::transaction::eris::proto::DropTxns* _msg = _internal_mutable_drops();
+  // @@protoc_insertion_point(field_mutable:dsnet.transaction.eris.proto.StartViewMessage.drops)
+  return _msg;
+}
+inline void StartViewMessage::set_allocated_drops(::dsnet::transaction::eris::proto::DropTxns* drops) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.drops_;
+  }
+  if (drops) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(drops);
+    if (message_arena != submessage_arena) {
+      drops = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, drops, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  _impl_.drops_ = drops;
+  // @@protoc_insertion_point(field_set_allocated:dsnet.transaction.eris.proto.StartViewMessage.drops)
+}
+
+// -------------------------------------------------------------------
+
+// StateTransferRequestMessage
+
+// required .dsnet.transaction.eris.proto.ViewNum view = 1;
+inline bool StateTransferRequestMessage::_internal_has_view() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.view_ != nullptr);
+  return value;
+}
+inline bool StateTransferRequestMessage::has_view() const {
+  return _internal_has_view();
+}
+inline void StateTransferRequestMessage::clear_view() {
+  if (_impl_.view_ != nullptr) _impl_.view_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const ::dsnet::transaction::eris::proto::ViewNum& StateTransferRequestMessage::_internal_view() const {
+  const ::dsnet::transaction::eris::proto::ViewNum* p = _impl_.view_;
+  return p != nullptr ? *p : reinterpret_cast<const ::dsnet::transaction::eris::proto::ViewNum&>(
+      ::dsnet::transaction::eris::proto::_ViewNum_default_instance_);
+}
+inline const ::dsnet::transaction::eris::proto::ViewNum& StateTransferRequestMessage::view() const {
+  // @@protoc_insertion_point(field_get:dsnet.transaction.eris.proto.StateTransferRequestMessage.view)
+  return _internal_view();
+}
+inline void StateTransferRequestMessage::unsafe_arena_set_allocated_view(
+    ::dsnet::transaction::eris::proto::ViewNum* view) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.view_);
+  }
+  _impl_.view_ = view;
+  if (view) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:dsnet.transaction.eris.proto.StateTransferRequestMessage.view)
+}
+inline ::dsnet::transaction::eris::proto::ViewNum* StateTransferRequestMessage::release_view() {
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::dsnet::transaction::eris::proto::ViewNum* temp = _impl_.view_;
+  _impl_.view_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::dsnet::transaction::eris::proto::ViewNum* StateTransferRequestMessage::unsafe_arena_release_view() {
+  // @@protoc_insertion_point(field_release:dsnet.transaction.eris.proto.StateTransferRequestMessage.view)
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::dsnet::transaction::eris::proto::ViewNum* temp = _impl_.view_;
+  _impl_.view_ = nullptr;
+  return temp;
+}
+inline ::dsnet::transaction::eris::proto::ViewNum* StateTransferRequestMessage::_internal_mutable_view() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  if (_impl_.view_ == nullptr) {
+    auto* p = CreateMaybeMessage<::dsnet::transaction::eris::proto::ViewNum>(GetArenaForAllocation());
+    _impl_.view_ = p;
+  }
+  return _impl_.view_;
+}
+inline ::dsnet::transaction::eris::proto::ViewNum* StateTransferRequestMessage::mutable_view() {
+  ::dsnet::transaction::eris::proto::ViewNum* _msg = _internal_mutable_view();
+  // @@protoc_insertion_point(field_mutable:dsnet.transaction.eris.proto.StateTransferRequestMessage.view)
+  return _msg;
+}
+inline void StateTransferRequestMessage::set_allocated_view(::dsnet::transaction::eris::proto::ViewNum* view) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.view_;
+  }
+  if (view) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(view);
+    if (message_arena != submessage_arena) {
+      view = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, view, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.view_ = view;
+  // @@protoc_insertion_point(field_set_allocated:dsnet.transaction.eris.proto.StateTransferRequestMessage.view)
+}
+
+// required uint64 begin = 2;
+inline bool StateTransferRequestMessage::_internal_has_begin() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool StateTransferRequestMessage::has_begin() const {
+  return _internal_has_begin();
+}
+inline void StateTransferRequestMessage::clear_begin() {
+  _impl_.begin_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline uint64_t StateTransferRequestMessage::_internal_begin() const {
+  return _impl_.begin_;
+}
+inline uint64_t StateTransferRequestMessage::begin() const {
+  // @@protoc_insertion_point(field_get:dsnet.transaction.eris.proto.StateTransferRequestMessage.begin)
+  return _internal_begin();
+}
+inline void StateTransferRequestMessage::_internal_set_begin(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.begin_ = value;
+}
+inline void StateTransferRequestMessage::set_begin(uint64_t value) {
+  _internal_set_begin(value);
+  // @@protoc_insertion_point(field_set:dsnet.transaction.eris.proto.StateTransferRequestMessage.begin)
+}
+
+// required uint64 end = 3;
+inline bool StateTransferRequestMessage::_internal_has_end() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool StateTransferRequestMessage::has_end() const {
+  return _internal_has_end();
+}
+inline void StateTransferRequestMessage::clear_end() {
+  _impl_.end_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline uint64_t StateTransferRequestMessage::_internal_end() const {
+  return _impl_.end_;
+}
+inline uint64_t StateTransferRequestMessage::end() const {
+  // @@protoc_insertion_point(field_get:dsnet.transaction.eris.proto.StateTransferRequestMessage.end)
+  return _internal_end();
+}
+inline void StateTransferRequestMessage::_internal_set_end(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.end_ = value;
+}
+inline void StateTransferRequestMessage::set_end(uint64_t value) {
+  _internal_set_end(value);
+  // @@protoc_insertion_point(field_set:dsnet.transaction.eris.proto.StateTransferRequestMessage.end)
+}
+
+// -------------------------------------------------------------------
+
+// StateTransferReplyMessage_MsgLogEntry
+
+// required uint64 view = 1;
+inline bool StateTransferReplyMessage_MsgLogEntry::_internal_has_view() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool StateTransferReplyMessage_MsgLogEntry::has_view() const {
+  return _internal_has_view();
+}
+inline void StateTransferReplyMessage_MsgLogEntry::clear_view() {
+  _impl_.view_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline uint64_t StateTransferReplyMessage_MsgLogEntry::_internal_view() const {
+  return _impl_.view_;
+}
+inline uint64_t StateTransferReplyMessage_MsgLogEntry::view() const {
+  // @@protoc_insertion_point(field_get:dsnet.transaction.eris.proto.StateTransferReplyMessage.MsgLogEntry.view)
+  return _internal_view();
+}
+inline void StateTransferReplyMessage_MsgLogEntry::_internal_set_view(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.view_ = value;
+}
+inline void StateTransferReplyMessage_MsgLogEntry::set_view(uint64_t value) {
+  _internal_set_view(value);
+  // @@protoc_insertion_point(field_set:dsnet.transaction.eris.proto.StateTransferReplyMessage.MsgLogEntry.view)
+}
+
+// required uint64 op_num = 2;
+inline bool StateTransferReplyMessage_MsgLogEntry::_internal_has_op_num() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool StateTransferReplyMessage_MsgLogEntry::has_op_num() const {
+  return _internal_has_op_num();
+}
+inline void StateTransferReplyMessage_MsgLogEntry::clear_op_num() {
+  _impl_.op_num_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline uint64_t StateTransferReplyMessage_MsgLogEntry::_internal_op_num() const {
+  return _impl_.op_num_;
+}
+inline uint64_t StateTransferReplyMessage_MsgLogEntry::op_num() const {
+  // @@protoc_insertion_point(field_get:dsnet.transaction.eris.proto.StateTransferReplyMessage.MsgLogEntry.op_num)
+  return _internal_op_num();
+}
+inline void StateTransferReplyMessage_MsgLogEntry::_internal_set_op_num(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.op_num_ = value;
+}
+inline void StateTransferReplyMessage_MsgLogEntry::set_op_num(uint64_t value) {
+  _internal_set_op_num(value);
+  // @@protoc_insertion_point(field_set:dsnet.transaction.eris.proto.StateTransferReplyMessage.MsgLogEntry.op_num)
+}
+
+// required uint64 sess_num = 3;
+inline bool StateTransferReplyMessage_MsgLogEntry::_internal_has_sess_num() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  return value;
+}
+inline bool StateTransferReplyMessage_MsgLogEntry::has_sess_num() const {
+  return _internal_has_sess_num();
+}
+inline void StateTransferReplyMessage_MsgLogEntry::clear_sess_num() {
+  _impl_.sess_num_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000008u;
+}
+inline uint64_t StateTransferReplyMessage_MsgLogEntry::_internal_sess_num() const {
+  return _impl_.sess_num_;
+}
+inline uint64_t StateTransferReplyMessage_MsgLogEntry::sess_num() const {
+  // @@protoc_insertion_point(field_get:dsnet.transaction.eris.proto.StateTransferReplyMessage.MsgLogEntry.sess_num)
+  return _internal_sess_num();
+}
+inline void StateTransferReplyMessage_MsgLogEntry::_internal_set_sess_num(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  _impl_.sess_num_ = value;
+}
+inline void StateTransferReplyMessage_MsgLogEntry::set_sess_num(uint64_t value) {
+  _internal_set_sess_num(value);
+  // @@protoc_insertion_point(field_set:dsnet.transaction.eris.proto.StateTransferReplyMessage.MsgLogEntry.sess_num)
+}
+
+// required uint64 msg_num = 4;
+inline bool StateTransferReplyMessage_MsgLogEntry::_internal_has_msg_num() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000010u) != 0;
+  return value;
+}
+inline bool StateTransferReplyMessage_MsgLogEntry::has_msg_num() const {
+  return _internal_has_msg_num();
+}
+inline void StateTransferReplyMessage_MsgLogEntry::clear_msg_num() {
+  _impl_.msg_num_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000010u;
+}
+inline uint64_t StateTransferReplyMessage_MsgLogEntry::_internal_msg_num() const {
+  return _impl_.msg_num_;
+}
+inline uint64_t StateTransferReplyMessage_MsgLogEntry::msg_num() const {
+  // @@protoc_insertion_point(field_get:dsnet.transaction.eris.proto.StateTransferReplyMessage.MsgLogEntry.msg_num)
+  return _internal_msg_num();
+}
+inline void StateTransferReplyMessage_MsgLogEntry::_internal_set_msg_num(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000010u;
+  _impl_.msg_num_ = value;
+}
+inline void StateTransferReplyMessage_MsgLogEntry::set_msg_num(uint64_t value) {
+  _internal_set_msg_num(value);
+  // @@protoc_insertion_point(field_set:dsnet.transaction.eris.proto.StateTransferReplyMessage.MsgLogEntry.msg_num)
+}
+
+// required uint64 shard_num = 5;
+inline bool StateTransferReplyMessage_MsgLogEntry::_internal_has_shard_num() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000020u) != 0;
+  return value;
+}
+inline bool StateTransferReplyMessage_MsgLogEntry::has_shard_num() const {
+  return _internal_has_shard_num();
+}
+inline void StateTransferReplyMessage_MsgLogEntry::clear_shard_num() {
+  _impl_.shard_num_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000020u;
+}
+inline uint64_t StateTransferReplyMessage_MsgLogEntry::_internal_shard_num() const {
+  return _impl_.shard_num_;
+}
+inline uint64_t StateTransferReplyMessage_MsgLogEntry::shard_num() const {
+  // @@protoc_insertion_point(field_get:dsnet.transaction.eris.proto.StateTransferReplyMessage.MsgLogEntry.shard_num)
+  return _internal_shard_num();
+}
+inline void StateTransferReplyMessage_MsgLogEntry::_internal_set_shard_num(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000020u;
+  _impl_.shard_num_ = value;
+}
+inline void StateTransferReplyMessage_MsgLogEntry::set_shard_num(uint64_t value) {
+  _internal_set_shard_num(value);
+  // @@protoc_insertion_point(field_set:dsnet.transaction.eris.proto.StateTransferReplyMessage.MsgLogEntry.shard_num)
+}
+
+// required uint32 state = 6;
+inline bool StateTransferReplyMessage_MsgLogEntry::_internal_has_state() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000040u) != 0;
+  return value;
+}
+inline bool StateTransferReplyMessage_MsgLogEntry::has_state() const {
+  return _internal_has_state();
+}
+inline void StateTransferReplyMessage_MsgLogEntry::clear_state() {
+  _impl_.state_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000040u;
+}
+inline uint32_t StateTransferReplyMessage_MsgLogEntry::_internal_state() const {
+  return _impl_.state_;
+}
+inline uint32_t StateTransferReplyMessage_MsgLogEntry::state() const {
+  // @@protoc_insertion_point(field_get:dsnet.transaction.eris.proto.StateTransferReplyMessage.MsgLogEntry.state)
+  return _internal_state();
+}
+inline void StateTransferReplyMessage_MsgLogEntry::_internal_set_state(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000040u;
+  _impl_.state_ = value;
+}
+inline void StateTransferReplyMessage_MsgLogEntry::set_state(uint32_t value) {
+  _internal_set_state(value);
+  // @@protoc_insertion_point(field_set:dsnet.transaction.eris.proto.StateTransferReplyMessage.MsgLogEntry.state)
+}
+
+// required .dsnet.transaction.eris.proto.RequestMessage request = 7;
+inline bool StateTransferReplyMessage_MsgLogEntry::_internal_has_request() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.request_ != nullptr);
+  return value;
+}
+inline bool StateTransferReplyMessage_MsgLogEntry::has_request() const {
+  return _internal_has_request();
+}
+inline void StateTransferReplyMessage_MsgLogEntry::clear_request() {
+  if (_impl_.request_ != nullptr) _impl_.request_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const ::dsnet::transaction::eris::proto::RequestMessage& StateTransferReplyMessage_MsgLogEntry::_internal_request() const {
+  const ::dsnet::transaction::eris::proto::RequestMessage* p = _impl_.request_;
+  return p != nullptr ? *p : reinterpret_cast<const ::dsnet::transaction::eris::proto::RequestMessage&>(
+      ::dsnet::transaction::eris::proto::_RequestMessage_default_instance_);
+}
+inline const ::dsnet::transaction::eris::proto::RequestMessage& StateTransferReplyMessage_MsgLogEntry::request() const {
+  // @@protoc_insertion_point(field_get:dsnet.transaction.eris.proto.StateTransferReplyMessage.MsgLogEntry.request)
+  return _internal_request();
+}
+inline void StateTransferReplyMessage_MsgLogEntry::unsafe_arena_set_allocated_request(
+    ::dsnet::transaction::eris::proto::RequestMessage* request) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.request_);
+  }
+  _impl_.request_ = request;
+  if (request) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:dsnet.transaction.eris.proto.StateTransferReplyMessage.MsgLogEntry.request)
+}
+inline ::dsnet::transaction::eris::proto::RequestMessage* StateTransferReplyMessage_MsgLogEntry::release_request() {
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::dsnet::transaction::eris::proto::RequestMessage* temp = _impl_.request_;
+  _impl_.request_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::dsnet::transaction::eris::proto::RequestMessage* StateTransferReplyMessage_MsgLogEntry::unsafe_arena_release_request() {
+  // @@protoc_insertion_point(field_release:dsnet.transaction.eris.proto.StateTransferReplyMessage.MsgLogEntry.request)
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::dsnet::transaction::eris::proto::RequestMessage* temp = _impl_.request_;
+  _impl_.request_ = nullptr;
+  return temp;
+}
+inline ::dsnet::transaction::eris::proto::RequestMessage* StateTransferReplyMessage_MsgLogEntry::_internal_mutable_request() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  if (_impl_.request_ == nullptr) {
+    auto* p = CreateMaybeMessage<::dsnet::transaction::eris::proto::RequestMessage>(GetArenaForAllocation());
+    _impl_.request_ = p;
+  }
+  return _impl_.request_;
+}
+inline ::dsnet::transaction::eris::proto::RequestMessage* StateTransferReplyMessage_MsgLogEntry::mutable_request() {
+  ::dsnet::transaction::eris::proto::RequestMessage* _msg = _internal_mutable_request();
+  // @@protoc_insertion_point(field_mutable:dsnet.transaction.eris.proto.StateTransferReplyMessage.MsgLogEntry.request)
+  return _msg;
+}
+inline void StateTransferReplyMessage_MsgLogEntry::set_allocated_request(::dsnet::transaction::eris::proto::RequestMessage* request) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.request_;
+  }
+  if (request) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(request);
+    if (message_arena != submessage_arena) {
+      request = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, request, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.request_ = request;
+  // @@protoc_insertion_point(field_set_allocated:dsnet.transaction.eris.proto.StateTransferReplyMessage.MsgLogEntry.request)
+}
+
+// -------------------------------------------------------------------
+
+// StateTransferReplyMessage
+
+// required .dsnet.transaction.eris.proto.ViewNum view = 1;
+inline bool StateTransferReplyMessage::_internal_has_view() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.view_ != nullptr);
+  return value;
+}
+inline bool StateTransferReplyMessage::has_view() const {
+  return _internal_has_view();
+}
+inline void StateTransferReplyMessage::clear_view() {
+  if (_impl_.view_ != nullptr) _impl_.view_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const ::dsnet::transaction::eris::proto::ViewNum& StateTransferReplyMessage::_internal_view() const {
+  const ::dsnet::transaction::eris::proto::ViewNum* p = _impl_.view_;
+  return p != nullptr ? *p : reinterpret_cast<const ::dsnet::transaction::eris::proto::ViewNum&>(
+      ::dsnet::transaction::eris::proto::_ViewNum_default_instance_);
+}
+inline const ::dsnet::transaction::eris::proto::ViewNum& StateTransferReplyMessage::view() const {
+  // @@protoc_insertion_point(field_get:dsnet.transaction.eris.proto.StateTransferReplyMessage.view)
+  return _internal_view();
+}
+inline void StateTransferReplyMessage::unsafe_arena_set_allocated_view(
+    ::dsnet::transaction::eris::proto::ViewNum* view) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.view_);
+  }
+  _impl_.view_ = view;
+  if (view) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:dsnet.transaction.eris.proto.StateTransferReplyMessage.view)
+}
+inline ::dsnet::transaction::eris::proto::ViewNum* StateTransferReplyMessage::release_view() {
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::dsnet::transaction::eris::proto::ViewNum* temp = _impl_.view_;
+  _impl_.view_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::dsnet::transaction::eris::proto::ViewNum* StateTransferReplyMessage::unsafe_arena_release_view() {
+  // @@protoc_insertion_point(field_release:dsnet.transaction.eris.proto.StateTransferReplyMessage.view)
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::dsnet::transaction::eris::proto::ViewNum* temp = _impl_.view_;
+  _impl_.view_ = nullptr;
+  return temp;
+}
+inline ::dsnet::transaction::eris::proto::ViewNum* StateTransferReplyMessage::_internal_mutable_view() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  if (_impl_.view_ == nullptr) {
+    auto* p = CreateMaybeMessage<::dsnet::transaction::eris::proto::ViewNum>(GetArenaForAllocation());
+    _impl_.view_ = p;
+  }
+  return _impl_.view_;
+}
+inline ::dsnet::transaction::eris::proto::ViewNum* StateTransferReplyMessage::mutable_view() {
+  ::dsnet::transaction::eris::proto::ViewNum* _msg = _internal_mutable_view();
+  // @@protoc_insertion_point(field_mutable:dsnet.transaction.eris.proto.StateTransferReplyMessage.view)
+  return _msg;
+}
+inline void StateTransferReplyMessage::set_allocated_view(::dsnet::transaction::eris::proto::ViewNum* view) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.view_;
+  }
+  if (view) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(view);
+    if (message_arena != submessage_arena) {
+      view = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, view, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.view_ = view;
+  // @@protoc_insertion_point(field_set_allocated:dsnet.transaction.eris.proto.StateTransferReplyMessage.view)
+}
+
+// required uint64 begin = 2;
+inline bool StateTransferReplyMessage::_internal_has_begin() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool StateTransferReplyMessage::has_begin() const {
+  return _internal_has_begin();
+}
+inline void StateTransferReplyMessage::clear_begin() {
+  _impl_.begin_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline uint64_t StateTransferReplyMessage::_internal_begin() const {
+  return _impl_.begin_;
+}
+inline uint64_t StateTransferReplyMessage::begin() const {
+  // @@protoc_insertion_point(field_get:dsnet.transaction.eris.proto.StateTransferReplyMessage.begin)
+  return _internal_begin();
+}
+inline void StateTransferReplyMessage::_internal_set_begin(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.begin_ = value;
+}
+inline void StateTransferReplyMessage::set_begin(uint64_t value) {
+  _internal_set_begin(value);
+  // @@protoc_insertion_point(field_set:dsnet.transaction.eris.proto.StateTransferReplyMessage.begin)
+}
+
+// required uint64 end = 3;
+inline bool StateTransferReplyMessage::_internal_has_end() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool StateTransferReplyMessage::has_end() const {
+  return _internal_has_end();
+}
+inline void StateTransferReplyMessage::clear_end() {
+  _impl_.end_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline uint64_t StateTransferReplyMessage::_internal_end() const {
+  return _impl_.end_;
+}
+inline uint64_t StateTransferReplyMessage::end() const {
+  // @@protoc_insertion_point(field_get:dsnet.transaction.eris.proto.StateTransferReplyMessage.end)
+  return _internal_end();
+}
+inline void StateTransferReplyMessage::_internal_set_end(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.end_ = value;
+}
+inline void StateTransferReplyMessage::set_end(uint64_t value) {
+  _internal_set_end(value);
+  // @@protoc_insertion_point(field_set:dsnet.transaction.eris.proto.StateTransferReplyMessage.end)
+}
+
+// repeated .dsnet.transaction.eris.proto.StateTransferReplyMessage.MsgLogEntry entries = 4;
+inline int StateTransferReplyMessage::_internal_entries_size() const {
+  return _impl_.entries_.size();
+}
+inline int StateTransferReplyMessage::entries_size() const {
+  return _internal_entries_size();
+}
+inline void StateTransferReplyMessage::clear_entries() {
+  _impl_.entries_.Clear();
+}
+inline ::dsnet::transaction::eris::proto::StateTransferReplyMessage_MsgLogEntry* StateTransferReplyMessage::mutable_entries(int index) {
+  // @@protoc_insertion_point(field_mutable:dsnet.transaction.eris.proto.StateTransferReplyMessage.entries)
+  return _impl_.entries_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::dsnet::transaction::eris::proto::StateTransferReplyMessage_MsgLogEntry >*
+StateTransferReplyMessage::mutable_entries() {
+  // @@protoc_insertion_point(field_mutable_list:dsnet.transaction.eris.proto.StateTransferReplyMessage.entries)
+  return &_impl_.entries_;
+}
+inline const ::dsnet::transaction::eris::proto::StateTransferReplyMessage_MsgLogEntry& StateTransferReplyMessage::_internal_entries(int index) const {
+  return _impl_.entries_.Get(index);
+}
+inline const ::dsnet::transaction::eris::proto::StateTransferReplyMessage_MsgLogEntry& StateTransferReplyMessage::entries(int index) const {
+  // @@protoc_insertion_point(field_get:dsnet.transaction.eris.proto.StateTransferReplyMessage.entries)
+  return _internal_entries(index);
+}
+inline ::dsnet::transaction::eris::proto::StateTransferReplyMessage_MsgLogEntry* StateTransferReplyMessage::_internal_add_entries() {
+  return _impl_.entries_.Add();
+}
+inline ::dsnet::transaction::eris::proto::StateTransferReplyMessage_MsgLogEntry* StateTransferReplyMessage::add_entries() {
+  ::dsnet::transaction::eris::proto::StateTransferReplyMessage_MsgLogEntry* _add = _internal_add_entries();
+  // @@protoc_insertion_point(field_add:dsnet.transaction.eris.proto.StateTransferReplyMessage.entries)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::dsnet::transaction::eris::proto::StateTransferReplyMessage_MsgLogEntry >&
+StateTransferReplyMessage::entries() const {
+  // @@protoc_insertion_point(field_list:dsnet.transaction.eris.proto.StateTransferReplyMessage.entries)
+  return _impl_.entries_;
+}
+
+// -------------------------------------------------------------------
+
+// EpochChangeStateTransferRequest
+
+// required uint64 sess_num = 1;
+inline bool EpochChangeStateTransferRequest::_internal_has_sess_num() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool EpochChangeStateTransferRequest::has_sess_num() const {
+  return _internal_has_sess_num();
+}
+inline void EpochChangeStateTransferRequest::clear_sess_num() {
+  _impl_.sess_num_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline uint64_t EpochChangeStateTransferRequest::_internal_sess_num() const {
+  return _impl_.sess_num_;
+}
+inline uint64_t EpochChangeStateTransferRequest::sess_num() const {
+  // @@protoc_insertion_point(field_get:dsnet.transaction.eris.proto.EpochChangeStateTransferRequest.sess_num)
+  return _internal_sess_num();
+}
+inline void EpochChangeStateTransferRequest::_internal_set_sess_num(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.sess_num_ = value;
+}
+inline void EpochChangeStateTransferRequest::set_sess_num(uint64_t value) {
+  _internal_set_sess_num(value);
+  // @@protoc_insertion_point(field_set:dsnet.transaction.eris.proto.EpochChangeStateTransferRequest.sess_num)
+}
+
+// required uint64 state_transfer_sess_num = 2;
+inline bool EpochChangeStateTransferRequest::_internal_has_state_transfer_sess_num() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool EpochChangeStateTransferRequest::has_state_transfer_sess_num() const {
+  return _internal_has_state_transfer_sess_num();
+}
+inline void EpochChangeStateTransferRequest::clear_state_transfer_sess_num() {
+  _impl_.state_transfer_sess_num_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline uint64_t EpochChangeStateTransferRequest::_internal_state_transfer_sess_num() const {
+  return _impl_.state_transfer_sess_num_;
+}
+inline uint64_t EpochChangeStateTransferRequest::state_transfer_sess_num() const {
+  // @@protoc_insertion_point(field_get:dsnet.transaction.eris.proto.EpochChangeStateTransferRequest.state_transfer_sess_num)
+  return _internal_state_transfer_sess_num();
+}
+inline void EpochChangeStateTransferRequest::_internal_set_state_transfer_sess_num(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.state_transfer_sess_num_ = value;
+}
+inline void EpochChangeStateTransferRequest::set_state_transfer_sess_num(uint64_t value) {
+  _internal_set_state_transfer_sess_num(value);
+  // @@protoc_insertion_point(field_set:dsnet.transaction.eris.proto.EpochChangeStateTransferRequest.state_transfer_sess_num)
+}
+
+// required uint32 shard_num = 3;
+inline bool EpochChangeStateTransferRequest::_internal_has_shard_num() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000010u) != 0;
+  return value;
+}
+inline bool EpochChangeStateTransferRequest::has_shard_num() const {
+  return _internal_has_shard_num();
+}
+inline void EpochChangeStateTransferRequest::clear_shard_num() {
+  _impl_.shard_num_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000010u;
+}
+inline uint32_t EpochChangeStateTransferRequest::_internal_shard_num() const {
+  return _impl_.shard_num_;
+}
+inline uint32_t EpochChangeStateTransferRequest::shard_num() const {
+  // @@protoc_insertion_point(field_get:dsnet.transaction.eris.proto.EpochChangeStateTransferRequest.shard_num)
+  return _internal_shard_num();
+}
+inline void EpochChangeStateTransferRequest::_internal_set_shard_num(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000010u;
+  _impl_.shard_num_ = value;
+}
+inline void EpochChangeStateTransferRequest::set_shard_num(uint32_t value) {
+  _internal_set_shard_num(value);
+  // @@protoc_insertion_point(field_set:dsnet.transaction.eris.proto.EpochChangeStateTransferRequest.shard_num)
+}
+
+// required uint64 begin = 4;
+inline bool EpochChangeStateTransferRequest::_internal_has_begin() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool EpochChangeStateTransferRequest::has_begin() const {
+  return _internal_has_begin();
+}
+inline void EpochChangeStateTransferRequest::clear_begin() {
+  _impl_.begin_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline uint64_t EpochChangeStateTransferRequest::_internal_begin() const {
+  return _impl_.begin_;
+}
+inline uint64_t EpochChangeStateTransferRequest::begin() const {
+  // @@protoc_insertion_point(field_get:dsnet.transaction.eris.proto.EpochChangeStateTransferRequest.begin)
+  return _internal_begin();
+}
+inline void EpochChangeStateTransferRequest::_internal_set_begin(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.begin_ = value;
+}
+inline void EpochChangeStateTransferRequest::set_begin(uint64_t value) {
+  _internal_set_begin(value);
+  // @@protoc_insertion_point(field_set:dsnet.transaction.eris.proto.EpochChangeStateTransferRequest.begin)
+}
+
+// required uint64 end = 5;
+inline bool EpochChangeStateTransferRequest::_internal_has_end() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  return value;
+}
+inline bool EpochChangeStateTransferRequest::has_end() const {
+  return _internal_has_end();
+}
+inline void EpochChangeStateTransferRequest::clear_end() {
+  _impl_.end_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000008u;
+}
+inline uint64_t EpochChangeStateTransferRequest::_internal_end() const {
+  return _impl_.end_;
+}
+inline uint64_t EpochChangeStateTransferRequest::end() const {
+  // @@protoc_insertion_point(field_get:dsnet.transaction.eris.proto.EpochChangeStateTransferRequest.end)
+  return _internal_end();
+}
+inline void EpochChangeStateTransferRequest::_internal_set_end(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  _impl_.end_ = value;
+}
+inline void EpochChangeStateTransferRequest::set_end(uint64_t value) {
+  _internal_set_end(value);
+  // @@protoc_insertion_point(field_set:dsnet.transaction.eris.proto.EpochChangeStateTransferRequest.end)
+}
+
+// -------------------------------------------------------------------
+
+// EpochChangeStateTransferReply_MsgEntry
+
+// required uint64 msg_num = 1;
+inline bool EpochChangeStateTransferReply_MsgEntry::_internal_has_msg_num() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool EpochChangeStateTransferReply_MsgEntry::has_msg_num() const {
+  return _internal_has_msg_num();
+}
+inline void EpochChangeStateTransferReply_MsgEntry::clear_msg_num() {
+  _impl_.msg_num_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline uint64_t EpochChangeStateTransferReply_MsgEntry::_internal_msg_num() const {
+  return _impl_.msg_num_;
+}
+inline uint64_t EpochChangeStateTransferReply_MsgEntry::msg_num() const {
+  // @@protoc_insertion_point(field_get:dsnet.transaction.eris.proto.EpochChangeStateTransferReply.MsgEntry.msg_num)
+  return _internal_msg_num();
+}
+inline void EpochChangeStateTransferReply_MsgEntry::_internal_set_msg_num(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.msg_num_ = value;
+}
+inline void EpochChangeStateTransferReply_MsgEntry::set_msg_num(uint64_t value) {
+  _internal_set_msg_num(value);
+  // @@protoc_insertion_point(field_set:dsnet.transaction.eris.proto.EpochChangeStateTransferReply.MsgEntry.msg_num)
+}
+
+// required .dsnet.transaction.eris.proto.RequestMessage request = 2;
+inline bool EpochChangeStateTransferReply_MsgEntry::_internal_has_request() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.request_ != nullptr);
+  return value;
+}
+inline bool EpochChangeStateTransferReply_MsgEntry::has_request() const {
+  return _internal_has_request();
+}
+inline void EpochChangeStateTransferReply_MsgEntry::clear_request() {
+  if (_impl_.request_ != nullptr) _impl_.request_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const ::dsnet::transaction::eris::proto::RequestMessage& EpochChangeStateTransferReply_MsgEntry::_internal_request() const {
+  const ::dsnet::transaction::eris::proto::RequestMessage* p = _impl_.request_;
+  return p != nullptr ? *p : reinterpret_cast<const ::dsnet::transaction::eris::proto::RequestMessage&>(
+      ::dsnet::transaction::eris::proto::_RequestMessage_default_instance_);
+}
+inline const ::dsnet::transaction::eris::proto::RequestMessage& EpochChangeStateTransferReply_MsgEntry::request() const {
+  // @@protoc_insertion_point(field_get:dsnet.transaction.eris.proto.EpochChangeStateTransferReply.MsgEntry.request)
+  return _internal_request();
+}
+inline void EpochChangeStateTransferReply_MsgEntry::unsafe_arena_set_allocated_request(
+    ::dsnet::transaction::eris::proto::RequestMessage* request) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.request_);
+  }
+  _impl_.request_ = request;
+  if (request) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:dsnet.transaction.eris.proto.EpochChangeStateTransferReply.MsgEntry.request)
+}
+inline ::dsnet::transaction::eris::proto::RequestMessage* EpochChangeStateTransferReply_MsgEntry::release_request() {
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::dsnet::transaction::eris::proto::RequestMessage* temp = _impl_.request_;
+  _impl_.request_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::dsnet::transaction::eris::proto::RequestMessage* EpochChangeStateTransferReply_MsgEntry::unsafe_arena_release_request() {
+  // @@protoc_insertion_point(field_release:dsnet.transaction.eris.proto.EpochChangeStateTransferReply.MsgEntry.request)
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::dsnet::transaction::eris::proto::RequestMessage* temp = _impl_.request_;
+  _impl_.request_ = nullptr;
+  return temp;
+}
+inline ::dsnet::transaction::eris::proto::RequestMessage* EpochChangeStateTransferReply_MsgEntry::_internal_mutable_request() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  if (_impl_.request_ == nullptr) {
+    auto* p = CreateMaybeMessage<::dsnet::transaction::eris::proto::RequestMessage>(GetArenaForAllocation());
+    _impl_.request_ = p;
+  }
+  return _impl_.request_;
+}
+inline ::dsnet::transaction::eris::proto::RequestMessage* EpochChangeStateTransferReply_MsgEntry::mutable_request() {
+  ::dsnet::transaction::eris::proto::RequestMessage* _msg = _internal_mutable_request();
+  // @@protoc_insertion_point(field_mutable:dsnet.transaction.eris.proto.EpochChangeStateTransferReply.MsgEntry.request)
+  return _msg;
+}
+inline void EpochChangeStateTransferReply_MsgEntry::set_allocated_request(::dsnet::transaction::eris::proto::RequestMessage* request) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.request_;
+  }
+  if (request) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(request);
+    if (message_arena != submessage_arena) {
+      request = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, request, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.request_ = request;
+  // @@protoc_insertion_point(field_set_allocated:dsnet.transaction.eris.proto.EpochChangeStateTransferReply.MsgEntry.request)
+}
+
+// -------------------------------------------------------------------
+
+// EpochChangeStateTransferReply
+
+// required uint64 sess_num = 1;
+inline bool EpochChangeStateTransferReply::_internal_has_sess_num() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool EpochChangeStateTransferReply::has_sess_num() const {
+  return _internal_has_sess_num();
+}
+inline void EpochChangeStateTransferReply::clear_sess_num() {
+  _impl_.sess_num_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline uint64_t EpochChangeStateTransferReply::_internal_sess_num() const {
+  return _impl_.sess_num_;
+}
+inline uint64_t EpochChangeStateTransferReply::sess_num() const {
+  // @@protoc_insertion_point(field_get:dsnet.transaction.eris.proto.EpochChangeStateTransferReply.sess_num)
+  return _internal_sess_num();
+}
+inline void EpochChangeStateTransferReply::_internal_set_sess_num(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.sess_num_ = value;
+}
+inline void EpochChangeStateTransferReply::set_sess_num(uint64_t value) {
+  _internal_set_sess_num(value);
+  // @@protoc_insertion_point(field_set:dsnet.transaction.eris.proto.EpochChangeStateTransferReply.sess_num)
+}
+
+// required uint64 state_transfer_sess_num = 2;
+inline bool EpochChangeStateTransferReply::_internal_has_state_transfer_sess_num() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool EpochChangeStateTransferReply::has_state_transfer_sess_num() const {
+  return _internal_has_state_transfer_sess_num();
+}
+inline void EpochChangeStateTransferReply::clear_state_transfer_sess_num() {
+  _impl_.state_transfer_sess_num_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline uint64_t EpochChangeStateTransferReply::_internal_state_transfer_sess_num() const {
+  return _impl_.state_transfer_sess_num_;
+}
+inline uint64_t EpochChangeStateTransferReply::state_transfer_sess_num() const {
+  // @@protoc_insertion_point(field_get:dsnet.transaction.eris.proto.EpochChangeStateTransferReply.state_transfer_sess_num)
+  return _internal_state_transfer_sess_num();
+}
+inline void EpochChangeStateTransferReply::_internal_set_state_transfer_sess_num(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.state_transfer_sess_num_ = value;
+}
+inline void EpochChangeStateTransferReply::set_state_transfer_sess_num(uint64_t value) {
+  _internal_set_state_transfer_sess_num(value);
+  // @@protoc_insertion_point(field_set:dsnet.transaction.eris.proto.EpochChangeStateTransferReply.state_transfer_sess_num)
+}
+
+// required uint32 shard_num = 3;
+inline bool EpochChangeStateTransferReply::_internal_has_shard_num() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool EpochChangeStateTransferReply::has_shard_num() const {
+  return _internal_has_shard_num();
+}
+inline void EpochChangeStateTransferReply::clear_shard_num() {
+  _impl_.shard_num_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline uint32_t EpochChangeStateTransferReply::_internal_shard_num() const {
+  return _impl_.shard_num_;
+}
+inline uint32_t EpochChangeStateTransferReply::shard_num() const {
+  // @@protoc_insertion_point(field_get:dsnet.transaction.eris.proto.EpochChangeStateTransferReply.shard_num)
+  return _internal_shard_num();
+}
+inline void EpochChangeStateTransferReply::_internal_set_shard_num(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.shard_num_ = value;
+}
+inline void EpochChangeStateTransferReply::set_shard_num(uint32_t value) {
+  _internal_set_shard_num(value);
+  // @@protoc_insertion_point(field_set:dsnet.transaction.eris.proto.EpochChangeStateTransferReply.shard_num)
+}
+
+// repeated .dsnet.transaction.eris.proto.EpochChangeStateTransferReply.MsgEntry entries = 4;
+inline int EpochChangeStateTransferReply::_internal_entries_size() const {
+  return _impl_.entries_.size();
+}
+inline int EpochChangeStateTransferReply::entries_size() const {
+  return _internal_entries_size();
+}
+inline void EpochChangeStateTransferReply::clear_entries() {
+  _impl_.entries_.Clear();
+}
+inline ::dsnet::transaction::eris::proto::EpochChangeStateTransferReply_MsgEntry* EpochChangeStateTransferReply::mutable_entries(int index) {
+  // @@protoc_insertion_point(field_mutable:dsnet.transaction.eris.proto.EpochChangeStateTransferReply.entries)
+  return _impl_.entries_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::dsnet::transaction::eris::proto::EpochChangeStateTransferReply_MsgEntry >*
+EpochChangeStateTransferReply::mutable_entries() {
+  // @@protoc_insertion_point(field_mutable_list:dsnet.transaction.eris.proto.EpochChangeStateTransferReply.entries)
+  return &_impl_.entries_;
+}
+inline const ::dsnet::transaction::eris::proto::EpochChangeStateTransferReply_MsgEntry& EpochChangeStateTransferReply::_internal_entries(int index) const {
+  return _impl_.entries_.Get(index);
+}
+inline const ::dsnet::transaction::eris::proto::EpochChangeStateTransferReply_MsgEntry& EpochChangeStateTransferReply::entries(int index) const {
+  // @@protoc_insertion_point(field_get:dsnet.transaction.eris.proto.EpochChangeStateTransferReply.entries)
+  return _internal_entries(index);
+}
+inline ::dsnet::transaction::eris::proto::EpochChangeStateTransferReply_MsgEntry* EpochChangeStateTransferReply::_internal_add_entries() {
+  return _impl_.entries_.Add();
+}
+inline ::dsnet::transaction::eris::proto::EpochChangeStateTransferReply_MsgEntry* EpochChangeStateTransferReply::add_entries() {
+  ::dsnet::transaction::eris::proto::EpochChangeStateTransferReply_MsgEntry* _add = _internal_add_entries();
+  // @@protoc_insertion_point(field_add:dsnet.transaction.eris.proto.EpochChangeStateTransferReply.entries)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::dsnet::transaction::eris::proto::EpochChangeStateTransferReply_MsgEntry >&
+EpochChangeStateTransferReply::entries() const {
+  // @@protoc_insertion_point(field_list:dsnet.transaction.eris.proto.EpochChangeStateTransferReply.entries)
+  return _impl_.entries_;
+}
+
+// -------------------------------------------------------------------
+
+// ToServerMessage
+
+// .dsnet.transaction.eris.proto.RequestMessage request = 1;
+inline bool ToServerMessage::_internal_has_request() const {
+  return msg_case() == kRequest;
+}
+inline bool ToServerMessage::has_request() const {
+  return _internal_has_request();
+}
+inline void ToServerMessage::set_has_request() {
+  _impl_._oneof_case_[0] = kRequest;
+}
+inline void ToServerMessage::clear_request() {
+  if (_internal_has_request()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.msg_.request_;
+    }
+    clear_has_msg();
+  }
+}
+inline ::dsnet::transaction::eris::proto::RequestMessage* ToServerMessage::release_request() {
+  // @@protoc_insertion_point(field_release:dsnet.transaction.eris.proto.ToServerMessage.request)
+  if (_internal_has_request()) {
+    clear_has_msg();
+    ::dsnet::transaction::eris::proto::RequestMessage* temp = _impl_.msg_.request_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.msg_.request_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::dsnet::transaction::eris::proto::RequestMessage& ToServerMessage::_internal_request() const {
+  return _internal_has_request()
+      ? *_impl_.msg_.request_
+      : reinterpret_cast< ::dsnet::transaction::eris::proto::RequestMessage&>(::dsnet::transaction::eris::proto::_RequestMessage_default_instance_);
+}
+inline const ::dsnet::transaction::eris::proto::RequestMessage& ToServerMessage::request() const {
+  // @@protoc_insertion_point(field_get:dsnet.transaction.eris.proto.ToServerMessage.request)
+  return _internal_request();
+}
+inline ::dsnet::transaction::eris::proto::RequestMessage* ToServerMessage::unsafe_arena_release_request() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:dsnet.transaction.eris.proto.ToServerMessage.request)
+  if (_internal_has_request()) {
+    clear_has_msg();
+    ::dsnet::transaction::eris::proto::RequestMessage* temp = _impl_.msg_.request_;
+    _impl_.msg_.request_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void ToServerMessage::unsafe_arena_set_allocated_request(::dsnet::transaction::eris::proto::RequestMessage* request) {
+  clear_msg();
+  if (request) {
+    set_has_request();
+    _impl_.msg_.request_ = request;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:dsnet.transaction.eris.proto.ToServerMessage.request)
+}
+inline ::dsnet::transaction::eris::proto::RequestMessage* ToServerMessage::_internal_mutable_request() {
+  if (!_internal_has_request()) {
+    clear_msg();
+    set_has_request();
+    _impl_.msg_.request_ = CreateMaybeMessage< ::dsnet::transaction::eris::proto::RequestMessage >(GetArenaForAllocation());
+  }
+  return _impl_.msg_.request_;
+}
+inline ::dsnet::transaction::eris::proto::RequestMessage* ToServerMessage::mutable_request() {
+  ::dsnet::transaction::eris::proto::RequestMessage* _msg = _internal_mutable_request();
+  // @@protoc_insertion_point(field_mutable:dsnet.transaction.eris.proto.ToServerMessage.request)
+  return _msg;
+}
+
+// .dsnet.transaction.eris.proto.GapRequestMessage gap_request = 2;
+inline bool ToServerMessage::_internal_has_gap_request() const {
+  return msg_case() == kGapRequest;
+}
+inline bool ToServerMessage::has_gap_request() const {
+  return _internal_has_gap_request();
+}
+inline void ToServerMessage::set_has_gap_request() {
+  _impl_._oneof_case_[0] = kGapRequest;
+}
+inline void ToServerMessage::clear_gap_request() {
+  if (_internal_has_gap_request()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.msg_.gap_request_;
+    }
+    clear_has_msg();
+  }
+}
+inline ::dsnet::transaction::eris::proto::GapRequestMessage* ToServerMessage::release_gap_request() {
+  // @@protoc_insertion_point(field_release:dsnet.transaction.eris.proto.ToServerMessage.gap_request)
+  if (_internal_has_gap_request()) {
+    clear_has_msg();
+    ::dsnet::transaction::eris::proto::GapRequestMessage* temp = _impl_.msg_.gap_request_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.msg_.gap_request_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::dsnet::transaction::eris::proto::GapRequestMessage& ToServerMessage::_internal_gap_request() const {
+  return _internal_has_gap_request()
+      ? *_impl_.msg_.gap_request_
+      : reinterpret_cast< ::dsnet::transaction::eris::proto::GapRequestMessage&>(::dsnet::transaction::eris::proto::_GapRequestMessage_default_instance_);
+}
+inline const ::dsnet::transaction::eris::proto::GapRequestMessage& ToServerMessage::gap_request() const {
+  // @@protoc_insertion_point(field_get:dsnet.transaction.eris.proto.ToServerMessage.gap_request)
+  return _internal_gap_request();
+}
+inline ::dsnet::transaction::eris::proto::GapRequestMessage* ToServerMessage::unsafe_arena_release_gap_request() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:dsnet.transaction.eris.proto.ToServerMessage.gap_request)
+  if (_internal_has_gap_request()) {
+    clear_has_msg();
+    ::dsnet::transaction::eris::proto::GapRequestMessage* temp = _impl_.msg_.gap_request_;
+    _impl_.msg_.gap_request_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void ToServerMessage::unsafe_arena_set_allocated_gap_request(::dsnet::transaction::eris::proto::GapRequestMessage* gap_request) {
+  clear_msg();
+  if (gap_request) {
+    set_has_gap_request();
+    _impl_.msg_.gap_request_ = gap_request;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:dsnet.transaction.eris.proto.ToServerMessage.gap_request)
+}
+inline ::dsnet::transaction::eris::proto::GapRequestMessage* ToServerMessage::_internal_mutable_gap_request() {
+  if (!_internal_has_gap_request()) {
+    clear_msg();
+    set_has_gap_request();
+    _impl_.msg_.gap_request_ = CreateMaybeMessage< ::dsnet::transaction::eris::proto::GapRequestMessage >(GetArenaForAllocation());
+  }
+  return _impl_.msg_.gap_request_;
+}
+inline ::dsnet::transaction::eris::proto::GapRequestMessage* ToServerMessage::mutable_gap_request() {
+  ::dsnet::transaction::eris::proto::GapRequestMessage* _msg = _internal_mutable_gap_request();
+  // @@protoc_insertion_point(field_mutable:dsnet.transaction.eris.proto.ToServerMessage.gap_request)
+  return _msg;
+}
+
+// .dsnet.transaction.eris.proto.GapReplyMessage gap_reply = 3;
+inline bool ToServerMessage::_internal_has_gap_reply() const {
+  return msg_case() == kGapReply;
+}
+inline bool ToServerMessage::has_gap_reply() const {
+  return _internal_has_gap_reply();
+}
+inline void ToServerMessage::set_has_gap_reply() {
+  _impl_._oneof_case_[0] = kGapReply;
+}
+inline void ToServerMessage::clear_gap_reply() {
+  if (_internal_has_gap_reply()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.msg_.gap_reply_;
+    }
+    clear_has_msg();
+  }
+}
+inline ::dsnet::transaction::eris::proto::GapReplyMessage* ToServerMessage::release_gap_reply() {
+  // @@protoc_insertion_point(field_release:dsnet.transaction.eris.proto.ToServerMessage.gap_reply)
+  if (_internal_has_gap_reply()) {
+    clear_has_msg();
+    ::dsnet::transaction::eris::proto::GapReplyMessage* temp = _impl_.msg_.gap_reply_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.msg_.gap_reply_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::dsnet::transaction::eris::proto::GapReplyMessage& ToServerMessage::_internal_gap_reply() const {
+  return _internal_has_gap_reply()
+      ? *_impl_.msg_.gap_reply_
+      : reinterpret_cast< ::dsnet::transaction::eris::proto::GapReplyMessage&>(::dsnet::transaction::eris::proto::_GapReplyMessage_default_instance_);
+}
+inline const ::dsnet::transaction::eris::proto::GapReplyMessage& ToServerMessage::gap_reply() const {
+  // @@protoc_insertion_point(field_get:dsnet.transaction.eris.proto.ToServerMessage.gap_reply)
+  return _internal_gap_reply();
+}
+inline ::dsnet::transaction::eris::proto::GapReplyMessage* ToServerMessage::unsafe_arena_release_gap_reply() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:dsnet.transaction.eris.proto.ToServerMessage.gap_reply)
+  if (_internal_has_gap_reply()) {
+    clear_has_msg();
+    ::dsnet::transaction::eris::proto::GapReplyMessage* temp = _impl_.msg_.gap_reply_;
+    _impl_.msg_.gap_reply_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void ToServerMessage::unsafe_arena_set_allocated_gap_reply(::dsnet::transaction::eris::proto::GapReplyMessage* gap_reply) {
+  clear_msg();
+  if (gap_reply) {
+    set_has_gap_reply();
+    _impl_.msg_.gap_reply_ = gap_reply;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:dsnet.transaction.eris.proto.ToServerMessage.gap_reply)
+}
+inline ::dsnet::transaction::eris::proto::GapReplyMessage* ToServerMessage::_internal_mutable_gap_reply() {
+  if (!_internal_has_gap_reply()) {
+    clear_msg();
+    set_has_gap_reply();
+    _impl_.msg_.gap_reply_ = CreateMaybeMessage< ::dsnet::transaction::eris::proto::GapReplyMessage >(GetArenaForAllocation());
+  }
+  return _impl_.msg_.gap_reply_;
+}
+inline ::dsnet::transaction::eris::proto::GapReplyMessage* ToServerMessage::mutable_gap_reply() {
+  ::dsnet::transaction::eris::proto::GapReplyMessage* _msg = _internal_mutable_gap_reply();
+  // @@protoc_insertion_point(field_mutable:dsnet.transaction.eris.proto.ToServerMessage.gap_reply)
+  return _msg;
+}
+
+// .dsnet.transaction.eris.proto.FCToErisMessage fc = 4;
+inline bool ToServerMessage::_internal_has_fc() const {
+  return msg_case() == kFc;
+}
+inline bool ToServerMessage::has_fc() const {
+  return _internal_has_fc();
+}
+inline void ToServerMessage::set_has_fc() {
+  _impl_._oneof_case_[0] = kFc;
+}
+inline void ToServerMessage::clear_fc() {
+  if (_internal_has_fc()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.msg_.fc_;
+    }
+    clear_has_msg();
+  }
+}
+inline ::dsnet::transaction::eris::proto::FCToErisMessage* ToServerMessage::release_fc() {
+  // @@protoc_insertion_point(field_release:dsnet.transaction.eris.proto.ToServerMessage.fc)
+  if (_internal_has_fc()) {
+    clear_has_msg();
+    ::dsnet::transaction::eris::proto::FCToErisMessage* temp = _impl_.msg_.fc_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.msg_.fc_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::dsnet::transaction::eris::proto::FCToErisMessage& ToServerMessage::_internal_fc() const {
+  return _internal_has_fc()
+      ? *_impl_.msg_.fc_
+      : reinterpret_cast< ::dsnet::transaction::eris::proto::FCToErisMessage&>(::dsnet::transaction::eris::proto::_FCToErisMessage_default_instance_);
+}
+inline const ::dsnet::transaction::eris::proto::FCToErisMessage& ToServerMessage::fc() const {
+  // @@protoc_insertion_point(field_get:dsnet.transaction.eris.proto.ToServerMessage.fc)
+  return _internal_fc();
+}
+inline ::dsnet::transaction::eris::proto::FCToErisMessage* ToServerMessage::unsafe_arena_release_fc() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:dsnet.transaction.eris.proto.ToServerMessage.fc)
+  if (_internal_has_fc()) {
+    clear_has_msg();
+    ::dsnet::transaction::eris::proto::FCToErisMessage* temp = _impl_.msg_.fc_;
+    _impl_.msg_.fc_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void ToServerMessage::unsafe_arena_set_allocated_fc(::dsnet::transaction::eris::proto::FCToErisMessage* fc) {
+  clear_msg();
+  if (fc) {
+    set_has_fc();
+    _impl_.msg_.fc_ = fc;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:dsnet.transaction.eris.proto.ToServerMessage.fc)
+}
+inline ::dsnet::transaction::eris::proto::FCToErisMessage* ToServerMessage::_internal_mutable_fc() {
+  if (!_internal_has_fc()) {
+    clear_msg();
+    set_has_fc();
+    _impl_.msg_.fc_ = CreateMaybeMessage< ::dsnet::transaction::eris::proto::FCToErisMessage >(GetArenaForAllocation());
+  }
+  return _impl_.msg_.fc_;
+}
+inline ::dsnet::transaction::eris::proto::FCToErisMessage* ToServerMessage::mutable_fc() {
+  ::dsnet::transaction::eris::proto::FCToErisMessage* _msg = _internal_mutable_fc();
+  // @@protoc_insertion_point(field_mutable:dsnet.transaction.eris.proto.ToServerMessage.fc)
+  return _msg;
+}
+
+// .dsnet.transaction.eris.proto.SyncPrepareMessage sync_prepare = 5;
+inline bool ToServerMessage::_internal_has_sync_prepare() const {
+  return msg_case() == kSyncPrepare;
+}
+inline bool ToServerMessage::has_sync_prepare() const {
+  return _internal_has_sync_prepare();
+}
+inline void ToServerMessage::set_has_sync_prepare() {
+  _impl_._oneof_case_[0] = kSyncPrepare;
+}
+inline void ToServerMessage::clear_sync_prepare() {
+  if (_internal_has_sync_prepare()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.msg_.sync_prepare_;
+    }
+    clear_has_msg();
+  }
+}
+inline ::dsnet::transaction::eris::proto::SyncPrepareMessage* ToServerMessage::release_sync_prepare() {
+  // @@protoc_insertion_point(field_release:dsnet.transaction.eris.proto.ToServerMessage.sync_prepare)
+  if (_internal_has_sync_prepare()) {
+    clear_has_msg();
+    ::dsnet::transaction::eris::proto::SyncPrepareMessage* temp = _impl_.msg_.sync_prepare_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.msg_.sync_prepare_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::dsnet::transaction::eris::proto::SyncPrepareMessage& ToServerMessage::_internal_sync_prepare() const {
+  return _internal_has_sync_prepare()
+      ? *_impl_.msg_.sync_prepare_
+      : reinterpret_cast< ::dsnet::transaction::eris::proto::SyncPrepareMessage&>(::dsnet::transaction::eris::proto::_SyncPrepareMessage_default_instance_);
+}
+inline const ::dsnet::transaction::eris::proto::SyncPrepareMessage& ToServerMessage::sync_prepare() const {
+  // @@protoc_insertion_point(field_get:dsnet.transaction.eris.proto.ToServerMessage.sync_prepare)
+  return _internal_sync_prepare();
+}
+inline ::dsnet::transaction::eris::proto::SyncPrepareMessage* ToServerMessage::unsafe_arena_release_sync_prepare() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:dsnet.transaction.eris.proto.ToServerMessage.sync_prepare)
+  if (_internal_has_sync_prepare()) {
+    clear_has_msg();
+    ::dsnet::transaction::eris::proto::SyncPrepareMessage* temp = _impl_.msg_.sync_prepare_;
+    _impl_.msg_.sync_prepare_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void ToServerMessage::unsafe_arena_set_allocated_sync_prepare(::dsnet::transaction::eris::proto::SyncPrepareMessage* sync_prepare) {
+  clear_msg();
+  if (sync_prepare) {
+    set_has_sync_prepare();
+    _impl_.msg_.sync_prepare_ = sync_prepare;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:dsnet.transaction.eris.proto.ToServerMessage.sync_prepare)
+}
+inline ::dsnet::transaction::eris::proto::SyncPrepareMessage* ToServerMessage::_internal_mutable_sync_prepare() {
+  if (!_internal_has_sync_prepare()) {
+    clear_msg();
+    set_has_sync_prepare();
+    _impl_.msg_.sync_prepare_ = CreateMaybeMessage< ::dsnet::transaction::eris::proto::SyncPrepareMessage >(GetArenaForAllocation());
+  }
+  return _impl_.msg_.sync_prepare_;
+}
+inline ::dsnet::transaction::eris::proto::SyncPrepareMessage* ToServerMessage::mutable_sync_prepare() {
+  ::dsnet::transaction::eris::proto::SyncPrepareMessage* _msg = _internal_mutable_sync_prepare();
+  // @@protoc_insertion_point(field_mutable:dsnet.transaction.eris.proto.ToServerMessage.sync_prepare)
+  return _msg;
+}
+
+// .dsnet.transaction.eris.proto.ViewChangeRequestMessage view_change_request = 6;
+inline bool ToServerMessage::_internal_has_view_change_request() const {
+  return msg_case() == kViewChangeRequest;
+}
+inline bool ToServerMessage::has_view_change_request() const {
+  return _internal_has_view_change_request();
+}
+inline void ToServerMessage::set_has_view_change_request() {
+  _impl_._oneof_case_[0] = kViewChangeRequest;
+}
+inline void ToServerMessage::clear_view_change_request() {
+  if (_internal_has_view_change_request()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.msg_.view_change_request_;
+    }
+    clear_has_msg();
+  }
+}
+inline ::dsnet::transaction::eris::proto::ViewChangeRequestMessage* ToServerMessage::release_view_change_request() {
+  // @@protoc_insertion_point(field_release:dsnet.transaction.eris.proto.ToServerMessage.view_change_request)
+  if (_internal_has_view_change_request()) {
+    clear_has_msg();
+    ::dsnet::transaction::eris::proto::ViewChangeRequestMessage* temp = _impl_.msg_.view_change_request_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.msg_.view_change_request_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::dsnet::transaction::eris::proto::ViewChangeRequestMessage& ToServerMessage::_internal_view_change_request() const {
+  return _internal_has_view_change_request()
+      ? *_impl_.msg_.view_change_request_
+      : reinterpret_cast< ::dsnet::transaction::eris::proto::ViewChangeRequestMessage&>(::dsnet::transaction::eris::proto::_ViewChangeRequestMessage_default_instance_);
+}
+inline const ::dsnet::transaction::eris::proto::ViewChangeRequestMessage& ToServerMessage::view_change_request() const {
+  // @@protoc_insertion_point(field_get:dsnet.transaction.eris.proto.ToServerMessage.view_change_request)
+  return _internal_view_change_request();
+}
+inline ::dsnet::transaction::eris::proto::ViewChangeRequestMessage* ToServerMessage::unsafe_arena_release_view_change_request() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:dsnet.transaction.eris.proto.ToServerMessage.view_change_request)
+  if (_internal_has_view_change_request()) {
+    clear_has_msg();
+    ::dsnet::transaction::eris::proto::ViewChangeRequestMessage* temp = _impl_.msg_.view_change_request_;
+    _impl_.msg_.view_change_request_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void ToServerMessage::unsafe_arena_set_allocated_view_change_request(::dsnet::transaction::eris::proto::ViewChangeRequestMessage* view_change_request) {
+  clear_msg();
+  if (view_change_request) {
+    set_has_view_change_request();
+    _impl_.msg_.view_change_request_ = view_change_request;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:dsnet.transaction.eris.proto.ToServerMessage.view_change_request)
+}
+inline ::dsnet::transaction::eris::proto::ViewChangeRequestMessage* ToServerMessage::_internal_mutable_view_change_request() {
+  if (!_internal_has_view_change_request()) {
+    clear_msg();
+    set_has_view_change_request();
+    _impl_.msg_.view_change_request_ = CreateMaybeMessage< ::dsnet::transaction::eris::proto::ViewChangeRequestMessage >(GetArenaForAllocation());
+  }
+  return _impl_.msg_.view_change_request_;
+}
+inline ::dsnet::transaction::eris::proto::ViewChangeRequestMessage* ToServerMessage::mutable_view_change_request() {
+  ::dsnet::transaction::eris::proto::ViewChangeRequestMessage* _msg = _internal_mutable_view_change_request();
+  // @@protoc_insertion_point(field_mutable:dsnet.transaction.eris.proto.ToServerMessage.view_change_request)
+  return _msg;
+}
+
+// .dsnet.transaction.eris.proto.ViewChangeMessage view_change = 7;
+inline bool ToServerMessage::_internal_has_view_change() const {
+  return msg_case() == kViewChange;
+}
+inline bool ToServerMessage::has_view_change() const {
+  return _internal_has_view_change();
+}
+inline void ToServerMessage::set_has_view_change() {
+  _impl_._oneof_case_[0] = kViewChange;
+}
+inline void ToServerMessage::clear_view_change() {
+  if (_internal_has_view_change()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.msg_.view_change_;
+    }
+    clear_has_msg();
+  }
+}
+inline ::dsnet::transaction::eris::proto::ViewChangeMessage* ToServerMessage::release_view_change() {
+  // @@protoc_insertion_point(field_release:dsnet.transaction.eris.proto.ToServerMessage.view_change)
+  if (_internal_has_view_change()) {
+    clear_has_msg();
+    ::dsnet::transaction::eris::proto::ViewChangeMessage* temp = _impl_.msg_.view_change_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.msg_.view_change_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::dsnet::transaction::eris::proto::ViewChangeMessage& ToServerMessage::_internal_view_change() const {
+  return _internal_has_view_change()
+      ? *_impl_.msg_.view_change_
+      : reinterpret_cast< ::dsnet::transaction::eris::proto::ViewChangeMessage&>(::dsnet::transaction::eris::proto::_ViewChangeMessage_default_instance_);
+}
+inline const ::dsnet::transaction::eris::proto::ViewChangeMessage& ToServerMessage::view_change() const {
+  // @@protoc_insertion_point(field_get:dsnet.transaction.eris.proto.ToServerMessage.view_change)
+  return _internal_view_change();
+}
+inline ::dsnet::transaction::eris::proto::ViewChangeMessage* ToServerMessage::unsafe_arena_release_view_change() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:dsnet.transaction.eris.proto.ToServerMessage.view_change)
+  if (_internal_has_view_change()) {
+    clear_has_msg();
+    ::dsnet::transaction::eris::proto::ViewChangeMessage* temp = _impl_.msg_.view_change_;
+    _impl_.msg_.view_change_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void ToServerMessage::unsafe_arena_set_allocated_view_change(::dsnet::transaction::eris::proto::ViewChangeMessage* view_change) {
+  clear_msg();
+  if (view_change) {
+    set_has_view_change();
+    _impl_.msg_.view_change_ = view_change;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:dsnet.transaction.eris.proto.ToServerMessage.view_change)
+}
+inline ::dsnet::transaction::eris::proto::ViewChangeMessage* ToServerMessage::_internal_mutable_view_change() {
+  if (!_internal_has_view_change()) {
+    clear_msg();
+    set_has_view_change();
+    _impl_.msg_.view_change_ = CreateMaybeMessage< ::dsnet::transaction::eris::proto::ViewChangeMessage >(GetArenaForAllocation());
+  }
+  return _impl_.msg_.view_change_;
+}
+inline ::dsnet::transaction::eris::proto::ViewChangeMessage* ToServerMessage::mutable_view_change() {
+  ::dsnet::transaction::eris::proto::ViewChangeMessage* _msg = _internal_mutable_view_change();
+  // @@protoc_insertion_point(field_mutable:dsnet.transaction.eris.proto.ToServerMessage.view_change)
+  return _msg;
+}
+
+// .dsnet.transaction.eris.proto.StartViewMessage start_view = 8;
+inline bool ToServerMessage::_internal_has_start_view() const {
+  return msg_case() == kStartView;
+}
+inline bool ToServerMessage::has_start_view() const {
+  return _internal_has_start_view();
+}
+inline void ToServerMessage::set_has_start_view() {
+  _impl_._oneof_case_[0] = kStartView;
+}
+inline void ToServerMessage::clear_start_view() {
+  if (_internal_has_start_view()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.msg_.start_view_;
+    }
+    clear_has_msg();
+  }
+}
+inline ::dsnet::transaction::eris::proto::StartViewMessage* ToServerMessage::release_start_view() {
+  // @@protoc_insertion_point(field_release:dsnet.transaction.eris.proto.ToServerMessage.start_view)
+  if (_internal_has_start_view()) {
+    clear_has_msg();
+    ::dsnet::transaction::eris::proto::StartViewMessage* temp = _impl_.msg_.start_view_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.msg_.start_view_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::dsnet::transaction::eris::proto::StartViewMessage& ToServerMessage::_internal_start_view() const {
+  return _internal_has_start_view()
+      ? *_impl_.msg_.start_view_
+      : reinterpret_cast< ::dsnet::transaction::eris::proto::StartViewMessage&>(::dsnet::transaction::eris::proto::_StartViewMessage_default_instance_);
+}
+inline const ::dsnet::transaction::eris::proto::StartViewMessage& ToServerMessage::start_view() const {
+  // @@protoc_insertion_point(field_get:dsnet.transaction.eris.proto.ToServerMessage.start_view)
+  return _internal_start_view();
+}
+inline ::dsnet::transaction::eris::proto::StartViewMessage* ToServerMessage::unsafe_arena_release_start_view() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:dsnet.transaction.eris.proto.ToServerMessage.start_view)
+  if (_internal_has_start_view()) {
+    clear_has_msg();
+    ::dsnet::transaction::eris::proto::StartViewMessage* temp = _impl_.msg_.start_view_;
+    _impl_.msg_.start_view_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void ToServerMessage::unsafe_arena_set_allocated_start_view(::dsnet::transaction::eris::proto::StartViewMessage* start_view) {
+  clear_msg();
+  if (start_view) {
+    set_has_start_view();
+    _impl_.msg_.start_view_ = start_view;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:dsnet.transaction.eris.proto.ToServerMessage.start_view)
+}
+inline ::dsnet::transaction::eris::proto::StartViewMessage* ToServerMessage::_internal_mutable_start_view() {
+  if (!_internal_has_start_view()) {
+    clear_msg();
+    set_has_start_view();
+    _impl_.msg_.start_view_ = CreateMaybeMessage< ::dsnet::transaction::eris::proto::StartViewMessage >(GetArenaForAllocation());
+  }
+  return _impl_.msg_.start_view_;
+}
+inline ::dsnet::transaction::eris::proto::StartViewMessage* ToServerMessage::mutable_start_view() {
+  ::dsnet::transaction::eris::proto::StartViewMessage* _msg = _internal_mutable_start_view();
+  // @@protoc_insertion_point(field_mutable:dsnet.transaction.eris.proto.ToServerMessage.start_view)
+  return _msg;
+}
+
+// .dsnet.transaction.eris.proto.StateTransferRequestMessage state_transfer_request = 9;
+inline bool ToServerMessage::_internal_has_state_transfer_request() const {
+  return msg_case() == kStateTransferRequest;
+}
+inline bool ToServerMessage::has_state_transfer_request() const {
+  return _internal_has_state_transfer_request();
+}
+inline void ToServerMessage::set_has_state_transfer_request() {
+  _impl_._oneof_case_[0] = kStateTransferRequest;
+}
+inline void ToServerMessage::clear_state_transfer_request() {
+  if (_internal_has_state_transfer_request()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.msg_.state_transfer_request_;
+    }
+    clear_has_msg();
+  }
+}
+inline ::dsnet::transaction::eris::proto::StateTransferRequestMessage* ToServerMessage::release_state_transfer_request() {
+  // @@protoc_insertion_point(field_release:dsnet.transaction.eris.proto.ToServerMessage.state_transfer_request)
+  if (_internal_has_state_transfer_request()) {
+    clear_has_msg();
+    ::dsnet::transaction::eris::proto::StateTransferRequestMessage* temp = _impl_.msg_.state_transfer_request_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.msg_.state_transfer_request_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::dsnet::transaction::eris::proto::StateTransferRequestMessage& ToServerMessage::_internal_state_transfer_request() const {
+  return _internal_has_state_transfer_request()
+      ? *_impl_.msg_.state_transfer_request_
+      : reinterpret_cast< ::dsnet::transaction::eris::proto::StateTransferRequestMessage&>(::dsnet::transaction::eris::proto::_StateTransferRequestMessage_default_instance_);
+}
+inline const ::dsnet::transaction::eris::proto::StateTransferRequestMessage& ToServerMessage::state_transfer_request() const {
+  // @@protoc_insertion_point(field_get:dsnet.transaction.eris.proto.ToServerMessage.state_transfer_request)
+  return _internal_state_transfer_request();
+}
+inline ::dsnet::transaction::eris::proto::StateTransferRequestMessage* ToServerMessage::unsafe_arena_release_state_transfer_request() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:dsnet.transaction.eris.proto.ToServerMessage.state_transfer_request)
+  if (_internal_has_state_transfer_request()) {
+    clear_has_msg();
+    ::dsnet::transaction::eris::proto::StateTransferRequestMessage* temp = _impl_.msg_.state_transfer_request_;
+    _impl_.msg_.state_transfer_request_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void ToServerMessage::unsafe_arena_set_allocated_state_transfer_request(::dsnet::transaction::eris::proto::StateTransferRequestMessage* state_transfer_request) {
+  clear_msg();
+  if (state_transfer_request) {
+    set_has_state_transfer_request();
+    _impl_.msg_.state_transfer_request_ = state_transfer_request;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:dsnet.transaction.eris.proto.ToServerMessage.state_transfer_request)
+}
+inline ::dsnet::transaction::eris::proto::StateTransferRequestMessage* ToServerMessage::_internal_mutable_state_transfer_request() {
+  if (!_internal_has_state_transfer_request()) {
+    clear_msg();
+    set_has_state_transfer_request();
+    _impl_.msg_.state_transfer_request_ = CreateMaybeMessage< ::dsnet::transaction::eris::proto::StateTransferRequestMessage >(GetArenaForAllocation());
+  }
+  return _impl_.msg_.state_transfer_request_;
+}
+inline ::dsnet::transaction::eris::proto::StateTransferRequestMessage* ToServerMessage::mutable_state_transfer_request() {
+  ::dsnet::transaction::eris::proto::StateTransferRequestMessage* _msg = _internal_mutable_state_transfer_request();
+  // @@protoc_insertion_point(field_mutable:dsnet.transaction.eris.proto.ToServerMessage.state_transfer_request)
+  return _msg;
+}
+
+// .dsnet.transaction.eris.proto.StateTransferReplyMessage state_transfer_reply = 10;
+inline bool ToServerMessage::_internal_has_state_transfer_reply() const {
+  return msg_case() == kStateTransferReply;
+}
+inline bool ToServerMessage::has_state_transfer_reply() const {
+  return _internal_has_state_transfer_reply();
+}
+inline void ToServerMessage::set_has_state_transfer_reply() {
+  _impl_._oneof_case_[0] = kStateTransferReply;
+}
+inline void ToServerMessage::clear_state_transfer_reply() {
+  if (_internal_has_state_transfer_reply()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.msg_.state_transfer_reply_;
+    }
+    clear_has_msg();
+  }
+}
+inline ::dsnet::transaction::eris::proto::StateTransferReplyMessage* ToServerMessage::release_state_transfer_reply() {
+  // @@protoc_insertion_point(field_release:dsnet.transaction.eris.proto.ToServerMessage.state_transfer_reply)
+  if (_internal_has_state_transfer_reply()) {
+    clear_has_msg();
+    ::dsnet::transaction::eris::proto::StateTransferReplyMessage* temp = _impl_.msg_.state_transfer_reply_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.msg_.state_transfer_reply_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::dsnet::transaction::eris::proto::StateTransferReplyMessage& ToServerMessage::_internal_state_transfer_reply() const {
+  return _internal_has_state_transfer_reply()
+      ? *_impl_.msg_.state_transfer_reply_
+      : reinterpret_cast< ::dsnet::transaction::eris::proto::StateTransferReplyMessage&>(::dsnet::transaction::eris::proto::_StateTransferReplyMessage_default_instance_);
+}
+inline const ::dsnet::transaction::eris::proto::StateTransferReplyMessage& ToServerMessage::state_transfer_reply() const {
+  // @@protoc_insertion_point(field_get:dsnet.transaction.eris.proto.ToServerMessage.state_transfer_reply)
+  return _internal_state_transfer_reply();
+}
+inline ::dsnet::transaction::eris::proto::StateTransferReplyMessage* ToServerMessage::unsafe_arena_release_state_transfer_reply() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:dsnet.transaction.eris.proto.ToServerMessage.state_transfer_reply)
+  if (_internal_has_state_transfer_reply()) {
+    clear_has_msg();
+    ::dsnet::transaction::eris::proto::StateTransferReplyMessage* temp = _impl_.msg_.state_transfer_reply_;
+    _impl_.msg_.state_transfer_reply_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void ToServerMessage::unsafe_arena_set_allocated_state_transfer_reply(::dsnet::transaction::eris::proto::StateTransferReplyMessage* state_transfer_reply) {
+  clear_msg();
+  if (state_transfer_reply) {
+    set_has_state_transfer_reply();
+    _impl_.msg_.state_transfer_reply_ = state_transfer_reply;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:dsnet.transaction.eris.proto.ToServerMessage.state_transfer_reply)
+}
+inline ::dsnet::transaction::eris::proto::StateTransferReplyMessage* ToServerMessage::_internal_mutable_state_transfer_reply() {
+  if (!_internal_has_state_transfer_reply()) {
+    clear_msg();
+    set_has_state_transfer_reply();
+    _impl_.msg_.state_transfer_reply_ = CreateMaybeMessage< ::dsnet::transaction::eris::proto::StateTransferReplyMessage >(GetArenaForAllocation());
+  }
+  return _impl_.msg_.state_transfer_reply_;
+}
+inline ::dsnet::transaction::eris::proto::StateTransferReplyMessage* ToServerMessage::mutable_state_transfer_reply() {
+  ::dsnet::transaction::eris::proto::StateTransferReplyMessage* _msg = _internal_mutable_state_transfer_reply();
+  // @@protoc_insertion_point(field_mutable:dsnet.transaction.eris.proto.ToServerMessage.state_transfer_reply)
+  return _msg;
+}
+
+// .dsnet.transaction.eris.proto.EpochChangeStateTransferRequest epoch_change_state_transfer_request = 11;
+inline bool ToServerMessage::_internal_has_epoch_change_state_transfer_request() const {
+  return msg_case() == kEpochChangeStateTransferRequest;
+}
+inline bool ToServerMessage::has_epoch_change_state_transfer_request() const {
+  return _internal_has_epoch_change_state_transfer_request();
+}
+inline void ToServerMessage::set_has_epoch_change_state_transfer_request() {
+  _impl_._oneof_case_[0] = kEpochChangeStateTransferRequest;
+}
+inline void ToServerMessage::clear_epoch_change_state_transfer_request() {
+  if (_internal_has_epoch_change_state_transfer_request()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.msg_.epoch_change_state_transfer_request_;
+    }
+    clear_has_msg();
+  }
+}
+inline ::dsnet::transaction::eris::proto::EpochChangeStateTransferRequest* ToServerMessage::release_epoch_change_state_transfer_request() {
+  // @@protoc_insertion_point(field_release:dsnet.transaction.eris.proto.ToServerMessage.epoch_change_state_transfer_request)
+  if (_internal_has_epoch_change_state_transfer_request()) {
+    clear_has_msg();
+    ::dsnet::transaction::eris::proto::EpochChangeStateTransferRequest* temp = _impl_.msg_.epoch_change_state_transfer_request_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.msg_.epoch_change_state_transfer_request_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::dsnet::transaction::eris::proto::EpochChangeStateTransferRequest& ToServerMessage::_internal_epoch_change_state_transfer_request() const {
+  return _internal_has_epoch_change_state_transfer_request()
+      ? *_impl_.msg_.epoch_change_state_transfer_request_
+      : reinterpret_cast< ::dsnet::transaction::eris::proto::EpochChangeStateTransferRequest&>(::dsnet::transaction::eris::proto::_EpochChangeStateTransferRequest_default_instance_);
+}
+inline const ::dsnet::transaction::eris::proto::EpochChangeStateTransferRequest& ToServerMessage::epoch_change_state_transfer_request() const {
+  // @@protoc_insertion_point(field_get:dsnet.transaction.eris.proto.ToServerMessage.epoch_change_state_transfer_request)
+  return _internal_epoch_change_state_transfer_request();
+}
+inline ::dsnet::transaction::eris::proto::EpochChangeStateTransferRequest* ToServerMessage::unsafe_arena_release_epoch_change_state_transfer_request() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:dsnet.transaction.eris.proto.ToServerMessage.epoch_change_state_transfer_request)
+  if (_internal_has_epoch_change_state_transfer_request()) {
+    clear_has_msg();
+    ::dsnet::transaction::eris::proto::EpochChangeStateTransferRequest* temp = _impl_.msg_.epoch_change_state_transfer_request_;
+    _impl_.msg_.epoch_change_state_transfer_request_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void ToServerMessage::unsafe_arena_set_allocated_epoch_change_state_transfer_request(::dsnet::transaction::eris::proto::EpochChangeStateTransferRequest* epoch_change_state_transfer_request) {
+  clear_msg();
+  if (epoch_change_state_transfer_request) {
+    set_has_epoch_change_state_transfer_request();
+    _impl_.msg_.epoch_change_state_transfer_request_ = epoch_change_state_transfer_request;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:dsnet.transaction.eris.proto.ToServerMessage.epoch_change_state_transfer_request)
+}
+inline ::dsnet::transaction::eris::proto::EpochChangeStateTransferRequest* ToServerMessage::_internal_mutable_epoch_change_state_transfer_request() {
+  if (!_internal_has_epoch_change_state_transfer_request()) {
+    clear_msg();
+    set_has_epoch_change_state_transfer_request();
+    _impl_.msg_.epoch_change_state_transfer_request_ = CreateMaybeMessage< ::dsnet::transaction::eris::proto::EpochChangeStateTransferRequest >(GetArenaForAllocation());
+  }
+  return _impl_.msg_.epoch_change_state_transfer_request_;
+}
+inline ::dsnet::transaction::eris::proto::EpochChangeStateTransferRequest* ToServerMessage::mutable_epoch_change_state_transfer_request() {
+  ::dsnet::transaction::eris::proto::EpochChangeStateTransferRequest* _msg = _internal_mutable_epoch_change_state_transfer_request();
+  // @@protoc_insertion_point(field_mutable:dsnet.transaction.eris.proto.ToServerMessage.epoch_change_state_transfer_request)
+  return _msg;
+}
+
+// .dsnet.transaction.eris.proto.EpochChangeStateTransferReply epoch_change_state_transfer_reply = 12;
+inline bool ToServerMessage::_internal_has_epoch_change_state_transfer_reply() const {
+  return msg_case() == kEpochChangeStateTransferReply;
+}
+inline bool ToServerMessage::has_epoch_change_state_transfer_reply() const {
+  return _internal_has_epoch_change_state_transfer_reply();
+}
+inline void ToServerMessage::set_has_epoch_change_state_transfer_reply() {
+  _impl_._oneof_case_[0] = kEpochChangeStateTransferReply;
+}
+inline void ToServerMessage::clear_epoch_change_state_transfer_reply() {
+  if (_internal_has_epoch_change_state_transfer_reply()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.msg_.epoch_change_state_transfer_reply_;
+    }
+    clear_has_msg();
+  }
+}
+inline ::dsnet::transaction::eris::proto::EpochChangeStateTransferReply* ToServerMessage::release_epoch_change_state_transfer_reply() {
+  // @@protoc_insertion_point(field_release:dsnet.transaction.eris.proto.ToServerMessage.epoch_change_state_transfer_reply)
+  if (_internal_has_epoch_change_state_transfer_reply()) {
+    clear_has_msg();
+    ::dsnet::transaction::eris::proto::EpochChangeStateTransferReply* temp = _impl_.msg_.epoch_change_state_transfer_reply_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.msg_.epoch_change_state_transfer_reply_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::dsnet::transaction::eris::proto::EpochChangeStateTransferReply& ToServerMessage::_internal_epoch_change_state_transfer_reply() const {
+  return _internal_has_epoch_change_state_transfer_reply()
+      ? *_impl_.msg_.epoch_change_state_transfer_reply_
+      : reinterpret_cast< ::dsnet::transaction::eris::proto::EpochChangeStateTransferReply&>(::dsnet::transaction::eris::proto::_EpochChangeStateTransferReply_default_instance_);
+}
+inline const ::dsnet::transaction::eris::proto::EpochChangeStateTransferReply& ToServerMessage::epoch_change_state_transfer_reply() const {
+  // @@protoc_insertion_point(field_get:dsnet.transaction.eris.proto.ToServerMessage.epoch_change_state_transfer_reply)
+  return _internal_epoch_change_state_transfer_reply();
+}
+inline ::dsnet::transaction::eris::proto::EpochChangeStateTransferReply* ToServerMessage::unsafe_arena_release_epoch_change_state_transfer_reply() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:dsnet.transaction.eris.proto.ToServerMessage.epoch_change_state_transfer_reply)
+  if (_internal_has_epoch_change_state_transfer_reply()) {
+    clear_has_msg();
+    ::dsnet::transaction::eris::proto::EpochChangeStateTransferReply* temp = _impl_.msg_.epoch_change_state_transfer_reply_;
+    _impl_.msg_.epoch_change_state_transfer_reply_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void ToServerMessage::unsafe_arena_set_allocated_epoch_change_state_transfer_reply(::dsnet::transaction::eris::proto::EpochChangeStateTransferReply* epoch_change_state_transfer_reply) {
+  clear_msg();
+  if (epoch_change_state_transfer_reply) {
+    set_has_epoch_change_state_transfer_reply();
+    _impl_.msg_.epoch_change_state_transfer_reply_ = epoch_change_state_transfer_reply;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:dsnet.transaction.eris.proto.ToServerMessage.epoch_change_state_transfer_reply)
+}
+inline ::dsnet::transaction::eris::proto::EpochChangeStateTransferReply* ToServerMessage::_internal_mutable_epoch_change_state_transfer_reply() {
+  if (!_internal_has_epoch_change_state_transfer_reply()) {
+    clear_msg();
+    set_has_epoch_change_state_transfer_reply();
+    _impl_.msg_.epoch_change_state_transfer_reply_ = CreateMaybeMessage< ::dsnet::transaction::eris::proto::EpochChangeStateTransferReply >(GetArenaForAllocation());
+  }
+  return _impl_.msg_.epoch_change_state_transfer_reply_;
+}
+inline ::dsnet::transaction::eris::proto::EpochChangeStateTransferReply* ToServerMessage::mutable_epoch_change_state_transfer_reply() {
+  ::dsnet::transaction::eris::proto::EpochChangeStateTransferReply* _msg = _internal_mutable_epoch_change_state_transfer_reply();
+  // @@protoc_insertion_point(field_mutable:dsnet.transaction.eris.proto.ToServerMessage.epoch_change_state_transfer_reply)
+  return _msg;
+}
+
+inline bool ToServerMessage::has_msg() const {
+  return msg_case() != MSG_NOT_SET;
+}
+inline void ToServerMessage::clear_has_msg() {
+  _impl_._oneof_case_[0] = MSG_NOT_SET;
+}
+inline ToServerMessage::MsgCase ToServerMessage::msg_case() const {
+  return ToServerMessage::MsgCase(_impl_._oneof_case_[0]);
+}
+// -------------------------------------------------------------------
+
+// TxnInfoRequest
+
+// required .dsnet.transaction.eris.proto.Stamp txn_num = 1;
+inline bool TxnInfoRequest::_internal_has_txn_num() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.txn_num_ != nullptr);
+  return value;
+}
+inline bool TxnInfoRequest::has_txn_num() const {
+  return _internal_has_txn_num();
+}
+inline void TxnInfoRequest::clear_txn_num() {
+  if (_impl_.txn_num_ != nullptr) _impl_.txn_num_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const ::dsnet::transaction::eris::proto::Stamp& TxnInfoRequest::_internal_txn_num() const {
+  const ::dsnet::transaction::eris::proto::Stamp* p = _impl_.txn_num_;
+  return p != nullptr ? *p : reinterpret_cast<const ::dsnet::transaction::eris::proto::Stamp&>(
+      ::dsnet::transaction::eris::proto::_Stamp_default_instance_);
+}
+inline const ::dsnet::transaction::eris::proto::Stamp& TxnInfoRequest::txn_num() const {
+  // @@protoc_insertion_point(field_get:dsnet.transaction.eris.proto.TxnInfoRequest.txn_num)
+  return _internal_txn_num();
+}
+inline void TxnInfoRequest::unsafe_arena_set_allocated_txn_num(
+    ::dsnet::transaction::eris::proto::Stamp* txn_num) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.txn_num_);
+  }
+  _impl_.txn_num_ = txn_num;
+  if (txn_num) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:dsnet.transaction.eris.proto.TxnInfoRequest.txn_num)
+}
+inline ::dsnet::transaction::eris::proto::Stamp* TxnInfoRequest::release_txn_num() {
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::dsnet::transaction::eris::proto::Stamp* temp = _impl_.txn_num_;
+  _impl_.txn_num_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::dsnet::transaction::eris::proto::Stamp* TxnInfoRequest::unsafe_arena_release_txn_num() {
+  // @@protoc_insertion_point(field_release:dsnet.transaction.eris.proto.TxnInfoRequest.txn_num)
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::dsnet::transaction::eris::proto::Stamp* temp = _impl_.txn_num_;
+  _impl_.txn_num_ = nullptr;
+  return temp;
+}
+inline ::dsnet::transaction::eris::proto::Stamp* TxnInfoRequest::_internal_mutable_txn_num() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  if (_impl_.txn_num_ == nullptr) {
+    auto* p = CreateMaybeMessage<::dsnet::transaction::eris::proto::Stamp>(GetArenaForAllocation());
+    _impl_.txn_num_ = p;
+  }
+  return _impl_.txn_num_;
+}
+inline ::dsnet::transaction::eris::proto::Stamp* TxnInfoRequest::mutable_txn_num() {
+  ::dsnet::transaction::eris::proto::Stamp* _msg = _internal_mutable_txn_num();
+  // @@protoc_insertion_point(field_mutable:dsnet.transaction.eris.proto.TxnInfoRequest.txn_num)
+  return _msg;
+}
+inline void TxnInfoRequest::set_allocated_txn_num(::dsnet::transaction::eris::proto::Stamp* txn_num) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.txn_num_;
+  }
+  if (txn_num) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(txn_num);
+    if (message_arena != submessage_arena) {
+      txn_num = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, txn_num, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.txn_num_ = txn_num;
+  // @@protoc_insertion_point(field_set_allocated:dsnet.transaction.eris.proto.TxnInfoRequest.txn_num)
+}
+
+// -------------------------------------------------------------------
+
+// TxnReceived
+
+// required .dsnet.transaction.eris.proto.RequestMessage txn = 1;
+inline bool TxnReceived::_internal_has_txn() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.txn_ != nullptr);
+  return value;
+}
+inline bool TxnReceived::has_txn() const {
+  return _internal_has_txn();
+}
+inline void TxnReceived::clear_txn() {
+  if (_impl_.txn_ != nullptr) _impl_.txn_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const ::dsnet::transaction::eris::proto::RequestMessage& TxnReceived::_internal_txn() const {
+  const ::dsnet::transaction::eris::proto::RequestMessage* p = _impl_.txn_;
+  return p != nullptr ? *p : reinterpret_cast<const ::dsnet::transaction::eris::proto::RequestMessage&>(
+      ::dsnet::transaction::eris::proto::_RequestMessage_default_instance_);
+}
+inline const ::dsnet::transaction::eris::proto::RequestMessage& TxnReceived::txn() const {
+  // @@protoc_insertion_point(field_get:dsnet.transaction.eris.proto.TxnReceived.txn)
+  return _internal_txn();
+}
+inline void TxnReceived::unsafe_arena_set_allocated_txn(
+    ::dsnet::transaction::eris::proto::RequestMessage* txn) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.txn_);
+  }
+  _impl_.txn_ = txn;
+  if (txn) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:dsnet.transaction.eris.proto.TxnReceived.txn)
+}
+inline ::dsnet::transaction::eris::proto::RequestMessage* TxnReceived::release_txn() {
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::dsnet::transaction::eris::proto::RequestMessage* temp = _impl_.txn_;
+  _impl_.txn_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::dsnet::transaction::eris::proto::RequestMessage* TxnReceived::unsafe_arena_release_txn() {
+  // @@protoc_insertion_point(field_release:dsnet.transaction.eris.proto.TxnReceived.txn)
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::dsnet::transaction::eris::proto::RequestMessage* temp = _impl_.txn_;
+  _impl_.txn_ = nullptr;
+  return temp;
+}
+inline ::dsnet::transaction::eris::proto::RequestMessage* TxnReceived::_internal_mutable_txn() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  if (_impl_.txn_ == nullptr) {
+    auto* p = CreateMaybeMessage<::dsnet::transaction::eris::proto::RequestMessage>(GetArenaForAllocation());
+    _impl_.txn_ = p;
+  }
+  return _impl_.txn_;
+}
+inline ::dsnet::transaction::eris::proto::RequestMessage* TxnReceived::mutable_txn() {
+  ::dsnet::transaction::eris::proto::RequestMessage* _msg = _internal_mutable_txn();
+  // @@protoc_insertion_point(field_mutable:dsnet.transaction.eris.proto.TxnReceived.txn)
+  return _msg;
+}
+inline void TxnReceived::set_allocated_txn(::dsnet::transaction::eris::proto::RequestMessage* txn) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.txn_;
+  }
+  if (txn) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(txn);
+    if (message_arena != submessage_arena) {
+      txn = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, txn, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.txn_ = txn;
+  // @@protoc_insertion_point(field_set_allocated:dsnet.transaction.eris.proto.TxnReceived.txn)
+}
+
+// -------------------------------------------------------------------
+
+// TxnTempDropped
+
+// required .dsnet.transaction.eris.proto.Stamp txn_num = 1;
+inline bool TxnTempDropped::_internal_has_txn_num() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.txn_num_ != nullptr);
+  return value;
+}
+inline bool TxnTempDropped::has_txn_num() const {
+  return _internal_has_txn_num();
+}
+inline void TxnTempDropped::clear_txn_num() {
+  if (_impl_.txn_num_ != nullptr) _impl_.txn_num_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const ::dsnet::transaction::eris::proto::Stamp& TxnTempDropped::_internal_txn_num() const {
+  const ::dsnet::transaction::eris::proto::Stamp* p = _impl_.txn_num_;
+  return p != nullptr ? *p : reinterpret_cast<const ::dsnet::transaction::eris::proto::Stamp&>(
+      ::dsnet::transaction::eris::proto::_Stamp_default_instance_);
+}
+inline const ::dsnet::transaction::eris::proto::Stamp& TxnTempDropped::txn_num() const {
+  // @@protoc_insertion_point(field_get:dsnet.transaction.eris.proto.TxnTempDropped.txn_num)
+  return _internal_txn_num();
+}
+inline void TxnTempDropped::unsafe_arena_set_allocated_txn_num(
+    ::dsnet::transaction::eris::proto::Stamp* txn_num) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.txn_num_);
+  }
+  _impl_.txn_num_ = txn_num;
+  if (txn_num) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:dsnet.transaction.eris.proto.TxnTempDropped.txn_num)
+}
+inline ::dsnet::transaction::eris::proto::Stamp* TxnTempDropped::release_txn_num() {
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::dsnet::transaction::eris::proto::Stamp* temp = _impl_.txn_num_;
+  _impl_.txn_num_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::dsnet::transaction::eris::proto::Stamp* TxnTempDropped::unsafe_arena_release_txn_num() {
+  // @@protoc_insertion_point(field_release:dsnet.transaction.eris.proto.TxnTempDropped.txn_num)
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::dsnet::transaction::eris::proto::Stamp* temp = _impl_.txn_num_;
+  _impl_.txn_num_ = nullptr;
+  return temp;
+}
+inline ::dsnet::transaction::eris::proto::Stamp* TxnTempDropped::_internal_mutable_txn_num() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  if (_impl_.txn_num_ == nullptr) {
+    auto* p = CreateMaybeMessage<::dsnet::transaction::eris::proto::Stamp>(GetArenaForAllocation());
+    _impl_.txn_num_ = p;
+  }
+  return _impl_.txn_num_;
+}
+inline ::dsnet::transaction::eris::proto::Stamp* TxnTempDropped::mutable_txn_num() {
+  ::dsnet::transaction::eris::proto::Stamp* _msg = _internal_mutable_txn_num();
+  // @@protoc_insertion_point(field_mutable:dsnet.transaction.eris.proto.TxnTempDropped.txn_num)
+  return _msg;
+}
+inline void TxnTempDropped::set_allocated_txn_num(::dsnet::transaction::eris::proto::Stamp* txn_num) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.txn_num_;
+  }
+  if (txn_num) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(txn_num);
+    if (message_arena != submessage_arena) {
+      txn_num = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, txn_num, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.txn_num_ = txn_num;
+  // @@protoc_insertion_point(field_set_allocated:dsnet.transaction.eris.proto.TxnTempDropped.txn_num)
+}
+
+// -------------------------------------------------------------------
+
+// EpochChangeReq
+
+// required uint32 new_epoch_num = 1;
+inline bool EpochChangeReq::_internal_has_new_epoch_num() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool EpochChangeReq::has_new_epoch_num() const {
+  return _internal_has_new_epoch_num();
+}
+inline void EpochChangeReq::clear_new_epoch_num() {
+  _impl_.new_epoch_num_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline uint32_t EpochChangeReq::_internal_new_epoch_num() const {
+  return _impl_.new_epoch_num_;
+}
+inline uint32_t EpochChangeReq::new_epoch_num() const {
+  // @@protoc_insertion_point(field_get:dsnet.transaction.eris.proto.EpochChangeReq.new_epoch_num)
+  return _internal_new_epoch_num();
+}
+inline void EpochChangeReq::_internal_set_new_epoch_num(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.new_epoch_num_ = value;
+}
+inline void EpochChangeReq::set_new_epoch_num(uint32_t value) {
+  _internal_set_new_epoch_num(value);
+  // @@protoc_insertion_point(field_set:dsnet.transaction.eris.proto.EpochChangeReq.new_epoch_num)
+}
+
+// -------------------------------------------------------------------
+
+// EpochChangeAck_LogInfoPiece
+
+// required uint32 shard_num = 1;
+inline bool EpochChangeAck_LogInfoPiece::_internal_has_shard_num() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool EpochChangeAck_LogInfoPiece::has_shard_num() const {
+  return _internal_has_shard_num();
+}
+inline void EpochChangeAck_LogInfoPiece::clear_shard_num() {
+  _impl_.shard_num_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline uint32_t EpochChangeAck_LogInfoPiece::_internal_shard_num() const {
+  return _impl_.shard_num_;
+}
+inline uint32_t EpochChangeAck_LogInfoPiece::shard_num() const {
+  // @@protoc_insertion_point(field_get:dsnet.transaction.eris.proto.EpochChangeAck.LogInfoPiece.shard_num)
+  return _internal_shard_num();
+}
+inline void EpochChangeAck_LogInfoPiece::_internal_set_shard_num(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.shard_num_ = value;
+}
+inline void EpochChangeAck_LogInfoPiece::set_shard_num(uint32_t value) {
+  _internal_set_shard_num(value);
+  // @@protoc_insertion_point(field_set:dsnet.transaction.eris.proto.EpochChangeAck.LogInfoPiece.shard_num)
+}
+
+// required uint64 latest_msg_num = 2;
+inline bool EpochChangeAck_LogInfoPiece::_internal_has_latest_msg_num() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool EpochChangeAck_LogInfoPiece::has_latest_msg_num() const {
+  return _internal_has_latest_msg_num();
+}
+inline void EpochChangeAck_LogInfoPiece::clear_latest_msg_num() {
+  _impl_.latest_msg_num_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline uint64_t EpochChangeAck_LogInfoPiece::_internal_latest_msg_num() const {
+  return _impl_.latest_msg_num_;
+}
+inline uint64_t EpochChangeAck_LogInfoPiece::latest_msg_num() const {
+  // @@protoc_insertion_point(field_get:dsnet.transaction.eris.proto.EpochChangeAck.LogInfoPiece.latest_msg_num)
+  return _internal_latest_msg_num();
+}
+inline void EpochChangeAck_LogInfoPiece::_internal_set_latest_msg_num(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.latest_msg_num_ = value;
+}
+inline void EpochChangeAck_LogInfoPiece::set_latest_msg_num(uint64_t value) {
+  _internal_set_latest_msg_num(value);
+  // @@protoc_insertion_point(field_set:dsnet.transaction.eris.proto.EpochChangeAck.LogInfoPiece.latest_msg_num)
+}
+
+// -------------------------------------------------------------------
+
+// EpochChangeAck
+
+// required uint32 last_normal_epoch = 1;
+inline bool EpochChangeAck::_internal_has_last_normal_epoch() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool EpochChangeAck::has_last_normal_epoch() const {
+  return _internal_has_last_normal_epoch();
+}
+inline void EpochChangeAck::clear_last_normal_epoch() {
+  _impl_.last_normal_epoch_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline uint32_t EpochChangeAck::_internal_last_normal_epoch() const {
+  return _impl_.last_normal_epoch_;
+}
+inline uint32_t EpochChangeAck::last_normal_epoch() const {
+  // @@protoc_insertion_point(field_get:dsnet.transaction.eris.proto.EpochChangeAck.last_normal_epoch)
+  return _internal_last_normal_epoch();
+}
+inline void EpochChangeAck::_internal_set_last_normal_epoch(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.last_normal_epoch_ = value;
+}
+inline void EpochChangeAck::set_last_normal_epoch(uint32_t value) {
+  _internal_set_last_normal_epoch(value);
+  // @@protoc_insertion_point(field_set:dsnet.transaction.eris.proto.EpochChangeAck.last_normal_epoch)
+}
+
+// required uint64 op_num = 2;
+inline bool EpochChangeAck::_internal_has_op_num() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool EpochChangeAck::has_op_num() const {
+  return _internal_has_op_num();
+}
+inline void EpochChangeAck::clear_op_num() {
+  _impl_.op_num_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline uint64_t EpochChangeAck::_internal_op_num() const {
+  return _impl_.op_num_;
+}
+inline uint64_t EpochChangeAck::op_num() const {
+  // @@protoc_insertion_point(field_get:dsnet.transaction.eris.proto.EpochChangeAck.op_num)
+  return _internal_op_num();
+}
+inline void EpochChangeAck::_internal_set_op_num(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.op_num_ = value;
+}
+inline void EpochChangeAck::set_op_num(uint64_t value) {
+  _internal_set_op_num(value);
+  // @@protoc_insertion_point(field_set:dsnet.transaction.eris.proto.EpochChangeAck.op_num)
+}
+
+// repeated .dsnet.transaction.eris.proto.EpochChangeAck.LogInfoPiece log_info = 3;
+inline int EpochChangeAck::_internal_log_info_size() const {
+  return _impl_.log_info_.size();
+}
+inline int EpochChangeAck::log_info_size() const {
+  return _internal_log_info_size();
+}
+inline void EpochChangeAck::clear_log_info() {
+  _impl_.log_info_.Clear();
+}
+inline ::dsnet::transaction::eris::proto::EpochChangeAck_LogInfoPiece* EpochChangeAck::mutable_log_info(int index) {
+  // @@protoc_insertion_point(field_mutable:dsnet.transaction.eris.proto.EpochChangeAck.log_info)
+  return _impl_.log_info_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::dsnet::transaction::eris::proto::EpochChangeAck_LogInfoPiece >*
+EpochChangeAck::mutable_log_info() {
+  // @@protoc_insertion_point(field_mutable_list:dsnet.transaction.eris.proto.EpochChangeAck.log_info)
+  return &_impl_.log_info_;
+}
+inline const ::dsnet::transaction::eris::proto::EpochChangeAck_LogInfoPiece& EpochChangeAck::_internal_log_info(int index) const {
+  return _impl_.log_info_.Get(index);
+}
+inline const ::dsnet::transaction::eris::proto::EpochChangeAck_LogInfoPiece& EpochChangeAck::log_info(int index) const {
+  // @@protoc_insertion_point(field_get:dsnet.transaction.eris.proto.EpochChangeAck.log_info)
+  return _internal_log_info(index);
+}
+inline ::dsnet::transaction::eris::proto::EpochChangeAck_LogInfoPiece* EpochChangeAck::_internal_add_log_info() {
+  return _impl_.log_info_.Add();
+}
+inline ::dsnet::transaction::eris::proto::EpochChangeAck_LogInfoPiece* EpochChangeAck::add_log_info() {
+  ::dsnet::transaction::eris::proto::EpochChangeAck_LogInfoPiece* _add = _internal_add_log_info();
+  // @@protoc_insertion_point(field_add:dsnet.transaction.eris.proto.EpochChangeAck.log_info)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::dsnet::transaction::eris::proto::EpochChangeAck_LogInfoPiece >&
+EpochChangeAck::log_info() const {
+  // @@protoc_insertion_point(field_list:dsnet.transaction.eris.proto.EpochChangeAck.log_info)
+  return _impl_.log_info_;
+}
+
+// -------------------------------------------------------------------
+
+// EpochChangeStateTransferAck
+
+// required uint64 op_num = 1;
+inline bool EpochChangeStateTransferAck::_internal_has_op_num() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool EpochChangeStateTransferAck::has_op_num() const {
+  return _internal_has_op_num();
+}
+inline void EpochChangeStateTransferAck::clear_op_num() {
+  _impl_.op_num_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline uint64_t EpochChangeStateTransferAck::_internal_op_num() const {
+  return _impl_.op_num_;
+}
+inline uint64_t EpochChangeStateTransferAck::op_num() const {
+  // @@protoc_insertion_point(field_get:dsnet.transaction.eris.proto.EpochChangeStateTransferAck.op_num)
+  return _internal_op_num();
+}
+inline void EpochChangeStateTransferAck::_internal_set_op_num(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.op_num_ = value;
+}
+inline void EpochChangeStateTransferAck::set_op_num(uint64_t value) {
+  _internal_set_op_num(value);
+  // @@protoc_insertion_point(field_set:dsnet.transaction.eris.proto.EpochChangeStateTransferAck.op_num)
+}
+
+// repeated .dsnet.transaction.eris.proto.Stamp drops = 2;
+inline int EpochChangeStateTransferAck::_internal_drops_size() const {
+  return _impl_.drops_.size();
+}
+inline int EpochChangeStateTransferAck::drops_size() const {
+  return _internal_drops_size();
+}
+inline void EpochChangeStateTransferAck::clear_drops() {
+  _impl_.drops_.Clear();
+}
+inline ::dsnet::transaction::eris::proto::Stamp* EpochChangeStateTransferAck::mutable_drops(int index) {
+  // @@protoc_insertion_point(field_mutable:dsnet.transaction.eris.proto.EpochChangeStateTransferAck.drops)
+  return _impl_.drops_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::dsnet::transaction::eris::proto::Stamp >*
+EpochChangeStateTransferAck::mutable_drops() {
+  // @@protoc_insertion_point(field_mutable_list:dsnet.transaction.eris.proto.EpochChangeStateTransferAck.drops)
+  return &_impl_.drops_;
+}
+inline const ::dsnet::transaction::eris::proto::Stamp& EpochChangeStateTransferAck::_internal_drops(int index) const {
+  return _impl_.drops_.Get(index);
+}
+inline const ::dsnet::transaction::eris::proto::Stamp& EpochChangeStateTransferAck::drops(int index) const {
+  // @@protoc_insertion_point(field_get:dsnet.transaction.eris.proto.EpochChangeStateTransferAck.drops)
+  return _internal_drops(index);
+}
+inline ::dsnet::transaction::eris::proto::Stamp* EpochChangeStateTransferAck::_internal_add_drops() {
+  return _impl_.drops_.Add();
+}
+inline ::dsnet::transaction::eris::proto::Stamp* EpochChangeStateTransferAck::add_drops() {
+  ::dsnet::transaction::eris::proto::Stamp* _add = _internal_add_drops();
+  // @@protoc_insertion_point(field_add:dsnet.transaction.eris.proto.EpochChangeStateTransferAck.drops)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::dsnet::transaction::eris::proto::Stamp >&
+EpochChangeStateTransferAck::drops() const {
+  // @@protoc_insertion_point(field_list:dsnet.transaction.eris.proto.EpochChangeStateTransferAck.drops)
+  return _impl_.drops_;
+}
+
+// -------------------------------------------------------------------
+
+// ErisToFCMessage
+
+// required uint32 shard_num = 1;
+inline bool ErisToFCMessage::_internal_has_shard_num() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool ErisToFCMessage::has_shard_num() const {
+  return _internal_has_shard_num();
+}
+inline void ErisToFCMessage::clear_shard_num() {
+  _impl_.shard_num_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline uint32_t ErisToFCMessage::_internal_shard_num() const {
+  return _impl_.shard_num_;
+}
+inline uint32_t ErisToFCMessage::shard_num() const {
+  // @@protoc_insertion_point(field_get:dsnet.transaction.eris.proto.ErisToFCMessage.shard_num)
+  return _internal_shard_num();
+}
+inline void ErisToFCMessage::_internal_set_shard_num(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.shard_num_ = value;
+}
+inline void ErisToFCMessage::set_shard_num(uint32_t value) {
+  _internal_set_shard_num(value);
+  // @@protoc_insertion_point(field_set:dsnet.transaction.eris.proto.ErisToFCMessage.shard_num)
+}
+
+// required uint32 replica_num = 2;
+inline bool ErisToFCMessage::_internal_has_replica_num() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool ErisToFCMessage::has_replica_num() const {
+  return _internal_has_replica_num();
+}
+inline void ErisToFCMessage::clear_replica_num() {
+  _impl_.replica_num_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline uint32_t ErisToFCMessage::_internal_replica_num() const {
+  return _impl_.replica_num_;
+}
+inline uint32_t ErisToFCMessage::replica_num() const {
+  // @@protoc_insertion_point(field_get:dsnet.transaction.eris.proto.ErisToFCMessage.replica_num)
+  return _internal_replica_num();
+}
+inline void ErisToFCMessage::_internal_set_replica_num(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.replica_num_ = value;
+}
+inline void ErisToFCMessage::set_replica_num(uint32_t value) {
+  _internal_set_replica_num(value);
+  // @@protoc_insertion_point(field_set:dsnet.transaction.eris.proto.ErisToFCMessage.replica_num)
+}
+
+// required .dsnet.transaction.eris.proto.ViewNum local_view_num = 3;
+inline bool ErisToFCMessage::_internal_has_local_view_num() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.local_view_num_ != nullptr);
+  return value;
+}
+inline bool ErisToFCMessage::has_local_view_num() const {
+  return _internal_has_local_view_num();
+}
+inline void ErisToFCMessage::clear_local_view_num() {
+  if (_impl_.local_view_num_ != nullptr) _impl_.local_view_num_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const ::dsnet::transaction::eris::proto::ViewNum& ErisToFCMessage::_internal_local_view_num() const {
+  const ::dsnet::transaction::eris::proto::ViewNum* p = _impl_.local_view_num_;
+  return p != nullptr ? *p : reinterpret_cast<const ::dsnet::transaction::eris::proto::ViewNum&>(
+      ::dsnet::transaction::eris::proto::_ViewNum_default_instance_);
+}
+inline const ::dsnet::transaction::eris::proto::ViewNum& ErisToFCMessage::local_view_num() const {
+  // @@protoc_insertion_point(field_get:dsnet.transaction.eris.proto.ErisToFCMessage.local_view_num)
+  return _internal_local_view_num();
+}
+inline void ErisToFCMessage::unsafe_arena_set_allocated_local_view_num(
+    ::dsnet::transaction::eris::proto::ViewNum* local_view_num) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.local_view_num_);
+  }
+  _impl_.local_view_num_ = local_view_num;
+  if (local_view_num) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:dsnet.transaction.eris.proto.ErisToFCMessage.local_view_num)
+}
+inline ::dsnet::transaction::eris::proto::ViewNum* ErisToFCMessage::release_local_view_num() {
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::dsnet::transaction::eris::proto::ViewNum* temp = _impl_.local_view_num_;
+  _impl_.local_view_num_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::dsnet::transaction::eris::proto::ViewNum* ErisToFCMessage::unsafe_arena_release_local_view_num() {
+  // @@protoc_insertion_point(field_release:dsnet.transaction.eris.proto.ErisToFCMessage.local_view_num)
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::dsnet::transaction::eris::proto::ViewNum* temp = _impl_.local_view_num_;
+  _impl_.local_view_num_ = nullptr;
+  return temp;
+}
+inline ::dsnet::transaction::eris::proto::ViewNum* ErisToFCMessage::_internal_mutable_local_view_num() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  if (_impl_.local_view_num_ == nullptr) {
+    auto* p = CreateMaybeMessage<::dsnet::transaction::eris::proto::ViewNum>(GetArenaForAllocation());
+    _impl_.local_view_num_ = p;
+  }
+  return _impl_.local_view_num_;
+}
+inline ::dsnet::transaction::eris::proto::ViewNum* ErisToFCMessage::mutable_local_view_num() {
+  ::dsnet::transaction::eris::proto::ViewNum* _msg = _internal_mutable_local_view_num();
+  // @@protoc_insertion_point(field_mutable:dsnet.transaction.eris.proto.ErisToFCMessage.local_view_num)
+  return _msg;
+}
+inline void ErisToFCMessage::set_allocated_local_view_num(::dsnet::transaction::eris::proto::ViewNum* local_view_num) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.local_view_num_;
+  }
+  if (local_view_num) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(local_view_num);
+    if (message_arena != submessage_arena) {
+      local_view_num = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, local_view_num, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.local_view_num_ = local_view_num;
+  // @@protoc_insertion_point(field_set_allocated:dsnet.transaction.eris.proto.ErisToFCMessage.local_view_num)
+}
+
+// .dsnet.transaction.eris.proto.TxnInfoRequest txn_info_req = 4;
+inline bool ErisToFCMessage::_internal_has_txn_info_req() const {
+  return msg_case() == kTxnInfoReq;
+}
+inline bool ErisToFCMessage::has_txn_info_req() const {
+  return _internal_has_txn_info_req();
+}
+inline void ErisToFCMessage::set_has_txn_info_req() {
+  _impl_._oneof_case_[0] = kTxnInfoReq;
+}
+inline void ErisToFCMessage::clear_txn_info_req() {
+  if (_internal_has_txn_info_req()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.msg_.txn_info_req_;
+    }
+    clear_has_msg();
+  }
+}
+inline ::dsnet::transaction::eris::proto::TxnInfoRequest* ErisToFCMessage::release_txn_info_req() {
+  // @@protoc_insertion_point(field_release:dsnet.transaction.eris.proto.ErisToFCMessage.txn_info_req)
+  if (_internal_has_txn_info_req()) {
+    clear_has_msg();
+    ::dsnet::transaction::eris::proto::TxnInfoRequest* temp = _impl_.msg_.txn_info_req_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.msg_.txn_info_req_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::dsnet::transaction::eris::proto::TxnInfoRequest& ErisToFCMessage::_internal_txn_info_req() const {
+  return _internal_has_txn_info_req()
+      ? *_impl_.msg_.txn_info_req_
+      : reinterpret_cast< ::dsnet::transaction::eris::proto::TxnInfoRequest&>(::dsnet::transaction::eris::proto::_TxnInfoRequest_default_instance_);
+}
+inline const ::dsnet::transaction::eris::proto::TxnInfoRequest& ErisToFCMessage::txn_info_req() const {
+  // @@protoc_insertion_point(field_get:dsnet.transaction.eris.proto.ErisToFCMessage.txn_info_req)
+  return _internal_txn_info_req();
+}
+inline ::dsnet::transaction::eris::proto::TxnInfoRequest* ErisToFCMessage::unsafe_arena_release_txn_info_req() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:dsnet.transaction.eris.proto.ErisToFCMessage.txn_info_req)
+  if (_internal_has_txn_info_req()) {
+    clear_has_msg();
+    ::dsnet::transaction::eris::proto::TxnInfoRequest* temp = _impl_.msg_.txn_info_req_;
+    _impl_.msg_.txn_info_req_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void ErisToFCMessage::unsafe_arena_set_allocated_txn_info_req(::dsnet::transaction::eris::proto::TxnInfoRequest* txn_info_req) {
+  clear_msg();
+  if (txn_info_req) {
+    set_has_txn_info_req();
+    _impl_.msg_.txn_info_req_ = txn_info_req;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:dsnet.transaction.eris.proto.ErisToFCMessage.txn_info_req)
+}
+inline ::dsnet::transaction::eris::proto::TxnInfoRequest* ErisToFCMessage::_internal_mutable_txn_info_req() {
+  if (!_internal_has_txn_info_req()) {
+    clear_msg();
+    set_has_txn_info_req();
+    _impl_.msg_.txn_info_req_ = CreateMaybeMessage< ::dsnet::transaction::eris::proto::TxnInfoRequest >(GetArenaForAllocation());
+  }
+  return _impl_.msg_.txn_info_req_;
+}
+inline ::dsnet::transaction::eris::proto::TxnInfoRequest* ErisToFCMessage::mutable_txn_info_req() {
+  ::dsnet::transaction::eris::proto::TxnInfoRequest* _msg = _internal_mutable_txn_info_req();
+  // @@protoc_insertion_point(field_mutable:dsnet.transaction.eris.proto.ErisToFCMessage.txn_info_req)
+  return _msg;
+}
+
+// .dsnet.transaction.eris.proto.TxnReceived txn_received = 5;
+inline bool ErisToFCMessage::_internal_has_txn_received() const {
+  return msg_case() == kTxnReceived;
+}
+inline bool ErisToFCMessage::has_txn_received() const {
+  return _internal_has_txn_received();
+}
+inline void ErisToFCMessage::set_has_txn_received() {
+  _impl_._oneof_case_[0] = kTxnReceived;
+}
+inline void ErisToFCMessage::clear_txn_received() {
+  if (_internal_has_txn_received()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.msg_.txn_received_;
+    }
+    clear_has_msg();
+  }
+}
+inline ::dsnet::transaction::eris::proto::TxnReceived* ErisToFCMessage::release_txn_received() {
+  // @@protoc_insertion_point(field_release:dsnet.transaction.eris.proto.ErisToFCMessage.txn_received)
+  if (_internal_has_txn_received()) {
+    clear_has_msg();
+    ::dsnet::transaction::eris::proto::TxnReceived* temp = _impl_.msg_.txn_received_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.msg_.txn_received_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::dsnet::transaction::eris::proto::TxnReceived& ErisToFCMessage::_internal_txn_received() const {
+  return _internal_has_txn_received()
+      ? *_impl_.msg_.txn_received_
+      : reinterpret_cast< ::dsnet::transaction::eris::proto::TxnReceived&>(::dsnet::transaction::eris::proto::_TxnReceived_default_instance_);
+}
+inline const ::dsnet::transaction::eris::proto::TxnReceived& ErisToFCMessage::txn_received() const {
+  // @@protoc_insertion_point(field_get:dsnet.transaction.eris.proto.ErisToFCMessage.txn_received)
+  return _internal_txn_received();
+}
+inline ::dsnet::transaction::eris::proto::TxnReceived* ErisToFCMessage::unsafe_arena_release_txn_received() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:dsnet.transaction.eris.proto.ErisToFCMessage.txn_received)
+  if (_internal_has_txn_received()) {
+    clear_has_msg();
+    ::dsnet::transaction::eris::proto::TxnReceived* temp = _impl_.msg_.txn_received_;
+    _impl_.msg_.txn_received_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void ErisToFCMessage::unsafe_arena_set_allocated_txn_received(::dsnet::transaction::eris::proto::TxnReceived* txn_received) {
+  clear_msg();
+  if (txn_received) {
+    set_has_txn_received();
+    _impl_.msg_.txn_received_ = txn_received;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:dsnet.transaction.eris.proto.ErisToFCMessage.txn_received)
+}
+inline ::dsnet::transaction::eris::proto::TxnReceived* ErisToFCMessage::_internal_mutable_txn_received() {
+  if (!_internal_has_txn_received()) {
+    clear_msg();
+    set_has_txn_received();
+    _impl_.msg_.txn_received_ = CreateMaybeMessage< ::dsnet::transaction::eris::proto::TxnReceived >(GetArenaForAllocation());
+  }
+  return _impl_.msg_.txn_received_;
+}
+inline ::dsnet::transaction::eris::proto::TxnReceived* ErisToFCMessage::mutable_txn_received() {
+  ::dsnet::transaction::eris::proto::TxnReceived* _msg = _internal_mutable_txn_received();
+  // @@protoc_insertion_point(field_mutable:dsnet.transaction.eris.proto.ErisToFCMessage.txn_received)
+  return _msg;
+}
+
+// .dsnet.transaction.eris.proto.TxnTempDropped txn_temp_drop = 6;
+inline bool ErisToFCMessage::_internal_has_txn_temp_drop() const {
+  return msg_case() == kTxnTempDrop;
+}
+inline bool ErisToFCMessage::has_txn_temp_drop() const {
+  return _internal_has_txn_temp_drop();
+}
+inline void ErisToFCMessage::set_has_txn_temp_drop() {
+  _impl_._oneof_case_[0] = kTxnTempDrop;
+}
+inline void ErisToFCMessage::clear_txn_temp_drop() {
+  if (_internal_has_txn_temp_drop()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.msg_.txn_temp_drop_;
+    }
+    clear_has_msg();
+  }
+}
+inline ::dsnet::transaction::eris::proto::TxnTempDropped* ErisToFCMessage::release_txn_temp_drop() {
+  // @@protoc_insertion_point(field_release:dsnet.transaction.eris.proto.ErisToFCMessage.txn_temp_drop)
+  if (_internal_has_txn_temp_drop()) {
+    clear_has_msg();
+    ::dsnet::transaction::eris::proto::TxnTempDropped* temp = _impl_.msg_.txn_temp_drop_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.msg_.txn_temp_drop_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::dsnet::transaction::eris::proto::TxnTempDropped& ErisToFCMessage::_internal_txn_temp_drop() const {
+  return _internal_has_txn_temp_drop()
+      ? *_impl_.msg_.txn_temp_drop_
+      : reinterpret_cast< ::dsnet::transaction::eris::proto::TxnTempDropped&>(::dsnet::transaction::eris::proto::_TxnTempDropped_default_instance_);
+}
+inline const ::dsnet::transaction::eris::proto::TxnTempDropped& ErisToFCMessage::txn_temp_drop() const {
+  // @@protoc_insertion_point(field_get:dsnet.transaction.eris.proto.ErisToFCMessage.txn_temp_drop)
+  return _internal_txn_temp_drop();
+}
+inline ::dsnet::transaction::eris::proto::TxnTempDropped* ErisToFCMessage::unsafe_arena_release_txn_temp_drop() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:dsnet.transaction.eris.proto.ErisToFCMessage.txn_temp_drop)
+  if (_internal_has_txn_temp_drop()) {
+    clear_has_msg();
+    ::dsnet::transaction::eris::proto::TxnTempDropped* temp = _impl_.msg_.txn_temp_drop_;
+    _impl_.msg_.txn_temp_drop_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void ErisToFCMessage::unsafe_arena_set_allocated_txn_temp_drop(::dsnet::transaction::eris::proto::TxnTempDropped* txn_temp_drop) {
+  clear_msg();
+  if (txn_temp_drop) {
+    set_has_txn_temp_drop();
+    _impl_.msg_.txn_temp_drop_ = txn_temp_drop;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:dsnet.transaction.eris.proto.ErisToFCMessage.txn_temp_drop)
+}
+inline ::dsnet::transaction::eris::proto::TxnTempDropped* ErisToFCMessage::_internal_mutable_txn_temp_drop() {
+  if (!_internal_has_txn_temp_drop()) {
+    clear_msg();
+    set_has_txn_temp_drop();
+    _impl_.msg_.txn_temp_drop_ = CreateMaybeMessage< ::dsnet::transaction::eris::proto::TxnTempDropped >(GetArenaForAllocation());
+  }
+  return _impl_.msg_.txn_temp_drop_;
+}
+inline ::dsnet::transaction::eris::proto::TxnTempDropped* ErisToFCMessage::mutable_txn_temp_drop() {
+  ::dsnet::transaction::eris::proto::TxnTempDropped* _msg = _internal_mutable_txn_temp_drop();
+  // @@protoc_insertion_point(field_mutable:dsnet.transaction.eris.proto.ErisToFCMessage.txn_temp_drop)
+  return _msg;
+}
+
+// .dsnet.transaction.eris.proto.EpochChangeReq epoch_change_req = 7;
+inline bool ErisToFCMessage::_internal_has_epoch_change_req() const {
+  return msg_case() == kEpochChangeReq;
+}
+inline bool ErisToFCMessage::has_epoch_change_req() const {
+  return _internal_has_epoch_change_req();
+}
+inline void ErisToFCMessage::set_has_epoch_change_req() {
+  _impl_._oneof_case_[0] = kEpochChangeReq;
+}
+inline void ErisToFCMessage::clear_epoch_change_req() {
+  if (_internal_has_epoch_change_req()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.msg_.epoch_change_req_;
+    }
+    clear_has_msg();
+  }
+}
+inline ::dsnet::transaction::eris::proto::EpochChangeReq* ErisToFCMessage::release_epoch_change_req() {
+  // @@protoc_insertion_point(field_release:dsnet.transaction.eris.proto.ErisToFCMessage.epoch_change_req)
+  if (_internal_has_epoch_change_req()) {
+    clear_has_msg();
+    ::dsnet::transaction::eris::proto::EpochChangeReq* temp = _impl_.msg_.epoch_change_req_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.msg_.epoch_change_req_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::dsnet::transaction::eris::proto::EpochChangeReq& ErisToFCMessage::_internal_epoch_change_req() const {
+  return _internal_has_epoch_change_req()
+      ? *_impl_.msg_.epoch_change_req_
+      : reinterpret_cast< ::dsnet::transaction::eris::proto::EpochChangeReq&>(::dsnet::transaction::eris::proto::_EpochChangeReq_default_instance_);
+}
+inline const ::dsnet::transaction::eris::proto::EpochChangeReq& ErisToFCMessage::epoch_change_req() const {
+  // @@protoc_insertion_point(field_get:dsnet.transaction.eris.proto.ErisToFCMessage.epoch_change_req)
+  return _internal_epoch_change_req();
+}
+inline ::dsnet::transaction::eris::proto::EpochChangeReq* ErisToFCMessage::unsafe_arena_release_epoch_change_req() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:dsnet.transaction.eris.proto.ErisToFCMessage.epoch_change_req)
+  if (_internal_has_epoch_change_req()) {
+    clear_has_msg();
+    ::dsnet::transaction::eris::proto::EpochChangeReq* temp = _impl_.msg_.epoch_change_req_;
+    _impl_.msg_.epoch_change_req_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void ErisToFCMessage::unsafe_arena_set_allocated_epoch_change_req(::dsnet::transaction::eris::proto::EpochChangeReq* epoch_change_req) {
+  clear_msg();
+  if (epoch_change_req) {
+    set_has_epoch_change_req();
+    _impl_.msg_.epoch_change_req_ = epoch_change_req;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:dsnet.transaction.eris.proto.ErisToFCMessage.epoch_change_req)
+}
+inline ::dsnet::transaction::eris::proto::EpochChangeReq* ErisToFCMessage::_internal_mutable_epoch_change_req() {
+  if (!_internal_has_epoch_change_req()) {
+    clear_msg();
+    set_has_epoch_change_req();
+    _impl_.msg_.epoch_change_req_ = CreateMaybeMessage< ::dsnet::transaction::eris::proto::EpochChangeReq >(GetArenaForAllocation());
+  }
+  return _impl_.msg_.epoch_change_req_;
+}
+inline ::dsnet::transaction::eris::proto::EpochChangeReq* ErisToFCMessage::mutable_epoch_change_req() {
+  ::dsnet::transaction::eris::proto::EpochChangeReq* _msg = _internal_mutable_epoch_change_req();
+  // @@protoc_insertion_point(field_mutable:dsnet.transaction.eris.proto.ErisToFCMessage.epoch_change_req)
+  return _msg;
+}
+
+// .dsnet.transaction.eris.proto.EpochChangeAck epoch_change_ack = 8;
+inline bool ErisToFCMessage::_internal_has_epoch_change_ack() const {
+  return msg_case() == kEpochChangeAck;
+}
+inline bool ErisToFCMessage::has_epoch_change_ack() const {
+  return _internal_has_epoch_change_ack();
+}
+inline void ErisToFCMessage::set_has_epoch_change_ack() {
+  _impl_._oneof_case_[0] = kEpochChangeAck;
+}
+inline void ErisToFCMessage::clear_epoch_change_ack() {
+  if (_internal_has_epoch_change_ack()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.msg_.epoch_change_ack_;
+    }
+    clear_has_msg();
+  }
+}
+inline ::dsnet::transaction::eris::proto::EpochChangeAck* ErisToFCMessage::release_epoch_change_ack() {
+  // @@protoc_insertion_point(field_release:dsnet.transaction.eris.proto.ErisToFCMessage.epoch_change_ack)
+  if (_internal_has_epoch_change_ack()) {
+    clear_has_msg();
+    ::dsnet::transaction::eris::proto::EpochChangeAck* temp = _impl_.msg_.epoch_change_ack_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.msg_.epoch_change_ack_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::dsnet::transaction::eris::proto::EpochChangeAck& ErisToFCMessage::_internal_epoch_change_ack() const {
+  return _internal_has_epoch_change_ack()
+      ? *_impl_.msg_.epoch_change_ack_
+      : reinterpret_cast< ::dsnet::transaction::eris::proto::EpochChangeAck&>(::dsnet::transaction::eris::proto::_EpochChangeAck_default_instance_);
+}
+inline const ::dsnet::transaction::eris::proto::EpochChangeAck& ErisToFCMessage::epoch_change_ack() const {
+  // @@protoc_insertion_point(field_get:dsnet.transaction.eris.proto.ErisToFCMessage.epoch_change_ack)
+  return _internal_epoch_change_ack();
+}
+inline ::dsnet::transaction::eris::proto::EpochChangeAck* ErisToFCMessage::unsafe_arena_release_epoch_change_ack() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:dsnet.transaction.eris.proto.ErisToFCMessage.epoch_change_ack)
+  if (_internal_has_epoch_change_ack()) {
+    clear_has_msg();
+    ::dsnet::transaction::eris::proto::EpochChangeAck* temp = _impl_.msg_.epoch_change_ack_;
+    _impl_.msg_.epoch_change_ack_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void ErisToFCMessage::unsafe_arena_set_allocated_epoch_change_ack(::dsnet::transaction::eris::proto::EpochChangeAck* epoch_change_ack) {
+  clear_msg();
+  if (epoch_change_ack) {
+    set_has_epoch_change_ack();
+    _impl_.msg_.epoch_change_ack_ = epoch_change_ack;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:dsnet.transaction.eris.proto.ErisToFCMessage.epoch_change_ack)
+}
+inline ::dsnet::transaction::eris::proto::EpochChangeAck* ErisToFCMessage::_internal_mutable_epoch_change_ack() {
+  if (!_internal_has_epoch_change_ack()) {
+    clear_msg();
+    set_has_epoch_change_ack();
+    _impl_.msg_.epoch_change_ack_ = CreateMaybeMessage< ::dsnet::transaction::eris::proto::EpochChangeAck >(GetArenaForAllocation());
+  }
+  return _impl_.msg_.epoch_change_ack_;
+}
+inline ::dsnet::transaction::eris::proto::EpochChangeAck* ErisToFCMessage::mutable_epoch_change_ack() {
+  ::dsnet::transaction::eris::proto::EpochChangeAck* _msg = _internal_mutable_epoch_change_ack();
+  // @@protoc_insertion_point(field_mutable:dsnet.transaction.eris.proto.ErisToFCMessage.epoch_change_ack)
+  return _msg;
+}
+
+// .dsnet.transaction.eris.proto.EpochChangeStateTransferAck epoch_change_state_transfer_ack = 9;
+inline bool ErisToFCMessage::_internal_has_epoch_change_state_transfer_ack() const {
+  return msg_case() == kEpochChangeStateTransferAck;
+}
+inline bool ErisToFCMessage::has_epoch_change_state_transfer_ack() const {
+  return _internal_has_epoch_change_state_transfer_ack();
+}
+inline void ErisToFCMessage::set_has_epoch_change_state_transfer_ack() {
+  _impl_._oneof_case_[0] = kEpochChangeStateTransferAck;
+}
+inline void ErisToFCMessage::clear_epoch_change_state_transfer_ack() {
+  if (_internal_has_epoch_change_state_transfer_ack()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.msg_.epoch_change_state_transfer_ack_;
+    }
+    clear_has_msg();
+  }
+}
+inline ::dsnet::transaction::eris::proto::EpochChangeStateTransferAck* ErisToFCMessage::release_epoch_change_state_transfer_ack() {
+  // @@protoc_insertion_point(field_release:dsnet.transaction.eris.proto.ErisToFCMessage.epoch_change_state_transfer_ack)
+  if (_internal_has_epoch_change_state_transfer_ack()) {
+    clear_has_msg();
+    ::dsnet::transaction::eris::proto::EpochChangeStateTransferAck* temp = _impl_.msg_.epoch_change_state_transfer_ack_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.msg_.epoch_change_state_transfer_ack_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::dsnet::transaction::eris::proto::EpochChangeStateTransferAck& ErisToFCMessage::_internal_epoch_change_state_transfer_ack() const {
+  return _internal_has_epoch_change_state_transfer_ack()
+      ? *_impl_.msg_.epoch_change_state_transfer_ack_
+      : reinterpret_cast< ::dsnet::transaction::eris::proto::EpochChangeStateTransferAck&>(::dsnet::transaction::eris::proto::_EpochChangeStateTransferAck_default_instance_);
+}
+inline const ::dsnet::transaction::eris::proto::EpochChangeStateTransferAck& ErisToFCMessage::epoch_change_state_transfer_ack() const {
+  // @@protoc_insertion_point(field_get:dsnet.transaction.eris.proto.ErisToFCMessage.epoch_change_state_transfer_ack)
+  return _internal_epoch_change_state_transfer_ack();
+}
+inline ::dsnet::transaction::eris::proto::EpochChangeStateTransferAck* ErisToFCMessage::unsafe_arena_release_epoch_change_state_transfer_ack() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:dsnet.transaction.eris.proto.ErisToFCMessage.epoch_change_state_transfer_ack)
+  if (_internal_has_epoch_change_state_transfer_ack()) {
+    clear_has_msg();
+    ::dsnet::transaction::eris::proto::EpochChangeStateTransferAck* temp = _impl_.msg_.epoch_change_state_transfer_ack_;
+    _impl_.msg_.epoch_change_state_transfer_ack_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void ErisToFCMessage::unsafe_arena_set_allocated_epoch_change_state_transfer_ack(::dsnet::transaction::eris::proto::EpochChangeStateTransferAck* epoch_change_state_transfer_ack) {
+  clear_msg();
+  if (epoch_change_state_transfer_ack) {
+    set_has_epoch_change_state_transfer_ack();
+    _impl_.msg_.epoch_change_state_transfer_ack_ = epoch_change_state_transfer_ack;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:dsnet.transaction.eris.proto.ErisToFCMessage.epoch_change_state_transfer_ack)
+}
+inline ::dsnet::transaction::eris::proto::EpochChangeStateTransferAck* ErisToFCMessage::_internal_mutable_epoch_change_state_transfer_ack() {
+  if (!_internal_has_epoch_change_state_transfer_ack()) {
+    clear_msg();
+    set_has_epoch_change_state_transfer_ack();
+    _impl_.msg_.epoch_change_state_transfer_ack_ = CreateMaybeMessage< ::dsnet::transaction::eris::proto::EpochChangeStateTransferAck >(GetArenaForAllocation());
+  }
+  return _impl_.msg_.epoch_change_state_transfer_ack_;
+}
+inline ::dsnet::transaction::eris::proto::EpochChangeStateTransferAck* ErisToFCMessage::mutable_epoch_change_state_transfer_ack() {
+  ::dsnet::transaction::eris::proto::EpochChangeStateTransferAck* _msg = _internal_mutable_epoch_change_state_transfer_ack();
+  // @@protoc_insertion_point(field_mutable:dsnet.transaction.eris.proto.ErisToFCMessage.epoch_change_state_transfer_ack)
+  return _msg;
+}
+
+inline bool ErisToFCMessage::has_msg() const {
+  return msg_case() != MSG_NOT_SET;
+}
+inline void ErisToFCMessage::clear_has_msg() {
+  _impl_._oneof_case_[0] = MSG_NOT_SET;
+}
+inline ErisToFCMessage::MsgCase ErisToFCMessage::msg_case() const {
+  return ErisToFCMessage::MsgCase(_impl_._oneof_case_[0]);
+}
+// -------------------------------------------------------------------
+
+// TxnCheck
+
+// required .dsnet.transaction.eris.proto.Stamp txn_num = 1;
+inline bool TxnCheck::_internal_has_txn_num() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.txn_num_ != nullptr);
+  return value;
+}
+inline bool TxnCheck::has_txn_num() const {
+  return _internal_has_txn_num();
+}
+inline void TxnCheck::clear_txn_num() {
+  if (_impl_.txn_num_ != nullptr) _impl_.txn_num_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const ::dsnet::transaction::eris::proto::Stamp& TxnCheck::_internal_txn_num() const {
+  const ::dsnet::transaction::eris::proto::Stamp* p = _impl_.txn_num_;
+  return p != nullptr ? *p : reinterpret_cast<const ::dsnet::transaction::eris::proto::Stamp&>(
+      ::dsnet::transaction::eris::proto::_Stamp_default_instance_);
+}
+inline const ::dsnet::transaction::eris::proto::Stamp& TxnCheck::txn_num() const {
+  // @@protoc_insertion_point(field_get:dsnet.transaction.eris.proto.TxnCheck.txn_num)
+  return _internal_txn_num();
+}
+inline void TxnCheck::unsafe_arena_set_allocated_txn_num(
+    ::dsnet::transaction::eris::proto::Stamp* txn_num) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.txn_num_);
+  }
+  _impl_.txn_num_ = txn_num;
+  if (txn_num) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:dsnet.transaction.eris.proto.TxnCheck.txn_num)
+}
+inline ::dsnet::transaction::eris::proto::Stamp* TxnCheck::release_txn_num() {
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::dsnet::transaction::eris::proto::Stamp* temp = _impl_.txn_num_;
+  _impl_.txn_num_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::dsnet::transaction::eris::proto::Stamp* TxnCheck::unsafe_arena_release_txn_num() {
+  // @@protoc_insertion_point(field_release:dsnet.transaction.eris.proto.TxnCheck.txn_num)
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::dsnet::transaction::eris::proto::Stamp* temp = _impl_.txn_num_;
+  _impl_.txn_num_ = nullptr;
+  return temp;
+}
+inline ::dsnet::transaction::eris::proto::Stamp* TxnCheck::_internal_mutable_txn_num() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  if (_impl_.txn_num_ == nullptr) {
+    auto* p = CreateMaybeMessage<::dsnet::transaction::eris::proto::Stamp>(GetArenaForAllocation());
+    _impl_.txn_num_ = p;
+  }
+  return _impl_.txn_num_;
+}
+inline ::dsnet::transaction::eris::proto::Stamp* TxnCheck::mutable_txn_num() {
+  ::dsnet::transaction::eris::proto::Stamp* _msg = _internal_mutable_txn_num();
+  // @@protoc_insertion_point(field_mutable:dsnet.transaction.eris.proto.TxnCheck.txn_num)
+  return _msg;
+}
+inline void TxnCheck::set_allocated_txn_num(::dsnet::transaction::eris::proto::Stamp* txn_num) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.txn_num_;
+  }
+  if (txn_num) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(txn_num);
+    if (message_arena != submessage_arena) {
+      txn_num = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, txn_num, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.txn_num_ = txn_num;
+  // @@protoc_insertion_point(field_set_allocated:dsnet.transaction.eris.proto.TxnCheck.txn_num)
+}
+
+// -------------------------------------------------------------------
+
+// TxnFound
+
+// required .dsnet.transaction.eris.proto.RequestMessage txn = 1;
+inline bool TxnFound::_internal_has_txn() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.txn_ != nullptr);
+  return value;
+}
+inline bool TxnFound::has_txn() const {
+  return _internal_has_txn();
+}
+inline void TxnFound::clear_txn() {
+  if (_impl_.txn_ != nullptr) _impl_.txn_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const ::dsnet::transaction::eris::proto::RequestMessage& TxnFound::_internal_txn() const {
+  const ::dsnet::transaction::eris::proto::RequestMessage* p = _impl_.txn_;
+  return p != nullptr ? *p : reinterpret_cast<const ::dsnet::transaction::eris::proto::RequestMessage&>(
+      ::dsnet::transaction::eris::proto::_RequestMessage_default_instance_);
+}
+inline const ::dsnet::transaction::eris::proto::RequestMessage& TxnFound::txn() const {
+  // @@protoc_insertion_point(field_get:dsnet.transaction.eris.proto.TxnFound.txn)
+  return _internal_txn();
+}
+inline void TxnFound::unsafe_arena_set_allocated_txn(
+    ::dsnet::transaction::eris::proto::RequestMessage* txn) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.txn_);
+  }
+  _impl_.txn_ = txn;
+  if (txn) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:dsnet.transaction.eris.proto.TxnFound.txn)
+}
+inline ::dsnet::transaction::eris::proto::RequestMessage* TxnFound::release_txn() {
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::dsnet::transaction::eris::proto::RequestMessage* temp = _impl_.txn_;
+  _impl_.txn_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::dsnet::transaction::eris::proto::RequestMessage* TxnFound::unsafe_arena_release_txn() {
+  // @@protoc_insertion_point(field_release:dsnet.transaction.eris.proto.TxnFound.txn)
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::dsnet::transaction::eris::proto::RequestMessage* temp = _impl_.txn_;
+  _impl_.txn_ = nullptr;
+  return temp;
+}
+inline ::dsnet::transaction::eris::proto::RequestMessage* TxnFound::_internal_mutable_txn() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  if (_impl_.txn_ == nullptr) {
+    auto* p = CreateMaybeMessage<::dsnet::transaction::eris::proto::RequestMessage>(GetArenaForAllocation());
+    _impl_.txn_ = p;
+  }
+  return _impl_.txn_;
+}
+inline ::dsnet::transaction::eris::proto::RequestMessage* TxnFound::mutable_txn() {
+  ::dsnet::transaction::eris::proto::RequestMessage* _msg = _internal_mutable_txn();
+  // @@protoc_insertion_point(field_mutable:dsnet.transaction.eris.proto.TxnFound.txn)
+  return _msg;
+}
+inline void TxnFound::set_allocated_txn(::dsnet::transaction::eris::proto::RequestMessage* txn) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.txn_;
+  }
+  if (txn) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(txn);
+    if (message_arena != submessage_arena) {
+      txn = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, txn, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.txn_ = txn;
+  // @@protoc_insertion_point(field_set_allocated:dsnet.transaction.eris.proto.TxnFound.txn)
+}
+
+// -------------------------------------------------------------------
+
+// DropTxn
+
+// required .dsnet.transaction.eris.proto.Stamp txn_num = 1;
+inline bool DropTxn::_internal_has_txn_num() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.txn_num_ != nullptr);
+  return value;
+}
+inline bool DropTxn::has_txn_num() const {
+  return _internal_has_txn_num();
+}
+inline void DropTxn::clear_txn_num() {
+  if (_impl_.txn_num_ != nullptr) _impl_.txn_num_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const ::dsnet::transaction::eris::proto::Stamp& DropTxn::_internal_txn_num() const {
+  const ::dsnet::transaction::eris::proto::Stamp* p = _impl_.txn_num_;
+  return p != nullptr ? *p : reinterpret_cast<const ::dsnet::transaction::eris::proto::Stamp&>(
+      ::dsnet::transaction::eris::proto::_Stamp_default_instance_);
+}
+inline const ::dsnet::transaction::eris::proto::Stamp& DropTxn::txn_num() const {
+  // @@protoc_insertion_point(field_get:dsnet.transaction.eris.proto.DropTxn.txn_num)
+  return _internal_txn_num();
+}
+inline void DropTxn::unsafe_arena_set_allocated_txn_num(
+    ::dsnet::transaction::eris::proto::Stamp* txn_num) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.txn_num_);
+  }
+  _impl_.txn_num_ = txn_num;
+  if (txn_num) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:dsnet.transaction.eris.proto.DropTxn.txn_num)
+}
+inline ::dsnet::transaction::eris::proto::Stamp* DropTxn::release_txn_num() {
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::dsnet::transaction::eris::proto::Stamp* temp = _impl_.txn_num_;
+  _impl_.txn_num_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::dsnet::transaction::eris::proto::Stamp* DropTxn::unsafe_arena_release_txn_num() {
+  // @@protoc_insertion_point(field_release:dsnet.transaction.eris.proto.DropTxn.txn_num)
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::dsnet::transaction::eris::proto::Stamp* temp = _impl_.txn_num_;
+  _impl_.txn_num_ = nullptr;
+  return temp;
+}
+inline ::dsnet::transaction::eris::proto::Stamp* DropTxn::_internal_mutable_txn_num() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  if (_impl_.txn_num_ == nullptr) {
+    auto* p = CreateMaybeMessage<::dsnet::transaction::eris::proto::Stamp>(GetArenaForAllocation());
+    _impl_.txn_num_ = p;
+  }
+  return _impl_.txn_num_;
+}
+inline ::dsnet::transaction::eris::proto::Stamp* DropTxn::mutable_txn_num() {
+  ::dsnet::transaction::eris::proto::Stamp* _msg = _internal_mutable_txn_num();
+  // @@protoc_insertion_point(field_mutable:dsnet.transaction.eris.proto.DropTxn.txn_num)
+  return _msg;
+}
+inline void DropTxn::set_allocated_txn_num(::dsnet::transaction::eris::proto::Stamp* txn_num) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.txn_num_;
+  }
+  if (txn_num) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(txn_num);
+    if (message_arena != submessage_arena) {
+      txn_num = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, txn_num, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.txn_num_ = txn_num;
+  // @@protoc_insertion_point(field_set_allocated:dsnet.transaction.eris.proto.DropTxn.txn_num)
+}
+
+// -------------------------------------------------------------------
+
+// EpochChange
+
+// required uint32 new_epoch_num = 1;
+inline bool EpochChange::_internal_has_new_epoch_num() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool EpochChange::has_new_epoch_num() const {
+  return _internal_has_new_epoch_num();
+}
+inline void EpochChange::clear_new_epoch_num() {
+  _impl_.new_epoch_num_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline uint32_t EpochChange::_internal_new_epoch_num() const {
+  return _impl_.new_epoch_num_;
+}
+inline uint32_t EpochChange::new_epoch_num() const {
+  // @@protoc_insertion_point(field_get:dsnet.transaction.eris.proto.EpochChange.new_epoch_num)
+  return _internal_new_epoch_num();
+}
+inline void EpochChange::_internal_set_new_epoch_num(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.new_epoch_num_ = value;
+}
+inline void EpochChange::set_new_epoch_num(uint32_t value) {
+  _internal_set_new_epoch_num(value);
+  // @@protoc_insertion_point(field_set:dsnet.transaction.eris.proto.EpochChange.new_epoch_num)
+}
+
+// -------------------------------------------------------------------
+
+// EpochChangeStateTransfer_MsgEntry
+
+// required uint32 shard_num = 1;
+inline bool EpochChangeStateTransfer_MsgEntry::_internal_has_shard_num() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool EpochChangeStateTransfer_MsgEntry::has_shard_num() const {
+  return _internal_has_shard_num();
+}
+inline void EpochChangeStateTransfer_MsgEntry::clear_shard_num() {
+  _impl_.shard_num_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline uint32_t EpochChangeStateTransfer_MsgEntry::_internal_shard_num() const {
+  return _impl_.shard_num_;
+}
+inline uint32_t EpochChangeStateTransfer_MsgEntry::shard_num() const {
+  // @@protoc_insertion_point(field_get:dsnet.transaction.eris.proto.EpochChangeStateTransfer.MsgEntry.shard_num)
+  return _internal_shard_num();
+}
+inline void EpochChangeStateTransfer_MsgEntry::_internal_set_shard_num(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.shard_num_ = value;
+}
+inline void EpochChangeStateTransfer_MsgEntry::set_shard_num(uint32_t value) {
+  _internal_set_shard_num(value);
+  // @@protoc_insertion_point(field_set:dsnet.transaction.eris.proto.EpochChangeStateTransfer.MsgEntry.shard_num)
+}
+
+// required uint32 replica_num = 2;
+inline bool EpochChangeStateTransfer_MsgEntry::_internal_has_replica_num() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool EpochChangeStateTransfer_MsgEntry::has_replica_num() const {
+  return _internal_has_replica_num();
+}
+inline void EpochChangeStateTransfer_MsgEntry::clear_replica_num() {
+  _impl_.replica_num_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline uint32_t EpochChangeStateTransfer_MsgEntry::_internal_replica_num() const {
+  return _impl_.replica_num_;
+}
+inline uint32_t EpochChangeStateTransfer_MsgEntry::replica_num() const {
+  // @@protoc_insertion_point(field_get:dsnet.transaction.eris.proto.EpochChangeStateTransfer.MsgEntry.replica_num)
+  return _internal_replica_num();
+}
+inline void EpochChangeStateTransfer_MsgEntry::_internal_set_replica_num(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.replica_num_ = value;
+}
+inline void EpochChangeStateTransfer_MsgEntry::set_replica_num(uint32_t value) {
+  _internal_set_replica_num(value);
+  // @@protoc_insertion_point(field_set:dsnet.transaction.eris.proto.EpochChangeStateTransfer.MsgEntry.replica_num)
+}
+
+// required uint64 msg_num = 3;
+inline bool EpochChangeStateTransfer_MsgEntry::_internal_has_msg_num() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool EpochChangeStateTransfer_MsgEntry::has_msg_num() const {
+  return _internal_has_msg_num();
+}
+inline void EpochChangeStateTransfer_MsgEntry::clear_msg_num() {
+  _impl_.msg_num_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline uint64_t EpochChangeStateTransfer_MsgEntry::_internal_msg_num() const {
+  return _impl_.msg_num_;
+}
+inline uint64_t EpochChangeStateTransfer_MsgEntry::msg_num() const {
+  // @@protoc_insertion_point(field_get:dsnet.transaction.eris.proto.EpochChangeStateTransfer.MsgEntry.msg_num)
+  return _internal_msg_num();
+}
+inline void EpochChangeStateTransfer_MsgEntry::_internal_set_msg_num(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.msg_num_ = value;
+}
+inline void EpochChangeStateTransfer_MsgEntry::set_msg_num(uint64_t value) {
+  _internal_set_msg_num(value);
+  // @@protoc_insertion_point(field_set:dsnet.transaction.eris.proto.EpochChangeStateTransfer.MsgEntry.msg_num)
+}
+
+// -------------------------------------------------------------------
+
+// EpochChangeStateTransfer
+
+// required uint32 epoch_num = 1;
+inline bool EpochChangeStateTransfer::_internal_has_epoch_num() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool EpochChangeStateTransfer::has_epoch_num() const {
+  return _internal_has_epoch_num();
+}
+inline void EpochChangeStateTransfer::clear_epoch_num() {
+  _impl_.epoch_num_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline uint32_t EpochChangeStateTransfer::_internal_epoch_num() const {
+  return _impl_.epoch_num_;
+}
+inline uint32_t EpochChangeStateTransfer::epoch_num() const {
+  // @@protoc_insertion_point(field_get:dsnet.transaction.eris.proto.EpochChangeStateTransfer.epoch_num)
+  return _internal_epoch_num();
+}
+inline void EpochChangeStateTransfer::_internal_set_epoch_num(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.epoch_num_ = value;
+}
+inline void EpochChangeStateTransfer::set_epoch_num(uint32_t value) {
+  _internal_set_epoch_num(value);
+  // @@protoc_insertion_point(field_set:dsnet.transaction.eris.proto.EpochChangeStateTransfer.epoch_num)
+}
+
+// required uint32 state_transfer_epoch_num = 2;
+inline bool EpochChangeStateTransfer::_internal_has_state_transfer_epoch_num() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool EpochChangeStateTransfer::has_state_transfer_epoch_num() const {
+  return _internal_has_state_transfer_epoch_num();
+}
+inline void EpochChangeStateTransfer::clear_state_transfer_epoch_num() {
+  _impl_.state_transfer_epoch_num_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline uint32_t EpochChangeStateTransfer::_internal_state_transfer_epoch_num() const {
+  return _impl_.state_transfer_epoch_num_;
+}
+inline uint32_t EpochChangeStateTransfer::state_transfer_epoch_num() const {
+  // @@protoc_insertion_point(field_get:dsnet.transaction.eris.proto.EpochChangeStateTransfer.state_transfer_epoch_num)
+  return _internal_state_transfer_epoch_num();
+}
+inline void EpochChangeStateTransfer::_internal_set_state_transfer_epoch_num(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.state_transfer_epoch_num_ = value;
+}
+inline void EpochChangeStateTransfer::set_state_transfer_epoch_num(uint32_t value) {
+  _internal_set_state_transfer_epoch_num(value);
+  // @@protoc_insertion_point(field_set:dsnet.transaction.eris.proto.EpochChangeStateTransfer.state_transfer_epoch_num)
+}
+
+// repeated .dsnet.transaction.eris.proto.Stamp perm_drops = 3;
+inline int EpochChangeStateTransfer::_internal_perm_drops_size() const {
+  return _impl_.perm_drops_.size();
+}
+inline int EpochChangeStateTransfer::perm_drops_size() const {
+  return _internal_perm_drops_size();
+}
+inline void EpochChangeStateTransfer::clear_perm_drops() {
+  _impl_.perm_drops_.Clear();
+}
+inline ::dsnet::transaction::eris::proto::Stamp* EpochChangeStateTransfer::mutable_perm_drops(int index) {
+  // @@protoc_insertion_point(field_mutable:dsnet.transaction.eris.proto.EpochChangeStateTransfer.perm_drops)
+  return _impl_.perm_drops_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::dsnet::transaction::eris::proto::Stamp >*
+EpochChangeStateTransfer::mutable_perm_drops() {
+  // @@protoc_insertion_point(field_mutable_list:dsnet.transaction.eris.proto.EpochChangeStateTransfer.perm_drops)
+  return &_impl_.perm_drops_;
+}
+inline const ::dsnet::transaction::eris::proto::Stamp& EpochChangeStateTransfer::_internal_perm_drops(int index) const {
+  return _impl_.perm_drops_.Get(index);
+}
+inline const ::dsnet::transaction::eris::proto::Stamp& EpochChangeStateTransfer::perm_drops(int index) const {
+  // @@protoc_insertion_point(field_get:dsnet.transaction.eris.proto.EpochChangeStateTransfer.perm_drops)
+  return _internal_perm_drops(index);
+}
+inline ::dsnet::transaction::eris::proto::Stamp* EpochChangeStateTransfer::_internal_add_perm_drops() {
+  return _impl_.perm_drops_.Add();
+}
+inline ::dsnet::transaction::eris::proto::Stamp* EpochChangeStateTransfer::add_perm_drops() {
+  ::dsnet::transaction::eris::proto::Stamp* _add = _internal_add_perm_drops();
+  // @@protoc_insertion_point(field_add:dsnet.transaction.eris.proto.EpochChangeStateTransfer.perm_drops)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::dsnet::transaction::eris::proto::Stamp >&
+EpochChangeStateTransfer::perm_drops() const {
+  // @@protoc_insertion_point(field_list:dsnet.transaction.eris.proto.EpochChangeStateTransfer.perm_drops)
+  return _impl_.perm_drops_;
+}
+
+// repeated .dsnet.transaction.eris.proto.EpochChangeStateTransfer.MsgEntry latest_msgs = 4;
+inline int EpochChangeStateTransfer::_internal_latest_msgs_size() const {
+  return _impl_.latest_msgs_.size();
+}
+inline int EpochChangeStateTransfer::latest_msgs_size() const {
+  return _internal_latest_msgs_size();
+}
+inline void EpochChangeStateTransfer::clear_latest_msgs() {
+  _impl_.latest_msgs_.Clear();
+}
+inline ::dsnet::transaction::eris::proto::EpochChangeStateTransfer_MsgEntry* EpochChangeStateTransfer::mutable_latest_msgs(int index) {
+  // @@protoc_insertion_point(field_mutable:dsnet.transaction.eris.proto.EpochChangeStateTransfer.latest_msgs)
+  return _impl_.latest_msgs_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::dsnet::transaction::eris::proto::EpochChangeStateTransfer_MsgEntry >*
+EpochChangeStateTransfer::mutable_latest_msgs() {
+  // @@protoc_insertion_point(field_mutable_list:dsnet.transaction.eris.proto.EpochChangeStateTransfer.latest_msgs)
+  return &_impl_.latest_msgs_;
+}
+inline const ::dsnet::transaction::eris::proto::EpochChangeStateTransfer_MsgEntry& EpochChangeStateTransfer::_internal_latest_msgs(int index) const {
+  return _impl_.latest_msgs_.Get(index);
+}
+inline const ::dsnet::transaction::eris::proto::EpochChangeStateTransfer_MsgEntry& EpochChangeStateTransfer::latest_msgs(int index) const {
+  // @@protoc_insertion_point(field_get:dsnet.transaction.eris.proto.EpochChangeStateTransfer.latest_msgs)
+  return _internal_latest_msgs(index);
+}
+inline ::dsnet::transaction::eris::proto::EpochChangeStateTransfer_MsgEntry* EpochChangeStateTransfer::_internal_add_latest_msgs() {
+  return _impl_.latest_msgs_.Add();
+}
+inline ::dsnet::transaction::eris::proto::EpochChangeStateTransfer_MsgEntry* EpochChangeStateTransfer::add_latest_msgs() {
+  ::dsnet::transaction::eris::proto::EpochChangeStateTransfer_MsgEntry* _add = _internal_add_latest_msgs();
+  // @@protoc_insertion_point(field_add:dsnet.transaction.eris.proto.EpochChangeStateTransfer.latest_msgs)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::dsnet::transaction::eris::proto::EpochChangeStateTransfer_MsgEntry >&
+EpochChangeStateTransfer::latest_msgs() const {
+  // @@protoc_insertion_point(field_list:dsnet.transaction.eris.proto.EpochChangeStateTransfer.latest_msgs)
+  return _impl_.latest_msgs_;
+}
+
+// -------------------------------------------------------------------
+
+// StartEpoch
+
+// required .dsnet.transaction.eris.proto.ViewNum new_view = 1;
+inline bool StartEpoch::_internal_has_new_view() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.new_view_ != nullptr);
+  return value;
+}
+inline bool StartEpoch::has_new_view() const {
+  return _internal_has_new_view();
+}
+inline void StartEpoch::clear_new_view() {
+  if (_impl_.new_view_ != nullptr) _impl_.new_view_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const ::dsnet::transaction::eris::proto::ViewNum& StartEpoch::_internal_new_view() const {
+  const ::dsnet::transaction::eris::proto::ViewNum* p = _impl_.new_view_;
+  return p != nullptr ? *p : reinterpret_cast<const ::dsnet::transaction::eris::proto::ViewNum&>(
+      ::dsnet::transaction::eris::proto::_ViewNum_default_instance_);
+}
+inline const ::dsnet::transaction::eris::proto::ViewNum& StartEpoch::new_view() const {
+  // @@protoc_insertion_point(field_get:dsnet.transaction.eris.proto.StartEpoch.new_view)
+  return _internal_new_view();
+}
+inline void StartEpoch::unsafe_arena_set_allocated_new_view(
+    ::dsnet::transaction::eris::proto::ViewNum* new_view) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.new_view_);
+  }
+  _impl_.new_view_ = new_view;
+  if (new_view) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:dsnet.transaction.eris.proto.StartEpoch.new_view)
+}
+inline ::dsnet::transaction::eris::proto::ViewNum* StartEpoch::release_new_view() {
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::dsnet::transaction::eris::proto::ViewNum* temp = _impl_.new_view_;
+  _impl_.new_view_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::dsnet::transaction::eris::proto::ViewNum* StartEpoch::unsafe_arena_release_new_view() {
+  // @@protoc_insertion_point(field_release:dsnet.transaction.eris.proto.StartEpoch.new_view)
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::dsnet::transaction::eris::proto::ViewNum* temp = _impl_.new_view_;
+  _impl_.new_view_ = nullptr;
+  return temp;
+}
+inline ::dsnet::transaction::eris::proto::ViewNum* StartEpoch::_internal_mutable_new_view() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  if (_impl_.new_view_ == nullptr) {
+    auto* p = CreateMaybeMessage<::dsnet::transaction::eris::proto::ViewNum>(GetArenaForAllocation());
+    _impl_.new_view_ = p;
+  }
+  return _impl_.new_view_;
+}
+inline ::dsnet::transaction::eris::proto::ViewNum* StartEpoch::mutable_new_view() {
+  ::dsnet::transaction::eris::proto::ViewNum* _msg = _internal_mutable_new_view();
+  // @@protoc_insertion_point(field_mutable:dsnet.transaction.eris.proto.StartEpoch.new_view)
+  return _msg;
+}
+inline void StartEpoch::set_allocated_new_view(::dsnet::transaction::eris::proto::ViewNum* new_view) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.new_view_;
+  }
+  if (new_view) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(new_view);
+    if (message_arena != submessage_arena) {
+      new_view = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, new_view, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.new_view_ = new_view;
+  // @@protoc_insertion_point(field_set_allocated:dsnet.transaction.eris.proto.StartEpoch.new_view)
+}
+
+// required uint64 last_normal_epoch_num = 2;
+inline bool StartEpoch::_internal_has_last_normal_epoch_num() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool StartEpoch::has_last_normal_epoch_num() const {
+  return _internal_has_last_normal_epoch_num();
+}
+inline void StartEpoch::clear_last_normal_epoch_num() {
+  _impl_.last_normal_epoch_num_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline uint64_t StartEpoch::_internal_last_normal_epoch_num() const {
+  return _impl_.last_normal_epoch_num_;
+}
+inline uint64_t StartEpoch::last_normal_epoch_num() const {
+  // @@protoc_insertion_point(field_get:dsnet.transaction.eris.proto.StartEpoch.last_normal_epoch_num)
+  return _internal_last_normal_epoch_num();
+}
+inline void StartEpoch::_internal_set_last_normal_epoch_num(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.last_normal_epoch_num_ = value;
+}
+inline void StartEpoch::set_last_normal_epoch_num(uint64_t value) {
+  _internal_set_last_normal_epoch_num(value);
+  // @@protoc_insertion_point(field_set:dsnet.transaction.eris.proto.StartEpoch.last_normal_epoch_num)
+}
+
+// repeated .dsnet.transaction.eris.proto.Stamp perm_drops = 3;
+inline int StartEpoch::_internal_perm_drops_size() const {
+  return _impl_.perm_drops_.size();
+}
+inline int StartEpoch::perm_drops_size() const {
+  return _internal_perm_drops_size();
+}
+inline void StartEpoch::clear_perm_drops() {
+  _impl_.perm_drops_.Clear();
+}
+inline ::dsnet::transaction::eris::proto::Stamp* StartEpoch::mutable_perm_drops(int index) {
+  // @@protoc_insertion_point(field_mutable:dsnet.transaction.eris.proto.StartEpoch.perm_drops)
+  return _impl_.perm_drops_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::dsnet::transaction::eris::proto::Stamp >*
+StartEpoch::mutable_perm_drops() {
+  // @@protoc_insertion_point(field_mutable_list:dsnet.transaction.eris.proto.StartEpoch.perm_drops)
+  return &_impl_.perm_drops_;
+}
+inline const ::dsnet::transaction::eris::proto::Stamp& StartEpoch::_internal_perm_drops(int index) const {
+  return _impl_.perm_drops_.Get(index);
+}
+inline const ::dsnet::transaction::eris::proto::Stamp& StartEpoch::perm_drops(int index) const {
+  // @@protoc_insertion_point(field_get:dsnet.transaction.eris.proto.StartEpoch.perm_drops)
+  return _internal_perm_drops(index);
+}
+inline ::dsnet::transaction::eris::proto::Stamp* StartEpoch::_internal_add_perm_drops() {
+  return _impl_.perm_drops_.Add();
+}
+inline ::dsnet::transaction::eris::proto::Stamp* StartEpoch::add_perm_drops() {
+  ::dsnet::transaction::eris::proto::Stamp* _add = _internal_add_perm_drops();
+  // @@protoc_insertion_point(field_add:dsnet.transaction.eris.proto.StartEpoch.perm_drops)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::dsnet::transaction::eris::proto::Stamp >&
+StartEpoch::perm_drops() const {
+  // @@protoc_insertion_point(field_list:dsnet.transaction.eris.proto.StartEpoch.perm_drops)
+  return _impl_.perm_drops_;
+}
+
+// required uint32 latest_replica_num = 4;
+inline bool StartEpoch::_internal_has_latest_replica_num() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  return value;
+}
+inline bool StartEpoch::has_latest_replica_num() const {
+  return _internal_has_latest_replica_num();
+}
+inline void StartEpoch::clear_latest_replica_num() {
+  _impl_.latest_replica_num_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000008u;
+}
+inline uint32_t StartEpoch::_internal_latest_replica_num() const {
+  return _impl_.latest_replica_num_;
+}
+inline uint32_t StartEpoch::latest_replica_num() const {
+  // @@protoc_insertion_point(field_get:dsnet.transaction.eris.proto.StartEpoch.latest_replica_num)
+  return _internal_latest_replica_num();
+}
+inline void StartEpoch::_internal_set_latest_replica_num(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  _impl_.latest_replica_num_ = value;
+}
+inline void StartEpoch::set_latest_replica_num(uint32_t value) {
+  _internal_set_latest_replica_num(value);
+  // @@protoc_insertion_point(field_set:dsnet.transaction.eris.proto.StartEpoch.latest_replica_num)
+}
+
+// required uint64 latest_op_num = 5;
+inline bool StartEpoch::_internal_has_latest_op_num() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool StartEpoch::has_latest_op_num() const {
+  return _internal_has_latest_op_num();
+}
+inline void StartEpoch::clear_latest_op_num() {
+  _impl_.latest_op_num_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline uint64_t StartEpoch::_internal_latest_op_num() const {
+  return _impl_.latest_op_num_;
+}
+inline uint64_t StartEpoch::latest_op_num() const {
+  // @@protoc_insertion_point(field_get:dsnet.transaction.eris.proto.StartEpoch.latest_op_num)
+  return _internal_latest_op_num();
+}
+inline void StartEpoch::_internal_set_latest_op_num(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.latest_op_num_ = value;
+}
+inline void StartEpoch::set_latest_op_num(uint64_t value) {
+  _internal_set_latest_op_num(value);
+  // @@protoc_insertion_point(field_set:dsnet.transaction.eris.proto.StartEpoch.latest_op_num)
+}
+
+// -------------------------------------------------------------------
+
+// FCToErisMessage
+
+// .dsnet.transaction.eris.proto.TxnCheck txn_check = 1;
+inline bool FCToErisMessage::_internal_has_txn_check() const {
+  return msg_case() == kTxnCheck;
+}
+inline bool FCToErisMessage::has_txn_check() const {
+  return _internal_has_txn_check();
+}
+inline void FCToErisMessage::set_has_txn_check() {
+  _impl_._oneof_case_[0] = kTxnCheck;
+}
+inline void FCToErisMessage::clear_txn_check() {
+  if (_internal_has_txn_check()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.msg_.txn_check_;
+    }
+    clear_has_msg();
+  }
+}
+inline ::dsnet::transaction::eris::proto::TxnCheck* FCToErisMessage::release_txn_check() {
+  // @@protoc_insertion_point(field_release:dsnet.transaction.eris.proto.FCToErisMessage.txn_check)
+  if (_internal_has_txn_check()) {
+    clear_has_msg();
+    ::dsnet::transaction::eris::proto::TxnCheck* temp = _impl_.msg_.txn_check_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.msg_.txn_check_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::dsnet::transaction::eris::proto::TxnCheck& FCToErisMessage::_internal_txn_check() const {
+  return _internal_has_txn_check()
+      ? *_impl_.msg_.txn_check_
+      : reinterpret_cast< ::dsnet::transaction::eris::proto::TxnCheck&>(::dsnet::transaction::eris::proto::_TxnCheck_default_instance_);
+}
+inline const ::dsnet::transaction::eris::proto::TxnCheck& FCToErisMessage::txn_check() const {
+  // @@protoc_insertion_point(field_get:dsnet.transaction.eris.proto.FCToErisMessage.txn_check)
+  return _internal_txn_check();
+}
+inline ::dsnet::transaction::eris::proto::TxnCheck* FCToErisMessage::unsafe_arena_release_txn_check() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:dsnet.transaction.eris.proto.FCToErisMessage.txn_check)
+  if (_internal_has_txn_check()) {
+    clear_has_msg();
+    ::dsnet::transaction::eris::proto::TxnCheck* temp = _impl_.msg_.txn_check_;
+    _impl_.msg_.txn_check_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void FCToErisMessage::unsafe_arena_set_allocated_txn_check(::dsnet::transaction::eris::proto::TxnCheck* txn_check) {
+  clear_msg();
+  if (txn_check) {
+    set_has_txn_check();
+    _impl_.msg_.txn_check_ = txn_check;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:dsnet.transaction.eris.proto.FCToErisMessage.txn_check)
+}
+inline ::dsnet::transaction::eris::proto::TxnCheck* FCToErisMessage::_internal_mutable_txn_check() {
+  if (!_internal_has_txn_check()) {
+    clear_msg();
+    set_has_txn_check();
+    _impl_.msg_.txn_check_ = CreateMaybeMessage< ::dsnet::transaction::eris::proto::TxnCheck >(GetArenaForAllocation());
+  }
+  return _impl_.msg_.txn_check_;
+}
+inline ::dsnet::transaction::eris::proto::TxnCheck* FCToErisMessage::mutable_txn_check() {
+  ::dsnet::transaction::eris::proto::TxnCheck* _msg = _internal_mutable_txn_check();
+  // @@protoc_insertion_point(field_mutable:dsnet.transaction.eris.proto.FCToErisMessage.txn_check)
+  return _msg;
+}
+
+// .dsnet.transaction.eris.proto.TxnFound txn_found = 2;
+inline bool FCToErisMessage::_internal_has_txn_found() const {
+  return msg_case() == kTxnFound;
+}
+inline bool FCToErisMessage::has_txn_found() const {
+  return _internal_has_txn_found();
+}
+inline void FCToErisMessage::set_has_txn_found() {
+  _impl_._oneof_case_[0] = kTxnFound;
+}
+inline void FCToErisMessage::clear_txn_found() {
+  if (_internal_has_txn_found()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.msg_.txn_found_;
+    }
+    clear_has_msg();
+  }
+}
+inline ::dsnet::transaction::eris::proto::TxnFound* FCToErisMessage::release_txn_found() {
+  // @@protoc_insertion_point(field_release:dsnet.transaction.eris.proto.FCToErisMessage.txn_found)
+  if (_internal_has_txn_found()) {
+    clear_has_msg();
+    ::dsnet::transaction::eris::proto::TxnFound* temp = _impl_.msg_.txn_found_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.msg_.txn_found_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::dsnet::transaction::eris::proto::TxnFound& FCToErisMessage::_internal_txn_found() const {
+  return _internal_has_txn_found()
+      ? *_impl_.msg_.txn_found_
+      : reinterpret_cast< ::dsnet::transaction::eris::proto::TxnFound&>(::dsnet::transaction::eris::proto::_TxnFound_default_instance_);
+}
+inline const ::dsnet::transaction::eris::proto::TxnFound& FCToErisMessage::txn_found() const {
+  // @@protoc_insertion_point(field_get:dsnet.transaction.eris.proto.FCToErisMessage.txn_found)
+  return _internal_txn_found();
+}
+inline ::dsnet::transaction::eris::proto::TxnFound* FCToErisMessage::unsafe_arena_release_txn_found() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:dsnet.transaction.eris.proto.FCToErisMessage.txn_found)
+  if (_internal_has_txn_found()) {
+    clear_has_msg();
+    ::dsnet::transaction::eris::proto::TxnFound* temp = _impl_.msg_.txn_found_;
+    _impl_.msg_.txn_found_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void FCToErisMessage::unsafe_arena_set_allocated_txn_found(::dsnet::transaction::eris::proto::TxnFound* txn_found) {
+  clear_msg();
+  if (txn_found) {
+    set_has_txn_found();
+    _impl_.msg_.txn_found_ = txn_found;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:dsnet.transaction.eris.proto.FCToErisMessage.txn_found)
+}
+inline ::dsnet::transaction::eris::proto::TxnFound* FCToErisMessage::_internal_mutable_txn_found() {
+  if (!_internal_has_txn_found()) {
+    clear_msg();
+    set_has_txn_found();
+    _impl_.msg_.txn_found_ = CreateMaybeMessage< ::dsnet::transaction::eris::proto::TxnFound >(GetArenaForAllocation());
+  }
+  return _impl_.msg_.txn_found_;
+}
+inline ::dsnet::transaction::eris::proto::TxnFound* FCToErisMessage::mutable_txn_found() {
+  ::dsnet::transaction::eris::proto::TxnFound* _msg = _internal_mutable_txn_found();
+  // @@protoc_insertion_point(field_mutable:dsnet.transaction.eris.proto.FCToErisMessage.txn_found)
+  return _msg;
+}
+
+// .dsnet.transaction.eris.proto.DropTxn drop_txn = 3;
+inline bool FCToErisMessage::_internal_has_drop_txn() const {
+  return msg_case() == kDropTxn;
+}
+inline bool FCToErisMessage::has_drop_txn() const {
+  return _internal_has_drop_txn();
+}
+inline void FCToErisMessage::set_has_drop_txn() {
+  _impl_._oneof_case_[0] = kDropTxn;
+}
+inline void FCToErisMessage::clear_drop_txn() {
+  if (_internal_has_drop_txn()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.msg_.drop_txn_;
+    }
+    clear_has_msg();
+  }
+}
+inline ::dsnet::transaction::eris::proto::DropTxn* FCToErisMessage::release_drop_txn() {
+  // @@protoc_insertion_point(field_release:dsnet.transaction.eris.proto.FCToErisMessage.drop_txn)
+  if (_internal_has_drop_txn()) {
+    clear_has_msg();
+    ::dsnet::transaction::eris::proto::DropTxn* temp = _impl_.msg_.drop_txn_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.msg_.drop_txn_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::dsnet::transaction::eris::proto::DropTxn& FCToErisMessage::_internal_drop_txn() const {
+  return _internal_has_drop_txn()
+      ? *_impl_.msg_.drop_txn_
+      : reinterpret_cast< ::dsnet::transaction::eris::proto::DropTxn&>(::dsnet::transaction::eris::proto::_DropTxn_default_instance_);
+}
+inline const ::dsnet::transaction::eris::proto::DropTxn& FCToErisMessage::drop_txn() const {
+  // @@protoc_insertion_point(field_get:dsnet.transaction.eris.proto.FCToErisMessage.drop_txn)
+  return _internal_drop_txn();
+}
+inline ::dsnet::transaction::eris::proto::DropTxn* FCToErisMessage::unsafe_arena_release_drop_txn() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:dsnet.transaction.eris.proto.FCToErisMessage.drop_txn)
+  if (_internal_has_drop_txn()) {
+    clear_has_msg();
+    ::dsnet::transaction::eris::proto::DropTxn* temp = _impl_.msg_.drop_txn_;
+    _impl_.msg_.drop_txn_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void FCToErisMessage::unsafe_arena_set_allocated_drop_txn(::dsnet::transaction::eris::proto::DropTxn* drop_txn) {
+  clear_msg();
+  if (drop_txn) {
+    set_has_drop_txn();
+    _impl_.msg_.drop_txn_ = drop_txn;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:dsnet.transaction.eris.proto.FCToErisMessage.drop_txn)
+}
+inline ::dsnet::transaction::eris::proto::DropTxn* FCToErisMessage::_internal_mutable_drop_txn() {
+  if (!_internal_has_drop_txn()) {
+    clear_msg();
+    set_has_drop_txn();
+    _impl_.msg_.drop_txn_ = CreateMaybeMessage< ::dsnet::transaction::eris::proto::DropTxn >(GetArenaForAllocation());
+  }
+  return _impl_.msg_.drop_txn_;
+}
+inline ::dsnet::transaction::eris::proto::DropTxn* FCToErisMessage::mutable_drop_txn() {
+  ::dsnet::transaction::eris::proto::DropTxn* _msg = _internal_mutable_drop_txn();
+  // @@protoc_insertion_point(field_mutable:dsnet.transaction.eris.proto.FCToErisMessage.drop_txn)
+  return _msg;
+}
+
+// .dsnet.transaction.eris.proto.EpochChange epoch_change = 4;
+inline bool FCToErisMessage::_internal_has_epoch_change() const {
+  return msg_case() == kEpochChange;
+}
+inline bool FCToErisMessage::has_epoch_change() const {
+  return _internal_has_epoch_change();
+}
+inline void FCToErisMessage::set_has_epoch_change() {
+  _impl_._oneof_case_[0] = kEpochChange;
+}
+inline void FCToErisMessage::clear_epoch_change() {
+  if (_internal_has_epoch_change()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.msg_.epoch_change_;
+    }
+    clear_has_msg();
+  }
+}
+inline ::dsnet::transaction::eris::proto::EpochChange* FCToErisMessage::release_epoch_change() {
+  // @@protoc_insertion_point(field_release:dsnet.transaction.eris.proto.FCToErisMessage.epoch_change)
+  if (_internal_has_epoch_change()) {
+    clear_has_msg();
+    ::dsnet::transaction::eris::proto::EpochChange* temp = _impl_.msg_.epoch_change_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.msg_.epoch_change_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::dsnet::transaction::eris::proto::EpochChange& FCToErisMessage::_internal_epoch_change() const {
+  return _internal_has_epoch_change()
+      ? *_impl_.msg_.epoch_change_
+      : reinterpret_cast< ::dsnet::transaction::eris::proto::EpochChange&>(::dsnet::transaction::eris::proto::_EpochChange_default_instance_);
+}
+inline const ::dsnet::transaction::eris::proto::EpochChange& FCToErisMessage::epoch_change() const {
+  // @@protoc_insertion_point(field_get:dsnet.transaction.eris.proto.FCToErisMessage.epoch_change)
+  return _internal_epoch_change();
+}
+inline ::dsnet::transaction::eris::proto::EpochChange* FCToErisMessage::unsafe_arena_release_epoch_change() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:dsnet.transaction.eris.proto.FCToErisMessage.epoch_change)
+  if (_internal_has_epoch_change()) {
+    clear_has_msg();
+    ::dsnet::transaction::eris::proto::EpochChange* temp = _impl_.msg_.epoch_change_;
+    _impl_.msg_.epoch_change_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void FCToErisMessage::unsafe_arena_set_allocated_epoch_change(::dsnet::transaction::eris::proto::EpochChange* epoch_change) {
+  clear_msg();
+  if (epoch_change) {
+    set_has_epoch_change();
+    _impl_.msg_.epoch_change_ = epoch_change;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:dsnet.transaction.eris.proto.FCToErisMessage.epoch_change)
+}
+inline ::dsnet::transaction::eris::proto::EpochChange* FCToErisMessage::_internal_mutable_epoch_change() {
+  if (!_internal_has_epoch_change()) {
+    clear_msg();
+    set_has_epoch_change();
+    _impl_.msg_.epoch_change_ = CreateMaybeMessage< ::dsnet::transaction::eris::proto::EpochChange >(GetArenaForAllocation());
+  }
+  return _impl_.msg_.epoch_change_;
+}
+inline ::dsnet::transaction::eris::proto::EpochChange* FCToErisMessage::mutable_epoch_change() {
+  ::dsnet::transaction::eris::proto::EpochChange* _msg = _internal_mutable_epoch_change();
+  // @@protoc_insertion_point(field_mutable:dsnet.transaction.eris.proto.FCToErisMessage.epoch_change)
+  return _msg;
+}
+
+// .dsnet.transaction.eris.proto.EpochChangeStateTransfer epoch_change_state_transfer = 5;
+inline bool FCToErisMessage::_internal_has_epoch_change_state_transfer() const {
+  return msg_case() == kEpochChangeStateTransfer;
+}
+inline bool FCToErisMessage::has_epoch_change_state_transfer() const {
+  return _internal_has_epoch_change_state_transfer();
+}
+inline void FCToErisMessage::set_has_epoch_change_state_transfer() {
+  _impl_._oneof_case_[0] = kEpochChangeStateTransfer;
+}
+inline void FCToErisMessage::clear_epoch_change_state_transfer() {
+  if (_internal_has_epoch_change_state_transfer()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.msg_.epoch_change_state_transfer_;
+    }
+    clear_has_msg();
+  }
+}
+inline ::dsnet::transaction::eris::proto::EpochChangeStateTransfer* FCToErisMessage::release_epoch_change_state_transfer() {
+  // @@protoc_insertion_point(field_release:dsnet.transaction.eris.proto.FCToErisMessage.epoch_change_state_transfer)
+  if (_internal_has_epoch_change_state_transfer()) {
+    clear_has_msg();
+    ::dsnet::transaction::eris::proto::EpochChangeStateTransfer* temp = _impl_.msg_.epoch_change_state_transfer_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.msg_.epoch_change_state_transfer_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::dsnet::transaction::eris::proto::EpochChangeStateTransfer& FCToErisMessage::_internal_epoch_change_state_transfer() const {
+  return _internal_has_epoch_change_state_transfer()
+      ? *_impl_.msg_.epoch_change_state_transfer_
+      : reinterpret_cast< ::dsnet::transaction::eris::proto::EpochChangeStateTransfer&>(::dsnet::transaction::eris::proto::_EpochChangeStateTransfer_default_instance_);
+}
+inline const ::dsnet::transaction::eris::proto::EpochChangeStateTransfer& FCToErisMessage::epoch_change_state_transfer() const {
+  // @@protoc_insertion_point(field_get:dsnet.transaction.eris.proto.FCToErisMessage.epoch_change_state_transfer)
+  return _internal_epoch_change_state_transfer();
+}
+inline ::dsnet::transaction::eris::proto::EpochChangeStateTransfer* FCToErisMessage::unsafe_arena_release_epoch_change_state_transfer() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:dsnet.transaction.eris.proto.FCToErisMessage.epoch_change_state_transfer)
+  if (_internal_has_epoch_change_state_transfer()) {
+    clear_has_msg();
+    ::dsnet::transaction::eris::proto::EpochChangeStateTransfer* temp = _impl_.msg_.epoch_change_state_transfer_;
+    _impl_.msg_.epoch_change_state_transfer_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void FCToErisMessage::unsafe_arena_set_allocated_epoch_change_state_transfer(::dsnet::transaction::eris::proto::EpochChangeStateTransfer* epoch_change_state_transfer) {
+  clear_msg();
+  if (epoch_change_state_transfer) {
+    set_has_epoch_change_state_transfer();
+    _impl_.msg_.epoch_change_state_transfer_ = epoch_change_state_transfer;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:dsnet.transaction.eris.proto.FCToErisMessage.epoch_change_state_transfer)
+}
+inline ::dsnet::transaction::eris::proto::EpochChangeStateTransfer* FCToErisMessage::_internal_mutable_epoch_change_state_transfer() {
+  if (!_internal_has_epoch_change_state_transfer()) {
+    clear_msg();
+    set_has_epoch_change_state_transfer();
+    _impl_.msg_.epoch_change_state_transfer_ = CreateMaybeMessage< ::dsnet::transaction::eris::proto::EpochChangeStateTransfer >(GetArenaForAllocation());
+  }
+  return _impl_.msg_.epoch_change_state_transfer_;
+}
+inline ::dsnet::transaction::eris::proto::EpochChangeStateTransfer* FCToErisMessage::mutable_epoch_change_state_transfer() {
+  ::dsnet::transaction::eris::proto::EpochChangeStateTransfer* _msg = _internal_mutable_epoch_change_state_transfer();
+  // @@protoc_insertion_point(field_mutable:dsnet.transaction.eris.proto.FCToErisMessage.epoch_change_state_transfer)
+  return _msg;
+}
+
+// .dsnet.transaction.eris.proto.StartEpoch start_epoch = 6;
+inline bool FCToErisMessage::_internal_has_start_epoch() const {
+  return msg_case() == kStartEpoch;
+}
+inline bool FCToErisMessage::has_start_epoch() const {
+  return _internal_has_start_epoch();
+}
+inline void FCToErisMessage::set_has_start_epoch() {
+  _impl_._oneof_case_[0] = kStartEpoch;
+}
+inline void FCToErisMessage::clear_start_epoch() {
+  if (_internal_has_start_epoch()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.msg_.start_epoch_;
+    }
+    clear_has_msg();
+  }
+}
+inline ::dsnet::transaction::eris::proto::StartEpoch* FCToErisMessage::release_start_epoch() {
+  // @@protoc_insertion_point(field_release:dsnet.transaction.eris.proto.FCToErisMessage.start_epoch)
+  if (_internal_has_start_epoch()) {
+    clear_has_msg();
+    ::dsnet::transaction::eris::proto::StartEpoch* temp = _impl_.msg_.start_epoch_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.msg_.start_epoch_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::dsnet::transaction::eris::proto::StartEpoch& FCToErisMessage::_internal_start_epoch() const {
+  return _internal_has_start_epoch()
+      ? *_impl_.msg_.start_epoch_
+      : reinterpret_cast< ::dsnet::transaction::eris::proto::StartEpoch&>(::dsnet::transaction::eris::proto::_StartEpoch_default_instance_);
+}
+inline const ::dsnet::transaction::eris::proto::StartEpoch& FCToErisMessage::start_epoch() const {
+  // @@protoc_insertion_point(field_get:dsnet.transaction.eris.proto.FCToErisMessage.start_epoch)
+  return _internal_start_epoch();
+}
+inline ::dsnet::transaction::eris::proto::StartEpoch* FCToErisMessage::unsafe_arena_release_start_epoch() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:dsnet.transaction.eris.proto.FCToErisMessage.start_epoch)
+  if (_internal_has_start_epoch()) {
+    clear_has_msg();
+    ::dsnet::transaction::eris::proto::StartEpoch* temp = _impl_.msg_.start_epoch_;
+    _impl_.msg_.start_epoch_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void FCToErisMessage::unsafe_arena_set_allocated_start_epoch(::dsnet::transaction::eris::proto::StartEpoch* start_epoch) {
+  clear_msg();
+  if (start_epoch) {
+    set_has_start_epoch();
+    _impl_.msg_.start_epoch_ = start_epoch;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:dsnet.transaction.eris.proto.FCToErisMessage.start_epoch)
+}
+inline ::dsnet::transaction::eris::proto::StartEpoch* FCToErisMessage::_internal_mutable_start_epoch() {
+  if (!_internal_has_start_epoch()) {
+    clear_msg();
+    set_has_start_epoch();
+    _impl_.msg_.start_epoch_ = CreateMaybeMessage< ::dsnet::transaction::eris::proto::StartEpoch >(GetArenaForAllocation());
+  }
+  return _impl_.msg_.start_epoch_;
+}
+inline ::dsnet::transaction::eris::proto::StartEpoch* FCToErisMessage::mutable_start_epoch() {
+  ::dsnet::transaction::eris::proto::StartEpoch* _msg = _internal_mutable_start_epoch();
+  // @@protoc_insertion_point(field_mutable:dsnet.transaction.eris.proto.FCToErisMessage.start_epoch)
+  return _msg;
+}
+
+inline bool FCToErisMessage::has_msg() const {
+  return msg_case() != MSG_NOT_SET;
+}
+inline void FCToErisMessage::clear_has_msg() {
+  _impl_._oneof_case_[0] = MSG_NOT_SET;
+}
+inline FCToErisMessage::MsgCase FCToErisMessage::msg_case() const {
+  return FCToErisMessage::MsgCase(_impl_._oneof_case_[0]);
+}
+#ifdef __GNUC__
+  #pragma GCC diagnostic pop
+#endif  // __GNUC__
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+
+// @@protoc_insertion_point(namespace_scope)
+
+}  // namespace proto
+}  // namespace eris
+}  // namespace transaction
+}  // namespace dsnet
+
+PROTOBUF_NAMESPACE_OPEN
+
+template <> struct is_proto_enum< ::dsnet::transaction::eris::proto::RequestType> : ::std::true_type {};
+template <>
+inline const EnumDescriptor* GetEnumDescriptor< ::dsnet::transaction::eris::proto::RequestType>() {
+  return ::dsnet::transaction::eris::proto::RequestType_descriptor();
+}
+
+PROTOBUF_NAMESPACE_CLOSE
+
+// @@protoc_insertion_point(global_scope)
+
+#include <google/protobuf/port_undef.inc>
+#endif  // GOOGLE_PROTOBUF_INCLUDED_GOOGLE_PROTOBUF_INCLUDED_transaction_2feris_2feris_2dproto_2eproto
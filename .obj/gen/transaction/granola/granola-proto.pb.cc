@@ -0,0 +1,3685 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: transaction/granola/granola-proto.proto
+
+#include "transaction/granola/granola-proto.pb.h"
+
+#include <algorithm>
+
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/extension_set.h>
+#include <google/protobuf/wire_format_lite.h>
+#include <google/protobuf/descriptor.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/reflection_ops.h>
+#include <google/protobuf/wire_format.h>
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+
+PROTOBUF_PRAGMA_INIT_SEG
+
+namespace _pb = ::PROTOBUF_NAMESPACE_ID;
+namespace _pbi = _pb::internal;
+
+namespace dsnet {
+namespace transaction {
+namespace granola {
+namespace proto {
+PROTOBUF_CONSTEXPR ReplyMessage::ReplyMessage(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.reply_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.clientreqid_)*/uint64_t{0u}
+  , /*decltype(_impl_.shard_num_)*/0u
+  , /*decltype(_impl_.status_)*/0} {}
+struct ReplyMessageDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ReplyMessageDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ReplyMessageDefaultTypeInternal() {}
+  union {
+    ReplyMessage _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ReplyMessageDefaultTypeInternal _ReplyMessage_default_instance_;
+PROTOBUF_CONSTEXPR RequestMessage::RequestMessage(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.request_)*/nullptr
+  , /*decltype(_impl_.txnid_)*/uint64_t{0u}
+  , /*decltype(_impl_.indep_)*/false
+  , /*decltype(_impl_.ro_)*/false} {}
+struct RequestMessageDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR RequestMessageDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~RequestMessageDefaultTypeInternal() {}
+  union {
+    RequestMessage _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 RequestMessageDefaultTypeInternal _RequestMessage_default_instance_;
+PROTOBUF_CONSTEXPR PrepareMessage::PrepareMessage(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.request_)*/nullptr
+  , /*decltype(_impl_.view_)*/uint64_t{0u}
+  , /*decltype(_impl_.opnum_)*/uint64_t{0u}
+  , /*decltype(_impl_.txnid_)*/uint64_t{0u}
+  , /*decltype(_impl_.timestamp_)*/uint64_t{0u}
+  , /*decltype(_impl_.indep_)*/false
+  , /*decltype(_impl_.ro_)*/false} {}
+struct PrepareMessageDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR PrepareMessageDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~PrepareMessageDefaultTypeInternal() {}
+  union {
+    PrepareMessage _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 PrepareMessageDefaultTypeInternal _PrepareMessage_default_instance_;
+PROTOBUF_CONSTEXPR PrepareOKMessage::PrepareOKMessage(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.view_)*/uint64_t{0u}
+  , /*decltype(_impl_.opnum_)*/uint64_t{0u}
+  , /*decltype(_impl_.replica_num_)*/0u} {}
+struct PrepareOKMessageDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR PrepareOKMessageDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~PrepareOKMessageDefaultTypeInternal() {}
+  union {
+    PrepareOKMessage _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 PrepareOKMessageDefaultTypeInternal _PrepareOKMessage_default_instance_;
+PROTOBUF_CONSTEXPR CommitMessage::CommitMessage(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.view_)*/uint64_t{0u}
+  , /*decltype(_impl_.opnum_)*/uint64_t{0u}} {}
+struct CommitMessageDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR CommitMessageDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~CommitMessageDefaultTypeInternal() {}
+  union {
+    CommitMessage _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 CommitMessageDefaultTypeInternal _CommitMessage_default_instance_;
+PROTOBUF_CONSTEXPR VoteMessage::VoteMessage(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.clientid_)*/uint64_t{0u}
+  , /*decltype(_impl_.clientreqid_)*/uint64_t{0u}
+  , /*decltype(_impl_.shard_num_)*/0u
+  , /*decltype(_impl_.nshards_)*/0u
+  , /*decltype(_impl_.status_)*/0} {}
+struct VoteMessageDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR VoteMessageDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~VoteMessageDefaultTypeInternal() {}
+  union {
+    VoteMessage _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 VoteMessageDefaultTypeInternal _VoteMessage_default_instance_;
+PROTOBUF_CONSTEXPR VoteRequestMessage::VoteRequestMessage(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.clientid_)*/uint64_t{0u}
+  , /*decltype(_impl_.clientreqid_)*/uint64_t{0u}} {}
+struct VoteRequestMessageDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR VoteRequestMessageDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~VoteRequestMessageDefaultTypeInternal() {}
+  union {
+    VoteRequestMessage _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 VoteRequestMessageDefaultTypeInternal _VoteRequestMessage_default_instance_;
+PROTOBUF_CONSTEXPR FinalTimestampMessage::FinalTimestampMessage(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.view_)*/uint64_t{0u}
+  , /*decltype(_impl_.opnum_)*/uint64_t{0u}
+  , /*decltype(_impl_.timestamp_)*/uint64_t{0u}
+  , /*decltype(_impl_.status_)*/0} {}
+struct FinalTimestampMessageDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR FinalTimestampMessageDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~FinalTimestampMessageDefaultTypeInternal() {}
+  union {
+    FinalTimestampMessage _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 FinalTimestampMessageDefaultTypeInternal _FinalTimestampMessage_default_instance_;
+PROTOBUF_CONSTEXPR ToServerMessage::ToServerMessage(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.msg_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_._oneof_case_)*/{}} {}
+struct ToServerMessageDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ToServerMessageDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ToServerMessageDefaultTypeInternal() {}
+  union {
+    ToServerMessage _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ToServerMessageDefaultTypeInternal _ToServerMessage_default_instance_;
+}  // namespace proto
+}  // namespace granola
+}  // namespace transaction
+}  // namespace dsnet
+static ::_pb::Metadata file_level_metadata_transaction_2fgranola_2fgranola_2dproto_2eproto[9];
+static const ::_pb::EnumDescriptor* file_level_enum_descriptors_transaction_2fgranola_2fgranola_2dproto_2eproto[1];
+static constexpr ::_pb::ServiceDescriptor const** file_level_service_descriptors_transaction_2fgranola_2fgranola_2dproto_2eproto = nullptr;
+
+const uint32_t TableStruct_transaction_2fgranola_2fgranola_2dproto_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  PROTOBUF_FIELD_OFFSET(::dsnet::transaction::granola::proto::ReplyMessage, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::transaction::granola::proto::ReplyMessage, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::dsnet::transaction::granola::proto::ReplyMessage, _impl_.clientreqid_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::transaction::granola::proto::ReplyMessage, _impl_.shard_num_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::transaction::granola::proto::ReplyMessage, _impl_.status_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::transaction::granola::proto::ReplyMessage, _impl_.reply_),
+  1,
+  2,
+  3,
+  0,
+  PROTOBUF_FIELD_OFFSET(::dsnet::transaction::granola::proto::RequestMessage, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::transaction::granola::proto::RequestMessage, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::dsnet::transaction::granola::proto::RequestMessage, _impl_.txnid_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::transaction::granola::proto::RequestMessage, _impl_.indep_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::transaction::granola::proto::RequestMessage, _impl_.ro_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::transaction::granola::proto::RequestMessage, _impl_.request_),
+  1,
+  2,
+  3,
+  0,
+  PROTOBUF_FIELD_OFFSET(::dsnet::transaction::granola::proto::PrepareMessage, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::transaction::granola::proto::PrepareMessage, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::dsnet::transaction::granola::proto::PrepareMessage, _impl_.view_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::transaction::granola::proto::PrepareMessage, _impl_.opnum_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::transaction::granola::proto::PrepareMessage, _impl_.txnid_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::transaction::granola::proto::PrepareMessage, _impl_.indep_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::transaction::granola::proto::PrepareMessage, _impl_.ro_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::transaction::granola::proto::PrepareMessage, _impl_.request_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::transaction::granola::proto::PrepareMessage, _impl_.timestamp_),
+  1,
+  2,
+  3,
+  5,
+  6,
+  0,
+  4,
+  PROTOBUF_FIELD_OFFSET(::dsnet::transaction::granola::proto::PrepareOKMessage, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::transaction::granola::proto::PrepareOKMessage, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::dsnet::transaction::granola::proto::PrepareOKMessage, _impl_.view_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::transaction::granola::proto::PrepareOKMessage, _impl_.opnum_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::transaction::granola::proto::PrepareOKMessage, _impl_.replica_num_),
+  0,
+  1,
+  2,
+  PROTOBUF_FIELD_OFFSET(::dsnet::transaction::granola::proto::CommitMessage, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::transaction::granola::proto::CommitMessage, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::dsnet::transaction::granola::proto::CommitMessage, _impl_.view_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::transaction::granola::proto::CommitMessage, _impl_.opnum_),
+  0,
+  1,
+  PROTOBUF_FIELD_OFFSET(::dsnet::transaction::granola::proto::VoteMessage, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::transaction::granola::proto::VoteMessage, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::dsnet::transaction::granola::proto::VoteMessage, _impl_.clientid_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::transaction::granola::proto::VoteMessage, _impl_.clientreqid_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::transaction::granola::proto::VoteMessage, _impl_.shard_num_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::transaction::granola::proto::VoteMessage, _impl_.nshards_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::transaction::granola::proto::VoteMessage, _impl_.status_),
+  0,
+  1,
+  2,
+  3,
+  4,
+  PROTOBUF_FIELD_OFFSET(::dsnet::transaction::granola::proto::VoteRequestMessage, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::transaction::granola::proto::VoteRequestMessage, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::dsnet::transaction::granola::proto::VoteRequestMessage, _impl_.clientid_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::transaction::granola::proto::VoteRequestMessage, _impl_.clientreqid_),
+  0,
+  1,
+  PROTOBUF_FIELD_OFFSET(::dsnet::transaction::granola::proto::FinalTimestampMessage, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::transaction::granola::proto::FinalTimestampMessage, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::dsnet::transaction::granola::proto::FinalTimestampMessage, _impl_.view_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::transaction::granola::proto::FinalTimestampMessage, _impl_.opnum_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::transaction::granola::proto::FinalTimestampMessage, _impl_.timestamp_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::transaction::granola::proto::FinalTimestampMessage, _impl_.status_),
+  0,
+  1,
+  2,
+  3,
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::dsnet::transaction::granola::proto::ToServerMessage, _internal_metadata_),
+  ~0u,  // no _extensions_
+  PROTOBUF_FIELD_OFFSET(::dsnet::transaction::granola::proto::ToServerMessage, _impl_._oneof_case_[0]),
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  PROTOBUF_FIELD_OFFSET(::dsnet::transaction::granola::proto::ToServerMessage, _impl_.msg_),
+};
+static const ::_pbi::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  { 0, 10, -1, sizeof(::dsnet::transaction::granola::proto::ReplyMessage)},
+  { 14, 24, -1, sizeof(::dsnet::transaction::granola::proto::RequestMessage)},
+  { 28, 41, -1, sizeof(::dsnet::transaction::granola::proto::PrepareMessage)},
+  { 48, 57, -1, sizeof(::dsnet::transaction::granola::proto::PrepareOKMessage)},
+  { 60, 68, -1, sizeof(::dsnet::transaction::granola::proto::CommitMessage)},
+  { 70, 81, -1, sizeof(::dsnet::transaction::granola::proto::VoteMessage)},
+  { 86, 94, -1, sizeof(::dsnet::transaction::granola::proto::VoteRequestMessage)},
+  { 96, 106, -1, sizeof(::dsnet::transaction::granola::proto::FinalTimestampMessage)},
+  { 110, -1, -1, sizeof(::dsnet::transaction::granola::proto::ToServerMessage)},
+};
+
+static const ::_pb::Message* const file_default_instances[] = {
+  &::dsnet::transaction::granola::proto::_ReplyMessage_default_instance_._instance,
+  &::dsnet::transaction::granola::proto::_RequestMessage_default_instance_._instance,
+  &::dsnet::transaction::granola::proto::_PrepareMessage_default_instance_._instance,
+  &::dsnet::transaction::granola::proto::_PrepareOKMessage_default_instance_._instance,
+  &::dsnet::transaction::granola::proto::_CommitMessage_default_instance_._instance,
+  &::dsnet::transaction::granola::proto::_VoteMessage_default_instance_._instance,
+  &::dsnet::transaction::granola::proto::_VoteRequestMessage_default_instance_._instance,
+  &::dsnet::transaction::granola::proto::_FinalTimestampMessage_default_instance_._instance,
+  &::dsnet::transaction::granola::proto::_ToServerMessage_default_instance_._instance,
+};
+
+const char descriptor_table_protodef_transaction_2fgranola_2fgranola_2dproto_2eproto[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) =
+  "\n\'transaction/granola/granola-proto.prot"
+  "o\022\037dsnet.transaction.granola.proto\032\024comm"
+  "on/request.proto\"~\n\014ReplyMessage\022\023\n\013clie"
+  "ntreqid\030\001 \002(\004\022\021\n\tshard_num\030\002 \002(\r\0227\n\006stat"
+  "us\030\003 \002(\0162\'.dsnet.transaction.granola.pro"
+  "to.Status\022\r\n\005reply\030\004 \001(\014\"[\n\016RequestMessa"
+  "ge\022\r\n\005txnid\030\001 \002(\004\022\r\n\005indep\030\002 \002(\010\022\n\n\002ro\030\003"
+  " \002(\010\022\037\n\007request\030\004 \002(\0132\016.dsnet.Request\"\213\001"
+  "\n\016PrepareMessage\022\014\n\004view\030\001 \002(\004\022\r\n\005opnum\030"
+  "\002 \002(\004\022\r\n\005txnid\030\003 \002(\004\022\r\n\005indep\030\004 \002(\010\022\n\n\002r"
+  "o\030\005 \002(\010\022\037\n\007request\030\006 \002(\0132\016.dsnet.Request"
+  "\022\021\n\ttimestamp\030\007 \002(\004\"D\n\020PrepareOKMessage\022"
+  "\014\n\004view\030\001 \002(\004\022\r\n\005opnum\030\002 \002(\004\022\023\n\013replica_"
+  "num\030\003 \002(\r\",\n\rCommitMessage\022\014\n\004view\030\001 \002(\004"
+  "\022\r\n\005opnum\030\002 \002(\004\"\221\001\n\013VoteMessage\022\020\n\010clien"
+  "tid\030\001 \002(\004\022\023\n\013clientreqid\030\002 \002(\004\022\021\n\tshard_"
+  "num\030\003 \002(\r\022\017\n\007nshards\030\004 \002(\r\0227\n\006status\030\005 \002"
+  "(\0162\'.dsnet.transaction.granola.proto.Sta"
+  "tus\";\n\022VoteRequestMessage\022\020\n\010clientid\030\001 "
+  "\002(\004\022\023\n\013clientreqid\030\002 \002(\004\"\200\001\n\025FinalTimest"
+  "ampMessage\022\014\n\004view\030\001 \002(\004\022\r\n\005opnum\030\002 \002(\004\022"
+  "\021\n\ttimestamp\030\003 \002(\004\0227\n\006status\030\004 \002(\0162\'.dsn"
+  "et.transaction.granola.proto.Status\"\211\004\n\017"
+  "ToServerMessage\022B\n\007request\030\001 \001(\0132/.dsnet"
+  ".transaction.granola.proto.RequestMessag"
+  "eH\000\022B\n\007prepare\030\002 \001(\0132/.dsnet.transaction"
+  ".granola.proto.PrepareMessageH\000\022G\n\nprepa"
+  "re_ok\030\003 \001(\01321.dsnet.transaction.granola."
+  "proto.PrepareOKMessageH\000\022@\n\006commit\030\004 \001(\013"
+  "2..dsnet.transaction.granola.proto.Commi"
+  "tMessageH\000\022<\n\004vote\030\005 \001(\0132,.dsnet.transac"
+  "tion.granola.proto.VoteMessageH\000\022K\n\014vote"
+  "_request\030\006 \001(\01323.dsnet.transaction.grano"
+  "la.proto.VoteRequestMessageH\000\022Q\n\017final_t"
+  "imestamp\030\007 \001(\01326.dsnet.transaction.grano"
+  "la.proto.FinalTimestampMessageH\000B\005\n\003msg*"
+  "-\n\006Status\022\n\n\006COMMIT\020\000\022\t\n\005ABORT\020\001\022\014\n\010CONF"
+  "LICT\020\002"
+  ;
+static const ::_pbi::DescriptorTable* const descriptor_table_transaction_2fgranola_2fgranola_2dproto_2eproto_deps[1] = {
+  &::descriptor_table_common_2frequest_2eproto,
+};
+static ::_pbi::once_flag descriptor_table_transaction_2fgranola_2fgranola_2dproto_2eproto_once;
+const ::_pbi::DescriptorTable descriptor_table_transaction_2fgranola_2fgranola_2dproto_2eproto = {
+    false, false, 1486, descriptor_table_protodef_transaction_2fgranola_2fgranola_2dproto_2eproto,
+    "transaction/granola/granola-proto.proto",
+    &descriptor_table_transaction_2fgranola_2fgranola_2dproto_2eproto_once, descriptor_table_transaction_2fgranola_2fgranola_2dproto_2eproto_deps, 1, 9,
+    schemas, file_default_instances, TableStruct_transaction_2fgranola_2fgranola_2dproto_2eproto::offsets,
+    file_level_metadata_transaction_2fgranola_2fgranola_2dproto_2eproto, file_level_enum_descriptors_transaction_2fgranola_2fgranola_2dproto_2eproto,
+    file_level_service_descriptors_transaction_2fgranola_2fgranola_2dproto_2eproto,
+};
+PROTOBUF_ATTRIBUTE_WEAK const ::_pbi::DescriptorTable* descriptor_table_transaction_2fgranola_2fgranola_2dproto_2eproto_getter() {
+  return &descriptor_table_transaction_2fgranola_2fgranola_2dproto_2eproto;
+}
+
+// Force running AddDescriptors() at dynamic initialization time.
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 static ::_pbi::AddDescriptorsRunner dynamic_init_dummy_transaction_2fgranola_2fgranola_2dproto_2eproto(&descriptor_table_transaction_2fgranola_2fgranola_2dproto_2eproto);
+namespace dsnet {
+namespace transaction {
+namespace granola {
+namespace proto {
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* Status_descriptor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_transaction_2fgranola_2fgranola_2dproto_2eproto);
+  return file_level_enum_descriptors_transaction_2fgranola_2fgranola_2dproto_2eproto[0];
+}
+bool Status_IsValid(int value) {
+  switch (value) {
+    case 0:
+    case 1:
+    case 2:
+      return true;
+    default:
+      return false;
+  }
+}
+
+
+// ===================================================================
+
+class ReplyMessage::_Internal {
+ public:
+  using HasBits = decltype(std::declval<ReplyMessage>()._impl_._has_bits_);
+  static void set_has_clientreqid(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_shard_num(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static void set_has_status(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+  static void set_has_reply(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x0000000e) ^ 0x0000000e) != 0;
+  }
+};
+
+ReplyMessage::ReplyMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:dsnet.transaction.granola.proto.ReplyMessage)
+}
+ReplyMessage::ReplyMessage(const ReplyMessage& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  ReplyMessage* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.reply_){}
+    , decltype(_impl_.clientreqid_){}
+    , decltype(_impl_.shard_num_){}
+    , decltype(_impl_.status_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.reply_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.reply_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_reply()) {
+    _this->_impl_.reply_.Set(from._internal_reply(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.clientreqid_, &from._impl_.clientreqid_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.status_) -
+    reinterpret_cast<char*>(&_impl_.clientreqid_)) + sizeof(_impl_.status_));
+  // @@protoc_insertion_point(copy_constructor:dsnet.transaction.granola.proto.ReplyMessage)
+}
+
+inline void ReplyMessage::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.reply_){}
+    , decltype(_impl_.clientreqid_){uint64_t{0u}}
+    , decltype(_impl_.shard_num_){0u}
+    , decltype(_impl_.status_){0}
+  };
+  _impl_.reply_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.reply_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+ReplyMessage::~ReplyMessage() {
+  // @@protoc_insertion_point(destructor:dsnet.transaction.granola.proto.ReplyMessage)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void ReplyMessage::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.reply_.Destroy();
+}
+
+void ReplyMessage::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void ReplyMessage::Clear() {
+// @@protoc_insertion_point(message_clear_start:dsnet.transaction.granola.proto.ReplyMessage)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    _impl_.reply_.ClearNonDefaultToEmpty();
+  }
+  if (cached_has_bits & 0x0000000eu) {
+    ::memset(&_impl_.clientreqid_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.status_) -
+        reinterpret_cast<char*>(&_impl_.clientreqid_)) + sizeof(_impl_.status_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* ReplyMessage::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required uint64 clientreqid = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_clientreqid(&has_bits);
+          _impl_.clientreqid_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required uint32 shard_num = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _Internal::set_has_shard_num(&has_bits);
+          _impl_.shard_num_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required .dsnet.transaction.granola.proto.Status status = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          if (PROTOBUF_PREDICT_TRUE(::dsnet::transaction::granola::proto::Status_IsValid(val))) {
+            _internal_set_status(static_cast<::dsnet::transaction::granola::proto::Status>(val));
+          } else {
+            ::PROTOBUF_NAMESPACE_ID::internal::WriteVarint(3, val, mutable_unknown_fields());
+          }
+        } else
+          goto handle_unusual;
+        continue;
+      // optional bytes reply = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          auto str = _internal_mutable_reply();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* ReplyMessage::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:dsnet.transaction.granola.proto.ReplyMessage)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required uint64 clientreqid = 1;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(1, this->_internal_clientreqid(), target);
+  }
+
+  // required uint32 shard_num = 2;
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(2, this->_internal_shard_num(), target);
+  }
+
+  // required .dsnet.transaction.granola.proto.Status status = 3;
+  if (cached_has_bits & 0x00000008u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      3, this->_internal_status(), target);
+  }
+
+  // optional bytes reply = 4;
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->WriteBytesMaybeAliased(
+        4, this->_internal_reply(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:dsnet.transaction.granola.proto.ReplyMessage)
+  return target;
+}
+
+size_t ReplyMessage::RequiredFieldsByteSizeFallback() const {
+// @@protoc_insertion_point(required_fields_byte_size_fallback_start:dsnet.transaction.granola.proto.ReplyMessage)
+  size_t total_size = 0;
+
+  if (_internal_has_clientreqid()) {
+    // required uint64 clientreqid = 1;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_clientreqid());
+  }
+
+  if (_internal_has_shard_num()) {
+    // required uint32 shard_num = 2;
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_shard_num());
+  }
+
+  if (_internal_has_status()) {
+    // required .dsnet.transaction.granola.proto.Status status = 3;
+    total_size += 1 +
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_status());
+  }
+
+  return total_size;
+}
+size_t ReplyMessage::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:dsnet.transaction.granola.proto.ReplyMessage)
+  size_t total_size = 0;
+
+  if (((_impl_._has_bits_[0] & 0x0000000e) ^ 0x0000000e) == 0) {  // All required fields are present.
+    // required uint64 clientreqid = 1;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_clientreqid());
+
+    // required uint32 shard_num = 2;
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_shard_num());
+
+    // required .dsnet.transaction.granola.proto.Status status = 3;
+    total_size += 1 +
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_status());
+
+  } else {
+    total_size += RequiredFieldsByteSizeFallback();
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // optional bytes reply = 4;
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_reply());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ReplyMessage::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    ReplyMessage::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ReplyMessage::GetClassData() const { return &_class_data_; }
+
+
+void ReplyMessage::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<ReplyMessage*>(&to_msg);
+  auto& from = static_cast<const ReplyMessage&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:dsnet.transaction.granola.proto.ReplyMessage)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000000fu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_reply(from._internal_reply());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.clientreqid_ = from._impl_.clientreqid_;
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.shard_num_ = from._impl_.shard_num_;
+    }
+    if (cached_has_bits & 0x00000008u) {
+      _this->_impl_.status_ = from._impl_.status_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void ReplyMessage::CopyFrom(const ReplyMessage& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:dsnet.transaction.granola.proto.ReplyMessage)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool ReplyMessage::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  return true;
+}
+
+void ReplyMessage::InternalSwap(ReplyMessage* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.reply_, lhs_arena,
+      &other->_impl_.reply_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(ReplyMessage, _impl_.status_)
+      + sizeof(ReplyMessage::_impl_.status_)
+      - PROTOBUF_FIELD_OFFSET(ReplyMessage, _impl_.clientreqid_)>(
+          reinterpret_cast<char*>(&_impl_.clientreqid_),
+          reinterpret_cast<char*>(&other->_impl_.clientreqid_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata ReplyMessage::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_transaction_2fgranola_2fgranola_2dproto_2eproto_getter, &descriptor_table_transaction_2fgranola_2fgranola_2dproto_2eproto_once,
+      file_level_metadata_transaction_2fgranola_2fgranola_2dproto_2eproto[0]);
+}
+
+// ===================================================================
+
+class RequestMessage::_Internal {
+ public:
+  using HasBits = decltype(std::declval<RequestMessage>()._impl_._has_bits_);
+  static void set_has_txnid(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_indep(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static void set_has_ro(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+  static const ::dsnet::Request& request(const RequestMessage* msg);
+  static void set_has_request(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x0000000f) ^ 0x0000000f) != 0;
+  }
+};
+
+const ::dsnet::Request&
+RequestMessage::_Internal::request(const RequestMessage* msg) {
+  return *msg->_impl_.request_;
+}
+void RequestMessage::clear_request() {
+  if (_impl_.request_ != nullptr) _impl_.request_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+RequestMessage::RequestMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:dsnet.transaction.granola.proto.RequestMessage)
+}
+RequestMessage::RequestMessage(const RequestMessage& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  RequestMessage* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.request_){nullptr}
+    , decltype(_impl_.txnid_){}
+    , decltype(_impl_.indep_){}
+    , decltype(_impl_.ro_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  if (from._internal_has_request()) {
+    _this->_impl_.request_ = new ::dsnet::Request(*from._impl_.request_);
+  }
+  ::memcpy(&_impl_.txnid_, &from._impl_.txnid_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.ro_) -
+    reinterpret_cast<char*>(&_impl_.txnid_)) + sizeof(_impl_.ro_));
+  // @@protoc_insertion_point(copy_constructor:dsnet.transaction.granola.proto.RequestMessage)
+}
+
+inline void RequestMessage::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.request_){nullptr}
+    , decltype(_impl_.txnid_){uint64_t{0u}}
+    , decltype(_impl_.indep_){false}
+    , decltype(_impl_.ro_){false}
+  };
+}
+
+RequestMessage::~RequestMessage() {
+  // @@protoc_insertion_point(destructor:dsnet.transaction.granola.proto.RequestMessage)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void RequestMessage::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  if (this != internal_default_instance()) delete _impl_.request_;
+}
+
+void RequestMessage::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void RequestMessage::Clear() {
+// @@protoc_insertion_point(message_clear_start:dsnet.transaction.granola.proto.RequestMessage)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    GOOGLE_DCHECK(_impl_.request_ != nullptr);
+    _impl_.request_->Clear();
+  }
+  if (cached_has_bits & 0x0000000eu) {
+    ::memset(&_impl_.txnid_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.ro_) -
+        reinterpret_cast<char*>(&_impl_.txnid_)) + sizeof(_impl_.ro_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* RequestMessage::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required uint64 txnid = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_txnid(&has_bits);
+          _impl_.txnid_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required bool indep = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _Internal::set_has_indep(&has_bits);
+          _impl_.indep_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required bool ro = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _Internal::set_has_ro(&has_bits);
+          _impl_.ro_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required .dsnet.Request request = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          ptr = ctx->ParseMessage(_internal_mutable_request(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* RequestMessage::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:dsnet.transaction.granola.proto.RequestMessage)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required uint64 txnid = 1;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(1, this->_internal_txnid(), target);
+  }
+
+  // required bool indep = 2;
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(2, this->_internal_indep(), target);
+  }
+
+  // required bool ro = 3;
+  if (cached_has_bits & 0x00000008u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(3, this->_internal_ro(), target);
+  }
+
+  // required .dsnet.Request request = 4;
+  if (cached_has_bits & 0x00000001u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(4, _Internal::request(this),
+        _Internal::request(this).GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:dsnet.transaction.granola.proto.RequestMessage)
+  return target;
+}
+
+size_t RequestMessage::RequiredFieldsByteSizeFallback() const {
+// @@protoc_insertion_point(required_fields_byte_size_fallback_start:dsnet.transaction.granola.proto.RequestMessage)
+  size_t total_size = 0;
+
+  if (_internal_has_request()) {
+    // required .dsnet.Request request = 4;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.request_);
+  }
+
+  if (_internal_has_txnid()) {
+    // required uint64 txnid = 1;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_txnid());
+  }
+
+  if (_internal_has_indep()) {
+    // required bool indep = 2;
+    total_size += 1 + 1;
+  }
+
+  if (_internal_has_ro()) {
+    // required bool ro = 3;
+    total_size += 1 + 1;
+  }
+
+  return total_size;
+}
+size_t RequestMessage::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:dsnet.transaction.granola.proto.RequestMessage)
+  size_t total_size = 0;
+
+  if (((_impl_._has_bits_[0] & 0x0000000f) ^ 0x0000000f) == 0) {  // All required fields are present.
+    // required .dsnet.Request request = 4;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.request_);
+
+    // required uint64 txnid = 1;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_txnid());
+
+    // required bool indep = 2;
+    total_size += 1 + 1;
+
+    // required bool ro = 3;
+    total_size += 1 + 1;
+
+  } else {
+    total_size += RequiredFieldsByteSizeFallback();
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData RequestMessage::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    RequestMessage::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*RequestMessage::GetClassData() const { return &_class_data_; }
+
+
+void RequestMessage::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<RequestMessage*>(&to_msg);
+  auto& from = static_cast<const RequestMessage&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:dsnet.transaction.granola.proto.RequestMessage)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000000fu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_mutable_request()->::dsnet::Request::MergeFrom(
+          from._internal_request());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.txnid_ = from._impl_.txnid_;
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.indep_ = from._impl_.indep_;
+    }
+    if (cached_has_bits & 0x00000008u) {
+      _this->_impl_.ro_ = from._impl_.ro_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void RequestMessage::CopyFrom(const RequestMessage& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:dsnet.transaction.granola.proto.RequestMessage)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool RequestMessage::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  if (_internal_has_request()) {
+    if (!_impl_.request_->IsInitialized()) return false;
+  }
+  return true;
+}
+
+void RequestMessage::InternalSwap(RequestMessage* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(RequestMessage, _impl_.ro_)
+      + sizeof(RequestMessage::_impl_.ro_)
+      - PROTOBUF_FIELD_OFFSET(RequestMessage, _impl_.request_)>(
+          reinterpret_cast<char*>(&_impl_.request_),
+          reinterpret_cast<char*>(&other->_impl_.request_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata RequestMessage::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_transaction_2fgranola_2fgranola_2dproto_2eproto_getter, &descriptor_table_transaction_2fgranola_2fgranola_2dproto_2eproto_once,
+      file_level_metadata_transaction_2fgranola_2fgranola_2dproto_2eproto[1]);
+}
+
+// ===================================================================
+
+class PrepareMessage::_Internal {
+ public:
+  using HasBits = decltype(std::declval<PrepareMessage>()._impl_._has_bits_);
+  static void set_has_view(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_opnum(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static void set_has_txnid(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+  static void set_has_indep(HasBits* has_bits) {
+    (*has_bits)[0] |= 32u;
+  }
+  static void set_has_ro(HasBits* has_bits) {
+    (*has_bits)[0] |= 64u;
+  }
+  static const ::dsnet::Request& request(const PrepareMessage* msg);
+  static void set_has_request(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_timestamp(HasBits* has_bits) {
+    (*has_bits)[0] |= 16u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x0000007f) ^ 0x0000007f) != 0;
+  }
+};
+
+const ::dsnet::Request&
+PrepareMessage::_Internal::request(const PrepareMessage* msg) {
+  return *msg->_impl_.request_;
+}
+void PrepareMessage::clear_request() {
+  if (_impl_.request_ != nullptr) _impl_.request_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+PrepareMessage::PrepareMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:dsnet.transaction.granola.proto.PrepareMessage)
+}
+PrepareMessage::PrepareMessage(const PrepareMessage& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  PrepareMessage* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.request_){nullptr}
+    , decltype(_impl_.view_){}
+    , decltype(_impl_.opnum_){}
+    , decltype(_impl_.txnid_){}
+    , decltype(_impl_.timestamp_){}
+    , decltype(_impl_.indep_){}
+    , decltype(_impl_.ro_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  if (from._internal_has_request()) {
+    _this->_impl_.request_ = new ::dsnet::Request(*from._impl_.request_);
+  }
+  ::memcpy(&_impl_.view_, &from._impl_.view_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.ro_) -
+    reinterpret_cast<char*>(&_impl_.view_)) + sizeof(_impl_.ro_));
+  // @@protoc_insertion_point(copy_constructor:dsnet.transaction.granola.proto.PrepareMessage)
+}
+
+inline void PrepareMessage::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.request_){nullptr}
+    , decltype(_impl_.view_){uint64_t{0u}}
+    , decltype(_impl_.opnum_){uint64_t{0u}}
+    , decltype(_impl_.txnid_){uint64_t{0u}}
+    , decltype(_impl_.timestamp_){uint64_t{0u}}
+    , decltype(_impl_.indep_){false}
+    , decltype(_impl_.ro_){false}
+  };
+}
+
+PrepareMessage::~PrepareMessage() {
+  // @@protoc_insertion_point(destructor:dsnet.transaction.granola.proto.PrepareMessage)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void PrepareMessage::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  if (this != internal_default_instance()) delete _impl_.request_;
+}
+
+void PrepareMessage::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void PrepareMessage::Clear() {
+// @@protoc_insertion_point(message_clear_start:dsnet.transaction.granola.proto.PrepareMessage)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    GOOGLE_DCHECK(_impl_.request_ != nullptr);
+    _impl_.request_->Clear();
+  }
+  if (cached_has_bits & 0x0000007eu) {
+    ::memset(&_impl_.view_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.ro_) -
+        reinterpret_cast<char*>(&_impl_.view_)) + sizeof(_impl_.ro_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* PrepareMessage::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required uint64 view = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_view(&has_bits);
+          _impl_.view_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required uint64 opnum = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _Internal::set_has_opnum(&has_bits);
+          _impl_.opnum_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required uint64 txnid = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _Internal::set_has_txnid(&has_bits);
+          _impl_.txnid_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required bool indep = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _Internal::set_has_indep(&has_bits);
+          _impl_.indep_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required bool ro = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          _Internal::set_has_ro(&has_bits);
+          _impl_.ro_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required .dsnet.Request request = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 50)) {
+          ptr = ctx->ParseMessage(_internal_mutable_request(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required uint64 timestamp = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 56)) {
+          _Internal::set_has_timestamp(&has_bits);
+          _impl_.timestamp_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* PrepareMessage::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:dsnet.transaction.granola.proto.PrepareMessage)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required uint64 view = 1;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(1, this->_internal_view(), target);
+  }
+
+  // required uint64 opnum = 2;
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(2, this->_internal_opnum(), target);
+  }
+
+  // required uint64 txnid = 3;
+  if (cached_has_bits & 0x00000008u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(3, this->_internal_txnid(), target);
+  }
+
+  // required bool indep = 4;
+  if (cached_has_bits & 0x00000020u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(4, this->_internal_indep(), target);
+  }
+
+  // required bool ro = 5;
+  if (cached_has_bits & 0x00000040u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(5, this->_internal_ro(), target);
+  }
+
+  // required .dsnet.Request request = 6;
+  if (cached_has_bits & 0x00000001u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(6, _Internal::request(this),
+        _Internal::request(this).GetCachedSize(), target, stream);
+  }
+
+  // required uint64 timestamp = 7;
+  if (cached_has_bits & 0x00000010u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(7, this->_internal_timestamp(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:dsnet.transaction.granola.proto.PrepareMessage)
+  return target;
+}
+
+size_t PrepareMessage::RequiredFieldsByteSizeFallback() const {
+// @@protoc_insertion_point(required_fields_byte_size_fallback_start:dsnet.transaction.granola.proto.PrepareMessage)
+  size_t total_size = 0;
+
+  if (_internal_has_request()) {
+    // required .dsnet.Request request = 6;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.request_);
+  }
+
+  if (_internal_has_view()) {
+    // required uint64 view = 1;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_view());
+  }
+
+  if (_internal_has_opnum()) {
+    // required uint64 opnum = 2;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_opnum());
+  }
+
+  if (_internal_has_txnid()) {
+    // required uint64 txnid = 3;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_txnid());
+  }
+
+  if (_internal_has_timestamp()) {
+    // required uint64 timestamp = 7;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_timestamp());
+  }
+
+  if (_internal_has_indep()) {
+    // required bool indep = 4;
+    total_size += 1 + 1;
+  }
+
+  if (_internal_has_ro()) {
+    // required bool ro = 5;
+    total_size += 1 + 1;
+  }
+
+  return total_size;
+}
+size_t PrepareMessage::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:dsnet.transaction.granola.proto.PrepareMessage)
+  size_t total_size = 0;
+
+  if (((_impl_._has_bits_[0] & 0x0000007f) ^ 0x0000007f) == 0) {  // All required fields are present.
+    // required .dsnet.Request request = 6;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.request_);
+
+    // required uint64 view = 1;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_view());
+
+    // required uint64 opnum = 2;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_opnum());
+
+    // required uint64 txnid = 3;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_txnid());
+
+    // required uint64 timestamp = 7;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_timestamp());
+
+    // required bool indep = 4;
+    total_size += 1 + 1;
+
+    // required bool ro = 5;
+    total_size += 1 + 1;
+
+  } else {
+    total_size += RequiredFieldsByteSizeFallback();
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData PrepareMessage::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    PrepareMessage::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*PrepareMessage::GetClassData() const { return &_class_data_; }
+
+
+void PrepareMessage::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<PrepareMessage*>(&to_msg);
+  auto& from = static_cast<const PrepareMessage&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:dsnet.transaction.granola.proto.PrepareMessage)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000007fu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_mutable_request()->::dsnet::Request::MergeFrom(
+          from._internal_request());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.view_ = from._impl_.view_;
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.opnum_ = from._impl_.opnum_;
+    }
+    if (cached_has_bits & 0x00000008u) {
+      _this->_impl_.txnid_ = from._impl_.txnid_;
+    }
+    if (cached_has_bits & 0x00000010u) {
+      _this->_impl_.timestamp_ = from._impl_.timestamp_;
+    }
+    if (cached_has_bits & 0x00000020u) {
+      _this->_impl_.indep_ = from._impl_.indep_;
+    }
+    if (cached_has_bits & 0x00000040u) {
+      _this->_impl_.ro_ = from._impl_.ro_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void PrepareMessage::CopyFrom(const PrepareMessage& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:dsnet.transaction.granola.proto.PrepareMessage)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool PrepareMessage::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  if (_internal_has_request()) {
+    if (!_impl_.request_->IsInitialized()) return false;
+  }
+  return true;
+}
+
+void PrepareMessage::InternalSwap(PrepareMessage* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(PrepareMessage, _impl_.ro_)
+      + sizeof(PrepareMessage::_impl_.ro_)
+      - PROTOBUF_FIELD_OFFSET(PrepareMessage, _impl_.request_)>(
+          reinterpret_cast<char*>(&_impl_.request_),
+          reinterpret_cast<char*>(&other->_impl_.request_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata PrepareMessage::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_transaction_2fgranola_2fgranola_2dproto_2eproto_getter, &descriptor_table_transaction_2fgranola_2fgranola_2dproto_2eproto_once,
+      file_level_metadata_transaction_2fgranola_2fgranola_2dproto_2eproto[2]);
+}
+
+// ===================================================================
+
+class PrepareOKMessage::_Internal {
+ public:
+  using HasBits = decltype(std::declval<PrepareOKMessage>()._impl_._has_bits_);
+  static void set_has_view(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_opnum(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_replica_num(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000007) ^ 0x00000007) != 0;
+  }
+};
+
+PrepareOKMessage::PrepareOKMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:dsnet.transaction.granola.proto.PrepareOKMessage)
+}
+PrepareOKMessage::PrepareOKMessage(const PrepareOKMessage& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  PrepareOKMessage* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.view_){}
+    , decltype(_impl_.opnum_){}
+    , decltype(_impl_.replica_num_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.view_, &from._impl_.view_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.replica_num_) -
+    reinterpret_cast<char*>(&_impl_.view_)) + sizeof(_impl_.replica_num_));
+  // @@protoc_insertion_point(copy_constructor:dsnet.transaction.granola.proto.PrepareOKMessage)
+}
+
+inline void PrepareOKMessage::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.view_){uint64_t{0u}}
+    , decltype(_impl_.opnum_){uint64_t{0u}}
+    , decltype(_impl_.replica_num_){0u}
+  };
+}
+
+PrepareOKMessage::~PrepareOKMessage() {
+  // @@protoc_insertion_point(destructor:dsnet.transaction.granola.proto.PrepareOKMessage)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void PrepareOKMessage::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void PrepareOKMessage::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void PrepareOKMessage::Clear() {
+// @@protoc_insertion_point(message_clear_start:dsnet.transaction.granola.proto.PrepareOKMessage)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    ::memset(&_impl_.view_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.replica_num_) -
+        reinterpret_cast<char*>(&_impl_.view_)) + sizeof(_impl_.replica_num_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* PrepareOKMessage::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required uint64 view = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_view(&has_bits);
+          _impl_.view_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required uint64 opnum = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _Internal::set_has_opnum(&has_bits);
+          _impl_.opnum_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required uint32 replica_num = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _Internal::set_has_replica_num(&has_bits);
+          _impl_.replica_num_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* PrepareOKMessage::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:dsnet.transaction.granola.proto.PrepareOKMessage)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required uint64 view = 1;
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(1, this->_internal_view(), target);
+  }
+
+  // required uint64 opnum = 2;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(2, this->_internal_opnum(), target);
+  }
+
+  // required uint32 replica_num = 3;
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(3, this->_internal_replica_num(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:dsnet.transaction.granola.proto.PrepareOKMessage)
+  return target;
+}
+
+size_t PrepareOKMessage::RequiredFieldsByteSizeFallback() const {
+// @@protoc_insertion_point(required_fields_byte_size_fallback_start:dsnet.transaction.granola.proto.PrepareOKMessage)
+  size_t total_size = 0;
+
+  if (_internal_has_view()) {
+    // required uint64 view = 1;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_view());
+  }
+
+  if (_internal_has_opnum()) {
+    // required uint64 opnum = 2;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_opnum());
+  }
+
+  if (_internal_has_replica_num()) {
+    // required uint32 replica_num = 3;
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_replica_num());
+  }
+
+  return total_size;
+}
+size_t PrepareOKMessage::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:dsnet.transaction.granola.proto.PrepareOKMessage)
+  size_t total_size = 0;
+
+  if (((_impl_._has_bits_[0] & 0x00000007) ^ 0x00000007) == 0) {  // All required fields are present.
+    // required uint64 view = 1;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_view());
+
+    // required uint64 opnum = 2;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_opnum());
+
+    // required uint32 replica_num = 3;
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_replica_num());
+
+  } else {
+    total_size += RequiredFieldsByteSizeFallback();
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData PrepareOKMessage::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    PrepareOKMessage::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*PrepareOKMessage::GetClassData() const { return &_class_data_; }
+
+
+void PrepareOKMessage::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<PrepareOKMessage*>(&to_msg);
+  auto& from = static_cast<const PrepareOKMessage&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:dsnet.transaction.granola.proto.PrepareOKMessage)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_impl_.view_ = from._impl_.view_;
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.opnum_ = from._impl_.opnum_;
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.replica_num_ = from._impl_.replica_num_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void PrepareOKMessage::CopyFrom(const PrepareOKMessage& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:dsnet.transaction.granola.proto.PrepareOKMessage)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool PrepareOKMessage::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  return true;
+}
+
+void PrepareOKMessage::InternalSwap(PrepareOKMessage* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(PrepareOKMessage, _impl_.replica_num_)
+      + sizeof(PrepareOKMessage::_impl_.replica_num_)
+      - PROTOBUF_FIELD_OFFSET(PrepareOKMessage, _impl_.view_)>(
+          reinterpret_cast<char*>(&_impl_.view_),
+          reinterpret_cast<char*>(&other->_impl_.view_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata PrepareOKMessage::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_transaction_2fgranola_2fgranola_2dproto_2eproto_getter, &descriptor_table_transaction_2fgranola_2fgranola_2dproto_2eproto_once,
+      file_level_metadata_transaction_2fgranola_2fgranola_2dproto_2eproto[3]);
+}
+
+// ===================================================================
+
+class CommitMessage::_Internal {
+ public:
+  using HasBits = decltype(std::declval<CommitMessage>()._impl_._has_bits_);
+  static void set_has_view(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_opnum(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000003) ^ 0x00000003) != 0;
+  }
+};
+
+CommitMessage::CommitMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:dsnet.transaction.granola.proto.CommitMessage)
+}
+CommitMessage::CommitMessage(const CommitMessage& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  CommitMessage* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.view_){}
+    , decltype(_impl_.opnum_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.view_, &from._impl_.view_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.opnum_) -
+    reinterpret_cast<char*>(&_impl_.view_)) + sizeof(_impl_.opnum_));
+  // @@protoc_insertion_point(copy_constructor:dsnet.transaction.granola.proto.CommitMessage)
+}
+
+inline void CommitMessage::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.view_){uint64_t{0u}}
+    , decltype(_impl_.opnum_){uint64_t{0u}}
+  };
+}
+
+CommitMessage::~CommitMessage() {
+  // @@protoc_insertion_point(destructor:dsnet.transaction.granola.proto.CommitMessage)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void CommitMessage::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void CommitMessage::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void CommitMessage::Clear() {
+// @@protoc_insertion_point(message_clear_start:dsnet.transaction.granola.proto.CommitMessage)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    ::memset(&_impl_.view_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.opnum_) -
+        reinterpret_cast<char*>(&_impl_.view_)) + sizeof(_impl_.opnum_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* CommitMessage::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required uint64 view = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_view(&has_bits);
+          _impl_.view_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required uint64 opnum = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _Internal::set_has_opnum(&has_bits);
+          _impl_.opnum_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* CommitMessage::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:dsnet.transaction.granola.proto.CommitMessage)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required uint64 view = 1;
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(1, this->_internal_view(), target);
+  }
+
+  // required uint64 opnum = 2;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(2, this->_internal_opnum(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:dsnet.transaction.granola.proto.CommitMessage)
+  return target;
+}
+
+size_t CommitMessage::RequiredFieldsByteSizeFallback() const {
+// @@protoc_insertion_point(required_fields_byte_size_fallback_start:dsnet.transaction.granola.proto.CommitMessage)
+  size_t total_size = 0;
+
+  if (_internal_has_view()) {
+    // required uint64 view = 1;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_view());
+  }
+
+  if (_internal_has_opnum()) {
+    // required uint64 opnum = 2;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_opnum());
+  }
+
+  return total_size;
+}
+size_t CommitMessage::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:dsnet.transaction.granola.proto.CommitMessage)
+  size_t total_size = 0;
+
+  if (((_impl_._has_bits_[0] & 0x00000003) ^ 0x00000003) == 0) {  // All required fields are present.
+    // required uint64 view = 1;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_view());
+
+    // required uint64 opnum = 2;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_opnum());
+
+  } else {
+    total_size += RequiredFieldsByteSizeFallback();
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData CommitMessage::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    CommitMessage::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*CommitMessage::GetClassData() const { return &_class_data_; }
+
+
+void CommitMessage::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<CommitMessage*>(&to_msg);
+  auto& from = static_cast<const CommitMessage&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:dsnet.transaction.granola.proto.CommitMessage)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_impl_.view_ = from._impl_.view_;
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.opnum_ = from._impl_.opnum_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void CommitMessage::CopyFrom(const CommitMessage& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:dsnet.transaction.granola.proto.CommitMessage)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool CommitMessage::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  return true;
+}
+
+void CommitMessage::InternalSwap(CommitMessage* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(CommitMessage, _impl_.opnum_)
+      + sizeof(CommitMessage::_impl_.opnum_)
+      - PROTOBUF_FIELD_OFFSET(CommitMessage, _impl_.view_)>(
+          reinterpret_cast<char*>(&_impl_.view_),
+          reinterpret_cast<char*>(&other->_impl_.view_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata CommitMessage::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_transaction_2fgranola_2fgranola_2dproto_2eproto_getter, &descriptor_table_transaction_2fgranola_2fgranola_2dproto_2eproto_once,
+      file_level_metadata_transaction_2fgranola_2fgranola_2dproto_2eproto[4]);
+}
+
+// ===================================================================
+
+class VoteMessage::_Internal {
+ public:
+  using HasBits = decltype(std::declval<VoteMessage>()._impl_._has_bits_);
+  static void set_has_clientid(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_clientreqid(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_shard_num(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static void set_has_nshards(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+  static void set_has_status(HasBits* has_bits) {
+    (*has_bits)[0] |= 16u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x0000001f) ^ 0x0000001f) != 0;
+  }
+};
+
+VoteMessage::VoteMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:dsnet.transaction.granola.proto.VoteMessage)
+}
+VoteMessage::VoteMessage(const VoteMessage& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  VoteMessage* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.clientid_){}
+    , decltype(_impl_.clientreqid_){}
+    , decltype(_impl_.shard_num_){}
+    , decltype(_impl_.nshards_){}
+    , decltype(_impl_.status_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.clientid_, &from._impl_.clientid_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.status_) -
+    reinterpret_cast<char*>(&_impl_.clientid_)) + sizeof(_impl_.status_));
+  // @@protoc_insertion_point(copy_constructor:dsnet.transaction.granola.proto.VoteMessage)
+}
+
+inline void VoteMessage::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.clientid_){uint64_t{0u}}
+    , decltype(_impl_.clientreqid_){uint64_t{0u}}
+    , decltype(_impl_.shard_num_){0u}
+    , decltype(_impl_.nshards_){0u}
+    , decltype(_impl_.status_){0}
+  };
+}
+
+VoteMessage::~VoteMessage() {
+  // @@protoc_insertion_point(destructor:dsnet.transaction.granola.proto.VoteMessage)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void VoteMessage::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void VoteMessage::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void VoteMessage::Clear() {
+// @@protoc_insertion_point(message_clear_start:dsnet.transaction.granola.proto.VoteMessage)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000001fu) {
+    ::memset(&_impl_.clientid_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.status_) -
+        reinterpret_cast<char*>(&_impl_.clientid_)) + sizeof(_impl_.status_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* VoteMessage::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required uint64 clientid = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_clientid(&has_bits);
+          _impl_.clientid_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required uint64 clientreqid = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _Internal::set_has_clientreqid(&has_bits);
+          _impl_.clientreqid_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required uint32 shard_num = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _Internal::set_has_shard_num(&has_bits);
+          _impl_.shard_num_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required uint32 nshards = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _Internal::set_has_nshards(&has_bits);
+          _impl_.nshards_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required .dsnet.transaction.granola.proto.Status status = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          if (PROTOBUF_PREDICT_TRUE(::dsnet::transaction::granola::proto::Status_IsValid(val))) {
+            _internal_set_status(static_cast<::dsnet::transaction::granola::proto::Status>(val));
+          } else {
+            ::PROTOBUF_NAMESPACE_ID::internal::WriteVarint(5, val, mutable_unknown_fields());
+          }
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* VoteMessage::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:dsnet.transaction.granola.proto.VoteMessage)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required uint64 clientid = 1;
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(1, this->_internal_clientid(), target);
+  }
+
+  // required uint64 clientreqid = 2;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(2, this->_internal_clientreqid(), target);
+  }
+
+  // required uint32 shard_num = 3;
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(3, this->_internal_shard_num(), target);
+  }
+
+  // required uint32 nshards = 4;
+  if (cached_has_bits & 0x00000008u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(4, this->_internal_nshards(), target);
+  }
+
+  // required .dsnet.transaction.granola.proto.Status status = 5;
+  if (cached_has_bits & 0x00000010u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      5, this->_internal_status(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:dsnet.transaction.granola.proto.VoteMessage)
+  return target;
+}
+
+size_t VoteMessage::RequiredFieldsByteSizeFallback() const {
+// @@protoc_insertion_point(required_fields_byte_size_fallback_start:dsnet.transaction.granola.proto.VoteMessage)
+  size_t total_size = 0;
+
+  if (_internal_has_clientid()) {
+    // required uint64 clientid = 1;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_clientid());
+  }
+
+  if (_internal_has_clientreqid()) {
+    // required uint64 clientreqid = 2;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_clientreqid());
+  }
+
+  if (_internal_has_shard_num()) {
+    // required uint32 shard_num = 3;
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_shard_num());
+  }
+
+  if (_internal_has_nshards()) {
+    // required uint32 nshards = 4;
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_nshards());
+  }
+
+  if (_internal_has_status()) {
+    // required .dsnet.transaction.granola.proto.Status status = 5;
+    total_size += 1 +
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_status());
+  }
+
+  return total_size;
+}
+size_t VoteMessage::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:dsnet.transaction.granola.proto.VoteMessage)
+  size_t total_size = 0;
+
+  if (((_impl_._has_bits_[0] & 0x0000001f) ^ 0x0000001f) == 0) {  // All required fields are present.
+    // required uint64 clientid = 1;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_clientid());
+
+    // required uint64 clientreqid = 2;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_clientreqid());
+
+    // required uint32 shard_num = 3;
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_shard_num());
+
+    // required uint32 nshards = 4;
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_nshards());
+
+    // required .dsnet.transaction.granola.proto.Status status = 5;
+    total_size += 1 +
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_status());
+
+  } else {
+    total_size += RequiredFieldsByteSizeFallback();
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData VoteMessage::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    VoteMessage::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*VoteMessage::GetClassData() const { return &_class_data_; }
+
+
+void VoteMessage::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<VoteMessage*>(&to_msg);
+  auto& from = static_cast<const VoteMessage&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:dsnet.transaction.granola.proto.VoteMessage)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000001fu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_impl_.clientid_ = from._impl_.clientid_;
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.clientreqid_ = from._impl_.clientreqid_;
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.shard_num_ = from._impl_.shard_num_;
+    }
+    if (cached_has_bits & 0x00000008u) {
+      _this->_impl_.nshards_ = from._impl_.nshards_;
+    }
+    if (cached_has_bits & 0x00000010u) {
+      _this->_impl_.status_ = from._impl_.status_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void VoteMessage::CopyFrom(const VoteMessage& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:dsnet.transaction.granola.proto.VoteMessage)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool VoteMessage::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  return true;
+}
+
+void VoteMessage::InternalSwap(VoteMessage* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(VoteMessage, _impl_.status_)
+      + sizeof(VoteMessage::_impl_.status_)
+      - PROTOBUF_FIELD_OFFSET(VoteMessage, _impl_.clientid_)>(
+          reinterpret_cast<char*>(&_impl_.clientid_),
+          reinterpret_cast<char*>(&other->_impl_.clientid_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata VoteMessage::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_transaction_2fgranola_2fgranola_2dproto_2eproto_getter, &descriptor_table_transaction_2fgranola_2fgranola_2dproto_2eproto_once,
+      file_level_metadata_transaction_2fgranola_2fgranola_2dproto_2eproto[5]);
+}
+
+// ===================================================================
+
+class VoteRequestMessage::_Internal {
+ public:
+  using HasBits = decltype(std::declval<VoteRequestMessage>()._impl_._has_bits_);
+  static void set_has_clientid(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_clientreqid(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000003) ^ 0x00000003) != 0;
+  }
+};
+
+VoteRequestMessage::VoteRequestMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:dsnet.transaction.granola.proto.VoteRequestMessage)
+}
+VoteRequestMessage::VoteRequestMessage(const VoteRequestMessage& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  VoteRequestMessage* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.clientid_){}
+    , decltype(_impl_.clientreqid_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.clientid_, &from._impl_.clientid_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.clientreqid_) -
+    reinterpret_cast<char*>(&_impl_.clientid_)) + sizeof(_impl_.clientreqid_));
+  // @@protoc_insertion_point(copy_constructor:dsnet.transaction.granola.proto.VoteRequestMessage)
+}
+
+inline void VoteRequestMessage::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.clientid_){uint64_t{0u}}
+    , decltype(_impl_.clientreqid_){uint64_t{0u}}
+  };
+}
+
+VoteRequestMessage::~VoteRequestMessage() {
+  // @@protoc_insertion_point(destructor:dsnet.transaction.granola.proto.VoteRequestMessage)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void VoteRequestMessage::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void VoteRequestMessage::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void VoteRequestMessage::Clear() {
+// @@protoc_insertion_point(message_clear_start:dsnet.transaction.granola.proto.VoteRequestMessage)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    ::memset(&_impl_.clientid_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.clientreqid_) -
+        reinterpret_cast<char*>(&_impl_.clientid_)) + sizeof(_impl_.clientreqid_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* VoteRequestMessage::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required uint64 clientid = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_clientid(&has_bits);
+          _impl_.clientid_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required uint64 clientreqid = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _Internal::set_has_clientreqid(&has_bits);
+          _impl_.clientreqid_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* VoteRequestMessage::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:dsnet.transaction.granola.proto.VoteRequestMessage)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required uint64 clientid = 1;
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(1, this->_internal_clientid(), target);
+  }
+
+  // required uint64 clientreqid = 2;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(2, this->_internal_clientreqid(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:dsnet.transaction.granola.proto.VoteRequestMessage)
+  return target;
+}
+
+size_t VoteRequestMessage::RequiredFieldsByteSizeFallback() const {
+// @@protoc_insertion_point(required_fields_byte_size_fallback_start:dsnet.transaction.granola.proto.VoteRequestMessage)
+  size_t total_size = 0;
+
+  if (_internal_has_clientid()) {
+    // required uint64 clientid = 1;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_clientid());
+  }
+
+  if (_internal_has_clientreqid()) {
+    // required uint64 clientreqid = 2;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_clientreqid());
+  }
+
+  return total_size;
+}
+size_t VoteRequestMessage::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:dsnet.transaction.granola.proto.VoteRequestMessage)
+  size_t total_size = 0;
+
+  if (((_impl_._has_bits_[0] & 0x00000003) ^ 0x00000003) == 0) {  // All required fields are present.
+    // required uint64 clientid = 1;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_clientid());
+
+    // required uint64 clientreqid = 2;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_clientreqid());
+
+  } else {
+    total_size += RequiredFieldsByteSizeFallback();
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData VoteRequestMessage::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    VoteRequestMessage::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*VoteRequestMessage::GetClassData() const { return &_class_data_; }
+
+
+void VoteRequestMessage::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<VoteRequestMessage*>(&to_msg);
+  auto& from = static_cast<const VoteRequestMessage&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:dsnet.transaction.granola.proto.VoteRequestMessage)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_impl_.clientid_ = from._impl_.clientid_;
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.clientreqid_ = from._impl_.clientreqid_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void VoteRequestMessage::CopyFrom(const VoteRequestMessage& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:dsnet.transaction.granola.proto.VoteRequestMessage)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool VoteRequestMessage::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  return true;
+}
+
+void VoteRequestMessage::InternalSwap(VoteRequestMessage* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(VoteRequestMessage, _impl_.clientreqid_)
+      + sizeof(VoteRequestMessage::_impl_.clientreqid_)
+      - PROTOBUF_FIELD_OFFSET(VoteRequestMessage, _impl_.clientid_)>(
+          reinterpret_cast<char*>(&_impl_.clientid_),
+          reinterpret_cast<char*>(&other->_impl_.clientid_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata VoteRequestMessage::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_transaction_2fgranola_2fgranola_2dproto_2eproto_getter, &descriptor_table_transaction_2fgranola_2fgranola_2dproto_2eproto_once,
+      file_level_metadata_transaction_2fgranola_2fgranola_2dproto_2eproto[6]);
+}
+
+// ===================================================================
+
+class FinalTimestampMessage::_Internal {
+ public:
+  using HasBits = decltype(std::declval<FinalTimestampMessage>()._impl_._has_bits_);
+  static void set_has_view(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_opnum(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_timestamp(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static void set_has_status(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x0000000f) ^ 0x0000000f) != 0;
+  }
+};
+
+FinalTimestampMessage::FinalTimestampMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:dsnet.transaction.granola.proto.FinalTimestampMessage)
+}
+FinalTimestampMessage::FinalTimestampMessage(const FinalTimestampMessage& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  FinalTimestampMessage* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.view_){}
+    , decltype(_impl_.opnum_){}
+    , decltype(_impl_.timestamp_){}
+    , decltype(_impl_.status_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.view_, &from._impl_.view_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.status_) -
+    reinterpret_cast<char*>(&_impl_.view_)) + sizeof(_impl_.status_));
+  // @@protoc_insertion_point(copy_constructor:dsnet.transaction.granola.proto.FinalTimestampMessage)
+}
+
+inline void FinalTimestampMessage::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.view_){uint64_t{0u}}
+    , decltype(_impl_.opnum_){uint64_t{0u}}
+    , decltype(_impl_.timestamp_){uint64_t{0u}}
+    , decltype(_impl_.status_){0}
+  };
+}
+
+FinalTimestampMessage::~FinalTimestampMessage() {
+  // @@protoc_insertion_point(destructor:dsnet.transaction.granola.proto.FinalTimestampMessage)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void FinalTimestampMessage::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void FinalTimestampMessage::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void FinalTimestampMessage::Clear() {
+// @@protoc_insertion_point(message_clear_start:dsnet.transaction.granola.proto.FinalTimestampMessage)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000000fu) {
+    ::memset(&_impl_.view_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.status_) -
+        reinterpret_cast<char*>(&_impl_.view_)) + sizeof(_impl_.status_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* FinalTimestampMessage::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required uint64 view = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_view(&has_bits);
+          _impl_.view_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required uint64 opnum = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _Internal::set_has_opnum(&has_bits);
+          _impl_.opnum_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required uint64 timestamp = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _Internal::set_has_timestamp(&has_bits);
+          _impl_.timestamp_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required .dsnet.transaction.granola.proto.Status status = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          if (PROTOBUF_PREDICT_TRUE(::dsnet::transaction::granola::proto::Status_IsValid(val))) {
+            _internal_set_status(static_cast<::dsnet::transaction::granola::proto::Status>(val));
+          } else {
+            ::PROTOBUF_NAMESPACE_ID::internal::WriteVarint(4, val, mutable_unknown_fields());
+          }
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* FinalTimestampMessage::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:dsnet.transaction.granola.proto.FinalTimestampMessage)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required uint64 view = 1;
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(1, this->_internal_view(), target);
+  }
+
+  // required uint64 opnum = 2;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(2, this->_internal_opnum(), target);
+  }
+
+  // required uint64 timestamp = 3;
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(3, this->_internal_timestamp(), target);
+  }
+
+  // required .dsnet.transaction.granola.proto.Status status = 4;
+  if (cached_has_bits & 0x00000008u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      4, this->_internal_status(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:dsnet.transaction.granola.proto.FinalTimestampMessage)
+  return target;
+}
+
+size_t FinalTimestampMessage::RequiredFieldsByteSizeFallback() const {
+// @@protoc_insertion_point(required_fields_byte_size_fallback_start:dsnet.transaction.granola.proto.FinalTimestampMessage)
+  size_t total_size = 0;
+
+  if (_internal_has_view()) {
+    // required uint64 view = 1;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_view());
+  }
+
+  if (_internal_has_opnum()) {
+    // required uint64 opnum = 2;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_opnum());
+  }
+
+  if (_internal_has_timestamp()) {
+    // required uint64 timestamp = 3;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_timestamp());
+  }
+
+  if (_internal_has_status()) {
+    // required .dsnet.transaction.granola.proto.Status status = 4;
+    total_size += 1 +
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_status());
+  }
+
+  return total_size;
+}
+size_t FinalTimestampMessage::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:dsnet.transaction.granola.proto.FinalTimestampMessage)
+  size_t total_size = 0;
+
+  if (((_impl_._has_bits_[0] & 0x0000000f) ^ 0x0000000f) == 0) {  // All required fields are present.
+    // required uint64 view = 1;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_view());
+
+    // required uint64 opnum = 2;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_opnum());
+
+    // required uint64 timestamp = 3;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_timestamp());
+
+    // required .dsnet.transaction.granola.proto.Status status = 4;
+    total_size += 1 +
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_status());
+
+  } else {
+    total_size += RequiredFieldsByteSizeFallback();
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData FinalTimestampMessage::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    FinalTimestampMessage::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*FinalTimestampMessage::GetClassData() const { return &_class_data_; }
+
+
+void FinalTimestampMessage::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<FinalTimestampMessage*>(&to_msg);
+  auto& from = static_cast<const FinalTimestampMessage&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:dsnet.transaction.granola.proto.FinalTimestampMessage)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000000fu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_impl_.view_ = from._impl_.view_;
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.opnum_ = from._impl_.opnum_;
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.timestamp_ = from._impl_.timestamp_;
+    }
+    if (cached_has_bits & 0x00000008u) {
+      _this->_impl_.status_ = from._impl_.status_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void FinalTimestampMessage::CopyFrom(const FinalTimestampMessage& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:dsnet.transaction.granola.proto.FinalTimestampMessage)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool FinalTimestampMessage::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  return true;
+}
+
+void FinalTimestampMessage::InternalSwap(FinalTimestampMessage* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(FinalTimestampMessage, _impl_.status_)
+      + sizeof(FinalTimestampMessage::_impl_.status_)
+      - PROTOBUF_FIELD_OFFSET(FinalTimestampMessage, _impl_.view_)>(
+          reinterpret_cast<char*>(&_impl_.view_),
+          reinterpret_cast<char*>(&other->_impl_.view_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata FinalTimestampMessage::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_transaction_2fgranola_2fgranola_2dproto_2eproto_getter, &descriptor_table_transaction_2fgranola_2fgranola_2dproto_2eproto_once,
+      file_level_metadata_transaction_2fgranola_2fgranola_2dproto_2eproto[7]);
+}
+
+// ===================================================================
+
+class ToServerMessage::_Internal {
+ public:
+  static const ::dsnet::transaction::granola::proto::RequestMessage& request(const ToServerMessage* msg);
+  static const ::dsnet::transaction::granola::proto::PrepareMessage& prepare(const ToServerMessage* msg);
+  static const ::dsnet::transaction::granola::proto::PrepareOKMessage& prepare_ok(const ToServerMessage* msg);
+  static const ::dsnet::transaction::granola::proto::CommitMessage& commit(const ToServerMessage* msg);
+  static const ::dsnet::transaction::granola::proto::VoteMessage& vote(const ToServerMessage* msg);
+  static const ::dsnet::transaction::granola::proto::VoteRequestMessage& vote_request(const ToServerMessage* msg);
+  static const ::dsnet::transaction::granola::proto::FinalTimestampMessage& final_timestamp(const ToServerMessage* msg);
+};
+
+const ::dsnet::transaction::granola::proto::RequestMessage&
+ToServerMessage::_Internal::request(const ToServerMessage* msg) {
+  return *msg->_impl_.msg_.request_;
+}
+const ::dsnet::transaction::granola::proto::PrepareMessage&
+ToServerMessage::_Internal::prepare(const ToServerMessage* msg) {
+  return *msg->_impl_.msg_.prepare_;
+}
+const ::dsnet::transaction::granola::proto::PrepareOKMessage&
+ToServerMessage::_Internal::prepare_ok(const ToServerMessage* msg) {
+  return *msg->_impl_.msg_.prepare_ok_;
+}
+const ::dsnet::transaction::granola::proto::CommitMessage&
+ToServerMessage::_Internal::commit(const ToServerMessage* msg) {
+  return *msg->_impl_.msg_.commit_;
+}
+const ::dsnet::transaction::granola::proto::VoteMessage&
+ToServerMessage::_Internal::vote(const ToServerMessage* msg) {
+  return *msg->_impl_.msg_.vote_;
+}
+const ::dsnet::transaction::granola::proto::VoteRequestMessage&
+ToServerMessage::_Internal::vote_request(const ToServerMessage* msg) {
+  return *msg->_impl_.msg_.vote_request_;
+}
+const ::dsnet::transaction::granola::proto::FinalTimestampMessage&
+ToServerMessage::_Internal::final_timestamp(const ToServerMessage* msg) {
+  return *msg->_impl_.msg_.final_timestamp_;
+}
+void ToServerMessage::set_allocated_request(::dsnet::transaction::granola::proto::RequestMessage* request) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  clear_msg();
+  if (request) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(request);
+    if (message_arena != submessage_arena) {
+      request = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, request, submessage_arena);
+    }
+    set_has_request();
+    _impl_.msg_.request_ = request;
+  }
+  // @@protoc_insertion_point(field_set_allocated:dsnet.transaction.granola.proto.ToServerMessage.request)
+}
+void ToServerMessage::set_allocated_prepare(::dsnet::transaction::granola::proto::PrepareMessage* prepare) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  clear_msg();
+  if (prepare) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(prepare);
+    if (message_arena != submessage_arena) {
+      prepare = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, prepare, submessage_arena);
+    }
+    set_has_prepare();
+    _impl_.msg_.prepare_ = prepare;
+  }
+  // @@protoc_insertion_point(field_set_allocated:dsnet.transaction.granola.proto.ToServerMessage.prepare)
+}
+void ToServerMessage::set_allocated_prepare_ok(::dsnet::transaction::granola::proto::PrepareOKMessage* prepare_ok) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  clear_msg();
+  if (prepare_ok) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(prepare_ok);
+    if (message_arena != submessage_arena) {
+      prepare_ok = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, prepare_ok, submessage_arena);
+    }
+    set_has_prepare_ok();
+    _impl_.msg_.prepare_ok_ = prepare_ok;
+  }
+  // @@protoc_insertion_point(field_set_allocated:dsnet.transaction.granola.proto.ToServerMessage.prepare_ok)
+}
+void ToServerMessage::set_allocated_commit(::dsnet::transaction::granola::proto::CommitMessage* commit) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  clear_msg();
+  if (commit) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(commit);
+    if (message_arena != submessage_arena) {
+      commit = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, commit, submessage_arena);
+    }
+    set_has_commit();
+    _impl_.msg_.commit_ = commit;
+  }
+  // @@protoc_insertion_point(field_set_allocated:dsnet.transaction.granola.proto.ToServerMessage.commit)
+}
+void ToServerMessage::set_allocated_vote(::dsnet::transaction::granola::proto::VoteMessage* vote) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  clear_msg();
+  if (vote) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(vote);
+    if (message_arena != submessage_arena) {
+      vote = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, vote, submessage_arena);
+    }
+    set_has_vote();
+    _impl_.msg_.vote_ = vote;
+  }
+  // @@protoc_insertion_point(field_set_allocated:dsnet.transaction.granola.proto.ToServerMessage.vote)
+}
+void ToServerMessage::set_allocated_vote_request(::dsnet::transaction::granola::proto::VoteRequestMessage* vote_request) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  clear_msg();
+  if (vote_request) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(vote_request);
+    if (message_arena != submessage_arena) {
+      vote_request = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, vote_request, submessage_arena);
+    }
+    set_has_vote_request();
+    _impl_.msg_.vote_request_ = vote_request;
+  }
+  // @@protoc_insertion_point(field_set_allocated:dsnet.transaction.granola.proto.ToServerMessage.vote_request)
+}
+void ToServerMessage::set_allocated_final_timestamp(::dsnet::transaction::granola::proto::FinalTimestampMessage* final_timestamp) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  clear_msg();
+  if (final_timestamp) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(final_timestamp);
+    if (message_arena != submessage_arena) {
+      final_timestamp = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, final_timestamp, submessage_arena);
+    }
+    set_has_final_timestamp();
+    _impl_.msg_.final_timestamp_ = final_timestamp;
+  }
+  // @@protoc_insertion_point(field_set_allocated:dsnet.transaction.granola.proto.ToServerMessage.final_timestamp)
+}
+ToServerMessage::ToServerMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:dsnet.transaction.granola.proto.ToServerMessage)
+}
+ToServerMessage::ToServerMessage(const ToServerMessage& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  ToServerMessage* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.msg_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , /*decltype(_impl_._oneof_case_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  clear_has_msg();
+  switch (from.msg_case()) {
+    case kRequest: {
+      _this->_internal_mutable_request()->::dsnet::transaction::granola::proto::RequestMessage::MergeFrom(
+          from._internal_request());
+      break;
+    }
+    case kPrepare: {
+      _this->_internal_mutable_prepare()->::dsnet::transaction::granola::proto::PrepareMessage::MergeFrom(
+          from._internal_prepare());
+      break;
+    }
+    case kPrepareOk: {
+      _this->_internal_mutable_prepare_ok()->::dsnet::transaction::granola::proto::PrepareOKMessage::MergeFrom(
+          from._internal_prepare_ok());
+      break;
+    }
+    case kCommit: {
+      _this->_internal_mutable_commit()->::dsnet::transaction::granola::proto::CommitMessage::MergeFrom(
+          from._internal_commit());
+      break;
+    }
+    case kVote: {
+      _this->_internal_mutable_vote()->::dsnet::transaction::granola::proto::VoteMessage::MergeFrom(
+          from._internal_vote());
+      break;
+    }
+    case kVoteRequest: {
+      _this->_internal_mutable_vote_request()->::dsnet::transaction::granola::proto::VoteRequestMessage::MergeFrom(
+          from._internal_vote_request());
+      break;
+    }
+    case kFinalTimestamp: {
+      _this->_internal_mutable_final_timestamp()->::dsnet::transaction::granola::proto::FinalTimestampMessage::MergeFrom(
+          from._internal_final_timestamp());
+      break;
+    }
+    case MSG_NOT_SET: {
+      break;
+    }
+  }
+  // @@protoc_insertion_point(copy_constructor:dsnet.transaction.granola.proto.ToServerMessage)
+}
+
+inline void ToServerMessage::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.msg_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , /*decltype(_impl_._oneof_case_)*/{}
+  };
+  clear_has_msg();
+}
+
+ToServerMessage::~ToServerMessage() {
+  // @@protoc_insertion_point(destructor:dsnet.transaction.granola.proto.ToServerMessage)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void ToServerMessage::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  if (has_msg()) {
+    clear_msg();
+  }
+}
+
+void ToServerMessage::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void ToServerMessage::clear_msg() {
+// @@protoc_insertion_point(one_of_clear_start:dsnet.transaction.granola.proto.ToServerMessage)
+  switch (msg_case()) {
+    case kRequest: {
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.msg_.request_;
+      }
+      break;
+    }
+    case kPrepare: {
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.msg_.prepare_;
+      }
+      break;
+    }
+    case kPrepareOk: {
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.msg_.prepare_ok_;
+      }
+      break;
+    }
+    case kCommit: {
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.msg_.commit_;
+      }
+      break;
+    }
+    case kVote: {
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.msg_.vote_;
+      }
+      break;
+    }
+    case kVoteRequest: {
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.msg_.vote_request_;
+      }
+      break;
+    }
+    case kFinalTimestamp: {
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.msg_.final_timestamp_;
+      }
+      break;
+    }
+    case MSG_NOT_SET: {
+      break;
+    }
+  }
+  _impl_._oneof_case_[0] = MSG_NOT_SET;
+}
+
+
+void ToServerMessage::Clear() {
+// @@protoc_insertion_point(message_clear_start:dsnet.transaction.granola.proto.ToServerMessage)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  clear_msg();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* ToServerMessage::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // .dsnet.transaction.granola.proto.RequestMessage request = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr = ctx->ParseMessage(_internal_mutable_request(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .dsnet.transaction.granola.proto.PrepareMessage prepare = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr = ctx->ParseMessage(_internal_mutable_prepare(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .dsnet.transaction.granola.proto.PrepareOKMessage prepare_ok = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          ptr = ctx->ParseMessage(_internal_mutable_prepare_ok(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .dsnet.transaction.granola.proto.CommitMessage commit = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          ptr = ctx->ParseMessage(_internal_mutable_commit(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .dsnet.transaction.granola.proto.VoteMessage vote = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 42)) {
+          ptr = ctx->ParseMessage(_internal_mutable_vote(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .dsnet.transaction.granola.proto.VoteRequestMessage vote_request = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 50)) {
+          ptr = ctx->ParseMessage(_internal_mutable_vote_request(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .dsnet.transaction.granola.proto.FinalTimestampMessage final_timestamp = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 58)) {
+          ptr = ctx->ParseMessage(_internal_mutable_final_timestamp(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* ToServerMessage::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:dsnet.transaction.granola.proto.ToServerMessage)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  switch (msg_case()) {
+    case kRequest: {
+      target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(1, _Internal::request(this),
+          _Internal::request(this).GetCachedSize(), target, stream);
+      break;
+    }
+    case kPrepare: {
+      target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(2, _Internal::prepare(this),
+          _Internal::prepare(this).GetCachedSize(), target, stream);
+      break;
+    }
+    case kPrepareOk: {
+      target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(3, _Internal::prepare_ok(this),
+          _Internal::prepare_ok(this).GetCachedSize(), target, stream);
+      break;
+    }
+    case kCommit: {
+      target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(4, _Internal::commit(this),
+          _Internal::commit(this).GetCachedSize(), target, stream);
+      break;
+    }
+    case kVote: {
+      target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(5, _Internal::vote(this),
+          _Internal::vote(this).GetCachedSize(), target, stream);
+      break;
+    }
+    case kVoteRequest: {
+      target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(6, _Internal::vote_request(this),
+          _Internal::vote_request(this).GetCachedSize(), target, stream);
+      break;
+    }
+    case kFinalTimestamp: {
+      target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(7, _Internal::final_timestamp(this),
+          _Internal::final_timestamp(this).GetCachedSize(), target, stream);
+      break;
+    }
+    default: ;
+  }
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:dsnet.transaction.granola.proto.ToServerMessage)
+  return target;
+}
+
+size_t ToServerMessage::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:dsnet.transaction.granola.proto.ToServerMessage)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  switch (msg_case()) {
+    // .dsnet.transaction.granola.proto.RequestMessage request = 1;
+    case kRequest: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.msg_.request_);
+      break;
+    }
+    // .dsnet.transaction.granola.proto.PrepareMessage prepare = 2;
+    case kPrepare: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.msg_.prepare_);
+      break;
+    }
+    // .dsnet.transaction.granola.proto.PrepareOKMessage prepare_ok = 3;
+    case kPrepareOk: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.msg_.prepare_ok_);
+      break;
+    }
+    // .dsnet.transaction.granola.proto.CommitMessage commit = 4;
+    case kCommit: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.msg_.commit_);
+      break;
+    }
+    // .dsnet.transaction.granola.proto.VoteMessage vote = 5;
+    case kVote: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.msg_.vote_);
+      break;
+    }
+    // .dsnet.transaction.granola.proto.VoteRequestMessage vote_request = 6;
+    case kVoteRequest: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.msg_.vote_request_);
+      break;
+    }
+    // .dsnet.transaction.granola.proto.FinalTimestampMessage final_timestamp = 7;
+    case kFinalTimestamp: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.msg_.final_timestamp_);
+      break;
+    }
+    case MSG_NOT_SET: {
+      break;
+    }
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ToServerMessage::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    ToServerMessage::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ToServerMessage::GetClassData() const { return &_class_data_; }
+
+
+void ToServerMessage::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<ToServerMessage*>(&to_msg);
+  auto& from = static_cast<const ToServerMessage&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:dsnet.transaction.granola.proto.ToServerMessage)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  switch (from.msg_case()) {
+    case kRequest: {
+      _this->_internal_mutable_request()->::dsnet::transaction::granola::proto::RequestMessage::MergeFrom(
+          from._internal_request());
+      break;
+    }
+    case kPrepare: {
+      _this->_internal_mutable_prepare()->::dsnet::transaction::granola::proto::PrepareMessage::MergeFrom(
+          from._internal_prepare());
+      break;
+    }
+    case kPrepareOk: {
+      _this->_internal_mutable_prepare_ok()->::dsnet::transaction::granola::proto::PrepareOKMessage::MergeFrom(
+          from._internal_prepare_ok());
+      break;
+    }
+    case kCommit: {
+      _this->_internal_mutable_commit()->::dsnet::transaction::granola::proto::CommitMessage::MergeFrom(
+          from._internal_commit());
+      break;
+    }
+    case kVote: {
+      _this->_internal_mutable_vote()->::dsnet::transaction::granola::proto::VoteMessage::MergeFrom(
+          from._internal_vote());
+      break;
+    }
+    case kVoteRequest: {
+      _this->_internal_mutable_vote_request()->::dsnet::transaction::granola::proto::VoteRequestMessage::MergeFrom(
+          from._internal_vote_request());
+      break;
+    }
+    case kFinalTimestamp: {
+      _this->_internal_mutable_final_timestamp()->::dsnet::transaction::granola::proto::FinalTimestampMessage::MergeFrom(
+          from._internal_final_timestamp());
+      break;
+    }
+    case MSG_NOT_SET: {
+      break;
+    }
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void ToServerMessage::CopyFrom(const ToServerMessage& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:dsnet.transaction.granola.proto.ToServerMessage)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool ToServerMessage::IsInitialized() const {
+  switch (msg_case()) {
+    case kRequest: {
+      if (_internal_has_request()) {
+        if (!_impl_.msg_.request_->IsInitialized()) return false;
+      }
+      break;
+    }
+    case kPrepare: {
+      if (_internal_has_prepare()) {
+        if (!_impl_.msg_.prepare_->IsInitialized()) return false;
+      }
+      break;
+    }
+    case kPrepareOk: {
+      if (_internal_has_prepare_ok()) {
+        if (!_impl_.msg_.prepare_ok_->IsInitialized()) return false;
+      }
+      break;
+    }
+    case kCommit: {
+      if (_internal_has_commit()) {
+        if (!_impl_.msg_.commit_->IsInitialized()) return false;
+      }
+      break;
+    }
+    case kVote: {
+      if (_internal_has_vote()) {
+        if (!_impl_.msg_.vote_->IsInitialized()) return false;
+      }
+      break;
+    }
+    case kVoteRequest: {
+      if (_internal_has_vote_request()) {
+        if (!_impl_.msg_.vote_request_->IsInitialized()) return false;
+      }
+      break;
+    }
+    case kFinalTimestamp: {
+      if (_internal_has_final_timestamp()) {
+        if (!_impl_.msg_.final_timestamp_->IsInitialized()) return false;
+      }
+      break;
+    }
+    case MSG_NOT_SET: {
+      break;
+    }
+  }
+  return true;
+}
+
+void ToServerMessage::InternalSwap(ToServerMessage* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_.msg_, other->_impl_.msg_);
+  swap(_impl_._oneof_case_[0], other->_impl_._oneof_case_[0]);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata ToServerMessage::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_transaction_2fgranola_2fgranola_2dproto_2eproto_getter, &descriptor_table_transaction_2fgranola_2fgranola_2dproto_2eproto_once,
+      file_level_metadata_transaction_2fgranola_2fgranola_2dproto_2eproto[8]);
+}
+
+// @@protoc_insertion_point(namespace_scope)
+}  // namespace proto
+}  // namespace granola
+}  // namespace transaction
+}  // namespace dsnet
+PROTOBUF_NAMESPACE_OPEN
+template<> PROTOBUF_NOINLINE ::dsnet::transaction::granola::proto::ReplyMessage*
+Arena::CreateMaybeMessage< ::dsnet::transaction::granola::proto::ReplyMessage >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::dsnet::transaction::granola::proto::ReplyMessage >(arena);
+}
+template<> PROTOBUF_NOINLINE ::dsnet::transaction::granola::proto::RequestMessage*
+Arena::CreateMaybeMessage< ::dsnet::transaction::granola::proto::RequestMessage >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::dsnet::transaction::granola::proto::RequestMessage >(arena);
+}
+template<> PROTOBUF_NOINLINE ::dsnet::transaction::granola::proto::PrepareMessage*
+Arena::CreateMaybeMessage< ::dsnet::transaction::granola::proto::PrepareMessage >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::dsnet::transaction::granola::proto::PrepareMessage >(arena);
+}
+template<> PROTOBUF_NOINLINE ::dsnet::transaction::granola::proto::PrepareOKMessage*
+Arena::CreateMaybeMessage< ::dsnet::transaction::granola::proto::PrepareOKMessage >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::dsnet::transaction::granola::proto::PrepareOKMessage >(arena);
+}
+template<> PROTOBUF_NOINLINE ::dsnet::transaction::granola::proto::CommitMessage*
+Arena::CreateMaybeMessage< ::dsnet::transaction::granola::proto::CommitMessage >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::dsnet::transaction::granola::proto::CommitMessage >(arena);
+}
+template<> PROTOBUF_NOINLINE ::dsnet::transaction::granola::proto::VoteMessage*
+Arena::CreateMaybeMessage< ::dsnet::transaction::granola::proto::VoteMessage >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::dsnet::transaction::granola::proto::VoteMessage >(arena);
+}
+template<> PROTOBUF_NOINLINE ::dsnet::transaction::granola::proto::VoteRequestMessage*
+Arena::CreateMaybeMessage< ::dsnet::transaction::granola::proto::VoteRequestMessage >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::dsnet::transaction::granola::proto::VoteRequestMessage >(arena);
+}
+template<> PROTOBUF_NOINLINE ::dsnet::transaction::granola::proto::FinalTimestampMessage*
+Arena::CreateMaybeMessage< ::dsnet::transaction::granola::proto::FinalTimestampMessage >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::dsnet::transaction::granola::proto::FinalTimestampMessage >(arena);
+}
+template<> PROTOBUF_NOINLINE ::dsnet::transaction::granola::proto::ToServerMessage*
+Arena::CreateMaybeMessage< ::dsnet::transaction::granola::proto::ToServerMessage >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::dsnet::transaction::granola::proto::ToServerMessage >(arena);
+}
+PROTOBUF_NAMESPACE_CLOSE
+
+// @@protoc_insertion_point(global_scope)
+#include <google/protobuf/port_undef.inc>
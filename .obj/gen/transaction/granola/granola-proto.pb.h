@@ -0,0 +1,3740 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: transaction/granola/granola-proto.proto
+
+#ifndef GOOGLE_PROTOBUF_INCLUDED_transaction_2fgranola_2fgranola_2dproto_2eproto
+#define GOOGLE_PROTOBUF_INCLUDED_transaction_2fgranola_2fgranola_2dproto_2eproto
+
+#include <limits>
+#include <string>
+
+#include <google/protobuf/port_def.inc>
+#if PROTOBUF_VERSION < 3021000
+#error This file was generated by a newer version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please update
+#error your headers.
+#endif
+#if 3021012 < PROTOBUF_MIN_PROTOC_VERSION
+#error This file was generated by an older version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please
+#error regenerate this file with a newer version of protoc.
+#endif
+
+#include <google/protobuf/port_undef.inc>
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/arena.h>
+#include <google/protobuf/arenastring.h>
+#include <google/protobuf/generated_message_util.h>
+#include <google/protobuf/metadata_lite.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/message.h>
+#include <google/protobuf/repeated_field.h>  // IWYU pragma: export
+#include <google/protobuf/extension_set.h>  // IWYU pragma: export
+#include <google/protobuf/generated_enum_reflection.h>
+#include <google/protobuf/unknown_field_set.h>
+#include "common/request.pb.h"
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+#define PROTOBUF_INTERNAL_EXPORT_transaction_2fgranola_2fgranola_2dproto_2eproto
+PROTOBUF_NAMESPACE_OPEN
+namespace internal {
+class AnyMetadata;
+}  // namespace internal
+PROTOBUF_NAMESPACE_CLOSE
+
+// Internal implementation detail -- do not use these members.
+struct TableStruct_transaction_2fgranola_2fgranola_2dproto_2eproto {
+  static const uint32_t offsets[];
+};
+extern const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_transaction_2fgranola_2fgranola_2dproto_2eproto;
+namespace dsnet {
+namespace transaction {
+namespace granola {
+namespace proto {
+class CommitMessage;
+struct CommitMessageDefaultTypeInternal;
+extern CommitMessageDefaultTypeInternal _CommitMessage_default_instance_;
+class FinalTimestampMessage;
+struct FinalTimestampMessageDefaultTypeInternal;
+extern FinalTimestampMessageDefaultTypeInternal _FinalTimestampMessage_default_instance_;
+class PrepareMessage;
+struct PrepareMessageDefaultTypeInternal;
+extern PrepareMessageDefaultTypeInternal _PrepareMessage_default_instance_;
+class PrepareOKMessage;
+struct PrepareOKMessageDefaultTypeInternal;
+extern PrepareOKMessageDefaultTypeInternal _PrepareOKMessage_default_instance_;
+class ReplyMessage;
+struct ReplyMessageDefaultTypeInternal;
+extern ReplyMessageDefaultTypeInternal _ReplyMessage_default_instance_;
+class RequestMessage;
+struct RequestMessageDefaultTypeInternal;
+extern RequestMessageDefaultTypeInternal _RequestMessage_default_instance_;
+class ToServerMessage;
+struct ToServerMessageDefaultTypeInternal;
+extern ToServerMessageDefaultTypeInternal _ToServerMessage_default_instance_;
+class VoteMessage;
+struct VoteMessageDefaultTypeInternal;
+extern VoteMessageDefaultTypeInternal _VoteMessage_default_instance_;
+class VoteRequestMessage;
+struct VoteRequestMessageDefaultTypeInternal;
+extern VoteRequestMessageDefaultTypeInternal _VoteRequestMessage_default_instance_;
+}  // namespace proto
+}  // namespace granola
+}  // namespace transaction
+}  // namespace dsnet
+PROTOBUF_NAMESPACE_OPEN
+template<> ::dsnet::transaction::granola::proto::CommitMessage* Arena::CreateMaybeMessage<::dsnet::transaction::granola::proto::CommitMessage>(Arena*);
+template<> ::dsnet::transaction::granola::proto::FinalTimestampMessage* Arena::CreateMaybeMessage<::dsnet::transaction::granola::proto::FinalTimestampMessage>(Arena*);
+template<> ::dsnet::transaction::granola::proto::PrepareMessage* Arena::CreateMaybeMessage<::dsnet::transaction::granola::proto::PrepareMessage>(Arena*);
+template<> ::dsnet::transaction::granola::proto::PrepareOKMessage* Arena::CreateMaybeMessage<::dsnet::transaction::granola::proto::PrepareOKMessage>(Arena*);
+template<> ::dsnet::transaction::granola::proto::ReplyMessage* Arena::CreateMaybeMessage<::dsnet::transaction::granola::proto::ReplyMessage>(Arena*);
+template<> ::dsnet::transaction::granola::proto::RequestMessage* Arena::CreateMaybeMessage<::dsnet::transaction::granola::proto::RequestMessage>(Arena*);
+template<> ::dsnet::transaction::granola::proto::ToServerMessage* Arena::CreateMaybeMessage<::dsnet::transaction::granola::proto::ToServerMessage>(Arena*);
+template<> ::dsnet::transaction::granola::proto::VoteMessage* Arena::CreateMaybeMessage<::dsnet::transaction::granola::proto::VoteMessage>(Arena*);
+template<> ::dsnet::transaction::granola::proto::VoteRequestMessage* Arena::CreateMaybeMessage<::dsnet::transaction::granola::proto::VoteRequestMessage>(Arena*);
+PROTOBUF_NAMESPACE_CLOSE
+namespace dsnet {
+namespace transaction {
+namespace granola {
+namespace proto {
+
+enum Status : int {
+  COMMIT = 0,
+  ABORT = 1,
+  CONFLICT = 2
+};
+bool Status_IsValid(int value);
+constexpr Status Status_MIN = COMMIT;
+constexpr Status Status_MAX = CONFLICT;
+constexpr int Status_ARRAYSIZE = Status_MAX + 1;
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* Status_descriptor();
+template<typename T>
+inline const std::string& Status_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, Status>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function Status_Name.");
+  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
+    Status_descriptor(), enum_t_value);
+}
+inline bool Status_Parse(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, Status* value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<Status>(
+    Status_descriptor(), name, value);
+}
+// ===================================================================
+
+class ReplyMessage final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:dsnet.transaction.granola.proto.ReplyMessage) */ {
+ public:
+  inline ReplyMessage() : ReplyMessage(nullptr) {}
+  ~ReplyMessage() override;
+  explicit PROTOBUF_CONSTEXPR ReplyMessage(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  ReplyMessage(const ReplyMessage& from);
+  ReplyMessage(ReplyMessage&& from) noexcept
+    : ReplyMessage() {
+    *this = ::std::move(from);
+  }
+
+  inline ReplyMessage& operator=(const ReplyMessage& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline ReplyMessage& operator=(ReplyMessage&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ReplyMessage& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const ReplyMessage* internal_default_instance() {
+    return reinterpret_cast<const ReplyMessage*>(
+               &_ReplyMessage_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    0;
+
+  friend void swap(ReplyMessage& a, ReplyMessage& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(ReplyMessage* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ReplyMessage* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  ReplyMessage* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ReplyMessage>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const ReplyMessage& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ReplyMessage& from) {
+    ReplyMessage::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(ReplyMessage* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "dsnet.transaction.granola.proto.ReplyMessage";
+  }
+  protected:
+  explicit ReplyMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kReplyFieldNumber = 4,
+    kClientreqidFieldNumber = 1,
+    kShardNumFieldNumber = 2,
+    kStatusFieldNumber = 3,
+  };
+  // optional bytes reply = 4;
+  bool has_reply() const;
+  private:
+  bool _internal_has_reply() const;
+  public:
+  void clear_reply();
+  const std::string& reply() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_reply(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_reply();
+  PROTOBUF_NODISCARD std::string* release_reply();
+  void set_allocated_reply(std::string* reply);
+  private:
+  const std::string& _internal_reply() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_reply(const std::string& value);
+  std::string* _internal_mutable_reply();
+  public:
+
+  // required uint64 clientreqid = 1;
+  bool has_clientreqid() const;
+  private:
+  bool _internal_has_clientreqid() const;
+  public:
+  void clear_clientreqid();
+  uint64_t clientreqid() const;
+  void set_clientreqid(uint64_t value);
+  private:
+  uint64_t _internal_clientreqid() const;
+  void _internal_set_clientreqid(uint64_t value);
+  public:
+
+  // required uint32 shard_num = 2;
+  bool has_shard_num() const;
+  private:
+  bool _internal_has_shard_num() const;
+  public:
+  void clear_shard_num();
+  uint32_t shard_num() const;
+  void set_shard_num(uint32_t value);
+  private:
+  uint32_t _internal_shard_num() const;
+  void _internal_set_shard_num(uint32_t value);
+  public:
+
+  // required .dsnet.transaction.granola.proto.Status status = 3;
+  bool has_status() const;
+  private:
+  bool _internal_has_status() const;
+  public:
+  void clear_status();
+  ::dsnet::transaction::granola::proto::Status status() const;
+  void set_status(::dsnet::transaction::granola::proto::Status value);
+  private:
+  ::dsnet::transaction::granola::proto::Status _internal_status() const;
+  void _internal_set_status(::dsnet::transaction::granola::proto::Status value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:dsnet.transaction.granola.proto.ReplyMessage)
+ private:
+  class _Internal;
+
+  // helper for ByteSizeLong()
+  size_t RequiredFieldsByteSizeFallback() const;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr reply_;
+    uint64_t clientreqid_;
+    uint32_t shard_num_;
+    int status_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_transaction_2fgranola_2fgranola_2dproto_2eproto;
+};
+// -------------------------------------------------------------------
+
+class RequestMessage final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:dsnet.transaction.granola.proto.RequestMessage) */ {
+ public:
+  inline RequestMessage() : RequestMessage(nullptr) {}
+  ~RequestMessage() override;
+  explicit PROTOBUF_CONSTEXPR RequestMessage(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  RequestMessage(const RequestMessage& from);
+  RequestMessage(RequestMessage&& from) noexcept
+    : RequestMessage() {
+    *this = ::std::move(from);
+  }
+
+  inline RequestMessage& operator=(const RequestMessage& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline RequestMessage& operator=(RequestMessage&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const RequestMessage& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const RequestMessage* internal_default_instance() {
+    return reinterpret_cast<const RequestMessage*>(
+               &_RequestMessage_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    1;
+
+  friend void swap(RequestMessage& a, RequestMessage& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(RequestMessage* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(RequestMessage* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  RequestMessage* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<RequestMessage>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const RequestMessage& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const RequestMessage& from) {
+    RequestMessage::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(RequestMessage* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "dsnet.transaction.granola.proto.RequestMessage";
+  }
+  protected:
+  explicit RequestMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kRequestFieldNumber = 4,
+    kTxnidFieldNumber = 1,
+    kIndepFieldNumber = 2,
+    kRoFieldNumber = 3,
+  };
+  // required .dsnet.Request request = 4;
+  bool has_request() const;
+  private:
+  bool _internal_has_request() const;
+  public:
+  void clear_request();
+  const ::dsnet::Request& request() const;
+  PROTOBUF_NODISCARD ::dsnet::Request* release_request();
+  ::dsnet::Request* mutable_request();
+  void set_allocated_request(::dsnet::Request* request);
+  private:
+  const ::dsnet::Request& _internal_request() const;
+  ::dsnet::Request* _internal_mutable_request();
+  public:
+  void unsafe_arena_set_allocated_request(
+      ::dsnet::Request* request);
+  ::dsnet::Request* unsafe_arena_release_request();
+
+  // required uint64 txnid = 1;
+  bool has_txnid() const;
+  private:
+  bool _internal_has_txnid() const;
+  public:
+  void clear_txnid();
+  uint64_t txnid() const;
+  void set_txnid(uint64_t value);
+  private:
+  uint64_t _internal_txnid() const;
+  void _internal_set_txnid(uint64_t value);
+  public:
+
+  // required bool indep = 2;
+  bool has_indep() const;
+  private:
+  bool _internal_has_indep() const;
+  public:
+  void clear_indep();
+  bool indep() const;
+  void set_indep(bool value);
+  private:
+  bool _internal_indep() const;
+  void _internal_set_indep(bool value);
+  public:
+
+  // required bool ro = 3;
+  bool has_ro() const;
+  private:
+  bool _internal_has_ro() const;
+  public:
+  void clear_ro();
+  bool ro() const;
+  void set_ro(bool value);
+  private:
+  bool _internal_ro() const;
+  void _internal_set_ro(bool value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:dsnet.transaction.granola.proto.RequestMessage)
+ private:
+  class _Internal;
+
+  // helper for ByteSizeLong()
+  size_t RequiredFieldsByteSizeFallback() const;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::dsnet::Request* request_;
+    uint64_t txnid_;
+    bool indep_;
+    bool ro_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_transaction_2fgranola_2fgranola_2dproto_2eproto;
+};
+// -------------------------------------------------------------------
+
+class PrepareMessage final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:dsnet.transaction.granola.proto.PrepareMessage) */ {
+ public:
+  inline PrepareMessage() : PrepareMessage(nullptr) {}
+  ~PrepareMessage() override;
+  explicit PROTOBUF_CONSTEXPR PrepareMessage(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  PrepareMessage(const PrepareMessage& from);
+  PrepareMessage(PrepareMessage&& from) noexcept
+    : PrepareMessage() {
+    *this = ::std::move(from);
+  }
+
+  inline PrepareMessage& operator=(const PrepareMessage& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline PrepareMessage& operator=(PrepareMessage&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const PrepareMessage& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const PrepareMessage* internal_default_instance() {
+    return reinterpret_cast<const PrepareMessage*>(
+               &_PrepareMessage_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    2;
+
+  friend void swap(PrepareMessage& a, PrepareMessage& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(PrepareMessage* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(PrepareMessage* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  PrepareMessage* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<PrepareMessage>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const PrepareMessage& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const PrepareMessage& from) {
+    PrepareMessage::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(PrepareMessage* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "dsnet.transaction.granola.proto.PrepareMessage";
+  }
+  protected:
+  explicit PrepareMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kRequestFieldNumber = 6,
+    kViewFieldNumber = 1,
+    kOpnumFieldNumber = 2,
+    kTxnidFieldNumber = 3,
+    kTimestampFieldNumber = 7,
+    kIndepFieldNumber = 4,
+    kRoFieldNumber = 5,
+  };
+  // required .dsnet.Request request = 6;
+  bool has_request() const;
+  private:
+  bool _internal_has_request() const;
+  public:
+  void clear_request();
+  const ::dsnet::Request& request() const;
+  PROTOBUF_NODISCARD ::dsnet::Request* release_request();
+  ::dsnet::Request* mutable_request();
+  void set_allocated_request(::dsnet::Request* request);
+  private:
+  const ::dsnet::Request& _internal_request() const;
+  ::dsnet::Request* _internal_mutable_request();
+  public:
+  void unsafe_arena_set_allocated_request(
+      ::dsnet::Request* request);
+  ::dsnet::Request* unsafe_arena_release_request();
+
+  // required uint64 view = 1;
+  bool has_view() const;
+  private:
+  bool _internal_has_view() const;
+  public:
+  void clear_view();
+  uint64_t view() const;
+  void set_view(uint64_t value);
+  private:
+  uint64_t _internal_view() const;
+  void _internal_set_view(uint64_t value);
+  public:
+
+  // required uint64 opnum = 2;
+  bool has_opnum() const;
+  private:
+  bool _internal_has_opnum() const;
+  public:
+  void clear_opnum();
+  uint64_t opnum() const;
+  void set_opnum(uint64_t value);
+  private:
+  uint64_t _internal_opnum() const;
+  void _internal_set_opnum(uint64_t value);
+  public:
+
+  // required uint64 txnid = 3;
+  bool has_txnid() const;
+  private:
+  bool _internal_has_txnid() const;
+  public:
+  void clear_txnid();
+  uint64_t txnid() const;
+  void set_txnid(uint64_t value);
+  private:
+  uint64_t _internal_txnid() const;
+  void _internal_set_txnid(uint64_t value);
+  public:
+
+  // required uint64 timestamp = 7;
+  bool has_timestamp() const;
+  private:
+  bool _internal_has_timestamp() const;
+  public:
+  void clear_timestamp();
+  uint64_t timestamp() const;
+  void set_timestamp(uint64_t value);
+  private:
+  uint64_t _internal_timestamp() const;
+  void _internal_set_timestamp(uint64_t value);
+  public:
+
+  // required bool indep = 4;
+  bool has_indep() const;
+  private:
+  bool _internal_has_indep() const;
+  public:
+  void clear_indep();
+  bool indep() const;
+  void set_indep(bool value);
+  private:
+  bool _internal_indep() const;
+  void _internal_set_indep(bool value);
+  public:
+
+  // required bool ro = 5;
+  bool has_ro() const;
+  private:
+  bool _internal_has_ro() const;
+  public:
+  void clear_ro();
+  bool ro() const;
+  void set_ro(bool value);
+  private:
+  bool _internal_ro() const;
+  void _internal_set_ro(bool value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:dsnet.transaction.granola.proto.PrepareMessage)
+ private:
+  class _Internal;
+
+  // helper for ByteSizeLong()
+  size_t RequiredFieldsByteSizeFallback() const;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::dsnet::Request* request_;
+    uint64_t view_;
+    uint64_t opnum_;
+    uint64_t txnid_;
+    uint64_t timestamp_;
+    bool indep_;
+    bool ro_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_transaction_2fgranola_2fgranola_2dproto_2eproto;
+};
+// -------------------------------------------------------------------
+
+class PrepareOKMessage final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:dsnet.transaction.granola.proto.PrepareOKMessage) */ {
+ public:
+  inline PrepareOKMessage() : PrepareOKMessage(nullptr) {}
+  ~PrepareOKMessage() override;
+  explicit PROTOBUF_CONSTEXPR PrepareOKMessage(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  PrepareOKMessage(const PrepareOKMessage& from);
+  PrepareOKMessage(PrepareOKMessage&& from) noexcept
+    : PrepareOKMessage() {
+    *this = ::std::move(from);
+  }
+
+  inline PrepareOKMessage& operator=(const PrepareOKMessage& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline PrepareOKMessage& operator=(PrepareOKMessage&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const PrepareOKMessage& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const PrepareOKMessage* internal_default_instance() {
+    return reinterpret_cast<const PrepareOKMessage*>(
+               &_PrepareOKMessage_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    3;
+
+  friend void swap(PrepareOKMessage& a, PrepareOKMessage& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(PrepareOKMessage* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(PrepareOKMessage* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  PrepareOKMessage* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<PrepareOKMessage>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const PrepareOKMessage& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const PrepareOKMessage& from) {
+    PrepareOKMessage::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(PrepareOKMessage* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "dsnet.transaction.granola.proto.PrepareOKMessage";
+  }
+  protected:
+  explicit PrepareOKMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kViewFieldNumber = 1,
+    kOpnumFieldNumber = 2,
+    kReplicaNumFieldNumber = 3,
+  };
+  // required uint64 view = 1;
+  bool has_view() const;
+  private:
+  bool _internal_has_view() const;
+  public:
+  void clear_view();
+  uint64_t view() const;
+  void set_view(uint64_t value);
+  private:
+  uint64_t _internal_view() const;
+  void _internal_set_view(uint64_t value);
+  public:
+
+  // required uint64 opnum = 2;
+  bool has_opnum() const;
+  private:
+  bool _internal_has_opnum() const;
+  public:
+  void clear_opnum();
+  uint64_t opnum() const;
+  void set_opnum(uint64_t value);
+  private:
+  uint64_t _internal_opnum() const;
+  void _internal_set_opnum(uint64_t value);
+  public:
+
+  // required uint32 replica_num = 3;
+  bool has_replica_num() const;
+  private:
+  bool _internal_has_replica_num() const;
+  public:
+  void clear_replica_num();
+  uint32_t replica_num() const;
+  void set_replica_num(uint32_t value);
+  private:
+  uint32_t _internal_replica_num() const;
+  void _internal_set_replica_num(uint32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:dsnet.transaction.granola.proto.PrepareOKMessage)
+ private:
+  class _Internal;
+
+  // helper for ByteSizeLong()
+  size_t RequiredFieldsByteSizeFallback() const;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    uint64_t view_;
+    uint64_t opnum_;
+    uint32_t replica_num_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_transaction_2fgranola_2fgranola_2dproto_2eproto;
+};
+// -------------------------------------------------------------------
+
+class CommitMessage final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:dsnet.transaction.granola.proto.CommitMessage) */ {
+ public:
+  inline CommitMessage() : CommitMessage(nullptr) {}
+  ~CommitMessage() override;
+  explicit PROTOBUF_CONSTEXPR CommitMessage(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  CommitMessage(const CommitMessage& from);
+  CommitMessage(CommitMessage&& from) noexcept
+    : CommitMessage() {
+    *this = ::std::move(from);
+  }
+
+  inline CommitMessage& operator=(const CommitMessage& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline CommitMessage& operator=(CommitMessage&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const CommitMessage& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const CommitMessage* internal_default_instance() {
+    return reinterpret_cast<const CommitMessage*>(
+               &_CommitMessage_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    4;
+
+  friend void swap(CommitMessage& a, CommitMessage& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(CommitMessage* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(CommitMessage* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  CommitMessage* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<CommitMessage>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const CommitMessage& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const CommitMessage& from) {
+    CommitMessage::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(CommitMessage* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "dsnet.transaction.granola.proto.CommitMessage";
+  }
+  protected:
+  explicit CommitMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kViewFieldNumber = 1,
+    kOpnumFieldNumber = 2,
+  };
+  // required uint64 view = 1;
+  bool has_view() const;
+  private:
+  bool _internal_has_view() const;
+  public:
+  void clear_view();
+  uint64_t view() const;
+  void set_view(uint64_t value);
+  private:
+  uint64_t _internal_view() const;
+  void _internal_set_view(uint64_t value);
+  public:
+
+  // required uint64 opnum = 2;
+  bool has_opnum() const;
+  private:
+  bool _internal_has_opnum() const;
+  public:
+  void clear_opnum();
+  uint64_t opnum() const;
+  void set_opnum(uint64_t value);
+  private:
+  uint64_t _internal_opnum() const;
+  void _internal_set_opnum(uint64_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:dsnet.transaction.granola.proto.CommitMessage)
+ private:
+  class _Internal;
+
+  // helper for ByteSizeLong()
+  size_t RequiredFieldsByteSizeFallback() const;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    uint64_t view_;
+    uint64_t opnum_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_transaction_2fgranola_2fgranola_2dproto_2eproto;
+};
+// -------------------------------------------------------------------
+
+class VoteMessage final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:dsnet.transaction.granola.proto.VoteMessage) */ {
+ public:
+  inline VoteMessage() : VoteMessage(nullptr) {}
+  ~VoteMessage() override;
+  explicit PROTOBUF_CONSTEXPR VoteMessage(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  VoteMessage(const VoteMessage& from);
+  VoteMessage(VoteMessage&& from) noexcept
+    : VoteMessage() {
+    *this = ::std::move(from);
+  }
+
+  inline VoteMessage& operator=(const VoteMessage& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline VoteMessage& operator=(VoteMessage&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const VoteMessage& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const VoteMessage* internal_default_instance() {
+    return reinterpret_cast<const VoteMessage*>(
+               &_VoteMessage_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    5;
+
+  friend void swap(VoteMessage& a, VoteMessage& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(VoteMessage* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(VoteMessage* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  VoteMessage* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<VoteMessage>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const VoteMessage& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const VoteMessage& from) {
+    VoteMessage::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(VoteMessage* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "dsnet.transaction.granola.proto.VoteMessage";
+  }
+  protected:
+  explicit VoteMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kClientidFieldNumber = 1,
+    kClientreqidFieldNumber = 2,
+    kShardNumFieldNumber = 3,
+    kNshardsFieldNumber = 4,
+    kStatusFieldNumber = 5,
+  };
+  // required uint64 clientid = 1;
+  bool has_clientid() const;
+  private:
+  bool _internal_has_clientid() const;
+  public:
+  void clear_clientid();
+  uint64_t clientid() const;
+  void set_clientid(uint64_t value);
+  private:
+  uint64_t _internal_clientid() const;
+  void _internal_set_clientid(uint64_t value);
+  public:
+
+  // required uint64 clientreqid = 2;
+  bool has_clientreqid() const;
+  private:
+  bool _internal_has_clientreqid() const;
+  public:
+  void clear_clientreqid();
+  uint64_t clientreqid() const;
+  void set_clientreqid(uint64_t value);
+  private:
+  uint64_t _internal_clientreqid() const;
+  void _internal_set_clientreqid(uint64_t value);
+  public:
+
+  // required uint32 shard_num = 3;
+  bool has_shard_num() const;
+  private:
+  bool _internal_has_shard_num() const;
+  public:
+  void clear_shard_num();
+  uint32_t shard_num() const;
+  void set_shard_num(uint32_t value);
+  private:
+  uint32_t _internal_shard_num() const;
+  void _internal_set_shard_num(uint32_t value);
+  public:
+
+  // required uint32 nshards = 4;
+  bool has_nshards() const;
+  private:
+  bool _internal_has_nshards() const;
+  public:
+  void clear_nshards();
+  uint32_t nshards() const;
+  void set_nshards(uint32_t value);
+  private:
+  uint32_t _internal_nshards() const;
+  void _internal_set_nshards(uint32_t value);
+  public:
+
+  // required .dsnet.transaction.granola.proto.Status status = 5;
+  bool has_status() const;
+  private:
+  bool _internal_has_status() const;
+  public:
+  void clear_status();
+  ::dsnet::transaction::granola::proto::Status status() const;
+  void set_status(::dsnet::transaction::granola::proto::Status value);
+  private:
+  ::dsnet::transaction::granola::proto::Status _internal_status() const;
+  void _internal_set_status(::dsnet::transaction::granola::proto::Status value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:dsnet.transaction.granola.proto.VoteMessage)
+ private:
+  class _Internal;
+
+  // helper for ByteSizeLong()
+  size_t RequiredFieldsByteSizeFallback() const;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    uint64_t clientid_;
+    uint64_t clientreqid_;
+    uint32_t shard_num_;
+    uint32_t nshards_;
+    int status_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_transaction_2fgranola_2fgranola_2dproto_2eproto;
+};
+// -------------------------------------------------------------------
+
+class VoteRequestMessage final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:dsnet.transaction.granola.proto.VoteRequestMessage) */ {
+ public:
+  inline VoteRequestMessage() : VoteRequestMessage(nullptr) {}
+  ~VoteRequestMessage() override;
+  explicit PROTOBUF_CONSTEXPR VoteRequestMessage(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  VoteRequestMessage(const VoteRequestMessage& from);
+  VoteRequestMessage(VoteRequestMessage&& from) noexcept
+    : VoteRequestMessage() {
+    *this = ::std::move(from);
+  }
+
+  inline VoteRequestMessage& operator=(const VoteRequestMessage& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline VoteRequestMessage& operator=(VoteRequestMessage&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const VoteRequestMessage& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const VoteRequestMessage* internal_default_instance() {
+    return reinterpret_cast<const VoteRequestMessage*>(
+               &_VoteRequestMessage_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    6;
+
+  friend void swap(VoteRequestMessage& a, VoteRequestMessage& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(VoteRequestMessage* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(VoteRequestMessage* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  VoteRequestMessage* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<VoteRequestMessage>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const VoteRequestMessage& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const VoteRequestMessage& from) {
+    VoteRequestMessage::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(VoteRequestMessage* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "dsnet.transaction.granola.proto.VoteRequestMessage";
+  }
+  protected:
+  explicit VoteRequestMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kClientidFieldNumber = 1,
+    kClientreqidFieldNumber = 2,
+  };
+  // required uint64 clientid = 1;
+  bool has_clientid() const;
+  private:
+  bool _internal_has_clientid() const;
+  public:
+  void clear_clientid();
+  uint64_t clientid() const;
+  void set_clientid(uint64_t value);
+  private:
+  uint64_t _internal_clientid() const;
+  void _internal_set_clientid(uint64_t value);
+  public:
+
+  // required uint64 clientreqid = 2;
+  bool has_clientreqid() const;
+  private:
+  bool _internal_has_clientreqid() const;
+  public:
+  void clear_clientreqid();
+  uint64_t clientreqid() const;
+  void set_clientreqid(uint64_t value);
+  private:
+  uint64_t _internal_clientreqid() const;
+  void _internal_set_clientreqid(uint64_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:dsnet.transaction.granola.proto.VoteRequestMessage)
+ private:
+  class _Internal;
+
+  // helper for ByteSizeLong()
+  size_t RequiredFieldsByteSizeFallback() const;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    uint64_t clientid_;
+    uint64_t clientreqid_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_transaction_2fgranola_2fgranola_2dproto_2eproto;
+};
+// -------------------------------------------------------------------
+
+class FinalTimestampMessage final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:dsnet.transaction.granola.proto.FinalTimestampMessage) */ {
+ public:
+  inline FinalTimestampMessage() : FinalTimestampMessage(nullptr) {}
+  ~FinalTimestampMessage() override;
+  explicit PROTOBUF_CONSTEXPR FinalTimestampMessage(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  FinalTimestampMessage(const FinalTimestampMessage& from);
+  FinalTimestampMessage(FinalTimestampMessage&& from) noexcept
+    : FinalTimestampMessage() {
+    *this = ::std::move(from);
+  }
+
+  inline FinalTimestampMessage& operator=(const FinalTimestampMessage& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline FinalTimestampMessage& operator=(FinalTimestampMessage&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const FinalTimestampMessage& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const FinalTimestampMessage* internal_default_instance() {
+    return reinterpret_cast<const FinalTimestampMessage*>(
+               &_FinalTimestampMessage_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    7;
+
+  friend void swap(FinalTimestampMessage& a, FinalTimestampMessage& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(FinalTimestampMessage* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(FinalTimestampMessage* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  FinalTimestampMessage* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<FinalTimestampMessage>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const FinalTimestampMessage& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const FinalTimestampMessage& from) {
+    FinalTimestampMessage::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(FinalTimestampMessage* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "dsnet.transaction.granola.proto.FinalTimestampMessage";
+  }
+  protected:
+  explicit FinalTimestampMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kViewFieldNumber = 1,
+    kOpnumFieldNumber = 2,
+    kTimestampFieldNumber = 3,
+    kStatusFieldNumber = 4,
+  };
+  // required uint64 view = 1;
+  bool has_view() const;
+  private:
+  bool _internal_has_view() const;
+  public:
+  void clear_view();
+  uint64_t view() const;
+  void set_view(uint64_t value);
+  private:
+  uint64_t _internal_view() const;
+  void _internal_set_view(uint64_t value);
+  public:
+
+  // required uint64 opnum = 2;
+  bool has_opnum() const;
+  private:
+  bool _internal_has_opnum() const;
+  public:
+  void clear_opnum();
+  uint64_t opnum() const;
+  void set_opnum(uint64_t value);
+  private:
+  uint64_t _internal_opnum() const;
+  void _internal_set_opnum(uint64_t value);
+  public:
+
+  // required uint64 timestamp = 3;
+  bool has_timestamp() const;
+  private:
+  bool _internal_has_timestamp() const;
+  public:
+  void clear_timestamp();
+  uint64_t timestamp() const;
+  void set_timestamp(uint64_t value);
+  private:
+  uint64_t _internal_timestamp() const;
+  void _internal_set_timestamp(uint64_t value);
+  public:
+
+  // required .dsnet.transaction.granola.proto.Status status = 4;
+  bool has_status() const;
+  private:
+  bool _internal_has_status() const;
+  public:
+  void clear_status();
+  ::dsnet::transaction::granola::proto::Status status() const;
+  void set_status(::dsnet::transaction::granola::proto::Status value);
+  private:
+  ::dsnet::transaction::granola::proto::Status _internal_status() const;
+  void _internal_set_status(::dsnet::transaction::granola::proto::Status value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:dsnet.transaction.granola.proto.FinalTimestampMessage)
+ private:
+  class _Internal;
+
+  // helper for ByteSizeLong()
+  size_t RequiredFieldsByteSizeFallback() const;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    uint64_t view_;
+    uint64_t opnum_;
+    uint64_t timestamp_;
+    int status_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_transaction_2fgranola_2fgranola_2dproto_2eproto;
+};
+// -------------------------------------------------------------------
+
+class ToServerMessage final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:dsnet.transaction.granola.proto.ToServerMessage) */ {
+ public:
+  inline ToServerMessage() : ToServerMessage(nullptr) {}
+  ~ToServerMessage() override;
+  explicit PROTOBUF_CONSTEXPR ToServerMessage(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  ToServerMessage(const ToServerMessage& from);
+  ToServerMessage(ToServerMessage&& from) noexcept
+    : ToServerMessage() {
+    *this = ::std::move(from);
+  }
+
+  inline ToServerMessage& operator=(const ToServerMessage& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline ToServerMessage& operator=(ToServerMessage&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ToServerMessage& default_instance() {
+    return *internal_default_instance();
+  }
+  enum MsgCase {
+    kRequest = 1,
+    kPrepare = 2,
+    kPrepareOk = 3,
+    kCommit = 4,
+    kVote = 5,
+    kVoteRequest = 6,
+    kFinalTimestamp = 7,
+    MSG_NOT_SET = 0,
+  };
+
+  static inline const ToServerMessage* internal_default_instance() {
+    return reinterpret_cast<const ToServerMessage*>(
+               &_ToServerMessage_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    8;
+
+  friend void swap(ToServerMessage& a, ToServerMessage& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(ToServerMessage* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ToServerMessage* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  ToServerMessage* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ToServerMessage>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const ToServerMessage& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ToServerMessage& from) {
+    ToServerMessage::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(ToServerMessage* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "dsnet.transaction.granola.proto.ToServerMessage";
+  }
+  protected:
+  explicit ToServerMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kRequestFieldNumber = 1,
+    kPrepareFieldNumber = 2,
+    kPrepareOkFieldNumber = 3,
+    kCommitFieldNumber = 4,
+    kVoteFieldNumber = 5,
+    kVoteRequestFieldNumber = 6,
+    kFinalTimestampFieldNumber = 7,
+  };
+  // .dsnet.transaction.granola.proto.RequestMessage request = 1;
+  bool has_request() const;
+  private:
+  bool _internal_has_request() const;
+  public:
+  void clear_request();
+  const ::dsnet::transaction::granola::proto::RequestMessage& request() const;
+  PROTOBUF_NODISCARD ::dsnet::transaction::granola::proto::RequestMessage* release_request();
+  ::dsnet::transaction::granola::proto::RequestMessage* mutable_request();
+  void set_allocated_request(::dsnet::transaction::granola::proto::RequestMessage* request);
+  private:
+  const ::dsnet::transaction::granola::proto::RequestMessage& _internal_request() const;
+  ::dsnet::transaction::granola::proto::RequestMessage* _internal_mutable_request();
+  public:
+  void unsafe_arena_set_allocated_request(
+      ::dsnet::transaction::granola::proto::RequestMessage* request);
+  ::dsnet::transaction::granola::proto::RequestMessage* unsafe_arena_release_request();
+
+  // .dsnet.transaction.granola.proto.PrepareMessage prepare = 2;
+  bool has_prepare() const;
+  private:
+  bool _internal_has_prepare() const;
+  public:
+  void clear_prepare();
+  const ::dsnet::transaction::granola::proto::PrepareMessage& prepare() const;
+  PROTOBUF_NODISCARD ::dsnet::transaction::granola::proto::PrepareMessage* release_prepare();
+  ::dsnet::transaction::granola::proto::PrepareMessage* mutable_prepare();
+  void set_allocated_prepare(::dsnet::transaction::granola::proto::PrepareMessage* prepare);
+  private:
+  const ::dsnet::transaction::granola::proto::PrepareMessage& _internal_prepare() const;
+  ::dsnet::transaction::granola::proto::PrepareMessage* _internal_mutable_prepare();
+  public:
+  void unsafe_arena_set_allocated_prepare(
+      ::dsnet::transaction::granola::proto::PrepareMessage* prepare);
+  ::dsnet::transaction::granola::proto::PrepareMessage* unsafe_arena_release_prepare();
+
+  // .dsnet.transaction.granola.proto.PrepareOKMessage prepare_ok = 3;
+  bool has_prepare_ok() const;
+  private:
+  bool _internal_has_prepare_ok() const;
+  public:
+  void clear_prepare_ok();
+  const ::dsnet::transaction::granola::proto::PrepareOKMessage& prepare_ok() const;
+  PROTOBUF_NODISCARD ::dsnet::transaction::granola::proto::PrepareOKMessage* release_prepare_ok();
+  ::dsnet::transaction::granola::proto::PrepareOKMessage* mutable_prepare_ok();
+  void set_allocated_prepare_ok(::dsnet::transaction::granola::proto::PrepareOKMessage* prepare_ok);
+  private:
+  const ::dsnet::transaction::granola::proto::PrepareOKMessage& _internal_prepare_ok() const;
+  ::dsnet::transaction::granola::proto::PrepareOKMessage* _internal_mutable_prepare_ok();
+  public:
+  void unsafe_arena_set_allocated_prepare_ok(
+      ::dsnet::transaction::granola::proto::PrepareOKMessage* prepare_ok);
+  ::dsnet::transaction::granola::proto::PrepareOKMessage* unsafe_arena_release_prepare_ok();
+
+  // .dsnet.transaction.granola.proto.CommitMessage commit = 4;
+  bool has_commit() const;
+  private:
+  bool _internal_has_commit() const;
+  public:
+  void clear_commit();
+  const ::dsnet::transaction::granola::proto::CommitMessage& commit() const;
+  PROTOBUF_NODISCARD ::dsnet::transaction::granola::proto::CommitMessage* release_commit();
+  ::dsnet::transaction::granola::proto::CommitMessage* mutable_commit();
+  void set_allocated_commit(::dsnet::transaction::granola::proto::CommitMessage* commit);
+  private:
+  const ::dsnet::transaction::granola::proto::CommitMessage& _internal_commit() const;
+  ::dsnet::transaction::granola::proto::CommitMessage* _internal_mutable_commit();
+  public:
+  void unsafe_arena_set_allocated_commit(
+      ::dsnet::transaction::granola::proto::CommitMessage* commit);
+  ::dsnet::transaction::granola::proto::CommitMessage* unsafe_arena_release_commit();
+
+  // .dsnet.transaction.granola.proto.VoteMessage vote = 5;
+  bool has_vote() const;
+  private:
+  bool _internal_has_vote() const;
+  public:
+  void clear_vote();
+  const ::dsnet::transaction::granola::proto::VoteMessage& vote() const;
+  PROTOBUF_NODISCARD ::dsnet::transaction::granola::proto::VoteMessage* release_vote();
+  ::dsnet::transaction::granola::proto::VoteMessage* mutable_vote();
+  void set_allocated_vote(::dsnet::transaction::granola::proto::VoteMessage* vote);
+  private:
+  const ::dsnet::transaction::granola::proto::VoteMessage& _internal_vote() const;
+  ::dsnet::transaction::granola::proto::VoteMessage* _internal_mutable_vote();
+  public:
+  void unsafe_arena_set_allocated_vote(
+      ::dsnet::transaction::granola::proto::VoteMessage* vote);
+  ::dsnet::transaction::granola::proto::VoteMessage* unsafe_arena_release_vote();
+
+  // .dsnet.transaction.granola.proto.VoteRequestMessage vote_request = 6;
+  bool has_vote_request() const;
+  private:
+  bool _internal_has_vote_request() const;
+  public:
+  void clear_vote_request();
+  const ::dsnet::transaction::granola::proto::VoteRequestMessage& vote_request() const;
+  PROTOBUF_NODISCARD ::dsnet::transaction::granola::proto::VoteRequestMessage* release_vote_request();
+  ::dsnet::transaction::granola::proto::VoteRequestMessage* mutable_vote_request();
+  void set_allocated_vote_request(::dsnet::transaction::granola::proto::VoteRequestMessage* vote_request);
+  private:
+  const ::dsnet::transaction::granola::proto::VoteRequestMessage& _internal_vote_request() const;
+  ::dsnet::transaction::granola::proto::VoteRequestMessage* _internal_mutable_vote_request();
+  public:
+  void unsafe_arena_set_allocated_vote_request(
+      ::dsnet::transaction::granola::proto::VoteRequestMessage* vote_request);
+  ::dsnet::transaction::granola::proto::VoteRequestMessage* unsafe_arena_release_vote_request();
+
+  // .dsnet.transaction.granola.proto.FinalTimestampMessage final_timestamp = 7;
+  bool has_final_timestamp() const;
+  private:
+  bool _internal_has_final_timestamp() const;
+  public:
+  void clear_final_timestamp();
+  const ::dsnet::transaction::granola::proto::FinalTimestampMessage& final_timestamp() const;
+  PROTOBUF_NODISCARD ::dsnet::transaction::granola::proto::FinalTimestampMessage* release_final_timestamp();
+  ::dsnet::transaction::granola::proto::FinalTimestampMessage* mutable_final_timestamp();
+  void set_allocated_final_timestamp(::dsnet::transaction::granola::proto::FinalTimestampMessage* final_timestamp);
+  private:
+  const ::dsnet::transaction::granola::proto::FinalTimestampMessage& _internal_final_timestamp() const;
+  ::dsnet::transaction::granola::proto::FinalTimestampMessage* _internal_mutable_final_timestamp();
+  public:
+  void unsafe_arena_set_allocated_final_timestamp(
+      ::dsnet::transaction::granola::proto::FinalTimestampMessage* final_timestamp);
+  ::dsnet::transaction::granola::proto::FinalTimestampMessage* unsafe_arena_release_final_timestamp();
+
+  void clear_msg();
+  MsgCase msg_case() const;
+  // @@protoc_insertion_point(class_scope:dsnet.transaction.granola.proto.ToServerMessage)
+ private:
+  class _Internal;
+  void set_has_request();
+  void set_has_prepare();
+  void set_has_prepare_ok();
+  void set_has_commit();
+  void set_has_vote();
+  void set_has_vote_request();
+  void set_has_final_timestamp();
+
+  inline bool has_msg() const;
+  inline void clear_has_msg();
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    union MsgUnion {
+      constexpr MsgUnion() : _constinit_{} {}
+        ::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized _constinit_;
+      ::dsnet::transaction::granola::proto::RequestMessage* request_;
+      ::dsnet::transaction::granola::proto::PrepareMessage* prepare_;
+      ::dsnet::transaction::granola::proto::PrepareOKMessage* prepare_ok_;
+      ::dsnet::transaction::granola::proto::CommitMessage* commit_;
+      ::dsnet::transaction::granola::proto::VoteMessage* vote_;
+      ::dsnet::transaction::granola::proto::VoteRequestMessage* vote_request_;
+      ::dsnet::transaction::granola::proto::FinalTimestampMessage* final_timestamp_;
+    } msg_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    uint32_t _oneof_case_[1];
+
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_transaction_2fgranola_2fgranola_2dproto_2eproto;
+};
+// ===================================================================
+
+
+// ===================================================================
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
+#endif  // __GNUC__
+// ReplyMessage
+
+// required uint64 clientreqid = 1;
+inline bool ReplyMessage::_internal_has_clientreqid() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool ReplyMessage::has_clientreqid() const {
+  return _internal_has_clientreqid();
+}
+inline void ReplyMessage::clear_clientreqid() {
+  _impl_.clientreqid_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline uint64_t ReplyMessage::_internal_clientreqid() const {
+  return _impl_.clientreqid_;
+}
+inline uint64_t ReplyMessage::clientreqid() const {
+  // @@protoc_insertion_point(field_get:dsnet.transaction.granola.proto.ReplyMessage.clientreqid)
+  return _internal_clientreqid();
+}
+inline void ReplyMessage::_internal_set_clientreqid(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.clientreqid_ = value;
+}
+inline void ReplyMessage::set_clientreqid(uint64_t value) {
+  _internal_set_clientreqid(value);
+  // @@protoc_insertion_point(field_set:dsnet.transaction.granola.proto.ReplyMessage.clientreqid)
+}
+
+// required uint32 shard_num = 2;
+inline bool ReplyMessage::_internal_has_shard_num() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool ReplyMessage::has_shard_num() const {
+  return _internal_has_shard_num();
+}
+inline void ReplyMessage::clear_shard_num() {
+  _impl_.shard_num_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline uint32_t ReplyMessage::_internal_shard_num() const {
+  return _impl_.shard_num_;
+}
+inline uint32_t ReplyMessage::shard_num() const {
+  // @@protoc_insertion_point(field_get:dsnet.transaction.granola.proto.ReplyMessage.shard_num)
+  return _internal_shard_num();
+}
+inline void ReplyMessage::_internal_set_shard_num(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.shard_num_ = value;
+}
+inline void ReplyMessage::set_shard_num(uint32_t value) {
+  _internal_set_shard_num(value);
+  // @@protoc_insertion_point(field_set:dsnet.transaction.granola.proto.ReplyMessage.shard_num)
+}
+
+// required .dsnet.transaction.granola.proto.Status status = 3;
+inline bool ReplyMessage::_internal_has_status() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  return value;
+}
+inline bool ReplyMessage::has_status() const {
+  return _internal_has_status();
+}
+inline void ReplyMessage::clear_status() {
+  _impl_.status_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000008u;
+}
+inline ::dsnet::transaction::granola::proto::Status ReplyMessage::_internal_status() const {
+  return static_cast< ::dsnet::transaction::granola::proto::Status >(_impl_.status_);
+}
+inline ::dsnet::transaction::granola::proto::Status ReplyMessage::status() const {
+  // @@protoc_insertion_point(field_get:dsnet.transaction.granola.proto.ReplyMessage.status)
+  return _internal_status();
+}
+inline void ReplyMessage::_internal_set_status(::dsnet::transaction::granola::proto::Status value) {
+  assert(::dsnet::transaction::granola::proto::Status_IsValid(value));
+  _impl_._has_bits_[0] |= 0x00000008u;
+  _impl_.status_ = value;
+}
+inline void ReplyMessage::set_status(::dsnet::transaction::granola::proto::Status value) {
+  _internal_set_status(value);
+  // @@protoc_insertion_point(field_set:dsnet.transaction.granola.proto.ReplyMessage.status)
+}
+
+// optional bytes reply = 4;
+inline bool ReplyMessage::_internal_has_reply() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool ReplyMessage::has_reply() const {
+  return _internal_has_reply();
+}
+inline void ReplyMessage::clear_reply() {
+  _impl_.reply_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& ReplyMessage::reply() const {
+  // @@protoc_insertion_point(field_get:dsnet.transaction.granola.proto.ReplyMessage.reply)
+  return _internal_reply();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void ReplyMessage::set_reply(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.reply_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:dsnet.transaction.granola.proto.ReplyMessage.reply)
+}
+inline std::string* ReplyMessage::mutable_reply() {
+  std::string* _s = _internal_mutable_reply();
+  // @@protoc_insertion_point(field_mutable:dsnet.transaction.granola.proto.ReplyMessage.reply)
+  return _s;
+}
+inline const std::string& ReplyMessage::_internal_reply() const {
+  return _impl_.reply_.Get();
+}
+inline void ReplyMessage::_internal_set_reply(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.reply_.Set(value, GetArenaForAllocation());
+}
+inline std::string* ReplyMessage::_internal_mutable_reply() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.reply_.Mutable(GetArenaForAllocation());
+}
+inline std::string* ReplyMessage::release_reply() {
+  // @@protoc_insertion_point(field_release:dsnet.transaction.granola.proto.ReplyMessage.reply)
+  if (!_internal_has_reply()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.reply_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.reply_.IsDefault()) {
+    _impl_.reply_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void ReplyMessage::set_allocated_reply(std::string* reply) {
+  if (reply != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.reply_.SetAllocated(reply, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.reply_.IsDefault()) {
+    _impl_.reply_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:dsnet.transaction.granola.proto.ReplyMessage.reply)
+}
+
+// -------------------------------------------------------------------
+
+// RequestMessage
+
+// required uint64 txnid = 1;
+inline bool RequestMessage::_internal_has_txnid() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool RequestMessage::has_txnid() const {
+  return _internal_has_txnid();
+}
+inline void RequestMessage::clear_txnid() {
+  _impl_.txnid_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline uint64_t RequestMessage::_internal_txnid() const {
+  return _impl_.txnid_;
+}
+inline uint64_t RequestMessage::txnid() const {
+  // @@protoc_insertion_point(field_get:dsnet.transaction.granola.proto.RequestMessage.txnid)
+  return _internal_txnid();
+}
+inline void RequestMessage::_internal_set_txnid(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.txnid_ = value;
+}
+inline void RequestMessage::set_txnid(uint64_t value) {
+  _internal_set_txnid(value);
+  // @@protoc_insertion_point(field_set:dsnet.transaction.granola.proto.RequestMessage.txnid)
+}
+
+// required bool indep = 2;
+inline bool RequestMessage::_internal_has_indep() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool RequestMessage::has_indep() const {
+  return _internal_has_indep();
+}
+inline void RequestMessage::clear_indep() {
+  _impl_.indep_ = false;
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline bool RequestMessage::_internal_indep() const {
+  return _impl_.indep_;
+}
+inline bool RequestMessage::indep() const {
+  // @@protoc_insertion_point(field_get:dsnet.transaction.granola.proto.RequestMessage.indep)
+  return _internal_indep();
+}
+inline void RequestMessage::_internal_set_indep(bool value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.indep_ = value;
+}
+inline void RequestMessage::set_indep(bool value) {
+  _internal_set_indep(value);
+  // @@protoc_insertion_point(field_set:dsnet.transaction.granola.proto.RequestMessage.indep)
+}
+
+// required bool ro = 3;
+inline bool RequestMessage::_internal_has_ro() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  return value;
+}
+inline bool RequestMessage::has_ro() const {
+  return _internal_has_ro();
+}
+inline void RequestMessage::clear_ro() {
+  _impl_.ro_ = false;
+  _impl_._has_bits_[0] &= ~0x00000008u;
+}
+inline bool RequestMessage::_internal_ro() const {
+  return _impl_.ro_;
+}
+inline bool RequestMessage::ro() const {
+  // @@protoc_insertion_point(field_get:dsnet.transaction.granola.proto.RequestMessage.ro)
+  return _internal_ro();
+}
+inline void RequestMessage::_internal_set_ro(bool value) {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  _impl_.ro_ = value;
+}
+inline void RequestMessage::set_ro(bool value) {
+  _internal_set_ro(value);
+  // @@protoc_insertion_point(field_set:dsnet.transaction.granola.proto.RequestMessage.ro)
+}
+
+// required .dsnet.Request request = 4;
+inline bool RequestMessage::_internal_has_request() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.request_ != nullptr);
+  return value;
+}
+inline bool RequestMessage::has_request() const {
+  return _internal_has_request();
+}
+inline const ::dsnet::Request& RequestMessage::_internal_request() const {
+  const ::dsnet::Request* p = _impl_.request_;
+  return p != nullptr ? *p : reinterpret_cast<const ::dsnet::Request&>(
+      ::dsnet::_Request_default_instance_);
+}
+inline const ::dsnet::Request& RequestMessage::request() const {
+  // @@protoc_insertion_point(field_get:dsnet.transaction.granola.proto.RequestMessage.request)
+  return _internal_request();
+}
+inline void RequestMessage::unsafe_arena_set_allocated_request(
+    ::dsnet::Request* request) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.request_);
+  }
+  _impl_.request_ = request;
+  if (request) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:dsnet.transaction.granola.proto.RequestMessage.request)
+}
+inline ::dsnet::Request* RequestMessage::release_request() {
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::dsnet::Request* temp = _impl_.request_;
+  _impl_.request_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::dsnet::Request* RequestMessage::unsafe_arena_release_request() {
+  // @@protoc_insertion_point(field_release:dsnet.transaction.granola.proto.RequestMessage.request)
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::dsnet::Request* temp = _impl_.request_;
+  _impl_.request_ = nullptr;
+  return temp;
+}
+inline ::dsnet::Request* RequestMessage::_internal_mutable_request() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  if (_impl_.request_ == nullptr) {
+    auto* p = CreateMaybeMessage<::dsnet::Request>(GetArenaForAllocation());
+    _impl_.request_ = p;
+  }
+  return _impl_.request_;
+}
+inline ::dsnet::Request* RequestMessage::mutable_request() {
+  ::dsnet::Request* _msg = _internal_mutable_request();
+  // @@protoc_insertion_point(field_mutable:dsnet.transaction.granola.proto.RequestMessage.request)
+  return _msg;
+}
+inline void RequestMessage::set_allocated_request(::dsnet::Request* request) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete reinterpret_cast< ::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.request_);
+  }
+  if (request) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(
+                reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(request));
+    if (message_arena != submessage_arena) {
+      request = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, request, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.request_ = request;
+  // @@protoc_insertion_point(field_set_allocated:dsnet.transaction.granola.proto.RequestMessage.request)
+}
+
+// -------------------------------------------------------------------
+
+// PrepareMessage
+
+// required uint64 view = 1;
+inline bool PrepareMessage::_internal_has_view() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool PrepareMessage::has_view() const {
+  return _internal_has_view();
+}
+inline void PrepareMessage::clear_view() {
+  _impl_.view_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline uint64_t PrepareMessage::_internal_view() const {
+  return _impl_.view_;
+}
+inline uint64_t PrepareMessage::view() const {
+  // @@protoc_insertion_point(field_get:dsnet.transaction.granola.proto.PrepareMessage.view)
+  return _internal_view();
+}
+inline void PrepareMessage::_internal_set_view(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.view_ = value;
+}
+inline void PrepareMessage::set_view(uint64_t value) {
+  _internal_set_view(value);
+  // @@protoc_insertion_point(field_set:dsnet.transaction.granola.proto.PrepareMessage.view)
+}
+
+// required uint64 opnum = 2;
+inline bool PrepareMessage::_internal_has_opnum() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool PrepareMessage::has_opnum() const {
+  return _internal_has_opnum();
+}
+inline void PrepareMessage::clear_opnum() {
+  _impl_.opnum_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline uint64_t PrepareMessage::_internal_opnum() const {
+  return _impl_.opnum_;
+}
+inline uint64_t PrepareMessage::opnum() const {
+  // @@protoc_insertion_point(field_get:dsnet.transaction.granola.proto.PrepareMessage.opnum)
+  return _internal_opnum();
+}
+inline void PrepareMessage::_internal_set_opnum(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.opnum_ = value;
+}
+inline void PrepareMessage::set_opnum(uint64_t value) {
+  _internal_set_opnum(value);
+  // @@protoc_insertion_point(field_set:dsnet.transaction.granola.proto.PrepareMessage.opnum)
+}
+
+// required uint64 txnid = 3;
+inline bool PrepareMessage::_internal_has_txnid() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  return value;
+}
+inline bool PrepareMessage::has_txnid() const {
+  return _internal_has_txnid();
+}
+inline void PrepareMessage::clear_txnid() {
+  _impl_.txnid_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000008u;
+}
+inline uint64_t PrepareMessage::_internal_txnid() const {
+  return _impl_.txnid_;
+}
+inline uint64_t PrepareMessage::txnid() const {
+  // @@protoc_insertion_point(field_get:dsnet.transaction.granola.proto.PrepareMessage.txnid)
+  return _internal_txnid();
+}
+inline void PrepareMessage::_internal_set_txnid(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  _impl_.txnid_ = value;
+}
+inline void PrepareMessage::set_txnid(uint64_t value) {
+  _internal_set_txnid(value);
+  // @@protoc_insertion_point(field_set:dsnet.transaction.granola.proto.PrepareMessage.txnid)
+}
+
+// required bool indep = 4;
+inline bool PrepareMessage::_internal_has_indep() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000020u) != 0;
+  return value;
+}
+inline bool PrepareMessage::has_indep() const {
+  return _internal_has_indep();
+}
+inline void PrepareMessage::clear_indep() {
+  _impl_.indep_ = false;
+  _impl_._has_bits_[0] &= ~0x00000020u;
+}
+inline bool PrepareMessage::_internal_indep() const {
+  return _impl_.indep_;
+}
+inline bool PrepareMessage::indep() const {
+  // @@protoc_insertion_point(field_get:dsnet.transaction.granola.proto.PrepareMessage.indep)
+  return _internal_indep();
+}
+inline void PrepareMessage::_internal_set_indep(bool value) {
+  _impl_._has_bits_[0] |= 0x00000020u;
+  _impl_.indep_ = value;
+}
+inline void PrepareMessage::set_indep(bool value) {
+  _internal_set_indep(value);
+  // @@protoc_insertion_point(field_set:dsnet.transaction.granola.proto.PrepareMessage.indep)
+}
+
+// required bool ro = 5;
+inline bool PrepareMessage::_internal_has_ro() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000040u) != 0;
+  return value;
+}
+inline bool PrepareMessage::has_ro() const {
+  return _internal_has_ro();
+}
+inline void PrepareMessage::clear_ro() {
+  _impl_.ro_ = false;
+  _impl_._has_bits_[0] &= ~0x00000040u;
+}
+inline bool PrepareMessage::_internal_ro() const {
+  return _impl_.ro_;
+}
+inline bool PrepareMessage::ro() const {
+  // @@protoc_insertion_point(field_get:dsnet.transaction.granola.proto.PrepareMessage.ro)
+  return _internal_ro();
+}
+inline void PrepareMessage::_internal_set_ro(bool value) {
+  _impl_._has_bits_[0] |= 0x00000040u;
+  _impl_.ro_ = value;
+}
+inline void PrepareMessage::set_ro(bool value) {
+  _internal_set_ro(value);
+  // @@protoc_insertion_point(field_set:dsnet.transaction.granola.proto.PrepareMessage.ro)
+}
+
+// required .dsnet.Request request = 6;
+inline bool PrepareMessage::_internal_has_request() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.request_ != nullptr);
+  return value;
+}
+inline bool PrepareMessage::has_request() const {
+  return _internal_has_request();
+}
+inline const ::dsnet::Request& PrepareMessage::_internal_request() const {
+  const ::dsnet::Request* p = _impl_.request_;
+  return p != nullptr ? *p : reinterpret_cast<const ::dsnet::Request&>(
+      ::dsnet::_Request_default_instance_);
+}
+inline const ::dsnet::Request& PrepareMessage::request() const {
+  // @@protoc_insertion_point(field_get:dsnet.transaction.granola.proto.PrepareMessage.request)
+  return _internal_request();
+}
+inline void PrepareMessage::unsafe_arena_set_allocated_request(
+    ::dsnet::Request* request) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.request_);
+  }
+  _impl_.request_ = request;
+  if (request) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:dsnet.transaction.granola.proto.PrepareMessage.request)
+}
+inline ::dsnet::Request* PrepareMessage::release_request() {
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::dsnet::Request* temp = _impl_.request_;
+  _impl_.request_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::dsnet::Request* PrepareMessage::unsafe_arena_release_request() {
+  // @@protoc_insertion_point(field_release:dsnet.transaction.granola.proto.PrepareMessage.request)
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::dsnet::Request* temp = _impl_.request_;
+  _impl_.request_ = nullptr;
+  return temp;
+}
+inline ::dsnet::Request* PrepareMessage::_internal_mutable_request() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  if (_impl_.request_ == nullptr) {
+    auto* p = CreateMaybeMessage<::dsnet::Request>(GetArenaForAllocation());
+    _impl_.request_ = p;
+  }
+  return _impl_.request_;
+}
+inline ::dsnet::Request* PrepareMessage::mutable_request() {
+  ::dsnet::Request* _msg = _internal_mutable_request();
+  // @@protoc_insertion_point(field_mutable:dsnet.transaction.granola.proto.PrepareMessage.request)
+  return _msg;
+}
+inline void PrepareMessage::set_allocated_request(::dsnet::Request* request) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete reinterpret_cast< ::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.request_);
+  }
+  if (request) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(
+                reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(request));
+    if (message_arena != submessage_arena) {
+      request = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, request, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.request_ = request;
+  // @@protoc_insertion_point(field_set_allocated:dsnet.transaction.granola.proto.PrepareMessage.request)
+}
+
+// required uint64 timestamp = 7;
+inline bool PrepareMessage::_internal_has_timestamp() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000010u) != 0;
+  return value;
+}
+inline bool PrepareMessage::has_timestamp() const {
+  return _internal_has_timestamp();
+}
+inline void PrepareMessage::clear_timestamp() {
+  _impl_.timestamp_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000010u;
+}
+inline uint64_t PrepareMessage::_internal_timestamp() const {
+  return _impl_.timestamp_;
+}
+inline uint64_t PrepareMessage::timestamp() const {
+  // @@protoc_insertion_point(field_get:dsnet.transaction.granola.proto.PrepareMessage.timestamp)
+  return _internal_timestamp();
+}
+inline void PrepareMessage::_internal_set_timestamp(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000010u;
+  _impl_.timestamp_ = value;
+}
+inline void PrepareMessage::set_timestamp(uint64_t value) {
+  _internal_set_timestamp(value);
+  // @@protoc_insertion_point(field_set:dsnet.transaction.granola.proto.PrepareMessage.timestamp)
+}
+
+// -------------------------------------------------------------------
+
+// PrepareOKMessage
+
+// required uint64 view = 1;
+inline bool PrepareOKMessage::_internal_has_view() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool PrepareOKMessage::has_view() const {
+  return _internal_has_view();
+}
+inline void PrepareOKMessage::clear_view() {
+  _impl_.view_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline uint64_t PrepareOKMessage::_internal_view() const {
+  return _impl_.view_;
+}
+inline uint64_t PrepareOKMessage::view() const {
+  // @@protoc_insertion_point(field_get:dsnet.transaction.granola.proto.PrepareOKMessage.view)
+  return _internal_view();
+}
+inline void PrepareOKMessage::_internal_set_view(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.view_ = value;
+}
+inline void PrepareOKMessage::set_view(uint64_t value) {
+  _internal_set_view(value);
+  // @@protoc_insertion_point(field_set:dsnet.transaction.granola.proto.PrepareOKMessage.view)
+}
+
+// required uint64 opnum = 2;
+inline bool PrepareOKMessage::_internal_has_opnum() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool PrepareOKMessage::has_opnum() const {
+  return _internal_has_opnum();
+}
+inline void PrepareOKMessage::clear_opnum() {
+  _impl_.opnum_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline uint64_t PrepareOKMessage::_internal_opnum() const {
+  return _impl_.opnum_;
+}
+inline uint64_t PrepareOKMessage::opnum() const {
+  // @@protoc_insertion_point(field_get:dsnet.transaction.granola.proto.PrepareOKMessage.opnum)
+  return _internal_opnum();
+}
+inline void PrepareOKMessage::_internal_set_opnum(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.opnum_ = value;
+}
+inline void PrepareOKMessage::set_opnum(uint64_t value) {
+  _internal_set_opnum(value);
+  // @@protoc_insertion_point(field_set:dsnet.transaction.granola.proto.PrepareOKMessage.opnum)
+}
+
+// required uint32 replica_num = 3;
+inline bool PrepareOKMessage::_internal_has_replica_num() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool PrepareOKMessage::has_replica_num() const {
+  return _internal_has_replica_num();
+}
+inline void PrepareOKMessage::clear_replica_num() {
+  _impl_.replica_num_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline uint32_t PrepareOKMessage::_internal_replica_num() const {
+  return _impl_.replica_num_;
+}
+inline uint32_t PrepareOKMessage::replica_num() const {
+  // @@protoc_insertion_point(field_get:dsnet.transaction.granola.proto.PrepareOKMessage.replica_num)
+  return _internal_replica_num();
+}
+inline void PrepareOKMessage::_internal_set_replica_num(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.replica_num_ = value;
+}
+inline void PrepareOKMessage::set_replica_num(uint32_t value) {
+  _internal_set_replica_num(value);
+  // @@protoc_insertion_point(field_set:dsnet.transaction.granola.proto.PrepareOKMessage.replica_num)
+}
+
+// -------------------------------------------------------------------
+
+// CommitMessage
+
+// required uint64 view = 1;
+inline bool CommitMessage::_internal_has_view() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool CommitMessage::has_view() const {
+  return _internal_has_view();
+}
+inline void CommitMessage::clear_view() {
+  _impl_.view_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline uint64_t CommitMessage::_internal_view() const {
+  return _impl_.view_;
+}
+inline uint64_t CommitMessage::view() const {
+  // @@protoc_insertion_point(field_get:dsnet.transaction.granola.proto.CommitMessage.view)
+  return _internal_view();
+}
+inline void CommitMessage::_internal_set_view(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.view_ = value;
+}
+inline void CommitMessage::set_view(uint64_t value) {
+  _internal_set_view(value);
+  // @@protoc_insertion_point(field_set:dsnet.transaction.granola.proto.CommitMessage.view)
+}
+
+// required uint64 opnum = 2;
+inline bool CommitMessage::_internal_has_opnum() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool CommitMessage::has_opnum() const {
+  return _internal_has_opnum();
+}
+inline void CommitMessage::clear_opnum() {
+  _impl_.opnum_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline uint64_t CommitMessage::_internal_opnum() const {
+  return _impl_.opnum_;
+}
+inline uint64_t CommitMessage::opnum() const {
+  // @@protoc_insertion_point(field_get:dsnet.transaction.granola.proto.CommitMessage.opnum)
+  return _internal_opnum();
+}
+inline void CommitMessage::_internal_set_opnum(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.opnum_ = value;
+}
+inline void CommitMessage::set_opnum(uint64_t value) {
+  _internal_set_opnum(value);
+  // @@protoc_insertion_point(field_set:dsnet.transaction.granola.proto.CommitMessage.opnum)
+}
+
+// -------------------------------------------------------------------
+
+// VoteMessage
+
+// required uint64 clientid = 1;
+inline bool VoteMessage::_internal_has_clientid() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool VoteMessage::has_clientid() const {
+  return _internal_has_clientid();
+}
+inline void VoteMessage::clear_clientid() {
+  _impl_.clientid_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline uint64_t VoteMessage::_internal_clientid() const {
+  return _impl_.clientid_;
+}
+inline uint64_t VoteMessage::clientid() const {
+  // @@protoc_insertion_point(field_get:dsnet.transaction.granola.proto.VoteMessage.clientid)
+  return _internal_clientid();
+}
+inline void VoteMessage::_internal_set_clientid(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.clientid_ = value;
+}
+inline void VoteMessage::set_clientid(uint64_t value) {
+  _internal_set_clientid(value);
+  // @@protoc_insertion_point(field_set:dsnet.transaction.granola.proto.VoteMessage.clientid)
+}
+
+// required uint64 clientreqid = 2;
+inline bool VoteMessage::_internal_has_clientreqid() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool VoteMessage::has_clientreqid() const {
+  return _internal_has_clientreqid();
+}
+inline void VoteMessage::clear_clientreqid() {
+  _impl_.clientreqid_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline uint64_t VoteMessage::_internal_clientreqid() const {
+  return _impl_.clientreqid_;
+}
+inline uint64_t VoteMessage::clientreqid() const {
+  // @@protoc_insertion_point(field_get:dsnet.transaction.granola.proto.VoteMessage.clientreqid)
+  return _internal_clientreqid();
+}
+inline void VoteMessage::_internal_set_clientreqid(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.clientreqid_ = value;
+}
+inline void VoteMessage::set_clientreqid(uint64_t value) {
+  _internal_set_clientreqid(value);
+  // @@protoc_insertion_point(field_set:dsnet.transaction.granola.proto.VoteMessage.clientreqid)
+}
+
+// required uint32 shard_num = 3;
+inline bool VoteMessage::_internal_has_shard_num() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool VoteMessage::has_shard_num() const {
+  return _internal_has_shard_num();
+}
+inline void VoteMessage::clear_shard_num() {
+  _impl_.shard_num_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline uint32_t VoteMessage::_internal_shard_num() const {
+  return _impl_.shard_num_;
+}
+inline uint32_t VoteMessage::shard_num() const {
+  // @@protoc_insertion_point(field_get:dsnet.transaction.granola.proto.VoteMessage.shard_num)
+  return _internal_shard_num();
+}
+inline void VoteMessage::_internal_set_shard_num(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.shard_num_ = value;
+}
+inline void VoteMessage::set_shard_num(uint32_t value) {
+  _internal_set_shard_num(value);
+  // @@protoc_insertion_point(field_set:dsnet.transaction.granola.proto.VoteMessage.shard_num)
+}
+
+// required uint32 nshards = 4;
+inline bool VoteMessage::_internal_has_nshards() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  return value;
+}
+inline bool VoteMessage::has_nshards() const {
+  return _internal_has_nshards();
+}
+inline void VoteMessage::clear_nshards() {
+  _impl_.nshards_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000008u;
+}
+inline uint32_t VoteMessage::_internal_nshards() const {
+  return _impl_.nshards_;
+}
+inline uint32_t VoteMessage::nshards() const {
+  // @@protoc_insertion_point(field_get:dsnet.transaction.granola.proto.VoteMessage.nshards)
+  return _internal_nshards();
+}
+inline void VoteMessage::_internal_set_nshards(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  _impl_.nshards_ = value;
+}
+inline void VoteMessage::set_nshards(uint32_t value) {
+  _internal_set_nshards(value);
+  // @@protoc_insertion_point(field_set:dsnet.transaction.granola.proto.VoteMessage.nshards)
+}
+
+// required .dsnet.transaction.granola.proto.Status status = 5;
+inline bool VoteMessage::_internal_has_status() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000010u) != 0;
+  return value;
+}
+inline bool VoteMessage::has_status() const {
+  return _internal_has_status();
+}
+inline void VoteMessage::clear_status() {
+  _impl_.status_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000010u;
+}
+inline ::dsnet::transaction::granola::proto::Status VoteMessage::_internal_status() const {
+  return static_cast< ::dsnet::transaction::granola::proto::Status >(_impl_.status_);
+}
+inline ::dsnet::transaction::granola::proto::Status VoteMessage::status() const {
+  // @@protoc_insertion_point(field_get:dsnet.transaction.granola.proto.VoteMessage.status)
+  return _internal_status();
+}
+inline void VoteMessage::_internal_set_status(::dsnet::transaction::granola::proto::Status value) {
+  assert(::dsnet::transaction::granola::proto::Status_IsValid(value));
+  _impl_._has_bits_[0] |= 0x00000010u;
+  _impl_.status_ = value;
+}
+inline void VoteMessage::set_status(::dsnet::transaction::granola::proto::Status value) {
+  _internal_set_status(value);
+  // @@protoc_insertion_point(field_set:dsnet.transaction.granola.proto.VoteMessage.status)
+}
+
+// -------------------------------------------------------------------
+
+// VoteRequestMessage
+
+// required uint64 clientid = 1;
+inline bool VoteRequestMessage::_internal_has_clientid() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool VoteRequestMessage::has_clientid() const {
+  return _internal_has_clientid();
+}
+inline void VoteRequestMessage::clear_clientid() {
+  _impl_.clientid_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline uint64_t VoteRequestMessage::_internal_clientid() const {
+  return _impl_.clientid_;
+}
+inline uint64_t VoteRequestMessage::clientid() const {
+  // @@protoc_insertion_point(field_get:dsnet.transaction.granola.proto.VoteRequestMessage.clientid)
+  return _internal_clientid();
+}
+inline void VoteRequestMessage::_internal_set_clientid(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.clientid_ = value;
+}
+inline void VoteRequestMessage::set_clientid(uint64_t value) {
+  _internal_set_clientid(value);
+  // @@protoc_insertion_point(field_set:dsnet.transaction.granola.proto.VoteRequestMessage.clientid)
+}
+
+// required uint64 clientreqid = 2;
+inline bool VoteRequestMessage::_internal_has_clientreqid() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool VoteRequestMessage::has_clientreqid() const {
+  return _internal_has_clientreqid();
+}
+inline void VoteRequestMessage::clear_clientreqid() {
+  _impl_.clientreqid_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline uint64_t VoteRequestMessage::_internal_clientreqid() const {
+  return _impl_.clientreqid_;
+}
+inline uint64_t VoteRequestMessage::clientreqid() const {
+  // @@protoc_insertion_point(field_get:dsnet.transaction.granola.proto.VoteRequestMessage.clientreqid)
+  return _internal_clientreqid();
+}
+inline void VoteRequestMessage::_internal_set_clientreqid(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.clientreqid_ = value;
+}
+inline void VoteRequestMessage::set_clientreqid(uint64_t value) {
+  _internal_set_clientreqid(value);
+  // @@protoc_insertion_point(field_set:dsnet.transaction.granola.proto.VoteRequestMessage.clientreqid)
+}
+
+// -------------------------------------------------------------------
+
+// FinalTimestampMessage
+
+// required uint64 view = 1;
+inline bool FinalTimestampMessage::_internal_has_view() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool FinalTimestampMessage::has_view() const {
+  return _internal_has_view();
+}
+inline void FinalTimestampMessage::clear_view() {
+  _impl_.view_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline uint64_t FinalTimestampMessage::_internal_view() const {
+  return _impl_.view_;
+}
+inline uint64_t FinalTimestampMessage::view() const {
+  // @@protoc_insertion_point(field_get:dsnet.transaction.granola.proto.FinalTimestampMessage.view)
+  return _internal_view();
+}
+inline void FinalTimestampMessage::_internal_set_view(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.view_ = value;
+}
+inline void FinalTimestampMessage::set_view(uint64_t value) {
+  _internal_set_view(value);
+  // @@protoc_insertion_point(field_set:dsnet.transaction.granola.proto.FinalTimestampMessage.view)
+}
+
+// required uint64 opnum = 2;
+inline bool FinalTimestampMessage::_internal_has_opnum() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool FinalTimestampMessage::has_opnum() const {
+  return _internal_has_opnum();
+}
+inline void FinalTimestampMessage::clear_opnum() {
+  _impl_.opnum_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline uint64_t FinalTimestampMessage::_internal_opnum() const {
+  return _impl_.opnum_;
+}
+inline uint64_t FinalTimestampMessage::opnum() const {
+  // @@protoc_insertion_point(field_get:dsnet.transaction.granola.proto.FinalTimestampMessage.opnum)
+  return _internal_opnum();
+}
+inline void FinalTimestampMessage::_internal_set_opnum(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.opnum_ = value;
+}
+inline void FinalTimestampMessage::set_opnum(uint64_t value) {
+  _internal_set_opnum(value);
+  // @@protoc_insertion_point(field_set:dsnet.transaction.granola.proto.FinalTimestampMessage.opnum)
+}
+
+// required uint64 timestamp = 3;
+inline bool FinalTimestampMessage::_internal_has_timestamp() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool FinalTimestampMessage::has_timestamp() const {
+  return _internal_has_timestamp();
+}
+inline void FinalTimestampMessage::clear_timestamp() {
+  _impl_.timestamp_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline uint64_t FinalTimestampMessage::_internal_timestamp() const {
+  return _impl_.timestamp_;
+}
+inline uint64_t FinalTimestampMessage::timestamp() const {
+  // @@protoc_insertion_point(field_get:dsnet.transaction.granola.proto.FinalTimestampMessage.timestamp)
+  return _internal_timestamp();
+}
+inline void FinalTimestampMessage::_internal_set_timestamp(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.timestamp_ = value;
+}
+inline void FinalTimestampMessage::set_timestamp(uint64_t value) {
+  _internal_set_timestamp(value);
+  // @@protoc_insertion_point(field_set:dsnet.transaction.granola.proto.FinalTimestampMessage.timestamp)
+}
+
+// required .dsnet.transaction.granola.proto.Status status = 4;
+inline bool FinalTimestampMessage::_internal_has_status() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  return value;
+}
+inline bool FinalTimestampMessage::has_status() const {
+  return _internal_has_status();
+}
+inline void FinalTimestampMessage::clear_status() {
+  _impl_.status_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000008u;
+}
+inline ::dsnet::transaction::granola::proto::Status FinalTimestampMessage::_internal_status() const {
+  return static_cast< ::dsnet::transaction::granola::proto::Status >(_impl_.status_);
+}
+inline ::dsnet::transaction::granola::proto::Status FinalTimestampMessage::status() const {
+  // @@protoc_insertion_point(field_get:dsnet.transaction.granola.proto.FinalTimestampMessage.status)
+  return _internal_status();
+}
+inline void FinalTimestampMessage::_internal_set_status(::dsnet::transaction::granola::proto::Status value) {
+  assert(::dsnet::transaction::granola::proto::Status_IsValid(value));
+  _impl_._has_bits_[0] |= 0x00000008u;
+  _impl_.status_ = value;
+}
+inline void FinalTimestampMessage::set_status(::dsnet::transaction::granola::proto::Status value) {
+  _internal_set_status(value);
+  // @@protoc_insertion_point(field_set:dsnet.transaction.granola.proto.FinalTimestampMessage.status)
+}
+
+// -------------------------------------------------------------------
+
+// ToServerMessage
+
+// .dsnet.transaction.granola.proto.RequestMessage request = 1;
+inline bool ToServerMessage::_internal_has_request() const {
+  return msg_case() == kRequest;
+}
+inline bool ToServerMessage::has_request() const {
+  return _internal_has_request();
+}
+inline void ToServerMessage::set_has_request() {
+  _impl_._oneof_case_[0] = kRequest;
+}
+inline void ToServerMessage::clear_request() {
+  if (_internal_has_request()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.msg_.request_;
+    }
+    clear_has_msg();
+  }
+}
+inline ::dsnet::transaction::granola::proto::RequestMessage* ToServerMessage::release_request() {
+  // @@protoc_insertion_point(field_release:dsnet.transaction.granola.proto.ToServerMessage.request)
+  if (_internal_has_request()) {
+    clear_has_msg();
+    ::dsnet::transaction::granola::proto::RequestMessage* temp = _impl_.msg_.request_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.msg_.request_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::dsnet::transaction::granola::proto::RequestMessage& ToServerMessage::_internal_request() const {
+  return _internal_has_request()
+      ? *_impl_.msg_.request_
+      : reinterpret_cast< ::dsnet::transaction::granola::proto::RequestMessage&>(::dsnet::transaction::granola::proto::_RequestMessage_default_instance_);
+}
+inline const ::dsnet::transaction::granola::proto::RequestMessage& ToServerMessage::request() const {
+  // @@protoc_insertion_point(field_get:dsnet.transaction.granola.proto.ToServerMessage.request)
+  return _internal_request();
+}
+inline ::dsnet::transaction::granola::proto::RequestMessage* ToServerMessage::unsafe_arena_release_request() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:dsnet.transaction.granola.proto.ToServerMessage.request)
+  if (_internal_has_request()) {
+    clear_has_msg();
+    ::dsnet::transaction::granola::proto::RequestMessage* temp = _impl_.msg_.request_;
+    _impl_.msg_.request_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void ToServerMessage::unsafe_arena_set_allocated_request(::dsnet::transaction::granola::proto::RequestMessage* request) {
+  clear_msg();
+  if (request) {
+    set_has_request();
+    _impl_.msg_.request_ = request;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:dsnet.transaction.granola.proto.ToServerMessage.request)
+}
+inline ::dsnet::transaction::granola::proto::RequestMessage* ToServerMessage::_internal_mutable_request() {
+  if (!_internal_has_request()) {
+    clear_msg();
+    set_has_request();
+    _impl_.msg_.request_ = CreateMaybeMessage< ::dsnet::transaction::granola::proto::RequestMessage >(GetArenaForAllocation());
+  }
+  return _impl_.msg_.request_;
+}
+inline ::dsnet::transaction::granola::proto::RequestMessage* ToServerMessage::mutable_request() {
+  ::dsnet::transaction::granola::proto::RequestMessage* _msg = _internal_mutable_request();
+  // @@protoc_insertion_point(field_mutable:dsnet.transaction.granola.proto.ToServerMessage.request)
+  return _msg;
+}
+
+// .dsnet.transaction.granola.proto.PrepareMessage prepare = 2;
+inline bool ToServerMessage::_internal_has_prepare() const {
+  return msg_case() == kPrepare;
+}
+inline bool ToServerMessage::has_prepare() const {
+  return _internal_has_prepare();
+}
+inline void ToServerMessage::set_has_prepare() {
+  _impl_._oneof_case_[0] = kPrepare;
+}
+inline void ToServerMessage::clear_prepare() {
+  if (_internal_has_prepare()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.msg_.prepare_;
+    }
+    clear_has_msg();
+  }
+}
+inline ::dsnet::transaction::granola::proto::PrepareMessage* ToServerMessage::release_prepare() {
+  // @@protoc_insertion_point(field_release:dsnet.transaction.granola.proto.ToServerMessage.prepare)
+  if (_internal_has_prepare()) {
+    clear_has_msg();
+    ::dsnet::transaction::granola::proto::PrepareMessage* temp = _impl_.msg_.prepare_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.msg_.prepare_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::dsnet::transaction::granola::proto::PrepareMessage& ToServerMessage::_internal_prepare() const {
+  return _internal_has_prepare()
+      ? *_impl_.msg_.prepare_
+      : reinterpret_cast< ::dsnet::transaction::granola::proto::PrepareMessage&>(::dsnet::transaction::granola::proto::_PrepareMessage_default_instance_);
+}
+inline const ::dsnet::transaction::granola::proto::PrepareMessage& ToServerMessage::prepare() const {
+  // @@protoc_insertion_point(field_get:dsnet.transaction.granola.proto.ToServerMessage.prepare)
+  return _internal_prepare();
+}
+inline ::dsnet::transaction::granola::proto::PrepareMessage* ToServerMessage::unsafe_arena_release_prepare() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:dsnet.transaction.granola.proto.ToServerMessage.prepare)
+  if (_internal_has_prepare()) {
+    clear_has_msg();
+    ::dsnet::transaction::granola::proto::PrepareMessage* temp = _impl_.msg_.prepare_;
+    _impl_.msg_.prepare_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void ToServerMessage::unsafe_arena_set_allocated_prepare(::dsnet::transaction::granola::proto::PrepareMessage* prepare) {
+  clear_msg();
+  if (prepare) {
+    set_has_prepare();
+    _impl_.msg_.prepare_ = prepare;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:dsnet.transaction.granola.proto.ToServerMessage.prepare)
+}
+inline ::dsnet::transaction::granola::proto::PrepareMessage* ToServerMessage::_internal_mutable_prepare() {
+  if (!_internal_has_prepare()) {
+    clear_msg();
+    set_has_prepare();
+    _impl_.msg_.prepare_ = CreateMaybeMessage< ::dsnet::transaction::granola::proto::PrepareMessage >(GetArenaForAllocation());
+  }
+  return _impl_.msg_.prepare_;
+}
+inline ::dsnet::transaction::granola::proto::PrepareMessage* ToServerMessage::mutable_prepare() {
+  ::dsnet::transaction::granola::proto::PrepareMessage* _msg = _internal_mutable_prepare();
+  // @@protoc_insertion_point(field_mutable:dsnet.transaction.granola.proto.ToServerMessage.prepare)
+  return _msg;
+}
+
+// .dsnet.transaction.granola.proto.PrepareOKMessage prepare_ok = 3;
+inline bool ToServerMessage::_internal_has_prepare_ok() const {
+  return msg_case() == kPrepareOk;
+}
+inline bool ToServerMessage::has_prepare_ok() const {
+  return _internal_has_prepare_ok();
+}
+inline void ToServerMessage::set_has_prepare_ok() {
+  _impl_._oneof_case_[0] = kPrepareOk;
+}
+inline void ToServerMessage::clear_prepare_ok() {
+  if (_internal_has_prepare_ok()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.msg_.prepare_ok_;
+    }
+    clear_has_msg();
+  }
+}
+inline ::dsnet::transaction::granola::proto::PrepareOKMessage* ToServerMessage::release_prepare_ok() {
+  // @@protoc_insertion_point(field_release:dsnet.transaction.granola.proto.ToServerMessage.prepare_ok)
+  if (_internal_has_prepare_ok()) {
+    clear_has_msg();
+    ::dsnet::transaction::granola::proto::PrepareOKMessage* temp = _impl_.msg_.prepare_ok_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.msg_.prepare_ok_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::dsnet::transaction::granola::proto::PrepareOKMessage& ToServerMessage::_internal_prepare_ok() const {
+  return _internal_has_prepare_ok()
+      ? *_impl_.msg_.prepare_ok_
+      : reinterpret_cast< ::dsnet::transaction::granola::proto::PrepareOKMessage&>(::dsnet::transaction::granola::proto::_PrepareOKMessage_default_instance_);
+}
+inline const ::dsnet::transaction::granola::proto::PrepareOKMessage& ToServerMessage::prepare_ok() const {
+  // @@protoc_insertion_point(field_get:dsnet.transaction.granola.proto.ToServerMessage.prepare_ok)
+  return _internal_prepare_ok();
+}
+inline ::dsnet::transaction::granola::proto::PrepareOKMessage* ToServerMessage::unsafe_arena_release_prepare_ok() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:dsnet.transaction.granola.proto.ToServerMessage.prepare_ok)
+  if (_internal_has_prepare_ok()) {
+    clear_has_msg();
+    ::dsnet::transaction::granola::proto::PrepareOKMessage* temp = _impl_.msg_.prepare_ok_;
+    _impl_.msg_.prepare_ok_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void ToServerMessage::unsafe_arena_set_allocated_prepare_ok(::dsnet::transaction::granola::proto::PrepareOKMessage* prepare_ok) {
+  clear_msg();
+  if (prepare_ok) {
+    set_has_prepare_ok();
+    _impl_.msg_.prepare_ok_ = prepare_ok;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:dsnet.transaction.granola.proto.ToServerMessage.prepare_ok)
+}
+inline ::dsnet::transaction::granola::proto::PrepareOKMessage* ToServerMessage::_internal_mutable_prepare_ok() {
+  if (!_internal_has_prepare_ok()) {
+    clear_msg();
+    set_has_prepare_ok();
+    _impl_.msg_.prepare_ok_ = CreateMaybeMessage< ::dsnet::transaction::granola::proto::PrepareOKMessage >(GetArenaForAllocation());
+  }
+  return _impl_.msg_.prepare_ok_;
+}
+inline ::dsnet::transaction::granola::proto::PrepareOKMessage* ToServerMessage::mutable_prepare_ok() {
+  ::dsnet::transaction::granola::proto::PrepareOKMessage* _msg = _internal_mutable_prepare_ok();
+  // @@protoc_insertion_point(field_mutable:dsnet.transaction.granola.proto.ToServerMessage.prepare_ok)
+  return _msg;
+}
+
+// .dsnet.transaction.granola.proto.CommitMessage commit = 4;
+inline bool ToServerMessage::_internal_has_commit() const {
+  return msg_case() == kCommit;
+}
+inline bool ToServerMessage::has_commit() const {
+  return _internal_has_commit();
+}
+inline void ToServerMessage::set_has_commit() {
+  _impl_._oneof_case_[0] = kCommit;
+}
+inline void ToServerMessage::clear_commit() {
+  if (_internal_has_commit()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.msg_.commit_;
+    }
+    clear_has_msg();
+  }
+}
+inline ::dsnet::transaction::granola::proto::CommitMessage* ToServerMessage::release_commit() {
+  // @@protoc_insertion_point(field_release:dsnet.transaction.granola.proto.ToServerMessage.commit)
+  if (_internal_has_commit()) {
+    clear_has_msg();
+    ::dsnet::transaction::granola::proto::CommitMessage* temp = _impl_.msg_.commit_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.msg_.commit_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::dsnet::transaction::granola::proto::CommitMessage& ToServerMessage::_internal_commit() const {
+  return _internal_has_commit()
+      ? *_impl_.msg_.commit_
+      : reinterpret_cast< ::dsnet::transaction::granola::proto::CommitMessage&>(::dsnet::transaction::granola::proto::_CommitMessage_default_instance_);
+}
+inline const ::dsnet::transaction::granola::proto::CommitMessage& ToServerMessage::commit() const {
+  // @@protoc_insertion_point(field_get:dsnet.transaction.granola.proto.ToServerMessage.commit)
+  return _internal_commit();
+}
+inline ::dsnet::transaction::granola::proto::CommitMessage* ToServerMessage::unsafe_arena_release_commit() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:dsnet.transaction.granola.proto.ToServerMessage.commit)
+  if (_internal_has_commit()) {
+    clear_has_msg();
+    ::dsnet::transaction::granola::proto::CommitMessage* temp = _impl_.msg_.commit_;
+    _impl_.msg_.commit_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void ToServerMessage::unsafe_arena_set_allocated_commit(::dsnet::transaction::granola::proto::CommitMessage* commit) {
+  clear_msg();
+  if (commit) {
+    set_has_commit();
+    _impl_.msg_.commit_ = commit;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:dsnet.transaction.granola.proto.ToServerMessage.commit)
+}
+inline ::dsnet::transaction::granola::proto::CommitMessage* ToServerMessage::_internal_mutable_commit() {
+  if (!_internal_has_commit()) {
+    clear_msg();
+    set_has_commit();
+    _impl_.msg_.commit_ = CreateMaybeMessage< ::dsnet::transaction::granola::proto::CommitMessage >(GetArenaForAllocation());
+  }
+  return _impl_.msg_.commit_;
+}
+inline ::dsnet::transaction::granola::proto::CommitMessage* ToServerMessage::mutable_commit() {
+  ::dsnet::transaction::granola::proto::CommitMessage* _msg = _internal_mutable_commit();
+  // @@protoc_insertion_point(field_mutable:dsnet.transaction.granola.proto.ToServerMessage.commit)
+  return _msg;
+}
+
+// .dsnet.transaction.granola.proto.VoteMessage vote = 5;
+inline bool ToServerMessage::_internal_has_vote() const {
+  return msg_case() == kVote;
+}
+inline bool ToServerMessage::has_vote() const {
+  return _internal_has_vote();
+}
+inline void ToServerMessage::set_has_vote() {
+  _impl_._oneof_case_[0] = kVote;
+}
+inline void ToServerMessage::clear_vote() {
+  if (_internal_has_vote()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.msg_.vote_;
+    }
+    clear_has_msg();
+  }
+}
+inline ::dsnet::transaction::granola::proto::VoteMessage* ToServerMessage::release_vote() {
+  // @@protoc_insertion_point(field_release:dsnet.transaction.granola.proto.ToServerMessage.vote)
+  if (_internal_has_vote()) {
+    clear_has_msg();
+    ::dsnet::transaction::granola::proto::VoteMessage* temp = _impl_.msg_.vote_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.msg_.vote_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::dsnet::transaction::granola::proto::VoteMessage& ToServerMessage::_internal_vote() const {
+  return _internal_has_vote()
+      ? *_impl_.msg_.vote_
+      : reinterpret_cast< ::dsnet::transaction::granola::proto::VoteMessage&>(::dsnet::transaction::granola::proto::_VoteMessage_default_instance_);
+}
+inline const ::dsnet::transaction::granola::proto::VoteMessage& ToServerMessage::vote() const {
+  // @@protoc_insertion_point(field_get:dsnet.transaction.granola.proto.ToServerMessage.vote)
+  return _internal_vote();
+}
+inline ::dsnet::transaction::granola::proto::VoteMessage* ToServerMessage::unsafe_arena_release_vote() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:dsnet.transaction.granola.proto.ToServerMessage.vote)
+  if (_internal_has_vote()) {
+    clear_has_msg();
+    ::dsnet::transaction::granola::proto::VoteMessage* temp = _impl_.msg_.vote_;
+    _impl_.msg_.vote_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void ToServerMessage::unsafe_arena_set_allocated_vote(::dsnet::transaction::granola::proto::VoteMessage* vote) {
+  clear_msg();
+  if (vote) {
+    set_has_vote();
+    _impl_.msg_.vote_ = vote;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:dsnet.transaction.granola.proto.ToServerMessage.vote)
+}
+inline ::dsnet::transaction::granola::proto::VoteMessage* ToServerMessage::_internal_mutable_vote() {
+  if (!_internal_has_vote()) {
+    clear_msg();
+    set_has_vote();
+    _impl_.msg_.vote_ = CreateMaybeMessage< ::dsnet::transaction::granola::proto::VoteMessage >(GetArenaForAllocation());
+  }
+  return _impl_.msg_.vote_;
+}
+inline ::dsnet::transaction::granola::proto::VoteMessage* ToServerMessage::mutable_vote() {
+  ::dsnet::transaction::granola::proto::VoteMessage* _msg = _internal_mutable_vote();
+  // @@protoc_insertion_point(field_mutable:dsnet.transaction.granola.proto.ToServerMessage.vote)
+  return _msg;
+}
+
+// .dsnet.transaction.granola.proto.VoteRequestMessage vote_request = 6;
+inline bool ToServerMessage::_internal_has_vote_request() const {
+  return msg_case() == kVoteRequest;
+}
+inline bool ToServerMessage::has_vote_request() const {
+  return _internal_has_vote_request();
+}
+inline void ToServerMessage::set_has_vote_request() {
+  _impl_._oneof_case_[0] = kVoteRequest;
+}
+inline void ToServerMessage::clear_vote_request() {
+  if (_internal_has_vote_request()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.msg_.vote_request_;
+    }
+    clear_has_msg();
+  }
+}
+inline ::dsnet::transaction::granola::proto::VoteRequestMessage* ToServerMessage::release_vote_request() {
+  // @@protoc_insertion_point(field_release:dsnet.transaction.granola.proto.ToServerMessage.vote_request)
+  if (_internal_has_vote_request()) {
+    clear_has_msg();
+    ::dsnet::transaction::granola::proto::VoteRequestMessage* temp = _impl_.msg_.vote_request_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.msg_.vote_request_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::dsnet::transaction::granola::proto::VoteRequestMessage& ToServerMessage::_internal_vote_request() const {
+  return _internal_has_vote_request()
+      ? *_impl_.msg_.vote_request_
+      : reinterpret_cast< ::dsnet::transaction::granola::proto::VoteRequestMessage&>(::dsnet::transaction::granola::proto::_VoteRequestMessage_default_instance_);
+}
+inline const ::dsnet::transaction::granola::proto::VoteRequestMessage& ToServerMessage::vote_request() const {
+  // @@protoc_insertion_point(field_get:dsnet.transaction.granola.proto.ToServerMessage.vote_request)
+  return _internal_vote_request();
+}
+inline ::dsnet::transaction::granola::proto::VoteRequestMessage* ToServerMessage::unsafe_arena_release_vote_request() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:dsnet.transaction.granola.proto.ToServerMessage.vote_request)
+  if (_internal_has_vote_request()) {
+    clear_has_msg();
+    ::dsnet::transaction::granola::proto::VoteRequestMessage* temp = _impl_.msg_.vote_request_;
+    _impl_.msg_.vote_request_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void ToServerMessage::unsafe_arena_set_allocated_vote_request(::dsnet::transaction::granola::proto::VoteRequestMessage* vote_request) {
+  clear_msg();
+  if (vote_request) {
+    set_has_vote_request();
+    _impl_.msg_.vote_request_ = vote_request;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:dsnet.transaction.granola.proto.ToServerMessage.vote_request)
+}
+inline ::dsnet::transaction::granola::proto::VoteRequestMessage* ToServerMessage::_internal_mutable_vote_request() {
+  if (!_internal_has_vote_request()) {
+    clear_msg();
+    set_has_vote_request();
+    _impl_.msg_.vote_request_ = CreateMaybeMessage< ::dsnet::transaction::granola::proto::VoteRequestMessage >(GetArenaForAllocation());
+  }
+  return _impl_.msg_.vote_request_;
+}
+inline ::dsnet::transaction::granola::proto::VoteRequestMessage* ToServerMessage::mutable_vote_request() {
+  ::dsnet::transaction::granola::proto::VoteRequestMessage* _msg = _internal_mutable_vote_request();
+  // @@protoc_insertion_point(field_mutable:dsnet.transaction.granola.proto.ToServerMessage.vote_request)
+  return _msg;
+}
+
+// .dsnet.transaction.granola.proto.FinalTimestampMessage final_timestamp = 7;
+inline bool ToServerMessage::_internal_has_final_timestamp() const {
+  return msg_case() == kFinalTimestamp;
+}
+inline bool ToServerMessage::has_final_timestamp() const {
+  return _internal_has_final_timestamp();
+}
+inline void ToServerMessage::set_has_final_timestamp() {
+  _impl_._oneof_case_[0] = kFinalTimestamp;
+}
+inline void ToServerMessage::clear_final_timestamp() {
+  if (_internal_has_final_timestamp()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.msg_.final_timestamp_;
+    }
+    clear_has_msg();
+  }
+}
+inline ::dsnet::transaction::granola::proto::FinalTimestampMessage* ToServerMessage::release_final_timestamp() {
+  // @@protoc_insertion_point(field_release:dsnet.transaction.granola.proto.ToServerMessage.final_timestamp)
+  if (_internal_has_final_timestamp()) {
+    clear_has_msg();
+    ::dsnet::transaction::granola::proto::FinalTimestampMessage* temp = _impl_.msg_.final_timestamp_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.msg_.final_timestamp_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::dsnet::transaction::granola::proto::FinalTimestampMessage& ToServerMessage::_internal_final_timestamp() const {
+  return _internal_has_final_timestamp()
+      ? *_impl_.msg_.final_timestamp_
+      : reinterpret_cast< ::dsnet::transaction::granola::proto::FinalTimestampMessage&>(::dsnet::transaction::granola::proto::_FinalTimestampMessage_default_instance_);
+}
+inline const ::dsnet::transaction::granola::proto::FinalTimestampMessage& ToServerMessage::final_timestamp() const {
+  // @@protoc_insertion_point(field_get:dsnet.transaction.granola.proto.ToServerMessage.final_timestamp)
+  return _internal_final_timestamp();
+}
+inline ::dsnet::transaction::granola::proto::FinalTimestampMessage* ToServerMessage::unsafe_arena_release_final_timestamp() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:dsnet.transaction.granola.proto.ToServerMessage.final_timestamp)
+  if (_internal_has_final_timestamp()) {
+    clear_has_msg();
+    ::dsnet::transaction::granola::proto::FinalTimestampMessage* temp = _impl_.msg_.final_timestamp_;
+    _impl_.msg_.final_timestamp_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void ToServerMessage::unsafe_arena_set_allocated_final_timestamp(::dsnet::transaction::granola::proto::FinalTimestampMessage* final_timestamp) {
+  clear_msg();
+  if (final_timestamp) {
+    set_has_final_timestamp();
+    _impl_.msg_.final_timestamp_ = final_timestamp;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:dsnet.transaction.granola.proto.ToServerMessage.final_timestamp)
+}
+inline ::dsnet::transaction::granola::proto::FinalTimestampMessage* ToServerMessage::_internal_mutable_final_timestamp() {
+  if (!_internal_has_final_timestamp()) {
+    clear_msg();
+    set_has_final_timestamp();
+    _impl_.msg_.final_timestamp_ = CreateMaybeMessage< ::dsnet::transaction::granola::proto::FinalTimestampMessage >(GetArenaForAllocation());
+  }
+  return _impl_.msg_.final_timestamp_;
+}
+inline ::dsnet::transaction::granola::proto::FinalTimestampMessage* ToServerMessage::mutable_final_timestamp() {
+  ::dsnet::transaction::granola::proto::FinalTimestampMessage* _msg = _internal_mutable_final_timestamp();
+  // @@protoc_insertion_point(field_mutable:dsnet.transaction.granola.proto.ToServerMessage.final_timestamp)
+  return _msg;
+}
+
+inline bool ToServerMessage::has_msg() const {
+  return msg_case() != MSG_NOT_SET;
+}
+inline void ToServerMessage::clear_has_msg() {
+  _impl_._oneof_case_[0] = MSG_NOT_SET;
+}
+inline ToServerMessage::MsgCase ToServerMessage::msg_case() const {
+  return ToServerMessage::MsgCase(_impl_._oneof_case_[0]);
+}
+#ifdef __GNUC__
+  #pragma GCC diagnostic pop
+#endif  // __GNUC__
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+
+// @@protoc_insertion_point(namespace_scope)
+
+}  // namespace proto
+}  // namespace granola
+}  // namespace transaction
+}  // namespace dsnet
+
+PROTOBUF_NAMESPACE_OPEN
+
+template <> struct is_proto_enum< ::dsnet::transaction::granola::proto::Status> : ::std::true_type {};
+template <>
+inline const EnumDescriptor* GetEnumDescriptor< ::dsnet::transaction::granola::proto::Status>() {
+  return ::dsnet::transaction::granola::proto::Status_descriptor();
+}
+
+PROTOBUF_NAMESPACE_CLOSE
+
+// @@protoc_insertion_point(global_scope)
+
+#include <google/protobuf/port_undef.inc>
+#endif  // GOOGLE_PROTOBUF_INCLUDED_GOOGLE_PROTOBUF_INCLUDED_transaction_2fgranola_2fgranola_2dproto_2eproto
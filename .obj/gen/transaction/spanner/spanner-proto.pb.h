@@ -0,0 +1,2407 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: transaction/spanner/spanner-proto.proto
+
+#ifndef GOOGLE_PROTOBUF_INCLUDED_transaction_2fspanner_2fspanner_2dproto_2eproto
+#define GOOGLE_PROTOBUF_INCLUDED_transaction_2fspanner_2fspanner_2dproto_2eproto
+
+#include <limits>
+#include <string>
+
+#include <google/protobuf/port_def.inc>
+#if PROTOBUF_VERSION < 3021000
+#error This file was generated by a newer version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please update
+#error your headers.
+#endif
+#if 3021012 < PROTOBUF_MIN_PROTOC_VERSION
+#error This file was generated by an older version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please
+#error regenerate this file with a newer version of protoc.
+#endif
+
+#include <google/protobuf/port_undef.inc>
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/arena.h>
+#include <google/protobuf/arenastring.h>
+#include <google/protobuf/generated_message_util.h>
+#include <google/protobuf/metadata_lite.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/message.h>
+#include <google/protobuf/repeated_field.h>  // IWYU pragma: export
+#include <google/protobuf/extension_set.h>  // IWYU pragma: export
+#include <google/protobuf/generated_enum_reflection.h>
+#include <google/protobuf/unknown_field_set.h>
+#include "common/request.pb.h"
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+#define PROTOBUF_INTERNAL_EXPORT_transaction_2fspanner_2fspanner_2dproto_2eproto
+PROTOBUF_NAMESPACE_OPEN
+namespace internal {
+class AnyMetadata;
+}  // namespace internal
+PROTOBUF_NAMESPACE_CLOSE
+
+// Internal implementation detail -- do not use these members.
+struct TableStruct_transaction_2fspanner_2fspanner_2dproto_2eproto {
+  static const uint32_t offsets[];
+};
+extern const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_transaction_2fspanner_2fspanner_2dproto_2eproto;
+namespace dsnet {
+namespace transaction {
+namespace spanner {
+namespace proto {
+class CommitMessage;
+struct CommitMessageDefaultTypeInternal;
+extern CommitMessageDefaultTypeInternal _CommitMessage_default_instance_;
+class PrepareMessage;
+struct PrepareMessageDefaultTypeInternal;
+extern PrepareMessageDefaultTypeInternal _PrepareMessage_default_instance_;
+class PrepareOKMessage;
+struct PrepareOKMessageDefaultTypeInternal;
+extern PrepareOKMessageDefaultTypeInternal _PrepareOKMessage_default_instance_;
+class ReplyMessage;
+struct ReplyMessageDefaultTypeInternal;
+extern ReplyMessageDefaultTypeInternal _ReplyMessage_default_instance_;
+class RequestMessage;
+struct RequestMessageDefaultTypeInternal;
+extern RequestMessageDefaultTypeInternal _RequestMessage_default_instance_;
+class ToServerMessage;
+struct ToServerMessageDefaultTypeInternal;
+extern ToServerMessageDefaultTypeInternal _ToServerMessage_default_instance_;
+}  // namespace proto
+}  // namespace spanner
+}  // namespace transaction
+}  // namespace dsnet
+PROTOBUF_NAMESPACE_OPEN
+template<> ::dsnet::transaction::spanner::proto::CommitMessage* Arena::CreateMaybeMessage<::dsnet::transaction::spanner::proto::CommitMessage>(Arena*);
+template<> ::dsnet::transaction::spanner::proto::PrepareMessage* Arena::CreateMaybeMessage<::dsnet::transaction::spanner::proto::PrepareMessage>(Arena*);
+template<> ::dsnet::transaction::spanner::proto::PrepareOKMessage* Arena::CreateMaybeMessage<::dsnet::transaction::spanner::proto::PrepareOKMessage>(Arena*);
+template<> ::dsnet::transaction::spanner::proto::ReplyMessage* Arena::CreateMaybeMessage<::dsnet::transaction::spanner::proto::ReplyMessage>(Arena*);
+template<> ::dsnet::transaction::spanner::proto::RequestMessage* Arena::CreateMaybeMessage<::dsnet::transaction::spanner::proto::RequestMessage>(Arena*);
+template<> ::dsnet::transaction::spanner::proto::ToServerMessage* Arena::CreateMaybeMessage<::dsnet::transaction::spanner::proto::ToServerMessage>(Arena*);
+PROTOBUF_NAMESPACE_CLOSE
+namespace dsnet {
+namespace transaction {
+namespace spanner {
+namespace proto {
+
+enum ReplyType : int {
+  OK = 0,
+  FAIL = 1,
+  RETRY = 2,
+  ACK = 3
+};
+bool ReplyType_IsValid(int value);
+constexpr ReplyType ReplyType_MIN = OK;
+constexpr ReplyType ReplyType_MAX = ACK;
+constexpr int ReplyType_ARRAYSIZE = ReplyType_MAX + 1;
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* ReplyType_descriptor();
+template<typename T>
+inline const std::string& ReplyType_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, ReplyType>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function ReplyType_Name.");
+  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
+    ReplyType_descriptor(), enum_t_value);
+}
+inline bool ReplyType_Parse(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, ReplyType* value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<ReplyType>(
+    ReplyType_descriptor(), name, value);
+}
+enum RequestType : int {
+  UNKNOWN = 0,
+  PREPARE = 1,
+  COMMIT = 2,
+  ABORT = 3
+};
+bool RequestType_IsValid(int value);
+constexpr RequestType RequestType_MIN = UNKNOWN;
+constexpr RequestType RequestType_MAX = ABORT;
+constexpr int RequestType_ARRAYSIZE = RequestType_MAX + 1;
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* RequestType_descriptor();
+template<typename T>
+inline const std::string& RequestType_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, RequestType>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function RequestType_Name.");
+  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
+    RequestType_descriptor(), enum_t_value);
+}
+inline bool RequestType_Parse(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, RequestType* value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<RequestType>(
+    RequestType_descriptor(), name, value);
+}
+// ===================================================================
+
+class ReplyMessage final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:dsnet.transaction.spanner.proto.ReplyMessage) */ {
+ public:
+  inline ReplyMessage() : ReplyMessage(nullptr) {}
+  ~ReplyMessage() override;
+  explicit PROTOBUF_CONSTEXPR ReplyMessage(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  ReplyMessage(const ReplyMessage& from);
+  ReplyMessage(ReplyMessage&& from) noexcept
+    : ReplyMessage() {
+    *this = ::std::move(from);
+  }
+
+  inline ReplyMessage& operator=(const ReplyMessage& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline ReplyMessage& operator=(ReplyMessage&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ReplyMessage& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const ReplyMessage* internal_default_instance() {
+    return reinterpret_cast<const ReplyMessage*>(
+               &_ReplyMessage_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    0;
+
+  friend void swap(ReplyMessage& a, ReplyMessage& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(ReplyMessage* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ReplyMessage* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  ReplyMessage* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ReplyMessage>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const ReplyMessage& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ReplyMessage& from) {
+    ReplyMessage::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(ReplyMessage* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "dsnet.transaction.spanner.proto.ReplyMessage";
+  }
+  protected:
+  explicit ReplyMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kReplyFieldNumber = 4,
+    kClientreqidFieldNumber = 1,
+    kShardNumFieldNumber = 2,
+    kTypeFieldNumber = 3,
+  };
+  // optional bytes reply = 4;
+  bool has_reply() const;
+  private:
+  bool _internal_has_reply() const;
+  public:
+  void clear_reply();
+  const std::string& reply() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_reply(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_reply();
+  PROTOBUF_NODISCARD std::string* release_reply();
+  void set_allocated_reply(std::string* reply);
+  private:
+  const std::string& _internal_reply() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_reply(const std::string& value);
+  std::string* _internal_mutable_reply();
+  public:
+
+  // required uint64 clientreqid = 1;
+  bool has_clientreqid() const;
+  private:
+  bool _internal_has_clientreqid() const;
+  public:
+  void clear_clientreqid();
+  uint64_t clientreqid() const;
+  void set_clientreqid(uint64_t value);
+  private:
+  uint64_t _internal_clientreqid() const;
+  void _internal_set_clientreqid(uint64_t value);
+  public:
+
+  // required uint32 shard_num = 2;
+  bool has_shard_num() const;
+  private:
+  bool _internal_has_shard_num() const;
+  public:
+  void clear_shard_num();
+  uint32_t shard_num() const;
+  void set_shard_num(uint32_t value);
+  private:
+  uint32_t _internal_shard_num() const;
+  void _internal_set_shard_num(uint32_t value);
+  public:
+
+  // required .dsnet.transaction.spanner.proto.ReplyType type = 3;
+  bool has_type() const;
+  private:
+  bool _internal_has_type() const;
+  public:
+  void clear_type();
+  ::dsnet::transaction::spanner::proto::ReplyType type() const;
+  void set_type(::dsnet::transaction::spanner::proto::ReplyType value);
+  private:
+  ::dsnet::transaction::spanner::proto::ReplyType _internal_type() const;
+  void _internal_set_type(::dsnet::transaction::spanner::proto::ReplyType value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:dsnet.transaction.spanner.proto.ReplyMessage)
+ private:
+  class _Internal;
+
+  // helper for ByteSizeLong()
+  size_t RequiredFieldsByteSizeFallback() const;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr reply_;
+    uint64_t clientreqid_;
+    uint32_t shard_num_;
+    int type_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_transaction_2fspanner_2fspanner_2dproto_2eproto;
+};
+// -------------------------------------------------------------------
+
+class RequestMessage final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:dsnet.transaction.spanner.proto.RequestMessage) */ {
+ public:
+  inline RequestMessage() : RequestMessage(nullptr) {}
+  ~RequestMessage() override;
+  explicit PROTOBUF_CONSTEXPR RequestMessage(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  RequestMessage(const RequestMessage& from);
+  RequestMessage(RequestMessage&& from) noexcept
+    : RequestMessage() {
+    *this = ::std::move(from);
+  }
+
+  inline RequestMessage& operator=(const RequestMessage& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline RequestMessage& operator=(RequestMessage&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const RequestMessage& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const RequestMessage* internal_default_instance() {
+    return reinterpret_cast<const RequestMessage*>(
+               &_RequestMessage_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    1;
+
+  friend void swap(RequestMessage& a, RequestMessage& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(RequestMessage* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(RequestMessage* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  RequestMessage* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<RequestMessage>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const RequestMessage& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const RequestMessage& from) {
+    RequestMessage::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(RequestMessage* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "dsnet.transaction.spanner.proto.RequestMessage";
+  }
+  protected:
+  explicit RequestMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kRequestFieldNumber = 3,
+    kTxnidFieldNumber = 1,
+    kTypeFieldNumber = 2,
+  };
+  // required .dsnet.Request request = 3;
+  bool has_request() const;
+  private:
+  bool _internal_has_request() const;
+  public:
+  void clear_request();
+  const ::dsnet::Request& request() const;
+  PROTOBUF_NODISCARD ::dsnet::Request* release_request();
+  ::dsnet::Request* mutable_request();
+  void set_allocated_request(::dsnet::Request* request);
+  private:
+  const ::dsnet::Request& _internal_request() const;
+  ::dsnet::Request* _internal_mutable_request();
+  public:
+  void unsafe_arena_set_allocated_request(
+      ::dsnet::Request* request);
+  ::dsnet::Request* unsafe_arena_release_request();
+
+  // required uint64 txnid = 1;
+  bool has_txnid() const;
+  private:
+  bool _internal_has_txnid() const;
+  public:
+  void clear_txnid();
+  uint64_t txnid() const;
+  void set_txnid(uint64_t value);
+  private:
+  uint64_t _internal_txnid() const;
+  void _internal_set_txnid(uint64_t value);
+  public:
+
+  // required .dsnet.transaction.spanner.proto.RequestType type = 2;
+  bool has_type() const;
+  private:
+  bool _internal_has_type() const;
+  public:
+  void clear_type();
+  ::dsnet::transaction::spanner::proto::RequestType type() const;
+  void set_type(::dsnet::transaction::spanner::proto::RequestType value);
+  private:
+  ::dsnet::transaction::spanner::proto::RequestType _internal_type() const;
+  void _internal_set_type(::dsnet::transaction::spanner::proto::RequestType value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:dsnet.transaction.spanner.proto.RequestMessage)
+ private:
+  class _Internal;
+
+  // helper for ByteSizeLong()
+  size_t RequiredFieldsByteSizeFallback() const;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::dsnet::Request* request_;
+    uint64_t txnid_;
+    int type_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_transaction_2fspanner_2fspanner_2dproto_2eproto;
+};
+// -------------------------------------------------------------------
+
+class PrepareMessage final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:dsnet.transaction.spanner.proto.PrepareMessage) */ {
+ public:
+  inline PrepareMessage() : PrepareMessage(nullptr) {}
+  ~PrepareMessage() override;
+  explicit PROTOBUF_CONSTEXPR PrepareMessage(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  PrepareMessage(const PrepareMessage& from);
+  PrepareMessage(PrepareMessage&& from) noexcept
+    : PrepareMessage() {
+    *this = ::std::move(from);
+  }
+
+  inline PrepareMessage& operator=(const PrepareMessage& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline PrepareMessage& operator=(PrepareMessage&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const PrepareMessage& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const PrepareMessage* internal_default_instance() {
+    return reinterpret_cast<const PrepareMessage*>(
+               &_PrepareMessage_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    2;
+
+  friend void swap(PrepareMessage& a, PrepareMessage& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(PrepareMessage* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(PrepareMessage* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  PrepareMessage* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<PrepareMessage>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const PrepareMessage& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const PrepareMessage& from) {
+    PrepareMessage::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(PrepareMessage* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "dsnet.transaction.spanner.proto.PrepareMessage";
+  }
+  protected:
+  explicit PrepareMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kRequestFieldNumber = 5,
+    kViewFieldNumber = 1,
+    kOpnumFieldNumber = 2,
+    kTxnidFieldNumber = 3,
+    kTypeFieldNumber = 4,
+  };
+  // required .dsnet.Request request = 5;
+  bool has_request() const;
+  private:
+  bool _internal_has_request() const;
+  public:
+  void clear_request();
+  const ::dsnet::Request& request() const;
+  PROTOBUF_NODISCARD ::dsnet::Request* release_request();
+  ::dsnet::Request* mutable_request();
+  void set_allocated_request(::dsnet::Request* request);
+  private:
+  const ::dsnet::Request& _internal_request() const;
+  ::dsnet::Request* _internal_mutable_request();
+  public:
+  void unsafe_arena_set_allocated_request(
+      ::dsnet::Request* request);
+  ::dsnet::Request* unsafe_arena_release_request();
+
+  // required uint64 view = 1;
+  bool has_view() const;
+  private:
+  bool _internal_has_view() const;
+  public:
+  void clear_view();
+  uint64_t view() const;
+  void set_view(uint64_t value);
+  private:
+  uint64_t _internal_view() const;
+  void _internal_set_view(uint64_t value);
+  public:
+
+  // required uint64 opnum = 2;
+  bool has_opnum() const;
+  private:
+  bool _internal_has_opnum() const;
+  public:
+  void clear_opnum();
+  uint64_t opnum() const;
+  void set_opnum(uint64_t value);
+  private:
+  uint64_t _internal_opnum() const;
+  void _internal_set_opnum(uint64_t value);
+  public:
+
+  // required uint64 txnid = 3;
+  bool has_txnid() const;
+  private:
+  bool _internal_has_txnid() const;
+  public:
+  void clear_txnid();
+  uint64_t txnid() const;
+  void set_txnid(uint64_t value);
+  private:
+  uint64_t _internal_txnid() const;
+  void _internal_set_txnid(uint64_t value);
+  public:
+
+  // required .dsnet.transaction.spanner.proto.RequestType type = 4;
+  bool has_type() const;
+  private:
+  bool _internal_has_type() const;
+  public:
+  void clear_type();
+  ::dsnet::transaction::spanner::proto::RequestType type() const;
+  void set_type(::dsnet::transaction::spanner::proto::RequestType value);
+  private:
+  ::dsnet::transaction::spanner::proto::RequestType _internal_type() const;
+  void _internal_set_type(::dsnet::transaction::spanner::proto::RequestType value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:dsnet.transaction.spanner.proto.PrepareMessage)
+ private:
+  class _Internal;
+
+  // helper for ByteSizeLong()
+  size_t RequiredFieldsByteSizeFallback() const;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::dsnet::Request* request_;
+    uint64_t view_;
+    uint64_t opnum_;
+    uint64_t txnid_;
+    int type_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_transaction_2fspanner_2fspanner_2dproto_2eproto;
+};
+// -------------------------------------------------------------------
+
+class PrepareOKMessage final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:dsnet.transaction.spanner.proto.PrepareOKMessage) */ {
+ public:
+  inline PrepareOKMessage() : PrepareOKMessage(nullptr) {}
+  ~PrepareOKMessage() override;
+  explicit PROTOBUF_CONSTEXPR PrepareOKMessage(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  PrepareOKMessage(const PrepareOKMessage& from);
+  PrepareOKMessage(PrepareOKMessage&& from) noexcept
+    : PrepareOKMessage() {
+    *this = ::std::move(from);
+  }
+
+  inline PrepareOKMessage& operator=(const PrepareOKMessage& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline PrepareOKMessage& operator=(PrepareOKMessage&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const PrepareOKMessage& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const PrepareOKMessage* internal_default_instance() {
+    return reinterpret_cast<const PrepareOKMessage*>(
+               &_PrepareOKMessage_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    3;
+
+  friend void swap(PrepareOKMessage& a, PrepareOKMessage& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(PrepareOKMessage* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(PrepareOKMessage* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  PrepareOKMessage* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<PrepareOKMessage>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const PrepareOKMessage& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const PrepareOKMessage& from) {
+    PrepareOKMessage::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(PrepareOKMessage* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "dsnet.transaction.spanner.proto.PrepareOKMessage";
+  }
+  protected:
+  explicit PrepareOKMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kViewFieldNumber = 1,
+    kOpnumFieldNumber = 2,
+    kReplicaNumFieldNumber = 3,
+  };
+  // required uint64 view = 1;
+  bool has_view() const;
+  private:
+  bool _internal_has_view() const;
+  public:
+  void clear_view();
+  uint64_t view() const;
+  void set_view(uint64_t value);
+  private:
+  uint64_t _internal_view() const;
+  void _internal_set_view(uint64_t value);
+  public:
+
+  // required uint64 opnum = 2;
+  bool has_opnum() const;
+  private:
+  bool _internal_has_opnum() const;
+  public:
+  void clear_opnum();
+  uint64_t opnum() const;
+  void set_opnum(uint64_t value);
+  private:
+  uint64_t _internal_opnum() const;
+  void _internal_set_opnum(uint64_t value);
+  public:
+
+  // required uint32 replica_num = 3;
+  bool has_replica_num() const;
+  private:
+  bool _internal_has_replica_num() const;
+  public:
+  void clear_replica_num();
+  uint32_t replica_num() const;
+  void set_replica_num(uint32_t value);
+  private:
+  uint32_t _internal_replica_num() const;
+  void _internal_set_replica_num(uint32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:dsnet.transaction.spanner.proto.PrepareOKMessage)
+ private:
+  class _Internal;
+
+  // helper for ByteSizeLong()
+  size_t RequiredFieldsByteSizeFallback() const;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    uint64_t view_;
+    uint64_t opnum_;
+    uint32_t replica_num_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_transaction_2fspanner_2fspanner_2dproto_2eproto;
+};
+// -------------------------------------------------------------------
+
+class CommitMessage final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:dsnet.transaction.spanner.proto.CommitMessage) */ {
+ public:
+  inline CommitMessage() : CommitMessage(nullptr) {}
+  ~CommitMessage() override;
+  explicit PROTOBUF_CONSTEXPR CommitMessage(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  CommitMessage(const CommitMessage& from);
+  CommitMessage(CommitMessage&& from) noexcept
+    : CommitMessage() {
+    *this = ::std::move(from);
+  }
+
+  inline CommitMessage& operator=(const CommitMessage& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline CommitMessage& operator=(CommitMessage&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const CommitMessage& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const CommitMessage* internal_default_instance() {
+    return reinterpret_cast<const CommitMessage*>(
+               &_CommitMessage_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    4;
+
+  friend void swap(CommitMessage& a, CommitMessage& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(CommitMessage* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(CommitMessage* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  CommitMessage* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<CommitMessage>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const CommitMessage& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const CommitMessage& from) {
+    CommitMessage::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(CommitMessage* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "dsnet.transaction.spanner.proto.CommitMessage";
+  }
+  protected:
+  explicit CommitMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kViewFieldNumber = 1,
+    kOpnumFieldNumber = 2,
+  };
+  // required uint64 view = 1;
+  bool has_view() const;
+  private:
+  bool _internal_has_view() const;
+  public:
+  void clear_view();
+  uint64_t view() const;
+  void set_view(uint64_t value);
+  private:
+  uint64_t _internal_view() const;
+  void _internal_set_view(uint64_t value);
+  public:
+
+  // required uint64 opnum = 2;
+  bool has_opnum() const;
+  private:
+  bool _internal_has_opnum() const;
+  public:
+  void clear_opnum();
+  uint64_t opnum() const;
+  void set_opnum(uint64_t value);
+  private:
+  uint64_t _internal_opnum() const;
+  void _internal_set_opnum(uint64_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:dsnet.transaction.spanner.proto.CommitMessage)
+ private:
+  class _Internal;
+
+  // helper for ByteSizeLong()
+  size_t RequiredFieldsByteSizeFallback() const;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    uint64_t view_;
+    uint64_t opnum_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_transaction_2fspanner_2fspanner_2dproto_2eproto;
+};
+// -------------------------------------------------------------------
+
+class ToServerMessage final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:dsnet.transaction.spanner.proto.ToServerMessage) */ {
+ public:
+  inline ToServerMessage() : ToServerMessage(nullptr) {}
+  ~ToServerMessage() override;
+  explicit PROTOBUF_CONSTEXPR ToServerMessage(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  ToServerMessage(const ToServerMessage& from);
+  ToServerMessage(ToServerMessage&& from) noexcept
+    : ToServerMessage() {
+    *this = ::std::move(from);
+  }
+
+  inline ToServerMessage& operator=(const ToServerMessage& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline ToServerMessage& operator=(ToServerMessage&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ToServerMessage& default_instance() {
+    return *internal_default_instance();
+  }
+  enum MsgCase {
+    kRequest = 1,
+    kPrepare = 2,
+    kPrepareOk = 3,
+    kCommit = 4,
+    MSG_NOT_SET = 0,
+  };
+
+  static inline const ToServerMessage* internal_default_instance() {
+    return reinterpret_cast<const ToServerMessage*>(
+               &_ToServerMessage_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    5;
+
+  friend void swap(ToServerMessage& a, ToServerMessage& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(ToServerMessage* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ToServerMessage* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  ToServerMessage* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ToServerMessage>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const ToServerMessage& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ToServerMessage& from) {
+    ToServerMessage::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(ToServerMessage* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "dsnet.transaction.spanner.proto.ToServerMessage";
+  }
+  protected:
+  explicit ToServerMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kRequestFieldNumber = 1,
+    kPrepareFieldNumber = 2,
+    kPrepareOkFieldNumber = 3,
+    kCommitFieldNumber = 4,
+  };
+  // .dsnet.transaction.spanner.proto.RequestMessage request = 1;
+  bool has_request() const;
+  private:
+  bool _internal_has_request() const;
+  public:
+  void clear_request();
+  const ::dsnet::transaction::spanner::proto::RequestMessage& request() const;
+  PROTOBUF_NODISCARD ::dsnet::transaction::spanner::proto::RequestMessage* release_request();
+  ::dsnet::transaction::spanner::proto::RequestMessage* mutable_request();
+  void set_allocated_request(::dsnet::transaction::spanner::proto::RequestMessage* request);
+  private:
+  const ::dsnet::transaction::spanner::proto::RequestMessage& _internal_request() const;
+  ::dsnet::transaction::spanner::proto::RequestMessage* _internal_mutable_request();
+  public:
+  void unsafe_arena_set_allocated_request(
+      ::dsnet::transaction::spanner::proto::RequestMessage* request);
+  ::dsnet::transaction::spanner::proto::RequestMessage* unsafe_arena_release_request();
+
+  // .dsnet.transaction.spanner.proto.PrepareMessage prepare = 2;
+  bool has_prepare() const;
+  private:
+  bool _internal_has_prepare() const;
+  public:
+  void clear_prepare();
+  const ::dsnet::transaction::spanner::proto::PrepareMessage& prepare() const;
+  PROTOBUF_NODISCARD ::dsnet::transaction::spanner::proto::PrepareMessage* release_prepare();
+  ::dsnet::transaction::spanner::proto::PrepareMessage* mutable_prepare();
+  void set_allocated_prepare(::dsnet::transaction::spanner::proto::PrepareMessage* prepare);
+  private:
+  const ::dsnet::transaction::spanner::proto::PrepareMessage& _internal_prepare() const;
+  ::dsnet::transaction::spanner::proto::PrepareMessage* _internal_mutable_prepare();
+  public:
+  void unsafe_arena_set_allocated_prepare(
+      ::dsnet::transaction::spanner::proto::PrepareMessage* prepare);
+  ::dsnet::transaction::spanner::proto::PrepareMessage* unsafe_arena_release_prepare();
+
+  // .dsnet.transaction.spanner.proto.PrepareOKMessage prepare_ok = 3;
+  bool has_prepare_ok() const;
+  private:
+  bool _internal_has_prepare_ok() const;
+  public:
+  void clear_prepare_ok();
+  const ::dsnet::transaction::spanner::proto::PrepareOKMessage& prepare_ok() const;
+  PROTOBUF_NODISCARD ::dsnet::transaction::spanner::proto::PrepareOKMessage* release_prepare_ok();
+  ::dsnet::transaction::spanner::proto::PrepareOKMessage* mutable_prepare_ok();
+  void set_allocated_prepare_ok(::dsnet::transaction::spanner::proto::PrepareOKMessage* prepare_ok);
+  private:
+  const ::dsnet::transaction::spanner::proto::PrepareOKMessage& _internal_prepare_ok() const;
+  ::dsnet::transaction::spanner::proto::PrepareOKMessage* _internal_mutable_prepare_ok();
+  public:
+  void unsafe_arena_set_allocated_prepare_ok(
+      ::dsnet::transaction::spanner::proto::PrepareOKMessage* prepare_ok);
+  ::dsnet::transaction::spanner::proto::PrepareOKMessage* unsafe_arena_release_prepare_ok();
+
+  // .dsnet.transaction.spanner.proto.CommitMessage commit = 4;
+  bool has_commit() const;
+  private:
+  bool _internal_has_commit() const;
+  public:
+  void clear_commit();
+  const ::dsnet::transaction::spanner::proto::CommitMessage& commit() const;
+  PROTOBUF_NODISCARD ::dsnet::transaction::spanner::proto::CommitMessage* release_commit();
+  ::dsnet::transaction::spanner::proto::CommitMessage* mutable_commit();
+  void set_allocated_commit(::dsnet::transaction::spanner::proto::CommitMessage* commit);
+  private:
+  const ::dsnet::transaction::spanner::proto::CommitMessage& _internal_commit() const;
+  ::dsnet::transaction::spanner::proto::CommitMessage* _internal_mutable_commit();
+  public:
+  void unsafe_arena_set_allocated_commit(
+      ::dsnet::transaction::spanner::proto::CommitMessage* commit);
+  ::dsnet::transaction::spanner::proto::CommitMessage* unsafe_arena_release_commit();
+
+  void clear_msg();
+  MsgCase msg_case() const;
+  // @@protoc_insertion_point(class_scope:dsnet.transaction.spanner.proto.ToServerMessage)
+ private:
+  class _Internal;
+  void set_has_request();
+  void set_has_prepare();
+  void set_has_prepare_ok();
+  void set_has_commit();
+
+  inline bool has_msg() const;
+  inline void clear_has_msg();
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    union MsgUnion {
+      constexpr MsgUnion() : _constinit_{} {}
+        ::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized _constinit_;
+      ::dsnet::transaction::spanner::proto::RequestMessage* request_;
+      ::dsnet::transaction::spanner::proto::PrepareMessage* prepare_;
+      ::dsnet::transaction::spanner::proto::PrepareOKMessage* prepare_ok_;
+      ::dsnet::transaction::spanner::proto::CommitMessage* commit_;
+    } msg_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    uint32_t _oneof_case_[1];
+
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_transaction_2fspanner_2fspanner_2dproto_2eproto;
+};
+// ===================================================================
+
+
+// ===================================================================
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
+#endif  // __GNUC__
+// ReplyMessage
+
+// required uint64 clientreqid = 1;
+inline bool ReplyMessage::_internal_has_clientreqid() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool ReplyMessage::has_clientreqid() const {
+  return _internal_has_clientreqid();
+}
+inline void ReplyMessage::clear_clientreqid() {
+  _impl_.clientreqid_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline uint64_t ReplyMessage::_internal_clientreqid() const {
+  return _impl_.clientreqid_;
+}
+inline uint64_t ReplyMessage::clientreqid() const {
+  // @@protoc_insertion_point(field_get:dsnet.transaction.spanner.proto.ReplyMessage.clientreqid)
+  return _internal_clientreqid();
+}
+inline void ReplyMessage::_internal_set_clientreqid(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.clientreqid_ = value;
+}
+inline void ReplyMessage::set_clientreqid(uint64_t value) {
+  _internal_set_clientreqid(value);
+  // @@protoc_insertion_point(field_set:dsnet.transaction.spanner.proto.ReplyMessage.clientreqid)
+}
+
+// required uint32 shard_num = 2;
+inline bool ReplyMessage::_internal_has_shard_num() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool ReplyMessage::has_shard_num() const {
+  return _internal_has_shard_num();
+}
+inline void ReplyMessage::clear_shard_num() {
+  _impl_.shard_num_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline uint32_t ReplyMessage::_internal_shard_num() const {
+  return _impl_.shard_num_;
+}
+inline uint32_t ReplyMessage::shard_num() const {
+  // @@protoc_insertion_point(field_get:dsnet.transaction.spanner.proto.ReplyMessage.shard_num)
+  return _internal_shard_num();
+}
+inline void ReplyMessage::_internal_set_shard_num(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.shard_num_ = value;
+}
+inline void ReplyMessage::set_shard_num(uint32_t value) {
+  _internal_set_shard_num(value);
+  // @@protoc_insertion_point(field_set:dsnet.transaction.spanner.proto.ReplyMessage.shard_num)
+}
+
+// required .dsnet.transaction.spanner.proto.ReplyType type = 3;
+inline bool ReplyMessage::_internal_has_type() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  return value;
+}
+inline bool ReplyMessage::has_type() const {
+  return _internal_has_type();
+}
+inline void ReplyMessage::clear_type() {
+  _impl_.type_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000008u;
+}
+inline ::dsnet::transaction::spanner::proto::ReplyType ReplyMessage::_internal_type() const {
+  return static_cast< ::dsnet::transaction::spanner::proto::ReplyType >(_impl_.type_);
+}
+inline ::dsnet::transaction::spanner::proto::ReplyType ReplyMessage::type() const {
+  // @@protoc_insertion_point(field_get:dsnet.transaction.spanner.proto.ReplyMessage.type)
+  return _internal_type();
+}
+inline void ReplyMessage::_internal_set_type(::dsnet::transaction::spanner::proto::ReplyType value) {
+  assert(::dsnet::transaction::spanner::proto::ReplyType_IsValid(value));
+  _impl_._has_bits_[0] |= 0x00000008u;
+  _impl_.type_ = value;
+}
+inline void ReplyMessage::set_type(::dsnet::transaction::spanner::proto::ReplyType value) {
+  _internal_set_type(value);
+  // @@protoc_insertion_point(field_set:dsnet.transaction.spanner.proto.ReplyMessage.type)
+}
+
+// optional bytes reply = 4;
+inline bool ReplyMessage::_internal_has_reply() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool ReplyMessage::has_reply() const {
+  return _internal_has_reply();
+}
+inline void ReplyMessage::clear_reply() {
+  _impl_.reply_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& ReplyMessage::reply() const {
+  // @@protoc_insertion_point(field_get:dsnet.transaction.spanner.proto.ReplyMessage.reply)
+  return _internal_reply();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void ReplyMessage::set_reply(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.reply_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:dsnet.transaction.spanner.proto.ReplyMessage.reply)
+}
+inline std::string* ReplyMessage::mutable_reply() {
+  std::string* _s = _internal_mutable_reply();
+  // @@protoc_insertion_point(field_mutable:dsnet.transaction.spanner.proto.ReplyMessage.reply)
+  return _s;
+}
+inline const std::string& ReplyMessage::_internal_reply() const {
+  return _impl_.reply_.Get();
+}
+inline void ReplyMessage::_internal_set_reply(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.reply_.Set(value, GetArenaForAllocation());
+}
+inline std::string* ReplyMessage::_internal_mutable_reply() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.reply_.Mutable(GetArenaForAllocation());
+}
+inline std::string* ReplyMessage::release_reply() {
+  // @@protoc_insertion_point(field_release:dsnet.transaction.spanner.proto.ReplyMessage.reply)
+  if (!_internal_has_reply()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.reply_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.reply_.IsDefault()) {
+    _impl_.reply_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void ReplyMessage::set_allocated_reply(std::string* reply) {
+  if (reply != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.reply_.SetAllocated(reply, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.reply_.IsDefault()) {
+    _impl_.reply_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:dsnet.transaction.spanner.proto.ReplyMessage.reply)
+}
+
+// -------------------------------------------------------------------
+
+// RequestMessage
+
+// required uint64 txnid = 1;
+inline bool RequestMessage::_internal_has_txnid() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool RequestMessage::has_txnid() const {
+  return _internal_has_txnid();
+}
+inline void RequestMessage::clear_txnid() {
+  _impl_.txnid_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline uint64_t RequestMessage::_internal_txnid() const {
+  return _impl_.txnid_;
+}
+inline uint64_t RequestMessage::txnid() const {
+  // @@protoc_insertion_point(field_get:dsnet.transaction.spanner.proto.RequestMessage.txnid)
+  return _internal_txnid();
+}
+inline void RequestMessage::_internal_set_txnid(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.txnid_ = value;
+}
+inline void RequestMessage::set_txnid(uint64_t value) {
+  _internal_set_txnid(value);
+  // @@protoc_insertion_point(field_set:dsnet.transaction.spanner.proto.RequestMessage.txnid)
+}
+
+// required .dsnet.transaction.spanner.proto.RequestType type = 2;
+inline bool RequestMessage::_internal_has_type() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool RequestMessage::has_type() const {
+  return _internal_has_type();
+}
+inline void RequestMessage::clear_type() {
+  _impl_.type_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline ::dsnet::transaction::spanner::proto::RequestType RequestMessage::_internal_type() const {
+  return static_cast< ::dsnet::transaction::spanner::proto::RequestType >(_impl_.type_);
+}
+inline ::dsnet::transaction::spanner::proto::RequestType RequestMessage::type() const {
+  // @@protoc_insertion_point(field_get:dsnet.transaction.spanner.proto.RequestMessage.type)
+  return _internal_type();
+}
+inline void RequestMessage::_internal_set_type(::dsnet::transaction::spanner::proto::RequestType value) {
+  assert(::dsnet::transaction::spanner::proto::RequestType_IsValid(value));
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.type_ = value;
+}
+inline void RequestMessage::set_type(::dsnet::transaction::spanner::proto::RequestType value) {
+  _internal_set_type(value);
+  // @@protoc_insertion_point(field_set:dsnet.transaction.spanner.proto.RequestMessage.type)
+}
+
+// required .dsnet.Request request = 3;
+inline bool RequestMessage::_internal_has_request() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.request_ != nullptr);
+  return value;
+}
+inline bool RequestMessage::has_request() const {
+  return _internal_has_request();
+}
+inline const ::dsnet::Request& RequestMessage::_internal_request() const {
+  const ::dsnet::Request* p = _impl_.request_;
+  return p != nullptr ? *p : reinterpret_cast<const ::dsnet::Request&>(
+      ::dsnet::_Request_default_instance_);
+}
+inline const ::dsnet::Request& RequestMessage::request() const {
+  // @@protoc_insertion_point(field_get:dsnet.transaction.spanner.proto.RequestMessage.request)
+  return _internal_request();
+}
+inline void RequestMessage::unsafe_arena_set_allocated_request(
+    ::dsnet::Request* request) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.request_);
+  }
+  _impl_.request_ = request;
+  if (request) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:dsnet.transaction.spanner.proto.RequestMessage.request)
+}
+inline ::dsnet::Request* RequestMessage::release_request() {
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::dsnet::Request* temp = _impl_.request_;
+  _impl_.request_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::dsnet::Request* RequestMessage::unsafe_arena_release_request() {
+  // @@protoc_insertion_point(field_release:dsnet.transaction.spanner.proto.RequestMessage.request)
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::dsnet::Request* temp = _impl_.request_;
+  _impl_.request_ = nullptr;
+  return temp;
+}
+inline ::dsnet::Request* RequestMessage::_internal_mutable_request() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  if (_impl_.request_ == nullptr) {
+    auto* p = CreateMaybeMessage<::dsnet::Request>(GetArenaForAllocation());
+    _impl_.request_ = p;
+  }
+  return _impl_.request_;
+}
+inline ::dsnet::Request* RequestMessage::mutable_request() {
+  ::dsnet::Request* _msg = _internal_mutable_request();
+  // @@protoc_insertion_point(field_mutable:dsnet.transaction.spanner.proto.RequestMessage.request)
+  return _msg;
+}
+inline void RequestMessage::set_allocated_request(::dsnet::Request* request) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete reinterpret_cast< ::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.request_);
+  }
+  if (request) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(
+                reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(request));
+    if (message_arena != submessage_arena) {
+      request = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, request, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.request_ = request;
+  // @@protoc_insertion_point(field_set_allocated:dsnet.transaction.spanner.proto.RequestMessage.request)
+}
+
+// -------------------------------------------------------------------
+
+// PrepareMessage
+
+// required uint64 view = 1;
+inline bool PrepareMessage::_internal_has_view() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool PrepareMessage::has_view() const {
+  return _internal_has_view();
+}
+inline void PrepareMessage::clear_view() {
+  _impl_.view_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline uint64_t PrepareMessage::_internal_view() const {
+  return _impl_.view_;
+}
+inline uint64_t PrepareMessage::view() const {
+  // @@protoc_insertion_point(field_get:dsnet.transaction.spanner.proto.PrepareMessage.view)
+  return _internal_view();
+}
+inline void PrepareMessage::_internal_set_view(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.view_ = value;
+}
+inline void PrepareMessage::set_view(uint64_t value) {
+  _internal_set_view(value);
+  // @@protoc_insertion_point(field_set:dsnet.transaction.spanner.proto.PrepareMessage.view)
+}
+
+// required uint64 opnum = 2;
+inline bool PrepareMessage::_internal_has_opnum() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool PrepareMessage::has_opnum() const {
+  return _internal_has_opnum();
+}
+inline void PrepareMessage::clear_opnum() {
+  _impl_.opnum_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline uint64_t PrepareMessage::_internal_opnum() const {
+  return _impl_.opnum_;
+}
+inline uint64_t PrepareMessage::opnum() const {
+  // @@protoc_insertion_point(field_get:dsnet.transaction.spanner.proto.PrepareMessage.opnum)
+  return _internal_opnum();
+}
+inline void PrepareMessage::_internal_set_opnum(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.opnum_ = value;
+}
+inline void PrepareMessage::set_opnum(uint64_t value) {
+  _internal_set_opnum(value);
+  // @@protoc_insertion_point(field_set:dsnet.transaction.spanner.proto.PrepareMessage.opnum)
+}
+
+// required uint64 txnid = 3;
+inline bool PrepareMessage::_internal_has_txnid() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  return value;
+}
+inline bool PrepareMessage::has_txnid() const {
+  return _internal_has_txnid();
+}
+inline void PrepareMessage::clear_txnid() {
+  _impl_.txnid_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000008u;
+}
+inline uint64_t PrepareMessage::_internal_txnid() const {
+  return _impl_.txnid_;
+}
+inline uint64_t PrepareMessage::txnid() const {
+  // @@protoc_insertion_point(field_get:dsnet.transaction.spanner.proto.PrepareMessage.txnid)
+  return _internal_txnid();
+}
+inline void PrepareMessage::_internal_set_txnid(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  _impl_.txnid_ = value;
+}
+inline void PrepareMessage::set_txnid(uint64_t value) {
+  _internal_set_txnid(value);
+  // @@protoc_insertion_point(field_set:dsnet.transaction.spanner.proto.PrepareMessage.txnid)
+}
+
+// required .dsnet.transaction.spanner.proto.RequestType type = 4;
+inline bool PrepareMessage::_internal_has_type() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000010u) != 0;
+  return value;
+}
+inline bool PrepareMessage::has_type() const {
+  return _internal_has_type();
+}
+inline void PrepareMessage::clear_type() {
+  _impl_.type_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000010u;
+}
+inline ::dsnet::transaction::spanner::proto::RequestType PrepareMessage::_internal_type() const {
+  return static_cast< ::dsnet::transaction::spanner::proto::RequestType >(_impl_.type_);
+}
+inline ::dsnet::transaction::spanner::proto::RequestType PrepareMessage::type() const {
+  // @@protoc_insertion_point(field_get:dsnet.transaction.spanner.proto.PrepareMessage.type)
+  return _internal_type();
+}
+inline void PrepareMessage::_internal_set_type(::dsnet::transaction::spanner::proto::RequestType value) {
+  assert(::dsnet::transaction::spanner::proto::RequestType_IsValid(value));
+  _impl_._has_bits_[0] |= 0x00000010u;
+  _impl_.type_ = value;
+}
+inline void PrepareMessage::set_type(::dsnet::transaction::spanner::proto::RequestType value) {
+  _internal_set_type(value);
+  // @@protoc_insertion_point(field_set:dsnet.transaction.spanner.proto.PrepareMessage.type)
+}
+
+// required .dsnet.Request request = 5;
+inline bool PrepareMessage::_internal_has_request() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.request_ != nullptr);
+  return value;
+}
+inline bool PrepareMessage::has_request() const {
+  return _internal_has_request();
+}
+inline const ::dsnet::Request& PrepareMessage::_internal_request() const {
+  const ::dsnet::Request* p = _impl_.request_;
+  return p != nullptr ? *p : reinterpret_cast<const ::dsnet::Request&>(
+      ::dsnet::_Request_default_instance_);
+}
+inline const ::dsnet::Request& PrepareMessage::request() const {
+  // @@protoc_insertion_point(field_get:dsnet.transaction.spanner.proto.PrepareMessage.request)
+  return _internal_request();
+}
+inline void PrepareMessage::unsafe_arena_set_allocated_request(
+    ::dsnet::Request* request) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.request_);
+  }
+  _impl_.request_ = request;
+  if (request) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:dsnet.transaction.spanner.proto.PrepareMessage.request)
+}
+inline ::dsnet::Request* PrepareMessage::release_request() {
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::dsnet::Request* temp = _impl_.request_;
+  _impl_.request_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::dsnet::Request* PrepareMessage::unsafe_arena_release_request() {
+  // @@protoc_insertion_point(field_release:dsnet.transaction.spanner.proto.PrepareMessage.request)
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::dsnet::Request* temp = _impl_.request_;
+  _impl_.request_ = nullptr;
+  return temp;
+}
+inline ::dsnet::Request* PrepareMessage::_internal_mutable_request() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  if (_impl_.request_ == nullptr) {
+    auto* p = CreateMaybeMessage<::dsnet::Request>(GetArenaForAllocation());
+    _impl_.request_ = p;
+  }
+  return _impl_.request_;
+}
+inline ::dsnet::Request* PrepareMessage::mutable_request() {
+  ::dsnet::Request* _msg = _internal_mutable_request();
+  // @@protoc_insertion_point(field_mutable:dsnet.transaction.spanner.proto.PrepareMessage.request)
+  return _msg;
+}
+inline void PrepareMessage::set_allocated_request(::dsnet::Request* request) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete reinterpret_cast< ::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.request_);
+  }
+  if (request) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(
+                reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(request));
+    if (message_arena != submessage_arena) {
+      request = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, request, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.request_ = request;
+  // @@protoc_insertion_point(field_set_allocated:dsnet.transaction.spanner.proto.PrepareMessage.request)
+}
+
+// -------------------------------------------------------------------
+
+// PrepareOKMessage
+
+// required uint64 view = 1;
+inline bool PrepareOKMessage::_internal_has_view() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool PrepareOKMessage::has_view() const {
+  return _internal_has_view();
+}
+inline void PrepareOKMessage::clear_view() {
+  _impl_.view_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline uint64_t PrepareOKMessage::_internal_view() const {
+  return _impl_.view_;
+}
+inline uint64_t PrepareOKMessage::view() const {
+  // @@protoc_insertion_point(field_get:dsnet.transaction.spanner.proto.PrepareOKMessage.view)
+  return _internal_view();
+}
+inline void PrepareOKMessage::_internal_set_view(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.view_ = value;
+}
+inline void PrepareOKMessage::set_view(uint64_t value) {
+  _internal_set_view(value);
+  // @@protoc_insertion_point(field_set:dsnet.transaction.spanner.proto.PrepareOKMessage.view)
+}
+
+// required uint64 opnum = 2;
+inline bool PrepareOKMessage::_internal_has_opnum() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool PrepareOKMessage::has_opnum() const {
+  return _internal_has_opnum();
+}
+inline void PrepareOKMessage::clear_opnum() {
+  _impl_.opnum_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline uint64_t PrepareOKMessage::_internal_opnum() const {
+  return _impl_.opnum_;
+}
+inline uint64_t PrepareOKMessage::opnum() const {
+  // @@protoc_insertion_point(field_get:dsnet.transaction.spanner.proto.PrepareOKMessage.opnum)
+  return _internal_opnum();
+}
+inline void PrepareOKMessage::_internal_set_opnum(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.opnum_ = value;
+}
+inline void PrepareOKMessage::set_opnum(uint64_t value) {
+  _internal_set_opnum(value);
+  // @@protoc_insertion_point(field_set:dsnet.transaction.spanner.proto.PrepareOKMessage.opnum)
+}
+
+// required uint32 replica_num = 3;
+inline bool PrepareOKMessage::_internal_has_replica_num() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool PrepareOKMessage::has_replica_num() const {
+  return _internal_has_replica_num();
+}
+inline void PrepareOKMessage::clear_replica_num() {
+  _impl_.replica_num_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline uint32_t PrepareOKMessage::_internal_replica_num() const {
+  return _impl_.replica_num_;
+}
+inline uint32_t PrepareOKMessage::replica_num() const {
+  // @@protoc_insertion_point(field_get:dsnet.transaction.spanner.proto.PrepareOKMessage.replica_num)
+  return _internal_replica_num();
+}
+inline void PrepareOKMessage::_internal_set_replica_num(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.replica_num_ = value;
+}
+inline void PrepareOKMessage::set_replica_num(uint32_t value) {
+  _internal_set_replica_num(value);
+  // @@protoc_insertion_point(field_set:dsnet.transaction.spanner.proto.PrepareOKMessage.replica_num)
+}
+
+// -------------------------------------------------------------------
+
+// CommitMessage
+
+// required uint64 view = 1;
+inline bool CommitMessage::_internal_has_view() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool CommitMessage::has_view() const {
+  return _internal_has_view();
+}
+inline void CommitMessage::clear_view() {
+  _impl_.view_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline uint64_t CommitMessage::_internal_view() const {
+  return _impl_.view_;
+}
+inline uint64_t CommitMessage::view() const {
+  // @@protoc_insertion_point(field_get:dsnet.transaction.spanner.proto.CommitMessage.view)
+  return _internal_view();
+}
+inline void CommitMessage::_internal_set_view(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.view_ = value;
+}
+inline void CommitMessage::set_view(uint64_t value) {
+  _internal_set_view(value);
+  // @@protoc_insertion_point(field_set:dsnet.transaction.spanner.proto.CommitMessage.view)
+}
+
+// required uint64 opnum = 2;
+inline bool CommitMessage::_internal_has_opnum() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool CommitMessage::has_opnum() const {
+  return _internal_has_opnum();
+}
+inline void CommitMessage::clear_opnum() {
+  _impl_.opnum_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline uint64_t CommitMessage::_internal_opnum() const {
+  return _impl_.opnum_;
+}
+inline uint64_t CommitMessage::opnum() const {
+  // @@protoc_insertion_point(field_get:dsnet.transaction.spanner.proto.CommitMessage.opnum)
+  return _internal_opnum();
+}
+inline void CommitMessage::_internal_set_opnum(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.opnum_ = value;
+}
+inline void CommitMessage::set_opnum(uint64_t value) {
+  _internal_set_opnum(value);
+  // @@protoc_insertion_point(field_set:dsnet.transaction.spanner.proto.CommitMessage.opnum)
+}
+
+// -------------------------------------------------------------------
+
+// ToServerMessage
+
+// .dsnet.transaction.spanner.proto.RequestMessage request = 1;
+inline bool ToServerMessage::_internal_has_request() const {
+  return msg_case() == kRequest;
+}
+inline bool ToServerMessage::has_request() const {
+  return _internal_has_request();
+}
+inline void ToServerMessage::set_has_request() {
+  _impl_._oneof_case_[0] = kRequest;
+}
+inline void ToServerMessage::clear_request() {
+  if (_internal_has_request()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.msg_.request_;
+    }
+    clear_has_msg();
+  }
+}
+inline ::dsnet::transaction::spanner::proto::RequestMessage* ToServerMessage::release_request() {
+  // @@protoc_insertion_point(field_release:dsnet.transaction.spanner.proto.ToServerMessage.request)
+  if (_internal_has_request()) {
+    clear_has_msg();
+    ::dsnet::transaction::spanner::proto::RequestMessage* temp = _impl_.msg_.request_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.msg_.request_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::dsnet::transaction::spanner::proto::RequestMessage& ToServerMessage::_internal_request() const {
+  return _internal_has_request()
+      ? *_impl_.msg_.request_
+      : reinterpret_cast< ::dsnet::transaction::spanner::proto::RequestMessage&>(::dsnet::transaction::spanner::proto::_RequestMessage_default_instance_);
+}
+inline const ::dsnet::transaction::spanner::proto::RequestMessage& ToServerMessage::request() const {
+  // @@protoc_insertion_point(field_get:dsnet.transaction.spanner.proto.ToServerMessage.request)
+  return _internal_request();
+}
+inline ::dsnet::transaction::spanner::proto::RequestMessage* ToServerMessage::unsafe_arena_release_request() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:dsnet.transaction.spanner.proto.ToServerMessage.request)
+  if (_internal_has_request()) {
+    clear_has_msg();
+    ::dsnet::transaction::spanner::proto::RequestMessage* temp = _impl_.msg_.request_;
+    _impl_.msg_.request_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void ToServerMessage::unsafe_arena_set_allocated_request(::dsnet::transaction::spanner::proto::RequestMessage* request) {
+  clear_msg();
+  if (request) {
+    set_has_request();
+    _impl_.msg_.request_ = request;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:dsnet.transaction.spanner.proto.ToServerMessage.request)
+}
+inline ::dsnet::transaction::spanner::proto::RequestMessage* ToServerMessage::_internal_mutable_request() {
+  if (!_internal_has_request()) {
+    clear_msg();
+    set_has_request();
+    _impl_.msg_.request_ = CreateMaybeMessage< ::dsnet::transaction::spanner::proto::RequestMessage >(GetArenaForAllocation());
+  }
+  return _impl_.msg_.request_;
+}
+inline ::dsnet::transaction::spanner::proto::RequestMessage* ToServerMessage::mutable_request() {
+  ::dsnet::transaction::spanner::proto::RequestMessage* _msg = _internal_mutable_request();
+  // @@protoc_insertion_point(field_mutable:dsnet.transaction.spanner.proto.ToServerMessage.request)
+  return _msg;
+}
+
+// .dsnet.transaction.spanner.proto.PrepareMessage prepare = 2;
+inline bool ToServerMessage::_internal_has_prepare() const {
+  return msg_case() == kPrepare;
+}
+inline bool ToServerMessage::has_prepare() const {
+  return _internal_has_prepare();
+}
+inline void ToServerMessage::set_has_prepare() {
+  _impl_._oneof_case_[0] = kPrepare;
+}
+inline void ToServerMessage::clear_prepare() {
+  if (_internal_has_prepare()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.msg_.prepare_;
+    }
+    clear_has_msg();
+  }
+}
+inline ::dsnet::transaction::spanner::proto::PrepareMessage* ToServerMessage::release_prepare() {
+  // @@protoc_insertion_point(field_release:dsnet.transaction.spanner.proto.ToServerMessage.prepare)
+  if (_internal_has_prepare()) {
+    clear_has_msg();
+    ::dsnet::transaction::spanner::proto::PrepareMessage* temp = _impl_.msg_.prepare_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.msg_.prepare_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::dsnet::transaction::spanner::proto::PrepareMessage& ToServerMessage::_internal_prepare() const {
+  return _internal_has_prepare()
+      ? *_impl_.msg_.prepare_
+      : reinterpret_cast< ::dsnet::transaction::spanner::proto::PrepareMessage&>(::dsnet::transaction::spanner::proto::_PrepareMessage_default_instance_);
+}
+inline const ::dsnet::transaction::spanner::proto::PrepareMessage& ToServerMessage::prepare() const {
+  // @@protoc_insertion_point(field_get:dsnet.transaction.spanner.proto.ToServerMessage.prepare)
+  return _internal_prepare();
+}
+inline ::dsnet::transaction::spanner::proto::PrepareMessage* ToServerMessage::unsafe_arena_release_prepare() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:dsnet.transaction.spanner.proto.ToServerMessage.prepare)
+  if (_internal_has_prepare()) {
+    clear_has_msg();
+    ::dsnet::transaction::spanner::proto::PrepareMessage* temp = _impl_.msg_.prepare_;
+    _impl_.msg_.prepare_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void ToServerMessage::unsafe_arena_set_allocated_prepare(::dsnet::transaction::spanner::proto::PrepareMessage* prepare) {
+  clear_msg();
+  if (prepare) {
+    set_has_prepare();
+    _impl_.msg_.prepare_ = prepare;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:dsnet.transaction.spanner.proto.ToServerMessage.prepare)
+}
+inline ::dsnet::transaction::spanner::proto::PrepareMessage* ToServerMessage::_internal_mutable_prepare() {
+  if (!_internal_has_prepare()) {
+    clear_msg();
+    set_has_prepare();
+    _impl_.msg_.prepare_ = CreateMaybeMessage< ::dsnet::transaction::spanner::proto::PrepareMessage >(GetArenaForAllocation());
+  }
+  return _impl_.msg_.prepare_;
+}
+inline ::dsnet::transaction::spanner::proto::PrepareMessage* ToServerMessage::mutable_prepare() {
+  ::dsnet::transaction::spanner::proto::PrepareMessage* _msg = _internal_mutable_prepare();
+  // @@protoc_insertion_point(field_mutable:dsnet.transaction.spanner.proto.ToServerMessage.prepare)
+  return _msg;
+}
+
+// .dsnet.transaction.spanner.proto.PrepareOKMessage prepare_ok = 3;
+inline bool ToServerMessage::_internal_has_prepare_ok() const {
+  return msg_case() == kPrepareOk;
+}
+inline bool ToServerMessage::has_prepare_ok() const {
+  return _internal_has_prepare_ok();
+}
+inline void ToServerMessage::set_has_prepare_ok() {
+  _impl_._oneof_case_[0] = kPrepareOk;
+}
+inline void ToServerMessage::clear_prepare_ok() {
+  if (_internal_has_prepare_ok()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.msg_.prepare_ok_;
+    }
+    clear_has_msg();
+  }
+}
+inline ::dsnet::transaction::spanner::proto::PrepareOKMessage* ToServerMessage::release_prepare_ok() {
+  // @@protoc_insertion_point(field_release:dsnet.transaction.spanner.proto.ToServerMessage.prepare_ok)
+  if (_internal_has_prepare_ok()) {
+    clear_has_msg();
+    ::dsnet::transaction::spanner::proto::PrepareOKMessage* temp = _impl_.msg_.prepare_ok_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.msg_.prepare_ok_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::dsnet::transaction::spanner::proto::PrepareOKMessage& ToServerMessage::_internal_prepare_ok() const {
+  return _internal_has_prepare_ok()
+      ? *_impl_.msg_.prepare_ok_
+      : reinterpret_cast< ::dsnet::transaction::spanner::proto::PrepareOKMessage&>(::dsnet::transaction::spanner::proto::_PrepareOKMessage_default_instance_);
+}
+inline const ::dsnet::transaction::spanner::proto::PrepareOKMessage& ToServerMessage::prepare_ok() const {
+  // @@protoc_insertion_point(field_get:dsnet.transaction.spanner.proto.ToServerMessage.prepare_ok)
+  return _internal_prepare_ok();
+}
+inline ::dsnet::transaction::spanner::proto::PrepareOKMessage* ToServerMessage::unsafe_arena_release_prepare_ok() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:dsnet.transaction.spanner.proto.ToServerMessage.prepare_ok)
+  if (_internal_has_prepare_ok()) {
+    clear_has_msg();
+    ::dsnet::transaction::spanner::proto::PrepareOKMessage* temp = _impl_.msg_.prepare_ok_;
+    _impl_.msg_.prepare_ok_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void ToServerMessage::unsafe_arena_set_allocated_prepare_ok(::dsnet::transaction::spanner::proto::PrepareOKMessage* prepare_ok) {
+  clear_msg();
+  if (prepare_ok) {
+    set_has_prepare_ok();
+    _impl_.msg_.prepare_ok_ = prepare_ok;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:dsnet.transaction.spanner.proto.ToServerMessage.prepare_ok)
+}
+inline ::dsnet::transaction::spanner::proto::PrepareOKMessage* ToServerMessage::_internal_mutable_prepare_ok() {
+  if (!_internal_has_prepare_ok()) {
+    clear_msg();
+    set_has_prepare_ok();
+    _impl_.msg_.prepare_ok_ = CreateMaybeMessage< ::dsnet::transaction::spanner::proto::PrepareOKMessage >(GetArenaForAllocation());
+  }
+  return _impl_.msg_.prepare_ok_;
+}
+inline ::dsnet::transaction::spanner::proto::PrepareOKMessage* ToServerMessage::mutable_prepare_ok() {
+  ::dsnet::transaction::spanner::proto::PrepareOKMessage* _msg = _internal_mutable_prepare_ok();
+  // @@protoc_insertion_point(field_mutable:dsnet.transaction.spanner.proto.ToServerMessage.prepare_ok)
+  return _msg;
+}
+
+// .dsnet.transaction.spanner.proto.CommitMessage commit = 4;
+inline bool ToServerMessage::_internal_has_commit() const {
+  return msg_case() == kCommit;
+}
+inline bool ToServerMessage::has_commit() const {
+  return _internal_has_commit();
+}
+inline void ToServerMessage::set_has_commit() {
+  _impl_._oneof_case_[0] = kCommit;
+}
+inline void ToServerMessage::clear_commit() {
+  if (_internal_has_commit()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.msg_.commit_;
+    }
+    clear_has_msg();
+  }
+}
+inline ::dsnet::transaction::spanner::proto::CommitMessage* ToServerMessage::release_commit() {
+  // @@protoc_insertion_point(field_release:dsnet.transaction.spanner.proto.ToServerMessage.commit)
+  if (_internal_has_commit()) {
+    clear_has_msg();
+    ::dsnet::transaction::spanner::proto::CommitMessage* temp = _impl_.msg_.commit_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.msg_.commit_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::dsnet::transaction::spanner::proto::CommitMessage& ToServerMessage::_internal_commit() const {
+  return _internal_has_commit()
+      ? *_impl_.msg_.commit_
+      : reinterpret_cast< ::dsnet::transaction::spanner::proto::CommitMessage&>(::dsnet::transaction::spanner::proto::_CommitMessage_default_instance_);
+}
+inline const ::dsnet::transaction::spanner::proto::CommitMessage& ToServerMessage::commit() const {
+  // @@protoc_insertion_point(field_get:dsnet.transaction.spanner.proto.ToServerMessage.commit)
+  return _internal_commit();
+}
+inline ::dsnet::transaction::spanner::proto::CommitMessage* ToServerMessage::unsafe_arena_release_commit() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:dsnet.transaction.spanner.proto.ToServerMessage.commit)
+  if (_internal_has_commit()) {
+    clear_has_msg();
+    ::dsnet::transaction::spanner::proto::CommitMessage* temp = _impl_.msg_.commit_;
+    _impl_.msg_.commit_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void ToServerMessage::unsafe_arena_set_allocated_commit(::dsnet::transaction::spanner::proto::CommitMessage* commit) {
+  clear_msg();
+  if (commit) {
+    set_has_commit();
+    _impl_.msg_.commit_ = commit;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:dsnet.transaction.spanner.proto.ToServerMessage.commit)
+}
+inline ::dsnet::transaction::spanner::proto::CommitMessage* ToServerMessage::_internal_mutable_commit() {
+  if (!_internal_has_commit()) {
+    clear_msg();
+    set_has_commit();
+    _impl_.msg_.commit_ = CreateMaybeMessage< ::dsnet::transaction::spanner::proto::CommitMessage >(GetArenaForAllocation());
+  }
+  return _impl_.msg_.commit_;
+}
+inline ::dsnet::transaction::spanner::proto::CommitMessage* ToServerMessage::mutable_commit() {
+  ::dsnet::transaction::spanner::proto::CommitMessage* _msg = _internal_mutable_commit();
+  // @@protoc_insertion_point(field_mutable:dsnet.transaction.spanner.proto.ToServerMessage.commit)
+  return _msg;
+}
+
+inline bool ToServerMessage::has_msg() const {
+  return msg_case() != MSG_NOT_SET;
+}
+inline void ToServerMessage::clear_has_msg() {
+  _impl_._oneof_case_[0] = MSG_NOT_SET;
+}
+inline ToServerMessage::MsgCase ToServerMessage::msg_case() const {
+  return ToServerMessage::MsgCase(_impl_._oneof_case_[0]);
+}
+#ifdef __GNUC__
+  #pragma GCC diagnostic pop
+#endif  // __GNUC__
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+
+// @@protoc_insertion_point(namespace_scope)
+
+}  // namespace proto
+}  // namespace spanner
+}  // namespace transaction
+}  // namespace dsnet
+
+PROTOBUF_NAMESPACE_OPEN
+
+template <> struct is_proto_enum< ::dsnet::transaction::spanner::proto::ReplyType> : ::std::true_type {};
+template <>
+inline const EnumDescriptor* GetEnumDescriptor< ::dsnet::transaction::spanner::proto::ReplyType>() {
+  return ::dsnet::transaction::spanner::proto::ReplyType_descriptor();
+}
+template <> struct is_proto_enum< ::dsnet::transaction::spanner::proto::RequestType> : ::std::true_type {};
+template <>
+inline const EnumDescriptor* GetEnumDescriptor< ::dsnet::transaction::spanner::proto::RequestType>() {
+  return ::dsnet::transaction::spanner::proto::RequestType_descriptor();
+}
+
+PROTOBUF_NAMESPACE_CLOSE
+
+// @@protoc_insertion_point(global_scope)
+
+#include <google/protobuf/port_undef.inc>
+#endif  // GOOGLE_PROTOBUF_INCLUDED_GOOGLE_PROTOBUF_INCLUDED_transaction_2fspanner_2fspanner_2dproto_2eproto
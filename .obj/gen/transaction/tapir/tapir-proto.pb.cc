@@ -0,0 +1,4403 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: transaction/tapir/tapir-proto.proto
+
+#include "transaction/tapir/tapir-proto.pb.h"
+
+#include <algorithm>
+
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/extension_set.h>
+#include <google/protobuf/wire_format_lite.h>
+#include <google/protobuf/descriptor.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/reflection_ops.h>
+#include <google/protobuf/wire_format.h>
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+
+PROTOBUF_PRAGMA_INIT_SEG
+
+namespace _pb = ::PROTOBUF_NAMESPACE_ID;
+namespace _pbi = _pb::internal;
+
+namespace dsnet {
+namespace transaction {
+namespace tapir {
+namespace proto {
+PROTOBUF_CONSTEXPR TimestampMessage::TimestampMessage(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.id_)*/uint64_t{0u}
+  , /*decltype(_impl_.timestamp_)*/uint64_t{0u}} {}
+struct TimestampMessageDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR TimestampMessageDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~TimestampMessageDefaultTypeInternal() {}
+  union {
+    TimestampMessage _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 TimestampMessageDefaultTypeInternal _TimestampMessage_default_instance_;
+PROTOBUF_CONSTEXPR Transaction::Transaction(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.txn_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.txnid_)*/uint64_t{0u}
+  , /*decltype(_impl_.op_)*/0} {}
+struct TransactionDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR TransactionDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~TransactionDefaultTypeInternal() {}
+  union {
+    Transaction _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 TransactionDefaultTypeInternal _Transaction_default_instance_;
+PROTOBUF_CONSTEXPR ReplyMessage::ReplyMessage(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.reply_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.status_)*/0} {}
+struct ReplyMessageDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ReplyMessageDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ReplyMessageDefaultTypeInternal() {}
+  union {
+    ReplyMessage _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ReplyMessageDefaultTypeInternal _ReplyMessage_default_instance_;
+PROTOBUF_CONSTEXPR OpID::OpID(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.clientid_)*/uint64_t{0u}
+  , /*decltype(_impl_.clientreqid_)*/uint64_t{0u}} {}
+struct OpIDDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR OpIDDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~OpIDDefaultTypeInternal() {}
+  union {
+    OpID _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 OpIDDefaultTypeInternal _OpID_default_instance_;
+PROTOBUF_CONSTEXPR ToServerMessage::ToServerMessage(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.msg_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_._oneof_case_)*/{}} {}
+struct ToServerMessageDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ToServerMessageDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ToServerMessageDefaultTypeInternal() {}
+  union {
+    ToServerMessage _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ToServerMessageDefaultTypeInternal _ToServerMessage_default_instance_;
+PROTOBUF_CONSTEXPR ProposeInconsistentMessage::ProposeInconsistentMessage(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.req_)*/nullptr} {}
+struct ProposeInconsistentMessageDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ProposeInconsistentMessageDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ProposeInconsistentMessageDefaultTypeInternal() {}
+  union {
+    ProposeInconsistentMessage _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ProposeInconsistentMessageDefaultTypeInternal _ProposeInconsistentMessage_default_instance_;
+PROTOBUF_CONSTEXPR FinalizeInconsistentMessage::FinalizeInconsistentMessage(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.opid_)*/nullptr} {}
+struct FinalizeInconsistentMessageDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR FinalizeInconsistentMessageDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~FinalizeInconsistentMessageDefaultTypeInternal() {}
+  union {
+    FinalizeInconsistentMessage _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 FinalizeInconsistentMessageDefaultTypeInternal _FinalizeInconsistentMessage_default_instance_;
+PROTOBUF_CONSTEXPR ProposeConsensusMessage::ProposeConsensusMessage(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.req_)*/nullptr} {}
+struct ProposeConsensusMessageDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ProposeConsensusMessageDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ProposeConsensusMessageDefaultTypeInternal() {}
+  union {
+    ProposeConsensusMessage _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ProposeConsensusMessageDefaultTypeInternal _ProposeConsensusMessage_default_instance_;
+PROTOBUF_CONSTEXPR FinalizeConsensusMessage::FinalizeConsensusMessage(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.result_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.opid_)*/nullptr} {}
+struct FinalizeConsensusMessageDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR FinalizeConsensusMessageDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~FinalizeConsensusMessageDefaultTypeInternal() {}
+  union {
+    FinalizeConsensusMessage _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 FinalizeConsensusMessageDefaultTypeInternal _FinalizeConsensusMessage_default_instance_;
+PROTOBUF_CONSTEXPR ToClientMessage::ToClientMessage(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.msg_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_._oneof_case_)*/{}} {}
+struct ToClientMessageDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ToClientMessageDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ToClientMessageDefaultTypeInternal() {}
+  union {
+    ToClientMessage _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ToClientMessageDefaultTypeInternal _ToClientMessage_default_instance_;
+PROTOBUF_CONSTEXPR ReplyInconsistentMessage::ReplyInconsistentMessage(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.opid_)*/nullptr
+  , /*decltype(_impl_.view_)*/uint64_t{0u}
+  , /*decltype(_impl_.replicaidx_)*/0u} {}
+struct ReplyInconsistentMessageDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ReplyInconsistentMessageDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ReplyInconsistentMessageDefaultTypeInternal() {}
+  union {
+    ReplyInconsistentMessage _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ReplyInconsistentMessageDefaultTypeInternal _ReplyInconsistentMessage_default_instance_;
+PROTOBUF_CONSTEXPR ReplyConsensusMessage::ReplyConsensusMessage(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.result_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.opid_)*/nullptr
+  , /*decltype(_impl_.view_)*/uint64_t{0u}
+  , /*decltype(_impl_.replicaidx_)*/0u} {}
+struct ReplyConsensusMessageDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ReplyConsensusMessageDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ReplyConsensusMessageDefaultTypeInternal() {}
+  union {
+    ReplyConsensusMessage _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ReplyConsensusMessageDefaultTypeInternal _ReplyConsensusMessage_default_instance_;
+PROTOBUF_CONSTEXPR ConfirmMessage::ConfirmMessage(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.opid_)*/nullptr
+  , /*decltype(_impl_.view_)*/uint64_t{0u}
+  , /*decltype(_impl_.replicaidx_)*/0u} {}
+struct ConfirmMessageDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ConfirmMessageDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ConfirmMessageDefaultTypeInternal() {}
+  union {
+    ConfirmMessage _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ConfirmMessageDefaultTypeInternal _ConfirmMessage_default_instance_;
+}  // namespace proto
+}  // namespace tapir
+}  // namespace transaction
+}  // namespace dsnet
+static ::_pb::Metadata file_level_metadata_transaction_2ftapir_2ftapir_2dproto_2eproto[13];
+static const ::_pb::EnumDescriptor* file_level_enum_descriptors_transaction_2ftapir_2ftapir_2dproto_2eproto[2];
+static constexpr ::_pb::ServiceDescriptor const** file_level_service_descriptors_transaction_2ftapir_2ftapir_2dproto_2eproto = nullptr;
+
+const uint32_t TableStruct_transaction_2ftapir_2ftapir_2dproto_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  PROTOBUF_FIELD_OFFSET(::dsnet::transaction::tapir::proto::TimestampMessage, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::transaction::tapir::proto::TimestampMessage, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::dsnet::transaction::tapir::proto::TimestampMessage, _impl_.id_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::transaction::tapir::proto::TimestampMessage, _impl_.timestamp_),
+  0,
+  1,
+  PROTOBUF_FIELD_OFFSET(::dsnet::transaction::tapir::proto::Transaction, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::transaction::tapir::proto::Transaction, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::dsnet::transaction::tapir::proto::Transaction, _impl_.txnid_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::transaction::tapir::proto::Transaction, _impl_.op_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::transaction::tapir::proto::Transaction, _impl_.txn_),
+  1,
+  2,
+  0,
+  PROTOBUF_FIELD_OFFSET(::dsnet::transaction::tapir::proto::ReplyMessage, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::transaction::tapir::proto::ReplyMessage, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::dsnet::transaction::tapir::proto::ReplyMessage, _impl_.status_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::transaction::tapir::proto::ReplyMessage, _impl_.reply_),
+  1,
+  0,
+  PROTOBUF_FIELD_OFFSET(::dsnet::transaction::tapir::proto::OpID, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::transaction::tapir::proto::OpID, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::dsnet::transaction::tapir::proto::OpID, _impl_.clientid_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::transaction::tapir::proto::OpID, _impl_.clientreqid_),
+  0,
+  1,
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::dsnet::transaction::tapir::proto::ToServerMessage, _internal_metadata_),
+  ~0u,  // no _extensions_
+  PROTOBUF_FIELD_OFFSET(::dsnet::transaction::tapir::proto::ToServerMessage, _impl_._oneof_case_[0]),
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  PROTOBUF_FIELD_OFFSET(::dsnet::transaction::tapir::proto::ToServerMessage, _impl_.msg_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::transaction::tapir::proto::ProposeInconsistentMessage, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::transaction::tapir::proto::ProposeInconsistentMessage, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::dsnet::transaction::tapir::proto::ProposeInconsistentMessage, _impl_.req_),
+  0,
+  PROTOBUF_FIELD_OFFSET(::dsnet::transaction::tapir::proto::FinalizeInconsistentMessage, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::transaction::tapir::proto::FinalizeInconsistentMessage, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::dsnet::transaction::tapir::proto::FinalizeInconsistentMessage, _impl_.opid_),
+  0,
+  PROTOBUF_FIELD_OFFSET(::dsnet::transaction::tapir::proto::ProposeConsensusMessage, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::transaction::tapir::proto::ProposeConsensusMessage, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::dsnet::transaction::tapir::proto::ProposeConsensusMessage, _impl_.req_),
+  0,
+  PROTOBUF_FIELD_OFFSET(::dsnet::transaction::tapir::proto::FinalizeConsensusMessage, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::transaction::tapir::proto::FinalizeConsensusMessage, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::dsnet::transaction::tapir::proto::FinalizeConsensusMessage, _impl_.opid_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::transaction::tapir::proto::FinalizeConsensusMessage, _impl_.result_),
+  1,
+  0,
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::dsnet::transaction::tapir::proto::ToClientMessage, _internal_metadata_),
+  ~0u,  // no _extensions_
+  PROTOBUF_FIELD_OFFSET(::dsnet::transaction::tapir::proto::ToClientMessage, _impl_._oneof_case_[0]),
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  PROTOBUF_FIELD_OFFSET(::dsnet::transaction::tapir::proto::ToClientMessage, _impl_.msg_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::transaction::tapir::proto::ReplyInconsistentMessage, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::transaction::tapir::proto::ReplyInconsistentMessage, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::dsnet::transaction::tapir::proto::ReplyInconsistentMessage, _impl_.view_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::transaction::tapir::proto::ReplyInconsistentMessage, _impl_.replicaidx_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::transaction::tapir::proto::ReplyInconsistentMessage, _impl_.opid_),
+  1,
+  2,
+  0,
+  PROTOBUF_FIELD_OFFSET(::dsnet::transaction::tapir::proto::ReplyConsensusMessage, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::transaction::tapir::proto::ReplyConsensusMessage, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::dsnet::transaction::tapir::proto::ReplyConsensusMessage, _impl_.view_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::transaction::tapir::proto::ReplyConsensusMessage, _impl_.replicaidx_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::transaction::tapir::proto::ReplyConsensusMessage, _impl_.opid_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::transaction::tapir::proto::ReplyConsensusMessage, _impl_.result_),
+  2,
+  3,
+  1,
+  0,
+  PROTOBUF_FIELD_OFFSET(::dsnet::transaction::tapir::proto::ConfirmMessage, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::transaction::tapir::proto::ConfirmMessage, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::dsnet::transaction::tapir::proto::ConfirmMessage, _impl_.view_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::transaction::tapir::proto::ConfirmMessage, _impl_.replicaidx_),
+  PROTOBUF_FIELD_OFFSET(::dsnet::transaction::tapir::proto::ConfirmMessage, _impl_.opid_),
+  1,
+  2,
+  0,
+};
+static const ::_pbi::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  { 0, 8, -1, sizeof(::dsnet::transaction::tapir::proto::TimestampMessage)},
+  { 10, 19, -1, sizeof(::dsnet::transaction::tapir::proto::Transaction)},
+  { 22, 30, -1, sizeof(::dsnet::transaction::tapir::proto::ReplyMessage)},
+  { 32, 40, -1, sizeof(::dsnet::transaction::tapir::proto::OpID)},
+  { 42, -1, -1, sizeof(::dsnet::transaction::tapir::proto::ToServerMessage)},
+  { 53, 60, -1, sizeof(::dsnet::transaction::tapir::proto::ProposeInconsistentMessage)},
+  { 61, 68, -1, sizeof(::dsnet::transaction::tapir::proto::FinalizeInconsistentMessage)},
+  { 69, 76, -1, sizeof(::dsnet::transaction::tapir::proto::ProposeConsensusMessage)},
+  { 77, 85, -1, sizeof(::dsnet::transaction::tapir::proto::FinalizeConsensusMessage)},
+  { 87, -1, -1, sizeof(::dsnet::transaction::tapir::proto::ToClientMessage)},
+  { 97, 106, -1, sizeof(::dsnet::transaction::tapir::proto::ReplyInconsistentMessage)},
+  { 109, 119, -1, sizeof(::dsnet::transaction::tapir::proto::ReplyConsensusMessage)},
+  { 123, 132, -1, sizeof(::dsnet::transaction::tapir::proto::ConfirmMessage)},
+};
+
+static const ::_pb::Message* const file_default_instances[] = {
+  &::dsnet::transaction::tapir::proto::_TimestampMessage_default_instance_._instance,
+  &::dsnet::transaction::tapir::proto::_Transaction_default_instance_._instance,
+  &::dsnet::transaction::tapir::proto::_ReplyMessage_default_instance_._instance,
+  &::dsnet::transaction::tapir::proto::_OpID_default_instance_._instance,
+  &::dsnet::transaction::tapir::proto::_ToServerMessage_default_instance_._instance,
+  &::dsnet::transaction::tapir::proto::_ProposeInconsistentMessage_default_instance_._instance,
+  &::dsnet::transaction::tapir::proto::_FinalizeInconsistentMessage_default_instance_._instance,
+  &::dsnet::transaction::tapir::proto::_ProposeConsensusMessage_default_instance_._instance,
+  &::dsnet::transaction::tapir::proto::_FinalizeConsensusMessage_default_instance_._instance,
+  &::dsnet::transaction::tapir::proto::_ToClientMessage_default_instance_._instance,
+  &::dsnet::transaction::tapir::proto::_ReplyInconsistentMessage_default_instance_._instance,
+  &::dsnet::transaction::tapir::proto::_ReplyConsensusMessage_default_instance_._instance,
+  &::dsnet::transaction::tapir::proto::_ConfirmMessage_default_instance_._instance,
+};
+
+const char descriptor_table_protodef_transaction_2ftapir_2ftapir_2dproto_2eproto[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) =
+  "\n#transaction/tapir/tapir-proto.proto\022\035d"
+  "snet.transaction.tapir.proto\032\024common/req"
+  "uest.proto\"1\n\020TimestampMessage\022\n\n\002id\030\001 \002"
+  "(\004\022\021\n\ttimestamp\030\002 \002(\004\"\251\001\n\013Transaction\022\r\n"
+  "\005txnid\030\001 \002(\004\022@\n\002op\030\002 \002(\01624.dsnet.transac"
+  "tion.tapir.proto.Transaction.Operation\022\013"
+  "\n\003txn\030\003 \002(\014\"<\n\tOperation\022\013\n\007UNKNOWN\020\000\022\013\n"
+  "\007PREPARE\020\001\022\n\n\006COMMIT\020\002\022\t\n\005ABORT\020\003\"\212\001\n\014Re"
+  "plyMessage\022B\n\006status\030\001 \002(\01622.dsnet.trans"
+  "action.tapir.proto.ReplyMessage.Status\022\r"
+  "\n\005reply\030\002 \001(\014\"\'\n\006Status\022\006\n\002OK\020\000\022\n\n\006FAILE"
+  "D\020\001\022\t\n\005RETRY\020\002\"-\n\004OpID\022\020\n\010clientid\030\001 \002(\004"
+  "\022\023\n\013clientreqid\030\002 \002(\004\"\374\002\n\017ToServerMessag"
+  "e\022Y\n\024propose_inconsistent\030\001 \001(\01329.dsnet."
+  "transaction.tapir.proto.ProposeInconsist"
+  "entMessageH\000\022[\n\025finalize_inconsistent\030\002 "
+  "\001(\0132:.dsnet.transaction.tapir.proto.Fina"
+  "lizeInconsistentMessageH\000\022S\n\021propose_con"
+  "sensus\030\003 \001(\01326.dsnet.transaction.tapir.p"
+  "roto.ProposeConsensusMessageH\000\022U\n\022finali"
+  "ze_consensus\030\004 \001(\01327.dsnet.transaction.t"
+  "apir.proto.FinalizeConsensusMessageH\000B\005\n"
+  "\003msg\"9\n\032ProposeInconsistentMessage\022\033\n\003re"
+  "q\030\001 \002(\0132\016.dsnet.Request\"P\n\033FinalizeIncon"
+  "sistentMessage\0221\n\004opid\030\001 \002(\0132#.dsnet.tra"
+  "nsaction.tapir.proto.OpID\"6\n\027ProposeCons"
+  "ensusMessage\022\033\n\003req\030\001 \002(\0132\016.dsnet.Reques"
+  "t\"]\n\030FinalizeConsensusMessage\0221\n\004opid\030\001 "
+  "\002(\0132#.dsnet.transaction.tapir.proto.OpID"
+  "\022\016\n\006result\030\002 \002(\014\"\202\002\n\017ToClientMessage\022U\n\022"
+  "inconsistent_reply\030\001 \001(\01327.dsnet.transac"
+  "tion.tapir.proto.ReplyInconsistentMessag"
+  "eH\000\022O\n\017consensus_reply\030\002 \001(\01324.dsnet.tra"
+  "nsaction.tapir.proto.ReplyConsensusMessa"
+  "geH\000\022@\n\007confirm\030\003 \001(\0132-.dsnet.transactio"
+  "n.tapir.proto.ConfirmMessageH\000B\005\n\003msg\"o\n"
+  "\030ReplyInconsistentMessage\022\014\n\004view\030\001 \002(\004\022"
+  "\022\n\nreplicaIdx\030\002 \002(\r\0221\n\004opid\030\003 \002(\0132#.dsne"
+  "t.transaction.tapir.proto.OpID\"|\n\025ReplyC"
+  "onsensusMessage\022\014\n\004view\030\001 \002(\004\022\022\n\nreplica"
+  "Idx\030\002 \002(\r\0221\n\004opid\030\003 \002(\0132#.dsnet.transact"
+  "ion.tapir.proto.OpID\022\016\n\006result\030\004 \002(\014\"e\n\016"
+  "ConfirmMessage\022\014\n\004view\030\001 \002(\004\022\022\n\nreplicaI"
+  "dx\030\002 \002(\r\0221\n\004opid\030\003 \002(\0132#.dsnet.transacti"
+  "on.tapir.proto.OpID"
+  ;
+static const ::_pbi::DescriptorTable* const descriptor_table_transaction_2ftapir_2ftapir_2dproto_2eproto_deps[1] = {
+  &::descriptor_table_common_2frequest_2eproto,
+};
+static ::_pbi::once_flag descriptor_table_transaction_2ftapir_2ftapir_2dproto_2eproto_once;
+const ::_pbi::DescriptorTable descriptor_table_transaction_2ftapir_2ftapir_2dproto_2eproto = {
+    false, false, 1779, descriptor_table_protodef_transaction_2ftapir_2ftapir_2dproto_2eproto,
+    "transaction/tapir/tapir-proto.proto",
+    &descriptor_table_transaction_2ftapir_2ftapir_2dproto_2eproto_once, descriptor_table_transaction_2ftapir_2ftapir_2dproto_2eproto_deps, 1, 13,
+    schemas, file_default_instances, TableStruct_transaction_2ftapir_2ftapir_2dproto_2eproto::offsets,
+    file_level_metadata_transaction_2ftapir_2ftapir_2dproto_2eproto, file_level_enum_descriptors_transaction_2ftapir_2ftapir_2dproto_2eproto,
+    file_level_service_descriptors_transaction_2ftapir_2ftapir_2dproto_2eproto,
+};
+PROTOBUF_ATTRIBUTE_WEAK const ::_pbi::DescriptorTable* descriptor_table_transaction_2ftapir_2ftapir_2dproto_2eproto_getter() {
+  return &descriptor_table_transaction_2ftapir_2ftapir_2dproto_2eproto;
+}
+
+// Force running AddDescriptors() at dynamic initialization time.
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 static ::_pbi::AddDescriptorsRunner dynamic_init_dummy_transaction_2ftapir_2ftapir_2dproto_2eproto(&descriptor_table_transaction_2ftapir_2ftapir_2dproto_2eproto);
+namespace dsnet {
+namespace transaction {
+namespace tapir {
+namespace proto {
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* Transaction_Operation_descriptor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_transaction_2ftapir_2ftapir_2dproto_2eproto);
+  return file_level_enum_descriptors_transaction_2ftapir_2ftapir_2dproto_2eproto[0];
+}
+bool Transaction_Operation_IsValid(int value) {
+  switch (value) {
+    case 0:
+    case 1:
+    case 2:
+    case 3:
+      return true;
+    default:
+      return false;
+  }
+}
+
+#if (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
+constexpr Transaction_Operation Transaction::UNKNOWN;
+constexpr Transaction_Operation Transaction::PREPARE;
+constexpr Transaction_Operation Transaction::COMMIT;
+constexpr Transaction_Operation Transaction::ABORT;
+constexpr Transaction_Operation Transaction::Operation_MIN;
+constexpr Transaction_Operation Transaction::Operation_MAX;
+constexpr int Transaction::Operation_ARRAYSIZE;
+#endif  // (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* ReplyMessage_Status_descriptor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_transaction_2ftapir_2ftapir_2dproto_2eproto);
+  return file_level_enum_descriptors_transaction_2ftapir_2ftapir_2dproto_2eproto[1];
+}
+bool ReplyMessage_Status_IsValid(int value) {
+  switch (value) {
+    case 0:
+    case 1:
+    case 2:
+      return true;
+    default:
+      return false;
+  }
+}
+
+#if (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
+constexpr ReplyMessage_Status ReplyMessage::OK;
+constexpr ReplyMessage_Status ReplyMessage::FAILED;
+constexpr ReplyMessage_Status ReplyMessage::RETRY;
+constexpr ReplyMessage_Status ReplyMessage::Status_MIN;
+constexpr ReplyMessage_Status ReplyMessage::Status_MAX;
+constexpr int ReplyMessage::Status_ARRAYSIZE;
+#endif  // (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
+
+// ===================================================================
+
+class TimestampMessage::_Internal {
+ public:
+  using HasBits = decltype(std::declval<TimestampMessage>()._impl_._has_bits_);
+  static void set_has_id(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_timestamp(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000003) ^ 0x00000003) != 0;
+  }
+};
+
+TimestampMessage::TimestampMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:dsnet.transaction.tapir.proto.TimestampMessage)
+}
+TimestampMessage::TimestampMessage(const TimestampMessage& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  TimestampMessage* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.id_){}
+    , decltype(_impl_.timestamp_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.id_, &from._impl_.id_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.timestamp_) -
+    reinterpret_cast<char*>(&_impl_.id_)) + sizeof(_impl_.timestamp_));
+  // @@protoc_insertion_point(copy_constructor:dsnet.transaction.tapir.proto.TimestampMessage)
+}
+
+inline void TimestampMessage::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.id_){uint64_t{0u}}
+    , decltype(_impl_.timestamp_){uint64_t{0u}}
+  };
+}
+
+TimestampMessage::~TimestampMessage() {
+  // @@protoc_insertion_point(destructor:dsnet.transaction.tapir.proto.TimestampMessage)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void TimestampMessage::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void TimestampMessage::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void TimestampMessage::Clear() {
+// @@protoc_insertion_point(message_clear_start:dsnet.transaction.tapir.proto.TimestampMessage)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    ::memset(&_impl_.id_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.timestamp_) -
+        reinterpret_cast<char*>(&_impl_.id_)) + sizeof(_impl_.timestamp_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* TimestampMessage::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required uint64 id = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_id(&has_bits);
+          _impl_.id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required uint64 timestamp = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _Internal::set_has_timestamp(&has_bits);
+          _impl_.timestamp_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* TimestampMessage::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:dsnet.transaction.tapir.proto.TimestampMessage)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required uint64 id = 1;
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(1, this->_internal_id(), target);
+  }
+
+  // required uint64 timestamp = 2;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(2, this->_internal_timestamp(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:dsnet.transaction.tapir.proto.TimestampMessage)
+  return target;
+}
+
+size_t TimestampMessage::RequiredFieldsByteSizeFallback() const {
+// @@protoc_insertion_point(required_fields_byte_size_fallback_start:dsnet.transaction.tapir.proto.TimestampMessage)
+  size_t total_size = 0;
+
+  if (_internal_has_id()) {
+    // required uint64 id = 1;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_id());
+  }
+
+  if (_internal_has_timestamp()) {
+    // required uint64 timestamp = 2;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_timestamp());
+  }
+
+  return total_size;
+}
+size_t TimestampMessage::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:dsnet.transaction.tapir.proto.TimestampMessage)
+  size_t total_size = 0;
+
+  if (((_impl_._has_bits_[0] & 0x00000003) ^ 0x00000003) == 0) {  // All required fields are present.
+    // required uint64 id = 1;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_id());
+
+    // required uint64 timestamp = 2;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_timestamp());
+
+  } else {
+    total_size += RequiredFieldsByteSizeFallback();
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData TimestampMessage::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    TimestampMessage::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*TimestampMessage::GetClassData() const { return &_class_data_; }
+
+
+void TimestampMessage::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<TimestampMessage*>(&to_msg);
+  auto& from = static_cast<const TimestampMessage&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:dsnet.transaction.tapir.proto.TimestampMessage)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_impl_.id_ = from._impl_.id_;
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.timestamp_ = from._impl_.timestamp_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void TimestampMessage::CopyFrom(const TimestampMessage& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:dsnet.transaction.tapir.proto.TimestampMessage)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool TimestampMessage::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  return true;
+}
+
+void TimestampMessage::InternalSwap(TimestampMessage* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(TimestampMessage, _impl_.timestamp_)
+      + sizeof(TimestampMessage::_impl_.timestamp_)
+      - PROTOBUF_FIELD_OFFSET(TimestampMessage, _impl_.id_)>(
+          reinterpret_cast<char*>(&_impl_.id_),
+          reinterpret_cast<char*>(&other->_impl_.id_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata TimestampMessage::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_transaction_2ftapir_2ftapir_2dproto_2eproto_getter, &descriptor_table_transaction_2ftapir_2ftapir_2dproto_2eproto_once,
+      file_level_metadata_transaction_2ftapir_2ftapir_2dproto_2eproto[0]);
+}
+
+// ===================================================================
+
+class Transaction::_Internal {
+ public:
+  using HasBits = decltype(std::declval<Transaction>()._impl_._has_bits_);
+  static void set_has_txnid(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_op(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static void set_has_txn(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000007) ^ 0x00000007) != 0;
+  }
+};
+
+Transaction::Transaction(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:dsnet.transaction.tapir.proto.Transaction)
+}
+Transaction::Transaction(const Transaction& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  Transaction* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.txn_){}
+    , decltype(_impl_.txnid_){}
+    , decltype(_impl_.op_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.txn_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.txn_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_txn()) {
+    _this->_impl_.txn_.Set(from._internal_txn(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.txnid_, &from._impl_.txnid_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.op_) -
+    reinterpret_cast<char*>(&_impl_.txnid_)) + sizeof(_impl_.op_));
+  // @@protoc_insertion_point(copy_constructor:dsnet.transaction.tapir.proto.Transaction)
+}
+
+inline void Transaction::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.txn_){}
+    , decltype(_impl_.txnid_){uint64_t{0u}}
+    , decltype(_impl_.op_){0}
+  };
+  _impl_.txn_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.txn_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+Transaction::~Transaction() {
+  // @@protoc_insertion_point(destructor:dsnet.transaction.tapir.proto.Transaction)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void Transaction::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.txn_.Destroy();
+}
+
+void Transaction::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void Transaction::Clear() {
+// @@protoc_insertion_point(message_clear_start:dsnet.transaction.tapir.proto.Transaction)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    _impl_.txn_.ClearNonDefaultToEmpty();
+  }
+  if (cached_has_bits & 0x00000006u) {
+    ::memset(&_impl_.txnid_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.op_) -
+        reinterpret_cast<char*>(&_impl_.txnid_)) + sizeof(_impl_.op_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* Transaction::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required uint64 txnid = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_txnid(&has_bits);
+          _impl_.txnid_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required .dsnet.transaction.tapir.proto.Transaction.Operation op = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          if (PROTOBUF_PREDICT_TRUE(::dsnet::transaction::tapir::proto::Transaction_Operation_IsValid(val))) {
+            _internal_set_op(static_cast<::dsnet::transaction::tapir::proto::Transaction_Operation>(val));
+          } else {
+            ::PROTOBUF_NAMESPACE_ID::internal::WriteVarint(2, val, mutable_unknown_fields());
+          }
+        } else
+          goto handle_unusual;
+        continue;
+      // required bytes txn = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          auto str = _internal_mutable_txn();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* Transaction::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:dsnet.transaction.tapir.proto.Transaction)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required uint64 txnid = 1;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(1, this->_internal_txnid(), target);
+  }
+
+  // required .dsnet.transaction.tapir.proto.Transaction.Operation op = 2;
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      2, this->_internal_op(), target);
+  }
+
+  // required bytes txn = 3;
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->WriteBytesMaybeAliased(
+        3, this->_internal_txn(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:dsnet.transaction.tapir.proto.Transaction)
+  return target;
+}
+
+size_t Transaction::RequiredFieldsByteSizeFallback() const {
+// @@protoc_insertion_point(required_fields_byte_size_fallback_start:dsnet.transaction.tapir.proto.Transaction)
+  size_t total_size = 0;
+
+  if (_internal_has_txn()) {
+    // required bytes txn = 3;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_txn());
+  }
+
+  if (_internal_has_txnid()) {
+    // required uint64 txnid = 1;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_txnid());
+  }
+
+  if (_internal_has_op()) {
+    // required .dsnet.transaction.tapir.proto.Transaction.Operation op = 2;
+    total_size += 1 +
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_op());
+  }
+
+  return total_size;
+}
+size_t Transaction::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:dsnet.transaction.tapir.proto.Transaction)
+  size_t total_size = 0;
+
+  if (((_impl_._has_bits_[0] & 0x00000007) ^ 0x00000007) == 0) {  // All required fields are present.
+    // required bytes txn = 3;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_txn());
+
+    // required uint64 txnid = 1;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_txnid());
+
+    // required .dsnet.transaction.tapir.proto.Transaction.Operation op = 2;
+    total_size += 1 +
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_op());
+
+  } else {
+    total_size += RequiredFieldsByteSizeFallback();
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData Transaction::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    Transaction::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*Transaction::GetClassData() const { return &_class_data_; }
+
+
+void Transaction::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<Transaction*>(&to_msg);
+  auto& from = static_cast<const Transaction&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:dsnet.transaction.tapir.proto.Transaction)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_txn(from._internal_txn());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.txnid_ = from._impl_.txnid_;
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.op_ = from._impl_.op_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void Transaction::CopyFrom(const Transaction& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:dsnet.transaction.tapir.proto.Transaction)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool Transaction::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  return true;
+}
+
+void Transaction::InternalSwap(Transaction* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.txn_, lhs_arena,
+      &other->_impl_.txn_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(Transaction, _impl_.op_)
+      + sizeof(Transaction::_impl_.op_)
+      - PROTOBUF_FIELD_OFFSET(Transaction, _impl_.txnid_)>(
+          reinterpret_cast<char*>(&_impl_.txnid_),
+          reinterpret_cast<char*>(&other->_impl_.txnid_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata Transaction::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_transaction_2ftapir_2ftapir_2dproto_2eproto_getter, &descriptor_table_transaction_2ftapir_2ftapir_2dproto_2eproto_once,
+      file_level_metadata_transaction_2ftapir_2ftapir_2dproto_2eproto[1]);
+}
+
+// ===================================================================
+
+class ReplyMessage::_Internal {
+ public:
+  using HasBits = decltype(std::declval<ReplyMessage>()._impl_._has_bits_);
+  static void set_has_status(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_reply(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000002) ^ 0x00000002) != 0;
+  }
+};
+
+ReplyMessage::ReplyMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:dsnet.transaction.tapir.proto.ReplyMessage)
+}
+ReplyMessage::ReplyMessage(const ReplyMessage& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  ReplyMessage* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.reply_){}
+    , decltype(_impl_.status_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.reply_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.reply_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_reply()) {
+    _this->_impl_.reply_.Set(from._internal_reply(), 
+      _this->GetArenaForAllocation());
+  }
+  _this->_impl_.status_ = from._impl_.status_;
+  // @@protoc_insertion_point(copy_constructor:dsnet.transaction.tapir.proto.ReplyMessage)
+}
+
+inline void ReplyMessage::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.reply_){}
+    , decltype(_impl_.status_){0}
+  };
+  _impl_.reply_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.reply_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+ReplyMessage::~ReplyMessage() {
+  // @@protoc_insertion_point(destructor:dsnet.transaction.tapir.proto.ReplyMessage)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void ReplyMessage::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.reply_.Destroy();
+}
+
+void ReplyMessage::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void ReplyMessage::Clear() {
+// @@protoc_insertion_point(message_clear_start:dsnet.transaction.tapir.proto.ReplyMessage)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    _impl_.reply_.ClearNonDefaultToEmpty();
+  }
+  _impl_.status_ = 0;
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* ReplyMessage::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required .dsnet.transaction.tapir.proto.ReplyMessage.Status status = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          if (PROTOBUF_PREDICT_TRUE(::dsnet::transaction::tapir::proto::ReplyMessage_Status_IsValid(val))) {
+            _internal_set_status(static_cast<::dsnet::transaction::tapir::proto::ReplyMessage_Status>(val));
+          } else {
+            ::PROTOBUF_NAMESPACE_ID::internal::WriteVarint(1, val, mutable_unknown_fields());
+          }
+        } else
+          goto handle_unusual;
+        continue;
+      // optional bytes reply = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_reply();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* ReplyMessage::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:dsnet.transaction.tapir.proto.ReplyMessage)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required .dsnet.transaction.tapir.proto.ReplyMessage.Status status = 1;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      1, this->_internal_status(), target);
+  }
+
+  // optional bytes reply = 2;
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->WriteBytesMaybeAliased(
+        2, this->_internal_reply(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:dsnet.transaction.tapir.proto.ReplyMessage)
+  return target;
+}
+
+size_t ReplyMessage::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:dsnet.transaction.tapir.proto.ReplyMessage)
+  size_t total_size = 0;
+
+  // required .dsnet.transaction.tapir.proto.ReplyMessage.Status status = 1;
+  if (_internal_has_status()) {
+    total_size += 1 +
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_status());
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // optional bytes reply = 2;
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_reply());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ReplyMessage::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    ReplyMessage::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ReplyMessage::GetClassData() const { return &_class_data_; }
+
+
+void ReplyMessage::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<ReplyMessage*>(&to_msg);
+  auto& from = static_cast<const ReplyMessage&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:dsnet.transaction.tapir.proto.ReplyMessage)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_reply(from._internal_reply());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.status_ = from._impl_.status_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void ReplyMessage::CopyFrom(const ReplyMessage& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:dsnet.transaction.tapir.proto.ReplyMessage)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool ReplyMessage::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  return true;
+}
+
+void ReplyMessage::InternalSwap(ReplyMessage* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.reply_, lhs_arena,
+      &other->_impl_.reply_, rhs_arena
+  );
+  swap(_impl_.status_, other->_impl_.status_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata ReplyMessage::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_transaction_2ftapir_2ftapir_2dproto_2eproto_getter, &descriptor_table_transaction_2ftapir_2ftapir_2dproto_2eproto_once,
+      file_level_metadata_transaction_2ftapir_2ftapir_2dproto_2eproto[2]);
+}
+
+// ===================================================================
+
+class OpID::_Internal {
+ public:
+  using HasBits = decltype(std::declval<OpID>()._impl_._has_bits_);
+  static void set_has_clientid(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_clientreqid(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000003) ^ 0x00000003) != 0;
+  }
+};
+
+OpID::OpID(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:dsnet.transaction.tapir.proto.OpID)
+}
+OpID::OpID(const OpID& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  OpID* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.clientid_){}
+    , decltype(_impl_.clientreqid_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.clientid_, &from._impl_.clientid_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.clientreqid_) -
+    reinterpret_cast<char*>(&_impl_.clientid_)) + sizeof(_impl_.clientreqid_));
+  // @@protoc_insertion_point(copy_constructor:dsnet.transaction.tapir.proto.OpID)
+}
+
+inline void OpID::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.clientid_){uint64_t{0u}}
+    , decltype(_impl_.clientreqid_){uint64_t{0u}}
+  };
+}
+
+OpID::~OpID() {
+  // @@protoc_insertion_point(destructor:dsnet.transaction.tapir.proto.OpID)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void OpID::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void OpID::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void OpID::Clear() {
+// @@protoc_insertion_point(message_clear_start:dsnet.transaction.tapir.proto.OpID)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    ::memset(&_impl_.clientid_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.clientreqid_) -
+        reinterpret_cast<char*>(&_impl_.clientid_)) + sizeof(_impl_.clientreqid_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* OpID::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required uint64 clientid = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_clientid(&has_bits);
+          _impl_.clientid_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required uint64 clientreqid = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _Internal::set_has_clientreqid(&has_bits);
+          _impl_.clientreqid_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* OpID::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:dsnet.transaction.tapir.proto.OpID)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required uint64 clientid = 1;
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(1, this->_internal_clientid(), target);
+  }
+
+  // required uint64 clientreqid = 2;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(2, this->_internal_clientreqid(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:dsnet.transaction.tapir.proto.OpID)
+  return target;
+}
+
+size_t OpID::RequiredFieldsByteSizeFallback() const {
+// @@protoc_insertion_point(required_fields_byte_size_fallback_start:dsnet.transaction.tapir.proto.OpID)
+  size_t total_size = 0;
+
+  if (_internal_has_clientid()) {
+    // required uint64 clientid = 1;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_clientid());
+  }
+
+  if (_internal_has_clientreqid()) {
+    // required uint64 clientreqid = 2;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_clientreqid());
+  }
+
+  return total_size;
+}
+size_t OpID::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:dsnet.transaction.tapir.proto.OpID)
+  size_t total_size = 0;
+
+  if (((_impl_._has_bits_[0] & 0x00000003) ^ 0x00000003) == 0) {  // All required fields are present.
+    // required uint64 clientid = 1;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_clientid());
+
+    // required uint64 clientreqid = 2;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_clientreqid());
+
+  } else {
+    total_size += RequiredFieldsByteSizeFallback();
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData OpID::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    OpID::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*OpID::GetClassData() const { return &_class_data_; }
+
+
+void OpID::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<OpID*>(&to_msg);
+  auto& from = static_cast<const OpID&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:dsnet.transaction.tapir.proto.OpID)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_impl_.clientid_ = from._impl_.clientid_;
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.clientreqid_ = from._impl_.clientreqid_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void OpID::CopyFrom(const OpID& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:dsnet.transaction.tapir.proto.OpID)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool OpID::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  return true;
+}
+
+void OpID::InternalSwap(OpID* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(OpID, _impl_.clientreqid_)
+      + sizeof(OpID::_impl_.clientreqid_)
+      - PROTOBUF_FIELD_OFFSET(OpID, _impl_.clientid_)>(
+          reinterpret_cast<char*>(&_impl_.clientid_),
+          reinterpret_cast<char*>(&other->_impl_.clientid_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata OpID::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_transaction_2ftapir_2ftapir_2dproto_2eproto_getter, &descriptor_table_transaction_2ftapir_2ftapir_2dproto_2eproto_once,
+      file_level_metadata_transaction_2ftapir_2ftapir_2dproto_2eproto[3]);
+}
+
+// ===================================================================
+
+class ToServerMessage::_Internal {
+ public:
+  static const ::dsnet::transaction::tapir::proto::ProposeInconsistentMessage& propose_inconsistent(const ToServerMessage* msg);
+  static const ::dsnet::transaction::tapir::proto::FinalizeInconsistentMessage& finalize_inconsistent(const ToServerMessage* msg);
+  static const ::dsnet::transaction::tapir::proto::ProposeConsensusMessage& propose_consensus(const ToServerMessage* msg);
+  static const ::dsnet::transaction::tapir::proto::FinalizeConsensusMessage& finalize_consensus(const ToServerMessage* msg);
+};
+
+const ::dsnet::transaction::tapir::proto::ProposeInconsistentMessage&
+ToServerMessage::_Internal::propose_inconsistent(const ToServerMessage* msg) {
+  return *msg->_impl_.msg_.propose_inconsistent_;
+}
+const ::dsnet::transaction::tapir::proto::FinalizeInconsistentMessage&
+ToServerMessage::_Internal::finalize_inconsistent(const ToServerMessage* msg) {
+  return *msg->_impl_.msg_.finalize_inconsistent_;
+}
+const ::dsnet::transaction::tapir::proto::ProposeConsensusMessage&
+ToServerMessage::_Internal::propose_consensus(const ToServerMessage* msg) {
+  return *msg->_impl_.msg_.propose_consensus_;
+}
+const ::dsnet::transaction::tapir::proto::FinalizeConsensusMessage&
+ToServerMessage::_Internal::finalize_consensus(const ToServerMessage* msg) {
+  return *msg->_impl_.msg_.finalize_consensus_;
+}
+void ToServerMessage::set_allocated_propose_inconsistent(::dsnet::transaction::tapir::proto::ProposeInconsistentMessage* propose_inconsistent) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  clear_msg();
+  if (propose_inconsistent) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(propose_inconsistent);
+    if (message_arena != submessage_arena) {
+      propose_inconsistent = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, propose_inconsistent, submessage_arena);
+    }
+    set_has_propose_inconsistent();
+    _impl_.msg_.propose_inconsistent_ = propose_inconsistent;
+  }
+  // @@protoc_insertion_point(field_set_allocated:dsnet.transaction.tapir.proto.ToServerMessage.propose_inconsistent)
+}
+void ToServerMessage::set_allocated_finalize_inconsistent(::dsnet::transaction::tapir::proto::FinalizeInconsistentMessage* finalize_inconsistent) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  clear_msg();
+  if (finalize_inconsistent) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(finalize_inconsistent);
+    if (message_arena != submessage_arena) {
+      finalize_inconsistent = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, finalize_inconsistent, submessage_arena);
+    }
+    set_has_finalize_inconsistent();
+    _impl_.msg_.finalize_inconsistent_ = finalize_inconsistent;
+  }
+  // @@protoc_insertion_point(field_set_allocated:dsnet.transaction.tapir.proto.ToServerMessage.finalize_inconsistent)
+}
+void ToServerMessage::set_allocated_propose_consensus(::dsnet::transaction::tapir::proto::ProposeConsensusMessage* propose_consensus) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  clear_msg();
+  if (propose_consensus) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(propose_consensus);
+    if (message_arena != submessage_arena) {
+      propose_consensus = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, propose_consensus, submessage_arena);
+    }
+    set_has_propose_consensus();
+    _impl_.msg_.propose_consensus_ = propose_consensus;
+  }
+  // @@protoc_insertion_point(field_set_allocated:dsnet.transaction.tapir.proto.ToServerMessage.propose_consensus)
+}
+void ToServerMessage::set_allocated_finalize_consensus(::dsnet::transaction::tapir::proto::FinalizeConsensusMessage* finalize_consensus) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  clear_msg();
+  if (finalize_consensus) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(finalize_consensus);
+    if (message_arena != submessage_arena) {
+      finalize_consensus = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, finalize_consensus, submessage_arena);
+    }
+    set_has_finalize_consensus();
+    _impl_.msg_.finalize_consensus_ = finalize_consensus;
+  }
+  // @@protoc_insertion_point(field_set_allocated:dsnet.transaction.tapir.proto.ToServerMessage.finalize_consensus)
+}
+ToServerMessage::ToServerMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:dsnet.transaction.tapir.proto.ToServerMessage)
+}
+ToServerMessage::ToServerMessage(const ToServerMessage& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  ToServerMessage* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.msg_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , /*decltype(_impl_._oneof_case_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  clear_has_msg();
+  switch (from.msg_case()) {
+    case kProposeInconsistent: {
+      _this->_internal_mutable_propose_inconsistent()->::dsnet::transaction::tapir::proto::ProposeInconsistentMessage::MergeFrom(
+          from._internal_propose_inconsistent());
+      break;
+    }
+    case kFinalizeInconsistent: {
+      _this->_internal_mutable_finalize_inconsistent()->::dsnet::transaction::tapir::proto::FinalizeInconsistentMessage::MergeFrom(
+          from._internal_finalize_inconsistent());
+      break;
+    }
+    case kProposeConsensus: {
+      _this->_internal_mutable_propose_consensus()->::dsnet::transaction::tapir::proto::ProposeConsensusMessage::MergeFrom(
+          from._internal_propose_consensus());
+      break;
+    }
+    case kFinalizeConsensus: {
+      _this->_internal_mutable_finalize_consensus()->::dsnet::transaction::tapir::proto::FinalizeConsensusMessage::MergeFrom(
+          from._internal_finalize_consensus());
+      break;
+    }
+    case MSG_NOT_SET: {
+      break;
+    }
+  }
+  // @@protoc_insertion_point(copy_constructor:dsnet.transaction.tapir.proto.ToServerMessage)
+}
+
+inline void ToServerMessage::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.msg_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , /*decltype(_impl_._oneof_case_)*/{}
+  };
+  clear_has_msg();
+}
+
+ToServerMessage::~ToServerMessage() {
+  // @@protoc_insertion_point(destructor:dsnet.transaction.tapir.proto.ToServerMessage)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void ToServerMessage::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  if (has_msg()) {
+    clear_msg();
+  }
+}
+
+void ToServerMessage::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void ToServerMessage::clear_msg() {
+// @@protoc_insertion_point(one_of_clear_start:dsnet.transaction.tapir.proto.ToServerMessage)
+  switch (msg_case()) {
+    case kProposeInconsistent: {
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.msg_.propose_inconsistent_;
+      }
+      break;
+    }
+    case kFinalizeInconsistent: {
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.msg_.finalize_inconsistent_;
+      }
+      break;
+    }
+    case kProposeConsensus: {
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.msg_.propose_consensus_;
+      }
+      break;
+    }
+    case kFinalizeConsensus: {
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.msg_.finalize_consensus_;
+      }
+      break;
+    }
+    case MSG_NOT_SET: {
+      break;
+    }
+  }
+  _impl_._oneof_case_[0] = MSG_NOT_SET;
+}
+
+
+void ToServerMessage::Clear() {
+// @@protoc_insertion_point(message_clear_start:dsnet.transaction.tapir.proto.ToServerMessage)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  clear_msg();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* ToServerMessage::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // .dsnet.transaction.tapir.proto.ProposeInconsistentMessage propose_inconsistent = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr = ctx->ParseMessage(_internal_mutable_propose_inconsistent(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .dsnet.transaction.tapir.proto.FinalizeInconsistentMessage finalize_inconsistent = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr = ctx->ParseMessage(_internal_mutable_finalize_inconsistent(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .dsnet.transaction.tapir.proto.ProposeConsensusMessage propose_consensus = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          ptr = ctx->ParseMessage(_internal_mutable_propose_consensus(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .dsnet.transaction.tapir.proto.FinalizeConsensusMessage finalize_consensus = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          ptr = ctx->ParseMessage(_internal_mutable_finalize_consensus(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* ToServerMessage::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:dsnet.transaction.tapir.proto.ToServerMessage)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  switch (msg_case()) {
+    case kProposeInconsistent: {
+      target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(1, _Internal::propose_inconsistent(this),
+          _Internal::propose_inconsistent(this).GetCachedSize(), target, stream);
+      break;
+    }
+    case kFinalizeInconsistent: {
+      target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(2, _Internal::finalize_inconsistent(this),
+          _Internal::finalize_inconsistent(this).GetCachedSize(), target, stream);
+      break;
+    }
+    case kProposeConsensus: {
+      target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(3, _Internal::propose_consensus(this),
+          _Internal::propose_consensus(this).GetCachedSize(), target, stream);
+      break;
+    }
+    case kFinalizeConsensus: {
+      target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(4, _Internal::finalize_consensus(this),
+          _Internal::finalize_consensus(this).GetCachedSize(), target, stream);
+      break;
+    }
+    default: ;
+  }
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:dsnet.transaction.tapir.proto.ToServerMessage)
+  return target;
+}
+
+size_t ToServerMessage::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:dsnet.transaction.tapir.proto.ToServerMessage)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  switch (msg_case()) {
+    // .dsnet.transaction.tapir.proto.ProposeInconsistentMessage propose_inconsistent = 1;
+    case kProposeInconsistent: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.msg_.propose_inconsistent_);
+      break;
+    }
+    // .dsnet.transaction.tapir.proto.FinalizeInconsistentMessage finalize_inconsistent = 2;
+    case kFinalizeInconsistent: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.msg_.finalize_inconsistent_);
+      break;
+    }
+    // .dsnet.transaction.tapir.proto.ProposeConsensusMessage propose_consensus = 3;
+    case kProposeConsensus: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.msg_.propose_consensus_);
+      break;
+    }
+    // .dsnet.transaction.tapir.proto.FinalizeConsensusMessage finalize_consensus = 4;
+    case kFinalizeConsensus: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.msg_.finalize_consensus_);
+      break;
+    }
+    case MSG_NOT_SET: {
+      break;
+    }
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ToServerMessage::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    ToServerMessage::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ToServerMessage::GetClassData() const { return &_class_data_; }
+
+
+void ToServerMessage::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<ToServerMessage*>(&to_msg);
+  auto& from = static_cast<const ToServerMessage&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:dsnet.transaction.tapir.proto.ToServerMessage)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  switch (from.msg_case()) {
+    case kProposeInconsistent: {
+      _this->_internal_mutable_propose_inconsistent()->::dsnet::transaction::tapir::proto::ProposeInconsistentMessage::MergeFrom(
+          from._internal_propose_inconsistent());
+      break;
+    }
+    case kFinalizeInconsistent: {
+      _this->_internal_mutable_finalize_inconsistent()->::dsnet::transaction::tapir::proto::FinalizeInconsistentMessage::MergeFrom(
+          from._internal_finalize_inconsistent());
+      break;
+    }
+    case kProposeConsensus: {
+      _this->_internal_mutable_propose_consensus()->::dsnet::transaction::tapir::proto::ProposeConsensusMessage::MergeFrom(
+          from._internal_propose_consensus());
+      break;
+    }
+    case kFinalizeConsensus: {
+      _this->_internal_mutable_finalize_consensus()->::dsnet::transaction::tapir::proto::FinalizeConsensusMessage::MergeFrom(
+          from._internal_finalize_consensus());
+      break;
+    }
+    case MSG_NOT_SET: {
+      break;
+    }
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void ToServerMessage::CopyFrom(const ToServerMessage& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:dsnet.transaction.tapir.proto.ToServerMessage)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool ToServerMessage::IsInitialized() const {
+  switch (msg_case()) {
+    case kProposeInconsistent: {
+      if (_internal_has_propose_inconsistent()) {
+        if (!_impl_.msg_.propose_inconsistent_->IsInitialized()) return false;
+      }
+      break;
+    }
+    case kFinalizeInconsistent: {
+      if (_internal_has_finalize_inconsistent()) {
+        if (!_impl_.msg_.finalize_inconsistent_->IsInitialized()) return false;
+      }
+      break;
+    }
+    case kProposeConsensus: {
+      if (_internal_has_propose_consensus()) {
+        if (!_impl_.msg_.propose_consensus_->IsInitialized()) return false;
+      }
+      break;
+    }
+    case kFinalizeConsensus: {
+      if (_internal_has_finalize_consensus()) {
+        if (!_impl_.msg_.finalize_consensus_->IsInitialized()) return false;
+      }
+      break;
+    }
+    case MSG_NOT_SET: {
+      break;
+    }
+  }
+  return true;
+}
+
+void ToServerMessage::InternalSwap(ToServerMessage* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_.msg_, other->_impl_.msg_);
+  swap(_impl_._oneof_case_[0], other->_impl_._oneof_case_[0]);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata ToServerMessage::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_transaction_2ftapir_2ftapir_2dproto_2eproto_getter, &descriptor_table_transaction_2ftapir_2ftapir_2dproto_2eproto_once,
+      file_level_metadata_transaction_2ftapir_2ftapir_2dproto_2eproto[4]);
+}
+
+// ===================================================================
+
+class ProposeInconsistentMessage::_Internal {
+ public:
+  using HasBits = decltype(std::declval<ProposeInconsistentMessage>()._impl_._has_bits_);
+  static const ::dsnet::Request& req(const ProposeInconsistentMessage* msg);
+  static void set_has_req(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000001) ^ 0x00000001) != 0;
+  }
+};
+
+const ::dsnet::Request&
+ProposeInconsistentMessage::_Internal::req(const ProposeInconsistentMessage* msg) {
+  return *msg->_impl_.req_;
+}
+void ProposeInconsistentMessage::clear_req() {
+  if (_impl_.req_ != nullptr) _impl_.req_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+ProposeInconsistentMessage::ProposeInconsistentMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:dsnet.transaction.tapir.proto.ProposeInconsistentMessage)
+}
+ProposeInconsistentMessage::ProposeInconsistentMessage(const ProposeInconsistentMessage& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  ProposeInconsistentMessage* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.req_){nullptr}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  if (from._internal_has_req()) {
+    _this->_impl_.req_ = new ::dsnet::Request(*from._impl_.req_);
+  }
+  // @@protoc_insertion_point(copy_constructor:dsnet.transaction.tapir.proto.ProposeInconsistentMessage)
+}
+
+inline void ProposeInconsistentMessage::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.req_){nullptr}
+  };
+}
+
+ProposeInconsistentMessage::~ProposeInconsistentMessage() {
+  // @@protoc_insertion_point(destructor:dsnet.transaction.tapir.proto.ProposeInconsistentMessage)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void ProposeInconsistentMessage::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  if (this != internal_default_instance()) delete _impl_.req_;
+}
+
+void ProposeInconsistentMessage::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void ProposeInconsistentMessage::Clear() {
+// @@protoc_insertion_point(message_clear_start:dsnet.transaction.tapir.proto.ProposeInconsistentMessage)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    GOOGLE_DCHECK(_impl_.req_ != nullptr);
+    _impl_.req_->Clear();
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* ProposeInconsistentMessage::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required .dsnet.Request req = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr = ctx->ParseMessage(_internal_mutable_req(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* ProposeInconsistentMessage::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:dsnet.transaction.tapir.proto.ProposeInconsistentMessage)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required .dsnet.Request req = 1;
+  if (cached_has_bits & 0x00000001u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(1, _Internal::req(this),
+        _Internal::req(this).GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:dsnet.transaction.tapir.proto.ProposeInconsistentMessage)
+  return target;
+}
+
+size_t ProposeInconsistentMessage::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:dsnet.transaction.tapir.proto.ProposeInconsistentMessage)
+  size_t total_size = 0;
+
+  // required .dsnet.Request req = 1;
+  if (_internal_has_req()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.req_);
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ProposeInconsistentMessage::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    ProposeInconsistentMessage::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ProposeInconsistentMessage::GetClassData() const { return &_class_data_; }
+
+
+void ProposeInconsistentMessage::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<ProposeInconsistentMessage*>(&to_msg);
+  auto& from = static_cast<const ProposeInconsistentMessage&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:dsnet.transaction.tapir.proto.ProposeInconsistentMessage)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_has_req()) {
+    _this->_internal_mutable_req()->::dsnet::Request::MergeFrom(
+        from._internal_req());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void ProposeInconsistentMessage::CopyFrom(const ProposeInconsistentMessage& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:dsnet.transaction.tapir.proto.ProposeInconsistentMessage)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool ProposeInconsistentMessage::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  if (_internal_has_req()) {
+    if (!_impl_.req_->IsInitialized()) return false;
+  }
+  return true;
+}
+
+void ProposeInconsistentMessage::InternalSwap(ProposeInconsistentMessage* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  swap(_impl_.req_, other->_impl_.req_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata ProposeInconsistentMessage::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_transaction_2ftapir_2ftapir_2dproto_2eproto_getter, &descriptor_table_transaction_2ftapir_2ftapir_2dproto_2eproto_once,
+      file_level_metadata_transaction_2ftapir_2ftapir_2dproto_2eproto[5]);
+}
+
+// ===================================================================
+
+class FinalizeInconsistentMessage::_Internal {
+ public:
+  using HasBits = decltype(std::declval<FinalizeInconsistentMessage>()._impl_._has_bits_);
+  static const ::dsnet::transaction::tapir::proto::OpID& opid(const FinalizeInconsistentMessage* msg);
+  static void set_has_opid(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000001) ^ 0x00000001) != 0;
+  }
+};
+
+const ::dsnet::transaction::tapir::proto::OpID&
+FinalizeInconsistentMessage::_Internal::opid(const FinalizeInconsistentMessage* msg) {
+  return *msg->_impl_.opid_;
+}
+FinalizeInconsistentMessage::FinalizeInconsistentMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:dsnet.transaction.tapir.proto.FinalizeInconsistentMessage)
+}
+FinalizeInconsistentMessage::FinalizeInconsistentMessage(const FinalizeInconsistentMessage& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  FinalizeInconsistentMessage* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.opid_){nullptr}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  if (from._internal_has_opid()) {
+    _this->_impl_.opid_ = new ::dsnet::transaction::tapir::proto::OpID(*from._impl_.opid_);
+  }
+  // @@protoc_insertion_point(copy_constructor:dsnet.transaction.tapir.proto.FinalizeInconsistentMessage)
+}
+
+inline void FinalizeInconsistentMessage::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.opid_){nullptr}
+  };
+}
+
+FinalizeInconsistentMessage::~FinalizeInconsistentMessage() {
+  // @@protoc_insertion_point(destructor:dsnet.transaction.tapir.proto.FinalizeInconsistentMessage)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void FinalizeInconsistentMessage::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  if (this != internal_default_instance()) delete _impl_.opid_;
+}
+
+void FinalizeInconsistentMessage::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void FinalizeInconsistentMessage::Clear() {
+// @@protoc_insertion_point(message_clear_start:dsnet.transaction.tapir.proto.FinalizeInconsistentMessage)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    GOOGLE_DCHECK(_impl_.opid_ != nullptr);
+    _impl_.opid_->Clear();
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* FinalizeInconsistentMessage::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required .dsnet.transaction.tapir.proto.OpID opid = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr = ctx->ParseMessage(_internal_mutable_opid(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* FinalizeInconsistentMessage::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:dsnet.transaction.tapir.proto.FinalizeInconsistentMessage)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required .dsnet.transaction.tapir.proto.OpID opid = 1;
+  if (cached_has_bits & 0x00000001u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(1, _Internal::opid(this),
+        _Internal::opid(this).GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:dsnet.transaction.tapir.proto.FinalizeInconsistentMessage)
+  return target;
+}
+
+size_t FinalizeInconsistentMessage::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:dsnet.transaction.tapir.proto.FinalizeInconsistentMessage)
+  size_t total_size = 0;
+
+  // required .dsnet.transaction.tapir.proto.OpID opid = 1;
+  if (_internal_has_opid()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.opid_);
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData FinalizeInconsistentMessage::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    FinalizeInconsistentMessage::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*FinalizeInconsistentMessage::GetClassData() const { return &_class_data_; }
+
+
+void FinalizeInconsistentMessage::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<FinalizeInconsistentMessage*>(&to_msg);
+  auto& from = static_cast<const FinalizeInconsistentMessage&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:dsnet.transaction.tapir.proto.FinalizeInconsistentMessage)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_has_opid()) {
+    _this->_internal_mutable_opid()->::dsnet::transaction::tapir::proto::OpID::MergeFrom(
+        from._internal_opid());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void FinalizeInconsistentMessage::CopyFrom(const FinalizeInconsistentMessage& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:dsnet.transaction.tapir.proto.FinalizeInconsistentMessage)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool FinalizeInconsistentMessage::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  if (_internal_has_opid()) {
+    if (!_impl_.opid_->IsInitialized()) return false;
+  }
+  return true;
+}
+
+void FinalizeInconsistentMessage::InternalSwap(FinalizeInconsistentMessage* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  swap(_impl_.opid_, other->_impl_.opid_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata FinalizeInconsistentMessage::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_transaction_2ftapir_2ftapir_2dproto_2eproto_getter, &descriptor_table_transaction_2ftapir_2ftapir_2dproto_2eproto_once,
+      file_level_metadata_transaction_2ftapir_2ftapir_2dproto_2eproto[6]);
+}
+
+// ===================================================================
+
+class ProposeConsensusMessage::_Internal {
+ public:
+  using HasBits = decltype(std::declval<ProposeConsensusMessage>()._impl_._has_bits_);
+  static const ::dsnet::Request& req(const ProposeConsensusMessage* msg);
+  static void set_has_req(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000001) ^ 0x00000001) != 0;
+  }
+};
+
+const ::dsnet::Request&
+ProposeConsensusMessage::_Internal::req(const ProposeConsensusMessage* msg) {
+  return *msg->_impl_.req_;
+}
+void ProposeConsensusMessage::clear_req() {
+  if (_impl_.req_ != nullptr) _impl_.req_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+ProposeConsensusMessage::ProposeConsensusMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:dsnet.transaction.tapir.proto.ProposeConsensusMessage)
+}
+ProposeConsensusMessage::ProposeConsensusMessage(const ProposeConsensusMessage& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  ProposeConsensusMessage* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.req_){nullptr}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  if (from._internal_has_req()) {
+    _this->_impl_.req_ = new ::dsnet::Request(*from._impl_.req_);
+  }
+  // @@protoc_insertion_point(copy_constructor:dsnet.transaction.tapir.proto.ProposeConsensusMessage)
+}
+
+inline void ProposeConsensusMessage::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.req_){nullptr}
+  };
+}
+
+ProposeConsensusMessage::~ProposeConsensusMessage() {
+  // @@protoc_insertion_point(destructor:dsnet.transaction.tapir.proto.ProposeConsensusMessage)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void ProposeConsensusMessage::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  if (this != internal_default_instance()) delete _impl_.req_;
+}
+
+void ProposeConsensusMessage::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void ProposeConsensusMessage::Clear() {
+// @@protoc_insertion_point(message_clear_start:dsnet.transaction.tapir.proto.ProposeConsensusMessage)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    GOOGLE_DCHECK(_impl_.req_ != nullptr);
+    _impl_.req_->Clear();
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* ProposeConsensusMessage::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required .dsnet.Request req = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr = ctx->ParseMessage(_internal_mutable_req(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* ProposeConsensusMessage::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:dsnet.transaction.tapir.proto.ProposeConsensusMessage)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required .dsnet.Request req = 1;
+  if (cached_has_bits & 0x00000001u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(1, _Internal::req(this),
+        _Internal::req(this).GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:dsnet.transaction.tapir.proto.ProposeConsensusMessage)
+  return target;
+}
+
+size_t ProposeConsensusMessage::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:dsnet.transaction.tapir.proto.ProposeConsensusMessage)
+  size_t total_size = 0;
+
+  // required .dsnet.Request req = 1;
+  if (_internal_has_req()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.req_);
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ProposeConsensusMessage::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    ProposeConsensusMessage::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ProposeConsensusMessage::GetClassData() const { return &_class_data_; }
+
+
+void ProposeConsensusMessage::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<ProposeConsensusMessage*>(&to_msg);
+  auto& from = static_cast<const ProposeConsensusMessage&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:dsnet.transaction.tapir.proto.ProposeConsensusMessage)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_has_req()) {
+    _this->_internal_mutable_req()->::dsnet::Request::MergeFrom(
+        from._internal_req());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void ProposeConsensusMessage::CopyFrom(const ProposeConsensusMessage& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:dsnet.transaction.tapir.proto.ProposeConsensusMessage)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool ProposeConsensusMessage::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  if (_internal_has_req()) {
+    if (!_impl_.req_->IsInitialized()) return false;
+  }
+  return true;
+}
+
+void ProposeConsensusMessage::InternalSwap(ProposeConsensusMessage* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  swap(_impl_.req_, other->_impl_.req_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata ProposeConsensusMessage::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_transaction_2ftapir_2ftapir_2dproto_2eproto_getter, &descriptor_table_transaction_2ftapir_2ftapir_2dproto_2eproto_once,
+      file_level_metadata_transaction_2ftapir_2ftapir_2dproto_2eproto[7]);
+}
+
+// ===================================================================
+
+class FinalizeConsensusMessage::_Internal {
+ public:
+  using HasBits = decltype(std::declval<FinalizeConsensusMessage>()._impl_._has_bits_);
+  static const ::dsnet::transaction::tapir::proto::OpID& opid(const FinalizeConsensusMessage* msg);
+  static void set_has_opid(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_result(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000003) ^ 0x00000003) != 0;
+  }
+};
+
+const ::dsnet::transaction::tapir::proto::OpID&
+FinalizeConsensusMessage::_Internal::opid(const FinalizeConsensusMessage* msg) {
+  return *msg->_impl_.opid_;
+}
+FinalizeConsensusMessage::FinalizeConsensusMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:dsnet.transaction.tapir.proto.FinalizeConsensusMessage)
+}
+FinalizeConsensusMessage::FinalizeConsensusMessage(const FinalizeConsensusMessage& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  FinalizeConsensusMessage* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.result_){}
+    , decltype(_impl_.opid_){nullptr}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.result_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.result_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_result()) {
+    _this->_impl_.result_.Set(from._internal_result(), 
+      _this->GetArenaForAllocation());
+  }
+  if (from._internal_has_opid()) {
+    _this->_impl_.opid_ = new ::dsnet::transaction::tapir::proto::OpID(*from._impl_.opid_);
+  }
+  // @@protoc_insertion_point(copy_constructor:dsnet.transaction.tapir.proto.FinalizeConsensusMessage)
+}
+
+inline void FinalizeConsensusMessage::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.result_){}
+    , decltype(_impl_.opid_){nullptr}
+  };
+  _impl_.result_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.result_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+FinalizeConsensusMessage::~FinalizeConsensusMessage() {
+  // @@protoc_insertion_point(destructor:dsnet.transaction.tapir.proto.FinalizeConsensusMessage)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void FinalizeConsensusMessage::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.result_.Destroy();
+  if (this != internal_default_instance()) delete _impl_.opid_;
+}
+
+void FinalizeConsensusMessage::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void FinalizeConsensusMessage::Clear() {
+// @@protoc_insertion_point(message_clear_start:dsnet.transaction.tapir.proto.FinalizeConsensusMessage)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      _impl_.result_.ClearNonDefaultToEmpty();
+    }
+    if (cached_has_bits & 0x00000002u) {
+      GOOGLE_DCHECK(_impl_.opid_ != nullptr);
+      _impl_.opid_->Clear();
+    }
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* FinalizeConsensusMessage::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required .dsnet.transaction.tapir.proto.OpID opid = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr = ctx->ParseMessage(_internal_mutable_opid(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required bytes result = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_result();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* FinalizeConsensusMessage::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:dsnet.transaction.tapir.proto.FinalizeConsensusMessage)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required .dsnet.transaction.tapir.proto.OpID opid = 1;
+  if (cached_has_bits & 0x00000002u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(1, _Internal::opid(this),
+        _Internal::opid(this).GetCachedSize(), target, stream);
+  }
+
+  // required bytes result = 2;
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->WriteBytesMaybeAliased(
+        2, this->_internal_result(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:dsnet.transaction.tapir.proto.FinalizeConsensusMessage)
+  return target;
+}
+
+size_t FinalizeConsensusMessage::RequiredFieldsByteSizeFallback() const {
+// @@protoc_insertion_point(required_fields_byte_size_fallback_start:dsnet.transaction.tapir.proto.FinalizeConsensusMessage)
+  size_t total_size = 0;
+
+  if (_internal_has_result()) {
+    // required bytes result = 2;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_result());
+  }
+
+  if (_internal_has_opid()) {
+    // required .dsnet.transaction.tapir.proto.OpID opid = 1;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.opid_);
+  }
+
+  return total_size;
+}
+size_t FinalizeConsensusMessage::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:dsnet.transaction.tapir.proto.FinalizeConsensusMessage)
+  size_t total_size = 0;
+
+  if (((_impl_._has_bits_[0] & 0x00000003) ^ 0x00000003) == 0) {  // All required fields are present.
+    // required bytes result = 2;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_result());
+
+    // required .dsnet.transaction.tapir.proto.OpID opid = 1;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.opid_);
+
+  } else {
+    total_size += RequiredFieldsByteSizeFallback();
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData FinalizeConsensusMessage::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    FinalizeConsensusMessage::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*FinalizeConsensusMessage::GetClassData() const { return &_class_data_; }
+
+
+void FinalizeConsensusMessage::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<FinalizeConsensusMessage*>(&to_msg);
+  auto& from = static_cast<const FinalizeConsensusMessage&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:dsnet.transaction.tapir.proto.FinalizeConsensusMessage)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_result(from._internal_result());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_internal_mutable_opid()->::dsnet::transaction::tapir::proto::OpID::MergeFrom(
+          from._internal_opid());
+    }
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void FinalizeConsensusMessage::CopyFrom(const FinalizeConsensusMessage& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:dsnet.transaction.tapir.proto.FinalizeConsensusMessage)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool FinalizeConsensusMessage::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  if (_internal_has_opid()) {
+    if (!_impl_.opid_->IsInitialized()) return false;
+  }
+  return true;
+}
+
+void FinalizeConsensusMessage::InternalSwap(FinalizeConsensusMessage* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.result_, lhs_arena,
+      &other->_impl_.result_, rhs_arena
+  );
+  swap(_impl_.opid_, other->_impl_.opid_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata FinalizeConsensusMessage::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_transaction_2ftapir_2ftapir_2dproto_2eproto_getter, &descriptor_table_transaction_2ftapir_2ftapir_2dproto_2eproto_once,
+      file_level_metadata_transaction_2ftapir_2ftapir_2dproto_2eproto[8]);
+}
+
+// ===================================================================
+
+class ToClientMessage::_Internal {
+ public:
+  static const ::dsnet::transaction::tapir::proto::ReplyInconsistentMessage& inconsistent_reply(const ToClientMessage* msg);
+  static const ::dsnet::transaction::tapir::proto::ReplyConsensusMessage& consensus_reply(const ToClientMessage* msg);
+  static const ::dsnet::transaction::tapir::proto::ConfirmMessage& confirm(const ToClientMessage* msg);
+};
+
+const ::dsnet::transaction::tapir::proto::ReplyInconsistentMessage&
+ToClientMessage::_Internal::inconsistent_reply(const ToClientMessage* msg) {
+  return *msg->_impl_.msg_.inconsistent_reply_;
+}
+const ::dsnet::transaction::tapir::proto::ReplyConsensusMessage&
+ToClientMessage::_Internal::consensus_reply(const ToClientMessage* msg) {
+  return *msg->_impl_.msg_.consensus_reply_;
+}
+const ::dsnet::transaction::tapir::proto::ConfirmMessage&
+ToClientMessage::_Internal::confirm(const ToClientMessage* msg) {
+  return *msg->_impl_.msg_.confirm_;
+}
+void ToClientMessage::set_allocated_inconsistent_reply(::dsnet::transaction::tapir::proto::ReplyInconsistentMessage* inconsistent_reply) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  clear_msg();
+  if (inconsistent_reply) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(inconsistent_reply);
+    if (message_arena != submessage_arena) {
+      inconsistent_reply = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, inconsistent_reply, submessage_arena);
+    }
+    set_has_inconsistent_reply();
+    _impl_.msg_.inconsistent_reply_ = inconsistent_reply;
+  }
+  // @@protoc_insertion_point(field_set_allocated:dsnet.transaction.tapir.proto.ToClientMessage.inconsistent_reply)
+}
+void ToClientMessage::set_allocated_consensus_reply(::dsnet::transaction::tapir::proto::ReplyConsensusMessage* consensus_reply) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  clear_msg();
+  if (consensus_reply) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(consensus_reply);
+    if (message_arena != submessage_arena) {
+      consensus_reply = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, consensus_reply, submessage_arena);
+    }
+    set_has_consensus_reply();
+    _impl_.msg_.consensus_reply_ = consensus_reply;
+  }
+  // @@protoc_insertion_point(field_set_allocated:dsnet.transaction.tapir.proto.ToClientMessage.consensus_reply)
+}
+void ToClientMessage::set_allocated_confirm(::dsnet::transaction::tapir::proto::ConfirmMessage* confirm) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  clear_msg();
+  if (confirm) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(confirm);
+    if (message_arena != submessage_arena) {
+      confirm = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, confirm, submessage_arena);
+    }
+    set_has_confirm();
+    _impl_.msg_.confirm_ = confirm;
+  }
+  // @@protoc_insertion_point(field_set_allocated:dsnet.transaction.tapir.proto.ToClientMessage.confirm)
+}
+ToClientMessage::ToClientMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:dsnet.transaction.tapir.proto.ToClientMessage)
+}
+ToClientMessage::ToClientMessage(const ToClientMessage& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  ToClientMessage* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.msg_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , /*decltype(_impl_._oneof_case_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  clear_has_msg();
+  switch (from.msg_case()) {
+    case kInconsistentReply: {
+      _this->_internal_mutable_inconsistent_reply()->::dsnet::transaction::tapir::proto::ReplyInconsistentMessage::MergeFrom(
+          from._internal_inconsistent_reply());
+      break;
+    }
+    case kConsensusReply: {
+      _this->_internal_mutable_consensus_reply()->::dsnet::transaction::tapir::proto::ReplyConsensusMessage::MergeFrom(
+          from._internal_consensus_reply());
+      break;
+    }
+    case kConfirm: {
+      _this->_internal_mutable_confirm()->::dsnet::transaction::tapir::proto::ConfirmMessage::MergeFrom(
+          from._internal_confirm());
+      break;
+    }
+    case MSG_NOT_SET: {
+      break;
+    }
+  }
+  // @@protoc_insertion_point(copy_constructor:dsnet.transaction.tapir.proto.ToClientMessage)
+}
+
+inline void ToClientMessage::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.msg_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , /*decltype(_impl_._oneof_case_)*/{}
+  };
+  clear_has_msg();
+}
+
+ToClientMessage::~ToClientMessage() {
+  // @@protoc_insertion_point(destructor:dsnet.transaction.tapir.proto.ToClientMessage)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void ToClientMessage::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  if (has_msg()) {
+    clear_msg();
+  }
+}
+
+void ToClientMessage::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void ToClientMessage::clear_msg() {
+// @@protoc_insertion_point(one_of_clear_start:dsnet.transaction.tapir.proto.ToClientMessage)
+  switch (msg_case()) {
+    case kInconsistentReply: {
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.msg_.inconsistent_reply_;
+      }
+      break;
+    }
+    case kConsensusReply: {
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.msg_.consensus_reply_;
+      }
+      break;
+    }
+    case kConfirm: {
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.msg_.confirm_;
+      }
+      break;
+    }
+    case MSG_NOT_SET: {
+      break;
+    }
+  }
+  _impl_._oneof_case_[0] = MSG_NOT_SET;
+}
+
+
+void ToClientMessage::Clear() {
+// @@protoc_insertion_point(message_clear_start:dsnet.transaction.tapir.proto.ToClientMessage)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  clear_msg();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* ToClientMessage::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // .dsnet.transaction.tapir.proto.ReplyInconsistentMessage inconsistent_reply = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr = ctx->ParseMessage(_internal_mutable_inconsistent_reply(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .dsnet.transaction.tapir.proto.ReplyConsensusMessage consensus_reply = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr = ctx->ParseMessage(_internal_mutable_consensus_reply(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .dsnet.transaction.tapir.proto.ConfirmMessage confirm = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          ptr = ctx->ParseMessage(_internal_mutable_confirm(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* ToClientMessage::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:dsnet.transaction.tapir.proto.ToClientMessage)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  switch (msg_case()) {
+    case kInconsistentReply: {
+      target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(1, _Internal::inconsistent_reply(this),
+          _Internal::inconsistent_reply(this).GetCachedSize(), target, stream);
+      break;
+    }
+    case kConsensusReply: {
+      target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(2, _Internal::consensus_reply(this),
+          _Internal::consensus_reply(this).GetCachedSize(), target, stream);
+      break;
+    }
+    case kConfirm: {
+      target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(3, _Internal::confirm(this),
+          _Internal::confirm(this).GetCachedSize(), target, stream);
+      break;
+    }
+    default: ;
+  }
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:dsnet.transaction.tapir.proto.ToClientMessage)
+  return target;
+}
+
+size_t ToClientMessage::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:dsnet.transaction.tapir.proto.ToClientMessage)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  switch (msg_case()) {
+    // .dsnet.transaction.tapir.proto.ReplyInconsistentMessage inconsistent_reply = 1;
+    case kInconsistentReply: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.msg_.inconsistent_reply_);
+      break;
+    }
+    // .dsnet.transaction.tapir.proto.ReplyConsensusMessage consensus_reply = 2;
+    case kConsensusReply: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.msg_.consensus_reply_);
+      break;
+    }
+    // .dsnet.transaction.tapir.proto.ConfirmMessage confirm = 3;
+    case kConfirm: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.msg_.confirm_);
+      break;
+    }
+    case MSG_NOT_SET: {
+      break;
+    }
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ToClientMessage::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    ToClientMessage::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ToClientMessage::GetClassData() const { return &_class_data_; }
+
+
+void ToClientMessage::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<ToClientMessage*>(&to_msg);
+  auto& from = static_cast<const ToClientMessage&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:dsnet.transaction.tapir.proto.ToClientMessage)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  switch (from.msg_case()) {
+    case kInconsistentReply: {
+      _this->_internal_mutable_inconsistent_reply()->::dsnet::transaction::tapir::proto::ReplyInconsistentMessage::MergeFrom(
+          from._internal_inconsistent_reply());
+      break;
+    }
+    case kConsensusReply: {
+      _this->_internal_mutable_consensus_reply()->::dsnet::transaction::tapir::proto::ReplyConsensusMessage::MergeFrom(
+          from._internal_consensus_reply());
+      break;
+    }
+    case kConfirm: {
+      _this->_internal_mutable_confirm()->::dsnet::transaction::tapir::proto::ConfirmMessage::MergeFrom(
+          from._internal_confirm());
+      break;
+    }
+    case MSG_NOT_SET: {
+      break;
+    }
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void ToClientMessage::CopyFrom(const ToClientMessage& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:dsnet.transaction.tapir.proto.ToClientMessage)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool ToClientMessage::IsInitialized() const {
+  switch (msg_case()) {
+    case kInconsistentReply: {
+      if (_internal_has_inconsistent_reply()) {
+        if (!_impl_.msg_.inconsistent_reply_->IsInitialized()) return false;
+      }
+      break;
+    }
+    case kConsensusReply: {
+      if (_internal_has_consensus_reply()) {
+        if (!_impl_.msg_.consensus_reply_->IsInitialized()) return false;
+      }
+      break;
+    }
+    case kConfirm: {
+      if (_internal_has_confirm()) {
+        if (!_impl_.msg_.confirm_->IsInitialized()) return false;
+      }
+      break;
+    }
+    case MSG_NOT_SET: {
+      break;
+    }
+  }
+  return true;
+}
+
+void ToClientMessage::InternalSwap(ToClientMessage* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_.msg_, other->_impl_.msg_);
+  swap(_impl_._oneof_case_[0], other->_impl_._oneof_case_[0]);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata ToClientMessage::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_transaction_2ftapir_2ftapir_2dproto_2eproto_getter, &descriptor_table_transaction_2ftapir_2ftapir_2dproto_2eproto_once,
+      file_level_metadata_transaction_2ftapir_2ftapir_2dproto_2eproto[9]);
+}
+
+// ===================================================================
+
+class ReplyInconsistentMessage::_Internal {
+ public:
+  using HasBits = decltype(std::declval<ReplyInconsistentMessage>()._impl_._has_bits_);
+  static void set_has_view(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_replicaidx(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static const ::dsnet::transaction::tapir::proto::OpID& opid(const ReplyInconsistentMessage* msg);
+  static void set_has_opid(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000007) ^ 0x00000007) != 0;
+  }
+};
+
+const ::dsnet::transaction::tapir::proto::OpID&
+ReplyInconsistentMessage::_Internal::opid(const ReplyInconsistentMessage* msg) {
+  return *msg->_impl_.opid_;
+}
+ReplyInconsistentMessage::ReplyInconsistentMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:dsnet.transaction.tapir.proto.ReplyInconsistentMessage)
+}
+ReplyInconsistentMessage::ReplyInconsistentMessage(const ReplyInconsistentMessage& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  ReplyInconsistentMessage* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.opid_){nullptr}
+    , decltype(_impl_.view_){}
+    , decltype(_impl_.replicaidx_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  if (from._internal_has_opid()) {
+    _this->_impl_.opid_ = new ::dsnet::transaction::tapir::proto::OpID(*from._impl_.opid_);
+  }
+  ::memcpy(&_impl_.view_, &from._impl_.view_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.replicaidx_) -
+    reinterpret_cast<char*>(&_impl_.view_)) + sizeof(_impl_.replicaidx_));
+  // @@protoc_insertion_point(copy_constructor:dsnet.transaction.tapir.proto.ReplyInconsistentMessage)
+}
+
+inline void ReplyInconsistentMessage::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.opid_){nullptr}
+    , decltype(_impl_.view_){uint64_t{0u}}
+    , decltype(_impl_.replicaidx_){0u}
+  };
+}
+
+ReplyInconsistentMessage::~ReplyInconsistentMessage() {
+  // @@protoc_insertion_point(destructor:dsnet.transaction.tapir.proto.ReplyInconsistentMessage)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void ReplyInconsistentMessage::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  if (this != internal_default_instance()) delete _impl_.opid_;
+}
+
+void ReplyInconsistentMessage::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void ReplyInconsistentMessage::Clear() {
+// @@protoc_insertion_point(message_clear_start:dsnet.transaction.tapir.proto.ReplyInconsistentMessage)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    GOOGLE_DCHECK(_impl_.opid_ != nullptr);
+    _impl_.opid_->Clear();
+  }
+  if (cached_has_bits & 0x00000006u) {
+    ::memset(&_impl_.view_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.replicaidx_) -
+        reinterpret_cast<char*>(&_impl_.view_)) + sizeof(_impl_.replicaidx_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* ReplyInconsistentMessage::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required uint64 view = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_view(&has_bits);
+          _impl_.view_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required uint32 replicaIdx = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _Internal::set_has_replicaidx(&has_bits);
+          _impl_.replicaidx_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required .dsnet.transaction.tapir.proto.OpID opid = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          ptr = ctx->ParseMessage(_internal_mutable_opid(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* ReplyInconsistentMessage::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:dsnet.transaction.tapir.proto.ReplyInconsistentMessage)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required uint64 view = 1;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(1, this->_internal_view(), target);
+  }
+
+  // required uint32 replicaIdx = 2;
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(2, this->_internal_replicaidx(), target);
+  }
+
+  // required .dsnet.transaction.tapir.proto.OpID opid = 3;
+  if (cached_has_bits & 0x00000001u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(3, _Internal::opid(this),
+        _Internal::opid(this).GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:dsnet.transaction.tapir.proto.ReplyInconsistentMessage)
+  return target;
+}
+
+size_t ReplyInconsistentMessage::RequiredFieldsByteSizeFallback() const {
+// @@protoc_insertion_point(required_fields_byte_size_fallback_start:dsnet.transaction.tapir.proto.ReplyInconsistentMessage)
+  size_t total_size = 0;
+
+  if (_internal_has_opid()) {
+    // required .dsnet.transaction.tapir.proto.OpID opid = 3;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.opid_);
+  }
+
+  if (_internal_has_view()) {
+    // required uint64 view = 1;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_view());
+  }
+
+  if (_internal_has_replicaidx()) {
+    // required uint32 replicaIdx = 2;
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_replicaidx());
+  }
+
+  return total_size;
+}
+size_t ReplyInconsistentMessage::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:dsnet.transaction.tapir.proto.ReplyInconsistentMessage)
+  size_t total_size = 0;
+
+  if (((_impl_._has_bits_[0] & 0x00000007) ^ 0x00000007) == 0) {  // All required fields are present.
+    // required .dsnet.transaction.tapir.proto.OpID opid = 3;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.opid_);
+
+    // required uint64 view = 1;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_view());
+
+    // required uint32 replicaIdx = 2;
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_replicaidx());
+
+  } else {
+    total_size += RequiredFieldsByteSizeFallback();
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ReplyInconsistentMessage::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    ReplyInconsistentMessage::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ReplyInconsistentMessage::GetClassData() const { return &_class_data_; }
+
+
+void ReplyInconsistentMessage::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<ReplyInconsistentMessage*>(&to_msg);
+  auto& from = static_cast<const ReplyInconsistentMessage&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:dsnet.transaction.tapir.proto.ReplyInconsistentMessage)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_mutable_opid()->::dsnet::transaction::tapir::proto::OpID::MergeFrom(
+          from._internal_opid());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.view_ = from._impl_.view_;
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.replicaidx_ = from._impl_.replicaidx_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void ReplyInconsistentMessage::CopyFrom(const ReplyInconsistentMessage& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:dsnet.transaction.tapir.proto.ReplyInconsistentMessage)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool ReplyInconsistentMessage::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  if (_internal_has_opid()) {
+    if (!_impl_.opid_->IsInitialized()) return false;
+  }
+  return true;
+}
+
+void ReplyInconsistentMessage::InternalSwap(ReplyInconsistentMessage* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(ReplyInconsistentMessage, _impl_.replicaidx_)
+      + sizeof(ReplyInconsistentMessage::_impl_.replicaidx_)
+      - PROTOBUF_FIELD_OFFSET(ReplyInconsistentMessage, _impl_.opid_)>(
+          reinterpret_cast<char*>(&_impl_.opid_),
+          reinterpret_cast<char*>(&other->_impl_.opid_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata ReplyInconsistentMessage::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_transaction_2ftapir_2ftapir_2dproto_2eproto_getter, &descriptor_table_transaction_2ftapir_2ftapir_2dproto_2eproto_once,
+      file_level_metadata_transaction_2ftapir_2ftapir_2dproto_2eproto[10]);
+}
+
+// ===================================================================
+
+class ReplyConsensusMessage::_Internal {
+ public:
+  using HasBits = decltype(std::declval<ReplyConsensusMessage>()._impl_._has_bits_);
+  static void set_has_view(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static void set_has_replicaidx(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+  static const ::dsnet::transaction::tapir::proto::OpID& opid(const ReplyConsensusMessage* msg);
+  static void set_has_opid(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_result(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x0000000f) ^ 0x0000000f) != 0;
+  }
+};
+
+const ::dsnet::transaction::tapir::proto::OpID&
+ReplyConsensusMessage::_Internal::opid(const ReplyConsensusMessage* msg) {
+  return *msg->_impl_.opid_;
+}
+ReplyConsensusMessage::ReplyConsensusMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:dsnet.transaction.tapir.proto.ReplyConsensusMessage)
+}
+ReplyConsensusMessage::ReplyConsensusMessage(const ReplyConsensusMessage& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  ReplyConsensusMessage* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.result_){}
+    , decltype(_impl_.opid_){nullptr}
+    , decltype(_impl_.view_){}
+    , decltype(_impl_.replicaidx_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.result_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.result_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_result()) {
+    _this->_impl_.result_.Set(from._internal_result(), 
+      _this->GetArenaForAllocation());
+  }
+  if (from._internal_has_opid()) {
+    _this->_impl_.opid_ = new ::dsnet::transaction::tapir::proto::OpID(*from._impl_.opid_);
+  }
+  ::memcpy(&_impl_.view_, &from._impl_.view_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.replicaidx_) -
+    reinterpret_cast<char*>(&_impl_.view_)) + sizeof(_impl_.replicaidx_));
+  // @@protoc_insertion_point(copy_constructor:dsnet.transaction.tapir.proto.ReplyConsensusMessage)
+}
+
+inline void ReplyConsensusMessage::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.result_){}
+    , decltype(_impl_.opid_){nullptr}
+    , decltype(_impl_.view_){uint64_t{0u}}
+    , decltype(_impl_.replicaidx_){0u}
+  };
+  _impl_.result_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.result_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+ReplyConsensusMessage::~ReplyConsensusMessage() {
+  // @@protoc_insertion_point(destructor:dsnet.transaction.tapir.proto.ReplyConsensusMessage)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void ReplyConsensusMessage::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.result_.Destroy();
+  if (this != internal_default_instance()) delete _impl_.opid_;
+}
+
+void ReplyConsensusMessage::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void ReplyConsensusMessage::Clear() {
+// @@protoc_insertion_point(message_clear_start:dsnet.transaction.tapir.proto.ReplyConsensusMessage)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      _impl_.result_.ClearNonDefaultToEmpty();
+    }
+    if (cached_has_bits & 0x00000002u) {
+      GOOGLE_DCHECK(_impl_.opid_ != nullptr);
+      _impl_.opid_->Clear();
+    }
+  }
+  if (cached_has_bits & 0x0000000cu) {
+    ::memset(&_impl_.view_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.replicaidx_) -
+        reinterpret_cast<char*>(&_impl_.view_)) + sizeof(_impl_.replicaidx_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* ReplyConsensusMessage::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required uint64 view = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_view(&has_bits);
+          _impl_.view_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required uint32 replicaIdx = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _Internal::set_has_replicaidx(&has_bits);
+          _impl_.replicaidx_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required .dsnet.transaction.tapir.proto.OpID opid = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          ptr = ctx->ParseMessage(_internal_mutable_opid(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required bytes result = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          auto str = _internal_mutable_result();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* ReplyConsensusMessage::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:dsnet.transaction.tapir.proto.ReplyConsensusMessage)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required uint64 view = 1;
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(1, this->_internal_view(), target);
+  }
+
+  // required uint32 replicaIdx = 2;
+  if (cached_has_bits & 0x00000008u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(2, this->_internal_replicaidx(), target);
+  }
+
+  // required .dsnet.transaction.tapir.proto.OpID opid = 3;
+  if (cached_has_bits & 0x00000002u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(3, _Internal::opid(this),
+        _Internal::opid(this).GetCachedSize(), target, stream);
+  }
+
+  // required bytes result = 4;
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->WriteBytesMaybeAliased(
+        4, this->_internal_result(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:dsnet.transaction.tapir.proto.ReplyConsensusMessage)
+  return target;
+}
+
+size_t ReplyConsensusMessage::RequiredFieldsByteSizeFallback() const {
+// @@protoc_insertion_point(required_fields_byte_size_fallback_start:dsnet.transaction.tapir.proto.ReplyConsensusMessage)
+  size_t total_size = 0;
+
+  if (_internal_has_result()) {
+    // required bytes result = 4;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_result());
+  }
+
+  if (_internal_has_opid()) {
+    // required .dsnet.transaction.tapir.proto.OpID opid = 3;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.opid_);
+  }
+
+  if (_internal_has_view()) {
+    // required uint64 view = 1;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_view());
+  }
+
+  if (_internal_has_replicaidx()) {
+    // required uint32 replicaIdx = 2;
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_replicaidx());
+  }
+
+  return total_size;
+}
+size_t ReplyConsensusMessage::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:dsnet.transaction.tapir.proto.ReplyConsensusMessage)
+  size_t total_size = 0;
+
+  if (((_impl_._has_bits_[0] & 0x0000000f) ^ 0x0000000f) == 0) {  // All required fields are present.
+    // required bytes result = 4;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_result());
+
+    // required .dsnet.transaction.tapir.proto.OpID opid = 3;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.opid_);
+
+    // required uint64 view = 1;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_view());
+
+    // required uint32 replicaIdx = 2;
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_replicaidx());
+
+  } else {
+    total_size += RequiredFieldsByteSizeFallback();
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ReplyConsensusMessage::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    ReplyConsensusMessage::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ReplyConsensusMessage::GetClassData() const { return &_class_data_; }
+
+
+void ReplyConsensusMessage::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<ReplyConsensusMessage*>(&to_msg);
+  auto& from = static_cast<const ReplyConsensusMessage&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:dsnet.transaction.tapir.proto.ReplyConsensusMessage)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000000fu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_result(from._internal_result());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_internal_mutable_opid()->::dsnet::transaction::tapir::proto::OpID::MergeFrom(
+          from._internal_opid());
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.view_ = from._impl_.view_;
+    }
+    if (cached_has_bits & 0x00000008u) {
+      _this->_impl_.replicaidx_ = from._impl_.replicaidx_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void ReplyConsensusMessage::CopyFrom(const ReplyConsensusMessage& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:dsnet.transaction.tapir.proto.ReplyConsensusMessage)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool ReplyConsensusMessage::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  if (_internal_has_opid()) {
+    if (!_impl_.opid_->IsInitialized()) return false;
+  }
+  return true;
+}
+
+void ReplyConsensusMessage::InternalSwap(ReplyConsensusMessage* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.result_, lhs_arena,
+      &other->_impl_.result_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(ReplyConsensusMessage, _impl_.replicaidx_)
+      + sizeof(ReplyConsensusMessage::_impl_.replicaidx_)
+      - PROTOBUF_FIELD_OFFSET(ReplyConsensusMessage, _impl_.opid_)>(
+          reinterpret_cast<char*>(&_impl_.opid_),
+          reinterpret_cast<char*>(&other->_impl_.opid_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata ReplyConsensusMessage::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_transaction_2ftapir_2ftapir_2dproto_2eproto_getter, &descriptor_table_transaction_2ftapir_2ftapir_2dproto_2eproto_once,
+      file_level_metadata_transaction_2ftapir_2ftapir_2dproto_2eproto[11]);
+}
+
+// ===================================================================
+
+class ConfirmMessage::_Internal {
+ public:
+  using HasBits = decltype(std::declval<ConfirmMessage>()._impl_._has_bits_);
+  static void set_has_view(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_replicaidx(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static const ::dsnet::transaction::tapir::proto::OpID& opid(const ConfirmMessage* msg);
+  static void set_has_opid(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000007) ^ 0x00000007) != 0;
+  }
+};
+
+const ::dsnet::transaction::tapir::proto::OpID&
+ConfirmMessage::_Internal::opid(const ConfirmMessage* msg) {
+  return *msg->_impl_.opid_;
+}
+ConfirmMessage::ConfirmMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:dsnet.transaction.tapir.proto.ConfirmMessage)
+}
+ConfirmMessage::ConfirmMessage(const ConfirmMessage& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  ConfirmMessage* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.opid_){nullptr}
+    , decltype(_impl_.view_){}
+    , decltype(_impl_.replicaidx_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  if (from._internal_has_opid()) {
+    _this->_impl_.opid_ = new ::dsnet::transaction::tapir::proto::OpID(*from._impl_.opid_);
+  }
+  ::memcpy(&_impl_.view_, &from._impl_.view_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.replicaidx_) -
+    reinterpret_cast<char*>(&_impl_.view_)) + sizeof(_impl_.replicaidx_));
+  // @@protoc_insertion_point(copy_constructor:dsnet.transaction.tapir.proto.ConfirmMessage)
+}
+
+inline void ConfirmMessage::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.opid_){nullptr}
+    , decltype(_impl_.view_){uint64_t{0u}}
+    , decltype(_impl_.replicaidx_){0u}
+  };
+}
+
+ConfirmMessage::~ConfirmMessage() {
+  // @@protoc_insertion_point(destructor:dsnet.transaction.tapir.proto.ConfirmMessage)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void ConfirmMessage::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  if (this != internal_default_instance()) delete _impl_.opid_;
+}
+
+void ConfirmMessage::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void ConfirmMessage::Clear() {
+// @@protoc_insertion_point(message_clear_start:dsnet.transaction.tapir.proto.ConfirmMessage)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    GOOGLE_DCHECK(_impl_.opid_ != nullptr);
+    _impl_.opid_->Clear();
+  }
+  if (cached_has_bits & 0x00000006u) {
+    ::memset(&_impl_.view_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.replicaidx_) -
+        reinterpret_cast<char*>(&_impl_.view_)) + sizeof(_impl_.replicaidx_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* ConfirmMessage::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required uint64 view = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_view(&has_bits);
+          _impl_.view_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required uint32 replicaIdx = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _Internal::set_has_replicaidx(&has_bits);
+          _impl_.replicaidx_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required .dsnet.transaction.tapir.proto.OpID opid = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          ptr = ctx->ParseMessage(_internal_mutable_opid(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* ConfirmMessage::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:dsnet.transaction.tapir.proto.ConfirmMessage)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required uint64 view = 1;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(1, this->_internal_view(), target);
+  }
+
+  // required uint32 replicaIdx = 2;
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(2, this->_internal_replicaidx(), target);
+  }
+
+  // required .dsnet.transaction.tapir.proto.OpID opid = 3;
+  if (cached_has_bits & 0x00000001u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(3, _Internal::opid(this),
+        _Internal::opid(this).GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:dsnet.transaction.tapir.proto.ConfirmMessage)
+  return target;
+}
+
+size_t ConfirmMessage::RequiredFieldsByteSizeFallback() const {
+// @@protoc_insertion_point(required_fields_byte_size_fallback_start:dsnet.transaction.tapir.proto.ConfirmMessage)
+  size_t total_size = 0;
+
+  if (_internal_has_opid()) {
+    // required .dsnet.transaction.tapir.proto.OpID opid = 3;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.opid_);
+  }
+
+  if (_internal_has_view()) {
+    // required uint64 view = 1;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_view());
+  }
+
+  if (_internal_has_replicaidx()) {
+    // required uint32 replicaIdx = 2;
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_replicaidx());
+  }
+
+  return total_size;
+}
+size_t ConfirmMessage::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:dsnet.transaction.tapir.proto.ConfirmMessage)
+  size_t total_size = 0;
+
+  if (((_impl_._has_bits_[0] & 0x00000007) ^ 0x00000007) == 0) {  // All required fields are present.
+    // required .dsnet.transaction.tapir.proto.OpID opid = 3;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.opid_);
+
+    // required uint64 view = 1;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_view());
+
+    // required uint32 replicaIdx = 2;
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_replicaidx());
+
+  } else {
+    total_size += RequiredFieldsByteSizeFallback();
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ConfirmMessage::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    ConfirmMessage::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ConfirmMessage::GetClassData() const { return &_class_data_; }
+
+
+void ConfirmMessage::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<ConfirmMessage*>(&to_msg);
+  auto& from = static_cast<const ConfirmMessage&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:dsnet.transaction.tapir.proto.ConfirmMessage)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_mutable_opid()->::dsnet::transaction::tapir::proto::OpID::MergeFrom(
+          from._internal_opid());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.view_ = from._impl_.view_;
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.replicaidx_ = from._impl_.replicaidx_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void ConfirmMessage::CopyFrom(const ConfirmMessage& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:dsnet.transaction.tapir.proto.ConfirmMessage)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool ConfirmMessage::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  if (_internal_has_opid()) {
+    if (!_impl_.opid_->IsInitialized()) return false;
+  }
+  return true;
+}
+
+void ConfirmMessage::InternalSwap(ConfirmMessage* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(ConfirmMessage, _impl_.replicaidx_)
+      + sizeof(ConfirmMessage::_impl_.replicaidx_)
+      - PROTOBUF_FIELD_OFFSET(ConfirmMessage, _impl_.opid_)>(
+          reinterpret_cast<char*>(&_impl_.opid_),
+          reinterpret_cast<char*>(&other->_impl_.opid_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata ConfirmMessage::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_transaction_2ftapir_2ftapir_2dproto_2eproto_getter, &descriptor_table_transaction_2ftapir_2ftapir_2dproto_2eproto_once,
+      file_level_metadata_transaction_2ftapir_2ftapir_2dproto_2eproto[12]);
+}
+
+// @@protoc_insertion_point(namespace_scope)
+}  // namespace proto
+}  // namespace tapir
+}  // namespace transaction
+}  // namespace dsnet
+PROTOBUF_NAMESPACE_OPEN
+template<> PROTOBUF_NOINLINE ::dsnet::transaction::tapir::proto::TimestampMessage*
+Arena::CreateMaybeMessage< ::dsnet::transaction::tapir::proto::TimestampMessage >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::dsnet::transaction::tapir::proto::TimestampMessage >(arena);
+}
+template<> PROTOBUF_NOINLINE ::dsnet::transaction::tapir::proto::Transaction*
+Arena::CreateMaybeMessage< ::dsnet::transaction::tapir::proto::Transaction >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::dsnet::transaction::tapir::proto::Transaction >(arena);
+}
+template<> PROTOBUF_NOINLINE ::dsnet::transaction::tapir::proto::ReplyMessage*
+Arena::CreateMaybeMessage< ::dsnet::transaction::tapir::proto::ReplyMessage >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::dsnet::transaction::tapir::proto::ReplyMessage >(arena);
+}
+template<> PROTOBUF_NOINLINE ::dsnet::transaction::tapir::proto::OpID*
+Arena::CreateMaybeMessage< ::dsnet::transaction::tapir::proto::OpID >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::dsnet::transaction::tapir::proto::OpID >(arena);
+}
+template<> PROTOBUF_NOINLINE ::dsnet::transaction::tapir::proto::ToServerMessage*
+Arena::CreateMaybeMessage< ::dsnet::transaction::tapir::proto::ToServerMessage >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::dsnet::transaction::tapir::proto::ToServerMessage >(arena);
+}
+template<> PROTOBUF_NOINLINE ::dsnet::transaction::tapir::proto::ProposeInconsistentMessage*
+Arena::CreateMaybeMessage< ::dsnet::transaction::tapir::proto::ProposeInconsistentMessage >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::dsnet::transaction::tapir::proto::ProposeInconsistentMessage >(arena);
+}
+template<> PROTOBUF_NOINLINE ::dsnet::transaction::tapir::proto::FinalizeInconsistentMessage*
+Arena::CreateMaybeMessage< ::dsnet::transaction::tapir::proto::FinalizeInconsistentMessage >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::dsnet::transaction::tapir::proto::FinalizeInconsistentMessage >(arena);
+}
+template<> PROTOBUF_NOINLINE ::dsnet::transaction::tapir::proto::ProposeConsensusMessage*
+Arena::CreateMaybeMessage< ::dsnet::transaction::tapir::proto::ProposeConsensusMessage >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::dsnet::transaction::tapir::proto::ProposeConsensusMessage >(arena);
+}
+template<> PROTOBUF_NOINLINE ::dsnet::transaction::tapir::proto::FinalizeConsensusMessage*
+Arena::CreateMaybeMessage< ::dsnet::transaction::tapir::proto::FinalizeConsensusMessage >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::dsnet::transaction::tapir::proto::FinalizeConsensusMessage >(arena);
+}
+template<> PROTOBUF_NOINLINE ::dsnet::transaction::tapir::proto::ToClientMessage*
+Arena::CreateMaybeMessage< ::dsnet::transaction::tapir::proto::ToClientMessage >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::dsnet::transaction::tapir::proto::ToClientMessage >(arena);
+}
+template<> PROTOBUF_NOINLINE ::dsnet::transaction::tapir::proto::ReplyInconsistentMessage*
+Arena::CreateMaybeMessage< ::dsnet::transaction::tapir::proto::ReplyInconsistentMessage >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::dsnet::transaction::tapir::proto::ReplyInconsistentMessage >(arena);
+}
+template<> PROTOBUF_NOINLINE ::dsnet::transaction::tapir::proto::ReplyConsensusMessage*
+Arena::CreateMaybeMessage< ::dsnet::transaction::tapir::proto::ReplyConsensusMessage >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::dsnet::transaction::tapir::proto::ReplyConsensusMessage >(arena);
+}
+template<> PROTOBUF_NOINLINE ::dsnet::transaction::tapir::proto::ConfirmMessage*
+Arena::CreateMaybeMessage< ::dsnet::transaction::tapir::proto::ConfirmMessage >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::dsnet::transaction::tapir::proto::ConfirmMessage >(arena);
+}
+PROTOBUF_NAMESPACE_CLOSE
+
+// @@protoc_insertion_point(global_scope)
+#include <google/protobuf/port_undef.inc>
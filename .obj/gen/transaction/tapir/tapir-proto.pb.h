@@ -0,0 +1,4644 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: transaction/tapir/tapir-proto.proto
+
+#ifndef GOOGLE_PROTOBUF_INCLUDED_transaction_2ftapir_2ftapir_2dproto_2eproto
+#define GOOGLE_PROTOBUF_INCLUDED_transaction_2ftapir_2ftapir_2dproto_2eproto
+
+#include <limits>
+#include <string>
+
+#include <google/protobuf/port_def.inc>
+#if PROTOBUF_VERSION < 3021000
+#error This file was generated by a newer version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please update
+#error your headers.
+#endif
+#if 3021012 < PROTOBUF_MIN_PROTOC_VERSION
+#error This file was generated by an older version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please
+#error regenerate this file with a newer version of protoc.
+#endif
+
+#include <google/protobuf/port_undef.inc>
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/arena.h>
+#include <google/protobuf/arenastring.h>
+#include <google/protobuf/generated_message_util.h>
+#include <google/protobuf/metadata_lite.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/message.h>
+#include <google/protobuf/repeated_field.h>  // IWYU pragma: export
+#include <google/protobuf/extension_set.h>  // IWYU pragma: export
+#include <google/protobuf/generated_enum_reflection.h>
+#include <google/protobuf/unknown_field_set.h>
+#include "common/request.pb.h"
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+#define PROTOBUF_INTERNAL_EXPORT_transaction_2ftapir_2ftapir_2dproto_2eproto
+PROTOBUF_NAMESPACE_OPEN
+namespace internal {
+class AnyMetadata;
+}  // namespace internal
+PROTOBUF_NAMESPACE_CLOSE
+
+// Internal implementation detail -- do not use these members.
+struct TableStruct_transaction_2ftapir_2ftapir_2dproto_2eproto {
+  static const uint32_t offsets[];
+};
+extern const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_transaction_2ftapir_2ftapir_2dproto_2eproto;
+namespace dsnet {
+namespace transaction {
+namespace tapir {
+namespace proto {
+class ConfirmMessage;
+struct ConfirmMessageDefaultTypeInternal;
+extern ConfirmMessageDefaultTypeInternal _ConfirmMessage_default_instance_;
+class FinalizeConsensusMessage;
+struct FinalizeConsensusMessageDefaultTypeInternal;
+extern FinalizeConsensusMessageDefaultTypeInternal _FinalizeConsensusMessage_default_instance_;
+class FinalizeInconsistentMessage;
+struct FinalizeInconsistentMessageDefaultTypeInternal;
+extern FinalizeInconsistentMessageDefaultTypeInternal _FinalizeInconsistentMessage_default_instance_;
+class OpID;
+struct OpIDDefaultTypeInternal;
+extern OpIDDefaultTypeInternal _OpID_default_instance_;
+class ProposeConsensusMessage;
+struct ProposeConsensusMessageDefaultTypeInternal;
+extern ProposeConsensusMessageDefaultTypeInternal _ProposeConsensusMessage_default_instance_;
+class ProposeInconsistentMessage;
+struct ProposeInconsistentMessageDefaultTypeInternal;
+extern ProposeInconsistentMessageDefaultTypeInternal _ProposeInconsistentMessage_default_instance_;
+class ReplyConsensusMessage;
+struct ReplyConsensusMessageDefaultTypeInternal;
+extern ReplyConsensusMessageDefaultTypeInternal _ReplyConsensusMessage_default_instance_;
+class ReplyInconsistentMessage;
+struct ReplyInconsistentMessageDefaultTypeInternal;
+extern ReplyInconsistentMessageDefaultTypeInternal _ReplyInconsistentMessage_default_instance_;
+class ReplyMessage;
+struct ReplyMessageDefaultTypeInternal;
+extern ReplyMessageDefaultTypeInternal _ReplyMessage_default_instance_;
+class TimestampMessage;
+struct TimestampMessageDefaultTypeInternal;
+extern TimestampMessageDefaultTypeInternal _TimestampMessage_default_instance_;
+class ToClientMessage;
+struct ToClientMessageDefaultTypeInternal;
+extern ToClientMessageDefaultTypeInternal _ToClientMessage_default_instance_;
+class ToServerMessage;
+struct ToServerMessageDefaultTypeInternal;
+extern ToServerMessageDefaultTypeInternal _ToServerMessage_default_instance_;
+class Transaction;
+struct TransactionDefaultTypeInternal;
+extern TransactionDefaultTypeInternal _Transaction_default_instance_;
+}  // namespace proto
+}  // namespace tapir
+}  // namespace transaction
+}  // namespace dsnet
+PROTOBUF_NAMESPACE_OPEN
+template<> ::dsnet::transaction::tapir::proto::ConfirmMessage* Arena::CreateMaybeMessage<::dsnet::transaction::tapir::proto::ConfirmMessage>(Arena*);
+template<> ::dsnet::transaction::tapir::proto::FinalizeConsensusMessage* Arena::CreateMaybeMessage<::dsnet::transaction::tapir::proto::FinalizeConsensusMessage>(Arena*);
+template<> ::dsnet::transaction::tapir::proto::FinalizeInconsistentMessage* Arena::CreateMaybeMessage<::dsnet::transaction::tapir::proto::FinalizeInconsistentMessage>(Arena*);
+template<> ::dsnet::transaction::tapir::proto::OpID* Arena::CreateMaybeMessage<::dsnet::transaction::tapir::proto::OpID>(Arena*);
+template<> ::dsnet::transaction::tapir::proto::ProposeConsensusMessage* Arena::CreateMaybeMessage<::dsnet::transaction::tapir::proto::ProposeConsensusMessage>(Arena*);
+template<> ::dsnet::transaction::tapir::proto::ProposeInconsistentMessage* Arena::CreateMaybeMessage<::dsnet::transaction::tapir::proto::ProposeInconsistentMessage>(Arena*);
+template<> ::dsnet::transaction::tapir::proto::ReplyConsensusMessage* Arena::CreateMaybeMessage<::dsnet::transaction::tapir::proto::ReplyConsensusMessage>(Arena*);
+template<> ::dsnet::transaction::tapir::proto::ReplyInconsistentMessage* Arena::CreateMaybeMessage<::dsnet::transaction::tapir::proto::ReplyInconsistentMessage>(Arena*);
+template<> ::dsnet::transaction::tapir::proto::ReplyMessage* Arena::CreateMaybeMessage<::dsnet::transaction::tapir::proto::ReplyMessage>(Arena*);
+template<> ::dsnet::transaction::tapir::proto::TimestampMessage* Arena::CreateMaybeMessage<::dsnet::transaction::tapir::proto::TimestampMessage>(Arena*);
+template<> ::dsnet::transaction::tapir::proto::ToClientMessage* Arena::CreateMaybeMessage<::dsnet::transaction::tapir::proto::ToClientMessage>(Arena*);
+template<> ::dsnet::transaction::tapir::proto::ToServerMessage* Arena::CreateMaybeMessage<::dsnet::transaction::tapir::proto::ToServerMessage>(Arena*);
+template<> ::dsnet::transaction::tapir::proto::Transaction* Arena::CreateMaybeMessage<::dsnet::transaction::tapir::proto::Transaction>(Arena*);
+PROTOBUF_NAMESPACE_CLOSE
+namespace dsnet {
+namespace transaction {
+namespace tapir {
+namespace proto {
+
+enum Transaction_Operation : int {
+  Transaction_Operation_UNKNOWN = 0,
+  Transaction_Operation_PREPARE = 1,
+  Transaction_Operation_COMMIT = 2,
+  Transaction_Operation_ABORT = 3
+};
+bool Transaction_Operation_IsValid(int value);
+constexpr Transaction_Operation Transaction_Operation_Operation_MIN = Transaction_Operation_UNKNOWN;
+constexpr Transaction_Operation Transaction_Operation_Operation_MAX = Transaction_Operation_ABORT;
+constexpr int Transaction_Operation_Operation_ARRAYSIZE = Transaction_Operation_Operation_MAX + 1;
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* Transaction_Operation_descriptor();
+template<typename T>
+inline const std::string& Transaction_Operation_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, Transaction_Operation>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function Transaction_Operation_Name.");
+  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
+    Transaction_Operation_descriptor(), enum_t_value);
+}
+inline bool Transaction_Operation_Parse(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, Transaction_Operation* value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<Transaction_Operation>(
+    Transaction_Operation_descriptor(), name, value);
+}
+enum ReplyMessage_Status : int {
+  ReplyMessage_Status_OK = 0,
+  ReplyMessage_Status_FAILED = 1,
+  ReplyMessage_Status_RETRY = 2
+};
+bool ReplyMessage_Status_IsValid(int value);
+constexpr ReplyMessage_Status ReplyMessage_Status_Status_MIN = ReplyMessage_Status_OK;
+constexpr ReplyMessage_Status ReplyMessage_Status_Status_MAX = ReplyMessage_Status_RETRY;
+constexpr int ReplyMessage_Status_Status_ARRAYSIZE = ReplyMessage_Status_Status_MAX + 1;
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* ReplyMessage_Status_descriptor();
+template<typename T>
+inline const std::string& ReplyMessage_Status_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, ReplyMessage_Status>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function ReplyMessage_Status_Name.");
+  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
+    ReplyMessage_Status_descriptor(), enum_t_value);
+}
+inline bool ReplyMessage_Status_Parse(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, ReplyMessage_Status* value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<ReplyMessage_Status>(
+    ReplyMessage_Status_descriptor(), name, value);
+}
+// ===================================================================
+
+class TimestampMessage final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:dsnet.transaction.tapir.proto.TimestampMessage) */ {
+ public:
+  inline TimestampMessage() : TimestampMessage(nullptr) {}
+  ~TimestampMessage() override;
+  explicit PROTOBUF_CONSTEXPR TimestampMessage(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  TimestampMessage(const TimestampMessage& from);
+  TimestampMessage(TimestampMessage&& from) noexcept
+    : TimestampMessage() {
+    *this = ::std::move(from);
+  }
+
+  inline TimestampMessage& operator=(const TimestampMessage& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline TimestampMessage& operator=(TimestampMessage&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const TimestampMessage& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const TimestampMessage* internal_default_instance() {
+    return reinterpret_cast<const TimestampMessage*>(
+               &_TimestampMessage_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    0;
+
+  friend void swap(TimestampMessage& a, TimestampMessage& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(TimestampMessage* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(TimestampMessage* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  TimestampMessage* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<TimestampMessage>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const TimestampMessage& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const TimestampMessage& from) {
+    TimestampMessage::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(TimestampMessage* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "dsnet.transaction.tapir.proto.TimestampMessage";
+  }
+  protected:
+  explicit TimestampMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kIdFieldNumber = 1,
+    kTimestampFieldNumber = 2,
+  };
+  // required uint64 id = 1;
+  bool has_id() const;
+  private:
+  bool _internal_has_id() const;
+  public:
+  void clear_id();
+  uint64_t id() const;
+  void set_id(uint64_t value);
+  private:
+  uint64_t _internal_id() const;
+  void _internal_set_id(uint64_t value);
+  public:
+
+  // required uint64 timestamp = 2;
+  bool has_timestamp() const;
+  private:
+  bool _internal_has_timestamp() const;
+  public:
+  void clear_timestamp();
+  uint64_t timestamp() const;
+  void set_timestamp(uint64_t value);
+  private:
+  uint64_t _internal_timestamp() const;
+  void _internal_set_timestamp(uint64_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:dsnet.transaction.tapir.proto.TimestampMessage)
+ private:
+  class _Internal;
+
+  // helper for ByteSizeLong()
+  size_t RequiredFieldsByteSizeFallback() const;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    uint64_t id_;
+    uint64_t timestamp_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_transaction_2ftapir_2ftapir_2dproto_2eproto;
+};
+// -------------------------------------------------------------------
+
+class Transaction final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:dsnet.transaction.tapir.proto.Transaction) */ {
+ public:
+  inline Transaction() : Transaction(nullptr) {}
+  ~Transaction() override;
+  explicit PROTOBUF_CONSTEXPR Transaction(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  Transaction(const Transaction& from);
+  Transaction(Transaction&& from) noexcept
+    : Transaction() {
+    *this = ::std::move(from);
+  }
+
+  inline Transaction& operator=(const Transaction& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline Transaction& operator=(Transaction&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const Transaction& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const Transaction* internal_default_instance() {
+    return reinterpret_cast<const Transaction*>(
+               &_Transaction_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    1;
+
+  friend void swap(Transaction& a, Transaction& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(Transaction* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Transaction* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  Transaction* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<Transaction>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const Transaction& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const Transaction& from) {
+    Transaction::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(Transaction* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "dsnet.transaction.tapir.proto.Transaction";
+  }
+  protected:
+  explicit Transaction(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  typedef Transaction_Operation Operation;
+  static constexpr Operation UNKNOWN =
+    Transaction_Operation_UNKNOWN;
+  static constexpr Operation PREPARE =
+    Transaction_Operation_PREPARE;
+  static constexpr Operation COMMIT =
+    Transaction_Operation_COMMIT;
+  static constexpr Operation ABORT =
+    Transaction_Operation_ABORT;
+  static inline bool Operation_IsValid(int value) {
+    return Transaction_Operation_IsValid(value);
+  }
+  static constexpr Operation Operation_MIN =
+    Transaction_Operation_Operation_MIN;
+  static constexpr Operation Operation_MAX =
+    Transaction_Operation_Operation_MAX;
+  static constexpr int Operation_ARRAYSIZE =
+    Transaction_Operation_Operation_ARRAYSIZE;
+  static inline const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor*
+  Operation_descriptor() {
+    return Transaction_Operation_descriptor();
+  }
+  template<typename T>
+  static inline const std::string& Operation_Name(T enum_t_value) {
+    static_assert(::std::is_same<T, Operation>::value ||
+      ::std::is_integral<T>::value,
+      "Incorrect type passed to function Operation_Name.");
+    return Transaction_Operation_Name(enum_t_value);
+  }
+  static inline bool Operation_Parse(::PROTOBUF_NAMESPACE_ID::ConstStringParam name,
+      Operation* value) {
+    return Transaction_Operation_Parse(name, value);
+  }
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kTxnFieldNumber = 3,
+    kTxnidFieldNumber = 1,
+    kOpFieldNumber = 2,
+  };
+  // required bytes txn = 3;
+  bool has_txn() const;
+  private:
+  bool _internal_has_txn() const;
+  public:
+  void clear_txn();
+  const std::string& txn() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_txn(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_txn();
+  PROTOBUF_NODISCARD std::string* release_txn();
+  void set_allocated_txn(std::string* txn);
+  private:
+  const std::string& _internal_txn() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_txn(const std::string& value);
+  std::string* _internal_mutable_txn();
+  public:
+
+  // required uint64 txnid = 1;
+  bool has_txnid() const;
+  private:
+  bool _internal_has_txnid() const;
+  public:
+  void clear_txnid();
+  uint64_t txnid() const;
+  void set_txnid(uint64_t value);
+  private:
+  uint64_t _internal_txnid() const;
+  void _internal_set_txnid(uint64_t value);
+  public:
+
+  // required .dsnet.transaction.tapir.proto.Transaction.Operation op = 2;
+  bool has_op() const;
+  private:
+  bool _internal_has_op() const;
+  public:
+  void clear_op();
+  ::dsnet::transaction::tapir::proto::Transaction_Operation op() const;
+  void set_op(::dsnet::transaction::tapir::proto::Transaction_Operation value);
+  private:
+  ::dsnet::transaction::tapir::proto::Transaction_Operation _internal_op() const;
+  void _internal_set_op(::dsnet::transaction::tapir::proto::Transaction_Operation value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:dsnet.transaction.tapir.proto.Transaction)
+ private:
+  class _Internal;
+
+  // helper for ByteSizeLong()
+  size_t RequiredFieldsByteSizeFallback() const;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr txn_;
+    uint64_t txnid_;
+    int op_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_transaction_2ftapir_2ftapir_2dproto_2eproto;
+};
+// -------------------------------------------------------------------
+
+class ReplyMessage final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:dsnet.transaction.tapir.proto.ReplyMessage) */ {
+ public:
+  inline ReplyMessage() : ReplyMessage(nullptr) {}
+  ~ReplyMessage() override;
+  explicit PROTOBUF_CONSTEXPR ReplyMessage(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  ReplyMessage(const ReplyMessage& from);
+  ReplyMessage(ReplyMessage&& from) noexcept
+    : ReplyMessage() {
+    *this = ::std::move(from);
+  }
+
+  inline ReplyMessage& operator=(const ReplyMessage& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline ReplyMessage& operator=(ReplyMessage&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ReplyMessage& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const ReplyMessage* internal_default_instance() {
+    return reinterpret_cast<const ReplyMessage*>(
+               &_ReplyMessage_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    2;
+
+  friend void swap(ReplyMessage& a, ReplyMessage& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(ReplyMessage* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ReplyMessage* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  ReplyMessage* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ReplyMessage>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const ReplyMessage& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ReplyMessage& from) {
+    ReplyMessage::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(ReplyMessage* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "dsnet.transaction.tapir.proto.ReplyMessage";
+  }
+  protected:
+  explicit ReplyMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  typedef ReplyMessage_Status Status;
+  static constexpr Status OK =
+    ReplyMessage_Status_OK;
+  static constexpr Status FAILED =
+    ReplyMessage_Status_FAILED;
+  static constexpr Status RETRY =
+    ReplyMessage_Status_RETRY;
+  static inline bool Status_IsValid(int value) {
+    return ReplyMessage_Status_IsValid(value);
+  }
+  static constexpr Status Status_MIN =
+    ReplyMessage_Status_Status_MIN;
+  static constexpr Status Status_MAX =
+    ReplyMessage_Status_Status_MAX;
+  static constexpr int Status_ARRAYSIZE =
+    ReplyMessage_Status_Status_ARRAYSIZE;
+  static inline const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor*
+  Status_descriptor() {
+    return ReplyMessage_Status_descriptor();
+  }
+  template<typename T>
+  static inline const std::string& Status_Name(T enum_t_value) {
+    static_assert(::std::is_same<T, Status>::value ||
+      ::std::is_integral<T>::value,
+      "Incorrect type passed to function Status_Name.");
+    return ReplyMessage_Status_Name(enum_t_value);
+  }
+  static inline bool Status_Parse(::PROTOBUF_NAMESPACE_ID::ConstStringParam name,
+      Status* value) {
+    return ReplyMessage_Status_Parse(name, value);
+  }
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kReplyFieldNumber = 2,
+    kStatusFieldNumber = 1,
+  };
+  // optional bytes reply = 2;
+  bool has_reply() const;
+  private:
+  bool _internal_has_reply() const;
+  public:
+  void clear_reply();
+  const std::string& reply() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_reply(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_reply();
+  PROTOBUF_NODISCARD std::string* release_reply();
+  void set_allocated_reply(std::string* reply);
+  private:
+  const std::string& _internal_reply() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_reply(const std::string& value);
+  std::string* _internal_mutable_reply();
+  public:
+
+  // required .dsnet.transaction.tapir.proto.ReplyMessage.Status status = 1;
+  bool has_status() const;
+  private:
+  bool _internal_has_status() const;
+  public:
+  void clear_status();
+  ::dsnet::transaction::tapir::proto::ReplyMessage_Status status() const;
+  void set_status(::dsnet::transaction::tapir::proto::ReplyMessage_Status value);
+  private:
+  ::dsnet::transaction::tapir::proto::ReplyMessage_Status _internal_status() const;
+  void _internal_set_status(::dsnet::transaction::tapir::proto::ReplyMessage_Status value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:dsnet.transaction.tapir.proto.ReplyMessage)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr reply_;
+    int status_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_transaction_2ftapir_2ftapir_2dproto_2eproto;
+};
+// -------------------------------------------------------------------
+
+class OpID final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:dsnet.transaction.tapir.proto.OpID) */ {
+ public:
+  inline OpID() : OpID(nullptr) {}
+  ~OpID() override;
+  explicit PROTOBUF_CONSTEXPR OpID(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  OpID(const OpID& from);
+  OpID(OpID&& from) noexcept
+    : OpID() {
+    *this = ::std::move(from);
+  }
+
+  inline OpID& operator=(const OpID& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline OpID& operator=(OpID&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const OpID& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const OpID* internal_default_instance() {
+    return reinterpret_cast<const OpID*>(
+               &_OpID_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    3;
+
+  friend void swap(OpID& a, OpID& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(OpID* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(OpID* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  OpID* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<OpID>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const OpID& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const OpID& from) {
+    OpID::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(OpID* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "dsnet.transaction.tapir.proto.OpID";
+  }
+  protected:
+  explicit OpID(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kClientidFieldNumber = 1,
+    kClientreqidFieldNumber = 2,
+  };
+  // required uint64 clientid = 1;
+  bool has_clientid() const;
+  private:
+  bool _internal_has_clientid() const;
+  public:
+  void clear_clientid();
+  uint64_t clientid() const;
+  void set_clientid(uint64_t value);
+  private:
+  uint64_t _internal_clientid() const;
+  void _internal_set_clientid(uint64_t value);
+  public:
+
+  // required uint64 clientreqid = 2;
+  bool has_clientreqid() const;
+  private:
+  bool _internal_has_clientreqid() const;
+  public:
+  void clear_clientreqid();
+  uint64_t clientreqid() const;
+  void set_clientreqid(uint64_t value);
+  private:
+  uint64_t _internal_clientreqid() const;
+  void _internal_set_clientreqid(uint64_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:dsnet.transaction.tapir.proto.OpID)
+ private:
+  class _Internal;
+
+  // helper for ByteSizeLong()
+  size_t RequiredFieldsByteSizeFallback() const;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    uint64_t clientid_;
+    uint64_t clientreqid_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_transaction_2ftapir_2ftapir_2dproto_2eproto;
+};
+// -------------------------------------------------------------------
+
+class ToServerMessage final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:dsnet.transaction.tapir.proto.ToServerMessage) */ {
+ public:
+  inline ToServerMessage() : ToServerMessage(nullptr) {}
+  ~ToServerMessage() override;
+  explicit PROTOBUF_CONSTEXPR ToServerMessage(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  ToServerMessage(const ToServerMessage& from);
+  ToServerMessage(ToServerMessage&& from) noexcept
+    : ToServerMessage() {
+    *this = ::std::move(from);
+  }
+
+  inline ToServerMessage& operator=(const ToServerMessage& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline ToServerMessage& operator=(ToServerMessage&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ToServerMessage& default_instance() {
+    return *internal_default_instance();
+  }
+  enum MsgCase {
+    kProposeInconsistent = 1,
+    kFinalizeInconsistent = 2,
+    kProposeConsensus = 3,
+    kFinalizeConsensus = 4,
+    MSG_NOT_SET = 0,
+  };
+
+  static inline const ToServerMessage* internal_default_instance() {
+    return reinterpret_cast<const ToServerMessage*>(
+               &_ToServerMessage_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    4;
+
+  friend void swap(ToServerMessage& a, ToServerMessage& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(ToServerMessage* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ToServerMessage* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  ToServerMessage* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ToServerMessage>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const ToServerMessage& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ToServerMessage& from) {
+    ToServerMessage::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(ToServerMessage* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "dsnet.transaction.tapir.proto.ToServerMessage";
+  }
+  protected:
+  explicit ToServerMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kProposeInconsistentFieldNumber = 1,
+    kFinalizeInconsistentFieldNumber = 2,
+    kProposeConsensusFieldNumber = 3,
+    kFinalizeConsensusFieldNumber = 4,
+  };
+  // .dsnet.transaction.tapir.proto.ProposeInconsistentMessage propose_inconsistent = 1;
+  bool has_propose_inconsistent() const;
+  private:
+  bool _internal_has_propose_inconsistent() const;
+  public:
+  void clear_propose_inconsistent();
+  const ::dsnet::transaction::tapir::proto::ProposeInconsistentMessage& propose_inconsistent() const;
+  PROTOBUF_NODISCARD ::dsnet::transaction::tapir::proto::ProposeInconsistentMessage* release_propose_inconsistent();
+  ::dsnet::transaction::tapir::proto::ProposeInconsistentMessage* mutable_propose_inconsistent();
+  void set_allocated_propose_inconsistent(::dsnet::transaction::tapir::proto::ProposeInconsistentMessage* propose_inconsistent);
+  private:
+  const ::dsnet::transaction::tapir::proto::ProposeInconsistentMessage& _internal_propose_inconsistent() const;
+  ::dsnet::transaction::tapir::proto::ProposeInconsistentMessage* _internal_mutable_propose_inconsistent();
+  public:
+  void unsafe_arena_set_allocated_propose_inconsistent(
+      ::dsnet::transaction::tapir::proto::ProposeInconsistentMessage* propose_inconsistent);
+  ::dsnet::transaction::tapir::proto::ProposeInconsistentMessage* unsafe_arena_release_propose_inconsistent();
+
+  // .dsnet.transaction.tapir.proto.FinalizeInconsistentMessage finalize_inconsistent = 2;
+  bool has_finalize_inconsistent() const;
+  private:
+  bool _internal_has_finalize_inconsistent() const;
+  public:
+  void clear_finalize_inconsistent();
+  const ::dsnet::transaction::tapir::proto::FinalizeInconsistentMessage& finalize_inconsistent() const;
+  PROTOBUF_NODISCARD ::dsnet::transaction::tapir::proto::FinalizeInconsistentMessage* release_finalize_inconsistent();
+  ::dsnet::transaction::tapir::proto::FinalizeInconsistentMessage* mutable_finalize_inconsistent();
+  void set_allocated_finalize_inconsistent(::dsnet::transaction::tapir::proto::FinalizeInconsistentMessage* finalize_inconsistent);
+  private:
+  const ::dsnet::transaction::tapir::proto::FinalizeInconsistentMessage& _internal_finalize_inconsistent() const;
+  ::dsnet::transaction::tapir::proto::FinalizeInconsistentMessage* _internal_mutable_finalize_inconsistent();
+  public:
+  void unsafe_arena_set_allocated_finalize_inconsistent(
+      ::dsnet::transaction::tapir::proto::FinalizeInconsistentMessage* finalize_inconsistent);
+  ::dsnet::transaction::tapir::proto::FinalizeInconsistentMessage* unsafe_arena_release_finalize_inconsistent();
+
+  // .dsnet.transaction.tapir.proto.ProposeConsensusMessage propose_consensus = 3;
+  bool has_propose_consensus() const;
+  private:
+  bool _internal_has_propose_consensus() const;
+  public:
+  void clear_propose_consensus();
+  const ::dsnet::transaction::tapir::proto::ProposeConsensusMessage& propose_consensus() const;
+  PROTOBUF_NODISCARD ::dsnet::transaction::tapir::proto::ProposeConsensusMessage* release_propose_consensus();
+  ::dsnet::transaction::tapir::proto::ProposeConsensusMessage* mutable_propose_consensus();
+  void set_allocated_propose_consensus(::dsnet::transaction::tapir::proto::ProposeConsensusMessage* propose_consensus);
+  private:
+  const ::dsnet::transaction::tapir::proto::ProposeConsensusMessage& _internal_propose_consensus() const;
+  ::dsnet::transaction::tapir::proto::ProposeConsensusMessage* _internal_mutable_propose_consensus();
+  public:
+  void unsafe_arena_set_allocated_propose_consensus(
+      ::dsnet::transaction::tapir::proto::ProposeConsensusMessage* propose_consensus);
+  ::dsnet::transaction::tapir::proto::ProposeConsensusMessage* unsafe_arena_release_propose_consensus();
+
+  // .dsnet.transaction.tapir.proto.FinalizeConsensusMessage finalize_consensus = 4;
+  bool has_finalize_consensus() const;
+  private:
+  bool _internal_has_finalize_consensus() const;
+  public:
+  void clear_finalize_consensus();
+  const ::dsnet::transaction::tapir::proto::FinalizeConsensusMessage& finalize_consensus() const;
+  PROTOBUF_NODISCARD ::dsnet::transaction::tapir::proto::FinalizeConsensusMessage* release_finalize_consensus();
+  ::dsnet::transaction::tapir::proto::FinalizeConsensusMessage* mutable_finalize_consensus();
+  void set_allocated_finalize_consensus(::dsnet::transaction::tapir::proto::FinalizeConsensusMessage* finalize_consensus);
+  private:
+  const ::dsnet::transaction::tapir::proto::FinalizeConsensusMessage& _internal_finalize_consensus() const;
+  ::dsnet::transaction::tapir::proto::FinalizeConsensusMessage* _internal_mutable_finalize_consensus();
+  public:
+  void unsafe_arena_set_allocated_finalize_consensus(
+      ::dsnet::transaction::tapir::proto::FinalizeConsensusMessage* finalize_consensus);
+  ::dsnet::transaction::tapir::proto::FinalizeConsensusMessage* unsafe_arena_release_finalize_consensus();
+
+  void clear_msg();
+  MsgCase msg_case() const;
+  // @@protoc_insertion_point(class_scope:dsnet.transaction.tapir.proto.ToServerMessage)
+ private:
+  class _Internal;
+  void set_has_propose_inconsistent();
+  void set_has_finalize_inconsistent();
+  void set_has_propose_consensus();
+  void set_has_finalize_consensus();
+
+  inline bool has_msg() const;
+  inline void clear_has_msg();
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    union MsgUnion {
+      constexpr MsgUnion() : _constinit_{} {}
+        ::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized _constinit_;
+      ::dsnet::transaction::tapir::proto::ProposeInconsistentMessage* propose_inconsistent_;
+      ::dsnet::transaction::tapir::proto::FinalizeInconsistentMessage* finalize_inconsistent_;
+      ::dsnet::transaction::tapir::proto::ProposeConsensusMessage* propose_consensus_;
+      ::dsnet::transaction::tapir::proto::FinalizeConsensusMessage* finalize_consensus_;
+    } msg_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    uint32_t _oneof_case_[1];
+
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_transaction_2ftapir_2ftapir_2dproto_2eproto;
+};
+// -------------------------------------------------------------------
+
+class ProposeInconsistentMessage final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:dsnet.transaction.tapir.proto.ProposeInconsistentMessage) */ {
+ public:
+  inline ProposeInconsistentMessage() : ProposeInconsistentMessage(nullptr) {}
+  ~ProposeInconsistentMessage() override;
+  explicit PROTOBUF_CONSTEXPR ProposeInconsistentMessage(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  ProposeInconsistentMessage(const ProposeInconsistentMessage& from);
+  ProposeInconsistentMessage(ProposeInconsistentMessage&& from) noexcept
+    : ProposeInconsistentMessage() {
+    *this = ::std::move(from);
+  }
+
+  inline ProposeInconsistentMessage& operator=(const ProposeInconsistentMessage& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline ProposeInconsistentMessage& operator=(ProposeInconsistentMessage&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ProposeInconsistentMessage& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const ProposeInconsistentMessage* internal_default_instance() {
+    return reinterpret_cast<const ProposeInconsistentMessage*>(
+               &_ProposeInconsistentMessage_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    5;
+
+  friend void swap(ProposeInconsistentMessage& a, ProposeInconsistentMessage& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(ProposeInconsistentMessage* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ProposeInconsistentMessage* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  ProposeInconsistentMessage* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ProposeInconsistentMessage>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const ProposeInconsistentMessage& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ProposeInconsistentMessage& from) {
+    ProposeInconsistentMessage::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(ProposeInconsistentMessage* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "dsnet.transaction.tapir.proto.ProposeInconsistentMessage";
+  }
+  protected:
+  explicit ProposeInconsistentMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kReqFieldNumber = 1,
+  };
+  // required .dsnet.Request req = 1;
+  bool has_req() const;
+  private:
+  bool _internal_has_req() const;
+  public:
+  void clear_req();
+  const ::dsnet::Request& req() const;
+  PROTOBUF_NODISCARD ::dsnet::Request* release_req();
+  ::dsnet::Request* mutable_req();
+  void set_allocated_req(::dsnet::Request* req);
+  private:
+  const ::dsnet::Request& _internal_req() const;
+  ::dsnet::Request* _internal_mutable_req();
+  public:
+  void unsafe_arena_set_allocated_req(
+      ::dsnet::Request* req);
+  ::dsnet::Request* unsafe_arena_release_req();
+
+  // @@protoc_insertion_point(class_scope:dsnet.transaction.tapir.proto.ProposeInconsistentMessage)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::dsnet::Request* req_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_transaction_2ftapir_2ftapir_2dproto_2eproto;
+};
+// -------------------------------------------------------------------
+
+class FinalizeInconsistentMessage final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:dsnet.transaction.tapir.proto.FinalizeInconsistentMessage) */ {
+ public:
+  inline FinalizeInconsistentMessage() : FinalizeInconsistentMessage(nullptr) {}
+  ~FinalizeInconsistentMessage() override;
+  explicit PROTOBUF_CONSTEXPR FinalizeInconsistentMessage(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  FinalizeInconsistentMessage(const FinalizeInconsistentMessage& from);
+  FinalizeInconsistentMessage(FinalizeInconsistentMessage&& from) noexcept
+    : FinalizeInconsistentMessage() {
+    *this = ::std::move(from);
+  }
+
+  inline FinalizeInconsistentMessage& operator=(const FinalizeInconsistentMessage& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline FinalizeInconsistentMessage& operator=(FinalizeInconsistentMessage&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const FinalizeInconsistentMessage& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const FinalizeInconsistentMessage* internal_default_instance() {
+    return reinterpret_cast<const FinalizeInconsistentMessage*>(
+               &_FinalizeInconsistentMessage_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    6;
+
+  friend void swap(FinalizeInconsistentMessage& a, FinalizeInconsistentMessage& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(FinalizeInconsistentMessage* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(FinalizeInconsistentMessage* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  FinalizeInconsistentMessage* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<FinalizeInconsistentMessage>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const FinalizeInconsistentMessage& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const FinalizeInconsistentMessage& from) {
+    FinalizeInconsistentMessage::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(FinalizeInconsistentMessage* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "dsnet.transaction.tapir.proto.FinalizeInconsistentMessage";
+  }
+  protected:
+  explicit FinalizeInconsistentMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kOpidFieldNumber = 1,
+  };
+  // required .dsnet.transaction.tapir.proto.OpID opid = 1;
+  bool has_opid() const;
+  private:
+  bool _internal_has_opid() const;
+  public:
+  void clear_opid();
+  const ::dsnet::transaction::tapir::proto::OpID& opid() const;
+  PROTOBUF_NODISCARD ::dsnet::transaction::tapir::proto::OpID* release_opid();
+  ::dsnet::transaction::tapir::proto::OpID* mutable_opid();
+  void set_allocated_opid(::dsnet::transaction::tapir::proto::OpID* opid);
+  private:
+  const ::dsnet::transaction::tapir::proto::OpID& _internal_opid() const;
+  ::dsnet::transaction::tapir::proto::OpID* _internal_mutable_opid();
+  public:
+  void unsafe_arena_set_allocated_opid(
+      ::dsnet::transaction::tapir::proto::OpID* opid);
+  ::dsnet::transaction::tapir::proto::OpID* unsafe_arena_release_opid();
+
+  // @@protoc_insertion_point(class_scope:dsnet.transaction.tapir.proto.FinalizeInconsistentMessage)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::dsnet::transaction::tapir::proto::OpID* opid_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_transaction_2ftapir_2ftapir_2dproto_2eproto;
+};
+// -------------------------------------------------------------------
+
+class ProposeConsensusMessage final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:dsnet.transaction.tapir.proto.ProposeConsensusMessage) */ {
+ public:
+  inline ProposeConsensusMessage() : ProposeConsensusMessage(nullptr) {}
+  ~ProposeConsensusMessage() override;
+  explicit PROTOBUF_CONSTEXPR ProposeConsensusMessage(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  ProposeConsensusMessage(const ProposeConsensusMessage& from);
+  ProposeConsensusMessage(ProposeConsensusMessage&& from) noexcept
+    : ProposeConsensusMessage() {
+    *this = ::std::move(from);
+  }
+
+  inline ProposeConsensusMessage& operator=(const ProposeConsensusMessage& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline ProposeConsensusMessage& operator=(ProposeConsensusMessage&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ProposeConsensusMessage& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const ProposeConsensusMessage* internal_default_instance() {
+    return reinterpret_cast<const ProposeConsensusMessage*>(
+               &_ProposeConsensusMessage_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    7;
+
+  friend void swap(ProposeConsensusMessage& a, ProposeConsensusMessage& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(ProposeConsensusMessage* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ProposeConsensusMessage* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  ProposeConsensusMessage* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ProposeConsensusMessage>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const ProposeConsensusMessage& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ProposeConsensusMessage& from) {
+    ProposeConsensusMessage::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(ProposeConsensusMessage* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "dsnet.transaction.tapir.proto.ProposeConsensusMessage";
+  }
+  protected:
+  explicit ProposeConsensusMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kReqFieldNumber = 1,
+  };
+  // required .dsnet.Request req = 1;
+  bool has_req() const;
+  private:
+  bool _internal_has_req() const;
+  public:
+  void clear_req();
+  const ::dsnet::Request& req() const;
+  PROTOBUF_NODISCARD ::dsnet::Request* release_req();
+  ::dsnet::Request* mutable_req();
+  void set_allocated_req(::dsnet::Request* req);
+  private:
+  const ::dsnet::Request& _internal_req() const;
+  ::dsnet::Request* _internal_mutable_req();
+  public:
+  void unsafe_arena_set_allocated_req(
+      ::dsnet::Request* req);
+  ::dsnet::Request* unsafe_arena_release_req();
+
+  // @@protoc_insertion_point(class_scope:dsnet.transaction.tapir.proto.ProposeConsensusMessage)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::dsnet::Request* req_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_transaction_2ftapir_2ftapir_2dproto_2eproto;
+};
+// -------------------------------------------------------------------
+
+class FinalizeConsensusMessage final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:dsnet.transaction.tapir.proto.FinalizeConsensusMessage) */ {
+ public:
+  inline FinalizeConsensusMessage() : FinalizeConsensusMessage(nullptr) {}
+  ~FinalizeConsensusMessage() override;
+  explicit PROTOBUF_CONSTEXPR FinalizeConsensusMessage(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  FinalizeConsensusMessage(const FinalizeConsensusMessage& from);
+  FinalizeConsensusMessage(FinalizeConsensusMessage&& from) noexcept
+    : FinalizeConsensusMessage() {
+    *this = ::std::move(from);
+  }
+
+  inline FinalizeConsensusMessage& operator=(const FinalizeConsensusMessage& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline FinalizeConsensusMessage& operator=(FinalizeConsensusMessage&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const FinalizeConsensusMessage& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const FinalizeConsensusMessage* internal_default_instance() {
+    return reinterpret_cast<const FinalizeConsensusMessage*>(
+               &_FinalizeConsensusMessage_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    8;
+
+  friend void swap(FinalizeConsensusMessage& a, FinalizeConsensusMessage& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(FinalizeConsensusMessage* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(FinalizeConsensusMessage* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  FinalizeConsensusMessage* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<FinalizeConsensusMessage>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const FinalizeConsensusMessage& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const FinalizeConsensusMessage& from) {
+    FinalizeConsensusMessage::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(FinalizeConsensusMessage* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "dsnet.transaction.tapir.proto.FinalizeConsensusMessage";
+  }
+  protected:
+  explicit FinalizeConsensusMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kResultFieldNumber = 2,
+    kOpidFieldNumber = 1,
+  };
+  // required bytes result = 2;
+  bool has_result() const;
+  private:
+  bool _internal_has_result() const;
+  public:
+  void clear_result();
+  const std::string& result() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_result(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_result();
+  PROTOBUF_NODISCARD std::string* release_result();
+  void set_allocated_result(std::string* result);
+  private:
+  const std::string& _internal_result() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_result(const std::string& value);
+  std::string* _internal_mutable_result();
+  public:
+
+  // required .dsnet.transaction.tapir.proto.OpID opid = 1;
+  bool has_opid() const;
+  private:
+  bool _internal_has_opid() const;
+  public:
+  void clear_opid();
+  const ::dsnet::transaction::tapir::proto::OpID& opid() const;
+  PROTOBUF_NODISCARD ::dsnet::transaction::tapir::proto::OpID* release_opid();
+  ::dsnet::transaction::tapir::proto::OpID* mutable_opid();
+  void set_allocated_opid(::dsnet::transaction::tapir::proto::OpID* opid);
+  private:
+  const ::dsnet::transaction::tapir::proto::OpID& _internal_opid() const;
+  ::dsnet::transaction::tapir::proto::OpID* _internal_mutable_opid();
+  public:
+  void unsafe_arena_set_allocated_opid(
+      ::dsnet::transaction::tapir::proto::OpID* opid);
+  ::dsnet::transaction::tapir::proto::OpID* unsafe_arena_release_opid();
+
+  // @@protoc_insertion_point(class_scope:dsnet.transaction.tapir.proto.FinalizeConsensusMessage)
+ private:
+  class _Internal;
+
+  // helper for ByteSizeLong()
+  size_t RequiredFieldsByteSizeFallback() const;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr result_;
+    ::dsnet::transaction::tapir::proto::OpID* opid_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_transaction_2ftapir_2ftapir_2dproto_2eproto;
+};
+// -------------------------------------------------------------------
+
+class ToClientMessage final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:dsnet.transaction.tapir.proto.ToClientMessage) */ {
+ public:
+  inline ToClientMessage() : ToClientMessage(nullptr) {}
+  ~ToClientMessage() override;
+  explicit PROTOBUF_CONSTEXPR ToClientMessage(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  ToClientMessage(const ToClientMessage& from);
+  ToClientMessage(ToClientMessage&& from) noexcept
+    : ToClientMessage() {
+    *this = ::std::move(from);
+  }
+
+  inline ToClientMessage& operator=(const ToClientMessage& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline ToClientMessage& operator=(ToClientMessage&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ToClientMessage& default_instance() {
+    return *internal_default_instance();
+  }
+  enum MsgCase {
+    kInconsistentReply = 1,
+    kConsensusReply = 2,
+    kConfirm = 3,
+    MSG_NOT_SET = 0,
+  };
+
+  static inline const ToClientMessage* internal_default_instance() {
+    return reinterpret_cast<const ToClientMessage*>(
+               &_ToClientMessage_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    9;
+
+  friend void swap(ToClientMessage& a, ToClientMessage& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(ToClientMessage* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ToClientMessage* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  ToClientMessage* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ToClientMessage>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const ToClientMessage& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ToClientMessage& from) {
+    ToClientMessage::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(ToClientMessage* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "dsnet.transaction.tapir.proto.ToClientMessage";
+  }
+  protected:
+  explicit ToClientMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kInconsistentReplyFieldNumber = 1,
+    kConsensusReplyFieldNumber = 2,
+    kConfirmFieldNumber = 3,
+  };
+  // .dsnet.transaction.tapir.proto.ReplyInconsistentMessage inconsistent_reply = 1;
+  bool has_inconsistent_reply() const;
+  private:
+  bool _internal_has_inconsistent_reply() const;
+  public:
+  void clear_inconsistent_reply();
+  const ::dsnet::transaction::tapir::proto::ReplyInconsistentMessage& inconsistent_reply() const;
+  PROTOBUF_NODISCARD ::dsnet::transaction::tapir::proto::ReplyInconsistentMessage* release_inconsistent_reply();
+  ::dsnet::transaction::tapir::proto::ReplyInconsistentMessage* mutable_inconsistent_reply();
+  void set_allocated_inconsistent_reply(::dsnet::transaction::tapir::proto::ReplyInconsistentMessage* inconsistent_reply);
+  private:
+  const ::dsnet::transaction::tapir::proto::ReplyInconsistentMessage& _internal_inconsistent_reply() const;
+  ::dsnet::transaction::tapir::proto::ReplyInconsistentMessage* _internal_mutable_inconsistent_reply();
+  public:
+  void unsafe_arena_set_allocated_inconsistent_reply(
+      ::dsnet::transaction::tapir::proto::ReplyInconsistentMessage* inconsistent_reply);
+  ::dsnet::transaction::tapir::proto::ReplyInconsistentMessage* unsafe_arena_release_inconsistent_reply();
+
+  // .dsnet.transaction.tapir.proto.ReplyConsensusMessage consensus_reply = 2;
+  bool has_consensus_reply() const;
+  private:
+  bool _internal_has_consensus_reply() const;
+  public:
+  void clear_consensus_reply();
+  const ::dsnet::transaction::tapir::proto::ReplyConsensusMessage& consensus_reply() const;
+  PROTOBUF_NODISCARD ::dsnet::transaction::tapir::proto::ReplyConsensusMessage* release_consensus_reply();
+  ::dsnet::transaction::tapir::proto::ReplyConsensusMessage* mutable_consensus_reply();
+  void set_allocated_consensus_reply(::dsnet::transaction::tapir::proto::ReplyConsensusMessage* consensus_reply);
+  private:
+  const ::dsnet::transaction::tapir::proto::ReplyConsensusMessage& _internal_consensus_reply() const;
+  ::dsnet::transaction::tapir::proto::ReplyConsensusMessage* _internal_mutable_consensus_reply();
+  public:
+  void unsafe_arena_set_allocated_consensus_reply(
+      ::dsnet::transaction::tapir::proto::ReplyConsensusMessage* consensus_reply);
+  ::dsnet::transaction::tapir::proto::ReplyConsensusMessage* unsafe_arena_release_consensus_reply();
+
+  // .dsnet.transaction.tapir.proto.ConfirmMessage confirm = 3;
+  bool has_confirm() const;
+  private:
+  bool _internal_has_confirm() const;
+  public:
+  void clear_confirm();
+  const ::dsnet::transaction::tapir::proto::ConfirmMessage& confirm() const;
+  PROTOBUF_NODISCARD ::dsnet::transaction::tapir::proto::ConfirmMessage* release_confirm();
+  ::dsnet::transaction::tapir::proto::ConfirmMessage* mutable_confirm();
+  void set_allocated_confirm(::dsnet::transaction::tapir::proto::ConfirmMessage* confirm);
+  private:
+  const ::dsnet::transaction::tapir::proto::ConfirmMessage& _internal_confirm() const;
+  ::dsnet::transaction::tapir::proto::ConfirmMessage* _internal_mutable_confirm();
+  public:
+  void unsafe_arena_set_allocated_confirm(
+      ::dsnet::transaction::tapir::proto::ConfirmMessage* confirm);
+  ::dsnet::transaction::tapir::proto::ConfirmMessage* unsafe_arena_release_confirm();
+
+  void clear_msg();
+  MsgCase msg_case() const;
+  // @@protoc_insertion_point(class_scope:dsnet.transaction.tapir.proto.ToClientMessage)
+ private:
+  class _Internal;
+  void set_has_inconsistent_reply();
+  void set_has_consensus_reply();
+  void set_has_confirm();
+
+  inline bool has_msg() const;
+  inline void clear_has_msg();
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    union MsgUnion {
+      constexpr MsgUnion() : _constinit_{} {}
+        ::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized _constinit_;
+      ::dsnet::transaction::tapir::proto::ReplyInconsistentMessage* inconsistent_reply_;
+      ::dsnet::transaction::tapir::proto::ReplyConsensusMessage* consensus_reply_;
+      ::dsnet::transaction::tapir::proto::ConfirmMessage* confirm_;
+    } msg_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    uint32_t _oneof_case_[1];
+
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_transaction_2ftapir_2ftapir_2dproto_2eproto;
+};
+// -------------------------------------------------------------------
+
+class ReplyInconsistentMessage final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:dsnet.transaction.tapir.proto.ReplyInconsistentMessage) */ {
+ public:
+  inline ReplyInconsistentMessage() : ReplyInconsistentMessage(nullptr) {}
+  ~ReplyInconsistentMessage() override;
+  explicit PROTOBUF_CONSTEXPR ReplyInconsistentMessage(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  ReplyInconsistentMessage(const ReplyInconsistentMessage& from);
+  ReplyInconsistentMessage(ReplyInconsistentMessage&& from) noexcept
+    : ReplyInconsistentMessage() {
+    *this = ::std::move(from);
+  }
+
+  inline ReplyInconsistentMessage& operator=(const ReplyInconsistentMessage& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline ReplyInconsistentMessage& operator=(ReplyInconsistentMessage&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ReplyInconsistentMessage& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const ReplyInconsistentMessage* internal_default_instance() {
+    return reinterpret_cast<const ReplyInconsistentMessage*>(
+               &_ReplyInconsistentMessage_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    10;
+
+  friend void swap(ReplyInconsistentMessage& a, ReplyInconsistentMessage& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(ReplyInconsistentMessage* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ReplyInconsistentMessage* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  ReplyInconsistentMessage* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ReplyInconsistentMessage>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const ReplyInconsistentMessage& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ReplyInconsistentMessage& from) {
+    ReplyInconsistentMessage::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(ReplyInconsistentMessage* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "dsnet.transaction.tapir.proto.ReplyInconsistentMessage";
+  }
+  protected:
+  explicit ReplyInconsistentMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kOpidFieldNumber = 3,
+    kViewFieldNumber = 1,
+    kReplicaIdxFieldNumber = 2,
+  };
+  // required .dsnet.transaction.tapir.proto.OpID opid = 3;
+  bool has_opid() const;
+  private:
+  bool _internal_has_opid() const;
+  public:
+  void clear_opid();
+  const ::dsnet::transaction::tapir::proto::OpID& opid() const;
+  PROTOBUF_NODISCARD ::dsnet::transaction::tapir::proto::OpID* release_opid();
+  ::dsnet::transaction::tapir::proto::OpID* mutable_opid();
+  void set_allocated_opid(::dsnet::transaction::tapir::proto::OpID* opid);
+  private:
+  const ::dsnet::transaction::tapir::proto::OpID& _internal_opid() const;
+  ::dsnet::transaction::tapir::proto::OpID* _internal_mutable_opid();
+  public:
+  void unsafe_arena_set_allocated_opid(
+      ::dsnet::transaction::tapir::proto::OpID* opid);
+  ::dsnet::transaction::tapir::proto::OpID* unsafe_arena_release_opid();
+
+  // required uint64 view = 1;
+  bool has_view() const;
+  private:
+  bool _internal_has_view() const;
+  public:
+  void clear_view();
+  uint64_t view() const;
+  void set_view(uint64_t value);
+  private:
+  uint64_t _internal_view() const;
+  void _internal_set_view(uint64_t value);
+  public:
+
+  // required uint32 replicaIdx = 2;
+  bool has_replicaidx() const;
+  private:
+  bool _internal_has_replicaidx() const;
+  public:
+  void clear_replicaidx();
+  uint32_t replicaidx() const;
+  void set_replicaidx(uint32_t value);
+  private:
+  uint32_t _internal_replicaidx() const;
+  void _internal_set_replicaidx(uint32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:dsnet.transaction.tapir.proto.ReplyInconsistentMessage)
+ private:
+  class _Internal;
+
+  // helper for ByteSizeLong()
+  size_t RequiredFieldsByteSizeFallback() const;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::dsnet::transaction::tapir::proto::OpID* opid_;
+    uint64_t view_;
+    uint32_t replicaidx_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_transaction_2ftapir_2ftapir_2dproto_2eproto;
+};
+// -------------------------------------------------------------------
+
+class ReplyConsensusMessage final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:dsnet.transaction.tapir.proto.ReplyConsensusMessage) */ {
+ public:
+  inline ReplyConsensusMessage() : ReplyConsensusMessage(nullptr) {}
+  ~ReplyConsensusMessage() override;
+  explicit PROTOBUF_CONSTEXPR ReplyConsensusMessage(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  ReplyConsensusMessage(const ReplyConsensusMessage& from);
+  ReplyConsensusMessage(ReplyConsensusMessage&& from) noexcept
+    : ReplyConsensusMessage() {
+    *this = ::std::move(from);
+  }
+
+  inline ReplyConsensusMessage& operator=(const ReplyConsensusMessage& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline ReplyConsensusMessage& operator=(ReplyConsensusMessage&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ReplyConsensusMessage& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const ReplyConsensusMessage* internal_default_instance() {
+    return reinterpret_cast<const ReplyConsensusMessage*>(
+               &_ReplyConsensusMessage_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    11;
+
+  friend void swap(ReplyConsensusMessage& a, ReplyConsensusMessage& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(ReplyConsensusMessage* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ReplyConsensusMessage* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  ReplyConsensusMessage* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ReplyConsensusMessage>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const ReplyConsensusMessage& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ReplyConsensusMessage& from) {
+    ReplyConsensusMessage::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(ReplyConsensusMessage* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "dsnet.transaction.tapir.proto.ReplyConsensusMessage";
+  }
+  protected:
+  explicit ReplyConsensusMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kResultFieldNumber = 4,
+    kOpidFieldNumber = 3,
+    kViewFieldNumber = 1,
+    kReplicaIdxFieldNumber = 2,
+  };
+  // required bytes result = 4;
+  bool has_result() const;
+  private:
+  bool _internal_has_result() const;
+  public:
+  void clear_result();
+  const std::string& result() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_result(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_result();
+  PROTOBUF_NODISCARD std::string* release_result();
+  void set_allocated_result(std::string* result);
+  private:
+  const std::string& _internal_result() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_result(const std::string& value);
+  std::string* _internal_mutable_result();
+  public:
+
+  // required .dsnet.transaction.tapir.proto.OpID opid = 3;
+  bool has_opid() const;
+  private:
+  bool _internal_has_opid() const;
+  public:
+  void clear_opid();
+  const ::dsnet::transaction::tapir::proto::OpID& opid() const;
+  PROTOBUF_NODISCARD ::dsnet::transaction::tapir::proto::OpID* release_opid();
+  ::dsnet::transaction::tapir::proto::OpID* mutable_opid();
+  void set_allocated_opid(::dsnet::transaction::tapir::proto::OpID* opid);
+  private:
+  const ::dsnet::transaction::tapir::proto::OpID& _internal_opid() const;
+  ::dsnet::transaction::tapir::proto::OpID* _internal_mutable_opid();
+  public:
+  void unsafe_arena_set_allocated_opid(
+      ::dsnet::transaction::tapir::proto::OpID* opid);
+  ::dsnet::transaction::tapir::proto::OpID* unsafe_arena_release_opid();
+
+  // required uint64 view = 1;
+  bool has_view() const;
+  private:
+  bool _internal_has_view() const;
+  public:
+  void clear_view();
+  uint64_t view() const;
+  void set_view(uint64_t value);
+  private:
+  uint64_t _internal_view() const;
+  void _internal_set_view(uint64_t value);
+  public:
+
+  // required uint32 replicaIdx = 2;
+  bool has_replicaidx() const;
+  private:
+  bool _internal_has_replicaidx() const;
+  public:
+  void clear_replicaidx();
+  uint32_t replicaidx() const;
+  void set_replicaidx(uint32_t value);
+  private:
+  uint32_t _internal_replicaidx() const;
+  void _internal_set_replicaidx(uint32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:dsnet.transaction.tapir.proto.ReplyConsensusMessage)
+ private:
+  class _Internal;
+
+  // helper for ByteSizeLong()
+  size_t RequiredFieldsByteSizeFallback() const;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr result_;
+    ::dsnet::transaction::tapir::proto::OpID* opid_;
+    uint64_t view_;
+    uint32_t replicaidx_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_transaction_2ftapir_2ftapir_2dproto_2eproto;
+};
+// -------------------------------------------------------------------
+
+class ConfirmMessage final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:dsnet.transaction.tapir.proto.ConfirmMessage) */ {
+ public:
+  inline ConfirmMessage() : ConfirmMessage(nullptr) {}
+  ~ConfirmMessage() override;
+  explicit PROTOBUF_CONSTEXPR ConfirmMessage(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  ConfirmMessage(const ConfirmMessage& from);
+  ConfirmMessage(ConfirmMessage&& from) noexcept
+    : ConfirmMessage() {
+    *this = ::std::move(from);
+  }
+
+  inline ConfirmMessage& operator=(const ConfirmMessage& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline ConfirmMessage& operator=(ConfirmMessage&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ConfirmMessage& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const ConfirmMessage* internal_default_instance() {
+    return reinterpret_cast<const ConfirmMessage*>(
+               &_ConfirmMessage_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    12;
+
+  friend void swap(ConfirmMessage& a, ConfirmMessage& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(ConfirmMessage* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ConfirmMessage* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  ConfirmMessage* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ConfirmMessage>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const ConfirmMessage& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ConfirmMessage& from) {
+    ConfirmMessage::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(ConfirmMessage* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "dsnet.transaction.tapir.proto.ConfirmMessage";
+  }
+  protected:
+  explicit ConfirmMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kOpidFieldNumber = 3,
+    kViewFieldNumber = 1,
+    kReplicaIdxFieldNumber = 2,
+  };
+  // required .dsnet.transaction.tapir.proto.OpID opid = 3;
+  bool has_opid() const;
+  private:
+  bool _internal_has_opid() const;
+  public:
+  void clear_opid();
+  const ::dsnet::transaction::tapir::proto::OpID& opid() const;
+  PROTOBUF_NODISCARD ::dsnet::transaction::tapir::proto::OpID* release_opid();
+  ::dsnet::transaction::tapir::proto::OpID* mutable_opid();
+  void set_allocated_opid(::dsnet::transaction::tapir::proto::OpID* opid);
+  private:
+  const ::dsnet::transaction::tapir::proto::OpID& _internal_opid() const;
+  ::dsnet::transaction::tapir::proto::OpID* _internal_mutable_opid();
+  public:
+  void unsafe_arena_set_allocated_opid(
+      ::dsnet::transaction::tapir::proto::OpID* opid);
+  ::dsnet::transaction::tapir::proto::OpID* unsafe_arena_release_opid();
+
+  // required uint64 view = 1;
+  bool has_view() const;
+  private:
+  bool _internal_has_view() const;
+  public:
+  void clear_view();
+  uint64_t view() const;
+  void set_view(uint64_t value);
+  private:
+  uint64_t _internal_view() const;
+  void _internal_set_view(uint64_t value);
+  public:
+
+  // required uint32 replicaIdx = 2;
+  bool has_replicaidx() const;
+  private:
+  bool _internal_has_replicaidx() const;
+  public:
+  void clear_replicaidx();
+  uint32_t replicaidx() const;
+  void set_replicaidx(uint32_t value);
+  private:
+  uint32_t _internal_replicaidx() const;
+  void _internal_set_replicaidx(uint32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:dsnet.transaction.tapir.proto.ConfirmMessage)
+ private:
+  class _Internal;
+
+  // helper for ByteSizeLong()
+  size_t RequiredFieldsByteSizeFallback() const;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::dsnet::transaction::tapir::proto::OpID* opid_;
+    uint64_t view_;
+    uint32_t replicaidx_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_transaction_2ftapir_2ftapir_2dproto_2eproto;
+};
+// ===================================================================
+
+
+// ===================================================================
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
+#endif  // __GNUC__
+// TimestampMessage
+
+// required uint64 id = 1;
+inline bool TimestampMessage::_internal_has_id() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool TimestampMessage::has_id() const {
+  return _internal_has_id();
+}
+inline void TimestampMessage::clear_id() {
+  _impl_.id_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline uint64_t TimestampMessage::_internal_id() const {
+  return _impl_.id_;
+}
+inline uint64_t TimestampMessage::id() const {
+  // @@protoc_insertion_point(field_get:dsnet.transaction.tapir.proto.TimestampMessage.id)
+  return _internal_id();
+}
+inline void TimestampMessage::_internal_set_id(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.id_ = value;
+}
+inline void TimestampMessage::set_id(uint64_t value) {
+  _internal_set_id(value);
+  // @@protoc_insertion_point(field_set:dsnet.transaction.tapir.proto.TimestampMessage.id)
+}
+
+// required uint64 timestamp = 2;
+inline bool TimestampMessage::_internal_has_timestamp() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool TimestampMessage::has_timestamp() const {
+  return _internal_has_timestamp();
+}
+inline void TimestampMessage::clear_timestamp() {
+  _impl_.timestamp_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline uint64_t TimestampMessage::_internal_timestamp() const {
+  return _impl_.timestamp_;
+}
+inline uint64_t TimestampMessage::timestamp() const {
+  // @@protoc_insertion_point(field_get:dsnet.transaction.tapir.proto.TimestampMessage.timestamp)
+  return _internal_timestamp();
+}
+inline void TimestampMessage::_internal_set_timestamp(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.timestamp_ = value;
+}
+inline void TimestampMessage::set_timestamp(uint64_t value) {
+  _internal_set_timestamp(value);
+  // @@protoc_insertion_point(field_set:dsnet.transaction.tapir.proto.TimestampMessage.timestamp)
+}
+
+// -------------------------------------------------------------------
+
+// Transaction
+
+// required uint64 txnid = 1;
+inline bool Transaction::_internal_has_txnid() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool Transaction::has_txnid() const {
+  return _internal_has_txnid();
+}
+inline void Transaction::clear_txnid() {
+  _impl_.txnid_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline uint64_t Transaction::_internal_txnid() const {
+  return _impl_.txnid_;
+}
+inline uint64_t Transaction::txnid() const {
+  // @@protoc_insertion_point(field_get:dsnet.transaction.tapir.proto.Transaction.txnid)
+  return _internal_txnid();
+}
+inline void Transaction::_internal_set_txnid(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.txnid_ = value;
+}
+inline void Transaction::set_txnid(uint64_t value) {
+  _internal_set_txnid(value);
+  // @@protoc_insertion_point(field_set:dsnet.transaction.tapir.proto.Transaction.txnid)
+}
+
+// required .dsnet.transaction.tapir.proto.Transaction.Operation op = 2;
+inline bool Transaction::_internal_has_op() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool Transaction::has_op() const {
+  return _internal_has_op();
+}
+inline void Transaction::clear_op() {
+  _impl_.op_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline ::dsnet::transaction::tapir::proto::Transaction_Operation Transaction::_internal_op() const {
+  return static_cast< ::dsnet::transaction::tapir::proto::Transaction_Operation >(_impl_.op_);
+}
+inline ::dsnet::transaction::tapir::proto::Transaction_Operation Transaction::op() const {
+  // @@protoc_insertion_point(field_get:dsnet.transaction.tapir.proto.Transaction.op)
+  return _internal_op();
+}
+inline void Transaction::_internal_set_op(::dsnet::transaction::tapir::proto::Transaction_Operation value) {
+  assert(::dsnet::transaction::tapir::proto::Transaction_Operation_IsValid(value));
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.op_ = value;
+}
+inline void Transaction::set_op(::dsnet::transaction::tapir::proto::Transaction_Operation value) {
+  _internal_set_op(value);
+  // @@protoc_insertion_point(field_set:dsnet.transaction.tapir.proto.Transaction.op)
+}
+
+// required bytes txn = 3;
+inline bool Transaction::_internal_has_txn() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool Transaction::has_txn() const {
+  return _internal_has_txn();
+}
+inline void Transaction::clear_txn() {
+  _impl_.txn_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& Transaction::txn() const {
+  // @@protoc_insertion_point(field_get:dsnet.transaction.tapir.proto.Transaction.txn)
+  return _internal_txn();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void Transaction::set_txn(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.txn_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:dsnet.transaction.tapir.proto.Transaction.txn)
+}
+inline std::string* Transaction::mutable_txn() {
+  std::string* _s = _internal_mutable_txn();
+  // @@protoc_insertion_point(field_mutable:dsnet.transaction.tapir.proto.Transaction.txn)
+  return _s;
+}
+inline const std::string& Transaction::_internal_txn() const {
+  return _impl_.txn_.Get();
+}
+inline void Transaction::_internal_set_txn(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.txn_.Set(value, GetArenaForAllocation());
+}
+inline std::string* Transaction::_internal_mutable_txn() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.txn_.Mutable(GetArenaForAllocation());
+}
+inline std::string* Transaction::release_txn() {
+  // @@protoc_insertion_point(field_release:dsnet.transaction.tapir.proto.Transaction.txn)
+  if (!_internal_has_txn()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.txn_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.txn_.IsDefault()) {
+    _impl_.txn_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void Transaction::set_allocated_txn(std::string* txn) {
+  if (txn != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.txn_.SetAllocated(txn, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.txn_.IsDefault()) {
+    _impl_.txn_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:dsnet.transaction.tapir.proto.Transaction.txn)
+}
+
+// -------------------------------------------------------------------
+
+// ReplyMessage
+
+// required .dsnet.transaction.tapir.proto.ReplyMessage.Status status = 1;
+inline bool ReplyMessage::_internal_has_status() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool ReplyMessage::has_status() const {
+  return _internal_has_status();
+}
+inline void ReplyMessage::clear_status() {
+  _impl_.status_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline ::dsnet::transaction::tapir::proto::ReplyMessage_Status ReplyMessage::_internal_status() const {
+  return static_cast< ::dsnet::transaction::tapir::proto::ReplyMessage_Status >(_impl_.status_);
+}
+inline ::dsnet::transaction::tapir::proto::ReplyMessage_Status ReplyMessage::status() const {
+  // @@protoc_insertion_point(field_get:dsnet.transaction.tapir.proto.ReplyMessage.status)
+  return _internal_status();
+}
+inline void ReplyMessage::_internal_set_status(::dsnet::transaction::tapir::proto::ReplyMessage_Status value) {
+  assert(::dsnet::transaction::tapir::proto::ReplyMessage_Status_IsValid(value));
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.status_ = value;
+}
+inline void ReplyMessage::set_status(::dsnet::transaction::tapir::proto::ReplyMessage_Status value) {
+  _internal_set_status(value);
+  // @@protoc_insertion_point(field_set:dsnet.transaction.tapir.proto.ReplyMessage.status)
+}
+
+// optional bytes reply = 2;
+inline bool ReplyMessage::_internal_has_reply() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool ReplyMessage::has_reply() const {
+  return _internal_has_reply();
+}
+inline void ReplyMessage::clear_reply() {
+  _impl_.reply_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& ReplyMessage::reply() const {
+  // @@protoc_insertion_point(field_get:dsnet.transaction.tapir.proto.ReplyMessage.reply)
+  return _internal_reply();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void ReplyMessage::set_reply(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.reply_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:dsnet.transaction.tapir.proto.ReplyMessage.reply)
+}
+inline std::string* ReplyMessage::mutable_reply() {
+  std::string* _s = _internal_mutable_reply();
+  // @@protoc_insertion_point(field_mutable:dsnet.transaction.tapir.proto.ReplyMessage.reply)
+  return _s;
+}
+inline const std::string& ReplyMessage::_internal_reply() const {
+  return _impl_.reply_.Get();
+}
+inline void ReplyMessage::_internal_set_reply(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.reply_.Set(value, GetArenaForAllocation());
+}
+inline std::string* ReplyMessage::_internal_mutable_reply() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.reply_.Mutable(GetArenaForAllocation());
+}
+inline std::string* ReplyMessage::release_reply() {
+  // @@protoc_insertion_point(field_release:dsnet.transaction.tapir.proto.ReplyMessage.reply)
+  if (!_internal_has_reply()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.reply_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.reply_.IsDefault()) {
+    _impl_.reply_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void ReplyMessage::set_allocated_reply(std::string* reply) {
+  if (reply != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.reply_.SetAllocated(reply, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.reply_.IsDefault()) {
+    _impl_.reply_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:dsnet.transaction.tapir.proto.ReplyMessage.reply)
+}
+
+// -------------------------------------------------------------------
+
+// OpID
+
+// required uint64 clientid = 1;
+inline bool OpID::_internal_has_clientid() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool OpID::has_clientid() const {
+  return _internal_has_clientid();
+}
+inline void OpID::clear_clientid() {
+  _impl_.clientid_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline uint64_t OpID::_internal_clientid() const {
+  return _impl_.clientid_;
+}
+inline uint64_t OpID::clientid() const {
+  // @@protoc_insertion_point(field_get:dsnet.transaction.tapir.proto.OpID.clientid)
+  return _internal_clientid();
+}
+inline void OpID::_internal_set_clientid(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.clientid_ = value;
+}
+inline void OpID::set_clientid(uint64_t value) {
+  _internal_set_clientid(value);
+  // @@protoc_insertion_point(field_set:dsnet.transaction.tapir.proto.OpID.clientid)
+}
+
+// required uint64 clientreqid = 2;
+inline bool OpID::_internal_has_clientreqid() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool OpID::has_clientreqid() const {
+  return _internal_has_clientreqid();
+}
+inline void OpID::clear_clientreqid() {
+  _impl_.clientreqid_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline uint64_t OpID::_internal_clientreqid() const {
+  return _impl_.clientreqid_;
+}
+inline uint64_t OpID::clientreqid() const {
+  // @@protoc_insertion_point(field_get:dsnet.transaction.tapir.proto.OpID.clientreqid)
+  return _internal_clientreqid();
+}
+inline void OpID::_internal_set_clientreqid(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.clientreqid_ = value;
+}
+inline void OpID::set_clientreqid(uint64_t value) {
+  _internal_set_clientreqid(value);
+  // @@protoc_insertion_point(field_set:dsnet.transaction.tapir.proto.OpID.clientreqid)
+}
+
+// -------------------------------------------------------------------
+
+// ToServerMessage
+
+// .dsnet.transaction.tapir.proto.ProposeInconsistentMessage propose_inconsistent = 1;
+inline bool ToServerMessage::_internal_has_propose_inconsistent() const {
+  return msg_case() == kProposeInconsistent;
+}
+inline bool ToServerMessage::has_propose_inconsistent() const {
+  return _internal_has_propose_inconsistent();
+}
+inline void ToServerMessage::set_has_propose_inconsistent() {
+  _impl_._oneof_case_[0] = kProposeInconsistent;
+}
+inline void ToServerMessage::clear_propose_inconsistent() {
+  if (_internal_has_propose_inconsistent()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.msg_.propose_inconsistent_;
+    }
+    clear_has_msg();
+  }
+}
+inline ::dsnet::transaction::tapir::proto::ProposeInconsistentMessage* ToServerMessage::release_propose_inconsistent() {
+  // @@protoc_insertion_point(field_release:dsnet.transaction.tapir.proto.ToServerMessage.propose_inconsistent)
+  if (_internal_has_propose_inconsistent()) {
+    clear_has_msg();
+    ::dsnet::transaction::tapir::proto::ProposeInconsistentMessage* temp = _impl_.msg_.propose_inconsistent_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.msg_.propose_inconsistent_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::dsnet::transaction::tapir::proto::ProposeInconsistentMessage& ToServerMessage::_internal_propose_inconsistent() const {
+  return _internal_has_propose_inconsistent()
+      ? *_impl_.msg_.propose_inconsistent_
+      : reinterpret_cast< ::dsnet::transaction::tapir::proto::ProposeInconsistentMessage&>(::dsnet::transaction::tapir::proto::_ProposeInconsistentMessage_default_instance_);
+}
+inline const ::dsnet::transaction::tapir::proto::ProposeInconsistentMessage& ToServerMessage::propose_inconsistent() const {
+  // @@protoc_insertion_point(field_get:dsnet.transaction.tapir.proto.ToServerMessage.propose_inconsistent)
+  return _internal_propose_inconsistent();
+}
+inline ::dsnet::transaction::tapir::proto::ProposeInconsistentMessage* ToServerMessage::unsafe_arena_release_propose_inconsistent() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:dsnet.transaction.tapir.proto.ToServerMessage.propose_inconsistent)
+  if (_internal_has_propose_inconsistent()) {
+    clear_has_msg();
+    ::dsnet::transaction::tapir::proto::ProposeInconsistentMessage* temp = _impl_.msg_.propose_inconsistent_;
+    _impl_.msg_.propose_inconsistent_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void ToServerMessage::unsafe_arena_set_allocated_propose_inconsistent(::dsnet::transaction::tapir::proto::ProposeInconsistentMessage* propose_inconsistent) {
+  clear_msg();
+  if (propose_inconsistent) {
+    set_has_propose_inconsistent();
+    _impl_.msg_.propose_inconsistent_ = propose_inconsistent;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:dsnet.transaction.tapir.proto.ToServerMessage.propose_inconsistent)
+}
+inline ::dsnet::transaction::tapir::proto::ProposeInconsistentMessage* ToServerMessage::_internal_mutable_propose_inconsistent() {
+  if (!_internal_has_propose_inconsistent()) {
+    clear_msg();
+    set_has_propose_inconsistent();
+    _impl_.msg_.propose_inconsistent_ = CreateMaybeMessage< ::dsnet::transaction::tapir::proto::ProposeInconsistentMessage >(GetArenaForAllocation());
+  }
+  return _impl_.msg_.propose_inconsistent_;
+}
+inline ::dsnet::transaction::tapir::proto::ProposeInconsistentMessage* ToServerMessage::mutable_propose_inconsistent() {
+  ::dsnet::transaction::tapir::proto::ProposeInconsistentMessage* _msg = _internal_mutable_propose_inconsistent();
+  // @@protoc_insertion_point(field_mutable:dsnet.transaction.tapir.proto.ToServerMessage.propose_inconsistent)
+  return _msg;
+}
+
+// .dsnet.transaction.tapir.proto.FinalizeInconsistentMessage finalize_inconsistent = 2;
+inline bool ToServerMessage::_internal_has_finalize_inconsistent() const {
+  return msg_case() == kFinalizeInconsistent;
+}
+inline bool ToServerMessage::has_finalize_inconsistent() const {
+  return _internal_has_finalize_inconsistent();
+}
+inline void ToServerMessage::set_has_finalize_inconsistent() {
+  _impl_._oneof_case_[0] = kFinalizeInconsistent;
+}
+inline void ToServerMessage::clear_finalize_inconsistent() {
+  if (_internal_has_finalize_inconsistent()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.msg_.finalize_inconsistent_;
+    }
+    clear_has_msg();
+  }
+}
+inline ::dsnet::transaction::tapir::proto::FinalizeInconsistentMessage* ToServerMessage::release_finalize_inconsistent() {
+  // @@protoc_insertion_point(field_release:dsnet.transaction.tapir.proto.ToServerMessage.finalize_inconsistent)
+  if (_internal_has_finalize_inconsistent()) {
+    clear_has_msg();
+    ::dsnet::transaction::tapir::proto::FinalizeInconsistentMessage* temp = _impl_.msg_.finalize_inconsistent_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.msg_.finalize_inconsistent_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::dsnet::transaction::tapir::proto::FinalizeInconsistentMessage& ToServerMessage::_internal_finalize_inconsistent() const {
+  return _internal_has_finalize_inconsistent()
+      ? *_impl_.msg_.finalize_inconsistent_
+      : reinterpret_cast< ::dsnet::transaction::tapir::proto::FinalizeInconsistentMessage&>(::dsnet::transaction::tapir::proto::_FinalizeInconsistentMessage_default_instance_);
+}
+inline const ::dsnet::transaction::tapir::proto::FinalizeInconsistentMessage& ToServerMessage::finalize_inconsistent() const {
+  // @@protoc_insertion_point(field_get:dsnet.transaction.tapir.proto.ToServerMessage.finalize_inconsistent)
+  return _internal_finalize_inconsistent();
+}
+inline ::dsnet::transaction::tapir::proto::FinalizeInconsistentMessage* ToServerMessage::unsafe_arena_release_finalize_inconsistent() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:dsnet.transaction.tapir.proto.ToServerMessage.finalize_inconsistent)
+  if (_internal_has_finalize_inconsistent()) {
+    clear_has_msg();
+    ::dsnet::transaction::tapir::proto::FinalizeInconsistentMessage* temp = _impl_.msg_.finalize_inconsistent_;
+    _impl_.msg_.finalize_inconsistent_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void ToServerMessage::unsafe_arena_set_allocated_finalize_inconsistent(::dsnet::transaction::tapir::proto::FinalizeInconsistentMessage* finalize_inconsistent) {
+  clear_msg();
+  if (finalize_inconsistent) {
+    set_has_finalize_inconsistent();
+    _impl_.msg_.finalize_inconsistent_ = finalize_inconsistent;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:dsnet.transaction.tapir.proto.ToServerMessage.finalize_inconsistent)
+}
+inline ::dsnet::transaction::tapir::proto::FinalizeInconsistentMessage* ToServerMessage::_internal_mutable_finalize_inconsistent() {
+  if (!_internal_has_finalize_inconsistent()) {
+    clear_msg();
+    set_has_finalize_inconsistent();
+    _impl_.msg_.finalize_inconsistent_ = CreateMaybeMessage< ::dsnet::transaction::tapir::proto::FinalizeInconsistentMessage >(GetArenaForAllocation());
+  }
+  return _impl_.msg_.finalize_inconsistent_;
+}
+inline ::dsnet::transaction::tapir::proto::FinalizeInconsistentMessage* ToServerMessage::mutable_finalize_inconsistent() {
+  ::dsnet::transaction::tapir::proto::FinalizeInconsistentMessage* _msg = _internal_mutable_finalize_inconsistent();
+  // @@protoc_insertion_point(field_mutable:dsnet.transaction.tapir.proto.ToServerMessage.finalize_inconsistent)
+  return _msg;
+}
+
+// .dsnet.transaction.tapir.proto.ProposeConsensusMessage propose_consensus = 3;
+inline bool ToServerMessage::_internal_has_propose_consensus() const {
+  return msg_case() == kProposeConsensus;
+}
+inline bool ToServerMessage::has_propose_consensus() const {
+  return _internal_has_propose_consensus();
+}
+inline void ToServerMessage::set_has_propose_consensus() {
+  _impl_._oneof_case_[0] = kProposeConsensus;
+}
+inline void ToServerMessage::clear_propose_consensus() {
+  if (_internal_has_propose_consensus()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.msg_.propose_consensus_;
+    }
+    clear_has_msg();
+  }
+}
+inline ::dsnet::transaction::tapir::proto::ProposeConsensusMessage* ToServerMessage::release_propose_consensus() {
+  // @@protoc_insertion_point(field_release:dsnet.transaction.tapir.proto.ToServerMessage.propose_consensus)
+  if (_internal_has_propose_consensus()) {
+    clear_has_msg();
+    ::dsnet::transaction::tapir::proto::ProposeConsensusMessage* temp = _impl_.msg_.propose_consensus_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.msg_.propose_consensus_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::dsnet::transaction::tapir::proto::ProposeConsensusMessage& ToServerMessage::_internal_propose_consensus() const {
+  return _internal_has_propose_consensus()
+      ? *_impl_.msg_.propose_consensus_
+      : reinterpret_cast< ::dsnet::transaction::tapir::proto::ProposeConsensusMessage&>(::dsnet::transaction::tapir::proto::_ProposeConsensusMessage_default_instance_);
+}
+inline const ::dsnet::transaction::tapir::proto::ProposeConsensusMessage& ToServerMessage::propose_consensus() const {
+  // @@protoc_insertion_point(field_get:dsnet.transaction.tapir.proto.ToServerMessage.propose_consensus)
+  return _internal_propose_consensus();
+}
+inline ::dsnet::transaction::tapir::proto::ProposeConsensusMessage* ToServerMessage::unsafe_arena_release_propose_consensus() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:dsnet.transaction.tapir.proto.ToServerMessage.propose_consensus)
+  if (_internal_has_propose_consensus()) {
+    clear_has_msg();
+    ::dsnet::transaction::tapir::proto::ProposeConsensusMessage* temp = _impl_.msg_.propose_consensus_;
+    _impl_.msg_.propose_consensus_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void ToServerMessage::unsafe_arena_set_allocated_propose_consensus(::dsnet::transaction::tapir::proto::ProposeConsensusMessage* propose_consensus) {
+  clear_msg();
+  if (propose_consensus) {
+    set_has_propose_consensus();
+    _impl_.msg_.propose_consensus_ = propose_consensus;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:dsnet.transaction.tapir.proto.ToServerMessage.propose_consensus)
+}
+inline ::dsnet::transaction::tapir::proto::ProposeConsensusMessage* ToServerMessage::_internal_mutable_propose_consensus() {
+  if (!_internal_has_propose_consensus()) {
+    clear_msg();
+    set_has_propose_consensus();
+    _impl_.msg_.propose_consensus_ = CreateMaybeMessage< ::dsnet::transaction::tapir::proto::ProposeConsensusMessage >(GetArenaForAllocation());
+  }
+  return _impl_.msg_.propose_consensus_;
+}
+inline ::dsnet::transaction::tapir::proto::ProposeConsensusMessage* ToServerMessage::mutable_propose_consensus() {
+  ::dsnet::transaction::tapir::proto::ProposeConsensusMessage* _msg = _internal_mutable_propose_consensus();
+  // @@protoc_insertion_point(field_mutable:dsnet.transaction.tapir.proto.ToServerMessage.propose_consensus)
+  return _msg;
+}
+
+// .dsnet.transaction.tapir.proto.FinalizeConsensusMessage finalize_consensus = 4;
+inline bool ToServerMessage::_internal_has_finalize_consensus() const {
+  return msg_case() == kFinalizeConsensus;
+}
+inline bool ToServerMessage::has_finalize_consensus() const {
+  return _internal_has_finalize_consensus();
+}
+inline void ToServerMessage::set_has_finalize_consensus() {
+  _impl_._oneof_case_[0] = kFinalizeConsensus;
+}
+inline void ToServerMessage::clear_finalize_consensus() {
+  if (_internal_has_finalize_consensus()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.msg_.finalize_consensus_;
+    }
+    clear_has_msg();
+  }
+}
+inline ::dsnet::transaction::tapir::proto::FinalizeConsensusMessage* ToServerMessage::release_finalize_consensus() {
+  // @@protoc_insertion_point(field_release:dsnet.transaction.tapir.proto.ToServerMessage.finalize_consensus)
+  if (_internal_has_finalize_consensus()) {
+    clear_has_msg();
+    ::dsnet::transaction::tapir::proto::FinalizeConsensusMessage* temp = _impl_.msg_.finalize_consensus_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.msg_.finalize_consensus_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::dsnet::transaction::tapir::proto::FinalizeConsensusMessage& ToServerMessage::_internal_finalize_consensus() const {
+  return _internal_has_finalize_consensus()
+      ? *_impl_.msg_.finalize_consensus_
+      : reinterpret_cast< ::dsnet::transaction::tapir::proto::FinalizeConsensusMessage&>(::dsnet::transaction::tapir::proto::_FinalizeConsensusMessage_default_instance_);
+}
+inline const ::dsnet::transaction::tapir::proto::FinalizeConsensusMessage& ToServerMessage::finalize_consensus() const {
+  // @@protoc_insertion_point(field_get:dsnet.transaction.tapir.proto.ToServerMessage.finalize_consensus)
+  return _internal_finalize_consensus();
+}
+inline ::dsnet::transaction::tapir::proto::FinalizeConsensusMessage* ToServerMessage::unsafe_arena_release_finalize_consensus() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:dsnet.transaction.tapir.proto.ToServerMessage.finalize_consensus)
+  if (_internal_has_finalize_consensus()) {
+    clear_has_msg();
+    ::dsnet::transaction::tapir::proto::FinalizeConsensusMessage* temp = _impl_.msg_.finalize_consensus_;
+    _impl_.msg_.finalize_consensus_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void ToServerMessage::unsafe_arena_set_allocated_finalize_consensus(::dsnet::transaction::tapir::proto::FinalizeConsensusMessage* finalize_consensus) {
+  clear_msg();
+  if (finalize_consensus) {
+    set_has_finalize_consensus();
+    _impl_.msg_.finalize_consensus_ = finalize_consensus;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:dsnet.transaction.tapir.proto.ToServerMessage.finalize_consensus)
+}
+inline ::dsnet::transaction::tapir::proto::FinalizeConsensusMessage* ToServerMessage::_internal_mutable_finalize_consensus() {
+  if (!_internal_has_finalize_consensus()) {
+    clear_msg();
+    set_has_finalize_consensus();
+    _impl_.msg_.finalize_consensus_ = CreateMaybeMessage< ::dsnet::transaction::tapir::proto::FinalizeConsensusMessage >(GetArenaForAllocation());
+  }
+  return _impl_.msg_.finalize_consensus_;
+}
+inline ::dsnet::transaction::tapir::proto::FinalizeConsensusMessage* ToServerMessage::mutable_finalize_consensus() {
+  ::dsnet::transaction::tapir::proto::FinalizeConsensusMessage* _msg = _internal_mutable_finalize_consensus();
+  // @@protoc_insertion_point(field_mutable:dsnet.transaction.tapir.proto.ToServerMessage.finalize_consensus)
+  return _msg;
+}
+
+inline bool ToServerMessage::has_msg() const {
+  return msg_case() != MSG_NOT_SET;
+}
+inline void ToServerMessage::clear_has_msg() {
+  _impl_._oneof_case_[0] = MSG_NOT_SET;
+}
+inline ToServerMessage::MsgCase ToServerMessage::msg_case() const {
+  return ToServerMessage::MsgCase(_impl_._oneof_case_[0]);
+}
+// -------------------------------------------------------------------
+
+// ProposeInconsistentMessage
+
+// required .dsnet.Request req = 1;
+inline bool ProposeInconsistentMessage::_internal_has_req() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.req_ != nullptr);
+  return value;
+}
+inline bool ProposeInconsistentMessage::has_req() const {
+  return _internal_has_req();
+}
+inline const ::dsnet::Request& ProposeInconsistentMessage::_internal_req() const {
+  const ::dsnet::Request* p = _impl_.req_;
+  return p != nullptr ? *p : reinterpret_cast<const ::dsnet::Request&>(
+      ::dsnet::_Request_default_instance_);
+}
+inline const ::dsnet::Request& ProposeInconsistentMessage::req() const {
+  // @@protoc_insertion_point(field_get:dsnet.transaction.tapir.proto.ProposeInconsistentMessage.req)
+  return _internal_req();
+}
+inline void ProposeInconsistentMessage::unsafe_arena_set_allocated_req(
+    ::dsnet::Request* req) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.req_);
+  }
+  _impl_.req_ = req;
+  if (req) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:dsnet.transaction.tapir.proto.ProposeInconsistentMessage.req)
+}
+inline ::dsnet::Request* ProposeInconsistentMessage::release_req() {
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::dsnet::Request* temp = _impl_.req_;
+  _impl_.req_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::dsnet::Request* ProposeInconsistentMessage::unsafe_arena_release_req() {
+  // @@protoc_insertion_point(field_release:dsnet.transaction.tapir.proto.ProposeInconsistentMessage.req)
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::dsnet::Request* temp = _impl_.req_;
+  _impl_.req_ = nullptr;
+  return temp;
+}
+inline ::dsnet::Request* ProposeInconsistentMessage::_internal_mutable_req() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  if (_impl_.req_ == nullptr) {
+    auto* p = CreateMaybeMessage<::dsnet::Request>(GetArenaForAllocation());
+    _impl_.req_ = p;
+  }
+  return _impl_.req_;
+}
+inline ::dsnet::Request* ProposeInconsistentMessage::mutable_req() {
+  ::dsnet::Request* _msg = _internal_mutable_req();
+  // @@protoc_insertion_point(field_mutable:dsnet.transaction.tapir.proto.ProposeInconsistentMessage.req)
+  return _msg;
+}
+inline void ProposeInconsistentMessage::set_allocated_req(::dsnet::Request* req) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete reinterpret_cast< ::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.req_);
+  }
+  if (req) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(
+                reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(req));
+    if (message_arena != submessage_arena) {
+      req = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, req, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.req_ = req;
+  // @@protoc_insertion_point(field_set_allocated:dsnet.transaction.tapir.proto.ProposeInconsistentMessage.req)
+}
+
+// -------------------------------------------------------------------
+
+// FinalizeInconsistentMessage
+
+// required .dsnet.transaction.tapir.proto.OpID opid = 1;
+inline bool FinalizeInconsistentMessage::_internal_has_opid() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.opid_ != nullptr);
+  return value;
+}
+inline bool FinalizeInconsistentMessage::has_opid() const {
+  return _internal_has_opid();
+}
+inline void FinalizeInconsistentMessage::clear_opid() {
+  if (_impl_.opid_ != nullptr) _impl_.opid_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const ::dsnet::transaction::tapir::proto::OpID& FinalizeInconsistentMessage::_internal_opid() const {
+  const ::dsnet::transaction::tapir::proto::OpID* p = _impl_.opid_;
+  return p != nullptr ? *p : reinterpret_cast<const ::dsnet::transaction::tapir::proto::OpID&>(
+      ::dsnet::transaction::tapir::proto::_OpID_default_instance_);
+}
+inline const ::dsnet::transaction::tapir::proto::OpID& FinalizeInconsistentMessage::opid() const {
+  // @@protoc_insertion_point(field_get:dsnet.transaction.tapir.proto.FinalizeInconsistentMessage.opid)
+  return _internal_opid();
+}
+inline void FinalizeInconsistentMessage::unsafe_arena_set_allocated_opid(
+    ::dsnet::transaction::tapir::proto::OpID* opid) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.opid_);
+  }
+  _impl_.opid_ = opid;
+  if (opid) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:dsnet.transaction.tapir.proto.FinalizeInconsistentMessage.opid)
+}
+inline ::dsnet::transaction::tapir::proto::OpID* FinalizeInconsistentMessage::release_opid() {
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::dsnet::transaction::tapir::proto::OpID* temp = _impl_.opid_;
+  _impl_.opid_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::dsnet::transaction::tapir::proto::OpID* FinalizeInconsistentMessage::unsafe_arena_release_opid() {
+  // @@protoc_insertion_point(field_release:dsnet.transaction.tapir.proto.FinalizeInconsistentMessage.opid)
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::dsnet::transaction::tapir::proto::OpID* temp = _impl_.opid_;
+  _impl_.opid_ = nullptr;
+  return temp;
+}
+inline ::dsnet::transaction::tapir::proto::OpID* FinalizeInconsistentMessage::_internal_mutable_opid() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  if (_impl_.opid_ == nullptr) {
+    auto* p = CreateMaybeMessage<::dsnet::transaction::tapir::proto::OpID>(GetArenaForAllocation());
+    _impl_.opid_ = p;
+  }
+  return _impl_.opid_;
+}
+inline ::dsnet::transaction::tapir::proto::OpID* FinalizeInconsistentMessage::mutable_opid() {
+  ::dsnet::transaction::tapir::proto::OpID* _msg = _internal_mutable_opid();
+  // @@protoc_insertion_point(field_mutable:dsnet.transaction.tapir.proto.FinalizeInconsistentMessage.opid)
+  return _msg;
+}
+inline void FinalizeInconsistentMessage::set_allocated_opid(::dsnet::transaction::tapir::proto::OpID* opid) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.opid_;
+  }
+  if (opid) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(opid);
+    if (message_arena != submessage_arena) {
+      opid = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, opid, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.opid_ = opid;
+  // @@protoc_insertion_point(field_set_allocated:dsnet.transaction.tapir.proto.FinalizeInconsistentMessage.opid)
+}
+
+// -------------------------------------------------------------------
+
+// ProposeConsensusMessage
+
+// required .dsnet.Request req = 1;
+inline bool ProposeConsensusMessage::_internal_has_req() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.req_ != nullptr);
+  return value;
+}
+inline bool ProposeConsensusMessage::has_req() const {
+  return _internal_has_req();
+}
+inline const ::dsnet::Request& ProposeConsensusMessage::_internal_req() const {
+  const ::dsnet::Request* p = _impl_.req_;
+  return p != nullptr ? *p : reinterpret_cast<const ::dsnet::Request&>(
+      ::dsnet::_Request_default_instance_);
+}
+inline const ::dsnet::Request& ProposeConsensusMessage::req() const {
+  // @@protoc_insertion_point(field_get:dsnet.transaction.tapir.proto.ProposeConsensusMessage.req)
+  return _internal_req();
+}
+inline void ProposeConsensusMessage::unsafe_arena_set_allocated_req(
+    ::dsnet::Request* req) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.req_);
+  }
+  _impl_.req_ = req;
+  if (req) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:dsnet.transaction.tapir.proto.ProposeConsensusMessage.req)
+}
+inline ::dsnet::Request* ProposeConsensusMessage::release_req() {
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::dsnet::Request* temp = _impl_.req_;
+  _impl_.req_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::dsnet::Request* ProposeConsensusMessage::unsafe_arena_release_req() {
+  // @@protoc_insertion_point(field_release:dsnet.transaction.tapir.proto.ProposeConsensusMessage.req)
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::dsnet::Request* temp = _impl_.req_;
+  _impl_.req_ = nullptr;
+  return temp;
+}
+inline ::dsnet::Request* ProposeConsensusMessage::_internal_mutable_req() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  if (_impl_.req_ == nullptr) {
+    auto* p = CreateMaybeMessage<::dsnet::Request>(GetArenaForAllocation());
+    _impl_.req_ = p;
+  }
+  return _impl_.req_;
+}
+inline ::dsnet::Request* ProposeConsensusMessage::mutable_req() {
+  ::dsnet::Request* _msg = _internal_mutable_req();
+  // @@protoc_insertion_point(field_mutable:dsnet.transaction.tapir.proto.ProposeConsensusMessage.req)
+  return _msg;
+}
+inline void ProposeConsensusMessage::set_allocated_req(::dsnet::Request* req) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete reinterpret_cast< ::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.req_);
+  }
+  if (req) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(
+                reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(req));
+    if (message_arena != submessage_arena) {
+      req = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, req, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.req_ = req;
+  // @@protoc_insertion_point(field_set_allocated:dsnet.transaction.tapir.proto.ProposeConsensusMessage.req)
+}
+
+// -------------------------------------------------------------------
+
+// FinalizeConsensusMessage
+
+// required .dsnet.transaction.tapir.proto.OpID opid = 1;
+inline bool FinalizeConsensusMessage::_internal_has_opid() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.opid_ != nullptr);
+  return value;
+}
+inline bool FinalizeConsensusMessage::has_opid() const {
+  return _internal_has_opid();
+}
+inline void FinalizeConsensusMessage::clear_opid() {
+  if (_impl_.opid_ != nullptr) _impl_.opid_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline const ::dsnet::transaction::tapir::proto::OpID& FinalizeConsensusMessage::_internal_opid() const {
+  const ::dsnet::transaction::tapir::proto::OpID* p = _impl_.opid_;
+  return p != nullptr ? *p : reinterpret_cast<const ::dsnet::transaction::tapir::proto::OpID&>(
+      ::dsnet::transaction::tapir::proto::_OpID_default_instance_);
+}
+inline const ::dsnet::transaction::tapir::proto::OpID& FinalizeConsensusMessage::opid() const {
+  // @@protoc_insertion_point(field_get:dsnet.transaction.tapir.proto.FinalizeConsensusMessage.opid)
+  return _internal_opid();
+}
+inline void FinalizeConsensusMessage::unsafe_arena_set_allocated_opid(
+    ::dsnet::transaction::tapir::proto::OpID* opid) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.opid_);
+  }
+  _impl_.opid_ = opid;
+  if (opid) {
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:dsnet.transaction.tapir.proto.FinalizeConsensusMessage.opid)
+}
+inline ::dsnet::transaction::tapir::proto::OpID* FinalizeConsensusMessage::release_opid() {
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  ::dsnet::transaction::tapir::proto::OpID* temp = _impl_.opid_;
+  _impl_.opid_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::dsnet::transaction::tapir::proto::OpID* FinalizeConsensusMessage::unsafe_arena_release_opid() {
+  // @@protoc_insertion_point(field_release:dsnet.transaction.tapir.proto.FinalizeConsensusMessage.opid)
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  ::dsnet::transaction::tapir::proto::OpID* temp = _impl_.opid_;
+  _impl_.opid_ = nullptr;
+  return temp;
+}
+inline ::dsnet::transaction::tapir::proto::OpID* FinalizeConsensusMessage::_internal_mutable_opid() {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  if (_impl_.opid_ == nullptr) {
+    auto* p = CreateMaybeMessage<::dsnet::transaction::tapir::proto::OpID>(GetArenaForAllocation());
+    _impl_.opid_ = p;
+  }
+  return _impl_.opid_;
+}
+inline ::dsnet::transaction::tapir::proto::OpID* FinalizeConsensusMessage::mutable_opid() {
+  ::dsnet::transaction::tapir::proto::OpID* _msg = _internal_mutable_opid();
+  // @@protoc_insertion_point(field_mutable:dsnet.transaction.tapir.proto.FinalizeConsensusMessage.opid)
+  return _msg;
+}
+inline void FinalizeConsensusMessage::set_allocated_opid(::dsnet::transaction::tapir::proto::OpID* opid) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.opid_;
+  }
+  if (opid) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(opid);
+    if (message_arena != submessage_arena) {
+      opid = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, opid, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  _impl_.opid_ = opid;
+  // @@protoc_insertion_point(field_set_allocated:dsnet.transaction.tapir.proto.FinalizeConsensusMessage.opid)
+}
+
+// required bytes result = 2;
+inline bool FinalizeConsensusMessage::_internal_has_result() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool FinalizeConsensusMessage::has_result() const {
+  return _internal_has_result();
+}
+inline void FinalizeConsensusMessage::clear_result() {
+  _impl_.result_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& FinalizeConsensusMessage::result() const {
+  // @@protoc_insertion_point(field_get:dsnet.transaction.tapir.proto.FinalizeConsensusMessage.result)
+  return _internal_result();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void FinalizeConsensusMessage::set_result(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.result_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:dsnet.transaction.tapir.proto.FinalizeConsensusMessage.result)
+}
+inline std::string* FinalizeConsensusMessage::mutable_result() {
+  std::string* _s = _internal_mutable_result();
+  // @@protoc_insertion_point(field_mutable:dsnet.transaction.tapir.proto.FinalizeConsensusMessage.result)
+  return _s;
+}
+inline const std::string& FinalizeConsensusMessage::_internal_result() const {
+  return _impl_.result_.Get();
+}
+inline void FinalizeConsensusMessage::_internal_set_result(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.result_.Set(value, GetArenaForAllocation());
+}
+inline std::string* FinalizeConsensusMessage::_internal_mutable_result() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.result_.Mutable(GetArenaForAllocation());
+}
+inline std::string* FinalizeConsensusMessage::release_result() {
+  // @@protoc_insertion_point(field_release:dsnet.transaction.tapir.proto.FinalizeConsensusMessage.result)
+  if (!_internal_has_result()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.result_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.result_.IsDefault()) {
+    _impl_.result_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void FinalizeConsensusMessage::set_allocated_result(std::string* result) {
+  if (result != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.result_.SetAllocated(result, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.result_.IsDefault()) {
+    _impl_.result_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:dsnet.transaction.tapir.proto.FinalizeConsensusMessage.result)
+}
+
+// -------------------------------------------------------------------
+
+// ToClientMessage
+
+// .dsnet.transaction.tapir.proto.ReplyInconsistentMessage inconsistent_reply = 1;
+inline bool ToClientMessage::_internal_has_inconsistent_reply() const {
+  return msg_case() == kInconsistentReply;
+}
+inline bool ToClientMessage::has_inconsistent_reply() const {
+  return _internal_has_inconsistent_reply();
+}
+inline void ToClientMessage::set_has_inconsistent_reply() {
+  _impl_._oneof_case_[0] = kInconsistentReply;
+}
+inline void ToClientMessage::clear_inconsistent_reply() {
+  if (_internal_has_inconsistent_reply()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.msg_.inconsistent_reply_;
+    }
+    clear_has_msg();
+  }
+}
+inline ::dsnet::transaction::tapir::proto::ReplyInconsistentMessage* ToClientMessage::release_inconsistent_reply() {
+  // @@protoc_insertion_point(field_release:dsnet.transaction.tapir.proto.ToClientMessage.inconsistent_reply)
+  if (_internal_has_inconsistent_reply()) {
+    clear_has_msg();
+    ::dsnet::transaction::tapir::proto::ReplyInconsistentMessage* temp = _impl_.msg_.inconsistent_reply_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.msg_.inconsistent_reply_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::dsnet::transaction::tapir::proto::ReplyInconsistentMessage& ToClientMessage::_internal_inconsistent_reply() const {
+  return _internal_has_inconsistent_reply()
+      ? *_impl_.msg_.inconsistent_reply_
+      : reinterpret_cast< ::dsnet::transaction::tapir::proto::ReplyInconsistentMessage&>(::dsnet::transaction::tapir::proto::_ReplyInconsistentMessage_default_instance_);
+}
+inline const ::dsnet::transaction::tapir::proto::ReplyInconsistentMessage& ToClientMessage::inconsistent_reply() const {
+  // @@protoc_insertion_point(field_get:dsnet.transaction.tapir.proto.ToClientMessage.inconsistent_reply)
+  return _internal_inconsistent_reply();
+}
+inline ::dsnet::transaction::tapir::proto::ReplyInconsistentMessage* ToClientMessage::unsafe_arena_release_inconsistent_reply() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:dsnet.transaction.tapir.proto.ToClientMessage.inconsistent_reply)
+  if (_internal_has_inconsistent_reply()) {
+    clear_has_msg();
+    ::dsnet::transaction::tapir::proto::ReplyInconsistentMessage* temp = _impl_.msg_.inconsistent_reply_;
+    _impl_.msg_.inconsistent_reply_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void ToClientMessage::unsafe_arena_set_allocated_inconsistent_reply(::dsnet::transaction::tapir::proto::ReplyInconsistentMessage* inconsistent_reply) {
+  clear_msg();
+  if (inconsistent_reply) {
+    set_has_inconsistent_reply();
+    _impl_.msg_.inconsistent_reply_ = inconsistent_reply;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:dsnet.transaction.tapir.proto.ToClientMessage.inconsistent_reply)
+}
+inline ::dsnet::transaction::tapir::proto::ReplyInconsistentMessage* ToClientMessage::_internal_mutable_inconsistent_reply() {
+  if (!_internal_has_inconsistent_reply()) {
+    clear_msg();
+    set_has_inconsistent_reply();
+    _impl_.msg_.inconsistent_reply_ = CreateMaybeMessage< ::dsnet::transaction::tapir::proto::ReplyInconsistentMessage >(GetArenaForAllocation());
+  }
+  return _impl_.msg_.inconsistent_reply_;
+}
+inline ::dsnet::transaction::tapir::proto::ReplyInconsistentMessage* ToClientMessage::mutable_inconsistent_reply() {
+  ::dsnet::transaction::tapir::proto::ReplyInconsistentMessage* _msg = _internal_mutable_inconsistent_reply();
+  // @@protoc_insertion_point(field_mutable:dsnet.transaction.tapir.proto.ToClientMessage.inconsistent_reply)
+  return _msg;
+}
+
+// .dsnet.transaction.tapir.proto.ReplyConsensusMessage consensus_reply = 2;
+inline bool ToClientMessage::_internal_has_consensus_reply() const {
+  return msg_case() == kConsensusReply;
+}
+inline bool ToClientMessage::has_consensus_reply() const {
+  return _internal_has_consensus_reply();
+}
+inline void ToClientMessage::set_has_consensus_reply() {
+  _impl_._oneof_case_[0] = kConsensusReply;
+}
+inline void ToClientMessage::clear_consensus_reply() {
+  if (_internal_has_consensus_reply()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.msg_.consensus_reply_;
+    }
+    clear_has_msg();
+  }
+}
+inline ::dsnet::transaction::tapir::proto::ReplyConsensusMessage* ToClientMessage::release_consensus_reply() {
+  // @@protoc_insertion_point(field_release:dsnet.transaction.tapir.proto.ToClientMessage.consensus_reply)
+  if (_internal_has_consensus_reply()) {
+    clear_has_msg();
+    ::dsnet::transaction::tapir::proto::ReplyConsensusMessage* temp = _impl_.msg_.consensus_reply_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.msg_.consensus_reply_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::dsnet::transaction::tapir::proto::ReplyConsensusMessage& ToClientMessage::_internal_consensus_reply() const {
+  return _internal_has_consensus_reply()
+      ? *_impl_.msg_.consensus_reply_
+      : reinterpret_cast< ::dsnet::transaction::tapir::proto::ReplyConsensusMessage&>(::dsnet::transaction::tapir::proto::_ReplyConsensusMessage_default_instance_);
+}
+inline const ::dsnet::transaction::tapir::proto::ReplyConsensusMessage& ToClientMessage::consensus_reply() const {
+  // @@protoc_insertion_point(field_get:dsnet.transaction.tapir.proto.ToClientMessage.consensus_reply)
+  return _internal_consensus_reply();
+}
+inline ::dsnet::transaction::tapir::proto::ReplyConsensusMessage* ToClientMessage::unsafe_arena_release_consensus_reply() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:dsnet.transaction.tapir.proto.ToClientMessage.consensus_reply)
+  if (_internal_has_consensus_reply()) {
+    clear_has_msg();
+    ::dsnet::transaction::tapir::proto::ReplyConsensusMessage* temp = _impl_.msg_.consensus_reply_;
+    _impl_.msg_.consensus_reply_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void ToClientMessage::unsafe_arena_set_allocated_consensus_reply(::dsnet::transaction::tapir::proto::ReplyConsensusMessage* consensus_reply) {
+  clear_msg();
+  if (consensus_reply) {
+    set_has_consensus_reply();
+    _impl_.msg_.consensus_reply_ = consensus_reply;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:dsnet.transaction.tapir.proto.ToClientMessage.consensus_reply)
+}
+inline ::dsnet::transaction::tapir::proto::ReplyConsensusMessage* ToClientMessage::_internal_mutable_consensus_reply() {
+  if (!_internal_has_consensus_reply()) {
+    clear_msg();
+    set_has_consensus_reply();
+    _impl_.msg_.consensus_reply_ = CreateMaybeMessage< ::dsnet::transaction::tapir::proto::ReplyConsensusMessage >(GetArenaForAllocation());
+  }
+  return _impl_.msg_.consensus_reply_;
+}
+inline ::dsnet::transaction::tapir::proto::ReplyConsensusMessage* ToClientMessage::mutable_consensus_reply() {
+  ::dsnet::transaction::tapir::proto::ReplyConsensusMessage* _msg = _internal_mutable_consensus_reply();
+  // @@protoc_insertion_point(field_mutable:dsnet.transaction.tapir.proto.ToClientMessage.consensus_reply)
+  return _msg;
+}
+
+// .dsnet.transaction.tapir.proto.ConfirmMessage confirm = 3;
+inline bool ToClientMessage::_internal_has_confirm() const {
+  return msg_case() == kConfirm;
+}
+inline bool ToClientMessage::has_confirm() const {
+  return _internal_has_confirm();
+}
+inline void ToClientMessage::set_has_confirm() {
+  _impl_._oneof_case_[0] = kConfirm;
+}
+inline void ToClientMessage::clear_confirm() {
+  if (_internal_has_confirm()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.msg_.confirm_;
+    }
+    clear_has_msg();
+  }
+}
+inline ::dsnet::transaction::tapir::proto::ConfirmMessage* ToClientMessage::release_confirm() {
+  // @@protoc_insertion_point(field_release:dsnet.transaction.tapir.proto.ToClientMessage.confirm)
+  if (_internal_has_confirm()) {
+    clear_has_msg();
+    ::dsnet::transaction::tapir::proto::ConfirmMessage* temp = _impl_.msg_.confirm_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.msg_.confirm_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::dsnet::transaction::tapir::proto::ConfirmMessage& ToClientMessage::_internal_confirm() const {
+  return _internal_has_confirm()
+      ? *_impl_.msg_.confirm_
+      : reinterpret_cast< ::dsnet::transaction::tapir::proto::ConfirmMessage&>(::dsnet::transaction::tapir::proto::_ConfirmMessage_default_instance_);
+}
+inline const ::dsnet::transaction::tapir::proto::ConfirmMessage& ToClientMessage::confirm() const {
+  // @@protoc_insertion_point(field_get:dsnet.transaction.tapir.proto.ToClientMessage.confirm)
+  return _internal_confirm();
+}
+inline ::dsnet::transaction::tapir::proto::ConfirmMessage* ToClientMessage::unsafe_arena_release_confirm() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:dsnet.transaction.tapir.proto.ToClientMessage.confirm)
+  if (_internal_has_confirm()) {
+    clear_has_msg();
+    ::dsnet::transaction::tapir::proto::ConfirmMessage* temp = _impl_.msg_.confirm_;
+    _impl_.msg_.confirm_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void ToClientMessage::unsafe_arena_set_allocated_confirm(::dsnet::transaction::tapir::proto::ConfirmMessage* confirm) {
+  clear_msg();
+  if (confirm) {
+    set_has_confirm();
+    _impl_.msg_.confirm_ = confirm;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:dsnet.transaction.tapir.proto.ToClientMessage.confirm)
+}
+inline ::dsnet::transaction::tapir::proto::ConfirmMessage* ToClientMessage::_internal_mutable_confirm() {
+  if (!_internal_has_confirm()) {
+    clear_msg();
+    set_has_confirm();
+    _impl_.msg_.confirm_ = CreateMaybeMessage< ::dsnet::transaction::tapir::proto::ConfirmMessage >(GetArenaForAllocation());
+  }
+  return _impl_.msg_.confirm_;
+}
+inline ::dsnet::transaction::tapir::proto::ConfirmMessage* ToClientMessage::mutable_confirm() {
+  ::dsnet::transaction::tapir::proto::ConfirmMessage* _msg = _internal_mutable_confirm();
+  // @@protoc_insertion_point(field_mutable:dsnet.transaction.tapir.proto.ToClientMessage.confirm)
+  return _msg;
+}
+
+inline bool ToClientMessage::has_msg() const {
+  return msg_case() != MSG_NOT_SET;
+}
+inline void ToClientMessage::clear_has_msg() {
+  _impl_._oneof_case_[0] = MSG_NOT_SET;
+}
+inline ToClientMessage::MsgCase ToClientMessage::msg_case() const {
+  return ToClientMessage::MsgCase(_impl_._oneof_case_[0]);
+}
+// -------------------------------------------------------------------
+
+// ReplyInconsistentMessage
+
+// required uint64 view = 1;
+inline bool ReplyInconsistentMessage::_internal_has_view() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool ReplyInconsistentMessage::has_view() const {
+  return _internal_has_view();
+}
+inline void ReplyInconsistentMessage::clear_view() {
+  _impl_.view_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline uint64_t ReplyInconsistentMessage::_internal_view() const {
+  return _impl_.view_;
+}
+inline uint64_t ReplyInconsistentMessage::view() const {
+  // @@protoc_insertion_point(field_get:dsnet.transaction.tapir.proto.ReplyInconsistentMessage.view)
+  return _internal_view();
+}
+inline void ReplyInconsistentMessage::_internal_set_view(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.view_ = value;
+}
+inline void ReplyInconsistentMessage::set_view(uint64_t value) {
+  _internal_set_view(value);
+  // @@protoc_insertion_point(field_set:dsnet.transaction.tapir.proto.ReplyInconsistentMessage.view)
+}
+
+// required uint32 replicaIdx = 2;
+inline bool ReplyInconsistentMessage::_internal_has_replicaidx() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool ReplyInconsistentMessage::has_replicaidx() const {
+  return _internal_has_replicaidx();
+}
+inline void ReplyInconsistentMessage::clear_replicaidx() {
+  _impl_.replicaidx_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline uint32_t ReplyInconsistentMessage::_internal_replicaidx() const {
+  return _impl_.replicaidx_;
+}
+inline uint32_t ReplyInconsistentMessage::replicaidx() const {
+  // @@protoc_insertion_point(field_get:dsnet.transaction.tapir.proto.ReplyInconsistentMessage.replicaIdx)
+  return _internal_replicaidx();
+}
+inline void ReplyInconsistentMessage::_internal_set_replicaidx(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.replicaidx_ = value;
+}
+inline void ReplyInconsistentMessage::set_replicaidx(uint32_t value) {
+  _internal_set_replicaidx(value);
+  // @@protoc_insertion_point(field_set:dsnet.transaction.tapir.proto.ReplyInconsistentMessage.replicaIdx)
+}
+
+// required .dsnet.transaction.tapir.proto.OpID opid = 3;
+inline bool ReplyInconsistentMessage::_internal_has_opid() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.opid_ != nullptr);
+  return value;
+}
+inline bool ReplyInconsistentMessage::has_opid() const {
+  return _internal_has_opid();
+}
+inline void ReplyInconsistentMessage::clear_opid() {
+  if (_impl_.opid_ != nullptr) _impl_.opid_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const ::dsnet::transaction::tapir::proto::OpID& ReplyInconsistentMessage::_internal_opid() const {
+  const ::dsnet::transaction::tapir::proto::OpID* p = _impl_.opid_;
+  return p != nullptr ? *p : reinterpret_cast<const ::dsnet::transaction::tapir::proto::OpID&>(
+      ::dsnet::transaction::tapir::proto::_OpID_default_instance_);
+}
+inline const ::dsnet::transaction::tapir::proto::OpID& ReplyInconsistentMessage::opid() const {
+  // @@protoc_insertion_point(field_get:dsnet.transaction.tapir.proto.ReplyInconsistentMessage.opid)
+  return _internal_opid();
+}
+inline void ReplyInconsistentMessage::unsafe_arena_set_allocated_opid(
+    ::dsnet::transaction::tapir::proto::OpID* opid) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.opid_);
+  }
+  _impl_.opid_ = opid;
+  if (opid) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:dsnet.transaction.tapir.proto.ReplyInconsistentMessage.opid)
+}
+inline ::dsnet::transaction::tapir::proto::OpID* ReplyInconsistentMessage::release_opid() {
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::dsnet::transaction::tapir::proto::OpID* temp = _impl_.opid_;
+  _impl_.opid_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::dsnet::transaction::tapir::proto::OpID* ReplyInconsistentMessage::unsafe_arena_release_opid() {
+  // @@protoc_insertion_point(field_release:dsnet.transaction.tapir.proto.ReplyInconsistentMessage.opid)
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::dsnet::transaction::tapir::proto::OpID* temp = _impl_.opid_;
+  _impl_.opid_ = nullptr;
+  return temp;
+}
+inline ::dsnet::transaction::tapir::proto::OpID* ReplyInconsistentMessage::_internal_mutable_opid() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  if (_impl_.opid_ == nullptr) {
+    auto* p = CreateMaybeMessage<::dsnet::transaction::tapir::proto::OpID>(GetArenaForAllocation());
+    _impl_.opid_ = p;
+  }
+  return _impl_.opid_;
+}
+inline ::dsnet::transaction::tapir::proto::OpID* ReplyInconsistentMessage::mutable_opid() {
+  ::dsnet::transaction::tapir::proto::OpID* _msg = _internal_mutable_opid();
+  // @@protoc_insertion_point(field_mutable:dsnet.transaction.tapir.proto.ReplyInconsistentMessage.opid)
+  return _msg;
+}
+inline void ReplyInconsistentMessage::set_allocated_opid(::dsnet::transaction::tapir::proto::OpID* opid) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.opid_;
+  }
+  if (opid) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(opid);
+    if (message_arena != submessage_arena) {
+      opid = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, opid, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.opid_ = opid;
+  // @@protoc_insertion_point(field_set_allocated:dsnet.transaction.tapir.proto.ReplyInconsistentMessage.opid)
+}
+
+// -------------------------------------------------------------------
+
+// ReplyConsensusMessage
+
+// required uint64 view = 1;
+inline bool ReplyConsensusMessage::_internal_has_view() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool ReplyConsensusMessage::has_view() const {
+  return _internal_has_view();
+}
+inline void ReplyConsensusMessage::clear_view() {
+  _impl_.view_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline uint64_t ReplyConsensusMessage::_internal_view() const {
+  return _impl_.view_;
+}
+inline uint64_t ReplyConsensusMessage::view() const {
+  // @@protoc_insertion_point(field_get:dsnet.transaction.tapir.proto.ReplyConsensusMessage.view)
+  return _internal_view();
+}
+inline void ReplyConsensusMessage::_internal_set_view(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.view_ = value;
+}
+inline void ReplyConsensusMessage::set_view(uint64_t value) {
+  _internal_set_view(value);
+  // @@protoc_insertion_point(field_set:dsnet.transaction.tapir.proto.ReplyConsensusMessage.view)
+}
+
+// required uint32 replicaIdx = 2;
+inline bool ReplyConsensusMessage::_internal_has_replicaidx() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  return value;
+}
+inline bool ReplyConsensusMessage::has_replicaidx() const {
+  return _internal_has_replicaidx();
+}
+inline void ReplyConsensusMessage::clear_replicaidx() {
+  _impl_.replicaidx_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000008u;
+}
+inline uint32_t ReplyConsensusMessage::_internal_replicaidx() const {
+  return _impl_.replicaidx_;
+}
+inline uint32_t ReplyConsensusMessage::replicaidx() const {
+  // @@protoc_insertion_point(field_get:dsnet.transaction.tapir.proto.ReplyConsensusMessage.replicaIdx)
+  return _internal_replicaidx();
+}
+inline void ReplyConsensusMessage::_internal_set_replicaidx(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  _impl_.replicaidx_ = value;
+}
+inline void ReplyConsensusMessage::set_replicaidx(uint32_t value) {
+  _internal_set_replicaidx(value);
+  // @@protoc_insertion_point(field_set:dsnet.transaction.tapir.proto.ReplyConsensusMessage.replicaIdx)
+}
+
+// required .dsnet.transaction.tapir.proto.OpID opid = 3;
+inline bool ReplyConsensusMessage::_internal_has_opid() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.opid_ != nullptr);
+  return value;
+}
+inline bool ReplyConsensusMessage::has_opid() const {
+  return _internal_has_opid();
+}
+inline void ReplyConsensusMessage::clear_opid() {
+  if (_impl_.opid_ != nullptr) _impl_.opid_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline const ::dsnet::transaction::tapir::proto::OpID& ReplyConsensusMessage::_internal_opid() const {
+  const ::dsnet::transaction::tapir::proto::OpID* p = _impl_.opid_;
+  return p != nullptr ? *p : reinterpret_cast<const ::dsnet::transaction::tapir::proto::OpID&>(
+      ::dsnet::transaction::tapir::proto::_OpID_default_instance_);
+}
+inline const ::dsnet::transaction::tapir::proto::OpID& ReplyConsensusMessage::opid() const {
+  // @@protoc_insertion_point(field_get:dsnet.transaction.tapir.proto.ReplyConsensusMessage.opid)
+  return _internal_opid();
+}
+inline void ReplyConsensusMessage::unsafe_arena_set_allocated_opid(
+    ::dsnet::transaction::tapir::proto::OpID* opid) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.opid_);
+  }
+  _impl_.opid_ = opid;
+  if (opid) {
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:dsnet.transaction.tapir.proto.ReplyConsensusMessage.opid)
+}
+inline ::dsnet::transaction::tapir::proto::OpID* ReplyConsensusMessage::release_opid() {
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  ::dsnet::transaction::tapir::proto::OpID* temp = _impl_.opid_;
+  _impl_.opid_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::dsnet::transaction::tapir::proto::OpID* ReplyConsensusMessage::unsafe_arena_release_opid() {
+  // @@protoc_insertion_point(field_release:dsnet.transaction.tapir.proto.ReplyConsensusMessage.opid)
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  ::dsnet::transaction::tapir::proto::OpID* temp = _impl_.opid_;
+  _impl_.opid_ = nullptr;
+  return temp;
+}
+inline ::dsnet::transaction::tapir::proto::OpID* ReplyConsensusMessage::_internal_mutable_opid() {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  if (_impl_.opid_ == nullptr) {
+    auto* p = CreateMaybeMessage<::dsnet::transaction::tapir::proto::OpID>(GetArenaForAllocation());
+    _impl_.opid_ = p;
+  }
+  return _impl_.opid_;
+}
+inline ::dsnet::transaction::tapir::proto::OpID* ReplyConsensusMessage::mutable_opid() {
+  ::dsnet::transaction::tapir::proto::OpID* _msg = _internal_mutable_opid();
+  // @@protoc_insertion_point(field_mutable:dsnet.transaction.tapir.proto.ReplyConsensusMessage.opid)
+  return _msg;
+}
+inline void ReplyConsensusMessage::set_allocated_opid(::dsnet::transaction::tapir::proto::OpID* opid) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.opid_;
+  }
+  if (opid) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(opid);
+    if (message_arena != submessage_arena) {
+      opid = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, opid, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  _impl_.opid_ = opid;
+  // @@protoc_insertion_point(field_set_allocated:dsnet.transaction.tapir.proto.ReplyConsensusMessage.opid)
+}
+
+// required bytes result = 4;
+inline bool ReplyConsensusMessage::_internal_has_result() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool ReplyConsensusMessage::has_result() const {
+  return _internal_has_result();
+}
+inline void ReplyConsensusMessage::clear_result() {
+  _impl_.result_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& ReplyConsensusMessage::result() const {
+  // @@protoc_insertion_point(field_get:dsnet.transaction.tapir.proto.ReplyConsensusMessage.result)
+  return _internal_result();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void ReplyConsensusMessage::set_result(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.result_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:dsnet.transaction.tapir.proto.ReplyConsensusMessage.result)
+}
+inline std::string* ReplyConsensusMessage::mutable_result() {
+  std::string* _s = _internal_mutable_result();
+  // @@protoc_insertion_point(field_mutable:dsnet.transaction.tapir.proto.ReplyConsensusMessage.result)
+  return _s;
+}
+inline const std::string& ReplyConsensusMessage::_internal_result() const {
+  return _impl_.result_.Get();
+}
+inline void ReplyConsensusMessage::_internal_set_result(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.result_.Set(value, GetArenaForAllocation());
+}
+inline std::string* ReplyConsensusMessage::_internal_mutable_result() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.result_.Mutable(GetArenaForAllocation());
+}
+inline std::string* ReplyConsensusMessage::release_result() {
+  // @@protoc_insertion_point(field_release:dsnet.transaction.tapir.proto.ReplyConsensusMessage.result)
+  if (!_internal_has_result()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.result_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.result_.IsDefault()) {
+    _impl_.result_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void ReplyConsensusMessage::set_allocated_result(std::string* result) {
+  if (result != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.result_.SetAllocated(result, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.result_.IsDefault()) {
+    _impl_.result_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:dsnet.transaction.tapir.proto.ReplyConsensusMessage.result)
+}
+
+// -------------------------------------------------------------------
+
+// ConfirmMessage
+
+// required uint64 view = 1;
+inline bool ConfirmMessage::_internal_has_view() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool ConfirmMessage::has_view() const {
+  return _internal_has_view();
+}
+inline void ConfirmMessage::clear_view() {
+  _impl_.view_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline uint64_t ConfirmMessage::_internal_view() const {
+  return _impl_.view_;
+}
+inline uint64_t ConfirmMessage::view() const {
+  // @@protoc_insertion_point(field_get:dsnet.transaction.tapir.proto.ConfirmMessage.view)
+  return _internal_view();
+}
+inline void ConfirmMessage::_internal_set_view(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.view_ = value;
+}
+inline void ConfirmMessage::set_view(uint64_t value) {
+  _internal_set_view(value);
+  // @@protoc_insertion_point(field_set:dsnet.transaction.tapir.proto.ConfirmMessage.view)
+}
+
+// required uint32 replicaIdx = 2;
+inline bool ConfirmMessage::_internal_has_replicaidx() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool ConfirmMessage::has_replicaidx() const {
+  return _internal_has_replicaidx();
+}
+inline void ConfirmMessage::clear_replicaidx() {
+  _impl_.replicaidx_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline uint32_t ConfirmMessage::_internal_replicaidx() const {
+  return _impl_.replicaidx_;
+}
+inline uint32_t ConfirmMessage::replicaidx() const {
+  // @@protoc_insertion_point(field_get:dsnet.transaction.tapir.proto.ConfirmMessage.replicaIdx)
+  return _internal_replicaidx();
+}
+inline void ConfirmMessage::_internal_set_replicaidx(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.replicaidx_ = value;
+}
+inline void ConfirmMessage::set_replicaidx(uint32_t value) {
+  _internal_set_replicaidx(value);
+  // @@protoc_insertion_point(field_set:dsnet.transaction.tapir.proto.ConfirmMessage.replicaIdx)
+}
+
+// required .dsnet.transaction.tapir.proto.OpID opid = 3;
+inline bool ConfirmMessage::_internal_has_opid() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.opid_ != nullptr);
+  return value;
+}
+inline bool ConfirmMessage::has_opid() const {
+  return _internal_has_opid();
+}
+inline void ConfirmMessage::clear_opid() {
+  if (_impl_.opid_ != nullptr) _impl_.opid_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const ::dsnet::transaction::tapir::proto::OpID& ConfirmMessage::_internal_opid() const {
+  const ::dsnet::transaction::tapir::proto::OpID* p = _impl_.opid_;
+  return p != nullptr ? *p : reinterpret_cast<const ::dsnet::transaction::tapir::proto::OpID&>(
+      ::dsnet::transaction::tapir::proto::_OpID_default_instance_);
+}
+inline const ::dsnet::transaction::tapir::proto::OpID& ConfirmMessage::opid() const {
+  // @@protoc_insertion_point(field_get:dsnet.transaction.tapir.proto.ConfirmMessage.opid)
+  return _internal_opid();
+}
+inline void ConfirmMessage::unsafe_arena_set_allocated_opid(
+    ::dsnet::transaction::tapir::proto::OpID* opid) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.opid_);
+  }
+  _impl_.opid_ = opid;
+  if (opid) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:dsnet.transaction.tapir.proto.ConfirmMessage.opid)
+}
+inline ::dsnet::transaction::tapir::proto::OpID* ConfirmMessage::release_opid() {
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::dsnet::transaction::tapir::proto::OpID* temp = _impl_.opid_;
+  _impl_.opid_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::dsnet::transaction::tapir::proto::OpID* ConfirmMessage::unsafe_arena_release_opid() {
+  // @@protoc_insertion_point(field_release:dsnet.transaction.tapir.proto.ConfirmMessage.opid)
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::dsnet::transaction::tapir::proto::OpID* temp = _impl_.opid_;
+  _impl_.opid_ = nullptr;
+  return temp;
+}
+inline ::dsnet::transaction::tapir::proto::OpID* ConfirmMessage::_internal_mutable_opid() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  if (_impl_.opid_ == nullptr) {
+    auto* p = CreateMaybeMessage<::dsnet::transaction::tapir::proto::OpID>(GetArenaForAllocation());
+    _impl_.opid_ = p;
+  }
+  return _impl_.opid_;
+}
+inline ::dsnet::transaction::tapir::proto::OpID* ConfirmMessage::mutable_opid() {
+  ::dsnet::transaction::tapir::proto::OpID* _msg = _internal_mutable_opid();
+  // @@protoc_insertion_point(field_mutable:dsnet.transaction.tapir.proto.ConfirmMessage.opid)
+  return _msg;
+}
+inline void ConfirmMessage::set_allocated_opid(::dsnet::transaction::tapir::proto::OpID* opid) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.opid_;
+  }
+  if (opid) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(opid);
+    if (message_arena != submessage_arena) {
+      opid = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, opid, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.opid_ = opid;
+  // @@protoc_insertion_point(field_set_allocated:dsnet.transaction.tapir.proto.ConfirmMessage.opid)
+}
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic pop
+#endif  // __GNUC__
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+
+// @@protoc_insertion_point(namespace_scope)
+
+}  // namespace proto
+}  // namespace tapir
+}  // namespace transaction
+}  // namespace dsnet
+
+PROTOBUF_NAMESPACE_OPEN
+
+template <> struct is_proto_enum< ::dsnet::transaction::tapir::proto::Transaction_Operation> : ::std::true_type {};
+template <>
+inline const EnumDescriptor* GetEnumDescriptor< ::dsnet::transaction::tapir::proto::Transaction_Operation>() {
+  return ::dsnet::transaction::tapir::proto::Transaction_Operation_descriptor();
+}
+template <> struct is_proto_enum< ::dsnet::transaction::tapir::proto::ReplyMessage_Status> : ::std::true_type {};
+template <>
+inline const EnumDescriptor* GetEnumDescriptor< ::dsnet::transaction::tapir::proto::ReplyMessage_Status>() {
+  return ::dsnet::transaction::tapir::proto::ReplyMessage_Status_descriptor();
+}
+
+PROTOBUF_NAMESPACE_CLOSE
+
+// @@protoc_insertion_point(global_scope)
+
+#include <google/protobuf/port_undef.inc>
+#endif  // GOOGLE_PROTOBUF_INCLUDED_GOOGLE_PROTOBUF_INCLUDED_transaction_2ftapir_2ftapir_2dproto_2eproto
@@ -29,10 +29,12 @@
  **********************************************************************/
 
 #include "common/client.h"
+#include "common/keyregistry.h"
 #include "bench/benchmark.h"
 #include "lib/assert.h"
 #include "lib/configuration.h"
 #include "lib/dpdktransport.h"
+#include "lib/iouringtransport.h"
 #include "lib/message.h"
 #include "lib/udptransport.h"
 #include "replication/fastpaxos/client.h"
@@ -55,8 +57,8 @@ static void Usage(const char *progName) {
         "usage: %s "
         "[-n requests] [-t threads] [-w warmup-secs] [-s stats-file] [-d "
         "delay-ms] "
-        "[-u duration-sec] [-p udp|dpdk] [-v device] [-x device-port] [-z "
-        "transport-cmdline] "
+        "[-u duration-sec] [-p udp|iouring|dpdk] [-v device] [-x device-port] [-q "
+        "dpdk-queues] [-b dpdk-burst] [-z transport-cmdline] [-k identifier] "
         "-c conf-file -h host-address -m "
         "unreplicated|signedunrep|vr|fastpaxos|nopaxos\n",
         progName);
@@ -75,6 +77,9 @@ int main(int argc, char **argv) {
     int tputInterval = 0;
     std::string host, dev, transport_cmdline;
     int dev_port = 0;
+    int dpdk_queues = 1, dpdk_burst = 32;
+    // signs pbft and minbft requests, "Alex" sends them unsigned
+    std::string identifier = "Alex";
 
     enum {
         PROTO_UNKNOWN,
@@ -91,13 +96,17 @@ int main(int argc, char **argv) {
         PROTO_MINBFT
     } proto = PROTO_UNKNOWN;
 
-    enum { TRANSPORT_UDP, TRANSPORT_DPDK } transport_type = TRANSPORT_UDP;
+    enum {
+        TRANSPORT_UDP,
+        TRANSPORT_IOURING,
+        TRANSPORT_DPDK
+    } transport_type = TRANSPORT_UDP;
 
     string statsFile;
 
     // Parse arguments
     int opt;
-    while ((opt = getopt(argc, argv, "c:d:h:s:m:t:i:u:p:v:x:z:")) != -1) {
+    while ((opt = getopt(argc, argv, "b:c:d:h:k:s:m:t:i:u:p:q:v:x:z:")) != -1) {
         switch (opt) {
         case 'c':
             configPath = optarg;
@@ -117,6 +126,10 @@ int main(int argc, char **argv) {
             host = std::string(optarg);
             break;
 
+        case 'k':
+            identifier = std::string(optarg);
+            break;
+
         case 'v':
             dev = std::string(optarg);
             break;
@@ -196,6 +209,8 @@ int main(int argc, char **argv) {
         case 'p':
             if (strcasecmp(optarg, "udp") == 0) {
                 transport_type = TRANSPORT_UDP;
+            } else if (strcasecmp(optarg, "iouring") == 0) {
+                transport_type = TRANSPORT_IOURING;
             } else if (strcasecmp(optarg, "dpdk") == 0) {
                 transport_type = TRANSPORT_DPDK;
             } else {
@@ -204,6 +219,28 @@ int main(int argc, char **argv) {
             }
             break;
 
+        case 'q': {
+            char *strtol_ptr;
+            dpdk_queues = strtoul(optarg, &strtol_ptr, 10);
+            if ((*optarg == '\0') || (*strtol_ptr != '\0') ||
+                (dpdk_queues <= 0)) {
+                fprintf(stderr, "option -q requires a numeric arg\n");
+                Usage(argv[0]);
+            }
+            break;
+        }
+
+        case 'b': {
+            char *strtol_ptr;
+            dpdk_burst = strtoul(optarg, &strtol_ptr, 10);
+            if ((*optarg == '\0') || (*strtol_ptr != '\0') ||
+                (dpdk_burst <= 0)) {
+                fprintf(stderr, "option -b requires a numeric arg\n");
+                Usage(argv[0]);
+            }
+            break;
+        }
+
         case 'z':
             transport_cmdline = std::string(optarg);
             break;
@@ -235,15 +272,21 @@ int main(int argc, char **argv) {
         Usage(argv[0]);
     }
     dsnet::Configuration config(configStream);
+    dsnet::KeyRegistry::Load(config, identifier);
 
     dsnet::Transport *transport;
     switch (transport_type) {
     case TRANSPORT_UDP:
         transport = new dsnet::UDPTransport(0, 0);
         break;
+    case TRANSPORT_IOURING:
+        transport = new dsnet::IOUringTransport();
+        break;
     case TRANSPORT_DPDK:
         transport =
-            new dsnet::DPDKTransport(dev_port, 0, 1, 0, transport_cmdline);
+            new dsnet::DPDKTransport(dev_port, 0, dpdk_queues, 0,
+                                     transport_cmdline, dpdk_queues,
+                                     dpdk_burst);
         break;
     }
 
@@ -293,13 +336,13 @@ int main(int argc, char **argv) {
             break;
 
         case PROTO_PBFT:
-            client =
-                new dsnet::pbft::PBFTClient(config, addr, "Alex", transport);
+            client = new dsnet::pbft::PBFTClient(
+                config, addr, identifier, transport);
             break;
 
         case PROTO_MINBFT:
             client = new dsnet::minbft::MinBFTClient(
-                config, addr, "Alex", transport);
+                config, addr, identifier, transport);
             break;
         default:
             NOT_REACHABLE();
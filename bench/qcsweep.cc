@@ -0,0 +1,268 @@
+#include "common/keyregistry.h"
+#include "common/multisig.h"
+#include "common/pbmessage.h"
+#include "common/signedadapter.h"
+#include "lib/configuration.h"
+#include "lib/message.h"
+#include "lib/simtransport.h"
+#include "replication/hotstuff/qc.h"
+
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <unistd.h>
+
+// Size of HotStuff Generic messages and cost of verifying their QCs against
+// replica count, with vector and aggregate QCs. Over SimulatedTransport, the
+// primary proposes blocks back to back, each justified by the QC on the one
+// before, and every backup verifies the QC and votes for the block, like
+// HotStuffReplica does minus requests and execution. Replicas sign with
+// their own identity of the given scheme, and the verify cache is disabled
+// because they share it in one process.
+
+using namespace dsnet;
+using namespace dsnet::hotstuff;
+
+using Clock = std::chrono::steady_clock;
+
+struct Stats {
+    // blocks that are justified by a QC of the measured mode
+    int n_block = 0, n_aggregate = 0;
+    size_t generic_size = 0;
+    double verify_us = 0, collect_us = 0;
+};
+
+static void Send(Transport *transport, TransportReceiver *src, int replica,
+                 proto::Message &message, const std::string &identifier)
+{
+    PBMessage pb_layer(message);
+    SignedAdapter signed_layer(pb_layer, identifier);
+    if (replica < 0) {
+        transport->SendMessageToAll(src, signed_layer);
+    } else {
+        transport->SendMessageToReplica(src, replica, signed_layer);
+    }
+}
+
+class Replica : public TransportReceiver
+{
+public:
+    Replica(const Configuration &config, int index, Transport *transport,
+            const MultiSigGroup *group, opnum_t n_block, Stats &stats)
+        : index(index), identifier("r" + std::to_string(index)),
+          transport(transport), group(group), n_block(n_block),
+          stats(stats), n_backup_vote(2 * config.f)
+    {
+        transport->RegisterReplica(this, config, 0, index);
+        if (index == 0) {
+            proto::VoteMessage vote;
+            vote.set_op_number(0);
+            vote.set_replica_index(0);
+            PBMessage pb_vote(vote);
+            SignedAdapter signed_vote(pb_vote, identifier);
+            std::string vote0(signed_vote.SerializedSize(), '\0');
+            signed_vote.Serialize(&vote0.front());
+            std::vector<std::string> identities;
+            for (int i = 0; i < config.n; i += 1) {
+                identities.push_back("r" + std::to_string(i));
+            }
+            collector.reset(new QCCollector(
+                identities, 0, n_backup_vote, vote0, group,
+                group != nullptr ? MultiSigSecret(config, 0) : ""));
+        } else if (group != nullptr) {
+            signer.reset(
+                new VoteSigner(*group, index, MultiSigSecret(config, index)));
+        }
+    }
+
+    void Start()
+    {
+        if (index == 0) {
+            return;
+        }
+        if (signer) {
+            proto::Message message;
+            signer->Publish(*message.mutable_nonce());
+            Send(transport, this, 0, message, identifier);
+        }
+        SendVote(0, nullptr);
+    }
+
+    void ReceiveMessage(const TransportAddress &remote, void *buf,
+                        size_t size) override
+    {
+        proto::Message message;
+        PBMessage pb_layer(message);
+        SignedAdapter signed_layer(pb_layer, "");
+        signed_layer.Parse(buf, size);
+        if (!signed_layer.IsVerified()) {
+            Panic("Message fail to be verified");
+        }
+
+        if (message.has_nonce()) {
+            collector->AddNonces(message.nonce(), signed_layer.Identifier());
+        } else if (message.has_vote()) {
+            Clock::time_point start = Clock::now();
+            std::unique_ptr<proto::QC> qc = collector->Add(
+                message.vote(), signed_layer.Identifier(),
+                TransportBuffer(buf, size, nullptr, nullptr));
+            stats.collect_us += std::chrono::duration<double, std::micro>(
+                                    Clock::now() - start)
+                                    .count();
+            if (qc) {
+                Propose(*qc);
+            }
+        } else if (message.has_generic()) {
+            const proto::Block &block = message.generic().block();
+            Clock::time_point start = Clock::now();
+            if (!VerifyQC(block.justify(), group, n_backup_vote)) {
+                Panic("QC fail to verify: op number = %lu",
+                      block.justify().op_number());
+            }
+            // the QC on the first block is made of the initial votes, which
+            // are always signed votes
+            if (block.op_number() > 1) {
+                stats.verify_us += std::chrono::duration<double, std::micro>(
+                                       Clock::now() - start)
+                                       .count();
+            }
+            SendVote(block.op_number(), &block);
+        }
+    }
+
+private:
+    int index;
+    std::string identifier;
+    Transport *transport;
+    const MultiSigGroup *group;
+    opnum_t n_block;
+    Stats &stats;
+    int n_backup_vote;
+    std::unique_ptr<QCCollector> collector;
+    std::unique_ptr<VoteSigner> signer;
+
+    void Propose(const proto::QC &qc)
+    {
+        opnum_t op_number = qc.op_number() + 1;
+        if (op_number > n_block) {
+            return;
+        }
+        proto::Message message;
+        proto::Block &block = *message.mutable_generic()->mutable_block();
+        block.set_op_number(op_number);
+        *block.mutable_justify() = qc;
+        collector->Plan(block);
+        if (op_number > 1) {
+            PBMessage pb_layer(message);
+            stats.n_block += 1;
+            stats.n_aggregate += !qc.aggregate_signature().empty();
+            stats.generic_size +=
+                SignedAdapter(pb_layer, identifier).SerializedSize();
+        }
+        Send(transport, this, -1, message, identifier);
+    }
+
+    void SendVote(opnum_t op_number, const proto::Block *block)
+    {
+        proto::Message message;
+        proto::VoteMessage &vote = *message.mutable_vote();
+        vote.set_op_number(op_number);
+        vote.set_replica_index(index);
+        if (signer) {
+            signer->Fill(vote, block);
+        }
+        Send(transport, this, 0, message, identifier);
+    }
+};
+
+static void Usage(const char *progName)
+{
+    fprintf(stderr,
+            "usage: %s [-b blocks] [-s secp256k1|ed25519] "
+            "[-n max-replicas]\n",
+            progName);
+    exit(1);
+}
+
+int main(int argc, char **argv)
+{
+    opnum_t n_block = 200;
+    std::string scheme = "secp256k1";
+    int n_max = 31;
+
+    int opt;
+    while ((opt = getopt(argc, argv, "b:s:n:")) != -1) {
+        char *strtol_ptr = nullptr;
+        switch (opt) {
+        case 'b':
+            n_block = strtoul(optarg, &strtol_ptr, 10);
+            break;
+        case 's':
+            scheme = optarg;
+            break;
+        case 'n':
+            n_max = strtoul(optarg, &strtol_ptr, 10);
+            break;
+        default:
+            Usage(argv[0]);
+        }
+        if (*optarg == '\0' ||
+            (strtol_ptr != nullptr && *strtol_ptr != '\0')) {
+            Usage(argv[0]);
+        }
+    }
+    if (n_block < 2 || n_max < 4 || n_max > MultiSigGroup::N_SIGNER_MAX) {
+        Usage(argv[0]);
+    }
+
+    for (int i = 0; i < n_max; i += 1) {
+        char secret[65];
+        snprintf(secret, sizeof(secret), "%064x", i + 1);
+        KeyRegistry::Add("r" + std::to_string(i), scheme, secret);
+    }
+    SignedAdapter::SetVerifyCacheSize(0);
+
+    for (int n = 4; n <= n_max; n += 3) {
+        std::map<int, std::vector<ReplicaAddress>> addrs;
+        for (int i = 0; i < n; i += 1) {
+            addrs[0].emplace_back("localhost", std::to_string(20000 + i));
+        }
+        Configuration config(1, n, (n - 1) / 3, addrs);
+
+        for (bool aggregate : {false, true}) {
+            SimulatedTransport transport;
+            std::unique_ptr<MultiSigGroup> group;
+            if (aggregate) {
+                group = NewMultiSigGroup(config);
+            }
+            Stats stats;
+            std::vector<std::unique_ptr<Replica>> replicas;
+            for (int i = 0; i < n; i += 1) {
+                replicas.emplace_back(new Replica(
+                    config, i, &transport, group.get(), n_block, stats));
+            }
+            for (auto &replica : replicas) {
+                replica->Start();
+            }
+            transport.Run();
+
+            if (stats.n_block != (int)n_block - 1) {
+                Panic("Chain stalled: %d of %lu blocks", stats.n_block + 1,
+                      n_block);
+            }
+            Notice("n = %2d, %s QC: %zu bytes Generic, %.1f us verify, "
+                   "%.1f us collect per block (%d of %d aggregated)",
+                   n, aggregate ? "aggregate" : "vector",
+                   stats.generic_size / stats.n_block,
+                   stats.verify_us / stats.n_block / (n - 1),
+                   stats.collect_us / stats.n_block, stats.n_aggregate,
+                   stats.n_block);
+        }
+    }
+    return 0;
+}
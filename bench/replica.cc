@@ -28,8 +28,16 @@
  *
  **********************************************************************/
 
+#include "common/checkpoint.h"
+#include "common/inlinefunction.h"
+#include "common/keyregistry.h"
+#include "common/parker.h"
 #include "common/replica.h"
+#include "common/runnermetrics.h"
+#include "common/signedadapter.h"
 #include "lib/configuration.h"
+#include "lib/cpuplacement.h"
+#include "lib/iouringtransport.h"
 #include "lib/udptransport.h"
 #include "replication/fastpaxos/replica.h"
 #include "replication/hotstuff/replica.h"
@@ -41,23 +49,54 @@
 #include "replication/unreplicated/replica.h"
 #include "replication/vr/replica.h"
 
+#include <atomic>
 #include <fstream>
+#include <functional>
 #include <iostream>
+#include <new>
 #include <thread>
 #include <vector>
 
 #include <sched.h>
+#include <stdio.h>
 #include <stdlib.h>
+#include <sys/resource.h>
 #include <unistd.h>
 
+// every heap allocation of the process, for the allocations per prologue of
+// the runner metrics report
+static std::atomic<uint64_t> n_alloc(0);
+
+void *operator new(size_t size) {
+    n_alloc.fetch_add(1, std::memory_order_relaxed);
+    void *p = malloc(size);
+    if (p == nullptr) {
+        throw std::bad_alloc();
+    }
+    return p;
+}
+
+void operator delete(void *p) noexcept { free(p); }
+void operator delete(void *p, size_t) noexcept { free(p); }
+
 static void Usage(const char *progName) {
     fprintf(
         stderr,
         "usage: %s "
         "-c conf-file [-R] -i replica-index "
         "-m unreplicated|signedunrep|vr|fastpaxos|nopaxos "
-        "[-b batch-size] [-d packet-drop-rate] [-r packet-reorder-rate] "
-        "[-w number-worker-thread]\n",
+        "[-b batch-size (the cap with -L)] "
+        "[-L target-latency-us (adaptive batch size)] "
+        "[-K pipeline-depth (pbft batches in flight)] "
+        "[-d packet-drop-rate] [-r packet-reorder-rate] "
+        "[-w number-worker-thread[:ctpl|spin|elastic|worksteal]] "
+        "[-B udp-io-batch-size] [-a cpu-placement] "
+        "[-p udp|iouring] [-k identifier] [-V verify-cache-entries] "
+        "[-M runner-metrics-interval-ms] "
+        "[-S runner-spin-budget-us (negative to never park)] "
+        "[-C checkpoint-interval (0 to never truncate log)] "
+        "[-Q vector|aggregate (hotstuff QC)] "
+        "[-U memory-report-interval-ms]\n",
         progName);
     exit(1);
 }
@@ -70,6 +109,26 @@ int main(int argc, char **argv) {
     int batchSize = 1;
     bool recover = false;
     int n_worker_thread = 8;
+    // ordered runner for pbft and signedunrep, empty for protocol default
+    std::string runner_name;
+    int io_batch_size = 1;
+    enum { TRANSPORT_UDP, TRANSPORT_IOURING } transport_type = TRANSPORT_UDP;
+    // the configured identity of the replica by default
+    std::string identifier;
+    // -1 keeps default cache size and reports nothing
+    long verify_cache_size = -1;
+    // 0 only dumps runner metrics on exit
+    long metrics_interval = 0;
+    // for pbft, hotstuff and minbft
+    opnum_t checkpoint_interval = dsnet::DEFAULT_CHECKPOINT_INTERVAL;
+    // for vr, pbft, hotstuff and minbft, 0 fixes the batch size at -b
+    uint64_t target_latency_us = 0;
+    // for pbft, batches the primary proposes ahead of commits
+    int pipeline_depth = dsnet::pbft::DEFAULT_PIPELINE_DEPTH;
+    // for hotstuff, one multi-signature per QC instead of signed votes
+    bool aggregate_qc = false;
+    // 0 reports nothing, for long running memory usage check
+    long memory_interval = 0;
 
     dsnet::AppReplica *nullApp = new dsnet::AppReplica();
 
@@ -90,8 +149,14 @@ int main(int argc, char **argv) {
 
     // Parse arguments
     int opt;
-    while ((opt = getopt(argc, argv, "b:c:d:i:m:r:R:w:")) != -1) {
+    while ((opt = getopt(argc, argv, "a:b:B:c:C:d:i:k:K:L:m:M:p:Q:r:R:S:U:V:w:")) != -1) {
         switch (opt) {
+        case 'a':
+            // e.g. 0-14,32-46 for isolated cpus on NSL nodes, see
+            // CPUPlacement for the format
+            dsnet::CPUPlacement::SetDefault(optarg);
+            break;
+
         case 'b': {
             char *strtolPtr;
             batchSize = strtoul(optarg, &strtolPtr, 10);
@@ -102,10 +167,52 @@ int main(int argc, char **argv) {
             break;
         }
 
+        case 'B': {
+            char *strtolPtr;
+            io_batch_size = strtoul(optarg, &strtolPtr, 10);
+            if ((*optarg == '\0') || (*strtolPtr != '\0') ||
+                (io_batch_size < 1)) {
+                fprintf(stderr, "option -B requires a numeric arg\n");
+                Usage(argv[0]);
+            }
+            break;
+        }
+
         case 'c':
             configPath = optarg;
             break;
 
+        case 'C': {
+            char *strtolPtr;
+            checkpoint_interval = strtoul(optarg, &strtolPtr, 10);
+            if ((*optarg == '\0') || (*strtolPtr != '\0')) {
+                fprintf(stderr, "option -C requires a numeric arg\n");
+                Usage(argv[0]);
+            }
+            break;
+        }
+
+        case 'K': {
+            char *strtolPtr;
+            pipeline_depth = strtol(optarg, &strtolPtr, 10);
+            if ((*optarg == '\0') || (*strtolPtr != '\0') ||
+                (pipeline_depth < 1)) {
+                fprintf(stderr, "option -K requires a numeric arg\n");
+                Usage(argv[0]);
+            }
+            break;
+        }
+
+        case 'L': {
+            char *strtolPtr;
+            target_latency_us = strtoul(optarg, &strtolPtr, 10);
+            if ((*optarg == '\0') || (*strtolPtr != '\0')) {
+                fprintf(stderr, "option -L requires a numeric arg\n");
+                Usage(argv[0]);
+            }
+            break;
+        }
+
         case 'd': {
             char *strtodPtr;
             dropRate = strtod(optarg, &strtodPtr);
@@ -156,6 +263,28 @@ int main(int argc, char **argv) {
             }
             break;
 
+        case 'p':
+            if (strcasecmp(optarg, "udp") == 0) {
+                transport_type = TRANSPORT_UDP;
+            } else if (strcasecmp(optarg, "iouring") == 0) {
+                transport_type = TRANSPORT_IOURING;
+            } else {
+                fprintf(stderr, "unknown transport '%s'\n", optarg);
+                Usage(argv[0]);
+            }
+            break;
+
+        case 'Q':
+            if (strcasecmp(optarg, "vector") == 0) {
+                aggregate_qc = false;
+            } else if (strcasecmp(optarg, "aggregate") == 0) {
+                aggregate_qc = true;
+            } else {
+                fprintf(stderr, "unknown QC mode '%s'\n", optarg);
+                Usage(argv[0]);
+            }
+            break;
+
         case 'r': {
             char *strtodPtr;
             reorderRate = strtod(optarg, &strtodPtr);
@@ -173,11 +302,65 @@ int main(int argc, char **argv) {
             recover = true;
             break;
 
+        case 'k':
+            identifier = std::string(optarg);
+            break;
+
+        case 'V': {
+            char *strtolPtr;
+            verify_cache_size = strtol(optarg, &strtolPtr, 10);
+            if ((*optarg == '\0') || (*strtolPtr != '\0') ||
+                (verify_cache_size < 0)) {
+                fprintf(stderr, "option -V requires a numeric arg\n");
+                Usage(argv[0]);
+            }
+            break;
+        }
+
+        case 'M': {
+            char *strtolPtr;
+            metrics_interval = strtol(optarg, &strtolPtr, 10);
+            if ((*optarg == '\0') || (*strtolPtr != '\0') ||
+                (metrics_interval < 0)) {
+                fprintf(stderr, "option -M requires a numeric arg\n");
+                Usage(argv[0]);
+            }
+            break;
+        }
+
+        case 'S': {
+            char *strtolPtr;
+            long spin_budget = strtol(optarg, &strtolPtr, 10);
+            if ((*optarg == '\0') || (*strtolPtr != '\0')) {
+                fprintf(stderr, "option -S requires a numeric arg\n");
+                Usage(argv[0]);
+            }
+            dsnet::Parker::SetSpinBudget(
+                spin_budget < 0 ? dsnet::Parker::SPIN_FOREVER
+                                : spin_budget * 1000);
+            break;
+        }
+
+        case 'U': {
+            char *strtolPtr;
+            memory_interval = strtol(optarg, &strtolPtr, 10);
+            if ((*optarg == '\0') || (*strtolPtr != '\0') ||
+                (memory_interval < 0)) {
+                fprintf(stderr, "option -U requires a numeric arg\n");
+                Usage(argv[0]);
+            }
+            break;
+        }
+
         case 'w': {
             char *strtod_ptr;
             n_worker_thread = strtod(optarg, &strtod_ptr);
-            if (*optarg == '\0' || *strtod_ptr != '\0' ||
-                n_worker_thread <= 0) {
+            if (*strtod_ptr == ':') {
+                runner_name = std::string(strtod_ptr + 1);
+            } else if (*strtod_ptr != '\0') {
+                Usage(argv[0]);
+            }
+            if (*optarg == '\0' || n_worker_thread <= 0) {
                 Usage(argv[0]);
             }
             break;
@@ -202,8 +385,31 @@ int main(int argc, char **argv) {
         fprintf(stderr, "option -m is required\n");
         Usage(argv[0]);
     }
-    if ((proto != PROTO_VR) && (batchSize != 1)) {
-        Warning("Batching enabled, but has no effect on non-VR protocols");
+    if ((transport_type != TRANSPORT_UDP) &&
+        ((reorderRate != 0) || (io_batch_size != 1))) {
+        fprintf(stderr, "options -r and -B require udp transport\n");
+        Usage(argv[0]);
+    }
+    if (!runner_name.empty() && (proto != PROTO_PBFT) &&
+        (proto != PROTO_SIGNEDUNREP)) {
+        fprintf(stderr, "choosing runner requires pbft or signedunrep\n");
+        Usage(argv[0]);
+    }
+    bool batching = (proto == PROTO_VR) || (proto == PROTO_SIGNEDUNREP) ||
+                    (proto == PROTO_HOTSTUFF) || (proto == PROTO_PBFT) ||
+                    (proto == PROTO_MINBFT);
+    if (!batching && (batchSize != 1)) {
+        Warning("Batching enabled, but has no effect on this protocol");
+    }
+    if ((target_latency_us != 0) &&
+        (!batching || (proto == PROTO_SIGNEDUNREP))) {
+        fprintf(stderr,
+                "option -L requires vr, pbft, hotstuff or minbft\n");
+        Usage(argv[0]);
+    }
+    if ((target_latency_us != 0) && (batchSize == 1)) {
+        fprintf(stderr, "option -L requires -b to cap the batch size\n");
+        Usage(argv[0]);
     }
 
     // Load configuration
@@ -213,6 +419,13 @@ int main(int argc, char **argv) {
         Usage(argv[0]);
     }
     dsnet::Configuration config(configStream);
+    if (identifier.empty()) {
+        identifier = config.identity(index);
+    }
+    dsnet::KeyRegistry::Load(config, identifier);
+    if (verify_cache_size != -1) {
+        dsnet::SignedAdapter::SetVerifyCacheSize(verify_cache_size);
+    }
 
     if (index >= config.n) {
         fprintf(
@@ -223,67 +436,138 @@ int main(int argc, char **argv) {
         Usage(argv[0]);
     }
 
-    dsnet::UDPTransport transport(dropRate, reorderRate, nullptr);
+    dsnet::Transport *transport;
+    switch (transport_type) {
+    case TRANSPORT_UDP:
+        transport = new dsnet::UDPTransport(
+            dropRate, reorderRate, nullptr, io_batch_size);
+        break;
+    case TRANSPORT_IOURING:
+        transport = new dsnet::IOUringTransport(dropRate);
+        break;
+    }
 
     dsnet::Replica *replica;
     switch (proto) {
     case PROTO_UNREPLICATED:
         replica = new dsnet::unreplicated::UnreplicatedReplica(
-            config, index, !recover, &transport, nullApp);
+            config, index, !recover, transport, nullApp);
         break;
 
     case PROTO_VR:
         replica = new dsnet::vr::VRReplica(
-            config, index, !recover, &transport, batchSize, nullApp);
+            config, index, !recover, transport, batchSize, nullApp,
+            target_latency_us);
         break;
 
     case PROTO_FASTPAXOS:
         replica = new dsnet::fastpaxos::FastPaxosReplica(
-            config, index, !recover, &transport, nullApp);
+            config, index, !recover, transport, nullApp);
         break;
 
     case PROTO_NOPAXOS:
         replica = new dsnet::nopaxos::NOPaxosReplica(
-            config, index, !recover, &transport, nullApp);
+            config, index, !recover, transport, nullApp);
         break;
 
     case PROTO_SIGNEDUNREP:
         replica = new dsnet::signedunrep::SignedUnrepReplica(
-            config, "Steve", n_worker_thread, batchSize, &transport, nullApp);
+            config, identifier, n_worker_thread, batchSize, transport, nullApp,
+            runner_name.empty() ? "spin" : runner_name);
         break;
 
     case PROTO_TOMBFT:
         replica = new dsnet::tombft::TOMBFTReplica(
-            config, index, "Steve", n_worker_thread, &transport, nullApp);
+            config, index, identifier, n_worker_thread, transport, nullApp);
         break;
 
     case PROTO_TOMBFT_HMAC:
         replica = new dsnet::tombft::TOMBFTHMACReplica(
-            config, index, "Steve", n_worker_thread, &transport, nullApp);
+            config, index, identifier, n_worker_thread, transport, nullApp);
         break;
 
     case PROTO_HOTSTUFF:
         replica = new dsnet::hotstuff::HotStuffReplica(
-            config, index, "Steve", n_worker_thread, batchSize, &transport,
-            nullApp);
+            config, index, identifier, n_worker_thread, batchSize, transport,
+            nullApp, checkpoint_interval, aggregate_qc, target_latency_us);
         break;
 
     case PROTO_PBFT:
         replica = new dsnet::pbft::PBFTReplica(
-            config, index, "Steve", n_worker_thread, batchSize, &transport,
-            nullApp);
+            config, index, identifier, n_worker_thread, batchSize, transport,
+            nullApp, runner_name.empty() ? "ctpl" : runner_name,
+            checkpoint_interval, target_latency_us, pipeline_depth);
         break;
 
     case PROTO_MINBFT:
         replica = new dsnet::minbft::MinBFTReplica(
-            config, index, "Steve", n_worker_thread, batchSize, &transport,
-            nullApp);
+            config, index, identifier, n_worker_thread, batchSize, transport,
+            nullApp, checkpoint_interval, target_latency_us);
         break;
 
     default:
         NOT_REACHABLE();
     }
 
-    transport.Run();
+    // report signature verifications saved by the cache once per second
+    std::function<void()> report_verify_cache = [&] {
+        auto stats = dsnet::SignedAdapter::GetVerifyCacheStats();
+        Notice(
+            "Verify cache: %lu hit, %lu miss", (unsigned long)stats.hit,
+            (unsigned long)stats.miss);
+        transport->Timer(1000, report_verify_cache);
+    };
+    if (verify_cache_size != -1) {
+        transport->Timer(1000, report_verify_cache);
+    }
+
+    // cumulative since runner creation, same as the dump on exit
+    std::function<void()> report_runner_metrics = [&] {
+        uint64_t n_prologue = 0;
+        for (auto &snapshot : dsnet::RunnerMetrics::TakeAll()) {
+            snapshot.Dump();
+            n_prologue += snapshot.Total(dsnet::RunnerMetrics::Prologue).count;
+        }
+        // tasks too large to be stored inline
+        auto task_stats = dsnet::TaskPool::GetStats();
+        Notice(
+            "Task pool: %lu blocks allocated, %lu reused",
+            (unsigned long)task_stats.allocated,
+            (unsigned long)task_stats.reused);
+        // all of the process, i.e. including messages and transport
+        uint64_t n_heap = n_alloc.load(std::memory_order_relaxed);
+        Notice(
+            "Heap: %lu allocations, %.3f per prologue", (unsigned long)n_heap,
+            n_prologue == 0 ? 0.0 : (double)n_heap / n_prologue);
+        transport->Timer(metrics_interval, report_runner_metrics);
+    };
+    if (metrics_interval != 0) {
+        transport->Timer(metrics_interval, report_runner_metrics);
+    }
+
+    // resident and peak resident set size, should stay flat over a long run
+    // once the log is truncated by checkpoints
+    std::function<void()> report_memory = [&] {
+        long size = 0, resident = 0;
+        FILE *statm = fopen("/proc/self/statm", "r");
+        if (statm != nullptr) {
+            if (fscanf(statm, "%ld %ld", &size, &resident) != 2) {
+                resident = 0;
+            }
+            fclose(statm);
+        }
+        struct rusage usage;
+        getrusage(RUSAGE_SELF, &usage);
+        Notice(
+            "Memory: %ld KB resident, %ld KB peak",
+            resident * (sysconf(_SC_PAGESIZE) / 1024), usage.ru_maxrss);
+        transport->Timer(memory_interval, report_memory);
+    };
+    if (memory_interval != 0) {
+        transport->Timer(memory_interval, report_memory);
+    }
+
+    transport->Run();
     delete replica;
+    delete transport;
 }
@@ -0,0 +1,139 @@
+#include "common/parker.h"
+#include "common/runner.h"
+#include "lib/message.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <sys/resource.h>
+#include <unistd.h>
+
+// Latency against cpu usage of an ordered runner, SpinOrderedRunner by
+// default, at low load, for a range of spin budgets. Requests arrive every
+// `gap-us`, so with a budget shorter than the gap the workers park between
+// requests and pay a futex wakeup each.
+
+static void Usage(const char *progName)
+{
+    fprintf(stderr,
+            "usage: %s [-r spin|elastic|worksteal|ctpl] [-w workers] "
+            "[-n requests] [-g gap-us] "
+            "[-s spin-budget-us (negative to never park)]\n",
+            progName);
+    exit(1);
+}
+
+static double CpuSeconds()
+{
+    struct rusage usage;
+    getrusage(RUSAGE_SELF, &usage);
+    return usage.ru_utime.tv_sec + usage.ru_utime.tv_usec * 1e-6 +
+           usage.ru_stime.tv_sec + usage.ru_stime.tv_usec * 1e-6;
+}
+
+static void RunOnce(const std::string &name, int n_worker, int n_request,
+                    int gap_us, int64_t budget_us)
+{
+    using Clock = std::chrono::steady_clock;
+    dsnet::Parker::SetSpinBudget(budget_us < 0 ? dsnet::Parker::SPIN_FOREVER
+                                               : budget_us * 1000);
+
+    std::vector<Clock::time_point> submit(n_request), done(n_request);
+    std::atomic<int> n_done(0);
+    {
+        std::unique_ptr<dsnet::Runner> runner =
+            dsnet::CreateOrderedRunner(name, n_worker);
+        double cpu_start = CpuSeconds();
+        Clock::time_point start = Clock::now();
+        for (int i = 0; i < n_request; i++) {
+            std::this_thread::sleep_until(
+                start + std::chrono::microseconds(gap_us) * i);
+            submit[i] = Clock::now();
+            runner->RunPrologue([&done, &n_done, i] {
+                return [&done, &n_done, i] {
+                    done[i] = Clock::now();
+                    n_done += 1;
+                };
+            });
+        }
+        while (n_done < n_request) {
+            std::this_thread::yield();
+        }
+        double wall = std::chrono::duration<double>(Clock::now() - start)
+                          .count();
+        double cpu = CpuSeconds() - cpu_start;
+
+        std::vector<double> latencies(n_request);
+        double sum = 0;
+        for (int i = 0; i < n_request; i++) {
+            latencies[i] =
+                std::chrono::duration<double, std::micro>(done[i] - submit[i])
+                    .count();
+            sum += latencies[i];
+        }
+        std::sort(latencies.begin(), latencies.end());
+        char budget[32];
+        if (budget_us < 0) {
+            strcpy(budget, "forever");
+        } else {
+            snprintf(budget, sizeof(budget), "%ld us", (long)budget_us);
+        }
+        Notice("spin budget %s: %.1f us avg, %.1f us p50, %.1f us p99 "
+               "latency, %.2f cpus busy",
+               budget, sum / n_request, latencies[n_request / 2],
+               latencies[n_request * 99 / 100], cpu / wall);
+    }
+}
+
+int main(int argc, char **argv)
+{
+    std::string name = "spin";
+    int n_worker = 2;
+    int n_request = 2000;
+    int gap_us = 200;
+    std::vector<int64_t> budgets = {0, 10, 100, 1000, -1};
+
+    int opt;
+    while ((opt = getopt(argc, argv, "r:w:n:g:s:")) != -1) {
+        char *strtol_ptr = (char *)"";
+        switch (opt) {
+        case 'r':
+            name = optarg;
+            break;
+        case 'w':
+            n_worker = strtoul(optarg, &strtol_ptr, 10);
+            break;
+        case 'n':
+            n_request = strtoul(optarg, &strtol_ptr, 10);
+            break;
+        case 'g':
+            gap_us = strtoul(optarg, &strtol_ptr, 10);
+            break;
+        case 's':
+            budgets = {strtol(optarg, &strtol_ptr, 10)};
+            break;
+        default:
+            Usage(argv[0]);
+        }
+        if (*optarg == '\0' || *strtol_ptr != '\0') {
+            Usage(argv[0]);
+        }
+    }
+    if (n_worker <= 0 || n_request <= 0) {
+        Usage(argv[0]);
+    }
+
+    Notice("%s runner, %d workers, one request every %d us", name.c_str(),
+           n_worker, gap_us);
+    for (int64_t budget_us : budgets) {
+        RunOnce(name, n_worker, n_request, gap_us, budget_us);
+    }
+    return 0;
+}
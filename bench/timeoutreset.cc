@@ -0,0 +1,80 @@
+#include "lib/message.h"
+#include "lib/transport.h"
+#include "lib/udptransport.h"
+
+#include <chrono>
+#include <cstdlib>
+#include <memory>
+#include <vector>
+
+#include <unistd.h>
+
+static void Usage(const char *progName)
+{
+    fprintf(stderr, "usage: %s [-n resets] [-t timeouts] [-m timeout-ms]\n",
+            progName);
+    exit(1);
+}
+
+int main(int argc, char **argv)
+{
+    int n_reset = 1000000;
+    int n_timeout = 64;
+    int timeout_ms = 1000;
+
+    int opt;
+    while ((opt = getopt(argc, argv, "n:t:m:")) != -1) {
+        char *strtol_ptr;
+        switch (opt) {
+        case 'n':
+            n_reset = strtoul(optarg, &strtol_ptr, 10);
+            break;
+        case 't':
+            n_timeout = strtoul(optarg, &strtol_ptr, 10);
+            break;
+        case 'm':
+            timeout_ms = strtoul(optarg, &strtol_ptr, 10);
+            break;
+        default:
+            Usage(argv[0]);
+        }
+        if (*optarg == '\0' || *strtol_ptr != '\0') {
+            Usage(argv[0]);
+        }
+    }
+    if (n_reset <= 0 || n_timeout <= 0) {
+        Usage(argv[0]);
+    }
+
+    dsnet::UDPTransport transport;
+    // replicas keep a handful of timeouts armed, e.g. view change, resend
+    // and batch closing, and reset some of them on every message
+    std::vector<std::unique_ptr<dsnet::Timeout>> timeouts;
+    int n_fired = 0;
+    for (int i = 0; i < n_timeout; i++) {
+        timeouts.emplace_back(new dsnet::Timeout(
+            &transport, timeout_ms + i, [&n_fired]() { n_fired++; }));
+        timeouts.back()->Start();
+    }
+
+    // reset from inside the event loop, as receivers do
+    transport.Timer(0, [&]() {
+        auto start = std::chrono::steady_clock::now();
+        for (int i = 0; i < n_reset; i++) {
+            timeouts[i % n_timeout]->Reset();
+        }
+        auto end = std::chrono::steady_clock::now();
+        double ns = std::chrono::duration<double, std::nano>(end - start)
+                        .count();
+        Notice("%d resets over %d timeouts: %.1f ns/reset, %.2f M resets/s, "
+               "%d fired",
+               n_reset, n_timeout, ns / n_reset, n_reset / ns * 1e3,
+               n_fired);
+        for (auto &timeout : timeouts) {
+            timeout->Stop();
+        }
+        transport.Stop();
+    });
+    transport.Run();
+    return 0;
+}
@@ -1,7 +1,8 @@
 d := $(dir $(lastword $(MAKEFILE_LIST)))
 
 SRCS += $(addprefix $(d), \
-	client.cc replica.cc log.cc pbmessage.cc taskqueue.cc signedadapter.cc runner.cc)
+	client.cc replica.cc log.cc pbmessage.cc taskqueue.cc signedadapter.cc keyregistry.cc runner.cc \
+	runnermetrics.cc inlinefunction.cc parker.cc multisig.cc)
 
 PROTOS += $(addprefix $(d), \
 	  request.proto)
@@ -10,17 +11,37 @@ LIB-request := $(o)request.o
 
 LIB-pbmessage := $(o)pbmessage.o
 
+LIB-log := $(o)log.o $(LIB-request) $(LIB-message)
+
 LIB-taskqueue := $(o)taskqueue.o $(LIB-message)
 
-LIB-runner := $(o)runner.o $(LIB-latency) $(LIB-message)
-$(o)runner.o: $(LIB-latency)
+LIB-runner := $(o)runner.o $(o)runnermetrics.o $(o)inlinefunction.o $(o)parker.o \
+		$(LIB-latency) $(LIB-cpuplacement) $(LIB-message)
+$(o)runnermetrics.o: $(LIB-latency)
+
+LIB-halfsiphash := $(o)halfsiphash.o
+
+LIB-keyregistry := $(o)keyregistry.o $(LIB-halfsiphash) $(LIB-message) \
+		$(LIB-configuration)
 
-LIB-signedadapter := $(o)signedadapter.o $(LIB-message)
+LIB-signedadapter := $(o)signedadapter.o $(LIB-keyregistry)
+
+LIB-multisig := $(o)multisig.o $(LIB-message)
 
 OBJS-client := $(o)client.o \
 		$(LIB-message) $(LIB-configuration) $(LIB-transport) \
 		$(LIB-request)
 
-OBJS-replica := $(o)replica.o $(o)log.o \
+OBJS-replica := $(o)replica.o $(LIB-log) \
 		$(LIB-message) $(LIB-request) \
 		$(LIB-configuration) $(LIB-udptransport)
+
+define compilec
+	@mkdir -p $(dir $@)
+	$(call trace,$(1),$<,\
+	  $(CC) -iquote. $(CFLAGS) $(CFLAGS-$<) $(2) $(DEPFLAGS) -E $<)
+	$(Q)$(CC) -iquote. $(CFLAGS) $(CFLAGS-$<) $(2) -c -o $@ $<
+endef
+
+$(o)halfsiphash.o: $(d)halfsiphash.c
+	$(call compilec,CC,)
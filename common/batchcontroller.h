@@ -0,0 +1,104 @@
+#pragma once
+#include "lib/message.h"
+#include "lib/viewstamp.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+
+namespace dsnet {
+
+// Batch size of a primary. Without a target latency it is fixed at
+// `max_size`. With one it starts from 1 and adapts to the load, AIMD style,
+// once per committed batch: it grows by one if the batch filled up while an
+// earlier one was still in flight, i.e. requests arrive faster than the
+// pipeline commits batches, and it shrinks by a quarter if the batch took
+// longer than the target from closing to committing. So at low load, where
+// batches close on timeout, it stays small and requests skip the wait, and
+// at peak it settles around the largest batch that meets the target. A
+// target below the latency of committing a lone request keeps the batch at
+// 1. `max_size` still caps it, e.g. to keep a batch within one packet.
+//
+// Latency is measured on the primary, from closing a batch to committing its
+// last op. Not thread safe, owned by the replica state i.e. only touched in
+// solo.
+class BatchController {
+public:
+    explicit BatchController(size_t max_size, uint64_t target_latency_us = 0)
+        : max_size(std::max<size_t>(max_size, 1)),
+          target(std::chrono::microseconds(target_latency_us)),
+          size(target_latency_us == 0 ? this->max_size : 1), n_batch(0),
+          n_request(0) {}
+
+    bool Adaptive() const { return target.count() != 0; }
+    // close the batch once it has that many requests
+    size_t Size() const { return size; }
+    size_t MaxSize() const { return max_size; }
+
+    // the batch of ops up to `last_op` is closed with `n_request` requests
+    void Close(opnum_t last_op, size_t n_request) {
+        if (n_request == 0) {
+            return;
+        }
+        n_batch += 1;
+        this->n_request += n_request;
+        if (!Adaptive()) {
+            return;
+        }
+        bool saturated = n_request >= size && !in_flight.empty();
+        in_flight[last_op] = Batch{Clock::now(), n_request, saturated};
+    }
+
+    // every op up to `op_number` is committed
+    void Commit(opnum_t op_number) {
+        Clock::time_point now = Clock::now();
+        while (!in_flight.empty() && in_flight.begin()->first <= op_number) {
+            const Batch &batch = in_flight.begin()->second;
+            if (now - batch.close_time > target) {
+                // batches closed before the last decrease are slow because
+                // of the size before it, so decrease once per round trip
+                if (batch.close_time > last_decrease) {
+                    size = std::max<size_t>(size - (size + 3) / 4, 1);
+                    last_decrease = now;
+                    Debug("Batch size decreases to %zu", size);
+                }
+            } else if (
+                batch.saturated && batch.n_request >= size &&
+                size < max_size) {
+                // a batch closed at a smaller size does not tell that the
+                // current one fills up as well, e.g. it grows by one for
+                // each of several in flight otherwise
+                size += 1;
+                Debug("Batch size increases to %zu", size);
+            }
+            in_flight.erase(in_flight.begin());
+        }
+    }
+
+    void Dump() const {
+        Notice(
+            "Batch size: %zu, %.1f requests per batch over %lu batches", size,
+            n_batch == 0 ? 0.0 : (double)n_request / n_batch,
+            (unsigned long)n_batch);
+    }
+
+private:
+    using Clock = std::chrono::steady_clock;
+    struct Batch {
+        Clock::time_point close_time;
+        size_t n_request;
+        bool saturated;
+    };
+
+    size_t max_size;
+    Clock::duration target;
+    size_t size;
+    // last op number -> closed batch that is not committed yet
+    std::map<opnum_t, Batch> in_flight;
+    Clock::time_point last_decrease;
+    uint64_t n_batch, n_request;
+};
+
+} // namespace dsnet
@@ -0,0 +1,206 @@
+#pragma once
+#include "lib/viewstamp.h"
+
+#include <algorithm>
+#include <map>
+#include <openssl/evp.h>
+#include <openssl/sha.h>
+#include <string>
+#include <utility>
+
+namespace dsnet {
+
+// checkpoint every that many executed ops by default, 0 disables
+const opnum_t DEFAULT_CHECKPOINT_INTERVAL = 1024;
+
+// digest that Checkpoint messages sign: of the application state right
+// after the checkpoint op, as returned by `Replica::Snapshot`, following
+// `log_hash`, the hash chain of the log up to the op, for replicas whose log
+// is hashed. State transfer recomputes it from what it ships, so a state that
+// does not match its proof is never restored
+inline std::string CheckpointDigest(
+    const std::string &state, const std::string &log_hash = "") {
+    std::string digest(SHA256_DIGEST_LENGTH, '\0');
+    EVP_MD_CTX *context = EVP_MD_CTX_new();
+    EVP_DigestInit_ex(context, EVP_sha256(), nullptr);
+    EVP_DigestUpdate(context, log_hash.data(), log_hash.size());
+    EVP_DigestUpdate(context, state.data(), state.size());
+    EVP_DigestFinal_ex(context, (unsigned char *)&digest[0], nullptr);
+    EVP_MD_CTX_free(context);
+    return digest;
+}
+
+// PBFT-style stable checkpoints. A replica takes a checkpoint once every
+// `interval` executed ops and sends a signed Checkpoint (op number, digest)
+// to all; the checkpoint is stable when `quorum` replicas, itself included,
+// have sent the same digest for it. Log entries and per-op quorums at or
+// below the stable checkpoint can then be garbage collected, and the
+// Checkpoint messages that made it stable prove it to others. Together with
+// the application state at the checkpoint, kept by `SetState` when taking
+// it, the proof is what state transfer ships to lagging replicas.
+//
+// Only checkpoint op numbers count, and each replica has one digest per op,
+// the first it sends. Checkpoints up to MAX_AHEAD intervals beyond the stable
+// one are collected per op; of the ones further ahead, e.g. while this
+// replica lags, only the newest of each replica is kept, so what a faulty
+// replica can make this replica hold is bounded either way.
+//
+// Not thread safe, owned by the replica state i.e. only touched in solo.
+class CheckpointTracker {
+public:
+    static const opnum_t MAX_AHEAD = 4;
+
+    CheckpointTracker(opnum_t interval, int quorum)
+        : interval(interval), quorum(quorum), taken(0), stable(0),
+          has_stable_state(false) {}
+
+    bool Enabled() const { return interval != 0; }
+
+    // the latest checkpoint op number up to `executed` that is not taken
+    // yet, or 0; call after executing (maybe a batch of) ops
+    opnum_t Take(opnum_t executed) {
+        if (!Enabled()) {
+            return 0;
+        }
+        opnum_t op_number = executed - executed % interval;
+        if (op_number <= taken) {
+            return 0;
+        }
+        taken = op_number;
+        return op_number;
+    }
+
+    // application state right after executing the taken `op_number`, and
+    // the log hash at it if the log is hashed, see `CheckpointDigest`
+    void SetState(
+        opnum_t op_number, std::string state, std::string log_hash = "") {
+        taken_state[op_number] = {std::move(state), std::move(log_hash)};
+    }
+
+    // true if the checkpoint becomes stable with this message; messages of
+    // checkpoints that are not newer than the stable one are dropped
+    bool Add(
+        opnum_t op_number, const std::string &digest, int replica_id,
+        std::string signed_checkpoint) {
+        if (!Enabled() || op_number <= stable || op_number % interval != 0) {
+            return false;
+        }
+        if (op_number > stable + MAX_AHEAD * interval) {
+            auto newest = ahead.find(replica_id);
+            if (newest != ahead.end() && newest->second.first >= op_number) {
+                return false;
+            }
+            ahead[replica_id] = {
+                op_number, {digest, std::move(signed_checkpoint)}};
+            std::map<int, Entry> newest_at;
+            for (const auto &entry : ahead) {
+                if (entry.second.first == op_number) {
+                    newest_at[entry.first] = entry.second.second;
+                }
+            }
+            return CheckStable(op_number, digest, newest_at);
+        }
+        std::map<int, Entry> &entries = pending[op_number];
+        if (!entries
+                 .emplace(replica_id, Entry{digest, std::move(signed_checkpoint)})
+                 .second) {
+            return false;
+        }
+        return CheckStable(op_number, digest, entries);
+    }
+
+    // a stable checkpoint received by state transfer, the proof is verified
+    // by the caller
+    void Install(
+        opnum_t op_number, const std::string &digest,
+        std::map<int, std::string> proof, std::string state,
+        std::string log_hash = "") {
+        stable = op_number;
+        taken = std::max(taken, op_number);
+        stable_digest = digest;
+        stable_proof = std::move(proof);
+        has_stable_state = true;
+        stable_state = std::move(state);
+        stable_log_hash = std::move(log_hash);
+        Prune();
+    }
+
+    opnum_t Stable() const { return stable; }
+    const std::string &StableDigest() const { return stable_digest; }
+    // replica id -> signed Checkpoint
+    const std::map<int, std::string> &StableProof() const {
+        return stable_proof;
+    }
+    // false if the stable checkpoint is not taken by this replica, e.g. it
+    // was lagging, so there is nothing to ship
+    bool HasStableState() const { return has_stable_state; }
+    const std::string &StableState() const { return stable_state; }
+    const std::string &StableLogHash() const { return stable_log_hash; }
+
+private:
+    // digest, signed Checkpoint
+    using Entry = std::pair<std::string, std::string>;
+
+    opnum_t interval;
+    int quorum;
+    opnum_t taken, stable;
+    std::string stable_digest;
+    std::map<int, std::string> stable_proof;
+    bool has_stable_state;
+    std::string stable_state, stable_log_hash;
+    // op number -> (state, log hash)
+    std::map<opnum_t, std::pair<std::string, std::string>> taken_state;
+    // op number -> replica id -> its Checkpoint
+    std::map<opnum_t, std::map<int, Entry>> pending;
+    // replica id -> op number and the newest Checkpoint of the replica
+    // beyond MAX_AHEAD intervals
+    std::map<int, std::pair<opnum_t, Entry>> ahead;
+
+    // make `op_number` stable if `quorum` of `entries` have `digest`
+    bool CheckStable(
+        opnum_t op_number, const std::string &digest,
+        const std::map<int, Entry> &entries) {
+        std::map<int, std::string> proof;
+        for (const auto &entry : entries) {
+            if (entry.second.first == digest) {
+                proof[entry.first] = entry.second.second;
+            }
+        }
+        if ((int)proof.size() < quorum) {
+            return false;
+        }
+        auto state = taken_state.find(op_number);
+        has_stable_state = state != taken_state.end();
+        if (has_stable_state) {
+            stable_state = std::move(state->second.first);
+            stable_log_hash = std::move(state->second.second);
+        }
+        stable = op_number;
+        stable_digest = digest;
+        stable_proof = std::move(proof);
+        Prune();
+        return true;
+    }
+
+    // drop what the stable checkpoint covers, and collect the newest
+    // Checkpoints that are no longer too far ahead per op
+    void Prune() {
+        pending.erase(pending.begin(), pending.upper_bound(stable));
+        taken_state.erase(
+            taken_state.begin(), taken_state.upper_bound(stable));
+        for (auto entry = ahead.begin(); entry != ahead.end();) {
+            opnum_t op_number = entry->second.first;
+            if (op_number <= stable + MAX_AHEAD * interval) {
+                if (op_number > stable) {
+                    pending[op_number].emplace(
+                        entry->first, std::move(entry->second.second));
+                }
+                entry = ahead.erase(entry);
+            } else {
+                ++entry;
+            }
+        }
+    }
+};
+
+} // namespace dsnet
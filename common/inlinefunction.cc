@@ -0,0 +1,68 @@
+#include "common/inlinefunction.h"
+
+#include <atomic>
+
+namespace dsnet {
+
+namespace {
+
+const size_t CLASS_SIZE = 64, N_CLASS = 16;
+// blocks freed on a thread that never allocates (e.g. prologues created by
+// driver and destroyed by workers) must not pile up
+const size_t FREE_LIST_MAX = 256;
+
+struct FreeBlock {
+    FreeBlock *next;
+};
+
+struct FreeLists {
+    FreeBlock *heads[N_CLASS] = {};
+    size_t counts[N_CLASS] = {};
+
+    ~FreeLists() {
+        for (size_t i = 0; i < N_CLASS; i += 1) {
+            while (FreeBlock *block = heads[i]) {
+                heads[i] = block->next;
+                ::operator delete(block);
+            }
+        }
+    }
+};
+
+thread_local FreeLists free_lists;
+std::atomic<uint64_t> n_allocated(0), n_reused(0);
+
+} // namespace
+
+void *TaskPool::Allocate(size_t size) {
+    size_t i = (size - 1) / CLASS_SIZE;
+    if (i < N_CLASS && free_lists.heads[i] != nullptr) {
+        FreeBlock *block = free_lists.heads[i];
+        free_lists.heads[i] = block->next;
+        free_lists.counts[i] -= 1;
+        n_reused.fetch_add(1, std::memory_order_relaxed);
+        return block;
+    }
+    n_allocated.fetch_add(1, std::memory_order_relaxed);
+    return ::operator new(i < N_CLASS ? (i + 1) * CLASS_SIZE : size);
+}
+
+void TaskPool::Free(void *block, size_t size) {
+    size_t i = (size - 1) / CLASS_SIZE;
+    if (i >= N_CLASS || free_lists.counts[i] >= FREE_LIST_MAX) {
+        ::operator delete(block);
+        return;
+    }
+    FreeBlock *free_block = static_cast<FreeBlock *>(block);
+    free_block->next = free_lists.heads[i];
+    free_lists.heads[i] = free_block;
+    free_lists.counts[i] += 1;
+}
+
+TaskPool::Stats TaskPool::GetStats() {
+    return Stats{
+        n_allocated.load(std::memory_order_relaxed),
+        n_reused.load(std::memory_order_relaxed)};
+}
+
+} // namespace dsnet
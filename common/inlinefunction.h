@@ -0,0 +1,170 @@
+#pragma once
+#include "lib/assert.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace dsnet {
+
+// Blocks for the callables of InlineFunction that do not fit inline. Sizes up
+// to 1 KiB are rounded up to 64-byte classes, and freed blocks are kept in a
+// bounded thread-local free list per class, so a worker that keeps creating
+// and destroying tasks of similar size stops allocating. Larger callables go
+// straight to operator new.
+class TaskPool {
+public:
+    static void *Allocate(size_t size);
+    static void Free(void *block, size_t size);
+
+    // process-wide, only counts callables that did not fit inline
+    struct Stats {
+        uint64_t allocated, reused;
+    };
+    static Stats GetStats();
+};
+
+// Move-only replacement of std::function for Runner tasks. Callables of up to
+// INLINE_SIZE bytes are stored in place, larger ones in a TaskPool block, so
+// dispatching a message through prologue, solo and epilogue does not allocate
+// as long as the captures are moved in instead of copied. Being move-only, it
+// can hold move-only captures e.g. std::unique_ptr<TransportAddress>.
+//
+// Like std::function, operator() is const but calls the callable as
+// non-const, so mutable lambdas work. Calling an empty one is an error.
+template <typename Signature> class InlineFunction;
+
+template <typename R, typename... Args> class InlineFunction<R(Args...)> {
+    // also excludes subclasses, e.g. Runner::Solo
+    template <typename F, typename D = typename std::decay<F>::type>
+    using EnableIfCallable = typename std::enable_if<
+        !std::is_base_of<InlineFunction, D>::value &&
+        !std::is_same<D, std::nullptr_t>::value>::type;
+
+public:
+    static const size_t INLINE_SIZE = 128;
+
+    InlineFunction() noexcept : ops(nullptr) {}
+    InlineFunction(std::nullptr_t) noexcept : ops(nullptr) {}
+    template <typename F, typename = EnableIfCallable<F>>
+    InlineFunction(F &&f) : ops(nullptr) {
+        Store(std::forward<F>(f));
+    }
+    InlineFunction(InlineFunction &&other) noexcept : ops(nullptr) {
+        MoveFrom(other);
+    }
+    InlineFunction(const InlineFunction &) = delete;
+    ~InlineFunction() { Reset(); }
+
+    InlineFunction &operator=(InlineFunction &&other) noexcept {
+        if (this != &other) {
+            Reset();
+            MoveFrom(other);
+        }
+        return *this;
+    }
+    InlineFunction &operator=(const InlineFunction &) = delete;
+    InlineFunction &operator=(std::nullptr_t) noexcept {
+        Reset();
+        return *this;
+    }
+    template <typename F, typename = EnableIfCallable<F>>
+    InlineFunction &operator=(F &&f) {
+        Reset();
+        Store(std::forward<F>(f));
+        return *this;
+    }
+
+    explicit operator bool() const { return ops != nullptr; }
+
+    R operator()(Args... args) const {
+        ASSERT(ops != nullptr);
+        return ops->invoke(storage, std::forward<Args>(args)...);
+    }
+
+private:
+    struct Ops {
+        R (*invoke)(void *storage, Args &&... args);
+        // move construct into dst and destroy the one in src
+        void (*relocate)(void *dst, void *src);
+        void (*destroy)(void *storage);
+    };
+
+    template <typename F> struct InlineOps {
+        static R Invoke(void *storage, Args &&... args) {
+            return (*static_cast<F *>(storage))(std::forward<Args>(args)...);
+        }
+        static void Relocate(void *dst, void *src) {
+            new (dst) F(std::move(*static_cast<F *>(src)));
+            static_cast<F *>(src)->~F();
+        }
+        static void Destroy(void *storage) { static_cast<F *>(storage)->~F(); }
+        static const Ops *Get() {
+            static constexpr Ops table = {&Invoke, &Relocate, &Destroy};
+            return &table;
+        }
+    };
+
+    // storage holds a F * into a TaskPool block
+    template <typename F> struct PooledOps {
+        static F *Target(void *storage) { return *static_cast<F **>(storage); }
+        static R Invoke(void *storage, Args &&... args) {
+            return (*Target(storage))(std::forward<Args>(args)...);
+        }
+        static void Relocate(void *dst, void *src) {
+            *static_cast<F **>(dst) = Target(src);
+        }
+        static void Destroy(void *storage) {
+            F *target = Target(storage);
+            target->~F();
+            TaskPool::Free(target, sizeof(F));
+        }
+        static const Ops *Get() {
+            static constexpr Ops table = {&Invoke, &Relocate, &Destroy};
+            return &table;
+        }
+    };
+
+    const Ops *ops;
+    alignas(std::max_align_t) mutable unsigned char storage[INLINE_SIZE];
+
+    template <typename F> void Store(F &&f) {
+        using Target = typename std::decay<F>::type;
+        using Fits = std::integral_constant<
+            bool, sizeof(Target) <= INLINE_SIZE &&
+                      alignof(Target) <= alignof(std::max_align_t) &&
+                      std::is_nothrow_move_constructible<Target>::value>;
+        Emplace<Target>(std::forward<F>(f), Fits());
+    }
+    template <typename Target, typename F>
+    void Emplace(F &&f, std::true_type /* fits */) {
+        new (storage) Target(std::forward<F>(f));
+        ops = InlineOps<Target>::Get();
+    }
+    template <typename Target, typename F>
+    void Emplace(F &&f, std::false_type /* fits */) {
+        void *block = TaskPool::Allocate(sizeof(Target));
+        *reinterpret_cast<Target **>(storage) =
+            new (block) Target(std::forward<F>(f));
+        ops = PooledOps<Target>::Get();
+    }
+
+    void MoveFrom(InlineFunction &other) {
+        if (other.ops != nullptr) {
+            other.ops->relocate(storage, other.storage);
+            ops = other.ops;
+            other.ops = nullptr;
+        }
+    }
+
+    void Reset() {
+        if (ops != nullptr) {
+            ops->destroy(storage);
+            ops = nullptr;
+        }
+    }
+};
+
+} // namespace dsnet
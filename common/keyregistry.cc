@@ -0,0 +1,492 @@
+#include "common/keyregistry.h"
+#include "lib/assert.h"
+#include "lib/message.h"
+
+#include <cstring>
+#include <map>
+#include <memory>
+#include <openssl/crypto.h>
+#include <openssl/evp.h>
+#include <openssl/hmac.h>
+#include <openssl/sha.h>
+#include <secp256k1.h>
+
+extern "C" int halfsiphash(
+    const void *in, const size_t inlen, const void *k, uint8_t *out,
+    const size_t outlen);
+
+using std::map;
+using std::string;
+using std::unique_ptr;
+using std::vector;
+
+namespace dsnet {
+
+static const size_t IDENTIFIER_LENGTH_MAX = 7; // SignedAdapter's field - \0
+
+static const unsigned char STEVE_SECKEY[] = {
+    0x53, 0x74, 0x65, 0x76, 0x65, 0x00, 0x00, 0x00, // print "Steve" as C string
+    0x00, 0x11, 0x22, 0x33, 0x44, 0x55, 0x66, 0x77, 0x88, 0x99, 0xaa, 0xbb,
+    0xcc, 0xdd, 0xee, 0xff, 0x01, 0x23, 0x45, 0x67, 0x89, 0xab, 0xcd, 0xef,
+};
+
+static __thread secp256k1_context *PROTO_CTX_SIGN = nullptr,
+                                  *PROTO_CTX_VERIFY = nullptr;
+
+static void InitSecp256k1Contexts() {
+    if (PROTO_CTX_SIGN != nullptr) {
+        return;
+    }
+    PROTO_CTX_SIGN = secp256k1_context_create(SECP256K1_CONTEXT_SIGN);
+    PROTO_CTX_VERIFY = secp256k1_context_create(SECP256K1_CONTEXT_VERIFY);
+}
+
+// Identity of a signature scheme, which only verifies once it has no secret
+class SignatureIdentity : public Identity {
+public:
+    // drop the secret and keep the public key
+    virtual void ForgetSecret() = 0;
+    // raw public key
+    virtual string PublicKey() const = 0;
+};
+
+class Secp256k1Identity : public SignatureIdentity {
+public:
+    // key is the 32-byte private key, or the 33- or 65-byte serialized
+    // public key if is_public
+    Secp256k1Identity(const string &key, bool is_public) {
+        InitSecp256k1Contexts();
+        if (is_public) {
+            if (!secp256k1_ec_pubkey_parse(
+                    PROTO_CTX_VERIFY, &pubkey,
+                    (const unsigned char *)key.data(), key.size())) {
+                Panic("Invalid secp256k1 public key");
+            }
+            return;
+        }
+        if (key.size() != 32) {
+            Panic("secp256k1 secret must be 32 bytes");
+        }
+        seckey = key;
+        if (!secp256k1_ec_pubkey_create(
+                PROTO_CTX_SIGN, &pubkey,
+                (const unsigned char *)seckey.data())) {
+            Panic("Invalid secp256k1 secret");
+        }
+    }
+    ~Secp256k1Identity() { ForgetSecret(); }
+
+    size_t AuthSize() const override { return 64; }
+
+    void Sign(const unsigned char *digest, unsigned char *auth) const override {
+        if (seckey.empty()) {
+            Panic("No secp256k1 secret to sign with");
+        }
+        InitSecp256k1Contexts();
+        secp256k1_ecdsa_signature sig;
+        int code = secp256k1_ecdsa_sign(
+            PROTO_CTX_SIGN, &sig, digest, (const unsigned char *)seckey.data(),
+            nullptr, nullptr);
+        ASSERT(code);
+        code = secp256k1_ecdsa_signature_serialize_compact(
+            PROTO_CTX_SIGN, auth, &sig);
+        ASSERT(code);
+    }
+
+    bool Verify(
+        const unsigned char *digest, const unsigned char *auth,
+        const string &verifier) const override {
+        InitSecp256k1Contexts();
+        secp256k1_ecdsa_signature sig;
+        if (!secp256k1_ecdsa_signature_parse_compact(
+                PROTO_CTX_VERIFY, &sig, auth)) {
+            return false;
+        }
+        return secp256k1_ecdsa_verify(PROTO_CTX_VERIFY, &sig, digest, &pubkey) ==
+               1;
+    }
+
+    void ForgetSecret() override {
+        OPENSSL_cleanse(&seckey[0], seckey.size());
+        seckey.clear();
+    }
+
+    string PublicKey() const override {
+        InitSecp256k1Contexts();
+        unsigned char buf[33];
+        size_t len = sizeof(buf);
+        secp256k1_ec_pubkey_serialize(
+            PROTO_CTX_VERIFY, buf, &len, &pubkey, SECP256K1_EC_COMPRESSED);
+        return string((const char *)buf, len);
+    }
+
+private:
+    string seckey; // empty if public only
+    secp256k1_pubkey pubkey;
+};
+
+class Ed25519Identity : public SignatureIdentity {
+public:
+    // key is the 32-byte private key, or the 32-byte public key if is_public
+    Ed25519Identity(const string &key, bool is_public) : is_public(is_public) {
+        if (key.size() != 32) {
+            Panic(
+                "ed25519 %s must be 32 bytes",
+                is_public ? "public key" : "secret");
+        }
+        pkey = is_public ? EVP_PKEY_new_raw_public_key(
+                               EVP_PKEY_ED25519, nullptr,
+                               (const unsigned char *)key.data(), key.size())
+                         : EVP_PKEY_new_raw_private_key(
+                               EVP_PKEY_ED25519, nullptr,
+                               (const unsigned char *)key.data(), key.size());
+        if (pkey == nullptr) {
+            Panic("Invalid ed25519 %s", is_public ? "public key" : "secret");
+        }
+    }
+    ~Ed25519Identity() { EVP_PKEY_free(pkey); }
+
+    size_t AuthSize() const override { return 64; }
+
+    void Sign(const unsigned char *digest, unsigned char *auth) const override {
+        if (is_public) {
+            Panic("No ed25519 secret to sign with");
+        }
+        EVP_MD_CTX *ctx = Context();
+        size_t sig_len = 64;
+        int code = EVP_DigestSignInit(ctx, nullptr, nullptr, nullptr, pkey) &&
+                   EVP_DigestSign(ctx, auth, &sig_len, digest,
+                                  SHA256_DIGEST_LENGTH);
+        if (!code) {
+            Panic("Failed to sign with ed25519");
+        }
+    }
+
+    bool Verify(
+        const unsigned char *digest, const unsigned char *auth,
+        const string &verifier) const override {
+        EVP_MD_CTX *ctx = Context();
+        return EVP_DigestVerifyInit(ctx, nullptr, nullptr, nullptr, pkey) &&
+               EVP_DigestVerify(ctx, auth, 64, digest, SHA256_DIGEST_LENGTH) ==
+                   1;
+    }
+
+    void ForgetSecret() override {
+        if (is_public) {
+            return;
+        }
+        string key = PublicKey();
+        EVP_PKEY_free(pkey);
+        pkey = EVP_PKEY_new_raw_public_key(
+            EVP_PKEY_ED25519, nullptr, (const unsigned char *)key.data(),
+            key.size());
+        ASSERT(pkey != nullptr);
+        is_public = true;
+    }
+
+    string PublicKey() const override {
+        unsigned char buf[32];
+        size_t len = sizeof(buf);
+        if (!EVP_PKEY_get_raw_public_key(pkey, buf, &len)) {
+            Panic("Failed to get ed25519 public key");
+        }
+        return string((const char *)buf, len);
+    }
+
+private:
+    EVP_PKEY *pkey;
+    bool is_public;
+
+    static EVP_MD_CTX *Context() {
+        static __thread EVP_MD_CTX *ctx = nullptr;
+        if (ctx == nullptr) {
+            ctx = EVP_MD_CTX_new();
+        }
+        EVP_MD_CTX_reset(ctx);
+        return ctx;
+    }
+};
+
+// one MAC per receiver, in the order of macgroup, each with the key of the
+// (owner, receiver) pair, see KeyRegistry
+class MACVectorIdentity : public Identity {
+public:
+    // empty secret if unknown to this node
+    MACVectorIdentity(const string &secret, size_t key_size, size_t mac_size)
+        : secret(secret), key_size(key_size), mac_size(mac_size) {}
+
+    size_t AuthSize() const override { return mac_size * receivers.size(); }
+
+    void Sign(const unsigned char *digest, unsigned char *auth) const override {
+        for (size_t i = 0; i < receivers.size(); i += 1) {
+            if (keys[i].empty()) {
+                Panic("No MAC key to receiver %s", receivers[i].c_str());
+            }
+            Compute(keys[i], digest, auth + i * mac_size);
+        }
+    }
+
+    bool Verify(
+        const unsigned char *digest, const unsigned char *auth,
+        const string &verifier) const override {
+        for (size_t i = 0; i < receivers.size(); i += 1) {
+            if (receivers[i] == verifier) {
+                if (keys[i].empty()) {
+                    return false;
+                }
+                unsigned char mac[EVP_MAX_MD_SIZE];
+                Compute(keys[i], digest, mac);
+                return CRYPTO_memcmp(mac, auth + i * mac_size, mac_size) == 0;
+            }
+        }
+        return false;
+    }
+
+    const string &Secret() const { return secret; }
+    size_t KeySize() const { return key_size; }
+    // one key per receiver, empty if this node does not share one with it
+    void SetKeys(const vector<string> &receivers, const vector<string> &keys) {
+        ASSERT(receivers.size() == keys.size());
+        this->receivers = receivers;
+        this->keys = keys;
+    }
+
+protected:
+    virtual void Compute(
+        const string &key, const unsigned char *digest,
+        unsigned char *mac) const = 0;
+
+private:
+    string secret;
+    size_t key_size, mac_size;
+    vector<string> receivers, keys;
+};
+
+class HMACSHA256Identity : public MACVectorIdentity {
+public:
+    explicit HMACSHA256Identity(const string &secret)
+        : MACVectorIdentity(secret, SHA256_DIGEST_LENGTH, SHA256_DIGEST_LENGTH) {
+    }
+
+protected:
+    void Compute(
+        const string &key, const unsigned char *digest,
+        unsigned char *mac) const override {
+        HMAC(
+            EVP_sha256(), key.data(), key.size(), digest, SHA256_DIGEST_LENGTH,
+            mac, nullptr);
+    }
+};
+
+// the 32-bit output variant tombft's switch computes
+class HalfSipHashIdentity : public MACVectorIdentity {
+public:
+    explicit HalfSipHashIdentity(const string &secret)
+        : MACVectorIdentity(secret, 8, 4) {}
+
+protected:
+    void Compute(
+        const string &key, const unsigned char *digest,
+        unsigned char *mac) const override {
+        halfsiphash(digest, SHA256_DIGEST_LENGTH, key.data(), mac, 4);
+    }
+};
+
+static map<string, unique_ptr<Identity>> &Identities() {
+    static map<string, unique_ptr<Identity>> identities = [] {
+        map<string, unique_ptr<Identity>> identities;
+        identities["Steve"].reset(new Secp256k1Identity(
+            string((const char *)STEVE_SECKEY, sizeof(STEVE_SECKEY)), false));
+        return identities;
+    }();
+    return identities;
+}
+
+// identifier -> decoded secret, from 'multisig' keys
+static map<string, string> &MultiSigSecrets() {
+    static map<string, string> secrets;
+    return secrets;
+}
+
+static vector<string> &MACGroup() {
+    static vector<string> macgroup;
+    return macgroup;
+}
+
+// (sender, receiver) -> decoded key, from 'mackey' lines
+static map<std::pair<string, string>, string> &MACKeys() {
+    static map<std::pair<string, string>, string> mackeys;
+    return mackeys;
+}
+
+static string DecodeHex(const string &hex) {
+    if (hex.size() % 2 != 0) {
+        Panic("Key secret %s has odd length", hex.c_str());
+    }
+    string bytes;
+    for (size_t i = 0; i < hex.size(); i += 2) {
+        char *end;
+        string byte = hex.substr(i, 2);
+        bytes.push_back((char)strtoul(byte.c_str(), &end, 16));
+        if (*end != '\0') {
+            Panic("Key secret %s is not hex encoded", hex.c_str());
+        }
+    }
+    return bytes;
+}
+
+static MACVectorIdentity *FindMACVector(const string &identifier) {
+    auto iter = Identities().find(identifier);
+    if (iter == Identities().end()) {
+        return nullptr;
+    }
+    return dynamic_cast<MACVectorIdentity *>(iter->second.get());
+}
+
+// the key of every MAC vector entry is either configured for its pair, or
+// derived from the secrets of both parties if this node knows them
+static void UpdateMACKeys() {
+    for (auto &entry : Identities()) {
+        auto sender = dynamic_cast<MACVectorIdentity *>(entry.second.get());
+        if (sender == nullptr) {
+            continue;
+        }
+        vector<string> keys;
+        for (const string &receiver : MACGroup()) {
+            auto iter = MACKeys().find({entry.first, receiver});
+            if (iter != MACKeys().end()) {
+                if (iter->second.size() != sender->KeySize()) {
+                    Panic(
+                        "MAC key from %s to %s must be %lu bytes",
+                        entry.first.c_str(), receiver.c_str(),
+                        sender->KeySize());
+                }
+                keys.push_back(iter->second);
+                continue;
+            }
+            const MACVectorIdentity *peer = FindMACVector(receiver);
+            if (sender->Secret().empty() || peer == nullptr ||
+                peer->Secret().empty()) {
+                keys.emplace_back();
+                continue;
+            }
+            unsigned char key[EVP_MAX_MD_SIZE];
+            HMAC(
+                EVP_sha256(), sender->Secret().data(), sender->Secret().size(),
+                (const unsigned char *)peer->Secret().data(),
+                peer->Secret().size(), key, nullptr);
+            keys.emplace_back((const char *)key, sender->KeySize());
+        }
+        sender->SetKeys(MACGroup(), keys);
+    }
+}
+
+void KeyRegistry::Load(const Configuration &config, const string &self) {
+    for (const KeyConfig &key : config.keys()) {
+        Add(key.identifier, key.scheme, key.secret);
+        if (key.identifier == self) {
+            continue;
+        }
+        auto identity = dynamic_cast<SignatureIdentity *>(
+            Identities()[key.identifier].get());
+        if (identity != nullptr) {
+            identity->ForgetSecret();
+        }
+    }
+    for (const MACKeyConfig &key : config.mackeys()) {
+        AddMACKey(key.sender, key.receiver, key.secret);
+    }
+    SetMACGroup(config.macgroup());
+}
+
+void KeyRegistry::Add(
+    const string &identifier, const string &scheme, const string &secret) {
+    if (identifier.empty() || identifier.size() > IDENTIFIER_LENGTH_MAX ||
+        identifier == "Alex") {
+        Panic("Invalid key identifier: %s", identifier.c_str());
+    }
+
+    const string public_prefix = "pub:";
+    if (secret.compare(0, public_prefix.size(), public_prefix) == 0) {
+        string bytes = DecodeHex(secret.substr(public_prefix.size()));
+        if (scheme == "secp256k1") {
+            Identities()[identifier].reset(new Secp256k1Identity(bytes, true));
+        } else if (scheme == "ed25519") {
+            Identities()[identifier].reset(new Ed25519Identity(bytes, true));
+        } else {
+            Panic("Key scheme %s has no public key", scheme.c_str());
+        }
+        return;
+    }
+    // only MAC vectors may leave the secret out, see AddMACKey
+    string bytes = secret == "-" ? "" : DecodeHex(secret);
+    if (bytes.empty() && scheme != "hmac-sha256" && scheme != "halfsiphash") {
+        Panic("Key %s requires a secret", identifier.c_str());
+    }
+    if (scheme == "multisig") {
+        if (bytes.size() != 32) {
+            Panic("multisig secret must be 32 bytes");
+        }
+        MultiSigSecrets()[identifier] = bytes;
+        return;
+    }
+    Identity *identity;
+    if (scheme == "secp256k1") {
+        identity = new Secp256k1Identity(bytes, false);
+    } else if (scheme == "ed25519") {
+        identity = new Ed25519Identity(bytes, false);
+    } else if (scheme == "hmac-sha256") {
+        identity = new HMACSHA256Identity(bytes);
+    } else if (scheme == "halfsiphash") {
+        identity = new HalfSipHashIdentity(bytes);
+    } else {
+        Panic("Unknown key scheme: %s", scheme.c_str());
+    }
+    Identities()[identifier].reset(identity);
+    UpdateMACKeys();
+}
+
+void KeyRegistry::AddMACKey(
+    const string &sender, const string &receiver, const string &secret) {
+    MACKeys()[{sender, receiver}] = DecodeHex(secret);
+    UpdateMACKeys();
+}
+
+void KeyRegistry::SetMACGroup(const vector<string> &macgroup) {
+    MACGroup() = macgroup;
+    UpdateMACKeys();
+}
+
+const Identity *KeyRegistry::Find(const string &identifier) {
+    const auto &identities = Identities();
+    auto iter = identities.find(identifier);
+    if (iter == identities.end()) {
+        return nullptr;
+    }
+    return iter->second.get();
+}
+
+string KeyRegistry::PublicKey(const string &identifier) {
+    auto identity = dynamic_cast<const SignatureIdentity *>(Find(identifier));
+    if (identity == nullptr) {
+        return "";
+    }
+    static const char digits[] = "0123456789abcdef";
+    string hex;
+    for (unsigned char byte : identity->PublicKey()) {
+        hex.push_back(digits[byte >> 4]);
+        hex.push_back(digits[byte & 0xf]);
+    }
+    return hex;
+}
+
+const string *KeyRegistry::FindMultiSig(const string &identifier) {
+    const auto &secrets = MultiSigSecrets();
+    auto iter = secrets.find(identifier);
+    if (iter == secrets.end()) {
+        return nullptr;
+    }
+    return &iter->second;
+}
+
+} // namespace dsnet
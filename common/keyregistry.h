@@ -0,0 +1,76 @@
+#pragma once
+#include "lib/configuration.h"
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+namespace dsnet {
+
+// Authenticator of messages made by one identifier, i.e. the key material of
+// the identifier plus the scheme it uses. Sign() and Verify() work on the
+// SHA256 digest of the message, and are safe to call from any thread.
+class Identity {
+public:
+    virtual ~Identity() {}
+    // bytes of authenticator following the identifier in a SignedAdapter
+    virtual size_t AuthSize() const = 0;
+    virtual void Sign(const unsigned char *digest, unsigned char *auth) const = 0;
+    // verifier is the identifier of receiver, only matters for MAC vectors
+    virtual bool Verify(
+        const unsigned char *digest, const unsigned char *auth,
+        const std::string &verifier) const = 0;
+};
+
+// Process-wide table from identifier to Identity, consulted by SignedAdapter.
+// Supported schemes:
+// * secp256k1: ECDSA signature, secret is the 32-byte private key, or
+// "pub:" followed by the 33- or 65-byte serialized public key
+// * ed25519: EdDSA signature, secret is the 32-byte private key, or "pub:"
+// followed by the 32-byte public key
+// An identity of these schemes that is given only its public key verifies
+// and panics on signing, which is how a node learns the keys of its peers.
+// * hmac-sha256, halfsiphash: vector of MACs, one entry per receiver in
+// macgroup, each computed with the key shared by the sender S and that
+// receiver R only, so R cannot forge the entries of other receivers. The key
+// is the 'mackey' of (S, R) if configured, otherwise it is derived as
+// HMAC-SHA256(secret of S, secret of R) when both are MAC identities whose
+// secrets this node knows. Deriving only keeps the key private when the
+// secrets are, so a deployment that does not share one configuration file
+// among all nodes gives each node its pairwise 'mackey' lines instead and
+// writes the secret of others as "-". Signing without the key of some
+// receiver panics, and verifying without it fails.
+// * multisig: the 32-byte secret scalar of common/multisig, which is kept
+// apart from the Identity of the identifier and only returned by FindMultiSig
+//
+// The registry always contains "Steve", a secp256k1 identity with a built-in
+// test key. Populate it before any message is signed or verified, because
+// lookups do not lock.
+class KeyRegistry {
+public:
+    // add every 'key' and 'mackey' of config and take its macgroup, keeping
+    // the signature secret of identifier self only, so the node can sign as
+    // nobody else even if the configuration lists more secrets
+    static void Load(const Configuration &config, const std::string &self);
+    // secret is hex encoded, "pub:" and the hex public key of a signature
+    // scheme, or "-" for MAC vectors of unknown secret, panic on unknown
+    // scheme or malformed secret
+    static void Add(
+        const std::string &identifier, const std::string &scheme,
+        const std::string &secret);
+    // key of the MAC entry from sender to receiver, hex encoded and of the
+    // key size of the sender's scheme
+    static void AddMACKey(
+        const std::string &sender, const std::string &receiver,
+        const std::string &secret);
+    static void SetMACGroup(const std::vector<std::string> &macgroup);
+    // nullptr for unknown identifier
+    static const Identity *Find(const std::string &identifier);
+    // hex public key of a signature identity, empty for other identifiers,
+    // to write the 'key identifier scheme pub:hex' line of peers
+    static std::string PublicKey(const std::string &identifier);
+    // the 'multisig' secret of identifier, nullptr if it has none
+    static const std::string *FindMultiSig(const std::string &identifier);
+};
+
+} // namespace dsnet
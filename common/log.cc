@@ -140,6 +140,31 @@ Log::RemoveAfter(opnum_t op)
     ASSERT(LastOpnum() == op-1);
 }
 
+void
+Log::RemoveBefore(opnum_t op)
+{
+    if (op <= start) {
+        return;
+    }
+    ASSERT(op <= LastOpnum()+1);
+
+    Debug("Removing log entries before " FMT_OPNUM, op);
+
+    initialHash = entries[op-start-1]->hash;
+    entries.erase(entries.begin(), entries.begin() + (op-start));
+    start = op;
+}
+
+void
+Log::Reset(opnum_t op, const string &hash)
+{
+    Debug("Resetting log to start at " FMT_OPNUM, op);
+
+    entries.clear();
+    initialHash = hash;
+    start = op;
+}
+
 LogEntry *
 Log::Last()
 {
@@ -208,8 +233,10 @@ Log::ComputeHash(string lastHash, const LogEntry *entry)
     x[0] = entry->request.clientid();
     x[1] = entry->request.clientreqid();
     SHA1_Update(&ctx, x, sizeof(uint64_t)*2);
-    // SHA1_Update(&ctx, entry.request.op().c_str(),
-    //             entry.request.op().size());
+    // the op as well, digests of PBFT certificates are checked against the
+    // entries shipped by state transfer
+    SHA1_Update(&ctx, entry->request.op().c_str(),
+                entry->request.op().size());
 
     SHA1_Final(out, &ctx);
 
@@ -110,6 +110,12 @@ public:
     bool
     SetRequest(opnum_t op, const Request &req, const string &signature = "");
     void RemoveAfter(opnum_t opnum);
+    // garbage collect entries before opnum, e.g. below a stable checkpoint;
+    // the hash chain continues from the last removed entry
+    void RemoveBefore(opnum_t opnum);
+    // drop every entry and continue the log at opnum, with `hash` as the
+    // hash of opnum - 1, e.g. after installing a checkpoint by state transfer
+    void Reset(opnum_t opnum, const string &hash);
     LogEntry *Last();
     viewstamp_t LastViewstamp() const; // deprecated
     opnum_t LastOpnum() const;
@@ -0,0 +1,362 @@
+#include "common/multisig.h"
+#include "lib/message.h"
+
+#include <memory>
+#include <openssl/bn.h>
+#include <openssl/ec.h>
+#include <openssl/obj_mac.h>
+#include <openssl/sha.h>
+
+using std::string;
+using std::vector;
+
+namespace dsnet {
+
+const size_t MultiSigGroup::NONCE_SIZE;
+const size_t MultiSigGroup::PARTIAL_SIZE;
+const size_t MultiSigGroup::SIGNATURE_SIZE;
+const int MultiSigGroup::N_SIGNER_MAX;
+
+static const size_t POINT_SIZE = 33, SCALAR_SIZE = 32;
+
+static const EC_GROUP *Curve() {
+    static const EC_GROUP *curve = EC_GROUP_new_by_curve_name(NID_X9_62_prime256v1);
+    return curve;
+}
+
+static const BIGNUM *Order() { return EC_GROUP_get0_order(Curve()); }
+
+static BN_CTX *Context() {
+    static __thread BN_CTX *ctx = nullptr;
+    if (ctx == nullptr) {
+        ctx = BN_CTX_new();
+    }
+    return ctx;
+}
+
+struct ScalarDeleter {
+    void operator()(BIGNUM *scalar) const { BN_clear_free(scalar); }
+};
+struct PointDeleter {
+    void operator()(EC_POINT *point) const { EC_POINT_free(point); }
+};
+using Scalar = std::unique_ptr<BIGNUM, ScalarDeleter>;
+using Point = std::unique_ptr<EC_POINT, PointDeleter>;
+
+static Scalar NewScalar() { return Scalar(BN_new()); }
+static Point NewPoint() { return Point(EC_POINT_new(Curve())); }
+
+// nullptr if not a canonical scalar
+static Scalar DecodeScalar(const char *data) {
+    Scalar scalar = NewScalar();
+    BN_bin2bn((const unsigned char *)data, SCALAR_SIZE, scalar.get());
+    if (BN_cmp(scalar.get(), Order()) >= 0) {
+        return nullptr;
+    }
+    return scalar;
+}
+
+static string EncodeScalar(const BIGNUM *scalar) {
+    string data(SCALAR_SIZE, '\0');
+    BN_bn2binpad(scalar, (unsigned char *)&data.front(), SCALAR_SIZE);
+    return data;
+}
+
+// nullptr if not on curve
+static Point DecodePoint(const char *data) {
+    Point point = NewPoint();
+    if (!EC_POINT_oct2point(
+            Curve(), point.get(), (const unsigned char *)data, POINT_SIZE,
+            Context())) {
+        return nullptr;
+    }
+    return point;
+}
+
+// empty for the point at infinity, which only comes out of sums that an
+// adversary arranges, and is rejected as a malformed input then
+static string EncodePoint(const EC_POINT *point) {
+    string data(POINT_SIZE, '\0');
+    if (EC_POINT_point2oct(
+            Curve(), point, POINT_CONVERSION_COMPRESSED,
+            (unsigned char *)&data.front(), POINT_SIZE,
+            Context()) != POINT_SIZE) {
+        return "";
+    }
+    return data;
+}
+
+static Scalar HashToScalar(const char *tag, const string &data) {
+    string buffer(tag);
+    buffer.push_back('\0');
+    buffer += data;
+    unsigned char digest[SHA256_DIGEST_LENGTH];
+    SHA256((const unsigned char *)buffer.data(), buffer.size(), digest);
+    Scalar scalar = NewScalar();
+    BN_bin2bn(digest, sizeof(digest), scalar.get());
+    BN_nnmod(scalar.get(), scalar.get(), Order(), Context());
+    return scalar;
+}
+
+// public keys of the set back to back, empty if the set has unknown signers
+static string KeyList(const vector<string> &public_keys, uint64_t signers) {
+    if (signers == 0 ||
+        (public_keys.size() < 64 && signers >> public_keys.size() != 0)) {
+        return "";
+    }
+    string key_list;
+    for (size_t i = 0; i < public_keys.size(); i += 1) {
+        if (signers >> i & 1) {
+            key_list += public_keys[i];
+        }
+    }
+    return key_list;
+}
+
+static Scalar KeyCoefficient(const string &key_list, const string &key) {
+    return HashToScalar("MultiSig key coefficient", key_list + key);
+}
+
+// R = R1 + b * R2 of the aggregated nonce (R1, R2), where b binds the nonce
+// to the key and the message, so the nonces can be committed before the
+// message is known
+static string FinalNonce(
+    const string &aggregate_key, const string &aggregate_nonce,
+    const string &message, Scalar &b) {
+    Point r1 = DecodePoint(aggregate_nonce.data()),
+          r2 = DecodePoint(aggregate_nonce.data() + POINT_SIZE);
+    if (!r1 || !r2) {
+        return "";
+    }
+    b = HashToScalar(
+        "MultiSig nonce coefficient",
+        aggregate_key + aggregate_nonce + message);
+    Point r = NewPoint();
+    EC_POINT_mul(Curve(), r.get(), nullptr, r2.get(), b.get(), Context());
+    EC_POINT_add(Curve(), r.get(), r.get(), r1.get(), Context());
+    return EncodePoint(r.get());
+}
+
+static Scalar Challenge(
+    const string &aggregate_key, const string &final_nonce,
+    const string &message) {
+    return HashToScalar(
+        "MultiSig challenge", aggregate_key + final_nonce + message);
+}
+
+MultiSigGroup::MultiSigGroup(const vector<string> &public_keys)
+    : public_keys(public_keys) {
+    if (public_keys.size() > N_SIGNER_MAX) {
+        Panic("Too many multi-signature signers: %lu", public_keys.size());
+    }
+    for (const string &key : public_keys) {
+        if (key.size() != POINT_SIZE || !DecodePoint(key.data())) {
+            Panic("Malformed multi-signature public key");
+        }
+    }
+}
+
+string MultiSigGroup::PublicKey(const string &secret) {
+    if (secret.size() != SCALAR_SIZE) {
+        return "";
+    }
+    Scalar x = DecodeScalar(secret.data());
+    if (!x || BN_is_zero(x.get())) {
+        return "";
+    }
+    Point key = NewPoint();
+    EC_POINT_mul(Curve(), key.get(), x.get(), nullptr, nullptr, Context());
+    return EncodePoint(key.get());
+}
+
+string MultiSigGroup::TestSecret(int index) {
+    return EncodeScalar(
+        HashToScalar("MultiSig test key", std::to_string(index)).get());
+}
+
+string MultiSigGroup::AggregateKey(uint64_t signers) const {
+    {
+        std::lock_guard<std::mutex> lock(key_mutex);
+        auto iter = aggregate_keys.find(signers);
+        if (iter != aggregate_keys.end()) {
+            return iter->second;
+        }
+    }
+
+    string key_list = KeyList(public_keys, signers);
+    if (key_list.empty()) {
+        return "";
+    }
+    Point sum = NewPoint(), term = NewPoint();
+    EC_POINT_set_to_infinity(Curve(), sum.get());
+    for (size_t offset = 0; offset < key_list.size(); offset += POINT_SIZE) {
+        string key = key_list.substr(offset, POINT_SIZE);
+        EC_POINT_mul(
+            Curve(), term.get(), nullptr, DecodePoint(key.data()).get(),
+            KeyCoefficient(key_list, key).get(), Context());
+        EC_POINT_add(Curve(), sum.get(), sum.get(), term.get(), Context());
+    }
+    string aggregate_key = EncodePoint(sum.get());
+
+    std::lock_guard<std::mutex> lock(key_mutex);
+    aggregate_keys[signers] = aggregate_key;
+    return aggregate_key;
+}
+
+string MultiSigGroup::AggregateNonce(const vector<string> &nonces) {
+    Point sum[2] = {NewPoint(), NewPoint()};
+    for (Point &point : sum) {
+        EC_POINT_set_to_infinity(Curve(), point.get());
+    }
+    for (const string &nonce : nonces) {
+        if (nonce.size() != NONCE_SIZE) {
+            return "";
+        }
+        for (int i = 0; i < 2; i += 1) {
+            Point point = DecodePoint(nonce.data() + i * POINT_SIZE);
+            if (!point) {
+                return "";
+            }
+            EC_POINT_add(
+                Curve(), sum[i].get(), sum[i].get(), point.get(), Context());
+        }
+    }
+    string r1 = EncodePoint(sum[0].get()), r2 = EncodePoint(sum[1].get());
+    if (r1.empty() || r2.empty()) {
+        return "";
+    }
+    return r1 + r2;
+}
+
+string MultiSigGroup::Aggregate(
+    uint64_t signers, const string &aggregate_nonce, const string &message,
+    const vector<string> &partials) const {
+    string aggregate_key = AggregateKey(signers);
+    if (aggregate_key.empty() || aggregate_nonce.size() != NONCE_SIZE ||
+        (int)partials.size() != __builtin_popcountll(signers)) {
+        return "";
+    }
+    Scalar b;
+    string r = FinalNonce(aggregate_key, aggregate_nonce, message, b);
+    if (r.empty()) {
+        return "";
+    }
+    Scalar s = NewScalar();
+    BN_zero(s.get());
+    for (const string &partial : partials) {
+        if (partial.size() != PARTIAL_SIZE) {
+            return "";
+        }
+        Scalar s_i = DecodeScalar(partial.data());
+        if (!s_i) {
+            return "";
+        }
+        BN_mod_add(s.get(), s.get(), s_i.get(), Order(), Context());
+    }
+    return r + EncodeScalar(s.get());
+}
+
+// s * G - c * X == R
+bool MultiSigGroup::Verify(
+    uint64_t signers, const string &message, const string &signature) const {
+    if (signature.size() != SIGNATURE_SIZE) {
+        return false;
+    }
+    string aggregate_key = AggregateKey(signers);
+    if (aggregate_key.empty()) {
+        return false;
+    }
+    Point x = DecodePoint(aggregate_key.data()),
+          r = DecodePoint(signature.data());
+    Scalar s = DecodeScalar(signature.data() + POINT_SIZE);
+    if (!x || !r || !s) {
+        return false;
+    }
+    string final_nonce = signature.substr(0, POINT_SIZE);
+    Scalar neg_c = Challenge(aggregate_key, final_nonce, message);
+    BN_mod_sub(neg_c.get(), Order(), neg_c.get(), Order(), Context());
+    Point expected = NewPoint();
+    EC_POINT_mul(
+        Curve(), expected.get(), s.get(), x.get(), neg_c.get(), Context());
+    return EC_POINT_cmp(Curve(), expected.get(), r.get(), Context()) == 0;
+}
+
+MultiSigner::MultiSigner(
+    const MultiSigGroup &group, int index, const string &secret)
+    : group(group), index(index), secret(secret) {
+    if (index >= group.NSigner() ||
+        MultiSigGroup::PublicKey(secret) != group.public_keys[index]) {
+        Panic("Multi-signature secret does not match key of signer %d", index);
+    }
+}
+
+string MultiSigner::Commit(uint64_t seq) {
+    string secret_nonce, public_nonce;
+    for (int i = 0; i < 2; i += 1) {
+        Scalar r = NewScalar();
+        do {
+            BN_rand_range(r.get(), Order());
+        } while (BN_is_zero(r.get()));
+        Point point = NewPoint();
+        EC_POINT_mul(
+            Curve(), point.get(), r.get(), nullptr, nullptr, Context());
+        secret_nonce += EncodeScalar(r.get());
+        public_nonce += EncodePoint(point.get());
+    }
+
+    std::lock_guard<std::mutex> lock(nonce_mutex);
+    secret_nonces[seq] = secret_nonce;
+    return public_nonce;
+}
+
+void MultiSigner::Forget(uint64_t seq) {
+    std::lock_guard<std::mutex> lock(nonce_mutex);
+    secret_nonces.erase(secret_nonces.begin(), secret_nonces.lower_bound(seq));
+}
+
+// s_i = r1 + b * r2 + c * a_i * x_i
+bool MultiSigner::Sign(
+    uint64_t seq, uint64_t signers, const string &aggregate_nonce,
+    const string &message, string &partial) {
+    string secret_nonce;
+    {
+        std::lock_guard<std::mutex> lock(nonce_mutex);
+        auto iter = secret_nonces.find(seq);
+        if (iter == secret_nonces.end()) {
+            return false;
+        }
+        secret_nonce = std::move(iter->second);
+        secret_nonces.erase(iter);
+    }
+
+    if (!(signers >> index & 1) ||
+        aggregate_nonce.size() != MultiSigGroup::NONCE_SIZE) {
+        return false;
+    }
+    string aggregate_key = group.AggregateKey(signers);
+    if (aggregate_key.empty()) {
+        return false;
+    }
+    Scalar b;
+    string r = FinalNonce(aggregate_key, aggregate_nonce, message, b);
+    if (r.empty()) {
+        return false;
+    }
+    Scalar c = Challenge(aggregate_key, r, message);
+    Scalar a = KeyCoefficient(
+        KeyList(group.public_keys, signers), group.public_keys[index]);
+
+    Scalar r1 = DecodeScalar(secret_nonce.data()),
+           r2 = DecodeScalar(secret_nonce.data() + SCALAR_SIZE),
+           x = DecodeScalar(secret.data());
+    Scalar s = NewScalar();
+    BN_mod_mul(s.get(), c.get(), a.get(), Order(), Context());
+    BN_mod_mul(s.get(), s.get(), x.get(), Order(), Context());
+    BN_mod_mul(b.get(), b.get(), r2.get(), Order(), Context());
+    BN_mod_add(s.get(), s.get(), b.get(), Order(), Context());
+    BN_mod_add(s.get(), s.get(), r1.get(), Order(), Context());
+    partial = EncodeScalar(s.get());
+    return true;
+}
+
+} // namespace dsnet
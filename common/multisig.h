@@ -0,0 +1,97 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace dsnet {
+
+// Schnorr multi-signature over NIST P-256, after MuSig2. A set of signers
+// produce one SIGNATURE_SIZE signature on the same message, which verifies
+// with one double scalar multiplication no matter how many signers are in
+// the set, e.g. for the QCs of HotStuff.
+//
+// Signing takes one round, because the nonces are committed ahead of the
+// message: each signer publishes public nonces tagged with increasing
+// sequence numbers, the aggregator picks one published nonce of every signer
+// in the set and sums them up with `AggregateNonce`, and every signer signs
+// with the aggregated nonce. A secret nonce is forgotten as soon as it is
+// used, so it is never used twice.
+//
+// Signers are identified by index and a set of signers is a bitmap, so there
+// are at most 64 of them. The secret of a signer is a 32-byte scalar, e.g. the
+// 'multisig' key of KeyRegistry, and TestSecret derives public ones from the
+// index for tests, like the built-in "Steve" identity. Implemented with
+// OpenSSL. Thread safe.
+class MultiSigGroup {
+public:
+    static const size_t NONCE_SIZE = 66;     // two compressed points
+    static const size_t PARTIAL_SIZE = 32;   // scalar
+    static const size_t SIGNATURE_SIZE = 65; // compressed point + scalar
+    static const int N_SIGNER_MAX = 64;
+
+    // compressed public keys in the order of signer index, panic if any is
+    // malformed
+    explicit MultiSigGroup(const std::vector<std::string> &public_keys);
+
+    // public key of a secret, empty if it is not a valid scalar
+    static std::string PublicKey(const std::string &secret);
+    // a well-known secret of signer `index`, for tests only
+    static std::string TestSecret(int index);
+
+    int NSigner() const { return public_keys.size(); }
+
+    // sum of public nonces, one of every signer of the set; empty if any of
+    // them is malformed
+    static std::string AggregateNonce(const std::vector<std::string> &nonces);
+    // partials of the set in the order of signer index; empty on malformed
+    // input, the result is not verified
+    std::string Aggregate(
+        uint64_t signers, const std::string &aggregate_nonce,
+        const std::string &message,
+        const std::vector<std::string> &partials) const;
+    bool Verify(
+        uint64_t signers, const std::string &message,
+        const std::string &signature) const;
+
+private:
+    friend class MultiSigner;
+    std::vector<std::string> public_keys;
+    // signers -> aggregated public key, computed once per signer set
+    mutable std::mutex key_mutex;
+    mutable std::map<uint64_t, std::string> aggregate_keys;
+
+    // compressed point of the set's aggregated key, empty if the set has
+    // unknown signers
+    std::string AggregateKey(uint64_t signers) const;
+};
+
+class MultiSigner {
+public:
+    // panic if `secret` is not the one of the group's key of `index`
+    MultiSigner(
+        const MultiSigGroup &group, int index, const std::string &secret);
+
+    // a fresh public nonce for `seq`, which must not be committed before
+    std::string Commit(uint64_t seq);
+    // drop the nonces committed before `seq`, e.g. never picked by the
+    // aggregator
+    void Forget(uint64_t seq);
+    // sign with the nonce committed for `seq` as part of `signers`, false if
+    // it is not committed or used up already
+    bool Sign(
+        uint64_t seq, uint64_t signers, const std::string &aggregate_nonce,
+        const std::string &message, std::string &partial);
+
+private:
+    const MultiSigGroup &group;
+    int index;
+    std::string secret;
+    std::mutex nonce_mutex;
+    // seq -> the two secret scalars, back to back
+    std::map<uint64_t, std::string> secret_nonces;
+};
+
+} // namespace dsnet
@@ -0,0 +1,33 @@
+#include "common/parker.h"
+
+#include <climits>
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+namespace dsnet {
+
+// long enough to cover back-to-back packets of a loaded replica
+static std::atomic<int64_t> spin_budget_ns(100 * 1000);
+
+void Parker::SetSpinBudget(int64_t budget_ns) { spin_budget_ns = budget_ns; }
+
+int64_t Parker::SpinBudget() {
+    return spin_budget_ns.load(std::memory_order_relaxed);
+}
+
+// std::atomic<uint32_t> is a plain uint32_t in memory on every platform we
+// build for
+void Parker::FutexWait(uint32_t seen) {
+    syscall(
+        SYS_futex, reinterpret_cast<uint32_t *>(&word), FUTEX_WAIT_PRIVATE,
+        seen, nullptr, nullptr, 0);
+}
+
+void Parker::FutexWake() {
+    syscall(
+        SYS_futex, reinterpret_cast<uint32_t *>(&word), FUTEX_WAKE_PRIVATE,
+        INT_MAX, nullptr, nullptr, 0);
+}
+
+} // namespace dsnet
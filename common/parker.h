@@ -0,0 +1,98 @@
+#pragma once
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <sched.h>
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#endif
+
+namespace dsnet {
+
+// Spin-then-park waiting of runner threads. Wait() polls the condition with
+// `pause` for the spin budget, backs off with sched_yield for as long again,
+// then sleeps on a futex until another thread calls Wake(). So a busy runner
+// keeps the latency of busy spinning, and an idle one stops burning its cpus.
+//
+// The waker must make the condition true with a seq_cst atomic store (or
+// follow it with a seq_cst fence) before Wake(), which then costs one load
+// unless some thread is parked. Every Wait() on the same Parker shares the
+// wakeups, so use one Parker per waiting thread where possible.
+class Parker {
+public:
+    static const int64_t SPIN_FOREVER = -1;
+
+    Parker() : word(0), n_parked(0) {}
+
+    template <typename Ready> void Wait(Ready ready) {
+        if (ready()) {
+            return;
+        }
+        const int64_t budget = SpinBudget();
+        const auto start = std::chrono::steady_clock::now();
+        for (uint32_t i = 1;; i += 1) {
+            Pause();
+            if (ready()) {
+                return;
+            }
+            if (i % 64 == 0 && budget != SPIN_FOREVER &&
+                ElapsedNs(start) >= budget) {
+                break;
+            }
+        }
+        while (ElapsedNs(start) < 2 * budget) {
+            sched_yield();
+            if (ready()) {
+                return;
+            }
+        }
+        while (true) {
+            uint32_t seen = word.load();
+            // pairs with the load in Wake(): either the waker sees us parked,
+            // or we see the condition it made true
+            n_parked.fetch_add(1);
+            if (ready()) {
+                n_parked.fetch_sub(1);
+                return;
+            }
+            FutexWait(seen);
+            n_parked.fetch_sub(1);
+            if (ready()) {
+                return;
+            }
+        }
+    }
+
+    void Wake() {
+        if (n_parked.load() != 0) {
+            word.fetch_add(1);
+            FutexWake();
+        }
+    }
+
+    // process-wide, in nanoseconds, read at the start of every Wait();
+    // SPIN_FOREVER never parks, i.e. the old busy spinning
+    static void SetSpinBudget(int64_t budget_ns);
+    static int64_t SpinBudget();
+
+private:
+    std::atomic<uint32_t> word, n_parked;
+    // Parkers are often kept in per-thread arrays
+    char padding[64 - 2 * sizeof(std::atomic<uint32_t>)];
+
+    static void Pause() {
+#if defined(__x86_64__) || defined(__i386__)
+        _mm_pause();
+#endif
+    }
+    static int64_t
+    ElapsedNs(const std::chrono::steady_clock::time_point &start) {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(
+                   std::chrono::steady_clock::now() - start)
+            .count();
+    }
+    void FutexWait(uint32_t seen);
+    void FutexWake();
+};
+
+} // namespace dsnet
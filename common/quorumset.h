@@ -31,12 +31,15 @@
 #ifndef _COMMON_QUORUMSET_H_
 #define _COMMON_QUORUMSET_H_
 
+#include <cstdint>
 #include <map>
 #include <type_traits>
 #include <unordered_map>
 #include <unordered_set>
+#include <vector>
 
 #include "lib/assert.h"
+#include "lib/viewstamp.h"
 
 namespace dsnet {
 
@@ -47,9 +50,11 @@ class QuorumSet {
 
   void Clear() { messages.clear(); }
 
-  void Clear(IDTYPE vs) {
-    std::map<int, MSGTYPE> &vsmessages = messages[vs];
-    vsmessages.clear();
+  void Clear(IDTYPE vs) { messages.erase(vs); }
+
+  // drop the message sets of all ids below vs, e.g. after a checkpoint
+  void ClearBefore(IDTYPE vs) {
+    messages.erase(messages.begin(), messages.lower_bound(vs));
   }
 
   int NumRequired() const { return numRequired; }
@@ -95,6 +100,128 @@ class QuorumSet {
   std::map<IDTYPE, std::map<int, MSGTYPE>> messages;
 };
 
+// QuorumSet of op numbers on a hot path, e.g. one quorum per op. The ids
+// that are tracked at once fit in a window of `window` slots, slot of `opnum`
+// at `opnum % window`, and each slot keeps a bitmap of the replicas it has
+// messages from, so a quorum check is a popcount. Messages are assigned in
+// place into the slot, whose buffers are reused by later ids, so adding a
+// message allocates nothing once the window is warmed up.
+//
+// Ids outside the window are dropped, and only `ClearBefore` moves it, e.g.
+// to start at a committed op number, so a message of a far-off id cannot
+// push out the ids in progress. A caller that trusts the ids, e.g. of a
+// crash-fault protocol, moves the window itself before adding one beyond it.
+// `Clear` drops everything and lets ids start over, e.g. on view change.
+// Replica index must be below 64.
+template <class MSGTYPE>
+class QuorumWindow {
+ public:
+  static const opnum_t DEFAULT_WINDOW = 1024;
+
+  class Slot {
+   public:
+    int Count() const { return __builtin_popcountll(replicas); }
+    bool Has(int replicaIdx) const { return (replicas >> replicaIdx) & 1; }
+    const MSGTYPE &Get(int replicaIdx) const {
+      ASSERT(Has(replicaIdx));
+      return messages[replicaIdx];
+    }
+
+   private:
+    friend class QuorumWindow;
+    opnum_t opnum = 0;
+    uint64_t generation = 0;
+    uint64_t replicas = 0;
+    std::vector<MSGTYPE> messages;
+  };
+
+  QuorumWindow(int numRequired, int numReplicas,
+               opnum_t window = DEFAULT_WINDOW)
+      : numRequired(numRequired),
+        numReplicas(numReplicas),
+        slots(window),
+        base(0),
+        generation(1) {
+    ASSERT(numReplicas <= 64);
+  }
+
+  void Clear() {
+    generation += 1;
+    base = 0;
+  }
+
+  void Clear(opnum_t opnum) {
+    if (Slot *slot = Find(opnum)) {
+      slot->replicas = 0;
+    }
+  }
+
+  // drop the message sets of all ids below opnum, e.g. once it commits
+  void ClearBefore(opnum_t opnum) {
+    if (opnum > base) {
+      base = opnum;
+    }
+  }
+
+  int NumRequired() const { return numRequired; }
+  // number of ids tracked at once, starting at the one `ClearBefore` set
+  opnum_t Window() const { return slots.size(); }
+
+  // the slot stays valid until the next call that adds a message
+  const Slot *CheckForQuorum(opnum_t opnum) {
+    const Slot *slot = Find(opnum);
+    if (slot == NULL || slot->Count() < numRequired) {
+      return NULL;
+    }
+    return slot;
+  }
+
+  const Slot *AddAndCheckForQuorum(opnum_t opnum, int replicaIdx,
+                                   const MSGTYPE &msg) {
+    if (opnum < base || opnum - base >= slots.size() || replicaIdx < 0 ||
+        replicaIdx >= numReplicas) {
+      return NULL;
+    }
+    Slot &slot = slots[opnum % slots.size()];
+    if (slot.generation != generation || slot.opnum != opnum) {
+      slot.opnum = opnum;
+      slot.generation = generation;
+      slot.replicas = 0;
+      slot.messages.resize(numReplicas);
+    }
+    // a duplicate message replaces the old one, like QuorumSet
+    slot.messages[replicaIdx] = msg;
+    slot.replicas |= uint64_t(1) << replicaIdx;
+    return CheckForQuorum(opnum);
+  }
+
+  void Add(opnum_t opnum, int replicaIdx, const MSGTYPE &msg) {
+    AddAndCheckForQuorum(opnum, replicaIdx, msg);
+  }
+
+ private:
+  int numRequired, numReplicas;
+  std::vector<Slot> slots;
+  // the first id in the window
+  opnum_t base;
+  // slots of an earlier generation are cleared
+  uint64_t generation;
+
+  Slot *Find(opnum_t opnum) {
+    if (opnum < base || opnum - base >= slots.size()) {
+      return NULL;
+    }
+    Slot &slot = slots[opnum % slots.size()];
+    if (slot.generation != generation || slot.opnum != opnum) {
+      return NULL;
+    }
+    return &slot;
+  }
+};
+
+template <class MSGTYPE>
+const opnum_t QuorumWindow<MSGTYPE>::DEFAULT_WINDOW;
+
 }  // namespace dsnet
 
 #endif  // _COMMON_QUORUMSET_H_
@@ -92,4 +92,17 @@ Replica::UnloggedUpcall(const string &op, string &res)
     app->UnloggedUpcall(op, res);
 }
 
+void
+Replica::Snapshot(opnum_t opnum, string &state)
+{
+    app->SnapshotUpcall(opnum, state);
+}
+
+void
+Replica::Restore(opnum_t opnum, const string &state)
+{
+    Debug("Making restore-upcall at " FMT_OPNUM, opnum);
+    app->RestoreUpcall(opnum, state);
+}
+
 } // namespace dsnet
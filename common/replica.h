@@ -70,6 +70,10 @@ public:
     virtual void CommitUpcall(opnum_t) { };
     // Invoke call back for unreplicated operations run on only one replica
     virtual void UnloggedUpcall(const string &str1, string &str2) { };
+    // Serialize state after executing up to opnum, for state transfer
+    virtual void SnapshotUpcall(opnum_t opnum, string &state) { };
+    // Replace state with a snapshot taken by another replica at opnum
+    virtual void RestoreUpcall(opnum_t opnum, const string &state) { };
 };
 
 class Replica : public TransportReceiver
@@ -97,6 +101,8 @@ protected:
     void Rollback(opnum_t current, opnum_t to, Log &log);
     void Commit(opnum_t op);
     void UnloggedUpcall(const string &op, string &res);
+    void Snapshot(opnum_t opnum, string &state);
+    void Restore(opnum_t opnum, const string &state);
     template<class MSG> void ExecuteUnlogged(const UnloggedRequest & msg,
                                                MSG &reply);
 
@@ -1,7 +1,11 @@
 #include "common/runner.h"
 #include "lib/assert.h"
-#include "lib/latency.h"
+#include "lib/cpuplacement.h"
+#include "lib/message.h"
+#include <algorithm>
+#include <map>
 #include <pthread.h>
+#include <vector>
 
 namespace dsnet {
 
@@ -9,12 +13,6 @@ using std::mutex;
 using std::thread;
 using std::unique_lock;
 
-#define N_WORKER_MAX 128
-Latency_t driver_spin, solo_spin, solo_task;
-Latency_t worker_spin[N_WORKER_MAX], worker_task[N_WORKER_MAX],
-    unstable_epilogue[N_WORKER_MAX];
-Latency_t sum_worker_task, sum_worker_spin;
-
 static void SetThreadAffinity(pthread_t thread, int core_id) {
     cpu_set_t mask;
     CPU_ZERO(&mask);
@@ -25,176 +23,175 @@ static void SetThreadAffinity(pthread_t thread, int core_id) {
     (void)status;
 }
 
-Runner::Runner() {
+Runner::Runner(const char *name, int n_thread) : metrics(name, n_thread) {
     // SetThreadAffinity(pthread_self(), 0);
-    core_id = 0;
-
-    _Latency_Init(&driver_spin, "driver_spin");
-    for (int i = 0; i < N_WORKER_MAX; i += 1) {
-        _Latency_Init(&worker_task[i], "");
-    }
-    _Latency_Init(&sum_worker_task, "worker_task");
-    for (int i = 0; i < N_WORKER_MAX; i += 1) {
-        _Latency_Init(&worker_spin[i], "");
-    }
-    _Latency_Init(&sum_worker_spin, "worker_spin");
+    cpu_index = 0;
 }
 
-Runner::~Runner() {
-    Latency_Dump(&driver_spin);
-    for (int i = 0; i < N_WORKER_MAX; i += 1) {
-        Latency_Sum(&sum_worker_task, &worker_task[i]);
-    }
-    Latency_Dump(&sum_worker_task);
-    for (int i = 0; i < N_WORKER_MAX; i += 1) {
-        Latency_Sum(&sum_worker_spin, &worker_spin[i]);
+Runner::~Runner() { metrics.Take().Dump(); }
+
+void Runner::RunPrologueBatch(Prologue *prologues, int n_prologue) {
+    for (int i = 0; i < n_prologue; i += 1) {
+        RunPrologue(std::move(prologues[i]));
     }
-    Latency_Dump(&sum_worker_spin);
 }
 
-static void SetAffinityImpl(pthread_t t, int &core_id) {
-    if (core_id == 64) {
-        Panic("Too many threads");
-    }
-    SetThreadAffinity(t, core_id);
-    core_id += 1;
-    // isolated cpu on NSL nodes: 0-14,32-46
-    while (core_id == 15 || core_id / 16 == 1) {
-        core_id += 1;
+// isolated cpu on NSL nodes are 0-14,32-46, pass it as placement spec
+static void SetAffinityImpl(pthread_t t, int &cpu_index) {
+    const CPUPlacement &placement = CPUPlacement::Default();
+    if (cpu_index == (int)placement.CPUs().size()) {
+        Warning("More threads than placement cpus, sharing cpus from now on");
     }
+    SetThreadAffinity(t, placement.CPU(cpu_index));
+    cpu_index += 1;
 }
 
-void Runner::SetAffinity() { SetAffinityImpl(pthread_self(), core_id); }
+void Runner::SetAffinity() { SetAffinityImpl(pthread_self(), cpu_index); }
 void Runner::SetAffinity(thread &t) {
-    SetAffinityImpl(t.native_handle(), core_id);
+    SetAffinityImpl(t.native_handle(), cpu_index);
 }
 
 void NoRunner::RunPrologue(Prologue prologue) {
-    Latency_Start(&worker_task[0]);
+    uint64_t start = RunnerMetrics::Now();
     Solo solo = prologue();
-    Latency_EndType(&worker_task[0], 'p');
+    metrics.Record(0, RunnerMetrics::Prologue, start);
     if (!solo) {
         return;
     }
     epilogue = nullptr;
-    Latency_Start(&worker_task[0]);
+    start = RunnerMetrics::Now();
     solo();
-    Latency_EndType(&worker_task[0], 's');
+    metrics.Record(0, RunnerMetrics::Solo, start);
     if (epilogue) {
-        Latency_Start(&worker_task[0]);
+        start = RunnerMetrics::Now();
         epilogue();
-        Latency_EndType(&worker_task[0], 'e');
+        metrics.Record(0, RunnerMetrics::Epilogue, start);
     }
 }
 
 void CTPLRunner::RunPrologue(Prologue prologue) {
-    Latency_Start(&driver_spin);
-    pool.push([this, prologue](int id) {
-        Latency_Start(&worker_task[id]);
+    uint64_t push_start = RunnerMetrics::Now();
+    pool.push([this, prologue = std::move(prologue)](int id) {
+        uint64_t start = RunnerMetrics::Now();
         Solo solo = prologue();
-        Latency_EndType(&worker_task[id], 'p');
+        metrics.Record(id + 1, RunnerMetrics::Prologue, start);
         if (!solo) {
             return;
         }
 
-        Latency_Start(&worker_spin[id]);
+        start = RunnerMetrics::Now();
         unique_lock<mutex> replica_lock(replica_mutex);
-        Latency_EndType(&worker_spin[id], 's');
+        metrics.Record(id + 1, RunnerMetrics::SoloSpin, start);
 
-        Latency_Start(&worker_task[id]);
+        start = RunnerMetrics::Now();
         this->epilogue = nullptr;
         solo();
-        Latency_EndType(&worker_task[id], 's');
+        metrics.Record(id + 1, RunnerMetrics::Solo, start);
 
-        Epilogue epilogue = this->epilogue;
+        Epilogue epilogue = std::move(this->epilogue);
         replica_lock.unlock();
         if (epilogue) {
-            Latency_Start(&worker_task[id]);
+            start = RunnerMetrics::Now();
             epilogue();
-            Latency_EndType(&worker_task[id], 'e');
+            metrics.Record(id + 1, RunnerMetrics::Epilogue, start);
         }
     });
-    Latency_End(&driver_spin);
+    metrics.Record(0, RunnerMetrics::DriverSpin, push_start);
 }
 
 void CTPLOrderedRunner::RunPrologue(Prologue prologue) {
     prologue_id += 1;
-    pool.push([this, prologue, prologue_id = prologue_id](int id) {
-        Latency_Start(&worker_task[id]);
+    pool.push([this, prologue = std::move(prologue),
+               prologue_id = prologue_id](int id) {
+        uint64_t start = RunnerMetrics::Now();
         Solo solo = prologue();
-        Latency_EndType(&worker_task[id], 'p');
+        metrics.Record(id + 1, RunnerMetrics::Prologue, start);
 
         Debug("Wait solo: worker id = %d, task id = %d", id, prologue_id);
-        Latency_Start(&worker_spin[id]);
+        start = RunnerMetrics::Now();
         unique_lock<mutex> replica_lock(replica_mutex);
         cv.wait(replica_lock, [this, prologue_id] {
             return last_task == prologue_id - 1;
         });
-        Latency_EndType(&worker_spin[id], 's');
+        metrics.Record(id + 1, RunnerMetrics::SoloSpin, start);
         Debug("Start solo: worker id = %d, task id = %d", id, prologue_id);
 
         this->epilogue = nullptr;
         if (solo) {
-            Latency_Start(&worker_task[id]);
+            start = RunnerMetrics::Now();
             solo();
-            Latency_EndType(&worker_task[id], 's');
+            metrics.Record(id + 1, RunnerMetrics::Solo, start);
         }
         Debug("Done solo: worker id = %d, task id = %d", id, prologue_id);
-        Epilogue epilogue = this->epilogue;
+        Epilogue epilogue = std::move(this->epilogue);
         last_task = prologue_id;
         replica_lock.unlock();
         cv.notify_all();
 
         if (epilogue) {
-            Latency_Start(&worker_task[id]);
+            start = RunnerMetrics::Now();
             epilogue();
-            Latency_EndType(&worker_task[id], 'e');
+            metrics.Record(id + 1, RunnerMetrics::Epilogue, start);
         }
     });
 }
 
+// slot 1 is the replica thread, workers of `pool` follow
 void CTPLPipelineRunner::RunPrologue(Prologue prologue) {
-    Latency_Start(&driver_spin);
-    pool.push([this, prologue](int id) {
-        Latency_Start(&worker_task[id + 1]);
+    uint64_t push_start = RunnerMetrics::Now();
+    pool.push([this, prologue = std::move(prologue)](int id) mutable {
+        uint64_t start = RunnerMetrics::Now();
         Solo solo = prologue();
-        Latency_EndType(&worker_task[id + 1], 'p');
+        metrics.Record(id + 2, RunnerMetrics::Prologue, start);
 
         if (solo) {
-            Latency_Start(&worker_spin[id + 1]);
-            replica_pool.push([this, solo](int id) {
-                Latency_Start(&worker_task[0]);
+            start = RunnerMetrics::Now();
+            replica_pool.push([this, solo = std::move(solo)](int id) {
+                uint64_t start = RunnerMetrics::Now();
                 solo();
-                Latency_EndType(&worker_task[0], 's');
+                metrics.Record(1, RunnerMetrics::Solo, start);
             });
-            Latency_EndType(&worker_spin[id + 1], 's');
+            metrics.Record(id + 2, RunnerMetrics::SoloSpin, start);
         }
     });
-    Latency_End(&driver_spin);
+    metrics.Record(0, RunnerMetrics::DriverSpin, push_start);
 }
 
+// called by solo on replica thread
 void CTPLPipelineRunner::RunEpilogue(Epilogue epilogue) {
-    Latency_Start(&worker_spin[0]);
-    pool.push([epilogue](int id) {
-        Latency_Start(&worker_task[id + 1]);
+    uint64_t push_start = RunnerMetrics::Now();
+    pool.push([this, epilogue = std::move(epilogue)](int id) {
+        uint64_t start = RunnerMetrics::Now();
         epilogue();
-        Latency_EndType(&worker_task[id + 1], 'e');
+        metrics.Record(id + 2, RunnerMetrics::Epilogue, start);
     });
-    Latency_EndType(&worker_spin[0], 'e');
+    metrics.Record(1, RunnerMetrics::DriverSpin, push_start);
 }
 
-SpinOrderedRunner::SpinOrderedRunner(int n_worker) : n_worker(n_worker) {
+SpinOrderedRunner::SpinOrderedRunner(
+    int n_worker, const char *name, int n_lane)
+    : Runner(name, n_worker + 1), n_worker(n_worker), n_lane(n_lane) {
     if (n_worker > N_WORKER_MAX) {
         Panic("Too many workers");
     }
     if (n_slot() > N_SLOT_MAX) {
         Panic("Not enough slot");
     }
+    if (n_lane < 1 || n_lane > N_LANE_MAX) {
+        Panic("Invalid number of lanes: %d", n_lane);
+    }
+    for (int i = 0; i < n_worker; i += 1) {
+        lane_wait[i] = NOT_WAITING;
+    }
+    for (int i = 0; i < n_lane; i += 1) {
+        lane_tail[i] = lane_head[i] = 0;
+    }
 
     for (int i = 0; i < n_slot(); i += 1) {
         slot_ready[i] = true;
     }
     next_prologue = next_solo = 0;
+    shutdown = false;
 
     SetAffinity();
     for (int i = 0; i < n_worker; i += 1) {
@@ -205,63 +202,141 @@ SpinOrderedRunner::SpinOrderedRunner(int n_worker) : n_worker(n_worker) {
 
 SpinOrderedRunner::~SpinOrderedRunner() {
     shutdown = true;
+    for (int i = 0; i < n_worker; i += 1) {
+        worker_parkers[i].Wake();
+    }
     for (int i = 0; i < n_worker; i += 1) {
         workers[i].join();
     }
 }
 
 void SpinOrderedRunner::RunPrologue(Prologue prologue) {
-    Latency_Start(&driver_spin);
+    uint64_t push_start = RunnerMetrics::Now();
     // it is unnecessary to check for `shutdown` during this spinning
     // since if driver thread is spinning here, no one will set `shutdown`
     // anyway
     DriverSpin();
-    Latency_End(&driver_spin);
+    metrics.Record(0, RunnerMetrics::DriverSpin, push_start);
 
-    prologue_slots[next_prologue] = prologue;
+    prologue_slots[next_prologue] = std::move(prologue);
     slot_ready[next_prologue] = false;
+    WorkerParker(next_prologue).Wake();
     next_prologue = (next_prologue + 1) % n_slot();
 }
 
+void SpinOrderedRunner::RunPrologueBatch(Prologue *prologues, int n_prologue) {
+    while (n_prologue > 0) {
+        int n_reserve = std::min(n_prologue, n_slot());
+        uint64_t push_start = RunnerMetrics::Now();
+        // workers free their slots out of order, wait for all of them
+        for (int i = 0; i < n_reserve; i += 1) {
+            int slot_id = (next_prologue + i) % n_slot();
+            driver_parker.Wait(
+                [this, slot_id] { return bool(slot_ready[slot_id]); });
+        }
+        metrics.Record(0, RunnerMetrics::DriverSpin, push_start);
+
+        int first_slot = next_prologue;
+        for (int i = 0; i < n_reserve; i += 1) {
+            prologue_slots[next_prologue] = std::move(prologues[i]);
+            // pairs with the load of worker, no need of a full fence per slot
+            slot_ready[next_prologue].store(false, std::memory_order_release);
+            next_prologue = (next_prologue + 1) % n_slot();
+        }
+        // one fence for the whole batch before checking for parked workers
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        for (int i = 0; i < std::min(n_reserve, n_worker); i += 1) {
+            WorkerParker(first_slot + i).Wake();
+        }
+        prologues += n_reserve;
+        n_prologue -= n_reserve;
+    }
+}
+
+// solos of different lanes run at the same time, so `next_solo` is not
+// the slot of the calling solo
+static thread_local int solo_slot;
+
 void SpinOrderedRunner::RunEpilogue(Epilogue epilogue) {
-    epilogue_slots[next_solo] = epilogue;
+    epilogue_slots[solo_slot] = std::move(epilogue);
 }
 
 void SpinOrderedRunner::RunWorkerThread(int id) {
     int slot_id = id;
     while (true) {
-        Latency_Start(&worker_spin[id]);
-        while (slot_ready[slot_id] && !shutdown) {
-        }
+        uint64_t start = RunnerMetrics::Now();
+        worker_parkers[id].Wait(
+            [this, slot_id] { return !slot_ready[slot_id] || shutdown; });
         if (shutdown) {
             return;
         }
-        Latency_EndType(&worker_spin[id], 'p');
+        metrics.Record(id + 1, RunnerMetrics::PrologueSpin, start);
 
-        Latency_Start(&worker_task[id]);
+        start = RunnerMetrics::Now();
         Solo solo = prologue_slots[slot_id]();
         prologue_slots[slot_id] = nullptr;
         slot_ready[slot_id] = true;
-        Latency_EndType(&worker_task[id], 'p');
+        driver_parker.Wake();
+        metrics.Record(id + 1, RunnerMetrics::Prologue, start);
 
         if (solo) {
-            Latency_Start(&worker_spin[id]);
+            start = RunnerMetrics::Now();
             SoloSpin(slot_id);
             if (shutdown) {
                 return;
             }
-            Latency_EndType(&worker_spin[id], 's');
-
-            Latency_Start(&worker_task[id]);
-            solo();
-            SoloDone();
-            Latency_EndType(&worker_task[id], 's');
+            solo_slot = slot_id;
+            if (n_lane == 1 || solo.lane_key == Solo::NO_LANE) {
+                if (n_lane > 1) {
+                    lane_wait[id] = WAIT_LANES_IDLE;
+                    worker_parkers[id].Wait(
+                        [this] { return LanesIdle() || shutdown; });
+                    lane_wait[id] = NOT_WAITING;
+                    if (shutdown) {
+                        return;
+                    }
+                }
+                metrics.Record(id + 1, RunnerMetrics::SoloSpin, start);
+
+                start = RunnerMetrics::Now();
+                solo();
+                SoloDone();
+                metrics.Record(id + 1, RunnerMetrics::Solo, start);
+            } else {
+                int lane = solo.lane_key % n_lane;
+                uint32_t ticket = lane_tail[lane];
+                lane_tail[lane] = ticket + 1;
+                SoloDone();
+                lane_wait[id] = LaneWait(lane, ticket);
+                worker_parkers[id].Wait([this, lane, ticket] {
+                    return lane_head[lane] == ticket || shutdown;
+                });
+                lane_wait[id] = NOT_WAITING;
+                if (shutdown) {
+                    return;
+                }
+                metrics.Record(id + 1, RunnerMetrics::SoloSpin, start);
+
+                start = RunnerMetrics::Now();
+                solo();
+                lane_head[lane] = ticket + 1;
+                // the next ticket of the lane, or an unlaned solo waiting
+                // for all lanes, may be on any worker
+                uint64_t next = LaneWait(lane, ticket + 1);
+                for (int i = 0; i < n_worker; i += 1) {
+                    uint64_t wait = lane_wait[i];
+                    if (wait == next || wait == WAIT_LANES_IDLE) {
+                        worker_parkers[i].Wake();
+                    }
+                }
+                metrics.Record(id + 1, RunnerMetrics::Solo, start);
+            }
 
             if (epilogue_slots[slot_id]) {
-                Latency_Start(&worker_task[id]);
+                start = RunnerMetrics::Now();
                 epilogue_slots[slot_id]();
                 epilogue_slots[slot_id] = nullptr;
-                Latency_EndType(&worker_task[id], 'e');
+                metrics.Record(id + 1, RunnerMetrics::Epilogue, start);
             }
         }
 
@@ -269,4 +344,373 @@ void SpinOrderedRunner::RunWorkerThread(int id) {
     }
 }
 
-} // namespace dsnet
\ No newline at end of file
+ElasticOrderedRunner::ElasticOrderedRunner(
+    int n_worker, size_t high_watermark, size_t low_watermark,
+    ShedPolicy policy)
+    : Runner("elastic", n_worker + 1), n_worker(n_worker), shutdown(false),
+      high_watermark(high_watermark), low_watermark(low_watermark),
+      policy(policy), queue_offset(0), is_overloaded(false), n_queued(0),
+      n_in_flight(0), n_admitted(0), n_shed(0), n_overloaded(0),
+      next_prologue(0), next_solo(0) {
+    if (n_worker > N_WORKER_MAX) {
+        Panic("Too many workers");
+    }
+    if (low_watermark > high_watermark) {
+        Panic("Low watermark above high watermark");
+    }
+    for (int i = 0; i < n_worker; i += 1) {
+        solo_owner[i] = 0;
+    }
+
+    SetAffinity();
+    for (int i = 0; i < n_worker; i += 1) {
+        workers[i] = thread([this, i] { RunWorkerThread(i); });
+        SetAffinity(workers[i]);
+    }
+}
+
+ElasticOrderedRunner::~ElasticOrderedRunner() {
+    shutdown = true;
+    idle_parker.Wake();
+    for (int i = 0; i < n_worker; i += 1) {
+        worker_parkers[i].Wake();
+    }
+    for (int i = 0; i < n_worker; i += 1) {
+        workers[i].join();
+    }
+}
+
+void ElasticOrderedRunner::RunPrologue(Prologue prologue) {
+    Submit(Task{std::move(prologue), nullptr, false});
+}
+
+void ElasticOrderedRunner::RunSheddablePrologue(
+    Prologue prologue, Epilogue on_shed) {
+    Submit(Task{std::move(prologue), std::move(on_shed), true});
+}
+
+void ElasticOrderedRunner::RunPrologueBatch(
+    Prologue *prologues, int n_prologue) {
+    uint64_t push_start = RunnerMetrics::Now();
+    {
+        std::lock_guard<mutex> lock(queue_mutex);
+        if (!is_overloaded && n_queued >= high_watermark) {
+            is_overloaded = true;
+            n_overloaded += 1;
+        }
+        for (int i = 0; i < n_prologue; i += 1) {
+            queue.push_back(Task{std::move(prologues[i]), nullptr, false});
+        }
+        n_queued += n_prologue;
+        n_admitted += n_prologue;
+    }
+    idle_parker.Wake();
+    metrics.Record(0, RunnerMetrics::DriverSpin, push_start);
+}
+
+ElasticOrderedRunner::Stats ElasticOrderedRunner::GetStats() const {
+    return Stats{n_queued, n_in_flight, n_admitted, n_shed, n_overloaded};
+}
+
+void ElasticOrderedRunner::RunSheddablePrologueBatch(
+    Prologue *prologues, Epilogue *on_shed, int n_prologue) {
+    uint64_t push_start = RunnerMetrics::Now();
+    // shed ones are rare, so collect them rather than keep a buffer around
+    std::vector<Epilogue> shed_list;
+    {
+        std::lock_guard<mutex> lock(queue_mutex);
+        for (int i = 0; i < n_prologue; i += 1) {
+            Epilogue shed = Admit(
+                Task{std::move(prologues[i]), std::move(on_shed[i]), true});
+            if (shed) {
+                shed_list.push_back(std::move(shed));
+            }
+        }
+    }
+    idle_parker.Wake();
+    metrics.Record(0, RunnerMetrics::DriverSpin, push_start);
+
+    for (Epilogue &shed : shed_list) {
+        shed();
+    }
+}
+
+void ElasticOrderedRunner::Submit(Task task) {
+    uint64_t push_start = RunnerMetrics::Now();
+    Epilogue on_shed;
+    {
+        std::lock_guard<mutex> lock(queue_mutex);
+        on_shed = Admit(std::move(task));
+    }
+    idle_parker.Wake();
+    metrics.Record(0, RunnerMetrics::DriverSpin, push_start);
+
+    if (on_shed) {
+        on_shed();
+    }
+}
+
+Runner::Epilogue ElasticOrderedRunner::Admit(Task task) {
+    Epilogue on_shed;
+    if (!is_overloaded && n_queued >= high_watermark) {
+        is_overloaded = true;
+        n_overloaded += 1;
+    }
+    if (is_overloaded && task.sheddable) {
+        if (policy == ShedPolicy::DropOldest) {
+            on_shed = ShedOldest();
+        }
+        // nothing older to drop falls back to reject
+        if (policy == ShedPolicy::RejectNew || !on_shed) {
+            n_shed += 1;
+            on_shed = std::move(task.on_shed);
+            task.prologue = nullptr;
+        }
+    }
+    if (task.prologue) {
+        if (task.sheddable) {
+            sheddable_ids.push_back(queue_offset + queue.size());
+        }
+        queue.push_back(std::move(task));
+        n_queued += 1;
+        n_admitted += 1;
+    }
+    return on_shed;
+}
+
+// must hold queue_mutex, return the `on_shed` of the discarded prologue, or a
+// no-op if it has none, or nullptr if no sheddable prologue is queued
+Runner::Epilogue ElasticOrderedRunner::ShedOldest() {
+    while (!sheddable_ids.empty()) {
+        uint64_t id = sheddable_ids.front();
+        sheddable_ids.pop_front();
+        if (id < queue_offset) {
+            continue;
+        }
+        Task &task = queue[id - queue_offset];
+        task.prologue = nullptr;
+        n_queued -= 1;
+        n_shed += 1;
+        if (task.on_shed) {
+            return std::move(task.on_shed);
+        }
+        return [] {};
+    }
+    return nullptr;
+}
+
+bool ElasticOrderedRunner::Dequeue(Prologue &prologue, uint64_t &prologue_id) {
+    std::lock_guard<mutex> lock(queue_mutex);
+    while (!queue.empty()) {
+        Task task = std::move(queue.front());
+        queue.pop_front();
+        queue_offset += 1;
+        if (!task.prologue) {
+            continue;
+        }
+
+        prologue = std::move(task.prologue);
+        prologue_id = next_prologue;
+        next_prologue += 1;
+        n_queued -= 1;
+        n_in_flight += 1;
+        if (is_overloaded && n_queued <= low_watermark) {
+            is_overloaded = false;
+        }
+        while (!sheddable_ids.empty() && sheddable_ids.front() < queue_offset) {
+            sheddable_ids.pop_front();
+        }
+        return true;
+    }
+    return false;
+}
+
+void ElasticOrderedRunner::RunWorkerThread(int id) {
+    while (true) {
+        uint64_t start = RunnerMetrics::Now();
+        idle_parker.Wait([this] { return n_queued != 0 || shutdown; });
+        if (shutdown) {
+            return;
+        }
+        Prologue prologue;
+        uint64_t prologue_id;
+        if (!Dequeue(prologue, prologue_id)) {
+            continue;
+        }
+        solo_owner[prologue_id % n_worker] = id;
+        metrics.Record(id + 1, RunnerMetrics::PrologueSpin, start);
+
+        start = RunnerMetrics::Now();
+        Solo solo = prologue();
+        metrics.Record(id + 1, RunnerMetrics::Prologue, start);
+
+        // solo of every prologue takes its turn, even if it is empty
+        start = RunnerMetrics::Now();
+        worker_parkers[id].Wait([this, prologue_id] {
+            return next_solo == prologue_id || shutdown;
+        });
+        if (shutdown) {
+            return;
+        }
+        metrics.Record(id + 1, RunnerMetrics::SoloSpin, start);
+
+        this->epilogue = nullptr;
+        if (solo) {
+            start = RunnerMetrics::Now();
+            solo();
+            metrics.Record(id + 1, RunnerMetrics::Solo, start);
+        }
+        Epilogue epilogue = std::move(this->epilogue);
+        next_solo = prologue_id + 1;
+        worker_parkers[solo_owner[(prologue_id + 1) % n_worker]].Wake();
+
+        if (epilogue) {
+            start = RunnerMetrics::Now();
+            epilogue();
+            metrics.Record(id + 1, RunnerMetrics::Epilogue, start);
+        }
+        n_in_flight -= 1;
+    }
+}
+
+WorkStealingRunner::WorkStealingRunner(int n_worker)
+    : Runner("worksteal", n_worker + 1), n_worker(n_worker),
+      slots(new Slot[N_SLOT]),
+      deques(new WorkStealingDeque<uint64_t>[n_worker]), shutdown(false),
+      next_prologue(0), solo_turn(0) {
+    if (n_worker > N_WORKER_MAX) {
+        Panic("Too many workers");
+    }
+
+    SetAffinity();
+    for (int i = 0; i < n_worker; i += 1) {
+        workers[i] = thread([this, i] { RunWorkerThread(i); });
+        SetAffinity(workers[i]);
+    }
+}
+
+WorkStealingRunner::~WorkStealingRunner() {
+    shutdown = true;
+    for (int i = 0; i < n_worker; i += 1) {
+        worker_parkers[i].Wake();
+    }
+    for (int i = 0; i < n_worker; i += 1) {
+        workers[i].join();
+    }
+}
+
+void WorkStealingRunner::RunPrologue(Prologue prologue) {
+    uint64_t push_start = RunnerMetrics::Now();
+    uint64_t id = next_prologue;
+    next_prologue += 1;
+    // the slot is free once the solo of its last task has run
+    driver_parker.Wait([this, id] { return id < (solo_turn >> 1) + N_SLOT; });
+    Slot &slot = slots[id % N_SLOT];
+    slot.prologue = std::move(prologue);
+    slot.published = id + 1;
+    worker_parkers[id % n_worker].Wake();
+    metrics.Record(0, RunnerMetrics::DriverSpin, push_start);
+}
+
+bool WorkStealingRunner::Take(int id, uint64_t &next_dealt, uint64_t &task_id) {
+    while (Published(next_dealt)) {
+        deques[id].Push(next_dealt);
+        next_dealt += n_worker;
+    }
+    if (deques[id].Pop(task_id)) {
+        return true;
+    }
+    for (int i = 1; i < n_worker; i += 1) {
+        if (deques[(id + i) % n_worker].Steal(task_id)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+bool WorkStealingRunner::Stealable(int id) const {
+    for (int i = 1; i < n_worker; i += 1) {
+        if (!deques[(id + i) % n_worker].Empty()) {
+            return true;
+        }
+    }
+    return false;
+}
+
+// the turn is claimed by setting its low bit, so a worker that finds it
+// claimed leaves its ready solo to the claiming one, which checks the next
+// slot after giving the turn up
+void WorkStealingRunner::RunSolos(int id) {
+    while (true) {
+        uint64_t turn = solo_turn.load();
+        uint64_t solo_id = turn >> 1;
+        if ((turn & 1) != 0 ||
+            slots[solo_id % N_SLOT].ready.load() != solo_id + 1) {
+            return;
+        }
+        if (!solo_turn.compare_exchange_strong(turn, turn | 1)) {
+            continue;
+        }
+
+        Slot &slot = slots[solo_id % N_SLOT];
+        this->epilogue = nullptr;
+        if (slot.solo) {
+            uint64_t start = RunnerMetrics::Now();
+            slot.solo();
+            metrics.Record(id + 1, RunnerMetrics::Solo, start);
+            slot.solo = nullptr;
+        }
+        Epilogue epilogue = std::move(this->epilogue);
+        solo_turn.store((solo_id + 1) << 1);
+        driver_parker.Wake();
+
+        if (epilogue) {
+            uint64_t start = RunnerMetrics::Now();
+            epilogue();
+            metrics.Record(id + 1, RunnerMetrics::Epilogue, start);
+        }
+    }
+}
+
+void WorkStealingRunner::RunWorkerThread(int id) {
+    uint64_t next_dealt = id;
+    uint64_t spin_start = RunnerMetrics::Now();
+    while (!shutdown) {
+        uint64_t task_id;
+        if (!Take(id, next_dealt, task_id)) {
+            worker_parkers[id].Wait([this, id, &next_dealt] {
+                return shutdown || Published(next_dealt) || Stealable(id);
+            });
+            continue;
+        }
+        metrics.Record(id + 1, RunnerMetrics::PrologueSpin, spin_start);
+
+        Slot &slot = slots[task_id % N_SLOT];
+        uint64_t start = RunnerMetrics::Now();
+        Prologue prologue = std::move(slot.prologue);
+        slot.solo = prologue();
+        metrics.Record(id + 1, RunnerMetrics::Prologue, start);
+        slot.ready = task_id + 1;
+        RunSolos(id);
+        spin_start = RunnerMetrics::Now();
+    }
+}
+
+std::unique_ptr<Runner> CreateOrderedRunner(
+    const std::string &name, int n_worker, int n_lane) {
+    std::unique_ptr<Runner> runner;
+    if (name == "ctpl") {
+        runner.reset(new CTPLOrderedRunner(n_worker));
+    } else if (name == "spin") {
+        runner.reset(new SpinOrderedRunner(n_worker, "spin", n_lane));
+    } else if (name == "elastic") {
+        runner.reset(new ElasticOrderedRunner(n_worker));
+    } else if (name == "worksteal") {
+        runner.reset(new WorkStealingRunner(n_worker));
+    } else {
+        Panic("Unknown runner: %s", name.c_str());
+    }
+    return runner;
+}
+
+} // namespace dsnet
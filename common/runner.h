@@ -1,8 +1,14 @@
 #pragma once
+#include "common/inlinefunction.h"
+#include "common/parker.h"
+#include "common/runnermetrics.h"
+#include "common/wsdeque.h"
 #include "lib/ctpl.h"
 #include <atomic>
 #include <condition_variable>
+#include <deque>
 #include <functional>
+#include <memory>
 #include <mutex>
 #include <thread>
 
@@ -10,20 +16,67 @@ namespace dsnet {
 
 class Runner {
 public:
-    Runner();
+    // n_thread is the number of metrics slots, i.e. driver thread + workers
+    Runner(const char *name, int n_thread);
     virtual ~Runner();
 
-    using Solo = std::function<void()>;
-    using Prologue = std::function<Solo()>;
-    using Epilogue = std::function<void()>;
+    // move-only, capture by move to keep dispatch allocation free
+    //
+    // a solo is ordered against all solos, unless it is put in a lane with
+    // `LaneSolo`: then it is only ordered against solos of the same lane and
+    // unlaned solos, and runners that have lanes run the solos of different
+    // lanes in parallel. other runners run laned solos as unlaned ones, which
+    // keeps every lane in order as well
+    class Solo : public InlineFunction<void()> {
+    public:
+        static const uint64_t NO_LANE = UINT64_MAX;
+        uint64_t lane_key = NO_LANE;
+
+        using InlineFunction<void()>::InlineFunction;
+        Solo() noexcept {}
+    };
+    // solos of the same key share a lane; they must only touch state that
+    // belongs to the key, e.g. one client or one sequence number. No replica
+    // puts its solos in lanes so far, since their solos of per-client or
+    // per-sequence-number messages go on to the log or batches as well
+    template <typename F> static Solo LaneSolo(uint64_t key, F &&f) {
+        Solo solo(std::forward<F>(f));
+        solo.lane_key = key;
+        return solo;
+    }
+    using Prologue = InlineFunction<Solo()>;
+    using Epilogue = InlineFunction<void()>;
 
     virtual void RunPrologue(Prologue prologue) = 0;
     virtual void RunEpilogue(Epilogue epilogue) = 0;
+    // same as calling `RunPrologue` on each of them in order, e.g. for all
+    // messages of one receive burst; prologues are moved out of the array.
+    // Runners override it to hand off the whole batch at once
+    virtual void RunPrologueBatch(Prologue *prologues, int n_prologue);
+    // a prologue of work that can be dropped when the runner is overloaded,
+    // e.g. of a client request which the client retries. A shed prologue is
+    // not run, instead `on_shed` is called on the calling thread. Runners
+    // that never shed run it as any other prologue
+    virtual void RunSheddablePrologue(
+        Prologue prologue, Epilogue on_shed = nullptr) {
+        RunPrologue(std::move(prologue));
+    }
+    // `RunSheddablePrologue` on each of them in order, with `on_shed[i]` for
+    // `prologues[i]`, e.g. for a receive burst of client requests. Runners
+    // that never shed hand it to `RunPrologueBatch`
+    virtual void RunSheddablePrologueBatch(
+        Prologue *prologues, Epilogue *on_shed, int n_prologue) {
+        RunPrologueBatch(prologues, n_prologue);
+    }
+
+    const RunnerMetrics &Metrics() const { return metrics; }
 
 protected:
+    // pin to the next cpu of CPUPlacement::Default()
     void SetAffinity();
     void SetAffinity(std::thread &t);
-    int core_id;
+    int cpu_index;
+    RunnerMetrics metrics;
 };
 
 // * self-document of Runner model
@@ -33,8 +86,11 @@ class NoRunner : public Runner {
     Epilogue epilogue;
 
 public:
+    NoRunner() : Runner("no", 1) {}
     void RunPrologue(Prologue prologue) override;
-    void RunEpilogue(Epilogue epilogue) override { this->epilogue = epilogue; }
+    void RunEpilogue(Epilogue epilogue) override {
+        this->epilogue = std::move(epilogue);
+    }
 };
 
 class CTPLRunner : public Runner {
@@ -47,7 +103,8 @@ protected:
     std::thread &GetWorker(int i) { return pool.get_thread(i); }
 
 public:
-    CTPLRunner(int n_worker) : pool(n_worker) {
+    CTPLRunner(int n_worker)
+        : Runner("ctpl-unordered", n_worker + 1), pool(n_worker) {
         SetAffinity();
         for (int i = 0; i < n_worker; i += 1) {
             SetAffinity(pool.get_thread(i));
@@ -55,7 +112,9 @@ public:
     }
 
     void RunPrologue(Prologue prologue) override;
-    void RunEpilogue(Epilogue epilogue) override { this->epilogue = epilogue; }
+    void RunEpilogue(Epilogue epilogue) override {
+        this->epilogue = std::move(epilogue);
+    }
 };
 
 class CTPLOrderedRunner : public Runner {
@@ -70,7 +129,8 @@ protected:
     std::thread &GetWorker(int i) { return pool.get_thread(i); }
 
 public:
-    CTPLOrderedRunner(int n_worker) : pool(n_worker) {
+    CTPLOrderedRunner(int n_worker)
+        : Runner("ctpl", n_worker + 1), pool(n_worker) {
         prologue_id = last_task = 0;
 
         SetAffinity();
@@ -80,7 +140,9 @@ public:
     }
 
     void RunPrologue(Prologue prologue) override;
-    void RunEpilogue(Epilogue epilogue) override { this->epilogue = epilogue; }
+    void RunEpilogue(Epilogue epilogue) override {
+        this->epilogue = std::move(epilogue);
+    }
 };
 
 // Problem of pipeline model: replica thread spends lot of time pushing epilogue
@@ -89,7 +151,9 @@ class CTPLPipelineRunner : public Runner {
     ctpl::thread_pool pool, replica_pool;
 
 public:
-    CTPLPipelineRunner(int n_worker) : pool(n_worker - 1), replica_pool(1) {
+    CTPLPipelineRunner(int n_worker)
+        : Runner("ctpl-pipeline", n_worker + 1), pool(n_worker - 1),
+          replica_pool(1) {
         SetAffinity();
         SetAffinity(replica_pool.get_thread(0));
         for (int i = 0; i < n_worker - 1; i += 1) {
@@ -106,21 +170,25 @@ public:
 // (i.e. ring) buffer, and back-propagate blocking to `RunPrologue`
 // caller if system overloaded. If client not slow down requesting soon
 // enough, it could cause severe packet dropping
+// see `ElasticOrderedRunner` for the alternative
 class SpinOrderedRunner : public Runner {
     static const int N_WORKER_MAX = 128;
+    static const int N_LANE_MAX = 64;
 
     static const int N_SLOT_MAX = 1000;
     Prologue prologue_slots[N_SLOT_MAX];
     Epilogue epilogue_slots[N_SLOT_MAX];
 
     virtual void SoloSpin(int slot_id) {
-        while (next_solo != slot_id && !shutdown) {
-        }
+        WorkerParker(slot_id).Wait(
+            [this, slot_id] { return next_solo == slot_id || shutdown; });
+    }
+    virtual void SoloDone() {
+        next_solo = (next_solo + 1) % n_slot();
+        WorkerParker(next_solo).Wake();
     }
-    virtual void SoloDone() { next_solo = (next_solo + 1) % n_slot(); }
     virtual void DriverSpin() {
-        while (!slot_ready[next_prologue]) {
-        }
+        driver_parker.Wait([this] { return bool(slot_ready[next_prologue]); });
     }
     virtual int n_slot() const { return n_worker * 4; }
 
@@ -133,14 +201,53 @@ protected:
     std::atomic<bool> slot_ready[N_SLOT_MAX];
     int next_prologue;
     std::atomic<int> next_solo;
+    // idle threads park instead of spinning, see `Parker::SetSpinBudget`;
+    // worker i waits on worker_parkers[i] for slots i, i + n_worker, ...
+    Parker driver_parker;
+    Parker worker_parkers[N_WORKER_MAX];
+
+    Parker &WorkerParker(int slot_id) {
+        return worker_parkers[slot_id % n_worker];
+    }
+    void WakeWorkers() {
+        for (int i = 0; i < n_worker; i += 1) {
+            worker_parkers[i].Wake();
+        }
+    }
 
+    // a laned solo takes a ticket of its lane on its solo turn, then gives
+    // up the turn and waits for the lane; an unlaned one keeps the turn
+    // until every lane has drained
+    int n_lane;
+    uint32_t lane_tail[N_LANE_MAX]; // only touched on solo turn
+    std::atomic<uint32_t> lane_head[N_LANE_MAX];
+    // what worker i waits for in lanes, so that a laned solo only wakes the
+    // worker of the next ticket of its lane and the one waiting for all
+    // lanes: LaneWait(lane, ticket), WAIT_LANES_IDLE or NOT_WAITING
+    static const uint64_t NOT_WAITING = UINT64_MAX;
+    static const uint64_t WAIT_LANES_IDLE = UINT64_MAX - 1;
+    std::atomic<uint64_t> lane_wait[N_WORKER_MAX];
+    static uint64_t LaneWait(int lane, uint32_t ticket) {
+        return (uint64_t)lane << 32 | ticket;
+    }
+    bool LanesIdle() const {
+        for (int i = 0; i < n_lane; i += 1) {
+            if (lane_head[i] != lane_tail[i]) {
+                return false;
+            }
+        }
+        return true;
+    }
     int NWorker() { return n_worker; }
     std::thread &GetWorker(int i) { return workers[i]; }
 
 public:
-    SpinOrderedRunner(int n_worker);
+    SpinOrderedRunner(
+        int n_worker, const char *name = "spin", int n_lane = 1);
     ~SpinOrderedRunner();
     void RunPrologue(Prologue prologue) override;
+    // reserve consecutive slots for up to `n_slot()` prologues a time
+    void RunPrologueBatch(Prologue *prologues, int n_prologue) override;
     void RunEpilogue(Epilogue epilogue) override;
 };
 
@@ -151,20 +258,182 @@ public:
 class SpinRunner : public SpinOrderedRunner {
     int n_slot() const override { return n_worker; }
     void SoloSpin(int slot_id) override {
-        while (next_solo != slot_id && !shutdown) {
+        WorkerParker(slot_id).Wait([this, slot_id] {
             int expect = -1;
             next_solo.compare_exchange_weak(expect, slot_id);
-        }
+            return next_solo == slot_id || shutdown;
+        });
+    }
+    void SoloDone() override {
+        next_solo = -1;
+        // any of the workers may be waiting for its turn
+        WakeWorkers();
     }
-    void SoloDone() override { next_solo = -1; }
     void DriverSpin() override {
-        while (!slot_ready[next_prologue]) {
+        driver_parker.Wait([this] {
+            if (slot_ready[next_prologue]) {
+                return true;
+            }
             next_prologue = (next_prologue + 1) % n_slot();
-        }
+            return false;
+        });
     }
 
 public:
-    SpinRunner(int n_worker) : SpinOrderedRunner(n_worker) { next_solo = -1; }
+    SpinRunner(int n_worker) : SpinOrderedRunner(n_worker, "spin-unordered") {
+        next_solo = -1;
+    }
+    // slots are not taken consecutively
+    void RunPrologueBatch(Prologue *prologues, int n_prologue) override {
+        Runner::RunPrologueBatch(prologues, n_prologue);
+    }
 };
 
-} // namespace dsnet
\ No newline at end of file
+// ordered like `SpinOrderedRunner`, but `RunPrologue` never blocks: pending
+// prologues wait in a queue that grows as needed. Once the queue reaches high
+// watermark the runner is overloaded until it drains to low watermark, and
+// during that prologues submitted with `RunSheddablePrologue` (e.g. the ones
+// for client requests) are shed according to policy instead of queued:
+// * DropOldest: discard the oldest queued sheddable prologue, admit the new one
+// * RejectNew: discard the new one, e.g. to NACK the client immediately
+// shed prologues are never run, instead their `on_shed` is called on driver
+// thread. Other prologues are always admitted, so queue grows beyond high
+// watermark only with them
+class ElasticOrderedRunner : public Runner {
+public:
+    enum class ShedPolicy { DropOldest, RejectNew };
+
+    struct Stats {
+        uint64_t queued, in_flight; // current
+        uint64_t admitted, shed, overloaded; // accumulated
+    };
+
+    ElasticOrderedRunner(
+        int n_worker, size_t high_watermark = 1 << 14,
+        size_t low_watermark = 1 << 12,
+        ShedPolicy policy = ShedPolicy::DropOldest);
+    ~ElasticOrderedRunner();
+    void RunPrologue(Prologue prologue) override;
+    void RunEpilogue(Epilogue epilogue) override {
+        this->epilogue = std::move(epilogue);
+    }
+    // queued under one lock, never shed, so it is for bursts of protocol
+    // messages only
+    void RunPrologueBatch(Prologue *prologues, int n_prologue) override;
+    void RunSheddablePrologue(
+        Prologue prologue, Epilogue on_shed = nullptr) override;
+    // queued under one lock, each admitted or shed as if submitted alone
+    void RunSheddablePrologueBatch(
+        Prologue *prologues, Epilogue *on_shed, int n_prologue) override;
+    Stats GetStats() const;
+
+private:
+    struct Task {
+        Prologue prologue; // empty after shed
+        Epilogue on_shed;
+        bool sheddable;
+    };
+
+    static const int N_WORKER_MAX = 128;
+    int n_worker;
+    std::thread workers[N_WORKER_MAX];
+    std::atomic<bool> shutdown;
+
+    const size_t high_watermark, low_watermark;
+    const ShedPolicy policy;
+
+    mutable std::mutex queue_mutex;
+    // task i (counting all submitted) is queue[i - queue_offset]
+    std::deque<Task> queue;
+    uint64_t queue_offset;
+    // ids of queued sheddable tasks in submit order, may include tasks that
+    // have been dequeued already
+    std::deque<uint64_t> sheddable_ids;
+    bool is_overloaded;
+    std::atomic<uint64_t> n_queued, n_in_flight, n_admitted, n_shed,
+        n_overloaded;
+
+    uint64_t next_prologue; // protected by queue_mutex
+    std::atomic<uint64_t> next_solo;
+    Epilogue epilogue;
+    // idle threads park instead of spinning, see `Parker::SetSpinBudget`.
+    // Idle workers share idle_parker, which every submit wakes. At most
+    // n_worker prologues are in flight, so prologue i waits for its solo turn
+    // on the parker of worker solo_owner[i % n_worker]
+    Parker idle_parker;
+    Parker worker_parkers[N_WORKER_MAX];
+    std::atomic<int> solo_owner[N_WORKER_MAX];
+
+    void Submit(Task task);
+    // must hold queue_mutex, queue the task or shed it or an older one, and
+    // return the `on_shed` to call after unlocking
+    Epilogue Admit(Task task);
+    Epilogue ShedOldest();
+    bool Dequeue(Prologue &prologue, uint64_t &prologue_id);
+    void RunWorkerThread(int id);
+};
+
+// ordered, driver thread puts prologues in a ring of task slots and deals
+// their ids round robin to workers. Each worker moves the ids dealt to it into
+// its own Chase-Lev deque, pops from there and steals from the others when it
+// runs dry, and parks when there is nothing to take. Finished prologues leave
+// their solos in their slots, and whichever worker finds the next solo in turn
+// ready claims the turn and runs it, so no worker ever waits for a turn.
+// Nothing is allocated per prologue. The driver waits when the ring is full,
+// i.e. `N_SLOT` prologues ahead of the solo turn
+class WorkStealingRunner : public Runner {
+public:
+    WorkStealingRunner(int n_worker);
+    ~WorkStealingRunner();
+    void RunPrologue(Prologue prologue) override;
+    void RunEpilogue(Epilogue epilogue) override {
+        this->epilogue = std::move(epilogue);
+    }
+
+private:
+    static const int N_WORKER_MAX = 128;
+    static const int N_SLOT = 1024;
+
+    // task of id `id` is in slot `id % N_SLOT`, whose sequence numbers are
+    // `id + 1` once the driver has put the prologue and once the solo is
+    // ready respectively
+    struct Slot {
+        Prologue prologue;
+        Solo solo;
+        std::atomic<uint64_t> published, ready;
+        Slot() : published(0), ready(0) {}
+    };
+
+    int n_worker;
+    std::thread workers[N_WORKER_MAX];
+    std::unique_ptr<Slot[]> slots;
+    // owned by workers, capacity covers every slot so they never grow
+    std::unique_ptr<WorkStealingDeque<uint64_t>[]> deques;
+    std::atomic<bool> shutdown;
+    Parker driver_parker;
+    Parker worker_parkers[N_WORKER_MAX];
+
+    uint64_t next_prologue; // driver only
+    // id of the next solo shifted by one, low bit set while a worker runs it
+    std::atomic<uint64_t> solo_turn;
+    Epilogue epilogue;
+
+    bool Published(uint64_t id) const {
+        return slots[id % N_SLOT].published.load(std::memory_order_acquire) ==
+               id + 1;
+    }
+    // `next_dealt` is the next id dealt to worker `id`
+    bool Take(int id, uint64_t &next_dealt, uint64_t &task_id);
+    bool Stealable(int id) const;
+    void RunSolos(int id);
+    void RunWorkerThread(int id);
+};
+
+// runner with ordered solos by name, for binaries that let user choose:
+// ctpl (CTPLOrderedRunner), spin (SpinOrderedRunner),
+// elastic (ElasticOrderedRunner), worksteal (WorkStealingRunner)
+// panic on unknown name; only spin has solo lanes, others ignore `n_lane`
+std::unique_ptr<Runner> CreateOrderedRunner(
+    const std::string &name, int n_worker, int n_lane = 1);
+
+} // namespace dsnet
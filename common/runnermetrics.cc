@@ -0,0 +1,145 @@
+#include "common/runnermetrics.h"
+#include "lib/latency.h"
+#include "lib/message.h"
+
+#include <algorithm>
+#include <cinttypes>
+#include <cstring>
+#include <mutex>
+#include <thread>
+
+namespace dsnet {
+
+using std::string;
+using std::vector;
+
+static std::mutex registry_mutex;
+static vector<const RunnerMetrics *> registry;
+
+// rdtsc ticks at a constant rate on every cpu we care about, measure it
+// against steady_clock once
+static double NsPerCycle() {
+    static const double ns_per_cycle = [] {
+#if defined(NRUNNER_METRICS) ||                                                \
+    !(defined(__x86_64__) || defined(__i386__))
+        return 1.0;
+#else
+        using namespace std::chrono;
+        auto begin = steady_clock::now();
+        uint64_t begin_cycle = RunnerMetrics::Now();
+        std::this_thread::sleep_for(milliseconds(10));
+        uint64_t cycles = RunnerMetrics::Now() - begin_cycle;
+        double ns = duration_cast<nanoseconds>(steady_clock::now() - begin)
+                        .count();
+        return cycles == 0 ? 1.0 : ns / cycles;
+#endif
+    }();
+    return ns_per_cycle;
+}
+
+RunnerMetrics::RunnerMetrics(const string &name, int n_thread)
+    : name(name), n_thread(n_thread), slots(new Slot[n_thread]) {
+    for (int i = 0; i < n_thread; i += 1) {
+        for (int event = 0; event < N_EVENT; event += 1) {
+            slots[i].count[event] = 0;
+            slots[i].cycles[event] = 0;
+            for (int bucket = 0; bucket < N_BUCKET; bucket += 1) {
+                slots[i].buckets[event][bucket] = 0;
+            }
+        }
+    }
+    std::lock_guard<std::mutex> lock(registry_mutex);
+    registry.push_back(this);
+}
+
+RunnerMetrics::~RunnerMetrics() {
+    std::lock_guard<std::mutex> lock(registry_mutex);
+    registry.erase(std::find(registry.begin(), registry.end(), this));
+}
+
+const char *RunnerMetrics::EventName(Event event) {
+    static const char *names[N_EVENT] = {
+        "driver_spin", "prologue_spin", "solo_spin",
+        "prologue",    "solo",          "epilogue",
+    };
+    return names[event];
+}
+
+void RunnerMetrics::Histogram::Add(const Histogram &other) {
+    count += other.count;
+    cycles += other.cycles;
+    for (int i = 0; i < N_BUCKET; i += 1) {
+        buckets[i] += other.buckets[i];
+    }
+}
+
+uint64_t RunnerMetrics::Histogram::Percentile(double p) const {
+    uint64_t accum = 0;
+    for (int i = 0; i < N_BUCKET; i += 1) {
+        accum += buckets[i];
+        if (accum > 0 && accum >= p * count) {
+            return (uint64_t)1 << i;
+        }
+    }
+    return (uint64_t)1 << (N_BUCKET - 1);
+}
+
+RunnerMetrics::Snapshot RunnerMetrics::Take() const {
+    Snapshot snapshot;
+    snapshot.name = name;
+    snapshot.n_thread = n_thread;
+    snapshot.ns_per_cycle = NsPerCycle();
+    snapshot.histograms.resize(n_thread * N_EVENT);
+    for (int i = 0; i < n_thread; i += 1) {
+        for (int event = 0; event < N_EVENT; event += 1) {
+            const Slot &slot = slots[i];
+            Histogram &histogram = snapshot.histograms[i * N_EVENT + event];
+            histogram.count = slot.count[event].load(std::memory_order_relaxed);
+            histogram.cycles =
+                slot.cycles[event].load(std::memory_order_relaxed);
+            for (int bucket = 0; bucket < N_BUCKET; bucket += 1) {
+                histogram.buckets[bucket] =
+                    slot.buckets[event][bucket].load(std::memory_order_relaxed);
+            }
+        }
+    }
+    return snapshot;
+}
+
+vector<RunnerMetrics::Snapshot> RunnerMetrics::TakeAll() {
+    vector<Snapshot> snapshots;
+    std::lock_guard<std::mutex> lock(registry_mutex);
+    for (const RunnerMetrics *metrics : registry) {
+        snapshots.push_back(metrics->Take());
+    }
+    return snapshots;
+}
+
+RunnerMetrics::Histogram RunnerMetrics::Snapshot::Total(Event event) const {
+    Histogram total;
+    std::memset(&total, 0, sizeof(total));
+    for (int i = 0; i < n_thread; i += 1) {
+        total.Add(At(i, event));
+    }
+    return total;
+}
+
+void RunnerMetrics::Snapshot::Dump() const {
+    char buf[4][64];
+    for (int event = 0; event < N_EVENT; event += 1) {
+        Histogram total = Total((Event)event);
+        if (total.count == 0) {
+            continue;
+        }
+        QNotice(
+            "RUNNER %s %s: %s avg, %s p50, %s p99 (%" PRIu64
+            " samples, %s total)",
+            name.c_str(), EventName((Event)event),
+            LatencyFmtNS(total.cycles / total.count * ns_per_cycle, buf[0]),
+            LatencyFmtNS(total.Percentile(0.5) * ns_per_cycle, buf[1]),
+            LatencyFmtNS(total.Percentile(0.99) * ns_per_cycle, buf[2]),
+            total.count, LatencyFmtNS(total.cycles * ns_per_cycle, buf[3]));
+    }
+}
+
+} // namespace dsnet
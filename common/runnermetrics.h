@@ -0,0 +1,119 @@
+#pragma once
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+
+namespace dsnet {
+
+// Per-thread counters and cycle histograms of a Runner. Each thread records
+// into its own slot with plain relaxed stores (one writer per slot), and slots
+// are padded apart, so recording takes two rdtsc and touches no shared cache
+// line. Any thread may Take() a snapshot while the runner is running; the
+// snapshot is not atomic across counters, it may miss the tasks in progress.
+//
+// Slot 0 belongs to the driver thread i.e. the one calling RunPrologue, and
+// worker threads follow. Build with RUNNER_METRICS=0 (-DNRUNNER_METRICS) to
+// compile recording out and measure its overhead.
+class RunnerMetrics {
+public:
+    enum Event {
+        DriverSpin,   // driver waits to hand off a prologue
+        PrologueSpin, // worker waits for a prologue
+        SoloSpin,     // worker waits for its solo turn
+        Prologue,
+        Solo,
+        Epilogue,
+        N_EVENT
+    };
+    // bucket i counts durations in [2^(i-1), 2^i) cycles, the last one also
+    // everything longer
+    static const int N_BUCKET = 40;
+
+    struct Histogram {
+        uint64_t count, cycles;
+        uint64_t buckets[N_BUCKET];
+
+        void Add(const Histogram &other);
+        // upper bound of the bucket containing the p-th (0 to 1) duration
+        uint64_t Percentile(double p) const;
+    };
+
+    struct Snapshot {
+        std::string name;
+        int n_thread;
+        double ns_per_cycle;
+        std::vector<Histogram> histograms; // [thread * N_EVENT + event]
+
+        const Histogram &At(int thread, Event event) const {
+            return histograms[thread * N_EVENT + event];
+        }
+        Histogram Total(Event event) const;
+        // one Notice line per event that has any sample
+        void Dump() const;
+    };
+
+    RunnerMetrics(const std::string &name, int n_thread);
+    ~RunnerMetrics();
+
+    // timestamp in cycles, or 0 when compiled out
+    static uint64_t Now() {
+#ifdef NRUNNER_METRICS
+        return 0;
+#elif defined(__x86_64__) || defined(__i386__)
+        return __rdtsc();
+#else
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(
+                   std::chrono::steady_clock::now().time_since_epoch())
+            .count();
+#endif
+    }
+
+    // record an event of thread that started at `start` and ends now
+    void Record(int thread, Event event, uint64_t start) {
+#ifndef NRUNNER_METRICS
+        uint64_t cycles = Now() - start;
+        Slot &slot = slots[thread];
+        Increase(slot.count[event], 1);
+        Increase(slot.cycles[event], cycles);
+        Increase(slot.buckets[event][Bucket(cycles)], 1);
+#endif
+    }
+
+    Snapshot Take() const;
+    // snapshots of every live RunnerMetrics in the process
+    static std::vector<Snapshot> TakeAll();
+    static const char *EventName(Event event);
+
+private:
+    struct Slot {
+        std::atomic<uint64_t> count[N_EVENT], cycles[N_EVENT];
+        std::atomic<uint64_t> buckets[N_EVENT][N_BUCKET];
+        // slots are only 16-byte aligned, keep the next one off our last line
+        char padding[64];
+    };
+
+    const std::string name;
+    const int n_thread;
+    std::unique_ptr<Slot[]> slots;
+
+    static void Increase(std::atomic<uint64_t> &counter, uint64_t value) {
+        counter.store(
+            counter.load(std::memory_order_relaxed) + value,
+            std::memory_order_relaxed);
+    }
+    static int Bucket(uint64_t cycles) {
+        if (cycles == 0) {
+            return 0;
+        }
+        int bucket = 64 - __builtin_clzll(cycles);
+        return bucket < N_BUCKET ? bucket : N_BUCKET - 1;
+    }
+};
+
+} // namespace dsnet
@@ -2,10 +2,14 @@
 #include "lib/assert.h"
 #include "lib/message.h"
 
+#include <atomic>
 #include <cstring>
+#include <memory>
+#include <mutex>
 #include <openssl/sha.h>
-#include <secp256k1.h>
 
+using std::memcmp;
+using std::memcpy;
 using std::memset;
 using std::strcmp;
 using std::strcpy;
@@ -14,30 +18,100 @@ using std::string;
 namespace dsnet {
 
 static const int IDENTIFIER_LENGTH_MAX = 8; // include ending \0
-static const int SIGNED_LAYER_LENGTH = IDENTIFIER_LENGTH_MAX + 64;
 
-static const unsigned char STEVE_SECKEY[] = {
-    0x53, 0x74, 0x65, 0x76, 0x65, 0x00, 0x00, 0x00, // print "Steve" as C string
-    0x00, 0x11, 0x22, 0x33, 0x44, 0x55, 0x66, 0x77, 0x88, 0x99, 0xaa, 0xbb,
-    0xcc, 0xdd, 0xee, 0xff, 0x01, 0x23, 0x45, 0x67, 0x89, 0xab, 0xcd, 0xef,
+// direct mapped table of verified (digest, authenticator, identifier,
+// verifier), split into shards to keep workers verifying different messages
+// off each other's lock. Authenticators are kept as their SHA256, which is
+// cheap next to verifying them
+class VerifyCache {
+public:
+    struct Entry {
+        unsigned char digest[SHA256_DIGEST_LENGTH];
+        unsigned char auth_digest[SHA256_DIGEST_LENGTH];
+        char identifier[IDENTIFIER_LENGTH_MAX], verifier[IDENTIFIER_LENGTH_MAX];
+        Entry() { memset(this, 0, sizeof(Entry)); }
+    };
+
+    std::atomic<uint64_t> hit, miss;
+
+    explicit VerifyCache(size_t n_entry) : hit(0), miss(0) { Resize(n_entry); }
+
+    void Resize(size_t n_entry) {
+        shards.reset(n_entry == 0 ? nullptr : new Shard[N_SHARD]);
+        for (size_t i = 0; n_entry != 0 && i < N_SHARD; i += 1) {
+            shards[i].entries.assign((n_entry + N_SHARD - 1) / N_SHARD, Entry());
+        }
+    }
+
+    // returns false if cache is disabled or the message is not cacheable
+    bool MakeKey(
+        const string &digest, const unsigned char *auth, size_t auth_size,
+        const string &identifier, const string &verifier, Entry &key) const {
+        if (!shards || identifier.size() >= IDENTIFIER_LENGTH_MAX ||
+            verifier.size() >= IDENTIFIER_LENGTH_MAX) {
+            return false;
+        }
+        digest.copy((char *)key.digest, SHA256_DIGEST_LENGTH);
+        SHA256(auth, auth_size, key.auth_digest);
+        identifier.copy(key.identifier, identifier.size());
+        verifier.copy(key.verifier, verifier.size());
+        return true;
+    }
+
+    bool Lookup(const Entry &key) {
+        Shard &shard = GetShard(key);
+        bool found;
+        {
+            std::lock_guard<std::mutex> lock(shard.mutex);
+            found = memcmp(&GetEntry(shard, key), &key, sizeof(Entry)) == 0;
+        }
+        (found ? hit : miss).fetch_add(1, std::memory_order_relaxed);
+        return found;
+    }
+
+    void Insert(const Entry &key) {
+        Shard &shard = GetShard(key);
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        GetEntry(shard, key) = key;
+    }
+
+private:
+    static const size_t N_SHARD = 64;
+
+    struct Shard {
+        std::mutex mutex;
+        std::vector<Entry> entries;
+    };
+    std::unique_ptr<Shard[]> shards;
+
+    static uint64_t Index(const Entry &key) {
+        uint64_t index;
+        memcpy(&index, key.digest, sizeof(index));
+        return index;
+    }
+    Shard &GetShard(const Entry &key) {
+        return shards[Index(key) % N_SHARD];
+    }
+    static Entry &GetEntry(Shard &shard, const Entry &key) {
+        return shard.entries[Index(key) / N_SHARD % shard.entries.size()];
+    }
 };
-static __thread const secp256k1_pubkey *STEVE_PUBKEY;
-static __thread secp256k1_context *PROTO_CTX_SIGN = nullptr,
-                                  *PROTO_CTX_VERIFY = nullptr;
+
+static VerifyCache VERIFY_CACHE(1 << 16);
+
+void SignedAdapter::SetVerifyCacheSize(size_t entries) {
+    VERIFY_CACHE.Resize(entries);
+}
+
+SignedAdapter::VerifyCacheStats SignedAdapter::GetVerifyCacheStats() {
+    return {VERIFY_CACHE.hit.load(), VERIFY_CACHE.miss.load()};
+}
 
 SignedAdapter::SignedAdapter(
     Message &inner_message, const string identifier, bool sign)
-    : inner_message(inner_message), identifier(sign ? identifier : "Alex") {
-    if (PROTO_CTX_SIGN != nullptr) {
-        return;
-    }
-    PROTO_CTX_SIGN = secp256k1_context_create(SECP256K1_CONTEXT_SIGN);
-    PROTO_CTX_VERIFY = secp256k1_context_create(SECP256K1_CONTEXT_VERIFY);
-    STEVE_PUBKEY = new secp256k1_pubkey;
-    int code = secp256k1_ec_pubkey_create(
-        PROTO_CTX_SIGN, (secp256k1_pubkey *)STEVE_PUBKEY, STEVE_SECKEY);
-    ASSERT(code);
-}
+    : inner_message(inner_message), identifier(sign ? identifier : "Alex"),
+      verifier(identifier), identity(nullptr), is_verified(false),
+      pending(false) {}
 
 Message *SignedAdapter::Clone() const {
     SignedAdapter *message = new SignedAdapter(inner_message, identifier);
@@ -53,47 +127,110 @@ size_t SignedAdapter::SerializedSize() const {
     if (identifier == "Alex") {
         return inner_message.SerializedSize() + IDENTIFIER_LENGTH_MAX;
     }
-    return inner_message.SerializedSize() + SIGNED_LAYER_LENGTH;
+    const Identity *identity = KeyRegistry::Find(identifier);
+    if (identity == nullptr) {
+        Panic("Unknown identifier: %s", identifier.c_str());
+    }
+    return inner_message.SerializedSize() + IDENTIFIER_LENGTH_MAX +
+           identity->AuthSize();
 }
 
 void SignedAdapter::Parse(const void *buf, size_t size) {
+    if (ParseDigest(buf, size)) {
+        ParseVerify(buf, size);
+    }
+}
+
+bool SignedAdapter::ParseBatch(
+    SignedAdapter *adapters, const TransportBuffer *buffers, size_t n) {
+    for (size_t i = 0; i < n; i += 1) {
+        adapters[i].pending =
+            adapters[i].ParseDigest(buffers[i].data(), buffers[i].size());
+    }
+    for (size_t i = 0; i < n; i += 1) {
+        if (adapters[i].pending) {
+            adapters[i].ParseVerify(buffers[i].data(), buffers[i].size());
+        }
+        if (!adapters[i].is_verified) {
+            for (size_t j = i + 1; j < n; j += 1) {
+                adapters[j].is_verified = false;
+            }
+            return false;
+        }
+    }
+    return true;
+}
+
+bool SignedAdapter::PeekInner(
+    const void *buf, size_t size, const void *&inner, size_t &inner_size) {
     const char *buf_id = (const char *)buf;
-    const unsigned char *buf_sig =
-        ((const unsigned char *)buf) + IDENTIFIER_LENGTH_MAX;
-    const unsigned char *buf_inner =
-        ((const unsigned char *)buf) + SIGNED_LAYER_LENGTH;
-    size_t inner_size = size - SIGNED_LAYER_LENGTH;
+    if (size < IDENTIFIER_LENGTH_MAX ||
+        buf_id[IDENTIFIER_LENGTH_MAX - 1] != '\0') {
+        return false;
+    }
+    size_t layer_size = IDENTIFIER_LENGTH_MAX;
+    if (string(buf_id) != "Alex") {
+        const Identity *identity = KeyRegistry::Find(buf_id);
+        if (identity == nullptr) {
+            return false;
+        }
+        layer_size += identity->AuthSize();
+    }
+    if (size < layer_size) {
+        return false;
+    }
+    inner = buf_id + layer_size;
+    inner_size = size - layer_size;
+    return true;
+}
 
-    if (buf_id[IDENTIFIER_LENGTH_MAX - 1] != '\0') {
-        is_verified = false;
-        return;
+bool SignedAdapter::ParseDigest(const void *buf, size_t size) {
+    const char *buf_id = (const char *)buf;
+
+    is_verified = false;
+    if (size < IDENTIFIER_LENGTH_MAX ||
+        buf_id[IDENTIFIER_LENGTH_MAX - 1] != '\0') {
+        return false;
     }
     identifier.assign(buf_id);
     if (identifier == "Alex") {
         ParseNoVerify(buf, size);
-        return;
+        return false;
     }
-
-    const secp256k1_pubkey *pubkey;
-    if (identifier == "Steve") {
-        pubkey = STEVE_PUBKEY;
-    } else {
-        NOT_IMPLEMENTED();
+    identity = KeyRegistry::Find(identifier);
+    if (identity == nullptr ||
+        size < IDENTIFIER_LENGTH_MAX + identity->AuthSize()) {
+        return false;
     }
-    secp256k1_context *ctx = PROTO_CTX_VERIFY;
-    secp256k1_ecdsa_signature sig;
-    if (!secp256k1_ecdsa_signature_parse_compact(ctx, &sig, buf_sig)) {
-        is_verified = false;
-        return;
+
+    size_t layer_size = IDENTIFIER_LENGTH_MAX + identity->AuthSize();
+    digest.resize(SHA256_DIGEST_LENGTH);
+    SHA256(
+        (const unsigned char *)buf + layer_size, size - layer_size,
+        (unsigned char *)&digest[0]);
+    return true;
+}
+
+void SignedAdapter::ParseVerify(const void *buf, size_t size) {
+    const unsigned char *buf_auth =
+        ((const unsigned char *)buf) + IDENTIFIER_LENGTH_MAX;
+    size_t layer_size = IDENTIFIER_LENGTH_MAX + identity->AuthSize();
+
+    VerifyCache::Entry key;
+    bool cacheable = VERIFY_CACHE.MakeKey(
+        digest, buf_auth, identity->AuthSize(), identifier, verifier, key);
+    is_verified = cacheable && VERIFY_CACHE.Lookup(key);
+    if (!is_verified) {
+        is_verified = identity->Verify(
+            (const unsigned char *)digest.data(), buf_auth, verifier);
+        if (is_verified && cacheable) {
+            VERIFY_CACHE.Insert(key);
+        }
     }
-    unsigned char *digest =
-        SHA256(buf_inner, inner_size, new unsigned char[32]);
-    this->digest.assign((char *)digest, 32);
-    is_verified = secp256k1_ecdsa_verify(ctx, &sig, digest, pubkey) == 1;
-    delete[] digest;
     if (is_verified) {
-        inner_message.Parse(buf_inner, inner_size);
-        signature.assign((char *)buf_sig, 64);
+        inner_message.Parse(
+            (const unsigned char *)buf + layer_size, size - layer_size);
+        signature.assign((const char *)buf_auth, identity->AuthSize());
     }
 }
 
@@ -103,31 +240,22 @@ void SignedAdapter::Serialize(void *buf) const {
         return;
     }
 
+    const Identity *identity = KeyRegistry::Find(identifier);
+    if (identity == nullptr) {
+        Panic("Unknown identifier: %s", identifier.c_str());
+    }
     char *buf_id = (char *)buf;
-    unsigned char *buf_sig = ((unsigned char *)buf) + IDENTIFIER_LENGTH_MAX;
-    unsigned char *buf_inner = ((unsigned char *)buf) + SIGNED_LAYER_LENGTH;
+    unsigned char *buf_auth = ((unsigned char *)buf) + IDENTIFIER_LENGTH_MAX;
+    unsigned char *buf_inner = buf_auth + identity->AuthSize();
     inner_message.Serialize(buf_inner);
     size_t inner_size = inner_message.SerializedSize();
 
     memset(buf_id, 0, IDENTIFIER_LENGTH_MAX);
     ASSERT(identifier.size() < IDENTIFIER_LENGTH_MAX);
     identifier.copy(buf_id, identifier.size());
-    const unsigned char *seckey;
-    if (identifier == "Steve") {
-        seckey = STEVE_SECKEY;
-    } else {
-        NOT_IMPLEMENTED();
-    }
-    secp256k1_context *ctx = PROTO_CTX_SIGN;
-    unsigned char *digest =
-        SHA256(buf_inner, inner_size, new unsigned char[32]);
-    secp256k1_ecdsa_signature sig;
-    int code =
-        secp256k1_ecdsa_sign(ctx, &sig, digest, seckey, nullptr, nullptr);
-    ASSERT(code);
-    delete[] digest;
-    code = secp256k1_ecdsa_signature_serialize_compact(ctx, buf_sig, &sig);
-    ASSERT(code);
+    unsigned char digest[SHA256_DIGEST_LENGTH];
+    SHA256(buf_inner, inner_size, digest);
+    identity->Sign(digest, buf_auth);
 }
 
 void SignedAdapter::ParseNoVerify(const void *buf, size_t size) {
@@ -135,11 +263,9 @@ void SignedAdapter::ParseNoVerify(const void *buf, size_t size) {
         ((const unsigned char *)buf) + IDENTIFIER_LENGTH_MAX;
     size_t inner_size = size - IDENTIFIER_LENGTH_MAX;
 
-    unsigned char *digest =
-        SHA256(buf_inner, inner_size, new unsigned char[32]);
-    this->digest.assign((char *)digest, 32);
+    digest.resize(SHA256_DIGEST_LENGTH);
+    SHA256(buf_inner, inner_size, (unsigned char *)&digest[0]);
     is_verified = true;
-    delete[] digest;
     inner_message.Parse(buf_inner, inner_size);
 }
 
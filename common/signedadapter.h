@@ -1,14 +1,21 @@
 #pragma once
+#include "common/keyregistry.h"
+#include "lib/assert.h"
 #include "lib/transport.h"
 
+#include <algorithm>
+#include <string>
+#include <vector>
+
 namespace dsnet {
 
 // Message with trusted content made by node with certain identifier.
 // Every node should get an identifier from (imagined) identity providing
 // service. The identifier should be fixed, binding to address for replicas or
 // client id for clients. Internal to SignedAdapter, each identifier is
-// associated with a secret key, which should be configured upon system start up
-// (WIP).
+// associated with a key in KeyRegistry, which is loaded from configuration upon
+// system start up. The key's scheme decides what follows the identifier in
+// serialized message: a signature, or a vector of MACs.
 class SignedAdapter : public Message {
 public:
     Message *Clone() const override;
@@ -24,7 +31,9 @@ public:
     // send to each other to eliminate signature overhead
     // sign = false will override identifier with "Alex", which make the code
     // looks more reasonable
-    // identifier and sign are ignored during Parse()
+    // during Parse() sign is ignored, and identifier names the receiver, which
+    // picks the entry to check from a MAC vector. Messages from identifier
+    // unknown to KeyRegistry are not verified
     SignedAdapter(
         Message &inner_message, std::string identifier, bool sign = true);
 
@@ -35,13 +44,101 @@ public:
     const std::string &Signature() const { return signature; }
     const std::string &Digest() const { return digest; }
 
+    // Parse() for a batch of messages received together, e.g. the client
+    // requests carried by one proposal: adapters[i] parses buffers[i]. All
+    // contents are hashed back to back before any signature is checked.
+    // Returns true if every message is verified. Stops at the first message
+    // that fails, leaving the rest unverified.
+    static bool ParseBatch(
+        SignedAdapter *adapters, const TransportBuffer *buffers, size_t n);
+    static bool ParseBatch(
+        std::vector<SignedAdapter> &adapters,
+        const std::vector<TransportBuffer> &buffers) {
+        ASSERT(adapters.size() == buffers.size());
+        return ParseBatch(adapters.data(), buffers.data(), adapters.size());
+    }
+
+    // the serialized inner message of buf without verifying it, e.g. to tell
+    // its type before paying for verification. Returns false if buf is
+    // malformed or made by an unknown identifier
+    static bool PeekInner(
+        const void *buf, size_t size, const void *&inner, size_t &inner_size);
+
+    // Parse() remembers the messages that pass verification in a bounded
+    // cache shared by all threads, and trusts the same content with the same
+    // signature from the same identifier (and to the same receiver for MAC
+    // vectors) without checking again, e.g. when a backup sees a client
+    // request both on its own and inside a proposal.
+    // entries = 0 disables the cache. Not thread safe, call before Parse()
+    static void SetVerifyCacheSize(size_t entries);
+    struct VerifyCacheStats {
+        uint64_t hit, miss;
+    };
+    static VerifyCacheStats GetVerifyCacheStats();
+
 private:
     Message &inner_message;
     std::string identifier, signature, digest;
+    const std::string verifier;
+    const Identity *identity;
     bool is_verified;
+    // ParseBatch() still has to check the signature
+    bool pending;
 
+    // the two stages of Parse(), ParseBatch() runs each of them over the
+    // whole batch in turn
+    // returns false if done already, i.e. message is unsigned or malformed
+    bool ParseDigest(const void *buf, size_t size);
+    void ParseVerify(const void *buf, size_t size);
     void ParseNoVerify(const void *buf, size_t size);
     void SerializeNoSign(void *buf) const;
 };
 
+// Storage of ParseBatch() over messages of type MSG, kept from one batch to
+// the next. A thread_local instance verifies batches without allocating once
+// it has seen one as large, e.g. the client requests of every proposal.
+template <typename MSG, typename WRAPPER> class SignedBatch {
+public:
+    // parses buffers[i] into Message(i) for every i < buffers.size(), see
+    // ParseBatch()
+    template <typename BUFFERS>
+    bool Parse(const std::string &verifier, const BUFFERS &buffers) {
+        size_t n = buffers.size();
+        if (n > messages.size() || verifier != this->verifier) {
+            Reset(verifier, std::max(n, messages.size()));
+        }
+        transport_buffers.clear();
+        for (const std::string &buffer : buffers) {
+            transport_buffers.emplace_back(
+                buffer.data(), buffer.size(), nullptr, nullptr);
+        }
+        return SignedAdapter::ParseBatch(
+            adapters.data(), transport_buffers.data(), n);
+    }
+
+    MSG &Message(size_t i) { return messages[i]; }
+    const SignedAdapter &Adapter(size_t i) const { return adapters[i]; }
+
+private:
+    std::string verifier;
+    std::vector<MSG> messages;
+    std::vector<WRAPPER> wrappers;
+    std::vector<SignedAdapter> adapters;
+    std::vector<TransportBuffer> transport_buffers;
+
+    // adapters refer to wrappers, which refer to messages
+    void Reset(const std::string &verifier, size_t n) {
+        this->verifier = verifier;
+        adapters.clear();
+        wrappers.clear();
+        messages.resize(n);
+        wrappers.reserve(n);
+        adapters.reserve(n);
+        for (size_t i = 0; i < n; i += 1) {
+            wrappers.emplace_back(messages[i]);
+            adapters.emplace_back(wrappers[i], verifier);
+        }
+    }
+};
+
 } // namespace dsnet
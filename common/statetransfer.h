@@ -0,0 +1,104 @@
+#pragma once
+#include "lib/viewstamp.h"
+
+#include <algorithm>
+#include <vector>
+
+namespace dsnet {
+
+// Fetching side of state transfer. A replica that finds itself behind, e.g.
+// it sees a commit certificate for ops it never received, fetches the
+// missing numbers up to `target` from one other replica, in chunks of
+// CHUNK_SIZE and with up to WINDOW chunks in flight, so catching up is bound
+// by bandwidth instead of round trips. The replica keeps handling (and
+// buffering) normal traffic meanwhile, so the gap may be filled from either
+// side; `applied` below is always what the replica has in place
+// contiguously, and a chunk that arrives early is buffered by the replica
+// until it is its turn, like out-of-order normal messages.
+//
+// If `Retry` finds no progress since its last call, the transfer restarts
+// from `applied` with the next replica as source, which covers lost chunks
+// as well as a slow or faulty source.
+//
+// Numbers are op numbers for PBFT and HotStuff, and primary UIs for MinBFT.
+// Not thread safe, owned by the replica state i.e. only touched in solo.
+class StateTransfer {
+public:
+    static const opnum_t CHUNK_SIZE = 64;
+    static const opnum_t WINDOW = 4;
+
+    struct Range {
+        opnum_t first, last;
+    };
+
+    StateTransfer(int n_replica, int replica_id)
+        : n_replica(n_replica), replica_id(replica_id), source(-1),
+          target(0), requested(0), last_applied(NO_APPLIED) {}
+
+    bool Active() const { return target != 0; }
+    int Source() const { return source; }
+    opnum_t Target() const { return target; }
+
+    // `source` has everything up to `target`; false if that is covered by
+    // the ongoing transfer already, otherwise send what `Next` returns
+    bool Start(opnum_t target, int source) {
+        if (target <= this->target) {
+            return false;
+        }
+        if (!Active()) {
+            this->source = source != replica_id ? source : NextSource(source);
+            requested = 0;
+            last_applied = NO_APPLIED;
+        }
+        this->target = target;
+        return true;
+    }
+
+    // ranges to request now that everything up to `applied` is in place,
+    // empty (and the transfer is done) once `applied` reaches the target
+    std::vector<Range> Next(opnum_t applied) {
+        std::vector<Range> ranges;
+        if (!Active()) {
+            return ranges;
+        }
+        if (applied >= target) {
+            target = 0;
+            return ranges;
+        }
+        requested = std::max(requested, applied);
+        while (requested < target &&
+               requested - applied < WINDOW * CHUNK_SIZE) {
+            Range range{
+                requested + 1, std::min(requested + CHUNK_SIZE, target)};
+            requested = range.last;
+            ranges.push_back(range);
+        }
+        return ranges;
+    }
+
+    // call periodically while active; ranges to request again if the
+    // transfer has stalled since last call
+    std::vector<Range> Retry(opnum_t applied) {
+        if (!Active() || applied != last_applied) {
+            last_applied = applied;
+            return std::vector<Range>();
+        }
+        source = NextSource(source);
+        requested = applied;
+        return Next(applied);
+    }
+
+private:
+    static const opnum_t NO_APPLIED = ~opnum_t(0);
+
+    int n_replica, replica_id;
+    int source;
+    opnum_t target, requested, last_applied;
+
+    int NextSource(int source) const {
+        source = (source + 1) % n_replica;
+        return source != replica_id ? source : (source + 1) % n_replica;
+    }
+};
+
+} // namespace dsnet
@@ -0,0 +1,127 @@
+#pragma once
+#include <atomic>
+#include <cstdint>
+#include <type_traits>
+#include <vector>
+
+namespace dsnet {
+
+// Chase-Lev work stealing deque, as formalized for C11 atomics by Le et al.
+// (PPoPP '13), of trivially copyable T held by value, e.g. indices into a
+// ring of tasks kept by the caller. Only the owner thread Push() and Pop() at
+// bottom, so it takes the newest item, and any thread Steal() from top, so
+// items are stolen in the order they are pushed. The buffer doubles when
+// full, which never happens if capacity covers the items in flight. Retired
+// buffers are kept until destruction because thieves may still be reading
+// them.
+template <typename T> class WorkStealingDeque {
+    static_assert(
+        std::is_trivially_copyable<T>::value,
+        "thieves may copy an item that is taken meanwhile");
+
+public:
+    explicit WorkStealingDeque(int64_t capacity = 1024) : top(0), bottom(0) {
+        buffers.emplace_back(new Buffer(capacity));
+        buffer.store(buffers.back(), std::memory_order_relaxed);
+    }
+    ~WorkStealingDeque() {
+        for (Buffer *retired : buffers) {
+            delete retired;
+        }
+    }
+
+    void Push(T item) {
+        int64_t b = bottom.load(std::memory_order_relaxed);
+        int64_t t = top.load(std::memory_order_acquire);
+        Buffer *a = buffer.load(std::memory_order_relaxed);
+        if (b - t > a->capacity - 1) {
+            a = a->Grow(b, t);
+            buffers.push_back(a);
+            buffer.store(a, std::memory_order_relaxed);
+        }
+        a->Put(b, item);
+        // a release store rather than the paper's fence, which race
+        // detectors do not follow
+        bottom.store(b + 1, std::memory_order_release);
+    }
+
+    // false if empty
+    bool Pop(T &item) {
+        int64_t b = bottom.load(std::memory_order_relaxed) - 1;
+        Buffer *a = buffer.load(std::memory_order_relaxed);
+        bottom.store(b, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        int64_t t = top.load(std::memory_order_relaxed);
+        if (t > b) {
+            bottom.store(b + 1, std::memory_order_relaxed);
+            return false;
+        }
+        item = a->Get(b);
+        bool taken = true;
+        if (t == b) {
+            // last item, race against thieves
+            taken = top.compare_exchange_strong(
+                t, t + 1, std::memory_order_seq_cst,
+                std::memory_order_relaxed);
+            bottom.store(b + 1, std::memory_order_relaxed);
+        }
+        return taken;
+    }
+
+    // false if empty, or lost the race to another thief or the owner
+    bool Steal(T &item) {
+        int64_t t = top.load(std::memory_order_acquire);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        int64_t b = bottom.load(std::memory_order_acquire);
+        if (t >= b) {
+            return false;
+        }
+        Buffer *a = buffer.load(std::memory_order_acquire);
+        T copy = a->Get(t);
+        if (!top.compare_exchange_strong(
+                t, t + 1, std::memory_order_seq_cst,
+                std::memory_order_relaxed)) {
+            return false;
+        }
+        item = copy;
+        return true;
+    }
+
+    bool Empty() const {
+        return top.load(std::memory_order_acquire) >=
+               bottom.load(std::memory_order_acquire);
+    }
+
+private:
+    struct Buffer {
+        int64_t capacity; // power of 2
+        std::atomic<T> *items;
+
+        explicit Buffer(int64_t capacity)
+            : capacity(capacity), items(new std::atomic<T>[capacity]) {}
+        ~Buffer() { delete[] items; }
+        T Get(int64_t i) const {
+            return items[i & (capacity - 1)].load(std::memory_order_relaxed);
+        }
+        void Put(int64_t i, T item) {
+            items[i & (capacity - 1)].store(item, std::memory_order_relaxed);
+        }
+        Buffer *Grow(int64_t b, int64_t t) const {
+            Buffer *grown = new Buffer(capacity * 2);
+            for (int64_t i = t; i < b; i += 1) {
+                grown->Put(i, Get(i));
+            }
+            return grown;
+        }
+    };
+
+    // keep top and bottom on their own cache lines, thieves hammer top
+    std::atomic<int64_t> top;
+    char top_padding[64 - sizeof(std::atomic<int64_t>)];
+    std::atomic<int64_t> bottom;
+    char bottom_padding[64 - sizeof(std::atomic<int64_t>)];
+    std::atomic<Buffer *> buffer;
+    std::vector<Buffer *> buffers; // owner only
+};
+
+} // namespace dsnet
@@ -2,7 +2,7 @@ d := $(dir $(lastword $(MAKEFILE_LIST)))
 
 SRCS += $(addprefix $(d), \
 	lookup3.cc message.cc memory.cc \
-	latency.cc configuration.cc transport.cc udptransport.cc dpdktransport.cc simtransport.cc)
+	latency.cc configuration.cc cpuplacement.cc transport.cc timerwheel.cc reassembler.cc udpsocket.cc udptransport.cc iouringtransport.cc dpdktransport.cc simtransport.cc)
 
 PROTOS += $(addprefix $(d), \
           latency-format.proto)
@@ -20,10 +20,22 @@ $(o)latency.o: $(o)latency-format.o
 
 LIB-configuration := $(o)configuration.o $(LIB-message)
 
+LIB-cpuplacement := $(o)cpuplacement.o $(LIB-message)
+
 LIB-transport := $(o)transport.o $(LIB-message) $(LIB-configuration)
 
+LIB-timerwheel := $(o)timerwheel.o $(LIB-message)
+
 LIB-simtransport := $(o)simtransport.o $(LIB-transport)
 
-LIB-udptransport := $(o)udptransport.o $(LIB-transport)
+LIB-reassembler := $(o)reassembler.o $(LIB-message)
+
+LIB-udpsocket := $(o)udpsocket.o $(LIB-message) $(LIB-configuration)
+
+LIB-udptransport := $(o)udptransport.o $(LIB-transport) $(LIB-timerwheel) \
+                    $(LIB-reassembler) $(LIB-udpsocket)
+
+LIB-iouringtransport := $(o)iouringtransport.o $(LIB-transport) \
+                        $(LIB-timerwheel) $(LIB-reassembler) $(LIB-udpsocket)
 
-LIB-dpdktransport := $(o)dpdktransport.o $(LIB-transport)
+LIB-dpdktransport := $(o)dpdktransport.o $(LIB-transport) $(LIB-timerwheel)
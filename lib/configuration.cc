@@ -41,6 +41,8 @@
 namespace dsnet {
 
 ReplicaAddress ParseReplicaAddress(const char *);
+KeyConfig ParseKeyConfig();
+MACKeyConfig ParseMACKeyConfig();
 
 ReplicaAddress::ReplicaAddress(const string &host, const string &port,
                                const string &dev)
@@ -83,9 +85,25 @@ ReplicaAddress::operator==(const ReplicaAddress &other) const {
            (dev == other.dev);
 }
 
+bool
+KeyConfig::operator==(const KeyConfig &other) const {
+    return (identifier == other.identifier) &&
+           (scheme == other.scheme) &&
+           (secret == other.secret);
+}
+
+bool
+MACKeyConfig::operator==(const MACKeyConfig &other) const {
+    return (sender == other.sender) &&
+           (receiver == other.receiver) &&
+           (secret == other.secret);
+}
+
 
 Configuration::Configuration(const Configuration &c)
-    : g(c.g), n(c.n), f(c.f), replicas_(c.replicas_), sequencers_(c.sequencers_)
+    : g(c.g), n(c.n), f(c.f), replicas_(c.replicas_), sequencers_(c.sequencers_),
+      keys_(c.keys_), mackeys_(c.mackeys_), macgroup_(c.macgroup_),
+      identities_(c.identities_)
 {
     multicast_ = c.multicast_ == nullptr ?
         nullptr :
@@ -154,6 +172,34 @@ Configuration::Configuration(std::ifstream &file)
             fc_ = new ReplicaAddress(ParseReplicaAddress("fc"));
         } else if (strcasecmp(cmd, "sequencer") == 0) {
             sequencers_.push_back(ParseReplicaAddress("sequencer"));
+        } else if (strcasecmp(cmd, "key") == 0) {
+            keys_.push_back(ParseKeyConfig());
+        } else if (strcasecmp(cmd, "mackey") == 0) {
+            mackeys_.push_back(ParseMACKeyConfig());
+        } else if (strcasecmp(cmd, "macgroup") == 0) {
+            char *arg;
+            while ((arg = strtok(nullptr, " \t")) != nullptr) {
+                macgroup_.push_back(string(arg));
+            }
+            if (macgroup_.empty()) {
+                Panic("'macgroup' configuration line requires an argument");
+            }
+        } else if (strcasecmp(cmd, "identity") == 0) {
+            char *id = strtok(nullptr, " \t");
+            char *identifier = strtok(nullptr, " \t");
+            if (!id || !identifier) {
+                Panic("Configuration line format: 'identity replica-id identifier'");
+            }
+            char *strtolPtr;
+            int replica_id = strtoul(id, &strtolPtr, 0);
+            if ((*id == '\0') || (*strtolPtr != '\0')) {
+                Panic("Invalid replica id to 'identity' configuration line");
+            }
+            // "Alex" is trusted without a signature, see SignedAdapter
+            if (strcmp(identifier, "Alex") == 0) {
+                Panic("Replica identity cannot be Alex");
+            }
+            identities_[replica_id] = string(identifier);
         } else {
             Panic("Unknown configuration directive: %s", cmd);
         }
@@ -219,6 +265,32 @@ Configuration::fc() const
     return fc_;
 }
 
+const std::vector<KeyConfig> &
+Configuration::keys() const
+{
+    return keys_;
+}
+
+const std::vector<MACKeyConfig> &
+Configuration::mackeys() const
+{
+    return mackeys_;
+}
+
+const std::vector<string> &
+Configuration::macgroup() const
+{
+    return macgroup_;
+}
+
+const string &
+Configuration::identity(int id) const
+{
+    static const string test_identity = "Steve";
+    auto it = identities_.find(id);
+    return it == identities_.end() ? test_identity : it->second;
+}
+
 int
 Configuration::QuorumSize() const
 {
@@ -238,6 +310,10 @@ Configuration::operator==(const Configuration &other) const
             (n != other.n) ||
             (f != other.f) ||
             (replicas_ != other.replicas_) ||
+            (keys_ != other.keys_) ||
+            (mackeys_ != other.mackeys_) ||
+            (macgroup_ != other.macgroup_) ||
+            (identities_ != other.identities_) ||
             ((multicast_ == nullptr && other.multicast_ != nullptr) ||
              (multicast_ != nullptr && other.multicast_ == nullptr)) ||
             ((fc_ == nullptr && other.fc_ != nullptr) ||
@@ -281,4 +357,30 @@ ParseReplicaAddress(const char *name)
                           dev == nullptr ? "" : string(dev));
 }
 
+KeyConfig
+ParseKeyConfig()
+{
+    char *identifier = strtok(nullptr, " \t");
+    char *scheme = strtok(nullptr, " \t");
+    char *secret = strtok(nullptr, " \t");
+    if (!identifier || !scheme || !secret) {
+        Panic("Configuration line format: 'key identifier scheme hex-secret'");
+    }
+
+    return KeyConfig{string(identifier), string(scheme), string(secret)};
+}
+
+MACKeyConfig
+ParseMACKeyConfig()
+{
+    char *sender = strtok(nullptr, " \t");
+    char *receiver = strtok(nullptr, " \t");
+    char *secret = strtok(nullptr, " \t");
+    if (!sender || !receiver || !secret) {
+        Panic("Configuration line format: 'mackey sender receiver hex-secret'");
+    }
+
+    return MACKeyConfig{string(sender), string(receiver), string(secret)};
+}
+
 } // namespace dsnet
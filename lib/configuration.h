@@ -59,6 +59,32 @@ struct ReplicaAddress
     string Serialize() const;
 };
 
+// 'key' directive: the secret of an identifier used by SignedAdapter,
+// interpreted by common/keyregistry according to scheme
+struct KeyConfig
+{
+    string identifier;
+    string scheme;
+    string secret;              // hex encoded, or "pub:" and hex public key
+    bool operator==(const KeyConfig &other) const;
+    inline bool operator!=(const KeyConfig &other) const {
+        return !(*this == other);
+    }
+};
+
+// 'mackey' directive: the MAC key that sender uses for receiver's entry of
+// its MAC vectors, see common/keyregistry
+struct MACKeyConfig
+{
+    string sender;
+    string receiver;
+    string secret;              // hex encoded
+    bool operator==(const MACKeyConfig &other) const;
+    inline bool operator!=(const MACKeyConfig &other) const {
+        return !(*this == other);
+    }
+};
+
 class Configuration
 {
 public:
@@ -75,6 +101,13 @@ public:
     const ReplicaAddress &sequencer(int index) const;
     const ReplicaAddress *multicast() const;
     const ReplicaAddress *fc() const;
+    const std::vector<KeyConfig> &keys() const;
+    const std::vector<MACKeyConfig> &mackeys() const;
+    // receivers of MAC vectors, in the order of their entries
+    const std::vector<string> &macgroup() const;
+    // 'identity' directive: the identifier that replica `id` signs with, or
+    // the test identifier "Steve" if it is not configured
+    const string &identity(int id) const;
     inline int GetLeaderIndex(view_t view) const {
         return (view % n);
     };
@@ -95,6 +128,10 @@ private:
     std::vector<ReplicaAddress> sequencers_;
     ReplicaAddress *multicast_;
     ReplicaAddress *fc_;
+    std::vector<KeyConfig> keys_;
+    std::vector<MACKeyConfig> mackeys_;
+    std::vector<string> macgroup_;
+    std::map<int, string> identities_;
 };
 
 }      // namespace dsnet
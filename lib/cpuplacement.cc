@@ -0,0 +1,191 @@
+#include "lib/cpuplacement.h"
+#include "lib/message.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <dirent.h>
+#include <fstream>
+#include <map>
+#include <set>
+#include <thread>
+
+namespace dsnet {
+
+using std::string;
+using std::vector;
+
+static string ReadSysfs(const string &path) {
+    std::ifstream file(path);
+    string content;
+    std::getline(file, content);
+    return content;
+}
+
+vector<int> CPUPlacement::ParseCPUList(const string &list) {
+    vector<int> cpus;
+    size_t start = 0;
+    while (start < list.size()) {
+        size_t end = list.find(',', start);
+        if (end == string::npos) {
+            end = list.size();
+        }
+        string range = list.substr(start, end - start);
+        char *rest;
+        long first = strtol(range.c_str(), &rest, 10), last = first;
+        if (*rest == '-') {
+            last = strtol(rest + 1, &rest, 10);
+        }
+        if (range.empty() || *rest != '\0' || first < 0 || last < first) {
+            Panic("Invalid cpu list: %s", list.c_str());
+        }
+        for (long cpu = first; cpu <= last; cpu += 1) {
+            cpus.push_back(cpu);
+        }
+        start = end + 1;
+    }
+    return cpus;
+}
+
+static vector<int> OnlineCPUs() {
+    string online = ReadSysfs("/sys/devices/system/cpu/online");
+    if (!online.empty()) {
+        return CPUPlacement::ParseCPUList(online);
+    }
+    vector<int> cpus;
+    for (unsigned cpu = 0; cpu < std::thread::hardware_concurrency(); cpu += 1) {
+        cpus.push_back(cpu);
+    }
+    return cpus;
+}
+
+// cpu -> NUMA node, empty if kernel has no NUMA support
+static std::map<int, int> CPUNodes() {
+    std::map<int, int> nodes;
+    DIR *dir = opendir("/sys/devices/system/node");
+    if (dir == nullptr) {
+        return nodes;
+    }
+    while (dirent *entry = readdir(dir)) {
+        int node;
+        if (sscanf(entry->d_name, "node%d", &node) != 1) {
+            continue;
+        }
+        string list = ReadSysfs(
+            "/sys/devices/system/node/" + string(entry->d_name) + "/cpulist");
+        for (int cpu : CPUPlacement::ParseCPUList(list)) {
+            nodes[cpu] = node;
+        }
+    }
+    closedir(dir);
+    return nodes;
+}
+
+// lowest cpu sharing the physical core with cpu
+static int CoreOf(int cpu) {
+    string siblings = ReadSysfs(
+        "/sys/devices/system/cpu/cpu" + std::to_string(cpu) +
+        "/topology/thread_siblings_list");
+    if (siblings.empty()) {
+        return cpu;
+    }
+    vector<int> cpus = CPUPlacement::ParseCPUList(siblings);
+    return *std::min_element(cpus.begin(), cpus.end());
+}
+
+CPUPlacement::CPUPlacement() { Build(""); }
+
+CPUPlacement::CPUPlacement(const string &spec) { Build(spec); }
+
+void CPUPlacement::Build(const string &spec) {
+    vector<int> online = OnlineCPUs();
+    std::set<int> allowed(online.begin(), online.end());
+    bool nosmt = false;
+
+    auto restrict_node = [&allowed](int node) {
+        std::map<int, int> nodes = CPUNodes();
+        if (nodes.empty() && node == 0) {
+            return; // no NUMA, everything is on node 0
+        }
+        for (auto iter = allowed.begin(); iter != allowed.end();) {
+            auto node_iter = nodes.find(*iter);
+            if (node_iter == nodes.end() || node_iter->second != node) {
+                iter = allowed.erase(iter);
+            } else {
+                ++iter;
+            }
+        }
+    };
+
+    size_t start = 0;
+    while (start < spec.size()) {
+        size_t end = spec.find('+', start);
+        if (end == string::npos) {
+            end = spec.size();
+        }
+        string item = spec.substr(start, end - start);
+        start = end + 1;
+
+        int node;
+        char tail;
+        if (item == "nosmt") {
+            nosmt = true;
+        } else if (sscanf(item.c_str(), "node%d%c", &node, &tail) == 1) {
+            restrict_node(node);
+        } else if (item.compare(0, 7, "netdev:") == 0) {
+            string numa_node = ReadSysfs(
+                "/sys/class/net/" + item.substr(7) + "/device/numa_node");
+            if (numa_node.empty()) {
+                Panic("Cannot find NUMA node of %s", item.c_str() + 7);
+            }
+            // -1 for device not attached to any node
+            node = atoi(numa_node.c_str());
+            if (node >= 0) {
+                restrict_node(node);
+            }
+        } else {
+            vector<int> list = ParseCPUList(item);
+            std::set<int> listed(list.begin(), list.end());
+            for (auto iter = allowed.begin(); iter != allowed.end();) {
+                if (listed.count(*iter) == 0) {
+                    iter = allowed.erase(iter);
+                } else {
+                    ++iter;
+                }
+            }
+        }
+    }
+
+    if (allowed.empty()) {
+        Panic("No cpu left for placement %s", spec.c_str());
+    }
+    cpus.assign(allowed.begin(), allowed.end());
+    if (nosmt) {
+        // one cpu per core first, then the siblings
+        vector<int> first, rest;
+        std::set<int> cores;
+        for (int cpu : cpus) {
+            (cores.insert(CoreOf(cpu)).second ? first : rest).push_back(cpu);
+        }
+        first.insert(first.end(), rest.begin(), rest.end());
+        cpus = first;
+    }
+}
+
+int CPUPlacement::CPU(int index) const { return cpus[index % cpus.size()]; }
+
+static CPUPlacement *default_placement = nullptr;
+
+const CPUPlacement &CPUPlacement::Default() {
+    if (default_placement == nullptr) {
+        default_placement = new CPUPlacement();
+    }
+    return *default_placement;
+}
+
+void CPUPlacement::SetDefault(const string &spec) {
+    delete default_placement;
+    default_placement = new CPUPlacement(spec);
+}
+
+} // namespace dsnet
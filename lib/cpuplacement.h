@@ -0,0 +1,43 @@
+#pragma once
+
+#include <string>
+#include <vector>
+
+namespace dsnet {
+
+// Where to pin the threads of a process, i.e. the driver and workers of every
+// Runner. Built from the CPU topology in sysfs and a placement spec, which is
+// a '+' separated list of:
+// * a cpu list in sysfs format, e.g. "0-14,32-46": only use these cpus
+// * "nodeN": only use cpus of NUMA node N
+// * "netdev:NAME": only use cpus of the NUMA node network device NAME is on
+// * "nosmt": keep threads off sibling hyperthreads of each other, until there
+// are more threads than physical cores
+// e.g. "netdev:ens1f0+nosmt". An empty spec uses every online cpu in order.
+//
+// Threads are handed the cpus of the resulting list in order, and wrap around
+// after the last one.
+class CPUPlacement {
+public:
+    CPUPlacement();
+    explicit CPUPlacement(const std::string &spec);
+
+    const std::vector<int> &CPUs() const { return cpus; }
+    // the cpu for index-th thread
+    int CPU(int index) const;
+
+    // placement for the whole process, used by Runner; set it in main before
+    // creating any Runner
+    static const CPUPlacement &Default();
+    static void SetDefault(const std::string &spec);
+
+    // cpu list in sysfs format, e.g. "0-3,8"
+    static std::vector<int> ParseCPUList(const std::string &list);
+
+private:
+    std::vector<int> cpus;
+
+    void Build(const std::string &spec);
+};
+
+} // namespace dsnet
@@ -1,5 +1,6 @@
-#include <mutex>
+#include <thread>
 #include <arpa/inet.h>
+#include <rte_cycles.h>
 #include <rte_eal.h>
 #include <rte_lcore.h>
 #include <rte_ethdev.h>
@@ -15,12 +16,36 @@ namespace dsnet {
 #define MEMPOOL_CACHE_SIZE 256
 #define RTE_RX_DESC 4096
 #define RTE_TX_DESC 4096
+// mbufs that receivers may hold through TransportBuffer, e.g. in Runner
+// queues and request batches, on top of the descriptor rings
+#define HELD_MBUFS_PER_CORE 8192
 #define IPV4_HDR_SIZE 5
 #define IPV4_TTL 0xFF
 
 typedef uint32_t Preamble;
 static const Preamble NONFRAG_MAGIC = 0x20050318;
 
+// TransportBuffer handle is the mbuf itself, so holding a message costs one
+// mbuf reference and no copy
+class MbufOwner : public TransportBuffer::Owner
+{
+public:
+    void Retain(void *handle) const override {
+        rte_mbuf_refcnt_update((struct rte_mbuf *)handle, 1);
+    }
+    void Release(void *handle) const override {
+        rte_pktmbuf_free((struct rte_mbuf *)handle);
+    }
+};
+
+static const MbufOwner mbuf_owner;
+
+static uint64_t
+NowMs()
+{
+    return rte_get_timer_cycles() / (rte_get_timer_hz() / 1000);
+}
+
 DPDKTransportAddress::DPDKTransportAddress(const std::string &s)
 {
     const char *p = s.data();
@@ -64,14 +89,19 @@ operator<(const DPDKTransportAddress &a, const DPDKTransportAddress &b)
 }
 
 static void
-ConstructArguments(int argc, char **argv, int core_id, const std::string &cmdline)
+ConstructArguments(int argc, char **argv, int core_id, int n_local_cores,
+                   const std::string &cmdline)
 {
     argv[0] = new char[strlen("command")+1];
     strcpy(argv[0], "command");
     argv[1] = new char[strlen("-l")+1];
     strcpy(argv[1], "-l");
-    argv[2] = new char[16];
-    sprintf(argv[2], "%d", core_id);
+    argv[2] = new char[32];
+    if (n_local_cores == 1) {
+        sprintf(argv[2], "%d", core_id);
+    } else {
+        sprintf(argv[2], "%d-%d", core_id, core_id + n_local_cores - 1);
+    }
     argv[3] = new char[strlen("--proc-type=auto")+1];
     strcpy(argv[3], "--proc-type=auto");
     if (cmdline.length() > 0) {
@@ -193,18 +223,29 @@ DPDKTransport::DPDKTransport(int dev_port,
         double drop_rate,
         int n_cores,
         int core_id,
-        const std::string &cmdline)
+        const std::string &cmdline,
+        int n_local_cores,
+        int burst_size)
     : dev_port_(dev_port), drop_rate_(drop_rate), n_cores_(n_cores), core_id_(core_id),
-    status_(STOPPED), multicast_addr_(nullptr), last_timer_id_(0)
+    n_local_cores_(n_local_cores), burst_size_(burst_size),
+    status_(STOPPED), n_registered_(0), multicast_addr_(nullptr)
 {
     // Initialize DPDK
-    ASSERT(core_id >= 0);
+    if (core_id < 0 || n_local_cores < 1 ||
+        n_local_cores > TimerQueue::MAX_TAG + 1 ||
+        core_id + n_local_cores > n_cores) {
+        Panic("Invalid DPDK queues: %d local from %d of %d",
+              n_local_cores, core_id, n_cores);
+    }
+    if (burst_size < 1 || burst_size > MAX_PKT_BURST) {
+        Panic("DPDK burst size must be in [1, %d]", MAX_PKT_BURST);
+    }
     int argc = 4;
     if (cmdline.length() > 0) {
         argc++;
     }
     char **argv = new char*[argc];
-    ConstructArguments(argc, argv, core_id_, cmdline);
+    ConstructArguments(argc, argv, core_id_, n_local_cores_, cmdline);
 
     if (rte_eal_init(argc, argv) < 0) {
         Panic("rte_eal_init failed");
@@ -218,7 +259,8 @@ DPDKTransport::DPDKTransport(int dev_port,
     // Initialize pktmbuf pool
     char pool_name[32];
     sprintf(pool_name, "pktmbuf_pool");
-    unsigned nb_mbufs = n_cores * (RTE_RX_DESC + RTE_TX_DESC);
+    unsigned nb_mbufs =
+        n_cores * (RTE_RX_DESC + RTE_TX_DESC + HELD_MBUFS_PER_CORE);
     if (proc_type == RTE_PROC_PRIMARY) {
         pktmbuf_pool_ = rte_pktmbuf_pool_create(pool_name,
                                                 nb_mbufs,
@@ -233,11 +275,6 @@ DPDKTransport::DPDKTransport(int dev_port,
     if (pktmbuf_pool_ == nullptr) {
         Panic("rte_pktmbuf_pool_create failed");
     }
-    // Initialize timer library
-    if (rte_timer_subsystem_init() != 0) {
-        Panic("rte_timer_subsystem_init failed");
-    }
-
     // Initialize port
     if (proc_type == RTE_PROC_PRIMARY) {
         struct rte_eth_conf port_conf;
@@ -245,7 +282,8 @@ DPDKTransport::DPDKTransport(int dev_port,
         port_conf.txmode.mq_mode = ETH_MQ_TX_NONE;
         port_conf.rx_adv_conf.rss_conf.rss_key = nullptr;
         if (n_cores > 1) {
-            // Enable RSS
+            // Enable RSS, for packets the flow rules do not steer
+            port_conf.rxmode.mq_mode = ETH_MQ_RX_RSS;
             port_conf.rx_adv_conf.rss_conf.rss_hf = ETH_RSS_NONFRAG_IPV4_UDP;
         }
 
@@ -308,6 +346,17 @@ DPDKTransport::DPDKTransport(int dev_port,
         // Create flow rules
         GenerateFlowRules(dev_port, n_cores);
     }
+
+    for (int i = 0; i < n_local_cores_; i++) {
+        QueueContext *queue = new QueueContext;
+        queue->queue_id = core_id_ + i;
+        queue->tx_buffer.resize(burst_size_);
+        queue->n_tx = 0;
+        rte_spinlock_init(&queue->tx_lock);
+        // polled by its lcore, which takes over ownership in RunTransport
+        queue->timers.reset(new TimerQueue(NowMs, i));
+        queues_.emplace_back(queue);
+    }
 }
 
 DPDKTransport::~DPDKTransport()
@@ -323,15 +372,20 @@ DPDKTransport::RegisterInternal(TransportReceiver *receiver,
     ASSERT(addr != nullptr);
     DPDKTransportAddress *da = new DPDKTransportAddress(LookupAddressInternal(*addr));
 
+    // Spread receivers over local queues, so e.g. bench clients in one
+    // process are polled by different lcores
+    QueueContext &queue = *queues_[n_registered_ % n_local_cores_];
+    n_registered_++;
+
     // We use first byte of udp port to steer packet
-    uint16_t udp_port = (rte_be_to_cpu_16(da->udp_addr_) & 0xFF) | (core_id_ << 8);
+    uint16_t udp_port = (rte_be_to_cpu_16(da->udp_addr_) & 0xFF) | (queue.queue_id << 8);
     da->udp_addr_ = rte_cpu_to_be_16(udp_port);
     receiver->SetAddress(da);
 
-    if (receivers_.count(da->udp_addr_) > 0) {
+    if (queue.receivers.count(da->udp_addr_) > 0) {
         Panic("Address already registered before");
     }
-    receivers_[da->udp_addr_] = receiver;
+    queue.receivers[da->udp_addr_] = receiver;
 }
 
 void
@@ -350,12 +404,28 @@ DPDKMainThread(void *arg)
 {
     DPDKTransport *transport = (DPDKTransport *)arg;
     transport->RunTransport();
+    return 0;
 }
 
 void
 DPDKTransport::Run()
 {
+    if (n_registered_ == 0) {
+        Panic("No transport receiver registered");
+    }
+    status_ = RUNNING;
     rte_eal_mp_remote_launch(DPDKMainThread, (void *)this, CALL_MAIN);
+    rte_eal_mp_wait_lcore();
+}
+
+DPDKTransport::QueueContext *
+DPDKTransport::LocalQueue()
+{
+    // lcores are launched with -l core_id-..., so lcore index is local
+    // queue index; -1 for threads that are not lcores
+    int index = rte_lcore_index(rte_lcore_id());
+    return (index < 0 || index >= n_local_cores_) ? nullptr :
+                                                     queues_[index].get();
 }
 
 void
@@ -367,69 +437,97 @@ DPDKTransport::RunTransport()
     uint16_t n_rx;
     struct rte_mbuf *pkt_burst[MAX_PKT_BURST];
     uint64_t cur_tsc, prev_tsc = 0;
-    int rx_queue_id = core_id_;
-
-    if (receivers_.empty()) {
-        Panic("No transport receiver registered");
-    }
-    status_ = RUNNING;
+    QueueContext *queue = LocalQueue();
+    ASSERT(queue != nullptr);
+    queue->timers->SetOwner(std::this_thread::get_id());
 
     while (status_ == RUNNING) {
-        cur_tsc = rte_rdtsc();
+        cur_tsc = rte_get_timer_cycles();
         if (cur_tsc - prev_tsc > timer_resolution_cycles) {
-            rte_timer_manage();
+            queue->timers->Poll();
             prev_tsc = cur_tsc;
         }
         n_rx = rte_eth_rx_burst(dev_port_,
-                                rx_queue_id,
+                                queue->queue_id,
                                 pkt_burst,
-                                MAX_PKT_BURST);
+                                burst_size_);
         for (int i = 0; i < n_rx; i++) {
-            struct rte_mbuf *m = pkt_burst[i];
-            // Parse packet header
-            struct rte_ether_hdr *ether_hdr;
-            struct rte_ipv4_hdr *ip_hdr;
-            struct rte_udp_hdr *udp_hdr;
-            size_t offset = 0;
-            ether_hdr = rte_pktmbuf_mtod_offset(m, struct rte_ether_hdr*, offset);
-            if (ether_hdr->ether_type ==
-                    rte_be_to_cpu_16(RTE_ETHER_TYPE_IPV4)) {
-                offset += RTE_ETHER_HDR_LEN;
-                ip_hdr = rte_pktmbuf_mtod_offset(m, struct rte_ipv4_hdr*, offset);
-                if (ip_hdr->next_proto_id == IPPROTO_UDP) {
-                    offset += (ip_hdr->version_ihl & RTE_IPV4_HDR_IHL_MASK) *
-                        RTE_IPV4_IHL_MULTIPLIER;
-                    udp_hdr = rte_pktmbuf_mtod_offset(m, struct rte_udp_hdr*, offset);
-                    offset += sizeof(struct rte_udp_hdr);
-
-                    // Deliver packet
-                    TransportReceiver *receiver =
-                        RouteToReceiver(DPDKTransportAddress(ether_hdr->d_addr,
-                                                             ip_hdr->dst_addr,
-                                                             udp_hdr->dst_port));
-                    if (receiver != nullptr) {
-                        void *msg_buf = rte_pktmbuf_mtod_offset(m, void*, offset);
-                        char *ptr = (char *)msg_buf;
-                        Preamble magic = *(Preamble *)ptr;
-                        ptr += sizeof(Preamble);
-
-                        if (magic == NONFRAG_MAGIC) {
-                            // Construct source address
-                            DPDKTransportAddress src(ether_hdr->s_addr,
-                                                     ip_hdr->src_addr,
-                                                     udp_hdr->src_port);
-                            receiver->ReceiveMessage(src,
-                                                     ptr,
-                                                     rte_be_to_cpu_16(udp_hdr->dgram_len)
-                                                     - sizeof(struct rte_udp_hdr)
-                                                     - sizeof(Preamble));
-                        }
-                    }
-                }
-            }
-            rte_pktmbuf_free(m);
+            ProcessPacket(*queue, pkt_burst[i]);
+            rte_pktmbuf_free(pkt_burst[i]);
         }
+        // everything sent by this round's receivers and timers goes out
+        // in one burst
+        if (queue->n_tx > 0) {
+            FlushTx(*queue);
+        }
+    }
+}
+
+void
+DPDKTransport::ProcessPacket(const QueueContext &queue, struct rte_mbuf *m)
+{
+    // Parse packet header
+    struct rte_ether_hdr *ether_hdr;
+    struct rte_ipv4_hdr *ip_hdr;
+    struct rte_udp_hdr *udp_hdr;
+    size_t offset = 0;
+    ether_hdr = rte_pktmbuf_mtod_offset(m, struct rte_ether_hdr*, offset);
+    if (ether_hdr->ether_type !=
+            rte_be_to_cpu_16(RTE_ETHER_TYPE_IPV4)) {
+        return;
+    }
+    offset += RTE_ETHER_HDR_LEN;
+    ip_hdr = rte_pktmbuf_mtod_offset(m, struct rte_ipv4_hdr*, offset);
+    if (ip_hdr->next_proto_id != IPPROTO_UDP) {
+        return;
     }
+    offset += (ip_hdr->version_ihl & RTE_IPV4_HDR_IHL_MASK) *
+        RTE_IPV4_IHL_MULTIPLIER;
+    udp_hdr = rte_pktmbuf_mtod_offset(m, struct rte_udp_hdr*, offset);
+    offset += sizeof(struct rte_udp_hdr);
+
+    // Deliver packet
+    TransportReceiver *receiver =
+        RouteToReceiver(queue, DPDKTransportAddress(ether_hdr->d_addr,
+                                                    ip_hdr->dst_addr,
+                                                    udp_hdr->dst_port));
+    if (receiver == nullptr) {
+        return;
+    }
+    void *msg_buf = rte_pktmbuf_mtod_offset(m, void*, offset);
+    char *ptr = (char *)msg_buf;
+    Preamble magic = *(Preamble *)ptr;
+    ptr += sizeof(Preamble);
+
+    if (magic == NONFRAG_MAGIC) {
+        // Construct source address
+        DPDKTransportAddress src(ether_hdr->s_addr,
+                                 ip_hdr->src_addr,
+                                 udp_hdr->src_port);
+        size_t msg_len = rte_be_to_cpu_16(udp_hdr->dgram_len)
+            - sizeof(struct rte_udp_hdr)
+            - sizeof(Preamble);
+        // the buffer takes its own reference, the polling loop still frees
+        // the one it got from rx burst
+        rte_mbuf_refcnt_update(m, 1);
+        receiver->ReceiveBuffer(src,
+                                TransportBuffer(ptr, msg_len, &mbuf_owner, m));
+    }
+}
+
+void
+DPDKTransport::FlushTx(QueueContext &queue)
+{
+    rte_spinlock_lock(&queue.tx_lock);
+    uint16_t n_sent = rte_eth_tx_burst(dev_port_,
+                                       queue.queue_id,
+                                       queue.tx_buffer.data(),
+                                       queue.n_tx);
+    rte_spinlock_unlock(&queue.tx_lock);
+    for (int i = n_sent; i < queue.n_tx; i++) {
+        rte_pktmbuf_free(queue.tx_buffer[i]);
+    }
+    queue.n_tx = 0;
 }
 
 void
@@ -441,49 +539,32 @@ DPDKTransport::Stop()
 int
 DPDKTransport::Timer(uint64_t ms, timer_callback_t cb)
 {
-    static const double hz = rte_get_timer_hz();
-    std::lock_guard<std::mutex> lck(timers_lock_);
-    DPDKTransportTimerInfo *info = new DPDKTransportTimerInfo();
-
-    info->transport = this;
-    info->cb = cb;
-    rte_timer_init(&info->timer);
-    info->id = ++last_timer_id_;
-    timers_[info->id] = info;
-
-    uint64_t ticks = (ms == 0) ? 0 : hz / (1000 / (double)ms);
-    rte_timer_reset(&info->timer, ticks, SINGLE, core_id_, TimerCallback, info);
-
-    return info->id;
+    // fire on the calling lcore, so a receiver keeps running on the lcore
+    // that polls its queue; others fall back to the first local lcore
+    QueueContext *queue = LocalQueue();
+    if (queue == nullptr) {
+        queue = queues_[0].get();
+    }
+    return queue->timers->Add(ms, std::move(cb));
 }
 
 bool
 DPDKTransport::CancelTimer(int id)
 {
-    std::lock_guard<std::mutex> lck(timers_lock_);
-
-    if (timers_.find(id) == timers_.end()) {
-        return false;
-    }
-
-    DPDKTransportTimerInfo *info = timers_.at(id);
-    if (info == nullptr) {
-        return false;
-    }
-
-    rte_timer_stop(&info->timer);
-    timers_.erase(info->id);
-    delete info;
+    return queues_[TimerQueue::Tag(id)]->timers->Cancel(id);
+}
 
-    return true;
+bool
+DPDKTransport::ResetTimer(int id, uint64_t ms)
+{
+    return queues_[TimerQueue::Tag(id)]->timers->Reset(id, ms);
 }
 
 void
 DPDKTransport::CancelAllTimers()
 {
-    while (!timers_.empty()) {
-        auto kv = timers_.begin();
-        CancelTimer(kv->first);
+    for (auto &queue : queues_) {
+        queue->timers->CancelAll();
     }
 }
 
@@ -553,8 +634,20 @@ DPDKTransport::SendMessageInternal(TransportReceiver *src,
     ptr += sizeof(Preamble);
     m.Serialize(ptr);
     /* Send packet */
-    int tx_queue = core_id_;
-    if (rte_eth_tx_burst(dev_port_, tx_queue, &mbuf, 1) == 1) {
+    QueueContext *queue = LocalQueue();
+    if (queue != nullptr) {
+        queue->tx_buffer[queue->n_tx++] = mbuf;
+        if (queue->n_tx == burst_size_) {
+            FlushTx(*queue);
+        }
+        return true;
+    }
+
+    queue = queues_[0].get();
+    rte_spinlock_lock(&queue->tx_lock);
+    uint16_t n_sent = rte_eth_tx_burst(dev_port_, queue->queue_id, &mbuf, 1);
+    rte_spinlock_unlock(&queue->tx_lock);
+    if (n_sent == 1) {
         return true;
     } else {
         rte_pktmbuf_free(mbuf);
@@ -595,36 +688,17 @@ DPDKTransport::ReverseLookupAddress(const TransportAddress &addr) const
 }
 
 TransportReceiver *
-DPDKTransport::RouteToReceiver(const DPDKTransportAddress &addr)
+DPDKTransport::RouteToReceiver(const QueueContext &queue,
+                               const DPDKTransportAddress &addr)
 {
     if (multicast_addr_ != nullptr && addr == *multicast_addr_) {
         // For multicast packets, just deliver to the first receiver
         return multicast_receivers_.empty() ? nullptr :
                                               multicast_receivers_.front();
     }
-    auto it = receivers_.find(addr.udp_addr_);
-    return it == receivers_.end() ? nullptr :
-                                    it->second;
-}
-
-void
-DPDKTransport::TimerCallback(struct rte_timer *timer, void *arg)
-{
-    DPDKTransport::DPDKTransportTimerInfo *info =
-        (DPDKTransport::DPDKTransportTimerInfo *)arg;
-    info->transport->OnTimer(info);
-}
-
-void
-DPDKTransport::OnTimer(DPDKTransportTimerInfo *info)
-{
-    {
-        std::lock_guard<std::mutex> lck(timers_lock_);
-        timers_.erase(info->id);
-    }
-
-    info->cb();
-    delete info;
+    auto it = queue.receivers.find(addr.udp_addr_);
+    return it == queue.receivers.end() ? nullptr :
+                                          it->second;
 }
 
 } // namespace dsnet
@@ -1,12 +1,15 @@
 #pragma once
 
-#include <mutex>
+#include <memory>
+#include <vector>
 
 #include <rte_ether.h>
 #include <rte_byteorder.h>
-#include <rte_timer.h>
+#include <rte_common.h>
+#include <rte_spinlock.h>
 
 #include "lib/configuration.h"
+#include "lib/timerwheel.h"
 #include "lib/transport.h"
 #include "lib/transportcommon.h"
 
@@ -34,13 +37,24 @@ private:
     friend class DPDKTransport;
 };
 
+// Every queue (RX/TX pair) is polled by its own lcore, and the queue id is
+// also the first byte of the UDP port of receivers registered on it, which is
+// what the installed flow rules steer on.
+//
+// n_cores is the total number of queues on the device. This process owns
+// queues [core_id, core_id + n_local_cores), running on lcores of the same
+// ids. Either run one process per queue (n_local_cores = 1, the default), or
+// one process owning all queues (core_id = 0, n_local_cores = n_cores).
+// burst_size is the most packets one rx burst takes and one tx burst sends.
 class DPDKTransport : public TransportCommon<DPDKTransportAddress>
 {
 public:
     DPDKTransport(int dev_port, double drop_rate = 0.0,
                   int n_cores = 1,
                   int core_id = 0,
-                  const std::string &cmdline = "");
+                  const std::string &cmdline = "",
+                  int n_local_cores = 1,
+                  int burst_size = 32);
     virtual ~DPDKTransport();
     virtual void RegisterInternal(TransportReceiver *receiver,
                                   const ReplicaAddress *addr,
@@ -51,35 +65,44 @@ public:
     virtual void Stop() override;
     virtual int Timer(uint64_t ms, timer_callback_t cb) override;
     virtual bool CancelTimer(int id) override;
+    virtual bool ResetTimer(int id, uint64_t ms) override;
     virtual void CancelAllTimers() override;
     virtual ReplicaAddress
     ReverseLookupAddress(const TransportAddress &addr) const override;
 
+    // polling loop of the calling lcore
     void RunTransport();
 
 private:
-    struct DPDKTransportTimerInfo
+    struct QueueContext
     {
-        DPDKTransport *transport;
-        timer_callback_t cb;
-        struct rte_timer timer;
-        int id;
+        int queue_id;
+        std::unordered_map<uint16_t, TransportReceiver *> receivers;
+        // packets sent by the owning lcore, flushed once per polling round
+        std::vector<struct rte_mbuf *> tx_buffer;
+        int n_tx;
+        // threads that are not lcores (e.g. Runner workers) send through
+        // the first local queue, so the TX path of that queue is locked
+        rte_spinlock_t tx_lock;
+        // timers of the receivers on this queue, tagged with local index
+        std::unique_ptr<TimerQueue> timers;
+        char padding[RTE_CACHE_LINE_SIZE];
     };
 
     int dev_port_;
     double drop_rate_;
     int n_cores_;
     int core_id_;
+    int n_local_cores_;
+    int burst_size_;
     volatile enum {
         RUNNING,
         STOPPED,
     } status_;
-    std::unordered_map<uint16_t, TransportReceiver *> receivers_;
+    std::vector<std::unique_ptr<QueueContext>> queues_;
+    int n_registered_;
     DPDKTransportAddress *multicast_addr_;
     std::vector<TransportReceiver *> multicast_receivers_;
-    std::unordered_map<int, DPDKTransportTimerInfo *> timers_;
-    std::mutex timers_lock_;
-    int last_timer_id_;
     struct rte_mempool *pktmbuf_pool_;
 
     virtual bool SendMessageInternal(TransportReceiver *src,
@@ -87,9 +110,11 @@ private:
                                      const Message &m) override;
     virtual DPDKTransportAddress
     LookupAddressInternal(const ReplicaAddress &addr) const override;
-    TransportReceiver *RouteToReceiver(const DPDKTransportAddress &addr);
-    static void TimerCallback(struct rte_timer *timer, void *arg);
-    void OnTimer(DPDKTransportTimerInfo *info);
+    TransportReceiver *RouteToReceiver(const QueueContext &queue,
+                                       const DPDKTransportAddress &addr);
+    QueueContext *LocalQueue();
+    void ProcessPacket(const QueueContext &queue, struct rte_mbuf *m);
+    void FlushTx(QueueContext &queue);
 };
 
 } // namespace dsnet
@@ -0,0 +1,713 @@
+#include "lib/iouringtransport.h"
+#include "lib/assert.h"
+#include "lib/configuration.h"
+#include "lib/message.h"
+#include "lib/udpsocket.h"
+
+#include <arpa/inet.h>
+#include <cstdio>
+#include <cstring>
+#include <poll.h>
+#include <sys/eventfd.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <sys/time.h>
+#include <sys/utsname.h>
+#include <unistd.h>
+
+namespace dsnet {
+
+// completion queue is sized for bursts of receive completions
+static const unsigned CQ_ENTRIES_PER_SQE = 8;
+// one datagram per buffer, together with the io_uring_recvmsg_out header
+// and the sender address in front of it
+static const size_t RECV_BUFFER_SIZE = 16384;
+static const unsigned NUM_RECV_BUFFERS = 1024;
+static const uint16_t RECV_BUFFER_GROUP = 0;
+
+// user_data of a SQE: operation in the high half, fd or send slot in the low
+enum : uint64_t { OP_RECV = 1, OP_SEND, OP_WAKEUP };
+
+static uint64_t
+UserData(uint64_t op, uint32_t value)
+{
+    return (op << 32) | value;
+}
+
+static uint64_t
+NowMs()
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1000 + ts.tv_nsec / 1000000;
+}
+
+IOUringTransport::IOUringTransport(double dropRate, int queueDepth)
+    : stopped(false), loopThread(std::thread::id()), dropRate(dropRate),
+      timerQueue(NowMs, 0, [this]() { Wakeup(); }),
+      lastFragMsgId(0), reassembler(MAX_UDP_MESSAGE_SIZE)
+{
+    struct timeval tv;
+    ASSERT(queueDepth >= 1);
+    memset(&ioStats, 0, sizeof(ioStats));
+
+    uniformDist = std::uniform_real_distribution<double>(0.0, 1.0);
+    gettimeofday(&tv, NULL);
+    randomEngine.seed(tv.tv_usec);
+    if (dropRate > 0) {
+        Warning("Dropping packets with probability %g", dropRate);
+    }
+
+    SetupRing(queueDepth);
+    SetupBufferRing();
+
+    memset(&recvMsg, 0, sizeof(recvMsg));
+    recvMsg.msg_namelen = sizeof(sockaddr_in);
+
+    sendSlots.resize(queueDepth);
+    sendBuffers.resize(queueDepth * SEND_SLOT_SIZE);
+    for (int i = queueDepth - 1; i >= 0; i--) {
+        SendSlot &slot = sendSlots[i];
+        memset(&slot.msg, 0, sizeof(slot.msg));
+        slot.msg.msg_name = &slot.addr;
+        slot.msg.msg_namelen = sizeof(slot.addr);
+        slot.msg.msg_iov = &slot.iov;
+        slot.msg.msg_iovlen = 1;
+        slot.iov.iov_base = &sendBuffers[i * SEND_SLOT_SIZE];
+        freeSendSlots.push_back(i);
+    }
+
+    if ((wakeupFd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC)) < 0) {
+        PPanic("Failed to create eventfd");
+    }
+    ArmWakeup();
+}
+
+IOUringTransport::~IOUringTransport()
+{
+    Notice("Average batch size: submit = %.2f, complete = %.2f "
+           "(%lu io_uring_enter calls)",
+           AvgSubmitBatchSize(), AvgCompleteBatchSize(), ioStats.enterCalls);
+    for (auto &kv : receivers) {
+        close(kv.first);
+    }
+    for (auto &kv : multicastConfigs) {
+        close(kv.first);
+    }
+    close(wakeupFd);
+    // closing the ring also unregisters the buffer ring
+    close(ring.fd);
+    munmap(ring.sqes, ring.sqesSize);
+    munmap(ring.mem, ring.memSize);
+    munmap(bufRing, NUM_RECV_BUFFERS * sizeof(io_uring_buf));
+}
+
+bool
+IOUringTransport::Supported()
+{
+    // multishot recvmsg is the newest feature in use
+    struct utsname name;
+    int major, minor;
+    if (uname(&name) != 0 ||
+        sscanf(name.release, "%d.%d", &major, &minor) != 2 || major < 6) {
+        return false;
+    }
+    io_uring_params params;
+    memset(&params, 0, sizeof(params));
+    int fd = syscall(__NR_io_uring_setup, 1, &params);
+    if (fd < 0) {
+        return false;
+    }
+    close(fd);
+    return (params.features & IORING_FEAT_SINGLE_MMAP) &&
+           (params.features & IORING_FEAT_EXT_ARG);
+}
+
+void
+IOUringTransport::SetupRing(unsigned entries)
+{
+    io_uring_params params;
+    memset(&params, 0, sizeof(params));
+    params.flags = IORING_SETUP_CQSIZE;
+    params.cq_entries = entries * CQ_ENTRIES_PER_SQE;
+    ring.fd = syscall(__NR_io_uring_setup, entries, &params);
+    if (ring.fd < 0) {
+        PPanic("Failed to set up io_uring");
+    }
+    if (!(params.features & IORING_FEAT_SINGLE_MMAP) ||
+        !(params.features & IORING_FEAT_EXT_ARG)) {
+        Panic("Kernel does not support required io_uring features");
+    }
+
+    // SQ and CQ rings share one mapping
+    ring.memSize = std::max(
+        params.sq_off.array + params.sq_entries * sizeof(unsigned),
+        params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe));
+    ring.mem = mmap(nullptr, ring.memSize, PROT_READ | PROT_WRITE,
+                    MAP_SHARED | MAP_POPULATE, ring.fd, IORING_OFF_SQ_RING);
+    if (ring.mem == MAP_FAILED) {
+        PPanic("Failed to map io_uring");
+    }
+    ring.sqesSize = params.sq_entries * sizeof(io_uring_sqe);
+    ring.sqes = (io_uring_sqe *)mmap(nullptr, ring.sqesSize,
+                                     PROT_READ | PROT_WRITE,
+                                     MAP_SHARED | MAP_POPULATE,
+                                     ring.fd, IORING_OFF_SQES);
+    if (ring.sqes == MAP_FAILED) {
+        PPanic("Failed to map io_uring SQEs");
+    }
+
+    char *base = (char *)ring.mem;
+    ring.sqEntries = params.sq_entries;
+    ring.sqMask = *(unsigned *)(base + params.sq_off.ring_mask);
+    ring.sqHead = (unsigned *)(base + params.sq_off.head);
+    ring.sqTail = (unsigned *)(base + params.sq_off.tail);
+    ring.sqArray = (unsigned *)(base + params.sq_off.array);
+    ring.cqMask = *(unsigned *)(base + params.cq_off.ring_mask);
+    ring.cqHead = (unsigned *)(base + params.cq_off.head);
+    ring.cqTail = (unsigned *)(base + params.cq_off.tail);
+    ring.cqes = (io_uring_cqe *)(base + params.cq_off.cqes);
+    ring.sqLocalTail = *ring.sqTail;
+
+    Notice("io_uring set up with %u SQ entries, %u CQ entries",
+           params.sq_entries, params.cq_entries);
+}
+
+void
+IOUringTransport::SetupBufferRing()
+{
+    size_t size = NUM_RECV_BUFFERS * sizeof(io_uring_buf);
+    bufRing = (io_uring_buf_ring *)mmap(nullptr, size,
+                                        PROT_READ | PROT_WRITE,
+                                        MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (bufRing == MAP_FAILED) {
+        PPanic("Failed to allocate io_uring buffer ring");
+    }
+
+    io_uring_buf_reg reg;
+    memset(&reg, 0, sizeof(reg));
+    reg.ring_addr = (uint64_t)bufRing;
+    reg.ring_entries = NUM_RECV_BUFFERS;
+    reg.bgid = RECV_BUFFER_GROUP;
+    if (syscall(__NR_io_uring_register, ring.fd, IORING_REGISTER_PBUF_RING,
+                &reg, 1) < 0) {
+        PPanic("Failed to register io_uring buffer ring");
+    }
+
+    recvBuffers.resize(NUM_RECV_BUFFERS * RECV_BUFFER_SIZE);
+    bufRingTail = 0;
+    for (unsigned i = 0; i < NUM_RECV_BUFFERS; i++) {
+        RecycleBuffer(i);
+    }
+}
+
+void
+IOUringTransport::RecycleBuffer(uint16_t bid)
+{
+    // Not bufRing->bufs: the flexible array in the UAPI header is placed
+    // after an empty struct, which takes a byte in C++, so it is off by one
+    // entry. The entries start at the ring itself, overlaid by the tail.
+    io_uring_buf *bufs = (io_uring_buf *)bufRing;
+    io_uring_buf *buf = &bufs[bufRingTail & (NUM_RECV_BUFFERS - 1)];
+    buf->addr = (uint64_t)&recvBuffers[bid * RECV_BUFFER_SIZE];
+    buf->len = RECV_BUFFER_SIZE;
+    buf->bid = bid;
+    bufRingTail++;
+    __atomic_store_n(&bufRing->tail, bufRingTail, __ATOMIC_RELEASE);
+}
+
+io_uring_sqe *
+IOUringTransport::GetSqe()
+{
+    // Without SQPOLL the kernel only consumes SQEs in io_uring_enter, so
+    // submitting makes room right away
+    unsigned head = __atomic_load_n(ring.sqHead, __ATOMIC_ACQUIRE);
+    if (ring.sqLocalTail - head == ring.sqEntries) {
+        Enter(0, -1);
+        head = __atomic_load_n(ring.sqHead, __ATOMIC_ACQUIRE);
+        ASSERT(ring.sqLocalTail - head < ring.sqEntries);
+    }
+    unsigned index = ring.sqLocalTail & ring.sqMask;
+    io_uring_sqe *sqe = &ring.sqes[index];
+    memset(sqe, 0, sizeof(*sqe));
+    ring.sqArray[index] = index;
+    ring.sqLocalTail++;
+    return sqe;
+}
+
+void
+IOUringTransport::Enter(unsigned waitNr, long timeoutNs)
+{
+    __atomic_store_n(ring.sqTail, ring.sqLocalTail, __ATOMIC_RELEASE);
+    unsigned toSubmit =
+        ring.sqLocalTail - __atomic_load_n(ring.sqHead, __ATOMIC_ACQUIRE);
+
+    unsigned flags = 0;
+    io_uring_getevents_arg arg;
+    __kernel_timespec ts;
+    void *argp = nullptr;
+    size_t argsz = 0;
+    if (waitNr > 0) {
+        flags |= IORING_ENTER_GETEVENTS;
+        if (timeoutNs >= 0) {
+            ts.tv_sec = timeoutNs / 1000000000;
+            ts.tv_nsec = timeoutNs % 1000000000;
+            memset(&arg, 0, sizeof(arg));
+            arg.ts = (uint64_t)&ts;
+            flags |= IORING_ENTER_EXT_ARG;
+            argp = &arg;
+            argsz = sizeof(arg);
+        }
+    }
+    if (toSubmit == 0 && waitNr == 0) {
+        return;
+    }
+
+    int ret = syscall(__NR_io_uring_enter, ring.fd, toSubmit, waitNr,
+                      flags, argp, argsz);
+    if (ret < 0) {
+        if (errno != EINTR && errno != ETIME && errno != EBUSY &&
+            errno != EAGAIN) {
+            PWarning("io_uring_enter failed");
+        }
+        return;
+    }
+    ioStats.enterCalls++;
+    ioStats.submitted += ret;
+}
+
+void
+IOUringTransport::ReapCompletions()
+{
+    unsigned head = *ring.cqHead;
+    while (head != __atomic_load_n(ring.cqTail, __ATOMIC_ACQUIRE)) {
+        io_uring_cqe *cqe = &ring.cqes[head & ring.cqMask];
+        uint64_t data = cqe->user_data;
+        int res = cqe->res;
+        unsigned flags = cqe->flags;
+        // release the entry before handling it, which may send
+        head++;
+        __atomic_store_n(ring.cqHead, head, __ATOMIC_RELEASE);
+        ioStats.completed++;
+
+        uint32_t value = data & 0xffffffff;
+        switch (data >> 32) {
+        case OP_RECV:
+            OnRecv(value, res, flags);
+            break;
+        case OP_SEND:
+            if (res < 0) {
+                Warning("Failed to send message: %s", strerror(-res));
+            }
+            freeSendSlots.push_back(value);
+            break;
+        case OP_WAKEUP:
+            // drain the eventfd, the loop checks why it is woken up
+            if (read(wakeupFd, &wakeupValue, sizeof(wakeupValue)) < 0 &&
+                errno != EAGAIN) {
+                PWarning("Failed to read eventfd");
+            }
+            if (!(flags & IORING_CQE_F_MORE)) {
+                ArmWakeup();
+            }
+            break;
+        default:
+            NOT_REACHABLE();
+        }
+    }
+}
+
+void
+IOUringTransport::ArmRecv(int fd)
+{
+    io_uring_sqe *sqe = GetSqe();
+    sqe->opcode = IORING_OP_RECVMSG;
+    sqe->fd = fd;
+    sqe->addr = (uint64_t)&recvMsg;
+    sqe->len = 1;
+    sqe->ioprio = IORING_RECV_MULTISHOT;
+    sqe->flags = IOSQE_BUFFER_SELECT;
+    sqe->buf_group = RECV_BUFFER_GROUP;
+    sqe->user_data = UserData(OP_RECV, fd);
+}
+
+void
+IOUringTransport::ArmWakeup()
+{
+    io_uring_sqe *sqe = GetSqe();
+    sqe->opcode = IORING_OP_POLL_ADD;
+    sqe->fd = wakeupFd;
+    sqe->len = IORING_POLL_ADD_MULTI;
+    sqe->poll32_events = POLLIN;
+    sqe->user_data = UserData(OP_WAKEUP, 0);
+}
+
+void
+IOUringTransport::Wakeup()
+{
+    uint64_t one = 1;
+    if (write(wakeupFd, &one, sizeof(one)) < 0) {
+        PWarning("Failed to write eventfd");
+    }
+}
+
+void
+IOUringTransport::OnRecv(int fd, int res, unsigned flags)
+{
+    if (res >= 0) {
+        ASSERT(flags & IORING_CQE_F_BUFFER);
+        uint16_t bid = flags >> IORING_CQE_BUFFER_SHIFT;
+        const char *buf = &recvBuffers[bid * RECV_BUFFER_SIZE];
+        auto *out = (const io_uring_recvmsg_out *)buf;
+        size_t offset = sizeof(*out) + recvMsg.msg_namelen +
+            recvMsg.msg_controllen;
+        if (out->flags & MSG_TRUNC) {
+            Warning("Received truncated datagram");
+        } else if (out->namelen != sizeof(sockaddr_in) ||
+                   offset + out->payloadlen > (size_t)res) {
+            Warning("Received malformed recvmsg completion");
+        } else {
+            ProcessPacket(fd, *(const sockaddr_in *)(out + 1),
+                          buf + offset, out->payloadlen);
+        }
+        RecycleBuffer(bid);
+    } else if (res == -EINVAL) {
+        Panic("Kernel does not support multishot recvmsg");
+    } else if (res != -ENOBUFS) {
+        // ENOBUFS only means every buffer is taken; some are back by now
+        Warning("Failed to receive message from socket: %s", strerror(-res));
+    }
+
+    if (!(flags & IORING_CQE_F_MORE)) {
+        ArmRecv(fd);
+    }
+}
+
+void
+IOUringTransport::RegisterInternal(TransportReceiver *receiver,
+                                   const dsnet::ReplicaAddress *addr,
+                                   int groupIdx, int replicaIdx)
+{
+    struct sockaddr_in sin;
+
+    int fd = OpenUDPSocket(addr);
+    ArmRecv(fd);
+
+    // Tell the receiver its address
+    socklen_t sinsize = sizeof(sin);
+    if (getsockname(fd, (sockaddr *) &sin, &sinsize) < 0) {
+        PPanic("Failed to get socket name");
+    }
+    UDPTransportAddress *uaddr = new UDPTransportAddress(sin);
+    receiver->SetAddress(uaddr);
+
+    // Update mappings
+    receivers[fd] = receiver;
+    fds[receiver] = fd;
+
+    Notice("Listening on UDP port %hu", ntohs(sin.sin_port));
+}
+
+void
+IOUringTransport::ListenOnMulticast(TransportReceiver *src,
+                                    const dsnet::Configuration &config)
+{
+    if (configurations.find(src) == configurations.end()) {
+        Panic("Register address first before listening on multicast");
+    }
+    dsnet::Configuration *canonical = configurations.at(src);
+
+    if (!canonical->multicast()) {
+        // No multicast address specified
+        return;
+    }
+
+    if (multicastFds.find(canonical) != multicastFds.end()) {
+        // We're already listening
+        return;
+    }
+
+    int fd = OpenUDPMulticastSocket(*canonical->multicast());
+    ArmRecv(fd);
+
+    // Record the fd
+    multicastFds[canonical] = fd;
+    multicastConfigs[fd] = canonical;
+
+    Notice("Listening for multicast requests on %s:%s",
+           canonical->multicast()->host.c_str(),
+           canonical->multicast()->port.c_str());
+}
+
+UDPTransportAddress
+IOUringTransport::LookupAddressInternal(const dsnet::ReplicaAddress &addr) const
+{
+    return UDPTransportAddress(LookupUDPAddress(addr));
+}
+
+ReplicaAddress
+IOUringTransport::ReverseLookupAddress(const TransportAddress &addr) const
+{
+    const UDPTransportAddress *ua = dynamic_cast<const UDPTransportAddress *>(&addr);
+    return ReverseLookupUDPAddress(ua->addr);
+}
+
+bool
+IOUringTransport::SendMessageInternal(TransportReceiver *src,
+                                      const UDPTransportAddress &dst,
+                                      const Message &m)
+{
+    const sockaddr_in &sin = dst.addr;
+    int fd = fds.at(src);
+    size_t msg_len = sizeof(Preamble) + m.SerializedSize();
+
+    if (msg_len <= MAX_UDP_MESSAGE_SIZE) {
+        // Serialize straight into a send slot if there is one
+        char *buf = ReserveSendSlot(fd, sin, msg_len);
+        bool queued = buf != nullptr;
+        if (!queued) {
+            buf = SendArena(msg_len);
+        }
+        *(Preamble *)buf = NONFRAG_MAGIC;
+        m.Serialize(buf + sizeof(Preamble));
+
+        if (!queued && sendto(fd, buf, msg_len, 0,
+                              (const sockaddr *)&sin, sizeof(sin)) < 0) {
+            PWarning("Failed to send message");
+            return false;
+        }
+        return true;
+    }
+
+    msg_len -= sizeof(Preamble);
+    char *body_start = SendArena(msg_len);
+    m.Serialize(body_start);
+    int num_frags = ((msg_len - 1) / MAX_UDP_MESSAGE_SIZE) + 1;
+    Debug("Sending large %s message in %d fragments",
+          m.Type().c_str(), num_frags);
+    uint64_t msg_id = ++lastFragMsgId;
+    for (size_t frag_start = 0; frag_start < msg_len;
+            frag_start += MAX_UDP_MESSAGE_SIZE) {
+        size_t frag_len = std::min(msg_len - frag_start,
+                                  MAX_UDP_MESSAGE_SIZE);
+        char frag_header[FRAG_HEADER_LEN];
+        WriteFragHeader(frag_header, msg_id, frag_start, msg_len);
+
+        iovec iov[2];
+        iov[0].iov_base = frag_header;
+        iov[0].iov_len = FRAG_HEADER_LEN;
+        iov[1].iov_base = &body_start[frag_start];
+        iov[1].iov_len = frag_len;
+        if (!SendDatagram(fd, sin, iov, 2)) {
+            PWarning("Failed to send message fragment %ld",
+                     frag_start);
+            return false;
+        }
+    }
+    return true;
+}
+
+char *
+IOUringTransport::ReserveSendSlot(int fd, const sockaddr_in &sin, size_t len)
+{
+    // Only the event loop thread touches the SQ while it runs
+    if (std::this_thread::get_id() !=
+            loopThread.load(std::memory_order_relaxed) ||
+        freeSendSlots.empty()) {
+        return nullptr;
+    }
+
+    ASSERT(len <= SEND_SLOT_SIZE);
+    int i = freeSendSlots.back();
+    freeSendSlots.pop_back();
+    SendSlot &slot = sendSlots[i];
+    slot.addr = sin;
+    slot.iov.iov_len = len;
+
+    io_uring_sqe *sqe = GetSqe();
+    sqe->opcode = IORING_OP_SENDMSG;
+    sqe->fd = fd;
+    sqe->addr = (uint64_t)&slot.msg;
+    sqe->len = 1;
+    sqe->user_data = UserData(OP_SEND, i);
+    // submitted by the next io_uring_enter, failures are reported (as
+    // warnings) on completion
+    return (char *)slot.iov.iov_base;
+}
+
+bool
+IOUringTransport::SendDatagram(int fd, const sockaddr_in &sin,
+                               const iovec *iov, int iovcnt)
+{
+    size_t len = 0;
+    for (int i = 0; i < iovcnt; i++) {
+        len += iov[i].iov_len;
+    }
+
+    char *slot = ReserveSendSlot(fd, sin, len);
+    if (slot != nullptr) {
+        for (int i = 0; i < iovcnt; i++) {
+            memcpy(slot, iov[i].iov_base, iov[i].iov_len);
+            slot += iov[i].iov_len;
+        }
+        return true;
+    }
+
+    msghdr msg;
+    memset(&msg, 0, sizeof(msg));
+    msg.msg_name = (void *)&sin;
+    msg.msg_namelen = sizeof(sin);
+    msg.msg_iov = (iovec *)iov;
+    msg.msg_iovlen = iovcnt;
+    return sendmsg(fd, &msg, 0) >= 0;
+}
+
+void
+IOUringTransport::ProcessPacket(int fd, const sockaddr_in &sender,
+                                const char *buf, size_t sz)
+{
+    UDPTransportAddress sender_addr(sender);
+
+    if (sz <= sizeof(Preamble)) {
+        Warning("Received packet too short");
+        return;
+    }
+    Preamble magic = *(const Preamble *)buf;
+    void *msg_buf;
+    size_t msg_size;
+
+    if (magic == NONFRAG_MAGIC) {
+        msg_buf = (void *)(buf + sizeof(Preamble));
+        msg_size = sz - sizeof(Preamble);
+    } else if (magic == FRAG_MAGIC) {
+        uint64_t msg_id;
+        size_t frag_start, msg_len;
+        const char *ptr =
+            ReadFragHeader(buf, sz, &msg_id, &frag_start, &msg_len);
+        if (ptr == nullptr) {
+            Warning("Received fragment too short");
+            return;
+        }
+        Debug("Received fragment of %zd byte packet %lx starting at %zd",
+              msg_len, msg_id, frag_start);
+        const char *msg = reassembler.Insert(FragSenderKey(sender), msg_id,
+                                             frag_start, msg_len, ptr,
+                                             buf + sz - ptr, NowMs());
+        if (msg == nullptr) {
+            return;
+        }
+        Debug("Completed packet reconstruction");
+        msg_buf = (void *)msg;
+        msg_size = msg_len;
+    } else {
+        Warning("Received packet with bad magic number");
+        return;
+    }
+
+    if (dropRate > 0.0) {
+        double roll = uniformDist(randomEngine);
+        if (roll < dropRate) {
+            Debug("Simulating packet drop of message");
+            return;
+        }
+    }
+
+    // Was this received on a multicast fd?
+    auto it = multicastConfigs.find(fd);
+    if (it != multicastConfigs.end()) {
+        // If so, deliver the message to all replicas for that config,
+        // *except* if that replica was the sender of the message.
+        const dsnet::Configuration *cfg = it->second;
+        for (auto &kv : replicaReceivers[cfg]) {
+            shardnum_t groupIdx = kv.first;
+            for (auto &kv2 : kv.second) {
+                uint32_t replicaIdx = kv2.first;
+                TransportReceiver *receiver = kv2.second;
+                const UDPTransportAddress &raddr =
+                    replicaAddresses[cfg][groupIdx].find(replicaIdx)->second;
+                if (raddr != sender_addr) {
+                    receiver->ReceiveMessage(sender_addr, msg_buf, msg_size);
+                }
+            }
+        }
+    } else {
+        TransportReceiver *receiver = receivers[fd];
+        receiver->ReceiveMessage(sender_addr, msg_buf, msg_size);
+    }
+}
+
+void
+IOUringTransport::Run()
+{
+    loopThread.store(std::this_thread::get_id(), std::memory_order_relaxed);
+    timerQueue.SetOwner(std::this_thread::get_id());
+    stopped = false;
+    while (true) {
+        timerQueue.Poll();
+        if (stopped) {
+            break;
+        }
+        // submit queued sends, and wait for something to do until the next
+        // timer is due
+        long timeoutNs = -1;
+        if (!timerQueue.Empty()) {
+            uint64_t deadline = timerQueue.NextDeadline(), now = NowMs();
+            timeoutNs = deadline > now ? (deadline - now) * 1000000 : 0;
+        }
+        Enter(1, timeoutNs);
+        ReapCompletions();
+    }
+    Enter(0, -1);
+    loopThread.store(std::thread::id(), std::memory_order_relaxed);
+}
+
+void
+IOUringTransport::Stop()
+{
+    stopped = true;
+    if (std::this_thread::get_id() !=
+        loopThread.load(std::memory_order_relaxed)) {
+        Wakeup();
+    }
+}
+
+int
+IOUringTransport::Timer(uint64_t ms, timer_callback_t cb)
+{
+    // the loop polls pending timers at least once per tick
+    return timerQueue.Add(ms, std::move(cb));
+}
+
+bool
+IOUringTransport::CancelTimer(int id)
+{
+    return timerQueue.Cancel(id);
+}
+
+bool
+IOUringTransport::ResetTimer(int id, uint64_t ms)
+{
+    return timerQueue.Reset(id, ms);
+}
+
+void
+IOUringTransport::CancelAllTimers()
+{
+    timerQueue.CancelAll();
+}
+
+double
+IOUringTransport::AvgSubmitBatchSize() const
+{
+    return ioStats.enterCalls == 0 ? 0.0 :
+        (double)ioStats.submitted / ioStats.enterCalls;
+}
+
+double
+IOUringTransport::AvgCompleteBatchSize() const
+{
+    return ioStats.enterCalls == 0 ? 0.0 :
+        (double)ioStats.completed / ioStats.enterCalls;
+}
+
+} // namespace dsnet
@@ -0,0 +1,142 @@
+#pragma once
+
+#include "lib/configuration.h"
+#include "lib/reassembler.h"
+#include "lib/timerwheel.h"
+#include "lib/transport.h"
+#include "lib/transportcommon.h"
+#include "lib/udptransport.h"
+
+#include <linux/io_uring.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+
+#include <atomic>
+#include <map>
+#include <random>
+#include <thread>
+#include <vector>
+
+namespace dsnet {
+
+// UDP transport driven by an io_uring instead of libevent, wire compatible
+// with UDPTransport. Requires Linux 6.0 or later.
+//
+// Every socket has one multishot recvmsg in flight, which takes buffers from
+// a ring of provided buffers, so receiving costs no syscall as long as
+// completions keep coming. Datagrams sent from the event loop thread are
+// queued as sendmsg SQEs and submitted together, by the same io_uring_enter
+// that waits for the next completions. Other threads (e.g. Runner workers)
+// and fragmented messages use plain sendmsg.
+//
+// Timers are owned by the event loop thread, which waits at most one tick
+// while any timer is pending. An eventfd wakes the loop up for Stop() and
+// for timers armed by other threads.
+class IOUringTransport : public TransportCommon<UDPTransportAddress>
+{
+public:
+    // queueDepth bounds the number of sends in flight
+    IOUringTransport(double dropRate = 0.0, int queueDepth = 256);
+    virtual ~IOUringTransport();
+    virtual void RegisterInternal(TransportReceiver *receiver,
+                                  const dsnet::ReplicaAddress *addr,
+                                  int groupIdx, int replicaIdx) override;
+    virtual void ListenOnMulticast(TransportReceiver *receiver,
+                                   const dsnet::Configuration &config) override;
+    void Run() override;
+    void Stop() override;
+    int Timer(uint64_t ms, timer_callback_t cb) override;
+    bool CancelTimer(int id) override;
+    bool ResetTimer(int id, uint64_t ms) override;
+    void CancelAllTimers() override;
+    virtual ReplicaAddress
+    ReverseLookupAddress(const TransportAddress &addr) const override;
+
+    // whether the running kernel lets this process use the transport, e.g.
+    // io_uring may be too old or disabled by seccomp or sysctl
+    static bool Supported();
+
+    // average number of SQEs submitted and CQEs reaped per io_uring_enter
+    double AvgSubmitBatchSize() const;
+    double AvgCompleteBatchSize() const;
+
+private:
+    // the mapped submission and completion queues
+    struct
+    {
+        int fd;
+        void *mem;
+        size_t memSize;
+        io_uring_sqe *sqes;
+        size_t sqesSize;
+        unsigned sqEntries, sqMask, cqMask;
+        unsigned *sqHead, *sqTail, *sqArray;
+        unsigned *cqHead, *cqTail;
+        io_uring_cqe *cqes;
+        // SQEs up to here are prepared, but maybe not seen by the kernel
+        unsigned sqLocalTail;
+    } ring;
+
+    // provided buffers for multishot recvmsg
+    io_uring_buf_ring *bufRing;
+    std::vector<char> recvBuffers;
+    uint16_t bufRingTail;
+    // the template recvmsg reads name and control lengths from
+    msghdr recvMsg;
+
+    struct SendSlot
+    {
+        msghdr msg;
+        iovec iov;
+        sockaddr_in addr;
+    };
+    std::vector<SendSlot> sendSlots;
+    std::vector<char> sendBuffers;
+    std::vector<int> freeSendSlots;
+
+    int wakeupFd;
+    uint64_t wakeupValue;
+    std::atomic<bool> stopped;
+    // read by runner workers on every send
+    std::atomic<std::thread::id> loopThread;
+
+    double dropRate;
+    std::uniform_real_distribution<double> uniformDist;
+    std::default_random_engine randomEngine;
+    std::map<int, TransportReceiver*> receivers; // fd -> receiver
+    std::map<TransportReceiver*, int> fds; // receiver -> fd
+    std::map<const dsnet::Configuration *, int> multicastFds;
+    std::map<int, const dsnet::Configuration *> multicastConfigs;
+    TimerQueue timerQueue;
+    std::atomic<uint64_t> lastFragMsgId;
+    FragmentReassembler reassembler;
+
+    struct
+    {
+        uint64_t enterCalls, submitted, completed;
+    } ioStats;
+
+    bool SendMessageInternal(TransportReceiver *src,
+                             const UDPTransportAddress &dst,
+                             const Message &m) override;
+    UDPTransportAddress
+    LookupAddressInternal(const dsnet::ReplicaAddress &addr) const override;
+
+    void SetupRing(unsigned entries);
+    void SetupBufferRing();
+    io_uring_sqe *GetSqe();
+    void Enter(unsigned waitNr, long timeoutNs);
+    void ReapCompletions();
+    void ArmRecv(int fd);
+    void ArmWakeup();
+    void Wakeup();
+    void OnRecv(int fd, int res, unsigned flags);
+    void RecycleBuffer(uint16_t bid);
+    char *ReserveSendSlot(int fd, const sockaddr_in &sin, size_t len);
+    bool SendDatagram(int fd, const sockaddr_in &sin,
+                      const iovec *iov, int iovcnt);
+    void ProcessPacket(int fd, const sockaddr_in &sender,
+                       const char *buf, size_t sz);
+};
+
+} // namespace dsnet
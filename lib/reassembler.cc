@@ -0,0 +1,132 @@
+#include "lib/reassembler.h"
+#include "lib/assert.h"
+#include "lib/message.h"
+
+#include <algorithm>
+#include <cstring>
+
+namespace dsnet {
+
+FragmentReassembler::FragmentReassembler(
+    size_t frag_size, int capacity, size_t max_msg_len, uint64_t timeout_ms)
+    : frag_size(frag_size), max_msg_len(max_msg_len), timeout_ms(timeout_ms),
+      entries(capacity), n_completed(0), n_dropped(0), n_invalid(0) {
+    ASSERT(frag_size > 0);
+    ASSERT(capacity > 0);
+    for (Entry &entry : entries) {
+        entry.active = false;
+    }
+}
+
+void FragmentReassembler::Drop(Entry &entry, const char *reason) {
+    Warning(
+        "%s, dropping packet %lx with %zu of %zu bytes received", reason,
+        entry.msg_id, entry.received, entry.msg_len);
+    entry.active = false;
+    n_dropped += 1;
+}
+
+FragmentReassembler::Entry &FragmentReassembler::Allocate(
+    uint64_t sender, size_t msg_len) {
+    // the sender's share, reclaiming its oldest entries
+    while (true) {
+        size_t sender_len = msg_len;
+        Entry *oldest = nullptr;
+        for (Entry &entry : entries) {
+            if (entry.active && entry.sender == sender) {
+                sender_len += entry.msg_len;
+                if (oldest == nullptr ||
+                    entry.last_update < oldest->last_update) {
+                    oldest = &entry;
+                }
+            }
+        }
+        if (sender_len <= max_msg_len) {
+            break;
+        }
+        Drop(*oldest, "Too many bytes in reassembly from one sender");
+    }
+
+    Entry *victim = nullptr;
+    for (Entry &entry : entries) {
+        if (!entry.active) {
+            victim = &entry;
+            break;
+        }
+        if (victim == nullptr || entry.last_update < victim->last_update) {
+            victim = &entry;
+        }
+    }
+    if (victim->active) {
+        Drop(*victim, "Too many packets in reassembly");
+    }
+    if (victim->buffer.size() < msg_len) {
+        victim->buffer.resize(msg_len);
+    }
+    return *victim;
+}
+
+const char *FragmentReassembler::Insert(
+    uint64_t sender, uint64_t msg_id, size_t frag_start, size_t msg_len,
+    const char *data, size_t len, uint64_t now_ms) {
+    if (msg_len == 0 || msg_len > max_msg_len || frag_start >= msg_len ||
+        frag_start % frag_size != 0 ||
+        len != std::min(frag_size, msg_len - frag_start)) {
+        Warning(
+            "Invalid fragment of packet %lx: %zu bytes at %zu of %zu", msg_id,
+            len, frag_start, msg_len);
+        n_invalid += 1;
+        return nullptr;
+    }
+
+    Entry *entry = nullptr;
+    for (Entry &e : entries) {
+        if (e.active && e.sender == sender && e.msg_id == msg_id) {
+            entry = &e;
+        } else if (e.active && now_ms - e.last_update >= timeout_ms) {
+            Drop(e, "Reassembly timed out");
+        }
+        // the last completed message is not used anymore
+        if (!e.active && e.buffer.size() > KEPT_BUFFER_SIZE) {
+            std::vector<char>().swap(e.buffer);
+        }
+    }
+    if (entry == nullptr) {
+        entry = &Allocate(sender, msg_len);
+        entry->active = true;
+        entry->sender = sender;
+        entry->msg_id = msg_id;
+        entry->msg_len = msg_len;
+        entry->received = 0;
+        size_t n_frag = (msg_len - 1) / frag_size + 1;
+        entry->received_frags.assign((n_frag + 63) / 64, 0);
+    } else if (entry->msg_len != msg_len) {
+        Warning(
+            "Fragment of packet %lx has length %zu, expected %zu", msg_id,
+            msg_len, entry->msg_len);
+        n_invalid += 1;
+        return nullptr;
+    }
+    entry->last_update = now_ms;
+
+    size_t frag_index = frag_start / frag_size;
+    uint64_t &word = entry->received_frags[frag_index / 64];
+    uint64_t bit = 1ull << (frag_index % 64);
+    if (word & bit) {
+        Debug("Duplicated fragment of packet %lx at %zu", msg_id, frag_start);
+        return nullptr;
+    }
+    word |= bit;
+    memcpy(&entry->buffer[frag_start], data, len);
+    entry->received += len;
+    if (entry->received < msg_len) {
+        return nullptr;
+    }
+
+    // the buffer is not touched until the entry is reused by next Insert
+    entry->active = false;
+    n_completed += 1;
+    return entry->buffer.data();
+}
+
+} // namespace dsnet
@@ -0,0 +1,62 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace dsnet {
+
+// Reassembles messages that are sent as fragments of frag_size bytes (the
+// last one may be shorter). Fragments may arrive out of order, duplicated,
+// and interleaved with fragments of other messages from the same sender.
+//
+// At most `capacity` messages are in flight at once, and the ones of one
+// sender take at most max_msg_len bytes together. A message that has seen no
+// fragment for timeout_ms is dropped. Starting a new message when the table
+// or the sender's share is full reclaims the least recently updated entry,
+// of the sender if it is over its share. Each entry keeps a buffer of up to
+// KEPT_BUFFER_SIZE bytes across messages, so once every entry has seen such
+// a message, nothing is allocated for messages up to that size, and larger
+// buffers are freed once their message is done.
+class FragmentReassembler {
+public:
+    static const size_t KEPT_BUFFER_SIZE = 1 << 20;
+
+    FragmentReassembler(
+        size_t frag_size, int capacity = 16,
+        size_t max_msg_len = 64 * 1024 * 1024, uint64_t timeout_ms = 1000);
+
+    // Returns the complete message, which is msg_len bytes and stays valid
+    // until the next call, when data is its last missing fragment, and
+    // nullptr otherwise.
+    const char *Insert(
+        uint64_t sender, uint64_t msg_id, size_t frag_start, size_t msg_len,
+        const char *data, size_t len, uint64_t now_ms);
+
+    uint64_t NumCompleted() const { return n_completed; }
+    // incomplete messages that timed out, or whose entry was reclaimed for
+    // another message
+    uint64_t NumDropped() const { return n_dropped; }
+    // fragments that do not fit a message, or are too large
+    uint64_t NumInvalid() const { return n_invalid; }
+
+private:
+    struct Entry {
+        bool active;
+        uint64_t sender, msg_id;
+        size_t msg_len, received;
+        uint64_t last_update;
+        std::vector<char> buffer;
+        std::vector<uint64_t> received_frags; // bitmap
+    };
+
+    size_t frag_size, max_msg_len;
+    uint64_t timeout_ms;
+    std::vector<Entry> entries;
+    uint64_t n_completed, n_dropped, n_invalid;
+
+    Entry &Allocate(uint64_t sender, size_t msg_len);
+    void Drop(Entry &entry, const char *reason);
+};
+
+} // namespace dsnet
@@ -0,0 +1,341 @@
+#include "lib/timerwheel.h"
+#include "lib/assert.h"
+#include "lib/message.h"
+
+namespace dsnet {
+
+static const int ID_MASK = (1 << TimerWheel::ID_BITS) - 1;
+
+TimerWheel::TimerWheel(uint64_t now_ms) : now(now_ms + 1), n_active(0) {
+    for (int level = 0; level < N_LEVEL; level += 1) {
+        for (int i = 0; i < N_SLOT; i += 1) {
+            slots[level][i].prev = slots[level][i].next = &slots[level][i];
+        }
+    }
+}
+
+void TimerWheel::Link(Node &head, Node &node) {
+    node.prev = head.prev;
+    node.next = &head;
+    head.prev->next = &node;
+    head.prev = &node;
+}
+
+void TimerWheel::Unlink(Node &node) {
+    node.prev->next = node.next;
+    node.next->prev = node.prev;
+    node.prev = node.next = &node;
+}
+
+TimerWheel::Entry *TimerWheel::Lookup(int id) {
+    uint32_t index = (id & ((1 << INDEX_BITS) - 1)) - 1;
+    uint32_t generation = (id & ID_MASK) >> INDEX_BITS;
+    if (index >= entries.size()) {
+        return nullptr;
+    }
+    Entry &entry = entries[index];
+    if (!entry.active || entry.generation != generation) {
+        return nullptr;
+    }
+    return &entry;
+}
+
+void TimerWheel::Insert(Entry &entry) {
+    uint64_t expires = entry.expires;
+    Node *head;
+    if (expires < now) {
+        // already due, fire on next tick
+        head = &slots[0][now & (N_SLOT - 1)];
+    } else {
+        uint64_t delta = expires - now;
+        if (delta >= (1ull << (N_LEVEL * LEVEL_BITS))) {
+            delta = (1ull << (N_LEVEL * LEVEL_BITS)) - 1;
+            expires = entry.expires = now + delta;
+        }
+        int level = 0;
+        while (delta >= (1ull << ((level + 1) * LEVEL_BITS))) {
+            level += 1;
+        }
+        head = &slots[level][(expires >> (level * LEVEL_BITS)) & (N_SLOT - 1)];
+    }
+    Link(*head, entry);
+}
+
+void TimerWheel::Cascade(int level, int index) {
+    Node list;
+    list.prev = list.next = &list;
+    Node &head = slots[level][index];
+    if (head.next == &head) {
+        return;
+    }
+    // detach first, entries may go back to the same slot
+    list.next = head.next;
+    list.prev = head.prev;
+    list.next->prev = list.prev->next = &list;
+    head.prev = head.next = &head;
+    while (list.next != &list) {
+        Entry &entry = *static_cast<Entry *>(list.next);
+        Unlink(entry);
+        Insert(entry);
+    }
+}
+
+void TimerWheel::Free(Entry &entry) {
+    entry.active = false;
+    entry.cb = nullptr;
+    entry.generation = (entry.generation + 1) & ((1 << (ID_BITS - INDEX_BITS)) - 1);
+    free_entries.push_back(entry.index);
+    n_active -= 1;
+}
+
+int TimerWheel::Add(uint64_t ms, timer_callback_t cb) {
+    Entry *entry;
+    if (!free_entries.empty()) {
+        entry = &entries[free_entries.back()];
+        free_entries.pop_back();
+    } else {
+        if ((int)entries.size() >= MAX_TIMER) {
+            Panic("Too many timers: %lu", entries.size());
+        }
+        entries.emplace_back();
+        entry = &entries.back();
+        entry->index = entries.size() - 1;
+        entry->generation = 0;
+    }
+    entry->expires = now + ms;
+    entry->cb = std::move(cb);
+    entry->active = true;
+    n_active += 1;
+    Insert(*entry);
+    return IdOf(*entry);
+}
+
+bool TimerWheel::Cancel(int id) {
+    Entry *entry = Lookup(id);
+    if (entry == nullptr) {
+        return false;
+    }
+    Unlink(*entry);
+    Free(*entry);
+    return true;
+}
+
+bool TimerWheel::Reset(int id, uint64_t ms) {
+    Entry *entry = Lookup(id);
+    if (entry == nullptr) {
+        return false;
+    }
+    Unlink(*entry);
+    entry->expires = now + ms;
+    Insert(*entry);
+    return true;
+}
+
+void TimerWheel::CancelAll() {
+    for (Entry &entry : entries) {
+        if (entry.active) {
+            Unlink(entry);
+            Free(entry);
+        }
+    }
+}
+
+void TimerWheel::Advance(uint64_t now_ms) {
+    while (now <= now_ms) {
+        if (n_active == 0) {
+            // nothing to cascade, skip idle ticks
+            now = now_ms + 1;
+            break;
+        }
+
+        int index = now & (N_SLOT - 1);
+        for (int level = 1; index == 0 && level < N_LEVEL; level += 1) {
+            index = (now >> (level * LEVEL_BITS)) & (N_SLOT - 1);
+            Cascade(level, index);
+        }
+
+        Node &head = slots[0][now & (N_SLOT - 1)];
+        Node fired;
+        fired.prev = fired.next = &fired;
+        if (head.next != &head) {
+            fired.next = head.next;
+            fired.prev = head.prev;
+            fired.next->prev = fired.prev->next = &fired;
+            head.prev = head.next = &head;
+        }
+        now += 1;
+        // callbacks may add, reset or cancel timers, including the ones
+        // still in fired list
+        while (fired.next != &fired) {
+            Entry &entry = *static_cast<Entry *>(fired.next);
+            Unlink(entry);
+            timer_callback_t cb = std::move(entry.cb);
+            Free(entry);
+            cb();
+        }
+    }
+}
+
+uint64_t TimerWheel::NextDeadline() const {
+    if (n_active == 0) {
+        return UINT64_MAX;
+    }
+    // level 0 slots hold the timers of the next 256 ticks, one tick each
+    for (uint64_t tick = now; tick < now + N_SLOT; tick += 1) {
+        const Node &head = slots[0][tick & (N_SLOT - 1)];
+        if (head.next != &head) {
+            return tick;
+        }
+    }
+    // a higher level slot is cascaded on the first tick of its span
+    for (int level = 1; level < N_LEVEL; level += 1) {
+        int shift = level * LEVEL_BITS;
+        uint64_t span = (now + (1ull << shift) - 1) >> shift;
+        for (uint64_t i = span; i < span + N_SLOT; i += 1) {
+            const Node &head = slots[level][i & (N_SLOT - 1)];
+            if (head.next != &head) {
+                return i << shift;
+            }
+        }
+    }
+    NOT_REACHABLE();
+}
+
+TimerQueue::TimerQueue(
+    std::function<uint64_t()> clock, int tag, std::function<void()> wakeup)
+    : clock(clock), wheel(clock()), tag(tag), wakeup(wakeup),
+      owner(std::this_thread::get_id()), has_pending(false),
+      last_foreign_id(0) {
+    ASSERT(tag >= 0 && tag <= MAX_TAG);
+}
+
+// `ms` from now in the wheel's time, which lags behind the clock since the
+// last Poll()
+uint64_t TimerQueue::Elapsed(uint64_t ms) {
+    uint64_t now_ms = clock();
+    if (wheel.Empty()) {
+        // catch up on the ticks skipped while idle
+        wheel.Advance(now_ms);
+    }
+    if (now_ms >= wheel.Now()) {
+        ms += now_ms + 1 - wheel.Now();
+    }
+    return ms;
+}
+
+int TimerQueue::Add(uint64_t ms, timer_callback_t cb) {
+    if (IsOwner()) {
+        return Tagged(wheel.Add(Elapsed(ms), std::move(cb)));
+    }
+    int id;
+    do {
+        id = (last_foreign_id.fetch_add(1) + 1) & ID_MASK;
+    } while (id == 0);
+    id = FOREIGN_BIT | Tagged(id);
+    Enqueue({Request::ADD, id, ms, std::move(cb)});
+    return id;
+}
+
+int TimerQueue::WheelId(int id) {
+    if (!(id & FOREIGN_BIT)) {
+        return id & ID_MASK;
+    }
+    auto iter = foreign_ids.find(id);
+    return iter == foreign_ids.end() ? 0 : iter->second;
+}
+
+bool TimerQueue::Cancel(int id) {
+    if (!IsOwner()) {
+        if ((id & ID_MASK) == 0 || Tag(id) != tag) {
+            return false;
+        }
+        Enqueue({Request::CANCEL, id, 0, nullptr});
+        return true;
+    }
+    if (has_pending) {
+        ApplyPending();
+    }
+    return CancelOwned(id);
+}
+
+bool TimerQueue::CancelOwned(int id) {
+    int wheel_id = WheelId(id);
+    if (id & FOREIGN_BIT) {
+        foreign_ids.erase(id);
+    }
+    return wheel_id != 0 && wheel.Cancel(wheel_id);
+}
+
+bool TimerQueue::Reset(int id, uint64_t ms) {
+    if (!IsOwner()) {
+        return false;
+    }
+    if (has_pending) {
+        ApplyPending();
+    }
+    int wheel_id = WheelId(id);
+    return wheel_id != 0 && wheel.Reset(wheel_id, Elapsed(ms));
+}
+
+void TimerQueue::CancelAll() {
+    if (!IsOwner()) {
+        Enqueue({Request::CANCEL_ALL, 0, 0, nullptr});
+        return;
+    }
+    {
+        std::lock_guard<std::mutex> lock(pending_mutex);
+        pending.clear();
+        has_pending = false;
+    }
+    foreign_ids.clear();
+    wheel.CancelAll();
+}
+
+void TimerQueue::Poll() {
+    if (has_pending) {
+        ApplyPending();
+    }
+    wheel.Advance(clock());
+}
+
+void TimerQueue::Enqueue(Request request) {
+    {
+        std::lock_guard<std::mutex> lock(pending_mutex);
+        pending.push_back(std::move(request));
+        has_pending = true;
+    }
+    if (wakeup) {
+        wakeup();
+    }
+}
+
+void TimerQueue::ApplyPending() {
+    {
+        std::lock_guard<std::mutex> lock(pending_mutex);
+        applying.swap(pending);
+        has_pending = false;
+    }
+    for (Request &request : applying) {
+        switch (request.type) {
+        case Request::ADD: {
+            int id = request.id;
+            timer_callback_t cb = std::move(request.cb);
+            foreign_ids[id] = wheel.Add(Elapsed(request.ms), [this, id, cb]() {
+                foreign_ids.erase(id);
+                cb();
+            });
+            break;
+        }
+        case Request::CANCEL:
+            CancelOwned(request.id);
+            break;
+        case Request::CANCEL_ALL:
+            foreign_ids.clear();
+            wheel.CancelAll();
+            break;
+        }
+    }
+    applying.clear();
+}
+
+} // namespace dsnet
@@ -0,0 +1,164 @@
+#pragma once
+#include "lib/transport.h"
+
+#include <atomic>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+namespace dsnet {
+
+// Hierarchical timing wheel with 1 ms ticks, 4 levels of 256 slots. Arming,
+// canceling and resetting a timer are O(1) and allocation free once the entry
+// pool is warm. A timer never fires before its deadline and at most one tick
+// after it, and is moved to a lower level at most 3 times before that.
+//
+// Not thread safe, see TimerQueue.
+class TimerWheel {
+public:
+    static const int MAX_TIMER = (1 << 18) - 2;
+    // ids are never 0 and fit in 26 bits
+    static const int ID_BITS = 26;
+
+    explicit TimerWheel(uint64_t now_ms);
+
+    int Add(uint64_t ms, timer_callback_t cb);
+    bool Cancel(int id);
+    // rearm a pending timer to fire ms from now, keeping its callback
+    bool Reset(int id, uint64_t ms);
+    void CancelAll();
+    // fire every timer due at or before now_ms, in deadline order
+    void Advance(uint64_t now_ms);
+    bool Empty() const { return n_active == 0; }
+    // the next tick to be processed, deadlines are relative to it
+    uint64_t Now() const { return now; }
+    // the earliest deadline if it is within 256 ms, otherwise the tick that
+    // moves the earliest timers to a lower level, which is no later than
+    // their deadline; UINT64_MAX if empty
+    uint64_t NextDeadline() const;
+
+private:
+    static const int LEVEL_BITS = 8;
+    static const int N_SLOT = 1 << LEVEL_BITS;
+    static const int N_LEVEL = 4;
+    static const int INDEX_BITS = 18;
+
+    struct Node {
+        Node *prev, *next;
+    };
+    struct Entry : Node {
+        uint64_t expires;
+        timer_callback_t cb;
+        uint32_t index, generation;
+        bool active;
+    };
+
+    Node slots[N_LEVEL][N_SLOT];
+    // deque for stable addresses, entries are recycled through free_entries
+    std::deque<Entry> entries;
+    std::vector<uint32_t> free_entries;
+    uint64_t now; // next tick to be processed
+    int n_active;
+
+    Entry *Lookup(int id);
+    int IdOf(const Entry &entry) const {
+        return (entry.generation << INDEX_BITS) | (entry.index + 1);
+    }
+    void Insert(Entry &entry);
+    void Cascade(int level, int index);
+    void Free(Entry &entry);
+
+    static void Link(Node &head, Node &node);
+    static void Unlink(Node &node);
+};
+
+// TimerWheel owned by one thread, usually the event loop that calls Poll().
+// The owner operates on the wheel directly without locking. Other threads'
+// requests are queued under a lock and applied by the next Poll(), after
+// calling the wakeup function so that the owner polls soon.
+//
+// clock returns current time in ms. It is read on every Poll(), and when a
+// timer is added or reset, so the owner may stop polling while there is no
+// timer, or until NextDeadline(), and timers still run from when they are
+// added rather than from the last Poll().
+//
+// Ids are tagged, so a transport with one TimerQueue per polling thread can
+// tell which queue an id belongs to.
+class TimerQueue {
+public:
+    static const int MAX_TAG = 15;
+
+    TimerQueue(std::function<uint64_t()> clock, int tag = 0,
+               std::function<void()> wakeup = nullptr);
+
+    // callable from any thread
+    int Add(uint64_t ms, timer_callback_t cb);
+    // true if the timer was pending and is canceled. Not called by the
+    // owner, the cancel is only queued: false for an id of another queue,
+    // otherwise true although the timer may have fired or still fire before
+    // the owner's next Poll()
+    bool Cancel(int id);
+    // returns false if not called by the owner, in which case the caller
+    // should cancel and add a new timer instead
+    bool Reset(int id, uint64_t ms);
+    void CancelAll();
+
+    // owner only
+    void Poll();
+    bool Empty() const { return wheel.Empty() && !has_pending; }
+    // when Poll() is due next, see TimerWheel::NextDeadline
+    uint64_t NextDeadline() const {
+        return has_pending ? clock() : wheel.NextDeadline();
+    }
+
+    void SetOwner(std::thread::id owner) {
+        this->owner.store(owner, std::memory_order_relaxed);
+    }
+    bool IsOwner() const {
+        return std::this_thread::get_id() ==
+               owner.load(std::memory_order_relaxed);
+    }
+    static int Tag(int id) { return (id >> TimerWheel::ID_BITS) & MAX_TAG; }
+
+private:
+    static const int FOREIGN_BIT = 1 << 30;
+
+    struct Request {
+        enum { ADD, CANCEL, CANCEL_ALL } type;
+        int id;
+        uint64_t ms;
+        timer_callback_t cb;
+    };
+
+    std::function<uint64_t()> clock;
+    TimerWheel wheel;
+    int tag;
+    std::function<void()> wakeup;
+    // read by every thread that adds or cancels a timer
+    std::atomic<std::thread::id> owner;
+
+    std::mutex pending_mutex;
+    std::vector<Request> pending;
+    // owner only, swapped with pending to apply it outside the lock, and
+    // kept to reuse its capacity
+    std::vector<Request> applying;
+    std::atomic<bool> has_pending;
+    std::atomic<int> last_foreign_id;
+    // ids handed out to other threads -> wheel id
+    std::unordered_map<int, int> foreign_ids;
+
+    int Tagged(int wheel_id) const {
+        return (tag << TimerWheel::ID_BITS) | wheel_id;
+    }
+    int WheelId(int id);
+    uint64_t Elapsed(uint64_t ms);
+    bool CancelOwned(int id);
+    void Enqueue(Request request);
+    void ApplyPending();
+};
+
+} // namespace dsnet
@@ -31,6 +31,11 @@
 #include "lib/assert.h"
 #include "lib/transport.h"
 
+#include <atomic>
+#include <cstdlib>
+#include <cstring>
+#include <new>
+
 namespace dsnet {
 
 TransportReceiver::~TransportReceiver()
@@ -50,6 +55,64 @@ TransportReceiver::GetAddress()
     return *transport_addr_;
 }
 
+void
+TransportReceiver::ReceiveBuffer(const TransportAddress &remote,
+                                 TransportBuffer buffer)
+{
+    ReceiveMessage(remote, (void *)buffer.data(), buffer.size());
+}
+
+void
+TransportReceiver::ReceiveBatchBegin()
+{
+}
+
+void
+TransportReceiver::ReceiveBatchEnd()
+{
+}
+
+namespace {
+
+// reference count, followed by the message
+struct HeapBuffer
+{
+    std::atomic<int> ref;
+};
+
+class HeapBufferOwner : public TransportBuffer::Owner
+{
+public:
+    void Retain(void *handle) const override {
+        ((HeapBuffer *)handle)->ref.fetch_add(1, std::memory_order_relaxed);
+    }
+    void Release(void *handle) const override {
+        HeapBuffer *buffer = (HeapBuffer *)handle;
+        if (buffer->ref.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+            buffer->~HeapBuffer();
+            free(buffer);
+        }
+    }
+};
+
+const HeapBufferOwner heapBufferOwner;
+
+} // namespace
+
+TransportBuffer
+TransportBuffer::Copy(const void *buf, size_t size)
+{
+    void *p = malloc(sizeof(HeapBuffer) + size);
+    if (p == nullptr) {
+        Panic("Failed to allocate receive buffer");
+    }
+    HeapBuffer *buffer = new (p) HeapBuffer;
+    buffer->ref.store(1, std::memory_order_relaxed);
+    char *data = (char *)(buffer + 1);
+    memcpy(data, buf, size);
+    return TransportBuffer(data, size, &heapBufferOwner, buffer);
+}
+
 Timeout::Timeout(Transport *transport, uint64_t ms, timer_callback_t cb)
     : transport(transport), ms(ms), cb(cb)
 {
@@ -78,6 +141,9 @@ Timeout::Start()
 uint64_t
 Timeout::Reset()
 {
+    if (timerId > 0 && transport->ResetTimer(timerId, ms)) {
+        return ms;
+    }
     Stop();
 
     timerId = transport->Timer(ms, [this]() {
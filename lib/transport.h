@@ -35,6 +35,8 @@
 #include <functional>
 #include <list>
 #include <map>
+#include <string>
+#include <utility>
 #include <unordered_map>
 
 namespace dsnet {
@@ -59,6 +61,71 @@ public:
     virtual TransportAddress *clone() const = 0;
 };
 
+/*
+ * Reference counted handle to a received message, which stays valid after
+ * ReceiveMessage returns for as long as any copy of the handle is alive. The
+ * backing storage belongs to the transport, e.g. an mbuf for DPDKTransport,
+ * and is returned to it when the last handle is destroyed. Copying a handle
+ * only bumps the reference count.
+ */
+class TransportBuffer
+{
+public:
+    class Owner
+    {
+    public:
+        virtual void Retain(void *handle) const = 0;
+        virtual void Release(void *handle) const = 0;
+    };
+
+    TransportBuffer()
+        : data_(nullptr), size_(0), owner_(nullptr), handle_(nullptr) { }
+    // Takes over one reference of handle, which is released through owner.
+    TransportBuffer(const void *data, size_t size,
+                    const Owner *owner, void *handle)
+        : data_((const char *)data), size_(size),
+          owner_(owner), handle_(handle) { }
+    TransportBuffer(const TransportBuffer &other)
+        : data_(other.data_), size_(other.size_),
+          owner_(other.owner_), handle_(other.handle_) {
+        if (owner_ != nullptr) {
+            owner_->Retain(handle_);
+        }
+    }
+    TransportBuffer(TransportBuffer &&other) noexcept
+        : data_(other.data_), size_(other.size_),
+          owner_(other.owner_), handle_(other.handle_) {
+        other.owner_ = nullptr;
+        other.handle_ = nullptr;
+    }
+    TransportBuffer &operator=(TransportBuffer other) {
+        std::swap(data_, other.data_);
+        std::swap(size_, other.size_);
+        std::swap(owner_, other.owner_);
+        std::swap(handle_, other.handle_);
+        return *this;
+    }
+    ~TransportBuffer() {
+        if (owner_ != nullptr) {
+            owner_->Release(handle_);
+        }
+    }
+
+    // Heap backed buffer holding a copy of buf, for transports that reuse
+    // their receive buffers.
+    static TransportBuffer Copy(const void *buf, size_t size);
+
+    const char *data() const { return data_; }
+    size_t size() const { return size_; }
+    std::string ToString() const { return std::string(data_, size_); }
+
+private:
+    const char *data_;
+    size_t size_;
+    const Owner *owner_;
+    void *handle_;
+};
+
 class TransportReceiver
 {
 public:
@@ -67,6 +134,22 @@ public:
     virtual const TransportAddress& GetAddress();
     virtual void ReceiveMessage(const TransportAddress &remote,
                                 void *buf, size_t size) = 0;
+    /*
+     * Called instead of ReceiveMessage by transports that can lend their
+     * receive buffer, i.e. DPDKTransport. Receivers that keep the message
+     * beyond the call (e.g. in a Runner prologue) override this to hold the
+     * buffer instead of copying it.
+     */
+    virtual void ReceiveBuffer(const TransportAddress &remote,
+                               TransportBuffer buffer);
+    /*
+     * Bracket the messages delivered from one receive burst, e.g. one
+     * recvmmsg call of UDPTransport. Receivers may defer the work of the
+     * messages in between and submit it all at once in ReceiveBatchEnd.
+     * Transports that do not receive in bursts never call these.
+     */
+    virtual void ReceiveBatchBegin();
+    virtual void ReceiveBatchEnd();
 
 protected:
     const TransportAddress *transport_addr_;
@@ -132,6 +215,12 @@ public:
                                         const Message &m) = 0;
     virtual int Timer(uint64_t ms, timer_callback_t cb) = 0;
     virtual bool CancelTimer(int id) = 0;
+    /*
+     * Rearm a pending timer to fire ms from now, keeping its callback.
+     * Returns false if not supported or the timer is gone, in which case
+     * the caller cancels it and creates a new one.
+     */
+    virtual bool ResetTimer(int id, uint64_t ms) { return false; }
     virtual void CancelAllTimers() = 0;
     virtual void Run() = 0;
     virtual void Stop() = 0;
@@ -0,0 +1,178 @@
+#include "lib/udpsocket.h"
+#include "lib/assert.h"
+#include "lib/message.h"
+
+#include <arpa/inet.h>
+#include <cstring>
+#include <fcntl.h>
+#include <netdb.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#include <vector>
+
+namespace dsnet {
+
+void WriteFragHeader(
+    char *buf, uint64_t msg_id, size_t frag_start, size_t msg_len) {
+    char *ptr = buf;
+    *((Preamble *)ptr) = FRAG_MAGIC;
+    ptr += sizeof(Preamble);
+    *((uint64_t *)ptr) = msg_id;
+    ptr += sizeof(uint64_t);
+    *((size_t *)ptr) = frag_start;
+    ptr += sizeof(size_t);
+    *((size_t *)ptr) = msg_len;
+}
+
+const char *ReadFragHeader(
+    const char *buf, size_t len, uint64_t *msg_id, size_t *frag_start,
+    size_t *msg_len) {
+    if (len <= FRAG_HEADER_LEN) {
+        return nullptr;
+    }
+    const char *ptr = buf + sizeof(Preamble);
+    *msg_id = *((uint64_t *)ptr);
+    ptr += sizeof(uint64_t);
+    *frag_start = *((size_t *)ptr);
+    ptr += sizeof(size_t);
+    *msg_len = *((size_t *)ptr);
+    ptr += sizeof(size_t);
+    return ptr;
+}
+
+char *SendArena(size_t len) {
+    static thread_local std::vector<char> arena(SEND_SLOT_SIZE);
+    if (arena.size() < len) {
+        arena.resize(len);
+    }
+    return arena.data();
+}
+
+static void
+BindToPort(int fd, const std::string &host, const std::string &port) {
+    struct sockaddr_in sin;
+
+    if ((host == "") && (port == "any")) {
+        // Set up the sockaddr so we're OK with any UDP socket
+        memset(&sin, 0, sizeof(sin));
+        sin.sin_family = AF_INET;
+        sin.sin_port = 0;
+    } else {
+        // Otherwise, look up its hostname and port number (which
+        // might be a service name)
+        struct addrinfo hints;
+        memset(&hints, 0, sizeof(hints));
+        hints.ai_family = AF_INET;
+        hints.ai_socktype = SOCK_DGRAM;
+        hints.ai_protocol = 0;
+        hints.ai_flags = AI_PASSIVE;
+        struct addrinfo *ai;
+        int res;
+        if ((res = getaddrinfo(host.c_str(), port.c_str(), &hints, &ai))) {
+            Panic(
+                "Failed to resolve host/port %s:%s: %s", host.c_str(),
+                port.c_str(), gai_strerror(res));
+        }
+        ASSERT(ai->ai_family == AF_INET);
+        ASSERT(ai->ai_socktype == SOCK_DGRAM);
+        if (ai->ai_addr->sa_family != AF_INET) {
+            Panic("getaddrinfo returned a non IPv4 address");
+        }
+        sin = *(sockaddr_in *)ai->ai_addr;
+
+        freeaddrinfo(ai);
+    }
+
+    Notice("Binding to %s:%d", inet_ntoa(sin.sin_addr), htons(sin.sin_port));
+
+    if (bind(fd, (sockaddr *)&sin, sizeof(sin)) < 0) {
+        PPanic("Failed to bind to socket");
+    }
+}
+
+static int CreateSocket() {
+    int fd;
+    if ((fd = socket(AF_INET, SOCK_DGRAM, 0)) < 0) {
+        PPanic("Failed to create socket to listen");
+    }
+
+    // Put it in non-blocking mode
+    if (fcntl(fd, F_SETFL, O_NONBLOCK, 1)) {
+        PWarning("Failed to set O_NONBLOCK");
+    }
+
+    // Increase buffer size
+    int n = SOCKET_BUF_SIZE;
+    if (setsockopt(fd, SOL_SOCKET, SO_RCVBUF, (char *)&n, sizeof(n)) < 0) {
+        PWarning("Failed to set SO_RCVBUF on socket");
+    }
+    if (setsockopt(fd, SOL_SOCKET, SO_SNDBUF, (char *)&n, sizeof(n)) < 0) {
+        PWarning("Failed to set SO_SNDBUF on socket");
+    }
+    return fd;
+}
+
+int OpenUDPSocket(const ReplicaAddress *addr) {
+    int fd = CreateSocket();
+
+    // Enable outgoing broadcast traffic
+    int n = 1;
+    if (setsockopt(fd, SOL_SOCKET, SO_BROADCAST, (char *)&n, sizeof(n)) < 0) {
+        PWarning("Failed to set SO_BROADCAST on socket");
+    }
+
+    if (addr != nullptr) {
+        BindToPort(fd, addr->host, addr->port);
+    } else {
+        BindToPort(fd, "", "any");
+    }
+    return fd;
+}
+
+int OpenUDPMulticastSocket(const ReplicaAddress &addr) {
+    int fd = CreateSocket();
+
+    int n = 1;
+    if (setsockopt(fd, SOL_SOCKET, SO_REUSEADDR, (char *)&n, sizeof(n)) < 0) {
+        PWarning("Failed to set SO_REUSEADDR on multicast socket");
+    }
+    if (setsockopt(fd, SOL_SOCKET, SO_NO_CHECK, (char *)&n, sizeof(n)) < 0) {
+        PWarning("Failed to set SO_NO_CHECK on multicast socket");
+    }
+
+    // Bind to the specified address
+    BindToPort(fd, addr.host, addr.port);
+    return fd;
+}
+
+sockaddr_in LookupUDPAddress(const ReplicaAddress &addr) {
+    int res;
+    struct addrinfo hints;
+    memset(&hints, 0, sizeof(hints));
+    hints.ai_family = AF_INET;
+    hints.ai_socktype = SOCK_DGRAM;
+    hints.ai_protocol = 0;
+    hints.ai_flags = 0;
+    struct addrinfo *ai;
+    if ((res = getaddrinfo(
+             addr.host.c_str(), addr.port.c_str(), &hints, &ai))) {
+        Panic(
+            "Failed to resolve %s:%s: %s", addr.host.c_str(),
+            addr.port.c_str(), gai_strerror(res));
+    }
+    if (ai->ai_addr->sa_family != AF_INET) {
+        Panic("getaddrinfo returned a non IPv4 address");
+    }
+    sockaddr_in sin = *((sockaddr_in *)ai->ai_addr);
+    freeaddrinfo(ai);
+    return sin;
+}
+
+ReplicaAddress ReverseLookupUDPAddress(const sockaddr_in &sin) {
+    char buf[INET_ADDRSTRLEN];
+    inet_ntop(AF_INET, &sin.sin_addr, buf, sizeof(buf));
+    return ReplicaAddress(
+        std::string(buf), std::to_string(ntohs(sin.sin_port)));
+}
+
+} // namespace dsnet
@@ -0,0 +1,54 @@
+#pragma once
+
+#include "lib/configuration.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <netinet/in.h>
+
+namespace dsnet {
+
+// Datagram format and socket setup shared by the UDP based transports, which
+// are wire compatible with each other.
+//
+// A datagram is either NONFRAG_MAGIC followed by a serialized message, or a
+// fragment header (FRAG_MAGIC, message id, fragment offset, message length)
+// followed by at most MAX_UDP_MESSAGE_SIZE bytes of a larger message.
+
+static const size_t MAX_UDP_MESSAGE_SIZE = 9000; // XXX
+static const int SOCKET_BUF_SIZE = 10485760;
+
+typedef uint32_t Preamble;
+static const Preamble NONFRAG_MAGIC = 0x20050318;
+static const Preamble FRAG_MAGIC = 0x20101010;
+static const size_t FRAG_HEADER_LEN =
+    2 * sizeof(size_t) + sizeof(uint64_t) + sizeof(Preamble);
+// large enough for either a whole non-fragmented message or one fragment
+static const size_t SEND_SLOT_SIZE = MAX_UDP_MESSAGE_SIZE + FRAG_HEADER_LEN;
+
+// write FRAG_HEADER_LEN bytes to buf
+void WriteFragHeader(
+    char *buf, uint64_t msg_id, size_t frag_start, size_t msg_len);
+// returns the fragment payload, or nullptr if datagram is too short
+const char *ReadFragHeader(
+    const char *buf, size_t len, uint64_t *msg_id, size_t *frag_start,
+    size_t *msg_len);
+// identifies the sender of fragments to FragmentReassembler
+inline uint64_t FragSenderKey(const sockaddr_in &sin) {
+    return ((uint64_t)sin.sin_addr.s_addr << 16) | sin.sin_port;
+}
+
+// Per-thread scratch buffer to serialize outgoing messages into. Replica
+// epilogues send from Runner worker threads concurrently, so it is not shared
+// across threads. It only grows, so steady-state sends do no heap allocation.
+char *SendArena(size_t len);
+
+// Non-blocking socket with large buffers, bound to addr, or to any port if
+// addr is nullptr.
+int OpenUDPSocket(const ReplicaAddress *addr);
+int OpenUDPMulticastSocket(const ReplicaAddress &addr);
+
+sockaddr_in LookupUDPAddress(const ReplicaAddress &addr);
+ReplicaAddress ReverseLookupUDPAddress(const sockaddr_in &sin);
+
+} // namespace dsnet
@@ -32,6 +32,7 @@
 #include "lib/assert.h"
 #include "lib/configuration.h"
 #include "lib/message.h"
+#include "lib/udpsocket.h"
 #include "lib/udptransport.h"
 
 #include <google/protobuf/message.h>
@@ -59,12 +60,7 @@
 
 namespace dsnet {
 
-static const size_t MAX_UDP_MESSAGE_SIZE = 9000; // XXX
-static const int SOCKET_BUF_SIZE = 10485760;
-
-typedef uint32_t Preamble;
-static const Preamble NONFRAG_MAGIC = 0x20050318;
-static const Preamble FRAG_MAGIC = 0x20101010;
+static const size_t RECV_BUFFER_SIZE = 65536;
 
 using std::pair;
 
@@ -104,84 +100,40 @@ bool operator<(const UDPTransportAddress &a, const UDPTransportAddress &b)
 UDPTransportAddress
 UDPTransport::LookupAddressInternal(const dsnet::ReplicaAddress &addr) const
 {
-    int res;
-    struct addrinfo hints;
-    hints.ai_family   = AF_INET;
-    hints.ai_socktype = SOCK_DGRAM;
-    hints.ai_protocol = 0;
-    hints.ai_flags    = 0;
-    struct addrinfo *ai;
-    if ((res = getaddrinfo(addr.host.c_str(), addr.port.c_str(), &hints, &ai))) {
-        Panic("Failed to resolve %s:%s: %s",
-              addr.host.c_str(), addr.port.c_str(), gai_strerror(res));
-    }
-    if (ai->ai_addr->sa_family != AF_INET) {
-        Panic("getaddrinfo returned a non IPv4 address");
-    }
-    UDPTransportAddress out =
-        UDPTransportAddress(*((sockaddr_in *)ai->ai_addr));
-    freeaddrinfo(ai);
-    return out;
+    return UDPTransportAddress(LookupUDPAddress(addr));
 }
 
 ReplicaAddress
 UDPTransport::ReverseLookupAddress(const TransportAddress &addr) const
 {
     const UDPTransportAddress *ua = dynamic_cast<const UDPTransportAddress *>(&addr);
-    char buf[16];
-    inet_ntop(AF_INET, &(ua->addr.sin_addr), buf, 16);
-    return ReplicaAddress(std::string(buf), std::to_string(ntohs(ua->addr.sin_port)));
+    return ReverseLookupUDPAddress(ua->addr);
 }
 
-static void
-BindToPort(int fd, const string &host, const string &port)
+static uint64_t
+NowMs()
 {
-    struct sockaddr_in sin;
-
-    if ((host == "") && (port == "any")) {
-        // Set up the sockaddr so we're OK with any UDP socket
-        memset(&sin, 0, sizeof(sin));
-        sin.sin_family = AF_INET;
-        sin.sin_port = 0;
-    } else {
-        // Otherwise, look up its hostname and port number (which
-        // might be a service name)
-        struct addrinfo hints;
-        hints.ai_family   = AF_INET;
-        hints.ai_socktype = SOCK_DGRAM;
-        hints.ai_protocol = 0;
-        hints.ai_flags    = AI_PASSIVE;
-        struct addrinfo *ai;
-        int res;
-        if ((res = getaddrinfo(host.c_str(), port.c_str(),
-                               &hints, &ai))) {
-            Panic("Failed to resolve host/port %s:%s: %s",
-                  host.c_str(), port.c_str(), gai_strerror(res));
-        }
-        ASSERT(ai->ai_family == AF_INET);
-        ASSERT(ai->ai_socktype == SOCK_DGRAM);
-        if (ai->ai_addr->sa_family != AF_INET) {
-            Panic("getaddrinfo returned a non IPv4 address");
-        }
-        sin = *(sockaddr_in *)ai->ai_addr;
-
-        freeaddrinfo(ai);
-    }
-
-    Notice("Binding to %s:%d", inet_ntoa(sin.sin_addr), htons(sin.sin_port));
-
-    if (bind(fd, (sockaddr *)&sin, sizeof(sin)) < 0) {
-        PPanic("Failed to bind to socket");
-    }
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1000 + ts.tv_nsec / 1000000;
 }
 
 UDPTransport::UDPTransport(double dropRate, double reorderRate,
-                           event_base *evbase)
-    : dropRate(dropRate), reorderRate(reorderRate)
+                           event_base *evbase, int ioBatchSize)
+    : dropRate(dropRate), reorderRate(reorderRate),
+      timerQueue(NowMs, 0, [this]() {
+              // timers added or canceled by other threads
+              event_active(timerEvent, EV_TIMEOUT, 0);
+          }),
+      reassembler(MAX_UDP_MESSAGE_SIZE),
+      ioBatchSize(ioBatchSize), loopThread(std::thread::id())
 {
     struct timeval tv;
-    lastTimerId = 0;
     lastFragMsgId = 0;
+    nPendingSend = 0;
+    flushEvent = nullptr;
+    memset(&ioStats, 0, sizeof(ioStats));
+    ASSERT(ioBatchSize >= 1);
 
     uniformDist = std::uniform_real_distribution<double>(0.0, 1.0);
     gettimeofday(&tv, NULL);
@@ -217,15 +169,43 @@ UDPTransport::UDPTransport(double dropRate, double reorderRate,
         event_add(x, NULL);
     }
 
+    timerEvent = event_new(libeventBase, -1, 0, TimerCallback, this);
+    timerArmed = false;
+    timerDeadline = 0;
+
+    if (ioBatchSize > 1) {
+        Notice("Batched socket I/O enabled, batch size = %d", ioBatchSize);
+        recvBuffers.resize(ioBatchSize * RECV_BUFFER_SIZE);
+        recvMsgs.resize(ioBatchSize);
+        recvIovecs.resize(ioBatchSize);
+        recvAddrs.resize(ioBatchSize);
+        sendBuffers.resize(ioBatchSize * SEND_SLOT_SIZE);
+        sendMsgs.resize(ioBatchSize);
+        sendIovecs.resize(ioBatchSize);
+        sendAddrs.resize(ioBatchSize);
+        sendFds.resize(ioBatchSize);
+        // the pointers never change, so set them up once here
+        for (int i = 0; i < ioBatchSize; i++) {
+            recvIovecs[i].iov_base = &recvBuffers[i * RECV_BUFFER_SIZE];
+            recvIovecs[i].iov_len = RECV_BUFFER_SIZE;
+            sendIovecs[i].iov_base = &sendBuffers[i * SEND_SLOT_SIZE];
+        }
+        flushEvent = event_new(libeventBase, -1, 0, FlushCallback, this);
+    }
 }
 
 UDPTransport::~UDPTransport()
 {
-    // XXX Shut down libevent?
+    if (ioBatchSize > 1) {
+        Notice("Average batch size: recv = %.2f (%lu calls), "
+               "send = %.2f (%lu calls)",
+               AvgRecvBatchSize(), ioStats.recvCalls,
+               AvgSendBatchSize(), ioStats.sendCalls);
+        event_free(flushEvent);
+    }
+    event_free(timerEvent);
 
-    // for (auto kv : timers) {
-    //     delete kv.second;
-    // }
+    // XXX Shut down libevent?
 }
 
 void
@@ -235,40 +215,7 @@ UDPTransport::RegisterInternal(TransportReceiver *receiver,
 {
     struct sockaddr_in sin;
 
-    // Create socket
-    int fd;
-    if ((fd = socket(AF_INET, SOCK_DGRAM, 0)) < 0) {
-        PPanic("Failed to create socket to listen");
-    }
-
-    // Put it in non-blocking mode
-    if (fcntl(fd, F_SETFL, O_NONBLOCK, 1)) {
-        PWarning("Failed to set O_NONBLOCK");
-    }
-
-    // Enable outgoing broadcast traffic
-    int n = 1;
-    if (setsockopt(fd, SOL_SOCKET,
-                   SO_BROADCAST, (char *)&n, sizeof(n)) < 0) {
-        PWarning("Failed to set SO_BROADCAST on socket");
-    }
-
-    // Increase buffer size
-    n = SOCKET_BUF_SIZE;
-    if (setsockopt(fd, SOL_SOCKET,
-                   SO_RCVBUF, (char *)&n, sizeof(n)) < 0) {
-        PWarning("Failed to set SO_RCVBUF on socket");
-    }
-    if (setsockopt(fd, SOL_SOCKET,
-                   SO_SNDBUF, (char *)&n, sizeof(n)) < 0) {
-        PWarning("Failed to set SO_SNDBUF on socket");
-    }
-
-    if (addr != nullptr) {
-        BindToPort(fd, addr->host, addr->port);
-    } else {
-        BindToPort(fd, "", "any");
-    }
+    int fd = OpenUDPSocket(addr);
 
     // Set up a libevent callback
     event *ev = event_new(libeventBase, fd, EV_READ | EV_PERSIST,
@@ -310,44 +257,7 @@ UDPTransport::ListenOnMulticast(TransportReceiver *src,
         return;
     }
 
-    int fd;
-
-    // Create socket
-    if ((fd = socket(AF_INET, SOCK_DGRAM, 0)) < 0) {
-        PPanic("Failed to create socket to listen for multicast");
-    }
-
-    // Put it in non-blocking mode
-    if (fcntl(fd, F_SETFL, O_NONBLOCK, 1)) {
-        PWarning("Failed to set O_NONBLOCK on multicast socket");
-    }
-
-    int n = 1;
-    if (setsockopt(fd, SOL_SOCKET,
-                SO_REUSEADDR, (char *)&n, sizeof(n)) < 0) {
-        PWarning("Failed to set SO_REUSEADDR on multicast socket");
-    }
-
-    if (setsockopt(fd, SOL_SOCKET,
-                SO_NO_CHECK, (char *)&n, sizeof(n)) < 0) {
-        PWarning("Failed to set SO_NO_CHECK on multicast socket");
-    }
-
-
-    // Increase buffer size
-    n = SOCKET_BUF_SIZE;
-    if (setsockopt(fd, SOL_SOCKET,
-                SO_RCVBUF, (char *)&n, sizeof(n)) < 0) {
-        PWarning("Failed to set SO_RCVBUF on socket");
-    }
-    if (setsockopt(fd, SOL_SOCKET,
-                SO_SNDBUF, (char *)&n, sizeof(n)) < 0) {
-        PWarning("Failed to set SO_SNDBUF on socket");
-    }
-    // Bind to the specified address
-    BindToPort(fd,
-            canonical->multicast()->host,
-            canonical->multicast()->port);
+    int fd = OpenUDPMulticastSocket(*canonical->multicast());
 
     // Set up a libevent callback
     event *ev = event_new(libeventBase, fd,
@@ -370,72 +280,178 @@ UDPTransport::SendMessageInternal(TransportReceiver *src,
                                   const UDPTransportAddress &dst,
                                   const Message &m)
 {
-    sockaddr_in sin = dst.addr;
-
-    // Serialize message
-    size_t msg_len = sizeof(Preamble) + m.SerializedSize();
-    char *buf = new char[msg_len];
-    char *ptr = buf;
-    *(Preamble *)ptr = NONFRAG_MAGIC;
-    ptr += sizeof(Preamble);
-    m.Serialize(ptr);
-
+    const sockaddr_in &sin = dst.addr;
     int fd = fds[src];
+    size_t msg_len = sizeof(Preamble) + m.SerializedSize();
 
     // XXX All of this assumes that the socket is going to be
     // available for writing, which since it's a UDP socket it ought
     // to be.
     if (msg_len <= MAX_UDP_MESSAGE_SIZE) {
-        if (sendto(fd, buf, msg_len, 0,
-                   (sockaddr *)&sin, sizeof(sin)) < 0) {
+        // Serialize straight into the pending batch slot if there is one
+        char *buf = ReserveSendSlot(fd, sin, msg_len);
+        bool batched = buf != nullptr;
+        if (!batched) {
+            buf = SendArena(msg_len);
+        }
+        *(Preamble *)buf = NONFRAG_MAGIC;
+        m.Serialize(buf + sizeof(Preamble));
+
+        if (!batched && sendto(fd, buf, msg_len, 0,
+                               (const sockaddr *)&sin, sizeof(sin)) < 0) {
             PWarning("Failed to send message");
-            goto fail;
+            return false;
         }
-    } else {
-        msg_len -= sizeof(Preamble);
-        char *body_start = buf + sizeof(Preamble);
-        int num_frags = ((msg_len - 1) / MAX_UDP_MESSAGE_SIZE) + 1;
-        Notice("Sending large %s message in %d fragments",
-               m.Type().c_str(), num_frags);
-        uint64_t msg_id = ++lastFragMsgId;
-        for (size_t frag_start = 0; frag_start < msg_len;
-                frag_start += MAX_UDP_MESSAGE_SIZE) {
-            size_t frag_len = std::min(msg_len - frag_start,
-                                      MAX_UDP_MESSAGE_SIZE);
-            size_t frag_header_len = 2 * sizeof(size_t) + sizeof(uint64_t) + sizeof(Preamble);
-            char frag_buf[frag_len + frag_header_len];
-            char *ptr = frag_buf;
-            *((Preamble *)ptr) = FRAG_MAGIC;
-            ptr += sizeof(Preamble);
-            *((uint64_t *)ptr) = msg_id;
-            ptr += sizeof(uint64_t);
-            *((size_t *)ptr) = frag_start;
-            ptr += sizeof(size_t);
-            *((size_t *)ptr) = msg_len;
-            ptr += sizeof(size_t);
-            memcpy(ptr, &body_start[frag_start], frag_len);
-
-            if (sendto(fd, frag_buf, frag_len + frag_header_len, 0,
-                       (sockaddr *)&sin, sizeof(sin)) < 0) {
-                PWarning("Failed to send message fragment %ld",
-                         frag_start);
-                goto fail;
+        return true;
+    }
+
+    // Fragment path: the body is serialized once, and each fragment is
+    // sent as header + slice of the body without building another buffer
+    msg_len -= sizeof(Preamble);
+    char *body_start = SendArena(msg_len);
+    m.Serialize(body_start);
+    int num_frags = ((msg_len - 1) / MAX_UDP_MESSAGE_SIZE) + 1;
+    Debug("Sending large %s message in %d fragments",
+          m.Type().c_str(), num_frags);
+    uint64_t msg_id = ++lastFragMsgId;
+    for (size_t frag_start = 0; frag_start < msg_len;
+            frag_start += MAX_UDP_MESSAGE_SIZE) {
+        size_t frag_len = std::min(msg_len - frag_start,
+                                  MAX_UDP_MESSAGE_SIZE);
+        char frag_header[FRAG_HEADER_LEN];
+        WriteFragHeader(frag_header, msg_id, frag_start, msg_len);
+
+        iovec iov[2];
+        iov[0].iov_base = frag_header;
+        iov[0].iov_len = FRAG_HEADER_LEN;
+        iov[1].iov_base = &body_start[frag_start];
+        iov[1].iov_len = frag_len;
+        if (!SendDatagram(fd, sin, iov, 2)) {
+            PWarning("Failed to send message fragment %ld",
+                     frag_start);
+            return false;
+        }
+    }
+    return true;
+}
+
+char *
+UDPTransport::ReserveSendSlot(int fd, const sockaddr_in &sin, size_t len)
+{
+    // Only the event loop thread owns the pending batch. Runner workers
+    // and everyone else keep sending directly.
+    if (ioBatchSize == 1 ||
+        std::this_thread::get_id() !=
+            loopThread.load(std::memory_order_relaxed)) {
+        return nullptr;
+    }
+
+    ASSERT(len <= SEND_SLOT_SIZE);
+    if (nPendingSend == ioBatchSize) {
+        FlushSendBatch();
+    }
+    int i = nPendingSend++;
+    sendIovecs[i].iov_len = len;
+    sendAddrs[i] = sin;
+    sendFds[i] = fd;
+    if (i == 0) {
+        // flush after everything already active in this loop turn
+        event_active(flushEvent, EV_TIMEOUT, 0);
+    }
+    // failures are reported (as warnings) on flush
+    return (char *)sendIovecs[i].iov_base;
+}
+
+bool
+UDPTransport::SendDatagram(int fd, const sockaddr_in &sin,
+                           const iovec *iov, int iovcnt)
+{
+    size_t len = 0;
+    for (int i = 0; i < iovcnt; i++) {
+        len += iov[i].iov_len;
+    }
+
+    char *slot = ReserveSendSlot(fd, sin, len);
+    if (slot != nullptr) {
+        for (int i = 0; i < iovcnt; i++) {
+            memcpy(slot, iov[i].iov_base, iov[i].iov_len);
+            slot += iov[i].iov_len;
+        }
+        return true;
+    }
+
+    msghdr msg;
+    memset(&msg, 0, sizeof(msg));
+    msg.msg_name = (void *)&sin;
+    msg.msg_namelen = sizeof(sin);
+    msg.msg_iov = (iovec *)iov;
+    msg.msg_iovlen = iovcnt;
+    return sendmsg(fd, &msg, 0) >= 0;
+}
+
+void
+UDPTransport::FlushSendBatch()
+{
+    int start = 0;
+    while (start < nPendingSend) {
+        // sendmmsg takes one fd, so split the batch into runs of same fd
+        int end = start + 1;
+        while (end < nPendingSend && sendFds[end] == sendFds[start]) {
+            end++;
+        }
+        for (int i = start; i < end; i++) {
+            memset(&sendMsgs[i], 0, sizeof(sendMsgs[i]));
+            sendMsgs[i].msg_hdr.msg_name = &sendAddrs[i];
+            sendMsgs[i].msg_hdr.msg_namelen = sizeof(sendAddrs[i]);
+            sendMsgs[i].msg_hdr.msg_iov = &sendIovecs[i];
+            sendMsgs[i].msg_hdr.msg_iovlen = 1;
+        }
+
+        int i = start;
+        while (i < end) {
+            int n = sendmmsg(sendFds[start], &sendMsgs[i], end - i, 0);
+            if (n < 0) {
+                PWarning("Failed to send message batch");
+                // skip the datagram that fails and keep going
+                n = 1;
+            } else {
+                ioStats.sendCalls++;
+                ioStats.sendDatagrams += n;
             }
+            i += n;
         }
+        start = end;
     }
+    nPendingSend = 0;
+}
 
-    delete [] buf;
-    return true;
+double
+UDPTransport::AvgRecvBatchSize() const
+{
+    return ioStats.recvCalls == 0 ? 0.0 :
+        (double)ioStats.recvDatagrams / ioStats.recvCalls;
+}
 
-fail:
-    delete [] buf;
-    return false;
+double
+UDPTransport::AvgSendBatchSize() const
+{
+    return ioStats.sendCalls == 0 ? 0.0 :
+        (double)ioStats.sendDatagrams / ioStats.sendCalls;
 }
 
 void
 UDPTransport::Run()
 {
+    loopThread.store(std::this_thread::get_id(), std::memory_order_relaxed);
+    timerQueue.SetOwner(std::this_thread::get_id());
+    if (!timerQueue.Empty()) {
+        ArmTimer(timerQueue.NextDeadline());
+    }
     event_base_dispatch(libeventBase);
+    if (nPendingSend > 0) {
+        FlushSendBatch();
+    }
+    loopThread.store(std::thread::id(), std::memory_order_relaxed);
 }
 
 void
@@ -447,13 +463,17 @@ UDPTransport::Stop()
 void
 UDPTransport::OnReadable(int fd)
 {
-    const int BUFSIZE = 65536;
+    if (ioBatchSize > 1) {
+        OnReadableBatch(fd);
+        return;
+    }
+
     ssize_t sz;
-    char buf[BUFSIZE];
+    char buf[RECV_BUFFER_SIZE];
     sockaddr_in sender;
     socklen_t sender_size = sizeof(sender);
 
-    sz = recvfrom(fd, buf, BUFSIZE, 0,
+    sz = recvfrom(fd, buf, RECV_BUFFER_SIZE, 0,
             (struct sockaddr *) &sender, &sender_size);
     if (sz == -1) {
         if (errno == EAGAIN || errno == EWOULDBLOCK) {
@@ -467,6 +487,47 @@ UDPTransport::OnReadable(int fd)
     ProcessPacket(fd, sender, sender_size, buf, sz);
 }
 
+void
+UDPTransport::OnReadableBatch(int fd)
+{
+    for (int i = 0; i < ioBatchSize; i++) {
+        memset(&recvMsgs[i], 0, sizeof(recvMsgs[i]));
+        recvMsgs[i].msg_hdr.msg_name = &recvAddrs[i];
+        recvMsgs[i].msg_hdr.msg_namelen = sizeof(recvAddrs[i]);
+        recvMsgs[i].msg_hdr.msg_iov = &recvIovecs[i];
+        recvMsgs[i].msg_hdr.msg_iovlen = 1;
+    }
+
+    int n = recvmmsg(fd, recvMsgs.data(), ioBatchSize, MSG_DONTWAIT, nullptr);
+    if (n == -1) {
+        if (errno != EAGAIN && errno != EWOULDBLOCK) {
+            PWarning("Failed to receive message batch from socket");
+        }
+        return;
+    }
+    ioStats.recvCalls++;
+    ioStats.recvDatagrams += n;
+
+    // Multicast fds fan out to several receivers, only bracket the
+    // burst for a unicast one
+    TransportReceiver *receiver = nullptr;
+    if (multicastConfigs.find(fd) == multicastConfigs.end()) {
+        receiver = receivers[fd];
+        receiver->ReceiveBatchBegin();
+    }
+    for (int i = 0; i < n; i++) {
+        if (recvMsgs[i].msg_hdr.msg_flags & MSG_TRUNC) {
+            Warning("Received truncated datagram");
+            continue;
+        }
+        ProcessPacket(fd, recvAddrs[i], recvMsgs[i].msg_hdr.msg_namelen,
+                      (char *)recvIovecs[i].iov_base, recvMsgs[i].msg_len);
+    }
+    if (receiver != nullptr) {
+        receiver->ReceiveBatchEnd();
+    }
+}
+
 void
 UDPTransport::ProcessPacket(int fd, sockaddr_in sender, socklen_t sender_size,
                             char *buf, ssize_t sz)
@@ -477,7 +538,7 @@ UDPTransport::ProcessPacket(int fd, sockaddr_in sender, socklen_t sender_size,
     // a fragment. Otherwise, we can process it directly
     ASSERT(sz > (long int)sizeof(Preamble));
     Preamble magic = *(Preamble *)buf;
-    std::unique_ptr<char> copy_buf;
+    std::string reordered;
     void *msg_buf;
     size_t msg_size;
 
@@ -487,53 +548,26 @@ UDPTransport::ProcessPacket(int fd, sockaddr_in sender, socklen_t sender_size,
         msg_size = sz - sizeof(Preamble);
     } else if (magic == FRAG_MAGIC) {
         // This is a fragment. Decode the header
-        const char *ptr = buf;
-        ptr += sizeof(Preamble);
-        ASSERT(ptr - buf < sz);
-        uint64_t msg_id = *((uint64_t *)ptr);
-        ptr += sizeof(uint64_t);
-        ASSERT(ptr - buf < sz);
-        size_t frag_start = *((size_t *)ptr);
-        ptr += sizeof(size_t);
-        ASSERT(ptr - buf < sz);
-        size_t msg_len = *((size_t *)ptr);
-        ptr += sizeof(size_t);
-        ASSERT(ptr - buf < sz);
-        ASSERT(buf + sz - ptr == (ssize_t) std::min(msg_len - frag_start,
-                                                    MAX_UDP_MESSAGE_SIZE));
-        Notice("Received fragment of %zd byte packet %lx starting at %zd",
-               msg_len, msg_id, frag_start);
-        UDPTransportFragInfo &info = fragInfo[sender_addr];
-        if (info.msgId == 0) {
-            info.msgId = msg_id;
-            info.data.clear();
-        }
-        if (info.msgId != msg_id) {
-            ASSERT(msg_id > info.msgId);
-            Warning("Failed to reconstruct packet %lx", info.msgId);
-            info.msgId = msg_id;
-            info.data.clear();
-        }
-
-        if (frag_start != info.data.size()) {
-            Warning("Fragments out of order for packet %lx; "
-                    "expected start %zd, got %zd",
-                    msg_id, info.data.size(), frag_start);
+        uint64_t msg_id;
+        size_t frag_start, msg_len;
+        const char *ptr =
+            ReadFragHeader(buf, sz, &msg_id, &frag_start, &msg_len);
+        if (ptr == nullptr) {
+            Warning("Received fragment too short");
             return;
         }
-
-        info.data.append(string(ptr, buf + sz - ptr));
-        if (info.data.size() == msg_len) {
-            Debug("Completed packet reconstruction");
-            msg_size = info.data.size();
-            copy_buf = std::unique_ptr<char>(new char(msg_size));
-            memcpy(copy_buf.get(), info.data.data(), msg_size);
-            msg_buf = copy_buf.get();
-            info.msgId = 0;
-            info.data.clear();
-        } else {
+        Debug("Received fragment of %zd byte packet %lx starting at %zd",
+              msg_len, msg_id, frag_start);
+        const char *msg = reassembler.Insert(FragSenderKey(sender), msg_id,
+                                             frag_start, msg_len, ptr,
+                                             buf + sz - ptr, NowMs());
+        if (msg == nullptr) {
             return;
         }
+        Debug("Completed packet reconstruction");
+        // valid until next fragment is inserted, i.e. through delivery
+        msg_buf = (void *)msg;
+        msg_size = msg_len;
     } else {
         Warning("Received packet with bad magic number");
         return;
@@ -589,10 +623,9 @@ deliver:
 
     if (reorderBuffer.valid) {
         reorderBuffer.valid = false;
-        msg_size = reorderBuffer.message.size();
-        copy_buf = std::unique_ptr<char>(new char(msg_size));
-        memcpy(copy_buf.get(), reorderBuffer.message.data(), msg_size);
-        msg_buf = copy_buf.get();
+        reordered = std::move(reorderBuffer.message);
+        msg_size = reordered.size();
+        msg_buf = &reordered[0];
         fd = reorderBuffer.fd;
         sender_addr = *(reorderBuffer.addr);
         delete reorderBuffer.addr;
@@ -604,68 +637,58 @@ deliver:
 int
 UDPTransport::Timer(uint64_t ms, timer_callback_t cb)
 {
-    std::lock_guard<std::mutex> lck(this->timersLock);
-    UDPTransportTimerInfo *info = new UDPTransportTimerInfo();
-
-    struct timeval tv;
-    tv.tv_sec = ms / 1000;
-    tv.tv_usec = (ms % 1000) * 1000;
-
-    ++lastTimerId;
-
-    info->transport = this;
-    info->id = lastTimerId;
-    info->cb = cb;
-    info->ev = event_new(libeventBase, -1, 0,
-                         TimerCallback, info);
-
-    timers[info->id] = info;
-
-    event_add(info->ev, &tv);
-
-    return info->id;
+    int id = timerQueue.Add(ms, std::move(cb));
+    if (timerQueue.IsOwner()) {
+        ArmTimer(NowMs() + ms + 1);
+    }
+    return id;
 }
 
 bool
 UDPTransport::CancelTimer(int id)
 {
-    std::lock_guard<std::mutex> l(this->timersLock);
-    UDPTransportTimerInfo *info = timers[id];
+    return timerQueue.Cancel(id);
+}
 
-    if (info == NULL) {
+bool
+UDPTransport::ResetTimer(int id, uint64_t ms)
+{
+    if (!timerQueue.Reset(id, ms)) {
         return false;
     }
-
-    event_del(info->ev);
-    event_free(info->ev);
-    timers.erase(info->id);
-    delete info;
-
+    ArmTimer(NowMs() + ms + 1);
     return true;
 }
 
 void
 UDPTransport::CancelAllTimers()
 {
-    while (!timers.empty()) {
-        auto kv = timers.begin();
-        CancelTimer(kv->first);
-    }
+    timerQueue.CancelAll();
 }
 
+// arm the timer event to fire at `deadline` unless it fires earlier already
 void
-UDPTransport::OnTimer(UDPTransportTimerInfo *info)
+UDPTransport::ArmTimer(uint64_t deadline)
 {
-    {
-        std::lock_guard<std::mutex> l(this->timersLock);
-        timers.erase(info->id);
-        event_del(info->ev);
-        event_free(info->ev);
+    if (timerArmed && deadline >= timerDeadline) {
+        return;
     }
+    uint64_t now = NowMs();
+    uint64_t ms = deadline > now ? deadline - now : 0;
+    struct timeval tv = {(time_t)(ms / 1000), (suseconds_t)(ms % 1000 * 1000)};
+    event_add(timerEvent, &tv);
+    timerArmed = true;
+    timerDeadline = deadline;
+}
 
-    info->cb();
-
-    delete info;
+void
+UDPTransport::OnTimer()
+{
+    timerArmed = false;
+    timerQueue.Poll();
+    if (!timerQueue.Empty()) {
+        ArmTimer(timerQueue.NextDeadline());
+    }
 }
 
 void
@@ -680,12 +703,18 @@ UDPTransport::SocketCallback(evutil_socket_t fd, short what, void *arg)
 void
 UDPTransport::TimerCallback(evutil_socket_t fd, short what, void *arg)
 {
-    UDPTransport::UDPTransportTimerInfo *info =
-        (UDPTransport::UDPTransportTimerInfo *)arg;
+    UDPTransport *transport = (UDPTransport *)arg;
 
     ASSERT(what & EV_TIMEOUT);
 
-    info->transport->OnTimer(info);
+    transport->OnTimer();
+}
+
+void
+UDPTransport::FlushCallback(evutil_socket_t fd, short what, void *arg)
+{
+    UDPTransport *transport = (UDPTransport *)arg;
+    transport->FlushSendBatch();
 }
 
 void
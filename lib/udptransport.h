@@ -32,19 +32,24 @@
 #pragma once
 
 #include "lib/configuration.h"
+#include "lib/reassembler.h"
+#include "lib/timerwheel.h"
 #include "lib/transport.h"
 #include "lib/transportcommon.h"
 
 #include <event2/event.h>
 
+#include <atomic>
 #include <map>
 #include <list>
 #include <vector>
 #include <unordered_map>
 #include <random>
 #include <netinet/in.h>
+#include <sys/socket.h>
 #include <map>
 #include <mutex>
+#include <thread>
 
 namespace dsnet {
 
@@ -58,6 +63,7 @@ private:
     UDPTransportAddress(const sockaddr_in &addr);
     sockaddr_in addr;
     friend class UDPTransport;
+    friend class IOUringTransport;
     friend bool operator==(const UDPTransportAddress &a,
                            const UDPTransportAddress &b);
     friend bool operator!=(const UDPTransportAddress &a,
@@ -69,8 +75,12 @@ private:
 class UDPTransport : public TransportCommon<UDPTransportAddress>
 {
 public:
+    // ioBatchSize > 1 enables batched socket I/O: up to ioBatchSize
+    // datagrams are drained per wakeup with recvmmsg, and datagrams sent
+    // from the event loop thread are coalesced into sendmmsg until the end
+    // of current event loop turn
     UDPTransport(double dropRate = 0.0, double reorderRate = 0.0,
-                 event_base *evbase = nullptr);
+                 event_base *evbase = nullptr, int ioBatchSize = 1);
     virtual ~UDPTransport();
     virtual void RegisterInternal(TransportReceiver *receiver,
                                   const dsnet::ReplicaAddress *addr,
@@ -81,19 +91,16 @@ public:
     void Stop() override;
     int Timer(uint64_t ms, timer_callback_t cb) override;
     bool CancelTimer(int id) override;
+    bool ResetTimer(int id, uint64_t ms) override;
     void CancelAllTimers() override;
     virtual ReplicaAddress
     ReverseLookupAddress(const TransportAddress &addr) const override;
 
-private:
-    struct UDPTransportTimerInfo
-    {
-        UDPTransport *transport;
-        timer_callback_t cb;
-        event *ev;
-        int id;
-    };
+    // average number of datagrams per recvmmsg/sendmmsg call
+    double AvgRecvBatchSize() const;
+    double AvgSendBatchSize() const;
 
+private:
     double dropRate;
     double reorderRate;
     std::uniform_real_distribution<double> uniformDist;
@@ -112,16 +119,32 @@ private:
     std::map<TransportReceiver*, int> fds; // receiver -> fd
     std::map<const dsnet::Configuration *, int> multicastFds;
     std::map<int, const dsnet::Configuration *> multicastConfigs;
-    int lastTimerId;
-    std::map<int, UDPTransportTimerInfo *> timers;
-    std::mutex timersLock;
-    uint64_t lastFragMsgId;
-    struct UDPTransportFragInfo
+    // owned by the event loop thread, which polls it from an event armed
+    // at the next deadline while there are pending timers
+    TimerQueue timerQueue;
+    event *timerEvent;
+    bool timerArmed;
+    uint64_t timerDeadline;
+    // runner workers may send fragmented messages concurrently
+    std::atomic<uint64_t> lastFragMsgId;
+    FragmentReassembler reassembler;
+
+    // batched I/O states, only used when ioBatchSize > 1
+    int ioBatchSize;
+    // read by runner workers on every send
+    std::atomic<std::thread::id> loopThread;
+    std::vector<char> recvBuffers, sendBuffers;
+    std::vector<mmsghdr> recvMsgs, sendMsgs;
+    std::vector<iovec> recvIovecs, sendIovecs;
+    std::vector<sockaddr_in> recvAddrs, sendAddrs;
+    std::vector<int> sendFds;
+    int nPendingSend;
+    event *flushEvent;
+    struct
     {
-        uint64_t msgId;
-        string data;
-    };
-    std::map<UDPTransportAddress, UDPTransportFragInfo> fragInfo;
+        uint64_t recvCalls, recvDatagrams;
+        uint64_t sendCalls, sendDatagrams;
+    } ioStats;
 
     bool SendMessageInternal(TransportReceiver *src,
                              const UDPTransportAddress &dst,
@@ -129,13 +152,21 @@ private:
     UDPTransportAddress
     LookupAddressInternal(const dsnet::ReplicaAddress &addr) const override;
     void OnReadable(int fd);
+    void OnReadableBatch(int fd);
+    char *ReserveSendSlot(int fd, const sockaddr_in &sin, size_t len);
+    bool SendDatagram(int fd, const sockaddr_in &sin,
+                      const iovec *iov, int iovcnt);
+    void FlushSendBatch();
     void ProcessPacket(int fd, sockaddr_in sender, socklen_t senderSize,
                      char *buf, ssize_t sz);
-    void OnTimer(UDPTransportTimerInfo *info);
+    void OnTimer();
+    void ArmTimer(uint64_t deadline);
     static void SocketCallback(evutil_socket_t fd,
                                short what, void *arg);
     static void TimerCallback(evutil_socket_t fd,
                               short what, void *arg);
+    static void FlushCallback(evutil_socket_t fd,
+                              short what, void *arg);
     static void LogCallback(int severity, const char *msg);
     static void FatalCallback(int err);
     static void SignalCallback(evutil_socket_t fd,
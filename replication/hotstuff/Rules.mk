@@ -1,7 +1,7 @@
 d := $(dir $(lastword $(MAKEFILE_LIST)))
 
 SRCS += $(addprefix $(d), \
-	replica.cc client.cc)
+	replica.cc client.cc qc.cc)
 
 PROTOS += $(addprefix $(d), \
 	    message.proto)
@@ -10,9 +10,13 @@ OBJS-hotstuff-client := $(o)client.o $(o)message.o \
                $(OBJS-client) $(LIB-message) \
                $(LIB-configuration) $(LIB-pbmessage) $(LIB-signedadapter)
 
-OBJS-hotstuff-replica := $(o)replica.o $(o)message.o \
+LIB-hotstuff-qc := $(o)qc.o $(o)message.o $(LIB-request) \
+               $(LIB-pbmessage) $(LIB-signedadapter) $(LIB-multisig)
+
+OBJS-hotstuff-replica := $(o)replica.o $(LIB-hotstuff-qc) \
                $(OBJS-replica) $(LIB-message) \
-               $(LIB-configuration) $(LIB-pbmessage) $(LIB-signedadapter) \
-               $(LIB-runner) $(LIB-latency)
+               $(LIB-configuration) \
+               $(LIB-runner) $(LIB-latency) \
+               .obj/sequencer/sequencer.o  # hack for reusing BufferMessage
 
-$(o)client.o $(o)replica.o: $(o)message.o
+$(o)client.o $(o)replica.o $(o)qc.o: $(o)message.o
@@ -0,0 +1,331 @@
+#include "replication/hotstuff/qc.h"
+#include "common/keyregistry.h"
+#include "common/pbmessage.h"
+#include "common/signedadapter.h"
+#include "lib/message.h"
+
+#include <algorithm>
+
+namespace dsnet {
+namespace hotstuff {
+
+using std::move;
+using std::string;
+using std::unique_ptr;
+using std::vector;
+
+string VoteDigest(opnum_t op_number) {
+    return string((const char *)&op_number, sizeof(op_number));
+}
+
+string MultiSigSecret(const Configuration &config, int index) {
+    const string &identifier = config.identity(index);
+    if (const string *secret = KeyRegistry::FindMultiSig(identifier)) {
+        return *secret;
+    }
+    if (identifier != "Steve") {
+        Panic("No multisig key of %s", identifier.c_str());
+    }
+    return MultiSigGroup::TestSecret(index);
+}
+
+unique_ptr<MultiSigGroup> NewMultiSigGroup(const Configuration &config) {
+    vector<string> public_keys;
+    for (int i = 0; i < config.n; i += 1) {
+        string key = MultiSigGroup::PublicKey(MultiSigSecret(config, i));
+        if (key.empty()) {
+            Panic("Invalid multisig key of replica %d", i);
+        }
+        public_keys.push_back(move(key));
+    }
+    return unique_ptr<MultiSigGroup>(new MultiSigGroup(public_keys));
+}
+
+bool VerifyQC(
+    const proto::QC &qc, const MultiSigGroup *group, int n_backup_vote) {
+    if (!qc.aggregate_signature().empty()) {
+        // the primary signs as well
+        return group != nullptr &&
+               __builtin_popcountll(qc.signers()) >= n_backup_vote + 1 &&
+               group->Verify(
+                   qc.signers(), VoteDigest(qc.op_number()),
+                   qc.aggregate_signature());
+    }
+
+    // TODO check vote count, check vote from different backups
+    static thread_local SignedBatch<proto::VoteMessage, PBMessage> votes;
+    return votes.Parse("", qc.signed_vote());
+}
+
+QCCollector::QCCollector(
+    vector<string> identities, int replica_index, int n_backup_vote,
+    string vote0, const MultiSigGroup *group, const string &secret)
+    : n_replica(identities.size()), replica_index(replica_index),
+      n_backup_vote(n_backup_vote), identities(move(identities)),
+      vote0(move(vote0)), group(group), next_qc(0), nonces(n_replica),
+      last_voted(n_replica, 0), last_used(n_replica, 0) {
+    if (group != nullptr) {
+        signer.reset(new MultiSigner(*group, replica_index, secret));
+    }
+}
+
+void QCCollector::Plan(proto::Block &block) {
+    if (group == nullptr) {
+        return;
+    }
+    std::lock_guard<std::mutex> lock(mutex);
+    vector<int> backups;
+    for (int i = 0; i < n_replica; i += 1) {
+        if (i != replica_index && !nonces[i].empty()) {
+            backups.push_back(i);
+        }
+    }
+    if ((int)backups.size() < n_backup_vote) {
+        return;
+    }
+    // the most up to date ones are the most likely to vote soon
+    std::sort(backups.begin(), backups.end(), [this](int a, int b) {
+        return last_voted[a] > last_voted[b] ||
+               (last_voted[a] == last_voted[b] && a < b);
+    });
+    uint64_t signers = 1ull << replica_index;
+    for (int i = 0; i < n_backup_vote; i += 1) {
+        signers |= 1ull << backups[i];
+    }
+
+    vector<string> published;
+    for (int i = 0; i < n_replica; i += 1) {
+        if (!(signers >> i & 1)) {
+            continue;
+        }
+        if (i == replica_index) {
+            block.add_nonce_seq(block.op_number());
+            published.push_back(signer->Commit(block.op_number()));
+            continue;
+        }
+        auto nonce = nonces[i].begin();
+        block.add_nonce_seq(nonce->first);
+        published.push_back(move(nonce->second));
+        last_used[i] = nonce->first;
+        nonces[i].erase(nonce);
+    }
+    string aggregate_nonce = MultiSigGroup::AggregateNonce(published);
+    if (aggregate_nonce.empty()) {
+        Warning("Malformed nonce, no aggregate QC planned");
+        block.clear_nonce_seq();
+        return;
+    }
+    block.set_signers(signers);
+    block.set_aggregate_nonce(aggregate_nonce);
+    VoteSet &votes = vote_sets[block.op_number()];
+    votes.signers = signers;
+    votes.aggregate_nonce = move(aggregate_nonce);
+}
+
+unique_ptr<proto::QC> QCCollector::Add(
+    const proto::VoteMessage &vote, const string &signer,
+    const TransportBuffer &signed_vote //
+) {
+    int replica = vote.replica_index();
+    if (replica < 0 || replica >= n_replica || replica == replica_index ||
+        signer != identities[replica]) {
+        return nullptr;
+    }
+    // nonces of late votes are still good
+    if (vote.nonce().empty() &&
+        vote.op_number() < next_qc.load(std::memory_order_relaxed)) {
+        return nullptr;
+    }
+
+    std::lock_guard<std::mutex> lock(mutex);
+    if (!vote.nonce().empty()) {
+        AddNonce(replica, vote.nonce_seq(), vote.nonce());
+    }
+    last_voted[replica] = std::max(last_voted[replica], vote.op_number());
+    // collected by another worker meanwhile
+    if (vote.op_number() < next_qc.load(std::memory_order_relaxed)) {
+        return nullptr;
+    }
+
+    // RDebug(
+    //     "vote: op_number = %lu, replic id = %d", vote.op_number(),
+    //     vote.replica_index());
+    VoteSet &votes = vote_sets[vote.op_number()];
+    votes.signed_votes[replica].assign(signed_vote.data(), signed_vote.size());
+    if (!vote.partial_signature().empty()) {
+        votes.partials[replica] = vote.partial_signature();
+    }
+    if (votes.signers != 0) {
+        return CollectAggregate(vote.op_number());
+    }
+    // collect 2f from backups, then add one from self
+    if ((int)votes.signed_votes.size() < n_backup_vote) {
+        return nullptr;
+    }
+    return Collect(vote.op_number());
+}
+
+void QCCollector::AddNonces(
+    const proto::NonceMessage &message, const string &signer) {
+    int replica = message.replica_index();
+    if (group == nullptr || replica < 0 || replica >= n_replica ||
+        replica == replica_index || signer != identities[replica]) {
+        return;
+    }
+    std::lock_guard<std::mutex> lock(mutex);
+    for (int i = 0; i < message.nonce_size(); i += 1) {
+        AddNonce(replica, message.nonce_seq() + i, message.nonce(i));
+    }
+}
+
+void QCCollector::AddNonce(int replica, uint64_t seq, const string &nonce) {
+    // the signer forgets the nonces before the one used last
+    if (seq <= last_used[replica]) {
+        return;
+    }
+    nonces[replica][seq] = nonce;
+    while (nonces[replica].size() > NONCE_POOL) {
+        nonces[replica].erase(nonces[replica].begin());
+    }
+}
+
+unique_ptr<proto::QC> QCCollector::Fallback() {
+    std::lock_guard<std::mutex> lock(mutex);
+    for (auto iter = vote_sets.rbegin(); iter != vote_sets.rend(); ++iter) {
+        if ((int)iter->second.signed_votes.size() >= n_backup_vote) {
+            Notice(
+                "Aggregate QC stalled, fall back: op number = %lu",
+                iter->first);
+            return Collect(iter->first);
+        }
+    }
+    return nullptr;
+}
+
+unique_ptr<proto::QC> QCCollector::Collect(opnum_t op_number) {
+    unique_ptr<proto::QC> qc(new proto::QC);
+    qc->set_op_number(op_number);
+    for (const auto &iter : vote_sets[op_number].signed_votes) {
+        qc->add_signed_vote(iter.second);
+    }
+
+    // it takes too long to add primary's partial signature into QC
+    // so it is disabled until find a good way to do it async.
+
+    // proto::VoteMessage vote_message;
+    // vote_message.set_op_number(vote.op_number());
+    // vote_message.set_replica_index(replicaIdx);
+    // PBMessage pb_vote(vote_message);
+    // SignedAdapter signed_vote(pb_vote, identifier);
+    // string signed_vote_buf;
+    // signed_vote_buf.resize(signed_vote.SerializedSize());
+    // signed_vote.Serialize(&signed_vote_buf.front());
+    // qc.add_signed_vote(signed_vote_buf);
+    qc->add_signed_vote(vote0); // currently backup don't check vote op number
+
+    // the QC supersedes every lower one, in-construct or not
+    next_qc.store(op_number + 1, std::memory_order_relaxed);
+    vote_sets.erase(vote_sets.begin(), vote_sets.upper_bound(op_number));
+    if (signer) {
+        signer->Forget(op_number + 1);
+    }
+    return qc;
+}
+
+// nullptr if waiting for more partials
+unique_ptr<proto::QC> QCCollector::CollectAggregate(opnum_t op_number) {
+    VoteSet &votes = vote_sets[op_number];
+    for (int i = 0; i < n_replica; i += 1) {
+        if (i != replica_index && votes.signers >> i & 1 &&
+            !votes.partials.count(i)) {
+            return nullptr;
+        }
+    }
+
+    string message = VoteDigest(op_number), own_partial;
+    vector<string> partials;
+    bool signed_by_self = signer->Sign(
+        op_number, votes.signers, votes.aggregate_nonce, message,
+        own_partial);
+    for (int i = 0; i < n_replica; i += 1) {
+        if (i == replica_index) {
+            partials.push_back(own_partial);
+        } else if (votes.signers >> i & 1) {
+            partials.push_back(votes.partials[i]);
+        }
+    }
+    string signature = signed_by_self ? group->Aggregate(
+                                            votes.signers,
+                                            votes.aggregate_nonce, message,
+                                            partials)
+                                      : "";
+    // one of the partials is bad, which the signed votes cannot tell
+    if (signature.empty() ||
+        !group->Verify(votes.signers, message, signature)) {
+        Warning("Aggregate QC fail to verify: op number = %lu", op_number);
+        votes.signers = 0;
+        if ((int)votes.signed_votes.size() < n_backup_vote) {
+            return nullptr;
+        }
+        return Collect(op_number);
+    }
+
+    unique_ptr<proto::QC> qc(new proto::QC);
+    qc->set_op_number(op_number);
+    qc->set_signers(votes.signers);
+    qc->set_aggregate_signature(signature);
+    next_qc.store(op_number + 1, std::memory_order_relaxed);
+    vote_sets.erase(vote_sets.begin(), vote_sets.upper_bound(op_number));
+    return qc;
+}
+
+VoteSigner::VoteSigner(
+    const MultiSigGroup &group, int replica_index, const string &secret)
+    : signer(group, replica_index, secret), replica_index(replica_index),
+      next_seq(1) {}
+
+uint64_t VoteSigner::Commit(int n_nonce, vector<string> &nonces) {
+    uint64_t seq = next_seq.fetch_add(n_nonce);
+    for (int i = 0; i < n_nonce; i += 1) {
+        nonces.push_back(signer.Commit(seq + i));
+    }
+    // the primary only keeps the latest ones as well
+    if (seq > 4 * NONCE_WINDOW) {
+        signer.Forget(seq - 4 * NONCE_WINDOW);
+    }
+    return seq;
+}
+
+void VoteSigner::Publish(proto::NonceMessage &message) {
+    vector<string> nonces;
+    message.set_replica_index(replica_index);
+    message.set_nonce_seq(Commit(NONCE_WINDOW, nonces));
+    for (string &nonce : nonces) {
+        message.add_nonce(move(nonce));
+    }
+}
+
+void VoteSigner::Fill(proto::VoteMessage &vote, const proto::Block *block) {
+    vector<string> nonces;
+    vote.set_nonce_seq(Commit(1, nonces));
+    vote.set_nonce(move(nonces[0]));
+
+    if (block == nullptr || !(block->signers() >> replica_index & 1)) {
+        return;
+    }
+    int rank = __builtin_popcountll(
+        block->signers() & ((1ull << replica_index) - 1));
+    if (rank >= block->nonce_seq_size()) {
+        return;
+    }
+    string partial;
+    if (signer.Sign(
+            block->nonce_seq(rank), block->signers(),
+            block->aggregate_nonce(), VoteDigest(block->op_number()),
+            partial)) {
+        vote.set_partial_signature(partial);
+    }
+}
+
+} // namespace hotstuff
+} // namespace dsnet
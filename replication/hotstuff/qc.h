@@ -0,0 +1,133 @@
+#pragma once
+#include "common/multisig.h"
+#include "lib/configuration.h"
+#include "lib/transport.h"
+#include "lib/viewstamp.h"
+#include "replication/hotstuff/message.pb.h"
+
+#include <atomic>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace dsnet {
+namespace hotstuff {
+
+// A QC certifies a block with the votes of 2f + 1 replicas. By default it
+// carries the signed votes one by one, so Generic messages grow with n and
+// backups verify 2f + 1 signatures per block. In aggregate mode it carries
+// one MultiSigGroup signature of the voters instead, which verifies at a
+// constant cost. Votes are signed in both modes, and a QC falls back to the
+// signed votes when its aggregate cannot complete, e.g. a signer is slow.
+//
+// For aggregate mode, backups publish multi-signature nonces, one in each
+// vote plus batches in NonceMessage, and the primary plans the signers of
+// each block when proposing it: 2f backups that have nonces and voted most
+// recently, plus itself. The block carries the plan, and the planned backups
+// add a partial signature to their votes for it.
+
+// what replicas multi-sign when voting for the block
+std::string VoteDigest(opnum_t op_number);
+
+// multi-signature secret of replica `index`, which is the 'multisig' key of
+// its identity in KeyRegistry, or the test secret of the index if it is the
+// built-in "Steve". Panic if neither
+std::string MultiSigSecret(const Configuration &config, int index);
+// the group of every replica, see MultiSigSecret
+std::unique_ptr<MultiSigGroup> NewMultiSigGroup(const Configuration &config);
+
+// `group` is nullptr in vector mode, `n_backup_vote` is 2f. Thread safe
+bool VerifyQC(
+    const proto::QC &qc, const MultiSigGroup *group, int n_backup_vote);
+
+// primary side, thread safe
+class QCCollector {
+public:
+    // `identities` are the identifiers replicas sign with by index, `vote0`
+    // is the primary's own signed vote carried by vector QCs, `group` is
+    // nullptr in vector mode, and `secret` is the primary's multi-signature
+    // secret otherwise
+    QCCollector(
+        std::vector<std::string> identities, int replica_index,
+        int n_backup_vote, std::string vote0, const MultiSigGroup *group,
+        const std::string &secret = "");
+
+    // plan the signers of a block that is about to be proposed, no-op in
+    // vector mode or if not enough backups have nonces
+    void Plan(proto::Block &block);
+    // the QC if `vote` completes one that is newer than every QC returned
+    // before, otherwise nullptr. `signer` is the identifier that signed the
+    // message, votes and nonces only count if it is the identity of their
+    // replica index
+    std::unique_ptr<proto::QC> Add(
+        const proto::VoteMessage &vote, const std::string &signer,
+        const TransportBuffer &signed_vote);
+    void AddNonces(
+        const proto::NonceMessage &message, const std::string &signer);
+    // the vector QC of the highest block that has enough signed votes but is
+    // still waiting for partial signatures, or nullptr
+    std::unique_ptr<proto::QC> Fallback();
+
+private:
+    // primary keeps that many latest nonces of each backup
+    static const size_t NONCE_POOL = 16;
+
+    int n_replica, replica_index, n_backup_vote;
+    std::vector<std::string> identities;
+    std::string vote0;
+    const MultiSigGroup *group;
+    std::unique_ptr<MultiSigner> signer;
+
+    std::mutex mutex;
+    struct VoteSet {
+        std::map<int, std::string> signed_votes, partials;
+        // zero if no aggregate is planned
+        uint64_t signers = 0;
+        std::string aggregate_nonce;
+    };
+    // in-construct QCs, op number -> votes; op number is the "hash" of block
+    // in vote message, we pretend it could prove content matching for now
+    std::map<opnum_t, VoteSet> vote_sets;
+    // one after the highest op number a QC is collected for, votes before it
+    // are late
+    std::atomic<opnum_t> next_qc;
+    // replica id -> nonce seq -> published nonce
+    std::vector<std::map<uint64_t, std::string>> nonces;
+    std::vector<opnum_t> last_voted;
+    std::vector<uint64_t> last_used;
+
+    // with `mutex` held
+    void AddNonce(int replica, uint64_t seq, const std::string &nonce);
+    std::unique_ptr<proto::QC> Collect(opnum_t op_number);
+    std::unique_ptr<proto::QC> CollectAggregate(opnum_t op_number);
+};
+
+// backup side, thread safe
+class VoteSigner {
+public:
+    // nonces published ahead of being used
+    static const int NONCE_WINDOW = 8;
+
+    VoteSigner(
+        const MultiSigGroup &group, int replica_index,
+        const std::string &secret);
+
+    // publish a fresh nonce in the vote, and sign it as planned by the block
+    // if this replica is a planned signer
+    void Fill(proto::VoteMessage &vote, const proto::Block *block);
+    // publish NONCE_WINDOW fresh nonces
+    void Publish(proto::NonceMessage &message);
+
+private:
+    MultiSigner signer;
+    int replica_index;
+    std::atomic<uint64_t> next_seq;
+
+    // seq of the first one of `n_nonce` fresh nonces
+    uint64_t Commit(int n_nonce, std::vector<std::string> &nonces);
+};
+
+} // namespace hotstuff
+} // namespace dsnet
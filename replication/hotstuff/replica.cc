@@ -2,6 +2,8 @@
 #include "common/signedadapter.h"
 #include "lib/assert.h"
 #include "lib/latency.h"
+#include "sequencer/sequencer.h"
+#include <algorithm>
 #include <cstdlib>
 
 #define RDebug(fmt, ...) Debug("[%d] " fmt, this->replicaIdx, ##__VA_ARGS__)
@@ -19,17 +21,75 @@ using std::vector;
 
 HotStuffReplica::HotStuffReplica( //
     const Configuration &config, int index, string identifier, int n_thread,
-    int batch_size, Transport *transport, AppReplica *app)
+    int batch_size, Transport *transport, AppReplica *app,
+    opnum_t checkpoint_interval, bool aggregate_qc, uint64_t target_latency_us)
+    : HotStuffReplica(
+          config, index, move(identifier),
+          unique_ptr<Runner>(new SpinRunner(n_thread)), nullptr, batch_size,
+          transport, app, checkpoint_interval, aggregate_qc,
+          target_latency_us) {}
+
+HotStuffReplica::HotStuffReplica( //
+    const Configuration &config, int index, string identifier,
+    Runner &runner, int batch_size, Transport *transport, AppReplica *app,
+    opnum_t checkpoint_interval, bool aggregate_qc, uint64_t target_latency_us)
+    : HotStuffReplica(
+          config, index, move(identifier), nullptr, &runner, batch_size,
+          transport, app, checkpoint_interval, aggregate_qc,
+          target_latency_us) {}
+
+HotStuffReplica::HotStuffReplica( //
+    const Configuration &config, int index, string identifier,
+    unique_ptr<Runner> owned_runner, Runner *external_runner, int batch_size,
+    Transport *transport, AppReplica *app, opnum_t checkpoint_interval,
+    bool aggregate_qc, uint64_t target_latency_us)
     : Replica(config, 0, index, false, transport, app), identifier(identifier),
-      runner(n_thread), batch_size(batch_size), log(false) //
+      owned_runner(move(owned_runner)),
+      runner(
+          external_runner != nullptr ? *external_runner
+                                     : *this->owned_runner),
+      batch(batch_size, target_latency_us), commit_number(0),
+      execute_number(0), log(false),
+      checkpoints(checkpoint_interval, 2 * config.f + 1),
+      state_transfer(config.n, index) //
 {
     // setenv("DEBUG", "replica.cc", 1);
 
+    if (aggregate_qc) {
+        multisig_group = NewMultiSigGroup(config);
+    }
+    // ready before any prologue, which collects QCs or signs votes
+    if (IsPrimary()) {
+        // patch for reason in QCCollector::Collect
+        // only work without leader change
+        proto::VoteMessage vote_message;
+        vote_message.set_op_number(0);
+        vote_message.set_replica_index(replicaIdx);
+        PBMessage pb_vote(vote_message);
+        SignedAdapter signed_vote(pb_vote, this->identifier);
+        string vote0;
+        vote0.resize(signed_vote.SerializedSize());
+        signed_vote.Serialize(&vote0.front());
+        vector<string> identities;
+        for (int i = 0; i < config.n; i += 1) {
+            identities.push_back(config.identity(i));
+        }
+        qc_collector.reset(new QCCollector(
+            move(identities), replicaIdx, 2 * config.f, move(vote0),
+            multisig_group.get(),
+            multisig_group ? MultiSigSecret(config, replicaIdx) : ""));
+    } else if (multisig_group) {
+        vote_signer.reset(new VoteSigner(
+            *multisig_group, replicaIdx, MultiSigSecret(config, replicaIdx)));
+    }
+
     resend_vote_timeout =
         unique_ptr<Timeout>(new Timeout(transport, 1000, [this]() {
             runner.RunPrologue([this]() {
                 return [this]() {
                     RWarning("Resend VoteMessage");
+                    // in case the published nonces are lost
+                    SendNonces();
                     SendVote(generic_qc ? generic_qc->op_number() : 0);
                     ConcludeEpilogue();
                 };
@@ -41,29 +101,33 @@ HotStuffReplica::HotStuffReplica( //
             runner.RunPrologue([this]() {
                 return [this]() {
                     RDebug("Send generic on timeout");
+                    if (auto qc = qc_collector->Fallback()) {
+                        EnterNextView(*qc);
+                    }
                     CloseBatch();
                     ConcludeEpilogue();
                 };
             });
         }));
 
+    state_transfer_timeout =
+        unique_ptr<Timeout>(new Timeout(transport, 100, [this]() {
+            runner.RunPrologue([this]() {
+                return [this]() {
+                    SendStateRequests(state_transfer.Retry(log.LastOpnum()));
+                    ConcludeEpilogue();
+                };
+            });
+        }));
+
     runner.RunPrologue([this]() {
         return [this]() {
             if (!IsPrimary()) {
+                SendNonces();
                 SendVote(0);
             } else {
                 close_batch_timeout->Start();  // patch for losing request bug
                 StartNextBatch();
-
-                // patch for reason in HandleVote
-                // only work without leader change
-                proto::VoteMessage vote_message;
-                vote_message.set_op_number(0);
-                vote_message.set_replica_index(replicaIdx);
-                PBMessage pb_vote(vote_message);
-                SignedAdapter signed_vote(pb_vote, this->identifier);
-                vote0.resize(signed_vote.SerializedSize());
-                signed_vote.Serialize(&vote0.front());
             }
             ConcludeEpilogue();
         };
@@ -72,17 +136,26 @@ HotStuffReplica::HotStuffReplica( //
 
 DEFINE_LATENCY(replica_work);
 
-HotStuffReplica::~HotStuffReplica() { Latency_Dump(&replica_work); }
+HotStuffReplica::~HotStuffReplica() {
+    Latency_Dump(&replica_work);
+    batch.Dump();
+}
 
 void HotStuffReplica::ReceiveMessage( //
     const TransportAddress &remote, void *buf,
     size_t length //
+) {
+    ReceiveBuffer(remote, TransportBuffer::Copy(buf, length));
+}
+
+void HotStuffReplica::ReceiveBuffer(
+    const TransportAddress &remote, TransportBuffer buffer //
 ) {
     runner.RunPrologue(
         [ //
-            this, owned_buffer = string((const char *)buf, length),
-            escaping_remote = remote.clone() //
-    ]() -> Runner::Solo {
+            this, owned_buffer = move(buffer),
+            owned_remote = unique_ptr<TransportAddress>(remote.clone()) //
+    ]() mutable -> Runner::Solo {
             proto::Message message;
             PBMessage pb_layer(message);
             SignedAdapter signed_layer(pb_layer, "");
@@ -91,48 +164,129 @@ void HotStuffReplica::ReceiveMessage( //
                 RWarning("Received message fail to be verified");
                 return nullptr;
             }
+            // Checkpoints are kept as proof of the sender's replica index
+            if ( //
+                message.has_checkpoint() &&
+                signed_layer.Identifier() !=
+                    configuration.identity(
+                        message.checkpoint().replica_index())) {
+                RWarning("Checkpoint not signed by its replica");
+                return nullptr;
+            }
 
             switch (message.get_case()) {
             case proto::Message::GetCase::kRequest:
-                return [this, escaping_remote, message]() {
+                return [ //
+                           this, remote = move(owned_remote),
+                           message = move(message) //
+                ]() {
                     Latency_Start(&replica_work);
-                    auto remote = unique_ptr<TransportAddress>(escaping_remote);
                     HandleRequest(*remote, message.request());
                     ConcludeEpilogue();
                     Latency_EndType(&replica_work, 'r');
                 };
             case proto::Message::GetCase::kGeneric: {
-                auto &justify = message.generic().block().justify();
-                // TODO check vote count, check vote from different backups
-                for (int i = 0; i < justify.signed_vote_size(); i += 1) {
-                    auto &signed_vote_buf = justify.signed_vote(i);
-                    proto::VoteMessage vote_message;
-                    PBMessage pb_vote(vote_message);
-                    SignedAdapter signed_vote(pb_vote, "");
-                    signed_vote.Parse(
-                        signed_vote_buf.data(), signed_vote_buf.size());
-                    if (!signed_vote.IsVerified()) {
-                        RWarning("Generic message fail to verify QC");
-                        return nullptr;
-                    }
+                if (!VerifyQC(
+                        message.generic().block().justify(),
+                        multisig_group.get(), 2 * configuration.f)) {
+                    RWarning("Generic message fail to verify QC");
+                    return nullptr;
                 }
-                return [this, escaping_remote, message]() {
+                return [ //
+                           this, remote = move(owned_remote),
+                           message = move(message) //
+                ]() {
                     Latency_Start(&replica_work);
-                    auto remote = unique_ptr<TransportAddress>(escaping_remote);
                     HandleGeneric(*remote, message.generic());
                     ConcludeEpilogue();
                     Latency_EndType(&replica_work, 'g');
                 };
             }
-            case proto::Message::GetCase::kVote:
-                return [this, escaping_remote, message, owned_buffer]() {
+            case proto::Message::GetCase::kVote: {
+                // aggregated here on worker threads, the solo only sees the
+                // completed QC
+                unique_ptr<proto::QC> qc = qc_collector->Add(
+                    message.vote(), signed_layer.Identifier(), owned_buffer);
+                if (!qc) {
+                    return nullptr;
+                }
+                return [this, qc = move(qc)]() {
                     Latency_Start(&replica_work);
-                    auto remote =
-                        unique_ptr<const TransportAddress>(escaping_remote);
-                    HandleVote(*remote, message.vote(), owned_buffer);
+                    EnterNextView(*qc);
                     ConcludeEpilogue();
                     Latency_EndType(&replica_work, 'v');
                 };
+            }
+            case proto::Message::GetCase::kNonce:
+                qc_collector->AddNonces(
+                    message.nonce(), signed_layer.Identifier());
+                return nullptr;
+            case proto::Message::GetCase::kCheckpoint:
+                return [ //
+                           this, remote = move(owned_remote),
+                           message = move(message),
+                           owned_buffer = move(owned_buffer) //
+                ]() {
+                    HandleCheckpoint(
+                        *remote, message.checkpoint(), owned_buffer);
+                    ConcludeEpilogue();
+                };
+            case proto::Message::GetCase::kStateRequest:
+                return [ //
+                           this, remote = move(owned_remote),
+                           message = move(message) //
+                ]() {
+                    HandleStateRequest(*remote, message.state_request());
+                    ConcludeEpilogue();
+                };
+            case proto::Message::GetCase::kStateChunk: {
+                std::map<int, string> proof;
+                const auto &chunk = message.state_chunk();
+                if (chunk.has_checkpoint()) {
+                    const auto &checkpoint = chunk.checkpoint();
+                    if (CheckpointDigest(checkpoint.app_state()) !=
+                        checkpoint.digest()) {
+                        RWarning("Checkpoint state mismatch in StateChunk");
+                        return nullptr;
+                    }
+                    for (const string &signed_checkpoint :
+                         checkpoint.signed_checkpoint()) {
+                        proto::Message checkpoint_message;
+                        PBMessage pb_checkpoint(checkpoint_message);
+                        SignedAdapter signed_layer(pb_checkpoint, "");
+                        signed_layer.Parse(
+                            signed_checkpoint.data(), signed_checkpoint.size());
+                        if ( //
+                            !signed_layer.IsVerified() ||
+                            !checkpoint_message.has_checkpoint() ||
+                            checkpoint_message.checkpoint().op_number() !=
+                                checkpoint.op_number() ||
+                            checkpoint_message.checkpoint().digest() !=
+                                checkpoint.digest() ||
+                            signed_layer.Identifier() !=
+                                configuration.identity(
+                                    checkpoint_message.checkpoint()
+                                        .replica_index())) {
+                            RWarning("Invalid checkpoint proof in StateChunk");
+                            return nullptr;
+                        }
+                        proof[checkpoint_message.checkpoint()
+                                  .replica_index()] = signed_checkpoint;
+                    }
+                    if ((int)proof.size() < 2 * configuration.f + 1) {
+                        RWarning("Not enough checkpoint proof in StateChunk");
+                        return nullptr;
+                    }
+                }
+                return [ //
+                           this, remote = move(owned_remote),
+                           message = move(message), proof = move(proof) //
+                ]() mutable {
+                    HandleStateChunk(
+                        *remote, message.state_chunk(), move(proof));
+                    ConcludeEpilogue();
+                };
+            }
             default:
                 RPanic("Unexpected message case: %d", message.get_case());
             }
@@ -180,56 +334,12 @@ void HotStuffReplica::HandleRequest(
         if (!close_batch_timeout->Active()) {
             close_batch_timeout->Start();
         }
-        if (pending_generic->block().request_size() >= batch_size) {
+        if ((size_t)pending_generic->block().request_size() >= batch.Size()) {
             CloseBatch();
         }
     }
 }
 
-void HotStuffReplica::HandleVote(
-    const TransportAddress &remote, const proto::VoteMessage &vote,
-    const SignedVote &signed_vote //
-) {
-    if (!IsPrimary()) {
-        NOT_REACHABLE();
-    }
-    if (generic_qc && generic_qc->op_number() >= vote.op_number()) {
-        return;
-    }
-
-    // RDebug(
-    //     "vote: op_number = %lu, replic id = %d", vote.op_number(),
-    //     vote.replica_index());
-    high_qc[vote.op_number()][vote.replica_index()] = signed_vote;
-    // collect 2f from backups, then add one from self
-    if ((int)high_qc[vote.op_number()].size() >= 2 * configuration.f) {
-        RDebug("New QC collected: op_number = %lu", vote.op_number());
-        proto::QC qc;
-        qc.set_op_number(vote.op_number());
-        for (const auto &iter : high_qc[vote.op_number()]) {
-            qc.add_signed_vote(iter.second);
-        }
-
-        // it takes too long to add primary's partial signature into QC
-        // so it is disabled until find a good way to do it async.
-
-        // proto::VoteMessage vote_message;
-        // vote_message.set_op_number(vote.op_number());
-        // vote_message.set_replica_index(replicaIdx);
-        // PBMessage pb_vote(vote_message);
-        // SignedAdapter signed_vote(pb_vote, identifier);
-        // string signed_vote_buf;
-        // signed_vote_buf.resize(signed_vote.SerializedSize());
-        // signed_vote.Serialize(&signed_vote_buf.front());
-        // qc.add_signed_vote(signed_vote_buf);
-        qc.add_signed_vote(
-            vote0); // currently backup don't check vote op number
-        EnterNextView(qc);
-        // should we adaptive batching?
-        // CloseBatch();
-    }
-}
-
 void HotStuffReplica::HandleGeneric(
     const TransportAddress &remote,
     const proto::GenericMessage &generic //
@@ -238,52 +348,25 @@ void HotStuffReplica::HandleGeneric(
         NOT_REACHABLE();
     }
 
-    SendVote(generic.block().op_number());
+    SendVote(generic.block().op_number(), &generic.block());
 
     opnum_t op_offset = generic.block().op_number();
     RDebug(
         "Generic block: op number = %lu (+%u), justify op number = %lu",
         op_offset, generic.block().request_size(),
         generic.block().justify().op_number());
-    if (op_offset < log.LastOpnum() + 1) {
-        NOT_REACHABLE(); // for debug
-        return;
-    }
+    block_chain[op_offset] = BlockLink{
+        generic.block().justify().op_number(),
+        op_offset + generic.block().request_size()};
     if (op_offset > log.LastOpnum() + 1) {
         block_buffer[op_offset] = generic.block();
     } else {
-        log.Append(new HotStuffEntry(op_offset));
-        for (int i = 0; i < generic.block().request_size(); i += 1) {
-            opnum_t op_number = op_offset + i + 1;
-            log.Append(
-                new HotStuffEntry(op_number, generic.block().request(i)));
-        }
-
-        auto iter = block_buffer.begin();
-        while (iter != block_buffer.end()) {
-            if (iter->first < log.LastOpnum() + 1) {
-                NOT_REACHABLE();
-            }
-            if (iter->first != log.LastOpnum() + 1) {
-                break;
-            }
-            auto op_offset = iter->first;
-            auto block = iter->second;
-            log.Append(new HotStuffEntry(op_offset));
-            for (int i = 0; i < block.request_size(); i += 1) {
-                opnum_t op_number = op_offset + i + 1;
-                log.Append(new HotStuffEntry(op_number, block.request(i)));
-            }
-            iter = block_buffer.erase(iter);
-        }
+        // the block may be in the log already, by state transfer
+        AppendBlock(generic.block());
+        AppendBuffered();
     }
 
-    if ( //
-        !generic_qc ||
-        generic.block().justify().op_number() > generic_qc->op_number() //
-    ) {
-        EnterNextView(generic.block().justify());
-    }
+    EnterNextView(generic.block().justify());
 }
 
 struct ExecuteContext {
@@ -292,68 +375,111 @@ struct ExecuteContext {
 };
 
 void HotStuffReplica::EnterNextView(const proto::QC &justify) {
+    // QCs may be collected by concurrent prologues out of order, and resent
+    // blocks carry stale ones
+    if (generic_qc && justify.op_number() <= generic_qc->op_number()) {
+        return;
+    }
     RDebug("Enter new view: justified op_number = %lu", justify.op_number());
-    // not using the justify until view change, but there is no view change in
-    // hotstuff
-    // and it causes crashing without proper state transfer
+    generic_qc = unique_ptr<proto::QC>(new proto::QC(justify));
 
-    // if (justify.op_number() != 0) {
-    //     log.Find(justify.op_number())->As<HotStuffEntry>().justify = justify;
-    // }
+    commit_number = std::max(commit_number, ChainCommit(justify.op_number()));
+    ExecuteCommitted();
+    if (IsPrimary()) {
+        DriveChain();
+    }
+}
 
-    auto commit_qc = move(locked_qc);
-    locked_qc = move(generic_qc);
-    generic_qc = unique_ptr<proto::QC>(new proto::QC(justify));
+// the QC on b2 certifies b2, b2's justify certifies b1 and b1's justify
+// certifies b0, so b0 (and everything before it) has a three-chain. The
+// chain does not have to be of consecutive blocks as in the paper: the log
+// is linear without leader change, so every block extends all blocks before
+// it
+opnum_t HotStuffReplica::ChainCommit(opnum_t op_number) const {
+    auto b2 = block_chain.find(op_number);
+    if (b2 == block_chain.end()) {
+        return 0;
+    }
+    auto b1 = block_chain.find(b2->second.justify);
+    if (b1 == block_chain.end()) {
+        return 0;
+    }
+    auto b0 = block_chain.find(b1->second.justify);
+    if (b0 == block_chain.end()) {
+        return 0;
+    }
+    return b0->second.last_op_number;
+}
 
-    if (!commit_qc || commit_qc->op_number() == 0) {
+// full batches are proposed without waiting for QC, so several blocks may be
+// in flight. When the pipeline drains, the next block is proposed right on
+// the QC, so the chain keeps advancing until backups can commit every request
+// proposed so far, instead of every close batch timeout
+void HotStuffReplica::DriveChain() {
+    if (block_chain.empty() ||
+        block_chain.rbegin()->first != generic_qc->op_number()) {
         return;
     }
-
-    for ( //
-        opnum_t op_number = commit_qc->op_number();
-        op_number < locked_qc->op_number(); op_number += 1 //
-    ) {
-        if (op_number > log.LastOpnum()) {
-            NOT_IMPLEMENTED(); // state transfer
+    if (pending_generic->block().request_size() == 0) {
+        // what backups commit with the QC carried by the last block
+        opnum_t announced = ChainCommit(block_chain.rbegin()->second.justify);
+        auto iter = block_chain.rbegin();
+        while (iter != block_chain.rend() &&
+               iter->second.last_op_number == iter->first) {
+            ++iter;
         }
+        if (iter == block_chain.rend() ||
+            iter->second.last_op_number <= announced) {
+            return;
+        }
+    }
+    CloseBatch();
+}
 
-        HotStuffEntry &entry = log.Find(op_number)->As<HotStuffEntry>();
-        if (entry.state == LOG_STATE_NOOP) {
-            continue;
+void HotStuffReplica::ExecuteCommitted() {
+    while (execute_number < commit_number) {
+        if (execute_number + 1 > log.LastOpnum()) {
+            StartStateTransfer(commit_number, GetPrimary());
+            return;
         }
-        entry.state = LOG_STATE_COMMITTED;
-
-        ExecuteContext ctx;
-        Execute(op_number, entry.request, ctx);
-
-        proto::ReplyMessage message;
-        message.set_client_request(entry.request.clientreqid());
-        message.set_result(ctx.result);
-        message.set_replica_index(replicaIdx);
-
-        const auto &iter = client_table.find(entry.request.clientid());
-        if (iter != client_table.end()) { // almost always
-            const TransportAddress &remote = *iter->second.remote;
-            epilogue_list.push_back(
-                [this, escaping_remote = remote.clone(), message]() mutable {
-                    auto remote = unique_ptr<TransportAddress>(escaping_remote);
-                    transport->SendMessage(this, *remote, PBMessage(message));
-                });
-
-            iter->second.reply_message = message;
-            iter->second.has_reply = true;
-        } else {
-            RWarning("Client entry not found, skip send reply");
+        execute_number += 1;
+        HotStuffEntry &entry = log.Find(execute_number)->As<HotStuffEntry>();
+        if (entry.state != LOG_STATE_NOOP) {
+            ExecuteEntry(execute_number, entry);
+        }
+        // per op, so the state is snapshot right at the checkpoint
+        if (opnum_t checkpoint_number = checkpoints.Take(execute_number)) {
+            SendCheckpoint(checkpoint_number);
         }
     }
+    batch.Commit(execute_number);
+}
 
-    // for (opnum_t not_commit = locked_qc->op_number();
-    //      not_commit <= log.LastOpnum(); not_commit += 1) {
-    //     if (log.Find(not_commit)->state != LOG_STATE_NOOP) {
-    //         return;
-    //     }
-    // }
-    // close_batch_timeout->Stop();
+void HotStuffReplica::ExecuteEntry(opnum_t op_number, HotStuffEntry &entry) {
+    entry.state = LOG_STATE_COMMITTED;
+
+    ExecuteContext ctx;
+    Execute(op_number, entry.request, ctx);
+
+    proto::ReplyMessage message;
+    message.set_client_request(entry.request.clientreqid());
+    message.set_result(ctx.result);
+    message.set_replica_index(replicaIdx);
+
+    const auto &iter = client_table.find(entry.request.clientid());
+    if (iter != client_table.end()) { // almost always
+        const TransportAddress &remote = *iter->second.remote;
+        epilogue_list.push_back(
+            [this, escaping_remote = remote.clone(), message]() mutable {
+                auto remote = unique_ptr<TransportAddress>(escaping_remote);
+                transport->SendMessage(this, *remote, PBMessage(message));
+            });
+
+        iter->second.reply_message = message;
+        iter->second.has_reply = true;
+    } else {
+        RWarning("Client entry not found, skip send reply");
+    }
 }
 
 void HotStuffReplica::CloseBatch() {
@@ -372,6 +498,10 @@ void HotStuffReplica::CloseBatch() {
         return;
     }
     *pending_generic->mutable_block()->mutable_justify() = *generic_qc;
+    qc_collector->Plan(*pending_generic->mutable_block());
+    batch.Close(log.LastOpnum(), pending_generic->block().request_size());
+    block_chain[pending_generic->block().op_number()] = BlockLink{
+        generic_qc->op_number(), log.LastOpnum()};
 
     epilogue_list.push_back([ //
                                 this,
@@ -408,12 +538,27 @@ void HotStuffReplica::StartNextBatch() {
     log.Append(new HotStuffEntry(log.LastOpnum() + 1));
 }
 
-void HotStuffReplica::SendVote(opnum_t op_number) {
-    epilogue_list.push_back([this, op_number]() {
+void HotStuffReplica::SendVote(
+    opnum_t op_number, const proto::Block *block //
+) {
+    // only the plan of the block, not the requests
+    unique_ptr<proto::Block> plan;
+    if (vote_signer && block != nullptr && block->signers() != 0) {
+        plan.reset(new proto::Block);
+        plan->set_op_number(block->op_number());
+        plan->set_signers(block->signers());
+        *plan->mutable_nonce_seq() = block->nonce_seq();
+        plan->set_aggregate_nonce(block->aggregate_nonce());
+    }
+    epilogue_list.push_back([this, op_number, plan = move(plan)]() {
         proto::Message message;
         auto &vote = *message.mutable_vote();
         vote.set_op_number(op_number);
         vote.set_replica_index(replicaIdx);
+        // multi-signing is as slow as signing, so it is done here as well
+        if (vote_signer) {
+            vote_signer->Fill(vote, plan.get());
+        }
         PBMessage pb_layer(message);
         SignedAdapter signed_layer(pb_layer, identifier);
         RDebug("Vote: op number = %lu", op_number);
@@ -422,5 +567,237 @@ void HotStuffReplica::SendVote(opnum_t op_number) {
     resend_vote_timeout->Reset();
 }
 
+void HotStuffReplica::SendNonces() {
+    if (!vote_signer) {
+        return;
+    }
+    epilogue_list.push_back([this]() {
+        proto::Message message;
+        vote_signer->Publish(*message.mutable_nonce());
+        PBMessage pb_layer(message);
+        SignedAdapter signed_layer(pb_layer, identifier);
+        transport->SendMessageToReplica(this, GetPrimary(), signed_layer);
+    });
+}
+
+void HotStuffReplica::SendCheckpoint(opnum_t op_number) {
+    string state;
+    Snapshot(op_number, state);
+    proto::Message message;
+    auto &checkpoint = *message.mutable_checkpoint();
+    checkpoint.set_op_number(op_number);
+    checkpoint.set_replica_index(replicaIdx);
+    checkpoint.set_digest(CheckpointDigest(state));
+    PBMessage pb_layer(message);
+    SignedAdapter signed_layer(pb_layer, identifier);
+    string signed_checkpoint;
+    signed_checkpoint.resize(signed_layer.SerializedSize());
+    signed_layer.Serialize(&signed_checkpoint.front());
+    RDebug("Send Checkpoint: op number = %lu", op_number);
+    checkpoints.SetState(op_number, move(state));
+
+    epilogue_list.push_back([this, signed_checkpoint]() {
+        transport->SendMessageToAll(
+            this, BufferMessage(
+                      signed_checkpoint.data(), signed_checkpoint.size()));
+    });
+    if (checkpoints.Add(
+            op_number, checkpoint.digest(), replicaIdx,
+            move(signed_checkpoint))) {
+        CollectGarbage();
+    }
+}
+
+void HotStuffReplica::HandleCheckpoint(
+    const TransportAddress &remote, const proto::Checkpoint &checkpoint,
+    const TransportBuffer &signed_checkpoint //
+) {
+    if (checkpoints.Add(
+            checkpoint.op_number(), checkpoint.digest(),
+            checkpoint.replica_index(), signed_checkpoint.ToString())) {
+        CollectGarbage();
+    }
+}
+
+void HotStuffReplica::CollectGarbage() {
+    // keep what is not executed yet if behind the stable checkpoint
+    opnum_t low = std::min(checkpoints.Stable(), execute_number);
+    RDebug(
+        "Stable checkpoint: op number = %lu, collect up to %lu",
+        checkpoints.Stable(), low);
+    log.RemoveBefore(low + 1);
+    block_chain.erase(block_chain.begin(), block_chain.upper_bound(low));
+    block_buffer.erase(block_buffer.begin(), block_buffer.upper_bound(low));
+    chunk_buffer.erase(chunk_buffer.begin(), chunk_buffer.upper_bound(low));
+}
+
+// the part of block that is not in the log yet, the block must start at or
+// before the next op number
+void HotStuffReplica::AppendBlock(const proto::Block &block) {
+    opnum_t op_offset = block.op_number();
+    if (op_offset == log.LastOpnum() + 1) {
+        log.Append(new HotStuffEntry(op_offset));
+    }
+    for (int i = 0; i < block.request_size(); i += 1) {
+        opnum_t op_number = op_offset + i + 1;
+        if (op_number == log.LastOpnum() + 1) {
+            log.Append(new HotStuffEntry(op_number, block.request(i)));
+        }
+    }
+}
+
+// blocks of GenericMessage and entries of StateChunk that continue the log
+void HotStuffReplica::AppendBuffered() {
+    while (true) {
+        opnum_t next = log.LastOpnum() + 1;
+        auto block = block_buffer.begin();
+        if (block != block_buffer.end() && block->first <= next) {
+            AppendBlock(block->second);
+            block_buffer.erase(block);
+            continue;
+        }
+
+        auto chunk = chunk_buffer.begin();
+        if (chunk == chunk_buffer.end() || chunk->first > next) {
+            return;
+        }
+        const proto::StateChunk &entries = chunk->second;
+        for (int i = next - chunk->first; i < entries.entry_size(); i += 1) {
+            opnum_t op_number = chunk->first + i;
+            if (entries.entry(i).has_request()) {
+                log.Append(
+                    new HotStuffEntry(op_number, entries.entry(i).request()));
+            } else {
+                log.Append(new HotStuffEntry(op_number));
+            }
+        }
+        chunk_buffer.erase(chunk);
+    }
+}
+
+void HotStuffReplica::StartStateTransfer(opnum_t target, int source) {
+    bool active = state_transfer.Active();
+    if (!state_transfer.Start(target, source)) {
+        return;
+    }
+    if (!active) {
+        RNotice(
+            "Start state transfer: op number = %lu .. %lu, source = %d",
+            log.LastOpnum() + 1, target, state_transfer.Source());
+        state_transfer_timeout->Start();
+    }
+    SendStateRequests(state_transfer.Next(log.LastOpnum()));
+}
+
+void HotStuffReplica::SendStateRequests(
+    const vector<StateTransfer::Range> &ranges //
+) {
+    if (!state_transfer.Active()) {
+        RDebug("State transfer done: op number = %lu", log.LastOpnum());
+        state_transfer_timeout->Stop();
+        return;
+    }
+    for (const StateTransfer::Range &range : ranges) {
+        proto::Message message;
+        auto &request = *message.mutable_state_request();
+        request.set_op_number(range.first);
+        request.set_last_op_number(range.last);
+        request.set_replica_index(replicaIdx);
+        epilogue_list.push_back(
+            [this, message, source = state_transfer.Source()]() mutable {
+                PBMessage pb_layer(message);
+                SignedAdapter signed_layer(pb_layer, identifier);
+                transport->SendMessageToReplica(this, source, signed_layer);
+            });
+    }
+}
+
+void HotStuffReplica::HandleStateRequest(
+    const TransportAddress &remote, const proto::StateRequest &request //
+) {
+    proto::Message message;
+    auto &chunk = *message.mutable_state_chunk();
+    opnum_t op_number = request.op_number();
+    if (op_number < log.FirstOpnum()) {
+        if (!checkpoints.HasStableState()) {
+            return;
+        }
+        auto &checkpoint = *chunk.mutable_checkpoint();
+        checkpoint.set_op_number(checkpoints.Stable());
+        checkpoint.set_digest(checkpoints.StableDigest());
+        checkpoint.set_app_state(checkpoints.StableState());
+        for (const auto &signed_checkpoint : checkpoints.StableProof()) {
+            checkpoint.add_signed_checkpoint(signed_checkpoint.second);
+        }
+        op_number = checkpoints.Stable() + 1;
+    }
+    chunk.set_op_number(op_number);
+    chunk.set_replica_index(replicaIdx);
+    for (; op_number <= std::min(request.last_op_number(), execute_number);
+         op_number += 1) {
+        const LogEntry &entry = *log.Find(op_number);
+        auto &state_entry = *chunk.add_entry();
+        if (entry.state != LOG_STATE_NOOP) {
+            *state_entry.mutable_request() = entry.request;
+        }
+    }
+    if (!chunk.has_checkpoint() && chunk.entry_size() == 0) {
+        return;
+    }
+
+    RDebug(
+        "Send StateChunk: op number = %lu (+%d), checkpoint = %d",
+        chunk.op_number(), chunk.entry_size(), int(chunk.has_checkpoint()));
+    epilogue_list.push_back(
+        [this, message, replica_index = request.replica_index()]() mutable {
+            PBMessage pb_layer(message);
+            SignedAdapter signed_layer(pb_layer, identifier);
+            transport->SendMessageToReplica(this, replica_index, signed_layer);
+        });
+}
+
+void HotStuffReplica::HandleStateChunk(
+    const TransportAddress &remote, const proto::StateChunk &chunk,
+    std::map<int, string> proof //
+) {
+    RDebug(
+        "StateChunk: op number = %lu (+%d), checkpoint = %d",
+        chunk.op_number(), chunk.entry_size(), int(chunk.has_checkpoint()));
+    if (chunk.has_checkpoint()) {
+        InstallCheckpoint(chunk.checkpoint(), move(proof));
+    }
+    if (chunk.op_number() + chunk.entry_size() > log.LastOpnum() + 1) {
+        chunk_buffer[chunk.op_number()] = chunk;
+    }
+
+    AppendBuffered();
+    ExecuteCommitted();
+    SendStateRequests(state_transfer.Next(log.LastOpnum()));
+}
+
+void HotStuffReplica::InstallCheckpoint(
+    const proto::StableCheckpoint &checkpoint,
+    std::map<int, string> proof //
+) {
+    if (checkpoint.op_number() <= execute_number) {
+        return;
+    }
+    RNotice(
+        "Install checkpoint: op number = %lu, execute number = %lu",
+        checkpoint.op_number(), execute_number);
+    Restore(checkpoint.op_number(), checkpoint.app_state());
+    checkpoints.Install(
+        checkpoint.op_number(), checkpoint.digest(), move(proof),
+        checkpoint.app_state());
+    if (log.LastOpnum() >= checkpoint.op_number()) {
+        log.RemoveBefore(checkpoint.op_number() + 1);
+    } else {
+        log.Reset(checkpoint.op_number() + 1, EMPTY_HASH);
+    }
+    execute_number = checkpoint.op_number();
+    commit_number = std::max(commit_number, execute_number);
+    CollectGarbage();
+}
+
 } // namespace hotstuff
 } // namespace dsnet
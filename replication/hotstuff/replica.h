@@ -1,10 +1,14 @@
 #pragma once
+#include "common/batchcontroller.h"
+#include "common/checkpoint.h"
 #include "common/log.h"
 #include "common/pbmessage.h"
 #include "common/replica.h"
 #include "common/request.pb.h"
 #include "common/runner.h"
+#include "common/statetransfer.h"
 #include "replication/hotstuff/message.pb.h"
+#include "replication/hotstuff/qc.h"
 
 namespace dsnet {
 namespace hotstuff {
@@ -24,32 +28,65 @@ class HotStuffReplica : public Replica {
 public:
     HotStuffReplica(
         const Configuration &config, int index, std::string identifier,
-        int n_thread, int batch_size, Transport *transport, AppReplica *app);
+        int n_thread, int batch_size, Transport *transport, AppReplica *app,
+        opnum_t checkpoint_interval = DEFAULT_CHECKPOINT_INTERVAL,
+        bool aggregate_qc = false, uint64_t target_latency_us = 0);
+    // run on the runner of caller, which outlives the replica
+    HotStuffReplica(
+        const Configuration &config, int index, std::string identifier,
+        Runner &runner, int batch_size, Transport *transport, AppReplica *app,
+        opnum_t checkpoint_interval = DEFAULT_CHECKPOINT_INTERVAL,
+        bool aggregate_qc = false, uint64_t target_latency_us = 0);
     ~HotStuffReplica();
 
     void ReceiveMessage(
         const TransportAddress &remote, void *buf, size_t length) override;
+    void ReceiveBuffer(
+        const TransportAddress &remote, TransportBuffer buffer) override;
 
 private:
+    HotStuffReplica(
+        const Configuration &config, int index, std::string identifier,
+        std::unique_ptr<Runner> owned_runner, Runner *external_runner,
+        int batch_size, Transport *transport, AppReplica *app,
+        opnum_t checkpoint_interval, bool aggregate_qc,
+        uint64_t target_latency_us);
+
     // consts
     std::string identifier;
-    SpinRunner runner;
-    int batch_size;
-    using SignedVote = std::string;
-    SignedVote vote0;
+    std::unique_ptr<Runner> owned_runner;
+    Runner &runner;
+    BatchController batch;
+    // nullptr unless QCs are aggregated, see qc.h
+    std::unique_ptr<MultiSigGroup> multisig_group;
 
     // single states
     std::unique_ptr<Timeout> resend_vote_timeout;
     std::unique_ptr<Timeout> close_batch_timeout;
+    std::unique_ptr<Timeout> state_transfer_timeout;
 
-    std::unique_ptr<proto::QC> generic_qc, locked_qc;
+    // the highest QC, the lock is only needed for leader change so it is not
+    // kept
+    std::unique_ptr<proto::QC> generic_qc;
     std::unique_ptr<proto::GenericMessage> pending_generic;
+    // everything up to the last three-chain block is committed, and executed
+    // unless some of it is missing and being fetched by state transfer
+    opnum_t commit_number, execute_number;
+
+    // the chain of proposed blocks, block op number -> the block its justify
+    // QC certifies (its parent in the chain) and its last op number. Several
+    // blocks may be in flight, so the parent is not always the block right
+    // before
+    struct BlockLink {
+        opnum_t justify, last_op_number;
+    };
+    std::map<opnum_t, BlockLink> block_chain;
 
     // aggregated states
-    // in-construct QCs, only on primary, op number -> repica id -> partial sig
-    // op number is the "hash" of block in vote message, we pretend it could
-    // prove content matching for now
-    std::unordered_map<uint64_t, std::unordered_map<int, SignedVote>> high_qc;
+    // in-construct QCs, only on primary and touched in prologue
+    std::unique_ptr<QCCollector> qc_collector;
+    // only on backups in aggregate QC mode, touched in epilogue
+    std::unique_ptr<VoteSigner> vote_signer;
 
     struct ClientEntry {
         std::unique_ptr<TransportAddress> remote;
@@ -64,6 +101,9 @@ private:
     std::unordered_map<uint64_t, ClientEntry> client_table;
     Log log;
     std::map<opnum_t, proto::Block> block_buffer;
+    CheckpointTracker checkpoints;
+    StateTransfer state_transfer;
+    std::map<opnum_t, proto::StateChunk> chunk_buffer;
 
     // tolerant faulty leader not implemented
     int GetPrimary() const { return 0; }
@@ -72,8 +112,8 @@ private:
     // util state
     std::vector<Runner::Epilogue> epilogue_list;
     void ConcludeEpilogue() {
-        runner.RunEpilogue([epilogue_list = this->epilogue_list] {
-            for (Runner::Epilogue epilogue : epilogue_list) {
+        runner.RunEpilogue([epilogue_list = std::move(this->epilogue_list)] {
+            for (const Runner::Epilogue &epilogue : epilogue_list) {
                 epilogue();
             }
         });
@@ -81,18 +121,43 @@ private:
     }
 
     void HandleRequest(const TransportAddress &remote, const Request &request);
-    void HandleVote(
-        const TransportAddress &remote, const proto::VoteMessage &vote,
-        const SignedVote &signed_vote);
     void HandleGeneric(
         const TransportAddress &remote, const proto::GenericMessage &generic);
+    void HandleCheckpoint(
+        const TransportAddress &remote, const proto::Checkpoint &checkpoint,
+        const TransportBuffer &signed_checkpoint);
+    void HandleStateRequest(
+        const TransportAddress &remote, const proto::StateRequest &request);
+    // `proof` is the verified stable checkpoint proof, if chunk has one
+    void HandleStateChunk(
+        const TransportAddress &remote, const proto::StateChunk &chunk,
+        std::map<int, std::string> proof);
 
     // the `view` concept is omitted in the final "practical" version of
     // hotstuff, but I cannot think of a better name
     void EnterNextView(const proto::QC &justify);
+    // the commit number a QC on block `op_number` implies by the three-chain
+    // rule, 0 if part of the chain is unknown
+    opnum_t ChainCommit(opnum_t op_number) const;
+    // keep one block in flight as long as something is not committed
+    void DriveChain();
     void CloseBatch();
-    void SendVote(opnum_t op_number);
+    // `block` plans the aggregate QC on it
+    void SendVote(opnum_t op_number, const proto::Block *block = nullptr);
+    // a batch of multi-signature nonces, no-op in vector QC mode
+    void SendNonces();
     void StartNextBatch();
+    void SendCheckpoint(opnum_t op_number);
+    void CollectGarbage();
+    void AppendBlock(const proto::Block &block);
+    void AppendBuffered();
+    void ExecuteCommitted();
+    void ExecuteEntry(opnum_t op_number, HotStuffEntry &entry);
+    void StartStateTransfer(opnum_t target, int source);
+    void SendStateRequests(const std::vector<StateTransfer::Range> &ranges);
+    void InstallCheckpoint(
+        const proto::StableCheckpoint &checkpoint,
+        std::map<int, std::string> proof);
 };
 
 } // namespace hotstuff
@@ -4,9 +4,9 @@ SRCS += $(d)replica.cc $(d)client.cc $(d)adapter.cc
 PROTOS += $(d)message.proto
 
 OBJS-minbft-client := $(o)client.o $(o)message.o $(o)adapter.o $(OBJS-client) \
-	$(LIB-message) $(LIB-pbmessage)
+	$(LIB-message) $(LIB-pbmessage) $(LIB-signedadapter)
 OBJS-minbft-replica := $(o)replica.o $(o)message.o $(o)adapter.o $(OBJS-replica) \
-	$(LIB-message) $(LIB-pbmessage) $(LIB-runner)
+	$(LIB-message) $(LIB-pbmessage) $(LIB-runner) $(LIB-signedadapter)
 
 # protobuf dependency
 $(o)client.o $(o)replica.o: $(o)message.o
\ No newline at end of file
@@ -1,13 +1,24 @@
 #include "replication/minbft/adapter.h"
 
+#include <map>
+#include <mutex>
+
 namespace dsnet {
 namespace minbft {
 
-opnum_t MinBFTPlainAdapter::s_ui = 0;
+// the USIG counter of every identifier that signs in this process, so
+// replicas sharing a process (e.g. in tests) still assign consecutive UIs
+static opnum_t NextUI(const std::string &identifier) {
+    static std::mutex mutex;
+    static std::map<std::string, opnum_t> last_ui;
+    std::lock_guard<std::mutex> lock(mutex);
+    return last_ui[identifier] += 1;
+}
 
 MinBFTAdapter::MinBFTAdapter(
     Message *inner, const std::string &identifier, bool assign_ui)
-    : plain_layer(inner, assign_ui), identifier(identifier) {}
+    : plain_layer(inner, assign_ui ? NextUI(identifier) : 0),
+      identifier(identifier) {}
 
 } // namespace minbft
 } // namespace dsnet
\ No newline at end of file
@@ -7,14 +7,7 @@ namespace dsnet {
 namespace minbft {
 
 class MinBFTPlainAdapter : public Message {
-    MinBFTPlainAdapter(Message *inner, bool assign_ui) : inner(inner) {
-        if (assign_ui) {
-            s_ui += 1;
-            ui = s_ui;
-        } else {
-            ui = 0;
-        }
-    }
+    MinBFTPlainAdapter(Message *inner, opnum_t ui) : inner(inner), ui(ui) {}
 
     void Parse(const void *buf, size_t len) override {
         ui = ((opnum_t *)buf)[0];
@@ -38,8 +31,6 @@ class MinBFTPlainAdapter : public Message {
     std::string Type() const override { NOT_IMPLEMENTED(); }
 
 protected:
-    static opnum_t s_ui;
-
     Message *inner;
     opnum_t ui;
 
@@ -72,6 +63,7 @@ public:
         SignedAdapter signed_layer(plain_layer, identifier);
         signed_layer.Parse(buf, len);
         is_verified = signed_layer.IsVerified();
+        signer = signed_layer.Identifier();
     }
     // only vaid when `assign_ui` == true
     void Serialize(void *buf) const override {
@@ -83,11 +75,14 @@ public:
     opnum_t GetUI() const { return plain_layer.ui; }
     // only valid after call `Parse`
     bool IsVerified() const { return is_verified; }
+    // identifier of the sender, only valid after call `Parse`
+    const std::string &Identifier() const { return signer; }
 
 private:
     mutable MinBFTPlainAdapter plain_layer;
     const std::string identifier;
     bool is_verified;
+    std::string signer;
 };
 
 } // namespace minbft
@@ -1,6 +1,7 @@
 #include "replication/minbft/replica.h"
 #include "common/pbmessage.h"
 #include "replication/minbft/adapter.h"
+#include <algorithm>
 #include <cstdlib>
 
 #define RDebug(fmt, ...) Debug("[%d] " fmt, this->replicaIdx, ##__VA_ARGS__)
@@ -11,6 +12,10 @@
 namespace dsnet {
 namespace minbft {
 
+// UI messages of the primary that may arrive ahead of an earlier one before
+// the earlier one is taken as lost
+static const opnum_t MAX_REORDERED_UI = 4;
+
 using std::map;
 using std::move;
 using std::string;
@@ -19,11 +24,36 @@ using std::vector;
 
 MinBFTReplica::MinBFTReplica(
     const Configuration &config, int replica_id, const std::string &identifier,
-    int n_worker, int batch_size, Transport *transport, AppReplica *app)
+    int n_worker, int batch_size, Transport *transport, AppReplica *app,
+    opnum_t checkpoint_interval, uint64_t target_latency_us)
+    : MinBFTReplica(
+          config, replica_id, identifier,
+          unique_ptr<Runner>(new SpinRunner(n_worker)), nullptr, batch_size,
+          transport, app, checkpoint_interval, target_latency_us) {}
+
+MinBFTReplica::MinBFTReplica(
+    const Configuration &config, int replica_id, const std::string &identifier,
+    Runner &runner, int batch_size, Transport *transport, AppReplica *app,
+    opnum_t checkpoint_interval, uint64_t target_latency_us)
+    : MinBFTReplica(
+          config, replica_id, identifier, nullptr, &runner, batch_size,
+          transport, app, checkpoint_interval, target_latency_us) {}
+
+MinBFTReplica::MinBFTReplica(
+    const Configuration &config, int replica_id, const std::string &identifier,
+    unique_ptr<Runner> owned_runner, Runner *external_runner, int batch_size,
+    Transport *transport, AppReplica *app, opnum_t checkpoint_interval,
+    uint64_t target_latency_us)
     : Replica(config, 0, replica_id, true, transport, app),
-      identifier(identifier), runner(n_worker), batch_size(batch_size),
-      commit_quorum(config.f + 1), view_number(0), commit_number(0),
-      log(false) //
+      identifier(identifier), owned_runner(move(owned_runner)),
+      runner(
+          external_runner != nullptr ? *external_runner
+                                     : *this->owned_runner),
+      batch(batch_size, target_latency_us),
+      commit_quorum(config.f + 1, config.n),
+      checkpoints(checkpoint_interval, config.f + 1), collected_ui(0),
+      collected_op(0), state_transfer(config.n, replica_id), view_number(0),
+      commit_number(0), log(false) //
 {
     for (int i = 0; i < config.n; i += 1) {
         ui_queue[i] = map<opnum_t, Runner::Solo>();
@@ -34,23 +64,35 @@ MinBFTReplica::MinBFTReplica(
         unique_ptr<Timeout>(new Timeout(transport, 10, [this] {
             runner.RunPrologue([this] { return [this] { CloseBatch(); }; });
         }));
+    state_transfer_timeout =
+        unique_ptr<Timeout>(new Timeout(transport, 100, [this] {
+            runner.RunPrologue([this] {
+                return [this] {
+                    SendStateRequests(state_transfer.Retry(PrimaryUI()));
+                    ConcludeEpilogue();
+                };
+            });
+        }));
 
     // setenv("DEBUG", "replica.cc", 1);
 }
 
-MinBFTReplica::~MinBFTReplica() {
-    //
-}
+MinBFTReplica::~MinBFTReplica() { batch.Dump(); }
 
 void MinBFTReplica::ReceiveMessage(
     const TransportAddress &remote, void *buf, size_t len //
+) {
+    ReceiveBuffer(remote, TransportBuffer::Copy(buf, len));
+}
+
+void MinBFTReplica::ReceiveBuffer(
+    const TransportAddress &remote, TransportBuffer buffer //
 ) {
     runner.RunPrologue(
         [ //
-            this, escaping_remote = remote.clone(),
-            owned_buffer = string((const char *)buf, len) //
-    ]() -> Runner::Solo {
-            auto remote = unique_ptr<TransportAddress>(escaping_remote);
+            this, remote = unique_ptr<TransportAddress>(remote.clone()),
+            owned_buffer = move(buffer) //
+    ]() mutable -> Runner::Solo {
             proto::MinBFTMessage m;
             PBMessage pb_m(m);
             pb_m.Parse(owned_buffer.data(), owned_buffer.size());
@@ -58,7 +100,7 @@ void MinBFTReplica::ReceiveMessage(
             case proto::MinBFTMessage::SubCase::kSignedRequest: {
                 Request request;
                 PBMessage pb_request(request);
-                SignedAdapter signed_request(pb_request, "");
+                SignedAdapter signed_request(pb_request, identifier);
                 signed_request.Parse(
                     m.signed_request().data(), m.signed_request().size());
                 if (!signed_request.IsVerified()) {
@@ -66,100 +108,80 @@ void MinBFTReplica::ReceiveMessage(
                     return nullptr;
                 }
                 return [ //
-                           this, escaping_remote = remote.release(), request,
-                           m] {
-                    auto remote = unique_ptr<TransportAddress>(escaping_remote);
+                           this, remote = move(remote),
+                           request = move(request), m = move(m) //
+                ] {
                     HandleRequest(*remote, request, m.signed_request());
                     ConcludeEpilogue();
                 };
             }
-            case proto::MinBFTMessage::SubCase::kUiMessage: {
-                proto::UIMessage ui_message;
-                PBMessage pb_layer(ui_message);
-                MinBFTAdapter minbft_layer(&pb_layer, "", false);
-                minbft_layer.Parse(
-                    m.ui_message().data(), m.ui_message().size());
-                if (!minbft_layer.IsVerified()) {
-                    RWarning("Failed to verify UI message");
-                    return nullptr;
-                }
-
-                Runner::Solo solo;
-                switch (ui_message.sub_case()) {
-                case proto::UIMessage::SubCase::kPrepare: {
-                    vector<Request> requests;
-                    for ( //
-                        int i = 0;
-                        i < ui_message.prepare().signed_request_size();
-                        i += 1 //
-                    ) {
-                        const string &buffer =
-                            ui_message.prepare().signed_request(i);
-                        Request request;
-                        PBMessage pb_request(request);
-                        SignedAdapter signed_request(pb_request, "");
-                        signed_request.Parse(buffer.data(), buffer.size());
-                        if (!signed_request.IsVerified()) {
-                            RWarning("Failed to verify UI::Prepare::Request");
+            case proto::MinBFTMessage::SubCase::kUiMessage:
+                return ParseUIMessage(
+                    move(remote), move(*m.mutable_ui_message()));
+            case proto::MinBFTMessage::SubCase::kStateRequest:
+                return [this, remote = move(remote), m = move(m)] {
+                    HandleStateRequest(*remote, m.state_request());
+                    ConcludeEpilogue();
+                };
+            case proto::MinBFTMessage::SubCase::kStateChunk: {
+                std::map<int, string> proof;
+                std::map<int, opnum_t> proof_ui;
+                const auto &chunk = m.state_chunk();
+                if (chunk.has_checkpoint()) {
+                    if (CheckpointDigest(chunk.checkpoint().app_state()) !=
+                        chunk.checkpoint().digest()) {
+                        RWarning("Checkpoint state mismatch in StateChunk");
+                        return nullptr;
+                    }
+                    for (const string &ui_checkpoint :
+                         chunk.checkpoint().ui_checkpoint()) {
+                        proto::UIMessage ui_message;
+                        PBMessage pb_layer(ui_message);
+                        MinBFTAdapter minbft_layer(&pb_layer, "", false);
+                        minbft_layer.Parse(
+                            ui_checkpoint.data(), ui_checkpoint.size());
+                        if ( //
+                            !minbft_layer.IsVerified() ||
+                            !ui_message.has_checkpoint() ||
+                            ui_message.checkpoint().op_number() !=
+                                chunk.checkpoint().op_number() ||
+                            ui_message.checkpoint().digest() !=
+                                chunk.checkpoint().digest() ||
+                            minbft_layer.Identifier() !=
+                                configuration.identity(
+                                    ui_message.checkpoint().replica_id())) {
+                            RWarning("Invalid checkpoint proof in StateChunk");
                             return nullptr;
                         }
-                        requests.push_back(request);
+                        int replica_id = ui_message.checkpoint().replica_id();
+                        proof[replica_id] = ui_checkpoint;
+                        proof_ui[replica_id] = minbft_layer.GetUI();
+                    }
+                    if ((int)proof.size() < configuration.f + 1) {
+                        RWarning("Not enough checkpoint proof in StateChunk");
+                        return nullptr;
                     }
-                    solo = [ //
-                               this, escaping_remote = remote.release(),
-                               ui_message, ui = minbft_layer.GetUI(),
-                               requests] {
-                        auto remote =
-                            unique_ptr<TransportAddress>(escaping_remote);
-                        HandlePrepare(
-                            *remote, ui_message.prepare(), ui, requests);
-                    };
-                    break;
-                }
-                case proto::UIMessage::SubCase::kCommit: {
-                    solo = [ //
-                               this, escaping_remote = remote.release(),
-                               ui_message] {
-                        auto remote =
-                            unique_ptr<TransportAddress>(escaping_remote);
-                        HandleCommit(*remote, ui_message.commit());
-                    };
-                    break;
                 }
-                default:
-                    RPanic(
-                        "Unexpect UIMessage case: %d", ui_message.sub_case());
+                vector<Runner::Solo> replay;
+                for (const string &ui_buffer : chunk.ui_message()) {
+                    Runner::Solo solo = ParseUIMessage(
+                        unique_ptr<TransportAddress>(remote->clone()),
+                        ui_buffer);
+                    if (!solo) {
+                        return nullptr;
+                    }
+                    replay.push_back(move(solo));
                 }
-
-                // the wrapping solo
-                // I am such a genius
-                return
-                    [ //
-                        this, solo, ui = minbft_layer.GetUI(),
-                        // TODO get this from MinBFT layer instead of protobuf
-                        remote_id = ui_message.replica_id() //
-                ] {
-                        RDebug(
-                            "Receive UIMessage: replica id = %d, ui = %lu",
-                            remote_id, ui);
-                        if (ui != next_ui[remote_id]) {
-                            ui_queue[remote_id][ui] = solo;
-                            return;
-                        }
-
-                        next_ui[remote_id] += 1;
-                        solo();
-                        auto iter = ui_queue[remote_id].begin();
-                        while (iter != ui_queue[remote_id].end()) {
-                            if (iter->first != next_ui[remote_id]) {
-                                break;
-                            }
-                            next_ui[remote_id] += 1;
-                            iter->second();
-                            iter = ui_queue[remote_id].erase(iter);
-                        }
-                        ConcludeEpilogue();
-                    };
+                return [ //
+                           this, remote = move(remote), m = move(m),
+                           proof = move(proof), proof_ui = move(proof_ui),
+                           replay = move(replay) //
+                ]() mutable {
+                    HandleStateChunk(
+                        *remote, m.state_chunk(), move(proof), proof_ui,
+                        replay);
+                    ConcludeEpilogue();
+                };
             }
             default:
                 RPanic("Unexpected message case: %d", m.sub_case());
@@ -169,6 +191,131 @@ void MinBFTReplica::ReceiveMessage(
         });
 }
 
+// MinBFT[UIMessage] from either network or StateChunk, verified here and
+// dispatched in UI order per replica by the returned solo
+Runner::Solo MinBFTReplica::ParseUIMessage(
+    unique_ptr<TransportAddress> remote, string ui_buffer //
+) {
+    proto::UIMessage ui_message;
+    PBMessage pb_layer(ui_message);
+    MinBFTAdapter minbft_layer(&pb_layer, "", false);
+    minbft_layer.Parse(ui_buffer.data(), ui_buffer.size());
+    if (!minbft_layer.IsVerified()) {
+        RWarning("Failed to verify UI message");
+        return nullptr;
+    }
+    // UIs are counted per replica id
+    if (minbft_layer.Identifier() !=
+        configuration.identity(ui_message.replica_id())) {
+        RWarning("UI message not signed by its replica");
+        return nullptr;
+    }
+
+    Runner::Solo solo;
+    switch (ui_message.sub_case()) {
+    case proto::UIMessage::SubCase::kPrepare: {
+        vector<Request> requests;
+        for ( //
+            int i = 0; i < ui_message.prepare().signed_request_size();
+            i += 1 //
+        ) {
+            const string &buffer = ui_message.prepare().signed_request(i);
+            Request request;
+            PBMessage pb_request(request);
+            SignedAdapter signed_request(pb_request, identifier);
+            signed_request.Parse(buffer.data(), buffer.size());
+            if (!signed_request.IsVerified()) {
+                RWarning("Failed to verify UI::Prepare::Request");
+                return nullptr;
+            }
+            requests.push_back(move(request));
+        }
+        solo = [ //
+                   this, remote = move(remote),
+                   prepare = move(*ui_message.mutable_prepare()),
+                   ui = minbft_layer.GetUI(),
+                   requests = move(requests) //
+        ] {
+            HandlePrepare(*remote, prepare, ui, requests);
+        };
+        break;
+    }
+    case proto::UIMessage::SubCase::kCommit: {
+        solo = [ //
+                   this, remote = move(remote),
+                   commit = move(*ui_message.mutable_commit()) //
+        ] {
+            HandleCommit(*remote, commit);
+        };
+        break;
+    }
+    case proto::UIMessage::SubCase::kCheckpoint: {
+        solo = [ //
+                   this, remote = move(remote),
+                   checkpoint = move(*ui_message.mutable_checkpoint()),
+                   ui_checkpoint = ui_buffer //
+        ] {
+            HandleCheckpoint(*remote, checkpoint, ui_checkpoint);
+        };
+        break;
+    }
+    default:
+        RPanic("Unexpect UIMessage case: %d", ui_message.sub_case());
+    }
+
+    // the wrapping solo
+    // I am such a genius
+    return
+        [ //
+            this, solo = move(solo), ui = minbft_layer.GetUI(),
+            // TODO get this from MinBFT layer instead of protobuf
+            remote_id = ui_message.replica_id(),
+            ui_buffer = move(ui_buffer) //
+    ]() mutable {
+            RDebug(
+                "Receive UIMessage: replica id = %d, ui = %lu",
+                remote_id, ui);
+            // replayed by state transfer already, or the other way around
+            if (ui < next_ui[remote_id]) {
+                return;
+            }
+            if (remote_id == configuration.GetLeaderIndex(view_number)) {
+                primary_messages[ui] = move(ui_buffer);
+            }
+            if (ui != next_ui[remote_id]) {
+                ui_queue[remote_id][ui] = move(solo);
+                // further ahead than reordering goes, e.g. a Prepare is lost
+                // or the replica just (re)joined, and nothing else would
+                // notice it since every later message is queued behind the
+                // gap
+                if ( //
+                    remote_id == configuration.GetLeaderIndex(view_number) &&
+                    ui > next_ui[remote_id] + MAX_REORDERED_UI) {
+                    StartStateTransfer(ui - 1, remote_id);
+                    ConcludeEpilogue();
+                }
+                return;
+            }
+
+            next_ui[remote_id] += 1;
+            solo();
+            HandleQueuedUI(remote_id);
+            ConcludeEpilogue();
+        };
+}
+
+void MinBFTReplica::HandleQueuedUI(int remote_id) {
+    auto iter = ui_queue[remote_id].begin();
+    while (iter != ui_queue[remote_id].end()) {
+        if (iter->first != next_ui[remote_id]) {
+            break;
+        }
+        next_ui[remote_id] += 1;
+        iter->second();
+        iter = ui_queue[remote_id].erase(iter);
+    }
+}
+
 void MinBFTReplica::HandlePrepare(
     const TransportAddress &remote, const proto::Prepare &prepare, opnum_t ui,
     const vector<Request> &requests //
@@ -216,6 +363,9 @@ void MinBFTReplica::SendCommit(opnum_t ui) {
     *m.mutable_ui_message() = ui_buffer;
     RDebug("Send Commit: ui = %lu", minbft_layer.GetUI());
     transport->SendMessageToAll(this, PBMessage(m));
+    if (configuration.GetLeaderIndex(view_number) == replicaIdx) {
+        primary_messages[minbft_layer.GetUI()] = ui_buffer;
+    }
     // });
     AddCommit(commit);
 }
@@ -231,6 +381,9 @@ void MinBFTReplica::HandleCommit(
             "op number = %lu .. %lu", low_op[commit.primary_ui()],
             high_op[commit.primary_ui()]);
     }
+    if (commit.primary_ui() <= collected_ui) {
+        return;
+    }
     if ( //
         high_op.count(commit.primary_ui()) &&
         high_op[commit.primary_ui()] <= commit_number //
@@ -243,6 +396,10 @@ void MinBFTReplica::HandleCommit(
 
 void MinBFTReplica::AddCommit(const proto::Commit &commit) {
     RDebug("AddCommit: primary ui = %lu", commit.primary_ui());
+    // behind an installed checkpoint
+    if (commit.primary_ui() <= collected_ui) {
+        return;
+    }
     if (!commit_quorum.AddAndCheckForQuorum(
             commit.primary_ui(), commit.replica_id(), commit)) {
         return;
@@ -250,14 +407,23 @@ void MinBFTReplica::AddCommit(const proto::Commit &commit) {
     RDebug("Reach commit point: primary ui = %lu", commit.primary_ui());
 
     if (!low_op.count(commit.primary_ui())) {
-        NOT_IMPLEMENTED(); // state transfer
+        // missed the Prepare, which blocks every later UI message from the
+        // primary as well; the quorum is kept until the Prepare is replayed
+        StartStateTransfer(commit.primary_ui(), commit.replica_id());
+        return;
     }
+    // every replica commits the Prepares in UI order, so the ones before
+    // have their quorums already, and a Commit far ahead is rejected from
+    // here on rather than moving the window
+    commit_quorum.ClearBefore(commit.primary_ui());
     for ( //
         opnum_t op_number = low_op[commit.primary_ui()];
         op_number <= high_op[commit.primary_ui()]; op_number += 1 //
     ) {
-        LogEntry *entry = log.Find(op_number);
-        entry->state = LOG_STATE_COMMITTED;
+        // the part below an installed checkpoint is not in the log
+        if (LogEntry *entry = log.Find(op_number)) {
+            entry->state = LOG_STATE_COMMITTED;
+        }
     }
 
     // execution
@@ -303,6 +469,223 @@ void MinBFTReplica::AddCommit(const proto::Commit &commit) {
                 "Client entry missing: client id = %lu",
                 commit_entry->request.clientid());
         }
+
+        // per op, so the state is snapshot right at the checkpoint
+        if (opnum_t checkpoint_number = checkpoints.Take(commit_number)) {
+            SendCheckpoint(checkpoint_number);
+        }
+    }
+    batch.Commit(commit_number);
+}
+
+void MinBFTReplica::SendCheckpoint(opnum_t op_number) {
+    string state;
+    Snapshot(op_number, state);
+    proto::UIMessage ui_message;
+    ui_message.set_replica_id(replicaIdx);
+    auto &checkpoint = *ui_message.mutable_checkpoint();
+    checkpoint.set_op_number(op_number);
+    checkpoint.set_replica_id(replicaIdx);
+    checkpoint.set_digest(CheckpointDigest(state));
+    MinBFTAdapter minbft_layer(nullptr, identifier, true);
+    PBMessage pb_layer(ui_message);
+    minbft_layer.SetInner(&pb_layer);
+    string ui_buffer;
+    ui_buffer.resize(minbft_layer.SerializedSize());
+    minbft_layer.Serialize(&ui_buffer.front());
+    proto::MinBFTMessage m;
+    *m.mutable_ui_message() = ui_buffer;
+    RDebug(
+        "Send Checkpoint: op number = %lu, ui = %lu", op_number,
+        minbft_layer.GetUI());
+    transport->SendMessageToAll(this, PBMessage(m));
+    if (configuration.GetLeaderIndex(view_number) == replicaIdx) {
+        primary_messages[minbft_layer.GetUI()] = ui_buffer;
+    }
+    checkpoints.SetState(op_number, move(state));
+    if (checkpoints.Add(
+            op_number, checkpoint.digest(), replicaIdx, move(ui_buffer))) {
+        CollectGarbage();
+    }
+}
+
+void MinBFTReplica::HandleCheckpoint(
+    const TransportAddress &remote, const proto::Checkpoint &checkpoint,
+    const string &ui_checkpoint //
+) {
+    if (checkpoints.Add(
+            checkpoint.op_number(), checkpoint.digest(),
+            checkpoint.replica_id(), ui_checkpoint)) {
+        CollectGarbage();
+    }
+}
+
+void MinBFTReplica::CollectGarbage() {
+    // keep what is not executed yet if behind the stable checkpoint
+    opnum_t low = std::min(checkpoints.Stable(), commit_number);
+    RDebug(
+        "Stable checkpoint: op number = %lu, collect up to %lu",
+        checkpoints.Stable(), low);
+    // an installed checkpoint may be ahead of the log
+    log.RemoveBefore(std::min(low, log.LastOpnum()) + 1);
+    for (auto iter = high_op.begin(); iter != high_op.end();) {
+        if (iter->second <= low) {
+            collected_ui = std::max(collected_ui, iter->first);
+            collected_op = std::max(collected_op, iter->second);
+            low_op.erase(iter->first);
+            iter = high_op.erase(iter);
+        } else {
+            ++iter;
+        }
+    }
+    commit_quorum.ClearBefore(collected_ui + 1);
+    primary_messages.erase(
+        primary_messages.begin(), primary_messages.upper_bound(collected_ui));
+}
+
+void MinBFTReplica::StartStateTransfer(opnum_t target, int source) {
+    bool active = state_transfer.Active();
+    if (!state_transfer.Start(target, source)) {
+        return;
+    }
+    if (!active) {
+        RNotice(
+            "Start state transfer: primary ui = %lu .. %lu, source = %d",
+            PrimaryUI() + 1, target, state_transfer.Source());
+        state_transfer_timeout->Start();
+    }
+    SendStateRequests(state_transfer.Next(PrimaryUI()));
+}
+
+void MinBFTReplica::SendStateRequests(
+    const vector<StateTransfer::Range> &ranges //
+) {
+    if (!state_transfer.Active()) {
+        RDebug("State transfer done: primary ui = %lu", PrimaryUI());
+        state_transfer_timeout->Stop();
+        return;
+    }
+    for (const StateTransfer::Range &range : ranges) {
+        proto::MinBFTMessage m;
+        auto &request = *m.mutable_state_request();
+        request.set_ui(range.first);
+        request.set_last_ui(range.last);
+        request.set_replica_id(replicaIdx);
+        epilogue_list.push_back(
+            [this, m, source = state_transfer.Source()]() mutable {
+                transport->SendMessageToReplica(this, source, PBMessage(m));
+            });
+    }
+}
+
+void MinBFTReplica::HandleStateRequest(
+    const TransportAddress &remote, const proto::StateRequest &request //
+) {
+    proto::MinBFTMessage m;
+    auto &chunk = *m.mutable_state_chunk();
+    opnum_t ui = request.ui();
+    if (ui <= collected_ui) {
+        if (!checkpoints.HasStableState()) {
+            return;
+        }
+        auto &checkpoint = *chunk.mutable_checkpoint();
+        checkpoint.set_op_number(checkpoints.Stable());
+        checkpoint.set_digest(checkpoints.StableDigest());
+        checkpoint.set_app_state(checkpoints.StableState());
+        for (const auto &ui_checkpoint : checkpoints.StableProof()) {
+            checkpoint.add_ui_checkpoint(ui_checkpoint.second);
+        }
+        checkpoint.set_collected_ui(collected_ui);
+        checkpoint.set_collected_op(collected_op);
+        ui = collected_ui + 1;
+    }
+    chunk.set_ui(ui);
+    for (; ui <= request.last_ui(); ui += 1) {
+        auto iter = primary_messages.find(ui);
+        if (iter == primary_messages.end()) {
+            break;
+        }
+        chunk.add_ui_message(iter->second);
+    }
+    if (!chunk.has_checkpoint() && chunk.ui_message_size() == 0) {
+        return;
+    }
+
+    RDebug(
+        "Send StateChunk: primary ui = %lu (+%d), checkpoint = %d",
+        chunk.ui(), chunk.ui_message_size(), int(chunk.has_checkpoint()));
+    epilogue_list.push_back(
+        [this, m, replica_id = request.replica_id()]() mutable {
+            transport->SendMessageToReplica(this, replica_id, PBMessage(m));
+        });
+}
+
+void MinBFTReplica::HandleStateChunk(
+    const TransportAddress &remote, const proto::StateChunk &chunk,
+    std::map<int, string> proof, const std::map<int, opnum_t> &proof_ui,
+    vector<Runner::Solo> &replay //
+) {
+    RDebug(
+        "StateChunk: primary ui = %lu (+%d), checkpoint = %d", chunk.ui(),
+        chunk.ui_message_size(), int(chunk.has_checkpoint()));
+    if (chunk.has_checkpoint()) {
+        InstallCheckpoint(chunk.checkpoint(), move(proof), proof_ui);
+    }
+    for (Runner::Solo &solo : replay) {
+        solo();
+    }
+    SendStateRequests(state_transfer.Next(PrimaryUI()));
+}
+
+// skip the primary's UI messages up to the collected ones, and what is
+// executed up to the checkpoint
+void MinBFTReplica::InstallCheckpoint(
+    const proto::StableCheckpoint &checkpoint, std::map<int, string> proof,
+    const std::map<int, opnum_t> &proof_ui //
+) {
+    if ( //
+        checkpoint.op_number() <= commit_number ||
+        checkpoint.collected_ui() <= PrimaryUI()) {
+        return;
+    }
+    RNotice(
+        "Install checkpoint: op number = %lu, primary ui = %lu",
+        checkpoint.op_number(), checkpoint.collected_ui());
+    Restore(checkpoint.op_number(), checkpoint.app_state());
+    checkpoints.Install(
+        checkpoint.op_number(), checkpoint.digest(), move(proof),
+        checkpoint.app_state());
+    log.Reset(checkpoint.collected_op() + 1, EMPTY_HASH);
+    commit_number = checkpoint.op_number();
+    low_op.clear();
+    high_op.clear();
+    collected_ui = checkpoint.collected_ui();
+    collected_op = checkpoint.collected_op();
+
+    int primary = configuration.GetLeaderIndex(view_number);
+    next_ui[primary] = collected_ui + 1;
+    ui_queue[primary].erase(
+        ui_queue[primary].begin(), ui_queue[primary].upper_bound(collected_ui));
+    commit_quorum.ClearBefore(collected_ui + 1);
+    primary_messages.erase(
+        primary_messages.begin(), primary_messages.upper_bound(collected_ui));
+    HandleQueuedUI(primary);
+    // the other replicas' UI messages before their Checkpoint in the proof
+    // are covered by it, so a replica that (re)joins does not wait for them
+    // forever; the ones not in the proof still have to be received in order
+    for (const auto &pair : proof_ui) {
+        int replica_id = pair.first;
+        opnum_t ui = pair.second;
+        if ( //
+            replica_id == primary || replica_id == replicaIdx ||
+            ui < next_ui[replica_id]) {
+            continue;
+        }
+        next_ui[replica_id] = ui + 1;
+        ui_queue[replica_id].erase(
+            ui_queue[replica_id].begin(),
+            ui_queue[replica_id].upper_bound(ui));
+        HandleQueuedUI(replica_id);
     }
 }
 
@@ -346,13 +729,14 @@ void MinBFTReplica::HandleRequest(
     if (!close_batch_timeout->Active()) {
         close_batch_timeout->Start();
     }
-    if (request_batch.size() >= batch_size) {
+    if (request_batch.size() >= batch.Size()) {
         CloseBatch();
     }
 }
 
 void MinBFTReplica::CloseBatch() {
     close_batch_timeout->Stop();
+    batch.Close(log.LastOpnum(), request_batch.size());
 
     proto::UIMessage ui_message;
     ui_message.set_replica_id(replicaIdx);
@@ -377,6 +761,7 @@ void MinBFTReplica::CloseBatch() {
     *m.mutable_ui_message() = buffer;
     transport->SendMessageToAll(this, PBMessage(m));
     // });
+    primary_messages[minbft_layer.GetUI()] = move(buffer);
     SendCommit(minbft_layer.GetUI());
 }
 
@@ -1,8 +1,11 @@
 #pragma once
+#include "common/batchcontroller.h"
+#include "common/checkpoint.h"
 #include "common/quorumset.h"
 #include "common/replica.h"
 #include "common/request.pb.h"
 #include "common/runner.h"
+#include "common/statetransfer.h"
 #include "replication/minbft/message.pb.h"
 
 namespace dsnet {
@@ -13,19 +16,39 @@ public:
     MinBFTReplica(
         const Configuration &config, int replica_id,
         const std::string &identifier, int n_worker, int batch_size,
-        Transport *transport, AppReplica *app);
+        Transport *transport, AppReplica *app,
+        opnum_t checkpoint_interval = DEFAULT_CHECKPOINT_INTERVAL,
+        uint64_t target_latency_us = 0);
+    // run on the runner of caller, which outlives the replica
+    MinBFTReplica(
+        const Configuration &config, int replica_id,
+        const std::string &identifier, Runner &runner, int batch_size,
+        Transport *transport, AppReplica *app,
+        opnum_t checkpoint_interval = DEFAULT_CHECKPOINT_INTERVAL,
+        uint64_t target_latency_us = 0);
     ~MinBFTReplica();
 
     void ReceiveMessage(
         const TransportAddress &remote, void *buf, size_t len) override;
+    void ReceiveBuffer(
+        const TransportAddress &remote, TransportBuffer buffer) override;
 
 private:
+    MinBFTReplica(
+        const Configuration &config, int replica_id,
+        const std::string &identifier, std::unique_ptr<Runner> owned_runner,
+        Runner *external_runner, int batch_size, Transport *transport,
+        AppReplica *app, opnum_t checkpoint_interval,
+        uint64_t target_latency_us);
+
     const std::string identifier;
-    SpinRunner runner;
-    size_t batch_size;
+    std::unique_ptr<Runner> owned_runner;
+    Runner &runner;
+    BatchController batch;
 
     std::vector<std::string> request_batch;
     std::unique_ptr<Timeout> close_batch_timeout;
+    std::unique_ptr<Timeout> state_transfer_timeout;
     // ui -> log op mapping
     std::unordered_map<opnum_t, opnum_t> low_op, high_op;
 
@@ -35,7 +58,15 @@ private:
     std::unordered_map<int, std::map<uint64_t, Runner::Solo>> ui_queue;
     std::unordered_map<int, opnum_t> next_ui;
 
-    QuorumSet<opnum_t, proto::Commit> commit_quorum;
+    // by primary UI
+    QuorumWindow<proto::Commit> commit_quorum;
+    CheckpointTracker checkpoints;
+    // primary UIs up to this one are garbage collected, and their Prepare
+    // ends at `collected_op`
+    opnum_t collected_ui, collected_op;
+    // primary UI -> MinBFT[UIMessage], to be replayed by lagging replicas
+    std::map<opnum_t, std::string> primary_messages;
+    StateTransfer state_transfer;
 
     view_t view_number;
     opnum_t commit_number;
@@ -49,8 +80,8 @@ private:
     std::unordered_map<uint64_t, ClientEntry> client_table;
     std::vector<Runner::Epilogue> epilogue_list;
     void ConcludeEpilogue() {
-        runner.RunEpilogue([epilogue_list = this->epilogue_list] {
-            for (Runner::Epilogue epilogue : epilogue_list) {
+        runner.RunEpilogue([epilogue_list = std::move(this->epilogue_list)] {
+            for (const Runner::Epilogue &epilogue : epilogue_list) {
                 epilogue();
             }
         });
@@ -62,12 +93,41 @@ private:
         opnum_t ui, const std::vector<Request> &requests);
     void
     HandleCommit(const TransportAddress &remote, const proto::Commit &commit);
+    void HandleCheckpoint(
+        const TransportAddress &remote, const proto::Checkpoint &checkpoint,
+        const std::string &ui_checkpoint);
+    void HandleStateRequest(
+        const TransportAddress &remote, const proto::StateRequest &request);
+    // `proof` is the verified stable checkpoint proof, if chunk has one
+    void HandleStateChunk(
+        const TransportAddress &remote, const proto::StateChunk &chunk,
+        std::map<int, std::string> proof,
+        const std::map<int, opnum_t> &proof_ui,
+        std::vector<Runner::Solo> &replay);
     void HandleRequest(
         const TransportAddress &remote, const Request &request,
         const std::string &signed_request);
 
     void AddCommit(const proto::Commit &commit);
     void SendCommit(opnum_t ui);
+    void SendCheckpoint(opnum_t op_number);
+    void CollectGarbage();
+
+    Runner::Solo ParseUIMessage(
+        std::unique_ptr<TransportAddress> remote, std::string ui_buffer);
+    // the queued UI messages of the replica that are next in order
+    void HandleQueuedUI(int remote_id);
+    // the last primary UI message handled in order
+    opnum_t PrimaryUI() const {
+        return next_ui.at(configuration.GetLeaderIndex(view_number)) - 1;
+    }
+    void StartStateTransfer(opnum_t target, int source);
+    void SendStateRequests(const std::vector<StateTransfer::Range> &ranges);
+    // `proof_ui` is the UI of each Checkpoint in `proof`
+    void InstallCheckpoint(
+        const proto::StableCheckpoint &checkpoint,
+        std::map<int, std::string> proof,
+        const std::map<int, opnum_t> &proof_ui);
 
     void CloseBatch();
 };
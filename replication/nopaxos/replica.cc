@@ -56,11 +56,11 @@ NOPaxosReplica::NOPaxosReplica(const Configuration &config, int myIdx, bool init
                                Transport *transport, AppReplica *app)
 : Replica(config, 0, myIdx, initialize, transport, app),
     log(false),
-    gapReplyQuorum(config.n-1),
-    gapCommitQuorum(config.QuorumSize()-1),
+    gapReplyQuorum(config.n-1, config.n),
+    gapCommitQuorum(config.QuorumSize()-1, config.n),
     viewChangeQuorum(config.QuorumSize()-1),
     startViewQuorum(config.QuorumSize()-1),
-    syncPrepareQuorum(config.QuorumSize()-1)
+    syncPrepareQuorum(config.QuorumSize()-1, config.n)
 {
     transport->ListenOnMulticast(this, config);
     this->status = STATUS_NORMAL;
@@ -320,6 +320,7 @@ NOPaxosReplica::HandleGapReply(const TransportAddress &remote,
                 // Optimization: if the leader received 'not found' from
                 // all replicas, it can immediately start the gap agreement
                 // protocol, no need to wait for the timeout.
+                gapReplyQuorum.ClearBefore(this->lastOp+1);
                 if (gapReplyQuorum.AddAndCheckForQuorum(this->lastOp+1, msg.replicaidx(), msg)) {
                     StartGapAgreement();
                 }
@@ -395,6 +396,7 @@ NOPaxosReplica::HandleGapCommitReply(const TransportAddress &remote,
     // we have already added NOOP to the log, waiting for a
     // quorum of replies for that NOOP operation.
     if (msg.opnum() == this->lastOp) {
+        gapCommitQuorum.ClearBefore(msg.opnum());
         if (gapCommitQuorum.AddAndCheckForQuorum(msg.opnum(),
                                                  msg.replicaidx(),
                                                  msg)) {
@@ -831,6 +833,7 @@ NOPaxosReplica::HandleSyncPrepareReply(const TransportAddress &remote,
     }
 
     // We need a quorum of sync prepare replies to commit.
+    this->syncPrepareQuorum.ClearBefore(msg.syncpoint());
     if (this->syncPrepareQuorum.AddAndCheckForQuorum(msg.syncpoint(),
                                                      msg.replicaidx(),
                                                      msg)) {
@@ -91,11 +91,11 @@ private:
     bool pendingRequestsSorted;
 
     /* Quorums */
-    QuorumSet<opnum_t, proto::GapReplyMessage> gapReplyQuorum; // If none of the replicas received a message, the leader can immediately start gap agreement protocol
-    QuorumSet<opnum_t, proto::GapCommitReplyMessage> gapCommitQuorum;
+    QuorumWindow<proto::GapReplyMessage> gapReplyQuorum; // If none of the replicas received a message, the leader can immediately start gap agreement protocol
+    QuorumWindow<proto::GapCommitReplyMessage> gapCommitQuorum;
     QuorumSet<std::pair<sessnum_t, view_t>, proto::ViewChangeMessage> viewChangeQuorum;
     QuorumSet<std::pair<sessnum_t, view_t>, proto::StartViewReplyMessage> startViewQuorum;
-    QuorumSet<opnum_t, proto::SyncPrepareReplyMessage> syncPrepareQuorum;
+    QuorumWindow<proto::SyncPrepareReplyMessage> syncPrepareQuorum;
 
     /* Gaps */
     std::set<opnum_t> committedGaps;
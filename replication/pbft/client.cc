@@ -57,7 +57,7 @@ void PBFTClient::Invoke(const string &op, continuation_t then) {
 void PBFTClient::SendRequest(bool broadcast) {
     resend_timeout->Reset();
     PBMessage pb_layer(pending_request->message);
-    SignedAdapter signed_layer(pb_layer, identifier, false);
+    SignedAdapter signed_layer(pb_layer, identifier);
     if (!broadcast) {
         transport->SendMessageToReplica(
             this, config.GetLeaderIndex(view_number), signed_layer);
@@ -90,6 +90,7 @@ void PBFTClient::ReceiveMessage(
         return;
     }
 
+    resend_timeout->Stop();
     view_number = reply.view_number();
     auto then = pending_request->then;
     auto op = pending_request->message.request().op();
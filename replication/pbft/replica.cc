@@ -3,7 +3,10 @@
 #include "common/signedadapter.h"
 #include "sequencer/sequencer.h"
 
+#include <algorithm>
 #include <cstdlib>
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/wire_format_lite.h>
 
 #define RDebug(fmt, ...) Debug("[%d] " fmt, this->replicaIdx, ##__VA_ARGS__)
 #define RNotice(fmt, ...) Notice("[%d] " fmt, this->replicaIdx, ##__VA_ARGS__)
@@ -20,116 +23,304 @@ using std::vector;
 
 PBFTReplica::PBFTReplica(
     const Configuration &config, int replica_id, const string &identifier,
-    int n_worker, int batch_size, Transport *transport, AppReplica *app)
+    int n_worker, int batch_size, Transport *transport, AppReplica *app,
+    const string &runner_name, opnum_t checkpoint_interval,
+    uint64_t target_latency_us, int pipeline_depth)
+    : PBFTReplica(
+          config, replica_id, identifier,
+          CreateOrderedRunner(runner_name, n_worker), nullptr, batch_size,
+          transport, app, checkpoint_interval, target_latency_us,
+          pipeline_depth) {}
+
+PBFTReplica::PBFTReplica(
+    const Configuration &config, int replica_id, const string &identifier,
+    Runner &runner, int batch_size, Transport *transport, AppReplica *app,
+    opnum_t checkpoint_interval, uint64_t target_latency_us,
+    int pipeline_depth)
+    : PBFTReplica(
+          config, replica_id, identifier, nullptr, &runner, batch_size,
+          transport, app, checkpoint_interval, target_latency_us,
+          pipeline_depth) {}
+
+PBFTReplica::PBFTReplica(
+    const Configuration &config, int replica_id, const string &identifier,
+    unique_ptr<Runner> owned_runner, Runner *external_runner, int batch_size,
+    Transport *transport, AppReplica *app, opnum_t checkpoint_interval,
+    uint64_t target_latency_us, int pipeline_depth)
     : Replica(config, 0, replica_id, true, transport, app),
-      identifier(identifier), runner(n_worker), batch_size(batch_size),
-      view_number(0), op_number(0), commit_number(0), log(true) //
+      identifier(identifier), owned_runner(move(owned_runner)),
+      runner(
+          external_runner != nullptr ? *external_runner
+                                     : *this->owned_runner),
+      view_number(0), op_number(0), commit_number(0),
+      batch(batch_size, target_latency_us), log(true), low_watermark(0),
+      // PBFT suggests twice the checkpoint interval, so the primary keeps
+      // going while the next checkpoint becomes stable
+      window(
+          2 * std::max<opnum_t>(
+                  checkpoint_interval != 0 ? checkpoint_interval
+                                           : DEFAULT_CHECKPOINT_INTERVAL,
+                  std::max(pipeline_depth, 1) * batch.MaxSize())),
+      prepare_quorum(window), commit_quorum(window),
+      pipeline_depth(std::max(pipeline_depth, 1)),
+      checkpoints(checkpoint_interval, 2 * config.f + 1),
+      state_transfer(config.n, replica_id) //
 {
     // setenv("DEBUG", "replica.cc", 1);
+    if (config.n > 64) {
+        // replica bitmap of quorum slots
+        Panic("PBFT supports up to 64 replicas, %d configured", config.n);
+    }
 
     close_batch_timeout =
         unique_ptr<Timeout>(new Timeout(transport, 10, [this] {
-            runner.RunPrologue([this] { return [this] { CloseBatch(); }; });
+            runner.RunPrologue([this] {
+                return [this] {
+                    CloseBatch(true);
+                    ConcludeEpilogue();
+                };
+            });
+        }));
+    state_transfer_timeout =
+        unique_ptr<Timeout>(new Timeout(transport, 100, [this] {
+            runner.RunPrologue([this] {
+                return [this] {
+                    SendStateRequests(state_transfer.Retry(log.LastOpnum()));
+                    ConcludeEpilogue();
+                };
+            });
         }));
 }
 
-PBFTReplica::~PBFTReplica() {
-    //
+PBFTReplica::~PBFTReplica() { batch.Dump(); }
+
+// tell client requests before verifying them, by the field number of `sub`
+static bool IsRequest(const TransportBuffer &buffer) {
+    const void *inner;
+    size_t inner_size;
+    if (!SignedAdapter::PeekInner(
+            buffer.data(), buffer.size(), inner, inner_size)) {
+        return false;
+    }
+    google::protobuf::io::CodedInputStream stream(
+        (const uint8_t *)inner, inner_size);
+    return google::protobuf::internal::WireFormatLite::GetTagFieldNumber(
+               stream.ReadTag()) == proto::PBFTMessage::kRequestFieldNumber;
 }
 
 void PBFTReplica::ReceiveMessage(
     const TransportAddress &remote, void *buf, size_t len //
 ) {
-    runner.RunPrologue(
+    ReceiveBuffer(remote, TransportBuffer::Copy(buf, len));
+}
+
+void PBFTReplica::ReceiveBuffer(
+    const TransportAddress &remote, TransportBuffer buffer //
+) {
+    bool is_request = IsRequest(buffer);
+    Runner::Prologue prologue =
         [ //
-            this, escaping_remote = remote.clone(),
-            owned_buffer = string((const char *)buf, len) //
-    ]() -> Runner::Solo {
-            auto remote = unique_ptr<TransportAddress>(escaping_remote);
+            this, remote = unique_ptr<TransportAddress>(remote.clone()),
+            owned_buffer = move(buffer) //
+    ]() mutable -> Runner::Solo {
             proto::PBFTMessage message;
             PBMessage pb_layer(message);
-            SignedAdapter signed_layer(pb_layer, "");
+            SignedAdapter signed_layer(pb_layer, identifier);
             signed_layer.Parse(owned_buffer.data(), owned_buffer.size());
             if (!signed_layer.IsVerified()) {
                 RWarning("Receive message failed to verify");
                 return nullptr;
             }
+            // Prepares, Commits and Checkpoints are kept as proof of the
+            // sender's replica id
+            if ( //
+                message.has_checkpoint() &&
+                !SignedBy(signed_layer, message.checkpoint().replica_id())) {
+                RWarning("Checkpoint not signed by its replica");
+                return nullptr;
+            }
+            if ( //
+                message.has_prepare() &&
+                (!SignedBy(signed_layer, message.prepare().replica_id()) ||
+                 !FitsWindow(message.prepare().batch_size()))) {
+                RWarning("Invalid Prepare");
+                return nullptr;
+            }
+            if ( //
+                message.has_commit() &&
+                (!SignedBy(signed_layer, message.commit().replica_id()) ||
+                 !FitsWindow(message.commit().batch_size()))) {
+                RWarning("Invalid Commit");
+                return nullptr;
+            }
             switch (message.sub_case()) {
             case proto::PBFTMessage::SubCase::kRequest:
                 return [ //
-                           this, escaping_remote = remote.release(), message,
-                           owned_buffer //
+                           this, remote = move(remote), message = move(message),
+                           owned_buffer = move(owned_buffer) //
                 ]() {
-                    auto remote = unique_ptr<TransportAddress>(escaping_remote);
                     HandleRequest(*remote, message.request(), owned_buffer);
+                    ConcludeEpilogue();
                 };
             case proto::PBFTMessage::SubCase::kPreprepare: {
                 const string &prepare_buffer =
                     message.preprepare().signed_prepare();
                 proto::Prepare prepare_message;
                 PBMessage pb_prepare(prepare_message);
-                SignedAdapter signed_prepare(pb_prepare, "");
+                SignedAdapter signed_prepare(pb_prepare, identifier);
                 signed_prepare.Parse(
                     prepare_buffer.data(), prepare_buffer.size());
-                if (!signed_prepare.IsVerified()) {
+                if ( //
+                    !signed_prepare.IsVerified() ||
+                    !SignedBy(signed_prepare, prepare_message.replica_id()) ||
+                    !FitsWindow(prepare_message.batch_size())) {
                     RWarning("Failed to verify Preprepare (Prepare)");
                     return nullptr;
                 }
 
+                // verify the whole client batch in one go
+                static thread_local SignedBatch<proto::PBFTMessage, PBMessage>
+                    request_messages;
+                size_t n_request = prepare_message.batch_size();
+                if ((size_t)message.preprepare().signed_message_size() !=
+                        n_request ||
+                    !request_messages.Parse(
+                        identifier, message.preprepare().signed_message())) {
+                    RWarning("Failed to verify Preprepare (Request)");
+                    return nullptr;
+                }
                 vector<Request> requests;
-                for (uint64_t i = 0; i < prepare_message.batch_size(); i += 1) {
-                    const string &request_buffer =
-                        message.preprepare().signed_message(i);
-                    proto::PBFTMessage request_message;
-                    PBMessage pb_request(request_message);
-                    SignedAdapter signed_request(pb_request, "");
-                    signed_request.Parse(
-                        request_buffer.data(), request_buffer.size());
-                    if (!signed_request.IsVerified() ||
-                        !request_message.has_request()) {
+                requests.reserve(n_request);
+                for (size_t i = 0; i < n_request; i += 1) {
+                    auto &request_message = request_messages.Message(i);
+                    if (!request_message.has_request()) {
                         RWarning("Failed to verify Preprepare (Request)");
                         return nullptr;
                     }
-                    requests.push_back(request_message.request());
+                    requests.push_back(move(*request_message.mutable_request()));
                 }
 
                 return [ //
-                           this, escaping_remote = remote.release(), message,
-                           prepare_message, prepare_buffer,
-                           requests //
+                           this, remote = move(remote),
+                           prepare_message = move(prepare_message),
+                           prepare_buffer = move(*message.mutable_preprepare()
+                                                     ->mutable_signed_prepare()),
+                           requests = move(requests) //
                 ]() {
-                    auto remote = unique_ptr<TransportAddress>(escaping_remote);
                     HandlePreprepare(
                         *remote, prepare_message, prepare_buffer, requests);
+                    ConcludeEpilogue();
                 };
             }
             case proto::PBFTMessage::SubCase::kPrepare:
                 return [ //
-                           this, escaping_remote = remote.release(), message,
-                           owned_buffer]() {
-                    auto remote = unique_ptr<TransportAddress>(escaping_remote);
+                           this, remote = move(remote), message = move(message),
+                           owned_buffer = move(owned_buffer) //
+                ]() {
                     HandlePrepare(*remote, message.prepare(), owned_buffer);
+                    ConcludeEpilogue();
                 };
             case proto::PBFTMessage::SubCase::kCommit:
-                return [this, escaping_remote = remote.release(), message,
-                        owned_buffer]() {
-                    auto remote = unique_ptr<TransportAddress>(escaping_remote);
+                return [ //
+                           this, remote = move(remote), message = move(message),
+                           owned_buffer = move(owned_buffer) //
+                ]() {
                     HandleCommit(*remote, message.commit(), owned_buffer);
+                    ConcludeEpilogue();
                 };
+            case proto::PBFTMessage::SubCase::kCheckpoint:
+                return [ //
+                           this, remote = move(remote), message = move(message),
+                           owned_buffer = move(owned_buffer) //
+                ]() {
+                    HandleCheckpoint(
+                        *remote, message.checkpoint(), owned_buffer);
+                    ConcludeEpilogue();
+                };
+            case proto::PBFTMessage::SubCase::kStateRequest:
+                return [ //
+                           this, remote = move(remote),
+                           message = move(message) //
+                ]() {
+                    HandleStateRequest(*remote, message.state_request());
+                    ConcludeEpilogue();
+                };
+            case proto::PBFTMessage::SubCase::kStateChunk: {
+                // the checkpoint proof and state are verified here, while
+                // entries are verified against commit certificates on the
+                // solo path
+                std::map<int, string> proof;
+                const auto &chunk = message.state_chunk();
+                if (chunk.has_checkpoint()) {
+                    const auto &checkpoint = chunk.checkpoint();
+                    if (CheckpointDigest(
+                            checkpoint.app_state(), checkpoint.log_hash()) !=
+                        checkpoint.digest()) {
+                        RWarning("Checkpoint state mismatch in StateChunk");
+                        return nullptr;
+                    }
+                    for (const string &signed_checkpoint :
+                         checkpoint.signed_checkpoint()) {
+                        proto::PBFTMessage checkpoint_message;
+                        PBMessage pb_checkpoint(checkpoint_message);
+                        SignedAdapter signed_layer(pb_checkpoint, identifier);
+                        signed_layer.Parse(
+                            signed_checkpoint.data(), signed_checkpoint.size());
+                        if ( //
+                            !signed_layer.IsVerified() ||
+                            !checkpoint_message.has_checkpoint() ||
+                            checkpoint_message.checkpoint().op_number() !=
+                                checkpoint.op_number() ||
+                            checkpoint_message.checkpoint().digest() !=
+                                checkpoint.digest() ||
+                            !SignedBy(
+                                signed_layer,
+                                checkpoint_message.checkpoint().replica_id())) {
+                            RWarning("Invalid checkpoint proof in StateChunk");
+                            return nullptr;
+                        }
+                        proof[checkpoint_message.checkpoint().replica_id()] =
+                            signed_checkpoint;
+                    }
+                    if ((int)proof.size() < 2 * configuration.f + 1) {
+                        RWarning("Not enough checkpoint proof in StateChunk");
+                        return nullptr;
+                    }
+                }
+                return [ //
+                           this, remote = move(remote), message = move(message),
+                           proof = move(proof) //
+                ]() mutable {
+                    HandleStateChunk(
+                        *remote, message.state_chunk(), move(proof));
+                    ConcludeEpilogue();
+                };
+            }
             default:
                 RPanic("Unexpected message case: %d", message.sub_case());
             }
             return nullptr;
-        });
+        };
+    if (!is_request) {
+        runner.RunPrologue(move(prologue));
+        return;
+    }
+    // client retries a shed request, protocol messages are never shed
+    runner.RunSheddablePrologue(
+        move(prologue), [this] { RDebug("Shed client request"); });
 }
 
 void PBFTReplica::HandleRequest(
     const TransportAddress &remote, const Request &request,
-    const string &signed_message //
+    const TransportBuffer &signed_message //
 ) {
     const auto &iter = client_table.find(request.clientid());
     if (iter != client_table.end()) {
         auto &entry = iter->second;
+        // entry may be created by executing a request from state transfer
+        if (!entry.remote) {
+            entry.remote = unique_ptr<TransportAddress>(remote.clone());
+        }
         if (entry.request_number > request.clientreqid()) {
             return;
         }
@@ -143,10 +334,8 @@ void PBFTReplica::HandleRequest(
             return;
         }
     } else {
+        // the client may be new to a backup that lost its earlier requests
         ClientEntry entry;
-        if (request.clientreqid() != 1) {
-            NOT_IMPLEMENTED();
-        }
         entry.request_number = request.clientreqid();
         entry.has_reply = false;
         entry.remote = unique_ptr<TransportAddress>(remote.clone());
@@ -177,22 +366,56 @@ void PBFTReplica::HandleRequest(
         close_batch_timeout->Start();
     }
 
-    if (request_batch.size() >= batch_size) {
-        CloseBatch();
+    if (request_batch.size() >= batch.Size()) {
+        CloseBatch(false);
     }
 }
 
-void PBFTReplica::CloseBatch() {
-    close_batch_timeout->Stop();
+// pending requests are in the log already, so they take the next op numbers
+// whether or not their batch is closed
+void PBFTReplica::CloseBatch(bool flush) {
+    while (!request_batch.empty()) {
+        size_t n_request = std::min(request_batch.size(), batch.Size());
+        if (n_request < batch.Size() && !flush) {
+            break;
+        }
+        opnum_t first_op = op_number - request_batch.size() + 1;
+        opnum_t last_op = first_op + n_request - 1;
+        // continued on commit or on the next stable checkpoint
+        if ( //
+            (int)proposed.size() >= pipeline_depth ||
+            !InWindow(first_op) || !InWindow(last_op)) {
+            RDebug(
+                "Pipeline full: op number = %lu, %zu in flight, low "
+                "watermark = %lu",
+                first_op, proposed.size(), low_watermark);
+            break;
+        }
+        batch.Close(last_op, n_request);
+        proposed.push_back(last_op);
+        vector<TransportBuffer> requests(
+            std::make_move_iterator(request_batch.begin()),
+            std::make_move_iterator(request_batch.begin() + n_request));
+        request_batch.erase(
+            request_batch.begin(), request_batch.begin() + n_request);
+        ProposeBatch(first_op, move(requests));
+    }
+    if (request_batch.empty()) {
+        close_batch_timeout->Stop();
+    }
+}
 
+void PBFTReplica::ProposeBatch(
+    opnum_t first_op, vector<TransportBuffer> requests //
+) {
     proto::Prepare prepare;
     prepare.set_view_number(view_number);
-    prepare.set_op_number(op_number - request_batch.size() + 1);
-    prepare.set_batch_size(request_batch.size());
-    prepare.set_digest(log.LastHash());
+    prepare.set_op_number(first_op);
+    prepare.set_batch_size(requests.size());
+    prepare.set_digest(log.Find(first_op + requests.size() - 1)->hash);
     prepare.set_replica_id(replicaIdx);
-    runner.RunEpilogue([this, prepare,
-                        request_batch = this->request_batch]() mutable {
+    epilogue_list.push_back([this, prepare,
+                             request_batch = move(requests)]() mutable {
         PBMessage pb_prepare(prepare);
         SignedAdapter signed_prepare(pb_prepare, identifier);
         string signed_prepare_buffer;
@@ -203,7 +426,8 @@ void PBFTReplica::CloseBatch() {
         auto &preprepare = *message.mutable_preprepare();
         *preprepare.mutable_signed_prepare() = signed_prepare_buffer;
         for (uint64_t i = 0; i < request_batch.size(); i += 1) {
-            preprepare.add_signed_message(request_batch[i]);
+            preprepare.add_signed_message(
+                request_batch[i].data(), request_batch[i].size());
         }
         PBMessage pb_layer(message);
         SignedAdapter signed_layer(pb_layer, identifier, false);
@@ -216,7 +440,6 @@ void PBFTReplica::CloseBatch() {
             RWarning("Failed to send Preprepare");
         }
     });
-    this->request_batch.clear();
 }
 
 void PBFTReplica::HandlePreprepare(
@@ -234,13 +457,25 @@ void PBFTReplica::HandlePreprepare(
     if (IsPrimary()) {
         NOT_REACHABLE();
     }
-    if (prepare.op_number() <= log.LastOpnum()) {
+    if (!InWindow(prepare.op_number())) {
+        RDebug(
+            "Preprepare out of window: op number = %lu, low watermark = %lu",
+            prepare.op_number(), low_watermark);
         return;
     }
     RDebug(
         "prepare op number = %lu, log last op number = %lu",
         prepare.op_number(), log.LastOpnum());
-    if (prepare.op_number() != log.LastOpnum() + 1) {
+    if (prepare.op_number() <= log.LastOpnum()) {
+        // the entries may be in the log by state transfer already, then the
+        // Preprepare still counts, and is answered, if it matches them
+        if ( //
+            !CertifiedEnd(
+                prepare.op_number(), prepare.batch_size(), prepare.digest()) ||
+            log.Find(prepare.op_number())->state != LOG_STATE_RECEIVED) {
+            return;
+        }
+    } else if (prepare.op_number() != log.LastOpnum() + 1) {
         RDebug(
             "Buffer request: op number = %lu (+%lu)", prepare.op_number(),
             prepare.batch_size());
@@ -253,30 +488,26 @@ void PBFTReplica::HandlePreprepare(
                 viewstamp_t(view_number, prepare.op_number() + i),
                 LOG_STATE_RECEIVED, requests[i]));
         }
-        auto iter = request_buffer.begin();
-        while (iter != request_buffer.end()) {
-            RDebug("Next buffered: op number = %lu", iter->first);
-            if (iter->first != log.LastOpnum() + 1) {
-                break;
-            }
-            log.Append(new LogEntry(
-                viewstamp_t(view_number, iter->first), LOG_STATE_RECEIVED,
-                iter->second));
-            iter = request_buffer.erase(iter);
+        AppendBuffered();
+        // buffered entries may have their certificates collected already
+        if (log.LastOpnum() >= prepare.op_number() + prepare.batch_size()) {
+            PrepareCertified(prepare.op_number() + prepare.batch_size());
+            CommitCertified();
+            ExecuteCommitted();
         }
     }
 
-    InsertPrepare(prepare, signed_prepare);
-    if ( //
-        log.LastOpnum() >= prepare.op_number() &&
-        log.Find(prepare.op_number())->state == LOG_STATE_PREPARED) {
-        return;
-    }
+    InsertPrepare(
+        prepare, TransportBuffer(
+                     signed_prepare.data(), signed_prepare.size(), nullptr,
+                     nullptr));
+    // sent even if prepared already, the replicas that missed some Prepares,
+    // e.g. of a lagging replica, may need this one
 
     proto::PBFTMessage message;
     *message.mutable_prepare() = prepare;
     message.mutable_prepare()->set_replica_id(replicaIdx);
-    runner.RunEpilogue([this, message]() mutable {
+    epilogue_list.push_back([this, message]() mutable {
         PBMessage pb_layer(message);
         SignedAdapter signed_layer(pb_layer, identifier);
         RDebug(
@@ -286,13 +517,81 @@ void PBFTReplica::HandlePreprepare(
     });
 }
 
-void PBFTReplica::InsertPrepare(
-    const proto::Prepare &prepare, const string &signed_prepare //
+PBFTReplica::QuorumSlot::Certificate *PBFTReplica::QuorumSlot::Add(
+    const string &digest, opnum_t batch_size, int replica_id,
+    const char *message, size_t size, int n_replica //
 ) {
+    if (replica_id < 0 || replica_id >= n_replica) {
+        return nullptr;
+    }
+    Certificate *certificate = nullptr;
+    for (size_t i = 0; i < n_certificate; i += 1) {
+        if ( //
+            certificates[i].digest == digest &&
+            certificates[i].batch_size == batch_size) {
+            certificate = &certificates[i];
+            break;
+        }
+    }
+    // a resent message counts once
+    if (replicas >> replica_id & 1) {
+        return certificate != nullptr &&
+                       certificate->replicas >> replica_id & 1
+                   ? certificate
+                   : nullptr;
+    }
+    if (certificate == nullptr) {
+        if (n_certificate == certificates.size()) {
+            certificates.emplace_back();
+        }
+        certificate = &certificates[n_certificate];
+        n_certificate += 1;
+        certificate->digest = digest;
+        certificate->batch_size = batch_size;
+        certificate->replicas = 0;
+        certificate->messages.resize(n_replica);
+    }
+    certificate->messages[replica_id].assign(message, size);
+    certificate->replicas |= 1ull << replica_id;
+    replicas |= 1ull << replica_id;
+    return certificate;
+}
 
-    prepare_quorum //
-        [prepare.op_number()][prepare.digest()][prepare.replica_id()] =
-            signed_prepare;
+PBFTReplica::QuorumSlot &PBFTReplica::AcquireSlot(
+    vector<QuorumSlot> &quorum, opnum_t op_number //
+) {
+    ASSERT(InWindow(op_number));
+    QuorumSlot &slot = quorum[op_number % window];
+    if (slot.op_number != op_number) {
+        slot.Reset(op_number);
+    }
+    return slot;
+}
+
+const PBFTReplica::QuorumSlot *PBFTReplica::FindSlot(
+    const vector<QuorumSlot> &quorum, opnum_t op_number) const {
+    const QuorumSlot &slot = quorum[op_number % window];
+    if (slot.op_number != op_number || !InWindow(op_number)) {
+        return nullptr;
+    }
+    return &slot;
+}
+
+void PBFTReplica::InsertPrepare(
+    const proto::Prepare &prepare, const TransportBuffer &signed_prepare //
+) {
+    QuorumSlot::Certificate *certificate =
+        AcquireSlot(prepare_quorum, prepare.op_number())
+            .Add(
+                prepare.digest(), prepare.batch_size(), prepare.replica_id(),
+                signed_prepare.data(), signed_prepare.size(),
+                configuration.n);
+    if (certificate == nullptr) {
+        RWarning(
+            "Conflicting Prepare: op number = %lu, replica id = %d",
+            prepare.op_number(), prepare.replica_id());
+        return;
+    }
 
     // in paper there are 2f PREPARE that matches PREPREPARE to be collected
     // here PREPREPARE is implemented by wrapping PREPARE, so a quorum cert
@@ -304,27 +603,38 @@ void PBFTReplica::InsertPrepare(
     // the one from itself must be (virtually) inserted (and broadcast) already,
     // which happens on a successful handling PREPREPARE. If there is no such
     // handling, state transfer happens above and quit before here
-    if ( //
-        (int)prepare_quorum[prepare.op_number()][prepare.digest()].size() <
-        2 * configuration.f //
-    ) {
+    if (__builtin_popcountll(certificate->replicas) < 2 * configuration.f) {
         return;
     }
     RDebug("PREPARED: op number = %lu", prepare.op_number());
 
-    if (prepare.op_number() > log.LastOpnum()) {
-        NOT_IMPLEMENTED(); // state transfer
+    if (prepare.op_number() + prepare.batch_size() - 1 > log.LastOpnum()) {
+        // missed the Preprepare, and the requests in it
+        StartStateTransfer(
+            prepare.op_number() + prepare.batch_size() - 1,
+            prepare.replica_id());
+        return;
     }
 
+    // committed by a certificate already, which sent the Commit as well
+    if (log.Find(prepare.op_number())->state != LOG_STATE_RECEIVED) {
+        return;
+    }
     log.Find(prepare.op_number())->state = LOG_STATE_PREPARED;
+    SendCommit(prepare.op_number(), prepare.batch_size(), prepare.digest());
+}
+
+void PBFTReplica::SendCommit(
+    opnum_t op_number, opnum_t batch_size, const string &digest //
+) {
     proto::PBFTMessage message;
     auto &commit = *message.mutable_commit();
     commit.set_view_number(view_number);
-    commit.set_op_number(prepare.op_number());
-    commit.set_batch_size(prepare.batch_size());
-    commit.set_digest(prepare.digest());
+    commit.set_op_number(op_number);
+    commit.set_batch_size(batch_size);
+    commit.set_digest(digest);
     commit.set_replica_id(replicaIdx);
-    runner.RunEpilogue([this, message]() mutable {
+    epilogue_list.push_back([this, message]() mutable {
         PBMessage pb_layer(message);
         SignedAdapter signed_layer(pb_layer, identifier);
         transport->SendMessageToAll(this, signed_layer);
@@ -333,7 +643,7 @@ void PBFTReplica::InsertPrepare(
 
 void PBFTReplica::HandlePrepare(
     const TransportAddress &remote, const proto::Prepare &prepare,
-    const std::string &signed_prepare //
+    const TransportBuffer &signed_prepare //
 ) {
     if (prepare.view_number() < view_number) {
         return;
@@ -341,6 +651,10 @@ void PBFTReplica::HandlePrepare(
     if (prepare.view_number() > view_number) {
         NOT_IMPLEMENTED(); // state transfer
     }
+    // garbage collected, or too far ahead
+    if (!InWindow(prepare.op_number())) {
+        return;
+    }
     if ( //
         prepare.op_number() <= log.LastOpnum() &&
         log.Find(prepare.op_number())->state != LOG_STATE_RECEIVED) {
@@ -357,7 +671,7 @@ struct ExecuteContext {
 
 void PBFTReplica::HandleCommit(
     const TransportAddress &remote, const proto::Commit &commit,
-    const string &signed_commit //
+    const TransportBuffer &signed_commit //
 ) {
     if (commit.view_number() < view_number) {
         return;
@@ -365,19 +679,28 @@ void PBFTReplica::HandleCommit(
     if (commit.view_number() > view_number) {
         NOT_IMPLEMENTED(); // state transfer
     }
+    if (!InWindow(commit.op_number())) {
+        return;
+    }
     if ( //
         commit.op_number() <= log.LastOpnum() &&
         log.Find(commit.op_number())->state == LOG_STATE_COMMITTED) {
         return;
     }
 
-    commit_quorum //
-        [commit.op_number()][commit.digest()][commit.replica_id()] =
-            signed_commit;
+    QuorumSlot::Certificate *certificate =
+        AcquireSlot(commit_quorum, commit.op_number())
+            .Add(
+                commit.digest(), commit.batch_size(), commit.replica_id(),
+                signed_commit.data(), signed_commit.size(), configuration.n);
+    if (certificate == nullptr) {
+        RWarning(
+            "Conflicting Commit: op number = %lu, replica id = %d",
+            commit.op_number(), commit.replica_id());
+        return;
+    }
     // 2f + 1 -> 2f, similiar to PREPARE quorum
-    if ( //
-        (int)commit_quorum[commit.op_number()][commit.digest()].size() <
-        2 * configuration.f) {
+    if (__builtin_popcountll(certificate->replicas) < 2 * configuration.f) {
         return;
     }
     // TODO check prepare quorum as well
@@ -386,15 +709,44 @@ void PBFTReplica::HandleCommit(
         "COMMITTED: op number = %lu (+%lu)", commit.op_number(),
         commit.batch_size());
 
-    if (commit.op_number() > log.LastOpnum()) {
-        NOT_IMPLEMENTED(); // state transfer
+    opnum_t last = commit.op_number() + commit.batch_size() - 1;
+    if (last > log.LastOpnum() && !chunk_buffer.empty()) {
+        // shipped entries may be waiting for this certificate
+        opnum_t last_op_number = log.LastOpnum();
+        AppendBuffered();
+        PrepareCertified(last_op_number + 1);
     }
-
-    for (uint64_t i = 0; i < commit.batch_size(); i += 1) {
-        log.Find(commit.op_number() + i)->state = LOG_STATE_COMMITTED;
+    if (last > log.LastOpnum()) {
+        // the certificate is kept, and checked again in `CommitCertified`
+        // once state transfer fills the log up to it
+        StartStateTransfer(last, commit.replica_id());
+        return;
+    }
+    if (!CertifiedEnd(
+            commit.op_number(), commit.batch_size(), commit.digest())) {
+        // a quorum committed other entries than this replica has, which
+        // are dropped and fetched again
+        RWarning(
+            "Commit certificate mismatch: op number = %lu (+%lu)",
+            commit.op_number(), commit.batch_size());
+        log.RemoveAfter(commit_number + 1);
+        chunk_buffer.clear();
+        request_buffer.clear();
+        StartStateTransfer(last, commit.replica_id());
+        return;
     }
 
-    std::vector<Runner::Epilogue> epilogue_list;
+    // the commit certificate may complete before the prepare one, then
+    // Prepares are dropped and this replica would never send its Commit,
+    // which others (e.g. the primary) may be waiting for; `CommitUpTo` sends
+    // it. A batch before it is not committed yet, maybe never by its own
+    // certificate if its Commits are lost, and then the pipeline would wait
+    // for it forever; the digest of this one chains its entries as well
+    CommitUpTo(last);
+    ExecuteCommitted();
+}
+
+void PBFTReplica::ExecuteCommitted() {
     while (auto entry = log.Find(commit_number + 1)) {
         if (entry->state != LOG_STATE_COMMITTED) {
             break;
@@ -413,20 +765,430 @@ void PBFTReplica::HandleCommit(
         client_entry.request_number = entry->request.clientreqid();
         client_entry.has_reply = true;
         client_entry.reply = reply;
-        auto remote =
-            unique_ptr<TransportAddress>(client_entry.remote->clone());
+        // no address if the request itself is only known by state transfer
+        if (client_entry.remote) {
+            epilogue_list.push_back(
+                [ //
+                    this, reply,
+                    remote = unique_ptr<TransportAddress>(
+                        client_entry.remote->clone()) //
+            ]() mutable {
+                    transport->SendMessage(this, *remote, PBMessage(reply));
+                });
+        }
 
+        // per op, so the state is snapshot right at the checkpoint
+        if (opnum_t checkpoint_number = checkpoints.Take(commit_number)) {
+            SendCheckpoint(checkpoint_number);
+        }
+    }
+    batch.Commit(commit_number);
+    while (!proposed.empty() && proposed.front() <= commit_number) {
+        proposed.pop_front();
+    }
+    if (!checkpoints.Enabled()) {
+        // nothing is garbage collected, the window follows commits instead
+        low_watermark = commit_number;
+    }
+    if (IsPrimary()) {
+        CloseBatch(false);
+    }
+}
+
+// signed on the solo path, but only once per checkpoint interval, and the own
+// signed copy is needed as part of the stable proof
+void PBFTReplica::SendCheckpoint(opnum_t op_number) {
+    string state;
+    Snapshot(op_number, state);
+    const string &log_hash = log.Find(op_number)->hash;
+    proto::PBFTMessage message;
+    auto &checkpoint = *message.mutable_checkpoint();
+    checkpoint.set_op_number(op_number);
+    checkpoint.set_digest(CheckpointDigest(state, log_hash));
+    checkpoint.set_replica_id(replicaIdx);
+    PBMessage pb_layer(message);
+    SignedAdapter signed_layer(pb_layer, identifier);
+    string signed_checkpoint;
+    signed_checkpoint.resize(signed_layer.SerializedSize());
+    signed_layer.Serialize(&signed_checkpoint.front());
+    RDebug("Send Checkpoint: op number = %lu", op_number);
+    checkpoints.SetState(op_number, move(state), log_hash);
+
+    epilogue_list.push_back([this, signed_checkpoint]() {
+        transport->SendMessageToAll(
+            this, BufferMessage(
+                      signed_checkpoint.data(), signed_checkpoint.size()));
+    });
+    if (checkpoints.Add(
+            op_number, checkpoint.digest(), replicaIdx,
+            move(signed_checkpoint))) {
+        CollectGarbage();
+    }
+}
+
+void PBFTReplica::HandleCheckpoint(
+    const TransportAddress &remote, const proto::Checkpoint &checkpoint,
+    const TransportBuffer &signed_checkpoint //
+) {
+    if (checkpoints.Add(
+            checkpoint.op_number(), checkpoint.digest(),
+            checkpoint.replica_id(), signed_checkpoint.ToString())) {
+        CollectGarbage();
+        // Prepares and Commits up to the checkpoint were dropped, and the
+        // entries may be garbage collected by others already
+        if (checkpoints.Stable() > low_watermark + window) {
+            StartStateTransfer(checkpoints.Stable(), checkpoint.replica_id());
+        }
+    }
+}
+
+// a replica that is behind the stable checkpoint keeps what it has not
+// executed yet
+void PBFTReplica::CollectGarbage() {
+    opnum_t low = std::min(checkpoints.Stable(), commit_number);
+    RDebug(
+        "Stable checkpoint: op number = %lu, collect up to %lu",
+        checkpoints.Stable(), low);
+    log.RemoveBefore(low + 1);
+    // batches are committed as a whole, so the one starting at or below
+    // `low` is done as well, and its quorum slots are left to the ops that
+    // take them over
+    low_watermark = low;
+    request_buffer.erase(
+        request_buffer.begin(), request_buffer.upper_bound(low));
+    chunk_buffer.erase(chunk_buffer.begin(), chunk_buffer.upper_bound(low));
+    if (IsPrimary()) {
+        CloseBatch(false);
+    }
+}
+
+// requests of Preprepare and entries of StateChunk that continue the log
+void PBFTReplica::AppendBuffered() {
+    while (true) {
+        opnum_t next = log.LastOpnum() + 1;
+        auto request = request_buffer.begin();
+        if (request != request_buffer.end() && request->first < next) {
+            request_buffer.erase(request);
+            continue;
+        }
+        if (request != request_buffer.end() && request->first == next) {
+            RDebug("Next buffered: op number = %lu", request->first);
+            log.Append(new LogEntry(
+                viewstamp_t(view_number, request->first), LOG_STATE_RECEIVED,
+                request->second));
+            request_buffer.erase(request);
+            continue;
+        }
+
+        if (chunk_buffer.empty() || chunk_buffer.begin()->first > next) {
+            return;
+        }
+        // shipped entries are appended as far as the buffered chunks reach,
+        // but only kept up to the end of the last certified batch among
+        // them, and the rest waits in the buffer for its certificate, which
+        // may be the one of a later batch
+        for (const auto &chunk : chunk_buffer) {
+            if (chunk.first > log.LastOpnum() + 1) {
+                break;
+            }
+            const proto::StateChunk &entries = chunk.second;
+            for (int i = log.LastOpnum() + 1 - chunk.first;
+                 i < entries.request_size(); i += 1) {
+                log.Append(new LogEntry(
+                    viewstamp_t(entries.view_number(), chunk.first + i),
+                    LOG_STATE_RECEIVED, entries.request(i)));
+            }
+        }
+        bool conflict;
+        opnum_t certified = CertifiedLast(next, conflict);
+        if (conflict) {
+            // the source, or an entry before it, disagrees with a quorum;
+            // everything not committed is fetched again, and the stalled
+            // transfer moves on to another source on retry
+            RWarning(
+                "Shipped entries mismatch certificate: op number = %lu .. %lu",
+                next, log.LastOpnum());
+            log.RemoveAfter(commit_number + 1);
+            chunk_buffer.clear();
+            request_buffer.clear();
+            return;
+        }
+        log.RemoveAfter(std::max(certified, next - 1) + 1);
+        while ( //
+            !chunk_buffer.empty() &&
+            chunk_buffer.begin()->first +
+                    chunk_buffer.begin()->second.request_size() <=
+                log.LastOpnum() + 1) {
+            chunk_buffer.erase(chunk_buffer.begin());
+        }
+        if (certified < next) {
+            return;
+        }
+    }
+}
+
+// The last op in [from, last op of the log] that ends a certified batch, or
+// 0. `conflict` is set if a certificate ending there is for other entries.
+opnum_t PBFTReplica::CertifiedLast(opnum_t from, bool &conflict) {
+    opnum_t certified = 0;
+    conflict = false;
+    for (const auto *quorum : {&prepare_quorum, &commit_quorum}) {
+        for (const QuorumSlot &slot : *quorum) {
+            if (!InWindow(slot.op_number)) {
+                continue;
+            }
+            for (size_t i = 0; i < slot.n_certificate; i += 1) {
+                const QuorumSlot::Certificate &certificate =
+                    slot.certificates[i];
+                opnum_t end = slot.op_number + certificate.batch_size - 1;
+                if ( //
+                    __builtin_popcountll(certificate.replicas) <
+                        2 * configuration.f ||
+                    end < from || end > log.LastOpnum()) {
+                    continue;
+                }
+                if (CertifiedEnd(
+                        slot.op_number, certificate.batch_size,
+                        certificate.digest)) {
+                    certified = std::max(certified, end);
+                } else {
+                    conflict = true;
+                }
+            }
+        }
+    }
+    return certified;
+}
+
+// The last op of the batch of `batch_size` entries starting at `op_number` if
+// a certificate with `digest` is for the entries in the log, or 0. A
+// certificate's digest is the log hash at the end of its batch, which chains
+// everything before it.
+opnum_t PBFTReplica::CertifiedEnd(
+    opnum_t op_number, opnum_t batch_size, const string &digest //
+) {
+    opnum_t end = op_number + batch_size - 1;
+    if ( //
+        batch_size == 0 || op_number < log.FirstOpnum() ||
+        end > log.LastOpnum() || log.Find(end)->hash != digest) {
+        return 0;
+    }
+    return end;
+}
+
+// Entries from state transfer, or buffered ones, that a prepare certificate
+// was collected for before they were in the log. Other replicas may wait for
+// the Commit of this replica, so it is sent here as if the entries were
+// prepared the normal way.
+void PBFTReplica::PrepareCertified(opnum_t op_number) {
+    for (; op_number <= log.LastOpnum(); op_number += 1) {
+        const QuorumSlot *slot = FindSlot(prepare_quorum, op_number);
+        LogEntry *entry = log.Find(op_number);
+        if (slot == nullptr || entry->state != LOG_STATE_RECEIVED) {
+            continue;
+        }
+        for (size_t i = 0; i < slot->n_certificate; i += 1) {
+            const QuorumSlot::Certificate &certificate = slot->certificates[i];
+            if ( //
+                __builtin_popcountll(certificate.replicas) <
+                2 * configuration.f) {
+                continue;
+            }
+            if (CertifiedEnd(
+                    op_number, certificate.batch_size, certificate.digest)) {
+                RDebug("PREPARED: op number = %lu", op_number);
+                entry->state = LOG_STATE_PREPARED;
+                SendCommit(
+                    op_number, certificate.batch_size, certificate.digest);
+                break;
+            }
+        }
+    }
+}
+
+// Entries from state transfer skip Prepare, and may be backed by a commit
+// certificate of a later batch only, which commits all entries up to it. So
+// every certificate in the window is checked, see `CommitUpTo` for one that
+// is known already.
+void PBFTReplica::CommitCertified() {
+    opnum_t certified = commit_number;
+    for (const QuorumSlot &slot : commit_quorum) {
+        if (!InWindow(slot.op_number)) {
+            continue;
+        }
+        for (size_t i = 0; i < slot.n_certificate; i += 1) {
+            const QuorumSlot::Certificate &certificate = slot.certificates[i];
+            if ( //
+                __builtin_popcountll(certificate.replicas) <
+                2 * configuration.f) {
+                continue;
+            }
+            certified = std::max(
+                certified,
+                CertifiedEnd(
+                    slot.op_number, certificate.batch_size,
+                    certificate.digest));
+        }
+    }
+    CommitUpTo(certified);
+}
+
+// Commit entries up to `op_number`, the end of a certified batch. Batches
+// committed this way before this replica prepared them still get its Commit,
+// for the same reason as in `PrepareCertified`.
+void PBFTReplica::CommitUpTo(opnum_t op_number) {
+    for (opnum_t op = commit_number + 1; op <= op_number; op += 1) {
+        LogEntry *entry = log.Find(op);
+        bool sent = entry->state != LOG_STATE_RECEIVED;
+        entry->state = LOG_STATE_COMMITTED;
+        for (auto *quorum : {&prepare_quorum, &commit_quorum}) {
+            const QuorumSlot *slot = FindSlot(*quorum, op);
+            if (sent || slot == nullptr) {
+                continue;
+            }
+            for (size_t i = 0; i < slot->n_certificate; i += 1) {
+                const QuorumSlot::Certificate &certificate =
+                    slot->certificates[i];
+                if (CertifiedEnd(
+                        op, certificate.batch_size, certificate.digest)) {
+                    SendCommit(
+                        op, certificate.batch_size, certificate.digest);
+                    sent = true;
+                    break;
+                }
+            }
+        }
+    }
+}
+
+void PBFTReplica::StartStateTransfer(opnum_t target, int source) {
+    bool active = state_transfer.Active();
+    if (!state_transfer.Start(target, source)) {
+        return;
+    }
+    if (!active) {
+        RNotice(
+            "Start state transfer: op number = %lu .. %lu, source = %d",
+            log.LastOpnum() + 1, target, state_transfer.Source());
+        state_transfer_timeout->Start();
+    }
+    SendStateRequests(state_transfer.Next(log.LastOpnum()));
+}
+
+void PBFTReplica::SendStateRequests(
+    const vector<StateTransfer::Range> &ranges //
+) {
+    if (!state_transfer.Active()) {
+        RDebug("State transfer done: op number = %lu", log.LastOpnum());
+        state_transfer_timeout->Stop();
+        return;
+    }
+    for (const StateTransfer::Range &range : ranges) {
+        proto::PBFTMessage message;
+        auto &request = *message.mutable_state_request();
+        request.set_op_number(range.first);
+        request.set_last_op_number(range.last);
+        request.set_replica_id(replicaIdx);
         epilogue_list.push_back(
-            [this, reply, escaping_remote = remote.release()]() mutable {
-                auto remote = unique_ptr<TransportAddress>(escaping_remote);
-                transport->SendMessage(this, *remote, PBMessage(reply));
+            [this, message, source = state_transfer.Source()]() mutable {
+                PBMessage pb_layer(message);
+                SignedAdapter signed_layer(pb_layer, identifier);
+                transport->SendMessageToReplica(this, source, signed_layer);
             });
     }
-    runner.RunEpilogue([this, epilogue_list]() {
-        for (Runner::Epilogue epilogue : epilogue_list) {
-            epilogue();
+}
+
+// entries that are not committed yet are shipped as well, the receiver may
+// have missed the Preprepare of them, and they cannot commit without it
+void PBFTReplica::HandleStateRequest(
+    const TransportAddress &remote, const proto::StateRequest &request //
+) {
+    proto::PBFTMessage message;
+    auto &chunk = *message.mutable_state_chunk();
+    opnum_t op_number = request.op_number();
+    if (op_number < log.FirstOpnum()) {
+        if (!checkpoints.HasStableState()) {
+            return;
         }
-    });
+        auto &checkpoint = *chunk.mutable_checkpoint();
+        checkpoint.set_op_number(checkpoints.Stable());
+        checkpoint.set_digest(checkpoints.StableDigest());
+        checkpoint.set_log_hash(checkpoints.StableLogHash());
+        checkpoint.set_app_state(checkpoints.StableState());
+        for (const auto &signed_checkpoint : checkpoints.StableProof()) {
+            checkpoint.add_signed_checkpoint(signed_checkpoint.second);
+        }
+        op_number = checkpoints.Stable() + 1;
+    }
+    chunk.set_op_number(op_number);
+    chunk.set_view_number(view_number);
+    chunk.set_replica_id(replicaIdx);
+    for (; op_number <= std::min(request.last_op_number(), log.LastOpnum());
+         op_number += 1) {
+        *chunk.add_request() = log.Find(op_number)->request;
+    }
+    if (!chunk.has_checkpoint() && chunk.request_size() == 0) {
+        return;
+    }
+
+    RDebug(
+        "Send StateChunk: op number = %lu (+%d), checkpoint = %d",
+        chunk.op_number(), chunk.request_size(), int(chunk.has_checkpoint()));
+    epilogue_list.push_back(
+        [this, message, replica_id = request.replica_id()]() mutable {
+            PBMessage pb_layer(message);
+            SignedAdapter signed_layer(pb_layer, identifier);
+            transport->SendMessageToReplica(this, replica_id, signed_layer);
+        });
+}
+
+void PBFTReplica::HandleStateChunk(
+    const TransportAddress &remote, const proto::StateChunk &chunk,
+    std::map<int, string> proof //
+) {
+    RDebug(
+        "StateChunk: op number = %lu (+%d), checkpoint = %d",
+        chunk.op_number(), chunk.request_size(), int(chunk.has_checkpoint()));
+    if (chunk.has_checkpoint()) {
+        InstallCheckpoint(chunk.checkpoint(), move(proof));
+    }
+    if (chunk.op_number() + chunk.request_size() > log.LastOpnum() + 1) {
+        chunk_buffer[chunk.op_number()] = chunk;
+    }
+
+    opnum_t last_op_number = log.LastOpnum();
+    AppendBuffered();
+    PrepareCertified(last_op_number + 1);
+    CommitCertified();
+    ExecuteCommitted();
+    SendStateRequests(state_transfer.Next(log.LastOpnum()));
+}
+
+// the application state is replaced, so entries up to the checkpoint are
+// skipped even if some of them are in the log
+void PBFTReplica::InstallCheckpoint(
+    const proto::StableCheckpoint &checkpoint,
+    std::map<int, string> proof //
+) {
+    if (checkpoint.op_number() <= commit_number) {
+        return;
+    }
+    RNotice(
+        "Install checkpoint: op number = %lu, commit number = %lu",
+        checkpoint.op_number(), commit_number);
+    Restore(checkpoint.op_number(), checkpoint.app_state());
+    checkpoints.Install(
+        checkpoint.op_number(), checkpoint.digest(), move(proof),
+        checkpoint.app_state(), checkpoint.log_hash());
+    LogEntry *entry = log.Find(checkpoint.op_number());
+    if (entry != nullptr && entry->hash == checkpoint.log_hash()) {
+        log.RemoveBefore(checkpoint.op_number() + 1);
+    } else {
+        log.Reset(checkpoint.op_number() + 1, checkpoint.log_hash());
+    }
+    commit_number = checkpoint.op_number();
+    op_number = std::max(op_number, commit_number);
+    CollectGarbage();
 }
 
 } // namespace pbft
@@ -1,32 +1,65 @@
 #pragma once
+#include "common/batchcontroller.h"
+#include "common/checkpoint.h"
 #include "common/replica.h"
 #include "common/runner.h"
+#include "common/signedadapter.h"
+#include "common/statetransfer.h"
 #include "replication/pbft/message.pb.h"
 
+#include <deque>
+
 namespace dsnet {
 namespace pbft {
 
+// batches the primary keeps in flight by default, i.e. proposed but not
+// committed yet
+const int DEFAULT_PIPELINE_DEPTH = 8;
+
 class PBFTReplica : public Replica {
 public:
     PBFTReplica(
         const Configuration &config, int replica_id,
         const std::string &identifier, int n_worker, int batch_size,
-        Transport *transport, AppReplica *app);
+        Transport *transport, AppReplica *app,
+        const std::string &runner_name = "ctpl",
+        opnum_t checkpoint_interval = DEFAULT_CHECKPOINT_INTERVAL,
+        uint64_t target_latency_us = 0,
+        int pipeline_depth = DEFAULT_PIPELINE_DEPTH);
+    // run on the runner of caller, which outlives the replica
+    PBFTReplica(
+        const Configuration &config, int replica_id,
+        const std::string &identifier, Runner &runner, int batch_size,
+        Transport *transport, AppReplica *app,
+        opnum_t checkpoint_interval = DEFAULT_CHECKPOINT_INTERVAL,
+        uint64_t target_latency_us = 0,
+        int pipeline_depth = DEFAULT_PIPELINE_DEPTH);
     ~PBFTReplica();
 
     void ReceiveMessage(
         const TransportAddress &remote, void *buf, size_t len) override;
+    void ReceiveBuffer(
+        const TransportAddress &remote, TransportBuffer buffer) override;
 
 private:
+    PBFTReplica(
+        const Configuration &config, int replica_id,
+        const std::string &identifier, std::unique_ptr<Runner> owned_runner,
+        Runner *external_runner, int batch_size, Transport *transport,
+        AppReplica *app, opnum_t checkpoint_interval,
+        uint64_t target_latency_us, int pipeline_depth);
+
     // consts
     string identifier;
-    CTPLOrderedRunner runner;
-    uint64_t batch_size;
+    std::unique_ptr<Runner> owned_runner;
+    Runner &runner;
 
     // single states
     view_t view_number;
     opnum_t op_number, commit_number;
+    BatchController batch;
     std::unique_ptr<Timeout> close_batch_timeout;
+    std::unique_ptr<Timeout> state_transfer_timeout;
 
     // aggregated states
     struct ClientEntry {
@@ -37,36 +70,149 @@ private:
     };
     std::unordered_map<uint64_t, ClientEntry> client_table;
     Log log;
-    // op number -> digest -> replica id -> message
-    std::unordered_map<
-        opnum_t, //
-        std::unordered_map<std::string, std::unordered_map<int, std::string>>>
-        prepare_quorum, commit_quorum;
+
+    // PBFT watermarks: Prepares and Commits are only accepted for batches
+    // starting in (low_watermark, low_watermark + window], and the primary
+    // does not propose beyond it. The low watermark is the stable checkpoint,
+    // or the commit number if that is lower or checkpoints are disabled, see
+    // `CollectGarbage`, so the window bounds how far a replica runs ahead of
+    // the last proof of its state. A replica that falls a window behind
+    // catches up by state transfer once it learns a stable checkpoint beyond
+    // its window.
+    opnum_t low_watermark, window;
+    // quorum of one phase for the batch starting at `op_number`, grouped by
+    // digest, which is usually one. Slot of op number `op` is at `op %
+    // window` of the ring, and is reset when a later op takes it, so the
+    // certificates and their message buffers are reused rather than
+    // allocated per op
+    struct QuorumSlot {
+        struct Certificate {
+            std::string digest;
+            opnum_t batch_size;
+            uint64_t replicas; // bitmap of replica id
+            std::vector<std::string> messages; // by replica id
+        };
+        opnum_t op_number = 0;
+        // replicas that sent for any digest, one each
+        uint64_t replicas = 0;
+        // the first `n_certificate` are the ones of `op_number`
+        size_t n_certificate = 0;
+        std::vector<Certificate> certificates;
+
+        void Reset(opnum_t op_number) {
+            this->op_number = op_number;
+            replicas = 0;
+            n_certificate = 0;
+        }
+        // the certificate of `digest` and `batch_size` with the message of
+        // `replica_id` in it, or nullptr if the replica sent for another
+        // batch already
+        Certificate *Add(
+            const std::string &digest, opnum_t batch_size, int replica_id,
+            const char *message, size_t size, int n_replica);
+    };
+    std::vector<QuorumSlot> prepare_quorum, commit_quorum;
+    // ends of batches proposed by the primary and not committed yet
+    std::deque<opnum_t> proposed;
+    int pipeline_depth;
+
     std::map<opnum_t, Request> request_buffer;
+    // everything up to the stable checkpoint is garbage collected, see
+    // `CollectGarbage`
+    CheckpointTracker checkpoints;
+    StateTransfer state_transfer;
+    // received out of order, like `request_buffer`
+    std::map<opnum_t, proto::StateChunk> chunk_buffer;
 
-    std::vector<std::string> request_batch; // List[Signed[Request]]
+    // List[Signed[Request]], held as received until their batch is closed,
+    // which may be more than one batch while the pipeline is full
+    std::vector<TransportBuffer> request_batch;
 
     bool IsPrimary() const {
         return configuration.GetLeaderIndex(view_number) == replicaIdx;
     }
+    bool InWindow(opnum_t op_number) const {
+        return op_number > low_watermark &&
+               op_number <= low_watermark + window;
+    }
+    // a batch that the window can hold, the only ones a correct replica
+    // prepares or commits
+    bool FitsWindow(opnum_t batch_size) const {
+        return batch_size != 0 && batch_size <= window;
+    }
+    // a message of the replica `replica_id` is signed by its identity
+    bool SignedBy(const SignedAdapter &signed_layer, int replica_id) const {
+        return replica_id >= 0 && replica_id < configuration.n &&
+               signed_layer.Identifier() == configuration.identity(replica_id);
+    }
+    // the slot of `op_number` which must be in window, reset if it was taken
+    // by an earlier op
+    QuorumSlot &AcquireSlot(
+        std::vector<QuorumSlot> &quorum, opnum_t op_number);
+    // the slot of `op_number`, or nullptr if nothing is collected for it
+    const QuorumSlot *FindSlot(
+        const std::vector<QuorumSlot> &quorum, opnum_t op_number) const;
+
+    // sends of one solo, the runner only keeps the last epilogue
+    std::vector<Runner::Epilogue> epilogue_list;
+    void ConcludeEpilogue() {
+        runner.RunEpilogue([epilogue_list = std::move(this->epilogue_list)] {
+            for (const Runner::Epilogue &epilogue : epilogue_list) {
+                epilogue();
+            }
+        });
+        epilogue_list.clear();
+    }
 
     void HandleRequest(
         const TransportAddress &remote, const Request &request,
-        const std::string &signed_message);
+        const TransportBuffer &signed_message);
     void HandlePreprepare(
         const TransportAddress &remote, const proto::Prepare &prepare,
         const std::string &signed_prepare,
         const std::vector<Request> &requests);
     void HandlePrepare(
         const TransportAddress &remote, const proto::Prepare &prepare,
-        const std::string &signed_prepare);
+        const TransportBuffer &signed_prepare);
     void HandleCommit(
         const TransportAddress &remote, const proto::Commit &commit,
-        const std::string &signed_commit);
+        const TransportBuffer &signed_commit);
+
+    void HandleCheckpoint(
+        const TransportAddress &remote, const proto::Checkpoint &checkpoint,
+        const TransportBuffer &signed_checkpoint);
+    void HandleStateRequest(
+        const TransportAddress &remote, const proto::StateRequest &request);
+    // `proof` is the verified stable checkpoint proof, if chunk has one
+    void HandleStateChunk(
+        const TransportAddress &remote, const proto::StateChunk &chunk,
+        std::map<int, std::string> proof);
 
     void InsertPrepare(
-        const proto::Prepare &prepare, const std::string &signed_prepare);
-    void CloseBatch();
+        const proto::Prepare &prepare, const TransportBuffer &signed_prepare);
+    // close batches of pending requests as far as the pipeline and the
+    // window allow, including a last one that is not full if `flush`
+    void CloseBatch(bool flush);
+    void ProposeBatch(
+        opnum_t first_op, std::vector<TransportBuffer> requests);
+    void SendCheckpoint(opnum_t op_number);
+    void CollectGarbage();
+
+    void SendCommit(
+        opnum_t op_number, opnum_t batch_size, const std::string &digest);
+    void AppendBuffered();
+    opnum_t CertifiedLast(opnum_t from, bool &conflict);
+    opnum_t CertifiedEnd(
+        opnum_t op_number, opnum_t batch_size, const std::string &digest);
+    void PrepareCertified(opnum_t op_number);
+    void CommitCertified();
+    void CommitUpTo(opnum_t op_number);
+    void ExecuteCommitted();
+    void StartStateTransfer(opnum_t target, int source);
+    void SendStateRequests(const std::vector<StateTransfer::Range> &ranges);
+    void InstallCheckpoint(
+        const proto::StableCheckpoint &checkpoint,
+        std::map<int, std::string> proof);
 };
 
 } // namespace pbft
@@ -95,8 +95,8 @@ void SignedUnrepReplica::CloseBatch() {
             });
     }
     request_batch.clear();
-    runner.RunEpilogue([epilogue_list] {
-        for (Runner::Epilogue epilogue : epilogue_list) {
+    runner.RunEpilogue([epilogue_list = std::move(epilogue_list)] {
+        for (const Runner::Epilogue &epilogue : epilogue_list) {
             epilogue();
         }
     });
@@ -109,9 +109,11 @@ void SignedUnrepReplica::HandleUnloggedRequest(
 
 SignedUnrepReplica::SignedUnrepReplica(
     Configuration config, string identifier, int n_worker, int batch_size,
-    Transport *transport, AppReplica *app)
+    Transport *transport, AppReplica *app, const string &runner_name)
     : Replica(config, 0, 0, true, transport, app), log(false),
-      identifier(identifier), runner(n_worker), batch_size(batch_size) {
+      identifier(identifier),
+      owned_runner(CreateOrderedRunner(runner_name, n_worker)),
+      runner(*owned_runner), batch_size(batch_size), in_receive_batch(false) {
 
     this->status = STATUS_NORMAL;
     this->last_op = 0;
@@ -127,7 +129,7 @@ SignedUnrepReplica::~SignedUnrepReplica() {
 
 void SignedUnrepReplica::ReceiveMessage(
     const TransportAddress &remote, void *buf, size_t size) {
-    runner.RunPrologue(
+    Runner::Prologue prologue =
         [ //
             this, leaked_remote = remote.clone(),
             owned_buffer = string((const char *)buf, size) //
@@ -155,7 +157,27 @@ void SignedUnrepReplica::ReceiveMessage(
                     replica_msg.msg_case());
                 return nullptr;
             }
-        });
+        };
+    if (in_receive_batch) {
+        receive_batch.push_back(std::move(prologue));
+    } else {
+        // every message is a client request, which the client retries
+        runner.RunSheddablePrologue(
+            std::move(prologue), [] { Debug("Shed client request"); });
+    }
+}
+
+void SignedUnrepReplica::ReceiveBatchBegin() { in_receive_batch = true; }
+
+void SignedUnrepReplica::ReceiveBatchEnd() {
+    in_receive_batch = false;
+    receive_shed.resize(receive_batch.size());
+    for (Runner::Epilogue &on_shed : receive_shed) {
+        on_shed = [] { Debug("Shed client request"); };
+    }
+    runner.RunSheddablePrologueBatch(
+        receive_batch.data(), receive_shed.data(), receive_batch.size());
+    receive_batch.clear();
 }
 
 void SignedUnrepReplica::UpdateClientTable(
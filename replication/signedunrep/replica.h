@@ -13,10 +13,13 @@ class SignedUnrepReplica : public Replica {
 public:
     SignedUnrepReplica(
         Configuration config, std::string identifier, int n_worker,
-        int batch_size, Transport *transport, AppReplica *app);
+        int batch_size, Transport *transport, AppReplica *app,
+        const std::string &runner_name = "spin");
     ~SignedUnrepReplica();
     void ReceiveMessage(
         const TransportAddress &remote, void *buf, size_t size) override;
+    void ReceiveBatchBegin() override;
+    void ReceiveBatchEnd() override;
 
 private:
     void HandleRequest(
@@ -38,9 +41,15 @@ private:
     std::map<uint64_t, ClientTableEntry> clientTable;
 
     const std::string identifier;
-    SpinOrderedRunner runner;
+    std::unique_ptr<Runner> owned_runner;
+    Runner &runner;
     size_t batch_size;
     std::vector<Request> request_batch;
+    // prologues of the current receive burst, submitted at its end
+    bool in_receive_batch;
+    std::vector<Runner::Prologue> receive_batch;
+    // `on_shed` of each of them, they are all client requests
+    std::vector<Runner::Epilogue> receive_shed;
 
     std::unique_ptr<Timeout> close_batch_timeout;
     void CloseBatch();
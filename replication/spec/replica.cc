@@ -76,7 +76,7 @@ SpecReplica::SpecReplica(Configuration config, int myIdx,
                          Transport *transport, AppReplica *app)
     : Replica(config, 0, myIdx, initialize, transport, app),
       log(true),
-      syncReplyQuorum(config.FastQuorumSize()-1),
+      syncReplyQuorum(config.FastQuorumSize()-1, config.n),
       startViewChangeQuorum(config.QuorumSize()-1),
       doViewChangeQuorum(config.QuorumSize()),
       inViewQuorum(config.QuorumSize()-1)
@@ -548,6 +548,13 @@ SpecReplica::HandleSyncReply(const TransportAddress &remote,
 
     ASSERT(msg.lastspeculative() <= lastSpeculative);
 
+    // replicas are trusted, and a sync may cover more speculative ops than
+    // the window, so the latest reply moves it
+    if (msg.lastspeculative() >= syncReplyQuorum.Window()) {
+        syncReplyQuorum.ClearBefore(
+            msg.lastspeculative() - syncReplyQuorum.Window() + 1);
+    }
+
     // Check if we have a quorum
     if (auto msgs =
         syncReplyQuorum.AddAndCheckForQuorum(msg.lastspeculative(),
@@ -566,10 +573,11 @@ SpecReplica::HandleSyncReply(const TransportAddress &remote,
         // We have a quorum of n-e responses. Now to find out if
         // there are n-e *matching* responses...
         std::multimap<string, int> hashes;
-        for (auto kv : *msgs) {
-            hashes.insert(std::pair<string,int>(
-                              kv.second.lastspeculativehash(),
-                              kv.first));
+        for (int i = 0; i < configuration.n; i++) {
+            if (msgs->Has(i)) {
+                hashes.insert(std::pair<string,int>(
+                                  msgs->Get(i).lastspeculativehash(), i));
+            }
         }
         // We need to include our hash too, it's not part of the
         // quorumset
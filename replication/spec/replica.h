@@ -85,7 +85,7 @@ private:
     std::list<std::pair<TransportAddress *,
                         proto::RequestMessage> > pendingRequests;
 
-    QuorumSet<opnum_t, proto::SyncReplyMessage> syncReplyQuorum;
+    QuorumWindow<proto::SyncReplyMessage> syncReplyQuorum;
     QuorumSet<view_t, proto::StartViewChangeMessage> startViewChangeQuorum;
     QuorumSet<view_t, proto::DoViewChangeMessage> doViewChangeQuorum;
     QuorumSet<view_t, proto::InViewMessage> inViewQuorum;
@@ -7,24 +7,14 @@ PROTOS += $(addprefix $(d), \
 	    message.proto)
 
 OBJS-tombft-client := $(o)client.o  $(o)adapter.o $(o)message.o \
-               $(o)halfsiphash.o \
+               $(LIB-halfsiphash) \
                $(OBJS-client) $(LIB-message) \
                $(LIB-configuration) $(LIB-pbmessage) $(LIB-signedadapter) $(LIB-latency)
 
 OBJS-tombft-replica := $(o)replica.o $(o)adapter.o $(o)message.o \
-               $(o)halfsiphash.o \
+               $(LIB-halfsiphash) \
                $(OBJS-replica) $(LIB-message) \
                $(LIB-configuration) $(LIB-pbmessage) $(LIB-signedadapter) \
                $(LIB-runner) $(LIB-latency) .obj/sequencer/sequencer.o  # hack for reusing BufferMessage
 
 $(o)client.o $(o)replica.o: $(o)message.o
-
-define compilec
-	@mkdir -p $(dir $@)
-	$(call trace,$(1),$<,\
-	  $(CC) -iquote. $(CFLAGS) $(CFLAGS-$<) $(2) $(DEPFLAGS) -E $<)
-	$(Q)$(CC) -iquote. $(CFLAGS) $(CFLAGS-$<) $(2) -c -o $@ $<
-endef
-
-$(o)halfsiphash.o: $(d)halfsiphash.c
-	$(call compilec,CC,)
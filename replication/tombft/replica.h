@@ -27,29 +27,14 @@ template <> struct LayoutToRunner<TOMBFTHMACAdapter> {
 template <typename BaseRunner> class TOMBFTRunner : public BaseRunner {
 public:
     TOMBFTRunner(int n_worker, int replica_id) : BaseRunner(n_worker) {
-        int &core_id = BaseRunner::core_id;
+        // every 4 replicas share a host, 5 cpus apart on placement
         if (replica_id / 4 == 0) {
             return;
         }
-        switch (replica_id / 4) {
-        case 1:
-            core_id = 5;
-            break;
-        case 2:
-            core_id = 10;
-            break;
-        case 3:
-            core_id = 32;
-            break;
-        case 4:
-            core_id = 37;
-            break;
-        case 5:
-            core_id = 42;
-            break;
-        default:
+        if (replica_id / 4 > 5) {
             Panic("Too many replicas");
         }
+        BaseRunner::cpu_index = replica_id / 4 * 5;
         BaseRunner::SetAffinity();
         for (int i = 0; i < BaseRunner::NWorker(); i += 1) {
             BaseRunner::SetAffinity(BaseRunner::GetWorker(i));
@@ -106,8 +91,8 @@ protected:
         if (epilogue_list.empty()) {
             return;
         }
-        GetRunner().RunEpilogue([runner_list = epilogue_list] {
-            for (Runner::Epilogue epilogue : runner_list) {
+        GetRunner().RunEpilogue([runner_list = std::move(epilogue_list)] {
+            for (const Runner::Epilogue &epilogue : runner_list) {
                 epilogue();
             }
         });
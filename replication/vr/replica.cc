@@ -54,11 +54,11 @@ using namespace proto;
 VRReplica::VRReplica(Configuration config, int myIdx,
                      bool initialize,
                      Transport *transport, int batchSize,
-                     AppReplica *app)
+                     AppReplica *app, uint64_t targetLatencyUs)
     : Replica(config, 0, myIdx, initialize, transport, app),
-      batchSize(batchSize),
+      batch(batchSize, targetLatencyUs),
       log(false),
-      prepareOKQuorum(config.QuorumSize()-1),
+      prepareOKQuorum(config.QuorumSize()-1, config.n),
       startViewChangeQuorum(config.QuorumSize()-1),
       doViewChangeQuorum(config.QuorumSize()-1),
       recoveryResponseQuorum(config.QuorumSize())
@@ -72,7 +72,10 @@ VRReplica::VRReplica(Configuration config, int myIdx,
     lastBatchEnd = 0;
     batchComplete = true;
 
-    if (batchSize > 1) {
+    if (batch.Adaptive()) {
+        Notice("Adaptive batching enabled; batch size up to %zu, "
+               "target latency %lu us", batch.MaxSize(), targetLatencyUs);
+    } else if (batchSize > 1) {
         Notice("Batching enabled; batch size %d", batchSize);
     }
 
@@ -119,6 +122,7 @@ VRReplica::~VRReplica()
 {
     Latency_Dump(&requestLatency);
     Latency_Dump(&executeAndReplyLatency);
+    batch.Dump();
 
     delete viewChangeTimeout;
     delete nullCommitTimeout;
@@ -198,6 +202,8 @@ VRReplica::CommitUpTo(opnum_t upto)
 
         Latency_End(&executeAndReplyLatency);
     }
+    batch.Commit(lastCommitted);
+    prepareOKQuorum.ClearBefore(lastCommitted + 1);
 }
 
 void
@@ -400,6 +406,7 @@ VRReplica::CloseBatch()
     if (!(transport->SendMessageToAll(this, PBMessage(lastPrepare)))) {
         RWarning("Failed to send prepare message to all replicas");
     }
+    batch.Close(lastOp, lastOp - lastBatchEnd);
     lastBatchEnd = lastOp;
     batchComplete = false;
 
@@ -557,7 +564,7 @@ VRReplica::HandleRequest(const TransportAddress &remote,
         log.Append(new LogEntry(v, LOG_STATE_PREPARED, request));
 
         if (batchComplete ||
-            (lastOp - lastBatchEnd+1 > (unsigned int)batchSize)) {
+            (lastOp - lastBatchEnd+1 > batch.Size())) {
             CloseBatch();
         } else {
             RDebug("Keeping in batch");
@@ -703,9 +710,13 @@ VRReplica::HandlePrepareOK(const TransportAddress &remote,
         return;
     }
 
-    viewstamp_t vs = { msg.view(), msg.opnum() };
-    if (auto msgs =
-        (prepareOKQuorum.AddAndCheckForQuorum(vs, msg.replicaidx(), msg))) {
+    // replicas are trusted, so a PrepareOK ahead of the window moves it
+    if (msg.opnum() >= prepareOKQuorum.Window()) {
+        prepareOKQuorum.ClearBefore(
+            msg.opnum() - prepareOKQuorum.Window() + 1);
+    }
+    if (auto msgs = (prepareOKQuorum.AddAndCheckForQuorum(
+                         msg.opnum(), msg.replicaidx(), msg))) {
         /*
          * We have a quorum of PrepareOK messages for this
          * opnumber. Execute it and all previous operations.
@@ -717,7 +728,7 @@ VRReplica::HandlePrepareOK(const TransportAddress &remote,
          */
         CommitUpTo(msg.opnum());
 
-        if (msgs->size() >= (unsigned int)configuration.QuorumSize()) {
+        if (msgs->Count() >= configuration.QuorumSize()) {
             return;
         }
 
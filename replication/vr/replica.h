@@ -33,6 +33,7 @@
 
 #include "lib/configuration.h"
 #include "lib/latency.h"
+#include "common/batchcontroller.h"
 #include "common/log.h"
 #include "common/replica.h"
 #include "common/quorumset.h"
@@ -50,7 +51,7 @@ class VRReplica : public Replica
 public:
     VRReplica(Configuration config, int myIdx, bool initialize,
               Transport *transport, int batchSize,
-              AppReplica *app);
+              AppReplica *app, uint64_t targetLatencyUs = 0);
     ~VRReplica();
 
     void ReceiveMessage(const TransportAddress &remote,
@@ -66,7 +67,7 @@ private:
     std::list<std::pair<TransportAddress *,
                         proto::PrepareMessage> > pendingPrepares;
     proto::ToReplicaMessage lastPrepare;
-    int batchSize;
+    BatchController batch;
     opnum_t lastBatchEnd;
     bool batchComplete;
 
@@ -80,7 +81,8 @@ private:
     };
     std::map<uint64_t, ClientTableEntry> clientTable;
 
-    QuorumSet<viewstamp_t, proto::PrepareOKMessage> prepareOKQuorum;
+    // by op number, PrepareOKs of other views are ignored
+    QuorumWindow<proto::PrepareOKMessage> prepareOKQuorum;
     QuorumSet<view_t, proto::StartViewChangeMessage> startViewChangeQuorum;
     QuorumSet<view_t, proto::DoViewChangeMessage> doViewChangeQuorum;
     QuorumSet<uint64_t, proto::RecoveryResponseMessage> recoveryResponseQuorum;
@@ -6,10 +6,18 @@ d := $(dir $(lastword $(MAKEFILE_LIST)))
 # sgdxbc: where is workertasks-test.cc?
 GTEST_SRCS += $(addprefix $(d), \
 			  configuration-test.cc \
+			  cpuplacement-test.cc \
 			  simtransport-test.cc \
+			  iouringtransport-test.cc \
 			  taskqueue-test.cc \
 			  signedadapter-test.cc \
-			  runner-test.cc)
+			  runner-test.cc \
+			  timerwheel-test.cc \
+			  reassembler-test.cc \
+			  checkpoint-test.cc \
+			  multisig-test.cc \
+			  batchcontroller-test.cc \
+			  quorumset-test.cc)
 
 PROTOS += $(d)simtransport-testmessage.proto
 
@@ -17,18 +25,50 @@ $(d)configuration-test: $(o)configuration-test.o $(LIB-configuration) $(GTEST_MA
 
 TEST_BINS += $(d)configuration-test
 
+$(d)cpuplacement-test: $(o)cpuplacement-test.o $(LIB-cpuplacement) $(GTEST_MAIN)
+
+TEST_BINS += $(d)cpuplacement-test
+
 $(d)simtransport-test: $(o)simtransport-test.o $(LIB-simtransport) $(LIB-pbmessage) $(o)simtransport-testmessage.o $(GTEST_MAIN)
 
 TEST_BINS += $(d)simtransport-test
 
+$(d)iouringtransport-test: $(o)iouringtransport-test.o $(LIB-udptransport) $(LIB-iouringtransport) $(LIB-pbmessage) $(o)simtransport-testmessage.o $(GTEST_MAIN)
+
+TEST_BINS += $(d)iouringtransport-test
+
 $(d)taskqueue-test: $(o)taskqueue-test.o $(LIB-taskqueue) $(GTEST_MAIN)
 
 TEST_BINS += $(d)taskqueue-test
 
-$(d)signedadapter-test: $(o)signedadapter-test.o $(LIB-signedadapter) $(GTEST_MAIN)
+$(d)signedadapter-test: $(o)signedadapter-test.o $(LIB-signedadapter) $(LIB-pbmessage) $(o)simtransport-testmessage.o $(GTEST_MAIN)
 
 TEST_BINS += $(d)signedadapter-test
 
 $(d)runner-test: $(o)runner-test.o $(LIB-runner) $(GTEST_MAIN)
 
 TEST_BINS += $(d)runner-test
+
+$(d)timerwheel-test: $(o)timerwheel-test.o $(LIB-timerwheel) $(GTEST_MAIN)
+
+TEST_BINS += $(d)timerwheel-test
+
+$(d)reassembler-test: $(o)reassembler-test.o $(LIB-reassembler) $(GTEST_MAIN)
+
+TEST_BINS += $(d)reassembler-test
+
+$(d)checkpoint-test: $(o)checkpoint-test.o $(LIB-log) $(GTEST_MAIN)
+
+TEST_BINS += $(d)checkpoint-test
+
+$(d)multisig-test: $(o)multisig-test.o $(LIB-multisig) $(GTEST_MAIN)
+
+TEST_BINS += $(d)multisig-test
+
+$(d)batchcontroller-test: $(o)batchcontroller-test.o $(LIB-message) $(GTEST_MAIN)
+
+TEST_BINS += $(d)batchcontroller-test
+
+$(d)quorumset-test: $(o)quorumset-test.o $(LIB-message) $(GTEST_MAIN)
+
+TEST_BINS += $(d)quorumset-test
@@ -0,0 +1,78 @@
+#include "common/batchcontroller.h"
+#include <chrono>
+#include <gtest/gtest.h>
+#include <thread>
+
+using namespace dsnet;
+
+TEST(BatchController, Fixed) {
+    BatchController batch(16);
+    ASSERT_FALSE(batch.Adaptive());
+    ASSERT_EQ(batch.Size(), 16);
+    batch.Close(16, 16);
+    batch.Close(32, 16);
+    batch.Commit(32);
+    ASSERT_EQ(batch.Size(), 16);
+}
+
+TEST(BatchController, Grow) {
+    // long enough to never be missed
+    BatchController batch(4, 1000 * 1000);
+    ASSERT_TRUE(batch.Adaptive());
+    ASSERT_EQ(batch.Size(), 1);
+    // nothing else in flight, the pipeline is not saturated
+    batch.Close(1, 1);
+    batch.Commit(1);
+    ASSERT_EQ(batch.Size(), 1);
+
+    opnum_t op_number = 1;
+    for (int i = 0; i < 10; i += 1) {
+        size_t size = batch.Size();
+        batch.Close(op_number + size, size);
+        batch.Close(op_number + 2 * size, size);
+        op_number += 2 * size;
+        batch.Commit(op_number);
+    }
+    ASSERT_EQ(batch.Size(), 4);
+
+    // batches closed on timeout do not grow it either
+    BatchController idle(4, 1000 * 1000);
+    idle.Close(1, 1);
+    idle.Close(2, 1);
+    idle.Commit(2);
+    ASSERT_EQ(idle.Size(), 2);
+    idle.Close(3, 1);
+    idle.Close(4, 1);
+    idle.Commit(4);
+    ASSERT_EQ(idle.Size(), 2);
+
+    // saturated batches in flight at once grow it by one, not one each
+    BatchController pipelined(16, 1000 * 1000);
+    for (opnum_t op = 1; op <= 8; op += 1) {
+        pipelined.Close(op, 1);
+    }
+    pipelined.Commit(8);
+    ASSERT_EQ(pipelined.Size(), 2);
+}
+
+TEST(BatchController, Shrink) {
+    BatchController batch(64, 1000);
+    opnum_t op_number = 0;
+    size_t size;
+    for (int i = 0; i < 16; i += 1) {
+        size = batch.Size();
+        batch.Close(op_number + size, size);
+        batch.Close(op_number + 2 * size, size);
+        op_number += 2 * size;
+        batch.Commit(op_number);
+    }
+    size = batch.Size();
+    ASSERT_GT(size, 8);
+
+    batch.Close(op_number + size, size);
+    batch.Close(op_number + 2 * size, size);
+    std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    // both are slow, but the second one is closed before the first decrease
+    batch.Commit(op_number + 2 * size);
+    ASSERT_EQ(batch.Size(), size - (size + 3) / 4);
+}
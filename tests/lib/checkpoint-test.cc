@@ -0,0 +1,204 @@
+#include "common/checkpoint.h"
+#include "common/log.h"
+#include "common/statetransfer.h"
+#include <gtest/gtest.h>
+#include <string>
+
+using namespace dsnet;
+
+TEST(CheckpointTracker, Take) {
+    CheckpointTracker checkpoints(100, 3);
+    ASSERT_EQ(checkpoints.Take(99), 0);
+    ASSERT_EQ(checkpoints.Take(100), 100);
+    ASSERT_EQ(checkpoints.Take(150), 0);
+    // a batch may cross several intervals, only the latest is taken
+    ASSERT_EQ(checkpoints.Take(420), 400);
+    ASSERT_EQ(checkpoints.Take(420), 0);
+
+    CheckpointTracker disabled(0, 3);
+    ASSERT_FALSE(disabled.Enabled());
+    ASSERT_EQ(disabled.Take(1000), 0);
+}
+
+TEST(CheckpointTracker, Stable) {
+    CheckpointTracker checkpoints(100, 3);
+    ASSERT_FALSE(checkpoints.Add(100, "a", 0, "0@100"));
+    ASSERT_FALSE(checkpoints.Add(200, "b", 0, "0@200"));
+    // a conflicting digest does not count
+    ASSERT_FALSE(checkpoints.Add(100, "x", 1, "1@100"));
+    ASSERT_FALSE(checkpoints.Add(100, "a", 2, "2@100"));
+    ASSERT_FALSE(checkpoints.Add(100, "a", 2, "2@100"));
+    ASSERT_TRUE(checkpoints.Add(100, "a", 3, "3@100"));
+    ASSERT_EQ(checkpoints.Stable(), 100);
+    ASSERT_EQ(checkpoints.StableDigest(), "a");
+    ASSERT_EQ(checkpoints.StableProof().size(), 3);
+    ASSERT_EQ(checkpoints.StableProof().at(3), "3@100");
+
+    // late messages of stable checkpoint are dropped
+    ASSERT_FALSE(checkpoints.Add(100, "a", 1, "1@100"));
+    ASSERT_FALSE(checkpoints.Add(200, "b", 1, "1@200"));
+    ASSERT_TRUE(checkpoints.Add(200, "b", 2, "2@200"));
+    ASSERT_EQ(checkpoints.Stable(), 200);
+}
+
+TEST(CheckpointTracker, Bounds) {
+    CheckpointTracker checkpoints(100, 3);
+    // not a checkpoint op number
+    ASSERT_FALSE(checkpoints.Add(150, "a", 0, "0@150"));
+    ASSERT_FALSE(checkpoints.Add(150, "a", 1, "1@150"));
+    ASSERT_FALSE(checkpoints.Add(150, "a", 2, "2@150"));
+    ASSERT_EQ(checkpoints.Stable(), 0);
+
+    // a replica's second digest is ignored
+    ASSERT_FALSE(checkpoints.Add(100, "a", 0, "0@100"));
+    ASSERT_FALSE(checkpoints.Add(100, "b", 0, "0@100'"));
+    ASSERT_FALSE(checkpoints.Add(100, "b", 1, "1@100"));
+    ASSERT_FALSE(checkpoints.Add(100, "b", 2, "2@100"));
+    ASSERT_TRUE(checkpoints.Add(100, "b", 3, "3@100"));
+    ASSERT_EQ(checkpoints.StableProof().count(0), 0);
+
+    // far ahead, only the newest of each replica is kept, and a lagging
+    // replica still learns the newer stable checkpoint
+    opnum_t far = 100 + (CheckpointTracker::MAX_AHEAD + 1) * 100;
+    ASSERT_FALSE(checkpoints.Add(far, "c", 0, "0@far"));
+    ASSERT_FALSE(checkpoints.Add(far, "c", 1, "1@far"));
+    ASSERT_FALSE(checkpoints.Add(far + 100, "d", 1, "1@far+"));
+    ASSERT_FALSE(checkpoints.Add(far, "c", 1, "1@far"));
+    ASSERT_FALSE(checkpoints.Add(far, "c", 2, "2@far"));
+    ASSERT_FALSE(checkpoints.Add(far + 100, "d", 2, "2@far+"));
+    ASSERT_TRUE(checkpoints.Add(far + 100, "d", 3, "3@far+"));
+    ASSERT_EQ(checkpoints.Stable(), far + 100);
+
+    // ones that are no longer far ahead are collected per op again
+    ASSERT_FALSE(checkpoints.Add(far + 1000, "e", 0, "0@e"));
+    ASSERT_FALSE(checkpoints.Add(far + 1000, "e", 1, "1@e"));
+    checkpoints.Install(far + 900, "i", {}, std::string("state"));
+    ASSERT_TRUE(checkpoints.Add(far + 1000, "e", 2, "2@e"));
+    ASSERT_EQ(checkpoints.Stable(), far + 1000);
+}
+
+TEST(CheckpointTracker, State) {
+    CheckpointTracker checkpoints(100, 2);
+    ASSERT_EQ(checkpoints.Take(100), 100);
+    checkpoints.SetState(100, "state@100", "hash@100");
+    ASSERT_FALSE(checkpoints.Add(100, "a", 0, "0@100"));
+    ASSERT_TRUE(checkpoints.Add(100, "a", 1, "1@100"));
+    ASSERT_TRUE(checkpoints.HasStableState());
+    ASSERT_EQ(checkpoints.StableState(), "state@100");
+    ASSERT_EQ(checkpoints.StableLogHash(), "hash@100");
+
+    // stable without being taken locally
+    ASSERT_FALSE(checkpoints.Add(200, "b", 0, "0@200"));
+    ASSERT_TRUE(checkpoints.Add(200, "b", 1, "1@200"));
+    ASSERT_FALSE(checkpoints.HasStableState());
+
+    checkpoints.Install(
+        400, "d", {{0, "0@400"}, {1, "1@400"}}, std::string("state@400"));
+    ASSERT_EQ(checkpoints.Stable(), 400);
+    ASSERT_EQ(checkpoints.StableState(), "state@400");
+    // already covered by the installed checkpoint
+    ASSERT_EQ(checkpoints.Take(420), 0);
+    ASSERT_EQ(checkpoints.Take(500), 500);
+}
+
+TEST(CheckpointTracker, Digest) {
+    std::string digest = CheckpointDigest("state", "hash");
+    ASSERT_EQ(digest.size(), 32);
+    ASSERT_EQ(CheckpointDigest("state", "hash"), digest);
+    ASSERT_NE(CheckpointDigest("state'", "hash"), digest);
+    ASSERT_NE(CheckpointDigest("state", "hash'"), digest);
+    ASSERT_NE(CheckpointDigest("state"), digest);
+}
+
+TEST(Log, RemoveBefore) {
+    Log log(true);
+    for (opnum_t op = 1; op <= 10; op += 1) {
+        Request request;
+        request.set_clientid(1);
+        request.set_clientreqid(op);
+        log.Append(
+            new LogEntry(viewstamp_t(0, op), LOG_STATE_COMMITTED, request));
+    }
+    std::string hash10 = log.LastHash();
+
+    log.RemoveBefore(6);
+    ASSERT_EQ(log.FirstOpnum(), 6);
+    ASSERT_EQ(log.LastOpnum(), 10);
+    ASSERT_EQ(log.Find(5), nullptr);
+    ASSERT_EQ(log.Find(6)->viewstamp.opnum, 6);
+
+    // the hash chain continues across the removed entries
+    log.RemoveBefore(11);
+    ASSERT_TRUE(log.Empty());
+    ASSERT_EQ(log.LastOpnum(), 10);
+    ASSERT_EQ(log.LastHash(), hash10);
+    Request request;
+    request.set_clientid(1);
+    request.set_clientreqid(11);
+    LogEntry &entry = log.Append(
+        new LogEntry(viewstamp_t(0, 11), LOG_STATE_COMMITTED, request));
+    ASSERT_EQ(entry.hash, Log::ComputeHash(hash10, &entry));
+}
+
+TEST(Log, Reset) {
+    Log log(true);
+    log.Reset(101, "hash100");
+    ASSERT_TRUE(log.Empty());
+    ASSERT_EQ(log.LastOpnum(), 100);
+    Request request;
+    request.set_clientid(1);
+    request.set_clientreqid(1);
+    LogEntry &entry = log.Append(
+        new LogEntry(viewstamp_t(0, 101), LOG_STATE_COMMITTED, request));
+    ASSERT_EQ(entry.hash, Log::ComputeHash("hash100", &entry));
+    ASSERT_EQ(log.FirstOpnum(), 101);
+}
+
+TEST(StateTransfer, Window) {
+    StateTransfer transfer(4, 1);
+    ASSERT_FALSE(transfer.Active());
+    ASSERT_TRUE(transfer.Start(1000, 0));
+    ASSERT_EQ(transfer.Source(), 0);
+    opnum_t window = StateTransfer::WINDOW;
+    opnum_t chunk = StateTransfer::CHUNK_SIZE;
+    auto ranges = transfer.Next(10);
+    ASSERT_EQ(ranges.size(), window);
+    ASSERT_EQ(ranges.front().first, 11);
+    ASSERT_EQ(ranges.front().last, 10 + chunk);
+    ASSERT_EQ(ranges.back().last, 10 + window * chunk);
+    // window is full until something is applied
+    ASSERT_TRUE(transfer.Next(10).empty());
+    ranges = transfer.Next(10 + chunk);
+    ASSERT_EQ(ranges.size(), 1);
+
+    // a farther target extends the ongoing transfer
+    ASSERT_FALSE(transfer.Start(500, 2));
+    ASSERT_TRUE(transfer.Start(2000, 2));
+    ASSERT_EQ(transfer.Source(), 0);
+    ASSERT_EQ(transfer.Target(), 2000);
+
+    ASSERT_TRUE(transfer.Next(2000).empty());
+    ASSERT_FALSE(transfer.Active());
+}
+
+TEST(StateTransfer, Retry) {
+    StateTransfer transfer(4, 1);
+    // never fetch from self
+    ASSERT_TRUE(transfer.Start(100, 1));
+    ASSERT_EQ(transfer.Source(), 2);
+    ASSERT_EQ(transfer.Next(0).size(), 2);
+
+    // progress since last call
+    ASSERT_TRUE(transfer.Retry(0).empty());
+    ASSERT_TRUE(transfer.Retry(50).empty());
+    // stalled, fetch the rest from the next replica
+    auto ranges = transfer.Retry(50);
+    ASSERT_EQ(transfer.Source(), 3);
+    ASSERT_EQ(ranges.size(), 1);
+    ASSERT_EQ(ranges[0].first, 51);
+    ASSERT_EQ(ranges[0].last, 100);
+    transfer.Retry(50);
+    ASSERT_EQ(transfer.Source(), 0);
+    transfer.Retry(50);
+    ASSERT_EQ(transfer.Source(), 2);
+}
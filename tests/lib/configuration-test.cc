@@ -149,6 +149,8 @@ TEST(Configuration, FromFile)
     EXPECT_EQ(c.replica(0, 1).port, "12346");
     EXPECT_EQ(c.replica(0, 2).port, "12347");
     EXPECT_EQ(c.multicast()->port, "12348");
+    EXPECT_EQ(c.identity(0), "Steve");
+    EXPECT_EQ(c.identity(1), "r1");
 }
 
 TEST(Configuration, AddressEquality)
@@ -0,0 +1,27 @@
+#include "lib/cpuplacement.h"
+#include <gtest/gtest.h>
+
+using namespace dsnet;
+using std::vector;
+
+TEST(CPUPlacement, ParseCPUList) {
+    ASSERT_EQ(CPUPlacement::ParseCPUList("0"), vector<int>({0}));
+    ASSERT_EQ(
+        CPUPlacement::ParseCPUList("0-2,5,7-8"), vector<int>({0, 1, 2, 5, 7, 8}));
+    ASSERT_TRUE(CPUPlacement::ParseCPUList("").empty());
+}
+
+TEST(CPUPlacement, Spec) {
+    CPUPlacement all;
+    ASSERT_FALSE(all.CPUs().empty());
+    int first = all.CPUs()[0];
+
+    // everything is restricted to online cpus
+    CPUPlacement one(std::to_string(first) + "+node0+nosmt");
+    ASSERT_EQ(one.CPUs(), vector<int>({first}));
+    // wrap around
+    ASSERT_EQ(one.CPU(3), first);
+
+    CPUPlacement nosmt("nosmt");
+    ASSERT_EQ(nosmt.CPUs().size(), all.CPUs().size());
+}
@@ -0,0 +1,117 @@
+#include "common/multisig.h"
+#include <gtest/gtest.h>
+#include <memory>
+#include <string>
+#include <vector>
+
+using namespace dsnet;
+using namespace std;
+
+static unique_ptr<MultiSigGroup> TestGroup(int n_signer) {
+    vector<string> public_keys;
+    for (int i = 0; i < n_signer; i += 1) {
+        public_keys.push_back(
+            MultiSigGroup::PublicKey(MultiSigGroup::TestSecret(i)));
+    }
+    return unique_ptr<MultiSigGroup>(new MultiSigGroup(public_keys));
+}
+
+// every signer of the set commits seq and signs
+static string Sign(
+    const MultiSigGroup &group, vector<unique_ptr<MultiSigner>> &signers,
+    uint64_t set, uint64_t seq, const string &message) {
+    vector<string> nonces;
+    for (int i = 0; i < group.NSigner(); i += 1) {
+        if (set >> i & 1) {
+            nonces.push_back(signers[i]->Commit(seq));
+        }
+    }
+    string aggregate_nonce = MultiSigGroup::AggregateNonce(nonces);
+    vector<string> partials;
+    for (int i = 0; i < group.NSigner(); i += 1) {
+        if (set >> i & 1) {
+            string partial;
+            EXPECT_TRUE(signers[i]->Sign(
+                seq, set, aggregate_nonce, message, partial));
+            partials.push_back(partial);
+        }
+    }
+    return group.Aggregate(set, aggregate_nonce, message, partials);
+}
+
+TEST(MultiSig, Verify) {
+    unique_ptr<MultiSigGroup> group_ptr = TestGroup(7);
+    const MultiSigGroup &group = *group_ptr;
+    vector<unique_ptr<MultiSigner>> signers;
+    for (int i = 0; i < 7; i += 1) {
+        signers.emplace_back(
+            new MultiSigner(group, i, MultiSigGroup::TestSecret(i)));
+    }
+
+    uint64_t set = 0b1011011;
+    string signature = Sign(group, signers, set, 1, "block 1");
+    ASSERT_EQ(signature.size(), MultiSigGroup::SIGNATURE_SIZE);
+    ASSERT_TRUE(group.Verify(set, "block 1", signature));
+    ASSERT_FALSE(group.Verify(set, "block 2", signature));
+    // claimed by a different set of signers
+    ASSERT_FALSE(group.Verify(0b1011010, "block 1", signature));
+    ASSERT_FALSE(group.Verify(0b1011111, "block 1", signature));
+    ASSERT_FALSE(group.Verify(1ull << 7 | set, "block 1", signature));
+
+    string forged = signature;
+    forged.back() ^= 1;
+    ASSERT_FALSE(group.Verify(set, "block 1", forged));
+
+    // a set of one and of everyone
+    ASSERT_TRUE(group.Verify(0b100, "m", Sign(group, signers, 0b100, 2, "m")));
+    ASSERT_TRUE(group.Verify(
+        0b1111111, "m", Sign(group, signers, 0b1111111, 3, "m")));
+}
+
+TEST(MultiSig, Nonce) {
+    unique_ptr<MultiSigGroup> group_ptr = TestGroup(4);
+    const MultiSigGroup &group = *group_ptr;
+    MultiSigner signer(group, 0, MultiSigGroup::TestSecret(0)),
+        other(group, 1, MultiSigGroup::TestSecret(1));
+    string nonce1 = signer.Commit(1), nonce2 = signer.Commit(2);
+    signer.Commit(3);
+    ASSERT_EQ(nonce1.size(), MultiSigGroup::NONCE_SIZE);
+    string aggregate_nonce =
+        MultiSigGroup::AggregateNonce({nonce2, other.Commit(2)});
+    string partial;
+    ASSERT_TRUE(signer.Sign(2, 0b11, aggregate_nonce, "m", partial));
+    // never sign twice with one nonce
+    ASSERT_FALSE(signer.Sign(2, 0b11, aggregate_nonce, "m2", partial));
+    ASSERT_FALSE(signer.Sign(4, 0b11, aggregate_nonce, "m", partial));
+    ASSERT_TRUE(signer.Sign(3, 0b11, aggregate_nonce, "m", partial));
+    signer.Forget(3);
+    ASSERT_FALSE(signer.Sign(1, 0b11, aggregate_nonce, "m", partial));
+
+    // missing partial of a signer
+    ASSERT_EQ(group.Aggregate(0b11, aggregate_nonce, "m", {partial}), "");
+    ASSERT_EQ(MultiSigGroup::AggregateNonce({nonce1.substr(1)}), "");
+}
+
+TEST(MultiSig, Keys) {
+    string secret(32, '\x5a');
+    string public_key = MultiSigGroup::PublicKey(secret);
+    ASSERT_EQ(public_key.size(), 33);
+    ASSERT_EQ(MultiSigGroup::PublicKey(string(32, '\0')), "");
+    ASSERT_EQ(MultiSigGroup::PublicKey(string(32, '\xff')), "");
+    ASSERT_EQ(MultiSigGroup::PublicKey("short"), "");
+
+    // a group of configured keys rather than test ones
+    MultiSigGroup group({public_key, MultiSigGroup::PublicKey(
+                                         MultiSigGroup::TestSecret(1))});
+    MultiSigner signer(group, 0, secret),
+        test_signer(group, 1, MultiSigGroup::TestSecret(1));
+    string nonce = signer.Commit(1), test_nonce = test_signer.Commit(1);
+    string aggregate_nonce =
+        MultiSigGroup::AggregateNonce({nonce, test_nonce});
+    string partial, test_partial;
+    ASSERT_TRUE(signer.Sign(1, 0b11, aggregate_nonce, "m", partial));
+    ASSERT_TRUE(test_signer.Sign(1, 0b11, aggregate_nonce, "m", test_partial));
+    ASSERT_TRUE(group.Verify(
+        0b11, "m",
+        group.Aggregate(0b11, aggregate_nonce, "m", {partial, test_partial})));
+}
@@ -0,0 +1,60 @@
+#include "common/quorumset.h"
+#include <gtest/gtest.h>
+#include <string>
+
+using namespace dsnet;
+
+TEST(QuorumWindow, Quorum) {
+    QuorumWindow<std::string> quorum(2, 4);
+    ASSERT_EQ(quorum.AddAndCheckForQuorum(1, 1, "a"), nullptr);
+    // a duplicate replaces the message, and counts once
+    ASSERT_EQ(quorum.AddAndCheckForQuorum(1, 1, "b"), nullptr);
+    ASSERT_EQ(quorum.AddAndCheckForQuorum(2, 2, "c"), nullptr);
+    auto slot = quorum.AddAndCheckForQuorum(1, 3, "d");
+    ASSERT_NE(slot, nullptr);
+    ASSERT_EQ(slot->Count(), 2);
+    ASSERT_TRUE(slot->Has(1));
+    ASSERT_FALSE(slot->Has(2));
+    ASSERT_EQ(slot->Get(1), "b");
+    ASSERT_EQ(slot->Get(3), "d");
+    ASSERT_EQ(quorum.CheckForQuorum(1), slot);
+    ASSERT_EQ(quorum.CheckForQuorum(2), nullptr);
+    // out of range replica
+    ASSERT_EQ(quorum.AddAndCheckForQuorum(2, 4, "e"), nullptr);
+    ASSERT_EQ(quorum.AddAndCheckForQuorum(2, 0, "e")->Count(), 2);
+
+    quorum.Clear(1);
+    ASSERT_EQ(quorum.CheckForQuorum(1), nullptr);
+    quorum.Clear();
+    ASSERT_EQ(quorum.CheckForQuorum(2), nullptr);
+    ASSERT_EQ(quorum.AddAndCheckForQuorum(2, 1, "f"), nullptr);
+    ASSERT_EQ(quorum.AddAndCheckForQuorum(2, 2, "g")->Get(2), "g");
+}
+
+TEST(QuorumWindow, Slide) {
+    QuorumWindow<std::string> quorum(2, 4, 8);
+    quorum.Add(3, 0, "a");
+    quorum.Add(5, 0, "a");
+    quorum.ClearBefore(5);
+    // pruned ones are dropped for good
+    ASSERT_EQ(quorum.AddAndCheckForQuorum(3, 1, "b"), nullptr);
+    ASSERT_NE(quorum.AddAndCheckForQuorum(5, 1, "b"), nullptr);
+
+    quorum.Add(12, 0, "a");
+    ASSERT_NE(quorum.CheckForQuorum(5), nullptr);
+    // an id beyond the window is rejected instead of moving it
+    ASSERT_EQ(quorum.AddAndCheckForQuorum(13, 0, "a"), nullptr);
+    ASSERT_EQ(quorum.AddAndCheckForQuorum(1000, 0, "a"), nullptr);
+    ASSERT_NE(quorum.CheckForQuorum(5), nullptr);
+    ASSERT_NE(quorum.AddAndCheckForQuorum(12, 1, "b"), nullptr);
+
+    // 13 takes the slot of 5 once the window moves past it
+    quorum.ClearBefore(6);
+    ASSERT_EQ(quorum.CheckForQuorum(5), nullptr);
+    ASSERT_EQ(quorum.AddAndCheckForQuorum(5, 2, "c"), nullptr);
+    quorum.Add(13, 0, "a");
+    // the slot is reused without the messages of 5
+    auto slot = quorum.AddAndCheckForQuorum(13, 2, "c");
+    ASSERT_NE(slot, nullptr);
+    ASSERT_FALSE(slot->Has(1));
+}
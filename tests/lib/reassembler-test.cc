@@ -0,0 +1,142 @@
+#include "lib/reassembler.h"
+#include <algorithm>
+#include <gtest/gtest.h>
+#include <string>
+#include <vector>
+
+using namespace dsnet;
+
+static std::string Message(size_t len, char seed) {
+    std::string message(len, 0);
+    for (size_t i = 0; i < len; i += 1) {
+        message[i] = seed + i % 31;
+    }
+    return message;
+}
+
+// fragment offsets of a message, in sending order
+static std::vector<size_t> Fragments(size_t len, size_t frag_size) {
+    std::vector<size_t> starts;
+    for (size_t start = 0; start < len; start += frag_size) {
+        starts.push_back(start);
+    }
+    return starts;
+}
+
+static const char *Insert(
+    FragmentReassembler &reassembler, uint64_t sender, uint64_t msg_id,
+    const std::string &message, size_t frag_size, size_t start,
+    uint64_t now = 0) {
+    size_t len = std::min(frag_size, message.size() - start);
+    return reassembler.Insert(
+        sender, msg_id, start, message.size(), &message[start], len, now);
+}
+
+TEST(FragmentReassembler, InOrder) {
+    FragmentReassembler reassembler(100);
+    std::string message = Message(1050, 'a');
+    auto starts = Fragments(message.size(), 100);
+    for (size_t i = 0; i < starts.size(); i += 1) {
+        const char *msg = Insert(reassembler, 1, 1, message, 100, starts[i]);
+        if (i + 1 < starts.size()) {
+            ASSERT_EQ(msg, nullptr);
+        } else {
+            ASSERT_EQ(std::string(msg, message.size()), message);
+        }
+    }
+    ASSERT_EQ(reassembler.NumCompleted(), 1u);
+}
+
+TEST(FragmentReassembler, OutOfOrderAndDuplicated) {
+    FragmentReassembler reassembler(100);
+    std::string message = Message(1000, 'a');
+    auto starts = Fragments(message.size(), 100);
+    std::reverse(starts.begin(), starts.end());
+    // every fragment but the last arrives twice
+    for (size_t i = 0; i + 1 < starts.size(); i += 1) {
+        ASSERT_EQ(Insert(reassembler, 1, 1, message, 100, starts[i]), nullptr);
+        ASSERT_EQ(Insert(reassembler, 1, 1, message, 100, starts[i]), nullptr);
+    }
+    const char *msg = Insert(reassembler, 1, 1, message, 100, starts.back());
+    ASSERT_EQ(std::string(msg, message.size()), message);
+}
+
+TEST(FragmentReassembler, Interleaved) {
+    FragmentReassembler reassembler(100);
+    // two messages from the same sender, and one from another sender with
+    // the same id
+    std::string m1 = Message(500, 'a'), m2 = Message(300, 'b'),
+                m3 = Message(500, 'c');
+    auto starts = Fragments(500, 100);
+    std::string result1, result2, result3;
+    for (size_t i = 0; i < starts.size(); i += 1) {
+        if (const char *msg = Insert(reassembler, 1, 1, m1, 100, starts[i])) {
+            result1.assign(msg, m1.size());
+        }
+        if (starts[i] < m2.size()) {
+            if (const char *msg =
+                    Insert(reassembler, 1, 2, m2, 100, starts[i])) {
+                result2.assign(msg, m2.size());
+            }
+        }
+        if (const char *msg = Insert(reassembler, 2, 1, m3, 100, starts[i])) {
+            result3.assign(msg, m3.size());
+        }
+    }
+    ASSERT_EQ(result1, m1);
+    ASSERT_EQ(result2, m2);
+    ASSERT_EQ(result3, m3);
+}
+
+TEST(FragmentReassembler, Bounded) {
+    FragmentReassembler reassembler(100, 2);
+    std::string message = Message(200, 'a');
+    // message 1 is stale, and gets reclaimed by message 3
+    ASSERT_EQ(Insert(reassembler, 1, 1, message, 100, 0, 0), nullptr);
+    ASSERT_EQ(Insert(reassembler, 1, 2, message, 100, 0, 10), nullptr);
+    ASSERT_EQ(Insert(reassembler, 1, 3, message, 100, 0, 20), nullptr);
+    ASSERT_EQ(reassembler.NumDropped(), 1u);
+    ASSERT_EQ(Insert(reassembler, 1, 1, message, 100, 100, 30), nullptr);
+    ASSERT_NE(Insert(reassembler, 1, 3, message, 100, 100, 30), nullptr);
+}
+
+TEST(FragmentReassembler, Invalid) {
+    FragmentReassembler reassembler(100, 16, 1000);
+    std::string message = Message(2000, 'a');
+    // too large
+    ASSERT_EQ(Insert(reassembler, 1, 1, message, 100, 0), nullptr);
+    // not aligned to fragment size
+    ASSERT_EQ(reassembler.Insert(1, 2, 50, 200, &message[0], 100, 0), nullptr);
+    // fragment too short
+    ASSERT_EQ(reassembler.Insert(1, 2, 0, 200, &message[0], 50, 0), nullptr);
+    // message length does not match the first fragment
+    ASSERT_EQ(reassembler.Insert(1, 2, 0, 200, &message[0], 100, 0), nullptr);
+    ASSERT_EQ(reassembler.Insert(1, 2, 100, 300, &message[0], 100, 0), nullptr);
+    ASSERT_EQ(reassembler.NumInvalid(), 4u);
+}
+
+TEST(FragmentReassembler, TimedOut) {
+    FragmentReassembler reassembler(100, 16, 1000, 100);
+    std::string message = Message(200, 'a');
+    ASSERT_EQ(Insert(reassembler, 1, 1, message, 100, 0, 0), nullptr);
+    // any later fragment drops the stale message, even with room to spare
+    ASSERT_EQ(Insert(reassembler, 2, 1, message, 100, 0, 100), nullptr);
+    ASSERT_EQ(reassembler.NumDropped(), 1u);
+    ASSERT_EQ(Insert(reassembler, 1, 1, message, 100, 100, 100), nullptr);
+    ASSERT_NE(Insert(reassembler, 2, 1, message, 100, 100, 100), nullptr);
+}
+
+TEST(FragmentReassembler, SenderShare) {
+    FragmentReassembler reassembler(100, 16, 500);
+    std::string large = Message(400, 'a'), small = Message(200, 'b');
+    ASSERT_EQ(Insert(reassembler, 1, 1, large, 100, 0, 0), nullptr);
+    ASSERT_EQ(Insert(reassembler, 2, 1, large, 100, 0, 10), nullptr);
+    // sender 1 is over its share, so its own message is reclaimed
+    ASSERT_EQ(Insert(reassembler, 1, 2, small, 100, 0, 20), nullptr);
+    ASSERT_EQ(reassembler.NumDropped(), 1u);
+    ASSERT_NE(Insert(reassembler, 1, 2, small, 100, 100, 30), nullptr);
+    for (size_t start : {100, 200, 300}) {
+        Insert(reassembler, 2, 1, large, 100, start, 30);
+    }
+    ASSERT_EQ(reassembler.NumCompleted(), 2u);
+}
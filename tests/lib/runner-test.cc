@@ -1,5 +1,7 @@
 #include "common/runner.h"
 #include <chrono>
+#include <thread>
+#include <vector>
 #include <gtest/gtest.h>
 
 TEST(Runner, Null) {
@@ -39,3 +41,385 @@ TEST(Runner, SoloOrder) {
         });
     }
 }
+
+TEST(Runner, ElasticSoloOrder) {
+    int last_solo = 0;
+    {
+        ElasticOrderedRunner runner(4);
+        for (int i = 0; i < 100; i += 1) {
+            runner.RunPrologue([i, &last_solo]() {
+                sleep_for(milliseconds(i % 3));
+                return [i, &last_solo]() {
+                    ASSERT_EQ(last_solo, i);
+                    last_solo += 1;
+                };
+            });
+        }
+        while (runner.GetStats().queued + runner.GetStats().in_flight != 0) {
+            sleep_for(milliseconds(1));
+        }
+    }
+    ASSERT_EQ(last_solo, 100);
+}
+
+static void ElasticShed(ElasticOrderedRunner::ShedPolicy policy) {
+    std::atomic<bool> blocked(true);
+    std::vector<int> shed, run;
+    std::mutex run_mutex;
+    ElasticOrderedRunner runner(1, 4, 2, policy);
+    // occupy the only worker so that the rest stay queued
+    runner.RunPrologue([&blocked]() {
+        while (blocked) {
+        }
+        return nullptr;
+    });
+    while (runner.GetStats().in_flight == 0) {
+    }
+    for (int i = 0; i < 8; i += 1) {
+        runner.RunSheddablePrologue(
+            [i, &run, &run_mutex]() {
+                std::lock_guard<std::mutex> lock(run_mutex);
+                run.push_back(i);
+                return nullptr;
+            },
+            [i, &shed] { shed.push_back(i); });
+    }
+    // never shed
+    runner.RunPrologue([]() { return nullptr; });
+
+    auto stats = runner.GetStats();
+    ASSERT_EQ(stats.queued, 5);
+    ASSERT_EQ(stats.shed, 4);
+    ASSERT_EQ(stats.overloaded, 1);
+    if (policy == ElasticOrderedRunner::ShedPolicy::DropOldest) {
+        ASSERT_EQ(shed, std::vector<int>({0, 1, 2, 3}));
+    } else {
+        ASSERT_EQ(shed, std::vector<int>({4, 5, 6, 7}));
+    }
+
+    blocked = false;
+    while (runner.GetStats().queued + runner.GetStats().in_flight != 0) {
+        sleep_for(milliseconds(1));
+    }
+    ASSERT_EQ(run.size(), 4);
+    // dropped ones were admitted before
+    ASSERT_EQ(
+        runner.GetStats().admitted,
+        policy == ElasticOrderedRunner::ShedPolicy::DropOldest ? 10 : 6);
+}
+
+TEST(Runner, ElasticDropOldest) {
+    ElasticShed(ElasticOrderedRunner::ShedPolicy::DropOldest);
+}
+
+TEST(Runner, ElasticRejectNew) {
+    ElasticShed(ElasticOrderedRunner::ShedPolicy::RejectNew);
+}
+
+TEST(Runner, WorkStealingDeque) {
+    WorkStealingDeque<int> deque(2);
+    for (int i = 0; i < 5; i += 1) {
+        deque.Push(i);
+    }
+    // thieves take from top, owner from bottom
+    int item;
+    ASSERT_TRUE(deque.Steal(item));
+    ASSERT_EQ(item, 0);
+    ASSERT_TRUE(deque.Pop(item));
+    ASSERT_EQ(item, 4);
+    ASSERT_TRUE(deque.Steal(item));
+    ASSERT_EQ(item, 1);
+    ASSERT_FALSE(deque.Empty());
+    ASSERT_TRUE(deque.Pop(item));
+    ASSERT_TRUE(deque.Pop(item));
+    ASSERT_EQ(item, 2);
+    ASSERT_TRUE(deque.Empty());
+    ASSERT_FALSE(deque.Pop(item));
+    ASSERT_FALSE(deque.Steal(item));
+}
+
+// more prologues than task slots, with some slow ones for the others to be
+// stolen around
+TEST(Runner, WorkStealingWrap) {
+    const int n_prologue = 5000;
+    std::atomic<int> n_solo(0);
+    int last_solo = 0;
+    WorkStealingRunner runner(3);
+    for (int i = 0; i < n_prologue; i += 1) {
+        runner.RunPrologue([i, &last_solo, &n_solo]() -> Runner::Solo {
+            if (i % 500 == 0) {
+                sleep_for(milliseconds(1));
+            }
+            if (i % 3 == 0) {
+                return nullptr;
+            }
+            return [i, &last_solo, &n_solo]() {
+                EXPECT_GT(i, last_solo);
+                last_solo = i;
+                n_solo += 1;
+            };
+        });
+    }
+    while (n_solo != n_prologue - (n_prologue + 2) / 3) {
+        sleep_for(milliseconds(1));
+    }
+}
+
+// same ordered workload on every ordered runner, with elapsed time reported
+// for a rough comparison
+TEST(Runner, OrderedRunners) {
+    const int n_prologue = 50;
+    for (std::string name : {"ctpl", "spin", "elastic", "worksteal"}) {
+        std::atomic<int> n_epilogue(0);
+        int last_solo = 0;
+        {
+            std::unique_ptr<Runner> runner = CreateOrderedRunner(name, 2);
+            for (int i = 0; i < n_prologue; i += 1) {
+                runner->RunPrologue([i, &last_solo, &n_epilogue, &runner]() {
+                    volatile int work = 0;
+                    for (int j = 0; j < (i % 7) * 100; j += 1) {
+                        work += j;
+                    }
+                    return [i, &last_solo, &n_epilogue, &runner]() {
+                        EXPECT_EQ(last_solo, i);
+                        last_solo += 1;
+                        runner->RunEpilogue([&n_epilogue] { n_epilogue += 1; });
+                    };
+                });
+            }
+            while (n_epilogue != n_prologue) {
+            }
+        }
+        ASSERT_EQ(last_solo, n_prologue);
+    }
+}
+
+// batches larger than the ring of SpinOrderedRunner, interleaved with single
+// prologues
+TEST(Runner, PrologueBatch) {
+    const int n_batch = 4, batch_size = 25;
+    for (std::string name : {"ctpl", "spin", "elastic", "worksteal"}) {
+        std::atomic<int> n_solo(0);
+        int last_solo = 0;
+        auto make_prologue = [&last_solo, &n_solo](int i) -> Runner::Prologue {
+            return [i, &last_solo, &n_solo]() {
+                return [i, &last_solo, &n_solo]() {
+                    EXPECT_EQ(last_solo, i);
+                    last_solo += 1;
+                    n_solo += 1;
+                };
+            };
+        };
+        std::unique_ptr<Runner> runner = CreateOrderedRunner(name, 2);
+        int next = 0;
+        for (int i = 0; i < n_batch; i += 1) {
+            runner->RunPrologue(make_prologue(next++));
+            std::vector<Runner::Prologue> batch;
+            for (int j = 0; j < batch_size; j += 1) {
+                batch.push_back(make_prologue(next++));
+            }
+            runner->RunPrologueBatch(batch.data(), batch.size());
+        }
+        while (n_solo != next) {
+        }
+        ASSERT_EQ(last_solo, next);
+    }
+}
+
+TEST(Runner, ElasticShedBatch) {
+    std::atomic<bool> blocked(true);
+    std::vector<int> shed;
+    std::atomic<int> n_run(0);
+    ElasticOrderedRunner runner(1, 4, 2);
+    runner.RunPrologue([&blocked]() {
+        while (blocked) {
+        }
+        return nullptr;
+    });
+    while (runner.GetStats().in_flight == 0) {
+    }
+
+    std::vector<Runner::Prologue> batch;
+    std::vector<Runner::Epilogue> on_shed;
+    auto make_batch = [&](int start, int n) {
+        batch.clear();
+        on_shed.clear();
+        for (int i = start; i < start + n; i += 1) {
+            batch.push_back([&n_run]() {
+                n_run += 1;
+                return nullptr;
+            });
+            on_shed.push_back([i, &shed] { shed.push_back(i); });
+        }
+    };
+    // admitted one by one, so the second half drops the first half
+    make_batch(0, 8);
+    runner.RunSheddablePrologueBatch(
+        batch.data(), on_shed.data(), batch.size());
+    ASSERT_EQ(shed, std::vector<int>({0, 1, 2, 3}));
+    // bursts of protocol messages are never shed
+    make_batch(8, 4);
+    runner.RunPrologueBatch(batch.data(), batch.size());
+    auto stats = runner.GetStats();
+    ASSERT_EQ(stats.queued, 8);
+    ASSERT_EQ(stats.shed, 4);
+
+    blocked = false;
+    while (runner.GetStats().queued + runner.GetStats().in_flight != 0) {
+        sleep_for(milliseconds(1));
+    }
+    ASSERT_EQ(n_run, 8);
+}
+
+TEST(Runner, InlineFunction) {
+    InlineFunction<int(int)> empty;
+    ASSERT_FALSE(empty);
+    empty = nullptr;
+    ASSERT_FALSE(empty);
+
+    // move-only capture, stored inline
+    auto before = TaskPool::GetStats();
+    std::unique_ptr<int> owned(new int(40));
+    InlineFunction<int(int)> add = [owned = std::move(owned)](int x) {
+        return *owned + x;
+    };
+    ASSERT_EQ(add(2), 42);
+    InlineFunction<int(int)> moved = std::move(add);
+    ASSERT_FALSE(add);
+    ASSERT_EQ(moved(2), 42);
+    ASSERT_EQ(TaskPool::GetStats().allocated, before.allocated);
+
+    // too large to be inline, the block is reused by the next one
+    char large[InlineFunction<int(int)>::INLINE_SIZE + 1] = {1};
+    for (int i = 0; i < 2; i += 1) {
+        InlineFunction<int(int)> f = [large](int x) { return large[0] + x; };
+        InlineFunction<int(int)> g = std::move(f);
+        ASSERT_EQ(g(1), 2);
+    }
+    // the first block may come from an earlier run of this test
+    auto after = TaskPool::GetStats();
+    ASSERT_EQ(
+        after.allocated - before.allocated + after.reused - before.reused, 2);
+    ASSERT_GE(after.reused - before.reused, 1);
+}
+
+// messages with replica-like captures (remote address, parsed message,
+// buffer) go through prologue, solo and epilogue with no allocation for the
+// tasks themselves
+TEST(Runner, TaskAllocation) {
+    NoRunner runner;
+    auto before = TaskPool::GetStats();
+    int n_epilogue = 0;
+    for (int i = 0; i < 100; i += 1) {
+        std::unique_ptr<int> remote(new int(i));
+        std::string buffer(64, 'x');
+        runner.RunPrologue(
+            [&, remote = std::move(remote),
+             buffer = std::move(buffer)]() mutable -> Runner::Solo {
+                std::vector<std::string> message{buffer};
+                return [&, remote = std::move(remote),
+                        message = std::move(message)]() mutable {
+                    runner.RunEpilogue(
+                        [&n_epilogue, remote = std::move(remote)] {
+                            n_epilogue += 1;
+                        });
+                };
+            });
+    }
+    ASSERT_EQ(n_epilogue, 100);
+    ASSERT_EQ(TaskPool::GetStats().allocated, before.allocated);
+}
+
+// solos keep the order of their lane, and an unlaned solo never overlaps
+// with a laned one
+TEST(Runner, SoloLanes) {
+    const int n_lane = 4, n_prologue = 400;
+    int64_t budget = Parker::SpinBudget();
+    // parked workers are only woken for their own lane ticket
+    for (int64_t spin_budget : {budget, int64_t(0)}) {
+        Parker::SetSpinBudget(spin_budget);
+        SpinOrderedRunner runner(3, "spin", n_lane);
+        std::vector<int> last(n_lane, -1);
+        std::atomic<int> n_running(0), n_solo(0);
+        for (int i = 0; i < n_prologue; i += 1) {
+            runner.RunPrologue([&, i]() -> Runner::Solo {
+                if (i % 50 == 0) {
+                    return [&] {
+                        EXPECT_EQ(n_running, 0);
+                        n_solo += 1;
+                    };
+                }
+                int key = i % n_lane;
+                return Runner::LaneSolo(key, [&, i, key] {
+                    n_running += 1;
+                    EXPECT_LT(last[key], i);
+                    last[key] = i;
+                    n_running -= 1;
+                    n_solo += 1;
+                });
+            });
+        }
+        while (n_solo != n_prologue) {
+        }
+    }
+    Parker::SetSpinBudget(budget);
+}
+
+// with no spin budget every thread parks while waiting, and must be woken
+// for each prologue, solo and freed slot
+TEST(Runner, Parking) {
+    int64_t budget = Parker::SpinBudget();
+    Parker::SetSpinBudget(0);
+    for (int kind = 0; kind < 4; kind += 1) {
+        std::unique_ptr<Runner> runner(
+            kind == 0   ? (Runner *)new SpinOrderedRunner(2)
+            : kind == 1 ? (Runner *)new SpinRunner(2)
+            : kind == 2 ? (Runner *)new WorkStealingRunner(2)
+                        : (Runner *)new ElasticOrderedRunner(2));
+        std::atomic<int> n_solo(0);
+        for (int i = 0; i < 50; i += 1) {
+            runner->RunPrologue([&n_solo] {
+                return [&n_solo] { n_solo += 1; };
+            });
+            if (i % 10 == 0) {
+                std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            }
+        }
+        while (n_solo != 50) {
+        }
+    }
+    Parker::SetSpinBudget(budget);
+}
+
+#ifndef NRUNNER_METRICS
+TEST(Runner, Metrics) {
+    const int n_prologue = 20;
+    NoRunner runner;
+    for (int i = 0; i < n_prologue; i += 1) {
+        runner.RunPrologue([&runner]() {
+            return [&runner]() { runner.RunEpilogue([] {}); };
+        });
+    }
+
+    RunnerMetrics::Snapshot snapshot = runner.Metrics().Take();
+    ASSERT_EQ(snapshot.name, "no");
+    ASSERT_EQ(snapshot.At(0, RunnerMetrics::Prologue).count, n_prologue);
+    ASSERT_EQ(snapshot.Total(RunnerMetrics::Solo).count, n_prologue);
+    ASSERT_EQ(snapshot.Total(RunnerMetrics::Epilogue).count, n_prologue);
+    ASSERT_EQ(snapshot.Total(RunnerMetrics::DriverSpin).count, 0);
+    const RunnerMetrics::Histogram &prologue =
+        snapshot.At(0, RunnerMetrics::Prologue);
+    uint64_t n_bucketed = 0;
+    for (uint64_t count : prologue.buckets) {
+        n_bucketed += count;
+    }
+    ASSERT_EQ(n_bucketed, n_prologue);
+    ASSERT_LE(prologue.Percentile(0.5), prologue.Percentile(0.99));
+
+    bool found = false;
+    for (auto &other : RunnerMetrics::TakeAll()) {
+        found = found || other.name == "no";
+    }
+    ASSERT_TRUE(found);
+}
+#endif
@@ -1,4 +1,9 @@
+#include "common/keyregistry.h"
+#include "common/pbmessage.h"
 #include "common/signedadapter.h"
+#include "tests/lib/simtransport-testmessage.pb.h"
+#include <cstring>
+#include <fstream>
 #include <gtest/gtest.h>
 
 using namespace dsnet;
@@ -43,3 +48,232 @@ TEST(SignedAdapter, Basic) {
     ASSERT_FALSE(recv_message.IsVerified());
     delete[] buf;
 }
+
+TEST(SignedAdapter, Batch) {
+    vector<string> bufs;
+    for (string content : {"a", "bb", "ccc", "dddd"}) {
+        StringMessage inner;
+        inner.content = content;
+        // unsigned messages may be mixed in
+        SignedAdapter message(inner, "Steve", content != "ccc");
+        string buf(message.SerializedSize(), '\0');
+        message.Serialize(&buf[0]);
+        bufs.push_back(buf);
+    }
+
+    auto parse = [&bufs](vector<StringMessage> &recv_inners) {
+        vector<SignedAdapter> recv_messages;
+        vector<TransportBuffer> buffers;
+        recv_messages.reserve(bufs.size());
+        for (size_t i = 0; i < bufs.size(); i += 1) {
+            recv_messages.emplace_back(recv_inners[i], "");
+            buffers.emplace_back(
+                bufs[i].data(), bufs[i].size(), nullptr, nullptr);
+        }
+        return SignedAdapter::ParseBatch(recv_messages, buffers);
+    };
+
+    vector<StringMessage> recv_inners(bufs.size());
+    ASSERT_TRUE(parse(recv_inners));
+    ASSERT_EQ(recv_inners[0].content, "a");
+    ASSERT_EQ(recv_inners[2].content, "ccc");
+    ASSERT_EQ(recv_inners[3].content, "dddd");
+
+    bufs[1].back() = '?';
+    vector<StringMessage> tampered_inners(bufs.size());
+    ASSERT_FALSE(parse(tampered_inners));
+    ASSERT_EQ(tampered_inners[0].content, "a");
+    ASSERT_EQ(tampered_inners[3].content, "");
+}
+
+TEST(SignedAdapter, ReusedBatch) {
+    auto make = [](vector<string> contents) {
+        vector<string> bufs;
+        for (const string &content : contents) {
+            test::TestMessage inner;
+            inner.set_test(content);
+            PBMessage pb_inner(inner);
+            SignedAdapter message(pb_inner, "Steve");
+            string buf(message.SerializedSize(), '\0');
+            message.Serialize(&buf[0]);
+            bufs.push_back(buf);
+        }
+        return bufs;
+    };
+
+    SignedBatch<test::TestMessage, PBMessage> batch;
+    ASSERT_TRUE(batch.Parse("", make({"a", "bb", "ccc"})));
+    ASSERT_EQ(batch.Message(2).test(), "ccc");
+    // shorter batch reuses the first entries
+    ASSERT_TRUE(batch.Parse("", make({"dddd"})));
+    ASSERT_EQ(batch.Message(0).test(), "dddd");
+    ASSERT_TRUE(batch.Adapter(0).IsVerified());
+    // longer one and another verifier rebuild them
+    ASSERT_TRUE(batch.Parse("r1", make({"e", "f", "g", "h"})));
+    ASSERT_EQ(batch.Message(3).test(), "h");
+
+    vector<string> tampered = make({"i", "j"});
+    tampered[0].back() = '?';
+    ASSERT_FALSE(batch.Parse("r1", tampered));
+    ASSERT_FALSE(batch.Adapter(1).IsVerified());
+}
+
+TEST(SignedAdapter, KeyRegistry) {
+    const string secret(64, '7');
+    KeyRegistry::SetMACGroup({"r0", "r1", "r2"});
+    for (string receiver : {"r0", "r1", "r2"}) {
+        KeyRegistry::Add(receiver, "hmac-sha256", string(64, receiver[1]));
+    }
+    KeyRegistry::Add("ed", "ed25519", secret);
+    KeyRegistry::Add("hmac", "hmac-sha256", secret);
+    KeyRegistry::Add("sip", "halfsiphash", secret);
+
+    for (string identifier : {"ed", "hmac", "sip"}) {
+        StringMessage inner;
+        inner.content = "Hello!";
+        SignedAdapter message(inner, identifier);
+        string buf(message.SerializedSize(), '\0');
+        message.Serialize(&buf[0]);
+
+        for (string verifier : {"r0", "r2"}) {
+            StringMessage recv_inner;
+            SignedAdapter recv_message(recv_inner, verifier);
+            recv_message.Parse(buf.data(), buf.size());
+            ASSERT_TRUE(recv_message.IsVerified());
+            ASSERT_EQ(recv_message.Identifier(), identifier);
+            ASSERT_EQ(recv_inner.content, "Hello!");
+        }
+
+        string tampered = buf;
+        tampered.back() = '?';
+        StringMessage recv_inner;
+        SignedAdapter recv_message(recv_inner, "r1");
+        recv_message.Parse(tampered.data(), tampered.size());
+        ASSERT_FALSE(recv_message.IsVerified());
+    }
+
+    // MAC vectors only verify for receivers in macgroup
+    StringMessage inner, recv_inner;
+    inner.content = "Hello!";
+    SignedAdapter message(inner, "hmac");
+    string buf(message.SerializedSize(), '\0');
+    message.Serialize(&buf[0]);
+    SignedAdapter outsider(recv_inner, "r3");
+    outsider.Parse(buf.data(), buf.size());
+    ASSERT_FALSE(outsider.IsVerified());
+
+    // unknown identifier is not trusted
+    memcpy(&buf[0], "Bob", 4);
+    SignedAdapter unknown(recv_inner, "r0");
+    unknown.Parse(buf.data(), buf.size());
+    ASSERT_FALSE(unknown.IsVerified());
+}
+
+static string SignHello(const string &identifier) {
+    StringMessage inner;
+    inner.content = "Hello!";
+    SignedAdapter message(inner, identifier);
+    string buf(message.SerializedSize(), '\0');
+    message.Serialize(&buf[0]);
+    return buf;
+}
+
+static bool VerifyHello(const string &buf) {
+    StringMessage inner;
+    SignedAdapter message(inner, "");
+    message.Parse(buf.data(), buf.size());
+    return message.IsVerified();
+}
+
+// peers are known by their public keys, which only verify
+TEST(SignedAdapter, PublicKey) {
+    for (string scheme : {"secp256k1", "ed25519"}) {
+        KeyRegistry::Add("pk", scheme, string(64, '5'));
+        string public_key = KeyRegistry::PublicKey("pk");
+        ASSERT_FALSE(public_key.empty());
+        string buf = SignHello("pk");
+
+        KeyRegistry::Add("pk", scheme, "pub:" + public_key);
+        ASSERT_EQ(KeyRegistry::PublicKey("pk"), public_key);
+        ASSERT_TRUE(VerifyHello(buf));
+        buf.back() = '?';
+        ASSERT_FALSE(VerifyHello(buf));
+        EXPECT_DEATH(SignHello("pk"), "secret to sign");
+    }
+    ASSERT_TRUE(KeyRegistry::PublicKey("Alex").empty());
+}
+
+// a node keeps the secret of its own identity only
+TEST(SignedAdapter, LoadOwnSecret) {
+    std::ifstream stream("tests/lib/signedadapter-test.conf");
+    Configuration config(stream);
+    KeyRegistry::Load(config, config.identity(0));
+
+    string buf = SignHello("k0");
+    ASSERT_TRUE(VerifyHello(buf));
+    EXPECT_DEATH(SignHello("k1"), "secret to sign");
+    ASSERT_FALSE(KeyRegistry::PublicKey("k1").empty());
+}
+
+TEST(SignedAdapter, PairwiseMACKey) {
+    unsigned char digest[32] = "Hello pair!";
+    KeyRegistry::SetMACGroup({"p0", "p1"});
+    KeyRegistry::Add("p0", "hmac-sha256", string(64, 'a'));
+    KeyRegistry::Add("p1", "hmac-sha256", string(64, 'b'));
+    KeyRegistry::Add("ps", "hmac-sha256", string(64, 'c'));
+    auto sign = [&] {
+        const Identity *identity = KeyRegistry::Find("ps");
+        string auth(identity->AuthSize(), '\0');
+        identity->Sign(digest, (unsigned char *)&auth[0]);
+        return auth;
+    };
+    auto verify = [&](const string &auth, const string &verifier) {
+        return KeyRegistry::Find("ps")->Verify(
+            digest, (const unsigned char *)auth.data(), verifier);
+    };
+    string auth = sign();
+    ASSERT_TRUE(verify(auth, "p0"));
+    ASSERT_TRUE(verify(auth, "p1"));
+
+    // the entry of p0 depends on the secret of p0, so p1 holding the secret
+    // of ps cannot compute it
+    KeyRegistry::Add("p0", "hmac-sha256", string(64, 'e'));
+    string other = sign();
+    ASSERT_NE(auth.substr(0, 32), other.substr(0, 32));
+    ASSERT_EQ(auth.substr(32), other.substr(32));
+    KeyRegistry::Add("p0", "hmac-sha256", "-");
+    ASSERT_FALSE(verify(auth, "p0"));
+    ASSERT_TRUE(verify(auth, "p1"));
+
+    // configured key of the pair takes over the derived one
+    KeyRegistry::AddMACKey("ps", "p0", string(64, 'd'));
+    other = sign();
+    ASSERT_NE(auth.substr(0, 32), other.substr(0, 32));
+    ASSERT_TRUE(verify(other, "p0"));
+    ASSERT_TRUE(verify(other, "p1"));
+}
+
+TEST(SignedAdapter, VerifyCache) {
+    StringMessage inner;
+    inner.content = "Hello cache!";
+    SignedAdapter message(inner, "Steve");
+    string buf(message.SerializedSize(), '\0');
+    message.Serialize(&buf[0]);
+
+    auto parse = [](const string &buf) {
+        StringMessage recv_inner;
+        SignedAdapter recv_message(recv_inner, "");
+        recv_message.Parse(buf.data(), buf.size());
+        return recv_message.IsVerified();
+    };
+    auto stats = SignedAdapter::GetVerifyCacheStats();
+    ASSERT_TRUE(parse(buf));
+    ASSERT_EQ(SignedAdapter::GetVerifyCacheStats().miss, stats.miss + 1);
+    ASSERT_TRUE(parse(buf));
+    ASSERT_EQ(SignedAdapter::GetVerifyCacheStats().hit, stats.hit + 1);
+
+    // same content with another signature is checked again
+    buf[8] ^= 1;
+    ASSERT_FALSE(parse(buf));
+    ASSERT_EQ(SignedAdapter::GetVerifyCacheStats().miss, stats.miss + 2);
+}
@@ -0,0 +1,150 @@
+#include "lib/timerwheel.h"
+#include <gtest/gtest.h>
+#include <thread>
+#include <vector>
+
+using namespace dsnet;
+
+TEST(TimerWheel, FireOnDeadline) {
+    TimerWheel wheel(1000);
+    int fired = 0;
+    wheel.Add(10, [&]() { fired += 1; });
+    wheel.Advance(1010);
+    ASSERT_EQ(fired, 0);
+    // the tick that is current when adding may be almost over
+    wheel.Advance(1011);
+    ASSERT_EQ(fired, 1);
+    ASSERT_TRUE(wheel.Empty());
+}
+
+TEST(TimerWheel, DeadlineOrder) {
+    TimerWheel wheel(0);
+    std::vector<uint64_t> order;
+    // across all levels, and not inserted in order
+    for (uint64_t ms : {70000ul, 3ul, 300ul, 20000000ul, 255ul, 256ul, 0ul}) {
+        wheel.Add(ms, [&order, ms]() { order.push_back(ms); });
+    }
+    wheel.Advance(20000001);
+    ASSERT_EQ(
+        order,
+        std::vector<uint64_t>({0, 3, 255, 256, 300, 70000, 20000000}));
+}
+
+TEST(TimerWheel, Cancel) {
+    TimerWheel wheel(0);
+    int fired = 0;
+    int id = wheel.Add(10, [&]() { fired += 1; });
+    ASSERT_TRUE(wheel.Cancel(id));
+    ASSERT_FALSE(wheel.Cancel(id));
+    wheel.Advance(100);
+    ASSERT_EQ(fired, 0);
+    // stale id does not match the reused entry
+    int new_id = wheel.Add(10, [&]() { fired += 1; });
+    ASSERT_NE(new_id, id);
+    ASSERT_FALSE(wheel.Cancel(id));
+    wheel.Advance(111);
+    ASSERT_EQ(fired, 1);
+}
+
+TEST(TimerWheel, Reset) {
+    TimerWheel wheel(0);
+    int fired = 0;
+    int id = wheel.Add(10, [&]() { fired += 1; });
+    for (uint64_t now = 5; now < 1000; now += 5) {
+        wheel.Advance(now);
+        ASSERT_TRUE(wheel.Reset(id, 10));
+    }
+    ASSERT_EQ(fired, 0);
+    wheel.Advance(1009);
+    ASSERT_EQ(fired, 1);
+    ASSERT_FALSE(wheel.Reset(id, 10));
+}
+
+TEST(TimerWheel, CallbackRearm) {
+    TimerWheel wheel(0);
+    int fired = 0, cancel_id;
+    std::function<void()> cb = [&]() {
+        fired += 1;
+        wheel.Add(10, cb);
+        // canceling a timer due on the same tick
+        wheel.Cancel(cancel_id);
+    };
+    wheel.Add(10, cb);
+    cancel_id = wheel.Add(10, [&]() { FAIL(); });
+    wheel.Advance(95);
+    ASSERT_EQ(fired, 8);
+}
+
+TEST(TimerQueue, Foreign) {
+    uint64_t now = 0;
+    TimerQueue queue([&now]() { return now; });
+    int fired = 0, id;
+    std::thread([&]() {
+        ASSERT_FALSE(queue.IsOwner());
+        queue.Add(10, [&]() { fired += 1; });
+        id = queue.Add(10, [&]() { fired += 10; });
+        ASSERT_FALSE(queue.Reset(id, 20));
+    }).join();
+    ASSERT_FALSE(queue.Empty());
+    ASSERT_TRUE(queue.Cancel(id));
+    now = 11;
+    queue.Poll();
+    ASSERT_EQ(fired, 1);
+    ASSERT_TRUE(queue.Empty());
+}
+
+TEST(TimerQueue, Tag) {
+    TimerQueue queue([]() { return 0; }, 5);
+    int id = queue.Add(10, []() {});
+    ASSERT_EQ(TimerQueue::Tag(id), 5);
+    std::thread([&]() { id = queue.Add(10, []() {}); }).join();
+    ASSERT_EQ(TimerQueue::Tag(id), 5);
+    ASSERT_TRUE(queue.Cancel(id));
+}
+
+TEST(TimerQueue, IdleClock) {
+    uint64_t now = 0;
+    TimerQueue queue([&now]() { return now; });
+    int fired = 0;
+    // nobody polls while the queue is empty
+    now = 1000;
+    queue.Add(10, [&]() { fired += 1; });
+    now = 1010;
+    queue.Poll();
+    ASSERT_EQ(fired, 0);
+    now = 1011;
+    queue.Poll();
+    ASSERT_EQ(fired, 1);
+}
+
+TEST(TimerWheel, NextDeadline) {
+    TimerWheel wheel(0);
+    ASSERT_EQ(wheel.NextDeadline(), UINT64_MAX);
+    int id = wheel.Add(100, []() {});
+    ASSERT_EQ(wheel.NextDeadline(), 101);
+    // far ones are due when they move to level 0
+    wheel.Cancel(id);
+    wheel.Add(1000, []() {});
+    ASSERT_EQ(wheel.NextDeadline(), 768);
+    wheel.Advance(767);
+    ASSERT_EQ(wheel.NextDeadline(), 768);
+    wheel.Advance(768);
+    ASSERT_EQ(wheel.NextDeadline(), 1001);
+}
+
+TEST(TimerQueue, AddBetweenPolls) {
+    uint64_t now = 0;
+    TimerQueue queue([&now]() { return now; });
+    int fired = 0;
+    queue.Add(1000, []() {});
+    // 10 ms from when it is added, not from the last poll
+    now = 500;
+    queue.Add(10, [&]() { fired += 1; });
+    ASSERT_LE(queue.NextDeadline(), 511);
+    now = 510;
+    queue.Poll();
+    ASSERT_EQ(fired, 0);
+    now = 511;
+    queue.Poll();
+    ASSERT_EQ(fired, 1);
+}
@@ -6,7 +6,10 @@ GTEST_SRCS += \
 	$(d)spec-test.cc \
 	$(d)spec/merge-test.cc \
 	$(d)vr-test.cc \
-	$(d)unreplicated-test.cc
+	$(d)unreplicated-test.cc \
+	$(d)pbft-test.cc \
+	$(d)hotstuff-test.cc \
+	$(d)minbft-test.cc
 
 PROTOS += $(d)spec/merge-test-case.proto
 
@@ -16,7 +19,10 @@ TEST_BINS += \
 	$(d)spec-test \
 	$(d)spec/merge-test \
 	$(d)vr-test \
-	$(d)unreplicated-test
+	$(d)unreplicated-test \
+	$(d)pbft-test \
+	$(d)hotstuff-test \
+	$(d)minbft-test
 
 $(d)fastpaxos-test: $(o)fastpaxos-test.o \
 	$(OBJS-fastpaxos-replica) \
@@ -58,3 +64,24 @@ $(d)spec/merge-test: $(o)spec/merge-test.o \
 	$(OBJS-spec-client) \
 	$(LIB-simtransport) \
 	$(GTEST_MAIN)
+
+$(d)pbft-test: $(o)pbft-test.o \
+	$(OBJS-pbft-replica) \
+	$(OBJS-pbft-client) \
+	$(LIB-simtransport) \
+	$(GTEST_MAIN)
+$(o)pbft-test.o: $(OBJS-pbft-replica) $(OBJS-pbft-client)
+
+$(d)hotstuff-test: $(o)hotstuff-test.o \
+	$(OBJS-hotstuff-replica) \
+	$(OBJS-hotstuff-client) \
+	$(LIB-simtransport) \
+	$(GTEST_MAIN)
+$(o)hotstuff-test.o: $(OBJS-hotstuff-replica) $(OBJS-hotstuff-client)
+
+$(d)minbft-test: $(o)minbft-test.o \
+	$(OBJS-minbft-replica) \
+	$(OBJS-minbft-client) \
+	$(LIB-simtransport) \
+	$(GTEST_MAIN)
+$(o)minbft-test.o: $(OBJS-minbft-replica) $(OBJS-minbft-client)
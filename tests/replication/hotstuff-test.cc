@@ -0,0 +1,323 @@
+#include "common/keyregistry.h"
+#include "common/multisig.h"
+#include "common/pbmessage.h"
+#include "common/runner.h"
+#include "common/signedadapter.h"
+#include "lib/configuration.h"
+#include "lib/simtransport.h"
+#include "replication/hotstuff/client.h"
+#include "replication/hotstuff/message.pb.h"
+#include "replication/hotstuff/qc.h"
+#include "replication/hotstuff/replica.h"
+
+#include <chrono>
+#include <fstream>
+#include <gtest/gtest.h>
+#include <mutex>
+#include <set>
+#include <thread>
+
+using namespace dsnet;
+using namespace dsnet::hotstuff;
+using std::map;
+using std::string;
+using std::vector;
+
+class HotStuffTestApp : public AppReplica {
+public:
+    vector<string> ops;
+
+    void ReplicaUpcall(
+        opnum_t opnum, const string &req, string &reply, void *arg = nullptr,
+        void *ret = nullptr) override {
+        ops.push_back(req);
+        reply = "reply: " + req;
+    }
+};
+
+// stands for a replica that is not under test, and keeps the op number of
+// every vote it receives
+class SinkReceiver : public TransportReceiver {
+public:
+    vector<opnum_t> votes;
+
+    void ReceiveMessage(
+        const TransportAddress &remote, void *buf, size_t len) override {
+        const void *inner;
+        size_t inner_size;
+        proto::Message message;
+        if (SignedAdapter::PeekInner(buf, len, inner, inner_size) &&
+            message.ParseFromArray(inner, inner_size) && message.has_vote()) {
+            votes.push_back(message.vote().op_number());
+        }
+    }
+};
+
+static Configuration MakeConfiguration(int n, int f) {
+    map<int, vector<ReplicaAddress>> replicas;
+    for (int i = 0; i < n; i += 1) {
+        replicas[0].push_back(
+            ReplicaAddress("localhost", std::to_string(12345 + i)));
+    }
+    return Configuration(1, n, f, replicas);
+}
+
+static string SignToString(const proto::Message &message) {
+    proto::Message copy = message;
+    PBMessage pb_layer(copy);
+    SignedAdapter signed_layer(pb_layer, "Steve");
+    string buf(signed_layer.SerializedSize(), '\0');
+    signed_layer.Serialize(&buf[0]);
+    return buf;
+}
+
+static TransportBuffer Sign(const proto::Message &message) {
+    string buf = SignToString(message);
+    return TransportBuffer::Copy(&buf[0], buf.size());
+}
+
+static proto::Message MakeRequest(uint64_t client_id, const string &op) {
+    proto::Message message;
+    Request &request = *message.mutable_request();
+    request.set_op(op);
+    request.set_clientid(client_id);
+    request.set_clientreqid(1);
+    return message;
+}
+
+// signed votes of replica 0, 2 and 3 on block `op_number`
+static proto::QC MakeQC(opnum_t op_number) {
+    proto::QC qc;
+    qc.set_op_number(op_number);
+    for (int i : {0, 2, 3}) {
+        proto::Message message;
+        message.mutable_vote()->set_op_number(op_number);
+        message.mutable_vote()->set_replica_index(i);
+        qc.add_signed_vote(SignToString(message));
+    }
+    return qc;
+}
+
+// a block of one request at `op_number` + 1, after the leading NOOP
+static proto::Message MakeGeneric(
+    opnum_t op_number, opnum_t justify, const proto::Message &request) {
+    proto::Message message;
+    proto::Block &block = *message.mutable_generic()->mutable_block();
+    block.set_op_number(op_number);
+    *block.add_request() = request.request();
+    *block.mutable_justify() = MakeQC(justify);
+    return message;
+}
+
+static bool PeekMessage(const Message &m, proto::Message &message) {
+    string buf(m.SerializedSize(), '\0');
+    m.Serialize(&buf[0]);
+    const void *inner;
+    size_t inner_size;
+    return SignedAdapter::PeekInner(buf.data(), buf.size(), inner, inner_size) &&
+           message.ParseFromArray(inner, inner_size);
+}
+
+// a request is only replied after the QCs on two more blocks chain up to
+// its block
+TEST(HotStuff, CommitChain) {
+    const int n_op = 10;
+    Configuration config = MakeConfiguration(4, 1);
+    SimulatedTransport transport;
+    HotStuffTestApp apps[4];
+    NoRunner runners[4];
+    vector<std::unique_ptr<HotStuffReplica>> replicas;
+    for (int i = 0; i < 4; i += 1) {
+        replicas.emplace_back(new HotStuffReplica(
+            config, i, "Steve", runners[i], 1, &transport, &apps[i], 0));
+    }
+    HotStuffClient client(
+        config, ReplicaAddress("localhost", "0"), "Steve", &transport);
+
+    std::set<opnum_t> blocks;
+    transport.AddFilter(
+        1, [&](TransportReceiver *src, std::pair<int, int> src_index,
+               TransportReceiver *dst, std::pair<int, int> dst_index,
+               Message &m, uint64_t &delay) {
+            proto::Message message;
+            if (src_index.second == 0 && PeekMessage(m, message) &&
+                message.has_generic()) {
+                blocks.insert(message.generic().block().op_number());
+            }
+            return true;
+        });
+    int n_reply = 0;
+    size_t n_block_first_reply = 0;
+    vector<string> expected;
+    std::function<void()> invoke = [&] {
+        expected.push_back("op" + std::to_string(n_reply + 1));
+        client.Invoke(
+            expected.back(), [&](const string &request, const string &reply) {
+                if (n_reply == 0) {
+                    n_block_first_reply = blocks.size();
+                }
+                n_reply += 1;
+                if (n_reply < n_op) {
+                    invoke();
+                } else {
+                    transport.Timer(1000, [&] { transport.CancelAllTimers(); });
+                }
+            });
+    };
+    transport.Timer(0, invoke);
+    transport.Run();
+
+    ASSERT_EQ(n_reply, n_op);
+    // the block of the request, and the two blocks carrying QCs on it and on
+    // the one after it
+    ASSERT_GE(n_block_first_reply, 3);
+    for (int i = 0; i < 4; i += 1) {
+        ASSERT_EQ(apps[i].ops, expected);
+    }
+}
+
+// a resent block carries a QC older than the one a backup has seen, which
+// must neither roll back its QC nor commit anything
+TEST(HotStuff, StaleQC) {
+    Configuration config = MakeConfiguration(4, 1);
+    SimulatedTransport transport;
+    SinkReceiver sinks[3];
+    int sink_ids[] = {0, 2, 3};
+    for (int i = 0; i < 3; i += 1) {
+        transport.RegisterReplica(&sinks[i], config, 0, sink_ids[i]);
+    }
+    HotStuffTestApp app;
+    NoRunner runner;
+    HotStuffReplica replica(
+        config, 1, "Steve", runner, 1, &transport, &app, 0);
+    std::unique_ptr<TransportAddress> remote(
+        transport.LookupAddress(config.replica(0, 0)));
+
+    map<opnum_t, proto::Message> requests;
+    for (opnum_t op : {1, 3, 5, 7, 9}) {
+        requests[op] = MakeRequest(op, "op" + std::to_string(op));
+        replica.ReceiveBuffer(*remote, Sign(requests[op]));
+    }
+    replica.ReceiveBuffer(*remote, Sign(MakeGeneric(1, 0, requests[1])));
+    replica.ReceiveBuffer(*remote, Sign(MakeGeneric(3, 1, requests[3])));
+    replica.ReceiveBuffer(*remote, Sign(MakeGeneric(5, 3, requests[5])));
+    ASSERT_TRUE(app.ops.empty());
+    // QC on b5, whose justify certifies b3, whose justify certifies b1
+    replica.ReceiveBuffer(*remote, Sign(MakeGeneric(7, 5, requests[7])));
+    ASSERT_EQ(app.ops, vector<string>({"op1"}));
+    replica.ReceiveBuffer(*remote, Sign(MakeGeneric(9, 7, requests[9])));
+    ASSERT_EQ(app.ops, vector<string>({"op1", "op3"}));
+
+    replica.ReceiveBuffer(*remote, Sign(MakeGeneric(5, 3, requests[5])));
+    ASSERT_EQ(app.ops, vector<string>({"op1", "op3"}));
+
+    transport.Timer(1500, [&] { transport.CancelAllTimers(); });
+    transport.Run();
+    // the resent vote is for the highest QC
+    ASSERT_FALSE(sinks[0].votes.empty());
+    ASSERT_EQ(sinks[0].votes.back(), 7);
+    ASSERT_EQ(app.ops, vector<string>({"op1", "op3"}));
+}
+
+// backups' votes are aggregated into QCs on the primary's workers, many of
+// them at the same time
+TEST(HotStuff, ConcurrentAggregateVotes) {
+    const int n_op = 16;
+    Configuration config = MakeConfiguration(4, 1);
+    SimulatedTransport transport;
+    SinkReceiver sinks[3];
+    for (int i = 0; i < 3; i += 1) {
+        transport.RegisterReplica(&sinks[i], config, 0, i + 1);
+    }
+    std::mutex mutex;
+    vector<proto::Block> blocks;
+    transport.AddFilter(
+        1, [&](TransportReceiver *src, std::pair<int, int> src_index,
+               TransportReceiver *dst, std::pair<int, int> dst_index,
+               Message &m, uint64_t &delay) {
+            proto::Message message;
+            if (dst_index.second == 1 && PeekMessage(m, message) &&
+                message.has_generic()) {
+                std::lock_guard<std::mutex> lock(mutex);
+                blocks.push_back(message.generic().block());
+            }
+            return false;
+        });
+
+    HotStuffTestApp app;
+    ElasticOrderedRunner runner(4);
+    HotStuffReplica replica(
+        config, 0, "Steve", runner, 1, &transport, &app, 0, true);
+    std::unique_ptr<TransportAddress> remote(
+        transport.LookupAddress(config.replica(0, 1)));
+    auto wait_idle = [&runner] {
+        while (runner.GetStats().queued + runner.GetStats().in_flight != 0) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+    };
+
+    std::unique_ptr<MultiSigGroup> group = NewMultiSigGroup(config);
+    vector<std::unique_ptr<VoteSigner>> signers;
+    for (int i = 1; i < 4; i += 1) {
+        signers.emplace_back(
+            new VoteSigner(*group, i, MultiSigSecret(config, i)));
+        proto::Message message;
+        signers.back()->Publish(*message.mutable_nonce());
+        replica.ReceiveBuffer(*remote, Sign(message));
+    }
+    auto vote = [&](opnum_t op_number, const proto::Block *block) {
+        for (int i = 1; i < 4; i += 1) {
+            proto::Message message;
+            message.mutable_vote()->set_op_number(op_number);
+            message.mutable_vote()->set_replica_index(i);
+            signers[i - 1]->Fill(*message.mutable_vote(), block);
+            replica.ReceiveBuffer(*remote, Sign(message));
+        }
+    };
+    vote(0, nullptr);
+    wait_idle();
+    for (int i = 0; i < n_op; i += 1) {
+        replica.ReceiveBuffer(
+            *remote, Sign(MakeRequest(i + 1, "op" + std::to_string(i))));
+    }
+
+    size_t n_voted = 0;
+    for (int round = 0; round < 100 && app.ops.size() < n_op; round += 1) {
+        wait_idle();
+        vector<proto::Block> pending;
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            pending.assign(blocks.begin() + n_voted, blocks.end());
+            n_voted = blocks.size();
+        }
+        // every vote of every pending block at once
+        for (const proto::Block &block : pending) {
+            vote(block.op_number(), &block);
+        }
+    }
+    wait_idle();
+
+    ASSERT_EQ(app.ops.size(), n_op);
+    bool aggregated = false;
+    for (const proto::Block &block : blocks) {
+        aggregated |= !block.justify().aggregate_signature().empty();
+    }
+    ASSERT_TRUE(aggregated);
+}
+
+// replicas multi-sign with the 'multisig' key of their identity, and only
+// the built-in test identity falls back to the test key of its index
+TEST(HotStuff, MultiSigKeys) {
+    std::ifstream stream("tests/replication/hotstuff-test-1.conf");
+    Configuration config(stream);
+    KeyRegistry::Load(config, config.identity(1));
+
+    ASSERT_EQ(MultiSigSecret(config, 1), string(32, '\x77'));
+    ASSERT_EQ(MultiSigSecret(config, 0), MultiSigGroup::TestSecret(0));
+    ASSERT_NE(MultiSigSecret(config, 1), MultiSigGroup::TestSecret(1));
+
+    std::unique_ptr<MultiSigGroup> group = NewMultiSigGroup(config);
+    ASSERT_EQ(group->NSigner(), 4);
+    // signs for replica 1 as configured
+    VoteSigner signer(*group, 1, MultiSigSecret(config, 1));
+}
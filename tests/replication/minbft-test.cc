@@ -0,0 +1,107 @@
+#include "common/keyregistry.h"
+#include "common/pbmessage.h"
+#include "common/runner.h"
+#include "common/signedadapter.h"
+#include "lib/configuration.h"
+#include "lib/simtransport.h"
+#include "replication/minbft/client.h"
+#include "replication/minbft/message.pb.h"
+#include "replication/minbft/replica.h"
+
+#include <fstream>
+#include <gtest/gtest.h>
+
+using namespace dsnet;
+using namespace dsnet::minbft;
+using std::string;
+using std::vector;
+
+class MinBFTTestApp : public AppReplica {
+public:
+    vector<string> ops;
+
+    void ReplicaUpcall(
+        opnum_t opnum, const string &req, string &reply, void *arg = nullptr,
+        void *ret = nullptr) override {
+        ops.push_back(req);
+        reply = "reply: " + req;
+    }
+};
+
+static bool IsPrepare(const Message &m) {
+    string buf(m.SerializedSize(), '\0');
+    m.Serialize(&buf[0]);
+    proto::MinBFTMessage message;
+    const void *inner;
+    size_t inner_size;
+    proto::UIMessage ui_message;
+    // MinBFT[] is Signed[] of the UI followed by the message
+    return message.ParseFromString(buf) && message.has_ui_message() &&
+           SignedAdapter::PeekInner(
+               message.ui_message().data(), message.ui_message().size(), inner,
+               inner_size) &&
+           inner_size >= sizeof(opnum_t) &&
+           ui_message.ParseFromArray(
+               (const char *)inner + sizeof(opnum_t),
+               inner_size - sizeof(opnum_t)) &&
+           ui_message.has_prepare();
+}
+
+// replica 2 misses one Prepare of the primary, which blocks every later UI
+// message of the primary as well, until it replays them by state transfer
+TEST(MinBFT, StateTransfer) {
+    const int n_op = 20, n_dropped_op = 5;
+    std::ifstream stream("tests/replication/minbft-test.conf");
+    Configuration config(stream);
+    for (int i = 0; i < config.n; i += 1) {
+        KeyRegistry::Add(
+            config.identity(i), "ed25519", string(64, '1' + i));
+    }
+    SimulatedTransport transport;
+    MinBFTTestApp apps[3];
+    NoRunner runners[3];
+    vector<std::unique_ptr<MinBFTReplica>> replicas;
+    for (int i = 0; i < 3; i += 1) {
+        replicas.emplace_back(new MinBFTReplica(
+            config, i, config.identity(i), runners[i], 1, &transport,
+            &apps[i]));
+    }
+    MinBFTClient client(
+        config, ReplicaAddress("localhost", "0"), "Steve", &transport);
+
+    int n_reply = 0;
+    bool dropped = false;
+    transport.AddFilter(
+        1, [&](TransportReceiver *src, std::pair<int, int> src_index,
+               TransportReceiver *dst, std::pair<int, int> dst_index,
+               Message &m, uint64_t &delay) {
+            if ( //
+                !dropped && n_reply == n_dropped_op &&
+                src == replicas[0].get() && dst == replicas[2].get() &&
+                IsPrepare(m)) {
+                dropped = true;
+                return false;
+            }
+            return true;
+        });
+    std::function<void()> invoke = [&] {
+        client.Invoke(
+            "op" + std::to_string(n_reply + 1),
+            [&](const string &request, const string &reply) {
+                n_reply += 1;
+                if (n_reply < n_op) {
+                    invoke();
+                } else {
+                    transport.Timer(1000, [&] { transport.CancelAllTimers(); });
+                }
+            });
+    };
+    transport.Timer(0, invoke);
+    transport.Run();
+
+    ASSERT_TRUE(dropped);
+    ASSERT_EQ(n_reply, n_op);
+    ASSERT_EQ(apps[0].ops.size(), n_op);
+    ASSERT_EQ(apps[1].ops, apps[0].ops);
+    ASSERT_EQ(apps[2].ops, apps[0].ops);
+}
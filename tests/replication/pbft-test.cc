@@ -0,0 +1,426 @@
+#include "common/checkpoint.h"
+#include "common/keyregistry.h"
+#include "common/log.h"
+#include "common/pbmessage.h"
+#include "common/runner.h"
+#include "common/signedadapter.h"
+#include "lib/configuration.h"
+#include "lib/simtransport.h"
+#include "replication/pbft/client.h"
+#include "replication/pbft/message.pb.h"
+#include "replication/pbft/replica.h"
+
+#include <atomic>
+#include <chrono>
+#include <gtest/gtest.h>
+#include <thread>
+
+using namespace dsnet;
+using namespace dsnet::pbft;
+using std::map;
+using std::string;
+using std::vector;
+
+class PBFTTestApp : public AppReplica {
+public:
+    vector<string> ops;
+    // op number of the last restored state, 0 if never restored
+    opnum_t restored = 0;
+
+    void ReplicaUpcall(
+        opnum_t opnum, const string &req, string &reply, void *arg = nullptr,
+        void *ret = nullptr) override {
+        ops.push_back(req);
+        reply = "reply: " + req;
+    }
+    void SnapshotUpcall(opnum_t opnum, string &state) override {
+        state.clear();
+        for (const string &op : ops) {
+            state += op + "\n";
+        }
+    }
+    void RestoreUpcall(opnum_t opnum, const string &state) override {
+        ops.clear();
+        size_t start = 0, end;
+        while ((end = state.find('\n', start)) != string::npos) {
+            ops.push_back(state.substr(start, end - start));
+            start = end + 1;
+        }
+        restored = opnum;
+    }
+};
+
+// stands for a replica that is not under test
+class SinkReceiver : public TransportReceiver {
+public:
+    void ReceiveMessage(
+        const TransportAddress &remote, void *buf, size_t len) override {}
+};
+
+static Configuration MakeConfiguration(int n, int f) {
+    map<int, vector<ReplicaAddress>> replicas;
+    for (int i = 0; i < n; i += 1) {
+        replicas[0].push_back(
+            ReplicaAddress("localhost", std::to_string(12345 + i)));
+    }
+    return Configuration(1, n, f, replicas);
+}
+
+static TransportBuffer Sign(
+    const proto::PBFTMessage &message, const string &identifier = "Steve") {
+    proto::PBFTMessage copy = message;
+    PBMessage pb_layer(copy);
+    SignedAdapter signed_layer(pb_layer, identifier);
+    string buf(signed_layer.SerializedSize(), '\0');
+    signed_layer.Serialize(&buf[0]);
+    return TransportBuffer::Copy(&buf[0], buf.size());
+}
+
+TEST(PBFT, ShedClientRequests) {
+    Configuration config = MakeConfiguration(4, 1);
+    SimulatedTransport transport;
+    PBFTTestApp app;
+    ElasticOrderedRunner runner(1, 4, 2);
+    PBFTReplica replica(config, 1, "Steve", runner, 1, &transport, &app);
+    SinkReceiver sinks[3];
+    int sink_ids[] = {0, 2, 3};
+    for (int i = 0; i < 3; i += 1) {
+        transport.RegisterReplica(&sinks[i], config, 0, sink_ids[i]);
+    }
+    std::unique_ptr<TransportAddress> remote(
+        transport.LookupAddress(config.replica(0, 0)));
+
+    // occupy the only worker so that messages stay queued
+    std::atomic<bool> blocked(true);
+    runner.RunPrologue([&blocked] {
+        while (blocked) {
+        }
+        return nullptr;
+    });
+    while (runner.GetStats().in_flight == 0) {
+    }
+
+    for (int i = 0; i < 8; i += 1) {
+        proto::PBFTMessage message;
+        Request &request = *message.mutable_request();
+        request.set_op("op" + std::to_string(i));
+        request.set_clientid(42);
+        request.set_clientreqid(i + 1);
+        replica.ReceiveBuffer(*remote, Sign(message));
+    }
+    for (int i : {0, 2, 3}) {
+        proto::PBFTMessage message;
+        proto::Commit &commit = *message.mutable_commit();
+        commit.set_view_number(0);
+        commit.set_op_number(1);
+        commit.set_batch_size(1);
+        commit.set_digest(string(32, 'x'));
+        commit.set_replica_id(i);
+        replica.ReceiveBuffer(*remote, Sign(message));
+    }
+
+    // the first four requests overload the queue, and every later request
+    // drops an older one, while commits are queued beyond high watermark
+    auto stats = runner.GetStats();
+    ASSERT_EQ(stats.shed, 4);
+    ASSERT_EQ(stats.queued, 7);
+    ASSERT_EQ(stats.admitted, 1 + 8 + 3);
+
+    blocked = false;
+    while (runner.GetStats().queued + runner.GetStats().in_flight != 0) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+}
+
+// a stable checkpoint at op 4 whose proof is signed by `signer` on behalf of
+// replica 0, 2 and 3
+static proto::PBFTMessage MakeStateChunk(
+    const string &app_state, const string &signed_state,
+    const string &signer) {
+    string log_hash(20, 'h');
+    string digest = CheckpointDigest(signed_state, log_hash);
+    proto::PBFTMessage message;
+    proto::StateChunk &chunk = *message.mutable_state_chunk();
+    chunk.set_op_number(5);
+    chunk.set_view_number(0);
+    chunk.set_replica_id(0);
+    proto::StableCheckpoint &stable = *chunk.mutable_checkpoint();
+    stable.set_op_number(4);
+    stable.set_digest(digest);
+    stable.set_log_hash(log_hash);
+    stable.set_app_state(app_state);
+    for (int i : {0, 2, 3}) {
+        proto::PBFTMessage checkpoint_message;
+        proto::Checkpoint &checkpoint = *checkpoint_message.mutable_checkpoint();
+        checkpoint.set_op_number(4);
+        checkpoint.set_digest(digest);
+        checkpoint.set_replica_id(i);
+        stable.add_signed_checkpoint(
+            Sign(checkpoint_message, signer).ToString());
+    }
+    return message;
+}
+
+TEST(PBFT, StateChunkProof) {
+    Configuration config = MakeConfiguration(4, 1);
+    SimulatedTransport transport;
+    PBFTTestApp app;
+    NoRunner runner;
+    PBFTReplica replica(config, 1, "Steve", runner, 1, &transport, &app, 4);
+    SinkReceiver sinks[3];
+    int sink_ids[] = {0, 2, 3};
+    for (int i = 0; i < 3; i += 1) {
+        transport.RegisterReplica(&sinks[i], config, 0, sink_ids[i]);
+    }
+    std::unique_ptr<TransportAddress> remote(
+        transport.LookupAddress(config.replica(0, 0)));
+    const string state = "op1\nop2\nop3\nop4\n";
+
+    // the shipped state is not the one the proof signs
+    replica.ReceiveBuffer(
+        *remote, Sign(MakeStateChunk("evil\n", state, "Steve")));
+    ASSERT_EQ(app.restored, 0);
+    // unsigned Checkpoints do not prove anything of a replica
+    replica.ReceiveBuffer(*remote, Sign(MakeStateChunk(state, state, "Alex")));
+    ASSERT_EQ(app.restored, 0);
+
+    replica.ReceiveBuffer(
+        *remote, Sign(MakeStateChunk(state, state, "Steve")));
+    ASSERT_EQ(app.restored, 4);
+    ASSERT_EQ(app.ops, vector<string>({"op1", "op2", "op3", "op4"}));
+}
+
+static Request MakeRequest(const string &op, uint64_t client_id) {
+    Request request;
+    request.set_op(op);
+    request.set_clientid(client_id);
+    request.set_clientreqid(1);
+    return request;
+}
+
+// entries of op 1 and 2 shipped by `replica_id`
+static proto::PBFTMessage MakeEntryChunk(
+    const vector<Request> &requests, int replica_id) {
+    proto::PBFTMessage message;
+    proto::StateChunk &chunk = *message.mutable_state_chunk();
+    chunk.set_op_number(1);
+    chunk.set_view_number(0);
+    chunk.set_replica_id(replica_id);
+    for (const Request &request : requests) {
+        *chunk.add_request() = request;
+    }
+    return message;
+}
+
+// shipped entries are only taken once a certificate matches them, and the
+// ones of a faulty source are fetched again from another replica
+TEST(PBFT, ShippedEntriesCertified) {
+    Configuration config = MakeConfiguration(4, 1);
+    SimulatedTransport transport;
+    PBFTTestApp app;
+    NoRunner runner;
+    PBFTReplica replica(config, 3, "Steve", runner, 2, &transport, &app, 4);
+    SinkReceiver sinks[3];
+    for (int i = 0; i < 3; i += 1) {
+        transport.RegisterReplica(&sinks[i], config, 0, i);
+    }
+    std::unique_ptr<TransportAddress> remote(
+        transport.LookupAddress(config.replica(0, 0)));
+
+    vector<Request> requests = {MakeRequest("op1", 1), MakeRequest("op2", 2)};
+    Log log(true);
+    for (opnum_t op : {1, 2}) {
+        log.Append(new LogEntry(
+            viewstamp_t(0, op), LOG_STATE_RECEIVED, requests[op - 1]));
+    }
+
+    replica.ReceiveBuffer(
+        *remote,
+        Sign(MakeEntryChunk({requests[0], MakeRequest("evil", 2)}, 0)));
+    ASSERT_TRUE(app.ops.empty());
+    for (int i : {0, 1}) {
+        proto::PBFTMessage message;
+        proto::Commit &commit = *message.mutable_commit();
+        commit.set_view_number(0);
+        commit.set_op_number(1);
+        commit.set_batch_size(2);
+        commit.set_digest(log.Find(2)->hash);
+        commit.set_replica_id(i);
+        replica.ReceiveBuffer(*remote, Sign(message));
+    }
+    ASSERT_TRUE(app.ops.empty());
+
+    replica.ReceiveBuffer(*remote, Sign(MakeEntryChunk(requests, 1)));
+    ASSERT_EQ(app.ops, vector<string>({"op1", "op2"}));
+}
+
+// Commits only count for the replica that signed them, and for batches
+// that the window can hold
+TEST(PBFT, ForgedCommits) {
+    Configuration config = MakeConfiguration(4, 1);
+    SimulatedTransport transport;
+    PBFTTestApp app;
+    NoRunner runner;
+    PBFTReplica replica(config, 3, "Steve", runner, 2, &transport, &app, 4);
+    SinkReceiver sinks[3];
+    for (int i = 0; i < 3; i += 1) {
+        transport.RegisterReplica(&sinks[i], config, 0, i);
+    }
+    std::unique_ptr<TransportAddress> remote(
+        transport.LookupAddress(config.replica(0, 0)));
+    KeyRegistry::Add("Mallory", "ed25519", string(64, '3'));
+
+    vector<Request> requests = {MakeRequest("op1", 1), MakeRequest("op2", 2)};
+    Log log(true);
+    for (opnum_t op : {1, 2}) {
+        log.Append(new LogEntry(
+            viewstamp_t(0, op), LOG_STATE_RECEIVED, requests[op - 1]));
+    }
+    replica.ReceiveBuffer(*remote, Sign(MakeEntryChunk(requests, 1)));
+    auto commit = [&](int replica_id, opnum_t batch_size,
+                      const string &identifier) {
+        proto::PBFTMessage message;
+        proto::Commit &commit = *message.mutable_commit();
+        commit.set_view_number(0);
+        commit.set_op_number(1);
+        commit.set_batch_size(batch_size);
+        commit.set_digest(log.Find(2)->hash);
+        commit.set_replica_id(replica_id);
+        replica.ReceiveBuffer(*remote, Sign(message, identifier));
+    };
+
+    // one faulty replica signs for two
+    commit(0, 2, "Mallory");
+    commit(1, 2, "Mallory");
+    commit(64, 2, "Steve");
+    ASSERT_TRUE(app.ops.empty());
+    commit(0, 1 << 30, "Steve");
+    commit(1, 1 << 30, "Steve");
+    ASSERT_TRUE(app.ops.empty());
+
+    commit(0, 2, "Steve");
+    commit(1, 2, "Steve");
+    ASSERT_EQ(app.ops, vector<string>({"op1", "op2"}));
+}
+
+// replica 3 misses everything for a while and falls more than a window
+// behind, then catches up with the others by state transfer
+TEST(PBFT, StateTransfer) {
+    const int n_op = 40, n_lagging_op = 20;
+    Configuration config = MakeConfiguration(4, 1);
+    SimulatedTransport transport;
+    PBFTTestApp apps[4];
+    NoRunner runners[4];
+    vector<std::unique_ptr<PBFTReplica>> replicas;
+    for (int i = 0; i < 4; i += 1) {
+        replicas.emplace_back(new PBFTReplica(
+            config, i, "Steve", runners[i], 1, &transport, &apps[i], 4, 0,
+            1));
+    }
+    PBFTClient client(
+        config, ReplicaAddress("localhost", "0"), "Steve", &transport);
+
+    transport.AddFilter(
+        1, [](TransportReceiver *src, std::pair<int, int> src_index,
+              TransportReceiver *dst, std::pair<int, int> dst_index,
+              Message &m, uint64_t &delay) { return dst_index.second != 3; });
+    int n_reply = 0;
+    std::function<void()> invoke = [&] {
+        client.Invoke(
+            "op" + std::to_string(n_reply + 1),
+            [&](const string &request, const string &reply) {
+                n_reply += 1;
+                if (n_reply == n_lagging_op) {
+                    transport.RemoveFilter(1);
+                }
+                if (n_reply < n_op) {
+                    invoke();
+                } else {
+                    transport.Timer(1000, [&] { transport.CancelAllTimers(); });
+                }
+            });
+    };
+    transport.Timer(0, invoke);
+    transport.Run();
+
+    ASSERT_EQ(n_reply, n_op);
+    ASSERT_EQ(apps[0].ops.size(), n_op);
+    ASSERT_GT(apps[3].restored, n_lagging_op);
+    ASSERT_EQ(apps[3].ops, apps[0].ops);
+}
+
+static bool IsCommit(const Message &m) {
+    string buf(m.SerializedSize(), '\0');
+    m.Serialize(&buf[0]);
+    const void *inner;
+    size_t inner_size;
+    proto::PBFTMessage message;
+    return SignedAdapter::PeekInner(buf.data(), buf.size(), inner, inner_size) &&
+           message.ParseFromArray(inner, inner_size) && message.has_commit();
+}
+
+// batches of two with four of them in flight, so Commits of later batches
+// overtake earlier ones, while replica 3 falls a window behind and catches up
+TEST(PBFT, PipelinedReorderedCommits) {
+    const int n_client = 8, n_op = 96, n_lagging_op = 32;
+    Configuration config = MakeConfiguration(4, 1);
+    SimulatedTransport transport;
+    PBFTTestApp apps[4];
+    NoRunner runners[4];
+    vector<std::unique_ptr<PBFTReplica>> replicas;
+    for (int i = 0; i < 4; i += 1) {
+        replicas.emplace_back(new PBFTReplica(
+            config, i, "Steve", runners[i], 2, &transport, &apps[i], 4, 0,
+            4));
+    }
+    vector<std::unique_ptr<PBFTClient>> clients;
+    for (int i = 0; i < n_client; i += 1) {
+        clients.emplace_back(new PBFTClient(
+            config, ReplicaAddress("localhost", std::to_string(i)), "Steve",
+            &transport));
+    }
+
+    bool lagging = true;
+    int n_commit = 0;
+    transport.AddFilter(
+        1, [&](TransportReceiver *src, std::pair<int, int> src_index,
+               TransportReceiver *dst, std::pair<int, int> dst_index,
+               Message &m, uint64_t &delay) {
+            if (lagging && dst_index.second == 3) {
+                return false;
+            }
+            if (IsCommit(m)) {
+                delay = 5 - n_commit % 5;
+                n_commit += 1;
+            }
+            return true;
+        });
+    int n_reply = 0, n_done = 0;
+    std::function<void(int)> invoke = [&](int i) {
+        clients[i]->Invoke(
+            "op" + std::to_string(i) + "." + std::to_string(n_reply),
+            [&, i](const string &request, const string &reply) {
+                n_reply += 1;
+                if (n_reply == n_lagging_op) {
+                    lagging = false;
+                }
+                if (n_reply < n_op) {
+                    invoke(i);
+                } else if (++n_done == n_client) {
+                    transport.Timer(1000, [&] { transport.CancelAllTimers(); });
+                }
+            });
+    };
+    for (int i = 0; i < n_client; i += 1) {
+        transport.Timer(0, [&, i] { invoke(i); });
+    }
+    transport.Run();
+
+    ASSERT_EQ(n_done, n_client);
+    ASSERT_GT(n_commit, 0);
+    ASSERT_GE(apps[0].ops.size(), n_op);
+    ASSERT_GT(apps[3].restored, 0);
+    for (int i = 1; i < 4; i += 1) {
+        ASSERT_EQ(apps[i].ops, apps[0].ops);
+    }
+}